@@ -0,0 +1,117 @@
+#include "../bench.h"
+#include "../../simde/arm/neon.h"
+
+SIMDE_BENCH_DEFINE(vaddq_f32, simde_float32x4_t, simde_vaddq_f32(a, b))
+SIMDE_BENCH_DEFINE(vmulq_f32, simde_float32x4_t, simde_vmulq_f32(a, b))
+SIMDE_BENCH_DEFINE(vfmaq_f32, simde_float32x4_t, simde_vfmaq_f32(a, b, c))
+SIMDE_BENCH_DEFINE(vmlaq_f32, simde_float32x4_t, simde_vmlaq_f32(a, b, c))
+SIMDE_BENCH_DEFINE(vdivq_f32, simde_float32x4_t, simde_vdivq_f32(a, b))
+SIMDE_BENCH_DEFINE(vsqrtq_f32, simde_float32x4_t, simde_vsqrtq_f32(a))
+SIMDE_BENCH_DEFINE(vrecpeq_f32, simde_float32x4_t, simde_vrecpeq_f32(a))
+SIMDE_BENCH_DEFINE_TP(vcvtq_s32_f32, simde_float32x4_t, simde_int32x4_t, simde_vcvtq_s32_f32(a))
+SIMDE_BENCH_DEFINE(vaddq_u8, simde_uint8x16_t, simde_vaddq_u8(a, b))
+SIMDE_BENCH_DEFINE(vqaddq_s8, simde_int8x16_t, simde_vqaddq_s8(a, b))
+SIMDE_BENCH_DEFINE(vqrdmulhq_s16, simde_int16x8_t, simde_vqrdmulhq_s16(a, b))
+SIMDE_BENCH_DEFINE(vmulq_s32, simde_int32x4_t, simde_vmulq_s32(a, b))
+SIMDE_BENCH_DEFINE(vpaddlq_u8, simde_uint8x16_t, simde_vreinterpretq_u8_u16(simde_vpaddlq_u8(a)))
+SIMDE_BENCH_DEFINE(vcntq_u8, simde_uint8x16_t, simde_vcntq_u8(a))
+SIMDE_BENCH_DEFINE(vrbitq_u8, simde_uint8x16_t, simde_vrbitq_u8(a))
+SIMDE_BENCH_DEFINE(vqtbl1q_u8, simde_uint8x16_t, simde_vqtbl1q_u8(a, b))
+SIMDE_BENCH_DEFINE(vextq_u8, simde_uint8x16_t, simde_vextq_u8(a, b, 5))
+SIMDE_BENCH_DEFINE(vzip1q_u8, simde_uint8x16_t, simde_vzip1q_u8(a, b))
+SIMDE_BENCH_DEFINE(vuzp1q_u8, simde_uint8x16_t, simde_vuzp1q_u8(a, b))
+SIMDE_BENCH_DEFINE(vbslq_u8, simde_uint8x16_t, simde_vbslq_u8(a, b, c))
+SIMDE_BENCH_DEFINE_TP(vaddvq_u32, simde_uint32x4_t, uint32_t, simde_vaddvq_u32(a))
+SIMDE_BENCH_DEFINE(vdotq_s32, simde_int32x4_t,
+  simde_vdotq_s32(a, simde_vreinterpretq_s8_s32(b), simde_vreinterpretq_s8_s32(c)))
+SIMDE_BENCH_DEFINE(vusdotq_s32, simde_int32x4_t,
+  simde_vusdotq_s32(a, simde_vreinterpretq_u8_s32(b), simde_vreinterpretq_s8_s32(c)))
+SIMDE_BENCH_DEFINE(vmmlaq_s32, simde_int32x4_t,
+  simde_vmmlaq_s32(a, simde_vreinterpretq_s8_s32(b), simde_vreinterpretq_s8_s32(c)))
+SIMDE_BENCH_DEFINE(vaeseq_u8, simde_uint8x16_t, simde_vaeseq_u8(a, b))
+SIMDE_BENCH_DEFINE(vsha256hq_u32, simde_uint32x4_t, simde_vsha256hq_u32(a, b, c))
+
+/* De-interleaving loads and interleaving stores, walking the first
+ * input buffer (or writing the output buffer) one structure at a
+ * time.  These are throughput only. */
+#define SIMDE_BENCH_NEON_LOAD(name, R, E) \
+  static size_t \
+  simde_bench_tp_##name(size_t reps) { \
+    const E* in = HEDLEY_REINTERPRET_CAST(const E*, simde_bench_in[0]); \
+    R* vr = HEDLEY_REINTERPRET_CAST(R*, simde_bench_out); \
+    const size_t n = SIMDE_BENCH_BUFFER_SIZE / sizeof(R); \
+    size_t r, i; \
+    for (r = 0 ; r < reps ; r++) { \
+      for (i = 0 ; i < n ; i++) { \
+        vr[i] = simde_##name(in + (i * (sizeof(R) / sizeof(E)))); \
+      } \
+      SIMDE_BENCH_CLOBBER(); \
+    } \
+    return reps * n; \
+  }
+
+#define SIMDE_BENCH_NEON_STORE(name, V, E) \
+  static size_t \
+  simde_bench_tp_##name(size_t reps) { \
+    const V* vv = HEDLEY_REINTERPRET_CAST(const V*, simde_bench_in[0]); \
+    E* out = HEDLEY_REINTERPRET_CAST(E*, simde_bench_out); \
+    const size_t n = SIMDE_BENCH_BUFFER_SIZE / sizeof(V); \
+    size_t r, i; \
+    for (r = 0 ; r < reps ; r++) { \
+      for (i = 0 ; i < n ; i++) { \
+        simde_##name(out + (i * (sizeof(V) / sizeof(E))), vv[i]); \
+      } \
+      SIMDE_BENCH_CLOBBER(); \
+    } \
+    return reps * n; \
+  }
+
+SIMDE_BENCH_NEON_LOAD(vld2q_u8, simde_uint8x16x2_t, uint8_t)
+SIMDE_BENCH_NEON_LOAD(vld3q_u8, simde_uint8x16x3_t, uint8_t)
+SIMDE_BENCH_NEON_LOAD(vld4q_u8, simde_uint8x16x4_t, uint8_t)
+SIMDE_BENCH_NEON_LOAD(vld3q_f32, simde_float32x4x3_t, simde_float32)
+SIMDE_BENCH_NEON_LOAD(vld4q_u16, simde_uint16x8x4_t, uint16_t)
+SIMDE_BENCH_NEON_STORE(vst2q_u8, simde_uint8x16x2_t, uint8_t)
+SIMDE_BENCH_NEON_STORE(vst3q_u8, simde_uint8x16x3_t, uint8_t)
+SIMDE_BENCH_NEON_STORE(vst4q_u8, simde_uint8x16x4_t, uint8_t)
+SIMDE_BENCH_NEON_STORE(vst3q_f32, simde_float32x4x3_t, simde_float32)
+SIMDE_BENCH_NEON_STORE(vst4q_u16, simde_uint16x8x4_t, uint16_t)
+
+SIMDE_BENCH_BEGIN_SUITE(arm_neon)
+  SIMDE_BENCH_ENTRY(vaddq_f32, f32)
+  SIMDE_BENCH_ENTRY(vmulq_f32, f32)
+  SIMDE_BENCH_ENTRY(vfmaq_f32, f32)
+  SIMDE_BENCH_ENTRY(vmlaq_f32, f32)
+  SIMDE_BENCH_ENTRY(vdivq_f32, f32)
+  SIMDE_BENCH_ENTRY(vsqrtq_f32, f32)
+  SIMDE_BENCH_ENTRY(vrecpeq_f32, f32)
+  SIMDE_BENCH_ENTRY_TP(vcvtq_s32_f32, f32)
+  SIMDE_BENCH_ENTRY(vaddq_u8, bytes)
+  SIMDE_BENCH_ENTRY(vqaddq_s8, bytes)
+  SIMDE_BENCH_ENTRY(vqrdmulhq_s16, bytes)
+  SIMDE_BENCH_ENTRY(vmulq_s32, bytes)
+  SIMDE_BENCH_ENTRY(vpaddlq_u8, bytes)
+  SIMDE_BENCH_ENTRY(vcntq_u8, bytes)
+  SIMDE_BENCH_ENTRY(vrbitq_u8, bytes)
+  SIMDE_BENCH_ENTRY(vqtbl1q_u8, bytes)
+  SIMDE_BENCH_ENTRY(vextq_u8, bytes)
+  SIMDE_BENCH_ENTRY(vzip1q_u8, bytes)
+  SIMDE_BENCH_ENTRY(vuzp1q_u8, bytes)
+  SIMDE_BENCH_ENTRY(vbslq_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vaddvq_u32, bytes)
+  SIMDE_BENCH_ENTRY(vdotq_s32, bytes)
+  SIMDE_BENCH_ENTRY(vusdotq_s32, bytes)
+  SIMDE_BENCH_ENTRY(vmmlaq_s32, bytes)
+  SIMDE_BENCH_ENTRY(vaeseq_u8, bytes)
+  SIMDE_BENCH_ENTRY(vsha256hq_u32, bytes)
+  SIMDE_BENCH_ENTRY_TP(vld2q_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vld3q_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vld4q_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vld3q_f32, f32)
+  SIMDE_BENCH_ENTRY_TP(vld4q_u16, bytes)
+  SIMDE_BENCH_ENTRY_TP(vst2q_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vst3q_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vst4q_u8, bytes)
+  SIMDE_BENCH_ENTRY_TP(vst3q_f32, f32)
+  SIMDE_BENCH_ENTRY_TP(vst4q_u16, bytes)
+SIMDE_BENCH_END_SUITE(arm_neon, "arm/neon")
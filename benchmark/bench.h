@@ -0,0 +1,178 @@
+#if !defined(SIMDE_BENCH_H)
+#define SIMDE_BENCH_H
+
+#include "../simde/hedley.h"
+#include "../simde/simde-common.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* all benchmarks benefit from these */
+SIMDE_DIAGNOSTIC_DISABLE_PADDED_
+SIMDE_DIAGNOSTIC_DISABLE_CPP98_COMPAT_PEDANTIC_
+SIMDE_DIAGNOSTIC_DISABLE_DISABLED_MACRO_EXPANSION_
+SIMDE_DIAGNOSTIC_DISABLE_BUGGY_CASTS_
+SIMDE_DIAGNOSTIC_DISABLE_RESERVED_ID_
+SIMDE_DIAGNOSTIC_DISABLE_C99_EXTENSIONS_
+SIMDE_DIAGNOSTIC_DISABLE_USED_BUT_MARKED_UNUSED_
+SIMDE_DIAGNOSTIC_DISABLE_NO_EMMS_INSTRUCTION_
+
+#if !defined(SIMDE_BENCH_TIER)
+  #if defined(SIMDE_NO_NATIVE)
+    #define SIMDE_BENCH_TIER "emul"
+  #else
+    #define SIMDE_BENCH_TIER "native"
+  #endif
+#endif
+
+/* Each input buffer (and the output buffer) is this many bytes.  It
+ * is small enough that three inputs and the output stay resident in
+ * L1 on everything we care about, so the numbers reflect the
+ * instruction sequence rather than the memory subsystem. */
+#define SIMDE_BENCH_BUFFER_SIZE 4096
+/* The output buffer is larger so that functions returning wider types
+ * than they consume (vld3q, widening conversions, ...) fit. */
+#define SIMDE_BENCH_OUTPUT_SIZE (SIMDE_BENCH_BUFFER_SIZE * 4)
+
+/* Three 64-byte aligned input buffers, one output buffer, and a buffer
+ * of zeros which the compiler can't see through. */
+extern void* simde_bench_in[3];
+extern void* simde_bench_out;
+extern const void* simde_bench_zeros;
+
+/* Fill the inputs; each benchmark picks one. */
+void simde_bench_fill_bytes(void);
+void simde_bench_fill_f32(void);
+void simde_bench_fill_f64(void);
+void simde_bench_fill_f32_small(void);
+void simde_bench_fill_f32_denormal(void);
+
+/* Both functions run the benchmark body `reps` times and return the
+ * number of intrinsic calls that made. */
+typedef size_t (*SimdeBenchFunc)(size_t reps);
+
+typedef struct {
+  const char* name;
+  SimdeBenchFunc throughput;
+  SimdeBenchFunc latency;
+  void (*setup)(void);
+} SimdeBenchmark;
+
+typedef struct {
+  const char* name;
+  const SimdeBenchmark* benchmarks;
+} SimdeBenchSuite;
+
+/* Keep the compiler from hoisting work out of the repetition loop or
+ * dropping stores nobody reads. */
+#if defined(HEDLEY_MSVC_VERSION)
+  #include <intrin.h>
+  #define SIMDE_BENCH_CLOBBER() _ReadWriteBarrier()
+#elif defined(HEDLEY_GCC_VERSION) || defined(__clang__) || HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+  #define SIMDE_BENCH_CLOBBER() __asm__ __volatile__("" ::: "memory")
+#else
+  extern volatile int simde_bench_clobber_sink;
+  #define SIMDE_BENCH_CLOBBER() (simde_bench_clobber_sink = 0)
+#endif
+
+/* SIMDE_BENCH_MIX_<T>(in, prev, zero) returns `in`, but with a data
+ * dependency on `prev`, so latency benchmarks form a single chain of
+ * calls.  It costs one AND and one XOR per call, which is included in
+ * the reported latency. */
+#define SIMDE_BENCH_MIX_simde__m128(in, prev, zero) simde_mm_xor_ps((in), simde_mm_and_ps((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m128d(in, prev, zero) simde_mm_xor_pd((in), simde_mm_and_pd((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m128i(in, prev, zero) simde_mm_xor_si128((in), simde_mm_and_si128((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m256(in, prev, zero) simde_mm256_xor_ps((in), simde_mm256_and_ps((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m256d(in, prev, zero) simde_mm256_xor_pd((in), simde_mm256_and_pd((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m256i(in, prev, zero) simde_mm256_xor_si256((in), simde_mm256_and_si256((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m512(in, prev, zero) simde_mm512_xor_ps((in), simde_mm512_and_ps((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m512d(in, prev, zero) simde_mm512_xor_pd((in), simde_mm512_and_pd((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde__m512i(in, prev, zero) simde_mm512_xor_si512((in), simde_mm512_and_si512((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde_uint8x16_t(in, prev, zero) simde_veorq_u8((in), simde_vandq_u8((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde_int8x16_t(in, prev, zero) simde_veorq_s8((in), simde_vandq_s8((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde_int16x8_t(in, prev, zero) simde_veorq_s16((in), simde_vandq_s16((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde_int32x4_t(in, prev, zero) simde_veorq_s32((in), simde_vandq_s32((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde_uint32x4_t(in, prev, zero) simde_veorq_u32((in), simde_vandq_u32((prev), (zero)))
+#define SIMDE_BENCH_MIX_simde_float32x4_t(in, prev, zero) \
+  simde_vreinterpretq_f32_u32(simde_veorq_u32(simde_vreinterpretq_u32_f32(in), \
+    simde_vandq_u32(simde_vreinterpretq_u32_f32(prev), simde_vreinterpretq_u32_f32(zero))))
+#define SIMDE_BENCH_MIX_uint32_t(in, prev, zero) ((in) ^ ((prev) & (zero)))
+#define SIMDE_BENCH_MIX_uint64_t(in, prev, zero) ((in) ^ ((prev) & (zero)))
+
+/* SIMDE_BENCH_DEFINE_TP(name, T, R, expr) defines a throughput
+ * benchmark: `expr` is evaluated once per T in the input buffers, with
+ * `a`, `b` and `c` bound to the corresponding elements of the three
+ * inputs, and the R result is stored.  The calls are independent, so
+ * the compiler and CPU are free to overlap them. */
+#define SIMDE_BENCH_DEFINE_TP(name, T, R, expr) \
+  static size_t \
+  simde_bench_tp_##name(size_t reps) { \
+    const T* va = HEDLEY_REINTERPRET_CAST(const T*, simde_bench_in[0]); \
+    const T* vb = HEDLEY_REINTERPRET_CAST(const T*, simde_bench_in[1]); \
+    const T* vc = HEDLEY_REINTERPRET_CAST(const T*, simde_bench_in[2]); \
+    R* vr = HEDLEY_REINTERPRET_CAST(R*, simde_bench_out); \
+    const size_t n = SIMDE_BENCH_BUFFER_SIZE / sizeof(T); \
+    size_t r, i; \
+    for (r = 0 ; r < reps ; r++) { \
+      for (i = 0 ; i < n ; i++) { \
+        const T a = va[i]; \
+        const T b = vb[i]; \
+        const T c = vc[i]; \
+        (void) a; (void) b; (void) c; \
+        vr[i] = (expr); \
+      } \
+      SIMDE_BENCH_CLOBBER(); \
+    } \
+    return reps * n; \
+  }
+
+/* SIMDE_BENCH_DEFINE(name, T, expr) defines both a throughput and a
+ * latency benchmark for an expression returning T.  In the latency
+ * version the result of each call feeds `a` of the next one. */
+#define SIMDE_BENCH_DEFINE(name, T, expr) \
+  SIMDE_BENCH_DEFINE_TP(name, T, T, expr) \
+  static size_t \
+  simde_bench_lat_##name(size_t reps) { \
+    const T* va = HEDLEY_REINTERPRET_CAST(const T*, simde_bench_in[0]); \
+    const T* vb = HEDLEY_REINTERPRET_CAST(const T*, simde_bench_in[1]); \
+    const T* vc = HEDLEY_REINTERPRET_CAST(const T*, simde_bench_in[2]); \
+    const T zero = *HEDLEY_REINTERPRET_CAST(const T*, simde_bench_zeros); \
+    const size_t n = SIMDE_BENCH_BUFFER_SIZE / sizeof(T); \
+    T x = va[0]; \
+    size_t r, i; \
+    for (r = 0 ; r < reps ; r++) { \
+      for (i = 0 ; i < n ; i++) { \
+        const T a = SIMDE_BENCH_MIX_##T(va[i], x, zero); \
+        const T b = vb[i]; \
+        const T c = vc[i]; \
+        (void) b; (void) c; \
+        x = (expr); \
+      } \
+    } \
+    *HEDLEY_REINTERPRET_CAST(T*, simde_bench_out) = x; \
+    SIMDE_BENCH_CLOBBER(); \
+    return reps * n; \
+  }
+
+#define SIMDE_BENCH_ENTRY(name, fill) \
+  { #name, simde_bench_tp_##name, simde_bench_lat_##name, simde_bench_fill_##fill },
+#define SIMDE_BENCH_ENTRY_TP(name, fill) \
+  { #name, simde_bench_tp_##name, NULL, simde_bench_fill_##fill },
+#define SIMDE_BENCH_ENTRY_CUSTOM(name, throughput, latency, fill) \
+  { #name, throughput, latency, simde_bench_fill_##fill },
+
+#define SIMDE_BENCH_SUITE_FUNC_NAME(suite) HEDLEY_CONCAT3(simde_bench_, suite, _get_suite)
+
+#define SIMDE_BENCH_BEGIN_SUITE(suite) \
+  static const SimdeBenchmark HEDLEY_CONCAT3(simde_bench_, suite, _benchmarks)[] = {
+#define SIMDE_BENCH_END_SUITE(suite, path) \
+    { NULL, NULL, NULL, NULL } \
+  }; \
+  const SimdeBenchSuite* SIMDE_BENCH_SUITE_FUNC_NAME(suite)(void); \
+  const SimdeBenchSuite* \
+  SIMDE_BENCH_SUITE_FUNC_NAME(suite)(void) { \
+    static const SimdeBenchSuite suite_ = { path, HEDLEY_CONCAT3(simde_bench_, suite, _benchmarks) }; \
+    return &suite_; \
+  }
+
+#endif /* !defined(SIMDE_BENCH_H) */
@@ -0,0 +1,15 @@
+SIMDE_BENCH_DECLARE_SUITE(x86_sse)
+SIMDE_BENCH_DECLARE_SUITE(x86_sse2)
+SIMDE_BENCH_DECLARE_SUITE(x86_ssse3)
+SIMDE_BENCH_DECLARE_SUITE(x86_sse4_1)
+SIMDE_BENCH_DECLARE_SUITE(x86_sse4_2)
+SIMDE_BENCH_DECLARE_SUITE(x86_avx2)
+SIMDE_BENCH_DECLARE_SUITE(x86_avx512)
+SIMDE_BENCH_DECLARE_SUITE(x86_gfni)
+SIMDE_BENCH_DECLARE_SUITE(x86_svml)
+SIMDE_BENCH_DECLARE_SUITE(x86_f16c)
+SIMDE_BENCH_DECLARE_SUITE(x86_bmi2)
+SIMDE_BENCH_DECLARE_SUITE(x86_sha)
+SIMDE_BENCH_DECLARE_SUITE(x86_aes)
+SIMDE_BENCH_DECLARE_SUITE(x86_clmul)
+SIMDE_BENCH_DECLARE_SUITE(arm_neon)
@@ -0,0 +1,534 @@
+#if !defined(_POSIX_C_SOURCE) && !defined(_WIN32)
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#endif
+
+void* simde_bench_in[3];
+void* simde_bench_out;
+const void* simde_bench_zeros;
+#if !defined(HEDLEY_MSVC_VERSION) && !defined(HEDLEY_GCC_VERSION) && !defined(__clang__) && !HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+  volatile int simde_bench_clobber_sink;
+#endif
+
+#define SIMDE_BENCH_DECLARE_SUITE(name) const SimdeBenchSuite* HEDLEY_CONCAT3(simde_bench_, name, _get_suite)(void);
+#include "declare-suites.h"
+#undef SIMDE_BENCH_DECLARE_SUITE
+
+/* Features SIMDe will use native implementations for in this build.
+ * Each tier is the same source compiled with different
+ * SIMDE_*_NO_NATIVE macros, so this is what tells runs apart. */
+static const char* const simde_bench_native_features[] = {
+  #if defined(SIMDE_X86_MMX_NATIVE)
+    "x86/mmx",
+  #endif
+  #if defined(SIMDE_X86_SSE_NATIVE)
+    "x86/sse",
+  #endif
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    "x86/sse2",
+  #endif
+  #if defined(SIMDE_X86_SSE3_NATIVE)
+    "x86/sse3",
+  #endif
+  #if defined(SIMDE_X86_SSSE3_NATIVE)
+    "x86/ssse3",
+  #endif
+  #if defined(SIMDE_X86_SSE4_1_NATIVE)
+    "x86/sse4.1",
+  #endif
+  #if defined(SIMDE_X86_SSE4_2_NATIVE)
+    "x86/sse4.2",
+  #endif
+  #if defined(SIMDE_X86_XOP_NATIVE)
+    "x86/xop",
+  #endif
+  #if defined(SIMDE_X86_AVX_NATIVE)
+    "x86/avx",
+  #endif
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    "x86/fma",
+  #endif
+  #if defined(SIMDE_X86_F16C_NATIVE)
+    "x86/f16c",
+  #endif
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    "x86/avx2",
+  #endif
+  #if defined(SIMDE_X86_AVXVNNI_NATIVE)
+    "x86/avxvnni",
+  #endif
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    "x86/avx512f",
+  #endif
+  #if defined(SIMDE_X86_AVX512BW_NATIVE)
+    "x86/avx512bw",
+  #endif
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    "x86/avx512cd",
+  #endif
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE)
+    "x86/avx512dq",
+  #endif
+  #if defined(SIMDE_X86_AVX512VL_NATIVE)
+    "x86/avx512vl",
+  #endif
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
+    "x86/avx512vbmi",
+  #endif
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    "x86/avx512vbmi2",
+  #endif
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE)
+    "x86/avx512vnni",
+  #endif
+  #if defined(SIMDE_X86_AVX512BITALG_NATIVE)
+    "x86/avx512bitalg",
+  #endif
+  #if defined(SIMDE_X86_AVX512VPOPCNTDQ_NATIVE)
+    "x86/avx512vpopcntdq",
+  #endif
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    "x86/avx512bf16",
+  #endif
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    "x86/avx512fp16",
+  #endif
+  #if defined(SIMDE_X86_GFNI_NATIVE)
+    "x86/gfni",
+  #endif
+  #if defined(SIMDE_X86_AES_NATIVE)
+    "x86/aes",
+  #endif
+  #if defined(SIMDE_X86_VAES_NATIVE)
+    "x86/vaes",
+  #endif
+  #if defined(SIMDE_X86_PCLMUL_NATIVE)
+    "x86/pclmul",
+  #endif
+  #if defined(SIMDE_X86_VPCLMULQDQ_NATIVE)
+    "x86/vpclmulqdq",
+  #endif
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    "x86/sha",
+  #endif
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    "x86/bmi1",
+  #endif
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    "x86/bmi2",
+  #endif
+  #if defined(SIMDE_X86_SVML_NATIVE)
+    "x86/svml",
+  #endif
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    "arm/neon-a32v7",
+  #endif
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    "arm/neon-a32v8",
+  #endif
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    "arm/neon-a64v8",
+  #endif
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    "arm/sve",
+  #endif
+  #if defined(SIMDE_WASM_SIMD128_NATIVE)
+    "wasm/simd128",
+  #endif
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    "wasm/relaxed-simd",
+  #endif
+  #if defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    "power/altivec-p6",
+  #endif
+  #if defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    "power/altivec-p7",
+  #endif
+  #if defined(SIMDE_POWER_ALTIVEC_P8_NATIVE)
+    "power/altivec-p8",
+  #endif
+  #if defined(SIMDE_POWER_ALTIVEC_P9_NATIVE)
+    "power/altivec-p9",
+  #endif
+  #if defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+    "zarch/zvector-13",
+  #endif
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    "mips/msa",
+  #endif
+  #if defined(SIMDE_LOONGARCH_LSX_NATIVE)
+    "loongarch/lsx",
+  #endif
+  #if defined(SIMDE_LOONGARCH_LASX_NATIVE)
+    "loongarch/lasx",
+  #endif
+  #if defined(SIMDE_RISCV_V_NATIVE)
+    "riscv/v",
+  #endif
+  NULL
+};
+
+#if defined(SIMDE_ARCH_AMD64)
+  #define SIMDE_BENCH_ARCH "x86_64"
+#elif defined(SIMDE_ARCH_X86)
+  #define SIMDE_BENCH_ARCH "x86"
+#elif defined(SIMDE_ARCH_AARCH64)
+  #define SIMDE_BENCH_ARCH "aarch64"
+#elif defined(SIMDE_ARCH_ARM)
+  #define SIMDE_BENCH_ARCH "arm"
+#elif defined(SIMDE_ARCH_POWER)
+  #define SIMDE_BENCH_ARCH "power"
+#elif defined(SIMDE_ARCH_WASM)
+  #define SIMDE_BENCH_ARCH "wasm"
+#elif defined(SIMDE_ARCH_ZARCH)
+  #define SIMDE_BENCH_ARCH "zarch"
+#elif defined(SIMDE_ARCH_MIPS)
+  #define SIMDE_BENCH_ARCH "mips"
+#elif defined(SIMDE_ARCH_LOONGARCH)
+  #define SIMDE_BENCH_ARCH "loongarch"
+#elif defined(SIMDE_ARCH_RISCV64)
+  #define SIMDE_BENCH_ARCH "riscv64"
+#else
+  #define SIMDE_BENCH_ARCH "unknown"
+#endif
+
+#if defined(HEDLEY_GCC_VERSION) && defined(__VERSION__)
+  #define SIMDE_BENCH_COMPILER "GCC " __VERSION__
+#elif defined(__VERSION__)
+  #define SIMDE_BENCH_COMPILER __VERSION__
+#elif defined(_MSC_FULL_VER)
+  #define SIMDE_BENCH_COMPILER "MSVC " HEDLEY_STRINGIFY(_MSC_FULL_VER)
+#else
+  #define SIMDE_BENCH_COMPILER "unknown"
+#endif
+
+static double
+simde_bench_now(void) {
+  #if defined(_WIN32)
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return HEDLEY_STATIC_CAST(double, count.QuadPart) / HEDLEY_STATIC_CAST(double, freq.QuadPart);
+  #elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return HEDLEY_STATIC_CAST(double, ts.tv_sec) + (HEDLEY_STATIC_CAST(double, ts.tv_nsec) * 1e-9);
+  #else
+    return HEDLEY_STATIC_CAST(double, clock()) / HEDLEY_STATIC_CAST(double, CLOCKS_PER_SEC);
+  #endif
+}
+
+/* Inputs are pseudo-random, but always the same sequence so that runs
+ * from different tiers and releases are comparable. */
+static uint64_t simde_bench_rng_state;
+
+static uint64_t
+simde_bench_random(void) {
+  uint64_t x = simde_bench_rng_state;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  simde_bench_rng_state = x;
+  return x * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+static float
+simde_bench_random_f32(float min, float max) {
+  const float unit = HEDLEY_STATIC_CAST(float, simde_bench_random() >> 40) / HEDLEY_STATIC_CAST(float, UINT32_C(1) << 24);
+  return min + ((max - min) * unit);
+}
+
+static void
+simde_bench_fill_floats(size_t buffer, float min, float max) {
+  float* v = HEDLEY_REINTERPRET_CAST(float*, simde_bench_in[buffer]);
+  size_t i;
+  for (i = 0 ; i < SIMDE_BENCH_BUFFER_SIZE / sizeof(float) ; i++)
+    v[i] = simde_bench_random_f32(min, max);
+}
+
+void
+simde_bench_fill_bytes(void) {
+  size_t b, i;
+  simde_bench_rng_state = UINT64_C(0x5EED5EED5EED5EED);
+  for (b = 0 ; b < 3 ; b++) {
+    uint64_t* v = HEDLEY_REINTERPRET_CAST(uint64_t*, simde_bench_in[b]);
+    for (i = 0 ; i < SIMDE_BENCH_BUFFER_SIZE / sizeof(uint64_t) ; i++)
+      v[i] = simde_bench_random();
+  }
+}
+
+void
+simde_bench_fill_f32(void) {
+  size_t b;
+  simde_bench_rng_state = UINT64_C(0x5EED5EED5EED5EED);
+  for (b = 0 ; b < 3 ; b++)
+    simde_bench_fill_floats(b, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+}
+
+void
+simde_bench_fill_f32_small(void) {
+  size_t b;
+  simde_bench_rng_state = UINT64_C(0x5EED5EED5EED5EED);
+  for (b = 0 ; b < 3 ; b++)
+    simde_bench_fill_floats(b, SIMDE_FLOAT32_C(-4.0), SIMDE_FLOAT32_C(4.0));
+}
+
+/* The first input is denormal and the second in [0.5, 1), so both the
+ * inputs and the product of the two are denormal. */
+void
+simde_bench_fill_f32_denormal(void) {
+  uint32_t* v = HEDLEY_REINTERPRET_CAST(uint32_t*, simde_bench_in[0]);
+  size_t i;
+
+  simde_bench_rng_state = UINT64_C(0x5EED5EED5EED5EED);
+  for (i = 0 ; i < SIMDE_BENCH_BUFFER_SIZE / sizeof(uint32_t) ; i++)
+    v[i] = HEDLEY_STATIC_CAST(uint32_t, simde_bench_random() & UINT64_C(0x807FFFFF)) | UINT32_C(1);
+  simde_bench_fill_floats(1, SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(1.0));
+  simde_bench_fill_floats(2, SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(1.0));
+}
+
+void
+simde_bench_fill_f64(void) {
+  size_t b, i;
+  simde_bench_rng_state = UINT64_C(0x5EED5EED5EED5EED);
+  for (b = 0 ; b < 3 ; b++) {
+    double* v = HEDLEY_REINTERPRET_CAST(double*, simde_bench_in[b]);
+    for (i = 0 ; i < SIMDE_BENCH_BUFFER_SIZE / sizeof(double) ; i++)
+      v[i] = HEDLEY_STATIC_CAST(double, simde_bench_random_f32(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0)));
+  }
+}
+
+static void*
+simde_bench_alloc(size_t size) {
+  /* The allocation is leaked; buffers live for the whole run. */
+  const uintptr_t p = HEDLEY_REINTERPRET_CAST(uintptr_t, calloc(1, size + 63));
+  if (p == 0) {
+    fputs("simde-benchmark: out of memory\n", stderr);
+    exit(EXIT_FAILURE);
+  }
+  return HEDLEY_REINTERPRET_CAST(void*, (p + 63) & ~HEDLEY_STATIC_CAST(uintptr_t, 63));
+}
+
+typedef struct {
+  double min;
+  double median;
+} SimdeBenchResult;
+
+static int
+simde_bench_compare_double(const void* a, const void* b) {
+  const double x = *HEDLEY_REINTERPRET_CAST(const double*, a);
+  const double y = *HEDLEY_REINTERPRET_CAST(const double*, b);
+  return (x > y) - (x < y);
+}
+
+#define SIMDE_BENCH_MAX_SAMPLES 64
+
+/* Grow the repetition count until one run takes at least
+ * min_time / samples seconds, then time `samples` runs and report
+ * nanoseconds per call. */
+static SimdeBenchResult
+simde_bench_measure(SimdeBenchFunc func, double min_time, size_t samples) {
+  double times[SIMDE_BENCH_MAX_SAMPLES];
+  const double target = min_time / HEDLEY_STATIC_CAST(double, samples);
+  SimdeBenchResult result;
+  size_t reps = 1, calls, i;
+  double elapsed;
+
+  for (;;) {
+    const double start = simde_bench_now();
+    func(reps);
+    elapsed = simde_bench_now() - start;
+    if (elapsed >= target || reps >= (SIZE_MAX / 4))
+      break;
+    if (elapsed * 8.0 < target)
+      reps *= 4;
+    else
+      reps *= 2;
+  }
+
+  for (i = 0 ; i < samples ; i++) {
+    const double start = simde_bench_now();
+    calls = func(reps);
+    elapsed = simde_bench_now() - start;
+    times[i] = (elapsed * 1e9) / HEDLEY_STATIC_CAST(double, calls);
+  }
+
+  qsort(times, samples, sizeof(times[0]), simde_bench_compare_double);
+  result.min = times[0];
+  result.median = (samples % 2) ? times[samples / 2] : ((times[(samples / 2) - 1] + times[samples / 2]) / 2.0);
+  return result;
+}
+
+static void
+simde_bench_json_string(FILE* fp, const char* str) {
+  fputc('"', fp);
+  for ( ; *str != '\0' ; str++) {
+    if (*str == '"' || *str == '\\')
+      fprintf(fp, "\\%c", *str);
+    else if (HEDLEY_STATIC_CAST(unsigned char, *str) < 0x20)
+      fprintf(fp, "\\u%04x", HEDLEY_STATIC_CAST(unsigned int, HEDLEY_STATIC_CAST(unsigned char, *str)));
+    else
+      fputc(*str, fp);
+  }
+  fputc('"', fp);
+}
+
+static int
+simde_bench_matches(const char* suite, const char* name, const char* filter) {
+  char full[256];
+  if (filter == NULL)
+    return 1;
+  snprintf(full, sizeof(full), "%s/%s", suite, name);
+  return strstr(full, filter) != NULL;
+}
+
+static void
+simde_bench_usage(FILE* fp, const char* argv0) {
+  fprintf(fp,
+    "USAGE: %s [OPTIONS...]\n\n"
+    "  --filter SUBSTRING  only run benchmarks whose suite/name contains SUBSTRING\n"
+    "  --min-time SECONDS  minimum time spent measuring each benchmark (default 0.1)\n"
+    "  --samples N         number of timed runs per benchmark (default 5)\n"
+    "  --output FILE       write the JSON report to FILE instead of stdout\n"
+    "  --no-latency        skip the latency benchmarks\n"
+    "  --list              list the benchmarks and exit\n"
+    "  --help              print this message and exit\n",
+    argv0);
+}
+
+int main(int argc, char* argv[HEDLEY_ARRAY_PARAM(argc + 1)]) {
+  const SimdeBenchSuite* suites[] = {
+    #define SIMDE_BENCH_DECLARE_SUITE(name) HEDLEY_CONCAT3(simde_bench_, name, _get_suite)(),
+    #include "declare-suites.h"
+    #undef SIMDE_BENCH_DECLARE_SUITE
+    NULL
+  };
+  const char* filter = NULL;
+  const char* output = NULL;
+  double min_time = 0.1;
+  size_t samples = 5;
+  int list = 0, latency = 1, first = 1;
+  size_t s, b, i;
+  FILE* fp = stdout;
+
+  for (i = 1 ; i < HEDLEY_STATIC_CAST(size_t, argc) ; i++) {
+    const int has_value = (i + 1) < HEDLEY_STATIC_CAST(size_t, argc);
+    if (strcmp(argv[i], "--filter") == 0 && has_value) {
+      filter = argv[++i];
+    } else if (strcmp(argv[i], "--min-time") == 0 && has_value) {
+      min_time = strtod(argv[++i], NULL);
+    } else if (strcmp(argv[i], "--samples") == 0 && has_value) {
+      samples = HEDLEY_STATIC_CAST(size_t, strtoul(argv[++i], NULL, 10));
+    } else if (strcmp(argv[i], "--output") == 0 && has_value) {
+      output = argv[++i];
+    } else if (strcmp(argv[i], "--no-latency") == 0) {
+      latency = 0;
+    } else if (strcmp(argv[i], "--list") == 0) {
+      list = 1;
+    } else if (strcmp(argv[i], "--help") == 0) {
+      simde_bench_usage(stdout, argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      fprintf(stderr, "%s: unrecognized argument '%s'\n", argv[0], argv[i]);
+      simde_bench_usage(stderr, argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (samples < 1 || samples > SIMDE_BENCH_MAX_SAMPLES || !(min_time > 0.0)) {
+    fprintf(stderr, "%s: --samples must be in [1, %d] and --min-time positive\n", argv[0], SIMDE_BENCH_MAX_SAMPLES);
+    return EXIT_FAILURE;
+  }
+
+  if (list) {
+    for (s = 0 ; suites[s] != NULL ; s++) {
+      for (b = 0 ; suites[s]->benchmarks[b].name != NULL ; b++) {
+        if (simde_bench_matches(suites[s]->name, suites[s]->benchmarks[b].name, filter))
+          printf("%s/%s\n", suites[s]->name, suites[s]->benchmarks[b].name);
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  for (i = 0 ; i < 3 ; i++)
+    simde_bench_in[i] = simde_bench_alloc(SIMDE_BENCH_BUFFER_SIZE);
+  simde_bench_out = simde_bench_alloc(SIMDE_BENCH_OUTPUT_SIZE);
+  simde_bench_zeros = simde_bench_alloc(SIMDE_BENCH_BUFFER_SIZE);
+
+  if (output != NULL) {
+    fp = fopen(output, "w");
+    if (fp == NULL) {
+      fprintf(stderr, "%s: unable to open '%s' for writing\n", argv[0], output);
+      return EXIT_FAILURE;
+    }
+  }
+
+  fprintf(fp, "{\n  \"simde_version\": \"%d.%d.%d\",\n", SIMDE_VERSION_MAJOR, SIMDE_VERSION_MINOR, SIMDE_VERSION_MICRO);
+  fputs("  \"tier\": ", fp);
+  simde_bench_json_string(fp, SIMDE_BENCH_TIER);
+  fputs(",\n  \"arch\": ", fp);
+  simde_bench_json_string(fp, SIMDE_BENCH_ARCH);
+  fputs(",\n  \"compiler\": ", fp);
+  simde_bench_json_string(fp, SIMDE_BENCH_COMPILER);
+  fputs(",\n  \"native\": [", fp);
+  for (i = 0 ; simde_bench_native_features[i] != NULL ; i++) {
+    fputs((i == 0) ? "" : ", ", fp);
+    simde_bench_json_string(fp, simde_bench_native_features[i]);
+  }
+  fprintf(fp, "],\n  \"min_time\": %g,\n  \"samples\": %u,\n  \"unit\": \"ns/call\",\n  \"benchmarks\": [",
+    min_time, HEDLEY_STATIC_CAST(unsigned int, samples));
+
+  for (s = 0 ; suites[s] != NULL ; s++) {
+    for (b = 0 ; suites[s]->benchmarks[b].name != NULL ; b++) {
+      const SimdeBenchmark* bench = &(suites[s]->benchmarks[b]);
+      SimdeBenchResult tp, lat = { 0.0, 0.0 };
+
+      if (!simde_bench_matches(suites[s]->name, bench->name, filter))
+        continue;
+
+      bench->setup();
+      tp = simde_bench_measure(bench->throughput, min_time, samples);
+      if (latency && bench->latency != NULL) {
+        bench->setup();
+        lat = simde_bench_measure(bench->latency, min_time, samples);
+      }
+
+      fputs(first ? "\n    {" : ",\n    {", fp);
+      first = 0;
+      fputs("\"suite\": ", fp);
+      simde_bench_json_string(fp, suites[s]->name);
+      fputs(", \"name\": ", fp);
+      simde_bench_json_string(fp, bench->name);
+      fprintf(fp, ", \"throughput\": {\"min\": %.4f, \"median\": %.4f}", tp.min, tp.median);
+      if (latency && bench->latency != NULL)
+        fprintf(fp, ", \"latency\": {\"min\": %.4f, \"median\": %.4f}}", lat.min, lat.median);
+      else
+        fputs(", \"latency\": null}", fp);
+      fflush(fp);
+
+      if (output != NULL) {
+        fprintf(stderr, "%-12s %-40s %10.3f ns", suites[s]->name, bench->name, tp.median);
+        if (latency && bench->latency != NULL)
+          fprintf(stderr, " %10.3f ns", lat.median);
+        fputc('\n', stderr);
+      }
+    }
+  }
+
+  fputs("\n  ]\n}\n", fp);
+
+  if (output != NULL)
+    fclose(fp);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,14 @@
+#include "../bench.h"
+#include "../../simde/x86/aes.h"
+
+SIMDE_BENCH_DEFINE(mm_aesenc_si128, simde__m128i, simde_mm_aesenc_si128(a, b))
+SIMDE_BENCH_DEFINE(mm_aesenclast_si128, simde__m128i, simde_mm_aesenclast_si128(a, b))
+SIMDE_BENCH_DEFINE(mm_aesdec_si128, simde__m128i, simde_mm_aesdec_si128(a, b))
+SIMDE_BENCH_DEFINE(mm_aesimc_si128, simde__m128i, simde_mm_aesimc_si128(a))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_aes)
+  SIMDE_BENCH_ENTRY(mm_aesenc_si128, bytes)
+  SIMDE_BENCH_ENTRY(mm_aesenclast_si128, bytes)
+  SIMDE_BENCH_ENTRY(mm_aesdec_si128, bytes)
+  SIMDE_BENCH_ENTRY(mm_aesimc_si128, bytes)
+SIMDE_BENCH_END_SUITE(x86_aes, "x86/aes")
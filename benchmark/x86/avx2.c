@@ -0,0 +1,48 @@
+#include "../bench.h"
+#include "../../simde/x86/avx2.h"
+#include "../../simde/x86/fma.h"
+
+SIMDE_BENCH_DEFINE(mm256_add_ps, simde__m256, simde_mm256_add_ps(a, b))
+SIMDE_BENCH_DEFINE(mm256_mul_pd, simde__m256d, simde_mm256_mul_pd(a, b))
+SIMDE_BENCH_DEFINE(mm256_fmadd_ps, simde__m256, simde_mm256_fmadd_ps(a, b, c))
+SIMDE_BENCH_DEFINE(mm256_fmadd_pd, simde__m256d, simde_mm256_fmadd_pd(a, b, c))
+SIMDE_BENCH_DEFINE(mm256_dp_ps, simde__m256, simde_mm256_dp_ps(a, b, 0xff))
+SIMDE_BENCH_DEFINE(mm256_blendv_ps, simde__m256, simde_mm256_blendv_ps(a, b, c))
+SIMDE_BENCH_DEFINE(mm256_permutevar_ps, simde__m256, simde_mm256_permutevar_ps(a, simde_mm256_castps_si256(b)))
+SIMDE_BENCH_DEFINE(mm256_add_epi16, simde__m256i, simde_mm256_add_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm256_mullo_epi32, simde__m256i, simde_mm256_mullo_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm256_madd_epi16, simde__m256i, simde_mm256_madd_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm256_maddubs_epi16, simde__m256i, simde_mm256_maddubs_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm256_sad_epu8, simde__m256i, simde_mm256_sad_epu8(a, b))
+SIMDE_BENCH_DEFINE(mm256_shuffle_epi8, simde__m256i, simde_mm256_shuffle_epi8(a, b))
+SIMDE_BENCH_DEFINE(mm256_permutevar8x32_epi32, simde__m256i, simde_mm256_permutevar8x32_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm256_sllv_epi32, simde__m256i, simde_mm256_sllv_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm256_packus_epi16, simde__m256i, simde_mm256_packus_epi16(a, b))
+SIMDE_BENCH_DEFINE_TP(mm256_movemask_epi8, simde__m256i, int, simde_mm256_movemask_epi8(a))
+/* Indices are masked to stay inside the third input buffer. */
+SIMDE_BENCH_DEFINE(mm256_mask_i32gather_epi32, simde__m256i,
+  simde_mm256_mask_i32gather_epi32(a,
+    HEDLEY_REINTERPRET_CAST(const int32_t*, simde_bench_in[2]),
+    simde_mm256_and_si256(b, simde_mm256_set1_epi32((SIMDE_BENCH_BUFFER_SIZE / 4) - 1)),
+    c, 4))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_avx2)
+  SIMDE_BENCH_ENTRY(mm256_add_ps, f32)
+  SIMDE_BENCH_ENTRY(mm256_mul_pd, f64)
+  SIMDE_BENCH_ENTRY(mm256_fmadd_ps, f32)
+  SIMDE_BENCH_ENTRY(mm256_fmadd_pd, f64)
+  SIMDE_BENCH_ENTRY(mm256_dp_ps, f32)
+  SIMDE_BENCH_ENTRY(mm256_blendv_ps, f32)
+  SIMDE_BENCH_ENTRY(mm256_permutevar_ps, bytes)
+  SIMDE_BENCH_ENTRY(mm256_add_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm256_mullo_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm256_madd_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm256_maddubs_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm256_sad_epu8, bytes)
+  SIMDE_BENCH_ENTRY(mm256_shuffle_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm256_permutevar8x32_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm256_sllv_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm256_packus_epi16, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm256_movemask_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm256_mask_i32gather_epi32, bytes)
+SIMDE_BENCH_END_SUITE(x86_avx2, "x86/avx2")
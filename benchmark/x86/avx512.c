@@ -0,0 +1,46 @@
+#include "../bench.h"
+#include "../../simde/x86/avx512.h"
+
+SIMDE_BENCH_DEFINE(mm512_add_ps, simde__m512, simde_mm512_add_ps(a, b))
+SIMDE_BENCH_DEFINE(mm512_fmadd_ps, simde__m512, simde_mm512_fmadd_ps(a, b, c))
+SIMDE_BENCH_DEFINE(mm512_fmadd_pd, simde__m512d, simde_mm512_fmadd_pd(a, b, c))
+SIMDE_BENCH_DEFINE(mm512_range_ps, simde__m512, simde_mm512_range_ps(a, b, 0x05))
+SIMDE_BENCH_DEFINE_TP(mm512_cmp_ps_mask, simde__m512, simde__mmask16, simde_mm512_cmp_ps_mask(a, b, SIMDE_CMP_LT_OQ))
+SIMDE_BENCH_DEFINE(mm512_add_epi8, simde__m512i, simde_mm512_add_epi8(a, b))
+SIMDE_BENCH_DEFINE(mm512_mullo_epi64, simde__m512i, simde_mm512_mullo_epi64(a, b))
+SIMDE_BENCH_DEFINE(mm512_madd_epi16, simde__m512i, simde_mm512_madd_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm512_dpbusd_epi32, simde__m512i, simde_mm512_dpbusd_epi32(a, b, c))
+SIMDE_BENCH_DEFINE(mm512_dpwssd_epi32, simde__m512i, simde_mm512_dpwssd_epi32(a, b, c))
+SIMDE_BENCH_DEFINE(mm512_ternarylogic_epi32, simde__m512i, simde_mm512_ternarylogic_epi32(a, b, c, 0x96))
+SIMDE_BENCH_DEFINE(mm512_sllv_epi16, simde__m512i, simde_mm512_sllv_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm512_popcnt_epi8, simde__m512i, simde_mm512_popcnt_epi8(a))
+SIMDE_BENCH_DEFINE(mm512_conflict_epi32, simde__m512i, simde_mm512_conflict_epi32(a))
+SIMDE_BENCH_DEFINE(mm512_maskz_compress_epi32, simde__m512i, simde_mm512_maskz_compress_epi32(simde_mm512_movepi32_mask(b), a))
+SIMDE_BENCH_DEFINE(mm512_permutexvar_epi8, simde__m512i, simde_mm512_permutexvar_epi8(b, a))
+SIMDE_BENCH_DEFINE(mm512_permutex2var_epi8, simde__m512i, simde_mm512_permutex2var_epi8(a, b, c))
+SIMDE_BENCH_DEFINE(mm512_multishift_epi64_epi8, simde__m512i, simde_mm512_multishift_epi64_epi8(b, a))
+SIMDE_BENCH_DEFINE_TP(mm512_bitshuffle_epi64_mask, simde__m512i, simde__mmask64, simde_mm512_bitshuffle_epi64_mask(a, b))
+SIMDE_BENCH_DEFINE_TP(mm512_movepi8_mask, simde__m512i, simde__mmask64, simde_mm512_movepi8_mask(a))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_avx512)
+  SIMDE_BENCH_ENTRY(mm512_add_ps, f32)
+  SIMDE_BENCH_ENTRY(mm512_fmadd_ps, f32)
+  SIMDE_BENCH_ENTRY(mm512_fmadd_pd, f64)
+  SIMDE_BENCH_ENTRY(mm512_range_ps, f32)
+  SIMDE_BENCH_ENTRY_TP(mm512_cmp_ps_mask, f32)
+  SIMDE_BENCH_ENTRY(mm512_add_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm512_mullo_epi64, bytes)
+  SIMDE_BENCH_ENTRY(mm512_madd_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm512_dpbusd_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm512_dpwssd_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm512_ternarylogic_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm512_sllv_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm512_popcnt_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm512_conflict_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm512_maskz_compress_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm512_permutexvar_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm512_permutex2var_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm512_multishift_epi64_epi8, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm512_bitshuffle_epi64_mask, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm512_movepi8_mask, bytes)
+SIMDE_BENCH_END_SUITE(x86_avx512, "x86/avx512")
@@ -0,0 +1,14 @@
+#include "../bench.h"
+#include "../../simde/x86/bmi2.h"
+
+SIMDE_BENCH_DEFINE(pext_u64, uint64_t, simde_pext_u64(a, b))
+SIMDE_BENCH_DEFINE(pdep_u64, uint64_t, simde_pdep_u64(a, b))
+SIMDE_BENCH_DEFINE(pext_u32, uint32_t, simde_pext_u32(a, b))
+SIMDE_BENCH_DEFINE(bzhi_u64, uint64_t, simde_bzhi_u64(a, HEDLEY_STATIC_CAST(uint32_t, b & 63)))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_bmi2)
+  SIMDE_BENCH_ENTRY(pext_u64, bytes)
+  SIMDE_BENCH_ENTRY(pdep_u64, bytes)
+  SIMDE_BENCH_ENTRY(pext_u32, bytes)
+  SIMDE_BENCH_ENTRY(bzhi_u64, bytes)
+SIMDE_BENCH_END_SUITE(x86_bmi2, "x86/bmi2")
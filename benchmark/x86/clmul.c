@@ -0,0 +1,13 @@
+#include "../bench.h"
+#include "../../simde/x86/clmul.h"
+#include "../../simde/x86/avx512.h"
+
+SIMDE_BENCH_DEFINE(mm_clmulepi64_si128, simde__m128i, simde_mm_clmulepi64_si128(a, b, 0x01))
+SIMDE_BENCH_DEFINE(mm256_clmulepi64_epi128, simde__m256i, simde_mm256_clmulepi64_epi128(a, b, 0x01))
+SIMDE_BENCH_DEFINE(mm512_clmulepi64_epi128, simde__m512i, simde_mm512_clmulepi64_epi128(a, b, 0x01))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_clmul)
+  SIMDE_BENCH_ENTRY(mm_clmulepi64_si128, bytes)
+  SIMDE_BENCH_ENTRY(mm256_clmulepi64_epi128, bytes)
+  SIMDE_BENCH_ENTRY(mm512_clmulepi64_epi128, bytes)
+SIMDE_BENCH_END_SUITE(x86_clmul, "x86/clmul")
@@ -0,0 +1,14 @@
+#include "../bench.h"
+#include "../../simde/x86/f16c.h"
+
+SIMDE_BENCH_DEFINE_TP(mm_cvtph_ps, simde__m128i, simde__m128, simde_mm_cvtph_ps(a))
+SIMDE_BENCH_DEFINE_TP(mm_cvtps_ph, simde__m128, simde__m128i, simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT))
+SIMDE_BENCH_DEFINE_TP(mm256_cvtph_ps, simde__m128i, simde__m256, simde_mm256_cvtph_ps(a))
+SIMDE_BENCH_DEFINE_TP(mm256_cvtps_ph, simde__m256, simde__m128i, simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_f16c)
+  SIMDE_BENCH_ENTRY_TP(mm_cvtph_ps, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm_cvtps_ph, f32)
+  SIMDE_BENCH_ENTRY_TP(mm256_cvtph_ps, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm256_cvtps_ph, f32)
+SIMDE_BENCH_END_SUITE(x86_f16c, "x86/f16c")
@@ -0,0 +1,18 @@
+#include "../bench.h"
+#include "../../simde/x86/gfni.h"
+
+SIMDE_BENCH_DEFINE(mm_gf2p8mul_epi8, simde__m128i, simde_mm_gf2p8mul_epi8(a, b))
+SIMDE_BENCH_DEFINE(mm_gf2p8affine_epi64_epi8, simde__m128i, simde_mm_gf2p8affine_epi64_epi8(a, b, 0x63))
+SIMDE_BENCH_DEFINE(mm_gf2p8affineinv_epi64_epi8, simde__m128i, simde_mm_gf2p8affineinv_epi64_epi8(a, b, 0x63))
+SIMDE_BENCH_DEFINE(mm256_gf2p8affineinv_epi64_epi8, simde__m256i, simde_mm256_gf2p8affineinv_epi64_epi8(a, b, 0x63))
+SIMDE_BENCH_DEFINE(mm512_gf2p8mul_epi8, simde__m512i, simde_mm512_gf2p8mul_epi8(a, b))
+SIMDE_BENCH_DEFINE(mm512_gf2p8affineinv_epi64_epi8, simde__m512i, simde_mm512_gf2p8affineinv_epi64_epi8(a, b, 0x63))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_gfni)
+  SIMDE_BENCH_ENTRY(mm_gf2p8mul_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_gf2p8affine_epi64_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_gf2p8affineinv_epi64_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm256_gf2p8affineinv_epi64_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm512_gf2p8mul_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm512_gf2p8affineinv_epi64_epi8, bytes)
+SIMDE_BENCH_END_SUITE(x86_gfni, "x86/gfni")
@@ -0,0 +1,16 @@
+#include "../bench.h"
+#include "../../simde/x86/sha.h"
+
+SIMDE_BENCH_DEFINE(mm_sha1rnds4_epu32, simde__m128i, simde_mm_sha1rnds4_epu32(a, b, 2))
+SIMDE_BENCH_DEFINE(mm_sha1msg1_epu32, simde__m128i, simde_mm_sha1msg1_epu32(a, b))
+SIMDE_BENCH_DEFINE(mm_sha256rnds2_epu32, simde__m128i, simde_mm_sha256rnds2_epu32(a, b, c))
+SIMDE_BENCH_DEFINE(mm_sha256msg1_epu32, simde__m128i, simde_mm_sha256msg1_epu32(a, b))
+SIMDE_BENCH_DEFINE(mm_sha256msg2_epu32, simde__m128i, simde_mm_sha256msg2_epu32(a, b))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_sha)
+  SIMDE_BENCH_ENTRY(mm_sha1rnds4_epu32, bytes)
+  SIMDE_BENCH_ENTRY(mm_sha1msg1_epu32, bytes)
+  SIMDE_BENCH_ENTRY(mm_sha256rnds2_epu32, bytes)
+  SIMDE_BENCH_ENTRY(mm_sha256msg1_epu32, bytes)
+  SIMDE_BENCH_ENTRY(mm_sha256msg2_epu32, bytes)
+SIMDE_BENCH_END_SUITE(x86_sha, "x86/sha")
@@ -0,0 +1,67 @@
+#include "../bench.h"
+#include "../../simde/x86/sse.h"
+
+SIMDE_BENCH_DEFINE(mm_add_ps, simde__m128, simde_mm_add_ps(a, b))
+SIMDE_BENCH_DEFINE(mm_mul_ps, simde__m128, simde_mm_mul_ps(a, b))
+SIMDE_BENCH_DEFINE(mm_div_ps, simde__m128, simde_mm_div_ps(a, b))
+SIMDE_BENCH_DEFINE(mm_sqrt_ps, simde__m128, simde_mm_sqrt_ps(a))
+SIMDE_BENCH_DEFINE(mm_rcp_ps, simde__m128, simde_mm_rcp_ps(a))
+SIMDE_BENCH_DEFINE(mm_rsqrt_ps, simde__m128, simde_mm_rsqrt_ps(a))
+SIMDE_BENCH_DEFINE(mm_max_ps, simde__m128, simde_mm_max_ps(a, b))
+SIMDE_BENCH_DEFINE(mm_cmplt_ps, simde__m128, simde_mm_cmplt_ps(a, b))
+SIMDE_BENCH_DEFINE(mm_shuffle_ps, simde__m128, simde_mm_shuffle_ps(a, b, SIMDE_MM_SHUFFLE(1, 3, 0, 2)))
+SIMDE_BENCH_DEFINE(mm_unpacklo_ps, simde__m128, simde_mm_unpacklo_ps(a, b))
+SIMDE_BENCH_DEFINE_TP(mm_movemask_ps, simde__m128, int, simde_mm_movemask_ps(a))
+
+/* simde_mm_mul_ps on denormal inputs producing denormal results, with
+ * the flush-to-zero and denormals-are-zero modes off and then on.
+ * Many cores take a microcode assist for every denormal unless the
+ * modes are enabled, so the gap between the two is what setting
+ * SIMDE_MM_SET_FLUSH_ZERO_MODE buys on the current target. */
+static size_t
+simde_bench_mul_ps_denormal(size_t reps, int flush) {
+  const simde__m128* va = HEDLEY_REINTERPRET_CAST(const simde__m128*, simde_bench_in[0]);
+  const simde__m128* vb = HEDLEY_REINTERPRET_CAST(const simde__m128*, simde_bench_in[1]);
+  simde__m128* vr = HEDLEY_REINTERPRET_CAST(simde__m128*, simde_bench_out);
+  const size_t n = SIMDE_BENCH_BUFFER_SIZE / sizeof(simde__m128);
+  const uint32_t csr = simde_mm_getcsr();
+  const uint32_t modes = SIMDE_MM_FLUSH_ZERO_ON | SIMDE_MM_DENORMALS_ZERO_ON;
+  size_t r, i;
+
+  simde_mm_setcsr(flush ? (csr | modes) : (csr & ~modes));
+  for (r = 0 ; r < reps ; r++) {
+    for (i = 0 ; i < n ; i++) {
+      vr[i] = simde_mm_mul_ps(va[i], vb[i]);
+    }
+    SIMDE_BENCH_CLOBBER();
+  }
+  simde_mm_setcsr(csr);
+
+  return reps * n;
+}
+
+static size_t
+simde_bench_tp_mm_mul_ps_denormal(size_t reps) {
+  return simde_bench_mul_ps_denormal(reps, 0);
+}
+
+static size_t
+simde_bench_tp_mm_mul_ps_denormal_ftz(size_t reps) {
+  return simde_bench_mul_ps_denormal(reps, 1);
+}
+
+SIMDE_BENCH_BEGIN_SUITE(x86_sse)
+  SIMDE_BENCH_ENTRY(mm_add_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_mul_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_div_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_sqrt_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_rcp_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_rsqrt_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_max_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_cmplt_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_shuffle_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_unpacklo_ps, f32)
+  SIMDE_BENCH_ENTRY_TP(mm_movemask_ps, f32)
+  SIMDE_BENCH_ENTRY_CUSTOM(mm_mul_ps_denormal, simde_bench_tp_mm_mul_ps_denormal, NULL, f32_denormal)
+  SIMDE_BENCH_ENTRY_CUSTOM(mm_mul_ps_denormal_ftz, simde_bench_tp_mm_mul_ps_denormal_ftz, NULL, f32_denormal)
+SIMDE_BENCH_END_SUITE(x86_sse, "x86/sse")
@@ -0,0 +1,50 @@
+#include "../bench.h"
+#include "../../simde/x86/sse2.h"
+
+SIMDE_BENCH_DEFINE(mm_add_epi32, simde__m128i, simde_mm_add_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm_adds_epu8, simde__m128i, simde_mm_adds_epu8(a, b))
+SIMDE_BENCH_DEFINE(mm_mullo_epi16, simde__m128i, simde_mm_mullo_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm_mul_epu32, simde__m128i, simde_mm_mul_epu32(a, b))
+SIMDE_BENCH_DEFINE(mm_madd_epi16, simde__m128i, simde_mm_madd_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm_sad_epu8, simde__m128i, simde_mm_sad_epu8(a, b))
+SIMDE_BENCH_DEFINE(mm_avg_epu8, simde__m128i, simde_mm_avg_epu8(a, b))
+SIMDE_BENCH_DEFINE(mm_packs_epi32, simde__m128i, simde_mm_packs_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm_packus_epi16, simde__m128i, simde_mm_packus_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm_cmpgt_epi8, simde__m128i, simde_mm_cmpgt_epi8(a, b))
+SIMDE_BENCH_DEFINE(mm_slli_epi32, simde__m128i, simde_mm_slli_epi32(a, 7))
+SIMDE_BENCH_DEFINE(mm_srai_epi16, simde__m128i, simde_mm_srai_epi16(a, 3))
+SIMDE_BENCH_DEFINE(mm_shuffle_epi32, simde__m128i, simde_mm_shuffle_epi32(a, SIMDE_MM_SHUFFLE(0, 1, 2, 3)))
+SIMDE_BENCH_DEFINE(mm_unpacklo_epi8, simde__m128i, simde_mm_unpacklo_epi8(a, b))
+SIMDE_BENCH_DEFINE_TP(mm_movemask_epi8, simde__m128i, int, simde_mm_movemask_epi8(a))
+SIMDE_BENCH_DEFINE(mm_add_pd, simde__m128d, simde_mm_add_pd(a, b))
+SIMDE_BENCH_DEFINE(mm_mul_pd, simde__m128d, simde_mm_mul_pd(a, b))
+SIMDE_BENCH_DEFINE(mm_div_pd, simde__m128d, simde_mm_div_pd(a, b))
+SIMDE_BENCH_DEFINE(mm_sqrt_pd, simde__m128d, simde_mm_sqrt_pd(a))
+SIMDE_BENCH_DEFINE_TP(mm_cvtps_epi32, simde__m128, simde__m128i, simde_mm_cvtps_epi32(a))
+SIMDE_BENCH_DEFINE_TP(mm_cvttps_epi32, simde__m128, simde__m128i, simde_mm_cvttps_epi32(a))
+SIMDE_BENCH_DEFINE_TP(mm_cvtepi32_ps, simde__m128i, simde__m128, simde_mm_cvtepi32_ps(a))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_sse2)
+  SIMDE_BENCH_ENTRY(mm_add_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_adds_epu8, bytes)
+  SIMDE_BENCH_ENTRY(mm_mullo_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_mul_epu32, bytes)
+  SIMDE_BENCH_ENTRY(mm_madd_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_sad_epu8, bytes)
+  SIMDE_BENCH_ENTRY(mm_avg_epu8, bytes)
+  SIMDE_BENCH_ENTRY(mm_packs_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_packus_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_cmpgt_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_slli_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_srai_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_shuffle_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_unpacklo_epi8, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm_movemask_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_add_pd, f64)
+  SIMDE_BENCH_ENTRY(mm_mul_pd, f64)
+  SIMDE_BENCH_ENTRY(mm_div_pd, f64)
+  SIMDE_BENCH_ENTRY(mm_sqrt_pd, f64)
+  SIMDE_BENCH_ENTRY_TP(mm_cvtps_epi32, f32)
+  SIMDE_BENCH_ENTRY_TP(mm_cvttps_epi32, f32)
+  SIMDE_BENCH_ENTRY_TP(mm_cvtepi32_ps, bytes)
+SIMDE_BENCH_END_SUITE(x86_sse2, "x86/sse2")
@@ -0,0 +1,30 @@
+#include "../bench.h"
+#include "../../simde/x86/sse4.1.h"
+
+SIMDE_BENCH_DEFINE(mm_blendv_epi8, simde__m128i, simde_mm_blendv_epi8(a, b, c))
+SIMDE_BENCH_DEFINE(mm_blendv_ps, simde__m128, simde_mm_blendv_ps(a, b, c))
+SIMDE_BENCH_DEFINE(mm_mullo_epi32, simde__m128i, simde_mm_mullo_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm_max_epi32, simde__m128i, simde_mm_max_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm_packus_epi32, simde__m128i, simde_mm_packus_epi32(a, b))
+SIMDE_BENCH_DEFINE(mm_cvtepu8_epi16, simde__m128i, simde_mm_cvtepu8_epi16(a))
+SIMDE_BENCH_DEFINE(mm_minpos_epu16, simde__m128i, simde_mm_minpos_epu16(a))
+SIMDE_BENCH_DEFINE(mm_dp_ps, simde__m128, simde_mm_dp_ps(a, b, 0xff))
+SIMDE_BENCH_DEFINE(mm_dp_pd, simde__m128d, simde_mm_dp_pd(a, b, 0x33))
+SIMDE_BENCH_DEFINE(mm_round_ps, simde__m128, simde_mm_round_ps(a, SIMDE_MM_FROUND_TO_NEAREST_INT))
+SIMDE_BENCH_DEFINE(mm_floor_pd, simde__m128d, simde_mm_floor_pd(a))
+SIMDE_BENCH_DEFINE_TP(mm_testz_si128, simde__m128i, int, simde_mm_testz_si128(a, b))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_sse4_1)
+  SIMDE_BENCH_ENTRY(mm_blendv_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_blendv_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_mullo_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_max_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_packus_epi32, bytes)
+  SIMDE_BENCH_ENTRY(mm_cvtepu8_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_minpos_epu16, bytes)
+  SIMDE_BENCH_ENTRY(mm_dp_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_dp_pd, f64)
+  SIMDE_BENCH_ENTRY(mm_round_ps, f32)
+  SIMDE_BENCH_ENTRY(mm_floor_pd, f64)
+  SIMDE_BENCH_ENTRY_TP(mm_testz_si128, bytes)
+SIMDE_BENCH_END_SUITE(x86_sse4_1, "x86/sse4.1")
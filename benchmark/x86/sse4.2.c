@@ -0,0 +1,20 @@
+#include "../bench.h"
+#include "../../simde/x86/sse4.2.h"
+
+SIMDE_BENCH_DEFINE(mm_cmpgt_epi64, simde__m128i, simde_mm_cmpgt_epi64(a, b))
+SIMDE_BENCH_DEFINE_TP(mm_cmpistri, simde__m128i, int,
+  simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT))
+SIMDE_BENCH_DEFINE(mm_cmpistrm, simde__m128i,
+  simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_UNIT_MASK))
+SIMDE_BENCH_DEFINE(mm_crc32_u64, uint64_t, simde_mm_crc32_u64(a, b))
+SIMDE_BENCH_DEFINE(mm_crc32_u32, uint32_t, simde_mm_crc32_u32(a, b))
+SIMDE_BENCH_DEFINE(mm_crc32_u8, uint32_t, simde_mm_crc32_u8(a, HEDLEY_STATIC_CAST(uint8_t, b)))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_sse4_2)
+  SIMDE_BENCH_ENTRY(mm_cmpgt_epi64, bytes)
+  SIMDE_BENCH_ENTRY_TP(mm_cmpistri, bytes)
+  SIMDE_BENCH_ENTRY(mm_cmpistrm, bytes)
+  SIMDE_BENCH_ENTRY(mm_crc32_u64, bytes)
+  SIMDE_BENCH_ENTRY(mm_crc32_u32, bytes)
+  SIMDE_BENCH_ENTRY(mm_crc32_u8, bytes)
+SIMDE_BENCH_END_SUITE(x86_sse4_2, "x86/sse4.2")
@@ -0,0 +1,20 @@
+#include "../bench.h"
+#include "../../simde/x86/ssse3.h"
+
+SIMDE_BENCH_DEFINE(mm_shuffle_epi8, simde__m128i, simde_mm_shuffle_epi8(a, b))
+SIMDE_BENCH_DEFINE(mm_alignr_epi8, simde__m128i, simde_mm_alignr_epi8(a, b, 5))
+SIMDE_BENCH_DEFINE(mm_maddubs_epi16, simde__m128i, simde_mm_maddubs_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm_mulhrs_epi16, simde__m128i, simde_mm_mulhrs_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm_hadd_epi16, simde__m128i, simde_mm_hadd_epi16(a, b))
+SIMDE_BENCH_DEFINE(mm_abs_epi8, simde__m128i, simde_mm_abs_epi8(a))
+SIMDE_BENCH_DEFINE(mm_sign_epi16, simde__m128i, simde_mm_sign_epi16(a, b))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_ssse3)
+  SIMDE_BENCH_ENTRY(mm_shuffle_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_alignr_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_maddubs_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_mulhrs_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_hadd_epi16, bytes)
+  SIMDE_BENCH_ENTRY(mm_abs_epi8, bytes)
+  SIMDE_BENCH_ENTRY(mm_sign_epi16, bytes)
+SIMDE_BENCH_END_SUITE(x86_ssse3, "x86/ssse3")
@@ -0,0 +1,26 @@
+#include "../bench.h"
+#include "../../simde/x86/svml.h"
+
+SIMDE_BENCH_DEFINE(mm_exp_ps, simde__m128, simde_mm_exp_ps(a))
+SIMDE_BENCH_DEFINE(mm_log_ps, simde__m128, simde_mm_log_ps(simde_mm_add_ps(simde_mm_max_ps(a, simde_mm_sub_ps(simde_mm_setzero_ps(), a)), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)))))
+SIMDE_BENCH_DEFINE(mm_sin_ps, simde__m128, simde_mm_sin_ps(a))
+SIMDE_BENCH_DEFINE(mm_atan2_ps, simde__m128, simde_mm_atan2_ps(a, b))
+SIMDE_BENCH_DEFINE(mm_erf_ps, simde__m128, simde_mm_erf_ps(a))
+SIMDE_BENCH_DEFINE(mm_pow_ps, simde__m128, simde_mm_pow_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(1.5)), a))
+SIMDE_BENCH_DEFINE(mm_exp_pd, simde__m128d, simde_mm_exp_pd(a))
+SIMDE_BENCH_DEFINE(mm256_exp_ps, simde__m256, simde_mm256_exp_ps(a))
+SIMDE_BENCH_DEFINE(mm256_sin_ps, simde__m256, simde_mm256_sin_ps(a))
+SIMDE_BENCH_DEFINE(mm512_exp_ps, simde__m512, simde_mm512_exp_ps(a))
+
+SIMDE_BENCH_BEGIN_SUITE(x86_svml)
+  SIMDE_BENCH_ENTRY(mm_exp_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm_log_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm_sin_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm_atan2_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm_erf_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm_pow_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm_exp_pd, f64)
+  SIMDE_BENCH_ENTRY(mm256_exp_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm256_sin_ps, f32_small)
+  SIMDE_BENCH_ENTRY(mm512_exp_ps, f32_small)
+SIMDE_BENCH_END_SUITE(x86_svml, "x86/svml")
@@ -34,11 +34,6 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
-static uint8_t simde_xtime(uint8_t x)
-{
-  return HEDLEY_STATIC_CAST(uint8_t, (x<<1) ^ (((x>>7) & 1) * 0x1b));
-}
-
 SIMDE_FUNCTION_ATTRIBUTES
 simde_uint8x16_t
 simde_vaeseq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
@@ -77,10 +72,7 @@ simde_vaeseq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
     r_.values[11] = r_.values[7];
     r_.values[7] = tmp;
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_aes_s_box[r_.values[i]];
-    }
+    simde_x_aes_sub_bytes(HEDLEY_REINTERPRET_CAST(uint8_t*, &r_));
     return simde_uint8x16_from_private(r_);
   #endif
 }
@@ -126,9 +118,7 @@ simde_vaesdq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
     r_.values[7] = r_.values[11];
     r_.values[11] = r_.values[15];
     r_.values[15] = tmp;
-    for(int i = 0; i < 16; ++i) {
-      r_.values[i] = simde_x_aes_inv_s_box[r_.values[i]];
-    }
+    simde_x_aes_inv_sub_bytes(HEDLEY_REINTERPRET_CAST(uint8_t*, &r_));
     return simde_uint8x16_from_private(r_);
   #endif
 }
@@ -143,20 +133,9 @@ simde_vaesmcq_u8(simde_uint8x16_t data) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_AES)
     return vaesmcq_u8(data);
   #else
-    /* ref: https://github.com/kokke/tiny-AES-c/blob/master/aes.c */
     simde_uint8x16_private
       a_ = simde_uint8x16_to_private(data);
-    uint8_t i;
-    uint8_t Tmp, Tm, t;
-    for (i = 0; i < 4; ++i)
-    {
-      t   = a_.values[i*4+0];
-      Tmp = a_.values[i*4+0] ^ a_.values[i*4+1] ^ a_.values[i*4+2] ^ a_.values[i*4+3] ;
-      Tm  = a_.values[i*4+0] ^ a_.values[i*4+1] ; Tm = simde_xtime(Tm);  a_.values[i*4+0] ^= Tm ^ Tmp ;
-      Tm  = a_.values[i*4+1] ^ a_.values[i*4+2] ; Tm = simde_xtime(Tm);  a_.values[i*4+1] ^= Tm ^ Tmp ;
-      Tm  = a_.values[i*4+2] ^ a_.values[i*4+3] ; Tm = simde_xtime(Tm);  a_.values[i*4+2] ^= Tm ^ Tmp ;
-      Tm  = a_.values[i*4+3] ^ t ;        Tm = simde_xtime(Tm);  a_.values[i*4+3] ^= Tm ^ Tmp ;
-    }
+    simde_x_aes_mix_columns(HEDLEY_REINTERPRET_CAST(uint8_t*, &a_));
     return simde_uint8x16_from_private(a_);
   #endif
 }
@@ -165,15 +144,6 @@ simde_vaesmcq_u8(simde_uint8x16_t data) {
   #define vaesmcq_u8(data) simde_vaesmcq_u8((data))
 #endif
 
-static uint8_t Multiply(uint8_t x, uint8_t y)
-{
-  return (((y & 1) * x) ^
-       ((y>>1 & 1) * simde_xtime(x)) ^
-       ((y>>2 & 1) * simde_xtime(simde_xtime(x))) ^
-       ((y>>3 & 1) * simde_xtime(simde_xtime(simde_xtime(x)))) ^
-       ((y>>4 & 1) * simde_xtime(simde_xtime(simde_xtime(simde_xtime(x)))))); /* this last call to simde_xtime() can be omitted */
-}
-
 SIMDE_FUNCTION_ATTRIBUTES
 simde_uint8x16_t
 simde_vaesimcq_u8(simde_uint8x16_t data) {
@@ -187,22 +157,8 @@ simde_vaesimcq_u8(simde_uint8x16_t data) {
     #if defined(SIMDE_X86_AES_NATIVE)
       r_.m128i = _mm_aesimc_si128(a_.m128i);
     #else
-      int Nb = simde_x_aes_Nb;
-      // uint8_t k[] = {0x0e, 0x09, 0x0d, 0x0b}; // a(x) = {0e} + {09}x + {0d}x2 + {0b}x3
-      uint8_t i, j, col[4], res[4];
-
-      for (j = 0; j < Nb; j++) {
-        for (i = 0; i < 4; i++) {
-          col[i] = a_.values[Nb*j+i];
-        }
-
-        //coef_mult(k, col, res);
-        simde_x_aes_coef_mult_lookup(4, col, res);
-
-        for (i = 0; i < 4; i++) {
-          r_.values[Nb*j+i] = res[i];
-        }
-      }
+      r_ = a_;
+      simde_x_aes_inv_mix_columns(HEDLEY_REINTERPRET_CAST(uint8_t*, &r_));
     #endif
     return simde_uint8x16_from_private(r_);
   #endif
@@ -28,49 +28,19 @@
 #define SIMDE_ARM_NEON_CRC32_H
 
 #include "types.h"
+#include "../../simde-crc32.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
-SIMDE_FUNCTION_ATTRIBUTES
-uint64_t simde_crc32_reverseBits(uint64_t num, int num_of_bits)
-{
-  uint64_t reverse_num = 0;
-  for (int i = 0; i < num_of_bits; i++) {
-    if (num & (1ULL << i))
-      reverse_num |= 1ULL << (num_of_bits - 1 - i);
-  }
-  return reverse_num;
-}
-
-SIMDE_FUNCTION_ATTRIBUTES
-uint32_t simde_crc32_eor_mask(uint32_t a, uint32_t b, uint32_t mask) {
-  uint32_t part_a = a & mask;
-  uint32_t part_result = part_a ^ b;
-  uint32_t result = (a & ~mask) | part_result;
-  return result;
-}
-
 SIMDE_FUNCTION_ATTRIBUTES
 uint32_t
 simde___crc32b(uint32_t a, uint8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32b(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, (simde_crc32_reverseBits(b, 8) << 24));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 24; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x00FFFFFF) << 8) | ((tail & 0xFF000000) >> 24);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32_u8(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -84,19 +54,7 @@ simde___crc32h(uint32_t a, uint16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32h(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, (simde_crc32_reverseBits(b, 16) << 16));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 16; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x0000FFFF) << 16) | ((tail & 0xFFFF0000) >> 16);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32_u16(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -110,18 +68,7 @@ simde___crc32w(uint32_t a, uint32_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32w(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(b, 32));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32_u32(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -135,28 +82,7 @@ simde___crc32d(uint32_t a, uint64_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32d(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint64_t r_val = simde_crc32_reverseBits(b, 64);
-    uint32_t val_head = HEDLEY_STATIC_CAST(uint32_t, r_val >> 32);
-    uint32_t val_mid = HEDLEY_STATIC_CAST(uint32_t, r_val & 0x00000000FFFFFFFF);
-    uint32_t head = r_acc ^ val_head;
-    uint32_t mid = 0u ^ val_mid;
-    uint32_t tail = 0u;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        mid = simde_crc32_eor_mask(mid, poly << i, 0xFFFFFFFF);
-        tail = simde_crc32_eor_mask(tail, 0x0, 0xFFFFFFFF);
-      }
-    }
-    for(int i = 31; i >= 0; --i) {
-      if ((mid>>i) & 1) {
-        mid = simde_crc32_eor_mask(mid, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32_u64(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -169,20 +95,10 @@ uint32_t
 simde___crc32cb(uint32_t a, uint8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32cb(a, b);
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE)
+    return _mm_crc32_u8(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, (simde_crc32_reverseBits(b, 8) << 24));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 24; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x00FFFFFF) << 8) | ((tail & 0xFF000000) >> 24);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32c_u8(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -195,20 +111,10 @@ uint32_t
 simde___crc32ch(uint32_t a, uint16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32ch(a, b);
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE)
+    return _mm_crc32_u16(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(b, 16) << 16);
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 16; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x0000FFFF) << 16) | ((tail & 0xFFFF0000) >> 16);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32c_u16(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -221,19 +127,10 @@ uint32_t
 simde___crc32cw(uint32_t a, uint32_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32cw(a, b);
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE)
+    return _mm_crc32_u32(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(b, 32));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32c_u32(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -246,29 +143,12 @@ uint32_t
 simde___crc32cd(uint32_t a, uint64_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32cd(a, b);
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return HEDLEY_STATIC_CAST(uint32_t, _mm_crc32_u64(a, b));
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE)
+    return _mm_crc32_u32(_mm_crc32_u32(a, HEDLEY_STATIC_CAST(uint32_t, b)), HEDLEY_STATIC_CAST(uint32_t, b >> 32));
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint64_t r_val = simde_crc32_reverseBits(b, 64);
-    uint32_t val_head = HEDLEY_STATIC_CAST(uint32_t, r_val >> 32);
-    uint32_t val_mid = HEDLEY_STATIC_CAST(uint32_t, r_val & 0x00000000FFFFFFFF);
-    uint32_t head = r_acc ^ val_head;
-    uint32_t mid = 0u ^ val_mid;
-    uint32_t tail = 0u;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        mid = simde_crc32_eor_mask(mid, poly << i, 0xFFFFFFFF);
-        tail = simde_crc32_eor_mask(tail, 0x0, 0xFFFFFFFF);
-      }
-    }
-    for(int i = 31; i >= 0; --i) {
-      if ((mid>>i) & 1) {
-        mid = simde_crc32_eor_mask(mid, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32c_u64(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -43,6 +43,101 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* x86 lowerings shared by the 8-bit dot product family (vdot, vusdot,
+ * vsudot, vmmla).  Each helper adds the sums of four adjacent 8-bit
+ * products to the 32-bit lanes of r.
+ *
+ * VNNI only has an unsigned x signed form, so the other signednesses
+ * bias one operand by 128 and subtract the bias back out.  Without
+ * VNNI the bytes are widened to 16 bits in even/odd halves so that
+ * _mm_madd_epi16 does the pairwise sums; _mm_maddubs_epi16 saturates
+ * and is only usable when one operand of each pair is zero. */
+#if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define SIMDE_ARM_NEON_DOT_X86_DPBUSD_(src, a, b) _mm_dpbusd_epi32((src), (a), (b))
+#elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+  #define SIMDE_ARM_NEON_DOT_X86_DPBUSD_(src, a, b) _mm_dpbusd_avx_epi32((src), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vdotq_s32_x86_(__m128i r, __m128i a, __m128i b) {
+  #if defined(SIMDE_ARM_NEON_DOT_X86_DPBUSD_)
+    const __m128i
+      bias = _mm_set1_epi8(INT8_MIN),
+      zero = _mm_setzero_si128(),
+      biased = SIMDE_ARM_NEON_DOT_X86_DPBUSD_(zero, _mm_xor_si128(a, bias), b),
+      correction = SIMDE_ARM_NEON_DOT_X86_DPBUSD_(zero, bias, b);
+    return _mm_add_epi32(r, _mm_sub_epi32(biased, correction));
+  #else
+    const __m128i
+      a_even = _mm_srai_epi16(_mm_slli_epi16(a, 8), 8),
+      b_even = _mm_srai_epi16(_mm_slli_epi16(b, 8), 8),
+      a_odd = _mm_srai_epi16(a, 8),
+      b_odd = _mm_srai_epi16(b, 8);
+    r = _mm_add_epi32(r, _mm_madd_epi16(a_even, b_even));
+    return _mm_add_epi32(r, _mm_madd_epi16(a_odd, b_odd));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vdotq_u32_x86_(__m128i r, __m128i a, __m128i b) {
+  #if defined(SIMDE_ARM_NEON_DOT_X86_DPBUSD_)
+    const __m128i
+      bias = _mm_set1_epi8(INT8_MIN),
+      zero = _mm_setzero_si128(),
+      biased = SIMDE_ARM_NEON_DOT_X86_DPBUSD_(zero, a, _mm_xor_si128(b, bias)),
+      correction = SIMDE_ARM_NEON_DOT_X86_DPBUSD_(zero, a, bias);
+    return _mm_add_epi32(r, _mm_sub_epi32(biased, correction));
+  #else
+    const __m128i
+      mask = _mm_set1_epi16(0x00FF),
+      a_even = _mm_and_si128(a, mask),
+      b_even = _mm_and_si128(b, mask),
+      a_odd = _mm_srli_epi16(a, 8),
+      b_odd = _mm_srli_epi16(b, 8);
+    r = _mm_add_epi32(r, _mm_madd_epi16(a_even, b_even));
+    return _mm_add_epi32(r, _mm_madd_epi16(a_odd, b_odd));
+  #endif
+}
+
+/* a is unsigned, b is signed. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vusdotq_s32_x86_(__m128i r, __m128i a, __m128i b) {
+  #if defined(SIMDE_ARM_NEON_DOT_X86_DPBUSD_)
+    return SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, a, b);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i
+      mask = _mm_set1_epi16(0x00FF),
+      ones = _mm_set1_epi16(1),
+      even = _mm_maddubs_epi16(_mm_and_si128(a, mask), b),
+      odd = _mm_maddubs_epi16(_mm_andnot_si128(mask, a), b);
+    r = _mm_add_epi32(r, _mm_madd_epi16(even, ones));
+    return _mm_add_epi32(r, _mm_madd_epi16(odd, ones));
+  #else
+    const __m128i
+      a_even = _mm_and_si128(a, _mm_set1_epi16(0x00FF)),
+      b_even = _mm_srai_epi16(_mm_slli_epi16(b, 8), 8),
+      a_odd = _mm_srli_epi16(a, 8),
+      b_odd = _mm_srai_epi16(b, 8);
+    r = _mm_add_epi32(r, _mm_madd_epi16(a_even, b_even));
+    return _mm_add_epi32(r, _mm_madd_epi16(a_odd, b_odd));
+  #endif
+}
+
+/* Broadcast the 32-bit group selected by lane from a vector of bytes,
+ * for the _lane/_laneq forms. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vdot_lane_x86_(const void* b, const int lane) {
+  int32_t group;
+  simde_memcpy(&group, HEDLEY_REINTERPRET_CAST(const uint8_t*, b) + (lane * 4), sizeof(group));
+  return _mm_set1_epi32(group);
+}
+#endif /* defined(SIMDE_X86_SSE2_NATIVE) */
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_int32x2_t
 simde_vdot_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b) {
@@ -50,6 +145,13 @@ simde_vdot_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b) {
     return vdot_s32(r, a, b);
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return simde_vadd_s32(r, simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(a, b)))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    simde_int8x8_private
+      a_ = simde_int8x8_to_private(a),
+      b_ = simde_int8x8_to_private(b);
+    r_.m64 = _mm_movepi64_pi64(simde_x_vdotq_s32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), _mm_movpi64_epi64(b_.m64)));
+    return simde_int32x2_from_private(r_);
   #else
     simde_int32x2_private r_;
     simde_int8x8_private
@@ -79,6 +181,13 @@ simde_vdot_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x8_t b) {
     return vdot_u32(r, a, b);
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return simde_vadd_u32(r, simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(a, b)))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
+    simde_uint8x8_private
+      a_ = simde_uint8x8_to_private(a),
+      b_ = simde_uint8x8_to_private(b);
+    r_.m64 = _mm_movepi64_pi64(simde_x_vdotq_u32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), _mm_movpi64_epi64(b_.m64)));
+    return simde_uint32x2_from_private(r_);
   #else
     simde_uint32x2_private r_;
     simde_uint8x8_private
@@ -111,6 +220,13 @@ simde_vdotq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b) {
     return simde_vaddq_s32(r,
                            simde_vcombine_s32(simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(simde_vget_low_s8(a), simde_vget_low_s8(b))))),
                                                               simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(simde_vget_high_s8(a), simde_vget_high_s8(b)))))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_int8x16_private
+      a_ = simde_int8x16_to_private(a),
+      b_ = simde_int8x16_to_private(b);
+    r_.m128i = simde_x_vdotq_s32_x86_(r_.m128i, a_.m128i, b_.m128i);
+    return simde_int32x4_from_private(r_);
   #else
     simde_int32x4_private r_;
     simde_int8x16_private
@@ -142,6 +258,13 @@ simde_vdotq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b) {
     return simde_vaddq_u32(r,
                            simde_vcombine_u32(simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(simde_vget_low_u8(a), simde_vget_low_u8(b))))),
                                               simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(simde_vget_high_u8(a), simde_vget_high_u8(b)))))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
+    simde_uint8x16_private
+      a_ = simde_uint8x16_to_private(a),
+      b_ = simde_uint8x16_to_private(b);
+    r_.m128i = simde_x_vdotq_u32_x86_(r_.m128i, a_.m128i, b_.m128i);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private r_;
     simde_uint8x16_private
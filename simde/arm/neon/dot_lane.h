@@ -31,6 +31,7 @@
 #include "types.h"
 
 #include "add.h"
+#include "dot.h"
 #include "dup_lane.h"
 #include "paddl.h"
 #include "movn.h"
@@ -64,6 +65,13 @@ simde_vdot_lane_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b, const
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    simde_int8x8_private a_ = simde_int8x8_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(simde_x_vdotq_s32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), simde_x_vdot_lane_x86_(&b, lane)));
+
+    result = simde_int32x2_from_private(r_);
   #else
     simde_int32x2_private r_ = simde_int32x2_to_private(r);
     simde_int8x8_private
@@ -115,6 +123,13 @@ simde_vdot_lane_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x8_t b, co
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
+    simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(simde_x_vdotq_u32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), simde_x_vdot_lane_x86_(&b, lane)));
+
+    result = simde_uint32x2_from_private(r_);
   #else
     simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
     simde_uint8x8_private
@@ -165,6 +180,13 @@ simde_vdot_laneq_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x16_t b, con
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    simde_int8x8_private a_ = simde_int8x8_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(simde_x_vdotq_s32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), simde_x_vdot_lane_x86_(&b, lane)));
+
+    result = simde_int32x2_from_private(r_);
   #else
     simde_int32x2_private r_ = simde_int32x2_to_private(r);
     simde_int8x8_private a_ = simde_int8x8_to_private(a);
@@ -214,6 +236,13 @@ simde_vdot_laneq_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x16_t b,
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
+    simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(simde_x_vdotq_u32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), simde_x_vdot_lane_x86_(&b, lane)));
+
+    result = simde_uint32x2_from_private(r_);
   #else
     simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
@@ -275,6 +304,13 @@ simde_vdotq_laneq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+
+    r_.m128i = simde_x_vdotq_u32_x86_(r_.m128i, a_.m128i, simde_x_vdot_lane_x86_(&b, lane));
+
+    result = simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
     simde_uint8x16_private
@@ -337,6 +373,13 @@ simde_vdotq_laneq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b, c
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_int8x16_private a_ = simde_int8x16_to_private(a);
+
+    r_.m128i = simde_x_vdotq_s32_x86_(r_.m128i, a_.m128i, simde_x_vdot_lane_x86_(&b, lane));
+
+    result = simde_int32x4_from_private(r_);
   #else
     simde_int32x4_private r_ = simde_int32x4_to_private(r);
     simde_int8x16_private
@@ -399,6 +442,13 @@ simde_vdotq_lane_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x8_t b,
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+
+    r_.m128i = simde_x_vdotq_u32_x86_(r_.m128i, a_.m128i, simde_x_vdot_lane_x86_(&b, lane));
+
+    result = simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
@@ -460,6 +510,13 @@ simde_vdotq_lane_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x8_t b, con
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_int8x16_private a_ = simde_int8x16_to_private(a);
+
+    r_.m128i = simde_x_vdotq_s32_x86_(r_.m128i, a_.m128i, simde_x_vdot_lane_x86_(&b, lane));
+
+    result = simde_int32x4_from_private(r_);
   #else
     simde_int32x4_private r_ = simde_int32x4_to_private(r);
     simde_int8x16_private a_ = simde_int8x16_to_private(a);
@@ -40,6 +40,118 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #endif
 SIMDE_BEGIN_DECLS_
 
+/* x86 de-interleaving for the 128-bit forms.  Each helper reads the
+ * 48 interleaved bytes at ptr and writes the three de-interleaved
+ * vectors to r, which is the caller's array of three private unions. */
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld3q_8_x86_(void* r, const void* ptr) {
+    const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+    __m128i* d = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+    __m128i
+      a = _mm_loadu_si128(p    ),
+      b = _mm_loadu_si128(p + 1),
+      c = _mm_loadu_si128(p + 2);
+
+    _mm_storeu_si128(d + 0,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13))));
+
+    _mm_storeu_si128(d + 1,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14))));
+
+    _mm_storeu_si128(d + 2,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15))));
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld3q_16_x86_(void* r, const void* ptr) {
+    const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+    __m128i* d = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+    __m128i
+      a = _mm_loadu_si128(p    ),
+      b = _mm_loadu_si128(p + 1),
+      c = _mm_loadu_si128(p + 2);
+
+    _mm_storeu_si128(d + 0,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11))));
+
+    _mm_storeu_si128(d + 1,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13))));
+
+    _mm_storeu_si128(d + 2,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15))));
+  }
+#endif
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld3q_32_x86_(void* r, const void* ptr) {
+    const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+    __m128i* d = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+    /* a = {x0, y0, z0, x1}, b = {y1, z1, x2, y2}, c = {z2, x3, y3, z3} */
+    __m128
+      a = _mm_castsi128_ps(_mm_loadu_si128(p    )),
+      b = _mm_castsi128_ps(_mm_loadu_si128(p + 1)),
+      c = _mm_castsi128_ps(_mm_loadu_si128(p + 2));
+
+    _mm_storeu_si128(d + 0, _mm_castps_si128(
+      _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 0, 3, 2)), _MM_SHUFFLE(3, 0, 3, 0))));
+    _mm_storeu_si128(d + 1, _mm_castps_si128(
+      _mm_shuffle_ps(
+        _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+        _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0))));
+    _mm_storeu_si128(d + 2, _mm_castps_si128(
+      _mm_shuffle_ps(
+        _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+        _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)),
+        _MM_SHUFFLE(2, 0, 2, 0))));
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld3q_64_x86_(void* r, const void* ptr) {
+    const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+    __m128i* d = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+    /* a = {x0, y0}, b = {z0, x1}, c = {y1, z1} */
+    __m128d
+      a = _mm_castsi128_pd(_mm_loadu_si128(p    )),
+      b = _mm_castsi128_pd(_mm_loadu_si128(p + 1)),
+      c = _mm_castsi128_pd(_mm_loadu_si128(p + 2));
+
+    _mm_storeu_si128(d + 0, _mm_castpd_si128(_mm_shuffle_pd(a, b, 2)));
+    _mm_storeu_si128(d + 1, _mm_castpd_si128(_mm_shuffle_pd(a, c, 1)));
+    _mm_storeu_si128(d + 2, _mm_castpd_si128(_mm_shuffle_pd(b, c, 2)));
+  }
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -410,6 +522,15 @@ simde_float16x8x3_t
 simde_vld3q_f16(simde_float16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
     return vld3q_f16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_float16x8_private r_[3];
+    simde_x_vld3q_16_x86_(r_, ptr);
+    simde_float16x8x3_t r = { {
+      simde_float16x8_from_private(r_[0]),
+      simde_float16x8_from_private(r_[1]),
+      simde_float16x8_from_private(r_[2])
+    } };
+    return r;
   #else
     simde_float16x8_private r_[3];
     #if defined(SIMDE_RISCV_V_NATIVE) && SIMDE_ARCH_RISCV_ZVFH && (SIMDE_NATURAL_VECTOR_SIZE >= 128)
@@ -443,6 +564,15 @@ simde_float32x4x3_t
 simde_vld3q_f32(simde_float32 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_f32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4_private r_[3];
+    simde_x_vld3q_32_x86_(r_, ptr);
+    simde_float32x4x3_t r = { {
+      simde_float32x4_from_private(r_[0]),
+      simde_float32x4_from_private(r_[1]),
+      simde_float32x4_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_float32x4_private r_[3];
     vfloat32m1x3_t dest = __riscv_vlseg3e32_v_f32m1x3(&ptr[0], 4);
@@ -483,6 +613,15 @@ simde_float64x2x3_t
 simde_vld3q_f64(simde_float64 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_f64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2_private r_[3];
+    simde_x_vld3q_64_x86_(r_, ptr);
+    simde_float64x2x3_t r = { {
+      simde_float64x2_from_private(r_[0]),
+      simde_float64x2_from_private(r_[1]),
+      simde_float64x2_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_float64x2_private r_[3];
     vfloat64m1x3_t dest = __riscv_vlseg3e64_v_f64m1x3(&ptr[0], 2);
@@ -523,6 +662,15 @@ simde_int8x16x3_t
 simde_vld3q_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16_private r_[3];
+    simde_x_vld3q_8_x86_(r_, ptr);
+    simde_int8x16x3_t r = { {
+      simde_int8x16_from_private(r_[0]),
+      simde_int8x16_from_private(r_[1]),
+      simde_int8x16_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int8x16_private r_[3];
     vint8m1x3_t dest = __riscv_vlseg3e8_v_i8m1x3(&ptr[0], 16);
@@ -563,6 +711,15 @@ simde_int16x8x3_t
 simde_vld3q_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int16x8_private r_[3];
+    simde_x_vld3q_16_x86_(r_, ptr);
+    simde_int16x8x3_t r = { {
+      simde_int16x8_from_private(r_[0]),
+      simde_int16x8_from_private(r_[1]),
+      simde_int16x8_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int16x8_private r_[3];
     vint16m1x3_t dest = __riscv_vlseg3e16_v_i16m1x3(&ptr[0], 8);
@@ -603,6 +760,15 @@ simde_int32x4x3_t
 simde_vld3q_s32(int32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_[3];
+    simde_x_vld3q_32_x86_(r_, ptr);
+    simde_int32x4x3_t r = { {
+      simde_int32x4_from_private(r_[0]),
+      simde_int32x4_from_private(r_[1]),
+      simde_int32x4_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int32x4_private r_[3];
     vint32m1x3_t dest = __riscv_vlseg3e32_v_i32m1x3(&ptr[0], 4);
@@ -643,6 +809,15 @@ simde_int64x2x3_t
 simde_vld3q_s64(int64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_s64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2_private r_[3];
+    simde_x_vld3q_64_x86_(r_, ptr);
+    simde_int64x2x3_t r = { {
+      simde_int64x2_from_private(r_[0]),
+      simde_int64x2_from_private(r_[1]),
+      simde_int64x2_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int64x2_private r_[3];
     vint64m1x3_t dest = __riscv_vlseg3e64_v_i64m1x3(&ptr[0], 2);
@@ -684,6 +859,15 @@ simde_uint8x16x3_t
 simde_vld3q_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_uint8x16_private r_[3];
+    simde_x_vld3q_8_x86_(r_, ptr);
+    simde_uint8x16x3_t r = { {
+      simde_uint8x16_from_private(r_[0]),
+      simde_uint8x16_from_private(r_[1]),
+      simde_uint8x16_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint8x16_private r_[3];
     vuint8m1x3_t dest = __riscv_vlseg3e8_v_u8m1x3(&ptr[0], 16);
@@ -724,6 +908,15 @@ simde_uint16x8x3_t
 simde_vld3q_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_uint16x8_private r_[3];
+    simde_x_vld3q_16_x86_(r_, ptr);
+    simde_uint16x8x3_t r = { {
+      simde_uint16x8_from_private(r_[0]),
+      simde_uint16x8_from_private(r_[1]),
+      simde_uint16x8_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint16x8_private r_[3];
     vuint16m1x3_t dest = __riscv_vlseg3e16_v_u16m1x3(&ptr[0], 8);
@@ -764,6 +957,15 @@ simde_uint32x4x3_t
 simde_vld3q_u32(uint32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private r_[3];
+    simde_x_vld3q_32_x86_(r_, ptr);
+    simde_uint32x4x3_t r = { {
+      simde_uint32x4_from_private(r_[0]),
+      simde_uint32x4_from_private(r_[1]),
+      simde_uint32x4_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint32x4_private r_[3];
     vuint32m1x3_t dest = __riscv_vlseg3e32_v_u32m1x3(&ptr[0], 4);
@@ -804,6 +1006,15 @@ simde_uint64x2x3_t
 simde_vld3q_u64(uint64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_u64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint64x2_private r_[3];
+    simde_x_vld3q_64_x86_(r_, ptr);
+    simde_uint64x2x3_t r = { {
+      simde_uint64x2_from_private(r_[0]),
+      simde_uint64x2_from_private(r_[1]),
+      simde_uint64x2_from_private(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint64x2_private r_[3];
     vuint64m1x3_t dest = __riscv_vlseg3e64_v_u64m1x3(&ptr[0], 2);
@@ -949,6 +1160,15 @@ simde_poly8x16x3_t
 simde_vld3q_p8(simde_poly8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_p8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_poly8x16_private r_[3];
+    simde_x_vld3q_8_x86_(r_, ptr);
+    simde_poly8x16x3_t r = { {
+      simde_poly8x16_from_private(r_[0]),
+      simde_poly8x16_from_private(r_[1]),
+      simde_poly8x16_from_private(r_[2])
+    } };
+    return r;
   #else
     simde_poly8x16_private r_[3];
 
@@ -984,6 +1204,15 @@ simde_poly16x8x3_t
 simde_vld3q_p16(simde_poly16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_p16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_poly16x8_private r_[3];
+    simde_x_vld3q_16_x86_(r_, ptr);
+    simde_poly16x8x3_t r = { {
+      simde_poly16x8_from_private(r_[0]),
+      simde_poly16x8_from_private(r_[1]),
+      simde_poly16x8_from_private(r_[2])
+    } };
+    return r;
   #else
     simde_poly16x8_private r_[3];
 
@@ -1019,6 +1248,15 @@ simde_poly64x2x3_t
 simde_vld3q_p64(simde_poly64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_p64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_poly64x2_private r_[3];
+    simde_x_vld3q_64_x86_(r_, ptr);
+    simde_poly64x2x3_t r = { {
+      simde_poly64x2_from_private(r_[0]),
+      simde_poly64x2_from_private(r_[1]),
+      simde_poly64x2_from_private(r_[2])
+    } };
+    return r;
   #else
     simde_poly64x2_private r_[3];
 
@@ -1082,6 +1320,15 @@ simde_bfloat16x8x3_t
 simde_vld3q_bf16(simde_bfloat16 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
     return vld3q_bf16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_bfloat16x8_private r_[3];
+    simde_x_vld3q_16_x86_(r_, ptr);
+    simde_bfloat16x8x3_t r = { {
+      simde_bfloat16x8_from_private(r_[0]),
+      simde_bfloat16x8_from_private(r_[1]),
+      simde_bfloat16x8_from_private(r_[2])
+    } };
+    return r;
   #else
     simde_bfloat16x8_private r_[3];
 
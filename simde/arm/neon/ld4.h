@@ -39,6 +39,127 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #endif
 SIMDE_BEGIN_DECLS_
 
+/* x86 de-interleaving for the 128-bit forms.  Each helper reads the
+ * 64 interleaved bytes at ptr and writes the four de-interleaved
+ * vectors to r, which is the caller's array of four private unions.
+ *
+ * For 8- to 32-bit elements the bytes of each 16-byte chunk are first
+ * grouped by channel so that every 32-bit lane holds one channel, which
+ * leaves a 4x4 transpose of 32-bit lanes.  With AVX2 that transpose is
+ * done on two 256-bit registers with _mm256_permutevar8x32_epi32. */
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld4q_transpose_x86_(void* r, __m128i a, __m128i b, __m128i c, __m128i d) {
+    __m128i* o = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+    __m128i
+      ab_lo = _mm_unpacklo_epi32(a, b),
+      ab_hi = _mm_unpackhi_epi32(a, b),
+      cd_lo = _mm_unpacklo_epi32(c, d),
+      cd_hi = _mm_unpackhi_epi32(c, d);
+
+    _mm_storeu_si128(o + 0, _mm_unpacklo_epi64(ab_lo, cd_lo));
+    _mm_storeu_si128(o + 1, _mm_unpackhi_epi64(ab_lo, cd_lo));
+    _mm_storeu_si128(o + 2, _mm_unpacklo_epi64(ab_hi, cd_hi));
+    _mm_storeu_si128(o + 3, _mm_unpackhi_epi64(ab_hi, cd_hi));
+  }
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    SIMDE_FUNCTION_ATTRIBUTES
+    void
+    simde_x_vld4q_transpose_avx2_(void* r, __m256i a, __m256i b) {
+      __m128i* o = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+      const __m256i perm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+      a = _mm256_permutevar8x32_epi32(a, perm);
+      b = _mm256_permutevar8x32_epi32(b, perm);
+
+      __m256i
+        lo = _mm256_unpacklo_epi64(a, b),
+        hi = _mm256_unpackhi_epi64(a, b);
+
+      _mm_storeu_si128(o + 0, _mm256_castsi256_si128(lo));
+      _mm_storeu_si128(o + 1, _mm256_castsi256_si128(hi));
+      _mm_storeu_si128(o + 2, _mm256_extracti128_si256(lo, 1));
+      _mm_storeu_si128(o + 3, _mm256_extracti128_si256(hi, 1));
+    }
+  #endif
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld4q_32_x86_(void* r, const void* ptr) {
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i* p = HEDLEY_REINTERPRET_CAST(const __m256i*, ptr);
+      simde_x_vld4q_transpose_avx2_(r, _mm256_loadu_si256(p), _mm256_loadu_si256(p + 1));
+    #else
+      const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+      simde_x_vld4q_transpose_x86_(r, _mm_loadu_si128(p), _mm_loadu_si128(p + 1), _mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3));
+    #endif
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld4q_64_x86_(void* r, const void* ptr) {
+    const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+    __m128i* o = HEDLEY_REINTERPRET_CAST(__m128i*, r);
+    __m128i
+      a = _mm_loadu_si128(p    ),
+      b = _mm_loadu_si128(p + 1),
+      c = _mm_loadu_si128(p + 2),
+      d = _mm_loadu_si128(p + 3);
+
+    _mm_storeu_si128(o + 0, _mm_unpacklo_epi64(a, c));
+    _mm_storeu_si128(o + 1, _mm_unpackhi_epi64(a, c));
+    _mm_storeu_si128(o + 2, _mm_unpacklo_epi64(b, d));
+    _mm_storeu_si128(o + 3, _mm_unpackhi_epi64(b, d));
+  }
+#endif
+
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld4q_8_x86_(void* r, const void* ptr) {
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i* p = HEDLEY_REINTERPRET_CAST(const __m256i*, ptr);
+      const __m256i m = _mm256_setr_epi8(
+        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+        0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+      simde_x_vld4q_transpose_avx2_(r,
+        _mm256_shuffle_epi8(_mm256_loadu_si256(p    ), m),
+        _mm256_shuffle_epi8(_mm256_loadu_si256(p + 1), m));
+    #else
+      const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+      const __m128i m = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+      simde_x_vld4q_transpose_x86_(r,
+        _mm_shuffle_epi8(_mm_loadu_si128(p    ), m),
+        _mm_shuffle_epi8(_mm_loadu_si128(p + 1), m),
+        _mm_shuffle_epi8(_mm_loadu_si128(p + 2), m),
+        _mm_shuffle_epi8(_mm_loadu_si128(p + 3), m));
+    #endif
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vld4q_16_x86_(void* r, const void* ptr) {
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i* p = HEDLEY_REINTERPRET_CAST(const __m256i*, ptr);
+      const __m256i m = _mm256_setr_epi8(
+        0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+        0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+      simde_x_vld4q_transpose_avx2_(r,
+        _mm256_shuffle_epi8(_mm256_loadu_si256(p    ), m),
+        _mm256_shuffle_epi8(_mm256_loadu_si256(p + 1), m));
+    #else
+      const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+      const __m128i m = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+      simde_x_vld4q_transpose_x86_(r,
+        _mm_shuffle_epi8(_mm_loadu_si128(p    ), m),
+        _mm_shuffle_epi8(_mm_loadu_si128(p + 1), m),
+        _mm_shuffle_epi8(_mm_loadu_si128(p + 2), m),
+        _mm_shuffle_epi8(_mm_loadu_si128(p + 3), m));
+    #endif
+  }
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -354,6 +475,16 @@ simde_float16x8x4_t
 simde_vld4q_f16(simde_float16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
     return vld4q_f16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_float16x8_private r_[4];
+    simde_x_vld4q_16_x86_(r_, ptr);
+    simde_float16x8x4_t r = { {
+      simde_float16x8_from_private(r_[0]),
+      simde_float16x8_from_private(r_[1]),
+      simde_float16x8_from_private(r_[2]),
+      simde_float16x8_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_float16x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE) && SIMDE_ARCH_RISCV_ZVFH && (SIMDE_NATURAL_VECTOR_SIZE >= 128)
@@ -382,6 +513,16 @@ simde_float32x4x4_t
 simde_vld4q_f32(simde_float32 const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_f32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4_private r_[4];
+    simde_x_vld4q_32_x86_(r_, ptr);
+    simde_float32x4x4_t r = { {
+      simde_float32x4_from_private(r_[0]),
+      simde_float32x4_from_private(r_[1]),
+      simde_float32x4_from_private(r_[2]),
+      simde_float32x4_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_float32x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -410,6 +551,16 @@ simde_float64x2x4_t
 simde_vld4q_f64(simde_float64 const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_f64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2_private r_[4];
+    simde_x_vld4q_64_x86_(r_, ptr);
+    simde_float64x2x4_t r = { {
+      simde_float64x2_from_private(r_[0]),
+      simde_float64x2_from_private(r_[1]),
+      simde_float64x2_from_private(r_[2]),
+      simde_float64x2_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_float64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -438,6 +589,16 @@ simde_int8x16x4_t
 simde_vld4q_s8(int8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16_private r_[4];
+    simde_x_vld4q_8_x86_(r_, ptr);
+    simde_int8x16x4_t r = { {
+      simde_int8x16_from_private(r_[0]),
+      simde_int8x16_from_private(r_[1]),
+      simde_int8x16_from_private(r_[2]),
+      simde_int8x16_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_int8x16_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -466,6 +627,16 @@ simde_int16x8x4_t
 simde_vld4q_s16(int16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int16x8_private r_[4];
+    simde_x_vld4q_16_x86_(r_, ptr);
+    simde_int16x8x4_t r = { {
+      simde_int16x8_from_private(r_[0]),
+      simde_int16x8_from_private(r_[1]),
+      simde_int16x8_from_private(r_[2]),
+      simde_int16x8_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_int16x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -494,6 +665,16 @@ simde_int32x4x4_t
 simde_vld4q_s32(int32_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_[4];
+    simde_x_vld4q_32_x86_(r_, ptr);
+    simde_int32x4x4_t r = { {
+      simde_int32x4_from_private(r_[0]),
+      simde_int32x4_from_private(r_[1]),
+      simde_int32x4_from_private(r_[2]),
+      simde_int32x4_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_int32x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -522,6 +703,16 @@ simde_int64x2x4_t
 simde_vld4q_s64(int64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_s64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2_private r_[4];
+    simde_x_vld4q_64_x86_(r_, ptr);
+    simde_int64x2x4_t r = { {
+      simde_int64x2_from_private(r_[0]),
+      simde_int64x2_from_private(r_[1]),
+      simde_int64x2_from_private(r_[2]),
+      simde_int64x2_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_int64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -549,6 +740,16 @@ simde_uint8x16x4_t
 simde_vld4q_u8(uint8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_uint8x16_private r_[4];
+    simde_x_vld4q_8_x86_(r_, ptr);
+    simde_uint8x16x4_t r = { {
+      simde_uint8x16_from_private(r_[0]),
+      simde_uint8x16_from_private(r_[1]),
+      simde_uint8x16_from_private(r_[2]),
+      simde_uint8x16_from_private(r_[3])
+    } };
+    return r;
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     // Let a, b, c, d be the 4 uint8x16 to return, they are laid out in memory:
     // [a0, b0, c0, d0, a1, b1, c1, d1, a2, b2, c2, d2, a3, b3, c3, d3,
@@ -622,6 +823,16 @@ simde_uint16x8x4_t
 simde_vld4q_u16(uint16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_uint16x8_private r_[4];
+    simde_x_vld4q_16_x86_(r_, ptr);
+    simde_uint16x8x4_t r = { {
+      simde_uint16x8_from_private(r_[0]),
+      simde_uint16x8_from_private(r_[1]),
+      simde_uint16x8_from_private(r_[2]),
+      simde_uint16x8_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_uint16x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -650,6 +861,16 @@ simde_uint32x4x4_t
 simde_vld4q_u32(uint32_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private r_[4];
+    simde_x_vld4q_32_x86_(r_, ptr);
+    simde_uint32x4x4_t r = { {
+      simde_uint32x4_from_private(r_[0]),
+      simde_uint32x4_from_private(r_[1]),
+      simde_uint32x4_from_private(r_[2]),
+      simde_uint32x4_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_uint32x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -678,6 +899,16 @@ simde_uint64x2x4_t
 simde_vld4q_u64(uint64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_u64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint64x2_private r_[4];
+    simde_x_vld4q_64_x86_(r_, ptr);
+    simde_uint64x2x4_t r = { {
+      simde_uint64x2_from_private(r_[0]),
+      simde_uint64x2_from_private(r_[1]),
+      simde_uint64x2_from_private(r_[2]),
+      simde_uint64x2_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_uint64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -790,6 +1021,16 @@ simde_poly8x16x4_t
 simde_vld4q_p8(simde_poly8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_p8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_poly8x16_private r_[4];
+    simde_x_vld4q_8_x86_(r_, ptr);
+    simde_poly8x16x4_t r = { {
+      simde_poly8x16_from_private(r_[0]),
+      simde_poly8x16_from_private(r_[1]),
+      simde_poly8x16_from_private(r_[2]),
+      simde_poly8x16_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_poly8x16_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -818,6 +1059,16 @@ simde_poly16x8x4_t
 simde_vld4q_p16(simde_poly16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_p16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_poly16x8_private r_[4];
+    simde_x_vld4q_16_x86_(r_, ptr);
+    simde_poly16x8x4_t r = { {
+      simde_poly16x8_from_private(r_[0]),
+      simde_poly16x8_from_private(r_[1]),
+      simde_poly16x8_from_private(r_[2]),
+      simde_poly16x8_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_poly16x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -846,6 +1097,16 @@ simde_poly64x2x4_t
 simde_vld4q_p64(simde_poly64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_p64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_poly64x2_private r_[4];
+    simde_x_vld4q_64_x86_(r_, ptr);
+    simde_poly64x2x4_t r = { {
+      simde_poly64x2_from_private(r_[0]),
+      simde_poly64x2_from_private(r_[1]),
+      simde_poly64x2_from_private(r_[2]),
+      simde_poly64x2_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_poly64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -894,6 +1155,16 @@ simde_bfloat16x8x4_t
 simde_vld4q_bf16(simde_bfloat16 const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
     return vld4q_bf16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_bfloat16x8_private r_[4];
+    simde_x_vld4q_16_x86_(r_, ptr);
+    simde_bfloat16x8x4_t r = { {
+      simde_bfloat16x8_from_private(r_[0]),
+      simde_bfloat16x8_from_private(r_[1]),
+      simde_bfloat16x8_from_private(r_[2]),
+      simde_bfloat16x8_from_private(r_[3])
+    } };
+    return r;
   #else
     simde_bfloat16x8_private a_[4];
     for (size_t i = 0; i < (sizeof(simde_bfloat16x8_t) / sizeof(*ptr)) * 4 ; i++) {
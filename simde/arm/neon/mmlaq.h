@@ -30,17 +30,47 @@
 #include "types.h"
 #include "cgt.h"
 #include "bsl.h"
+#include "dot.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* Each row of a is dotted against both rows of b, leaving two partial
+ * sums per output element; fold them into r in vmmlaq order. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vmmlaq_x86_fold_(__m128i r, __m128i row0, __m128i row1) {
+  const __m128
+    p0 = _mm_castsi128_ps(row0),
+    p1 = _mm_castsi128_ps(row1);
+  const __m128i
+    even = _mm_castps_si128(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0))),
+    odd = _mm_castps_si128(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1)));
+  return _mm_add_epi32(r, _mm_add_epi32(even, odd));
+}
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_int32x4_t
 simde_vmmlaq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b) {
   // I8MM is optional feature. src: https://patchwork.ffmpeg.org/project/ffmpeg/patch/20230530123043.52940-2-martin@martin.st/
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_MATMUL_INT8)
     return vmmlaq_s32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_int8x16_private
+      a_ = simde_int8x16_to_private(a),
+      b_ = simde_int8x16_to_private(b);
+    const __m128i zero = _mm_setzero_si128();
+    r_.m128i =
+      simde_x_vmmlaq_x86_fold_(
+        r_.m128i,
+        simde_x_vdotq_s32_x86_(zero, _mm_unpacklo_epi64(a_.m128i, a_.m128i), b_.m128i),
+        simde_x_vdotq_s32_x86_(zero, _mm_unpackhi_epi64(a_.m128i, a_.m128i), b_.m128i)
+      );
+    return simde_int32x4_from_private(r_);
   #else
     simde_int8x16_private
       a_ = simde_int8x16_to_private(a),
@@ -68,6 +98,19 @@ simde_uint32x4_t
 simde_vmmlaq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_MATMUL_INT8)
     return vmmlaq_u32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
+    simde_uint8x16_private
+      a_ = simde_uint8x16_to_private(a),
+      b_ = simde_uint8x16_to_private(b);
+    const __m128i zero = _mm_setzero_si128();
+    r_.m128i =
+      simde_x_vmmlaq_x86_fold_(
+        r_.m128i,
+        simde_x_vdotq_u32_x86_(zero, _mm_unpacklo_epi64(a_.m128i, a_.m128i), b_.m128i),
+        simde_x_vdotq_u32_x86_(zero, _mm_unpackhi_epi64(a_.m128i, a_.m128i), b_.m128i)
+      );
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint8x16_private
       a_ = simde_uint8x16_to_private(a),
@@ -95,6 +138,18 @@ simde_int32x4_t
 simde_vusmmlaq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_MATMUL_INT8)
     return vusmmlaq_s32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    const __m128i zero = _mm_setzero_si128();
+    r_.m128i =
+      simde_x_vmmlaq_x86_fold_(
+        r_.m128i,
+        simde_x_vusdotq_s32_x86_(zero, _mm_unpacklo_epi64(a_.m128i, a_.m128i), b_.m128i),
+        simde_x_vusdotq_s32_x86_(zero, _mm_unpackhi_epi64(a_.m128i, a_.m128i), b_.m128i)
+      );
+    return simde_int32x4_from_private(r_);
   #else
     simde_uint8x16_private
       a_ = simde_uint8x16_to_private(a);
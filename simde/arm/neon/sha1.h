@@ -28,6 +28,13 @@
 #define SIMDE_ARM_NEON_SHA1_H
 
 #include "types.h"
+#include "dup_n.h"
+#include "eor.h"
+#include "ext.h"
+#include "orr.h"
+#include "shl_n.h"
+#include "shr_n.h"
+#include "../../simde-sha.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -35,6 +42,41 @@ SIMDE_BEGIN_DECLS_
 
 #define ROL(operand, N, shift) (((operand) >> (N-shift)) | ((operand) << (shift)))
 
+/* SHA1RNDS4 keeps A and W0 in the high lane, adds the round constant
+ * itself and takes E pre-added to W0, so reverse the lanes and trade
+ * the caller's constant for that one. */
+#if defined(SIMDE_X86_SHA_NATIVE)
+  #define SIMDE_ARM_NEON_SHA1_X86_(hash_abcd, hash_e, wk, func) \
+    _mm_shuffle_epi32( \
+      _mm_sha1rnds4_epu32( \
+        _mm_shuffle_epi32((hash_abcd), 0x1b), \
+        _mm_add_epi32( \
+          _mm_shuffle_epi32((wk), 0x1b), \
+          _mm_set_epi32( \
+            HEDLEY_STATIC_CAST(int32_t, (hash_e) - simde_x_sha1_k[func]), \
+            HEDLEY_STATIC_CAST(int32_t, UINT32_C(0) - simde_x_sha1_k[func]), \
+            HEDLEY_STATIC_CAST(int32_t, UINT32_C(0) - simde_x_sha1_k[func]), \
+            HEDLEY_STATIC_CAST(int32_t, UINT32_C(0) - simde_x_sha1_k[func]))), \
+        (func)), \
+      0x1b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_x_vsha1q_u32_(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk, int f) {
+  simde_uint32x4_private
+    x_ = simde_uint32x4_to_private(hash_abcd),
+    w_ = simde_uint32x4_to_private(wk);
+  uint32_t abcd[4], w[4];
+
+  simde_memcpy(abcd, &x_, sizeof(abcd));
+  simde_memcpy(w, &w_, sizeof(w));
+  simde_x_sha1_rounds4_(abcd, hash_e, w, f);
+  simde_memcpy(&x_, abcd, sizeof(abcd));
+
+  return simde_uint32x4_from_private(x_);
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 uint32_t
 simde_vsha1h_u32(uint32_t a) {
@@ -54,24 +96,15 @@ simde_uint32x4_t
 simde_vsha1cq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha1cq_u32(hash_abcd, hash_e, wk);
-  #else
+  #elif defined(SIMDE_X86_SHA_NATIVE)
     simde_uint32x4_private
+      r_,
       x_ = simde_uint32x4_to_private(hash_abcd),
       w_ = simde_uint32x4_to_private(wk);
-    uint32_t y_ = hash_e;
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(x_.values) / sizeof(x_.values[0])) ; i++) {
-      uint32_t t = (((x_.values[2] ^ x_.values[3]) & x_.values[1]) ^ x_.values[3]);
-      y_ = y_ + ROL(x_.values[0], 32, 5) + t + w_.values[i];
-      x_.values[1] = ROL(x_.values[1], 32, 30);
-      uint32_t tmp = y_;
-      y_ = 0x0 | x_.values[3];
-      x_.values[3] = 0x0 | x_.values[2];
-      x_.values[2] = 0x0 | x_.values[1];
-      x_.values[1] = 0x0 | x_.values[0];
-      x_.values[0] = tmp | 0x0;
-    }
-    return simde_uint32x4_from_private(x_);
+    r_.m128i = SIMDE_ARM_NEON_SHA1_X86_(x_.m128i, hash_e, w_.m128i, 0);
+    return simde_uint32x4_from_private(r_);
+  #else
+    return simde_x_vsha1q_u32_(hash_abcd, hash_e, wk, 0);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -84,24 +117,15 @@ simde_uint32x4_t
 simde_vsha1mq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha1mq_u32(hash_abcd, hash_e, wk);
-  #else
+  #elif defined(SIMDE_X86_SHA_NATIVE)
     simde_uint32x4_private
+      r_,
       x_ = simde_uint32x4_to_private(hash_abcd),
       w_ = simde_uint32x4_to_private(wk);
-    uint32_t y_ = hash_e;
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(x_.values) / sizeof(x_.values[0])) ; i++) {
-      uint32_t t = ((x_.values[1] & x_.values[2]) | ((x_.values[1] | x_.values[2]) & x_.values[3]));
-      y_ = y_ + ROL(x_.values[0], 32, 5) + t + w_.values[i];
-      x_.values[1] = ROL(x_.values[1], 32, 30);
-      uint32_t tmp = y_;
-      y_ = 0x0 | x_.values[3];
-      x_.values[3] = 0x0 | x_.values[2];
-      x_.values[2] = 0x0 | x_.values[1];
-      x_.values[1] = 0x0 | x_.values[0];
-      x_.values[0] = tmp | 0x0;
-    }
-    return simde_uint32x4_from_private(x_);
+    r_.m128i = SIMDE_ARM_NEON_SHA1_X86_(x_.m128i, hash_e, w_.m128i, 2);
+    return simde_uint32x4_from_private(r_);
+  #else
+    return simde_x_vsha1q_u32_(hash_abcd, hash_e, wk, 2);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -114,24 +138,15 @@ simde_uint32x4_t
 simde_vsha1pq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha1pq_u32(hash_abcd, hash_e, wk);
-  #else
+  #elif defined(SIMDE_X86_SHA_NATIVE)
     simde_uint32x4_private
+      r_,
       x_ = simde_uint32x4_to_private(hash_abcd),
       w_ = simde_uint32x4_to_private(wk);
-    uint32_t y_ = hash_e;
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(x_.values) / sizeof(x_.values[0])) ; i++) {
-      uint32_t t = (x_.values[1] ^ x_.values[2] ^ x_.values[3]);
-      y_ = y_ + ROL(x_.values[0], 32, 5) + t + w_.values[i];
-      x_.values[1] = ROL(x_.values[1], 32, 30);
-      uint32_t tmp = y_;
-      y_ = 0x0 | x_.values[3];
-      x_.values[3] = 0x0 | x_.values[2];
-      x_.values[2] = 0x0 | x_.values[1];
-      x_.values[1] = 0x0 | x_.values[0];
-      x_.values[0] = tmp | 0x0;
-    }
-    return simde_uint32x4_from_private(x_);
+    r_.m128i = SIMDE_ARM_NEON_SHA1_X86_(x_.m128i, hash_e, w_.m128i, 1);
+    return simde_uint32x4_from_private(r_);
+  #else
+    return simde_x_vsha1q_u32_(hash_abcd, hash_e, wk, 1);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -145,20 +160,8 @@ simde_vsha1su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7, simde_uint32x4
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha1su0q_u32(w0_3, w4_7, w8_11);
   #else
-    simde_uint32x4_private
-      r_,
-      x_ = simde_uint32x4_to_private(w0_3),
-      y_ = simde_uint32x4_to_private(w4_7),
-      z_ = simde_uint32x4_to_private(w8_11);
-    r_.values[3] = y_.values[1];
-    r_.values[2] = y_.values[0];
-    r_.values[1] = x_.values[3];
-    r_.values[0] = x_.values[2];
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(x_.values) / sizeof(x_.values[0])) ; i++) {
-      r_.values[i] = r_.values[i] ^ x_.values[i] ^ z_.values[i];
-    }
-    return simde_uint32x4_from_private(r_);
+    /* Cheaper than SHA1MSG1, which would need every operand reversed. */
+    return simde_veorq_u32(simde_veorq_u32(w0_3, simde_vextq_u32(w0_3, w4_7, 2)), w8_11);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -171,22 +174,25 @@ simde_uint32x4_t
 simde_vsha1su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t tw12_15) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha1su1q_u32(tw0_3, tw12_15);
-  #else
+  #elif defined(SIMDE_X86_SHA_NATIVE)
     simde_uint32x4_private
       r_,
-      T_,
       x_ = simde_uint32x4_to_private(tw0_3),
       y_ = simde_uint32x4_to_private(tw12_15);
-    T_.values[0] = x_.values[0] ^ y_.values[1];
-    T_.values[1] = x_.values[1] ^ y_.values[2];
-    T_.values[2] = x_.values[2] ^ y_.values[3];
-    T_.values[3] = x_.values[3] ^ 0x0;
-    r_.values[0] = ROL(T_.values[0], 32, 1);
-    r_.values[1] = ROL(T_.values[1], 32, 1);
-    r_.values[2] = ROL(T_.values[2], 32, 1);
-    r_.values[3] = ROL(T_.values[3], 32, 1) ^ ROL(T_.values[0], 32, 2);
-
+    r_.m128i =
+      _mm_shuffle_epi32(
+        _mm_sha1msg2_epu32(_mm_shuffle_epi32(x_.m128i, 0x1b), _mm_shuffle_epi32(y_.m128i, 0x1b)),
+        0x1b);
     return simde_uint32x4_from_private(r_);
+  #else
+    /* The last word depends on the first result, so it gets a second
+     * pass; every other lane of that pass is zero. */
+    simde_uint32x4_t
+      zero = simde_vdupq_n_u32(0),
+      t = simde_veorq_u32(tw0_3, simde_vextq_u32(tw12_15, zero, 1)),
+      r = simde_vorrq_u32(simde_vshlq_n_u32(t, 1), simde_vshrq_n_u32(t, 31));
+    t = simde_vorrq_u32(simde_vshlq_n_u32(r, 1), simde_vshrq_n_u32(r, 31));
+    return simde_veorq_u32(r, simde_vextq_u32(zero, t, 1));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -195,6 +201,7 @@ simde_vsha1su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t tw12_15) {
 #endif
 
 #undef ROL
+#undef SIMDE_ARM_NEON_SHA1_X86_
 
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
@@ -28,71 +28,100 @@
 #define SIMDE_ARM_NEON_SHA256_H
 
 #include "types.h"
+#include "add.h"
+#include "dup_n.h"
+#include "eor.h"
+#include "ext.h"
+#include "shl_n.h"
+#include "shr_n.h"
+#include "../../simde-sha.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
-#define ROR32(operand, shift) (((operand) >> (shift)) | ((operand) << (32-shift)))
-#define ROL32(operand, shift) (((operand) >> (32-shift)) | ((operand) << (shift)))
-#define LSR(operand, shift) ((operand) >> (shift))
-#define LSL(operand, shift) ((operand) << (shift))
-
-static uint32_t simde_SHAchoose(uint32_t x, uint32_t y, uint32_t z) {
-  return (((y ^ z) & x) ^ z);
-}
-
-static uint32_t simde_SHAmajority(uint32_t x, uint32_t y, uint32_t z) {
-  return ((x & y) | ((x | y) & z));
+/* Four rounds on {A..H}; SHA256H returns the new ABCD and SHA256H2 the
+ * new EFGH. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_x_vsha256hq_u32_(simde_uint32x4_t hash_abcd, simde_uint32x4_t hash_efgh, simde_uint32x4_t wk, int part1) {
+  simde_uint32x4_private
+    x_ = simde_uint32x4_to_private(hash_abcd),
+    y_ = simde_uint32x4_to_private(hash_efgh),
+    w_ = simde_uint32x4_to_private(wk);
+  uint32_t s[8], w[4];
+
+  simde_memcpy(&(s[0]), &x_, sizeof(x_));
+  simde_memcpy(&(s[4]), &y_, sizeof(y_));
+  simde_memcpy(w, &w_, sizeof(w));
+  simde_x_sha256_rounds_(s, w, 4);
+  simde_memcpy(&x_, &(s[part1 ? 0 : 4]), sizeof(x_));
+
+  return simde_uint32x4_from_private(x_);
 }
 
-static uint32_t simde_SHAhashSIGMA0(uint32_t x) {
-  return ROR32(x, 2) ^ ROR32(x, 13) ^ ROR32(x, 22);
-}
+/* SHA256RNDS2 works on ABEF / CDGH halves and only does two rounds, so
+ * each Arm instruction is two of them plus the shuffles around them. */
+#if defined(SIMDE_X86_SHA_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  __m128
+  simde_x_vsha256hq_x86_(__m128i hash_abcd, __m128i hash_efgh, __m128i wk, int part1) {
+    __m128i
+      abef = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(hash_efgh), _mm_castsi128_ps(hash_abcd), 0x11)),
+      cdgh = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(hash_efgh), _mm_castsi128_ps(hash_abcd), 0xbb));
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0e));
+    if (part1)
+      return _mm_shuffle_ps(_mm_castsi128_ps(abef), _mm_castsi128_ps(cdgh), 0xbb);
+    else
+      return _mm_shuffle_ps(_mm_castsi128_ps(abef), _mm_castsi128_ps(cdgh), 0x11);
+  }
+#endif
 
-static uint32_t simde_SHAhashSIGMA1(uint32_t x) {
-  return ROR32(x, 6) ^ ROR32(x, 11) ^ ROR32(x, 25);
+/* sigma0(x) = ROTR7(x) ^ ROTR18(x) ^ SHR3(x) */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_x_vsha256_sigma0q_u32_(simde_uint32x4_t a) {
+  return
+    simde_veorq_u32(
+      simde_veorq_u32(
+        simde_veorq_u32(simde_vshrq_n_u32(a,  7), simde_vshrq_n_u32(a, 18)),
+        simde_veorq_u32(simde_vshlq_n_u32(a, 25), simde_vshlq_n_u32(a, 14))),
+      simde_vshrq_n_u32(a,  3));
 }
 
-static simde_uint32x4_t
-x_simde_sha256hash(simde_uint32x4_t x, simde_uint32x4_t y, simde_uint32x4_t w, int part1) {
-  uint32_t chs, maj, t;
-  simde_uint32x4_private
-    x_ = simde_uint32x4_to_private(x),
-    y_ = simde_uint32x4_to_private(y),
-    w_ = simde_uint32x4_to_private(w);
-
-  for(int i = 0; i < 4; ++i) {
-    chs = simde_SHAchoose(y_.values[0], y_.values[1], y_.values[2]);
-    maj = simde_SHAmajority(x_.values[0], x_.values[1], x_.values[2]);
-    t = y_.values[3] + simde_SHAhashSIGMA1(y_.values[0]) + chs + w_.values[i];
-    x_.values[3] = t + x_.values[3];
-    y_.values[3] = t + simde_SHAhashSIGMA0(x_.values[0]) + maj;
-    uint32_t tmp = y_.values[3];
-    y_.values[3] = 0x0 | y_.values[2];
-    y_.values[2] = 0x0 | y_.values[1];
-    y_.values[1] = 0x0 | y_.values[0];
-    y_.values[0] = 0x0 | x_.values[3];
-    x_.values[3] = 0x0 | x_.values[2];
-    x_.values[2] = 0x0 | x_.values[1];
-    x_.values[1] = 0x0 | x_.values[0];
-    x_.values[0] = tmp | 0x0;
-  }
-  return (part1 == 1) ? simde_uint32x4_from_private(x_) : simde_uint32x4_from_private(y_);
+/* sigma1(x) = ROTR17(x) ^ ROTR19(x) ^ SHR10(x) */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_x_vsha256_sigma1q_u32_(simde_uint32x4_t a) {
+  return
+    simde_veorq_u32(
+      simde_veorq_u32(
+        simde_veorq_u32(simde_vshrq_n_u32(a, 17), simde_vshrq_n_u32(a, 19)),
+        simde_veorq_u32(simde_vshlq_n_u32(a, 15), simde_vshlq_n_u32(a, 13))),
+      simde_vshrq_n_u32(a, 10));
 }
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde_uint32x4_t
-simde_vsha256hq_u32(simde_uint32x4_t hash_efgh, simde_uint32x4_t hash_abcd, simde_uint32x4_t wk) {
+simde_vsha256hq_u32(simde_uint32x4_t hash_abcd, simde_uint32x4_t hash_efgh, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
-    return vsha256hq_u32(hash_efgh, hash_abcd, wk);
+    return vsha256hq_u32(hash_abcd, hash_efgh, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(hash_abcd),
+      y_ = simde_uint32x4_to_private(hash_efgh),
+      w_ = simde_uint32x4_to_private(wk);
+    r_.m128i = _mm_castps_si128(simde_x_vsha256hq_x86_(x_.m128i, y_.m128i, w_.m128i, 1));
+    return simde_uint32x4_from_private(r_);
   #else
-    return x_simde_sha256hash(hash_efgh, hash_abcd, wk, 1);
+    return simde_x_vsha256hq_u32_(hash_abcd, hash_efgh, wk, 1);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
   #undef vsha256hq_u32
-  #define vsha256hq_u32(hash_efgh, hash_abcd, wk) simde_vsha256hq_u32((hash_efgh), (hash_abcd), (wk))
+  #define vsha256hq_u32(hash_abcd, hash_efgh, wk) simde_vsha256hq_u32((hash_abcd), (hash_efgh), (wk))
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -100,8 +129,16 @@ simde_uint32x4_t
 simde_vsha256h2q_u32(simde_uint32x4_t hash_efgh, simde_uint32x4_t hash_abcd, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha256h2q_u32(hash_efgh, hash_abcd, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(hash_abcd),
+      y_ = simde_uint32x4_to_private(hash_efgh),
+      w_ = simde_uint32x4_to_private(wk);
+    r_.m128i = _mm_castps_si128(simde_x_vsha256hq_x86_(x_.m128i, y_.m128i, w_.m128i, 0));
+    return simde_uint32x4_from_private(r_);
   #else
-    return x_simde_sha256hash(hash_abcd, hash_efgh, wk, 0);
+    return simde_x_vsha256hq_u32_(hash_abcd, hash_efgh, wk, 0);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -114,24 +151,15 @@ simde_uint32x4_t
 simde_vsha256su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha256su0q_u32(w0_3, w4_7);
-  #else
+  #elif defined(SIMDE_X86_SHA_NATIVE)
     simde_uint32x4_private
       r_,
-      T_,
       x_ = simde_uint32x4_to_private(w0_3),
       y_ = simde_uint32x4_to_private(w4_7);
-    T_.values[3] = y_.values[0];
-    T_.values[2] = x_.values[3];
-    T_.values[1] = x_.values[2];
-    T_.values[0] = x_.values[1];
-    uint32_t elt;
-    for(int i = 0; i < 4; ++i) {
-      elt = T_.values[i];
-      elt = ROR32(elt, 7) ^ ROR32(elt, 18) ^ LSR(elt, 3);
-      r_.values[i] = elt + x_.values[i];
-    }
+    r_.m128i = _mm_sha256msg1_epu32(x_.m128i, y_.m128i);
     return simde_uint32x4_from_private(r_);
-
+  #else
+    return simde_vaddq_u32(w0_3, simde_x_vsha256_sigma0q_u32_(simde_vextq_u32(w0_3, w4_7, 1)));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -144,37 +172,26 @@ simde_uint32x4_t
 simde_vsha256su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w8_11, simde_uint32x4_t w12_15) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
     return vsha256su1q_u32(tw0_3, w8_11, w12_15);
-  #else
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    /* SHA256MSG2 leaves the W[t-7] term to the caller. */
     simde_uint32x4_private
       r_,
-      T0_,
       x_ = simde_uint32x4_to_private(tw0_3),
       y_ = simde_uint32x4_to_private(w8_11),
       z_ = simde_uint32x4_to_private(w12_15);
-    simde_uint32x2_private T1_;
-    T0_.values[3] = z_.values[0];
-    T0_.values[2] = y_.values[3];
-    T0_.values[1] = y_.values[2];
-    T0_.values[0] = y_.values[1];
-    uint32_t elt;
-    T1_.values[1] = z_.values[3];
-    T1_.values[0] = z_.values[2];
-    for(int i = 0; i < 2; ++i) {
-      elt = T1_.values[i];
-      elt = ROR32(elt, 17) ^ ROR32(elt, 19) ^ LSR(elt, 10);
-      elt = elt + x_.values[i] + T0_.values[i];
-      r_.values[i] = elt;
-    }
-    T1_.values[1] = r_.values[1];
-    T1_.values[0] = r_.values[0];
-    for(int i = 2; i < 4; ++i) {
-      elt = T1_.values[i-2];
-      elt = ROR32(elt, 17) ^ ROR32(elt, 19) ^ LSR(elt, 10);
-      elt = elt + x_.values[i] + T0_.values[i];
-      r_.values[i] = elt;
-    }
+    r_.m128i =
+      _mm_sha256msg2_epu32(
+        _mm_add_epi32(x_.m128i, _mm_or_si128(_mm_srli_si128(y_.m128i, 4), _mm_slli_si128(z_.m128i, 12))),
+        z_.m128i);
     return simde_uint32x4_from_private(r_);
-
+  #else
+    /* sigma1 of zero is zero, so the two dependent halves can each be
+     * computed on the whole vector. */
+    simde_uint32x4_t
+      zero = simde_vdupq_n_u32(0),
+      r = simde_vaddq_u32(tw0_3, simde_vextq_u32(w8_11, w12_15, 1));
+    r = simde_vaddq_u32(r, simde_x_vsha256_sigma1q_u32_(simde_vextq_u32(w12_15, zero, 2)));
+    return simde_vaddq_u32(r, simde_x_vsha256_sigma1q_u32_(simde_vextq_u32(zero, r, 2)));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -182,11 +199,6 @@ simde_vsha256su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w8_11, simde_uint
   #define vsha256su1q_u32(tw0_3, w8_11, w12_15) simde_vsha256su1q_u32((tw0_3), (w8_11), (w12_15))
 #endif
 
-#undef ROR32
-#undef ROL32
-#undef LSR
-#undef LSL
-
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -37,6 +37,119 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* x86 interleaving for the 128-bit forms; the inverse of the helpers
+ * in ld3.h.  v is the caller's array of three private unions. */
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst3q_8_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+    __m128i
+      a = _mm_loadu_si128(s    ),
+      b = _mm_loadu_si128(s + 1),
+      c = _mm_loadu_si128(s + 2);
+
+    _mm_storeu_si128(p + 0,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1))));
+
+    _mm_storeu_si128(p + 1,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1))));
+
+    _mm_storeu_si128(p + 2,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15))));
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst3q_16_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+    __m128i
+      a = _mm_loadu_si128(s    ),
+      b = _mm_loadu_si128(s + 1),
+      c = _mm_loadu_si128(s + 2);
+
+    _mm_storeu_si128(p + 0,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1))));
+
+    _mm_storeu_si128(p + 1,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(-1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1, 10, 11)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(4, 5, -1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1))));
+
+    _mm_storeu_si128(p + 2,
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a, _mm_setr_epi8(-1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(b, _mm_setr_epi8(10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1))),
+        _mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15))));
+  }
+#endif
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst3q_32_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+    __m128
+      x = _mm_castsi128_ps(_mm_loadu_si128(s    )),
+      y = _mm_castsi128_ps(_mm_loadu_si128(s + 1)),
+      z = _mm_castsi128_ps(_mm_loadu_si128(s + 2));
+
+    /* {x0, y0, z0, x1}, {y1, z1, x2, y2}, {z2, x3, y3, z3} */
+    _mm_storeu_si128(p + 0, _mm_castps_si128(
+      _mm_shuffle_ps(
+        _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)),
+        _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)),
+        _MM_SHUFFLE(2, 0, 2, 0))));
+    _mm_storeu_si128(p + 1, _mm_castps_si128(
+      _mm_shuffle_ps(
+        _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)),
+        _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)),
+        _MM_SHUFFLE(2, 0, 2, 0))));
+    _mm_storeu_si128(p + 2, _mm_castps_si128(
+      _mm_shuffle_ps(
+        _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)),
+        _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)),
+        _MM_SHUFFLE(2, 0, 2, 0))));
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst3q_64_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+    __m128i
+      x = _mm_loadu_si128(s    ),
+      y = _mm_loadu_si128(s + 1),
+      z = _mm_loadu_si128(s + 2);
+
+    _mm_storeu_si128(p + 0, _mm_unpacklo_epi64(x, y));
+    _mm_storeu_si128(p + 1, _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(z), _mm_castsi128_pd(x), 2)));
+    _mm_storeu_si128(p + 2, _mm_unpackhi_epi64(y, z));
+  }
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -450,6 +563,13 @@ void
 simde_vst3q_f16(simde_float16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_float16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
     vst3q_f16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_float16x8_private a_[3] = {
+      simde_float16x8_to_private(val.val[0]),
+      simde_float16x8_to_private(val.val[1]),
+      simde_float16x8_to_private(val.val[2])
+    };
+    simde_x_vst3q_16_x86_(ptr, a_);
   #else
     simde_float16x8_private a_[3] = { simde_float16x8_to_private(val.val[0]),
                                       simde_float16x8_to_private(val.val[1]),
@@ -479,6 +599,13 @@ void
 simde_vst3q_f32(simde_float32_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_float32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4_private a_[3] = {
+      simde_float32x4_to_private(val.val[0]),
+      simde_float32x4_to_private(val.val[1]),
+      simde_float32x4_to_private(val.val[2])
+    };
+    simde_x_vst3q_32_x86_(ptr, a_);
   #else
     simde_float32x4_private a_[3] = { simde_float32x4_to_private(val.val[0]),
                                       simde_float32x4_to_private(val.val[1]),
@@ -526,6 +653,13 @@ void
 simde_vst3q_f64(simde_float64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_float64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2_private a_[3] = {
+      simde_float64x2_to_private(val.val[0]),
+      simde_float64x2_to_private(val.val[1]),
+      simde_float64x2_to_private(val.val[2])
+    };
+    simde_x_vst3q_64_x86_(ptr, a_);
   #else
     simde_float64x2_private a[3] = { simde_float64x2_to_private(val.val[0]),
                                       simde_float64x2_to_private(val.val[1]),
@@ -562,6 +696,13 @@ void
 simde_vst3q_s8(int8_t ptr[HEDLEY_ARRAY_PARAM(48)], simde_int8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int8x16_private a_[3] = {
+      simde_int8x16_to_private(val.val[0]),
+      simde_int8x16_to_private(val.val[1]),
+      simde_int8x16_to_private(val.val[2])
+    };
+    simde_x_vst3q_8_x86_(ptr, a_);
   #else
     simde_int8x16_private a_[3] = { simde_int8x16_to_private(val.val[0]),
                                     simde_int8x16_to_private(val.val[1]),
@@ -614,6 +755,13 @@ void
 simde_vst3q_s16(int16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_int16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_int16x8_private a_[3] = {
+      simde_int16x8_to_private(val.val[0]),
+      simde_int16x8_to_private(val.val[1]),
+      simde_int16x8_to_private(val.val[2])
+    };
+    simde_x_vst3q_16_x86_(ptr, a_);
   #else
     simde_int16x8_private a_[3] = { simde_int16x8_to_private(val.val[0]),
                                     simde_int16x8_to_private(val.val[1]),
@@ -661,6 +809,13 @@ void
 simde_vst3q_s32(int32_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_int32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private a_[3] = {
+      simde_int32x4_to_private(val.val[0]),
+      simde_int32x4_to_private(val.val[1]),
+      simde_int32x4_to_private(val.val[2])
+    };
+    simde_x_vst3q_32_x86_(ptr, a_);
   #else
     simde_int32x4_private a_[3] = { simde_int32x4_to_private(val.val[0]),
                                     simde_int32x4_to_private(val.val[1]),
@@ -708,6 +863,13 @@ void
 simde_vst3q_s64(int64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_int64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2_private a_[3] = {
+      simde_int64x2_to_private(val.val[0]),
+      simde_int64x2_to_private(val.val[1]),
+      simde_int64x2_to_private(val.val[2])
+    };
+    simde_x_vst3q_64_x86_(ptr, a_);
   #else
     simde_int64x2_private a[3] = { simde_int64x2_to_private(val.val[0]),
                                     simde_int64x2_to_private(val.val[1]),
@@ -745,6 +907,13 @@ void
 simde_vst3q_u8(uint8_t ptr[HEDLEY_ARRAY_PARAM(48)], simde_uint8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_uint8x16_private a_[3] = {
+      simde_uint8x16_to_private(val.val[0]),
+      simde_uint8x16_to_private(val.val[1]),
+      simde_uint8x16_to_private(val.val[2])
+    };
+    simde_x_vst3q_8_x86_(ptr, a_);
   #else
     simde_uint8x16_private a_[3] = {simde_uint8x16_to_private(val.val[0]),
                                     simde_uint8x16_to_private(val.val[1]),
@@ -828,6 +997,13 @@ void
 simde_vst3q_u16(uint16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_uint16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_uint16x8_private a_[3] = {
+      simde_uint16x8_to_private(val.val[0]),
+      simde_uint16x8_to_private(val.val[1]),
+      simde_uint16x8_to_private(val.val[2])
+    };
+    simde_x_vst3q_16_x86_(ptr, a_);
   #else
     simde_uint16x8_private a_[3] = { simde_uint16x8_to_private(val.val[0]),
                                      simde_uint16x8_to_private(val.val[1]),
@@ -876,6 +1052,13 @@ void
 simde_vst3q_u32(uint32_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_uint32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private a_[3] = {
+      simde_uint32x4_to_private(val.val[0]),
+      simde_uint32x4_to_private(val.val[1]),
+      simde_uint32x4_to_private(val.val[2])
+    };
+    simde_x_vst3q_32_x86_(ptr, a_);
   #else
     simde_uint32x4_private a_[3] = { simde_uint32x4_to_private(val.val[0]),
                                      simde_uint32x4_to_private(val.val[1]),
@@ -924,6 +1107,13 @@ void
 simde_vst3q_u64(uint64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_uint64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint64x2_private a_[3] = {
+      simde_uint64x2_to_private(val.val[0]),
+      simde_uint64x2_to_private(val.val[1]),
+      simde_uint64x2_to_private(val.val[2])
+    };
+    simde_x_vst3q_64_x86_(ptr, a_);
   #else
     simde_uint64x2_private a[3] = { simde_uint64x2_to_private(val.val[0]),
                                      simde_uint64x2_to_private(val.val[1]),
@@ -1045,6 +1235,13 @@ void
 simde_vst3q_p8(simde_poly8_t ptr[HEDLEY_ARRAY_PARAM(48)], simde_poly8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
     vst3q_p8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_poly8x16_private a_[3] = {
+      simde_poly8x16_to_private(val.val[0]),
+      simde_poly8x16_to_private(val.val[1]),
+      simde_poly8x16_to_private(val.val[2])
+    };
+    simde_x_vst3q_8_x86_(ptr, a_);
   #else
     simde_poly8x16_private a_[3] = {simde_poly8x16_to_private(val.val[0]),
                                     simde_poly8x16_to_private(val.val[1]),
@@ -1074,6 +1271,13 @@ void
 simde_vst3q_p16(simde_poly16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_poly16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_p16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_poly16x8_private a_[3] = {
+      simde_poly16x8_to_private(val.val[0]),
+      simde_poly16x8_to_private(val.val[1]),
+      simde_poly16x8_to_private(val.val[2])
+    };
+    simde_x_vst3q_16_x86_(ptr, a_);
   #else
     simde_poly16x8_private a_[3] = { simde_poly16x8_to_private(val.val[0]),
                                      simde_poly16x8_to_private(val.val[1]),
@@ -1104,6 +1308,13 @@ void
 simde_vst3q_p64(simde_poly64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_poly64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_p64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_poly64x2_private a_[3] = {
+      simde_poly64x2_to_private(val.val[0]),
+      simde_poly64x2_to_private(val.val[1]),
+      simde_poly64x2_to_private(val.val[2])
+    };
+    simde_x_vst3q_64_x86_(ptr, a_);
   #else
     simde_poly64x2_private a_[3] = { simde_poly64x2_to_private(val.val[0]),
                                      simde_poly64x2_to_private(val.val[1]),
@@ -1154,6 +1365,13 @@ void
 simde_vst3q_bf16(simde_bfloat16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_bfloat16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
     vst3q_bf16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_bfloat16x8_private a_[3] = {
+      simde_bfloat16x8_to_private(val.val[0]),
+      simde_bfloat16x8_to_private(val.val[1]),
+      simde_bfloat16x8_to_private(val.val[2])
+    };
+    simde_x_vst3q_16_x86_(ptr, a_);
   #else
     simde_bfloat16x8_private a_[3] = { simde_bfloat16x8_to_private(val.val[0]),
                                       simde_bfloat16x8_to_private(val.val[1]),
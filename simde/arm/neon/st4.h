@@ -36,6 +36,99 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* x86 interleaving for the 128-bit forms; v is the caller's array of
+ * four private unions.  Two rounds of unpacks (pairs of channels, then
+ * pairs of pairs) produce the interleaved data directly. */
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst4q_pairs_x86_(void* ptr, __m128i xy_lo, __m128i xy_hi, __m128i zw_lo, __m128i zw_hi, int bits) {
+    __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+
+    if (bits == 8) {
+      _mm_storeu_si128(p + 0, _mm_unpacklo_epi16(xy_lo, zw_lo));
+      _mm_storeu_si128(p + 1, _mm_unpackhi_epi16(xy_lo, zw_lo));
+      _mm_storeu_si128(p + 2, _mm_unpacklo_epi16(xy_hi, zw_hi));
+      _mm_storeu_si128(p + 3, _mm_unpackhi_epi16(xy_hi, zw_hi));
+    } else if (bits == 16) {
+      _mm_storeu_si128(p + 0, _mm_unpacklo_epi32(xy_lo, zw_lo));
+      _mm_storeu_si128(p + 1, _mm_unpackhi_epi32(xy_lo, zw_lo));
+      _mm_storeu_si128(p + 2, _mm_unpacklo_epi32(xy_hi, zw_hi));
+      _mm_storeu_si128(p + 3, _mm_unpackhi_epi32(xy_hi, zw_hi));
+    } else {
+      _mm_storeu_si128(p + 0, _mm_unpacklo_epi64(xy_lo, zw_lo));
+      _mm_storeu_si128(p + 1, _mm_unpackhi_epi64(xy_lo, zw_lo));
+      _mm_storeu_si128(p + 2, _mm_unpacklo_epi64(xy_hi, zw_hi));
+      _mm_storeu_si128(p + 3, _mm_unpackhi_epi64(xy_hi, zw_hi));
+    }
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst4q_8_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i
+      x = _mm_loadu_si128(s    ),
+      y = _mm_loadu_si128(s + 1),
+      z = _mm_loadu_si128(s + 2),
+      w = _mm_loadu_si128(s + 3);
+
+    simde_x_vst4q_pairs_x86_(ptr,
+      _mm_unpacklo_epi8(x, y), _mm_unpackhi_epi8(x, y),
+      _mm_unpacklo_epi8(z, w), _mm_unpackhi_epi8(z, w),
+      8);
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst4q_16_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i
+      x = _mm_loadu_si128(s    ),
+      y = _mm_loadu_si128(s + 1),
+      z = _mm_loadu_si128(s + 2),
+      w = _mm_loadu_si128(s + 3);
+
+    simde_x_vst4q_pairs_x86_(ptr,
+      _mm_unpacklo_epi16(x, y), _mm_unpackhi_epi16(x, y),
+      _mm_unpacklo_epi16(z, w), _mm_unpackhi_epi16(z, w),
+      16);
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst4q_32_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i
+      x = _mm_loadu_si128(s    ),
+      y = _mm_loadu_si128(s + 1),
+      z = _mm_loadu_si128(s + 2),
+      w = _mm_loadu_si128(s + 3);
+
+    simde_x_vst4q_pairs_x86_(ptr,
+      _mm_unpacklo_epi32(x, y), _mm_unpackhi_epi32(x, y),
+      _mm_unpacklo_epi32(z, w), _mm_unpackhi_epi32(z, w),
+      32);
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_vst4q_64_x86_(void* ptr, const void* v) {
+    const __m128i* s = HEDLEY_REINTERPRET_CAST(const __m128i*, v);
+    __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+    __m128i
+      x = _mm_loadu_si128(s    ),
+      y = _mm_loadu_si128(s + 1),
+      z = _mm_loadu_si128(s + 2),
+      w = _mm_loadu_si128(s + 3);
+
+    _mm_storeu_si128(p + 0, _mm_unpacklo_epi64(x, y));
+    _mm_storeu_si128(p + 1, _mm_unpacklo_epi64(z, w));
+    _mm_storeu_si128(p + 2, _mm_unpackhi_epi64(x, y));
+    _mm_storeu_si128(p + 3, _mm_unpackhi_epi64(z, w));
+  }
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -362,6 +455,14 @@ void
 simde_vst4q_f16(simde_float16_t *ptr, simde_float16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
     vst4q_f16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float16x8_private a_[4] = {
+      simde_float16x8_to_private(val.val[0]),
+      simde_float16x8_to_private(val.val[1]),
+      simde_float16x8_to_private(val.val[2]),
+      simde_float16x8_to_private(val.val[3])
+    };
+    simde_x_vst4q_16_x86_(ptr, a_);
   #else
     simde_float16x8_private a_[4] = { simde_float16x8_to_private(val.val[0]), simde_float16x8_to_private(val.val[1]),
                                       simde_float16x8_to_private(val.val[2]), simde_float16x8_to_private(val.val[3]) };
@@ -391,6 +492,14 @@ void
 simde_vst4q_f32(simde_float32_t *ptr, simde_float32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float32x4_private a_[4] = {
+      simde_float32x4_to_private(val.val[0]),
+      simde_float32x4_to_private(val.val[1]),
+      simde_float32x4_to_private(val.val[2]),
+      simde_float32x4_to_private(val.val[3])
+    };
+    simde_x_vst4q_32_x86_(ptr, a_);
   #else
     simde_float32x4_private a_[4] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]),
                                       simde_float32x4_to_private(val.val[2]), simde_float32x4_to_private(val.val[3]) };
@@ -420,6 +529,14 @@ void
 simde_vst4q_f64(simde_float64_t *ptr, simde_float64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_float64x2_private a_[4] = {
+      simde_float64x2_to_private(val.val[0]),
+      simde_float64x2_to_private(val.val[1]),
+      simde_float64x2_to_private(val.val[2]),
+      simde_float64x2_to_private(val.val[3])
+    };
+    simde_x_vst4q_64_x86_(ptr, a_);
   #else
     simde_float64x2_private a_[4] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]),
                                       simde_float64x2_to_private(val.val[2]), simde_float64x2_to_private(val.val[3]) };
@@ -449,6 +566,14 @@ void
 simde_vst4q_s8(int8_t *ptr, simde_int8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x16_private a_[4] = {
+      simde_int8x16_to_private(val.val[0]),
+      simde_int8x16_to_private(val.val[1]),
+      simde_int8x16_to_private(val.val[2]),
+      simde_int8x16_to_private(val.val[3])
+    };
+    simde_x_vst4q_8_x86_(ptr, a_);
   #else
     simde_int8x16_private a_[4] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]),
                                     simde_int8x16_to_private(val.val[2]), simde_int8x16_to_private(val.val[3]) };
@@ -478,6 +603,14 @@ void
 simde_vst4q_s16(int16_t *ptr, simde_int16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int16x8_private a_[4] = {
+      simde_int16x8_to_private(val.val[0]),
+      simde_int16x8_to_private(val.val[1]),
+      simde_int16x8_to_private(val.val[2]),
+      simde_int16x8_to_private(val.val[3])
+    };
+    simde_x_vst4q_16_x86_(ptr, a_);
   #else
     simde_int16x8_private a_[4] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]),
                                     simde_int16x8_to_private(val.val[2]), simde_int16x8_to_private(val.val[3]) };
@@ -507,6 +640,14 @@ void
 simde_vst4q_s32(int32_t *ptr, simde_int32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private a_[4] = {
+      simde_int32x4_to_private(val.val[0]),
+      simde_int32x4_to_private(val.val[1]),
+      simde_int32x4_to_private(val.val[2]),
+      simde_int32x4_to_private(val.val[3])
+    };
+    simde_x_vst4q_32_x86_(ptr, a_);
   #else
     simde_int32x4_private a_[4] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]),
                                     simde_int32x4_to_private(val.val[2]), simde_int32x4_to_private(val.val[3]) };
@@ -536,6 +677,14 @@ void
 simde_vst4q_s64(int64_t *ptr, simde_int64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int64x2_private a_[4] = {
+      simde_int64x2_to_private(val.val[0]),
+      simde_int64x2_to_private(val.val[1]),
+      simde_int64x2_to_private(val.val[2]),
+      simde_int64x2_to_private(val.val[3])
+    };
+    simde_x_vst4q_64_x86_(ptr, a_);
   #else
     simde_int64x2_private a_[4] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]),
                                     simde_int64x2_to_private(val.val[2]), simde_int64x2_to_private(val.val[3]) };
@@ -566,6 +715,14 @@ void
 simde_vst4q_u8(uint8_t *ptr, simde_uint8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint8x16_private a_[4] = {
+      simde_uint8x16_to_private(val.val[0]),
+      simde_uint8x16_to_private(val.val[1]),
+      simde_uint8x16_to_private(val.val[2]),
+      simde_uint8x16_to_private(val.val[3])
+    };
+    simde_x_vst4q_8_x86_(ptr, a_);
   #else
     simde_uint8x16_private a_[4] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]),
                                      simde_uint8x16_to_private(val.val[2]), simde_uint8x16_to_private(val.val[3]) };
@@ -595,6 +752,14 @@ void
 simde_vst4q_u16(uint16_t *ptr, simde_uint16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint16x8_private a_[4] = {
+      simde_uint16x8_to_private(val.val[0]),
+      simde_uint16x8_to_private(val.val[1]),
+      simde_uint16x8_to_private(val.val[2]),
+      simde_uint16x8_to_private(val.val[3])
+    };
+    simde_x_vst4q_16_x86_(ptr, a_);
   #else
     simde_uint16x8_private a_[4] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]),
                                      simde_uint16x8_to_private(val.val[2]), simde_uint16x8_to_private(val.val[3]) };
@@ -624,6 +789,14 @@ void
 simde_vst4q_u32(uint32_t *ptr, simde_uint32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private a_[4] = {
+      simde_uint32x4_to_private(val.val[0]),
+      simde_uint32x4_to_private(val.val[1]),
+      simde_uint32x4_to_private(val.val[2]),
+      simde_uint32x4_to_private(val.val[3])
+    };
+    simde_x_vst4q_32_x86_(ptr, a_);
   #else
     simde_uint32x4_private a_[4] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]),
                                      simde_uint32x4_to_private(val.val[2]), simde_uint32x4_to_private(val.val[3]) };
@@ -653,6 +826,14 @@ void
 simde_vst4q_u64(uint64_t *ptr, simde_uint64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint64x2_private a_[4] = {
+      simde_uint64x2_to_private(val.val[0]),
+      simde_uint64x2_to_private(val.val[1]),
+      simde_uint64x2_to_private(val.val[2]),
+      simde_uint64x2_to_private(val.val[3])
+    };
+    simde_x_vst4q_64_x86_(ptr, a_);
   #else
     simde_uint64x2_private a_[4] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]),
                                      simde_uint64x2_to_private(val.val[2]), simde_uint64x2_to_private(val.val[3]) };
@@ -769,6 +950,14 @@ void
 simde_vst4q_p8(simde_poly8_t *ptr, simde_poly8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_p8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_poly8x16_private a_[4] = {
+      simde_poly8x16_to_private(val.val[0]),
+      simde_poly8x16_to_private(val.val[1]),
+      simde_poly8x16_to_private(val.val[2]),
+      simde_poly8x16_to_private(val.val[3])
+    };
+    simde_x_vst4q_8_x86_(ptr, a_);
   #else
     simde_poly8x16_private a_[4] = { simde_poly8x16_to_private(val.val[0]), simde_poly8x16_to_private(val.val[1]),
                                      simde_poly8x16_to_private(val.val[2]), simde_poly8x16_to_private(val.val[3]) };
@@ -798,6 +987,14 @@ void
 simde_vst4q_p16(simde_poly16_t *ptr, simde_poly16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_p16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_poly16x8_private a_[4] = {
+      simde_poly16x8_to_private(val.val[0]),
+      simde_poly16x8_to_private(val.val[1]),
+      simde_poly16x8_to_private(val.val[2]),
+      simde_poly16x8_to_private(val.val[3])
+    };
+    simde_x_vst4q_16_x86_(ptr, a_);
   #else
     simde_poly16x8_private a_[4] = { simde_poly16x8_to_private(val.val[0]), simde_poly16x8_to_private(val.val[1]),
                                      simde_poly16x8_to_private(val.val[2]), simde_poly16x8_to_private(val.val[3]) };
@@ -827,6 +1024,14 @@ void
 simde_vst4q_p64(simde_poly64_t *ptr, simde_poly64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_p64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_poly64x2_private a_[4] = {
+      simde_poly64x2_to_private(val.val[0]),
+      simde_poly64x2_to_private(val.val[1]),
+      simde_poly64x2_to_private(val.val[2]),
+      simde_poly64x2_to_private(val.val[3])
+    };
+    simde_x_vst4q_64_x86_(ptr, a_);
   #else
     simde_poly64x2_private a_[4] = { simde_poly64x2_to_private(val.val[0]), simde_poly64x2_to_private(val.val[1]),
                                      simde_poly64x2_to_private(val.val[2]), simde_poly64x2_to_private(val.val[3]) };
@@ -876,6 +1081,14 @@ void
 simde_vst4q_bf16(simde_bfloat16_t *ptr, simde_bfloat16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
     vst4q_bf16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_bfloat16x8_private a_[4] = {
+      simde_bfloat16x8_to_private(val.val[0]),
+      simde_bfloat16x8_to_private(val.val[1]),
+      simde_bfloat16x8_to_private(val.val[2]),
+      simde_bfloat16x8_to_private(val.val[3])
+    };
+    simde_x_vst4q_16_x86_(ptr, a_);
   #else
     simde_bfloat16x8_private a_[4] = { simde_bfloat16x8_to_private(val.val[0]), simde_bfloat16x8_to_private(val.val[1]),
                                       simde_bfloat16x8_to_private(val.val[2]), simde_bfloat16x8_to_private(val.val[3]) };
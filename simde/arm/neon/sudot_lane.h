@@ -28,6 +28,7 @@
 #define SIMDE_ARM_NEON_SUDOT_LANE_H
 
 #include "types.h"
+#include "dot.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -40,18 +41,22 @@ simde_vsudot_lane_s32(simde_int32x2_t r, simde_int8x8_t a, simde_uint8x8_t b, co
   simde_int32x2_t result;
   simde_int32x2_private r_ = simde_int32x2_to_private(r);
   simde_int8x8_private a_ = simde_int8x8_to_private(a);
-  simde_uint8x8_private b_ = simde_uint8x8_to_private(b);
-
-  for (int i = 0 ; i < 2 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for (int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    r_.m64 = _mm_movepi64_pi64(simde_x_vusdotq_s32_x86_(_mm_movpi64_epi64(r_.m64), simde_x_vdot_lane_x86_(&b, lane), _mm_movpi64_epi64(a_.m64)));
+  #else
+    simde_uint8x8_private b_ = simde_uint8x8_to_private(b);
+
+    for (int i = 0 ; i < 2 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for (int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
+  #endif
 
   result = simde_int32x2_from_private(r_);
 
@@ -72,18 +77,22 @@ simde_vsudot_laneq_s32(simde_int32x2_t r, simde_int8x8_t a, simde_uint8x16_t b,
   simde_int32x2_t result;
   simde_int32x2_private r_ = simde_int32x2_to_private(r);
   simde_int8x8_private a_ = simde_int8x8_to_private(a);
-  simde_uint8x16_private b_ = simde_uint8x16_to_private(b);
-
-  for (int i = 0 ; i < 2 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for (int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    r_.m64 = _mm_movepi64_pi64(simde_x_vusdotq_s32_x86_(_mm_movpi64_epi64(r_.m64), simde_x_vdot_lane_x86_(&b, lane), _mm_movpi64_epi64(a_.m64)));
+  #else
+    simde_uint8x16_private b_ = simde_uint8x16_to_private(b);
+
+    for (int i = 0 ; i < 2 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for (int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
+  #endif
 
   result = simde_int32x2_from_private(r_);
 
@@ -104,18 +113,22 @@ simde_vsudotq_laneq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_uint8x16_t b
   simde_int32x4_t result;
   simde_int32x4_private r_ = simde_int32x4_to_private(r);
   simde_int8x16_private a_ = simde_int8x16_to_private(a);
-  simde_uint8x16_private b_ = simde_uint8x16_to_private(b);
-
-  for(int i = 0 ; i < 4 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for(int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    r_.m128i = simde_x_vusdotq_s32_x86_(r_.m128i, simde_x_vdot_lane_x86_(&b, lane), a_.m128i);
+  #else
+    simde_uint8x16_private b_ = simde_uint8x16_to_private(b);
+
+    for(int i = 0 ; i < 4 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for(int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
+  #endif
 
   result = simde_int32x4_from_private(r_);
   return result;
@@ -135,18 +148,22 @@ simde_vsudotq_lane_s32(simde_int32x4_t r, simde_int8x16_t a, simde_uint8x8_t b,
   simde_int32x4_t result;
   simde_int32x4_private r_ = simde_int32x4_to_private(r);
   simde_int8x16_private a_ = simde_int8x16_to_private(a);
-  simde_uint8x8_private b_ = simde_uint8x8_to_private(b);
-
-  for(int i = 0 ; i < 4 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for(int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    r_.m128i = simde_x_vusdotq_s32_x86_(r_.m128i, simde_x_vdot_lane_x86_(&b, lane), a_.m128i);
+  #else
+    simde_uint8x8_private b_ = simde_uint8x8_to_private(b);
+
+    for(int i = 0 ; i < 4 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for(int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
+  #endif
 
   result = simde_int32x4_from_private(r_);
   return result;
@@ -30,6 +30,7 @@
 #include "types.h"
 
 #include "add.h"
+#include "dot.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -40,6 +41,12 @@ simde_int32x2_t
 simde_vusdot_s32(simde_int32x2_t r, simde_uint8x8_t a, simde_int8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_MATMUL_INT8)
     return vusdot_s32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    r_.m64 = _mm_movepi64_pi64(simde_x_vusdotq_s32_x86_(_mm_movpi64_epi64(r_.m64), _mm_movpi64_epi64(a_.m64), _mm_movpi64_epi64(b_.m64)));
+    return simde_int32x2_from_private(r_);
   #else
     simde_int32x2_private r_;
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
@@ -66,6 +73,12 @@ simde_int32x4_t
 simde_vusdotq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_MATMUL_INT8)
     return vusdotq_s32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    r_.m128i = simde_x_vusdotq_s32_x86_(r_.m128i, a_.m128i, b_.m128i);
+    return simde_int32x4_from_private(r_);
   #else
     simde_int32x4_private r_;
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
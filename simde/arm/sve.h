@@ -30,11 +30,22 @@
 #include "sve/types.h"
 
 #include "sve/add.h"
+#include "sve/addv.h"
 #include "sve/and.h"
 #include "sve/cnt.h"
+#include "sve/cntp.h"
 #include "sve/cmplt.h"
+#include "sve/compact.h"
+#include "sve/dot.h"
 #include "sve/dup.h"
 #include "sve/ld1.h"
+#include "sve/mad.h"
+#include "sve/max.h"
+#include "sve/maxv.h"
+#include "sve/min.h"
+#include "sve/minv.h"
+#include "sve/mla.h"
+#include "sve/mul.h"
 #include "sve/ptest.h"
 #include "sve/ptrue.h"
 #include "sve/qadd.h"
@@ -0,0 +1,470 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_SVE_ADDV_H)
+#define SIMDE_ARM_SVE_ADDV_H
+
+#include "types.h"
+#include "sel.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_svaddv_s8(simde_svbool_t pg, simde_svint8_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_s8(pg, op);
+  #else
+    int64_t r = INT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(int64_t, _mm512_reduce_add_epi64(_mm512_sad_epu8(_mm512_xor_si512(_mm512_maskz_mov_epi8(simde_svbool_to_mmask64(pg), op.m512i), _mm512_set1_epi8(INT8_MIN)), _mm512_setzero_si512()))) - (INT64_C(128) * 64);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_sad_epu8(_mm256_xor_si256(_mm256_maskz_mov_epi8(simde_svbool_to_mmask32(pg), op.m256i[0]), _mm256_set1_epi8(INT8_MIN)), _mm256_setzero_si256());
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s)) - (INT64_C(128) * 32);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256();
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_xor_si256(_mm256_and_si256(pg.m256i[i], op.m256i[i]), _mm256_set1_epi8(INT8_MIN)), _mm256_setzero_si256()));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s)) - (INT64_C(128) * HEDLEY_STATIC_CAST(int64_t, sizeof(op.values)));
+    #else
+      simde_svint8_t v = simde_x_svsel_s8_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(int64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_s8
+  #define svaddv_s8(pg, op) simde_svaddv_s8((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_svaddv_s16(simde_svbool_t pg, simde_svint16_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_s16(pg, op);
+  #else
+    int64_t r = INT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(int64_t, _mm512_reduce_add_epi32(_mm512_madd_epi16(_mm512_maskz_mov_epi16(simde_svbool_to_mmask32(pg), op.m512i), _mm512_set1_epi16(1))));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i v = _mm256_madd_epi16(_mm256_maskz_mov_epi16(simde_svbool_to_mmask16(pg), op.m256i[0]), _mm256_set1_epi16(1));
+      __m256i acc = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256(), v;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        v = _mm256_madd_epi16(_mm256_and_si256(pg.m256i[i], op.m256i[i]), _mm256_set1_epi16(1));
+        acc = _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1))));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s));
+    #else
+      simde_svint16_t v = simde_x_svsel_s16_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(int64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_s16
+  #define svaddv_s16(pg, op) simde_svaddv_s16((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_svaddv_s32(simde_svbool_t pg, simde_svint32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_s32(pg, op);
+  #else
+    int64_t r = INT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_maskz_mov_epi32(simde_svbool_to_mmask16(pg), op.m512i);
+      r = HEDLEY_STATIC_CAST(int64_t, _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)), _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1)))));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i v = _mm256_maskz_mov_epi32(simde_svbool_to_mmask8(pg), op.m256i[0]);
+      __m256i acc = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256(), v;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        v = _mm256_and_si256(pg.m256i[i], op.m256i[i]);
+        acc = _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1))));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s));
+    #else
+      simde_svint32_t v = simde_x_svsel_s32_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(int64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_s32
+  #define svaddv_s32(pg, op) simde_svaddv_s32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_svaddv_s64(simde_svbool_t pg, simde_svint64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_s64(pg, op);
+  #else
+    int64_t r = INT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(int64_t, _mm512_mask_reduce_add_epi64(simde_svbool_to_mmask8(pg), op.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_maskz_mov_epi64(simde_svbool_to_mmask4(pg), op.m256i[0]);
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256();
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        acc = _mm256_add_epi64(acc, _mm256_and_si256(pg.m256i[i], op.m256i[i]));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(s));
+    #else
+      /* Accumulate in unsigned so the sum wraps like svaddv does
+       * instead of overflowing. */
+      simde_svint64_t v = simde_x_svsel_s64_z(pg, op);
+      uint64_t ru = UINT64_C(0);
+      SIMDE_VECTORIZE_REDUCTION(+:ru)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        ru += HEDLEY_STATIC_CAST(uint64_t, v.values[i]);
+      }
+      r = HEDLEY_STATIC_CAST(int64_t, ru);
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_s64
+  #define svaddv_s64(pg, op) simde_svaddv_s64((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svaddv_u8(simde_svbool_t pg, simde_svuint8_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_u8(pg, op);
+  #else
+    uint64_t r = UINT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm512_reduce_add_epi64(_mm512_sad_epu8(_mm512_maskz_mov_epi8(simde_svbool_to_mmask64(pg), op.m512i), _mm512_setzero_si512())));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_sad_epu8(_mm256_maskz_mov_epi8(simde_svbool_to_mmask32(pg), op.m256i[0]), _mm256_setzero_si256());
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256();
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_and_si256(pg.m256i[i], op.m256i[i]), _mm256_setzero_si256()));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #else
+      simde_svuint8_t v = simde_x_svsel_u8_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(uint64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_u8
+  #define svaddv_u8(pg, op) simde_svaddv_u8((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svaddv_u16(simde_svbool_t pg, simde_svuint16_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_u16(pg, op);
+  #else
+    uint64_t r = UINT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_maskz_mov_epi16(simde_svbool_to_mmask32(pg), op.m512i);
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm512_reduce_add_epi32(_mm512_add_epi32(_mm512_srli_epi32(v, 16), _mm512_and_si512(v, _mm512_set1_epi32(0xffff)))));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i m = _mm256_maskz_mov_epi16(simde_svbool_to_mmask16(pg), op.m256i[0]);
+      __m256i v = _mm256_add_epi32(_mm256_srli_epi32(m, 16), _mm256_and_si256(m, _mm256_set1_epi32(0xffff)));
+      __m256i acc = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256(), v;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        __m256i m = _mm256_and_si256(pg.m256i[i], op.m256i[i]);
+        v = _mm256_add_epi32(_mm256_srli_epi32(m, 16), _mm256_and_si256(m, _mm256_set1_epi32(0xffff)));
+        acc = _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1))));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #else
+      simde_svuint16_t v = simde_x_svsel_u16_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(uint64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_u16
+  #define svaddv_u16(pg, op) simde_svaddv_u16((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svaddv_u32(simde_svbool_t pg, simde_svuint32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_u32(pg, op);
+  #else
+    uint64_t r = UINT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_maskz_mov_epi32(simde_svbool_to_mmask16(pg), op.m512i);
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm512_reduce_add_epi64(_mm512_add_epi64(_mm512_cvtepu32_epi64(_mm512_castsi512_si256(v)), _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(v, 1)))));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i v = _mm256_maskz_mov_epi32(simde_svbool_to_mmask8(pg), op.m256i[0]);
+      __m256i acc = _mm256_add_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256(), v;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        v = _mm256_and_si256(pg.m256i[i], op.m256i[i]);
+        acc = _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1))));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #else
+      simde_svuint32_t v = simde_x_svsel_u32_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(uint64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_u32
+  #define svaddv_u32(pg, op) simde_svaddv_u32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svaddv_u64(simde_svbool_t pg, simde_svuint64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_u64(pg, op);
+  #else
+    uint64_t r = UINT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm512_mask_reduce_add_epi64(simde_svbool_to_mmask8(pg), op.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_maskz_mov_epi64(simde_svbool_to_mmask4(pg), op.m256i[0]);
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      __m256i acc = _mm256_setzero_si256();
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        acc = _mm256_add_epi64(acc, _mm256_and_si256(pg.m256i[i], op.m256i[i]));
+      }
+      __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+      s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(s));
+    #else
+      simde_svuint64_t v = simde_x_svsel_u64_z(pg, op);
+      SIMDE_VECTORIZE_REDUCTION(+:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += HEDLEY_STATIC_CAST(uint64_t, v.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_u64
+  #define svaddv_u64(pg, op) simde_svaddv_u64((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_svaddv_f32(simde_svbool_t pg, simde_svfloat32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_f32(pg, op);
+  #else
+    simde_float32 r = SIMDE_FLOAT32_C(0.0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = _mm512_mask_reduce_add_ps(simde_svbool_to_mmask16(pg), op.m512);
+    #else
+      simde_svfloat32_t v = simde_x_svsel_f32_z(pg, op);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += v.values[i];
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_f32
+  #define svaddv_f32(pg, op) simde_svaddv_f32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_svaddv_f64(simde_svbool_t pg, simde_svfloat64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svaddv_f64(pg, op);
+  #else
+    simde_float64 r = SIMDE_FLOAT64_C(0.0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = _mm512_mask_reduce_add_pd(simde_svbool_to_mmask8(pg), op.m512d);
+    #else
+      simde_svfloat64_t v = simde_x_svsel_f64_z(pg, op);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r += v.values[i];
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svaddv_f64
+  #define svaddv_f64(pg, op) simde_svaddv_f64((pg), (op))
+#endif
+
+#if defined(__cplusplus)
+  SIMDE_FUNCTION_ATTRIBUTES       int64_t simde_svaddv(simde_svbool_t pg,    simde_svint8_t op) { return simde_svaddv_s8 (pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       int64_t simde_svaddv(simde_svbool_t pg,   simde_svint16_t op) { return simde_svaddv_s16(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       int64_t simde_svaddv(simde_svbool_t pg,   simde_svint32_t op) { return simde_svaddv_s32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       int64_t simde_svaddv(simde_svbool_t pg,   simde_svint64_t op) { return simde_svaddv_s64(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint64_t simde_svaddv(simde_svbool_t pg,   simde_svuint8_t op) { return simde_svaddv_u8 (pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint64_t simde_svaddv(simde_svbool_t pg,  simde_svuint16_t op) { return simde_svaddv_u16(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint64_t simde_svaddv(simde_svbool_t pg,  simde_svuint32_t op) { return simde_svaddv_u32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint64_t simde_svaddv(simde_svbool_t pg,  simde_svuint64_t op) { return simde_svaddv_u64(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_float32 simde_svaddv(simde_svbool_t pg, simde_svfloat32_t op) { return simde_svaddv_f32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_float64 simde_svaddv(simde_svbool_t pg, simde_svfloat64_t op) { return simde_svaddv_f64(pg, op); }
+#elif defined(SIMDE_GENERIC_)
+  #define simde_svaddv(pg, op) \
+    (SIMDE_GENERIC_((op), \
+         simde_svint8_t: simde_svaddv_s8 , \
+        simde_svint16_t: simde_svaddv_s16, \
+        simde_svint32_t: simde_svaddv_s32, \
+        simde_svint64_t: simde_svaddv_s64, \
+        simde_svuint8_t: simde_svaddv_u8 , \
+       simde_svuint16_t: simde_svaddv_u16, \
+       simde_svuint32_t: simde_svaddv_u32, \
+       simde_svuint64_t: simde_svaddv_u64, \
+      simde_svfloat32_t: simde_svaddv_f32, \
+      simde_svfloat64_t: simde_svaddv_f64)((pg), (op)))
+#endif
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef svaddv
+  #define svaddv(pg, op) simde_svaddv((pg), (op))
+#endif
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* SIMDE_ARM_SVE_ADDV_H */
@@ -0,0 +1,201 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_SVE_CNTP_H)
+#define SIMDE_ARM_SVE_CNTP_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_arm_sve_popcount_u64(uint64_t v) {
+  #if HEDLEY_HAS_BUILTIN(__builtin_popcountll) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return HEDLEY_STATIC_CAST(uint64_t, __builtin_popcountll(HEDLEY_STATIC_CAST(unsigned long long, v)));
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return HEDLEY_STATIC_CAST(uint64_t, _mm_popcnt_u64(v));
+  #else
+    v = v - ((v >> 1) & UINT64_C(0x5555555555555555));
+    v = (v & UINT64_C(0x3333333333333333)) + ((v >> 2) & UINT64_C(0x3333333333333333));
+    v = (v + (v >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    return (v * UINT64_C(0x0101010101010101)) >> 56;
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svcntp_b8(simde_svbool_t pg, simde_svbool_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcntp_b8(pg, op);
+  #else
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask64(pg) & simde_svbool_to_mmask64(op)));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask32(pg) & simde_svbool_to_mmask32(op)));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, _mm256_movemask_epi8(_mm256_and_si256(pg.m256i[i], op.m256i[i]))));
+      }
+      return r;
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m128i) / sizeof(pg.m128i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, _mm_movemask_epi8(_mm_and_si128(pg.m128i[i], op.m128i[i]))));
+      }
+      return r;
+    #else
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
+        r += (pg.values_i8[i] & op.values_i8[i]) ? 1 : 0;
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcntp_b8
+  #define svcntp_b8(pg, op) simde_svcntp_b8((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svcntp_b16(simde_svbool_t pg, simde_svbool_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcntp_b16(pg, op);
+  #else
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask32(pg) & simde_svbool_to_mmask32(op)));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask16(pg) & simde_svbool_to_mmask16(op)));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, (_mm256_movemask_epi8(_mm256_and_si256(pg.m256i[i], op.m256i[i])) & 0xAAAAAAAA)));
+      }
+      return r;
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m128i) / sizeof(pg.m128i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, (_mm_movemask_epi8(_mm_and_si128(pg.m128i[i], op.m128i[i])) & 0xAAAA)));
+      }
+      return r;
+    #else
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+        r += (pg.values_i16[i] & op.values_i16[i]) ? 1 : 0;
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcntp_b16
+  #define svcntp_b16(pg, op) simde_svcntp_b16((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svcntp_b32(simde_svbool_t pg, simde_svbool_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcntp_b32(pg, op);
+  #else
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask16(pg) & simde_svbool_to_mmask16(op)));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask8(pg) & simde_svbool_to_mmask8(op)));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(pg.m256i[i], op.m256i[i])))));
+      }
+      return r;
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m128i) / sizeof(pg.m128i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(pg.m128i[i], op.m128i[i])))));
+      }
+      return r;
+    #else
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r += (pg.values_i32[i] & op.values_i32[i]) ? 1 : 0;
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcntp_b32
+  #define svcntp_b32(pg, op) simde_svcntp_b32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svcntp_b64(simde_svbool_t pg, simde_svbool_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcntp_b64(pg, op);
+  #else
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask8(pg) & simde_svbool_to_mmask8(op)));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      return simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint64_t, simde_svbool_to_mmask4(pg) & simde_svbool_to_mmask4(op)));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_and_si256(pg.m256i[i], op.m256i[i])))));
+      }
+      return r;
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m128i) / sizeof(pg.m128i[0])) ; i++) {
+        r += simde_x_arm_sve_popcount_u64(HEDLEY_STATIC_CAST(uint32_t, _mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(pg.m128i[i], op.m128i[i])))));
+      }
+      return r;
+    #else
+      uint64_t r = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r += (pg.values_i64[i] & op.values_i64[i]) ? 1 : 0;
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcntp_b64
+  #define svcntp_b64(pg, op) simde_svcntp_b64((pg), (op))
+#endif
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* SIMDE_ARM_SVE_CNTP_H */
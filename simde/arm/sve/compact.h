@@ -0,0 +1,303 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_SVE_COMPACT_H)
+#define SIMDE_ARM_SVE_COMPACT_H
+
+#include "types.h"
+#include "cntp.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svcompact_s32(simde_svbool_t pg, simde_svint32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcompact_s32(pg, op);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_maskz_compress_epi32(simde_svbool_to_mmask16(pg), op.m512i);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_maskz_compress_epi32(simde_svbool_to_mmask8(pg), op.m256i[0]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64) \
+        && (SIMDE_ARM_SVE_VECTOR_SIZE == 256)
+      uint64_t m = HEDLEY_STATIC_CAST(uint64_t, _mm256_movemask_ps(_mm256_castsi256_ps(pg.m256i[0])));
+      uint64_t idx = _pext_u64(UINT64_C(0x0706050403020100), _pdep_u64(m, UINT64_C(0x0101010101010101)) * 0xff);
+      __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(HEDLEY_STATIC_CAST(int64_t, idx)));
+      __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_arm_sve_popcount_u64(m))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      r.m256i[0] = _mm256_and_si256(_mm256_permutevar8x32_epi32(op.m256i[0], perm), keep);
+    #else
+      size_t j = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.values) / sizeof(op.values[0])) ; i++) {
+        if (pg.values_i32[i]) {
+          r.values[j++] = op.values[i];
+        }
+      }
+      for ( ; j < (sizeof(r.values) / sizeof(r.values[0])) ; j++) {
+        r.values[j] = INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcompact_s32
+  #define svcompact_s32(pg, op) simde_svcompact_s32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svcompact_s64(simde_svbool_t pg, simde_svint64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcompact_s64(pg, op);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_maskz_compress_epi64(simde_svbool_to_mmask8(pg), op.m512i);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_maskz_compress_epi64(simde_svbool_to_mmask4(pg), op.m256i[0]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64) \
+        && (SIMDE_ARM_SVE_VECTOR_SIZE == 256)
+      uint64_t m = _pdep_u64(HEDLEY_STATIC_CAST(uint64_t, _mm256_movemask_pd(_mm256_castsi256_pd(pg.m256i[0]))), 0x55) * 3;
+      uint64_t idx = _pext_u64(UINT64_C(0x0706050403020100), _pdep_u64(m, UINT64_C(0x0101010101010101)) * 0xff);
+      __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(HEDLEY_STATIC_CAST(int64_t, idx)));
+      __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_arm_sve_popcount_u64(m))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      r.m256i[0] = _mm256_and_si256(_mm256_permutevar8x32_epi32(op.m256i[0], perm), keep);
+    #else
+      size_t j = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.values) / sizeof(op.values[0])) ; i++) {
+        if (pg.values_i64[i]) {
+          r.values[j++] = op.values[i];
+        }
+      }
+      for ( ; j < (sizeof(r.values) / sizeof(r.values[0])) ; j++) {
+        r.values[j] = INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcompact_s64
+  #define svcompact_s64(pg, op) simde_svcompact_s64((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svcompact_u32(simde_svbool_t pg, simde_svuint32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcompact_u32(pg, op);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_maskz_compress_epi32(simde_svbool_to_mmask16(pg), op.m512i);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_maskz_compress_epi32(simde_svbool_to_mmask8(pg), op.m256i[0]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64) \
+        && (SIMDE_ARM_SVE_VECTOR_SIZE == 256)
+      uint64_t m = HEDLEY_STATIC_CAST(uint64_t, _mm256_movemask_ps(_mm256_castsi256_ps(pg.m256i[0])));
+      uint64_t idx = _pext_u64(UINT64_C(0x0706050403020100), _pdep_u64(m, UINT64_C(0x0101010101010101)) * 0xff);
+      __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(HEDLEY_STATIC_CAST(int64_t, idx)));
+      __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_arm_sve_popcount_u64(m))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      r.m256i[0] = _mm256_and_si256(_mm256_permutevar8x32_epi32(op.m256i[0], perm), keep);
+    #else
+      size_t j = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.values) / sizeof(op.values[0])) ; i++) {
+        if (pg.values_i32[i]) {
+          r.values[j++] = op.values[i];
+        }
+      }
+      for ( ; j < (sizeof(r.values) / sizeof(r.values[0])) ; j++) {
+        r.values[j] = UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcompact_u32
+  #define svcompact_u32(pg, op) simde_svcompact_u32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svcompact_u64(simde_svbool_t pg, simde_svuint64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcompact_u64(pg, op);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_maskz_compress_epi64(simde_svbool_to_mmask8(pg), op.m512i);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_maskz_compress_epi64(simde_svbool_to_mmask4(pg), op.m256i[0]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64) \
+        && (SIMDE_ARM_SVE_VECTOR_SIZE == 256)
+      uint64_t m = _pdep_u64(HEDLEY_STATIC_CAST(uint64_t, _mm256_movemask_pd(_mm256_castsi256_pd(pg.m256i[0]))), 0x55) * 3;
+      uint64_t idx = _pext_u64(UINT64_C(0x0706050403020100), _pdep_u64(m, UINT64_C(0x0101010101010101)) * 0xff);
+      __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(HEDLEY_STATIC_CAST(int64_t, idx)));
+      __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_arm_sve_popcount_u64(m))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      r.m256i[0] = _mm256_and_si256(_mm256_permutevar8x32_epi32(op.m256i[0], perm), keep);
+    #else
+      size_t j = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.values) / sizeof(op.values[0])) ; i++) {
+        if (pg.values_i64[i]) {
+          r.values[j++] = op.values[i];
+        }
+      }
+      for ( ; j < (sizeof(r.values) / sizeof(r.values[0])) ; j++) {
+        r.values[j] = UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcompact_u64
+  #define svcompact_u64(pg, op) simde_svcompact_u64((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svcompact_f32(simde_svbool_t pg, simde_svfloat32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcompact_f32(pg, op);
+  #else
+    simde_svfloat32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512 = _mm512_maskz_compress_ps(simde_svbool_to_mmask16(pg), op.m512);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256[0] = _mm256_maskz_compress_ps(simde_svbool_to_mmask8(pg), op.m256[0]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64) \
+        && (SIMDE_ARM_SVE_VECTOR_SIZE == 256)
+      uint64_t m = HEDLEY_STATIC_CAST(uint64_t, _mm256_movemask_ps(_mm256_castsi256_ps(pg.m256i[0])));
+      uint64_t idx = _pext_u64(UINT64_C(0x0706050403020100), _pdep_u64(m, UINT64_C(0x0101010101010101)) * 0xff);
+      __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(HEDLEY_STATIC_CAST(int64_t, idx)));
+      __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_arm_sve_popcount_u64(m))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      r.m256[0] = _mm256_and_ps(_mm256_permutevar8x32_ps(op.m256[0], perm), _mm256_castsi256_ps(keep));
+    #else
+      size_t j = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.values) / sizeof(op.values[0])) ; i++) {
+        if (pg.values_i32[i]) {
+          r.values[j++] = op.values[i];
+        }
+      }
+      for ( ; j < (sizeof(r.values) / sizeof(r.values[0])) ; j++) {
+        r.values[j] = SIMDE_FLOAT32_C(0.0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcompact_f32
+  #define svcompact_f32(pg, op) simde_svcompact_f32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svcompact_f64(simde_svbool_t pg, simde_svfloat64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svcompact_f64(pg, op);
+  #else
+    simde_svfloat64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512d = _mm512_maskz_compress_pd(simde_svbool_to_mmask8(pg), op.m512d);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256d[0] = _mm256_maskz_compress_pd(simde_svbool_to_mmask4(pg), op.m256d[0]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64) \
+        && (SIMDE_ARM_SVE_VECTOR_SIZE == 256)
+      uint64_t m = _pdep_u64(HEDLEY_STATIC_CAST(uint64_t, _mm256_movemask_pd(_mm256_castsi256_pd(pg.m256i[0]))), 0x55) * 3;
+      uint64_t idx = _pext_u64(UINT64_C(0x0706050403020100), _pdep_u64(m, UINT64_C(0x0101010101010101)) * 0xff);
+      __m256i perm = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(HEDLEY_STATIC_CAST(int64_t, idx)));
+      __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_arm_sve_popcount_u64(m))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      r.m256d[0] = _mm256_castps_pd(_mm256_and_ps(_mm256_permutevar8x32_ps(_mm256_castpd_ps(op.m256d[0]), perm), _mm256_castsi256_ps(keep)));
+    #else
+      size_t j = 0;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.values) / sizeof(op.values[0])) ; i++) {
+        if (pg.values_i64[i]) {
+          r.values[j++] = op.values[i];
+        }
+      }
+      for ( ; j < (sizeof(r.values) / sizeof(r.values[0])) ; j++) {
+        r.values[j] = SIMDE_FLOAT64_C(0.0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svcompact_f64
+  #define svcompact_f64(pg, op) simde_svcompact_f64((pg), (op))
+#endif
+
+#if defined(__cplusplus)
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svcompact(simde_svbool_t pg,   simde_svint32_t op) { return simde_svcompact_s32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svcompact(simde_svbool_t pg,   simde_svint64_t op) { return simde_svcompact_s64(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svcompact(simde_svbool_t pg,  simde_svuint32_t op) { return simde_svcompact_u32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svcompact(simde_svbool_t pg,  simde_svuint64_t op) { return simde_svcompact_u64(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svcompact(simde_svbool_t pg, simde_svfloat32_t op) { return simde_svcompact_f32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svcompact(simde_svbool_t pg, simde_svfloat64_t op) { return simde_svcompact_f64(pg, op); }
+#elif defined(SIMDE_GENERIC_)
+  #define simde_svcompact(pg, op) \
+    (SIMDE_GENERIC_((op), \
+        simde_svint32_t: simde_svcompact_s32, \
+        simde_svint64_t: simde_svcompact_s64, \
+       simde_svuint32_t: simde_svcompact_u32, \
+       simde_svuint64_t: simde_svcompact_u64, \
+      simde_svfloat32_t: simde_svcompact_f32, \
+      simde_svfloat64_t: simde_svcompact_f64)((pg), (op)))
+#endif
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef svcompact
+  #define svcompact(pg, op) simde_svcompact((pg), (op))
+#endif
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* SIMDE_ARM_SVE_COMPACT_H */
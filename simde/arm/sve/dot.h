@@ -0,0 +1,259 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_SVE_DOT_H)
+#define SIMDE_ARM_SVE_DOT_H
+
+#include "types.h"
+#include "dup.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svdot_s32(simde_svint32_t op1, simde_svint8_t op2, simde_svint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_s32(op1, op2, op3);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_DOTPROD)
+      r.neon = vdotq_s32(op1.neon, op2.neon, op3.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512i =
+        _mm512_add_epi32(op1.m512i, _mm512_add_epi32(
+          _mm512_madd_epi16(_mm512_srai_epi16(_mm512_slli_epi16(op2.m512i, 8), 8), _mm512_srai_epi16(_mm512_slli_epi16(op3.m512i, 8), 8)),
+          _mm512_madd_epi16(_mm512_srai_epi16(op2.m512i, 8), _mm512_srai_epi16(op3.m512i, 8))));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] =
+          _mm256_add_epi32(op1.m256i[i], _mm256_add_epi32(
+            _mm256_madd_epi16(_mm256_srai_epi16(_mm256_slli_epi16(op2.m256i[i], 8), 8), _mm256_srai_epi16(_mm256_slli_epi16(op3.m256i[i], 8), 8)),
+            _mm256_madd_epi16(_mm256_srai_epi16(op2.m256i[i], 8), _mm256_srai_epi16(op3.m256i[i], 8))));
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] =
+          _mm_add_epi32(op1.m128i[i], _mm_add_epi32(
+            _mm_madd_epi16(_mm_srai_epi16(_mm_slli_epi16(op2.m128i[i], 8), 8), _mm_srai_epi16(_mm_slli_epi16(op3.m128i[i], 8), 8)),
+            _mm_madd_epi16(_mm_srai_epi16(op2.m128i[i], 8), _mm_srai_epi16(op3.m128i[i], 8))));
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        int32_t s = 0;
+        for (int j = 0 ; j < 4 ; j++) {
+          s += HEDLEY_STATIC_CAST(int32_t, op2.values[(i * 4) + j]) * HEDLEY_STATIC_CAST(int32_t, op3.values[(i * 4) + j]);
+        }
+        r.values[i] = HEDLEY_STATIC_CAST(int32_t, HEDLEY_STATIC_CAST(uint32_t, op1.values[i]) + HEDLEY_STATIC_CAST(uint32_t, s));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_s32
+  #define svdot_s32(op1, op2, op3) simde_svdot_s32((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svdot_n_s32(simde_svint32_t op1, simde_svint8_t op2, int8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_n_s32(op1, op2, op3);
+  #else
+    return simde_svdot_s32(op1, op2, simde_svdup_n_s8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_n_s32
+  #define svdot_n_s32(op1, op2, op3) simde_svdot_n_s32((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svdot_s64(simde_svint64_t op1, simde_svint16_t op2, simde_svint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_s64(op1, op2, op3);
+  #else
+    simde_svint64_t r;
+
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+      int64_t s = 0;
+      for (int j = 0 ; j < 4 ; j++) {
+        s += HEDLEY_STATIC_CAST(int64_t, op2.values[(i * 4) + j]) * HEDLEY_STATIC_CAST(int64_t, op3.values[(i * 4) + j]);
+      }
+      r.values[i] = HEDLEY_STATIC_CAST(int64_t, HEDLEY_STATIC_CAST(uint64_t, op1.values[i]) + HEDLEY_STATIC_CAST(uint64_t, s));
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_s64
+  #define svdot_s64(op1, op2, op3) simde_svdot_s64((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svdot_n_s64(simde_svint64_t op1, simde_svint16_t op2, int16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_n_s64(op1, op2, op3);
+  #else
+    return simde_svdot_s64(op1, op2, simde_svdup_n_s16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_n_s64
+  #define svdot_n_s64(op1, op2, op3) simde_svdot_n_s64((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svdot_u32(simde_svuint32_t op1, simde_svuint8_t op2, simde_svuint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_u32(op1, op2, op3);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_DOTPROD)
+      r.neon = vdotq_u32(op1.neon, op2.neon, op3.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512i =
+        _mm512_add_epi32(op1.m512i, _mm512_add_epi32(
+          _mm512_madd_epi16(_mm512_and_si512(op2.m512i, _mm512_set1_epi16(0xff)), _mm512_and_si512(op3.m512i, _mm512_set1_epi16(0xff))),
+          _mm512_madd_epi16(_mm512_srli_epi16(op2.m512i, 8), _mm512_srli_epi16(op3.m512i, 8))));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] =
+          _mm256_add_epi32(op1.m256i[i], _mm256_add_epi32(
+            _mm256_madd_epi16(_mm256_and_si256(op2.m256i[i], _mm256_set1_epi16(0xff)), _mm256_and_si256(op3.m256i[i], _mm256_set1_epi16(0xff))),
+            _mm256_madd_epi16(_mm256_srli_epi16(op2.m256i[i], 8), _mm256_srli_epi16(op3.m256i[i], 8))));
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] =
+          _mm_add_epi32(op1.m128i[i], _mm_add_epi32(
+            _mm_madd_epi16(_mm_and_si128(op2.m128i[i], _mm_set1_epi16(0xff)), _mm_and_si128(op3.m128i[i], _mm_set1_epi16(0xff))),
+            _mm_madd_epi16(_mm_srli_epi16(op2.m128i[i], 8), _mm_srli_epi16(op3.m128i[i], 8))));
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        uint32_t s = 0;
+        for (int j = 0 ; j < 4 ; j++) {
+          s += HEDLEY_STATIC_CAST(uint32_t, op2.values[(i * 4) + j]) * HEDLEY_STATIC_CAST(uint32_t, op3.values[(i * 4) + j]);
+        }
+        r.values[i] = op1.values[i] + s;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_u32
+  #define svdot_u32(op1, op2, op3) simde_svdot_u32((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svdot_n_u32(simde_svuint32_t op1, simde_svuint8_t op2, uint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_n_u32(op1, op2, op3);
+  #else
+    return simde_svdot_u32(op1, op2, simde_svdup_n_u8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_n_u32
+  #define svdot_n_u32(op1, op2, op3) simde_svdot_n_u32((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svdot_u64(simde_svuint64_t op1, simde_svuint16_t op2, simde_svuint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_u64(op1, op2, op3);
+  #else
+    simde_svuint64_t r;
+
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+      uint64_t s = 0;
+      for (int j = 0 ; j < 4 ; j++) {
+        s += HEDLEY_STATIC_CAST(uint64_t, op2.values[(i * 4) + j]) * HEDLEY_STATIC_CAST(uint64_t, op3.values[(i * 4) + j]);
+      }
+      r.values[i] = op1.values[i] + s;
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_u64
+  #define svdot_u64(op1, op2, op3) simde_svdot_u64((op1), (op2), (op3))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svdot_n_u64(simde_svuint64_t op1, simde_svuint16_t op2, uint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svdot_n_u64(op1, op2, op3);
+  #else
+    return simde_svdot_u64(op1, op2, simde_svdup_n_u16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svdot_n_u64
+  #define svdot_n_u64(op1, op2, op3) simde_svdot_n_u64((op1), (op2), (op3))
+#endif
+
+#if defined(__cplusplus)
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svint32_t simde_svdot( simde_svint32_t op1,   simde_svint8_t op2,   simde_svint8_t op3) { return simde_svdot_s32(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svint64_t simde_svdot( simde_svint64_t op1,  simde_svint16_t op2,  simde_svint16_t op3) { return simde_svdot_s64(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svuint32_t simde_svdot(simde_svuint32_t op1,  simde_svuint8_t op2,  simde_svuint8_t op3) { return simde_svdot_u32(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svuint64_t simde_svdot(simde_svuint64_t op1, simde_svuint16_t op2, simde_svuint16_t op3) { return simde_svdot_u64(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svint32_t simde_svdot( simde_svint32_t op1,   simde_svint8_t op2,           int8_t op3) { return simde_svdot_n_s32(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svint64_t simde_svdot( simde_svint64_t op1,  simde_svint16_t op2,          int16_t op3) { return simde_svdot_n_s64(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svuint32_t simde_svdot(simde_svuint32_t op1,  simde_svuint8_t op2,          uint8_t op3) { return simde_svdot_n_u32(op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svuint64_t simde_svdot(simde_svuint64_t op1, simde_svuint16_t op2,         uint16_t op3) { return simde_svdot_n_u64(op1, op2, op3); }
+#elif defined(SIMDE_GENERIC_)
+  #define simde_svdot(op1, op2, op3) \
+    (SIMDE_GENERIC_((op3), \
+        simde_svint8_t: simde_svdot_s32, \
+       simde_svint16_t: simde_svdot_s64, \
+       simde_svuint8_t: simde_svdot_u32, \
+      simde_svuint16_t: simde_svdot_u64, \
+                int8_t: simde_svdot_n_s32, \
+               int16_t: simde_svdot_n_s64, \
+               uint8_t: simde_svdot_n_u32, \
+              uint16_t: simde_svdot_n_u64)((op1), (op2), (op3)))
+#endif
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef svdot
+  #define svdot(op1, op2, op3) simde_svdot((op1), (op2), (op3))
+#endif
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* SIMDE_ARM_SVE_DOT_H */
@@ -113,6 +113,10 @@ simde_svld1_s32(simde_svbool_t pg, const int32_t * base) {
     #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
         && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
       r.m256i[0] = _mm256_maskz_loadu_epi32(simde_svbool_to_mmask8(pg), base);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_maskload_epi32(HEDLEY_REINTERPRET_CAST(int const *, &(base[i * 8])), pg.m256i[i]);
+      }
     #else
       for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
         r.values[i] = pg.values_i32[i] ? base[i] : INT32_C(0);
@@ -141,6 +145,10 @@ simde_svld1_s64(simde_svbool_t pg, const int64_t * base) {
     #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
         && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
       r.m256i[0] = _mm256_maskz_loadu_epi64(simde_svbool_to_mmask4(pg), base);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_maskload_epi64(HEDLEY_REINTERPRET_CAST(long long const *, &(base[i * 4])), pg.m256i[i]);
+      }
     #else
       for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
         r.values[i] = pg.values_i64[i] ? base[i] : INT64_C(0);
@@ -225,6 +233,10 @@ simde_svld1_u32(simde_svbool_t pg, const uint32_t * base) {
     #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
         && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
       r.m256i[0] = _mm256_maskz_loadu_epi32(simde_svbool_to_mmask8(pg), base);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_maskload_epi32(HEDLEY_REINTERPRET_CAST(int const *, &(base[i * 8])), pg.m256i[i]);
+      }
     #else
       for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
         r.values[i] = pg.values_i32[i] ? base[i] : UINT32_C(0);
@@ -253,6 +265,10 @@ simde_svld1_u64(simde_svbool_t pg, const uint64_t * base) {
     #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
         && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
       r.m256i[0] = _mm256_maskz_loadu_epi64(simde_svbool_to_mmask4(pg), base);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_maskload_epi64(HEDLEY_REINTERPRET_CAST(long long const *, &(base[i * 4])), pg.m256i[i]);
+      }
     #else
       for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
         r.values[i] = pg.values_i64[i] ? base[i] : UINT64_C(0);
@@ -281,6 +297,10 @@ simde_svld1_f32(simde_svbool_t pg, const simde_float32 * base) {
     #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
         && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
       r.m256[0] = _mm256_maskz_loadu_ps(simde_svbool_to_mmask8(pg), base);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256) / sizeof(r.m256[0])) ; i++) {
+        r.m256[i] = _mm256_maskload_ps(&(base[i * 8]), pg.m256i[i]);
+      }
     #else
       for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
         r.values[i] = pg.values_i32[i] ? base[i] : SIMDE_FLOAT32_C(0.0);
@@ -309,6 +329,10 @@ simde_svld1_f64(simde_svbool_t pg, const simde_float64 * base) {
     #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
         && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
       r.m256d[0] = _mm256_maskz_loadu_pd(simde_svbool_to_mmask4(pg), base);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256d) / sizeof(r.m256d[0])) ; i++) {
+        r.m256d[i] = _mm256_maskload_pd(&(base[i * 4]), pg.m256i[i]);
+      }
     #else
       for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
         r.values[i] = pg.values_i64[i] ? base[i] : SIMDE_FLOAT64_C(0.0);
@@ -353,6 +377,1096 @@ simde_svld1_f64(simde_svbool_t pg, const simde_float64 * base) {
   #define svld1(pg, base) simde_svld1((pg), (base))
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svld1sb_s16(simde_svbool_t pg, const int8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sb_s16(pg, base);
+  #else
+    simde_svint16_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(simde_svbool_to_mmask32(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi8_epi16(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+        r.values[i] = pg.values_i16[i] ? HEDLEY_STATIC_CAST(int16_t, base[i]) : INT16_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sb_s16
+  #define svld1sb_s16(pg, base) simde_svld1sb_s16((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svld1sb_s32(simde_svbool_t pg, const int8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sb_s32(pg, base);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(int32_t, base[i]) : INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sb_s32
+  #define svld1sb_s32(pg, base) simde_svld1sb_s32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1sb_s64(simde_svbool_t pg, const int8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sb_s64(pg, base);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(int64_t, base[i]) : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sb_s64
+  #define svld1sb_s64(pg, base) simde_svld1sb_s64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svld1sb_u16(simde_svbool_t pg, const int8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sb_u16(pg, base);
+  #else
+    simde_svuint16_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(simde_svbool_to_mmask32(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi8_epi16(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+        r.values[i] = pg.values_i16[i] ? HEDLEY_STATIC_CAST(uint16_t, base[i]) : UINT16_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sb_u16
+  #define svld1sb_u16(pg, base) simde_svld1sb_u16((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svld1sb_u32(simde_svbool_t pg, const int8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sb_u32(pg, base);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(uint32_t, base[i]) : UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sb_u32
+  #define svld1sb_u32(pg, base) simde_svld1sb_u32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1sb_u64(simde_svbool_t pg, const int8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sb_u64(pg, base);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(uint64_t, base[i]) : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sb_u64
+  #define svld1sb_u64(pg, base) simde_svld1sb_u64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svld1ub_s16(simde_svbool_t pg, const uint8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1ub_s16(pg, base);
+  #else
+    simde_svint16_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(simde_svbool_to_mmask32(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu8_epi16(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+        r.values[i] = pg.values_i16[i] ? HEDLEY_STATIC_CAST(int16_t, base[i]) : INT16_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1ub_s16
+  #define svld1ub_s16(pg, base) simde_svld1ub_s16((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svld1ub_s32(simde_svbool_t pg, const uint8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1ub_s32(pg, base);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(int32_t, base[i]) : INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1ub_s32
+  #define svld1ub_s32(pg, base) simde_svld1ub_s32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1ub_s64(simde_svbool_t pg, const uint8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1ub_s64(pg, base);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(int64_t, base[i]) : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1ub_s64
+  #define svld1ub_s64(pg, base) simde_svld1ub_s64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svld1ub_u16(simde_svbool_t pg, const uint8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1ub_u16(pg, base);
+  #else
+    simde_svuint16_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(simde_svbool_to_mmask32(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu8_epi16(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+        r.values[i] = pg.values_i16[i] ? HEDLEY_STATIC_CAST(uint16_t, base[i]) : UINT16_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1ub_u16
+  #define svld1ub_u16(pg, base) simde_svld1ub_u16((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svld1ub_u32(simde_svbool_t pg, const uint8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1ub_u32(pg, base);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu8_epi32(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(uint32_t, base[i]) : UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1ub_u32
+  #define svld1ub_u32(pg, base) simde_svld1ub_u32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1ub_u64(simde_svbool_t pg, const uint8_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1ub_u64(pg, base);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu8_epi64(_mm_maskz_loadu_epi8(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(uint64_t, base[i]) : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1ub_u64
+  #define svld1ub_u64(pg, base) simde_svld1ub_u64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svld1sh_s32(simde_svbool_t pg, const int16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sh_s32(pg, base);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi16_epi32(_mm256_maskz_loadu_epi16(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi16_epi32(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(int32_t, base[i]) : INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sh_s32
+  #define svld1sh_s32(pg, base) simde_svld1sh_s32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1sh_s64(simde_svbool_t pg, const int16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sh_s64(pg, base);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(int64_t, base[i]) : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sh_s64
+  #define svld1sh_s64(pg, base) simde_svld1sh_s64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svld1sh_u32(simde_svbool_t pg, const int16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sh_u32(pg, base);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi16_epi32(_mm256_maskz_loadu_epi16(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi16_epi32(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(uint32_t, base[i]) : UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sh_u32
+  #define svld1sh_u32(pg, base) simde_svld1sh_u32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1sh_u64(simde_svbool_t pg, const int16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sh_u64(pg, base);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(uint64_t, base[i]) : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sh_u64
+  #define svld1sh_u64(pg, base) simde_svld1sh_u64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svld1uh_s32(simde_svbool_t pg, const uint16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1uh_s32(pg, base);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu16_epi32(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(int32_t, base[i]) : INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1uh_s32
+  #define svld1uh_s32(pg, base) simde_svld1uh_s32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1uh_s64(simde_svbool_t pg, const uint16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1uh_s64(pg, base);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(int64_t, base[i]) : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1uh_s64
+  #define svld1uh_s64(pg, base) simde_svld1uh_s64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svld1uh_u32(simde_svbool_t pg, const uint16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1uh_u32(pg, base);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(simde_svbool_to_mmask16(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu16_epi32(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? HEDLEY_STATIC_CAST(uint32_t, base[i]) : UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1uh_u32
+  #define svld1uh_u32(pg, base) simde_svld1uh_u32((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1uh_u64(simde_svbool_t pg, const uint16_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1uh_u64(pg, base);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu16_epi64(_mm_maskz_loadu_epi16(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(uint64_t, base[i]) : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1uh_u64
+  #define svld1uh_u64(pg, base) simde_svld1uh_u64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1sw_s64(simde_svbool_t pg, const int32_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sw_s64(pg, base);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi32_epi64(_mm256_maskz_loadu_epi32(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi32_epi64(_mm_maskz_loadu_epi32(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(int64_t, base[i]) : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sw_s64
+  #define svld1sw_s64(pg, base) simde_svld1sw_s64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1sw_u64(simde_svbool_t pg, const int32_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1sw_u64(pg, base);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepi32_epi64(_mm256_maskz_loadu_epi32(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepi32_epi64(_mm_maskz_loadu_epi32(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(uint64_t, base[i]) : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1sw_u64
+  #define svld1sw_u64(pg, base) simde_svld1sw_u64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1uw_s64(simde_svbool_t pg, const uint32_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1uw_s64(pg, base);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu32_epi64(_mm256_maskz_loadu_epi32(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu32_epi64(_mm_maskz_loadu_epi32(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(int64_t, base[i]) : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1uw_s64
+  #define svld1uw_s64(pg, base) simde_svld1uw_s64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1uw_u64(simde_svbool_t pg, const uint32_t * base) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1uw_u64(pg, base);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_cvtepu32_epi64(_mm256_maskz_loadu_epi32(simde_svbool_to_mmask8(pg), base));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_cvtepu32_epi64(_mm_maskz_loadu_epi32(simde_svbool_to_mmask4(pg), base));
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? HEDLEY_STATIC_CAST(uint64_t, base[i]) : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1uw_u64
+  #define svld1uw_u64(pg, base) simde_svld1uw_u64((pg), (base))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svld1_gather_s32index_s32(simde_svbool_t pg, const int32_t * base, simde_svint32_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_s32index_s32(pg, base, indices);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), simde_svbool_to_mmask16(pg), indices.m512i, base, 4);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), simde_svbool_to_mmask8(pg), indices.m256i[0], base, 4);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), HEDLEY_REINTERPRET_CAST(int const *, base), indices.m256i[i], pg.m256i[i], 4);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? base[indices.values[i]] : INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_s32index_s32
+  #define svld1_gather_s32index_s32(pg, base, indices) simde_svld1_gather_s32index_s32((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svld1_gather_s32index_u32(simde_svbool_t pg, const uint32_t * base, simde_svint32_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_s32index_u32(pg, base, indices);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), simde_svbool_to_mmask16(pg), indices.m512i, base, 4);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), simde_svbool_to_mmask8(pg), indices.m256i[0], base, 4);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), HEDLEY_REINTERPRET_CAST(int const *, base), indices.m256i[i], pg.m256i[i], 4);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? base[indices.values[i]] : UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_s32index_u32
+  #define svld1_gather_s32index_u32(pg, base, indices) simde_svld1_gather_s32index_u32((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svld1_gather_s32index_f32(simde_svbool_t pg, const simde_float32 * base, simde_svint32_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_s32index_f32(pg, base, indices);
+  #else
+    simde_svfloat32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), simde_svbool_to_mmask16(pg), indices.m512i, base, 4);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256[0] = _mm256_mmask_i32gather_ps(_mm256_setzero_ps(), simde_svbool_to_mmask8(pg), indices.m256i[0], base, 4);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256) / sizeof(r.m256[0])) ; i++) {
+        r.m256[i] = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, indices.m256i[i], _mm256_castsi256_ps(pg.m256i[i]), 4);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? base[indices.values[i]] : SIMDE_FLOAT32_C(0.0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_s32index_f32
+  #define svld1_gather_s32index_f32(pg, base, indices) simde_svld1_gather_s32index_f32((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svld1_gather_u32index_s32(simde_svbool_t pg, const int32_t * base, simde_svuint32_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_u32index_s32(pg, base, indices);
+  #else
+    simde_svint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __mmask16 m = simde_svbool_to_mmask16(pg);
+      __m256i lo = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), HEDLEY_STATIC_CAST(__mmask8, m), _mm512_cvtepu32_epi64(_mm512_castsi512_si256(indices.m512i)), base, 4);
+      __m256i hi = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), HEDLEY_STATIC_CAST(__mmask8, m >> 8), _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(indices.m512i, 1)), base, 4);
+      r.m512i = _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), simde_svbool_to_mmask8(pg), _mm512_cvtepu32_epi64(indices.m256i[0]), base, 4);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        __m128i lo = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), HEDLEY_REINTERPRET_CAST(int const *, base), _mm256_cvtepu32_epi64(_mm256_castsi256_si128(indices.m256i[i])), _mm256_castsi256_si128(pg.m256i[i]), 4);
+        __m128i hi = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), HEDLEY_REINTERPRET_CAST(int const *, base), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(indices.m256i[i], 1)), _mm256_extracti128_si256(pg.m256i[i], 1), 4);
+        r.m256i[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? base[indices.values[i]] : INT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_u32index_s32
+  #define svld1_gather_u32index_s32(pg, base, indices) simde_svld1_gather_u32index_s32((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svld1_gather_u32index_u32(simde_svbool_t pg, const uint32_t * base, simde_svuint32_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_u32index_u32(pg, base, indices);
+  #else
+    simde_svuint32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __mmask16 m = simde_svbool_to_mmask16(pg);
+      __m256i lo = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), HEDLEY_STATIC_CAST(__mmask8, m), _mm512_cvtepu32_epi64(_mm512_castsi512_si256(indices.m512i)), base, 4);
+      __m256i hi = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), HEDLEY_STATIC_CAST(__mmask8, m >> 8), _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(indices.m512i, 1)), base, 4);
+      r.m512i = _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), simde_svbool_to_mmask8(pg), _mm512_cvtepu32_epi64(indices.m256i[0]), base, 4);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        __m128i lo = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), HEDLEY_REINTERPRET_CAST(int const *, base), _mm256_cvtepu32_epi64(_mm256_castsi256_si128(indices.m256i[i])), _mm256_castsi256_si128(pg.m256i[i]), 4);
+        __m128i hi = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), HEDLEY_REINTERPRET_CAST(int const *, base), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(indices.m256i[i], 1)), _mm256_extracti128_si256(pg.m256i[i], 1), 4);
+        r.m256i[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? base[indices.values[i]] : UINT32_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_u32index_u32
+  #define svld1_gather_u32index_u32(pg, base, indices) simde_svld1_gather_u32index_u32((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svld1_gather_u32index_f32(simde_svbool_t pg, const simde_float32 * base, simde_svuint32_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_u32index_f32(pg, base, indices);
+  #else
+    simde_svfloat32_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __mmask16 m = simde_svbool_to_mmask16(pg);
+      __m256 lo = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), HEDLEY_STATIC_CAST(__mmask8, m), _mm512_cvtepu32_epi64(_mm512_castsi512_si256(indices.m512i)), base, 4);
+      __m256 hi = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), HEDLEY_STATIC_CAST(__mmask8, m >> 8), _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(indices.m512i, 1)), base, 4);
+      r.m512 = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)), _mm256_castps_pd(hi), 1));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256[0] = _mm512_mask_i64gather_ps(_mm256_setzero_ps(), simde_svbool_to_mmask8(pg), _mm512_cvtepu32_epi64(indices.m256i[0]), base, 4);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256) / sizeof(r.m256[0])) ; i++) {
+        __m128 lo = _mm256_mask_i64gather_ps(_mm_setzero_ps(), base, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(indices.m256i[i])), _mm_castsi128_ps(_mm256_castsi256_si128(pg.m256i[i])), 4);
+        __m128 hi = _mm256_mask_i64gather_ps(_mm_setzero_ps(), base, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(indices.m256i[i], 1)), _mm_castsi128_ps(_mm256_extracti128_si256(pg.m256i[i], 1)), 4);
+        r.m256[i] = _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = pg.values_i32[i] ? base[indices.values[i]] : SIMDE_FLOAT32_C(0.0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_u32index_f32
+  #define svld1_gather_u32index_f32(pg, base, indices) simde_svld1_gather_u32index_f32((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1_gather_s64index_s64(simde_svbool_t pg, const int64_t * base, simde_svint64_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_s64index_s64(pg, base, indices);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), simde_svbool_to_mmask8(pg), indices.m512i, base, 8);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_mmask_i64gather_epi64(_mm256_setzero_si256(), simde_svbool_to_mmask4(pg), indices.m256i[0], base, 8);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), HEDLEY_REINTERPRET_CAST(long long const *, base), indices.m256i[i], pg.m256i[i], 8);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? base[indices.values[i]] : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_s64index_s64
+  #define svld1_gather_s64index_s64(pg, base, indices) simde_svld1_gather_s64index_s64((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1_gather_s64index_u64(simde_svbool_t pg, const uint64_t * base, simde_svint64_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_s64index_u64(pg, base, indices);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), simde_svbool_to_mmask8(pg), indices.m512i, base, 8);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_mmask_i64gather_epi64(_mm256_setzero_si256(), simde_svbool_to_mmask4(pg), indices.m256i[0], base, 8);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), HEDLEY_REINTERPRET_CAST(long long const *, base), indices.m256i[i], pg.m256i[i], 8);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? base[indices.values[i]] : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_s64index_u64
+  #define svld1_gather_s64index_u64(pg, base, indices) simde_svld1_gather_s64index_u64((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svld1_gather_s64index_f64(simde_svbool_t pg, const simde_float64 * base, simde_svint64_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_s64index_f64(pg, base, indices);
+  #else
+    simde_svfloat64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512d = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), simde_svbool_to_mmask8(pg), indices.m512i, base, 8);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256d[0] = _mm256_mmask_i64gather_pd(_mm256_setzero_pd(), simde_svbool_to_mmask4(pg), indices.m256i[0], base, 8);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256d) / sizeof(r.m256d[0])) ; i++) {
+        r.m256d[i] = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), base, indices.m256i[i], _mm256_castsi256_pd(pg.m256i[i]), 8);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? base[indices.values[i]] : SIMDE_FLOAT64_C(0.0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_s64index_f64
+  #define svld1_gather_s64index_f64(pg, base, indices) simde_svld1_gather_s64index_f64((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svld1_gather_u64index_s64(simde_svbool_t pg, const int64_t * base, simde_svuint64_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_u64index_s64(pg, base, indices);
+  #else
+    simde_svint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), simde_svbool_to_mmask8(pg), indices.m512i, base, 8);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_mmask_i64gather_epi64(_mm256_setzero_si256(), simde_svbool_to_mmask4(pg), indices.m256i[0], base, 8);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), HEDLEY_REINTERPRET_CAST(long long const *, base), indices.m256i[i], pg.m256i[i], 8);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? base[indices.values[i]] : INT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_u64index_s64
+  #define svld1_gather_u64index_s64(pg, base, indices) simde_svld1_gather_u64index_s64((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svld1_gather_u64index_u64(simde_svbool_t pg, const uint64_t * base, simde_svuint64_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_u64index_u64(pg, base, indices);
+  #else
+    simde_svuint64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512i = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), simde_svbool_to_mmask8(pg), indices.m512i, base, 8);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256i[0] = _mm256_mmask_i64gather_epi64(_mm256_setzero_si256(), simde_svbool_to_mmask4(pg), indices.m256i[0], base, 8);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), HEDLEY_REINTERPRET_CAST(long long const *, base), indices.m256i[i], pg.m256i[i], 8);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? base[indices.values[i]] : UINT64_C(0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_u64index_u64
+  #define svld1_gather_u64index_u64(pg, base, indices) simde_svld1_gather_u64index_u64((pg), (base), (indices))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svld1_gather_u64index_f64(simde_svbool_t pg, const simde_float64 * base, simde_svuint64_t indices) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svld1_gather_u64index_f64(pg, base, indices);
+  #else
+    simde_svfloat64_t r;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m512d = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), simde_svbool_to_mmask8(pg), indices.m512i, base, 8);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r.m256d[0] = _mm256_mmask_i64gather_pd(_mm256_setzero_pd(), simde_svbool_to_mmask4(pg), indices.m256i[0], base, 8);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256d) / sizeof(r.m256d[0])) ; i++) {
+        r.m256d[i] = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), base, indices.m256i[i], _mm256_castsi256_pd(pg.m256i[i]), 8);
+      }
+    #else
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = pg.values_i64[i] ? base[indices.values[i]] : SIMDE_FLOAT64_C(0.0);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svld1_gather_u64index_f64
+  #define svld1_gather_u64index_f64(pg, base, indices) simde_svld1_gather_u64index_f64((pg), (base), (indices))
+#endif
+
+#if defined(__cplusplus)
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svld1_gather_index(simde_svbool_t pg, const       int32_t * base,  simde_svint32_t indices) { return simde_svld1_gather_s32index_s32(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svld1_gather_index(simde_svbool_t pg, const      uint32_t * base,  simde_svint32_t indices) { return simde_svld1_gather_s32index_u32(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svld1_gather_index(simde_svbool_t pg, const simde_float32 * base,  simde_svint32_t indices) { return simde_svld1_gather_s32index_f32(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svld1_gather_index(simde_svbool_t pg, const       int32_t * base, simde_svuint32_t indices) { return simde_svld1_gather_u32index_s32(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svld1_gather_index(simde_svbool_t pg, const      uint32_t * base, simde_svuint32_t indices) { return simde_svld1_gather_u32index_u32(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svld1_gather_index(simde_svbool_t pg, const simde_float32 * base, simde_svuint32_t indices) { return simde_svld1_gather_u32index_f32(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svld1_gather_index(simde_svbool_t pg, const       int64_t * base,  simde_svint64_t indices) { return simde_svld1_gather_s64index_s64(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svld1_gather_index(simde_svbool_t pg, const      uint64_t * base,  simde_svint64_t indices) { return simde_svld1_gather_s64index_u64(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svld1_gather_index(simde_svbool_t pg, const simde_float64 * base,  simde_svint64_t indices) { return simde_svld1_gather_s64index_f64(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svld1_gather_index(simde_svbool_t pg, const       int64_t * base, simde_svuint64_t indices) { return simde_svld1_gather_u64index_s64(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svld1_gather_index(simde_svbool_t pg, const      uint64_t * base, simde_svuint64_t indices) { return simde_svld1_gather_u64index_u64(pg, base, indices); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svld1_gather_index(simde_svbool_t pg, const simde_float64 * base, simde_svuint64_t indices) { return simde_svld1_gather_u64index_f64(pg, base, indices); }
+#endif
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef svld1_gather_index
+  #define svld1_gather_index(pg, base, indices) simde_svld1_gather_index((pg), (base), (indices))
+#endif
+
 HEDLEY_DIAGNOSTIC_POP
 
 #endif /* SIMDE_ARM_SVE_LD1_H */
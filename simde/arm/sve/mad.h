@@ -0,0 +1,1259 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_SVE_MAD_H)
+#define SIMDE_ARM_SVE_MAD_H
+
+#include "types.h"
+#include "sel.h"
+#include "dup.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint8_t
+simde_svmad_s8_x(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2, simde_svint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s8_x(pg, op1, op2, op3);
+  #else
+    simde_svint8_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r.neon = vmlaq_s8(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = HEDLEY_STATIC_CAST(int8_t, op3.values[i] + (op1.values[i] * op2.values[i]));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s8_x
+  #define svmad_s8_x(pg, op1, op2, op3) simde_svmad_s8_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint8_t
+simde_svmad_s8_z(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2, simde_svint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s8_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_s8_z(pg, simde_svmad_s8_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s8_z
+  #define svmad_s8_z(pg, op1, op2, op3) simde_svmad_s8_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint8_t
+simde_svmad_s8_m(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2, simde_svint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s8_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_s8(pg, simde_svmad_s8_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s8_m
+  #define svmad_s8_m(pg, op1, op2, op3) simde_svmad_s8_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint8_t
+simde_svmad_n_s8_x(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2, int8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s8_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s8_x(pg, op1, op2, simde_svdup_n_s8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s8_x
+  #define svmad_n_s8_x(pg, op1, op2, op3) simde_svmad_n_s8_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint8_t
+simde_svmad_n_s8_z(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2, int8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s8_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s8_z(pg, op1, op2, simde_svdup_n_s8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s8_z
+  #define svmad_n_s8_z(pg, op1, op2, op3) simde_svmad_n_s8_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint8_t
+simde_svmad_n_s8_m(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2, int8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s8_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s8_m(pg, op1, op2, simde_svdup_n_s8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s8_m
+  #define svmad_n_s8_m(pg, op1, op2, op3) simde_svmad_n_s8_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svmad_s16_x(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2, simde_svint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s16_x(pg, op1, op2, op3);
+  #else
+    simde_svint16_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r.neon = vmlaq_s16(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512i = _mm512_add_epi16(op3.m512i, _mm512_mullo_epi16(op1.m512i, op2.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r.m256i[0] = _mm256_add_epi16(op3.m256i[0], _mm256_mullo_epi16(op1.m256i[0], op2.m256i[0]));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_add_epi16(op3.m256i[i], _mm256_mullo_epi16(op1.m256i[i], op2.m256i[i]));
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_add_epi16(op3.m128i[i], _mm_mullo_epi16(op1.m128i[i], op2.m128i[i]));
+      }
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = HEDLEY_STATIC_CAST(int16_t, op3.values[i] + (op1.values[i] * op2.values[i]));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s16_x
+  #define svmad_s16_x(pg, op1, op2, op3) simde_svmad_s16_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svmad_s16_z(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2, simde_svint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s16_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_s16_z(pg, simde_svmad_s16_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s16_z
+  #define svmad_s16_z(pg, op1, op2, op3) simde_svmad_s16_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svmad_s16_m(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2, simde_svint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s16_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_s16(pg, simde_svmad_s16_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s16_m
+  #define svmad_s16_m(pg, op1, op2, op3) simde_svmad_s16_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svmad_n_s16_x(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2, int16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s16_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s16_x(pg, op1, op2, simde_svdup_n_s16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s16_x
+  #define svmad_n_s16_x(pg, op1, op2, op3) simde_svmad_n_s16_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svmad_n_s16_z(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2, int16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s16_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s16_z(pg, op1, op2, simde_svdup_n_s16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s16_z
+  #define svmad_n_s16_z(pg, op1, op2, op3) simde_svmad_n_s16_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint16_t
+simde_svmad_n_s16_m(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2, int16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s16_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s16_m(pg, op1, op2, simde_svdup_n_s16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s16_m
+  #define svmad_n_s16_m(pg, op1, op2, op3) simde_svmad_n_s16_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svmad_s32_x(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2, simde_svint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s32_x(pg, op1, op2, op3);
+  #else
+    simde_svint32_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r.neon = vmlaq_s32(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512i = _mm512_add_epi32(op3.m512i, _mm512_mullo_epi32(op1.m512i, op2.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r.m256i[0] = _mm256_add_epi32(op3.m256i[0], _mm256_mullo_epi32(op1.m256i[0], op2.m256i[0]));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_add_epi32(op3.m256i[i], _mm256_mullo_epi32(op1.m256i[i], op2.m256i[i]));
+      }
+    #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_add_epi32(op3.m128i[i], _mm_mullo_epi32(op1.m128i[i], op2.m128i[i]));
+      }
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = HEDLEY_STATIC_CAST(int32_t, HEDLEY_STATIC_CAST(uint32_t, op3.values[i]) + (HEDLEY_STATIC_CAST(uint32_t, op1.values[i]) * HEDLEY_STATIC_CAST(uint32_t, op2.values[i])));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s32_x
+  #define svmad_s32_x(pg, op1, op2, op3) simde_svmad_s32_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svmad_s32_z(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2, simde_svint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s32_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_s32_z(pg, simde_svmad_s32_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s32_z
+  #define svmad_s32_z(pg, op1, op2, op3) simde_svmad_s32_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svmad_s32_m(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2, simde_svint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s32_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_s32(pg, simde_svmad_s32_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s32_m
+  #define svmad_s32_m(pg, op1, op2, op3) simde_svmad_s32_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svmad_n_s32_x(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2, int32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s32_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s32_x(pg, op1, op2, simde_svdup_n_s32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s32_x
+  #define svmad_n_s32_x(pg, op1, op2, op3) simde_svmad_n_s32_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svmad_n_s32_z(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2, int32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s32_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s32_z(pg, op1, op2, simde_svdup_n_s32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s32_z
+  #define svmad_n_s32_z(pg, op1, op2, op3) simde_svmad_n_s32_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint32_t
+simde_svmad_n_s32_m(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2, int32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s32_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s32_m(pg, op1, op2, simde_svdup_n_s32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s32_m
+  #define svmad_n_s32_m(pg, op1, op2, op3) simde_svmad_n_s32_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svmad_s64_x(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2, simde_svint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s64_x(pg, op1, op2, op3);
+  #else
+    simde_svint64_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512DQ_NATIVE)
+      r.m512i = _mm512_add_epi64(op3.m512i, _mm512_mullo_epi64(op1.m512i, op2.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512DQ_NATIVE)
+      r.m256i[0] = _mm256_add_epi64(op3.m256i[0], _mm256_mullo_epi64(op1.m256i[0], op2.m256i[0]));
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = HEDLEY_STATIC_CAST(int64_t, HEDLEY_STATIC_CAST(uint64_t, op3.values[i]) + (HEDLEY_STATIC_CAST(uint64_t, op1.values[i]) * HEDLEY_STATIC_CAST(uint64_t, op2.values[i])));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s64_x
+  #define svmad_s64_x(pg, op1, op2, op3) simde_svmad_s64_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svmad_s64_z(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2, simde_svint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s64_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_s64_z(pg, simde_svmad_s64_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s64_z
+  #define svmad_s64_z(pg, op1, op2, op3) simde_svmad_s64_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svmad_s64_m(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2, simde_svint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_s64_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_s64(pg, simde_svmad_s64_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_s64_m
+  #define svmad_s64_m(pg, op1, op2, op3) simde_svmad_s64_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svmad_n_s64_x(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2, int64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s64_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s64_x(pg, op1, op2, simde_svdup_n_s64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s64_x
+  #define svmad_n_s64_x(pg, op1, op2, op3) simde_svmad_n_s64_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svmad_n_s64_z(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2, int64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s64_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s64_z(pg, op1, op2, simde_svdup_n_s64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s64_z
+  #define svmad_n_s64_z(pg, op1, op2, op3) simde_svmad_n_s64_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svint64_t
+simde_svmad_n_s64_m(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2, int64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_s64_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_s64_m(pg, op1, op2, simde_svdup_n_s64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_s64_m
+  #define svmad_n_s64_m(pg, op1, op2, op3) simde_svmad_n_s64_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint8_t
+simde_svmad_u8_x(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2, simde_svuint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u8_x(pg, op1, op2, op3);
+  #else
+    simde_svuint8_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r.neon = vmlaq_u8(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = HEDLEY_STATIC_CAST(uint8_t, op3.values[i] + (op1.values[i] * op2.values[i]));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u8_x
+  #define svmad_u8_x(pg, op1, op2, op3) simde_svmad_u8_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint8_t
+simde_svmad_u8_z(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2, simde_svuint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u8_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_u8_z(pg, simde_svmad_u8_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u8_z
+  #define svmad_u8_z(pg, op1, op2, op3) simde_svmad_u8_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint8_t
+simde_svmad_u8_m(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2, simde_svuint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u8_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_u8(pg, simde_svmad_u8_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u8_m
+  #define svmad_u8_m(pg, op1, op2, op3) simde_svmad_u8_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint8_t
+simde_svmad_n_u8_x(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2, uint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u8_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u8_x(pg, op1, op2, simde_svdup_n_u8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u8_x
+  #define svmad_n_u8_x(pg, op1, op2, op3) simde_svmad_n_u8_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint8_t
+simde_svmad_n_u8_z(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2, uint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u8_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u8_z(pg, op1, op2, simde_svdup_n_u8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u8_z
+  #define svmad_n_u8_z(pg, op1, op2, op3) simde_svmad_n_u8_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint8_t
+simde_svmad_n_u8_m(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2, uint8_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u8_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u8_m(pg, op1, op2, simde_svdup_n_u8(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u8_m
+  #define svmad_n_u8_m(pg, op1, op2, op3) simde_svmad_n_u8_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svmad_u16_x(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2, simde_svuint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u16_x(pg, op1, op2, op3);
+  #else
+    simde_svuint16_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r.neon = vmlaq_u16(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512i = _mm512_add_epi16(op3.m512i, _mm512_mullo_epi16(op1.m512i, op2.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r.m256i[0] = _mm256_add_epi16(op3.m256i[0], _mm256_mullo_epi16(op1.m256i[0], op2.m256i[0]));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_add_epi16(op3.m256i[i], _mm256_mullo_epi16(op1.m256i[i], op2.m256i[i]));
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_add_epi16(op3.m128i[i], _mm_mullo_epi16(op1.m128i[i], op2.m128i[i]));
+      }
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = HEDLEY_STATIC_CAST(uint16_t, op3.values[i] + (HEDLEY_STATIC_CAST(uint32_t, op1.values[i]) * op2.values[i]));
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u16_x
+  #define svmad_u16_x(pg, op1, op2, op3) simde_svmad_u16_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svmad_u16_z(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2, simde_svuint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u16_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_u16_z(pg, simde_svmad_u16_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u16_z
+  #define svmad_u16_z(pg, op1, op2, op3) simde_svmad_u16_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svmad_u16_m(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2, simde_svuint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u16_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_u16(pg, simde_svmad_u16_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u16_m
+  #define svmad_u16_m(pg, op1, op2, op3) simde_svmad_u16_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svmad_n_u16_x(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2, uint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u16_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u16_x(pg, op1, op2, simde_svdup_n_u16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u16_x
+  #define svmad_n_u16_x(pg, op1, op2, op3) simde_svmad_n_u16_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svmad_n_u16_z(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2, uint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u16_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u16_z(pg, op1, op2, simde_svdup_n_u16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u16_z
+  #define svmad_n_u16_z(pg, op1, op2, op3) simde_svmad_n_u16_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint16_t
+simde_svmad_n_u16_m(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2, uint16_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u16_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u16_m(pg, op1, op2, simde_svdup_n_u16(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u16_m
+  #define svmad_n_u16_m(pg, op1, op2, op3) simde_svmad_n_u16_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svmad_u32_x(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2, simde_svuint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u32_x(pg, op1, op2, op3);
+  #else
+    simde_svuint32_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r.neon = vmlaq_u32(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512i = _mm512_add_epi32(op3.m512i, _mm512_mullo_epi32(op1.m512i, op2.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r.m256i[0] = _mm256_add_epi32(op3.m256i[0], _mm256_mullo_epi32(op1.m256i[0], op2.m256i[0]));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_add_epi32(op3.m256i[i], _mm256_mullo_epi32(op1.m256i[i], op2.m256i[i]));
+      }
+    #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_add_epi32(op3.m128i[i], _mm_mullo_epi32(op1.m128i[i], op2.m128i[i]));
+      }
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = op3.values[i] + (op1.values[i] * op2.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u32_x
+  #define svmad_u32_x(pg, op1, op2, op3) simde_svmad_u32_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svmad_u32_z(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2, simde_svuint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u32_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_u32_z(pg, simde_svmad_u32_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u32_z
+  #define svmad_u32_z(pg, op1, op2, op3) simde_svmad_u32_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svmad_u32_m(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2, simde_svuint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u32_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_u32(pg, simde_svmad_u32_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u32_m
+  #define svmad_u32_m(pg, op1, op2, op3) simde_svmad_u32_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svmad_n_u32_x(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2, uint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u32_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u32_x(pg, op1, op2, simde_svdup_n_u32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u32_x
+  #define svmad_n_u32_x(pg, op1, op2, op3) simde_svmad_n_u32_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svmad_n_u32_z(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2, uint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u32_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u32_z(pg, op1, op2, simde_svdup_n_u32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u32_z
+  #define svmad_n_u32_z(pg, op1, op2, op3) simde_svmad_n_u32_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint32_t
+simde_svmad_n_u32_m(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2, uint32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u32_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u32_m(pg, op1, op2, simde_svdup_n_u32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u32_m
+  #define svmad_n_u32_m(pg, op1, op2, op3) simde_svmad_n_u32_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svmad_u64_x(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2, simde_svuint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u64_x(pg, op1, op2, op3);
+  #else
+    simde_svuint64_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) && defined(SIMDE_X86_AVX512DQ_NATIVE)
+      r.m512i = _mm512_add_epi64(op3.m512i, _mm512_mullo_epi64(op1.m512i, op2.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512DQ_NATIVE)
+      r.m256i[0] = _mm256_add_epi64(op3.m256i[0], _mm256_mullo_epi64(op1.m256i[0], op2.m256i[0]));
+    #elif defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r.altivec = op3.altivec + (op1.altivec * op2.altivec);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = op3.values[i] + (op1.values[i] * op2.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u64_x
+  #define svmad_u64_x(pg, op1, op2, op3) simde_svmad_u64_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svmad_u64_z(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2, simde_svuint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u64_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_u64_z(pg, simde_svmad_u64_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u64_z
+  #define svmad_u64_z(pg, op1, op2, op3) simde_svmad_u64_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svmad_u64_m(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2, simde_svuint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_u64_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_u64(pg, simde_svmad_u64_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_u64_m
+  #define svmad_u64_m(pg, op1, op2, op3) simde_svmad_u64_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svmad_n_u64_x(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2, uint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u64_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u64_x(pg, op1, op2, simde_svdup_n_u64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u64_x
+  #define svmad_n_u64_x(pg, op1, op2, op3) simde_svmad_n_u64_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svmad_n_u64_z(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2, uint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u64_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u64_z(pg, op1, op2, simde_svdup_n_u64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u64_z
+  #define svmad_n_u64_z(pg, op1, op2, op3) simde_svmad_n_u64_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svuint64_t
+simde_svmad_n_u64_m(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2, uint64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_u64_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_u64_m(pg, op1, op2, simde_svdup_n_u64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_u64_m
+  #define svmad_n_u64_m(pg, op1, op2, op3) simde_svmad_n_u64_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svmad_f32_x(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_svfloat32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_f32_x(pg, op1, op2, op3);
+  #else
+    simde_svfloat32_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARCH_ARM_FMA)
+      r.neon = vfmaq_f32(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512 = _mm512_fmadd_ps(op1.m512, op2.m512, op3.m512);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r.m256[0] = _mm256_fmadd_ps(op1.m256[0], op2.m256[0], op3.m256[0]);
+    #elif defined(SIMDE_X86_FMA_NATIVE) && defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256) / sizeof(r.m256[0])) ; i++) {
+        r.m256[i] = _mm256_fmadd_ps(op1.m256[i], op2.m256[i], op3.m256[i]);
+      }
+    #elif defined(SIMDE_X86_FMA_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128) / sizeof(r.m128[0])) ; i++) {
+        r.m128[i] = _mm_fmadd_ps(op1.m128[i], op2.m128[i], op3.m128[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = op3.values[i] + (op1.values[i] * op2.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_f32_x
+  #define svmad_f32_x(pg, op1, op2, op3) simde_svmad_f32_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svmad_f32_z(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_svfloat32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_f32_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_f32_z(pg, simde_svmad_f32_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_f32_z
+  #define svmad_f32_z(pg, op1, op2, op3) simde_svmad_f32_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svmad_f32_m(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_svfloat32_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_f32_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_f32(pg, simde_svmad_f32_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_f32_m
+  #define svmad_f32_m(pg, op1, op2, op3) simde_svmad_f32_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svmad_n_f32_x(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_float32 op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_f32_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_f32_x(pg, op1, op2, simde_svdup_n_f32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_f32_x
+  #define svmad_n_f32_x(pg, op1, op2, op3) simde_svmad_n_f32_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svmad_n_f32_z(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_float32 op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_f32_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_f32_z(pg, op1, op2, simde_svdup_n_f32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_f32_z
+  #define svmad_n_f32_z(pg, op1, op2, op3) simde_svmad_n_f32_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat32_t
+simde_svmad_n_f32_m(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_float32 op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_f32_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_f32_m(pg, op1, op2, simde_svdup_n_f32(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_f32_m
+  #define svmad_n_f32_m(pg, op1, op2, op3) simde_svmad_n_f32_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svmad_f64_x(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_svfloat64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_f64_x(pg, op1, op2, op3);
+  #else
+    simde_svfloat64_t r;
+    HEDLEY_STATIC_CAST(void, pg);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r.neon = vfmaq_f64(op3.neon, op1.neon, op2.neon);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512)
+      r.m512d = _mm512_fmadd_pd(op1.m512d, op2.m512d, op3.m512d);
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r.m256d[0] = _mm256_fmadd_pd(op1.m256d[0], op2.m256d[0], op3.m256d[0]);
+    #elif defined(SIMDE_X86_FMA_NATIVE) && defined(SIMDE_X86_AVX2_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256d) / sizeof(r.m256d[0])) ; i++) {
+        r.m256d[i] = _mm256_fmadd_pd(op1.m256d[i], op2.m256d[i], op3.m256d[i]);
+      }
+    #elif defined(SIMDE_X86_FMA_NATIVE)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128d) / sizeof(r.m128d[0])) ; i++) {
+        r.m128d[i] = _mm_fmadd_pd(op1.m128d[i], op2.m128d[i], op3.m128d[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r.values = op3.values + (op1.values * op2.values);
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.values) / sizeof(r.values[0])) ; i++) {
+        r.values[i] = op3.values[i] + (op1.values[i] * op2.values[i]);
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_f64_x
+  #define svmad_f64_x(pg, op1, op2, op3) simde_svmad_f64_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svmad_f64_z(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_svfloat64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_f64_z(pg, op1, op2, op3);
+  #else
+    return simde_x_svsel_f64_z(pg, simde_svmad_f64_x(pg, op1, op2, op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_f64_z
+  #define svmad_f64_z(pg, op1, op2, op3) simde_svmad_f64_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svmad_f64_m(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_svfloat64_t op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_f64_m(pg, op1, op2, op3);
+  #else
+    return simde_svsel_f64(pg, simde_svmad_f64_x(pg, op1, op2, op3), op1);
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_f64_m
+  #define svmad_f64_m(pg, op1, op2, op3) simde_svmad_f64_m(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svmad_n_f64_x(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_float64 op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_f64_x(pg, op1, op2, op3);
+  #else
+    return simde_svmad_f64_x(pg, op1, op2, simde_svdup_n_f64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_f64_x
+  #define svmad_n_f64_x(pg, op1, op2, op3) simde_svmad_n_f64_x(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svmad_n_f64_z(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_float64 op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_f64_z(pg, op1, op2, op3);
+  #else
+    return simde_svmad_f64_z(pg, op1, op2, simde_svdup_n_f64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_f64_z
+  #define svmad_n_f64_z(pg, op1, op2, op3) simde_svmad_n_f64_z(pg, op1, op2, op3)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svfloat64_t
+simde_svmad_n_f64_m(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_float64 op3) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmad_n_f64_m(pg, op1, op2, op3);
+  #else
+    return simde_svmad_f64_m(pg, op1, op2, simde_svdup_n_f64(op3));
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmad_n_f64_m
+  #define svmad_n_f64_m(pg, op1, op2, op3) simde_svmad_n_f64_m(pg, op1, op2, op3)
+#endif
+
+#if defined(__cplusplus)
+  SIMDE_FUNCTION_ATTRIBUTES    simde_svint8_t simde_svmad_x(simde_svbool_t pg,    simde_svint8_t op1,    simde_svint8_t op2,    simde_svint8_t op3) { return simde_svmad_s8_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint16_t simde_svmad_x(simde_svbool_t pg,   simde_svint16_t op1,   simde_svint16_t op2,   simde_svint16_t op3) { return simde_svmad_s16_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svmad_x(simde_svbool_t pg,   simde_svint32_t op1,   simde_svint32_t op2,   simde_svint32_t op3) { return simde_svmad_s32_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svmad_x(simde_svbool_t pg,   simde_svint64_t op1,   simde_svint64_t op2,   simde_svint64_t op3) { return simde_svmad_s64_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svuint8_t simde_svmad_x(simde_svbool_t pg,   simde_svuint8_t op1,   simde_svuint8_t op2,   simde_svuint8_t op3) { return simde_svmad_u8_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint16_t simde_svmad_x(simde_svbool_t pg,  simde_svuint16_t op1,  simde_svuint16_t op2,  simde_svuint16_t op3) { return simde_svmad_u16_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svmad_x(simde_svbool_t pg,  simde_svuint32_t op1,  simde_svuint32_t op2,  simde_svuint32_t op3) { return simde_svmad_u32_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svmad_x(simde_svbool_t pg,  simde_svuint64_t op1,  simde_svuint64_t op2,  simde_svuint64_t op3) { return simde_svmad_u64_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svmad_x(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_svfloat32_t op3) { return simde_svmad_f32_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svmad_x(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_svfloat64_t op3) { return simde_svmad_f64_x(pg, op1, op2, op3); }
+
+  SIMDE_FUNCTION_ATTRIBUTES    simde_svint8_t simde_svmad_z(simde_svbool_t pg,    simde_svint8_t op1,    simde_svint8_t op2,    simde_svint8_t op3) { return simde_svmad_s8_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint16_t simde_svmad_z(simde_svbool_t pg,   simde_svint16_t op1,   simde_svint16_t op2,   simde_svint16_t op3) { return simde_svmad_s16_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svmad_z(simde_svbool_t pg,   simde_svint32_t op1,   simde_svint32_t op2,   simde_svint32_t op3) { return simde_svmad_s32_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svmad_z(simde_svbool_t pg,   simde_svint64_t op1,   simde_svint64_t op2,   simde_svint64_t op3) { return simde_svmad_s64_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svuint8_t simde_svmad_z(simde_svbool_t pg,   simde_svuint8_t op1,   simde_svuint8_t op2,   simde_svuint8_t op3) { return simde_svmad_u8_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint16_t simde_svmad_z(simde_svbool_t pg,  simde_svuint16_t op1,  simde_svuint16_t op2,  simde_svuint16_t op3) { return simde_svmad_u16_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svmad_z(simde_svbool_t pg,  simde_svuint32_t op1,  simde_svuint32_t op2,  simde_svuint32_t op3) { return simde_svmad_u32_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svmad_z(simde_svbool_t pg,  simde_svuint64_t op1,  simde_svuint64_t op2,  simde_svuint64_t op3) { return simde_svmad_u64_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svmad_z(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_svfloat32_t op3) { return simde_svmad_f32_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svmad_z(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_svfloat64_t op3) { return simde_svmad_f64_z(pg, op1, op2, op3); }
+
+  SIMDE_FUNCTION_ATTRIBUTES    simde_svint8_t simde_svmad_m(simde_svbool_t pg,    simde_svint8_t op1,    simde_svint8_t op2,    simde_svint8_t op3) { return simde_svmad_s8_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint16_t simde_svmad_m(simde_svbool_t pg,   simde_svint16_t op1,   simde_svint16_t op2,   simde_svint16_t op3) { return simde_svmad_s16_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svmad_m(simde_svbool_t pg,   simde_svint32_t op1,   simde_svint32_t op2,   simde_svint32_t op3) { return simde_svmad_s32_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svmad_m(simde_svbool_t pg,   simde_svint64_t op1,   simde_svint64_t op2,   simde_svint64_t op3) { return simde_svmad_s64_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svuint8_t simde_svmad_m(simde_svbool_t pg,   simde_svuint8_t op1,   simde_svuint8_t op2,   simde_svuint8_t op3) { return simde_svmad_u8_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint16_t simde_svmad_m(simde_svbool_t pg,  simde_svuint16_t op1,  simde_svuint16_t op2,  simde_svuint16_t op3) { return simde_svmad_u16_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svmad_m(simde_svbool_t pg,  simde_svuint32_t op1,  simde_svuint32_t op2,  simde_svuint32_t op3) { return simde_svmad_u32_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svmad_m(simde_svbool_t pg,  simde_svuint64_t op1,  simde_svuint64_t op2,  simde_svuint64_t op3) { return simde_svmad_u64_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svmad_m(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2, simde_svfloat32_t op3) { return simde_svmad_f32_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svmad_m(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2, simde_svfloat64_t op3) { return simde_svmad_f64_m(pg, op1, op2, op3); }
+
+  SIMDE_FUNCTION_ATTRIBUTES    simde_svint8_t simde_svmad_x(simde_svbool_t pg,    simde_svint8_t op1,    simde_svint8_t op2,            int8_t op3) { return simde_svmad_n_s8_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint16_t simde_svmad_x(simde_svbool_t pg,   simde_svint16_t op1,   simde_svint16_t op2,           int16_t op3) { return simde_svmad_n_s16_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svmad_x(simde_svbool_t pg,   simde_svint32_t op1,   simde_svint32_t op2,           int32_t op3) { return simde_svmad_n_s32_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svmad_x(simde_svbool_t pg,   simde_svint64_t op1,   simde_svint64_t op2,           int64_t op3) { return simde_svmad_n_s64_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svuint8_t simde_svmad_x(simde_svbool_t pg,   simde_svuint8_t op1,   simde_svuint8_t op2,           uint8_t op3) { return simde_svmad_n_u8_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint16_t simde_svmad_x(simde_svbool_t pg,  simde_svuint16_t op1,  simde_svuint16_t op2,          uint16_t op3) { return simde_svmad_n_u16_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svmad_x(simde_svbool_t pg,  simde_svuint32_t op1,  simde_svuint32_t op2,          uint32_t op3) { return simde_svmad_n_u32_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svmad_x(simde_svbool_t pg,  simde_svuint64_t op1,  simde_svuint64_t op2,          uint64_t op3) { return simde_svmad_n_u64_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svmad_x(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2,     simde_float32 op3) { return simde_svmad_n_f32_x(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svmad_x(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2,     simde_float64 op3) { return simde_svmad_n_f64_x(pg, op1, op2, op3); }
+
+  SIMDE_FUNCTION_ATTRIBUTES    simde_svint8_t simde_svmad_z(simde_svbool_t pg,    simde_svint8_t op1,    simde_svint8_t op2,            int8_t op3) { return simde_svmad_n_s8_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint16_t simde_svmad_z(simde_svbool_t pg,   simde_svint16_t op1,   simde_svint16_t op2,           int16_t op3) { return simde_svmad_n_s16_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svmad_z(simde_svbool_t pg,   simde_svint32_t op1,   simde_svint32_t op2,           int32_t op3) { return simde_svmad_n_s32_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svmad_z(simde_svbool_t pg,   simde_svint64_t op1,   simde_svint64_t op2,           int64_t op3) { return simde_svmad_n_s64_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svuint8_t simde_svmad_z(simde_svbool_t pg,   simde_svuint8_t op1,   simde_svuint8_t op2,           uint8_t op3) { return simde_svmad_n_u8_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint16_t simde_svmad_z(simde_svbool_t pg,  simde_svuint16_t op1,  simde_svuint16_t op2,          uint16_t op3) { return simde_svmad_n_u16_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svmad_z(simde_svbool_t pg,  simde_svuint32_t op1,  simde_svuint32_t op2,          uint32_t op3) { return simde_svmad_n_u32_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svmad_z(simde_svbool_t pg,  simde_svuint64_t op1,  simde_svuint64_t op2,          uint64_t op3) { return simde_svmad_n_u64_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svmad_z(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2,     simde_float32 op3) { return simde_svmad_n_f32_z(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svmad_z(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2,     simde_float64 op3) { return simde_svmad_n_f64_z(pg, op1, op2, op3); }
+
+  SIMDE_FUNCTION_ATTRIBUTES    simde_svint8_t simde_svmad_m(simde_svbool_t pg,    simde_svint8_t op1,    simde_svint8_t op2,            int8_t op3) { return simde_svmad_n_s8_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint16_t simde_svmad_m(simde_svbool_t pg,   simde_svint16_t op1,   simde_svint16_t op2,           int16_t op3) { return simde_svmad_n_s16_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint32_t simde_svmad_m(simde_svbool_t pg,   simde_svint32_t op1,   simde_svint32_t op2,           int32_t op3) { return simde_svmad_n_s32_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svint64_t simde_svmad_m(simde_svbool_t pg,   simde_svint64_t op1,   simde_svint64_t op2,           int64_t op3) { return simde_svmad_n_s64_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES   simde_svuint8_t simde_svmad_m(simde_svbool_t pg,   simde_svuint8_t op1,   simde_svuint8_t op2,           uint8_t op3) { return simde_svmad_n_u8_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint16_t simde_svmad_m(simde_svbool_t pg,  simde_svuint16_t op1,  simde_svuint16_t op2,          uint16_t op3) { return simde_svmad_n_u16_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint32_t simde_svmad_m(simde_svbool_t pg,  simde_svuint32_t op1,  simde_svuint32_t op2,          uint32_t op3) { return simde_svmad_n_u32_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES  simde_svuint64_t simde_svmad_m(simde_svbool_t pg,  simde_svuint64_t op1,  simde_svuint64_t op2,          uint64_t op3) { return simde_svmad_n_u64_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat32_t simde_svmad_m(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2,     simde_float32 op3) { return simde_svmad_n_f32_m(pg, op1, op2, op3); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_svfloat64_t simde_svmad_m(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2,     simde_float64 op3) { return simde_svmad_n_f64_m(pg, op1, op2, op3); }
+#elif defined(SIMDE_GENERIC_)
+  #define simde_svmad_x(pg, op1, op2, op3) \
+    (SIMDE_GENERIC_((op3), \
+         simde_svint8_t: simde_svmad_s8_x, \
+        simde_svint16_t: simde_svmad_s16_x, \
+        simde_svint32_t: simde_svmad_s32_x, \
+        simde_svint64_t: simde_svmad_s64_x, \
+        simde_svuint8_t: simde_svmad_u8_x, \
+       simde_svuint16_t: simde_svmad_u16_x, \
+       simde_svuint32_t: simde_svmad_u32_x, \
+       simde_svuint64_t: simde_svmad_u64_x, \
+      simde_svfloat32_t: simde_svmad_f32_x, \
+      simde_svfloat64_t: simde_svmad_f64_x, \
+                 int8_t: simde_svmad_n_s8_x, \
+                int16_t: simde_svmad_n_s16_x, \
+                int32_t: simde_svmad_n_s32_x, \
+                int64_t: simde_svmad_n_s64_x, \
+                uint8_t: simde_svmad_n_u8_x, \
+               uint16_t: simde_svmad_n_u16_x, \
+               uint32_t: simde_svmad_n_u32_x, \
+               uint64_t: simde_svmad_n_u64_x, \
+          simde_float32: simde_svmad_n_f32_x, \
+          simde_float64: simde_svmad_n_f64_x)((pg), (op1), (op2), (op3)))
+
+  #define simde_svmad_z(pg, op1, op2, op3) \
+    (SIMDE_GENERIC_((op3), \
+         simde_svint8_t: simde_svmad_s8_z, \
+        simde_svint16_t: simde_svmad_s16_z, \
+        simde_svint32_t: simde_svmad_s32_z, \
+        simde_svint64_t: simde_svmad_s64_z, \
+        simde_svuint8_t: simde_svmad_u8_z, \
+       simde_svuint16_t: simde_svmad_u16_z, \
+       simde_svuint32_t: simde_svmad_u32_z, \
+       simde_svuint64_t: simde_svmad_u64_z, \
+      simde_svfloat32_t: simde_svmad_f32_z, \
+      simde_svfloat64_t: simde_svmad_f64_z, \
+                 int8_t: simde_svmad_n_s8_z, \
+                int16_t: simde_svmad_n_s16_z, \
+                int32_t: simde_svmad_n_s32_z, \
+                int64_t: simde_svmad_n_s64_z, \
+                uint8_t: simde_svmad_n_u8_z, \
+               uint16_t: simde_svmad_n_u16_z, \
+               uint32_t: simde_svmad_n_u32_z, \
+               uint64_t: simde_svmad_n_u64_z, \
+          simde_float32: simde_svmad_n_f32_z, \
+          simde_float64: simde_svmad_n_f64_z)((pg), (op1), (op2), (op3)))
+
+  #define simde_svmad_m(pg, op1, op2, op3) \
+    (SIMDE_GENERIC_((op3), \
+         simde_svint8_t: simde_svmad_s8_m, \
+        simde_svint16_t: simde_svmad_s16_m, \
+        simde_svint32_t: simde_svmad_s32_m, \
+        simde_svint64_t: simde_svmad_s64_m, \
+        simde_svuint8_t: simde_svmad_u8_m, \
+       simde_svuint16_t: simde_svmad_u16_m, \
+       simde_svuint32_t: simde_svmad_u32_m, \
+       simde_svuint64_t: simde_svmad_u64_m, \
+      simde_svfloat32_t: simde_svmad_f32_m, \
+      simde_svfloat64_t: simde_svmad_f64_m, \
+                 int8_t: simde_svmad_n_s8_m, \
+                int16_t: simde_svmad_n_s16_m, \
+                int32_t: simde_svmad_n_s32_m, \
+                int64_t: simde_svmad_n_s64_m, \
+                uint8_t: simde_svmad_n_u8_m, \
+               uint16_t: simde_svmad_n_u16_m, \
+               uint32_t: simde_svmad_n_u32_m, \
+               uint64_t: simde_svmad_n_u64_m, \
+          simde_float32: simde_svmad_n_f32_m, \
+          simde_float64: simde_svmad_n_f64_m)((pg), (op1), (op2), (op3)))
+#endif
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef svmad_x
+  #undef svmad_z
+  #undef svmad_m
+  #undef svmad_n_x
+  #undef svmad_n_z
+  #undef svmad_n_m
+  #define svmad_x(pg, op1, op2, op3) simde_svmad_x((pg), (op1), (op2), (op3))
+  #define svmad_z(pg, op1, op2, op3) simde_svmad_z((pg), (op1), (op2), (op3))
+  #define svmad_m(pg, op1, op2, op3) simde_svmad_m((pg), (op1), (op2), (op3))
+  #define svmad_n_x(pg, op1, op2, op3) simde_svmad_n_x((pg), (op1), (op2), (op3))
+  #define svmad_n_z(pg, op1, op2, op3) simde_svmad_n_z((pg), (op1), (op2), (op3))
+  #define svmad_n_m(pg, op1, op2, op3) simde_svmad_n_m((pg), (op1), (op2), (op3))
+#endif
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* SIMDE_ARM_SVE_MAD_H */
@@ -0,0 +1,492 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_SVE_MAXV_H)
+#define SIMDE_ARM_SVE_MAXV_H
+
+#include "types.h"
+#include "sel.h"
+#include "dup.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+SIMDE_FUNCTION_ATTRIBUTES
+int8_t
+simde_svmaxv_s8(simde_svbool_t pg, simde_svint8_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_s8(pg, op);
+  #else
+    int8_t r = INT8_MIN;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_mask_mov_epi8(_mm512_set1_epi8(INT8_MIN), simde_svbool_to_mmask64(pg), op.m512i);
+      __m256i w = _mm256_max_epi8(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+      __m128i x = _mm_max_epi8(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi8(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi8(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epi8(x, _mm_shufflelo_epi16(x, 0xb1));
+      x = _mm_max_epi8(x, _mm_srli_epi16(x, 8));
+      r = HEDLEY_STATIC_CAST(int8_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m256i w = _mm256_mask_mov_epi8(_mm256_set1_epi8(INT8_MIN), simde_svbool_to_mmask32(pg), op.m256i[0]);
+      __m128i x = _mm_max_epi8(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi8(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi8(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epi8(x, _mm_shufflelo_epi16(x, 0xb1));
+      x = _mm_max_epi8(x, _mm_srli_epi16(x, 8));
+      r = HEDLEY_STATIC_CAST(int8_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i id = _mm256_set1_epi8(INT8_MIN), w = id;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        w = _mm256_max_epi8(w, _mm256_blendv_epi8(id, op.m256i[i], pg.m256i[i]));
+      }
+      __m128i x = _mm_max_epi8(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi8(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi8(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epi8(x, _mm_shufflelo_epi16(x, 0xb1));
+      x = _mm_max_epi8(x, _mm_srli_epi16(x, 8));
+      r = HEDLEY_STATIC_CAST(int8_t, _mm_cvtsi128_si32(x));
+    #else
+      simde_svint8_t v = simde_svsel_s8(pg, op, simde_svdup_n_s8(INT8_MIN));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_s8
+  #define svmaxv_s8(pg, op) simde_svmaxv_s8((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int16_t
+simde_svmaxv_s16(simde_svbool_t pg, simde_svint16_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_s16(pg, op);
+  #else
+    int16_t r = INT16_MIN;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_mask_mov_epi16(_mm512_set1_epi16(INT16_MIN), simde_svbool_to_mmask32(pg), op.m512i);
+      __m256i w = _mm256_max_epi16(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+      __m128i x = _mm_max_epi16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi16(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi16(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epi16(x, _mm_shufflelo_epi16(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(int16_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m256i w = _mm256_mask_mov_epi16(_mm256_set1_epi16(INT16_MIN), simde_svbool_to_mmask16(pg), op.m256i[0]);
+      __m128i x = _mm_max_epi16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi16(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi16(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epi16(x, _mm_shufflelo_epi16(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(int16_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i id = _mm256_set1_epi16(INT16_MIN), w = id;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        w = _mm256_max_epi16(w, _mm256_blendv_epi8(id, op.m256i[i], pg.m256i[i]));
+      }
+      __m128i x = _mm_max_epi16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi16(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi16(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epi16(x, _mm_shufflelo_epi16(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(int16_t, _mm_cvtsi128_si32(x));
+    #else
+      simde_svint16_t v = simde_svsel_s16(pg, op, simde_svdup_n_s16(INT16_MIN));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_s16
+  #define svmaxv_s16(pg, op) simde_svmaxv_s16((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_svmaxv_s32(simde_svbool_t pg, simde_svint32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_s32(pg, op);
+  #else
+    int32_t r = INT32_MIN;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(int32_t, _mm512_mask_reduce_max_epi32(simde_svbool_to_mmask16(pg), op.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m256i w = _mm256_mask_mov_epi32(_mm256_set1_epi32(INT32_MIN), simde_svbool_to_mmask8(pg), op.m256i[0]);
+      __m128i x = _mm_max_epi32(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi32(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi32(x, _mm_shuffle_epi32(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(int32_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i id = _mm256_set1_epi32(INT32_MIN), w = id;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        w = _mm256_max_epi32(w, _mm256_blendv_epi8(id, op.m256i[i], pg.m256i[i]));
+      }
+      __m128i x = _mm_max_epi32(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi32(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epi32(x, _mm_shuffle_epi32(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(int32_t, _mm_cvtsi128_si32(x));
+    #else
+      simde_svint32_t v = simde_svsel_s32(pg, op, simde_svdup_n_s32(INT32_MIN));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_s32
+  #define svmaxv_s32(pg, op) simde_svmaxv_s32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_svmaxv_s64(simde_svbool_t pg, simde_svint64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_s64(pg, op);
+  #else
+    int64_t r = INT64_MIN;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(int64_t, _mm512_mask_reduce_max_epi64(simde_svbool_to_mmask8(pg), op.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i w = _mm256_mask_mov_epi64(_mm256_set1_epi64x(INT64_MIN), simde_svbool_to_mmask4(pg), op.m256i[0]);
+      __m128i x = _mm_max_epi64(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epi64(x, _mm_shuffle_epi32(x, 0x4e));
+      r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(x));
+    #else
+      simde_svint64_t v = simde_svsel_s64(pg, op, simde_svdup_n_s64(INT64_MIN));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_s64
+  #define svmaxv_s64(pg, op) simde_svmaxv_s64((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_svmaxv_u8(simde_svbool_t pg, simde_svuint8_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_u8(pg, op);
+  #else
+    uint8_t r = UINT8_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_mask_mov_epi8(_mm512_set1_epi8(INT8_C(0)), simde_svbool_to_mmask64(pg), op.m512i);
+      __m256i w = _mm256_max_epu8(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+      __m128i x = _mm_max_epu8(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu8(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu8(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epu8(x, _mm_shufflelo_epi16(x, 0xb1));
+      x = _mm_max_epu8(x, _mm_srli_epi16(x, 8));
+      r = HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m256i w = _mm256_mask_mov_epi8(_mm256_set1_epi8(INT8_C(0)), simde_svbool_to_mmask32(pg), op.m256i[0]);
+      __m128i x = _mm_max_epu8(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu8(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu8(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epu8(x, _mm_shufflelo_epi16(x, 0xb1));
+      x = _mm_max_epu8(x, _mm_srli_epi16(x, 8));
+      r = HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i id = _mm256_set1_epi8(INT8_C(0)), w = id;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        w = _mm256_max_epu8(w, _mm256_blendv_epi8(id, op.m256i[i], pg.m256i[i]));
+      }
+      __m128i x = _mm_max_epu8(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu8(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu8(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epu8(x, _mm_shufflelo_epi16(x, 0xb1));
+      x = _mm_max_epu8(x, _mm_srli_epi16(x, 8));
+      r = HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(x));
+    #else
+      simde_svuint8_t v = simde_svsel_u8(pg, op, simde_svdup_n_u8(UINT8_C(0)));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_u8
+  #define svmaxv_u8(pg, op) simde_svmaxv_u8((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint16_t
+simde_svmaxv_u16(simde_svbool_t pg, simde_svuint16_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_u16(pg, op);
+  #else
+    uint16_t r = UINT16_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m512i v = _mm512_mask_mov_epi16(_mm512_set1_epi16(INT16_C(0)), simde_svbool_to_mmask32(pg), op.m512i);
+      __m256i w = _mm256_max_epu16(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+      __m128i x = _mm_max_epu16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu16(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu16(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epu16(x, _mm_shufflelo_epi16(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m256i w = _mm256_mask_mov_epi16(_mm256_set1_epi16(INT16_C(0)), simde_svbool_to_mmask16(pg), op.m256i[0]);
+      __m128i x = _mm_max_epu16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu16(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu16(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epu16(x, _mm_shufflelo_epi16(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i id = _mm256_set1_epi16(INT16_C(0)), w = id;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        w = _mm256_max_epu16(w, _mm256_blendv_epi8(id, op.m256i[i], pg.m256i[i]));
+      }
+      __m128i x = _mm_max_epu16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu16(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu16(x, _mm_shuffle_epi32(x, 0xb1));
+      x = _mm_max_epu16(x, _mm_shufflelo_epi16(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(x));
+    #else
+      simde_svuint16_t v = simde_svsel_u16(pg, op, simde_svdup_n_u16(UINT16_C(0)));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_u16
+  #define svmaxv_u16(pg, op) simde_svmaxv_u16((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_svmaxv_u32(simde_svbool_t pg, simde_svuint32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_u32(pg, op);
+  #else
+    uint32_t r = UINT32_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(uint32_t, _mm512_mask_reduce_max_epu32(simde_svbool_to_mmask16(pg), op.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      __m256i w = _mm256_mask_mov_epi32(_mm256_set1_epi32(INT32_C(0)), simde_svbool_to_mmask8(pg), op.m256i[0]);
+      __m128i x = _mm_max_epu32(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu32(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu32(x, _mm_shuffle_epi32(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(x));
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i id = _mm256_set1_epi32(INT32_C(0)), w = id;
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(op.m256i) / sizeof(op.m256i[0])) ; i++) {
+        w = _mm256_max_epu32(w, _mm256_blendv_epi8(id, op.m256i[i], pg.m256i[i]));
+      }
+      __m128i x = _mm_max_epu32(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu32(x, _mm_shuffle_epi32(x, 0x4e));
+      x = _mm_max_epu32(x, _mm_shuffle_epi32(x, 0xb1));
+      r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(x));
+    #else
+      simde_svuint32_t v = simde_svsel_u32(pg, op, simde_svdup_n_u32(UINT32_C(0)));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_u32
+  #define svmaxv_u32(pg, op) simde_svmaxv_u32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_svmaxv_u64(simde_svbool_t pg, simde_svuint64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_u64(pg, op);
+  #else
+    uint64_t r = UINT64_C(0);
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm512_mask_reduce_max_epu64(simde_svbool_to_mmask8(pg), op.m512i));
+    #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_ARCH_AMD64)
+      __m256i w = _mm256_mask_mov_epi64(_mm256_set1_epi64x(INT64_C(0)), simde_svbool_to_mmask4(pg), op.m256i[0]);
+      __m128i x = _mm_max_epu64(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+      x = _mm_max_epu64(x, _mm_shuffle_epi32(x, 0x4e));
+      r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(x));
+    #else
+      simde_svuint64_t v = simde_svsel_u64(pg, op, simde_svdup_n_u64(UINT64_C(0)));
+      SIMDE_VECTORIZE_REDUCTION(max:r)
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        r = (v.values[i] > r) ? v.values[i] : r;
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_u64
+  #define svmaxv_u64(pg, op) simde_svmaxv_u64((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_svmaxv_f32(simde_svbool_t pg, simde_svfloat32_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_f32(pg, op);
+  #else
+    simde_float32 r = -SIMDE_MATH_INFINITYF;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_FAST_NANS)
+      r = _mm512_mask_reduce_max_ps(simde_svbool_to_mmask16(pg), op.m512);
+    #else
+      simde_svfloat32_t v = simde_svsel_f32(pg, op, simde_svdup_n_f32(-SIMDE_MATH_INFINITYF));
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        #if !defined(SIMDE_FAST_NANS)
+          r = ((v.values[i] > r) || simde_math_isnanf(v.values[i])) ? v.values[i] : r;
+        #else
+          r = (v.values[i] > r) ? v.values[i] : r;
+        #endif
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_f32
+  #define svmaxv_f32(pg, op) simde_svmaxv_f32((pg), (op))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_svmaxv_f64(simde_svbool_t pg, simde_svfloat64_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svmaxv_f64(pg, op);
+  #else
+    simde_float64 r = -SIMDE_MATH_INFINITY;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+        && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0)) \
+        && defined(SIMDE_FAST_NANS)
+      r = _mm512_mask_reduce_max_pd(simde_svbool_to_mmask8(pg), op.m512d);
+    #else
+      simde_svfloat64_t v = simde_svsel_f64(pg, op, simde_svdup_n_f64(-SIMDE_MATH_INFINITY));
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(v.values) / sizeof(v.values[0])) ; i++) {
+        #if !defined(SIMDE_FAST_NANS)
+          r = ((v.values[i] > r) || simde_math_isnan(v.values[i])) ? v.values[i] : r;
+        #else
+          r = (v.values[i] > r) ? v.values[i] : r;
+        #endif
+      }
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svmaxv_f64
+  #define svmaxv_f64(pg, op) simde_svmaxv_f64((pg), (op))
+#endif
+
+#if defined(__cplusplus)
+  SIMDE_FUNCTION_ATTRIBUTES        int8_t simde_svmaxv(simde_svbool_t pg,    simde_svint8_t op) { return simde_svmaxv_s8 (pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       int16_t simde_svmaxv(simde_svbool_t pg,   simde_svint16_t op) { return simde_svmaxv_s16(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       int32_t simde_svmaxv(simde_svbool_t pg,   simde_svint32_t op) { return simde_svmaxv_s32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       int64_t simde_svmaxv(simde_svbool_t pg,   simde_svint64_t op) { return simde_svmaxv_s64(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES       uint8_t simde_svmaxv(simde_svbool_t pg,   simde_svuint8_t op) { return simde_svmaxv_u8 (pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint16_t simde_svmaxv(simde_svbool_t pg,  simde_svuint16_t op) { return simde_svmaxv_u16(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint32_t simde_svmaxv(simde_svbool_t pg,  simde_svuint32_t op) { return simde_svmaxv_u32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES      uint64_t simde_svmaxv(simde_svbool_t pg,  simde_svuint64_t op) { return simde_svmaxv_u64(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_float32 simde_svmaxv(simde_svbool_t pg, simde_svfloat32_t op) { return simde_svmaxv_f32(pg, op); }
+  SIMDE_FUNCTION_ATTRIBUTES simde_float64 simde_svmaxv(simde_svbool_t pg, simde_svfloat64_t op) { return simde_svmaxv_f64(pg, op); }
+#elif defined(SIMDE_GENERIC_)
+  #define simde_svmaxv(pg, op) \
+    (SIMDE_GENERIC_((op), \
+         simde_svint8_t: simde_svmaxv_s8 , \
+        simde_svint16_t: simde_svmaxv_s16, \
+        simde_svint32_t: simde_svmaxv_s32, \
+        simde_svint64_t: simde_svmaxv_s64, \
+        simde_svuint8_t: simde_svmaxv_u8 , \
+       simde_svuint16_t: simde_svmaxv_u16, \
+       simde_svuint32_t: simde_svmaxv_u32, \
+       simde_svuint64_t: simde_svmaxv_u64, \
+      simde_svfloat32_t: simde_svmaxv_f32, \
+      simde_svfloat64_t: simde_svmaxv_f64)((pg), (op)))
+#endif
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef svmaxv
+  #define svmaxv(pg, op) simde_svmaxv((pg), (op))
+#endif
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* SIMDE_ARM_SVE_MAXV_H */
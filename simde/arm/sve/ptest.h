@@ -32,6 +32,67 @@
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 
+#if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+  /* Predicates produced for different element sizes use different
+   * mask layouts; bring both operands to the same one (one bit per
+   * byte) before comparing bit positions. */
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_svptest_masks(simde_svbool_t pg, simde_svbool_t op, __mmask64* pm, __mmask64* om) {
+    if (HEDLEY_LIKELY(pg.type == op.type)) {
+      *pm = pg.value;
+      *om = op.value;
+    } else {
+      *pm = simde_svbool_to_mmask64(pg);
+      *om = simde_svbool_to_mmask64(op);
+    }
+  }
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bool
+simde_svptest_any(simde_svbool_t pg, simde_svbool_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svptest_any(pg, op);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    __mmask64 pm, om;
+    simde_x_svptest_masks(pg, op, &pm, &om);
+    return (pm & om) != 0;
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      if (!_mm256_testz_si256(pg.m256i[i], op.m256i[i]))
+        return 1;
+    }
+
+    return 0;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m128i) / sizeof(pg.m128i[0])) ; i++) {
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        if (!_mm_testz_si128(pg.m128i[i], op.m128i[i]))
+          return 1;
+      #else
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(pg.m128i[i], op.m128i[i]), _mm_setzero_si128())) != 0xffff)
+          return 1;
+      #endif
+    }
+
+    return 0;
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vmaxvq_u8(vandq_u8(pg.neon_u8, op.neon_u8)) != 0;
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
+      if (pg.values_i8[i] & op.values_i8[i])
+        return 1;
+    }
+
+    return 0;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svptest_any
+  #define svptest_any(pg, op) simde_svptest_any(pg, op)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_bool
 simde_svptest_first(simde_svbool_t pg, simde_svbool_t op) {
@@ -39,17 +100,20 @@ simde_svptest_first(simde_svbool_t pg, simde_svbool_t op) {
     return svptest_first(pg, op);
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     if (HEDLEY_LIKELY(pg.value & 1))
-      return op.value & 1;
+      return (pg.type == op.type) ? (op.value & 1) : (simde_svbool_to_mmask64(op) & 1);
+
+    __mmask64 pm, om;
+    simde_x_svptest_masks(pg, op, &pm, &om);
 
-    if (pg.value == 0 || op.value == 0)
+    if (pm == 0 || om == 0)
       return 0;
 
     #if defined(_MSC_VER)
       unsigned long r = 0;
-      _BitScanForward64(&r, HEDLEY_STATIC_CAST(uint64_t, pg.value));
-      return (op.value >> r) & 1;
+      _BitScanForward64(&r, HEDLEY_STATIC_CAST(uint64_t, pm));
+      return (om >> r) & 1;
     #else
-      return (op.value >> __builtin_ctzll(HEDLEY_STATIC_CAST(unsigned long long, pg.value))) & 1;
+      return (om >> __builtin_ctzll(HEDLEY_STATIC_CAST(unsigned long long, pm))) & 1;
     #endif
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
@@ -66,6 +130,40 @@ simde_svptest_first(simde_svbool_t pg, simde_svbool_t op) {
   #define svptest_first(pg, op) simde_svptest_first(pg, op)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bool
+simde_svptest_last(simde_svbool_t pg, simde_svbool_t op) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svptest_last(pg, op);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    __mmask64 pm, om;
+    simde_x_svptest_masks(pg, op, &pm, &om);
+
+    if (pm == 0 || om == 0)
+      return 0;
+
+    #if defined(_MSC_VER)
+      unsigned long r = 0;
+      _BitScanReverse64(&r, HEDLEY_STATIC_CAST(uint64_t, pm));
+      return (om >> r) & 1;
+    #else
+      return (om >> (63 - __builtin_clzll(HEDLEY_STATIC_CAST(unsigned long long, pm)))) & 1;
+    #endif
+  #else
+    for (int i = HEDLEY_STATIC_CAST(int, simde_svcntb()) - 1 ; i >= 0 ; i--) {
+      if (pg.values_i8[i]) {
+        return !!op.values_i8[i];
+      }
+    }
+
+    return 0;
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svptest_last
+  #define svptest_last(pg, op) simde_svptest_last(pg, op)
+#endif
+
 HEDLEY_DIAGNOSTIC_POP
 
 #endif /* SIMDE_ARM_SVE_PTEST_H */
@@ -91,6 +91,10 @@ simde_svst1_s32(simde_svbool_t pg, int32_t * base, simde_svint32_t data) {
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     _mm256_mask_storeu_epi32(base, simde_svbool_to_mmask8(pg), data.m256i[0]);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int *, &(base[i * 8])), pg.m256i[i], data.m256i[i]);
+    }
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
       if (pg.values_i32[i]) {
@@ -115,6 +119,10 @@ simde_svst1_s64(simde_svbool_t pg, int64_t * base, simde_svint64_t data) {
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     _mm256_mask_storeu_epi64(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long *, &(base[i * 4])), pg.m256i[i], data.m256i[i]);
+    }
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
       if (pg.values_i64[i]) {
@@ -187,6 +195,10 @@ simde_svst1_u32(simde_svbool_t pg, uint32_t * base, simde_svuint32_t data) {
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     _mm256_mask_storeu_epi32(base, simde_svbool_to_mmask8(pg), data.m256i[0]);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int *, &(base[i * 8])), pg.m256i[i], data.m256i[i]);
+    }
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
       if (pg.values_u32[i]) {
@@ -211,6 +223,10 @@ simde_svst1_u64(simde_svbool_t pg, uint64_t * base, simde_svuint64_t data) {
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     _mm256_mask_storeu_epi64(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long *, &(base[i * 4])), pg.m256i[i], data.m256i[i]);
+    }
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
       if (pg.values_u64[i]) {
@@ -235,6 +251,10 @@ simde_svst1_f32(simde_svbool_t pg, simde_float32 * base, simde_svfloat32_t data)
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     _mm256_mask_storeu_ps(base, simde_svbool_to_mmask8(pg), data.m256[0]);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      _mm256_maskstore_ps(&(base[i * 8]), pg.m256i[i], data.m256[i]);
+    }
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
       if (pg.values_i32[i]) {
@@ -259,6 +279,10 @@ simde_svst1_f64(simde_svbool_t pg, simde_float64 * base, simde_svfloat64_t data)
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
     _mm256_mask_storeu_pd(base, simde_svbool_to_mmask4(pg), data.m256d[0]);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(pg.m256i) / sizeof(pg.m256i[0])) ; i++) {
+      _mm256_maskstore_pd(&(base[i * 4]), pg.m256i[i], data.m256d[i]);
+    }
   #else
     for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
       if (pg.values_i64[i]) {
@@ -302,6 +326,294 @@ simde_svst1_f64(simde_svbool_t pg, simde_float64 * base, simde_svfloat64_t data)
   #define svst1(pg, base, data) simde_svst1((pg), (base), (data))
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1b_s16(simde_svbool_t pg, int8_t * base, simde_svint16_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1b_s16(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi16_storeu_epi8(base, simde_svbool_to_mmask32(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi16_storeu_epi8(base, simde_svbool_to_mmask16(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+      if (pg.values_i16[i]) {
+        base[i] = HEDLEY_STATIC_CAST(int8_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1b_s16
+  #define svst1b_s16(pg, base, data) simde_svst1b_s16((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1b_s32(simde_svbool_t pg, int8_t * base, simde_svint32_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1b_s32(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi32_storeu_epi8(base, simde_svbool_to_mmask16(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi32_storeu_epi8(base, simde_svbool_to_mmask8(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+      if (pg.values_i32[i]) {
+        base[i] = HEDLEY_STATIC_CAST(int8_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1b_s32
+  #define svst1b_s32(pg, base, data) simde_svst1b_s32((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1b_s64(simde_svbool_t pg, int8_t * base, simde_svint64_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1b_s64(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi64_storeu_epi8(base, simde_svbool_to_mmask8(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi64_storeu_epi8(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+      if (pg.values_i64[i]) {
+        base[i] = HEDLEY_STATIC_CAST(int8_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1b_s64
+  #define svst1b_s64(pg, base, data) simde_svst1b_s64((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1b_u16(simde_svbool_t pg, uint8_t * base, simde_svuint16_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1b_u16(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi16_storeu_epi8(base, simde_svbool_to_mmask32(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi16_storeu_epi8(base, simde_svbool_to_mmask16(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+      if (pg.values_i16[i]) {
+        base[i] = HEDLEY_STATIC_CAST(uint8_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1b_u16
+  #define svst1b_u16(pg, base, data) simde_svst1b_u16((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1b_u32(simde_svbool_t pg, uint8_t * base, simde_svuint32_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1b_u32(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi32_storeu_epi8(base, simde_svbool_to_mmask16(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi32_storeu_epi8(base, simde_svbool_to_mmask8(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+      if (pg.values_i32[i]) {
+        base[i] = HEDLEY_STATIC_CAST(uint8_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1b_u32
+  #define svst1b_u32(pg, base, data) simde_svst1b_u32((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1b_u64(simde_svbool_t pg, uint8_t * base, simde_svuint64_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1b_u64(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi64_storeu_epi8(base, simde_svbool_to_mmask8(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi64_storeu_epi8(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+      if (pg.values_i64[i]) {
+        base[i] = HEDLEY_STATIC_CAST(uint8_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1b_u64
+  #define svst1b_u64(pg, base, data) simde_svst1b_u64((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1h_s32(simde_svbool_t pg, int16_t * base, simde_svint32_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1h_s32(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi32_storeu_epi16(base, simde_svbool_to_mmask16(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi32_storeu_epi16(base, simde_svbool_to_mmask8(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+      if (pg.values_i32[i]) {
+        base[i] = HEDLEY_STATIC_CAST(int16_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1h_s32
+  #define svst1h_s32(pg, base, data) simde_svst1h_s32((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1h_s64(simde_svbool_t pg, int16_t * base, simde_svint64_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1h_s64(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi64_storeu_epi16(base, simde_svbool_to_mmask8(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi64_storeu_epi16(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+      if (pg.values_i64[i]) {
+        base[i] = HEDLEY_STATIC_CAST(int16_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1h_s64
+  #define svst1h_s64(pg, base, data) simde_svst1h_s64((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1h_u32(simde_svbool_t pg, uint16_t * base, simde_svuint32_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1h_u32(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi32_storeu_epi16(base, simde_svbool_to_mmask16(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi32_storeu_epi16(base, simde_svbool_to_mmask8(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+      if (pg.values_i32[i]) {
+        base[i] = HEDLEY_STATIC_CAST(uint16_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1h_u32
+  #define svst1h_u32(pg, base, data) simde_svst1h_u32((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1h_u64(simde_svbool_t pg, uint16_t * base, simde_svuint64_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1h_u64(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi64_storeu_epi16(base, simde_svbool_to_mmask8(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi64_storeu_epi16(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+      if (pg.values_i64[i]) {
+        base[i] = HEDLEY_STATIC_CAST(uint16_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1h_u64
+  #define svst1h_u64(pg, base, data) simde_svst1h_u64((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1w_s64(simde_svbool_t pg, int32_t * base, simde_svint64_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1w_s64(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi64_storeu_epi32(base, simde_svbool_to_mmask8(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi64_storeu_epi32(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+      if (pg.values_i64[i]) {
+        base[i] = HEDLEY_STATIC_CAST(int32_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1w_s64
+  #define svst1w_s64(pg, base, data) simde_svst1w_s64((pg), (base), (data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_svst1w_u64(simde_svbool_t pg, uint32_t * base, simde_svuint64_t data) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    svst1w_u64(pg, base, data);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm512_mask_cvtepi64_storeu_epi32(base, simde_svbool_to_mmask8(pg), data.m512i);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    _mm256_mask_cvtepi64_storeu_epi32(base, simde_svbool_to_mmask4(pg), data.m256i[0]);
+  #else
+    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+      if (pg.values_i64[i]) {
+        base[i] = HEDLEY_STATIC_CAST(uint32_t, data.values[i]);
+      }
+    }
+  #endif
+}
+#if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
+  #undef simde_svst1w_u64
+  #define svst1w_u64(pg, base, data) simde_svst1w_u64((pg), (base), (data))
+#endif
+
 HEDLEY_DIAGNOSTIC_POP
 
 #endif /* SIMDE_ARM_SVE_ST1_H */
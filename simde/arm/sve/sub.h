@@ -85,6 +85,16 @@ simde_svint8_t
 simde_svsub_s8_z(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s8_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint8_t r;
+    r.m512i = _mm512_maskz_sub_epi8(simde_svbool_to_mmask64(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint8_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi8(simde_svbool_to_mmask32(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_s8_z(pg, simde_svsub_s8_x(pg, op1, op2));
   #endif
@@ -99,6 +109,16 @@ simde_svint8_t
 simde_svsub_s8_m(simde_svbool_t pg, simde_svint8_t op1, simde_svint8_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s8_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint8_t r;
+    r.m512i = _mm512_mask_sub_epi8(op1.m512i, simde_svbool_to_mmask64(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint8_t r;
+    r.m256i[0] = _mm256_mask_sub_epi8(op1.m256i[0], simde_svbool_to_mmask32(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_s8(pg, simde_svsub_s8_x(pg, op1, op2), op1);
   #endif
@@ -201,6 +221,16 @@ simde_svint16_t
 simde_svsub_s16_z(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s16_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint16_t r;
+    r.m512i = _mm512_maskz_sub_epi16(simde_svbool_to_mmask32(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint16_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi16(simde_svbool_to_mmask16(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_s16_z(pg, simde_svsub_s16_x(pg, op1, op2));
   #endif
@@ -215,6 +245,16 @@ simde_svint16_t
 simde_svsub_s16_m(simde_svbool_t pg, simde_svint16_t op1, simde_svint16_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s16_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint16_t r;
+    r.m512i = _mm512_mask_sub_epi16(op1.m512i, simde_svbool_to_mmask32(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint16_t r;
+    r.m256i[0] = _mm256_mask_sub_epi16(op1.m256i[0], simde_svbool_to_mmask16(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_s16(pg, simde_svsub_s16_x(pg, op1, op2), op1);
   #endif
@@ -317,6 +357,16 @@ simde_svint32_t
 simde_svsub_s32_z(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s32_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint32_t r;
+    r.m512i = _mm512_maskz_sub_epi32(simde_svbool_to_mmask16(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint32_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi32(simde_svbool_to_mmask8(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_s32_z(pg, simde_svsub_s32_x(pg, op1, op2));
   #endif
@@ -331,6 +381,16 @@ simde_svint32_t
 simde_svsub_s32_m(simde_svbool_t pg, simde_svint32_t op1, simde_svint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s32_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint32_t r;
+    r.m512i = _mm512_mask_sub_epi32(op1.m512i, simde_svbool_to_mmask16(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint32_t r;
+    r.m256i[0] = _mm256_mask_sub_epi32(op1.m256i[0], simde_svbool_to_mmask8(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_s32(pg, simde_svsub_s32_x(pg, op1, op2), op1);
   #endif
@@ -433,6 +493,16 @@ simde_svint64_t
 simde_svsub_s64_z(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s64_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint64_t r;
+    r.m512i = _mm512_maskz_sub_epi64(simde_svbool_to_mmask8(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint64_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi64(simde_svbool_to_mmask4(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_s64_z(pg, simde_svsub_s64_x(pg, op1, op2));
   #endif
@@ -447,6 +517,16 @@ simde_svint64_t
 simde_svsub_s64_m(simde_svbool_t pg, simde_svint64_t op1, simde_svint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_s64_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint64_t r;
+    r.m512i = _mm512_mask_sub_epi64(op1.m512i, simde_svbool_to_mmask8(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svint64_t r;
+    r.m256i[0] = _mm256_mask_sub_epi64(op1.m256i[0], simde_svbool_to_mmask4(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_s64(pg, simde_svsub_s64_x(pg, op1, op2), op1);
   #endif
@@ -549,6 +629,16 @@ simde_svuint8_t
 simde_svsub_u8_z(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u8_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint8_t r;
+    r.m512i = _mm512_maskz_sub_epi8(simde_svbool_to_mmask64(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint8_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi8(simde_svbool_to_mmask32(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_u8_z(pg, simde_svsub_u8_x(pg, op1, op2));
   #endif
@@ -563,6 +653,16 @@ simde_svuint8_t
 simde_svsub_u8_m(simde_svbool_t pg, simde_svuint8_t op1, simde_svuint8_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u8_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint8_t r;
+    r.m512i = _mm512_mask_sub_epi8(op1.m512i, simde_svbool_to_mmask64(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint8_t r;
+    r.m256i[0] = _mm256_mask_sub_epi8(op1.m256i[0], simde_svbool_to_mmask32(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_u8(pg, simde_svsub_u8_x(pg, op1, op2), op1);
   #endif
@@ -665,6 +765,16 @@ simde_svuint16_t
 simde_svsub_u16_z(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u16_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint16_t r;
+    r.m512i = _mm512_maskz_sub_epi16(simde_svbool_to_mmask32(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint16_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi16(simde_svbool_to_mmask16(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_u16_z(pg, simde_svsub_u16_x(pg, op1, op2));
   #endif
@@ -679,6 +789,16 @@ simde_svuint16_t
 simde_svsub_u16_m(simde_svbool_t pg, simde_svuint16_t op1, simde_svuint16_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u16_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint16_t r;
+    r.m512i = _mm512_mask_sub_epi16(op1.m512i, simde_svbool_to_mmask32(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint16_t r;
+    r.m256i[0] = _mm256_mask_sub_epi16(op1.m256i[0], simde_svbool_to_mmask16(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_u16(pg, simde_svsub_u16_x(pg, op1, op2), op1);
   #endif
@@ -781,6 +901,16 @@ simde_svuint32_t
 simde_svsub_u32_z(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u32_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint32_t r;
+    r.m512i = _mm512_maskz_sub_epi32(simde_svbool_to_mmask16(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint32_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi32(simde_svbool_to_mmask8(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_u32_z(pg, simde_svsub_u32_x(pg, op1, op2));
   #endif
@@ -795,6 +925,16 @@ simde_svuint32_t
 simde_svsub_u32_m(simde_svbool_t pg, simde_svuint32_t op1, simde_svuint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u32_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint32_t r;
+    r.m512i = _mm512_mask_sub_epi32(op1.m512i, simde_svbool_to_mmask16(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint32_t r;
+    r.m256i[0] = _mm256_mask_sub_epi32(op1.m256i[0], simde_svbool_to_mmask8(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_u32(pg, simde_svsub_u32_x(pg, op1, op2), op1);
   #endif
@@ -897,6 +1037,16 @@ simde_svuint64_t
 simde_svsub_u64_z(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u64_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint64_t r;
+    r.m512i = _mm512_maskz_sub_epi64(simde_svbool_to_mmask8(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint64_t r;
+    r.m256i[0] = _mm256_maskz_sub_epi64(simde_svbool_to_mmask4(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_x_svsel_u64_z(pg, simde_svsub_u64_x(pg, op1, op2));
   #endif
@@ -911,6 +1061,16 @@ simde_svuint64_t
 simde_svsub_u64_m(simde_svbool_t pg, simde_svuint64_t op1, simde_svuint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_u64_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint64_t r;
+    r.m512i = _mm512_mask_sub_epi64(op1.m512i, simde_svbool_to_mmask8(pg), op1.m512i, op2.m512i);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svuint64_t r;
+    r.m256i[0] = _mm256_mask_sub_epi64(op1.m256i[0], simde_svbool_to_mmask4(pg), op1.m256i[0], op2.m256i[0]);
+    return r;
   #else
     return simde_svsel_u64(pg, simde_svsub_u64_x(pg, op1, op2), op1);
   #endif
@@ -1013,6 +1173,16 @@ simde_svfloat32_t
 simde_svsub_f32_z(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_f32_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat32_t r;
+    r.m512 = _mm512_maskz_sub_ps(simde_svbool_to_mmask16(pg), op1.m512, op2.m512);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat32_t r;
+    r.m256[0] = _mm256_maskz_sub_ps(simde_svbool_to_mmask8(pg), op1.m256[0], op2.m256[0]);
+    return r;
   #else
     return simde_x_svsel_f32_z(pg, simde_svsub_f32_x(pg, op1, op2));
   #endif
@@ -1027,6 +1197,16 @@ simde_svfloat32_t
 simde_svsub_f32_m(simde_svbool_t pg, simde_svfloat32_t op1, simde_svfloat32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_f32_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat32_t r;
+    r.m512 = _mm512_mask_sub_ps(op1.m512, simde_svbool_to_mmask16(pg), op1.m512, op2.m512);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat32_t r;
+    r.m256[0] = _mm256_mask_sub_ps(op1.m256[0], simde_svbool_to_mmask8(pg), op1.m256[0], op2.m256[0]);
+    return r;
   #else
     return simde_svsel_f32(pg, simde_svsub_f32_x(pg, op1, op2), op1);
   #endif
@@ -1129,6 +1309,16 @@ simde_svfloat64_t
 simde_svsub_f64_z(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_f64_z(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat64_t r;
+    r.m512d = _mm512_maskz_sub_pd(simde_svbool_to_mmask8(pg), op1.m512d, op2.m512d);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat64_t r;
+    r.m256d[0] = _mm256_maskz_sub_pd(simde_svbool_to_mmask4(pg), op1.m256d[0], op2.m256d[0]);
+    return r;
   #else
     return simde_x_svsel_f64_z(pg, simde_svsub_f64_x(pg, op1, op2));
   #endif
@@ -1143,6 +1333,16 @@ simde_svfloat64_t
 simde_svsub_f64_m(simde_svbool_t pg, simde_svfloat64_t op1, simde_svfloat64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svsub_f64_m(pg, op1, op2);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat64_t r;
+    r.m512d = _mm512_mask_sub_pd(op1.m512d, simde_svbool_to_mmask8(pg), op1.m512d, op2.m512d);
+    return r;
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    simde_svfloat64_t r;
+    r.m256d[0] = _mm256_mask_sub_pd(op1.m256d[0], simde_svbool_to_mmask4(pg), op1.m256d[0], op2.m256d[0]);
+    return r;
   #else
     return simde_svsel_f64(pg, simde_svsub_f64_x(pg, op1, op2), op1);
   #endif
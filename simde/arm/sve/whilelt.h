@@ -32,46 +32,180 @@
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 
+#if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+  /* Returns a mask with the low min(remaining, bits) bits set.  With
+   * BMI2 this is a single BZHI, so predicating a loop tail doesn't
+   * need a branch. */
+  SIMDE_FUNCTION_ATTRIBUTES
+  uint64_t
+  simde_x_svwhilelt_mask(uint64_t remaining, unsigned int bits) {
+    const unsigned int n = (remaining < bits) ? HEDLEY_STATIC_CAST(unsigned int, remaining) : bits;
+
+    #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+      return HEDLEY_STATIC_CAST(uint64_t, _bzhi_u64(~UINT64_C(0), n));
+    #else
+      return (n < 64) ? ((UINT64_C(1) << n) - 1) : ~UINT64_C(0);
+    #endif
+  }
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_svbool_t
-simde_svwhilelt_b8_s32(int32_t op1, int32_t op2) {
-  #if defined(SIMDE_ARM_SVE_NATIVE)
-    return svwhilelt_b8_s32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+simde_x_svwhilelt_b8(uint64_t remaining) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return simde_svbool_from_mmask64(HEDLEY_STATIC_CAST(__mmask64, simde_x_svwhilelt_mask(remaining, 64)));
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask64(HEDLEY_STATIC_CAST(__mmask64, 0));
+    return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, simde_x_svwhilelt_mask(remaining, 32)));
+  #else
+    simde_svint8_t r;
+    const int32_t n = HEDLEY_STATIC_CAST(int32_t, (remaining < simde_svcntb()) ? remaining : simde_svcntb());
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i iota = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        const int32_t k = n - (i * 32);
+        r.m256i[i] = _mm256_cmpgt_epi8(_mm256_set1_epi8(HEDLEY_STATIC_CAST(char, (k < 0) ? 0 : ((k > 32) ? 32 : k))), iota);
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i iota = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        const int32_t k = n - (i * 16);
+        r.m128i[i] = _mm_cmpgt_epi8(_mm_set1_epi8(HEDLEY_STATIC_CAST(char, (k < 0) ? 0 : ((k > 16) ? 16 : k))), iota);
+      }
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      static const uint8_t iota[] = { UINT8_C( 0), UINT8_C( 1), UINT8_C( 2), UINT8_C( 3), UINT8_C( 4), UINT8_C( 5), UINT8_C( 6), UINT8_C( 7), UINT8_C( 8), UINT8_C( 9), UINT8_C(10), UINT8_C(11), UINT8_C(12), UINT8_C(13), UINT8_C(14), UINT8_C(15) };
+      r.neon = vreinterpretq_s8_u8(vcltq_u8(vld1q_u8(iota), vdupq_n_u8(HEDLEY_STATIC_CAST(uint8_t, n))));
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
+        r.values[i] = (i < n) ? ~INT8_C(0) : INT8_C(0);
+      }
+    #endif
 
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask64 r = ~HEDLEY_STATIC_CAST(__mmask64, 0);
-    if (HEDLEY_UNLIKELY(remaining < 64)) {
-      r >>= 64 - remaining;
-    }
+    return simde_svbool_from_svint8(r);
+  #endif
+}
 
-    return simde_svbool_from_mmask64(r);
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svbool_t
+simde_x_svwhilelt_b16(uint64_t remaining) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, simde_x_svwhilelt_mask(remaining, 32)));
   #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
       && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
+    return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, simde_x_svwhilelt_mask(remaining, 16)));
+  #else
+    simde_svint16_t r;
+    const int32_t n = HEDLEY_STATIC_CAST(int32_t, (remaining < simde_svcnth()) ? remaining : simde_svcnth());
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i iota = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_cmpgt_epi16(_mm256_set1_epi16(HEDLEY_STATIC_CAST(short, n - (i * 16))), iota);
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i iota = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_cmpgt_epi16(_mm_set1_epi16(HEDLEY_STATIC_CAST(short, n - (i * 8))), iota);
+      }
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      static const uint16_t iota[] = { UINT16_C( 0), UINT16_C( 1), UINT16_C( 2), UINT16_C( 3), UINT16_C( 4), UINT16_C( 5), UINT16_C( 6), UINT16_C( 7) };
+      r.neon = vreinterpretq_s16_u16(vcltq_u16(vld1q_u16(iota), vdupq_n_u16(HEDLEY_STATIC_CAST(uint16_t, n))));
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
+        r.values[i] = (i < n) ? ~INT16_C(0) : INT16_C(0);
+      }
+    #endif
 
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
+    return simde_svbool_from_svint16(r);
+  #endif
+}
 
-    return simde_svbool_from_mmask32(r);
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svbool_t
+simde_x_svwhilelt_b32(uint64_t remaining) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, simde_x_svwhilelt_mask(remaining, 16)));
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, simde_x_svwhilelt_mask(remaining, 8)));
   #else
-    simde_svint8_t r;
+    simde_svint32_t r;
+    const int32_t n = HEDLEY_STATIC_CAST(int32_t, (remaining < simde_svcntw()) ? remaining : simde_svcntw());
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_cmpgt_epi32(_mm256_set1_epi32(n - (i * 8)), iota);
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i iota = _mm_setr_epi32(0, 1, 2, 3);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_cmpgt_epi32(_mm_set1_epi32(n - (i * 4)), iota);
+      }
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      static const uint32_t iota[] = { UINT32_C( 0), UINT32_C( 1), UINT32_C( 2), UINT32_C( 3) };
+      r.neon = vreinterpretq_s32_u32(vcltq_u32(vld1q_u32(iota), vdupq_n_u32(HEDLEY_STATIC_CAST(uint32_t, n))));
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
+        r.values[i] = (i < n) ? ~INT32_C(0) : INT32_C(0);
+      }
+    #endif
+
+    return simde_svbool_from_svint32(r);
+  #endif
+}
 
-    int_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svbool_t
+simde_x_svwhilelt_b64(uint64_t remaining) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, simde_x_svwhilelt_mask(remaining, 8)));
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return simde_svbool_from_mmask4(HEDLEY_STATIC_CAST(__mmask8, simde_x_svwhilelt_mask(remaining, 4)));
+  #else
+    simde_svint64_t r;
+    const int32_t n = HEDLEY_STATIC_CAST(int32_t, (remaining < simde_svcntd()) ? remaining : simde_svcntd());
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i iota = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m256i) / sizeof(r.m256i[0])) ; i++) {
+        r.m256i[i] = _mm256_cmpgt_epi32(_mm256_set1_epi32(n - (i * 4)), iota);
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i iota = _mm_setr_epi32(0, 0, 1, 1);
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, sizeof(r.m128i) / sizeof(r.m128i[0])) ; i++) {
+        r.m128i[i] = _mm_cmpgt_epi32(_mm_set1_epi32(n - (i * 2)), iota);
+      }
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      static const uint32_t iota[] = { UINT32_C(0), UINT32_C(0), UINT32_C(1), UINT32_C(1) };
+      r.neon = vreinterpretq_s64_u32(vcltq_u32(vld1q_u32(iota), vdupq_n_u32(HEDLEY_STATIC_CAST(uint32_t, n))));
+    #else
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
+        r.values[i] = (i < n) ? ~INT64_C(0) : INT64_C(0);
+      }
+    #endif
 
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT8_C(0) : UINT8_C(0);
-    }
+    return simde_svbool_from_svint64(r);
+  #endif
+}
 
-    return simde_svbool_from_svint8(r);
+SIMDE_FUNCTION_ATTRIBUTES
+simde_svbool_t
+simde_svwhilelt_b8_s32(int32_t op1, int32_t op2) {
+  #if defined(SIMDE_ARM_SVE_NATIVE)
+    return svwhilelt_b8_s32(op1, op2);
+  #else
+    return simde_x_svwhilelt_b8((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -84,41 +218,8 @@ simde_svbool_t
 simde_svwhilelt_b16_s32(int32_t op1, int32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b16_s32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
   #else
-    simde_svint16_t r;
-
-    int_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT16_C(0) : UINT16_C(0);
-    }
-
-    return simde_svbool_from_svint16(r);
+    return simde_x_svwhilelt_b16((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -131,41 +232,8 @@ simde_svbool_t
 simde_svwhilelt_b32_s32(int32_t op1, int32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b32_s32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
   #else
-    simde_svint32_t r;
-
-    int_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~INT32_C(0) : INT32_C(0);
-    }
-
-    return simde_svbool_from_svint32(r);
+    return simde_x_svwhilelt_b32((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -178,41 +246,8 @@ simde_svbool_t
 simde_svwhilelt_b64_s32(int32_t op1, int32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b64_s32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask4(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    int_fast32_t remaining = (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, 0x0f);
-    if (HEDLEY_UNLIKELY(remaining < 4)) {
-      r >>= 4 - remaining;
-    }
-
-    return simde_svbool_from_mmask4(r);
   #else
-    simde_svint64_t r;
-
-    int_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast32_t, op2) - HEDLEY_STATIC_CAST(int_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~INT64_C(0) : INT64_C(0);
-    }
-
-    return simde_svbool_from_svint64(r);
+    return simde_x_svwhilelt_b64((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -225,41 +260,8 @@ simde_svbool_t
 simde_svwhilelt_b8_s64(int64_t op1, int64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b8_s64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask64(HEDLEY_STATIC_CAST(__mmask64, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask64 r = ~HEDLEY_STATIC_CAST(__mmask64, 0);
-    if (HEDLEY_UNLIKELY(remaining < 64)) {
-      r >>= 64 - remaining;
-    }
-
-    return simde_svbool_from_mmask64(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
   #else
-    simde_svint8_t r;
-
-    int_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT8_C(0) : UINT8_C(0);
-    }
-
-    return simde_svbool_from_svint8(r);
+    return simde_x_svwhilelt_b8((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -272,41 +274,8 @@ simde_svbool_t
 simde_svwhilelt_b16_s64(int64_t op1, int64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b16_s64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
   #else
-    simde_svint16_t r;
-
-    int_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT16_C(0) : UINT16_C(0);
-    }
-
-    return simde_svbool_from_svint16(r);
+    return simde_x_svwhilelt_b16((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -319,41 +288,8 @@ simde_svbool_t
 simde_svwhilelt_b32_s64(int64_t op1, int64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b32_s64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
   #else
-    simde_svint64_t r;
-
-    int_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~INT64_C(0) : INT64_C(0);
-    }
-
-    return simde_svbool_from_svint64(r);
+    return simde_x_svwhilelt_b32((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -366,41 +302,8 @@ simde_svbool_t
 simde_svwhilelt_b64_s64(int64_t op1, int64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b64_s64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask4(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    int_fast64_t remaining = (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, 0x0f);
-    if (HEDLEY_UNLIKELY(remaining < 4)) {
-      r >>= 4 - remaining;
-    }
-
-    return simde_svbool_from_mmask4(r);
   #else
-    simde_svint64_t r;
-
-    int_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(int_fast64_t, op2) - HEDLEY_STATIC_CAST(int_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~INT64_C(0) : INT64_C(0);
-    }
-
-    return simde_svbool_from_svint64(r);
+    return simde_x_svwhilelt_b64((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -413,41 +316,8 @@ simde_svbool_t
 simde_svwhilelt_b8_u32(uint32_t op1, uint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b8_u32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask64(HEDLEY_STATIC_CAST(__mmask64, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask64 r = ~HEDLEY_STATIC_CAST(__mmask64, 0);
-    if (HEDLEY_UNLIKELY(remaining < 64)) {
-      r >>= 64 - remaining;
-    }
-
-    return simde_svbool_from_mmask64(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
   #else
-    simde_svint8_t r;
-
-    uint_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT8_C(0) : UINT8_C(0);
-    }
-
-    return simde_svbool_from_svint8(r);
+    return simde_x_svwhilelt_b8((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -460,41 +330,8 @@ simde_svbool_t
 simde_svwhilelt_b16_u32(uint32_t op1, uint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b16_u32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
   #else
-    simde_svint16_t r;
-
-    uint_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT16_C(0) : UINT16_C(0);
-    }
-
-    return simde_svbool_from_svint16(r);
+    return simde_x_svwhilelt_b16((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -507,41 +344,8 @@ simde_svbool_t
 simde_svwhilelt_b32_u32(uint32_t op1, uint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b32_u32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
   #else
-    simde_svuint32_t r;
-
-    uint_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT32_C(0) : UINT32_C(0);
-    }
-
-    return simde_svbool_from_svuint32(r);
+    return simde_x_svwhilelt_b32((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -554,41 +358,8 @@ simde_svbool_t
 simde_svwhilelt_b64_u32(uint32_t op1, uint32_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b64_u32(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask4(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    uint_fast32_t remaining = (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, 0x0f);
-    if (HEDLEY_UNLIKELY(remaining < 4)) {
-      r >>= 4 - remaining;
-    }
-
-    return simde_svbool_from_mmask4(r);
   #else
-    simde_svint64_t r;
-
-    uint_fast32_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast32_t, op2) - HEDLEY_STATIC_CAST(uint_fast32_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~INT64_C(0) : INT64_C(0);
-    }
-
-    return simde_svbool_from_svint64(r);
+    return simde_x_svwhilelt_b64((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -601,41 +372,8 @@ simde_svbool_t
 simde_svwhilelt_b8_u64(uint64_t op1, uint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b8_u64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask64(HEDLEY_STATIC_CAST(__mmask64, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask64 r = ~HEDLEY_STATIC_CAST(__mmask64, 0);
-    if (HEDLEY_UNLIKELY(remaining < 64)) {
-      r >>= 64 - remaining;
-    }
-
-    return simde_svbool_from_mmask64(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT64_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
   #else
-    simde_svint8_t r;
-
-    uint_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT8_C(0) : UINT8_C(0);
-    }
-
-    return simde_svbool_from_svint8(r);
+    return simde_x_svwhilelt_b8((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -648,41 +386,8 @@ simde_svbool_t
 simde_svwhilelt_b16_u64(uint64_t op1, uint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b16_u64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask32(HEDLEY_STATIC_CAST(__mmask32, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask32 r = HEDLEY_STATIC_CAST(__mmask32, ~UINT32_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 32)) {
-      r >>= 32 - remaining;
-    }
-
-    return simde_svbool_from_mmask32(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
   #else
-    simde_svint16_t r;
-
-    uint_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT16_C(0) : UINT16_C(0);
-    }
-
-    return simde_svbool_from_svint16(r);
+    return simde_x_svwhilelt_b16((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -695,41 +400,8 @@ simde_svbool_t
 simde_svwhilelt_b32_u64(uint64_t op1, uint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b32_u64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask16(HEDLEY_STATIC_CAST(__mmask16, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask16 r = HEDLEY_STATIC_CAST(__mmask16, ~UINT16_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 16)) {
-      r >>= 16 - remaining;
-    }
-
-    return simde_svbool_from_mmask16(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
   #else
-    simde_svuint64_t r;
-
-    uint_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~UINT64_C(0) : UINT64_C(0);
-    }
-
-    return simde_svbool_from_svuint64(r);
+    return simde_x_svwhilelt_b32((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -742,41 +414,8 @@ simde_svbool_t
 simde_svwhilelt_b64_u64(uint64_t op1, uint64_t op2) {
   #if defined(SIMDE_ARM_SVE_NATIVE)
     return svwhilelt_b64_u64(op1, op2);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && (SIMDE_ARM_SVE_VECTOR_SIZE >= 512) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask8(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, ~UINT8_C(0));
-    if (HEDLEY_UNLIKELY(remaining < 8)) {
-      r >>= 8 - remaining;
-    }
-
-    return simde_svbool_from_mmask8(r);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) \
-      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
-    if (HEDLEY_UNLIKELY(op1 >= op2))
-      return simde_svbool_from_mmask4(HEDLEY_STATIC_CAST(__mmask8, 0));
-
-    uint_fast64_t remaining = (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-    __mmask8 r = HEDLEY_STATIC_CAST(__mmask8, 0x0f);
-    if (HEDLEY_UNLIKELY(remaining < 4)) {
-      r >>= 4 - remaining;
-    }
-
-    return simde_svbool_from_mmask4(r);
   #else
-    simde_svint64_t r;
-
-    uint_fast64_t remaining = (op1 >= op2) ? 0 : (HEDLEY_STATIC_CAST(uint_fast64_t, op2) - HEDLEY_STATIC_CAST(uint_fast64_t, op1));
-
-    SIMDE_VECTORIZE
-    for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; i++) {
-      r.values[i] = (remaining-- > 0) ? ~INT64_C(0) : INT64_C(0);
-    }
-
-    return simde_svbool_from_svint64(r);
+    return simde_x_svwhilelt_b64((op1 < op2) ? (HEDLEY_STATIC_CAST(uint64_t, op2) - HEDLEY_STATIC_CAST(uint64_t, op1)) : UINT64_C(0));
   #endif
 }
 #if defined(SIMDE_ARM_SVE_ENABLE_NATIVE_ALIASES)
@@ -348,6 +348,9 @@
 #  if defined(__AVX5124VNNIW__)
 #    define SIMDE_ARCH_X86_AVX5124VNNIW 1
 #  endif
+#  if defined(__AVXVNNI__)
+#    define SIMDE_ARCH_X86_AVXVNNI 1
+#  endif
 #  if defined(__AVX512BW__)
 #    define SIMDE_ARCH_X86_AVX512BW 1
 #  endif
@@ -384,6 +387,21 @@
 #  if defined(__AES__)
 #    define SIMDE_ARCH_X86_AES 1
 #  endif
+#  if defined(__VAES__)
+#    define SIMDE_ARCH_X86_VAES 1
+#  endif
+#  if defined(__SHA__)
+#    define SIMDE_ARCH_X86_SHA 1
+#  endif
+#  if defined(__BMI__) || (defined(HEDLEY_MSVC_VERSION) && HEDLEY_MSVC_VERSION_CHECK(19,30,0) && defined(SIMDE_ARCH_X86_AVX2))
+#    define SIMDE_ARCH_X86_BMI1 1
+#  endif
+#  if defined(__BMI2__) || (defined(HEDLEY_MSVC_VERSION) && HEDLEY_MSVC_VERSION_CHECK(19,30,0) && defined(SIMDE_ARCH_X86_AVX2))
+#    define SIMDE_ARCH_X86_BMI2 1
+#  endif
+#  if defined(__LZCNT__) || (defined(HEDLEY_MSVC_VERSION) && HEDLEY_MSVC_VERSION_CHECK(19,30,0) && defined(SIMDE_ARCH_X86_AVX2))
+#    define SIMDE_ARCH_X86_LZCNT 1
+#  endif
 #endif
 
 /* Itanium
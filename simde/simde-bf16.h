@@ -63,31 +63,42 @@ SIMDE_BEGIN_DECLS_
   #error No 16-bit floating point API.
 #endif
 
+SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_bfloat16_as_uint16,       uint16_t, simde_bfloat16)
+SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint16_as_bfloat16, simde_bfloat16,       uint16_t)
+
+/* Conversion kernels operating on the raw bit patterns.  bfloat16 is
+ * just the upper half of a binary32, so narrowing is a rounding add
+ * and a shift: adding 0x7fff plus the lowest kept bit rounds to
+ * nearest even, carrying into the exponent (and up to infinity) as
+ * needed.  NaNs are quieted instead so the carry can't turn them into
+ * infinities.  There are no branches, so loops over these vectorize
+ * to plain 32-bit integer SIMD. */
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+uint16_t
+simde_x_f32_bits_to_bf16_bits_ (uint32_t f32u) {
+  uint32_t is_nan = -HEDLEY_STATIC_CAST(uint32_t, (f32u & UINT32_C(0x7fffffff)) > UINT32_C(0x7f800000));
+  uint32_t rounded = (f32u + UINT32_C(0x7fff) + ((f32u >> 16) & 1)) >> 16;
+  uint32_t quieted = (f32u >> 16) | UINT32_C(0x40);
+
+  return HEDLEY_STATIC_CAST(uint16_t, (is_nan & quieted) | (~is_nan & rounded));
+}
+
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+uint32_t
+simde_x_bf16_bits_to_f32_bits_ (uint16_t bf16u) {
+  return HEDLEY_STATIC_CAST(uint32_t, bf16u) << 16;
+}
+
 /* Conversion -- convert between single-precision and brain half-precision
- * floats. */
+ * floats.  Narrowing rounds to nearest even, as the Arm BFCVT and x86
+ * VCVTNEPS2BF16 instructions do. */
 static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
 simde_bfloat16
 simde_bfloat16_from_float32 (simde_float32 value) {
 #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
   return vcvth_bf16_f32(value);
 #else
-  simde_bfloat16 res;
-  char* src = HEDLEY_REINTERPRET_CAST(char*, &value);
-  // rounding to nearest bfloat16
-  // If the 17th bit of value is 1, set the rounding to 1.
-  uint8_t rounding = 0;
-
-  #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE
-    if (src[1] & UINT8_C(0x80)) rounding = 1;
-    src[2] = HEDLEY_STATIC_CAST(char, (HEDLEY_STATIC_CAST(uint8_t, src[2]) + rounding));
-    simde_memcpy(&res, src+2, sizeof(res));
-  #else
-    if (src[2] & UINT8_C(0x80)) rounding = 1;
-    src[1] = HEDLEY_STATIC_CAST(char, (HEDLEY_STATIC_CAST(uint8_t, src[1]) + rounding));
-    simde_memcpy(&res, src, sizeof(res));
-  #endif
-
-  return res;
+  return simde_uint16_as_bfloat16(simde_x_f32_bits_to_bf16_bits_(simde_float32_as_uint32(value)));
 #endif
 }
 
@@ -97,20 +108,48 @@ simde_bfloat16_to_float32 (simde_bfloat16 value) {
 #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
   return vcvtah_f32_bf16(value);
 #else
-  simde_float32 res = 0.0;
-  char* _res = HEDLEY_REINTERPRET_CAST(char*, &res);
+  return simde_uint32_as_float32(simde_x_bf16_bits_to_f32_bits_(simde_bfloat16_as_uint16(value)));
+#endif
+}
 
-  #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE
-    simde_memcpy(_res+2, &value, sizeof(value));
-  #else
-    simde_memcpy(_res, &value, sizeof(value));
+/* Bulk conversion between arrays, with the same results as converting
+ * each element with simde_bfloat16_from_float32 /
+ * simde_bfloat16_to_float32. */
+SIMDE_HUGE_FUNCTION_ATTRIBUTES
+void
+simde_x_convert_f32_to_bf16_array (simde_bfloat16* dst, const simde_float32* src, size_t n) {
+  size_t i = 0;
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    for ( ; i + 8 <= n ; i += 8) {
+      vst1q_bf16(&(dst[i]), vcvtq_high_bf16_f32(vcvtq_low_bf16_f32(vld1q_f32(&(src[i]))), vld1q_f32(&(src[i + 4]))));
+    }
   #endif
 
-  return res;
-#endif
+  SIMDE_VECTORIZE
+  for (size_t j = i ; j < n ; j++) {
+    dst[j] = simde_bfloat16_from_float32(src[j]);
+  }
 }
 
-SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint16_as_bfloat16, simde_bfloat16,      uint16_t)
+SIMDE_HUGE_FUNCTION_ATTRIBUTES
+void
+simde_x_convert_bf16_to_f32_array (simde_float32* dst, const simde_bfloat16* src, size_t n) {
+  size_t i = 0;
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    for ( ; i + 8 <= n ; i += 8) {
+      bfloat16x8_t v = vld1q_bf16(&(src[i]));
+      vst1q_f32(&(dst[i]), vcvtq_low_f32_bf16(v));
+      vst1q_f32(&(dst[i + 4]), vcvtq_high_f32_bf16(v));
+    }
+  #endif
+
+  SIMDE_VECTORIZE
+  for (size_t j = i ; j < n ; j++) {
+    dst[j] = simde_bfloat16_to_float32(src[j]);
+  }
+}
 
 #define SIMDE_NANBF simde_uint16_as_bfloat16(0xFFC1) // a quiet Not-a-Number
 #define SIMDE_INFINITYBF simde_uint16_as_bfloat16(0x7F80)
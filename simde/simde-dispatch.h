@@ -0,0 +1,400 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_DISPATCH_H)
+#define SIMDE_DISPATCH_H
+
+#include "hedley.h"
+#include "simde-common.h"
+
+/* Opt-in runtime dispatch.
+ *
+ * Everything else in SIMDe picks its implementation at compile time
+ * from the SIMDE_*_NATIVE macros, so a binary built for a baseline
+ * target never uses wider instructions even when the machine it runs
+ * on has them.  This header provides the three pieces needed to build
+ * once and choose at startup:
+ *
+ *   - simde_cpu_features() probes the CPU (cpuid/xgetbv on x86,
+ *     getauxval on Linux Arm) once and returns a bitmask of
+ *     SIMDE_CPU_FEATURE_* flags; simde_cpu_has() tests it.
+ *   - SIMDE_TARGET_X86_V2/V3/V4 mark a function to be compiled for one
+ *     of the x86-64 micro-architecture levels, and SIMDE_TARGET_CLONES
+ *     asks the compiler to emit clones with an ifunc resolver.
+ *   - SIMDE_DISPATCH_DEFINE/SIMDE_DISPATCH wrap a user-supplied selector
+ *     in a cached function pointer.
+ *
+ * The target attributes only change code generation, not the
+ * preprocessor, so SIMDe functions inlined into a SIMDE_TARGET_*
+ * function still take their portable paths; those are written with
+ * vector extensions and loops the compiler lowers to the wider ISA.
+ * To get SIMDe's native paths, build each variant in its own
+ * translation unit with the matching -m flags and select between them
+ * with SIMDE_DISPATCH. */
+
+#if defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define SIMDE_DISPATCH_X86_MSVC_
+  #elif defined(__GNUC__)
+    #include <cpuid.h>
+    #define SIMDE_DISPATCH_X86_GNU_
+  #endif
+#elif defined(SIMDE_ARCH_ARM) || defined(SIMDE_ARCH_AARCH64)
+  #if defined(__linux__) && defined(__has_include)
+    #if __has_include(<sys/auxv.h>)
+      #include <sys/auxv.h>
+      #define SIMDE_DISPATCH_ARM_AUXV_
+    #endif
+  #endif
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* x86 */
+#define SIMDE_CPU_FEATURE_X86_SSE2            (UINT64_C(1) <<  0)
+#define SIMDE_CPU_FEATURE_X86_SSE3            (UINT64_C(1) <<  1)
+#define SIMDE_CPU_FEATURE_X86_SSSE3           (UINT64_C(1) <<  2)
+#define SIMDE_CPU_FEATURE_X86_SSE4_1          (UINT64_C(1) <<  3)
+#define SIMDE_CPU_FEATURE_X86_SSE4_2          (UINT64_C(1) <<  4)
+#define SIMDE_CPU_FEATURE_X86_POPCNT          (UINT64_C(1) <<  5)
+#define SIMDE_CPU_FEATURE_X86_AES             (UINT64_C(1) <<  6)
+#define SIMDE_CPU_FEATURE_X86_PCLMUL          (UINT64_C(1) <<  7)
+#define SIMDE_CPU_FEATURE_X86_AVX             (UINT64_C(1) <<  8)
+#define SIMDE_CPU_FEATURE_X86_AVX2            (UINT64_C(1) <<  9)
+#define SIMDE_CPU_FEATURE_X86_FMA             (UINT64_C(1) << 10)
+#define SIMDE_CPU_FEATURE_X86_F16C            (UINT64_C(1) << 11)
+#define SIMDE_CPU_FEATURE_X86_BMI1            (UINT64_C(1) << 12)
+#define SIMDE_CPU_FEATURE_X86_BMI2            (UINT64_C(1) << 13)
+#define SIMDE_CPU_FEATURE_X86_LZCNT           (UINT64_C(1) << 14)
+#define SIMDE_CPU_FEATURE_X86_SHA             (UINT64_C(1) << 15)
+#define SIMDE_CPU_FEATURE_X86_GFNI            (UINT64_C(1) << 16)
+#define SIMDE_CPU_FEATURE_X86_VAES            (UINT64_C(1) << 17)
+#define SIMDE_CPU_FEATURE_X86_VPCLMULQDQ      (UINT64_C(1) << 18)
+#define SIMDE_CPU_FEATURE_X86_AVX_VNNI        (UINT64_C(1) << 19)
+#define SIMDE_CPU_FEATURE_X86_AVX512F         (UINT64_C(1) << 20)
+#define SIMDE_CPU_FEATURE_X86_AVX512CD        (UINT64_C(1) << 21)
+#define SIMDE_CPU_FEATURE_X86_AVX512DQ        (UINT64_C(1) << 22)
+#define SIMDE_CPU_FEATURE_X86_AVX512BW        (UINT64_C(1) << 23)
+#define SIMDE_CPU_FEATURE_X86_AVX512VL        (UINT64_C(1) << 24)
+#define SIMDE_CPU_FEATURE_X86_AVX512IFMA      (UINT64_C(1) << 25)
+#define SIMDE_CPU_FEATURE_X86_AVX512VBMI      (UINT64_C(1) << 26)
+#define SIMDE_CPU_FEATURE_X86_AVX512VBMI2     (UINT64_C(1) << 27)
+#define SIMDE_CPU_FEATURE_X86_AVX512VNNI      (UINT64_C(1) << 28)
+#define SIMDE_CPU_FEATURE_X86_AVX512BITALG    (UINT64_C(1) << 29)
+#define SIMDE_CPU_FEATURE_X86_AVX512VPOPCNTDQ (UINT64_C(1) << 30)
+#define SIMDE_CPU_FEATURE_X86_AVX512BF16      (UINT64_C(1) << 31)
+#define SIMDE_CPU_FEATURE_X86_AVX512FP16      (UINT64_C(1) << 32)
+
+/* Arm */
+#define SIMDE_CPU_FEATURE_ARM_NEON            (UINT64_C(1) << 40)
+#define SIMDE_CPU_FEATURE_ARM_AES             (UINT64_C(1) << 41)
+#define SIMDE_CPU_FEATURE_ARM_PMULL           (UINT64_C(1) << 42)
+#define SIMDE_CPU_FEATURE_ARM_SHA2            (UINT64_C(1) << 43)
+#define SIMDE_CPU_FEATURE_ARM_CRC32           (UINT64_C(1) << 44)
+#define SIMDE_CPU_FEATURE_ARM_FP16            (UINT64_C(1) << 45)
+#define SIMDE_CPU_FEATURE_ARM_DOTPROD         (UINT64_C(1) << 46)
+#define SIMDE_CPU_FEATURE_ARM_SHA3            (UINT64_C(1) << 47)
+#define SIMDE_CPU_FEATURE_ARM_I8MM            (UINT64_C(1) << 48)
+#define SIMDE_CPU_FEATURE_ARM_BF16            (UINT64_C(1) << 49)
+#define SIMDE_CPU_FEATURE_ARM_SVE             (UINT64_C(1) << 50)
+#define SIMDE_CPU_FEATURE_ARM_SVE2            (UINT64_C(1) << 51)
+
+/* Set in every value returned by simde_cpu_features() so that zero can
+ * mean "not probed yet". */
+#define SIMDE_CPU_FEATURE_DETECTED_           (UINT64_C(1) << 63)
+
+/* The x86-64 micro-architecture levels, as used by -march=x86-64-vN. */
+#define SIMDE_CPU_FEATURES_X86_V2 \
+  (SIMDE_CPU_FEATURE_X86_SSE2 | SIMDE_CPU_FEATURE_X86_SSE3 | SIMDE_CPU_FEATURE_X86_SSSE3 | \
+   SIMDE_CPU_FEATURE_X86_SSE4_1 | SIMDE_CPU_FEATURE_X86_SSE4_2 | SIMDE_CPU_FEATURE_X86_POPCNT)
+#define SIMDE_CPU_FEATURES_X86_V3 \
+  (SIMDE_CPU_FEATURES_X86_V2 | SIMDE_CPU_FEATURE_X86_AVX | SIMDE_CPU_FEATURE_X86_AVX2 | \
+   SIMDE_CPU_FEATURE_X86_FMA | SIMDE_CPU_FEATURE_X86_F16C | SIMDE_CPU_FEATURE_X86_BMI1 | \
+   SIMDE_CPU_FEATURE_X86_BMI2 | SIMDE_CPU_FEATURE_X86_LZCNT)
+#define SIMDE_CPU_FEATURES_X86_V4 \
+  (SIMDE_CPU_FEATURES_X86_V3 | SIMDE_CPU_FEATURE_X86_AVX512F | SIMDE_CPU_FEATURE_X86_AVX512CD | \
+   SIMDE_CPU_FEATURE_X86_AVX512DQ | SIMDE_CPU_FEATURE_X86_AVX512BW | SIMDE_CPU_FEATURE_X86_AVX512VL)
+
+#if defined(SIMDE_DISPATCH_X86_GNU_) || defined(SIMDE_DISPATCH_X86_MSVC_)
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_cpuid_ (uint32_t leaf, uint32_t subleaf, uint32_t r[4]) {
+  #if defined(SIMDE_DISPATCH_X86_MSVC_)
+    int regs[4];
+    __cpuidex(regs, HEDLEY_STATIC_CAST(int, leaf), HEDLEY_STATIC_CAST(int, subleaf));
+    for (int i = 0 ; i < 4 ; i++)
+      r[i] = HEDLEY_STATIC_CAST(uint32_t, regs[i]);
+  #else
+    unsigned int a, b, c, d;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    r[0] = a;
+    r[1] = b;
+    r[2] = c;
+    r[3] = d;
+  #endif
+}
+
+/* XCR0, i.e. which register states the OS saves on context switch.
+ * Only valid when cpuid reports OSXSAVE. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_xgetbv_ (void) {
+  #if defined(SIMDE_DISPATCH_X86_MSVC_)
+    return HEDLEY_STATIC_CAST(uint64_t, _xgetbv(0));
+  #else
+    uint32_t lo, hi;
+    /* Encoded by hand so that no -mxsave is needed. */
+    __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a" (lo), "=d" (hi) : "c" (0));
+    return (HEDLEY_STATIC_CAST(uint64_t, hi) << 32) | lo;
+  #endif
+}
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_cpu_features_detect_ (void) {
+  uint64_t f = SIMDE_CPU_FEATURE_DETECTED_;
+
+  #if defined(SIMDE_DISPATCH_X86_GNU_) || defined(SIMDE_DISPATCH_X86_MSVC_)
+    uint32_t r[4];
+    simde_x_cpuid_(0, 0, r);
+    const uint32_t max_leaf = r[0];
+    simde_x_cpuid_(0x80000000, 0, r);
+    const uint32_t max_ext_leaf = r[0];
+
+    if (max_leaf >= 1) {
+      simde_x_cpuid_(1, 0, r);
+      const uint32_t ecx = r[2], edx = r[3];
+      if (edx & (UINT32_C(1) << 26)) f |= SIMDE_CPU_FEATURE_X86_SSE2;
+      if (ecx & (UINT32_C(1) <<  0)) f |= SIMDE_CPU_FEATURE_X86_SSE3;
+      if (ecx & (UINT32_C(1) <<  9)) f |= SIMDE_CPU_FEATURE_X86_SSSE3;
+      if (ecx & (UINT32_C(1) << 19)) f |= SIMDE_CPU_FEATURE_X86_SSE4_1;
+      if (ecx & (UINT32_C(1) << 20)) f |= SIMDE_CPU_FEATURE_X86_SSE4_2;
+      if (ecx & (UINT32_C(1) << 23)) f |= SIMDE_CPU_FEATURE_X86_POPCNT;
+      if (ecx & (UINT32_C(1) << 25)) f |= SIMDE_CPU_FEATURE_X86_AES;
+      if (ecx & (UINT32_C(1) <<  1)) f |= SIMDE_CPU_FEATURE_X86_PCLMUL;
+
+      /* AVX and AVX-512 also need the OS to preserve the wider
+       * registers, which is what XCR0 reports. */
+      uint64_t xcr0 = 0;
+      if (ecx & (UINT32_C(1) << 27))
+        xcr0 = simde_x_xgetbv_();
+      const int os_avx = (xcr0 & 0x06) == 0x06;
+      const int os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+      if (os_avx) {
+        if (ecx & (UINT32_C(1) << 28)) f |= SIMDE_CPU_FEATURE_X86_AVX;
+        if (ecx & (UINT32_C(1) << 12)) f |= SIMDE_CPU_FEATURE_X86_FMA;
+        if (ecx & (UINT32_C(1) << 29)) f |= SIMDE_CPU_FEATURE_X86_F16C;
+      }
+
+      if (max_leaf >= 7) {
+        simde_x_cpuid_(7, 0, r);
+        const uint32_t max_subleaf = r[0], ebx7 = r[1], ecx7 = r[2], edx7 = r[3];
+        if (ebx7 & (UINT32_C(1) <<  3)) f |= SIMDE_CPU_FEATURE_X86_BMI1;
+        if (ebx7 & (UINT32_C(1) <<  8)) f |= SIMDE_CPU_FEATURE_X86_BMI2;
+        if (ebx7 & (UINT32_C(1) << 29)) f |= SIMDE_CPU_FEATURE_X86_SHA;
+        if (ecx7 & (UINT32_C(1) <<  8)) f |= SIMDE_CPU_FEATURE_X86_GFNI;
+
+        if (os_avx) {
+          if (ebx7 & (UINT32_C(1) <<  5)) f |= SIMDE_CPU_FEATURE_X86_AVX2;
+          if (ecx7 & (UINT32_C(1) <<  9)) f |= SIMDE_CPU_FEATURE_X86_VAES;
+          if (ecx7 & (UINT32_C(1) << 10)) f |= SIMDE_CPU_FEATURE_X86_VPCLMULQDQ;
+        }
+
+        if (os_avx512) {
+          if (ebx7 & (UINT32_C(1) << 16)) f |= SIMDE_CPU_FEATURE_X86_AVX512F;
+          if (ebx7 & (UINT32_C(1) << 17)) f |= SIMDE_CPU_FEATURE_X86_AVX512DQ;
+          if (ebx7 & (UINT32_C(1) << 21)) f |= SIMDE_CPU_FEATURE_X86_AVX512IFMA;
+          if (ebx7 & (UINT32_C(1) << 28)) f |= SIMDE_CPU_FEATURE_X86_AVX512CD;
+          if (ebx7 & (UINT32_C(1) << 30)) f |= SIMDE_CPU_FEATURE_X86_AVX512BW;
+          if (ebx7 & (UINT32_C(1) << 31)) f |= SIMDE_CPU_FEATURE_X86_AVX512VL;
+          if (ecx7 & (UINT32_C(1) <<  1)) f |= SIMDE_CPU_FEATURE_X86_AVX512VBMI;
+          if (ecx7 & (UINT32_C(1) <<  6)) f |= SIMDE_CPU_FEATURE_X86_AVX512VBMI2;
+          if (ecx7 & (UINT32_C(1) << 11)) f |= SIMDE_CPU_FEATURE_X86_AVX512VNNI;
+          if (ecx7 & (UINT32_C(1) << 12)) f |= SIMDE_CPU_FEATURE_X86_AVX512BITALG;
+          if (ecx7 & (UINT32_C(1) << 14)) f |= SIMDE_CPU_FEATURE_X86_AVX512VPOPCNTDQ;
+          if (edx7 & (UINT32_C(1) << 23)) f |= SIMDE_CPU_FEATURE_X86_AVX512FP16;
+        }
+
+        if (max_subleaf >= 1) {
+          simde_x_cpuid_(7, 1, r);
+          if (os_avx && (r[0] & (UINT32_C(1) << 4))) f |= SIMDE_CPU_FEATURE_X86_AVX_VNNI;
+          if (os_avx512 && (r[0] & (UINT32_C(1) << 5))) f |= SIMDE_CPU_FEATURE_X86_AVX512BF16;
+        }
+      }
+    }
+
+    if (max_ext_leaf >= 0x80000001) {
+      simde_x_cpuid_(0x80000001, 0, r);
+      if (r[2] & (UINT32_C(1) << 5)) f |= SIMDE_CPU_FEATURE_X86_LZCNT;
+    }
+  #elif defined(SIMDE_DISPATCH_ARM_AUXV_)
+    /* Bit numbers from the kernel's uapi asm/hwcap.h, spelled out since
+     * older C libraries don't define all of them. */
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    #if defined(AT_HWCAP2)
+      const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    #else
+      const unsigned long hwcap2 = 0;
+    #endif
+    #if defined(SIMDE_ARCH_AARCH64)
+      if (hwcap & (1UL <<  1)) f |= SIMDE_CPU_FEATURE_ARM_NEON;
+      if (hwcap & (1UL <<  3)) f |= SIMDE_CPU_FEATURE_ARM_AES;
+      if (hwcap & (1UL <<  4)) f |= SIMDE_CPU_FEATURE_ARM_PMULL;
+      if (hwcap & (1UL <<  6)) f |= SIMDE_CPU_FEATURE_ARM_SHA2;
+      if (hwcap & (1UL <<  7)) f |= SIMDE_CPU_FEATURE_ARM_CRC32;
+      if (hwcap & (1UL << 10)) f |= SIMDE_CPU_FEATURE_ARM_FP16;
+      if (hwcap & (1UL << 17)) f |= SIMDE_CPU_FEATURE_ARM_SHA3;
+      if (hwcap & (1UL << 20)) f |= SIMDE_CPU_FEATURE_ARM_DOTPROD;
+      if (hwcap & (1UL << 22)) f |= SIMDE_CPU_FEATURE_ARM_SVE;
+      if (hwcap2 & (1UL <<  1)) f |= SIMDE_CPU_FEATURE_ARM_SVE2;
+      if (hwcap2 & (1UL << 13)) f |= SIMDE_CPU_FEATURE_ARM_I8MM;
+      if (hwcap2 & (1UL << 14)) f |= SIMDE_CPU_FEATURE_ARM_BF16;
+    #else
+      if (hwcap & (1UL << 12)) f |= SIMDE_CPU_FEATURE_ARM_NEON;
+      if (hwcap2 & (1UL << 0)) f |= SIMDE_CPU_FEATURE_ARM_AES;
+      if (hwcap2 & (1UL << 1)) f |= SIMDE_CPU_FEATURE_ARM_PMULL;
+      if (hwcap2 & (1UL << 3)) f |= SIMDE_CPU_FEATURE_ARM_SHA2;
+      if (hwcap2 & (1UL << 4)) f |= SIMDE_CPU_FEATURE_ARM_CRC32;
+    #endif
+  #endif
+
+  /* Whatever the build already requires is available by definition,
+   * which also covers targets we can't probe. */
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    f |= SIMDE_CPU_FEATURE_X86_SSE2;
+  #endif
+  #if defined(SIMDE_X86_SSE4_2_NATIVE)
+    f |= SIMDE_CPU_FEATURE_X86_SSE3 | SIMDE_CPU_FEATURE_X86_SSSE3 | SIMDE_CPU_FEATURE_X86_SSE4_1 | SIMDE_CPU_FEATURE_X86_SSE4_2;
+  #endif
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    f |= SIMDE_CPU_FEATURE_X86_AVX | SIMDE_CPU_FEATURE_X86_AVX2;
+  #endif
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    f |= SIMDE_CPU_FEATURE_X86_AVX512F;
+  #endif
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    f |= SIMDE_CPU_FEATURE_ARM_NEON;
+  #endif
+  #if defined(SIMDE_ARCH_AARCH64)
+    f |= SIMDE_CPU_FEATURE_ARM_NEON;
+  #endif
+
+  return f;
+}
+
+/* Relaxed/acquire-release accessors for the caches below.  The probe
+ * is idempotent, so racing initializers all store the same value; the
+ * atomics just keep that race well-defined where the compiler lets us
+ * say so. */
+#if HEDLEY_GCC_VERSION_CHECK(4,7,0) || HEDLEY_HAS_BUILTIN(__atomic_load_n)
+  #define SIMDE_DISPATCH_LOAD_(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+  #define SIMDE_DISPATCH_STORE_(ptr, v) __atomic_store_n((ptr), (v), __ATOMIC_RELEASE)
+#else
+  #define SIMDE_DISPATCH_LOAD_(ptr) (*(ptr))
+  #define SIMDE_DISPATCH_STORE_(ptr, v) (*(ptr) = (v))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_cpu_features (void) {
+  static uint64_t cache = 0;
+  uint64_t f = SIMDE_DISPATCH_LOAD_(&cache);
+  if (HEDLEY_UNLIKELY(f == 0)) {
+    f = simde_x_cpu_features_detect_();
+    SIMDE_DISPATCH_STORE_(&cache, f);
+  }
+  return f;
+}
+
+/* Non-zero if *all* of the requested features are present. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_cpu_has (uint64_t features) {
+  return (simde_cpu_features() & features) == features;
+}
+
+#if \
+    (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)) && \
+    (HEDLEY_HAS_ATTRIBUTE(target) || HEDLEY_GCC_VERSION_CHECK(4,9,0))
+  #define SIMDE_DISPATCH_HAVE_TARGET 1
+  #define SIMDE_TARGET_X86_V2 \
+    __attribute__((__target__("sse2,sse3,ssse3,sse4.1,sse4.2,popcnt")))
+  #define SIMDE_TARGET_X86_V3 \
+    __attribute__((__target__("sse2,sse3,ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,lzcnt")))
+  #define SIMDE_TARGET_X86_V4 \
+    __attribute__((__target__("sse2,sse3,ssse3,sse4.1,sse4.2,popcnt,avx,avx2,fma,f16c,bmi,bmi2,lzcnt,avx512f,avx512cd,avx512dq,avx512bw,avx512vl")))
+#else
+  #define SIMDE_TARGET_X86_V2
+  #define SIMDE_TARGET_X86_V3
+  #define SIMDE_TARGET_X86_V4
+#endif
+
+/* target_clones needs ifunc support from the object format and the
+ * loader, i.e. ELF with glibc.  Where that's missing this expands to
+ * nothing and the function is just built for the baseline. */
+#if \
+    (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)) && \
+    defined(__ELF__) && defined(__GLIBC__) && \
+    (HEDLEY_HAS_ATTRIBUTE(target_clones) || HEDLEY_GCC_VERSION_CHECK(6,0,0))
+  #define SIMDE_DISPATCH_HAVE_TARGET_CLONES 1
+  #define SIMDE_TARGET_CLONES(...) __attribute__((__target_clones__(__VA_ARGS__)))
+#else
+  #define SIMDE_TARGET_CLONES(...)
+#endif
+
+/* SIMDE_DISPATCH_DEFINE(fn_type, name, selector) defines a resolver for
+ * a function pointer type; selector is called with simde_cpu_features()
+ * the first time SIMDE_DISPATCH(name) is evaluated, and its result is
+ * cached for every later call:
+ *
+ *   typedef void (*scale_fn)(float*, size_t, float);
+ *   static scale_fn scale_select(uint64_t features) {
+ *     return (features & SIMDE_CPU_FEATURES_X86_V3) == SIMDE_CPU_FEATURES_X86_V3 ?
+ *       scale_avx2 : scale_generic;
+ *   }
+ *   SIMDE_DISPATCH_DEFINE(scale_fn, scale, scale_select)
+ *
+ *   SIMDE_DISPATCH(scale)(buf, n, 2.0f);
+ */
+#define SIMDE_DISPATCH_DEFINE(fn_type, name, selector) \
+  static fn_type \
+  name##_simde_dispatch_ (void) { \
+    static fn_type fn = NULL; \
+    fn_type r = SIMDE_DISPATCH_LOAD_(&fn); \
+    if (HEDLEY_UNLIKELY(r == NULL)) { \
+      r = selector(simde_cpu_features()); \
+      SIMDE_DISPATCH_STORE_(&fn, r); \
+    } \
+    return r; \
+  }
+#define SIMDE_DISPATCH(name) (name##_simde_dispatch_())
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_DISPATCH_H) */
@@ -168,6 +168,95 @@ SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint16_as_float16, simde_float16,      u
   #endif
 #endif
 
+/* Whether conversions between simde_float16 and simde_float32 compile
+ * to hardware instructions.  Elsewhere the compiler lowers _Float16 and
+ * __fp16 conversions to library calls, which are much slower than the
+ * bit manipulation below. */
+#if !defined(SIMDE_FLOAT16_CONVERSION_NATIVE) && \
+    (SIMDE_FLOAT16_API != SIMDE_FLOAT16_API_PORTABLE) && ( \
+      defined(SIMDE_X86_F16C_NATIVE) || \
+      defined(SIMDE_X86_AVX512FP16_NATIVE) || \
+      defined(SIMDE_ARCH_AARCH64) || \
+      (defined(SIMDE_ARCH_ARM) && defined(__ARM_FP16_FORMAT_IEEE)) || \
+      defined(SIMDE_ARCH_RISCV_ZVFH))
+  #define SIMDE_FLOAT16_CONVERSION_NATIVE
+#endif
+
+/* Conversion kernels operating on the raw bit patterns.
+ *
+ * This code is CC0, based heavily on code by Fabian Giesen.  It has no
+ * branches (every case is computed and the right one is selected with
+ * a mask), so loops over it vectorize to plain integer SIMD plus a
+ * single floating-point add.  Rounding is to nearest even (this relies
+ * on the FPU being in its default rounding mode), subnormals are
+ * handled exactly, and NaNs are quieted with the upper payload bits
+ * preserved, which is what F16C and Arm hardware do. */
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+uint16_t
+simde_x_f32_bits_to_f16_bits_ (uint32_t f32u) {
+  const uint32_t f32u_infty = UINT32_C(255) << 23;
+  const uint32_t f16u_max = (UINT32_C(127) + UINT32_C(16)) << 23;
+  const uint32_t denorm_magic =
+    ((UINT32_C(127) - UINT32_C(15)) + (UINT32_C(23) - UINT32_C(10)) + UINT32_C(1)) << 23;
+
+  uint32_t sign = f32u & (UINT32_C(1) << 31);
+  f32u ^= sign;
+
+  /* NOTE all the integer compares in this function cast the operands
+   * to signed values to help compilers vectorize to SSE2, which lacks
+   * unsigned comparison instructions.  This is fine since all
+   * operands are below 0x80000000 (we clear the sign bit). */
+  uint32_t is_special = -HEDLEY_STATIC_CAST(uint32_t, HEDLEY_STATIC_CAST(int32_t, f32u) > HEDLEY_STATIC_CAST(int32_t, f16u_max));
+  uint32_t is_nan = -HEDLEY_STATIC_CAST(uint32_t, HEDLEY_STATIC_CAST(int32_t, f32u) > HEDLEY_STATIC_CAST(int32_t, f32u_infty));
+  uint32_t is_denorm = -HEDLEY_STATIC_CAST(uint32_t, HEDLEY_STATIC_CAST(int32_t, f32u) < HEDLEY_STATIC_CAST(int32_t, UINT32_C(113) << 23));
+
+  /* Inf stays Inf, NaN keeps the top of its payload and is quieted. */
+  uint32_t special = UINT32_C(0x7c00) | (is_nan & (UINT32_C(0x200) | ((f32u >> 13) & UINT32_C(0x3ff))));
+
+  /* Subnormal or zero: use a magic value to align our 10 mantissa bits
+   * at the bottom of the float.  As long as FP addition is
+   * round-to-nearest-even this just works, and one integer subtract of
+   * the bias later, we have our final float! */
+  uint32_t denorm =
+    simde_float32_as_uint32(simde_uint32_as_float32(f32u) + simde_uint32_as_float32(denorm_magic)) - denorm_magic;
+
+  /* Normal: update exponent, then round to nearest even by adding
+   * 0xfff plus the lowest kept mantissa bit before taking the bits. */
+  uint32_t normal =
+    (f32u + (HEDLEY_STATIC_CAST(uint32_t, 15 - 127) << 23) + UINT32_C(0xfff) + ((f32u >> 13) & 1)) >> 13;
+
+  uint32_t f16u = (is_denorm & denorm) | (~is_denorm & normal);
+  f16u = (is_special & special) | (~is_special & f16u);
+
+  return HEDLEY_STATIC_CAST(uint16_t, f16u | (sign >> 16));
+}
+
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+uint32_t
+simde_x_f16_bits_to_f32_bits_ (uint16_t half) {
+  const uint32_t shifted_exp = UINT32_C(0x7c00) << 13; /* exponent mask after shift */
+  const uint32_t denorm_magic = UINT32_C(113) << 23;
+
+  uint32_t f32u = (half & UINT32_C(0x7fff)) << 13; /* exponent/mantissa bits */
+  uint32_t exp = shifted_exp & f32u; /* just the exponent */
+  uint32_t is_special = -HEDLEY_STATIC_CAST(uint32_t, exp == shifted_exp);
+  uint32_t is_denorm = -HEDLEY_STATIC_CAST(uint32_t, exp == 0);
+  uint32_t is_nan = is_special & -HEDLEY_STATIC_CAST(uint32_t, (half & UINT32_C(0x3ff)) != 0);
+
+  f32u += (UINT32_C(127) - UINT32_C(15)) << 23; /* exponent adjust */
+
+  /* Inf/NaN: extra exponent adjust, and quiet NaNs. */
+  f32u += is_special & ((UINT32_C(128) - UINT32_C(16)) << 23);
+  f32u |= is_nan & (UINT32_C(1) << 22);
+
+  /* Zero/denormal: extra exponent adjust, then renormalize. */
+  uint32_t denorm =
+    simde_float32_as_uint32(simde_uint32_as_float32(f32u + (UINT32_C(1) << 23)) - simde_uint32_as_float32(denorm_magic));
+  f32u = (is_denorm & denorm) | (~is_denorm & f32u);
+
+  return f32u | ((half & UINT32_C(0x8000)) << 16); /* sign bit */
+}
+
 /* Conversion -- convert between single-precision and half-precision
  * floats. */
 static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
@@ -176,53 +265,14 @@ simde_float16_from_float32 (simde_float32 value) {
   simde_float16 res;
 
   #if \
-      (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FLOAT16) || \
-      (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FP16)
+      defined(SIMDE_FLOAT16_CONVERSION_NATIVE) && ( \
+        (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FLOAT16) || \
+        (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FP16))
     res = HEDLEY_STATIC_CAST(simde_float16, value);
-  #elif (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FP16_NO_ABI)
+  #elif defined(SIMDE_FLOAT16_CONVERSION_NATIVE) && (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FP16_NO_ABI)
     res.value = HEDLEY_STATIC_CAST(__fp16, value);
   #else
-    /* This code is CC0, based heavily on code by Fabian Giesen. */
-    uint32_t f32u = simde_float32_as_uint32(value);
-    static const uint32_t f32u_infty = UINT32_C(255) << 23;
-    static const uint32_t f16u_max = (UINT32_C(127) + UINT32_C(16)) << 23;
-    static const uint32_t denorm_magic =
-      ((UINT32_C(127) - UINT32_C(15)) + (UINT32_C(23) - UINT32_C(10)) + UINT32_C(1)) << 23;
-    uint16_t f16u;
-
-    uint32_t sign = f32u & (UINT32_C(1) << 31);
-    f32u ^= sign;
-
-   /* NOTE all the integer compares in this function cast the operands
-    * to signed values to help compilers vectorize to SSE2, which lacks
-    * unsigned comparison instructions.  This is fine since all
-    * operands are below 0x80000000 (we clear the sign bit). */
-
-    if (f32u > f16u_max) { /* result is Inf or NaN (all exponent bits set) */
-      f16u = (f32u > f32u_infty) ?  UINT32_C(0x7e00) : UINT32_C(0x7c00); /* NaN->qNaN and Inf->Inf */
-    } else { /* (De)normalized number or zero */
-      if (f32u < (UINT32_C(113) << 23)) { /* resulting FP16 is subnormal or zero */
-        /* use a magic value to align our 10 mantissa bits at the bottom of
-        * the float. as long as FP addition is round-to-nearest-even this
-        * just works. */
-        f32u = simde_float32_as_uint32(simde_uint32_as_float32(f32u) + simde_uint32_as_float32(denorm_magic));
-
-        /* and one integer subtract of the bias later, we have our final float! */
-        f16u = HEDLEY_STATIC_CAST(uint16_t, f32u - denorm_magic);
-      } else {
-        uint32_t mant_odd = (f32u >> 13) & 1;
-
-        /* update exponent, rounding bias part 1 */
-        f32u += (HEDLEY_STATIC_CAST(uint32_t, 15 - 127) << 23) + UINT32_C(0xfff);
-        /* rounding bias part 2 */
-        f32u += mant_odd;
-        /* take the bits! */
-        f16u = HEDLEY_STATIC_CAST(uint16_t, f32u >> 13);
-      }
-    }
-
-    f16u |= sign >> 16;
-    res = simde_uint16_as_float16(f16u);
+    res = simde_uint16_as_float16(simde_x_f32_bits_to_f16_bits_(simde_float32_as_uint32(value)));
   #endif
 
   return res;
@@ -233,32 +283,66 @@ simde_float32
 simde_float16_to_float32 (simde_float16 value) {
   simde_float32 res;
 
-  #if defined(SIMDE_FLOAT16_FLOAT16) || defined(SIMDE_FLOAT16_FP16)
+  #if \
+      defined(SIMDE_FLOAT16_CONVERSION_NATIVE) && ( \
+        (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FLOAT16) || \
+        (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FP16))
     res = HEDLEY_STATIC_CAST(simde_float32, value);
+  #elif defined(SIMDE_FLOAT16_CONVERSION_NATIVE) && (SIMDE_FLOAT16_API == SIMDE_FLOAT16_API_FP16_NO_ABI)
+    res = HEDLEY_STATIC_CAST(simde_float32, value.value);
   #else
-    /* This code is CC0, based heavily on code by Fabian Giesen. */
-    uint16_t half = simde_float16_as_uint16(value);
-    const simde_float32 denorm_magic = simde_uint32_as_float32((UINT32_C(113) << 23));
-    const uint32_t shifted_exp = UINT32_C(0x7c00) << 13; /* exponent mask after shift */
-    uint32_t f32u;
-
-    f32u = (half & UINT32_C(0x7fff)) << 13; /* exponent/mantissa bits */
-    uint32_t exp = shifted_exp & f32u; /* just the exponent */
-    f32u += (UINT32_C(127) - UINT32_C(15)) << 23; /* exponent adjust */
-
-    /* handle exponent special cases */
-    if (exp == shifted_exp) /* Inf/NaN? */
-      f32u += (UINT32_C(128) - UINT32_C(16)) << 23; /* extra exp adjust */
-    else if (exp == 0) { /* Zero/Denormal? */
-      f32u += (1) << 23; /* extra exp adjust */
-      f32u = simde_float32_as_uint32(simde_uint32_as_float32(f32u) - denorm_magic); /* renormalize */
+    res = simde_uint32_as_float32(simde_x_f16_bits_to_f32_bits_(simde_float16_as_uint16(value)));
+  #endif
+
+  return res;
+}
+
+/* Bulk conversion between arrays.  These produce the same results as
+ * converting each element with simde_float16_from_float32 /
+ * simde_float16_to_float32 (round to nearest even), but use the
+ * hardware vector conversions when available. */
+SIMDE_HUGE_FUNCTION_ATTRIBUTES
+void
+simde_x_convert_f32_to_f16_array (simde_float16* dst, const simde_float32* src, size_t n) {
+  size_t i = 0;
+
+  #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    for ( ; i + 8 <= n ; i += 8) {
+      _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, &(dst[i])),
+        _mm256_cvtps_ph(_mm256_loadu_ps(&(src[i])), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    for ( ; i + 4 <= n ; i += 4) {
+      vst1_f16(HEDLEY_REINTERPRET_CAST(float16_t*, &(dst[i])), vcvt_f16_f32(vld1q_f32(&(src[i]))));
     }
+  #endif
+
+  SIMDE_VECTORIZE
+  for (size_t j = i ; j < n ; j++) {
+    dst[j] = simde_float16_from_float32(src[j]);
+  }
+}
+
+SIMDE_HUGE_FUNCTION_ATTRIBUTES
+void
+simde_x_convert_f16_to_f32_array (simde_float32* dst, const simde_float16* src, size_t n) {
+  size_t i = 0;
 
-    f32u |= (half & UINT32_C(0x8000)) << 16; /* sign bit */
-    res = simde_uint32_as_float32(f32u);
+  #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    for ( ; i + 8 <= n ; i += 8) {
+      _mm256_storeu_ps(&(dst[i]),
+        _mm256_cvtph_ps(_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const __m128i*, &(src[i])))));
+    }
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    for ( ; i + 4 <= n ; i += 4) {
+      vst1q_f32(&(dst[i]), vcvt_f32_f16(vld1_f16(HEDLEY_REINTERPRET_CAST(const float16_t*, &(src[i])))));
+    }
   #endif
 
-  return res;
+  SIMDE_VECTORIZE
+  for (size_t j = i ; j < n ; j++) {
+    dst[j] = simde_float16_to_float32(src[j]);
+  }
 }
 
 #ifdef SIMDE_FLOAT16_C
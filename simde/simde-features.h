@@ -95,6 +95,15 @@
   #define SIMDE_X86_AVX512F_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_AVXVNNI_NATIVE) && !defined(SIMDE_X86_AVXVNNI_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVXVNNI)
+    #define SIMDE_X86_AVXVNNI_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVXVNNI_NATIVE) && !defined(SIMDE_X86_AVX2_NATIVE)
+  #define SIMDE_X86_AVX2_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_AVX5124VNNIW_NATIVE) && !defined(SIMDE_X86_AVX5124VNNIW_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_AVX5124VNNIW)
     #define SIMDE_X86_AVX5124VNNIW_NATIVE
@@ -248,6 +257,21 @@
   #define SIMDE_X86_SSE2_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_VAES_NATIVE) && !defined(SIMDE_X86_VAES_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_VAES)
+    #define SIMDE_X86_VAES_NATIVE
+  #endif
+#endif
+
+#if !defined(SIMDE_X86_SHA_NATIVE) && !defined(SIMDE_X86_SHA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_SHA)
+    #define SIMDE_X86_SHA_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_SHA_NATIVE) && !defined(SIMDE_X86_SSE2_NATIVE)
+  #define SIMDE_X86_SSE2_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_SSE2_NATIVE) && !defined(SIMDE_X86_SSE2_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_SSE2)
     #define SIMDE_X86_SSE2_NATIVE
@@ -293,6 +317,24 @@
   #endif
 #endif
 
+#if !defined(SIMDE_X86_BMI1_NATIVE) && !defined(SIMDE_X86_BMI1_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_BMI1)
+    #define SIMDE_X86_BMI1_NATIVE
+  #endif
+#endif
+
+#if !defined(SIMDE_X86_BMI2_NATIVE) && !defined(SIMDE_X86_BMI2_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_BMI2)
+    #define SIMDE_X86_BMI2_NATIVE
+  #endif
+#endif
+
+#if !defined(SIMDE_X86_LZCNT_NATIVE) && !defined(SIMDE_X86_LZCNT_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_LZCNT)
+    #define SIMDE_X86_LZCNT_NATIVE
+  #endif
+#endif
+
 #if !defined(SIMDE_X86_SVML_NATIVE) && !defined(SIMDE_X86_SVML_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86) && (defined(__INTEL_COMPILER) || (HEDLEY_MSVC_VERSION_CHECK(14, 20, 0) && !defined(__clang__)))
     #define SIMDE_X86_SVML_NATIVE
@@ -305,7 +347,9 @@
 #endif
 
 #if \
-    defined(SIMDE_X86_AVX_NATIVE) || defined(SIMDE_X86_GFNI_NATIVE) || defined(SIMDE_X86_SVML_NATIVE)
+    defined(SIMDE_X86_AVX_NATIVE) || defined(SIMDE_X86_GFNI_NATIVE) || defined(SIMDE_X86_SVML_NATIVE) || \
+    defined(SIMDE_X86_BMI1_NATIVE) || defined(SIMDE_X86_BMI2_NATIVE) || defined(SIMDE_X86_LZCNT_NATIVE) || \
+    defined(SIMDE_X86_SHA_NATIVE)
   #include <immintrin.h>
 #elif defined(SIMDE_X86_SSE4_2_NATIVE)
   #include <nmmintrin.h>
@@ -682,9 +726,24 @@
   #if !defined(SIMDE_X86_F16C_NATIVE)
     #define SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES
   #endif
+  #if !defined(SIMDE_X86_BMI1_NATIVE)
+    #define SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_BMI2_NATIVE)
+    #define SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_LZCNT_NATIVE)
+    #define SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES
+  #endif
   #if !defined(SIMDE_X86_AES_NATIVE)
     #define SIMDE_X86_AES_ENABLE_NATIVE_ALIASES
   #endif
+  #if !defined(SIMDE_X86_VAES_NATIVE)
+    #define SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_SHA_NATIVE)
+    #define SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES
+  #endif
   #if !defined(SIMDE_X86_SVML_NATIVE)
     #define SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES
   #endif
@@ -59,7 +59,12 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
  * SIMDe headers which calls SLEEF directly we may use functions with
  * greater error if the API we're implementing is less precise (for
  * example, SVML guarantees 4 ULP, so we will generally use the 3.5
- * ULP functions from SLEEF). */
+ * ULP functions from SLEEF).
+ *
+ * The SVML functions use SLEEF's vector functions when the matching
+ * x86 extension is available natively, and its AdvSIMD functions
+ * (Sleef_*advsimd) on AArch64; 256- and 512-bit SVML calls are split
+ * into 128-bit AdvSIMD calls there. */
 #if !defined(SIMDE_MATH_SLEEF_DISABLE)
   #if defined(__SLEEF_H__)
     #define SIMDE_MATH_SLEEF_ENABLE
@@ -0,0 +1,147 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_SHA_H)
+#define SIMDE_SHA_H
+
+#include "simde-features.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+
+/* Scalar SHA-1 and SHA-256 round cores shared by the x86 SHA extensions
+ * (simde_mm_sha*_epu32) and the Armv8 SHA2 functions (simde_vsha*q_u32).
+ * The two ISAs disagree on how the working variables are packed into
+ * vectors (x86 keeps A in the high lane and splits SHA-256 into ABEF /
+ * CDGH, Arm keeps A in lane 0 and splits into ABCD / EFGH), so each
+ * front end unpacks into the plain order used here:
+ *
+ *  - SHA-1:   abcd[0..3] = A, B, C, D, plus E as a separate word.
+ *  - SHA-256: s[0..7] = A, B, C, D, E, F, G, H.
+ *
+ * The message schedule is not handled here; it vectorizes well, so both
+ * front ends implement it with their own vector operations. */
+
+static const uint32_t simde_x_sha1_k[4] = {
+  UINT32_C(0x5a827999), UINT32_C(0x6ed9eba1), UINT32_C(0x8f1bbcdc), UINT32_C(0xca62c1d6)
+};
+
+static const uint32_t simde_x_sha256_k[64] = {
+  UINT32_C(0x428a2f98), UINT32_C(0x71374491), UINT32_C(0xb5c0fbcf), UINT32_C(0xe9b5dba5),
+  UINT32_C(0x3956c25b), UINT32_C(0x59f111f1), UINT32_C(0x923f82a4), UINT32_C(0xab1c5ed5),
+  UINT32_C(0xd807aa98), UINT32_C(0x12835b01), UINT32_C(0x243185be), UINT32_C(0x550c7dc3),
+  UINT32_C(0x72be5d74), UINT32_C(0x80deb1fe), UINT32_C(0x9bdc06a7), UINT32_C(0xc19bf174),
+  UINT32_C(0xe49b69c1), UINT32_C(0xefbe4786), UINT32_C(0x0fc19dc6), UINT32_C(0x240ca1cc),
+  UINT32_C(0x2de92c6f), UINT32_C(0x4a7484aa), UINT32_C(0x5cb0a9dc), UINT32_C(0x76f988da),
+  UINT32_C(0x983e5152), UINT32_C(0xa831c66d), UINT32_C(0xb00327c8), UINT32_C(0xbf597fc7),
+  UINT32_C(0xc6e00bf3), UINT32_C(0xd5a79147), UINT32_C(0x06ca6351), UINT32_C(0x14292967),
+  UINT32_C(0x27b70a85), UINT32_C(0x2e1b2138), UINT32_C(0x4d2c6dfc), UINT32_C(0x53380d13),
+  UINT32_C(0x650a7354), UINT32_C(0x766a0abb), UINT32_C(0x81c2c92e), UINT32_C(0x92722c85),
+  UINT32_C(0xa2bfe8a1), UINT32_C(0xa81a664b), UINT32_C(0xc24b8b70), UINT32_C(0xc76c51a3),
+  UINT32_C(0xd192e819), UINT32_C(0xd6990624), UINT32_C(0xf40e3585), UINT32_C(0x106aa070),
+  UINT32_C(0x19a4c116), UINT32_C(0x1e376c08), UINT32_C(0x2748774c), UINT32_C(0x34b0bcb5),
+  UINT32_C(0x391c0cb3), UINT32_C(0x4ed8aa4a), UINT32_C(0x5b9cca4f), UINT32_C(0x682e6ff3),
+  UINT32_C(0x748f82ee), UINT32_C(0x78a5636f), UINT32_C(0x84c87814), UINT32_C(0x8cc70208),
+  UINT32_C(0x90befffa), UINT32_C(0xa4506ceb), UINT32_C(0xbef9a3f7), UINT32_C(0xc67178f2)
+};
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rotl32_(uint32_t v, unsigned int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rotr32_(uint32_t v, unsigned int n) {
+  return (v >> n) | (v << (32 - n));
+}
+
+/* Four SHA-1 rounds.  wk already includes the round constant, and e is
+ * only consumed by the first round, which is how both SHA1RNDS4 and
+ * SHA1C/SHA1P/SHA1M take it.  f uses the SHA1RNDS4 encoding: 0 is Ch,
+ * 1 and 3 are Parity, 2 is Maj. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_sha1_rounds4_(uint32_t abcd[4], uint32_t e, const uint32_t wk[4], int f) {
+  uint32_t a = abcd[0], b = abcd[1], c = abcd[2], d = abcd[3];
+
+  for (int i = 0 ; i < 4 ; i++) {
+    uint32_t t;
+    switch (f) {
+      case 0:
+        t = ((c ^ d) & b) ^ d;
+        break;
+      case 2:
+        t = (b & c) | ((b | c) & d);
+        break;
+      default:
+        t = b ^ c ^ d;
+        break;
+    }
+    t += e + simde_x_sha_rotl32_(a, 5) + wk[i];
+    e = d;
+    d = c;
+    c = simde_x_sha_rotl32_(b, 30);
+    b = a;
+    a = t;
+  }
+
+  abcd[0] = a;
+  abcd[1] = b;
+  abcd[2] = c;
+  abcd[3] = d;
+}
+
+/* n SHA-256 rounds, consuming wk[0..n-1] (W + K). */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_sha256_rounds_(uint32_t s[8], const uint32_t* wk, size_t n) {
+  uint32_t
+    a = s[0], b = s[1], c = s[2], d = s[3],
+    e = s[4], f = s[5], g = s[6], h = s[7];
+
+  for (size_t i = 0 ; i < n ; i++) {
+    uint32_t t1 =
+      h + wk[i] + (((f ^ g) & e) ^ g) +
+      (simde_x_sha_rotr32_(e, 6) ^ simde_x_sha_rotr32_(e, 11) ^ simde_x_sha_rotr32_(e, 25));
+    uint32_t t2 =
+      ((a & b) | ((a | b) & c)) +
+      (simde_x_sha_rotr32_(a, 2) ^ simde_x_sha_rotr32_(a, 13) ^ simde_x_sha_rotr32_(a, 22));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  s[0] = a; s[1] = b; s[2] = c; s[3] = d;
+  s[4] = e; s[5] = f; s[6] = g; s[7] = h;
+}
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_SHA_H) */
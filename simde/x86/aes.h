@@ -33,262 +33,11 @@
  * Based on the document FIPS PUB 197
  */
 
-#include "sse2.h"
-
-/*
- * Multiplication in GF(2^8)
- * http://en.wikipedia.org/wiki/Finite_field_arithmetic
- * Irreducible polynomial m(x) = x8 + x4 + x3 + x + 1
- *
- * NOTE: This function can be easily replaced with a look up table for a speed
- *       boost, at the expense of an increase in memory size.
-
-SIMDE_FUNCTION_ATTRIBUTES
-uint8_t gmult(uint8_t a, uint8_t b) {
-  uint8_t p = 0, i = 0, hbs = 0;
-
-  for (i = 0; i < 8; i++) {
-    if (b & 1) {
-      p ^= a;
-    }
-
-    hbs = a & 0x80;
-    a <<= 1;
-    if (hbs) a ^= 0x1b; // 0000 0001 0001 1011
-    b >>= 1;
-  }
-
-  return (uint8_t)p;
-}
- */
+#include "avx512/types.h"
 
 #if !(defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
-
-#include "../simde-aes.h"
-
-/*
- * Transformation in the Cipher and Inverse Cipher in which a Round
- * Key is added to the State using an XOR operation. The length of a
- * Round Key equals the size of the State (i.e., for Nb = 4, the Round
- * Key length equals 128 bits/16 bytes).
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_add_round_key(uint8_t *state, simde__m128i_private w, uint8_t r) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t c;
-
-  for (c = 0; c < Nb; c++) {
-    state[Nb*0+c] = state[Nb*0+c]^w.u8[4*Nb*r+4*c+0];
-    state[Nb*1+c] = state[Nb*1+c]^w.u8[4*Nb*r+4*c+1];
-    state[Nb*2+c] = state[Nb*2+c]^w.u8[4*Nb*r+4*c+2];
-    state[Nb*3+c] = state[Nb*3+c]^w.u8[4*Nb*r+4*c+3];
-  }
-}
-
-/*
- * Transformation in the Cipher that takes all of the columns of the
- * State and mixes their data (independently of one another) to
- * produce new columns.
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_mix_columns(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  // uint8_t k[] = {0x02, 0x01, 0x01, 0x03}; // a(x) = {02} + {01}x + {01}x2 + {03}x3
-  uint8_t i, j, col[4], res[4];
-
-  for (j = 0; j < Nb; j++) {
-    for (i = 0; i < 4; i++) {
-      col[i] = state[Nb*i+j];
-    }
-
-    //coef_mult(k, col, res);
-    simde_x_aes_coef_mult_lookup(0, col, res);
-
-    for (i = 0; i < 4; i++) {
-      state[Nb*i+j] = res[i];
-    }
-  }
-}
-
-/*
- * Transformation in the Inverse Cipher that is the inverse of
- * MixColumns().
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_inv_mix_columns(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  // uint8_t k[] = {0x0e, 0x09, 0x0d, 0x0b}; // a(x) = {0e} + {09}x + {0d}x2 + {0b}x3
-  uint8_t i, j, col[4], res[4];
-
-  for (j = 0; j < Nb; j++) {
-    for (i = 0; i < 4; i++) {
-      col[i] = state[Nb*i+j];
-    }
-
-    //coef_mult(k, col, res);
-    simde_x_aes_coef_mult_lookup(4, col, res);
-
-    for (i = 0; i < 4; i++) {
-      state[Nb*i+j] = res[i];
-    }
-  }
-}
-
-/*
- * Transformation in the Cipher that processes the State by cyclically
- * shifting the last three rows of the State by different offsets.
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_shift_rows(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t i, k, s, tmp;
-
-  for (i = 1; i < 4; i++) {
-    // shift(1,4)=1; shift(2,4)=2; shift(3,4)=3
-    // shift(r, 4) = r;
-    s = 0;
-    while (s < i) {
-      tmp = state[Nb*i+0];
-
-      for (k = 1; k < Nb; k++) {
-        state[Nb*i+k-1] = state[Nb*i+k];
-      }
-
-      state[Nb*i+Nb-1] = tmp;
-      s++;
-    }
-  }
-}
-
-/*
- * Transformation in the Inverse Cipher that is the inverse of
- * ShiftRows().
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_inv_shift_rows(uint8_t *state) {
-
-  uint8_t Nb = simde_x_aes_Nb;
-  uint8_t i, k, s, tmp;
-
-  for (i = 1; i < 4; i++) {
-    s = 0;
-    while (s < i) {
-      tmp = state[Nb*i+Nb-1];
-
-      for (k = Nb-1; k > 0; k--) {
-        state[Nb*i+k] = state[Nb*i+k-1];
-      }
-
-      state[Nb*i+0] = tmp;
-      s++;
-    }
-  }
-}
-
-/*
- * Transformation in the Cipher that processes the State using a non
- * linear byte substitution table (S-box) that operates on each of the
- * State bytes independently.
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_sub_bytes(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      // s_box row: yyyy ----
-      // s_box col: ---- xxxx
-      // s_box[16*(yyyy) + xxxx] == s_box[yyyyxxxx]
-      state[Nb*i+j] = simde_x_aes_s_box[state[Nb*i+j]];
-    }
-  }
-}
-
-/*
- * Transformation in the Inverse Cipher that is the inverse of
- * SubBytes().
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_inv_sub_bytes(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      state[Nb*i+j] = simde_x_aes_inv_s_box[state[Nb*i+j]];
-    }
-  }
-}
-
-/*
- * Performs the AES cipher operation
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_enc(simde__m128i_private in, simde__m128i_private *out, simde__m128i_private w, int is_last) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t state[4*simde_x_aes_Nb];
-  uint8_t r = 0, i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      state[Nb*i+j] = in.u8[i+4*j];
-    }
-  }
-
-  simde_x_aes_sub_bytes(state);
-  simde_x_aes_shift_rows(state);
-
-  if (!is_last)
-    simde_x_aes_mix_columns(state);
-
-  simde_x_aes_add_round_key(state, w, r);
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      out->u8[i+4*j] = state[Nb*i+j];
-    }
-  }
-}
-
-/*
- * Performs the AES inverse cipher operation
- */
-SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_dec(simde__m128i_private in, simde__m128i_private *out, simde__m128i_private w, int is_last) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t state[4*simde_x_aes_Nb];
-  uint8_t r = 0, i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      state[Nb*i+j] = in.u8[i+4*j];
-    }
-  }
-
-  simde_x_aes_inv_shift_rows(state);
-  simde_x_aes_inv_sub_bytes(state);
-
-  if (!is_last)
-    simde_x_aes_inv_mix_columns(state);
-
-  simde_x_aes_add_round_key(state, w, r);
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      out->u8[i+4*j] = state[Nb*i+j];
-    }
-  }
-}
-#endif // if !(defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
+  #include "../simde-aes.h"
+#endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i simde_mm_aesenc_si128(simde__m128i a, simde__m128i round_key) {
@@ -303,7 +52,11 @@ simde__m128i simde_mm_aesenc_si128(simde__m128i a, simde__m128i round_key) {
         vaesmcq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0))),
         round_key_.neon_u8);
     #else
-      simde_x_aes_enc(a_, &result_, round_key_, 0);
+      simde_x_aes_enc_round(
+        HEDLEY_REINTERPRET_CAST(uint8_t*, &result_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &a_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &round_key_),
+        0);
     #endif
     return simde__m128i_from_private(result_);
   #endif
@@ -325,7 +78,11 @@ simde__m128i simde_mm_aesdec_si128(simde__m128i a, simde__m128i round_key) {
         vaesimcq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0))),
         round_key_.neon_u8);
     #else
-      simde_x_aes_dec(a_, &result_, round_key_, 0);
+      simde_x_aes_dec_round(
+        HEDLEY_REINTERPRET_CAST(uint8_t*, &result_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &a_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &round_key_),
+        0);
     #endif
     return simde__m128i_from_private(result_);
   #endif
@@ -346,7 +103,11 @@ simde__m128i simde_mm_aesenclast_si128(simde__m128i a, simde__m128i round_key) {
       result_.neon_u8 = vaeseq_u8(a_.neon_u8, vdupq_n_u8(0));
       result_.neon_i32 = veorq_s32(result_.neon_i32, round_key_.neon_i32); // _mm_xor_si128
     #else
-      simde_x_aes_enc(a_, &result_, round_key_, 1);
+      simde_x_aes_enc_round(
+        HEDLEY_REINTERPRET_CAST(uint8_t*, &result_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &a_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &round_key_),
+        1);
     #endif
     return simde__m128i_from_private(result_);
   #endif
@@ -368,7 +129,11 @@ simde__m128i simde_mm_aesdeclast_si128(simde__m128i a, simde__m128i round_key) {
         vaesdq_u8(a_.neon_u8, vdupq_n_u8(0)),
         round_key_.neon_u8);
     #else
-      simde_x_aes_dec(a_, &result_, round_key_, 1);
+      simde_x_aes_dec_round(
+        HEDLEY_REINTERPRET_CAST(uint8_t*, &result_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &a_),
+        HEDLEY_REINTERPRET_CAST(const uint8_t*, &round_key_),
+        1);
     #endif
     return simde__m128i_from_private(result_);
   #endif
@@ -382,28 +147,14 @@ simde__m128i simde_mm_aesimc_si128(simde__m128i a) {
   #if defined(SIMDE_X86_AES_NATIVE)
     return _mm_aesimc_si128(a);
   #else
-    simde__m128i_private result_ = simde__m128i_to_private(simde_mm_setzero_si128());
+    simde__m128i_private result_;
     simde__m128i_private a_ = simde__m128i_to_private(a);
 
     #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
       result_.neon_u8 = vaesimcq_u8(a_.neon_u8);
     #else
-      int Nb = simde_x_aes_Nb;
-      // uint8_t k[] = {0x0e, 0x09, 0x0d, 0x0b}; // a(x) = {0e} + {09}x + {0d}x2 + {0b}x3
-      uint8_t i, j, col[4], res[4];
-
-      for (j = 0; j < Nb; j++) {
-        for (i = 0; i < 4; i++) {
-          col[i] = a_.u8[Nb*j+i];
-        }
-
-        //coef_mult(k, col, res);
-        simde_x_aes_coef_mult_lookup(4, col, res);
-
-        for (i = 0; i < 4; i++) {
-          result_.u8[Nb*j+i] = res[i];
-        }
-      }
+      result_ = a_;
+      simde_x_aes_inv_mix_columns(HEDLEY_REINTERPRET_CAST(uint8_t*, &result_));
     #endif
     return simde__m128i_from_private(result_);
   #endif
@@ -412,6 +163,301 @@ simde__m128i simde_mm_aesimc_si128(simde__m128i a) {
   #define _mm_aesimc_si128(a) simde_mm_aesimc_si128(a)
 #endif
 
-#undef simde_x_aes_Nb
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesenc_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesenc_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesenc_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesenc_epi128
+  #define _mm256_aesenc_epi128(a, b) simde_mm256_aesenc_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesdec_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesdec_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesdec_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesdec_epi128
+  #define _mm256_aesdec_epi128(a, b) simde_mm256_aesdec_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesenclast_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesenclast_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesenclast_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesenclast_epi128
+  #define _mm256_aesenclast_epi128(a, b) simde_mm256_aesenclast_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesdeclast_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesdeclast_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesdeclast_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesdeclast_epi128
+  #define _mm256_aesdeclast_epi128(a, b) simde_mm256_aesdeclast_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesenc_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesenc_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesenc_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesenc_epi128
+  #define _mm512_aesenc_epi128(a, b) simde_mm512_aesenc_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesdec_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesdec_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesdec_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesdec_epi128
+  #define _mm512_aesdec_epi128(a, b) simde_mm512_aesdec_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesenclast_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesenclast_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesenclast_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesenclast_epi128
+  #define _mm512_aesenclast_epi128(a, b) simde_mm512_aesenclast_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesdeclast_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesdeclast_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesdeclast_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesdeclast_epi128
+  #define _mm512_aesdeclast_epi128(a, b) simde_mm512_aesdeclast_epi128(a, b)
+#endif
+
+/*
+ * Encrypts (or, equivalently, decrypts) `blocks` 16-byte blocks from
+ * `in` to `out` in counter mode.
+ *
+ * `round_keys` holds the `rounds` + 1 expanded round keys (`rounds` is
+ * 10, 12 or 14 for AES-128/192/256).  `counter` is the first counter
+ * block; as in GCM, only its last four bytes are incremented, as a
+ * big-endian integer, and on return it holds the next unused counter.
+ * `in` and `out` may point to the same buffer.
+ *
+ * Eight blocks are processed together so the rounds of independent
+ * blocks can overlap; with VAES and AVX-512 that is two 512-bit
+ * instructions per round.
+ */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_ctr_encrypt_blocks(void* out, const void* in, size_t blocks, const simde__m128i* round_keys, int rounds, uint8_t counter[16]) {
+  uint8_t* dst = HEDLEY_REINTERPRET_CAST(uint8_t*, out);
+  const uint8_t* src = HEDLEY_REINTERPRET_CAST(const uint8_t*, in);
+  uint8_t cb[8][16];
+  uint32_t ctr =
+    (HEDLEY_STATIC_CAST(uint32_t, counter[12]) << 24) |
+    (HEDLEY_STATIC_CAST(uint32_t, counter[13]) << 16) |
+    (HEDLEY_STATIC_CAST(uint32_t, counter[14]) <<  8) |
+    (HEDLEY_STATIC_CAST(uint32_t, counter[15])      );
+  size_t i = 0;
+
+  /* Only the last four bytes of each counter block change. */
+  for (size_t j = 0 ; j < 8 ; j++) {
+    simde_memcpy(cb[j], counter, 12);
+  }
+
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    if (blocks >= 8) {
+      __m512i rk[15];
+      for (int r = 0 ; r <= rounds ; r++) {
+        simde__m512i_private rk_;
+        for (size_t k = 0 ; k < (sizeof(rk_.m128i) / sizeof(rk_.m128i[0])) ; k++) {
+          rk_.m128i[k] = round_keys[r];
+        }
+        rk[r] = simde__m512i_from_private(rk_);
+      }
+
+      for ( ; i + 8 <= blocks ; i += 8) {
+        for (size_t j = 0 ; j < 8 ; j++) {
+          uint32_t c = ctr++;
+          cb[j][12] = HEDLEY_STATIC_CAST(uint8_t, c >> 24);
+          cb[j][13] = HEDLEY_STATIC_CAST(uint8_t, c >> 16);
+          cb[j][14] = HEDLEY_STATIC_CAST(uint8_t, c >>  8);
+          cb[j][15] = HEDLEY_STATIC_CAST(uint8_t, c      );
+        }
+
+        __m512i x0 = _mm512_xor_si512(_mm512_loadu_si512(cb[0]), rk[0]);
+        __m512i x1 = _mm512_xor_si512(_mm512_loadu_si512(cb[4]), rk[0]);
+        for (int r = 1 ; r < rounds ; r++) {
+          x0 = _mm512_aesenc_epi128(x0, rk[r]);
+          x1 = _mm512_aesenc_epi128(x1, rk[r]);
+        }
+        x0 = _mm512_aesenclast_epi128(x0, rk[rounds]);
+        x1 = _mm512_aesenclast_epi128(x1, rk[rounds]);
+
+        _mm512_storeu_si512(&(dst[16 * i]), _mm512_xor_si512(x0, _mm512_loadu_si512(&(src[16 * i]))));
+        _mm512_storeu_si512(&(dst[16 * i + 64]), _mm512_xor_si512(x1, _mm512_loadu_si512(&(src[16 * i + 64]))));
+      }
+    }
+  #else
+    for ( ; i + 8 <= blocks ; i += 8) {
+      simde__m128i x[8];
+
+      for (size_t j = 0 ; j < 8 ; j++) {
+        uint32_t c = ctr++;
+        cb[j][12] = HEDLEY_STATIC_CAST(uint8_t, c >> 24);
+        cb[j][13] = HEDLEY_STATIC_CAST(uint8_t, c >> 16);
+        cb[j][14] = HEDLEY_STATIC_CAST(uint8_t, c >>  8);
+        cb[j][15] = HEDLEY_STATIC_CAST(uint8_t, c      );
+        x[j] = simde_mm_xor_si128(simde_mm_loadu_si128(cb[j]), round_keys[0]);
+      }
+
+      for (int r = 1 ; r < rounds ; r++) {
+        for (size_t j = 0 ; j < 8 ; j++) {
+          x[j] = simde_mm_aesenc_si128(x[j], round_keys[r]);
+        }
+      }
+
+      for (size_t j = 0 ; j < 8 ; j++) {
+        x[j] = simde_mm_aesenclast_si128(x[j], round_keys[rounds]);
+        simde_mm_storeu_si128(&(dst[16 * (i + j)]), simde_mm_xor_si128(x[j], simde_mm_loadu_si128(&(src[16 * (i + j)]))));
+      }
+    }
+  #endif
+
+  for ( ; i < blocks ; i++) {
+    uint32_t c = ctr++;
+    cb[0][12] = HEDLEY_STATIC_CAST(uint8_t, c >> 24);
+    cb[0][13] = HEDLEY_STATIC_CAST(uint8_t, c >> 16);
+    cb[0][14] = HEDLEY_STATIC_CAST(uint8_t, c >>  8);
+    cb[0][15] = HEDLEY_STATIC_CAST(uint8_t, c      );
+
+    simde__m128i x = simde_mm_xor_si128(simde_mm_loadu_si128(cb[0]), round_keys[0]);
+    for (int r = 1 ; r < rounds ; r++) {
+      x = simde_mm_aesenc_si128(x, round_keys[r]);
+    }
+    x = simde_mm_aesenclast_si128(x, round_keys[rounds]);
+
+    simde_mm_storeu_si128(&(dst[16 * i]), simde_mm_xor_si128(x, simde_mm_loadu_si128(&(src[16 * i]))));
+  }
+
+  counter[12] = HEDLEY_STATIC_CAST(uint8_t, ctr >> 24);
+  counter[13] = HEDLEY_STATIC_CAST(uint8_t, ctr >> 16);
+  counter[14] = HEDLEY_STATIC_CAST(uint8_t, ctr >>  8);
+  counter[15] = HEDLEY_STATIC_CAST(uint8_t, ctr      );
+}
 
 #endif /* !defined(SIMDE_X86_AES_H) */
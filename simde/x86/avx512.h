@@ -115,6 +115,7 @@
 #include "avx512/roundscale_round.h"
 #include "avx512/sad.h"
 #include "avx512/scalef.h"
+#include "avx512/scatter.h"
 #include "avx512/set.h"
 #include "avx512/set1.h"
 #include "avx512/set4.h"
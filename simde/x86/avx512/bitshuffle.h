@@ -18,7 +18,30 @@ simde_mm_bitshuffle_epi64_mask (simde__m128i b, simde__m128i c) {
       c_ = simde__m128i_to_private(c);
     simde__mmask16 r = 0;
 
-    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    /* Gather byte c >> 3 of each lane with a table lookup, then test
+     * bit c & 7 of it; one comparison covers the whole vector. */
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      const __m128i m7 = _mm_set1_epi8(7);
+      const __m128i base = _mm_set_epi64x(INT64_C(0x0808080808080808), 0);
+      const __m128i g = _mm_shuffle_epi8(b_.n, _mm_or_si128(_mm_and_si128(_mm_srli_epi16(c_.n, 3), m7), base));
+      const __m128i bit = _mm_shuffle_epi8(_mm_set_epi64x(0, INT64_C(0x8040201008040201)), _mm_and_si128(c_.n, m7));
+      r = HEDLEY_STATIC_CAST(simde__mmask16, _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(g, bit), bit)));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const uint8x16_t m7 = vdupq_n_u8(7);
+      const uint8x16_t k = vandq_u8(vshrq_n_u8(c_.neon_u8, 3), m7);
+      const uint8x16_t bit = vshlq_u8(vdupq_n_u8(1), vreinterpretq_s8_u8(vandq_u8(c_.neon_u8, m7)));
+      const uint8x8_t weights = vcreate_u8(UINT64_C(0x8040201008040201));
+      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+        const uint8x16_t g = vqtbl1q_u8(b_.neon_u8, vorrq_u8(k, vcombine_u8(vdup_n_u8(0), vdup_n_u8(8))));
+        const uint8x16_t w = vandq_u8(vtstq_u8(g, bit), vcombine_u8(weights, weights));
+        r = HEDLEY_STATIC_CAST(simde__mmask16, vaddv_u8(vget_low_u8(w)) | (vaddv_u8(vget_high_u8(w)) << 8));
+      #else
+        const uint8x16_t g = vcombine_u8(vtbl1_u8(vget_low_u8(b_.neon_u8), vget_low_u8(k)), vtbl1_u8(vget_high_u8(b_.neon_u8), vget_high_u8(k)));
+        const uint8x16_t w = vandq_u8(vtstq_u8(g, bit), vcombine_u8(weights, weights));
+        const uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(w)));
+        r = HEDLEY_STATIC_CAST(simde__mmask16, vgetq_lane_u64(sum, 0) | (vgetq_lane_u64(sum, 1) << 8));
+      #endif
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
       __typeof__(b_.u64) rv = { 0, 0 };
       __typeof__(b_.u64) lshift = { 0, 8 };
 
@@ -73,7 +96,14 @@ simde_mm256_bitshuffle_epi64_mask (simde__m256i b, simde__m256i c) {
       c_ = simde__m256i_to_private(c);
     simde__mmask32 r = 0;
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      /* See simde_mm_bitshuffle_epi64_mask. */
+      const __m256i m7 = _mm256_set1_epi8(7);
+      const __m256i base = _mm256_set_epi64x(INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0);
+      const __m256i g = _mm256_shuffle_epi8(b_.n, _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(c_.n, 3), m7), base));
+      const __m256i bit = _mm256_shuffle_epi8(_mm256_set1_epi64x(INT64_C(0x8040201008040201)), _mm256_and_si256(c_.n, m7));
+      r = HEDLEY_STATIC_CAST(simde__mmask32, _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(g, bit), bit)));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < sizeof(b_.m128i) / sizeof(b_.m128i[0]) ; i++) {
         r |= (HEDLEY_STATIC_CAST(simde__mmask32, simde_mm_bitshuffle_epi64_mask(b_.m128i[i], c_.m128i[i])) << (i * 16));
       }
@@ -136,7 +166,14 @@ simde_mm512_bitshuffle_epi64_mask (simde__m512i b, simde__m512i c) {
       c_ = simde__m512i_to_private(c);
     simde__mmask64 r = 0;
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if defined(SIMDE_X86_AVX512BW_NATIVE)
+      /* See simde_mm_bitshuffle_epi64_mask. */
+      const __m512i m7 = _mm512_set1_epi8(7);
+      const __m512i base = _mm512_set_epi64(INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0);
+      const __m512i g = _mm512_shuffle_epi8(b_.n, _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(c_.n, 3), m7), base));
+      const __m512i bit = _mm512_shuffle_epi8(_mm512_set1_epi64(INT64_C(0x8040201008040201)), _mm512_and_si512(c_.n, m7));
+      r = _mm512_test_epi8_mask(g, bit);
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < (sizeof(b_.m128i) / sizeof(b_.m128i[0])) ; i++) {
         r |= (HEDLEY_STATIC_CAST(simde__mmask64, simde_mm_bitshuffle_epi64_mask(b_.m128i[i], c_.m128i[i])) << (i * 16));
       }
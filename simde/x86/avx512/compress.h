@@ -2,16 +2,203 @@
 #define SIMDE_X86_AVX512_COMPRESS_H
 
 #include "types.h"
+#include "../avx2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_AVX2_NATIVE) || defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+/* Compressing eight lanes is a fixed permutation for each of the 256
+ * possible masks.  Bits 3j..3j+2 of entry k hold the position of the
+ * j-th set bit of k (unused fields are zero), and the top byte holds
+ * the number of set bits. */
+static const uint32_t simde_x_compress_table[256] = {
+  UINT32_C(0x00000000), UINT32_C(0x01000000), UINT32_C(0x01000001), UINT32_C(0x02000008), UINT32_C(0x01000002), UINT32_C(0x02000010), UINT32_C(0x02000011), UINT32_C(0x03000088),
+  UINT32_C(0x01000003), UINT32_C(0x02000018), UINT32_C(0x02000019), UINT32_C(0x030000c8), UINT32_C(0x0200001a), UINT32_C(0x030000d0), UINT32_C(0x030000d1), UINT32_C(0x04000688),
+  UINT32_C(0x01000004), UINT32_C(0x02000020), UINT32_C(0x02000021), UINT32_C(0x03000108), UINT32_C(0x02000022), UINT32_C(0x03000110), UINT32_C(0x03000111), UINT32_C(0x04000888),
+  UINT32_C(0x02000023), UINT32_C(0x03000118), UINT32_C(0x03000119), UINT32_C(0x040008c8), UINT32_C(0x0300011a), UINT32_C(0x040008d0), UINT32_C(0x040008d1), UINT32_C(0x05004688),
+  UINT32_C(0x01000005), UINT32_C(0x02000028), UINT32_C(0x02000029), UINT32_C(0x03000148), UINT32_C(0x0200002a), UINT32_C(0x03000150), UINT32_C(0x03000151), UINT32_C(0x04000a88),
+  UINT32_C(0x0200002b), UINT32_C(0x03000158), UINT32_C(0x03000159), UINT32_C(0x04000ac8), UINT32_C(0x0300015a), UINT32_C(0x04000ad0), UINT32_C(0x04000ad1), UINT32_C(0x05005688),
+  UINT32_C(0x0200002c), UINT32_C(0x03000160), UINT32_C(0x03000161), UINT32_C(0x04000b08), UINT32_C(0x03000162), UINT32_C(0x04000b10), UINT32_C(0x04000b11), UINT32_C(0x05005888),
+  UINT32_C(0x03000163), UINT32_C(0x04000b18), UINT32_C(0x04000b19), UINT32_C(0x050058c8), UINT32_C(0x04000b1a), UINT32_C(0x050058d0), UINT32_C(0x050058d1), UINT32_C(0x0602c688),
+  UINT32_C(0x01000006), UINT32_C(0x02000030), UINT32_C(0x02000031), UINT32_C(0x03000188), UINT32_C(0x02000032), UINT32_C(0x03000190), UINT32_C(0x03000191), UINT32_C(0x04000c88),
+  UINT32_C(0x02000033), UINT32_C(0x03000198), UINT32_C(0x03000199), UINT32_C(0x04000cc8), UINT32_C(0x0300019a), UINT32_C(0x04000cd0), UINT32_C(0x04000cd1), UINT32_C(0x05006688),
+  UINT32_C(0x02000034), UINT32_C(0x030001a0), UINT32_C(0x030001a1), UINT32_C(0x04000d08), UINT32_C(0x030001a2), UINT32_C(0x04000d10), UINT32_C(0x04000d11), UINT32_C(0x05006888),
+  UINT32_C(0x030001a3), UINT32_C(0x04000d18), UINT32_C(0x04000d19), UINT32_C(0x050068c8), UINT32_C(0x04000d1a), UINT32_C(0x050068d0), UINT32_C(0x050068d1), UINT32_C(0x06034688),
+  UINT32_C(0x02000035), UINT32_C(0x030001a8), UINT32_C(0x030001a9), UINT32_C(0x04000d48), UINT32_C(0x030001aa), UINT32_C(0x04000d50), UINT32_C(0x04000d51), UINT32_C(0x05006a88),
+  UINT32_C(0x030001ab), UINT32_C(0x04000d58), UINT32_C(0x04000d59), UINT32_C(0x05006ac8), UINT32_C(0x04000d5a), UINT32_C(0x05006ad0), UINT32_C(0x05006ad1), UINT32_C(0x06035688),
+  UINT32_C(0x030001ac), UINT32_C(0x04000d60), UINT32_C(0x04000d61), UINT32_C(0x05006b08), UINT32_C(0x04000d62), UINT32_C(0x05006b10), UINT32_C(0x05006b11), UINT32_C(0x06035888),
+  UINT32_C(0x04000d63), UINT32_C(0x05006b18), UINT32_C(0x05006b19), UINT32_C(0x060358c8), UINT32_C(0x05006b1a), UINT32_C(0x060358d0), UINT32_C(0x060358d1), UINT32_C(0x071ac688),
+  UINT32_C(0x01000007), UINT32_C(0x02000038), UINT32_C(0x02000039), UINT32_C(0x030001c8), UINT32_C(0x0200003a), UINT32_C(0x030001d0), UINT32_C(0x030001d1), UINT32_C(0x04000e88),
+  UINT32_C(0x0200003b), UINT32_C(0x030001d8), UINT32_C(0x030001d9), UINT32_C(0x04000ec8), UINT32_C(0x030001da), UINT32_C(0x04000ed0), UINT32_C(0x04000ed1), UINT32_C(0x05007688),
+  UINT32_C(0x0200003c), UINT32_C(0x030001e0), UINT32_C(0x030001e1), UINT32_C(0x04000f08), UINT32_C(0x030001e2), UINT32_C(0x04000f10), UINT32_C(0x04000f11), UINT32_C(0x05007888),
+  UINT32_C(0x030001e3), UINT32_C(0x04000f18), UINT32_C(0x04000f19), UINT32_C(0x050078c8), UINT32_C(0x04000f1a), UINT32_C(0x050078d0), UINT32_C(0x050078d1), UINT32_C(0x0603c688),
+  UINT32_C(0x0200003d), UINT32_C(0x030001e8), UINT32_C(0x030001e9), UINT32_C(0x04000f48), UINT32_C(0x030001ea), UINT32_C(0x04000f50), UINT32_C(0x04000f51), UINT32_C(0x05007a88),
+  UINT32_C(0x030001eb), UINT32_C(0x04000f58), UINT32_C(0x04000f59), UINT32_C(0x05007ac8), UINT32_C(0x04000f5a), UINT32_C(0x05007ad0), UINT32_C(0x05007ad1), UINT32_C(0x0603d688),
+  UINT32_C(0x030001ec), UINT32_C(0x04000f60), UINT32_C(0x04000f61), UINT32_C(0x05007b08), UINT32_C(0x04000f62), UINT32_C(0x05007b10), UINT32_C(0x05007b11), UINT32_C(0x0603d888),
+  UINT32_C(0x04000f63), UINT32_C(0x05007b18), UINT32_C(0x05007b19), UINT32_C(0x0603d8c8), UINT32_C(0x05007b1a), UINT32_C(0x0603d8d0), UINT32_C(0x0603d8d1), UINT32_C(0x071ec688),
+  UINT32_C(0x0200003e), UINT32_C(0x030001f0), UINT32_C(0x030001f1), UINT32_C(0x04000f88), UINT32_C(0x030001f2), UINT32_C(0x04000f90), UINT32_C(0x04000f91), UINT32_C(0x05007c88),
+  UINT32_C(0x030001f3), UINT32_C(0x04000f98), UINT32_C(0x04000f99), UINT32_C(0x05007cc8), UINT32_C(0x04000f9a), UINT32_C(0x05007cd0), UINT32_C(0x05007cd1), UINT32_C(0x0603e688),
+  UINT32_C(0x030001f4), UINT32_C(0x04000fa0), UINT32_C(0x04000fa1), UINT32_C(0x05007d08), UINT32_C(0x04000fa2), UINT32_C(0x05007d10), UINT32_C(0x05007d11), UINT32_C(0x0603e888),
+  UINT32_C(0x04000fa3), UINT32_C(0x05007d18), UINT32_C(0x05007d19), UINT32_C(0x0603e8c8), UINT32_C(0x05007d1a), UINT32_C(0x0603e8d0), UINT32_C(0x0603e8d1), UINT32_C(0x071f4688),
+  UINT32_C(0x030001f5), UINT32_C(0x04000fa8), UINT32_C(0x04000fa9), UINT32_C(0x05007d48), UINT32_C(0x04000faa), UINT32_C(0x05007d50), UINT32_C(0x05007d51), UINT32_C(0x0603ea88),
+  UINT32_C(0x04000fab), UINT32_C(0x05007d58), UINT32_C(0x05007d59), UINT32_C(0x0603eac8), UINT32_C(0x05007d5a), UINT32_C(0x0603ead0), UINT32_C(0x0603ead1), UINT32_C(0x071f5688),
+  UINT32_C(0x04000fac), UINT32_C(0x05007d60), UINT32_C(0x05007d61), UINT32_C(0x0603eb08), UINT32_C(0x05007d62), UINT32_C(0x0603eb10), UINT32_C(0x0603eb11), UINT32_C(0x071f5888),
+  UINT32_C(0x05007d63), UINT32_C(0x0603eb18), UINT32_C(0x0603eb19), UINT32_C(0x071f58c8), UINT32_C(0x0603eb1a), UINT32_C(0x071f58d0), UINT32_C(0x071f58d1), UINT32_C(0x08fac688)
+};
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_compress_count_(unsigned int k) {
+  return HEDLEY_STATIC_CAST(int, simde_x_compress_table[k & 0xff] >> 24);
+}
+#endif
+
+#if defined(SIMDE_X86_AVX2_NATIVE)
+/* Lanes of the result past the number of set bits in k are unspecified. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m256i
+simde_x_mm256_compress_epi32_(__m256i a, unsigned int k) {
+  const __m256i idx =
+    _mm256_srlv_epi32(
+      _mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_compress_table[k & 0xff])),
+      _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21));
+  return _mm256_permutevar8x32_epi32(a, idx);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+__m256i
+simde_x_mm256_compress_epi64_(__m256i a, unsigned int k) {
+  __m256i idx =
+    _mm256_srlv_epi32(
+      _mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_compress_table[k & 0xf])),
+      _mm256_setr_epi32(0, 0, 3, 3, 6, 6, 9, 9));
+  idx = _mm256_add_epi32(_mm256_slli_epi32(idx, 1), _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+  return _mm256_permutevar8x32_epi32(a, idx);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+__m256i
+simde_x_mm256_first_n_epi32_(int n) {
+  return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+__m256i
+simde_x_mm256_first_n_epi64_(int n) {
+  return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n), _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+/* Compresses the 512-bit vector held in *lo and *hi in place and
+ * returns the number of lanes kept.  The compressed high half is
+ * rotated up by the low half's count so the two can be blended without
+ * going through memory. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm256x2_compress_epi32_(__m256i* lo, __m256i* hi, unsigned int k) {
+  const int n0 = simde_x_compress_count_(k & 0xff);
+  const __m256i l = simde_x_mm256_compress_epi32_(*lo, k & 0xff);
+  __m256i h = simde_x_mm256_compress_epi32_(*hi, (k >> 8) & 0xff);
+
+  h = _mm256_permutevar8x32_epi32(h, _mm256_sub_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(n0)));
+  *lo = _mm256_blendv_epi8(h, l, simde_x_mm256_first_n_epi32_(n0));
+  *hi = h;
+
+  return n0 + simde_x_compress_count_((k >> 8) & 0xff);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm256x2_compress_epi64_(__m256i* lo, __m256i* hi, unsigned int k) {
+  const int n0 = simde_x_compress_count_(k & 0xf);
+  const __m256i l = simde_x_mm256_compress_epi64_(*lo, k & 0xf);
+  __m256i h = simde_x_mm256_compress_epi64_(*hi, (k >> 4) & 0xf);
+  __m256i idx = _mm256_sub_epi32(_mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3), _mm256_set1_epi32(n0));
+
+  idx = _mm256_add_epi32(_mm256_slli_epi32(idx, 1), _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+  h = _mm256_permutevar8x32_epi32(h, idx);
+  *lo = _mm256_blendv_epi8(h, l, simde_x_mm256_first_n_epi64_(n0));
+  *hi = h;
+
+  return n0 + simde_x_compress_count_((k >> 4) & 0xf);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_mm_compress_epi16_(__m128i a, unsigned int k) {
+  const __m256i f =
+    _mm256_and_si256(
+      _mm256_srlv_epi32(
+        _mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_compress_table[k & 0xff])),
+        _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21)),
+      _mm256_set1_epi32(7));
+  const __m128i idx = _mm_packus_epi32(_mm256_castsi256_si128(f), _mm256_extracti128_si256(f, 1));
+  return _mm_shuffle_epi8(a, _mm_add_epi16(_mm_mullo_epi16(idx, _mm_set1_epi16(0x0202)), _mm_set1_epi16(0x0100)));
+}
+#endif
+
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+/* Compresses size bytes at a into r sixteen bytes at a time, one TBL
+ * per chunk.  Each chunk is stored whole, so r needs sixteen bytes of
+ * slack; returns the number of bytes kept. */
+SIMDE_FUNCTION_ATTRIBUTES
+size_t
+simde_x_neon_compress_(void* r, const void* a, size_t size, uint64_t k, size_t lane_size) {
+  static const int32_t shifts16[8] = { 0, -3, -6, -9, -12, -15, -18, -21 };
+  static const int32_t shifts32[4] = { 0, -3, -6, -9 };
+  static const int32_t shifts64[4] = { 0,  0, -3, -3 };
+  const uint8_t* a_ = HEDLEY_REINTERPRET_CAST(const uint8_t*, a);
+  uint8_t* r_ = HEDLEY_REINTERPRET_CAST(uint8_t*, r);
+  const size_t lanes = 16 / lane_size;
+  const uint64_t lanes_mask = (UINT64_C(1) << lanes) - 1;
+  size_t ri = 0;
+
+  for (size_t i = 0 ; i < size ; i += 16) {
+    const uint32_t e = simde_x_compress_table[k & lanes_mask];
+    uint8x16_t idx;
+
+    if (lane_size == 2) {
+      uint16x8_t f = vcombine_u16(
+        vmovn_u32(vshlq_u32(vdupq_n_u32(e), vld1q_s32(&(shifts16[0])))),
+        vmovn_u32(vshlq_u32(vdupq_n_u32(e), vld1q_s32(&(shifts16[4])))));
+      f = vandq_u16(f, vdupq_n_u16(7));
+      idx = vreinterpretq_u8_u16(vmlaq_n_u16(vdupq_n_u16(UINT16_C(0x0100)), f, UINT16_C(0x0202)));
+    } else if (lane_size == 4) {
+      const uint32x4_t f = vandq_u32(vshlq_u32(vdupq_n_u32(e), vld1q_s32(shifts32)), vdupq_n_u32(7));
+      idx = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(UINT32_C(0x03020100)), f, UINT32_C(0x04040404)));
+    } else {
+      const uint32x4_t f = vandq_u32(vshlq_u32(vdupq_n_u32(e), vld1q_s32(shifts64)), vdupq_n_u32(7));
+      const uint32x4_t base = vreinterpretq_u32_u64(vdupq_n_u64(UINT64_C(0x0706050403020100)));
+      idx = vreinterpretq_u8_u32(vmlaq_n_u32(base, f, UINT32_C(0x08080808)));
+    }
+
+    vst1q_u8(r_ + ri, vqtbl1q_u8(vld1q_u8(a_ + i), idx));
+    ri += HEDLEY_STATIC_CAST(size_t, e >> 24) * lane_size;
+    k >>= lanes;
+  }
+
+  return ri;
+}
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256d
 simde_mm256_mask_compress_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_mask_compress_pd(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi64_(_mm256_castpd_si256(a), k);
+    return _mm256_castsi256_pd(_mm256_blendv_epi8(_mm256_castpd_si256(src), r, simde_x_mm256_first_n_epi64_(simde_x_compress_count_(k & 0xf))));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      a_ = simde__m256d_to_private(a),
+      r_ = simde__m256d_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f64[0])));
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       a_ = simde__m256d_to_private(a),
@@ -45,6 +232,15 @@ simde_mm256_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m25
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm256_mask_storeu_pd(base_addr, store_mask, _mm256_maskz_compress_pd(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi64_(_mm256_castpd_si256(a), k);
+    _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long*, base_addr), simde_x_mm256_first_n_epi64_(simde_x_compress_count_(k & 0xf)), r);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      a_ = simde__m256d_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f64[0])));
   #else
     simde__m256d_private
       a_ = simde__m256d_to_private(a);
@@ -72,6 +268,19 @@ simde__m256d
 simde_mm256_maskz_compress_pd (simde__mmask8 k, simde__m256d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_maskz_compress_pd(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi64_(_mm256_castpd_si256(a), k);
+    return _mm256_castsi256_pd(_mm256_and_si256(r, simde_x_mm256_first_n_epi64_(simde_x_compress_count_(k & 0xf))));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      a_ = simde__m256d_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f64[0])));
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       a_ = simde__m256d_to_private(a);
@@ -101,6 +310,18 @@ simde__m256
 simde_mm256_mask_compress_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_mask_compress_ps(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi32_(_mm256_castps_si256(a), k);
+    return _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(src), r, simde_x_mm256_first_n_epi32_(simde_x_compress_count_(k))));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      a_ = simde__m256_to_private(a),
+      r_ = simde__m256_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f32[0])));
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       a_ = simde__m256_to_private(a),
@@ -134,6 +355,15 @@ simde_mm256_mask_compressstoreu_ps (void* base_addr, simde__mmask8 k, simde__m25
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm256_mask_storeu_ps(base_addr, store_mask, _mm256_maskz_compress_ps(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi32_(_mm256_castps_si256(a), k);
+    _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, base_addr), simde_x_mm256_first_n_epi32_(simde_x_compress_count_(k)), r);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      a_ = simde__m256_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f32[0])));
   #else
     simde__m256_private
       a_ = simde__m256_to_private(a);
@@ -161,6 +391,19 @@ simde__m256
 simde_mm256_maskz_compress_ps (simde__mmask8 k, simde__m256 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_maskz_compress_ps(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi32_(_mm256_castps_si256(a), k);
+    return _mm256_castsi256_ps(_mm256_and_si256(r, simde_x_mm256_first_n_epi32_(simde_x_compress_count_(k))));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      a_ = simde__m256_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f32[0])));
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       a_ = simde__m256_to_private(a);
@@ -190,6 +433,18 @@ simde__m256i
 simde_mm256_mask_compress_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_mask_compress_epi32(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi32_(a, k);
+    return _mm256_blendv_epi8(src, r, simde_x_mm256_first_n_epi32_(simde_x_compress_count_(k)));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_ = simde__m256i_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i32[0])));
+
+    return simde__m256i_from_private(r_);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
@@ -223,6 +478,15 @@ simde_mm256_mask_compressstoreu_epi32 (void* base_addr, simde__mmask8 k, simde__
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm256_mask_storeu_epi32(base_addr, store_mask, _mm256_maskz_compress_epi32(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi32_(a, k);
+    _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, base_addr), simde_x_mm256_first_n_epi32_(simde_x_compress_count_(k)), r);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i32[0])));
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a);
@@ -250,6 +514,19 @@ simde__m256i
 simde_mm256_maskz_compress_epi32 (simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_maskz_compress_epi32(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi32_(a, k);
+    return _mm256_and_si256(r, simde_x_mm256_first_n_epi32_(simde_x_compress_count_(k)));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i32[0])));
+
+    return simde__m256i_from_private(r_);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a);
@@ -279,6 +556,18 @@ simde__m256i
 simde_mm256_mask_compress_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_mask_compress_epi64(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi64_(a, k);
+    return _mm256_blendv_epi8(src, r, simde_x_mm256_first_n_epi64_(simde_x_compress_count_(k & 0xf)));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_ = simde__m256i_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i64[0])));
+
+    return simde__m256i_from_private(r_);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
@@ -312,6 +601,15 @@ simde_mm256_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm256_mask_storeu_epi64(base_addr, store_mask, _mm256_maskz_compress_epi64(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi64_(a, k);
+    _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long*, base_addr), simde_x_mm256_first_n_epi64_(simde_x_compress_count_(k & 0xf)), r);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i64[0])));
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a);
@@ -339,6 +637,19 @@ simde__m256i
 simde_mm256_maskz_compress_epi64 (simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_maskz_compress_epi64(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i r = simde_x_mm256_compress_epi64_(a, k);
+    return _mm256_and_si256(r, simde_x_mm256_first_n_epi64_(simde_x_compress_count_(k & 0xf)));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i64[0])));
+
+    return simde__m256i_from_private(r_);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a);
@@ -368,6 +679,28 @@ simde__m512d
 simde_mm512_mask_compress_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_compress_pd(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a),
+      src_ = simde__m512d_to_private(src);
+    __m256i
+      lo = _mm256_castpd_si256(a_.m256d[0]),
+      hi = _mm256_castpd_si256(a_.m256d[1]);
+    const int n = simde_x_mm256x2_compress_epi64_(&lo, &hi, k);
+
+    src_.m256d[0] = _mm256_castsi256_pd(_mm256_blendv_epi8(_mm256_castpd_si256(src_.m256d[0]), lo, simde_x_mm256_first_n_epi64_(n)));
+    src_.m256d[1] = _mm256_castsi256_pd(_mm256_blendv_epi8(_mm256_castpd_si256(src_.m256d[1]), hi, simde_x_mm256_first_n_epi64_(n - 4)));
+
+    return simde__m512d_from_private(src_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a),
+      r_ = simde__m512d_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f64[0])));
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       a_ = simde__m512d_to_private(a),
@@ -401,6 +734,22 @@ simde_mm512_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m51
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_pd(base_addr, store_mask, _mm512_maskz_compress_pd(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a);
+    __m256i
+      lo = _mm256_castpd_si256(a_.m256d[0]),
+      hi = _mm256_castpd_si256(a_.m256d[1]);
+    const int n = simde_x_mm256x2_compress_epi64_(&lo, &hi, k);
+
+    _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long*, base_addr), simde_x_mm256_first_n_epi64_(n), lo);
+    _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long*, base_addr) + 4, simde_x_mm256_first_n_epi64_(n - 4), hi);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f64[0])));
   #else
     simde__m512d_private
       a_ = simde__m512d_to_private(a);
@@ -428,6 +777,28 @@ simde__m512d
 simde_mm512_maskz_compress_pd (simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_maskz_compress_pd(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a);
+    __m256i
+      lo = _mm256_castpd_si256(a_.m256d[0]),
+      hi = _mm256_castpd_si256(a_.m256d[1]);
+    const int n = simde_x_mm256x2_compress_epi64_(&lo, &hi, k);
+
+    a_.m256d[0] = _mm256_castsi256_pd(_mm256_and_si256(lo, simde_x_mm256_first_n_epi64_(n)));
+    a_.m256d[1] = _mm256_castsi256_pd(_mm256_and_si256(hi, simde_x_mm256_first_n_epi64_(n - 4)));
+
+    return simde__m512d_from_private(a_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      a_ = simde__m512d_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f64[0])));
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       a_ = simde__m512d_to_private(a);
@@ -457,6 +828,28 @@ simde__m512
 simde_mm512_mask_compress_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_compress_ps(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512_private
+      a_ = simde__m512_to_private(a),
+      src_ = simde__m512_to_private(src);
+    __m256i
+      lo = _mm256_castps_si256(a_.m256[0]),
+      hi = _mm256_castps_si256(a_.m256[1]);
+    const int n = simde_x_mm256x2_compress_epi32_(&lo, &hi, k);
+
+    src_.m256[0] = _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(src_.m256[0]), lo, simde_x_mm256_first_n_epi32_(n)));
+    src_.m256[1] = _mm256_castsi256_ps(_mm256_blendv_epi8(_mm256_castps_si256(src_.m256[1]), hi, simde_x_mm256_first_n_epi32_(n - 8)));
+
+    return simde__m512_from_private(src_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      a_ = simde__m512_to_private(a),
+      r_ = simde__m512_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f32[0])));
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       a_ = simde__m512_to_private(a),
@@ -490,6 +883,22 @@ simde_mm512_mask_compressstoreu_ps (void* base_addr, simde__mmask16 k, simde__m5
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask16 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_ps(base_addr, store_mask, _mm512_maskz_compress_ps(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512_private
+      a_ = simde__m512_to_private(a);
+    __m256i
+      lo = _mm256_castps_si256(a_.m256[0]),
+      hi = _mm256_castps_si256(a_.m256[1]);
+    const int n = simde_x_mm256x2_compress_epi32_(&lo, &hi, k);
+
+    _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, base_addr), simde_x_mm256_first_n_epi32_(n), lo);
+    _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, base_addr) + 8, simde_x_mm256_first_n_epi32_(n - 8), hi);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      a_ = simde__m512_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f32[0])));
   #else
     simde__m512_private
       a_ = simde__m512_to_private(a);
@@ -517,6 +926,28 @@ simde__m512
 simde_mm512_maskz_compress_ps (simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_maskz_compress_ps(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512_private
+      a_ = simde__m512_to_private(a);
+    __m256i
+      lo = _mm256_castps_si256(a_.m256[0]),
+      hi = _mm256_castps_si256(a_.m256[1]);
+    const int n = simde_x_mm256x2_compress_epi32_(&lo, &hi, k);
+
+    a_.m256[0] = _mm256_castsi256_ps(_mm256_and_si256(lo, simde_x_mm256_first_n_epi32_(n)));
+    a_.m256[1] = _mm256_castsi256_ps(_mm256_and_si256(hi, simde_x_mm256_first_n_epi32_(n - 8)));
+
+    return simde__m512_from_private(a_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      a_ = simde__m512_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.f32[0])));
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       a_ = simde__m512_to_private(a);
@@ -546,6 +977,28 @@ simde__m512i
 simde_mm512_mask_compress_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_compress_epi32(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      src_ = simde__m512i_to_private(src);
+    __m256i
+      lo = a_.m256i[0],
+      hi = a_.m256i[1];
+    const int n = simde_x_mm256x2_compress_epi32_(&lo, &hi, k);
+
+    src_.m256i[0] = _mm256_blendv_epi8(src_.m256i[0], lo, simde_x_mm256_first_n_epi32_(n));
+    src_.m256i[1] = _mm256_blendv_epi8(src_.m256i[1], hi, simde_x_mm256_first_n_epi32_(n - 8));
+
+    return simde__m512i_from_private(src_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_ = simde__m512i_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i32[0])));
+
+    return simde__m512i_from_private(r_);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
@@ -579,6 +1032,24 @@ simde_mm512_mask_compressstoreu_epi16 (void* base_addr, simde__mmask32 k, simde_
   #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(__znver4__)
     simde__mmask32 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_epi16(base_addr, store_mask, _mm512_maskz_compress_epi16(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    int16_t buf[sizeof(a_.i16) / sizeof(a_.i16[0]) + 8];
+    size_t ri = 0;
+
+    for (size_t i = 0 ; i < (sizeof(a_.m128i) / sizeof(a_.m128i[0])) ; i++) {
+      _mm_storeu_si128(HEDLEY_REINTERPRET_CAST(__m128i*, &(buf[ri])), simde_x_mm_compress_epi16_(a_.m128i[i], (k >> (8 * i)) & 0xff));
+      ri += HEDLEY_STATIC_CAST(size_t, simde_x_compress_count_((k >> (8 * i)) & 0xff));
+    }
+
+    simde_memcpy(base_addr, buf, ri * sizeof(buf[0]));
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i16[0])));
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a);
@@ -609,6 +1080,22 @@ simde_mm512_mask_compressstoreu_epi32 (void* base_addr, simde__mmask16 k, simde_
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask16 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_epi32(base_addr, store_mask, _mm512_maskz_compress_epi32(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    __m256i
+      lo = a_.m256i[0],
+      hi = a_.m256i[1];
+    const int n = simde_x_mm256x2_compress_epi32_(&lo, &hi, k);
+
+    _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, base_addr), simde_x_mm256_first_n_epi32_(n), lo);
+    _mm256_maskstore_epi32(HEDLEY_REINTERPRET_CAST(int*, base_addr) + 8, simde_x_mm256_first_n_epi32_(n - 8), hi);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i32[0])));
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a);
@@ -636,6 +1123,28 @@ simde__m512i
 simde_mm512_maskz_compress_epi32 (simde__mmask16 k, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_maskz_compress_epi32(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    __m256i
+      lo = a_.m256i[0],
+      hi = a_.m256i[1];
+    const int n = simde_x_mm256x2_compress_epi32_(&lo, &hi, k);
+
+    a_.m256i[0] = _mm256_and_si256(lo, simde_x_mm256_first_n_epi32_(n));
+    a_.m256i[1] = _mm256_and_si256(hi, simde_x_mm256_first_n_epi32_(n - 8));
+
+    return simde__m512i_from_private(a_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i32[0])));
+
+    return simde__m512i_from_private(r_);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a);
@@ -665,6 +1174,28 @@ simde__m512i
 simde_mm512_mask_compress_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_compress_epi64(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      src_ = simde__m512i_to_private(src);
+    __m256i
+      lo = a_.m256i[0],
+      hi = a_.m256i[1];
+    const int n = simde_x_mm256x2_compress_epi64_(&lo, &hi, k);
+
+    src_.m256i[0] = _mm256_blendv_epi8(src_.m256i[0], lo, simde_x_mm256_first_n_epi64_(n));
+    src_.m256i[1] = _mm256_blendv_epi8(src_.m256i[1], hi, simde_x_mm256_first_n_epi64_(n - 4));
+
+    return simde__m512i_from_private(src_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_ = simde__m512i_to_private(src);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i64[0])));
+
+    return simde__m512i_from_private(r_);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
@@ -698,6 +1229,22 @@ simde_mm512_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_epi64(base_addr, store_mask, _mm512_maskz_compress_epi64(k, a));
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    __m256i
+      lo = a_.m256i[0],
+      hi = a_.m256i[1];
+    const int n = simde_x_mm256x2_compress_epi64_(&lo, &hi, k);
+
+    _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long*, base_addr), simde_x_mm256_first_n_epi64_(n), lo);
+    _mm256_maskstore_epi64(HEDLEY_REINTERPRET_CAST(long long*, base_addr) + 4, simde_x_mm256_first_n_epi64_(n - 4), hi);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memcpy(base_addr, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i64[0])));
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a);
@@ -725,6 +1272,28 @@ simde__m512i
 simde_mm512_maskz_compress_epi64 (simde__mmask8 k, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_maskz_compress_epi64(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a);
+    __m256i
+      lo = a_.m256i[0],
+      hi = a_.m256i[1];
+    const int n = simde_x_mm256x2_compress_epi64_(&lo, &hi, k);
+
+    a_.m256i[0] = _mm256_and_si256(lo, simde_x_mm256_first_n_epi64_(n));
+    a_.m256i[1] = _mm256_and_si256(hi, simde_x_mm256_first_n_epi64_(n - 4));
+
+    return simde__m512i_from_private(a_);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+    uint8_t buf[sizeof(a_) + 16];
+
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&r_, buf, simde_x_neon_compress_(buf, &a_, sizeof(a_), k, sizeof(a_.i64[0])));
+
+    return simde__m512i_from_private(r_);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a);
@@ -20,44 +20,24 @@ simde_mm_dpbf16_ps (simde__m128 src, simde__m128bh a, simde__m128bh b) {
       a_ = simde__m128bh_to_private(a),
       b_ = simde__m128bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
-      uint32_t x1 SIMDE_VECTOR(32);
-      uint32_t x2 SIMDE_VECTOR(32);
-      simde__m128_private
-        r1_[2],
-        r2_[2];
-
-      a_.u16 =
-        SIMDE_SHUFFLE_VECTOR_(
-          16, 16,
-          a_.u16, a_.u16,
-          0, 2, 4, 6,
-          1, 3, 5, 7
-        );
-      b_.u16 =
-        SIMDE_SHUFFLE_VECTOR_(
-          16, 16,
-          b_.u16, b_.u16,
-          0, 2, 4, 6,
-          1, 3, 5, 7
-        );
-
-      SIMDE_CONVERT_VECTOR_(x1, a_.u16);
-      SIMDE_CONVERT_VECTOR_(x2, b_.u16);
-
-      x1 <<= 16;
-      x2 <<= 16;
-
-      simde_memcpy(&r1_, &x1, sizeof(x1));
-      simde_memcpy(&r2_, &x2, sizeof(x2));
-
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && (SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE)
+      /* Each 32-bit lane holds a pair of bf16 values; masking off the
+       * low half or shifting it up widens them to binary32 in place, so
+       * this is just integer ops plus two multiply-adds.  Products of
+       * bf16 values are exact in binary32, which means contracting to
+       * FMA doesn't change the result.  The odd element is accumulated
+       * first, as VDPBF16PS does. */
       src_.f32 +=
-        HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r1_[0].u32) * HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r2_[0].u32) +
-        HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r1_[1].u32) * HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r2_[1].u32);
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 & UINT32_C(0xffff0000)) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 & UINT32_C(0xffff0000));
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 << 16);
     #else
       SIMDE_VECTORIZE
-      for (size_t i = 0 ; i < (sizeof(a_.u16) / sizeof(a_.u16[0])) ; i++) {
-        src_.f32[i / 2] += (simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[i]) << 16));
+      for (size_t i = 0 ; i < (sizeof(src_.f32) / sizeof(src_.f32[0])) ; i++) {
+        src_.f32[i] += simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[2 * i + 1]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[2 * i + 1]) << 16);
+        src_.f32[i] += simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[2 * i    ]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[2 * i    ]) << 16);
       }
     #endif
 
@@ -109,44 +89,18 @@ simde_mm256_dpbf16_ps (simde__m256 src, simde__m256bh a, simde__m256bh b) {
       a_ = simde__m256bh_to_private(a),
       b_ = simde__m256bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
-      uint32_t x1 SIMDE_VECTOR(64);
-      uint32_t x2 SIMDE_VECTOR(64);
-      simde__m256_private
-        r1_[2],
-        r2_[2];
-
-      a_.u16 =
-        SIMDE_SHUFFLE_VECTOR_(
-          16, 32,
-          a_.u16, a_.u16,
-           0,  2,  4,  6,  8, 10, 12, 14,
-           1,  3,  5,  7,  9, 11, 13, 15
-        );
-      b_.u16 =
-        SIMDE_SHUFFLE_VECTOR_(
-          16, 32,
-          b_.u16, b_.u16,
-           0,  2,  4,  6,  8, 10, 12, 14,
-           1,  3,  5,  7,  9, 11, 13, 15
-        );
-
-      SIMDE_CONVERT_VECTOR_(x1, a_.u16);
-      SIMDE_CONVERT_VECTOR_(x2, b_.u16);
-
-      x1 <<= 16;
-      x2 <<= 16;
-
-      simde_memcpy(&r1_, &x1, sizeof(x1));
-      simde_memcpy(&r2_, &x2, sizeof(x2));
-
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && (SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE)
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 & UINT32_C(0xffff0000)) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 & UINT32_C(0xffff0000));
       src_.f32 +=
-        HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r1_[0].u32) * HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r2_[0].u32) +
-        HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r1_[1].u32) * HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r2_[1].u32);
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 << 16);
     #else
       SIMDE_VECTORIZE
-      for (size_t i = 0 ; i < (sizeof(a_.u16) / sizeof(a_.u16[0])) ; i++) {
-        src_.f32[i / 2] += (simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[i]) << 16));
+      for (size_t i = 0 ; i < (sizeof(src_.f32) / sizeof(src_.f32[0])) ; i++) {
+        src_.f32[i] += simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[2 * i + 1]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[2 * i + 1]) << 16);
+        src_.f32[i] += simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[2 * i    ]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[2 * i    ]) << 16);
       }
     #endif
 
@@ -198,44 +152,18 @@ simde_mm512_dpbf16_ps (simde__m512 src, simde__m512bh a, simde__m512bh b) {
       a_ = simde__m512bh_to_private(a),
       b_ = simde__m512bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
-      uint32_t x1 SIMDE_VECTOR(128);
-      uint32_t x2 SIMDE_VECTOR(128);
-      simde__m512_private
-        r1_[2],
-        r2_[2];
-
-      a_.u16 =
-        SIMDE_SHUFFLE_VECTOR_(
-          16, 64,
-          a_.u16, a_.u16,
-           0,  2,  4,  6,  8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
-           1,  3,  5,  7,  9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31
-        );
-      b_.u16 =
-        SIMDE_SHUFFLE_VECTOR_(
-          16, 64,
-          b_.u16, b_.u16,
-           0,  2,  4,  6,  8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
-           1,  3,  5,  7,  9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31
-        );
-
-      SIMDE_CONVERT_VECTOR_(x1, a_.u16);
-      SIMDE_CONVERT_VECTOR_(x2, b_.u16);
-
-      x1 <<= 16;
-      x2 <<= 16;
-
-      simde_memcpy(&r1_, &x1, sizeof(x1));
-      simde_memcpy(&r2_, &x2, sizeof(x2));
-
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && (SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE)
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 & UINT32_C(0xffff0000)) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 & UINT32_C(0xffff0000));
       src_.f32 +=
-        HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r1_[0].u32) * HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r2_[0].u32) +
-        HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r1_[1].u32) * HEDLEY_REINTERPRET_CAST(__typeof__(a_.f32), r2_[1].u32);
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 << 16);
     #else
       SIMDE_VECTORIZE
-      for (size_t i = 0 ; i < (sizeof(a_.u16) / sizeof(a_.u16[0])) ; i++) {
-        src_.f32[i / 2] += (simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[i]) << 16));
+      for (size_t i = 0 ; i < (sizeof(src_.f32) / sizeof(src_.f32[0])) ; i++) {
+        src_.f32[i] += simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[2 * i + 1]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[2 * i + 1]) << 16);
+        src_.f32[i] += simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, a_.u16[2 * i    ]) << 16) * simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, b_.u16[2 * i    ]) << 16);
       }
     #endif
 
@@ -13,6 +13,8 @@ simde__m128i
 simde_mm_dpbusd_epi32(simde__m128i src, simde__m128i a, simde__m128i b) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512VNNI_NATIVE)
     return _mm_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm_dpbusd_avx_epi32(src, a, b);
   #else
     simde__m128i_private
       src_ = simde__m128i_to_private(src),
@@ -103,6 +105,8 @@ simde__m256i
 simde_mm256_dpbusd_epi32(simde__m256i src, simde__m256i a, simde__m256i b) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512VNNI_NATIVE)
     return _mm256_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm256_dpbusd_avx_epi32(src, a, b);
   #else
     simde__m256i_private
       src_ = simde__m256i_to_private(src),
@@ -36,11 +36,89 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_AVX2_NATIVE) || defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+/* Expanding eight lanes is the inverse of compressing them: bits
+ * 3j..3j+2 of entry k hold the number of set bits of k below bit j,
+ * which is the source lane for destination lane j when bit j is set. */
+static const uint32_t simde_x_expand_table[256] = {
+  UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000000), UINT32_C(0x00000008), UINT32_C(0x00000000), UINT32_C(0x00000040), UINT32_C(0x00000040), UINT32_C(0x00000088),
+  UINT32_C(0x00000000), UINT32_C(0x00000200), UINT32_C(0x00000200), UINT32_C(0x00000408), UINT32_C(0x00000200), UINT32_C(0x00000440), UINT32_C(0x00000440), UINT32_C(0x00000688),
+  UINT32_C(0x00000000), UINT32_C(0x00001000), UINT32_C(0x00001000), UINT32_C(0x00002008), UINT32_C(0x00001000), UINT32_C(0x00002040), UINT32_C(0x00002040), UINT32_C(0x00003088),
+  UINT32_C(0x00001000), UINT32_C(0x00002200), UINT32_C(0x00002200), UINT32_C(0x00003408), UINT32_C(0x00002200), UINT32_C(0x00003440), UINT32_C(0x00003440), UINT32_C(0x00004688),
+  UINT32_C(0x00000000), UINT32_C(0x00008000), UINT32_C(0x00008000), UINT32_C(0x00010008), UINT32_C(0x00008000), UINT32_C(0x00010040), UINT32_C(0x00010040), UINT32_C(0x00018088),
+  UINT32_C(0x00008000), UINT32_C(0x00010200), UINT32_C(0x00010200), UINT32_C(0x00018408), UINT32_C(0x00010200), UINT32_C(0x00018440), UINT32_C(0x00018440), UINT32_C(0x00020688),
+  UINT32_C(0x00008000), UINT32_C(0x00011000), UINT32_C(0x00011000), UINT32_C(0x0001a008), UINT32_C(0x00011000), UINT32_C(0x0001a040), UINT32_C(0x0001a040), UINT32_C(0x00023088),
+  UINT32_C(0x00011000), UINT32_C(0x0001a200), UINT32_C(0x0001a200), UINT32_C(0x00023408), UINT32_C(0x0001a200), UINT32_C(0x00023440), UINT32_C(0x00023440), UINT32_C(0x0002c688),
+  UINT32_C(0x00000000), UINT32_C(0x00040000), UINT32_C(0x00040000), UINT32_C(0x00080008), UINT32_C(0x00040000), UINT32_C(0x00080040), UINT32_C(0x00080040), UINT32_C(0x000c0088),
+  UINT32_C(0x00040000), UINT32_C(0x00080200), UINT32_C(0x00080200), UINT32_C(0x000c0408), UINT32_C(0x00080200), UINT32_C(0x000c0440), UINT32_C(0x000c0440), UINT32_C(0x00100688),
+  UINT32_C(0x00040000), UINT32_C(0x00081000), UINT32_C(0x00081000), UINT32_C(0x000c2008), UINT32_C(0x00081000), UINT32_C(0x000c2040), UINT32_C(0x000c2040), UINT32_C(0x00103088),
+  UINT32_C(0x00081000), UINT32_C(0x000c2200), UINT32_C(0x000c2200), UINT32_C(0x00103408), UINT32_C(0x000c2200), UINT32_C(0x00103440), UINT32_C(0x00103440), UINT32_C(0x00144688),
+  UINT32_C(0x00040000), UINT32_C(0x00088000), UINT32_C(0x00088000), UINT32_C(0x000d0008), UINT32_C(0x00088000), UINT32_C(0x000d0040), UINT32_C(0x000d0040), UINT32_C(0x00118088),
+  UINT32_C(0x00088000), UINT32_C(0x000d0200), UINT32_C(0x000d0200), UINT32_C(0x00118408), UINT32_C(0x000d0200), UINT32_C(0x00118440), UINT32_C(0x00118440), UINT32_C(0x00160688),
+  UINT32_C(0x00088000), UINT32_C(0x000d1000), UINT32_C(0x000d1000), UINT32_C(0x0011a008), UINT32_C(0x000d1000), UINT32_C(0x0011a040), UINT32_C(0x0011a040), UINT32_C(0x00163088),
+  UINT32_C(0x000d1000), UINT32_C(0x0011a200), UINT32_C(0x0011a200), UINT32_C(0x00163408), UINT32_C(0x0011a200), UINT32_C(0x00163440), UINT32_C(0x00163440), UINT32_C(0x001ac688),
+  UINT32_C(0x00000000), UINT32_C(0x00200000), UINT32_C(0x00200000), UINT32_C(0x00400008), UINT32_C(0x00200000), UINT32_C(0x00400040), UINT32_C(0x00400040), UINT32_C(0x00600088),
+  UINT32_C(0x00200000), UINT32_C(0x00400200), UINT32_C(0x00400200), UINT32_C(0x00600408), UINT32_C(0x00400200), UINT32_C(0x00600440), UINT32_C(0x00600440), UINT32_C(0x00800688),
+  UINT32_C(0x00200000), UINT32_C(0x00401000), UINT32_C(0x00401000), UINT32_C(0x00602008), UINT32_C(0x00401000), UINT32_C(0x00602040), UINT32_C(0x00602040), UINT32_C(0x00803088),
+  UINT32_C(0x00401000), UINT32_C(0x00602200), UINT32_C(0x00602200), UINT32_C(0x00803408), UINT32_C(0x00602200), UINT32_C(0x00803440), UINT32_C(0x00803440), UINT32_C(0x00a04688),
+  UINT32_C(0x00200000), UINT32_C(0x00408000), UINT32_C(0x00408000), UINT32_C(0x00610008), UINT32_C(0x00408000), UINT32_C(0x00610040), UINT32_C(0x00610040), UINT32_C(0x00818088),
+  UINT32_C(0x00408000), UINT32_C(0x00610200), UINT32_C(0x00610200), UINT32_C(0x00818408), UINT32_C(0x00610200), UINT32_C(0x00818440), UINT32_C(0x00818440), UINT32_C(0x00a20688),
+  UINT32_C(0x00408000), UINT32_C(0x00611000), UINT32_C(0x00611000), UINT32_C(0x0081a008), UINT32_C(0x00611000), UINT32_C(0x0081a040), UINT32_C(0x0081a040), UINT32_C(0x00a23088),
+  UINT32_C(0x00611000), UINT32_C(0x0081a200), UINT32_C(0x0081a200), UINT32_C(0x00a23408), UINT32_C(0x0081a200), UINT32_C(0x00a23440), UINT32_C(0x00a23440), UINT32_C(0x00c2c688),
+  UINT32_C(0x00200000), UINT32_C(0x00440000), UINT32_C(0x00440000), UINT32_C(0x00680008), UINT32_C(0x00440000), UINT32_C(0x00680040), UINT32_C(0x00680040), UINT32_C(0x008c0088),
+  UINT32_C(0x00440000), UINT32_C(0x00680200), UINT32_C(0x00680200), UINT32_C(0x008c0408), UINT32_C(0x00680200), UINT32_C(0x008c0440), UINT32_C(0x008c0440), UINT32_C(0x00b00688),
+  UINT32_C(0x00440000), UINT32_C(0x00681000), UINT32_C(0x00681000), UINT32_C(0x008c2008), UINT32_C(0x00681000), UINT32_C(0x008c2040), UINT32_C(0x008c2040), UINT32_C(0x00b03088),
+  UINT32_C(0x00681000), UINT32_C(0x008c2200), UINT32_C(0x008c2200), UINT32_C(0x00b03408), UINT32_C(0x008c2200), UINT32_C(0x00b03440), UINT32_C(0x00b03440), UINT32_C(0x00d44688),
+  UINT32_C(0x00440000), UINT32_C(0x00688000), UINT32_C(0x00688000), UINT32_C(0x008d0008), UINT32_C(0x00688000), UINT32_C(0x008d0040), UINT32_C(0x008d0040), UINT32_C(0x00b18088),
+  UINT32_C(0x00688000), UINT32_C(0x008d0200), UINT32_C(0x008d0200), UINT32_C(0x00b18408), UINT32_C(0x008d0200), UINT32_C(0x00b18440), UINT32_C(0x00b18440), UINT32_C(0x00d60688),
+  UINT32_C(0x00688000), UINT32_C(0x008d1000), UINT32_C(0x008d1000), UINT32_C(0x00b1a008), UINT32_C(0x008d1000), UINT32_C(0x00b1a040), UINT32_C(0x00b1a040), UINT32_C(0x00d63088),
+  UINT32_C(0x008d1000), UINT32_C(0x00b1a200), UINT32_C(0x00b1a200), UINT32_C(0x00d63408), UINT32_C(0x00b1a200), UINT32_C(0x00d63440), UINT32_C(0x00d63440), UINT32_C(0x00fac688)
+};
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_expand_epi32_(simde__m256i src, simde__mmask8 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i idx =
+      _mm256_srlv_epi32(
+        _mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, simde_x_expand_table[k])),
+        _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21));
+    const __m256i sel = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(k), bits), bits);
+
+    return _mm256_blendv_epi8(src, _mm256_permutevar8x32_epi32(a, idx), sel);
+  #else
+    static const int32_t shifts[8] = { 0, -3, -6, -9, -12, -15, -18, -21 };
+    static const uint32_t bits[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_ = simde__m256i_to_private(src);
+    const uint8_t* a8 = HEDLEY_REINTERPRET_CAST(const uint8_t*, &a_);
+    uint8_t* r8 = HEDLEY_REINTERPRET_CAST(uint8_t*, &r_);
+    uint8x16x2_t t;
+
+    t.val[0] = vld1q_u8(a8);
+    t.val[1] = vld1q_u8(a8 + 16);
+
+    for (size_t i = 0 ; i < 2 ; i++) {
+      const uint32x4_t f = vandq_u32(vshlq_u32(vdupq_n_u32(simde_x_expand_table[k]), vld1q_s32(&(shifts[4 * i]))), vdupq_n_u32(7));
+      const uint8x16_t idx = vreinterpretq_u8_u32(vmlaq_n_u32(vdupq_n_u32(UINT32_C(0x03020100)), f, UINT32_C(0x04040404)));
+      const uint32x4_t sel = vtstq_u32(vdupq_n_u32(k), vld1q_u32(&(bits[4 * i])));
+      vst1q_u8(r8 + (16 * i), vbslq_u8(vreinterpretq_u8_u32(sel), vqtbl2q_u8(t, idx), vld1q_u8(r8 + (16 * i))));
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256i
 simde_mm256_mask_expand_epi32(simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_mask_expand_epi32(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE) || defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return simde_x_mm256_expand_epi32_(src, k, a);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
@@ -69,6 +147,8 @@ simde__m256i
 simde_mm256_maskz_expand_epi32(simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE)
     return _mm256_maskz_expand_epi32(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE) || defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return simde_x_mm256_expand_epi32_(simde_mm256_setzero_si256(), k, a);
   #else
     simde__m256i_private
       a_ = simde__m256i_to_private(a),
@@ -19,10 +19,47 @@ simde_mm_multishift_epi64_epi8 (simde__m128i a, simde__m128i b) {
       a_ = simde__m128i_to_private(a),
       b_ = simde__m128i_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < sizeof(r_.u8) / sizeof(r_.u8[0]) ; i++) {
-      r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.u64[i / 8] >> (a_.u8[i] & 63)) | (b_.u64[i / 8] << (64 - (a_.u8[i] & 63))));
-    }
+    /* Byte i of the result is bits s..s+7 of the 16-bit value formed by
+     * bytes k and (k + 1) % 8 of the source lane, where k = a[i] >> 3 and
+     * s = a[i] & 7.  Both bytes are gathered with a table lookup and then
+     * funnel-shifted together, so the whole vector is done at once. */
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      const __m128i m7 = _mm_set1_epi8(7);
+      const __m128i mlo = _mm_set1_epi16(0x00FF);
+      const __m128i mhi = _mm_set1_epi16(HEDLEY_STATIC_CAST(short, 0xFF00));
+      const __m128i base = _mm_set_epi64x(INT64_C(0x0808080808080808), 0);
+      const __m128i k = _mm_and_si128(_mm_srli_epi16(a_.n, 3), m7);
+      const __m128i lo = _mm_shuffle_epi8(b_.n, _mm_or_si128(k, base));
+      const __m128i hi = _mm_shuffle_epi8(b_.n, _mm_or_si128(_mm_and_si128(_mm_add_epi8(k, _mm_set1_epi8(1)), m7), base));
+      /* 1 << (7 - s); the 16-bit products then hold the result in bits 7..14. */
+      const __m128i m = _mm_shuffle_epi8(_mm_set_epi64x(0, INT64_C(0x0102040810204080)), _mm_and_si128(a_.n, m7));
+      __m128i even = _mm_or_si128(_mm_and_si128(lo, mlo), _mm_slli_epi16(hi, 8));
+      __m128i odd = _mm_or_si128(_mm_srli_epi16(lo, 8), _mm_and_si128(hi, mhi));
+      even = _mm_and_si128(_mm_srli_epi16(_mm_mullo_epi16(even, _mm_and_si128(m, mlo)), 7), mlo);
+      odd = _mm_mullo_epi16(odd, _mm_srli_epi16(m, 8));
+      odd = _mm_and_si128(_mm_add_epi16(odd, odd), mhi);
+      r_.n = _mm_or_si128(even, odd);
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const uint8x16_t m7 = vdupq_n_u8(7);
+      const uint8x16_t k = vandq_u8(vshrq_n_u8(a_.neon_u8, 3), m7);
+      const uint8x16_t k1 = vandq_u8(vaddq_u8(k, vdupq_n_u8(1)), m7);
+      const int8x16_t s = vreinterpretq_s8_u8(vandq_u8(a_.neon_u8, m7));
+      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+        const uint8x16_t base = vcombine_u8(vdup_n_u8(0), vdup_n_u8(8));
+        const uint8x16_t lo = vqtbl1q_u8(b_.neon_u8, vorrq_u8(k, base));
+        const uint8x16_t hi = vqtbl1q_u8(b_.neon_u8, vorrq_u8(k1, base));
+      #else
+        const uint8x16_t lo = vcombine_u8(vtbl1_u8(vget_low_u8(b_.neon_u8), vget_low_u8(k)), vtbl1_u8(vget_high_u8(b_.neon_u8), vget_high_u8(k)));
+        const uint8x16_t hi = vcombine_u8(vtbl1_u8(vget_low_u8(b_.neon_u8), vget_low_u8(k1)), vtbl1_u8(vget_high_u8(b_.neon_u8), vget_high_u8(k1)));
+      #endif
+      /* vshl by 8 yields zero, which is what s == 0 needs for hi. */
+      r_.neon_u8 = vorrq_u8(vshlq_u8(lo, vnegq_s8(s)), vshlq_u8(hi, vsubq_s8(vdupq_n_s8(8), s)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < sizeof(r_.u8) / sizeof(r_.u8[0]) ; i++) {
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.u64[i / 8] >> (a_.u8[i] & 63)) | (b_.u64[i / 8] << (64 - (a_.u8[i] & 63))));
+      }
+    #endif
 
     return simde__m128i_from_private(r_);
   #endif
@@ -71,10 +108,32 @@ simde_mm256_multishift_epi64_epi8 (simde__m256i a, simde__m256i b) {
       a_ = simde__m256i_to_private(a),
       b_ = simde__m256i_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < sizeof(r_.u8) / sizeof(r_.u8[0]) ; i++) {
-      r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.u64[i / 8] >> (a_.u8[i] & 63)) | (b_.u64[i / 8] << (64 - (a_.u8[i] & 63))));
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      /* See simde_mm_multishift_epi64_epi8. */
+      const __m256i m7 = _mm256_set1_epi8(7);
+      const __m256i mlo = _mm256_set1_epi16(0x00FF);
+      const __m256i mhi = _mm256_set1_epi16(HEDLEY_STATIC_CAST(short, 0xFF00));
+      const __m256i base = _mm256_set_epi64x(INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0);
+      const __m256i k = _mm256_and_si256(_mm256_srli_epi16(a_.n, 3), m7);
+      const __m256i lo = _mm256_shuffle_epi8(b_.n, _mm256_or_si256(k, base));
+      const __m256i hi = _mm256_shuffle_epi8(b_.n, _mm256_or_si256(_mm256_and_si256(_mm256_add_epi8(k, _mm256_set1_epi8(1)), m7), base));
+      const __m256i m = _mm256_shuffle_epi8(_mm256_set1_epi64x(INT64_C(0x0102040810204080)), _mm256_and_si256(a_.n, m7));
+      __m256i even = _mm256_or_si256(_mm256_and_si256(lo, mlo), _mm256_slli_epi16(hi, 8));
+      __m256i odd = _mm256_or_si256(_mm256_srli_epi16(lo, 8), _mm256_and_si256(hi, mhi));
+      even = _mm256_and_si256(_mm256_srli_epi16(_mm256_mullo_epi16(even, _mm256_and_si256(m, mlo)), 7), mlo);
+      odd = _mm256_mullo_epi16(odd, _mm256_srli_epi16(m, 8));
+      odd = _mm256_and_si256(_mm256_add_epi16(odd, odd), mhi);
+      r_.n = _mm256_or_si256(even, odd);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_multishift_epi64_epi8(a_.m128i[i], b_.m128i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < sizeof(r_.u8) / sizeof(r_.u8[0]) ; i++) {
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.u64[i / 8] >> (a_.u8[i] & 63)) | (b_.u64[i / 8] << (64 - (a_.u8[i] & 63))));
+      }
+    #endif
 
     return simde__m256i_from_private(r_);
   #endif
@@ -123,10 +182,36 @@ simde_mm512_multishift_epi64_epi8 (simde__m512i a, simde__m512i b) {
       a_ = simde__m512i_to_private(a),
       b_ = simde__m512i_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < sizeof(r_.u8) / sizeof(r_.u8[0]) ; i++) {
-      r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.u64[i / 8] >> (a_.u8[i] & 63)) | (b_.u64[i / 8] << (64 - (a_.u8[i] & 63))));
-    }
+    #if defined(SIMDE_X86_AVX512BW_NATIVE)
+      /* See simde_mm_multishift_epi64_epi8. */
+      const __m512i m7 = _mm512_set1_epi8(7);
+      const __m512i mlo = _mm512_set1_epi16(0x00FF);
+      const __m512i mhi = _mm512_set1_epi16(HEDLEY_STATIC_CAST(short, 0xFF00));
+      const __m512i base = _mm512_set_epi64(INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0, INT64_C(0x0808080808080808), 0);
+      const __m512i k = _mm512_and_si512(_mm512_srli_epi16(a_.n, 3), m7);
+      const __m512i lo = _mm512_shuffle_epi8(b_.n, _mm512_or_si512(k, base));
+      const __m512i hi = _mm512_shuffle_epi8(b_.n, _mm512_or_si512(_mm512_and_si512(_mm512_add_epi8(k, _mm512_set1_epi8(1)), m7), base));
+      const __m512i m = _mm512_shuffle_epi8(_mm512_set1_epi64(INT64_C(0x0102040810204080)), _mm512_and_si512(a_.n, m7));
+      __m512i even = _mm512_or_si512(_mm512_and_si512(lo, mlo), _mm512_slli_epi16(hi, 8));
+      __m512i odd = _mm512_or_si512(_mm512_srli_epi16(lo, 8), _mm512_and_si512(hi, mhi));
+      even = _mm512_and_si512(_mm512_srli_epi16(_mm512_mullo_epi16(even, _mm512_and_si512(m, mlo)), 7), mlo);
+      odd = _mm512_mullo_epi16(odd, _mm512_srli_epi16(m, 8));
+      odd = _mm512_and_si512(_mm512_add_epi16(odd, odd), mhi);
+      r_.n = _mm512_or_si512(even, odd);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_multishift_epi64_epi8(a_.m256i[i], b_.m256i[i]);
+      }
+    #elif defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_multishift_epi64_epi8(a_.m128i[i], b_.m128i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < sizeof(r_.u8) / sizeof(r_.u8[0]) ; i++) {
+        r_.u8[i] = HEDLEY_STATIC_CAST(uint8_t, (b_.u64[i / 8] >> (a_.u8[i] & 63)) | (b_.u64[i / 8] << (64 - (a_.u8[i] & 63))));
+      }
+    #endif
 
     return simde__m512i_from_private(r_);
   #endif
@@ -50,7 +50,7 @@ SIMDE_BEGIN_DECLS_
  * Note that when the original vector contains few elements, these implementations
  * may not be faster than portable code.
  */
-#if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A64V8_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || defined(SIMDE_WASM_SIMD128_NATIVE)
+#if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || defined(SIMDE_WASM_SIMD128_NATIVE)
  #define SIMDE_X_PERMUTEX2VAR_USE_GENERIC
 #endif
 
@@ -116,12 +116,14 @@ simde_x_permutex2var128 (const simde__m128i *a, const simde__m128i idx, const si
 
       return _mm_or_si128(_mm_andnot_si128(test, ra), _mm_and_si128(test, rb));
     #endif
-  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     uint8x16_t index, r;
     uint16x8_t index16;
     uint32x4_t index32;
-    uint8x16x2_t table2_a, table2_b;
-    uint8x16x4_t table4_a, table4_b;
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      uint8x16x2_t table2_a, table2_b;
+      uint8x16x4_t table4_a, table4_b;
+    #endif
 
     switch (log2_index_size) {
     case 0:
@@ -141,31 +143,54 @@ simde_x_permutex2var128 (const simde__m128i *a, const simde__m128i idx, const si
       break;
     }
 
-    uint8x16_t mask = vdupq_n_u8(HEDLEY_STATIC_CAST(uint8_t, (1 << (4 + log2_data_length)) - 1));
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      uint8x16_t mask = vdupq_n_u8(HEDLEY_STATIC_CAST(uint8_t, (1 << (4 + log2_data_length)) - 1));
+
+      switch (log2_data_length) {
+      case 0:
+        r = vqtbx1q_u8(vqtbl1q_u8(simde__m128i_to_neon_u8(b[0]), vandq_u8(index, mask)), simde__m128i_to_neon_u8(a[0]), index);
+        break;
+      case 1:
+        table2_a.val[0] = simde__m128i_to_neon_u8(a[0]);
+        table2_a.val[1] = simde__m128i_to_neon_u8(a[1]);
+        table2_b.val[0] = simde__m128i_to_neon_u8(b[0]);
+        table2_b.val[1] = simde__m128i_to_neon_u8(b[1]);
+        r = vqtbx2q_u8(vqtbl2q_u8(table2_b, vandq_u8(index, mask)), table2_a, index);
+        break;
+      case 2:
+        table4_a.val[0] = simde__m128i_to_neon_u8(a[0]);
+        table4_a.val[1] = simde__m128i_to_neon_u8(a[1]);
+        table4_a.val[2] = simde__m128i_to_neon_u8(a[2]);
+        table4_a.val[3] = simde__m128i_to_neon_u8(a[3]);
+        table4_b.val[0] = simde__m128i_to_neon_u8(b[0]);
+        table4_b.val[1] = simde__m128i_to_neon_u8(b[1]);
+        table4_b.val[2] = simde__m128i_to_neon_u8(b[2]);
+        table4_b.val[3] = simde__m128i_to_neon_u8(b[3]);
+        r = vqtbx4q_u8(vqtbl4q_u8(table4_b, vandq_u8(index, mask)), table4_a, index);
+        break;
+      }
+    #else
+      /* The a and b vectors form one table of (32 << log2_data_length) bytes.
+       * Walk it 32 bytes at a time; vtbx leaves lanes whose index is outside
+       * the current piece untouched, and the subtraction wraps indices below it. */
+      const uint8x8_t thirty_two = vdup_n_u8(32);
+      const int n = 1 << log2_data_length;
+      uint8x8_t lo = vdup_n_u8(0), hi = vdup_n_u8(0);
+      uint8x8_t index_lo = vget_low_u8(index), index_hi = vget_high_u8(index);
 
-    switch (log2_data_length) {
-    case 0:
-      r = vqtbx1q_u8(vqtbl1q_u8(simde__m128i_to_neon_u8(b[0]), vandq_u8(index, mask)), simde__m128i_to_neon_u8(a[0]), index);
-      break;
-    case 1:
-      table2_a.val[0] = simde__m128i_to_neon_u8(a[0]);
-      table2_a.val[1] = simde__m128i_to_neon_u8(a[1]);
-      table2_b.val[0] = simde__m128i_to_neon_u8(b[0]);
-      table2_b.val[1] = simde__m128i_to_neon_u8(b[1]);
-      r = vqtbx2q_u8(vqtbl2q_u8(table2_b, vandq_u8(index, mask)), table2_a, index);
-      break;
-    case 2:
-      table4_a.val[0] = simde__m128i_to_neon_u8(a[0]);
-      table4_a.val[1] = simde__m128i_to_neon_u8(a[1]);
-      table4_a.val[2] = simde__m128i_to_neon_u8(a[2]);
-      table4_a.val[3] = simde__m128i_to_neon_u8(a[3]);
-      table4_b.val[0] = simde__m128i_to_neon_u8(b[0]);
-      table4_b.val[1] = simde__m128i_to_neon_u8(b[1]);
-      table4_b.val[2] = simde__m128i_to_neon_u8(b[2]);
-      table4_b.val[3] = simde__m128i_to_neon_u8(b[3]);
-      r = vqtbx4q_u8(vqtbl4q_u8(table4_b, vandq_u8(index, mask)), table4_a, index);
-      break;
-    }
+      SIMDE_VECTORIZE
+      for (int i = 0 ; i < 2 * n ; i += 2) {
+        const uint8x16_t t0 = simde__m128i_to_neon_u8((i < n) ? a[i] : b[i - n]);
+        const uint8x16_t t1 = simde__m128i_to_neon_u8((i + 1 < n) ? a[i + 1] : b[i + 1 - n]);
+        const uint8x8x4_t table = { { vget_low_u8(t0), vget_high_u8(t0), vget_low_u8(t1), vget_high_u8(t1) } };
+        lo = vtbx4_u8(lo, table, index_lo);
+        hi = vtbx4_u8(hi, table, index_hi);
+        index_lo = vsub_u8(index_lo, thirty_two);
+        index_hi = vsub_u8(index_hi, thirty_two);
+      }
+
+      r = vcombine_u8(lo, hi);
+    #endif
 
     return simde__m128i_from_neon_u8(r);
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
@@ -1407,7 +1432,7 @@ simde__m512i
 simde_mm512_permutex2var_epi8 (simde__m512i a, simde__m512i idx, simde__m512i b) {
   #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
     return _mm512_permutex2var_epi8(a, idx, b);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE)
     __m512i hilo, hi, lo, hi2, lo2, idx2;
     const __m512i ones = _mm512_set1_epi8(1);
     const __m512i low_bytes = _mm512_set1_epi16(0x00FF);
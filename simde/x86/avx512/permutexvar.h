@@ -144,6 +144,10 @@ simde_mm_permutexvar_epi8 (simde__m128i idx, simde__m128i a) {
       uint8x16_t mask = vdupq_n_u8(0x0F);
       uint8x16_t index = vandq_u8(idx_.neon_u8, mask);
       r_.neon_u8 = vqtbl1q_u8(a_.neon_u8, index);
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      uint8x8x2_t table = { { vget_low_u8(a_.neon_u8), vget_high_u8(a_.neon_u8) } };
+      uint8x16_t index = vandq_u8(idx_.neon_u8, vdupq_n_u8(0x0F));
+      r_.neon_u8 = vcombine_u8(vtbl2_u8(table, vget_low_u8(index)), vtbl2_u8(table, vget_high_u8(index)));
     #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
       r_.altivec_u8 = vec_perm(a_.altivec_u8, a_.altivec_u8, idx_.altivec_u8);
     #elif defined(SIMDE_WASM_SIMD128_NATIVE)
@@ -452,7 +456,23 @@ simde_mm256_permutexvar_epi8 (simde__m256i idx, simde__m256i a) {
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      /* pshufb zeroes lanes whose index has bit 7 set; the saturating add
+       * pushes every index outside the current 16-byte piece there. */
+      const __m128i mask = _mm_set1_epi8(0x1F);
+      const __m128i bias = _mm_set1_epi8(0x70);
+      const __m128i sixteen = _mm_set1_epi8(16);
+      __m128i index;
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        index = _mm_and_si128(idx_.m128i_private[i].n, mask);
+        r_.m128i_private[i].n =
+          _mm_or_si128(
+            _mm_shuffle_epi8(a_.m128i_private[0].n, _mm_adds_epu8(index, bias)),
+            _mm_shuffle_epi8(a_.m128i_private[1].n, _mm_adds_epu8(_mm_xor_si128(index, sixteen), bias)));
+      }
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
       uint8x16x2_t table = { { a_.m128i_private[0].neon_u8,
                                a_.m128i_private[1].neon_u8 } };
       uint8x16_t mask = vdupq_n_u8(0x1F);
@@ -461,6 +481,16 @@ simde_mm256_permutexvar_epi8 (simde__m256i idx, simde__m256i a) {
       for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
         r_.m128i_private[i].neon_u8 = vqtbl2q_u8(table, vandq_u8(idx_.m128i_private[i].neon_u8, mask));
       }
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      uint8x8x4_t table = { { vget_low_u8(a_.m128i_private[0].neon_u8), vget_high_u8(a_.m128i_private[0].neon_u8),
+                              vget_low_u8(a_.m128i_private[1].neon_u8), vget_high_u8(a_.m128i_private[1].neon_u8) } };
+      uint8x16_t mask = vdupq_n_u8(0x1F), index;
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        index = vandq_u8(idx_.m128i_private[i].neon_u8, mask);
+        r_.m128i_private[i].neon_u8 = vcombine_u8(vtbl4_u8(table, vget_low_u8(index)), vtbl4_u8(table, vget_high_u8(index)));
+      }
     #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
@@ -953,26 +983,20 @@ simde__m512i
 simde_mm512_permutexvar_epi8 (simde__m512i idx, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
     return _mm512_permutexvar_epi8(idx, a);
-  #elif defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
-    simde__m512i hilo, hi, lo, hi2, lo2, idx2;
-    simde__m512i ones = simde_mm512_set1_epi8(1);
-    simde__m512i low_bytes = simde_mm512_set1_epi16(0x00FF);
-
-    idx2 = simde_mm512_srli_epi16(idx, 1);
-    hilo = simde_mm512_permutexvar_epi16(idx2, a);
-    simde__mmask64 mask = simde_mm512_test_epi8_mask(idx, ones);
-    lo = simde_mm512_and_si512(hilo, low_bytes);
-    hi = simde_mm512_srli_epi16(hilo, 8);
-
-    idx2 = simde_mm512_srli_epi16(idx, 9);
-    hilo = simde_mm512_permutexvar_epi16(idx2, a);
-    lo2 = simde_mm512_slli_epi16(hilo, 8);
-    hi2 = simde_mm512_andnot_si512(low_bytes, hilo);
-
-    lo = simde_mm512_or_si512(lo, lo2);
-    hi = simde_mm512_or_si512(hi, hi2);
-
-    return simde_mm512_mask_blend_epi8(mask, lo, hi);
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE)
+    /* Look up all four 16-byte pieces of a with in-lane shuffles and pick
+     * the right one with masks taken from bits 4 and 5 of the index. */
+    const __m512i t0 = _mm512_broadcast_i32x4(_mm512_castsi512_si128(a));
+    const __m512i t1 = _mm512_broadcast_i32x4(_mm512_extracti32x4_epi32(a, 1));
+    const __m512i t2 = _mm512_broadcast_i32x4(_mm512_extracti32x4_epi32(a, 2));
+    const __m512i t3 = _mm512_broadcast_i32x4(_mm512_extracti32x4_epi32(a, 3));
+    const __m512i index = _mm512_and_si512(idx, _mm512_set1_epi8(0x3F));
+    const __mmask64 select0x10 = _mm512_movepi8_mask(_mm512_slli_epi16(index, 3));
+    const __mmask64 select0x20 = _mm512_movepi8_mask(_mm512_slli_epi16(index, 2));
+    const __m512i r01 = _mm512_mask_shuffle_epi8(_mm512_shuffle_epi8(t0, index), select0x10, t1, index);
+    const __m512i r23 = _mm512_mask_shuffle_epi8(_mm512_shuffle_epi8(t2, index), select0x10, t3, index);
+
+    return _mm512_mask_blend_epi8(select0x20, r01, r23);
   #else
     simde__m512i_private
       idx_ = simde__m512i_to_private(idx),
@@ -1012,6 +1036,41 @@ simde_mm512_permutexvar_epi8 (simde__m512i idx, simde__m512i a) {
       for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
         r_.m128i_private[i].neon_u8 = vqtbl4q_u8(table, vandq_u8(idx_.m128i_private[i].neon_u8, mask));
       }
+    #elif defined(SIMDE_X86_SSSE3_NATIVE)
+      /* See simde_mm256_permutexvar_epi8. */
+      const __m128i mask = _mm_set1_epi8(0x3F);
+      const __m128i bias = _mm_set1_epi8(0x70);
+      __m128i index, r;
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        index = _mm_and_si128(idx_.m128i_private[i].n, mask);
+        r = _mm_shuffle_epi8(a_.m128i_private[0].n, _mm_adds_epu8(index, bias));
+        r = _mm_or_si128(r, _mm_shuffle_epi8(a_.m128i_private[1].n, _mm_adds_epu8(_mm_xor_si128(index, _mm_set1_epi8(0x10)), bias)));
+        r = _mm_or_si128(r, _mm_shuffle_epi8(a_.m128i_private[2].n, _mm_adds_epu8(_mm_xor_si128(index, _mm_set1_epi8(0x20)), bias)));
+        r = _mm_or_si128(r, _mm_shuffle_epi8(a_.m128i_private[3].n, _mm_adds_epu8(_mm_xor_si128(index, _mm_set1_epi8(0x30)), bias)));
+        r_.m128i_private[i].n = r;
+      }
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      /* vtbx leaves lanes with out-of-range indices untouched. */
+      uint8x8x4_t table01 = { { vget_low_u8(a_.m128i_private[0].neon_u8), vget_high_u8(a_.m128i_private[0].neon_u8),
+                                vget_low_u8(a_.m128i_private[1].neon_u8), vget_high_u8(a_.m128i_private[1].neon_u8) } };
+      uint8x8x4_t table23 = { { vget_low_u8(a_.m128i_private[2].neon_u8), vget_high_u8(a_.m128i_private[2].neon_u8),
+                                vget_low_u8(a_.m128i_private[3].neon_u8), vget_high_u8(a_.m128i_private[3].neon_u8) } };
+      const uint8x16_t mask = vdupq_n_u8(0x3F);
+      const uint8x8_t thirty_two = vdup_n_u8(32);
+      uint8x16_t index;
+      uint8x8_t lo, hi;
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        index = vandq_u8(idx_.m128i_private[i].neon_u8, mask);
+        lo = vtbl4_u8(table01, vget_low_u8(index));
+        hi = vtbl4_u8(table01, vget_high_u8(index));
+        lo = vtbx4_u8(lo, table23, vsub_u8(vget_low_u8(index), thirty_two));
+        hi = vtbx4_u8(hi, table23, vsub_u8(vget_high_u8(index), thirty_two));
+        r_.m128i_private[i].neon_u8 = vcombine_u8(lo, hi);
+      }
     #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) test, r01, r23;
       test = vec_splats(HEDLEY_STATIC_CAST(unsigned char, 0x20));
@@ -0,0 +1,331 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_BMI_H)
+#define SIMDE_X86_BMI_H
+
+#include "../simde-common.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* BMI1 (andn, bextr, blsi, blsmsk, blsr, tzcnt) and LZCNT.  These are
+ * scalar, so the portable versions are plain C; the counts go through
+ * the compiler's ctz/clz builtins where available, which become
+ * rbit+clz / clz on Arm and bsf/bsr elsewhere on x86. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_andn_u32 (uint32_t a, uint32_t b) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _andn_u32(a, b);
+  #else
+    return ~a & b;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _andn_u32
+  #define _andn_u32(a, b) simde_andn_u32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_andn_u64 (uint64_t a, uint64_t b) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _andn_u64(a, b);
+  #else
+    return ~a & b;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _andn_u64
+  #define _andn_u64(a, b) simde_andn_u64(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr2_u32 (uint32_t a, uint32_t control) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && (HEDLEY_GCC_VERSION_CHECK(4,7,0) || defined(__clang__))
+    return __bextr_u32(a, control);
+  #else
+    const uint32_t start = control & 0xff;
+    const uint32_t len = (control >> 8) & 0xff;
+    if (start >= 32)
+      return 0;
+    a >>= start;
+    return (len >= 32) ? a : (a & ((UINT32_C(1) << len) - 1));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr2_u32
+  #define _bextr2_u32(a, control) simde_bextr2_u32(a, control)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr_u32 (uint32_t a, uint32_t start, uint32_t len) {
+  return simde_bextr2_u32(a, (start & 0xff) | ((len & 0xff) << 8));
+}
+#if defined(SIMDE_X86_BMI1_NATIVE)
+  #define simde_bextr_u32(a, start, len) _bextr_u32(a, start, len)
+#endif
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr_u32
+  #define _bextr_u32(a, start, len) simde_bextr_u32(a, start, len)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr2_u64 (uint64_t a, uint64_t control) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64) && (HEDLEY_GCC_VERSION_CHECK(4,7,0) || defined(__clang__))
+    return __bextr_u64(a, control);
+  #else
+    const uint64_t start = control & 0xff;
+    const uint64_t len = (control >> 8) & 0xff;
+    if (start >= 64)
+      return 0;
+    a >>= start;
+    return (len >= 64) ? a : (a & ((UINT64_C(1) << len) - 1));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr2_u64
+  #define _bextr2_u64(a, control) simde_bextr2_u64(a, control)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr_u64 (uint64_t a, uint32_t start, uint32_t len) {
+  return simde_bextr2_u64(a, (start & 0xff) | ((len & 0xff) << 8));
+}
+#if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+  #define simde_bextr_u64(a, start, len) _bextr_u64(a, start, len)
+#endif
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _bextr_u64
+  #define _bextr_u64(a, start, len) simde_bextr_u64(a, start, len)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsi_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsi_u32(a);
+  #else
+    return a & (0U - a);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsi_u32
+  #define _blsi_u32(a) simde_blsi_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsi_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsi_u64(a);
+  #else
+    return a & (UINT64_C(0) - a);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsi_u64
+  #define _blsi_u64(a) simde_blsi_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsmsk_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsmsk_u32(a);
+  #else
+    return a ^ (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsmsk_u32
+  #define _blsmsk_u32(a) simde_blsmsk_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsmsk_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsmsk_u64(a);
+  #else
+    return a ^ (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsmsk_u64
+  #define _blsmsk_u64(a) simde_blsmsk_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsr_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsr_u32(a);
+  #else
+    return a & (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsr_u32
+  #define _blsr_u32(a) simde_blsr_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsr_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsr_u64(a);
+  #else
+    return a & (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _blsr_u64
+  #define _blsr_u64(a) simde_blsr_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_tzcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _tzcnt_u32(a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_ctz) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return (a == 0) ? 32 : HEDLEY_STATIC_CAST(uint32_t, __builtin_ctz(a));
+  #else
+    /* de Bruijn multiply on the isolated lowest set bit */
+    static const uint8_t table[32] = {
+       0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+      31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+    };
+    return (a == 0) ? 32 : table[((a & (0U - a)) * UINT32_C(0x077CB531)) >> 27];
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _tzcnt_u32
+  #define _tzcnt_u32(a) simde_tzcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint16_t
+simde_tzcnt_u16 (uint16_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && (HEDLEY_GCC_VERSION_CHECK(4,7,0) || defined(__clang__))
+    return __tzcnt_u16(a);
+  #else
+    return HEDLEY_STATIC_CAST(uint16_t, simde_tzcnt_u32(HEDLEY_STATIC_CAST(uint32_t, a) | UINT32_C(0x10000)));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _tzcnt_u16
+  #define _tzcnt_u16(a) simde_tzcnt_u16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_tzcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _tzcnt_u64(a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_ctzll) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return (a == 0) ? 64 : HEDLEY_STATIC_CAST(uint64_t, __builtin_ctzll(HEDLEY_STATIC_CAST(unsigned long long, a)));
+  #else
+    const uint32_t lo = HEDLEY_STATIC_CAST(uint32_t, a);
+    return (lo != 0) ? simde_tzcnt_u32(lo) : (32 + simde_tzcnt_u32(HEDLEY_STATIC_CAST(uint32_t, a >> 32)));
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _tzcnt_u64
+  #define _tzcnt_u64(a) simde_tzcnt_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_tzcnt_32 (uint32_t a) {
+  /* GCC only provides the _tzcnt_u* spellings. */
+  return HEDLEY_STATIC_CAST(int32_t, simde_tzcnt_u32(a));
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _mm_tzcnt_32
+  #define _mm_tzcnt_32(a) simde_mm_tzcnt_32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm_tzcnt_64 (uint64_t a) {
+  return HEDLEY_STATIC_CAST(int64_t, simde_tzcnt_u64(a));
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #undef _mm_tzcnt_64
+  #define _mm_tzcnt_64(a) simde_mm_tzcnt_64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_lzcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_LZCNT_NATIVE)
+    return _lzcnt_u32(a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_clz) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return (a == 0) ? 32 : HEDLEY_STATIC_CAST(uint32_t, __builtin_clz(a));
+  #else
+    uint32_t r = 0;
+    if (a == 0)
+      return 32;
+    if (!(a & UINT32_C(0xffff0000))) { r += 16; a <<= 16; }
+    if (!(a & UINT32_C(0xff000000))) { r +=  8; a <<=  8; }
+    if (!(a & UINT32_C(0xf0000000))) { r +=  4; a <<=  4; }
+    if (!(a & UINT32_C(0xc0000000))) { r +=  2; a <<=  2; }
+    if (!(a & UINT32_C(0x80000000))) { r +=  1; }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES)
+  #undef _lzcnt_u32
+  #define _lzcnt_u32(a) simde_lzcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_lzcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_LZCNT_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _lzcnt_u64(a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_clzll) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return (a == 0) ? 64 : HEDLEY_STATIC_CAST(uint64_t, __builtin_clzll(HEDLEY_STATIC_CAST(unsigned long long, a)));
+  #else
+    const uint32_t hi = HEDLEY_STATIC_CAST(uint32_t, a >> 32);
+    return (hi != 0) ? simde_lzcnt_u32(hi) : (32 + simde_lzcnt_u32(HEDLEY_STATIC_CAST(uint32_t, a)));
+  #endif
+}
+#if defined(SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES)
+  #undef _lzcnt_u64
+  #define _lzcnt_u64(a) simde_lzcnt_u64(a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_BMI_H) */
@@ -0,0 +1,206 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_BMI2_H)
+#define SIMDE_X86_BMI2_H
+
+#include "bmi.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_ARM_SVE_NATIVE) && defined(__ARM_FEATURE_SVE2_BITPERM)
+  #define SIMDE_X86_BMI2_SVE2_BITPERM_
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bzhi_u32 (uint32_t a, uint32_t index) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _bzhi_u32(a, index);
+  #else
+    index &= 0xff;
+    return (index >= 32) ? a : (a & ((UINT32_C(1) << index) - 1));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _bzhi_u32
+  #define _bzhi_u32(a, index) simde_bzhi_u32(a, index)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bzhi_u64 (uint64_t a, uint32_t index) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _bzhi_u64(a, index);
+  #else
+    index &= 0xff;
+    return (index >= 64) ? a : (a & ((UINT64_C(1) << index) - 1));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _bzhi_u64
+  #define _bzhi_u64(a, index) simde_bzhi_u64(a, index)
+#endif
+
+/* The portable pdep/pext walk the mask one run of contiguous set bits
+ * at a time rather than one bit at a time: mask & ~(mask + lowest)
+ * isolates the lowest run, which is then moved with a single shift.
+ * Typical rank/select and bitmap masks have a handful of runs, so this
+ * is a few iterations instead of up to 64. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_pdep_u64 (uint64_t a, uint64_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _pdep_u64(a, mask);
+  #elif defined(SIMDE_X86_BMI2_SVE2_BITPERM_)
+    return svlastb_u64(svptrue_pat_b64(SV_VL1), svbdep_n_u64(svdup_n_u64(a), mask));
+  #else
+    uint64_t r = 0;
+    while (mask != 0) {
+      const uint64_t lowest = mask & (UINT64_C(0) - mask);
+      const uint64_t run = mask & ~(mask + lowest);
+      const uint64_t shift = simde_tzcnt_u64(lowest);
+      r |= (a << shift) & run;
+      mask ^= run;
+      if (mask == 0)
+        break;
+      a >>= simde_tzcnt_u64(~(run >> shift));
+    }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pdep_u64
+  #define _pdep_u64(a, mask) simde_pdep_u64(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_pdep_u32 (uint32_t a, uint32_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _pdep_u32(a, mask);
+  #elif defined(SIMDE_X86_BMI2_SVE2_BITPERM_)
+    return svlastb_u32(svptrue_pat_b32(SV_VL1), svbdep_n_u32(svdup_n_u32(a), mask));
+  #else
+    return HEDLEY_STATIC_CAST(uint32_t, simde_pdep_u64(a, mask));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pdep_u32
+  #define _pdep_u32(a, mask) simde_pdep_u32(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_pext_u64 (uint64_t a, uint64_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _pext_u64(a, mask);
+  #elif defined(SIMDE_X86_BMI2_SVE2_BITPERM_)
+    return svlastb_u64(svptrue_pat_b64(SV_VL1), svbext_n_u64(svdup_n_u64(a), mask));
+  #else
+    uint64_t r = 0;
+    uint64_t k = 0;
+    while (mask != 0) {
+      const uint64_t lowest = mask & (UINT64_C(0) - mask);
+      const uint64_t run = mask & ~(mask + lowest);
+      const uint64_t shift = simde_tzcnt_u64(lowest);
+      r |= ((a & run) >> shift) << k;
+      mask ^= run;
+      k += simde_tzcnt_u64(~(run >> shift));
+    }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pext_u64
+  #define _pext_u64(a, mask) simde_pext_u64(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_pext_u32 (uint32_t a, uint32_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _pext_u32(a, mask);
+  #elif defined(SIMDE_X86_BMI2_SVE2_BITPERM_)
+    return svlastb_u32(svptrue_pat_b32(SV_VL1), svbext_n_u32(svdup_n_u32(a), mask));
+  #else
+    return HEDLEY_STATIC_CAST(uint32_t, simde_pext_u64(a, mask));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _pext_u32
+  #define _pext_u32(a, mask) simde_pext_u32(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mulx_u32 (uint32_t a, uint32_t b, uint32_t* hi) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && !defined(SIMDE_ARCH_AMD64)
+    return _mulx_u32(a, b, HEDLEY_REINTERPRET_CAST(unsigned int*, hi));
+  #else
+    const uint64_t r = HEDLEY_STATIC_CAST(uint64_t, a) * HEDLEY_STATIC_CAST(uint64_t, b);
+    *hi = HEDLEY_STATIC_CAST(uint32_t, r >> 32);
+    return HEDLEY_STATIC_CAST(uint32_t, r);
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mulx_u32
+  #define _mulx_u32(a, b, hi) simde_mulx_u32(a, b, HEDLEY_REINTERPRET_CAST(uint32_t*, hi))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mulx_u64 (uint64_t a, uint64_t b, uint64_t* hi) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _mulx_u64(a, b, HEDLEY_REINTERPRET_CAST(unsigned long long*, hi));
+  #elif defined(SIMDE_HAVE_INT128_)
+    HEDLEY_DIAGNOSTIC_PUSH
+    SIMDE_DIAGNOSTIC_DISABLE_PEDANTIC_
+    const simde_uint128 r = HEDLEY_STATIC_CAST(simde_uint128, a) * HEDLEY_STATIC_CAST(simde_uint128, b);
+    HEDLEY_DIAGNOSTIC_POP
+    *hi = HEDLEY_STATIC_CAST(uint64_t, r >> 64);
+    return HEDLEY_STATIC_CAST(uint64_t, r);
+  #else
+    const uint64_t a_lo = a & UINT64_C(0xffffffff), a_hi = a >> 32;
+    const uint64_t b_lo = b & UINT64_C(0xffffffff), b_hi = b >> 32;
+    const uint64_t ll = a_lo * b_lo;
+    const uint64_t lh = a_lo * b_hi;
+    const uint64_t hl = a_hi * b_lo;
+    const uint64_t hh = a_hi * b_hi;
+    const uint64_t mid = (ll >> 32) + (lh & UINT64_C(0xffffffff)) + (hl & UINT64_C(0xffffffff));
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (ll & UINT64_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mulx_u64
+  #define _mulx_u64(a, b, hi) simde_mulx_u64(a, b, HEDLEY_REINTERPRET_CAST(uint64_t*, hi))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_BMI2_H) */
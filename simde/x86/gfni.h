@@ -28,6 +28,7 @@
 
 #include "avx512/add.h"
 #include "avx512/and.h"
+#include "avx512/blend.h"
 #include "avx512/broadcast.h"
 #include "avx512/cmpeq.h"
 #include "avx512/cmpge.h"
@@ -36,6 +37,8 @@
 #include "avx512/extract.h"
 #include "avx512/insert.h"
 #include "avx512/kshift.h"
+#include "avx512/loadu.h"
+#include "avx512/min.h"
 #include "avx512/mov.h"
 #include "avx512/mov_mask.h"
 #include "avx512/permutex2var.h"
@@ -44,6 +47,7 @@
 #include "avx512/setzero.h"
 #include "avx512/shuffle.h"
 #include "avx512/srli.h"
+#include "avx512/sub.h"
 #include "avx512/test.h"
 #include "avx512/xor.h"
 
@@ -85,6 +89,45 @@ static const union {
   }
 };
 
+/* Tables for inverting in the isomorphic composite field GF((2^4)^2)
+ * instead, where GF(2^4) is generated by x^4 + x + 1 and extended by
+ * y^2 + y + 8.  A byte maps to ah*y + al with two nibble lookups per
+ * half, and
+ *
+ *   1 / (ah*y + al) = (ah*y + ah + al) / d,  d = 8*ah^2 + ah*al + al^2
+ *
+ * 8*ah^2 + al^2 is linear too, so it comes straight from the input
+ * nibbles.  GF(2^4) products use log/exp tables; log(0) is 0xE0 so any
+ * sum involving it keeps the high bit set after the mod 15 reduction
+ * and the exp lookup returns zero.
+ *
+ *   0, 1   al from the low and high nibbles of x
+ *   2, 3   ah from the low and high nibbles of x
+ *   4, 5   8*ah^2 + al^2 from the low and high nibbles of x
+ *   6      log
+ *   7      log of the inverse
+ *   8      exp
+ *   9, 10  back to GF(2^8) from al and ah */
+
+static const union {
+  uint8_t      u8[11][16];
+  simde__m128i m128i[11];
+} simde_x_gf2p8inverse_tower_lut = {
+  {
+    { 0x00, 0x01, 0x00, 0x01, 0x06, 0x07, 0x06, 0x07, 0x0c, 0x0d, 0x0c, 0x0d, 0x0a, 0x0b, 0x0a, 0x0b },
+    { 0x00, 0x0c, 0x05, 0x09, 0x04, 0x08, 0x01, 0x0d, 0x05, 0x09, 0x00, 0x0c, 0x01, 0x0d, 0x04, 0x08 },
+    { 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x04, 0x04, 0x06, 0x06, 0x00, 0x00, 0x02, 0x02 },
+    { 0x00, 0x03, 0x0d, 0x0e, 0x03, 0x00, 0x0e, 0x0d, 0x0e, 0x0d, 0x03, 0x00, 0x0d, 0x0e, 0x00, 0x03 },
+    { 0x00, 0x01, 0x06, 0x07, 0x0c, 0x0d, 0x0a, 0x0b, 0x04, 0x05, 0x02, 0x03, 0x08, 0x09, 0x0e, 0x0f },
+    { 0x00, 0x01, 0x0b, 0x0a, 0x0d, 0x0c, 0x06, 0x07, 0x05, 0x04, 0x0e, 0x0f, 0x08, 0x09, 0x03, 0x02 },
+    { 0xe0, 0x00, 0x01, 0x04, 0x02, 0x08, 0x05, 0x0a, 0x03, 0x0e, 0x09, 0x07, 0x06, 0x0d, 0x0b, 0x0c },
+    { 0xe0, 0x00, 0x0e, 0x0b, 0x0d, 0x07, 0x0a, 0x05, 0x0c, 0x01, 0x06, 0x08, 0x09, 0x02, 0x04, 0x03 },
+    { 0x01, 0x02, 0x04, 0x08, 0x03, 0x06, 0x0c, 0x0b, 0x05, 0x0a, 0x07, 0x0e, 0x0f, 0x0d, 0x09, 0x00 },
+    { 0x00, 0x01, 0x5c, 0x5d, 0xe0, 0xe1, 0xbc, 0xbd, 0x50, 0x51, 0x0c, 0x0d, 0xb0, 0xb1, 0xec, 0xed },
+    { 0x00, 0xa2, 0x02, 0xa0, 0xb8, 0x1a, 0xba, 0x18, 0xdb, 0x79, 0xd9, 0x7b, 0x63, 0xc1, 0x61, 0xc3 }
+  }
+};
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i
 simde_x_mm_gf2p8matrix_multiply_epi64_epi8 (simde__m128i x, simde__m128i A) {
@@ -450,27 +493,61 @@ simde_x_mm512_gf2p8matrix_multiply_epi64_epi8 (simde__m512i x, simde__m512i A) {
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i
 simde_x_mm_gf2p8inverse_epi8 (simde__m128i x) {
-  #if defined(SIMDE_X86_SSE4_1_NATIVE)
-    /* N.B. CM: this fallback may not be faster */
-    simde__m128i r, u, t, test;
-    const simde__m128i sixteens = simde_mm_set1_epi8(16);
-    const simde__m128i masked_x = simde_mm_and_si128(x, simde_mm_set1_epi8(0x0F));
-
-    test = simde_mm_set1_epi8(INT8_MIN /* 0x80 */);
-    x = simde_mm_xor_si128(x, test);
-    r = simde_mm_shuffle_epi8(simde_x_gf2p8inverse_lut.m128i[0], masked_x);
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    const uint8x16_t sixtyfour = vdupq_n_u8(64);
+    uint8x16_t r, v = simde__m128i_to_neon_u8(x);
+    uint8x16x4_t lut;
+
+    /* Out-of-range indices leave the lanes alone, so each 64-byte quarter
+     * of the table fills in its own lanes. */
+    lut.val[0] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 +   0);
+    lut.val[1] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 +  16);
+    lut.val[2] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 +  32);
+    lut.val[3] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 +  48);
+    r = vqtbl4q_u8(lut, v);
 
     #if !defined(__INTEL_COMPILER)
       SIMDE_VECTORIZE
     #endif
-    for (int i = 1 ; i < 16 ; i++) {
-      t = simde_mm_shuffle_epi8(simde_x_gf2p8inverse_lut.m128i[i], masked_x);
-      test = simde_mm_add_epi8(test, sixteens);
-      u = simde_mm_cmplt_epi8(x, test);
-      r = simde_mm_blendv_epi8(t, r, u);
+    for (int i = 1 ; i < 4 ; i++) {
+      v = vsubq_u8(v, sixtyfour);
+      lut.val[0] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 + (64 * i) +  0);
+      lut.val[1] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 + (64 * i) + 16);
+      lut.val[2] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 + (64 * i) + 32);
+      lut.val[3] = vld1q_u8(simde_x_gf2p8inverse_lut.u8 + (64 * i) + 48);
+      r = vqtbx4q_u8(r, lut, v);
     }
 
-    return r;
+    return simde__m128i_from_neon_u8(r);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE) || defined(SIMDE_WASM_SIMD128_NATIVE)
+    const simde__m128i nibble = simde_mm_set1_epi8(0x0F);
+    const simde__m128i fifteen = simde_mm_set1_epi8(15);
+    const simde__m128i lo = simde_mm_and_si128(x, nibble);
+    const simde__m128i hi = simde_mm_and_si128(simde_mm_srli_epi16(x, 4), nibble);
+    const simde__m128i* lut = simde_x_gf2p8inverse_tower_lut.m128i;
+    simde__m128i al, ah, d, la, ll, ld, t, rh, rl;
+
+    al = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[0], lo), simde_mm_shuffle_epi8(lut[1], hi));
+    ah = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[2], lo), simde_mm_shuffle_epi8(lut[3], hi));
+    d = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[4], lo), simde_mm_shuffle_epi8(lut[5], hi));
+    la = simde_mm_shuffle_epi8(lut[6], ah);
+    ll = simde_mm_shuffle_epi8(lut[6], al);
+
+    /* d += ah * al */
+    t = simde_mm_add_epi8(la, ll);
+    t = simde_mm_min_epu8(t, simde_mm_sub_epi8(t, fifteen));
+    d = simde_mm_xor_si128(d, simde_mm_shuffle_epi8(lut[8], t));
+    ld = simde_mm_shuffle_epi8(lut[7], d);
+
+    /* rh = ah / d, rl = (ah + al) / d */
+    t = simde_mm_add_epi8(la, ld);
+    t = simde_mm_min_epu8(t, simde_mm_sub_epi8(t, fifteen));
+    rh = simde_mm_shuffle_epi8(lut[8], t);
+    t = simde_mm_add_epi8(ll, ld);
+    t = simde_mm_min_epu8(t, simde_mm_sub_epi8(t, fifteen));
+    rl = simde_mm_xor_si128(rh, simde_mm_shuffle_epi8(lut[8], t));
+
+    return simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[9], rl), simde_mm_shuffle_epi8(lut[10], rh));
   #else
     simde__m128i_private
       r_,
@@ -491,26 +568,37 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m256i
 simde_x_mm256_gf2p8inverse_epi8 (simde__m256i x) {
   #if defined(SIMDE_X86_AVX2_NATIVE)
-    /* N.B. CM: this fallback may not be faster */
-    simde__m256i r, u, t, test;
-    const simde__m256i sixteens = simde_mm256_set1_epi8(16);
-    const simde__m256i masked_x = simde_mm256_and_si256(x, simde_mm256_set1_epi8(0x0F));
-
-    test = simde_mm256_set1_epi8(INT8_MIN /* 0x80 */);
-    x = simde_mm256_xor_si256(x, test);
-    r = simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(simde_x_gf2p8inverse_lut.m128i[0]), masked_x);
-
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (int i = 1 ; i < 16 ; i++) {
-      t = simde_mm256_shuffle_epi8(simde_mm256_broadcastsi128_si256(simde_x_gf2p8inverse_lut.m128i[i]), masked_x);
-      test = simde_mm256_add_epi8(test, sixteens);
-      u = simde_mm256_cmpgt_epi8(test, x);
-      r = simde_mm256_blendv_epi8(t, r, u);
+    const simde__m256i nibble = simde_mm256_set1_epi8(0x0F);
+    const simde__m256i fifteen = simde_mm256_set1_epi8(15);
+    const simde__m256i lo = simde_mm256_and_si256(x, nibble);
+    const simde__m256i hi = simde_mm256_and_si256(simde_mm256_srli_epi16(x, 4), nibble);
+    simde__m256i lut[11], al, ah, d, la, ll, ld, t, rh, rl;
+
+    for (size_t i = 0 ; i < (sizeof(lut) / sizeof(lut[0])) ; i++) {
+      lut[i] = simde_mm256_broadcastsi128_si256(simde_x_gf2p8inverse_tower_lut.m128i[i]);
     }
 
-    return r;
+    al = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(lut[0], lo), simde_mm256_shuffle_epi8(lut[1], hi));
+    ah = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(lut[2], lo), simde_mm256_shuffle_epi8(lut[3], hi));
+    d = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(lut[4], lo), simde_mm256_shuffle_epi8(lut[5], hi));
+    la = simde_mm256_shuffle_epi8(lut[6], ah);
+    ll = simde_mm256_shuffle_epi8(lut[6], al);
+
+    /* d += ah * al */
+    t = simde_mm256_add_epi8(la, ll);
+    t = simde_mm256_min_epu8(t, simde_mm256_sub_epi8(t, fifteen));
+    d = simde_mm256_xor_si256(d, simde_mm256_shuffle_epi8(lut[8], t));
+    ld = simde_mm256_shuffle_epi8(lut[7], d);
+
+    /* rh = ah / d, rl = (ah + al) / d */
+    t = simde_mm256_add_epi8(la, ld);
+    t = simde_mm256_min_epu8(t, simde_mm256_sub_epi8(t, fifteen));
+    rh = simde_mm256_shuffle_epi8(lut[8], t);
+    t = simde_mm256_add_epi8(ll, ld);
+    t = simde_mm256_min_epu8(t, simde_mm256_sub_epi8(t, fifteen));
+    rl = simde_mm256_xor_si256(rh, simde_mm256_shuffle_epi8(lut[8], t));
+
+    return simde_mm256_xor_si256(simde_mm256_shuffle_epi8(lut[9], rl), simde_mm256_shuffle_epi8(lut[10], rh));
   #else
     simde__m256i_private
       r_,
@@ -530,26 +618,48 @@ simde_x_mm256_gf2p8inverse_epi8 (simde__m256i x) {
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512i
 simde_x_mm512_gf2p8inverse_epi8 (simde__m512i x) {
-  /* N.B. CM: TODO: later add VBMI version using just two _mm512_permutex2var_epi8 and friends */
-  /* But except for Cannon Lake all processors with VBMI also have GFNI */
-  #if defined(SIMDE_X86_AVX512BW_NATIVE)
-    /* N.B. CM: this fallback may not be faster */
-    simde__m512i r, test;
-    const simde__m512i sixteens = simde_mm512_set1_epi8(16);
-    const simde__m512i masked_x = simde_mm512_and_si512(x, simde_mm512_set1_epi8(0x0F));
-
-    r = simde_mm512_shuffle_epi8(simde_mm512_broadcast_i32x4(simde_x_gf2p8inverse_lut.m128i[0]), masked_x);
-    test = sixteens;
-
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (int i = 1 ; i < 16 ; i++) {
-      r = simde_mm512_mask_shuffle_epi8(r, simde_mm512_cmpge_epu8_mask(x, test), simde_mm512_broadcast_i32x4(simde_x_gf2p8inverse_lut.m128i[i]), masked_x);
-      test = simde_mm512_add_epi8(test, sixteens);
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
+    /* Bit 6 picks the table within each vpermi2b, bit 7 picks the result. */
+    const simde__m512i lut0 = simde_mm512_loadu_si512(&(simde_x_gf2p8inverse_lut.m128i[ 0]));
+    const simde__m512i lut1 = simde_mm512_loadu_si512(&(simde_x_gf2p8inverse_lut.m128i[ 4]));
+    const simde__m512i lut2 = simde_mm512_loadu_si512(&(simde_x_gf2p8inverse_lut.m128i[ 8]));
+    const simde__m512i lut3 = simde_mm512_loadu_si512(&(simde_x_gf2p8inverse_lut.m128i[12]));
+
+    return simde_mm512_mask_blend_epi8(simde_mm512_movepi8_mask(x),
+                                       simde_mm512_permutex2var_epi8(lut0, x, lut1),
+                                       simde_mm512_permutex2var_epi8(lut2, x, lut3));
+  #elif defined(SIMDE_X86_AVX512BW_NATIVE)
+    const simde__m512i nibble = simde_mm512_set1_epi8(0x0F);
+    const simde__m512i fifteen = simde_mm512_set1_epi8(15);
+    const simde__m512i lo = simde_mm512_and_si512(x, nibble);
+    const simde__m512i hi = simde_mm512_and_si512(simde_mm512_srli_epi16(x, 4), nibble);
+    simde__m512i lut[11], al, ah, d, la, ll, ld, t, rh, rl;
+
+    for (size_t i = 0 ; i < (sizeof(lut) / sizeof(lut[0])) ; i++) {
+      lut[i] = simde_mm512_broadcast_i32x4(simde_x_gf2p8inverse_tower_lut.m128i[i]);
     }
 
-    return r;
+    al = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(lut[0], lo), simde_mm512_shuffle_epi8(lut[1], hi));
+    ah = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(lut[2], lo), simde_mm512_shuffle_epi8(lut[3], hi));
+    d = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(lut[4], lo), simde_mm512_shuffle_epi8(lut[5], hi));
+    la = simde_mm512_shuffle_epi8(lut[6], ah);
+    ll = simde_mm512_shuffle_epi8(lut[6], al);
+
+    /* d += ah * al */
+    t = simde_mm512_add_epi8(la, ll);
+    t = simde_mm512_min_epu8(t, simde_mm512_sub_epi8(t, fifteen));
+    d = simde_mm512_xor_si512(d, simde_mm512_shuffle_epi8(lut[8], t));
+    ld = simde_mm512_shuffle_epi8(lut[7], d);
+
+    /* rh = ah / d, rl = (ah + al) / d */
+    t = simde_mm512_add_epi8(la, ld);
+    t = simde_mm512_min_epu8(t, simde_mm512_sub_epi8(t, fifteen));
+    rh = simde_mm512_shuffle_epi8(lut[8], t);
+    t = simde_mm512_add_epi8(ll, ld);
+    t = simde_mm512_min_epu8(t, simde_mm512_sub_epi8(t, fifteen));
+    rl = simde_mm512_xor_si512(rh, simde_mm512_shuffle_epi8(lut[8], t));
+
+    return simde_mm512_xor_si512(simde_mm512_shuffle_epi8(lut[9], rl), simde_mm512_shuffle_epi8(lut[10], rh));
   #else
     simde__m512i_private
       r_,
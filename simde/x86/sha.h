@@ -0,0 +1,423 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_SHA_H)
+#define SIMDE_X86_SHA_H
+
+#include "sse4.1.h"
+#include "../simde-sha.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* x86 stores the SHA-1 words with W0 (and A) in the high lane while
+ * Armv8 puts them in lane 0, so going through the Arm instructions
+ * means reversing the lanes on the way in and out. */
+#if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
+  SIMDE_FUNCTION_ATTRIBUTES
+  uint32x4_t
+  simde_x_mm_sha_rev_neon_u32_(uint32x4_t v) {
+    v = vrev64q_u32(v);
+    return vextq_u32(v, v, 2);
+  }
+#endif
+
+/* The slice of b:a starting at lane 1, i.e. _mm_alignr_epi8(b, a, 4). */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_sha_alignr4_(simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return simde_mm_alignr_epi8(b, a, 4);
+  #else
+    return simde_mm_or_si128(simde_mm_srli_si128(a, 4), simde_mm_slli_si128(b, 12));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_sha1_rol1_epi32_(simde__m128i a) {
+  return simde_mm_or_si128(simde_mm_add_epi32(a, a), simde_mm_srli_epi32(a, 31));
+}
+
+/* sigma0(x) = ROTR7(x) ^ ROTR18(x) ^ SHR3(x) */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_sha256_sigma0_epi32_(simde__m128i a) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(
+        simde_mm_xor_si128(simde_mm_srli_epi32(a,  7), simde_mm_srli_epi32(a, 18)),
+        simde_mm_xor_si128(simde_mm_slli_epi32(a, 25), simde_mm_slli_epi32(a, 14))),
+      simde_mm_srli_epi32(a,  3));
+}
+
+/* sigma1(x) = ROTR17(x) ^ ROTR19(x) ^ SHR10(x) */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_sha256_sigma1_epi32_(simde__m128i a) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(
+        simde_mm_xor_si128(simde_mm_srli_epi32(a, 17), simde_mm_srli_epi32(a, 19)),
+        simde_mm_xor_si128(simde_mm_slli_epi32(a, 15), simde_mm_slli_epi32(a, 13))),
+      simde_mm_srli_epi32(a, 10));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg1_epu32(a, b);
+  #else
+    /* {W0 ^ W2, W1 ^ W3, W2 ^ W4, W3 ^ W5}, highest lane first */
+    return
+      simde_mm_xor_si128(
+        a,
+        simde_mm_castpd_si128(simde_mm_shuffle_pd(simde_mm_castsi128_pd(b), simde_mm_castsi128_pd(a), 1)));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1msg1_epu32
+  #define _mm_sha1msg1_epu32(a, b) simde_mm_sha1msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg2_epu32(a, b);
+  #else
+    /* W16..W18 only depend on the inputs; W19 also needs W16, which is
+     * the high lane of the first pass. */
+    simde__m128i r = simde_x_mm_sha1_rol1_epi32_(simde_mm_xor_si128(a, simde_mm_slli_si128(b, 4)));
+    return simde_mm_xor_si128(r, simde_mm_srli_si128(simde_x_mm_sha1_rol1_epi32_(r), 12));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1msg2_epu32
+  #define _mm_sha1msg2_epu32(a, b) simde_mm_sha1msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1nexte_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1nexte_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(b),
+      a_ = simde__m128i_to_private(a);
+
+    r_.u32[3] += simde_x_sha_rotl32_(a_.u32[3], 30);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1nexte_epu32
+  #define _mm_sha1nexte_epu32(a, b) simde_mm_sha1nexte_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1rnds4_epu32 (simde__m128i a, simde__m128i b, const int func)
+    SIMDE_REQUIRE_CONSTANT_RANGE(func, 0, 3) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
+    uint32x4_t
+      abcd = simde_x_mm_sha_rev_neon_u32_(a_.neon_u32),
+      wk = vaddq_u32(simde_x_mm_sha_rev_neon_u32_(b_.neon_u32), vdupq_n_u32(simde_x_sha1_k[func & 3]));
+
+    switch (func & 3) {
+      case 0:
+        abcd = vsha1cq_u32(abcd, 0, wk);
+        break;
+      case 2:
+        abcd = vsha1mq_u32(abcd, 0, wk);
+        break;
+      default:
+        abcd = vsha1pq_u32(abcd, 0, wk);
+        break;
+    }
+
+    r_.neon_u32 = simde_x_mm_sha_rev_neon_u32_(abcd);
+  #else
+    uint32_t abcd[4], wk[4];
+
+    for (int i = 0 ; i < 4 ; i++) {
+      abcd[i] = a_.u32[3 - i];
+      wk[i] = b_.u32[3 - i] + simde_x_sha1_k[func & 3];
+    }
+
+    simde_x_sha1_rounds4_(abcd, 0, wk, func & 3);
+
+    for (int i = 0 ; i < 4 ; i++) {
+      r_.u32[i] = abcd[3 - i];
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_SHA_NATIVE)
+  #define simde_mm_sha1rnds4_epu32(a, b, func) _mm_sha1rnds4_epu32(a, b, func)
+#endif
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1rnds4_epu32
+  #define _mm_sha1rnds4_epu32(a, b, func) simde_mm_sha1rnds4_epu32(a, b, func)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg1_epu32(a, b);
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
+    return simde__m128i_from_neon_u32(vsha256su0q_u32(simde__m128i_to_neon_u32(a), simde__m128i_to_neon_u32(b)));
+  #else
+    return simde_mm_add_epi32(a, simde_x_mm_sha256_sigma0_epi32_(simde_x_mm_sha_alignr4_(a, b)));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256msg1_epu32
+  #define _mm_sha256msg1_epu32(a, b) simde_mm_sha256msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg2_epu32(a, b);
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
+    /* SHA256SU1 also adds W[t-7], which it takes from its second and
+     * third operands; pass zero and cancel the lane it borrows from b. */
+    uint32x4_t
+      zero = vdupq_n_u32(0),
+      b_ = simde__m128i_to_neon_u32(b);
+    return
+      simde__m128i_from_neon_u32(
+        vsha256su1q_u32(vsubq_u32(simde__m128i_to_neon_u32(a), vextq_u32(zero, b_, 1)), zero, b_));
+  #else
+    /* sigma1 of zero is zero, so each half can be done on all lanes: the
+     * first pass uses W14 and W15, the second the two words it produced. */
+    simde__m128i r = simde_mm_add_epi32(a, simde_x_mm_sha256_sigma1_epi32_(simde_mm_srli_si128(b, 8)));
+    return simde_mm_add_epi32(r, simde_x_mm_sha256_sigma1_epi32_(simde_mm_slli_si128(r, 8)));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256msg2_epu32
+  #define _mm_sha256msg2_epu32(a, b) simde_mm_sha256msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256rnds2_epu32 (simde__m128i a, simde__m128i b, simde__m128i k) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256rnds2_epu32(a, b, k);
+  #else
+    /* a is {H, G, D, C} and b is {F, E, B, A} from lane 0 up.  There is
+     * no two-round instruction on Arm, so this is always scalar. */
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      k_ = simde__m128i_to_private(k);
+    uint32_t s[8] = {
+      b_.u32[3], b_.u32[2], a_.u32[3], a_.u32[2],
+      b_.u32[1], b_.u32[0], a_.u32[1], a_.u32[0]
+    };
+
+    simde_x_sha256_rounds_(s, &(k_.u32[0]), 2);
+
+    r_.u32[0] = s[5];
+    r_.u32[1] = s[4];
+    r_.u32[2] = s[1];
+    r_.u32[3] = s[0];
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256rnds2_epu32
+  #define _mm_sha256rnds2_epu32(a, b, k) simde_mm_sha256rnds2_epu32(a, b, k)
+#endif
+
+/* One group of four rounds of simde_x_sha256_process_blocks.  m0 holds
+ * the words for these rounds and is replaced with the ones needed four
+ * groups later; m1..m3 are the following groups.  Passing the state by
+ * pointer lets the caller rotate names instead of indexing an array,
+ * which keeps everything in registers once this is inlined. */
+#if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_sha256_step_neon_(uint32x4_t* abcd, uint32x4_t* efgh, uint32x4_t* m0, uint32x4_t m1, uint32x4_t m2, uint32x4_t m3, int i) {
+    uint32x4_t
+      wk = vaddq_u32(*m0, vld1q_u32(&(simde_x_sha256_k[4 * i]))),
+      t = *abcd;
+
+    if (i < 12) {
+      *m0 = vsha256su1q_u32(vsha256su0q_u32(*m0, m1), m2, m3);
+    }
+
+    *abcd = vsha256hq_u32(*abcd, *efgh, wk);
+    *efgh = vsha256h2q_u32(*efgh, t, wk);
+  }
+#elif defined(SIMDE_X86_SHA_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_sha256_step_x86_(simde__m128i* abef, simde__m128i* cdgh, simde__m128i* m0, simde__m128i m1, simde__m128i m2, simde__m128i m3, int i) {
+    simde__m128i wk = simde_mm_add_epi32(*m0, simde_mm_loadu_si128(&(simde_x_sha256_k[4 * i])));
+
+    if (i < 12) {
+      *m0 =
+        simde_mm_sha256msg2_epu32(
+          simde_mm_add_epi32(simde_mm_sha256msg1_epu32(*m0, m1), simde_mm_alignr_epi8(m3, m2, 4)),
+          m3);
+    }
+
+    *cdgh = simde_mm_sha256rnds2_epu32(*cdgh, *abef, wk);
+    *abef = simde_mm_sha256rnds2_epu32(*abef, *cdgh, simde_mm_shuffle_epi32(wk, 0x0e));
+  }
+#endif
+
+/*
+ * Runs the SHA-256 compression function over `blocks` consecutive
+ * 64-byte blocks of `data`, updating `state` (H0 through H7) in place.
+ * Padding is the caller's responsibility.
+ *
+ * This uses SHA-NI or the Armv8 SHA2 instructions directly when they
+ * are available.  Otherwise the message schedule is computed four words
+ * at a time with the vector fallbacks above, and only the rounds
+ * themselves are scalar.
+ */
+SIMDE_HUGE_FUNCTION_ATTRIBUTES
+void
+simde_x_sha256_process_blocks(uint32_t state[8], const void* data, size_t blocks) {
+  const uint8_t* p = HEDLEY_REINTERPRET_CAST(const uint8_t*, data);
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_SHA2)
+    uint32x4_t
+      abcd = vld1q_u32(&(state[0])),
+      efgh = vld1q_u32(&(state[4]));
+
+    for (size_t n = 0 ; n < blocks ; n++, p += 64) {
+      uint32x4_t msg[4], abcd0 = abcd, efgh0 = efgh;
+
+      for (int i = 0 ; i < 4 ; i++) {
+        msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&(p[16 * i]))));
+      }
+
+      for (int i = 0 ; i < 16 ; i += 4) {
+        simde_x_sha256_step_neon_(&abcd, &efgh, &(msg[0]), msg[1], msg[2], msg[3], i    );
+        simde_x_sha256_step_neon_(&abcd, &efgh, &(msg[1]), msg[2], msg[3], msg[0], i + 1);
+        simde_x_sha256_step_neon_(&abcd, &efgh, &(msg[2]), msg[3], msg[0], msg[1], i + 2);
+        simde_x_sha256_step_neon_(&abcd, &efgh, &(msg[3]), msg[0], msg[1], msg[2], i + 3);
+      }
+
+      abcd = vaddq_u32(abcd, abcd0);
+      efgh = vaddq_u32(efgh, efgh0);
+    }
+
+    vst1q_u32(&(state[0]), abcd);
+    vst1q_u32(&(state[4]), efgh);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    const simde__m128i bswap = simde_mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    simde__m128i
+      t = simde_mm_shuffle_epi32(simde_mm_loadu_si128(&(state[0])), 0xb1),
+      cdgh = simde_mm_shuffle_epi32(simde_mm_loadu_si128(&(state[4])), 0x1b),
+      abef = simde_mm_alignr_epi8(t, cdgh, 8);
+    cdgh = simde_mm_blend_epi16(cdgh, t, 0xf0);
+
+    for (size_t n = 0 ; n < blocks ; n++, p += 64) {
+      simde__m128i msg[4], abef0 = abef, cdgh0 = cdgh;
+
+      for (int i = 0 ; i < 4 ; i++) {
+        msg[i] = simde_mm_shuffle_epi8(simde_mm_loadu_si128(&(p[16 * i])), bswap);
+      }
+
+      for (int i = 0 ; i < 16 ; i += 4) {
+        simde_x_sha256_step_x86_(&abef, &cdgh, &(msg[0]), msg[1], msg[2], msg[3], i    );
+        simde_x_sha256_step_x86_(&abef, &cdgh, &(msg[1]), msg[2], msg[3], msg[0], i + 1);
+        simde_x_sha256_step_x86_(&abef, &cdgh, &(msg[2]), msg[3], msg[0], msg[1], i + 2);
+        simde_x_sha256_step_x86_(&abef, &cdgh, &(msg[3]), msg[0], msg[1], msg[2], i + 3);
+      }
+
+      abef = simde_mm_add_epi32(abef, abef0);
+      cdgh = simde_mm_add_epi32(cdgh, cdgh0);
+    }
+
+    t = simde_mm_shuffle_epi32(abef, 0x1b);
+    cdgh = simde_mm_shuffle_epi32(cdgh, 0xb1);
+    simde_mm_storeu_si128(&(state[0]), simde_mm_blend_epi16(t, cdgh, 0xf0));
+    simde_mm_storeu_si128(&(state[4]), simde_mm_alignr_epi8(cdgh, t, 8));
+  #else
+    for (size_t n = 0 ; n < blocks ; n++, p += 64) {
+      uint32_t w[16], wk[64], s[8];
+      simde__m128i msg[4];
+
+      for (int i = 0 ; i < 16 ; i++) {
+        w[i] =
+          (HEDLEY_STATIC_CAST(uint32_t, p[4 * i    ]) << 24) |
+          (HEDLEY_STATIC_CAST(uint32_t, p[4 * i + 1]) << 16) |
+          (HEDLEY_STATIC_CAST(uint32_t, p[4 * i + 2]) <<  8) |
+          (HEDLEY_STATIC_CAST(uint32_t, p[4 * i + 3])      );
+      }
+
+      for (int i = 0 ; i < 4 ; i++) {
+        msg[i] = simde_mm_loadu_si128(&(w[4 * i]));
+      }
+
+      for (int i = 0 ; i < 16 ; i++) {
+        simde_mm_storeu_si128(&(wk[4 * i]), simde_mm_add_epi32(msg[i & 3], simde_mm_loadu_si128(&(simde_x_sha256_k[4 * i]))));
+
+        if (i < 12) {
+          msg[i & 3] =
+            simde_mm_sha256msg2_epu32(
+              simde_mm_add_epi32(
+                simde_mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]),
+                simde_x_mm_sha_alignr4_(msg[(i + 2) & 3], msg[(i + 3) & 3])),
+              msg[(i + 3) & 3]);
+        }
+      }
+
+      for (int i = 0 ; i < 8 ; i++) {
+        s[i] = state[i];
+      }
+
+      simde_x_sha256_rounds_(s, wk, 64);
+
+      for (int i = 0 ; i < 8 ; i++) {
+        state[i] += s[i];
+      }
+    }
+  #endif
+}
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_SHA_H) */
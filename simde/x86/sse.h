@@ -436,6 +436,27 @@ enum {
   #define _MM_FLUSH_ZERO_OFF SIMDE_MM_FLUSH_ZERO_OFF
 #endif
 
+#if defined(_MM_DENORMALS_ZERO_MASK)
+#  define SIMDE_MM_DENORMALS_ZERO_MASK _MM_DENORMALS_ZERO_MASK
+#else
+#  define SIMDE_MM_DENORMALS_ZERO_MASK (0x0040)
+#endif
+#if defined(_MM_DENORMALS_ZERO_ON)
+#  define SIMDE_MM_DENORMALS_ZERO_ON _MM_DENORMALS_ZERO_ON
+#else
+#  define SIMDE_MM_DENORMALS_ZERO_ON (0x0040)
+#endif
+#if defined(_MM_DENORMALS_ZERO_OFF)
+#  define SIMDE_MM_DENORMALS_ZERO_OFF _MM_DENORMALS_ZERO_OFF
+#else
+#  define SIMDE_MM_DENORMALS_ZERO_OFF (0x0000)
+#endif
+#if defined(SIMDE_X86_SSE3_ENABLE_NATIVE_ALIASES)
+  #define _MM_DENORMALS_ZERO_MASK SIMDE_MM_DENORMALS_ZERO_MASK
+  #define _MM_DENORMALS_ZERO_ON SIMDE_MM_DENORMALS_ZERO_ON
+  #define _MM_DENORMALS_ZERO_OFF SIMDE_MM_DENORMALS_ZERO_OFF
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 uint32_t
 SIMDE_MM_GET_ROUNDING_MODE(void) {
@@ -529,17 +550,80 @@ SIMDE_MM_SET_ROUNDING_MODE(uint32_t a) {
   #define _MM_SET_ROUNDING_MODE(a) SIMDE_MM_SET_ROUNDING_MODE(a)
 #endif
 
+/* MXCSR has separate bits for flush-to-zero (FTZ, denormal results)
+ * and denormals-are-zero (DAZ, denormal inputs).  AArch64 FPCR.FZ,
+ * AArch32 FPSCR.FZ and POWER VSCR.NJ / FPSCR.NI flush both, so on
+ * those targets FTZ and DAZ share a single control: enabling either
+ * one flushes inputs and results, and it reads back as both.  On
+ * other targets these do nothing and report both modes as off. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_get_flush_denormals (void) {
+  #if defined(SIMDE_ARCH_AARCH64) && !defined(HEDLEY_MSVC_VERSION)
+    uint64_t fpcr;
+    __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+    return (fpcr & (UINT64_C(1) << 24)) != 0;
+  #elif defined(SIMDE_ARCH_ARM) && defined(__ARM_FP) && !defined(HEDLEY_MSVC_VERSION)
+    uint32_t fpscr;
+    __asm__ __volatile__ ("vmrs %0, fpscr" : "=r" (fpscr));
+    return (fpscr & (UINT32_C(1) << 24)) != 0;
+  #elif defined(SIMDE_ARCH_POWER) && defined(HEDLEY_GNUC_VERSION)
+    double fpscr_f;
+    uint64_t fpscr;
+    __asm__ __volatile__ ("mffs %0" : "=f" (fpscr_f));
+    simde_memcpy(&fpscr, &fpscr_f, sizeof(fpscr));
+    return (fpscr & UINT64_C(0x4)) != 0;
+  #else
+    return 0;
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm_set_flush_denormals (int enable) {
+  #if defined(SIMDE_ARCH_AARCH64) && !defined(HEDLEY_MSVC_VERSION)
+    #if defined(SIMDE_ARCH_ARM_NEON_FP16)
+      const uint64_t fz = (UINT64_C(1) << 24) | (UINT64_C(1) << 19);
+    #else
+      const uint64_t fz = UINT64_C(1) << 24;
+    #endif
+    uint64_t fpcr;
+    __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+    fpcr = enable ? (fpcr | fz) : (fpcr & ~fz);
+    __asm__ __volatile__ ("msr fpcr, %0" : : "r" (fpcr));
+  #elif defined(SIMDE_ARCH_ARM) && defined(__ARM_FP) && !defined(HEDLEY_MSVC_VERSION)
+    const uint32_t fz = UINT32_C(1) << 24;
+    uint32_t fpscr;
+    __asm__ __volatile__ ("vmrs %0, fpscr" : "=r" (fpscr));
+    fpscr = enable ? (fpscr | fz) : (fpscr & ~fz);
+    __asm__ __volatile__ ("vmsr fpscr, %0" : : "r" (fpscr));
+  #elif defined(SIMDE_ARCH_POWER) && defined(HEDLEY_GNUC_VERSION)
+    #if defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+      const SIMDE_POWER_ALTIVEC_VECTOR(unsigned int) nj = vec_splats(UINT32_C(0x00010000));
+      SIMDE_POWER_ALTIVEC_VECTOR(unsigned int) vscr = HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned int), vec_mfvscr());
+      vec_mtvscr(enable ? vec_or(vscr, nj) : vec_andc(vscr, nj));
+    #endif
+    if (enable) {
+      __asm__ __volatile__ ("mtfsb1 29");
+    } else {
+      __asm__ __volatile__ ("mtfsb0 29");
+    }
+  #else
+    (void) enable;
+  #endif
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 uint32_t
 SIMDE_MM_GET_FLUSH_ZERO_MODE (void) {
   #if defined(SIMDE_X86_SSE_NATIVE)
     return _mm_getcsr() & _MM_FLUSH_ZERO_MASK;
   #else
-    return SIMDE_MM_FLUSH_ZERO_OFF;
+    return simde_x_mm_get_flush_denormals() ? SIMDE_MM_FLUSH_ZERO_ON : SIMDE_MM_FLUSH_ZERO_OFF;
   #endif
 }
 #if defined(SIMDE_X86_SSE_ENABLE_NATIVE_ALIASES)
-  #define _MM_GET_FLUSH_ZERO_MODE(a) SIMDE_MM_GET_FLUSH_ZERO_MODE(a)
+  #define _MM_GET_FLUSH_ZERO_MODE() SIMDE_MM_GET_FLUSH_ZERO_MODE()
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -548,7 +632,7 @@ SIMDE_MM_SET_FLUSH_ZERO_MODE (uint32_t a) {
   #if defined(SIMDE_X86_SSE_NATIVE)
     _MM_SET_FLUSH_ZERO_MODE(a);
   #else
-    (void) a;
+    simde_x_mm_set_flush_denormals((a & SIMDE_MM_FLUSH_ZERO_MASK) == SIMDE_MM_FLUSH_ZERO_ON);
   #endif
 }
 #if defined(SIMDE_X86_SSE_ENABLE_NATIVE_ALIASES)
@@ -561,7 +645,13 @@ simde_mm_getcsr (void) {
   #if defined(SIMDE_X86_SSE_NATIVE)
     return _mm_getcsr();
   #else
-    return SIMDE_MM_GET_ROUNDING_MODE();
+    uint32_t r = SIMDE_MM_GET_ROUNDING_MODE();
+
+    if (simde_x_mm_get_flush_denormals()) {
+      r |= SIMDE_MM_FLUSH_ZERO_ON | SIMDE_MM_DENORMALS_ZERO_ON;
+    }
+
+    return r;
   #endif
 }
 #if defined(SIMDE_X86_SSE_ENABLE_NATIVE_ALIASES)
@@ -575,6 +665,7 @@ simde_mm_setcsr (uint32_t a) {
     _mm_setcsr(a);
   #else
     SIMDE_MM_SET_ROUNDING_MODE(HEDLEY_STATIC_CAST(uint32_t, a & SIMDE_MM_ROUND_MASK));
+    simde_x_mm_set_flush_denormals((a & (SIMDE_MM_FLUSH_ZERO_MASK | SIMDE_MM_DENORMALS_ZERO_MASK)) != 0);
   #endif
 }
 #if defined(SIMDE_X86_SSE_ENABLE_NATIVE_ALIASES)
@@ -33,6 +33,36 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+SIMDE_MM_GET_DENORMALS_ZERO_MODE (void) {
+  #if defined(SIMDE_X86_SSE3_NATIVE)
+    return _MM_GET_DENORMALS_ZERO_MODE();
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    return _mm_getcsr() & SIMDE_MM_DENORMALS_ZERO_MASK;
+  #else
+    return simde_x_mm_get_flush_denormals() ? SIMDE_MM_DENORMALS_ZERO_ON : SIMDE_MM_DENORMALS_ZERO_OFF;
+  #endif
+}
+#if defined(SIMDE_X86_SSE3_ENABLE_NATIVE_ALIASES)
+  #define _MM_GET_DENORMALS_ZERO_MODE() SIMDE_MM_GET_DENORMALS_ZERO_MODE()
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+SIMDE_MM_SET_DENORMALS_ZERO_MODE (uint32_t a) {
+  #if defined(SIMDE_X86_SSE3_NATIVE)
+    _MM_SET_DENORMALS_ZERO_MODE(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    _mm_setcsr((_mm_getcsr() & ~HEDLEY_STATIC_CAST(unsigned int, SIMDE_MM_DENORMALS_ZERO_MASK)) | a);
+  #else
+    simde_x_mm_set_flush_denormals((a & SIMDE_MM_DENORMALS_ZERO_MASK) == SIMDE_MM_DENORMALS_ZERO_ON);
+  #endif
+}
+#if defined(SIMDE_X86_SSE3_ENABLE_NATIVE_ALIASES)
+  #define _MM_SET_DENORMALS_ZERO_MODE(a) SIMDE_MM_SET_DENORMALS_ZERO_MODE(a)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i
 simde_x_mm_deinterleaveeven_epi16 (simde__m128i a, simde__m128i b) {
@@ -29,6 +29,7 @@
 #define SIMDE_X86_SSE4_2_H
 
 #include "sse4.1.h"
+#include "../simde-crc32.h"
 
 #if defined(__ARM_ACLE) || (defined(__GNUC__) && defined(__ARM_FEATURE_CRC32))
   #include <arm_acle.h>
@@ -289,6 +290,396 @@ simde_mm_cmpistrz_16_(simde__m128i b) {
   #define _mm_cmpistrz(a, b, imm8) simde_mm_cmpistrz(a, b, imm8)
 #endif
 
+/* The remaining PCMPxSTRx forms share one engine which computes the
+ * 8- or 16-bit IntRes2 mask described in the SDM: bit i is the
+ * aggregated, polarity-adjusted result for element i of b.  Each
+ * element of a is broadcast and compared against all of b at once, so
+ * the work is at most one vector compare per element of a instead of
+ * the full 16x16 comparison matrix. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_movemask_ (simde__m128i v, int words) {
+  return words ?
+    simde_mm_movemask_epi8(simde_mm_packs_epi16(v, simde_mm_setzero_si128())) :
+    simde_mm_movemask_epi8(v);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_lsb_ (int v) {
+  #if HEDLEY_HAS_BUILTIN(__builtin_ctz) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return __builtin_ctz(HEDLEY_STATIC_CAST(unsigned int, v));
+  #else
+    int r = 0;
+    while (!((v >> r) & 1))
+      r++;
+    return r;
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_msb_ (int v) {
+  #if HEDLEY_HAS_BUILTIN(__builtin_clz) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return 31 - __builtin_clz(HEDLEY_STATIC_CAST(unsigned int, v));
+  #else
+    int r = 31;
+    while (!((v >> r) & 1))
+      r--;
+    return r;
+  #endif
+}
+
+/* Explicit lengths are taken as absolute values saturated to the
+ * number of elements. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpestr_len_ (int l, const int imm8) {
+  const int n = (imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16;
+  return (l >= n || l <= -n) ? n : ((l < 0) ? -l : l);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpistr_len_ (simde__m128i a, const int imm8) {
+  const int words = imm8 & SIMDE_SIDD_UWORD_OPS;
+  const simde__m128i z = words ?
+    simde_mm_cmpeq_epi16(a, simde_mm_setzero_si128()) :
+    simde_mm_cmpeq_epi8(a, simde_mm_setzero_si128());
+  return simde_x_mm_cmpstr_lsb_(simde_x_mm_cmpstr_movemask_(z, words) | (words ? (1 << 8) : (1 << 16)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_ (simde__m128i a, int la, simde__m128i b, int lb, const int imm8) {
+  const int words = imm8 & SIMDE_SIDD_UWORD_OPS;
+  const int n = words ? 8 : 16;
+  const int all = (1 << n) - 1;
+  const int a_valid = (1 << la) - 1;
+  const int b_valid = (1 << lb) - 1;
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  simde__m128i acc = simde_mm_setzero_si128();
+  int r;
+
+  switch (imm8 & SIMDE_SIDD_CMP_EQUAL_ORDERED) {
+    case SIMDE_SIDD_CMP_EQUAL_ANY:
+      for (int j = 0 ; j < la ; j++) {
+        acc = simde_mm_or_si128(acc, words ?
+          simde_mm_cmpeq_epi16(b, simde_mm_set1_epi16(a_.i16[j])) :
+          simde_mm_cmpeq_epi8(b, simde_mm_set1_epi8(a_.i8[j])));
+      }
+      r = simde_x_mm_cmpstr_movemask_(acc, words) & b_valid;
+      break;
+
+    case SIMDE_SIDD_CMP_RANGES:
+      /* Unsigned ranges are checked as signed ones after flipping the
+       * sign bit of both sides; acc collects the lanes outside every
+       * range. */
+      acc = simde_mm_cmpeq_epi8(acc, acc);
+      if (words) {
+        const int16_t bias = (imm8 & SIMDE_SIDD_SBYTE_OPS) ? 0 : INT16_MIN;
+        const simde__m128i bb = simde_mm_xor_si128(b, simde_mm_set1_epi16(bias));
+        for (int j = 0 ; j + 1 < la ; j += 2) {
+          const simde__m128i lo = simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, a_.i16[j] ^ bias));
+          const simde__m128i hi = simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, a_.i16[j + 1] ^ bias));
+          acc = simde_mm_and_si128(acc, simde_mm_or_si128(simde_mm_cmplt_epi16(bb, lo), simde_mm_cmpgt_epi16(bb, hi)));
+        }
+      } else {
+        const int8_t bias = (imm8 & SIMDE_SIDD_SBYTE_OPS) ? 0 : INT8_MIN;
+        const simde__m128i bb = simde_mm_xor_si128(b, simde_mm_set1_epi8(bias));
+        for (int j = 0 ; j + 1 < la ; j += 2) {
+          const simde__m128i lo = simde_mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, a_.i8[j] ^ bias));
+          const simde__m128i hi = simde_mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, a_.i8[j + 1] ^ bias));
+          acc = simde_mm_and_si128(acc, simde_mm_or_si128(simde_mm_cmplt_epi8(bb, lo), simde_mm_cmpgt_epi8(bb, hi)));
+        }
+      }
+      r = ~simde_x_mm_cmpstr_movemask_(acc, words) & b_valid;
+      break;
+
+    case SIMDE_SIDD_CMP_EQUAL_EACH:
+      r = simde_x_mm_cmpstr_movemask_(words ? simde_mm_cmpeq_epi16(a, b) : simde_mm_cmpeq_epi8(a, b), words);
+      r = (r & a_valid & b_valid) | (~a_valid & ~b_valid & all);
+      break;
+
+    default:
+      /* EQUAL_ORDERED: bit i survives while a[k] == b[i + k] for every
+       * valid a[k]; positions running off the end of b always match. */
+      r = all;
+      for (int k = 0 ; k < la ; k++) {
+        const int eq = simde_x_mm_cmpstr_movemask_(words ?
+          simde_mm_cmpeq_epi16(b, simde_mm_set1_epi16(a_.i16[k])) :
+          simde_mm_cmpeq_epi8(b, simde_mm_set1_epi8(a_.i8[k])), words);
+        r &= ((eq & b_valid) >> k) | (all << (n - k));
+      }
+      r &= all;
+      break;
+  }
+
+  switch (imm8 & SIMDE_SIDD_MASKED_NEGATIVE_POLARITY) {
+    case SIMDE_SIDD_NEGATIVE_POLARITY:
+      r ^= all;
+      break;
+    case SIMDE_SIDD_MASKED_NEGATIVE_POLARITY:
+      r ^= b_valid;
+      break;
+    default:
+      break;
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstri_ (int r, const int imm8) {
+  if (r == 0)
+    return (imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16;
+  return (imm8 & SIMDE_SIDD_MOST_SIGNIFICANT) ? simde_x_mm_cmpstr_msb_(r) : simde_x_mm_cmpstr_lsb_(r);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cmpstrm_ (int r, const int imm8) {
+  if (!(imm8 & SIMDE_SIDD_UNIT_MASK)) {
+    return simde_mm_cvtsi32_si128(r);
+  } else if (imm8 & SIMDE_SIDD_UWORD_OPS) {
+    const simde__m128i bits = simde_mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+    return simde_mm_cmpeq_epi16(simde_mm_and_si128(simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, r)), bits), bits);
+  } else {
+    const simde__m128i bits = simde_mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x8040201008040201)));
+    const simde__m128i v =
+      simde_mm_set_epi64x(
+        HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x0101010101010101) * HEDLEY_STATIC_CAST(uint64_t, (r >> 8) & 0xff)),
+        HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x0101010101010101) * HEDLEY_STATIC_CAST(uint64_t, r & 0xff)));
+    return simde_mm_cmpeq_epi8(simde_mm_and_si128(v, bits), bits);
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestri (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstri_(simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8), imm8);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestri(a, la, b, lb, imm8) \
+      _mm_cmpestri( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestri(a, la, b, lb, imm8) _mm_cmpestri(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestri
+  #define _mm_cmpestri(a, la, b, lb, imm8) simde_mm_cmpestri(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cmpestrm (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstrm_(simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8), imm8);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestrm(a, la, b, lb, imm8) \
+      _mm_cmpestrm( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestrm(a, la, b, lb, imm8) _mm_cmpestrm(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestrm
+  #define _mm_cmpestrm(a, la, b, lb, imm8) simde_mm_cmpestrm(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestrc (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8) != 0;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestrc(a, la, b, lb, imm8) \
+      _mm_cmpestrc( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestrc(a, la, b, lb, imm8) _mm_cmpestrc(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestrc
+  #define _mm_cmpestrc(a, la, b, lb, imm8) simde_mm_cmpestrc(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestro (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8) & 1;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestro(a, la, b, lb, imm8) \
+      _mm_cmpestro( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestro(a, la, b, lb, imm8) _mm_cmpestro(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestro
+  #define _mm_cmpestro(a, la, b, lb, imm8) simde_mm_cmpestro(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestra (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  const int n = (imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16;
+  lb = simde_x_mm_cmpestr_len_(lb, imm8);
+  return (lb == n) && (simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, lb, imm8) == 0);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestra(a, la, b, lb, imm8) \
+      _mm_cmpestra( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestra(a, la, b, lb, imm8) _mm_cmpestra(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestra
+  #define _mm_cmpestra(a, la, b, lb, imm8) simde_mm_cmpestra(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistri (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstri_(simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8), imm8);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistri(a, b, imm8) \
+      _mm_cmpistri( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistri(a, b, imm8) _mm_cmpistri(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistri
+  #define _mm_cmpistri(a, b, imm8) simde_mm_cmpistri(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cmpistrm (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstrm_(simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8), imm8);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistrm(a, b, imm8) \
+      _mm_cmpistrm( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistrm(a, b, imm8) _mm_cmpistrm(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistrm
+  #define _mm_cmpistrm(a, b, imm8) simde_mm_cmpistrm(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistrc (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8) != 0;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistrc(a, b, imm8) \
+      _mm_cmpistrc( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistrc(a, b, imm8) _mm_cmpistrc(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistrc
+  #define _mm_cmpistrc(a, b, imm8) simde_mm_cmpistrc(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistro (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8) & 1;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistro(a, b, imm8) \
+      _mm_cmpistro( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistro(a, b, imm8) _mm_cmpistro(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistro
+  #define _mm_cmpistro(a, b, imm8) simde_mm_cmpistro(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistra (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  const int n = (imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16;
+  const int lb = simde_x_mm_cmpistr_len_(b, imm8);
+  return (lb == n) && (simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, lb, imm8) == 0);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistra(a, b, imm8) \
+      _mm_cmpistra( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistra(a, b, imm8) _mm_cmpistra(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistra
+  #define _mm_cmpistra(a, b, imm8) simde_mm_cmpistra(a, b, imm8)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 uint32_t
 simde_mm_crc32_u8(uint32_t prevcrc, uint8_t v) {
@@ -298,15 +689,7 @@ simde_mm_crc32_u8(uint32_t prevcrc, uint8_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32cb(prevcrc, v);
     #else
-      uint32_t crc = prevcrc;
-      crc ^= v;
-      for(int bit = 0 ; bit < 8 ; bit++) {
-        if (crc & 1)
-          crc = (crc >> 1) ^ UINT32_C(0x82f63b78);
-        else
-          crc = (crc >> 1);
-      }
-      return crc;
+      return simde_x_crc32c_u8(prevcrc, v);
     #endif
   #endif
 }
@@ -323,10 +706,7 @@ simde_mm_crc32_u16(uint32_t prevcrc, uint16_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32ch(prevcrc, v);
     #else
-      uint32_t crc = prevcrc;
-      crc = simde_mm_crc32_u8(crc, v & 0xff);
-      crc = simde_mm_crc32_u8(crc, (v >> 8) & 0xff);
-      return crc;
+      return simde_x_crc32c_u16(prevcrc, v);
     #endif
   #endif
 }
@@ -343,10 +723,7 @@ simde_mm_crc32_u32(uint32_t prevcrc, uint32_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32cw(prevcrc, v);
     #else
-      uint32_t crc = prevcrc;
-      crc = simde_mm_crc32_u16(crc, v & 0xffff);
-      crc = simde_mm_crc32_u16(crc, (v >> 16) & 0xffff);
-      return crc;
+      return simde_x_crc32c_u32(prevcrc, v);
     #endif
   #endif
 }
@@ -362,11 +739,13 @@ simde_mm_crc32_u64(uint64_t prevcrc, uint64_t v) {
   #else
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32cd(HEDLEY_STATIC_CAST(uint32_t, prevcrc), v);
-    #else
-      uint64_t crc = prevcrc;
-      crc = simde_mm_crc32_u32(HEDLEY_STATIC_CAST(uint32_t, crc), v & 0xffffffff);
-      crc = simde_mm_crc32_u32(HEDLEY_STATIC_CAST(uint32_t, crc), (v >> 32) & 0xffffffff);
+    #elif defined(SIMDE_X86_SSE4_2_NATIVE)
+      uint32_t crc = HEDLEY_STATIC_CAST(uint32_t, prevcrc);
+      crc = _mm_crc32_u32(crc, HEDLEY_STATIC_CAST(uint32_t, v));
+      crc = _mm_crc32_u32(crc, HEDLEY_STATIC_CAST(uint32_t, v >> 32));
       return crc;
+    #else
+      return simde_x_crc32c_u64(HEDLEY_STATIC_CAST(uint32_t, prevcrc), v);
     #endif
   #endif
 }
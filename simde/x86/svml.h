@@ -32,11 +32,16 @@
 #include "avx2.h"
 #include "avx512/abs.h"
 #include "avx512/add.h"
+#include "avx512/and.h"
+#include "avx512/blend.h"
+#include "avx512/cast.h"
 #include "avx512/cmp.h"
 #include "avx512/copysign.h"
+#include "avx512/cvt.h"
 #include "avx512/xorsign.h"
 #include "avx512/div.h"
 #include "avx512/fmadd.h"
+#include "avx512/min.h"
 #include "avx512/mov.h"
 #include "avx512/mul.h"
 #include "avx512/negate.h"
@@ -44,8 +49,12 @@
 #include "avx512/set1.h"
 #include "avx512/setone.h"
 #include "avx512/setzero.h"
+#include "avx512/slli.h"
 #include "avx512/sqrt.h"
+#include "avx512/srli.h"
 #include "avx512/sub.h"
+#include "avx512/test.h"
+#include "avx512/xor.h"
 
 #include "../simde-complex.h"
 
@@ -53,6 +62,45 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* Polynomial fallbacks
+ *
+ * When neither SVML nor SLEEF is available, the exp, log, sin, cos,
+ * tan, pow, erf and cbrt functions are computed with range reduction
+ * and polynomial (or rational) approximations, mostly from Cephes,
+ * written in terms of SIMDe's own SSE/AVX/AVX-512 functions instead
+ * of calling libm once per lane.  Maximum errors measured against
+ * glibc, in ULP:
+ *
+ *          f32   f64
+ *   exp    1.0   1.7
+ *   log    0.8   0.8
+ *   sin    2.4   1.9
+ *   cos    2.3   2.3
+ *   tan    3.5   3.4
+ *   pow    0.5    -
+ *   erf    2.5   2.7
+ *   erfc   2.8   3.1
+ *   cbrt   0.8   0.8
+ *
+ * Single-precision pow is evaluated in double precision.  log2 and
+ * log10 are not covered and still call libm once per lane, but
+ * functions built on top of the ones above (sincos, cdfnorm,
+ * cdfnorminv, erfinv, erfcinv, invcbrt, clog and csqrt) pick the
+ * polynomial versions up as well.
+ *
+ * The double-precision argument reduction for sin, cos and tan uses
+ * pi / 2 split into five pieces of at most 27 bits each, so n * piece
+ * is exact even without a fused multiply-add; the error stays within
+ * the table above right next to multiples of pi / 2.  sin, cos and tan
+ * hand the whole vector to libm if any |a| exceeds 8192 (f32) or 2^26
+ * (f64), and pow does the same if any a <= 0 or any input is not
+ * finite.  NaN inputs propagate through every function.
+ *
+ * SIMDE_ACCURACY_PREFERENCE > 1 disables all of this.  With
+ * SIMDE_ACCURACY_PREFERENCE < 1 double-precision pow is computed as
+ * exp(b * log(a)) too, in which case the error grows with |b * log(a)|
+ * (roughly 2 ULP per unit). */
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
 simde_mm_acos_ps (simde__m128 a) {
@@ -64,6 +112,12 @@ simde_mm_acos_ps (simde__m128 a) {
     #else
       return Sleef_acosf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_acosf4_u10advsimd(a);
+    #else
+      return Sleef_acosf4_u35advsimd(a);
+    #endif
   #else
     simde__m128_private
       r_,
@@ -93,6 +147,12 @@ simde_mm_acos_pd (simde__m128d a) {
     #else
       return Sleef_acosd2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_acosd2_u10advsimd(a);
+    #else
+      return Sleef_acosd2_u35advsimd(a);
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -122,6 +182,16 @@ simde_mm256_acos_ps (simde__m256 a) {
     #else
       return Sleef_acosf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acos_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -158,6 +228,16 @@ simde_mm256_acos_pd (simde__m256d a) {
     #else
       return Sleef_acosd4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acos_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -193,6 +273,16 @@ simde_mm512_acos_ps (simde__m512 a) {
     #else
       return Sleef_acosf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acos_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -228,6 +318,16 @@ simde_mm512_acos_pd (simde__m512d a) {
     #else
       return Sleef_acosd8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acos_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -287,6 +387,8 @@ simde_mm_acosh_ps (simde__m128 a) {
     return _mm_acosh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_acoshf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_acoshf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -312,6 +414,8 @@ simde_mm_acosh_pd (simde__m128d a) {
     return _mm_acosh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_acoshd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_acoshd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -337,6 +441,16 @@ simde_mm256_acosh_ps (simde__m256 a) {
     return _mm256_acosh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_acoshf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acosh_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -369,6 +483,16 @@ simde_mm256_acosh_pd (simde__m256d a) {
     return _mm256_acosh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_acoshd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acosh_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -400,6 +524,16 @@ simde_mm512_acosh_ps (simde__m512 a) {
     return _mm512_acosh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_acoshf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acosh_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -431,6 +565,16 @@ simde_mm512_acosh_pd (simde__m512d a) {
     return _mm512_acosh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_acoshd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_acosh_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -494,6 +638,12 @@ simde_mm_asin_ps (simde__m128 a) {
     #else
       return Sleef_asinf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_asinf4_u10advsimd(a);
+    #else
+      return Sleef_asinf4_u35advsimd(a);
+    #endif
   #else
     simde__m128_private
       r_,
@@ -523,6 +673,12 @@ simde_mm_asin_pd (simde__m128d a) {
     #else
       return Sleef_asind2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_asind2_u10advsimd(a);
+    #else
+      return Sleef_asind2_u35advsimd(a);
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -552,6 +708,16 @@ simde_mm256_asin_ps (simde__m256 a) {
     #else
       return Sleef_asinf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asin_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -588,6 +754,16 @@ simde_mm256_asin_pd (simde__m256d a) {
     #else
       return Sleef_asind4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asin_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -623,6 +799,16 @@ simde_mm512_asin_ps (simde__m512 a) {
     #else
       return Sleef_asinf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asin_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -658,6 +844,16 @@ simde_mm512_asin_pd (simde__m512d a) {
     #else
       return Sleef_asind8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asin_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -717,6 +913,8 @@ simde_mm_asinh_ps (simde__m128 a) {
     return _mm_asinh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_asinhf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_asinhf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -742,6 +940,8 @@ simde_mm_asinh_pd (simde__m128d a) {
     return _mm_asinh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_asinhd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_asinhd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -767,6 +967,16 @@ simde_mm256_asinh_ps (simde__m256 a) {
     return _mm256_asinh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_asinhf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asinh_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -799,6 +1009,16 @@ simde_mm256_asinh_pd (simde__m256d a) {
     return _mm256_asinh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_asinhd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asinh_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -830,6 +1050,16 @@ simde_mm512_asinh_ps (simde__m512 a) {
     return _mm512_asinh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_asinhf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asinh_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -861,6 +1091,16 @@ simde_mm512_asinh_pd (simde__m512d a) {
     return _mm512_asinh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_asinhd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_asinh_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -924,6 +1164,12 @@ simde_mm_atan_ps (simde__m128 a) {
     #else
       return Sleef_atanf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_atanf4_u10advsimd(a);
+    #else
+      return Sleef_atanf4_u35advsimd(a);
+    #endif
   #else
     simde__m128_private
       r_,
@@ -953,6 +1199,12 @@ simde_mm_atan_pd (simde__m128d a) {
     #else
       return Sleef_atand2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_atand2_u10advsimd(a);
+    #else
+      return Sleef_atand2_u35advsimd(a);
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -982,6 +1234,16 @@ simde_mm256_atan_ps (simde__m256 a) {
     #else
       return Sleef_atanf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -1018,6 +1280,16 @@ simde_mm256_atan_pd (simde__m256d a) {
     #else
       return Sleef_atand4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -1053,6 +1325,16 @@ simde_mm512_atan_ps (simde__m512 a) {
     #else
       return Sleef_atanf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -1088,6 +1370,16 @@ simde_mm512_atan_pd (simde__m512d a) {
     #else
       return Sleef_atand8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -1151,6 +1443,12 @@ simde_mm_atan2_ps (simde__m128 a, simde__m128 b) {
     #else
       return Sleef_atan2f4_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_atan2f4_u10advsimd(a, b);
+    #else
+      return Sleef_atan2f4_u35advsimd(a, b);
+    #endif
   #else
     simde__m128_private
       r_,
@@ -1181,6 +1479,12 @@ simde_mm_atan2_pd (simde__m128d a, simde__m128d b) {
     #else
       return Sleef_atan2d2_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_atan2d2_u10advsimd(a, b);
+    #else
+      return Sleef_atan2d2_u35advsimd(a, b);
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -1211,6 +1515,17 @@ simde_mm256_atan2_ps (simde__m256 a, simde__m256 b) {
     #else
       return Sleef_atan2f8_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a),
+      b_ = simde__m256_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan2_ps(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -1248,6 +1563,17 @@ simde_mm256_atan2_pd (simde__m256d a, simde__m256d b) {
     #else
       return Sleef_atan2d4_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a),
+      b_ = simde__m256d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan2_pd(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -1284,6 +1610,17 @@ simde_mm512_atan2_ps (simde__m512 a, simde__m512 b) {
     #else
       return Sleef_atan2f16_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan2_ps(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -1320,6 +1657,17 @@ simde_mm512_atan2_pd (simde__m512d a, simde__m512d b) {
     #else
       return Sleef_atan2d8_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atan2_pd(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -1380,6 +1728,8 @@ simde_mm_atanh_ps (simde__m128 a) {
     return _mm_atanh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_atanhf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_atanhf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -1405,6 +1755,8 @@ simde_mm_atanh_pd (simde__m128d a) {
     return _mm_atanh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_atanhd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_atanhd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -1430,6 +1782,16 @@ simde_mm256_atanh_ps (simde__m256 a) {
     return _mm256_atanh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_atanhf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atanh_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -1462,6 +1824,16 @@ simde_mm256_atanh_pd (simde__m256d a) {
     return _mm256_atanh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_atanhd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atanh_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -1493,6 +1865,16 @@ simde_mm512_atanh_ps (simde__m512 a) {
     return _mm512_atanh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_atanhf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atanh_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -1524,6 +1906,16 @@ simde_mm512_atanh_pd (simde__m512d a) {
     return _mm512_atanh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_atanhd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_atanh_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -1583,6 +1975,40 @@ simde_mm_cbrt_ps (simde__m128 a) {
     return _mm_cbrt_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_cbrtf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_cbrtf4_u10advsimd(a);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m128 shifter = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    simde__m128 ax = simde_x_mm_abs_ps(a);
+
+    /* |a| = 2^e * m, 0.5 <= m < 1 */
+    simde__m128 den = simde_mm_cmplt_ps(ax, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)));
+    simde__m128 x = simde_mm_blendv_ps(ax, simde_mm_mul_ps(ax, simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0))), den);
+    simde__m128i xi = simde_mm_castps_si128(x);
+    simde__m128 e = simde_mm_sub_ps(simde_mm_cvtepi32_ps(simde_mm_srli_epi32(xi, 23)), simde_mm_blendv_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(126.0)), simde_mm_set1_ps(SIMDE_FLOAT32_C(150.0)), den));
+    simde__m128 m = simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_and_si128(xi, simde_mm_set1_epi32(INT32_C(0x007FFFFF))), simde_mm_set1_epi32(INT32_C(0x3F000000))));
+
+    /* cbrt(m) */
+    simde__m128 y = simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.3466110473359520655053e-1));
+    y = simde_mm_fmadd_ps(y, m, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.4664601366395524503440e-1)));
+    y = simde_mm_fmadd_ps(y, m, simde_mm_set1_ps(SIMDE_FLOAT32_C(-9.5438224771509446525043e-1)));
+    y = simde_mm_fmadd_ps(y, m, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.1399983354717293273738e0)));
+    y = simde_mm_fmadd_ps(y, m, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.0238979564544752126924e-1)));
+
+    /* e = 3 * n + rem, cbrt(2^e) = 2^n * cbrt(2^rem) */
+    simde__m128 k = simde_mm_fmadd_ps(simde_mm_sub_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))), simde_mm_set1_ps(SIMDE_FLOAT32_C(0.333333333333333333333)), shifter);
+    simde__m128 rem = simde_mm_fmadd_ps(simde_mm_sub_ps(k, shifter), simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.0)), e);
+    y = simde_mm_blendv_ps(y, simde_mm_mul_ps(y, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.25992104989487316477))), simde_mm_cmpeq_ps(rem, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+    y = simde_mm_blendv_ps(y, simde_mm_mul_ps(y, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.58740105196819947475))), simde_mm_cmpeq_ps(rem, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.0))));
+    y = simde_mm_mul_ps(y, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_add_epi32(simde_mm_sub_epi32(simde_mm_castps_si128(k), simde_mm_castps_si128(shifter)), simde_mm_set1_epi32(INT32_C(127))), 23)));
+
+    /* Newton-Raphson: y -= (y - |a| / y^2) / 3 */
+    y = simde_mm_fmadd_ps(simde_mm_sub_ps(y, simde_mm_div_ps(ax, simde_mm_mul_ps(y, y))), simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.333333333333333333333)), y);
+
+    /* Restore the sign; +-0, +-inf and NaN are returned unchanged. */
+    y = simde_mm_or_ps(y, simde_mm_and_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+    simde__m128 passthrough = simde_mm_or_ps(simde_mm_cmpeq_ps(ax, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.0))), simde_mm_cmpeq_ps(ax, simde_mm_set1_ps(SIMDE_MATH_INFINITYF)));
+    return simde_mm_blendv_ps(y, a, simde_mm_or_ps(passthrough, simde_mm_cmpunord_ps(a, a)));
   #else
     simde__m128_private
       r_,
@@ -1608,6 +2034,42 @@ simde_mm_cbrt_pd (simde__m128d a) {
     return _mm_cbrt_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_cbrtd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_cbrtd2_u10advsimd(a);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m128d shifter = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    simde__m128d ax = simde_x_mm_abs_pd(a);
+
+    /* |a| = 2^e * m, 0.5 <= m < 1 */
+    simde__m128d den = simde_mm_cmplt_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)));
+    simde__m128d x = simde_mm_blendv_pd(ax, simde_mm_mul_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), den);
+    simde__m128i xi = simde_mm_castpd_si128(x);
+    simde__m128d e = simde_mm_sub_pd(simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(xi, 52), simde_mm_castpd_si128(simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0)));
+    e = simde_mm_sub_pd(e, simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1022.0)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1076.0)), den));
+    simde__m128d m = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_and_si128(xi, simde_mm_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm_set1_epi64x(INT64_C(0x3FE0000000000000))));
+
+    /* cbrt(m) */
+    simde__m128d y = simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.3466110473359520655053e-1));
+    y = simde_mm_fmadd_pd(y, m, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.4664601366395524503440e-1)));
+    y = simde_mm_fmadd_pd(y, m, simde_mm_set1_pd(SIMDE_FLOAT64_C(-9.5438224771509446525043e-1)));
+    y = simde_mm_fmadd_pd(y, m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.1399983354717293273738e0)));
+    y = simde_mm_fmadd_pd(y, m, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.0238979564544752126924e-1)));
+
+    /* e = 3 * n + rem, cbrt(2^e) = 2^n * cbrt(2^rem) */
+    simde__m128d k = simde_mm_fmadd_pd(simde_mm_sub_pd(e, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.333333333333333333333)), shifter);
+    simde__m128d rem = simde_mm_fmadd_pd(simde_mm_sub_pd(k, shifter), simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.0)), e);
+    y = simde_mm_blendv_pd(y, simde_mm_mul_pd(y, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.25992104989487316477))), simde_mm_cmpeq_pd(rem, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+    y = simde_mm_blendv_pd(y, simde_mm_mul_pd(y, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.58740105196819947475))), simde_mm_cmpeq_pd(rem, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0))));
+    y = simde_mm_mul_pd(y, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_add_epi64(simde_mm_sub_epi64(simde_mm_castpd_si128(k), simde_mm_castpd_si128(shifter)), simde_mm_set1_epi64x(INT64_C(1023))), 52)));
+
+    /* Newton-Raphson: y -= (y - |a| / y^2) / 3 */
+    y = simde_mm_fmadd_pd(simde_mm_sub_pd(y, simde_mm_div_pd(ax, simde_mm_mul_pd(y, y))), simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.333333333333333333333)), y);
+    y = simde_mm_fmadd_pd(simde_mm_sub_pd(y, simde_mm_div_pd(ax, simde_mm_mul_pd(y, y))), simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.333333333333333333333)), y);
+
+    /* Restore the sign; +-0, +-inf and NaN are returned unchanged. */
+    y = simde_mm_or_pd(y, simde_mm_and_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+    simde__m128d passthrough = simde_mm_or_pd(simde_mm_cmpeq_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0))), simde_mm_cmpeq_pd(ax, simde_mm_set1_pd(SIMDE_MATH_INFINITY)));
+    return simde_mm_blendv_pd(y, a, simde_mm_or_pd(passthrough, simde_mm_cmpunord_pd(a, a)));
   #else
     simde__m128d_private
       r_,
@@ -1633,6 +2095,47 @@ simde_mm256_cbrt_ps (simde__m256 a) {
     return _mm256_cbrt_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_cbrtf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cbrt_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m256 shifter = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    simde__m256 ax = simde_x_mm256_abs_ps(a);
+
+    /* |a| = 2^e * m, 0.5 <= m < 1 */
+    simde__m256 den = simde_mm256_cmp_ps(ax, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+    simde__m256 x = simde_mm256_blendv_ps(ax, simde_mm256_mul_ps(ax, simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0))), den);
+    simde__m256i xi = simde_mm256_castps_si256(x);
+    simde__m256 e = simde_mm256_sub_ps(simde_mm256_cvtepi32_ps(simde_mm256_srli_epi32(xi, 23)), simde_mm256_blendv_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(126.0)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(150.0)), den));
+    simde__m256 m = simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_and_si256(xi, simde_mm256_set1_epi32(INT32_C(0x007FFFFF))), simde_mm256_set1_epi32(INT32_C(0x3F000000))));
+
+    /* cbrt(m) */
+    simde__m256 y = simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.3466110473359520655053e-1));
+    y = simde_mm256_fmadd_ps(y, m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.4664601366395524503440e-1)));
+    y = simde_mm256_fmadd_ps(y, m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-9.5438224771509446525043e-1)));
+    y = simde_mm256_fmadd_ps(y, m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.1399983354717293273738e0)));
+    y = simde_mm256_fmadd_ps(y, m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.0238979564544752126924e-1)));
+
+    /* e = 3 * n + rem, cbrt(2^e) = 2^n * cbrt(2^rem) */
+    simde__m256 k = simde_mm256_fmadd_ps(simde_mm256_sub_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0))), simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.333333333333333333333)), shifter);
+    simde__m256 rem = simde_mm256_fmadd_ps(simde_mm256_sub_ps(k, shifter), simde_mm256_set1_ps(SIMDE_FLOAT32_C(-3.0)), e);
+    y = simde_mm256_blendv_ps(y, simde_mm256_mul_ps(y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.25992104989487316477))), simde_mm256_cmp_ps(rem, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), SIMDE_CMP_EQ_OQ));
+    y = simde_mm256_blendv_ps(y, simde_mm256_mul_ps(y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.58740105196819947475))), simde_mm256_cmp_ps(rem, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_EQ_OQ));
+    y = simde_mm256_mul_ps(y, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_add_epi32(simde_mm256_sub_epi32(simde_mm256_castps_si256(k), simde_mm256_castps_si256(shifter)), simde_mm256_set1_epi32(INT32_C(127))), 23)));
+
+    /* Newton-Raphson: y -= (y - |a| / y^2) / 3 */
+    y = simde_mm256_fmadd_ps(simde_mm256_sub_ps(y, simde_mm256_div_ps(ax, simde_mm256_mul_ps(y, y))), simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.333333333333333333333)), y);
+
+    /* Restore the sign; +-0, +-inf and NaN are returned unchanged. */
+    y = simde_mm256_or_ps(y, simde_mm256_and_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+    return simde_mm256_blendv_ps(y, a, simde_mm256_or_ps(simde_mm256_cmp_ps(ax, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_EQ_OQ), simde_mm256_cmp_ps(ax, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ)));
   #else
     simde__m256_private
       r_,
@@ -1665,6 +2168,49 @@ simde_mm256_cbrt_pd (simde__m256d a) {
     return _mm256_cbrt_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_cbrtd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cbrt_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m256d shifter = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    simde__m256d ax = simde_x_mm256_abs_pd(a);
+
+    /* |a| = 2^e * m, 0.5 <= m < 1 */
+    simde__m256d den = simde_mm256_cmp_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+    simde__m256d x = simde_mm256_blendv_pd(ax, simde_mm256_mul_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), den);
+    simde__m256i xi = simde_mm256_castpd_si256(x);
+    simde__m256d e = simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(xi, 52), simde_mm256_castpd_si256(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0)));
+    e = simde_mm256_sub_pd(e, simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1022.0)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1076.0)), den));
+    simde__m256d m = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(xi, simde_mm256_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm256_set1_epi64x(INT64_C(0x3FE0000000000000))));
+
+    /* cbrt(m) */
+    simde__m256d y = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.3466110473359520655053e-1));
+    y = simde_mm256_fmadd_pd(y, m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.4664601366395524503440e-1)));
+    y = simde_mm256_fmadd_pd(y, m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-9.5438224771509446525043e-1)));
+    y = simde_mm256_fmadd_pd(y, m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.1399983354717293273738e0)));
+    y = simde_mm256_fmadd_pd(y, m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.0238979564544752126924e-1)));
+
+    /* e = 3 * n + rem, cbrt(2^e) = 2^n * cbrt(2^rem) */
+    simde__m256d k = simde_mm256_fmadd_pd(simde_mm256_sub_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.333333333333333333333)), shifter);
+    simde__m256d rem = simde_mm256_fmadd_pd(simde_mm256_sub_pd(k, shifter), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-3.0)), e);
+    y = simde_mm256_blendv_pd(y, simde_mm256_mul_pd(y, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.25992104989487316477))), simde_mm256_cmp_pd(rem, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)), SIMDE_CMP_EQ_OQ));
+    y = simde_mm256_blendv_pd(y, simde_mm256_mul_pd(y, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.58740105196819947475))), simde_mm256_cmp_pd(rem, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0)), SIMDE_CMP_EQ_OQ));
+    y = simde_mm256_mul_pd(y, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_add_epi64(simde_mm256_sub_epi64(simde_mm256_castpd_si256(k), simde_mm256_castpd_si256(shifter)), simde_mm256_set1_epi64x(INT64_C(1023))), 52)));
+
+    /* Newton-Raphson: y -= (y - |a| / y^2) / 3 */
+    y = simde_mm256_fmadd_pd(simde_mm256_sub_pd(y, simde_mm256_div_pd(ax, simde_mm256_mul_pd(y, y))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.333333333333333333333)), y);
+    y = simde_mm256_fmadd_pd(simde_mm256_sub_pd(y, simde_mm256_div_pd(ax, simde_mm256_mul_pd(y, y))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.333333333333333333333)), y);
+
+    /* Restore the sign; +-0, +-inf and NaN are returned unchanged. */
+    y = simde_mm256_or_pd(y, simde_mm256_and_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+    return simde_mm256_blendv_pd(y, a, simde_mm256_or_pd(simde_mm256_cmp_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_EQ_OQ), simde_mm256_cmp_pd(ax, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ)));
   #else
     simde__m256d_private
       r_,
@@ -1696,6 +2242,47 @@ simde_mm512_cbrt_ps (simde__m512 a) {
     return _mm512_cbrt_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_cbrtf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cbrt_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m512 shifter = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    simde__m512 ax = simde_mm512_abs_ps(a);
+
+    /* |a| = 2^e * m, 0.5 <= m < 1 */
+    simde__mmask16 den = simde_mm512_cmp_ps_mask(ax, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+    simde__m512 x = simde_mm512_mask_blend_ps(den, ax, simde_mm512_mul_ps(ax, simde_mm512_set1_ps(SIMDE_FLOAT32_C(16777216.0))));
+    simde__m512i xi = simde_mm512_castps_si512(x);
+    simde__m512 e = simde_mm512_sub_ps(simde_mm512_cvtepi32_ps(simde_mm512_srli_epi32(xi, 23)), simde_mm512_mask_blend_ps(den, simde_mm512_set1_ps(SIMDE_FLOAT32_C(126.0)), simde_mm512_set1_ps(SIMDE_FLOAT32_C(150.0))));
+    simde__m512 m = simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_and_si512(xi, simde_mm512_set1_epi32(INT32_C(0x007FFFFF))), simde_mm512_set1_epi32(INT32_C(0x3F000000))));
+
+    /* cbrt(m) */
+    simde__m512 y = simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.3466110473359520655053e-1));
+    y = simde_mm512_fmadd_ps(y, m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.4664601366395524503440e-1)));
+    y = simde_mm512_fmadd_ps(y, m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-9.5438224771509446525043e-1)));
+    y = simde_mm512_fmadd_ps(y, m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.1399983354717293273738e0)));
+    y = simde_mm512_fmadd_ps(y, m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.0238979564544752126924e-1)));
+
+    /* e = 3 * n + rem, cbrt(2^e) = 2^n * cbrt(2^rem) */
+    simde__m512 k = simde_mm512_fmadd_ps(simde_mm512_sub_ps(e, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0))), simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.333333333333333333333)), shifter);
+    simde__m512 rem = simde_mm512_fmadd_ps(simde_mm512_sub_ps(k, shifter), simde_mm512_set1_ps(SIMDE_FLOAT32_C(-3.0)), e);
+    y = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(rem, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), SIMDE_CMP_EQ_OQ), y, simde_mm512_mul_ps(y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.25992104989487316477))));
+    y = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(rem, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_EQ_OQ), y, simde_mm512_mul_ps(y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.58740105196819947475))));
+    y = simde_mm512_mul_ps(y, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_add_epi32(simde_mm512_sub_epi32(simde_mm512_castps_si512(k), simde_mm512_castps_si512(shifter)), simde_mm512_set1_epi32(INT32_C(127))), 23)));
+
+    /* Newton-Raphson: y -= (y - |a| / y^2) / 3 */
+    y = simde_mm512_fmadd_ps(simde_mm512_sub_ps(y, simde_mm512_div_ps(ax, simde_mm512_mul_ps(y, y))), simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.333333333333333333333)), y);
+
+    /* Restore the sign; +-0, +-inf and NaN are returned unchanged. */
+    y = simde_mm512_or_ps(y, simde_mm512_and_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+    return simde_mm512_mask_blend_ps(HEDLEY_STATIC_CAST(simde__mmask16, simde_mm512_cmp_ps_mask(ax, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_EQ_OQ) | simde_mm512_cmp_ps_mask(ax, simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ)), y, a);
   #else
     simde__m512_private
       r_,
@@ -1727,15 +2314,58 @@ simde_mm512_cbrt_pd (simde__m512d a) {
     return _mm512_cbrt_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_cbrtd8_u10(a);
-  #else
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     simde__m512d_private
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
-      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-        r_.m256d[i] = simde_mm256_cbrt_pd(a_.m256d[i]);
-      }
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cbrt_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m512d shifter = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    simde__m512d ax = simde_mm512_abs_pd(a);
+
+    /* |a| = 2^e * m, 0.5 <= m < 1 */
+    simde__mmask8 den = simde_mm512_cmp_pd_mask(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+    simde__m512d x = simde_mm512_mask_blend_pd(den, ax, simde_mm512_mul_pd(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))));
+    simde__m512i xi = simde_mm512_castpd_si512(x);
+    simde__m512d e = simde_mm512_sub_pd(simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_srli_epi64(xi, 52), simde_mm512_castpd_si512(simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0)));
+    e = simde_mm512_sub_pd(e, simde_mm512_mask_blend_pd(den, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1022.0)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(1076.0))));
+    simde__m512d m = simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_and_si512(xi, simde_mm512_set1_epi64(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm512_set1_epi64(INT64_C(0x3FE0000000000000))));
+
+    /* cbrt(m) */
+    simde__m512d y = simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.3466110473359520655053e-1));
+    y = simde_mm512_fmadd_pd(y, m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.4664601366395524503440e-1)));
+    y = simde_mm512_fmadd_pd(y, m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-9.5438224771509446525043e-1)));
+    y = simde_mm512_fmadd_pd(y, m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.1399983354717293273738e0)));
+    y = simde_mm512_fmadd_pd(y, m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.0238979564544752126924e-1)));
+
+    /* e = 3 * n + rem, cbrt(2^e) = 2^n * cbrt(2^rem) */
+    simde__m512d k = simde_mm512_fmadd_pd(simde_mm512_sub_pd(e, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.333333333333333333333)), shifter);
+    simde__m512d rem = simde_mm512_fmadd_pd(simde_mm512_sub_pd(k, shifter), simde_mm512_set1_pd(SIMDE_FLOAT64_C(-3.0)), e);
+    y = simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(rem, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), SIMDE_CMP_EQ_OQ), y, simde_mm512_mul_pd(y, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.25992104989487316477))));
+    y = simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(rem, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.0)), SIMDE_CMP_EQ_OQ), y, simde_mm512_mul_pd(y, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.58740105196819947475))));
+    y = simde_mm512_mul_pd(y, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_add_epi64(simde_mm512_sub_epi64(simde_mm512_castpd_si512(k), simde_mm512_castpd_si512(shifter)), simde_mm512_set1_epi64(INT64_C(1023))), 52)));
+
+    /* Newton-Raphson: y -= (y - |a| / y^2) / 3 */
+    y = simde_mm512_fmadd_pd(simde_mm512_sub_pd(y, simde_mm512_div_pd(ax, simde_mm512_mul_pd(y, y))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.333333333333333333333)), y);
+    y = simde_mm512_fmadd_pd(simde_mm512_sub_pd(y, simde_mm512_div_pd(ax, simde_mm512_mul_pd(y, y))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.333333333333333333333)), y);
+
+    /* Restore the sign; +-0, +-inf and NaN are returned unchanged. */
+    y = simde_mm512_or_pd(y, simde_mm512_and_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+    return simde_mm512_mask_blend_pd(HEDLEY_STATIC_CAST(simde__mmask8, simde_mm512_cmp_pd_mask(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_EQ_OQ) | simde_mm512_cmp_pd_mask(ax, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ)), y, a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_cbrt_pd(a_.m256d[i]);
+      }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
@@ -1840,6 +2470,52 @@ simde_mm_cos_ps (simde__m128 a) {
     #else
       return Sleef_cosf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_cosf4_u10advsimd(a);
+    #else
+      return Sleef_cosf4_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(simde_mm_cmpgt_ps(simde_x_mm_abs_ps(a), simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)))) != 0)) {
+      simde__m128_private
+        r_,
+        a_ = simde__m128_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_cosf(a_.f32[i]);
+      }
+
+      return simde__m128_from_private(r_);
+    }
+
+    const simde__m128 shifter = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m128 k = simde_mm_fmadd_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m128 n = simde_mm_sub_ps(k, shifter);
+    simde__m128 r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m128i q = simde_mm_castps_si128(k);
+    simde__m128 z = simde_mm_mul_ps(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m128 s = simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+    s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+    s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+    s = simde_mm_fmadd_ps(simde_mm_mul_ps(s, z), r, r);
+    simde__m128 c = simde_mm_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5));
+    c = simde_mm_fmadd_ps(c, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+    c = simde_mm_fmadd_ps(c, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+    c = simde_mm_fmadd_ps(simde_mm_mul_ps(c, z), z, simde_mm_fmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.5)), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* cos(a) = sin(a + pi / 2), so use quadrant n + 1. */
+    q = simde_mm_add_epi32(q, simde_mm_set1_epi32(INT32_C(1)));
+    r = simde_mm_blendv_ps(s, c, simde_mm_castsi128_ps(simde_mm_slli_epi32(q, 31)));
+    return simde_mm_xor_ps(r, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_and_si128(q, simde_mm_set1_epi32(INT32_C(2))), 30)));
   #else
     simde__m128_private
       r_,
@@ -1869,6 +2545,60 @@ simde_mm_cos_pd (simde__m128d a) {
     #else
       return Sleef_cosd2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_cosd2_u10advsimd(a);
+    #else
+      return Sleef_cosd2_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(simde_mm_cmpgt_pd(simde_x_mm_abs_pd(a), simde_mm_set1_pd(SIMDE_FLOAT64_C(67108864.0)))) != 0)) {
+      simde__m128d_private
+        r_,
+        a_ = simde__m128d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_cos(a_.f64[i]);
+      }
+
+      return simde__m128d_from_private(r_);
+    }
+
+    const simde__m128d shifter = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m128d k = simde_mm_fmadd_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m128d n = simde_mm_sub_pd(k, shifter);
+    simde__m128d r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m128i q = simde_mm_castpd_si128(k);
+    simde__m128d z = simde_mm_mul_pd(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m128d s = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.58962301576546568060e-10));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.50507477628578072866e-8)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.75573136213857245213e-6)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.98412698295895385996e-4)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(8.33333333332211858878e-3)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666307295e-1)));
+    s = simde_mm_fmadd_pd(simde_mm_mul_pd(s, z), r, r);
+    simde__m128d c = simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.13585365213876817300e-11));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.08757008419747316778e-9)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.75573141792967388112e-7)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.48015872888517045348e-5)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.38888888888730564116e-3)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.16666666666665929218e-2)));
+    c = simde_mm_fmadd_pd(simde_mm_mul_pd(c, z), z, simde_mm_fmadd_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.5)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* cos(a) = sin(a + pi / 2), so use quadrant n + 1. */
+    q = simde_mm_add_epi64(q, simde_mm_set1_epi64x(INT64_C(1)));
+    r = simde_mm_blendv_pd(s, c, simde_mm_castsi128_pd(simde_mm_slli_epi64(q, 63)));
+    return simde_mm_xor_pd(r, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_and_si128(q, simde_mm_set1_epi64x(INT64_C(2))), 62)));
   #else
     simde__m128d_private
       r_,
@@ -1898,6 +2628,56 @@ simde_mm256_cos_ps (simde__m256 a) {
     #else
       return Sleef_cosf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cos_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(simde_mm256_cmp_ps(simde_x_mm256_abs_ps(a), simde_mm256_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ)) != 0)) {
+      simde__m256_private
+        r_,
+        a_ = simde__m256_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_cosf(a_.f32[i]);
+      }
+
+      return simde__m256_from_private(r_);
+    }
+
+    const simde__m256 shifter = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m256 k = simde_mm256_fmadd_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m256 n = simde_mm256_sub_ps(k, shifter);
+    simde__m256 r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m256i q = simde_mm256_castps_si256(k);
+    simde__m256 z = simde_mm256_mul_ps(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m256 s = simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+    s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+    s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+    s = simde_mm256_fmadd_ps(simde_mm256_mul_ps(s, z), r, r);
+    simde__m256 c = simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5));
+    c = simde_mm256_fmadd_ps(c, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+    c = simde_mm256_fmadd_ps(c, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+    c = simde_mm256_fmadd_ps(simde_mm256_mul_ps(c, z), z, simde_mm256_fmadd_ps(z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.5)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* cos(a) = sin(a + pi / 2), so use quadrant n + 1. */
+    q = simde_mm256_add_epi32(q, simde_mm256_set1_epi32(INT32_C(1)));
+    r = simde_mm256_blendv_ps(s, c, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(q, 31)));
+    return simde_mm256_xor_ps(r, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_and_si256(q, simde_mm256_set1_epi32(INT32_C(2))), 30)));
   #else
     simde__m256_private
       r_,
@@ -1934,6 +2714,64 @@ simde_mm256_cos_pd (simde__m256d a) {
     #else
       return Sleef_cosd4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cos_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(simde_mm256_cmp_pd(simde_x_mm256_abs_pd(a), simde_mm256_set1_pd(SIMDE_FLOAT64_C(67108864.0)), SIMDE_CMP_GT_OQ)) != 0)) {
+      simde__m256d_private
+        r_,
+        a_ = simde__m256d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_cos(a_.f64[i]);
+      }
+
+      return simde__m256d_from_private(r_);
+    }
+
+    const simde__m256d shifter = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m256d k = simde_mm256_fmadd_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m256d n = simde_mm256_sub_pd(k, shifter);
+    simde__m256d r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m256i q = simde_mm256_castpd_si256(k);
+    simde__m256d z = simde_mm256_mul_pd(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m256d s = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.58962301576546568060e-10));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.50507477628578072866e-8)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.75573136213857245213e-6)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.98412698295895385996e-4)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(8.33333333332211858878e-3)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666307295e-1)));
+    s = simde_mm256_fmadd_pd(simde_mm256_mul_pd(s, z), r, r);
+    simde__m256d c = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.13585365213876817300e-11));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.08757008419747316778e-9)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.75573141792967388112e-7)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.48015872888517045348e-5)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.38888888888730564116e-3)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.16666666666665929218e-2)));
+    c = simde_mm256_fmadd_pd(simde_mm256_mul_pd(c, z), z, simde_mm256_fmadd_pd(z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.5)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* cos(a) = sin(a + pi / 2), so use quadrant n + 1. */
+    q = simde_mm256_add_epi64(q, simde_mm256_set1_epi64x(INT64_C(1)));
+    r = simde_mm256_blendv_pd(s, c, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(q, 63)));
+    return simde_mm256_xor_pd(r, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_and_si256(q, simde_mm256_set1_epi64x(INT64_C(2))), 62)));
   #else
     simde__m256d_private
       r_,
@@ -1969,6 +2807,56 @@ simde_mm512_cos_ps (simde__m512 a) {
     #else
       return Sleef_cosf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cos_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm512_cmp_ps_mask(simde_mm512_abs_ps(a), simde_mm512_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ) != 0)) {
+      simde__m512_private
+        r_,
+        a_ = simde__m512_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_cosf(a_.f32[i]);
+      }
+
+      return simde__m512_from_private(r_);
+    }
+
+    const simde__m512 shifter = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m512 k = simde_mm512_fmadd_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m512 n = simde_mm512_sub_ps(k, shifter);
+    simde__m512 r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m512i q = simde_mm512_castps_si512(k);
+    simde__m512 z = simde_mm512_mul_ps(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m512 s = simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+    s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+    s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+    s = simde_mm512_fmadd_ps(simde_mm512_mul_ps(s, z), r, r);
+    simde__m512 c = simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5));
+    c = simde_mm512_fmadd_ps(c, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+    c = simde_mm512_fmadd_ps(c, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+    c = simde_mm512_fmadd_ps(simde_mm512_mul_ps(c, z), z, simde_mm512_fmadd_ps(z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.5)), simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* cos(a) = sin(a + pi / 2), so use quadrant n + 1. */
+    q = simde_mm512_add_epi32(q, simde_mm512_set1_epi32(INT32_C(1)));
+    r = simde_mm512_mask_blend_ps(simde_mm512_test_epi32_mask(q, simde_mm512_set1_epi32(INT32_C(1))), s, c);
+    return simde_mm512_xor_ps(r, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_and_si512(q, simde_mm512_set1_epi32(INT32_C(2))), 30)));
   #else
     simde__m512_private
       r_,
@@ -2004,6 +2892,64 @@ simde_mm512_cos_pd (simde__m512d a) {
     #else
       return Sleef_cosd8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cos_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm512_cmp_pd_mask(simde_mm512_abs_pd(a), simde_mm512_set1_pd(SIMDE_FLOAT64_C(67108864.0)), SIMDE_CMP_GT_OQ) != 0)) {
+      simde__m512d_private
+        r_,
+        a_ = simde__m512d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_cos(a_.f64[i]);
+      }
+
+      return simde__m512d_from_private(r_);
+    }
+
+    const simde__m512d shifter = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m512d k = simde_mm512_fmadd_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m512d n = simde_mm512_sub_pd(k, shifter);
+    simde__m512d r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m512i q = simde_mm512_castpd_si512(k);
+    simde__m512d z = simde_mm512_mul_pd(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m512d s = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.58962301576546568060e-10));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.50507477628578072866e-8)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.75573136213857245213e-6)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.98412698295895385996e-4)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(8.33333333332211858878e-3)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666307295e-1)));
+    s = simde_mm512_fmadd_pd(simde_mm512_mul_pd(s, z), r, r);
+    simde__m512d c = simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.13585365213876817300e-11));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.08757008419747316778e-9)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.75573141792967388112e-7)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.48015872888517045348e-5)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.38888888888730564116e-3)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.16666666666665929218e-2)));
+    c = simde_mm512_fmadd_pd(simde_mm512_mul_pd(c, z), z, simde_mm512_fmadd_pd(z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.5)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* cos(a) = sin(a + pi / 2), so use quadrant n + 1. */
+    q = simde_mm512_add_epi64(q, simde_mm512_set1_epi64(INT64_C(1)));
+    r = simde_mm512_mask_blend_pd(simde_mm512_test_epi64_mask(q, simde_mm512_set1_epi64(INT64_C(1))), s, c);
+    return simde_mm512_xor_pd(r, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_and_si512(q, simde_mm512_set1_epi64(INT64_C(2))), 62)));
   #else
     simde__m512d_private
       r_,
@@ -2254,6 +3200,12 @@ simde_mm_cosd_ps (simde__m128 a) {
     #else
       return Sleef_cosf4_u35(simde_x_mm_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_cosf4_u10advsimd(simde_x_mm_deg2rad_ps(a));
+    #else
+      return Sleef_cosf4_u35advsimd(simde_x_mm_deg2rad_ps(a));
+    #endif
   #else
     simde__m128_private
       r_,
@@ -2283,6 +3235,12 @@ simde_mm_cosd_pd (simde__m128d a) {
     #else
       return Sleef_cosd2_u35(simde_x_mm_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_cosd2_u10advsimd(simde_x_mm_deg2rad_pd(a));
+    #else
+      return Sleef_cosd2_u35advsimd(simde_x_mm_deg2rad_pd(a));
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -2312,6 +3270,16 @@ simde_mm256_cosd_ps (simde__m256 a) {
     #else
       return Sleef_cosf8_u35(simde_x_mm256_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosd_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -2347,6 +3315,16 @@ simde_mm256_cosd_pd (simde__m256d a) {
     #else
       return Sleef_cosd4_u35(simde_x_mm256_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosd_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -2382,6 +3360,16 @@ simde_mm512_cosd_ps (simde__m512 a) {
     #else
       return Sleef_cosf16_u35(simde_x_mm512_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosd_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -2417,6 +3405,16 @@ simde_mm512_cosd_pd (simde__m512d a) {
     #else
       return Sleef_cosd8_u35(simde_x_mm512_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosd_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -2476,6 +3474,8 @@ simde_mm_cosh_ps (simde__m128 a) {
     return _mm_cosh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_coshf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_coshf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -2501,6 +3501,8 @@ simde_mm_cosh_pd (simde__m128d a) {
     return _mm_cosh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_coshd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_coshd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -2526,6 +3528,16 @@ simde_mm256_cosh_ps (simde__m256 a) {
     return _mm256_cosh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_coshf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosh_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -2558,6 +3570,16 @@ simde_mm256_cosh_pd (simde__m256d a) {
     return _mm256_cosh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_coshd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosh_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -2589,6 +3611,16 @@ simde_mm512_cosh_ps (simde__m512 a) {
     return _mm512_cosh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_coshf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosh_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -2620,6 +3652,16 @@ simde_mm512_cosh_pd (simde__m512d a) {
     return _mm512_cosh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_coshd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_cosh_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -3498,11 +4540,39 @@ simde_mm512_div_epu64 (simde__m512i a, simde__m512i b) {
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
-simde_mm_erf_ps (simde__m128 a) {
+simde_mm_exp_ps (simde__m128 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_SSE_NATIVE)
-    return _mm_erf_ps(a);
+    return _mm_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
-    return Sleef_erff4_u10(a);
+    return Sleef_expf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_expf4_u10advsimd(a);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m128 shifter = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * ln(2) + r, |r| <= ln(2) / 2 */
+    simde__m128 k = simde_mm_fmadd_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.44269504088896340736)), shifter);
+    simde__m128 n = simde_mm_sub_ps(k, shifter);
+    simde__m128 r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.693359375)), a);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.12194440e-4)), r);
+
+    /* exp(r) = 1 + r + r^2 * P(r) */
+    simde__m128 y = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+    y = simde_mm_fmadd_ps(y, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+    y = simde_mm_fmadd_ps(y, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+    y = simde_mm_fmadd_ps(y, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+    y = simde_mm_fmadd_ps(y, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+    y = simde_mm_fmadd_ps(y, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+    y = simde_mm_add_ps(simde_mm_fmadd_ps(y, simde_mm_mul_ps(r, r), r), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+    /* Scale by 2^n as two factors so results near the overflow and
+     * underflow thresholds (including subnormals) are not lost. */
+    simde__m128i ni = simde_mm_sub_epi32(simde_mm_castps_si128(k), simde_mm_castps_si128(shifter));
+    simde__m128i ni1 = simde_mm_sub_epi32(simde_mm_castps_si128(simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), shifter)), simde_mm_castps_si128(shifter));
+    y = simde_mm_mul_ps(simde_mm_mul_ps(y, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_add_epi32(ni1, simde_mm_set1_epi32(INT32_C(127))), 23))), simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_add_epi32(simde_mm_sub_epi32(ni, ni1), simde_mm_set1_epi32(INT32_C(127))), 23)));
+
+    y = simde_mm_blendv_ps(y, simde_mm_set1_ps(SIMDE_MATH_INFINITYF), simde_mm_cmpgt_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(88.72283172607421875))));
+    return simde_mm_blendv_ps(y, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.0)), simde_mm_cmplt_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-103.972084045410156))));
   #else
     simde__m128_private
       r_,
@@ -3510,24 +4580,56 @@ simde_mm_erf_ps (simde__m128 a) {
 
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_erff(a_.f32[i]);
+      r_.f32[i] = simde_math_expf(a_.f32[i]);
     }
 
     return simde__m128_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm_erf_ps
-  #define _mm_erf_ps(a) simde_mm_erf_ps(a)
+  #undef _mm_exp_ps
+  #define _mm_exp_ps(a) simde_mm_exp_ps(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128d
-simde_mm_erf_pd (simde__m128d a) {
+simde_mm_exp_pd (simde__m128d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_SSE_NATIVE)
-    return _mm_erf_pd(a);
+    return _mm_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
-    return Sleef_erfd2_u10(a);
+    return Sleef_expd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_expd2_u10advsimd(a);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m128d shifter = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * ln(2) + r, |r| <= ln(2) / 2 */
+    simde__m128d k = simde_mm_fmadd_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.44269504088896340736)), shifter);
+    simde__m128d n = simde_mm_sub_pd(k, shifter);
+    simde__m128d r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-6.93145751953125e-1)), a);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.42860682030941723212e-6)), r);
+
+    /* exp(r) = 1 + 2 * r * P(r^2) / (Q(r^2) - r * P(r^2)) */
+    simde__m128d rr = simde_mm_mul_pd(r, r);
+    simde__m128d p = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.26177193074810590878e-4));
+    p = simde_mm_fmadd_pd(p, rr, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.02994407707441961300e-2)));
+    p = simde_mm_fmadd_pd(p, rr, simde_mm_set1_pd(SIMDE_FLOAT64_C(9.99999999999999999910e-1)));
+    p = simde_mm_mul_pd(p, r);
+    simde__m128d q = simde_mm_set1_pd(SIMDE_FLOAT64_C(3.00198505138664455042e-6));
+    q = simde_mm_fmadd_pd(q, rr, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.52448340349684104192e-3)));
+    q = simde_mm_fmadd_pd(q, rr, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.27265548208155028766e-1)));
+    q = simde_mm_fmadd_pd(q, rr, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.00000000000000000009e0)));
+    simde__m128d y = simde_mm_div_pd(p, simde_mm_sub_pd(q, p));
+    y = simde_mm_fmadd_pd(y, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)));
+
+    /* Scale by 2^n as two factors so results near the overflow and
+     * underflow thresholds (including subnormals) are not lost. */
+    simde__m128i ni = simde_mm_sub_epi64(simde_mm_castpd_si128(k), simde_mm_castpd_si128(shifter));
+    simde__m128i ni1 = simde_mm_sub_epi64(simde_mm_castpd_si128(simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), shifter)), simde_mm_castpd_si128(shifter));
+    y = simde_mm_mul_pd(simde_mm_mul_pd(y, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_add_epi64(ni1, simde_mm_set1_epi64x(INT64_C(1023))), 52))), simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_add_epi64(simde_mm_sub_epi64(ni, ni1), simde_mm_set1_epi64x(INT64_C(1023))), 52)));
+
+    y = simde_mm_blendv_pd(y, simde_mm_set1_pd(SIMDE_MATH_INFINITY), simde_mm_cmpgt_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(709.782712893383973096))));
+    return simde_mm_blendv_pd(y, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0)), simde_mm_cmplt_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-745.133219101941108420))));
   #else
     simde__m128d_private
       r_,
@@ -3535,24 +4637,60 @@ simde_mm_erf_pd (simde__m128d a) {
 
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_erf(a_.f64[i]);
+      r_.f64[i] = simde_math_exp(a_.f64[i]);
     }
 
     return simde__m128d_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm_erf_pd
-  #define _mm_erf_pd(a) simde_mm_erf_pd(a)
+  #undef _mm_exp_pd
+  #define _mm_exp_pd(a) simde_mm_exp_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256
-simde_mm256_erf_ps (simde__m256 a) {
+simde_mm256_exp_ps (simde__m256 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
-    return _mm256_erf_ps(a);
+    return _mm256_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
-    return Sleef_erff8_u10(a);
+    return Sleef_expf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m256 shifter = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * ln(2) + r, |r| <= ln(2) / 2 */
+    simde__m256 k = simde_mm256_fmadd_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.44269504088896340736)), shifter);
+    simde__m256 n = simde_mm256_sub_ps(k, shifter);
+    simde__m256 r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.693359375)), a);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.12194440e-4)), r);
+
+    /* exp(r) = 1 + r + r^2 * P(r) */
+    simde__m256 y = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+    y = simde_mm256_fmadd_ps(y, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+    y = simde_mm256_fmadd_ps(y, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+    y = simde_mm256_fmadd_ps(y, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+    y = simde_mm256_fmadd_ps(y, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+    y = simde_mm256_fmadd_ps(y, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+    y = simde_mm256_add_ps(simde_mm256_fmadd_ps(y, simde_mm256_mul_ps(r, r), r), simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+    /* Scale by 2^n as two factors so results near the overflow and
+     * underflow thresholds (including subnormals) are not lost. */
+    simde__m256i ni = simde_mm256_sub_epi32(simde_mm256_castps_si256(k), simde_mm256_castps_si256(shifter));
+    simde__m256i ni1 = simde_mm256_sub_epi32(simde_mm256_castps_si256(simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), shifter)), simde_mm256_castps_si256(shifter));
+    y = simde_mm256_mul_ps(simde_mm256_mul_ps(y, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_add_epi32(ni1, simde_mm256_set1_epi32(INT32_C(127))), 23))), simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_add_epi32(simde_mm256_sub_epi32(ni, ni1), simde_mm256_set1_epi32(INT32_C(127))), 23)));
+
+    y = simde_mm256_blendv_ps(y, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(88.72283172607421875)), SIMDE_CMP_GT_OQ));
+    return simde_mm256_blendv_ps(y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.0)), simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-103.972084045410156)), SIMDE_CMP_LT_OQ));
   #else
     simde__m256_private
       r_,
@@ -3560,12 +4698,12 @@ simde_mm256_erf_ps (simde__m256 a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
-        r_.m128[i] = simde_mm_erf_ps(a_.m128[i]);
+        r_.m128[i] = simde_mm_exp_ps(a_.m128[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-        r_.f32[i] = simde_math_erff(a_.f32[i]);
+        r_.f32[i] = simde_math_expf(a_.f32[i]);
       }
     #endif
 
@@ -3573,18 +4711,58 @@ simde_mm256_erf_ps (simde__m256 a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_erf_ps
-  #define _mm256_erf_ps(a) simde_mm256_erf_ps(a)
+  #undef _mm256_exp_ps
+  #define _mm256_exp_ps(a) simde_mm256_exp_ps(a)
 #endif
 
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256d
-simde_mm256_erf_pd (simde__m256d a) {
+simde_mm256_exp_pd (simde__m256d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
-    return _mm256_erf_pd(a);
+    return _mm256_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
-    return Sleef_erfd4_u10(a);
+    return Sleef_expd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m256d shifter = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * ln(2) + r, |r| <= ln(2) / 2 */
+    simde__m256d k = simde_mm256_fmadd_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.44269504088896340736)), shifter);
+    simde__m256d n = simde_mm256_sub_pd(k, shifter);
+    simde__m256d r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-6.93145751953125e-1)), a);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.42860682030941723212e-6)), r);
+
+    /* exp(r) = 1 + 2 * r * P(r^2) / (Q(r^2) - r * P(r^2)) */
+    simde__m256d rr = simde_mm256_mul_pd(r, r);
+    simde__m256d p = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.26177193074810590878e-4));
+    p = simde_mm256_fmadd_pd(p, rr, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.02994407707441961300e-2)));
+    p = simde_mm256_fmadd_pd(p, rr, simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.99999999999999999910e-1)));
+    p = simde_mm256_mul_pd(p, r);
+    simde__m256d q = simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.00198505138664455042e-6));
+    q = simde_mm256_fmadd_pd(q, rr, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.52448340349684104192e-3)));
+    q = simde_mm256_fmadd_pd(q, rr, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.27265548208155028766e-1)));
+    q = simde_mm256_fmadd_pd(q, rr, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.00000000000000000009e0)));
+    simde__m256d y = simde_mm256_div_pd(p, simde_mm256_sub_pd(q, p));
+    y = simde_mm256_fmadd_pd(y, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)));
+
+    /* Scale by 2^n as two factors so results near the overflow and
+     * underflow thresholds (including subnormals) are not lost. */
+    simde__m256i ni = simde_mm256_sub_epi64(simde_mm256_castpd_si256(k), simde_mm256_castpd_si256(shifter));
+    simde__m256i ni1 = simde_mm256_sub_epi64(simde_mm256_castpd_si256(simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), shifter)), simde_mm256_castpd_si256(shifter));
+    y = simde_mm256_mul_pd(simde_mm256_mul_pd(y, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_add_epi64(ni1, simde_mm256_set1_epi64x(INT64_C(1023))), 52))), simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_add_epi64(simde_mm256_sub_epi64(ni, ni1), simde_mm256_set1_epi64x(INT64_C(1023))), 52)));
+
+    y = simde_mm256_blendv_pd(y, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(709.782712893383973096)), SIMDE_CMP_GT_OQ));
+    return simde_mm256_blendv_pd(y, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0)), simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-745.133219101941108420)), SIMDE_CMP_LT_OQ));
   #else
     simde__m256d_private
       r_,
@@ -3592,12 +4770,12 @@ simde_mm256_erf_pd (simde__m256d a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
-        r_.m128d[i] = simde_mm_erf_pd(a_.m128d[i]);
+        r_.m128d[i] = simde_mm_exp_pd(a_.m128d[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-        r_.f64[i] = simde_math_erf(a_.f64[i]);
+        r_.f64[i] = simde_math_exp(a_.f64[i]);
       }
     #endif
 
@@ -3605,17 +4783,53 @@ simde_mm256_erf_pd (simde__m256d a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_erf_pd
-  #define _mm256_erf_pd(a) simde_mm256_erf_pd(a)
+  #undef _mm256_exp_pd
+  #define _mm256_exp_pd(a) simde_mm256_exp_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_erf_ps (simde__m512 a) {
+simde_mm512_exp_ps (simde__m512 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_erf_ps(a);
+    return _mm512_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return Sleef_erff16_u10(a);
+    return Sleef_expf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m512 shifter = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * ln(2) + r, |r| <= ln(2) / 2 */
+    simde__m512 k = simde_mm512_fmadd_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.44269504088896340736)), shifter);
+    simde__m512 n = simde_mm512_sub_ps(k, shifter);
+    simde__m512 r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.693359375)), a);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.12194440e-4)), r);
+
+    /* exp(r) = 1 + r + r^2 * P(r) */
+    simde__m512 y = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+    y = simde_mm512_fmadd_ps(y, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+    y = simde_mm512_fmadd_ps(y, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+    y = simde_mm512_fmadd_ps(y, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+    y = simde_mm512_fmadd_ps(y, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+    y = simde_mm512_fmadd_ps(y, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+    y = simde_mm512_add_ps(simde_mm512_fmadd_ps(y, simde_mm512_mul_ps(r, r), r), simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+    /* Scale by 2^n as two factors so results near the overflow and
+     * underflow thresholds (including subnormals) are not lost. */
+    simde__m512i ni = simde_mm512_sub_epi32(simde_mm512_castps_si512(k), simde_mm512_castps_si512(shifter));
+    simde__m512i ni1 = simde_mm512_sub_epi32(simde_mm512_castps_si512(simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.5)), shifter)), simde_mm512_castps_si512(shifter));
+    y = simde_mm512_mul_ps(simde_mm512_mul_ps(y, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_add_epi32(ni1, simde_mm512_set1_epi32(INT32_C(127))), 23))), simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_add_epi32(simde_mm512_sub_epi32(ni, ni1), simde_mm512_set1_epi32(INT32_C(127))), 23)));
+
+    y = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(88.72283172607421875)), SIMDE_CMP_GT_OQ), y, simde_mm512_set1_ps(SIMDE_MATH_INFINITYF));
+    return simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-103.972084045410156)), SIMDE_CMP_LT_OQ), y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.0)));
   #else
     simde__m512_private
       r_,
@@ -3623,12 +4837,12 @@ simde_mm512_erf_ps (simde__m512 a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-        r_.m256[i] = simde_mm256_erf_ps(a_.m256[i]);
+        r_.m256[i] = simde_mm256_exp_ps(a_.m256[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-        r_.f32[i] = simde_math_erff(a_.f32[i]);
+        r_.f32[i] = simde_math_expf(a_.f32[i]);
       }
     #endif
 
@@ -3636,17 +4850,57 @@ simde_mm512_erf_ps (simde__m512 a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_erf_ps
-  #define _mm512_erf_ps(a) simde_mm512_erf_ps(a)
+  #undef _mm512_exp_ps
+  #define _mm512_exp_ps(a) simde_mm512_exp_ps(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_erf_pd (simde__m512d a) {
+simde_mm512_exp_pd (simde__m512d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_erf_pd(a);
+    return _mm512_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return Sleef_erfd8_u10(a);
+    return Sleef_expd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    const simde__m512d shifter = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * ln(2) + r, |r| <= ln(2) / 2 */
+    simde__m512d k = simde_mm512_fmadd_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.44269504088896340736)), shifter);
+    simde__m512d n = simde_mm512_sub_pd(k, shifter);
+    simde__m512d r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-6.93145751953125e-1)), a);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.42860682030941723212e-6)), r);
+
+    /* exp(r) = 1 + 2 * r * P(r^2) / (Q(r^2) - r * P(r^2)) */
+    simde__m512d rr = simde_mm512_mul_pd(r, r);
+    simde__m512d p = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.26177193074810590878e-4));
+    p = simde_mm512_fmadd_pd(p, rr, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.02994407707441961300e-2)));
+    p = simde_mm512_fmadd_pd(p, rr, simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.99999999999999999910e-1)));
+    p = simde_mm512_mul_pd(p, r);
+    simde__m512d q = simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.00198505138664455042e-6));
+    q = simde_mm512_fmadd_pd(q, rr, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.52448340349684104192e-3)));
+    q = simde_mm512_fmadd_pd(q, rr, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.27265548208155028766e-1)));
+    q = simde_mm512_fmadd_pd(q, rr, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.00000000000000000009e0)));
+    simde__m512d y = simde_mm512_div_pd(p, simde_mm512_sub_pd(q, p));
+    y = simde_mm512_fmadd_pd(y, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.0)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)));
+
+    /* Scale by 2^n as two factors so results near the overflow and
+     * underflow thresholds (including subnormals) are not lost. */
+    simde__m512i ni = simde_mm512_sub_epi64(simde_mm512_castpd_si512(k), simde_mm512_castpd_si512(shifter));
+    simde__m512i ni1 = simde_mm512_sub_epi64(simde_mm512_castpd_si512(simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5)), shifter)), simde_mm512_castpd_si512(shifter));
+    y = simde_mm512_mul_pd(simde_mm512_mul_pd(y, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_add_epi64(ni1, simde_mm512_set1_epi64(INT64_C(1023))), 52))), simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_add_epi64(simde_mm512_sub_epi64(ni, ni1), simde_mm512_set1_epi64(INT64_C(1023))), 52)));
+
+    y = simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(709.782712893383973096)), SIMDE_CMP_GT_OQ), y, simde_mm512_set1_pd(SIMDE_MATH_INFINITY));
+    return simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-745.133219101941108420)), SIMDE_CMP_LT_OQ), y, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0)));
   #else
     simde__m512d_private
       r_,
@@ -3654,12 +4908,12 @@ simde_mm512_erf_pd (simde__m512d a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-        r_.m256d[i] = simde_mm256_erf_pd(a_.m256d[i]);
+        r_.m256d[i] = simde_mm256_exp_pd(a_.m256d[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-        r_.f64[i] = simde_math_erf(a_.f64[i]);
+        r_.f64[i] = simde_math_exp(a_.f64[i]);
       }
     #endif
 
@@ -3667,45 +4921,87 @@ simde_mm512_erf_pd (simde__m512d a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_erf_pd
-  #define _mm512_erf_pd(a) simde_mm512_erf_pd(a)
+  #undef _mm512_exp_pd
+  #define _mm512_exp_pd(a) simde_mm512_exp_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_mask_erf_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
+simde_mm512_mask_exp_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_erf_ps(src, k, a);
+    return _mm512_mask_exp_ps(src, k, a);
   #else
-    return simde_mm512_mask_mov_ps(src, k, simde_mm512_erf_ps(a));
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_exp_ps(a));
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_erf_ps
-  #define _mm512_mask_erf_ps(src, k, a) simde_mm512_mask_erf_ps(src, k, a)
+  #undef _mm512_mask_exp_ps
+  #define _mm512_mask_exp_ps(src, k, a) simde_mm512_mask_exp_ps(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_mask_erf_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
+simde_mm512_mask_exp_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_erf_pd(src, k, a);
+    return _mm512_mask_exp_pd(src, k, a);
   #else
-    return simde_mm512_mask_mov_pd(src, k, simde_mm512_erf_pd(a));
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_exp_pd(a));
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_erf_pd
-  #define _mm512_mask_erf_pd(src, k, a) simde_mm512_mask_erf_pd(src, k, a)
+  #undef _mm512_mask_exp_pd
+  #define _mm512_mask_exp_pd(src, k, a) simde_mm512_mask_exp_pd(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
-simde_mm_erfc_ps (simde__m128 a) {
+simde_mm_erf_ps (simde__m128 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_SSE_NATIVE)
-    return _mm_erfc_ps(a);
+    return _mm_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
-    return Sleef_erfcf4_u15(a);
+    return Sleef_erff4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_erff4_u10advsimd(a);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m128 ax = simde_x_mm_abs_ps(a);
+
+    /* |a| < 1: a * T(a^2) */
+    simde__m128 z = simde_mm_mul_ps(a, a);
+    simde__m128 t = simde_mm_set1_ps(SIMDE_FLOAT32_C(7.853861353153693e-5));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-8.010193625184903e-4)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.188327685732524e-3)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.685381193529856e-2)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.128358514861418e-1)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.761262582423300e-1)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.128379165726710e0)));
+    t = simde_mm_mul_ps(a, t);
+
+    /* |a| >= 1: 1 - exp(-a^2) / |a| * P(1 / a^2); erfc(4) is below FLT_EPSILON / 2. */
+    simde__m128 x = simde_mm_min_ps(ax, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.0)));
+    simde__m128 y = simde_mm_div_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), simde_mm_mul_ps(x, x));
+    simde__m128 p = simde_mm_set1_ps(SIMDE_FLOAT32_C(2.326819970068386e-2));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.387039388740657e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.687424674597105e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-5.824733027278666e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(6.210004621745983e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-4.944515323274145e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.404879937665872e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.741127028184656e-1)));
+    p = simde_mm_fmadd_ps(p, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.638259427386472e-1)));
+    simde__m128 r = simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.047766399936249e1));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.297719955372516e1)));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-7.495518717768503e0)));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.921019019210786e0)));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.015265279202700e0)));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.218463358204948e-1)));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.820767439740514e-1)));
+    r = simde_mm_fmadd_ps(r, y, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.641895067754075e-1)));
+    p = simde_mm_blendv_ps(r, p, simde_mm_cmplt_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.0))));
+    p = simde_mm_mul_ps(simde_mm_div_ps(simde_mm_exp_ps(simde_mm_mul_ps(simde_mm_mul_ps(x, x), simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.0)))), x), p);
+    p = simde_mm_or_ps(simde_mm_sub_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), p), simde_mm_and_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+
+    p = simde_mm_blendv_ps(p, t, simde_mm_cmplt_ps(ax, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+    return simde_mm_blendv_ps(p, a, simde_mm_cmpunord_ps(a, a));
   #else
     simde__m128_private
       r_,
@@ -3713,24 +5009,69 @@ simde_mm_erfc_ps (simde__m128 a) {
 
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_erfcf(a_.f32[i]);
+      r_.f32[i] = simde_math_erff(a_.f32[i]);
     }
 
     return simde__m128_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm_erfc_ps
-  #define _mm_erfc_ps(a) simde_mm_erfc_ps(a)
+  #undef _mm_erf_ps
+  #define _mm_erf_ps(a) simde_mm_erf_ps(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128d
-simde_mm_erfc_pd (simde__m128d a) {
+simde_mm_erf_pd (simde__m128d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_SSE_NATIVE)
-    return _mm_erfc_pd(a);
+    return _mm_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
-    return Sleef_erfcd2_u15(a);
+    return Sleef_erfd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_erfd2_u10advsimd(a);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m128d ax = simde_x_mm_abs_pd(a);
+
+    /* |a| < 1: a * T(a^2) / U(a^2) */
+    simde__m128d z = simde_mm_mul_pd(a, a);
+    simde__m128d t = simde_mm_set1_pd(SIMDE_FLOAT64_C(9.60497373987051638749e0));
+    t = simde_mm_fmadd_pd(t, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(9.00260197203842689217e1)));
+    t = simde_mm_fmadd_pd(t, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.23200534594684319226e3)));
+    t = simde_mm_fmadd_pd(t, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(7.00332514112805075473e3)));
+    t = simde_mm_fmadd_pd(t, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.55923013010394962768e4)));
+    simde__m128d u = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+    u = simde_mm_fmadd_pd(u, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.35617141647503099647e1)));
+    u = simde_mm_fmadd_pd(u, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.21357949780152679795e2)));
+    u = simde_mm_fmadd_pd(u, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.59432382970980127987e3)));
+    u = simde_mm_fmadd_pd(u, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.26290000613890934246e4)));
+    u = simde_mm_fmadd_pd(u, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.92673942608635921086e4)));
+    t = simde_mm_mul_pd(a, simde_mm_div_pd(t, u));
+
+    /* |a| >= 1: 1 - exp(-a^2) * P(|a|) / Q(|a|); erfc(6) is below DBL_EPSILON / 2. */
+    simde__m128d x = simde_mm_min_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.0)));
+    simde__m128d p = simde_mm_set1_pd(SIMDE_FLOAT64_C(2.46196981473530512524e-10));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.64189564831068821977e-1)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(7.46321056442269912687e0)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.86371970985681366614e1)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.96520832956077098242e2)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.26445194995477358631e2)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(9.34528527171957607540e2)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.02755188689515710272e3)));
+    p = simde_mm_fmadd_pd(p, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.57535335369399327526e2)));
+    simde__m128d q = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.32281951154744992508e1)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(8.67072140885989742329e1)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.54937778887819891062e2)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(9.75708501743205489753e2)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.82390916687909736289e3)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.24633760818710981792e3)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.65666309194161350182e3)));
+    q = simde_mm_fmadd_pd(q, x, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.57535340817727675546e2)));
+    p = simde_mm_mul_pd(simde_mm_exp_pd(simde_mm_mul_pd(simde_mm_mul_pd(x, x), simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.0)))), simde_mm_div_pd(p, q));
+    p = simde_mm_or_pd(simde_mm_sub_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), p), simde_mm_and_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+
+    p = simde_mm_blendv_pd(p, t, simde_mm_cmplt_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+    return simde_mm_blendv_pd(p, a, simde_mm_cmpunord_pd(a, a));
   #else
     simde__m128d_private
       r_,
@@ -3738,24 +5079,74 @@ simde_mm_erfc_pd (simde__m128d a) {
 
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_erfc(a_.f64[i]);
+      r_.f64[i] = simde_math_erf(a_.f64[i]);
     }
 
     return simde__m128d_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm_erfc_pd
-  #define _mm_erfc_pd(a) simde_mm_erfc_pd(a)
+  #undef _mm_erf_pd
+  #define _mm_erf_pd(a) simde_mm_erf_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256
-simde_mm256_erfc_ps (simde__m256 a) {
+simde_mm256_erf_ps (simde__m256 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
-    return _mm256_erfc_ps(a);
+    return _mm256_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
-    return Sleef_erfcf8_u15(a);
+    return Sleef_erff8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erf_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m256 ax = simde_x_mm256_abs_ps(a);
+
+    /* |a| < 1: a * T(a^2) */
+    simde__m256 z = simde_mm256_mul_ps(a, a);
+    simde__m256 t = simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.853861353153693e-5));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-8.010193625184903e-4)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.188327685732524e-3)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.685381193529856e-2)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.128358514861418e-1)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-3.761262582423300e-1)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.128379165726710e0)));
+    t = simde_mm256_mul_ps(a, t);
+
+    /* |a| >= 1: 1 - exp(-a^2) / |a| * P(1 / a^2); erfc(4) is below FLT_EPSILON / 2. */
+    simde__m256 x = simde_mm256_min_ps(ax, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.0)));
+    simde__m256 y = simde_mm256_div_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), simde_mm256_mul_ps(x, x));
+    simde__m256 p = simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.326819970068386e-2));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.387039388740657e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.687424674597105e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-5.824733027278666e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(6.210004621745983e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-4.944515323274145e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.404879937665872e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.741127028184656e-1)));
+    p = simde_mm256_fmadd_ps(p, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.638259427386472e-1)));
+    simde__m256 r = simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.047766399936249e1));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.297719955372516e1)));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-7.495518717768503e0)));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.921019019210786e0)));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.015265279202700e0)));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.218463358204948e-1)));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.820767439740514e-1)));
+    r = simde_mm256_fmadd_ps(r, y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.641895067754075e-1)));
+    p = simde_mm256_blendv_ps(r, p, simde_mm256_cmp_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_LT_OQ));
+    p = simde_mm256_mul_ps(simde_mm256_div_ps(simde_mm256_exp_ps(simde_mm256_mul_ps(simde_mm256_mul_ps(x, x), simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.0)))), x), p);
+    p = simde_mm256_or_ps(simde_mm256_sub_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), p), simde_mm256_and_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+
+    p = simde_mm256_blendv_ps(p, t, simde_mm256_cmp_ps(ax, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), SIMDE_CMP_LT_OQ));
+    return simde_mm256_blendv_ps(p, a, simde_mm256_cmp_ps(a, a, SIMDE_CMP_UNORD_Q));
   #else
     simde__m256_private
       r_,
@@ -3763,12 +5154,12 @@ simde_mm256_erfc_ps (simde__m256 a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
-        r_.m128[i] = simde_mm_erfc_ps(a_.m128[i]);
+        r_.m128[i] = simde_mm_erf_ps(a_.m128[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-        r_.f32[i] = simde_math_erfcf(a_.f32[i]);
+        r_.f32[i] = simde_math_erff(a_.f32[i]);
       }
     #endif
 
@@ -3776,31 +5167,84 @@ simde_mm256_erfc_ps (simde__m256 a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_erfc_ps
-  #define _mm256_erfc_ps(a) simde_mm256_erfc_ps(a)
+  #undef _mm256_erf_ps
+  #define _mm256_erf_ps(a) simde_mm256_erf_ps(a)
 #endif
 
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256d
-simde_mm256_erfc_pd (simde__m256d a) {
+simde_mm256_erf_pd (simde__m256d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
-    return _mm256_erfc_pd(a);
+    return _mm256_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
-    return Sleef_erfcd4_u15(a);
+    return Sleef_erfd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erf_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m256d ax = simde_x_mm256_abs_pd(a);
+
+    /* |a| < 1: a * T(a^2) / U(a^2) */
+    simde__m256d z = simde_mm256_mul_pd(a, a);
+    simde__m256d t = simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.60497373987051638749e0));
+    t = simde_mm256_fmadd_pd(t, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.00260197203842689217e1)));
+    t = simde_mm256_fmadd_pd(t, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.23200534594684319226e3)));
+    t = simde_mm256_fmadd_pd(t, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(7.00332514112805075473e3)));
+    t = simde_mm256_fmadd_pd(t, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.55923013010394962768e4)));
+    simde__m256d u = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+    u = simde_mm256_fmadd_pd(u, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.35617141647503099647e1)));
+    u = simde_mm256_fmadd_pd(u, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.21357949780152679795e2)));
+    u = simde_mm256_fmadd_pd(u, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.59432382970980127987e3)));
+    u = simde_mm256_fmadd_pd(u, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.26290000613890934246e4)));
+    u = simde_mm256_fmadd_pd(u, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.92673942608635921086e4)));
+    t = simde_mm256_mul_pd(a, simde_mm256_div_pd(t, u));
+
+    /* |a| >= 1: 1 - exp(-a^2) * P(|a|) / Q(|a|); erfc(6) is below DBL_EPSILON / 2. */
+    simde__m256d x = simde_mm256_min_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.0)));
+    simde__m256d p = simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.46196981473530512524e-10));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.64189564831068821977e-1)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(7.46321056442269912687e0)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.86371970985681366614e1)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.96520832956077098242e2)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.26445194995477358631e2)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.34528527171957607540e2)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.02755188689515710272e3)));
+    p = simde_mm256_fmadd_pd(p, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.57535335369399327526e2)));
+    simde__m256d q = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.32281951154744992508e1)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(8.67072140885989742329e1)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.54937778887819891062e2)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.75708501743205489753e2)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.82390916687909736289e3)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.24633760818710981792e3)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.65666309194161350182e3)));
+    q = simde_mm256_fmadd_pd(q, x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.57535340817727675546e2)));
+    p = simde_mm256_mul_pd(simde_mm256_exp_pd(simde_mm256_mul_pd(simde_mm256_mul_pd(x, x), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.0)))), simde_mm256_div_pd(p, q));
+    p = simde_mm256_or_pd(simde_mm256_sub_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)), p), simde_mm256_and_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+
+    p = simde_mm256_blendv_pd(p, t, simde_mm256_cmp_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)), SIMDE_CMP_LT_OQ));
+    return simde_mm256_blendv_pd(p, a, simde_mm256_cmp_pd(a, a, SIMDE_CMP_UNORD_Q));
   #else
     simde__m256d_private
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
-        r_.m128d[i] = simde_mm_erfc_pd(a_.m128d[i]);
+        r_.m128d[i] = simde_mm_erf_pd(a_.m128d[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-        r_.f64[i] = simde_math_erfc(a_.f64[i]);
+        r_.f64[i] = simde_math_erf(a_.f64[i]);
       }
     #endif
 
@@ -3808,17 +5252,67 @@ simde_mm256_erfc_pd (simde__m256d a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_erfc_pd
-  #define _mm256_erfc_pd(a) simde_mm256_erfc_pd(a)
+  #undef _mm256_erf_pd
+  #define _mm256_erf_pd(a) simde_mm256_erf_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_erfc_ps (simde__m512 a) {
+simde_mm512_erf_ps (simde__m512 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_erfc_ps(a);
+    return _mm512_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return Sleef_erfcf16_u15(a);
+    return Sleef_erff16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erf_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m512 ax = simde_mm512_abs_ps(a);
+
+    /* |a| < 1: a * T(a^2) */
+    simde__m512 z = simde_mm512_mul_ps(a, a);
+    simde__m512 t = simde_mm512_set1_ps(SIMDE_FLOAT32_C(7.853861353153693e-5));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-8.010193625184903e-4)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.188327685732524e-3)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.685381193529856e-2)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.128358514861418e-1)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-3.761262582423300e-1)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.128379165726710e0)));
+    t = simde_mm512_mul_ps(a, t);
+
+    /* |a| >= 1: 1 - exp(-a^2) / |a| * P(1 / a^2); erfc(4) is below FLT_EPSILON / 2. */
+    simde__m512 x = simde_mm512_min_ps(ax, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.0)));
+    simde__m512 y = simde_mm512_div_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), simde_mm512_mul_ps(x, x));
+    simde__m512 p = simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.326819970068386e-2));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.387039388740657e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.687424674597105e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-5.824733027278666e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(6.210004621745983e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-4.944515323274145e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.404879937665872e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.741127028184656e-1)));
+    p = simde_mm512_fmadd_ps(p, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.638259427386472e-1)));
+    simde__m512 r = simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.047766399936249e1));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.297719955372516e1)));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-7.495518717768503e0)));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.921019019210786e0)));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.015265279202700e0)));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.218463358204948e-1)));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.820767439740514e-1)));
+    r = simde_mm512_fmadd_ps(r, y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.641895067754075e-1)));
+    p = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(x, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_LT_OQ), r, p);
+    p = simde_mm512_mul_ps(simde_mm512_div_ps(simde_mm512_exp_ps(simde_mm512_mul_ps(simde_mm512_mul_ps(x, x), simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.0)))), x), p);
+    p = simde_mm512_or_ps(simde_mm512_sub_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), p), simde_mm512_and_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+
+    p = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(ax, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), SIMDE_CMP_LT_OQ), p, t);
+    return simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(a, a, SIMDE_CMP_UNORD_Q), p, a);
   #else
     simde__m512_private
       r_,
@@ -3826,12 +5320,12 @@ simde_mm512_erfc_ps (simde__m512 a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-        r_.m256[i] = simde_mm256_erfc_ps(a_.m256[i]);
+        r_.m256[i] = simde_mm256_erf_ps(a_.m256[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-        r_.f32[i] = simde_math_erfcf(a_.f32[i]);
+        r_.f32[i] = simde_math_erff(a_.f32[i]);
       }
     #endif
 
@@ -3839,17 +5333,70 @@ simde_mm512_erfc_ps (simde__m512 a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_erfc_ps
-  #define _mm512_erfc_ps(a) simde_mm512_erfc_ps(a)
+  #undef _mm512_erf_ps
+  #define _mm512_erf_ps(a) simde_mm512_erf_ps(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_erfc_pd (simde__m512d a) {
+simde_mm512_erf_pd (simde__m512d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_erfc_pd(a);
+    return _mm512_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return Sleef_erfcd8_u15(a);
+    return Sleef_erfd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erf_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m512d ax = simde_mm512_abs_pd(a);
+
+    /* |a| < 1: a * T(a^2) / U(a^2) */
+    simde__m512d z = simde_mm512_mul_pd(a, a);
+    simde__m512d t = simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.60497373987051638749e0));
+    t = simde_mm512_fmadd_pd(t, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.00260197203842689217e1)));
+    t = simde_mm512_fmadd_pd(t, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.23200534594684319226e3)));
+    t = simde_mm512_fmadd_pd(t, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(7.00332514112805075473e3)));
+    t = simde_mm512_fmadd_pd(t, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.55923013010394962768e4)));
+    simde__m512d u = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+    u = simde_mm512_fmadd_pd(u, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.35617141647503099647e1)));
+    u = simde_mm512_fmadd_pd(u, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.21357949780152679795e2)));
+    u = simde_mm512_fmadd_pd(u, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.59432382970980127987e3)));
+    u = simde_mm512_fmadd_pd(u, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.26290000613890934246e4)));
+    u = simde_mm512_fmadd_pd(u, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.92673942608635921086e4)));
+    t = simde_mm512_mul_pd(a, simde_mm512_div_pd(t, u));
+
+    /* |a| >= 1: 1 - exp(-a^2) * P(|a|) / Q(|a|); erfc(6) is below DBL_EPSILON / 2. */
+    simde__m512d x = simde_mm512_min_pd(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.0)));
+    simde__m512d p = simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.46196981473530512524e-10));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.64189564831068821977e-1)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(7.46321056442269912687e0)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.86371970985681366614e1)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.96520832956077098242e2)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.26445194995477358631e2)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.34528527171957607540e2)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.02755188689515710272e3)));
+    p = simde_mm512_fmadd_pd(p, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.57535335369399327526e2)));
+    simde__m512d q = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.32281951154744992508e1)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(8.67072140885989742329e1)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.54937778887819891062e2)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.75708501743205489753e2)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.82390916687909736289e3)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.24633760818710981792e3)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.65666309194161350182e3)));
+    q = simde_mm512_fmadd_pd(q, x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(5.57535340817727675546e2)));
+    p = simde_mm512_mul_pd(simde_mm512_exp_pd(simde_mm512_mul_pd(simde_mm512_mul_pd(x, x), simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.0)))), simde_mm512_div_pd(p, q));
+    p = simde_mm512_or_pd(simde_mm512_sub_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), p), simde_mm512_and_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+
+    p = simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), SIMDE_CMP_LT_OQ), p, t);
+    return simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(a, a, SIMDE_CMP_UNORD_Q), p, a);
   #else
     simde__m512d_private
       r_,
@@ -3857,12 +5404,12 @@ simde_mm512_erfc_pd (simde__m512d a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-        r_.m256d[i] = simde_mm256_erfc_pd(a_.m256d[i]);
+        r_.m256d[i] = simde_mm256_erf_pd(a_.m256d[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-        r_.f64[i] = simde_math_erfc(a_.f64[i]);
+        r_.f64[i] = simde_math_erf(a_.f64[i]);
       }
     #endif
 
@@ -3870,45 +5417,47 @@ simde_mm512_erfc_pd (simde__m512d a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_erfc_pd
-  #define _mm512_erfc_pd(a) simde_mm512_erfc_pd(a)
+  #undef _mm512_erf_pd
+  #define _mm512_erf_pd(a) simde_mm512_erf_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_mask_erfc_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
+simde_mm512_mask_erf_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_erfc_ps(src, k, a);
+    return _mm512_mask_erf_ps(src, k, a);
   #else
-    return simde_mm512_mask_mov_ps(src, k, simde_mm512_erfc_ps(a));
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_erf_ps(a));
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_erfc_ps
-  #define _mm512_mask_erfc_ps(src, k, a) simde_mm512_mask_erfc_ps(src, k, a)
+  #undef _mm512_mask_erf_ps
+  #define _mm512_mask_erf_ps(src, k, a) simde_mm512_mask_erf_ps(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_mask_erfc_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
+simde_mm512_mask_erf_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_erfc_pd(src, k, a);
+    return _mm512_mask_erf_pd(src, k, a);
   #else
-    return simde_mm512_mask_mov_pd(src, k, simde_mm512_erfc_pd(a));
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_erf_pd(a));
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_erfc_pd
-  #define _mm512_mask_erfc_pd(src, k, a) simde_mm512_mask_erfc_pd(src, k, a)
+  #undef _mm512_mask_erf_pd
+  #define _mm512_mask_erf_pd(src, k, a) simde_mm512_mask_erf_pd(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
-simde_mm_exp_ps (simde__m128 a) {
+simde_mm_erfc_ps (simde__m128 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_SSE_NATIVE)
-    return _mm_exp_ps(a);
+    return _mm_erfc_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
-    return Sleef_expf4_u10(a);
+    return Sleef_erfcf4_u15(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_erfcf4_u15advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -3916,24 +5465,26 @@ simde_mm_exp_ps (simde__m128 a) {
 
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_expf(a_.f32[i]);
+      r_.f32[i] = simde_math_erfcf(a_.f32[i]);
     }
 
     return simde__m128_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm_exp_ps
-  #define _mm_exp_ps(a) simde_mm_exp_ps(a)
+  #undef _mm_erfc_ps
+  #define _mm_erfc_ps(a) simde_mm_erfc_ps(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128d
-simde_mm_exp_pd (simde__m128d a) {
+simde_mm_erfc_pd (simde__m128d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_SSE_NATIVE)
-    return _mm_exp_pd(a);
+    return _mm_erfc_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
-    return Sleef_expd2_u10(a);
+    return Sleef_erfcd2_u15(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_erfcd2_u15advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -3941,24 +5492,34 @@ simde_mm_exp_pd (simde__m128d a) {
 
     SIMDE_VECTORIZE
     for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_exp(a_.f64[i]);
+      r_.f64[i] = simde_math_erfc(a_.f64[i]);
     }
 
     return simde__m128d_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm_exp_pd
-  #define _mm_exp_pd(a) simde_mm_exp_pd(a)
+  #undef _mm_erfc_pd
+  #define _mm_erfc_pd(a) simde_mm_erfc_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256
-simde_mm256_exp_ps (simde__m256 a) {
+simde_mm256_erfc_ps (simde__m256 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
-    return _mm256_exp_ps(a);
+    return _mm256_erfc_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
-    return Sleef_expf8_u10(a);
+    return Sleef_erfcf8_u15(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erfc_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -3966,12 +5527,12 @@ simde_mm256_exp_ps (simde__m256 a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
-        r_.m128[i] = simde_mm_exp_ps(a_.m128[i]);
+        r_.m128[i] = simde_mm_erfc_ps(a_.m128[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-        r_.f32[i] = simde_math_expf(a_.f32[i]);
+        r_.f32[i] = simde_math_erfcf(a_.f32[i]);
       }
     #endif
 
@@ -3979,31 +5540,41 @@ simde_mm256_exp_ps (simde__m256 a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_exp_ps
-  #define _mm256_exp_ps(a) simde_mm256_exp_ps(a)
+  #undef _mm256_erfc_ps
+  #define _mm256_erfc_ps(a) simde_mm256_erfc_ps(a)
 #endif
 
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256d
-simde_mm256_exp_pd (simde__m256d a) {
+simde_mm256_erfc_pd (simde__m256d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
-    return _mm256_exp_pd(a);
+    return _mm256_erfc_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
-    return Sleef_expd4_u10(a);
+    return Sleef_erfcd4_u15(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erfc_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
       a_ = simde__m256d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
-        r_.m128d[i] = simde_mm_exp_pd(a_.m128d[i]);
+        r_.m128d[i] = simde_mm_erfc_pd(a_.m128d[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-        r_.f64[i] = simde_math_exp(a_.f64[i]);
+        r_.f64[i] = simde_math_erfc(a_.f64[i]);
       }
     #endif
 
@@ -4011,17 +5582,27 @@ simde_mm256_exp_pd (simde__m256d a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_exp_pd
-  #define _mm256_exp_pd(a) simde_mm256_exp_pd(a)
+  #undef _mm256_erfc_pd
+  #define _mm256_erfc_pd(a) simde_mm256_erfc_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_exp_ps (simde__m512 a) {
+simde_mm512_erfc_ps (simde__m512 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_exp_ps(a);
+    return _mm512_erfc_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return Sleef_expf16_u10(a);
+    return Sleef_erfcf16_u15(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erfc_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -4029,12 +5610,12 @@ simde_mm512_exp_ps (simde__m512 a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
-        r_.m256[i] = simde_mm256_exp_ps(a_.m256[i]);
+        r_.m256[i] = simde_mm256_erfc_ps(a_.m256[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-        r_.f32[i] = simde_math_expf(a_.f32[i]);
+        r_.f32[i] = simde_math_erfcf(a_.f32[i]);
       }
     #endif
 
@@ -4042,17 +5623,27 @@ simde_mm512_exp_ps (simde__m512 a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_exp_ps
-  #define _mm512_exp_ps(a) simde_mm512_exp_ps(a)
+  #undef _mm512_erfc_ps
+  #define _mm512_erfc_ps(a) simde_mm512_erfc_ps(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_exp_pd (simde__m512d a) {
+simde_mm512_erfc_pd (simde__m512d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_exp_pd(a);
+    return _mm512_erfc_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return Sleef_expd8_u10(a);
+    return Sleef_erfcd8_u15(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_erfc_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -4060,12 +5651,12 @@ simde_mm512_exp_pd (simde__m512d a) {
 
     #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
-        r_.m256d[i] = simde_mm256_exp_pd(a_.m256d[i]);
+        r_.m256d[i] = simde_mm256_erfc_pd(a_.m256d[i]);
       }
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-        r_.f64[i] = simde_math_exp(a_.f64[i]);
+        r_.f64[i] = simde_math_erfc(a_.f64[i]);
       }
     #endif
 
@@ -4073,36 +5664,36 @@ simde_mm512_exp_pd (simde__m512d a) {
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_exp_pd
-  #define _mm512_exp_pd(a) simde_mm512_exp_pd(a)
+  #undef _mm512_erfc_pd
+  #define _mm512_erfc_pd(a) simde_mm512_erfc_pd(a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
-simde_mm512_mask_exp_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
+simde_mm512_mask_erfc_ps(simde__m512 src, simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_exp_ps(src, k, a);
+    return _mm512_mask_erfc_ps(src, k, a);
   #else
-    return simde_mm512_mask_mov_ps(src, k, simde_mm512_exp_ps(a));
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_erfc_ps(a));
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_exp_ps
-  #define _mm512_mask_exp_ps(src, k, a) simde_mm512_mask_exp_ps(src, k, a)
+  #undef _mm512_mask_erfc_ps
+  #define _mm512_mask_erfc_ps(src, k, a) simde_mm512_mask_erfc_ps(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512d
-simde_mm512_mask_exp_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
+simde_mm512_mask_erfc_pd(simde__m512d src, simde__mmask8 k, simde__m512d a) {
   #if defined(SIMDE_X86_SVML_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_exp_pd(src, k, a);
+    return _mm512_mask_erfc_pd(src, k, a);
   #else
-    return simde_mm512_mask_mov_pd(src, k, simde_mm512_exp_pd(a));
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_erfc_pd(a));
   #endif
 }
 #if defined(SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_exp_pd
-  #define _mm512_mask_exp_pd(src, k, a) simde_mm512_mask_exp_pd(src, k, a)
+  #undef _mm512_mask_erfc_pd
+  #define _mm512_mask_erfc_pd(src, k, a) simde_mm512_mask_erfc_pd(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -4112,6 +5703,8 @@ simde_mm_expm1_ps (simde__m128 a) {
     return _mm_expm1_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expm1f4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_expm1f4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -4137,6 +5730,8 @@ simde_mm_expm1_pd (simde__m128d a) {
     return _mm_expm1_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expm1d2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_expm1d2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -4162,6 +5757,16 @@ simde_mm256_expm1_ps (simde__m256 a) {
     return _mm256_expm1_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_expm1f8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_expm1_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -4194,6 +5799,16 @@ simde_mm256_expm1_pd (simde__m256d a) {
     return _mm256_expm1_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_expm1d4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_expm1_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -4225,6 +5840,16 @@ simde_mm512_expm1_ps (simde__m512 a) {
     return _mm512_expm1_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_expm1f16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_expm1_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -4256,6 +5881,16 @@ simde_mm512_expm1_pd (simde__m512d a) {
     return _mm512_expm1_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_expm1d8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_expm1_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -4315,6 +5950,8 @@ simde_mm_exp2_ps (simde__m128 a) {
     return _mm_exp2_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_exp2f4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_exp2f4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -4340,6 +5977,8 @@ simde_mm_exp2_pd (simde__m128d a) {
     return _mm_exp2_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_exp2d2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_exp2d2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -4365,6 +6004,16 @@ simde_mm256_exp2_ps (simde__m256 a) {
     return _mm256_exp2_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_exp2f8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp2_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -4397,6 +6046,16 @@ simde_mm256_exp2_pd (simde__m256d a) {
     return _mm256_exp2_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_exp2d4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp2_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -4428,6 +6087,16 @@ simde_mm512_exp2_ps (simde__m512 a) {
     return _mm512_exp2_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_exp2f16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp2_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -4459,6 +6128,16 @@ simde_mm512_exp2_pd (simde__m512d a) {
     return _mm512_exp2_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_exp2d8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp2_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -4518,6 +6197,8 @@ simde_mm_exp10_ps (simde__m128 a) {
     return _mm_exp10_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_exp10f4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_exp10f4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -4543,6 +6224,8 @@ simde_mm_exp10_pd (simde__m128d a) {
     return _mm_exp10_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_exp10d2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_exp10d2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -4568,6 +6251,16 @@ simde_mm256_exp10_ps (simde__m256 a) {
     return _mm256_exp10_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_exp10f8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp10_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -4600,6 +6293,16 @@ simde_mm256_exp10_pd (simde__m256d a) {
     return _mm256_exp10_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_exp10d4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp10_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -4631,6 +6334,16 @@ simde_mm512_exp10_ps (simde__m512 a) {
     return _mm512_exp10_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_exp10f16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp10_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -4662,6 +6375,16 @@ simde_mm512_exp10_pd (simde__m512d a) {
     return _mm512_exp10_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_exp10d8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_exp10_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -5139,6 +6862,12 @@ simde_mm_hypot_ps (simde__m128 a, simde__m128 b) {
     #else
       return Sleef_hypotf4_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_hypotf4_u05advsimd(a, b);
+    #else
+      return Sleef_hypotf4_u35advsimd(a, b);
+    #endif
   #else
     simde__m128_private
       r_,
@@ -5169,6 +6898,12 @@ simde_mm_hypot_pd (simde__m128d a, simde__m128d b) {
     #else
       return Sleef_hypotd2_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_hypotd2_u05advsimd(a, b);
+    #else
+      return Sleef_hypotd2_u35advsimd(a, b);
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -5199,6 +6934,17 @@ simde_mm256_hypot_ps (simde__m256 a, simde__m256 b) {
     #else
       return Sleef_hypotf8_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a),
+      b_ = simde__m256_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_hypot_ps(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -5236,6 +6982,17 @@ simde_mm256_hypot_pd (simde__m256d a, simde__m256d b) {
     #else
       return Sleef_hypotd4_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a),
+      b_ = simde__m256d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_hypot_pd(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -5272,6 +7029,17 @@ simde_mm512_hypot_ps (simde__m512 a, simde__m512 b) {
     #else
       return Sleef_hypotf16_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_hypot_ps(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -5308,6 +7076,17 @@ simde_mm512_hypot_pd (simde__m512d a, simde__m512d b) {
     #else
       return Sleef_hypotd8_u35(a, b);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_hypot_pd(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -5540,6 +7319,43 @@ simde_mm_log_ps (simde__m128 a) {
     #else
       return Sleef_logf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_logf4_u10advsimd(a);
+    #else
+      return Sleef_logf4_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a = 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2) */
+    simde__m128 den = simde_mm_cmplt_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)));
+    simde__m128 x = simde_mm_blendv_ps(a, simde_mm_mul_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0))), den);
+    simde__m128i xi = simde_mm_castps_si128(x);
+    simde__m128 e = simde_mm_sub_ps(simde_mm_cvtepi32_ps(simde_mm_srli_epi32(xi, 23)), simde_mm_blendv_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(126.0)), simde_mm_set1_ps(SIMDE_FLOAT32_C(150.0)), den));
+    simde__m128 f = simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_and_si128(xi, simde_mm_set1_epi32(INT32_C(0x007FFFFF))), simde_mm_set1_epi32(INT32_C(0x3F000000))));
+    simde__m128 lo = simde_mm_cmplt_ps(f, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524401)));
+    e = simde_mm_blendv_ps(e, simde_mm_sub_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))), lo);
+    f = simde_mm_sub_ps(simde_mm_blendv_ps(f, simde_mm_add_ps(f, f), lo), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)));
+    simde__m128 z = simde_mm_mul_ps(f, f);
+
+    /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) */
+    simde__m128 y = simde_mm_set1_ps(SIMDE_FLOAT32_C(7.0376836292e-2));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.1676998740e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.4249322787e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.0000714765e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+    y = simde_mm_fmadd_ps(y, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.3333331174e-1)));
+    y = simde_mm_mul_ps(simde_mm_mul_ps(y, f), z);
+    y = simde_mm_fmadd_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), y);
+    y = simde_mm_fmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.5)), y);
+    y = simde_mm_fmadd_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375)), simde_mm_add_ps(f, y));
+
+    /* log(+-0) = -inf, log(a < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    y = simde_mm_blendv_ps(y, simde_mm_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm_cmpeq_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.0))));
+    y = simde_mm_blendv_ps(y, simde_mm_set1_ps(SIMDE_MATH_NANF), simde_mm_cmplt_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.0))));
+    return simde_mm_blendv_ps(y, a, simde_mm_or_ps(simde_mm_cmpeq_ps(a, simde_mm_set1_ps(SIMDE_MATH_INFINITYF)), simde_mm_cmpunord_ps(a, a)));
   #else
     simde__m128_private
       r_,
@@ -5569,6 +7385,47 @@ simde_mm_log_pd (simde__m128d a) {
     #else
       return Sleef_logd2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_logd2_u10advsimd(a);
+    #else
+      return Sleef_logd2_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a = 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2) */
+    simde__m128d den = simde_mm_cmplt_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)));
+    simde__m128d x = simde_mm_blendv_pd(a, simde_mm_mul_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), den);
+    simde__m128i xi = simde_mm_castpd_si128(x);
+    simde__m128d e = simde_mm_sub_pd(simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(xi, 52), simde_mm_castpd_si128(simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0)));
+    e = simde_mm_sub_pd(e, simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1022.0)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1076.0)), den));
+    simde__m128d f = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_and_si128(xi, simde_mm_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm_set1_epi64x(INT64_C(0x3FE0000000000000))));
+    simde__m128d lo = simde_mm_cmplt_pd(f, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524401)));
+    e = simde_mm_blendv_pd(e, simde_mm_sub_pd(e, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))), lo);
+    f = simde_mm_sub_pd(simde_mm_blendv_pd(f, simde_mm_add_pd(f, f), lo), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)));
+    simde__m128d z = simde_mm_mul_pd(f, f);
+
+    /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) / Q(f) */
+    simde__m128d p = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.01875663804580931796e-4));
+    p = simde_mm_fmadd_pd(p, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.97494994976747001425e-1)));
+    p = simde_mm_fmadd_pd(p, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.70579119878881725854e0)));
+    p = simde_mm_fmadd_pd(p, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.44989225341610930846e1)));
+    p = simde_mm_fmadd_pd(p, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.79368678507819816313e1)));
+    p = simde_mm_fmadd_pd(p, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(7.70838733755885391666e0)));
+    simde__m128d q = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+    q = simde_mm_fmadd_pd(q, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.12873587189167450590e1)));
+    q = simde_mm_fmadd_pd(q, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.52279145837532221105e1)));
+    q = simde_mm_fmadd_pd(q, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(8.29875266912776603211e1)));
+    q = simde_mm_fmadd_pd(q, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(7.11544750618563894466e1)));
+    q = simde_mm_fmadd_pd(q, f, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.31251620126765340583e1)));
+    simde__m128d y = simde_mm_mul_pd(simde_mm_mul_pd(f, z), simde_mm_div_pd(p, q));
+    y = simde_mm_fmadd_pd(e, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.121944400546905827679e-4)), y);
+    y = simde_mm_fmadd_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.5)), y);
+    y = simde_mm_fmadd_pd(e, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.693359375)), simde_mm_add_pd(f, y));
+
+    /* log(+-0) = -inf, log(a < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    y = simde_mm_blendv_pd(y, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), simde_mm_cmpeq_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0))));
+    y = simde_mm_blendv_pd(y, simde_mm_set1_pd(SIMDE_MATH_NAN), simde_mm_cmplt_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0))));
+    return simde_mm_blendv_pd(y, a, simde_mm_or_pd(simde_mm_cmpeq_pd(a, simde_mm_set1_pd(SIMDE_MATH_INFINITY)), simde_mm_cmpunord_pd(a, a)));
   #else
     simde__m128d_private
       r_,
@@ -5598,6 +7455,47 @@ simde_mm256_log_ps (simde__m256 a) {
     #else
       return Sleef_logf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a = 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2) */
+    simde__m256 den = simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+    simde__m256 x = simde_mm256_blendv_ps(a, simde_mm256_mul_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0))), den);
+    simde__m256i xi = simde_mm256_castps_si256(x);
+    simde__m256 e = simde_mm256_sub_ps(simde_mm256_cvtepi32_ps(simde_mm256_srli_epi32(xi, 23)), simde_mm256_blendv_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(126.0)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(150.0)), den));
+    simde__m256 f = simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_and_si256(xi, simde_mm256_set1_epi32(INT32_C(0x007FFFFF))), simde_mm256_set1_epi32(INT32_C(0x3F000000))));
+    simde__m256 lo = simde_mm256_cmp_ps(f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524401)), SIMDE_CMP_LT_OQ);
+    e = simde_mm256_blendv_ps(e, simde_mm256_sub_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0))), lo);
+    f = simde_mm256_sub_ps(simde_mm256_blendv_ps(f, simde_mm256_add_ps(f, f), lo), simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)));
+    simde__m256 z = simde_mm256_mul_ps(f, f);
+
+    /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) */
+    simde__m256 y = simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.0376836292e-2));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.1676998740e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.4249322787e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.0000714765e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+    y = simde_mm256_fmadd_ps(y, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.3333331174e-1)));
+    y = simde_mm256_mul_ps(simde_mm256_mul_ps(y, f), z);
+    y = simde_mm256_fmadd_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), y);
+    y = simde_mm256_fmadd_ps(z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.5)), y);
+    y = simde_mm256_fmadd_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.693359375)), simde_mm256_add_ps(f, y));
+
+    /* log(+-0) = -inf, log(a < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    y = simde_mm256_blendv_ps(y, simde_mm256_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_EQ_OQ));
+    y = simde_mm256_blendv_ps(y, simde_mm256_set1_ps(SIMDE_MATH_NANF), simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_LT_OQ));
+    return simde_mm256_blendv_ps(y, a, simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ));
   #else
     simde__m256_private
       r_,
@@ -5634,6 +7532,51 @@ simde_mm256_log_pd (simde__m256d a) {
     #else
       return Sleef_logd4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a = 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2) */
+    simde__m256d den = simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+    simde__m256d x = simde_mm256_blendv_pd(a, simde_mm256_mul_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), den);
+    simde__m256i xi = simde_mm256_castpd_si256(x);
+    simde__m256d e = simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(xi, 52), simde_mm256_castpd_si256(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0)));
+    e = simde_mm256_sub_pd(e, simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1022.0)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1076.0)), den));
+    simde__m256d f = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(xi, simde_mm256_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm256_set1_epi64x(INT64_C(0x3FE0000000000000))));
+    simde__m256d lo = simde_mm256_cmp_pd(f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524401)), SIMDE_CMP_LT_OQ);
+    e = simde_mm256_blendv_pd(e, simde_mm256_sub_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0))), lo);
+    f = simde_mm256_sub_pd(simde_mm256_blendv_pd(f, simde_mm256_add_pd(f, f), lo), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)));
+    simde__m256d z = simde_mm256_mul_pd(f, f);
+
+    /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) / Q(f) */
+    simde__m256d p = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.01875663804580931796e-4));
+    p = simde_mm256_fmadd_pd(p, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.97494994976747001425e-1)));
+    p = simde_mm256_fmadd_pd(p, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.70579119878881725854e0)));
+    p = simde_mm256_fmadd_pd(p, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.44989225341610930846e1)));
+    p = simde_mm256_fmadd_pd(p, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.79368678507819816313e1)));
+    p = simde_mm256_fmadd_pd(p, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(7.70838733755885391666e0)));
+    simde__m256d q = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+    q = simde_mm256_fmadd_pd(q, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.12873587189167450590e1)));
+    q = simde_mm256_fmadd_pd(q, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.52279145837532221105e1)));
+    q = simde_mm256_fmadd_pd(q, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(8.29875266912776603211e1)));
+    q = simde_mm256_fmadd_pd(q, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(7.11544750618563894466e1)));
+    q = simde_mm256_fmadd_pd(q, f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.31251620126765340583e1)));
+    simde__m256d y = simde_mm256_mul_pd(simde_mm256_mul_pd(f, z), simde_mm256_div_pd(p, q));
+    y = simde_mm256_fmadd_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.121944400546905827679e-4)), y);
+    y = simde_mm256_fmadd_pd(z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.5)), y);
+    y = simde_mm256_fmadd_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.693359375)), simde_mm256_add_pd(f, y));
+
+    /* log(+-0) = -inf, log(a < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    y = simde_mm256_blendv_pd(y, simde_mm256_set1_pd(-SIMDE_MATH_INFINITY), simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_EQ_OQ));
+    y = simde_mm256_blendv_pd(y, simde_mm256_set1_pd(SIMDE_MATH_NAN), simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_LT_OQ));
+    return simde_mm256_blendv_pd(y, a, simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
   #else
     simde__m256d_private
       r_,
@@ -5669,6 +7612,47 @@ simde_mm512_log_ps (simde__m512 a) {
     #else
       return Sleef_logf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a = 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2) */
+    simde__mmask16 den = simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+    simde__m512 x = simde_mm512_mask_blend_ps(den, a, simde_mm512_mul_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(16777216.0))));
+    simde__m512i xi = simde_mm512_castps_si512(x);
+    simde__m512 e = simde_mm512_sub_ps(simde_mm512_cvtepi32_ps(simde_mm512_srli_epi32(xi, 23)), simde_mm512_mask_blend_ps(den, simde_mm512_set1_ps(SIMDE_FLOAT32_C(126.0)), simde_mm512_set1_ps(SIMDE_FLOAT32_C(150.0))));
+    simde__m512 f = simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_and_si512(xi, simde_mm512_set1_epi32(INT32_C(0x007FFFFF))), simde_mm512_set1_epi32(INT32_C(0x3F000000))));
+    simde__mmask16 lo = simde_mm512_cmp_ps_mask(f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524401)), SIMDE_CMP_LT_OQ);
+    e = simde_mm512_mask_blend_ps(lo, e, simde_mm512_sub_ps(e, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0))));
+    f = simde_mm512_sub_ps(simde_mm512_mask_blend_ps(lo, f, simde_mm512_add_ps(f, f)), simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)));
+    simde__m512 z = simde_mm512_mul_ps(f, f);
+
+    /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) */
+    simde__m512 y = simde_mm512_set1_ps(SIMDE_FLOAT32_C(7.0376836292e-2));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.1676998740e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.4249322787e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.0000714765e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+    y = simde_mm512_fmadd_ps(y, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.3333331174e-1)));
+    y = simde_mm512_mul_ps(simde_mm512_mul_ps(y, f), z);
+    y = simde_mm512_fmadd_ps(e, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), y);
+    y = simde_mm512_fmadd_ps(z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.5)), y);
+    y = simde_mm512_fmadd_ps(e, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.693359375)), simde_mm512_add_ps(f, y));
+
+    /* log(+-0) = -inf, log(a < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    y = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_EQ_OQ), y, simde_mm512_set1_ps(-SIMDE_MATH_INFINITYF));
+    y = simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_LT_OQ), y, simde_mm512_set1_ps(SIMDE_MATH_NANF));
+    return simde_mm512_mask_blend_ps(simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ), y, a);
   #else
     simde__m512_private
       r_,
@@ -5704,6 +7688,51 @@ simde_mm512_log_pd (simde__m512d a) {
     #else
       return Sleef_logd8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a = 2^e * (1 + f), sqrt(1/2) <= 1 + f < sqrt(2) */
+    simde__mmask8 den = simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+    simde__m512d x = simde_mm512_mask_blend_pd(den, a, simde_mm512_mul_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))));
+    simde__m512i xi = simde_mm512_castpd_si512(x);
+    simde__m512d e = simde_mm512_sub_pd(simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_srli_epi64(xi, 52), simde_mm512_castpd_si512(simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0)));
+    e = simde_mm512_sub_pd(e, simde_mm512_mask_blend_pd(den, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1022.0)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(1076.0))));
+    simde__m512d f = simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_and_si512(xi, simde_mm512_set1_epi64(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm512_set1_epi64(INT64_C(0x3FE0000000000000))));
+    simde__mmask8 lo = simde_mm512_cmp_pd_mask(f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524401)), SIMDE_CMP_LT_OQ);
+    e = simde_mm512_mask_blend_pd(lo, e, simde_mm512_sub_pd(e, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0))));
+    f = simde_mm512_sub_pd(simde_mm512_mask_blend_pd(lo, f, simde_mm512_add_pd(f, f)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)));
+    simde__m512d z = simde_mm512_mul_pd(f, f);
+
+    /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) / Q(f) */
+    simde__m512d p = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.01875663804580931796e-4));
+    p = simde_mm512_fmadd_pd(p, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.97494994976747001425e-1)));
+    p = simde_mm512_fmadd_pd(p, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.70579119878881725854e0)));
+    p = simde_mm512_fmadd_pd(p, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.44989225341610930846e1)));
+    p = simde_mm512_fmadd_pd(p, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.79368678507819816313e1)));
+    p = simde_mm512_fmadd_pd(p, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(7.70838733755885391666e0)));
+    simde__m512d q = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+    q = simde_mm512_fmadd_pd(q, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.12873587189167450590e1)));
+    q = simde_mm512_fmadd_pd(q, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.52279145837532221105e1)));
+    q = simde_mm512_fmadd_pd(q, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(8.29875266912776603211e1)));
+    q = simde_mm512_fmadd_pd(q, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(7.11544750618563894466e1)));
+    q = simde_mm512_fmadd_pd(q, f, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.31251620126765340583e1)));
+    simde__m512d y = simde_mm512_mul_pd(simde_mm512_mul_pd(f, z), simde_mm512_div_pd(p, q));
+    y = simde_mm512_fmadd_pd(e, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.121944400546905827679e-4)), y);
+    y = simde_mm512_fmadd_pd(z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.5)), y);
+    y = simde_mm512_fmadd_pd(e, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.693359375)), simde_mm512_add_pd(f, y));
+
+    /* log(+-0) = -inf, log(a < 0) = NaN, log(inf) = inf, log(NaN) = NaN */
+    y = simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_EQ_OQ), y, simde_mm512_set1_pd(-SIMDE_MATH_INFINITY));
+    y = simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_LT_OQ), y, simde_mm512_set1_pd(SIMDE_MATH_NAN));
+    return simde_mm512_mask_blend_pd(simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ), y, a);
   #else
     simde__m512d_private
       r_,
@@ -7908,6 +9937,12 @@ simde_mm_log2_ps (simde__m128 a) {
     #else
       return Sleef_log2f4_u10(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_MATH_SLEEF_VERSION_CHECK(3,4,0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+      return Sleef_log2f4_u35advsimd(a);
+    #else
+      return Sleef_log2f4_u10advsimd(a);
+    #endif
   #else
     simde__m128_private
       r_,
@@ -7937,6 +9972,12 @@ simde_mm_log2_pd (simde__m128d a) {
     #else
       return Sleef_log2d2_u10(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_MATH_SLEEF_VERSION_CHECK(3,4,0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+      return Sleef_log2d2_u35advsimd(a);
+    #else
+      return Sleef_log2d2_u10advsimd(a);
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -7966,6 +10007,16 @@ simde_mm256_log2_ps (simde__m256 a) {
     #else
       return Sleef_log2f8_u10(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log2_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -8002,6 +10053,16 @@ simde_mm256_log2_pd (simde__m256d a) {
     #else
       return Sleef_log2d4_u10(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log2_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -8037,6 +10098,16 @@ simde_mm512_log2_ps (simde__m512 a) {
     #else
       return Sleef_log2f16_u10(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log2_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -8072,6 +10143,16 @@ simde_mm512_log2_pd (simde__m512d a) {
     #else
       return Sleef_log2d8_u10(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log2_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -8131,6 +10212,8 @@ simde_mm_log1p_ps (simde__m128 a) {
     return _mm_log1p_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_log1pf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_log1pf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -8156,6 +10239,8 @@ simde_mm_log1p_pd (simde__m128d a) {
     return _mm_log1p_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_log1pd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_log1pd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -8181,6 +10266,16 @@ simde_mm256_log1p_ps (simde__m256 a) {
     return _mm256_log1p_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_log1pf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log1p_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -8213,6 +10308,16 @@ simde_mm256_log1p_pd (simde__m256d a) {
     return _mm256_log1p_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_log1pd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log1p_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -8244,6 +10349,16 @@ simde_mm512_log1p_ps (simde__m512 a) {
     return _mm512_log1p_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_log1pf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log1p_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -8275,6 +10390,16 @@ simde_mm512_log1p_pd (simde__m512d a) {
     return _mm512_log1p_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_log1pd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log1p_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -8334,6 +10459,8 @@ simde_mm_log10_ps (simde__m128 a) {
     return _mm_log10_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_log10f4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_log10f4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -8359,6 +10486,8 @@ simde_mm_log10_pd (simde__m128d a) {
     return _mm_log10_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_log10d2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_log10d2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -8384,6 +10513,16 @@ simde_mm256_log10_ps (simde__m256 a) {
     return _mm256_log10_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_log10f8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log10_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -8416,6 +10555,16 @@ simde_mm256_log10_pd (simde__m256d a) {
     return _mm256_log10_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_log10d4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log10_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -8447,6 +10596,16 @@ simde_mm512_log10_ps (simde__m512 a) {
     return _mm512_log10_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_log10f16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log10_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -8478,6 +10637,16 @@ simde_mm512_log10_pd (simde__m512d a) {
     return _mm512_log10_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_log10d8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_log10_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -8604,6 +10773,55 @@ simde_mm512_mask_nearbyint_pd(simde__m512d src, simde__mmask8 k, simde__m512d a)
   #define _mm512_mask_nearbyint_pd(src, k, a) simde_mm512_mask_nearbyint_pd(src, k, a)
 #endif
 
+/* pow() for single-precision values widened to double.  This is only
+ * as accurate as a float result needs (about 2^-32 relative error) and
+ * assumes a is positive and both a and b are finite. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_powf_pd (simde__m256d a, simde__m256d b) {
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  const simde__m256d shifter = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m256d two52 = simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0));
+
+  /* a = 2^e * m, sqrt(1/2) <= m < sqrt(2) */
+  simde__m256i ai = simde_mm256_castpd_si256(a);
+  simde__m256d e = simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(ai, 52), simde_mm256_castpd_si256(two52))), two52);
+  simde__m256d m = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(ai, simde_mm256_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))), simde_mm256_castpd_si256(one)));
+  simde__m256d big = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm256_blendv_pd(m, simde_mm256_mul_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5))), big);
+  e = simde_mm256_sub_pd(e, simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1023.0)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1022.0)), big));
+
+  /* log(m) = 2 * atanh(s), s = (m - 1) / (m + 1) */
+  simde__m256d s = simde_mm256_div_pd(simde_mm256_sub_pd(m, one), simde_mm256_add_pd(m, one));
+  simde__m256d z = simde_mm256_mul_pd(s, s);
+  simde__m256d l = simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0) / SIMDE_FLOAT64_C(11.0));
+  l = simde_mm256_fmadd_pd(l, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0) / SIMDE_FLOAT64_C(9.0)));
+  l = simde_mm256_fmadd_pd(l, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0) / SIMDE_FLOAT64_C(7.0)));
+  l = simde_mm256_fmadd_pd(l, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0) / SIMDE_FLOAT64_C(5.0)));
+  l = simde_mm256_fmadd_pd(l, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0) / SIMDE_FLOAT64_C(3.0)));
+  l = simde_mm256_fmadd_pd(l, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0)));
+  l = simde_mm256_fmadd_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.693147180559945309417)), simde_mm256_mul_pd(l, s));
+
+  /* exp(b * log(a)); anything outside of +-200 over/underflows once
+   * converted back to float anyway. */
+  simde__m256d w = simde_mm256_mul_pd(b, l);
+  w = simde_mm256_max_pd(simde_mm256_min_pd(w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(200.0))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-200.0)));
+  simde__m256d k = simde_mm256_fmadd_pd(w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.44269504088896340736)), shifter);
+  simde__m256d n = simde_mm256_sub_pd(k, shifter);
+  simde__m256d r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.693147180559945309417)), w);
+  simde__m256d y = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0) / SIMDE_FLOAT64_C(40320.0));
+  y = simde_mm256_fmadd_pd(y, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0) / SIMDE_FLOAT64_C(5040.0)));
+  y = simde_mm256_fmadd_pd(y, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0) / SIMDE_FLOAT64_C(720.0)));
+  y = simde_mm256_fmadd_pd(y, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0) / SIMDE_FLOAT64_C(120.0)));
+  y = simde_mm256_fmadd_pd(y, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0) / SIMDE_FLOAT64_C(24.0)));
+  y = simde_mm256_fmadd_pd(y, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0) / SIMDE_FLOAT64_C(6.0)));
+  y = simde_mm256_fmadd_pd(y, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  y = simde_mm256_fmadd_pd(y, r, one);
+  y = simde_mm256_fmadd_pd(y, r, one);
+
+  return simde_mm256_mul_pd(y, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_add_epi64(simde_mm256_sub_epi64(simde_mm256_castpd_si256(k), simde_mm256_castpd_si256(shifter)), simde_mm256_set1_epi64x(INT64_C(1023))), 52)));
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
 simde_mm_pow_ps (simde__m128 a, simde__m128 b) {
@@ -8611,6 +10829,27 @@ simde_mm_pow_ps (simde__m128 a, simde__m128 b) {
     return _mm_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_powf4_u10(a, b);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_powf4_u10advsimd(a, b);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a <= 0, infinities and NaNs have too many special cases to be worth it. */
+    simde__m128 special = simde_mm_or_ps(simde_mm_cmple_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.0))), simde_mm_cmpeq_ps(a, simde_mm_set1_ps(SIMDE_MATH_INFINITYF)));
+    special = simde_mm_or_ps(special, simde_mm_cmpeq_ps(simde_x_mm_abs_ps(b), simde_mm_set1_ps(SIMDE_MATH_INFINITYF)));
+    special = simde_mm_or_ps(special, simde_mm_cmpunord_ps(a, b));
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(special) != 0)) {
+      simde__m128_private
+        r_,
+        a_ = simde__m128_to_private(a),
+        b_ = simde__m128_to_private(b);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
+      }
+
+      return simde__m128_from_private(r_);
+    }
+
+    return simde_mm256_cvtpd_ps(simde_x_mm256_powf_pd(simde_mm256_cvtps_pd(a), simde_mm256_cvtps_pd(b)));
   #else
     simde__m128_private
       r_,
@@ -8637,6 +10876,27 @@ simde_mm_pow_pd (simde__m128d a, simde__m128d b) {
     return _mm_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_powd2_u10(a, b);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_powd2_u10advsimd(a, b);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE < 1)
+    /* a <= 0, infinities and NaNs have too many special cases to be worth it. */
+    simde__m128d special = simde_mm_or_pd(simde_mm_cmple_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0))), simde_mm_cmpeq_pd(a, simde_mm_set1_pd(SIMDE_MATH_INFINITY)));
+    special = simde_mm_or_pd(special, simde_mm_cmpeq_pd(simde_x_mm_abs_pd(b), simde_mm_set1_pd(SIMDE_MATH_INFINITY)));
+    special = simde_mm_or_pd(special, simde_mm_cmpunord_pd(a, b));
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(special) != 0)) {
+      simde__m128d_private
+        r_,
+        a_ = simde__m128d_to_private(a),
+        b_ = simde__m128d_to_private(b);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+
+      return simde__m128d_from_private(r_);
+    }
+
+    return simde_mm_exp_pd(simde_mm_mul_pd(b, simde_mm_log_pd(a)));
   #else
     simde__m128d_private
       r_,
@@ -8663,6 +10923,37 @@ simde_mm256_pow_ps (simde__m256 a, simde__m256 b) {
     return _mm256_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_powf8_u10(a, b);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a),
+      b_ = simde__m256_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_pow_ps(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* a <= 0, infinities and NaNs have too many special cases to be worth it. */
+    simde__m256 special = simde_mm256_or_ps(simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.0)), SIMDE_CMP_NGT_UQ), simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_EQ_OQ));
+    special = simde_mm256_or_ps(special, simde_mm256_cmp_ps(simde_x_mm256_abs_ps(b), simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ));
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(special) != 0)) {
+      simde__m256_private
+        r_,
+        a_ = simde__m256_to_private(a),
+        b_ = simde__m256_to_private(b);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
+      }
+
+      return simde__m256_from_private(r_);
+    }
+
+    simde__m128 lo = simde_mm256_cvtpd_ps(simde_x_mm256_powf_pd(simde_mm256_cvtps_pd(simde_mm256_castps256_ps128(a)), simde_mm256_cvtps_pd(simde_mm256_castps256_ps128(b))));
+    simde__m128 hi = simde_mm256_cvtpd_ps(simde_x_mm256_powf_pd(simde_mm256_cvtps_pd(simde_mm256_extractf128_ps(a, 1)), simde_mm256_cvtps_pd(simde_mm256_extractf128_ps(b, 1))));
+    return simde_mm256_insertf128_ps(simde_mm256_castps128_ps256(lo), hi, 1);
   #else
     simde__m256_private
       r_,
@@ -8690,6 +10981,35 @@ simde_mm256_pow_pd (simde__m256d a, simde__m256d b) {
     return _mm256_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_powd4_u10(a, b);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a),
+      b_ = simde__m256d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_pow_pd(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE < 1)
+    /* a <= 0, infinities and NaNs have too many special cases to be worth it. */
+    simde__m256d special = simde_mm256_or_pd(simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_NGT_UQ), simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_EQ_OQ));
+    special = simde_mm256_or_pd(special, simde_mm256_cmp_pd(simde_x_mm256_abs_pd(b), simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(special) != 0)) {
+      simde__m256d_private
+        r_,
+        a_ = simde__m256d_to_private(a),
+        b_ = simde__m256d_to_private(b);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+
+      return simde__m256d_from_private(r_);
+    }
+
+    return simde_mm256_exp_pd(simde_mm256_mul_pd(b, simde_mm256_log_pd(a)));
   #else
     simde__m256d_private
       r_,
@@ -8716,6 +11036,28 @@ simde_mm512_pow_ps (simde__m512 a, simde__m512 b) {
     return _mm512_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_powf16_u10(a, b);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_pow_ps(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+      r_.m256[i] = simde_mm256_pow_ps(a_.m256[i], b_.m256[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -8742,6 +11084,35 @@ simde_mm512_pow_pd (simde__m512d a, simde__m512d b) {
     return _mm512_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_powd8_u10(a, b);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_pow_pd(a_.m128[i], b_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE < 1)
+    /* a <= 0, infinities and NaNs have too many special cases to be worth it. */
+    simde__mmask8 special = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0)), SIMDE_CMP_NGT_UQ) | simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_EQ_OQ));
+    special = HEDLEY_STATIC_CAST(simde__mmask8, special | simde_mm512_cmp_pd_mask(simde_mm512_abs_pd(b), simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+    if (HEDLEY_UNLIKELY(special != 0)) {
+      simde__m512d_private
+        r_,
+        a_ = simde__m512d_to_private(a),
+        b_ = simde__m512d_to_private(b);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+
+      return simde__m512d_from_private(r_);
+    }
+
+    return simde_mm512_exp_pd(simde_mm512_mul_pd(b, simde_mm512_log_pd(a)));
   #else
     simde__m512d_private
       r_,
@@ -9852,6 +12223,51 @@ simde_mm_sin_ps (simde__m128 a) {
     #else
       return Sleef_sinf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_sinf4_u10advsimd(a);
+    #else
+      return Sleef_sinf4_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(simde_mm_cmpgt_ps(simde_x_mm_abs_ps(a), simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)))) != 0)) {
+      simde__m128_private
+        r_,
+        a_ = simde__m128_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_sinf(a_.f32[i]);
+      }
+
+      return simde__m128_from_private(r_);
+    }
+
+    const simde__m128 shifter = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m128 k = simde_mm_fmadd_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m128 n = simde_mm_sub_ps(k, shifter);
+    simde__m128 r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m128i q = simde_mm_castps_si128(k);
+    simde__m128 z = simde_mm_mul_ps(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m128 s = simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+    s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+    s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+    s = simde_mm_fmadd_ps(simde_mm_mul_ps(s, z), r, r);
+    simde__m128 c = simde_mm_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5));
+    c = simde_mm_fmadd_ps(c, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+    c = simde_mm_fmadd_ps(c, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+    c = simde_mm_fmadd_ps(simde_mm_mul_ps(c, z), z, simde_mm_fmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.5)), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Quadrant n: odd n swaps sin and cos, n & 2 flips the sign. */
+    r = simde_mm_blendv_ps(s, c, simde_mm_castsi128_ps(simde_mm_slli_epi32(q, 31)));
+    return simde_mm_xor_ps(r, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_and_si128(q, simde_mm_set1_epi32(INT32_C(2))), 30)));
   #else
     simde__m128_private
       r_,
@@ -9881,6 +12297,59 @@ simde_mm_sin_pd (simde__m128d a) {
     #else
       return Sleef_sind2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_sind2_u10advsimd(a);
+    #else
+      return Sleef_sind2_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(simde_mm_cmpgt_pd(simde_x_mm_abs_pd(a), simde_mm_set1_pd(SIMDE_FLOAT64_C(67108864.0)))) != 0)) {
+      simde__m128d_private
+        r_,
+        a_ = simde__m128d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_sin(a_.f64[i]);
+      }
+
+      return simde__m128d_from_private(r_);
+    }
+
+    const simde__m128d shifter = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m128d k = simde_mm_fmadd_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m128d n = simde_mm_sub_pd(k, shifter);
+    simde__m128d r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m128i q = simde_mm_castpd_si128(k);
+    simde__m128d z = simde_mm_mul_pd(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m128d s = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.58962301576546568060e-10));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.50507477628578072866e-8)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.75573136213857245213e-6)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.98412698295895385996e-4)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(8.33333333332211858878e-3)));
+    s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666307295e-1)));
+    s = simde_mm_fmadd_pd(simde_mm_mul_pd(s, z), r, r);
+    simde__m128d c = simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.13585365213876817300e-11));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.08757008419747316778e-9)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.75573141792967388112e-7)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.48015872888517045348e-5)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.38888888888730564116e-3)));
+    c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.16666666666665929218e-2)));
+    c = simde_mm_fmadd_pd(simde_mm_mul_pd(c, z), z, simde_mm_fmadd_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.5)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Quadrant n: odd n swaps sin and cos, n & 2 flips the sign. */
+    r = simde_mm_blendv_pd(s, c, simde_mm_castsi128_pd(simde_mm_slli_epi64(q, 63)));
+    return simde_mm_xor_pd(r, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_and_si128(q, simde_mm_set1_epi64x(INT64_C(2))), 62)));
   #else
     simde__m128d_private
       r_,
@@ -9910,6 +12379,55 @@ simde_mm256_sin_ps (simde__m256 a) {
     #else
       return Sleef_sinf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sin_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(simde_mm256_cmp_ps(simde_x_mm256_abs_ps(a), simde_mm256_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ)) != 0)) {
+      simde__m256_private
+        r_,
+        a_ = simde__m256_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_sinf(a_.f32[i]);
+      }
+
+      return simde__m256_from_private(r_);
+    }
+
+    const simde__m256 shifter = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m256 k = simde_mm256_fmadd_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m256 n = simde_mm256_sub_ps(k, shifter);
+    simde__m256 r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m256i q = simde_mm256_castps_si256(k);
+    simde__m256 z = simde_mm256_mul_ps(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m256 s = simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+    s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+    s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+    s = simde_mm256_fmadd_ps(simde_mm256_mul_ps(s, z), r, r);
+    simde__m256 c = simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5));
+    c = simde_mm256_fmadd_ps(c, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+    c = simde_mm256_fmadd_ps(c, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+    c = simde_mm256_fmadd_ps(simde_mm256_mul_ps(c, z), z, simde_mm256_fmadd_ps(z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.5)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Quadrant n: odd n swaps sin and cos, n & 2 flips the sign. */
+    r = simde_mm256_blendv_ps(s, c, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(q, 31)));
+    return simde_mm256_xor_ps(r, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_and_si256(q, simde_mm256_set1_epi32(INT32_C(2))), 30)));
   #else
     simde__m256_private
       r_,
@@ -9946,6 +12464,63 @@ simde_mm256_sin_pd (simde__m256d a) {
     #else
       return Sleef_sind4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sin_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(simde_mm256_cmp_pd(simde_x_mm256_abs_pd(a), simde_mm256_set1_pd(SIMDE_FLOAT64_C(67108864.0)), SIMDE_CMP_GT_OQ)) != 0)) {
+      simde__m256d_private
+        r_,
+        a_ = simde__m256d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_sin(a_.f64[i]);
+      }
+
+      return simde__m256d_from_private(r_);
+    }
+
+    const simde__m256d shifter = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m256d k = simde_mm256_fmadd_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m256d n = simde_mm256_sub_pd(k, shifter);
+    simde__m256d r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m256i q = simde_mm256_castpd_si256(k);
+    simde__m256d z = simde_mm256_mul_pd(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m256d s = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.58962301576546568060e-10));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.50507477628578072866e-8)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.75573136213857245213e-6)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.98412698295895385996e-4)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(8.33333333332211858878e-3)));
+    s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666307295e-1)));
+    s = simde_mm256_fmadd_pd(simde_mm256_mul_pd(s, z), r, r);
+    simde__m256d c = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.13585365213876817300e-11));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.08757008419747316778e-9)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.75573141792967388112e-7)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.48015872888517045348e-5)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.38888888888730564116e-3)));
+    c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.16666666666665929218e-2)));
+    c = simde_mm256_fmadd_pd(simde_mm256_mul_pd(c, z), z, simde_mm256_fmadd_pd(z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.5)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Quadrant n: odd n swaps sin and cos, n & 2 flips the sign. */
+    r = simde_mm256_blendv_pd(s, c, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(q, 63)));
+    return simde_mm256_xor_pd(r, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_and_si256(q, simde_mm256_set1_epi64x(INT64_C(2))), 62)));
   #else
     simde__m256d_private
       r_,
@@ -9981,6 +12556,55 @@ simde_mm512_sin_ps (simde__m512 a) {
     #else
       return Sleef_sinf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sin_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm512_cmp_ps_mask(simde_mm512_abs_ps(a), simde_mm512_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ) != 0)) {
+      simde__m512_private
+        r_,
+        a_ = simde__m512_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_sinf(a_.f32[i]);
+      }
+
+      return simde__m512_from_private(r_);
+    }
+
+    const simde__m512 shifter = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m512 k = simde_mm512_fmadd_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m512 n = simde_mm512_sub_ps(k, shifter);
+    simde__m512 r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m512i q = simde_mm512_castps_si512(k);
+    simde__m512 z = simde_mm512_mul_ps(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m512 s = simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4));
+    s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+    s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+    s = simde_mm512_fmadd_ps(simde_mm512_mul_ps(s, z), r, r);
+    simde__m512 c = simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5));
+    c = simde_mm512_fmadd_ps(c, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+    c = simde_mm512_fmadd_ps(c, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+    c = simde_mm512_fmadd_ps(simde_mm512_mul_ps(c, z), z, simde_mm512_fmadd_ps(z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.5)), simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Quadrant n: odd n swaps sin and cos, n & 2 flips the sign. */
+    r = simde_mm512_mask_blend_ps(simde_mm512_test_epi32_mask(q, simde_mm512_set1_epi32(INT32_C(1))), s, c);
+    return simde_mm512_xor_ps(r, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_and_si512(q, simde_mm512_set1_epi32(INT32_C(2))), 30)));
   #else
     simde__m512_private
       r_,
@@ -10016,6 +12640,63 @@ simde_mm512_sin_pd (simde__m512d a) {
     #else
       return Sleef_sind8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sin_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm512_cmp_pd_mask(simde_mm512_abs_pd(a), simde_mm512_set1_pd(SIMDE_FLOAT64_C(67108864.0)), SIMDE_CMP_GT_OQ) != 0)) {
+      simde__m512d_private
+        r_,
+        a_ = simde__m512d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_sin(a_.f64[i]);
+      }
+
+      return simde__m512d_from_private(r_);
+    }
+
+    const simde__m512d shifter = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m512d k = simde_mm512_fmadd_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m512d n = simde_mm512_sub_pd(k, shifter);
+    simde__m512d r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m512i q = simde_mm512_castpd_si512(k);
+    simde__m512d z = simde_mm512_mul_pd(r, r);
+
+    /* sin(r) = r + r^3 * S(r^2), cos(r) = 1 - r^2 / 2 + r^4 * C(r^2) */
+    simde__m512d s = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.58962301576546568060e-10));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.50507477628578072866e-8)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.75573136213857245213e-6)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.98412698295895385996e-4)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(8.33333333332211858878e-3)));
+    s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666307295e-1)));
+    s = simde_mm512_fmadd_pd(simde_mm512_mul_pd(s, z), r, r);
+    simde__m512d c = simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.13585365213876817300e-11));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.08757008419747316778e-9)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.75573141792967388112e-7)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.48015872888517045348e-5)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.38888888888730564116e-3)));
+    c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.16666666666665929218e-2)));
+    c = simde_mm512_fmadd_pd(simde_mm512_mul_pd(c, z), z, simde_mm512_fmadd_pd(z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.5)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Quadrant n: odd n swaps sin and cos, n & 2 flips the sign. */
+    r = simde_mm512_mask_blend_pd(simde_mm512_test_epi64_mask(q, simde_mm512_set1_epi64(INT64_C(1))), s, c);
+    return simde_mm512_xor_pd(r, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_and_si512(q, simde_mm512_set1_epi64(INT64_C(2))), 62)));
   #else
     simde__m512d_private
       r_,
@@ -10082,6 +12763,17 @@ simde_mm_sincos_ps (simde__m128* mem_addr, simde__m128 a) {
       temp = Sleef_sincosf4_u35(a);
     #endif
 
+    *mem_addr = temp.y;
+    return temp.x;
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    Sleef_float32x4_t_2 temp;
+
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      temp = Sleef_sincosf4_u10advsimd(a);
+    #else
+      temp = Sleef_sincosf4_u35advsimd(a);
+    #endif
+
     *mem_addr = temp.y;
     return temp.x;
   #else
@@ -10107,9 +12799,20 @@ simde_mm_sincos_pd (simde__m128d* mem_addr, simde__m128d a) {
     Sleef___m128d_2 temp;
 
     #if SIMDE_ACCURACY_PREFERENCE > 1
-      temp = Sleef_sincosd2_u10(a);
+      temp = Sleef_sincosd2_u10(a);
+    #else
+      temp = Sleef_sincosd2_u35(a);
+    #endif
+
+    *mem_addr = temp.y;
+    return temp.x;
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    Sleef_float64x2_t_2 temp;
+
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      temp = Sleef_sincosd2_u10advsimd(a);
     #else
-      temp = Sleef_sincosd2_u35(a);
+      temp = Sleef_sincosd2_u35advsimd(a);
     #endif
 
     *mem_addr = temp.y;
@@ -10144,6 +12847,18 @@ simde_mm256_sincos_ps (simde__m256* mem_addr, simde__m256 a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      c_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sincos_ps(&(c_.m128[i]), a_.m128[i]);
+    }
+
+    *mem_addr = simde__m256_from_private(c_);
+    return simde__m256_from_private(r_);
   #else
     simde__m256 r;
 
@@ -10174,6 +12889,18 @@ simde_mm256_sincos_pd (simde__m256d* mem_addr, simde__m256d a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      c_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sincos_pd(&(c_.m128[i]), a_.m128[i]);
+    }
+
+    *mem_addr = simde__m256d_from_private(c_);
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d r;
 
@@ -10204,6 +12931,18 @@ simde_mm512_sincos_ps (simde__m512* mem_addr, simde__m512 a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      c_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sincos_ps(&(c_.m128[i]), a_.m128[i]);
+    }
+
+    *mem_addr = simde__m512_from_private(c_);
+    return simde__m512_from_private(r_);
   #else
     simde__m512 r;
 
@@ -10234,6 +12973,18 @@ simde_mm512_sincos_pd (simde__m512d* mem_addr, simde__m512d a) {
 
     *mem_addr = temp.y;
     return temp.x;
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      c_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sincos_pd(&(c_.m128[i]), a_.m128[i]);
+    }
+
+    *mem_addr = simde__m512d_from_private(c_);
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d r;
 
@@ -10293,6 +13044,12 @@ simde_mm_sind_ps (simde__m128 a) {
     #else
       return Sleef_sinf4_u35(simde_x_mm_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_sinf4_u10advsimd(simde_x_mm_deg2rad_ps(a));
+    #else
+      return Sleef_sinf4_u35advsimd(simde_x_mm_deg2rad_ps(a));
+    #endif
   #else
     simde__m128_private
       r_,
@@ -10322,6 +13079,12 @@ simde_mm_sind_pd (simde__m128d a) {
     #else
       return Sleef_sind2_u35(simde_x_mm_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_sind2_u10advsimd(simde_x_mm_deg2rad_pd(a));
+    #else
+      return Sleef_sind2_u35advsimd(simde_x_mm_deg2rad_pd(a));
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -10351,6 +13114,16 @@ simde_mm256_sind_ps (simde__m256 a) {
     #else
       return Sleef_sinf8_u35(simde_x_mm256_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sind_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -10386,6 +13159,16 @@ simde_mm256_sind_pd (simde__m256d a) {
     #else
       return Sleef_sind4_u35(simde_x_mm256_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sind_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -10421,6 +13204,16 @@ simde_mm512_sind_ps (simde__m512 a) {
     #else
       return Sleef_sinf16_u35(simde_x_mm512_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sind_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -10456,6 +13249,16 @@ simde_mm512_sind_pd (simde__m512d a) {
     #else
       return Sleef_sind8_u35(simde_x_mm512_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sind_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -10516,6 +13319,8 @@ simde_mm_sinh_ps (simde__m128 a) {
     return _mm_sinh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_sinhf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_sinhf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -10541,6 +13346,8 @@ simde_mm_sinh_pd (simde__m128d a) {
     return _mm_sinh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_sinhd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_sinhd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -10566,6 +13373,16 @@ simde_mm256_sinh_ps (simde__m256 a) {
     return _mm256_sinh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_sinhf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sinh_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -10598,6 +13415,16 @@ simde_mm256_sinh_pd (simde__m256d a) {
     return _mm256_sinh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_sinhd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sinh_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -10629,6 +13456,16 @@ simde_mm512_sinh_ps (simde__m512 a) {
     return _mm512_sinh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_sinhf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sinh_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -10660,6 +13497,16 @@ simde_mm512_sinh_pd (simde__m512d a) {
     return _mm512_sinh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_sinhd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_sinh_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -11285,6 +14132,49 @@ simde_mm_tan_ps (simde__m128 a) {
     #else
       return Sleef_tanf4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_tanf4_u10advsimd(a);
+    #else
+      return Sleef_tanf4_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(simde_mm_cmpgt_ps(simde_x_mm_abs_ps(a), simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)))) != 0)) {
+      simde__m128_private
+        r_,
+        a_ = simde__m128_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_tanf(a_.f32[i]);
+      }
+
+      return simde__m128_from_private(r_);
+    }
+
+    const simde__m128 shifter = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m128 k = simde_mm_fmadd_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m128 n = simde_mm_sub_ps(k, shifter);
+    simde__m128 r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m128i q = simde_mm_castps_si128(k);
+    simde__m128 z = simde_mm_mul_ps(r, r);
+
+    /* tan(r) = r + r^3 * P(r^2) */
+    simde__m128 t = simde_mm_set1_ps(SIMDE_FLOAT32_C(9.38540185543e-3));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.11992232697e-3)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.44301354525e-2)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.34112807005e-2)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.33387994085e-1)));
+    t = simde_mm_fmadd_ps(t, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.33331568548e-1)));
+    t = simde_mm_fmadd_ps(simde_mm_mul_ps(t, z), r, r);
+
+    /* tan(a) = -1 / tan(r) for odd n */
+    return simde_mm_blendv_ps(t, simde_mm_div_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.0)), t), simde_mm_castsi128_ps(simde_mm_slli_epi32(q, 31)));
   #else
     simde__m128_private
       r_,
@@ -11314,6 +14204,53 @@ simde_mm_tan_pd (simde__m128d a) {
     #else
       return Sleef_tand2_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_tand2_u10advsimd(a);
+    #else
+      return Sleef_tand2_u35advsimd(a);
+    #endif
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(simde_mm_cmpgt_pd(simde_x_mm_abs_pd(a), simde_mm_set1_pd(SIMDE_FLOAT64_C(67108864.0)))) != 0)) {
+      simde__m128d_private
+        r_,
+        a_ = simde__m128d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_tan(a_.f64[i]);
+      }
+
+      return simde__m128d_from_private(r_);
+    }
+
+    const simde__m128d shifter = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m128d k = simde_mm_fmadd_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m128d n = simde_mm_sub_pd(k, shifter);
+    simde__m128d r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m128i q = simde_mm_castpd_si128(k);
+    simde__m128d z = simde_mm_mul_pd(r, r);
+
+    /* tan(r) = r + r^3 * P(r^2) / Q(r^2) */
+    simde__m128d tp = simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.30936939181383777646e4));
+    tp = simde_mm_fmadd_pd(tp, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.15351664838587416140e6)));
+    tp = simde_mm_fmadd_pd(tp, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.79565251976484877988e7)));
+    simde__m128d tq = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+    tq = simde_mm_fmadd_pd(tq, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.36812963470692954678e4)));
+    tq = simde_mm_fmadd_pd(tq, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.32089234440210967447e6)));
+    tq = simde_mm_fmadd_pd(tq, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.50083801823357915839e7)));
+    tq = simde_mm_fmadd_pd(tq, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.38695755929454629881e7)));
+    simde__m128d t = simde_mm_fmadd_pd(simde_mm_mul_pd(z, simde_mm_div_pd(tp, tq)), r, r);
+
+    /* tan(a) = -1 / tan(r) for odd n */
+    return simde_mm_blendv_pd(t, simde_mm_div_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.0)), t), simde_mm_castsi128_pd(simde_mm_slli_epi64(q, 63)));
   #else
     simde__m128d_private
       r_,
@@ -11343,6 +14280,53 @@ simde_mm256_tan_ps (simde__m256 a) {
     #else
       return Sleef_tanf8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tan_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(simde_mm256_cmp_ps(simde_x_mm256_abs_ps(a), simde_mm256_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ)) != 0)) {
+      simde__m256_private
+        r_,
+        a_ = simde__m256_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_tanf(a_.f32[i]);
+      }
+
+      return simde__m256_from_private(r_);
+    }
+
+    const simde__m256 shifter = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m256 k = simde_mm256_fmadd_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m256 n = simde_mm256_sub_ps(k, shifter);
+    simde__m256 r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m256i q = simde_mm256_castps_si256(k);
+    simde__m256 z = simde_mm256_mul_ps(r, r);
+
+    /* tan(r) = r + r^3 * P(r^2) */
+    simde__m256 t = simde_mm256_set1_ps(SIMDE_FLOAT32_C(9.38540185543e-3));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.11992232697e-3)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.44301354525e-2)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.34112807005e-2)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.33387994085e-1)));
+    t = simde_mm256_fmadd_ps(t, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.33331568548e-1)));
+    t = simde_mm256_fmadd_ps(simde_mm256_mul_ps(t, z), r, r);
+
+    /* tan(a) = -1 / tan(r) for odd n */
+    return simde_mm256_blendv_ps(t, simde_mm256_div_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.0)), t), simde_mm256_castsi256_ps(simde_mm256_slli_epi32(q, 31)));
   #else
     simde__m256_private
       r_,
@@ -11379,6 +14363,57 @@ simde_mm256_tan_pd (simde__m256d a) {
     #else
       return Sleef_tand4_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tan_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(simde_mm256_cmp_pd(simde_x_mm256_abs_pd(a), simde_mm256_set1_pd(SIMDE_FLOAT64_C(67108864.0)), SIMDE_CMP_GT_OQ)) != 0)) {
+      simde__m256d_private
+        r_,
+        a_ = simde__m256d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_tan(a_.f64[i]);
+      }
+
+      return simde__m256d_from_private(r_);
+    }
+
+    const simde__m256d shifter = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m256d k = simde_mm256_fmadd_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m256d n = simde_mm256_sub_pd(k, shifter);
+    simde__m256d r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m256i q = simde_mm256_castpd_si256(k);
+    simde__m256d z = simde_mm256_mul_pd(r, r);
+
+    /* tan(r) = r + r^3 * P(r^2) / Q(r^2) */
+    simde__m256d tp = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.30936939181383777646e4));
+    tp = simde_mm256_fmadd_pd(tp, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.15351664838587416140e6)));
+    tp = simde_mm256_fmadd_pd(tp, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.79565251976484877988e7)));
+    simde__m256d tq = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+    tq = simde_mm256_fmadd_pd(tq, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.36812963470692954678e4)));
+    tq = simde_mm256_fmadd_pd(tq, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.32089234440210967447e6)));
+    tq = simde_mm256_fmadd_pd(tq, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.50083801823357915839e7)));
+    tq = simde_mm256_fmadd_pd(tq, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-5.38695755929454629881e7)));
+    simde__m256d t = simde_mm256_fmadd_pd(simde_mm256_mul_pd(z, simde_mm256_div_pd(tp, tq)), r, r);
+
+    /* tan(a) = -1 / tan(r) for odd n */
+    return simde_mm256_blendv_pd(t, simde_mm256_div_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.0)), t), simde_mm256_castsi256_pd(simde_mm256_slli_epi64(q, 63)));
   #else
     simde__m256d_private
       r_,
@@ -11414,6 +14449,53 @@ simde_mm512_tan_ps (simde__m512 a) {
     #else
       return Sleef_tanf16_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tan_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm512_cmp_ps_mask(simde_mm512_abs_ps(a), simde_mm512_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ) != 0)) {
+      simde__m512_private
+        r_,
+        a_ = simde__m512_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_tanf(a_.f32[i]);
+      }
+
+      return simde__m512_from_private(r_);
+    }
+
+    const simde__m512 shifter = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4 */
+    simde__m512 k = simde_mm512_fmadd_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343076)), shifter);
+    simde__m512 n = simde_mm512_sub_ps(k, shifter);
+    simde__m512 r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.5703125)), a);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-4.8351287841796875e-4)), r);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-3.13855707645416259765625e-7)), r);
+    r = simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-6.077100628276710381e-11)), r);
+    simde__m512i q = simde_mm512_castps_si512(k);
+    simde__m512 z = simde_mm512_mul_ps(r, r);
+
+    /* tan(r) = r + r^3 * P(r^2) */
+    simde__m512 t = simde_mm512_set1_ps(SIMDE_FLOAT32_C(9.38540185543e-3));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.11992232697e-3)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.44301354525e-2)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.34112807005e-2)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.33387994085e-1)));
+    t = simde_mm512_fmadd_ps(t, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.33331568548e-1)));
+    t = simde_mm512_fmadd_ps(simde_mm512_mul_ps(t, z), r, r);
+
+    /* tan(a) = -1 / tan(r) for odd n */
+    return simde_mm512_mask_blend_ps(simde_mm512_test_epi32_mask(q, simde_mm512_set1_epi32(INT32_C(1))), t, simde_mm512_div_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.0)), t));
   #else
     simde__m512_private
       r_,
@@ -11449,6 +14531,57 @@ simde_mm512_tan_pd (simde__m512d a) {
     #else
       return Sleef_tand8_u35(a);
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tan_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #elif (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+    /* The reduction below loses accuracy for large |a|; leave those to libm. */
+    if (HEDLEY_UNLIKELY(simde_mm512_cmp_pd_mask(simde_mm512_abs_pd(a), simde_mm512_set1_pd(SIMDE_FLOAT64_C(67108864.0)), SIMDE_CMP_GT_OQ) != 0)) {
+      simde__m512d_private
+        r_,
+        a_ = simde__m512d_to_private(a);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_tan(a_.f64[i]);
+      }
+
+      return simde__m512d_from_private(r_);
+    }
+
+    const simde__m512d shifter = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+
+    /* a = n * (pi / 2) + r, |r| <= pi / 4.  pi / 2 is split into pieces
+     * of at most 27 bits so that n * piece is exact for |n| < 2^26. */
+    simde__m512d k = simde_mm512_fmadd_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343076)), shifter);
+    simde__m512d n = simde_mm512_sub_pd(k, shifter);
+    simde__m512d r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.57079632580280303955e0)), a);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-9.92093573959351715530e-10)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-5.72118870966357490380e-18)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.64462568929652071576e-26)), r);
+    r = simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-4.33590506506189029566e-35)), r);
+    simde__m512i q = simde_mm512_castpd_si512(k);
+    simde__m512d z = simde_mm512_mul_pd(r, r);
+
+    /* tan(r) = r + r^3 * P(r^2) / Q(r^2) */
+    simde__m512d tp = simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.30936939181383777646e4));
+    tp = simde_mm512_fmadd_pd(tp, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.15351664838587416140e6)));
+    tp = simde_mm512_fmadd_pd(tp, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.79565251976484877988e7)));
+    simde__m512d tq = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+    tq = simde_mm512_fmadd_pd(tq, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.36812963470692954678e4)));
+    tq = simde_mm512_fmadd_pd(tq, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.32089234440210967447e6)));
+    tq = simde_mm512_fmadd_pd(tq, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.50083801823357915839e7)));
+    tq = simde_mm512_fmadd_pd(tq, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-5.38695755929454629881e7)));
+    simde__m512d t = simde_mm512_fmadd_pd(simde_mm512_mul_pd(z, simde_mm512_div_pd(tp, tq)), r, r);
+
+    /* tan(a) = -1 / tan(r) for odd n */
+    return simde_mm512_mask_blend_pd(simde_mm512_test_epi64_mask(q, simde_mm512_set1_epi64(INT64_C(1))), t, simde_mm512_div_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.0)), t));
   #else
     simde__m512d_private
       r_,
@@ -11512,6 +14645,12 @@ simde_mm_tand_ps (simde__m128 a) {
     #else
       return Sleef_tanf4_u35(simde_x_mm_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_tanf4_u10advsimd(simde_x_mm_deg2rad_ps(a));
+    #else
+      return Sleef_tanf4_u35advsimd(simde_x_mm_deg2rad_ps(a));
+    #endif
   #else
     simde__m128_private
       r_,
@@ -11541,6 +14680,12 @@ simde_mm_tand_pd (simde__m128d a) {
     #else
       return Sleef_tand2_u35(simde_x_mm_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    #if SIMDE_ACCURACY_PREFERENCE > 1
+      return Sleef_tand2_u10advsimd(simde_x_mm_deg2rad_pd(a));
+    #else
+      return Sleef_tand2_u35advsimd(simde_x_mm_deg2rad_pd(a));
+    #endif
   #else
     simde__m128d_private
       r_,
@@ -11570,6 +14715,16 @@ simde_mm256_tand_ps (simde__m256 a) {
     #else
       return Sleef_tanf8_u35(simde_x_mm256_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tand_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -11605,6 +14760,16 @@ simde_mm256_tand_pd (simde__m256d a) {
     #else
       return Sleef_tand4_u35(simde_x_mm256_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tand_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -11640,6 +14805,16 @@ simde_mm512_tand_ps (simde__m512 a) {
     #else
       return Sleef_tanf16_u35(simde_x_mm512_deg2rad_ps(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tand_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -11675,6 +14850,16 @@ simde_mm512_tand_pd (simde__m512d a) {
     #else
       return Sleef_tand8_u35(simde_x_mm512_deg2rad_pd(a));
     #endif
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tand_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -11734,6 +14919,8 @@ simde_mm_tanh_ps (simde__m128 a) {
     return _mm_tanh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_tanhf4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_tanhf4_u10advsimd(a);
   #else
     simde__m128_private
       r_,
@@ -11759,6 +14946,8 @@ simde_mm_tanh_pd (simde__m128d a) {
     return _mm_tanh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_tanhd2_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return Sleef_tanhd2_u10advsimd(a);
   #else
     simde__m128d_private
       r_,
@@ -11784,6 +14973,16 @@ simde_mm256_tanh_ps (simde__m256 a) {
     return _mm256_tanh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_tanhf8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tanh_ps(a_.m128[i]);
+    }
+
+    return simde__m256_from_private(r_);
   #else
     simde__m256_private
       r_,
@@ -11816,6 +15015,16 @@ simde_mm256_tanh_pd (simde__m256d a) {
     return _mm256_tanh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_tanhd4_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tanh_pd(a_.m128[i]);
+    }
+
+    return simde__m256d_from_private(r_);
   #else
     simde__m256d_private
       r_,
@@ -11847,6 +15056,16 @@ simde_mm512_tanh_ps (simde__m512 a) {
     return _mm512_tanh_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_tanhf16_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tanh_ps(a_.m128[i]);
+    }
+
+    return simde__m512_from_private(r_);
   #else
     simde__m512_private
       r_,
@@ -11878,6 +15097,16 @@ simde_mm512_tanh_pd (simde__m512d a) {
     return _mm512_tanh_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_tanhd8_u10(a);
+  #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+      r_.m128[i] = simde_mm_tanh_pd(a_.m128[i]);
+    }
+
+    return simde__m512d_from_private(r_);
   #else
     simde__m512d_private
       r_,
@@ -277,12 +277,309 @@ test_simde_vld3q_f16 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vld3q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[48];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    { { UINT8_C(247), UINT8_C( 53), UINT8_C(  2), UINT8_C(133), UINT8_C(188), UINT8_C(  9), UINT8_C( 40), UINT8_C(233),
+        UINT8_C(252), UINT8_C( 61), UINT8_C(  4), UINT8_C( 14), UINT8_C(225), UINT8_C(206), UINT8_C(174), UINT8_C( 37),
+        UINT8_C(219), UINT8_C(177), UINT8_C(255), UINT8_C( 94), UINT8_C( 61), UINT8_C( 29), UINT8_C( 86), UINT8_C(119),
+        UINT8_C(181), UINT8_C( 91), UINT8_C( 71), UINT8_C(100), UINT8_C( 67), UINT8_C( 88), UINT8_C( 58), UINT8_C(239),
+        UINT8_C(219), UINT8_C( 52), UINT8_C(223), UINT8_C( 90), UINT8_C(204), UINT8_C( 80), UINT8_C( 57), UINT8_C( 78),
+        UINT8_C(236), UINT8_C(186), UINT8_C(130), UINT8_C(107), UINT8_C( 59), UINT8_C(147), UINT8_C(116), UINT8_C(215) },
+      { { UINT8_C(247), UINT8_C(133), UINT8_C( 40), UINT8_C( 61), UINT8_C(225), UINT8_C( 37), UINT8_C(255), UINT8_C( 29),
+          UINT8_C(181), UINT8_C(100), UINT8_C( 58), UINT8_C( 52), UINT8_C(204), UINT8_C( 78), UINT8_C(130), UINT8_C(147) },
+        { UINT8_C( 53), UINT8_C(188), UINT8_C(233), UINT8_C(  4), UINT8_C(206), UINT8_C(219), UINT8_C( 94), UINT8_C( 86),
+          UINT8_C( 91), UINT8_C( 67), UINT8_C(239), UINT8_C(223), UINT8_C( 80), UINT8_C(236), UINT8_C(107), UINT8_C(116) },
+        { UINT8_C(  2), UINT8_C(  9), UINT8_C(252), UINT8_C( 14), UINT8_C(174), UINT8_C(177), UINT8_C( 61), UINT8_C(119),
+          UINT8_C( 71), UINT8_C( 88), UINT8_C(219), UINT8_C( 90), UINT8_C( 57), UINT8_C(186), UINT8_C( 59), UINT8_C(215) } } },
+    { { UINT8_C(107), UINT8_C(125), UINT8_C( 20), UINT8_C(118), UINT8_C(144), UINT8_C(204), UINT8_C( 92), UINT8_C(112),
+        UINT8_C(145), UINT8_C( 80), UINT8_C(238), UINT8_C(177), UINT8_C(165), UINT8_C(115), UINT8_C(103), UINT8_C(198),
+        UINT8_C(221), UINT8_C(207), UINT8_C(254), UINT8_C( 16), UINT8_C(125), UINT8_C(245), UINT8_C(241), UINT8_C(214),
+        UINT8_C(  4), UINT8_C( 50), UINT8_C( 35), UINT8_C(136), UINT8_C( 44), UINT8_C(157), UINT8_C(240), UINT8_C(200),
+        UINT8_C(176), UINT8_C(216), UINT8_C(184), UINT8_C(  4), UINT8_C( 73), UINT8_C(135), UINT8_C(126), UINT8_C( 38),
+        UINT8_C(227), UINT8_C(219), UINT8_C( 25), UINT8_C(228), UINT8_C( 29), UINT8_C(101), UINT8_C( 12), UINT8_C( 18) },
+      { { UINT8_C(107), UINT8_C(118), UINT8_C( 92), UINT8_C( 80), UINT8_C(165), UINT8_C(198), UINT8_C(254), UINT8_C(245),
+          UINT8_C(  4), UINT8_C(136), UINT8_C(240), UINT8_C(216), UINT8_C( 73), UINT8_C( 38), UINT8_C( 25), UINT8_C(101) },
+        { UINT8_C(125), UINT8_C(144), UINT8_C(112), UINT8_C(238), UINT8_C(115), UINT8_C(221), UINT8_C( 16), UINT8_C(241),
+          UINT8_C( 50), UINT8_C( 44), UINT8_C(200), UINT8_C(184), UINT8_C(135), UINT8_C(227), UINT8_C(228), UINT8_C( 12) },
+        { UINT8_C( 20), UINT8_C(204), UINT8_C(145), UINT8_C(177), UINT8_C(103), UINT8_C(207), UINT8_C(125), UINT8_C(214),
+          UINT8_C( 35), UINT8_C(157), UINT8_C(176), UINT8_C(  4), UINT8_C(126), UINT8_C(219), UINT8_C( 29), UINT8_C( 18) } } },
+    { { UINT8_C(119), UINT8_C(185), UINT8_C(215), UINT8_C(235), UINT8_C(142), UINT8_C( 75), UINT8_C(102), UINT8_C(236),
+        UINT8_C(128), UINT8_C( 59), UINT8_C( 45), UINT8_C(139), UINT8_C(242), UINT8_C(128), UINT8_C( 90), UINT8_C( 20),
+        UINT8_C( 60), UINT8_C( 79), UINT8_C( 79), UINT8_C( 42), UINT8_C(211), UINT8_C(160), UINT8_C( 81), UINT8_C( 99),
+        UINT8_C(231), UINT8_C(121), UINT8_C( 86), UINT8_C(222), UINT8_C(113), UINT8_C(200), UINT8_C( 18), UINT8_C(193),
+        UINT8_C(232), UINT8_C(214), UINT8_C(203), UINT8_C( 69), UINT8_C(121), UINT8_C( 36), UINT8_C( 29), UINT8_C(173),
+        UINT8_C(126), UINT8_C( 99), UINT8_C( 96), UINT8_C(  3), UINT8_C(215), UINT8_C( 66), UINT8_C(237), UINT8_C(247) },
+      { { UINT8_C(119), UINT8_C(235), UINT8_C(102), UINT8_C( 59), UINT8_C(242), UINT8_C( 20), UINT8_C( 79), UINT8_C(160),
+          UINT8_C(231), UINT8_C(222), UINT8_C( 18), UINT8_C(214), UINT8_C(121), UINT8_C(173), UINT8_C( 96), UINT8_C( 66) },
+        { UINT8_C(185), UINT8_C(142), UINT8_C(236), UINT8_C( 45), UINT8_C(128), UINT8_C( 60), UINT8_C( 42), UINT8_C( 81),
+          UINT8_C(121), UINT8_C(113), UINT8_C(193), UINT8_C(203), UINT8_C( 36), UINT8_C(126), UINT8_C(  3), UINT8_C(237) },
+        { UINT8_C(215), UINT8_C( 75), UINT8_C(128), UINT8_C(139), UINT8_C( 90), UINT8_C( 79), UINT8_C(211), UINT8_C( 99),
+          UINT8_C( 86), UINT8_C(200), UINT8_C(232), UINT8_C( 69), UINT8_C( 29), UINT8_C( 99), UINT8_C(215), UINT8_C(247) } } },
+    { { UINT8_C(189), UINT8_C( 23), UINT8_C( 73), UINT8_C( 16), UINT8_C( 10), UINT8_C(115), UINT8_C(228), UINT8_C( 15),
+        UINT8_C(241), UINT8_C( 65), UINT8_C( 40), UINT8_C(210), UINT8_C(127), UINT8_C(144), UINT8_C(123), UINT8_C(223),
+        UINT8_C(249), UINT8_C(127), UINT8_C( 11), UINT8_C(128), UINT8_C( 15), UINT8_C(121), UINT8_C(215), UINT8_C( 20),
+        UINT8_C(145), UINT8_C(245), UINT8_C(118), UINT8_C( 59), UINT8_C(199), UINT8_C(193), UINT8_C(151), UINT8_C(114),
+        UINT8_C(177), UINT8_C(184), UINT8_C( 65), UINT8_C(173), UINT8_C( 21), UINT8_C(156), UINT8_C(  2), UINT8_C( 14),
+        UINT8_C( 85), UINT8_C(192), UINT8_C(166), UINT8_C(213), UINT8_C( 97), UINT8_C(111), UINT8_C( 88), UINT8_C( 14) },
+      { { UINT8_C(189), UINT8_C( 16), UINT8_C(228), UINT8_C( 65), UINT8_C(127), UINT8_C(223), UINT8_C( 11), UINT8_C(121),
+          UINT8_C(145), UINT8_C( 59), UINT8_C(151), UINT8_C(184), UINT8_C( 21), UINT8_C( 14), UINT8_C(166), UINT8_C(111) },
+        { UINT8_C( 23), UINT8_C( 10), UINT8_C( 15), UINT8_C( 40), UINT8_C(144), UINT8_C(249), UINT8_C(128), UINT8_C(215),
+          UINT8_C(245), UINT8_C(199), UINT8_C(114), UINT8_C( 65), UINT8_C(156), UINT8_C( 85), UINT8_C(213), UINT8_C( 88) },
+        { UINT8_C( 73), UINT8_C(115), UINT8_C(241), UINT8_C(210), UINT8_C(123), UINT8_C(127), UINT8_C( 15), UINT8_C( 20),
+          UINT8_C(118), UINT8_C(193), UINT8_C(177), UINT8_C(173), UINT8_C(  2), UINT8_C(192), UINT8_C( 97), UINT8_C( 14) } } },
+    { { UINT8_C(158), UINT8_C(239), UINT8_C(180), UINT8_C( 77), UINT8_C(152), UINT8_C(114), UINT8_C( 79), UINT8_C(140),
+        UINT8_C(210), UINT8_C(  7), UINT8_C(204), UINT8_C(110), UINT8_C(228), UINT8_C(222), UINT8_C(228), UINT8_C( 98),
+        UINT8_C(  3), UINT8_C(228), UINT8_C(171), UINT8_C(234), UINT8_C( 89), UINT8_C(157), UINT8_C( 99), UINT8_C(232),
+        UINT8_C(132), UINT8_C(  0), UINT8_C( 36), UINT8_C( 64), UINT8_C( 63), UINT8_C(127), UINT8_C(252), UINT8_C(131),
+        UINT8_C( 84), UINT8_C( 83), UINT8_C(233), UINT8_C( 62), UINT8_C(175), UINT8_C(150), UINT8_C( 80), UINT8_C(125),
+        UINT8_C( 81), UINT8_C(  0), UINT8_C(154), UINT8_C( 90), UINT8_C(179), UINT8_C( 57), UINT8_C( 87), UINT8_C(236) },
+      { { UINT8_C(158), UINT8_C( 77), UINT8_C( 79), UINT8_C(  7), UINT8_C(228), UINT8_C( 98), UINT8_C(171), UINT8_C(157),
+          UINT8_C(132), UINT8_C( 64), UINT8_C(252), UINT8_C( 83), UINT8_C(175), UINT8_C(125), UINT8_C(154), UINT8_C( 57) },
+        { UINT8_C(239), UINT8_C(152), UINT8_C(140), UINT8_C(204), UINT8_C(222), UINT8_C(  3), UINT8_C(234), UINT8_C( 99),
+          UINT8_C(  0), UINT8_C( 63), UINT8_C(131), UINT8_C(233), UINT8_C(150), UINT8_C( 81), UINT8_C( 90), UINT8_C( 87) },
+        { UINT8_C(180), UINT8_C(114), UINT8_C(210), UINT8_C(110), UINT8_C(228), UINT8_C(228), UINT8_C( 89), UINT8_C(232),
+          UINT8_C( 36), UINT8_C(127), UINT8_C( 84), UINT8_C( 62), UINT8_C( 80), UINT8_C(  0), UINT8_C(179), UINT8_C(236) } } },
+    { { UINT8_C( 15), UINT8_C(218), UINT8_C( 44), UINT8_C(164), UINT8_C(220), UINT8_C(129), UINT8_C(186), UINT8_C(242),
+        UINT8_C( 27), UINT8_C(252), UINT8_C(213), UINT8_C(185), UINT8_C(147), UINT8_C(102), UINT8_C( 85), UINT8_C(223),
+        UINT8_C(228), UINT8_C(219), UINT8_C( 32), UINT8_C( 85), UINT8_C( 25), UINT8_C( 80), UINT8_C( 87), UINT8_C(117),
+        UINT8_C(188), UINT8_C(157), UINT8_C(140), UINT8_C(158), UINT8_C(123), UINT8_C(146), UINT8_C(232), UINT8_C( 31),
+        UINT8_C(100), UINT8_C(237), UINT8_C(201), UINT8_C(148), UINT8_C(  1), UINT8_C( 25), UINT8_C(200), UINT8_C(216),
+        UINT8_C( 39), UINT8_C(181), UINT8_C(167), UINT8_C(118), UINT8_C(214), UINT8_C( 40), UINT8_C(167), UINT8_C( 50) },
+      { { UINT8_C( 15), UINT8_C(164), UINT8_C(186), UINT8_C(252), UINT8_C(147), UINT8_C(223), UINT8_C( 32), UINT8_C( 80),
+          UINT8_C(188), UINT8_C(158), UINT8_C(232), UINT8_C(237), UINT8_C(  1), UINT8_C(216), UINT8_C(167), UINT8_C( 40) },
+        { UINT8_C(218), UINT8_C(220), UINT8_C(242), UINT8_C(213), UINT8_C(102), UINT8_C(228), UINT8_C( 85), UINT8_C( 87),
+          UINT8_C(157), UINT8_C(123), UINT8_C( 31), UINT8_C(201), UINT8_C( 25), UINT8_C( 39), UINT8_C(118), UINT8_C(167) },
+        { UINT8_C( 44), UINT8_C(129), UINT8_C( 27), UINT8_C(185), UINT8_C( 85), UINT8_C(219), UINT8_C( 25), UINT8_C(117),
+          UINT8_C(140), UINT8_C(146), UINT8_C(100), UINT8_C(148), UINT8_C(200), UINT8_C(181), UINT8_C(214), UINT8_C( 50) } } },
+    { { UINT8_C(148), UINT8_C(139), UINT8_C(140), UINT8_C(158), UINT8_C(192), UINT8_C( 82), UINT8_C( 94), UINT8_C(103),
+        UINT8_C( 59), UINT8_C(250), UINT8_C(142), UINT8_C(165), UINT8_C(133), UINT8_C(160), UINT8_C( 29), UINT8_C(254),
+        UINT8_C(135), UINT8_C(185), UINT8_C(119), UINT8_C(150), UINT8_C( 40), UINT8_C(212), UINT8_C(181), UINT8_C(175),
+        UINT8_C(199), UINT8_C(235), UINT8_C( 86), UINT8_C(117), UINT8_C(221), UINT8_C(154), UINT8_C(252), UINT8_C(145),
+        UINT8_C(169), UINT8_C(246), UINT8_C(104), UINT8_C(  7), UINT8_C( 69), UINT8_C( 86), UINT8_C( 33), UINT8_C(194),
+        UINT8_C( 69), UINT8_C( 91), UINT8_C(255), UINT8_C( 47), UINT8_C( 15), UINT8_C(119), UINT8_C(234), UINT8_C(254) },
+      { { UINT8_C(148), UINT8_C(158), UINT8_C( 94), UINT8_C(250), UINT8_C(133), UINT8_C(254), UINT8_C(119), UINT8_C(212),
+          UINT8_C(199), UINT8_C(117), UINT8_C(252), UINT8_C(246), UINT8_C( 69), UINT8_C(194), UINT8_C(255), UINT8_C(119) },
+        { UINT8_C(139), UINT8_C(192), UINT8_C(103), UINT8_C(142), UINT8_C(160), UINT8_C(135), UINT8_C(150), UINT8_C(181),
+          UINT8_C(235), UINT8_C(221), UINT8_C(145), UINT8_C(104), UINT8_C( 86), UINT8_C( 69), UINT8_C( 47), UINT8_C(234) },
+        { UINT8_C(140), UINT8_C( 82), UINT8_C( 59), UINT8_C(165), UINT8_C( 29), UINT8_C(185), UINT8_C( 40), UINT8_C(175),
+          UINT8_C( 86), UINT8_C(154), UINT8_C(169), UINT8_C(  7), UINT8_C( 33), UINT8_C( 91), UINT8_C( 15), UINT8_C(254) } } },
+    { { UINT8_C(178), UINT8_C(149), UINT8_C(200), UINT8_C( 54), UINT8_C( 25), UINT8_C( 17), UINT8_C(165), UINT8_C( 64),
+        UINT8_C( 52), UINT8_C(190), UINT8_C(173), UINT8_C( 18), UINT8_C(203), UINT8_C(225), UINT8_C(184), UINT8_C(113),
+        UINT8_C(137), UINT8_C( 41), UINT8_C(226), UINT8_C(227), UINT8_C( 58), UINT8_C( 82), UINT8_C( 40), UINT8_C(157),
+        UINT8_C(221), UINT8_C(224), UINT8_C( 14), UINT8_C( 94), UINT8_C(107), UINT8_C( 57), UINT8_C(107), UINT8_C(189),
+        UINT8_C(224), UINT8_C( 43), UINT8_C( 95), UINT8_C(192), UINT8_C(145), UINT8_C( 37), UINT8_C(128), UINT8_C( 44),
+        UINT8_C(122), UINT8_C(255), UINT8_C(121), UINT8_C(235), UINT8_C(119), UINT8_C(119), UINT8_C(152), UINT8_C( 43) },
+      { { UINT8_C(178), UINT8_C( 54), UINT8_C(165), UINT8_C(190), UINT8_C(203), UINT8_C(113), UINT8_C(226), UINT8_C( 82),
+          UINT8_C(221), UINT8_C( 94), UINT8_C(107), UINT8_C( 43), UINT8_C(145), UINT8_C( 44), UINT8_C(121), UINT8_C(119) },
+        { UINT8_C(149), UINT8_C( 25), UINT8_C( 64), UINT8_C(173), UINT8_C(225), UINT8_C(137), UINT8_C(227), UINT8_C( 40),
+          UINT8_C(224), UINT8_C(107), UINT8_C(189), UINT8_C( 95), UINT8_C( 37), UINT8_C(122), UINT8_C(235), UINT8_C(152) },
+        { UINT8_C(200), UINT8_C( 17), UINT8_C( 52), UINT8_C( 18), UINT8_C(184), UINT8_C( 41), UINT8_C( 58), UINT8_C(157),
+          UINT8_C( 14), UINT8_C( 57), UINT8_C(224), UINT8_C(192), UINT8_C(128), UINT8_C(255), UINT8_C(119), UINT8_C( 43) } } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x3_t r = simde_vld3q_u8(test_vec[i].a);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[48];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x16x3_t r = simde_vld3q_u8(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16(2, r.val[0], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r.val[1], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r.val[2], SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld3q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[12];
+    uint32_t r[3][4];
+  } test_vec[] = {
+    { { UINT32_C(1857330451), UINT32_C( 293740737), UINT32_C(1817079216), UINT32_C(1176911091),
+        UINT32_C(3972117658), UINT32_C(1897630647), UINT32_C(4193771288), UINT32_C(3186363435),
+        UINT32_C(1061174358), UINT32_C(2856577771), UINT32_C(4068438491), UINT32_C(4198313114) },
+      { { UINT32_C(1857330451), UINT32_C(1176911091), UINT32_C(4193771288), UINT32_C(2856577771) },
+        { UINT32_C( 293740737), UINT32_C(3972117658), UINT32_C(3186363435), UINT32_C(4068438491) },
+        { UINT32_C(1817079216), UINT32_C(1897630647), UINT32_C(1061174358), UINT32_C(4198313114) } } },
+    { { UINT32_C( 102277668), UINT32_C(1940981446), UINT32_C(1428042430), UINT32_C(1738258504),
+        UINT32_C(3861500440), UINT32_C(2800125010), UINT32_C( 726140314), UINT32_C( 146382139),
+        UINT32_C(2873367181), UINT32_C(2508495084), UINT32_C(4269600340), UINT32_C(  16161667) },
+      { { UINT32_C( 102277668), UINT32_C(1738258504), UINT32_C( 726140314), UINT32_C(2508495084) },
+        { UINT32_C(1940981446), UINT32_C(3861500440), UINT32_C( 146382139), UINT32_C(4269600340) },
+        { UINT32_C(1428042430), UINT32_C(2800125010), UINT32_C(2873367181), UINT32_C(  16161667) } } },
+    { { UINT32_C(2628510423), UINT32_C(2910177284), UINT32_C(1973635507), UINT32_C(1911265734),
+        UINT32_C( 130962682), UINT32_C(1442933714), UINT32_C(1937212576), UINT32_C(3808044861),
+        UINT32_C(1992396395), UINT32_C(2562389333), UINT32_C(3387817836), UINT32_C(1124798360) },
+      { { UINT32_C(2628510423), UINT32_C(1911265734), UINT32_C(1937212576), UINT32_C(2562389333) },
+        { UINT32_C(2910177284), UINT32_C( 130962682), UINT32_C(3808044861), UINT32_C(3387817836) },
+        { UINT32_C(1973635507), UINT32_C(1442933714), UINT32_C(1992396395), UINT32_C(1124798360) } } },
+    { { UINT32_C(1676563098), UINT32_C(1951717205), UINT32_C(3460626710), UINT32_C(1898556445),
+        UINT32_C(1740359625), UINT32_C(2991813178), UINT32_C(2728747754), UINT32_C(2156250488),
+        UINT32_C(3258800457), UINT32_C( 535569031), UINT32_C( 713264690), UINT32_C(2872976777) },
+      { { UINT32_C(1676563098), UINT32_C(1898556445), UINT32_C(2728747754), UINT32_C( 535569031) },
+        { UINT32_C(1951717205), UINT32_C(1740359625), UINT32_C(2156250488), UINT32_C( 713264690) },
+        { UINT32_C(3460626710), UINT32_C(2991813178), UINT32_C(3258800457), UINT32_C(2872976777) } } },
+    { { UINT32_C(4095287719), UINT32_C(1344549417), UINT32_C(1933235367), UINT32_C(3914553348),
+        UINT32_C(2059525089), UINT32_C(1419015820), UINT32_C(4177268892), UINT32_C(3048660057),
+        UINT32_C(2453017314), UINT32_C(2012001946), UINT32_C(2232833101), UINT32_C( 363801895) },
+      { { UINT32_C(4095287719), UINT32_C(3914553348), UINT32_C(4177268892), UINT32_C(2012001946) },
+        { UINT32_C(1344549417), UINT32_C(2059525089), UINT32_C(3048660057), UINT32_C(2232833101) },
+        { UINT32_C(1933235367), UINT32_C(1419015820), UINT32_C(2453017314), UINT32_C( 363801895) } } },
+    { { UINT32_C( 917394559), UINT32_C(3641868611), UINT32_C( 945039848), UINT32_C( 729857921),
+        UINT32_C(3266514716), UINT32_C(2368819538), UINT32_C(2172974323), UINT32_C(1714972361),
+        UINT32_C(2828901866), UINT32_C( 467494018), UINT32_C(2986759971), UINT32_C(1713573700) },
+      { { UINT32_C( 917394559), UINT32_C( 729857921), UINT32_C(2172974323), UINT32_C( 467494018) },
+        { UINT32_C(3641868611), UINT32_C(3266514716), UINT32_C(1714972361), UINT32_C(2986759971) },
+        { UINT32_C( 945039848), UINT32_C(2368819538), UINT32_C(2828901866), UINT32_C(1713573700) } } },
+    { { UINT32_C(2930668228), UINT32_C(1423689327), UINT32_C(1388917753), UINT32_C(3874946478),
+        UINT32_C(3706252298), UINT32_C(3724464247), UINT32_C(1931817436), UINT32_C(1091224718),
+        UINT32_C( 755602856), UINT32_C(4009949157), UINT32_C(3724677386), UINT32_C(1163958091) },
+      { { UINT32_C(2930668228), UINT32_C(3874946478), UINT32_C(1931817436), UINT32_C(4009949157) },
+        { UINT32_C(1423689327), UINT32_C(3706252298), UINT32_C(1091224718), UINT32_C(3724677386) },
+        { UINT32_C(1388917753), UINT32_C(3724464247), UINT32_C( 755602856), UINT32_C(1163958091) } } },
+    { { UINT32_C(3871624184), UINT32_C(1778393281), UINT32_C( 517559213), UINT32_C(1305586315),
+        UINT32_C(3801724200), UINT32_C(2961053962), UINT32_C(2956375719), UINT32_C( 942661339),
+        UINT32_C(1159332706), UINT32_C( 702323947), UINT32_C(2470224732), UINT32_C(1117071579) },
+      { { UINT32_C(3871624184), UINT32_C(1305586315), UINT32_C(2956375719), UINT32_C( 702323947) },
+        { UINT32_C(1778393281), UINT32_C(3801724200), UINT32_C( 942661339), UINT32_C(2470224732) },
+        { UINT32_C( 517559213), UINT32_C(2961053962), UINT32_C(1159332706), UINT32_C(1117071579) } } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x3_t r = simde_vld3q_u32(test_vec[i].a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[12];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x4x3_t r = simde_vld3q_u32(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r.val[0], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r.val[1], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r.val[2], SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld3q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[6];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    { { UINT64_C( 5357016333194605797), UINT64_C( 8286343716937956048),
+        UINT64_C( 9421020288553337439), UINT64_C(17628482474764766287),
+        UINT64_C( 8883208716392628225), UINT64_C( 9553534779799861853) },
+      { { UINT64_C( 5357016333194605797), UINT64_C(17628482474764766287) },
+        { UINT64_C( 8286343716937956048), UINT64_C( 8883208716392628225) },
+        { UINT64_C( 9421020288553337439), UINT64_C( 9553534779799861853) } } },
+    { { UINT64_C( 2221241898742698939), UINT64_C( 4468098499962347840),
+        UINT64_C( 3996068928862773357), UINT64_C(18083692521394804478),
+        UINT64_C( 4073604185187905427), UINT64_C( 5289727633300521587) },
+      { { UINT64_C( 2221241898742698939), UINT64_C(18083692521394804478) },
+        { UINT64_C( 4468098499962347840), UINT64_C( 4073604185187905427) },
+        { UINT64_C( 3996068928862773357), UINT64_C( 5289727633300521587) } } },
+    { { UINT64_C( 7517731941745475928), UINT64_C(11904654001736152041),
+        UINT64_C(11975414622032309781), UINT64_C(12475013224400284241),
+        UINT64_C(13701108755877766622), UINT64_C(17540055216620463545) },
+      { { UINT64_C( 7517731941745475928), UINT64_C(12475013224400284241) },
+        { UINT64_C(11904654001736152041), UINT64_C(13701108755877766622) },
+        { UINT64_C(11975414622032309781), UINT64_C(17540055216620463545) } } },
+    { { UINT64_C( 8676407835182336196), UINT64_C( 4165048953845379999),
+        UINT64_C(14822220942068077313), UINT64_C( 6508129448087956456),
+        UINT64_C( 6319678947275251800), UINT64_C( 6062575927405164101) },
+      { { UINT64_C( 8676407835182336196), UINT64_C( 6508129448087956456) },
+        { UINT64_C( 4165048953845379999), UINT64_C( 6319678947275251800) },
+        { UINT64_C(14822220942068077313), UINT64_C( 6062575927405164101) } } },
+    { { UINT64_C( 6167984523547622547), UINT64_C(14280400684882950659),
+        UINT64_C( 9155674135835749448), UINT64_C(17694935733418119879),
+        UINT64_C(13564802532471127461), UINT64_C(10522475159541312466) },
+      { { UINT64_C( 6167984523547622547), UINT64_C(17694935733418119879) },
+        { UINT64_C(14280400684882950659), UINT64_C(13564802532471127461) },
+        { UINT64_C( 9155674135835749448), UINT64_C(10522475159541312466) } } },
+    { { UINT64_C(15259841285921066824), UINT64_C( 3300174126628512725),
+        UINT64_C( 9763833879491453616), UINT64_C( 5649303609955610005),
+        UINT64_C( 3970764847564524747), UINT64_C( 9179196237656820806) },
+      { { UINT64_C(15259841285921066824), UINT64_C( 5649303609955610005) },
+        { UINT64_C( 3300174126628512725), UINT64_C( 3970764847564524747) },
+        { UINT64_C( 9763833879491453616), UINT64_C( 9179196237656820806) } } },
+    { { UINT64_C(18112588343483963107), UINT64_C(15735924902310225767),
+        UINT64_C(15464173627151921711), UINT64_C(15527936836394750060),
+        UINT64_C( 8959322858315312706), UINT64_C( 6844388861053289712) },
+      { { UINT64_C(18112588343483963107), UINT64_C(15527936836394750060) },
+        { UINT64_C(15735924902310225767), UINT64_C( 8959322858315312706) },
+        { UINT64_C(15464173627151921711), UINT64_C( 6844388861053289712) } } },
+    { { UINT64_C(16144285615380096872), UINT64_C(11954177129953684898),
+        UINT64_C( 3961072267746122828), UINT64_C(17163703309132118027),
+        UINT64_C(15695272083653308324), UINT64_C(11151656121310267402) },
+      { { UINT64_C(16144285615380096872), UINT64_C(17163703309132118027) },
+        { UINT64_C(11954177129953684898), UINT64_C(15695272083653308324) },
+        { UINT64_C( 3961072267746122828), UINT64_C(11151656121310267402) } } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x3_t r = simde_vld3q_u64(test_vec[i].a);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[6];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x2x3_t r = simde_vld3q_u64(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r.val[0], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r.val[1], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r.val[2], SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_BEGIN
 #if !defined(SIMDE_BUG_INTEL_857088)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld3_s8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld3_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_u64)
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_END
 
@@ -256,11 +256,378 @@ test_simde_vld4q_f16 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vld4q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[64];
+    uint8_t r[4][16];
+  } test_vec[] = {
+    { { UINT8_C(247), UINT8_C( 53), UINT8_C(  2), UINT8_C(133), UINT8_C(188), UINT8_C(  9), UINT8_C( 40), UINT8_C(233),
+        UINT8_C(252), UINT8_C( 61), UINT8_C(  4), UINT8_C( 14), UINT8_C(225), UINT8_C(206), UINT8_C(174), UINT8_C( 37),
+        UINT8_C(219), UINT8_C(177), UINT8_C(255), UINT8_C( 94), UINT8_C( 61), UINT8_C( 29), UINT8_C( 86), UINT8_C(119),
+        UINT8_C(181), UINT8_C( 91), UINT8_C( 71), UINT8_C(100), UINT8_C( 67), UINT8_C( 88), UINT8_C( 58), UINT8_C(239),
+        UINT8_C(219), UINT8_C( 52), UINT8_C(223), UINT8_C( 90), UINT8_C(204), UINT8_C( 80), UINT8_C( 57), UINT8_C( 78),
+        UINT8_C(236), UINT8_C(186), UINT8_C(130), UINT8_C(107), UINT8_C( 59), UINT8_C(147), UINT8_C(116), UINT8_C(215),
+        UINT8_C(107), UINT8_C(125), UINT8_C( 20), UINT8_C(118), UINT8_C(144), UINT8_C(204), UINT8_C( 92), UINT8_C(112),
+        UINT8_C(145), UINT8_C( 80), UINT8_C(238), UINT8_C(177), UINT8_C(165), UINT8_C(115), UINT8_C(103), UINT8_C(198) },
+      { { UINT8_C(247), UINT8_C(188), UINT8_C(252), UINT8_C(225), UINT8_C(219), UINT8_C( 61), UINT8_C(181), UINT8_C( 67),
+          UINT8_C(219), UINT8_C(204), UINT8_C(236), UINT8_C( 59), UINT8_C(107), UINT8_C(144), UINT8_C(145), UINT8_C(165) },
+        { UINT8_C( 53), UINT8_C(  9), UINT8_C( 61), UINT8_C(206), UINT8_C(177), UINT8_C( 29), UINT8_C( 91), UINT8_C( 88),
+          UINT8_C( 52), UINT8_C( 80), UINT8_C(186), UINT8_C(147), UINT8_C(125), UINT8_C(204), UINT8_C( 80), UINT8_C(115) },
+        { UINT8_C(  2), UINT8_C( 40), UINT8_C(  4), UINT8_C(174), UINT8_C(255), UINT8_C( 86), UINT8_C( 71), UINT8_C( 58),
+          UINT8_C(223), UINT8_C( 57), UINT8_C(130), UINT8_C(116), UINT8_C( 20), UINT8_C( 92), UINT8_C(238), UINT8_C(103) },
+        { UINT8_C(133), UINT8_C(233), UINT8_C( 14), UINT8_C( 37), UINT8_C( 94), UINT8_C(119), UINT8_C(100), UINT8_C(239),
+          UINT8_C( 90), UINT8_C( 78), UINT8_C(107), UINT8_C(215), UINT8_C(118), UINT8_C(112), UINT8_C(177), UINT8_C(198) } } },
+    { { UINT8_C(221), UINT8_C(207), UINT8_C(254), UINT8_C( 16), UINT8_C(125), UINT8_C(245), UINT8_C(241), UINT8_C(214),
+        UINT8_C(  4), UINT8_C( 50), UINT8_C( 35), UINT8_C(136), UINT8_C( 44), UINT8_C(157), UINT8_C(240), UINT8_C(200),
+        UINT8_C(176), UINT8_C(216), UINT8_C(184), UINT8_C(  4), UINT8_C( 73), UINT8_C(135), UINT8_C(126), UINT8_C( 38),
+        UINT8_C(227), UINT8_C(219), UINT8_C( 25), UINT8_C(228), UINT8_C( 29), UINT8_C(101), UINT8_C( 12), UINT8_C( 18),
+        UINT8_C(119), UINT8_C(185), UINT8_C(215), UINT8_C(235), UINT8_C(142), UINT8_C( 75), UINT8_C(102), UINT8_C(236),
+        UINT8_C(128), UINT8_C( 59), UINT8_C( 45), UINT8_C(139), UINT8_C(242), UINT8_C(128), UINT8_C( 90), UINT8_C( 20),
+        UINT8_C( 60), UINT8_C( 79), UINT8_C( 79), UINT8_C( 42), UINT8_C(211), UINT8_C(160), UINT8_C( 81), UINT8_C( 99),
+        UINT8_C(231), UINT8_C(121), UINT8_C( 86), UINT8_C(222), UINT8_C(113), UINT8_C(200), UINT8_C( 18), UINT8_C(193) },
+      { { UINT8_C(221), UINT8_C(125), UINT8_C(  4), UINT8_C( 44), UINT8_C(176), UINT8_C( 73), UINT8_C(227), UINT8_C( 29),
+          UINT8_C(119), UINT8_C(142), UINT8_C(128), UINT8_C(242), UINT8_C( 60), UINT8_C(211), UINT8_C(231), UINT8_C(113) },
+        { UINT8_C(207), UINT8_C(245), UINT8_C( 50), UINT8_C(157), UINT8_C(216), UINT8_C(135), UINT8_C(219), UINT8_C(101),
+          UINT8_C(185), UINT8_C( 75), UINT8_C( 59), UINT8_C(128), UINT8_C( 79), UINT8_C(160), UINT8_C(121), UINT8_C(200) },
+        { UINT8_C(254), UINT8_C(241), UINT8_C( 35), UINT8_C(240), UINT8_C(184), UINT8_C(126), UINT8_C( 25), UINT8_C( 12),
+          UINT8_C(215), UINT8_C(102), UINT8_C( 45), UINT8_C( 90), UINT8_C( 79), UINT8_C( 81), UINT8_C( 86), UINT8_C( 18) },
+        { UINT8_C( 16), UINT8_C(214), UINT8_C(136), UINT8_C(200), UINT8_C(  4), UINT8_C( 38), UINT8_C(228), UINT8_C( 18),
+          UINT8_C(235), UINT8_C(236), UINT8_C(139), UINT8_C( 20), UINT8_C( 42), UINT8_C( 99), UINT8_C(222), UINT8_C(193) } } },
+    { { UINT8_C(232), UINT8_C(214), UINT8_C(203), UINT8_C( 69), UINT8_C(121), UINT8_C( 36), UINT8_C( 29), UINT8_C(173),
+        UINT8_C(126), UINT8_C( 99), UINT8_C( 96), UINT8_C(  3), UINT8_C(215), UINT8_C( 66), UINT8_C(237), UINT8_C(247),
+        UINT8_C(189), UINT8_C( 23), UINT8_C( 73), UINT8_C( 16), UINT8_C( 10), UINT8_C(115), UINT8_C(228), UINT8_C( 15),
+        UINT8_C(241), UINT8_C( 65), UINT8_C( 40), UINT8_C(210), UINT8_C(127), UINT8_C(144), UINT8_C(123), UINT8_C(223),
+        UINT8_C(249), UINT8_C(127), UINT8_C( 11), UINT8_C(128), UINT8_C( 15), UINT8_C(121), UINT8_C(215), UINT8_C( 20),
+        UINT8_C(145), UINT8_C(245), UINT8_C(118), UINT8_C( 59), UINT8_C(199), UINT8_C(193), UINT8_C(151), UINT8_C(114),
+        UINT8_C(177), UINT8_C(184), UINT8_C( 65), UINT8_C(173), UINT8_C( 21), UINT8_C(156), UINT8_C(  2), UINT8_C( 14),
+        UINT8_C( 85), UINT8_C(192), UINT8_C(166), UINT8_C(213), UINT8_C( 97), UINT8_C(111), UINT8_C( 88), UINT8_C( 14) },
+      { { UINT8_C(232), UINT8_C(121), UINT8_C(126), UINT8_C(215), UINT8_C(189), UINT8_C( 10), UINT8_C(241), UINT8_C(127),
+          UINT8_C(249), UINT8_C( 15), UINT8_C(145), UINT8_C(199), UINT8_C(177), UINT8_C( 21), UINT8_C( 85), UINT8_C( 97) },
+        { UINT8_C(214), UINT8_C( 36), UINT8_C( 99), UINT8_C( 66), UINT8_C( 23), UINT8_C(115), UINT8_C( 65), UINT8_C(144),
+          UINT8_C(127), UINT8_C(121), UINT8_C(245), UINT8_C(193), UINT8_C(184), UINT8_C(156), UINT8_C(192), UINT8_C(111) },
+        { UINT8_C(203), UINT8_C( 29), UINT8_C( 96), UINT8_C(237), UINT8_C( 73), UINT8_C(228), UINT8_C( 40), UINT8_C(123),
+          UINT8_C( 11), UINT8_C(215), UINT8_C(118), UINT8_C(151), UINT8_C( 65), UINT8_C(  2), UINT8_C(166), UINT8_C( 88) },
+        { UINT8_C( 69), UINT8_C(173), UINT8_C(  3), UINT8_C(247), UINT8_C( 16), UINT8_C( 15), UINT8_C(210), UINT8_C(223),
+          UINT8_C(128), UINT8_C( 20), UINT8_C( 59), UINT8_C(114), UINT8_C(173), UINT8_C( 14), UINT8_C(213), UINT8_C( 14) } } },
+    { { UINT8_C(158), UINT8_C(239), UINT8_C(180), UINT8_C( 77), UINT8_C(152), UINT8_C(114), UINT8_C( 79), UINT8_C(140),
+        UINT8_C(210), UINT8_C(  7), UINT8_C(204), UINT8_C(110), UINT8_C(228), UINT8_C(222), UINT8_C(228), UINT8_C( 98),
+        UINT8_C(  3), UINT8_C(228), UINT8_C(171), UINT8_C(234), UINT8_C( 89), UINT8_C(157), UINT8_C( 99), UINT8_C(232),
+        UINT8_C(132), UINT8_C(  0), UINT8_C( 36), UINT8_C( 64), UINT8_C( 63), UINT8_C(127), UINT8_C(252), UINT8_C(131),
+        UINT8_C( 84), UINT8_C( 83), UINT8_C(233), UINT8_C( 62), UINT8_C(175), UINT8_C(150), UINT8_C( 80), UINT8_C(125),
+        UINT8_C( 81), UINT8_C(  0), UINT8_C(154), UINT8_C( 90), UINT8_C(179), UINT8_C( 57), UINT8_C( 87), UINT8_C(236),
+        UINT8_C( 15), UINT8_C(218), UINT8_C( 44), UINT8_C(164), UINT8_C(220), UINT8_C(129), UINT8_C(186), UINT8_C(242),
+        UINT8_C( 27), UINT8_C(252), UINT8_C(213), UINT8_C(185), UINT8_C(147), UINT8_C(102), UINT8_C( 85), UINT8_C(223) },
+      { { UINT8_C(158), UINT8_C(152), UINT8_C(210), UINT8_C(228), UINT8_C(  3), UINT8_C( 89), UINT8_C(132), UINT8_C( 63),
+          UINT8_C( 84), UINT8_C(175), UINT8_C( 81), UINT8_C(179), UINT8_C( 15), UINT8_C(220), UINT8_C( 27), UINT8_C(147) },
+        { UINT8_C(239), UINT8_C(114), UINT8_C(  7), UINT8_C(222), UINT8_C(228), UINT8_C(157), UINT8_C(  0), UINT8_C(127),
+          UINT8_C( 83), UINT8_C(150), UINT8_C(  0), UINT8_C( 57), UINT8_C(218), UINT8_C(129), UINT8_C(252), UINT8_C(102) },
+        { UINT8_C(180), UINT8_C( 79), UINT8_C(204), UINT8_C(228), UINT8_C(171), UINT8_C( 99), UINT8_C( 36), UINT8_C(252),
+          UINT8_C(233), UINT8_C( 80), UINT8_C(154), UINT8_C( 87), UINT8_C( 44), UINT8_C(186), UINT8_C(213), UINT8_C( 85) },
+        { UINT8_C( 77), UINT8_C(140), UINT8_C(110), UINT8_C( 98), UINT8_C(234), UINT8_C(232), UINT8_C( 64), UINT8_C(131),
+          UINT8_C( 62), UINT8_C(125), UINT8_C( 90), UINT8_C(236), UINT8_C(164), UINT8_C(242), UINT8_C(185), UINT8_C(223) } } },
+    { { UINT8_C(228), UINT8_C(219), UINT8_C( 32), UINT8_C( 85), UINT8_C( 25), UINT8_C( 80), UINT8_C( 87), UINT8_C(117),
+        UINT8_C(188), UINT8_C(157), UINT8_C(140), UINT8_C(158), UINT8_C(123), UINT8_C(146), UINT8_C(232), UINT8_C( 31),
+        UINT8_C(100), UINT8_C(237), UINT8_C(201), UINT8_C(148), UINT8_C(  1), UINT8_C( 25), UINT8_C(200), UINT8_C(216),
+        UINT8_C( 39), UINT8_C(181), UINT8_C(167), UINT8_C(118), UINT8_C(214), UINT8_C( 40), UINT8_C(167), UINT8_C( 50),
+        UINT8_C(148), UINT8_C(139), UINT8_C(140), UINT8_C(158), UINT8_C(192), UINT8_C( 82), UINT8_C( 94), UINT8_C(103),
+        UINT8_C( 59), UINT8_C(250), UINT8_C(142), UINT8_C(165), UINT8_C(133), UINT8_C(160), UINT8_C( 29), UINT8_C(254),
+        UINT8_C(135), UINT8_C(185), UINT8_C(119), UINT8_C(150), UINT8_C( 40), UINT8_C(212), UINT8_C(181), UINT8_C(175),
+        UINT8_C(199), UINT8_C(235), UINT8_C( 86), UINT8_C(117), UINT8_C(221), UINT8_C(154), UINT8_C(252), UINT8_C(145) },
+      { { UINT8_C(228), UINT8_C( 25), UINT8_C(188), UINT8_C(123), UINT8_C(100), UINT8_C(  1), UINT8_C( 39), UINT8_C(214),
+          UINT8_C(148), UINT8_C(192), UINT8_C( 59), UINT8_C(133), UINT8_C(135), UINT8_C( 40), UINT8_C(199), UINT8_C(221) },
+        { UINT8_C(219), UINT8_C( 80), UINT8_C(157), UINT8_C(146), UINT8_C(237), UINT8_C( 25), UINT8_C(181), UINT8_C( 40),
+          UINT8_C(139), UINT8_C( 82), UINT8_C(250), UINT8_C(160), UINT8_C(185), UINT8_C(212), UINT8_C(235), UINT8_C(154) },
+        { UINT8_C( 32), UINT8_C( 87), UINT8_C(140), UINT8_C(232), UINT8_C(201), UINT8_C(200), UINT8_C(167), UINT8_C(167),
+          UINT8_C(140), UINT8_C( 94), UINT8_C(142), UINT8_C( 29), UINT8_C(119), UINT8_C(181), UINT8_C( 86), UINT8_C(252) },
+        { UINT8_C( 85), UINT8_C(117), UINT8_C(158), UINT8_C( 31), UINT8_C(148), UINT8_C(216), UINT8_C(118), UINT8_C( 50),
+          UINT8_C(158), UINT8_C(103), UINT8_C(165), UINT8_C(254), UINT8_C(150), UINT8_C(175), UINT8_C(117), UINT8_C(145) } } },
+    { { UINT8_C(169), UINT8_C(246), UINT8_C(104), UINT8_C(  7), UINT8_C( 69), UINT8_C( 86), UINT8_C( 33), UINT8_C(194),
+        UINT8_C( 69), UINT8_C( 91), UINT8_C(255), UINT8_C( 47), UINT8_C( 15), UINT8_C(119), UINT8_C(234), UINT8_C(254),
+        UINT8_C(178), UINT8_C(149), UINT8_C(200), UINT8_C( 54), UINT8_C( 25), UINT8_C( 17), UINT8_C(165), UINT8_C( 64),
+        UINT8_C( 52), UINT8_C(190), UINT8_C(173), UINT8_C( 18), UINT8_C(203), UINT8_C(225), UINT8_C(184), UINT8_C(113),
+        UINT8_C(137), UINT8_C( 41), UINT8_C(226), UINT8_C(227), UINT8_C( 58), UINT8_C( 82), UINT8_C( 40), UINT8_C(157),
+        UINT8_C(221), UINT8_C(224), UINT8_C( 14), UINT8_C( 94), UINT8_C(107), UINT8_C( 57), UINT8_C(107), UINT8_C(189),
+        UINT8_C(224), UINT8_C( 43), UINT8_C( 95), UINT8_C(192), UINT8_C(145), UINT8_C( 37), UINT8_C(128), UINT8_C( 44),
+        UINT8_C(122), UINT8_C(255), UINT8_C(121), UINT8_C(235), UINT8_C(119), UINT8_C(119), UINT8_C(152), UINT8_C( 43) },
+      { { UINT8_C(169), UINT8_C( 69), UINT8_C( 69), UINT8_C( 15), UINT8_C(178), UINT8_C( 25), UINT8_C( 52), UINT8_C(203),
+          UINT8_C(137), UINT8_C( 58), UINT8_C(221), UINT8_C(107), UINT8_C(224), UINT8_C(145), UINT8_C(122), UINT8_C(119) },
+        { UINT8_C(246), UINT8_C( 86), UINT8_C( 91), UINT8_C(119), UINT8_C(149), UINT8_C( 17), UINT8_C(190), UINT8_C(225),
+          UINT8_C( 41), UINT8_C( 82), UINT8_C(224), UINT8_C( 57), UINT8_C( 43), UINT8_C( 37), UINT8_C(255), UINT8_C(119) },
+        { UINT8_C(104), UINT8_C( 33), UINT8_C(255), UINT8_C(234), UINT8_C(200), UINT8_C(165), UINT8_C(173), UINT8_C(184),
+          UINT8_C(226), UINT8_C( 40), UINT8_C( 14), UINT8_C(107), UINT8_C( 95), UINT8_C(128), UINT8_C(121), UINT8_C(152) },
+        { UINT8_C(  7), UINT8_C(194), UINT8_C( 47), UINT8_C(254), UINT8_C( 54), UINT8_C( 64), UINT8_C( 18), UINT8_C(113),
+          UINT8_C(227), UINT8_C(157), UINT8_C( 94), UINT8_C(189), UINT8_C(192), UINT8_C( 44), UINT8_C(235), UINT8_C( 43) } } },
+    { { UINT8_C(110), UINT8_C( 17), UINT8_C(108), UINT8_C( 70), UINT8_C(236), UINT8_C(113), UINT8_C(249), UINT8_C(189),
+        UINT8_C( 63), UINT8_C(170), UINT8_C(242), UINT8_C(250), UINT8_C(  6), UINT8_C(115), UINT8_C( 85), UINT8_C(103),
+        UINT8_C(230), UINT8_C(166), UINT8_C( 43), UINT8_C(  8), UINT8_C(171), UINT8_C(149), UINT8_C(254), UINT8_C(  0),
+        UINT8_C(156), UINT8_C(173), UINT8_C(117), UINT8_C(113), UINT8_C(  7), UINT8_C( 86), UINT8_C(115), UINT8_C(226),
+        UINT8_C(118), UINT8_C(152), UINT8_C(201), UINT8_C( 67), UINT8_C( 99), UINT8_C(116), UINT8_C(206), UINT8_C(113),
+        UINT8_C(103), UINT8_C(178), UINT8_C(162), UINT8_C(128), UINT8_C(194), UINT8_C( 31), UINT8_C( 42), UINT8_C(171),
+        UINT8_C(244), UINT8_C( 80), UINT8_C(115), UINT8_C(233), UINT8_C(122), UINT8_C( 84), UINT8_C(248), UINT8_C(181),
+        UINT8_C(146), UINT8_C(119), UINT8_C(133), UINT8_C( 21), UINT8_C( 54), UINT8_C(217), UINT8_C( 56), UINT8_C( 43) },
+      { { UINT8_C(110), UINT8_C(236), UINT8_C( 63), UINT8_C(  6), UINT8_C(230), UINT8_C(171), UINT8_C(156), UINT8_C(  7),
+          UINT8_C(118), UINT8_C( 99), UINT8_C(103), UINT8_C(194), UINT8_C(244), UINT8_C(122), UINT8_C(146), UINT8_C( 54) },
+        { UINT8_C( 17), UINT8_C(113), UINT8_C(170), UINT8_C(115), UINT8_C(166), UINT8_C(149), UINT8_C(173), UINT8_C( 86),
+          UINT8_C(152), UINT8_C(116), UINT8_C(178), UINT8_C( 31), UINT8_C( 80), UINT8_C( 84), UINT8_C(119), UINT8_C(217) },
+        { UINT8_C(108), UINT8_C(249), UINT8_C(242), UINT8_C( 85), UINT8_C( 43), UINT8_C(254), UINT8_C(117), UINT8_C(115),
+          UINT8_C(201), UINT8_C(206), UINT8_C(162), UINT8_C( 42), UINT8_C(115), UINT8_C(248), UINT8_C(133), UINT8_C( 56) },
+        { UINT8_C( 70), UINT8_C(189), UINT8_C(250), UINT8_C(103), UINT8_C(  8), UINT8_C(  0), UINT8_C(113), UINT8_C(226),
+          UINT8_C( 67), UINT8_C(113), UINT8_C(128), UINT8_C(171), UINT8_C(233), UINT8_C(181), UINT8_C( 21), UINT8_C( 43) } } },
+    { { UINT8_C(194), UINT8_C(141), UINT8_C(129), UINT8_C(102), UINT8_C(168), UINT8_C( 27), UINT8_C(178), UINT8_C(102),
+        UINT8_C(174), UINT8_C( 84), UINT8_C( 82), UINT8_C(230), UINT8_C(220), UINT8_C(221), UINT8_C(115), UINT8_C( 65),
+        UINT8_C( 45), UINT8_C(239), UINT8_C(222), UINT8_C( 69), UINT8_C(230), UINT8_C(106), UINT8_C( 30), UINT8_C( 77),
+        UINT8_C(226), UINT8_C(176), UINT8_C(176), UINT8_C( 56), UINT8_C( 69), UINT8_C( 41), UINT8_C(147), UINT8_C( 66),
+        UINT8_C(236), UINT8_C( 74), UINT8_C( 38), UINT8_C(114), UINT8_C(168), UINT8_C(130), UINT8_C( 61), UINT8_C(244),
+        UINT8_C( 38), UINT8_C(123), UINT8_C(243), UINT8_C(132), UINT8_C(254), UINT8_C( 30), UINT8_C(167), UINT8_C( 62),
+        UINT8_C(202), UINT8_C( 55), UINT8_C(101), UINT8_C(250), UINT8_C(109), UINT8_C( 56), UINT8_C(157), UINT8_C( 73),
+        UINT8_C(208), UINT8_C(104), UINT8_C(179), UINT8_C(165), UINT8_C(120), UINT8_C(166), UINT8_C(160), UINT8_C(173) },
+      { { UINT8_C(194), UINT8_C(168), UINT8_C(174), UINT8_C(220), UINT8_C( 45), UINT8_C(230), UINT8_C(226), UINT8_C( 69),
+          UINT8_C(236), UINT8_C(168), UINT8_C( 38), UINT8_C(254), UINT8_C(202), UINT8_C(109), UINT8_C(208), UINT8_C(120) },
+        { UINT8_C(141), UINT8_C( 27), UINT8_C( 84), UINT8_C(221), UINT8_C(239), UINT8_C(106), UINT8_C(176), UINT8_C( 41),
+          UINT8_C( 74), UINT8_C(130), UINT8_C(123), UINT8_C( 30), UINT8_C( 55), UINT8_C( 56), UINT8_C(104), UINT8_C(166) },
+        { UINT8_C(129), UINT8_C(178), UINT8_C( 82), UINT8_C(115), UINT8_C(222), UINT8_C( 30), UINT8_C(176), UINT8_C(147),
+          UINT8_C( 38), UINT8_C( 61), UINT8_C(243), UINT8_C(167), UINT8_C(101), UINT8_C(157), UINT8_C(179), UINT8_C(160) },
+        { UINT8_C(102), UINT8_C(102), UINT8_C(230), UINT8_C( 65), UINT8_C( 69), UINT8_C( 77), UINT8_C( 56), UINT8_C( 66),
+          UINT8_C(114), UINT8_C(244), UINT8_C(132), UINT8_C( 62), UINT8_C(250), UINT8_C( 73), UINT8_C(165), UINT8_C(173) } } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x4_t r = simde_vld4q_u8(test_vec[i].a);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[3], simde_vld1q_u8(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint8_t a[64];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint8x16x4_t r = simde_vld4q_u8(a);
+
+    simde_test_codegen_write_vu8(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u8x16(2, r.val[0], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r.val[1], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r.val[2], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u8x16(2, r.val[3], SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld4q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[16];
+    uint32_t r[4][4];
+  } test_vec[] = {
+    { { UINT32_C(1729537502), UINT32_C(3190037970), UINT32_C(3479594425), UINT32_C(4083862345),
+        UINT32_C(3732244676), UINT32_C(2020133620), UINT32_C(3322999711), UINT32_C( 969751028),
+        UINT32_C(1381159681), UINT32_C(3451067242), UINT32_C(1636477928), UINT32_C(1515291968),
+        UINT32_C(4208664664), UINT32_C(1471414916), UINT32_C(1624356421), UINT32_C(1411553455) },
+      { { UINT32_C(1729537502), UINT32_C(3732244676), UINT32_C(1381159681), UINT32_C(4208664664) },
+        { UINT32_C(3190037970), UINT32_C(2020133620), UINT32_C(3451067242), UINT32_C(1471414916) },
+        { UINT32_C(3479594425), UINT32_C(3322999711), UINT32_C(1636477928), UINT32_C(1624356421) },
+        { UINT32_C(4083862345), UINT32_C( 969751028), UINT32_C(1515291968), UINT32_C(1411553455) } } },
+    { { UINT32_C(2854861971), UINT32_C(1436095806), UINT32_C( 414284291), UINT32_C(3324914883),
+        UINT32_C( 565750856), UINT32_C(2131721502), UINT32_C( 968938183), UINT32_C(4119923276),
+        UINT32_C(2890055077), UINT32_C(3158301704), UINT32_C( 978643922), UINT32_C(2449954664),
+        UINT32_C(2821345096), UINT32_C(3552958668), UINT32_C( 312517589), UINT32_C( 768381666) },
+      { { UINT32_C(2854861971), UINT32_C( 565750856), UINT32_C(2890055077), UINT32_C(2821345096) },
+        { UINT32_C(1436095806), UINT32_C(2131721502), UINT32_C(3158301704), UINT32_C(3552958668) },
+        { UINT32_C( 414284291), UINT32_C( 968938183), UINT32_C( 978643922), UINT32_C( 312517589) },
+        { UINT32_C(3324914883), UINT32_C(4119923276), UINT32_C(2449954664), UINT32_C( 768381666) } } },
+    { { UINT32_C(2969772720), UINT32_C(2273319726), UINT32_C(3015470485), UINT32_C(1315330995),
+        UINT32_C(1102122187), UINT32_C( 924515735), UINT32_C(1025707078), UINT32_C(2137198168),
+        UINT32_C(1077810915), UINT32_C(4217165602), UINT32_C(2121049959), UINT32_C(3663805523),
+        UINT32_C( 794473007), UINT32_C(3600533499), UINT32_C(1006833772), UINT32_C(3615379528) },
+      { { UINT32_C(2969772720), UINT32_C(1102122187), UINT32_C(1077810915), UINT32_C( 794473007) },
+        { UINT32_C(2273319726), UINT32_C( 924515735), UINT32_C(4217165602), UINT32_C(3600533499) },
+        { UINT32_C(3015470485), UINT32_C(1025707078), UINT32_C(2121049959), UINT32_C(1006833772) },
+        { UINT32_C(1315330995), UINT32_C(2137198168), UINT32_C(3663805523), UINT32_C(3615379528) } } },
+    { { UINT32_C(3454791234), UINT32_C(2086004907), UINT32_C(4021863664), UINT32_C(1593583463),
+        UINT32_C( 690874216), UINT32_C(3758884411), UINT32_C(2231168418), UINT32_C(2783298755),
+        UINT32_C(2829622348), UINT32_C( 922259005), UINT32_C(4077139979), UINT32_C(3996236088),
+        UINT32_C(2403512228), UINT32_C(3654340301), UINT32_C(2281850890), UINT32_C(2596447272) },
+      { { UINT32_C(3454791234), UINT32_C( 690874216), UINT32_C(2829622348), UINT32_C(2403512228) },
+        { UINT32_C(2086004907), UINT32_C(3758884411), UINT32_C( 922259005), UINT32_C(3654340301) },
+        { UINT32_C(4021863664), UINT32_C(2231168418), UINT32_C(4077139979), UINT32_C(2281850890) },
+        { UINT32_C(1593583463), UINT32_C(2783298755), UINT32_C(3996236088), UINT32_C(2596447272) } } },
+    { { UINT32_C(3314130041), UINT32_C(2725902866), UINT32_C(3387262369), UINT32_C(4166409253),
+        UINT32_C(3058893676), UINT32_C(1412099185), UINT32_C(2673817979), UINT32_C( 484282220),
+        UINT32_C(3484527253), UINT32_C(2567876703), UINT32_C( 180719102), UINT32_C(1122759249),
+        UINT32_C(3296161390), UINT32_C( 258323547), UINT32_C( 954883547), UINT32_C( 167365499) },
+      { { UINT32_C(3314130041), UINT32_C(3058893676), UINT32_C(3484527253), UINT32_C(3296161390) },
+        { UINT32_C(2725902866), UINT32_C(1412099185), UINT32_C(2567876703), UINT32_C( 258323547) },
+        { UINT32_C(3387262369), UINT32_C(2673817979), UINT32_C( 180719102), UINT32_C( 954883547) },
+        { UINT32_C(4166409253), UINT32_C( 484282220), UINT32_C(1122759249), UINT32_C( 167365499) } } },
+    { { UINT32_C(1518080124), UINT32_C(3639710841), UINT32_C(1690873194), UINT32_C(1416132734),
+        UINT32_C(2233088020), UINT32_C(1272370443), UINT32_C(2534346690), UINT32_C(2739286947),
+        UINT32_C(2520243493), UINT32_C(3905904789), UINT32_C(1359836247), UINT32_C(1384494137),
+        UINT32_C(1550642012), UINT32_C(1811675698), UINT32_C(2817430175), UINT32_C(2379968261) },
+      { { UINT32_C(1518080124), UINT32_C(2233088020), UINT32_C(2520243493), UINT32_C(1550642012) },
+        { UINT32_C(3639710841), UINT32_C(1272370443), UINT32_C(3905904789), UINT32_C(1811675698) },
+        { UINT32_C(1690873194), UINT32_C(2534346690), UINT32_C(1359836247), UINT32_C(2817430175) },
+        { UINT32_C(1416132734), UINT32_C(2739286947), UINT32_C(1384494137), UINT32_C(2379968261) } } },
+    { { UINT32_C(3999970405), UINT32_C(2699216887), UINT32_C(1637249486), UINT32_C(3223342320),
+        UINT32_C(  34429850), UINT32_C(3954966422), UINT32_C(3666647017), UINT32_C(2041111153),
+        UINT32_C(3810505014), UINT32_C(3193999726), UINT32_C(3611168500), UINT32_C(2447384312),
+        UINT32_C(2731681054), UINT32_C( 977776449), UINT32_C(1792220982), UINT32_C(2992214185) },
+      { { UINT32_C(3999970405), UINT32_C(  34429850), UINT32_C(3810505014), UINT32_C(2731681054) },
+        { UINT32_C(2699216887), UINT32_C(3954966422), UINT32_C(3193999726), UINT32_C( 977776449) },
+        { UINT32_C(1637249486), UINT32_C(3666647017), UINT32_C(3611168500), UINT32_C(1792220982) },
+        { UINT32_C(3223342320), UINT32_C(2041111153), UINT32_C(2447384312), UINT32_C(2992214185) } } },
+    { { UINT32_C( 280471493), UINT32_C(2885007292), UINT32_C(3954409653), UINT32_C( 720217887),
+        UINT32_C(1874381998), UINT32_C( 590442626), UINT32_C( 526447238), UINT32_C( 266848949),
+        UINT32_C(2683787437), UINT32_C( 382708172), UINT32_C( 190359523), UINT32_C(2711025348),
+        UINT32_C(1670260854), UINT32_C(3202097291), UINT32_C(2590931949), UINT32_C(2301099466) },
+      { { UINT32_C( 280471493), UINT32_C(1874381998), UINT32_C(2683787437), UINT32_C(1670260854) },
+        { UINT32_C(2885007292), UINT32_C( 590442626), UINT32_C( 382708172), UINT32_C(3202097291) },
+        { UINT32_C(3954409653), UINT32_C( 526447238), UINT32_C( 190359523), UINT32_C(2590931949) },
+        { UINT32_C( 720217887), UINT32_C( 266848949), UINT32_C(2711025348), UINT32_C(2301099466) } } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x4_t r = simde_vld4q_u32(test_vec[i].a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[3], simde_vld1q_u32(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a[16];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint32x4x4_t r = simde_vld4q_u32(a);
+
+    simde_test_codegen_write_vu32(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u32x4(2, r.val[0], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r.val[1], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r.val[2], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u32x4(2, r.val[3], SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vld4q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[8];
+    uint64_t r[4][2];
+  } test_vec[] = {
+    { { UINT64_C( 8014193177152061673), UINT64_C( 2830028960185700327),
+        UINT64_C( 9888000746235534536), UINT64_C(16724216886728019533),
+        UINT64_C(18428691324665700785), UINT64_C(17352772786631905912),
+        UINT64_C(  999991755746536452), UINT64_C( 9643953549713083463) },
+      { { UINT64_C( 8014193177152061673), UINT64_C(18428691324665700785) },
+        { UINT64_C( 2830028960185700327), UINT64_C(17352772786631905912) },
+        { UINT64_C( 9888000746235534536), UINT64_C(  999991755746536452) },
+        { UINT64_C(16724216886728019533), UINT64_C( 9643953549713083463) } } },
+    { { UINT64_C( 4813949604581701672), UINT64_C( 9516759963853018328),
+        UINT64_C( 9369768492374042945), UINT64_C( 8110174165284675808),
+        UINT64_C(  538022540913455885), UINT64_C(  137682641950202617),
+        UINT64_C( 8130532338344875250), UINT64_C(17532026466676610001) },
+      { { UINT64_C( 4813949604581701672), UINT64_C(  538022540913455885) },
+        { UINT64_C( 9516759963853018328), UINT64_C(  137682641950202617) },
+        { UINT64_C( 9369768492374042945), UINT64_C( 8130532338344875250) },
+        { UINT64_C( 8110174165284675808), UINT64_C(17532026466676610001) } } },
+    { { UINT64_C( 4084861732787478140), UINT64_C( 2663603789250690912),
+        UINT64_C( 3130723989943729582), UINT64_C(11446397225396093104),
+        UINT64_C(18317825478033726648), UINT64_C(14632212108232348804),
+        UINT64_C( 4040424159626138176), UINT64_C(13258139382075926780) },
+      { { UINT64_C( 4084861732787478140), UINT64_C(18317825478033726648) },
+        { UINT64_C( 2663603789250690912), UINT64_C(14632212108232348804) },
+        { UINT64_C( 3130723989943729582), UINT64_C( 4040424159626138176) },
+        { UINT64_C(11446397225396093104), UINT64_C(13258139382075926780) } } },
+    { { UINT64_C(17559408357114184676), UINT64_C( 7865811991855556008),
+        UINT64_C( 6124884669253127404), UINT64_C(14860707544148439180),
+        UINT64_C(  881600068935422990), UINT64_C(14173313264668490699),
+        UINT64_C(10076159971822038970), UINT64_C( 7333750937535133815) },
+      { { UINT64_C(17559408357114184676), UINT64_C(  881600068935422990) },
+        { UINT64_C( 7865811991855556008), UINT64_C(14173313264668490699) },
+        { UINT64_C( 6124884669253127404), UINT64_C(10076159971822038970) },
+        { UINT64_C(14860707544148439180), UINT64_C( 7333750937535133815) } } },
+    { { UINT64_C(17238715857769051392), UINT64_C(10584814168710591004),
+        UINT64_C(17651356852291925318), UINT64_C( 5825162562892010152),
+        UINT64_C(14059492339086332059), UINT64_C(11587148244208380397),
+        UINT64_C(16179973314461395634), UINT64_C(17866507406370025786) },
+      { { UINT64_C(17238715857769051392), UINT64_C(14059492339086332059) },
+        { UINT64_C(10584814168710591004), UINT64_C(11587148244208380397) },
+        { UINT64_C(17651356852291925318), UINT64_C(16179973314461395634) },
+        { UINT64_C( 5825162562892010152), UINT64_C(17866507406370025786) } } },
+    { { UINT64_C( 9547592972597618397), UINT64_C(  221102734302961497),
+        UINT64_C( 4727432781057022934), UINT64_C( 2636473742504926840),
+        UINT64_C(17825715956539966791), UINT64_C( 5191215114252500969),
+        UINT64_C( 1337900951281054694), UINT64_C( 9675060444249395432) },
+      { { UINT64_C( 9547592972597618397), UINT64_C(17825715956539966791) },
+        { UINT64_C(  221102734302961497), UINT64_C( 5191215114252500969) },
+        { UINT64_C( 4727432781057022934), UINT64_C( 1337900951281054694) },
+        { UINT64_C( 2636473742504926840), UINT64_C( 9675060444249395432) } } },
+    { { UINT64_C(18159586251306010930), UINT64_C( 4092673515707070757),
+        UINT64_C(15388176764201892137), UINT64_C(  976853326394557235),
+        UINT64_C( 9133642364932899107), UINT64_C( 6431060255306313462),
+        UINT64_C( 3294190185333286909), UINT64_C( 3624498389349335101) },
+      { { UINT64_C(18159586251306010930), UINT64_C( 9133642364932899107) },
+        { UINT64_C( 4092673515707070757), UINT64_C( 6431060255306313462) },
+        { UINT64_C(15388176764201892137), UINT64_C( 3294190185333286909) },
+        { UINT64_C(  976853326394557235), UINT64_C( 3624498389349335101) } } },
+    { { UINT64_C( 2082763331030708610), UINT64_C( 5474995086975530077),
+        UINT64_C(12593311466023406477), UINT64_C( 4416134994308500531),
+        UINT64_C(16246480904615997462), UINT64_C( 5443505088889083036),
+        UINT64_C(17520694327065355997), UINT64_C(10443186450783554000) },
+      { { UINT64_C( 2082763331030708610), UINT64_C(16246480904615997462) },
+        { UINT64_C( 5474995086975530077), UINT64_C( 5443505088889083036) },
+        { UINT64_C(12593311466023406477), UINT64_C(17520694327065355997) },
+        { UINT64_C( 4416134994308500531), UINT64_C(10443186450783554000) } } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x4_t r = simde_vld4q_u64(test_vec[i].a);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[3], simde_vld1q_u64(test_vec[i].r[3]));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a[8];
+    simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+    simde_uint64x2x4_t r = simde_vld4q_u64(a);
+
+    simde_test_codegen_write_vu64(2, sizeof(a) / sizeof(a[0]), a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u64x2(2, r.val[0], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r.val[1], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r.val[2], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u64x2(2, r.val[3], SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_BEGIN
 #if !defined(SIMDE_BUG_INTEL_857088)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld4_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_u64)
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_END
 
@@ -0,0 +1,1504 @@
+#define SIMDE_TEST_ARM_SVE_INSN addv
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/addv.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+#include "../../../simde/arm/sve/dup.h"
+
+static int
+test_simde_svaddv_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0) };
+  static const int8_t a[] =
+    {  INT8_C(  42),  INT8_C(  62),  INT8_C(   5), -INT8_C( 117), -INT8_C(  43),  INT8_C(  42), -INT8_C(  28),  INT8_C( 116),
+      -INT8_C(  50),  INT8_C(  38),  INT8_C( 108), -INT8_C(  90),  INT8_C(  78), -INT8_C(  14), -INT8_C(  22),  INT8_C(  20),
+       INT8_C( 124),  INT8_C(  52), -INT8_C(  53),  INT8_C(  38), -INT8_C(   8),  INT8_C( 117), -INT8_C(  75),  INT8_C( 106),
+      -INT8_C(  73), -INT8_C(  71),  INT8_C(  40),  INT8_C(  89),  INT8_C(  53),  INT8_C(  21), -INT8_C(  63),  INT8_C(  95),
+       INT8_C(  83), -INT8_C(  57), -INT8_C(  22),  INT8_C(  40), -INT8_C(  15), -INT8_C(  49), -INT8_C(  99), -INT8_C(  64),
+      -INT8_C(  11),  INT8_C(   9),  INT8_C( 102),  INT8_C(  67), -INT8_C(   4),  INT8_C(  80),  INT8_C(  87),  INT8_C( 120),
+      -INT8_C( 124),  INT8_C(  35), -INT8_C(  98),  INT8_C( 124), -INT8_C( 104),  INT8_C(  83), -INT8_C(  26),  INT8_C(  79),
+       INT8_C(  12),  INT8_C(  14), -INT8_C(  87),  INT8_C(  65),  INT8_C(  35),  INT8_C( 106), -INT8_C(  95),  INT8_C( 119),
+       INT8_C(  49), -INT8_C( 117), -INT8_C(  97),  INT8_C(  35),  INT8_C(  90),  INT8_C(  60), -INT8_C(  29),  INT8_C(  80),
+       INT8_C(  70),  INT8_C(  73), -INT8_C( 109),  INT8_C(  66), -INT8_C( 102), -INT8_C(  21), -INT8_C(  70),  INT8_C(  30),
+       INT8_C(  14),  INT8_C(  88), -INT8_C( 101), -INT8_C(  90), -INT8_C(  85), -INT8_C( 127), -INT8_C(  11), -INT8_C(  73),
+      -INT8_C( 112), -INT8_C(  98), -INT8_C(   8), -INT8_C(  77),  INT8_C(   9), -INT8_C( 103),  INT8_C(  42),  INT8_C(  58),
+       INT8_C(  37), -INT8_C(  54),  INT8_C(  93),      INT8_MAX,  INT8_C(   6),  INT8_C(  64), -INT8_C(  49),  INT8_C(  76),
+      -INT8_C( 118),  INT8_C(  99), -INT8_C( 114),  INT8_C(  36),  INT8_C(  78),  INT8_C(  72),  INT8_C(  66),  INT8_C(  92),
+      -INT8_C(  96), -INT8_C(  35),  INT8_C(   2),  INT8_C(  75),  INT8_C(  95), -INT8_C(   9),  INT8_C(   2), -INT8_C(  17),
+      -INT8_C( 106), -INT8_C(   5), -INT8_C(  94), -INT8_C(  97), -INT8_C( 108), -INT8_C(  51), -INT8_C(  39), -INT8_C(  71),
+      -INT8_C( 105),  INT8_C(  55),  INT8_C(  57), -INT8_C(  99),  INT8_C( 119),  INT8_C(   8), -INT8_C(  22),  INT8_C(   1),
+       INT8_C( 107),  INT8_C( 120),  INT8_C(  37), -INT8_C(  71), -INT8_C(  63),  INT8_C( 104),  INT8_C(  21),  INT8_C(  97),
+       INT8_C(  69),  INT8_C(  23), -INT8_C(  83), -INT8_C(  92),  INT8_C(  15), -INT8_C(  81), -INT8_C( 109), -INT8_C(  91),
+      -INT8_C(  86),  INT8_C(  54),  INT8_C(  68),  INT8_C(  63),  INT8_C(   3),  INT8_C(  29), -INT8_C(   8), -INT8_C( 102),
+       INT8_C(  84),  INT8_C(  49),  INT8_C(  55), -INT8_C(  52),  INT8_C(  58),  INT8_C(  33), -INT8_C(  51), -INT8_C(  91),
+      -INT8_C( 102), -INT8_C(  13),  INT8_C(  95),  INT8_C(  91),  INT8_C(  91),  INT8_C( 116), -INT8_C(  68), -INT8_C(  96),
+      -INT8_C( 116),  INT8_C( 105),  INT8_C(  69), -INT8_C( 101),  INT8_C(  25), -INT8_C(  40),  INT8_C(  64), -INT8_C(  61),
+       INT8_C(  14), -INT8_C( 124),  INT8_C(   2),  INT8_C(  17), -INT8_C(  95), -INT8_C(   5), -INT8_C(  85), -INT8_C(  10),
+       INT8_C(  44), -INT8_C(  29), -INT8_C(  62),  INT8_C( 102),  INT8_C(   4), -INT8_C( 113),  INT8_C(  12), -INT8_C(  98),
+      -INT8_C( 126),  INT8_C( 107), -INT8_C(   7), -INT8_C(  35), -INT8_C(  33), -INT8_C(  74),  INT8_C( 126),  INT8_C( 107),
+       INT8_C(  31), -INT8_C(  61),  INT8_C(   6),  INT8_C(  56), -INT8_C( 101),  INT8_C(  70), -INT8_C(   4), -INT8_C(  86),
+      -INT8_C(  54), -INT8_C(   2), -INT8_C(  69),  INT8_C( 108), -INT8_C(   7),  INT8_C( 103),  INT8_C(  98),  INT8_C(  38),
+       INT8_C(  74),  INT8_C(  36), -INT8_C( 116),  INT8_C(  78), -INT8_C(  77), -INT8_C( 104), -INT8_C(  19),  INT8_C(  54),
+       INT8_C(   3), -INT8_C(  26),  INT8_C(  19), -INT8_C(  29), -INT8_C( 100), -INT8_C( 111),  INT8_C(  78), -INT8_C(  68),
+       INT8_C(  84),  INT8_C(  85), -INT8_C(  12), -INT8_C(  16), -INT8_C( 101), -INT8_C(  16), -INT8_C( 102),  INT8_C( 102),
+      -INT8_C(  17),  INT8_C(  85), -INT8_C(  46), -INT8_C(  24), -INT8_C(  68),  INT8_C(  52),  INT8_C(  14),  INT8_C(   6),
+       INT8_C(  88), -INT8_C( 101),  INT8_C(  85),  INT8_C(  11),  INT8_C(  51),  INT8_C(  66),  INT8_C(  65),  INT8_C(  55),
+       INT8_C(  40),  INT8_C(  85),  INT8_C(  26), -INT8_C(  59), -INT8_C(  26),  INT8_C( 104), -INT8_C( 127),  INT8_C(  59),
+      -INT8_C(  67),  INT8_C( 117),  INT8_C(  43),  INT8_C(  89),  INT8_C( 102), -INT8_C(  59), -INT8_C(  65),  INT8_C(  85),
+       INT8_C(  26), -INT8_C( 111),  INT8_C(  61), -INT8_C(  41), -INT8_C(  59),  INT8_C(  76), -INT8_C(  35),  INT8_C(  29),
+      -INT8_C(  25),  INT8_C(  50),  INT8_C(  40),  INT8_C(  26),  INT8_C( 116),  INT8_C( 106),  INT8_C(  81), -INT8_C(  99),
+      -INT8_C(  65),  INT8_C( 107),  INT8_C(  98), -INT8_C(  91), -INT8_C(  44), -INT8_C(  29), -INT8_C(  32), -INT8_C( 111),
+       INT8_C(  88),  INT8_C(  11), -INT8_C(  22), -INT8_C(  66), -INT8_C(  48), -INT8_C(  87),  INT8_C(  19), -INT8_C(  21),
+       INT8_C(  58),  INT8_C(  81), -INT8_C(  62), -INT8_C(   1), -INT8_C(  99), -INT8_C(  97),  INT8_C(  28), -INT8_C( 124),
+      -INT8_C(  46),  INT8_C(  69), -INT8_C(  98),  INT8_C(  70), -INT8_C(  81), -INT8_C(  16), -INT8_C(  29),  INT8_C( 110),
+       INT8_C(  91),  INT8_C(  69),  INT8_C(  19),  INT8_C(  47),  INT8_C(  40), -INT8_C(  12), -INT8_C(  63), -INT8_C( 127),
+      -INT8_C(   1), -INT8_C(  85),  INT8_C(  63), -INT8_C(  48),  INT8_C(  85),  INT8_C(  83), -INT8_C(  69), -INT8_C( 113),
+      -INT8_C(  92),  INT8_C( 125), -INT8_C( 113),  INT8_C(  65),  INT8_C(  28), -INT8_C(  85), -INT8_C(  59), -INT8_C(  18),
+      -INT8_C(  16),  INT8_C(  99),  INT8_C(  53), -INT8_C(  97),  INT8_C(  83),  INT8_C(  24),  INT8_C(  13), -INT8_C(  81),
+       INT8_C(  94),  INT8_C(  33), -INT8_C(  34), -INT8_C( 122),  INT8_C(  21), -INT8_C(  97),  INT8_C(   7),  INT8_C(  20),
+       INT8_C(  75),  INT8_C(  71), -INT8_C(  28), -INT8_C(  96), -INT8_C( 102), -INT8_C(  97),  INT8_C(  47),  INT8_C(  62),
+       INT8_C(  28), -INT8_C(  66),      INT8_MAX,  INT8_C(  57),  INT8_C( 106),  INT8_C(  68),  INT8_C(  39),  INT8_C(  90),
+      -INT8_C(  89),  INT8_C(  92), -INT8_C(   6), -INT8_C(   5),  INT8_C( 117),  INT8_C(   7), -INT8_C(  86), -INT8_C(  45),
+       INT8_C(  40), -INT8_C( 120),  INT8_C(  89),  INT8_C(  61),  INT8_C(  40),  INT8_C(  97),  INT8_C(  82),  INT8_C( 115),
+      -INT8_C(  88),  INT8_C(  54),  INT8_C(  19),  INT8_C(  66), -INT8_C(  42),  INT8_C(  66),      INT8_MIN, -INT8_C(  14),
+       INT8_C(   1), -INT8_C(   1),  INT8_C(  43),  INT8_C( 107),  INT8_C(  67),  INT8_C(  83), -INT8_C(  59), -INT8_C(  22),
+      -INT8_C(  81), -INT8_C(  65), -INT8_C(  27),  INT8_C(  36), -INT8_C(  57), -INT8_C( 113), -INT8_C(   9), -INT8_C(  17),
+       INT8_C(  24),  INT8_C(  81),  INT8_C(  45),  INT8_C(  64), -INT8_C(  78),      INT8_MAX, -INT8_C(  77),  INT8_C(  90),
+      -INT8_C(  75), -INT8_C(  58), -INT8_C( 100), -INT8_C( 117),  INT8_C(   8),  INT8_C(  28),  INT8_C( 126),  INT8_C(   9),
+       INT8_C(  27), -INT8_C(  87),  INT8_C( 116),  INT8_C(  94), -INT8_C(   4),  INT8_C(  58),  INT8_C(  72), -INT8_C(  84),
+      -INT8_C(   7),  INT8_C(  46), -INT8_C(  48), -INT8_C(  64), -INT8_C(  67), -INT8_C(  56), -INT8_C(  80), -INT8_C(  43),
+       INT8_C(  25), -INT8_C(  35),  INT8_C(  21), -INT8_C(  53),  INT8_C(  92), -INT8_C(  56),  INT8_C(  37),  INT8_C(  17),
+      -INT8_C( 114), -INT8_C(  63), -INT8_C(  99), -INT8_C( 105), -INT8_C(  35),  INT8_C(  27), -INT8_C(  96), -INT8_C(   8),
+      -INT8_C(  60),  INT8_C(  21),  INT8_C(  86), -INT8_C(  63),  INT8_C(  79), -INT8_C(  98),  INT8_C( 109),  INT8_C(  72),
+      -INT8_C(  52),  INT8_C(  61),  INT8_C(   9), -INT8_C( 118),  INT8_C(   5), -INT8_C(  71),  INT8_C(  95),  INT8_C(  30),
+      -INT8_C( 106),  INT8_C( 117), -INT8_C(  23), -INT8_C(  14),  INT8_C(  61),  INT8_C(  14),  INT8_C(   3), -INT8_C(  52),
+      -INT8_C(  49), -INT8_C(  96),  INT8_C(  99), -INT8_C(  84), -INT8_C(  69),  INT8_C(   3), -INT8_C(  92),      INT8_MIN,
+       INT8_C(  24), -INT8_C(   6),  INT8_C(  65),  INT8_C( 103), -INT8_C( 103), -INT8_C(  82), -INT8_C(  80),  INT8_C( 101),
+      -INT8_C(  21), -INT8_C(  71), -INT8_C(  17), -INT8_C(  15),  INT8_C( 114),  INT8_C(  79),  INT8_C(  15),  INT8_C(   8),
+      -INT8_C(  60), -INT8_C(   7), -INT8_C(   6),  INT8_C(   1),  INT8_C(   7), -INT8_C(   3), -INT8_C(  51), -INT8_C(  41),
+      -INT8_C(  98),  INT8_C(  48), -INT8_C( 125),  INT8_C(  89),  INT8_C(  52),  INT8_C(  40), -INT8_C(  39),  INT8_C(  76),
+       INT8_C(  34),  INT8_C(  26), -INT8_C(  76), -INT8_C(  69), -INT8_C(  56),  INT8_C( 100),  INT8_C(  33), -INT8_C(  76),
+       INT8_C(  29),  INT8_C(  16), -INT8_C(  91), -INT8_C( 113),  INT8_C(  95), -INT8_C(  76), -INT8_C( 105),  INT8_C(  35),
+      -INT8_C(  83), -INT8_C( 111),  INT8_C(  37), -INT8_C(  75), -INT8_C( 114), -INT8_C(  14), -INT8_C( 116),  INT8_C(  44),
+       INT8_C(  35),  INT8_C(  15), -INT8_C( 122),  INT8_C(  87),  INT8_C(  55),  INT8_C(  95), -INT8_C(  93),  INT8_C(  90),
+       INT8_C( 122),  INT8_C(  87),  INT8_C(  21),  INT8_C(  66), -INT8_C(  69),  INT8_C(  54), -INT8_C(  10), -INT8_C(  40),
+       INT8_C(  71), -INT8_C( 101),  INT8_C( 103), -INT8_C(  90),  INT8_C(  80), -INT8_C(   2), -INT8_C(  54), -INT8_C(   3),
+      -INT8_C( 113), -INT8_C(  17), -INT8_C(  78),  INT8_C(  30), -INT8_C(  31),  INT8_C(  62),  INT8_C(  74),  INT8_C(   4),
+       INT8_C(  78), -INT8_C(  48),  INT8_C(  91), -INT8_C( 123),  INT8_C(  48), -INT8_C(   1), -INT8_C(  33), -INT8_C(  86),
+       INT8_C(  86), -INT8_C(  11), -INT8_C(  20),  INT8_C(  18),  INT8_C(  43), -INT8_C(  29), -INT8_C(  22),  INT8_C( 114),
+       INT8_C( 126),  INT8_C(  82),  INT8_C(  25), -INT8_C(  50),  INT8_C(  80), -INT8_C(  29), -INT8_C(  52), -INT8_C(  32),
+      -INT8_C(  46),  INT8_C( 126), -INT8_C(   2), -INT8_C(  77), -INT8_C(  67),  INT8_C(  72), -INT8_C(  72),  INT8_C(  11),
+       INT8_C(  25),  INT8_C(  19), -INT8_C( 112),  INT8_C(  73),  INT8_C(  18),  INT8_C( 112), -INT8_C(  13),  INT8_C( 105),
+       INT8_C( 101), -INT8_C(  33),  INT8_C( 123), -INT8_C( 112), -INT8_C(  62),  INT8_C( 101),  INT8_C(   3),  INT8_C(  65),
+      -INT8_C(  73),  INT8_C(  28),  INT8_C(  15),  INT8_C(   8), -INT8_C(   1), -INT8_C(  37), -INT8_C(  24), -INT8_C(  47),
+       INT8_C(  90), -INT8_C(  26), -INT8_C( 124),  INT8_C(  23),  INT8_C(  46),  INT8_C(  60),  INT8_C(  34),  INT8_C(  71),
+       INT8_C(  80), -INT8_C(  78), -INT8_C( 112),  INT8_C(  98),  INT8_C(  34), -INT8_C( 125), -INT8_C(  53), -INT8_C( 121),
+       INT8_C(  99),  INT8_C(  70),  INT8_C(  24),  INT8_C(  37), -INT8_C(  84),  INT8_C(  27),  INT8_C( 102),  INT8_C(  99),
+       INT8_C(  55),  INT8_C( 118),  INT8_C( 107),  INT8_C(  54),  INT8_C(  81),  INT8_C(  83),  INT8_C(   7), -INT8_C(  85),
+       INT8_C(  57), -INT8_C( 117), -INT8_C(  62),  INT8_C( 104), -INT8_C(  56), -INT8_C(  28), -INT8_C(  81),  INT8_C(  24),
+      -INT8_C( 105),  INT8_C(  64),  INT8_C( 122), -INT8_C(  71), -INT8_C(  61),  INT8_C(  70),  INT8_C(  65),  INT8_C(  38),
+      -INT8_C( 116),  INT8_C(  89),  INT8_C(  76),  INT8_C(  56),  INT8_C( 116), -INT8_C(  78), -INT8_C( 100), -INT8_C(  85),
+       INT8_C(  40),  INT8_C(   7), -INT8_C(  31),  INT8_C( 122),  INT8_C(  91), -INT8_C(  24),  INT8_C(  37), -INT8_C( 108),
+       INT8_C( 115), -INT8_C(  24), -INT8_C(   4),  INT8_C(  59), -INT8_C(  52), -INT8_C(  84),  INT8_C(  83),  INT8_C(  99),
+      -INT8_C(  20), -INT8_C(  50),  INT8_C(  29), -INT8_C(  81),  INT8_C(  20),  INT8_C(  94), -INT8_C(  42), -INT8_C(  96),
+      -INT8_C(  73),  INT8_C(  34), -INT8_C(  39),  INT8_C(  43), -INT8_C(  44),  INT8_C( 117), -INT8_C(  42), -INT8_C(   3),
+       INT8_C( 124), -INT8_C(  73),  INT8_C( 119), -INT8_C(  41), -INT8_C(  97), -INT8_C( 100),  INT8_C( 108),  INT8_C(  18),
+      -INT8_C( 124),  INT8_C( 104),  INT8_C(  78),  INT8_C(  81),  INT8_C(  20), -INT8_C(  95), -INT8_C(  76),  INT8_C(   0),
+       INT8_C( 111), -INT8_C(  47), -INT8_C(  80), -INT8_C( 125),  INT8_C(  47), -INT8_C( 122),  INT8_C(  36), -INT8_C(  26),
+      -INT8_C(  88), -INT8_C(   3),  INT8_C(  17),  INT8_C( 124),  INT8_C( 114), -INT8_C(  25),  INT8_C( 121), -INT8_C(  18),
+      -INT8_C(  98), -INT8_C(  16), -INT8_C(  58),  INT8_C(  61), -INT8_C( 115),  INT8_C(  50),  INT8_C(  80),  INT8_C(  17),
+      -INT8_C( 102), -INT8_C(  98),  INT8_C(  98), -INT8_C(  81),  INT8_C(  63),  INT8_C(  23), -INT8_C(  81), -INT8_C(  81),
+      -INT8_C(  24),  INT8_C(  95),  INT8_C(  50),  INT8_C(  24), -INT8_C(  27),  INT8_C(  86), -INT8_C(   2), -INT8_C( 115),
+       INT8_C(  83),  INT8_C(  16),  INT8_C(  10), -INT8_C(  59), -INT8_C(   9), -INT8_C( 125), -INT8_C(  76), -INT8_C( 106),
+       INT8_C( 116),  INT8_C( 122), -INT8_C(  45),  INT8_C(   1), -INT8_C(  84),  INT8_C(  35),  INT8_C(  18),  INT8_C(  70),
+      -INT8_C(  63),  INT8_C( 117), -INT8_C(  11),  INT8_C(   1), -INT8_C( 116), -INT8_C(  91), -INT8_C(  80),  INT8_C( 116),
+       INT8_C(   4), -INT8_C(  30) };
+  static const int64_t e = -INT64_C(                 239);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int64_t r = INT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    r += simde_svaddv_s8(pv, av);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_i64(e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024];
+  int64_t e = INT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    e += simde_svaddv_s8(pv, av);
+
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1) };
+  static const int16_t a[] =
+    {  INT16_C(  7295),  INT16_C( 10120),  INT16_C( 15069),  INT16_C( 18419), -INT16_C( 15525), -INT16_C( 21954), -INT16_C( 23750), -INT16_C(  1535),
+       INT16_C(  3179), -INT16_C( 13684),  INT16_C( 20209), -INT16_C( 14612), -INT16_C( 13476),  INT16_C(  4923),  INT16_C( 17737), -INT16_C( 14149),
+       INT16_C( 17250),  INT16_C( 16367), -INT16_C(  7555), -INT16_C( 10106), -INT16_C( 15195), -INT16_C(  8318), -INT16_C( 31641), -INT16_C( 11558),
+       INT16_C( 26256), -INT16_C( 32355), -INT16_C( 30284),  INT16_C(  4168), -INT16_C( 31916), -INT16_C( 25309), -INT16_C(  8504),  INT16_C( 10853),
+       INT16_C( 21793), -INT16_C( 24727), -INT16_C(  4297), -INT16_C(  8841), -INT16_C(  1357),  INT16_C(  7100), -INT16_C( 27010),  INT16_C(  3821),
+      -INT16_C( 29956), -INT16_C( 20336), -INT16_C( 10221),  INT16_C( 26561), -INT16_C(  7077),  INT16_C(  8964),  INT16_C( 27331), -INT16_C(  7090),
+      -INT16_C( 18497), -INT16_C(  2429), -INT16_C(  1113),  INT16_C( 23251), -INT16_C( 28427),  INT16_C( 29557),  INT16_C( 25382),  INT16_C(  9089),
+       INT16_C(  4589),  INT16_C(   467), -INT16_C( 27415),  INT16_C( 17512),  INT16_C( 28025),  INT16_C( 15464), -INT16_C( 18729), -INT16_C( 27104),
+      -INT16_C( 23443),  INT16_C(  5260),  INT16_C( 24735), -INT16_C( 27537), -INT16_C(  6928),  INT16_C(  5639), -INT16_C( 30649),  INT16_C( 13625),
+       INT16_C(  3482), -INT16_C( 31946), -INT16_C( 24927),  INT16_C(  6856),  INT16_C( 12299), -INT16_C(  7594),  INT16_C( 30694),  INT16_C( 21368),
+       INT16_C(  1307), -INT16_C( 17816), -INT16_C( 10395),  INT16_C( 21838),  INT16_C( 21947),  INT16_C(   875), -INT16_C( 23075),  INT16_C( 30520),
+       INT16_C( 28338),  INT16_C( 21499), -INT16_C( 15604),  INT16_C(  6254), -INT16_C( 15117), -INT16_C(  9734),  INT16_C( 29499),  INT16_C( 22060),
+      -INT16_C( 27528), -INT16_C(  8944),  INT16_C( 24171),  INT16_C( 10034), -INT16_C( 25165), -INT16_C( 28374),  INT16_C( 25154), -INT16_C(  3064),
+       INT16_C(   976), -INT16_C(  9144), -INT16_C( 18746), -INT16_C( 17932), -INT16_C(  4230), -INT16_C( 18798), -INT16_C( 16542), -INT16_C(  9716),
+       INT16_C(  7507), -INT16_C( 16457), -INT16_C(  5765),  INT16_C( 12262),  INT16_C(  4230), -INT16_C( 13888), -INT16_C( 14222),  INT16_C( 17085),
+       INT16_C(  1484), -INT16_C( 28130),  INT16_C(  5051),  INT16_C( 13900), -INT16_C(  8702),  INT16_C( 25836), -INT16_C(  1891), -INT16_C(  3778),
+      -INT16_C(  2795), -INT16_C( 28240), -INT16_C( 26914),  INT16_C( 25792), -INT16_C( 32602),  INT16_C(  6189), -INT16_C(  5304),  INT16_C(  5210),
+       INT16_C( 30960), -INT16_C( 21337), -INT16_C(  3189), -INT16_C( 29214), -INT16_C( 12591),  INT16_C( 28657),  INT16_C( 12230), -INT16_C(  9120),
+       INT16_C(  4132),  INT16_C(   621),  INT16_C( 11686),  INT16_C( 19559), -INT16_C( 27475), -INT16_C(  2716), -INT16_C( 16769),  INT16_C( 28682),
+      -INT16_C( 20170), -INT16_C( 15844), -INT16_C(   348),  INT16_C( 30031),  INT16_C( 16844), -INT16_C( 27932),  INT16_C( 17520), -INT16_C( 27282),
+      -INT16_C(  9388), -INT16_C(  1385), -INT16_C(   504), -INT16_C( 19130), -INT16_C( 21869),  INT16_C(  4779), -INT16_C( 19096), -INT16_C( 24702),
+      -INT16_C( 24986),  INT16_C(  2657), -INT16_C( 20324),  INT16_C( 26751),  INT16_C( 25841),  INT16_C( 25339),  INT16_C( 27048), -INT16_C(   521),
+      -INT16_C( 29115),  INT16_C( 19959),  INT16_C( 16013),  INT16_C(  8195), -INT16_C( 20760),  INT16_C( 20786), -INT16_C( 19101), -INT16_C( 13840),
+       INT16_C( 20819), -INT16_C(  3885),  INT16_C( 20993), -INT16_C(  3240),  INT16_C( 21430),  INT16_C( 24405),  INT16_C( 19645),  INT16_C(   604),
+       INT16_C( 21466),  INT16_C( 26447),  INT16_C( 21137),  INT16_C( 31367), -INT16_C( 17920),  INT16_C( 25547), -INT16_C( 17553), -INT16_C( 15828),
+      -INT16_C(   244),  INT16_C(  3506),  INT16_C(  2898),  INT16_C(  2048),  INT16_C( 21854),  INT16_C(  7015), -INT16_C( 15455),  INT16_C( 31773),
+       INT16_C( 27927), -INT16_C( 22301),  INT16_C( 27583), -INT16_C( 16350), -INT16_C(  4827), -INT16_C( 27613),  INT16_C( 20648), -INT16_C( 19370),
+       INT16_C(  2383), -INT16_C( 24126), -INT16_C( 15852),  INT16_C( 29354),  INT16_C(  4376), -INT16_C( 18034), -INT16_C( 21547), -INT16_C(  5067),
+       INT16_C(  6424), -INT16_C( 10092), -INT16_C( 18556), -INT16_C( 22120), -INT16_C( 17500),  INT16_C( 19773), -INT16_C( 27893),  INT16_C( 23297),
+      -INT16_C( 15460), -INT16_C( 20228), -INT16_C( 22906), -INT16_C( 25053), -INT16_C( 20040), -INT16_C( 29353), -INT16_C( 29348),  INT16_C( 30073),
+       INT16_C(  3494),  INT16_C( 10829), -INT16_C(  6716),  INT16_C( 27091),  INT16_C(  4256), -INT16_C( 21322), -INT16_C( 18525),  INT16_C( 16391),
+       INT16_C(   891),  INT16_C(   496),  INT16_C(  5034),  INT16_C( 25247), -INT16_C(  2364),  INT16_C(  8687),  INT16_C( 26755),  INT16_C( 10646),
+      -INT16_C(  7307),  INT16_C( 14931),  INT16_C(  9928),  INT16_C( 26787),  INT16_C( 22838), -INT16_C(  9708),  INT16_C(  6928), -INT16_C( 29926),
+       INT16_C(  2591), -INT16_C( 13940),  INT16_C( 11038), -INT16_C(  7637),  INT16_C(  6690), -INT16_C( 23293), -INT16_C( 26238), -INT16_C(  2097),
+       INT16_C(  8828),  INT16_C( 17457), -INT16_C( 11191),  INT16_C( 32685), -INT16_C( 16083),  INT16_C( 15961),  INT16_C( 29661), -INT16_C(   823),
+       INT16_C( 22142), -INT16_C( 25403), -INT16_C(  3967), -INT16_C( 23682), -INT16_C( 32246), -INT16_C( 29623),  INT16_C(  6171), -INT16_C( 26493),
+      -INT16_C( 19142), -INT16_C( 31780), -INT16_C( 30327), -INT16_C( 18685),  INT16_C( 23627),  INT16_C( 10485), -INT16_C( 16688),  INT16_C( 20004),
+      -INT16_C(  5868), -INT16_C( 26902),  INT16_C( 26841), -INT16_C(  7367), -INT16_C( 32022),  INT16_C(  1647), -INT16_C(  3430), -INT16_C( 10850),
+       INT16_C( 31399),  INT16_C( 12632),  INT16_C( 23300),  INT16_C( 20456), -INT16_C(  8776), -INT16_C( 30601), -INT16_C( 25701), -INT16_C( 20266),
+      -INT16_C( 16252),  INT16_C( 23878),  INT16_C( 32552),  INT16_C(  4928), -INT16_C( 20734), -INT16_C( 25575), -INT16_C( 18527),  INT16_C( 18801),
+      -INT16_C( 13775),  INT16_C( 13690),  INT16_C( 25125), -INT16_C(  8828), -INT16_C(  1217), -INT16_C(  9627),  INT16_C( 15254),  INT16_C(  6794),
+      -INT16_C( 12037),  INT16_C(  9335), -INT16_C( 18608),  INT16_C( 21047),  INT16_C( 20582),  INT16_C(  2286),  INT16_C( 24583),  INT16_C( 14417),
+      -INT16_C( 13526),  INT16_C( 20334), -INT16_C(  3539),  INT16_C( 27693), -INT16_C( 27922), -INT16_C( 31674), -INT16_C( 11826), -INT16_C( 13921),
+       INT16_C(  5793), -INT16_C(  3603),  INT16_C(  9422),  INT16_C( 13379),  INT16_C( 12916),  INT16_C( 31548), -INT16_C( 29294), -INT16_C( 17228),
+       INT16_C(  8792), -INT16_C( 31477),  INT16_C( 14356),  INT16_C(   753),  INT16_C( 14539), -INT16_C( 26233),  INT16_C(  9737), -INT16_C( 21918),
+       INT16_C( 20540),  INT16_C(  2716), -INT16_C(  8332), -INT16_C(  5825),  INT16_C( 31505), -INT16_C( 23708),  INT16_C(  6153),  INT16_C( 24927),
+       INT16_C( 27450),  INT16_C( 20455), -INT16_C( 10077),  INT16_C( 28241), -INT16_C( 10224),  INT16_C(  6407),  INT16_C( 27390),  INT16_C( 15300),
+       INT16_C( 24762),  INT16_C( 11845), -INT16_C( 31681),  INT16_C( 20759),  INT16_C( 31744),  INT16_C(  2548),  INT16_C( 21652), -INT16_C( 12438),
+       INT16_C( 20927),  INT16_C( 25118),  INT16_C( 28458),  INT16_C( 15057), -INT16_C( 10168),  INT16_C( 18004),  INT16_C(  6210), -INT16_C(   895),
+      -INT16_C( 14472), -INT16_C( 18645),  INT16_C( 16971),  INT16_C( 19208), -INT16_C(   578),  INT16_C( 21332), -INT16_C( 16559),  INT16_C(  4130),
+       INT16_C( 16400),  INT16_C( 14962),  INT16_C( 17327), -INT16_C(  2187), -INT16_C( 14052),  INT16_C( 24126), -INT16_C( 16415),  INT16_C( 22875),
+      -INT16_C( 31098), -INT16_C( 11760),  INT16_C(  6600), -INT16_C( 30947),  INT16_C( 29206),  INT16_C( 26586), -INT16_C(   975),  INT16_C( 16759),
+      -INT16_C(  5828), -INT16_C(  5252), -INT16_C(  3795),  INT16_C( 18915),  INT16_C(  8634), -INT16_C( 25689),  INT16_C(   736),  INT16_C( 26612),
+       INT16_C(  1160),  INT16_C( 20793),  INT16_C( 22045),  INT16_C( 13272), -INT16_C( 19768), -INT16_C(  1638),  INT16_C(  4526), -INT16_C(  5573),
+      -INT16_C( 18437),  INT16_C( 10453), -INT16_C( 18264),  INT16_C( 25201),  INT16_C(  6361), -INT16_C( 17667), -INT16_C(  3813), -INT16_C( 23775),
+       INT16_C( 23285),  INT16_C(  5108), -INT16_C( 13136),  INT16_C( 31046) };
+  static const int64_t e =  INT64_C(              316713);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int64_t r = INT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    r += simde_svaddv_s16(pv, av);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_i64(e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)];
+  int64_t e = INT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    e += simde_svaddv_s16(pv, av);
+
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const int32_t a[] =
+    { -INT32_C(  1912658115),  INT32_C(   457242919), -INT32_C(  2008050986),  INT32_C(  1838070136),  INT32_C(   537922958), -INT32_C(   673594539),  INT32_C(   442038781),  INT32_C(   525405410),
+       INT32_C(  1538019380),  INT32_C(   544664650), -INT32_C(   156711298),  INT32_C(   224671615), -INT32_C(  1708297148),  INT32_C(   879822391), -INT32_C(   514930177),  INT32_C(   167813334),
+       INT32_C(   979741936),  INT32_C(   391830681),  INT32_C(   554566562),  INT32_C(  2117038650),  INT32_C(   504913126),  INT32_C(  1649576547),  INT32_C(   692363603),  INT32_C(   825443393),
+      -INT32_C(  1972594191),  INT32_C(   396478069),  INT32_C(    54046665),  INT32_C(   142763809),  INT32_C(   656841412),  INT32_C(  2022275108),  INT32_C(  1520553241),  INT32_C(    59561234),
+      -INT32_C(   477235090), -INT32_C(  1996869954), -INT32_C(     7654690),  INT32_C(  1577520538), -INT32_C(   863687256), -INT32_C(  1086058842), -INT32_C(   300226852),  INT32_C(   703702715),
+       INT32_C(  1544322718), -INT32_C(  1964767572), -INT32_C(   762679240),  INT32_C(   623939965),  INT32_C(  1710405055), -INT32_C(  1608239420), -INT32_C(   678543844), -INT32_C(  2113896476),
+      -INT32_C(  1444999939),  INT32_C(  1261749010), -INT32_C(  1323450829),  INT32_C(   248925775), -INT32_C(   948713469),  INT32_C(   459774207), -INT32_C(  1141639722),  INT32_C(  1899885428),
+       INT32_C(   303766528),  INT32_C(   324882400),  INT32_C(  1556380429), -INT32_C(   865362999),  INT32_C(  1653923427),  INT32_C(  1300167542),  INT32_C(  1695052273),  INT32_C(  1691829604),
+       INT32_C(  1115157090),  INT32_C(  1314247745),  INT32_C(   413801039),  INT32_C(   417666485),  INT32_C(  1786477044),  INT32_C(  1706555764), -INT32_C(   825507990),  INT32_C(  1731437061),
+      -INT32_C(   710301036), -INT32_C(   836501890), -INT32_C(   840512232), -INT32_C(   672740381), -INT32_C(  1186897596), -INT32_C(  1004603046), -INT32_C(  1114445384),  INT32_C(   522503563),
+      -INT32_C(   285946513), -INT32_C(   457435188), -INT32_C(   927816987), -INT32_C(  1298163602),  INT32_C(  1399578873), -INT32_C(  1843950887), -INT32_C(    11556493), -INT32_C(   568429457),
+       INT32_C(   231478081),  INT32_C(   267552810), -INT32_C(  1713920981),  INT32_C(   894137916),  INT32_C(   814266199), -INT32_C(  1262313663), -INT32_C(  1213001144), -INT32_C(   946417018),
+       INT32_C(   265642725),  INT32_C(   371181547), -INT32_C(  1481640341), -INT32_C(   992150931), -INT32_C(   218864463),  INT32_C(  1269282563),  INT32_C(  1325619913),  INT32_C(   286693676),
+      -INT32_C(   433984517),  INT32_C(   503070898), -INT32_C(  1547392202),  INT32_C(  1466409126),  INT32_C(   122313732), -INT32_C(   598478573),  INT32_C(  2016106059), -INT32_C(   360103441),
+      -INT32_C(   539907539),  INT32_C(   570281450),  INT32_C(   532988281),  INT32_C(  1719020642), -INT32_C(  1687240568), -INT32_C(    42483279),  INT32_C(   108372503),  INT32_C(   284229347),
+      -INT32_C(  1812938327),  INT32_C(   146075023),  INT32_C(   271022510),  INT32_C(   762813861),  INT32_C(   264824158), -INT32_C(  1123270746), -INT32_C(   993820191),  INT32_C(   701870976),
+       INT32_C(    79480181),  INT32_C(  1611428274), -INT32_C(  1888406550),  INT32_C(   784132304),  INT32_C(  1933477069), -INT32_C(  1540339005),  INT32_C(  1281946572),  INT32_C(   460668326),
+      -INT32_C(  1273024254), -INT32_C(  1944769630),  INT32_C(   790333022),  INT32_C(   996005742),  INT32_C(   514759515), -INT32_C(  1295851802),  INT32_C(  2013146065),  INT32_C(  1804825448),
+       INT32_C(  1193259684),  INT32_C(  1020474590),  INT32_C(   678162362),  INT32_C(   576965062),  INT32_C(  1245712740), -INT32_C(  1057225745), -INT32_C(  1774650834),  INT32_C(   302107501),
+       INT32_C(  1532567933),  INT32_C(   278408277), -INT32_C(   499645669),  INT32_C(   822385868), -INT32_C(  1652865875),  INT32_C(  1969059911), -INT32_C(   536046222), -INT32_C(   554562208),
+      -INT32_C(  2076619986), -INT32_C(  1818963593), -INT32_C(  1586115371),  INT32_C(   382892392),  INT32_C(    95637181),  INT32_C(   947523782) };
+  static const int64_t e =  INT64_C(          2135628381);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int64_t r = INT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    r += simde_svaddv_s32(pv, av);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_i64(e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)];
+  int64_t e = INT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    e += simde_svaddv_s32(pv, av);
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1) };
+  static const int64_t a[] =
+    { -INT64_C( 7673273616468785382),  INT64_C( 4529403462343322779), -INT64_C( 1227985782815561782), -INT64_C( 2677457321102468339),
+      -INT64_C( 9157136471393708279), -INT64_C( 3967990140017422020),  INT64_C( 6386817080281463364), -INT64_C( 2792861993614570077),
+      -INT64_C( 7494241179426420071),  INT64_C( 2535867294551572844), -INT64_C( 1165737083661794257),  INT64_C( 1742769353592585350),
+      -INT64_C( 1834206968389607526),  INT64_C( 3934317618534535832),  INT64_C( 7962508076579319877), -INT64_C(  300065099517472193),
+      -INT64_C( 7227297720729310125), -INT64_C( 3995630188828229042), -INT64_C(  111787626312680421),  INT64_C( 9009610664359704235),
+      -INT64_C( 4423663534298433283),  INT64_C( 8308195013143538944),  INT64_C( 3070866155770389984), -INT64_C( 1745354959882856417),
+       INT64_C( 1111970261355663672),  INT64_C(  719412835462055472),  INT64_C( 8731711505452003716), -INT64_C( 2490902199849032290),
+       INT64_C(  700864830785607323), -INT64_C( 5858747525387695234),  INT64_C( 4454304807421827837), -INT64_C( 5204416120122666173),
+      -INT64_C( 4077136139463339895), -INT64_C( 8773539253160248218),  INT64_C( 1249659617560883066), -INT64_C( 2804124841073370047),
+      -INT64_C(  639608379370867185),  INT64_C( 3004681253271604900),  INT64_C( 9192579382663942324),  INT64_C( 6620556756791364791),
+       INT64_C( 7561775517799750760), -INT64_C( 1137362057619540128), -INT64_C( 3705332104818492713), -INT64_C( 3875713192129498992),
+       INT64_C( 2016684351391263184), -INT64_C( 5884408285353045974),  INT64_C( 6610536361495873500),  INT64_C( 1437894316276551880),
+      -INT64_C( 7769092631192684713), -INT64_C( 7657719460689979340), -INT64_C( 7116175775274468073),  INT64_C( 4191368987252585939),
+      -INT64_C( 6237350837282352526), -INT64_C( 3377295398535861550), -INT64_C( 4657016770761807636),  INT64_C( 5946159846357607784),
+       INT64_C( 2301794935028765394),  INT64_C(  185997878461441544), -INT64_C( 6620535288789514124), -INT64_C( 4000755623151012537),
+       INT64_C( 5814711475810380103), -INT64_C( 7007699792674267736), -INT64_C( 1383135440328031249),  INT64_C( 8849730717124705810),
+      -INT64_C( 8516376295602528200),  INT64_C( 8639600117538087453),  INT64_C( 1448874859804419209), -INT64_C(  658672618062467282),
+      -INT64_C( 4163782735401915956),  INT64_C( 1020052695644274215),  INT64_C( 7561359309171182040), -INT64_C( 4306384657914918009),
+       INT64_C( 2305468042319147662), -INT64_C( 2829114883607426008), -INT64_C( 2854259265840612928),  INT64_C( 7019523929481817517),
+      -INT64_C( 5826085040570180595), -INT64_C( 6018189076730153822),  INT64_C( 9023817068979826193), -INT64_C( 4437578678433261258),
+       INT64_C( 4296412715448468073),  INT64_C( 2700005922479995873),  INT64_C( 6905358706700459911), -INT64_C( 1255428403215403236),
+       INT64_C( 2930010778320657108),  INT64_C( 7472155542966011768),  INT64_C( 1806949493862447756),  INT64_C( 2521027661336837002),
+      -INT64_C( 3438717843631252776),  INT64_C( 3748699857223433151), -INT64_C( 2206767840622951352), -INT64_C( 6924305559295407752),
+       INT64_C( 8065390232360351686), -INT64_C( 6837285183372244416),  INT64_C( 8867946120788510425), -INT64_C( 5479428371806944881),
+      -INT64_C(  450993589349928033), -INT64_C( 5042624339239580662), -INT64_C( 4502196439913600250), -INT64_C( 8386250144926415619),
+       INT64_C( 4139537237670522816),  INT64_C( 6485078267930629219), -INT64_C( 1981892907302196596),  INT64_C( 7143672883822106283),
+      -INT64_C(  557234056125940260),  INT64_C(  886993076688314530),  INT64_C( 4895492612838568485),  INT64_C(  569140390747946718),
+      -INT64_C( 5582398583982603781),  INT64_C( 2721292377026774070), -INT64_C( 5438622300181000790) };
+  static const int64_t e =  INT64_C( 5289402630037288662);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    r += HEDLEY_STATIC_CAST(uint64_t, simde_svaddv_s64(pv, av));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_i64(e, HEDLEY_STATIC_CAST(int64_t, r));
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)];
+  uint64_t e = UINT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    e += HEDLEY_STATIC_CAST(uint64_t, simde_svaddv_s64(pv, av));
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, HEDLEY_STATIC_CAST(int64_t, e));
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(152), UINT8_C( 72), UINT8_C( 98),    UINT8_MAX, UINT8_C(143), UINT8_C( 44), UINT8_C(251), UINT8_C(158),
+      UINT8_C( 44), UINT8_C(223), UINT8_C(245), UINT8_C(  1), UINT8_C( 67), UINT8_C( 95), UINT8_C(250), UINT8_C( 77),
+      UINT8_C(236), UINT8_C(180), UINT8_C(184), UINT8_C(154), UINT8_C(191), UINT8_C(215), UINT8_C( 21), UINT8_C(110),
+      UINT8_C( 64), UINT8_C(200), UINT8_C( 92), UINT8_C(213), UINT8_C( 77), UINT8_C( 43), UINT8_C(160), UINT8_C(229),
+      UINT8_C(116), UINT8_C(  2), UINT8_C(228), UINT8_C(  3), UINT8_C( 46), UINT8_C(224), UINT8_C(161), UINT8_C( 91),
+      UINT8_C(191), UINT8_C(150), UINT8_C( 92), UINT8_C(  2), UINT8_C(245), UINT8_C( 86), UINT8_C( 80), UINT8_C(225),
+      UINT8_C( 10), UINT8_C(  8), UINT8_C(124), UINT8_C(201), UINT8_C(223), UINT8_C(145), UINT8_C( 55), UINT8_C( 32),
+      UINT8_C( 89), UINT8_C(148), UINT8_C(245), UINT8_C(166), UINT8_C(191), UINT8_C(149), UINT8_C(139), UINT8_C( 51),
+      UINT8_C(152), UINT8_C(112), UINT8_C( 54), UINT8_C(198), UINT8_C( 80), UINT8_C(215), UINT8_C( 33), UINT8_C( 15),
+      UINT8_C(109), UINT8_C(125), UINT8_C( 17), UINT8_C( 99), UINT8_C(211), UINT8_C( 97), UINT8_C( 68), UINT8_C(222),
+      UINT8_C(106), UINT8_C(192), UINT8_C(167), UINT8_C( 73), UINT8_C( 81), UINT8_C(223), UINT8_C(105), UINT8_C(170),
+      UINT8_C(115), UINT8_C( 95), UINT8_C( 80), UINT8_C( 50), UINT8_C(244), UINT8_C(220), UINT8_C(102), UINT8_C(140),
+      UINT8_C( 76), UINT8_C(156), UINT8_C( 83), UINT8_C(156), UINT8_C(116), UINT8_C(116), UINT8_C(171), UINT8_C(225),
+      UINT8_C(242), UINT8_C(188), UINT8_C( 68), UINT8_C(197), UINT8_C( 30), UINT8_C(137), UINT8_C(163), UINT8_C(136),
+      UINT8_C( 73), UINT8_C( 75), UINT8_C(209), UINT8_C(155), UINT8_C( 42), UINT8_C( 59), UINT8_C( 69), UINT8_C(157),
+      UINT8_C(154), UINT8_C(150), UINT8_C(207), UINT8_C(142), UINT8_C(114), UINT8_C( 53), UINT8_C( 27), UINT8_C(190),
+      UINT8_C(210), UINT8_C(110), UINT8_C( 90), UINT8_C( 70), UINT8_C(226), UINT8_C(  5), UINT8_C( 39), UINT8_C(212),
+      UINT8_C(193), UINT8_C(108), UINT8_C(154), UINT8_C(223), UINT8_C(245), UINT8_C( 61), UINT8_C(103), UINT8_C( 62),
+      UINT8_C(136), UINT8_C( 57), UINT8_C(217), UINT8_C(178), UINT8_C(116), UINT8_C( 31), UINT8_C( 79), UINT8_C( 14),
+      UINT8_C(181), UINT8_C( 31), UINT8_C(156), UINT8_C( 39), UINT8_C( 84), UINT8_C(183), UINT8_C(229), UINT8_C( 38),
+      UINT8_C( 37), UINT8_C( 63), UINT8_C(108), UINT8_C(  8), UINT8_C( 68), UINT8_C(148), UINT8_C(220), UINT8_C(  5),
+      UINT8_C(  0), UINT8_C(118), UINT8_C(229), UINT8_C(245), UINT8_C(180), UINT8_C( 76), UINT8_C( 51), UINT8_C( 60),
+      UINT8_C(133), UINT8_C( 13), UINT8_C(239), UINT8_C(249), UINT8_C( 44), UINT8_C( 62), UINT8_C(  7), UINT8_C(225),
+      UINT8_C( 93), UINT8_C(164), UINT8_C(  8), UINT8_C(178), UINT8_C( 91), UINT8_C(237), UINT8_C(216), UINT8_C(129),
+      UINT8_C( 44), UINT8_C( 69), UINT8_C(137), UINT8_C(112), UINT8_C(217), UINT8_C(101), UINT8_C(117), UINT8_C(217),
+      UINT8_C(220), UINT8_C( 90), UINT8_C(206), UINT8_C(144), UINT8_C(167), UINT8_C(  1), UINT8_C(204), UINT8_C( 44),
+      UINT8_C( 14), UINT8_C(187), UINT8_C( 38), UINT8_C( 58), UINT8_C(250), UINT8_C( 45), UINT8_C( 27), UINT8_C( 87),
+      UINT8_C(209), UINT8_C( 35), UINT8_C(  9), UINT8_C( 45), UINT8_C( 16), UINT8_C(226), UINT8_C(174), UINT8_C( 60),
+      UINT8_C( 39), UINT8_C( 55), UINT8_C(172), UINT8_C(  0), UINT8_C(156), UINT8_C( 34), UINT8_C(217), UINT8_C(120),
+      UINT8_C(124), UINT8_C(167), UINT8_C(  8), UINT8_C( 35), UINT8_C(168), UINT8_C(213), UINT8_C( 80), UINT8_C(183),
+      UINT8_C(144), UINT8_C(118), UINT8_C(241), UINT8_C(138), UINT8_C(163), UINT8_C( 13), UINT8_C(226), UINT8_C(117),
+      UINT8_C( 48), UINT8_C(235), UINT8_C(162), UINT8_C( 65), UINT8_C(205), UINT8_C( 80), UINT8_C(125), UINT8_C(244),
+      UINT8_C(135), UINT8_C( 42), UINT8_C(244), UINT8_C( 35), UINT8_C( 76), UINT8_C(205), UINT8_C(156), UINT8_C(200),
+      UINT8_C(116), UINT8_C(164), UINT8_C(236), UINT8_C( 29), UINT8_C(121), UINT8_C( 60), UINT8_C(212), UINT8_C( 10),
+      UINT8_C(178), UINT8_C(197), UINT8_C(148), UINT8_C( 85), UINT8_C(210), UINT8_C(118), UINT8_C(202), UINT8_C(  3),
+      UINT8_C( 98), UINT8_C(108), UINT8_C( 68), UINT8_C( 47), UINT8_C(188), UINT8_C(193), UINT8_C( 36), UINT8_C( 67),
+      UINT8_C(235), UINT8_C( 24), UINT8_C(103), UINT8_C( 55), UINT8_C(230), UINT8_C(  3), UINT8_C(  0), UINT8_C( 90),
+      UINT8_C(167), UINT8_C(236), UINT8_C(119), UINT8_C( 33), UINT8_C( 40), UINT8_C( 75), UINT8_C( 43), UINT8_C(218),
+      UINT8_C( 17), UINT8_C(191), UINT8_C( 47), UINT8_C(227), UINT8_C( 54), UINT8_C(250), UINT8_C(230), UINT8_C(152),
+      UINT8_C(102), UINT8_C( 42), UINT8_C(199), UINT8_C( 35), UINT8_C(236), UINT8_C(235), UINT8_C(102), UINT8_C(215),
+      UINT8_C(  4), UINT8_C(205), UINT8_C( 15), UINT8_C(234), UINT8_C(208), UINT8_C( 15), UINT8_C( 68), UINT8_C(120),
+      UINT8_C(251), UINT8_C(188), UINT8_C(153), UINT8_C( 35), UINT8_C(  7), UINT8_C(196), UINT8_C(253), UINT8_C( 24),
+      UINT8_C(131), UINT8_C( 44), UINT8_C(252), UINT8_C(185), UINT8_C( 38), UINT8_C(226), UINT8_C( 81), UINT8_C(141),
+      UINT8_C( 13), UINT8_C( 25), UINT8_C(176), UINT8_C(249), UINT8_C(  4), UINT8_C( 22), UINT8_C(208), UINT8_C(  8),
+      UINT8_C(228), UINT8_C(223), UINT8_C(242), UINT8_C(180), UINT8_C(238), UINT8_C( 55), UINT8_C( 44), UINT8_C(233),
+      UINT8_C(243), UINT8_C(197), UINT8_C( 12), UINT8_C(250), UINT8_C(137), UINT8_C(  9), UINT8_C( 19), UINT8_C( 13),
+      UINT8_C( 54), UINT8_C( 15), UINT8_C(198), UINT8_C( 92), UINT8_C(241), UINT8_C( 24), UINT8_C(233), UINT8_C(254),
+      UINT8_C( 49), UINT8_C(153), UINT8_C(247), UINT8_C( 53), UINT8_C(176), UINT8_C(200), UINT8_C( 62), UINT8_C(148),
+      UINT8_C(167), UINT8_C( 48), UINT8_C( 72), UINT8_C(150), UINT8_C(103), UINT8_C(117), UINT8_C(127), UINT8_C( 90),
+      UINT8_C( 58), UINT8_C(140), UINT8_C( 85), UINT8_C(196), UINT8_C(149), UINT8_C(104), UINT8_C(209), UINT8_C(203),
+      UINT8_C(119), UINT8_C(151), UINT8_C( 40), UINT8_C(104), UINT8_C(175), UINT8_C( 17), UINT8_C(103), UINT8_C(224),
+      UINT8_C(171), UINT8_C( 94), UINT8_C( 22), UINT8_C( 91), UINT8_C( 38), UINT8_C( 84), UINT8_C(239), UINT8_C(206),
+      UINT8_C(132), UINT8_C( 55), UINT8_C(100), UINT8_C(236), UINT8_C(172), UINT8_C(227), UINT8_C( 70), UINT8_C(231),
+      UINT8_C(111), UINT8_C(155), UINT8_C(171), UINT8_C(  5), UINT8_C(  3), UINT8_C(124), UINT8_C(208), UINT8_C(122),
+      UINT8_C( 19), UINT8_C(248), UINT8_C(227), UINT8_C(195), UINT8_C( 10), UINT8_C( 74), UINT8_C(163), UINT8_C(181),
+      UINT8_C(168), UINT8_C(185), UINT8_C( 16), UINT8_C(207), UINT8_C( 13),    UINT8_MAX, UINT8_C(157), UINT8_C(146),
+      UINT8_C( 54), UINT8_C(  1), UINT8_C(126), UINT8_C(227), UINT8_C(228), UINT8_C(196), UINT8_C(202), UINT8_C( 84),
+      UINT8_C( 96), UINT8_C(117), UINT8_C( 89), UINT8_C( 99), UINT8_C(241), UINT8_C( 41), UINT8_C(222), UINT8_C(  4),
+      UINT8_C( 34), UINT8_C(193), UINT8_C(199), UINT8_C( 44), UINT8_C( 11), UINT8_C(107), UINT8_C(225), UINT8_C(179),
+      UINT8_C( 36), UINT8_C(241), UINT8_C(130), UINT8_C( 50), UINT8_C(240), UINT8_C( 31), UINT8_C(196), UINT8_C( 38),
+      UINT8_C( 32), UINT8_C( 66), UINT8_C(  9), UINT8_C(  5), UINT8_C(  6), UINT8_C(211), UINT8_C( 89), UINT8_C(102),
+      UINT8_C( 72), UINT8_C(178), UINT8_C(202), UINT8_C( 57), UINT8_C(219), UINT8_C(168), UINT8_C( 62), UINT8_C(253),
+      UINT8_C(105), UINT8_C(  5), UINT8_C( 41), UINT8_C(116), UINT8_C(112), UINT8_C( 10), UINT8_C( 39), UINT8_C(149),
+      UINT8_C(251), UINT8_C(170), UINT8_C(199), UINT8_C(235), UINT8_C(201), UINT8_C(139), UINT8_C( 18), UINT8_C(234),
+      UINT8_C(205), UINT8_C( 27), UINT8_C(239), UINT8_C(211), UINT8_C(239), UINT8_C( 72), UINT8_C( 58), UINT8_C( 55),
+      UINT8_C(250), UINT8_C(  4), UINT8_C(113), UINT8_C(213), UINT8_C(172), UINT8_C(175), UINT8_C(211), UINT8_C( 21),
+      UINT8_C(180), UINT8_C(252), UINT8_C(137), UINT8_C( 37), UINT8_C(  7), UINT8_C(176), UINT8_C(186), UINT8_C(  2),
+      UINT8_C( 90), UINT8_C(129), UINT8_C(238), UINT8_C( 36), UINT8_C( 12), UINT8_C(  0), UINT8_C( 14), UINT8_C(217),
+      UINT8_C( 27), UINT8_C(253), UINT8_C(172), UINT8_C( 10), UINT8_C( 69), UINT8_C(230), UINT8_C( 66), UINT8_C( 63),
+      UINT8_C(234), UINT8_C(179), UINT8_C( 20), UINT8_C(150), UINT8_C( 98), UINT8_C(231), UINT8_C(171), UINT8_C( 22),
+      UINT8_C(228), UINT8_C( 52), UINT8_C( 59), UINT8_C(235), UINT8_C(229), UINT8_C(245), UINT8_C(237), UINT8_C( 63),
+      UINT8_C(118), UINT8_C(219), UINT8_C( 99), UINT8_C(130), UINT8_C(219), UINT8_C(113), UINT8_C( 91), UINT8_C(247),
+      UINT8_C(110), UINT8_C(  8), UINT8_C(  1), UINT8_C(179), UINT8_C(238), UINT8_C( 67), UINT8_C(242), UINT8_C(217),
+      UINT8_C(246), UINT8_C(  7), UINT8_C(111), UINT8_C( 88), UINT8_C(238), UINT8_C( 27), UINT8_C(111), UINT8_C(210),
+      UINT8_C( 79), UINT8_C(170), UINT8_C(189), UINT8_C( 52), UINT8_C(160), UINT8_C(171), UINT8_C(116), UINT8_C( 22),
+      UINT8_C(134), UINT8_C(215), UINT8_C(153), UINT8_C( 98), UINT8_C( 73), UINT8_C(244), UINT8_C( 89), UINT8_C(183),
+      UINT8_C(252), UINT8_C( 90), UINT8_C(107), UINT8_C(235), UINT8_C(158), UINT8_C( 93), UINT8_C(196), UINT8_C(148),
+      UINT8_C(100), UINT8_C( 51), UINT8_C(237), UINT8_C( 83) };
+  static const uint64_t e = UINT64_C(               41350);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    r += simde_svaddv_u8(pv, av);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_u64(e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024];
+  uint64_t e = UINT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    e += simde_svaddv_u8(pv, av);
+
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(35306), UINT16_C(26836), UINT16_C(43111), UINT16_C(48983), UINT16_C(32909), UINT16_C(40628), UINT16_C(14062), UINT16_C(34383),
+      UINT16_C( 4546), UINT16_C(44449), UINT16_C(18265), UINT16_C(55470), UINT16_C(55657), UINT16_C(35631), UINT16_C(59034), UINT16_C(33853),
+      UINT16_C( 4464), UINT16_C(55276), UINT16_C(17593), UINT16_C(18327), UINT16_C(19396), UINT16_C(45797), UINT16_C(13697), UINT16_C(17208),
+      UINT16_C(55622), UINT16_C(40945), UINT16_C(40737), UINT16_C(35448), UINT16_C(42872), UINT16_C( 4630), UINT16_C(21389), UINT16_C(64919),
+      UINT16_C(33636), UINT16_C( 7637), UINT16_C(27847), UINT16_C(35684), UINT16_C(19127), UINT16_C(14397), UINT16_C(30335), UINT16_C(50556),
+      UINT16_C(27983), UINT16_C(28773), UINT16_C(56588), UINT16_C(34299), UINT16_C( 4484), UINT16_C( 4503), UINT16_C(11876), UINT16_C(51215),
+      UINT16_C(58546), UINT16_C(31205), UINT16_C(19024), UINT16_C( 1797), UINT16_C(17044), UINT16_C( 4927), UINT16_C(48056), UINT16_C( 2264),
+      UINT16_C(15656), UINT16_C(13688), UINT16_C(29466), UINT16_C(40634), UINT16_C(20868), UINT16_C(59568), UINT16_C(49024), UINT16_C(12976),
+      UINT16_C(38563), UINT16_C(62379), UINT16_C(45280), UINT16_C(29946), UINT16_C(14835), UINT16_C(43911), UINT16_C(24565), UINT16_C( 7603),
+      UINT16_C(11421), UINT16_C(46930), UINT16_C( 3231), UINT16_C( 9302), UINT16_C( 1630), UINT16_C(56844), UINT16_C(48581), UINT16_C(26640),
+      UINT16_C(47955), UINT16_C(13147), UINT16_C(21868), UINT16_C(24487), UINT16_C(11918), UINT16_C(33546), UINT16_C(48781), UINT16_C(10913),
+      UINT16_C(62442), UINT16_C(35298), UINT16_C(14336), UINT16_C(24237), UINT16_C(47678), UINT16_C(  828), UINT16_C(19575), UINT16_C(51819),
+      UINT16_C(50695), UINT16_C(29693), UINT16_C(42011), UINT16_C(43474), UINT16_C(56786), UINT16_C(24365), UINT16_C(52891), UINT16_C(34186),
+      UINT16_C(27841), UINT16_C(49422), UINT16_C(48292), UINT16_C(57887), UINT16_C(23414), UINT16_C(60901), UINT16_C(20647), UINT16_C(44983),
+      UINT16_C(46102), UINT16_C(12578), UINT16_C(62808), UINT16_C(10970), UINT16_C( 2002), UINT16_C(28041), UINT16_C( 5077), UINT16_C(38898),
+      UINT16_C(  127), UINT16_C( 9048), UINT16_C(30908), UINT16_C(12805), UINT16_C(60115), UINT16_C(31519), UINT16_C(54842), UINT16_C(20522),
+      UINT16_C(19594), UINT16_C(57985), UINT16_C(23617), UINT16_C( 4876), UINT16_C(38499), UINT16_C(14720), UINT16_C(29353), UINT16_C(10704),
+      UINT16_C(10355), UINT16_C(12108), UINT16_C(21152), UINT16_C(29794), UINT16_C(33084), UINT16_C(30703), UINT16_C( 6488), UINT16_C(58055),
+      UINT16_C(18789), UINT16_C(42949), UINT16_C(53669), UINT16_C( 2234), UINT16_C(15207), UINT16_C( 4417), UINT16_C( 4525), UINT16_C( 8250),
+      UINT16_C(34362), UINT16_C(55888), UINT16_C(45784), UINT16_C( 5454), UINT16_C(15667), UINT16_C(35724), UINT16_C(21334), UINT16_C(48238),
+      UINT16_C(13212), UINT16_C(16739), UINT16_C( 7428), UINT16_C(27722), UINT16_C(35672), UINT16_C( 1661), UINT16_C(47005), UINT16_C(55078),
+      UINT16_C(30269), UINT16_C( 5809), UINT16_C(   40), UINT16_C(23595), UINT16_C(46909), UINT16_C(38119), UINT16_C(21770), UINT16_C(42832),
+      UINT16_C(45960), UINT16_C(36328), UINT16_C(13008), UINT16_C(10745), UINT16_C(30398), UINT16_C(23343), UINT16_C(21805), UINT16_C(27186),
+      UINT16_C(58316), UINT16_C(62592), UINT16_C(44003), UINT16_C( 8528), UINT16_C(14434), UINT16_C(28085), UINT16_C( 1421), UINT16_C( 5652),
+      UINT16_C(64696), UINT16_C(34979), UINT16_C(39983), UINT16_C(60849), UINT16_C(57362), UINT16_C(16200), UINT16_C(31286), UINT16_C(  681),
+      UINT16_C(10845), UINT16_C(16886), UINT16_C(18389), UINT16_C(14434), UINT16_C( 6015), UINT16_C( 3237), UINT16_C(47388), UINT16_C(54306),
+      UINT16_C(50613), UINT16_C(58460), UINT16_C( 3681), UINT16_C(29649), UINT16_C( 6638), UINT16_C( 9394), UINT16_C(23699), UINT16_C(61734),
+      UINT16_C( 7558), UINT16_C(23346), UINT16_C(37988), UINT16_C(58259), UINT16_C(14507), UINT16_C(51183), UINT16_C( 4849), UINT16_C(42907),
+      UINT16_C(63447), UINT16_C(14731), UINT16_C(23813), UINT16_C(62636), UINT16_C(24438), UINT16_C( 2584), UINT16_C(16315), UINT16_C(16891),
+      UINT16_C(11612), UINT16_C(49308), UINT16_C(12481), UINT16_C(27811), UINT16_C(37480), UINT16_C(23091), UINT16_C(52900), UINT16_C(31745),
+      UINT16_C(36037), UINT16_C(52149), UINT16_C(25065), UINT16_C(24767), UINT16_C(55232), UINT16_C(31594), UINT16_C(25878), UINT16_C(29372),
+      UINT16_C(22930), UINT16_C(21298), UINT16_C(54665), UINT16_C(61887), UINT16_C(62056), UINT16_C( 3147), UINT16_C(19648), UINT16_C(34184),
+      UINT16_C(15833), UINT16_C(49744), UINT16_C( 3999), UINT16_C(24354), UINT16_C(36071), UINT16_C(64987), UINT16_C(38897), UINT16_C(33648),
+      UINT16_C(41712), UINT16_C(31190), UINT16_C(38264), UINT16_C(57451), UINT16_C(46727), UINT16_C(18412), UINT16_C(29955), UINT16_C(56525),
+      UINT16_C( 7602), UINT16_C(20894), UINT16_C(49453), UINT16_C( 5297), UINT16_C(35917), UINT16_C(16145), UINT16_C(33059), UINT16_C( 5314),
+      UINT16_C(39204), UINT16_C(40077), UINT16_C(63534), UINT16_C(46716), UINT16_C(26799), UINT16_C(45821), UINT16_C(51933), UINT16_C(37006),
+      UINT16_C(11496), UINT16_C( 5601), UINT16_C(37613), UINT16_C(15145), UINT16_C(14878), UINT16_C(17018), UINT16_C(15548), UINT16_C(57430),
+      UINT16_C(58325), UINT16_C( 1148), UINT16_C(63708), UINT16_C(35770), UINT16_C(46944), UINT16_C(15933), UINT16_C(52098), UINT16_C(27342),
+      UINT16_C(45047), UINT16_C(58751), UINT16_C(43074), UINT16_C(24608), UINT16_C(39650), UINT16_C(40610), UINT16_C(63702), UINT16_C(44158),
+      UINT16_C(64220), UINT16_C(47280), UINT16_C(27378), UINT16_C(21315), UINT16_C(32801), UINT16_C(41873), UINT16_C(24395), UINT16_C(16909),
+      UINT16_C(35854), UINT16_C(20519), UINT16_C(18228), UINT16_C( 6065), UINT16_C(21473), UINT16_C(47285), UINT16_C(13388), UINT16_C(10340),
+      UINT16_C( 5166), UINT16_C( 8672), UINT16_C( 9086), UINT16_C(40820), UINT16_C( 1443), UINT16_C(60995), UINT16_C(20580), UINT16_C(29232),
+      UINT16_C(22749) };
+  static const uint64_t e = UINT64_C(             4962980);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    r += simde_svaddv_u16(pv, av);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_u64(e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)];
+  uint64_t e = UINT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    e += simde_svaddv_u16(pv, av);
+
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(4033396391), UINT32_C(2353242260), UINT32_C(2689958446), UINT32_C(3024126339), UINT32_C(3506086033), UINT32_C(4186898723), UINT32_C(3153175835), UINT32_C(3500817449),
+      UINT32_C(2411729659), UINT32_C(3776709554), UINT32_C( 142700933), UINT32_C(2210185714), UINT32_C(2236921697), UINT32_C(3548308408), UINT32_C(2978901896), UINT32_C(2810263724),
+      UINT32_C(4231414346), UINT32_C(3420279365), UINT32_C(3050528707), UINT32_C(2184810528), UINT32_C(4278684999), UINT32_C(4174546288), UINT32_C(2712232181), UINT32_C(3796380312),
+      UINT32_C(3000925804), UINT32_C(2491268305), UINT32_C( 994725915), UINT32_C( 666731488), UINT32_C(2150024208), UINT32_C(1064892490), UINT32_C(4041220440), UINT32_C(3100780619),
+      UINT32_C(2003480998), UINT32_C(2282547053), UINT32_C( 415454775), UINT32_C(3913253337), UINT32_C(2406049349), UINT32_C(3083788638), UINT32_C(1302834690), UINT32_C(2097511126),
+      UINT32_C(2566156075), UINT32_C(2384461910), UINT32_C( 799466326), UINT32_C(2853758308), UINT32_C(2855895371), UINT32_C(1684080738), UINT32_C(2377255094), UINT32_C(2903160706),
+      UINT32_C(2101739047), UINT32_C(1426810367), UINT32_C(2911220041), UINT32_C(3797392791), UINT32_C(2173473055), UINT32_C(1340534169), UINT32_C(2027722998), UINT32_C(1982260815),
+      UINT32_C(3841223653), UINT32_C( 440008657), UINT32_C(1221050033), UINT32_C(2066358108), UINT32_C(1241298864), UINT32_C(2593710756), UINT32_C(3390272890), UINT32_C(1077950811),
+      UINT32_C(1965307044), UINT32_C(3851378228), UINT32_C(2016237340), UINT32_C( 653481846), UINT32_C(3010457614), UINT32_C(1296893906), UINT32_C(3625410684), UINT32_C(1041782681),
+      UINT32_C(3232972172), UINT32_C(3081061275), UINT32_C( 271635098), UINT32_C( 943072041), UINT32_C(3874202899), UINT32_C( 691222700), UINT32_C( 838945433), UINT32_C( 762321313),
+      UINT32_C(4058850390), UINT32_C(  27890279), UINT32_C(2383534436), UINT32_C( 281430012), UINT32_C(2566304236), UINT32_C(2193697257), UINT32_C( 347456115), UINT32_C( 843195868),
+      UINT32_C(2955161417), UINT32_C( 649186754), UINT32_C(2729755302), UINT32_C(4122114569), UINT32_C( 361670699), UINT32_C(1150767057), UINT32_C(3998829586), UINT32_C(3139476338),
+      UINT32_C(2355905738), UINT32_C(3081968913), UINT32_C(3915016160), UINT32_C( 232721634), UINT32_C(2250403253), UINT32_C(3469458108), UINT32_C(2025595910), UINT32_C(2301943231),
+      UINT32_C( 857120801), UINT32_C(2649409981), UINT32_C( 310854704), UINT32_C( 102786641), UINT32_C(2408334035), UINT32_C(  56514556), UINT32_C( 981146235), UINT32_C( 432320503),
+      UINT32_C( 223140431), UINT32_C(3551147683), UINT32_C(3437638011), UINT32_C(1792149143), UINT32_C(1174036040), UINT32_C( 826824886), UINT32_C(1785512818), UINT32_C(3263377523),
+      UINT32_C(2916077322), UINT32_C(2155903493), UINT32_C(1129080491), UINT32_C(3048021612), UINT32_C( 872064893), UINT32_C(1919173375), UINT32_C(2027737093), UINT32_C( 171663104),
+      UINT32_C( 867633710), UINT32_C( 817117316), UINT32_C( 192086174), UINT32_C(2629836831), UINT32_C(3352279752), UINT32_C(  20526076), UINT32_C(  75109636), UINT32_C(2718938484),
+      UINT32_C(1154926271), UINT32_C(2641660670), UINT32_C(2846418826), UINT32_C(3477432327), UINT32_C( 513217570), UINT32_C(1277153352), UINT32_C(1515231718), UINT32_C( 251486030),
+      UINT32_C( 609407782), UINT32_C(3888236125), UINT32_C(3029428653), UINT32_C(4085569233), UINT32_C( 856759275), UINT32_C(3514773995), UINT32_C( 422367178), UINT32_C(1428629807),
+      UINT32_C(1501133308), UINT32_C(3963632447), UINT32_C(1990250916), UINT32_C(2473141416), UINT32_C( 734427967), UINT32_C(1996244396), UINT32_C(1133455380), UINT32_C(1301853777),
+      UINT32_C(1856377391), UINT32_C(4049266509), UINT32_C(1617427384), UINT32_C(1609814303), UINT32_C(4169840972), UINT32_C( 326010622), UINT32_C(   5701295), UINT32_C(3830378420),
+      UINT32_C(1314059265), UINT32_C(2487201243), UINT32_C(3354699688), UINT32_C(3290884216), UINT32_C(2696720545), UINT32_C(3870501431), UINT32_C(3722840360), UINT32_C(4190188792),
+      UINT32_C(  71766825), UINT32_C(1754826688), UINT32_C(2788199726), UINT32_C( 376067701), UINT32_C(1052124679), UINT32_C(2032429392), UINT32_C(1800800883), UINT32_C(1751455551),
+      UINT32_C(3949767722), UINT32_C(1632830771), UINT32_C( 117932946), UINT32_C(3776803290), UINT32_C(3894400151), UINT32_C(2959164221), UINT32_C(2350692173), UINT32_C(4176773582),
+      UINT32_C(1642291501), UINT32_C(4173477734), UINT32_C(2499791546), UINT32_C(3547667515), UINT32_C( 784045296), UINT32_C( 635313367), UINT32_C(2712795859), UINT32_C(2845419131),
+      UINT32_C(1829403911), UINT32_C(1852165300), UINT32_C(3523437718), UINT32_C(1906669696), UINT32_C(3835650061), UINT32_C(1326022012), UINT32_C(4092640120), UINT32_C(1755089249),
+      UINT32_C(3134563846), UINT32_C( 153696883), UINT32_C( 517680286), UINT32_C(2978971812), UINT32_C(1553346272), UINT32_C( 615227308), UINT32_C(3138886490), UINT32_C( 723760165),
+      UINT32_C(3454466138), UINT32_C(3503755058), UINT32_C(3757027899), UINT32_C( 328302131), UINT32_C(1500522413), UINT32_C( 561847238), UINT32_C(3705443511), UINT32_C(2735145032),
+      UINT32_C( 728821240), UINT32_C( 939214844), UINT32_C( 756542202), UINT32_C( 373336169), UINT32_C(2507124943), UINT32_C(2209803468), UINT32_C(3378484096), UINT32_C(2339137171),
+      UINT32_C(1354161236), UINT32_C( 512274980), UINT32_C(  88842140), UINT32_C( 370903879), UINT32_C( 145459772), UINT32_C(4153107062), UINT32_C(2294344437), UINT32_C(2752719952),
+      UINT32_C( 754305544), UINT32_C( 407534972), UINT32_C(1662948636), UINT32_C(1568225569), UINT32_C( 979707076), UINT32_C(2066870406) };
+  static const uint64_t e = UINT64_C(        270825707447);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    r += simde_svaddv_u32(pv, av);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_u64(e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)];
+  uint64_t e = UINT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    e += simde_svaddv_u32(pv, av);
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C(12828062871960499145), UINT64_C( 4471222721612527095), UINT64_C(11931358520938837321), UINT64_C( 3602630558585954718),
+      UINT64_C(18102930105692099664), UINT64_C(15842037936782350396), UINT64_C(10443715531309793006), UINT64_C(15618866720009972264),
+      UINT64_C(  428011052989366769), UINT64_C( 4872468554657635377), UINT64_C( 4700488181002113466), UINT64_C(16593392934910532071),
+      UINT64_C( 8188049075906258643), UINT64_C( 8683453271059481320), UINT64_C( 8339927137647857251), UINT64_C(17569713267702664952),
+      UINT64_C( 7170065386850726095), UINT64_C(16981423313297454451), UINT64_C( 2751457676199710256), UINT64_C(  704505731060339122),
+      UINT64_C(17976006338326123928), UINT64_C( 7765283531699918927), UINT64_C(  141395339103382178), UINT64_C(10064026684200585831),
+      UINT64_C(12496950606660879343), UINT64_C( 1212672734916811055), UINT64_C(13313439095094049650), UINT64_C( 2332024789781812960),
+      UINT64_C( 4814915431893957831), UINT64_C( 1160381270273513117), UINT64_C(12719735247593405051), UINT64_C(12284378200687238954),
+      UINT64_C(12768445004860297437), UINT64_C(15683458449813528056), UINT64_C( 3769841687747524560), UINT64_C(10563203602976855050),
+      UINT64_C(  134742990378919705), UINT64_C( 4668048569034840721), UINT64_C(11885900576986328756), UINT64_C(11911503744582386183),
+      UINT64_C( 1629090873315872913), UINT64_C( 2592891890244596299), UINT64_C( 1691334828833758523), UINT64_C(14161325159534037590),
+      UINT64_C( 6164857288287738355), UINT64_C(11150081857185419819), UINT64_C(14560392080580911081), UINT64_C(18080038284845442289),
+      UINT64_C( 7920986501816600716), UINT64_C(17477279425430551953), UINT64_C(15249746764956957284), UINT64_C( 1000329635528461792),
+      UINT64_C(16418031120951824938), UINT64_C(  686904107978776717), UINT64_C( 5696915467921290074), UINT64_C( 1467355348728154319),
+      UINT64_C( 2278355844435214697), UINT64_C( 3163284859363095096), UINT64_C( 1760757130990175921), UINT64_C( 2773590358543082879),
+      UINT64_C(10121417212790176966), UINT64_C( 2012633403427990769), UINT64_C( 5437722494339142934), UINT64_C( 7580457174174064209),
+      UINT64_C( 9515885644350559278), UINT64_C(16062428682547329123), UINT64_C( 2423697256876877194), UINT64_C(13159063498370537361),
+      UINT64_C(18054729244700401527), UINT64_C(10765486622373369536), UINT64_C(16701756820433970134), UINT64_C(14998600126801180646),
+      UINT64_C( 7398405552043941402), UINT64_C(18149600116979233856), UINT64_C( 4771116700422753784), UINT64_C( 2921381563246596704),
+      UINT64_C( 1099025436838028595), UINT64_C( 9014301567789707257), UINT64_C( 9630386108999908104), UINT64_C( 6884254697859798612),
+      UINT64_C(16289090943850210095), UINT64_C(12369447139669993640), UINT64_C(14591299365316294101), UINT64_C(13157184428753861900),
+      UINT64_C(17429988601670979608), UINT64_C(15166654588022350635), UINT64_C( 5439585562393348412), UINT64_C( 8594304461638445320),
+      UINT64_C(16656101135768680939), UINT64_C( 5192420620691129407), UINT64_C( 3261582659632749497), UINT64_C(14697499447684548130),
+      UINT64_C(  837149241422934523) };
+  static const uint64_t e = UINT64_C(15641247069274367108);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    r += simde_svaddv_u64(pv, av);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_u64(e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)];
+  uint64_t e = UINT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    e += simde_svaddv_u64(pv, av);
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   -55.54), SIMDE_FLOAT32_C(   -56.41), SIMDE_FLOAT32_C(   -73.15), SIMDE_FLOAT32_C(   -59.15),
+      SIMDE_FLOAT32_C(    38.94), SIMDE_FLOAT32_C(     7.28), SIMDE_FLOAT32_C(   -83.67), SIMDE_FLOAT32_C(    41.67),
+      SIMDE_FLOAT32_C(    45.27), SIMDE_FLOAT32_C(   -56.40), SIMDE_FLOAT32_C(   -42.50), SIMDE_FLOAT32_C(     2.41),
+      SIMDE_FLOAT32_C(   -89.17), SIMDE_FLOAT32_C(   -43.34), SIMDE_FLOAT32_C(   -51.40), SIMDE_FLOAT32_C(    33.96),
+      SIMDE_FLOAT32_C(    99.61), SIMDE_FLOAT32_C(    44.41), SIMDE_FLOAT32_C(   -15.34), SIMDE_FLOAT32_C(     1.31),
+      SIMDE_FLOAT32_C(   -85.65), SIMDE_FLOAT32_C(    39.45), SIMDE_FLOAT32_C(     7.49), SIMDE_FLOAT32_C(    47.19),
+      SIMDE_FLOAT32_C(    35.17), SIMDE_FLOAT32_C(    63.16), SIMDE_FLOAT32_C(   -21.03), SIMDE_FLOAT32_C(   -91.52),
+      SIMDE_FLOAT32_C(    48.39), SIMDE_FLOAT32_C(    13.91), SIMDE_FLOAT32_C(    43.01), SIMDE_FLOAT32_C(    92.85),
+      SIMDE_FLOAT32_C(    57.50), SIMDE_FLOAT32_C(    69.86), SIMDE_FLOAT32_C(   -66.30), SIMDE_FLOAT32_C(    -3.57),
+      SIMDE_FLOAT32_C(   -22.87), SIMDE_FLOAT32_C(   -49.97), SIMDE_FLOAT32_C(   -61.90), SIMDE_FLOAT32_C(   -77.59),
+      SIMDE_FLOAT32_C(    -6.37), SIMDE_FLOAT32_C(    -4.40), SIMDE_FLOAT32_C(    24.82), SIMDE_FLOAT32_C(     4.45),
+      SIMDE_FLOAT32_C(    52.26), SIMDE_FLOAT32_C(    73.41), SIMDE_FLOAT32_C(   -61.58), SIMDE_FLOAT32_C(    51.87),
+      SIMDE_FLOAT32_C(    17.82), SIMDE_FLOAT32_C(    23.08), SIMDE_FLOAT32_C(   -46.81), SIMDE_FLOAT32_C(    32.17),
+      SIMDE_FLOAT32_C(   -37.47), SIMDE_FLOAT32_C(    60.68), SIMDE_FLOAT32_C(   -20.64), SIMDE_FLOAT32_C(    97.69),
+      SIMDE_FLOAT32_C(    23.85), SIMDE_FLOAT32_C(    58.34), SIMDE_FLOAT32_C(   -93.83), SIMDE_FLOAT32_C(   -27.77),
+      SIMDE_FLOAT32_C(   -27.76), SIMDE_FLOAT32_C(    49.18), SIMDE_FLOAT32_C(   -34.91), SIMDE_FLOAT32_C(   -70.26),
+      SIMDE_FLOAT32_C(    19.03), SIMDE_FLOAT32_C(    -1.22), SIMDE_FLOAT32_C(    26.18), SIMDE_FLOAT32_C(    96.17),
+      SIMDE_FLOAT32_C(    48.81), SIMDE_FLOAT32_C(    64.28), SIMDE_FLOAT32_C(   -81.43), SIMDE_FLOAT32_C(   -57.56),
+      SIMDE_FLOAT32_C(   -40.12), SIMDE_FLOAT32_C(    43.39), SIMDE_FLOAT32_C(    46.89), SIMDE_FLOAT32_C(   -87.86),
+      SIMDE_FLOAT32_C(    16.80), SIMDE_FLOAT32_C(    85.31), SIMDE_FLOAT32_C(    64.02), SIMDE_FLOAT32_C(   -65.38),
+      SIMDE_FLOAT32_C(     8.38), SIMDE_FLOAT32_C(   -82.80), SIMDE_FLOAT32_C(    66.79), SIMDE_FLOAT32_C(    70.91),
+      SIMDE_FLOAT32_C(    77.89), SIMDE_FLOAT32_C(   -53.84), SIMDE_FLOAT32_C(    68.60), SIMDE_FLOAT32_C(     1.73),
+      SIMDE_FLOAT32_C(   -95.51), SIMDE_FLOAT32_C(    74.77), SIMDE_FLOAT32_C(    73.97), SIMDE_FLOAT32_C(   -23.26),
+      SIMDE_FLOAT32_C(    23.95), SIMDE_FLOAT32_C(   -60.95), SIMDE_FLOAT32_C(     6.48), SIMDE_FLOAT32_C(   -57.02),
+      SIMDE_FLOAT32_C(    37.84), SIMDE_FLOAT32_C(   -67.35), SIMDE_FLOAT32_C(   -60.85), SIMDE_FLOAT32_C(   -13.35),
+      SIMDE_FLOAT32_C(    96.93), SIMDE_FLOAT32_C(   -42.28), SIMDE_FLOAT32_C(    29.09), SIMDE_FLOAT32_C(   -43.19),
+      SIMDE_FLOAT32_C(   -98.89), SIMDE_FLOAT32_C(   -24.02), SIMDE_FLOAT32_C(   -31.05), SIMDE_FLOAT32_C(    17.91),
+      SIMDE_FLOAT32_C(   -38.71), SIMDE_FLOAT32_C(   -67.03), SIMDE_FLOAT32_C(    52.53), SIMDE_FLOAT32_C(    69.67),
+      SIMDE_FLOAT32_C(   -49.83), SIMDE_FLOAT32_C(    19.33), SIMDE_FLOAT32_C(    40.58), SIMDE_FLOAT32_C(   -71.94),
+      SIMDE_FLOAT32_C(    65.48), SIMDE_FLOAT32_C(     9.19), SIMDE_FLOAT32_C(    29.79), SIMDE_FLOAT32_C(    69.97),
+      SIMDE_FLOAT32_C(   -16.04), SIMDE_FLOAT32_C(     3.75), SIMDE_FLOAT32_C(   -53.29), SIMDE_FLOAT32_C(   -92.09),
+      SIMDE_FLOAT32_C(    42.80), SIMDE_FLOAT32_C(    53.19), SIMDE_FLOAT32_C(   -49.11), SIMDE_FLOAT32_C(   -19.36),
+      SIMDE_FLOAT32_C(    85.84), SIMDE_FLOAT32_C(    -9.96), SIMDE_FLOAT32_C(    67.29), SIMDE_FLOAT32_C(    82.78),
+      SIMDE_FLOAT32_C(    47.76), SIMDE_FLOAT32_C(    -3.62), SIMDE_FLOAT32_C(   -60.41), SIMDE_FLOAT32_C(    48.87),
+      SIMDE_FLOAT32_C(    72.36), SIMDE_FLOAT32_C(     8.54), SIMDE_FLOAT32_C(   -33.22), SIMDE_FLOAT32_C(   -66.35),
+      SIMDE_FLOAT32_C(    41.51), SIMDE_FLOAT32_C(   -80.69), SIMDE_FLOAT32_C(   -96.67), SIMDE_FLOAT32_C(    91.68),
+      SIMDE_FLOAT32_C(    38.64), SIMDE_FLOAT32_C(    43.91), SIMDE_FLOAT32_C(   -80.26), SIMDE_FLOAT32_C(     4.12),
+      SIMDE_FLOAT32_C(   -46.90), SIMDE_FLOAT32_C(    49.53), SIMDE_FLOAT32_C(   -25.90), SIMDE_FLOAT32_C(    37.06),
+      SIMDE_FLOAT32_C(   -46.72), SIMDE_FLOAT32_C(    20.81), SIMDE_FLOAT32_C(    44.97), SIMDE_FLOAT32_C(    96.08),
+      SIMDE_FLOAT32_C(   -26.00), SIMDE_FLOAT32_C(    95.86), SIMDE_FLOAT32_C(   -23.28), SIMDE_FLOAT32_C(   -40.16),
+      SIMDE_FLOAT32_C(   -14.10), SIMDE_FLOAT32_C(   -55.99), SIMDE_FLOAT32_C(   -57.38), SIMDE_FLOAT32_C(   -66.33),
+      SIMDE_FLOAT32_C(    40.40), SIMDE_FLOAT32_C(   -17.79), SIMDE_FLOAT32_C(    82.54), SIMDE_FLOAT32_C(    12.76),
+      SIMDE_FLOAT32_C(    90.75), SIMDE_FLOAT32_C(   -50.68), SIMDE_FLOAT32_C(    46.41) };
+  static const simde_float32 e = SIMDE_FLOAT32_C(  -360.83);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  simde_float32 r = SIMDE_FLOAT32_C(0.0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    r += simde_svaddv_f32(pv, av);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_f32(e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)];
+  simde_float32 e = SIMDE_FLOAT32_C(0.0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    e += simde_svaddv_f32(pv, av);
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svaddv_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(    68.63), SIMDE_FLOAT64_C(    61.09), SIMDE_FLOAT64_C(     5.79), SIMDE_FLOAT64_C(   -43.27),
+      SIMDE_FLOAT64_C(   -22.96), SIMDE_FLOAT64_C(   -86.50), SIMDE_FLOAT64_C(    58.62), SIMDE_FLOAT64_C(    93.41),
+      SIMDE_FLOAT64_C(   -37.19), SIMDE_FLOAT64_C(   -22.22), SIMDE_FLOAT64_C(     3.39), SIMDE_FLOAT64_C(    -4.02),
+      SIMDE_FLOAT64_C(   -45.38), SIMDE_FLOAT64_C(   -16.97), SIMDE_FLOAT64_C(   -49.48), SIMDE_FLOAT64_C(   -32.18),
+      SIMDE_FLOAT64_C(   -10.26), SIMDE_FLOAT64_C(    68.63), SIMDE_FLOAT64_C(    24.94), SIMDE_FLOAT64_C(    36.39),
+      SIMDE_FLOAT64_C(   -98.26), SIMDE_FLOAT64_C(    14.67), SIMDE_FLOAT64_C(   -21.15), SIMDE_FLOAT64_C(    41.47),
+      SIMDE_FLOAT64_C(    -2.14), SIMDE_FLOAT64_C(    68.50), SIMDE_FLOAT64_C(   -97.81), SIMDE_FLOAT64_C(   -81.33),
+      SIMDE_FLOAT64_C(   -99.87), SIMDE_FLOAT64_C(     0.19), SIMDE_FLOAT64_C(    33.97), SIMDE_FLOAT64_C(    68.76),
+      SIMDE_FLOAT64_C(   -38.72), SIMDE_FLOAT64_C(   -60.24), SIMDE_FLOAT64_C(   -74.51), SIMDE_FLOAT64_C(    38.32),
+      SIMDE_FLOAT64_C(   -46.74), SIMDE_FLOAT64_C(    84.10), SIMDE_FLOAT64_C(    31.73), SIMDE_FLOAT64_C(    16.07),
+      SIMDE_FLOAT64_C(   -38.12), SIMDE_FLOAT64_C(   -64.87), SIMDE_FLOAT64_C(   -87.96), SIMDE_FLOAT64_C(    16.51),
+      SIMDE_FLOAT64_C(    18.15), SIMDE_FLOAT64_C(   -37.44), SIMDE_FLOAT64_C(    84.33), SIMDE_FLOAT64_C(   -92.11),
+      SIMDE_FLOAT64_C(   -68.80), SIMDE_FLOAT64_C(     9.27), SIMDE_FLOAT64_C(    44.29), SIMDE_FLOAT64_C(   -67.06),
+      SIMDE_FLOAT64_C(   -76.07), SIMDE_FLOAT64_C(   -76.86), SIMDE_FLOAT64_C(    74.41), SIMDE_FLOAT64_C(    21.80),
+      SIMDE_FLOAT64_C(    91.63), SIMDE_FLOAT64_C(    76.60), SIMDE_FLOAT64_C(    40.47), SIMDE_FLOAT64_C(    91.77),
+      SIMDE_FLOAT64_C(   -23.22), SIMDE_FLOAT64_C(   -25.56), SIMDE_FLOAT64_C(    60.53), SIMDE_FLOAT64_C(    38.06),
+      SIMDE_FLOAT64_C(    14.20), SIMDE_FLOAT64_C(    86.01), SIMDE_FLOAT64_C(   -23.62), SIMDE_FLOAT64_C(    67.46),
+      SIMDE_FLOAT64_C(    70.12), SIMDE_FLOAT64_C(   -91.89), SIMDE_FLOAT64_C(   -16.47), SIMDE_FLOAT64_C(   -68.00),
+      SIMDE_FLOAT64_C(   -56.76), SIMDE_FLOAT64_C(    -4.43), SIMDE_FLOAT64_C(    48.51), SIMDE_FLOAT64_C(    61.39),
+      SIMDE_FLOAT64_C(    58.13), SIMDE_FLOAT64_C(    32.84), SIMDE_FLOAT64_C(    69.29), SIMDE_FLOAT64_C(    89.33),
+      SIMDE_FLOAT64_C(   -57.90), SIMDE_FLOAT64_C(    13.58), SIMDE_FLOAT64_C(   -77.73), SIMDE_FLOAT64_C(   -33.96),
+      SIMDE_FLOAT64_C(    36.71) };
+  static const simde_float64 e = SIMDE_FLOAT64_C(   661.50);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  simde_float64 r = SIMDE_FLOAT64_C(0.0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    r += simde_svaddv_f64(pv, av);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_f64(e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)];
+  simde_float64 e = SIMDE_FLOAT64_C(0.0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    e += simde_svaddv_f64(pv, av);
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svaddv_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
@@ -0,0 +1,847 @@
+#define SIMDE_TEST_ARM_SVE_INSN compact
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/compact.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+#include "../../../simde/arm/sve/dup.h"
+
+static int
+test_simde_svcompact_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) };
+  static const int32_t a[] =
+    {  INT32_C(   845414530),  INT32_C(   602103680),  INT32_C(   983885744), -INT32_C(   801041488),  INT32_C(  1466792168),  INT32_C(  1931106923), -INT32_C(  1851399768), -INT32_C(   220385168),
+      -INT32_C(  1339801296),  INT32_C(  1372784545), -INT32_C(  1618184209),  INT32_C(  1936706955), -INT32_C(  1312105403), -INT32_C(   568007626),  INT32_C(   896518853),  INT32_C(   707218682),
+       INT32_C(   802901134),  INT32_C(  1115729491), -INT32_C(  1310651354),  INT32_C(   522473689),  INT32_C(  1674636845), -INT32_C(  1757219630), -INT32_C(  1194479170), -INT32_C(  1931217666),
+      -INT32_C(  1799635392), -INT32_C(  1831453844),  INT32_C(   558086216),  INT32_C(   893413128),  INT32_C(   664342613), -INT32_C(  1010836731), -INT32_C(  1971549044), -INT32_C(  1055498368),
+      -INT32_C(  1990864611),  INT32_C(  1427909389), -INT32_C(   327786525),  INT32_C(   471971783), -INT32_C(   867910969),  INT32_C(   579863445),  INT32_C(   262933647), -INT32_C(  1999584405),
+      -INT32_C(  1592711788),  INT32_C(   888548689),  INT32_C(  1411411341), -INT32_C(   344964572), -INT32_C(  1833388804),  INT32_C(  1186220215), -INT32_C(  1084858284), -INT32_C(  1203296733),
+      -INT32_C(  1655089076),  INT32_C(   332484742), -INT32_C(   513281347),  INT32_C(   818730804),  INT32_C(  1136821388),  INT32_C(   545945292), -INT32_C(    85991209),  INT32_C(  1387406854),
+       INT32_C(    99552383),  INT32_C(   421052764), -INT32_C(   403013709), -INT32_C(   501758378),  INT32_C(   388422219),  INT32_C(   658026576), -INT32_C(  1776150640), -INT32_C(  1108749250),
+       INT32_C(  1019402464),  INT32_C(  1280694937), -INT32_C(  1355591847),  INT32_C(  1636977430),  INT32_C(  1970845733), -INT32_C(   123883416),  INT32_C(   110018504),  INT32_C(  1958967187),
+      -INT32_C(   374307504), -INT32_C(  1204418977),  INT32_C(  1801939285), -INT32_C(   640878156),  INT32_C(   424625585), -INT32_C(  1122898699),  INT32_C(  1053008043),  INT32_C(  1739752983),
+       INT32_C(  1783718667), -INT32_C(  1105033367), -INT32_C(  1523938576),  INT32_C(   897513091),  INT32_C(   827247931),  INT32_C(  1693343929),  INT32_C(   396603904),  INT32_C(  1149195576),
+       INT32_C(   565104824),  INT32_C(  1205915991), -INT32_C(   554956197),  INT32_C(  1007905536), -INT32_C(   227712456), -INT32_C(  1034527806),  INT32_C(  1188690189),  INT32_C(   126507087),
+       INT32_C(  2133407784),  INT32_C(  1690765577),  INT32_C(   323203859),  INT32_C(  1464817182),  INT32_C(  2051652792),  INT32_C(   624729880), -INT32_C(   395635047), -INT32_C(  1745881746),
+       INT32_C(   924194862),  INT32_C(   882695457), -INT32_C(  1354178671), -INT32_C(   301557963),  INT32_C(  1818775380), -INT32_C(  2003720721),  INT32_C(   695270843),  INT32_C(   549478386),
+      -INT32_C(  1722230920),  INT32_C(  1171190964),  INT32_C(   150279891),  INT32_C(    32963501),  INT32_C(   980246347), -INT32_C(  1077739772), -INT32_C(   286772484),  INT32_C(   152021393),
+       INT32_C(   883124096),  INT32_C(   779776347),  INT32_C(   875982727), -INT32_C(  1254740630), -INT32_C(  1863343220), -INT32_C(  1638944350),  INT32_C(  1972189155),  INT32_C(  1618910432),
+       INT32_C(  1586831619),  INT32_C(   428609426), -INT32_C(   397491586),  INT32_C(  2073986287), -INT32_C(   905212633),  INT32_C(   577264191),  INT32_C(  1922561426), -INT32_C(  1798105455),
+      -INT32_C(   890083273), -INT32_C(   169640329),  INT32_C(   819802433), -INT32_C(   575898699),  INT32_C(  1218950921), -INT32_C(  1536553198), -INT32_C(  1776942587),  INT32_C(  1328277784),
+      -INT32_C(   937878191), -INT32_C(   574751332), -INT32_C(   468870354),  INT32_C(   532789526), -INT32_C(  2090375055),  INT32_C(  2082984567), -INT32_C(   334283308),  INT32_C(  2017148455),
+      -INT32_C(   146713253), -INT32_C(  2133524910), -INT32_C(  1335565671),  INT32_C(   214902171),  INT32_C(    93271949), -INT32_C(   578701815),  INT32_C(   466195700),  INT32_C(   781386962),
+      -INT32_C(  1423584167),  INT32_C(  1814887123),  INT32_C(  1998360796),  INT32_C(  1132784822),  INT32_C(   742920995), -INT32_C(  1106654518),  INT32_C(   836358750),  INT32_C(   811560150),
+       INT32_C(   349930561),  INT32_C(  1518339966),  INT32_C(  1322425752), -INT32_C(  1399761271),  INT32_C(   869849705),  INT32_C(    49406372), -INT32_C(  1993094477),  INT32_C(  2025427511),
+      -INT32_C(  1785948905),  INT32_C(   888147100),  INT32_C(   847430313), -INT32_C(  2116152296), -INT32_C(  1833584914),  INT32_C(  1251255959), -INT32_C(  1462450063),  INT32_C(  1897958746),
+      -INT32_C(  1090016222),  INT32_C(  1660155832), -INT32_C(   778799431),  INT32_C(  2018669450), -INT32_C(  1056307415),  INT32_C(   520855214), -INT32_C(  1043865754), -INT32_C(  1892489363),
+       INT32_C(  1263417747), -INT32_C(   374521296),  INT32_C(  1119503032), -INT32_C(   558232139), -INT32_C(  1029716972), -INT32_C(   907957406), -INT32_C(   141907830),  INT32_C(   579320975),
+       INT32_C(   644797942), -INT32_C(   821028073),  INT32_C(   303155805), -INT32_C(   319697961), -INT32_C(   223440753), -INT32_C(   960786373), -INT32_C(   927120072), -INT32_C(   135642111),
+       INT32_C(   824072218), -INT32_C(   788451724), -INT32_C(   790359304),  INT32_C(  1841092062), -INT32_C(  1587582363),  INT32_C(   862395130),  INT32_C(  1643848799), -INT32_C(  2091326103),
+      -INT32_C(  1296796098), -INT32_C(  1652312668), -INT32_C(  1502779448), -INT32_C(  1575802564), -INT32_C(  1908182125), -INT32_C(   306074995),  INT32_C(   927907022), -INT32_C(   541415775),
+      -INT32_C(  1047433443), -INT32_C(   329378524), -INT32_C(  1181561988), -INT32_C(  2007259404), -INT32_C(  1508467175) };
+  static const int32_t e[] =
+    { -INT32_C(   801041488),  INT32_C(  1466792168), -INT32_C(   220385168),  INT32_C(  1372784545), -INT32_C(  1618184209), -INT32_C(  1312105403), -INT32_C(   568007626),  INT32_C(  1115729491),
+       INT32_C(   522473689),  INT32_C(  1674636845), -INT32_C(  1194479170), -INT32_C(  1931217666),  INT32_C(   893413128),  INT32_C(  1427909389), -INT32_C(   327786525), -INT32_C(   867910969),
+      -INT32_C(   344964572), -INT32_C(  1833388804),  INT32_C(   818730804),  INT32_C(   545945292),  INT32_C(  1387406854),  INT32_C(    99552383),  INT32_C(   421052764), -INT32_C(   403013709),
+       INT32_C(   388422219), -INT32_C(   123883416), -INT32_C(  1204418977), -INT32_C(   640878156),  INT32_C(   424625585),  INT32_C(  1053008043), -INT32_C(  1105033367),  INT32_C(   897513091),
+       INT32_C(   827247931),  INT32_C(   396603904),  INT32_C(  1149195576),  INT32_C(  1205915991), -INT32_C(   554956197),  INT32_C(  1007905536), -INT32_C(  1034527806),  INT32_C(  1188690189),
+       INT32_C(   126507087),  INT32_C(  2133407784), -INT32_C(   395635047),  INT32_C(   882695457), -INT32_C(  1354178671), -INT32_C(   301557963),  INT32_C(  1818775380), -INT32_C(  2003720721),
+       INT32_C(   150279891),  INT32_C(   980246347),  INT32_C(   152021393),  INT32_C(   875982727), -INT32_C(  1254740630), -INT32_C(  1863343220), -INT32_C(  1638944350),  INT32_C(  1618910432),
+       INT32_C(   428609426), -INT32_C(   397491586),  INT32_C(  1922561426), -INT32_C(   890083273),  INT32_C(   819802433), -INT32_C(   575898699),  INT32_C(  1218950921), -INT32_C(  1536553198),
+       INT32_C(  1328277784), -INT32_C(   937878191), -INT32_C(   468870354),  INT32_C(   532789526),  INT32_C(  2082984567), -INT32_C(   334283308),  INT32_C(  2017148455), -INT32_C(   146713253),
+      -INT32_C(  1335565671), -INT32_C(   578701815),  INT32_C(   781386962), -INT32_C(  1423584167),  INT32_C(  1998360796),  INT32_C(   742920995),  INT32_C(   349930561),  INT32_C(  1518339966),
+      -INT32_C(  1399761271),  INT32_C(   869849705), -INT32_C(  1993094477), -INT32_C(  1785948905),  INT32_C(   847430313), -INT32_C(  2116152296), -INT32_C(  1833584914),  INT32_C(  1251255959),
+      -INT32_C(  1090016222),  INT32_C(  1660155832), -INT32_C(   778799431),  INT32_C(  2018669450),  INT32_C(   520855214), -INT32_C(  1043865754), -INT32_C(   558232139), -INT32_C(  1029716972),
+      -INT32_C(   141907830), -INT32_C(   821028073),  INT32_C(   303155805), -INT32_C(   223440753), -INT32_C(   135642111),  INT32_C(   824072218), -INT32_C(   790359304),  INT32_C(  1841092062),
+       INT32_C(  1643848799), -INT32_C(  2091326103), -INT32_C(  1652312668), -INT32_C(  1502779448), -INT32_C(  1908182125),  INT32_C(   927907022), -INT32_C(   541415775) };
+
+  static int32_t r[sizeof(a) / sizeof(a[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t n = 0;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b32(pg, pv));
+    simde_svst1_s32(simde_svwhilelt_b32_s32(0, c), &(r[n]), simde_svcompact_s32(pv, av));
+    n += c;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_i32(HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0])), n);
+  simde_assert_equal_vi32(n, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+  int32_t n = 0;
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b32(pg, pv));
+    simde_svst1_s32(simde_svwhilelt_b32_s32(0, c), &(e[n]), simde_svcompact_s32(pv, av));
+    n += c;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, n), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svcompact_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0) };
+  static const int64_t a[] =
+    { -INT64_C(  643072495689926952),  INT64_C( 7626962822978541945), -INT64_C(   65412466615650866), -INT64_C( 8623761410896686226),
+      -INT64_C( 5321983461371550412),  INT64_C( 2039780221559301022), -INT64_C( 3068501213450875978), -INT64_C( 6500625622085127535),
+       INT64_C( 6700500543201163784),  INT64_C( 6648033943721469400), -INT64_C( 5073531308856596133), -INT64_C( 7819722797617616796),
+       INT64_C( 1808430828202052605),  INT64_C( 4953258004536318395),  INT64_C( 1948824670153638954), -INT64_C( 4241147539418512123),
+      -INT64_C( 8209894084555244107), -INT64_C(  351372228573573134), -INT64_C( 4034564722043050703),  INT64_C( 1363038572438418013),
+      -INT64_C(  730682637084497030), -INT64_C( 6254110682865677464),  INT64_C( 4080142355549684244), -INT64_C( 1228277131514087547),
+       INT64_C( 9055638332754361523), -INT64_C( 9221988385831879453), -INT64_C( 5944762334544685972), -INT64_C( 2931699165122536210),
+      -INT64_C( 8786176923776676993),  INT64_C( 2207860795593836470), -INT64_C( 2355693828622124423), -INT64_C( 2324541987304120895),
+       INT64_C( 4270966631119997724), -INT64_C( 8854920141299898803),  INT64_C( 2939571171481781243), -INT64_C( 5003275307867829167),
+      -INT64_C( 2893915108504173546),  INT64_C( 3564303568126489829),  INT64_C( 6991531730194504822), -INT64_C(  770780880081644299),
+       INT64_C( 7712528183631857319),  INT64_C( 5188941519286754971), -INT64_C(   81297853281591442),  INT64_C( 4185777627175448897),
+      -INT64_C( 6226944409386375516),  INT64_C( 3561077107922235729), -INT64_C(   98359296685796965), -INT64_C( 5382587632203123841),
+       INT64_C( 9048422337591883995),  INT64_C( 2547079743679761509),  INT64_C( 1538095367236028572), -INT64_C( 8618915877357062244),
+       INT64_C( 2078133839069266477),  INT64_C( 2286314048859764495), -INT64_C( 8623316953693846873),  INT64_C( 2125304234855725897),
+       INT64_C(  121121043731967963),  INT64_C( 4136647045976486853), -INT64_C(  195684809925271084), -INT64_C( 1057658622287053500),
+      -INT64_C( 2570656986060043936),  INT64_C( 1364745983298497317),  INT64_C( 8367435426722637422), -INT64_C( 2044920637806800233),
+       INT64_C( 8698571099030757828), -INT64_C( 2827663077247296397),  INT64_C( 5055881769844905093), -INT64_C( 7885360056152894677),
+      -INT64_C( 4504122659790010701),  INT64_C( 5927358112136801537), -INT64_C( 9170119023117517624), -INT64_C(  692218148993191932),
+      -INT64_C(  606723749739441787),  INT64_C(  164280484554147368), -INT64_C( 8883853290644091168),  INT64_C( 3035350987613660647),
+      -INT64_C( 4649242485854495603),  INT64_C( 6977478249118227352),  INT64_C( 7732201743459962442), -INT64_C( 1296838360377744079),
+       INT64_C( 2821482692719279568),  INT64_C( 2424852873389661126), -INT64_C( 5040590623956321252),  INT64_C( 2751295118199792095),
+       INT64_C( 5783946326744866701),  INT64_C( 2920650382324940432), -INT64_C( 8377868846563298440),  INT64_C( 7562099971744025461),
+      -INT64_C( 4362921293020561768), -INT64_C( 4738716693844850424),  INT64_C( 5646804583737918501), -INT64_C( 5041487164033390395),
+       INT64_C( 6953364691739315849), -INT64_C( 9196719481480238759) };
+  static const int64_t e[] =
+    { -INT64_C( 8623761410896686226), -INT64_C( 3068501213450875978),  INT64_C( 6700500543201163784),  INT64_C( 6648033943721469400),
+       INT64_C( 4953258004536318395),  INT64_C( 1948824670153638954), -INT64_C(  351372228573573134), -INT64_C( 4034564722043050703),
+       INT64_C( 9055638332754361523), -INT64_C( 9221988385831879453), -INT64_C( 5944762334544685972), -INT64_C( 2931699165122536210),
+      -INT64_C( 8786176923776676993),  INT64_C( 2207860795593836470), -INT64_C( 2355693828622124423), -INT64_C( 2324541987304120895),
+       INT64_C( 4270966631119997724), -INT64_C( 2893915108504173546),  INT64_C( 3564303568126489829),  INT64_C( 5188941519286754971),
+      -INT64_C(   81297853281591442),  INT64_C( 4185777627175448897),  INT64_C( 3561077107922235729),  INT64_C( 9048422337591883995),
+      -INT64_C( 2570656986060043936),  INT64_C( 1364745983298497317),  INT64_C( 8698571099030757828), -INT64_C( 2827663077247296397),
+       INT64_C( 5055881769844905093), -INT64_C( 4504122659790010701),  INT64_C( 5927358112136801537), -INT64_C(  606723749739441787),
+       INT64_C(  164280484554147368), -INT64_C( 8883853290644091168),  INT64_C( 3035350987613660647), -INT64_C( 4649242485854495603),
+       INT64_C( 2821482692719279568),  INT64_C( 2424852873389661126),  INT64_C( 5783946326744866701),  INT64_C( 2920650382324940432),
+       INT64_C( 7562099971744025461), -INT64_C( 5041487164033390395) };
+
+  static int64_t r[sizeof(a) / sizeof(a[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t n = 0;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b64(pg, pv));
+    simde_svst1_s64(simde_svwhilelt_b64_s32(0, c), &(r[n]), simde_svcompact_s64(pv, av));
+    n += c;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_i32(HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0])), n);
+  simde_assert_equal_vi64(n, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+  int32_t n = 0;
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b64(pg, pv));
+    simde_svst1_s64(simde_svwhilelt_b64_s32(0, c), &(e[n]), simde_svcompact_s64(pv, av));
+    n += c;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, n), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svcompact_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(3949826626), UINT32_C(4267670619), UINT32_C( 739413058), UINT32_C(1838413462), UINT32_C(3845518799), UINT32_C(1793314879), UINT32_C(1973113404), UINT32_C(2924269164),
+      UINT32_C(3147479392), UINT32_C(2008676661), UINT32_C( 463719557), UINT32_C(2441688770), UINT32_C(1786166827), UINT32_C(3402914446), UINT32_C( 406810540), UINT32_C(2647034685),
+      UINT32_C(2035834948), UINT32_C(3757052506), UINT32_C(2700841950), UINT32_C(4113663177), UINT32_C(3495929666), UINT32_C(2912564225), UINT32_C(3787839907), UINT32_C(2843642981),
+      UINT32_C(1176754156), UINT32_C(3341161449), UINT32_C(1885807015), UINT32_C(3882195109), UINT32_C(1102562623), UINT32_C(2632864249), UINT32_C(2407380010), UINT32_C( 741997632),
+      UINT32_C(3161677011), UINT32_C( 377723247), UINT32_C(1602742970), UINT32_C(3242650754), UINT32_C(2852322737), UINT32_C(2017980750), UINT32_C(3842557093), UINT32_C(2467381696),
+      UINT32_C( 206537885), UINT32_C(3609448989), UINT32_C(1043770044), UINT32_C(1207991446), UINT32_C(3354526329), UINT32_C(2554345971), UINT32_C(3195881726), UINT32_C( 642944905),
+      UINT32_C( 825401619), UINT32_C( 805852532), UINT32_C(2523873279), UINT32_C( 903770043), UINT32_C(1711067249), UINT32_C( 150813706), UINT32_C( 231111556), UINT32_C( 489887754),
+      UINT32_C( 776890042), UINT32_C(3143522235), UINT32_C(1364315542), UINT32_C(2928029500), UINT32_C( 152273919), UINT32_C(1141969087), UINT32_C(2505169035), UINT32_C(2863891952),
+      UINT32_C(2799174123), UINT32_C(3999348568), UINT32_C(1094758916), UINT32_C(3790587617), UINT32_C( 166330953), UINT32_C(2655910930), UINT32_C(3291717332), UINT32_C( 242214435),
+      UINT32_C(1085622248), UINT32_C(2200901246), UINT32_C(2865000393), UINT32_C(2139861813), UINT32_C(3347609269), UINT32_C(1181078898), UINT32_C(2534054259), UINT32_C(1738897791),
+      UINT32_C(1067997889), UINT32_C( 985847665), UINT32_C(2078574150), UINT32_C(4009390137), UINT32_C(1488356070), UINT32_C(3416136535), UINT32_C( 878880948), UINT32_C(3818587938),
+      UINT32_C(3542238050), UINT32_C(1611523354), UINT32_C(2782720363), UINT32_C(1200871009), UINT32_C(2963229017), UINT32_C( 427507045), UINT32_C( 139320806), UINT32_C(1206643173),
+      UINT32_C(1192889644), UINT32_C(1588013042), UINT32_C(2047050520), UINT32_C(3015808602), UINT32_C(1164141024), UINT32_C(2220810142), UINT32_C(2710351036), UINT32_C(3253237653),
+      UINT32_C(1997013637), UINT32_C(1121300521), UINT32_C(2377963571), UINT32_C(1329626479), UINT32_C(2106893534), UINT32_C(1057092227), UINT32_C( 870420126), UINT32_C(2331363589),
+      UINT32_C(4110613964), UINT32_C(3778533293), UINT32_C( 527365040), UINT32_C(1332653937), UINT32_C(3603694163), UINT32_C(2467679988), UINT32_C(1640429148), UINT32_C(2364324800),
+      UINT32_C(1719791289), UINT32_C(1967634885), UINT32_C( 496285356), UINT32_C(3094151781), UINT32_C(4186847492), UINT32_C(1670161159), UINT32_C(1522881178), UINT32_C(3353784590),
+      UINT32_C(1680697247), UINT32_C(3453646112), UINT32_C(2431282731), UINT32_C(1967675249), UINT32_C(2557400721), UINT32_C( 335346297), UINT32_C(1533919565), UINT32_C( 287462258),
+      UINT32_C(3681898427), UINT32_C(4020785092), UINT32_C( 796890046), UINT32_C(2074396650), UINT32_C( 387191709), UINT32_C(1512706061), UINT32_C(1135974609), UINT32_C(2790578155),
+      UINT32_C(3951216935), UINT32_C(3621464601), UINT32_C(2818988733), UINT32_C(3206785570), UINT32_C(3419813821), UINT32_C( 405078343), UINT32_C(2220612505), UINT32_C(3643518898),
+      UINT32_C(2462428537), UINT32_C(2506727639), UINT32_C( 473788410), UINT32_C(3621543961), UINT32_C(3751981720), UINT32_C(1291372467), UINT32_C(1439781794), UINT32_C(2083453955),
+      UINT32_C(2148463529), UINT32_C(2383771539), UINT32_C(4289352422), UINT32_C(1272350387), UINT32_C(3962206265), UINT32_C(3795395136), UINT32_C(2033650294), UINT32_C(2952095238),
+      UINT32_C(3979281241), UINT32_C(1618691450), UINT32_C(1247749527), UINT32_C(3851761324), UINT32_C(4006723758), UINT32_C(1490094818), UINT32_C( 449906708), UINT32_C(3368666734),
+      UINT32_C(1135999433), UINT32_C(3584241726), UINT32_C(  18875221), UINT32_C(3890656569), UINT32_C(1490466933), UINT32_C(3618678722), UINT32_C( 519144111), UINT32_C( 317111112),
+      UINT32_C(4065696692), UINT32_C( 549976523), UINT32_C( 891480060), UINT32_C( 303827101), UINT32_C(2204824256), UINT32_C(1230642073), UINT32_C(3848752029), UINT32_C(3136769286),
+      UINT32_C(3014413800), UINT32_C(1121154118), UINT32_C(4168611163), UINT32_C(3188429822), UINT32_C( 524383622), UINT32_C( 761830288), UINT32_C(3977498599), UINT32_C(  78121500),
+      UINT32_C(2646037591), UINT32_C( 618630088), UINT32_C(2115786368) };
+  static const uint32_t e[] =
+    { UINT32_C(3949826626), UINT32_C(4267670619), UINT32_C( 739413058), UINT32_C(1838413462), UINT32_C(1793314879), UINT32_C(1973113404), UINT32_C(3147479392), UINT32_C(2008676661),
+      UINT32_C( 463719557), UINT32_C(2441688770), UINT32_C(1786166827), UINT32_C( 406810540), UINT32_C(2647034685), UINT32_C(3495929666), UINT32_C(3787839907), UINT32_C(2843642981),
+      UINT32_C(1176754156), UINT32_C(3341161449), UINT32_C(1885807015), UINT32_C(2632864249), UINT32_C( 741997632), UINT32_C(1602742970), UINT32_C(3242650754), UINT32_C(2852322737),
+      UINT32_C( 206537885), UINT32_C(3609448989), UINT32_C(1207991446), UINT32_C(3195881726), UINT32_C( 805852532), UINT32_C(2523873279), UINT32_C( 150813706), UINT32_C( 231111556),
+      UINT32_C(1364315542), UINT32_C(2928029500), UINT32_C( 152273919), UINT32_C(1141969087), UINT32_C(2863891952), UINT32_C(1094758916), UINT32_C(3790587617), UINT32_C(1085622248),
+      UINT32_C(2865000393), UINT32_C(2139861813), UINT32_C(3347609269), UINT32_C(1067997889), UINT32_C(2078574150), UINT32_C(3416136535), UINT32_C(3818587938), UINT32_C(1200871009),
+      UINT32_C(2963229017), UINT32_C(1206643173), UINT32_C(1192889644), UINT32_C(2047050520), UINT32_C(3015808602), UINT32_C(2220810142), UINT32_C(1997013637), UINT32_C(1121300521),
+      UINT32_C(1329626479), UINT32_C(1057092227), UINT32_C( 527365040), UINT32_C(2364324800), UINT32_C( 496285356), UINT32_C(1670161159), UINT32_C(3353784590), UINT32_C(1680697247),
+      UINT32_C(3453646112), UINT32_C(2431282731), UINT32_C(2557400721), UINT32_C( 335346297), UINT32_C( 287462258), UINT32_C(3681898427), UINT32_C(4020785092), UINT32_C( 796890046),
+      UINT32_C(2074396650), UINT32_C( 387191709), UINT32_C(2790578155), UINT32_C(3951216935), UINT32_C(2462428537), UINT32_C( 473788410), UINT32_C(3751981720), UINT32_C(2083453955),
+      UINT32_C(2148463529), UINT32_C(3962206265), UINT32_C(1618691450), UINT32_C(1247749527), UINT32_C(3851761324), UINT32_C(1490094818), UINT32_C( 449906708), UINT32_C(1135999433),
+      UINT32_C(  18875221), UINT32_C(1490466933), UINT32_C( 317111112), UINT32_C(2204824256), UINT32_C(3848752029), UINT32_C(3136769286), UINT32_C(1121154118), UINT32_C(4168611163),
+      UINT32_C( 524383622), UINT32_C(3977498599), UINT32_C(  78121500), UINT32_C(2115786368) };
+
+  static uint32_t r[sizeof(a) / sizeof(a[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t n = 0;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b32(pg, pv));
+    simde_svst1_u32(simde_svwhilelt_b32_s32(0, c), &(r[n]), simde_svcompact_u32(pv, av));
+    n += c;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_i32(HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0])), n);
+  simde_assert_equal_vu32(n, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+  int32_t n = 0;
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b32(pg, pv));
+    simde_svst1_u32(simde_svwhilelt_b32_s32(0, c), &(e[n]), simde_svcompact_u32(pv, av));
+    n += c;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, n), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svcompact_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C(12425653334010925383), UINT64_C(12731350342969030003), UINT64_C( 6261117620357779913), UINT64_C( 4211077804672273322),
+      UINT64_C(10078279810465746514), UINT64_C( 3751824406238368947), UINT64_C( 1017147644587241082), UINT64_C( 3862746953184650094),
+      UINT64_C( 6425586250813958282), UINT64_C( 5294205453045770200), UINT64_C( 5236611983214655290), UINT64_C( 4425425120318289745),
+      UINT64_C(17126075664917516460), UINT64_C( 7839545610749437874), UINT64_C( 6486228041252658145), UINT64_C(11249703732189834286),
+      UINT64_C(13387965874907905225), UINT64_C( 9701323853941963779), UINT64_C(10467848104831986913), UINT64_C(10916040285724267760),
+      UINT64_C(  814377513218567308), UINT64_C( 8099974132629866556), UINT64_C(16033836046497851791), UINT64_C( 1358183305677108597),
+      UINT64_C(14608819085474418344), UINT64_C( 8104813431890967932), UINT64_C(16972631543055046077), UINT64_C( 3274969623470885339),
+      UINT64_C( 9848979914787526997), UINT64_C( 3236132575379675800), UINT64_C(  955995885497961443), UINT64_C(14870289450955338154),
+      UINT64_C( 8038750332231236602), UINT64_C( 1321192066199855803), UINT64_C( 4133090108778425628), UINT64_C(11846654681330272545),
+      UINT64_C( 3838818932146968833), UINT64_C( 2062003214053420635), UINT64_C(15684003098251626977), UINT64_C(15554547826635772302),
+      UINT64_C( 1991705667067414260), UINT64_C(10826447573999812900), UINT64_C(18221474404918274381), UINT64_C( 2336541565359772351),
+      UINT64_C( 3923252180241226903), UINT64_C(12285706937099163955), UINT64_C(17558846874862978370), UINT64_C( 9884828276617765600),
+      UINT64_C( 2331549510102203411), UINT64_C(10408813031450063980), UINT64_C(10462968804366426637), UINT64_C(14289020790192913616),
+      UINT64_C(17047890957005696392), UINT64_C( 3807837634130452474), UINT64_C(15604313036145563978), UINT64_C( 9213775461108886372),
+      UINT64_C(  684700038105253908), UINT64_C(12143157451047384362), UINT64_C(  441687707742370114), UINT64_C(13318265206252354652),
+      UINT64_C( 9069068034534918339), UINT64_C(10883040125702253571), UINT64_C( 4103908308365126732), UINT64_C(14995683891057791422),
+      UINT64_C( 4104887254015698983), UINT64_C( 7247876304045458857), UINT64_C( 3918772103390852429), UINT64_C( 8373514752170192472),
+      UINT64_C(18197327915386852891), UINT64_C( 1236114697984025258) };
+  static const uint64_t e[] =
+    { UINT64_C( 6261117620357779913), UINT64_C( 4211077804672273322), UINT64_C(10078279810465746514), UINT64_C( 3751824406238368947),
+      UINT64_C( 3862746953184650094), UINT64_C( 6425586250813958282), UINT64_C( 5294205453045770200), UINT64_C( 5236611983214655290),
+      UINT64_C( 4425425120318289745), UINT64_C(17126075664917516460), UINT64_C(10916040285724267760), UINT64_C(  814377513218567308),
+      UINT64_C(16033836046497851791), UINT64_C( 1358183305677108597), UINT64_C(14608819085474418344), UINT64_C( 9848979914787526997),
+      UINT64_C(  955995885497961443), UINT64_C( 8038750332231236602), UINT64_C( 1321192066199855803), UINT64_C(11846654681330272545),
+      UINT64_C( 3838818932146968833), UINT64_C( 2062003214053420635), UINT64_C( 1991705667067414260), UINT64_C(10826447573999812900),
+      UINT64_C(18221474404918274381), UINT64_C(12285706937099163955), UINT64_C( 9884828276617765600), UINT64_C(10408813031450063980),
+      UINT64_C(14289020790192913616), UINT64_C(  684700038105253908), UINT64_C( 9069068034534918339), UINT64_C(10883040125702253571),
+      UINT64_C( 3918772103390852429), UINT64_C( 1236114697984025258) };
+
+  static uint64_t r[sizeof(a) / sizeof(a[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t n = 0;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b64(pg, pv));
+    simde_svst1_u64(simde_svwhilelt_b64_s32(0, c), &(r[n]), simde_svcompact_u64(pv, av));
+    n += c;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_i32(HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0])), n);
+  simde_assert_equal_vu64(n, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+  int32_t n = 0;
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b64(pg, pv));
+    simde_svst1_u64(simde_svwhilelt_b64_s32(0, c), &(e[n]), simde_svcompact_u64(pv, av));
+    n += c;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, n), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svcompact_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   878.35), SIMDE_FLOAT32_C(   944.07), SIMDE_FLOAT32_C(   188.28), SIMDE_FLOAT32_C(  -128.31),
+      SIMDE_FLOAT32_C(   573.05), SIMDE_FLOAT32_C(  -159.44), SIMDE_FLOAT32_C(   147.03), SIMDE_FLOAT32_C(  -709.01),
+      SIMDE_FLOAT32_C(  -496.36), SIMDE_FLOAT32_C(  -710.17), SIMDE_FLOAT32_C(  -772.00), SIMDE_FLOAT32_C(  -190.28),
+      SIMDE_FLOAT32_C(  -939.97), SIMDE_FLOAT32_C(  -137.68), SIMDE_FLOAT32_C(   528.09), SIMDE_FLOAT32_C(   717.65),
+      SIMDE_FLOAT32_C(  -900.19), SIMDE_FLOAT32_C(   762.09), SIMDE_FLOAT32_C(  -808.63), SIMDE_FLOAT32_C(   667.87),
+      SIMDE_FLOAT32_C(  -731.82), SIMDE_FLOAT32_C(   289.84), SIMDE_FLOAT32_C(   950.87), SIMDE_FLOAT32_C(   998.60),
+      SIMDE_FLOAT32_C(  -541.14), SIMDE_FLOAT32_C(  -787.39), SIMDE_FLOAT32_C(   -38.31), SIMDE_FLOAT32_C(  -106.12),
+      SIMDE_FLOAT32_C(  -303.22), SIMDE_FLOAT32_C(   357.20), SIMDE_FLOAT32_C(  -868.95), SIMDE_FLOAT32_C(  -424.87),
+      SIMDE_FLOAT32_C(   301.27), SIMDE_FLOAT32_C(   319.34), SIMDE_FLOAT32_C(   446.82), SIMDE_FLOAT32_C(  -125.69),
+      SIMDE_FLOAT32_C(  -840.10), SIMDE_FLOAT32_C(  -406.14), SIMDE_FLOAT32_C(   165.30), SIMDE_FLOAT32_C(  -336.46),
+      SIMDE_FLOAT32_C(  -116.31), SIMDE_FLOAT32_C(   393.30), SIMDE_FLOAT32_C(   473.26), SIMDE_FLOAT32_C(   -56.28),
+      SIMDE_FLOAT32_C(  -744.38), SIMDE_FLOAT32_C(     1.35), SIMDE_FLOAT32_C(  -338.63), SIMDE_FLOAT32_C(  -644.57),
+      SIMDE_FLOAT32_C(  -236.56), SIMDE_FLOAT32_C(  -147.26), SIMDE_FLOAT32_C(  -976.70), SIMDE_FLOAT32_C(    31.61),
+      SIMDE_FLOAT32_C(  -857.41), SIMDE_FLOAT32_C(   974.17), SIMDE_FLOAT32_C(    30.21), SIMDE_FLOAT32_C(  -398.56),
+      SIMDE_FLOAT32_C(  -813.22), SIMDE_FLOAT32_C(   991.90), SIMDE_FLOAT32_C(   495.32), SIMDE_FLOAT32_C(  -116.43),
+      SIMDE_FLOAT32_C(   349.10), SIMDE_FLOAT32_C(   626.38), SIMDE_FLOAT32_C(   458.70), SIMDE_FLOAT32_C(  -349.64),
+      SIMDE_FLOAT32_C(   -54.29), SIMDE_FLOAT32_C(   -94.48), SIMDE_FLOAT32_C(   524.68), SIMDE_FLOAT32_C(   105.61),
+      SIMDE_FLOAT32_C(   499.38), SIMDE_FLOAT32_C(  -310.02), SIMDE_FLOAT32_C(   769.15), SIMDE_FLOAT32_C(  -616.94),
+      SIMDE_FLOAT32_C(  -916.71), SIMDE_FLOAT32_C(   242.41), SIMDE_FLOAT32_C(   326.78), SIMDE_FLOAT32_C(  -661.09),
+      SIMDE_FLOAT32_C(  -756.24), SIMDE_FLOAT32_C(   988.15), SIMDE_FLOAT32_C(  -305.66), SIMDE_FLOAT32_C(     7.20),
+      SIMDE_FLOAT32_C(  -159.10), SIMDE_FLOAT32_C(  -282.36), SIMDE_FLOAT32_C(  -961.19), SIMDE_FLOAT32_C(   -16.52),
+      SIMDE_FLOAT32_C(  -308.19), SIMDE_FLOAT32_C(    69.02), SIMDE_FLOAT32_C(   584.92), SIMDE_FLOAT32_C(  -121.40),
+      SIMDE_FLOAT32_C(    60.92), SIMDE_FLOAT32_C(    80.25), SIMDE_FLOAT32_C(   762.16), SIMDE_FLOAT32_C(  -589.99),
+      SIMDE_FLOAT32_C(  -293.37), SIMDE_FLOAT32_C(   220.86), SIMDE_FLOAT32_C(    60.38), SIMDE_FLOAT32_C(   652.34),
+      SIMDE_FLOAT32_C(  -873.62), SIMDE_FLOAT32_C(  -414.95), SIMDE_FLOAT32_C(  -242.04), SIMDE_FLOAT32_C(   625.75),
+      SIMDE_FLOAT32_C(   275.04), SIMDE_FLOAT32_C(  -472.89), SIMDE_FLOAT32_C(  -991.18), SIMDE_FLOAT32_C(   358.33),
+      SIMDE_FLOAT32_C(   769.51), SIMDE_FLOAT32_C(   335.60), SIMDE_FLOAT32_C(   697.24), SIMDE_FLOAT32_C(  -986.72),
+      SIMDE_FLOAT32_C(   323.75), SIMDE_FLOAT32_C(  -608.42), SIMDE_FLOAT32_C(    20.47), SIMDE_FLOAT32_C(  -835.36),
+      SIMDE_FLOAT32_C(   109.23), SIMDE_FLOAT32_C(    59.28), SIMDE_FLOAT32_C(   148.12), SIMDE_FLOAT32_C(   801.04),
+      SIMDE_FLOAT32_C(  -871.70), SIMDE_FLOAT32_C(  -266.95), SIMDE_FLOAT32_C(  -320.37), SIMDE_FLOAT32_C(   189.22),
+      SIMDE_FLOAT32_C(   813.30), SIMDE_FLOAT32_C(  -558.21), SIMDE_FLOAT32_C(   599.23), SIMDE_FLOAT32_C(  -480.08),
+      SIMDE_FLOAT32_C(   662.65), SIMDE_FLOAT32_C(  -340.39), SIMDE_FLOAT32_C(  -827.74), SIMDE_FLOAT32_C(   789.03),
+      SIMDE_FLOAT32_C(   244.66), SIMDE_FLOAT32_C(   -69.78), SIMDE_FLOAT32_C(   414.78), SIMDE_FLOAT32_C(  -480.30),
+      SIMDE_FLOAT32_C(   457.33), SIMDE_FLOAT32_C(   423.60), SIMDE_FLOAT32_C(   878.03), SIMDE_FLOAT32_C(   226.84),
+      SIMDE_FLOAT32_C(  -240.80), SIMDE_FLOAT32_C(   575.27), SIMDE_FLOAT32_C(   240.12), SIMDE_FLOAT32_C(  -917.06),
+      SIMDE_FLOAT32_C(   966.85), SIMDE_FLOAT32_C(  -739.41), SIMDE_FLOAT32_C(  -752.41), SIMDE_FLOAT32_C(    76.07),
+      SIMDE_FLOAT32_C(   319.87), SIMDE_FLOAT32_C(   395.71), SIMDE_FLOAT32_C(  -122.89), SIMDE_FLOAT32_C(   448.18),
+      SIMDE_FLOAT32_C(  -871.24), SIMDE_FLOAT32_C(   556.74), SIMDE_FLOAT32_C(  -362.60), SIMDE_FLOAT32_C(   942.06),
+      SIMDE_FLOAT32_C(   998.54), SIMDE_FLOAT32_C(  -763.37), SIMDE_FLOAT32_C(  -538.02), SIMDE_FLOAT32_C(   661.19),
+      SIMDE_FLOAT32_C(  -103.76), SIMDE_FLOAT32_C(  -365.76), SIMDE_FLOAT32_C(   450.21), SIMDE_FLOAT32_C(  -859.10),
+      SIMDE_FLOAT32_C(   564.46), SIMDE_FLOAT32_C(  -135.01), SIMDE_FLOAT32_C(  -339.39), SIMDE_FLOAT32_C(    21.79),
+      SIMDE_FLOAT32_C(  -711.41), SIMDE_FLOAT32_C(  -461.36), SIMDE_FLOAT32_C(  -751.37), SIMDE_FLOAT32_C(    47.79),
+      SIMDE_FLOAT32_C(  -886.10), SIMDE_FLOAT32_C(   488.75), SIMDE_FLOAT32_C(   130.73), SIMDE_FLOAT32_C(  -919.25),
+      SIMDE_FLOAT32_C(   749.34), SIMDE_FLOAT32_C(   378.32), SIMDE_FLOAT32_C(   156.82), SIMDE_FLOAT32_C(    69.21),
+      SIMDE_FLOAT32_C(  -225.97), SIMDE_FLOAT32_C(  -966.07), SIMDE_FLOAT32_C(  -482.61), SIMDE_FLOAT32_C(   -97.21),
+      SIMDE_FLOAT32_C(   590.67), SIMDE_FLOAT32_C(   154.78), SIMDE_FLOAT32_C(  -155.15), SIMDE_FLOAT32_C(   589.21),
+      SIMDE_FLOAT32_C(   391.41), SIMDE_FLOAT32_C(   306.83), SIMDE_FLOAT32_C(   250.39), SIMDE_FLOAT32_C(  -712.35),
+      SIMDE_FLOAT32_C(   941.07), SIMDE_FLOAT32_C(  -299.39), SIMDE_FLOAT32_C(  -571.44), SIMDE_FLOAT32_C(   505.54),
+      SIMDE_FLOAT32_C(   565.60), SIMDE_FLOAT32_C(    89.16), SIMDE_FLOAT32_C(  -472.67), SIMDE_FLOAT32_C(   854.20),
+      SIMDE_FLOAT32_C(   627.80), SIMDE_FLOAT32_C(  -224.04), SIMDE_FLOAT32_C(   -98.02), SIMDE_FLOAT32_C(   741.70),
+      SIMDE_FLOAT32_C(  -735.29), SIMDE_FLOAT32_C(  -967.28), SIMDE_FLOAT32_C(   822.45), SIMDE_FLOAT32_C(  -985.95),
+      SIMDE_FLOAT32_C(   411.04), SIMDE_FLOAT32_C(   -20.73), SIMDE_FLOAT32_C(    83.27), SIMDE_FLOAT32_C(  -814.93),
+      SIMDE_FLOAT32_C(    13.20), SIMDE_FLOAT32_C(   600.65), SIMDE_FLOAT32_C(    87.86), SIMDE_FLOAT32_C(  -396.13),
+      SIMDE_FLOAT32_C(  -244.56), SIMDE_FLOAT32_C(   932.71), SIMDE_FLOAT32_C(  -806.93), SIMDE_FLOAT32_C(  -853.15),
+      SIMDE_FLOAT32_C(   239.54) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(   878.35), SIMDE_FLOAT32_C(   944.07), SIMDE_FLOAT32_C(   188.28), SIMDE_FLOAT32_C(  -128.31),
+      SIMDE_FLOAT32_C(   573.05), SIMDE_FLOAT32_C(  -709.01), SIMDE_FLOAT32_C(  -496.36), SIMDE_FLOAT32_C(  -137.68),
+      SIMDE_FLOAT32_C(   528.09), SIMDE_FLOAT32_C(   762.09), SIMDE_FLOAT32_C(  -541.14), SIMDE_FLOAT32_C(   -38.31),
+      SIMDE_FLOAT32_C(  -106.12), SIMDE_FLOAT32_C(  -303.22), SIMDE_FLOAT32_C(  -868.95), SIMDE_FLOAT32_C(  -125.69),
+      SIMDE_FLOAT32_C(  -840.10), SIMDE_FLOAT32_C(   165.30), SIMDE_FLOAT32_C(  -336.46), SIMDE_FLOAT32_C(  -116.31),
+      SIMDE_FLOAT32_C(   393.30), SIMDE_FLOAT32_C(   473.26), SIMDE_FLOAT32_C(  -744.38), SIMDE_FLOAT32_C(     1.35),
+      SIMDE_FLOAT32_C(  -147.26), SIMDE_FLOAT32_C(  -857.41), SIMDE_FLOAT32_C(   974.17), SIMDE_FLOAT32_C(    30.21),
+      SIMDE_FLOAT32_C(  -398.56), SIMDE_FLOAT32_C(  -813.22), SIMDE_FLOAT32_C(   991.90), SIMDE_FLOAT32_C(  -116.43),
+      SIMDE_FLOAT32_C(   626.38), SIMDE_FLOAT32_C(   458.70), SIMDE_FLOAT32_C(  -349.64), SIMDE_FLOAT32_C(   -54.29),
+      SIMDE_FLOAT32_C(   524.68), SIMDE_FLOAT32_C(   105.61), SIMDE_FLOAT32_C(   499.38), SIMDE_FLOAT32_C(  -310.02),
+      SIMDE_FLOAT32_C(   769.15), SIMDE_FLOAT32_C(  -616.94), SIMDE_FLOAT32_C(   326.78), SIMDE_FLOAT32_C(   988.15),
+      SIMDE_FLOAT32_C(     7.20), SIMDE_FLOAT32_C(  -159.10), SIMDE_FLOAT32_C(  -961.19), SIMDE_FLOAT32_C(    69.02),
+      SIMDE_FLOAT32_C(  -121.40), SIMDE_FLOAT32_C(    80.25), SIMDE_FLOAT32_C(   762.16), SIMDE_FLOAT32_C(  -589.99),
+      SIMDE_FLOAT32_C(  -293.37), SIMDE_FLOAT32_C(   220.86), SIMDE_FLOAT32_C(    60.38), SIMDE_FLOAT32_C(  -873.62),
+      SIMDE_FLOAT32_C(  -414.95), SIMDE_FLOAT32_C(  -242.04), SIMDE_FLOAT32_C(   275.04), SIMDE_FLOAT32_C(  -472.89),
+      SIMDE_FLOAT32_C(  -991.18), SIMDE_FLOAT32_C(   769.51), SIMDE_FLOAT32_C(   335.60), SIMDE_FLOAT32_C(  -986.72),
+      SIMDE_FLOAT32_C(   323.75), SIMDE_FLOAT32_C(  -608.42), SIMDE_FLOAT32_C(    20.47), SIMDE_FLOAT32_C(   109.23),
+      SIMDE_FLOAT32_C(   801.04), SIMDE_FLOAT32_C(  -871.70), SIMDE_FLOAT32_C(  -320.37), SIMDE_FLOAT32_C(   189.22),
+      SIMDE_FLOAT32_C(   813.30), SIMDE_FLOAT32_C(  -558.21), SIMDE_FLOAT32_C(   599.23), SIMDE_FLOAT32_C(  -340.39),
+      SIMDE_FLOAT32_C(  -827.74), SIMDE_FLOAT32_C(   244.66), SIMDE_FLOAT32_C(   -69.78), SIMDE_FLOAT32_C(  -480.30),
+      SIMDE_FLOAT32_C(   457.33), SIMDE_FLOAT32_C(   878.03), SIMDE_FLOAT32_C(   226.84), SIMDE_FLOAT32_C(   240.12),
+      SIMDE_FLOAT32_C(  -917.06), SIMDE_FLOAT32_C(   966.85), SIMDE_FLOAT32_C(   319.87), SIMDE_FLOAT32_C(   395.71),
+      SIMDE_FLOAT32_C(   448.18), SIMDE_FLOAT32_C(   556.74), SIMDE_FLOAT32_C(   998.54), SIMDE_FLOAT32_C(  -763.37),
+      SIMDE_FLOAT32_C(  -538.02), SIMDE_FLOAT32_C(  -103.76), SIMDE_FLOAT32_C(   450.21), SIMDE_FLOAT32_C(  -711.41),
+      SIMDE_FLOAT32_C(  -751.37), SIMDE_FLOAT32_C(  -886.10), SIMDE_FLOAT32_C(   488.75), SIMDE_FLOAT32_C(   130.73),
+      SIMDE_FLOAT32_C(  -919.25), SIMDE_FLOAT32_C(  -966.07), SIMDE_FLOAT32_C(   154.78), SIMDE_FLOAT32_C(  -571.44),
+      SIMDE_FLOAT32_C(   565.60), SIMDE_FLOAT32_C(   854.20), SIMDE_FLOAT32_C(   627.80), SIMDE_FLOAT32_C(  -224.04),
+      SIMDE_FLOAT32_C(   741.70), SIMDE_FLOAT32_C(  -967.28), SIMDE_FLOAT32_C(   822.45), SIMDE_FLOAT32_C(    83.27),
+      SIMDE_FLOAT32_C(  -814.93), SIMDE_FLOAT32_C(    13.20), SIMDE_FLOAT32_C(   600.65), SIMDE_FLOAT32_C(    87.86),
+      SIMDE_FLOAT32_C(  -244.56), SIMDE_FLOAT32_C(  -853.15) };
+
+  static simde_float32 r[sizeof(a) / sizeof(a[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t n = 0;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b32(pg, pv));
+    simde_svst1_f32(simde_svwhilelt_b32_s32(0, c), &(r[n]), simde_svcompact_f32(pv, av));
+    n += c;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_i32(HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0])), n);
+  simde_assert_equal_vf32(n, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+  int32_t n = 0;
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b32(pg, pv));
+    simde_svst1_f32(simde_svwhilelt_b32_s32(0, c), &(e[n]), simde_svcompact_f32(pv, av));
+    n += c;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, n), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svcompact_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   379.61), SIMDE_FLOAT64_C(   521.28), SIMDE_FLOAT64_C(  -357.25), SIMDE_FLOAT64_C(  -286.15),
+      SIMDE_FLOAT64_C(   963.92), SIMDE_FLOAT64_C(  -883.88), SIMDE_FLOAT64_C(  -152.55), SIMDE_FLOAT64_C(   671.95),
+      SIMDE_FLOAT64_C(  -141.85), SIMDE_FLOAT64_C(  -518.08), SIMDE_FLOAT64_C(  -287.73), SIMDE_FLOAT64_C(    57.32),
+      SIMDE_FLOAT64_C(  -269.16), SIMDE_FLOAT64_C(  -456.95), SIMDE_FLOAT64_C(  -794.25), SIMDE_FLOAT64_C(   671.58),
+      SIMDE_FLOAT64_C(   188.40), SIMDE_FLOAT64_C(   793.44), SIMDE_FLOAT64_C(   244.80), SIMDE_FLOAT64_C(   101.25),
+      SIMDE_FLOAT64_C(  -424.84), SIMDE_FLOAT64_C(   172.79), SIMDE_FLOAT64_C(   530.23), SIMDE_FLOAT64_C(   -79.49),
+      SIMDE_FLOAT64_C(   509.69), SIMDE_FLOAT64_C(  -372.73), SIMDE_FLOAT64_C(  -255.56), SIMDE_FLOAT64_C(  -488.63),
+      SIMDE_FLOAT64_C(  -431.08), SIMDE_FLOAT64_C(   739.12), SIMDE_FLOAT64_C(   904.73), SIMDE_FLOAT64_C(   948.53),
+      SIMDE_FLOAT64_C(   260.40), SIMDE_FLOAT64_C(  -452.52), SIMDE_FLOAT64_C(  -337.62), SIMDE_FLOAT64_C(   224.32),
+      SIMDE_FLOAT64_C(  -336.40), SIMDE_FLOAT64_C(   509.83), SIMDE_FLOAT64_C(  -103.73), SIMDE_FLOAT64_C(   521.74),
+      SIMDE_FLOAT64_C(   991.75), SIMDE_FLOAT64_C(   608.54), SIMDE_FLOAT64_C(  -420.94), SIMDE_FLOAT64_C(  -277.41),
+      SIMDE_FLOAT64_C(  -848.40), SIMDE_FLOAT64_C(  -215.19), SIMDE_FLOAT64_C(  -605.83), SIMDE_FLOAT64_C(   340.00),
+      SIMDE_FLOAT64_C(  -421.74), SIMDE_FLOAT64_C(   638.98), SIMDE_FLOAT64_C(  -558.75), SIMDE_FLOAT64_C(   153.42),
+      SIMDE_FLOAT64_C(  -188.23), SIMDE_FLOAT64_C(   971.48), SIMDE_FLOAT64_C(  -926.08), SIMDE_FLOAT64_C(  -678.54),
+      SIMDE_FLOAT64_C(  -401.25), SIMDE_FLOAT64_C(  -181.64), SIMDE_FLOAT64_C(  -167.17), SIMDE_FLOAT64_C(   167.67),
+      SIMDE_FLOAT64_C(  -442.52), SIMDE_FLOAT64_C(  -262.44), SIMDE_FLOAT64_C(   116.20), SIMDE_FLOAT64_C(   817.89),
+      SIMDE_FLOAT64_C(   285.03), SIMDE_FLOAT64_C(   778.58), SIMDE_FLOAT64_C(    42.21), SIMDE_FLOAT64_C(   948.63),
+      SIMDE_FLOAT64_C(   288.40), SIMDE_FLOAT64_C(   938.48), SIMDE_FLOAT64_C(   470.37), SIMDE_FLOAT64_C(   280.15),
+      SIMDE_FLOAT64_C(   547.03), SIMDE_FLOAT64_C(  -950.57), SIMDE_FLOAT64_C(  -997.25), SIMDE_FLOAT64_C(   698.62),
+      SIMDE_FLOAT64_C(  -165.75), SIMDE_FLOAT64_C(  -603.08), SIMDE_FLOAT64_C(    38.62), SIMDE_FLOAT64_C(   412.50),
+      SIMDE_FLOAT64_C(  -964.10), SIMDE_FLOAT64_C(   479.87), SIMDE_FLOAT64_C(  -434.08), SIMDE_FLOAT64_C(  -152.33),
+      SIMDE_FLOAT64_C(   451.35), SIMDE_FLOAT64_C(  -360.16), SIMDE_FLOAT64_C(   169.13), SIMDE_FLOAT64_C(  -949.91),
+      SIMDE_FLOAT64_C(   458.21), SIMDE_FLOAT64_C(  -998.05), SIMDE_FLOAT64_C(   217.76), SIMDE_FLOAT64_C(  -984.31),
+      SIMDE_FLOAT64_C(  -260.49), SIMDE_FLOAT64_C(  -666.03), SIMDE_FLOAT64_C(   833.58), SIMDE_FLOAT64_C(  -975.46),
+      SIMDE_FLOAT64_C(  -887.46), SIMDE_FLOAT64_C(  -124.21), SIMDE_FLOAT64_C(   973.17), SIMDE_FLOAT64_C(   400.95),
+      SIMDE_FLOAT64_C(  -185.73), SIMDE_FLOAT64_C(   443.54), SIMDE_FLOAT64_C(  -318.90), SIMDE_FLOAT64_C(  -638.70),
+      SIMDE_FLOAT64_C(   492.97), SIMDE_FLOAT64_C(  -316.15), SIMDE_FLOAT64_C(  -940.08), SIMDE_FLOAT64_C(  -672.78),
+      SIMDE_FLOAT64_C(    80.77), SIMDE_FLOAT64_C(    98.54), SIMDE_FLOAT64_C(   739.72), SIMDE_FLOAT64_C(   116.67),
+      SIMDE_FLOAT64_C(  -421.59), SIMDE_FLOAT64_C(  -694.36), SIMDE_FLOAT64_C(   964.33), SIMDE_FLOAT64_C(  -970.24),
+      SIMDE_FLOAT64_C(   -54.52), SIMDE_FLOAT64_C(   133.46), SIMDE_FLOAT64_C(  -920.15) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(   379.61), SIMDE_FLOAT64_C(   521.28), SIMDE_FLOAT64_C(   963.92), SIMDE_FLOAT64_C(  -152.55),
+      SIMDE_FLOAT64_C(   671.95), SIMDE_FLOAT64_C(  -141.85), SIMDE_FLOAT64_C(  -518.08), SIMDE_FLOAT64_C(  -287.73),
+      SIMDE_FLOAT64_C(    57.32), SIMDE_FLOAT64_C(  -794.25), SIMDE_FLOAT64_C(   188.40), SIMDE_FLOAT64_C(   793.44),
+      SIMDE_FLOAT64_C(   244.80), SIMDE_FLOAT64_C(   -79.49), SIMDE_FLOAT64_C(   509.69), SIMDE_FLOAT64_C(  -255.56),
+      SIMDE_FLOAT64_C(   739.12), SIMDE_FLOAT64_C(   904.73), SIMDE_FLOAT64_C(   948.53), SIMDE_FLOAT64_C(   260.40),
+      SIMDE_FLOAT64_C(   224.32), SIMDE_FLOAT64_C(  -103.73), SIMDE_FLOAT64_C(   608.54), SIMDE_FLOAT64_C(  -420.94),
+      SIMDE_FLOAT64_C(  -277.41), SIMDE_FLOAT64_C(  -215.19), SIMDE_FLOAT64_C(  -605.83), SIMDE_FLOAT64_C(   340.00),
+      SIMDE_FLOAT64_C(   638.98), SIMDE_FLOAT64_C(   153.42), SIMDE_FLOAT64_C(  -188.23), SIMDE_FLOAT64_C(  -401.25),
+      SIMDE_FLOAT64_C(  -442.52), SIMDE_FLOAT64_C(   817.89), SIMDE_FLOAT64_C(   285.03), SIMDE_FLOAT64_C(    42.21),
+      SIMDE_FLOAT64_C(   948.63), SIMDE_FLOAT64_C(  -997.25), SIMDE_FLOAT64_C(  -165.75), SIMDE_FLOAT64_C(  -603.08),
+      SIMDE_FLOAT64_C(    38.62), SIMDE_FLOAT64_C(   412.50), SIMDE_FLOAT64_C(  -964.10), SIMDE_FLOAT64_C(  -434.08),
+      SIMDE_FLOAT64_C(  -152.33), SIMDE_FLOAT64_C(   451.35), SIMDE_FLOAT64_C(   169.13), SIMDE_FLOAT64_C(   458.21),
+      SIMDE_FLOAT64_C(   217.76), SIMDE_FLOAT64_C(  -984.31), SIMDE_FLOAT64_C(  -260.49), SIMDE_FLOAT64_C(  -666.03),
+      SIMDE_FLOAT64_C(  -124.21), SIMDE_FLOAT64_C(   973.17), SIMDE_FLOAT64_C(  -185.73), SIMDE_FLOAT64_C(  -638.70),
+      SIMDE_FLOAT64_C(   492.97), SIMDE_FLOAT64_C(  -316.15), SIMDE_FLOAT64_C(    98.54), SIMDE_FLOAT64_C(   739.72),
+      SIMDE_FLOAT64_C(  -970.24), SIMDE_FLOAT64_C(  -920.15) };
+
+  static simde_float64 r[sizeof(a) / sizeof(a[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t n = 0;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b64(pg, pv));
+    simde_svst1_f64(simde_svwhilelt_b64_s32(0, c), &(r[n]), simde_svcompact_f64(pv, av));
+    n += c;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_i32(HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0])), n);
+  simde_assert_equal_vf64(n, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+  int32_t n = 0;
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    int32_t c = HEDLEY_STATIC_CAST(int32_t, simde_svcntp_b64(pg, pv));
+    simde_svst1_f64(simde_svwhilelt_b64_s32(0, c), &(e[n]), simde_svcompact_f64(pv, av));
+    n += c;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, n), e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svcompact_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svcompact_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svcompact_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svcompact_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svcompact_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svcompact_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
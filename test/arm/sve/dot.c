@@ -0,0 +1,1742 @@
+#define SIMDE_TEST_ARM_SVE_INSN dot
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/dot.h"
+
+static int
+test_simde_svdot_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t a[] =
+    {  INT32_C(   545517363), -INT32_C(   616977953),  INT32_C(  1812514320),  INT32_C(  1113169722), -INT32_C(   942545226), -INT32_C(  1422094906), -INT32_C(   838647152),  INT32_C(   524786155),
+       INT32_C(  1732233864), -INT32_C(  2076018572),  INT32_C(  2029013822), -INT32_C(  1598403862), -INT32_C(   160986320), -INT32_C(  1465736168), -INT32_C(   780687898), -INT32_C(   957301186),
+      -INT32_C(    64082040), -INT32_C(   444501849), -INT32_C(  1520602693), -INT32_C(   331016261), -INT32_C(  1142772317),  INT32_C(   929334353),  INT32_C(  1745410858),  INT32_C(   556792217),
+      -INT32_C(   803316440), -INT32_C(  1984585779), -INT32_C(   869395696), -INT32_C(   843549654),  INT32_C(  1921620513),  INT32_C(  1235873055),  INT32_C(  1639035336), -INT32_C(   746397526),
+       INT32_C(   195272765),  INT32_C(  1351899199), -INT32_C(  1776500117),  INT32_C(  1466160182), -INT32_C(  1916146578), -INT32_C(  1579781415), -INT32_C(   838694876), -INT32_C(  1499363992),
+       INT32_C(  1706116133),  INT32_C(   146097565),  INT32_C(  1050595591),  INT32_C(   328532645), -INT32_C(   928948242), -INT32_C(   177637423),  INT32_C(  1757703423),  INT32_C(   370042353),
+       INT32_C(  1199292330),  INT32_C(   189739012), -INT32_C(  1505104383), -INT32_C(   558178320),  INT32_C(   262560574), -INT32_C(   771419950),  INT32_C(  1832569212), -INT32_C(   662484946),
+       INT32_C(   186646279),  INT32_C(   823553839),  INT32_C(  1305960541),  INT32_C(  2100007231), -INT32_C(  1081290004),  INT32_C(  1586598370), -INT32_C(  1983132838),  INT32_C(   442584595),
+       INT32_C(  2099609933),  INT32_C(  1303264240), -INT32_C(   627407461),  INT32_C(    56083735),  INT32_C(  2042815639), -INT32_C(   791194763),  INT32_C(   827957790),  INT32_C(  1045150449),
+       INT32_C(   733704251),  INT32_C(  1199073708),  INT32_C(   102896367),  INT32_C(  1862891992), -INT32_C(   739652515),  INT32_C(  1050918943),  INT32_C(  1416625251), -INT32_C(   225264714),
+      -INT32_C(   685945301), -INT32_C(  1507879241), -INT32_C(  2136194648),  INT32_C(   418428602), -INT32_C(  1578378878), -INT32_C(    52457831),  INT32_C(  1079005066),  INT32_C(   892527370),
+      -INT32_C(   401780687), -INT32_C(  1903219482),  INT32_C(   655309677),  INT32_C(  1933574129),  INT32_C(  1897212632),  INT32_C(  1114567864),  INT32_C(  1300479555), -INT32_C(   763120223),
+      -INT32_C(   340029435),  INT32_C(   695880380),  INT32_C(  2001766789),  INT32_C(  1625985160),  INT32_C(  1943142330),  INT32_C(   934625268), -INT32_C(  1618659074), -INT32_C(   210630418),
+       INT32_C(  1423912344), -INT32_C(    58893961),  INT32_C(  1785974242),  INT32_C(   415915613),  INT32_C(  1368103773), -INT32_C(   645316389),  INT32_C(  1735921273), -INT32_C(  1369773546),
+      -INT32_C(  1912456937),  INT32_C(  1955299218), -INT32_C(  1428226484), -INT32_C(  1161648036),  INT32_C(   520834372),  INT32_C(   116954253), -INT32_C(  1200787294),  INT32_C(  1919338587),
+      -INT32_C(  1811847167),  INT32_C(   872975591), -INT32_C(   404822134), -INT32_C(   744382321),  INT32_C(  2062724333), -INT32_C(   478025151), -INT32_C(  1231229349), -INT32_C(  1205337418),
+       INT32_C(  1380723051),  INT32_C(  1082545333), -INT32_C(   886610885), -INT32_C(   241252348), -INT32_C(  1251176076), -INT32_C(   694555269), -INT32_C(  1836304933), -INT32_C(  1572162249),
+      -INT32_C(  1795844386),  INT32_C(   651459562), -INT32_C(   453903392),  INT32_C(   936808387), -INT32_C(  1662172640),  INT32_C(   175277615), -INT32_C(   224591941), -INT32_C(  1835669836),
+       INT32_C(  1730579068), -INT32_C(   443680251), -INT32_C(  1194688779),  INT32_C(   787521549),  INT32_C(   298507746),  INT32_C(   505101411), -INT32_C(   284116933),  INT32_C(   461546910),
+       INT32_C(   897755183), -INT32_C(  1743122525), -INT32_C(  1705909107),  INT32_C(  1724400004), -INT32_C(  2122870242),  INT32_C(   178230223), -INT32_C(   369447093), -INT32_C(  2080080811),
+      -INT32_C(   944142812),  INT32_C(   576771221),  INT32_C(  1035841976),  INT32_C(   279152114), -INT32_C(   409920744), -INT32_C(   101633874),  INT32_C(   887286751), -INT32_C(  1933973657),
+       INT32_C(    55800429), -INT32_C(    14306490),  INT32_C(  1446830692), -INT32_C(  2140741784), -INT32_C(  1469581318),  INT32_C(   128014375), -INT32_C(  1422162876), -INT32_C(   667421589),
+      -INT32_C(  1378120857), -INT32_C(  1549008578),  INT32_C(  1274669283), -INT32_C(  1026858808),  INT32_C(  2137731671), -INT32_C(   813298549), -INT32_C(    75841136),  INT32_C(   500478646),
+       INT32_C(  2076880701), -INT32_C(  1809942608),  INT32_C(   668932191), -INT32_C(   806704264),  INT32_C(  1749964253), -INT32_C(   231222175) };
+  static const int8_t b[] =
+    {  INT8_C(  76),  INT8_C(   2),  INT8_C(  72), -INT8_C(  32), -INT8_C(  35),  INT8_C( 102), -INT8_C(  91),  INT8_C(  90),
+      -INT8_C( 124),  INT8_C(  82), -INT8_C(  35), -INT8_C(  29),  INT8_C(   2), -INT8_C(   5), -INT8_C(  51),  INT8_C(   6),
+       INT8_C(  31),  INT8_C( 118), -INT8_C( 117), -INT8_C( 120),  INT8_C(  73),  INT8_C(  34),  INT8_C(  55), -INT8_C(  29),
+      -INT8_C(  95),  INT8_C(  31),  INT8_C(  31), -INT8_C( 101), -INT8_C( 120),  INT8_C(  50), -INT8_C(  84), -INT8_C(  44),
+       INT8_C(  52), -INT8_C(  12), -INT8_C(  76),  INT8_C(  17),  INT8_C(  90),  INT8_C(  89),  INT8_C( 107), -INT8_C(  34),
+      -INT8_C(  84),  INT8_C(  73), -INT8_C(  63), -INT8_C(  82),  INT8_C(  68), -INT8_C( 114), -INT8_C(  76),  INT8_C(  99),
+       INT8_C(   5),  INT8_C(  64), -INT8_C(  21),  INT8_C(  78),  INT8_C(  98),  INT8_C(  34),  INT8_C(  49),  INT8_C(   4),
+       INT8_C(  65),  INT8_C(  80), -INT8_C(  97), -INT8_C(  55), -INT8_C( 126),  INT8_C(  76), -INT8_C(  98), -INT8_C(  74),
+       INT8_C(  64),  INT8_C(  82), -INT8_C(  57), -INT8_C( 101), -INT8_C(  84),  INT8_C(  51),  INT8_C( 121),  INT8_C(  88),
+       INT8_C( 124),  INT8_C(  59),  INT8_C(   6), -INT8_C(  64), -INT8_C(  55), -INT8_C(  70),  INT8_C(  35), -INT8_C(  50),
+      -INT8_C(   6),  INT8_C(  15),  INT8_C(  28),  INT8_C(  93),  INT8_C(  49),  INT8_C(  77),  INT8_C(  97),  INT8_C( 115),
+      -INT8_C(  98),  INT8_C(   0),  INT8_C(  60),  INT8_C(  32),  INT8_C(  76), -INT8_C(  38), -INT8_C(  41), -INT8_C( 115),
+       INT8_C(  45), -INT8_C(  98),  INT8_C(  40), -INT8_C(  39), -INT8_C(  47), -INT8_C(  95),  INT8_C(  49),  INT8_C(  77),
+      -INT8_C(  36),  INT8_C(  55),  INT8_C(  13), -INT8_C(  90), -INT8_C(  15),  INT8_C(  49),  INT8_C( 116), -INT8_C(  20),
+       INT8_C(  64), -INT8_C( 111),  INT8_C(  73),  INT8_C( 113), -INT8_C(  34), -INT8_C(  86), -INT8_C(  28),  INT8_C( 124),
+      -INT8_C(  86),  INT8_C(  33), -INT8_C(  99), -INT8_C(   9), -INT8_C(   5),  INT8_C( 116), -INT8_C( 124),  INT8_C(  40),
+       INT8_C(  18), -INT8_C(  84),  INT8_C(   1), -INT8_C(  28),  INT8_C(  77),  INT8_C(  50),  INT8_C(  49),  INT8_C(  42),
+       INT8_C( 105),  INT8_C(  63), -INT8_C(  48),  INT8_C(  91),  INT8_C( 112),  INT8_C(  68),  INT8_C(  71), -INT8_C(  80),
+      -INT8_C(  43), -INT8_C( 112),  INT8_C(  33), -INT8_C(  76),  INT8_C(  58),  INT8_C(   6),  INT8_C(  48), -INT8_C(  28),
+       INT8_C(  39), -INT8_C(  51), -INT8_C(  37),  INT8_C(  34),  INT8_C(  65),  INT8_C(  95),  INT8_C(  75),  INT8_C(  84),
+       INT8_C(  11),  INT8_C(  76),  INT8_C(  56),  INT8_C(  89),      INT8_MAX,  INT8_C( 105), -INT8_C( 125), -INT8_C(  24),
+      -INT8_C(  88),  INT8_C(  83),  INT8_C(  67),  INT8_C(  24), -INT8_C( 105), -INT8_C( 118), -INT8_C(  56),  INT8_C( 109),
+       INT8_C(  26), -INT8_C(  22),  INT8_C(  33),  INT8_C(  84), -INT8_C(  16),  INT8_C(  81),  INT8_C(  57),  INT8_C(  23),
+       INT8_C(  31),  INT8_C(  20),  INT8_C(  57),  INT8_C(  96),  INT8_C( 116), -INT8_C( 124), -INT8_C(  76),      INT8_MAX,
+      -INT8_C(  47), -INT8_C(  20), -INT8_C(  40),  INT8_C(  80),  INT8_C(  86),  INT8_C(  91),  INT8_C(  56), -INT8_C(   2),
+      -INT8_C(  82),  INT8_C( 124),  INT8_C(  23),  INT8_C(  70),  INT8_C(   6), -INT8_C(  33), -INT8_C(  77),  INT8_C(  33),
+      -INT8_C(  55), -INT8_C(  44),  INT8_C( 117), -INT8_C(  71),  INT8_C(  37), -INT8_C(  82), -INT8_C(  48),  INT8_C(  68),
+      -INT8_C(  61),  INT8_C(  10), -INT8_C(  91),  INT8_C(  55), -INT8_C( 114),  INT8_C(  89), -INT8_C(  74),  INT8_C(  95),
+       INT8_C(  70), -INT8_C( 113), -INT8_C(  81), -INT8_C( 100), -INT8_C(  22), -INT8_C(  24), -INT8_C( 102), -INT8_C( 103),
+       INT8_C( 100), -INT8_C(  79), -INT8_C(  33),  INT8_C( 106), -INT8_C( 111), -INT8_C( 110), -INT8_C( 117),  INT8_C(  90),
+       INT8_C( 102),  INT8_C(   1),  INT8_C(  20), -INT8_C( 117), -INT8_C(  81), -INT8_C(  28), -INT8_C(  48),  INT8_C( 114),
+      -INT8_C(  18),  INT8_C( 117), -INT8_C(  87),  INT8_C( 125), -INT8_C(  50),  INT8_C(  96), -INT8_C(  36),  INT8_C(  20),
+      -INT8_C(  17), -INT8_C( 116), -INT8_C(  80), -INT8_C(  39),  INT8_C( 116),  INT8_C(  75),  INT8_C( 114), -INT8_C(  40),
+      -INT8_C(   4),  INT8_C(  81),  INT8_C(  66), -INT8_C( 115), -INT8_C(  29), -INT8_C(  50), -INT8_C(  24),  INT8_C(  73),
+      -INT8_C(  49), -INT8_C(   4), -INT8_C(  43),  INT8_C( 126), -INT8_C(  32), -INT8_C(  91), -INT8_C(  15), -INT8_C(  49),
+       INT8_C(  26), -INT8_C( 102),  INT8_C(  76), -INT8_C(  24), -INT8_C(   6),  INT8_C(  40), -INT8_C(   3), -INT8_C(  23),
+      -INT8_C(  76), -INT8_C(  83), -INT8_C(  61),  INT8_C(  40), -INT8_C(   8),  INT8_C(  53),  INT8_C(   0), -INT8_C(  11),
+      -INT8_C( 121),  INT8_C(  67), -INT8_C( 126),  INT8_C( 106),  INT8_C(  17),  INT8_C( 106), -INT8_C(  76), -INT8_C(  32),
+       INT8_C( 102), -INT8_C( 119),  INT8_C(  94),  INT8_C(  71),  INT8_C(  46),  INT8_C(  79),  INT8_C(  22),  INT8_C(  72),
+      -INT8_C(  22),  INT8_C(  98),  INT8_C(  48), -INT8_C(  28), -INT8_C( 118),  INT8_C(  45), -INT8_C(  50),  INT8_C(  63),
+      -INT8_C(  37), -INT8_C( 111),  INT8_C( 103), -INT8_C(  45), -INT8_C(  58),  INT8_C( 104), -INT8_C(  56),  INT8_C(  77),
+      -INT8_C(  85),  INT8_C(  75), -INT8_C(  72), -INT8_C(  68), -INT8_C(  75),  INT8_C( 108), -INT8_C( 100),  INT8_C(  28),
+      -INT8_C(  11), -INT8_C(   6),  INT8_C(  99),  INT8_C(  35),  INT8_C(  74),  INT8_C( 121),  INT8_C( 107),  INT8_C(  52),
+      -INT8_C(  37), -INT8_C( 101),  INT8_C(  24),  INT8_C( 101), -INT8_C(  55), -INT8_C(  26), -INT8_C(  92), -INT8_C(  92),
+       INT8_C( 119),  INT8_C(  12),  INT8_C( 119),  INT8_C(  62),  INT8_C( 116),  INT8_C(  64), -INT8_C( 117),  INT8_C(  31),
+      -INT8_C( 117),  INT8_C(  67), -INT8_C(  37),  INT8_C(  64), -INT8_C(  81),  INT8_C( 119),  INT8_C(  92), -INT8_C(  92),
+       INT8_C( 113), -INT8_C(  65), -INT8_C(  57), -INT8_C(  69),  INT8_C(  56),  INT8_C(  50), -INT8_C(  17),  INT8_C(  19),
+      -INT8_C(  50),  INT8_C(   8),  INT8_C( 121), -INT8_C( 105), -INT8_C(  18),  INT8_C(  29),  INT8_C(  59),  INT8_C( 102),
+       INT8_C(  41), -INT8_C(  78), -INT8_C(  92), -INT8_C(  99), -INT8_C(  14),  INT8_C(  47), -INT8_C(  68),  INT8_C( 125),
+       INT8_C( 115), -INT8_C( 105), -INT8_C(  66),  INT8_C(  34),  INT8_C(  14),  INT8_C(  26), -INT8_C(  57),      INT8_MIN,
+      -INT8_C(  38), -INT8_C( 114),  INT8_C(  59),  INT8_C(  18), -INT8_C(  63),  INT8_C(  43),  INT8_C(  38), -INT8_C( 113),
+       INT8_C(  51), -INT8_C(  97),  INT8_C(  38),  INT8_C(  33), -INT8_C(  68),  INT8_C(  97), -INT8_C( 121), -INT8_C(  26),
+       INT8_C(  19),  INT8_C(  43), -INT8_C( 125),  INT8_C(   6),  INT8_C(  91),  INT8_C(  64), -INT8_C( 125), -INT8_C(  50),
+      -INT8_C(  41),  INT8_C(  65), -INT8_C(  16), -INT8_C(  26),  INT8_C(  92), -INT8_C(  73),  INT8_C( 102),  INT8_C(  54),
+       INT8_C(  70), -INT8_C(  95),  INT8_C(  72),  INT8_C(   7), -INT8_C(  52),  INT8_C( 110), -INT8_C( 106), -INT8_C(   1),
+       INT8_C(  13), -INT8_C(  68),  INT8_C(  33), -INT8_C(  54),  INT8_C(  29), -INT8_C(  88), -INT8_C(  80),  INT8_C(  48),
+      -INT8_C(  44),  INT8_C(  51),  INT8_C(  54),  INT8_C(  47),  INT8_C( 115), -INT8_C(  70), -INT8_C(   3),  INT8_C(  75),
+      -INT8_C(   5), -INT8_C(  19),  INT8_C(  49),  INT8_C(  87), -INT8_C(  91), -INT8_C( 105), -INT8_C( 115), -INT8_C(  21),
+       INT8_C(  56), -INT8_C(  42), -INT8_C(  14),  INT8_C(   5),  INT8_C(  68), -INT8_C( 120),  INT8_C(   4),  INT8_C(  82),
+       INT8_C(  68),  INT8_C(  37),  INT8_C(  28),  INT8_C(  97), -INT8_C(  50), -INT8_C(  52), -INT8_C( 111), -INT8_C(  94),
+      -INT8_C(   1), -INT8_C(  56), -INT8_C(  47),  INT8_C( 115), -INT8_C( 126), -INT8_C(  50), -INT8_C(  66),  INT8_C( 125),
+      -INT8_C(  69), -INT8_C(  17), -INT8_C(  43),  INT8_C(  96), -INT8_C( 122),  INT8_C(  98),  INT8_C(  75), -INT8_C(  66),
+       INT8_C(  56),  INT8_C(  61), -INT8_C(  61),  INT8_C( 125), -INT8_C(  59), -INT8_C(  56), -INT8_C(  49),  INT8_C(   9),
+      -INT8_C(  19), -INT8_C(  21),  INT8_C( 106), -INT8_C(  69), -INT8_C(  73), -INT8_C(   4),  INT8_C(  93), -INT8_C(  74),
+      -INT8_C(  60),  INT8_C(  46),  INT8_C(  41),  INT8_C(  70), -INT8_C(   4), -INT8_C(  25), -INT8_C(  61), -INT8_C(  72),
+      -INT8_C(  42), -INT8_C( 104),  INT8_C(  24),  INT8_C(  92), -INT8_C(   5),  INT8_C( 100),  INT8_C(  27),  INT8_C(  51),
+      -INT8_C(  95), -INT8_C(  34), -INT8_C(  80),  INT8_C( 103), -INT8_C(  90),      INT8_MAX,  INT8_C( 112), -INT8_C( 108),
+       INT8_C( 106), -INT8_C(  37),  INT8_C(  79),  INT8_C(  33), -INT8_C(  41), -INT8_C(  83), -INT8_C(  40), -INT8_C( 101),
+      -INT8_C(  37),  INT8_C(   1), -INT8_C(  31), -INT8_C(  40), -INT8_C(  23), -INT8_C(  92), -INT8_C( 112), -INT8_C(  65),
+       INT8_C(  61), -INT8_C(  88),  INT8_C(  28),  INT8_C(  56),  INT8_C(  12),  INT8_C(  55),  INT8_C( 107), -INT8_C(  82),
+       INT8_C(  21),  INT8_C(  28),  INT8_C(  21), -INT8_C(  68), -INT8_C( 101), -INT8_C( 123),  INT8_C(  80),  INT8_C(   6),
+       INT8_C(  96), -INT8_C(  97),  INT8_C(  39),  INT8_C(  55),  INT8_C(  76), -INT8_C(   1), -INT8_C(  46),  INT8_C(  40),
+       INT8_C(   1), -INT8_C(  77),  INT8_C(   0), -INT8_C(  22),  INT8_C(  88), -INT8_C( 112), -INT8_C(  87), -INT8_C( 107),
+       INT8_C(  56), -INT8_C(  59), -INT8_C(  51),  INT8_C(  69), -INT8_C(   4),  INT8_C(  56), -INT8_C(  13),  INT8_C(  18),
+       INT8_C(  84),  INT8_C(   8), -INT8_C(  50), -INT8_C(  16), -INT8_C( 115),  INT8_C(  30), -INT8_C(  10), -INT8_C(  18),
+      -INT8_C(  67),  INT8_C(  29),  INT8_C(  37),  INT8_C(  10),  INT8_C(  29), -INT8_C(   8),  INT8_C(  50),  INT8_C(  30),
+      -INT8_C(  85),  INT8_C(  50),  INT8_C(   8),  INT8_C(   3), -INT8_C(  62), -INT8_C(  79), -INT8_C( 104), -INT8_C(   6),
+       INT8_C( 119),  INT8_C( 101),  INT8_C(  63),  INT8_C( 115), -INT8_C(  98),  INT8_C(  50), -INT8_C( 123), -INT8_C(  14),
+       INT8_C(  58),  INT8_C(  83), -INT8_C(  30), -INT8_C(  56),  INT8_C( 113), -INT8_C(  40), -INT8_C(  74),  INT8_C(  47),
+      -INT8_C(  10), -INT8_C(  37),  INT8_C(  57),  INT8_C(  19), -INT8_C(  45),  INT8_C( 107),  INT8_C(  49),      INT8_MAX,
+      -INT8_C(  99),  INT8_C(  57), -INT8_C( 126),  INT8_C(  95), -INT8_C(  22),  INT8_C(  27),  INT8_C(  89),  INT8_C(  97),
+           INT8_MIN, -INT8_C( 103), -INT8_C(  43),  INT8_C(  30), -INT8_C(  53),  INT8_C(  90),  INT8_C(  17),  INT8_C(   6),
+      -INT8_C(  82), -INT8_C(  13), -INT8_C(  50),  INT8_C(  31), -INT8_C(  52), -INT8_C( 124),  INT8_C(  78), -INT8_C(  62),
+       INT8_C(  95), -INT8_C( 121), -INT8_C(  43),  INT8_C(  51), -INT8_C(  14),  INT8_C(   6), -INT8_C(  78), -INT8_C( 113),
+       INT8_C(  63),  INT8_C(  52), -INT8_C(  18),  INT8_C(  41),  INT8_C(  79),  INT8_C(  72), -INT8_C( 117), -INT8_C(  48),
+      -INT8_C(  31),  INT8_C(  96), -INT8_C(  18), -INT8_C(  84), -INT8_C(  70), -INT8_C(   1), -INT8_C(  78),  INT8_C( 104),
+      -INT8_C(  13),      INT8_MIN, -INT8_C( 120), -INT8_C(  65),  INT8_C(   4), -INT8_C(  42), -INT8_C( 127),  INT8_C( 100),
+       INT8_C(  94),  INT8_C(  86), -INT8_C( 105),  INT8_C(  80),  INT8_C(  92),  INT8_C(  73), -INT8_C(  32), -INT8_C( 101),
+       INT8_C( 125), -INT8_C(  50), -INT8_C(  60), -INT8_C(  51),  INT8_C(  22),  INT8_C(  79), -INT8_C(  99), -INT8_C(   9),
+      -INT8_C(  81), -INT8_C( 117), -INT8_C(  92),  INT8_C( 106), -INT8_C( 117),  INT8_C(  86), -INT8_C(  46),  INT8_C( 126),
+      -INT8_C(  41),  INT8_C(  90),  INT8_C(  61), -INT8_C(  37),  INT8_C(  49), -INT8_C(  66),  INT8_C(  63), -INT8_C( 113),
+       INT8_C(  20), -INT8_C(  42), -INT8_C(  33),  INT8_C( 112),  INT8_C(  31), -INT8_C(  65),  INT8_C(  11), -INT8_C(  99),
+      -INT8_C( 114), -INT8_C(  49),  INT8_C( 106), -INT8_C(  92),  INT8_C(  31),  INT8_C(   7), -INT8_C( 100), -INT8_C(  50),
+      -INT8_C( 110),  INT8_C(  64),  INT8_C(  56),  INT8_C(  29), -INT8_C( 106),  INT8_C(  11), -INT8_C( 101),  INT8_C( 109),
+       INT8_C( 101), -INT8_C(  40),  INT8_C(  73), -INT8_C( 106), -INT8_C( 106), -INT8_C( 120),  INT8_C(  37), -INT8_C(  86) };
+  static const int8_t c[] =
+    { -INT8_C(  50), -INT8_C(  62),  INT8_C(   0), -INT8_C(   3),      INT8_MAX,  INT8_C(  74), -INT8_C(  54),  INT8_C(  57),
+      -INT8_C(  57),  INT8_C(  47),  INT8_C( 111),  INT8_C(  18),  INT8_C( 108), -INT8_C(  38),  INT8_C(  26), -INT8_C(  23),
+      -INT8_C(  31),  INT8_C(  66),  INT8_C( 112), -INT8_C(  62),  INT8_C(  71), -INT8_C(  73), -INT8_C( 117),  INT8_C(  42),
+       INT8_C(  97),  INT8_C(  81), -INT8_C( 123),  INT8_C(  63), -INT8_C(   3), -INT8_C(  38), -INT8_C( 127), -INT8_C(  53),
+      -INT8_C( 100), -INT8_C( 127), -INT8_C(  55),  INT8_C(  27), -INT8_C(  53), -INT8_C( 109),  INT8_C(  84), -INT8_C( 110),
+      -INT8_C(  62), -INT8_C(  61), -INT8_C(  92),  INT8_C(  46), -INT8_C(  99), -INT8_C(  66),  INT8_C(  24),      INT8_MAX,
+       INT8_C(   1), -INT8_C( 120),  INT8_C(  65),  INT8_C(  72),  INT8_C(  64), -INT8_C(  52),  INT8_C( 115), -INT8_C(  95),
+       INT8_C(  29), -INT8_C(   8), -INT8_C(  32),  INT8_C(  27), -INT8_C(  46),  INT8_C(  97), -INT8_C(  26),  INT8_C( 110),
+      -INT8_C(  30), -INT8_C(  81), -INT8_C( 119), -INT8_C(  83),  INT8_C(  67), -INT8_C(  35),  INT8_C(  63),  INT8_C(   5),
+      -INT8_C(  96), -INT8_C(  29),  INT8_C(  52),  INT8_C(  62), -INT8_C(  95),  INT8_C(  76), -INT8_C(  67), -INT8_C(  94),
+      -INT8_C(  44), -INT8_C(   2), -INT8_C(  21),  INT8_C(  20), -INT8_C(  54),  INT8_C(  94), -INT8_C(  75), -INT8_C(  25),
+       INT8_C(  86), -INT8_C( 107),  INT8_C(   2),  INT8_C(  41), -INT8_C(  10), -INT8_C(  23), -INT8_C( 105), -INT8_C(  40),
+      -INT8_C( 104),  INT8_C(  33), -INT8_C( 123), -INT8_C(  37), -INT8_C(   2), -INT8_C(  60), -INT8_C(  31), -INT8_C(  97),
+      -INT8_C(  89),  INT8_C(  21), -INT8_C(  35),  INT8_C(  73),  INT8_C(  97), -INT8_C( 102), -INT8_C(  21),  INT8_C(  53),
+      -INT8_C( 104), -INT8_C(  42),  INT8_C(  74),  INT8_C(  98),  INT8_C(  52), -INT8_C(   1),  INT8_C(  73), -INT8_C( 117),
+      -INT8_C( 107),  INT8_C(  76), -INT8_C(  76), -INT8_C( 117),  INT8_C(  53),  INT8_C(  75),  INT8_C( 100), -INT8_C(  51),
+       INT8_C( 108), -INT8_C(  23), -INT8_C(  87),  INT8_C( 107), -INT8_C(  82), -INT8_C( 118),  INT8_C(  10),  INT8_C(  85),
+      -INT8_C(  97), -INT8_C(  25), -INT8_C(  98),  INT8_C(   0), -INT8_C( 127), -INT8_C( 118),  INT8_C(  53),  INT8_C(  25),
+       INT8_C(  96),      INT8_MAX,  INT8_C( 123), -INT8_C( 107),      INT8_MAX, -INT8_C(  60),  INT8_C(  32),  INT8_C(  20),
+       INT8_C(  16), -INT8_C(  44), -INT8_C(  97),  INT8_C(  69),  INT8_C(  31),  INT8_C(   3),  INT8_C(  19), -INT8_C( 116),
+      -INT8_C(  19), -INT8_C(  68), -INT8_C(   9), -INT8_C( 101),  INT8_C(  70),  INT8_C(   1), -INT8_C(  16), -INT8_C(  27),
+      -INT8_C(  24), -INT8_C( 113), -INT8_C(  27),  INT8_C( 105),  INT8_C(  25),  INT8_C(  26), -INT8_C( 126),  INT8_C( 121),
+      -INT8_C( 102), -INT8_C(   3),  INT8_C(  14),  INT8_C(  25), -INT8_C(  63),  INT8_C(  46),  INT8_C(  45), -INT8_C(  46),
+       INT8_C(   2), -INT8_C(  52),  INT8_C(  23),  INT8_C(  34), -INT8_C(  48),  INT8_C(  42), -INT8_C(  82), -INT8_C(  67),
+      -INT8_C(  26), -INT8_C(  91),  INT8_C(  88),  INT8_C(  44), -INT8_C(  90),  INT8_C(  72),  INT8_C(  17), -INT8_C( 114),
+      -INT8_C(  41), -INT8_C(  10), -INT8_C(   9), -INT8_C(  16),  INT8_C(  17),  INT8_C( 121),  INT8_C( 106), -INT8_C(  85),
+       INT8_C( 118),  INT8_C( 120), -INT8_C(  60),  INT8_C(  55), -INT8_C(  89), -INT8_C(  15),  INT8_C(   9), -INT8_C(  87),
+      -INT8_C(  67),  INT8_C(  33), -INT8_C(  53), -INT8_C( 115),  INT8_C(  75),  INT8_C( 121),  INT8_C(  74),  INT8_C(  50),
+       INT8_C(  30), -INT8_C(  94),  INT8_C(  94), -INT8_C(  60), -INT8_C(  21),  INT8_C( 112),  INT8_C(  82), -INT8_C(  62),
+       INT8_C( 102),  INT8_C(  73), -INT8_C(  77),  INT8_C( 119), -INT8_C(  62),  INT8_C(  29),  INT8_C(  34),  INT8_C(  56),
+      -INT8_C( 107), -INT8_C(  26),  INT8_C( 112),  INT8_C(  60), -INT8_C(  41),  INT8_C( 121), -INT8_C(  26), -INT8_C( 107),
+      -INT8_C( 102), -INT8_C(  79),  INT8_C(  34), -INT8_C(  26),  INT8_C(  43),  INT8_C( 109),  INT8_C(  24),  INT8_C(  73),
+       INT8_C(  15),  INT8_C( 118),  INT8_C(  14), -INT8_C(   6), -INT8_C(  26),  INT8_C(  96), -INT8_C(  67),  INT8_C(  77),
+      -INT8_C(  86),  INT8_C( 112), -INT8_C(  60),  INT8_C( 108), -INT8_C( 115), -INT8_C(  25), -INT8_C(  91),  INT8_C(  34),
+      -INT8_C(  51),  INT8_C(  21),  INT8_C(  95), -INT8_C(  91), -INT8_C( 114),  INT8_C(  69),  INT8_C(  58),  INT8_C(  41),
+      -INT8_C(  10),  INT8_C(  92),  INT8_C(  15),  INT8_C(  33), -INT8_C(  55),  INT8_C(  39),  INT8_C( 107), -INT8_C(  39),
+      -INT8_C(  99),  INT8_C( 121), -INT8_C(  45), -INT8_C( 124), -INT8_C(  39), -INT8_C( 112), -INT8_C(  47), -INT8_C( 125),
+       INT8_C(   0), -INT8_C( 107), -INT8_C(  16), -INT8_C( 115),  INT8_C( 124), -INT8_C( 107), -INT8_C(  80),  INT8_C(  74),
+      -INT8_C(  86),  INT8_C(  15), -INT8_C(  17),  INT8_C(  56),  INT8_C(  84),  INT8_C(  41),  INT8_C(  97),  INT8_C(  74),
+      -INT8_C( 123),  INT8_C( 112),  INT8_C( 108),  INT8_C(  79), -INT8_C( 105), -INT8_C(  41),  INT8_C(  40),  INT8_C(  53),
+       INT8_C(  80), -INT8_C(   5), -INT8_C(  71),  INT8_C(  41), -INT8_C( 116), -INT8_C( 118), -INT8_C(  83), -INT8_C( 116),
+       INT8_C(  31), -INT8_C(  99),  INT8_C(  26), -INT8_C( 100),  INT8_C(  50), -INT8_C(  54), -INT8_C(  26), -INT8_C(  36),
+      -INT8_C(  39), -INT8_C(  43),  INT8_C(  20),  INT8_C(  45), -INT8_C(   2),  INT8_C( 118),  INT8_C( 119), -INT8_C( 125),
+      -INT8_C(  26), -INT8_C(  29), -INT8_C(  46),  INT8_C( 126), -INT8_C(  70), -INT8_C(   6), -INT8_C(  77),  INT8_C(  10),
+      -INT8_C(  10),  INT8_C( 108),  INT8_C(  52), -INT8_C( 126), -INT8_C(  10), -INT8_C(  31),  INT8_C(  14),  INT8_C(  21),
+       INT8_C( 126),  INT8_C(  40), -INT8_C(  79), -INT8_C(  80), -INT8_C(  14), -INT8_C( 105), -INT8_C( 116), -INT8_C(  53),
+       INT8_C( 108), -INT8_C(  96), -INT8_C(   8),  INT8_C( 106),  INT8_C(  22),  INT8_C( 112), -INT8_C(  18), -INT8_C(   3),
+       INT8_C(  83), -INT8_C(  64),  INT8_C( 123),  INT8_C(  14), -INT8_C(  69),  INT8_C(  46),  INT8_C(  24), -INT8_C(  79),
+      -INT8_C( 102),  INT8_C(  76),  INT8_C(  51), -INT8_C( 112),  INT8_C(  45),  INT8_C(  65), -INT8_C(  91), -INT8_C(  85),
+       INT8_C( 106),  INT8_C(  87),  INT8_C(  91),  INT8_C(  92), -INT8_C(  18), -INT8_C(  25),  INT8_C(  40),  INT8_C(  91),
+      -INT8_C( 120),  INT8_C(  32), -INT8_C(  59), -INT8_C(  98), -INT8_C( 112), -INT8_C(  77), -INT8_C( 101), -INT8_C(  28),
+       INT8_C( 116),  INT8_C(  22), -INT8_C(  14),  INT8_C(  47),  INT8_C(  68),  INT8_C(  10), -INT8_C(  32), -INT8_C(  34),
+       INT8_C(  87),  INT8_C(  19),  INT8_C( 110), -INT8_C( 124),  INT8_C(  84),  INT8_C(  20),  INT8_C(  48), -INT8_C(  66),
+       INT8_C( 107), -INT8_C( 117),  INT8_C(  27),  INT8_C(  89),  INT8_C( 115),  INT8_C(  67), -INT8_C(  76), -INT8_C(   5),
+       INT8_C(  99),  INT8_C( 122), -INT8_C( 103), -INT8_C(  12),  INT8_C(  45),  INT8_C(  53), -INT8_C(  40), -INT8_C(  95),
+       INT8_C(  75), -INT8_C(  54), -INT8_C(  48), -INT8_C( 112), -INT8_C(  44), -INT8_C(  80),  INT8_C( 110),  INT8_C(  43),
+      -INT8_C(  61), -INT8_C(  35), -INT8_C(  80),  INT8_C(  24), -INT8_C(  15), -INT8_C(  32), -INT8_C(  42),  INT8_C(  92),
+       INT8_C( 107), -INT8_C(  15), -INT8_C(  75), -INT8_C(  34),  INT8_C(  52),  INT8_C( 106), -INT8_C(  39), -INT8_C( 104),
+      -INT8_C(  28),  INT8_C( 115), -INT8_C( 116),  INT8_C(  17), -INT8_C(  88),  INT8_C( 100), -INT8_C(  77), -INT8_C(  13),
+       INT8_C(  46), -INT8_C( 125), -INT8_C( 125),  INT8_C(   2),  INT8_C(  52), -INT8_C(  14),  INT8_C(  46), -INT8_C(   9),
+      -INT8_C(  49), -INT8_C(  34),  INT8_C(  15), -INT8_C(  64), -INT8_C(  66), -INT8_C(  26),  INT8_C(  28),  INT8_C(  41),
+      -INT8_C(  41), -INT8_C(  47),  INT8_C(   8),  INT8_C(  12),  INT8_C(  59), -INT8_C(  31), -INT8_C(  92),  INT8_C(  31),
+       INT8_C(  84),  INT8_C(  48),  INT8_C(  49), -INT8_C(   4), -INT8_C( 108), -INT8_C(  28), -INT8_C(  16), -INT8_C(  62),
+       INT8_C( 103),  INT8_C( 115), -INT8_C(  60), -INT8_C( 101),  INT8_C( 101), -INT8_C(  14), -INT8_C( 109),  INT8_C(  52),
+      -INT8_C(  48), -INT8_C(  94), -INT8_C(  12), -INT8_C( 114), -INT8_C( 120),  INT8_C(  16), -INT8_C(  72),  INT8_C(  96),
+      -INT8_C(  30), -INT8_C(  64),  INT8_C( 108),  INT8_C(  29), -INT8_C(  95),  INT8_C(  16),  INT8_C(  61), -INT8_C(  10),
+       INT8_C(  64),  INT8_C( 110), -INT8_C(  14), -INT8_C(  44),  INT8_C(  82), -INT8_C(  30), -INT8_C( 106), -INT8_C(  71),
+       INT8_C(  86),  INT8_C(  90),  INT8_C(  85), -INT8_C(  69),  INT8_C(  77), -INT8_C(  24), -INT8_C(  16),  INT8_C(  29),
+      -INT8_C( 118), -INT8_C(  28), -INT8_C(  84),  INT8_C(  19), -INT8_C(  11),  INT8_C( 100),  INT8_C( 115), -INT8_C(  41),
+       INT8_C(  36), -INT8_C(  33), -INT8_C(  12), -INT8_C(  59), -INT8_C(  17),  INT8_C(  49), -INT8_C(  69),  INT8_C(  47),
+      -INT8_C(  97), -INT8_C(  82),  INT8_C(   3), -INT8_C(  15), -INT8_C( 112), -INT8_C( 103), -INT8_C(  85), -INT8_C(  26),
+      -INT8_C(  13),  INT8_C(   0), -INT8_C(  94),  INT8_C(  64), -INT8_C(  24), -INT8_C( 110),  INT8_C(  94),  INT8_C( 114),
+       INT8_C( 118),  INT8_C(  10), -INT8_C( 123),  INT8_C( 107),  INT8_C( 110), -INT8_C(   8),  INT8_C(  66), -INT8_C( 110),
+      -INT8_C(  41),  INT8_C(  55),  INT8_C(  87), -INT8_C(  58),  INT8_C( 104),  INT8_C(  19), -INT8_C(  11),  INT8_C(   8),
+      -INT8_C(  63), -INT8_C(   8), -INT8_C(   7),  INT8_C(  81), -INT8_C( 111), -INT8_C(  92),  INT8_C(  56), -INT8_C( 123),
+      -INT8_C(  92), -INT8_C(  38), -INT8_C(  59), -INT8_C( 116),  INT8_C( 108),  INT8_C(  35), -INT8_C(   1), -INT8_C(  30),
+       INT8_C(  45), -INT8_C( 124),  INT8_C(  78), -INT8_C( 101),  INT8_C( 125), -INT8_C( 112),  INT8_C(  45),  INT8_C(  84),
+      -INT8_C(  57), -INT8_C( 123),  INT8_C(  27),  INT8_C(  48), -INT8_C( 104),  INT8_C(  16),  INT8_C(  56),  INT8_C(  89),
+       INT8_C(   9),  INT8_C(  49), -INT8_C(  86), -INT8_C( 102), -INT8_C(  42), -INT8_C(  30),  INT8_C(  31),  INT8_C( 122),
+      -INT8_C(  68), -INT8_C(  27),  INT8_C(   7),  INT8_C(  40),  INT8_C(   8),  INT8_C(   6),  INT8_C(  11),  INT8_C(  54),
+      -INT8_C( 118),  INT8_C(  89), -INT8_C(  47),  INT8_C(   7), -INT8_C(  23), -INT8_C(   1),  INT8_C(  92), -INT8_C(  79),
+      -INT8_C( 124),  INT8_C( 119), -INT8_C(  31),  INT8_C(  28), -INT8_C( 121),  INT8_C(  25),  INT8_C( 117), -INT8_C( 112),
+       INT8_C(  74),  INT8_C(  31),  INT8_C(  43),  INT8_C(  32),  INT8_C(   2),  INT8_C(  74), -INT8_C( 101), -INT8_C(  66),
+       INT8_C(  47), -INT8_C(  94), -INT8_C(  25),  INT8_C(  56), -INT8_C(  88), -INT8_C(  14),  INT8_C( 110),  INT8_C(  50),
+       INT8_C(  75),  INT8_C(  63),  INT8_C(  58),  INT8_C(  52),  INT8_C(  62), -INT8_C( 106), -INT8_C(  27), -INT8_C(  62),
+       INT8_C(  13), -INT8_C(  58), -INT8_C(  34), -INT8_C( 108), -INT8_C(  33),  INT8_C(  83),  INT8_C(  37),  INT8_C(  42),
+       INT8_C( 115),  INT8_C(  80),  INT8_C(  74),  INT8_C( 117), -INT8_C( 102), -INT8_C(  27),  INT8_C(  51), -INT8_C(  54),
+      -INT8_C( 121),  INT8_C(  26),  INT8_C(   2),  INT8_C(  47),  INT8_C(  12),  INT8_C( 112),  INT8_C(  98),  INT8_C(  87),
+      -INT8_C(  81), -INT8_C( 100), -INT8_C( 116), -INT8_C(  18),  INT8_C(  50),  INT8_C( 113), -INT8_C(  80),  INT8_C(  63),
+       INT8_C(  56), -INT8_C( 113), -INT8_C(  45),  INT8_C(  23), -INT8_C(  30), -INT8_C(   8),  INT8_C(  65),  INT8_C(  85),
+       INT8_C(  72), -INT8_C( 116), -INT8_C(  54), -INT8_C(  29),  INT8_C( 113), -INT8_C(   2), -INT8_C(  83), -INT8_C(   7),
+       INT8_C(  24), -INT8_C(  81),  INT8_C(  40),  INT8_C(  37),  INT8_C(  31), -INT8_C( 118),  INT8_C( 124), -INT8_C(  50),
+       INT8_C(  38),  INT8_C(   8), -INT8_C(  68),  INT8_C(  88),  INT8_C( 122),  INT8_C( 109), -INT8_C( 105), -INT8_C(  78),
+      -INT8_C(   4),  INT8_C( 107), -INT8_C(  55), -INT8_C(  34),  INT8_C(  99),  INT8_C(  11),  INT8_C(  52), -INT8_C(  84),
+      -INT8_C( 105), -INT8_C(   2), -INT8_C( 113),  INT8_C(   8), -INT8_C(   4),  INT8_C(  60),  INT8_C(   1),  INT8_C(  21) };
+  static const int32_t e[] =
+    {  INT32_C(   545513535), -INT32_C(   616964806),  INT32_C(  1812520835),  INT32_C(  1113168664), -INT32_C(   942544063), -INT32_C(  1422099858), -INT32_C(   838664032),  INT32_C(   524797615),
+       INT32_C(  1732234827), -INT32_C(  2076020315),  INT32_C(  2029016601), -INT32_C(  1598392321), -INT32_C(   160989744), -INT32_C(  1465726409), -INT32_C(   780685034), -INT32_C(   957293610),
+      -INT32_C(    64075436), -INT32_C(   444501199), -INT32_C(  1520619964), -INT32_C(   331014001), -INT32_C(  1142770811),  INT32_C(   929328795),  INT32_C(  1745403862),  INT32_C(   556801236),
+      -INT32_C(   803327831), -INT32_C(  1984588973), -INT32_C(   869398362), -INT32_C(   843559603),  INT32_C(  1921634995),  INT32_C(  1235854821),  INT32_C(  1639055623), -INT32_C(   746403531),
+       INT32_C(   195273558),  INT32_C(  1351891045), -INT32_C(  1776507173),  INT32_C(  1466139697), -INT32_C(  1916152739), -INT32_C(  1579773433), -INT32_C(   838686073), -INT32_C(  1499370011),
+       INT32_C(  1706101263),  INT32_C(   146109208),  INT32_C(  1050589035),  INT32_C(   328547197), -INT32_C(   928948266), -INT32_C(   177631182),  INT32_C(  1757707020),  INT32_C(   370029300),
+       INT32_C(  1199295372),  INT32_C(   189739004), -INT32_C(  1505103588), -INT32_C(   558193178),  INT32_C(   262537879), -INT32_C(   771428361),  INT32_C(  1832572127), -INT32_C(   662483453),
+       INT32_C(   186657387),  INT32_C(   823549635),  INT32_C(  1305980129),  INT32_C(  2100011985), -INT32_C(  1081305724),  INT32_C(  1586587353), -INT32_C(  1983146453),  INT32_C(   442593505),
+       INT32_C(  2099595104),  INT32_C(  1303257706), -INT32_C(   627414425),  INT32_C(    56092986),  INT32_C(  2042802503), -INT32_C(   791200273),  INT32_C(   827948494),  INT32_C(  1045152915),
+       INT32_C(   733699517),  INT32_C(  1199069459),  INT32_C(   102879024),  INT32_C(  1862886470), -INT32_C(   739660694),  INT32_C(  1050933508),  INT32_C(  1416641905), -INT32_C(   225252830),
+      -INT32_C(   685956864), -INT32_C(  1507889069), -INT32_C(  2136199780),  INT32_C(   418420612), -INT32_C(  1578374636), -INT32_C(    52437468),  INT32_C(  1079020579),  INT32_C(   892537540),
+      -INT32_C(   401782205), -INT32_C(  1903223613),  INT32_C(   655295418),  INT32_C(  1933556972),  INT32_C(  1897224218),  INT32_C(  1114574945),  INT32_C(  1300488306), -INT32_C(   763124289),
+      -INT32_C(   340033149),  INT32_C(   695878368),  INT32_C(  2001766966),  INT32_C(  1625970330),  INT32_C(  1943137997),  INT32_C(   934628339), -INT32_C(  1618654273), -INT32_C(   210629316),
+       INT32_C(  1423900320), -INT32_C(    58887737),  INT32_C(  1785959504),  INT32_C(   415913280),  INT32_C(  1368091613), -INT32_C(   645308564),  INT32_C(  1735930384), -INT32_C(  1369774518),
+      -INT32_C(  1912459230),  INT32_C(  1955306759), -INT32_C(  1428233367), -INT32_C(  1161657229),  INT32_C(   520829683),  INT32_C(   116934895), -INT32_C(  1200792097),  INT32_C(  1919332455),
+      -INT32_C(  1811853279),  INT32_C(   872988484), -INT32_C(   404817698), -INT32_C(   744401503),  INT32_C(  2062728476), -INT32_C(   478016985), -INT32_C(  1231233112), -INT32_C(  1205358720),
+       INT32_C(  1380713135),  INT32_C(  1082542893), -INT32_C(   886597709), -INT32_C(   241249136), -INT32_C(  1251189308), -INT32_C(   694570663), -INT32_C(  1836294709), -INT32_C(  1572165703),
+      -INT32_C(  1795838204),  INT32_C(   651440400), -INT32_C(   453901932),  INT32_C(   936799641), -INT32_C(  1662175890),  INT32_C(   175294640), -INT32_C(   224593335), -INT32_C(  1835671314),
+       INT32_C(  1730576062), -INT32_C(   443663647), -INT32_C(  1194702759),  INT32_C(   787522484),  INT32_C(   298501444),  INT32_C(   505113070), -INT32_C(   284115214),  INT32_C(   461548812),
+       INT32_C(   897745479), -INT32_C(  1743126611), -INT32_C(  1705921092),  INT32_C(  1724402862), -INT32_C(  2122857361),  INT32_C(   178230117), -INT32_C(   369444255), -INT32_C(  2080073132),
+      -INT32_C(   944119470),  INT32_C(   576772225),  INT32_C(  1035847764),  INT32_C(   279162094), -INT32_C(   409928373), -INT32_C(   101646940),  INT32_C(   887306521), -INT32_C(  1933986739),
+       INT32_C(    55809518), -INT32_C(    14303089),  INT32_C(  1446834405), -INT32_C(  2140738075), -INT32_C(  1469609538),  INT32_C(   128003224), -INT32_C(  1422168464), -INT32_C(   667424232),
+      -INT32_C(  1378118104), -INT32_C(  1548991198),  INT32_C(  1274684546), -INT32_C(  1026848266),  INT32_C(  2137716058), -INT32_C(   813297318), -INT32_C(    75834430),  INT32_C(   500493591),
+       INT32_C(  2076860673), -INT32_C(  1809923663),  INT32_C(   668935413), -INT32_C(   806729045),  INT32_C(  1749944631), -INT32_C(   231230720) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svint8_t
+      bv = simde_svld1_s8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4])),
+      cv = simde_svld1_s8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(c[i * 4]));
+
+    rv = simde_svdot_s32(av, bv, cv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t a[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int8_t b[1024], c[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svint8_t bv, cv;
+
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4]));
+    cv = simde_svld1_s8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(c[i * 4]));
+
+    ev = simde_svdot_s32(av, bv, cv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len * 4), c);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t a[] =
+    {  INT64_C( 6720674626815192111),  INT64_C( 3626835713131106107),  INT64_C( 1598479388310313135), -INT64_C( 5933011485035635142),
+      -INT64_C( 3317438139918453342), -INT64_C( 6740293305506670746), -INT64_C( 6529751706417529918), -INT64_C( 2579875140363320057),
+      -INT64_C( 9021155231320963738), -INT64_C( 8081643778743131325),  INT64_C(  272253356076585910),  INT64_C( 7410877700220948417),
+      -INT64_C(  261997429486563905),  INT64_C( 1490984351053259605), -INT64_C( 8548680055235703715),  INT64_C( 6913690218277430667),
+      -INT64_C( 2567165555325119062), -INT64_C(  563600198148910661), -INT64_C( 1545388473512271300),  INT64_C( 1770310951035605394),
+       INT64_C( 2171256615271648189),  INT64_C(  936296617159893099), -INT64_C( 8137830820362563641), -INT64_C( 6038110017758853458),
+      -INT64_C(  819916225358221539),  INT64_C(  148328770086557490),  INT64_C( 7697559664571457095),  INT64_C(  241712129462670527),
+      -INT64_C( 8005108351698187414),  INT64_C( 2538237827885491195),  INT64_C( 6549705668250001855), -INT64_C( 7946775099103220786),
+       INT64_C( 6600708463125675181), -INT64_C( 8264163804341785264), -INT64_C( 4746532388878109140),  INT64_C( 3967716946533820505),
+       INT64_C( 5990029413155247461), -INT64_C( 6312412267103145463), -INT64_C( 5462145775088734844),  INT64_C( 3709352895757657272),
+      -INT64_C( 6759874896350036775),  INT64_C(  211913816449593291), -INT64_C( 6387324799723020468), -INT64_C( 6030491621946454450),
+       INT64_C( 3268127213752961055), -INT64_C(   78700074922290328),  INT64_C( 6294624945865842629), -INT64_C( 4031352062981487218),
+      -INT64_C( 5288674782013778677),  INT64_C( 4277720865016909997), -INT64_C( 7979170163839728924), -INT64_C( 8934579289598019696),
+       INT64_C(  619399275040833940), -INT64_C( 7111810837879704420),  INT64_C( 1827281165032766920), -INT64_C( 2196820603077243515),
+      -INT64_C( 7189895649225902892),  INT64_C( 3307608488308285584), -INT64_C( 4333497212413120455),  INT64_C( 6255013361101188769),
+       INT64_C( 9103673629316911801),  INT64_C( 4247367246189954398), -INT64_C( 2512488263797839585), -INT64_C( 2170566621002996985),
+      -INT64_C( 9036206415456541141),  INT64_C( 3256724918465028343),  INT64_C( 1169154730191695647), -INT64_C( 3920249753033964401),
+       INT64_C( 2127241802206622943),  INT64_C( 2384452601247026139), -INT64_C( 2481564421395209609), -INT64_C( 9069637623771551301),
+       INT64_C( 6603134125295863136),  INT64_C( 8644760643419093206), -INT64_C( 1789751852075158018),  INT64_C( 5391761933122715055),
+       INT64_C( 4198608729367665000), -INT64_C( 2043777826492937940), -INT64_C( 3489629863924491649), -INT64_C( 7113167098697690603),
+      -INT64_C( 5049720946760017587), -INT64_C( 8783557463432037294), -INT64_C( 5326979212329793245),  INT64_C( 8388232653340750742),
+       INT64_C(  746771494115601942), -INT64_C( 1109753801603988724),  INT64_C( 2737421725405006501), -INT64_C( 4173612339516362119),
+       INT64_C( 6127366413652474183),  INT64_C( 5460053414306662922), -INT64_C( 5080183248578741556),  INT64_C( 1205115089420120130),
+      -INT64_C(  845524532238343258),  INT64_C( 8814267597358542177), -INT64_C( 5222956802935233141), -INT64_C( 1108620761407758908),
+       INT64_C( 2622260205355773062),  INT64_C( 5402487489433382608), -INT64_C( 1761020550067138974),  INT64_C( 2499518257643731318),
+      -INT64_C( 8960484632750288962), -INT64_C( 5751382258342506460),  INT64_C( 6112818311165658314),  INT64_C( 1949712691586419280) };
+  static const int16_t b[] =
+    {  INT16_C(  8157), -INT16_C( 11705), -INT16_C( 19034), -INT16_C(  2619), -INT16_C( 24927), -INT16_C(  4304),  INT16_C( 13573),  INT16_C(  9197),
+      -INT16_C( 10446), -INT16_C( 26672),  INT16_C( 28486), -INT16_C( 25569),  INT16_C( 19631), -INT16_C( 18430), -INT16_C( 23718),  INT16_C( 14356),
+       INT16_C( 23746),  INT16_C( 26890), -INT16_C( 12527), -INT16_C( 19874), -INT16_C( 28819),  INT16_C( 29345), -INT16_C( 28988), -INT16_C(  2410),
+       INT16_C( 26213), -INT16_C( 21619), -INT16_C( 21291), -INT16_C( 31673),  INT16_C( 19192),  INT16_C( 21052),  INT16_C( 20973), -INT16_C( 20598),
+      -INT16_C( 27475), -INT16_C( 16872),  INT16_C( 30563), -INT16_C( 11920),  INT16_C(  4358), -INT16_C( 13757), -INT16_C(  9825),  INT16_C(  1216),
+       INT16_C( 19775),  INT16_C(  5295), -INT16_C(  2055), -INT16_C(  3688), -INT16_C( 10943),  INT16_C( 11843), -INT16_C( 12762), -INT16_C( 11299),
+      -INT16_C(  2462), -INT16_C( 14703),  INT16_C(   365),  INT16_C( 29591), -INT16_C(  9710), -INT16_C( 20163), -INT16_C(   588), -INT16_C(  3147),
+       INT16_C( 25674),  INT16_C( 17160), -INT16_C( 24485), -INT16_C( 25548),  INT16_C( 30581), -INT16_C( 25654), -INT16_C( 22459), -INT16_C( 22418),
+      -INT16_C(    98),  INT16_C(  2926),  INT16_C(  1280),  INT16_C(  4734), -INT16_C( 17441), -INT16_C( 27709),  INT16_C( 30904),  INT16_C(   647),
+      -INT16_C( 28707),  INT16_C( 14405),  INT16_C( 31023), -INT16_C( 23083), -INT16_C( 24592),  INT16_C( 13888), -INT16_C( 20665), -INT16_C(  6690),
+       INT16_C( 19630), -INT16_C( 20496),  INT16_C( 28241),  INT16_C( 12481), -INT16_C( 31447), -INT16_C(  7740),  INT16_C( 19453), -INT16_C(  9501),
+       INT16_C( 10458),  INT16_C(  2323), -INT16_C(  5983), -INT16_C( 27986), -INT16_C(  4217), -INT16_C( 12344), -INT16_C( 22882),  INT16_C( 19636),
+      -INT16_C( 23054),  INT16_C( 17403), -INT16_C( 17133),  INT16_C( 15731),  INT16_C( 14146),  INT16_C( 16158),  INT16_C(   642),  INT16_C( 23578),
+       INT16_C( 11562), -INT16_C( 13210),  INT16_C(  5141), -INT16_C( 25506),  INT16_C(  9731), -INT16_C( 24213),  INT16_C(  8396), -INT16_C( 16658),
+      -INT16_C(  5691), -INT16_C( 10239),  INT16_C( 29862), -INT16_C(  6123),  INT16_C( 13484),  INT16_C( 11816),  INT16_C( 16950),  INT16_C( 24715),
+      -INT16_C(  3729), -INT16_C( 31700), -INT16_C( 30203),  INT16_C(  2336), -INT16_C( 29520),  INT16_C( 31914), -INT16_C( 26452),  INT16_C( 28986),
+       INT16_C( 15234),  INT16_C( 10313),  INT16_C( 24496),  INT16_C( 23569),  INT16_C( 14739), -INT16_C( 13942),  INT16_C(  5499), -INT16_C(  5591),
+       INT16_C( 22022),  INT16_C(  3182), -INT16_C( 28960), -INT16_C( 28395), -INT16_C( 16614), -INT16_C( 14835),  INT16_C( 18520), -INT16_C(  9673),
+      -INT16_C( 32381),  INT16_C( 13058),  INT16_C(  5088),  INT16_C( 29583),  INT16_C(  6732), -INT16_C( 14532),  INT16_C( 25903),  INT16_C( 14001),
+       INT16_C(  8123), -INT16_C( 25534),  INT16_C( 22446), -INT16_C( 14291),  INT16_C( 14870),  INT16_C( 28303), -INT16_C( 14718),  INT16_C(  1608),
+       INT16_C( 19271),  INT16_C( 10041), -INT16_C( 13986), -INT16_C( 21606), -INT16_C( 10525),  INT16_C(  4722),  INT16_C(  9276), -INT16_C(  2232),
+      -INT16_C( 30141), -INT16_C(  3693), -INT16_C( 16159), -INT16_C(  1862),  INT16_C( 18939),  INT16_C( 32102), -INT16_C( 20721),  INT16_C( 22403),
+      -INT16_C( 16902),  INT16_C( 22654),  INT16_C(  6534),  INT16_C( 26883),  INT16_C( 30447),  INT16_C( 11131), -INT16_C( 15206), -INT16_C(  8925),
+      -INT16_C( 18866),  INT16_C( 12495), -INT16_C( 30345),  INT16_C( 29224), -INT16_C( 28974), -INT16_C(  7697),  INT16_C( 29501),  INT16_C( 14136),
+      -INT16_C( 18640), -INT16_C( 18800), -INT16_C( 27696), -INT16_C( 16609), -INT16_C( 26103), -INT16_C( 23573),  INT16_C(  3678), -INT16_C( 21119),
+       INT16_C( 20676),  INT16_C( 15325),  INT16_C(  1497), -INT16_C( 21587), -INT16_C( 25197), -INT16_C( 11892), -INT16_C( 15088),  INT16_C( 16392),
+      -INT16_C( 26500),  INT16_C( 19702),  INT16_C(  5420),  INT16_C( 13579), -INT16_C(  2385),  INT16_C(  3801),  INT16_C( 23044), -INT16_C( 13893),
+      -INT16_C( 26454), -INT16_C( 31996), -INT16_C( 19811),  INT16_C( 12334), -INT16_C( 17841),  INT16_C( 24321),  INT16_C(  2687), -INT16_C(  1121),
+      -INT16_C( 27230), -INT16_C( 12729),  INT16_C( 21418),  INT16_C( 22788), -INT16_C(  8887),  INT16_C( 20071),  INT16_C(  8759), -INT16_C(  7913),
+       INT16_C(  7098),  INT16_C( 22372), -INT16_C( 27955),  INT16_C(  7304), -INT16_C( 30388), -INT16_C( 13189),  INT16_C(  6803),  INT16_C( 14023),
+       INT16_C(  4015),  INT16_C( 22788),  INT16_C(  2146), -INT16_C( 21581),  INT16_C(  6885),  INT16_C(  7417),  INT16_C(  4157), -INT16_C(  2051),
+       INT16_C( 24876), -INT16_C(  1713), -INT16_C( 10253),  INT16_C( 16406), -INT16_C( 28320), -INT16_C(  3060), -INT16_C( 11348),  INT16_C( 23338),
+       INT16_C( 12002),  INT16_C( 17589),  INT16_C( 26679),  INT16_C(  7408), -INT16_C(  5758), -INT16_C( 16583),  INT16_C( 14074),  INT16_C(  9911),
+       INT16_C(  1688), -INT16_C( 29921),  INT16_C( 13789),  INT16_C( 15819), -INT16_C( 10297),  INT16_C( 29489),  INT16_C( 23467), -INT16_C( 29234),
+      -INT16_C( 31862), -INT16_C( 15918), -INT16_C( 15637),  INT16_C( 28381),  INT16_C(  5803), -INT16_C( 23251), -INT16_C(  7091), -INT16_C(  6709),
+      -INT16_C(  5142), -INT16_C( 14480),  INT16_C( 15392), -INT16_C(  6395),  INT16_C( 13843), -INT16_C( 16806),  INT16_C( 10642),  INT16_C(  7244),
+       INT16_C(  7852), -INT16_C( 26403), -INT16_C( 17696), -INT16_C( 29946),  INT16_C( 13265),  INT16_C(  7729), -INT16_C(  1000),  INT16_C(   515),
+       INT16_C( 29671),  INT16_C(  2250), -INT16_C( 12369), -INT16_C( 15377),  INT16_C( 18949), -INT16_C( 26751), -INT16_C( 12941),  INT16_C(  8115),
+      -INT16_C( 28437), -INT16_C( 13385), -INT16_C( 17077),  INT16_C(  7255), -INT16_C( 30479),  INT16_C(  2362),  INT16_C( 15748),  INT16_C( 27659),
+      -INT16_C( 10832),  INT16_C( 24692),  INT16_C( 25508), -INT16_C( 21981), -INT16_C( 23379),  INT16_C(  8257), -INT16_C(  2702),  INT16_C( 23872),
+      -INT16_C(  2171), -INT16_C( 12247), -INT16_C( 32587), -INT16_C( 22804),  INT16_C(  9736), -INT16_C( 29521), -INT16_C( 17821),  INT16_C(  5368),
+       INT16_C( 27792),  INT16_C( 13428), -INT16_C( 26672),  INT16_C( 32222),  INT16_C(  8251), -INT16_C( 21090), -INT16_C(  8683), -INT16_C( 26101),
+       INT16_C( 13525), -INT16_C( 30101),  INT16_C( 22452), -INT16_C( 17360), -INT16_C(  8322), -INT16_C(  7864),  INT16_C( 16794),  INT16_C( 10997),
+       INT16_C( 27053),  INT16_C( 32094),  INT16_C( 15616),  INT16_C( 15611), -INT16_C( 26275),  INT16_C( 29417), -INT16_C(  2953),  INT16_C( 19468),
+       INT16_C( 30504), -INT16_C(  9001),  INT16_C(  1999),  INT16_C( 19864), -INT16_C(  7705), -INT16_C( 32466),  INT16_C(  9250), -INT16_C( 12373),
+       INT16_C(  2445), -INT16_C( 29107),  INT16_C( 18502), -INT16_C( 23606), -INT16_C( 19487),  INT16_C( 22549),  INT16_C(  8872), -INT16_C( 12124),
+       INT16_C( 31641),  INT16_C( 26797),  INT16_C( 17795),  INT16_C( 27317), -INT16_C(  7130),  INT16_C( 18667), -INT16_C( 27128), -INT16_C( 27368),
+       INT16_C( 26015), -INT16_C(  6621), -INT16_C(  4691), -INT16_C( 29047), -INT16_C( 24671),  INT16_C( 18918), -INT16_C( 30015),  INT16_C( 23065),
+      -INT16_C( 14842), -INT16_C( 30269),  INT16_C( 30732),  INT16_C( 13043), -INT16_C(  8612),  INT16_C( 25723), -INT16_C( 27788),  INT16_C(  5114),
+       INT16_C(  7672), -INT16_C( 23047), -INT16_C( 31989), -INT16_C( 21453),  INT16_C(  6434), -INT16_C(  7179),  INT16_C(  3747), -INT16_C( 22211),
+       INT16_C(   213), -INT16_C(  7886),  INT16_C(  9593), -INT16_C( 10989), -INT16_C( 29181),  INT16_C( 30522),  INT16_C( 13345),  INT16_C(  6539),
+      -INT16_C( 31663),  INT16_C( 23742), -INT16_C(  3833),  INT16_C( 10504), -INT16_C(   758), -INT16_C( 20980),  INT16_C( 18956), -INT16_C(  7849) };
+  static const int16_t c[] =
+    { -INT16_C( 12019),  INT16_C( 26750), -INT16_C( 12287), -INT16_C( 25729),  INT16_C( 29940),  INT16_C( 17533),  INT16_C( 13920),  INT16_C( 25387),
+      -INT16_C(  4584), -INT16_C( 17046), -INT16_C( 15991), -INT16_C(  9129),  INT16_C(  1096),  INT16_C(  5326),  INT16_C(   247),  INT16_C(  1109),
+      -INT16_C( 11311), -INT16_C( 11411), -INT16_C(  4957), -INT16_C( 26770), -INT16_C(  5280), -INT16_C( 16164),  INT16_C(  1825),  INT16_C( 14627),
+      -INT16_C( 28939),  INT16_C( 32502),  INT16_C( 19791), -INT16_C( 26790),  INT16_C( 10322),  INT16_C( 18860),  INT16_C(   297), -INT16_C(  1458),
+      -INT16_C( 17452),  INT16_C( 30925),  INT16_C( 15271),  INT16_C(  2063), -INT16_C(  5338),  INT16_C( 18632), -INT16_C(  4878), -INT16_C(  6015),
+       INT16_C( 30842), -INT16_C( 13978), -INT16_C( 15931),  INT16_C(  5985),  INT16_C(  3561),  INT16_C(  4705), -INT16_C( 20722), -INT16_C(  7667),
+      -INT16_C(  9622),  INT16_C(  4442),  INT16_C( 27158),  INT16_C( 15385), -INT16_C(  7595),  INT16_C( 18564),  INT16_C(  1742),  INT16_C( 18480),
+      -INT16_C( 27010),  INT16_C( 17169),  INT16_C( 29271),  INT16_C( 16731), -INT16_C( 17281), -INT16_C( 29357),  INT16_C( 24683), -INT16_C( 10896),
+      -INT16_C( 13765),  INT16_C( 20966),  INT16_C(    52), -INT16_C( 30067),  INT16_C(  4834), -INT16_C( 20270),  INT16_C(   536), -INT16_C( 26888),
+       INT16_C(  2456), -INT16_C(  3879),  INT16_C( 13436), -INT16_C(  1231), -INT16_C( 31504),  INT16_C( 23433), -INT16_C(  1563),  INT16_C(  8240),
+       INT16_C(  6083), -INT16_C(  1935), -INT16_C(   489), -INT16_C(  1662),  INT16_C( 21520),  INT16_C( 10409), -INT16_C( 24234), -INT16_C(  4418),
+      -INT16_C( 26454),  INT16_C(  9950),  INT16_C(  4044), -INT16_C( 17118), -INT16_C( 21612),  INT16_C( 31000),  INT16_C( 18852),  INT16_C( 26521),
+       INT16_C(  2656),  INT16_C( 30559), -INT16_C(  7928),  INT16_C(  6512),  INT16_C(  6453), -INT16_C( 29887),  INT16_C(   186),  INT16_C( 25722),
+       INT16_C( 22680),  INT16_C( 25739), -INT16_C( 21144), -INT16_C(   991),  INT16_C( 14936), -INT16_C(   907),  INT16_C(  3715), -INT16_C(  7325),
+      -INT16_C( 15592),  INT16_C(  8282), -INT16_C( 13660), -INT16_C(  9671),  INT16_C( 31715), -INT16_C( 25243), -INT16_C(  8325),  INT16_C(  4865),
+      -INT16_C( 29640), -INT16_C( 24457), -INT16_C( 26311), -INT16_C( 28260),  INT16_C(  4563),  INT16_C( 22157), -INT16_C(  3809),  INT16_C( 14137),
+      -INT16_C( 27724),  INT16_C( 22615), -INT16_C( 28323),  INT16_C( 16434), -INT16_C( 26612), -INT16_C( 30755), -INT16_C(  8585), -INT16_C( 20582),
+       INT16_C(  4459), -INT16_C( 23473), -INT16_C(  5206),  INT16_C( 32054), -INT16_C( 15364),  INT16_C(  7123),  INT16_C(  3252),  INT16_C( 26706),
+      -INT16_C( 21857), -INT16_C(   831), -INT16_C(  3269),  INT16_C( 18236),  INT16_C(  6539),  INT16_C(   974),  INT16_C( 26872),  INT16_C( 25522),
+       INT16_C(   633),  INT16_C(  9223),  INT16_C( 15853), -INT16_C(  5471),  INT16_C( 29953), -INT16_C( 19195),  INT16_C( 22657),  INT16_C(  8478),
+      -INT16_C(  8446),  INT16_C( 15645),  INT16_C( 23250),  INT16_C( 24196),  INT16_C( 21107),  INT16_C( 27489),  INT16_C(  5050),  INT16_C( 13262),
+      -INT16_C( 10731),  INT16_C(   855), -INT16_C(  1773),  INT16_C(  5357), -INT16_C(  3474), -INT16_C(  4150), -INT16_C(  6070),  INT16_C( 19472),
+       INT16_C( 11975), -INT16_C( 26231),  INT16_C(  3464), -INT16_C(  1033),  INT16_C( 22623),  INT16_C(  6503),  INT16_C( 13676), -INT16_C( 32435),
+      -INT16_C( 23541),  INT16_C(  8068),  INT16_C( 29085),  INT16_C(  2867), -INT16_C(   668), -INT16_C( 20741),  INT16_C(  3045), -INT16_C( 21253),
+      -INT16_C( 31687), -INT16_C( 16058),  INT16_C( 15762), -INT16_C(  3651),  INT16_C(  9366),  INT16_C(   523),  INT16_C( 22617),  INT16_C( 25987),
+       INT16_C(  2300), -INT16_C( 25980), -INT16_C( 18567), -INT16_C(  8795), -INT16_C( 24395), -INT16_C( 25972), -INT16_C( 30804), -INT16_C(  6841),
+      -INT16_C( 29429), -INT16_C( 25177),  INT16_C( 25802),  INT16_C( 24719), -INT16_C( 25976), -INT16_C(  7838), -INT16_C(  6414), -INT16_C(  4538),
+      -INT16_C( 13586),  INT16_C( 26504),  INT16_C( 11906),  INT16_C( 14149), -INT16_C( 11826),  INT16_C( 31441),  INT16_C(  6232),  INT16_C( 25440),
+       INT16_C(  1957),  INT16_C( 28673), -INT16_C( 28565), -INT16_C(  3120),  INT16_C( 13098),  INT16_C(  7380),  INT16_C(  6937),  INT16_C(  1802),
+      -INT16_C( 27675),  INT16_C( 26478), -INT16_C( 19519), -INT16_C( 28770),  INT16_C( 28804), -INT16_C(  9206),  INT16_C( 27272),  INT16_C( 11840),
+       INT16_C( 16753), -INT16_C(  9058),  INT16_C( 28369), -INT16_C(  1073), -INT16_C( 23647), -INT16_C( 17897),  INT16_C(  8638), -INT16_C( 23359),
+       INT16_C( 12468),  INT16_C( 29963), -INT16_C( 21789),  INT16_C( 26629),  INT16_C(  3866), -INT16_C( 23996), -INT16_C( 31623), -INT16_C(  5424),
+       INT16_C( 28357), -INT16_C( 26938), -INT16_C( 27171),  INT16_C( 32401), -INT16_C( 22472), -INT16_C(  2247), -INT16_C(  1334),  INT16_C( 32411),
+      -INT16_C( 22998),  INT16_C(  3828), -INT16_C(  1712),  INT16_C( 27254), -INT16_C( 17912), -INT16_C( 32499), -INT16_C(  8897),  INT16_C(  1131),
+       INT16_C( 12620),  INT16_C( 10651),  INT16_C( 11462), -INT16_C(   345), -INT16_C(  7979), -INT16_C( 24587), -INT16_C( 28453),  INT16_C(  1309),
+       INT16_C(  4407), -INT16_C( 30957), -INT16_C( 30454),  INT16_C(  4850), -INT16_C(   188), -INT16_C( 31853), -INT16_C(   292),  INT16_C( 10375),
+       INT16_C(  8751), -INT16_C(  2735), -INT16_C(  1713),  INT16_C(  9460), -INT16_C(  5671), -INT16_C( 19261), -INT16_C(  8070), -INT16_C( 20038),
+      -INT16_C( 12814), -INT16_C(   968),  INT16_C( 10839), -INT16_C( 25841), -INT16_C( 24023),  INT16_C(  1566), -INT16_C( 23135), -INT16_C( 12242),
+      -INT16_C( 32568),  INT16_C(  6086), -INT16_C( 17799),  INT16_C( 21051), -INT16_C(   349),  INT16_C(  7431), -INT16_C( 15906), -INT16_C( 12082),
+       INT16_C(  1934), -INT16_C(  6707), -INT16_C(  9167),  INT16_C( 23424), -INT16_C( 24962),  INT16_C(  8033), -INT16_C( 28860),  INT16_C(  3312),
+      -INT16_C( 18929), -INT16_C( 30685),  INT16_C( 24176),  INT16_C(  5083), -INT16_C(  7588),  INT16_C( 14897), -INT16_C(    93),  INT16_C( 12555),
+      -INT16_C( 10234),  INT16_C( 14359), -INT16_C( 26700),  INT16_C( 12947), -INT16_C(  3018),  INT16_C( 31314),  INT16_C( 17027), -INT16_C( 27770),
+      -INT16_C( 22024),  INT16_C( 26651), -INT16_C(  2553),  INT16_C( 25467), -INT16_C( 21288),  INT16_C( 31645), -INT16_C( 22356), -INT16_C( 19795),
+      -INT16_C( 15232),  INT16_C( 13546),  INT16_C( 32091), -INT16_C( 28313), -INT16_C( 18063), -INT16_C(  2805), -INT16_C( 28165), -INT16_C(  3192),
+      -INT16_C( 23750),  INT16_C( 16731), -INT16_C( 10598),  INT16_C( 29348),  INT16_C( 17027),  INT16_C( 12270), -INT16_C( 25622),  INT16_C( 27617),
+      -INT16_C( 13217), -INT16_C( 17761),  INT16_C(  1609), -INT16_C( 17588),  INT16_C( 22463), -INT16_C( 17744),  INT16_C( 14569),  INT16_C(  9133),
+       INT16_C(  2267),  INT16_C( 30053),  INT16_C(  2527),  INT16_C( 25320), -INT16_C( 10677),  INT16_C( 13969),  INT16_C( 29297), -INT16_C( 12127),
+       INT16_C( 16446), -INT16_C( 30582), -INT16_C( 10681),  INT16_C(  1603), -INT16_C(  3282),  INT16_C(  6081),  INT16_C( 28203),  INT16_C(  1594),
+      -INT16_C( 24713),  INT16_C( 22140),  INT16_C( 25769), -INT16_C(  2888),  INT16_C( 18746), -INT16_C( 21718), -INT16_C( 13381), -INT16_C(  1413),
+       INT16_C(  1292),  INT16_C( 21378), -INT16_C( 14884),  INT16_C(  2649),  INT16_C(  6840), -INT16_C(  7391),  INT16_C( 23433),  INT16_C(   233),
+       INT16_C( 26107), -INT16_C( 23466),  INT16_C(  3785),  INT16_C(   920), -INT16_C( 15529),  INT16_C(  4782),  INT16_C( 10638), -INT16_C( 26100),
+      -INT16_C( 29137),  INT16_C(  3053),  INT16_C( 18259),  INT16_C(  2837),  INT16_C( 13921), -INT16_C(  5394), -INT16_C( 10095), -INT16_C( 29462) };
+  static const int64_t e[] =
+    {  INT64_C( 6720674626705299387),  INT64_C( 3626835712731750094),  INT64_C( 1598479388590748286), -INT64_C( 5933011485102215288),
+      -INT64_C( 3317438139899762819), -INT64_C( 6740293305916993176), -INT64_C( 6529751707451619174), -INT64_C( 2579875139731918648),
+      -INT64_C( 9021155230921100025), -INT64_C( 8081643778982102643),  INT64_C(  272253356623138475),  INT64_C( 7410877700588785306),
+      -INT64_C(  261997429063015062),  INT64_C( 1490984350693520267), -INT64_C( 8548680056778682438),  INT64_C( 6913690218191995915),
+      -INT64_C( 2567165555404694194), -INT64_C(  563600197672391017), -INT64_C( 1545388473193412486),  INT64_C( 1770310952112963061),
+       INT64_C( 2171256615396163968),  INT64_C(  936296615973139415), -INT64_C( 8137830820161236627), -INT64_C( 6038110017960984762),
+      -INT64_C(  819916224649363990),  INT64_C(  148328770301520210),  INT64_C( 7697559664410246207),  INT64_C(  241712129783184924),
+      -INT64_C( 8005108352042952127),  INT64_C( 2538237827993994692),  INT64_C( 6549705669864472088), -INT64_C( 7946775098020271298),
+       INT64_C( 6600708462630088998), -INT64_C( 8264163804237368275), -INT64_C( 4746532389614011698),  INT64_C( 3967716946485308198),
+       INT64_C( 5990029414374990696), -INT64_C( 6312412266019880145), -INT64_C( 5462145774885070568),  INT64_C( 3709352895339949195),
+      -INT64_C( 6759874897203661472),  INT64_C(  211913816374488190), -INT64_C( 6387324799384059739), -INT64_C( 6030491621583464150),
+       INT64_C( 3268127212951186168), -INT64_C(   78700074079577835),  INT64_C( 6294624945611977678), -INT64_C( 4031352063013090972),
+      -INT64_C( 5288674781497147490),  INT64_C( 4277720864294466493), -INT64_C( 7979170164028254758), -INT64_C( 8934579288321846777),
+       INT64_C(  619399275800171327), -INT64_C( 7111810837932301680),  INT64_C( 1827281164482792980), -INT64_C( 2196820602113352144),
+      -INT64_C( 7189895650327074349),  INT64_C( 3307608488386509595), -INT64_C( 4333497211681674224),  INT64_C( 6255013360698874487),
+       INT64_C( 9103673629261797679),  INT64_C( 4247367245978220229), -INT64_C( 2512488262878734245), -INT64_C( 2170566620806781853),
+      -INT64_C( 9036206416074881410),  INT64_C( 3256724918934134825),  INT64_C( 1169154730445861693), -INT64_C( 3920249754049737101),
+       INT64_C( 2127241801445959146),  INT64_C( 2384452601965374481), -INT64_C( 2481564421469376761), -INT64_C( 9069637623166783231),
+       INT64_C( 6603134125183812281),  INT64_C( 8644760643192749552), -INT64_C( 1789751852194250746),  INT64_C( 5391761932825657367),
+       INT64_C( 4198608730669018634), -INT64_C( 2043777827049412473), -INT64_C( 3489629864859764761), -INT64_C( 7113167097890731740),
+      -INT64_C( 5049720947246859577), -INT64_C( 8783557463876635806), -INT64_C( 5326979211292083287),  INT64_C( 8388232653232416293),
+       INT64_C(  746771492516078515), -INT64_C( 1109753802268818547),  INT64_C( 2737421725486819342), -INT64_C( 4173612339103242090),
+       INT64_C( 6127366413339191722),  INT64_C( 5460053413198403426), -INT64_C( 5080183247649135648),  INT64_C( 1205115088600801869),
+      -INT64_C(  845524530624648465),  INT64_C( 8814267597232551230), -INT64_C( 5222956802301364799), -INT64_C( 1108620762021495763),
+       INT64_C( 2622260205806672472),  INT64_C( 5402487489077895088), -INT64_C( 1761020550130630237),  INT64_C( 2499518257823428155),
+      -INT64_C( 8960484632533475670), -INT64_C( 5751382257772102297),  INT64_C( 6112818312120520572),  INT64_C( 1949712691728919700) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svint16_t
+      bv = simde_svld1_s16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4])),
+      cv = simde_svld1_s16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(c[i * 4]));
+
+    rv = simde_svdot_s64(av, bv, cv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t a[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int16_t b[1024 / sizeof(int16_t)], c[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svint16_t bv, cv;
+
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4]));
+    cv = simde_svld1_s16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(c[i * 4]));
+
+    ev = simde_svdot_s64(av, bv, cv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len * 4), c);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const uint32_t a[] =
+    { UINT32_C(2549260114), UINT32_C(2807730853), UINT32_C( 711218006), UINT32_C(1671304684), UINT32_C(1096288603), UINT32_C(3198427190), UINT32_C(3907407048), UINT32_C(2817624661),
+      UINT32_C(3460227881), UINT32_C(3430259061), UINT32_C(3640056300), UINT32_C(1245418735), UINT32_C(3565917342), UINT32_C(2106732468), UINT32_C(3496310907), UINT32_C( 729241090),
+      UINT32_C(2952377913), UINT32_C( 997945167), UINT32_C( 924021064), UINT32_C(2760003334), UINT32_C(2541227491), UINT32_C(3088321341), UINT32_C(2257156483), UINT32_C( 162595023),
+      UINT32_C(  95988662), UINT32_C(1648374554), UINT32_C(2862240932), UINT32_C(2253266083), UINT32_C(1713227561), UINT32_C(1428107986), UINT32_C(2077993131), UINT32_C(1602522536),
+      UINT32_C(1382300728), UINT32_C( 330605935), UINT32_C(2629717753), UINT32_C(2485259370), UINT32_C(2784640979), UINT32_C( 502995313), UINT32_C(1788401345), UINT32_C(2613648483),
+      UINT32_C(3354209624), UINT32_C(3420103378), UINT32_C(1533516016), UINT32_C(2028964261), UINT32_C( 975104457), UINT32_C(3294042371), UINT32_C(1395585007), UINT32_C(1676605195),
+      UINT32_C(4146781221), UINT32_C(1858274686), UINT32_C(1120479901), UINT32_C(2109454516), UINT32_C(2780289442), UINT32_C(3781758962), UINT32_C( 171219198), UINT32_C(3027051407),
+      UINT32_C(2108463359), UINT32_C( 988508061), UINT32_C(1300084121), UINT32_C( 264910957), UINT32_C(  62161425), UINT32_C(2414091921), UINT32_C(1167661494), UINT32_C(1006241596),
+      UINT32_C(1018734239), UINT32_C(2927010581), UINT32_C(3338466136), UINT32_C(1020642859), UINT32_C(3644820040), UINT32_C(1583948968), UINT32_C(2040726077), UINT32_C(2830408969),
+      UINT32_C(1491364931), UINT32_C(1745312527), UINT32_C(2049835854), UINT32_C( 313918409), UINT32_C( 904656525), UINT32_C(1469273114), UINT32_C(1624258391), UINT32_C( 403277012),
+      UINT32_C(4285591024), UINT32_C(2540140360), UINT32_C(1142003066), UINT32_C( 643221401), UINT32_C(3613147581), UINT32_C(3979276182), UINT32_C(4216192550), UINT32_C(1913869954),
+      UINT32_C(2356314948), UINT32_C(1965283835), UINT32_C( 146355311), UINT32_C(3106803708), UINT32_C(3885075025), UINT32_C(2698297210), UINT32_C(1083908542), UINT32_C(3165892216),
+      UINT32_C( 759702834), UINT32_C(1839361278), UINT32_C(2624937120), UINT32_C(3159794795), UINT32_C(2829313838), UINT32_C(1682536358), UINT32_C( 296084633), UINT32_C(3318569107),
+      UINT32_C(2079462781), UINT32_C( 585733249), UINT32_C(1555980016), UINT32_C( 823661570), UINT32_C(2732178683), UINT32_C(3422954035), UINT32_C(2598218503), UINT32_C(2153753091),
+      UINT32_C(1107055040), UINT32_C(3596871141), UINT32_C(1177690691), UINT32_C( 846678582), UINT32_C( 986992646), UINT32_C(2047269491), UINT32_C(2299847814), UINT32_C(1309307790),
+      UINT32_C(2844788420), UINT32_C( 780137451), UINT32_C(1282715925), UINT32_C(  41872380), UINT32_C(2939966012), UINT32_C(2989048620), UINT32_C(3040623911), UINT32_C(1946437296),
+      UINT32_C( 924685388), UINT32_C(2640682375), UINT32_C(1256839758), UINT32_C(  21850053), UINT32_C(3853552057), UINT32_C(4086880716), UINT32_C(3333018646), UINT32_C(1715121434),
+      UINT32_C(3365754945), UINT32_C(1130693365), UINT32_C(2727235292), UINT32_C(1856232373), UINT32_C( 827610212), UINT32_C(1143270445), UINT32_C(3658141120), UINT32_C(3141551482),
+      UINT32_C(2458181021), UINT32_C(3168135647), UINT32_C(3982385976), UINT32_C(2740715838), UINT32_C(2211754069), UINT32_C(1556609180), UINT32_C(1077334470), UINT32_C(3019666966),
+      UINT32_C( 843415635), UINT32_C(2716736361), UINT32_C(3180285054), UINT32_C(2741037902), UINT32_C( 925250715), UINT32_C(4069780780), UINT32_C(3576940991) };
+  static const uint8_t b[] =
+    { UINT8_C(122), UINT8_C(243), UINT8_C(178), UINT8_C(200), UINT8_C(237), UINT8_C(219), UINT8_C(158), UINT8_C(183),
+      UINT8_C(213), UINT8_C( 91), UINT8_C(193), UINT8_C(233), UINT8_C(  8), UINT8_C( 46), UINT8_C( 39), UINT8_C(136),
+      UINT8_C( 23), UINT8_C(158), UINT8_C( 89), UINT8_C(146), UINT8_C(225), UINT8_C(217), UINT8_C(132), UINT8_C(145),
+      UINT8_C(144), UINT8_C(167), UINT8_C( 96), UINT8_C( 36), UINT8_C(134), UINT8_C( 18), UINT8_C(235), UINT8_C(  1),
+      UINT8_C(  5), UINT8_C(157), UINT8_C(201), UINT8_C(243), UINT8_C(120), UINT8_C(103), UINT8_C(170), UINT8_C( 78),
+      UINT8_C(194), UINT8_C(107), UINT8_C( 55), UINT8_C(202), UINT8_C(153), UINT8_C( 94), UINT8_C( 82), UINT8_C(176),
+      UINT8_C(252), UINT8_C(171), UINT8_C( 66), UINT8_C(222), UINT8_C(133), UINT8_C(198), UINT8_C(111), UINT8_C( 21),
+      UINT8_C(109), UINT8_C(207), UINT8_C( 57), UINT8_C(244), UINT8_C(225), UINT8_C( 36), UINT8_C(245), UINT8_C(231),
+      UINT8_C(193), UINT8_C(190), UINT8_C(218), UINT8_C( 58), UINT8_C( 37), UINT8_C(132), UINT8_C(136), UINT8_C(232),
+      UINT8_C(239), UINT8_C(191), UINT8_C(178), UINT8_C(136), UINT8_C( 30), UINT8_C(  5), UINT8_C( 57), UINT8_C( 26),
+      UINT8_C(176), UINT8_C(123), UINT8_C(248), UINT8_C( 53), UINT8_C( 66), UINT8_C(103), UINT8_C( 74), UINT8_C(175),
+      UINT8_C( 55), UINT8_C(131), UINT8_C(163), UINT8_C( 24), UINT8_C(167), UINT8_C(152),    UINT8_MAX, UINT8_C(105),
+      UINT8_C( 86), UINT8_C(217), UINT8_C(163), UINT8_C(124), UINT8_C( 93), UINT8_C( 43), UINT8_C(100), UINT8_C( 76),
+      UINT8_C(234), UINT8_C( 22), UINT8_C(213), UINT8_C(  8), UINT8_C( 27), UINT8_C( 14), UINT8_C( 35), UINT8_C(204),
+      UINT8_C(137), UINT8_C( 27), UINT8_C(  1), UINT8_C(203), UINT8_C(131), UINT8_C( 76), UINT8_C(123), UINT8_C(186),
+      UINT8_C(207), UINT8_C( 30), UINT8_C(210), UINT8_C(119), UINT8_C(183), UINT8_C(210), UINT8_C(224), UINT8_C( 13),
+      UINT8_C(171), UINT8_C(131), UINT8_C(137), UINT8_C(  9), UINT8_C(174), UINT8_C(237), UINT8_C( 85), UINT8_C(152),
+      UINT8_C(  4), UINT8_C( 42), UINT8_C(161), UINT8_C( 31), UINT8_C( 56), UINT8_C(196), UINT8_C(235), UINT8_C(194),
+      UINT8_C(223), UINT8_C(237), UINT8_C(141), UINT8_C( 98), UINT8_C( 57), UINT8_C(  8), UINT8_C( 28), UINT8_C(  8),
+      UINT8_C( 39), UINT8_C(239), UINT8_C(127), UINT8_C(222), UINT8_C(193), UINT8_C( 95), UINT8_C(235), UINT8_C(108),
+      UINT8_C(226), UINT8_C(117), UINT8_C(117), UINT8_C(144), UINT8_C( 98), UINT8_C(203), UINT8_C( 41), UINT8_C(102),
+      UINT8_C(245), UINT8_C(202), UINT8_C(134), UINT8_C( 46), UINT8_C(142), UINT8_C(113), UINT8_C(240), UINT8_C(109),
+      UINT8_C( 94), UINT8_C(125), UINT8_C(208), UINT8_C(151), UINT8_C(134), UINT8_C(236), UINT8_C(160), UINT8_C(173),
+      UINT8_C(219), UINT8_C( 31), UINT8_C(139), UINT8_C(156), UINT8_C(127), UINT8_C(118), UINT8_C(  9), UINT8_C( 97),
+      UINT8_C(235), UINT8_C(126), UINT8_C(242), UINT8_C( 78), UINT8_C( 73), UINT8_C( 27), UINT8_C(180), UINT8_C( 63),
+      UINT8_C(229), UINT8_C( 58), UINT8_C(109), UINT8_C(115), UINT8_C(172), UINT8_C( 93), UINT8_C(224), UINT8_C( 10),
+      UINT8_C(218), UINT8_C(176), UINT8_C(162), UINT8_C( 96), UINT8_C(157), UINT8_C( 66), UINT8_C( 13), UINT8_C(120),
+      UINT8_C( 97), UINT8_C(152), UINT8_C( 21), UINT8_C(224), UINT8_C( 15), UINT8_C( 30), UINT8_C( 66), UINT8_C(250),
+      UINT8_C(156), UINT8_C( 52), UINT8_C( 72), UINT8_C(230), UINT8_C( 79), UINT8_C(253), UINT8_C( 37), UINT8_C( 52),
+      UINT8_C( 55), UINT8_C(146), UINT8_C(167), UINT8_C(227), UINT8_C(239), UINT8_C(135), UINT8_C(238), UINT8_C(201),
+      UINT8_C( 56), UINT8_C(144), UINT8_C( 42), UINT8_C(213), UINT8_C(210), UINT8_C( 55), UINT8_C( 77), UINT8_C( 51),
+      UINT8_C(208), UINT8_C( 98), UINT8_C( 20), UINT8_C(223), UINT8_C(128), UINT8_C( 86), UINT8_C(217), UINT8_C( 29),
+      UINT8_C(138), UINT8_C( 34), UINT8_C(  3), UINT8_C(217), UINT8_C( 31), UINT8_C( 40), UINT8_C( 13), UINT8_C( 86),
+      UINT8_C(186), UINT8_C(180), UINT8_C( 58), UINT8_C(169), UINT8_C( 59), UINT8_C( 40), UINT8_C(114), UINT8_C(115),
+      UINT8_C(184), UINT8_C(156), UINT8_C( 72), UINT8_C(138), UINT8_C(212), UINT8_C(150), UINT8_C(189), UINT8_C(164),
+      UINT8_C(248), UINT8_C(209), UINT8_C(131), UINT8_C(121), UINT8_C( 39), UINT8_C( 92), UINT8_C(150), UINT8_C(177),
+      UINT8_C(126), UINT8_C(153), UINT8_C(138), UINT8_C(157), UINT8_C(193), UINT8_C(151), UINT8_C(244), UINT8_C(123),
+      UINT8_C( 75), UINT8_C( 46), UINT8_C( 36), UINT8_C(135), UINT8_C( 86), UINT8_C(150), UINT8_C(250), UINT8_C( 14),
+      UINT8_C( 51), UINT8_C( 67), UINT8_C(152), UINT8_C(  7), UINT8_C(217), UINT8_C( 85), UINT8_C(171), UINT8_C(209),
+      UINT8_C( 39), UINT8_C( 46), UINT8_C( 74), UINT8_C( 78), UINT8_C(138), UINT8_C(224), UINT8_C(  0), UINT8_C(  9),
+      UINT8_C(121), UINT8_C(138), UINT8_C(166), UINT8_C( 58), UINT8_C( 34), UINT8_C(154), UINT8_C(181), UINT8_C(109),
+      UINT8_C(200), UINT8_C(217), UINT8_C(244), UINT8_C( 30), UINT8_C(112), UINT8_C(239), UINT8_C( 44), UINT8_C(163),
+      UINT8_C( 50), UINT8_C(196), UINT8_C(170), UINT8_C( 11), UINT8_C( 26), UINT8_C( 85), UINT8_C(220), UINT8_C( 65),
+      UINT8_C(131), UINT8_C( 39), UINT8_C(143), UINT8_C( 13), UINT8_C(  7), UINT8_C(143), UINT8_C( 22), UINT8_C(129),
+      UINT8_C( 26), UINT8_C(189), UINT8_C(187), UINT8_C( 60), UINT8_C( 87), UINT8_C(113), UINT8_C(169), UINT8_C( 32),
+      UINT8_C( 74), UINT8_C(158), UINT8_C( 62), UINT8_C(186), UINT8_C(141), UINT8_C(107), UINT8_C( 93), UINT8_C(191),
+      UINT8_C( 47), UINT8_C(  7), UINT8_C(202), UINT8_C( 73), UINT8_C( 92), UINT8_C(166), UINT8_C(138), UINT8_C(223),
+      UINT8_C(205), UINT8_C( 26), UINT8_C(237), UINT8_C(213), UINT8_C(169), UINT8_C(  3), UINT8_C( 86), UINT8_C(195),
+      UINT8_C(192), UINT8_C( 17),    UINT8_MAX, UINT8_C( 24), UINT8_C(130), UINT8_C(169), UINT8_C( 56), UINT8_C(205),
+      UINT8_C( 71), UINT8_C(118), UINT8_C(135), UINT8_C(212), UINT8_C(225), UINT8_C(229), UINT8_C(147), UINT8_C( 17),
+      UINT8_C(236), UINT8_C( 93), UINT8_C( 90), UINT8_C( 73), UINT8_C(  3), UINT8_C(229), UINT8_C( 40), UINT8_C(209),
+         UINT8_MAX, UINT8_C( 21), UINT8_C(166), UINT8_C(168), UINT8_C( 25), UINT8_C(252), UINT8_C(108), UINT8_C(217),
+      UINT8_C( 13), UINT8_C(107), UINT8_C(241), UINT8_C(144), UINT8_C( 20), UINT8_C( 41), UINT8_C( 93), UINT8_C( 91),
+      UINT8_C(160), UINT8_C(228), UINT8_C( 47), UINT8_C(129), UINT8_C(201), UINT8_C(194), UINT8_C(146), UINT8_C(182),
+      UINT8_C( 31), UINT8_C(237),    UINT8_MAX, UINT8_C( 35), UINT8_C(210), UINT8_C( 39), UINT8_C(244), UINT8_C(209),
+      UINT8_C( 61), UINT8_C(154), UINT8_C(121), UINT8_C( 86), UINT8_C(150), UINT8_C(229), UINT8_C( 47), UINT8_C(163),
+      UINT8_C( 81), UINT8_C( 33), UINT8_C( 51), UINT8_C(101), UINT8_C( 74), UINT8_C(144), UINT8_C(193), UINT8_C(234),
+      UINT8_C(117), UINT8_C(240), UINT8_C(108), UINT8_C( 62), UINT8_C(179), UINT8_C(254), UINT8_C(244), UINT8_C(210),
+      UINT8_C(235), UINT8_C(243), UINT8_C(245), UINT8_C(189), UINT8_C( 27), UINT8_C(233), UINT8_C(142), UINT8_C( 88),
+      UINT8_C(131), UINT8_C(  8), UINT8_C(174), UINT8_C( 25), UINT8_C(237), UINT8_C(221), UINT8_C(189), UINT8_C( 62),
+      UINT8_C(254), UINT8_C(240), UINT8_C(164), UINT8_C( 73), UINT8_C(129), UINT8_C(101), UINT8_C( 51), UINT8_C(246),
+      UINT8_C( 85), UINT8_C(159), UINT8_C( 52), UINT8_C(  8), UINT8_C(158), UINT8_C( 41), UINT8_C(219), UINT8_C(137),
+      UINT8_C( 28), UINT8_C(208), UINT8_C( 71), UINT8_C( 55), UINT8_C(186), UINT8_C(213), UINT8_C(143), UINT8_C( 61),
+      UINT8_C(221), UINT8_C( 61), UINT8_C( 87), UINT8_C(203), UINT8_C( 27), UINT8_C( 20), UINT8_C(  9), UINT8_C( 25),
+      UINT8_C(  4), UINT8_C(173), UINT8_C( 98), UINT8_C(133), UINT8_C( 18), UINT8_C(150), UINT8_C(123), UINT8_C(104),
+      UINT8_C( 53), UINT8_C(176), UINT8_C(112), UINT8_C(211), UINT8_C(217), UINT8_C( 75), UINT8_C( 93), UINT8_C(245),
+      UINT8_C( 28), UINT8_C(164), UINT8_C( 45), UINT8_C(214), UINT8_C(121), UINT8_C(188), UINT8_C( 19), UINT8_C( 87),
+      UINT8_C(250), UINT8_C(106), UINT8_C( 34), UINT8_C( 21), UINT8_C(126), UINT8_C( 43), UINT8_C( 46), UINT8_C(131),
+      UINT8_C(217), UINT8_C(145), UINT8_C(  8), UINT8_C(235), UINT8_C( 39), UINT8_C(132), UINT8_C( 83), UINT8_C( 92),
+      UINT8_C( 52), UINT8_C(196), UINT8_C( 48), UINT8_C( 13), UINT8_C( 15), UINT8_C(141), UINT8_C(  2), UINT8_C( 43),
+      UINT8_C( 49), UINT8_C( 47), UINT8_C(  1), UINT8_C(170), UINT8_C(236), UINT8_C( 21), UINT8_C(  1), UINT8_C(230),
+      UINT8_C(127), UINT8_C( 35), UINT8_C(251), UINT8_C(254), UINT8_C( 79), UINT8_C( 41), UINT8_C(129), UINT8_C( 40),
+      UINT8_C(186), UINT8_C(137), UINT8_C( 19), UINT8_C(225), UINT8_C( 13), UINT8_C(103), UINT8_C( 62), UINT8_C( 65),
+      UINT8_C( 43), UINT8_C(110), UINT8_C( 78), UINT8_C( 58), UINT8_C(251), UINT8_C( 81), UINT8_C(102), UINT8_C( 44),
+      UINT8_C(128), UINT8_C(103), UINT8_C(214), UINT8_C(108), UINT8_C(124), UINT8_C(216), UINT8_C( 82), UINT8_C(252),
+      UINT8_C(251), UINT8_C( 77), UINT8_C(250), UINT8_C( 74), UINT8_C(119), UINT8_C(123), UINT8_C(114), UINT8_C( 49),
+      UINT8_C(  4), UINT8_C(134), UINT8_C( 19), UINT8_C( 18), UINT8_C(237), UINT8_C( 81), UINT8_C( 83), UINT8_C( 24),
+      UINT8_C(191), UINT8_C(162), UINT8_C( 82), UINT8_C(186), UINT8_C(243), UINT8_C(184), UINT8_C(230), UINT8_C(115),
+      UINT8_C( 32), UINT8_C(188), UINT8_C(224), UINT8_C(156), UINT8_C(148), UINT8_C( 50), UINT8_C(152), UINT8_C(144),
+      UINT8_C(128), UINT8_C(146), UINT8_C(218), UINT8_C(247) };
+  static const uint8_t c[] =
+    {    UINT8_MAX, UINT8_C( 88), UINT8_C(215), UINT8_C(129), UINT8_C(171), UINT8_C( 20), UINT8_C(  8), UINT8_C(210),
+      UINT8_C(136), UINT8_C(145), UINT8_C(167), UINT8_C(127), UINT8_C(116), UINT8_C( 46), UINT8_C( 75), UINT8_C(178),
+      UINT8_C(246), UINT8_C(230), UINT8_C(253), UINT8_C( 38), UINT8_C( 38), UINT8_C(  0), UINT8_C(211), UINT8_C(167),
+      UINT8_C(128), UINT8_C(167), UINT8_C(  1), UINT8_C(  2), UINT8_C(110), UINT8_C(157), UINT8_C(178), UINT8_C(110),
+      UINT8_C(245), UINT8_C(137), UINT8_C(239), UINT8_C(160), UINT8_C(158), UINT8_C(248), UINT8_C(114), UINT8_C( 38),
+      UINT8_C(137), UINT8_C( 26), UINT8_C(166), UINT8_C(253), UINT8_C( 72), UINT8_C(241), UINT8_C(175), UINT8_C( 63),
+      UINT8_C(215), UINT8_C(173), UINT8_C(101), UINT8_C(253), UINT8_C(173), UINT8_C( 56), UINT8_C(164), UINT8_C( 45),
+      UINT8_C(223), UINT8_C(166), UINT8_C( 48), UINT8_C( 78), UINT8_C( 67), UINT8_C(226), UINT8_C(188), UINT8_C( 56),
+      UINT8_C(108), UINT8_C(171), UINT8_C(217), UINT8_C( 10), UINT8_C(163), UINT8_C( 75), UINT8_C( 48), UINT8_C( 44),
+      UINT8_C(101), UINT8_C(214), UINT8_C( 41), UINT8_C(174), UINT8_C(199), UINT8_C(217), UINT8_C(237), UINT8_C(158),
+      UINT8_C(134), UINT8_C( 82), UINT8_C(155), UINT8_C( 51), UINT8_C(139), UINT8_C( 64), UINT8_C( 97), UINT8_C(106),
+      UINT8_C(230), UINT8_C(145), UINT8_C(184), UINT8_C( 41), UINT8_C(115), UINT8_C(116), UINT8_C( 97), UINT8_C(223),
+      UINT8_C( 32), UINT8_C( 58), UINT8_C(233), UINT8_C(195), UINT8_C(134), UINT8_C( 26), UINT8_C(240), UINT8_C(235),
+      UINT8_C(240), UINT8_C( 25), UINT8_C(153), UINT8_C(184), UINT8_C(242), UINT8_C(134), UINT8_C( 86), UINT8_C(120),
+      UINT8_C(217), UINT8_C(242), UINT8_C(172), UINT8_C(100), UINT8_C( 50), UINT8_C( 13), UINT8_C(206), UINT8_C( 24),
+      UINT8_C(158), UINT8_C(135), UINT8_C( 65), UINT8_C( 17), UINT8_C(251), UINT8_C(162), UINT8_C(241), UINT8_C( 27),
+      UINT8_C(221), UINT8_C(218), UINT8_C(223), UINT8_C( 99), UINT8_C(244), UINT8_C(207), UINT8_C( 78), UINT8_C(229),
+      UINT8_C(232), UINT8_C(232), UINT8_C(157), UINT8_C(219), UINT8_C(110), UINT8_C(243), UINT8_C( 83), UINT8_C( 71),
+      UINT8_C(229),    UINT8_MAX, UINT8_C(171), UINT8_C( 23), UINT8_C( 12), UINT8_C(122), UINT8_C( 47), UINT8_C(170),
+      UINT8_C(  1), UINT8_C(112), UINT8_C(188), UINT8_C(252), UINT8_C( 19), UINT8_C(173), UINT8_C( 24), UINT8_C(240),
+      UINT8_C(135), UINT8_C(247), UINT8_C( 83), UINT8_C(124), UINT8_C(198), UINT8_C(161), UINT8_C( 97), UINT8_C(174),
+      UINT8_C(137), UINT8_C(254), UINT8_C(137), UINT8_C(248), UINT8_C(241), UINT8_C(221), UINT8_C( 63), UINT8_C(215),
+      UINT8_C(220), UINT8_C(235), UINT8_C(238), UINT8_C(233), UINT8_C(101), UINT8_C( 30), UINT8_C(147), UINT8_C(102),
+      UINT8_C(142), UINT8_C( 79), UINT8_C( 98), UINT8_C(161), UINT8_C(252), UINT8_C(122), UINT8_C(145), UINT8_C(132),
+      UINT8_C(113), UINT8_C(228), UINT8_C(  0), UINT8_C( 55), UINT8_C(134), UINT8_C( 97), UINT8_C(230), UINT8_C( 15),
+      UINT8_C( 95), UINT8_C(111), UINT8_C(  7), UINT8_C( 80), UINT8_C( 76), UINT8_C( 71), UINT8_C( 39), UINT8_C( 41),
+      UINT8_C( 50), UINT8_C( 22), UINT8_C( 18), UINT8_C(151), UINT8_C( 52), UINT8_C(165), UINT8_C(253), UINT8_C(194),
+      UINT8_C(245), UINT8_C( 95), UINT8_C(100), UINT8_C(241), UINT8_C(218), UINT8_C(245), UINT8_C(117), UINT8_C( 75),
+      UINT8_C(218), UINT8_C(117), UINT8_C(131), UINT8_C( 96), UINT8_C(214), UINT8_C(105), UINT8_C(111), UINT8_C( 53),
+      UINT8_C(216), UINT8_C(119), UINT8_C(134), UINT8_C( 37), UINT8_C(190), UINT8_C(173), UINT8_C( 78), UINT8_C(240),
+      UINT8_C(195), UINT8_C( 96), UINT8_C(135), UINT8_C(247), UINT8_C(  5), UINT8_C(132), UINT8_C(186), UINT8_C(250),
+      UINT8_C(227), UINT8_C( 30), UINT8_C(236), UINT8_C(189), UINT8_C( 19), UINT8_C( 97), UINT8_C(  9), UINT8_C(237),
+      UINT8_C(215), UINT8_C(140), UINT8_C( 77), UINT8_C(173), UINT8_C(245), UINT8_C(189), UINT8_C(227), UINT8_C(205),
+      UINT8_C( 52), UINT8_C(105), UINT8_C(242), UINT8_C(242), UINT8_C( 22), UINT8_C( 64), UINT8_C(226), UINT8_C(218),
+      UINT8_C(160), UINT8_C(105), UINT8_C(209), UINT8_C(166), UINT8_C(237), UINT8_C(139), UINT8_C(160), UINT8_C(208),
+      UINT8_C(169), UINT8_C(140), UINT8_C(142), UINT8_C(189), UINT8_C(238), UINT8_C(151), UINT8_C(170), UINT8_C(197),
+      UINT8_C( 35), UINT8_C(248), UINT8_C(114), UINT8_C( 24), UINT8_C(181), UINT8_C( 85), UINT8_C(229), UINT8_C(233),
+      UINT8_C(190), UINT8_C(216), UINT8_C(219), UINT8_C(213), UINT8_C( 24), UINT8_C(189), UINT8_C(175), UINT8_C(185),
+      UINT8_C( 38), UINT8_C(128), UINT8_C( 95), UINT8_C( 19), UINT8_C( 12),    UINT8_MAX, UINT8_C(227), UINT8_C(181),
+      UINT8_C(140), UINT8_C(113), UINT8_C(114), UINT8_C(122), UINT8_C(  8), UINT8_C( 29), UINT8_C( 63), UINT8_C( 43),
+      UINT8_C( 21), UINT8_C(177), UINT8_C( 67), UINT8_C(202), UINT8_C(  7), UINT8_C( 41), UINT8_C(179), UINT8_C(197),
+      UINT8_C(  1), UINT8_C(142), UINT8_C(154), UINT8_C( 25), UINT8_C( 75), UINT8_C( 73), UINT8_C(210), UINT8_C(113),
+      UINT8_C(202), UINT8_C( 49), UINT8_C(132), UINT8_C(214), UINT8_C( 49), UINT8_C(103), UINT8_C(139), UINT8_C(189),
+      UINT8_C(217), UINT8_C(254), UINT8_C( 55), UINT8_C(225), UINT8_C( 27), UINT8_C(118), UINT8_C( 13), UINT8_C( 48),
+      UINT8_C( 39), UINT8_C( 80), UINT8_C(250), UINT8_C( 46), UINT8_C(121), UINT8_C(173), UINT8_C(244), UINT8_C(122),
+      UINT8_C( 59), UINT8_C(142), UINT8_C(148), UINT8_C(134), UINT8_C(216), UINT8_C(102), UINT8_C(247), UINT8_C(162),
+      UINT8_C(152), UINT8_C(123), UINT8_C(120), UINT8_C(201), UINT8_C(226), UINT8_C(  3), UINT8_C(134), UINT8_C(187),
+      UINT8_C(  1), UINT8_C(189), UINT8_C(157), UINT8_C( 28), UINT8_C( 51), UINT8_C(170), UINT8_C( 76), UINT8_C( 90),
+      UINT8_C(250), UINT8_C( 70), UINT8_C(137), UINT8_C(116), UINT8_C(243), UINT8_C(125), UINT8_C(238), UINT8_C( 46),
+      UINT8_C( 11), UINT8_C(130), UINT8_C(180), UINT8_C(227), UINT8_C(233), UINT8_C(171), UINT8_C(133), UINT8_C(129),
+      UINT8_C( 38), UINT8_C(253), UINT8_C( 74), UINT8_C(  9), UINT8_C(  1), UINT8_C(208), UINT8_C(196), UINT8_C(  2),
+      UINT8_C(141), UINT8_C( 97), UINT8_C( 31), UINT8_C(192), UINT8_C( 11), UINT8_C(107), UINT8_C( 26), UINT8_C(  6),
+      UINT8_C(178), UINT8_C(163), UINT8_C(122), UINT8_C(165), UINT8_C( 32), UINT8_C(104), UINT8_C(212), UINT8_C( 44),
+      UINT8_C(235), UINT8_C(136), UINT8_C( 15), UINT8_C(212), UINT8_C( 52), UINT8_C(149), UINT8_C( 85), UINT8_C( 90),
+      UINT8_C(146), UINT8_C(159), UINT8_C( 99), UINT8_C(147), UINT8_C(111), UINT8_C( 40), UINT8_C(150), UINT8_C(252),
+      UINT8_C(137), UINT8_C(181), UINT8_C(188), UINT8_C(149), UINT8_C( 32), UINT8_C(214), UINT8_C(155), UINT8_C(210),
+      UINT8_C(122), UINT8_C( 21), UINT8_C(120), UINT8_C(154), UINT8_C(125), UINT8_C( 76), UINT8_C(198), UINT8_C(104),
+      UINT8_C(212), UINT8_C(214), UINT8_C( 60), UINT8_C(  8), UINT8_C(107), UINT8_C(145), UINT8_C( 99), UINT8_C(253),
+      UINT8_C( 48), UINT8_C(198), UINT8_C(145), UINT8_C(159), UINT8_C(238), UINT8_C( 39), UINT8_C(155), UINT8_C(120),
+      UINT8_C(220), UINT8_C( 87), UINT8_C( 13), UINT8_C(252), UINT8_C( 46), UINT8_C(168), UINT8_C(207), UINT8_C(168),
+      UINT8_C(189), UINT8_C( 71), UINT8_C( 66), UINT8_C( 58), UINT8_C(147), UINT8_C(  9), UINT8_C(163), UINT8_C(103),
+      UINT8_C(223), UINT8_C(223), UINT8_C(112), UINT8_C( 74), UINT8_C(113), UINT8_C(211), UINT8_C( 71), UINT8_C(161),
+      UINT8_C(153), UINT8_C(216), UINT8_C( 65), UINT8_C(136),    UINT8_MAX, UINT8_C(220), UINT8_C(  0), UINT8_C(219),
+      UINT8_C( 52), UINT8_C( 13), UINT8_C(216), UINT8_C( 98), UINT8_C(181), UINT8_C(167), UINT8_C( 10), UINT8_C(114),
+      UINT8_C(238), UINT8_C( 76), UINT8_C(172), UINT8_C(129), UINT8_C( 85), UINT8_C( 79), UINT8_C(232), UINT8_C( 52),
+      UINT8_C( 47), UINT8_C( 88), UINT8_C(126), UINT8_C(160), UINT8_C( 43), UINT8_C(198), UINT8_C( 65), UINT8_C(197),
+      UINT8_C(158), UINT8_C(130), UINT8_C( 77), UINT8_C(158), UINT8_C( 95), UINT8_C( 77), UINT8_C(121), UINT8_C(147),
+      UINT8_C( 90), UINT8_C( 81), UINT8_C(245), UINT8_C( 15), UINT8_C(248),    UINT8_MAX, UINT8_C(129), UINT8_C(230),
+      UINT8_C( 75), UINT8_C( 45), UINT8_C(103), UINT8_C(161), UINT8_C(125), UINT8_C( 80), UINT8_C(213), UINT8_C(172),
+      UINT8_C(168), UINT8_C( 84), UINT8_C( 76), UINT8_C(212), UINT8_C( 26), UINT8_C(141), UINT8_C(153), UINT8_C(184),
+      UINT8_C( 16), UINT8_C(230), UINT8_C( 86), UINT8_C(111), UINT8_C( 51), UINT8_C(208), UINT8_C(  2), UINT8_C(141),
+      UINT8_C( 33), UINT8_C(247), UINT8_C(156), UINT8_C( 26), UINT8_C(246), UINT8_C( 29), UINT8_C(  0), UINT8_C( 65),
+      UINT8_C( 74), UINT8_C(104), UINT8_C(226), UINT8_C(199), UINT8_C(184), UINT8_C(184), UINT8_C(115), UINT8_C( 96),
+      UINT8_C( 12), UINT8_C(191), UINT8_C( 52), UINT8_C( 38), UINT8_C( 77), UINT8_C(205), UINT8_C(222), UINT8_C( 93),
+      UINT8_C(179), UINT8_C( 53), UINT8_C(204), UINT8_C(230), UINT8_C(  5), UINT8_C(206), UINT8_C(115), UINT8_C( 38),
+      UINT8_C(197), UINT8_C( 15), UINT8_C( 64), UINT8_C(187), UINT8_C( 44), UINT8_C( 65), UINT8_C(252), UINT8_C(119),
+      UINT8_C(169), UINT8_C(223), UINT8_C( 62), UINT8_C( 97), UINT8_C(151), UINT8_C(178), UINT8_C(193), UINT8_C(163),
+      UINT8_C(113), UINT8_C(246), UINT8_C(201), UINT8_C(190), UINT8_C(195), UINT8_C(167), UINT8_C( 27), UINT8_C(119),
+      UINT8_C(220), UINT8_C(231), UINT8_C( 93), UINT8_C(225), UINT8_C(181), UINT8_C(209), UINT8_C(  8), UINT8_C(122),
+      UINT8_C(224), UINT8_C( 72), UINT8_C( 53), UINT8_C( 13) };
+  static const uint32_t e[] =
+    { UINT32_C(2549376678), UINT32_C(2807815454), UINT32_C( 711321991), UINT32_C(1671334861), UINT32_C(1096358666), UINT32_C(3198487807), UINT32_C(3907453537), UINT32_C(2817684167),
+      UINT32_C(3460337534), UINT32_C(3430325909), UINT32_C(3640145896), UINT32_C(1245477843), UINT32_C(3566063937), UINT32_C(2106785714), UINT32_C(3496391344), UINT32_C( 729323297),
+      UINT32_C(2952479133), UINT32_C( 997977834), UINT32_C( 924117039), UINT32_C(2760028006), UINT32_C(2541302304), UINT32_C(3088362835), UINT32_C(2257219104), UINT32_C( 162680010),
+      UINT32_C(  96066159), UINT32_C(1648429994), UINT32_C(2862331703), UINT32_C(2253301983), UINT32_C(1713284296), UINT32_C(1428145326), UINT32_C(2078045560), UINT32_C(1602656824),
+      UINT32_C(1382398519), UINT32_C( 330738888), UINT32_C(2629760491), UINT32_C(2485346437), UINT32_C(2784778846), UINT32_C( 502999649), UINT32_C(1788507972), UINT32_C(2613700145),
+      UINT32_C(3354296600), UINT32_C(3420177190), UINT32_C(1533630655), UINT32_C(2029062011), UINT32_C( 975239199), UINT32_C(3294104151), UINT32_C(1395657292), UINT32_C(1676665704),
+      UINT32_C(4146840794), UINT32_C(1858329432), UINT32_C(1120518057), UINT32_C(2109483337), UINT32_C(2780321626), UINT32_C(3781804585), UINT32_C( 171313487), UINT32_C(3027088499),
+      UINT32_C(2108534963), UINT32_C( 988558395), UINT32_C(1300144152), UINT32_C( 265046526), UINT32_C(  62244450), UINT32_C(2414127303), UINT32_C(1167758517), UINT32_C(1006261196),
+      UINT32_C(1018806441), UINT32_C(2927046317), UINT32_C(3338549642), UINT32_C(1020697551), UINT32_C(3644903816), UINT32_C(1584084414), UINT32_C(2040838720), UINT32_C(2830492512),
+      UINT32_C(1491426785), UINT32_C(1745444830), UINT32_C(2049896679), UINT32_C( 313995163), UINT32_C( 904681612), UINT32_C(1469374039), UINT32_C(1624287001), UINT32_C( 403284999),
+      UINT32_C(4285640829), UINT32_C(2540200784), UINT32_C(1142072406), UINT32_C( 643274907), UINT32_C(3613192079), UINT32_C(3979329076), UINT32_C(4216241673), UINT32_C(1913893495),
+      UINT32_C(2356380592), UINT32_C(1965359051), UINT32_C( 146416213), UINT32_C(3106898991), UINT32_C(3885121943), UINT32_C(2698378693), UINT32_C(1083956834), UINT32_C(3165925431),
+      UINT32_C( 759789743), UINT32_C(1839436751), UINT32_C(2625025665), UINT32_C(3159908123), UINT32_C(2829353652), UINT32_C(1682592251), UINT32_C( 296160027), UINT32_C(3318600456),
+      UINT32_C(2079535698), UINT32_C( 585761873), UINT32_C(1556076677), UINT32_C( 823729718), UINT32_C(2732251282), UINT32_C(3423068173), UINT32_C(2598290296), UINT32_C(2153848412),
+      UINT32_C(1107087289), UINT32_C(3596953885), UINT32_C(1177773831), UINT32_C( 846811851), UINT32_C( 987117616), UINT32_C(2047317574), UINT32_C(2299885892), UINT32_C(1309405359),
+      UINT32_C(2844868524), UINT32_C( 780190974), UINT32_C(1282776753), UINT32_C(  41936491), UINT32_C(2940027319), UINT32_C(2989156269), UINT32_C(3040674882), UINT32_C(1946448463),
+      UINT32_C( 924733501), UINT32_C(2640729699), UINT32_C(1256905609), UINT32_C(  21928544), UINT32_C(3853615078), UINT32_C(4086921775), UINT32_C(3333058377), UINT32_C(1715199711),
+      UINT32_C(3365816404), UINT32_C(1130742303), UINT32_C(2727266896), UINT32_C(1856260862), UINT32_C( 827640762), UINT32_C(1143319281), UINT32_C(3658199716), UINT32_C(3141574705),
+      UINT32_C(2458258102), UINT32_C(3168170361), UINT32_C(3982413762), UINT32_C(2740778506), UINT32_C(2211850936), UINT32_C(1556673302), UINT32_C(1077414910), UINT32_C(3019714756),
+      UINT32_C( 843449117), UINT32_C(2716806497), UINT32_C(3180398311), UINT32_C(2741135910), UINT32_C( 925357115), UINT32_C(4069836802), UINT32_C(3576994940) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svuint8_t
+      bv = simde_svld1_u8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4])),
+      cv = simde_svld1_u8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(c[i * 4]));
+
+    rv = simde_svdot_u32(av, bv, cv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  uint32_t a[1024 / sizeof(uint32_t)], e[1024 / sizeof(uint32_t)];
+  uint8_t b[1024], c[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svuint8_t bv, cv;
+
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4]));
+    cv = simde_svld1_u8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(c[i * 4]));
+
+    ev = simde_svdot_u32(av, bv, cv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len * 4), c);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const uint64_t a[] =
+    { UINT64_C( 1147852703503081349), UINT64_C(14584197052642519225), UINT64_C(  920502335134581317), UINT64_C( 1377741458609558928),
+      UINT64_C(11068097326455841687), UINT64_C( 7416565611964835631), UINT64_C( 7006854250744678961), UINT64_C( 5498639737222200750),
+      UINT64_C( 2266278117751794170), UINT64_C( 2206252463844097303), UINT64_C( 4029187338978406840), UINT64_C(17765227163968332937),
+      UINT64_C(16643972507431362796), UINT64_C( 2543897632567082305), UINT64_C(12803617366188268782), UINT64_C(15090570477861544570),
+      UINT64_C(14019610535078477017), UINT64_C( 6373786899486649830), UINT64_C( 3581065073404158169), UINT64_C(17534786153833013665),
+      UINT64_C(10777724892370175567), UINT64_C(11068540291012526808), UINT64_C(10115451906284022650), UINT64_C( 7781493495026616559),
+      UINT64_C(11292157882939447665), UINT64_C( 8046098501737618255), UINT64_C( 9249550935487694054), UINT64_C( 5589116512864202762),
+      UINT64_C(16753429753392646944), UINT64_C(13917144138999357630), UINT64_C(14985428441498829796), UINT64_C( 2848673030428983391),
+      UINT64_C(15551365026904012112), UINT64_C( 5586907107095726316), UINT64_C( 7639998370928597874), UINT64_C(15017584457045899834),
+      UINT64_C(17082868074471322914), UINT64_C(13621484843928165714), UINT64_C(13964811999661837399), UINT64_C(13854317781505503733),
+      UINT64_C(15766835697727307233), UINT64_C( 1707883235311453098), UINT64_C(10930875811719915627), UINT64_C(  222171864993936822),
+      UINT64_C(14460976072552222798), UINT64_C( 5625122258058888505), UINT64_C( 9679628473156536858), UINT64_C(18360594798455972008),
+      UINT64_C(11738213966299837184), UINT64_C( 3601378970204612040), UINT64_C(15387464213470198325), UINT64_C( 6147532605074924961),
+      UINT64_C( 8082652536641889312), UINT64_C(12053347227156662014), UINT64_C( 1680748063715243089), UINT64_C( 9171221512909877916),
+      UINT64_C( 1294278101861710302), UINT64_C( 8867989170206217209), UINT64_C(10461384695197908385), UINT64_C( 3323314923156707136),
+      UINT64_C( 5955917433472820866), UINT64_C(15952821061779508926), UINT64_C(16938357793515396491), UINT64_C(16084791182404260793),
+      UINT64_C( 6158984301421849806), UINT64_C(10304975932258858473), UINT64_C(15101730740767815422), UINT64_C(10731817078942736051),
+      UINT64_C( 7560475597042574335), UINT64_C(14554666195338733930), UINT64_C(16099813601802587013) };
+  static const uint16_t b[] =
+    { UINT16_C(21687), UINT16_C(58631), UINT16_C(59061), UINT16_C(62668), UINT16_C(59582), UINT16_C(23557), UINT16_C(56653), UINT16_C(23472),
+      UINT16_C( 3909), UINT16_C(15576), UINT16_C(42556), UINT16_C(34556), UINT16_C(10982), UINT16_C(63824), UINT16_C(59001), UINT16_C(12424),
+      UINT16_C(36923), UINT16_C(61462), UINT16_C(57974), UINT16_C(13540), UINT16_C(59850), UINT16_C( 6288), UINT16_C(16838), UINT16_C( 2931),
+      UINT16_C(19280), UINT16_C(35911), UINT16_C(17649), UINT16_C(55058), UINT16_C(25198), UINT16_C(59345), UINT16_C(22856), UINT16_C(33559),
+      UINT16_C(11753), UINT16_C(24435), UINT16_C(22287), UINT16_C(55956), UINT16_C( 9280), UINT16_C( 1778), UINT16_C(25957), UINT16_C(46354),
+      UINT16_C(22960), UINT16_C(41537), UINT16_C(21405), UINT16_C( 2937), UINT16_C(19125), UINT16_C(65266), UINT16_C( 2724), UINT16_C(36225),
+      UINT16_C(62775), UINT16_C(18413), UINT16_C(33100), UINT16_C(36129), UINT16_C( 5029), UINT16_C( 2963), UINT16_C(42360), UINT16_C(10432),
+      UINT16_C(  767), UINT16_C(40138), UINT16_C(17493), UINT16_C( 2984), UINT16_C(39566), UINT16_C(12809), UINT16_C(35492), UINT16_C(56512),
+      UINT16_C(44415), UINT16_C(52259), UINT16_C(17454), UINT16_C(54105), UINT16_C(60503), UINT16_C(53214), UINT16_C(40850), UINT16_C(37367),
+      UINT16_C(49825), UINT16_C(63021), UINT16_C(54534), UINT16_C(37889), UINT16_C( 2672), UINT16_C( 5319), UINT16_C(34709), UINT16_C( 5360),
+      UINT16_C( 4916), UINT16_C(25312), UINT16_C(14679), UINT16_C(44597), UINT16_C( 5158), UINT16_C(47229), UINT16_C(30131), UINT16_C(21577),
+      UINT16_C(30263), UINT16_C(15690), UINT16_C(19532), UINT16_C(48337), UINT16_C(38998), UINT16_C(60368), UINT16_C(49439), UINT16_C(21248),
+      UINT16_C(57556), UINT16_C(11445), UINT16_C(60186), UINT16_C(16602), UINT16_C(22783), UINT16_C(45816), UINT16_C(16845), UINT16_C( 1030),
+      UINT16_C(20663), UINT16_C(  833), UINT16_C( 4764), UINT16_C(62399), UINT16_C(37035), UINT16_C(51934), UINT16_C(56913), UINT16_C( 9502),
+      UINT16_C(54207), UINT16_C(55633), UINT16_C(11454), UINT16_C(48409), UINT16_C( 4484), UINT16_C(20847), UINT16_C(30034), UINT16_C( 2389),
+      UINT16_C(38598), UINT16_C(25101), UINT16_C(52392), UINT16_C(21333), UINT16_C(13404), UINT16_C(44318), UINT16_C(15378), UINT16_C(53715),
+      UINT16_C( 9231), UINT16_C(52906), UINT16_C(50000), UINT16_C(54411), UINT16_C(64468), UINT16_C( 9765), UINT16_C(31344), UINT16_C(13872),
+      UINT16_C(15632), UINT16_C(47513), UINT16_C(60937), UINT16_C(26124), UINT16_C(10786), UINT16_C(13587), UINT16_C(58982), UINT16_C(30214),
+      UINT16_C(45323), UINT16_C(23364), UINT16_C(53108), UINT16_C(18736), UINT16_C(21962), UINT16_C(15215), UINT16_C(40912), UINT16_C(57457),
+      UINT16_C( 2780), UINT16_C(59033), UINT16_C(42745), UINT16_C( 6988), UINT16_C(24528), UINT16_C(14160), UINT16_C(22342), UINT16_C(20909),
+      UINT16_C(61704), UINT16_C(31916), UINT16_C(56512), UINT16_C(35781), UINT16_C(13618), UINT16_C(  710), UINT16_C(14292), UINT16_C(45538),
+      UINT16_C(31810), UINT16_C(15255), UINT16_C(58146), UINT16_C(62038), UINT16_C(42818), UINT16_C(34857), UINT16_C(55038), UINT16_C( 1753),
+      UINT16_C(34503), UINT16_C(34946), UINT16_C(18530), UINT16_C(37907), UINT16_C(55677), UINT16_C(20886), UINT16_C(30992), UINT16_C(20994),
+      UINT16_C(39413), UINT16_C( 6029), UINT16_C(58492), UINT16_C(48905), UINT16_C(13195), UINT16_C(35143), UINT16_C( 8457), UINT16_C(53647),
+      UINT16_C( 4519), UINT16_C( 2393), UINT16_C(27737), UINT16_C(54942), UINT16_C(13381), UINT16_C(21800), UINT16_C(10925), UINT16_C(41640),
+      UINT16_C(13764), UINT16_C(16569), UINT16_C(49945), UINT16_C(42239), UINT16_C(18422), UINT16_C(65325), UINT16_C(48232), UINT16_C( 4048),
+      UINT16_C(10702), UINT16_C(10008), UINT16_C(46741), UINT16_C(56062), UINT16_C( 9963), UINT16_C(38960), UINT16_C(55376), UINT16_C( 5179),
+      UINT16_C(62477), UINT16_C(10069), UINT16_C(21687), UINT16_C(44491), UINT16_C(63899), UINT16_C(  941), UINT16_C(32181), UINT16_C(33554),
+      UINT16_C(11175), UINT16_C(15531), UINT16_C(43489), UINT16_C(52247), UINT16_C(18383), UINT16_C( 8037), UINT16_C(40991), UINT16_C(11316),
+      UINT16_C(35220), UINT16_C(19539), UINT16_C( 8157), UINT16_C(31225), UINT16_C(42520), UINT16_C(52604), UINT16_C(36644), UINT16_C(52049),
+      UINT16_C(64698), UINT16_C(39687), UINT16_C( 7845), UINT16_C(29800), UINT16_C(52581), UINT16_C(33939), UINT16_C(51053), UINT16_C(  433),
+      UINT16_C( 1104), UINT16_C(11853), UINT16_C(18211), UINT16_C(15271), UINT16_C( 9197), UINT16_C( 4361), UINT16_C(23218), UINT16_C(27868),
+      UINT16_C(58454), UINT16_C(64264), UINT16_C(28674), UINT16_C(26735), UINT16_C(  573), UINT16_C(43756), UINT16_C(40394), UINT16_C( 6827),
+      UINT16_C(63906), UINT16_C(50504), UINT16_C(61248), UINT16_C(11521), UINT16_C( 2579), UINT16_C(50495), UINT16_C( 7012), UINT16_C(47666),
+      UINT16_C(15103), UINT16_C(  693), UINT16_C( 9386), UINT16_C(59242), UINT16_C(22054), UINT16_C(61585), UINT16_C(15604), UINT16_C(38411),
+      UINT16_C(21301), UINT16_C(30043), UINT16_C(23619), UINT16_C(22179) };
+  static const uint16_t c[] =
+    { UINT16_C(63055), UINT16_C(62418), UINT16_C(47170), UINT16_C(39676), UINT16_C(11561), UINT16_C( 1606), UINT16_C(56139), UINT16_C(48034),
+      UINT16_C(41405), UINT16_C(62140), UINT16_C( 7063), UINT16_C( 9407), UINT16_C(45171), UINT16_C(29378), UINT16_C(10264), UINT16_C(26563),
+      UINT16_C(38174), UINT16_C(24922), UINT16_C(22349), UINT16_C(30459), UINT16_C(16772), UINT16_C(53116), UINT16_C( 7964), UINT16_C(55691),
+      UINT16_C(18368), UINT16_C(22476), UINT16_C(35682), UINT16_C(54652), UINT16_C(15931), UINT16_C(21319), UINT16_C( 2662), UINT16_C(34235),
+      UINT16_C( 5535), UINT16_C(60646), UINT16_C(57708), UINT16_C(61539), UINT16_C(57122), UINT16_C(16064), UINT16_C(19454), UINT16_C(48919),
+      UINT16_C(58258), UINT16_C(62486), UINT16_C(37486), UINT16_C(43465), UINT16_C( 4305), UINT16_C(14333), UINT16_C(47131), UINT16_C(47804),
+      UINT16_C(41677), UINT16_C(15015), UINT16_C( 2691), UINT16_C(42282), UINT16_C(60137), UINT16_C(59619), UINT16_C(64309), UINT16_C(51111),
+      UINT16_C(48606), UINT16_C(19899), UINT16_C(33872), UINT16_C( 8694), UINT16_C(62357), UINT16_C(45144), UINT16_C( 5547), UINT16_C(31082),
+      UINT16_C( 4535), UINT16_C(15283), UINT16_C(56603), UINT16_C( 1504), UINT16_C(50376), UINT16_C(65005), UINT16_C(38079), UINT16_C(40389),
+      UINT16_C(32849), UINT16_C(41450), UINT16_C(57605), UINT16_C(39618), UINT16_C( 7124), UINT16_C(32842), UINT16_C(46128), UINT16_C(59385),
+      UINT16_C(44230), UINT16_C(57634), UINT16_C(  905), UINT16_C(20966), UINT16_C(54215), UINT16_C(34383), UINT16_C( 5223), UINT16_C(47395),
+      UINT16_C( 3732), UINT16_C(39258), UINT16_C( 7663), UINT16_C(49971), UINT16_C(32056), UINT16_C(26691), UINT16_C(15410), UINT16_C(63567),
+      UINT16_C(29416), UINT16_C(29401), UINT16_C(49269), UINT16_C(15555), UINT16_C( 4755), UINT16_C(64450), UINT16_C(58662), UINT16_C(48052),
+      UINT16_C( 3827), UINT16_C(57940), UINT16_C(34859), UINT16_C(25510), UINT16_C(59653), UINT16_C(14283), UINT16_C( 6950), UINT16_C( 3631),
+      UINT16_C( 2445), UINT16_C(  640), UINT16_C(17609), UINT16_C(23614), UINT16_C(   86), UINT16_C(32087), UINT16_C( 3045), UINT16_C(55608),
+      UINT16_C(35866), UINT16_C(17851), UINT16_C(24852), UINT16_C( 6825), UINT16_C(29771), UINT16_C(29009), UINT16_C(33167), UINT16_C( 7295),
+      UINT16_C(  138), UINT16_C(21278), UINT16_C(23620), UINT16_C(39599), UINT16_C( 1884), UINT16_C(16919), UINT16_C(20242), UINT16_C(11291),
+      UINT16_C(55004), UINT16_C(61554), UINT16_C( 6968), UINT16_C(33546), UINT16_C(23695), UINT16_C( 8180), UINT16_C(29661), UINT16_C(26427),
+      UINT16_C(23155), UINT16_C(47034), UINT16_C(27062), UINT16_C( 4946), UINT16_C(26992), UINT16_C(33621), UINT16_C(28857), UINT16_C(38319),
+      UINT16_C( 8518), UINT16_C(32389), UINT16_C(36924), UINT16_C(52225), UINT16_C(62956), UINT16_C(51691), UINT16_C( 9833), UINT16_C(56368),
+      UINT16_C(60032), UINT16_C(14228), UINT16_C(58963), UINT16_C(50250), UINT16_C(40783), UINT16_C( 2119), UINT16_C(62991), UINT16_C(21917),
+      UINT16_C( 8984), UINT16_C(21716), UINT16_C(54707), UINT16_C(40736), UINT16_C( 3019), UINT16_C(13416), UINT16_C(38962), UINT16_C(45584),
+      UINT16_C(42114), UINT16_C(54761), UINT16_C(13194), UINT16_C(55961), UINT16_C(57554), UINT16_C(57826), UINT16_C(32983), UINT16_C(61239),
+      UINT16_C( 2979), UINT16_C(22083), UINT16_C(25824), UINT16_C(44021), UINT16_C(23919), UINT16_C(41439), UINT16_C(61685), UINT16_C(30548),
+      UINT16_C(15764), UINT16_C( 8012), UINT16_C(58993), UINT16_C(17401), UINT16_C(56262), UINT16_C(40229), UINT16_C(23643), UINT16_C(65164),
+      UINT16_C(53351), UINT16_C(18260), UINT16_C(18740), UINT16_C(41971), UINT16_C(53926), UINT16_C(39749), UINT16_C(39362), UINT16_C(22290),
+      UINT16_C(24534), UINT16_C(18294), UINT16_C(28485), UINT16_C( 2955), UINT16_C(45130), UINT16_C(42665), UINT16_C(13580), UINT16_C(29604),
+      UINT16_C(63749), UINT16_C(14778), UINT16_C(44354), UINT16_C(59869), UINT16_C( 8832), UINT16_C(17028), UINT16_C(38843), UINT16_C(37273),
+      UINT16_C( 4086), UINT16_C(15321), UINT16_C(25726), UINT16_C(51526), UINT16_C(61204), UINT16_C( 8303), UINT16_C( 4901), UINT16_C(10899),
+      UINT16_C(19724), UINT16_C(20324), UINT16_C(16891), UINT16_C(31544), UINT16_C(48227), UINT16_C( 7869), UINT16_C(22355), UINT16_C(18863),
+      UINT16_C(34918), UINT16_C(58756), UINT16_C(52204), UINT16_C(  174), UINT16_C( 7610), UINT16_C(57120), UINT16_C(45872), UINT16_C(15626),
+      UINT16_C(28161), UINT16_C(64652), UINT16_C(50351), UINT16_C( 4727), UINT16_C(13440), UINT16_C(54320), UINT16_C(57227), UINT16_C(61981),
+      UINT16_C(41576), UINT16_C(21719), UINT16_C(34157), UINT16_C(10069), UINT16_C(30114), UINT16_C(53767), UINT16_C( 4393), UINT16_C(10767),
+      UINT16_C(39807), UINT16_C(11814), UINT16_C(40287), UINT16_C(57408), UINT16_C(28881), UINT16_C(23988), UINT16_C(53583), UINT16_C(46927),
+      UINT16_C( 9843), UINT16_C(57356), UINT16_C(25003), UINT16_C(19720), UINT16_C( 4054), UINT16_C(65311), UINT16_C(12064), UINT16_C(40745),
+      UINT16_C(20426), UINT16_C(10957), UINT16_C( 3564), UINT16_C(48650) };
+  static const uint64_t e[] =
+    { UINT64_C( 1147852713802507830), UINT64_C(14584197057677076084), UINT64_C(  920502336889967422), UINT64_C( 1377741461916253298),
+      UINT64_C(11068097331105172039), UINT64_C( 7416565613599961392), UINT64_C( 7006854255544731071), UINT64_C( 5498639740098541180),
+      UINT64_C( 2266278124028346515), UINT64_C( 2206252467175310059), UINT64_C( 4029187343841536037), UINT64_C(17765227166846208384),
+      UINT64_C(16643972511940786144), UINT64_C( 2543897636303481567), UINT64_C(12803617367642721438), UINT64_C(15090570482860391236),
+      UINT64_C(14019610537147896021), UINT64_C( 6373786909058467941), UINT64_C( 3581065082295597516), UINT64_C(17534786155946095943),
+      UINT64_C(10777724894994747252), UINT64_C(11068540294096058613), UINT64_C(10115451909578044129), UINT64_C( 7781493500000545341),
+      UINT64_C(11292157888192557550), UINT64_C( 8046098505836447570), UINT64_C( 9249550937372902141), UINT64_C( 5589116516245272051),
+      UINT64_C(16753429754905611791), UINT64_C(13917144139892961985), UINT64_C(14985428444778907324), UINT64_C( 2848673033015547788),
+      UINT64_C(15551365031366641047), UINT64_C( 5586907108173492063), UINT64_C( 7639998376014000324), UINT64_C(15017584459960546244),
+      UINT64_C(17082868078149556307), UINT64_C(13621484848414799900), UINT64_C(13964812003540801956), UINT64_C(13854317785179920459),
+      UINT64_C(15766835707015734915), UINT64_C( 1707883237766664200), UINT64_C(10930875818045147437), UINT64_C(  222171867815145184),
+      UINT64_C(14460976078284758493), UINT64_C( 5625122264778937101), UINT64_C( 9679628477070431005), UINT64_C(18360594802388352591),
+      UINT64_C(11738213968982581999), UINT64_C( 3601378974806174797), UINT64_C(15387464217215853798), UINT64_C( 6147532610653691062),
+      UINT64_C( 8082652538584619127), UINT64_C(12053347230173845800), UINT64_C( 1680748071472425921), UINT64_C( 9171221515990922057),
+      UINT64_C( 1294278105956198739), UINT64_C( 8867989171722291527), UINT64_C(10461384697412439588), UINT64_C( 3323314927422236959),
+      UINT64_C( 5955917438478520582), UINT64_C(15952821066466915290), UINT64_C(16938357795301934469), UINT64_C(16084791185820740987),
+      UINT64_C( 6158984306496495659), UINT64_C(10304975934879699798), UINT64_C(15101730747037271564), UINT64_C(10731817082841040588),
+      UINT64_C( 7560475598633911270), UINT64_C(14554666201203621632), UINT64_C(16099813603730048856) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svuint16_t
+      bv = simde_svld1_u16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4])),
+      cv = simde_svld1_u16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(c[i * 4]));
+
+    rv = simde_svdot_u64(av, bv, cv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  uint64_t a[1024 / sizeof(uint64_t)], e[1024 / sizeof(uint64_t)];
+  uint16_t b[1024 / sizeof(uint16_t)], c[1024 / sizeof(uint16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svuint16_t bv, cv;
+
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4]));
+    cv = simde_svld1_u16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(c[i * 4]));
+
+    ev = simde_svdot_u64(av, bv, cv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len * 4), c);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t a[] =
+    { -INT32_C(   392762526),  INT32_C(  2071771277), -INT32_C(  1528311697),  INT32_C(    21440820), -INT32_C(   257196426),  INT32_C(  1237387162),  INT32_C(   437577216),  INT32_C(   657088453),
+      -INT32_C(   686833590), -INT32_C(   414020488), -INT32_C(  1869924004), -INT32_C(   661531806), -INT32_C(   339198895),  INT32_C(  1127516483),  INT32_C(   878528623), -INT32_C(   245659737),
+      -INT32_C(  1077384377),  INT32_C(  1403394807), -INT32_C(  1243401645),  INT32_C(  1452111109), -INT32_C(   180267599),  INT32_C(  1312323039),  INT32_C(  1703122622),  INT32_C(  1700257309),
+       INT32_C(  1076109129), -INT32_C(  1919694022),  INT32_C(    37976061), -INT32_C(  1655123732),  INT32_C(    93493542), -INT32_C(   866923762),  INT32_C(  2117260897), -INT32_C(    18642507),
+      -INT32_C(   499185496), -INT32_C(   797912365),  INT32_C(   903000905), -INT32_C(  1445778813), -INT32_C(   777099837), -INT32_C(  1851915728), -INT32_C(  1928277800),  INT32_C(    26014553),
+      -INT32_C(   823866373), -INT32_C(   409054051), -INT32_C(  1977847801),  INT32_C(  1563750298), -INT32_C(  2060459435), -INT32_C(  1122513436), -INT32_C(   162912355),  INT32_C(   385340954),
+       INT32_C(  1071963041),  INT32_C(   908493615), -INT32_C(  1899937037), -INT32_C(  2014579406), -INT32_C(  1140057385), -INT32_C(  2072435737),  INT32_C(  1702544202),  INT32_C(   997946010),
+       INT32_C(  2105171789), -INT32_C(   692870942),  INT32_C(   358905059),  INT32_C(  1100762985),  INT32_C(  1375578218),  INT32_C(   383153868), -INT32_C(   746893255),  INT32_C(   269481666),
+       INT32_C(   948799830),  INT32_C(   219037738),  INT32_C(   505574069),  INT32_C(   744472258),  INT32_C(   847076454),  INT32_C(   206132178),  INT32_C(  1725940900),  INT32_C(   293007035),
+      -INT32_C(  1572273288), -INT32_C(   105949116), -INT32_C(  1944596022), -INT32_C(   172460145), -INT32_C(  1507313965),  INT32_C(   766669193), -INT32_C(   258698955), -INT32_C(   134149504),
+       INT32_C(  1385843470),  INT32_C(  1833650595), -INT32_C(  1443208678), -INT32_C(  1382108455),  INT32_C(  1918093032),  INT32_C(  1839138103),  INT32_C(   375206806),  INT32_C(  1276010302),
+       INT32_C(  1302243498),  INT32_C(   196798961),  INT32_C(   632599627),  INT32_C(  1339183975),  INT32_C(  1371612441), -INT32_C(  1061265110), -INT32_C(   757654636),  INT32_C(   606004602),
+       INT32_C(  2138160270), -INT32_C(   242537307),  INT32_C(  1192640480), -INT32_C(  1399330670),  INT32_C(   939350029),  INT32_C(  1324858297),  INT32_C(  1361104598),  INT32_C(  1114980276),
+      -INT32_C(  1581127685), -INT32_C(   208516077),  INT32_C(   507226252), -INT32_C(  1647652208), -INT32_C(   455817430),  INT32_C(  1496501122),  INT32_C(  1319785114), -INT32_C(  1919934575),
+       INT32_C(   422465798),  INT32_C(   705544350), -INT32_C(   129480600),  INT32_C(  1150620442),  INT32_C(  1562929626), -INT32_C(   826910156),  INT32_C(  1042047149), -INT32_C(  2033472385),
+      -INT32_C(  1667237378),  INT32_C(   566668473),  INT32_C(   236523252), -INT32_C(    61624799),  INT32_C(  1280932631), -INT32_C(  2095444010), -INT32_C(   289327249), -INT32_C(   512455197),
+       INT32_C(  1081939078), -INT32_C(  1251916864),  INT32_C(  1942190930),  INT32_C(  1097799209),  INT32_C(  1754122386),  INT32_C(  1189849047), -INT32_C(  1036669730), -INT32_C(  1063016135),
+       INT32_C(  2113937853), -INT32_C(  1238146716),  INT32_C(   103479004), -INT32_C(  1622697715),  INT32_C(   956814434),  INT32_C(  1518400123), -INT32_C(   669207138),  INT32_C(   479772510),
+       INT32_C(  1167759584), -INT32_C(   688140807), -INT32_C(   790878781),  INT32_C(   560931775),  INT32_C(  1918531319),  INT32_C(   130865768), -INT32_C(   287315825), -INT32_C(  2012579928),
+       INT32_C(   147694607),  INT32_C(   887015793) };
+  static const int8_t b[] =
+    { -INT8_C(  43),  INT8_C(  75),  INT8_C(  89), -INT8_C(  25),  INT8_C( 103), -INT8_C(  64),  INT8_C(  18), -INT8_C(  24),
+      -INT8_C(  13),  INT8_C(  40), -INT8_C(  22), -INT8_C(  76), -INT8_C(  32), -INT8_C(  16),  INT8_C(  84), -INT8_C(  87),
+       INT8_C(  91), -INT8_C(  94), -INT8_C( 124),  INT8_C(  28), -INT8_C(  82), -INT8_C( 106), -INT8_C(  86),  INT8_C(  13),
+      -INT8_C( 124), -INT8_C(   5),  INT8_C( 112), -INT8_C(   4), -INT8_C(   4), -INT8_C(   9), -INT8_C(  56), -INT8_C(  46),
+       INT8_C(  66),  INT8_C(  33), -INT8_C(  71), -INT8_C(  87), -INT8_C(  31), -INT8_C(  53), -INT8_C( 111), -INT8_C(  43),
+      -INT8_C(  13),  INT8_C( 123), -INT8_C( 119), -INT8_C(  45),  INT8_C( 108), -INT8_C(  35),  INT8_C( 125), -INT8_C(  57),
+           INT8_MAX,  INT8_C(   1), -INT8_C(  29),  INT8_C(  45), -INT8_C( 105), -INT8_C( 115),  INT8_C(  58),  INT8_C(  27),
+      -INT8_C( 120), -INT8_C(  86),  INT8_C(  24), -INT8_C( 124), -INT8_C(  95), -INT8_C(  32),  INT8_C(  86), -INT8_C(  29),
+       INT8_C(   2),  INT8_C(  15), -INT8_C( 116), -INT8_C(  29), -INT8_C(  38),  INT8_C(  30), -INT8_C(  72), -INT8_C(  51),
+      -INT8_C( 103),  INT8_C(  65), -INT8_C(  95),  INT8_C(   5),  INT8_C(  30),  INT8_C(  30), -INT8_C(  52), -INT8_C(  99),
+       INT8_C(  31), -INT8_C(  81), -INT8_C(  54), -INT8_C(  74),  INT8_C(  60),  INT8_C(   5), -INT8_C(  46), -INT8_C(  60),
+      -INT8_C(  81), -INT8_C(  22),  INT8_C(  73),  INT8_C(  81), -INT8_C(  54), -INT8_C(  97),  INT8_C(  52), -INT8_C(  52),
+      -INT8_C(  81), -INT8_C(  63), -INT8_C(  80), -INT8_C( 119), -INT8_C(  33),  INT8_C( 104),  INT8_C(  87),  INT8_C( 120),
+      -INT8_C(  86), -INT8_C(   8),  INT8_C( 126), -INT8_C(  56),  INT8_C(  22),  INT8_C(  74),  INT8_C( 102),  INT8_C(  53),
+      -INT8_C(   6),  INT8_C(  48), -INT8_C(  21),  INT8_C(  54),  INT8_C(  53), -INT8_C(  67), -INT8_C(   5), -INT8_C(  27),
+      -INT8_C(  89),  INT8_C(  68),  INT8_C(  54),  INT8_C( 114), -INT8_C(  29),  INT8_C( 106),  INT8_C(  62), -INT8_C( 110),
+       INT8_C(  43), -INT8_C(  18),  INT8_C(  28),  INT8_C(  10),  INT8_C(  87),  INT8_C( 115), -INT8_C( 125),  INT8_C(   1),
+       INT8_C( 107),  INT8_C(   1), -INT8_C(  55), -INT8_C( 127),  INT8_C(  75),  INT8_C(  47), -INT8_C(  74),  INT8_C(  69),
+       INT8_C(  96), -INT8_C(  95),  INT8_C( 124), -INT8_C( 107),  INT8_C(  95),  INT8_C( 119),  INT8_C( 122),  INT8_C(   6),
+      -INT8_C(  69), -INT8_C(  80),  INT8_C( 120), -INT8_C(  98),  INT8_C(  27), -INT8_C(  73),  INT8_C(  49),  INT8_C(  70),
+      -INT8_C(  91),  INT8_C(  77),  INT8_C(  81), -INT8_C(   4), -INT8_C(  64), -INT8_C(  44), -INT8_C(   3),  INT8_C(  43),
+      -INT8_C(  43), -INT8_C(  57), -INT8_C(  84),  INT8_C(  32), -INT8_C(  10),  INT8_C(  98),  INT8_C( 102),  INT8_C(  86),
+       INT8_C(   3), -INT8_C(  30), -INT8_C(  20),  INT8_C(  98),  INT8_C(  89),  INT8_C( 102),  INT8_C( 105),  INT8_C(  20),
+       INT8_C(  23), -INT8_C(  31), -INT8_C(  78),  INT8_C(  50), -INT8_C( 104), -INT8_C(  29),  INT8_C( 120),  INT8_C(  62),
+       INT8_C(  48), -INT8_C(  55),  INT8_C(  58), -INT8_C(  16), -INT8_C(  99),  INT8_C(  56),  INT8_C(  27),  INT8_C( 114),
+      -INT8_C(   1), -INT8_C(  57), -INT8_C( 109), -INT8_C(  11),  INT8_C(  41), -INT8_C(   7),  INT8_C(  76),  INT8_C(  45),
+      -INT8_C(  37),  INT8_C(  56), -INT8_C( 113),  INT8_C(  52), -INT8_C(  98), -INT8_C(   8),  INT8_C(  72), -INT8_C(  75),
+      -INT8_C(  38), -INT8_C(   6), -INT8_C(  25),  INT8_C( 114), -INT8_C(  34),  INT8_C(  96), -INT8_C(  80),  INT8_C(  14),
+       INT8_C(  41), -INT8_C(  21), -INT8_C(   1), -INT8_C(  57),  INT8_C(  35),  INT8_C(  26),  INT8_C(  57),  INT8_C(  34),
+      -INT8_C(  30), -INT8_C(  52),  INT8_C(  23),  INT8_C(  11), -INT8_C(  59),  INT8_C(  99),  INT8_C(  56), -INT8_C(  96),
+      -INT8_C( 101), -INT8_C(  56), -INT8_C(  44),  INT8_C(  58), -INT8_C(  64),  INT8_C(  28), -INT8_C(  17), -INT8_C( 102),
+       INT8_C(  23), -INT8_C(  41),  INT8_C(  13), -INT8_C(  11),  INT8_C(  55), -INT8_C(  67),  INT8_C(   3),  INT8_C(  96),
+      -INT8_C(  88),  INT8_C(   2),  INT8_C(  39), -INT8_C(  53),  INT8_C(  29),  INT8_C(  97), -INT8_C(  19), -INT8_C(   1),
+       INT8_C(  45),  INT8_C(   5),  INT8_C(  10), -INT8_C(  13),  INT8_C( 104),  INT8_C(  67), -INT8_C( 109),  INT8_C(   4),
+       INT8_C(  11),  INT8_C( 104),  INT8_C(  62), -INT8_C(  53), -INT8_C( 124),  INT8_C(  45),  INT8_C( 102), -INT8_C( 101),
+       INT8_C(   4),  INT8_C( 115), -INT8_C( 112),  INT8_C(  59),  INT8_C(  48), -INT8_C( 108), -INT8_C( 100), -INT8_C(  39),
+      -INT8_C( 106), -INT8_C(  61), -INT8_C(  92), -INT8_C(  77),  INT8_C(  36), -INT8_C( 110), -INT8_C(  78),  INT8_C(  82),
+      -INT8_C( 105), -INT8_C(  67),  INT8_C(  69), -INT8_C(   1),  INT8_C(   0), -INT8_C(  40),  INT8_C(   3),  INT8_C(  11),
+       INT8_C(  64),  INT8_C(  65), -INT8_C(  42), -INT8_C(  59),  INT8_C( 111),  INT8_C(  60),  INT8_C(  96),  INT8_C( 115),
+      -INT8_C(  81), -INT8_C(  15), -INT8_C(  81), -INT8_C(  32), -INT8_C( 123),  INT8_C(  75), -INT8_C(  71),  INT8_C(  27),
+       INT8_C(  14),  INT8_C(  93), -INT8_C(  49),  INT8_C(  51), -INT8_C(  17), -INT8_C( 127), -INT8_C( 123), -INT8_C( 122),
+       INT8_C(  62), -INT8_C(  54), -INT8_C( 122),  INT8_C(  62), -INT8_C(  94), -INT8_C( 119),  INT8_C(  73), -INT8_C(  29),
+      -INT8_C(  53),  INT8_C(  32), -INT8_C(  88),  INT8_C(  58),  INT8_C(  92),  INT8_C(   8), -INT8_C(  83),  INT8_C(  12),
+      -INT8_C(   7),  INT8_C(  92), -INT8_C(  20),  INT8_C( 126), -INT8_C(  89), -INT8_C(  91), -INT8_C( 102), -INT8_C(  74),
+       INT8_C(   2),  INT8_C( 105), -INT8_C(  23), -INT8_C(  14), -INT8_C(  22),  INT8_C( 110),  INT8_C( 120),  INT8_C(  41),
+       INT8_C(  56), -INT8_C(   2),  INT8_C( 103), -INT8_C(  38), -INT8_C( 120), -INT8_C(  79), -INT8_C(  67),  INT8_C(  83),
+      -INT8_C(  47),  INT8_C( 101), -INT8_C( 115),  INT8_C(  45),  INT8_C( 110),  INT8_C(  58),  INT8_C(  57),  INT8_C( 103),
+      -INT8_C( 105),  INT8_C(  37), -INT8_C(  26),  INT8_C(  62), -INT8_C(  54),      INT8_MIN, -INT8_C(  12), -INT8_C(  51),
+      -INT8_C(  23), -INT8_C(  35), -INT8_C(  65), -INT8_C(  45),  INT8_C(  75),  INT8_C(  55), -INT8_C(   4), -INT8_C( 125),
+       INT8_C(  54),  INT8_C( 100),  INT8_C(  94), -INT8_C(  66),  INT8_C(  21),  INT8_C(  27),  INT8_C(  17), -INT8_C(  26),
+      -INT8_C( 127), -INT8_C(  98),  INT8_C(  19), -INT8_C(  17), -INT8_C(  40),  INT8_C(  77),  INT8_C(  86),  INT8_C( 111),
+       INT8_C( 114),  INT8_C(  60), -INT8_C(  82),  INT8_C(  61), -INT8_C(  68), -INT8_C(  94),  INT8_C(  10), -INT8_C(  91),
+           INT8_MIN, -INT8_C(  55),  INT8_C( 121), -INT8_C(  53),  INT8_C(   0),  INT8_C( 117),  INT8_C(  79),  INT8_C(  54),
+      -INT8_C(  39), -INT8_C(  83), -INT8_C(  12), -INT8_C(  18), -INT8_C(  56),  INT8_C(   5), -INT8_C(  44),  INT8_C(  73),
+      -INT8_C(  93), -INT8_C(  24),  INT8_C(  56),  INT8_C( 124),  INT8_C(  53), -INT8_C( 113), -INT8_C(  21), -INT8_C(  89),
+      -INT8_C(  53), -INT8_C( 103), -INT8_C(  28), -INT8_C( 120),  INT8_C(  60), -INT8_C(  18),  INT8_C(  45), -INT8_C(  68),
+      -INT8_C(  73), -INT8_C(  90), -INT8_C( 121), -INT8_C(  72),  INT8_C(  28), -INT8_C(  42), -INT8_C(  18), -INT8_C(  11),
+      -INT8_C( 125), -INT8_C(  29), -INT8_C(  28),  INT8_C(  76), -INT8_C(  24), -INT8_C(  72), -INT8_C( 107), -INT8_C( 116),
+      -INT8_C(  96), -INT8_C(  50),  INT8_C(   8), -INT8_C(  43),  INT8_C(  93), -INT8_C(  13),  INT8_C( 125),  INT8_C(  40),
+      -INT8_C( 115),  INT8_C(  97), -INT8_C(  80), -INT8_C(  55),  INT8_C(  80), -INT8_C(  34), -INT8_C( 123),  INT8_C(   7),
+      -INT8_C( 124),  INT8_C(  12), -INT8_C(  65), -INT8_C(  96), -INT8_C(  29), -INT8_C(  82), -INT8_C( 106),  INT8_C( 102),
+      -INT8_C( 111),  INT8_C( 122), -INT8_C(  78),  INT8_C( 121),  INT8_C(  50),  INT8_C(  72),  INT8_C(   5), -INT8_C(  45),
+       INT8_C(  22),  INT8_C(  13), -INT8_C(  88),  INT8_C( 115),  INT8_C(   1),  INT8_C(  37), -INT8_C( 101), -INT8_C( 114),
+      -INT8_C( 121),  INT8_C(  76),  INT8_C(  87), -INT8_C(  41),  INT8_C(  42), -INT8_C(  36), -INT8_C(  34), -INT8_C(  82),
+      -INT8_C(  24), -INT8_C(  98),  INT8_C(  79), -INT8_C(  53),  INT8_C(  76), -INT8_C(  27),  INT8_C(  50), -INT8_C(  35),
+       INT8_C(  95), -INT8_C(  28),  INT8_C(  86), -INT8_C( 111),  INT8_C(  44),  INT8_C(  92),  INT8_C( 100),  INT8_C(  66),
+       INT8_C( 105),  INT8_C(  13), -INT8_C(  75),  INT8_C( 106),  INT8_C(  50),  INT8_C(  81), -INT8_C(   8), -INT8_C(  71),
+      -INT8_C(  99),  INT8_C(  79), -INT8_C( 112), -INT8_C(  57),  INT8_C(  43),  INT8_C( 111),  INT8_C( 117),  INT8_C(  20),
+       INT8_C(  13), -INT8_C(  60), -INT8_C(  33),  INT8_C(  89), -INT8_C(  87),  INT8_C(  17),  INT8_C(  54),  INT8_C(   8),
+      -INT8_C(  10), -INT8_C( 116), -INT8_C( 102),  INT8_C(  34), -INT8_C(  24), -INT8_C(   2),  INT8_C( 101),  INT8_C(  82),
+       INT8_C(  11),  INT8_C(  26), -INT8_C(  68),  INT8_C(  62),  INT8_C( 107), -INT8_C(  75), -INT8_C(   9),  INT8_C(   8),
+       INT8_C(   4), -INT8_C( 120), -INT8_C(  49),  INT8_C(  48), -INT8_C(   9),  INT8_C(  69),  INT8_C(  68),  INT8_C(   4),
+       INT8_C(   9),  INT8_C(  35),  INT8_C(  93), -INT8_C(  77),  INT8_C(  53), -INT8_C( 109), -INT8_C(  69),  INT8_C(  43),
+       INT8_C(  31),  INT8_C(  85),  INT8_C(  77),  INT8_C(   8),  INT8_C(  84), -INT8_C(  78),  INT8_C(  90),  INT8_C(  95),
+      -INT8_C(  51),  INT8_C(  22), -INT8_C(  99),  INT8_C(  56), -INT8_C(  53), -INT8_C( 107),  INT8_C(  65), -INT8_C(  48),
+       INT8_C(  29),  INT8_C(  16),  INT8_C(   0),  INT8_C(  20),  INT8_C(  85),  INT8_C(  68),  INT8_C(  24),  INT8_C(  95),
+       INT8_C( 103),  INT8_C( 117),  INT8_C(  18), -INT8_C( 100),  INT8_C(   8), -INT8_C(  51), -INT8_C(  57),  INT8_C(  39) };
+  static const int8_t c =  INT8_C(  30);
+  static const int32_t e[] =
+    { -INT32_C(   392759646),  INT32_C(  2071772267), -INT32_C(  1528313827),  INT32_C(    21439290), -INT32_C(   257199396),  INT32_C(  1237379332),  INT32_C(   437576586),  INT32_C(   657085003),
+      -INT32_C(   686835360), -INT32_C(   414027628), -INT32_C(  1869925624), -INT32_C(   661527576), -INT32_C(   339194575),  INT32_C(  1127512433),  INT32_C(   878519443), -INT32_C(   245661837),
+      -INT32_C(  1077388217),  INT32_C(  1403390877), -INT32_C(  1243405485),  INT32_C(  1452108379), -INT32_C(   180272939),  INT32_C(  1312321809),  INT32_C(  1703124152),  INT32_C(  1700252779),
+       INT32_C(  1076098839), -INT32_C(  1919685682),  INT32_C(    37975341), -INT32_C(  1655116202),  INT32_C(    93495792), -INT32_C(   866925142),  INT32_C(  2117265307), -INT32_C(    18641637),
+      -INT32_C(   499183606), -INT32_C(   797910025),  INT32_C(   902998685), -INT32_C(  1445775303), -INT32_C(   777099297), -INT32_C(  1851905468), -INT32_C(  1928281610),  INT32_C(    26016743),
+      -INT32_C(   823864483), -INT32_C(   409056091), -INT32_C(  1977852361),  INT32_C(  1563758578), -INT32_C(  2060457905), -INT32_C(  1122503956), -INT32_C(   162913435),  INT32_C(   385342424),
+       INT32_C(  1071964091),  INT32_C(   908496555), -INT32_C(  1899942377), -INT32_C(  2014574756), -INT32_C(  1140058645), -INT32_C(  2072439007),  INT32_C(  1702545552),  INT32_C(   997945890),
+       INT32_C(  2105170649), -INT32_C(   692866382),  INT32_C(   358903619),  INT32_C(  1100762985),  INT32_C(  1375573928),  INT32_C(   383149218), -INT32_C(   746893735),  INT32_C(   269484276),
+       INT32_C(   948796830),  INT32_C(   219040918),  INT32_C(   505575479),  INT32_C(   744474238),  INT32_C(   847080174),  INT32_C(   206129838),  INT32_C(  1725942880),  INT32_C(   293001065),
+      -INT32_C(  1572283368), -INT32_C(   105951216), -INT32_C(  1944599142), -INT32_C(   172460925), -INT32_C(  1507313125),  INT32_C(   766680653), -INT32_C(   258705225), -INT32_C(   134152264),
+       INT32_C(  1385846740),  INT32_C(  1833638925), -INT32_C(  1443210238), -INT32_C(  1382113525),  INT32_C(  1918091502),  INT32_C(  1839138973),  INT32_C(   375212536),  INT32_C(  1275999622),
+       INT32_C(  1302245598),  INT32_C(   196806431),  INT32_C(   632603197),  INT32_C(  1339178485),  INT32_C(  1371611961), -INT32_C(  1061255270), -INT32_C(   757655596),  INT32_C(   605997252),
+       INT32_C(  2138155230), -INT32_C(   242537277),  INT32_C(  1192645940), -INT32_C(  1399329500),  INT32_C(   939343339),  INT32_C(  1324865317),  INT32_C(  1361109188),  INT32_C(  1114972986),
+      -INT32_C(  1581131135), -INT32_C(   208508577),  INT32_C(   507221692), -INT32_C(  1647652868), -INT32_C(   455815540),  INT32_C(  1496496022),  INT32_C(  1319775994), -INT32_C(  1919934005),
+       INT32_C(   422455118),  INT32_C(   705543060), -INT32_C(   129483780),  INT32_C(  1150610872),  INT32_C(  1562924196), -INT32_C(   826902806),  INT32_C(  1042042559), -INT32_C(  2033474485),
+      -INT32_C(  1667245568),  INT32_C(   566665023),  INT32_C(   236524872), -INT32_C(    61622339),  INT32_C(  1280934491), -INT32_C(  2095449320), -INT32_C(   289327219), -INT32_C(   512458497),
+       INT32_C(  1081936198), -INT32_C(  1251914944),  INT32_C(  1942192190),  INT32_C(  1097808269),  INT32_C(  1754126856),  INT32_C(  1189850607), -INT32_C(  1036675400), -INT32_C(  1063007405),
+       INT32_C(  2113938123), -INT32_C(  1238146956),  INT32_C(   103473184), -INT32_C(  1622693005),  INT32_C(   956815364),  INT32_C(  1518401053), -INT32_C(   669210648),  INT32_C(   479776470),
+       INT32_C(  1167761384), -INT32_C(   688143267), -INT32_C(   790872751),  INT32_C(   560937505),  INT32_C(  1918529159),  INT32_C(   130861478), -INT32_C(   287313875), -INT32_C(  2012571768),
+       INT32_C(   147698747),  INT32_C(   887013963) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svint8_t bv = simde_svld1_s8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4]));
+
+    rv = simde_svdot_n_s32(av, bv, c);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t a[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int8_t b[1024], c;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  c = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svint8_t bv;
+
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4]));
+
+    ev = simde_svdot_n_s32(av, bv, c);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1i8(1, c);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t a[] =
+    { -INT64_C( 8441486445711165015), -INT64_C( 5259679055362294967),  INT64_C( 3858033758637141237),  INT64_C( 3118992887414720730),
+       INT64_C( 9130053414802056540),  INT64_C( 1688461881768822259), -INT64_C( 3655826739925715253), -INT64_C( 2983180128993634580),
+      -INT64_C( 6794325802478455038), -INT64_C( 4741226140036148231),  INT64_C( 6845208041274248510), -INT64_C(  939169915266640986),
+      -INT64_C( 6562625729703839844),  INT64_C( 5468199035846214961),  INT64_C( 7300471056009834112),  INT64_C( 2284024862031027663),
+      -INT64_C( 1458507971940394125), -INT64_C(  795745750782868836), -INT64_C( 4917024879814479712),  INT64_C( 4176293457674520916),
+       INT64_C( 5957447254327910152),  INT64_C( 5622163240730213788),  INT64_C( 8504608238936648543), -INT64_C( 5352454844197273159),
+      -INT64_C( 4203506442688852062), -INT64_C(  873738371554957854), -INT64_C( 5305444883471823674), -INT64_C( 7986590851462222650),
+      -INT64_C( 6274759176545000964),  INT64_C( 7187489492515209528),  INT64_C(  744971099611922083),  INT64_C( 8419664737918159704),
+      -INT64_C( 8307023292064415415), -INT64_C( 6176943041252102329), -INT64_C( 7609781280686042346), -INT64_C( 3163579126873464021),
+      -INT64_C( 9198995620144893322), -INT64_C( 2577277492425085303),  INT64_C( 5842182631713047870),  INT64_C( 2079552134704394365),
+      -INT64_C( 2055825773257310273), -INT64_C( 4211236703707079444), -INT64_C( 2545848400129965004),  INT64_C( 7856461027702251589),
+       INT64_C( 1782824212220997248),  INT64_C( 1370599377492127929), -INT64_C( 2281609105163598308),  INT64_C( 8994764862287199161),
+      -INT64_C( 3601451342115751743),  INT64_C( 4843079508096372548),  INT64_C( 8418657875953296218),  INT64_C( 3731142622221934671),
+       INT64_C( 8487918819323420391),  INT64_C( 5142775342269258228),  INT64_C( 9196650812682280049),  INT64_C( 1321684630126623921),
+      -INT64_C( 7973946818103969873),  INT64_C( 3451740548475252659), -INT64_C( 1885040992762191065), -INT64_C( 2182170823315906438),
+       INT64_C( 5910158258643060183), -INT64_C( 1876635731318623736), -INT64_C( 4029293065075339012),  INT64_C( 6108891542706789812),
+      -INT64_C( 6063307846042744087), -INT64_C( 6835508049026691968),  INT64_C( 2939696567744028853),  INT64_C( 5104220345973225476),
+      -INT64_C( 1536385625084748449),  INT64_C( 4088226687725608565),  INT64_C( 8667185678212959916), -INT64_C( 8366898466693491136),
+      -INT64_C( 3476713650997251733), -INT64_C( 2227690590883354279), -INT64_C( 7484337886083264203),  INT64_C( 6149691588407008161),
+       INT64_C( 8931460642375460552), -INT64_C( 5121879741622068011), -INT64_C( 2760842670126207554), -INT64_C( 4260406366169537377),
+      -INT64_C( 3782222185831724315),  INT64_C(  428335951217285813),  INT64_C( 8556781945166255022),  INT64_C( 5291412235648787887),
+      -INT64_C( 2113364505641593367), -INT64_C( 1082539278726364755), -INT64_C( 8021870942221822369),  INT64_C( 8478494189581675772),
+       INT64_C( 8650852806830717438), -INT64_C( 7731441179678660223),  INT64_C( 2156791157253376893), -INT64_C( 3520927801656137693),
+      -INT64_C(  404469122278393825), -INT64_C( 5405601345438822350),  INT64_C( 6790302592075482621), -INT64_C(   15145905916364503),
+       INT64_C(    7967946603939241),  INT64_C( 5263127194542529054),  INT64_C( 5098536699272109351), -INT64_C( 6395942709218914723),
+      -INT64_C( 7737493716926388272), -INT64_C( 8190090148874418752), -INT64_C( 4578558410883023343), -INT64_C( 7987913761338050945),
+      -INT64_C( 7679818421228277918),  INT64_C( 6613528675006698962), -INT64_C( 1595962666532554569),  INT64_C( 8361368194147407798),
+      -INT64_C( 2745305685090944645) };
+  static const int16_t b[] =
+    {  INT16_C( 24783), -INT16_C( 14034),  INT16_C( 21289), -INT16_C(    52),  INT16_C( 22942),  INT16_C(  4069), -INT16_C(    49), -INT16_C( 21842),
+       INT16_C( 28095), -INT16_C(  6287),  INT16_C(  9846),  INT16_C(   930),  INT16_C(  3256), -INT16_C( 20049),  INT16_C(  7179), -INT16_C(  9494),
+       INT16_C(  6269), -INT16_C( 22877),  INT16_C( 28523),  INT16_C(  2725), -INT16_C( 30008), -INT16_C( 26855), -INT16_C( 14454),  INT16_C( 18753),
+      -INT16_C( 19916), -INT16_C( 21711), -INT16_C( 11304), -INT16_C( 28498),  INT16_C( 24287), -INT16_C(  5567),  INT16_C( 11130), -INT16_C(  2108),
+       INT16_C( 26435), -INT16_C( 20578),  INT16_C( 17366), -INT16_C( 24903), -INT16_C( 11570),  INT16_C( 22581),  INT16_C( 30618), -INT16_C( 12639),
+      -INT16_C( 11735),  INT16_C(   633),  INT16_C( 10405), -INT16_C( 31598), -INT16_C( 11130),  INT16_C(   110),  INT16_C( 13055),  INT16_C( 17400),
+      -INT16_C( 26983),  INT16_C( 28658), -INT16_C( 21543), -INT16_C( 22771),  INT16_C( 17277),  INT16_C(  6143), -INT16_C( 24134), -INT16_C(  7194),
+       INT16_C( 24435),  INT16_C(  6629),  INT16_C( 30855),  INT16_C(  3485),  INT16_C(  3148),  INT16_C( 19214),  INT16_C(  1598), -INT16_C( 10098),
+      -INT16_C( 32612),  INT16_C( 30023),  INT16_C( 21803), -INT16_C( 22243),  INT16_C(  7320),  INT16_C( 21184), -INT16_C( 22851),  INT16_C( 12597),
+       INT16_C(  6918), -INT16_C( 29366), -INT16_C(  6253), -INT16_C(  8293), -INT16_C( 22029),  INT16_C( 12842), -INT16_C( 18001),  INT16_C( 19210),
+       INT16_C( 20793),  INT16_C( 26048), -INT16_C(  8794),  INT16_C( 15886), -INT16_C( 12550), -INT16_C( 18544), -INT16_C( 14731),  INT16_C( 31720),
+       INT16_C( 13025),  INT16_C( 29704), -INT16_C( 23782),  INT16_C(  3411),  INT16_C( 32076), -INT16_C(  1217),  INT16_C( 18742),  INT16_C( 28742),
+       INT16_C(  1947),  INT16_C( 16853), -INT16_C(  7196), -INT16_C(  8576),  INT16_C(  4273),  INT16_C(  9878),  INT16_C( 32470), -INT16_C( 18527),
+      -INT16_C( 21839), -INT16_C( 13525),  INT16_C( 32333), -INT16_C( 25896),  INT16_C(  6396),  INT16_C( 12949), -INT16_C(  9119), -INT16_C(   862),
+       INT16_C( 30691), -INT16_C( 14530), -INT16_C( 16806),  INT16_C(  3238),  INT16_C( 15566), -INT16_C( 23246), -INT16_C( 11078),  INT16_C( 27484),
+      -INT16_C( 30594), -INT16_C( 13514),  INT16_C(  3846),  INT16_C(   613), -INT16_C(  1241), -INT16_C( 30667), -INT16_C( 10281), -INT16_C( 17787),
+      -INT16_C( 15537), -INT16_C( 22143),  INT16_C( 10113),  INT16_C( 20405), -INT16_C(  6045),  INT16_C(  7924),  INT16_C( 20924),  INT16_C( 14985),
+      -INT16_C( 16167), -INT16_C(  8443),  INT16_C( 27599), -INT16_C(  2334),  INT16_C(  5990),  INT16_C( 15742),  INT16_C(  1006),  INT16_C( 15863),
+       INT16_C( 30918),  INT16_C( 18407), -INT16_C( 25440),  INT16_C(   919), -INT16_C( 29820),  INT16_C( 16417), -INT16_C( 21540), -INT16_C( 19078),
+      -INT16_C( 32661),  INT16_C( 14997),  INT16_C( 30699),  INT16_C( 20784), -INT16_C( 20850),  INT16_C( 31886), -INT16_C( 31310),  INT16_C( 30906),
+      -INT16_C( 24067), -INT16_C( 25152),  INT16_C( 22333), -INT16_C( 15711), -INT16_C( 15646), -INT16_C( 16638),  INT16_C( 32109), -INT16_C( 10124),
+       INT16_C(  2557), -INT16_C(  6126),  INT16_C( 17024),  INT16_C(  3641), -INT16_C( 14351), -INT16_C( 23669),  INT16_C( 17740),  INT16_C( 18715),
+      -INT16_C(  9242),  INT16_C(  9191), -INT16_C( 30670),  INT16_C(  5605), -INT16_C(  6070), -INT16_C( 18220),  INT16_C( 18533),  INT16_C( 25232),
+      -INT16_C( 23726), -INT16_C( 11702), -INT16_C( 31771), -INT16_C( 10527),  INT16_C( 27722), -INT16_C( 27015), -INT16_C( 27215), -INT16_C( 26657),
+      -INT16_C( 14736), -INT16_C( 23622), -INT16_C( 24498), -INT16_C( 26184), -INT16_C( 29560), -INT16_C(  4783), -INT16_C(  7724),  INT16_C(  9807),
+      -INT16_C( 26236),  INT16_C( 27385), -INT16_C(  9700),  INT16_C( 26176), -INT16_C( 17850), -INT16_C(  2052), -INT16_C(  9393), -INT16_C( 16498),
+       INT16_C( 18594), -INT16_C(  3998),  INT16_C(  6888),  INT16_C( 28809), -INT16_C(  9562),  INT16_C( 31581), -INT16_C( 21316),  INT16_C( 16545),
+      -INT16_C( 26043),  INT16_C( 25002), -INT16_C(  5260), -INT16_C( 17721), -INT16_C( 15451), -INT16_C(  2895),  INT16_C( 16287),  INT16_C( 16819),
+       INT16_C(  5768),  INT16_C( 28721), -INT16_C( 17616), -INT16_C( 10271),  INT16_C( 16021),  INT16_C( 20818), -INT16_C(  3093),  INT16_C( 12434),
+       INT16_C( 15502),  INT16_C(   658),  INT16_C( 22823), -INT16_C( 13123),  INT16_C( 28189), -INT16_C( 17216),  INT16_C( 29870),  INT16_C( 14077),
+       INT16_C( 11914), -INT16_C( 17754), -INT16_C( 30743),  INT16_C( 32657), -INT16_C(  7226), -INT16_C( 20016),  INT16_C( 25303),  INT16_C( 26081),
+       INT16_C( 29599), -INT16_C( 14745),  INT16_C(  9421), -INT16_C(  5485),  INT16_C( 21395),  INT16_C( 16806), -INT16_C( 23609),  INT16_C( 20855),
+       INT16_C(  7633), -INT16_C( 17652), -INT16_C( 25179),  INT16_C( 27450),  INT16_C(  2689),  INT16_C( 22556), -INT16_C(   659),  INT16_C(  3261),
+       INT16_C(  9329),  INT16_C( 16082),  INT16_C( 25929), -INT16_C(  9176), -INT16_C( 12615), -INT16_C( 32739), -INT16_C( 27535),  INT16_C( 17106),
+      -INT16_C(  8527),  INT16_C( 22269),  INT16_C( 14203), -INT16_C(   831), -INT16_C(  8894), -INT16_C( 20652),  INT16_C(  4571),  INT16_C( 19643),
+      -INT16_C( 29386),  INT16_C( 32650), -INT16_C( 19725), -INT16_C( 21413),  INT16_C( 30848), -INT16_C(  3796), -INT16_C(   500), -INT16_C( 17101),
+       INT16_C( 12764),  INT16_C( 22548), -INT16_C( 10904), -INT16_C( 21932), -INT16_C( 22093), -INT16_C( 29095),  INT16_C(  5306), -INT16_C(  3878),
+       INT16_C( 25762), -INT16_C( 27281), -INT16_C( 13802), -INT16_C( 27071),  INT16_C( 27970),  INT16_C( 20103), -INT16_C( 17812),  INT16_C( 18444),
+       INT16_C(  8427),  INT16_C( 21664), -INT16_C(  2571), -INT16_C( 22274),  INT16_C( 22686),  INT16_C( 22582),  INT16_C(  4204),  INT16_C(  3657),
+      -INT16_C( 18316), -INT16_C( 30045), -INT16_C(  7037), -INT16_C( 15072), -INT16_C( 22702), -INT16_C( 16876),  INT16_C(  8290),  INT16_C( 19718),
+      -INT16_C( 22720),  INT16_C( 13729), -INT16_C( 24420),  INT16_C( 15070),  INT16_C(  5368),  INT16_C( 25746), -INT16_C(  9435), -INT16_C( 26253),
+       INT16_C(  5780),  INT16_C(  5924),  INT16_C( 17659),  INT16_C( 19932), -INT16_C(  3860),  INT16_C( 19979),  INT16_C(  4368),  INT16_C( 20635),
+       INT16_C( 15800),  INT16_C( 21638),  INT16_C( 25821), -INT16_C( 10866),  INT16_C(  8568), -INT16_C( 25287), -INT16_C( 21252), -INT16_C( 28617),
+       INT16_C( 23491), -INT16_C( 16729), -INT16_C( 31585), -INT16_C( 29941),  INT16_C(  5748), -INT16_C( 31271),  INT16_C( 29991), -INT16_C(  7979),
+       INT16_C( 23474), -INT16_C( 28876), -INT16_C( 15425),  INT16_C( 14436), -INT16_C( 25116), -INT16_C(  7979),  INT16_C(  3146),  INT16_C(  3441),
+       INT16_C(  6247),  INT16_C(  1995), -INT16_C( 10596),  INT16_C(  4498),  INT16_C( 27884),  INT16_C(  5014),  INT16_C( 27617), -INT16_C( 27661),
+       INT16_C( 10439), -INT16_C( 31198), -INT16_C( 30997), -INT16_C( 12354), -INT16_C( 27613),  INT16_C( 28079),  INT16_C(  8352),  INT16_C(  2170),
+       INT16_C( 17721), -INT16_C( 10993), -INT16_C( 24293),  INT16_C(  2022),  INT16_C( 31757), -INT16_C(  4581),  INT16_C(  3816), -INT16_C( 20607),
+      -INT16_C( 23754),  INT16_C(  8501), -INT16_C(  3031),  INT16_C( 19952), -INT16_C( 24440),  INT16_C( 10426),  INT16_C( 13760), -INT16_C(  1744),
+       INT16_C( 16250), -INT16_C( 26929), -INT16_C( 18975), -INT16_C(  4451), -INT16_C( 18382),  INT16_C(  6877),  INT16_C( 24263), -INT16_C(   567),
+      -INT16_C(   510),  INT16_C( 11039),  INT16_C(  4082),  INT16_C( 31352),  INT16_C( 13231),  INT16_C( 28835), -INT16_C( 11416), -INT16_C(  7575),
+       INT16_C( 14355), -INT16_C(  2952),  INT16_C(  5870),  INT16_C(  8418), -INT16_C( 16434), -INT16_C( 27334),  INT16_C(   798),  INT16_C(  8339),
+      -INT16_C( 19967), -INT16_C(  2997), -INT16_C( 15167),  INT16_C( 29038),  INT16_C(  4599),  INT16_C( 24545),  INT16_C( 19173), -INT16_C(  1983),
+      -INT16_C( 17789),  INT16_C( 29164), -INT16_C( 12592), -INT16_C( 24943), -INT16_C( 13426), -INT16_C( 21452), -INT16_C( 14386), -INT16_C( 12340),
+       INT16_C(  6009),  INT16_C( 15043),  INT16_C( 13019), -INT16_C( 11605) };
+  static const int16_t c =  INT16_C(  8591);
+  static const int64_t e[] =
+    { -INT64_C( 8441486445436373289), -INT64_C( 5259679055318309047),  INT64_C( 3858033758917070381),  INT64_C( 3118992887250563902),
+       INT64_C( 9130053414927828780),  INT64_C( 1688461881317244935), -INT64_C( 3655826740625271792), -INT64_C( 2983180128755303058),
+      -INT64_C( 6794325802492887918), -INT64_C( 4741226139787095141),  INT64_C( 6845208040996802165), -INT64_C(  939169915099674901),
+      -INT64_C( 6562625730070151493),  INT64_C( 5468199035778277333),  INT64_C( 7300471056571719876),  INT64_C( 2284024862150116105),
+      -INT64_C( 1458507971966416264), -INT64_C(  795745750626083086), -INT64_C( 4917024880132295166),  INT64_C( 4176293457605981918),
+       INT64_C( 5957447254791248555),  INT64_C( 5622163240609037733),  INT64_C( 8504608239128726121), -INT64_C( 5352454843524228446),
+      -INT64_C( 4203506442662838514), -INT64_C(  873738371313602300), -INT64_C( 5305444883720335531), -INT64_C( 7986590851381776526),
+      -INT64_C( 6274759176522724501),  INT64_C( 7187489492590174594),  INT64_C(  744971099271297524),  INT64_C( 8419664737402905888),
+      -INT64_C( 8307023292125944157), -INT64_C( 6176943040927465621), -INT64_C( 7609781280680415241), -INT64_C( 3163579126541842830),
+      -INT64_C( 9198995619931802158), -INT64_C( 2577277492889179714),  INT64_C( 5842182632003586899),  INT64_C( 2079552134795733877),
+      -INT64_C( 2055825773623261100), -INT64_C( 4211236703795558153), -INT64_C( 2545848399983093268),  INT64_C( 7856461027688806674),
+       INT64_C( 1782824212005225692),  INT64_C( 1370599377659437654), -INT64_C( 2281609105831342374),  INT64_C( 8994764861830458646),
+      -INT64_C( 3601451342880694383),  INT64_C( 4843079507819226888),  INT64_C( 8418657876104712593),  INT64_C( 3731142621828527008),
+       INT64_C( 8487918819755487554),  INT64_C( 5142775342417435796),  INT64_C( 9196650812475907047),  INT64_C( 1321684630253427081),
+      -INT64_C( 7973946818047252091),  INT64_C( 3451740548871985039), -INT64_C( 1885040992540027805), -INT64_C( 2182170822844088718),
+       INT64_C( 5910158258609331917), -INT64_C( 1876635731111219814), -INT64_C( 4029293064913914122),  INT64_C( 6108891543011314989),
+      -INT64_C( 6063307846109307155), -INT64_C( 6835508048787458391),  INT64_C( 2939696568106259777),  INT64_C( 5104220345493993723),
+      -INT64_C( 1536385624851812075),  INT64_C( 4088226687679801353),  INT64_C( 8667185677887584382), -INT64_C( 8366898466612297595),
+      -INT64_C( 3476713650975980417), -INT64_C( 2227690591310842439), -INT64_C( 7484337886447453875),  INT64_C( 6149691588825432816),
+       INT64_C( 8931460642420528938), -INT64_C( 5121879741165636772), -INT64_C( 2760842670731615324), -INT64_C( 4260406366268935247),
+      -INT64_C( 3782222185989291846),  INT64_C(  428335951177990579),  INT64_C( 8556781945589748367),  INT64_C( 5291412236002066989),
+      -INT64_C( 2113364505191485104), -INT64_C( 1082539279298422263), -INT64_C( 8021870942692299893),  INT64_C( 8478494189551512771),
+       INT64_C( 8650852806775812357), -INT64_C( 7731441179906390451),  INT64_C( 2156791157271795997), -INT64_C( 3520927801373888979),
+      -INT64_C(  404469122829162835), -INT64_C( 5405601345344424442),  INT64_C( 6790302591941952708), -INT64_C(   15145905827146968),
+       INT64_C(    7967946618269029),  INT64_C( 5263127194525364236),  INT64_C( 5098536698979113296), -INT64_C( 6395942709114181842),
+      -INT64_C( 7737493716531520139), -INT64_C( 8190090148676181427), -INT64_C( 4578558410662311962), -INT64_C( 7987913761635565866),
+      -INT64_C( 7679818421306395881),  INT64_C( 6613528675404754356), -INT64_C( 1595962666757295129),  INT64_C( 8361368193618167834),
+      -INT64_C( 2745305684897939239) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svint16_t bv = simde_svld1_s16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4]));
+
+    rv = simde_svdot_n_s64(av, bv, c);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t a[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int16_t b[1024 / sizeof(int16_t)], c;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  c = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svint16_t bv;
+
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4]));
+
+    ev = simde_svdot_n_s64(av, bv, c);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1i16(1, c);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const uint32_t a[] =
+    { UINT32_C(1900196310), UINT32_C(4175623685), UINT32_C( 892735975), UINT32_C(1289841531), UINT32_C(  20668731), UINT32_C(2724103602), UINT32_C(2227433153), UINT32_C( 473886534),
+      UINT32_C(2794356897), UINT32_C(1587441783), UINT32_C(4254389377), UINT32_C(2051634495), UINT32_C(2289862102), UINT32_C(3408648714), UINT32_C( 240185032), UINT32_C(2133561054),
+      UINT32_C(2250619151), UINT32_C(2883896105), UINT32_C(3601365143), UINT32_C(3276927469), UINT32_C(2169294198), UINT32_C(1884059559), UINT32_C(1132371045), UINT32_C( 985835819),
+      UINT32_C(2361452386), UINT32_C(1094165674), UINT32_C( 169402141), UINT32_C(1204709840), UINT32_C(3720878646), UINT32_C(4132246673), UINT32_C(3694841009), UINT32_C(3625385077),
+      UINT32_C(2388973284), UINT32_C(2547030906), UINT32_C(1252190330), UINT32_C(2274455633), UINT32_C( 459561354), UINT32_C( 521253486), UINT32_C(4093332350), UINT32_C( 751505736),
+      UINT32_C(1639591911), UINT32_C(1157204682), UINT32_C(3280968562), UINT32_C(2504663051), UINT32_C(3903893370), UINT32_C(3741827425), UINT32_C(1439826445), UINT32_C(4202798611),
+      UINT32_C(2556115917), UINT32_C( 953963718), UINT32_C(4210846703), UINT32_C( 110053004), UINT32_C(1458454517), UINT32_C( 238417153), UINT32_C( 174262519), UINT32_C(1929700518),
+      UINT32_C(3842727711), UINT32_C(2736711860), UINT32_C(3751680595), UINT32_C(1457859936), UINT32_C(1856820077), UINT32_C(3212632776), UINT32_C(2429149162), UINT32_C(3791900099),
+      UINT32_C(3787984685), UINT32_C(1250223863), UINT32_C(1613373952), UINT32_C(3182825296), UINT32_C(2871747555), UINT32_C( 795584325), UINT32_C(1237267590), UINT32_C( 791396866),
+      UINT32_C(3356554193), UINT32_C(3641939161), UINT32_C( 121257399), UINT32_C( 801435724), UINT32_C(2564550483), UINT32_C( 482821782), UINT32_C(2087028346), UINT32_C( 447451209),
+      UINT32_C(1575205764), UINT32_C( 121108048), UINT32_C(2131652915), UINT32_C(3048198753), UINT32_C(1464699585), UINT32_C(1249056208), UINT32_C(3838302363), UINT32_C(3976163944),
+      UINT32_C(2118836782), UINT32_C( 193298904), UINT32_C(1401590770), UINT32_C( 638073189), UINT32_C(2474464963), UINT32_C( 115273835), UINT32_C( 820749768), UINT32_C(1159588375),
+      UINT32_C(2764269516), UINT32_C(3668920552), UINT32_C(1076705755), UINT32_C( 912668275), UINT32_C(4157268876), UINT32_C(2617092307), UINT32_C(1691150413), UINT32_C(2662001106),
+      UINT32_C( 943877456), UINT32_C(2433937846), UINT32_C(2664578859), UINT32_C(  30685301), UINT32_C(4026048028), UINT32_C(2475423302), UINT32_C(2985842654), UINT32_C(2421137984),
+      UINT32_C(3318256143), UINT32_C(2924993155), UINT32_C(2404133145), UINT32_C(2106597729), UINT32_C( 107841983), UINT32_C(1570371711), UINT32_C(2400096591), UINT32_C(1126129203),
+      UINT32_C(1929963504), UINT32_C(3659685825), UINT32_C(3932778120), UINT32_C(1332214415), UINT32_C(  39179395), UINT32_C( 459271884), UINT32_C(3014291072), UINT32_C(3170290124),
+      UINT32_C(1898971056), UINT32_C(3880538462), UINT32_C(1339143616), UINT32_C( 849229999), UINT32_C(3644125965), UINT32_C(1660261602), UINT32_C(3457523458), UINT32_C( 428477545),
+      UINT32_C(1770764555), UINT32_C(3411072779), UINT32_C(1008345484), UINT32_C(1735309658), UINT32_C(2386600876), UINT32_C( 972043575), UINT32_C(1040647893), UINT32_C( 492278034),
+      UINT32_C(1434903114), UINT32_C(1176557497), UINT32_C(1384266744), UINT32_C(2696540404), UINT32_C(3392141971), UINT32_C(  67313455), UINT32_C( 927074853), UINT32_C(3864304283),
+      UINT32_C( 909892476), UINT32_C(2860276914), UINT32_C(2348678807), UINT32_C(2183902958), UINT32_C(3763100336), UINT32_C(2682540154), UINT32_C(4141295450), UINT32_C(1037839297),
+      UINT32_C(3094550278), UINT32_C( 174321523), UINT32_C(3700777197), UINT32_C(3344875798), UINT32_C(2510793243), UINT32_C(1429572602), UINT32_C(1934298290), UINT32_C(1051797303),
+      UINT32_C(3002475582), UINT32_C(  29120788), UINT32_C(3504165561), UINT32_C( 781662995), UINT32_C(3770957542), UINT32_C(2083912137), UINT32_C(1022328837), UINT32_C(3866796199),
+      UINT32_C(3650646469), UINT32_C(2228901066), UINT32_C(3109337254), UINT32_C(3655920627), UINT32_C(4072320041), UINT32_C(2859397029), UINT32_C( 400973424), UINT32_C(3288162814),
+      UINT32_C(2627507666), UINT32_C(2418046954), UINT32_C( 575304751), UINT32_C(2298229343), UINT32_C(2205923038), UINT32_C( 355330469), UINT32_C(1177359175), UINT32_C(1175005812),
+      UINT32_C(2867046080), UINT32_C(1278870301), UINT32_C(3614344312) };
+  static const uint8_t b[] =
+    { UINT8_C(253), UINT8_C( 14), UINT8_C(250), UINT8_C(121), UINT8_C( 35), UINT8_C(153), UINT8_C(233), UINT8_C(164),
+      UINT8_C(173), UINT8_C(254), UINT8_C( 49), UINT8_C(112), UINT8_C( 71), UINT8_C(162), UINT8_C(  8), UINT8_C(242),
+      UINT8_C(240), UINT8_C(100), UINT8_C(224), UINT8_C( 34), UINT8_C(173), UINT8_C( 11), UINT8_C(117), UINT8_C(113),
+      UINT8_C( 80), UINT8_C(236), UINT8_C(100), UINT8_C(174), UINT8_C(128), UINT8_C( 85), UINT8_C(145), UINT8_C(126),
+      UINT8_C( 99), UINT8_C(139), UINT8_C(247), UINT8_C(134), UINT8_C( 36), UINT8_C(225), UINT8_C( 42), UINT8_C(209),
+      UINT8_C(223), UINT8_C( 92), UINT8_C( 66), UINT8_C( 38), UINT8_C(254), UINT8_C( 74), UINT8_C( 24), UINT8_C(238),
+      UINT8_C(175), UINT8_C(248), UINT8_C( 16), UINT8_C( 92), UINT8_C(  3), UINT8_C(133), UINT8_C(205), UINT8_C( 83),
+      UINT8_C(113), UINT8_C( 49), UINT8_C(  1), UINT8_C(242), UINT8_C(134), UINT8_C(146), UINT8_C(112), UINT8_C(233),
+      UINT8_C( 29), UINT8_C(103), UINT8_C(111), UINT8_C( 66), UINT8_C( 72), UINT8_C(153), UINT8_C( 19), UINT8_C( 39),
+      UINT8_C(245), UINT8_C( 85), UINT8_C( 77), UINT8_C(243), UINT8_C(160), UINT8_C(102), UINT8_C(225), UINT8_C( 79),
+      UINT8_C( 94), UINT8_C(242), UINT8_C(171), UINT8_C( 98), UINT8_C(119), UINT8_C(120), UINT8_C(181), UINT8_C(233),
+      UINT8_C(169), UINT8_C(183), UINT8_C(219), UINT8_C( 47), UINT8_C( 73), UINT8_C( 75), UINT8_C( 24), UINT8_C(103),
+      UINT8_C(178), UINT8_C(135), UINT8_C(169), UINT8_C(251), UINT8_C( 32), UINT8_C(188), UINT8_C( 34), UINT8_C( 22),
+      UINT8_C( 18), UINT8_C(112), UINT8_C(  9), UINT8_C(178), UINT8_C(214), UINT8_C(235), UINT8_C(  1), UINT8_C( 52),
+      UINT8_C(221), UINT8_C(172), UINT8_C(150), UINT8_C( 84), UINT8_C( 36), UINT8_C( 76), UINT8_C( 61), UINT8_C(205),
+      UINT8_C(  3), UINT8_C( 24), UINT8_C(252), UINT8_C( 76), UINT8_C( 99), UINT8_C( 20), UINT8_C(179), UINT8_C( 22),
+      UINT8_C(155), UINT8_C( 92), UINT8_C( 17), UINT8_C(187), UINT8_C( 25), UINT8_C( 51), UINT8_C(209), UINT8_C( 43),
+      UINT8_C(163), UINT8_C(219), UINT8_C(221), UINT8_C(121), UINT8_C(198), UINT8_C(222), UINT8_C(174), UINT8_C(163),
+      UINT8_C(138), UINT8_C( 68), UINT8_C(247), UINT8_C(174), UINT8_C(144), UINT8_C( 53), UINT8_C(123), UINT8_C(147),
+      UINT8_C( 77), UINT8_C(119), UINT8_C(224), UINT8_C(177), UINT8_C(139), UINT8_C(147), UINT8_C(199), UINT8_C( 38),
+      UINT8_C(240), UINT8_C(216), UINT8_C(225), UINT8_C(  9), UINT8_C( 11), UINT8_C(179), UINT8_C( 52), UINT8_C(175),
+      UINT8_C(142), UINT8_C( 17), UINT8_C( 40), UINT8_C( 84), UINT8_C(239), UINT8_C(214), UINT8_C(247), UINT8_C(121),
+      UINT8_C( 27), UINT8_C(238), UINT8_C( 39), UINT8_C(171), UINT8_C( 35), UINT8_C(162), UINT8_C( 63), UINT8_C(113),
+      UINT8_C( 25), UINT8_C( 31), UINT8_C( 34), UINT8_C(164), UINT8_C(178), UINT8_C(233), UINT8_C(202), UINT8_C(162),
+      UINT8_C(193), UINT8_C(171), UINT8_C(171), UINT8_C(204), UINT8_C( 94), UINT8_C(223), UINT8_C(123), UINT8_C(236),
+      UINT8_C(240), UINT8_C(164), UINT8_C( 64), UINT8_C(223), UINT8_C(122), UINT8_C( 55), UINT8_C( 88), UINT8_C(149),
+      UINT8_C( 38), UINT8_C(127), UINT8_C( 65), UINT8_C( 73), UINT8_C( 33), UINT8_C(128), UINT8_C(186), UINT8_C( 58),
+      UINT8_C(159), UINT8_C(220), UINT8_C(222), UINT8_C( 81), UINT8_C(197), UINT8_C(168), UINT8_C(244), UINT8_C(134),
+      UINT8_C( 84), UINT8_C(159), UINT8_C( 83), UINT8_C(178), UINT8_C(127), UINT8_C(206), UINT8_C(159), UINT8_C(111),
+      UINT8_C(114), UINT8_C(223), UINT8_C( 79), UINT8_C(237), UINT8_C( 23), UINT8_C(167), UINT8_C(130), UINT8_C( 61),
+      UINT8_C( 39), UINT8_C(195), UINT8_C(134), UINT8_C( 72), UINT8_C( 67), UINT8_C( 65), UINT8_C(131), UINT8_C(226),
+      UINT8_C( 29), UINT8_C( 97), UINT8_C( 52), UINT8_C(227), UINT8_C( 10), UINT8_C( 40), UINT8_C(105), UINT8_C( 94),
+      UINT8_C(199), UINT8_C(188), UINT8_C( 16), UINT8_C( 70), UINT8_C(139), UINT8_C(175), UINT8_C(182), UINT8_C(253),
+      UINT8_C(143), UINT8_C(  5), UINT8_C(234), UINT8_C(166), UINT8_C(172), UINT8_C(109), UINT8_C(227), UINT8_C(211),
+      UINT8_C( 48), UINT8_C(105), UINT8_C( 28), UINT8_C(116), UINT8_C(170), UINT8_C(159), UINT8_C( 86), UINT8_C(200),
+      UINT8_C(  0), UINT8_C(138), UINT8_C(171), UINT8_C( 10), UINT8_C(178), UINT8_C( 20), UINT8_C(104), UINT8_C(122),
+      UINT8_C(209), UINT8_C(121), UINT8_C(192), UINT8_C( 92), UINT8_C( 40), UINT8_C(118), UINT8_C( 89), UINT8_C(183),
+      UINT8_C(123), UINT8_C( 68), UINT8_C( 93), UINT8_C( 40), UINT8_C(177), UINT8_C( 64), UINT8_C(251), UINT8_C(225),
+      UINT8_C(170), UINT8_C( 23), UINT8_C( 85), UINT8_C( 84), UINT8_C(182), UINT8_C(172), UINT8_C( 28), UINT8_C(183),
+      UINT8_C( 54), UINT8_C(199), UINT8_C(193), UINT8_C(233), UINT8_C(220), UINT8_C( 42), UINT8_C( 99), UINT8_C(173),
+      UINT8_C(163), UINT8_C( 35), UINT8_C(  9), UINT8_C(203), UINT8_C(154), UINT8_C( 98), UINT8_C(131), UINT8_C( 21),
+      UINT8_C(166), UINT8_C(224), UINT8_C( 61), UINT8_C( 87), UINT8_C( 33), UINT8_C( 57), UINT8_C( 57), UINT8_C(203),
+      UINT8_C( 80), UINT8_C(142), UINT8_C( 31), UINT8_C(  7), UINT8_C( 58), UINT8_C( 60), UINT8_C(190), UINT8_C(113),
+      UINT8_C(  3), UINT8_C(127), UINT8_C( 90), UINT8_C(223), UINT8_C(169), UINT8_C(189), UINT8_C(140), UINT8_C( 76),
+      UINT8_C(224), UINT8_C(149), UINT8_C( 24), UINT8_C(122), UINT8_C(248), UINT8_C(155), UINT8_C(144), UINT8_C(158),
+      UINT8_C(123), UINT8_C(205), UINT8_C(246), UINT8_C(156), UINT8_C(  6), UINT8_C( 47), UINT8_C(103), UINT8_C( 87),
+      UINT8_C(189), UINT8_C(135), UINT8_C( 94), UINT8_C(248), UINT8_C(195), UINT8_C( 28), UINT8_C(105), UINT8_C(198),
+      UINT8_C(155), UINT8_C(195), UINT8_C(166), UINT8_C( 69), UINT8_C(128), UINT8_C( 50), UINT8_C(145), UINT8_C( 96),
+      UINT8_C(200), UINT8_C(169), UINT8_C(219), UINT8_C(192), UINT8_C( 68), UINT8_C(107), UINT8_C( 94), UINT8_C(192),
+      UINT8_C( 56), UINT8_C( 84), UINT8_C( 92), UINT8_C( 63), UINT8_C(131), UINT8_C(196), UINT8_C(150), UINT8_C( 65),
+      UINT8_C( 75), UINT8_C(244), UINT8_C( 57), UINT8_C( 14), UINT8_C( 16), UINT8_C(162), UINT8_C(212), UINT8_C(171),
+      UINT8_C(101), UINT8_C(122), UINT8_C(240), UINT8_C(229), UINT8_C(173), UINT8_C(130), UINT8_C( 69), UINT8_C(117),
+      UINT8_C( 43), UINT8_C( 32), UINT8_C( 53), UINT8_C(112), UINT8_C(139), UINT8_C(147), UINT8_C( 48), UINT8_C(196),
+      UINT8_C(232), UINT8_C(140), UINT8_C(  3), UINT8_C(107), UINT8_C( 80), UINT8_C(153), UINT8_C(172), UINT8_C(155),
+      UINT8_C(141), UINT8_C(229), UINT8_C(169), UINT8_C(157), UINT8_C(135), UINT8_C(126), UINT8_C( 72), UINT8_C(236),
+      UINT8_C(248), UINT8_C( 57), UINT8_C(209), UINT8_C(165), UINT8_C(187), UINT8_C( 23), UINT8_C( 26), UINT8_C(230),
+      UINT8_C( 55), UINT8_C( 79), UINT8_C( 86), UINT8_C(195), UINT8_C(227), UINT8_C(134), UINT8_C(135), UINT8_C(203),
+      UINT8_C( 19), UINT8_C(138), UINT8_C( 54), UINT8_C( 99), UINT8_C( 35), UINT8_C(227),    UINT8_MAX, UINT8_C(176),
+      UINT8_C(200), UINT8_C(168), UINT8_C( 77), UINT8_C( 80), UINT8_C( 38), UINT8_C(149), UINT8_C( 60), UINT8_C( 31),
+      UINT8_C(206), UINT8_C( 14), UINT8_C(196), UINT8_C(137), UINT8_C( 37), UINT8_C(223), UINT8_C(112), UINT8_C( 92),
+      UINT8_C( 46), UINT8_C(198), UINT8_C( 31), UINT8_C( 17), UINT8_C( 77), UINT8_C(166), UINT8_C(220), UINT8_C( 96),
+      UINT8_C( 48), UINT8_C( 19), UINT8_C(195), UINT8_C( 83), UINT8_C(246), UINT8_C(194), UINT8_C(  3), UINT8_C(190),
+      UINT8_C(107), UINT8_C( 80), UINT8_C( 14), UINT8_C(145), UINT8_C(230), UINT8_C( 75), UINT8_C(176), UINT8_C(180),
+      UINT8_C( 89), UINT8_C(117), UINT8_C( 62), UINT8_C(126), UINT8_C( 84), UINT8_C(174), UINT8_C(218), UINT8_C(130),
+      UINT8_C(116), UINT8_C(250), UINT8_C(148), UINT8_C(193), UINT8_C(160), UINT8_C(112), UINT8_C( 33), UINT8_C(209),
+      UINT8_C(131), UINT8_C(229), UINT8_C( 36), UINT8_C(121), UINT8_C(167), UINT8_C( 40), UINT8_C( 56), UINT8_C( 18),
+      UINT8_C(120), UINT8_C( 70), UINT8_C(164), UINT8_C( 94), UINT8_C(145), UINT8_C( 84), UINT8_C( 19), UINT8_C(234),
+      UINT8_C(201), UINT8_C( 81), UINT8_C(104), UINT8_C( 29),    UINT8_MAX, UINT8_C( 67), UINT8_C(160), UINT8_C(115),
+      UINT8_C( 61), UINT8_C( 52), UINT8_C( 53), UINT8_C(221), UINT8_C(164), UINT8_C( 86), UINT8_C(174), UINT8_C( 40),
+      UINT8_C( 59), UINT8_C(211), UINT8_C(161), UINT8_C(227), UINT8_C(251), UINT8_C(217), UINT8_C(245), UINT8_C(115),
+      UINT8_C( 32), UINT8_C(153), UINT8_C(210), UINT8_C(177), UINT8_C(238), UINT8_C(229), UINT8_C(156), UINT8_C(183),
+      UINT8_C( 54), UINT8_C(  4), UINT8_C(213), UINT8_C( 53), UINT8_C( 71), UINT8_C(117), UINT8_C(168), UINT8_C(132),
+      UINT8_C(169), UINT8_C(221), UINT8_C( 98), UINT8_C( 77), UINT8_C( 52), UINT8_C( 16), UINT8_C(117), UINT8_C(111),
+      UINT8_C(227), UINT8_C( 23), UINT8_C( 82), UINT8_C(222), UINT8_C(240), UINT8_C( 72), UINT8_C( 82), UINT8_C( 16),
+      UINT8_C(225), UINT8_C( 36), UINT8_C(194), UINT8_C(207), UINT8_C(  9), UINT8_C( 94), UINT8_C(135), UINT8_C( 63),
+      UINT8_C( 98), UINT8_C( 92), UINT8_C(116), UINT8_C(170), UINT8_C(209), UINT8_C( 28), UINT8_C( 46), UINT8_C(122),
+      UINT8_C(250), UINT8_C(144), UINT8_C(199), UINT8_C( 46), UINT8_C(161), UINT8_C( 61), UINT8_C(157), UINT8_C(132),
+      UINT8_C( 84), UINT8_C(240), UINT8_C( 99), UINT8_C( 68), UINT8_C( 56), UINT8_C(181), UINT8_C( 85), UINT8_C( 25),
+      UINT8_C(217), UINT8_C( 23), UINT8_C(233), UINT8_C(226), UINT8_C(117), UINT8_C(112), UINT8_C( 33), UINT8_C(215),
+      UINT8_C(204), UINT8_C(149), UINT8_C(129), UINT8_C(157), UINT8_C(177), UINT8_C(176), UINT8_C( 23), UINT8_C(171),
+      UINT8_C( 64), UINT8_C(222), UINT8_C(217), UINT8_C(225), UINT8_C( 27), UINT8_C(119), UINT8_C(102), UINT8_C(111),
+      UINT8_C(103), UINT8_C(201), UINT8_C(180), UINT8_C(159), UINT8_C(126), UINT8_C(  9), UINT8_C(184), UINT8_C( 87),
+      UINT8_C( 32), UINT8_C(161), UINT8_C( 57), UINT8_C(149), UINT8_C( 17), UINT8_C( 90), UINT8_C(108), UINT8_C(221),
+      UINT8_C(239), UINT8_C(238), UINT8_C(122), UINT8_C(160), UINT8_C(158), UINT8_C(145), UINT8_C( 76), UINT8_C(222),
+      UINT8_C(112), UINT8_C( 37), UINT8_C(192), UINT8_C(139), UINT8_C(156), UINT8_C( 38), UINT8_C(251), UINT8_C(  3),
+      UINT8_C(239), UINT8_C(175), UINT8_C(162), UINT8_C(109), UINT8_C(184), UINT8_C( 91), UINT8_C(196), UINT8_C(216),
+      UINT8_C(252), UINT8_C(253), UINT8_C(109), UINT8_C( 14), UINT8_C( 87), UINT8_C(217), UINT8_C(235), UINT8_C( 70),
+      UINT8_C(199), UINT8_C(102), UINT8_C(230), UINT8_C(101), UINT8_C(247), UINT8_C( 50), UINT8_C( 68), UINT8_C(103),
+      UINT8_C( 88), UINT8_C(  4), UINT8_C(243), UINT8_C(244), UINT8_C( 42), UINT8_C(238), UINT8_C(248), UINT8_C( 25),
+      UINT8_C(157), UINT8_C(154), UINT8_C(134), UINT8_C( 85), UINT8_C(245), UINT8_C( 74), UINT8_C( 45), UINT8_C(242),
+      UINT8_C( 71), UINT8_C(154), UINT8_C(  0), UINT8_C(158), UINT8_C(115), UINT8_C(235), UINT8_C(228), UINT8_C( 59),
+      UINT8_C( 81), UINT8_C(202), UINT8_C(160), UINT8_C( 73), UINT8_C(253), UINT8_C(228), UINT8_C(176), UINT8_C( 85),
+      UINT8_C(232), UINT8_C(163), UINT8_C( 73), UINT8_C( 18), UINT8_C(145), UINT8_C( 65), UINT8_C( 43), UINT8_C( 46),
+      UINT8_C(220), UINT8_C(177), UINT8_C(131), UINT8_C(209), UINT8_C(251), UINT8_C(176), UINT8_C(195), UINT8_C( 66),
+      UINT8_C( 74), UINT8_C(195), UINT8_C(224), UINT8_C(190), UINT8_C(175), UINT8_C(196), UINT8_C(249), UINT8_C(  0),
+      UINT8_C(143), UINT8_C(153), UINT8_C( 73), UINT8_C(140), UINT8_C(126), UINT8_C(250), UINT8_C(225), UINT8_C(102),
+      UINT8_C(157), UINT8_C( 42), UINT8_C(121), UINT8_C( 47), UINT8_C(108), UINT8_C(164), UINT8_C( 93), UINT8_C( 72),
+      UINT8_C( 86), UINT8_C(225), UINT8_C( 25), UINT8_C( 81) };
+  static const uint8_t c = UINT8_C(206);
+  static const uint32_t e[] =
+    { UINT32_C(1900327738), UINT32_C(4175744195), UINT32_C( 892857103), UINT32_C(1289941029), UINT32_C(  20791919), UINT32_C(2724188886), UINT32_C(2227554693), UINT32_C( 473986238),
+      UINT32_C(2794484411), UINT32_C(1587547255), UINT32_C(4254475691), UINT32_C(2051756035), UINT32_C(2289971488), UINT32_C(3408736058), UINT32_C( 240268462), UINT32_C(2133689804),
+      UINT32_C(2250682805), UINT32_C(2883954403), UINT32_C(3601499043), UINT32_C(3277044065), UINT32_C(2169418828), UINT32_C(1884194077), UINT32_C(1132498353), UINT32_C( 985892469),
+      UINT32_C(2361603384), UINT32_C(1094222530), UINT32_C( 169467443), UINT32_C(1204813252), UINT32_C(3721007808), UINT32_C(4132324541), UINT32_C(3694914139), UINT32_C(3625450997),
+      UINT32_C(2389066190), UINT32_C(2547098474), UINT32_C(1252339474), UINT32_C(2274611575), UINT32_C( 459690516), UINT32_C( 521349688), UINT32_C(4093455332), UINT32_C( 751613474),
+      UINT32_C(1639734051), UINT32_C(1157290584), UINT32_C(3281026860), UINT32_C(2504832177), UINT32_C(3903991220), UINT32_C(3741904263), UINT32_C(1439878769), UINT32_C(4202958261),
+      UINT32_C(2556268151), UINT32_C( 954102974), UINT32_C(4210989049), UINT32_C( 110138288), UINT32_C(1458516935), UINT32_C( 238500583), UINT32_C( 174403011), UINT32_C(1929853576),
+      UINT32_C(3842831535), UINT32_C(2736836078), UINT32_C(3751815113), UINT32_C(1457938422), UINT32_C(1856910717), UINT32_C(3212733510), UINT32_C(2429232592), UINT32_C(3791951393),
+      UINT32_C(3788082123), UINT32_C(1250378157), UINT32_C(1613486840), UINT32_C(3182973410), UINT32_C(2871808737), UINT32_C( 795711015), UINT32_C(1237333304), UINT32_C( 791484210),
+      UINT32_C(3356680677), UINT32_C(3642027741), UINT32_C( 121324143), UINT32_C( 801583426), UINT32_C(2564625055), UINT32_C( 482938172), UINT32_C(2087168220), UINT32_C( 447561213),
+      UINT32_C(1575290224), UINT32_C( 121191272), UINT32_C(2131763743), UINT32_C(3048270853), UINT32_C(1464753145), UINT32_C(1249142934), UINT32_C(3838393621), UINT32_C(3976282188),
+      UINT32_C(2118943696), UINT32_C( 193444134), UINT32_C(1401741150), UINT32_C( 638123247), UINT32_C(2474602159), UINT32_C( 115382191), UINT32_C( 820870278), UINT32_C(1159674689),
+      UINT32_C(2764430196), UINT32_C(3669015518), UINT32_C(1076766525), UINT32_C( 912779927), UINT32_C(4157349216), UINT32_C(2617207873), UINT32_C(1691292965), UINT32_C(2662101840),
+      UINT32_C( 943926896), UINT32_C(2434047026), UINT32_C(2664678151), UINT32_C(  30800661), UINT32_C(4026191404), UINT32_C(2475540516), UINT32_C(2985982528), UINT32_C(2421233980),
+      UINT32_C(3318341633), UINT32_C(2925137149), UINT32_C(2404197005), UINT32_C(2106740487), UINT32_C( 107950133), UINT32_C(1570428979), UINT32_C(2400210509), UINT32_C(1126224787),
+      UINT32_C(1930023656), UINT32_C(3659800979), UINT32_C(3932849190), UINT32_C(1332344813), UINT32_C(  39250671), UINT32_C( 459408050), UINT32_C(3014372236), UINT32_C(3170414960),
+      UINT32_C(1899116698), UINT32_C(3880644346), UINT32_C(1339250118), UINT32_C( 849287885), UINT32_C(3644218253), UINT32_C(1660360894), UINT32_C(3457608948), UINT32_C( 428600527),
+      UINT32_C(1770844277), UINT32_C(3411168363), UINT32_C(1008481032), UINT32_C(1735480226), UINT32_C(2386718708), UINT32_C( 972209611), UINT32_C(1040714637), UINT32_C( 492378562),
+      UINT32_C(1435019504), UINT32_C(1176618473), UINT32_C(1384380868), UINT32_C(2696624864), UINT32_C(3392278343), UINT32_C(  67375461), UINT32_C( 927172909), UINT32_C(3864387713),
+      UINT32_C( 910024110), UINT32_C(2860382180), UINT32_C(2348779953), UINT32_C(2183974440), UINT32_C(3763244330), UINT32_C(2682638416), UINT32_C(4141427084), UINT32_C(1037951979),
+      UINT32_C(3094700246), UINT32_C( 174395477), UINT32_C(3700909655), UINT32_C(3344959434), UINT32_C(2510875437), UINT32_C(1429662418), UINT32_C(1934454644), UINT32_C(1051921109),
+      UINT32_C(3002574462), UINT32_C(  29213076), UINT32_C(3504306671), UINT32_C( 781804517), UINT32_C(3771086910), UINT32_C(2084037591), UINT32_C(1022459029), UINT32_C(3866892607),
+      UINT32_C(3650765743), UINT32_C(2229014984), UINT32_C(3109446434), UINT32_C(3656045463), UINT32_C(4072398939), UINT32_C(2859528251), UINT32_C( 401079720), UINT32_C(3288315666),
+      UINT32_C(2627607782), UINT32_C(2418108548), UINT32_C( 575456573), UINT32_C(2298371071), UINT32_C(2206063736), UINT32_C( 355458189), UINT32_C(1177464029), UINT32_C(1175150630),
+      UINT32_C(2867121682), UINT32_C(1278960323), UINT32_C(3614430214) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svuint8_t bv = simde_svld1_u8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4]));
+
+    rv = simde_svdot_n_u32(av, bv, c);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  uint32_t a[1024 / sizeof(uint32_t)], e[1024 / sizeof(uint32_t)];
+  uint8_t b[1024], c;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  c = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svuint8_t bv;
+
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u8(simde_svwhilelt_b8_s32(i * 4, len * 4), &(b[i * 4]));
+
+    ev = simde_svdot_n_u32(av, bv, c);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1u8(1, c);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svdot_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const uint64_t a[] =
+    { UINT64_C(18171208914124337390), UINT64_C( 4634823405808624175), UINT64_C(18360732641895625417), UINT64_C( 4197592677695122758),
+      UINT64_C( 6053076647906314952), UINT64_C(16145529006918198139), UINT64_C(16082537441941531427), UINT64_C(11356409014223174675),
+      UINT64_C(11138704933994448411), UINT64_C( 5222902494806061957), UINT64_C( 1017157082622350501), UINT64_C( 1880262733512764838),
+      UINT64_C(16071357342420744526), UINT64_C(10524902355285799585), UINT64_C(15660121133767756106), UINT64_C( 1797900290441396699),
+      UINT64_C(15951623691868392741), UINT64_C( 1981498975771154944), UINT64_C( 1749845531659620411), UINT64_C( 3339108001615354996),
+      UINT64_C( 7587173843227040563), UINT64_C(15984917342997377000), UINT64_C( 6736140298265244965), UINT64_C( 9684974863434607920),
+      UINT64_C(  909516174037096141), UINT64_C(17342689035462047023), UINT64_C(13553528707394828752), UINT64_C( 8148522062168044092),
+      UINT64_C( 8692868987646052723), UINT64_C(15417499396501760315), UINT64_C( 5996724424136345839), UINT64_C(18333581838710353496),
+      UINT64_C(10791249617582625792), UINT64_C(17400659926335490978), UINT64_C(  523163781294787288), UINT64_C( 2043913068756542676),
+      UINT64_C(14732162970644050564), UINT64_C( 8514035983852965428), UINT64_C( 1130307005675116024), UINT64_C(12107025053362598861),
+      UINT64_C(14390402222507059901), UINT64_C( 1016727291293411080), UINT64_C(17871238985799860921), UINT64_C(18006769257016226072),
+      UINT64_C( 7829953687696009807), UINT64_C( 9574423885245490876), UINT64_C( 1428904402960881073), UINT64_C(16799609247226639854),
+      UINT64_C( 6228326114009023902), UINT64_C( 7091770494598742300), UINT64_C( 5740703459884065948), UINT64_C(14721032629536815816),
+      UINT64_C(12218896415829399458), UINT64_C( 6760461323878841023), UINT64_C(16974243068850278624), UINT64_C( 5302030507709368730),
+      UINT64_C( 6910237754752656304), UINT64_C( 5904676996131026642), UINT64_C( 2359361217259300528), UINT64_C( 6060857345417218860),
+      UINT64_C(10223302801347420896), UINT64_C(   49559732287025133), UINT64_C(10492985146437026552), UINT64_C(16543551041269172126),
+      UINT64_C(10046202141441664803), UINT64_C(10828792734109240566), UINT64_C( 5463626854656383964), UINT64_C(15646951746025895482),
+      UINT64_C(14515985412699687754), UINT64_C(15196366658526469551), UINT64_C(16603335503673293169), UINT64_C( 7398089395748141083),
+      UINT64_C( 3851354514977088470), UINT64_C( 5325621836648775967), UINT64_C(18227145080444615521), UINT64_C( 4272924720255343051),
+      UINT64_C( 8978020816270957533), UINT64_C(16571409914674617559), UINT64_C(18398019440721682805), UINT64_C( 8691439973848982015),
+      UINT64_C(12728988769078444749), UINT64_C( 2808091885222967439), UINT64_C(14983141506569530042), UINT64_C(15277284187006227696),
+      UINT64_C(16275064921475964499), UINT64_C( 5671700528052321245), UINT64_C(17327082798648668631), UINT64_C(14833025910264539646),
+      UINT64_C( 6453611522533480284), UINT64_C( 5256718297216877329), UINT64_C( 6394942536111042510), UINT64_C( 1609534087332969231),
+      UINT64_C( 3955377793445154830), UINT64_C( 4003645545328135382), UINT64_C(17559753631149227774), UINT64_C( 5967501798405836289),
+      UINT64_C(13726903388352648227), UINT64_C( 2823075449373285005), UINT64_C(18152374003010843666), UINT64_C( 6761176526449108797),
+      UINT64_C(18428769747289354522), UINT64_C( 7768466750231135615), UINT64_C(13496247383954181719), UINT64_C(11694460132912857524),
+      UINT64_C(10679552133636092099), UINT64_C(11884167419225975337), UINT64_C( 5877551134867279961) };
+  static const uint16_t b[] =
+    { UINT16_C(10890), UINT16_C(45119), UINT16_C(25828), UINT16_C(57582), UINT16_C(60024), UINT16_C(18928), UINT16_C(20912), UINT16_C( 6953),
+      UINT16_C(13524), UINT16_C(55409), UINT16_C(55773), UINT16_C(65318), UINT16_C(27441), UINT16_C(64113), UINT16_C( 7568), UINT16_C( 6842),
+      UINT16_C(64071), UINT16_C(11210), UINT16_C(47454), UINT16_C(54795), UINT16_C(64419), UINT16_C(21280), UINT16_C(18764), UINT16_C( 8302),
+      UINT16_C(57470), UINT16_C(23545), UINT16_C( 8121), UINT16_C(59994), UINT16_C(52107), UINT16_C( 7140), UINT16_C(40936), UINT16_C(12085),
+      UINT16_C(  153), UINT16_C(63323), UINT16_C(26297), UINT16_C(23758), UINT16_C(61026), UINT16_C(44719), UINT16_C( 7735), UINT16_C(46543),
+      UINT16_C(51454), UINT16_C(46864), UINT16_C(27623), UINT16_C(29346), UINT16_C(34358), UINT16_C( 8077), UINT16_C(49957), UINT16_C(48718),
+      UINT16_C(43459), UINT16_C(31926), UINT16_C(33808), UINT16_C(29400), UINT16_C(34674), UINT16_C(43296), UINT16_C(61349), UINT16_C(41823),
+      UINT16_C(28599), UINT16_C(40795), UINT16_C(64986), UINT16_C( 4369), UINT16_C(40835), UINT16_C(43312), UINT16_C(32354), UINT16_C( 9575),
+      UINT16_C( 7464), UINT16_C(14497), UINT16_C(31137), UINT16_C( 5034), UINT16_C(51712), UINT16_C(42685), UINT16_C( 7354), UINT16_C(29001),
+      UINT16_C(42123), UINT16_C(26128), UINT16_C( 8865), UINT16_C( 9591), UINT16_C(42945), UINT16_C( 9166), UINT16_C(13605), UINT16_C(19784),
+      UINT16_C(59731), UINT16_C(62597), UINT16_C(12130), UINT16_C(25096), UINT16_C(50682), UINT16_C(46088), UINT16_C(21217), UINT16_C(27685),
+      UINT16_C(14070), UINT16_C(39122), UINT16_C(18776), UINT16_C( 6589), UINT16_C(35824), UINT16_C( 5692), UINT16_C(33984), UINT16_C( 4963),
+      UINT16_C(59757), UINT16_C(53000), UINT16_C( 4120), UINT16_C( 4657), UINT16_C(15061), UINT16_C(46790), UINT16_C(60556), UINT16_C(33314),
+      UINT16_C(62754), UINT16_C(31258), UINT16_C(55102), UINT16_C(12179), UINT16_C(53090), UINT16_C( 9029), UINT16_C(43091), UINT16_C(49206),
+      UINT16_C(16017), UINT16_C(43663), UINT16_C(49230), UINT16_C( 9148), UINT16_C(33786), UINT16_C(34521), UINT16_C(64623), UINT16_C(37129),
+      UINT16_C( 9201), UINT16_C(12043), UINT16_C(40699), UINT16_C(23902), UINT16_C(41837), UINT16_C(49280), UINT16_C(46924), UINT16_C(56704),
+      UINT16_C( 4085), UINT16_C(17543), UINT16_C(17615), UINT16_C(51815), UINT16_C(16839), UINT16_C(13904), UINT16_C(22845), UINT16_C(11975),
+      UINT16_C(53885), UINT16_C(30813), UINT16_C(48240), UINT16_C(56789), UINT16_C(22111), UINT16_C(43933), UINT16_C( 7437), UINT16_C(  649),
+      UINT16_C( 4140), UINT16_C(64326), UINT16_C(44628), UINT16_C( 7109), UINT16_C( 5871), UINT16_C(11345), UINT16_C( 6255), UINT16_C(60506),
+      UINT16_C(47082), UINT16_C(23140), UINT16_C(14963), UINT16_C(54071), UINT16_C(54416), UINT16_C(40318), UINT16_C( 2033), UINT16_C( 7583),
+      UINT16_C(58904), UINT16_C(27673), UINT16_C(56980), UINT16_C(33672), UINT16_C(55796), UINT16_C(25775), UINT16_C( 2546), UINT16_C(56400),
+      UINT16_C(46528), UINT16_C(13367), UINT16_C(28399), UINT16_C(32519), UINT16_C(34115), UINT16_C(13340), UINT16_C(48013), UINT16_C(42322),
+      UINT16_C(27553), UINT16_C(13585), UINT16_C(39241), UINT16_C(16056), UINT16_C(26483), UINT16_C(26018), UINT16_C(62064), UINT16_C(12609),
+      UINT16_C(30887), UINT16_C(38501), UINT16_C(27879), UINT16_C(10773), UINT16_C(12785), UINT16_C(32350), UINT16_C(45293), UINT16_C(36387),
+      UINT16_C(13595), UINT16_C(26052), UINT16_C(31950), UINT16_C(16803), UINT16_C(17892), UINT16_C(21670), UINT16_C(59447), UINT16_C(57221),
+      UINT16_C(60000), UINT16_C(18293), UINT16_C(35670), UINT16_C(18545), UINT16_C(53436), UINT16_C(43462), UINT16_C(60032), UINT16_C(39992),
+      UINT16_C(64543), UINT16_C(60673), UINT16_C(42104), UINT16_C(23599), UINT16_C(54761), UINT16_C( 8369), UINT16_C(14013), UINT16_C( 7935),
+      UINT16_C(29985), UINT16_C(30565), UINT16_C(55040), UINT16_C(48319), UINT16_C(34471), UINT16_C(10086), UINT16_C(40560), UINT16_C(36803),
+      UINT16_C(50330), UINT16_C( 4732), UINT16_C(43880), UINT16_C(20847), UINT16_C( 8321), UINT16_C(15986), UINT16_C(29014), UINT16_C(30556),
+      UINT16_C(49894), UINT16_C(59119), UINT16_C(44697), UINT16_C(16547), UINT16_C( 2356), UINT16_C(42087), UINT16_C(11175), UINT16_C(16691),
+      UINT16_C(45295), UINT16_C(22611), UINT16_C(49755), UINT16_C(56489), UINT16_C( 7138), UINT16_C(14619), UINT16_C(30605), UINT16_C(29616),
+      UINT16_C(40761), UINT16_C(53850), UINT16_C(64846), UINT16_C(33298), UINT16_C(31238), UINT16_C(44327), UINT16_C(23205), UINT16_C(38126),
+      UINT16_C(16650), UINT16_C(26348), UINT16_C(38404), UINT16_C(58946), UINT16_C(23985), UINT16_C(15903), UINT16_C(53461), UINT16_C( 3762),
+      UINT16_C( 3183), UINT16_C(48609), UINT16_C(62217), UINT16_C( 3904), UINT16_C(26477), UINT16_C( 4796), UINT16_C(43713), UINT16_C(52391),
+      UINT16_C(37867), UINT16_C(61234), UINT16_C(29737), UINT16_C(56278), UINT16_C(62930), UINT16_C(42777), UINT16_C(52165), UINT16_C(13749),
+      UINT16_C(38615), UINT16_C(57586), UINT16_C(12938), UINT16_C(63471), UINT16_C(43929), UINT16_C(23306), UINT16_C(45397), UINT16_C(16679),
+      UINT16_C(22852), UINT16_C(28208), UINT16_C( 1741), UINT16_C(40777), UINT16_C(25340), UINT16_C(49478), UINT16_C(64558), UINT16_C( 1526),
+      UINT16_C(59794), UINT16_C( 7398), UINT16_C(54555), UINT16_C(46356), UINT16_C( 7809), UINT16_C(54800), UINT16_C(14287), UINT16_C( 4887),
+      UINT16_C(18576), UINT16_C(23937), UINT16_C(51790), UINT16_C(19197), UINT16_C(17197), UINT16_C(23308), UINT16_C(  575), UINT16_C(53856),
+      UINT16_C(18155), UINT16_C( 2030), UINT16_C(  540), UINT16_C(40380), UINT16_C(52256), UINT16_C(61299), UINT16_C(35587), UINT16_C(37635),
+      UINT16_C(34003), UINT16_C( 8688), UINT16_C(60751), UINT16_C(31852), UINT16_C(30769), UINT16_C(28887), UINT16_C(14202), UINT16_C(26178),
+      UINT16_C(12670), UINT16_C(39533), UINT16_C(10547), UINT16_C(21559), UINT16_C(43765), UINT16_C(63555), UINT16_C(17973), UINT16_C( 2187),
+      UINT16_C(31691), UINT16_C( 6698), UINT16_C(38505), UINT16_C(39574), UINT16_C(27918), UINT16_C(34826), UINT16_C(19876), UINT16_C( 8942),
+      UINT16_C(23422), UINT16_C(45500), UINT16_C(62340), UINT16_C(30981), UINT16_C(18846), UINT16_C(54129), UINT16_C(64655), UINT16_C(23260),
+      UINT16_C( 1656), UINT16_C(57716), UINT16_C( 2716), UINT16_C(43643), UINT16_C(34167), UINT16_C( 7218), UINT16_C( 8658), UINT16_C(20542),
+      UINT16_C(64380), UINT16_C(  258), UINT16_C( 2030), UINT16_C(35962), UINT16_C(60496), UINT16_C(57440), UINT16_C(15592), UINT16_C(24634),
+      UINT16_C(44866), UINT16_C(56897), UINT16_C(48313), UINT16_C(12680), UINT16_C(47682), UINT16_C( 5197), UINT16_C(35803), UINT16_C(22629),
+      UINT16_C(26502), UINT16_C(30041), UINT16_C(54126), UINT16_C(48897), UINT16_C(25023), UINT16_C(43167), UINT16_C(55709), UINT16_C(57096),
+      UINT16_C(19080), UINT16_C(17085), UINT16_C(17670), UINT16_C(18547), UINT16_C(49152), UINT16_C(56157), UINT16_C(49739), UINT16_C(53811),
+      UINT16_C(35881), UINT16_C(38727), UINT16_C(18528), UINT16_C( 8022), UINT16_C(62890), UINT16_C(18375), UINT16_C(53455), UINT16_C(22311),
+      UINT16_C(58394), UINT16_C( 8345), UINT16_C( 3114), UINT16_C(10857), UINT16_C(50892), UINT16_C( 6149), UINT16_C(14728), UINT16_C(45546),
+      UINT16_C(12741), UINT16_C( 9544), UINT16_C(40825), UINT16_C( 9029), UINT16_C( 3220), UINT16_C(25451), UINT16_C(37596), UINT16_C(63163),
+      UINT16_C(21622), UINT16_C(40983), UINT16_C(32865), UINT16_C(11722), UINT16_C(53318), UINT16_C(52805), UINT16_C(12041), UINT16_C(52863),
+      UINT16_C(51040), UINT16_C(56052), UINT16_C(14694), UINT16_C(64509) };
+  static const uint16_t c = UINT16_C(58961);
+  static const uint64_t e[] =
+    { UINT64_C(18171208922344621049), UINT64_C( 4634823412106661312), UINT64_C(18360732653099630481), UINT64_C( 4197592683942866162),
+      UINT64_C( 6053076658373661282), UINT64_C(16145529013566935304), UINT64_C(16082537450734385357), UINT64_C(11356409020842608223),
+      UINT64_C(11138704940688349702), UINT64_C( 5222902504241178060), UINT64_C( 1017157091778227308), UINT64_C( 1880262741832751548),
+      UINT64_C(16071357350592326399), UINT64_C(10524902365966113047), UINT64_C(15660121141948535895), UINT64_C( 1797900297874963735),
+      UINT64_C(15951623695295913593), UINT64_C( 1981498983480423616), UINT64_C( 1749845536771951838), UINT64_C( 3339108006656520496),
+      UINT64_C( 7587173852634503957), UINT64_C(15984917351586343792), UINT64_C( 6736140302897044242), UINT64_C( 9684974868178786863),
+      UINT64_C(  909516181202862315), UINT64_C(17342689044643512904), UINT64_C(13553528716904825325), UINT64_C( 8148522071272565868),
+      UINT64_C( 8692868994606870461), UINT64_C(15417499406528609014), UINT64_C( 5996724429197852884), UINT64_C(18333581850192713441),
+      UINT64_C(10791249622951496530), UINT64_C(17400659930201151021), UINT64_C(  523163792481280935), UINT64_C( 2043913073127321606),
+      UINT64_C(14732162977731339647), UINT64_C( 8514035988804333325), UINT64_C( 1130307013885789040), UINT64_C(12107025059515179211),
+      UINT64_C(14390402232956658970), UINT64_C( 1016727299578433917), UINT64_C(17871238992923116214), UINT64_C(18006769265140462262),
+      UINT64_C( 7829953693381913842), UINT64_C( 9574423892743797090), UINT64_C( 1428904409331027513), UINT64_C(16799609254703779069),
+      UINT64_C( 6228326119221176302), UINT64_C( 7091770503810219330), UINT64_C( 5740703467696870136), UINT64_C(14721032641147533858),
+      UINT64_C(12218896427086174617), UINT64_C( 6760461328895124981), UINT64_C(16974243078514517173), UINT64_C( 5302030514897893850),
+      UINT64_C( 6910237761815535533), UINT64_C( 5904677001076498439), UINT64_C( 2359361227297823505), UINT64_C( 6060857349680629809),
+      UINT64_C(10223302811615479046), UINT64_C(   49559737120529991), UINT64_C(10492985157802054107), UINT64_C(16543551049340697182),
+      UINT64_C(10046202149716723231), UINT64_C(10828792739835002237), UINT64_C( 5463626861608652357), UINT64_C(15646951753536170779),
+      UINT64_C(14515985423614312230), UINT64_C(15196366668645415332), UINT64_C(16603335513850551379), UINT64_C( 7398089403372446954),
+      UINT64_C( 3851354520494540928), UINT64_C( 5325621844956498789), UINT64_C(18227145090356136504), UINT64_C( 4272924725077350514),
+      UINT64_C( 8978020822963031033), UINT64_C(16571409920272139055), UINT64_C(18398019444324494710), UINT64_C( 8691439984861540712),
+      UINT64_C(12728988777055514283), UINT64_C( 2808091891121190035), UINT64_C(14983141511540472991), UINT64_C(15277284194522575976),
+      UINT64_C(16275064928343034247), UINT64_C( 5671700533450908327), UINT64_C(17327082808214678154), UINT64_C(14833025919750774936),
+      UINT64_C( 6453611528767485775), UINT64_C( 5256718301378639514), UINT64_C( 6394942542162209940), UINT64_C( 1609534096658358913),
+      UINT64_C( 3955377803041411346), UINT64_C( 4003645551891143253), UINT64_C(17559753640557398700), UINT64_C( 5967501809077482484),
+      UINT64_C(13726903392620363329), UINT64_C( 2823075461687820504), UINT64_C(18152374008975220504), UINT64_C( 6761176535707813588),
+      UINT64_C(18428769752048096832), UINT64_C( 7768466757148145330), UINT64_C(13496247388207569298), UINT64_C(11694460140544179754),
+      UINT64_C(10679552139956239611), UINT64_C(11884167429309898284), UINT64_C( 5877551145851419456) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svuint16_t bv = simde_svld1_u16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4]));
+
+    rv = simde_svdot_n_u64(av, bv, c);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  uint64_t a[1024 / sizeof(uint64_t)], e[1024 / sizeof(uint64_t)];
+  uint16_t b[1024 / sizeof(uint16_t)], c;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  c = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svuint16_t bv;
+
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u16(simde_svwhilelt_b16_s32(i * 4, len * 4), &(b[i * 4]));
+
+    ev = simde_svdot_n_u64(av, bv, c);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len * 4), b);
+  simde_test_codegen_write_1u16(1, c);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_n_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_n_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_n_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svdot_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
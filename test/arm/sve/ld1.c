@@ -0,0 +1,5309 @@
+#define SIMDE_TEST_ARM_SVE_INSN ld1
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/ld1.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+#include "../../../simde/arm/sve/dup.h"
+#include "../../../simde/arm/sve/ptest.h"
+#include "../../../simde/arm/sve/st1.h"
+#include "../../../simde/arm/sve/whilelt.h"
+
+static int
+test_simde_svld1sb_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(  9231), -INT16_C( 10144), -INT16_C( 14603), -INT16_C( 20221),  INT16_C(  1117),  INT16_C( 26600),  INT16_C( 17518), -INT16_C(  9942),
+      -INT16_C(  9751), -INT16_C( 29647),  INT16_C( 19634),  INT16_C( 20039),  INT16_C( 13942), -INT16_C( 26736), -INT16_C( 20187),  INT16_C( 13492),
+       INT16_C(  5333), -INT16_C( 13556),  INT16_C(  4058),  INT16_C( 14460),  INT16_C( 25620), -INT16_C( 32097), -INT16_C( 13912), -INT16_C( 28325),
+      -INT16_C( 29278),  INT16_C( 21790),  INT16_C( 26073),  INT16_C( 20387),  INT16_C( 13211), -INT16_C( 16153), -INT16_C( 25628), -INT16_C( 17931),
+       INT16_C(   431), -INT16_C( 30332),  INT16_C(    17),  INT16_C(  9665),  INT16_C( 24932),  INT16_C(  3239),  INT16_C(   554), -INT16_C( 12898),
+      -INT16_C( 17265),  INT16_C( 26914), -INT16_C( 15071), -INT16_C( 17224), -INT16_C( 24584), -INT16_C(  9091),  INT16_C( 29242), -INT16_C(  5739),
+       INT16_C(  6771), -INT16_C( 31629),  INT16_C( 13338),  INT16_C( 32681),  INT16_C( 20629), -INT16_C( 16245),  INT16_C( 10579), -INT16_C(  7539),
+      -INT16_C( 20507),  INT16_C(  1611),  INT16_C(  1140),  INT16_C( 27843),  INT16_C( 16547), -INT16_C(  8632), -INT16_C(  8782),  INT16_C(  9671),
+       INT16_C( 15095),  INT16_C(  4778),  INT16_C( 21359),  INT16_C(  1169),  INT16_C(  7332), -INT16_C(  2108),  INT16_C( 20806),  INT16_C( 11225),
+       INT16_C(  9472),  INT16_C( 29746), -INT16_C(  2775), -INT16_C( 13088),  INT16_C( 10293), -INT16_C(  6230),  INT16_C( 29190), -INT16_C(   756),
+      -INT16_C( 18772),  INT16_C(  6927), -INT16_C( 24566), -INT16_C( 20960), -INT16_C(  6979),  INT16_C(   933),  INT16_C( 32310),  INT16_C( 13870),
+       INT16_C( 24739), -INT16_C( 13141), -INT16_C( 29867), -INT16_C( 30055),  INT16_C( 17332), -INT16_C( 17807),  INT16_C( 32437),  INT16_C( 25271),
+      -INT16_C( 14540),  INT16_C( 15997), -INT16_C( 25241),  INT16_C(  9452), -INT16_C( 28286), -INT16_C( 18393),  INT16_C( 22032), -INT16_C( 19474),
+      -INT16_C( 26186),  INT16_C(  3200),  INT16_C(  6437), -INT16_C(  9834),  INT16_C(  2140),  INT16_C(  4755),  INT16_C( 19078), -INT16_C( 17804),
+      -INT16_C(  3823),  INT16_C( 31225), -INT16_C(  6769),  INT16_C(  4509), -INT16_C( 14985), -INT16_C( 30775), -INT16_C( 18661), -INT16_C( 11974),
+      -INT16_C( 17839),  INT16_C( 30429),  INT16_C( 29907),  INT16_C( 12367), -INT16_C(  7556),  INT16_C(   578), -INT16_C( 18900),  INT16_C( 16060),
+      -INT16_C( 19033),  INT16_C( 14007),  INT16_C( 21659),  INT16_C(  4679),  INT16_C(  4121),  INT16_C( 13465), -INT16_C( 11320),  INT16_C(  6406),
+      -INT16_C(  7282),  INT16_C( 24975), -INT16_C(  8617), -INT16_C( 11375), -INT16_C( 11328), -INT16_C(  4907), -INT16_C( 28023),  INT16_C( 12586),
+      -INT16_C(  7865), -INT16_C(  7577), -INT16_C( 20682),  INT16_C( 20468), -INT16_C( 29249), -INT16_C( 30844), -INT16_C( 30111), -INT16_C(  4192),
+       INT16_C( 12141), -INT16_C( 15024), -INT16_C(  7667), -INT16_C( 12904),  INT16_C( 28341),  INT16_C( 16314), -INT16_C(  7168),  INT16_C( 18288),
+      -INT16_C( 10298), -INT16_C(   982),  INT16_C(  7814),  INT16_C( 17995), -INT16_C( 12372),  INT16_C(  3533),  INT16_C( 28249), -INT16_C( 14340),
+       INT16_C( 19613), -INT16_C( 21620),  INT16_C(  9262), -INT16_C(  7048),  INT16_C( 12946), -INT16_C( 28125), -INT16_C( 27881), -INT16_C(  8742),
+       INT16_C(  1130), -INT16_C(  3623),  INT16_C(  9250), -INT16_C( 12745),  INT16_C(  1268),  INT16_C( 19931), -INT16_C( 10382),  INT16_C(  4116),
+      -INT16_C( 24540),  INT16_C( 21179),  INT16_C( 13253),  INT16_C( 22326),  INT16_C( 22886),  INT16_C( 32234), -INT16_C( 15124),  INT16_C( 22362),
+       INT16_C( 13256), -INT16_C(  5560),  INT16_C( 32599),  INT16_C( 19385), -INT16_C( 27517), -INT16_C(  2407), -INT16_C( 21140), -INT16_C( 28666),
+      -INT16_C( 16050),  INT16_C(  5090),  INT16_C(  6644),  INT16_C( 23146),  INT16_C( 21618),  INT16_C( 24535),  INT16_C( 12568), -INT16_C(  8010),
+      -INT16_C(   412), -INT16_C( 17205), -INT16_C( 31619),  INT16_C(     7), -INT16_C( 24552), -INT16_C( 31498), -INT16_C(   946), -INT16_C( 25580),
+      -INT16_C(  2115), -INT16_C( 19793),  INT16_C(  6416), -INT16_C( 32244), -INT16_C(  7058), -INT16_C( 31007), -INT16_C( 26859),  INT16_C( 31335),
+       INT16_C( 12949),  INT16_C(  4662),  INT16_C( 15798), -INT16_C( 12781),  INT16_C(  2526),  INT16_C( 11347),  INT16_C( 26374), -INT16_C( 15416),
+       INT16_C( 30558),  INT16_C( 28277), -INT16_C( 32112), -INT16_C(   271), -INT16_C( 11674),  INT16_C( 31621), -INT16_C(  5014), -INT16_C(    11),
+       INT16_C( 11038), -INT16_C( 11246),  INT16_C(  9577),  INT16_C( 18338), -INT16_C(  2770),  INT16_C( 13427),  INT16_C( 15197), -INT16_C( 17416),
+       INT16_C( 28082),  INT16_C( 16938),  INT16_C(  7151),  INT16_C( 21825), -INT16_C( 14611),  INT16_C( 22481), -INT16_C( 14670), -INT16_C( 12201),
+       INT16_C( 27122),  INT16_C( 23460),  INT16_C( 18062), -INT16_C( 17246),  INT16_C(  5436), -INT16_C( 26127), -INT16_C(  5808),  INT16_C(   596),
+       INT16_C( 32342),  INT16_C( 17988), -INT16_C( 31335), -INT16_C( 30821),  INT16_C( 27723), -INT16_C(   546),  INT16_C( 13619),  INT16_C(  9677),
+       INT16_C( 29086),  INT16_C( 11392),  INT16_C(  8888), -INT16_C(  2839), -INT16_C(  9673), -INT16_C( 30835), -INT16_C(  7741),  INT16_C(  6537),
+      -INT16_C( 12960), -INT16_C(  1697), -INT16_C(  1197), -INT16_C( 24960),  INT16_C( 24423), -INT16_C( 25956),  INT16_C( 27028),  INT16_C( 13247),
+       INT16_C( 16347) };
+  static const int8_t a[] =
+    {  INT8_C(  45), -INT8_C( 111),  INT8_C(  92),  INT8_C( 111), -INT8_C(  63),  INT8_C( 124),  INT8_C(  86), -INT8_C(  36),
+       INT8_C(  66), -INT8_C(   7), -INT8_C(  57),  INT8_C(  80),  INT8_C(  75), -INT8_C(  35),  INT8_C(   5), -INT8_C( 113),
+       INT8_C(  92), -INT8_C(  67),  INT8_C( 119), -INT8_C(  79),  INT8_C( 109), -INT8_C(  12),  INT8_C(  59), -INT8_C(  67),
+      -INT8_C( 109), -INT8_C(  54), -INT8_C(  30),  INT8_C(  60),  INT8_C(  66),  INT8_C(  36), -INT8_C( 127),  INT8_C( 111),
+      -INT8_C(  75), -INT8_C(  35), -INT8_C(  34),  INT8_C( 118),  INT8_C(  89),  INT8_C(  52),  INT8_C(  83), -INT8_C( 101),
+       INT8_C(  45),  INT8_C(  26), -INT8_C(  20),  INT8_C( 120), -INT8_C(   8), -INT8_C(  15),  INT8_C(   8),  INT8_C(  84),
+      -INT8_C(  81),      INT8_MAX,  INT8_C(   5),  INT8_C(  28),  INT8_C( 115),  INT8_C(  65), -INT8_C(  39),  INT8_C(   7),
+       INT8_C(  11), -INT8_C(  69),  INT8_C(  67),  INT8_C(  78), -INT8_C(  33), -INT8_C(  60), -INT8_C(  67), -INT8_C( 107),
+      -INT8_C(  95), -INT8_C( 100),  INT8_C(  11), -INT8_C(   6), -INT8_C(  48),  INT8_C(  94), -INT8_C( 106), -INT8_C(   2),
+       INT8_C( 121), -INT8_C( 126),  INT8_C( 118),  INT8_C( 113),  INT8_C( 115),  INT8_C( 126), -INT8_C(  59),  INT8_C(  34),
+      -INT8_C(   2), -INT8_C(  54),  INT8_C(  62),  INT8_C( 113),  INT8_C(  11),  INT8_C(  23),  INT8_C( 120),  INT8_C(  23),
+      -INT8_C(  46), -INT8_C(  69),  INT8_C( 101), -INT8_C(  78),      INT8_MAX,  INT8_C(  34),  INT8_C(  71),  INT8_C(  32),
+      -INT8_C(  66),  INT8_C(  82),  INT8_C(  27), -INT8_C( 113), -INT8_C(  79), -INT8_C(  79), -INT8_C( 115),  INT8_C(  42),
+       INT8_C(  51),  INT8_C(   3), -INT8_C( 101), -INT8_C(  90), -INT8_C( 126),  INT8_C(  96), -INT8_C(  55),      INT8_MIN,
+       INT8_C(  42),  INT8_C(   7), -INT8_C(  15),  INT8_C(  54),  INT8_C(  31),  INT8_C( 106),  INT8_C(  77), -INT8_C(  15),
+       INT8_C(  37), -INT8_C(  78), -INT8_C(  93), -INT8_C(  91), -INT8_C(  44), -INT8_C(  22), -INT8_C(  59), -INT8_C( 109),
+       INT8_C(  61), -INT8_C(  32),  INT8_C(  34), -INT8_C(  18), -INT8_C( 111), -INT8_C(  81),  INT8_C(  24), -INT8_C(  60),
+      -INT8_C(  78), -INT8_C(  77),  INT8_C( 107),  INT8_C(  52),  INT8_C(  19),  INT8_C(  52), -INT8_C(  76),  INT8_C(  61),
+       INT8_C(  59), -INT8_C(  90),  INT8_C( 115),  INT8_C(  90),  INT8_C(  16), -INT8_C(  64),  INT8_C(  76),  INT8_C(  53),
+       INT8_C( 114), -INT8_C(  17), -INT8_C(  38),  INT8_C(  71), -INT8_C(  38), -INT8_C(  96), -INT8_C(  38),  INT8_C(  23),
+           INT8_MIN, -INT8_C(   4),  INT8_C(   5),  INT8_C(  18), -INT8_C(  85),  INT8_C(  29), -INT8_C(  42),  INT8_C(  93),
+      -INT8_C(  48),  INT8_C(  65), -INT8_C( 110), -INT8_C(  29),  INT8_C( 117),  INT8_C(  70),  INT8_C(  32), -INT8_C(  79),
+      -INT8_C(  20), -INT8_C( 108),  INT8_C(  11), -INT8_C(   4),  INT8_C(  84),  INT8_C(  87),  INT8_C(  50), -INT8_C(  57),
+       INT8_C(  71),  INT8_C(  12),  INT8_C(  14),  INT8_C(  33), -INT8_C(  84), -INT8_C(  24),  INT8_C(  56),  INT8_C(  45),
+      -INT8_C(  28),  INT8_C(  61),  INT8_C(  63), -INT8_C( 113),  INT8_C(  90),  INT8_C(  21), -INT8_C(  20),  INT8_C(  42),
+       INT8_C(  87),  INT8_C( 126),  INT8_C(  13), -INT8_C(  52), -INT8_C(  59),  INT8_C(  45),  INT8_C( 125), -INT8_C(  79),
+      -INT8_C(  63), -INT8_C( 119), -INT8_C(  82),  INT8_C(  22), -INT8_C(  32), -INT8_C(  32), -INT8_C(  35),  INT8_C(  39),
+      -INT8_C(  20), -INT8_C(  21),  INT8_C(  72), -INT8_C( 103), -INT8_C(  45),      INT8_MIN, -INT8_C(  58), -INT8_C(  73),
+      -INT8_C(  67),  INT8_C(   5),  INT8_C(  70),  INT8_C(  23),  INT8_C(  26),  INT8_C(  50),  INT8_C(  65),  INT8_C( 113),
+      -INT8_C(  79),  INT8_C(  78),  INT8_C(  62),  INT8_C( 118),  INT8_C( 124), -INT8_C(  69),  INT8_C(  39),  INT8_C(  61),
+       INT8_C(  68), -INT8_C(  43),  INT8_C(  83),  INT8_C(  37), -INT8_C(  75),  INT8_C(  48),  INT8_C(  76), -INT8_C(  94),
+       INT8_C(  27), -INT8_C( 107),  INT8_C(  59), -INT8_C(  18),  INT8_C(  21),  INT8_C(   1), -INT8_C(  91), -INT8_C(  45),
+       INT8_C(   6), -INT8_C(  21), -INT8_C(  22),  INT8_C(  32),  INT8_C(  30),  INT8_C(  44), -INT8_C( 110), -INT8_C(  49),
+       INT8_C( 122), -INT8_C(  48),  INT8_C(  69), -INT8_C(  10), -INT8_C( 117),  INT8_C( 108),  INT8_C(  52), -INT8_C(  48),
+       INT8_C(  66), -INT8_C( 121), -INT8_C(  11), -INT8_C(   9), -INT8_C(  72),  INT8_C(  65), -INT8_C( 103), -INT8_C(  45),
+      -INT8_C(  42), -INT8_C(  44), -INT8_C(  62), -INT8_C(  20), -INT8_C(  43),  INT8_C( 103), -INT8_C(  65), -INT8_C(  37),
+       INT8_C(  83) };
+  static const int16_t e[] =
+    {  INT16_C(     0), -INT16_C(   111),  INT16_C(    92),  INT16_C(   111),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    36),
+       INT16_C(    66), -INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    35),  INT16_C(     5),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(    67),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    12),  INT16_C(    59), -INT16_C(    67),
+      -INT16_C(   109),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    36), -INT16_C(   127),  INT16_C(   111),
+       INT16_C(     0), -INT16_C(    35),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   101),
+       INT16_C(    45),  INT16_C(     0), -INT16_C(    20),  INT16_C(   120), -INT16_C(     8), -INT16_C(    15),  INT16_C(     0),  INT16_C(    84),
+       INT16_C(     0),  INT16_C(   127),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    65),  INT16_C(     0),  INT16_C(     7),
+       INT16_C(    11),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    60), -INT16_C(    67),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    94),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(   118),  INT16_C(   113),  INT16_C(     0),  INT16_C(   126),  INT16_C(     0),  INT16_C(    34),
+      -INT16_C(     2),  INT16_C(     0),  INT16_C(    62),  INT16_C(   113),  INT16_C(    11),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(    69),  INT16_C(   101), -INT16_C(    78),  INT16_C(     0),  INT16_C(    34),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(    66),  INT16_C(     0),  INT16_C(    27),  INT16_C(     0), -INT16_C(    79), -INT16_C(    79),  INT16_C(     0),  INT16_C(    42),
+       INT16_C(    51),  INT16_C(     0),  INT16_C(     0), -INT16_C(    90),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   128),
+       INT16_C(    42),  INT16_C(     0), -INT16_C(    15),  INT16_C(     0),  INT16_C(    31),  INT16_C(   106),  INT16_C(    77), -INT16_C(    15),
+       INT16_C(    37),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    44),  INT16_C(     0), -INT16_C(    59),  INT16_C(     0),
+       INT16_C(    61),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    24),  INT16_C(     0),
+      -INT16_C(    78),  INT16_C(     0),  INT16_C(   107),  INT16_C(    52),  INT16_C(    19),  INT16_C(    52), -INT16_C(    76),  INT16_C(     0),
+       INT16_C(    59), -INT16_C(    90),  INT16_C(   115),  INT16_C(     0),  INT16_C(    16), -INT16_C(    64),  INT16_C(    76),  INT16_C(    53),
+       INT16_C(     0), -INT16_C(    17), -INT16_C(    38),  INT16_C(    71),  INT16_C(     0),  INT16_C(     0), -INT16_C(    38),  INT16_C(     0),
+      -INT16_C(   128), -INT16_C(     4),  INT16_C(     0),  INT16_C(     0), -INT16_C(    85),  INT16_C(     0),  INT16_C(     0),  INT16_C(    93),
+       INT16_C(     0),  INT16_C(    65),  INT16_C(     0), -INT16_C(    29),  INT16_C(     0),  INT16_C(    70),  INT16_C(    32), -INT16_C(    79),
+       INT16_C(     0), -INT16_C(   108),  INT16_C(     0), -INT16_C(     4),  INT16_C(     0),  INT16_C(     0),  INT16_C(    50),  INT16_C(     0),
+       INT16_C(    71),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    56),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(    61),  INT16_C(     0),  INT16_C(     0),  INT16_C(    90),  INT16_C(    21), -INT16_C(    20),  INT16_C(    42),
+       INT16_C(    87),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(    79),
+      -INT16_C(    63), -INT16_C(   119), -INT16_C(    82),  INT16_C(     0), -INT16_C(    32), -INT16_C(    32), -INT16_C(    35),  INT16_C(    39),
+      -INT16_C(    20), -INT16_C(    21),  INT16_C(     0), -INT16_C(   103), -INT16_C(    45), -INT16_C(   128), -INT16_C(    58),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    23),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   113),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(    62),  INT16_C(   118),  INT16_C(   124),  INT16_C(     0),  INT16_C(    39),  INT16_C(    61),
+       INT16_C(     0), -INT16_C(    43),  INT16_C(     0),  INT16_C(     0), -INT16_C(    75),  INT16_C(     0),  INT16_C(     0), -INT16_C(    94),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    21),  INT16_C(     0), -INT16_C(    91), -INT16_C(    45),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    32),  INT16_C(     0),  INT16_C(    44), -INT16_C(   110),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(    69), -INT16_C(    10),  INT16_C(     0),  INT16_C(   108),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     9), -INT16_C(    72),  INT16_C(    65), -INT16_C(   103),  INT16_C(     0),
+      -INT16_C(    42), -INT16_C(    44), -INT16_C(    62), -INT16_C(    20),  INT16_C(     0),  INT16_C(   103),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svld1sb_s16(pv, &(a[i]));
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  int8_t a[1024 / sizeof(int16_t)];
+  int16_t e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    ev = simde_svld1sb_s16(pv, &(a[i]));
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sb_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(   622427765), -INT32_C(  1919847054), -INT32_C(  1046740938), -INT32_C(   734196077),  INT32_C(  1523157909), -INT32_C(  1238513206),  INT32_C(   177628604),  INT32_C(  1303574978),
+      -INT32_C(   316172165),  INT32_C(  1148893454),  INT32_C(  1275467449), -INT32_C(  1172290779), -INT32_C(  1743459634),  INT32_C(  1867465139),  INT32_C(  1769661863),  INT32_C(  1521888479),
+      -INT32_C(   767042108),  INT32_C(  1326956950), -INT32_C(    40165928),  INT32_C(   800570464),  INT32_C(  1506266022), -INT32_C(  1261955571), -INT32_C(   618839300),  INT32_C(   859165550),
+       INT32_C(  1191541936),  INT32_C(   362159165), -INT32_C(  1710083527), -INT32_C(  1798714898), -INT32_C(  1561489259), -INT32_C(  1554598489),  INT32_C(  1719563256), -INT32_C(   157699258),
+       INT32_C(  1815977775), -INT32_C(   175975237), -INT32_C(   191917050), -INT32_C(   209168290), -INT32_C(  1886030360),  INT32_C(   573762346), -INT32_C(  1534480290), -INT32_C(  1835392413),
+       INT32_C(  2113919169), -INT32_C(  1301118548),  INT32_C(  1940259093),  INT32_C(  1097215577), -INT32_C(   841876573),  INT32_C(  1156580326),  INT32_C(   401111476),  INT32_C(  1571455899),
+       INT32_C(   131770715),  INT32_C(  1069108266), -INT32_C(  1498194099),  INT32_C(   820451725), -INT32_C(    67258347),  INT32_C(  1883303356),  INT32_C(    42412134),  INT32_C(   106901931),
+       INT32_C(    67975642), -INT32_C(   767244667), -INT32_C(  1300695259),  INT32_C(   635592464), -INT32_C(   735977448),  INT32_C(   876896717),  INT32_C(   892783497), -INT32_C(   683960835),
+       INT32_C(  1406945742),  INT32_C(   891625487),  INT32_C(   669490455),  INT32_C(   340642556),  INT32_C(  2011721386),  INT32_C(  1487613135), -INT32_C(   175250952),  INT32_C(  1154271606),
+       INT32_C(   563587090), -INT32_C(   547963704),  INT32_C(  1443315289), -INT32_C(  1301654520), -INT32_C(  1859562558),  INT32_C(  2011813247),  INT32_C(   762083254),  INT32_C(  1383151936),
+      -INT32_C(  1435301407),  INT32_C(   529124037),  INT32_C(   276140040), -INT32_C(  1497178140), -INT32_C(  1304958158),  INT32_C(  1999184320), -INT32_C(   660302184), -INT32_C(  1339419185),
+      -INT32_C(   463823586),  INT32_C(  1862526055),  INT32_C(  1501526132), -INT32_C(  1962983081), -INT32_C(   314820819), -INT32_C(   261855912), -INT32_C(   892860165),  INT32_C(  1014755870),
+      -INT32_C(   148843121),  INT32_C(   778445753), -INT32_C(   209197413),  INT32_C(  1417512487),  INT32_C(   356694461),  INT32_C(   436577822), -INT32_C(   840643153),  INT32_C(  1326014399),
+      -INT32_C(   297391563), -INT32_C(   383996851), -INT32_C(  1159945326), -INT32_C(   418490070),  INT32_C(   821907474), -INT32_C(  1505099017), -INT32_C(  1888276528), -INT32_C(  1008829298),
+      -INT32_C(   189651802),  INT32_C(  1675480785), -INT32_C(  1675773582),  INT32_C(   612576274),  INT32_C(  1934917756),  INT32_C(  1394188163),  INT32_C(  1558351054), -INT32_C(  1356807927),
+      -INT32_C(  1230777627),  INT32_C(   303726752),  INT32_C(  1269708601), -INT32_C(   529583517),  INT32_C(   894682290),  INT32_C(   831024483),  INT32_C(    42822649),  INT32_C(   296922412),
+       INT32_C(   549999999),  INT32_C(   254993110),  INT32_C(  2103173401), -INT32_C(   983709165), -INT32_C(   235163506),  INT32_C(   388137757),  INT32_C(   437891310), -INT32_C(   584266915),
+      -INT32_C(   134351839), -INT32_C(   284807210),  INT32_C(   594305296), -INT32_C(  1159083732), -INT32_C(  1750276998),  INT32_C(  1454296679), -INT32_C(   596588418), -INT32_C(  1262904173),
+       INT32_C(  1722529424), -INT32_C(   162090267),  INT32_C(  1058652691),  INT32_C(   117047948),  INT32_C(  1318954726), -INT32_C(   207336332), -INT32_C(  1479601132),  INT32_C(  1096583345),
+       INT32_C(   598214462), -INT32_C(   853934407),  INT32_C(  1275868096),  INT32_C(   475137589),  INT32_C(   560656556),  INT32_C(  1343491644), -INT32_C(   738729182), -INT32_C(  1458220181),
+       INT32_C(   348962139),  INT32_C(  2078402235),  INT32_C(  1321791001), -INT32_C(  1586881804),  INT32_C(  1187173386),  INT32_C(    93771490),  INT32_C(   618172089),  INT32_C(  1020128737),
+       INT32_C(  1699846570), -INT32_C(  1730071937),  INT32_C(   367503648), -INT32_C(   826912317),  INT32_C(   135559206),  INT32_C(   118336334),  INT32_C(   439084601),  INT32_C(  2119694547),
+       INT32_C(   300132497), -INT32_C(    72760102),  INT32_C(   823169133),  INT32_C(   150980322), -INT32_C(  1945103554), -INT32_C(   141353282), -INT32_C(   686637564),  INT32_C(  1196779958),
+      -INT32_C(   346539759),  INT32_C(  1810236157),  INT32_C(  1956443794), -INT32_C(    92496964),  INT32_C(  1837534638), -INT32_C(  1352394325), -INT32_C(  1920567593), -INT32_C(   254419745),
+       INT32_C(   316419349), -INT32_C(  1031945681),  INT32_C(  1966479801),  INT32_C(  1668330420), -INT32_C(   338627008), -INT32_C(   409324528), -INT32_C(  1972035413),  INT32_C(   293292796),
+      -INT32_C(  1490790537), -INT32_C(   764829415),  INT32_C(  1867030459), -INT32_C(  1831684014), -INT32_C(  1099062610), -INT32_C(  2103044137) };
+  static const int8_t a[] =
+    { -INT8_C(  41), -INT8_C( 108),  INT8_C(  67), -INT8_C(  81), -INT8_C(  31),      INT8_MIN,  INT8_C(  10), -INT8_C(   6),
+       INT8_C( 120),  INT8_C(  75), -INT8_C( 101),  INT8_C(  11), -INT8_C(  72),  INT8_C(  67),  INT8_C( 113),  INT8_C(  30),
+      -INT8_C( 104), -INT8_C(  11),  INT8_C( 105), -INT8_C(  34),  INT8_C(  29), -INT8_C(  93), -INT8_C(   2), -INT8_C( 112),
+       INT8_C(  37),  INT8_C(  16),  INT8_C(  22), -INT8_C( 117),  INT8_C(  71), -INT8_C(  45),  INT8_C(  77),  INT8_C(  30),
+       INT8_C( 103), -INT8_C( 112), -INT8_C(  50),  INT8_C(  72),  INT8_C(  17), -INT8_C(  40),  INT8_C(  66), -INT8_C( 119),
+       INT8_C(  35), -INT8_C(  35), -INT8_C( 108), -INT8_C(  37),  INT8_C(  32),  INT8_C(   5), -INT8_C(   7), -INT8_C(  71),
+      -INT8_C(   6),  INT8_C(  98), -INT8_C( 105),  INT8_C(  24),  INT8_C(   5), -INT8_C( 107), -INT8_C(  88),  INT8_C(  43),
+      -INT8_C(  90), -INT8_C(  66), -INT8_C(  74), -INT8_C(  19), -INT8_C( 111),  INT8_C(   3),  INT8_C(  12), -INT8_C(   7),
+      -INT8_C( 108), -INT8_C(  38),  INT8_C(  65), -INT8_C(  91), -INT8_C(  78), -INT8_C( 124),  INT8_C(  46), -INT8_C(  43),
+       INT8_C(  97), -INT8_C(  61), -INT8_C(  80), -INT8_C( 126), -INT8_C(  56), -INT8_C(  86),  INT8_C(  59), -INT8_C(  61),
+       INT8_C(  12), -INT8_C(  46), -INT8_C(  37),  INT8_C(  18),  INT8_C( 103), -INT8_C( 125),  INT8_C(  61),  INT8_C(  13),
+       INT8_C(  65), -INT8_C(  13), -INT8_C(   5), -INT8_C(  45), -INT8_C(   9),  INT8_C(   7), -INT8_C(  52), -INT8_C( 117),
+      -INT8_C(  31),  INT8_C(  13),  INT8_C(  48), -INT8_C( 109), -INT8_C( 111),  INT8_C(  94),  INT8_C( 104), -INT8_C(  13),
+       INT8_C(  33),  INT8_C(  24),  INT8_C( 117), -INT8_C(  22), -INT8_C(  62), -INT8_C(  80), -INT8_C(  83), -INT8_C(  49),
+      -INT8_C( 126), -INT8_C( 120), -INT8_C(  31), -INT8_C(  23),  INT8_C(  11),  INT8_C(  30), -INT8_C(   9),  INT8_C(  76),
+       INT8_C(  17), -INT8_C(  14),  INT8_C(  31),  INT8_C(   8), -INT8_C(   7), -INT8_C(  21), -INT8_C( 109), -INT8_C(  38),
+      -INT8_C(   7), -INT8_C(  61),  INT8_C( 109), -INT8_C( 118),  INT8_C(  34), -INT8_C(  43),  INT8_C( 125),  INT8_C(  67),
+      -INT8_C(  19), -INT8_C(  14),  INT8_C(  45), -INT8_C(  80), -INT8_C(  94), -INT8_C(  38),      INT8_MAX,  INT8_C(  36),
+       INT8_C(  98),  INT8_C(  96),  INT8_C(  14),  INT8_C( 109),  INT8_C( 126),  INT8_C(   5), -INT8_C(  70), -INT8_C( 113),
+      -INT8_C(   9), -INT8_C(  39), -INT8_C( 104), -INT8_C(  16), -INT8_C(  59),  INT8_C(  43), -INT8_C(  54), -INT8_C(  66),
+      -INT8_C(  17),  INT8_C(  55),  INT8_C(  72),  INT8_C(  17),  INT8_C(  12), -INT8_C(  58),  INT8_C(  84), -INT8_C(   7),
+      -INT8_C(  72), -INT8_C( 126), -INT8_C(  87),  INT8_C(  91),  INT8_C(  92),  INT8_C(  40),      INT8_MAX, -INT8_C(  65),
+      -INT8_C( 120), -INT8_C( 115),  INT8_C(  44),  INT8_C(   6), -INT8_C( 110), -INT8_C(  26), -INT8_C( 106), -INT8_C( 119),
+      -INT8_C(  64),  INT8_C(  46),  INT8_C( 121), -INT8_C( 123),  INT8_C(  89),  INT8_C(  67),  INT8_C(  67),  INT8_C(  72),
+       INT8_C( 122), -INT8_C( 117),  INT8_C(  89), -INT8_C( 122),  INT8_C(  81), -INT8_C(  82),      INT8_MIN,  INT8_C(  10),
+       INT8_C(  48),  INT8_C(  41),  INT8_C( 101), -INT8_C( 116),  INT8_C(  82), -INT8_C(  28) };
+  static const int32_t e[] =
+    { -INT32_C(          41), -INT32_C(         108),  INT32_C(          67), -INT32_C(          81),  INT32_C(           0), -INT32_C(         128),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(         120),  INT32_C(           0),  INT32_C(           0),  INT32_C(          11), -INT32_C(          72),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(         104),  INT32_C(           0),  INT32_C(         105),  INT32_C(           0),  INT32_C(           0), -INT32_C(          93), -INT32_C(           2),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(          22), -INT32_C(         117),  INT32_C(          71), -INT32_C(          45),  INT32_C(           0),  INT32_C(          30),
+       INT32_C(           0), -INT32_C(         112), -INT32_C(          50),  INT32_C(          72),  INT32_C(          17),  INT32_C(           0),  INT32_C(          66), -INT32_C(         119),
+       INT32_C(           0), -INT32_C(          35),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(         105),  INT32_C(           0),  INT32_C(           5),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(          66), -INT32_C(          74),  INT32_C(           0), -INT32_C(         111),  INT32_C(           0),  INT32_C(           0), -INT32_C(           7),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          46),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(          61),  INT32_C(           0), -INT32_C(         126), -INT32_C(          56),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(          12),  INT32_C(           0),  INT32_C(           0),  INT32_C(          18),  INT32_C(         103),  INT32_C(           0),  INT32_C(          61),  INT32_C(          13),
+       INT32_C(          65),  INT32_C(           0),  INT32_C(           0), -INT32_C(          45), -INT32_C(           9),  INT32_C(           7), -INT32_C(          52),  INT32_C(           0),
+      -INT32_C(          31),  INT32_C(           0),  INT32_C(          48),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(         104),  INT32_C(           0),
+       INT32_C(          33),  INT32_C(          24),  INT32_C(         117), -INT32_C(          22),  INT32_C(           0), -INT32_C(          80), -INT32_C(          83), -INT32_C(          49),
+      -INT32_C(         126),  INT32_C(           0), -INT32_C(          31),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          76),
+       INT32_C(          17),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(         118),  INT32_C(          34),  INT32_C(           0),  INT32_C(           0),  INT32_C(          67),
+      -INT32_C(          19), -INT32_C(          14),  INT32_C(           0), -INT32_C(          80), -INT32_C(          94),  INT32_C(           0),  INT32_C(         127),  INT32_C(          36),
+       INT32_C(           0),  INT32_C(          96),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5), -INT32_C(          70),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(          39),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(          54), -INT32_C(          66),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          17),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(         126),  INT32_C(           0),  INT32_C(          91),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(         115),  INT32_C(           0),  INT32_C(           0), -INT32_C(         110), -INT32_C(          26), -INT32_C(         106),  INT32_C(           0),
+      -INT32_C(          64),  INT32_C(           0),  INT32_C(           0), -INT32_C(         123),  INT32_C(           0),  INT32_C(          67),  INT32_C(          67),  INT32_C(          72),
+       INT32_C(           0), -INT32_C(         117),  INT32_C(           0),  INT32_C(           0),  INT32_C(          81), -INT32_C(          82), -INT32_C(         128),  INT32_C(           0),
+       INT32_C(          48),  INT32_C(          41),  INT32_C(           0), -INT32_C(         116),  INT32_C(          82), -INT32_C(          28) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1sb_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  int8_t a[1024 / sizeof(int32_t)];
+  int32_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1sb_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sb_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 2488481834540914763),  INT64_C( 2823537807109892659),  INT64_C( 4604196598191651412), -INT64_C( 2080221467399284536),
+       INT64_C(  258866614427251562), -INT64_C( 3590437104246242729), -INT64_C( 6965051195391642705), -INT64_C( 2756609310830240189),
+      -INT64_C( 1777543544902327423),  INT64_C( 4427066534114646567),  INT64_C( 2522769920531805836),  INT64_C( 9139138442393710475),
+       INT64_C( 3465278055882105760), -INT64_C( 6248108840486566786), -INT64_C( 2739298745831350024),  INT64_C( 6411622529820326782),
+       INT64_C( 7711464305786931659),  INT64_C( 1254747382763542179),  INT64_C(  182649242469954914), -INT64_C( 3390798178499601183),
+      -INT64_C( 4856384422055478975),  INT64_C( 3938651674884510334),  INT64_C( 6548918273598394972),  INT64_C( 1774670968253538250),
+       INT64_C( 7725046571360207966), -INT64_C(  865629459523128846),  INT64_C( 1877918927889359420),  INT64_C( 5045310211278635541),
+       INT64_C( 2100912921327258318),  INT64_C( 1165835080684546466), -INT64_C( 3806152231594163774),  INT64_C( 7999725141480642519),
+       INT64_C( 6218999065022808582), -INT64_C( 3071247055229799813), -INT64_C( 3368668355808975426), -INT64_C( 5099037178121422804),
+       INT64_C( 3845856073695782742),  INT64_C( 7734057893905100651),  INT64_C( 9067190056638233610),  INT64_C( 5658358384975045657),
+       INT64_C( 1575335908957778158),  INT64_C( 5746565934505746855), -INT64_C( 2670308292708556765), -INT64_C( 5704885613994034291),
+      -INT64_C( 8477123722852488035), -INT64_C(  420348969573486699),  INT64_C( 3736123636246805822),  INT64_C( 5264018211400613787),
+       INT64_C( 3325604419848857016), -INT64_C( 2185878990520580646),  INT64_C( 1479917883367627184), -INT64_C( 8778219572102545096),
+      -INT64_C( 9031043639758635548), -INT64_C( 7578751238952274866), -INT64_C( 6664353919278468362),  INT64_C( 6416421610475550135),
+      -INT64_C( 4207344503807857038), -INT64_C( 6722879545919746250), -INT64_C( 3726565870964465606), -INT64_C(  551588119962333046),
+      -INT64_C( 1673175557470998645),  INT64_C( 4597252751469411710), -INT64_C(  271574482527396519),  INT64_C( 8393394592941837565),
+      -INT64_C( 4891686282860261757),  INT64_C( 3890744888788460474),  INT64_C(  936711403583300241), -INT64_C( 3402176716254217621),
+       INT64_C( 4004583517047832473) };
+  static const int8_t a[] =
+    {  INT8_C(  49), -INT8_C( 105), -INT8_C(  93),  INT8_C(  47),  INT8_C( 123), -INT8_C(  10), -INT8_C( 106),  INT8_C( 126),
+       INT8_C(  94), -INT8_C(  78), -INT8_C(  51),  INT8_C( 109), -INT8_C(  19), -INT8_C(  16),  INT8_C( 115), -INT8_C( 126),
+      -INT8_C( 106), -INT8_C(  78), -INT8_C( 105),  INT8_C(  30),  INT8_C( 112), -INT8_C(  65), -INT8_C( 114),  INT8_C(  39),
+       INT8_C(  39),      INT8_MAX, -INT8_C(   2),  INT8_C(  16), -INT8_C(  81),  INT8_C(  74),  INT8_C(  97), -INT8_C(  32),
+      -INT8_C(  31),  INT8_C(   5),  INT8_C(  16),  INT8_C(  92), -INT8_C(   5), -INT8_C(  90), -INT8_C(  37),  INT8_C(  89),
+       INT8_C(  89), -INT8_C(  88), -INT8_C(  57),  INT8_C(  70), -INT8_C( 104),  INT8_C(  58), -INT8_C(  56),  INT8_C(  47),
+      -INT8_C(  20),  INT8_C(  95),  INT8_C(  77),  INT8_C(  92),  INT8_C(  31), -INT8_C(  37), -INT8_C( 124),  INT8_C(  70),
+       INT8_C(  90), -INT8_C( 126),  INT8_C(  86),  INT8_C(  10), -INT8_C(  52), -INT8_C(  73), -INT8_C(  22), -INT8_C(  83),
+      -INT8_C(  68), -INT8_C(   6),  INT8_C(   9), -INT8_C(  72), -INT8_C(  95) };
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  47),
+       INT64_C(                   0), -INT64_C(                  10), -INT64_C(                 106),  INT64_C(                 126),
+       INT64_C(                  94),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                  16),  INT64_C(                 115),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  30),
+       INT64_C(                 112),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                 127),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  97),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   5),  INT64_C(                  16),  INT64_C(                  92),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                  57),  INT64_C(                  70),
+      -INT64_C(                 104),  INT64_C(                  58),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                  95),  INT64_C(                   0),  INT64_C(                  92),
+       INT64_C(                  31), -INT64_C(                  37), -INT64_C(                 124),  INT64_C(                   0),
+       INT64_C(                  90), -INT64_C(                 126),  INT64_C(                  86),  INT64_C(                  10),
+      -INT64_C(                  52),  INT64_C(                   0), -INT64_C(                  22),  INT64_C(                   0),
+      -INT64_C(                  68),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                  72),
+       INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1sb_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int8_t a[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1sb_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sb_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(   677), -INT16_C(  8468),  INT16_C( 26275),  INT16_C( 19753),  INT16_C( 29237), -INT16_C( 22946), -INT16_C(  2793), -INT16_C( 25965),
+       INT16_C( 22617), -INT16_C(  8065), -INT16_C( 28417),  INT16_C( 28992),  INT16_C( 14204),  INT16_C( 19370),  INT16_C( 19325),  INT16_C(  8930),
+      -INT16_C( 12723), -INT16_C(  4096),  INT16_C( 10548),  INT16_C( 27197), -INT16_C( 25700), -INT16_C( 19696), -INT16_C( 23663), -INT16_C(  5555),
+      -INT16_C( 13060), -INT16_C(  1078),  INT16_C(  2909), -INT16_C(  9876),  INT16_C(  5954), -INT16_C( 16604),  INT16_C(  1634), -INT16_C( 20510),
+      -INT16_C(  7468),  INT16_C(  2207), -INT16_C(  8948), -INT16_C( 22414), -INT16_C( 32136),  INT16_C(  2395), -INT16_C( 22490),  INT16_C(  8948),
+      -INT16_C( 16779), -INT16_C( 11747), -INT16_C( 30263),  INT16_C(  3243), -INT16_C( 12384),  INT16_C(   715), -INT16_C( 21035), -INT16_C( 22095),
+       INT16_C( 20880), -INT16_C( 25423),  INT16_C(  9262), -INT16_C( 22972), -INT16_C( 24666), -INT16_C( 13136), -INT16_C( 23481), -INT16_C( 17170),
+       INT16_C(  2914),  INT16_C( 11406),  INT16_C( 14741),  INT16_C( 13624),  INT16_C(   776), -INT16_C(  8904), -INT16_C(  5711),  INT16_C( 16774),
+       INT16_C( 14394),  INT16_C( 26845),  INT16_C(  8540),  INT16_C(   527), -INT16_C( 16448),  INT16_C(  1999), -INT16_C( 17053), -INT16_C( 14908),
+       INT16_C( 21193),  INT16_C( 24305),  INT16_C( 10636), -INT16_C( 27501), -INT16_C( 13523), -INT16_C(  8590), -INT16_C(  1867), -INT16_C(  4321),
+      -INT16_C(   976), -INT16_C( 29608),  INT16_C( 26397), -INT16_C(  8817),  INT16_C( 24102), -INT16_C( 30236), -INT16_C( 22501), -INT16_C(  7090),
+       INT16_C( 16635), -INT16_C( 30910), -INT16_C( 10647), -INT16_C( 27109), -INT16_C( 29279),  INT16_C( 22132), -INT16_C( 27770), -INT16_C( 18874),
+      -INT16_C( 24945), -INT16_C( 21437), -INT16_C( 11771),  INT16_C( 11145),  INT16_C( 28208),  INT16_C( 19380),  INT16_C(   534),  INT16_C(  4400),
+       INT16_C( 29250), -INT16_C( 21352), -INT16_C( 19384), -INT16_C(  5566), -INT16_C( 18623), -INT16_C( 14528), -INT16_C( 31158), -INT16_C(  9602),
+      -INT16_C( 16092),  INT16_C( 10630),  INT16_C(  4243), -INT16_C( 15532),  INT16_C(  2174), -INT16_C( 27634),  INT16_C( 15883),  INT16_C( 19878),
+       INT16_C( 16049), -INT16_C(  1543),  INT16_C( 15602),  INT16_C( 13539),  INT16_C(  9459),  INT16_C( 15867),  INT16_C( 31146), -INT16_C( 12521),
+      -INT16_C( 25030), -INT16_C( 12808),  INT16_C( 19886),  INT16_C( 11408), -INT16_C( 24747),  INT16_C( 24768),  INT16_C( 26333), -INT16_C( 29010),
+      -INT16_C( 22619), -INT16_C( 26744),  INT16_C( 27619), -INT16_C( 10549), -INT16_C( 14449),  INT16_C( 14868),  INT16_C( 11072),  INT16_C( 31497),
+       INT16_C(   457),  INT16_C( 30536), -INT16_C(  9906), -INT16_C( 23389),  INT16_C( 25720),  INT16_C( 21764), -INT16_C( 19766),  INT16_C( 28644),
+       INT16_C( 27738),  INT16_C( 15623), -INT16_C( 11561),  INT16_C( 26388),  INT16_C( 10393), -INT16_C(  9567), -INT16_C( 21933),  INT16_C(  7509),
+      -INT16_C( 25173), -INT16_C(  1388),  INT16_C( 14454), -INT16_C(  4450), -INT16_C( 23908),  INT16_C( 26180),  INT16_C( 10325), -INT16_C( 20522),
+      -INT16_C(  8812),  INT16_C( 27628),  INT16_C(   175),  INT16_C( 18898),  INT16_C( 29480),  INT16_C( 31779),  INT16_C( 30749), -INT16_C( 13927),
+       INT16_C( 11541), -INT16_C( 29501),  INT16_C( 24933),  INT16_C(   378), -INT16_C( 16893),  INT16_C( 22632),  INT16_C( 16102),  INT16_C( 31239),
+      -INT16_C(  3045), -INT16_C( 13594), -INT16_C( 18188),  INT16_C(  7443),  INT16_C( 13868),  INT16_C( 18841),  INT16_C( 12974), -INT16_C( 15342),
+      -INT16_C( 10913), -INT16_C( 15024), -INT16_C( 13770),  INT16_C( 15046),  INT16_C( 11913),  INT16_C( 28562), -INT16_C( 26004), -INT16_C( 30742),
+      -INT16_C( 12146), -INT16_C( 32174),  INT16_C( 25992), -INT16_C( 19297),  INT16_C( 14492),  INT16_C( 19198),  INT16_C(  4202), -INT16_C( 13810),
+       INT16_C( 24294),  INT16_C(  7311),  INT16_C( 21801), -INT16_C( 19882), -INT16_C(  5756), -INT16_C(  4063),  INT16_C(  2947),  INT16_C(  4472),
+      -INT16_C( 13605),  INT16_C( 25747),  INT16_C( 13103), -INT16_C( 13544),  INT16_C(  5739), -INT16_C( 10730),  INT16_C(  9255),  INT16_C(  3488),
+       INT16_C( 12163), -INT16_C( 21463), -INT16_C( 32636),  INT16_C(  2142),  INT16_C( 32617), -INT16_C(  4871),  INT16_C( 29067),  INT16_C( 26365),
+      -INT16_C( 28613),  INT16_C( 27338), -INT16_C(  7229),  INT16_C( 12086),  INT16_C( 19705),  INT16_C(  8197), -INT16_C( 23184), -INT16_C(  3283),
+       INT16_C( 22484),  INT16_C( 22687), -INT16_C(   553),  INT16_C( 16481),  INT16_C( 23165),  INT16_C(  2092),  INT16_C( 10699),  INT16_C(  1646),
+       INT16_C( 14777),  INT16_C( 32112), -INT16_C( 23012),  INT16_C(  5548), -INT16_C( 19982),  INT16_C( 25398),  INT16_C( 25430),  INT16_C( 10838),
+      -INT16_C(  2374), -INT16_C( 28286), -INT16_C(  7181),  INT16_C( 28881), -INT16_C(   707),  INT16_C(  2168), -INT16_C(  6362), -INT16_C(  8178),
+       INT16_C( 32544),  INT16_C( 15453),  INT16_C(  2341),  INT16_C(  6225), -INT16_C( 30790),  INT16_C(  4219), -INT16_C( 11797), -INT16_C( 23238),
+      -INT16_C( 17209), -INT16_C( 17609),  INT16_C(  2208), -INT16_C(  8917), -INT16_C( 23546),  INT16_C( 11494), -INT16_C(  2933), -INT16_C( 21748),
+       INT16_C( 26995), -INT16_C( 26137),  INT16_C( 14450),  INT16_C( 11441),  INT16_C( 11456), -INT16_C( 21700),  INT16_C( 30461), -INT16_C( 15024),
+      -INT16_C( 30925), -INT16_C( 11392), -INT16_C( 21616), -INT16_C( 26960), -INT16_C( 27057), -INT16_C(  9534), -INT16_C( 12405), -INT16_C(   379),
+       INT16_C( 27704), -INT16_C( 21609),  INT16_C( 18597),  INT16_C( 26071),  INT16_C(  5236),  INT16_C( 29200),  INT16_C( 24714), -INT16_C( 17097),
+      -INT16_C( 18456),  INT16_C( 30864),  INT16_C( 16738), -INT16_C( 19954), -INT16_C( 12073),  INT16_C( 25228),  INT16_C(  4767), -INT16_C( 10143),
+      -INT16_C(  1922),  INT16_C(  9091),  INT16_C( 23105), -INT16_C( 19064), -INT16_C( 26514), -INT16_C(  1753),  INT16_C( 24313), -INT16_C(  7754),
+       INT16_C( 18197),  INT16_C( 30809),  INT16_C( 26504),  INT16_C( 24362), -INT16_C( 18889), -INT16_C( 10302),  INT16_C(  9160),  INT16_C( 18351),
+       INT16_C( 12827),  INT16_C( 23658), -INT16_C(  3188), -INT16_C(  1262),  INT16_C( 14731), -INT16_C( 31500), -INT16_C( 21864), -INT16_C( 21147),
+      -INT16_C( 16655),  INT16_C( 31013),  INT16_C( 20261),  INT16_C( 24025), -INT16_C( 25850), -INT16_C( 12748), -INT16_C(  7234), -INT16_C(  9963),
+      -INT16_C( 32747), -INT16_C( 24266),  INT16_C( 18547), -INT16_C(   356), -INT16_C( 28543),  INT16_C(  6531), -INT16_C(  6085),  INT16_C( 11463),
+      -INT16_C(  4953), -INT16_C( 13146),  INT16_C( 32572),  INT16_C( 16937),  INT16_C( 23834), -INT16_C( 10224),  INT16_C(  9792),  INT16_C( 21937),
+      -INT16_C(  6234),  INT16_C(  6647), -INT16_C( 27857), -INT16_C( 20201), -INT16_C( 26076),  INT16_C( 24522), -INT16_C( 28285),  INT16_C( 10891),
+       INT16_C( 12670), -INT16_C( 17674),  INT16_C(  8368), -INT16_C( 13572),  INT16_C(  3197), -INT16_C( 16734),  INT16_C( 21554), -INT16_C( 10221),
+       INT16_C(  2619),  INT16_C( 27633),  INT16_C(  2462), -INT16_C( 15844), -INT16_C(  6493),  INT16_C(  9761), -INT16_C( 21384), -INT16_C(  2480),
+       INT16_C( 18398), -INT16_C( 29008), -INT16_C( 21401), -INT16_C(  7079), -INT16_C(  1096), -INT16_C(  5214), -INT16_C( 18865), -INT16_C( 29757),
+      -INT16_C( 19008),  INT16_C( 24310),  INT16_C(  4798),  INT16_C( 24864),  INT16_C( 16888),  INT16_C( 28808), -INT16_C( 10002), -INT16_C( 13210),
+       INT16_C(  5663), -INT16_C( 31142), -INT16_C( 19518),  INT16_C( 31595),  INT16_C(  3503), -INT16_C(   410),  INT16_C( 10691), -INT16_C( 31607),
+       INT16_C( 32734), -INT16_C( 25374),  INT16_C(   913), -INT16_C( 29954), -INT16_C( 31164),  INT16_C( 13050),  INT16_C( 24926),  INT16_C( 32510),
+       INT16_C( 22903),  INT16_C( 14852),  INT16_C( 28428), -INT16_C( 17483),  INT16_C(  7037),  INT16_C( 16570),  INT16_C( 17220),  INT16_C(  9156),
+      -INT16_C( 22589),  INT16_C( 21695), -INT16_C( 16982), -INT16_C(  4386), -INT16_C(  9917), -INT16_C( 24031),  INT16_C(  7994), -INT16_C( 20192),
+       INT16_C(  9336), -INT16_C( 31253), -INT16_C( 24428),  INT16_C(  4416), -INT16_C(  1349),  INT16_C(    81),  INT16_C(  5694),  INT16_C(   291),
+      -INT16_C(  7491),  INT16_C( 26453),  INT16_C( 13472), -INT16_C(  7339),  INT16_C( 30221),  INT16_C( 18309), -INT16_C( 23146),  INT16_C(  3832),
+      -INT16_C(  6966),  INT16_C( 24211), -INT16_C( 11132),  INT16_C( 16495), -INT16_C( 16178),  INT16_C(  3136),  INT16_C( 25558), -INT16_C( 27891),
+       INT16_C( 25413), -INT16_C(  6662),  INT16_C( 20631), -INT16_C( 23351),  INT16_C( 20166),  INT16_C( 23787), -INT16_C(  7180) };
+  static const int8_t a[] =
+    {  INT8_C(  94), -INT8_C(  48), -INT8_C(  61),  INT8_C(  79), -INT8_C(  47), -INT8_C( 111), -INT8_C(  45),      INT8_MAX,
+      -INT8_C( 105),  INT8_C(  25), -INT8_C( 107), -INT8_C( 117), -INT8_C( 106),  INT8_C(  50),  INT8_C(  28), -INT8_C(  93),
+       INT8_C(  11),  INT8_C(  74),  INT8_C(  99),  INT8_C( 120), -INT8_C(  35),  INT8_C(  73), -INT8_C(  67), -INT8_C(  10),
+      -INT8_C(  71),  INT8_C(   3),  INT8_C(  37), -INT8_C(  41),  INT8_C(  55), -INT8_C(  11), -INT8_C(  30), -INT8_C( 106),
+      -INT8_C(  59), -INT8_C(  90), -INT8_C(  27), -INT8_C( 106),  INT8_C(  55), -INT8_C(  71),  INT8_C(  21), -INT8_C(  49),
+      -INT8_C(  46), -INT8_C(  85),  INT8_C(  90),  INT8_C( 104), -INT8_C(  35),  INT8_C( 118),  INT8_C(  11), -INT8_C(  24),
+      -INT8_C(  64),  INT8_C( 111),  INT8_C(  96), -INT8_C(  99), -INT8_C(  72),  INT8_C(  30), -INT8_C( 108),  INT8_C( 113),
+       INT8_C(  33), -INT8_C(  71),  INT8_C(  72),  INT8_C(  88), -INT8_C(  82),  INT8_C(  42), -INT8_C(  18),  INT8_C( 115),
+      -INT8_C(  48), -INT8_C(  44),  INT8_C(  10),  INT8_C(   8), -INT8_C( 115),  INT8_C(  31), -INT8_C(  41),  INT8_C(  95),
+      -INT8_C(  54),  INT8_C(  49), -INT8_C(  56), -INT8_C(  88), -INT8_C(  89), -INT8_C(  45), -INT8_C( 112),  INT8_C( 103),
+       INT8_C(  66), -INT8_C(  15),  INT8_C(   5), -INT8_C(   6),  INT8_C(  15), -INT8_C( 103),  INT8_C( 107),  INT8_C(  48),
+       INT8_C(  82), -INT8_C(  77), -INT8_C( 120),  INT8_C(   0), -INT8_C(  34),  INT8_C( 119),  INT8_C( 115), -INT8_C(  82),
+       INT8_C(  75),  INT8_C( 125), -INT8_C(  74), -INT8_C(  40), -INT8_C(  99), -INT8_C( 115),  INT8_C(  55),  INT8_C( 103),
+      -INT8_C(  66), -INT8_C(   1),  INT8_C(  15),  INT8_C( 101), -INT8_C(  45), -INT8_C(  96), -INT8_C(  51),  INT8_C(  21),
+      -INT8_C( 111), -INT8_C(  46),  INT8_C(  16), -INT8_C(  96),  INT8_C( 107),  INT8_C( 123), -INT8_C(  48), -INT8_C(  67),
+       INT8_C(  47),  INT8_C(  88), -INT8_C(  67),  INT8_C(  13), -INT8_C(  49),  INT8_C(  48), -INT8_C(  69),  INT8_C(  26),
+      -INT8_C(  82),  INT8_C( 114), -INT8_C(  14),  INT8_C(  75), -INT8_C(   1),  INT8_C(  42), -INT8_C(  78), -INT8_C(  66),
+       INT8_C(  41), -INT8_C(  62),  INT8_C(  35), -INT8_C(   4),  INT8_C(  98), -INT8_C(  16),  INT8_C(  18), -INT8_C(  13),
+      -INT8_C(  62),  INT8_C(  34), -INT8_C( 109),  INT8_C(  45), -INT8_C(  99),  INT8_C(  99), -INT8_C(  22), -INT8_C(  52),
+      -INT8_C(  69), -INT8_C(  89), -INT8_C(  39), -INT8_C( 117), -INT8_C(  40), -INT8_C( 107), -INT8_C(  91), -INT8_C( 122),
+       INT8_C(   7), -INT8_C( 104), -INT8_C(  47),  INT8_C(   6), -INT8_C(  62), -INT8_C( 125), -INT8_C(  60), -INT8_C(  21),
+       INT8_C(  69), -INT8_C(  24), -INT8_C(  24), -INT8_C(  89), -INT8_C(  40), -INT8_C(   6), -INT8_C( 102), -INT8_C( 101),
+       INT8_C(  28),  INT8_C(  45), -INT8_C(  56), -INT8_C(  71), -INT8_C( 112), -INT8_C(  77), -INT8_C( 122),  INT8_C(  76),
+       INT8_C(  90),  INT8_C(  95), -INT8_C(  41),  INT8_C(  50), -INT8_C(  12),  INT8_C( 124), -INT8_C(  72), -INT8_C(   5),
+       INT8_C(  20), -INT8_C( 119),  INT8_C(   2), -INT8_C(  42),  INT8_C(  13), -INT8_C(  58), -INT8_C(  62),  INT8_C(  82),
+      -INT8_C(  82), -INT8_C(  86), -INT8_C(   6), -INT8_C( 121), -INT8_C(  92), -INT8_C( 108),  INT8_C(  34), -INT8_C(  64),
+      -INT8_C(  62), -INT8_C(  22),  INT8_C( 121),  INT8_C(  82), -INT8_C(  99), -INT8_C(   1), -INT8_C(  98), -INT8_C(   8),
+       INT8_C(  95),  INT8_C( 117),  INT8_C(  42),  INT8_C(  83), -INT8_C(  14), -INT8_C(  29),  INT8_C(  79),  INT8_C(   6),
+       INT8_C( 108),  INT8_C(  81), -INT8_C(  35),  INT8_C( 121),  INT8_C(  23), -INT8_C(  97), -INT8_C(  52), -INT8_C(  58),
+       INT8_C(  73), -INT8_C(  58),  INT8_C(  77), -INT8_C(  19),  INT8_C(  90),  INT8_C( 111), -INT8_C(  83),  INT8_C(  28),
+       INT8_C(  89),  INT8_C(  38),  INT8_C( 111), -INT8_C(   9),  INT8_C(  38),  INT8_C(  13), -INT8_C(  17), -INT8_C( 123),
+      -INT8_C( 125),  INT8_C(  25), -INT8_C(  40),  INT8_C( 117), -INT8_C(   4),  INT8_C(  39),  INT8_C( 123),  INT8_C( 105),
+       INT8_C( 120),  INT8_C(  88), -INT8_C(  30), -INT8_C( 112), -INT8_C(   9), -INT8_C(  82),  INT8_C(  86),  INT8_C(  64),
+       INT8_C( 116), -INT8_C(  93),  INT8_C(  45), -INT8_C(  49),  INT8_C(  18), -INT8_C(  38), -INT8_C(  21),  INT8_C( 107),
+       INT8_C(   1),  INT8_C(  90),  INT8_C(  98),  INT8_C(  39),  INT8_C( 104),  INT8_C(  81), -INT8_C(  84), -INT8_C(  21),
+       INT8_C( 107), -INT8_C( 124),  INT8_C(  96),  INT8_C( 103), -INT8_C(  84), -INT8_C(  37), -INT8_C(  48),  INT8_C(  36),
+       INT8_C(  52), -INT8_C(  77), -INT8_C(  76),  INT8_C(  43),  INT8_C(  97),  INT8_C(  10),  INT8_C( 108), -INT8_C(  42),
+      -INT8_C(  83), -INT8_C( 103), -INT8_C(  91), -INT8_C(  65),  INT8_C( 116), -INT8_C( 112),  INT8_C(  43),  INT8_C( 117),
+      -INT8_C(  21), -INT8_C( 115), -INT8_C( 100),  INT8_C(  83), -INT8_C(  33),  INT8_C(  72),  INT8_C(  62),  INT8_C(  74),
+      -INT8_C(  52), -INT8_C(  98), -INT8_C(  79),  INT8_C( 120),  INT8_C( 121), -INT8_C( 126), -INT8_C(  99), -INT8_C(  83),
+       INT8_C(  53),  INT8_C(  81), -INT8_C(  39), -INT8_C( 106),  INT8_C(  92),  INT8_C(  69),  INT8_C( 108),  INT8_C(   9),
+      -INT8_C(  34),  INT8_C(  17), -INT8_C(  55),  INT8_C(  82), -INT8_C(  94), -INT8_C(  12), -INT8_C(  57), -INT8_C( 115),
+      -INT8_C( 127),  INT8_C(  99), -INT8_C(  32),  INT8_C(  96), -INT8_C(  85),  INT8_C(  30), -INT8_C(  86),  INT8_C( 120),
+      -INT8_C(  68),  INT8_C(  92), -INT8_C(  16),  INT8_C(  53), -INT8_C(  34), -INT8_C( 115), -INT8_C(  29),  INT8_C(  19),
+      -INT8_C(  33), -INT8_C(  68), -INT8_C(  87),  INT8_C(  59),  INT8_C(   1),  INT8_C(  22),  INT8_C(  68), -INT8_C(  33),
+       INT8_C(  39),  INT8_C(  13),  INT8_C(  50), -INT8_C(  55),  INT8_C(   1), -INT8_C(   7),  INT8_C(  86), -INT8_C( 125),
+       INT8_C(  93),  INT8_C(  54), -INT8_C(  29),  INT8_C(   8),  INT8_C(  84), -INT8_C( 114),      INT8_MIN,  INT8_C(  16),
+      -INT8_C(  22),  INT8_C( 113),  INT8_C(  70), -INT8_C(  56), -INT8_C(   2),  INT8_C(  41), -INT8_C(  37), -INT8_C(  35),
+      -INT8_C(  27), -INT8_C( 124),  INT8_C(  24), -INT8_C(  26), -INT8_C( 102),  INT8_C(  93), -INT8_C(  59), -INT8_C(  62),
+       INT8_C( 106), -INT8_C(   9), -INT8_C( 117),  INT8_C( 108), -INT8_C(  15), -INT8_C(  30), -INT8_C(  17),  INT8_C(  78),
+       INT8_C(  24), -INT8_C(  46),  INT8_C(  86),  INT8_C( 109),  INT8_C(  96), -INT8_C(  41),  INT8_C( 125),  INT8_C(  74),
+       INT8_C(  72), -INT8_C(  61),  INT8_C(  18),  INT8_C(  70), -INT8_C(  20), -INT8_C(  19),  INT8_C(  36), -INT8_C(  47),
+       INT8_C( 114),  INT8_C(  60), -INT8_C(  73),  INT8_C(  12), -INT8_C( 103),  INT8_C( 125), -INT8_C(  50),  INT8_C(   4),
+       INT8_C( 116),  INT8_C(  90),  INT8_C( 112),  INT8_C( 101),  INT8_C(  60),  INT8_C(  95), -INT8_C(  77),  INT8_C(  84),
+       INT8_C(  49),  INT8_C(  10), -INT8_C(  63), -INT8_C( 110), -INT8_C(  31),  INT8_C(  63), -INT8_C(  36),  INT8_C(  41),
+       INT8_C(   2), -INT8_C(  17),  INT8_C( 111), -INT8_C(  17), -INT8_C(  36), -INT8_C( 109), -INT8_C(  64),  INT8_C(  78),
+      -INT8_C(  48),  INT8_C( 120),  INT8_C(  91),  INT8_C( 105), -INT8_C(  11),  INT8_C(  41),  INT8_C( 109),  INT8_C( 105),
+      -INT8_C( 125), -INT8_C(  35), -INT8_C(  49), -INT8_C(  65),  INT8_C(  60), -INT8_C( 126),  INT8_C(  20) };
+  static const uint16_t e[] =
+    { UINT16_C(    0), UINT16_C(65488), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65425), UINT16_C(65491), UINT16_C(  127),
+      UINT16_C(    0), UINT16_C(   25), UINT16_C(65429), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   11), UINT16_C(   74), UINT16_C(    0), UINT16_C(    0), UINT16_C(65501), UINT16_C(   73), UINT16_C(65469), UINT16_C(65526),
+      UINT16_C(65465), UINT16_C(    3), UINT16_C(    0), UINT16_C(65495), UINT16_C(    0), UINT16_C(65525), UINT16_C(    0), UINT16_C(65430),
+      UINT16_C(65477), UINT16_C(    0), UINT16_C(65509), UINT16_C(65430), UINT16_C(   55), UINT16_C(    0), UINT16_C(   21), UINT16_C(    0),
+      UINT16_C(65490), UINT16_C(65451), UINT16_C(   90), UINT16_C(    0), UINT16_C(65501), UINT16_C(    0), UINT16_C(   11), UINT16_C(65512),
+      UINT16_C(    0), UINT16_C(  111), UINT16_C(    0), UINT16_C(65437), UINT16_C(65464), UINT16_C(   30), UINT16_C(65428), UINT16_C(  113),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   42), UINT16_C(65518), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65421), UINT16_C(    0), UINT16_C(65495), UINT16_C(   95),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65448), UINT16_C(65447), UINT16_C(65491), UINT16_C(65424), UINT16_C(  103),
+      UINT16_C(   66), UINT16_C(65521), UINT16_C(    0), UINT16_C(65530), UINT16_C(    0), UINT16_C(65433), UINT16_C(  107), UINT16_C(   48),
+      UINT16_C(    0), UINT16_C(65459), UINT16_C(65416), UINT16_C(    0), UINT16_C(65502), UINT16_C(    0), UINT16_C(  115), UINT16_C(65454),
+      UINT16_C(   75), UINT16_C(  125), UINT16_C(65462), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0),      UINT16_MAX, UINT16_C(   15), UINT16_C(  101), UINT16_C(65491), UINT16_C(65440), UINT16_C(65485), UINT16_C(   21),
+      UINT16_C(65425), UINT16_C(    0), UINT16_C(    0), UINT16_C(65440), UINT16_C(    0), UINT16_C(  123), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   88), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   26),
+      UINT16_C(65454), UINT16_C(  114), UINT16_C(    0), UINT16_C(    0),      UINT16_MAX, UINT16_C(    0), UINT16_C(    0), UINT16_C(65470),
+      UINT16_C(   41), UINT16_C(65474), UINT16_C(    0), UINT16_C(65532), UINT16_C(   98), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(65427), UINT16_C(   45), UINT16_C(    0), UINT16_C(    0), UINT16_C(65514), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(65497), UINT16_C(    0), UINT16_C(    0), UINT16_C(65429), UINT16_C(65445), UINT16_C(    0),
+      UINT16_C(    7), UINT16_C(65432), UINT16_C(    0), UINT16_C(    6), UINT16_C(65474), UINT16_C(    0), UINT16_C(    0), UINT16_C(65515),
+      UINT16_C(   69), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65435),
+      UINT16_C(    0), UINT16_C(   45), UINT16_C(    0), UINT16_C(    0), UINT16_C(65424), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   90), UINT16_C(   95), UINT16_C(65495), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65531),
+      UINT16_C(   20), UINT16_C(65417), UINT16_C(    2), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65474), UINT16_C(   82),
+      UINT16_C(65454), UINT16_C(65450), UINT16_C(    0), UINT16_C(65415), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65472),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   82), UINT16_C(65437),      UINT16_MAX, UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   95), UINT16_C(    0), UINT16_C(    0), UINT16_C(   83), UINT16_C(    0), UINT16_C(65507), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   81), UINT16_C(65501), UINT16_C(    0), UINT16_C(    0), UINT16_C(65439), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   73), UINT16_C(    0), UINT16_C(   77), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65453), UINT16_C(   28),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(  111), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(65496), UINT16_C(    0), UINT16_C(65532), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  120), UINT16_C(   88), UINT16_C(65506), UINT16_C(    0), UINT16_C(65527), UINT16_C(    0), UINT16_C(   86), UINT16_C(   64),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   18), UINT16_C(    0), UINT16_C(65515), UINT16_C(  107),
+      UINT16_C(    1), UINT16_C(   90), UINT16_C(    0), UINT16_C(   39), UINT16_C(  104), UINT16_C(    0), UINT16_C(65452), UINT16_C(65515),
+      UINT16_C(    0), UINT16_C(65412), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65499), UINT16_C(    0), UINT16_C(   36),
+      UINT16_C(   52), UINT16_C(65459), UINT16_C(65460), UINT16_C(   43), UINT16_C(   97), UINT16_C(   10), UINT16_C(  108), UINT16_C(65494),
+      UINT16_C(    0), UINT16_C(65433), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  117),
+      UINT16_C(65515), UINT16_C(    0), UINT16_C(    0), UINT16_C(   83), UINT16_C(65503), UINT16_C(    0), UINT16_C(    0), UINT16_C(   74),
+      UINT16_C(65484), UINT16_C(    0), UINT16_C(    0), UINT16_C(  120), UINT16_C(  121), UINT16_C(65410), UINT16_C(    0), UINT16_C(65453),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   92), UINT16_C(   69), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(65481), UINT16_C(   82), UINT16_C(    0), UINT16_C(65524), UINT16_C(65479), UINT16_C(65421),
+      UINT16_C(65409), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65451), UINT16_C(   30), UINT16_C(65450), UINT16_C(  120),
+      UINT16_C(65468), UINT16_C(   92), UINT16_C(    0), UINT16_C(   53), UINT16_C(65502), UINT16_C(    0), UINT16_C(65507), UINT16_C(    0),
+      UINT16_C(65503), UINT16_C(65468), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   22), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   39), UINT16_C(    0), UINT16_C(   50), UINT16_C(65481), UINT16_C(    1), UINT16_C(    0), UINT16_C(   86), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   54), UINT16_C(    0), UINT16_C(    8), UINT16_C(    0), UINT16_C(65422), UINT16_C(    0), UINT16_C(   16),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65480), UINT16_C(65534), UINT16_C(    0), UINT16_C(65499), UINT16_C(65501),
+      UINT16_C(    0), UINT16_C(65412), UINT16_C(   24), UINT16_C(65510), UINT16_C(65434), UINT16_C(   93), UINT16_C(65477), UINT16_C(65474),
+      UINT16_C(  106), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65519), UINT16_C(   78),
+      UINT16_C(    0), UINT16_C(65490), UINT16_C(   86), UINT16_C(    0), UINT16_C(    0), UINT16_C(65495), UINT16_C(    0), UINT16_C(   74),
+      UINT16_C(    0), UINT16_C(65475), UINT16_C(    0), UINT16_C(   70), UINT16_C(65516), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   12), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  116), UINT16_C(    0), UINT16_C(  112), UINT16_C(  101), UINT16_C(   60), UINT16_C(   95), UINT16_C(    0), UINT16_C(   84),
+      UINT16_C(    0), UINT16_C(   10), UINT16_C(65473), UINT16_C(    0), UINT16_C(65505), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    2), UINT16_C(    0), UINT16_C(    0), UINT16_C(65519), UINT16_C(    0), UINT16_C(    0), UINT16_C(65472), UINT16_C(    0),
+      UINT16_C(65488), UINT16_C(    0), UINT16_C(   91), UINT16_C(    0), UINT16_C(65525), UINT16_C(    0), UINT16_C(    0), UINT16_C(  105),
+      UINT16_C(    0), UINT16_C(65501), UINT16_C(    0), UINT16_C(65471), UINT16_C(    0), UINT16_C(    0), UINT16_C(   20) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svld1sb_u16(pv, &(a[i]));
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(uint16_t)];
+  int8_t a[1024 / sizeof(uint16_t)];
+  uint16_t e[1024 / sizeof(uint16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    ev = simde_svld1sb_u16(pv, &(a[i]));
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sb_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(  1176850789),  INT32_C(   152344602),  INT32_C(   293919850),  INT32_C(  1254976677),  INT32_C(  1891279083),  INT32_C(   428856185),  INT32_C(  1123489762),  INT32_C(   220072050),
+      -INT32_C(   775423817), -INT32_C(    86320240),  INT32_C(  1544249015), -INT32_C(  1230579253), -INT32_C(   215522951),  INT32_C(   369931828),  INT32_C(  1062732749), -INT32_C(  1035176437),
+      -INT32_C(    23850130), -INT32_C(  1493668114), -INT32_C(  1744698163),  INT32_C(  1447995869),  INT32_C(  1045001482), -INT32_C(   128690901),  INT32_C(  1681370200), -INT32_C(  1859746781),
+      -INT32_C(  2037335401), -INT32_C(   164853719),  INT32_C(  1770925708), -INT32_C(   507454249),  INT32_C(  2099186002), -INT32_C(  1216973985),  INT32_C(  1125887264), -INT32_C(   908836303),
+       INT32_C(   625960188),  INT32_C(  2031844333), -INT32_C(  2115786327), -INT32_C(   664624250),  INT32_C(   190153388),  INT32_C(   365153269), -INT32_C(  1437016455),  INT32_C(   494087456),
+       INT32_C(  2118304401), -INT32_C(   403153347), -INT32_C(  1922508025),  INT32_C(   711314046),  INT32_C(  1110883148), -INT32_C(    11011706), -INT32_C(   123031337),  INT32_C(  1846877661),
+       INT32_C(   502093792), -INT32_C(  1123752523),  INT32_C(  1045064896), -INT32_C(  2090291145), -INT32_C(   238707093),  INT32_C(  1878072727), -INT32_C(  1436050483), -INT32_C(  1743225672),
+      -INT32_C(  1984559661), -INT32_C(  1438205206),  INT32_C(  1592299559), -INT32_C(  1411296960), -INT32_C(  2019710993), -INT32_C(  1846112572), -INT32_C(   516203223), -INT32_C(  1401269287),
+       INT32_C(  1127559257),  INT32_C(   300841962),  INT32_C(  1282397708),  INT32_C(   402149671), -INT32_C(  1130457608),  INT32_C(  1280152611), -INT32_C(   902985487),  INT32_C(   880191451),
+      -INT32_C(  1032278825),  INT32_C(   869492263),  INT32_C(  1686127420), -INT32_C(  1938065260),  INT32_C(   810031373), -INT32_C(  1636002387), -INT32_C(   127358691),  INT32_C(   674094673),
+      -INT32_C(  1293245046),  INT32_C(  1206238731), -INT32_C(  1783929599), -INT32_C(   366926115), -INT32_C(   333813441),  INT32_C(   462067454), -INT32_C(  1860963776),  INT32_C(  1538867409),
+      -INT32_C(   267541275),  INT32_C(  1664676706),  INT32_C(   922280792),  INT32_C(  1226840330), -INT32_C(  2143929470),  INT32_C(   295420113), -INT32_C(  2069713229), -INT32_C(   723559185),
+       INT32_C(  1657138432),  INT32_C(   952499680), -INT32_C(   361841184),  INT32_C(  1479839702), -INT32_C(  1680315702), -INT32_C(   575835350),  INT32_C(   274812705), -INT32_C(  1411038805),
+       INT32_C(   235776558), -INT32_C(  2025401689),  INT32_C(  1702016399),  INT32_C(   247309892),  INT32_C(   984192272),  INT32_C(   706237960),  INT32_C(  1362786726), -INT32_C(   386064454),
+       INT32_C(  1895172809),  INT32_C(  1828208093),  INT32_C(   919759602),  INT32_C(   541363984),  INT32_C(   760933669), -INT32_C(   363367868), -INT32_C(  1506045204),  INT32_C(  2072983729),
+       INT32_C(   552305987), -INT32_C(  1265835070),  INT32_C(  1575640653),  INT32_C(   326971118),  INT32_C(  1614862364),  INT32_C(   910858314), -INT32_C(   606239446),  INT32_C(    22441150),
+      -INT32_C(  1272888591),  INT32_C(  1936239909), -INT32_C(    87010548), -INT32_C(  1660072319),  INT32_C(  1895648550),  INT32_C(   262621157), -INT32_C(  1947499315), -INT32_C(   510901776),
+      -INT32_C(  1449808509),  INT32_C(  1713176154), -INT32_C(   765399983),  INT32_C(  1617980730), -INT32_C(  1596887621), -INT32_C(  2102363979), -INT32_C(   334652420),  INT32_C(  1624087004),
+      -INT32_C(  1609997498), -INT32_C(  1308154527),  INT32_C(  1283745553), -INT32_C(  1867713323),  INT32_C(   389053794), -INT32_C(   241573643),  INT32_C(  1490921083), -INT32_C(  2051495105),
+       INT32_C(  1864745230), -INT32_C(   148820762),  INT32_C(  1766040980), -INT32_C(    50728806),  INT32_C(  1662200173), -INT32_C(  2058048502), -INT32_C(  1847774638), -INT32_C(   350841379),
+       INT32_C(  1012546390), -INT32_C(    63669400), -INT32_C(  1167755488), -INT32_C(   709468569), -INT32_C(  1858549369), -INT32_C(   954758027), -INT32_C(  1688668994), -INT32_C(   528060790),
+       INT32_C(   303947946),  INT32_C(  2081313115),  INT32_C(   808874952),  INT32_C(  1476783569),  INT32_C(   753548726), -INT32_C(  1997340215),  INT32_C(  2133019893),  INT32_C(  1684056762),
+      -INT32_C(   428442230), -INT32_C(  1771928370), -INT32_C(   926508809),  INT32_C(  1008847749), -INT32_C(   764933368),  INT32_C(    22698764),  INT32_C(  1652653479), -INT32_C(  1295589081),
+       INT32_C(   748174686), -INT32_C(  1178404159),  INT32_C(   411142546),  INT32_C(  1565827668), -INT32_C(  1188053843), -INT32_C(  1078228713),  INT32_C(   773929990),  INT32_C(  2078336797),
+      -INT32_C(   425232348),  INT32_C(    77556082),  INT32_C(  1193025778),  INT32_C(  1889824963),  INT32_C(  1143657260),  INT32_C(  1644422492),  INT32_C(  1049633825),  INT32_C(   817459211),
+       INT32_C(  1511416040), -INT32_C(  1134578231), -INT32_C(  1744602155),  INT32_C(   403285996), -INT32_C(   698600582),  INT32_C(   959995672), -INT32_C(  1887975037),  INT32_C(   582955065),
+       INT32_C(  1501353360),  INT32_C(  1595267978),  INT32_C(  1140332631),  INT32_C(   962265535),  INT32_C(  1276098612), -INT32_C(  1685764073),  INT32_C(  1244331025), -INT32_C(  1133713108),
+       INT32_C(  1209395646),  INT32_C(   463940548),  INT32_C(    56532803), -INT32_C(   734217568), -INT32_C(  1994371982), -INT32_C(  1524324972), -INT32_C(   839954783), -INT32_C(   175547337) };
+  static const int8_t a[] =
+    { -INT8_C( 122),  INT8_C(  63), -INT8_C(  76), -INT8_C(  32),  INT8_C(   4),  INT8_C( 121), -INT8_C(  32),  INT8_C(   1),
+       INT8_C(   7),  INT8_C(  16), -INT8_C(  45),  INT8_C(  95), -INT8_C( 105),  INT8_C(  52), -INT8_C(  67), -INT8_C(  59),
+      -INT8_C( 100), -INT8_C(  73), -INT8_C(  64), -INT8_C(  29), -INT8_C( 109),  INT8_C( 108),  INT8_C(  17),  INT8_C( 119),
+      -INT8_C(  52), -INT8_C(  27),  INT8_C( 100),  INT8_C(  71),  INT8_C( 119),  INT8_C( 113), -INT8_C(  83), -INT8_C(   3),
+      -INT8_C(  80),  INT8_C(  97), -INT8_C(  35), -INT8_C(  75), -INT8_C(  38), -INT8_C(  67), -INT8_C(  74), -INT8_C(  31),
+      -INT8_C(  50), -INT8_C( 119),  INT8_C(  64),  INT8_C( 101), -INT8_C(  66), -INT8_C(   3),  INT8_C(  42),  INT8_C(  90),
+      -INT8_C(  75), -INT8_C(  22),  INT8_C(  61),  INT8_C(  72),  INT8_C(  86),  INT8_C(  78), -INT8_C(  65),  INT8_C(  35),
+       INT8_C(  51),  INT8_C(  35),  INT8_C( 106), -INT8_C(  86), -INT8_C( 108),  INT8_C(  23), -INT8_C(  89),  INT8_C(  68),
+       INT8_C( 120), -INT8_C( 123), -INT8_C(   7),  INT8_C(  82),  INT8_C(  66), -INT8_C(  81),  INT8_C(  51),  INT8_C(  16),
+       INT8_C(  57),  INT8_C( 115),  INT8_C( 117), -INT8_C(   9),  INT8_C( 113), -INT8_C(  96),  INT8_C(  81),  INT8_C(  38),
+      -INT8_C( 118), -INT8_C( 114),  INT8_C( 110), -INT8_C(  31), -INT8_C(  36),  INT8_C(  45),  INT8_C(   4),  INT8_C(  15),
+       INT8_C(  80),  INT8_C( 110), -INT8_C(  70), -INT8_C(  28), -INT8_C( 123),  INT8_C(  97),  INT8_C(  40), -INT8_C(   3),
+      -INT8_C(  26),  INT8_C(  34),  INT8_C(  79),  INT8_C(  41), -INT8_C(  47), -INT8_C( 126),  INT8_C(  57),  INT8_C(  10),
+      -INT8_C(  11), -INT8_C(  81),  INT8_C(   1),  INT8_C( 102),  INT8_C(  79),  INT8_C(  82), -INT8_C( 116), -INT8_C(  39),
+      -INT8_C(  32), -INT8_C(   6), -INT8_C(  70), -INT8_C(  68),  INT8_C(  39), -INT8_C(  66), -INT8_C(  52),  INT8_C( 119),
+       INT8_C(  44), -INT8_C( 122),  INT8_C(  91), -INT8_C(  79), -INT8_C(  25), -INT8_C( 124), -INT8_C(  82), -INT8_C(  50),
+      -INT8_C(  90), -INT8_C(   3), -INT8_C(   9),  INT8_C( 119),      INT8_MAX,  INT8_C(  48), -INT8_C( 126),  INT8_C( 117),
+      -INT8_C(  33), -INT8_C( 125), -INT8_C(  37),  INT8_C(  46), -INT8_C(  42),  INT8_C( 104),  INT8_C(   8), -INT8_C(  74),
+       INT8_C(  98), -INT8_C(  62),  INT8_C( 115), -INT8_C( 118), -INT8_C( 127),  INT8_C(  63),  INT8_C(   1), -INT8_C(  83),
+      -INT8_C(  59),  INT8_C(  93),  INT8_C(  95), -INT8_C(  84), -INT8_C(  31),  INT8_C(  13),  INT8_C( 122), -INT8_C( 121),
+       INT8_C(  11),  INT8_C( 113), -INT8_C(   2), -INT8_C( 118), -INT8_C(  94),      INT8_MIN, -INT8_C(   1), -INT8_C( 127),
+       INT8_C(   4), -INT8_C(  37), -INT8_C(  80), -INT8_C(  38),  INT8_C(  67), -INT8_C(  72), -INT8_C( 112), -INT8_C(  91),
+       INT8_C( 122),  INT8_C(   3),  INT8_C(  47), -INT8_C(   5),  INT8_C(  66),  INT8_C(  49), -INT8_C(  87),  INT8_C(   7),
+      -INT8_C( 114),  INT8_C(   8), -INT8_C(  76),  INT8_C( 111),  INT8_C(  21),  INT8_C(  46), -INT8_C(  10),  INT8_C(  32),
+      -INT8_C(  96), -INT8_C(  12), -INT8_C(  85),  INT8_C(  66),  INT8_C( 117), -INT8_C(  86), -INT8_C(  61),  INT8_C( 121),
+      -INT8_C( 123),  INT8_C( 115),  INT8_C(  83), -INT8_C(  56),  INT8_C(  43), -INT8_C(  29),  INT8_C( 110), -INT8_C(  90),
+      -INT8_C(  25), -INT8_C(  99), -INT8_C(  95),  INT8_C(  41), -INT8_C(  50),  INT8_C(  74),  INT8_C(  49),  INT8_C(  92),
+       INT8_C(  82), -INT8_C(  27), -INT8_C(  53),  INT8_C( 104),  INT8_C(  19), -INT8_C(  63), -INT8_C( 120), -INT8_C(  77) };
+  static const uint32_t e[] =
+    { UINT32_C(4294967174), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         7), UINT32_C(        16), UINT32_C(         0), UINT32_C(        95), UINT32_C(4294967191), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967237),
+      UINT32_C(4294967196), UINT32_C(4294967223), UINT32_C(4294967232), UINT32_C(         0), UINT32_C(         0), UINT32_C(       108), UINT32_C(         0), UINT32_C(       119),
+      UINT32_C(4294967244), UINT32_C(4294967269), UINT32_C(         0), UINT32_C(        71), UINT32_C(         0), UINT32_C(       113), UINT32_C(         0), UINT32_C(4294967293),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967261), UINT32_C(4294967221), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967222), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(4294967177), UINT32_C(        64), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967293), UINT32_C(        42), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(4294967274), UINT32_C(         0), UINT32_C(        72), UINT32_C(        86), UINT32_C(         0), UINT32_C(4294967231), UINT32_C(        35),
+      UINT32_C(        51), UINT32_C(        35), UINT32_C(         0), UINT32_C(4294967210), UINT32_C(4294967188), UINT32_C(        23), UINT32_C(4294967207), UINT32_C(        68),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(        66), UINT32_C(         0), UINT32_C(        51), UINT32_C(         0),
+      UINT32_C(        57), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967287), UINT32_C(         0), UINT32_C(4294967200), UINT32_C(        81), UINT32_C(         0),
+      UINT32_C(4294967178), UINT32_C(         0), UINT32_C(       110), UINT32_C(4294967265), UINT32_C(4294967260), UINT32_C(         0), UINT32_C(         4), UINT32_C(         0),
+      UINT32_C(        80), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967173), UINT32_C(         0), UINT32_C(        40), UINT32_C(4294967293),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(        79), UINT32_C(         0), UINT32_C(4294967249), UINT32_C(4294967170), UINT32_C(         0), UINT32_C(        10),
+      UINT32_C(         0), UINT32_C(4294967215), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967257),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967230), UINT32_C(4294967244), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(4294967174), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967214), UINT32_C(         0),
+      UINT32_C(4294967206), UINT32_C(         0), UINT32_C(4294967287), UINT32_C(       119), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967170), UINT32_C(       117),
+      UINT32_C(4294967263), UINT32_C(         0), UINT32_C(4294967259), UINT32_C(         0), UINT32_C(4294967254), UINT32_C(       104), UINT32_C(         8), UINT32_C(         0),
+      UINT32_C(        98), UINT32_C(4294967234), UINT32_C(         0), UINT32_C(4294967178), UINT32_C(         0), UINT32_C(        63), UINT32_C(         0), UINT32_C(4294967213),
+      UINT32_C(         0), UINT32_C(        93), UINT32_C(         0), UINT32_C(4294967212), UINT32_C(         0), UINT32_C(        13), UINT32_C(       122), UINT32_C(4294967175),
+      UINT32_C(         0), UINT32_C(       113), UINT32_C(4294967294), UINT32_C(4294967178), UINT32_C(4294967202), UINT32_C(4294967168),           UINT32_MAX, UINT32_C(4294967169),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967224), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(       122), UINT32_C(         3), UINT32_C(        47), UINT32_C(         0), UINT32_C(        66), UINT32_C(         0), UINT32_C(         0), UINT32_C(         7),
+      UINT32_C(         0), UINT32_C(         8), UINT32_C(         0), UINT32_C(         0), UINT32_C(        21), UINT32_C(        46), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(4294967200), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(       115), UINT32_C(        83), UINT32_C(         0), UINT32_C(        43), UINT32_C(         0), UINT32_C(       110), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(        74), UINT32_C(         0), UINT32_C(        92),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       104), UINT32_C(        19), UINT32_C(4294967233), UINT32_C(4294967176), UINT32_C(4294967219) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1sb_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  int8_t a[1024 / sizeof(uint32_t)];
+  uint32_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1sb_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sb_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 5114908763511485558), -INT64_C( 9032546740304610968),  INT64_C( 2676373162408478734),  INT64_C( 2319243487327546512),
+       INT64_C(  558937420956160272), -INT64_C( 3831915965559879241), -INT64_C( 8813265244020698796),  INT64_C( 2788754110654348265),
+      -INT64_C( 1504656150125971849),  INT64_C( 7399990408773289260),  INT64_C( 8221216157524331421), -INT64_C( 6244038357622092517),
+      -INT64_C( 8480878026303669714),  INT64_C( 3610238272392038563), -INT64_C( 4058909110689330256), -INT64_C( 7474759967514709656),
+      -INT64_C( 8848367229507861428),  INT64_C( 8905398545708328912), -INT64_C( 7074767758693213601),  INT64_C( 7499192791276767761),
+       INT64_C( 2731229031555009920), -INT64_C( 3227919347216736019),  INT64_C( 6507049767655106938), -INT64_C( 9079565804720847494),
+       INT64_C( 4931101113972887796), -INT64_C( 7911926143895341077),  INT64_C( 4232697281259901210),  INT64_C( 7897288966063297045),
+       INT64_C( 3564920464007920606), -INT64_C( 4411905137047472613), -INT64_C( 6066379937157937196),  INT64_C( 5574148396299755637),
+       INT64_C( 5786275826777592277),  INT64_C( 8492179899803753841),  INT64_C( 6382121719800922191), -INT64_C( 8992103312676990087),
+       INT64_C( 2537756068669208498),  INT64_C( 6043010478890531784),  INT64_C( 4202362861772203798), -INT64_C( 1563216119213156578),
+      -INT64_C( 6853624480886821618),  INT64_C( 5411891020885925827),  INT64_C( 4308138472730022861),  INT64_C( 5858713913185004332),
+      -INT64_C( 1460585580838379710),  INT64_C( 8544679420486664980), -INT64_C( 7387928220147525601),  INT64_C( 1679363089205395385),
+       INT64_C( 7673549192378277994),  INT64_C( 1931561534550650799),  INT64_C( 6568445774816269088), -INT64_C( 2649905004699769523),
+       INT64_C(  415996197223623173), -INT64_C( 2220788362760062951), -INT64_C( 6846432047575104257), -INT64_C(  141867815622519877),
+       INT64_C( 8629493228231029862),  INT64_C( 5420285884782813079), -INT64_C(  490355528989628611),  INT64_C( 6139300122919826235),
+       INT64_C( 4788966514433821856), -INT64_C(  609724581470994189), -INT64_C( 7371908402378214023), -INT64_C( 6633802235617880404),
+      -INT64_C( 4000859114419650163),  INT64_C( 6901925745674031896), -INT64_C( 5405226613915365371),  INT64_C( 6288221119238359454),
+       INT64_C( 1647765500569052737),  INT64_C( 8818523557679588380), -INT64_C( 2468578155974265088), -INT64_C( 8231522060409631582),
+       INT64_C( 8700252285804171945),  INT64_C( 6076722954718848101), -INT64_C( 6021847019056975534),  INT64_C( 6413087040490564646),
+      -INT64_C( 8574083879718116817), -INT64_C( 6194218225138172832), -INT64_C( 6368465352258787608), -INT64_C( 4351293540364863594),
+      -INT64_C( 5086727436481225541),  INT64_C( 7696220214063451084),  INT64_C( 5333944981979400670), -INT64_C(  934165727977463886),
+       INT64_C( 8348330819484538569), -INT64_C( 6993696868746704635), -INT64_C(  401943757894890130), -INT64_C(  987052305679320287),
+       INT64_C( 6897807475296444319),  INT64_C( 2564756788887375928), -INT64_C( 5158678113499638746), -INT64_C( 8014332619127674707),
+       INT64_C(  159754413179067262),  INT64_C( 2141623214868733663),  INT64_C( 6662217684895923494),  INT64_C( 7069800275064751771) };
+  static const int8_t a[] =
+    { -INT8_C(  98), -INT8_C(  88), -INT8_C( 105), -INT8_C(  66),  INT8_C( 110),  INT8_C(  45),  INT8_C( 113), -INT8_C(   5),
+       INT8_C(  67),  INT8_C(  58),  INT8_C(  43),  INT8_C(  23), -INT8_C(  72), -INT8_C(  28), -INT8_C(  65),  INT8_C(  69),
+      -INT8_C(  60), -INT8_C(  66),  INT8_C(  87), -INT8_C(  34), -INT8_C(  76),  INT8_C(  26),  INT8_C( 118),  INT8_C(  49),
+       INT8_C(  22),  INT8_C(  81),  INT8_C(  53), -INT8_C( 105),  INT8_C(  14), -INT8_C(  66), -INT8_C(  67), -INT8_C(  84),
+       INT8_C( 103),  INT8_C(  84),  INT8_C( 106), -INT8_C(  43), -INT8_C( 127), -INT8_C(  36), -INT8_C(  48), -INT8_C(  60),
+       INT8_C(  22), -INT8_C(   5), -INT8_C(  36), -INT8_C(  50), -INT8_C(  32), -INT8_C( 101),  INT8_C(  19), -INT8_C(  92),
+       INT8_C(  89),  INT8_C( 107), -INT8_C( 126),  INT8_C(  14), -INT8_C( 123), -INT8_C(   7),  INT8_C(  63), -INT8_C( 100),
+       INT8_C(  74),  INT8_C( 117),  INT8_C(  51),  INT8_C(  88),  INT8_C(  51), -INT8_C(  16),  INT8_C(   5), -INT8_C( 102),
+       INT8_C(  69),  INT8_C( 111),  INT8_C( 111), -INT8_C(  58),  INT8_C(  75),  INT8_C(  63), -INT8_C( 117),  INT8_C(  98),
+       INT8_C(  59),  INT8_C( 103),  INT8_C(  48),  INT8_C(  27),  INT8_C(   2),  INT8_C(  68), -INT8_C(  65),  INT8_C(  91),
+      -INT8_C(  81),  INT8_C(  66),  INT8_C( 105),  INT8_C(  52),  INT8_C(  59), -INT8_C(  87), -INT8_C(  48), -INT8_C( 123),
+       INT8_C(  30),  INT8_C(   4), -INT8_C(  34),  INT8_C(  81), -INT8_C(  12), -INT8_C(  29), -INT8_C(  20),  INT8_C(  57) };
+  static const uint64_t e[] =
+    { UINT64_C(                   0), UINT64_C(18446744073709551528), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                  45), UINT64_C(                 113), UINT64_C(                   0),
+      UINT64_C(                  67), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  23),
+      UINT64_C(18446744073709551544), UINT64_C(                   0), UINT64_C(18446744073709551551), UINT64_C(                  69),
+      UINT64_C(18446744073709551556), UINT64_C(                   0), UINT64_C(                  87), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                  26), UINT64_C(                   0), UINT64_C(                  49),
+      UINT64_C(                   0), UINT64_C(                  81), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(18446744073709551550), UINT64_C(18446744073709551549), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744073709551573),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744073709551556),
+      UINT64_C(                  22), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18446744073709551584), UINT64_C(                   0), UINT64_C(                  19), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  14),
+      UINT64_C(                   0), UINT64_C(18446744073709551609), UINT64_C(                  63), UINT64_C(18446744073709551516),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  51), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(18446744073709551600), UINT64_C(                   5), UINT64_C(18446744073709551514),
+      UINT64_C(                  69), UINT64_C(                   0), UINT64_C(                 111), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744073709551499), UINT64_C(                  98),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  48), UINT64_C(                   0),
+      UINT64_C(                   2), UINT64_C(                  68), UINT64_C(18446744073709551551), UINT64_C(                  91),
+      UINT64_C(18446744073709551535), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  52),
+      UINT64_C(                   0), UINT64_C(18446744073709551529), UINT64_C(18446744073709551568), UINT64_C(18446744073709551493),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744073709551582), UINT64_C(                  81),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1sb_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  int8_t a[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1sb_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1ub_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C( 25829), -INT16_C( 10358),  INT16_C( 31637),  INT16_C(  2507),  INT16_C(  6955),  INT16_C(  7725), -INT16_C( 31276),  INT16_C( 13899),
+      -INT16_C(   339), -INT16_C(  9546), -INT16_C( 30833),  INT16_C(  1019),  INT16_C( 21829),  INT16_C( 24266),  INT16_C( 11952), -INT16_C( 27374),
+      -INT16_C( 25453),  INT16_C( 10349),  INT16_C( 14359),  INT16_C( 16945),  INT16_C( 24147),  INT16_C( 10080), -INT16_C( 21277), -INT16_C( 28323),
+       INT16_C(  5034),  INT16_C( 14955),  INT16_C( 26267), -INT16_C(  8131),  INT16_C(  1979),  INT16_C( 27454),  INT16_C( 20534), -INT16_C( 14079),
+       INT16_C( 28396),  INT16_C(  1009),  INT16_C(  8870), -INT16_C(  1467), -INT16_C( 22911),  INT16_C( 25633),  INT16_C( 32594), -INT16_C(   779),
+       INT16_C( 24722),  INT16_C( 11574),  INT16_C( 29894), -INT16_C( 32243),  INT16_C( 19323), -INT16_C( 19987), -INT16_C(  4453), -INT16_C( 30854),
+       INT16_C( 27484),  INT16_C(   906), -INT16_C( 12146),  INT16_C(  4093),  INT16_C(  7798), -INT16_C( 14221),  INT16_C( 27037),  INT16_C( 12484),
+      -INT16_C(  1079), -INT16_C( 28579),  INT16_C( 27503), -INT16_C(  5614), -INT16_C(    74),  INT16_C( 21148),  INT16_C(  5870),  INT16_C( 19161),
+       INT16_C( 25730),  INT16_C(  4173),  INT16_C( 18996), -INT16_C( 21985), -INT16_C( 28055),  INT16_C(  1650),  INT16_C( 14075), -INT16_C( 15050),
+      -INT16_C( 27599), -INT16_C( 24491),  INT16_C( 26623), -INT16_C( 19061),  INT16_C( 10086),  INT16_C( 21511), -INT16_C(  7875), -INT16_C( 16481),
+      -INT16_C(  5051),  INT16_C( 31183), -INT16_C(  4553), -INT16_C( 24541), -INT16_C( 27263),  INT16_C( 31910), -INT16_C(  8757), -INT16_C(   703),
+      -INT16_C( 27023),  INT16_C( 28829),  INT16_C( 10493),  INT16_C( 25637),  INT16_C( 11599), -INT16_C( 29256),  INT16_C( 22286),  INT16_C( 21324),
+       INT16_C(  7236),  INT16_C( 31692), -INT16_C(  4342), -INT16_C( 29925), -INT16_C( 15996),  INT16_C( 20232),  INT16_C( 18846),  INT16_C(  3916),
+      -INT16_C(  5408), -INT16_C(  8833), -INT16_C( 23278),  INT16_C( 25153), -INT16_C(  1326), -INT16_C(  7953),  INT16_C( 15185), -INT16_C( 27341),
+      -INT16_C(   169),  INT16_C( 25104),  INT16_C( 11246),  INT16_C( 29421), -INT16_C(  2579), -INT16_C( 29759),  INT16_C(  3647),  INT16_C(  8091),
+       INT16_C(  6904),  INT16_C(  2812),  INT16_C( 16063), -INT16_C( 28308),  INT16_C( 23352), -INT16_C( 30351), -INT16_C( 23401), -INT16_C(  4577),
+       INT16_C( 12195), -INT16_C( 28336),  INT16_C( 15963),  INT16_C( 18435), -INT16_C( 15053),  INT16_C( 29395),  INT16_C( 28371), -INT16_C( 13423),
+      -INT16_C( 29047),  INT16_C( 18645),  INT16_C( 17100),  INT16_C(  1242),  INT16_C( 19357),  INT16_C( 13453), -INT16_C( 21264), -INT16_C( 27869),
+       INT16_C( 29660),  INT16_C( 14117),  INT16_C( 10417), -INT16_C(  6785),  INT16_C( 21229), -INT16_C( 16297), -INT16_C(  5695),  INT16_C( 19083),
+       INT16_C( 24951),  INT16_C( 17298),  INT16_C( 27811),  INT16_C( 16455), -INT16_C( 11080), -INT16_C( 22411), -INT16_C( 26495),  INT16_C( 23867),
+       INT16_C( 24587), -INT16_C( 17004),  INT16_C(  5001),  INT16_C( 30370), -INT16_C(  1691),  INT16_C(  9783), -INT16_C( 15646),  INT16_C( 22896),
+       INT16_C(   803), -INT16_C( 14692), -INT16_C(  7313),  INT16_C(  9991),  INT16_C( 31928),  INT16_C( 14799),  INT16_C(  2836),  INT16_C(  8086),
+       INT16_C( 10859), -INT16_C(  2852),  INT16_C( 32317), -INT16_C( 23957), -INT16_C( 23944),  INT16_C( 23241),  INT16_C( 14692), -INT16_C( 30540),
+       INT16_C( 20540), -INT16_C( 21426),  INT16_C( 21812), -INT16_C(  4909), -INT16_C( 23599), -INT16_C(  6875), -INT16_C( 17490),  INT16_C(  6405),
+      -INT16_C(  7707),  INT16_C(  8718),  INT16_C( 31072), -INT16_C( 10044), -INT16_C( 29413),  INT16_C( 32562), -INT16_C(  6457),  INT16_C(   775),
+       INT16_C( 22071),  INT16_C( 27567), -INT16_C( 31829),  INT16_C( 32087),  INT16_C( 31782), -INT16_C( 11166),  INT16_C( 26423),  INT16_C(  7405),
+      -INT16_C(  1207), -INT16_C( 22210),  INT16_C(   628), -INT16_C( 28799), -INT16_C( 19568),  INT16_C( 22287),  INT16_C(  5786), -INT16_C( 11942),
+       INT16_C(  2668),  INT16_C(  6204), -INT16_C( 27763), -INT16_C( 19563), -INT16_C(  2289),  INT16_C( 18055),  INT16_C( 29791), -INT16_C( 22430),
+      -INT16_C( 24464), -INT16_C(  7087), -INT16_C( 11614),  INT16_C( 12916), -INT16_C( 31867),  INT16_C(  8073), -INT16_C(  7015),  INT16_C(  1776),
+       INT16_C( 11502),  INT16_C( 31518), -INT16_C( 19521), -INT16_C( 12754), -INT16_C( 19030),  INT16_C(  2324),  INT16_C( 30249), -INT16_C( 26191),
+       INT16_C(   534), -INT16_C( 18050), -INT16_C(  3372),  INT16_C( 23275),  INT16_C( 30069),  INT16_C(  3705),  INT16_C( 27225),  INT16_C( 18196),
+       INT16_C( 12950),  INT16_C( 22210), -INT16_C(  3867), -INT16_C( 28636),  INT16_C( 14757), -INT16_C( 12647),  INT16_C( 19375), -INT16_C( 14744),
+      -INT16_C(  6579),  INT16_C(  8831),  INT16_C( 27352),  INT16_C( 19836), -INT16_C(  2593),  INT16_C( 14427),  INT16_C( 28767), -INT16_C(  2433),
+       INT16_C( 16802), -INT16_C( 30644),  INT16_C( 28721), -INT16_C( 10728), -INT16_C( 20055),  INT16_C( 22949),  INT16_C(  3580),  INT16_C( 18975),
+      -INT16_C( 24845), -INT16_C( 13460), -INT16_C(  6136), -INT16_C(  6120),  INT16_C( 29661),  INT16_C( 15648), -INT16_C( 24349), -INT16_C( 31181),
+       INT16_C( 32737) };
+  static const uint8_t a[] =
+    { UINT8_C(204), UINT8_C(160), UINT8_C( 40), UINT8_C(  7), UINT8_C( 22), UINT8_C( 34), UINT8_C(165), UINT8_C( 72),
+      UINT8_C(166), UINT8_C(146), UINT8_C(228), UINT8_C(165), UINT8_C(179), UINT8_C( 80), UINT8_C(172), UINT8_C(147),
+      UINT8_C(222), UINT8_C(253), UINT8_C(146), UINT8_C(124), UINT8_C( 39), UINT8_C( 38), UINT8_C( 75), UINT8_C(109),
+      UINT8_C( 23), UINT8_C(  6), UINT8_C(163), UINT8_C( 66), UINT8_C( 99), UINT8_C(149), UINT8_C(  8), UINT8_C( 47),
+      UINT8_C( 53), UINT8_C( 48), UINT8_C( 55), UINT8_C( 76), UINT8_C( 83), UINT8_C(220), UINT8_C(148), UINT8_C(249),
+      UINT8_C(110), UINT8_C(120), UINT8_C(158), UINT8_C( 34), UINT8_C(200), UINT8_C( 74), UINT8_C(181), UINT8_C(167),
+      UINT8_C( 72), UINT8_C( 72), UINT8_C( 35), UINT8_C(111), UINT8_C(110), UINT8_C(110), UINT8_C(220), UINT8_C(134),
+      UINT8_C(116), UINT8_C(127), UINT8_C(200), UINT8_C(215), UINT8_C( 20), UINT8_C(208), UINT8_C(  7), UINT8_C( 74),
+      UINT8_C(  1), UINT8_C( 62), UINT8_C(150), UINT8_C( 84), UINT8_C( 26), UINT8_C( 42), UINT8_C( 77), UINT8_C(137),
+      UINT8_C(163), UINT8_C(235), UINT8_C(171), UINT8_C(107), UINT8_C( 53), UINT8_C( 96), UINT8_C( 18), UINT8_C(125),
+      UINT8_C(168), UINT8_C( 53), UINT8_C(236), UINT8_C( 23), UINT8_C(163), UINT8_C(200), UINT8_C(157), UINT8_C( 23),
+      UINT8_C( 71), UINT8_C(101), UINT8_C(239), UINT8_C( 92), UINT8_C( 54), UINT8_C(246), UINT8_C(166), UINT8_C( 55),
+      UINT8_C( 52), UINT8_C( 60), UINT8_C(139), UINT8_C( 78), UINT8_C(102), UINT8_C(216), UINT8_C(215), UINT8_C(  9),
+      UINT8_C(195), UINT8_C(130), UINT8_C(117), UINT8_C(248), UINT8_C(227), UINT8_C(135), UINT8_C(118), UINT8_C(139),
+      UINT8_C(189), UINT8_C( 98), UINT8_C(162), UINT8_C( 96), UINT8_C( 43), UINT8_C( 63), UINT8_C(120), UINT8_C(114),
+      UINT8_C(165), UINT8_C(103), UINT8_C(206), UINT8_C(219), UINT8_C( 93), UINT8_C(116), UINT8_C( 18), UINT8_C(145),
+      UINT8_C(176), UINT8_C(157), UINT8_C(223), UINT8_C( 23), UINT8_C(117), UINT8_C(183), UINT8_C( 32), UINT8_C( 56),
+      UINT8_C( 57), UINT8_C(149), UINT8_C( 48), UINT8_C( 28), UINT8_C( 29), UINT8_C(166), UINT8_C(168), UINT8_C(218),
+      UINT8_C(  9), UINT8_C( 74), UINT8_C( 58), UINT8_C( 52), UINT8_C(138), UINT8_C(178), UINT8_C(166), UINT8_C( 47),
+      UINT8_C( 25), UINT8_C(117), UINT8_C( 10), UINT8_C(118), UINT8_C(233), UINT8_C( 28), UINT8_C(  7), UINT8_C(154),
+      UINT8_C(185), UINT8_C(231), UINT8_C(177), UINT8_C( 46), UINT8_C(158), UINT8_C(209), UINT8_C(102), UINT8_C(215),
+      UINT8_C(103), UINT8_C(150), UINT8_C(244), UINT8_C(132), UINT8_C( 61), UINT8_C(156), UINT8_C( 94), UINT8_C( 70),
+      UINT8_C(230), UINT8_C(152), UINT8_C(122), UINT8_C(112), UINT8_C( 75), UINT8_C( 32), UINT8_C(159), UINT8_C(100),
+      UINT8_C(149), UINT8_C(169), UINT8_C(219), UINT8_C(127), UINT8_C(197), UINT8_C(226), UINT8_C( 25), UINT8_C(126),
+      UINT8_C(201), UINT8_C(202), UINT8_C(172), UINT8_C(103), UINT8_C(155), UINT8_C( 18), UINT8_C( 63), UINT8_C(  2),
+      UINT8_C(169), UINT8_C( 51), UINT8_C(134), UINT8_C(230), UINT8_C(207), UINT8_C(228), UINT8_C( 44), UINT8_C(181),
+      UINT8_C(125), UINT8_C(166), UINT8_C( 38), UINT8_C(200), UINT8_C(198), UINT8_C(197), UINT8_C( 44), UINT8_C( 92),
+      UINT8_C(111), UINT8_C(  7), UINT8_C(219), UINT8_C( 52), UINT8_C(234), UINT8_C(244), UINT8_C(179), UINT8_C(179),
+      UINT8_C(190), UINT8_C( 95), UINT8_C( 27), UINT8_C( 89), UINT8_C(114), UINT8_C( 90), UINT8_C( 92), UINT8_C( 27),
+      UINT8_C(141), UINT8_C(226), UINT8_C(  1), UINT8_C( 92), UINT8_C(199), UINT8_C( 45), UINT8_C( 17), UINT8_C( 68),
+      UINT8_C(211), UINT8_C( 55), UINT8_C( 12), UINT8_C(153), UINT8_C(253), UINT8_C( 56), UINT8_C(245), UINT8_C(108),
+      UINT8_C( 64), UINT8_C(208), UINT8_C(160), UINT8_C( 42), UINT8_C(196), UINT8_C( 83), UINT8_C(221), UINT8_C(130),
+      UINT8_C(179), UINT8_C(248), UINT8_C(220), UINT8_C( 37), UINT8_C( 82), UINT8_C( 56), UINT8_C( 64), UINT8_C(223),
+      UINT8_C( 26), UINT8_C( 65), UINT8_C( 59), UINT8_C(225), UINT8_C(110), UINT8_C( 77), UINT8_C( 37), UINT8_C( 65),
+      UINT8_C(132), UINT8_C( 49), UINT8_C(218), UINT8_C(129), UINT8_C(106), UINT8_C(208), UINT8_C(237), UINT8_C(170),
+      UINT8_C(160) };
+  static const int16_t e[] =
+    {  INT16_C(     0),  INT16_C(   160),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   165),  INT16_C(     0),
+       INT16_C(   166),  INT16_C(   146),  INT16_C(   228),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   147),
+       INT16_C(   222),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    75),  INT16_C(   109),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    66),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    47),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    76),  INT16_C(    83),  INT16_C(     0),  INT16_C(     0),  INT16_C(   249),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    34),  INT16_C(     0),  INT16_C(    74),  INT16_C(   181),  INT16_C(   167),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(    35),  INT16_C(     0),  INT16_C(     0),  INT16_C(   110),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(   116),  INT16_C(   127),  INT16_C(     0),  INT16_C(   215),  INT16_C(    20),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    84),  INT16_C(    26),  INT16_C(     0),  INT16_C(     0),  INT16_C(   137),
+       INT16_C(   163),  INT16_C(   235),  INT16_C(     0),  INT16_C(   107),  INT16_C(     0),  INT16_C(     0),  INT16_C(    18),  INT16_C(   125),
+       INT16_C(   168),  INT16_C(     0),  INT16_C(   236),  INT16_C(    23),  INT16_C(   163),  INT16_C(     0),  INT16_C(   157),  INT16_C(    23),
+       INT16_C(    71),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   246),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(   139),  INT16_C(    78),  INT16_C(   102),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(   195),  INT16_C(   130),  INT16_C(   117),  INT16_C(     0),  INT16_C(   227),  INT16_C(   135),  INT16_C(     0),  INT16_C(   139),
+       INT16_C(   189),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    43),  INT16_C(    63),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   219),  INT16_C(     0),  INT16_C(   116),  INT16_C(    18),  INT16_C(   145),
+       INT16_C(     0),  INT16_C(   157),  INT16_C(     0),  INT16_C(     0),  INT16_C(   117),  INT16_C(     0),  INT16_C(     0),  INT16_C(    56),
+       INT16_C(    57),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   168),  INT16_C(   218),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    52),  INT16_C(     0),  INT16_C(   178),  INT16_C(   166),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   233),  INT16_C(    28),  INT16_C(     7),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(   231),  INT16_C(     0),  INT16_C(     0),  INT16_C(   158),  INT16_C(     0),  INT16_C(   102),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(   150),  INT16_C(   244),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(   152),  INT16_C(     0),  INT16_C(   112),  INT16_C(    75),  INT16_C(     0),  INT16_C(     0),  INT16_C(   100),
+       INT16_C(     0),  INT16_C(   169),  INT16_C(     0),  INT16_C(   127),  INT16_C(   197),  INT16_C(   226),  INT16_C(    25),  INT16_C(     0),
+       INT16_C(   201),  INT16_C(     0),  INT16_C(     0),  INT16_C(   103),  INT16_C(   155),  INT16_C(     0),  INT16_C(    63),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(   134),  INT16_C(     0),  INT16_C(     0),  INT16_C(   228),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(   125),  INT16_C(   166),  INT16_C(     0),  INT16_C(   200),  INT16_C(   198),  INT16_C(     0),  INT16_C(     0),  INT16_C(    92),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(   219),  INT16_C(    52),  INT16_C(   234),  INT16_C(     0),  INT16_C(     0),  INT16_C(   179),
+       INT16_C(   190),  INT16_C(    95),  INT16_C(    27),  INT16_C(     0),  INT16_C(   114),  INT16_C(     0),  INT16_C(    92),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(    92),  INT16_C(   199),  INT16_C(     0),  INT16_C(     0),  INT16_C(    68),
+       INT16_C(     0),  INT16_C(    55),  INT16_C(    12),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(   160),  INT16_C(    42),  INT16_C(     0),  INT16_C(    83),  INT16_C(     0),  INT16_C(   130),
+       INT16_C(   179),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    82),  INT16_C(     0),  INT16_C(     0),  INT16_C(   223),
+       INT16_C(     0),  INT16_C(    65),  INT16_C(     0),  INT16_C(   225),  INT16_C(   110),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(   132),  INT16_C(    49),  INT16_C(   218),  INT16_C(   129),  INT16_C(     0),  INT16_C(     0),  INT16_C(   237),  INT16_C(   170),
+       INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svld1ub_s16(pv, &(a[i]));
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint8_t a[1024 / sizeof(int16_t)];
+  int16_t e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    ev = simde_svld1ub_s16(pv, &(a[i]));
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1ub_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(  1251409756), -INT32_C(   984074628), -INT32_C(  2116016827),  INT32_C(  1502739466), -INT32_C(  1067061074),  INT32_C(   482269818),  INT32_C(   653407265), -INT32_C(  1497599742),
+      -INT32_C(   296016526), -INT32_C(  1582058661), -INT32_C(   484273191),  INT32_C(  1027388303),  INT32_C(   520004259), -INT32_C(  1657095044), -INT32_C(   222090000),  INT32_C(   261718173),
+       INT32_C(    33420453), -INT32_C(  2120044376), -INT32_C(   748370877),  INT32_C(   454074487), -INT32_C(  1103557054), -INT32_C(  1168346166),  INT32_C(  1017978783),  INT32_C(  1162626719),
+      -INT32_C(   498710214),  INT32_C(  1029957882),  INT32_C(   588302252), -INT32_C(  1438768792), -INT32_C(    93751505), -INT32_C(  1984641558), -INT32_C(  2067373596), -INT32_C(   490138969),
+       INT32_C(  1438912347), -INT32_C(  1550636809),  INT32_C(  1472635887), -INT32_C(   201194044),  INT32_C(  1743678332),  INT32_C(   351314480), -INT32_C(  1416055292),  INT32_C(   613245384),
+       INT32_C(  1736004208),  INT32_C(  1762266234),  INT32_C(  1958859184),  INT32_C(  1382597590),  INT32_C(  1589204526), -INT32_C(    42816775),  INT32_C(   698878816), -INT32_C(   582142356),
+       INT32_C(    38061704), -INT32_C(  2090119213), -INT32_C(   151573472),  INT32_C(   491282671), -INT32_C(  1350892874),  INT32_C(   212659884),  INT32_C(  1697994233),  INT32_C(   323125899),
+       INT32_C(   471172937), -INT32_C(   157318954), -INT32_C(  1662216531), -INT32_C(  1380305674), -INT32_C(   497273546),  INT32_C(   485427491), -INT32_C(   377346978), -INT32_C(   251870041),
+       INT32_C(   554438987),  INT32_C(  1041738641),  INT32_C(   953877313),  INT32_C(  1860539704), -INT32_C(   296664630), -INT32_C(  1475723190),  INT32_C(   194088036), -INT32_C(  1661235887),
+       INT32_C(   817760158), -INT32_C(   194062926),  INT32_C(   288115161), -INT32_C(  1451290146), -INT32_C(  1650995118),  INT32_C(  1967497488),  INT32_C(  2139150126),  INT32_C(    52132964),
+       INT32_C(   909367683), -INT32_C(  2010472017), -INT32_C(   912697621), -INT32_C(  1183704985), -INT32_C(   111801879), -INT32_C(   647062357), -INT32_C(   682037389), -INT32_C(   287673493),
+      -INT32_C(    64746163), -INT32_C(  1702605137),  INT32_C(   191045028),  INT32_C(   516281909), -INT32_C(  1978131489),  INT32_C(   711165623), -INT32_C(   536691851),  INT32_C(  2093997103),
+      -INT32_C(  1720126486), -INT32_C(   432800702),  INT32_C(  1324520985),  INT32_C(  1282258796), -INT32_C(  1965652526), -INT32_C(  2118895093),  INT32_C(   610383605),  INT32_C(  2107650195),
+       INT32_C(  1712724004),  INT32_C(   759974164),  INT32_C(  1283210975), -INT32_C(   929502731),  INT32_C(  2035445358), -INT32_C(  1627781464),  INT32_C(  1354915005), -INT32_C(  1328716916),
+      -INT32_C(  1877548165),  INT32_C(   196961068), -INT32_C(  1755891295), -INT32_C(  1872761054),  INT32_C(   101364062),  INT32_C(  1956906167), -INT32_C(   305895584),  INT32_C(  1167954378),
+      -INT32_C(  1596607372), -INT32_C(  1196649705), -INT32_C(   280034356),  INT32_C(  1367322355),  INT32_C(   391612767), -INT32_C(   292815730),  INT32_C(   769347683),  INT32_C(  1450342881),
+       INT32_C(  1156991021), -INT32_C(  1476615461), -INT32_C(  1718203226),  INT32_C(  1525290746) };
+  static const uint8_t a[] =
+    { UINT8_C(  2), UINT8_C( 17), UINT8_C(235), UINT8_C(215), UINT8_C(178), UINT8_C(  1), UINT8_C(182), UINT8_C(120),
+      UINT8_C( 18), UINT8_C( 13), UINT8_C( 25), UINT8_C( 47), UINT8_C( 64), UINT8_C(164), UINT8_C( 64), UINT8_C(145),
+      UINT8_C(123), UINT8_C(238), UINT8_C(132), UINT8_C(172), UINT8_C(171), UINT8_C(  4), UINT8_C( 48), UINT8_C(193),
+      UINT8_C( 44), UINT8_C(231), UINT8_C( 38), UINT8_C( 95), UINT8_C( 85), UINT8_C( 55), UINT8_C( 10), UINT8_C( 87),
+      UINT8_C( 72), UINT8_C(246), UINT8_C( 46), UINT8_C(250), UINT8_C(247), UINT8_C(229), UINT8_C(114), UINT8_C(  9),
+      UINT8_C(242), UINT8_C(139), UINT8_C( 56), UINT8_C( 50), UINT8_C( 47), UINT8_C(121), UINT8_C(195), UINT8_C(171),
+      UINT8_C(103), UINT8_C( 71), UINT8_C( 87), UINT8_C( 18), UINT8_C( 76), UINT8_C(135), UINT8_C(211), UINT8_C(120),
+      UINT8_C(110), UINT8_C(250), UINT8_C(215), UINT8_C(196), UINT8_C( 49), UINT8_C(226), UINT8_C( 27), UINT8_C(121),
+      UINT8_C(216), UINT8_C( 74), UINT8_C(116), UINT8_C(207), UINT8_C( 47), UINT8_C(230), UINT8_C(216), UINT8_C( 33),
+      UINT8_C(114), UINT8_C( 16), UINT8_C( 83), UINT8_C(161), UINT8_C(137), UINT8_C( 22), UINT8_C( 76), UINT8_C(240),
+      UINT8_C( 93), UINT8_C(164), UINT8_C(  2), UINT8_C(169), UINT8_C( 43), UINT8_C(214), UINT8_C( 33), UINT8_C(154),
+      UINT8_C(208), UINT8_C(249), UINT8_C( 94), UINT8_C(  1), UINT8_C(219), UINT8_C(121), UINT8_C(122), UINT8_C(179),
+      UINT8_C(195), UINT8_C(238), UINT8_C(130), UINT8_C(242), UINT8_C(213), UINT8_C( 90), UINT8_C( 19), UINT8_C( 71),
+      UINT8_C(106), UINT8_C(102), UINT8_C(232), UINT8_C(244), UINT8_C(124), UINT8_C( 53), UINT8_C(228), UINT8_C(218),
+      UINT8_C(217), UINT8_C(231), UINT8_C(131), UINT8_C(  4), UINT8_C(189), UINT8_C(165), UINT8_C(158), UINT8_C(141),
+      UINT8_C(158), UINT8_C(252), UINT8_C(142), UINT8_C(121), UINT8_C(118), UINT8_C(  8), UINT8_C( 44), UINT8_C( 57),
+      UINT8_C(247), UINT8_C(174), UINT8_C( 44), UINT8_C(204) };
+  static const int32_t e[] =
+    {  INT32_C(           2),  INT32_C(          17),  INT32_C(         235),  INT32_C(           0),  INT32_C(         178),  INT32_C(           0),  INT32_C(           0),  INT32_C(         120),
+       INT32_C(          18),  INT32_C(          13),  INT32_C(          25),  INT32_C(           0),  INT32_C(           0),  INT32_C(         164),  INT32_C(          64),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(         238),  INT32_C(         132),  INT32_C(           0),  INT32_C(         171),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(          44),  INT32_C(           0),  INT32_C(           0),  INT32_C(          95),  INT32_C(          85),  INT32_C(          55),  INT32_C(          10),  INT32_C(          87),
+       INT32_C(           0),  INT32_C(         246),  INT32_C(           0),  INT32_C(         250),  INT32_C(           0),  INT32_C(           0),  INT32_C(         114),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(         121),  INT32_C(           0),  INT32_C(         171),
+       INT32_C(           0),  INT32_C(          71),  INT32_C(          87),  INT32_C(           0),  INT32_C(          76),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(         250),  INT32_C(         215),  INT32_C(         196),  INT32_C(          49),  INT32_C(           0),  INT32_C(          27),  INT32_C(         121),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          47),  INT32_C(         230),  INT32_C(           0),  INT32_C(          33),
+       INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(         161),  INT32_C(         137),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(         164),  INT32_C(           2),  INT32_C(         169),  INT32_C(          43),  INT32_C(         214),  INT32_C(          33),  INT32_C(         154),
+       INT32_C(         208),  INT32_C(         249),  INT32_C(           0),  INT32_C(           0),  INT32_C(         219),  INT32_C(           0),  INT32_C(         122),  INT32_C(           0),
+       INT32_C(         195),  INT32_C(         238),  INT32_C(           0),  INT32_C(           0),  INT32_C(         213),  INT32_C(          90),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(         244),  INT32_C(           0),  INT32_C(          53),  INT32_C(           0),  INT32_C(         218),
+       INT32_C(         217),  INT32_C(           0),  INT32_C(         131),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(         158),  INT32_C(           0),
+       INT32_C(         158),  INT32_C(         252),  INT32_C(         142),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(         174),  INT32_C(          44),  INT32_C(           0) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1ub_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint8_t a[1024 / sizeof(int32_t)];
+  int32_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1ub_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1ub_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 3806063031704614873),  INT64_C( 2169666389718464572),  INT64_C( 8653953471059026307),  INT64_C( 2744568272231454498),
+      -INT64_C( 5981222928193448543), -INT64_C(  316993082862844827), -INT64_C(  324568303344429775), -INT64_C(  995170924768811075),
+      -INT64_C( 7051868211029160954), -INT64_C( 2921794205689194753), -INT64_C( 2063674308833755000),  INT64_C( 3478499825546016770),
+      -INT64_C( 4773594886062078999),  INT64_C( 1520993524344216222),  INT64_C( 6264738335822379239), -INT64_C( 1953171374513398390),
+      -INT64_C( 1121740099197367565),  INT64_C( 3621825705357386657),  INT64_C( 1653155918679882056),  INT64_C( 9218215928763423501),
+       INT64_C( 6735871820512228408),  INT64_C( 5098021995410075202),  INT64_C( 4335791261146545800), -INT64_C( 2559678853563484818),
+      -INT64_C( 8268924154080154843),  INT64_C( 2437812547556657552), -INT64_C(  629834860542446121), -INT64_C( 2461661704083110314),
+      -INT64_C( 5769396860900983530), -INT64_C( 5152379789042186042),  INT64_C( 7729865901960246726), -INT64_C( 5108141205504051321),
+      -INT64_C( 7113707364345521287),  INT64_C( 6677285281470383120), -INT64_C( 1102834999269562320), -INT64_C( 3709475894806505688),
+      -INT64_C( 5144328307518103770),  INT64_C( 4837521393663514417), -INT64_C( 1795463188577661508), -INT64_C( 5300394192043621294),
+      -INT64_C( 5460807497449941289), -INT64_C(  991182012813745689),  INT64_C( 6057390986115925866), -INT64_C( 3334796802548710799),
+      -INT64_C( 6595372409466885055), -INT64_C(  391570653886614679),  INT64_C( 5114738794517735588), -INT64_C( 6791146351044791050),
+       INT64_C(  130004709374497132), -INT64_C( 1415484570444207151), -INT64_C( 6272232582464503848), -INT64_C( 6304378410347512702),
+      -INT64_C( 7564746900770789270), -INT64_C( 5963236680906791926), -INT64_C( 2293089367878807342), -INT64_C( 8471477470774573429),
+      -INT64_C( 1618602200029904596), -INT64_C( 6361200522032348874), -INT64_C( 1330715409624853686), -INT64_C( 5059472517296273121),
+       INT64_C( 2102676243922769509),  INT64_C( 3256632372957309365), -INT64_C( 3007175613437616652), -INT64_C( 9012303062289221210),
+      -INT64_C( 8990886019297011404),  INT64_C( 3994198373804368222),  INT64_C( 5055240692751549339),  INT64_C( 5650443147268472011),
+      -INT64_C( 8984220398855245567),  INT64_C( 3998689165951917572), -INT64_C( 6170862921513890699),  INT64_C( 4564113715243439853),
+       INT64_C( 7482554186099245102),  INT64_C( 4869003411937205182), -INT64_C( 5133622216350950600),  INT64_C( 9081814659824112523),
+       INT64_C( 3864274809820157910), -INT64_C( 5452133486409330876), -INT64_C( 1170781541844144324),  INT64_C( 7831411851873845471),
+       INT64_C( 7964130134328705242),  INT64_C( 8414085535823304341), -INT64_C(  299141809664389243),  INT64_C( 3513046669839798973),
+       INT64_C( 4679531020553381210), -INT64_C( 3546279831164325346),  INT64_C( 4592423136287737253),  INT64_C( 1920876227683608099),
+       INT64_C( 5810926865797163704), -INT64_C( 5830069102631848703), -INT64_C( 9046276588568522828),  INT64_C( 1363644397668468754),
+       INT64_C( 1823705068775836109),  INT64_C( 1786093297570411791),  INT64_C( 8515115457090369865), -INT64_C( 7549945257462847796),
+      -INT64_C( 2814496012543479874),  INT64_C( 1682300951038415835),  INT64_C( 4093749432586119156),  INT64_C(  753113018583160594),
+      -INT64_C( 3680900011616368056), -INT64_C( 8428376098876892125), -INT64_C( 4202224918426564597), -INT64_C( 1288005690339553846),
+      -INT64_C(  802228074459496417),  INT64_C( 6406349911484656069),  INT64_C( 5129175003221117877),  INT64_C(  296813048765468810),
+      -INT64_C( 3655812359289233794), -INT64_C( 3710947306092549669),  INT64_C( 6242380283538394844), -INT64_C(  424000837496930765),
+      -INT64_C(   29400782914112829), -INT64_C( 5865753990839942731),  INT64_C( 7212418255607549429),  INT64_C(  368619253856509351),
+      -INT64_C( 6273962937777363253), -INT64_C( 5573190533075692248), -INT64_C(   41224710856134439),  INT64_C( 5723863485065128487),
+      -INT64_C( 3512757511511982171), -INT64_C( 7371984941778029502), -INT64_C( 3064118254887623646), -INT64_C( 9021642592000958982),
+       INT64_C( 8819554644341165038) };
+  static const uint8_t a[] =
+    { UINT8_C(104), UINT8_C(207), UINT8_C( 68), UINT8_C(160), UINT8_C( 41), UINT8_C(169), UINT8_C( 27), UINT8_C( 55),
+      UINT8_C(216), UINT8_C(148), UINT8_C(  5), UINT8_C(122), UINT8_C(191), UINT8_C(108), UINT8_C( 62), UINT8_C( 13),
+      UINT8_C(117), UINT8_C(125), UINT8_C( 10), UINT8_C(143), UINT8_C( 54), UINT8_C(220), UINT8_C(162), UINT8_C(141),
+      UINT8_C(237), UINT8_C( 51), UINT8_C(192), UINT8_C(174), UINT8_C(145), UINT8_C(117), UINT8_C( 93), UINT8_C(249),
+      UINT8_C( 68), UINT8_C(161), UINT8_C(154), UINT8_C(109), UINT8_C( 75), UINT8_C(181), UINT8_C(164), UINT8_C( 35),
+      UINT8_C( 73), UINT8_C(169), UINT8_C(157), UINT8_C(  8), UINT8_C( 21), UINT8_C(219), UINT8_C( 22), UINT8_C(138),
+      UINT8_C( 88), UINT8_C( 32), UINT8_C( 25), UINT8_C(143), UINT8_C(252), UINT8_C(188), UINT8_C( 28), UINT8_C(233),
+      UINT8_C(239), UINT8_C(220), UINT8_C(151), UINT8_C(128), UINT8_C( 81), UINT8_C(244), UINT8_C(122), UINT8_C(149),
+      UINT8_C(150), UINT8_C( 20), UINT8_C(  2), UINT8_C(225), UINT8_C(201), UINT8_C(166), UINT8_C(  4), UINT8_C( 18),
+      UINT8_C( 79), UINT8_C(162), UINT8_C( 27), UINT8_C(100), UINT8_C(125), UINT8_C( 49), UINT8_C(238), UINT8_C(214),
+      UINT8_C( 81), UINT8_C(  8), UINT8_C(101), UINT8_C( 77), UINT8_C(196), UINT8_C(129), UINT8_C( 54), UINT8_C(179),
+      UINT8_C( 93), UINT8_C(206), UINT8_C( 52), UINT8_C(174), UINT8_C(194), UINT8_C(174), UINT8_C( 67), UINT8_C( 88),
+      UINT8_C(194), UINT8_C( 69), UINT8_C( 57), UINT8_C(139), UINT8_C(235), UINT8_C( 62), UINT8_C(157), UINT8_C( 58),
+      UINT8_C(224), UINT8_C(184), UINT8_C(158), UINT8_C( 93), UINT8_C(233), UINT8_C(140), UINT8_C( 51), UINT8_C( 58),
+      UINT8_C(148), UINT8_C(152), UINT8_C(135), UINT8_C( 88), UINT8_C( 25), UINT8_C(190), UINT8_C( 12), UINT8_C(118),
+      UINT8_C(140), UINT8_C( 64), UINT8_C( 36), UINT8_C( 78), UINT8_C(238) };
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                  41),  INT64_C(                 169),  INT64_C(                  27),  INT64_C(                  55),
+       INT64_C(                 216),  INT64_C(                 148),  INT64_C(                   5),  INT64_C(                   0),
+       INT64_C(                 191),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  13),
+       INT64_C(                 117),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                 141),
+       INT64_C(                 237),  INT64_C(                   0),  INT64_C(                 192),  INT64_C(                 174),
+       INT64_C(                 145),  INT64_C(                 117),  INT64_C(                   0),  INT64_C(                 249),
+       INT64_C(                  68),  INT64_C(                   0),  INT64_C(                 154),  INT64_C(                 109),
+       INT64_C(                  75),  INT64_C(                   0),  INT64_C(                 164),  INT64_C(                  35),
+       INT64_C(                  73),  INT64_C(                 169),  INT64_C(                   0),  INT64_C(                   8),
+       INT64_C(                  21),  INT64_C(                 219),  INT64_C(                   0),  INT64_C(                 138),
+       INT64_C(                   0),  INT64_C(                  32),  INT64_C(                  25),  INT64_C(                 143),
+       INT64_C(                 252),  INT64_C(                 188),  INT64_C(                  28),  INT64_C(                 233),
+       INT64_C(                 239),  INT64_C(                 220),  INT64_C(                 151),  INT64_C(                 128),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                 122),  INT64_C(                 149),
+       INT64_C(                 150),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                 201),  INT64_C(                   0),  INT64_C(                   4),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  27),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                  49),  INT64_C(                 238),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                 101),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                 129),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                 206),  INT64_C(                  52),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  88),
+       INT64_C(                 194),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                 235),  INT64_C(                  62),  INT64_C(                 157),  INT64_C(                  58),
+       INT64_C(                 224),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                 233),  INT64_C(                 140),  INT64_C(                   0),  INT64_C(                  58),
+       INT64_C(                 148),  INT64_C(                 152),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                  25),  INT64_C(                 190),  INT64_C(                  12),  INT64_C(                   0),
+       INT64_C(                 140),  INT64_C(                  64),  INT64_C(                  36),  INT64_C(                  78),
+       INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1ub_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint8_t a[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1ub_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1ub_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C( 10210), -INT16_C(   303),  INT16_C( 28561),  INT16_C( 31324), -INT16_C( 28676), -INT16_C( 28491),  INT16_C( 15400),  INT16_C( 16873),
+      -INT16_C(  2566), -INT16_C( 31048), -INT16_C(  9163),  INT16_C(  9173),  INT16_C( 31812), -INT16_C(  3885),  INT16_C(  3676),  INT16_C( 31624),
+       INT16_C( 23014),  INT16_C( 30585), -INT16_C( 10807), -INT16_C( 14862), -INT16_C( 22683), -INT16_C( 29355),  INT16_C( 16099), -INT16_C(  8498),
+      -INT16_C( 31181),  INT16_C( 26724),  INT16_C( 14691), -INT16_C( 22645),  INT16_C( 24245),  INT16_C(  4759),  INT16_C(  8044),  INT16_C( 21389),
+       INT16_C(  1657),  INT16_C( 17098), -INT16_C( 17188),  INT16_C( 16647),  INT16_C( 23651),  INT16_C( 18382), -INT16_C( 25445), -INT16_C( 12763),
+      -INT16_C( 30429), -INT16_C( 31177), -INT16_C( 15677),  INT16_C( 30765), -INT16_C( 15327), -INT16_C( 29302),  INT16_C(  6116),  INT16_C( 24032),
+      -INT16_C( 21730), -INT16_C(  1377), -INT16_C( 22937), -INT16_C( 13509),  INT16_C(  2306), -INT16_C( 25326),  INT16_C( 14245), -INT16_C( 14228),
+      -INT16_C( 23616), -INT16_C( 31922),  INT16_C( 31589), -INT16_C( 30980), -INT16_C( 31168),  INT16_C(  9236), -INT16_C(  2914), -INT16_C( 17279),
+       INT16_C(  8351),  INT16_C(  1974), -INT16_C(  3642), -INT16_C( 14126), -INT16_C(  6918), -INT16_C( 24730), -INT16_C( 11749), -INT16_C(  9368),
+      -INT16_C( 18827), -INT16_C(  9633),  INT16_C( 23346),  INT16_C( 29281),  INT16_C( 30177),  INT16_C( 32662),  INT16_C(  5993),  INT16_C(  2363),
+      -INT16_C(  3785), -INT16_C(   752), -INT16_C(  7454), -INT16_C(  9019),  INT16_C( 11206), -INT16_C(  7812), -INT16_C(  6915),  INT16_C( 29372),
+       INT16_C(  7066), -INT16_C( 13235), -INT16_C( 20874),  INT16_C( 22590), -INT16_C( 11229), -INT16_C( 29481),  INT16_C(  5099),  INT16_C(  8853),
+      -INT16_C( 23292), -INT16_C(  6369), -INT16_C(  6777),  INT16_C( 19907),  INT16_C( 16144),  INT16_C(  3630), -INT16_C(  5341), -INT16_C( 16768),
+      -INT16_C( 13050),  INT16_C( 32138), -INT16_C( 13957), -INT16_C( 24875), -INT16_C( 21347), -INT16_C( 30421), -INT16_C( 16193), -INT16_C( 15189),
+      -INT16_C( 13466), -INT16_C(  4693),  INT16_C( 28336), -INT16_C( 16325),  INT16_C( 27054), -INT16_C( 11826),  INT16_C( 20308),  INT16_C( 23439),
+       INT16_C(  6684), -INT16_C( 26408), -INT16_C( 21021), -INT16_C( 32714),  INT16_C( 24921),  INT16_C(  6409), -INT16_C( 19166), -INT16_C( 30499),
+      -INT16_C( 30592),  INT16_C( 12405), -INT16_C( 20234), -INT16_C( 23312), -INT16_C( 16614),  INT16_C( 28278),  INT16_C(  1294),  INT16_C( 10953),
+      -INT16_C( 24289),  INT16_C(   706), -INT16_C(  1714), -INT16_C( 22397), -INT16_C( 29606),  INT16_C( 31937), -INT16_C( 25023), -INT16_C( 16124),
+       INT16_C( 31270),  INT16_C(  7409), -INT16_C(  7638),  INT16_C( 17601),  INT16_C( 14241), -INT16_C( 20557),  INT16_C( 31804),  INT16_C( 23769),
+      -INT16_C( 25570),  INT16_C( 27742), -INT16_C(  7787), -INT16_C(  4332), -INT16_C( 10898), -INT16_C( 20628),  INT16_C( 28787), -INT16_C( 26255),
+       INT16_C( 25322),  INT16_C(  5558),  INT16_C( 30532), -INT16_C(  6823),  INT16_C(  3246), -INT16_C(  5484),  INT16_C( 28297), -INT16_C( 22714),
+      -INT16_C( 23286), -INT16_C( 24813),  INT16_C( 10374), -INT16_C(  2930), -INT16_C(  1283),  INT16_C( 29092),  INT16_C(  5483),  INT16_C( 21770),
+      -INT16_C( 16265), -INT16_C( 17302), -INT16_C( 15305), -INT16_C(  6751),  INT16_C( 14032),  INT16_C( 22992),  INT16_C(  5796), -INT16_C( 20992),
+       INT16_C(  5307),  INT16_C( 16973), -INT16_C(  9412),  INT16_C( 14646), -INT16_C(  9514),  INT16_C( 16810), -INT16_C( 18961),  INT16_C( 26518),
+       INT16_C(   373), -INT16_C( 21213), -INT16_C( 15163), -INT16_C( 27246),  INT16_C( 25338), -INT16_C( 24849), -INT16_C(  4231),  INT16_C( 13388),
+      -INT16_C( 26365),  INT16_C( 16246), -INT16_C( 21131),  INT16_C( 19321),  INT16_C(  9095),  INT16_C( 30604),  INT16_C(  8920),  INT16_C( 20190),
+       INT16_C(   291), -INT16_C(  5893), -INT16_C( 29243), -INT16_C( 16258),  INT16_C( 28144),  INT16_C( 26974), -INT16_C( 21668),  INT16_C( 24733),
+       INT16_C(  5188), -INT16_C( 18017),  INT16_C(  6337),  INT16_C( 18436), -INT16_C( 28612),  INT16_C(  5311), -INT16_C( 25165), -INT16_C( 10654),
+       INT16_C( 23966),  INT16_C( 25791),  INT16_C( 15851), -INT16_C(  9436), -INT16_C( 32086),  INT16_C(  1604), -INT16_C(  7891),  INT16_C( 29286),
+       INT16_C(  1781), -INT16_C( 18901),  INT16_C( 12318),  INT16_C( 23295), -INT16_C( 16704),  INT16_C( 29551), -INT16_C( 11940), -INT16_C(  1462),
+       INT16_C(  2351),  INT16_C(  6750), -INT16_C( 32186), -INT16_C(  3851),  INT16_C( 14597),  INT16_C( 13046),  INT16_C( 23834),  INT16_C(  4260),
+      -INT16_C( 12189), -INT16_C( 32314), -INT16_C( 15104), -INT16_C( 16164),  INT16_C( 19332), -INT16_C(  8140),  INT16_C( 32284),  INT16_C( 19418),
+       INT16_C( 14727), -INT16_C( 12955),  INT16_C( 23227), -INT16_C( 16195), -INT16_C( 19565), -INT16_C( 20749), -INT16_C( 26864),  INT16_C( 29630),
+      -INT16_C( 31641),  INT16_C( 26613), -INT16_C( 11958), -INT16_C( 12760),  INT16_C( 23580),  INT16_C( 14510), -INT16_C( 30502),  INT16_C( 24964),
+      -INT16_C(  5695),  INT16_C( 32046), -INT16_C(  5308), -INT16_C( 10435),  INT16_C( 12446), -INT16_C( 20603),  INT16_C( 17352),  INT16_C( 12066),
+       INT16_C(  6088),  INT16_C(  4759), -INT16_C( 16408),  INT16_C(  1248), -INT16_C( 29157), -INT16_C(  2755), -INT16_C( 16106), -INT16_C( 10154),
+      -INT16_C( 31574), -INT16_C(  4523), -INT16_C( 28049),  INT16_C(  3526),  INT16_C( 19395), -INT16_C( 29764), -INT16_C(  8305),  INT16_C( 22458),
+       INT16_C( 20982), -INT16_C(  8343),  INT16_C( 18704),  INT16_C( 11235),  INT16_C(  8407), -INT16_C(  4832),  INT16_C( 30433), -INT16_C( 29499),
+       INT16_C(  6906),  INT16_C( 27002),  INT16_C( 16557),  INT16_C( 28791),  INT16_C( 13196),  INT16_C(  7163), -INT16_C( 19182),  INT16_C(  2418),
+      -INT16_C(  9465),  INT16_C(  6120), -INT16_C( 13532), -INT16_C(  1213),  INT16_C( 25580), -INT16_C( 12824), -INT16_C( 20774), -INT16_C( 11175),
+      -INT16_C( 11064),  INT16_C( 30014), -INT16_C( 19180), -INT16_C( 24347), -INT16_C(  7960), -INT16_C(  1093),  INT16_C( 11670), -INT16_C( 25340),
+      -INT16_C(  5112),  INT16_C( 11444), -INT16_C(  2121), -INT16_C( 23769),  INT16_C(  4187),  INT16_C( 13681), -INT16_C( 13634), -INT16_C( 31223),
+       INT16_C( 18334), -INT16_C( 19460), -INT16_C(  7684), -INT16_C(  6829),  INT16_C(  4034),  INT16_C( 22752), -INT16_C(  7108),  INT16_C( 17909),
+      -INT16_C( 22064), -INT16_C( 30863), -INT16_C( 26207), -INT16_C(   981), -INT16_C( 25431),  INT16_C( 26417),  INT16_C( 14950),  INT16_C(  1517),
+      -INT16_C(  5758),  INT16_C( 32440),  INT16_C(  3019), -INT16_C( 29341),  INT16_C( 17178),  INT16_C( 22501), -INT16_C(  9689), -INT16_C(  2148),
+       INT16_C(  3459),  INT16_C(  9343), -INT16_C( 21850),  INT16_C( 20256),  INT16_C( 20806), -INT16_C( 21322), -INT16_C( 23412),  INT16_C(  3761),
+       INT16_C( 27021),  INT16_C( 22668), -INT16_C(  3979), -INT16_C( 28699), -INT16_C( 13773),  INT16_C( 23526), -INT16_C( 32092),  INT16_C( 10322),
+      -INT16_C( 11888),  INT16_C( 13900),  INT16_C( 28027), -INT16_C( 15994),  INT16_C( 15550),  INT16_C( 19054),  INT16_C(  8160),  INT16_C( 28248),
+      -INT16_C(  6775), -INT16_C(   314), -INT16_C( 21291),  INT16_C(  2189),  INT16_C( 29814),  INT16_C(  7011), -INT16_C( 18698), -INT16_C( 31165),
+      -INT16_C( 28793),  INT16_C(   957),  INT16_C( 17404), -INT16_C( 17468),  INT16_C( 12927),  INT16_C( 24581),  INT16_C( 24146), -INT16_C(  9266),
+      -INT16_C( 27581),  INT16_C(  6361),  INT16_C( 26176), -INT16_C( 18656), -INT16_C( 31526), -INT16_C( 11822),  INT16_C(  5434), -INT16_C( 16041),
+       INT16_C(  5284), -INT16_C( 24124), -INT16_C( 30377), -INT16_C( 10404),  INT16_C( 25019),  INT16_C(  3383),  INT16_C(  1471),  INT16_C(   744),
+      -INT16_C( 15975), -INT16_C(  9702),  INT16_C( 15144),  INT16_C(   657),  INT16_C( 25535), -INT16_C(  1581),  INT16_C( 11128),  INT16_C(  7354),
+       INT16_C( 32575), -INT16_C( 26691),  INT16_C(  6408), -INT16_C( 15506) };
+  static const uint8_t a[] =
+    { UINT8_C( 22), UINT8_C(247), UINT8_C(121), UINT8_C(222), UINT8_C( 46), UINT8_C( 30), UINT8_C(209), UINT8_C(196),
+      UINT8_C( 44), UINT8_C(210), UINT8_C(104), UINT8_C(224), UINT8_C(175), UINT8_C(224), UINT8_C(128), UINT8_C(160),
+      UINT8_C(244), UINT8_C(173), UINT8_C( 60), UINT8_C(249), UINT8_C(132), UINT8_C(174), UINT8_C( 11), UINT8_C(115),
+      UINT8_C( 34), UINT8_C(136), UINT8_C(149), UINT8_C(143), UINT8_C(166), UINT8_C(165), UINT8_C( 14), UINT8_C(188),
+      UINT8_C(156), UINT8_C(136), UINT8_C(154), UINT8_C(202), UINT8_C(166), UINT8_C(107), UINT8_C(142), UINT8_C(211),
+      UINT8_C( 61), UINT8_C(247), UINT8_C(179), UINT8_C(237), UINT8_C(215), UINT8_C( 51), UINT8_C(141), UINT8_C(203),
+      UINT8_C(224), UINT8_C(202), UINT8_C(196), UINT8_C(100), UINT8_C(120), UINT8_C(208), UINT8_C(216), UINT8_C(154),
+      UINT8_C( 88), UINT8_C(109), UINT8_C( 41),    UINT8_MAX, UINT8_C( 18), UINT8_C( 55), UINT8_C(187), UINT8_C(174),
+      UINT8_C(191), UINT8_C( 86), UINT8_C(120), UINT8_C(102), UINT8_C(193), UINT8_C(  7), UINT8_C( 57),    UINT8_MAX,
+      UINT8_C(254), UINT8_C(236), UINT8_C(236), UINT8_C(213), UINT8_C( 31), UINT8_C(121), UINT8_C(161),    UINT8_MAX,
+      UINT8_C( 67), UINT8_C(101), UINT8_C(100), UINT8_C(187), UINT8_C( 53), UINT8_C( 60), UINT8_C( 85), UINT8_C(142),
+      UINT8_C(169), UINT8_C(126), UINT8_C(141), UINT8_C(188), UINT8_C(182), UINT8_C( 72), UINT8_C(106), UINT8_C(117),
+      UINT8_C(158), UINT8_C(227), UINT8_C(219), UINT8_C( 96), UINT8_C(234), UINT8_C( 20), UINT8_C( 95), UINT8_C(232),
+      UINT8_C(  0), UINT8_C( 75), UINT8_C(189), UINT8_C( 31), UINT8_C(196), UINT8_C( 94), UINT8_C( 31), UINT8_C(  8),
+      UINT8_C(196), UINT8_C(131), UINT8_C(195), UINT8_C(249), UINT8_C(191), UINT8_C( 25), UINT8_C(135), UINT8_C(104),
+      UINT8_C(151), UINT8_C( 20), UINT8_C( 36), UINT8_C( 77), UINT8_C( 93), UINT8_C(143), UINT8_C(195), UINT8_C(251),
+      UINT8_C(114), UINT8_C(158), UINT8_C( 91), UINT8_C( 92), UINT8_C(179), UINT8_C(186), UINT8_C( 68), UINT8_C(179),
+      UINT8_C(  5), UINT8_C(  1), UINT8_C(211), UINT8_C(202), UINT8_C( 96), UINT8_C(242), UINT8_C(210), UINT8_C( 36),
+      UINT8_C(117), UINT8_C(149), UINT8_C( 29), UINT8_C( 52), UINT8_C(174), UINT8_C(165), UINT8_C(156), UINT8_C( 70),
+      UINT8_C(185), UINT8_C(193), UINT8_C(147), UINT8_C( 22), UINT8_C( 80), UINT8_C( 86), UINT8_C( 18), UINT8_C(194),
+      UINT8_C(245), UINT8_C(109), UINT8_C( 30), UINT8_C(168), UINT8_C( 40), UINT8_C( 98), UINT8_C( 91), UINT8_C( 45),
+      UINT8_C( 99), UINT8_C( 46), UINT8_C(247), UINT8_C(195), UINT8_C( 32), UINT8_C(201), UINT8_C(231), UINT8_C(149),
+      UINT8_C( 95), UINT8_C(  5), UINT8_C(201), UINT8_C( 13), UINT8_C(170), UINT8_C(102), UINT8_C( 83), UINT8_C( 99),
+      UINT8_C( 39), UINT8_C(231), UINT8_C(122), UINT8_C(119), UINT8_C( 61), UINT8_C(140), UINT8_C( 57), UINT8_C( 50),
+      UINT8_C(249), UINT8_C( 87), UINT8_C(218), UINT8_C( 33), UINT8_C(185), UINT8_C( 54), UINT8_C( 79), UINT8_C( 28),
+      UINT8_C(100), UINT8_C( 70), UINT8_C(224), UINT8_C(133), UINT8_C( 16), UINT8_C(199), UINT8_C( 26), UINT8_C(111),
+      UINT8_C(204), UINT8_C(228), UINT8_C(124), UINT8_C(118), UINT8_C( 74), UINT8_C(208), UINT8_C(218), UINT8_C(113),
+      UINT8_C(183), UINT8_C( 84), UINT8_C(232), UINT8_C(244), UINT8_C(224), UINT8_C( 33), UINT8_C( 39), UINT8_C(217),
+      UINT8_C(120), UINT8_C(  1), UINT8_C(251), UINT8_C( 49), UINT8_C( 55), UINT8_C( 74), UINT8_C( 77), UINT8_C(156),
+      UINT8_C(144), UINT8_C( 45), UINT8_C( 33), UINT8_C(160), UINT8_C(245), UINT8_C( 59), UINT8_C( 15), UINT8_C(193),
+      UINT8_C( 31), UINT8_C(140), UINT8_C( 56), UINT8_C(105), UINT8_C( 92), UINT8_C( 18), UINT8_C(218), UINT8_C( 19),
+      UINT8_C(102), UINT8_C(194), UINT8_C(  7), UINT8_C( 70), UINT8_C(227), UINT8_C( 46), UINT8_C( 31), UINT8_C( 91),
+      UINT8_C( 48), UINT8_C( 26), UINT8_C(140), UINT8_C(103), UINT8_C(100), UINT8_C(218), UINT8_C(  3), UINT8_C(245),
+      UINT8_C(  7), UINT8_C( 36), UINT8_C(149), UINT8_C(252), UINT8_C( 96), UINT8_C(165), UINT8_C(190), UINT8_C(127),
+      UINT8_C( 49), UINT8_C(246), UINT8_C(233), UINT8_C(141), UINT8_C(  8), UINT8_C(195), UINT8_C(160), UINT8_C(110),
+      UINT8_C(134), UINT8_C(167), UINT8_C(180), UINT8_C(105), UINT8_C(214), UINT8_C(211), UINT8_C(197), UINT8_C(  6),
+      UINT8_C(238), UINT8_C( 81), UINT8_C(109), UINT8_C( 82), UINT8_C( 43), UINT8_C(113), UINT8_C( 71), UINT8_C( 51),
+      UINT8_C(149), UINT8_C(221), UINT8_C( 47), UINT8_C(245), UINT8_C(130), UINT8_C(237), UINT8_C(117), UINT8_C(179),
+      UINT8_C(227), UINT8_C( 94), UINT8_C( 64), UINT8_C(235), UINT8_C( 33), UINT8_C(224), UINT8_C( 89), UINT8_C(167),
+      UINT8_C(135), UINT8_C( 13), UINT8_C( 17), UINT8_C( 93), UINT8_C(225), UINT8_C(214), UINT8_C( 99), UINT8_C(207),
+      UINT8_C( 39), UINT8_C(209), UINT8_C( 33), UINT8_C( 83), UINT8_C( 66), UINT8_C(105), UINT8_C(134), UINT8_C(215),
+      UINT8_C( 70), UINT8_C(181), UINT8_C(205), UINT8_C(200), UINT8_C(163), UINT8_C( 66), UINT8_C(123), UINT8_C(134),
+      UINT8_C(160), UINT8_C(187), UINT8_C(114), UINT8_C(193), UINT8_C(155), UINT8_C(203), UINT8_C(105), UINT8_C( 34),
+      UINT8_C(217), UINT8_C(122), UINT8_C(128), UINT8_C(186), UINT8_C( 80), UINT8_C(227), UINT8_C(137), UINT8_C(119),
+      UINT8_C(180), UINT8_C(170), UINT8_C(202), UINT8_C(246), UINT8_C( 19), UINT8_C( 80), UINT8_C(206), UINT8_C( 89),
+      UINT8_C(  6), UINT8_C(155), UINT8_C( 33), UINT8_C(169), UINT8_C(221), UINT8_C(156), UINT8_C( 47), UINT8_C(125),
+      UINT8_C( 87), UINT8_C(161), UINT8_C( 62), UINT8_C(242), UINT8_C(109), UINT8_C(167), UINT8_C( 21), UINT8_C( 70),
+      UINT8_C( 33), UINT8_C(149), UINT8_C(  0), UINT8_C(113), UINT8_C(120), UINT8_C(137), UINT8_C(233), UINT8_C( 45),
+      UINT8_C( 51), UINT8_C(179), UINT8_C( 35), UINT8_C( 71), UINT8_C(  4), UINT8_C(241), UINT8_C(160), UINT8_C( 10),
+      UINT8_C(140), UINT8_C(194), UINT8_C(179), UINT8_C(105), UINT8_C( 94), UINT8_C(226), UINT8_C(230), UINT8_C(182),
+      UINT8_C(132), UINT8_C( 37), UINT8_C(168), UINT8_C(241), UINT8_C(204), UINT8_C(189), UINT8_C( 55), UINT8_C(238),
+      UINT8_C( 82), UINT8_C( 55), UINT8_C( 95), UINT8_C(203), UINT8_C(192), UINT8_C( 72), UINT8_C(248), UINT8_C(243),
+      UINT8_C(252), UINT8_C( 27), UINT8_C( 58), UINT8_C(  0), UINT8_C( 13), UINT8_C(219), UINT8_C( 10), UINT8_C(153),
+      UINT8_C(157), UINT8_C(189), UINT8_C(  3), UINT8_C(251) };
+  static const uint16_t e[] =
+    { UINT16_C(   22), UINT16_C(  247), UINT16_C(    0), UINT16_C(    0), UINT16_C(   46), UINT16_C(   30), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   44), UINT16_C(  210), UINT16_C(  104), UINT16_C(    0), UINT16_C(    0), UINT16_C(  224), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(   60), UINT16_C(  249), UINT16_C(  132), UINT16_C(  174), UINT16_C(    0), UINT16_C(  115),
+      UINT16_C(   34), UINT16_C(    0), UINT16_C(    0), UINT16_C(  143), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(  154), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  142), UINT16_C(  211),
+      UINT16_C(   61), UINT16_C(  247), UINT16_C(  179), UINT16_C(    0), UINT16_C(  215), UINT16_C(   51), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  224), UINT16_C(  202), UINT16_C(  196), UINT16_C(  100), UINT16_C(    0), UINT16_C(  208), UINT16_C(    0), UINT16_C(  154),
+      UINT16_C(   88), UINT16_C(  109), UINT16_C(    0), UINT16_C(  255), UINT16_C(   18), UINT16_C(    0), UINT16_C(  187), UINT16_C(  174),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(  120), UINT16_C(  102), UINT16_C(  193), UINT16_C(    7), UINT16_C(   57), UINT16_C(  255),
+      UINT16_C(  254), UINT16_C(  236), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   67), UINT16_C(  101), UINT16_C(  100), UINT16_C(  187), UINT16_C(    0), UINT16_C(   60), UINT16_C(   85), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(  126), UINT16_C(  141), UINT16_C(    0), UINT16_C(  182), UINT16_C(   72), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  158), UINT16_C(  227), UINT16_C(  219), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   95), UINT16_C(  232),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(  189), UINT16_C(   31), UINT16_C(  196), UINT16_C(   94), UINT16_C(   31), UINT16_C(    8),
+      UINT16_C(  196), UINT16_C(  131), UINT16_C(    0), UINT16_C(  249), UINT16_C(    0), UINT16_C(   25), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   20), UINT16_C(   36), UINT16_C(   77), UINT16_C(    0), UINT16_C(    0), UINT16_C(  195), UINT16_C(  251),
+      UINT16_C(  114), UINT16_C(    0), UINT16_C(   91), UINT16_C(   92), UINT16_C(  179), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    5), UINT16_C(    0), UINT16_C(  211), UINT16_C(  202), UINT16_C(   96), UINT16_C(    0), UINT16_C(  210), UINT16_C(   36),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(   29), UINT16_C(    0), UINT16_C(    0), UINT16_C(  165), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  185), UINT16_C(    0), UINT16_C(  147), UINT16_C(   22), UINT16_C(   80), UINT16_C(   86), UINT16_C(    0), UINT16_C(  194),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  168), UINT16_C(    0), UINT16_C(   98), UINT16_C(    0), UINT16_C(   45),
+      UINT16_C(   99), UINT16_C(   46), UINT16_C(    0), UINT16_C(  195), UINT16_C(   32), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   95), UINT16_C(    5), UINT16_C(  201), UINT16_C(   13), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   99),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(  122), UINT16_C(    0), UINT16_C(   61), UINT16_C(    0), UINT16_C(   57), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   87), UINT16_C(  218), UINT16_C(   33), UINT16_C(    0), UINT16_C(   54), UINT16_C(   79), UINT16_C(    0),
+      UINT16_C(  100), UINT16_C(    0), UINT16_C(  224), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(  228), UINT16_C(  124), UINT16_C(  118), UINT16_C(    0), UINT16_C(    0), UINT16_C(  218), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   84), UINT16_C(    0), UINT16_C(    0), UINT16_C(  224), UINT16_C(    0), UINT16_C(   39), UINT16_C(  217),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   49), UINT16_C(   55), UINT16_C(    0), UINT16_C(   77), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   45), UINT16_C(    0), UINT16_C(    0), UINT16_C(  245), UINT16_C(    0), UINT16_C(   15), UINT16_C(  193),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(   56), UINT16_C(  105), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  102), UINT16_C(  194), UINT16_C(    7), UINT16_C(   70), UINT16_C(    0), UINT16_C(   46), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(   26), UINT16_C(    0), UINT16_C(  103), UINT16_C(  100), UINT16_C(  218), UINT16_C(    3), UINT16_C(    0),
+      UINT16_C(    7), UINT16_C(    0), UINT16_C(  149), UINT16_C(  252), UINT16_C(    0), UINT16_C(    0), UINT16_C(  190), UINT16_C(    0),
+      UINT16_C(   49), UINT16_C(    0), UINT16_C(  233), UINT16_C(  141), UINT16_C(    0), UINT16_C(  195), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(  180), UINT16_C(    0), UINT16_C(  214), UINT16_C(  211), UINT16_C(  197), UINT16_C(    6),
+      UINT16_C(  238), UINT16_C(   81), UINT16_C(  109), UINT16_C(    0), UINT16_C(    0), UINT16_C(  113), UINT16_C(   71), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(  221), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  237), UINT16_C(    0), UINT16_C(  179),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(   89), UINT16_C(    0),
+      UINT16_C(  135), UINT16_C(    0), UINT16_C(   17), UINT16_C(   93), UINT16_C(    0), UINT16_C(  214), UINT16_C(   99), UINT16_C(  207),
+      UINT16_C(   39), UINT16_C(    0), UINT16_C(   33), UINT16_C(   83), UINT16_C(   66), UINT16_C(  105), UINT16_C(    0), UINT16_C(  215),
+      UINT16_C(   70), UINT16_C(    0), UINT16_C(  205), UINT16_C(  200), UINT16_C(    0), UINT16_C(    0), UINT16_C(  123), UINT16_C(  134),
+      UINT16_C(    0), UINT16_C(  187), UINT16_C(  114), UINT16_C(  193), UINT16_C(    0), UINT16_C(    0), UINT16_C(  105), UINT16_C(    0),
+      UINT16_C(  217), UINT16_C(  122), UINT16_C(  128), UINT16_C(  186), UINT16_C(   80), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  180), UINT16_C(    0), UINT16_C(    0), UINT16_C(  246), UINT16_C(    0), UINT16_C(    0), UINT16_C(  206), UINT16_C(   89),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(   33), UINT16_C(    0), UINT16_C(    0), UINT16_C(  156), UINT16_C(   47), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(   62), UINT16_C(  242), UINT16_C(  109), UINT16_C(    0), UINT16_C(   21), UINT16_C(    0),
+      UINT16_C(   33), UINT16_C(    0), UINT16_C(    0), UINT16_C(  113), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(   51), UINT16_C(  179), UINT16_C(   35), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  160), UINT16_C(   10),
+      UINT16_C(  140), UINT16_C(    0), UINT16_C(    0), UINT16_C(  105), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  182),
+      UINT16_C(  132), UINT16_C(    0), UINT16_C(    0), UINT16_C(  241), UINT16_C(  204), UINT16_C(  189), UINT16_C(    0), UINT16_C(  238),
+      UINT16_C(    0), UINT16_C(   55), UINT16_C(   95), UINT16_C(  203), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  252), UINT16_C(   27), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  219), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(  189), UINT16_C(    0), UINT16_C(  251) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svld1ub_u16(pv, &(a[i]));
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(uint16_t)];
+  uint8_t a[1024 / sizeof(uint16_t)];
+  uint16_t e[1024 / sizeof(uint16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    ev = simde_svld1ub_u16(pv, &(a[i]));
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1ub_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(  1895569347),  INT32_C(   851215298),  INT32_C(  2106774778),  INT32_C(   458684592),  INT32_C(  1295780304), -INT32_C(   107051816),  INT32_C(  1088227937),  INT32_C(   613928679),
+       INT32_C(  2041813686),  INT32_C(   413888286), -INT32_C(   191546045),  INT32_C(   101706806), -INT32_C(   833401867),  INT32_C(   835187151), -INT32_C(   495868677),  INT32_C(   688261235),
+      -INT32_C(  1063077470),  INT32_C(  1826180649), -INT32_C(  1050644853),  INT32_C(  1355247450), -INT32_C(  1977738310),  INT32_C(   146531596), -INT32_C(    34984822), -INT32_C(   702090956),
+      -INT32_C(   745027158), -INT32_C(  1572835305),  INT32_C(   962896094), -INT32_C(   896980208),  INT32_C(  1398056774),  INT32_C(   375066508),  INT32_C(  1863533883), -INT32_C(   515491274),
+       INT32_C(   448060675),  INT32_C(   733803597), -INT32_C(  1520164715), -INT32_C(  1838158516),  INT32_C(   568706196),  INT32_C(   255279315), -INT32_C(  1132573818), -INT32_C(  2002926459),
+      -INT32_C(   291351903), -INT32_C(   619028922), -INT32_C(   880771457),  INT32_C(     6156396), -INT32_C(  2027863116),  INT32_C(   160848259),  INT32_C(   700847524),  INT32_C(  2075223001),
+      -INT32_C(    60206155),  INT32_C(   819430321),  INT32_C(  1861965826), -INT32_C(    59877048),  INT32_C(   528715932), -INT32_C(  1926685975),  INT32_C(   146206511),  INT32_C(   142829394),
+       INT32_C(  1795485114),  INT32_C(  1922882416),  INT32_C(  2078316339), -INT32_C(  1938337808), -INT32_C(   928187425),  INT32_C(  1146475797),  INT32_C(   374082500),  INT32_C(   740216946),
+       INT32_C(   764879549),  INT32_C(   832582654), -INT32_C(  1146257205), -INT32_C(  1371003697),  INT32_C(   880210975), -INT32_C(  1921463351),  INT32_C(  1218692566),  INT32_C(  1383383701),
+      -INT32_C(   494990108),  INT32_C(   169090879),  INT32_C(  1875296672),  INT32_C(    85855973), -INT32_C(   885419006),  INT32_C(   911782496),  INT32_C(   209714039), -INT32_C(  1570835523),
+       INT32_C(  1065672191), -INT32_C(  1656121091),  INT32_C(  1057754969),  INT32_C(   524560925),  INT32_C(   535461311), -INT32_C(  1504361937), -INT32_C(    72166338), -INT32_C(   946007864),
+      -INT32_C(   351919378),  INT32_C(   344477882),  INT32_C(  2102629471),  INT32_C(  2124191679),  INT32_C(  1151174420),  INT32_C(   132838089), -INT32_C(  1895588409), -INT32_C(  1688821587),
+       INT32_C(  2105957826),  INT32_C(   210833069),  INT32_C(  1653204131), -INT32_C(  1881135493),  INT32_C(  1993571757),  INT32_C(   914275951),  INT32_C(   147161435), -INT32_C(   459006943),
+       INT32_C(   643902073), -INT32_C(   600640967),  INT32_C(  1363066070), -INT32_C(  1881137438),  INT32_C(   168146075), -INT32_C(   851344526),  INT32_C(   651494916), -INT32_C(  1693812446),
+      -INT32_C(   574526556),  INT32_C(   867824733), -INT32_C(  1836779600), -INT32_C(  1339988971), -INT32_C(  1967512040), -INT32_C(  1369965654),  INT32_C(   617884930),  INT32_C(  1254153894),
+      -INT32_C(  1507360439),  INT32_C(   635035765), -INT32_C(   323527209), -INT32_C(   627255102), -INT32_C(  1452976129),  INT32_C(  1415035986), -INT32_C(  1871106839),  INT32_C(  1423587594),
+       INT32_C(   821691066), -INT32_C(  1168780062), -INT32_C(   207221455), -INT32_C(   456244251), -INT32_C(   326290534), -INT32_C(   649992721),  INT32_C(   459913745), -INT32_C(  1385217037),
+       INT32_C(   685599301),  INT32_C(  1877095230),  INT32_C(   627279936),  INT32_C(  1695166923),  INT32_C(  1397921636), -INT32_C(  1926458500),  INT32_C(  1084855629),  INT32_C(   518854873),
+      -INT32_C(  1069102206),  INT32_C(  1043343614),  INT32_C(  2086900657),  INT32_C(   685927876), -INT32_C(  2122632187),  INT32_C(   336570567),  INT32_C(   374650941),  INT32_C(  1395999184),
+       INT32_C(   169048844),  INT32_C(  1430799268), -INT32_C(  1697534762),  INT32_C(   516076313), -INT32_C(  1365229849),  INT32_C(   599961574),  INT32_C(   926553703),  INT32_C(  1686794072),
+      -INT32_C(  1905287446), -INT32_C(  1193035807),  INT32_C(  2102572387),  INT32_C(  1352340840),  INT32_C(   972962643),  INT32_C(  1365033450),  INT32_C(   797546199), -INT32_C(   258731259),
+      -INT32_C(  1820458063),  INT32_C(   508256954),  INT32_C(  2140904727),  INT32_C(    97466034),  INT32_C(  1547619954),  INT32_C(  1722719119),  INT32_C(   932591409), -INT32_C(    64542134),
+      -INT32_C(   410016467),  INT32_C(   503699975),  INT32_C(   715038839),  INT32_C(  1227845079), -INT32_C(   895128005),  INT32_C(   976311049), -INT32_C(   713963638),  INT32_C(   517052657),
+       INT32_C(  1157980222), -INT32_C(  1318843590), -INT32_C(  2099576149), -INT32_C(  1412756625), -INT32_C(  2106232455),  INT32_C(  1337763524),  INT32_C(  1579429485),  INT32_C(    75298246),
+      -INT32_C(  1890942379),  INT32_C(   943763085),  INT32_C(   532356272), -INT32_C(  1597340121), -INT32_C(  1138605833),  INT32_C(  1410064102), -INT32_C(   743297268),  INT32_C(  2044145444),
+       INT32_C(  1040720305),  INT32_C(  2138458319), -INT32_C(  1952501404), -INT32_C(  1356109384), -INT32_C(  1872015959),  INT32_C(   954496556), -INT32_C(   921987419),  INT32_C(  1984095173),
+      -INT32_C(   726382076), -INT32_C(   145544301),  INT32_C(   344191580),  INT32_C(    96775772),  INT32_C(   680865788),  INT32_C(  1264613798), -INT32_C(   720016368),  INT32_C(  1397512015),
+       INT32_C(   891748514), -INT32_C(  2010350805), -INT32_C(   912478355),  INT32_C(  1523540062),  INT32_C(   914515088), -INT32_C(   293477666) };
+  static const uint8_t a[] =
+    { UINT8_C( 46), UINT8_C(209), UINT8_C( 90), UINT8_C(222), UINT8_C(124), UINT8_C(156), UINT8_C(150), UINT8_C(181),
+      UINT8_C(114), UINT8_C(  0), UINT8_C( 73), UINT8_C(249), UINT8_C(199), UINT8_C(223), UINT8_C(213), UINT8_C(112),
+      UINT8_C(218), UINT8_C(176), UINT8_C( 75), UINT8_C(172), UINT8_C(214), UINT8_C( 52), UINT8_C(111), UINT8_C( 28),
+      UINT8_C(165), UINT8_C(214), UINT8_C(117), UINT8_C(198), UINT8_C( 74), UINT8_C(183), UINT8_C(166), UINT8_C(121),
+      UINT8_C(136), UINT8_C(  1), UINT8_C( 87), UINT8_C(  4), UINT8_C(157), UINT8_C(237), UINT8_C(185), UINT8_C( 16),
+      UINT8_C(238), UINT8_C(  3), UINT8_C(  9), UINT8_C(181), UINT8_C(226), UINT8_C(222), UINT8_C( 38), UINT8_C(188),
+      UINT8_C(143), UINT8_C(113), UINT8_C(105), UINT8_C(101), UINT8_C(165), UINT8_C(216), UINT8_C(129), UINT8_C( 74),
+      UINT8_C(174), UINT8_C(246), UINT8_C( 17), UINT8_C(249), UINT8_C(173), UINT8_C(183), UINT8_C(114), UINT8_C( 53),
+      UINT8_C(184), UINT8_C(201), UINT8_C( 57), UINT8_C( 86), UINT8_C(183), UINT8_C(243), UINT8_C(102), UINT8_C(165),
+      UINT8_C(246), UINT8_C(111), UINT8_C( 90), UINT8_C(216), UINT8_C( 78), UINT8_C(128), UINT8_C(148), UINT8_C(221),
+      UINT8_C(241), UINT8_C(253), UINT8_C( 66), UINT8_C(150), UINT8_C(213), UINT8_C(195), UINT8_C(225), UINT8_C(132),
+      UINT8_C(185), UINT8_C(242), UINT8_C(125), UINT8_C(103), UINT8_C(169), UINT8_C(239), UINT8_C(156), UINT8_C( 98),
+      UINT8_C(184), UINT8_C(214), UINT8_C(184), UINT8_C(111), UINT8_C(201), UINT8_C( 30), UINT8_C( 20), UINT8_C(191),
+      UINT8_C(141), UINT8_C(111), UINT8_C(151), UINT8_C(219), UINT8_C(239), UINT8_C( 43), UINT8_C(184), UINT8_C(225),
+      UINT8_C( 41), UINT8_C(250), UINT8_C(119), UINT8_C(254), UINT8_C(189), UINT8_C( 88), UINT8_C(130), UINT8_C(119),
+      UINT8_C( 74),    UINT8_MAX, UINT8_C(222), UINT8_C(244), UINT8_C(238), UINT8_C(122), UINT8_C( 86), UINT8_C(167),
+      UINT8_C( 80), UINT8_C( 14), UINT8_C( 22), UINT8_C( 25), UINT8_C( 44), UINT8_C( 43), UINT8_C(216), UINT8_C(185),
+      UINT8_C(154), UINT8_C(111), UINT8_C(149), UINT8_C(137), UINT8_C(155), UINT8_C( 77), UINT8_C(106), UINT8_C(196),
+      UINT8_C( 72), UINT8_C(226), UINT8_C(194), UINT8_C(  5), UINT8_C( 58), UINT8_C( 69), UINT8_C(124), UINT8_C(133),
+      UINT8_C( 68), UINT8_C( 90), UINT8_C(121), UINT8_C( 51), UINT8_C(213), UINT8_C(207), UINT8_C(218), UINT8_C( 37),
+      UINT8_C(221), UINT8_C(240), UINT8_C( 63), UINT8_C(  9), UINT8_C( 27), UINT8_C( 23), UINT8_C(194), UINT8_C(181),
+      UINT8_C(135), UINT8_C( 87), UINT8_C( 63), UINT8_C( 34), UINT8_C(165), UINT8_C(169), UINT8_C(230), UINT8_C(237),
+      UINT8_C(139), UINT8_C(168), UINT8_C(242), UINT8_C(198), UINT8_C(237), UINT8_C(111), UINT8_C( 75), UINT8_C( 50),
+      UINT8_C(201), UINT8_C(196), UINT8_C(101), UINT8_C(158), UINT8_C(147), UINT8_C( 63), UINT8_C(196), UINT8_C(112),
+      UINT8_C( 47), UINT8_C(  3), UINT8_C(121), UINT8_C( 75), UINT8_C( 26), UINT8_C( 59), UINT8_C(  0), UINT8_C(161),
+      UINT8_C(147), UINT8_C( 63), UINT8_C(195), UINT8_C( 56), UINT8_C(233), UINT8_C(169), UINT8_C( 37), UINT8_C(116),
+      UINT8_C( 82), UINT8_C( 23), UINT8_C( 58), UINT8_C( 63), UINT8_C(134), UINT8_C(133), UINT8_C(113), UINT8_C( 80),
+      UINT8_C( 73), UINT8_C(214), UINT8_C(238), UINT8_C(220), UINT8_C( 21), UINT8_C(178) };
+  static const uint32_t e[] =
+    { UINT32_C(        46), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       156), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(        73), UINT32_C(         0), UINT32_C(       199), UINT32_C(         0), UINT32_C(       213), UINT32_C(         0),
+      UINT32_C(       218), UINT32_C(         0), UINT32_C(        75), UINT32_C(         0), UINT32_C(       214), UINT32_C(         0), UINT32_C(       111), UINT32_C(        28),
+      UINT32_C(       165), UINT32_C(       214), UINT32_C(         0), UINT32_C(       198), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       121),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(        87), UINT32_C(         4), UINT32_C(         0), UINT32_C(         0), UINT32_C(       185), UINT32_C(        16),
+      UINT32_C(       238), UINT32_C(         3), UINT32_C(         9), UINT32_C(         0), UINT32_C(       226), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(       143), UINT32_C(         0), UINT32_C(         0), UINT32_C(       101), UINT32_C(         0), UINT32_C(       216), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       249), UINT32_C(       173), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(        57), UINT32_C(        86), UINT32_C(         0), UINT32_C(       243), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(       246), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(        78), UINT32_C(         0), UINT32_C(         0), UINT32_C(       221),
+      UINT32_C(         0), UINT32_C(       253), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       195), UINT32_C(       225), UINT32_C(       132),
+      UINT32_C(       185), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       156), UINT32_C(        98),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       111), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       191),
+      UINT32_C(         0), UINT32_C(       111), UINT32_C(         0), UINT32_C(       219), UINT32_C(         0), UINT32_C(        43), UINT32_C(         0), UINT32_C(       225),
+      UINT32_C(        41), UINT32_C(         0), UINT32_C(       119), UINT32_C(       254), UINT32_C(       189), UINT32_C(        88), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(        74), UINT32_C(         0), UINT32_C(       222), UINT32_C(       244), UINT32_C(       238), UINT32_C(         0), UINT32_C(        86), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(        14), UINT32_C(        22), UINT32_C(        25), UINT32_C(        44), UINT32_C(        43), UINT32_C(         0), UINT32_C(       185),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(        77), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(        72), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(        58), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(       121), UINT32_C(         0), UINT32_C(       213), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(       221), UINT32_C(       240), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       181),
+      UINT32_C(       135), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       237),
+      UINT32_C(       139), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       237), UINT32_C(         0), UINT32_C(        75), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(       196), UINT32_C(       101), UINT32_C(       158), UINT32_C(       147), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(        47), UINT32_C(         0), UINT32_C(         0), UINT32_C(        75), UINT32_C(        26), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(       195), UINT32_C(        56), UINT32_C(       233), UINT32_C(         0), UINT32_C(        37), UINT32_C(         0),
+      UINT32_C(        82), UINT32_C(        23), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(       113), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(       214), UINT32_C(       238), UINT32_C(         0), UINT32_C(         0), UINT32_C(       178) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1ub_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  uint8_t a[1024 / sizeof(uint32_t)];
+  uint32_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1ub_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1ub_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 8449730727498844365),  INT64_C( 4543898178092263799),  INT64_C( 4292644834385522188),  INT64_C( 8806074693966734569),
+      -INT64_C( 1286840411977027347),  INT64_C( 1635788573522190114), -INT64_C( 7178054244151645845),  INT64_C( 4022524022820164369),
+      -INT64_C( 6109708453300645936), -INT64_C( 8361827569529543725),  INT64_C( 5569003565553405947), -INT64_C( 6528116277810629402),
+      -INT64_C(    1370900663617592), -INT64_C( 1769965313151132988),  INT64_C( 1957339831689617824),  INT64_C( 1174791102944497619),
+       INT64_C( 2311855529995025129),  INT64_C( 7154659340560167542), -INT64_C( 7934101474890489963), -INT64_C( 3778371784286851272),
+      -INT64_C( 4378355030460141376),  INT64_C( 5263987460717035751), -INT64_C( 1324067408426349488),  INT64_C( 2293455215571884071),
+      -INT64_C( 7927048200392035091), -INT64_C( 2038642358790446153), -INT64_C( 1785799571663632235), -INT64_C( 8077553782030883736),
+       INT64_C( 5742589356561473911), -INT64_C( 3791906407411094039),  INT64_C( 5395397990826791225),  INT64_C(  730418302787113202),
+      -INT64_C( 7349631936145724648),  INT64_C( 7406863572306213833),  INT64_C( 2374874947678888136),  INT64_C( 1634198628961814032),
+       INT64_C( 8939020408955852737),  INT64_C( 7211748012781675650), -INT64_C( 4290800471938010074), -INT64_C( 4675276281868769270),
+       INT64_C( 3394659329279976940),  INT64_C(  316646004350687076), -INT64_C( 9160095734906195353),  INT64_C( 5238432234738305269),
+      -INT64_C( 8545857209997138548), -INT64_C( 6882083828739258981), -INT64_C( 7541668302783982240),  INT64_C( 1191551214660804324),
+       INT64_C( 1283719911554248994), -INT64_C( 6355134021868299530),  INT64_C(  799058150500960988),  INT64_C(   19939498251821489),
+       INT64_C( 3949119490071433031),  INT64_C( 4278476132227242097),  INT64_C( 7201486366142291645),  INT64_C( 6507946731304991858),
+       INT64_C( 2370553317305063279),  INT64_C( 4239920781562825021), -INT64_C( 3086075822916857321),  INT64_C( 1420733556256523595),
+      -INT64_C( 1091375569309610484),  INT64_C(  335347668170355697),  INT64_C( 2247007954539497206), -INT64_C( 3137262055149710402),
+      -INT64_C( 3339584184815568637), -INT64_C( 8282429128318176484), -INT64_C( 7809218846620460116),  INT64_C( 6125860117913410919),
+       INT64_C( 1682291254178321062),  INT64_C( 3029567390353561574),  INT64_C( 7886729865350344970),  INT64_C( 8939822104461535593),
+      -INT64_C( 5456854432412918990), -INT64_C( 6946454337728977166), -INT64_C(  458818985845111762),  INT64_C( 1274172207499853403),
+      -INT64_C(  116666925353815585), -INT64_C(  207719945034886166), -INT64_C( 1453022689929093812),  INT64_C( 3171320623223638289),
+      -INT64_C( 5798318800632135299),  INT64_C( 5303917638323205838), -INT64_C( 5664126864191009302), -INT64_C( 3819716254820564605),
+      -INT64_C( 2208493269035001883), -INT64_C( 4821073904078452783), -INT64_C( 4883701653817573657),  INT64_C( 7220547282923215645),
+       INT64_C( 3770752464845703008), -INT64_C( 3062697414117567506),  INT64_C( 7948454569935943258), -INT64_C( 4228021997510534288),
+      -INT64_C( 5320003740039093868), -INT64_C( 6547680480442437793), -INT64_C( 8904313467814052179), -INT64_C( 1834434739886144159),
+      -INT64_C( 5933764848879025624), -INT64_C( 4384505928721227977),  INT64_C( 5057876520022990745), -INT64_C( 7733641070473665420),
+      -INT64_C( 3939474765654947496) };
+  static const uint8_t a[] =
+    { UINT8_C(104), UINT8_C(170), UINT8_C(185), UINT8_C(166), UINT8_C( 16), UINT8_C( 93), UINT8_C( 15), UINT8_C( 40),
+      UINT8_C(185), UINT8_C(189), UINT8_C(233), UINT8_C( 32), UINT8_C(242), UINT8_C( 34), UINT8_C( 82), UINT8_C( 35),
+      UINT8_C(250), UINT8_C(219), UINT8_C( 57), UINT8_C(101), UINT8_C( 38), UINT8_C(160), UINT8_C(119), UINT8_C(215),
+      UINT8_C( 34), UINT8_C( 43), UINT8_C(105), UINT8_C( 48), UINT8_C(173), UINT8_C( 71), UINT8_C(122), UINT8_C( 21),
+      UINT8_C(241), UINT8_C( 51), UINT8_C(187), UINT8_C(  1), UINT8_C(145), UINT8_C(202), UINT8_C( 41), UINT8_C( 74),
+      UINT8_C(135), UINT8_C( 19), UINT8_C(106), UINT8_C(121), UINT8_C( 53), UINT8_C(188), UINT8_C(157), UINT8_C( 47),
+      UINT8_C(151), UINT8_C(214), UINT8_C(148), UINT8_C(189), UINT8_C(118), UINT8_C( 11), UINT8_C(149), UINT8_C(153),
+      UINT8_C( 55), UINT8_C(254), UINT8_C(201), UINT8_C(228), UINT8_C( 69), UINT8_C( 67), UINT8_C(250), UINT8_C( 54),
+      UINT8_C(119), UINT8_C(181), UINT8_C( 55), UINT8_C(  8), UINT8_C(128), UINT8_C( 97), UINT8_C( 82), UINT8_C(  7),
+      UINT8_C(116), UINT8_C(188), UINT8_C(129), UINT8_C(169), UINT8_C(120), UINT8_C( 30), UINT8_C(216), UINT8_C( 16),
+      UINT8_C(244), UINT8_C(108), UINT8_C(205), UINT8_C(107), UINT8_C(119), UINT8_C( 98), UINT8_C(  4), UINT8_C(174),
+      UINT8_C( 96), UINT8_C(205), UINT8_C(147), UINT8_C(165), UINT8_C( 16), UINT8_C(141), UINT8_C(219), UINT8_C(135),
+      UINT8_C( 66), UINT8_C( 19), UINT8_C(143), UINT8_C(194), UINT8_C(116) };
+  static const uint64_t e[] =
+    { UINT64_C(                 104), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                  16), UINT64_C(                   0), UINT64_C(                  15), UINT64_C(                   0),
+      UINT64_C(                 185), UINT64_C(                 189), UINT64_C(                   0), UINT64_C(                  32),
+      UINT64_C(                 242), UINT64_C(                  34), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  57), UINT64_C(                 101),
+      UINT64_C(                  38), UINT64_C(                   0), UINT64_C(                 119), UINT64_C(                   0),
+      UINT64_C(                  34), UINT64_C(                  43), UINT64_C(                 105), UINT64_C(                  48),
+      UINT64_C(                   0), UINT64_C(                  71), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                 241), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  41), UINT64_C(                  74),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                 106), UINT64_C(                   0),
+      UINT64_C(                  53), UINT64_C(                 188), UINT64_C(                 157), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                 214), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                 201), UINT64_C(                   0),
+      UINT64_C(                  69), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                  54),
+      UINT64_C(                 119), UINT64_C(                 181), UINT64_C(                  55), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                 116), UINT64_C(                 188), UINT64_C(                 129), UINT64_C(                   0),
+      UINT64_C(                 120), UINT64_C(                  30), UINT64_C(                 216), UINT64_C(                   0),
+      UINT64_C(                 244), UINT64_C(                   0), UINT64_C(                 205), UINT64_C(                 107),
+      UINT64_C(                 119), UINT64_C(                  98), UINT64_C(                   4), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                 205), UINT64_C(                   0), UINT64_C(                 165),
+      UINT64_C(                  16), UINT64_C(                 141), UINT64_C(                 219), UINT64_C(                 135),
+      UINT64_C(                  66), UINT64_C(                  19), UINT64_C(                   0), UINT64_C(                 194),
+      UINT64_C(                 116) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1ub_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint8_t a[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1ub_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sh_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(  1084680866), -INT32_C(  1638516939),  INT32_C(  1979415712), -INT32_C(   977091473),  INT32_C(   712818064),  INT32_C(  1725225035),  INT32_C(  1522730255),  INT32_C(  1763238854),
+       INT32_C(    44679117), -INT32_C(  1751056394), -INT32_C(   368272261), -INT32_C(   256848288), -INT32_C(   702927733),  INT32_C(   322760196), -INT32_C(  1167261452), -INT32_C(  1323071773),
+       INT32_C(  1001638981),  INT32_C(  1188189387),  INT32_C(  1345445872),  INT32_C(   960553389),  INT32_C(   286219021),  INT32_C(  1025789001),  INT32_C(   804819532),  INT32_C(  1574968088),
+      -INT32_C(  1281846040), -INT32_C(   654677016), -INT32_C(   148362422),  INT32_C(   422602764),  INT32_C(   220872899), -INT32_C(   666218868), -INT32_C(   133741856),  INT32_C(  1180035166),
+       INT32_C(  1694101116), -INT32_C(  1556286631),  INT32_C(   714761246), -INT32_C(  1874605108), -INT32_C(  1751290613), -INT32_C(  1670387780), -INT32_C(  2003470806), -INT32_C(   623973794),
+       INT32_C(   826197976), -INT32_C(   640386373), -INT32_C(  1425772578),  INT32_C(  1161512762),  INT32_C(  1910298805), -INT32_C(   385004609),  INT32_C(   544318145),  INT32_C(  1710899085),
+      -INT32_C(  1030276857), -INT32_C(  1835308109),  INT32_C(   339582938), -INT32_C(  1671857945),  INT32_C(   252523856),  INT32_C(  1123621504),  INT32_C(  1247963837), -INT32_C(  1313907542),
+       INT32_C(  1232291477), -INT32_C(  1931800910), -INT32_C(  1784604498), -INT32_C(   533595504), -INT32_C(  1326498256),  INT32_C(   368240728), -INT32_C(    44084141),  INT32_C(  1185812401),
+       INT32_C(   126820693), -INT32_C(   577476049),  INT32_C(   309474690),  INT32_C(  1609737007),  INT32_C(   974185185),  INT32_C(   491717322),  INT32_C(   135966551),  INT32_C(   323930302),
+       INT32_C(   421256937), -INT32_C(   873025720),  INT32_C(   333277668), -INT32_C(   294399988),  INT32_C(  2083029938), -INT32_C(   593856635), -INT32_C(   454773722),  INT32_C(  1727542141),
+       INT32_C(  1501500177), -INT32_C(  1507559742), -INT32_C(   340196641), -INT32_C(  2066141998),  INT32_C(   889192879), -INT32_C(  1626236295), -INT32_C(   863701425),  INT32_C(   976387113),
+       INT32_C(  1368633999),  INT32_C(   133675048), -INT32_C(  1930252102), -INT32_C(  1945056035),  INT32_C(  1187057869), -INT32_C(    85535829), -INT32_C(   221877559),  INT32_C(  1965881574),
+      -INT32_C(   758726742),  INT32_C(   836353399),  INT32_C(  1253952621),  INT32_C(  1708641688), -INT32_C(  1985177378),  INT32_C(   881037931), -INT32_C(   500807172), -INT32_C(   329821631),
+      -INT32_C(  1984029422),  INT32_C(  1203476698), -INT32_C(    57509788),  INT32_C(   610363718),  INT32_C(  1840057601), -INT32_C(  1683935073), -INT32_C(  1166161799),  INT32_C(   749130778),
+      -INT32_C(   877238799),  INT32_C(  1628664317),  INT32_C(   794666473),  INT32_C(   257146382),  INT32_C(  1803288780), -INT32_C(  1459151312),  INT32_C(     6587622),  INT32_C(  1244465753),
+       INT32_C(  1813439343),  INT32_C(  1036855636), -INT32_C(   596825394), -INT32_C(  1242840855), -INT32_C(   249534271),  INT32_C(  1822107526),  INT32_C(    91029420),  INT32_C(  2035259657),
+      -INT32_C(   790272644),  INT32_C(  1544467342), -INT32_C(   969376803), -INT32_C(    59038661),  INT32_C(   317627532),  INT32_C(  1870563779), -INT32_C(  1854608760),  INT32_C(      705668),
+      -INT32_C(  1194201047), -INT32_C(  2146115677), -INT32_C(  1790489254), -INT32_C(    40713615),  INT32_C(   571441246), -INT32_C(  1852732151), -INT32_C(    81656201), -INT32_C(   201577014),
+      -INT32_C(  1062482659),  INT32_C(   104906924),  INT32_C(  2124121869), -INT32_C(  1468322486), -INT32_C(  1228240211), -INT32_C(  1907925993),  INT32_C(   747268706), -INT32_C(  1273002345),
+      -INT32_C(     9122989), -INT32_C(  1744456565), -INT32_C(  2045337540),  INT32_C(  2066649550),  INT32_C(   842201371), -INT32_C(  1212122795),  INT32_C(  2061716195),  INT32_C(   590217936),
+       INT32_C(  1478664909), -INT32_C(  1812977833), -INT32_C(  1776744760), -INT32_C(  1307490409), -INT32_C(  1780202688), -INT32_C(  1605589571), -INT32_C(  1071960081), -INT32_C(     1881806),
+       INT32_C(  1129842412), -INT32_C(   170506195), -INT32_C(   427036849),  INT32_C(  2006555958), -INT32_C(  1660125728),  INT32_C(   306075938), -INT32_C(  1160619640), -INT32_C(  1900366430),
+      -INT32_C(   372174149), -INT32_C(  1445025958), -INT32_C(   846173546), -INT32_C(   414963449), -INT32_C(   914009946),  INT32_C(   853263273), -INT32_C(  1091785444),  INT32_C(   508405346),
+       INT32_C(   319233720),  INT32_C(  1555883462),  INT32_C(  1445547087),  INT32_C(   473853301),  INT32_C(  1743111102), -INT32_C(  1566982010), -INT32_C(   815757715), -INT32_C(   437408468),
+      -INT32_C(  1829178164),  INT32_C(   703509722),  INT32_C(  1988106241),  INT32_C(  1133690501),  INT32_C(   128677761), -INT32_C(  1532410825), -INT32_C(   143390262), -INT32_C(  2082709065),
+       INT32_C(   806736982), -INT32_C(  1990655096) };
+  static const int16_t a[] =
+    { -INT16_C( 32215), -INT16_C( 17694),  INT16_C(  2748),  INT16_C(  1231), -INT16_C( 32217),  INT16_C(   870), -INT16_C( 28594), -INT16_C( 13111),
+      -INT16_C(  3150), -INT16_C( 14869),  INT16_C( 21676), -INT16_C( 26983), -INT16_C(  1514), -INT16_C( 11980),  INT16_C(   182), -INT16_C(  8446),
+      -INT16_C(  6782),  INT16_C( 16025),  INT16_C( 26863),  INT16_C(  5698), -INT16_C( 22037),  INT16_C( 14617), -INT16_C(  7623), -INT16_C(  5370),
+      -INT16_C(  3626), -INT16_C( 32080),  INT16_C( 18757),  INT16_C( 23320),  INT16_C( 19779), -INT16_C(  1748),  INT16_C( 11853), -INT16_C( 12071),
+       INT16_C( 29203),  INT16_C(   526),  INT16_C( 20955), -INT16_C( 14824),  INT16_C( 13050),  INT16_C( 13311),  INT16_C(  1300), -INT16_C(  5602),
+      -INT16_C( 12554),  INT16_C( 15212), -INT16_C( 31465),  INT16_C( 23190), -INT16_C( 15662),  INT16_C(  8019),  INT16_C( 11505),  INT16_C(  1263),
+      -INT16_C(   353),  INT16_C( 31239),  INT16_C(  8015),  INT16_C( 18752),  INT16_C( 16209),  INT16_C( 26236), -INT16_C( 26043),  INT16_C( 15184),
+      -INT16_C( 17048),  INT16_C( 32631),  INT16_C(  3394),  INT16_C(  5337),  INT16_C( 11472), -INT16_C( 16077),  INT16_C(  9049), -INT16_C(  1851),
+      -INT16_C( 13279),  INT16_C( 28786), -INT16_C( 19732),  INT16_C( 15801),  INT16_C( 13809),  INT16_C( 13987), -INT16_C(  2865),  INT16_C( 14194),
+      -INT16_C(  5711), -INT16_C(  3146), -INT16_C( 28682), -INT16_C( 14841),  INT16_C( 15035),  INT16_C(  5255),  INT16_C( 19805),  INT16_C( 32268),
+       INT16_C( 32281),  INT16_C(  1518), -INT16_C( 22736),  INT16_C(  8771), -INT16_C(  6436), -INT16_C( 21672), -INT16_C( 13606), -INT16_C( 29726),
+      -INT16_C( 26445), -INT16_C( 21890), -INT16_C( 31449), -INT16_C(  7312), -INT16_C(  1856),  INT16_C(  7671),  INT16_C(  1093),  INT16_C( 24220),
+      -INT16_C( 30078), -INT16_C( 19612), -INT16_C( 22734),  INT16_C(  3797),  INT16_C( 11661),  INT16_C( 26810), -INT16_C( 25352), -INT16_C( 21517),
+       INT16_C( 29237),  INT16_C( 23637), -INT16_C( 14601), -INT16_C( 18625),  INT16_C( 14270),  INT16_C(   981),  INT16_C( 28987), -INT16_C( 17055),
+      -INT16_C( 14853),  INT16_C( 11632),  INT16_C( 17772), -INT16_C(  1476), -INT16_C(  2445),  INT16_C( 27490),  INT16_C( 21906), -INT16_C( 14570),
+       INT16_C( 27847), -INT16_C( 16604),  INT16_C( 25394), -INT16_C(  3978),  INT16_C( 19354), -INT16_C( 10765),  INT16_C( 21692), -INT16_C( 18285),
+       INT16_C(   794), -INT16_C( 31003),  INT16_C(  8521), -INT16_C( 17280), -INT16_C(  7657), -INT16_C( 21977),  INT16_C( 15672), -INT16_C(   143),
+      -INT16_C( 27223), -INT16_C(  9282),  INT16_C( 13817), -INT16_C( 27701), -INT16_C( 16768),  INT16_C( 15721), -INT16_C(  1005),  INT16_C( 11765),
+      -INT16_C(  9473),  INT16_C( 18611),  INT16_C( 13564),  INT16_C(  4868),  INT16_C( 11030),  INT16_C( 20157),  INT16_C( 12137),  INT16_C(  4686),
+       INT16_C(  3268), -INT16_C( 16914), -INT16_C( 18111), -INT16_C( 15791), -INT16_C( 17800), -INT16_C( 29697), -INT16_C(  2890), -INT16_C( 19016),
+       INT16_C( 27598), -INT16_C( 13570),  INT16_C(   671), -INT16_C( 18722), -INT16_C( 25810), -INT16_C( 26876),  INT16_C( 21194), -INT16_C( 28759),
+      -INT16_C( 26785), -INT16_C( 24500), -INT16_C( 25263), -INT16_C( 13982),  INT16_C( 24919),  INT16_C(  3412),  INT16_C(  3157),  INT16_C(  9411),
+      -INT16_C( 16009),  INT16_C(  6126), -INT16_C( 13117), -INT16_C(  3635), -INT16_C( 11928),  INT16_C( 12936),  INT16_C( 12836), -INT16_C( 31807),
+       INT16_C(  3785),  INT16_C(  6691), -INT16_C( 31061),  INT16_C(   995),  INT16_C( 14311),  INT16_C( 15632), -INT16_C( 11453), -INT16_C( 17567),
+       INT16_C( 20372),  INT16_C( 22738), -INT16_C( 24804), -INT16_C( 31671), -INT16_C( 11664), -INT16_C( 27466),  INT16_C( 30724), -INT16_C( 13033),
+       INT16_C( 15238),  INT16_C( 12776) };
+  static const int32_t e[] =
+    {  INT32_C(           0), -INT32_C(       17694),  INT32_C(           0),  INT32_C(        1231),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(       14869),  INT32_C(       21676), -INT32_C(       26983), -INT32_C(        1514),  INT32_C(           0),  INT32_C(         182), -INT32_C(        8446),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(        3626), -INT32_C(       32080),  INT32_C(       18757),  INT32_C(           0),  INT32_C(           0), -INT32_C(        1748),  INT32_C(       11853),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(         526),  INT32_C(           0), -INT32_C(       14824),  INT32_C(       13050),  INT32_C(       13311),  INT32_C(        1300), -INT32_C(        5602),
+       INT32_C(           0),  INT32_C(       15212), -INT32_C(       31465),  INT32_C(           0),  INT32_C(           0),  INT32_C(        8019),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(         353),  INT32_C(       31239),  INT32_C(           0),  INT32_C(       18752),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       15184),
+       INT32_C(           0),  INT32_C(       32631),  INT32_C(        3394),  INT32_C(        5337),  INT32_C(       11472),  INT32_C(           0),  INT32_C(        9049),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(       28786),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(        3146),  INT32_C(           0), -INT32_C(       14841),  INT32_C(           0),  INT32_C(        5255),  INT32_C(       19805),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(        1518), -INT32_C(       22736),  INT32_C(        8771),  INT32_C(           0), -INT32_C(       21672), -INT32_C(       13606),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(       31449), -INT32_C(        7312),  INT32_C(           0),  INT32_C(        7671),  INT32_C(        1093),  INT32_C(           0),
+      -INT32_C(       30078),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       11661),  INT32_C(           0), -INT32_C(       25352), -INT32_C(       21517),
+       INT32_C(       29237),  INT32_C(           0), -INT32_C(       14601),  INT32_C(           0),  INT32_C(           0),  INT32_C(         981),  INT32_C(       28987),  INT32_C(           0),
+      -INT32_C(       14853),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       27490),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(       25394), -INT32_C(        3978),  INT32_C(       19354),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(         794),  INT32_C(           0),  INT32_C(        8521), -INT32_C(       17280),  INT32_C(           0),  INT32_C(           0),  INT32_C(       15672),  INT32_C(           0),
+      -INT32_C(       27223), -INT32_C(        9282),  INT32_C(       13817), -INT32_C(       27701),  INT32_C(           0),  INT32_C(       15721), -INT32_C(        1005),  INT32_C(       11765),
+      -INT32_C(        9473),  INT32_C(           0),  INT32_C(           0),  INT32_C(        4868),  INT32_C(       11030),  INT32_C(       20157),  INT32_C(           0),  INT32_C(        4686),
+       INT32_C(        3268), -INT32_C(       16914), -INT32_C(       18111),  INT32_C(           0),  INT32_C(           0), -INT32_C(       29697),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(       13570),  INT32_C(         671), -INT32_C(       18722), -INT32_C(       25810), -INT32_C(       26876),  INT32_C(       21194), -INT32_C(       28759),
+       INT32_C(           0), -INT32_C(       24500), -INT32_C(       25263),  INT32_C(           0),  INT32_C(       24919),  INT32_C(           0),  INT32_C(        3157),  INT32_C(        9411),
+      -INT32_C(       16009),  INT32_C(        6126), -INT32_C(       13117), -INT32_C(        3635), -INT32_C(       11928),  INT32_C(           0),  INT32_C(       12836),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       15632), -INT32_C(       11453), -INT32_C(       17567),
+       INT32_C(       20372),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(       27466),  INT32_C(       30724), -INT32_C(       13033),
+       INT32_C(           0),  INT32_C(       12776) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1sh_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  int16_t a[1024 / sizeof(int32_t)];
+  int32_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1sh_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sh_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(  589121507877116017),  INT64_C( 4250431030253678514),  INT64_C( 4151001412357422748),  INT64_C( 6953649983722439171),
+      -INT64_C( 6228946712719593094),  INT64_C( 5440131399342235589), -INT64_C( 8521781889836436296), -INT64_C( 5332124259454162481),
+      -INT64_C( 7129237962645208466),  INT64_C( 4608698128493858298),  INT64_C( 4730326012196480662), -INT64_C( 8261323415913127321),
+       INT64_C( 9068282083078809444), -INT64_C( 5470436353115767729), -INT64_C( 4848840413901957375), -INT64_C( 2466642765637773545),
+       INT64_C(  603468854778836832), -INT64_C( 6664496622285715793), -INT64_C( 2315469473494641973),  INT64_C( 6177490588386344035),
+       INT64_C( 8598101520803222673), -INT64_C( 1269234288129986531), -INT64_C( 6214707700898498279),  INT64_C( 4716183260445922856),
+       INT64_C( 6940853259247266579),  INT64_C( 8511664058009622029),  INT64_C( 4893467871630798586), -INT64_C( 4476344183159689490),
+       INT64_C( 6207066712028507008), -INT64_C( 4658789350458834043), -INT64_C( 5461765981925822507), -INT64_C( 1673593689679358890),
+      -INT64_C( 3008739550350843234),  INT64_C( 4797759037678077202), -INT64_C( 3226154597572504385),  INT64_C( 6794416437442612729),
+      -INT64_C( 3015295446789196544), -INT64_C( 5838843319556382903), -INT64_C( 8636094773092734249), -INT64_C( 7270723379464110342),
+       INT64_C( 3225725102774312745), -INT64_C( 8462304708682157582),  INT64_C( 3106080974687879940),  INT64_C( 7005910214488950018),
+       INT64_C( 3201236046743283293),  INT64_C( 3369428275864358788), -INT64_C( 6360246349857644448), -INT64_C(  181130663179214366),
+       INT64_C( 7064646839672097700),  INT64_C( 1464334757626779642), -INT64_C( 3150442819128847108), -INT64_C( 5792073273534608383),
+      -INT64_C( 9189428437489689801),  INT64_C( 7672152919204172463),  INT64_C( 9210233414019128587),  INT64_C( 7249034179640345055),
+       INT64_C( 7899300269328574361),  INT64_C( 5034541948863595269),  INT64_C( 1973160738973477222), -INT64_C( 2709304128084540716),
+      -INT64_C( 2742241564343803707),  INT64_C( 8168169675785355996), -INT64_C( 8832482796978725611), -INT64_C( 3074571994851217094),
+      -INT64_C( 4361090930450018611),  INT64_C(  543306018966914829), -INT64_C( 3456015088285589549),  INT64_C( 5411813262621380661),
+      -INT64_C( 3848212916080970771),  INT64_C( 8802124561280889389),  INT64_C( 8769361991379615564), -INT64_C( 8403197260493554024),
+      -INT64_C( 2246179440799298229),  INT64_C( 8037559892040463977),  INT64_C( 3054291100841970342),  INT64_C( 5056313104455967235),
+      -INT64_C( 1404803664315446290),  INT64_C( 5578984293490590169), -INT64_C( 4120903869444669934), -INT64_C( 6918212160587427907),
+       INT64_C( 5227485577162607645),  INT64_C( 2537971981031344195), -INT64_C( 3965534872540778386),  INT64_C( 1006411512954183334),
+       INT64_C( 4503662274714286281), -INT64_C( 1948544105119627840), -INT64_C(  386169009926193711),  INT64_C( 7667459322968941675),
+       INT64_C(  988860404583306369),  INT64_C( 1532019113862292200), -INT64_C( 3467887827970009200), -INT64_C(  304394870587772486),
+       INT64_C( 8430791884375746983),  INT64_C( 4858281953731010322), -INT64_C( 5791621472247652756),  INT64_C(  336873172966755127),
+       INT64_C( 7294697060160774969), -INT64_C( 8084761622943625513),  INT64_C( 3614422355543127174),  INT64_C( 4480677026837312716),
+      -INT64_C(  690107244712024397), -INT64_C( 2954557822651586483),  INT64_C( 3273970012163956801), -INT64_C( 7498347266087431250),
+      -INT64_C( 9169600198272486230), -INT64_C( 3650184486694404303), -INT64_C( 3396143879084660656),  INT64_C( 7153532299475301580),
+       INT64_C( 2241644645290140775),  INT64_C( 5513805608087718954), -INT64_C( 3201255558724350304), -INT64_C( 1212372614647770097) };
+  static const int16_t a[] =
+    {  INT16_C( 20295), -INT16_C( 32295), -INT16_C( 12494), -INT16_C( 31295), -INT16_C( 18507), -INT16_C( 30559), -INT16_C( 10680), -INT16_C( 26378),
+      -INT16_C(  2748), -INT16_C(  4646), -INT16_C( 10027), -INT16_C( 14210),  INT16_C( 30389), -INT16_C( 24623),  INT16_C( 20102), -INT16_C( 12951),
+       INT16_C( 17053), -INT16_C( 12210),  INT16_C(  4113), -INT16_C( 14507), -INT16_C(  2105),  INT16_C(  4175),  INT16_C( 17869),  INT16_C(  4520),
+      -INT16_C( 32198),  INT16_C(  4094),  INT16_C( 31834),  INT16_C(  4055), -INT16_C( 22285),  INT16_C( 31151),  INT16_C(  6390), -INT16_C( 27834),
+      -INT16_C( 27301),  INT16_C( 27747), -INT16_C( 18011),  INT16_C( 27699), -INT16_C( 32080),  INT16_C( 32124),  INT16_C(  9415),  INT16_C(   398),
+      -INT16_C( 29529),  INT16_C(   272), -INT16_C(  6391), -INT16_C(  1007), -INT16_C( 16241), -INT16_C( 31371), -INT16_C( 17448),  INT16_C( 13081),
+       INT16_C( 31824), -INT16_C(  2656), -INT16_C( 11467), -INT16_C(  6814), -INT16_C(  8618),  INT16_C(  7522), -INT16_C(  4093), -INT16_C( 21985),
+       INT16_C( 12157), -INT16_C( 31061), -INT16_C( 17385), -INT16_C( 22910), -INT16_C(  2180),  INT16_C( 21804),  INT16_C( 17842),  INT16_C(   904),
+       INT16_C( 10433), -INT16_C(  2056),  INT16_C( 23292),  INT16_C( 21212),  INT16_C( 16185),  INT16_C( 15471), -INT16_C( 29137), -INT16_C( 21274),
+      -INT16_C( 28226), -INT16_C( 10958), -INT16_C( 19378), -INT16_C( 13701), -INT16_C( 22613),  INT16_C( 24095), -INT16_C( 22292), -INT16_C( 20895),
+       INT16_C( 22992), -INT16_C( 13147), -INT16_C( 32332), -INT16_C(  4834), -INT16_C( 28992), -INT16_C(  4055),  INT16_C(  3868), -INT16_C(  9572),
+      -INT16_C( 12384), -INT16_C(  4433),  INT16_C( 11139),  INT16_C( 12217), -INT16_C( 10030), -INT16_C( 16499), -INT16_C(  4480),  INT16_C( 20845),
+       INT16_C(  4679), -INT16_C(  1251),  INT16_C( 15507),  INT16_C( 21736),  INT16_C(  4554), -INT16_C(  6588), -INT16_C(  8160), -INT16_C( 15935),
+       INT16_C( 28847),  INT16_C( 13231),  INT16_C( 26779),  INT16_C( 28258), -INT16_C(  4287), -INT16_C( 16083), -INT16_C( 25891),  INT16_C(  9234) };
+  static const int64_t e[] =
+    {  INT64_C(               20295),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(               18507),  INT64_C(                   0), -INT64_C(               10680), -INT64_C(               26378),
+      -INT64_C(                2748),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(               14210),
+       INT64_C(                   0), -INT64_C(               24623),  INT64_C(               20102), -INT64_C(               12951),
+       INT64_C(                   0), -INT64_C(               12210),  INT64_C(                4113),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                4175),  INT64_C(               17869),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                4055),
+       INT64_C(                   0),  INT64_C(               31151),  INT64_C(                6390), -INT64_C(               27834),
+      -INT64_C(               27301),  INT64_C(                   0), -INT64_C(               18011),  INT64_C(                   0),
+      -INT64_C(               32080),  INT64_C(               32124),  INT64_C(                9415),  INT64_C(                 398),
+       INT64_C(                   0),  INT64_C(                 272),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(               17448),  INT64_C(               13081),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(               11467), -INT64_C(                6814),
+      -INT64_C(                8618),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(               22910),
+      -INT64_C(                2180),  INT64_C(                   0),  INT64_C(               17842),  INT64_C(                 904),
+       INT64_C(               10433),  INT64_C(                   0),  INT64_C(               23292),  INT64_C(                   0),
+       INT64_C(               16185),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(               21274),
+      -INT64_C(               28226),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(               22613),  INT64_C(                   0), -INT64_C(               22292), -INT64_C(               20895),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(               32332),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                4055),  INT64_C(                3868),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(               11139),  INT64_C(               12217),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                4480),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                1251),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                4554), -INT64_C(                6588),  INT64_C(                   0), -INT64_C(               15935),
+       INT64_C(               28847),  INT64_C(               13231),  INT64_C(               26779),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(               25891),  INT64_C(                9234) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1sh_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int16_t a[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1sh_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sh_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(   804953365),  INT32_C(   761927541),  INT32_C(  1117021684),  INT32_C(   606875408),  INT32_C(   393773867),  INT32_C(   652185096),  INT32_C(   267504823), -INT32_C(   271254567),
+       INT32_C(   220122776), -INT32_C(   633698075), -INT32_C(    31666194),  INT32_C(   690112766), -INT32_C(   733963316), -INT32_C(   520478679), -INT32_C(   957289492),  INT32_C(  2142618854),
+       INT32_C(  2022495122),  INT32_C(  1246938972), -INT32_C(  1807192426), -INT32_C(  2084738121),  INT32_C(   794295814),  INT32_C(   168841502),  INT32_C(   600834109),  INT32_C(  1453491652),
+      -INT32_C(  1244778663), -INT32_C(  1929436938),  INT32_C(  1176520591), -INT32_C(  1194730062), -INT32_C(   102227749), -INT32_C(  1375405967), -INT32_C(  1127033608), -INT32_C(  1290636198),
+      -INT32_C(  1721179741), -INT32_C(  1876596991),  INT32_C(  1641432494), -INT32_C(    31875293),  INT32_C(   838336959), -INT32_C(   236978951),  INT32_C(   716026320), -INT32_C(   908214234),
+      -INT32_C(  1570552415),  INT32_C(  1530103980), -INT32_C(   239334962),  INT32_C(  1760548265), -INT32_C(   795220009), -INT32_C(  1262323229),  INT32_C(  1356754730), -INT32_C(   803554257),
+      -INT32_C(  1368163071), -INT32_C(   754342395),  INT32_C(  1489290671),  INT32_C(  1908520090),  INT32_C(  2135055003), -INT32_C(    30210861), -INT32_C(  1555164813), -INT32_C(   814520115),
+      -INT32_C(   344070427),  INT32_C(  1019119244), -INT32_C(   443251893), -INT32_C(   766028489), -INT32_C(  2091804240),  INT32_C(   276923549),  INT32_C(  1672728726),  INT32_C(   506603320),
+      -INT32_C(  1710641395), -INT32_C(  2133407947), -INT32_C(  2123994550),  INT32_C(  1884601792), -INT32_C(   202136234), -INT32_C(  1073515222),  INT32_C(  2099492677), -INT32_C(   342141218),
+       INT32_C(   998614021), -INT32_C(  1229235348), -INT32_C(  2043141690),  INT32_C(   888573150),  INT32_C(  1529342257), -INT32_C(  1558500514), -INT32_C(  1071562782), -INT32_C(  1700021099),
+      -INT32_C(   841666207),  INT32_C(  1384354188), -INT32_C(  1848067150),  INT32_C(  2043006535),  INT32_C(   383053240), -INT32_C(    88412136), -INT32_C(   994387153), -INT32_C(   128031337),
+       INT32_C(   600126614),  INT32_C(  2004175301),  INT32_C(  1275612676), -INT32_C(   725234148), -INT32_C(   739534405), -INT32_C(  1194482295),  INT32_C(   394037120), -INT32_C(  2096047124),
+      -INT32_C(   727263985),  INT32_C(   592124702), -INT32_C(  2039524247), -INT32_C(   581290974),  INT32_C(  1471169997),  INT32_C(  1779400170), -INT32_C(   259879932),  INT32_C(  1987285607),
+      -INT32_C(  2041964185), -INT32_C(  1633053387),  INT32_C(   186915049),  INT32_C(   434667340), -INT32_C(  1351575356),  INT32_C(   421101589),  INT32_C(  1930074892), -INT32_C(  1779860179),
+      -INT32_C(   870632553), -INT32_C(  1301625656),  INT32_C(   683511772), -INT32_C(   767449586),  INT32_C(  1417785918),  INT32_C(  1047370546),  INT32_C(  1689351990), -INT32_C(  1929798923),
+      -INT32_C(  1789389619), -INT32_C(  1270365480),  INT32_C(  1608254801), -INT32_C(   382591573),  INT32_C(    20820943), -INT32_C(  2059424946),  INT32_C(   401207330),  INT32_C(  1470358154),
+      -INT32_C(   823264266),  INT32_C(   260191422), -INT32_C(   462463431),  INT32_C(  1271832955), -INT32_C(  1555297452), -INT32_C(   651653962),  INT32_C(   133173628), -INT32_C(   379677453),
+       INT32_C(  1303858063), -INT32_C(  1185072768),  INT32_C(   312396951), -INT32_C(  1050842003),  INT32_C(   778349175), -INT32_C(  1308128202), -INT32_C(  1866860643),  INT32_C(   460920971),
+      -INT32_C(   479711133),  INT32_C(    10339689), -INT32_C(    32293999),  INT32_C(   515928231),  INT32_C(  1347167258),  INT32_C(  1308840881), -INT32_C(   689980341),  INT32_C(   955341012),
+      -INT32_C(   233088375), -INT32_C(  1309427681), -INT32_C(  1699805453), -INT32_C(  1850118282),  INT32_C(  1172374932), -INT32_C(  1533811623),  INT32_C(  1970959009),  INT32_C(  1420651723),
+      -INT32_C(   448345658),  INT32_C(  1972779393), -INT32_C(  1240512961),  INT32_C(  1229441205),  INT32_C(   663627982), -INT32_C(  1362419187),  INT32_C(  1596147092),  INT32_C(  2008273329),
+       INT32_C(   459143834),  INT32_C(  1938879283), -INT32_C(   282484679),  INT32_C(   909668456), -INT32_C(  1520580712),  INT32_C(  2102601961),  INT32_C(   534607726), -INT32_C(   493383608),
+      -INT32_C(  1090653046),  INT32_C(   556895975), -INT32_C(  1777313234),  INT32_C(  1657620682), -INT32_C(   133682673), -INT32_C(  1049207981),  INT32_C(   450909138),  INT32_C(  1862039523),
+       INT32_C(  1395456619), -INT32_C(  1233887864), -INT32_C(  2125691721), -INT32_C(   589096500), -INT32_C(  1747653820),  INT32_C(   425216583), -INT32_C(  2127284067),  INT32_C(   468660400),
+      -INT32_C(  1301406934),  INT32_C(   795402872),  INT32_C(   867218790),  INT32_C(   303010766), -INT32_C(   961944705), -INT32_C(   874577618), -INT32_C(   364113094),  INT32_C(  1845836612),
+      -INT32_C(   836668330), -INT32_C(  1107457706),  INT32_C(   233876798), -INT32_C(  1071644863),  INT32_C(   277268962),  INT32_C(    81552842), -INT32_C(  1108465543), -INT32_C(  1171524508),
+      -INT32_C(  1098298264),  INT32_C(   343639766),  INT32_C(  1965124404),  INT32_C(  1295335786), -INT32_C(   732054774), -INT32_C(  1713817312), -INT32_C(   967391390),  INT32_C(   595624635) };
+  static const int16_t a[] =
+    {  INT16_C( 27744), -INT16_C( 25232), -INT16_C( 16772), -INT16_C(   616),  INT16_C(  3468), -INT16_C( 14529), -INT16_C( 28212), -INT16_C( 12140),
+       INT16_C( 12305),  INT16_C( 18875),  INT16_C(  4143),  INT16_C( 12418),  INT16_C( 16634),  INT16_C(  4207), -INT16_C(  4965), -INT16_C(  1103),
+       INT16_C(  8536), -INT16_C( 11112),  INT16_C( 12512),  INT16_C( 27857),  INT16_C(  4157),  INT16_C(  2356), -INT16_C( 14175), -INT16_C( 19495),
+      -INT16_C( 27400),  INT16_C( 10236),  INT16_C( 32677), -INT16_C( 24744), -INT16_C( 14401),  INT16_C( 23216),  INT16_C( 25011),  INT16_C(  2901),
+      -INT16_C(  4733),  INT16_C( 25567), -INT16_C( 20195),  INT16_C( 23247),  INT16_C(   961),  INT16_C( 25443),  INT16_C( 15563), -INT16_C( 15338),
+       INT16_C(  4817),  INT16_C( 30443),  INT16_C( 17297),  INT16_C( 20501), -INT16_C( 15094), -INT16_C( 16982), -INT16_C(   217), -INT16_C( 21816),
+      -INT16_C( 22292),  INT16_C(  2317), -INT16_C(  9127),  INT16_C(  6755), -INT16_C( 14624), -INT16_C( 21635), -INT16_C( 27901), -INT16_C( 11153),
+       INT16_C( 23462),  INT16_C( 14154),  INT16_C( 24478), -INT16_C( 22136),  INT16_C( 12837),  INT16_C( 19558),  INT16_C( 12082),  INT16_C(  7926),
+       INT16_C(   983),  INT16_C( 12328), -INT16_C( 29729), -INT16_C( 16566), -INT16_C( 14254),  INT16_C( 21867), -INT16_C(  9637),  INT16_C(   297),
+       INT16_C( 29493), -INT16_C( 11207), -INT16_C( 15918), -INT16_C(  2179), -INT16_C(  7181),  INT16_C(  9539),  INT16_C( 14610), -INT16_C(  5820),
+       INT16_C( 27708),  INT16_C(  7193),  INT16_C( 25847),  INT16_C( 18907),  INT16_C( 17964), -INT16_C( 30818), -INT16_C( 14559),  INT16_C( 22153),
+      -INT16_C( 15814),  INT16_C(  3370), -INT16_C( 22653),  INT16_C( 30212),  INT16_C( 18571), -INT16_C( 25188), -INT16_C(  8063), -INT16_C( 16761),
+      -INT16_C( 24500),  INT16_C( 17370), -INT16_C( 19196),  INT16_C( 12429),  INT16_C( 11260),  INT16_C(  7608),  INT16_C( 16883),  INT16_C( 11635),
+      -INT16_C( 25085), -INT16_C( 31174),  INT16_C( 16197), -INT16_C( 12036), -INT16_C( 26489),  INT16_C(  2158), -INT16_C(  2696), -INT16_C( 15162),
+      -INT16_C( 24427), -INT16_C( 26104), -INT16_C( 27306),  INT16_C( 21194), -INT16_C( 32064), -INT16_C( 19601), -INT16_C(  7485), -INT16_C( 14623),
+       INT16_C(  7040), -INT16_C( 14772),  INT16_C( 18778), -INT16_C(  7786),  INT16_C(  1249),  INT16_C( 23274), -INT16_C( 20231), -INT16_C( 28898),
+       INT16_C(  9809), -INT16_C( 22743), -INT16_C(  3141),  INT16_C( 31993),  INT16_C( 26742),  INT16_C( 14639),  INT16_C(  4170), -INT16_C( 13568),
+       INT16_C( 19500), -INT16_C( 31087),  INT16_C( 10133),  INT16_C( 30568),  INT16_C( 21036),  INT16_C(  9681), -INT16_C(  4350),  INT16_C( 21428),
+      -INT16_C(  8938), -INT16_C( 11782), -INT16_C(  3119),  INT16_C( 18253),  INT16_C( 32091), -INT16_C( 22912), -INT16_C( 32627), -INT16_C( 18063),
+       INT16_C(   717),  INT16_C( 25152), -INT16_C( 22487),  INT16_C( 21977), -INT16_C( 21766), -INT16_C(   901),  INT16_C( 12186), -INT16_C( 20400),
+       INT16_C( 18957), -INT16_C(  8575), -INT16_C( 12482), -INT16_C( 26331), -INT16_C( 23220), -INT16_C(  9921), -INT16_C( 20442), -INT16_C(  3181),
+      -INT16_C( 11342), -INT16_C(  9131),  INT16_C( 12155),  INT16_C( 30001), -INT16_C( 21287),  INT16_C( 29553), -INT16_C( 15908), -INT16_C(  5853),
+      -INT16_C( 23284),  INT16_C( 19143), -INT16_C(  5004), -INT16_C( 16157),  INT16_C(  9105), -INT16_C( 18535),  INT16_C( 11475), -INT16_C( 31062),
+       INT16_C(   255),  INT16_C( 31330), -INT16_C( 27857),  INT16_C(  2287),  INT16_C( 24896),  INT16_C(  7292), -INT16_C( 24798),  INT16_C( 11781),
+      -INT16_C( 13244), -INT16_C( 18312),  INT16_C( 23736),  INT16_C( 18808),  INT16_C(  4735),  INT16_C( 20993), -INT16_C( 21698),  INT16_C( 16088),
+       INT16_C( 15019), -INT16_C(  9544), -INT16_C( 22322),  INT16_C(  3811),  INT16_C( 24329),  INT16_C( 11050),  INT16_C( 12286),  INT16_C( 17242),
+      -INT16_C( 11525), -INT16_C( 19461),  INT16_C( 29742), -INT16_C( 20996), -INT16_C(   634), -INT16_C( 15360), -INT16_C( 10071),  INT16_C( 21506) };
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294955156),
+      UINT32_C(         0), UINT32_C(     18875), UINT32_C(      4143), UINT32_C(         0), UINT32_C(     16634), UINT32_C(      4207), UINT32_C(4294962331), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(     12512), UINT32_C(     27857), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(4294939896), UINT32_C(     10236), UINT32_C(         0), UINT32_C(4294942552), UINT32_C(4294952895), UINT32_C(     23216), UINT32_C(     25011), UINT32_C(      2901),
+      UINT32_C(4294962563), UINT32_C(     25567), UINT32_C(         0), UINT32_C(     23247), UINT32_C(         0), UINT32_C(     25443), UINT32_C(         0), UINT32_C(4294951958),
+      UINT32_C(      4817), UINT32_C(         0), UINT32_C(     17297), UINT32_C(         0), UINT32_C(4294952202), UINT32_C(4294950314), UINT32_C(         0), UINT32_C(4294945480),
+      UINT32_C(4294945004), UINT32_C(      2317), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294945661), UINT32_C(4294939395), UINT32_C(4294956143),
+      UINT32_C(     23462), UINT32_C(         0), UINT32_C(     24478), UINT32_C(4294945160), UINT32_C(     12837), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(       983), UINT32_C(     12328), UINT32_C(4294937567), UINT32_C(         0), UINT32_C(4294953042), UINT32_C(     21867), UINT32_C(         0), UINT32_C(       297),
+      UINT32_C(         0), UINT32_C(4294956089), UINT32_C(4294951378), UINT32_C(         0), UINT32_C(         0), UINT32_C(      9539), UINT32_C(     14610), UINT32_C(4294961476),
+      UINT32_C(     27708), UINT32_C(         0), UINT32_C(     25847), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294936478), UINT32_C(4294952737), UINT32_C(     22153),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(     30212), UINT32_C(     18571), UINT32_C(4294942108), UINT32_C(         0), UINT32_C(4294950535),
+      UINT32_C(4294942796), UINT32_C(         0), UINT32_C(4294948100), UINT32_C(     12429), UINT32_C(         0), UINT32_C(         0), UINT32_C(     16883), UINT32_C(         0),
+      UINT32_C(4294942211), UINT32_C(4294936122), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294940807), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294952134),
+      UINT32_C(4294942869), UINT32_C(4294941192), UINT32_C(         0), UINT32_C(     21194), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294952673),
+      UINT32_C(      7040), UINT32_C(4294952524), UINT32_C(         0), UINT32_C(4294959510), UINT32_C(         0), UINT32_C(     23274), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(      9809), UINT32_C(         0), UINT32_C(4294964155), UINT32_C(         0), UINT32_C(     26742), UINT32_C(     14639), UINT32_C(         0), UINT32_C(4294953728),
+      UINT32_C(         0), UINT32_C(4294936209), UINT32_C(         0), UINT32_C(     30568), UINT32_C(         0), UINT32_C(      9681), UINT32_C(4294962946), UINT32_C(         0),
+      UINT32_C(4294958358), UINT32_C(         0), UINT32_C(4294964177), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294934669), UINT32_C(         0),
+      UINT32_C(       717), UINT32_C(     25152), UINT32_C(4294944809), UINT32_C(     21977), UINT32_C(         0), UINT32_C(4294966395), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(     18957), UINT32_C(         0), UINT32_C(4294954814), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294957375), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(     12155), UINT32_C(         0), UINT32_C(4294946009), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294961443),
+      UINT32_C(4294944012), UINT32_C(         0), UINT32_C(4294962292), UINT32_C(         0), UINT32_C(      9105), UINT32_C(4294948761), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(     31330), UINT32_C(4294939439), UINT32_C(      2287), UINT32_C(     24896), UINT32_C(         0), UINT32_C(4294942498), UINT32_C(         0),
+      UINT32_C(4294954052), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(      4735), UINT32_C(     20993), UINT32_C(4294945598), UINT32_C(         0),
+      UINT32_C(     15019), UINT32_C(4294957752), UINT32_C(         0), UINT32_C(      3811), UINT32_C(         0), UINT32_C(         0), UINT32_C(     12286), UINT32_C(     17242),
+      UINT32_C(4294955771), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4294966662), UINT32_C(4294951936), UINT32_C(4294957225), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1sh_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  int16_t a[1024 / sizeof(uint32_t)];
+  uint32_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1sh_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sh_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 1123819607877637166),  INT64_C( 4764275131701662970), -INT64_C( 2806744501228705825), -INT64_C( 5862986878631663131),
+       INT64_C( 7122985319990152656),  INT64_C( 2324409646025484033), -INT64_C( 7856985108046857123), -INT64_C( 6505303615486142326),
+      -INT64_C(  352325329623249583),  INT64_C( 5175264801013298288),  INT64_C( 1420422273254565751),  INT64_C( 7938954561650006194),
+       INT64_C( 6185488362953546722), -INT64_C( 8833009068705066440), -INT64_C( 2622116251028566527),  INT64_C( 8106917545105340919),
+       INT64_C( 2766095200996337962),  INT64_C( 5010451690143967990), -INT64_C( 8681132962624949887), -INT64_C( 6835588508978255836),
+      -INT64_C( 8441413022145089338),  INT64_C( 6342782236823987069),  INT64_C( 7232649338663654727), -INT64_C( 2483388745653945743),
+      -INT64_C( 3906473230833993557), -INT64_C( 5423018481538148721), -INT64_C( 5113015729661362074),  INT64_C(  637868880401867494),
+       INT64_C( 7311331034292251491), -INT64_C(  466253867914689946), -INT64_C( 1996596573955484856),  INT64_C( 8732685381320961227),
+      -INT64_C( 1269276738548369626), -INT64_C(  131368866717553247),  INT64_C( 4701435262864968795),  INT64_C(   96434711121502150),
+      -INT64_C( 4645637710843838958), -INT64_C( 1494313747841070962),  INT64_C( 8261153867904176877), -INT64_C( 4936044519204384862),
+       INT64_C( 7926296716315557155),  INT64_C(  117643435073205029),  INT64_C(  857384227084560071), -INT64_C(  180697199388576487),
+      -INT64_C( 3111638044025957499),  INT64_C( 4487040394995597872), -INT64_C( 3637334322623436271), -INT64_C( 7159863492142428468),
+       INT64_C( 5649151236801356257),  INT64_C( 3100964853512335187),  INT64_C( 2162900249342229122), -INT64_C( 8940937588881714119),
+       INT64_C( 1204001225970019145), -INT64_C( 6868865611479759001), -INT64_C( 5400700523494551139), -INT64_C( 9037334424336412305),
+      -INT64_C( 8671507219660298277),  INT64_C(  190476529703682789), -INT64_C( 4235356901519295737),  INT64_C(  615139561455369422),
+      -INT64_C(  740481429336460783),  INT64_C( 9093503732862796490), -INT64_C( 1210561059090259176), -INT64_C( 8887149680518559370),
+       INT64_C( 6771566187646438131), -INT64_C( 6401937721554767311), -INT64_C( 2813825756363937565),  INT64_C( 6793721182676511313),
+      -INT64_C( 7034804668691513745), -INT64_C( 8177852288954012596),  INT64_C( 3517459605482542998), -INT64_C( 2361788974643262608),
+       INT64_C( 4775857353711000379), -INT64_C( 7825390294691639764), -INT64_C( 1204892674372667081), -INT64_C( 5407129384474952537),
+       INT64_C( 5032672633613572255), -INT64_C( 3691962597028006861),  INT64_C( 5902858650457951868),  INT64_C( 6526947016183428710),
+      -INT64_C( 3849233432606412489), -INT64_C( 5684742067952373318), -INT64_C( 8140370500817912309),  INT64_C(  459933200168153166),
+      -INT64_C( 3290748040874995212),  INT64_C( 1693982431278878363),  INT64_C( 1581278897004949306),  INT64_C( 6204131120395411524),
+      -INT64_C(  811996647518015535),  INT64_C( 5955525728060955780), -INT64_C( 8335417131106274442), -INT64_C( 4485662265934057722),
+       INT64_C( 6446451884305326120), -INT64_C(  528170741268923583),  INT64_C(  853299111216373507),  INT64_C( 6460188479899072502),
+      -INT64_C(  647865551429086765),  INT64_C( 9009164606246022028), -INT64_C( 5157852191514936486), -INT64_C( 1899880147966828777),
+       INT64_C( 6504201502575197590), -INT64_C( 1624833480268934277), -INT64_C(  926698243817391191), -INT64_C( 7021994694054002028),
+       INT64_C( 2702774034741467738),  INT64_C(   88257078151015105) };
+  static const int16_t a[] =
+    { -INT16_C( 19366), -INT16_C( 17449),  INT16_C( 31173), -INT16_C(  2116), -INT16_C( 13999),  INT16_C( 22443),  INT16_C( 11601), -INT16_C( 15798),
+      -INT16_C( 28603), -INT16_C( 24369),  INT16_C(  5508), -INT16_C( 15644), -INT16_C( 11086), -INT16_C( 15481), -INT16_C(  9566), -INT16_C(   784),
+      -INT16_C( 14450),  INT16_C( 21687),  INT16_C( 29760), -INT16_C( 28085), -INT16_C(  2243), -INT16_C( 28951),  INT16_C( 13348),  INT16_C( 26960),
+       INT16_C(  8132),  INT16_C( 18697), -INT16_C(  4811), -INT16_C(  6389), -INT16_C( 27966),  INT16_C( 25771), -INT16_C( 25748), -INT16_C(  1183),
+       INT16_C(  6242), -INT16_C( 23729), -INT16_C( 25972), -INT16_C( 14027),  INT16_C(  7825), -INT16_C( 19113), -INT16_C( 22702),  INT16_C(  5918),
+       INT16_C( 10183), -INT16_C(   928),  INT16_C( 27413), -INT16_C( 10269), -INT16_C( 28931),  INT16_C( 27195), -INT16_C( 25559), -INT16_C( 29595),
+      -INT16_C( 19275),  INT16_C( 16687),  INT16_C( 25678), -INT16_C(  8181),  INT16_C( 25218), -INT16_C( 10859), -INT16_C( 19446), -INT16_C( 11796),
+       INT16_C( 19675), -INT16_C(  3891), -INT16_C( 20297), -INT16_C( 19257),  INT16_C(   831),  INT16_C( 26654), -INT16_C( 31841),  INT16_C( 21748),
+       INT16_C(  9015), -INT16_C( 31082), -INT16_C( 24185),  INT16_C(  2662), -INT16_C(  1277),  INT16_C(  3551), -INT16_C( 13393), -INT16_C( 29730),
+      -INT16_C( 21737), -INT16_C( 12677),  INT16_C( 17244), -INT16_C( 25726), -INT16_C( 24250), -INT16_C(  6909), -INT16_C(  2012),  INT16_C( 23610),
+      -INT16_C( 12261), -INT16_C( 23582),  INT16_C( 18545),  INT16_C( 29869), -INT16_C( 29629), -INT16_C(  3198),  INT16_C( 24663),  INT16_C( 28286),
+      -INT16_C(  1780),  INT16_C( 26684), -INT16_C( 16836), -INT16_C( 32253),  INT16_C(  1631), -INT16_C( 31640), -INT16_C( 23810),  INT16_C(  6880),
+      -INT16_C( 15758), -INT16_C(  7235),  INT16_C( 27146),  INT16_C( 19799), -INT16_C(  9738),  INT16_C( 19776), -INT16_C( 16838),  INT16_C( 18107),
+      -INT16_C(  2120), -INT16_C(  2898) };
+  static const uint64_t e[] =
+    { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               31173), UINT64_C(18446744073709549500),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               11601), UINT64_C(18446744073709535818),
+      UINT64_C(18446744073709523013), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(18446744073709536135), UINT64_C(18446744073709542050), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               29760), UINT64_C(18446744073709523531),
+      UINT64_C(18446744073709549373), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               26960),
+      UINT64_C(                8132), UINT64_C(               18697), UINT64_C(18446744073709546805), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(               25771), UINT64_C(18446744073709525868), UINT64_C(                   0),
+      UINT64_C(                6242), UINT64_C(18446744073709527887), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                7825), UINT64_C(18446744073709532503), UINT64_C(                   0), UINT64_C(                5918),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744073709541347),
+      UINT64_C(18446744073709522685), UINT64_C(                   0), UINT64_C(18446744073709526057), UINT64_C(18446744073709522021),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744073709543435),
+      UINT64_C(                   0), UINT64_C(18446744073709540757), UINT64_C(18446744073709532170), UINT64_C(18446744073709539820),
+      UINT64_C(               19675), UINT64_C(                   0), UINT64_C(18446744073709531319), UINT64_C(                   0),
+      UINT64_C(                 831), UINT64_C(                   0), UINT64_C(18446744073709519775), UINT64_C(               21748),
+      UINT64_C(                   0), UINT64_C(18446744073709520534), UINT64_C(18446744073709527431), UINT64_C(                   0),
+      UINT64_C(18446744073709550339), UINT64_C(                3551), UINT64_C(                   0), UINT64_C(18446744073709521886),
+      UINT64_C(                   0), UINT64_C(18446744073709538939), UINT64_C(               17244), UINT64_C(18446744073709525890),
+      UINT64_C(                   0), UINT64_C(18446744073709544707), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18446744073709539355), UINT64_C(18446744073709528034), UINT64_C(               18545), UINT64_C(                   0),
+      UINT64_C(18446744073709521987), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18446744073709549836), UINT64_C(                   0), UINT64_C(18446744073709534780), UINT64_C(18446744073709519363),
+      UINT64_C(                   0), UINT64_C(18446744073709519976), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18446744073709535858), UINT64_C(                   0), UINT64_C(               27146), UINT64_C(               19799),
+      UINT64_C(                   0), UINT64_C(               19776), UINT64_C(18446744073709534778), UINT64_C(               18107),
+      UINT64_C(                   0), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1sh_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  int16_t a[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1sh_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1uh_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(   311745291),  INT32_C(  1062457006), -INT32_C(  1349920061), -INT32_C(   179190001),  INT32_C(   278071164),  INT32_C(   522577495), -INT32_C(  1172099830),  INT32_C(   375548683),
+      -INT32_C(   198576570), -INT32_C(  2009826107),  INT32_C(  1714994519),  INT32_C(     6064516), -INT32_C(   418320496), -INT32_C(   553175595),  INT32_C(  1838819938), -INT32_C(   595329899),
+      -INT32_C(  1211061006), -INT32_C(  2143288279),  INT32_C(  1172732097), -INT32_C(  1857732095),  INT32_C(   125392177), -INT32_C(   320438134),  INT32_C(  1062830250),  INT32_C(  1864097148),
+      -INT32_C(  1306071927), -INT32_C(  1305319696), -INT32_C(   537454114), -INT32_C(  1921958565),  INT32_C(   496298642),  INT32_C(   336165482),  INT32_C(  2001953787), -INT32_C(   907645120),
+       INT32_C(  1266421083),  INT32_C(  1392356979),  INT32_C(   590476743), -INT32_C(   995057102), -INT32_C(   153009012), -INT32_C(  1190466626), -INT32_C(  1909367218),  INT32_C(   676796365),
+      -INT32_C(  1737239772),  INT32_C(  1240101250), -INT32_C(  1737745562),  INT32_C(  1247550654),  INT32_C(   524369504),  INT32_C(  2010663721),  INT32_C(  1980041641),  INT32_C(  1168006177),
+      -INT32_C(  1294134736), -INT32_C(   369375357), -INT32_C(  1585354525), -INT32_C(   437527164),  INT32_C(  1141124123),  INT32_C(   565959800),  INT32_C(   127451366),  INT32_C(  1296840221),
+      -INT32_C(   872469944), -INT32_C(   726336783), -INT32_C(   411749022),  INT32_C(   785146131),  INT32_C(    91476109), -INT32_C(  1842925908),  INT32_C(   211402735),  INT32_C(  1046079221),
+       INT32_C(    17389584), -INT32_C(  1244217774),  INT32_C(   110906355),  INT32_C(   976578732), -INT32_C(   465590216), -INT32_C(   982030634),  INT32_C(   466685989),  INT32_C(   106506998),
+      -INT32_C(   720870782),  INT32_C(   344645152), -INT32_C(   702929367), -INT32_C(   972009586), -INT32_C(   827699209), -INT32_C(   611114570),  INT32_C(   687236402),  INT32_C(   305090447),
+      -INT32_C(   756598862),  INT32_C(  1055289621),  INT32_C(   622068119),  INT32_C(  1223369808),  INT32_C(   706123124), -INT32_C(   385504841), -INT32_C(  1642988530), -INT32_C(    38780853),
+      -INT32_C(  1932486793), -INT32_C(  1614039544),  INT32_C(   147120055),  INT32_C(  2018553604), -INT32_C(    73243068),  INT32_C(   518301455), -INT32_C(   272828765), -INT32_C(  1360237514),
+       INT32_C(   188398595),  INT32_C(   715785587), -INT32_C(   382570779),  INT32_C(  1633780253), -INT32_C(   128121880),  INT32_C(  1310081450),  INT32_C(  1849545271),  INT32_C(  1092364606),
+       INT32_C(  1498175206),  INT32_C(  1099167324), -INT32_C(  2127907228),  INT32_C(   568494904),  INT32_C(   941178766), -INT32_C(  1199165567),  INT32_C(  1059504897), -INT32_C(   746568979),
+      -INT32_C(   181613415),  INT32_C(   641118146), -INT32_C(  1633197979),  INT32_C(  2042595819),  INT32_C(  1253169353),  INT32_C(   134363143), -INT32_C(   397989381),  INT32_C(    79415147),
+       INT32_C(  1442441107), -INT32_C(    59035753),  INT32_C(  2056921743),  INT32_C(  1962105259),  INT32_C(   952018225), -INT32_C(   666844707),  INT32_C(  1438746602), -INT32_C(   514163634),
+      -INT32_C(    80325788),  INT32_C(   318222723),  INT32_C(  2139984595),  INT32_C(   502497515),  INT32_C(    39170597),  INT32_C(  1574671987),  INT32_C(  1823644701),  INT32_C(  2085424152),
+      -INT32_C(   478706592),  INT32_C(   167079733), -INT32_C(   326598143),  INT32_C(   671709955), -INT32_C(  1607770323),  INT32_C(   318572277), -INT32_C(  1166102366),  INT32_C(   473418940),
+      -INT32_C(  2046841264),  INT32_C(   512685341),  INT32_C(  2047546999), -INT32_C(  1079831406),  INT32_C(  1751174771),  INT32_C(  1987796436), -INT32_C(   902760179),  INT32_C(   367421381),
+       INT32_C(   865854998),  INT32_C(  1381116379), -INT32_C(   758293184), -INT32_C(   443453327),  INT32_C(   307097918),  INT32_C(  1552468047), -INT32_C(  2027505470),  INT32_C(   916262176),
+      -INT32_C(   831964941), -INT32_C(  1591690399), -INT32_C(  1972114152), -INT32_C(  1687222947),  INT32_C(  1169014006),  INT32_C(  1201812869),  INT32_C(   248432878), -INT32_C(   935040043),
+       INT32_C(    93760931), -INT32_C(  2119780503),  INT32_C(    34282148),  INT32_C(   362641951), -INT32_C(  1134867657),  INT32_C(  1845755264), -INT32_C(  1686318651), -INT32_C(   530333635) };
+  static const uint16_t a[] =
+    { UINT16_C(10926), UINT16_C(49070), UINT16_C(30355), UINT16_C(10103), UINT16_C(41594), UINT16_C(50822), UINT16_C(57850), UINT16_C(59077),
+      UINT16_C(37544), UINT16_C(48186), UINT16_C(19142), UINT16_C( 8609), UINT16_C(41360), UINT16_C( 6558), UINT16_C(49578), UINT16_C(22638),
+      UINT16_C( 7404), UINT16_C(32536), UINT16_C(36754), UINT16_C( 3495), UINT16_C(11569), UINT16_C(11219), UINT16_C(39182), UINT16_C(46609),
+      UINT16_C(19499), UINT16_C(62067), UINT16_C( 5270), UINT16_C( 9747), UINT16_C(45493), UINT16_C(24383), UINT16_C(44403), UINT16_C(24503),
+      UINT16_C(53193), UINT16_C(23774), UINT16_C(34142), UINT16_C(36713), UINT16_C(15538), UINT16_C(49594), UINT16_C(52437), UINT16_C(  375),
+      UINT16_C(59928), UINT16_C(44787), UINT16_C( 1790), UINT16_C(46036), UINT16_C( 5048), UINT16_C(11026), UINT16_C(51904), UINT16_C(35210),
+      UINT16_C(26777), UINT16_C(63717), UINT16_C(20206), UINT16_C(41095), UINT16_C(17035), UINT16_C(24673), UINT16_C(55566), UINT16_C( 9825),
+      UINT16_C(21699), UINT16_C(49876), UINT16_C(43099), UINT16_C( 4981), UINT16_C(35003), UINT16_C(31550), UINT16_C(51282), UINT16_C(60164),
+      UINT16_C(59952), UINT16_C( 7907), UINT16_C(27448), UINT16_C(50111), UINT16_C( 8365), UINT16_C(47908), UINT16_C(34297), UINT16_C(48609),
+      UINT16_C(46554), UINT16_C(13695), UINT16_C(62557), UINT16_C( 6216), UINT16_C(34428), UINT16_C(52883), UINT16_C(38734), UINT16_C(32442),
+      UINT16_C(40321), UINT16_C(47773), UINT16_C(23560), UINT16_C(46461), UINT16_C(41340), UINT16_C(30320), UINT16_C(20775), UINT16_C(  307),
+      UINT16_C(45574), UINT16_C(25398), UINT16_C(32422), UINT16_C( 9083), UINT16_C( 3588), UINT16_C(21233), UINT16_C(43942), UINT16_C(10192),
+      UINT16_C(27977), UINT16_C(20961), UINT16_C(24521), UINT16_C(17927), UINT16_C(30464), UINT16_C(10172), UINT16_C(61385), UINT16_C(53032),
+      UINT16_C(24225), UINT16_C(18227), UINT16_C(44764), UINT16_C(57450), UINT16_C(23741), UINT16_C(25394), UINT16_C(  775), UINT16_C(20618),
+      UINT16_C(27760), UINT16_C(15010), UINT16_C(43467), UINT16_C(52096), UINT16_C(15392), UINT16_C(59891), UINT16_C( 6955), UINT16_C(52409),
+      UINT16_C(60538), UINT16_C(22035), UINT16_C(32410), UINT16_C(22327), UINT16_C(27098), UINT16_C(57786), UINT16_C(17772), UINT16_C(56626),
+      UINT16_C(54449), UINT16_C(31767), UINT16_C(38781), UINT16_C(40263), UINT16_C(15059), UINT16_C(65159), UINT16_C(16470), UINT16_C(53450),
+      UINT16_C(56620), UINT16_C(50726), UINT16_C(23899), UINT16_C(13598), UINT16_C(55495), UINT16_C(13079), UINT16_C(18717), UINT16_C(52752),
+      UINT16_C(10013), UINT16_C(39498), UINT16_C(37566), UINT16_C(37175), UINT16_C(48844), UINT16_C( 8847), UINT16_C(23038), UINT16_C(10994),
+      UINT16_C( 6455), UINT16_C(37617), UINT16_C( 3958), UINT16_C(15816), UINT16_C(57319), UINT16_C( 1393), UINT16_C(33064), UINT16_C(17875),
+      UINT16_C( 7849), UINT16_C(26591), UINT16_C( 5808), UINT16_C(31993), UINT16_C(35029), UINT16_C(54175), UINT16_C(37346), UINT16_C( 6654),
+      UINT16_C(61354), UINT16_C( 8619), UINT16_C(29694), UINT16_C(58718), UINT16_C(53074), UINT16_C(31466), UINT16_C(48721), UINT16_C(64191) };
+  static const int32_t e[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(       30355),  INT32_C(       10103),  INT32_C(           0),  INT32_C(           0),  INT32_C(       57850),  INT32_C(           0),
+       INT32_C(       37544),  INT32_C(       48186),  INT32_C(           0),  INT32_C(           0),  INT32_C(       41360),  INT32_C(        6558),  INT32_C(           0),  INT32_C(       22638),
+       INT32_C(        7404),  INT32_C(       32536),  INT32_C(           0),  INT32_C(        3495),  INT32_C(           0),  INT32_C(       11219),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(       19499),  INT32_C(       62067),  INT32_C(        5270),  INT32_C(        9747),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       24503),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       36713),  INT32_C(       15538),  INT32_C(       49594),  INT32_C(       52437),  INT32_C(           0),
+       INT32_C(       59928),  INT32_C(           0),  INT32_C(        1790),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(       26777),  INT32_C(       63717),  INT32_C(       20206),  INT32_C(       41095),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(       21699),  INT32_C(       49876),  INT32_C(       43099),  INT32_C(           0),  INT32_C(           0),  INT32_C(       31550),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(        7907),  INT32_C(           0),  INT32_C(           0),  INT32_C(        8365),  INT32_C(       47908),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(       46554),  INT32_C(           0),  INT32_C(       62557),  INT32_C(        6216),  INT32_C(       34428),  INT32_C(       52883),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(       40321),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       30320),  INT32_C(       20775),  INT32_C(         307),
+       INT32_C(       45574),  INT32_C(       25398),  INT32_C(           0),  INT32_C(           0),  INT32_C(        3588),  INT32_C(           0),  INT32_C(       43942),  INT32_C(       10192),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(       24521),  INT32_C(           0),  INT32_C(       30464),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(       44764),  INT32_C(           0),  INT32_C(           0),  INT32_C(       25394),  INT32_C(           0),  INT32_C(       20618),
+       INT32_C(       27760),  INT32_C(           0),  INT32_C(       43467),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(        6955),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(       22035),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(       57786),  INT32_C(           0),  INT32_C(       56626),
+       INT32_C(       54449),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(       56620),  INT32_C(           0),  INT32_C(       23899),  INT32_C(           0),  INT32_C(       55495),  INT32_C(           0),  INT32_C(       18717),  INT32_C(           0),
+       INT32_C(       10013),  INT32_C(           0),  INT32_C(           0),  INT32_C(       37175),  INT32_C(           0),  INT32_C(           0),  INT32_C(       23038),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(        3958),  INT32_C(       15816),  INT32_C(           0),  INT32_C(           0),  INT32_C(       33064),  INT32_C(           0),
+       INT32_C(        7849),  INT32_C(       26591),  INT32_C(        5808),  INT32_C(       31993),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(        6654),
+       INT32_C(           0),  INT32_C(        8619),  INT32_C(           0),  INT32_C(           0),  INT32_C(       53074),  INT32_C(           0),  INT32_C(       48721),  INT32_C(       64191) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1uh_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint16_t a[1024 / sizeof(int32_t)];
+  int32_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1uh_s32(pv, &(a[i]));
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1uh_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 6070227077054738731),  INT64_C( 6299574003572850809), -INT64_C( 3829063674254278944), -INT64_C( 5636554154791512547),
+      -INT64_C( 6265639370876192579), -INT64_C( 4738045335368611398), -INT64_C( 8971808832873302061), -INT64_C( 8025573054934818031),
+      -INT64_C( 8412447226312206489), -INT64_C( 3394954368792663739), -INT64_C( 8173468737081196119),  INT64_C( 1317333315337599972),
+       INT64_C( 8741181439114623218),  INT64_C( 2135126734253375955),  INT64_C(  741896736736027968), -INT64_C( 3118730773394176006),
+       INT64_C( 2373368744729076290),  INT64_C( 5348185129618607271),  INT64_C( 2227121429231920311), -INT64_C(  661611652964963814),
+      -INT64_C(  699645297018705443), -INT64_C( 8845832944190669848), -INT64_C( 5553137795316169298),  INT64_C(  909587687150695412),
+       INT64_C( 5850035626102361322),  INT64_C( 4039026872812847547), -INT64_C( 5831605463631105850),  INT64_C( 3163768025964331180),
+       INT64_C( 6394148974791761154),  INT64_C( 5231193206617538773),  INT64_C( 5244362167857619550),  INT64_C( 1793851114993688440),
+      -INT64_C( 5612540813893220057),  INT64_C( 5190586495766035519), -INT64_C( 2436684450950434996), -INT64_C( 8974128846805118393),
+       INT64_C( 8527112035103144134),  INT64_C( 6814860008928733280),  INT64_C( 7220243392138507502),  INT64_C( 1056153796100606920),
+      -INT64_C( 5486781467227656402),  INT64_C( 4531342850591101297),  INT64_C( 7351500351370111108),  INT64_C( 3091495730776032913),
+       INT64_C( 1452528130111543842),  INT64_C( 4182291229013714299), -INT64_C(  817438090433159773), -INT64_C( 8733406133545520474),
+       INT64_C( 4685471795417668431), -INT64_C( 4811789322152992951), -INT64_C( 7201916657478986315), -INT64_C( 2395057866995213608),
+       INT64_C( 3129394682506821478),  INT64_C( 5065815732213414518), -INT64_C( 3816117941458482055), -INT64_C( 4993141422106851002),
+      -INT64_C( 3271491997862034037), -INT64_C( 6870893072844930099), -INT64_C( 5207822046262786820),  INT64_C( 1905376202853303138),
+       INT64_C( 8715627098259544006),  INT64_C(  192666348992026340),  INT64_C( 4010925874247482241),  INT64_C( 4474148624270177902),
+      -INT64_C( 6640181895120248906), -INT64_C( 5786180840133250645), -INT64_C( 4746430820877491178),  INT64_C( 2537447909347823488),
+      -INT64_C( 7505988839685187982), -INT64_C(  725927404177423345),  INT64_C( 6462386021565763232), -INT64_C( 5647083755268904176),
+      -INT64_C( 7809038876619364835) };
+  static const uint16_t a[] =
+    { UINT16_C(17429), UINT16_C(57990), UINT16_C(  473), UINT16_C(53038), UINT16_C(55823), UINT16_C(54691), UINT16_C(24621), UINT16_C(12489),
+      UINT16_C(26756), UINT16_C(25800), UINT16_C(63192), UINT16_C(41289), UINT16_C(56348), UINT16_C(24260), UINT16_C(16804), UINT16_C(47853),
+      UINT16_C(29573), UINT16_C(24220), UINT16_C(52084), UINT16_C(33582), UINT16_C(53669), UINT16_C(53848), UINT16_C( 8753), UINT16_C(46594),
+      UINT16_C(52106), UINT16_C(25114), UINT16_C(25537), UINT16_C(56579), UINT16_C(51008), UINT16_C(58427), UINT16_C(10248), UINT16_C(36254),
+      UINT16_C(15260), UINT16_C( 4332), UINT16_C( 6662), UINT16_C(43924), UINT16_C(60651), UINT16_C( 7549), UINT16_C(32526), UINT16_C(39123),
+      UINT16_C(60746), UINT16_C( 3323), UINT16_C(65105), UINT16_C(37353), UINT16_C( 9670), UINT16_C(52853), UINT16_C( 5197), UINT16_C(59740),
+      UINT16_C(18511), UINT16_C(22010), UINT16_C(36450), UINT16_C(19712), UINT16_C(32122), UINT16_C(35178), UINT16_C(15868), UINT16_C(18209),
+      UINT16_C( 7211), UINT16_C(31827), UINT16_C(15387), UINT16_C(57613), UINT16_C(33377), UINT16_C(44975), UINT16_C( 2966), UINT16_C(58776),
+      UINT16_C(37459), UINT16_C(46394), UINT16_C(14880), UINT16_C(39683), UINT16_C(28087), UINT16_C(46116), UINT16_C(17835), UINT16_C(55035),
+      UINT16_C(20066) };
+  static const int64_t e[] =
+    {  INT64_C(               17429),  INT64_C(                   0),  INT64_C(                 473),  INT64_C(               53038),
+       INT64_C(               55823),  INT64_C(               54691),  INT64_C(               24621),  INT64_C(               12489),
+       INT64_C(               26756),  INT64_C(               25800),  INT64_C(               63192),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(               47853),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(               33582),
+       INT64_C(               53669),  INT64_C(               53848),  INT64_C(                8753),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(               25537),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(               15260),  INT64_C(                   0),  INT64_C(                6662),  INT64_C(               43924),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(               60746),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                5197),  INT64_C(               59740),
+       INT64_C(                   0),  INT64_C(               22010),  INT64_C(               36450),  INT64_C(               19712),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(               15868),  INT64_C(               18209),
+       INT64_C(                7211),  INT64_C(               31827),  INT64_C(               15387),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(               37459),  INT64_C(               46394),  INT64_C(               14880),  INT64_C(                   0),
+       INT64_C(               28087),  INT64_C(               46116),  INT64_C(                   0),  INT64_C(               55035),
+       INT64_C(               20066) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1uh_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint16_t a[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1uh_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1uh_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(   813363401),  INT32_C(  1920830014), -INT32_C(    84919951),  INT32_C(   743276148), -INT32_C(   637952318), -INT32_C(   448812995), -INT32_C(   646838325), -INT32_C(   489757160),
+       INT32_C(   353519831),  INT32_C(  1132957650),  INT32_C(  1010727112), -INT32_C(  1201107978),  INT32_C(  1737581097), -INT32_C(   716386294), -INT32_C(   256917800),  INT32_C(  2077392292),
+      -INT32_C(  1752046395),  INT32_C(  1020926068), -INT32_C(  2022106992), -INT32_C(   851451485),  INT32_C(  1312084291),  INT32_C(  2032369825), -INT32_C(   496315842),  INT32_C(   341720143),
+      -INT32_C(  1783894239), -INT32_C(  1731099129),  INT32_C(  1109346974),  INT32_C(  1863278124), -INT32_C(   776125649),  INT32_C(    21684675),  INT32_C(    65254579),  INT32_C(   303514097),
+       INT32_C(   950518576), -INT32_C(   405768119), -INT32_C(   282464317),  INT32_C(  2103326797),  INT32_C(  1045306491), -INT32_C(  1338009347),  INT32_C(  1051927373), -INT32_C(  1789867164),
+      -INT32_C(   674367602),  INT32_C(   851352943), -INT32_C(   652089204), -INT32_C(  1672052704), -INT32_C(  1713724260), -INT32_C(  1974920643), -INT32_C(  1580663491),  INT32_C(  1446385864),
+       INT32_C(  2116879119),  INT32_C(   749857696), -INT32_C(   200879405), -INT32_C(   292529070),  INT32_C(  1049061889), -INT32_C(  1043803772), -INT32_C(  1771859762), -INT32_C(  1209230936),
+       INT32_C(  1026890141), -INT32_C(   664082940),  INT32_C(   197947577), -INT32_C(   839230260),  INT32_C(  1259045318),  INT32_C(   537711442),  INT32_C(   196505443), -INT32_C(  1497193975),
+      -INT32_C(  1058801477), -INT32_C(  1751626274), -INT32_C(  1969003331), -INT32_C(  2041078336),  INT32_C(  1909547806), -INT32_C(  1701716426),  INT32_C(  1453672525), -INT32_C(  1493407510),
+       INT32_C(  1046929504), -INT32_C(   338231763),  INT32_C(   578124130),  INT32_C(   883477526),  INT32_C(  1722120751), -INT32_C(  1526712488),  INT32_C(  1778165119),  INT32_C(  1829763085),
+       INT32_C(   111965656), -INT32_C(   705592717),  INT32_C(   301426427),  INT32_C(  1648730162),  INT32_C(  1925770010), -INT32_C(  1592276958),  INT32_C(  2064257901), -INT32_C(   454551028),
+       INT32_C(    65705103),  INT32_C(   299424534),  INT32_C(  1948438593), -INT32_C(  1965660048),  INT32_C(  1979489875), -INT32_C(   753527962),  INT32_C(   860758055), -INT32_C(   904448198),
+      -INT32_C(   489880885),  INT32_C(   536061405), -INT32_C(   443345291), -INT32_C(   781227650),  INT32_C(  1833331463), -INT32_C(  1505731457), -INT32_C(  1210478724), -INT32_C(  1853755194),
+      -INT32_C(   797749518),  INT32_C(  1777297395), -INT32_C(    78740867), -INT32_C(   221462805), -INT32_C(  1470164439), -INT32_C(   363946130), -INT32_C(   190765266),  INT32_C(   176562712),
+       INT32_C(  1692072304), -INT32_C(   573716128),  INT32_C(   920132427),  INT32_C(    52995289),  INT32_C(   615221174),  INT32_C(  1427110439),  INT32_C(   961196065),  INT32_C(  1128583379),
+       INT32_C(   715595465),  INT32_C(   856126696),  INT32_C(  1768611984),  INT32_C(   996971140),  INT32_C(  1096751130),  INT32_C(   865496594), -INT32_C(   227680225),  INT32_C(  2050339248),
+      -INT32_C(  1213932081), -INT32_C(   504648879),  INT32_C(   273372555),  INT32_C(    21739495), -INT32_C(   515724593),  INT32_C(   940955929),  INT32_C(  1781170873),  INT32_C(    48521011),
+      -INT32_C(  1900378052), -INT32_C(  1083202253), -INT32_C(   506479878),  INT32_C(  1105402482), -INT32_C(   584899132), -INT32_C(  1206568706) };
+  static const uint16_t a[] =
+    { UINT16_C(31734), UINT16_C(53909), UINT16_C(59979), UINT16_C(27512), UINT16_C(14728), UINT16_C(38656), UINT16_C(51653), UINT16_C(53938),
+      UINT16_C( 8518), UINT16_C(20335), UINT16_C(61432), UINT16_C( 5713), UINT16_C(49256), UINT16_C(12516), UINT16_C( 2539), UINT16_C(57645),
+      UINT16_C(49796), UINT16_C(53172), UINT16_C(11436), UINT16_C(13627), UINT16_C(15205), UINT16_C(10956), UINT16_C(32516), UINT16_C(19453),
+      UINT16_C(27808), UINT16_C(39322), UINT16_C(60507), UINT16_C(50351), UINT16_C(37804), UINT16_C(38900), UINT16_C( 8605), UINT16_C( 8568),
+      UINT16_C(11492), UINT16_C(37105), UINT16_C(11352), UINT16_C(48581), UINT16_C(37479), UINT16_C(27624), UINT16_C(58641), UINT16_C(45494),
+      UINT16_C(20817), UINT16_C(44362), UINT16_C(64061), UINT16_C(59761), UINT16_C(25997), UINT16_C(10880), UINT16_C(63622), UINT16_C(27212),
+      UINT16_C(15653), UINT16_C(32251), UINT16_C(49257), UINT16_C(53307), UINT16_C( 9042), UINT16_C(25403), UINT16_C(61960), UINT16_C(22805),
+      UINT16_C(24387), UINT16_C(32774), UINT16_C(30553), UINT16_C(59241), UINT16_C(59868), UINT16_C(25361), UINT16_C(24033), UINT16_C( 1741),
+      UINT16_C(51354), UINT16_C(  900), UINT16_C(49033), UINT16_C(56275), UINT16_C( 4066), UINT16_C(59967), UINT16_C(21505), UINT16_C(17475),
+      UINT16_C(19123), UINT16_C( 3524), UINT16_C(11713), UINT16_C(40692), UINT16_C( 1302), UINT16_C(63233), UINT16_C(52835), UINT16_C(65022),
+      UINT16_C(33431), UINT16_C( 8193), UINT16_C(54337), UINT16_C( 9211), UINT16_C(15075), UINT16_C(58381), UINT16_C(20622), UINT16_C(16936),
+      UINT16_C(60570), UINT16_C(23631), UINT16_C(17177), UINT16_C(12282), UINT16_C(64328), UINT16_C(43815), UINT16_C( 9673), UINT16_C(24745),
+      UINT16_C(43687), UINT16_C(59520), UINT16_C(31870), UINT16_C(25099), UINT16_C( 6326), UINT16_C(17734), UINT16_C(28520), UINT16_C(  903),
+      UINT16_C(54875), UINT16_C(30047), UINT16_C(22809), UINT16_C(24996), UINT16_C(52052), UINT16_C( 7437), UINT16_C(46832), UINT16_C(38782),
+      UINT16_C(65120), UINT16_C(56959), UINT16_C(35450), UINT16_C(12608), UINT16_C(34722), UINT16_C( 2934), UINT16_C(65014), UINT16_C(20750),
+      UINT16_C(28115), UINT16_C(60614), UINT16_C(27590), UINT16_C( 6733), UINT16_C(23094), UINT16_C(10039), UINT16_C(46352), UINT16_C(28862),
+      UINT16_C(16052), UINT16_C(11855), UINT16_C(36808), UINT16_C(27487), UINT16_C(54550), UINT16_C( 3190), UINT16_C(34002), UINT16_C(42334),
+      UINT16_C( 9457), UINT16_C(46993), UINT16_C(57231), UINT16_C(50897), UINT16_C( 2105), UINT16_C(19181) };
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(         0), UINT32_C(     59979), UINT32_C(         0), UINT32_C(     14728), UINT32_C(     38656), UINT32_C(     51653), UINT32_C(     53938),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(      5713), UINT32_C(         0), UINT32_C(     12516), UINT32_C(      2539), UINT32_C(         0),
+      UINT32_C(     49796), UINT32_C(         0), UINT32_C(     11436), UINT32_C(     13627), UINT32_C(         0), UINT32_C(         0), UINT32_C(     32516), UINT32_C(         0),
+      UINT32_C(     27808), UINT32_C(     39322), UINT32_C(         0), UINT32_C(         0), UINT32_C(     37804), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(     37105), UINT32_C(     11352), UINT32_C(         0), UINT32_C(         0), UINT32_C(     27624), UINT32_C(         0), UINT32_C(     45494),
+      UINT32_C(     20817), UINT32_C(         0), UINT32_C(     64061), UINT32_C(     59761), UINT32_C(     25997), UINT32_C(     10880), UINT32_C(     63622), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(     49257), UINT32_C(     53307), UINT32_C(         0), UINT32_C(     25403), UINT32_C(     61960), UINT32_C(     22805),
+      UINT32_C(         0), UINT32_C(     32774), UINT32_C(         0), UINT32_C(     59241), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(      1741),
+      UINT32_C(     51354), UINT32_C(       900), UINT32_C(     49033), UINT32_C(     56275), UINT32_C(         0), UINT32_C(     59967), UINT32_C(         0), UINT32_C(     17475),
+      UINT32_C(         0), UINT32_C(      3524), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(     63233), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(      8193), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(     58381), UINT32_C(         0), UINT32_C(     16936),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(     12282), UINT32_C(         0), UINT32_C(     43815), UINT32_C(         0), UINT32_C(     24745),
+      UINT32_C(     43687), UINT32_C(         0), UINT32_C(     31870), UINT32_C(     25099), UINT32_C(         0), UINT32_C(     17734), UINT32_C(     28520), UINT32_C(       903),
+      UINT32_C(     54875), UINT32_C(         0), UINT32_C(     22809), UINT32_C(     24996), UINT32_C(     52052), UINT32_C(      7437), UINT32_C(     46832), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(     56959), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(     46352), UINT32_C(         0),
+      UINT32_C(     16052), UINT32_C(     11855), UINT32_C(         0), UINT32_C(         0), UINT32_C(     54550), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(      9457), UINT32_C(     46993), UINT32_C(     57231), UINT32_C(         0), UINT32_C(      2105), UINT32_C(     19181) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1uh_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  uint16_t a[1024 / sizeof(uint32_t)];
+  uint32_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1uh_u32(pv, &(a[i]));
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1uh_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 2673160678138747494), -INT64_C( 3052272229213368433), -INT64_C( 4611781049063225360),  INT64_C( 5783548493430751859),
+      -INT64_C( 2877538167978245457),  INT64_C( 1866389274398229117), -INT64_C( 5235702553063351546), -INT64_C( 9181625984388135282),
+       INT64_C(  554723999502211985), -INT64_C( 7923239613599527480), -INT64_C( 5650186691421792358), -INT64_C( 8982276685458660857),
+      -INT64_C( 7154513551881859546),  INT64_C( 7564525436895350748), -INT64_C( 5943662279436852050),  INT64_C( 3023565731725146496),
+       INT64_C( 4421285109187564267),  INT64_C( 3428822064166201694),  INT64_C( 4257735334374202564),  INT64_C( 7145420920091155452),
+      -INT64_C( 1111686991048473868), -INT64_C( 7343485506310817945), -INT64_C( 7528863427104335986), -INT64_C( 4065975500309843530),
+      -INT64_C( 7402318881313999677), -INT64_C( 6676983282229222683),  INT64_C( 3089592989134903982), -INT64_C(  415479917193889887),
+      -INT64_C( 1554985394090584161),  INT64_C( 3652414367387217143), -INT64_C( 5984057898668680363), -INT64_C( 2881077565364089390),
+      -INT64_C( 2260501444410321742), -INT64_C( 7514085268233894398),  INT64_C( 7128448958474564662),  INT64_C( 1924286536471023011),
+       INT64_C( 8470833790293466820),  INT64_C( 5517670504292121273), -INT64_C( 1307878657010764568),  INT64_C( 8794542397041755529),
+       INT64_C(  703887897818357211),  INT64_C( 6670840899200925744),  INT64_C( 2720928013982310794), -INT64_C( 2007722484495315982),
+       INT64_C( 3556146065309911808),  INT64_C( 9117550588957580728), -INT64_C(  293273798267675860),  INT64_C( 2922491086157055392),
+       INT64_C( 8161880117022933265), -INT64_C(  891108239022900176), -INT64_C( 6087554933572504191),  INT64_C(   72025634487150766),
+       INT64_C( 8849386670195374244),  INT64_C( 1426587280941673490), -INT64_C( 2239378419272087498), -INT64_C( 4091602573579632567),
+      -INT64_C( 5480049926020511187),  INT64_C(  577966889734279520),  INT64_C(  860809586427929057), -INT64_C( 8331524763918554762),
+      -INT64_C( 2875277365124758332), -INT64_C( 2422144962531777401),  INT64_C( 6286712686234413936), -INT64_C( 4578101448978431604),
+      -INT64_C(  494202502285788204),  INT64_C( 3368328298908282594),  INT64_C( 2276745062146748256), -INT64_C( 5990489164132743135),
+       INT64_C( 2478700807474185212), -INT64_C( 3605201398930425588),  INT64_C( 1810630634302756975), -INT64_C( 6362720223279830482),
+      -INT64_C( 3064281966769230826), -INT64_C( 6165544181971322060),  INT64_C( 5981004764025749231),  INT64_C( 6938371686313572087),
+       INT64_C( 1105405948596805560),  INT64_C( 8976272801152497324),  INT64_C(   78358941404446366),  INT64_C( 3765834458580938649),
+      -INT64_C( 3011203726632879795), -INT64_C( 6481437390492801276),  INT64_C( 7825426374304821389),  INT64_C( 8691825421518323183),
+       INT64_C( 7533350529739544203),  INT64_C( 2696538629642799294),  INT64_C( 4951803814148429432),  INT64_C( 2537865907509594004),
+       INT64_C( 7886194025938081957), -INT64_C( 1483479284827591764),  INT64_C( 1301521045675976565), -INT64_C( 5498601512889040907),
+      -INT64_C( 7350105568453031197),  INT64_C( 5185692463424942745),  INT64_C( 1296511250344324462), -INT64_C( 4638054656883306015),
+       INT64_C( 2621747593886195419) };
+  static const uint16_t a[] =
+    { UINT16_C(27850), UINT16_C(45672), UINT16_C(43864), UINT16_C(23395), UINT16_C( 2147), UINT16_C( 7792), UINT16_C(20707), UINT16_C(23626),
+      UINT16_C(49366), UINT16_C(52111), UINT16_C(55851), UINT16_C( 1417), UINT16_C(41369), UINT16_C(19496), UINT16_C(21618), UINT16_C(15590),
+      UINT16_C(20416), UINT16_C( 6382), UINT16_C(20986), UINT16_C(23923), UINT16_C(58202), UINT16_C(15740), UINT16_C(50739), UINT16_C( 2458),
+      UINT16_C(10630), UINT16_C(45780), UINT16_C(24067), UINT16_C(40119), UINT16_C(57343), UINT16_C(29161), UINT16_C(53043), UINT16_C(62381),
+      UINT16_C(39710), UINT16_C( 6411), UINT16_C(32493), UINT16_C(18294), UINT16_C(62049), UINT16_C(38020), UINT16_C( 7864), UINT16_C(16285),
+      UINT16_C(29255), UINT16_C(19441), UINT16_C(43216), UINT16_C(53223), UINT16_C(53383), UINT16_C(47681), UINT16_C(61088), UINT16_C(48813),
+      UINT16_C(47242), UINT16_C(30679), UINT16_C(20022), UINT16_C(38846), UINT16_C(16960), UINT16_C(63787), UINT16_C(51297), UINT16_C(43064),
+      UINT16_C(10554), UINT16_C( 2803), UINT16_C(56273), UINT16_C(22746), UINT16_C( 7083), UINT16_C(19218), UINT16_C(48905), UINT16_C(37642),
+      UINT16_C(57719), UINT16_C(44298), UINT16_C(51247), UINT16_C(28740), UINT16_C(28427), UINT16_C(27753), UINT16_C(41271), UINT16_C(29204),
+      UINT16_C( 2250), UINT16_C(39804), UINT16_C(22243), UINT16_C(36595), UINT16_C( 1393), UINT16_C(31706), UINT16_C(58564), UINT16_C(15118),
+      UINT16_C( 6597), UINT16_C(62952), UINT16_C(11489), UINT16_C(60517), UINT16_C(52891), UINT16_C(53848), UINT16_C(28015), UINT16_C(14660),
+      UINT16_C(49525), UINT16_C(22740), UINT16_C(50967), UINT16_C(35302), UINT16_C(49356), UINT16_C(36868), UINT16_C( 4772), UINT16_C(27339),
+      UINT16_C(45867) };
+  static const uint64_t e[] =
+    { UINT64_C(               27850), UINT64_C(               45672), UINT64_C(               43864), UINT64_C(                   0),
+      UINT64_C(                2147), UINT64_C(                   0), UINT64_C(               20707), UINT64_C(               23626),
+      UINT64_C(                   0), UINT64_C(               52111), UINT64_C(               55851), UINT64_C(                1417),
+      UINT64_C(               41369), UINT64_C(                   0), UINT64_C(               21618), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(               58202), UINT64_C(               15740), UINT64_C(               50739), UINT64_C(                2458),
+      UINT64_C(               10630), UINT64_C(               45780), UINT64_C(                   0), UINT64_C(               40119),
+      UINT64_C(               57343), UINT64_C(                   0), UINT64_C(               53043), UINT64_C(               62381),
+      UINT64_C(               39710), UINT64_C(                6411), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                7864), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               53223),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               61088), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(               30679), UINT64_C(               20022), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               51297), UINT64_C(               43064),
+      UINT64_C(               10554), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               22746),
+      UINT64_C(                7083), UINT64_C(               19218), UINT64_C(                   0), UINT64_C(               37642),
+      UINT64_C(               57719), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               28740),
+      UINT64_C(                   0), UINT64_C(               27753), UINT64_C(                   0), UINT64_C(               29204),
+      UINT64_C(                2250), UINT64_C(               39804), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                6597), UINT64_C(               62952), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(               22740), UINT64_C(                   0), UINT64_C(               35302),
+      UINT64_C(               49356), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(               27339),
+      UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1uh_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint16_t a[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1uh_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sw_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 6997957739796637508),  INT64_C( 2829169489224506863), -INT64_C( 4473654568448034611), -INT64_C(   42939521413434836),
+      -INT64_C( 2776489055589749350),  INT64_C( 1754797786870059146), -INT64_C( 4403294939087162557),  INT64_C( 4883802681356400396),
+       INT64_C(  986800157571520237),  INT64_C( 5207456411860122081),  INT64_C( 1811940244495971278),  INT64_C( 3274862669368164229),
+       INT64_C( 9136878532658842684),  INT64_C( 8483918201043422320), -INT64_C(  303431718455990366), -INT64_C( 8292925368257828483),
+       INT64_C( 1550391268759891560), -INT64_C( 4665370645179584987), -INT64_C( 7719953610520520339),  INT64_C(  917954375929890785),
+       INT64_C( 5180149072636545321),  INT64_C( 2278914538706529476),  INT64_C( 2817528535869165421), -INT64_C( 3560352080149845273),
+       INT64_C(  326650882644814111),  INT64_C( 6754703379846765547), -INT64_C( 8789905383689633899), -INT64_C( 7937127664793330842),
+      -INT64_C( 2335859725745097390), -INT64_C( 7619181265232757770), -INT64_C( 8782173064987073030),  INT64_C( 3157703770080620752),
+      -INT64_C(  670101756042238497),  INT64_C( 7378056637432213709),  INT64_C( 1939678468912436548), -INT64_C( 4083868866745500337),
+       INT64_C( 3443368476953678035),  INT64_C(  742919966201587326), -INT64_C( 4784412223480049866), -INT64_C(  610737869460932905),
+      -INT64_C( 1379628232297799607),  INT64_C( 8000967139740997433), -INT64_C( 6152045927609698188),  INT64_C(  620352980069746048),
+       INT64_C( 3632591772363023631), -INT64_C( 2878580382994710682),  INT64_C(  517449445776489906), -INT64_C( 7591302577884784673),
+       INT64_C( 5752642541452483243), -INT64_C(  938724269457865028), -INT64_C( 1547367953153412360),  INT64_C( 2475061661644894525),
+      -INT64_C( 6430687361658163831), -INT64_C( 6713531503344177247),  INT64_C( 3343544428963908464), -INT64_C( 6381236607739892008),
+       INT64_C( 8307131206099089080),  INT64_C( 4383737244319813258),  INT64_C( 8544486959194044277), -INT64_C( 8588304221713627892),
+       INT64_C( 5742497191351216748), -INT64_C( 6590919994974730624),  INT64_C( 7594368997916295248), -INT64_C( 3783758848145020636),
+      -INT64_C( 7322366897993177267), -INT64_C( 8244842705983118144),  INT64_C( 7023046122243071919), -INT64_C( 5029443892004124408),
+      -INT64_C( 5246923399975060358),  INT64_C( 3881606472121390611),  INT64_C( 4718286114983664091),  INT64_C( 2155496490110931138),
+      -INT64_C(  520198858010872296), -INT64_C( 8813220482115932425),  INT64_C( 7996731218477380480), -INT64_C( 7446554101495782424),
+       INT64_C( 3610319251554392637),  INT64_C(  652283664841794269), -INT64_C( 6093725700068299948), -INT64_C( 3569139461571343520),
+       INT64_C( 7685122891799600953),  INT64_C(  792633220732704365), -INT64_C( 2515127911790755414),  INT64_C( 7341769181491973763),
+       INT64_C( 5425572970369832019), -INT64_C( 1830642619714028073), -INT64_C( 7035630752015080959), -INT64_C( 6824194445216114247),
+       INT64_C( 9049366239864038763),  INT64_C( 1742509426227271179), -INT64_C( 6341080449949400507), -INT64_C( 5404926168194502131),
+       INT64_C( 6422857980273655806),  INT64_C( 1556503640651410793),  INT64_C( 3667747745083830353),  INT64_C( 5270770995539309351),
+       INT64_C( 2355400980460086026),  INT64_C( 8224198683657261373),  INT64_C( 3873261764022999146), -INT64_C( 2116749169813729782),
+      -INT64_C( 2682480040226419217),  INT64_C(  706795346111981116),  INT64_C( 2586570424059462050),  INT64_C( 4999303821142887334),
+      -INT64_C( 4458932490338591834), -INT64_C( 5566468863159237354),  INT64_C( 6245164131807287151) };
+  static const int32_t a[] =
+    { -INT32_C(   528321126), -INT32_C(  1839398294), -INT32_C(   656012738),  INT32_C(  1829092212), -INT32_C(     6978670),  INT32_C(    47973218), -INT32_C(  2098901143), -INT32_C(  1651056893),
+      -INT32_C(  1082320556),  INT32_C(  1515313691),  INT32_C(  1479686116), -INT32_C(  2050607117),  INT32_C(   495213498), -INT32_C(   954245026), -INT32_C(  1303837521),  INT32_C(   944759011),
+       INT32_C(   351784441), -INT32_C(  1938929497),  INT32_C(  1944363136), -INT32_C(  1829197097),  INT32_C(  1689222149), -INT32_C(  1943286051), -INT32_C(  1237355054),  INT32_C(  1324256853),
+       INT32_C(    56812891), -INT32_C(  1383083731),  INT32_C(  1226863473),  INT32_C(   601561118),  INT32_C(  1921485461),  INT32_C(   721335128),  INT32_C(  2111847720),  INT32_C(   667668172),
+      -INT32_C(   517329485),  INT32_C(  1888401918),  INT32_C(  1270460205),  INT32_C(  1550750919),  INT32_C(  1993274910), -INT32_C(   777990743), -INT32_C(   699498230),  INT32_C(    66984271),
+       INT32_C(  1172580422),  INT32_C(   263549666), -INT32_C(   379949535),  INT32_C(   541444098),  INT32_C(  1737888958), -INT32_C(   348637471),  INT32_C(   130188983), -INT32_C(   435502945),
+      -INT32_C(   903090456), -INT32_C(  2099650464),  INT32_C(  1349202766), -INT32_C(  1167019780), -INT32_C(  1524496700), -INT32_C(   191800772), -INT32_C(  2131012639), -INT32_C(    77200109),
+       INT32_C(  1405522419), -INT32_C(  1076519055), -INT32_C(   821083949), -INT32_C(  1249280015), -INT32_C(  1034179707), -INT32_C(   407442426),  INT32_C(  1382527295), -INT32_C(  1454518602),
+      -INT32_C(   772009121), -INT32_C(  2037329229),  INT32_C(    55943186), -INT32_C(  1514545633), -INT32_C(  1872292726),  INT32_C(  1064770816), -INT32_C(  2070815026),  INT32_C(   204332716),
+      -INT32_C(  1512232462),  INT32_C(   237727227),  INT32_C(   756121613), -INT32_C(   388838818), -INT32_C(   562546210),  INT32_C(   605941590),  INT32_C(  2057875150),  INT32_C(  2139542925),
+      -INT32_C(    98278402), -INT32_C(   569880623),  INT32_C(   755702223), -INT32_C(  1038688796),  INT32_C(  1822526998),  INT32_C(  1284554366), -INT32_C(    87672723),  INT32_C(   209276173),
+      -INT32_C(  2130272848), -INT32_C(  1151332628),  INT32_C(   199781159),  INT32_C(  1607401033),  INT32_C(   197947277), -INT32_C(  1705550803), -INT32_C(  1567351403),  INT32_C(   464391530),
+      -INT32_C(  1768115030), -INT32_C(   363725630), -INT32_C(  1309328792), -INT32_C(   988757192),  INT32_C(  1624300594), -INT32_C(   822466759), -INT32_C(  1351577787),  INT32_C(  1204428700),
+      -INT32_C(  1763874861), -INT32_C(   880791709), -INT32_C(  1585678999) };
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(           656012738),  INT64_C(          1829092212),
+      -INT64_C(             6978670),  INT64_C(                   0), -INT64_C(          2098901143),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(          1303837521),  INT64_C(           944759011),
+       INT64_C(                   0), -INT64_C(          1938929497),  INT64_C(          1944363136),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(          1324256853),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(          1226863473),  INT64_C(           601561118),
+       INT64_C(          1921485461),  INT64_C(           721335128),  INT64_C(          2111847720),  INT64_C(                   0),
+      -INT64_C(           517329485),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(          1550750919),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(           699498230),  INT64_C(            66984271),
+       INT64_C(          1172580422),  INT64_C(                   0), -INT64_C(           379949535),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(           348637471),  INT64_C(                   0), -INT64_C(           435502945),
+       INT64_C(                   0), -INT64_C(          2099650464),  INT64_C(          1349202766),  INT64_C(                   0),
+      -INT64_C(          1524496700), -INT64_C(           191800772),  INT64_C(                   0), -INT64_C(            77200109),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(          1249280015),
+       INT64_C(                   0), -INT64_C(           407442426),  INT64_C(                   0), -INT64_C(          1454518602),
+      -INT64_C(           772009121), -INT64_C(          2037329229),  INT64_C(                   0), -INT64_C(          1514545633),
+      -INT64_C(          1872292726),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(          1512232462),  INT64_C(           237727227),  INT64_C(                   0), -INT64_C(           388838818),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(          2057875150),  INT64_C(          2139542925),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(           755702223),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(          1284554366), -INT64_C(            87672723),  INT64_C(           209276173),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(           199781159),  INT64_C(          1607401033),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(           988757192),
+       INT64_C(          1624300594),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(          1763874861), -INT64_C(           880791709),  INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1sw_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int32_t a[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1sw_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1sw_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 4658917065531642063), -INT64_C( 1145552219134693009), -INT64_C( 9005376221233044355), -INT64_C( 4346473294021008325),
+       INT64_C( 5531548291112216937),  INT64_C( 4554794822665737458), -INT64_C( 7920892385531273850), -INT64_C( 2481883115276584390),
+       INT64_C( 3055593632110360382), -INT64_C( 7621316452021162438),  INT64_C( 1903678905372805762),  INT64_C( 2649652490876113268),
+      -INT64_C( 8714563900466550868), -INT64_C( 6378295381561475115),  INT64_C( 5639611580141314376),  INT64_C( 5352523338767280445),
+       INT64_C(  177396502823339682),  INT64_C(   38389138741262780),  INT64_C( 3615384399809939459),  INT64_C(   35638874996040342),
+      -INT64_C( 6461989358756910045), -INT64_C( 7055153132463507104),  INT64_C( 4845495710289510424),  INT64_C( 6082662364295435274),
+       INT64_C( 2248131566064982433), -INT64_C( 2203580964046128847), -INT64_C( 7386135870150154353), -INT64_C( 8339140473901615424),
+       INT64_C( 1415057044646980292), -INT64_C( 5211427654701426173), -INT64_C( 8693509928424072399), -INT64_C( 8367479443857843096),
+       INT64_C( 5016360459302795432), -INT64_C(  546132065354875765),  INT64_C( 4226650039222099802), -INT64_C( 8736581000956665745),
+       INT64_C(  931591470300843877),  INT64_C( 1867072719116369705),  INT64_C( 2636544999947936395), -INT64_C(  619496110375164925),
+       INT64_C( 5654422320704288746), -INT64_C( 1197351239248103286), -INT64_C( 8961351271306191671),  INT64_C(  184590511458548742),
+       INT64_C( 4879339830786207043), -INT64_C( 1913205085462268898), -INT64_C( 6373430613220475253),  INT64_C(   80166209265332739),
+      -INT64_C( 8216782955508823301), -INT64_C(  138060782325693420), -INT64_C( 8969034652626421440), -INT64_C( 8050260662898801016),
+      -INT64_C( 1999249892517301948),  INT64_C( 1383215122156376513),  INT64_C( 6387929255358184099),  INT64_C( 4784765636324508737),
+      -INT64_C( 6319615809598149993),  INT64_C( 3345346085598814343),  INT64_C( 2121750523669471560), -INT64_C( 8251621503163756484),
+       INT64_C( 3428154835616428292), -INT64_C( 4226074658337034335), -INT64_C( 2354730993264448680), -INT64_C( 6637296914237143712),
+      -INT64_C( 5053565341971589370), -INT64_C( 5128968447645685616),  INT64_C( 7019772620567261673),  INT64_C( 2289686893328565380),
+       INT64_C(  379054939475694705),  INT64_C( 5632846883330336532), -INT64_C( 2668588015993349995), -INT64_C( 5043535389864907063),
+      -INT64_C( 8101546389470458089),  INT64_C( 2116742986816791469),  INT64_C( 5221830857554410054),  INT64_C( 5790550743130469722),
+      -INT64_C( 3240781770364509957),  INT64_C( 9130842874624411921),  INT64_C( 8090314408067820415), -INT64_C( 7597449858788397049),
+      -INT64_C( 1438878253031003121), -INT64_C( 5633655472016462564), -INT64_C( 8777808694689665881), -INT64_C( 4569087978705108635),
+      -INT64_C( 3203749595314740029), -INT64_C(  877928925825134612), -INT64_C( 2672077733597446171), -INT64_C( 3849888254008774367),
+       INT64_C( 8332487826191452183) };
+  static const int32_t a[] =
+    { -INT32_C(   554013905),  INT32_C(  1092475146), -INT32_C(  1693660853),  INT32_C(  1630225120),  INT32_C(  1080560703),  INT32_C(  1128649982), -INT32_C(  1901784052),  INT32_C(  1705814837),
+       INT32_C(   558081814), -INT32_C(   882744960),  INT32_C(   174485034), -INT32_C(   278097232), -INT32_C(  1674521442), -INT32_C(  1260423768), -INT32_C(  1102936951),  INT32_C(  1176759855),
+       INT32_C(   359098261), -INT32_C(   220149304), -INT32_C(   386119880),  INT32_C(  2010671321), -INT32_C(   468514756),  INT32_C(   110686845), -INT32_C(  1497048458),  INT32_C(  1592584393),
+       INT32_C(   393499471),  INT32_C(  1409897500),  INT32_C(  1950156187), -INT32_C(  1427434130), -INT32_C(  1701839331),  INT32_C(  1738549232), -INT32_C(   888314878), -INT32_C(  1691748020),
+       INT32_C(  1756536140), -INT32_C(  1916945422),  INT32_C(   788724417),  INT32_C(   752479503), -INT32_C(   590976788), -INT32_C(  1841076592),  INT32_C(   391991498), -INT32_C(  1783462327),
+       INT32_C(   385770788), -INT32_C(   509363424), -INT32_C(  1005541963),  INT32_C(  2146495123), -INT32_C(   497306030), -INT32_C(   428564708),  INT32_C(   972935663),  INT32_C(  2093920344),
+       INT32_C(   898812949),  INT32_C(  1008153991),  INT32_C(  1845503963),  INT32_C(  1693315089), -INT32_C(  1035581274), -INT32_C(   676742169), -INT32_C(   468670836),  INT32_C(  1801510486),
+       INT32_C(   849474219),  INT32_C(    57653288), -INT32_C(   244224033),  INT32_C(   106258016), -INT32_C(  1899390042), -INT32_C(   479890858),  INT32_C(  1875342616), -INT32_C(    19257261),
+       INT32_C(  1110539034),  INT32_C(   323330099),  INT32_C(  1862579727), -INT32_C(  1149871852),  INT32_C(  1263091700), -INT32_C(   919687503),  INT32_C(  1983444259),  INT32_C(   947196701),
+      -INT32_C(  1032149362),  INT32_C(  1440071750), -INT32_C(  1949968010),  INT32_C(   642136882),  INT32_C(   728862586),  INT32_C(  1626644285), -INT32_C(  1294586475), -INT32_C(   823506112),
+       INT32_C(   932210161), -INT32_C(  1685232347),  INT32_C(  1881559614),  INT32_C(   127364237),  INT32_C(   942803195),  INT32_C(  1033381544), -INT32_C(  1813024941), -INT32_C(  1402807622),
+       INT32_C(  1692660287) };
+  static const uint64_t e[] =
+    { UINT64_C(18446744073155537711), UINT64_C(          1092475146), UINT64_C(18446744072015890763), UINT64_C(          1630225120),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744071807767564), UINT64_C(          1705814837),
+      UINT64_C(                   0), UINT64_C(18446744072826806656), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18446744072035030174), UINT64_C(18446744072449127848), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18446744073241036860), UINT64_C(           110686845), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(          1409897500), UINT64_C(          1950156187), UINT64_C(18446744072282117486),
+      UINT64_C(                   0), UINT64_C(          1738549232), UINT64_C(18446744072821236738), UINT64_C(18446744072017803596),
+      UINT64_C(                   0), UINT64_C(18446744071792606194), UINT64_C(                   0), UINT64_C(           752479503),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744071926089289),
+      UINT64_C(                   0), UINT64_C(18446744073200188192), UINT64_C(18446744072704009653), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(18446744073280986908), UINT64_C(           972935663), UINT64_C(                   0),
+      UINT64_C(           898812949), UINT64_C(          1008153991), UINT64_C(          1845503963), UINT64_C(          1693315089),
+      UINT64_C(18446744072673970342), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(           849474219), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(           106258016),
+      UINT64_C(                   0), UINT64_C(18446744073229660758), UINT64_C(          1875342616), UINT64_C(18446744073690294355),
+      UINT64_C(          1110539034), UINT64_C(           323330099), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(          1983444259), UINT64_C(           947196701),
+      UINT64_C(18446744072677402254), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(           728862586), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18446744072886045504),
+      UINT64_C(           932210161), UINT64_C(18446744072024319269), UINT64_C(          1881559614), UINT64_C(           127364237),
+      UINT64_C(           942803195), UINT64_C(          1033381544), UINT64_C(18446744071896526675), UINT64_C(18446744072306743994),
+      UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1sw_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  int32_t a[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1sw_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1uw_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 8364157338473474673),  INT64_C( 5024007342984261391), -INT64_C( 3507563107230678088),  INT64_C( 3006146818776376846),
+       INT64_C( 2491150378329737167), -INT64_C( 5864744490798606009), -INT64_C( 8358374702166254527), -INT64_C( 6845191252094757060),
+       INT64_C(  917110094467460229), -INT64_C( 4758335047014858925),  INT64_C( 1001752749101005532), -INT64_C( 5675690929942155833),
+       INT64_C( 8080305579895677777),  INT64_C( 7096740106089301570),  INT64_C( 2470402908323867497),  INT64_C( 7182105687365528783),
+       INT64_C( 4136447371585909978),  INT64_C( 4038449921831477027),  INT64_C( 4061325925096277983), -INT64_C( 1631466279821764377),
+      -INT64_C( 7781297177105476142),  INT64_C( 5651252749891664743), -INT64_C( 9101522395305811953), -INT64_C( 7784799880731761667),
+      -INT64_C( 8813437688811235414),  INT64_C( 5051394147877645916), -INT64_C( 8852828334850137336),  INT64_C( 2208603798909394514),
+      -INT64_C( 4538243703340661664), -INT64_C( 1128810421234581543), -INT64_C( 3073504968862133173), -INT64_C( 3105075310800344234),
+      -INT64_C( 1749272357977840750),  INT64_C( 4174077018989020693), -INT64_C( 8234720627940097952), -INT64_C( 4496773658322689968),
+       INT64_C( 6221847411107097187), -INT64_C(  369224136484761928), -INT64_C( 6807871082400453440), -INT64_C( 9212679160036205259),
+       INT64_C(  540231084662709736), -INT64_C( 3157994125099412585), -INT64_C( 3067706024408642950), -INT64_C( 5130903101750259154),
+      -INT64_C( 7092782361210667973),  INT64_C( 5051908261822807859),  INT64_C( 7456412014329652997),  INT64_C( 5537595828873638737),
+       INT64_C( 5682812771072719418), -INT64_C( 5928231726217843545), -INT64_C( 7117996060046078825), -INT64_C( 6711321774111397505),
+      -INT64_C( 4342385811868437678), -INT64_C( 7367904374645370517),  INT64_C( 6676481843822924222),  INT64_C( 5806206437133411722),
+      -INT64_C( 6963557657013815940),  INT64_C( 4928751661699208139), -INT64_C(  378876930628333437), -INT64_C( 1177551173462480550),
+      -INT64_C( 6140126069329009163),  INT64_C( 8016651346637192055), -INT64_C( 2443047203551277395),  INT64_C( 8761997736405238838),
+       INT64_C( 8848565029086306115), -INT64_C( 3584100997523946522), -INT64_C( 2979406444636663227), -INT64_C(  142400243915301623),
+      -INT64_C(  309643278244796106),  INT64_C( 2747214332638931505),  INT64_C( 1988504242808098083),  INT64_C( 7290675984668890995),
+       INT64_C( 7811583968869764696),  INT64_C( 7603166089244980860),  INT64_C( 9014451676356834284), -INT64_C( 3859628371316325668),
+      -INT64_C( 2535914303849558490),  INT64_C( 6378711619756199381),  INT64_C( 5960073710430236975),  INT64_C( 6948715827316941106),
+       INT64_C( 1951907215036294874),  INT64_C( 4315218150723899166), -INT64_C( 2794999618156087186),  INT64_C( 4046181207023391371),
+      -INT64_C( 7497780372731402094),  INT64_C( 6061286438675229143),  INT64_C( 5169128229859529275), -INT64_C( 5145587809351026176),
+       INT64_C( 7650633433081645595), -INT64_C( 8222047546620686677), -INT64_C( 8358631929776431619),  INT64_C( 6648582163659427174),
+       INT64_C(  110651921587623052),  INT64_C( 4488532202376910443),  INT64_C( 5597402479675816598), -INT64_C( 6367775295640332283),
+       INT64_C( 1966190330877743858), -INT64_C( 1467009828422886363), -INT64_C( 7489281036521792548), -INT64_C(  498352513869813422),
+       INT64_C( 5826966512929463057), -INT64_C( 5429269839334623897), -INT64_C( 4601966960379972361), -INT64_C( 8038288174441627791),
+      -INT64_C( 6441785471947132130), -INT64_C( 6669819311124491804), -INT64_C( 2239327575808808770),  INT64_C( 8961542437274720847),
+      -INT64_C( 4511656995718844546) };
+  static const uint32_t a[] =
+    { UINT32_C(2534022524), UINT32_C( 911443572), UINT32_C(3263871491), UINT32_C( 449994707), UINT32_C( 290730763), UINT32_C(1815880023), UINT32_C(3609345275), UINT32_C(2091660800),
+      UINT32_C(3356735059), UINT32_C(1073636924), UINT32_C(4093741089), UINT32_C(4061058279), UINT32_C(1594057223), UINT32_C(2144026756), UINT32_C(2086137212), UINT32_C(2012807971),
+      UINT32_C(4114549945), UINT32_C(2486451571), UINT32_C(2911385029), UINT32_C( 295671305), UINT32_C(2104534009), UINT32_C(1610365923), UINT32_C(1289442088), UINT32_C( 264492118),
+      UINT32_C(1409549025), UINT32_C(  82327615), UINT32_C(2008117358), UINT32_C(4287123718), UINT32_C(3615291636), UINT32_C(1547073843), UINT32_C( 598217164), UINT32_C(3341970406),
+      UINT32_C(2887464813), UINT32_C(3719299951), UINT32_C(2035638899), UINT32_C(2809781683), UINT32_C( 159315414), UINT32_C( 996521070), UINT32_C(2875067845), UINT32_C(3849490552),
+      UINT32_C( 932285895), UINT32_C(  51659408), UINT32_C(1467836836), UINT32_C( 503248455), UINT32_C(1512471787), UINT32_C(4120218672), UINT32_C( 312603545), UINT32_C(1274483587),
+      UINT32_C( 830638497), UINT32_C(1865782987), UINT32_C(1204204032), UINT32_C(2472854696), UINT32_C(1894615616), UINT32_C(2959442454), UINT32_C(4190242421), UINT32_C(3141843226),
+      UINT32_C( 233621058), UINT32_C(1551638876), UINT32_C(2074297043), UINT32_C(1175389958), UINT32_C(2830564498), UINT32_C(4099415167), UINT32_C(1022171682), UINT32_C( 385298900),
+      UINT32_C(1411704055), UINT32_C(3652231173), UINT32_C(3914618083), UINT32_C(3979371355), UINT32_C(3751208544), UINT32_C( 634646018), UINT32_C(3714171145), UINT32_C(3941816818),
+      UINT32_C(1111365437), UINT32_C(2602299064), UINT32_C(2659479618), UINT32_C( 864793811), UINT32_C(2635211163), UINT32_C( 432203280), UINT32_C(2583045287), UINT32_C(3129207165),
+      UINT32_C(3120349441), UINT32_C(4065597616), UINT32_C(1536219272), UINT32_C( 680467597), UINT32_C(1304797501), UINT32_C( 778471559), UINT32_C( 700996780), UINT32_C(1206078278),
+      UINT32_C(3170950925), UINT32_C(2142196983), UINT32_C(3118153772), UINT32_C(2581686876), UINT32_C(2481432331), UINT32_C(3686878511), UINT32_C(4026829226), UINT32_C(3795314645),
+      UINT32_C(3198105542), UINT32_C(3074248331), UINT32_C(3933280398), UINT32_C(2391036546), UINT32_C( 673278969), UINT32_C(1644421816), UINT32_C(1095894892), UINT32_C(3039005166),
+      UINT32_C(1265877696), UINT32_C(2667819024), UINT32_C(1267299529), UINT32_C(3235450310), UINT32_C( 837352056) };
+  static const int64_t e[] =
+    {  INT64_C(          2534022524),  INT64_C(                   0),  INT64_C(          3263871491),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(          1815880023),  INT64_C(          3609345275),  INT64_C(          2091660800),
+       INT64_C(                   0),  INT64_C(          1073636924),  INT64_C(                   0),  INT64_C(          4061058279),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(           295671305),
+       INT64_C(          2104534009),  INT64_C(                   0),  INT64_C(          1289442088),  INT64_C(           264492118),
+       INT64_C(          1409549025),  INT64_C(                   0),  INT64_C(          2008117358),  INT64_C(                   0),
+       INT64_C(          3615291636),  INT64_C(          1547073843),  INT64_C(           598217164),  INT64_C(          3341970406),
+       INT64_C(          2887464813),  INT64_C(                   0),  INT64_C(          2035638899),  INT64_C(          2809781683),
+       INT64_C(                   0),  INT64_C(           996521070),  INT64_C(          2875067845),  INT64_C(          3849490552),
+       INT64_C(                   0),  INT64_C(            51659408),  INT64_C(          1467836836),  INT64_C(           503248455),
+       INT64_C(          1512471787),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(          1865782987),  INT64_C(          1204204032),  INT64_C(          2472854696),
+       INT64_C(          1894615616),  INT64_C(          2959442454),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(           233621058),  INT64_C(                   0),  INT64_C(          2074297043),  INT64_C(          1175389958),
+       INT64_C(          2830564498),  INT64_C(                   0),  INT64_C(          1022171682),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(          3652231173),  INT64_C(          3914618083),  INT64_C(          3979371355),
+       INT64_C(          3751208544),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(           864793811),
+       INT64_C(          2635211163),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(          1536219272),  INT64_C(                   0),
+       INT64_C(          1304797501),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(          1206078278),
+       INT64_C(                   0),  INT64_C(          2142196983),  INT64_C(          3118153772),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(          3795314645),
+       INT64_C(                   0),  INT64_C(          3074248331),  INT64_C(          3933280398),  INT64_C(          2391036546),
+       INT64_C(                   0),  INT64_C(          1644421816),  INT64_C(          1095894892),  INT64_C(          3039005166),
+       INT64_C(          1265877696),  INT64_C(          2667819024),  INT64_C(          1267299529),  INT64_C(                   0),
+       INT64_C(           837352056) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1uw_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint32_t a[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1uw_s64(pv, &(a[i]));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1uw_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(  990111896515598301), -INT64_C( 4882276023429768448), -INT64_C( 3349964063890226159), -INT64_C( 2131715828721538804),
+       INT64_C( 2428281466220361287),  INT64_C( 9108344899896984024),  INT64_C( 8888919770444326428),  INT64_C( 4185365722940920947),
+      -INT64_C( 6602367435960299746), -INT64_C( 1415899599682438802), -INT64_C( 2483785316570848868),  INT64_C(  744261534402774054),
+       INT64_C( 7666719744196104180),  INT64_C(  495008290720625697),  INT64_C( 5586883729111012416), -INT64_C( 5614937889819879395),
+       INT64_C( 2698175163571330058), -INT64_C( 7494284075548100723), -INT64_C( 4126200329513332663), -INT64_C( 1597964370295381149),
+      -INT64_C( 6095515313029233345), -INT64_C( 4898332602057720040),  INT64_C( 8440000867195439024),  INT64_C( 1428882241183150092),
+       INT64_C( 4428937452611617965),  INT64_C( 7669262626566445374), -INT64_C( 8178286775622198535),  INT64_C( 3150917190886692307),
+       INT64_C(  969802031549517842), -INT64_C( 3699375233577311866),  INT64_C( 2654967982682762695), -INT64_C( 5614434438561967764),
+      -INT64_C(  111922070020289643),  INT64_C( 2675392570984378753), -INT64_C( 4987376709227514028), -INT64_C( 5842654048584166248),
+      -INT64_C( 5459341093653719867), -INT64_C( 5315610537734145353), -INT64_C( 8491496478066628065),  INT64_C( 5440256569931648184),
+      -INT64_C( 3429275501577333888), -INT64_C( 5163901879508897730), -INT64_C( 8266270436113337908),  INT64_C( 3957500474019416602),
+       INT64_C( 8600275741691180144),  INT64_C( 3392175213542588610), -INT64_C( 6737326184516994786),  INT64_C( 3182688946475949631),
+       INT64_C( 2905120169061061794), -INT64_C(  873251008166008752),  INT64_C( 4826000640249876176),  INT64_C(  877184234840079428),
+       INT64_C( 4685213598810038647), -INT64_C( 1267247493306677088), -INT64_C(  294634246893055837), -INT64_C(  364466647387659909),
+      -INT64_C( 5748040008915757048), -INT64_C( 6453218446285590940),  INT64_C( 8255441128464955360), -INT64_C( 4839599712735032232),
+      -INT64_C( 1233158871615951583),  INT64_C( 8703175047452362782), -INT64_C( 6627996500870883942), -INT64_C( 4063278592870622163),
+       INT64_C( 6952390429161050627),  INT64_C( 7706864922600271331), -INT64_C( 3437090237682285731),  INT64_C( 2722510783198121308),
+       INT64_C( 9097603969306509727),  INT64_C( 7518176887936041499), -INT64_C( 5952246528519024143),  INT64_C(  248955147834562092),
+       INT64_C( 8093573630424000312),  INT64_C( 3124566008725720296), -INT64_C(  432022525447213566),  INT64_C( 6963054476748501051),
+      -INT64_C( 7734502810779875612), -INT64_C( 5243908824829000493),  INT64_C( 6420174967791090002),  INT64_C(  307257566133969595),
+      -INT64_C( 3431769313810417889),  INT64_C( 2114466188411987948),  INT64_C( 2992455508633149968),  INT64_C( 3953403011745480377),
+      -INT64_C( 1183214133290394682), -INT64_C( 7407884236594580920),  INT64_C( 9142956804631129674),  INT64_C(  295887645246484173),
+      -INT64_C( 4160660312878998448),  INT64_C(  356360215515026127), -INT64_C( 3045102915254633862), -INT64_C( 7435208476156357491),
+      -INT64_C( 4236429342304134927), -INT64_C( 7728722203560243201), -INT64_C( 6365679628390794294),  INT64_C( 2991871434943586980),
+      -INT64_C( 7019196887205383717), -INT64_C( 8103359168832359204), -INT64_C( 7831184777571836272), -INT64_C( 2031961222684818067),
+       INT64_C( 1059271916335162743), -INT64_C( 5669310510520792066),  INT64_C( 3130474251268371694),  INT64_C( 7952967678225871218),
+       INT64_C( 6576442229337100803), -INT64_C( 4101529281654535870), -INT64_C( 8138543158982775004),  INT64_C( 9182110101342445063),
+       INT64_C( 7724790644466839930), -INT64_C( 1809634776948256447), -INT64_C( 6557565836707920046), -INT64_C( 1463369230335145802),
+      -INT64_C( 6874756521347881470), -INT64_C( 7282430239220013753),  INT64_C( 5144526471914174755),  INT64_C( 2047777844099680272),
+       INT64_C( 7678881610603114129),  INT64_C(  731381835639245380) };
+  static const uint32_t a[] =
+    { UINT32_C(2649069855), UINT32_C(   1106332), UINT32_C( 740974914), UINT32_C(2211460249), UINT32_C(3897582541), UINT32_C(4076091436), UINT32_C(3186068365), UINT32_C(4169035224),
+      UINT32_C(2727699206), UINT32_C(2258871620), UINT32_C(2679360774), UINT32_C(3458433793), UINT32_C( 313947110), UINT32_C( 956607148), UINT32_C( 251128629), UINT32_C(1594258776),
+      UINT32_C( 469867480), UINT32_C(1201906752), UINT32_C(1944475249), UINT32_C(3208710617), UINT32_C( 701626493), UINT32_C(3630355874), UINT32_C( 434526656), UINT32_C(2792942798),
+      UINT32_C(3351476615), UINT32_C(2400085534), UINT32_C(2499999164), UINT32_C(2069120254), UINT32_C(3735299388), UINT32_C(3132491770), UINT32_C( 802397280), UINT32_C( 265636744),
+      UINT32_C(3822557381), UINT32_C(3128092158), UINT32_C(3645863386), UINT32_C(4115964857), UINT32_C(3268671944), UINT32_C(1618840064), UINT32_C(2945404966), UINT32_C(1639867804),
+      UINT32_C(4232353277), UINT32_C(1438037627), UINT32_C(3828221483), UINT32_C(1926857641), UINT32_C(2083827068), UINT32_C(1574744375), UINT32_C(2651614210), UINT32_C(3472870353),
+      UINT32_C(3687465824), UINT32_C( 624001529), UINT32_C( 805920647), UINT32_C(1587733474), UINT32_C(3353008016), UINT32_C(2317662088), UINT32_C(4096274723), UINT32_C(1556228092),
+      UINT32_C(1681427818), UINT32_C(2508810510), UINT32_C(2881852104), UINT32_C(  84502645), UINT32_C(3352093759), UINT32_C(3193106843), UINT32_C( 515013154), UINT32_C( 209351842),
+      UINT32_C( 259043841), UINT32_C(3836016923), UINT32_C(  26176140), UINT32_C( 285710546), UINT32_C( 400085884), UINT32_C(3872729796), UINT32_C(1191479205), UINT32_C(4250107900),
+      UINT32_C(1292747825), UINT32_C(1227993533), UINT32_C(3981164571), UINT32_C(3590214232), UINT32_C(3941390117), UINT32_C(2798699009), UINT32_C(1173214537), UINT32_C(2235777364),
+      UINT32_C(3268562949), UINT32_C( 487326465), UINT32_C( 470439875), UINT32_C(3471903145), UINT32_C(3786989024), UINT32_C(3918039455), UINT32_C(2989389150), UINT32_C(3140972982),
+      UINT32_C(3279817409), UINT32_C(3521153549), UINT32_C(2330847969), UINT32_C(3545816819), UINT32_C(1538593211), UINT32_C(4165221786), UINT32_C(1772778162), UINT32_C(2770657764),
+      UINT32_C(4184384235), UINT32_C( 231360556), UINT32_C( 647477043), UINT32_C(1358622869), UINT32_C(2611719937), UINT32_C(2660495340), UINT32_C(1174879586), UINT32_C( 183184414),
+      UINT32_C(4211299534), UINT32_C(3473460636), UINT32_C( 435593348), UINT32_C(2439639184), UINT32_C(2334922143), UINT32_C(1714011908), UINT32_C( 447492604), UINT32_C( 723818589),
+      UINT32_C(2284201964), UINT32_C(2019045364), UINT32_C(1603358415), UINT32_C(3723557694), UINT32_C( 342367248), UINT32_C(3615199707) };
+  static const uint64_t e[] =
+    { UINT64_C(          2649069855), UINT64_C(             1106332), UINT64_C(           740974914), UINT64_C(          2211460249),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(          2727699206), UINT64_C(          2258871620), UINT64_C(          2679360774), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(          1594258776),
+      UINT64_C(                   0), UINT64_C(          1201906752), UINT64_C(          1944475249), UINT64_C(          3208710617),
+      UINT64_C(           701626493), UINT64_C(          3630355874), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(          2499999164), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(          3132491770), UINT64_C(                   0), UINT64_C(           265636744),
+      UINT64_C(          3822557381), UINT64_C(                   0), UINT64_C(          3645863386), UINT64_C(          4115964857),
+      UINT64_C(          3268671944), UINT64_C(          1618840064), UINT64_C(          2945404966), UINT64_C(                   0),
+      UINT64_C(          4232353277), UINT64_C(          1438037627), UINT64_C(          3828221483), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(          2651614210), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(           624001529), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(          2317662088), UINT64_C(          4096274723), UINT64_C(          1556228092),
+      UINT64_C(          1681427818), UINT64_C(          2508810510), UINT64_C(                   0), UINT64_C(            84502645),
+      UINT64_C(          3352093759), UINT64_C(                   0), UINT64_C(           515013154), UINT64_C(           209351842),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(            26176140), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(          1191479205), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(          3981164571), UINT64_C(                   0),
+      UINT64_C(          3941390117), UINT64_C(          2798699009), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(          3268562949), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(          3786989024), UINT64_C(          3918039455), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(          3279817409), UINT64_C(                   0), UINT64_C(          2330847969), UINT64_C(          3545816819),
+      UINT64_C(          1538593211), UINT64_C(          4165221786), UINT64_C(          1772778162), UINT64_C(                   0),
+      UINT64_C(          4184384235), UINT64_C(           231360556), UINT64_C(           647477043), UINT64_C(          1358622869),
+      UINT64_C(                   0), UINT64_C(          2660495340), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(          3473460636), UINT64_C(           435593348), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(          1714011908), UINT64_C(           447492604), UINT64_C(           723818589),
+      UINT64_C(          2284201964), UINT64_C(          2019045364), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1uw_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint32_t a[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1uw_u64(pv, &(a[i]));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_s32index_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(    60665385),  INT32_C(   555445226),  INT32_C(    73928746),  INT32_C(  1538966381), -INT32_C(  1744025958),  INT32_C(  1482022340), -INT32_C(  2060796168), -INT32_C(  2068632229),
+      -INT32_C(   980987685), -INT32_C(   437869893),  INT32_C(   535449266), -INT32_C(  1401183214), -INT32_C(  1354463254),  INT32_C(  1560779108), -INT32_C(  1277021864),  INT32_C(   976786783),
+      -INT32_C(  1593786395),  INT32_C(   344385122),  INT32_C(  1194618933), -INT32_C(      807148), -INT32_C(  1683081418),  INT32_C(   687388112),  INT32_C(  1188879079),  INT32_C(  1434457200),
+       INT32_C(   905347283), -INT32_C(  1672839833),  INT32_C(    48463597),  INT32_C(  1661064749), -INT32_C(   570511603),  INT32_C(  1258747492),  INT32_C(  1100079825), -INT32_C(   912911626),
+      -INT32_C(   100692590), -INT32_C(   141211382), -INT32_C(   184977209),  INT32_C(  1532492366),  INT32_C(   238638761),  INT32_C(   492388172),  INT32_C(   392096545), -INT32_C(  1881082371),
+      -INT32_C(  1937121406), -INT32_C(   276619736), -INT32_C(   438076009),  INT32_C(   557923191), -INT32_C(   584090991), -INT32_C(   621049671),  INT32_C(  1894865267), -INT32_C(   805252786),
+      -INT32_C(   648246863),  INT32_C(  1053417639), -INT32_C(   735794083),  INT32_C(  2029348327), -INT32_C(  1739184929),  INT32_C(   544362925), -INT32_C(   107912278), -INT32_C(   439774924),
+      -INT32_C(  1044437478),  INT32_C(  1660979206),  INT32_C(   473375796),  INT32_C(  1754541449), -INT32_C(    33494447), -INT32_C(   434146757),  INT32_C(   165654741),  INT32_C(  1542432833),
+      -INT32_C(   736317746),  INT32_C(  1781996598), -INT32_C(   913936576), -INT32_C(   315548772),  INT32_C(  1105998085),  INT32_C(  2015824803), -INT32_C(    58587461),  INT32_C(  2102882734),
+       INT32_C(  1431401247), -INT32_C(   792753776), -INT32_C(  1801828616),  INT32_C(  1719782241), -INT32_C(  1599640067),  INT32_C(   857329272), -INT32_C(  2094031916),  INT32_C(   721454604),
+      -INT32_C(  1971301894), -INT32_C(   765837350), -INT32_C(   429460347), -INT32_C(  1118967616), -INT32_C(   832703403), -INT32_C(  1761511741),  INT32_C(   488255761), -INT32_C(  1320674633),
+       INT32_C(  1178323052), -INT32_C(  1927703032),  INT32_C(  1249148810), -INT32_C(  1123565209),  INT32_C(  2022401461), -INT32_C(   317682469),  INT32_C(  1963600573), -INT32_C(  1322888379),
+       INT32_C(   603415067), -INT32_C(  2102325000), -INT32_C(   137550448), -INT32_C(  1682647834),  INT32_C(   353648441), -INT32_C(  1996348212), -INT32_C(  1812067250),  INT32_C(  2068063583),
+       INT32_C(  2141076615), -INT32_C(   603893940),  INT32_C(  1523895924), -INT32_C(   587822941), -INT32_C(  1796142392),  INT32_C(  2082337582),  INT32_C(  1594891264), -INT32_C(   925215679),
+      -INT32_C(   582518384),  INT32_C(  1035552968), -INT32_C(  1164473065), -INT32_C(   560558826), -INT32_C(   982349673),  INT32_C(  2067959675), -INT32_C(   321170773),  INT32_C(   934589862),
+      -INT32_C(   149619922),  INT32_C(  1530187076),  INT32_C(  1897253723), -INT32_C(   263214247), -INT32_C(  1346977485), -INT32_C(    64292784), -INT32_C(   253229750), -INT32_C(   383279685),
+      -INT32_C(   589284456),  INT32_C(  1681331209),  INT32_C(   970280160),  INT32_C(   724116728),  INT32_C(   903536613),  INT32_C(   556860887), -INT32_C(   988669430),  INT32_C(  1336883639),
+       INT32_C(  2116849525), -INT32_C(  2065538140), -INT32_C(  1463961680), -INT32_C(  1059854629), -INT32_C(  1644843322) };
+  static const int32_t a[] =
+    {  INT32_C(   164812148),  INT32_C(  1062204558), -INT32_C(  1248705992),  INT32_C(   881832442),  INT32_C(   832742213),  INT32_C(  1923284084), -INT32_C(   634913696), -INT32_C(   201243264),
+      -INT32_C(  1442917349),  INT32_C(    32001480), -INT32_C(  1984529777),  INT32_C(  1891452203),  INT32_C(  1570922728), -INT32_C(  1127267236), -INT32_C(  1063782848),  INT32_C(  1471518780),
+       INT32_C(   889238380), -INT32_C(  1875449856), -INT32_C(  1910903709),  INT32_C(   452974385), -INT32_C(  1820876489),  INT32_C(   625952485),  INT32_C(  2028332604), -INT32_C(   338716033),
+       INT32_C(  1310773069),  INT32_C(   467556024),  INT32_C(  1957295938),  INT32_C(    93235406),  INT32_C(   781714761), -INT32_C(  2024544181),  INT32_C(  1291860430),  INT32_C(   557436883),
+       INT32_C(  1466915231), -INT32_C(   227390032),  INT32_C(   325458756),  INT32_C(   219739332),  INT32_C(  1144828409),  INT32_C(  1741459353), -INT32_C(  1665807160),  INT32_C(   985525915),
+      -INT32_C(   141480889), -INT32_C(  1108737159), -INT32_C(   472887265),  INT32_C(  1055975749),  INT32_C(   864234650), -INT32_C(  2070261828), -INT32_C(  1239396581), -INT32_C(  2047746755),
+      -INT32_C(  2105769463), -INT32_C(  1522506106), -INT32_C(    58191689), -INT32_C(  1824884487),  INT32_C(  1640414629),  INT32_C(   669344012), -INT32_C(   287439184), -INT32_C(   311177245),
+      -INT32_C(   680530095),  INT32_C(   226275158), -INT32_C(  1190591296),  INT32_C(   575488893),  INT32_C(   226693889),  INT32_C(   624257140),  INT32_C(  1376981870),  INT32_C(   859801314) };
+  static const int32_t b[] =
+    {  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          21),  INT32_C(   268435456), -INT32_C(           2), -INT32_C(          20),
+       INT32_C(           5),  INT32_C(          24),  INT32_C(   268435456), -INT32_C(          10),  INT32_C(          27),  INT32_C(   268435456),  INT32_C(          10),  INT32_C(   268435456),
+      -INT32_C(          28),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           3),  INT32_C(           5),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(          28),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          15),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          20),
+      -INT32_C(           9), -INT32_C(           6), -INT32_C(          14),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          15),
+      -INT32_C(           7), -INT32_C(          31), -INT32_C(          11),  INT32_C(   268435456), -INT32_C(           2),  INT32_C(          12),  INT32_C(   268435456), -INT32_C(          26),
+       INT32_C(           5),  INT32_C(   268435456),  INT32_C(           7),  INT32_C(   268435456), -INT32_C(          14),  INT32_C(   268435456), -INT32_C(           1), -INT32_C(          20),
+      -INT32_C(          23),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          16),  INT32_C(          14),  INT32_C(   268435456),  INT32_C(   268435456),
+      -INT32_C(          27),  INT32_C(   268435456),  INT32_C(          17),  INT32_C(           3),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           4),  INT32_C(   268435456),
+       INT32_C(   268435456), -INT32_C(           2), -INT32_C(          19),  INT32_C(   268435456), -INT32_C(          15),  INT32_C(   268435456),  INT32_C(          25),  INT32_C(   268435456),
+      -INT32_C(           1), -INT32_C(          16), -INT32_C(           5),  INT32_C(           6),  INT32_C(          25), -INT32_C(          25),  INT32_C(   268435456),  INT32_C(           3),
+       INT32_C(   268435456),  INT32_C(          25),  INT32_C(   268435456), -INT32_C(          28),  INT32_C(   268435456), -INT32_C(           2),  INT32_C(   268435456),  INT32_C(           5),
+       INT32_C(   268435456),  INT32_C(          10),  INT32_C(          23), -INT32_C(          24),  INT32_C(   268435456),  INT32_C(           5), -INT32_C(           8),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(           9),  INT32_C(   268435456), -INT32_C(           5),  INT32_C(          24),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           4),
+      -INT32_C(           7),  INT32_C(   268435456),  INT32_C(          28), -INT32_C(           1),  INT32_C(          24),  INT32_C(   268435456), -INT32_C(          10),  INT32_C(   268435456),
+       INT32_C(          31),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           2), -INT32_C(           8), -INT32_C(          19),  INT32_C(          13),  INT32_C(          21),
+       INT32_C(           0),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(           2),  INT32_C(   268435456),
+       INT32_C(   268435456), -INT32_C(           1), -INT32_C(          12), -INT32_C(          19),  INT32_C(           7) };
+  static const int32_t e[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   669344012),  INT32_C(           0),  INT32_C(  1291860430),  INT32_C(  1570922728),
+       INT32_C(  1741459353), -INT32_C(   680530095),  INT32_C(           0),  INT32_C(  2028332604),  INT32_C(   575488893),  INT32_C(           0), -INT32_C(   472887265),  INT32_C(           0),
+       INT32_C(   832742213),  INT32_C(           0),  INT32_C(           0),  INT32_C(   219739332),  INT32_C(  1741459353),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   226693889),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1875449856),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1570922728),
+      -INT32_C(   338716033),  INT32_C(  1957295938), -INT32_C(  1910903709),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1875449856),
+       INT32_C(   467556024),  INT32_C(  1062204558),  INT32_C(   625952485),  INT32_C(           0),  INT32_C(  1291860430),  INT32_C(   864234650),  INT32_C(           0), -INT32_C(   634913696),
+       INT32_C(  1741459353),  INT32_C(           0),  INT32_C(   985525915),  INT32_C(           0), -INT32_C(  1910903709),  INT32_C(           0),  INT32_C(   557436883),  INT32_C(  1570922728),
+       INT32_C(    32001480),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   889238380), -INT32_C(  1239396581),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1923284084),  INT32_C(           0), -INT32_C(  1522506106),  INT32_C(   219739332),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1144828409),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(  1291860430), -INT32_C(  1127267236),  INT32_C(           0), -INT32_C(  1875449856),  INT32_C(           0),  INT32_C(   226275158),  INT32_C(           0),
+       INT32_C(   557436883),  INT32_C(   889238380),  INT32_C(    93235406), -INT32_C(  1665807160),  INT32_C(   226275158), -INT32_C(   201243264),  INT32_C(           0),  INT32_C(   219739332),
+       INT32_C(           0),  INT32_C(   226275158),  INT32_C(           0),  INT32_C(   832742213),  INT32_C(           0),  INT32_C(  1291860430),  INT32_C(           0),  INT32_C(  1741459353),
+       INT32_C(           0), -INT32_C(   472887265), -INT32_C(   311177245), -INT32_C(  1442917349),  INT32_C(           0),  INT32_C(  1741459353),  INT32_C(  1310773069),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1108737159),  INT32_C(           0),  INT32_C(    93235406), -INT32_C(   680530095),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1144828409),
+       INT32_C(   467556024),  INT32_C(           0),  INT32_C(   226693889),  INT32_C(   557436883), -INT32_C(   680530095),  INT32_C(           0),  INT32_C(  2028332604),  INT32_C(           0),
+       INT32_C(   859801314),  INT32_C(           0),  INT32_C(           0),  INT32_C(   325458756),  INT32_C(  1310773069), -INT32_C(  1127267236), -INT32_C(  2070261828),  INT32_C(   669344012),
+       INT32_C(  1466915231),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1291860430),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   557436883), -INT32_C(  1820876489), -INT32_C(  1127267236),  INT32_C(   985525915) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1_gather_s32index_s32(pv, &(a[32]), simde_svld1_s32(pg, &(b[i])));
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  int32_t a[64];
+  int32_t b[1024 / sizeof(int32_t)];
+  int32_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? ((simde_test_codegen_random_i32() & INT32_C(63)) - INT32_C(32)) : INT32_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1_gather_s32index_s32(pv, &(a[32]), simde_svld1_s32(pg, &(b[i])));
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_s32index_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(  1774803210),  INT32_C(   495715391), -INT32_C(   633670789),  INT32_C(   547065675), -INT32_C(  1957829506),  INT32_C(  1990569103),  INT32_C(   835405854), -INT32_C(  1950700139),
+      -INT32_C(  1826426796),  INT32_C(  1873850100), -INT32_C(   313922910), -INT32_C(   133307014),  INT32_C(  1485003465),  INT32_C(   634267654),  INT32_C(    89561712), -INT32_C(  1685057465),
+      -INT32_C(   181489152),  INT32_C(    56942177),  INT32_C(  1139846857),  INT32_C(  1547435667),  INT32_C(  1605680728),  INT32_C(  1451524838),  INT32_C(  1683741212), -INT32_C(   335549461),
+      -INT32_C(     2085218), -INT32_C(   721271540), -INT32_C(  2045185293),  INT32_C(  1239569392), -INT32_C(   139946479),  INT32_C(   894250008), -INT32_C(   241588218),  INT32_C(   853383316),
+      -INT32_C(   751714874), -INT32_C(   173526270),  INT32_C(   377209125),  INT32_C(   643783956),  INT32_C(   203229171),  INT32_C(   960588595), -INT32_C(  1490298349),  INT32_C(   970524786),
+      -INT32_C(   938734907),  INT32_C(  1673376829), -INT32_C(  1971766923), -INT32_C(  1968121706),  INT32_C(   311872991),  INT32_C(  1280038712),  INT32_C(   603158193),  INT32_C(  1146932606),
+       INT32_C(   353134807), -INT32_C(  1837577955), -INT32_C(  1726156542), -INT32_C(  1474048823), -INT32_C(   759514726),  INT32_C(  1092486544), -INT32_C(    94104964), -INT32_C(  1237401121),
+       INT32_C(  1187727913),  INT32_C(   383337236), -INT32_C(    38800076),  INT32_C(  1554371266),  INT32_C(   456023947), -INT32_C(   514044571),  INT32_C(  1054589279), -INT32_C(  1410065790),
+       INT32_C(  2029174884),  INT32_C(   948947715), -INT32_C(  2110439744), -INT32_C(  1663116527), -INT32_C(  1615327942), -INT32_C(  1182788518),  INT32_C(  1475828949), -INT32_C(   637277322),
+      -INT32_C(  1353452117), -INT32_C(  2132286784),  INT32_C(   822287392),  INT32_C(   852419063),  INT32_C(  1221691118),  INT32_C(  1879134874),  INT32_C(   617085102), -INT32_C(  1879127324),
+       INT32_C(  2134790591),  INT32_C(  1409295667),  INT32_C(   965018434), -INT32_C(   747940892),  INT32_C(  1947942361),  INT32_C(  1038359951), -INT32_C(   111039723),  INT32_C(   898195318),
+      -INT32_C(   457848911),  INT32_C(   792245741), -INT32_C(  1670857032), -INT32_C(   344992751), -INT32_C(  1604351215), -INT32_C(  1109572696),  INT32_C(  1689730798),  INT32_C(  1318731933),
+      -INT32_C(   197964025), -INT32_C(  1138529532),  INT32_C(   995658793),  INT32_C(  1898367072), -INT32_C(    82737837), -INT32_C(  1229394232), -INT32_C(   920948948), -INT32_C(  1223117393),
+       INT32_C(   145443588), -INT32_C(   523972682), -INT32_C(  1155851173),  INT32_C(   925647332), -INT32_C(  1909310010),  INT32_C(  1464134443),  INT32_C(   169893722),  INT32_C(   415315988),
+       INT32_C(   975203459), -INT32_C(  1776622533), -INT32_C(   447662847),  INT32_C(  1008565622), -INT32_C(   439726150), -INT32_C(  1791226310), -INT32_C(  2103485074),  INT32_C(   429613205),
+       INT32_C(   139705292), -INT32_C(  1583452768),  INT32_C(   411496610),  INT32_C(   676635501),  INT32_C(   755834611), -INT32_C(  1698543060),  INT32_C(  1008558503), -INT32_C(  1906984767),
+       INT32_C(   328640627), -INT32_C(  1212926955), -INT32_C(  1831912668), -INT32_C(   776330274),  INT32_C(  1862256449), -INT32_C(  1207385839), -INT32_C(   453696221),  INT32_C(  1366444765),
+       INT32_C(   140773619),  INT32_C(  1639979325),  INT32_C(   854822740), -INT32_C(   201019981), -INT32_C(  2040396939), -INT32_C(   415274044),  INT32_C(  1858876560),  INT32_C(  1908358782),
+      -INT32_C(  2072370361), -INT32_C(  1864025540),  INT32_C(  2093210057) };
+  static const uint32_t a[] =
+    { UINT32_C(2594468541), UINT32_C(4123282279), UINT32_C( 395496942), UINT32_C(3011357913), UINT32_C(2781873297), UINT32_C(1717770555), UINT32_C( 673822850), UINT32_C(2519164633),
+      UINT32_C(1077005273), UINT32_C(  87422231), UINT32_C(2602354626), UINT32_C(  89037427), UINT32_C(3651805086), UINT32_C(3124759864), UINT32_C(2682415557), UINT32_C(2822048463),
+      UINT32_C(3974653653), UINT32_C( 519118172), UINT32_C(1488588517), UINT32_C(1180502184), UINT32_C(1612646183), UINT32_C(3659161365), UINT32_C(2558131656), UINT32_C(3695226631),
+      UINT32_C(1909008661), UINT32_C( 730905158), UINT32_C(1887718088), UINT32_C(2058805586), UINT32_C(4275754729), UINT32_C(4275631157), UINT32_C(4170601201), UINT32_C( 383112705),
+      UINT32_C(1183358719), UINT32_C( 561059928), UINT32_C(3029464418), UINT32_C(3224258775), UINT32_C(1404962846), UINT32_C(3998324477), UINT32_C(3924289512), UINT32_C(3170942142),
+      UINT32_C(2986575962), UINT32_C(  47412640), UINT32_C(1102472554), UINT32_C(3405899181), UINT32_C(3927883757), UINT32_C(1054437462), UINT32_C( 354992215), UINT32_C(3604162684),
+      UINT32_C(1351145136), UINT32_C(3058850891), UINT32_C(1861683393), UINT32_C(3678009837), UINT32_C( 247814072), UINT32_C( 525180615), UINT32_C(3660871006), UINT32_C(1303381917),
+      UINT32_C( 698169822), UINT32_C(1457516437), UINT32_C(3854882807), UINT32_C(2294349264), UINT32_C( 479692116), UINT32_C(2184963108), UINT32_C(4133318489), UINT32_C(1430457719) };
+  static const int32_t b[] =
+    { -INT32_C(          26),  INT32_C(   268435456), -INT32_C(          17),  INT32_C(   268435456),  INT32_C(          21),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          18),
+       INT32_C(          17),  INT32_C(   268435456), -INT32_C(          24), -INT32_C(          19),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          30),
+       INT32_C(          26),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          22),
+      -INT32_C(          21),  INT32_C(           7),  INT32_C(           2),  INT32_C(   268435456), -INT32_C(          27),  INT32_C(   268435456),  INT32_C(          25),  INT32_C(   268435456),
+       INT32_C(          30), -INT32_C(          23),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          29),  INT32_C(   268435456),
+      -INT32_C(          19),  INT32_C(   268435456), -INT32_C(           9),  INT32_C(          17),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(          30), -INT32_C(          13), -INT32_C(          14), -INT32_C(           3),  INT32_C(   268435456), -INT32_C(           2), -INT32_C(           2),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          17),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           6),  INT32_C(   268435456), -INT32_C(          29),
+       INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          27), -INT32_C(          30),  INT32_C(          30), -INT32_C(          14),  INT32_C(   268435456), -INT32_C(          29),
+      -INT32_C(          12),  INT32_C(          10),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          11),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          26),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(           1),  INT32_C(   268435456),
+       INT32_C(          20),  INT32_C(   268435456),  INT32_C(          29),  INT32_C(          10),  INT32_C(          21),  INT32_C(          30),  INT32_C(   268435456),  INT32_C(   268435456),
+      -INT32_C(          15),  INT32_C(          30),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          24),  INT32_C(          11),  INT32_C(          25), -INT32_C(           6),
+       INT32_C(   268435456),  INT32_C(          11),  INT32_C(          20),  INT32_C(   268435456), -INT32_C(          18),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456), -INT32_C(          20), -INT32_C(          24),  INT32_C(   268435456), -INT32_C(           3), -INT32_C(          16),  INT32_C(           4),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(          24),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           6),  INT32_C(   268435456),  INT32_C(           0),
+       INT32_C(   268435456), -INT32_C(          19), -INT32_C(          14),  INT32_C(           6),  INT32_C(   268435456),  INT32_C(          11), -INT32_C(           6),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          27), -INT32_C(          19),  INT32_C(          31),  INT32_C(   268435456),  INT32_C(   268435456),
+      -INT32_C(          19),  INT32_C(          12),  INT32_C(   268435456) };
+  static const uint32_t e[] =
+    { UINT32_C( 673822850), UINT32_C(         0), UINT32_C(2822048463), UINT32_C(         0), UINT32_C( 525180615), UINT32_C(         0), UINT32_C(         0), UINT32_C(1861683393),
+      UINT32_C(3058850891), UINT32_C(         0), UINT32_C(1077005273), UINT32_C(3124759864), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 395496942),
+      UINT32_C(3854882807), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3660871006),
+      UINT32_C(  89037427), UINT32_C(3170942142), UINT32_C(3029464418), UINT32_C(         0), UINT32_C(1717770555), UINT32_C(         0), UINT32_C(1457516437), UINT32_C(         0),
+      UINT32_C(4133318489), UINT32_C(  87422231), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2184963108), UINT32_C(         0),
+      UINT32_C(3124759864), UINT32_C(         0), UINT32_C(3695226631), UINT32_C(3058850891), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(4133318489), UINT32_C(1180502184), UINT32_C(1488588517), UINT32_C(4275631157), UINT32_C(         0), UINT32_C(4170601201), UINT32_C(4170601201),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3058850891), UINT32_C(         0), UINT32_C(         0), UINT32_C(3924289512), UINT32_C(         0), UINT32_C(3011357913),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1717770555), UINT32_C( 395496942), UINT32_C(4133318489), UINT32_C(1488588517), UINT32_C(         0), UINT32_C(3011357913),
+      UINT32_C(1612646183), UINT32_C(1102472554), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3659161365),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 673822850), UINT32_C(         0), UINT32_C(         0), UINT32_C( 383112705), UINT32_C(         0),
+      UINT32_C( 247814072), UINT32_C(         0), UINT32_C(2184963108), UINT32_C(1102472554), UINT32_C( 525180615), UINT32_C(4133318489), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 519118172), UINT32_C(4133318489), UINT32_C(         0), UINT32_C(         0), UINT32_C(1077005273), UINT32_C(3405899181), UINT32_C(1457516437), UINT32_C(1887718088),
+      UINT32_C(         0), UINT32_C(3405899181), UINT32_C( 247814072), UINT32_C(         0), UINT32_C(2682415557), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(3651805086), UINT32_C(1077005273), UINT32_C(         0), UINT32_C(4275631157), UINT32_C(3974653653), UINT32_C(1404962846), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 698169822), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3924289512), UINT32_C(         0), UINT32_C(1183358719),
+      UINT32_C(         0), UINT32_C(3124759864), UINT32_C(1488588517), UINT32_C(3924289512), UINT32_C(         0), UINT32_C(3405899181), UINT32_C(1887718088), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1717770555), UINT32_C(3124759864), UINT32_C(1430457719), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(3124759864), UINT32_C(3927883757), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1_gather_s32index_u32(pv, &(a[32]), simde_svld1_s32(pg, &(b[i])));
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  uint32_t a[64];
+  int32_t b[1024 / sizeof(uint32_t)];
+  uint32_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? ((simde_test_codegen_random_i32() & INT32_C(63)) - INT32_C(32)) : INT32_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1_gather_s32index_u32(pv, &(a[32]), simde_svld1_s32(pg, &(b[i])));
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_s32index_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(  1816947281), -INT32_C(  1950422202),  INT32_C(  1350008131), -INT32_C(  1392699219),  INT32_C(  1182275385),  INT32_C(   509942385),  INT32_C(   376566533),  INT32_C(  1490188806),
+       INT32_C(   734273253),  INT32_C(  1303806473), -INT32_C(  1398984961),  INT32_C(  2136513350),  INT32_C(   600232370), -INT32_C(   247387157),  INT32_C(   621261343),  INT32_C(   310237485),
+       INT32_C(     4014583), -INT32_C(  1018301500),  INT32_C(  1735453473),  INT32_C(   954714246), -INT32_C(  2057589351), -INT32_C(   143221288),  INT32_C(  2082307407),  INT32_C(  1301191254),
+      -INT32_C(  1605514276), -INT32_C(   530342977),  INT32_C(   206099334),  INT32_C(   893661084), -INT32_C(  1262837796), -INT32_C(  1934872516),  INT32_C(    50907565),  INT32_C(  1062246243),
+       INT32_C(   568303202), -INT32_C(  1090370759), -INT32_C(  1295300074),  INT32_C(  1441271673), -INT32_C(   351690066), -INT32_C(  2139638317), -INT32_C(   494633090),  INT32_C(  2032260118),
+      -INT32_C(  1415970446),  INT32_C(  1516936260),  INT32_C(  1594701286), -INT32_C(   206244540),  INT32_C(  1792982679), -INT32_C(   219458189), -INT32_C(   338399276), -INT32_C(  1234897597),
+       INT32_C(   979500790), -INT32_C(  2120889189),  INT32_C(  1189192193),  INT32_C(   775525783), -INT32_C(   946268333),  INT32_C(  1085899884),  INT32_C(   908824051),  INT32_C(  2045546370),
+       INT32_C(   699616910),  INT32_C(   464144410), -INT32_C(  2124313622),  INT32_C(  1957730849),  INT32_C(   490424753), -INT32_C(  1067518771),  INT32_C(    83265921), -INT32_C(  1484922087),
+       INT32_C(  1271935025),  INT32_C(  1667660409),  INT32_C(   669370374),  INT32_C(   345740642), -INT32_C(  1422796834),  INT32_C(  1298894795),  INT32_C(   844194073),  INT32_C(  1977208388),
+       INT32_C(  2009115134),  INT32_C(   702228259),  INT32_C(  1364246767),  INT32_C(   862317653), -INT32_C(  1898014781),  INT32_C(  1071335718), -INT32_C(   277795670), -INT32_C(   110867718),
+       INT32_C(   393225715),  INT32_C(   994069324),  INT32_C(  1619824907),  INT32_C(  1083437693), -INT32_C(  1345425015),  INT32_C(  1710205626), -INT32_C(   782999338), -INT32_C(  1630881621),
+       INT32_C(   699742941), -INT32_C(  1855654266),  INT32_C(    83030407),  INT32_C(  1816430051), -INT32_C(  1323625737), -INT32_C(  1827272004),  INT32_C(   375679595),  INT32_C(    11808291),
+      -INT32_C(   299210136), -INT32_C(   411005344),  INT32_C(  1659597439), -INT32_C(   288477193), -INT32_C(    23008703),  INT32_C(  1603385076),  INT32_C(  1148581153), -INT32_C(  1958467037),
+      -INT32_C(   193302892),  INT32_C(  2094791421),  INT32_C(  1675609708),  INT32_C(   911388149), -INT32_C(  1942687081), -INT32_C(   907295320), -INT32_C(   586325574),  INT32_C(   526996107),
+      -INT32_C(  1122769984),  INT32_C(  1228599005), -INT32_C(  1448339020),  INT32_C(  1591738054), -INT32_C(  1712712464), -INT32_C(  1805462055), -INT32_C(  1049530314), -INT32_C(  2099193150),
+      -INT32_C(  1707019331), -INT32_C(  1780253983),  INT32_C(  1497272467),  INT32_C(  2142707342),  INT32_C(   186163506), -INT32_C(  1382057353), -INT32_C(  1402007062), -INT32_C(  1456517141),
+       INT32_C(   608399171),  INT32_C(  2092574697),  INT32_C(  1171650743),  INT32_C(  1220840726), -INT32_C(  1521165266),  INT32_C(  1096020823), -INT32_C(   252788220),  INT32_C(  1419320593),
+       INT32_C(  1970920588), -INT32_C(  1158597885),  INT32_C(  1107346987), -INT32_C(  2104834989), -INT32_C(   131604831), -INT32_C(   700876078),  INT32_C(  1321609020), -INT32_C(   794665148) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -819.59), SIMDE_FLOAT32_C(  -610.52), SIMDE_FLOAT32_C(   474.08), SIMDE_FLOAT32_C(  -288.17),
+      SIMDE_FLOAT32_C(   189.39), SIMDE_FLOAT32_C(   860.10), SIMDE_FLOAT32_C(  -287.57), SIMDE_FLOAT32_C(  -329.19),
+      SIMDE_FLOAT32_C(   -99.48), SIMDE_FLOAT32_C(  -148.71), SIMDE_FLOAT32_C(  -468.97), SIMDE_FLOAT32_C(   626.74),
+      SIMDE_FLOAT32_C(    66.09), SIMDE_FLOAT32_C(  -199.40), SIMDE_FLOAT32_C(     5.20), SIMDE_FLOAT32_C(     9.56),
+      SIMDE_FLOAT32_C(  -688.62), SIMDE_FLOAT32_C(   864.98), SIMDE_FLOAT32_C(    41.38), SIMDE_FLOAT32_C(  -416.76),
+      SIMDE_FLOAT32_C(   611.95), SIMDE_FLOAT32_C(  -665.47), SIMDE_FLOAT32_C(   -90.40), SIMDE_FLOAT32_C(  -778.03),
+      SIMDE_FLOAT32_C(  -527.50), SIMDE_FLOAT32_C(  -623.15), SIMDE_FLOAT32_C(  -737.31), SIMDE_FLOAT32_C(   939.59),
+      SIMDE_FLOAT32_C(  -908.85), SIMDE_FLOAT32_C(  -838.90), SIMDE_FLOAT32_C(  -227.97), SIMDE_FLOAT32_C(  -728.43),
+      SIMDE_FLOAT32_C(  -449.42), SIMDE_FLOAT32_C(  -753.89), SIMDE_FLOAT32_C(   -16.60), SIMDE_FLOAT32_C(   739.97),
+      SIMDE_FLOAT32_C(  -893.79), SIMDE_FLOAT32_C(   695.83), SIMDE_FLOAT32_C(  -589.21), SIMDE_FLOAT32_C(     6.73),
+      SIMDE_FLOAT32_C(  -452.88), SIMDE_FLOAT32_C(   -58.18), SIMDE_FLOAT32_C(  -366.53), SIMDE_FLOAT32_C(   613.21),
+      SIMDE_FLOAT32_C(   742.42), SIMDE_FLOAT32_C(   638.67), SIMDE_FLOAT32_C(  -377.23), SIMDE_FLOAT32_C(  -946.21),
+      SIMDE_FLOAT32_C(   503.66), SIMDE_FLOAT32_C(   664.15), SIMDE_FLOAT32_C(  -362.97), SIMDE_FLOAT32_C(   115.61),
+      SIMDE_FLOAT32_C(   998.67), SIMDE_FLOAT32_C(   546.63), SIMDE_FLOAT32_C(   337.58), SIMDE_FLOAT32_C(  -528.83),
+      SIMDE_FLOAT32_C(   923.48), SIMDE_FLOAT32_C(   600.27), SIMDE_FLOAT32_C(  -589.23), SIMDE_FLOAT32_C(  -985.37),
+      SIMDE_FLOAT32_C(   761.36), SIMDE_FLOAT32_C(   182.80), SIMDE_FLOAT32_C(  -713.80), SIMDE_FLOAT32_C(  -688.06) };
+  static const int32_t b[] =
+    {  INT32_C(   268435456),  INT32_C(          13),  INT32_C(   268435456), -INT32_C(           1),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          31),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          10),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(          29),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          31), -INT32_C(          22),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(          22),  INT32_C(          15),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          30),  INT32_C(          26),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456), -INT32_C(           2), -INT32_C(           4),  INT32_C(   268435456),  INT32_C(           4), -INT32_C(           4),  INT32_C(          31),  INT32_C(   268435456),
+      -INT32_C(          32),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          25),  INT32_C(   268435456), -INT32_C(          20), -INT32_C(           1),  INT32_C(          11),
+       INT32_C(   268435456),  INT32_C(          11),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          18),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           1),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          29),  INT32_C(   268435456), -INT32_C(          11),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          29),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          23),  INT32_C(   268435456),  INT32_C(           7),  INT32_C(          26),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          22),  INT32_C(   268435456), -INT32_C(          24), -INT32_C(          21),
+       INT32_C(   268435456), -INT32_C(           2),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          11),  INT32_C(           3),  INT32_C(   268435456),  INT32_C(   268435456),
+       INT32_C(          29), -INT32_C(          16),  INT32_C(   268435456),  INT32_C(          15),  INT32_C(           8),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          27),
+       INT32_C(          25),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(           7), -INT32_C(          27),  INT32_C(           9),  INT32_C(   268435456),
+       INT32_C(          13),  INT32_C(   268435456), -INT32_C(          16),  INT32_C(   268435456),  INT32_C(          12),  INT32_C(          12), -INT32_C(           8), -INT32_C(          20),
+      -INT32_C(           8), -INT32_C(          12),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456), -INT32_C(          23),  INT32_C(           7), -INT32_C(          27),
+       INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(   268435456),  INT32_C(          31),  INT32_C(   268435456),  INT32_C(          15),  INT32_C(   268435456),
+       INT32_C(   268435456), -INT32_C(           5),  INT32_C(   268435456), -INT32_C(          31),  INT32_C(          16),  INT32_C(          30),  INT32_C(   268435456),  INT32_C(           5) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   638.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -728.43),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -610.52), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -366.53), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   182.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -610.52), SIMDE_FLOAT32_C(  -468.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   337.58), SIMDE_FLOAT32_C(  -946.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   474.08), SIMDE_FLOAT32_C(  -589.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -227.97), SIMDE_FLOAT32_C(  -908.85), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -893.79), SIMDE_FLOAT32_C(  -908.85), SIMDE_FLOAT32_C(  -688.06), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -819.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -329.19),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    66.09), SIMDE_FLOAT32_C(  -728.43), SIMDE_FLOAT32_C(   613.21),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   613.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     5.20), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -753.89), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -288.17), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -665.47),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   182.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -528.83), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     6.73), SIMDE_FLOAT32_C(  -589.23),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -468.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -99.48), SIMDE_FLOAT32_C(   626.74),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -227.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -665.47), SIMDE_FLOAT32_C(   739.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   182.80), SIMDE_FLOAT32_C(  -688.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -946.21),
+      SIMDE_FLOAT32_C(  -452.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   860.10),
+      SIMDE_FLOAT32_C(   600.27), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     6.73), SIMDE_FLOAT32_C(   860.10), SIMDE_FLOAT32_C(   -58.18), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   638.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -688.62), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   742.42), SIMDE_FLOAT32_C(   742.42), SIMDE_FLOAT32_C(  -527.50), SIMDE_FLOAT32_C(    66.09),
+      SIMDE_FLOAT32_C(  -527.50), SIMDE_FLOAT32_C(   611.95), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -148.71), SIMDE_FLOAT32_C(     6.73), SIMDE_FLOAT32_C(   860.10),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -688.06), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -946.21), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   939.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -610.52),
+      SIMDE_FLOAT32_C(   503.66), SIMDE_FLOAT32_C(  -713.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   695.83) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1_gather_s32index_f32(pv, &(a[32]), simde_svld1_s32(pg, &(b[i])));
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(simde_float32)];
+  simde_float32 a[64];
+  int32_t b[1024 / sizeof(simde_float32)];
+  simde_float32 e[1024 / sizeof(simde_float32)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? ((simde_test_codegen_random_i32() & INT32_C(63)) - INT32_C(32)) : INT32_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1_gather_s32index_f32(pv, &(a[32]), simde_svld1_s32(pg, &(b[i])));
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_u32index_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(  1220228441),  INT32_C(   491016513), -INT32_C(   196079246), -INT32_C(   473266830), -INT32_C(  1264770699),  INT32_C(  2086318422), -INT32_C(    56159465), -INT32_C(   337623918),
+      -INT32_C(  1171022983),  INT32_C(  1607956461), -INT32_C(    78436216),  INT32_C(   601759149), -INT32_C(  1781040321),  INT32_C(  1125200172), -INT32_C(   700401596),  INT32_C(  1975591164),
+      -INT32_C(  1456409156), -INT32_C(   184023188), -INT32_C(   571450321), -INT32_C(  1207906695),  INT32_C(  1968101193),  INT32_C(  1287151368),  INT32_C(   337901592), -INT32_C(   712317927),
+       INT32_C(  1182710489), -INT32_C(   247757119),  INT32_C(  1557015522),  INT32_C(  1108659961), -INT32_C(  1380490587), -INT32_C(   621187134), -INT32_C(  2115101592), -INT32_C(   631867391),
+      -INT32_C(   199175118),  INT32_C(  1038441306),  INT32_C(  2140779398),  INT32_C(   650227073), -INT32_C(   757893104),  INT32_C(  1353501928), -INT32_C(   355362071),  INT32_C(  1170482963),
+       INT32_C(  1429857787), -INT32_C(   946725312),  INT32_C(  1380330449), -INT32_C(   378009383),  INT32_C(  1757105024),  INT32_C(    28862232),  INT32_C(   350980353), -INT32_C(  1420120144),
+      -INT32_C(   721316972), -INT32_C(  2086890574), -INT32_C(  1730747713),  INT32_C(  1803636458), -INT32_C(  1294779238), -INT32_C(  1531736925), -INT32_C(   960913899), -INT32_C(   495905971),
+       INT32_C(  1488417446), -INT32_C(   975416570),  INT32_C(   543011381), -INT32_C(  1702109696), -INT32_C(  1119068646),  INT32_C(     6422506), -INT32_C(   339338595), -INT32_C(   724748499),
+      -INT32_C(  1339259734),  INT32_C(   208996567), -INT32_C(  1154690374), -INT32_C(   900352080),  INT32_C(     8888854),  INT32_C(  1057024161),  INT32_C(   808109571), -INT32_C(  1476069378),
+       INT32_C(  1381511547), -INT32_C(   195113671),  INT32_C(  1336904607),  INT32_C(  1478034498),  INT32_C(  1213833382), -INT32_C(  1954063992),  INT32_C(   515682592),  INT32_C(   600228008),
+       INT32_C(   729095921), -INT32_C(  1977625621), -INT32_C(  1579561378),  INT32_C(  2046423762),  INT32_C(   448877202), -INT32_C(   861517652), -INT32_C(  1578474759),  INT32_C(   348434466),
+      -INT32_C(  1187038770),  INT32_C(  1799577100), -INT32_C(    32760788), -INT32_C(  1602812658),  INT32_C(    79312984),  INT32_C(  2043699328), -INT32_C(   451233086),  INT32_C(   955899498),
+       INT32_C(   619788311), -INT32_C(  1030802282),  INT32_C(  1589680976), -INT32_C(   117557088), -INT32_C(   235095952), -INT32_C(   613757927), -INT32_C(   255818362),  INT32_C(  2066266467),
+      -INT32_C(  2019616271), -INT32_C(  1656148403),  INT32_C(  1778059977), -INT32_C(  1302136510), -INT32_C(   878485838), -INT32_C(  1314517461), -INT32_C(   157128813),  INT32_C(   309447200),
+       INT32_C(   832114916),  INT32_C(   131064638),  INT32_C(   795986669),  INT32_C(  1994511300),  INT32_C(  1547797809),  INT32_C(   638510995),  INT32_C(  1864151118),  INT32_C(  1585548922),
+      -INT32_C(   577758562), -INT32_C(   354131971), -INT32_C(   317106903),  INT32_C(  1516501800),  INT32_C(   330736768), -INT32_C(   633748340), -INT32_C(   280406668), -INT32_C(  2108831005),
+      -INT32_C(   497033755),  INT32_C(  1724728124), -INT32_C(  1051466087),  INT32_C(  1629206497), -INT32_C(   411774373),  INT32_C(   197307798), -INT32_C(   419820797), -INT32_C(  1150793770),
+       INT32_C(  1637730085), -INT32_C(  1530435061),  INT32_C(   845486929),  INT32_C(   764707282), -INT32_C(   384497581), -INT32_C(  1175136330), -INT32_C(  1197478174),  INT32_C(  1534265398),
+      -INT32_C(   625208881), -INT32_C(   864123781),  INT32_C(  1912595615), -INT32_C(  1197567131),  INT32_C(  1369551771),  INT32_C(  1829410442), -INT32_C(  1171936636), -INT32_C(  2129290830),
+       INT32_C(   626840234), -INT32_C(   168633770),  INT32_C(   593949118),  INT32_C(   534447236),  INT32_C(  1114734008), -INT32_C(  1750107373), -INT32_C(   682437339),  INT32_C(   408512366),
+      -INT32_C(  1891781319),  INT32_C(  1317285775), -INT32_C(  1536038368), -INT32_C(  1480307217), -INT32_C(   571918902), -INT32_C(   697001552), -INT32_C(   592591250),  INT32_C(  1744045614),
+       INT32_C(  1274491323), -INT32_C(  2120647839),  INT32_C(  1428556390),  INT32_C(   570223191), -INT32_C(   805378785), -INT32_C(   324701314),  INT32_C(  1741181753),  INT32_C(   365935705),
+       INT32_C(  1331742446), -INT32_C(  1479476927),  INT32_C(  1543304707), -INT32_C(     8587040),  INT32_C(  1557101534),  INT32_C(   659125486),  INT32_C(   563024327), -INT32_C(  1137287474),
+       INT32_C(  1695258148), -INT32_C(  1844585585), -INT32_C(  1293088302), -INT32_C(   525178366), -INT32_C(   751009307), -INT32_C(  1107655179),  INT32_C(  1709083031),  INT32_C(   186717415),
+       INT32_C(   963718314), -INT32_C(   640975353), -INT32_C(  1987266169),  INT32_C(   141114915), -INT32_C(  1260673345), -INT32_C(  1032727253),  INT32_C(  1176981343),  INT32_C(   223496291),
+       INT32_C(  2085012340), -INT32_C(   933948863), -INT32_C(   296558133), -INT32_C(   554255585), -INT32_C(  1919692447),  INT32_C(    89064614), -INT32_C(  1219725484),  INT32_C(   885366463),
+      -INT32_C(  1565521055), -INT32_C(   395705059),  INT32_C(   114736359), -INT32_C(   639251336),  INT32_C(  1147566237), -INT32_C(   800475524), -INT32_C(   326593235), -INT32_C(  1809822413),
+       INT32_C(  1983303768), -INT32_C(  1117871658), -INT32_C(   708627107), -INT32_C(  1615878143), -INT32_C(  1646062304), -INT32_C(   127062837), -INT32_C(   169478718), -INT32_C(  1685453502),
+      -INT32_C(  1408122666), -INT32_C(  1083609247), -INT32_C(  1500238684), -INT32_C(   180010027),  INT32_C(   613558361) };
+  static const int32_t a[] =
+    {  INT32_C(  1348719222),  INT32_C(  1322482283), -INT32_C(  1335996688), -INT32_C(   248207767),  INT32_C(  1942944390),  INT32_C(  1190129010), -INT32_C(  1712188607), -INT32_C(  1001269171),
+       INT32_C(   370455722),  INT32_C(   509929518), -INT32_C(  1597062346), -INT32_C(   275709079),  INT32_C(  1868718077), -INT32_C(  1900719539), -INT32_C(  1289246875),  INT32_C(   712472703),
+       INT32_C(  1514179372), -INT32_C(  1434868621), -INT32_C(   783661209),  INT32_C(  1203821386), -INT32_C(  2018106566), -INT32_C(   636130443), -INT32_C(  1836237549), -INT32_C(   490994507),
+       INT32_C(    54328464),  INT32_C(   145601953),  INT32_C(  1205467133),  INT32_C(   227515090),  INT32_C(   848577981), -INT32_C(  1005802831), -INT32_C(  1672045849),  INT32_C(   780014494),
+      -INT32_C(  1338852593),  INT32_C(  1840897904), -INT32_C(  1447718185), -INT32_C(   373930964),  INT32_C(   974867337), -INT32_C(   587323147),  INT32_C(  1618499010),  INT32_C(  2005923688),
+       INT32_C(   573096370),  INT32_C(  2005983648), -INT32_C(  1608432269),  INT32_C(   311023497),  INT32_C(   390964514), -INT32_C(  1879880755),  INT32_C(   149908640),  INT32_C(   360742499),
+      -INT32_C(   533223361), -INT32_C(    61356151), -INT32_C(  1784907764),  INT32_C(  1923622480), -INT32_C(  1735723573), -INT32_C(   517505728),  INT32_C(  1290344169), -INT32_C(   731813483),
+      -INT32_C(  1699440367),  INT32_C(  1838615648), -INT32_C(   738053244),  INT32_C(   608676441), -INT32_C(   524496481),  INT32_C(   952230734), -INT32_C(  1887130886),  INT32_C(   627303956) };
+  static const uint32_t b[] =
+    { UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        63), UINT32_C(        36), UINT32_C(        10), UINT32_C( 268435456), UINT32_C(        57), UINT32_C(        21),
+      UINT32_C(        40), UINT32_C( 268435456), UINT32_C(        36), UINT32_C( 268435456), UINT32_C(         6), UINT32_C( 268435456), UINT32_C(        45), UINT32_C( 268435456),
+      UINT32_C(        53), UINT32_C(         0), UINT32_C(        58), UINT32_C(        49), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         5),
+      UINT32_C( 268435456), UINT32_C(        46), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         2), UINT32_C(        30), UINT32_C(        15), UINT32_C(        48),
+      UINT32_C(        34), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        38), UINT32_C( 268435456), UINT32_C(        60), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        22), UINT32_C( 268435456), UINT32_C(        57), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        54),
+      UINT32_C(         3), UINT32_C(        52), UINT32_C(        56), UINT32_C( 268435456), UINT32_C(         6), UINT32_C(         0), UINT32_C(        25), UINT32_C(        36),
+      UINT32_C( 268435456), UINT32_C(         1), UINT32_C( 268435456), UINT32_C(        18), UINT32_C(        18), UINT32_C( 268435456), UINT32_C(        47), UINT32_C(        32),
+      UINT32_C(        19), UINT32_C( 268435456), UINT32_C(        49), UINT32_C(        32), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        60),
+      UINT32_C( 268435456), UINT32_C(         6), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        52), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        60), UINT32_C(        62), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        56), UINT32_C(        28), UINT32_C( 268435456),
+      UINT32_C(        36), UINT32_C( 268435456), UINT32_C(         2), UINT32_C(        33), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        58), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        14), UINT32_C( 268435456), UINT32_C(        38), UINT32_C(         4), UINT32_C(        24), UINT32_C(        56), UINT32_C( 268435456),
+      UINT32_C(        61), UINT32_C(        20), UINT32_C( 268435456), UINT32_C(        39), UINT32_C(         3), UINT32_C(        39), UINT32_C(        60), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(        23), UINT32_C(        35), UINT32_C(        61), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        47), UINT32_C(        35), UINT32_C(        59),
+      UINT32_C(        46), UINT32_C( 268435456), UINT32_C(        40), UINT32_C( 268435456), UINT32_C(         4), UINT32_C( 268435456), UINT32_C(        63), UINT32_C(        36),
+      UINT32_C( 268435456), UINT32_C(        60), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        18), UINT32_C(         4), UINT32_C(        46), UINT32_C( 268435456),
+      UINT32_C(        27), UINT32_C(        43), UINT32_C( 268435456), UINT32_C(        61), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        22), UINT32_C(        36),
+      UINT32_C( 268435456), UINT32_C(        22), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        14), UINT32_C(        51), UINT32_C( 268435456),
+      UINT32_C(         5), UINT32_C( 268435456), UINT32_C(        12), UINT32_C(         4), UINT32_C(        56), UINT32_C(         0), UINT32_C(        23), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(         9), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        41), UINT32_C(        26), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        46), UINT32_C( 268435456), UINT32_C(        58), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        58),
+      UINT32_C( 268435456), UINT32_C(        25), UINT32_C(        54), UINT32_C(         1), UINT32_C(        41), UINT32_C(         1), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        46), UINT32_C(        51), UINT32_C( 268435456), UINT32_C(        41), UINT32_C(        10), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        58), UINT32_C(        61), UINT32_C(         4), UINT32_C(        51), UINT32_C( 268435456), UINT32_C(        45), UINT32_C( 268435456),
+      UINT32_C(         8), UINT32_C(        16), UINT32_C( 268435456), UINT32_C(        46), UINT32_C( 268435456), UINT32_C(        46), UINT32_C(        23), UINT32_C(         5),
+      UINT32_C( 268435456), UINT32_C(        16), UINT32_C(        48), UINT32_C(        10), UINT32_C(        35), UINT32_C(         4), UINT32_C(        42), UINT32_C(        36),
+      UINT32_C(        44), UINT32_C(        24), UINT32_C(        30), UINT32_C(         5), UINT32_C( 268435456) };
+  static const int32_t e[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(   627303956),  INT32_C(   974867337), -INT32_C(  1597062346),  INT32_C(           0),  INT32_C(  1838615648), -INT32_C(   636130443),
+       INT32_C(   573096370),  INT32_C(           0),  INT32_C(   974867337),  INT32_C(           0), -INT32_C(  1712188607),  INT32_C(           0), -INT32_C(  1879880755),  INT32_C(           0),
+      -INT32_C(   517505728),  INT32_C(  1348719222), -INT32_C(   738053244), -INT32_C(    61356151),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1190129010),
+       INT32_C(           0),  INT32_C(   149908640),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1335996688), -INT32_C(  1672045849),  INT32_C(   712472703), -INT32_C(   533223361),
+      -INT32_C(  1447718185),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1618499010),  INT32_C(           0), -INT32_C(   524496481),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1836237549),  INT32_C(           0),  INT32_C(  1838615648),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1290344169),
+      -INT32_C(   248207767), -INT32_C(  1735723573), -INT32_C(  1699440367),  INT32_C(           0), -INT32_C(  1712188607),  INT32_C(  1348719222),  INT32_C(   145601953),  INT32_C(   974867337),
+       INT32_C(           0),  INT32_C(  1322482283),  INT32_C(           0), -INT32_C(   783661209), -INT32_C(   783661209),  INT32_C(           0),  INT32_C(   360742499), -INT32_C(  1338852593),
+       INT32_C(  1203821386),  INT32_C(           0), -INT32_C(    61356151), -INT32_C(  1338852593),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   524496481),
+       INT32_C(           0), -INT32_C(  1712188607),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1735723573),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(   524496481), -INT32_C(  1887130886),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1699440367),  INT32_C(   848577981),  INT32_C(           0),
+       INT32_C(   974867337),  INT32_C(           0), -INT32_C(  1335996688),  INT32_C(  1840897904),  INT32_C(           0),  INT32_C(           0), -INT32_C(   738053244),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1289246875),  INT32_C(           0),  INT32_C(  1618499010),  INT32_C(  1942944390),  INT32_C(    54328464), -INT32_C(  1699440367),  INT32_C(           0),
+       INT32_C(   952230734), -INT32_C(  2018106566),  INT32_C(           0),  INT32_C(  2005923688), -INT32_C(   248207767),  INT32_C(  2005923688), -INT32_C(   524496481),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(   490994507), -INT32_C(   373930964),  INT32_C(   952230734),  INT32_C(           0),  INT32_C(           0),  INT32_C(   360742499), -INT32_C(   373930964),  INT32_C(   608676441),
+       INT32_C(   149908640),  INT32_C(           0),  INT32_C(   573096370),  INT32_C(           0),  INT32_C(  1942944390),  INT32_C(           0),  INT32_C(   627303956),  INT32_C(   974867337),
+       INT32_C(           0), -INT32_C(   524496481),  INT32_C(           0),  INT32_C(           0), -INT32_C(   783661209),  INT32_C(  1942944390),  INT32_C(   149908640),  INT32_C(           0),
+       INT32_C(   227515090),  INT32_C(   311023497),  INT32_C(           0),  INT32_C(   952230734),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1836237549),  INT32_C(   974867337),
+       INT32_C(           0), -INT32_C(  1836237549),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1289246875),  INT32_C(  1923622480),  INT32_C(           0),
+       INT32_C(  1190129010),  INT32_C(           0),  INT32_C(  1868718077),  INT32_C(  1942944390), -INT32_C(  1699440367),  INT32_C(  1348719222), -INT32_C(   490994507),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   509929518),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2005983648),  INT32_C(  1205467133),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   149908640),  INT32_C(           0), -INT32_C(   738053244),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   738053244),
+       INT32_C(           0),  INT32_C(   145601953),  INT32_C(  1290344169),  INT32_C(  1322482283),  INT32_C(  2005983648),  INT32_C(  1322482283),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   149908640),  INT32_C(  1923622480),  INT32_C(           0),  INT32_C(  2005983648), -INT32_C(  1597062346),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(   738053244),  INT32_C(   952230734),  INT32_C(  1942944390),  INT32_C(  1923622480),  INT32_C(           0), -INT32_C(  1879880755),  INT32_C(           0),
+       INT32_C(   370455722),  INT32_C(  1514179372),  INT32_C(           0),  INT32_C(   149908640),  INT32_C(           0),  INT32_C(   149908640), -INT32_C(   490994507),  INT32_C(  1190129010),
+       INT32_C(           0),  INT32_C(  1514179372), -INT32_C(   533223361), -INT32_C(  1597062346), -INT32_C(   373930964),  INT32_C(  1942944390), -INT32_C(  1608432269),  INT32_C(   974867337),
+       INT32_C(   390964514),  INT32_C(    54328464), -INT32_C(  1672045849),  INT32_C(  1190129010),  INT32_C(           0) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1_gather_u32index_s32(pv, a, simde_svld1_u32(pg, &(b[i])));
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  int32_t a[64];
+  uint32_t b[1024 / sizeof(int32_t)];
+  int32_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? (simde_test_codegen_random_u32() & UINT32_C(63)) : UINT32_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1_gather_u32index_s32(pv, a, simde_svld1_u32(pg, &(b[i])));
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_u32index_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(   826323462),  INT32_C(  1924341262),  INT32_C(  2052837838), -INT32_C(  1443463983),  INT32_C(   359755702),  INT32_C(  1279111751),  INT32_C(  1723089053), -INT32_C(  1112248905),
+       INT32_C(   770634783), -INT32_C(   526409454),  INT32_C(  1130035826),  INT32_C(   770461814),  INT32_C(   121790143), -INT32_C(  1370259696),  INT32_C(  1981024447), -INT32_C(  1791702923),
+      -INT32_C(   826137924),  INT32_C(   917398212), -INT32_C(   746977188),  INT32_C(   402679384), -INT32_C(   719371580), -INT32_C(  2122091839), -INT32_C(   252209286),  INT32_C(   478489440),
+       INT32_C(   317409102),  INT32_C(   105421225), -INT32_C(    86392158), -INT32_C(   317531863), -INT32_C(   591253221),  INT32_C(   509429156),  INT32_C(  1024349661), -INT32_C(   832990336),
+      -INT32_C(  2065677093), -INT32_C(  2138428962),  INT32_C(   343565291),  INT32_C(  1459785020),  INT32_C(  1647625406), -INT32_C(   410939126),  INT32_C(  1730449382), -INT32_C(    30048989),
+      -INT32_C(  1602087230),  INT32_C(   706743615), -INT32_C(  1388340624), -INT32_C(   435928793),  INT32_C(   256391173), -INT32_C(  1326003766),  INT32_C(  2081888857),  INT32_C(  1517964696),
+      -INT32_C(  1560609693),  INT32_C(  2060196361), -INT32_C(   601420876),  INT32_C(  1388456780),  INT32_C(   778111588),  INT32_C(   769546452),  INT32_C(   178910834), -INT32_C(  1503386813),
+       INT32_C(   692608543),  INT32_C(   765662328),  INT32_C(  1812580896),  INT32_C(  1505676277), -INT32_C(  1450762027), -INT32_C(   355047816), -INT32_C(  1611301028), -INT32_C(  1035642462),
+       INT32_C(   820743608), -INT32_C(  1050833247),  INT32_C(  1294886488),  INT32_C(   128445489), -INT32_C(  2068828660), -INT32_C(   261126252), -INT32_C(  1450220538),  INT32_C(  1970001085),
+       INT32_C(    61232737),  INT32_C(  1019479012), -INT32_C(  1685458326), -INT32_C(   341692193), -INT32_C(   210742433), -INT32_C(   521871398),  INT32_C(     9007939), -INT32_C(  1451822008),
+       INT32_C(   783031370), -INT32_C(  1989512929),  INT32_C(  1109783651), -INT32_C(  2094086364), -INT32_C(   193487334), -INT32_C(  1059759235),  INT32_C(   381705934), -INT32_C(  1648347565),
+       INT32_C(  1925999698),  INT32_C(  1106982621),  INT32_C(  1333993514),  INT32_C(    47362536), -INT32_C(   856209073),  INT32_C(  1938607268),  INT32_C(  2106150186), -INT32_C(   702854781),
+      -INT32_C(  1823938634),  INT32_C(  1221870365),  INT32_C(  1284986980),  INT32_C(  1498310921),  INT32_C(  1462060467),  INT32_C(  1019916817), -INT32_C(  2101783297),  INT32_C(  1398330525),
+      -INT32_C(   639131461),  INT32_C(  1210170340),  INT32_C(   496285715), -INT32_C(   730406367),  INT32_C(   959224616),  INT32_C(  1282799181), -INT32_C(   389075126), -INT32_C(  1086642429),
+      -INT32_C(  1399315768), -INT32_C(   235619874), -INT32_C(  1844541327), -INT32_C(  1838709654),  INT32_C(  1842123552), -INT32_C(   725991031),  INT32_C(  1958513008),  INT32_C(  2016671664),
+      -INT32_C(   131806438), -INT32_C(   169273212),  INT32_C(   193460384), -INT32_C(  1667371396),  INT32_C(   185231745),  INT32_C(   467649707), -INT32_C(    40920243), -INT32_C(  1401503086),
+       INT32_C(   296000141),  INT32_C(  1392938675),  INT32_C(    39751302), -INT32_C(    23069572),  INT32_C(   269068645), -INT32_C(  1171462035),  INT32_C(   364362627),  INT32_C(   197275006),
+       INT32_C(  2065524424),  INT32_C(  2060329972),  INT32_C(   779955633), -INT32_C(  1909711831),  INT32_C(   849294789), -INT32_C(  1595094243),  INT32_C(    79012742), -INT32_C(  1726973999),
+      -INT32_C(   770429474),  INT32_C(    38658640),  INT32_C(   942721551), -INT32_C(  1412997914), -INT32_C(  1361221999), -INT32_C(  1219573455),  INT32_C(  1035731820),  INT32_C(  1507249275),
+       INT32_C(  1227614969), -INT32_C(   599033651),  INT32_C(   672496450),  INT32_C(  1758715095),  INT32_C(  1930866754), -INT32_C(   433429383), -INT32_C(   484186520), -INT32_C(  1422067022),
+      -INT32_C(  1309317148),  INT32_C(   579748064), -INT32_C(  1823759428), -INT32_C(  1040441729),  INT32_C(  1211372239), -INT32_C(   550609289), -INT32_C(   138259899),  INT32_C(   816053836),
+       INT32_C(  1172478053), -INT32_C(  1805094696), -INT32_C(  1842826477), -INT32_C(  1605163823), -INT32_C(  1377204426),  INT32_C(   713824229), -INT32_C(  1256042903), -INT32_C(  1293499060),
+       INT32_C(   905431133),  INT32_C(  1271553848), -INT32_C(   455216622),  INT32_C(  1283731478), -INT32_C(  1661309513), -INT32_C(   288913787),  INT32_C(   564455893),  INT32_C(   198412974),
+      -INT32_C(  1975465134),  INT32_C(  1037371946),  INT32_C(   304198396), -INT32_C(  1721784862), -INT32_C(  1741334253), -INT32_C(  1266221857), -INT32_C(  1814680859),  INT32_C(   111061428),
+      -INT32_C(  1617895564), -INT32_C(   421763607), -INT32_C(   101122793), -INT32_C(  1248700510), -INT32_C(  1873950544), -INT32_C(  1438329660), -INT32_C(  1287841026),  INT32_C(   951704772),
+      -INT32_C(  1529394501) };
+  static const uint32_t a[] =
+    { UINT32_C(3744053824), UINT32_C(1763456360), UINT32_C(2092961491), UINT32_C(1248255878), UINT32_C( 654712966), UINT32_C(3481114332), UINT32_C( 889856003), UINT32_C(4092507571),
+      UINT32_C(3637647215), UINT32_C( 541191757), UINT32_C(2208039421), UINT32_C(1741488865), UINT32_C(4270773026), UINT32_C(1842219882), UINT32_C(3735279659), UINT32_C(4258435469),
+      UINT32_C(4141196457), UINT32_C(2417366675), UINT32_C(4178817560), UINT32_C(3596673460), UINT32_C( 517336756), UINT32_C( 613196793), UINT32_C( 151203707), UINT32_C(1762055616),
+      UINT32_C( 207608697), UINT32_C( 161248753), UINT32_C(3674386471), UINT32_C(1169318545), UINT32_C(1231325008), UINT32_C(2775511082), UINT32_C(3752751391), UINT32_C(3209278534),
+      UINT32_C(2177673359), UINT32_C(1166698526), UINT32_C(2837548312), UINT32_C(1089459183), UINT32_C(2223592282), UINT32_C(1646917443), UINT32_C(2923550824), UINT32_C( 477006476),
+      UINT32_C(1369258547), UINT32_C(3147179938), UINT32_C(2758064052), UINT32_C(3840168842), UINT32_C(3915935142), UINT32_C(3444281957), UINT32_C(4135357802), UINT32_C(1242753559),
+      UINT32_C(3332091684), UINT32_C(2340500183), UINT32_C(1949296361), UINT32_C(3763868473), UINT32_C(3871981953), UINT32_C(3182630227), UINT32_C(3115528098), UINT32_C(1023723033),
+      UINT32_C(1275371381), UINT32_C(3151529425), UINT32_C(2771322731), UINT32_C(2625996571), UINT32_C(2609008200), UINT32_C(  89666915), UINT32_C(2126449765), UINT32_C(1203553234) };
+  static const uint32_t b[] =
+    { UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        34), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         5),
+      UINT32_C( 268435456), UINT32_C(        51), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        37), UINT32_C( 268435456), UINT32_C(        41),
+      UINT32_C(        34), UINT32_C( 268435456), UINT32_C(        46), UINT32_C( 268435456), UINT32_C(        20), UINT32_C(         1), UINT32_C(         7), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        56), UINT32_C(        41), UINT32_C(        32), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        55),
+      UINT32_C(         3), UINT32_C(        16), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         8), UINT32_C( 268435456), UINT32_C(        20),
+      UINT32_C(        31), UINT32_C( 268435456), UINT32_C(         8), UINT32_C(        10), UINT32_C( 268435456), UINT32_C(        44), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(         3), UINT32_C( 268435456), UINT32_C(        55), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        16),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        16), UINT32_C(        45), UINT32_C(        15), UINT32_C(        11),
+      UINT32_C( 268435456), UINT32_C(        61), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        11), UINT32_C(         5), UINT32_C(        58), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        42), UINT32_C(         4), UINT32_C(         1), UINT32_C(        52), UINT32_C( 268435456), UINT32_C(         6),
+      UINT32_C( 268435456), UINT32_C(        26), UINT32_C( 268435456), UINT32_C(         3), UINT32_C(        39), UINT32_C(        25), UINT32_C( 268435456), UINT32_C(        48),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        34), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        36),
+      UINT32_C(        46), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         4), UINT32_C( 268435456),
+      UINT32_C(        38), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        10), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        11), UINT32_C(        63),
+      UINT32_C(        15), UINT32_C(        46), UINT32_C(        61), UINT32_C(        42), UINT32_C( 268435456), UINT32_C(        40), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(        23), UINT32_C(         3), UINT32_C( 268435456), UINT32_C(         9), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        53), UINT32_C(        30),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         4), UINT32_C( 268435456), UINT32_C(        49), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        50), UINT32_C( 268435456), UINT32_C(        23), UINT32_C( 268435456), UINT32_C(        58),
+      UINT32_C(        19), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        29), UINT32_C(        20), UINT32_C(        15), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        25), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        33), UINT32_C(         9), UINT32_C(        10),
+      UINT32_C(        48), UINT32_C( 268435456), UINT32_C(        14), UINT32_C(        61), UINT32_C( 268435456), UINT32_C(        20), UINT32_C(         7), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        13), UINT32_C(        15), UINT32_C(        34), UINT32_C(         8), UINT32_C( 268435456), UINT32_C(        48), UINT32_C(        11),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        54), UINT32_C( 268435456), UINT32_C(        46), UINT32_C(        21), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(        57), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        16), UINT32_C(        21), UINT32_C(        58), UINT32_C(        28), UINT32_C( 268435456),
+      UINT32_C(        52), UINT32_C(        57), UINT32_C(        60), UINT32_C(        30), UINT32_C(        42), UINT32_C(        16), UINT32_C(        30), UINT32_C( 268435456),
+      UINT32_C(        38) };
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2837548312), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3481114332),
+      UINT32_C(         0), UINT32_C(3763868473), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1646917443), UINT32_C(         0), UINT32_C(3147179938),
+      UINT32_C(2837548312), UINT32_C(         0), UINT32_C(4135357802), UINT32_C(         0), UINT32_C( 517336756), UINT32_C(1763456360), UINT32_C(4092507571), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1275371381), UINT32_C(3147179938), UINT32_C(2177673359), UINT32_C(         0), UINT32_C(         0), UINT32_C(1023723033),
+      UINT32_C(1248255878), UINT32_C(4141196457), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3637647215), UINT32_C(         0), UINT32_C( 517336756),
+      UINT32_C(3209278534), UINT32_C(         0), UINT32_C(3637647215), UINT32_C(2208039421), UINT32_C(         0), UINT32_C(3915935142), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(1248255878), UINT32_C(         0), UINT32_C(1023723033), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4141196457),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(4141196457), UINT32_C(3444281957), UINT32_C(4258435469), UINT32_C(1741488865),
+      UINT32_C(         0), UINT32_C(  89666915), UINT32_C(         0), UINT32_C(         0), UINT32_C(1741488865), UINT32_C(3481114332), UINT32_C(2771322731), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(2758064052), UINT32_C( 654712966), UINT32_C(1763456360), UINT32_C(3871981953), UINT32_C(         0), UINT32_C( 889856003),
+      UINT32_C(         0), UINT32_C(3674386471), UINT32_C(         0), UINT32_C(1248255878), UINT32_C( 477006476), UINT32_C( 161248753), UINT32_C(         0), UINT32_C(3332091684),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2837548312), UINT32_C(         0), UINT32_C(         0), UINT32_C(2223592282),
+      UINT32_C(4135357802), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 654712966), UINT32_C(         0),
+      UINT32_C(2923550824), UINT32_C(         0), UINT32_C(         0), UINT32_C(2208039421), UINT32_C(         0), UINT32_C(         0), UINT32_C(1741488865), UINT32_C(1203553234),
+      UINT32_C(4258435469), UINT32_C(4135357802), UINT32_C(  89666915), UINT32_C(2758064052), UINT32_C(         0), UINT32_C(1369258547), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(1762055616), UINT32_C(1248255878), UINT32_C(         0), UINT32_C( 541191757), UINT32_C(         0), UINT32_C(         0), UINT32_C(3182630227), UINT32_C(3752751391),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 654712966), UINT32_C(         0), UINT32_C(2340500183), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1949296361), UINT32_C(         0), UINT32_C(1762055616), UINT32_C(         0), UINT32_C(2771322731),
+      UINT32_C(3596673460), UINT32_C(         0), UINT32_C(         0), UINT32_C(2775511082), UINT32_C( 517336756), UINT32_C(4258435469), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 161248753), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1166698526), UINT32_C( 541191757), UINT32_C(2208039421),
+      UINT32_C(3332091684), UINT32_C(         0), UINT32_C(3735279659), UINT32_C(  89666915), UINT32_C(         0), UINT32_C( 517336756), UINT32_C(4092507571), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(1842219882), UINT32_C(4258435469), UINT32_C(2837548312), UINT32_C(3637647215), UINT32_C(         0), UINT32_C(3332091684), UINT32_C(1741488865),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3115528098), UINT32_C(         0), UINT32_C(4135357802), UINT32_C( 613196793), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(3151529425), UINT32_C(         0), UINT32_C(         0), UINT32_C(4141196457), UINT32_C( 613196793), UINT32_C(2771322731), UINT32_C(1231325008), UINT32_C(         0),
+      UINT32_C(3871981953), UINT32_C(3151529425), UINT32_C(2609008200), UINT32_C(3752751391), UINT32_C(2758064052), UINT32_C(4141196457), UINT32_C(3752751391), UINT32_C(         0),
+      UINT32_C(2923550824) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1_gather_u32index_u32(pv, a, simde_svld1_u32(pg, &(b[i])));
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  uint32_t a[64];
+  uint32_t b[1024 / sizeof(uint32_t)];
+  uint32_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? (simde_test_codegen_random_u32() & UINT32_C(63)) : UINT32_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1_gather_u32index_u32(pv, a, simde_svld1_u32(pg, &(b[i])));
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_u32index_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(  1299241745), -INT32_C(  1438505972), -INT32_C(  1051142953),  INT32_C(  1698783124),  INT32_C(   858834645),  INT32_C(  1714225279), -INT32_C(  1639876298), -INT32_C(   423674155),
+       INT32_C(   640888858),  INT32_C(   751859028), -INT32_C(   554882999),  INT32_C(  1564683912),  INT32_C(  1955689461), -INT32_C(  1445282189),  INT32_C(   222763832),  INT32_C(  1962084186),
+      -INT32_C(  1952831945), -INT32_C(   440964453),  INT32_C(   449029522), -INT32_C(   931658029), -INT32_C(   331544199), -INT32_C(     6940729), -INT32_C(  1928536781),  INT32_C(   453115876),
+      -INT32_C(  1045980379), -INT32_C(  1750704635), -INT32_C(   676173565), -INT32_C(   392222097), -INT32_C(    86713293),  INT32_C(   670722804),  INT32_C(   749995592),  INT32_C(   726185222),
+       INT32_C(  1441591120),  INT32_C(  1374458445),  INT32_C(  1781047035), -INT32_C(    78460984), -INT32_C(  1728698460), -INT32_C(   641732463), -INT32_C(    66685962),  INT32_C(  2015907368),
+      -INT32_C(  1966271427), -INT32_C(  1562658393),  INT32_C(   537723736),  INT32_C(  1864130507),  INT32_C(   403116678), -INT32_C(   118372862),  INT32_C(  1643509561), -INT32_C(  2099700411),
+      -INT32_C(   670194127), -INT32_C(  1216616353), -INT32_C(  1210545940),  INT32_C(  1848046823),  INT32_C(   143011078),  INT32_C(   738228211), -INT32_C(  1265765009),  INT32_C(  1144481298),
+       INT32_C(  1797014540),  INT32_C(   404985644),  INT32_C(   131070751), -INT32_C(   176818705),  INT32_C(   368966434), -INT32_C(   515768974),  INT32_C(    93769459),  INT32_C(  1078578484),
+       INT32_C(  1034708497),  INT32_C(   492228605), -INT32_C(  1188813366),  INT32_C(  1034852635),  INT32_C(   106146708), -INT32_C(  1679256408), -INT32_C(  1751024029),  INT32_C(  1557719627),
+       INT32_C(  1318683728),  INT32_C(   493612883),  INT32_C(   819367701), -INT32_C(  1133673432), -INT32_C(   675102673), -INT32_C(  1200379307),  INT32_C(  1934562344),  INT32_C(  1338976254),
+      -INT32_C(    23238229),  INT32_C(  1830488152), -INT32_C(  1080168041), -INT32_C(  1535440011),  INT32_C(   545013195),  INT32_C(   282652648),  INT32_C(    25438211), -INT32_C(    78621873),
+       INT32_C(   368700860), -INT32_C(  1937631755),  INT32_C(  2085298182), -INT32_C(   165624277), -INT32_C(   333997052), -INT32_C(  1896026229),  INT32_C(  1737523223), -INT32_C(  1872568108),
+      -INT32_C(  1012573234),  INT32_C(  2001741936),  INT32_C(  1945344840),  INT32_C(  1718162274),  INT32_C(   995262640), -INT32_C(  2016784784), -INT32_C(  1544660273),  INT32_C(   137580602),
+       INT32_C(   483187116),  INT32_C(  1234377729),  INT32_C(   431785655),  INT32_C(  1249846682),  INT32_C(   377868710), -INT32_C(   274903264), -INT32_C(   460157783), -INT32_C(  1997748772),
+      -INT32_C(  1616529250), -INT32_C(  1930938156),  INT32_C(  1504027839),  INT32_C(  1889740234),  INT32_C(   377891062),  INT32_C(   553984888), -INT32_C(  1945790545), -INT32_C(    82513315),
+       INT32_C(  2140912042), -INT32_C(  1324645390), -INT32_C(   234180568), -INT32_C(   865948203),  INT32_C(  1306716373), -INT32_C(  1150294005), -INT32_C(   599296897),  INT32_C(   299391846),
+       INT32_C(   126907157),  INT32_C(   515415030),  INT32_C(   554746443),  INT32_C(  1156412015),  INT32_C(  1720897370),  INT32_C(   924910007), -INT32_C(   602707851), -INT32_C(   655496253),
+       INT32_C(  1440709982),  INT32_C(  1668519704), -INT32_C(   930839463),  INT32_C(  1359835638), -INT32_C(   122183871),  INT32_C(   355457184),  INT32_C(    66143040), -INT32_C(  1914905042),
+       INT32_C(  1944238939), -INT32_C(  1395174061), -INT32_C(   797615143),  INT32_C(   237077197), -INT32_C(  1056516063), -INT32_C(   254396752), -INT32_C(  1477195655),  INT32_C(    37015462),
+      -INT32_C(   562751861),  INT32_C(  1166691436),  INT32_C(  1964375976), -INT32_C(  1568459135), -INT32_C(  1100773106),  INT32_C(   950942399), -INT32_C(  1461673470), -INT32_C(    55962511),
+      -INT32_C(  1747312597),  INT32_C(   349988204), -INT32_C(   427167132),  INT32_C(   931662888),  INT32_C(  1442180246),  INT32_C(   680436774), -INT32_C(  1211077050), -INT32_C(  1380680830),
+       INT32_C(   121933467),  INT32_C(  1478238707),  INT32_C(   993961235),  INT32_C(  1215481522), -INT32_C(   660772686),  INT32_C(  1375742732),  INT32_C(   470405529), -INT32_C(   406209204),
+       INT32_C(  1072565836),  INT32_C(  1117194799),  INT32_C(  1652413872),  INT32_C(  1319825564),  INT32_C(  1680295768),  INT32_C(   213264243),  INT32_C(  1143521272), -INT32_C(   919866755),
+       INT32_C(   789060096), -INT32_C(   730750940),  INT32_C(   288812661),  INT32_C(   912318686), -INT32_C(  1684371672), -INT32_C(  1482207058), -INT32_C(  1913925616), -INT32_C(  1034545214),
+       INT32_C(  1441881649),  INT32_C(  1948934910),  INT32_C(   797270096),  INT32_C(  1768285505),  INT32_C(   453247084),  INT32_C(  1623370576),  INT32_C(  1038986619), -INT32_C(   167820348),
+      -INT32_C(  1605635934), -INT32_C(  1558940334),  INT32_C(   382900949), -INT32_C(   327207041), -INT32_C(  2012773577), -INT32_C(  1427584721),  INT32_C(  1005114998), -INT32_C(  1154423015),
+       INT32_C(   710704088), -INT32_C(   959614736), -INT32_C(  1965252854),  INT32_C(   242638039),  INT32_C(   244743647), -INT32_C(  1128693946),  INT32_C(  1861722453),  INT32_C(  1613375624),
+      -INT32_C(  1802795357),  INT32_C(    22698230), -INT32_C(   812960008),  INT32_C(  1927086482), -INT32_C(   998214530),  INT32_C(  1216362995),  INT32_C(  1672902874),  INT32_C(  1136910496),
+       INT32_C(  1574391398), -INT32_C(  1621216857), -INT32_C(    93394584),  INT32_C(  1751927786), -INT32_C(  1305678401),  INT32_C(    33205286), -INT32_C(  1000034012), -INT32_C(   133683311) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -687.03), SIMDE_FLOAT32_C(   836.73), SIMDE_FLOAT32_C(  -203.75), SIMDE_FLOAT32_C(  -557.25),
+      SIMDE_FLOAT32_C(   902.83), SIMDE_FLOAT32_C(  -177.51), SIMDE_FLOAT32_C(  -579.02), SIMDE_FLOAT32_C(  -777.67),
+      SIMDE_FLOAT32_C(  -584.95), SIMDE_FLOAT32_C(  -879.45), SIMDE_FLOAT32_C(   695.41), SIMDE_FLOAT32_C(  -610.09),
+      SIMDE_FLOAT32_C(   785.84), SIMDE_FLOAT32_C(   113.46), SIMDE_FLOAT32_C(   342.43), SIMDE_FLOAT32_C(  -583.05),
+      SIMDE_FLOAT32_C(  -137.62), SIMDE_FLOAT32_C(   265.07), SIMDE_FLOAT32_C(    80.81), SIMDE_FLOAT32_C(  -148.98),
+      SIMDE_FLOAT32_C(  -778.11), SIMDE_FLOAT32_C(   880.24), SIMDE_FLOAT32_C(  -702.47), SIMDE_FLOAT32_C(  -962.96),
+      SIMDE_FLOAT32_C(  -218.16), SIMDE_FLOAT32_C(  -997.94), SIMDE_FLOAT32_C(   -62.99), SIMDE_FLOAT32_C(  -969.14),
+      SIMDE_FLOAT32_C(  -126.36), SIMDE_FLOAT32_C(   745.28), SIMDE_FLOAT32_C(  -521.37), SIMDE_FLOAT32_C(   186.61),
+      SIMDE_FLOAT32_C(   582.01), SIMDE_FLOAT32_C(   274.87), SIMDE_FLOAT32_C(   629.36), SIMDE_FLOAT32_C(   484.84),
+      SIMDE_FLOAT32_C(  -902.64), SIMDE_FLOAT32_C(  -949.66), SIMDE_FLOAT32_C(   707.17), SIMDE_FLOAT32_C(  -487.59),
+      SIMDE_FLOAT32_C(  -829.11), SIMDE_FLOAT32_C(   402.57), SIMDE_FLOAT32_C(   -97.67), SIMDE_FLOAT32_C(   956.73),
+      SIMDE_FLOAT32_C(  -483.97), SIMDE_FLOAT32_C(  -755.24), SIMDE_FLOAT32_C(  -626.32), SIMDE_FLOAT32_C(   378.40),
+      SIMDE_FLOAT32_C(   509.83), SIMDE_FLOAT32_C(   454.49), SIMDE_FLOAT32_C(  -770.57), SIMDE_FLOAT32_C(   731.72),
+      SIMDE_FLOAT32_C(   334.73), SIMDE_FLOAT32_C(  -473.04), SIMDE_FLOAT32_C(   768.76), SIMDE_FLOAT32_C(  -883.44),
+      SIMDE_FLOAT32_C(  -470.98), SIMDE_FLOAT32_C(  -294.23), SIMDE_FLOAT32_C(  -852.57), SIMDE_FLOAT32_C(   402.66),
+      SIMDE_FLOAT32_C(  -548.95), SIMDE_FLOAT32_C(  -373.94), SIMDE_FLOAT32_C(  -410.72), SIMDE_FLOAT32_C(  -966.95) };
+  static const uint32_t b[] =
+    { UINT32_C( 268435456), UINT32_C(        53), UINT32_C(        35), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        18), UINT32_C(        10),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         9), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        54), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(        23), UINT32_C(         7), UINT32_C( 268435456), UINT32_C(        42), UINT32_C(        15), UINT32_C(        34), UINT32_C(        39), UINT32_C( 268435456),
+      UINT32_C(        19), UINT32_C(        36), UINT32_C(        34), UINT32_C(        46), UINT32_C(        49), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        52), UINT32_C(        44), UINT32_C(        20), UINT32_C(        38), UINT32_C( 268435456),
+      UINT32_C(        50), UINT32_C(        49), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        61), UINT32_C( 268435456), UINT32_C(        26),
+      UINT32_C(        63), UINT32_C(        19), UINT32_C(        51), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        31), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        49), UINT32_C( 268435456), UINT32_C(        46), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        11), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        20), UINT32_C(        22), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        63), UINT32_C(         2), UINT32_C(        28), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(        25), UINT32_C( 268435456), UINT32_C(        62), UINT32_C(        40), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        20),
+      UINT32_C( 268435456), UINT32_C(        59), UINT32_C( 268435456), UINT32_C(        14), UINT32_C(         3), UINT32_C(        40), UINT32_C( 268435456), UINT32_C(        61),
+      UINT32_C(        13), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         8), UINT32_C(        23), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        17), UINT32_C(        63), UINT32_C(        52),
+      UINT32_C(         6), UINT32_C(        43), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        33), UINT32_C(        55),
+      UINT32_C( 268435456), UINT32_C(        33), UINT32_C(        38), UINT32_C(        41), UINT32_C( 268435456), UINT32_C(        37), UINT32_C(        23), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        60), UINT32_C(        48),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         7), UINT32_C( 268435456), UINT32_C(        22), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         6),
+      UINT32_C( 268435456), UINT32_C(        50), UINT32_C(        17), UINT32_C( 268435456), UINT32_C(        29), UINT32_C(        30), UINT32_C(        11), UINT32_C( 268435456),
+      UINT32_C(         7), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(         5), UINT32_C(         5), UINT32_C( 268435456), UINT32_C(         4), UINT32_C(        14),
+      UINT32_C(         3), UINT32_C( 268435456), UINT32_C(        11), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        54), UINT32_C(        21),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        58), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        48),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        39),
+      UINT32_C( 268435456), UINT32_C(        22), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        45), UINT32_C(        30), UINT32_C(        19), UINT32_C(        27),
+      UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        32),
+      UINT32_C(         6), UINT32_C(        17), UINT32_C( 268435456), UINT32_C(        19), UINT32_C(        38), UINT32_C(        39), UINT32_C( 268435456), UINT32_C(        62),
+      UINT32_C( 268435456), UINT32_C(        21), UINT32_C(        11), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C(        17), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C(        22), UINT32_C( 268435456), UINT32_C(        36), UINT32_C( 268435456), UINT32_C(         6), UINT32_C( 268435456), UINT32_C( 268435456), UINT32_C( 268435456),
+      UINT32_C( 268435456), UINT32_C(        39), UINT32_C(        17), UINT32_C( 268435456), UINT32_C(        47), UINT32_C( 268435456), UINT32_C(        51), UINT32_C(        41) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -473.04), SIMDE_FLOAT32_C(   484.84), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    80.81), SIMDE_FLOAT32_C(   695.41),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -879.45), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   768.76), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -962.96), SIMDE_FLOAT32_C(  -777.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -97.67),
+      SIMDE_FLOAT32_C(  -583.05), SIMDE_FLOAT32_C(   629.36), SIMDE_FLOAT32_C(  -487.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -148.98), SIMDE_FLOAT32_C(  -902.64), SIMDE_FLOAT32_C(   629.36), SIMDE_FLOAT32_C(  -626.32),
+      SIMDE_FLOAT32_C(   454.49), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   334.73),
+      SIMDE_FLOAT32_C(  -483.97), SIMDE_FLOAT32_C(  -778.11), SIMDE_FLOAT32_C(   707.17), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -770.57), SIMDE_FLOAT32_C(   454.49), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.94), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -62.99),
+      SIMDE_FLOAT32_C(  -966.95), SIMDE_FLOAT32_C(  -148.98), SIMDE_FLOAT32_C(   731.72), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   186.61), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   454.49),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -626.32), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -610.09), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -778.11), SIMDE_FLOAT32_C(  -702.47), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -966.95),
+      SIMDE_FLOAT32_C(  -203.75), SIMDE_FLOAT32_C(  -126.36), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -997.94), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -410.72), SIMDE_FLOAT32_C(  -829.11),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -778.11),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   402.66), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   342.43),
+      SIMDE_FLOAT32_C(  -557.25), SIMDE_FLOAT32_C(  -829.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.94),
+      SIMDE_FLOAT32_C(   113.46), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -584.95), SIMDE_FLOAT32_C(  -962.96), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   265.07), SIMDE_FLOAT32_C(  -966.95), SIMDE_FLOAT32_C(   334.73),
+      SIMDE_FLOAT32_C(  -579.02), SIMDE_FLOAT32_C(   956.73), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   274.87), SIMDE_FLOAT32_C(  -883.44),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   274.87), SIMDE_FLOAT32_C(   707.17), SIMDE_FLOAT32_C(   402.57),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -949.66), SIMDE_FLOAT32_C(  -962.96), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -548.95), SIMDE_FLOAT32_C(   509.83),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -777.67), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -702.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -579.02),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -770.57), SIMDE_FLOAT32_C(   265.07), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   745.28), SIMDE_FLOAT32_C(  -521.37), SIMDE_FLOAT32_C(  -610.09), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -777.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -177.51),
+      SIMDE_FLOAT32_C(  -177.51), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   902.83), SIMDE_FLOAT32_C(   342.43),
+      SIMDE_FLOAT32_C(  -557.25), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -610.09), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   768.76), SIMDE_FLOAT32_C(   880.24),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -852.57), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   509.83),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -487.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -702.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -755.24), SIMDE_FLOAT32_C(  -521.37), SIMDE_FLOAT32_C(  -148.98), SIMDE_FLOAT32_C(  -969.14),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   582.01),
+      SIMDE_FLOAT32_C(  -579.02), SIMDE_FLOAT32_C(   265.07), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -148.98),
+      SIMDE_FLOAT32_C(   707.17), SIMDE_FLOAT32_C(  -487.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -410.72),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   880.24), SIMDE_FLOAT32_C(  -610.09), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   265.07), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -702.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -902.64), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -579.02), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -487.59), SIMDE_FLOAT32_C(   265.07), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   378.40), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   731.72), SIMDE_FLOAT32_C(   402.57) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svld1_gather_u32index_f32(pv, a, simde_svld1_u32(pg, &(b[i])));
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(simde_float32)];
+  simde_float32 a[64];
+  uint32_t b[1024 / sizeof(simde_float32)];
+  simde_float32 e[1024 / sizeof(simde_float32)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(sizeof(a) / sizeof(a[0]), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? (simde_test_codegen_random_u32() & UINT32_C(63)) : UINT32_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    ev = simde_svld1_gather_u32index_f32(pv, a, simde_svld1_u32(pg, &(b[i])));
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_s64index_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 6516548075217932666), -INT64_C( 3256878635876886635), -INT64_C(  872262326323140179),  INT64_C( 8514296968064945062),
+       INT64_C( 5330474924370249388), -INT64_C( 1985246070364374915), -INT64_C( 4637606894724907098), -INT64_C( 2475224767530773195),
+       INT64_C(  107934122495499650),  INT64_C( 6019082534198030189), -INT64_C( 6058847322215576302), -INT64_C( 4753124741045485573),
+       INT64_C( 7486236002000078176), -INT64_C( 6187501029017483998), -INT64_C( 4160269654380174303),  INT64_C(  196183261204062143),
+       INT64_C( 4747297718779882624), -INT64_C( 6660206460618609329), -INT64_C( 1736560795988563882),  INT64_C( 5999527885728241822),
+       INT64_C( 4730943389217663046),  INT64_C( 4594442279290779548),  INT64_C( 1959987762507545892), -INT64_C(  773037286796618722),
+       INT64_C( 6843504144106066886),  INT64_C(  279856356603536314), -INT64_C( 6425367248909680324), -INT64_C( 7837708327779291242),
+       INT64_C( 5841526709509920240),  INT64_C(  669583671781789288), -INT64_C( 5672963110214657768), -INT64_C( 6113864386932711994),
+       INT64_C( 2282884894459589317), -INT64_C( 7938807680990796803), -INT64_C( 1002483934011746743),  INT64_C(  196660011509091412),
+      -INT64_C( 8865882839835535329),  INT64_C( 6321965416861031857), -INT64_C( 5199457017806459464),  INT64_C( 2962666010295295454),
+       INT64_C( 4370171190359129497), -INT64_C( 3551050826662874028),  INT64_C( 2533988671736149007),  INT64_C(  800053532538368486),
+       INT64_C( 7323083966241315545),  INT64_C( 4083215829939193542), -INT64_C( 3720862907816518413), -INT64_C( 3439386758578594873),
+       INT64_C(  678025128200925681), -INT64_C( 6756367359115186214), -INT64_C( 8890606226461956117),  INT64_C( 2565365354913946579),
+       INT64_C( 8989061310258269811),  INT64_C( 2166438349831709886), -INT64_C(  655961888094360669),  INT64_C( 1746933370648044521),
+      -INT64_C( 5600351529097861848),  INT64_C( 2774833661292365617), -INT64_C( 1642286641273408997),  INT64_C( 8776745262728410640),
+       INT64_C( 6435232824584018856), -INT64_C( 4973311412094013871), -INT64_C(   28095890636307790), -INT64_C( 8363604644048101340),
+       INT64_C(  981070844805984540),  INT64_C( 5493790776169224932), -INT64_C( 8552728886700525985), -INT64_C( 6797360635362540741),
+       INT64_C( 3235699201910624541),  INT64_C(  415435790364953053), -INT64_C( 7561645631545753054),  INT64_C( 1714570706424303014),
+       INT64_C( 1271659090186121521),  INT64_C( 7083120152891970720), -INT64_C( 1656488744462016498),  INT64_C( 5338699706746058757),
+       INT64_C( 9139607799788144272), -INT64_C( 5017553504466280516),  INT64_C( 4962446990763181745),  INT64_C( 7080320326823047904),
+       INT64_C( 3007557296795878751),  INT64_C( 4882328134254690652), -INT64_C( 1275619245417765174),  INT64_C( 5205644299385343753),
+      -INT64_C( 4700278744302656210),  INT64_C( 4078158370522393538), -INT64_C( 1051153012669427603), -INT64_C( 6391440781264269283),
+      -INT64_C( 2914100448870542481),  INT64_C( 5304048337466119668), -INT64_C( 8760576144559448940), -INT64_C( 5503441333684258434),
+      -INT64_C( 2335093403995020628),  INT64_C( 1985768058769294185),  INT64_C(   47573128525009849), -INT64_C( 4957734151249185476),
+       INT64_C( 3766158052202166137),  INT64_C( 2051679228612150999),  INT64_C( 5755011070863282267), -INT64_C( 1808756636239604451),
+       INT64_C( 5672159994868097720), -INT64_C( 7884072077959090154), -INT64_C( 2695318901605018314),  INT64_C( 2266977916976195106),
+       INT64_C( 7283263221541290062),  INT64_C( 1969047091751665545),  INT64_C( 3666488717430014794),  INT64_C( 2443826026774652515),
+       INT64_C( 8046799926654831862),  INT64_C( 5312423468865718968) };
+  static const int64_t a[] =
+    {  INT64_C( 2132479110947269839),  INT64_C(  346890846532612236), -INT64_C( 4853309786737486110), -INT64_C( 2463420555988597594),
+       INT64_C( 7397566847389254424),  INT64_C( 6631350859936174751), -INT64_C( 3002914480819758048),  INT64_C( 9218869975147690501),
+      -INT64_C( 3096871022057764923), -INT64_C( 1541110916998201402), -INT64_C(  107007797320648580),  INT64_C( 8931765844142306318),
+       INT64_C( 8778394956598017992),  INT64_C(  527578163601583263), -INT64_C( 5277031669638573107), -INT64_C( 7053727909681572373),
+      -INT64_C(  771680867954444770),  INT64_C( 2859698187510023196), -INT64_C( 8799555821673553021),  INT64_C( 5331209912442096775),
+       INT64_C( 2721691543124220282),  INT64_C( 6262672901976892008),  INT64_C( 1224524486968202974), -INT64_C( 2097997478917954194),
+      -INT64_C( 3949244143813592061),  INT64_C( 6395802485680504474),  INT64_C( 1433216318052516682), -INT64_C( 4666135228544429581),
+       INT64_C(  195059310958211466), -INT64_C(  158697240042455045),  INT64_C( 6858616555124596085), -INT64_C(  900727167850391036) };
+  static const int64_t b[] =
+    {  INT64_C(           268435456), -INT64_C(                   6),  INT64_C(                   1),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                  16), -INT64_C(                   2),  INT64_C(                   4),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   7), -INT64_C(                  10),
+       INT64_C(           268435456),  INT64_C(                   6), -INT64_C(                   7),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                   3), -INT64_C(                   8),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  16),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                  11),  INT64_C(                   3),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   0),  INT64_C(                   7),
+       INT64_C(           268435456), -INT64_C(                   8), -INT64_C(                  14),  INT64_C(           268435456),
+       INT64_C(                  15),  INT64_C(           268435456),  INT64_C(                   3),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(                   7),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   0), -INT64_C(                  13),
+       INT64_C(           268435456), -INT64_C(                  16),  INT64_C(                   4),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   4),  INT64_C(           268435456),
+      -INT64_C(                  16),  INT64_C(           268435456),  INT64_C(                  15),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                   8), -INT64_C(                  13), -INT64_C(                  14),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   3), -INT64_C(                  16),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  16),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                   2),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(                   1),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   5),  INT64_C(           268435456),
+       INT64_C(                  12),  INT64_C(           268435456), -INT64_C(                   7),  INT64_C(                   5),
+       INT64_C(                   4),  INT64_C(           268435456),  INT64_C(                   8), -INT64_C(                  16),
+      -INT64_C(                  11),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  16),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  15),
+       INT64_C(           268435456),  INT64_C(                  12),  INT64_C(                   2),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456) };
+  static const int64_t e[] =
+    {  INT64_C(                   0), -INT64_C(  107007797320648580),  INT64_C( 2859698187510023196),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 2132479110947269839), -INT64_C( 5277031669638573107),  INT64_C( 2721691543124220282),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2097997478917954194), -INT64_C( 3002914480819758048),
+       INT64_C(                   0),  INT64_C( 1224524486968202974), -INT64_C( 1541110916998201402),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(  527578163601583263), -INT64_C( 3096871022057764923),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2132479110947269839),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4666135228544429581),  INT64_C( 5331209912442096775),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(  771680867954444770), -INT64_C( 2097997478917954194),
+       INT64_C(                   0), -INT64_C( 3096871022057764923), -INT64_C( 4853309786737486110),  INT64_C(                   0),
+      -INT64_C(  900727167850391036),  INT64_C(                   0),  INT64_C( 5331209912442096775),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 2097997478917954194),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(  771680867954444770), -INT64_C( 2463420555988597594),
+       INT64_C(                   0),  INT64_C( 2132479110947269839),  INT64_C( 2721691543124220282),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2721691543124220282),  INT64_C(                   0),
+       INT64_C( 2132479110947269839),  INT64_C(                   0), -INT64_C(  900727167850391036),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 3096871022057764923), -INT64_C( 2463420555988597594), -INT64_C( 4853309786737486110),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 5331209912442096775),  INT64_C( 2132479110947269839),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2132479110947269839),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5277031669638573107),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 2859698187510023196),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 6262672901976892008),  INT64_C(                   0),
+       INT64_C(  195059310958211466),  INT64_C(                   0), -INT64_C( 1541110916998201402),  INT64_C( 6262672901976892008),
+       INT64_C( 2721691543124220282),  INT64_C(                   0), -INT64_C( 3949244143813592061),  INT64_C( 2132479110947269839),
+       INT64_C( 6631350859936174751),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2132479110947269839),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  346890846532612236),
+       INT64_C(                   0),  INT64_C(  195059310958211466), -INT64_C( 8799555821673553021),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1_gather_s64index_s64(pv, &(a[16]), simde_svld1_s64(pg, &(b[i])));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int64_t a[32];
+  int64_t b[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? ((simde_test_codegen_random_i64() & INT64_C(31)) - INT64_C(16)) : INT64_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1_gather_s64index_s64(pv, &(a[16]), simde_svld1_s64(pg, &(b[i])));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_s64index_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 2244453048670312220),  INT64_C( 9177577447284648768), -INT64_C( 1611286834051802721), -INT64_C( 2115537346319718009),
+      -INT64_C(  830137100364375359),  INT64_C( 8141819632260514670),  INT64_C( 2934487274068447655),  INT64_C( 2138585698941486029),
+      -INT64_C( 4248529048357595806),  INT64_C( 8067708111965862580), -INT64_C( 1649452035277342894),  INT64_C( 7617382500703419964),
+       INT64_C( 5914223148194033142), -INT64_C( 1514390794598393916),  INT64_C( 8037509385638722181), -INT64_C( 7519114031932162249),
+       INT64_C( 8366272695962510890),  INT64_C( 4959304040832954959), -INT64_C( 2316696664655155401), -INT64_C( 3970270936780971857),
+       INT64_C( 1372942322296277993),  INT64_C( 4801344126458728093), -INT64_C( 6484191741964679300), -INT64_C( 3689331127141195675),
+      -INT64_C( 6449310760884150873), -INT64_C( 4337348763912537471),  INT64_C( 7262313880169773611),  INT64_C( 4736155798162947595),
+       INT64_C( 1386876218408509329),  INT64_C( 1346697131475288742), -INT64_C( 8121400230769485593),  INT64_C( 8617418973924733627),
+       INT64_C( 1656568683835769944), -INT64_C( 1113318154584220525),  INT64_C( 8817802603629297996),  INT64_C( 7940240965335309779),
+       INT64_C( 2680017339274511019),  INT64_C( 3740851815338423537), -INT64_C( 5537347400218984211),  INT64_C(  703861569790801728),
+       INT64_C( 7104522357911592160),  INT64_C( 5882904406153508745),  INT64_C( 5447706328518469382), -INT64_C( 8826379458796517605),
+      -INT64_C( 8910775400884820350),  INT64_C(   35072192575550407), -INT64_C( 5073725413308008128),  INT64_C( 2356708191711213449),
+       INT64_C(  278214084381682780), -INT64_C( 6190291790165257955),  INT64_C(  611235555286842916), -INT64_C( 4575398405064905021),
+       INT64_C( 2078116558161810583), -INT64_C( 3181429545505716796),  INT64_C( 2148236103865716296), -INT64_C( 8510678554869168193),
+      -INT64_C( 5499400995238773870),  INT64_C( 8411521431076200760),  INT64_C( 2377915317326991497),  INT64_C( 1049383222045342996),
+       INT64_C( 6396322170902932771), -INT64_C( 1598784050938534353),  INT64_C( 3300518512577743947),  INT64_C( 6760964321820545610),
+      -INT64_C( 1213100246365736014), -INT64_C( 5826784475127060007),  INT64_C(  462790750205898534),  INT64_C( 1788667264431268155),
+       INT64_C( 5531005780056752146),  INT64_C( 5517095527986367613),  INT64_C( 5790213041434651800), -INT64_C( 2947720554435238247),
+      -INT64_C( 7883714883480911401),  INT64_C( 6911623304238603640),  INT64_C(  528344396990740208), -INT64_C( 8516274245133264332),
+       INT64_C( 6757206923077253406),  INT64_C( 3435936721034492553), -INT64_C( 6569755214353243555),  INT64_C( 1576099303680498084),
+      -INT64_C( 6401850245373119514),  INT64_C( 7473342096317293641),  INT64_C( 1809046776900217607),  INT64_C(  931205147377252575),
+      -INT64_C( 8230609501387541247),  INT64_C( 7752607439695167012), -INT64_C( 5889302246945732170),  INT64_C(  353656827852207287),
+      -INT64_C( 1983857897038888794),  INT64_C(  898934688193874858),  INT64_C( 1364445943477787761), -INT64_C( 8415301474293222352),
+      -INT64_C( 1136054694121743721),  INT64_C( 7483425632747933047), -INT64_C( 4737338696076356908), -INT64_C( 7099037476853895413),
+       INT64_C( 6032342851180097665),  INT64_C(  133696411096167805),  INT64_C( 2619530488077910542), -INT64_C(  917450705779537248),
+      -INT64_C( 1896171125558593153), -INT64_C( 2714206247739404249), -INT64_C( 7497419196180560459),  INT64_C( 1693215572319143963),
+      -INT64_C( 3240021433686803781),  INT64_C( 5375465712337314546), -INT64_C(  319740313640300797),  INT64_C(  919586796282039829),
+       INT64_C( 5314311709613110849),  INT64_C( 7600846256399247516), -INT64_C( 5220811463473326672),  INT64_C( 6566009774660588481),
+       INT64_C( 2737635011016019805),  INT64_C( 6323285492994803441), -INT64_C( 2900191625828883865), -INT64_C( 6342466533600975994) };
+  static const uint64_t a[] =
+    { UINT64_C(17383003479967100023), UINT64_C( 9417551231840402028), UINT64_C( 3725406258028241001), UINT64_C( 3186585589576438488),
+      UINT64_C( 5472798094834535026), UINT64_C( 2051371711483270659), UINT64_C( 7404970632326758735), UINT64_C( 5958686578984933839),
+      UINT64_C(  699825984493632907), UINT64_C( 3742057966027600926), UINT64_C( 9487544773326927798), UINT64_C(18343646661886669408),
+      UINT64_C( 5513847603301312118), UINT64_C(12550139050035413779), UINT64_C(15365047682644241923), UINT64_C( 8287088390652117903),
+      UINT64_C(11315141823198882444), UINT64_C( 3791959632496567800), UINT64_C(13761074319338541742), UINT64_C( 4745601811983961707),
+      UINT64_C( 4058871636860586541), UINT64_C( 6236861684337207335), UINT64_C(  957140958937971034), UINT64_C(18047701394734254464),
+      UINT64_C(11210028419774509338), UINT64_C(16063074898103548909), UINT64_C( 6388830886978610682), UINT64_C( 9835583884422356665),
+      UINT64_C( 2559298263142510708), UINT64_C(17550990615208556591), UINT64_C( 7005411518347999241), UINT64_C( 4417299822003275094) };
+  static const int64_t b[] =
+    {  INT64_C(                   6),  INT64_C(           268435456), -INT64_C(                  15),  INT64_C(                   0),
+       INT64_C(                   3),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+      -INT64_C(                   3),  INT64_C(           268435456),  INT64_C(                  14),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                   1),  INT64_C(           268435456), -INT64_C(                  13),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  10),  INT64_C(                   0),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                  14),  INT64_C(                   3),
+       INT64_C(                   3), -INT64_C(                   1),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  16),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                  10),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   0),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  15),
+      -INT64_C(                   8),  INT64_C(           268435456),  INT64_C(                   6),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                   2),  INT64_C(           268435456), -INT64_C(                   4),
+       INT64_C(           268435456),  INT64_C(                   7),  INT64_C(           268435456), -INT64_C(                   3),
+      -INT64_C(                  16),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456), -INT64_C(                  12),  INT64_C(           268435456),  INT64_C(           268435456),
+      -INT64_C(                  12), -INT64_C(                   8),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                  12),
+       INT64_C(                  12),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  10),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  11),  INT64_C(           268435456),
+       INT64_C(                  15),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+      -INT64_C(                   7),  INT64_C(           268435456),  INT64_C(                  14),  INT64_C(           268435456),
+       INT64_C(                  14),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                  10),
+      -INT64_C(                  12),  INT64_C(           268435456), -INT64_C(                  13),  INT64_C(                   5),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                  10),
+       INT64_C(                  13),  INT64_C(                   4), -INT64_C(                   5),  INT64_C(           268435456),
+      -INT64_C(                   2),  INT64_C(           268435456),  INT64_C(                   3),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                   5),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   5), -INT64_C(                   2) };
+  static const uint64_t e[] =
+    { UINT64_C(  957140958937971034), UINT64_C(                   0), UINT64_C( 9417551231840402028), UINT64_C(11315141823198882444),
+      UINT64_C( 4745601811983961707), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(12550139050035413779), UINT64_C(                   0), UINT64_C( 7005411518347999241), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 8287088390652117903), UINT64_C(                   0), UINT64_C( 3186585589576438488),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 7404970632326758735), UINT64_C(11315141823198882444),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 7005411518347999241), UINT64_C( 4745601811983961707),
+      UINT64_C( 4745601811983961707), UINT64_C( 8287088390652117903), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(17383003479967100023), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 7404970632326758735), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(11315141823198882444), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 9417551231840402028),
+      UINT64_C(  699825984493632907), UINT64_C(                   0), UINT64_C(  957140958937971034), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(15365047682644241923), UINT64_C(                   0), UINT64_C( 5513847603301312118),
+      UINT64_C(                   0), UINT64_C(18047701394734254464), UINT64_C(                   0), UINT64_C(12550139050035413779),
+      UINT64_C(17383003479967100023), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 5472798094834535026), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 5472798094834535026), UINT64_C(  699825984493632907), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 2559298263142510708),
+      UINT64_C( 2559298263142510708), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 7404970632326758735),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 2051371711483270659), UINT64_C(                   0),
+      UINT64_C( 4417299822003275094), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 3742057966027600926), UINT64_C(                   0), UINT64_C( 7005411518347999241), UINT64_C(                   0),
+      UINT64_C( 7005411518347999241), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6388830886978610682),
+      UINT64_C( 5472798094834535026), UINT64_C(                   0), UINT64_C( 3186585589576438488), UINT64_C( 6236861684337207335),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6388830886978610682),
+      UINT64_C(17550990615208556591), UINT64_C( 4058871636860586541), UINT64_C(18343646661886669408), UINT64_C(                   0),
+      UINT64_C(15365047682644241923), UINT64_C(                   0), UINT64_C( 4745601811983961707), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(18343646661886669408), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6236861684337207335), UINT64_C(15365047682644241923) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1_gather_s64index_u64(pv, &(a[16]), simde_svld1_s64(pg, &(b[i])));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint64_t a[32];
+  int64_t b[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? ((simde_test_codegen_random_i64() & INT64_C(31)) - INT64_C(16)) : INT64_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1_gather_s64index_u64(pv, &(a[16]), simde_svld1_s64(pg, &(b[i])));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_s64index_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 1977059602143223778),  INT64_C( 5833466782793279280), -INT64_C( 5141157535395490407), -INT64_C(  841172754273234699),
+       INT64_C( 1195371315083529965),  INT64_C( 4785014852895966710), -INT64_C( 5058438740873390945),  INT64_C( 1525381241236068960),
+       INT64_C( 3385683518947813644),  INT64_C( 4201203809315574370), -INT64_C( 6341883806876797056),  INT64_C( 3743064307129051317),
+       INT64_C( 8852137430554294898),  INT64_C( 5531778013961986030), -INT64_C( 2146090371068718263), -INT64_C( 7939368823512165002),
+      -INT64_C(  216994059263348372), -INT64_C( 7112227986878332364), -INT64_C( 2202993134438327203),  INT64_C( 5416229323637927290),
+      -INT64_C( 5743553544782453184),  INT64_C( 8665202874406457422),  INT64_C( 5558691892746743512),  INT64_C( 3658911855925437085),
+      -INT64_C( 5718786050482989450),  INT64_C( 2751018013163737754),  INT64_C( 4477296701474418690), -INT64_C( 8046663589735823056),
+       INT64_C( 4191202670595462424),  INT64_C( 1507047892247871094),  INT64_C( 1236814112636884044),  INT64_C( 9204944665130034452),
+      -INT64_C( 2722950008050991011), -INT64_C( 8230459978228554335), -INT64_C( 3400318063084916516), -INT64_C( 1697931225265732727),
+       INT64_C( 3258947570090928380),  INT64_C( 4399920497725397056), -INT64_C( 5195523196304258727), -INT64_C( 7115379958802225970),
+      -INT64_C( 9135208521397361280),  INT64_C( 2066891384610298384),  INT64_C( 4864193767696083612), -INT64_C( 4523622551840347654),
+       INT64_C( 9134433010572932355),  INT64_C( 8502970759456474913),  INT64_C( 4756576670335381833),  INT64_C( 9218047635370122987),
+      -INT64_C( 2218436504630150582),  INT64_C(  981439215101617486), -INT64_C( 8394483617286594826), -INT64_C( 4870743658540343956),
+      -INT64_C(   71869920636032674), -INT64_C( 9105778668778043952), -INT64_C( 6426848623740359516), -INT64_C( 8589502303297436004),
+      -INT64_C( 4985863110504530146),  INT64_C( 6951851090410141036),  INT64_C( 1457886965639952475), -INT64_C( 2473058119922234886),
+       INT64_C( 7552953268929582125),  INT64_C( 7677467545151938415), -INT64_C( 7017387070792454383), -INT64_C( 2548913493180694524),
+       INT64_C( 3830528940509973701),  INT64_C( 8168944100752525540), -INT64_C( 7179695928423850981),  INT64_C( 6189071307001241432),
+      -INT64_C( 9203599952757533109), -INT64_C( 5937766782559082554), -INT64_C( 8979957570967137748),  INT64_C(  706341381400608744),
+      -INT64_C( 1846651627900313021), -INT64_C( 3582712860762058233),  INT64_C( 7270483789503181623),  INT64_C( 2267749176615661489),
+      -INT64_C(  391146916467010933),  INT64_C( 8980419845108834095), -INT64_C( 2994960663297772913), -INT64_C( 9210495707482010830),
+      -INT64_C( 5098428231373280175),  INT64_C( 4476062013487502174), -INT64_C( 1055889880442536867), -INT64_C( 5874614357278614011),
+      -INT64_C( 4423888999098964647), -INT64_C( 5912800453147220477), -INT64_C(  490741776769926273), -INT64_C( 5318350536046333914),
+       INT64_C( 6284830817367106322), -INT64_C( 6964540710313092006),  INT64_C( 3901258635516217142), -INT64_C( 7687104138458884290),
+       INT64_C( 8699339427992562190), -INT64_C(  748025523059112736), -INT64_C( 3943108684172788734), -INT64_C(  399774813446143654),
+      -INT64_C( 6758188065637957728), -INT64_C( 3058154344384669221),  INT64_C( 5481213839626710717), -INT64_C( 3668570929880205777),
+       INT64_C( 7314622646514905885),  INT64_C( 2433226262861259803),  INT64_C(  683275945488526140),  INT64_C( 6984022281599428081),
+       INT64_C( 6241358213913016494),  INT64_C( 7380283966592752870),  INT64_C( 4798603341155653045), -INT64_C( 6460047558266798667),
+       INT64_C( 4707804620550740420),  INT64_C( 6388629451488139799),  INT64_C(  171277854559387085), -INT64_C( 3324688909660864451),
+       INT64_C( 5659658271834815470), -INT64_C( 2469319431448225857),  INT64_C( 6972798332212847476),  INT64_C(  286668056708955931),
+      -INT64_C( 5786324044231095762), -INT64_C( 1234885174440606992),  INT64_C( 5689298890355890033),  INT64_C( 3191487523368373043),
+       INT64_C( 6978964721610299195),  INT64_C( 3237029010296794501),  INT64_C( 4797657480760957971), -INT64_C( 5302473460473525697),
+      -INT64_C( 4450476457375696276) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   711.19), SIMDE_FLOAT64_C(   805.28), SIMDE_FLOAT64_C(   792.82), SIMDE_FLOAT64_C(  -387.50),
+      SIMDE_FLOAT64_C(  -122.45), SIMDE_FLOAT64_C(  -230.18), SIMDE_FLOAT64_C(  -747.45), SIMDE_FLOAT64_C(   140.94),
+      SIMDE_FLOAT64_C(  -522.68), SIMDE_FLOAT64_C(   606.30), SIMDE_FLOAT64_C(  -954.72), SIMDE_FLOAT64_C(  -391.81),
+      SIMDE_FLOAT64_C(   399.31), SIMDE_FLOAT64_C(   121.02), SIMDE_FLOAT64_C(  -104.05), SIMDE_FLOAT64_C(  -696.82),
+      SIMDE_FLOAT64_C(   798.90), SIMDE_FLOAT64_C(  -208.06), SIMDE_FLOAT64_C(  -842.22), SIMDE_FLOAT64_C(  -844.50),
+      SIMDE_FLOAT64_C(   703.10), SIMDE_FLOAT64_C(  -743.78), SIMDE_FLOAT64_C(   390.32), SIMDE_FLOAT64_C(   620.67),
+      SIMDE_FLOAT64_C(  -223.26), SIMDE_FLOAT64_C(  -341.97), SIMDE_FLOAT64_C(    84.22), SIMDE_FLOAT64_C(   473.04),
+      SIMDE_FLOAT64_C(    37.73), SIMDE_FLOAT64_C(   -87.74), SIMDE_FLOAT64_C(  -632.46), SIMDE_FLOAT64_C(  -251.08) };
+  static const int64_t b[] =
+    { -INT64_C(                   3),  INT64_C(           268435456), -INT64_C(                   8), -INT64_C(                  14),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  11),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   6),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                   3), -INT64_C(                  15),
+      -INT64_C(                   6),  INT64_C(                   9), -INT64_C(                   8),  INT64_C(           268435456),
+      -INT64_C(                   8),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+      -INT64_C(                   4),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                   3),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(                  14), -INT64_C(                   7), -INT64_C(                   7),  INT64_C(                  13),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   1),  INT64_C(                  13),
+      -INT64_C(                  16),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   7),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+      -INT64_C(                   1),  INT64_C(           268435456), -INT64_C(                   7), -INT64_C(                   1),
+      -INT64_C(                  16),  INT64_C(                   1),  INT64_C(                  14), -INT64_C(                   1),
+      -INT64_C(                   8),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                   4),
+       INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                   8),  INT64_C(                   9),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                   6),  INT64_C(           268435456),
+       INT64_C(                   8),  INT64_C(                   1), -INT64_C(                  15),  INT64_C(           268435456),
+      -INT64_C(                  15), -INT64_C(                   7),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(                   0),  INT64_C(           268435456), -INT64_C(                   9), -INT64_C(                   9),
+       INT64_C(                   6),  INT64_C(           268435456),  INT64_C(                  10),  INT64_C(                   0),
+       INT64_C(                  13), -INT64_C(                   3),  INT64_C(                   7), -INT64_C(                  14),
+       INT64_C(           268435456),  INT64_C(                  12),  INT64_C(           268435456), -INT64_C(                   1),
+       INT64_C(           268435456), -INT64_C(                  10),  INT64_C(                   9), -INT64_C(                  12),
+       INT64_C(                  14),  INT64_C(                   7),  INT64_C(           268435456), -INT64_C(                  16),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(                  10),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  15),
+       INT64_C(           268435456), -INT64_C(                   9),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(                   2),  INT64_C(                   7),  INT64_C(           268435456),  INT64_C(           268435456),
+       INT64_C(           268435456),  INT64_C(           268435456),  INT64_C(           268435456), -INT64_C(                  14),
+      -INT64_C(                   9) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(   121.02), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -522.68), SIMDE_FLOAT64_C(   792.82),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -230.18), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   390.32), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   121.02), SIMDE_FLOAT64_C(   805.28),
+      SIMDE_FLOAT64_C(  -954.72), SIMDE_FLOAT64_C(  -341.97), SIMDE_FLOAT64_C(  -522.68), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -522.68), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   399.31), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   121.02),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -632.46), SIMDE_FLOAT64_C(   606.30), SIMDE_FLOAT64_C(   606.30), SIMDE_FLOAT64_C(   -87.74),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -208.06), SIMDE_FLOAT64_C(   -87.74),
+      SIMDE_FLOAT64_C(   711.19), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   620.67),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -696.82), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   606.30), SIMDE_FLOAT64_C(  -696.82),
+      SIMDE_FLOAT64_C(   711.19), SIMDE_FLOAT64_C(  -208.06), SIMDE_FLOAT64_C(  -632.46), SIMDE_FLOAT64_C(  -696.82),
+      SIMDE_FLOAT64_C(  -522.68), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   399.31),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -522.68), SIMDE_FLOAT64_C(  -341.97),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   390.32), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -223.26), SIMDE_FLOAT64_C(  -208.06), SIMDE_FLOAT64_C(   805.28), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   805.28), SIMDE_FLOAT64_C(   606.30), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   798.90), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   140.94), SIMDE_FLOAT64_C(   140.94),
+      SIMDE_FLOAT64_C(   390.32), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    84.22), SIMDE_FLOAT64_C(   798.90),
+      SIMDE_FLOAT64_C(   -87.74), SIMDE_FLOAT64_C(   121.02), SIMDE_FLOAT64_C(   620.67), SIMDE_FLOAT64_C(   792.82),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    37.73), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -696.82),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -747.45), SIMDE_FLOAT64_C(  -341.97), SIMDE_FLOAT64_C(  -122.45),
+      SIMDE_FLOAT64_C(  -632.46), SIMDE_FLOAT64_C(   620.67), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   711.19),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    84.22),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   805.28),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   140.94), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -842.22), SIMDE_FLOAT64_C(   620.67), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   792.82),
+      SIMDE_FLOAT64_C(   140.94) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1_gather_s64index_f64(pv, &(a[16]), simde_svld1_s64(pg, &(b[i])));
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(simde_float64)];
+  simde_float64 a[32];
+  int64_t b[1024 / sizeof(simde_float64)];
+  simde_float64 e[1024 / sizeof(simde_float64)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? ((simde_test_codegen_random_i64() & INT64_C(31)) - INT64_C(16)) : INT64_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1_gather_s64index_f64(pv, &(a[16]), simde_svld1_s64(pg, &(b[i])));
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_u64index_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 3264369362953436270), -INT64_C(  938087018951843056),  INT64_C( 3894966707480371900),  INT64_C( 3388155809556519182),
+      -INT64_C(  724688226541533663), -INT64_C( 1978344500413076794), -INT64_C( 6525586571991129180),  INT64_C(   17903206362626638),
+       INT64_C( 9078050371104232481), -INT64_C( 6292194962946162016), -INT64_C( 2827888337868417659),  INT64_C( 1363227232208180748),
+       INT64_C(  553964088126386299), -INT64_C( 1206545328357980267), -INT64_C( 9082409745145715822),  INT64_C( 9162107262182677539),
+      -INT64_C( 1839893820851732984),  INT64_C( 6234038259748390698),  INT64_C( 9141012411207290852), -INT64_C( 6285414710702356669),
+       INT64_C(  301053818250426358),  INT64_C( 5903967794048314581),  INT64_C(  829935325494796714), -INT64_C( 4173684775022684211),
+      -INT64_C( 8039985562967528306), -INT64_C( 3844639080249228057), -INT64_C( 6751645891921162118),  INT64_C( 4900237135137709932),
+       INT64_C( 3574197060069297999),  INT64_C( 6271310706055234334), -INT64_C( 7281221986404411013),  INT64_C( 8467003858685854342),
+       INT64_C( 7305147864118668774), -INT64_C( 8209874019489159203),  INT64_C( 1678949383827073668), -INT64_C( 2345860860266470699),
+      -INT64_C( 1752621490516267007), -INT64_C( 9153089074253246376), -INT64_C( 9150329637212858021),  INT64_C( 3060739284227937953),
+       INT64_C( 5822907997125511390),  INT64_C( 9001487435376062575),  INT64_C( 4448267375697468814),  INT64_C(  366287072779516097),
+       INT64_C( 1594764271545059288),  INT64_C( 2362820330147405101),  INT64_C( 6801585101933785738),  INT64_C( 7239920733802478414),
+       INT64_C( 5882359877782038501),  INT64_C( 1938352760158102580), -INT64_C( 6658953213586095973),  INT64_C( 2436888562081783520),
+      -INT64_C( 7967624904416885000),  INT64_C( 1161433326701448307), -INT64_C( 1912096879466225795),  INT64_C( 1736738131321917117),
+      -INT64_C( 8495862479409789143),  INT64_C( 3041526983001272239),  INT64_C( 1870529159013170444), -INT64_C( 7909679490491332862),
+      -INT64_C( 4498197649281158925), -INT64_C( 2704381003351842400), -INT64_C( 1437245410620312168),  INT64_C( 4477503043424624423),
+       INT64_C(  976677958834470073),  INT64_C( 2856922148887032829), -INT64_C( 7629615161160265912),  INT64_C( 3445898538044042312),
+      -INT64_C(  936597028744783226),  INT64_C( 8625065287932075004),  INT64_C( 4609654079644880370), -INT64_C( 1181731555042451469),
+       INT64_C( 1921316432812086464), -INT64_C( 4835643572954503362),  INT64_C( 5141447574596521252), -INT64_C( 7886002154002895562),
+      -INT64_C( 7847819949039389986),  INT64_C( 3954129764385602392),  INT64_C( 5408166833240014193), -INT64_C( 1856193293744095528),
+      -INT64_C( 3398537152691009812),  INT64_C( 3169638837877134771), -INT64_C( 3373478721629368881), -INT64_C( 9175316142699570756),
+       INT64_C( 4145448582587256128),  INT64_C( 1896853593760103020), -INT64_C(  211057573741313208), -INT64_C( 8549402977662562490),
+       INT64_C( 2357573603194576120), -INT64_C(  529005072164145854),  INT64_C( 1736502497116792539),  INT64_C( 4516069489991932634),
+      -INT64_C(  631221151036805783), -INT64_C(  589641573788777687),  INT64_C( 3512013130283879122),  INT64_C( 7389282176548974600),
+      -INT64_C( 1902277451174426131),  INT64_C( 2042258505649233220) };
+  static const int64_t a[] =
+    {  INT64_C( 4199061248015598667),  INT64_C( 5708355532673048156),  INT64_C(  552889104760878137),  INT64_C( 4371476745289334598),
+       INT64_C( 3084298128914562718), -INT64_C( 3825171740358973057), -INT64_C( 1894722831159435530), -INT64_C( 4196261768378937962),
+       INT64_C( 4438621507104021921), -INT64_C( 2599768971010333809),  INT64_C(  335021668676720161),  INT64_C( 7112959256366407369),
+      -INT64_C( 4294346943090323604),  INT64_C( 2652004466674712333),  INT64_C( 6564431387106301350),  INT64_C( 6885162648746108010),
+      -INT64_C( 3095115575919550959),  INT64_C( 7374244993072361519),  INT64_C( 3519163739032730602),  INT64_C( 3930208871173005880),
+       INT64_C( 3738981662357001030),  INT64_C( 2999040282078849656), -INT64_C( 1806651889381271050),  INT64_C( 8645112697237620893),
+       INT64_C( 8567651883773490863), -INT64_C(  253243888982144236),  INT64_C( 4177552214832193638),  INT64_C( 6239443332401662958),
+      -INT64_C( 7287123786488800150),  INT64_C( 4556633304810228794), -INT64_C( 8620368411805682295), -INT64_C( 5164434363686364841) };
+  static const uint64_t b[] =
+    { UINT64_C(           268435456), UINT64_C(                  26), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                  12), UINT64_C(                  26), UINT64_C(                  22), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                  10), UINT64_C(                  31), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                   9), UINT64_C(                  29), UINT64_C(           268435456),
+      UINT64_C(                  28), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  17),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  20),
+      UINT64_C(                  26), UINT64_C(                  12), UINT64_C(                   0), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  31), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                  27), UINT64_C(           268435456), UINT64_C(                  23),
+      UINT64_C(                   4), UINT64_C(                  27), UINT64_C(                  28), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  31), UINT64_C(           268435456),
+      UINT64_C(                   3), UINT64_C(           268435456), UINT64_C(                   2), UINT64_C(           268435456),
+      UINT64_C(                  20), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                   3),
+      UINT64_C(                  12), UINT64_C(                  25), UINT64_C(                  11), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  13), UINT64_C(           268435456),
+      UINT64_C(                  28), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                   2),
+      UINT64_C(           268435456), UINT64_C(                  11), UINT64_C(           268435456), UINT64_C(                   0),
+      UINT64_C(                  21), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  14),
+      UINT64_C(                   9), UINT64_C(           268435456), UINT64_C(                  28), UINT64_C(                   9),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  31), UINT64_C(                  19),
+      UINT64_C(           268435456), UINT64_C(                  31), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                  14), UINT64_C(                   2), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                  21), UINT64_C(           268435456) };
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C( 4177552214832193638),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 4294346943090323604),  INT64_C( 4177552214832193638), -INT64_C( 1806651889381271050),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(  335021668676720161), -INT64_C( 5164434363686364841),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 2599768971010333809),  INT64_C( 4556633304810228794),  INT64_C(                   0),
+      -INT64_C( 7287123786488800150),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7374244993072361519),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3738981662357001030),
+       INT64_C( 4177552214832193638), -INT64_C( 4294346943090323604),  INT64_C( 4199061248015598667),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5164434363686364841),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 6239443332401662958),  INT64_C(                   0),  INT64_C( 8645112697237620893),
+       INT64_C( 3084298128914562718),  INT64_C( 6239443332401662958), -INT64_C( 7287123786488800150),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5164434363686364841),  INT64_C(                   0),
+       INT64_C( 4371476745289334598),  INT64_C(                   0),  INT64_C(  552889104760878137),  INT64_C(                   0),
+       INT64_C( 3738981662357001030),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4371476745289334598),
+      -INT64_C( 4294346943090323604), -INT64_C(  253243888982144236),  INT64_C( 7112959256366407369),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2652004466674712333),  INT64_C(                   0),
+      -INT64_C( 7287123786488800150),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  552889104760878137),
+       INT64_C(                   0),  INT64_C( 7112959256366407369),  INT64_C(                   0),  INT64_C( 4199061248015598667),
+       INT64_C( 2999040282078849656),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 6564431387106301350),
+      -INT64_C( 2599768971010333809),  INT64_C(                   0), -INT64_C( 7287123786488800150), -INT64_C( 2599768971010333809),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5164434363686364841),  INT64_C( 3930208871173005880),
+       INT64_C(                   0), -INT64_C( 5164434363686364841),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 6564431387106301350),  INT64_C(  552889104760878137),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 2999040282078849656),  INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1_gather_u64index_s64(pv, a, simde_svld1_u64(pg, &(b[i])));
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int64_t a[32];
+  uint64_t b[1024 / sizeof(int64_t)];
+  int64_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? (simde_test_codegen_random_u64() & UINT64_C(31)) : UINT64_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1_gather_u64index_s64(pv, a, simde_svld1_u64(pg, &(b[i])));
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_u64index_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(  690557067433272684),  INT64_C( 2409722122750015610), -INT64_C( 1178544514714419301), -INT64_C( 2242632857893956129),
+      -INT64_C( 9032869519740935764),  INT64_C( 4010403363867823621), -INT64_C(  864151177761710833), -INT64_C( 2617422408987140736),
+      -INT64_C( 2020096578181132179),  INT64_C( 3859038588052723387),  INT64_C( 4699304726767326509), -INT64_C( 2526594780179307547),
+       INT64_C( 6884957802395171020),  INT64_C( 3601265639307015582),  INT64_C( 7934123777107181849), -INT64_C( 5739429924423128818),
+      -INT64_C( 7859090365958411286),  INT64_C(  221046822139241947),  INT64_C( 4506405787653735825),  INT64_C( 7617299450749979681),
+      -INT64_C( 3294973605095927616),  INT64_C( 9113249266338536587),  INT64_C( 7978163356523058505),  INT64_C( 5194103412227273517),
+       INT64_C( 9151949905524952377), -INT64_C( 4591300558342277923),  INT64_C( 3421875907537330369),  INT64_C( 5924186354024705893),
+       INT64_C( 5868335952266670845), -INT64_C( 7966757992859474888),  INT64_C(  177078118364719684),  INT64_C( 4572884532858999050),
+      -INT64_C( 5395698841369380775), -INT64_C( 2205120469166376444),  INT64_C( 2963259836791719040), -INT64_C( 8183388839691350034),
+       INT64_C( 4822926658612469435), -INT64_C( 6182462446065265740), -INT64_C( 1889006092486747521), -INT64_C( 7802059915000474123),
+       INT64_C( 4801886748379190306), -INT64_C( 5412826245742937843), -INT64_C( 8935674313532266463), -INT64_C( 5072347756431076560),
+       INT64_C( 3408305868085225339), -INT64_C( 4008406357875695498), -INT64_C(  215925608928922897), -INT64_C( 8123472193259196941),
+      -INT64_C( 8117206056618664696), -INT64_C(  777827483268759612), -INT64_C( 1650724341371759284), -INT64_C( 4124532281183101665),
+       INT64_C(  341509682452519700), -INT64_C( 2448933928951613688),  INT64_C(  546923367496185273), -INT64_C( 2976318865120031956),
+      -INT64_C(  892907983019466408),  INT64_C( 7432915956105612216),  INT64_C( 6586986349026746235), -INT64_C(  481612887215397704),
+      -INT64_C( 3713450901125442408), -INT64_C(  482661969840146121), -INT64_C( 3897930277600861347), -INT64_C( 4826851493099131543),
+      -INT64_C(  591739836528814872),  INT64_C( 8766301877862981424),  INT64_C( 3703909198032340108),  INT64_C( 2737134404844300570),
+       INT64_C( 2633739317811494101),  INT64_C( 2260943983319673290),  INT64_C( 7889781334036211072), -INT64_C( 3229458078035559221),
+       INT64_C(  431770776680026340), -INT64_C( 3670631277940387746), -INT64_C( 5084117659116123215), -INT64_C( 6259175801854223023),
+      -INT64_C( 2485283858828588479),  INT64_C( 7739961228177337935),  INT64_C( 7444415096684511401),  INT64_C( 4858495604394168829),
+      -INT64_C( 4845801258839183773),  INT64_C( 1501318717871001263),  INT64_C( 2503994956149638210), -INT64_C( 5669661060183525876),
+       INT64_C(  101423705675272255), -INT64_C( 4295800166169198110),  INT64_C( 1426757107429674372),  INT64_C( 4706949916157653330) };
+  static const uint64_t a[] =
+    { UINT64_C( 6423305252630387213), UINT64_C( 6427493893012913465), UINT64_C(11576105273482822965), UINT64_C(11029570079632371452),
+      UINT64_C( 7184112400762863681), UINT64_C(18019684706803824917), UINT64_C( 2095708884375079436), UINT64_C(  164394308596324642),
+      UINT64_C( 7608847320982698763), UINT64_C(   37776967023602888), UINT64_C(16932843868858438847), UINT64_C(  947692170928322404),
+      UINT64_C( 6402388659177423388), UINT64_C(17364309171392346886), UINT64_C( 6806009937807830976), UINT64_C(  708377880123608260),
+      UINT64_C(17876004019142989611), UINT64_C( 2697353147507210574), UINT64_C(15038680288767852123), UINT64_C(  874661367181162284),
+      UINT64_C( 4426156554324581506), UINT64_C(11916571112340414166), UINT64_C( 6576575069445361256), UINT64_C(14543696901929491431),
+      UINT64_C( 5863873056878730548), UINT64_C(12607525088846945031), UINT64_C( 9909157926782825211), UINT64_C(14145849931269863745),
+      UINT64_C( 4436123931285884356), UINT64_C(  312583500677913699), UINT64_C( 2279581028377852023), UINT64_C(16141172760849675435) };
+  static const uint64_t b[] =
+    { UINT64_C(                   5), UINT64_C(           268435456), UINT64_C(                  11), UINT64_C(                  10),
+      UINT64_C(                  19), UINT64_C(           268435456), UINT64_C(                  10), UINT64_C(                   7),
+      UINT64_C(                  30), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                   2),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  18),
+      UINT64_C(                  24), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                   2), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                   1), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                  10), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                   5), UINT64_C(                  29), UINT64_C(           268435456), UINT64_C(                  16),
+      UINT64_C(           268435456), UINT64_C(                   6), UINT64_C(                   3), UINT64_C(                   7),
+      UINT64_C(           268435456), UINT64_C(                  28), UINT64_C(                   8), UINT64_C(                  12),
+      UINT64_C(           268435456), UINT64_C(                  19), UINT64_C(                  21), UINT64_C(                  13),
+      UINT64_C(                  27), UINT64_C(                  18), UINT64_C(                  27), UINT64_C(                  26),
+      UINT64_C(           268435456), UINT64_C(                  24), UINT64_C(           268435456), UINT64_C(                  29),
+      UINT64_C(                  16), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  14),
+      UINT64_C(                   5), UINT64_C(                  21), UINT64_C(                   9), UINT64_C(                  11),
+      UINT64_C(                  13), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  17),
+      UINT64_C(           268435456), UINT64_C(                  22), UINT64_C(                  18), UINT64_C(                  21),
+      UINT64_C(                  19), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                  13), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                   7),
+      UINT64_C(           268435456), UINT64_C(                  16), UINT64_C(           268435456), UINT64_C(           268435456) };
+  static const uint64_t e[] =
+    { UINT64_C(18019684706803824917), UINT64_C(                   0), UINT64_C(  947692170928322404), UINT64_C(16932843868858438847),
+      UINT64_C(  874661367181162284), UINT64_C(                   0), UINT64_C(16932843868858438847), UINT64_C(  164394308596324642),
+      UINT64_C( 2279581028377852023), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(11576105273482822965),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(15038680288767852123),
+      UINT64_C( 5863873056878730548), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(11576105273482822965), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 6427493893012913465), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(16932843868858438847), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(18019684706803824917), UINT64_C(  312583500677913699), UINT64_C(                   0), UINT64_C(17876004019142989611),
+      UINT64_C(                   0), UINT64_C( 2095708884375079436), UINT64_C(11029570079632371452), UINT64_C(  164394308596324642),
+      UINT64_C(                   0), UINT64_C( 4436123931285884356), UINT64_C( 7608847320982698763), UINT64_C( 6402388659177423388),
+      UINT64_C(                   0), UINT64_C(  874661367181162284), UINT64_C(11916571112340414166), UINT64_C(17364309171392346886),
+      UINT64_C(14145849931269863745), UINT64_C(15038680288767852123), UINT64_C(14145849931269863745), UINT64_C( 9909157926782825211),
+      UINT64_C(                   0), UINT64_C( 5863873056878730548), UINT64_C(                   0), UINT64_C(  312583500677913699),
+      UINT64_C(17876004019142989611), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6806009937807830976),
+      UINT64_C(18019684706803824917), UINT64_C(11916571112340414166), UINT64_C(   37776967023602888), UINT64_C(  947692170928322404),
+      UINT64_C(17364309171392346886), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 2697353147507210574),
+      UINT64_C(                   0), UINT64_C( 6576575069445361256), UINT64_C(15038680288767852123), UINT64_C(11916571112340414166),
+      UINT64_C(  874661367181162284), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(17364309171392346886), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(  164394308596324642),
+      UINT64_C(                   0), UINT64_C(17876004019142989611), UINT64_C(                   0), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1_gather_u64index_u64(pv, a, simde_svld1_u64(pg, &(b[i])));
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint64_t a[32];
+  uint64_t b[1024 / sizeof(uint64_t)];
+  uint64_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? (simde_test_codegen_random_u64() & UINT64_C(31)) : UINT64_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1_gather_u64index_u64(pv, a, simde_svld1_u64(pg, &(b[i])));
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svld1_gather_u64index_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 2955007244802769502), -INT64_C( 6765745965905389906),  INT64_C( 3929216275090697586), -INT64_C( 1718341762640145863),
+       INT64_C( 6763867531856378743),  INT64_C( 4247579205167188844),  INT64_C(  212835531298203740), -INT64_C( 4475578251491274314),
+       INT64_C( 9049322718663146376), -INT64_C( 5605646355385227214), -INT64_C( 6056386066419494617),  INT64_C( 8034855933884914037),
+       INT64_C( 2671544917056441221), -INT64_C( 4238920109632004061),  INT64_C( 8630490083133660453),  INT64_C( 8887775755941407490),
+       INT64_C( 6708997000770223619), -INT64_C( 5518875957196801531), -INT64_C( 3883911813207875680),  INT64_C(  895664409457873150),
+      -INT64_C( 6152447445344026616),  INT64_C( 1844706157056062807), -INT64_C(  619292255181903915),  INT64_C( 3186676223265413668),
+      -INT64_C( 5825392543785993255),  INT64_C(  149796557839234689), -INT64_C( 3997217740902379626), -INT64_C( 6525382934496185823),
+       INT64_C( 7814111399610932841), -INT64_C( 3751364117548103998), -INT64_C( 5136669182802554806),  INT64_C( 4955207373133032532),
+      -INT64_C(  674565552541931444), -INT64_C( 3567179088917165699),  INT64_C( 1131655558101522789),  INT64_C( 7727599854287761694),
+       INT64_C( 3892594114065220315),  INT64_C( 2567446232362969423), -INT64_C( 1294270527684256449),  INT64_C(  436607458730260612),
+       INT64_C( 5067986604356120934), -INT64_C( 1952949646601404925),  INT64_C( 6761284958873847063),  INT64_C( 5066848507478981408),
+      -INT64_C( 8935498449132624191), -INT64_C( 1693023805627885575),  INT64_C( 7522598282372997168),  INT64_C( 3928269676583544414),
+      -INT64_C( 7102760844233086614),  INT64_C( 1061931277382038275), -INT64_C( 8301123474461127908), -INT64_C( 1329038514007146526),
+       INT64_C( 7816636424233909304), -INT64_C( 8150110760265992712),  INT64_C( 6360137615373695624), -INT64_C( 7732893467047621314),
+      -INT64_C( 4282665083140536390),  INT64_C( 6313904626120446367), -INT64_C( 8122435094401150600), -INT64_C( 1130966225664215202),
+       INT64_C( 5194800642833759879), -INT64_C( 6297448247047114380),  INT64_C( 6226753120217048970),  INT64_C( 4826555583095159510),
+       INT64_C( 2814377800483868444), -INT64_C( 1570062607339329697), -INT64_C( 9009118260561130069), -INT64_C( 8870251337841047064),
+      -INT64_C( 8615008777331442536), -INT64_C( 8428119606952469569), -INT64_C( 1997019897918468837), -INT64_C(  640235314651605455),
+       INT64_C( 9051025505079420649),  INT64_C( 2015823729499353743), -INT64_C( 9128185870268880782),  INT64_C( 3483595091482433793),
+      -INT64_C( 2460690193732887906), -INT64_C( 8310191231996299887), -INT64_C( 4954438179420991891),  INT64_C( 3358969060742945062),
+       INT64_C( 5853100343575634191),  INT64_C( 3999073095949452760), -INT64_C( 1399999605039138530),  INT64_C( 3624260955809623692),
+       INT64_C( 1290784017411462615),  INT64_C( 8741631304011140174),  INT64_C(  337457129895052796), -INT64_C( 3033337082306099310),
+      -INT64_C( 8247403461962009023),  INT64_C( 1150659888605990690), -INT64_C( 4775926479620847556), -INT64_C( 8837371692952921977),
+       INT64_C( 4655747976499546319),  INT64_C( 8447543683720233498),  INT64_C( 1505857646805716476), -INT64_C( 9114171076038207302),
+       INT64_C( 2745835732035666621), -INT64_C( 8566534177139992466), -INT64_C( 2144391648821295461), -INT64_C( 8565455285758404625),
+       INT64_C( 5339157945167163877), -INT64_C( 7679182748657751209), -INT64_C( 6530225272963391659), -INT64_C( 8708158881353285679),
+       INT64_C( 7007479017170897432), -INT64_C( 7599064329660059140) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(  -256.97), SIMDE_FLOAT64_C(   492.16), SIMDE_FLOAT64_C(   152.25), SIMDE_FLOAT64_C(   368.95),
+      SIMDE_FLOAT64_C(   594.23), SIMDE_FLOAT64_C(   -84.37), SIMDE_FLOAT64_C(   816.65), SIMDE_FLOAT64_C(   560.58),
+      SIMDE_FLOAT64_C(  -797.99), SIMDE_FLOAT64_C(  -784.53), SIMDE_FLOAT64_C(   124.34), SIMDE_FLOAT64_C(   179.64),
+      SIMDE_FLOAT64_C(   331.10), SIMDE_FLOAT64_C(  -263.26), SIMDE_FLOAT64_C(   475.05), SIMDE_FLOAT64_C(   603.80),
+      SIMDE_FLOAT64_C(   -93.81), SIMDE_FLOAT64_C(  -674.79), SIMDE_FLOAT64_C(  -525.92), SIMDE_FLOAT64_C(   997.58),
+      SIMDE_FLOAT64_C(  -154.82), SIMDE_FLOAT64_C(  -421.06), SIMDE_FLOAT64_C(   306.60), SIMDE_FLOAT64_C(   121.98),
+      SIMDE_FLOAT64_C(   893.12), SIMDE_FLOAT64_C(  -247.88), SIMDE_FLOAT64_C(    34.82), SIMDE_FLOAT64_C(  -292.35),
+      SIMDE_FLOAT64_C(  -238.91), SIMDE_FLOAT64_C(  -307.24), SIMDE_FLOAT64_C(   775.04), SIMDE_FLOAT64_C(   504.11) };
+  static const uint64_t b[] =
+    { UINT64_C(                  31), UINT64_C(                  20), UINT64_C(           268435456), UINT64_C(                  24),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                   4),
+      UINT64_C(           268435456), UINT64_C(                  10), UINT64_C(                   5), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                  24), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                  20), UINT64_C(                   1), UINT64_C(           268435456),
+      UINT64_C(                   9), UINT64_C(           268435456), UINT64_C(                  24), UINT64_C(           268435456),
+      UINT64_C(                  14), UINT64_C(           268435456), UINT64_C(                  25), UINT64_C(                  23),
+      UINT64_C(           268435456), UINT64_C(                   6), UINT64_C(                  26), UINT64_C(           268435456),
+      UINT64_C(                  28), UINT64_C(                  18), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  18), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                   5), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                  16), UINT64_C(                  30), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(                  21), UINT64_C(           268435456), UINT64_C(                  18), UINT64_C(                   2),
+      UINT64_C(           268435456), UINT64_C(                   6), UINT64_C(           268435456), UINT64_C(                  15),
+      UINT64_C(                   6), UINT64_C(           268435456), UINT64_C(                   2), UINT64_C(                  29),
+      UINT64_C(           268435456), UINT64_C(                  29), UINT64_C(           268435456), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(                  29), UINT64_C(                   4), UINT64_C(                  17),
+      UINT64_C(                  23), UINT64_C(                   6), UINT64_C(                  15), UINT64_C(                  16),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  18), UINT64_C(           268435456),
+      UINT64_C(                  31), UINT64_C(                   1), UINT64_C(                  24), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  29), UINT64_C(           268435456),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  22),
+      UINT64_C(                  21), UINT64_C(           268435456), UINT64_C(                  19), UINT64_C(                  13),
+      UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(           268435456), UINT64_C(                  19),
+      UINT64_C(           268435456), UINT64_C(                  18), UINT64_C(                  16), UINT64_C(                  13),
+      UINT64_C(           268435456), UINT64_C(                  25), UINT64_C(                  24), UINT64_C(                   7),
+      UINT64_C(           268435456), UINT64_C(                  17) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(   504.11), SIMDE_FLOAT64_C(  -154.82), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   893.12),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   594.23),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   124.34), SIMDE_FLOAT64_C(   -84.37), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   893.12), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -154.82), SIMDE_FLOAT64_C(   492.16), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -784.53), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   893.12), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   475.05), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -247.88), SIMDE_FLOAT64_C(   121.98),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   816.65), SIMDE_FLOAT64_C(    34.82), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -238.91), SIMDE_FLOAT64_C(  -525.92), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -525.92), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -84.37), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   -93.81), SIMDE_FLOAT64_C(   775.04), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -421.06), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -525.92), SIMDE_FLOAT64_C(   152.25),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   816.65), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   603.80),
+      SIMDE_FLOAT64_C(   816.65), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   152.25), SIMDE_FLOAT64_C(  -307.24),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -307.24), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -307.24), SIMDE_FLOAT64_C(   594.23), SIMDE_FLOAT64_C(  -674.79),
+      SIMDE_FLOAT64_C(   121.98), SIMDE_FLOAT64_C(   816.65), SIMDE_FLOAT64_C(   603.80), SIMDE_FLOAT64_C(   -93.81),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -525.92), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   504.11), SIMDE_FLOAT64_C(   492.16), SIMDE_FLOAT64_C(   893.12), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -307.24), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   306.60),
+      SIMDE_FLOAT64_C(  -421.06), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   997.58), SIMDE_FLOAT64_C(  -263.26),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   997.58),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -525.92), SIMDE_FLOAT64_C(   -93.81), SIMDE_FLOAT64_C(  -263.26),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -247.88), SIMDE_FLOAT64_C(   893.12), SIMDE_FLOAT64_C(   560.58),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -674.79) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t rv;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svld1_gather_u64index_f64(pv, a, simde_svld1_u64(pg, &(b[i])));
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(simde_float64)];
+  simde_float64 a[32];
+  uint64_t b[1024 / sizeof(simde_float64)];
+  simde_float64 e[1024 / sizeof(simde_float64)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(sizeof(a) / sizeof(a[0]), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  /* Indices of inactive lanes point far outside of a, so an
+   * implementation which loads them will fault. */
+  for (int32_t j = 0 ; j < len ; j++) {
+    b[j] = (p[j] < 0) ? (simde_test_codegen_random_u64() & UINT64_C(31)) : UINT64_C(0x10000000);
+  }
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    ev = simde_svld1_gather_u64index_f64(pv, a, simde_svld1_u64(pg, &(b[i])));
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, sizeof(a) / sizeof(a[0]), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sb_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sb_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sb_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sb_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sb_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sb_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1ub_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1ub_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1ub_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1ub_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1ub_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1ub_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sh_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sh_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sh_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sh_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1uh_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1uh_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1uh_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1uh_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sw_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1sw_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1uw_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1uw_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_s32index_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_s32index_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_s32index_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_u32index_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_u32index_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_u32index_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_s64index_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_s64index_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_s64index_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_u64index_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_u64index_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svld1_gather_u64index_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
@@ -0,0 +1,5696 @@
+#define SIMDE_TEST_ARM_SVE_INSN mad
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/mad.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+
+static int
+test_simde_svmad_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0) };
+  static const int8_t a[] =
+    { -INT8_C( 116), -INT8_C(  22),  INT8_C(  43),  INT8_C(  88), -INT8_C(  52),  INT8_C(  85), -INT8_C(  54),  INT8_C(  44),
+       INT8_C(  84),  INT8_C( 100), -INT8_C( 124), -INT8_C(  79), -INT8_C( 126), -INT8_C(  20),  INT8_C( 120),  INT8_C(  60),
+      -INT8_C(  53),  INT8_C(  62), -INT8_C( 117), -INT8_C( 101),  INT8_C( 117), -INT8_C( 101), -INT8_C( 117),  INT8_C( 123),
+      -INT8_C( 124), -INT8_C(  36),  INT8_C(  65), -INT8_C(  43),  INT8_C(  29),  INT8_C(  27), -INT8_C(  68), -INT8_C(  87),
+       INT8_C(   6), -INT8_C(  24),  INT8_C(   2), -INT8_C(  46),  INT8_C(  61), -INT8_C(  52), -INT8_C(   2), -INT8_C( 111),
+       INT8_C(  48), -INT8_C( 126),  INT8_C(  66), -INT8_C(  78),  INT8_C( 111), -INT8_C(  70), -INT8_C(  18),  INT8_C(  58),
+      -INT8_C(   7),  INT8_C( 122), -INT8_C(  43),  INT8_C( 110),  INT8_C(  21),  INT8_C(  96), -INT8_C(  23), -INT8_C( 102),
+       INT8_C(  60),  INT8_C(  42),  INT8_C( 111),  INT8_C(  90),  INT8_C(  70),  INT8_C(  44),  INT8_C(   3),  INT8_C(  76),
+       INT8_C(  20),  INT8_C(   5),  INT8_C(  30),  INT8_C(  81), -INT8_C(  46),  INT8_C(  28), -INT8_C(  30),  INT8_C(   2),
+      -INT8_C(  97),  INT8_C(  36), -INT8_C(  75),  INT8_C(  14), -INT8_C(  33), -INT8_C(  93),  INT8_C(  72), -INT8_C(  40),
+       INT8_C(  29),  INT8_C(  30),  INT8_C(  70),  INT8_C(  51),  INT8_C( 126),  INT8_C(  47), -INT8_C(  51), -INT8_C(  69),
+       INT8_C(  89),  INT8_C(  60),  INT8_C(  21), -INT8_C(  97),  INT8_C( 104),  INT8_C(  24), -INT8_C(  21),  INT8_C( 124),
+       INT8_C(  30),  INT8_C(   9), -INT8_C(  51), -INT8_C(  16),  INT8_C(  38), -INT8_C(  81), -INT8_C(  14), -INT8_C(  59),
+      -INT8_C(  44), -INT8_C(  89), -INT8_C(  45), -INT8_C(  77),  INT8_C(  75),  INT8_C(  27), -INT8_C( 117),  INT8_C( 104),
+       INT8_C(  57), -INT8_C(  47), -INT8_C( 101), -INT8_C(  72),  INT8_C(   0),  INT8_C( 104),  INT8_C( 115),  INT8_C(  89),
+      -INT8_C(  91), -INT8_C( 120), -INT8_C(   7),  INT8_C(  13), -INT8_C(  96), -INT8_C(  28), -INT8_C( 118), -INT8_C(  66),
+      -INT8_C(  18),  INT8_C(  87), -INT8_C(  82),  INT8_C(  20),  INT8_C(   7), -INT8_C(  95), -INT8_C(  39), -INT8_C(  37),
+       INT8_C(  72), -INT8_C(  84), -INT8_C( 114), -INT8_C( 109), -INT8_C(  57),  INT8_C(  25), -INT8_C(   4),  INT8_C(   1),
+      -INT8_C(  22), -INT8_C( 105), -INT8_C(  71), -INT8_C(  22),  INT8_C(   0),  INT8_C(  44),  INT8_C(  67), -INT8_C(  91),
+      -INT8_C(  76),  INT8_C(  60), -INT8_C(  78),  INT8_C(  84),  INT8_C(  33),  INT8_C(  60),  INT8_C(  19),  INT8_C(  15),
+      -INT8_C( 108), -INT8_C(  63),  INT8_C(  35), -INT8_C( 101),  INT8_C(  98), -INT8_C(   4),  INT8_C( 118), -INT8_C(  85),
+      -INT8_C(  88),  INT8_C(   4),  INT8_C(  62),  INT8_C( 111),  INT8_C(  29),  INT8_C(  58),  INT8_C( 112),  INT8_C(   7),
+      -INT8_C(  46),  INT8_C(  41), -INT8_C(  15), -INT8_C(  46),  INT8_C(  85),  INT8_C(  52),  INT8_C( 119),  INT8_C(   9),
+       INT8_C( 113),  INT8_C(  41),  INT8_C(  94), -INT8_C( 110),  INT8_C( 102),  INT8_C( 113), -INT8_C(  95), -INT8_C(   6),
+       INT8_C(  50), -INT8_C(  60), -INT8_C( 107), -INT8_C( 107), -INT8_C(  64),  INT8_C(  11),  INT8_C(  64),  INT8_C( 104),
+       INT8_C(  15),  INT8_C( 126), -INT8_C(  41),  INT8_C(  44), -INT8_C(  71),  INT8_C(  72),  INT8_C(  51), -INT8_C( 117),
+       INT8_C( 113),  INT8_C(  36),  INT8_C(  93), -INT8_C(  57),  INT8_C(  88), -INT8_C(  44), -INT8_C(  48), -INT8_C(  55),
+      -INT8_C(   3),  INT8_C(  46),  INT8_C(  91),  INT8_C(  99), -INT8_C(  97), -INT8_C(   4),  INT8_C(  93), -INT8_C(  46),
+      -INT8_C(  64), -INT8_C(  14),  INT8_C( 103),      INT8_MIN, -INT8_C(   3), -INT8_C(  89), -INT8_C(  24),  INT8_C(  12),
+       INT8_C(  37), -INT8_C(  64),  INT8_C(  56), -INT8_C(  34),  INT8_C(   8),  INT8_C( 107),  INT8_C( 105),  INT8_C( 121),
+      -INT8_C( 113), -INT8_C(  58),  INT8_C(  64), -INT8_C(  24), -INT8_C( 102),  INT8_C(  17), -INT8_C(  79), -INT8_C( 104),
+       INT8_C(  63),  INT8_C(  13), -INT8_C(   5), -INT8_C(  33),  INT8_C(   9),  INT8_C(  89), -INT8_C(  79), -INT8_C(  54),
+       INT8_C(  75),  INT8_C(  24),  INT8_C(  74),  INT8_C(  73), -INT8_C(  65),  INT8_C(  51),  INT8_C(  85), -INT8_C(  28),
+      -INT8_C(  13), -INT8_C( 114), -INT8_C(  61), -INT8_C(   5), -INT8_C(   7),  INT8_C(  44),  INT8_C( 116), -INT8_C( 119),
+      -INT8_C(  13), -INT8_C(  75),  INT8_C( 113), -INT8_C( 115), -INT8_C(  58),  INT8_C(  34),  INT8_C(  37),  INT8_C(   5),
+       INT8_C(  47),  INT8_C(  33), -INT8_C(  28),  INT8_C(  57),  INT8_C( 122), -INT8_C( 107),  INT8_C(   3), -INT8_C(  59),
+      -INT8_C(  83),  INT8_C(  77),  INT8_C(  14),  INT8_C( 108),      INT8_MIN,  INT8_C( 100),  INT8_C(  81),  INT8_C( 115),
+      -INT8_C(  14),  INT8_C(  20),  INT8_C( 110), -INT8_C(  21),  INT8_C(  64), -INT8_C(  29),  INT8_C( 116),  INT8_C(  51),
+      -INT8_C( 104), -INT8_C(  27), -INT8_C(  63),  INT8_C(  94),  INT8_C(   8), -INT8_C(  26),  INT8_C(  99),  INT8_C(  55),
+       INT8_C(   7),  INT8_C(  72),  INT8_C( 112), -INT8_C( 127), -INT8_C(  35),  INT8_C( 115),  INT8_C(  71), -INT8_C( 117),
+      -INT8_C(  63),  INT8_C(  85), -INT8_C(   9),  INT8_C(  65), -INT8_C(  71),  INT8_C(  72), -INT8_C(  75), -INT8_C(  85),
+       INT8_C(  92),  INT8_C(  35), -INT8_C( 105), -INT8_C(  99),  INT8_C(   6),  INT8_C(  11), -INT8_C(  48), -INT8_C(  98),
+      -INT8_C(  15), -INT8_C( 111), -INT8_C(   4), -INT8_C(   7),  INT8_C( 120),  INT8_C(  96),  INT8_C(  48),      INT8_MAX,
+      -INT8_C(  88), -INT8_C(  95),  INT8_C(   1), -INT8_C( 123),  INT8_C(  20),  INT8_C(  72),  INT8_C(  16), -INT8_C(  43),
+      -INT8_C(  99),  INT8_C(   8),  INT8_C(  23),  INT8_C(  87),  INT8_C(  80), -INT8_C(  52),  INT8_C(   2), -INT8_C(  83),
+      -INT8_C(  17), -INT8_C( 103),  INT8_C(  74), -INT8_C(  10), -INT8_C(  91),  INT8_C(  26), -INT8_C( 108), -INT8_C( 106),
+      -INT8_C(  84), -INT8_C( 111), -INT8_C( 113),  INT8_C(  36), -INT8_C(  15), -INT8_C(  65), -INT8_C(  93), -INT8_C( 103),
+       INT8_C(  96), -INT8_C(  92),  INT8_C(  30),  INT8_C( 117), -INT8_C(  20),  INT8_C(  47),  INT8_C(  74), -INT8_C( 118),
+       INT8_C(  55),  INT8_C(  97), -INT8_C(  31), -INT8_C( 121),  INT8_C(  45), -INT8_C(  29),  INT8_C(  52),  INT8_C(  29),
+       INT8_C( 125),  INT8_C( 126),  INT8_C(  19),  INT8_C(  34), -INT8_C( 103), -INT8_C(  89), -INT8_C(  72),  INT8_C(  69),
+       INT8_C(  56),  INT8_C(  71),  INT8_C( 105),  INT8_C(  41),  INT8_C(   6),  INT8_C(  12), -INT8_C(  62),  INT8_C( 103),
+      -INT8_C(  79), -INT8_C(  31), -INT8_C(  36), -INT8_C(  99),  INT8_C(  16),  INT8_C(  38),  INT8_C(  39),  INT8_C(  71),
+      -INT8_C( 120),  INT8_C(   8), -INT8_C(  50), -INT8_C(  75), -INT8_C(  20),  INT8_C(   3), -INT8_C(  46),  INT8_C( 105),
+      -INT8_C( 127), -INT8_C(  27), -INT8_C( 117),  INT8_C(  26), -INT8_C( 115),  INT8_C(  67),  INT8_C(  95), -INT8_C(  59),
+      -INT8_C( 118), -INT8_C(  56), -INT8_C(  17), -INT8_C( 112), -INT8_C(  43), -INT8_C(  79), -INT8_C(   9), -INT8_C( 122),
+      -INT8_C( 110), -INT8_C(  45),  INT8_C(  35), -INT8_C(  94), -INT8_C(   6),  INT8_C(  75), -INT8_C(  23), -INT8_C( 126),
+       INT8_C(  83), -INT8_C(  72),  INT8_C(  55),  INT8_C(  63), -INT8_C(  69),  INT8_C(  10), -INT8_C(  88),  INT8_C(  60),
+      -INT8_C(  17),  INT8_C(  51),  INT8_C(  87),  INT8_C( 124),  INT8_C( 118), -INT8_C(  74),  INT8_C(  66),  INT8_C(   0),
+           INT8_MAX,  INT8_C(  49), -INT8_C( 111),  INT8_C(  84), -INT8_C(  30), -INT8_C( 120), -INT8_C(  38),  INT8_C( 117),
+       INT8_C(  92), -INT8_C(   3),  INT8_C(  23),  INT8_C(  86),  INT8_C(  72),  INT8_C(   1), -INT8_C(  40), -INT8_C( 100),
+      -INT8_C(  71),  INT8_C(  15), -INT8_C(  37),  INT8_C( 116),  INT8_C(  25), -INT8_C( 124), -INT8_C(  80),  INT8_C(   9),
+      -INT8_C(  73),  INT8_C(   7), -INT8_C( 123),  INT8_C(  46), -INT8_C(  66), -INT8_C(  57),  INT8_C(  46),  INT8_C(  61),
+      -INT8_C(   8), -INT8_C(  65), -INT8_C( 111), -INT8_C(  37),  INT8_C(  72),  INT8_C( 107),  INT8_C(  80), -INT8_C(  92),
+       INT8_C( 104),  INT8_C( 103), -INT8_C(   6), -INT8_C(  79),  INT8_C( 104), -INT8_C(  46),  INT8_C(  77),  INT8_C(  33),
+      -INT8_C(  31),  INT8_C(  40), -INT8_C( 107), -INT8_C(   5), -INT8_C(  84),  INT8_C(  70),  INT8_C(   4),  INT8_C( 100),
+       INT8_C(  77), -INT8_C( 119), -INT8_C( 110),  INT8_C(  11),  INT8_C(  81), -INT8_C(  64),  INT8_C(  72),  INT8_C(  73),
+           INT8_MIN, -INT8_C(  39),  INT8_C(  36), -INT8_C(  56),  INT8_C(  68),  INT8_C( 116),  INT8_C( 108), -INT8_C(  83),
+      -INT8_C(  36),  INT8_C( 102),  INT8_C(  94),  INT8_C(  68),  INT8_C(  56), -INT8_C(  85),  INT8_C( 102),  INT8_C(  25),
+      -INT8_C(  45), -INT8_C(   5),  INT8_C(  20),      INT8_MIN,  INT8_C(  65),  INT8_C(  24), -INT8_C(  28), -INT8_C( 113),
+      -INT8_C(  94),  INT8_C( 118), -INT8_C( 102), -INT8_C(  13),  INT8_C(  54), -INT8_C(  29),  INT8_C(  60), -INT8_C(  74),
+      -INT8_C(  68),  INT8_C(  97),  INT8_C( 126),  INT8_C(   1), -INT8_C(  43), -INT8_C(  22), -INT8_C(  82), -INT8_C(  79),
+       INT8_C(  80),  INT8_C(  12), -INT8_C(  10), -INT8_C( 120), -INT8_C(  73),  INT8_C(  92), -INT8_C(  94), -INT8_C( 118),
+       INT8_C(  87), -INT8_C(  74),  INT8_C(  10), -INT8_C( 103), -INT8_C(  49), -INT8_C(  18),  INT8_C(  40),  INT8_C( 113),
+       INT8_C( 100), -INT8_C(  62),  INT8_C( 100), -INT8_C( 101), -INT8_C(  91), -INT8_C(  96),  INT8_C(  81),  INT8_C(  98),
+       INT8_C(   1), -INT8_C(  48),  INT8_C(  99), -INT8_C(  41), -INT8_C(  70),  INT8_C(  17), -INT8_C( 120),  INT8_C(  11),
+       INT8_C(  29),  INT8_C( 126), -INT8_C( 109), -INT8_C(  44), -INT8_C(  38),  INT8_C(  53),  INT8_C(  94),  INT8_C(  50),
+      -INT8_C(  20),  INT8_C( 105), -INT8_C(  53), -INT8_C(  69),  INT8_C(  87), -INT8_C(  13),  INT8_C(  44), -INT8_C(  68),
+      -INT8_C(  75), -INT8_C( 112),  INT8_C(  87),  INT8_C(  91),  INT8_C(  48), -INT8_C(  88), -INT8_C(  67),  INT8_C(  50),
+       INT8_C( 120),  INT8_C(  32),  INT8_C(   9),  INT8_C(  51),  INT8_C(  49), -INT8_C( 111),  INT8_C(  62),  INT8_C(  78),
+       INT8_C(  16), -INT8_C(  47),  INT8_C(  34), -INT8_C(  22),  INT8_C(   7),      INT8_MIN,  INT8_C(  28), -INT8_C(  13),
+      -INT8_C(  23), -INT8_C(  25), -INT8_C(  82),  INT8_C(  65), -INT8_C(  38), -INT8_C(  38), -INT8_C(   3), -INT8_C( 112),
+       INT8_C( 106),  INT8_C(  84), -INT8_C(  21), -INT8_C( 102), -INT8_C(   4), -INT8_C(  88), -INT8_C(  52),  INT8_C( 117),
+      -INT8_C(  56), -INT8_C(  43), -INT8_C(  88), -INT8_C(   7),  INT8_C( 103), -INT8_C(  26),  INT8_C(  71),  INT8_C( 119),
+      -INT8_C(  73),  INT8_C( 105),  INT8_C(  97), -INT8_C(  66), -INT8_C(  23),  INT8_C( 126), -INT8_C(  79), -INT8_C(  45),
+       INT8_C( 101),  INT8_C(  95),  INT8_C(  20),  INT8_C(  64),  INT8_C(  57),  INT8_C(  17), -INT8_C(  48), -INT8_C(  93),
+       INT8_C( 101), -INT8_C(  69),  INT8_C(  62),  INT8_C(  97),  INT8_C(  99),  INT8_C(  10), -INT8_C(  42),  INT8_C(  43),
+      -INT8_C(  32),  INT8_C( 126),  INT8_C(  36),  INT8_C(  71),  INT8_C( 100),  INT8_C( 107), -INT8_C(  66),  INT8_C(  28),
+      -INT8_C(  44),  INT8_C(  31), -INT8_C(  38), -INT8_C(  67), -INT8_C(  99), -INT8_C( 116), -INT8_C( 112),  INT8_C(   3),
+      -INT8_C(  21), -INT8_C(  92),  INT8_C(  67),  INT8_C(  37), -INT8_C(  75),  INT8_C(  19), -INT8_C(  56),  INT8_C(  26),
+      -INT8_C(  50),  INT8_C(   6),  INT8_C( 124) };
+  static const int8_t b[] =
+    {  INT8_C(  93),  INT8_C(  15),  INT8_C(  98),  INT8_C(  44), -INT8_C( 104),  INT8_C(  79),  INT8_C(  36), -INT8_C(  28),
+       INT8_C( 102),  INT8_C(  87),  INT8_C(  59), -INT8_C(  63), -INT8_C(  17),  INT8_C(  84),  INT8_C(  25), -INT8_C(  65),
+      -INT8_C(  31), -INT8_C(  84), -INT8_C(  82), -INT8_C(  16), -INT8_C(  81),  INT8_C(  82), -INT8_C(  91), -INT8_C(  34),
+      -INT8_C(  62),  INT8_C(  17), -INT8_C(  29), -INT8_C(  58),  INT8_C( 117), -INT8_C(  68), -INT8_C(   9), -INT8_C(  46),
+      -INT8_C(  53),  INT8_C(  89), -INT8_C(   1),  INT8_C(  99), -INT8_C(  87),  INT8_C(  35),  INT8_C(  71),  INT8_C(  15),
+       INT8_C( 122), -INT8_C( 126), -INT8_C(  47),  INT8_C( 105), -INT8_C(  42), -INT8_C(  22),  INT8_C(  41), -INT8_C(  72),
+      -INT8_C( 106), -INT8_C(  41), -INT8_C(  88),  INT8_C(  69),  INT8_C(  42),  INT8_C(  77),  INT8_C(  35), -INT8_C(  20),
+       INT8_C(  94),  INT8_C(   6), -INT8_C(  78), -INT8_C(  45), -INT8_C(  62), -INT8_C(  87), -INT8_C(  90), -INT8_C( 115),
+       INT8_C(   3), -INT8_C(  91), -INT8_C(  16), -INT8_C(  84), -INT8_C(  56),  INT8_C(  55), -INT8_C(  69),  INT8_C(  67),
+      -INT8_C(  70), -INT8_C( 116), -INT8_C(  84), -INT8_C( 112),  INT8_C( 119), -INT8_C(  43),  INT8_C(  72),  INT8_C(  13),
+      -INT8_C(  83), -INT8_C(  16),  INT8_C(  83), -INT8_C(  41),  INT8_C(  61),  INT8_C( 118), -INT8_C(  61), -INT8_C( 101),
+       INT8_C( 125),  INT8_C( 117),  INT8_C( 111),  INT8_C(  63),  INT8_C(  31),  INT8_C(  21), -INT8_C(  51),  INT8_C(  34),
+      -INT8_C(  70), -INT8_C(  67), -INT8_C(  50), -INT8_C( 126), -INT8_C(  11), -INT8_C( 119), -INT8_C(  59), -INT8_C(  81),
+       INT8_C(  22),  INT8_C( 114),  INT8_C(  63), -INT8_C( 115),  INT8_C(  71), -INT8_C( 120), -INT8_C( 102), -INT8_C(  12),
+       INT8_C( 120), -INT8_C(  19), -INT8_C(  53), -INT8_C(  74),  INT8_C( 100), -INT8_C( 114),  INT8_C(  81), -INT8_C(  31),
+       INT8_C(   4), -INT8_C(  64),  INT8_C(  32),  INT8_C(  35), -INT8_C(  43), -INT8_C(  19),  INT8_C(  69), -INT8_C( 113),
+      -INT8_C(  85),  INT8_C(  19),  INT8_C(  18), -INT8_C(  96), -INT8_C( 100), -INT8_C(  41),  INT8_C(  79), -INT8_C(  78),
+       INT8_C(  73), -INT8_C( 114),  INT8_C(  63), -INT8_C( 111),  INT8_C(  22), -INT8_C(  38), -INT8_C( 123), -INT8_C( 113),
+      -INT8_C(  57),  INT8_C(  81),  INT8_C(  69),  INT8_C(  43), -INT8_C(  33), -INT8_C( 106),  INT8_C(  12), -INT8_C(  29),
+       INT8_C(  87),  INT8_C(  45),  INT8_C(   6),  INT8_C(  44),  INT8_C(  26),  INT8_C(  75), -INT8_C(  68), -INT8_C(  59),
+       INT8_C(  94), -INT8_C(  50),  INT8_C( 101), -INT8_C(   5), -INT8_C(  91), -INT8_C(  76), -INT8_C(  83), -INT8_C(  17),
+       INT8_C(  67), -INT8_C(  19),      INT8_MIN,  INT8_C(  89), -INT8_C(  57),  INT8_C(   5), -INT8_C(  24), -INT8_C( 114),
+       INT8_C(  86),  INT8_C(  45), -INT8_C(  70),  INT8_C(  54), -INT8_C(  60), -INT8_C(  58),  INT8_C(  25),  INT8_C(  27),
+      -INT8_C(  13),  INT8_C(  32),  INT8_C(  71),  INT8_C(  14),  INT8_C( 107),  INT8_C(   3), -INT8_C(  45), -INT8_C(  54),
+      -INT8_C(  47),  INT8_C(  57), -INT8_C(  59),  INT8_C( 119), -INT8_C(  19),  INT8_C( 114),  INT8_C( 102),  INT8_C(  48),
+       INT8_C(  95), -INT8_C(  26), -INT8_C( 118),  INT8_C(  38), -INT8_C(  21),  INT8_C( 114), -INT8_C(  75),  INT8_C(  66),
+      -INT8_C(  96),  INT8_C( 111),  INT8_C( 120),  INT8_C( 100),  INT8_C(  53), -INT8_C( 111),      INT8_MAX,  INT8_C(  41),
+      -INT8_C(  79), -INT8_C(  58),  INT8_C(  55),  INT8_C(  29), -INT8_C(  54),  INT8_C(  10), -INT8_C(  25), -INT8_C( 101),
+       INT8_C(  67), -INT8_C(  84),  INT8_C(  18),  INT8_C(  49),  INT8_C(  30),  INT8_C( 120),  INT8_C(  97),  INT8_C( 126),
+       INT8_C(  94), -INT8_C(  21), -INT8_C(  92),  INT8_C(  74),  INT8_C(  94),  INT8_C(  89), -INT8_C( 116), -INT8_C(   2),
+      -INT8_C(  56),  INT8_C(   4),  INT8_C(  98), -INT8_C(   2), -INT8_C( 107), -INT8_C(  31),  INT8_C(  39),  INT8_C(  71),
+      -INT8_C(  89),  INT8_C(  94),  INT8_C( 100),  INT8_C( 113),  INT8_C( 104),  INT8_C(  75),  INT8_C(  13), -INT8_C(  84),
+      -INT8_C(   9),  INT8_C(  31), -INT8_C(  35),  INT8_C(  21), -INT8_C( 104),  INT8_C(  62), -INT8_C( 109), -INT8_C(  10),
+       INT8_C(  42),  INT8_C(  56),  INT8_C(  64), -INT8_C( 120), -INT8_C( 111), -INT8_C(  52), -INT8_C( 122),  INT8_C(  90),
+      -INT8_C(  48), -INT8_C(  24),  INT8_C(  88),  INT8_C( 102), -INT8_C(  55),      INT8_MAX, -INT8_C(  83),  INT8_C( 112),
+      -INT8_C(  35),  INT8_C(  17), -INT8_C(  30),  INT8_C(  69),  INT8_C(  92), -INT8_C(  17), -INT8_C(  15),  INT8_C(  83),
+       INT8_C(  14), -INT8_C(  50),  INT8_C( 104), -INT8_C(  90),  INT8_C(  13), -INT8_C(   4), -INT8_C(  99),  INT8_C(  55),
+       INT8_C(  52), -INT8_C(  35), -INT8_C(  65), -INT8_C(  59), -INT8_C(  86),  INT8_C(  69),  INT8_C(  31),  INT8_C( 122),
+       INT8_C(  45),  INT8_C( 119), -INT8_C(  32), -INT8_C(  10), -INT8_C(  10), -INT8_C( 115),  INT8_C( 102), -INT8_C(  45),
+      -INT8_C(  98),  INT8_C(  72),  INT8_C(  25), -INT8_C(   6),  INT8_C(  55),  INT8_C(  10),  INT8_C(  77),  INT8_C(  70),
+      -INT8_C(  39), -INT8_C(  74), -INT8_C(  20), -INT8_C(  26), -INT8_C(  78), -INT8_C( 119),  INT8_C(  29), -INT8_C(  26),
+       INT8_C( 103), -INT8_C(  36), -INT8_C(  85),  INT8_C(  17),  INT8_C(  33), -INT8_C(  53), -INT8_C( 117),  INT8_C(  78),
+       INT8_C(  66),  INT8_C( 108),  INT8_C(  68),  INT8_C(  57), -INT8_C(   7), -INT8_C(  86),  INT8_C(  12), -INT8_C( 104),
+      -INT8_C(  13),  INT8_C(  37), -INT8_C( 110),  INT8_C(  42),  INT8_C(  48), -INT8_C(  32),  INT8_C( 112),  INT8_C(   9),
+      -INT8_C( 106),  INT8_C(  93), -INT8_C(  17),  INT8_C(  72), -INT8_C(  26),  INT8_C(  12),  INT8_C(  46),  INT8_C(  77),
+      -INT8_C(  24), -INT8_C(  39),  INT8_C(  94),  INT8_C(   9), -INT8_C(  92), -INT8_C(  22),  INT8_C(  87), -INT8_C(  25),
+       INT8_C(  86), -INT8_C( 101),  INT8_C(  32),  INT8_C(  79),  INT8_C(  69),  INT8_C(  44), -INT8_C(  25),  INT8_C(  56),
+       INT8_C(  82),  INT8_C( 122),  INT8_C(  99), -INT8_C( 126),  INT8_C(  90), -INT8_C(  45), -INT8_C( 117), -INT8_C(  16),
+       INT8_C(  48),  INT8_C( 122),  INT8_C(  56),  INT8_C(  23), -INT8_C( 122),  INT8_C( 102),  INT8_C( 100),  INT8_C( 110),
+       INT8_C(  63), -INT8_C(  61),  INT8_C( 119), -INT8_C(  28), -INT8_C(  83), -INT8_C(  50), -INT8_C(  53),  INT8_C(   3),
+       INT8_C( 105), -INT8_C(  21),  INT8_C(  82), -INT8_C(  82),  INT8_C(  23),  INT8_C(  58), -INT8_C(  25),  INT8_C( 105),
+      -INT8_C(  76),  INT8_C(  74), -INT8_C(  21),  INT8_C(  14),  INT8_C(  29),  INT8_C( 118), -INT8_C(   2),  INT8_C(  78),
+      -INT8_C(  16),  INT8_C(  54),  INT8_C( 101),  INT8_C( 118), -INT8_C( 100), -INT8_C(  55), -INT8_C(  28), -INT8_C(  37),
+      -INT8_C( 116),  INT8_C(  91), -INT8_C(  65),  INT8_C(  57),  INT8_C(  41), -INT8_C( 118),  INT8_C(  60), -INT8_C( 110),
+       INT8_C( 117), -INT8_C( 113),  INT8_C(  65), -INT8_C( 115), -INT8_C(  55),  INT8_C(  40), -INT8_C(  10),  INT8_C( 125),
+       INT8_C( 114), -INT8_C(  30), -INT8_C( 117), -INT8_C( 113),  INT8_C(  88), -INT8_C( 119), -INT8_C(  35),  INT8_C(  73),
+      -INT8_C(  65),  INT8_C(  66), -INT8_C(  65),  INT8_C(  91),  INT8_C(  12), -INT8_C(  92),  INT8_C(  54), -INT8_C( 104),
+      -INT8_C(   1), -INT8_C(  10), -INT8_C(  46),  INT8_C(  41),      INT8_MIN,  INT8_C(  14), -INT8_C(  69), -INT8_C(  10),
+      -INT8_C(  99), -INT8_C(   4), -INT8_C( 125),  INT8_C( 102),  INT8_C(  36),  INT8_C( 121), -INT8_C(  29), -INT8_C( 106),
+       INT8_C(  91),  INT8_C( 110),  INT8_C(  38), -INT8_C(  76), -INT8_C(   9),  INT8_C(   3), -INT8_C(   3), -INT8_C(  74),
+       INT8_C(  70), -INT8_C(  68),  INT8_C(  17),  INT8_C(  82),  INT8_C(  96),  INT8_C(  72), -INT8_C(  22),  INT8_C(  96),
+       INT8_C(  62), -INT8_C(  68), -INT8_C( 119), -INT8_C(  66), -INT8_C(  53),  INT8_C(  68), -INT8_C(  76),  INT8_C( 104),
+       INT8_C(  65),  INT8_C(  55), -INT8_C(  49),  INT8_C( 101), -INT8_C(  79), -INT8_C(  78), -INT8_C(   4),  INT8_C(  12),
+       INT8_C(  33),  INT8_C(  34), -INT8_C(  64),  INT8_C(  24),  INT8_C(  37), -INT8_C(  67), -INT8_C(  49),  INT8_C( 107),
+       INT8_C( 122), -INT8_C(  32), -INT8_C(  67), -INT8_C(  38),  INT8_C(  40), -INT8_C(  88),  INT8_C(  58),  INT8_C( 102),
+       INT8_C( 100), -INT8_C(  61),  INT8_C(  37),  INT8_C(  47),  INT8_C(   8), -INT8_C(  39), -INT8_C( 104),  INT8_C(  73),
+       INT8_C(  17),  INT8_C( 103), -INT8_C(  82), -INT8_C(  62),  INT8_C(  25), -INT8_C(  86), -INT8_C(  50),  INT8_C(  58),
+      -INT8_C(  52), -INT8_C( 113),  INT8_C(  83), -INT8_C(  14),  INT8_C(  76),  INT8_C(  34),  INT8_C(  93), -INT8_C(  58),
+       INT8_C(   2),  INT8_C(  27), -INT8_C(  95),  INT8_C(  43), -INT8_C(  61), -INT8_C(  37), -INT8_C( 111),  INT8_C(  39),
+      -INT8_C(  97), -INT8_C(  74),  INT8_C(  87), -INT8_C(  89), -INT8_C( 112), -INT8_C(  17), -INT8_C(  16), -INT8_C(  95),
+       INT8_C(  86), -INT8_C(  98),  INT8_C(  99),  INT8_C( 111),  INT8_C(  73),  INT8_C(  49), -INT8_C(  86),  INT8_C(  21),
+      -INT8_C(  64), -INT8_C(   3),  INT8_C(   7),  INT8_C(  13),  INT8_C(  31),  INT8_C( 101), -INT8_C(  45),  INT8_C(  33),
+           INT8_MIN,  INT8_C( 116),  INT8_C(  76),  INT8_C(  67),  INT8_C(  80), -INT8_C(  34),  INT8_C( 106), -INT8_C(  17),
+      -INT8_C( 108), -INT8_C(  63), -INT8_C( 106),  INT8_C(  36), -INT8_C(  80), -INT8_C( 122), -INT8_C(  59),  INT8_C(   6),
+       INT8_C(  36),  INT8_C(  40),  INT8_C( 118),  INT8_C( 109),  INT8_C(  90),  INT8_C(  32), -INT8_C( 125),  INT8_C(  26),
+       INT8_C(  29), -INT8_C( 118),  INT8_C(  39),  INT8_C(  60), -INT8_C(  17), -INT8_C(   5),  INT8_C(  93),  INT8_C( 111),
+       INT8_C( 111), -INT8_C(  86), -INT8_C(  78), -INT8_C(  65), -INT8_C( 120),  INT8_C(  29), -INT8_C(  82),  INT8_C(  28),
+      -INT8_C(  34),  INT8_C(  68),  INT8_C(  65), -INT8_C( 113), -INT8_C(  54),  INT8_C(   6), -INT8_C( 107), -INT8_C(  17),
+       INT8_C(  47),  INT8_C(  11),  INT8_C(  92), -INT8_C( 119),  INT8_C(  43), -INT8_C(  33), -INT8_C(  93),  INT8_C(  72),
+       INT8_C( 106), -INT8_C(  53), -INT8_C( 124),  INT8_C(  89), -INT8_C(  58), -INT8_C(  30), -INT8_C(  55),  INT8_C(  53),
+      -INT8_C( 116),  INT8_C( 123), -INT8_C(  11),  INT8_C(  20), -INT8_C( 104), -INT8_C(  93),  INT8_C(  48),  INT8_C( 119),
+      -INT8_C(  24),  INT8_C( 113),  INT8_C(   6), -INT8_C(  78),  INT8_C( 120), -INT8_C( 101), -INT8_C(  95), -INT8_C(  89),
+      -INT8_C(  89), -INT8_C(   2),  INT8_C(  48), -INT8_C(  46), -INT8_C(  35), -INT8_C(  45),  INT8_C(  27),  INT8_C(  71),
+      -INT8_C(  98), -INT8_C(  97), -INT8_C(  95),  INT8_C( 100), -INT8_C( 127),  INT8_C( 106), -INT8_C( 102),  INT8_C(  13),
+      -INT8_C(  27), -INT8_C( 113),  INT8_C(  33),  INT8_C( 126),  INT8_C(  50),  INT8_C(  82), -INT8_C(  11),  INT8_C(  26),
+      -INT8_C(  61), -INT8_C(   5), -INT8_C(  51),  INT8_C(  59), -INT8_C( 106),  INT8_C( 110), -INT8_C(  30),  INT8_C(  61),
+       INT8_C( 108),  INT8_C(  18),  INT8_C(  16),  INT8_C(  74), -INT8_C(  26),  INT8_C(  43), -INT8_C( 111), -INT8_C( 124),
+      -INT8_C(  54),  INT8_C(  50), -INT8_C(  23),  INT8_C(  76), -INT8_C( 100), -INT8_C( 125),  INT8_C(  89), -INT8_C( 126),
+       INT8_C(  18),  INT8_C( 123),  INT8_C(   0),  INT8_C(  68), -INT8_C(  51), -INT8_C(  11),  INT8_C(  95), -INT8_C( 112),
+      -INT8_C(  16),  INT8_C(  44), -INT8_C(  52) };
+  static const int8_t c[] =
+    { -INT8_C(  27), -INT8_C( 123), -INT8_C(   3),  INT8_C(  21),  INT8_C(   2), -INT8_C(  39), -INT8_C( 126), -INT8_C( 104),
+       INT8_C(  72), -INT8_C( 122),  INT8_C(  48), -INT8_C(  75),  INT8_C( 112), -INT8_C(  94), -INT8_C(  49),  INT8_C(   1),
+      -INT8_C(  23),  INT8_C( 122),  INT8_C(  91),  INT8_C(  46),  INT8_C( 121), -INT8_C( 113),  INT8_C(  30),  INT8_C(  42),
+      -INT8_C(   3),  INT8_C( 106), -INT8_C(  32), -INT8_C( 117),  INT8_C(   2),  INT8_C(  87), -INT8_C(  18), -INT8_C(  25),
+      -INT8_C(  36), -INT8_C(  21), -INT8_C(   3), -INT8_C(  34), -INT8_C(  60),      INT8_MAX,  INT8_C( 118),  INT8_C(  12),
+       INT8_C(   5), -INT8_C(  89), -INT8_C(  62),  INT8_C( 117),  INT8_C(  73), -INT8_C( 111),  INT8_C( 118),  INT8_C(  51),
+       INT8_C(  11), -INT8_C(  46),  INT8_C(  97), -INT8_C( 124),  INT8_C(  97),      INT8_MAX, -INT8_C(  82),  INT8_C(  94),
+      -INT8_C(  23), -INT8_C( 114), -INT8_C(  23), -INT8_C(  20), -INT8_C(  27), -INT8_C(  41), -INT8_C(  45), -INT8_C(  62),
+      -INT8_C(  61), -INT8_C(  48), -INT8_C(  96), -INT8_C( 121),  INT8_C(  79),  INT8_C(  23), -INT8_C( 108),  INT8_C(  84),
+      -INT8_C(  66),  INT8_C(  86), -INT8_C(  55),  INT8_C(   7), -INT8_C(  25),  INT8_C(  64),  INT8_C(  58), -INT8_C(  14),
+       INT8_C(  18), -INT8_C( 101),  INT8_C( 118),  INT8_C( 115),  INT8_C(  26),  INT8_C(  37), -INT8_C(  47),  INT8_C(   4),
+      -INT8_C(  77), -INT8_C(  70), -INT8_C(  16), -INT8_C( 103), -INT8_C( 110), -INT8_C(  61),  INT8_C(  91),  INT8_C(  85),
+      -INT8_C( 108), -INT8_C(   5), -INT8_C(  36), -INT8_C(  29),  INT8_C(  18),  INT8_C( 112),  INT8_C(  56), -INT8_C(  48),
+      -INT8_C(  58),  INT8_C(   1), -INT8_C(  40), -INT8_C(  83),  INT8_C(  65),  INT8_C(  18), -INT8_C(  97),  INT8_C(  83),
+      -INT8_C(  82),  INT8_C(  22), -INT8_C(  58), -INT8_C(  56),  INT8_C(  59), -INT8_C( 105), -INT8_C(  52), -INT8_C(  18),
+       INT8_C(  82), -INT8_C(  68), -INT8_C( 121), -INT8_C(  28),      INT8_MIN, -INT8_C(  30),  INT8_C(  57),  INT8_C(  20),
+      -INT8_C(  34),  INT8_C(  21), -INT8_C(   9), -INT8_C(  16), -INT8_C( 122),  INT8_C(  47), -INT8_C(  63),  INT8_C(  76),
+       INT8_C(  49), -INT8_C( 103), -INT8_C(   6),  INT8_C( 114), -INT8_C(  85), -INT8_C( 103), -INT8_C(  58),  INT8_C(  89),
+      -INT8_C(  81), -INT8_C( 116),  INT8_C(  34), -INT8_C(  22),  INT8_C(  36), -INT8_C(  18), -INT8_C(  39),  INT8_C( 118),
+      -INT8_C(  85),  INT8_C(  96),  INT8_C(  90),  INT8_C(  43),  INT8_C(  67), -INT8_C( 109),  INT8_C(  63),  INT8_C(  33),
+      -INT8_C(  88),  INT8_C(  54),  INT8_C(  17),  INT8_C(  46),  INT8_C( 102), -INT8_C(  46),  INT8_C( 123), -INT8_C( 105),
+       INT8_C( 107),  INT8_C( 117),  INT8_C(   9),  INT8_C(  23),  INT8_C(  14), -INT8_C(  49),  INT8_C( 112), -INT8_C(  66),
+       INT8_C(  92), -INT8_C( 110), -INT8_C(  88),      INT8_MIN, -INT8_C( 127), -INT8_C( 127), -INT8_C(  10),  INT8_C(  44),
+      -INT8_C(  30),  INT8_C(  80),  INT8_C(  87),  INT8_C(  37), -INT8_C(  29), -INT8_C( 106),  INT8_C(  70), -INT8_C( 117),
+      -INT8_C(  52),  INT8_C(  87), -INT8_C(  70),  INT8_C(  50),  INT8_C(  42),  INT8_C(  53), -INT8_C(  55), -INT8_C( 107),
+      -INT8_C(  86), -INT8_C(  45), -INT8_C(  84), -INT8_C(  72), -INT8_C(  94),  INT8_C(  29),  INT8_C( 118), -INT8_C(   2),
+      -INT8_C(  81),  INT8_C(  31),  INT8_C( 126),  INT8_C(  48), -INT8_C(  96),  INT8_C( 116),  INT8_C(  92), -INT8_C( 126),
+      -INT8_C(  60), -INT8_C(  77), -INT8_C(  89), -INT8_C(  89),  INT8_C(  73), -INT8_C(  19),  INT8_C(  51),  INT8_C(  22),
+       INT8_C(  69), -INT8_C(  19),  INT8_C(  72),  INT8_C( 111),  INT8_C(  34),  INT8_C(  18),  INT8_C(   4), -INT8_C(  52),
+      -INT8_C(  27), -INT8_C(  79), -INT8_C( 124), -INT8_C( 121), -INT8_C(  50), -INT8_C(   5), -INT8_C( 122),  INT8_C( 125),
+       INT8_C(  26),  INT8_C(   4), -INT8_C(  82), -INT8_C(  70),  INT8_C( 121),  INT8_C(  10),  INT8_C(  61),  INT8_C(  61),
+      -INT8_C(  66), -INT8_C(  28), -INT8_C(  27),  INT8_C(   7), -INT8_C(  46),  INT8_C(  24),  INT8_C(  29),  INT8_C(  23),
+       INT8_C(   5),  INT8_C( 102), -INT8_C( 122),  INT8_C(  39),  INT8_C( 120), -INT8_C( 118), -INT8_C(  13),  INT8_C(  93),
+       INT8_C(  59),  INT8_C( 119), -INT8_C(  28),  INT8_C(   9),  INT8_C( 114),  INT8_C( 106), -INT8_C( 121), -INT8_C( 116),
+       INT8_C( 111),  INT8_C(  53),  INT8_C(  71), -INT8_C(  24),  INT8_C(  63), -INT8_C( 124),  INT8_C(  37), -INT8_C(   3),
+       INT8_C( 104),  INT8_C(  10),  INT8_C(   5),  INT8_C(  58),  INT8_C(  34),  INT8_C(  34),  INT8_C(  81),  INT8_C(  39),
+      -INT8_C( 120), -INT8_C(  41),  INT8_C(  78),  INT8_C(   0),  INT8_C(  98),  INT8_C(  65),  INT8_C(  93), -INT8_C(  99),
+      -INT8_C(  71),  INT8_C(  66), -INT8_C(  89),  INT8_C(  43), -INT8_C(  84),  INT8_C(  46), -INT8_C(  72),  INT8_C(  27),
+       INT8_C(  99), -INT8_C(   1),  INT8_C(   3), -INT8_C(  94), -INT8_C( 125),  INT8_C(  41), -INT8_C(  96), -INT8_C(  21),
+       INT8_C(  51), -INT8_C(  91),  INT8_C(  38),  INT8_C(  86), -INT8_C(  57),  INT8_C( 119),  INT8_C( 125),  INT8_C(  80),
+       INT8_C(  79), -INT8_C(  52),  INT8_C(  80), -INT8_C(  79),  INT8_C(  13), -INT8_C(  82),  INT8_C(  78), -INT8_C(  58),
+      -INT8_C(  16), -INT8_C(  11), -INT8_C(  14), -INT8_C( 100),  INT8_C(  35), -INT8_C(  86), -INT8_C(  72), -INT8_C( 122),
+      -INT8_C(  87), -INT8_C(  69),  INT8_C(  41),  INT8_C(  44), -INT8_C(  28), -INT8_C(  55),  INT8_C(  23),  INT8_C(  24),
+       INT8_C( 110),  INT8_C(  61),  INT8_C( 110),  INT8_C(  53), -INT8_C(  75), -INT8_C(  21), -INT8_C( 123),  INT8_C(   4),
+      -INT8_C(  73), -INT8_C(  42), -INT8_C(  75), -INT8_C(  59), -INT8_C( 124),  INT8_C(   3), -INT8_C( 117),  INT8_C( 116),
+      -INT8_C(   7),  INT8_C( 125),  INT8_C(  16),  INT8_C(  28),  INT8_C(  39), -INT8_C(  56), -INT8_C(  93), -INT8_C(  48),
+      -INT8_C( 124), -INT8_C(  52), -INT8_C(   4),  INT8_C( 104), -INT8_C( 107),  INT8_C(  20),      INT8_MIN,  INT8_C(   3),
+       INT8_C(  81), -INT8_C(  18),  INT8_C(  56),  INT8_C(   6), -INT8_C(  38), -INT8_C(  66),  INT8_C(  10), -INT8_C( 111),
+      -INT8_C( 108), -INT8_C(  65),  INT8_C(  86),  INT8_C(  24), -INT8_C(  61), -INT8_C(  30), -INT8_C( 116), -INT8_C(  68),
+       INT8_C(  95), -INT8_C( 100), -INT8_C(  40), -INT8_C( 121),  INT8_C( 101),  INT8_C( 123),  INT8_C(  87), -INT8_C(  23),
+       INT8_C(  71),  INT8_C(  84),  INT8_C(  81), -INT8_C(  36),  INT8_C( 104), -INT8_C(  46), -INT8_C(  33), -INT8_C(  71),
+      -INT8_C(  64),  INT8_C(  24), -INT8_C(  64), -INT8_C( 102), -INT8_C(  42), -INT8_C(  54),  INT8_C(  44),  INT8_C( 106),
+      -INT8_C( 118), -INT8_C( 126), -INT8_C( 126),  INT8_C(  77),  INT8_C( 100),  INT8_C(  14),  INT8_C(   9), -INT8_C(  60),
+      -INT8_C(  86), -INT8_C(  31),  INT8_C(  75),  INT8_C(  15),  INT8_C(  93), -INT8_C(  94), -INT8_C(   8), -INT8_C(  92),
+      -INT8_C(  10),  INT8_C(  74), -INT8_C( 127),  INT8_C(  94),  INT8_C(  28),  INT8_C(  96),  INT8_C(  24), -INT8_C(  36),
+       INT8_C( 120), -INT8_C(  40),  INT8_C( 119),  INT8_C(  78), -INT8_C(  94), -INT8_C(  93), -INT8_C(  72),  INT8_C(  44),
+       INT8_C(  37),  INT8_C(  58),  INT8_C( 121), -INT8_C( 118),  INT8_C(  72), -INT8_C( 126),  INT8_C(  78), -INT8_C(  13),
+       INT8_C( 100), -INT8_C( 103),  INT8_C(   2), -INT8_C(  63),  INT8_C(  59), -INT8_C(   5),  INT8_C( 101),  INT8_C(  50),
+       INT8_C(  69), -INT8_C(  26), -INT8_C( 112),  INT8_C(  97),  INT8_C(  71), -INT8_C(  88),  INT8_C(  61), -INT8_C(  65),
+           INT8_MIN, -INT8_C(  76),  INT8_C(  14),  INT8_C(  35),  INT8_C(  87), -INT8_C(  58),  INT8_C(  79),  INT8_C( 125),
+       INT8_C(   1), -INT8_C(  55),  INT8_C(   7),  INT8_C(  73),  INT8_C(  75),  INT8_C(  85),  INT8_C(  60), -INT8_C(  81),
+      -INT8_C(  18),  INT8_C(  63),  INT8_C( 112),  INT8_C(  41),  INT8_C(  58), -INT8_C(  42),  INT8_C(  91),      INT8_MAX,
+      -INT8_C(  68), -INT8_C(  20), -INT8_C(  32),  INT8_C(   3), -INT8_C( 108),  INT8_C(  29), -INT8_C(  61),  INT8_C(  21),
+      -INT8_C(  46), -INT8_C(  47),  INT8_C(  56),  INT8_C(  41), -INT8_C( 105), -INT8_C( 121), -INT8_C(  90), -INT8_C( 104),
+       INT8_C(  80), -INT8_C(  83), -INT8_C(  30), -INT8_C( 100),  INT8_C(   2),  INT8_C(  30),  INT8_C(  75), -INT8_C(  16),
+       INT8_C(  93), -INT8_C(  68),  INT8_C(  26), -INT8_C( 105), -INT8_C( 110),  INT8_C( 117),  INT8_C(  22),  INT8_C(  78),
+       INT8_C(  97), -INT8_C(  10),  INT8_C(  82), -INT8_C(  10),  INT8_C(  20),  INT8_C(  21),  INT8_C(  11), -INT8_C(  26),
+      -INT8_C(  26),  INT8_C(  67),  INT8_C(  15),  INT8_C( 125), -INT8_C(  54), -INT8_C(  74),  INT8_C(  22),  INT8_C(  27),
+       INT8_C(  99), -INT8_C(   8), -INT8_C(  73),  INT8_C( 102),  INT8_C(  22),  INT8_C(   2),  INT8_C(  86),  INT8_C( 116),
+      -INT8_C(  66),  INT8_C( 112),  INT8_C(  11),  INT8_C(  80), -INT8_C(  26),  INT8_C(  34), -INT8_C(  97),  INT8_C(  71),
+       INT8_C(  24), -INT8_C(  15),  INT8_C(  61),  INT8_C(  44),  INT8_C(   6),  INT8_C(  72),  INT8_C(  18), -INT8_C(  20),
+      -INT8_C( 117),  INT8_C(  34),  INT8_C( 105),  INT8_C(  86), -INT8_C(  40),      INT8_MAX,  INT8_C( 113),  INT8_C(  59),
+       INT8_C( 119),  INT8_C(  40), -INT8_C(  95), -INT8_C( 114),  INT8_C(  42), -INT8_C(   8),  INT8_C(   2), -INT8_C(  23),
+       INT8_C( 104),  INT8_C(  13),  INT8_C(  57),  INT8_C(  78),  INT8_C(  47), -INT8_C(  40), -INT8_C( 106),  INT8_C(  72),
+      -INT8_C(  55), -INT8_C(  45),  INT8_C( 116), -INT8_C(  49),  INT8_C(  28), -INT8_C( 121), -INT8_C(  69), -INT8_C(  89),
+      -INT8_C(  87),  INT8_C(  37), -INT8_C(   3), -INT8_C( 127), -INT8_C(  92),  INT8_C( 110), -INT8_C(  68),  INT8_C(  28),
+      -INT8_C( 106),  INT8_C(  94), -INT8_C(  86), -INT8_C(  63),  INT8_C(  86), -INT8_C(  84), -INT8_C(  86), -INT8_C(  66),
+      -INT8_C(  71), -INT8_C(  29),  INT8_C(  13), -INT8_C(  23), -INT8_C(  68), -INT8_C(  93),  INT8_C(  49), -INT8_C( 123),
+       INT8_C( 118), -INT8_C(  91),  INT8_C(  85), -INT8_C( 110),  INT8_C(  44),  INT8_C(  16),  INT8_C(  58), -INT8_C(  43),
+       INT8_C(  53),  INT8_C(  55),  INT8_C(  86), -INT8_C(  38), -INT8_C(  90),  INT8_C(  19), -INT8_C(  10),  INT8_C(  60),
+       INT8_C( 113), -INT8_C(  96), -INT8_C(   3), -INT8_C(  57),  INT8_C(  76), -INT8_C(  89), -INT8_C( 123),  INT8_C(   5),
+      -INT8_C( 117), -INT8_C( 110), -INT8_C(  18),  INT8_C(  71),  INT8_C(  53),  INT8_C(  31), -INT8_C(  52), -INT8_C(  84),
+      -INT8_C(  59),  INT8_C(  33),  INT8_C(  62), -INT8_C(  15),  INT8_C(  50),  INT8_C( 120), -INT8_C(  57),  INT8_C( 103),
+      -INT8_C(  80),  INT8_C(  29),  INT8_C(  65),  INT8_C(  86),  INT8_C(  48),  INT8_C(  55), -INT8_C( 110), -INT8_C(  95),
+      -INT8_C(  41), -INT8_C( 112),  INT8_C( 104),  INT8_C(  35),  INT8_C(  55), -INT8_C(  18),  INT8_C(  41), -INT8_C(  62),
+           INT8_MIN,  INT8_C(  23),  INT8_C(   9), -INT8_C(  74),  INT8_C(  55), -INT8_C(  42),  INT8_C(  98), -INT8_C(   4),
+      -INT8_C(   9), -INT8_C(  96), -INT8_C(  19),  INT8_C(  41),  INT8_C(  25), -INT8_C(  76), -INT8_C( 111), -INT8_C(  55),
+      -INT8_C(  46), -INT8_C(  46),  INT8_C(  31),  INT8_C(   2),  INT8_C(  10), -INT8_C(  79), -INT8_C(  92), -INT8_C(  31),
+       INT8_C(  65),  INT8_C(  12),  INT8_C(   5),  INT8_C( 121), -INT8_C(   6),  INT8_C(  46),  INT8_C(  59),  INT8_C( 123),
+       INT8_C(  69),  INT8_C(  69),  INT8_C(  49) };
+  static const int8_t e[] =
+    { -INT8_C(  63),  INT8_C(  59),  INT8_C( 115),  INT8_C(  53),  INT8_C(  34),  INT8_C(  20), -INT8_C(  22),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(  18), -INT8_C( 121), -INT8_C(  59),
+       INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C( 126),  INT8_C( 116),  INT8_C(  53), -INT8_C(  75), -INT8_C(  44),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 109), -INT8_C(   5),  INT8_C(  20),  INT8_C(   0),  INT8_C(   0), -INT8_C(  24), -INT8_C( 117),
+      -INT8_C(  27), -INT8_C(  85),  INT8_C(   0),  INT8_C( 119),  INT8_C(  19), -INT8_C( 107), -INT8_C( 108),  INT8_C(   0),
+      -INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  45),  INT8_C(  95), -INT8_C( 119),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  15), -INT8_C(  29),  INT8_C(   0), -INT8_C(  98),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  64), -INT8_C(  13),  INT8_C(  95),  INT8_C(  27), -INT8_C(  86), -INT8_C(  38),
+       INT8_C(   0),  INT8_C(   6),  INT8_C(   0), -INT8_C(  25), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0), -INT8_C(  49),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  40),  INT8_C(  38),  INT8_C(  11),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  51),
+       INT8_C(   0), -INT8_C(  96), -INT8_C(  46),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23),  INT8_C( 114),  INT8_C(   0),
+      -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  59),  INT8_C(  71),  INT8_C(  47),  INT8_C(   0),
+      -INT8_C(  26),  INT8_C(   0), -INT8_C(  89),  INT8_C(   0),  INT8_C(   0), -INT8_C(  10),  INT8_C(   0),  INT8_C(  54),
+       INT8_C(   0), -INT8_C( 118),  INT8_C(   0),  INT8_C(   0), -INT8_C(  54),  INT8_C( 102), -INT8_C(  72),  INT8_C(   0),
+      -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  59), -INT8_C(  29),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 107),  INT8_C(  83), -INT8_C(   1),  INT8_C(   0),  INT8_C(  36),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 122), -INT8_C( 101), -INT8_C(  99),  INT8_C(  39),  INT8_C(  51), -INT8_C(  84),
+       INT8_C(   0), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  57),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  82), -INT8_C( 103), -INT8_C(  15),  INT8_C(   0), -INT8_C(  96),
+      -INT8_C(  24), -INT8_C(  57),  INT8_C(   0), -INT8_C(  52), -INT8_C( 107), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 112),  INT8_C(   0),  INT8_C(  33), -INT8_C( 123), -INT8_C(  23), -INT8_C(   7),  INT8_C(   0),
+      -INT8_C(  98),  INT8_C(   0),  INT8_C(  99),  INT8_C(   0), -INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(  21),
+       INT8_C(   0),  INT8_C(   7), -INT8_C( 110),  INT8_C(   0),  INT8_C( 117),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  79),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20), -INT8_C(  40),  INT8_C(   0),  INT8_C(   0), -INT8_C(  77),
+      -INT8_C(  79),  INT8_C(  71),  INT8_C(  52), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(  30),  INT8_C(   0),
+      -INT8_C( 123), -INT8_C( 123),  INT8_C(   0),  INT8_C(   0), -INT8_C(  56),  INT8_C(  90),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  15),  INT8_C( 100),  INT8_C(   0), -INT8_C(  66),  INT8_C(  46),  INT8_C(   0), -INT8_C( 117),
+      -INT8_C(  46),  INT8_C(  28),  INT8_C(  46), -INT8_C(  22),  INT8_C(  27),  INT8_C(   0),  INT8_C(  52),  INT8_C( 101),
+      -INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 122),  INT8_C(   0),  INT8_C(   0), -INT8_C(  49),
+       INT8_C(  98),  INT8_C(   0),  INT8_C( 104),  INT8_C(  36),  INT8_C(   0), -INT8_C(  28),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  25), -INT8_C( 121),  INT8_C(   0),  INT8_C(  97),  INT8_C(   0),  INT8_C( 122),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  33),  INT8_C(   0),  INT8_C(  31),  INT8_C(   0),  INT8_C(   0),  INT8_C(  98),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 105),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   2),  INT8_C(   0), -INT8_C(   2),  INT8_C(   8), -INT8_C(  30), -INT8_C(  79),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  31), -INT8_C( 122), -INT8_C(  71),  INT8_C(   2),  INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  27),  INT8_C( 114),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51),  INT8_C(   0),  INT8_C(   0),  INT8_C(  64),
+      -INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66), -INT8_C(  11),  INT8_C(   0),  INT8_C(  82),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23),  INT8_C(   0),  INT8_C(  54),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  25),  INT8_C(  25), -INT8_C(  99),  INT8_C(   0), -INT8_C( 119),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 126),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0), -INT8_C(  21),  INT8_C(   0), -INT8_C( 127),
+       INT8_C(   0), -INT8_C(  66),  INT8_C(   0),  INT8_C(  61),  INT8_C( 100), -INT8_C( 109), -INT8_C(  25),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  46),  INT8_C(   0), -INT8_C(  62), -INT8_C(  37), -INT8_C( 116),  INT8_C(   0),  INT8_C(  42),
+       INT8_C(  76), -INT8_C( 105), -INT8_C(  36), -INT8_C( 124),  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),  INT8_C( 123),
+       INT8_C(   0),  INT8_C(  22),  INT8_C(   0),  INT8_C( 112),  INT8_C(   0),  INT8_C( 123),  INT8_C(   0), -INT8_C(  15),
+      -INT8_C(  28), -INT8_C(   7), -INT8_C( 114),  INT8_C(   0),  INT8_C(  81),  INT8_C(   0),  INT8_C(   0),  INT8_C(  50),
+       INT8_C(   0), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  35),  INT8_C(   0), -INT8_C(  72),
+       INT8_C(   0), -INT8_C( 127), -INT8_C(  13), -INT8_C(  70),  INT8_C(   0), -INT8_C( 118),  INT8_C(   0), -INT8_C(   8),
+       INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  78), -INT8_C(  34),  INT8_C(   0),
+       INT8_C(  10),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  52),  INT8_C( 105),  INT8_C(  17), -INT8_C( 105),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  39), -INT8_C(  14), -INT8_C(  64),  INT8_C(  60), -INT8_C(   2),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  82),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),
+       INT8_C( 124),  INT8_C(  30),  INT8_C( 120),  INT8_C(   0), -INT8_C( 110), -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  86),  INT8_C(   0), -INT8_C(  17),  INT8_C(   0), -INT8_C(  22), -INT8_C(  66), -INT8_C( 109),
+       INT8_C( 117),  INT8_C(   0),  INT8_C(   0), -INT8_C(  99),  INT8_C(   0), -INT8_C(  17),  INT8_C(   0),  INT8_C(  50),
+       INT8_C(   0),  INT8_C(  34),  INT8_C(   0), -INT8_C(  39),  INT8_C(   0), -INT8_C(  16), -INT8_C( 117),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  55),  INT8_C(   0),  INT8_C( 101),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 110),  INT8_C( 113),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  64),  INT8_C(  99), -INT8_C(  99),  INT8_C(  77),  INT8_C(   0), -INT8_C(  78), -INT8_C(  77),  INT8_C(  71),
+      -INT8_C(  76),  INT8_C(   0),  INT8_C(   0),  INT8_C( 106),  INT8_C(  92), -INT8_C( 125), -INT8_C( 125),  INT8_C(   0),
+       INT8_C(  58),  INT8_C(   0),  INT8_C(   0), -INT8_C(  63), -INT8_C(  97),  INT8_C(   0), -INT8_C(  23),  INT8_C(  99),
+      -INT8_C( 118),  INT8_C(   0), -INT8_C(  29),  INT8_C(  90),  INT8_C(   0),  INT8_C(  14),  INT8_C(  51),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 100),  INT8_C(   0),  INT8_C(  53),  INT8_C(   0),  INT8_C(  31),
+      -INT8_C(  31),  INT8_C(  69), -INT8_C(  54), -INT8_C( 122), -INT8_C(  72),  INT8_C(  29), -INT8_C(  13),  INT8_C(   0),
+       INT8_C(  54),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   9),  INT8_C( 113),  INT8_C(  75),  INT8_C(   0), -INT8_C( 103),  INT8_C(   0),  INT8_C(   0),  INT8_C(  61),
+       INT8_C(  92),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(  15),  INT8_C(   0), -INT8_C(  67),
+       INT8_C(   0), -INT8_C(  49),  INT8_C(   0), -INT8_C( 101),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  35),  INT8_C(  62),  INT8_C(   1), -INT8_C(  53), -INT8_C(   9),  INT8_C(   5),
+      -INT8_C(   9),  INT8_C(   0), -INT8_C( 103), -INT8_C( 103), -INT8_C(  38),  INT8_C(  92),  INT8_C(   0),  INT8_C( 104),
+       INT8_C(   0),  INT8_C(  79), -INT8_C(  47),  INT8_C(  26), -INT8_C(  97), -INT8_C( 104), -INT8_C(  21), -INT8_C( 108),
+      -INT8_C(  19),  INT8_C(  83),  INT8_C(  22),  INT8_C(   0),      INT8_MIN, -INT8_C(  89),  INT8_C(   0), -INT8_C(  59),
+      -INT8_C(  14),  INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(  42),  INT8_C(   0), -INT8_C(  30), -INT8_C(  54),
+       INT8_C(   0),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51),  INT8_C(   0),  INT8_C(  78),
+       INT8_C(   0),  INT8_C(  35),  INT8_C(   0),  INT8_C(   0), -INT8_C( 100), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 126),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C( 103),  INT8_C(  95),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  14), -INT8_C(  34),  INT8_C(  52),  INT8_C(  16),  INT8_C(  19),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  37), -INT8_C(  68),  INT8_C( 117),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  90),  INT8_C( 112),  INT8_C(   0),  INT8_C(  85), -INT8_C(  41),  INT8_C(  24),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 119), -INT8_C(  66),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(  68),  INT8_C( 104),
+      -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  99),  INT8_C(  12),  INT8_C(  88),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   4),  INT8_C(   0),  INT8_C(  89),  INT8_C(   0),  INT8_C(  57),  INT8_C(  80),
+       INT8_C( 111),  INT8_C(   0),  INT8_C(   0),  INT8_C(  17),  INT8_C(  57),  INT8_C(  34),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 119),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  83),  INT8_C(  47),  INT8_C(  57),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  30),  INT8_C(   0),  INT8_C(  85),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  57), -INT8_C(  40),  INT8_C(   5),  INT8_C(   0), -INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(  27),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i])),
+      cv = simde_svld1_s8(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmad_s8_z(pv, av, bv, cv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], c[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+    cv = simde_svld1_s8(pg, &(c[i]));
+
+    ev = simde_svmad_s8_z(pv, av, bv, cv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1) };
+  static const int8_t a[] =
+    { -INT8_C(  69), -INT8_C(  35),  INT8_C( 122), -INT8_C(  73),  INT8_C(  22),  INT8_C(  45), -INT8_C(  19), -INT8_C(  24),
+      -INT8_C(  21), -INT8_C(   6), -INT8_C(   9),  INT8_C(  14), -INT8_C(  20),  INT8_C(  33),  INT8_C(  76), -INT8_C( 127),
+       INT8_C(  47),  INT8_C(   1), -INT8_C(   8), -INT8_C(  17), -INT8_C(  35),  INT8_C(  21), -INT8_C(  47),  INT8_C( 117),
+       INT8_C(  46),  INT8_C(  11), -INT8_C(  30),  INT8_C(  48),  INT8_C( 119),  INT8_C(  71),  INT8_C( 126),  INT8_C(  51),
+       INT8_C(  36), -INT8_C(   8), -INT8_C(  22),  INT8_C(  59),  INT8_C(  37), -INT8_C(  41),  INT8_C(  35),  INT8_C(  16),
+      -INT8_C(  47),  INT8_C(  26),  INT8_C(  30), -INT8_C(  66),  INT8_C(  59),  INT8_C( 107),  INT8_C(  63),  INT8_C( 107),
+       INT8_C( 108),  INT8_C(  56),  INT8_C(  90),  INT8_C(  73),  INT8_C(  77),  INT8_C(  43), -INT8_C(  65),  INT8_C( 123),
+       INT8_C(  54), -INT8_C(  95), -INT8_C(  85), -INT8_C(  82), -INT8_C(  24),  INT8_C(  41), -INT8_C(  31),  INT8_C(  13),
+       INT8_C(  33), -INT8_C(  53),  INT8_C(  72),  INT8_C(  70), -INT8_C(  93),  INT8_C( 107),  INT8_C(  86),  INT8_C( 116),
+      -INT8_C( 122),  INT8_C( 117),  INT8_C(  50), -INT8_C(  63), -INT8_C(  32),  INT8_C( 114),  INT8_C(  44),  INT8_C(  76),
+      -INT8_C(  86), -INT8_C( 122), -INT8_C( 107), -INT8_C(   9), -INT8_C(  78),  INT8_C(  84),  INT8_C( 114), -INT8_C(  24),
+      -INT8_C(  11),  INT8_C(  30), -INT8_C( 106), -INT8_C(  34),  INT8_C(  71),  INT8_C( 119), -INT8_C(  21),  INT8_C( 105),
+       INT8_C(  67),  INT8_C(  51), -INT8_C(  81), -INT8_C(  26), -INT8_C(  98),  INT8_C(   6),  INT8_C(  90),  INT8_C(  36),
+       INT8_C( 123), -INT8_C( 115), -INT8_C(  26),  INT8_C(  91), -INT8_C(   1),  INT8_C(  18), -INT8_C(  89), -INT8_C(  87),
+      -INT8_C( 103),  INT8_C(  60), -INT8_C(  96),  INT8_C(  75), -INT8_C( 111),  INT8_C(  18),  INT8_C(  51), -INT8_C( 122),
+       INT8_C(  48), -INT8_C(  54),  INT8_C( 100),  INT8_C( 120),  INT8_C(  65),  INT8_C(  79), -INT8_C(  31), -INT8_C( 124),
+      -INT8_C( 126), -INT8_C( 112),  INT8_C( 106),  INT8_C(  33), -INT8_C( 106), -INT8_C(  59),  INT8_C(  69),  INT8_C(  17),
+       INT8_C(  82),  INT8_C(  43),  INT8_C( 108),  INT8_C(  81),  INT8_C(  62),  INT8_C(  19), -INT8_C(   6), -INT8_C(  41),
+       INT8_C(  80), -INT8_C( 102),  INT8_C(  34), -INT8_C(  31), -INT8_C(  84),  INT8_C(  85),  INT8_C( 103), -INT8_C(  35),
+       INT8_C(  31), -INT8_C(  52),  INT8_C(  85),  INT8_C(  97),  INT8_C(  27),  INT8_C(  54), -INT8_C(  27), -INT8_C(  98),
+      -INT8_C(  58),  INT8_C(  80), -INT8_C(  65),  INT8_C(  93),  INT8_C(  21),  INT8_C(   4),  INT8_C( 110),  INT8_C( 103),
+       INT8_C(  48), -INT8_C(  37), -INT8_C(  72),  INT8_C( 110), -INT8_C(  18), -INT8_C(  78),  INT8_C(  69),  INT8_C(  62),
+       INT8_C(  76),  INT8_C( 103),  INT8_C(  31), -INT8_C(   8), -INT8_C(  68), -INT8_C( 121), -INT8_C(  43), -INT8_C(  36),
+       INT8_C(  83),  INT8_C(  42),  INT8_C(  61),  INT8_C( 110),  INT8_C(  96),  INT8_C(  34),  INT8_C(  12),  INT8_C(  39),
+       INT8_C( 114), -INT8_C(  53), -INT8_C( 124), -INT8_C( 121), -INT8_C(  48), -INT8_C(  14), -INT8_C(  18),  INT8_C(   0),
+      -INT8_C(  51), -INT8_C(  90),  INT8_C( 110), -INT8_C(  68),  INT8_C(  88), -INT8_C(  77), -INT8_C(   6), -INT8_C(  92),
+       INT8_C(  26),  INT8_C(  26), -INT8_C(  99), -INT8_C(  42), -INT8_C(  95),  INT8_C( 114), -INT8_C(  78), -INT8_C(  12),
+      -INT8_C(  99), -INT8_C(  17),  INT8_C(  98), -INT8_C(   3),  INT8_C(  18),  INT8_C( 111),  INT8_C(  36), -INT8_C( 124),
+       INT8_C(  58), -INT8_C(  88),  INT8_C(  12),  INT8_C(  10), -INT8_C( 101), -INT8_C(   6),  INT8_C(  10),  INT8_C( 104),
+      -INT8_C(  95),  INT8_C( 120),  INT8_C(  36), -INT8_C(   7),  INT8_C(  43),  INT8_C(  31), -INT8_C(  98),  INT8_C(  69),
+       INT8_C(  57),  INT8_C(  59),  INT8_C(  28), -INT8_C(  38), -INT8_C(  83), -INT8_C(  50), -INT8_C(  50),  INT8_C(  74),
+      -INT8_C(  66),  INT8_C(  48),  INT8_C(  72), -INT8_C(  48), -INT8_C(  97),  INT8_C( 108),  INT8_C(  84), -INT8_C(  38),
+       INT8_C(  21),  INT8_C(  96), -INT8_C(  28), -INT8_C(  80),  INT8_C(  91), -INT8_C(  17),  INT8_C(  24), -INT8_C(   4),
+       INT8_C( 103),  INT8_C(  61), -INT8_C(  11), -INT8_C( 109),  INT8_C(  92), -INT8_C( 109), -INT8_C(  40), -INT8_C( 107),
+      -INT8_C(  50), -INT8_C(  12),  INT8_C( 111),  INT8_C( 124), -INT8_C(  61),  INT8_C(  61), -INT8_C(  58), -INT8_C( 127),
+       INT8_C( 109),  INT8_C(  14),  INT8_C(  81),  INT8_C(  13),  INT8_C( 123), -INT8_C(  91), -INT8_C(  25), -INT8_C( 112),
+       INT8_C(   6), -INT8_C(  53),  INT8_C(  64),  INT8_C(  97), -INT8_C(  70),  INT8_C(  88),  INT8_C(  93),  INT8_C(  34),
+      -INT8_C( 107),  INT8_C(  82), -INT8_C(  75), -INT8_C(  15), -INT8_C(  26), -INT8_C( 115), -INT8_C( 122), -INT8_C(  76),
+      -INT8_C( 126), -INT8_C(  11),  INT8_C(  48),  INT8_C(  69),  INT8_C(  50), -INT8_C(   9), -INT8_C(  58), -INT8_C(  96),
+       INT8_C(   5),  INT8_C(  23), -INT8_C(  83),      INT8_MIN, -INT8_C(  68), -INT8_C( 108),  INT8_C(  16), -INT8_C(  62),
+       INT8_C(  95),  INT8_C(  80),  INT8_C(  35),  INT8_C(  26), -INT8_C(  87),      INT8_MIN,  INT8_C(  60),  INT8_C(  62),
+      -INT8_C(  45), -INT8_C(  15),  INT8_C(  48), -INT8_C(  71),  INT8_C( 126), -INT8_C(  74),  INT8_C( 109),  INT8_C(   0),
+      -INT8_C(  84), -INT8_C(  98),  INT8_C(  69), -INT8_C(  34), -INT8_C( 107),  INT8_C(  11),  INT8_C( 126), -INT8_C( 102),
+       INT8_C(  34),  INT8_C(  43),  INT8_C(  27), -INT8_C(  33), -INT8_C(  65),  INT8_C(  43), -INT8_C(  95),  INT8_C(  31),
+       INT8_C( 124), -INT8_C(  59),  INT8_C(  57),  INT8_C(  37),  INT8_C(  69),  INT8_C( 117),  INT8_C(  99),  INT8_C(  24),
+       INT8_C( 102), -INT8_C( 109), -INT8_C(  47), -INT8_C(  28),  INT8_C(  74),  INT8_C(  63), -INT8_C(  27), -INT8_C(  10),
+      -INT8_C(  35),  INT8_C(  42), -INT8_C(  44),  INT8_C( 114),  INT8_C(  54),  INT8_C(  83),  INT8_C(  12),  INT8_C(  88),
+       INT8_C( 126),  INT8_C(  39),  INT8_C(  55),  INT8_C(  62),  INT8_C(  83), -INT8_C(  39),  INT8_C(  93), -INT8_C(  49),
+      -INT8_C(  98), -INT8_C( 106), -INT8_C(  12), -INT8_C(  29),  INT8_C(  11),  INT8_C(  87), -INT8_C(   4),  INT8_C( 113),
+      -INT8_C(  21), -INT8_C(  51),  INT8_C(  85),  INT8_C(  53),  INT8_C(  12),  INT8_C(  58),  INT8_C(  43), -INT8_C(  23),
+       INT8_C( 101), -INT8_C(   1),  INT8_C(  91), -INT8_C( 101),  INT8_C(  82),  INT8_C( 104), -INT8_C(  13), -INT8_C(  47),
+      -INT8_C( 113),  INT8_C(  43),  INT8_C(  15), -INT8_C(  30),  INT8_C(   4),  INT8_C( 108), -INT8_C(  79), -INT8_C(  94),
+       INT8_C(   2), -INT8_C(  91), -INT8_C( 123),  INT8_C(  13), -INT8_C(   3), -INT8_C( 127),  INT8_C( 126), -INT8_C(  24),
+       INT8_C(  79), -INT8_C(  45),  INT8_C(  29),  INT8_C(  91),  INT8_C(  14),  INT8_C(  72),  INT8_C(  69),  INT8_C( 115),
+       INT8_C(  71), -INT8_C(  96),  INT8_C(  14), -INT8_C( 102),  INT8_C(   8),  INT8_C(   1),  INT8_C( 107), -INT8_C( 104),
+       INT8_C(  44),  INT8_C( 122),  INT8_C( 122),  INT8_C(  48), -INT8_C(  26),  INT8_C(  44), -INT8_C(  46), -INT8_C(  24),
+      -INT8_C(  47),  INT8_C(  88), -INT8_C(  11), -INT8_C(  50), -INT8_C(  39),  INT8_C( 115), -INT8_C(  74),  INT8_C(  40),
+       INT8_C(  70), -INT8_C(  45), -INT8_C( 124),  INT8_C(  84),  INT8_C(  27), -INT8_C(  55), -INT8_C(  57),  INT8_C(  99),
+       INT8_C( 105), -INT8_C(  43), -INT8_C(   3),  INT8_C( 114), -INT8_C(  41),  INT8_C( 104),  INT8_C(  10),  INT8_C(   3),
+      -INT8_C(  30), -INT8_C( 124),  INT8_C(  52), -INT8_C(  56), -INT8_C(  80),  INT8_C(   6), -INT8_C(  80), -INT8_C( 126),
+       INT8_C(  94), -INT8_C(  91),  INT8_C(  80),  INT8_C(  56),  INT8_C(  24),  INT8_C(   7),  INT8_C(  96),  INT8_C(  94),
+      -INT8_C(  38), -INT8_C(  28), -INT8_C(  77), -INT8_C(  10), -INT8_C(  83),  INT8_C( 122),  INT8_C(  89),  INT8_C(  23),
+       INT8_C(  80),  INT8_C(  86), -INT8_C( 119),  INT8_C(  39), -INT8_C(  66), -INT8_C( 109),  INT8_C(  42), -INT8_C(  96),
+       INT8_C(  23),  INT8_C(  94),  INT8_C( 104), -INT8_C(  56),  INT8_C( 101),  INT8_C(  24),  INT8_C(  74), -INT8_C(  61),
+      -INT8_C(  67), -INT8_C( 102), -INT8_C(   5), -INT8_C(  43), -INT8_C(  95),  INT8_C(  92),  INT8_C(  51),  INT8_C( 124),
+       INT8_C(  64), -INT8_C(  26),  INT8_C( 114), -INT8_C(  18),  INT8_C(  97), -INT8_C(  53),  INT8_C(   5), -INT8_C(  79),
+       INT8_C(  33), -INT8_C( 114), -INT8_C(  40), -INT8_C(  33),  INT8_C(  33),  INT8_C(   2),      INT8_MAX,  INT8_C(  56),
+       INT8_C(  97), -INT8_C(  25),  INT8_C(   0), -INT8_C(  58), -INT8_C(   1),  INT8_C(  74), -INT8_C( 119), -INT8_C(  68),
+      -INT8_C(  27), -INT8_C( 123), -INT8_C( 111), -INT8_C( 122), -INT8_C(  31), -INT8_C(  60),  INT8_C(   2),  INT8_C(  33),
+      -INT8_C(  85),  INT8_C( 116),  INT8_C(  15),  INT8_C(  12),  INT8_C(  63),  INT8_C(  20), -INT8_C(  67),  INT8_C(  96),
+      -INT8_C(  94), -INT8_C( 107),  INT8_C(  63), -INT8_C(  61), -INT8_C( 105), -INT8_C(  66), -INT8_C(   4), -INT8_C(   8),
+      -INT8_C(  91), -INT8_C(   4), -INT8_C(  66), -INT8_C(  92),  INT8_C(  71),  INT8_C(  72),  INT8_C(  96),  INT8_C(  44),
+      -INT8_C(  51), -INT8_C(  15), -INT8_C(  78), -INT8_C(  82), -INT8_C(  74), -INT8_C(  75), -INT8_C(  49),  INT8_C(  97),
+       INT8_C(  41), -INT8_C(  33),  INT8_C( 109),  INT8_C( 105), -INT8_C(  13),  INT8_C(  42), -INT8_C(  55), -INT8_C( 106),
+      -INT8_C(  65),  INT8_C(   9),  INT8_C(  89),  INT8_C(  86), -INT8_C(  57),  INT8_C(  85),  INT8_C(  79),  INT8_C( 109),
+       INT8_C(  82),  INT8_C(  13),  INT8_C(  17), -INT8_C( 103),  INT8_C(  85),  INT8_C( 114), -INT8_C(  59),  INT8_C(  34),
+       INT8_C(  99),  INT8_C( 119), -INT8_C(  48),  INT8_C(  25),  INT8_C(  44), -INT8_C(  96),  INT8_C( 122),  INT8_C(  86),
+           INT8_MAX, -INT8_C(  25), -INT8_C(  65),  INT8_C( 114),  INT8_C(  17), -INT8_C( 120),  INT8_C(   8), -INT8_C(  48),
+      -INT8_C( 111),  INT8_C(  98),  INT8_C(  39),  INT8_C(  89), -INT8_C(  73),  INT8_C( 118), -INT8_C(  58),  INT8_C(   9),
+      -INT8_C( 125), -INT8_C(  41), -INT8_C(  94), -INT8_C(  39),  INT8_C(  73),  INT8_C( 103), -INT8_C(   5), -INT8_C(  83),
+      -INT8_C(  33), -INT8_C(  52), -INT8_C(  58),  INT8_C(  11),  INT8_C( 108),  INT8_C(  65),  INT8_C(  97), -INT8_C(  21),
+       INT8_C(  40),  INT8_C(  32),  INT8_C(  93),  INT8_C(  58), -INT8_C(  87),  INT8_C( 102),  INT8_C(  10),  INT8_C(  58),
+      -INT8_C(  56),  INT8_C(  49), -INT8_C( 109),      INT8_MAX, -INT8_C(  89),  INT8_C(  89), -INT8_C( 119),  INT8_C(  43),
+       INT8_C(  49),  INT8_C(  43),  INT8_C(   4) };
+  static const int8_t b[] =
+    {  INT8_C( 124), -INT8_C(  99),  INT8_C( 112), -INT8_C(  66), -INT8_C(  53), -INT8_C(  83),  INT8_C(  89),  INT8_C(  92),
+       INT8_C(  76), -INT8_C(  74), -INT8_C(  95),  INT8_C(  54), -INT8_C(  55),  INT8_C( 116),  INT8_C(  49),  INT8_C(  14),
+      -INT8_C(  61), -INT8_C(  14), -INT8_C( 114), -INT8_C(  14), -INT8_C(  40), -INT8_C( 123),  INT8_C( 114), -INT8_C(  20),
+       INT8_C(  19),      INT8_MAX,  INT8_C(  95), -INT8_C(   3),  INT8_C(  82),  INT8_C( 124),  INT8_C(  38), -INT8_C(  49),
+       INT8_C(  26), -INT8_C( 106), -INT8_C( 115), -INT8_C(  27),  INT8_C(  68), -INT8_C(  26),  INT8_C(  65), -INT8_C( 112),
+      -INT8_C( 100), -INT8_C(  30), -INT8_C(  58),  INT8_C( 102),  INT8_C(  86), -INT8_C(   9),  INT8_C( 116),  INT8_C(  26),
+      -INT8_C(  23),  INT8_C(   2),  INT8_C(  12), -INT8_C(  62), -INT8_C( 121),  INT8_C( 126), -INT8_C(  82), -INT8_C( 101),
+      -INT8_C(   3),  INT8_C(  13), -INT8_C( 104),  INT8_C(  80), -INT8_C( 118), -INT8_C(  66),  INT8_C(  31), -INT8_C(  92),
+       INT8_C(  84), -INT8_C(  84), -INT8_C( 119), -INT8_C( 104), -INT8_C( 110), -INT8_C(  53),  INT8_C(  40),  INT8_C(  46),
+      -INT8_C(  83), -INT8_C(  18), -INT8_C( 108),  INT8_C(   4), -INT8_C(  26),  INT8_C(   8),  INT8_C(  30), -INT8_C(  49),
+       INT8_C(  10),  INT8_C(  42), -INT8_C( 111), -INT8_C( 110), -INT8_C(  88),  INT8_C(  64),  INT8_C(  45), -INT8_C(  90),
+       INT8_C(  77), -INT8_C(  59), -INT8_C(  10), -INT8_C(  41), -INT8_C( 125),  INT8_C(  21),  INT8_C( 123), -INT8_C(  41),
+      -INT8_C(  63),  INT8_C(   5),  INT8_C( 112),  INT8_C(  83), -INT8_C(  48), -INT8_C( 104), -INT8_C( 127),  INT8_C( 125),
+      -INT8_C( 121),  INT8_C(  22), -INT8_C( 127),  INT8_C( 109),  INT8_C(  30), -INT8_C(  97),  INT8_C(  60),  INT8_C(  41),
+      -INT8_C(  55), -INT8_C(  50), -INT8_C(  69),  INT8_C( 114),  INT8_C(  14), -INT8_C(  24),  INT8_C(  24),  INT8_C(  91),
+      -INT8_C(  83),  INT8_C(  14),  INT8_C(  51),  INT8_C(  48),  INT8_C(  35), -INT8_C(  82),  INT8_C(   7), -INT8_C(  28),
+      -INT8_C(  77),  INT8_C( 119),  INT8_C(  55), -INT8_C( 125),  INT8_C(  16), -INT8_C(  72),  INT8_C(   1), -INT8_C( 105),
+      -INT8_C(  50), -INT8_C( 126),  INT8_C(   4), -INT8_C(  19),  INT8_C(  34),  INT8_C(  64),  INT8_C(  22), -INT8_C(  21),
+       INT8_C(  14), -INT8_C(  47),  INT8_C(  93),  INT8_C(  28), -INT8_C(  71),  INT8_C( 117),  INT8_C( 120),  INT8_C( 102),
+      -INT8_C( 125), -INT8_C(  85), -INT8_C( 106), -INT8_C(  90),  INT8_C(  89), -INT8_C(  99), -INT8_C( 118),  INT8_C(  13),
+       INT8_C(  21), -INT8_C(  63), -INT8_C( 112),  INT8_C(  37),  INT8_C( 122), -INT8_C( 111), -INT8_C(  68),  INT8_C(  72),
+       INT8_C(  20), -INT8_C(  64),  INT8_C(  53),  INT8_C(  54),  INT8_C(   0),  INT8_C(  75),  INT8_C(  33),  INT8_C(  15),
+       INT8_C(  28),      INT8_MAX,  INT8_C(  43), -INT8_C(  43), -INT8_C(  12), -INT8_C(  93),  INT8_C(  59),  INT8_C( 120),
+       INT8_C(  78), -INT8_C(  47),  INT8_C(  30), -INT8_C(  88),  INT8_C( 111), -INT8_C(  87), -INT8_C(  75), -INT8_C( 124),
+       INT8_C( 106),  INT8_C(  69), -INT8_C(  87), -INT8_C(  28), -INT8_C(  41),  INT8_C( 101),  INT8_C(  45), -INT8_C(  21),
+       INT8_C(  37),  INT8_C(  98),  INT8_C(  33),  INT8_C(  37), -INT8_C(  82),  INT8_C(  66),  INT8_C(  52), -INT8_C(  54),
+      -INT8_C(  63),  INT8_C(  96), -INT8_C(  96), -INT8_C(  74),  INT8_C(   3), -INT8_C(  37),  INT8_C(  46),  INT8_C(  82),
+      -INT8_C(  83),  INT8_C(  76), -INT8_C(   6),  INT8_C(  28), -INT8_C(  11), -INT8_C(  81), -INT8_C(  96),  INT8_C(  96),
+      -INT8_C(  12),  INT8_C(  73),  INT8_C(  68), -INT8_C(  53), -INT8_C(  82),  INT8_C( 113), -INT8_C(  74), -INT8_C(  45),
+      -INT8_C(  44), -INT8_C(  41), -INT8_C(   8), -INT8_C( 126),  INT8_C(  26),  INT8_C(  45),  INT8_C(  76), -INT8_C(  37),
+      -INT8_C( 115), -INT8_C(  20), -INT8_C( 111), -INT8_C( 112), -INT8_C(  56), -INT8_C(  65), -INT8_C(  30),  INT8_C( 117),
+       INT8_C(  12), -INT8_C(  36), -INT8_C( 111),  INT8_C(   1), -INT8_C( 117),  INT8_C(  49),  INT8_C(  97),      INT8_MIN,
+       INT8_C( 122), -INT8_C(  90),  INT8_C(  75),  INT8_C(  40),  INT8_C(  23),  INT8_C(   2), -INT8_C(   5), -INT8_C(  21),
+      -INT8_C(  39), -INT8_C(  13),  INT8_C( 109), -INT8_C(  13),  INT8_C(  32), -INT8_C(  70), -INT8_C(  49), -INT8_C(  83),
+      -INT8_C(  90),  INT8_C(  96),  INT8_C(  62),  INT8_C( 110),  INT8_C(  32),  INT8_C(  32), -INT8_C(  29),  INT8_C(  44),
+      -INT8_C(   3),  INT8_C( 116),  INT8_C(  45), -INT8_C( 120), -INT8_C(  91), -INT8_C( 113),  INT8_C(   8),  INT8_C(  31),
+       INT8_C(  53),  INT8_C(  84),  INT8_C(  71),  INT8_C(  76),  INT8_C(  86),  INT8_C(  66),  INT8_C(  56),  INT8_C(  47),
+       INT8_C(  54), -INT8_C(  91),  INT8_C(  35),  INT8_C(  86),  INT8_C(  95), -INT8_C(  14),  INT8_C(   4),  INT8_C(   6),
+       INT8_C(  82),  INT8_C(  66),  INT8_C( 116),  INT8_C( 114),  INT8_C(  98),  INT8_C(  88), -INT8_C(  98),  INT8_C(  95),
+      -INT8_C(  52), -INT8_C(  52), -INT8_C(  24),  INT8_C( 114),  INT8_C(  91), -INT8_C(  16), -INT8_C( 111), -INT8_C( 112),
+       INT8_C(  68), -INT8_C(  39), -INT8_C(  36), -INT8_C( 102),  INT8_C(  27),  INT8_C(  20), -INT8_C(  54),  INT8_C(  81),
+      -INT8_C(  70), -INT8_C(  19), -INT8_C(  88),  INT8_C(  25), -INT8_C(  33), -INT8_C(  84),  INT8_C(  31),  INT8_C(  49),
+      -INT8_C(  18), -INT8_C( 108), -INT8_C(  92),  INT8_C(  80), -INT8_C(  20),  INT8_C(  66), -INT8_C(  80), -INT8_C(  72),
+       INT8_C(  14), -INT8_C( 104),  INT8_C(  42),  INT8_C( 105), -INT8_C( 120), -INT8_C(  68), -INT8_C(   7), -INT8_C(  51),
+      -INT8_C( 107), -INT8_C(  42),  INT8_C( 103), -INT8_C(  80), -INT8_C(  22),  INT8_C(  49),  INT8_C(   2), -INT8_C(  92),
+       INT8_C(  30), -INT8_C(  86), -INT8_C(  66), -INT8_C(   3),  INT8_C(  86), -INT8_C(  35),  INT8_C(  47),  INT8_C(  68),
+       INT8_C( 113), -INT8_C(  45), -INT8_C( 108),  INT8_C(  93),  INT8_C(  21),  INT8_C(  68),  INT8_C(  22),  INT8_C(  36),
+      -INT8_C(  36),  INT8_C(  64), -INT8_C( 115),  INT8_C( 101), -INT8_C(   4), -INT8_C( 121),  INT8_C(  50), -INT8_C( 111),
+       INT8_C(  93), -INT8_C( 103),  INT8_C(  66),  INT8_C(  71), -INT8_C(  53),  INT8_C(  68), -INT8_C(  20), -INT8_C(  23),
+      -INT8_C(  18), -INT8_C(  86), -INT8_C(  25),  INT8_C(  68), -INT8_C( 121),  INT8_C(  22), -INT8_C( 120), -INT8_C(   7),
+      -INT8_C(  23),  INT8_C(  28),  INT8_C(  86), -INT8_C(   2),  INT8_C(  97),  INT8_C( 108),  INT8_C(  34),  INT8_C(  61),
+      -INT8_C(  83), -INT8_C(  80), -INT8_C(  94), -INT8_C(  87),  INT8_C(  55), -INT8_C(  44),  INT8_C(  59), -INT8_C( 108),
+       INT8_C( 110),  INT8_C( 125), -INT8_C(  37),  INT8_C(  57), -INT8_C(  63), -INT8_C(  57),  INT8_C(  34), -INT8_C(  81),
+       INT8_C( 113),  INT8_C(   9), -INT8_C(  13), -INT8_C(   7),  INT8_C(  31),  INT8_C( 123), -INT8_C(  14),  INT8_C(   8),
+      -INT8_C( 105),  INT8_C(  72),  INT8_C(   7), -INT8_C(   8), -INT8_C(  75),  INT8_C(  41),  INT8_C(  54),  INT8_C(  98),
+      -INT8_C(  39), -INT8_C(  40),  INT8_C(  11),  INT8_C(  16), -INT8_C(  83),  INT8_C(  70), -INT8_C(  92),  INT8_C(  27),
+      -INT8_C(  61),      INT8_MIN,  INT8_C(  84), -INT8_C( 124),  INT8_C(  71),  INT8_C( 118),  INT8_C(  51), -INT8_C(  71),
+           INT8_MIN,  INT8_C(  38), -INT8_C(  78), -INT8_C(  97), -INT8_C(  95), -INT8_C(  92), -INT8_C(  88),  INT8_C(  57),
+      -INT8_C(  20), -INT8_C(  81),  INT8_C(  49), -INT8_C(  95), -INT8_C(  40),  INT8_C( 103),  INT8_C(   3), -INT8_C(  78),
+       INT8_C(  64),  INT8_C(  15), -INT8_C(  62), -INT8_C(  19),  INT8_C(  85),  INT8_C( 103),  INT8_C(   8),  INT8_C(  25),
+      -INT8_C(  25),  INT8_C(  92), -INT8_C(  99),  INT8_C(  46), -INT8_C(  46), -INT8_C(  47), -INT8_C(  25),  INT8_C(  82),
+      -INT8_C(   9), -INT8_C( 103), -INT8_C(  14), -INT8_C( 103),  INT8_C(  61), -INT8_C( 102), -INT8_C(  46),  INT8_C(  42),
+       INT8_C(  73),  INT8_C(   3), -INT8_C(  53),  INT8_C(  33),  INT8_C( 107), -INT8_C(  49), -INT8_C(  45), -INT8_C(  85),
+      -INT8_C(  34), -INT8_C( 106), -INT8_C( 104),  INT8_C(  51), -INT8_C(   3), -INT8_C(  96),  INT8_C(  76), -INT8_C(  28),
+      -INT8_C(   4), -INT8_C(  22),  INT8_C(  18), -INT8_C(  50), -INT8_C(  69), -INT8_C(   6),  INT8_C(  33), -INT8_C(  78),
+      -INT8_C( 109),  INT8_C(  19),  INT8_C(  75), -INT8_C(  47), -INT8_C(  83),  INT8_C(  29), -INT8_C(   5), -INT8_C(  10),
+       INT8_C(  33), -INT8_C(  58),  INT8_C(  23), -INT8_C( 116), -INT8_C( 107), -INT8_C(  21),  INT8_C(  55),  INT8_C( 115),
+      -INT8_C( 127), -INT8_C(  49), -INT8_C(  89),  INT8_C( 126),  INT8_C( 111), -INT8_C(  13),  INT8_C(  98),  INT8_C( 107),
+      -INT8_C(  35),  INT8_C( 116),  INT8_C(  57), -INT8_C( 104),  INT8_C( 110),  INT8_C(  90),  INT8_C(  75),  INT8_C(   2),
+       INT8_C( 109), -INT8_C( 106), -INT8_C(  45),  INT8_C(  26), -INT8_C(  76), -INT8_C(  50),  INT8_C(  16), -INT8_C(  43),
+      -INT8_C( 108),  INT8_C(  40),  INT8_C(  97),  INT8_C(  42),  INT8_C(  19), -INT8_C( 104), -INT8_C(  99), -INT8_C( 108),
+       INT8_C( 103),  INT8_C(  68),  INT8_C(  18), -INT8_C(  42),  INT8_C(  56),  INT8_C( 116),  INT8_C(  65),  INT8_C(  21),
+      -INT8_C(  24),  INT8_C( 122), -INT8_C(  82),  INT8_C(  87), -INT8_C(  43), -INT8_C(   7),  INT8_C(  89),  INT8_C(  66),
+      -INT8_C( 113),  INT8_C(  44),  INT8_C(  93),  INT8_C(  67), -INT8_C(   6),  INT8_C( 109),  INT8_C(  24), -INT8_C( 114),
+      -INT8_C( 107),  INT8_C( 121), -INT8_C(  72), -INT8_C(  88),  INT8_C(  17),  INT8_C(  86),  INT8_C(  60),  INT8_C( 120),
+      -INT8_C( 102),  INT8_C(  78),  INT8_C(  78), -INT8_C(  46), -INT8_C(  62), -INT8_C( 113), -INT8_C(  24), -INT8_C(  85),
+       INT8_C(  10), -INT8_C( 106),  INT8_C(   2), -INT8_C(  33), -INT8_C( 113),  INT8_C(  91),  INT8_C(  33),  INT8_C(  30),
+      -INT8_C( 121),  INT8_C( 126),  INT8_C(  98), -INT8_C( 127), -INT8_C(  20),  INT8_C( 122),  INT8_C(  15), -INT8_C( 127),
+      -INT8_C(  12), -INT8_C(  56),  INT8_C(  42),  INT8_C(   5),  INT8_C(  30),  INT8_C( 102),  INT8_C( 126), -INT8_C(  72),
+      -INT8_C(  75), -INT8_C(  52), -INT8_C( 117),  INT8_C( 119),  INT8_C(  92),  INT8_C( 115),  INT8_C(  34),  INT8_C( 102),
+       INT8_C(   9),  INT8_C(  36),  INT8_C(  69), -INT8_C( 104),      INT8_MAX,  INT8_C( 102), -INT8_C(  74),  INT8_C(   6),
+      -INT8_C(  27),  INT8_C(  24), -INT8_C( 121), -INT8_C(  47), -INT8_C( 109), -INT8_C( 105),  INT8_C(  82), -INT8_C( 121),
+       INT8_C(  95),  INT8_C( 124), -INT8_C( 116),  INT8_C( 125), -INT8_C(  29),  INT8_C(  10),  INT8_C(  53), -INT8_C( 104),
+      -INT8_C(  41), -INT8_C(  64),  INT8_C(  15) };
+  static const int8_t c[] =
+    { -INT8_C(  10),  INT8_C(  24),  INT8_C( 126), -INT8_C(  80),  INT8_C(  12), -INT8_C(   8), -INT8_C( 111),  INT8_C(  77),
+       INT8_C(  75), -INT8_C(  69),  INT8_C(  88), -INT8_C(  22), -INT8_C(  53),  INT8_C(  10),  INT8_C(  11),  INT8_C(  76),
+      -INT8_C(  99),  INT8_C(  27), -INT8_C(   6), -INT8_C( 107), -INT8_C(  36),  INT8_C(  97), -INT8_C(  98),  INT8_C(  70),
+      -INT8_C(  41),  INT8_C(  29), -INT8_C(  31),  INT8_C(  60),  INT8_C(  34), -INT8_C(  50), -INT8_C(  81),  INT8_C(  24),
+      -INT8_C(  26),  INT8_C(  45), -INT8_C(  56), -INT8_C(  13),  INT8_C(  38),  INT8_C(  90),  INT8_C(  64),  INT8_C( 113),
+       INT8_C(  21), -INT8_C( 104),  INT8_C(  92), -INT8_C(  32), -INT8_C(  93),  INT8_C( 103),  INT8_C(  45),  INT8_C(  64),
+      -INT8_C( 126),  INT8_C(  39), -INT8_C(  43),  INT8_C(  94), -INT8_C( 120),  INT8_C( 115), -INT8_C(  92),  INT8_C(  95),
+      -INT8_C( 111), -INT8_C( 122), -INT8_C( 101), -INT8_C(  77),  INT8_C(  84),  INT8_C(  75), -INT8_C(  53),  INT8_C(  59),
+       INT8_C( 120), -INT8_C( 109),  INT8_C(  46), -INT8_C(  98), -INT8_C(  19),  INT8_C( 110),  INT8_C(  16),  INT8_C(   2),
+       INT8_C(   6),  INT8_C( 108), -INT8_C(  29), -INT8_C(  87), -INT8_C(  45),  INT8_C(  16), -INT8_C(  23),  INT8_C(  86),
+       INT8_C(  55), -INT8_C(  66), -INT8_C(  76), -INT8_C(  64),  INT8_C(  50),  INT8_C(  89),  INT8_C(  31), -INT8_C(  61),
+      -INT8_C(  33), -INT8_C(  69),  INT8_C( 118),  INT8_C(  51),  INT8_C(   6),  INT8_C(  65),  INT8_C( 110),  INT8_C( 126),
+      -INT8_C(  44), -INT8_C( 100),  INT8_C(  29), -INT8_C(  62),  INT8_C(  10),  INT8_C(  45), -INT8_C(  60),  INT8_C(  17),
+      -INT8_C( 103), -INT8_C(  89), -INT8_C(  70),  INT8_C( 108), -INT8_C(  73), -INT8_C(  92), -INT8_C(  62), -INT8_C(  17),
+       INT8_C(  98),  INT8_C( 119), -INT8_C(  81), -INT8_C( 108), -INT8_C(  48), -INT8_C(  50),  INT8_C(  87), -INT8_C(  81),
+      -INT8_C( 119), -INT8_C(  51), -INT8_C(  30), -INT8_C( 113),  INT8_C(  14),  INT8_C(  81),  INT8_C(  14), -INT8_C(  29),
+      -INT8_C(  19),  INT8_C(  43), -INT8_C(  91), -INT8_C(   8),  INT8_C(  88),  INT8_C( 105),  INT8_C(   9), -INT8_C(  15),
+       INT8_C(  17), -INT8_C(  61),  INT8_C(  93), -INT8_C(  56),  INT8_C( 103),  INT8_C(  32), -INT8_C(  73), -INT8_C(  54),
+      -INT8_C( 105),  INT8_C( 102),  INT8_C(  94),  INT8_C( 103),  INT8_C(  53), -INT8_C(  74),  INT8_C(  22), -INT8_C(  66),
+      -INT8_C( 125), -INT8_C(   8),  INT8_C(  78), -INT8_C( 110),  INT8_C(  73),  INT8_C(  92),  INT8_C( 117),  INT8_C(  55),
+      -INT8_C( 121),  INT8_C(  26),  INT8_C(  47), -INT8_C(  33), -INT8_C( 125),  INT8_C(  56), -INT8_C(  48), -INT8_C( 108),
+      -INT8_C(   5),  INT8_C(  45),  INT8_C(  93),  INT8_C(  99),  INT8_C(  77),  INT8_C(  20),  INT8_C(  45), -INT8_C(  28),
+       INT8_C( 123), -INT8_C( 117),  INT8_C(  75), -INT8_C(  80),  INT8_C(  65),  INT8_C(  97),  INT8_C( 110), -INT8_C(  59),
+       INT8_C(  90), -INT8_C(  68),  INT8_C(  87), -INT8_C(  93),  INT8_C(  24), -INT8_C(  52), -INT8_C(  38), -INT8_C(  97),
+      -INT8_C(  26),  INT8_C(   9),  INT8_C( 126),  INT8_C( 105),  INT8_C(  65),  INT8_C(  78), -INT8_C(   2),  INT8_C(  61),
+       INT8_C( 124),  INT8_C(  91), -INT8_C(  96), -INT8_C(  55),  INT8_C( 111), -INT8_C(  51), -INT8_C(  82), -INT8_C(  22),
+       INT8_C(  88), -INT8_C(   7), -INT8_C( 102), -INT8_C( 102),  INT8_C(  91),  INT8_C(   9),  INT8_C(  95), -INT8_C(  75),
+      -INT8_C(  59), -INT8_C(  74),  INT8_C(  88), -INT8_C(  34), -INT8_C( 126),  INT8_C(  51),  INT8_C( 125),  INT8_C( 104),
+       INT8_C(  60), -INT8_C(   4), -INT8_C(  47),  INT8_C( 126),  INT8_C(  74), -INT8_C(  49), -INT8_C(  69), -INT8_C(  58),
+       INT8_C(  42),  INT8_C(  91), -INT8_C( 112), -INT8_C( 102),  INT8_C(  40),  INT8_C(  62), -INT8_C( 124),      INT8_MIN,
+       INT8_C(  55),  INT8_C(  31),  INT8_C(  26), -INT8_C( 110),  INT8_C(  40),  INT8_C( 121),  INT8_C(  71), -INT8_C(  19),
+       INT8_C(  47), -INT8_C(  96), -INT8_C(  53), -INT8_C(  79), -INT8_C(  45),  INT8_C(  73),  INT8_C(  25),  INT8_C(  15),
+       INT8_C(  69), -INT8_C(  21), -INT8_C( 115), -INT8_C( 113), -INT8_C(  70),  INT8_C(  72),  INT8_C(  86), -INT8_C(  27),
+      -INT8_C(  93), -INT8_C(  26),      INT8_MAX, -INT8_C(  53),  INT8_C(  36),  INT8_C(   3),  INT8_C(  76),  INT8_C(  91),
+       INT8_C(  34),  INT8_C( 102), -INT8_C(  18),  INT8_C(  74), -INT8_C(  32),  INT8_C(  53),  INT8_C(  56),  INT8_C(  15),
+      -INT8_C(  43),  INT8_C(   3), -INT8_C(  63), -INT8_C(  88),  INT8_C(  76), -INT8_C(  38), -INT8_C(  72), -INT8_C( 111),
+      -INT8_C(  59),  INT8_C(  69),  INT8_C(  33),      INT8_MIN, -INT8_C( 114),  INT8_C( 119),  INT8_C( 101),  INT8_C(  49),
+       INT8_C(  93), -INT8_C(  28), -INT8_C(   3), -INT8_C( 127), -INT8_C(  25),  INT8_C(  73), -INT8_C(  36),  INT8_C(  10),
+      -INT8_C(  81), -INT8_C(  54),  INT8_C(  84), -INT8_C( 113),  INT8_C(   0), -INT8_C( 116), -INT8_C(  97), -INT8_C(  43),
+      -INT8_C( 112),  INT8_C(  96),  INT8_C( 126), -INT8_C(  36),  INT8_C(  58),  INT8_C(  54),  INT8_C( 110),  INT8_C(   0),
+       INT8_C( 123), -INT8_C( 113),      INT8_MIN,  INT8_C(   9),  INT8_C(   6), -INT8_C(  27),  INT8_C(  59),  INT8_C(  99),
+      -INT8_C(  55),  INT8_C(  56), -INT8_C(  28), -INT8_C(  80), -INT8_C( 127), -INT8_C(  64), -INT8_C(  70),  INT8_C(  48),
+      -INT8_C( 117),  INT8_C(  15), -INT8_C(  64), -INT8_C( 117), -INT8_C( 101),  INT8_C(  95),  INT8_C(  96),  INT8_C(  43),
+      -INT8_C(  65), -INT8_C(  34),  INT8_C(   8), -INT8_C(   7),  INT8_C(  20),  INT8_C( 118), -INT8_C(   7), -INT8_C( 112),
+       INT8_C(   5),  INT8_C( 121), -INT8_C( 103),  INT8_C(  11),  INT8_C(  94), -INT8_C(  44),  INT8_C( 110),  INT8_C(  39),
+       INT8_C(  12),  INT8_C(  82), -INT8_C(  40), -INT8_C( 115),  INT8_C(  18), -INT8_C( 110), -INT8_C(  66), -INT8_C(  99),
+      -INT8_C(  95),  INT8_C( 126),  INT8_C(  40),  INT8_C(  61), -INT8_C(  35), -INT8_C( 119),  INT8_C( 104), -INT8_C( 100),
+       INT8_C( 103),  INT8_C( 112), -INT8_C( 107),  INT8_C( 124), -INT8_C(  26), -INT8_C( 113),  INT8_C(  12), -INT8_C(  21),
+       INT8_C(   8), -INT8_C(  91), -INT8_C(  10),  INT8_C( 103),  INT8_C( 122),  INT8_C( 100), -INT8_C( 114), -INT8_C( 122),
+      -INT8_C(  74),  INT8_C( 102),  INT8_C(  20), -INT8_C(  55), -INT8_C(   7), -INT8_C(  46),  INT8_C( 102), -INT8_C( 102),
+       INT8_C(  80), -INT8_C( 113), -INT8_C(  41),  INT8_C(  45),  INT8_C(  24),  INT8_C(  64), -INT8_C(  55),      INT8_MAX,
+      -INT8_C(  80),  INT8_C(  94), -INT8_C(   5), -INT8_C( 105), -INT8_C(  19),  INT8_C(   7), -INT8_C( 126), -INT8_C(  10),
+      -INT8_C(  83),  INT8_C( 121),  INT8_C(  93),  INT8_C(  39), -INT8_C(  35), -INT8_C(  21), -INT8_C(  83), -INT8_C( 108),
+       INT8_C(  82), -INT8_C(  63),  INT8_C(  93),  INT8_C(  75), -INT8_C( 109), -INT8_C(  61), -INT8_C(  27), -INT8_C(  29),
+       INT8_C(  82), -INT8_C(  67),  INT8_C(  16),  INT8_C( 106), -INT8_C(   3), -INT8_C(  39), -INT8_C(  22), -INT8_C(  83),
+       INT8_C(  56), -INT8_C(  27),  INT8_C(  68),  INT8_C(  37), -INT8_C(  19), -INT8_C(  57),  INT8_C(  27), -INT8_C( 102),
+       INT8_C(  64),  INT8_C( 120), -INT8_C(  63),  INT8_C(  29),  INT8_C( 100),  INT8_C( 110), -INT8_C(  79), -INT8_C(  74),
+       INT8_C(  48),  INT8_C(  14),  INT8_C(   1), -INT8_C(  61), -INT8_C(  46), -INT8_C(  26), -INT8_C(  89),  INT8_C(  36),
+      -INT8_C(  93), -INT8_C(  73), -INT8_C( 113), -INT8_C(  96), -INT8_C( 111),  INT8_C( 121),  INT8_C(  78), -INT8_C(  55),
+       INT8_C(  94), -INT8_C( 110), -INT8_C(  18),  INT8_C(  75),  INT8_C(  89),  INT8_C(  10), -INT8_C(  27), -INT8_C( 103),
+      -INT8_C( 126), -INT8_C(  90), -INT8_C(  73), -INT8_C(  26),  INT8_C(  21),  INT8_C( 104), -INT8_C( 100),  INT8_C(  69),
+       INT8_C( 119), -INT8_C(  99),  INT8_C(   8),  INT8_C(  73), -INT8_C( 124), -INT8_C(  81),  INT8_C( 109),  INT8_C(  39),
+       INT8_C( 103), -INT8_C(   4), -INT8_C(  56), -INT8_C(   8),  INT8_C( 117),  INT8_C(  22), -INT8_C(  63), -INT8_C(  44),
+      -INT8_C(  88), -INT8_C(  81),  INT8_C(  31),  INT8_C(   2), -INT8_C(  71),  INT8_C(   5), -INT8_C( 101),  INT8_C(  60),
+      -INT8_C(  85),  INT8_C(  82),  INT8_C(  34), -INT8_C(  64), -INT8_C(  69), -INT8_C(  65),  INT8_C(   5),  INT8_C(  50),
+       INT8_C(  92),  INT8_C(  14),  INT8_C( 123), -INT8_C(  32), -INT8_C(  67), -INT8_C(  24),  INT8_C(   8),  INT8_C(  36),
+      -INT8_C(  27), -INT8_C(  48),  INT8_C(  28),  INT8_C(  90), -INT8_C(  26), -INT8_C(  35),  INT8_C(  46), -INT8_C( 114),
+      -INT8_C( 115),  INT8_C(  78), -INT8_C( 112),  INT8_C(  70),  INT8_C(  83),  INT8_C(  44), -INT8_C( 126), -INT8_C(   2),
+       INT8_C( 126), -INT8_C(  91), -INT8_C(  65),  INT8_C(  57),  INT8_C( 100), -INT8_C(  60),  INT8_C( 107), -INT8_C(  64),
+      -INT8_C(  46), -INT8_C(  26), -INT8_C(  95), -INT8_C( 112), -INT8_C(  49), -INT8_C(  87), -INT8_C(  76), -INT8_C(  76),
+       INT8_C( 121), -INT8_C(  47),  INT8_C(  14),  INT8_C(  95), -INT8_C(  82),  INT8_C(  61), -INT8_C(  19),  INT8_C(  59),
+      -INT8_C( 117),  INT8_C( 126), -INT8_C( 126), -INT8_C(  34), -INT8_C(  86),  INT8_C(   4), -INT8_C(  36),  INT8_C(  40),
+      -INT8_C(  87), -INT8_C( 101),  INT8_C(  98),  INT8_C(  13),  INT8_C(  96), -INT8_C(  51), -INT8_C(  50),  INT8_C(  50),
+      -INT8_C(  76),  INT8_C( 111), -INT8_C(  62), -INT8_C( 125),  INT8_C(  24),  INT8_C( 119),  INT8_C(  55), -INT8_C( 111),
+       INT8_C(  72),  INT8_C(  69), -INT8_C(  16), -INT8_C(  10), -INT8_C( 126), -INT8_C(  35),  INT8_C(  50),  INT8_C(  13),
+       INT8_C(  91), -INT8_C(  76), -INT8_C(  21),  INT8_C(   5), -INT8_C(  72), -INT8_C(  56),  INT8_C(  46),  INT8_C(  98),
+       INT8_C(  99), -INT8_C( 112),  INT8_C( 111), -INT8_C(  61),  INT8_C(  93),  INT8_C(  61), -INT8_C(  10),  INT8_C(  17),
+      -INT8_C(  84), -INT8_C(  72), -INT8_C( 108), -INT8_C(  60),  INT8_C(  47), -INT8_C(  53),  INT8_C(  85),  INT8_C( 119),
+       INT8_C(  17),  INT8_C(  69),  INT8_C( 110), -INT8_C( 109),  INT8_C(  35), -INT8_C(  96), -INT8_C(  95),  INT8_C( 126),
+       INT8_C(  84), -INT8_C( 116), -INT8_C( 124),  INT8_C(  12),  INT8_C(  84), -INT8_C(  78),  INT8_C( 110), -INT8_C(  72),
+       INT8_C(  66), -INT8_C(  34),  INT8_C( 123), -INT8_C(  97),  INT8_C(  27),  INT8_C( 113), -INT8_C(  79), -INT8_C(  56),
+       INT8_C(  42),  INT8_C(  69), -INT8_C( 116),  INT8_C(  89),  INT8_C(  17), -INT8_C(  30), -INT8_C(  47),  INT8_C(  34),
+       INT8_C(  39),  INT8_C(  63), -INT8_C(  75),  INT8_C(  74), -INT8_C(  33),  INT8_C(  86), -INT8_C(  55),  INT8_C(  51),
+      -INT8_C(  29),  INT8_C(  77),  INT8_C(  63) };
+  static const int8_t e[] =
+    { -INT8_C(  69), -INT8_C(  95),  INT8_C( 122), -INT8_C( 126),  INT8_C(  22),  INT8_C(  97), -INT8_C(  19), -INT8_C(  24),
+      -INT8_C(  21), -INT8_C(   6), -INT8_C(  81), -INT8_C(  34), -INT8_C(  20),  INT8_C(  33), -INT8_C( 105),  INT8_C(  90),
+       INT8_C( 106),  INT8_C(   1), -INT8_C(   8), -INT8_C(  17),  INT8_C(  84),  INT8_C(  74), -INT8_C(  80),  INT8_C( 117),
+       INT8_C(  46),  INT8_C(  11), -INT8_C(  30), -INT8_C(  84),  INT8_C( 119),  INT8_C(  50),  INT8_C(  99),  INT8_C(  51),
+       INT8_C(  36),  INT8_C( 125), -INT8_C(  22),  INT8_C(  59), -INT8_C(   6), -INT8_C(  41),  INT8_C(  35),  INT8_C(  16),
+      -INT8_C(  47),  INT8_C(  26), -INT8_C( 112), -INT8_C( 108),  INT8_C( 117), -INT8_C(  92),  INT8_C(  63),  INT8_C(  30),
+      -INT8_C(  50), -INT8_C( 105),  INT8_C(  13),  INT8_C(  73),  INT8_C(  35),  INT8_C(  43),  INT8_C( 118),  INT8_C( 123),
+      -INT8_C(  17), -INT8_C(  95), -INT8_C(  85),  INT8_C(  19),  INT8_C( 100), -INT8_C(  71), -INT8_C(  31), -INT8_C( 113),
+       INT8_C(  76), -INT8_C(   9),  INT8_C(  72),  INT8_C(  46), -INT8_C(  29),  INT8_C(  71),      INT8_MIN,  INT8_C( 116),
+      -INT8_C( 122),  INT8_C( 117), -INT8_C(  53), -INT8_C(  63), -INT8_C(  32),  INT8_C( 114),  INT8_C(  17), -INT8_C(  54),
+      -INT8_C(  37), -INT8_C( 122), -INT8_C( 107), -INT8_C(  98),  INT8_C(   2),  INT8_C(  84),  INT8_C(  41),  INT8_C(  51),
+      -INT8_C(  11), -INT8_C(  47), -INT8_C( 102), -INT8_C(  91),  INT8_C(  71),  INT8_C(   4),  INT8_C(  87), -INT8_C(  83),
+       INT8_C(  87), -INT8_C( 101), -INT8_C(  81), -INT8_C(  26),  INT8_C( 106), -INT8_C(  67),  INT8_C(  90),  INT8_C(  36),
+       INT8_C( 123), -INT8_C(  59), -INT8_C(  26),  INT8_C(  91), -INT8_C(   1), -INT8_C(  46), -INT8_C(  89), -INT8_C(  87),
+      -INT8_C( 103), -INT8_C(  65), -INT8_C( 113), -INT8_C(   6), -INT8_C(  66),  INT8_C(  18),  INT8_C(  31),  INT8_C(  81),
+      -INT8_C(   7), -INT8_C(  54), -INT8_C(  50),  INT8_C(  15),  INT8_C(  65),  INT8_C(  79),  INT8_C(  53),  INT8_C( 115),
+      -INT8_C( 126),  INT8_C(  27),  INT8_C( 107),  INT8_C(  33), -INT8_C(  72), -INT8_C(  59),  INT8_C(  69), -INT8_C(   8),
+       INT8_C(  13),  INT8_C(  43),  INT8_C( 108),  INT8_C(  81),  INT8_C(  62), -INT8_C(  32), -INT8_C(   6),  INT8_C(  39),
+       INT8_C(  80),  INT8_C(  32),  INT8_C(  34),  INT8_C(   3), -INT8_C( 127), -INT8_C( 113),  INT8_C(  94), -INT8_C(  35),
+       INT8_C(  31), -INT8_C(  52),  INT8_C(  85),  INT8_C(  97),  INT8_C(  27),  INT8_C( 122), -INT8_C(  25),  INT8_C(  61),
+      -INT8_C(  59),  INT8_C(  80), -INT8_C(  97),  INT8_C(  93),  INT8_C(  21),  INT8_C( 124), -INT8_C( 104),  INT8_C( 103),
+       INT8_C(  48), -INT8_C(  37), -INT8_C(  72), -INT8_C( 105),  INT8_C(  77), -INT8_C(  78),  INT8_C(  69),  INT8_C(  62),
+       INT8_C(  76), -INT8_C(  92),  INT8_C(  31),  INT8_C(   8),  INT8_C( 113),  INT8_C(  86), -INT8_C(  43), -INT8_C(  27),
+       INT8_C(  83),  INT8_C(  42),  INT8_C( 125),  INT8_C( 110),  INT8_C(  96),  INT8_C(  34),  INT8_C(  86), -INT8_C(  69),
+       INT8_C(  26), -INT8_C(  64), -INT8_C(  94), -INT8_C( 121), -INT8_C(  48), -INT8_C(  56), -INT8_C(  18),  INT8_C(  61),
+      -INT8_C(  51), -INT8_C(  25),  INT8_C( 110), -INT8_C(  11),  INT8_C(  88), -INT8_C(  77), -INT8_C(   6), -INT8_C(  92),
+       INT8_C(  26),  INT8_C(  26), -INT8_C(  99), -INT8_C(  66), -INT8_C(  95),  INT8_C( 114), -INT8_C(  78), -INT8_C(  12),
+      -INT8_C(  34), -INT8_C(  17),  INT8_C(  12), -INT8_C( 118),  INT8_C(  18),  INT8_C(  20), -INT8_C(   3), -INT8_C( 124),
+       INT8_C(  58), -INT8_C(  28),  INT8_C(  12),  INT8_C( 108), -INT8_C( 101),  INT8_C(  41),  INT8_C(  10),  INT8_C( 104),
+      -INT8_C(  95),  INT8_C(  35),  INT8_C(  36),  INT8_C(  12),  INT8_C(  43),  INT8_C(  31), -INT8_C(  98),  INT8_C(  69),
+      -INT8_C( 100),  INT8_C(  59), -INT8_C(  10), -INT8_C(  38),  INT8_C(  80),  INT8_C(  43), -INT8_C(  50),  INT8_C(  74),
+       INT8_C(  23), -INT8_C(  32),  INT8_C(  72), -INT8_C(  48),  INT8_C(  40),  INT8_C( 108),  INT8_C(  84),  INT8_C(  15),
+       INT8_C(  71),  INT8_C(  43), -INT8_C(  28),  INT8_C(  15),  INT8_C(  91),  INT8_C(  38),  INT8_C(  24),  INT8_C(  57),
+       INT8_C( 103),  INT8_C(  61), -INT8_C(  48), -INT8_C( 109), -INT8_C(  92), -INT8_C(  47), -INT8_C(  40),  INT8_C(  12),
+      -INT8_C(  74), -INT8_C(  26), -INT8_C(  48),  INT8_C( 124),  INT8_C(  64), -INT8_C(  43), -INT8_C(  54),  INT8_C(  59),
+      -INT8_C( 114),  INT8_C(  14),  INT8_C(  81),  INT8_C(  13),  INT8_C( 123),  INT8_C(   5), -INT8_C(  25),  INT8_C(   1),
+       INT8_C(   6), -INT8_C(  53), -INT8_C(  31),  INT8_C(  76), -INT8_C(  70),  INT8_C(  88),  INT8_C(  93),  INT8_C(  34),
+      -INT8_C( 107), -INT8_C(  66), -INT8_C(  75), -INT8_C(  15),  INT8_C(  65), -INT8_C( 109), -INT8_C(  12), -INT8_C(  76),
+       INT8_C(  83), -INT8_C(  12),  INT8_C(  20),  INT8_C(  69),  INT8_C(  50),  INT8_C( 116), -INT8_C(  58), -INT8_C(  96),
+      -INT8_C( 116),  INT8_C(  23),  INT8_C(  70),      INT8_MIN,  INT8_C(  14), -INT8_C(  10),  INT8_C(  16), -INT8_C(  62),
+       INT8_C(  95),  INT8_C(  80), -INT8_C( 108),  INT8_C(  26), -INT8_C(  87),      INT8_MIN, -INT8_C( 109),  INT8_C(   1),
+      -INT8_C(  45), -INT8_C(  15),  INT8_C( 100), -INT8_C(  63),  INT8_C(  67),  INT8_C(   8),  INT8_C( 109),  INT8_C(   0),
+      -INT8_C(  84), -INT8_C(  98), -INT8_C(  12), -INT8_C(  21), -INT8_C(   9),  INT8_C(  53),  INT8_C( 126), -INT8_C(  37),
+       INT8_C(  34),  INT8_C( 102),  INT8_C(  27), -INT8_C(  33), -INT8_C( 116),  INT8_C(  10), -INT8_C(  95),  INT8_C(  99),
+       INT8_C(  49), -INT8_C(  59),  INT8_C(  57),  INT8_C( 123),  INT8_C(  69),  INT8_C(  57),  INT8_C(  52),  INT8_C(  24),
+       INT8_C(   0), -INT8_C(  16), -INT8_C(  47), -INT8_C(  28),  INT8_C(  74), -INT8_C(  11), -INT8_C(  55), -INT8_C(  11),
+       INT8_C(  46),  INT8_C(  42), -INT8_C(  72), -INT8_C(  89),  INT8_C(  54),  INT8_C(  83),  INT8_C(  12),  INT8_C(  88),
+       INT8_C( 126),  INT8_C(  48),  INT8_C(  55), -INT8_C(  14),  INT8_C(  83), -INT8_C(   2),  INT8_C(  54),  INT8_C(  42),
+       INT8_C( 110), -INT8_C( 106), -INT8_C(  34),  INT8_C(  92),  INT8_C(  51),  INT8_C(  87), -INT8_C(   4),  INT8_C(  95),
+      -INT8_C(  21), -INT8_C( 120),  INT8_C(  85), -INT8_C(  35),  INT8_C(  12), -INT8_C(  50),  INT8_C(  43),  INT8_C(  59),
+       INT8_C( 101), -INT8_C(   1),  INT8_C(  91), -INT8_C(   9),  INT8_C(  82),  INT8_C(  32),  INT8_C(  15),  INT8_C(  76),
+      -INT8_C( 113),  INT8_C(  43),  INT8_C(  15), -INT8_C(  55),  INT8_C(   4),  INT8_C( 108), -INT8_C(  79), -INT8_C(  98),
+       INT8_C(   2), -INT8_C(  91),  INT8_C(  36),  INT8_C(  12), -INT8_C( 102), -INT8_C( 127),  INT8_C( 105),  INT8_C(  44),
+       INT8_C(  49),  INT8_C(  44),  INT8_C(  29),  INT8_C(  91),  INT8_C(  69),  INT8_C(  91),  INT8_C(  31),  INT8_C( 123),
+       INT8_C(  71), -INT8_C(  96),  INT8_C(  14), -INT8_C( 102),  INT8_C(   8),  INT8_C(   1),  INT8_C( 107), -INT8_C(  35),
+      -INT8_C( 124), -INT8_C(  43),  INT8_C( 122),  INT8_C(  37),  INT8_C(  91), -INT8_C(  49), -INT8_C(  93),  INT8_C(  18),
+      -INT8_C(  47),  INT8_C(  88),  INT8_C(  37),  INT8_C(  85), -INT8_C(  39),  INT8_C( 115), -INT8_C(  13),  INT8_C(  40),
+       INT8_C(  70), -INT8_C(  45), -INT8_C( 124), -INT8_C(  17), -INT8_C(  51), -INT8_C(  55), -INT8_C(  57),  INT8_C(  99),
+       INT8_C( 111),  INT8_C(  82), -INT8_C(   4),  INT8_C(  82), -INT8_C(   7),  INT8_C(  81),  INT8_C(  10), -INT8_C(  33),
+      -INT8_C(  30),  INT8_C(  78),  INT8_C(  52), -INT8_C(  56), -INT8_C(  80),  INT8_C(   6), -INT8_C(  80), -INT8_C( 126),
+       INT8_C(  94), -INT8_C(  14),  INT8_C(  80), -INT8_C(  10),  INT8_C(  24),  INT8_C(  31),  INT8_C(  96),  INT8_C(  94),
+      -INT8_C(  51), -INT8_C(  31),  INT8_C(  62),  INT8_C(  79), -INT8_C(  67),  INT8_C( 122),  INT8_C( 111), -INT8_C(  19),
+       INT8_C(  55),  INT8_C(  86), -INT8_C( 119), -INT8_C(   1), -INT8_C(  66), -INT8_C(  13),  INT8_C(  42), -INT8_C(  76),
+      -INT8_C( 102), -INT8_C(  61), -INT8_C(  33), -INT8_C(  38), -INT8_C( 118),  INT8_C(   5),  INT8_C(  74), -INT8_C(  61),
+      -INT8_C(  73), -INT8_C( 102), -INT8_C(  56),  INT8_C(  38), -INT8_C(  95),  INT8_C(  92),  INT8_C(  51),  INT8_C( 106),
+       INT8_C(  28),  INT8_C(  32), -INT8_C(  31),  INT8_C(  46),  INT8_C(  74), -INT8_C(  53),  INT8_C(   5), -INT8_C(  79),
+       INT8_C(  38), -INT8_C(  92), -INT8_C(  40), -INT8_C(  33),  INT8_C(  27),  INT8_C(   2),  INT8_C( 119),  INT8_C(  56),
+       INT8_C(  97),  INT8_C(  23),  INT8_C(   0), -INT8_C(  70), -INT8_C(  28),  INT8_C(  74), -INT8_C(  12), -INT8_C( 110),
+      -INT8_C(  27), -INT8_C(  23),  INT8_C(   8), -INT8_C(  55), -INT8_C(  31), -INT8_C(  84),  INT8_C(   1),  INT8_C(   2),
+      -INT8_C(  85),  INT8_C( 116),  INT8_C(  15),  INT8_C(  12),  INT8_C(  27), -INT8_C(  63), -INT8_C( 124),  INT8_C(  96),
+      -INT8_C(  94),  INT8_C(  25),  INT8_C(  63), -INT8_C(  61), -INT8_C( 105), -INT8_C(  66), -INT8_C(   4), -INT8_C(   8),
+      -INT8_C(  91), -INT8_C(   4), -INT8_C(  66), -INT8_C(  92),  INT8_C(  50),  INT8_C(  72),  INT8_C(  96),  INT8_C(  44),
+       INT8_C( 113),  INT8_C( 117),  INT8_C(  94),  INT8_C(  47), -INT8_C(  74), -INT8_C(  75), -INT8_C(  59),  INT8_C(  52),
+       INT8_C(  41), -INT8_C(  33),  INT8_C(  91), -INT8_C(   2),  INT8_C( 102),  INT8_C(  42), -INT8_C(  55), -INT8_C( 106),
+       INT8_C( 115), -INT8_C( 122),  INT8_C(  89),  INT8_C( 102), -INT8_C(  57),  INT8_C( 107), -INT8_C(  74),  INT8_C(  37),
+       INT8_C(  82),  INT8_C(  13),  INT8_C(  25), -INT8_C( 121),  INT8_C(  85),  INT8_C( 118), -INT8_C(  74),  INT8_C(  24),
+       INT8_C(  99),  INT8_C( 119),  INT8_C(  15), -INT8_C( 118),  INT8_C(  44),  INT8_C(  29),  INT8_C( 122),  INT8_C(  37),
+      -INT8_C(  91),  INT8_C( 106), -INT8_C(  78),  INT8_C(  54), -INT8_C(  37), -INT8_C( 101), -INT8_C(  51),  INT8_C(  71),
+       INT8_C(  69),  INT8_C(  98), -INT8_C(  44),  INT8_C(  80), -INT8_C( 107), -INT8_C(  92), -INT8_C(  58), -INT8_C(  10),
+      -INT8_C(  13), -INT8_C(  41), -INT8_C(  94), -INT8_C(  21), -INT8_C( 112),  INT8_C( 103), -INT8_C(  60), -INT8_C(  83),
+      -INT8_C(  33), -INT8_C( 114), -INT8_C(  39),  INT8_C(  39),  INT8_C( 108),  INT8_C(  87),  INT8_C(  97), -INT8_C(  21),
+      -INT8_C(  14),  INT8_C(  69), -INT8_C( 105), -INT8_C(  77),  INT8_C(  28),  INT8_C(  12),  INT8_C(  10),  INT8_C(  58),
+       INT8_C(  95), -INT8_C(   5),  INT8_C(  25),  INT8_C(  77), -INT8_C(  89),  INT8_C(  89),  INT8_C(  38),  INT8_C(  43),
+       INT8_C(  49),  INT8_C(  43),  INT8_C( 123) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i])),
+      cv = simde_svld1_s8(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmad_s8_m(pv, av, bv, cv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], c[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+    cv = simde_svld1_s8(pg, &(c[i]));
+
+    ev = simde_svmad_s8_m(pv, av, bv, cv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) };
+  static const int16_t a[] =
+    {  INT16_C( 28846), -INT16_C( 18368),  INT16_C( 25705), -INT16_C( 21972),  INT16_C( 32742),  INT16_C( 27453),  INT16_C( 30863),  INT16_C(  5398),
+       INT16_C( 17059), -INT16_C( 15887),  INT16_C( 26442), -INT16_C(  2122),  INT16_C( 10313),  INT16_C( 26967),  INT16_C( 15395), -INT16_C( 11707),
+      -INT16_C( 31316),  INT16_C(  5514), -INT16_C( 18710), -INT16_C( 12097), -INT16_C(   971), -INT16_C( 15300),  INT16_C( 21108),  INT16_C(  6105),
+      -INT16_C( 13676), -INT16_C(  8232), -INT16_C( 29135),  INT16_C( 31446),  INT16_C( 11703), -INT16_C(  9500),  INT16_C( 10601),  INT16_C(  5548),
+       INT16_C( 13999), -INT16_C( 26326), -INT16_C(  5396),  INT16_C(  8553), -INT16_C( 23066),  INT16_C( 23526), -INT16_C( 16392), -INT16_C( 29582),
+       INT16_C( 19338), -INT16_C( 17557),  INT16_C( 17113), -INT16_C( 28618),  INT16_C(  6767), -INT16_C(  9877),  INT16_C(  5955), -INT16_C(  3346),
+       INT16_C(  6478),  INT16_C( 14987), -INT16_C(  2813), -INT16_C(  5796),  INT16_C( 17050), -INT16_C( 28092), -INT16_C( 18687), -INT16_C( 29921),
+      -INT16_C( 30206), -INT16_C(  9401),  INT16_C( 32204),  INT16_C( 15468), -INT16_C( 10345), -INT16_C(  9707),  INT16_C(  1006),  INT16_C( 15565),
+       INT16_C( 22556),  INT16_C(  8055), -INT16_C( 11443), -INT16_C(  6135),  INT16_C( 19733),  INT16_C(  5754), -INT16_C( 26364),  INT16_C(  1698),
+      -INT16_C(  5852), -INT16_C(  3870),  INT16_C( 20070), -INT16_C(   724),  INT16_C( 16677),  INT16_C(  5079), -INT16_C( 23483),  INT16_C( 24912),
+      -INT16_C( 14339),  INT16_C( 19073), -INT16_C( 30054), -INT16_C( 20686), -INT16_C( 21033), -INT16_C(  9019),  INT16_C( 26438),  INT16_C( 27362),
+      -INT16_C( 15280), -INT16_C( 18853), -INT16_C( 30958),  INT16_C( 14259), -INT16_C( 29751),  INT16_C(  3659), -INT16_C( 25809),  INT16_C( 11375),
+      -INT16_C(  3998), -INT16_C(   905), -INT16_C( 22150),  INT16_C( 21163),  INT16_C( 28758), -INT16_C( 25298),  INT16_C(  4312),  INT16_C( 10247),
+       INT16_C( 25301), -INT16_C(  6177), -INT16_C( 27926), -INT16_C( 19681),  INT16_C( 27165),  INT16_C( 19905),  INT16_C( 12293),  INT16_C( 26489),
+      -INT16_C(  4063), -INT16_C( 25757),  INT16_C(  3738), -INT16_C(  3859),  INT16_C(  7038),  INT16_C( 22157), -INT16_C( 27348),  INT16_C(   383),
+       INT16_C( 24311), -INT16_C(  7704),  INT16_C(  2032),  INT16_C(  3732),  INT16_C( 21873),  INT16_C( 30299), -INT16_C( 11130), -INT16_C( 22563),
+       INT16_C( 16581),  INT16_C( 24386),  INT16_C( 12366), -INT16_C( 12977), -INT16_C(  8885),  INT16_C( 30499), -INT16_C( 23950),  INT16_C( 27000),
+       INT16_C( 24832), -INT16_C(  3765), -INT16_C(  8344), -INT16_C(  9473),  INT16_C( 23093), -INT16_C( 17584),  INT16_C( 11822), -INT16_C(  3230),
+      -INT16_C( 23442), -INT16_C( 17070), -INT16_C( 23852),  INT16_C(  8330), -INT16_C( 21121), -INT16_C(  3689),  INT16_C(  4176),  INT16_C( 20570),
+      -INT16_C( 23183), -INT16_C(  9919),  INT16_C( 16517), -INT16_C( 17741),  INT16_C(  1178), -INT16_C( 13963), -INT16_C( 10446), -INT16_C( 24388),
+       INT16_C(  3963),  INT16_C( 20573), -INT16_C(  6223),  INT16_C( 12400),  INT16_C(  1941), -INT16_C(  6879),  INT16_C( 31511), -INT16_C( 30667),
+       INT16_C( 30497), -INT16_C( 22942),  INT16_C(  5559),  INT16_C( 21088), -INT16_C( 10983),  INT16_C( 19227), -INT16_C( 10324),  INT16_C( 10220),
+       INT16_C( 18918), -INT16_C( 26761), -INT16_C(  6351), -INT16_C( 14649), -INT16_C(  5905),  INT16_C(  1707), -INT16_C(  8092), -INT16_C( 31345),
+      -INT16_C(  3753),  INT16_C(  3883), -INT16_C( 29946),  INT16_C(  8289),  INT16_C( 31840),  INT16_C(  3179),  INT16_C( 22355),  INT16_C( 14899),
+      -INT16_C( 21599), -INT16_C( 11567), -INT16_C( 26222), -INT16_C( 32360),  INT16_C( 17281), -INT16_C(  6776),  INT16_C(  5923),  INT16_C( 31594),
+      -INT16_C( 27384),  INT16_C(  3722), -INT16_C(  5344), -INT16_C( 32722), -INT16_C( 26009), -INT16_C( 17780), -INT16_C( 16143), -INT16_C( 27916),
+      -INT16_C( 14741), -INT16_C(   668), -INT16_C(   929), -INT16_C(  8065),  INT16_C(  1855),  INT16_C( 25542),  INT16_C( 12318),  INT16_C(  9950),
+       INT16_C( 26822), -INT16_C(  6604),  INT16_C( 25427), -INT16_C( 17817), -INT16_C(  3075), -INT16_C(  4492),  INT16_C( 27059),  INT16_C(  7809),
+      -INT16_C(  6865), -INT16_C( 29156), -INT16_C( 25630),  INT16_C(  8558),  INT16_C( 13474), -INT16_C( 16252),  INT16_C( 25189),  INT16_C( 11238),
+       INT16_C(  6858),  INT16_C(  7441),  INT16_C( 30845),  INT16_C( 31447),  INT16_C( 19564),  INT16_C(  8041), -INT16_C(  5451), -INT16_C(  7106),
+       INT16_C( 23247), -INT16_C( 20110), -INT16_C(  7947), -INT16_C( 26669),  INT16_C( 22293),  INT16_C( 31319),  INT16_C( 15802), -INT16_C( 31579),
+      -INT16_C( 18857), -INT16_C( 10846),  INT16_C( 31023), -INT16_C( 25777), -INT16_C( 18235),  INT16_C( 31418), -INT16_C(  1886),  INT16_C( 29278),
+      -INT16_C( 12206),  INT16_C( 18211), -INT16_C(  2383), -INT16_C( 14626),  INT16_C( 13646),  INT16_C(  2112), -INT16_C(  6798), -INT16_C( 13684),
+       INT16_C( 11931), -INT16_C( 13665), -INT16_C(  4440),  INT16_C( 28005),  INT16_C(  8359),  INT16_C( 18920),  INT16_C( 17944),  INT16_C( 27579),
+      -INT16_C(  8425), -INT16_C( 14158), -INT16_C( 28203),  INT16_C(  9102), -INT16_C( 12602),  INT16_C( 14635), -INT16_C( 18253),  INT16_C( 19971),
+      -INT16_C( 23834), -INT16_C( 29159),  INT16_C( 32400),  INT16_C( 14332), -INT16_C(  7010), -INT16_C( 18559),  INT16_C( 15402),  INT16_C( 16674),
+      -INT16_C( 11237), -INT16_C(  3831), -INT16_C( 26779),  INT16_C( 11284),  INT16_C( 16485),  INT16_C(  6245),  INT16_C( 26872), -INT16_C(  8601),
+      -INT16_C( 32758), -INT16_C( 26003),  INT16_C( 27134), -INT16_C( 25134),  INT16_C( 21325),  INT16_C( 30548),  INT16_C( 30351), -INT16_C( 21575),
+      -INT16_C( 15798), -INT16_C( 20324), -INT16_C( 20390), -INT16_C( 16420) };
+  static const int16_t b[] =
+    { -INT16_C( 31833), -INT16_C( 14968), -INT16_C(  8996), -INT16_C( 11459), -INT16_C(  9621),  INT16_C(  8331),  INT16_C( 11768),  INT16_C( 29726),
+       INT16_C( 12233),  INT16_C( 14259), -INT16_C( 11759), -INT16_C( 15299),  INT16_C(  5633), -INT16_C( 22821), -INT16_C( 26751),  INT16_C( 10308),
+      -INT16_C( 13286), -INT16_C(  2323),  INT16_C( 11176),  INT16_C(  5065),  INT16_C( 21765), -INT16_C(   716),  INT16_C( 21122),  INT16_C( 19569),
+       INT16_C(  9345), -INT16_C( 27773), -INT16_C( 15882), -INT16_C(  1961),  INT16_C( 13015),  INT16_C( 22942), -INT16_C(  7479), -INT16_C(  7295),
+       INT16_C( 28590),  INT16_C( 22490), -INT16_C( 23654), -INT16_C( 24726), -INT16_C( 24840),  INT16_C( 31644),  INT16_C(  3569),  INT16_C( 29383),
+       INT16_C( 18993),  INT16_C(  9989),  INT16_C( 23563), -INT16_C(  7393), -INT16_C( 16754),  INT16_C( 22332), -INT16_C( 16992),  INT16_C( 20283),
+       INT16_C(  5420), -INT16_C( 14682),  INT16_C(  4280), -INT16_C( 20123),  INT16_C(   431), -INT16_C( 24532), -INT16_C(  3314),  INT16_C( 16146),
+       INT16_C(  6205),  INT16_C( 18791), -INT16_C( 31116),  INT16_C(   812),  INT16_C( 26692), -INT16_C(  6822), -INT16_C( 27355),  INT16_C( 21044),
+      -INT16_C(  9558),  INT16_C( 25368),  INT16_C( 32490), -INT16_C( 26348),  INT16_C( 16511), -INT16_C( 29127),  INT16_C( 19507),  INT16_C( 28877),
+       INT16_C( 13412), -INT16_C( 10055), -INT16_C(  6725), -INT16_C(    37),  INT16_C( 13901),  INT16_C( 29668),  INT16_C(  6347),  INT16_C( 30405),
+      -INT16_C(  8718), -INT16_C(  8743), -INT16_C(  4773), -INT16_C(  9354), -INT16_C( 20435),  INT16_C( 24681),  INT16_C( 14076),  INT16_C( 24784),
+      -INT16_C( 30101),  INT16_C(  9784),  INT16_C(  5231), -INT16_C( 17115),  INT16_C(  2634),  INT16_C(  5424), -INT16_C(  2782),  INT16_C(  5515),
+       INT16_C( 25810),  INT16_C( 12018),  INT16_C( 26705),  INT16_C( 32265),  INT16_C( 29208),  INT16_C(  5342), -INT16_C( 20568),  INT16_C(  4980),
+      -INT16_C( 21191), -INT16_C( 22471),  INT16_C( 24513),  INT16_C(  2917), -INT16_C( 27287), -INT16_C( 29920), -INT16_C( 21366),  INT16_C( 23968),
+      -INT16_C( 28144),  INT16_C( 25227), -INT16_C( 27397),  INT16_C(  5088), -INT16_C( 16634), -INT16_C( 20952), -INT16_C( 25490), -INT16_C( 22590),
+      -INT16_C(  1207),  INT16_C(  2639), -INT16_C( 19110), -INT16_C( 15595),  INT16_C( 13898), -INT16_C( 10929), -INT16_C(  4126), -INT16_C(  3534),
+      -INT16_C( 17022),  INT16_C( 32084),  INT16_C( 13649),  INT16_C( 22416), -INT16_C( 18188),  INT16_C( 25093), -INT16_C( 14507), -INT16_C( 25079),
+       INT16_C( 22723),  INT16_C(  7593), -INT16_C( 16883),  INT16_C( 22753),  INT16_C( 12532), -INT16_C( 10707),  INT16_C( 24351), -INT16_C( 24119),
+       INT16_C(  7452),  INT16_C( 27934), -INT16_C( 20654),  INT16_C( 18116), -INT16_C( 13977), -INT16_C( 17240), -INT16_C( 20079),  INT16_C( 21595),
+       INT16_C(  1034),  INT16_C(  6001),  INT16_C( 21186), -INT16_C( 18577), -INT16_C( 25470), -INT16_C( 23923),  INT16_C( 22267),  INT16_C(  5955),
+       INT16_C( 25204), -INT16_C( 14716),  INT16_C( 18449),  INT16_C( 30733), -INT16_C( 19182), -INT16_C( 23755), -INT16_C( 28569),  INT16_C( 29175),
+       INT16_C( 26772),  INT16_C( 22152), -INT16_C(  1861),  INT16_C( 15629), -INT16_C( 25708), -INT16_C( 28449),  INT16_C(  9201),  INT16_C( 26023),
+       INT16_C( 11397), -INT16_C( 27092),  INT16_C( 14708), -INT16_C( 31218),  INT16_C( 17390),  INT16_C( 21801),  INT16_C(  8403),  INT16_C( 26566),
+       INT16_C( 20361),  INT16_C( 17598), -INT16_C( 13497), -INT16_C(  9343),  INT16_C( 24934),  INT16_C( 22635),  INT16_C(  4996),  INT16_C(  2493),
+      -INT16_C(  5825), -INT16_C( 19553), -INT16_C( 21214),  INT16_C(  4410),  INT16_C( 25585), -INT16_C( 15258),  INT16_C( 11652),  INT16_C(  3372),
+      -INT16_C(  5508), -INT16_C( 15535), -INT16_C( 11595),  INT16_C(  7326),  INT16_C(  2611), -INT16_C( 18572),  INT16_C( 12573),  INT16_C( 23744),
+       INT16_C( 24347),  INT16_C( 15631),  INT16_C( 18701), -INT16_C(   434), -INT16_C( 19027),  INT16_C( 12738), -INT16_C(  4382),  INT16_C( 24126),
+      -INT16_C( 28712), -INT16_C( 29151), -INT16_C( 16543), -INT16_C( 27222),  INT16_C(  7881), -INT16_C(  6580),  INT16_C(  3407),  INT16_C( 27202),
+       INT16_C( 21100),  INT16_C( 31144), -INT16_C(  2405),  INT16_C( 18551),  INT16_C( 15019), -INT16_C( 29319), -INT16_C( 18648),  INT16_C(   491),
+       INT16_C(  3142), -INT16_C( 22385),  INT16_C( 14796), -INT16_C( 27331), -INT16_C( 30377), -INT16_C( 22916), -INT16_C( 16746),  INT16_C(   785),
+      -INT16_C( 18160), -INT16_C( 21380), -INT16_C(  2897),  INT16_C( 23540),  INT16_C( 28206),  INT16_C( 22248), -INT16_C( 11227),  INT16_C( 27735),
+      -INT16_C(  6432), -INT16_C( 21484),  INT16_C( 20767),  INT16_C( 30274), -INT16_C( 16678),  INT16_C( 28957),  INT16_C( 11900), -INT16_C( 29324),
+      -INT16_C(  3865), -INT16_C( 27079),  INT16_C( 11748),  INT16_C(  4849), -INT16_C(  9573), -INT16_C( 16023), -INT16_C( 16210), -INT16_C( 29139),
+       INT16_C( 16807), -INT16_C( 14789),  INT16_C( 32146),  INT16_C( 27709),  INT16_C( 23099), -INT16_C( 18467),  INT16_C( 20872),  INT16_C( 28484),
+       INT16_C( 32066),  INT16_C(  9733), -INT16_C(  2133),  INT16_C( 17977), -INT16_C( 23855),  INT16_C( 32519),  INT16_C( 13410),  INT16_C(  2317),
+       INT16_C( 18549),  INT16_C(  2000),  INT16_C(  3525),  INT16_C(   116),  INT16_C( 20839), -INT16_C(  4168), -INT16_C(   861), -INT16_C(  6818),
+       INT16_C( 25466),  INT16_C(  9483),  INT16_C( 17498),  INT16_C( 11115),  INT16_C( 29670),  INT16_C( 18858), -INT16_C( 18265),  INT16_C(  7506),
+       INT16_C(  8704), -INT16_C( 14812), -INT16_C( 26577), -INT16_C( 26938),  INT16_C( 32490), -INT16_C( 29307), -INT16_C(  7301), -INT16_C(  2702),
+       INT16_C( 32071), -INT16_C( 24294), -INT16_C( 31294), -INT16_C( 22323) };
+  static const int16_t c[] =
+    { -INT16_C( 12082), -INT16_C(  6858), -INT16_C(  5368),  INT16_C(  9638),  INT16_C( 27084),  INT16_C( 27811),  INT16_C( 16899), -INT16_C(  2070),
+       INT16_C( 31860),  INT16_C( 12816), -INT16_C( 11504),  INT16_C(  1129), -INT16_C( 20299), -INT16_C( 12638), -INT16_C( 10961), -INT16_C(   433),
+      -INT16_C( 31322), -INT16_C( 20765), -INT16_C( 30095),  INT16_C( 15828),  INT16_C( 30707), -INT16_C(  2135), -INT16_C( 27718),  INT16_C( 12014),
+      -INT16_C(   497),  INT16_C(  8032), -INT16_C( 13615), -INT16_C( 31196), -INT16_C( 14726), -INT16_C( 21932), -INT16_C( 23652),  INT16_C( 17064),
+      -INT16_C( 29911), -INT16_C( 25872), -INT16_C( 15339),  INT16_C(  2519), -INT16_C( 32708), -INT16_C(  2560), -INT16_C(  4589),  INT16_C(  8996),
+      -INT16_C( 31252), -INT16_C( 17086),  INT16_C( 26191), -INT16_C( 14013), -INT16_C( 26835), -INT16_C( 13965),  INT16_C(  6970),  INT16_C( 25355),
+      -INT16_C(  1113), -INT16_C( 17155), -INT16_C( 11072), -INT16_C(   827), -INT16_C( 15020),  INT16_C( 26866),  INT16_C(  5811), -INT16_C( 24693),
+      -INT16_C( 12901), -INT16_C(  5540), -INT16_C( 24780),  INT16_C( 25012),  INT16_C( 10038),  INT16_C( 28970),  INT16_C( 13635), -INT16_C(  5420),
+      -INT16_C( 11728), -INT16_C(  3930),  INT16_C( 27814), -INT16_C(  1044), -INT16_C(  8655), -INT16_C(  6813), -INT16_C(  4363), -INT16_C( 28540),
+      -INT16_C(  7749), -INT16_C(  4229),  INT16_C( 12160), -INT16_C( 18608),  INT16_C( 31318), -INT16_C( 26328), -INT16_C(   849), -INT16_C(  8061),
+       INT16_C( 10958),  INT16_C( 30160), -INT16_C( 17002), -INT16_C( 14480), -INT16_C( 11365), -INT16_C( 28500),  INT16_C( 12737),  INT16_C( 31777),
+      -INT16_C( 25582), -INT16_C( 28052), -INT16_C( 17205),  INT16_C(  8521),  INT16_C( 28983), -INT16_C(  6469),  INT16_C( 15982),  INT16_C( 15558),
+      -INT16_C( 26776), -INT16_C(   335),  INT16_C(  8532), -INT16_C(  4154),  INT16_C( 29428), -INT16_C( 19072), -INT16_C( 24157), -INT16_C( 19150),
+      -INT16_C( 25027),  INT16_C(  2120), -INT16_C( 28326), -INT16_C( 28375), -INT16_C(  7165),  INT16_C( 29048),  INT16_C( 15907), -INT16_C( 29779),
+       INT16_C( 24533),  INT16_C( 10634),  INT16_C( 20608),  INT16_C( 29977), -INT16_C( 26174),  INT16_C( 26154),  INT16_C( 23610),  INT16_C( 30491),
+       INT16_C( 25594),  INT16_C( 21887), -INT16_C( 22283), -INT16_C(  1818),  INT16_C( 24205), -INT16_C( 20375),  INT16_C(  5789),  INT16_C( 29243),
+      -INT16_C( 14987), -INT16_C(  2404), -INT16_C( 19179), -INT16_C( 10133), -INT16_C( 27314), -INT16_C( 30658),  INT16_C( 23026), -INT16_C(  4865),
+       INT16_C( 32445), -INT16_C( 19903),  INT16_C( 10278), -INT16_C( 19542),  INT16_C(  4998),  INT16_C(  9059), -INT16_C( 24791), -INT16_C( 24682),
+       INT16_C( 12900),  INT16_C( 31381),  INT16_C(   231),  INT16_C( 13650), -INT16_C( 28523), -INT16_C( 30787), -INT16_C( 17175), -INT16_C( 22924),
+      -INT16_C( 19142),  INT16_C( 24664),  INT16_C(   733),  INT16_C( 25620),  INT16_C( 30485),  INT16_C( 16263),  INT16_C(  7446),  INT16_C( 31710),
+       INT16_C( 29519),  INT16_C( 14069),  INT16_C( 18291),  INT16_C(  2155),  INT16_C( 10455), -INT16_C( 16240),  INT16_C(  1252),  INT16_C(  7783),
+      -INT16_C( 16455), -INT16_C( 26753), -INT16_C( 27710), -INT16_C( 10245), -INT16_C( 32246),  INT16_C(  8470), -INT16_C(  2912), -INT16_C(  4196),
+      -INT16_C( 28313), -INT16_C(  9690), -INT16_C( 28200), -INT16_C( 20509),  INT16_C( 29626), -INT16_C( 24977), -INT16_C( 10633),  INT16_C( 12477),
+       INT16_C( 15510),  INT16_C( 22727), -INT16_C( 15665), -INT16_C(  9937),  INT16_C( 17989), -INT16_C(  6662), -INT16_C( 27078), -INT16_C( 23852),
+      -INT16_C(  1497), -INT16_C(   132),  INT16_C( 24460),  INT16_C( 18094),  INT16_C(  7890),  INT16_C( 18916), -INT16_C( 24076), -INT16_C( 30086),
+       INT16_C( 16861), -INT16_C( 21278),  INT16_C(  4612),  INT16_C( 18822), -INT16_C( 32680), -INT16_C( 28114),  INT16_C(   535),  INT16_C( 15924),
+      -INT16_C( 19971), -INT16_C( 30402), -INT16_C(  5104), -INT16_C(  7217), -INT16_C( 19702), -INT16_C(   212), -INT16_C( 22955),  INT16_C( 12937),
+       INT16_C( 27880), -INT16_C(  4897),  INT16_C( 25982), -INT16_C( 10699),  INT16_C( 25573), -INT16_C(   920), -INT16_C( 25243),  INT16_C( 25147),
+       INT16_C( 31054),  INT16_C( 24299), -INT16_C( 17819),  INT16_C( 28737),  INT16_C( 28270), -INT16_C( 15505), -INT16_C(  2028), -INT16_C(   779),
+      -INT16_C( 11164), -INT16_C(  7448),  INT16_C(  7481),  INT16_C(  8120),  INT16_C(  8576), -INT16_C(  6629),  INT16_C( 22206),  INT16_C(  3144),
+       INT16_C( 13519),  INT16_C( 13674), -INT16_C( 21266),  INT16_C( 23717),  INT16_C(  5146),  INT16_C( 11807),  INT16_C(  5388),  INT16_C( 28971),
+       INT16_C(  5097),  INT16_C(  9043),  INT16_C(  3121), -INT16_C( 20158),  INT16_C( 23853), -INT16_C(  5225), -INT16_C(  8012), -INT16_C( 31753),
+       INT16_C( 24852),  INT16_C(   696),  INT16_C( 23821),  INT16_C( 10079),  INT16_C( 32369),  INT16_C( 32342), -INT16_C( 32365),  INT16_C( 32239),
+       INT16_C( 17044), -INT16_C( 14944), -INT16_C(  7602),  INT16_C( 31607),  INT16_C(  3647), -INT16_C(  3226),  INT16_C( 24046),  INT16_C(   631),
+       INT16_C( 12223), -INT16_C( 13307),  INT16_C( 25741), -INT16_C(   268),  INT16_C( 19170),  INT16_C( 30332),  INT16_C( 27595),  INT16_C( 24563),
+      -INT16_C( 27730), -INT16_C(   987), -INT16_C( 25483), -INT16_C( 19336), -INT16_C(  8534), -INT16_C( 26200),  INT16_C(  7996), -INT16_C(  1125),
+      -INT16_C( 24498), -INT16_C(  9273), -INT16_C( 17660), -INT16_C(  6182),  INT16_C( 22021), -INT16_C( 12195),  INT16_C( 20674),  INT16_C( 28720),
+       INT16_C( 21987),  INT16_C( 22636), -INT16_C(  6927), -INT16_C( 25844), -INT16_C( 19261), -INT16_C(   204), -INT16_C( 12077),  INT16_C(  8954),
+      -INT16_C( 16016),  INT16_C( 30205), -INT16_C( 10371), -INT16_C( 32164) };
+  static const int16_t e[] =
+    {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2526),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 27501),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7934),  INT16_C(     0), -INT16_C( 14382), -INT16_C( 24413),
+       INT16_C( 10526),  INT16_C( 15269),  INT16_C(     0),  INT16_C( 20683),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 19736),  INT16_C(     0), -INT16_C( 27426), -INT16_C(  5845),  INT16_C(  1804),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 26853),  INT16_C( 20148),  INT16_C( 23053),  INT16_C(  5713),  INT16_C( 11020),  INT16_C( 30760),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 17649),  INT16_C(     0),  INT16_C(  7912),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(  8171),  INT16_C( 25325),  INT16_C( 26532),  INT16_C(     0), -INT16_C( 15534),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4488),
+       INT16_C( 11464),  INT16_C(     0),  INT16_C(     0),  INT16_C( 32160),  INT16_C( 23452),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16322),
+       INT16_C( 17355),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8180),  INT16_C(     0), -INT16_C(  9820),  INT16_C(     0), -INT16_C( 23789),
+      -INT16_C( 24328),  INT16_C(     0), -INT16_C( 27564),  INT16_C( 20092),  INT16_C( 12902), -INT16_C(   647),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(  1964), -INT16_C( 19047),  INT16_C(     0), -INT16_C( 19631), -INT16_C( 17461), -INT16_C( 10836),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(  2351),  INT16_C(     0),  INT16_C(   457),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 23902),
+       INT16_C(     0),  INT16_C(   239),  INT16_C( 10692), -INT16_C( 28316),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11341),
+       INT16_C( 13285),  INT16_C(     0), -INT16_C( 22146),  INT16_C(     0),  INT16_C( 16566), -INT16_C( 15822),  INT16_C(     0),  INT16_C( 29273),
+      -INT16_C( 23191),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4738),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(  6783),  INT16_C(     0),  INT16_C(  9155),  INT16_C( 11739),  INT16_C( 26826),  INT16_C( 16877),  INT16_C(     0), -INT16_C( 19913),
+       INT16_C( 25021),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10807),  INT16_C(     0), -INT16_C(  3981),  INT16_C( 18619),  INT16_C( 22920),
+      -INT16_C( 23444),  INT16_C(     0),  INT16_C(     0), -INT16_C(  9478),  INT16_C(     0), -INT16_C(  2347),  INT16_C( 19001), -INT16_C( 16782),
+      -INT16_C(  4188),  INT16_C(  7433), -INT16_C( 32345),  INT16_C(     0), -INT16_C( 23223),  INT16_C( 16120),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4470),
+       INT16_C(  1741), -INT16_C(  6257),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16997),  INT16_C(     0),  INT16_C(  5776),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30418),  INT16_C(     0),  INT16_C(  1623),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(  4985),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25979),
+      -INT16_C( 16442),  INT16_C(  4683),  INT16_C( 28400),  INT16_C(     0), -INT16_C( 29117), -INT16_C(  8684),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 15939),  INT16_C(     0), -INT16_C( 28764),  INT16_C( 28138),  INT16_C(     0),  INT16_C(     0), -INT16_C(   412),  INT16_C(  9524),
+       INT16_C(     0),  INT16_C( 13850), -INT16_C( 11293),  INT16_C( 19585),  INT16_C(  9117),  INT16_C(     0),  INT16_C(  1233),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 29075), -INT16_C(  2831), -INT16_C( 28261),  INT16_C(     0), -INT16_C(   296),  INT16_C( 21154), -INT16_C( 22147),
+       INT16_C( 14114), -INT16_C(  8885),  INT16_C(     0), -INT16_C(  5533),  INT16_C(     0),  INT16_C(     0), -INT16_C( 29988),  INT16_C( 12055),
+       INT16_C(     0),  INT16_C( 18279), -INT16_C(  2603),  INT16_C(     0), -INT16_C(  6604),  INT16_C( 13047),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 30911), -INT16_C( 16222),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 18167),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9632), -INT16_C(  5393),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 12209),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8342), -INT16_C(  2801), -INT16_C( 16245),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(  1566),  INT16_C( 10376),  INT16_C( 19132),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19165),
+      -INT16_C(  4435),  INT16_C(  9087),  INT16_C(     0),  INT16_C(     0),  INT16_C( 26248),  INT16_C( 23465),  INT16_C( 31825),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(  8053),  INT16_C( 20805),  INT16_C(     0), -INT16_C( 10180), -INT16_C(  4768), -INT16_C( 14854),  INT16_C( 20503),
+       INT16_C(  9772),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20426),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2698),  INT16_C( 22574),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 10899),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 14858),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i])),
+      cv = simde_svld1_s16(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmad_s16_z(pv, av, bv, cv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], c[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+    cv = simde_svld1_s16(pg, &(c[i]));
+
+    ev = simde_svmad_s16_z(pv, av, bv, cv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1) };
+  static const int16_t a[] =
+    {  INT16_C( 19239),  INT16_C( 27214),  INT16_C( 25764), -INT16_C( 32468),  INT16_C( 28238),  INT16_C( 20604),  INT16_C( 22674),  INT16_C( 15224),
+       INT16_C(  4143), -INT16_C( 15488), -INT16_C( 24984),  INT16_C( 10102),  INT16_C( 24338),  INT16_C(  9109),  INT16_C( 24827),  INT16_C(  8950),
+       INT16_C( 17580),  INT16_C( 20621), -INT16_C( 18008), -INT16_C(  2350),  INT16_C( 20007), -INT16_C( 18106), -INT16_C( 16473), -INT16_C( 10507),
+       INT16_C( 30159),  INT16_C( 14233),  INT16_C(  3859),  INT16_C(  9566), -INT16_C(  3218),  INT16_C( 26953),  INT16_C( 16212),  INT16_C(   139),
+       INT16_C(  6276),  INT16_C( 11344),  INT16_C(  8914), -INT16_C(  1757),  INT16_C( 26993),  INT16_C(  6323), -INT16_C( 22488), -INT16_C(  2066),
+      -INT16_C( 30947),  INT16_C( 12335), -INT16_C( 29290),  INT16_C(  1109), -INT16_C( 24959), -INT16_C( 10899), -INT16_C(  1826),  INT16_C( 25301),
+       INT16_C(  9489), -INT16_C(  7282), -INT16_C( 20152), -INT16_C( 17956), -INT16_C( 28901),  INT16_C( 17361), -INT16_C( 16585),  INT16_C( 21563),
+       INT16_C( 27206), -INT16_C(  9084), -INT16_C(  9481),  INT16_C( 30944),  INT16_C( 19832),  INT16_C( 22093),  INT16_C(  8773),  INT16_C( 22200),
+       INT16_C( 18248), -INT16_C( 28615),  INT16_C(  5880),  INT16_C(  4937),  INT16_C(  6821), -INT16_C(  8873), -INT16_C( 27943),  INT16_C(  7985),
+      -INT16_C( 18692), -INT16_C(  3077), -INT16_C(  9328),  INT16_C(  2156), -INT16_C( 18136),  INT16_C( 27999),  INT16_C(  6108),  INT16_C(  9412),
+      -INT16_C(   674),  INT16_C( 22452), -INT16_C(   749), -INT16_C( 18070), -INT16_C( 16105), -INT16_C(  3946), -INT16_C( 14509),  INT16_C( 20239),
+       INT16_C(  2685),  INT16_C(  3395), -INT16_C( 20507),  INT16_C(  3350),  INT16_C( 30056),  INT16_C( 17530),  INT16_C( 16012), -INT16_C(  5272),
+       INT16_C(  7228),  INT16_C( 20290), -INT16_C( 21479),  INT16_C( 12296), -INT16_C( 24978), -INT16_C( 16096),  INT16_C( 12134), -INT16_C(  7407),
+       INT16_C( 21561),  INT16_C(  7921),  INT16_C(  1795),  INT16_C( 27435), -INT16_C( 22916),  INT16_C(  2224),  INT16_C(  6372),  INT16_C(  8435),
+       INT16_C( 13621),  INT16_C( 20080),  INT16_C( 30946),  INT16_C( 20607), -INT16_C( 24809),  INT16_C( 32017),  INT16_C(  8911),  INT16_C(  2144),
+       INT16_C( 20854),  INT16_C( 31015),  INT16_C( 21080), -INT16_C( 11035), -INT16_C( 27144), -INT16_C(  8739), -INT16_C( 12115), -INT16_C(  7427),
+       INT16_C( 27910), -INT16_C(  6095), -INT16_C( 20250), -INT16_C(   712),  INT16_C( 18767),  INT16_C(  7802), -INT16_C(  9620), -INT16_C(  7641),
+       INT16_C( 20012), -INT16_C( 31652),  INT16_C( 16800), -INT16_C( 26279),  INT16_C( 14038), -INT16_C( 31882),  INT16_C( 29446),  INT16_C(  3174),
+      -INT16_C( 26655), -INT16_C( 14348),  INT16_C( 11335), -INT16_C( 26940),  INT16_C( 15990), -INT16_C(  7499), -INT16_C(  9192),  INT16_C( 17604),
+       INT16_C(  8234), -INT16_C( 13623),  INT16_C(  8801),  INT16_C( 14179), -INT16_C(  9896),  INT16_C( 24251),  INT16_C(  8525),  INT16_C( 11883),
+       INT16_C( 24504), -INT16_C(    11), -INT16_C( 18036),  INT16_C(   661),  INT16_C( 19191),  INT16_C(  4068), -INT16_C( 22490),  INT16_C( 20564),
+       INT16_C(  7625),  INT16_C( 10779),  INT16_C( 32319), -INT16_C( 26782),  INT16_C(  7512), -INT16_C( 23051),  INT16_C( 24638), -INT16_C(  2349),
+      -INT16_C( 14144),  INT16_C( 19701), -INT16_C( 30079),  INT16_C( 30798),  INT16_C( 13013), -INT16_C(  1145), -INT16_C(  9254), -INT16_C( 23732),
+       INT16_C( 26616),  INT16_C( 14286),  INT16_C( 12517),  INT16_C( 15822), -INT16_C( 15283), -INT16_C( 29726), -INT16_C( 19164), -INT16_C(  7039),
+       INT16_C( 30333), -INT16_C(   464),  INT16_C( 32256), -INT16_C( 10890), -INT16_C(   336), -INT16_C( 29743),  INT16_C(  7641), -INT16_C( 11730),
+      -INT16_C(   892),  INT16_C( 26889), -INT16_C( 10196),  INT16_C( 31143), -INT16_C( 30308), -INT16_C( 16380), -INT16_C( 31425), -INT16_C( 17243),
+      -INT16_C( 10757), -INT16_C(   837),  INT16_C( 12628),  INT16_C(  1233), -INT16_C( 24017),  INT16_C(  2447), -INT16_C( 16705),  INT16_C( 17371),
+      -INT16_C(  6982), -INT16_C(  6227),  INT16_C( 21692),  INT16_C( 22624),  INT16_C( 26077),  INT16_C(  7193), -INT16_C( 16662), -INT16_C(  6439),
+      -INT16_C( 27501), -INT16_C(  6174), -INT16_C( 19515), -INT16_C(  2580),  INT16_C( 31574),  INT16_C(  5630), -INT16_C(  9927), -INT16_C(  2983),
+       INT16_C(  1725),  INT16_C( 31451),  INT16_C( 15194),  INT16_C( 14290), -INT16_C(  5216), -INT16_C( 29868),  INT16_C( 11689),  INT16_C( 15729),
+       INT16_C( 21441), -INT16_C( 31196),  INT16_C(  4102),  INT16_C( 23675),  INT16_C( 31116), -INT16_C( 14990), -INT16_C( 13486),  INT16_C(  4281),
+      -INT16_C( 27439),  INT16_C( 11146),  INT16_C( 23760),  INT16_C( 28770), -INT16_C( 18872), -INT16_C(  3589),  INT16_C( 27875), -INT16_C( 23506),
+       INT16_C( 21439), -INT16_C( 14805), -INT16_C( 22941), -INT16_C(  4318), -INT16_C( 27616),  INT16_C( 29365),  INT16_C( 28255),  INT16_C( 12418),
+       INT16_C(  3075), -INT16_C( 11429), -INT16_C( 16791), -INT16_C( 20157),  INT16_C( 16244),  INT16_C( 22690), -INT16_C( 11861),  INT16_C( 27644),
+       INT16_C( 10020), -INT16_C( 30927),  INT16_C( 21454), -INT16_C(  4489),  INT16_C( 11496),  INT16_C( 18272), -INT16_C(  7270), -INT16_C( 25224),
+      -INT16_C( 11281),  INT16_C( 22640), -INT16_C( 19311),  INT16_C(  1545), -INT16_C( 21261), -INT16_C( 24994),  INT16_C( 23165), -INT16_C( 24311),
+       INT16_C( 14978),  INT16_C( 20520), -INT16_C( 24690),  INT16_C( 30270), -INT16_C( 24885),  INT16_C( 26301),  INT16_C( 13697),  INT16_C( 28931),
+       INT16_C( 29705), -INT16_C( 25911), -INT16_C( 11480),  INT16_C(  7072), -INT16_C(   385), -INT16_C(   839), -INT16_C( 15527), -INT16_C(  9315),
+      -INT16_C( 14851), -INT16_C( 29909),  INT16_C( 26981),  INT16_C( 12289), -INT16_C( 16633), -INT16_C( 30314), -INT16_C( 25868), -INT16_C(   518),
+      -INT16_C( 15602),  INT16_C( 13976),  INT16_C( 14486),  INT16_C(  5457),  INT16_C(  2615), -INT16_C( 28655), -INT16_C( 20787), -INT16_C( 13461),
+      -INT16_C( 27020), -INT16_C(  9898),  INT16_C( 22783),  INT16_C(  1545), -INT16_C( 24553),  INT16_C(  2959) };
+  static const int16_t b[] =
+    { -INT16_C( 27933),  INT16_C( 31093), -INT16_C( 26478), -INT16_C( 15886), -INT16_C( 31845), -INT16_C(  7723), -INT16_C( 17946), -INT16_C( 16410),
+       INT16_C(  9299),  INT16_C( 27045), -INT16_C( 27644), -INT16_C( 30941), -INT16_C( 28884), -INT16_C( 24578), -INT16_C( 10529), -INT16_C( 15536),
+      -INT16_C( 15000), -INT16_C(  1476),  INT16_C( 11869), -INT16_C(  1860), -INT16_C( 28239), -INT16_C( 26663), -INT16_C( 16310), -INT16_C( 25257),
+      -INT16_C(   796), -INT16_C(  6138),  INT16_C( 10640), -INT16_C( 17296),  INT16_C( 28344), -INT16_C( 26533), -INT16_C( 21692), -INT16_C( 21413),
+      -INT16_C( 26767), -INT16_C( 12633),  INT16_C( 25542),  INT16_C( 30663), -INT16_C( 24332),  INT16_C( 15887),  INT16_C( 26208),  INT16_C( 17883),
+      -INT16_C(  7838), -INT16_C(  3283), -INT16_C( 25334), -INT16_C( 15441),  INT16_C(  2828),  INT16_C( 20571), -INT16_C( 18762),  INT16_C( 10237),
+      -INT16_C( 23475),  INT16_C(  5110), -INT16_C( 17145), -INT16_C(  1141), -INT16_C( 26019), -INT16_C( 16839),  INT16_C(  5120),  INT16_C( 25091),
+       INT16_C( 12533), -INT16_C(   171),  INT16_C(  1486), -INT16_C(  9534),  INT16_C(  7440), -INT16_C( 14806),  INT16_C( 10195),  INT16_C(  8686),
+      -INT16_C(  6965), -INT16_C( 11724), -INT16_C( 16479), -INT16_C(   307),  INT16_C(  1625),  INT16_C( 22972), -INT16_C( 16614),  INT16_C(  4028),
+       INT16_C(  4592), -INT16_C( 16881), -INT16_C( 12010),  INT16_C(  9880), -INT16_C( 15633), -INT16_C( 15635), -INT16_C(  9238), -INT16_C( 18973),
+       INT16_C(  6335),  INT16_C( 24712),  INT16_C( 21975),  INT16_C( 12638),  INT16_C(  7004),  INT16_C( 30346),  INT16_C( 18138), -INT16_C( 13690),
+      -INT16_C( 27304),  INT16_C( 28296),  INT16_C(  8294),  INT16_C( 21909), -INT16_C( 32029), -INT16_C( 13032), -INT16_C(  1187),  INT16_C(  7298),
+       INT16_C(  2579), -INT16_C(  5252), -INT16_C(  9632), -INT16_C( 17380), -INT16_C( 22795), -INT16_C( 12238), -INT16_C( 18195),  INT16_C( 17818),
+       INT16_C(  9037), -INT16_C( 19277),  INT16_C( 18499),  INT16_C(  9737),  INT16_C(  8650),  INT16_C( 10227),  INT16_C( 30237),  INT16_C( 12355),
+      -INT16_C( 16512), -INT16_C(  8165),  INT16_C( 14234), -INT16_C( 28772), -INT16_C( 12322), -INT16_C( 13473), -INT16_C(  1401), -INT16_C( 10992),
+      -INT16_C( 15587),  INT16_C( 24713), -INT16_C( 28148), -INT16_C( 10617),  INT16_C( 31412), -INT16_C( 11778),  INT16_C( 16880),  INT16_C( 28929),
+       INT16_C(  7425), -INT16_C( 25775), -INT16_C(  4524),  INT16_C( 12842), -INT16_C( 30019),  INT16_C( 17661),  INT16_C(  3460), -INT16_C( 24295),
+      -INT16_C( 23855), -INT16_C(  8959), -INT16_C( 30667), -INT16_C(  5709), -INT16_C( 20221), -INT16_C(  3142), -INT16_C( 17421), -INT16_C(  2972),
+      -INT16_C( 18728),  INT16_C( 11663), -INT16_C( 18012),  INT16_C( 24927),  INT16_C( 23875), -INT16_C( 14427), -INT16_C( 16534),  INT16_C( 15208),
+       INT16_C( 27233), -INT16_C( 27112), -INT16_C( 13070), -INT16_C(  2689),  INT16_C( 14717),  INT16_C( 28905),  INT16_C( 19957), -INT16_C( 12956),
+      -INT16_C(  3325), -INT16_C( 22534),  INT16_C( 23213), -INT16_C(  4088), -INT16_C( 20809),  INT16_C(  8632),  INT16_C(  8301), -INT16_C( 12707),
+       INT16_C( 30090),  INT16_C( 32101), -INT16_C(  7103), -INT16_C( 16526),  INT16_C( 23326),  INT16_C(  4911), -INT16_C( 27479), -INT16_C( 21280),
+      -INT16_C(  9337),  INT16_C( 13396),  INT16_C( 23605), -INT16_C(  5083), -INT16_C(  8950),  INT16_C( 30477),  INT16_C( 27389), -INT16_C( 30650),
+      -INT16_C( 21536),  INT16_C(  8453),  INT16_C( 30607), -INT16_C( 21024),  INT16_C(  4307),  INT16_C( 31936), -INT16_C( 24156),  INT16_C( 11048),
+       INT16_C( 31868), -INT16_C( 20128), -INT16_C( 31271), -INT16_C(  7267), -INT16_C( 21918),  INT16_C( 24411), -INT16_C( 24299), -INT16_C(  2585),
+      -INT16_C(  5044), -INT16_C(  9450), -INT16_C(  2204),  INT16_C( 14217),  INT16_C( 18695), -INT16_C( 21581), -INT16_C(  9238),  INT16_C( 26326),
+       INT16_C( 13912),  INT16_C( 12567), -INT16_C( 19269),  INT16_C(  7444),  INT16_C( 28511),  INT16_C( 29821),  INT16_C( 25616),  INT16_C( 23657),
+       INT16_C( 32593), -INT16_C( 19144), -INT16_C( 16010),  INT16_C( 32236), -INT16_C( 24822), -INT16_C(  2776), -INT16_C(   134), -INT16_C( 11685),
+       INT16_C( 29493), -INT16_C(  3837),  INT16_C(  6183), -INT16_C( 31218), -INT16_C( 29817), -INT16_C( 26374),  INT16_C( 25584),  INT16_C( 16884),
+       INT16_C( 11491),  INT16_C( 23030), -INT16_C(  7443), -INT16_C(  1833), -INT16_C(   127), -INT16_C(  1043),  INT16_C( 18686),  INT16_C( 13518),
+      -INT16_C( 11845), -INT16_C(  7387),  INT16_C( 13289),  INT16_C( 29033),  INT16_C( 25791), -INT16_C( 20727), -INT16_C(   569), -INT16_C( 21776),
+      -INT16_C(  6614),  INT16_C(  5892), -INT16_C(  9272),  INT16_C( 18703), -INT16_C(   806), -INT16_C(  9916),  INT16_C(  4677),  INT16_C(    13),
+       INT16_C( 13028), -INT16_C( 12829),  INT16_C( 19813),  INT16_C(  9278),  INT16_C( 18353),  INT16_C( 30931), -INT16_C( 15547),  INT16_C( 28451),
+       INT16_C( 10153),  INT16_C( 29062), -INT16_C( 27134), -INT16_C(  9030), -INT16_C(   110), -INT16_C( 10315), -INT16_C( 15855), -INT16_C(  2600),
+      -INT16_C( 17420),  INT16_C( 23235),  INT16_C(   264), -INT16_C( 18050),  INT16_C( 21065), -INT16_C( 29134),  INT16_C( 21781), -INT16_C( 16387),
+      -INT16_C( 31876),  INT16_C( 32304), -INT16_C(  5351), -INT16_C( 21414),  INT16_C(  4330), -INT16_C(  1149),  INT16_C( 23506), -INT16_C( 14351),
+      -INT16_C( 19433),  INT16_C(  7969), -INT16_C( 24651), -INT16_C(   295),  INT16_C(  3057),  INT16_C(  1932), -INT16_C( 30368), -INT16_C(  9018),
+      -INT16_C(  2547),  INT16_C(  9818), -INT16_C( 19231), -INT16_C( 13358),  INT16_C( 22212), -INT16_C( 26681), -INT16_C( 18255), -INT16_C( 14242),
+       INT16_C( 32620),  INT16_C(  8680), -INT16_C( 16098),  INT16_C(  4128), -INT16_C( 21300),  INT16_C( 11287), -INT16_C(  8906),  INT16_C( 17160),
+       INT16_C( 25299), -INT16_C( 19095),  INT16_C( 15382), -INT16_C(  9344),  INT16_C( 18322),  INT16_C( 17266), -INT16_C( 12033),  INT16_C( 27404),
+      -INT16_C(  2993),  INT16_C( 28045), -INT16_C( 21067), -INT16_C( 32387), -INT16_C( 27559), -INT16_C( 28755) };
+  static const int16_t c[] =
+    {  INT16_C( 12144),  INT16_C( 13065),  INT16_C( 27565), -INT16_C( 14524),  INT16_C( 27552),  INT16_C( 32014),  INT16_C( 31897),  INT16_C( 14455),
+       INT16_C(  4020),  INT16_C( 28205), -INT16_C( 28273), -INT16_C( 14687),  INT16_C( 12552),  INT16_C(  6138),  INT16_C( 10438),  INT16_C( 13880),
+       INT16_C( 16983),  INT16_C(  1386), -INT16_C( 20819),  INT16_C( 20172), -INT16_C(  9702), -INT16_C( 19509),  INT16_C( 16982),  INT16_C(  3051),
+       INT16_C(  6481), -INT16_C(  7815),  INT16_C(  7082), -INT16_C( 19801), -INT16_C( 24244),  INT16_C(  4810),  INT16_C(   714),  INT16_C(  8520),
+      -INT16_C( 19900), -INT16_C(  3546), -INT16_C(  3487),  INT16_C( 31552),  INT16_C(  3021),  INT16_C(  9006),  INT16_C(  6477), -INT16_C( 24786),
+      -INT16_C( 22478), -INT16_C(  9088),  INT16_C( 10179),  INT16_C(  3983),  INT16_C( 22985), -INT16_C( 27871),  INT16_C( 26971), -INT16_C( 24396),
+      -INT16_C(  9444),  INT16_C( 32146), -INT16_C( 11571), -INT16_C( 25864),  INT16_C(  9949),  INT16_C( 10942), -INT16_C(  5057),  INT16_C( 29385),
+       INT16_C( 18836),  INT16_C( 22350), -INT16_C(  8847),  INT16_C( 14950), -INT16_C( 30922), -INT16_C( 27955), -INT16_C( 32271),  INT16_C(  3378),
+      -INT16_C( 15268),  INT16_C( 10890), -INT16_C( 32106),  INT16_C( 29636), -INT16_C( 32088), -INT16_C(  6243),  INT16_C( 26479),  INT16_C(   857),
+      -INT16_C( 22352),  INT16_C(  8539), -INT16_C( 15995), -INT16_C( 17317),  INT16_C( 10313),  INT16_C( 14926), -INT16_C( 32598),  INT16_C(  1607),
+      -INT16_C( 11964), -INT16_C(  9680), -INT16_C(  2733), -INT16_C(  1203), -INT16_C(  5513), -INT16_C(  6430),  INT16_C( 15441),  INT16_C(   746),
+       INT16_C( 17892),  INT16_C( 26915),  INT16_C( 32518),  INT16_C( 20261),  INT16_C( 29607),  INT16_C( 20873), -INT16_C( 12045),  INT16_C( 14168),
+      -INT16_C( 30559), -INT16_C(  3055),  INT16_C( 24189), -INT16_C(  2577), -INT16_C( 11703), -INT16_C( 25893), -INT16_C( 15090), -INT16_C(  3428),
+      -INT16_C( 16374),  INT16_C(  4443), -INT16_C( 32449), -INT16_C(  6560), -INT16_C(  5388), -INT16_C(  6088), -INT16_C( 28486),  INT16_C( 23583),
+       INT16_C( 12568), -INT16_C( 27056),  INT16_C( 16527), -INT16_C( 10101),  INT16_C( 26130),  INT16_C(  8307),  INT16_C(  3884),  INT16_C( 13842),
+       INT16_C( 28111),  INT16_C(  3655), -INT16_C( 22290), -INT16_C(  7179),  INT16_C( 11666),  INT16_C( 19659), -INT16_C(  5443), -INT16_C( 10840),
+      -INT16_C(  1765), -INT16_C( 21653), -INT16_C(  2503),  INT16_C( 19331), -INT16_C(  2467), -INT16_C( 30357),  INT16_C( 32006), -INT16_C( 10817),
+       INT16_C(  2026), -INT16_C(  9756), -INT16_C(  9809),  INT16_C( 16828), -INT16_C( 30970), -INT16_C( 15475),  INT16_C( 13937), -INT16_C( 29288),
+       INT16_C(  1071),  INT16_C( 26680), -INT16_C( 17414),  INT16_C( 22451),  INT16_C(  7858), -INT16_C( 18208), -INT16_C( 24421), -INT16_C( 31347),
+       INT16_C( 29095),  INT16_C( 22110),  INT16_C(  6730),  INT16_C( 20631),  INT16_C(  9377),  INT16_C(  4883), -INT16_C( 21414), -INT16_C( 30304),
+      -INT16_C( 10064), -INT16_C( 21775), -INT16_C( 23405),  INT16_C( 17666), -INT16_C(  7486),  INT16_C( 24061), -INT16_C( 29822),  INT16_C( 10723),
+       INT16_C( 16892),  INT16_C( 18303),  INT16_C(  5724), -INT16_C(   617), -INT16_C( 21701), -INT16_C( 27376), -INT16_C( 20393),  INT16_C(  1823),
+       INT16_C(  4232),  INT16_C(  7345), -INT16_C( 19531),  INT16_C( 30561),  INT16_C( 24470),  INT16_C(  6357), -INT16_C( 18198), -INT16_C(  6590),
+      -INT16_C( 15879),  INT16_C( 21805), -INT16_C( 14888),  INT16_C(  4947),  INT16_C( 25456), -INT16_C( 14424), -INT16_C( 14572), -INT16_C( 25394),
+       INT16_C( 32728), -INT16_C( 29256),  INT16_C(  6707), -INT16_C( 14076), -INT16_C(  9863),  INT16_C( 25569),  INT16_C(  9105), -INT16_C( 29879),
+       INT16_C( 30693), -INT16_C( 16928),  INT16_C( 13116), -INT16_C( 21296),  INT16_C( 30871), -INT16_C( 21645),  INT16_C( 16704),  INT16_C(  6215),
+       INT16_C(   192), -INT16_C(  3163), -INT16_C( 22246), -INT16_C( 27716), -INT16_C( 24957),  INT16_C(  5366),  INT16_C( 16321), -INT16_C( 22881),
+      -INT16_C( 32586), -INT16_C(  3485),  INT16_C( 13235),  INT16_C( 19102),  INT16_C(  4524), -INT16_C(  4875),  INT16_C( 15698),  INT16_C(  4868),
+      -INT16_C( 22211),  INT16_C( 22278), -INT16_C( 15534), -INT16_C( 10774), -INT16_C(  8095),  INT16_C(  8938), -INT16_C( 30433), -INT16_C( 10551),
+       INT16_C( 11273), -INT16_C( 16952),  INT16_C( 26464),  INT16_C(  3079), -INT16_C(   648), -INT16_C( 13320), -INT16_C(   966),  INT16_C( 30686),
+      -INT16_C(  7003), -INT16_C(  2098), -INT16_C( 18265),  INT16_C(  2253), -INT16_C( 18536), -INT16_C( 18645), -INT16_C(  3008),  INT16_C( 19085),
+       INT16_C( 22048), -INT16_C( 32761),  INT16_C(  3773),  INT16_C( 13708), -INT16_C( 31733),  INT16_C( 17664), -INT16_C(  8576),  INT16_C(  9660),
+      -INT16_C( 30013),  INT16_C( 27165), -INT16_C(  5566), -INT16_C(  9613), -INT16_C( 24927), -INT16_C(  7790),  INT16_C(  8082), -INT16_C( 19925),
+       INT16_C( 12917),  INT16_C( 12851), -INT16_C( 16575),  INT16_C( 19560),  INT16_C( 26692), -INT16_C( 15214),  INT16_C( 20039),  INT16_C(  2794),
+       INT16_C(  2009),  INT16_C(  7028), -INT16_C(  6159), -INT16_C( 27914), -INT16_C( 30587),  INT16_C(  6003), -INT16_C( 24665),  INT16_C(  7626),
+      -INT16_C(   559),  INT16_C(  4687), -INT16_C( 18500),  INT16_C(    95), -INT16_C(  3808),  INT16_C( 26565), -INT16_C( 20673),  INT16_C(  6257),
+      -INT16_C(  6730), -INT16_C( 22732),  INT16_C( 10957),  INT16_C( 21049), -INT16_C( 21326),  INT16_C( 22890),  INT16_C( 13387),  INT16_C(  7542),
+      -INT16_C( 14799), -INT16_C(  4817), -INT16_C( 29059), -INT16_C( 25106), -INT16_C( 19585), -INT16_C( 16636),  INT16_C( 30050),  INT16_C(  6359),
+       INT16_C(  2907),  INT16_C( 10431), -INT16_C(  1995), -INT16_C(  6278), -INT16_C(  7004), -INT16_C(  4031), -INT16_C( 18664),  INT16_C( 18701),
+       INT16_C( 15485), -INT16_C(  1225),  INT16_C(  9675),  INT16_C( 19096), -INT16_C( 25128),  INT16_C( 14857), -INT16_C(  7918),  INT16_C( 27986),
+       INT16_C(  4588),  INT16_C(  8853),  INT16_C(  4105), -INT16_C( 21239),  INT16_C( 19188),  INT16_C(  3485) };
+  static const int16_t e[] =
+    {  INT16_C(  4357),  INT16_C( 27214),  INT16_C( 25764), -INT16_C( 32468),  INT16_C(  7898),  INT16_C( 20604),  INT16_C( 22674),  INT16_C( 11847),
+      -INT16_C(  5391), -INT16_C(  4179),  INT16_C( 11055),  INT16_C( 26051), -INT16_C( 27104),  INT16_C(  9109),  INT16_C( 30059), -INT16_C( 31464),
+       INT16_C( 17580), -INT16_C( 26506), -INT16_C( 18008), -INT16_C(  2350),  INT16_C( 20007), -INT16_C( 18106), -INT16_C(  5988),  INT16_C( 23086),
+      -INT16_C( 13907),  INT16_C( 14233),  INT16_C(  3859),  INT16_C(  9566), -INT16_C(  3218), -INT16_C( 10307), -INT16_C(  3814),  INT16_C(   139),
+       INT16_C( 24712),  INT16_C( 11344),  INT16_C(  5837), -INT16_C(  1757),  INT16_C( 26993), -INT16_C(  4181),  INT16_C(  6221), -INT16_C(  2066),
+      -INT16_C( 30947), -INT16_C(  3645), -INT16_C( 21089), -INT16_C( 15190), -INT16_C( 24959), -INT16_C( 32544), -INT16_C(  1826), -INT16_C( 16331),
+       INT16_C(  9489), -INT16_C( 19962), -INT16_C( 11323), -INT16_C( 17956),  INT16_C( 25004),  INT16_C( 17361), -INT16_C( 16585),  INT16_C(  1402),
+       INT16_C( 27206),  INT16_C(  2850), -INT16_C(  9481),  INT16_C( 30944),  INT16_C( 19832),  INT16_C( 18799),  INT16_C( 17360),  INT16_C( 22200),
+       INT16_C( 27252), -INT16_C( 28615),  INT16_C(  5880),  INT16_C(  4937),  INT16_C(  6821), -INT16_C(  8873),  INT16_C( 14457), -INT16_C( 13739),
+      -INT16_C( 18692), -INT16_C( 18672),  INT16_C( 12261), -INT16_C( 15237), -INT16_C( 18136),  INT16_C( 27999),  INT16_C(  6108),  INT16_C( 13331),
+      -INT16_C( 21914),  INT16_C( 22452), -INT16_C(   749),  INT16_C( 23097), -INT16_C( 16105), -INT16_C( 17474), -INT16_C( 21761),  INT16_C( 20239),
+      -INT16_C( 24100),  INT16_C( 16059),  INT16_C( 13380),  INT16_C(  3350),  INT16_C( 24287),  INT16_C( 28409),  INT16_C( 16012), -INT16_C(  5272),
+      -INT16_C(  1771),  INT16_C( 20290), -INT16_C( 21479),  INT16_C( 12296), -INT16_C( 14961), -INT16_C( 16096),  INT16_C( 12134), -INT16_C(  7407),
+       INT16_C( 21561),  INT16_C( 10206),  INT16_C(  1795),  INT16_C(  3299),  INT16_C( 17612),  INT16_C(  2224),  INT16_C( 31374),  INT16_C(  8435),
+       INT16_C( 13621),  INT16_C( 20080),  INT16_C( 30946), -INT16_C( 10513), -INT16_C( 24809),  INT16_C( 32017), -INT16_C( 28587),  INT16_C(  2144),
+       INT16_C( 20854),  INT16_C( 31015), -INT16_C( 19186), -INT16_C( 26952), -INT16_C( 27144), -INT16_C(  9455),  INT16_C( 31213),  INT16_C( 26021),
+       INT16_C(  5153), -INT16_C( 12820), -INT16_C( 20250), -INT16_C( 14669), -INT16_C( 21584),  INT16_C(  7802), -INT16_C(  9620), -INT16_C(  7641),
+      -INT16_C( 20010), -INT16_C( 13760),  INT16_C( 16800),  INT16_C( 31735),  INT16_C( 14038),  INT16_C( 18761), -INT16_C( 14557),  INT16_C(  3174),
+       INT16_C(  8199), -INT16_C( 14348),  INT16_C( 11335), -INT16_C( 26940),  INT16_C( 15990), -INT16_C(  7499), -INT16_C(  9192), -INT16_C( 24275),
+       INT16_C(  8234),  INT16_C(  7990),  INT16_C(  8801), -INT16_C( 30284), -INT16_C(  9896),  INT16_C(  6982), -INT16_C( 19445),  INT16_C( 11883),
+      -INT16_C( 24616),  INT16_C( 29491),  INT16_C( 16431),  INT16_C(  2474),  INT16_C( 23379),  INT16_C( 11741), -INT16_C( 22490),  INT16_C( 20564),
+       INT16_C( 11606),  INT16_C(  4902),  INT16_C( 32319), -INT16_C( 31429),  INT16_C(  7512), -INT16_C( 23051),  INT16_C(  4421), -INT16_C( 15425),
+      -INT16_C( 14144),  INT16_C( 19701), -INT16_C( 30079), -INT16_C( 15705),  INT16_C( 15592), -INT16_C(  1145), -INT16_C(  9254), -INT16_C(  4854),
+       INT16_C( 26616),  INT16_C( 14286),  INT16_C( 12517),  INT16_C( 23955), -INT16_C( 15283), -INT16_C( 29726), -INT16_C( 19164), -INT16_C(  7039),
+       INT16_C( 30333),  INT16_C(  4024), -INT16_C(  6093),  INT16_C( 21602), -INT16_C(   336), -INT16_C( 29743),  INT16_C(  3934),  INT16_C( 14539),
+      -INT16_C(   892),  INT16_C( 26889), -INT16_C( 10196),  INT16_C( 31143), -INT16_C( 30308), -INT16_C( 16380), -INT16_C(  3626), -INT16_C( 17243),
+      -INT16_C( 10757), -INT16_C(   837),  INT16_C( 12628),  INT16_C(  1233),  INT16_C( 12020),  INT16_C(  2447), -INT16_C( 16705),  INT16_C( 12146),
+       INT16_C(  9616), -INT16_C(  6227), -INT16_C(   421),  INT16_C( 22624),  INT16_C( 26077),  INT16_C( 15837),  INT16_C( 20182),  INT16_C(  9255),
+      -INT16_C( 27501), -INT16_C(  6174), -INT16_C( 25003), -INT16_C(  2580), -INT16_C( 25413),  INT16_C( 27894), -INT16_C(  9927),  INT16_C( 21661),
+      -INT16_C( 24160), -INT16_C(  4294), -INT16_C( 12878),  INT16_C( 23909), -INT16_C(  5216), -INT16_C( 29868),  INT16_C( 11689),  INT16_C( 15729),
+      -INT16_C( 23648), -INT16_C( 31196), -INT16_C( 32739),  INT16_C( 23675),  INT16_C( 31116), -INT16_C( 27091),  INT16_C(  2814),  INT16_C(  4281),
+      -INT16_C( 27439),  INT16_C( 11146),  INT16_C( 23760), -INT16_C( 17078), -INT16_C( 18872), -INT16_C(  3589),  INT16_C( 27875),  INT16_C( 31762),
+       INT16_C( 28383), -INT16_C( 14805), -INT16_C( 22941), -INT16_C(  4318), -INT16_C( 27616),  INT16_C( 29365),  INT16_C( 28255),  INT16_C( 12418),
+      -INT16_C( 27280), -INT16_C( 11429), -INT16_C( 16791), -INT16_C( 20157),  INT16_C( 16244),  INT16_C( 22690), -INT16_C( 11861),  INT16_C( 21386),
+      -INT16_C( 24023),  INT16_C( 20423),  INT16_C( 21601), -INT16_C(  4489),  INT16_C( 11496),  INT16_C( 18272),  INT16_C( 27977), -INT16_C( 25224),
+      -INT16_C( 11281),  INT16_C( 22640),  INT16_C( 29925),  INT16_C(  1545), -INT16_C( 21261), -INT16_C( 25633),  INT16_C( 23165), -INT16_C( 20246),
+      -INT16_C( 28828), -INT16_C( 11172), -INT16_C( 24690),  INT16_C( 30270), -INT16_C(  7475),  INT16_C( 26301),  INT16_C( 13697),  INT16_C(  6600),
+       INT16_C( 20646), -INT16_C( 25911), -INT16_C( 11480),  INT16_C(  7072),  INT16_C( 14011), -INT16_C(   839),  INT16_C( 32235), -INT16_C(  9315),
+      -INT16_C( 14851), -INT16_C( 11593),  INT16_C( 26981),  INT16_C( 12289), -INT16_C( 16633), -INT16_C( 30314),  INT16_C(  2704), -INT16_C( 22819),
+       INT16_C( 23815), -INT16_C( 10353),  INT16_C( 10927),  INT16_C( 15896), -INT16_C( 19914), -INT16_C( 28655), -INT16_C( 20787), -INT16_C( 20650),
+       INT16_C(  4024),  INT16_C( 29939),  INT16_C( 22783),  INT16_C(  1545), -INT16_C( 24553), -INT16_C( 16832) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i])),
+      cv = simde_svld1_s16(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmad_s16_m(pv, av, bv, cv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], c[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+    cv = simde_svld1_s16(pg, &(c[i]));
+
+    ev = simde_svmad_s16_m(pv, av, bv, cv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) };
+  static const int32_t a[] =
+    { -INT32_C(  1847475019),  INT32_C(  1465992262), -INT32_C(   861445219),  INT32_C(  1096536596),  INT32_C(   284308531),  INT32_C(    34617455),  INT32_C(   233884038), -INT32_C(    68922299),
+       INT32_C(  1603061016), -INT32_C(  1481183990),  INT32_C(  1702059601),  INT32_C(  1688653360),  INT32_C(  1903466754),  INT32_C(  1467253969), -INT32_C(  1822137266), -INT32_C(   779204424),
+       INT32_C(   389028621),  INT32_C(  1505682952),  INT32_C(  1975464260),  INT32_C(    31024639), -INT32_C(   814526978),  INT32_C(   539420626),  INT32_C(    78875211), -INT32_C(   522894638),
+       INT32_C(  1710687581),  INT32_C(   817870571), -INT32_C(   408584473), -INT32_C(   488079645), -INT32_C(  1649321013), -INT32_C(  1900160958),  INT32_C(   898789730),  INT32_C(   269838259),
+       INT32_C(  1467288684), -INT32_C(  1433979710), -INT32_C(  1768870734),  INT32_C(  1987606954),  INT32_C(   387131861),  INT32_C(  1688588545), -INT32_C(   174508222),  INT32_C(   168144542),
+       INT32_C(  2103605946),  INT32_C(  1630005679), -INT32_C(  1057507306),  INT32_C(   104230705), -INT32_C(  1709290855),  INT32_C(  1576977179), -INT32_C(  1722640389),  INT32_C(    10770245),
+      -INT32_C(  2139289903),  INT32_C(    98739439), -INT32_C(  1916348068), -INT32_C(   493552567),  INT32_C(  1635562054),  INT32_C(  1891531637),  INT32_C(  1477054482),  INT32_C(   962113127),
+      -INT32_C(  1548102220), -INT32_C(   710304903), -INT32_C(  1100845195), -INT32_C(  1298074005),  INT32_C(   504569000), -INT32_C(  1433480553),  INT32_C(  1241684194), -INT32_C(    92054970),
+      -INT32_C(  1466024913),  INT32_C(  1300056024),  INT32_C(   554426294),  INT32_C(  2127801302),  INT32_C(  1604118471), -INT32_C(  1693897799),  INT32_C(   182782915), -INT32_C(  1811650459),
+       INT32_C(  2101125797), -INT32_C(  1614104087),  INT32_C(  1858196888),  INT32_C(  1206752384),  INT32_C(   883329403),  INT32_C(  2026942388),  INT32_C(   528659898), -INT32_C(  1011644898),
+       INT32_C(   306245417),  INT32_C(  1102187176),  INT32_C(  1605333983), -INT32_C(  2086233081), -INT32_C(   625521370), -INT32_C(  1219328004),  INT32_C(  1540805693), -INT32_C(  2078373285),
+       INT32_C(   580279929),  INT32_C(  1197688936), -INT32_C(  1012526405), -INT32_C(   716813137), -INT32_C(  1766851175), -INT32_C(  1035140475),  INT32_C(   823993302),  INT32_C(   666188717),
+       INT32_C(    21580953),  INT32_C(  1346940052),  INT32_C(  1830022846), -INT32_C(   733849286), -INT32_C(   613748138), -INT32_C(   895633420), -INT32_C(  1996703014), -INT32_C(  1901088267),
+      -INT32_C(  1836058371),  INT32_C(  1659033508),  INT32_C(    13694405), -INT32_C(  1529605554), -INT32_C(   125813244), -INT32_C(   809296395), -INT32_C(   849887272),  INT32_C(  1851524720),
+      -INT32_C(  1576997890), -INT32_C(  2012880189),  INT32_C(   629724631), -INT32_C(   322347801), -INT32_C(  1880864358),  INT32_C(  1063233383), -INT32_C(   687032730), -INT32_C(  1153079107),
+       INT32_C(   392054100), -INT32_C(    23108825),  INT32_C(   522397752),  INT32_C(   520875140), -INT32_C(  1649479626), -INT32_C(    19133033), -INT32_C(  2116687676), -INT32_C(  1522787759),
+      -INT32_C(  2034460065),  INT32_C(   897866749),  INT32_C(   139831171), -INT32_C(   920166253), -INT32_C(   395913904), -INT32_C(  1478081821),  INT32_C(  2083044139),  INT32_C(   874603733),
+      -INT32_C(    54862337), -INT32_C(  1137557960),  INT32_C(  2026145765),  INT32_C(   943909863) };
+  static const int32_t b[] =
+    { -INT32_C(   677385265), -INT32_C(   273419200), -INT32_C(  1711504322),  INT32_C(   347138332),  INT32_C(  1865670152),  INT32_C(  1101157773), -INT32_C(  2099893281),  INT32_C(  2037040554),
+      -INT32_C(   263189840),  INT32_C(  1021314046), -INT32_C(  1529488249), -INT32_C(   843544891), -INT32_C(   247600028),  INT32_C(   540204865), -INT32_C(  1247672310),  INT32_C(  2116947406),
+       INT32_C(   359628567),  INT32_C(   173166466), -INT32_C(   257022165),  INT32_C(   297690797), -INT32_C(  1828455598), -INT32_C(   457951782),  INT32_C(   211375678),  INT32_C(  2055915619),
+      -INT32_C(   913245881),  INT32_C(  1943265864), -INT32_C(  1218150135),  INT32_C(   986194664), -INT32_C(   137442531),  INT32_C(  1071350273),  INT32_C(  1011578328), -INT32_C(  2068392643),
+       INT32_C(   390940367),  INT32_C(   847978792), -INT32_C(  1964380254),  INT32_C(   784707857),  INT32_C(  2116391805), -INT32_C(   306380779), -INT32_C(  1305933707), -INT32_C(  1405689635),
+       INT32_C(  1338278950),  INT32_C(  1199656869),  INT32_C(  1339189822), -INT32_C(  1736599781),  INT32_C(  1058447914),  INT32_C(   405590946), -INT32_C(  1177921829),  INT32_C(  1550123318),
+       INT32_C(   715860357), -INT32_C(  1234097032), -INT32_C(  1308277866),  INT32_C(    71992026), -INT32_C(   951885532),  INT32_C(   283078708), -INT32_C(    53892666),  INT32_C(   794308266),
+      -INT32_C(   799472552), -INT32_C(   947401936), -INT32_C(   377910258),  INT32_C(   871219983),  INT32_C(  1509568804),  INT32_C(  1734990241),  INT32_C(   761475715), -INT32_C(  1201816736),
+      -INT32_C(   259410241), -INT32_C(  1867050879), -INT32_C(  1418121060),  INT32_C(   417294067),  INT32_C(   946985367),  INT32_C(   916445875),  INT32_C(  1818427916),  INT32_C(  2099626174),
+      -INT32_C(   127029641),  INT32_C(  1518871742),  INT32_C(  1208353108), -INT32_C(    10427032),  INT32_C(  1899549118), -INT32_C(  1213737045), -INT32_C(  1742533670),  INT32_C(  1108691147),
+      -INT32_C(  1271168010), -INT32_C(    66075737),  INT32_C(   759436741), -INT32_C(  1205033734),  INT32_C(   539649141),  INT32_C(   383242556), -INT32_C(  1464927524),  INT32_C(   971686723),
+      -INT32_C(   286382778), -INT32_C(  1360331287),  INT32_C(   215690770),  INT32_C(  1204029394), -INT32_C(  1469583764), -INT32_C(  1665253696),  INT32_C(  2068081720),  INT32_C(  1991585583),
+       INT32_C(  1030005588), -INT32_C(  1293201760),  INT32_C(  1321125500),  INT32_C(   982876878),  INT32_C(   836959345),  INT32_C(  1926078522),  INT32_C(  1005457932), -INT32_C(  1783520447),
+      -INT32_C(   422374074), -INT32_C(   543637917),  INT32_C(  1395480197),  INT32_C(  1234027224), -INT32_C(   126193730),  INT32_C(   460015631), -INT32_C(  1688839846),  INT32_C(  1110444284),
+      -INT32_C(  2128084195),  INT32_C(  1197523138), -INT32_C(   291860970),  INT32_C(   255338320), -INT32_C(  1526222186),  INT32_C(  1421898490), -INT32_C(   940632373),  INT32_C(  1007231006),
+      -INT32_C(   440585949),  INT32_C(   120331761), -INT32_C(    50936149), -INT32_C(  2096419091), -INT32_C(   618130720),  INT32_C(  1345316997),  INT32_C(   488120319),  INT32_C(  1650008383),
+       INT32_C(  1145574995), -INT32_C(   548637644),  INT32_C(   685457979),  INT32_C(  1353508464),  INT32_C(  2116801785), -INT32_C(  1127326787), -INT32_C(  1176902022),  INT32_C(  1528509192),
+       INT32_C(  2107597641),  INT32_C(   324922328), -INT32_C(  1657063379),  INT32_C(   418309919) };
+  static const int32_t c[] =
+    { -INT32_C(  1763009623),  INT32_C(  1645706201),  INT32_C(  2061429959),  INT32_C(  1002950778), -INT32_C(  1727111226), -INT32_C(  1644703569), -INT32_C(  1258233613), -INT32_C(   295681979),
+      -INT32_C(  1249621285), -INT32_C(  1927832635),  INT32_C(    17299079), -INT32_C(  1942106426), -INT32_C(   584758482),  INT32_C(   259661083),  INT32_C(  1120173053), -INT32_C(  1758387013),
+       INT32_C(   877442414), -INT32_C(   658414767),  INT32_C(   551209049), -INT32_C(   978577513),  INT32_C(  2124599906), -INT32_C(   326296081),  INT32_C(  1395610008), -INT32_C(   454401930),
+       INT32_C(  1712862741), -INT32_C(   213919334),  INT32_C(   957553058), -INT32_C(  1828798416), -INT32_C(  2129616750),  INT32_C(  1433247165),  INT32_C(  1705614575),  INT32_C(   306811900),
+       INT32_C(  1685611210), -INT32_C(   581454021),  INT32_C(     1469392), -INT32_C(  1114434517),  INT32_C(  1916707765),  INT32_C(   818457409),  INT32_C(  1150644552), -INT32_C(   833167868),
+       INT32_C(  2083704640),  INT32_C(  1465485958),  INT32_C(   542601461),  INT32_C(   970844804), -INT32_C(   810804338),  INT32_C(   251622598), -INT32_C(   380398363), -INT32_C(  1279743630),
+      -INT32_C(    13637000),  INT32_C(  1767278708),  INT32_C(  2106174968),  INT32_C(   649488024),  INT32_C(  1224041089), -INT32_C(  1151929130), -INT32_C(    89806456), -INT32_C(   877830829),
+      -INT32_C(  1127556025),  INT32_C(  1562714213),  INT32_C(  1725607886), -INT32_C(  1752395499), -INT32_C(   891321869), -INT32_C(    41601675),  INT32_C(   855059167), -INT32_C(   805460601),
+      -INT32_C(   427046783), -INT32_C(  1237012248),  INT32_C(  1964777055), -INT32_C(  1559451473), -INT32_C(  1636963543), -INT32_C(     6557152), -INT32_C(  1540254947), -INT32_C(  1183633608),
+      -INT32_C(   543097097),  INT32_C(   244769967), -INT32_C(  1299992062), -INT32_C(  2074767525), -INT32_C(  1692155270), -INT32_C(   778387788), -INT32_C(  1988703151), -INT32_C(   230430213),
+      -INT32_C(  1747852312), -INT32_C(   911906873),  INT32_C(  1971005722),  INT32_C(   872009912),  INT32_C(  1204690066),  INT32_C(   739797211),  INT32_C(   800493108),  INT32_C(  1612839288),
+      -INT32_C(  1544031268),  INT32_C(  1953274970),  INT32_C(  2129258693),  INT32_C(  1269949368), -INT32_C(   627933185),  INT32_C(   470264551), -INT32_C(  1320436423), -INT32_C(  1844351562),
+      -INT32_C(  1170929568),  INT32_C(  1781506468),  INT32_C(  1122506889), -INT32_C(    74606085), -INT32_C(     2810088),  INT32_C(    35380425),  INT32_C(  1337157529),  INT32_C(   887211220),
+       INT32_C(  1911428812),  INT32_C(  1104879032),  INT32_C(   830718774),  INT32_C(  1949044828), -INT32_C(   109903313),  INT32_C(  2029752286), -INT32_C(   892882954),  INT32_C(  1090431347),
+       INT32_C(  2008149183),  INT32_C(  1085901834), -INT32_C(  1418642353),  INT32_C(  2082446925),  INT32_C(  2121634464),  INT32_C(   402026785), -INT32_C(  1813922272),  INT32_C(   651419495),
+      -INT32_C(   694254388),  INT32_C(  1595299600), -INT32_C(   536180845), -INT32_C(   983750363), -INT32_C(   582692164),  INT32_C(  1677015619),  INT32_C(  1610077944), -INT32_C(  2105095498),
+       INT32_C(  1599611983),  INT32_C(   247426683),  INT32_C(   468699637), -INT32_C(  1344254733),  INT32_C(  1653351454),  INT32_C(  1472561503),  INT32_C(   246922328), -INT32_C(   695190137),
+      -INT32_C(   600446879),  INT32_C(  1273689174), -INT32_C(  1318659650),  INT32_C(  1147160357) };
+  static const int32_t e[] =
+    { -INT32_C(    76164860),  INT32_C(           0),  INT32_C(           0), -INT32_C(   238616918), -INT32_C(  1391641762),  INT32_C(           0), -INT32_C(   845287763),  INT32_C(  1785417495),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   217605706),  INT32_C(           0), -INT32_C(   728505044), -INT32_C(   953231607),  INT32_C(           0),
+      -INT32_C(   223504743),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1023158338),  INT32_C(  1666515139),  INT32_C(           0), -INT32_C(  1932834900),
+       INT32_C(           0),  INT32_C(  1029161394),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1135870063),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1142081373),
+      -INT32_C(  1912670690),  INT32_C(  2040199051),  INT32_C(           0),  INT32_C(   327398005),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1801247850),
+       INT32_C(  1015082716),  INT32_C(           0),  INT32_C(   983245385),  INT32_C(           0),  INT32_C(  1409231528), -INT32_C(  1784009508),  INT32_C(   555215518),  INT32_C(           0),
+      -INT32_C(  1646858739), -INT32_C(   680792964), -INT32_C(   776200736),  INT32_C(           0),  INT32_C(           0), -INT32_C(   755615590),  INT32_C(   220985716),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(   150324715),  INT32_C(           0),  INT32_C(           0),  INT32_C(   303804819),  INT32_C(           0),  INT32_C(  1837992581),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(   558928199),  INT32_C(   467273937),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1251830318),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(  1920770078),  INT32_C(  1924162395),  INT32_C(    48445124),  INT32_C(   318523376),  INT32_C(  1157794485),  INT32_C(  1540207557),
+       INT32_C(  1326231630),  INT32_C(           0),  INT32_C(  1983684277),  INT32_C(  1507240846),  INT32_C(           0),  INT32_C(  1629029355),  INT32_C(   823035040), -INT32_C(   240025527),
+       INT32_C(   658195954),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1729873063),  INT32_C(           0),  INT32_C(   295511417),
+       INT32_C(   852202900),  INT32_C(   269260324),  INT32_C(           0), -INT32_C(  1929192793),  INT32_C(           0),  INT32_C(  1932790289),  INT32_C(  1968930257), -INT32_C(   248384759),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(   482041713),  INT32_C(           0),  INT32_C(  1902953767), -INT32_C(   499238599), -INT32_C(  1209845274),  INT32_C(           0),
+      -INT32_C(  1304386939), -INT32_C(   580803632),  INT32_C(           0),  INT32_C(           0), -INT32_C(   828651812), -INT32_C(   315897417), -INT32_C(   975362814),  INT32_C(           0),
+       INT32_C(  1724584776),  INT32_C(           0), -INT32_C(  1552829189),  INT32_C(  1569904473), -INT32_C(   576008708),  INT32_C(           0), -INT32_C(  1583714764),  INT32_C(   333362597),
+       INT32_C(           0), -INT32_C(  1720925729),  INT32_C(           0), -INT32_C(   459104445),  INT32_C(           0), -INT32_C(  1388997642), -INT32_C(  1933799210),  INT32_C(  2015941423),
+       INT32_C(           0), -INT32_C(   138093674),  INT32_C(           0),  INT32_C(           0) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i])),
+      cv = simde_svld1_s32(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmad_s32_z(pv, av, bv, cv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], c[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+    cv = simde_svld1_s32(pg, &(c[i]));
+
+    ev = simde_svmad_s32_z(pv, av, bv, cv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) };
+  static const int32_t a[] =
+    {  INT32_C(   616525245),  INT32_C(  1039047870), -INT32_C(   129061098), -INT32_C(   394408424),  INT32_C(   574663762),  INT32_C(  1930326348), -INT32_C(   797841216),  INT32_C(  2089610943),
+       INT32_C(   446778203), -INT32_C(    44593177),  INT32_C(  1458939198), -INT32_C(   985763213),  INT32_C(  1810333471), -INT32_C(  1327565072), -INT32_C(  1635757858), -INT32_C(  1709568962),
+       INT32_C(  1068809048), -INT32_C(  2009265334),  INT32_C(   618607281), -INT32_C(   991289947), -INT32_C(  1943023204), -INT32_C(  1506013753), -INT32_C(  1673216931),  INT32_C(   557211337),
+       INT32_C(  1684072986), -INT32_C(  1494376971),  INT32_C(  1976290512), -INT32_C(  2043038231),  INT32_C(  1309829254), -INT32_C(   738963595), -INT32_C(   730908661), -INT32_C(  1326078570),
+      -INT32_C(  2078976369), -INT32_C(  1020591373), -INT32_C(  1221003570),  INT32_C(   826110379),  INT32_C(  1333743833), -INT32_C(  1440582753),  INT32_C(  1115656619), -INT32_C(   973966282),
+      -INT32_C(  1102510134), -INT32_C(   679382007),  INT32_C(   361740906),  INT32_C(    88591403), -INT32_C(  1152072164), -INT32_C(   446269894),  INT32_C(  1026024711),  INT32_C(   604117593),
+       INT32_C(   736250657),  INT32_C(   704799680),  INT32_C(  1228968221),  INT32_C(  2051966814), -INT32_C(  2026462643),  INT32_C(   527277080), -INT32_C(   631466879), -INT32_C(   788635986),
+       INT32_C(  1778114729),  INT32_C(  1637154116), -INT32_C(   307571569), -INT32_C(  1469581221), -INT32_C(  1305436774), -INT32_C(  1160667847), -INT32_C(   527094479),  INT32_C(   900764555),
+      -INT32_C(  1197560972),  INT32_C(   924398248),  INT32_C(  1629799430),  INT32_C(  1460309180),  INT32_C(  1661549097),  INT32_C(   136174551), -INT32_C(  1796689400), -INT32_C(  1161193402),
+      -INT32_C(   328046781), -INT32_C(  1608283238),  INT32_C(   201476175), -INT32_C(    43840300),  INT32_C(   492858438),  INT32_C(  1344634439),  INT32_C(  1994657328), -INT32_C(   365908570),
+      -INT32_C(  1361665516),  INT32_C(  2102393134),  INT32_C(   361320769), -INT32_C(  1558975395), -INT32_C(  1598000295),  INT32_C(   586212849), -INT32_C(  1701260045), -INT32_C(  1769682559),
+      -INT32_C(  1723573653), -INT32_C(  1793617069),  INT32_C(  1101701348), -INT32_C(   421216883),  INT32_C(   579249201),  INT32_C(  2101639050), -INT32_C(   854074037),  INT32_C(   291740582),
+       INT32_C(  1235986421),  INT32_C(   534692411), -INT32_C(   278820766),  INT32_C(  2010465606),  INT32_C(  1956207850),  INT32_C(   519167699),  INT32_C(  1642793403), -INT32_C(  1703784796),
+       INT32_C(   836967926),  INT32_C(  1112588767), -INT32_C(  1892568759), -INT32_C(   519698441),  INT32_C(   911581283),  INT32_C(   961824382), -INT32_C(   191217585), -INT32_C(  2071065458),
+       INT32_C(   162885930),  INT32_C(  2068514354), -INT32_C(  1374978633), -INT32_C(   410054268),  INT32_C(   790488241),  INT32_C(  2053665067),  INT32_C(  1080951473),  INT32_C(   969210895),
+      -INT32_C(  1623033235),  INT32_C(   924552832), -INT32_C(  1880742389), -INT32_C(   378112713), -INT32_C(  2061986982), -INT32_C(  1224769276), -INT32_C(  1829343613), -INT32_C(   657737110),
+      -INT32_C(  1267265996), -INT32_C(  1477668196), -INT32_C(   264842568), -INT32_C(  1579570105),  INT32_C(  1126625599), -INT32_C(   151443854) };
+  static const int32_t b[] =
+    { -INT32_C(  2089947226), -INT32_C(  1245676707),  INT32_C(   546374855),  INT32_C(  1851024731), -INT32_C(    56928444),  INT32_C(   393250697), -INT32_C(  1973407505),  INT32_C(  1676271037),
+       INT32_C(   702961356), -INT32_C(  1713396015),  INT32_C(   112816299),  INT32_C(   443813589), -INT32_C(   300543899), -INT32_C(  2046392681),  INT32_C(  1947231927),  INT32_C(   265812547),
+       INT32_C(   574209360),  INT32_C(   263919716),  INT32_C(  1561687176), -INT32_C(   394818942),  INT32_C(   836144794), -INT32_C(   877077484), -INT32_C(  2042640317),  INT32_C(   328603330),
+       INT32_C(   943050708),  INT32_C(  1866985703), -INT32_C(   406037404), -INT32_C(  2133900058), -INT32_C(   424499758), -INT32_C(   978163070), -INT32_C(   179572430), -INT32_C(   603397880),
+      -INT32_C(  1760281168), -INT32_C(  1861854419), -INT32_C(  1636248649), -INT32_C(   383891689),  INT32_C(  1875890413),  INT32_C(  1832157498),  INT32_C(  2070052723),  INT32_C(   290941537),
+      -INT32_C(   727094361),  INT32_C(  2103816134), -INT32_C(  1726226814),  INT32_C(   310524453),  INT32_C(  1166103050),  INT32_C(  1186117075), -INT32_C(  1765731275),  INT32_C(   631707774),
+       INT32_C(  1241075843), -INT32_C(  2100863488),  INT32_C(  1646060092),  INT32_C(   661954076), -INT32_C(   999491856), -INT32_C(   536207701), -INT32_C(  1334391758),  INT32_C(  1758797540),
+       INT32_C(  1857146478),  INT32_C(  1777432620),  INT32_C(  2009795931), -INT32_C(  1667350613), -INT32_C(   513799627),  INT32_C(  1522625064),  INT32_C(   453654582), -INT32_C(   997990570),
+      -INT32_C(   634178387),  INT32_C(   138618029), -INT32_C(   595653071), -INT32_C(  2089279923),  INT32_C(  1365563432),  INT32_C(  2041259331), -INT32_C(  1282099619),  INT32_C(  1131943829),
+      -INT32_C(   115496116),  INT32_C(       90319), -INT32_C(  1143177106), -INT32_C(   952216162),  INT32_C(  1880662573),  INT32_C(   636142536),  INT32_C(   265911929), -INT32_C(   497921642),
+      -INT32_C(   874811396),  INT32_C(  1036770511), -INT32_C(    67590308),  INT32_C(   717371388), -INT32_C(  1583686951),  INT32_C(   398951581), -INT32_C(  1725521917), -INT32_C(   310675215),
+      -INT32_C(  1229433113), -INT32_C(  1896643790),  INT32_C(   663350058), -INT32_C(    61781214), -INT32_C(  1013060827),  INT32_C(  1943692400), -INT32_C(   183762940),  INT32_C(  1608681336),
+       INT32_C(   253074141),  INT32_C(  1218250781),  INT32_C(   376383475), -INT32_C(  1743601550),  INT32_C(   458993579),  INT32_C(   411972884), -INT32_C(  1391551947), -INT32_C(    32706527),
+      -INT32_C(  1475534453),  INT32_C(   485534505),  INT32_C(  1144152018), -INT32_C(   874757089),  INT32_C(   149305332), -INT32_C(  1591708308),  INT32_C(   827207183), -INT32_C(  1439737313),
+      -INT32_C(  1538114181), -INT32_C(  1161739288), -INT32_C(  1023478878),  INT32_C(   747494200),  INT32_C(  2134143762), -INT32_C(   132098840), -INT32_C(  1574342781),  INT32_C(  1162631369),
+       INT32_C(  2112462485), -INT32_C(  2076726559), -INT32_C(   700041570),  INT32_C(   587387665),  INT32_C(   799159878),  INT32_C(   220709770), -INT32_C(    72396750),  INT32_C(  1044446120),
+       INT32_C(  2075863706),  INT32_C(  1929376724),  INT32_C(   977814825),  INT32_C(  1599949336),  INT32_C(   193855616), -INT32_C(   182929981) };
+  static const int32_t c[] =
+    { -INT32_C(   131596363), -INT32_C(  1828671002), -INT32_C(  1620191084),  INT32_C(  2039142986), -INT32_C(  1160755572),  INT32_C(  1508057517),  INT32_C(  1692231011),  INT32_C(   766549112),
+      -INT32_C(  2128226405),  INT32_C(   471082632),  INT32_C(  1220313854), -INT32_C(   389986724),  INT32_C(   983732877),  INT32_C(   395609523),  INT32_C(  1652257258), -INT32_C(  1466946803),
+      -INT32_C(  1976978174), -INT32_C(   643350821),  INT32_C(   472015808),  INT32_C(   906290089),  INT32_C(   695314293),  INT32_C(   390071596), -INT32_C(  2072396938), -INT32_C(   382989849),
+      -INT32_C(  1703651649),  INT32_C(  1416895380),  INT32_C(   661689982), -INT32_C(   279022471),  INT32_C(  1209585435),  INT32_C(  1247762644), -INT32_C(    87107565), -INT32_C(  1578828830),
+      -INT32_C(   449095599), -INT32_C(   247877773), -INT32_C(  1088902843),  INT32_C(   967734813),  INT32_C(   427935301),  INT32_C(   828694558), -INT32_C(  1708379464),  INT32_C(  2117799981),
+      -INT32_C(   614238360),  INT32_C(  1825348646),  INT32_C(  1663820869), -INT32_C(  1600333477), -INT32_C(  1111876193), -INT32_C(  1242685699),  INT32_C(  2119178832), -INT32_C(  1828943062),
+       INT32_C(   695033858),  INT32_C(  1117075964),  INT32_C(  2040905758),  INT32_C(   941179289),  INT32_C(  1542837086),  INT32_C(  1108403185),  INT32_C(   683696382), -INT32_C(   289686292),
+       INT32_C(   420947996), -INT32_C(  2141475742),  INT32_C(   100204652), -INT32_C(  1623387583), -INT32_C(   671468826),  INT32_C(   337185302),  INT32_C(  1463605611), -INT32_C(  1304037482),
+      -INT32_C(  2100601568),  INT32_C(  1979852297),  INT32_C(  1736178470), -INT32_C(   217663219),  INT32_C(    30081259),  INT32_C(  1981146123),  INT32_C(  1422742206),  INT32_C(  1762005577),
+       INT32_C(  2045497967),  INT32_C(   535817720), -INT32_C(   158962968),  INT32_C(   266964259), -INT32_C(  1743735667),  INT32_C(  1460545177), -INT32_C(  1045701768),  INT32_C(  1563144686),
+       INT32_C(  2094405251), -INT32_C(   325335804),  INT32_C(  1407328560),  INT32_C(  1013107886),  INT32_C(   433353600),  INT32_C(   292610969), -INT32_C(  1395516482),  INT32_C(  1342897613),
+       INT32_C(   416079892), -INT32_C(   704354394),  INT32_C(   925493129),  INT32_C(   863210675), -INT32_C(  1739765505), -INT32_C(   374751957), -INT32_C(  1500087335), -INT32_C(  1913216903),
+       INT32_C(   648397696), -INT32_C(  1275287254),  INT32_C(  1139484304), -INT32_C(  1317577038), -INT32_C(   783694682),  INT32_C(  1522266753), -INT32_C(   436186771),  INT32_C(  1903425521),
+      -INT32_C(   459794246),  INT32_C(  1385731266),  INT32_C(  1821803450), -INT32_C(  2011361823),  INT32_C(  1381590737), -INT32_C(   961735592),  INT32_C(  1454157157),  INT32_C(  1590173860),
+      -INT32_C(    96247752), -INT32_C(  1353851916),  INT32_C(  1058792286), -INT32_C(  1043908112), -INT32_C(   132963937), -INT32_C(  1681997771),  INT32_C(   317811310), -INT32_C(  1015957110),
+       INT32_C(   247313433), -INT32_C(   306378097), -INT32_C(   584263443), -INT32_C(  1314982895),  INT32_C(  1252635157), -INT32_C(   521836686),  INT32_C(  1559484369), -INT32_C(  1440783216),
+      -INT32_C(  1481057256), -INT32_C(   728467993),  INT32_C(  1605550157), -INT32_C(   921677644),  INT32_C(  1964292354), -INT32_C(   246023904) };
+  static const int32_t e[] =
+    {  INT32_C(   616525245),  INT32_C(  1039047870), -INT32_C(   892712274), -INT32_C(   394408424), -INT32_C(   600577452), -INT32_C(   274933927),  INT32_C(   584691875),  INT32_C(  2089610943),
+       INT32_C(   446778203), -INT32_C(    44593177),  INT32_C(  1458939198), -INT32_C(    99300853),  INT32_C(    60008904), -INT32_C(  1980117693), -INT32_C(  1635757858), -INT32_C(  1709568962),
+       INT32_C(  1068809048),  INT32_C(  1604097987),  INT32_C(   618607281), -INT32_C(  1198136461), -INT32_C(  1943023204), -INT32_C(  1506013753), -INT32_C(  1673216931),  INT32_C(   894116921),
+       INT32_C(  1063467591), -INT32_C(  1494376971),  INT32_C(  1976290512),  INT32_C(  1928382415),  INT32_C(  1309829254), -INT32_C(   738963595), -INT32_C(   730908661),  INT32_C(   617283218),
+      -INT32_C(  2078976369), -INT32_C(  1020591373), -INT32_C(  2134056825), -INT32_C(  1513875078), -INT32_C(  1702432982),  INT32_C(  1220686116),  INT32_C(  1115656619), -INT32_C(   141462365),
+      -INT32_C(   274531794), -INT32_C(   679382007), -INT32_C(    50431463),  INT32_C(    88591403), -INT32_C(  1152072164), -INT32_C(   446269894),  INT32_C(   163451075),  INT32_C(   604117593),
+       INT32_C(   736250657),  INT32_C(   704799680), -INT32_C(  1643160342), -INT32_C(  1194060831),  INT32_C(   195033486),  INT32_C(   527277080), -INT32_C(   631466879), -INT32_C(   788635986),
+       INT32_C(  1156755130),  INT32_C(  1637154116), -INT32_C(   307571569),  INT32_C(  1861770250),  INT32_C(   368236488), -INT32_C(  1578355458), -INT32_C(   527094479),  INT32_C(   900764555),
+      -INT32_C(  1197560972),  INT32_C(   924398248),  INT32_C(  1629799430),  INT32_C(  1460309180),  INT32_C(  1661549097),  INT32_C(   136174551),  INT32_C(  1619505062), -INT32_C(   270926585),
+      -INT32_C(   193774765), -INT32_C(  1608283238),  INT32_C(   201476175), -INT32_C(    43840300), -INT32_C(  1927804709),  INT32_C(  1344634439),  INT32_C(  1994657328), -INT32_C(   365908570),
+      -INT32_C(  1361665516), -INT32_C(  2015114954),  INT32_C(   361320769),  INT32_C(  1816228666), -INT32_C(  1598000295),  INT32_C(   454372454), -INT32_C(  1701260045), -INT32_C(  1769682559),
+       INT32_C(  1791125665), -INT32_C(   422861092),  INT32_C(  1960679665), -INT32_C(   421216883),  INT32_C(   864616212),  INT32_C(  2101639050),  INT32_C(    24768773),  INT32_C(  1044914249),
+       INT32_C(   620241921),  INT32_C(   534692411), -INT32_C(   278820766),  INT32_C(  1901115358),  INT32_C(  1956207850),  INT32_C(   969738749),  INT32_C(  1642793403), -INT32_C(   342238443),
+       INT32_C(   836967926),  INT32_C(   135763577),  INT32_C(  1483081884),  INT32_C(   389652682), -INT32_C(  1302492627), -INT32_C(  2009962624),  INT32_C(   441885702), -INT32_C(   159936042),
+       INT32_C(   131842406),  INT32_C(  2068514354), -INT32_C(  1374978633), -INT32_C(   410054268),  INT32_C(   790488241),  INT32_C(  2053665067),  INT32_C(  1080951473),  INT32_C(   969210895),
+      -INT32_C(  1623033235),  INT32_C(   924552832), -INT32_C(   767515209), -INT32_C(   378112713), -INT32_C(  2061986982),  INT32_C(    25362330), -INT32_C(  1829343613), -INT32_C(   166221792),
+       INT32_C(   463990624), -INT32_C(  1477668196), -INT32_C(   264842568), -INT32_C(   804258468),  INT32_C(  1126625599), -INT32_C(   302195722) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i])),
+      cv = simde_svld1_s32(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmad_s32_m(pv, av, bv, cv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], c[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+    cv = simde_svld1_s32(pg, &(c[i]));
+
+    ev = simde_svmad_s32_m(pv, av, bv, cv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const int64_t a[] =
+    {  INT64_C( 6216056455458014579), -INT64_C(  892132451997233086),  INT64_C( 2105457793072508100),  INT64_C( 2647062913735918588),
+       INT64_C( 3911072759364916614), -INT64_C( 6309315597197876933),  INT64_C( 3300300912421837563), -INT64_C( 1378126333532691191),
+      -INT64_C( 5969482333766777090),  INT64_C( 2382574792137660548), -INT64_C( 1363570456689254731),  INT64_C( 2816587227845902532),
+      -INT64_C( 7337418128015887603), -INT64_C( 6349772070586198375),  INT64_C( 1640332066435216369), -INT64_C(   58169722625037343),
+       INT64_C( 2808744837493181257),  INT64_C(  187399735121214721), -INT64_C( 6205227149342333062), -INT64_C( 4397795298606112251),
+       INT64_C( 2441544874909136175),  INT64_C(  732870194758928409), -INT64_C( 6681730385541987372),  INT64_C(  871325428417755355),
+       INT64_C( 7946788825211615495), -INT64_C( 2590762721467737230),  INT64_C( 8504693421422207686),  INT64_C( 4152004613321236917),
+      -INT64_C( 9016584615390845413), -INT64_C(   78374047611390716), -INT64_C( 3133827908135394959),  INT64_C( 5365199132005125385),
+      -INT64_C( 9008157485655468438), -INT64_C( 9203818256458088434),  INT64_C( 1859157682931148761), -INT64_C( 6712955850344549540),
+       INT64_C( 4008512807742836896), -INT64_C( 9067783820073422695),  INT64_C( 2274959666657801321),  INT64_C( 5932789584842385275),
+       INT64_C( 2697958045256872465),  INT64_C( 1904449461473439299), -INT64_C( 6157224229896722261), -INT64_C( 3958466466409531636),
+      -INT64_C( 2965773651921370843),  INT64_C( 5057031774681605474), -INT64_C(  868840791509516009),  INT64_C( 2880827126824652665),
+      -INT64_C( 3193984032730120894), -INT64_C( 5388814656734794155), -INT64_C( 6435100512307319850),  INT64_C( 7378814993113244221),
+       INT64_C( 4905240157927260110), -INT64_C( 1897304006507234985), -INT64_C( 3302735475082352809), -INT64_C( 6899381782134586954),
+      -INT64_C( 4761445658297139785), -INT64_C( 1954739753661030165), -INT64_C( 8399895184331472635), -INT64_C( 5906569904262905964),
+      -INT64_C( 4303679991354890462),  INT64_C( 6688581397591816545),  INT64_C( 7097503473011735071), -INT64_C( 6014046536860048156),
+      -INT64_C( 9127254789519515721), -INT64_C( 3447714757867531405),  INT64_C( 7470138638081465980), -INT64_C(  262110078612376537),
+       INT64_C( 9172955081334428075),  INT64_C( 8752307160560024821), -INT64_C( 6594837220865918321),  INT64_C( 3685265593446284515),
+      -INT64_C( 8517068224230149822),  INT64_C( 1620916014720947719), -INT64_C( 7925593520135978528),  INT64_C( 5412164610851231583),
+       INT64_C( 7758970313326008720),  INT64_C( 7141282401337007229),  INT64_C( 4931938458999538223), -INT64_C( 7246496266045412581),
+      -INT64_C( 1427521854578423456), -INT64_C( 4814899343189303224), -INT64_C( 3641709289189675187),  INT64_C( 5250460390767305016),
+       INT64_C( 5892463171159759978),  INT64_C( 1019866035192116956),  INT64_C(  556677033078342457),  INT64_C( 8468780553553488471),
+      -INT64_C( 5972593544298261308), -INT64_C( 4856499413942060597), -INT64_C( 1668194912343369214),  INT64_C( 1048405546021364491),
+      -INT64_C( 4845599489041638589),  INT64_C( 1833777689258416178), -INT64_C( 8775611889512473923),  INT64_C( 5710329084389449190),
+       INT64_C( 5022115103116564997), -INT64_C( 7265593877070152965) };
+  static const int64_t b[] =
+    { -INT64_C( 8724580542790202154), -INT64_C( 1971237478935454768), -INT64_C(  321414420671470164), -INT64_C( 8765330128957616339),
+      -INT64_C( 1111247677214813994),  INT64_C( 2270537083626762666), -INT64_C(  415677185908690186), -INT64_C( 3513772008054280442),
+       INT64_C( 1707551924961500834),  INT64_C( 2788914751058845475), -INT64_C( 6939586774005554711),  INT64_C( 2024810561410558033),
+      -INT64_C( 8469986225546135824),  INT64_C( 5370213116063787311), -INT64_C( 2347023504378827722),  INT64_C( 4985557720677073818),
+      -INT64_C( 3591031778512269768),  INT64_C( 6191240160692030017),  INT64_C( 4111383622712552608), -INT64_C( 5481304631171729324),
+      -INT64_C( 1514760159110131315),  INT64_C( 9024219544004798664),  INT64_C( 4917010433181507427), -INT64_C( 7700913434041414926),
+      -INT64_C( 5187939031370861715),  INT64_C( 7367566849604553956), -INT64_C( 7534340052069258693), -INT64_C( 6355383670995133137),
+       INT64_C( 3404930545606299287), -INT64_C(  670140537546678454), -INT64_C( 1129398820268860392),  INT64_C( 1355571922165323759),
+      -INT64_C( 7638709373826855549),  INT64_C( 3704937588623338937),  INT64_C(  892912419904392370),  INT64_C(  299494327690038426),
+       INT64_C( 6228988032256754321), -INT64_C( 7274942969599601732), -INT64_C( 2888089125983946047), -INT64_C( 5295082915859980034),
+      -INT64_C( 2104583837637781800), -INT64_C( 8368879109589527209),  INT64_C( 6616726135380830910), -INT64_C( 5814324318114758539),
+       INT64_C( 4448975781710062261), -INT64_C(  370885903738046588),  INT64_C( 1079678197353038915), -INT64_C( 1652830733889645175),
+      -INT64_C( 6413828308059540519),  INT64_C( 1742841190672595961),  INT64_C( 8700026417887847700),  INT64_C( 3865750240658744456),
+      -INT64_C( 1953732196171421414), -INT64_C( 4874785234167932819),  INT64_C( 5608151160300638574), -INT64_C( 5972424481052185461),
+       INT64_C( 8207753163523559960), -INT64_C( 5257939055996174172),  INT64_C( 2679616055224267549),  INT64_C(   60001342337136788),
+       INT64_C( 3436786973967367996), -INT64_C( 8220332181189598229),  INT64_C( 8914487229824368630),  INT64_C( 3007975663142683606),
+      -INT64_C( 7425843506265341640), -INT64_C( 1766896558868238979),  INT64_C( 6708443180447558071),  INT64_C( 7928263023693381104),
+       INT64_C(  567211150583885723),  INT64_C( 1974668339564555408), -INT64_C(  199334805769691305), -INT64_C( 3804449660603836529),
+       INT64_C( 1720923197925450832), -INT64_C( 7341431154272578146),  INT64_C( 4100725003102246622), -INT64_C(  862947701438889462),
+      -INT64_C( 6181842446921623146), -INT64_C( 6097369439610745468), -INT64_C( 7529316485998126687),  INT64_C( 5249183628555092032),
+      -INT64_C( 2762788677260826894), -INT64_C( 4476858266749479577),  INT64_C( 3746306541570717146), -INT64_C( 7347359283998634226),
+       INT64_C( 8053350965708352917),  INT64_C( 4501209721652601750),  INT64_C( 2098292665646154487), -INT64_C( 4993114139319782030),
+       INT64_C( 2506931094627372115), -INT64_C( 1698050641465151796),  INT64_C( 2954063073864979665),  INT64_C( 1442830565693905958),
+      -INT64_C( 2310001277105362366), -INT64_C( 1477042029387068760),  INT64_C( 7598076436700484498), -INT64_C( 1333986148544629594),
+      -INT64_C( 3578482473170047900),  INT64_C( 8610011556503512695) };
+  static const int64_t c[] =
+    { -INT64_C(  813350951112453880), -INT64_C( 1548175005342767139), -INT64_C( 4317065920844610281), -INT64_C( 9187606606297541212),
+      -INT64_C(  435513136967469214),  INT64_C( 4150770893045193638),  INT64_C(  969475040509539909), -INT64_C( 9182342531813929319),
+      -INT64_C(   31114694743713157),  INT64_C( 6137642200037560273),  INT64_C( 4068291559656086271), -INT64_C(  421408173832160633),
+      -INT64_C( 1311070735358056587), -INT64_C( 4244907876937531981),  INT64_C( 2035525417060605032), -INT64_C( 2749473531883255715),
+       INT64_C( 4654882040706525583), -INT64_C( 1116863533049218316), -INT64_C( 5843079320872440521),  INT64_C( 2520715701011524543),
+       INT64_C( 1051984251312776139), -INT64_C( 1343963065514156832),  INT64_C( 5112891278374883574), -INT64_C( 6123940151276568754),
+       INT64_C( 1670726846880468999),  INT64_C( 3953554920820504633), -INT64_C( 8577543943397468375), -INT64_C( 3856087592648220688),
+       INT64_C( 6236107922337464380),  INT64_C(  975631732852525843),  INT64_C( 7601148706984691642), -INT64_C( 8241104280996879085),
+      -INT64_C( 4851629518953018057), -INT64_C( 3564429692309016169),  INT64_C( 1046030261680228002), -INT64_C( 5980069511869120733),
+       INT64_C( 2771876028010857235), -INT64_C( 4286818666267179105), -INT64_C( 6378957981091936912), -INT64_C(  628782230329926110),
+      -INT64_C( 7578103558982907872),  INT64_C( 1195930692195350194), -INT64_C(  199015063863199983), -INT64_C( 7696691941662697645),
+      -INT64_C( 4706232971319451100), -INT64_C( 2863960853012350319),  INT64_C(  250417829762677921),  INT64_C( 1012020096513281537),
+      -INT64_C(  281517396623601588),  INT64_C( 8463229984158099923), -INT64_C( 8368133912996487126), -INT64_C( 3499001677048899207),
+       INT64_C( 5099269340795476317), -INT64_C( 8560969745998745112),  INT64_C(  452965314567807796), -INT64_C( 5499780978309510566),
+      -INT64_C(  419891314843462540), -INT64_C( 7775209255229584080),  INT64_C( 1774308016813931531),  INT64_C( 6336462297597544677),
+      -INT64_C( 2629140476791526538),  INT64_C( 3201077616524802423),  INT64_C( 4599411460329029375), -INT64_C( 2114884862069716372),
+      -INT64_C( 4225522903939357482),  INT64_C( 5221088453849826855),  INT64_C(  747836811325487815),  INT64_C( 2157506001687469219),
+       INT64_C( 8140248944272563172),  INT64_C( 7156269956076180671), -INT64_C( 3454008932664322969),  INT64_C( 5703193656968571585),
+       INT64_C( 8855618088331231788),  INT64_C( 3606770648757738765),  INT64_C( 3973661919280664871),  INT64_C(  102286283010671794),
+       INT64_C( 8312900984640040231), -INT64_C( 2740957475454001160),  INT64_C( 2911949301656399547),  INT64_C( 3759854834547992663),
+      -INT64_C(  687234358316719203),  INT64_C( 8637535456939643475), -INT64_C( 5369397558887576610),  INT64_C( 1007414819200024762),
+      -INT64_C( 2835712481634020943), -INT64_C( 1347496511803662567), -INT64_C( 4550398114405419834),  INT64_C( 8790044372227308158),
+      -INT64_C( 5985056773614596973),  INT64_C( 5704597863049317677), -INT64_C( 6375041905684419391),  INT64_C( 2614782209337724423),
+       INT64_C( 7916533473714401950), -INT64_C( 1309750158742102278), -INT64_C( 7344741442734766783), -INT64_C( 2810330577085224886),
+       INT64_C( 7193347465398598437), -INT64_C( 7827616438085583546) };
+  static const int64_t e[] =
+    {  INT64_C(                   0), -INT64_C( 5780471397802634371),  INT64_C( 4719299196478041287),  INT64_C( 8003240132273687792),
+       INT64_C(                   0),  INT64_C( 9154369222497515476),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 5657337565416109257), -INT64_C( 5954715042388138531),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 1421807023097658686),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 2040748783243230667),  INT64_C( 3743671164963311991),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(  502270927869216782),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7530067485397669579),  INT64_C( 6930428060648788267),
+       INT64_C( 5468695919263921193), -INT64_C( 4758100996721976773),  INT64_C( 7580169692123268690), -INT64_C( 5240578862029283462),
+       INT64_C( 1069746706934507381),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 7052977345928572165),  INT64_C( 2366129995216966297),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 8703925494799167095),  INT64_C(                   0),  INT64_C(  183181906424135631),
+       INT64_C( 1093071737336552269), -INT64_C( 6903617201202475239),  INT64_C( 3197184526512054694),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 8408579064047873664),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 5483111216398757303), -INT64_C(  225544675099114509), -INT64_C( 8166195231307738730), -INT64_C( 7955459221134147540),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 3455889102706103691),
+       INT64_C( 6706122210902799726),  INT64_C(                   0), -INT64_C( 6719587097358009911),  INT64_C( 9001347201959906564),
+      -INT64_C( 3778095460863718434),  INT64_C(                   0), -INT64_C( 3048146424377581205), -INT64_C( 1610466504031761357),
+       INT64_C( 4530764926724649837),  INT64_C( 5788139793647630991),  INT64_C(                   0), -INT64_C( 2646284677546831218),
+      -INT64_C( 1249678222938018100),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 9139897667427829881),  INT64_C( 7381210199091554668),  INT64_C(                   0), -INT64_C( 5136598095617659113),
+       INT64_C(                   0), -INT64_C( 3531101547997759669),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 7027297825487569565), -INT64_C( 3086807813482375167),  INT64_C( 9146259575289037509), -INT64_C( 8089902840876197828),
+       INT64_C( 3650680186157103135),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5397933468441594455),
+       INT64_C( 6711945562801993700),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 4060036134423702003) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i])),
+      cv = simde_svld1_s64(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmad_s64_z(pv, av, bv, cv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], c[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+    cv = simde_svld1_s64(pg, &(c[i]));
+
+    ev = simde_svmad_s64_z(pv, av, bv, cv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1) };
+  static const int64_t a[] =
+    {  INT64_C( 8146414063047140180), -INT64_C( 6815686051149295651),  INT64_C( 2297829533215754961),  INT64_C( 2455730421635772326),
+      -INT64_C(  197045541171413148), -INT64_C( 8175675178378728381),  INT64_C( 8222634817079428148), -INT64_C( 4969092894890142438),
+       INT64_C( 2925316543041302907), -INT64_C( 5257781575980852804), -INT64_C( 7773545581981085728), -INT64_C(  164233493537339994),
+      -INT64_C( 3421556952883772297),  INT64_C( 1279955990204749449), -INT64_C( 1139451067214497759), -INT64_C( 6296132121435198687),
+      -INT64_C( 1094787679179753494), -INT64_C( 8475281465171765474),  INT64_C( 1978018096247807800), -INT64_C( 1092020628468375297),
+      -INT64_C( 8940282543334302571), -INT64_C( 2105937874274489901),  INT64_C( 4497362369804299091),  INT64_C( 1886522832006817592),
+      -INT64_C( 6122076514942575582),  INT64_C( 7311785385605520877), -INT64_C( 1434364918245368422), -INT64_C( 1160986638064908732),
+      -INT64_C( 1515319449212225164),  INT64_C( 2942250846731165789), -INT64_C( 1767915039022217258),  INT64_C( 7952675220797563296),
+      -INT64_C( 5659701656011680883), -INT64_C( 4374414788736781165),  INT64_C(  434251456490392699), -INT64_C( 2895865917999892634),
+      -INT64_C( 3410679305642866012),  INT64_C( 4214027570946099914), -INT64_C(  795905067154028153), -INT64_C( 2505931888790247401),
+       INT64_C( 4232117497326115502),  INT64_C( 8017652980481371210),  INT64_C( 1493033426819587381), -INT64_C( 2319442654016434759),
+       INT64_C( 8138995348665967945), -INT64_C( 8680198650762500815), -INT64_C( 1122238295417624997), -INT64_C( 2657210013413350641),
+      -INT64_C( 6850950925019387561),  INT64_C( 9099032818456553069), -INT64_C( 6751101916646240216),  INT64_C( 4221001927852503335),
+       INT64_C( 2304334145774823916),  INT64_C( 2281958275926635529), -INT64_C( 1303001791155240267), -INT64_C( 4891970426401010177),
+       INT64_C( 9166251815456920420), -INT64_C( 1307637940130999099),  INT64_C( 2777348949734152664), -INT64_C( 3424664892680359443),
+       INT64_C( 7416614541513363704), -INT64_C( 4011021787929142993), -INT64_C( 7448124015376954539), -INT64_C( 3936199050338587869),
+      -INT64_C( 8041698986077698721), -INT64_C( 2776945788449158978), -INT64_C( 1000652550827549479), -INT64_C( 6828053784485072221),
+       INT64_C( 6419890732905166118),  INT64_C( 4030015084582867088), -INT64_C( 2514459697629937062), -INT64_C( 6688251726722393014),
+       INT64_C( 7635927765869121540), -INT64_C( 2888659498371841965), -INT64_C( 4052084636677790291), -INT64_C( 6280407513597471306),
+      -INT64_C( 7452543392073448878),  INT64_C( 2996077362464559423),  INT64_C( 7286214721195316441),  INT64_C( 4987579303724675563),
+      -INT64_C(  193932145592336782), -INT64_C( 6360684874609026540), -INT64_C( 8361184906226840605),  INT64_C( 8270105353310081164),
+       INT64_C( 5587411571499939279),  INT64_C( 8469185756380611603),  INT64_C( 3138727048739521890), -INT64_C( 3890422906623383153),
+      -INT64_C( 5176076719209632603),  INT64_C(  156818531891611685), -INT64_C( 4363544715534715738),  INT64_C( 3531197643547155516),
+       INT64_C( 6835964202009385089),  INT64_C( 4531257399450105665), -INT64_C( 5229253680816658569), -INT64_C( 7507800648362049519),
+       INT64_C( 6259612148259806279), -INT64_C( 5914605963012738028),  INT64_C( 8445310761623383809),  INT64_C( 6427727459425329798),
+      -INT64_C( 6761951916934434372),  INT64_C( 8831622064924155820),  INT64_C( 3711293391153588392),  INT64_C( 3509996753611887435),
+      -INT64_C(  926569136719228940),  INT64_C( 6160192754297500554), -INT64_C( 1715902669632998578), -INT64_C(  712981605340807562),
+      -INT64_C( 3403141015904183158),  INT64_C( 5697422971993561872), -INT64_C( 3726594180247751741),  INT64_C( 1328791174667210104),
+      -INT64_C( 7709130648050145044), -INT64_C( 1470879207938402491), -INT64_C( 3100284848673398314),  INT64_C( 7834783961553219360),
+      -INT64_C( 8160061515142029402),  INT64_C( 5587960498731946874), -INT64_C( 8467484822439536819),  INT64_C( 3391190219820813090),
+      -INT64_C( 3791154224006713716), -INT64_C(  939570457363007184) };
+  static const int64_t b[] =
+    { -INT64_C( 2491844117870522350), -INT64_C( 8448787840398698466),  INT64_C( 2393367906382296310), -INT64_C( 2207110372320954927),
+       INT64_C( 6623795853742574612),  INT64_C( 2922591181909086923),  INT64_C( 1181494784989875157), -INT64_C(  582700605219922120),
+       INT64_C( 3492809122335093216), -INT64_C( 3485851006540588731), -INT64_C( 6458310925474338033), -INT64_C( 8542880263981574761),
+      -INT64_C( 5756692774805669752),  INT64_C( 2720954922444476920), -INT64_C( 1961649358974495311), -INT64_C( 7792688557711264601),
+      -INT64_C( 7538290616556289977),  INT64_C(   83399395840199150),  INT64_C( 1608321003411315744), -INT64_C( 4108619319105638564),
+       INT64_C(  430053182886476737), -INT64_C( 1390150154710319003),  INT64_C( 1896767226621122253), -INT64_C( 4998858173826615205),
+       INT64_C( 6490832707165755895),  INT64_C( 2038657626481237393), -INT64_C( 6164677682155445094),  INT64_C( 7500223393950921827),
+      -INT64_C( 3274808241875898306), -INT64_C(  426581507793970007),  INT64_C( 8797998576477367582),  INT64_C(   41355660991306937),
+       INT64_C( 4409236878158661916), -INT64_C(  524868528227655587), -INT64_C( 8554167681444148553),  INT64_C( 2944022702944624410),
+       INT64_C( 3251799939248164686),  INT64_C( 6334490588505331222), -INT64_C( 1944025843900265044),  INT64_C( 5603213503734266254),
+       INT64_C( 1488528730764626091), -INT64_C( 2333449326945856858), -INT64_C( 4617771604743830726), -INT64_C( 1052403850539324902),
+      -INT64_C( 8325162406427978396), -INT64_C( 6721217373223551834), -INT64_C( 8060157495388728013), -INT64_C(  111448033997586884),
+      -INT64_C( 7271384899747979101), -INT64_C( 8259549654120273579), -INT64_C( 3077622545832081596), -INT64_C( 6616409075899436396),
+      -INT64_C( 4882953783611650388),  INT64_C( 2671719666119520812), -INT64_C( 5742325801871800863),  INT64_C( 2215783601404815131),
+       INT64_C( 6755113778515275162), -INT64_C(  885812667101267794), -INT64_C( 2898139219645000709),  INT64_C( 5473478498552358244),
+       INT64_C( 6858712516362286497),  INT64_C(  380732329476100930), -INT64_C( 2825758679069051339),  INT64_C( 1190256999148797064),
+       INT64_C( 2191303425682231641),  INT64_C( 3329210128945796901), -INT64_C( 4918801387722158224),  INT64_C( 7576313578810272676),
+       INT64_C( 4414615155530466890), -INT64_C( 2207714413154355660),  INT64_C(  638527514243071215), -INT64_C( 7754003067152117268),
+      -INT64_C( 1613135611085334458), -INT64_C( 7636850806916446029),  INT64_C( 3917168822875376112), -INT64_C(  197148243011668123),
+      -INT64_C( 5976848476743664274), -INT64_C( 8629506459344820993), -INT64_C( 1216191205086530146),  INT64_C( 6225350072731652528),
+      -INT64_C( 5294395088229974049), -INT64_C( 3833518568371300437), -INT64_C( 7995345224673810032),  INT64_C( 7738130337040476452),
+       INT64_C( 1119649616279952668),  INT64_C( 1303827836155717410), -INT64_C( 4378563578816508727), -INT64_C( 5920487960459856672),
+       INT64_C(  613344859654200080), -INT64_C( 4574127837470599184), -INT64_C( 3918792577437224390), -INT64_C( 5757557864978420261),
+      -INT64_C( 7848463936169666266),  INT64_C( 1384165122767153790),  INT64_C( 2445042582085738556),  INT64_C( 6072723866580231158),
+      -INT64_C( 8037390335516579265),  INT64_C( 4740384978498910942),  INT64_C( 3910062631136245467), -INT64_C( 5189814215970598536),
+      -INT64_C( 6043814419595961731),  INT64_C( 4453827353988245128),  INT64_C(  313178892563068642), -INT64_C( 5358538947021888397),
+      -INT64_C( 3352256704467944449), -INT64_C( 1429560782263165558), -INT64_C( 6993133461790881692),  INT64_C( 4789344298758413963),
+      -INT64_C( 6088713723712586650),  INT64_C( 8169459413063032680),  INT64_C( 6850068304659311944),  INT64_C( 3060365014782286322),
+       INT64_C( 8944247899585874005), -INT64_C( 4631867042047281351),  INT64_C( 6984593114714479035), -INT64_C(  159017244430037028),
+       INT64_C( 4046084037229651094),  INT64_C( 2126322871381726283), -INT64_C( 3305753216898255791),  INT64_C( 6507488995196515753),
+      -INT64_C( 6838388006554647838),  INT64_C( 2359294459723880510) };
+  static const int64_t c[] =
+    {  INT64_C(  822334105876992811), -INT64_C( 1500865372635379473),  INT64_C( 3860617882718479666), -INT64_C( 7603844823954811296),
+       INT64_C( 7626893771095012682),  INT64_C( 5135181188279384691),  INT64_C( 4841760905250158714),  INT64_C( 3277250416536464505),
+      -INT64_C( 2595812363651629801), -INT64_C( 1051177684455611635),  INT64_C( 1573479872858044591), -INT64_C( 5305955459407380916),
+       INT64_C( 4032481065930545074),  INT64_C( 5858271213580266211), -INT64_C( 6436847443666322694), -INT64_C( 3635194233346480841),
+      -INT64_C(  510071047477275510),  INT64_C(   70544694648718343), -INT64_C( 3541446039295304230),  INT64_C( 7840261047081873638),
+      -INT64_C( 7343950890897722105), -INT64_C( 2065396273103280049),  INT64_C( 1477446960147852315),  INT64_C( 6985614470635923106),
+       INT64_C( 7838112855483027865),  INT64_C( 7126410153645181690), -INT64_C( 7978243360293585660), -INT64_C( 2777587098384442181),
+       INT64_C( 9125079559396782360), -INT64_C( 9187510932043897643), -INT64_C( 1952879807973583772),  INT64_C( 1976917519817571158),
+       INT64_C( 1540215958055973982), -INT64_C( 6029279454579990442),  INT64_C( 6220567300353820230),  INT64_C( 1584806063753743329),
+      -INT64_C( 7483198893355216943),  INT64_C( 5848694923157199159), -INT64_C( 1073524598449886525),  INT64_C( 3759330736492250974),
+      -INT64_C( 5765895633600437726), -INT64_C( 1792054265876945211),  INT64_C( 5946093962764411267),  INT64_C( 5576461477791357131),
+      -INT64_C( 2676074871604008524), -INT64_C( 1865111043682203118),  INT64_C( 6337406406093293484), -INT64_C( 6859286880932439723),
+       INT64_C( 4504349686111240083), -INT64_C( 6629982585983062860), -INT64_C( 3946220401599482279),  INT64_C( 4619312976158704526),
+       INT64_C( 5116769305247672472),  INT64_C( 7003198612362393494),  INT64_C( 3895476961455535058),  INT64_C(  663098359945451846),
+       INT64_C( 1985753756570819508),  INT64_C( 1995613914987555911), -INT64_C( 4600021871010646197),  INT64_C( 6576634957491591881),
+       INT64_C( 2927674977952076033),  INT64_C( 7818294176528222492),  INT64_C( 1899262651458904352), -INT64_C(  619921195485884573),
+       INT64_C( 6031480124379826090),  INT64_C( 8500043286759091304),  INT64_C( 4793075610242012697),  INT64_C( 1974742062398757243),
+       INT64_C( 7801179056294585784),  INT64_C( 5571495025335270279),  INT64_C( 5288418718483243587),  INT64_C( 1991190692318785813),
+       INT64_C( 3131775957821180166), -INT64_C( 7076745619279745719), -INT64_C( 3111385087002836293), -INT64_C( 5597131371251528748),
+      -INT64_C(  930217988819493817),  INT64_C( 3717504308689772448),  INT64_C( 5643166985530136253), -INT64_C( 1046849784888579047),
+       INT64_C(  635277378206905651),  INT64_C( 4089155742584684564),  INT64_C( 2501191081508764655),  INT64_C( 5065530412347440048),
+       INT64_C( 3604836965706574230), -INT64_C( 8005291679236093900),  INT64_C( 5774933723958516728),  INT64_C(  235303657332739306),
+      -INT64_C( 8110693369732045280), -INT64_C( 6467126537475969009), -INT64_C( 3264322580958987839),  INT64_C( 8379248734857289176),
+       INT64_C( 7017212207065942649), -INT64_C( 8599532473777217195), -INT64_C(  916873832400531317), -INT64_C( 6791003653492107783),
+      -INT64_C( 1188713244689926708),  INT64_C( 8126634357729366648),  INT64_C( 5114164262643937770), -INT64_C( 9221026003720916417),
+      -INT64_C( 3795655617912275766), -INT64_C( 4033586037815360335),  INT64_C( 5843357925179844995), -INT64_C( 3878232594949035015),
+      -INT64_C( 7179720857199129539), -INT64_C( 4869456380681886011), -INT64_C(  395010542234944992),  INT64_C( 4186612612557389135),
+      -INT64_C( 8202981503952795743), -INT64_C( 5511668636425495667),  INT64_C(  276245372368981977), -INT64_C(  873579229788078936),
+       INT64_C( 6848472904867294131), -INT64_C( 5527139560369865723),  INT64_C( 5002764288827208374), -INT64_C( 2367545217220165665),
+       INT64_C( 5955840414804845685),  INT64_C( 3039708147421465761), -INT64_C(   51227208717124248),  INT64_C( 8415913786827879617),
+       INT64_C( 3213427783967188728),  INT64_C( 2436121640768668463) };
+  static const int64_t e[] =
+    {  INT64_C( 8146414063047140180),  INT64_C( 8510992737420352725),  INT64_C( 8710307381903490568), -INT64_C( 3354615539332113690),
+      -INT64_C( 1098703289665742566), -INT64_C( 8175675178378728381),  INT64_C( 8222634817079428148), -INT64_C( 4969092894890142438),
+      -INT64_C( 1345005683677572169),  INT64_C( 2699492826963390137), -INT64_C( 7773545581981085728), -INT64_C(  164233493537339994),
+      -INT64_C( 4613849884080111894),  INT64_C( 1279955990204749449), -INT64_C( 1139451067214497759),  INT64_C( 3053604898450521022),
+      -INT64_C( 1094787679179753494), -INT64_C( 8475281465171765474),  INT64_C( 1978018096247807800), -INT64_C( 1092020628468375297),
+       INT64_C(   96265806536349788), -INT64_C( 2105937874274489901),  INT64_C( 4497362369804299091),  INT64_C( 4145073028984035210),
+       INT64_C( 7523157244385790055),  INT64_C( 6848136461259216695), -INT64_C( 1434364918245368422),  INT64_C( 6864917942024345863),
+      -INT64_C(  322261746661713104), -INT64_C( 7464389988814279110),  INT64_C( 1210746988949642616),  INT64_C( 7952675220797563296),
+      -INT64_C( 5659701656011680883),  INT64_C( 8848601756386580925),  INT64_C(  434251456490392699), -INT64_C(  999797758719211971),
+      -INT64_C( 3410679305642866012),  INT64_C( 4214027570946099914), -INT64_C( 5520414645901054857),  INT64_C( 5709172396027306784),
+       INT64_C( 2831118664353145948),  INT64_C( 8017652980481371210), -INT64_C( 6940303482293920123), -INT64_C( 2319442654016434759),
+       INT64_C( 8138995348665967945), -INT64_C( 8680198650762500815),  INT64_C( 3068314197489623757), -INT64_C( 7474926052166536487),
+      -INT64_C( 6850950925019387561),  INT64_C( 5010589475979224037), -INT64_C( 6751101916646240216), -INT64_C( 5257963455174210534),
+       INT64_C(  805995966020320040),  INT64_C( 2281958275926635529), -INT64_C( 1303001791155240267), -INT64_C( 6999508540741358549),
+       INT64_C( 3063322961337899484), -INT64_C( 2334948126748892627),  INT64_C( 2777348949734152664),  INT64_C( 1208652984912714845),
+       INT64_C( 9064250335115252985), -INT64_C( 4011021787929142993), -INT64_C( 1621071752212437063),  INT64_C( 2474673103913463291),
+       INT64_C( 8095987542413653169), -INT64_C( 2776945788449158978), -INT64_C( 1000652550827549479), -INT64_C( 6828053784485072221),
+       INT64_C( 6419890732905166118), -INT64_C(  713066813622273849), -INT64_C( 5395585425346597815), -INT64_C( 6688251726722393014),
+       INT64_C( 7895589749152057886), -INT64_C( 2888659498371841965), -INT64_C( 4052084636677790291), -INT64_C( 6280407513597471306),
+      -INT64_C( 7452543392073448878),  INT64_C( 2996077362464559423),  INT64_C( 7286214721195316441),  INT64_C( 4987579303724675563),
+      -INT64_C( 1361199993024255871), -INT64_C( 6360684874609026540), -INT64_C( 8361184906226840605),  INT64_C( 8270105353310081164),
+      -INT64_C( 4198577153524842694),  INT64_C( 7343330381132150714),  INT64_C( 7377044241037684202), -INT64_C( 3890422906623383153),
+      -INT64_C( 5176076719209632603), -INT64_C( 1975281059381975617),  INT64_C( 5562605668326478685),  INT64_C( 3531197643547155516),
+       INT64_C( 7946595330007336607),  INT64_C( 9140406815984008531), -INT64_C( 5229253680816658569),  INT64_C(  531921269084715343),
+       INT64_C( 2761154326704558405), -INT64_C( 5914605963012738028),  INT64_C( 8445310761623383809),  INT64_C(  674939064306812687),
+      -INT64_C( 6761951916934434372),  INT64_C( 8831622064924155820),  INT64_C( 6765620857616448979), -INT64_C( 6618784916564057430),
+      -INT64_C(  926569136719228940),  INT64_C( 2973639912991019305), -INT64_C( 1715902669632998578),  INT64_C( 1163093959893531489),
+       INT64_C( 1456235894976282269),  INT64_C( 5697422971993561872), -INT64_C( 3726594180247751741),  INT64_C(   51724732804427800),
+      -INT64_C( 7709130648050145044), -INT64_C( 1470879207938402491), -INT64_C( 5011047922467991544),  INT64_C( 7834783961553219360),
+      -INT64_C( 1735654761858103367),  INT64_C( 5587960498731946874), -INT64_C( 8467484822439536819),  INT64_C( 1254970829731354675),
+       INT64_C(  520392638107637392),  INT64_C( 7437934530341690575) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i])),
+      cv = simde_svld1_s64(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmad_s64_m(pv, av, bv, cv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], c[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+    cv = simde_svld1_s64(pg, &(c[i]));
+
+    ev = simde_svmad_s64_m(pv, av, bv, cv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C(148), UINT8_C( 49), UINT8_C(  5), UINT8_C(230), UINT8_C( 17), UINT8_C(247), UINT8_C(124), UINT8_C(231),
+      UINT8_C(193), UINT8_C( 15), UINT8_C(194), UINT8_C(148), UINT8_C(157), UINT8_C(130), UINT8_C( 31), UINT8_C(138),
+      UINT8_C(204), UINT8_C( 40), UINT8_C(194), UINT8_C( 75), UINT8_C(186), UINT8_C(248), UINT8_C(154), UINT8_C(  5),
+      UINT8_C(195), UINT8_C(  1), UINT8_C(  7), UINT8_C(253), UINT8_C( 73), UINT8_C(195), UINT8_C(102), UINT8_C(221),
+      UINT8_C(244), UINT8_C(107), UINT8_C(196), UINT8_C(  6), UINT8_C( 99), UINT8_C( 64), UINT8_C(237), UINT8_C( 36),
+      UINT8_C( 80), UINT8_C(175), UINT8_C(184), UINT8_C(237), UINT8_C( 50), UINT8_C(216), UINT8_C(120), UINT8_C(254),
+      UINT8_C(  0), UINT8_C( 58), UINT8_C( 73), UINT8_C(186), UINT8_C( 50), UINT8_C(227), UINT8_C(192), UINT8_C(246),
+      UINT8_C(229), UINT8_C(199), UINT8_C(243), UINT8_C( 46), UINT8_C(138), UINT8_C( 89), UINT8_C( 11), UINT8_C(127),
+      UINT8_C(196), UINT8_C(207), UINT8_C(133), UINT8_C( 39), UINT8_C( 16), UINT8_C(114), UINT8_C( 75), UINT8_C( 96),
+      UINT8_C( 33), UINT8_C(  4), UINT8_C( 77), UINT8_C( 83), UINT8_C(220), UINT8_C(197), UINT8_C( 81), UINT8_C(220),
+      UINT8_C(  0), UINT8_C(154), UINT8_C(150), UINT8_C( 50), UINT8_C(126), UINT8_C( 86), UINT8_C( 40), UINT8_C( 99),
+      UINT8_C( 30), UINT8_C( 27), UINT8_C(145), UINT8_C(168), UINT8_C(116), UINT8_C(156), UINT8_C( 39), UINT8_C( 57),
+      UINT8_C(108), UINT8_C(172), UINT8_C( 96), UINT8_C(124), UINT8_C( 30), UINT8_C(172), UINT8_C(220), UINT8_C( 64),
+      UINT8_C(176), UINT8_C( 41), UINT8_C(147), UINT8_C(140), UINT8_C(239), UINT8_C(229), UINT8_C(104), UINT8_C(239),
+      UINT8_C(127), UINT8_C(254), UINT8_C( 33), UINT8_C(253), UINT8_C( 85), UINT8_C( 74), UINT8_C( 96), UINT8_C(115),
+      UINT8_C(101), UINT8_C(241), UINT8_C( 27), UINT8_C(218), UINT8_C(142), UINT8_C( 67), UINT8_C( 19), UINT8_C(250),
+      UINT8_C(239), UINT8_C(115), UINT8_C(118), UINT8_C( 14), UINT8_C( 31), UINT8_C( 82), UINT8_C( 78), UINT8_C(207),
+      UINT8_C(123), UINT8_C(225), UINT8_C( 91), UINT8_C(106), UINT8_C(198), UINT8_C(195), UINT8_C( 89), UINT8_C( 70),
+      UINT8_C(194), UINT8_C(123), UINT8_C( 67), UINT8_C( 23), UINT8_C(197), UINT8_C(164), UINT8_C(138), UINT8_C( 42),
+      UINT8_C(149), UINT8_C(165), UINT8_C(  4), UINT8_C( 35), UINT8_C(232), UINT8_C( 23), UINT8_C( 29), UINT8_C(216),
+      UINT8_C(139), UINT8_C(147), UINT8_C(230), UINT8_C(170), UINT8_C(229), UINT8_C( 52), UINT8_C(122), UINT8_C( 97),
+      UINT8_C( 21), UINT8_C(213), UINT8_C(203), UINT8_C(220), UINT8_C(153), UINT8_C( 37), UINT8_C( 34), UINT8_C( 91),
+      UINT8_C(160), UINT8_C(101), UINT8_C(114), UINT8_C(101), UINT8_C(  9), UINT8_C(252), UINT8_C(143), UINT8_C(159),
+      UINT8_C(161), UINT8_C(148), UINT8_C(194), UINT8_C(138), UINT8_C(171), UINT8_C(224), UINT8_C( 98), UINT8_C( 54),
+      UINT8_C(115), UINT8_C( 72), UINT8_C(225), UINT8_C( 89), UINT8_C(124), UINT8_C( 91), UINT8_C(186), UINT8_C(145),
+      UINT8_C( 48), UINT8_C(133), UINT8_C(109), UINT8_C(201), UINT8_C(170), UINT8_C(143), UINT8_C( 36), UINT8_C( 74),
+      UINT8_C(245), UINT8_C(150), UINT8_C(175), UINT8_C(254), UINT8_C(146), UINT8_C( 63), UINT8_C(157), UINT8_C( 52),
+      UINT8_C(211), UINT8_C( 96), UINT8_C(190), UINT8_C(126), UINT8_C( 64), UINT8_C( 32), UINT8_C(181), UINT8_C(179),
+      UINT8_C(104), UINT8_C(150), UINT8_C( 12), UINT8_C(228), UINT8_C(241), UINT8_C(198), UINT8_C(117), UINT8_C( 33),
+      UINT8_C( 76), UINT8_C(227), UINT8_C(235), UINT8_C(246), UINT8_C(114), UINT8_C( 15), UINT8_C( 65), UINT8_C(103),
+      UINT8_C(166), UINT8_C(240), UINT8_C(102), UINT8_C( 56), UINT8_C( 47), UINT8_C(  3), UINT8_C(108), UINT8_C(  2),
+      UINT8_C( 99), UINT8_C( 42), UINT8_C(129), UINT8_C(163), UINT8_C( 74), UINT8_C( 54), UINT8_C( 87), UINT8_C(178),
+      UINT8_C(204), UINT8_C( 99), UINT8_C(150), UINT8_C(189), UINT8_C( 42), UINT8_C( 12), UINT8_C(222), UINT8_C(118),
+      UINT8_C(239), UINT8_C(201), UINT8_C(108), UINT8_C( 97), UINT8_C(217), UINT8_C(173), UINT8_C(201), UINT8_C(127),
+      UINT8_C(158), UINT8_C( 47), UINT8_C(183), UINT8_C(205), UINT8_C( 50), UINT8_C( 36), UINT8_C(208), UINT8_C(150),
+      UINT8_C( 78), UINT8_C( 81), UINT8_C( 57), UINT8_C(153), UINT8_C(135), UINT8_C(144), UINT8_C( 75), UINT8_C( 83),
+      UINT8_C(244), UINT8_C(226), UINT8_C( 16), UINT8_C( 30), UINT8_C(238), UINT8_C(238), UINT8_C(148), UINT8_C(221),
+      UINT8_C(184), UINT8_C(  0), UINT8_C( 62), UINT8_C(145), UINT8_C(174), UINT8_C(  7), UINT8_C( 16), UINT8_C( 76),
+      UINT8_C( 54), UINT8_C(199), UINT8_C( 25), UINT8_C(105), UINT8_C(235), UINT8_C(233),    UINT8_MAX, UINT8_C( 58),
+      UINT8_C( 58), UINT8_C( 56), UINT8_C(211), UINT8_C(193), UINT8_C(201), UINT8_C( 30), UINT8_C( 20), UINT8_C(189),
+      UINT8_C(  0), UINT8_C( 36), UINT8_C(219), UINT8_C(238), UINT8_C( 19), UINT8_C(111), UINT8_C(203), UINT8_C(203),
+      UINT8_C(111), UINT8_C( 10), UINT8_C( 92), UINT8_C( 29), UINT8_C( 17), UINT8_C(108), UINT8_C(105), UINT8_C( 72),
+      UINT8_C( 51), UINT8_C(131), UINT8_C(177), UINT8_C( 31), UINT8_C(108), UINT8_C(176), UINT8_C( 89), UINT8_C(167),
+      UINT8_C(232), UINT8_C( 44), UINT8_C(104), UINT8_C(177), UINT8_C( 74), UINT8_C(125), UINT8_C(110), UINT8_C( 75),
+      UINT8_C(161), UINT8_C( 73), UINT8_C( 57), UINT8_C(180), UINT8_C(184), UINT8_C(  5), UINT8_C(127), UINT8_C( 40),
+      UINT8_C( 15), UINT8_C(219), UINT8_C( 69), UINT8_C( 32), UINT8_C( 71), UINT8_C(175), UINT8_C(104), UINT8_C(123),
+      UINT8_C( 50), UINT8_C( 25), UINT8_C(154), UINT8_C(158), UINT8_C(201), UINT8_C(243), UINT8_C( 69), UINT8_C(178),
+      UINT8_C( 31), UINT8_C(174), UINT8_C( 99), UINT8_C(105), UINT8_C( 43), UINT8_C(210), UINT8_C(180), UINT8_C(204),
+      UINT8_C( 27), UINT8_C(238), UINT8_C(129), UINT8_C(212), UINT8_C(243), UINT8_C(  0), UINT8_C(252), UINT8_C(  2),
+      UINT8_C(220), UINT8_C( 65), UINT8_C( 34), UINT8_C( 35), UINT8_C(240), UINT8_C(139), UINT8_C(158), UINT8_C( 34),
+      UINT8_C(164), UINT8_C( 56), UINT8_C(193), UINT8_C(110), UINT8_C( 43), UINT8_C(  6), UINT8_C( 32), UINT8_C( 74),
+      UINT8_C(180), UINT8_C(131), UINT8_C(180), UINT8_C(223), UINT8_C( 85), UINT8_C(104), UINT8_C(172), UINT8_C(113),
+      UINT8_C( 86), UINT8_C( 45), UINT8_C( 69), UINT8_C( 73), UINT8_C( 45), UINT8_C( 65), UINT8_C( 75), UINT8_C(  9),
+      UINT8_C(130), UINT8_C(110), UINT8_C( 45), UINT8_C(115), UINT8_C(249), UINT8_C(203), UINT8_C(149), UINT8_C(157),
+      UINT8_C(  4), UINT8_C( 86), UINT8_C( 11), UINT8_C( 47), UINT8_C( 93), UINT8_C( 43), UINT8_C(122), UINT8_C( 17),
+      UINT8_C(175), UINT8_C( 46), UINT8_C(241), UINT8_C(  4), UINT8_C(150), UINT8_C(157), UINT8_C(117), UINT8_C(237),
+      UINT8_C(202), UINT8_C(186), UINT8_C( 54), UINT8_C(247), UINT8_C(251), UINT8_C(130), UINT8_C(  1), UINT8_C(126),
+      UINT8_C(240), UINT8_C( 46), UINT8_C(241), UINT8_C(233), UINT8_C(249), UINT8_C(134), UINT8_C(134), UINT8_C(253),
+      UINT8_C(221), UINT8_C(146), UINT8_C( 45), UINT8_C( 58), UINT8_C(189), UINT8_C(167), UINT8_C( 75), UINT8_C(108),
+      UINT8_C(213), UINT8_C( 60), UINT8_C(113), UINT8_C(107), UINT8_C(217), UINT8_C(230), UINT8_C( 88), UINT8_C(163),
+      UINT8_C(161), UINT8_C(143), UINT8_C(155), UINT8_C(156), UINT8_C( 17), UINT8_C(156), UINT8_C( 26), UINT8_C(  1),
+      UINT8_C(202), UINT8_C( 11), UINT8_C(234), UINT8_C(195), UINT8_C(146), UINT8_C(112), UINT8_C(193), UINT8_C(111),
+      UINT8_C(  2), UINT8_C(238), UINT8_C(169), UINT8_C(192), UINT8_C(149), UINT8_C(244), UINT8_C( 44), UINT8_C(106),
+      UINT8_C( 49), UINT8_C(157), UINT8_C(213), UINT8_C( 10), UINT8_C(132), UINT8_C( 46), UINT8_C(174), UINT8_C( 37),
+      UINT8_C(189), UINT8_C( 73), UINT8_C(193), UINT8_C(206), UINT8_C(229), UINT8_C(220), UINT8_C(207), UINT8_C(175),
+      UINT8_C(231), UINT8_C(185), UINT8_C(114), UINT8_C(121), UINT8_C( 41), UINT8_C( 51), UINT8_C(232), UINT8_C( 44),
+      UINT8_C( 33), UINT8_C(145), UINT8_C(236), UINT8_C(182), UINT8_C(134), UINT8_C( 24), UINT8_C( 32), UINT8_C(183),
+      UINT8_C(182), UINT8_C(246), UINT8_C(193), UINT8_C( 58), UINT8_C( 36), UINT8_C(111), UINT8_C( 95), UINT8_C(225),
+      UINT8_C(184), UINT8_C( 32), UINT8_C(175), UINT8_C(157), UINT8_C(252), UINT8_C(126), UINT8_C( 76), UINT8_C(228),
+      UINT8_C( 55), UINT8_C(191), UINT8_C( 93), UINT8_C( 96), UINT8_C(242), UINT8_C( 70), UINT8_C(140), UINT8_C( 20),
+      UINT8_C(215), UINT8_C(120), UINT8_C(202), UINT8_C( 93), UINT8_C(145), UINT8_C(235) };
+  static const uint8_t b[] =
+    { UINT8_C(222), UINT8_C(133), UINT8_C(247), UINT8_C( 26), UINT8_C(201), UINT8_C(249), UINT8_C(  5), UINT8_C(164),
+      UINT8_C( 66), UINT8_C(  8), UINT8_C(148), UINT8_C( 28), UINT8_C(  2), UINT8_C(162), UINT8_C(133), UINT8_C( 79),
+      UINT8_C(208), UINT8_C( 84), UINT8_C( 29), UINT8_C( 57), UINT8_C(153), UINT8_C( 10), UINT8_C( 10), UINT8_C(218),
+      UINT8_C(115), UINT8_C(  5), UINT8_C( 37), UINT8_C(155), UINT8_C(116), UINT8_C(253), UINT8_C(194), UINT8_C( 83),
+      UINT8_C(130), UINT8_C(185), UINT8_C(109), UINT8_C( 75), UINT8_C(179), UINT8_C(114), UINT8_C(239), UINT8_C(245),
+      UINT8_C(123), UINT8_C(131), UINT8_C( 17), UINT8_C(125), UINT8_C( 38), UINT8_C(150), UINT8_C(205), UINT8_C(246),
+      UINT8_C(234), UINT8_C(234), UINT8_C( 48), UINT8_C(131), UINT8_C(245), UINT8_C( 58), UINT8_C( 94), UINT8_C(104),
+      UINT8_C( 64), UINT8_C(131), UINT8_C(  3), UINT8_C(180), UINT8_C(128), UINT8_C(197), UINT8_C(  7), UINT8_C(  2),
+      UINT8_C(127), UINT8_C(117), UINT8_C( 78), UINT8_C( 50), UINT8_C(231), UINT8_C( 61), UINT8_C( 39), UINT8_C( 98),
+      UINT8_C(193), UINT8_C( 56), UINT8_C(224), UINT8_C(231), UINT8_C(206), UINT8_C(173), UINT8_C(221), UINT8_C(184),
+      UINT8_C(151), UINT8_C( 13), UINT8_C( 59), UINT8_C(140), UINT8_C( 72), UINT8_C(153), UINT8_C(244), UINT8_C(136),
+      UINT8_C( 28), UINT8_C(248), UINT8_C( 60), UINT8_C(156), UINT8_C(189), UINT8_C( 68), UINT8_C(159), UINT8_C( 60),
+      UINT8_C(185), UINT8_C(237), UINT8_C(110), UINT8_C(160), UINT8_C( 42), UINT8_C(149), UINT8_C(  3), UINT8_C(235),
+      UINT8_C(205), UINT8_C(227), UINT8_C(210), UINT8_C(155), UINT8_C(144), UINT8_C(176), UINT8_C( 83), UINT8_C( 39),
+      UINT8_C(189), UINT8_C(143), UINT8_C(180), UINT8_C(  5), UINT8_C( 40), UINT8_C(168), UINT8_C(141), UINT8_C( 69),
+      UINT8_C(160), UINT8_C(202), UINT8_C(225), UINT8_C( 94), UINT8_C( 14), UINT8_C(128), UINT8_C(154), UINT8_C(199),
+      UINT8_C(109), UINT8_C(  9), UINT8_C(103), UINT8_C(152), UINT8_C(158), UINT8_C(106), UINT8_C(131), UINT8_C(108),
+      UINT8_C( 77), UINT8_C( 86), UINT8_C(  7), UINT8_C(221), UINT8_C(  6), UINT8_C( 91), UINT8_C(  5), UINT8_C(195),
+      UINT8_C(234), UINT8_C(185), UINT8_C(201), UINT8_C( 18), UINT8_C( 97), UINT8_C( 86), UINT8_C( 87), UINT8_C(  2),
+      UINT8_C( 32), UINT8_C( 57), UINT8_C( 96), UINT8_C( 46), UINT8_C(185), UINT8_C(250), UINT8_C(245), UINT8_C( 39),
+      UINT8_C(  3), UINT8_C( 93), UINT8_C(191), UINT8_C(162), UINT8_C(199), UINT8_C( 66), UINT8_C( 14), UINT8_C( 21),
+      UINT8_C(152), UINT8_C( 21), UINT8_C(242), UINT8_C(158), UINT8_C(112), UINT8_C(247), UINT8_C( 98), UINT8_C( 90),
+      UINT8_C(176), UINT8_C( 43), UINT8_C(109), UINT8_C( 18), UINT8_C(129), UINT8_C(196), UINT8_C( 20), UINT8_C(162),
+      UINT8_C(253), UINT8_C(116), UINT8_C(208), UINT8_C(183), UINT8_C(110), UINT8_C(198), UINT8_C(222), UINT8_C(114),
+      UINT8_C( 35), UINT8_C(157), UINT8_C( 20), UINT8_C(234), UINT8_C(223), UINT8_C( 34),    UINT8_MAX, UINT8_C(120),
+      UINT8_C( 55), UINT8_C(242), UINT8_C( 22), UINT8_C(168), UINT8_C(233), UINT8_C(120), UINT8_C(  2), UINT8_C(154),
+      UINT8_C(163), UINT8_C(111), UINT8_C(172), UINT8_C( 37), UINT8_C( 52), UINT8_C(192), UINT8_C(199), UINT8_C( 49),
+      UINT8_C( 52), UINT8_C(151), UINT8_C(232), UINT8_C(162), UINT8_C( 93), UINT8_C(198), UINT8_C( 20), UINT8_C(128),
+      UINT8_C( 99), UINT8_C( 40), UINT8_C(107), UINT8_C( 67), UINT8_C( 74), UINT8_C(106), UINT8_C(187), UINT8_C(130),
+      UINT8_C( 92), UINT8_C(209), UINT8_C( 42), UINT8_C( 70), UINT8_C( 74), UINT8_C( 44), UINT8_C(224), UINT8_C(237),
+      UINT8_C(156), UINT8_C(140), UINT8_C( 18), UINT8_C(208), UINT8_C( 76), UINT8_C(217), UINT8_C(  1), UINT8_C(128),
+      UINT8_C(113), UINT8_C(234), UINT8_C( 34), UINT8_C(206), UINT8_C(176), UINT8_C( 55), UINT8_C( 79), UINT8_C( 20),
+      UINT8_C( 95), UINT8_C(186), UINT8_C( 87), UINT8_C(170), UINT8_C( 36), UINT8_C( 18), UINT8_C( 44), UINT8_C(129),
+      UINT8_C(227), UINT8_C( 86), UINT8_C(199), UINT8_C( 45), UINT8_C(130), UINT8_C(167), UINT8_C( 27), UINT8_C( 30),
+      UINT8_C( 51), UINT8_C( 45), UINT8_C(238), UINT8_C(127), UINT8_C(  7), UINT8_C(240),    UINT8_MAX, UINT8_C(120),
+      UINT8_C(218), UINT8_C( 33), UINT8_C( 70), UINT8_C(138), UINT8_C( 88), UINT8_C(149), UINT8_C(158), UINT8_C(184),
+      UINT8_C( 79), UINT8_C(245), UINT8_C( 98), UINT8_C(116), UINT8_C(  7), UINT8_C(142), UINT8_C(245), UINT8_C(235),
+      UINT8_C(228), UINT8_C(188), UINT8_C( 24), UINT8_C(102), UINT8_C( 99), UINT8_C( 51), UINT8_C(133), UINT8_C(150),
+      UINT8_C( 97), UINT8_C(115), UINT8_C( 21), UINT8_C(104), UINT8_C( 99), UINT8_C( 20), UINT8_C(224), UINT8_C( 61),
+      UINT8_C( 53), UINT8_C( 38), UINT8_C(200), UINT8_C(142), UINT8_C(188), UINT8_C(102), UINT8_C( 70), UINT8_C( 11),
+      UINT8_C( 92), UINT8_C(168), UINT8_C(127), UINT8_C( 99), UINT8_C( 54), UINT8_C(116), UINT8_C( 78), UINT8_C( 26),
+      UINT8_C( 48), UINT8_C(103), UINT8_C(128), UINT8_C(147), UINT8_C(154), UINT8_C(  5), UINT8_C( 41), UINT8_C(251),
+      UINT8_C(121), UINT8_C( 62), UINT8_C( 99), UINT8_C(220), UINT8_C( 82), UINT8_C( 67), UINT8_C( 26), UINT8_C(136),
+      UINT8_C(106), UINT8_C(226), UINT8_C( 22), UINT8_C( 38), UINT8_C( 72), UINT8_C( 92), UINT8_C( 49), UINT8_C(164),
+      UINT8_C(  4), UINT8_C(177), UINT8_C(  8), UINT8_C( 58), UINT8_C( 37), UINT8_C( 86), UINT8_C( 84), UINT8_C( 86),
+      UINT8_C(189), UINT8_C(212), UINT8_C(233), UINT8_C( 88), UINT8_C(218), UINT8_C( 19), UINT8_C( 83), UINT8_C( 83),
+      UINT8_C( 81), UINT8_C(183), UINT8_C( 47), UINT8_C(164), UINT8_C(250), UINT8_C( 73), UINT8_C( 44), UINT8_C(100),
+      UINT8_C( 43), UINT8_C( 66), UINT8_C(138), UINT8_C(116), UINT8_C(158), UINT8_C(188), UINT8_C( 24), UINT8_C(162),
+      UINT8_C(109), UINT8_C( 32), UINT8_C(220), UINT8_C(146), UINT8_C(119), UINT8_C( 48), UINT8_C(232), UINT8_C( 52),
+      UINT8_C(  4), UINT8_C(210), UINT8_C(140), UINT8_C(222), UINT8_C(229), UINT8_C(224), UINT8_C( 49), UINT8_C( 54),
+      UINT8_C(151), UINT8_C( 97), UINT8_C(218), UINT8_C(145), UINT8_C(170), UINT8_C(  6), UINT8_C(246), UINT8_C(214),
+      UINT8_C( 72), UINT8_C(128), UINT8_C( 74), UINT8_C(230), UINT8_C( 60), UINT8_C( 98), UINT8_C(136), UINT8_C(169),
+      UINT8_C(131), UINT8_C(100), UINT8_C( 60), UINT8_C(250), UINT8_C(148), UINT8_C( 36), UINT8_C( 46), UINT8_C(153),
+      UINT8_C(246), UINT8_C(187), UINT8_C(119), UINT8_C(219), UINT8_C(155), UINT8_C(169), UINT8_C( 18), UINT8_C( 50),
+      UINT8_C( 10), UINT8_C(236), UINT8_C(195), UINT8_C(180), UINT8_C(243), UINT8_C(185), UINT8_C(138), UINT8_C( 59),
+      UINT8_C( 58), UINT8_C(212), UINT8_C( 34), UINT8_C(118), UINT8_C( 55), UINT8_C(170), UINT8_C( 32), UINT8_C(186),
+      UINT8_C( 15), UINT8_C( 92), UINT8_C(180), UINT8_C(163), UINT8_C(128), UINT8_C(226), UINT8_C( 60), UINT8_C(119),
+      UINT8_C(157), UINT8_C(180), UINT8_C( 82), UINT8_C( 56), UINT8_C( 93), UINT8_C(100), UINT8_C(106), UINT8_C(103),
+      UINT8_C( 81), UINT8_C( 46), UINT8_C( 27), UINT8_C( 68), UINT8_C(231), UINT8_C(166), UINT8_C(127), UINT8_C( 33),
+      UINT8_C(122), UINT8_C(161), UINT8_C(152), UINT8_C(177), UINT8_C( 76), UINT8_C(184), UINT8_C(107), UINT8_C( 91),
+      UINT8_C( 20), UINT8_C( 31), UINT8_C(254), UINT8_C(148), UINT8_C(  2), UINT8_C( 59), UINT8_C( 11), UINT8_C(159),
+      UINT8_C(239), UINT8_C( 94), UINT8_C(216), UINT8_C( 76), UINT8_C(194), UINT8_C( 66), UINT8_C(179), UINT8_C( 19),
+      UINT8_C(112), UINT8_C(206), UINT8_C( 87), UINT8_C( 88), UINT8_C(116), UINT8_C(215), UINT8_C(121), UINT8_C(239),
+      UINT8_C(120), UINT8_C( 17), UINT8_C(160), UINT8_C(196), UINT8_C(201), UINT8_C( 12), UINT8_C( 31), UINT8_C(221),
+      UINT8_C( 43), UINT8_C( 30), UINT8_C(114), UINT8_C( 45), UINT8_C( 89), UINT8_C(125), UINT8_C(205), UINT8_C( 72),
+      UINT8_C(219), UINT8_C(165), UINT8_C(148), UINT8_C(158), UINT8_C(231), UINT8_C( 71), UINT8_C(177), UINT8_C( 88),
+      UINT8_C( 21), UINT8_C(  9), UINT8_C(176), UINT8_C(138), UINT8_C(224), UINT8_C( 41), UINT8_C(121), UINT8_C( 88),
+      UINT8_C( 59), UINT8_C( 25), UINT8_C( 29), UINT8_C(  4), UINT8_C( 37), UINT8_C( 60), UINT8_C(226), UINT8_C( 81),
+      UINT8_C( 90), UINT8_C( 84), UINT8_C(126), UINT8_C(179), UINT8_C(209), UINT8_C( 75), UINT8_C(251), UINT8_C(173),
+      UINT8_C(240), UINT8_C(143), UINT8_C( 75), UINT8_C(216), UINT8_C(214), UINT8_C(252), UINT8_C( 48), UINT8_C(236),
+      UINT8_C(  5), UINT8_C(224), UINT8_C(118), UINT8_C(229), UINT8_C(  9), UINT8_C(239) };
+  static const uint8_t c[] =
+    { UINT8_C( 12), UINT8_C(115), UINT8_C(  9), UINT8_C(204), UINT8_C(223), UINT8_C(  3), UINT8_C( 24), UINT8_C( 62),
+      UINT8_C(217), UINT8_C(253), UINT8_C(152), UINT8_C( 53), UINT8_C( 16), UINT8_C( 85), UINT8_C( 41), UINT8_C( 67),
+      UINT8_C(251), UINT8_C( 17), UINT8_C(196), UINT8_C(199), UINT8_C(178), UINT8_C(226), UINT8_C( 68), UINT8_C( 60),
+      UINT8_C(252), UINT8_C(200), UINT8_C(236), UINT8_C(160), UINT8_C( 88), UINT8_C(150), UINT8_C(172), UINT8_C(101),
+      UINT8_C( 10), UINT8_C(181), UINT8_C( 49), UINT8_C(233), UINT8_C(184), UINT8_C( 73), UINT8_C( 39), UINT8_C(146),
+      UINT8_C( 71), UINT8_C(192), UINT8_C(199), UINT8_C( 87), UINT8_C( 21), UINT8_C(241), UINT8_C(154), UINT8_C( 17),
+      UINT8_C(  2), UINT8_C( 95), UINT8_C(216), UINT8_C(180), UINT8_C( 65), UINT8_C( 28), UINT8_C(241), UINT8_C( 61),
+      UINT8_C(229), UINT8_C(221), UINT8_C(221), UINT8_C( 61), UINT8_C(115), UINT8_C(137), UINT8_C(162), UINT8_C(125),
+      UINT8_C( 62), UINT8_C(211), UINT8_C(102), UINT8_C(246), UINT8_C( 29), UINT8_C(142), UINT8_C(136), UINT8_C(100),
+      UINT8_C( 78), UINT8_C( 80), UINT8_C(187), UINT8_C( 99), UINT8_C( 65), UINT8_C( 86), UINT8_C(116), UINT8_C( 67),
+      UINT8_C(181), UINT8_C( 77), UINT8_C(248), UINT8_C(246), UINT8_C(105), UINT8_C(233), UINT8_C( 51), UINT8_C( 78),
+      UINT8_C(198), UINT8_C( 16), UINT8_C(140), UINT8_C( 57), UINT8_C(153), UINT8_C( 46), UINT8_C(183), UINT8_C(215),
+      UINT8_C(  2), UINT8_C( 29), UINT8_C(205), UINT8_C( 31), UINT8_C(171), UINT8_C( 86), UINT8_C(131), UINT8_C(249),
+      UINT8_C(166), UINT8_C( 62), UINT8_C( 93), UINT8_C(231), UINT8_C(148), UINT8_C(209), UINT8_C( 42), UINT8_C( 73),
+      UINT8_C( 30), UINT8_C( 34), UINT8_C( 63), UINT8_C(136), UINT8_C( 11), UINT8_C(114), UINT8_C(214), UINT8_C(209),
+      UINT8_C(130), UINT8_C( 98), UINT8_C( 11), UINT8_C( 27), UINT8_C(145), UINT8_C(194), UINT8_C(242), UINT8_C(147),
+      UINT8_C(223), UINT8_C(192), UINT8_C(178), UINT8_C(139), UINT8_C( 22), UINT8_C( 53), UINT8_C(132), UINT8_C(188),
+      UINT8_C(115), UINT8_C(225), UINT8_C(163), UINT8_C(  8), UINT8_C(179), UINT8_C(205), UINT8_C( 81), UINT8_C(209),
+      UINT8_C(240), UINT8_C(145), UINT8_C( 89), UINT8_C(251), UINT8_C(  3), UINT8_C( 48), UINT8_C(205), UINT8_C(134),
+      UINT8_C(146), UINT8_C(216), UINT8_C(161), UINT8_C( 35), UINT8_C(154), UINT8_C(148), UINT8_C(182), UINT8_C(121),
+      UINT8_C( 84), UINT8_C(104), UINT8_C(  4), UINT8_C(106), UINT8_C(157), UINT8_C(137), UINT8_C( 38), UINT8_C( 17),
+      UINT8_C(106), UINT8_C(201), UINT8_C( 25), UINT8_C( 29), UINT8_C(150), UINT8_C(106), UINT8_C(239), UINT8_C(134),
+      UINT8_C(251), UINT8_C( 72), UINT8_C(130),    UINT8_MAX, UINT8_C(120), UINT8_C( 79), UINT8_C(133), UINT8_C( 11),
+      UINT8_C( 39), UINT8_C( 38), UINT8_C( 46), UINT8_C(193), UINT8_C(186), UINT8_C(229), UINT8_C( 58), UINT8_C( 14),
+      UINT8_C( 77), UINT8_C( 63), UINT8_C(120), UINT8_C(235), UINT8_C(200), UINT8_C(158), UINT8_C(252), UINT8_C( 50),
+      UINT8_C(103), UINT8_C( 21), UINT8_C( 80), UINT8_C(254), UINT8_C(127), UINT8_C( 63), UINT8_C(132), UINT8_C(123),
+      UINT8_C(135), UINT8_C(  6), UINT8_C(122), UINT8_C(  0), UINT8_C( 85),    UINT8_MAX, UINT8_C( 11), UINT8_C(124),
+      UINT8_C( 37), UINT8_C( 57), UINT8_C( 61), UINT8_C(224), UINT8_C( 30), UINT8_C(120), UINT8_C(238), UINT8_C(108),
+      UINT8_C(183), UINT8_C(103), UINT8_C( 87), UINT8_C(127), UINT8_C(  5), UINT8_C( 83), UINT8_C(177), UINT8_C(109),
+      UINT8_C(104), UINT8_C(  1), UINT8_C(107), UINT8_C(231), UINT8_C( 64), UINT8_C(239), UINT8_C( 98), UINT8_C(200),
+      UINT8_C(246), UINT8_C(220), UINT8_C(200), UINT8_C( 75), UINT8_C(219), UINT8_C(211), UINT8_C(200), UINT8_C(  1),
+      UINT8_C( 12), UINT8_C(  5), UINT8_C(225), UINT8_C( 43), UINT8_C(125), UINT8_C(207), UINT8_C(151), UINT8_C( 52),
+      UINT8_C( 54), UINT8_C(238), UINT8_C(179), UINT8_C( 60), UINT8_C( 65), UINT8_C(101), UINT8_C(169), UINT8_C(169),
+      UINT8_C(102), UINT8_C( 20), UINT8_C(144), UINT8_C(167), UINT8_C(  3), UINT8_C(243), UINT8_C(111), UINT8_C(249),
+      UINT8_C(207), UINT8_C( 55), UINT8_C( 69), UINT8_C(171), UINT8_C( 10), UINT8_C( 13), UINT8_C(172), UINT8_C( 22),
+      UINT8_C( 18), UINT8_C(141), UINT8_C( 65), UINT8_C(144), UINT8_C( 92), UINT8_C(216), UINT8_C(196), UINT8_C(147),
+      UINT8_C(198), UINT8_C(120), UINT8_C(207), UINT8_C(  7), UINT8_C(221), UINT8_C(120), UINT8_C(176), UINT8_C( 67),
+      UINT8_C(140), UINT8_C( 65), UINT8_C(234), UINT8_C(143), UINT8_C( 52), UINT8_C( 89), UINT8_C(137), UINT8_C(  3),
+      UINT8_C(144), UINT8_C(206), UINT8_C(174), UINT8_C(154), UINT8_C(219), UINT8_C( 90), UINT8_C(177), UINT8_C(237),
+      UINT8_C(231), UINT8_C(242), UINT8_C(125), UINT8_C( 68), UINT8_C(203), UINT8_C( 66), UINT8_C(215), UINT8_C(145),
+      UINT8_C(186), UINT8_C(166), UINT8_C(153), UINT8_C(151), UINT8_C( 30), UINT8_C( 73), UINT8_C(218), UINT8_C(170),
+      UINT8_C(138), UINT8_C(197), UINT8_C( 57), UINT8_C(190), UINT8_C( 30), UINT8_C(194), UINT8_C(194), UINT8_C(175),
+      UINT8_C(144), UINT8_C(112), UINT8_C( 73), UINT8_C(107), UINT8_C(203), UINT8_C(250), UINT8_C( 89), UINT8_C(178),
+      UINT8_C(237), UINT8_C(214), UINT8_C(246), UINT8_C(184), UINT8_C( 24), UINT8_C(205), UINT8_C( 73), UINT8_C(210),
+      UINT8_C(115), UINT8_C(226), UINT8_C(105), UINT8_C(145), UINT8_C( 44), UINT8_C( 68), UINT8_C( 59), UINT8_C(182),
+      UINT8_C(  9), UINT8_C(117), UINT8_C(117), UINT8_C( 39), UINT8_C( 55), UINT8_C( 55), UINT8_C(214), UINT8_C(200),
+      UINT8_C(167), UINT8_C( 32), UINT8_C( 51), UINT8_C(114), UINT8_C( 26), UINT8_C(140), UINT8_C( 37), UINT8_C(  7),
+      UINT8_C( 99), UINT8_C( 27), UINT8_C(191), UINT8_C(123), UINT8_C(233), UINT8_C(  9), UINT8_C( 78), UINT8_C( 92),
+      UINT8_C(235), UINT8_C(183), UINT8_C(238), UINT8_C( 23), UINT8_C(251), UINT8_C( 41), UINT8_C(206), UINT8_C(  4),
+      UINT8_C(158), UINT8_C( 67), UINT8_C( 44), UINT8_C(214), UINT8_C(122), UINT8_C(  2), UINT8_C(158), UINT8_C( 33),
+      UINT8_C( 34), UINT8_C(209), UINT8_C(148), UINT8_C( 61), UINT8_C( 94), UINT8_C(185), UINT8_C( 68), UINT8_C(193),
+      UINT8_C(212), UINT8_C(  4), UINT8_C( 60), UINT8_C(189), UINT8_C( 13), UINT8_C(138), UINT8_C( 26), UINT8_C(248),
+      UINT8_C( 66), UINT8_C(  8), UINT8_C( 16), UINT8_C( 61), UINT8_C( 49), UINT8_C(222), UINT8_C( 66), UINT8_C(208),
+      UINT8_C( 33), UINT8_C(110), UINT8_C(166), UINT8_C(155), UINT8_C(112), UINT8_C( 68), UINT8_C(188), UINT8_C(147),
+      UINT8_C( 21), UINT8_C( 80), UINT8_C(208), UINT8_C(115), UINT8_C(  9), UINT8_C( 20), UINT8_C( 52), UINT8_C(222),
+      UINT8_C( 24), UINT8_C(113), UINT8_C(155), UINT8_C( 37), UINT8_C(251), UINT8_C(181), UINT8_C( 30), UINT8_C( 61),
+      UINT8_C(189), UINT8_C( 46), UINT8_C(123), UINT8_C(239), UINT8_C( 12), UINT8_C(189), UINT8_C(191), UINT8_C( 45),
+      UINT8_C( 43), UINT8_C(101), UINT8_C(200), UINT8_C(155), UINT8_C(169), UINT8_C(132), UINT8_C( 46), UINT8_C(190),
+      UINT8_C(213), UINT8_C(254), UINT8_C( 50), UINT8_C(222), UINT8_C( 19), UINT8_C(102), UINT8_C(188), UINT8_C( 43),
+      UINT8_C(215), UINT8_C( 88), UINT8_C( 81), UINT8_C(211), UINT8_C( 13), UINT8_C(111), UINT8_C( 16), UINT8_C(203),
+      UINT8_C(157), UINT8_C(139), UINT8_C(186), UINT8_C(169), UINT8_C( 72), UINT8_C(121), UINT8_C(214), UINT8_C(115),
+      UINT8_C(222), UINT8_C(158), UINT8_C( 15), UINT8_C(135), UINT8_C( 34), UINT8_C( 61), UINT8_C( 69), UINT8_C(247),
+      UINT8_C( 60), UINT8_C(119), UINT8_C(214), UINT8_C( 79), UINT8_C(222), UINT8_C(146), UINT8_C(122), UINT8_C(181),
+      UINT8_C(234), UINT8_C(203), UINT8_C(136), UINT8_C(248), UINT8_C( 58), UINT8_C(153), UINT8_C(195), UINT8_C(215),
+      UINT8_C( 36), UINT8_C(125), UINT8_C(128), UINT8_C(109), UINT8_C(246), UINT8_C( 86), UINT8_C(224), UINT8_C(212),
+      UINT8_C(244), UINT8_C(239), UINT8_C( 91), UINT8_C( 23), UINT8_C( 45), UINT8_C(160), UINT8_C( 14), UINT8_C(105),
+      UINT8_C( 24), UINT8_C(228), UINT8_C(184), UINT8_C(246), UINT8_C(119), UINT8_C( 50), UINT8_C(171), UINT8_C( 97),
+      UINT8_C(254), UINT8_C( 52), UINT8_C( 89), UINT8_C( 56), UINT8_C(205), UINT8_C( 28), UINT8_C( 16), UINT8_C(241),
+      UINT8_C(153), UINT8_C(144), UINT8_C( 94), UINT8_C(143), UINT8_C(231), UINT8_C( 63), UINT8_C( 99), UINT8_C(219),
+      UINT8_C( 46), UINT8_C(190), UINT8_C(242), UINT8_C( 91), UINT8_C( 95), UINT8_C(  1), UINT8_C(196), UINT8_C(119),
+      UINT8_C(229), UINT8_C(124), UINT8_C(109), UINT8_C( 92), UINT8_C(175), UINT8_C( 24) };
+  static const uint8_t e[] =
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C(220), UINT8_C( 40), UINT8_C(  0), UINT8_C( 66), UINT8_C(132), UINT8_C( 58),
+      UINT8_C(155), UINT8_C(  0), UINT8_C(  0), UINT8_C(101), UINT8_C( 74), UINT8_C(153), UINT8_C( 68), UINT8_C(217),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(190), UINT8_C(  0), UINT8_C(  0), UINT8_C(146), UINT8_C( 72), UINT8_C(126),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(239), UINT8_C(  0), UINT8_C(  0), UINT8_C( 77), UINT8_C(248), UINT8_C(  0),
+      UINT8_C(242), UINT8_C(  8), UINT8_C(165), UINT8_C(  0), UINT8_C(241), UINT8_C(201), UINT8_C(106), UINT8_C(  0),
+      UINT8_C(183), UINT8_C(  0), UINT8_C(  0), UINT8_C( 16), UINT8_C(  0), UINT8_C(129), UINT8_C(178), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(136), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(178), UINT8_C(182), UINT8_C(  0), UINT8_C(  0), UINT8_C(  6), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(236), UINT8_C(  0), UINT8_C(141), UINT8_C(  0), UINT8_C(  0), UINT8_C( 36),
+      UINT8_C( 47), UINT8_C( 48), UINT8_C( 27), UINT8_C( 72), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(181), UINT8_C( 31), UINT8_C(138), UINT8_C( 78), UINT8_C(217), UINT8_C( 79), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(153), UINT8_C( 61), UINT8_C(158), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 14), UINT8_C( 89), UINT8_C(  0), UINT8_C(159), UINT8_C(  0), UINT8_C(114), UINT8_C(  0), UINT8_C(185),
+      UINT8_C(  0), UINT8_C(153), UINT8_C(243), UINT8_C(171), UINT8_C(  0), UINT8_C( 65), UINT8_C(  0), UINT8_C(178),
+      UINT8_C(225), UINT8_C(  4), UINT8_C(  0), UINT8_C(  0), UINT8_C( 83), UINT8_C(  2), UINT8_C(182), UINT8_C(  0),
+      UINT8_C(162), UINT8_C(140), UINT8_C(  0), UINT8_C( 39), UINT8_C( 85), UINT8_C(  0), UINT8_C( 96), UINT8_C(233),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 56), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(119), UINT8_C( 32), UINT8_C(  0), UINT8_C( 87), UINT8_C( 30), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(244), UINT8_C(153), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(218),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(109), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 97),
+      UINT8_C(245), UINT8_C(207), UINT8_C(158), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(210), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(229), UINT8_C(  0), UINT8_C( 29), UINT8_C(243), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 63), UINT8_C(  0), UINT8_C(  0), UINT8_C(  1), UINT8_C(  0), UINT8_C(  0), UINT8_C(169),
+      UINT8_C(  0), UINT8_C( 54), UINT8_C(206), UINT8_C(103), UINT8_C( 52), UINT8_C( 37), UINT8_C(  0), UINT8_C( 26),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 12), UINT8_C(  0), UINT8_C(  0), UINT8_C(180), UINT8_C( 66), UINT8_C(  0),
+      UINT8_C(183), UINT8_C(  0), UINT8_C(  0), UINT8_C(230), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(134), UINT8_C( 16), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 63), UINT8_C(  0), UINT8_C(112),
+      UINT8_C(  0), UINT8_C(217), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 56), UINT8_C( 18), UINT8_C(236),
+      UINT8_C(  0), UINT8_C(215), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 40), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(249), UINT8_C( 43), UINT8_C(  0), UINT8_C(  0), UINT8_C( 66), UINT8_C( 35),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(207), UINT8_C(  0), UINT8_C(  0), UINT8_C(  1),
+      UINT8_C(191), UINT8_C(  0), UINT8_C(  3), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(234), UINT8_C(  0), UINT8_C(173), UINT8_C(  0), UINT8_C( 41), UINT8_C( 61), UINT8_C(  0), UINT8_C( 31),
+      UINT8_C( 83), UINT8_C(  0), UINT8_C(  0), UINT8_C(180), UINT8_C(  0), UINT8_C(  0), UINT8_C(162), UINT8_C(219),
+      UINT8_C(  0), UINT8_C(122), UINT8_C(103), UINT8_C( 94), UINT8_C(  0), UINT8_C(205), UINT8_C(220), UINT8_C(102),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 10), UINT8_C(196), UINT8_C(  0), UINT8_C(  0), UINT8_C( 59),
+      UINT8_C( 18), UINT8_C(  0), UINT8_C(239), UINT8_C(  0), UINT8_C( 95), UINT8_C(124), UINT8_C(  0), UINT8_C( 34),
+      UINT8_C(108), UINT8_C( 65), UINT8_C(186), UINT8_C(  0), UINT8_C(126), UINT8_C(  0), UINT8_C(217), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 51), UINT8_C(187), UINT8_C(  0), UINT8_C(188), UINT8_C(142), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(233), UINT8_C(  0), UINT8_C(  0), UINT8_C( 82), UINT8_C(103), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 62), UINT8_C(  0), UINT8_C( 32), UINT8_C(149), UINT8_C(180), UINT8_C( 72),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 88), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(171), UINT8_C(  0), UINT8_C(  0), UINT8_C( 15), UINT8_C(  0), UINT8_C( 10), UINT8_C(  0), UINT8_C(106),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(230), UINT8_C(254), UINT8_C(232), UINT8_C(185), UINT8_C(  0), UINT8_C(222),
+      UINT8_C(247), UINT8_C( 91), UINT8_C( 49), UINT8_C( 89), UINT8_C(  0), UINT8_C(242), UINT8_C(  0), UINT8_C( 38),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 39), UINT8_C(  0), UINT8_C( 52), UINT8_C(142), UINT8_C(  0),
+      UINT8_C(121), UINT8_C(  0), UINT8_C(  0), UINT8_C(170), UINT8_C(  0), UINT8_C(215), UINT8_C(  1), UINT8_C(  0),
+      UINT8_C(152), UINT8_C(247), UINT8_C( 29), UINT8_C(  0), UINT8_C(  0), UINT8_C( 65), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(202),    UINT8_MAX, UINT8_C(240), UINT8_C(  0), UINT8_C(  0), UINT8_C(108),
+      UINT8_C( 14), UINT8_C(149), UINT8_C(196), UINT8_C(  0), UINT8_C(  0), UINT8_C(162), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  9), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(221), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(132), UINT8_C( 68), UINT8_C( 23), UINT8_C(249), UINT8_C( 90), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(156), UINT8_C( 60), UINT8_C(135), UINT8_C(  0), UINT8_C(  0), UINT8_C(188), UINT8_C( 49),
+      UINT8_C( 13), UINT8_C(200), UINT8_C(145), UINT8_C(252), UINT8_C(  0), UINT8_C(  0), UINT8_C( 54), UINT8_C(  0),
+      UINT8_C( 61), UINT8_C(152), UINT8_C(  0), UINT8_C(  0), UINT8_C( 80), UINT8_C( 39), UINT8_C(248), UINT8_C(  0),
+      UINT8_C(190), UINT8_C(  0), UINT8_C(157), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(147), UINT8_C(  0), UINT8_C(  0), UINT8_C( 52), UINT8_C(  0), UINT8_C(129), UINT8_C(251), UINT8_C(191),
+      UINT8_C( 91), UINT8_C(  0), UINT8_C(250), UINT8_C(147), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 58), UINT8_C(241), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(241), UINT8_C( 23),
+      UINT8_C(  0), UINT8_C( 20), UINT8_C(105), UINT8_C(  0), UINT8_C(121), UINT8_C(  0), UINT8_C(  0), UINT8_C(188),
+      UINT8_C(  0), UINT8_C(220), UINT8_C(132), UINT8_C(217), UINT8_C(  0), UINT8_C(  0), UINT8_C(244), UINT8_C(  0),
+      UINT8_C(116), UINT8_C(  0), UINT8_C(127), UINT8_C(  0), UINT8_C(198), UINT8_C(  0), UINT8_C(  0), UINT8_C( 52),
+      UINT8_C( 28), UINT8_C(251), UINT8_C( 69), UINT8_C( 79), UINT8_C(  0), UINT8_C(126), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(226), UINT8_C( 56), UINT8_C(168), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(227), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(147), UINT8_C(194), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(145), UINT8_C( 44), UINT8_C(  0), UINT8_C(  0), UINT8_C( 44), UINT8_C(197), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(205), UINT8_C(253), UINT8_C(  0), UINT8_C( 18), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 73),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(238), UINT8_C( 34),
+      UINT8_C( 73), UINT8_C( 16), UINT8_C(128), UINT8_C( 86), UINT8_C(  0), UINT8_C( 41), UINT8_C(231), UINT8_C(239),
+      UINT8_C(190), UINT8_C(  0), UINT8_C(  0), UINT8_C( 91), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(200), UINT8_C(  0) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i])),
+      cv = simde_svld1_u8(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmad_u8_z(pv, av, bv, cv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], c[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+    cv = simde_svld1_u8(pg, &(c[i]));
+
+    ev = simde_svmad_u8_z(pv, av, bv, cv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C( 75), UINT8_C( 74), UINT8_C( 43), UINT8_C(251), UINT8_C(253), UINT8_C( 86), UINT8_C(113), UINT8_C(204),
+      UINT8_C(194), UINT8_C( 27), UINT8_C( 48), UINT8_C( 92), UINT8_C(246), UINT8_C(  0), UINT8_C( 24), UINT8_C( 72),
+      UINT8_C(122), UINT8_C( 86), UINT8_C( 38), UINT8_C( 92), UINT8_C( 52), UINT8_C(223), UINT8_C(162), UINT8_C( 76),
+      UINT8_C(125), UINT8_C(103), UINT8_C( 46), UINT8_C(164), UINT8_C(254), UINT8_C(245), UINT8_C(136), UINT8_C( 73),
+      UINT8_C( 63), UINT8_C(179), UINT8_C( 69), UINT8_C( 60), UINT8_C( 10), UINT8_C(182), UINT8_C(  8), UINT8_C(204),
+      UINT8_C(209), UINT8_C( 56), UINT8_C( 40), UINT8_C(199), UINT8_C( 57), UINT8_C( 65), UINT8_C( 16), UINT8_C(179),
+      UINT8_C(151), UINT8_C( 54), UINT8_C( 15), UINT8_C(204), UINT8_C( 21), UINT8_C(178), UINT8_C( 24), UINT8_C(146),
+      UINT8_C( 25), UINT8_C( 70), UINT8_C( 54), UINT8_C( 24), UINT8_C( 60), UINT8_C(191), UINT8_C( 97), UINT8_C(123),
+      UINT8_C(114), UINT8_C(166), UINT8_C(184), UINT8_C(124), UINT8_C( 93), UINT8_C(192), UINT8_C( 72), UINT8_C( 46),
+      UINT8_C(249), UINT8_C(113), UINT8_C(246), UINT8_C( 50), UINT8_C(178), UINT8_C(  6), UINT8_C(229), UINT8_C( 73),
+      UINT8_C( 60), UINT8_C(244), UINT8_C( 21), UINT8_C( 82), UINT8_C(166), UINT8_C( 46), UINT8_C(228), UINT8_C(192),
+      UINT8_C(116), UINT8_C( 27), UINT8_C(216), UINT8_C(176), UINT8_C(218), UINT8_C( 57), UINT8_C( 44), UINT8_C( 76),
+      UINT8_C(224), UINT8_C(228), UINT8_C(201), UINT8_C( 61), UINT8_C(164), UINT8_C( 17), UINT8_C(107), UINT8_C(157),
+      UINT8_C(130), UINT8_C( 97), UINT8_C(207), UINT8_C( 52), UINT8_C(103), UINT8_C(180), UINT8_C(126), UINT8_C(164),
+      UINT8_C(169), UINT8_C(147), UINT8_C(246), UINT8_C( 79), UINT8_C(193), UINT8_C(218), UINT8_C( 15), UINT8_C( 54),
+      UINT8_C(245), UINT8_C(231), UINT8_C(230), UINT8_C(207), UINT8_C( 33), UINT8_C( 18), UINT8_C( 28), UINT8_C(  1),
+      UINT8_C(246), UINT8_C(229), UINT8_C( 62), UINT8_C(155), UINT8_C(246), UINT8_C(169), UINT8_C( 56), UINT8_C(121),
+      UINT8_C( 11), UINT8_C(  8), UINT8_C(173), UINT8_C(114), UINT8_C(188), UINT8_C( 43), UINT8_C( 22), UINT8_C(101),
+      UINT8_C(191), UINT8_C( 12), UINT8_C(181), UINT8_C(128), UINT8_C(231), UINT8_C(196), UINT8_C(182), UINT8_C(220),
+      UINT8_C(172), UINT8_C(157), UINT8_C(172), UINT8_C(205), UINT8_C(175), UINT8_C(200), UINT8_C(206), UINT8_C(166),
+      UINT8_C(173), UINT8_C( 12), UINT8_C( 65), UINT8_C(163), UINT8_C(181), UINT8_C(121), UINT8_C( 28), UINT8_C(192),
+      UINT8_C(129), UINT8_C(202), UINT8_C( 51), UINT8_C( 62), UINT8_C(245), UINT8_C( 73), UINT8_C(163), UINT8_C(180),
+      UINT8_C( 86), UINT8_C( 88), UINT8_C( 53), UINT8_C( 61), UINT8_C( 29), UINT8_C(235), UINT8_C( 25), UINT8_C(201),
+      UINT8_C(136), UINT8_C(197), UINT8_C(150), UINT8_C( 56), UINT8_C(141), UINT8_C(100), UINT8_C(222), UINT8_C( 58),
+      UINT8_C(112), UINT8_C( 31), UINT8_C(222), UINT8_C( 37), UINT8_C(152), UINT8_C(250), UINT8_C(230), UINT8_C( 26),
+      UINT8_C(196), UINT8_C( 25), UINT8_C( 88), UINT8_C(186), UINT8_C( 98), UINT8_C(251), UINT8_C(110), UINT8_C(184),
+      UINT8_C( 84), UINT8_C(163), UINT8_C(245), UINT8_C(113), UINT8_C(143), UINT8_C( 15), UINT8_C( 58), UINT8_C( 23),
+      UINT8_C(212), UINT8_C(208), UINT8_C( 79), UINT8_C( 98), UINT8_C( 52), UINT8_C( 45), UINT8_C(156), UINT8_C(164),
+      UINT8_C( 76), UINT8_C(122), UINT8_C(201), UINT8_C(229), UINT8_C(117), UINT8_C(175),    UINT8_MAX, UINT8_C( 57),
+      UINT8_C(200), UINT8_C( 87), UINT8_C(243), UINT8_C( 43), UINT8_C( 82), UINT8_C( 98), UINT8_C(227), UINT8_C(166),
+      UINT8_C(  5), UINT8_C(217), UINT8_C( 23), UINT8_C(148), UINT8_C(232), UINT8_C( 81), UINT8_C(172), UINT8_C(188),
+      UINT8_C( 33), UINT8_C(251), UINT8_C( 30), UINT8_C( 85), UINT8_C( 41), UINT8_C(187), UINT8_C(249), UINT8_C(117),
+      UINT8_C( 53), UINT8_C(195), UINT8_C( 90), UINT8_C(170), UINT8_C(114), UINT8_C( 89), UINT8_C(228), UINT8_C( 59),
+      UINT8_C(176), UINT8_C(215), UINT8_C(102), UINT8_C(  3), UINT8_C( 57), UINT8_C( 73), UINT8_C(169), UINT8_C( 63),
+      UINT8_C( 34), UINT8_C(193), UINT8_C(211), UINT8_C( 10), UINT8_C( 18), UINT8_C(127), UINT8_C(199), UINT8_C( 52),
+      UINT8_C(123), UINT8_C(229), UINT8_C(137), UINT8_C(164), UINT8_C(160), UINT8_C(131), UINT8_C( 25), UINT8_C(214),
+      UINT8_C( 70), UINT8_C(116), UINT8_C(128), UINT8_C(184), UINT8_C(205), UINT8_C(100), UINT8_C(243), UINT8_C(126),
+      UINT8_C( 60), UINT8_C( 89), UINT8_C(129), UINT8_C(117), UINT8_C(163), UINT8_C( 42), UINT8_C(180), UINT8_C(197),
+      UINT8_C(235), UINT8_C(136), UINT8_C(208), UINT8_C(254), UINT8_C(  7), UINT8_C(151), UINT8_C( 50), UINT8_C(130),
+      UINT8_C(124), UINT8_C(187), UINT8_C( 38), UINT8_C( 29), UINT8_C( 62), UINT8_C( 64), UINT8_C(243), UINT8_C(132),
+      UINT8_C(180), UINT8_C(115), UINT8_C( 61), UINT8_C(129), UINT8_C(216), UINT8_C( 48),    UINT8_MAX, UINT8_C( 20),
+      UINT8_C(138), UINT8_C(128), UINT8_C(137), UINT8_C( 45), UINT8_C(171), UINT8_C( 62), UINT8_C(242), UINT8_C(150),
+      UINT8_C(198), UINT8_C(194), UINT8_C(148), UINT8_C(205), UINT8_C( 89), UINT8_C(198), UINT8_C( 80), UINT8_C(214),
+      UINT8_C(130), UINT8_C(118), UINT8_C(243), UINT8_C(192), UINT8_C(182), UINT8_C(230), UINT8_C( 69), UINT8_C(106),
+      UINT8_C( 89), UINT8_C(130), UINT8_C(236), UINT8_C( 49), UINT8_C(178), UINT8_C(235), UINT8_C( 69), UINT8_C( 60),
+      UINT8_C(108), UINT8_C(207), UINT8_C(105), UINT8_C( 23), UINT8_C( 13), UINT8_C( 92), UINT8_C(173), UINT8_C(211),
+      UINT8_C( 30), UINT8_C( 66), UINT8_C(160), UINT8_C(120), UINT8_C(  8), UINT8_C(240), UINT8_C( 78), UINT8_C(138),
+      UINT8_C(103), UINT8_C( 65), UINT8_C( 75), UINT8_C( 29), UINT8_C( 39), UINT8_C(144), UINT8_C(136), UINT8_C(128),
+      UINT8_C( 18), UINT8_C(116), UINT8_C(178), UINT8_C(196), UINT8_C( 95), UINT8_C(247), UINT8_C(  1), UINT8_C(203),
+      UINT8_C(198), UINT8_C(106), UINT8_C(226), UINT8_C(211), UINT8_C(198), UINT8_C(144), UINT8_C(166), UINT8_C(229),
+      UINT8_C(210), UINT8_C( 71), UINT8_C( 93), UINT8_C(218), UINT8_C( 55), UINT8_C(171), UINT8_C(101), UINT8_C(158),
+      UINT8_C(236), UINT8_C(176), UINT8_C(188), UINT8_C( 19), UINT8_C( 64), UINT8_C( 68), UINT8_C(147), UINT8_C( 82),
+      UINT8_C(184), UINT8_C( 69), UINT8_C( 22), UINT8_C( 23), UINT8_C( 61), UINT8_C( 23), UINT8_C(227), UINT8_C(  3),
+      UINT8_C(130), UINT8_C(197), UINT8_C(215), UINT8_C( 72), UINT8_C( 85), UINT8_C(125), UINT8_C( 45), UINT8_C( 39),
+      UINT8_C(196), UINT8_C(138), UINT8_C(  2), UINT8_C(252), UINT8_C( 53), UINT8_C(103), UINT8_C(154), UINT8_C( 33),
+      UINT8_C( 23), UINT8_C( 86), UINT8_C( 52), UINT8_C( 87), UINT8_C(154), UINT8_C(200), UINT8_C(169), UINT8_C( 82),
+      UINT8_C( 13), UINT8_C(191), UINT8_C(106), UINT8_C( 74), UINT8_C(215), UINT8_C( 77), UINT8_C( 78), UINT8_C( 89),
+      UINT8_C( 18), UINT8_C( 37), UINT8_C(161), UINT8_C(104), UINT8_C(162), UINT8_C(207), UINT8_C(143), UINT8_C(103),
+      UINT8_C( 89), UINT8_C(145), UINT8_C( 99), UINT8_C(143), UINT8_C(248), UINT8_C(253), UINT8_C(176), UINT8_C( 15),
+      UINT8_C( 84), UINT8_C(229), UINT8_C(102), UINT8_C(238), UINT8_C(173), UINT8_C( 15), UINT8_C( 65), UINT8_C(186),
+      UINT8_C(207), UINT8_C(171), UINT8_C(  5), UINT8_C(166), UINT8_C(248), UINT8_C( 83),    UINT8_MAX, UINT8_C( 10),
+      UINT8_C(120), UINT8_C(160), UINT8_C(114), UINT8_C( 26), UINT8_C(111), UINT8_C(  2), UINT8_C(129), UINT8_C(201),
+      UINT8_C(147), UINT8_C(228), UINT8_C( 88), UINT8_C(140), UINT8_C(226), UINT8_C(  8), UINT8_C(155), UINT8_C( 54),
+      UINT8_C(237), UINT8_C(  2), UINT8_C( 36), UINT8_C(154), UINT8_C( 17), UINT8_C(101), UINT8_C( 85), UINT8_C(224),
+      UINT8_C( 16), UINT8_C( 90), UINT8_C(134), UINT8_C(  8), UINT8_C(173), UINT8_C(133), UINT8_C( 19), UINT8_C( 37),
+      UINT8_C( 38), UINT8_C(133), UINT8_C( 63), UINT8_C(149), UINT8_C(135), UINT8_C(193), UINT8_C( 94), UINT8_C( 27),
+      UINT8_C(165), UINT8_C(182), UINT8_C(167), UINT8_C(135), UINT8_C(191), UINT8_C( 66), UINT8_C(189), UINT8_C(172),
+      UINT8_C( 68), UINT8_C(226), UINT8_C( 71), UINT8_C( 86), UINT8_C( 71), UINT8_C(156), UINT8_C( 54), UINT8_C( 88),
+      UINT8_C(246), UINT8_C(189), UINT8_C( 96), UINT8_C(163), UINT8_C( 66), UINT8_C(115), UINT8_C(200), UINT8_C(104),
+      UINT8_C(249), UINT8_C(  7), UINT8_C(254), UINT8_C(128), UINT8_C(200), UINT8_C( 92), UINT8_C(155), UINT8_C(110),
+      UINT8_C( 19), UINT8_C( 66), UINT8_C(245), UINT8_C(210), UINT8_C(133), UINT8_C(179), UINT8_C(126), UINT8_C(201),
+      UINT8_C(149), UINT8_C(197), UINT8_C( 31), UINT8_C(220), UINT8_C( 97), UINT8_C( 86), UINT8_C( 52), UINT8_C( 87),
+      UINT8_C( 19), UINT8_C(149), UINT8_C(250), UINT8_C( 85), UINT8_C(  8), UINT8_C(194), UINT8_C(190), UINT8_C(  1),
+      UINT8_C(202), UINT8_C(188), UINT8_C(130), UINT8_C(146), UINT8_C( 24), UINT8_C( 29), UINT8_C(  0), UINT8_C( 43),
+      UINT8_C( 96), UINT8_C(246), UINT8_C(253), UINT8_C(229), UINT8_C(169), UINT8_C(124), UINT8_C(174), UINT8_C( 62),
+      UINT8_C( 65), UINT8_C(206), UINT8_C( 26), UINT8_C(163), UINT8_C( 36), UINT8_C( 79), UINT8_C(250), UINT8_C( 55),
+      UINT8_C(228), UINT8_C(245), UINT8_C(140), UINT8_C(236) };
+  static const uint8_t b[] =
+    { UINT8_C(163), UINT8_C(220), UINT8_C(222), UINT8_C(157), UINT8_C( 11), UINT8_C(197), UINT8_C(243), UINT8_C(152),
+      UINT8_C( 65), UINT8_C(143), UINT8_C(218), UINT8_C(155), UINT8_C(237), UINT8_C(186), UINT8_C( 46), UINT8_C( 86),
+      UINT8_C(197), UINT8_C(184), UINT8_C(113), UINT8_C(195), UINT8_C(113), UINT8_C(134), UINT8_C(119), UINT8_C( 62),
+      UINT8_C( 51), UINT8_C(231), UINT8_C(160), UINT8_C(221), UINT8_C(159), UINT8_C(233), UINT8_C( 75), UINT8_C( 67),
+      UINT8_C(197), UINT8_C( 41), UINT8_C(224), UINT8_C(208), UINT8_C(238), UINT8_C(212), UINT8_C(104), UINT8_C( 48),
+      UINT8_C( 99), UINT8_C( 67), UINT8_C(203), UINT8_C( 80), UINT8_C(253), UINT8_C(250), UINT8_C(167), UINT8_C(194),
+      UINT8_C(178), UINT8_C( 24), UINT8_C(133), UINT8_C( 36), UINT8_C(158), UINT8_C(253), UINT8_C( 98), UINT8_C(209),
+      UINT8_C(228), UINT8_C(  3), UINT8_C(174), UINT8_C(132), UINT8_C(236), UINT8_C(249), UINT8_C(199), UINT8_C(177),
+      UINT8_C( 34), UINT8_C(167), UINT8_C(129), UINT8_C( 17), UINT8_C(123), UINT8_C(234), UINT8_C( 65), UINT8_C(222),
+      UINT8_C( 45), UINT8_C( 12), UINT8_C( 47), UINT8_C( 42), UINT8_C(  6), UINT8_C(214), UINT8_C(236), UINT8_C(185),
+      UINT8_C(238), UINT8_C(114), UINT8_C(221), UINT8_C(140), UINT8_C(111), UINT8_C( 63), UINT8_C( 93), UINT8_C( 83),
+      UINT8_C( 66), UINT8_C( 12), UINT8_C(215), UINT8_C( 46), UINT8_C(  5), UINT8_C(158), UINT8_C(223), UINT8_C( 40),
+      UINT8_C( 70), UINT8_C( 97), UINT8_C( 57), UINT8_C(193), UINT8_C( 75), UINT8_C(122), UINT8_C(160), UINT8_C(120),
+      UINT8_C(134), UINT8_C(207), UINT8_C(162), UINT8_C(141), UINT8_C(165), UINT8_C(142), UINT8_C( 70), UINT8_C(147),
+      UINT8_C(  0), UINT8_C( 35), UINT8_C( 31), UINT8_C(111), UINT8_C( 98), UINT8_C(124), UINT8_C(195), UINT8_C(165),
+      UINT8_C(136), UINT8_C(154), UINT8_C(211), UINT8_C(142), UINT8_C( 57), UINT8_C(179), UINT8_C(182), UINT8_C(127),
+      UINT8_C( 20), UINT8_C(239), UINT8_C( 64), UINT8_C( 95), UINT8_C(105), UINT8_C(224), UINT8_C(215), UINT8_C(239),
+      UINT8_C(175), UINT8_C(121), UINT8_C(124), UINT8_C( 84), UINT8_C(  7), UINT8_C(194), UINT8_C(231), UINT8_C(  8),
+      UINT8_C(229), UINT8_C(  6), UINT8_C(119), UINT8_C( 72), UINT8_C(131), UINT8_C( 58), UINT8_C(237), UINT8_C( 11),
+      UINT8_C(213), UINT8_C(192), UINT8_C(153), UINT8_C( 14), UINT8_C(115), UINT8_C( 79), UINT8_C(141), UINT8_C(135),
+      UINT8_C( 62), UINT8_C(205), UINT8_C(230), UINT8_C(167), UINT8_C(174), UINT8_C(189), UINT8_C(151), UINT8_C( 93),
+      UINT8_C( 54), UINT8_C( 19), UINT8_C(178), UINT8_C( 62), UINT8_C(214), UINT8_C(153), UINT8_C( 70), UINT8_C(187),
+      UINT8_C(160), UINT8_C(189), UINT8_C(  3), UINT8_C( 35), UINT8_C(248), UINT8_C(240), UINT8_C( 46), UINT8_C(205),
+      UINT8_C(177), UINT8_C(200), UINT8_C(219), UINT8_C( 36), UINT8_C( 23), UINT8_C(104), UINT8_C(172), UINT8_C( 86),
+      UINT8_C( 53), UINT8_C(146), UINT8_C(253), UINT8_C(227), UINT8_C( 80), UINT8_C(148), UINT8_C( 65), UINT8_C(134),
+      UINT8_C(168), UINT8_C(243), UINT8_C(196), UINT8_C(126), UINT8_C(140), UINT8_C( 10), UINT8_C( 57), UINT8_C( 44),
+      UINT8_C(200), UINT8_C( 61), UINT8_C( 79), UINT8_C(192), UINT8_C( 45), UINT8_C(126), UINT8_C(141), UINT8_C(222),
+      UINT8_C( 70), UINT8_C(104), UINT8_C(  3), UINT8_C( 93), UINT8_C(208), UINT8_C(175), UINT8_C(179), UINT8_C(  5),
+      UINT8_C( 65), UINT8_C(177), UINT8_C(233), UINT8_C(145), UINT8_C( 69), UINT8_C( 42), UINT8_C( 24), UINT8_C(237),
+      UINT8_C( 29), UINT8_C(220), UINT8_C(107), UINT8_C(169), UINT8_C(231), UINT8_C(165), UINT8_C(214), UINT8_C(175),
+      UINT8_C(226), UINT8_C( 37), UINT8_C(111), UINT8_C( 15), UINT8_C(163), UINT8_C(252), UINT8_C(238), UINT8_C(233),
+      UINT8_C(100), UINT8_C(241), UINT8_C( 71), UINT8_C( 52), UINT8_C(160), UINT8_C(250), UINT8_C( 57), UINT8_C(225),
+      UINT8_C(171), UINT8_C( 34), UINT8_C(115), UINT8_C(241), UINT8_C( 76), UINT8_C(139), UINT8_C(222), UINT8_C(105),
+      UINT8_C(103), UINT8_C( 74), UINT8_C( 19), UINT8_C( 78), UINT8_C(239), UINT8_C(233), UINT8_C(253), UINT8_C(209),
+      UINT8_C( 14), UINT8_C(108), UINT8_C(224), UINT8_C(178), UINT8_C(104), UINT8_C(206), UINT8_C(155), UINT8_C(204),
+      UINT8_C(191), UINT8_C(226), UINT8_C(  0), UINT8_C( 95), UINT8_C(221), UINT8_C( 58), UINT8_C( 65), UINT8_C(136),
+      UINT8_C( 92), UINT8_C(180), UINT8_C(121), UINT8_C(169), UINT8_C( 63), UINT8_C( 88), UINT8_C( 18), UINT8_C(166),
+      UINT8_C(162), UINT8_C( 37), UINT8_C(245), UINT8_C(145), UINT8_C( 14), UINT8_C(242), UINT8_C( 98), UINT8_C( 29),
+      UINT8_C( 95), UINT8_C( 66), UINT8_C(207), UINT8_C(199), UINT8_C( 17), UINT8_C(106), UINT8_C(148), UINT8_C(208),
+      UINT8_C( 77), UINT8_C(148), UINT8_C( 48), UINT8_C( 42), UINT8_C(206), UINT8_C(113), UINT8_C(178), UINT8_C( 43),
+      UINT8_C( 37), UINT8_C( 44), UINT8_C(212), UINT8_C(100), UINT8_C(132), UINT8_C(230), UINT8_C( 10), UINT8_C( 38),
+      UINT8_C( 12),    UINT8_MAX, UINT8_C(183), UINT8_C( 26), UINT8_C(242), UINT8_C( 25), UINT8_C( 55), UINT8_C( 81),
+      UINT8_C( 91), UINT8_C(  6), UINT8_C( 24), UINT8_C(108), UINT8_C(113), UINT8_C(172), UINT8_C( 61), UINT8_C(190),
+      UINT8_C( 65), UINT8_C(109), UINT8_C(232), UINT8_C( 15), UINT8_C(222), UINT8_C(154), UINT8_C( 58), UINT8_C(  3),
+      UINT8_C(198), UINT8_C( 14), UINT8_C(103), UINT8_C( 74), UINT8_C(245), UINT8_C(113), UINT8_C(112), UINT8_C(  1),
+      UINT8_C(113), UINT8_C( 39), UINT8_C( 27), UINT8_C( 99), UINT8_C( 64), UINT8_C( 83), UINT8_C(180), UINT8_C(156),
+      UINT8_C( 89), UINT8_C(204), UINT8_C(  8), UINT8_C(202), UINT8_C(121), UINT8_C( 69), UINT8_C(136), UINT8_C(186),
+      UINT8_C(178), UINT8_C(112), UINT8_C(201), UINT8_C(144), UINT8_C( 11), UINT8_C(  4), UINT8_C(147), UINT8_C(209),
+      UINT8_C( 18), UINT8_C(250), UINT8_C( 28), UINT8_C(  7), UINT8_C(108), UINT8_C(140), UINT8_C(  8), UINT8_C(221),
+      UINT8_C(180), UINT8_C( 36), UINT8_C( 64), UINT8_C(244), UINT8_C(119), UINT8_C(244), UINT8_C(144), UINT8_C(208),
+      UINT8_C(192), UINT8_C(153), UINT8_C(155), UINT8_C( 57), UINT8_C(222), UINT8_C( 35), UINT8_C(243), UINT8_C(145),
+      UINT8_C(148), UINT8_C(189), UINT8_C( 33), UINT8_C(159), UINT8_C(193), UINT8_C(181), UINT8_C(112), UINT8_C(211),
+      UINT8_C(175), UINT8_C(140), UINT8_C(219), UINT8_C( 27), UINT8_C( 25), UINT8_C(227), UINT8_C(248), UINT8_C(205),
+      UINT8_C(  7), UINT8_C( 56), UINT8_C(193), UINT8_C(126), UINT8_C( 44), UINT8_C( 82), UINT8_C( 79), UINT8_C(237),
+      UINT8_C(235), UINT8_C(234), UINT8_C( 38), UINT8_C(201), UINT8_C( 13), UINT8_C( 26), UINT8_C( 90), UINT8_C(161),
+      UINT8_C(215), UINT8_C(124), UINT8_C( 64), UINT8_C(152), UINT8_C( 49), UINT8_C(177), UINT8_C(107), UINT8_C(224),
+      UINT8_C( 61), UINT8_C( 70), UINT8_C(252), UINT8_C( 86), UINT8_C( 42), UINT8_C(244), UINT8_C( 35), UINT8_C( 49),
+      UINT8_C( 45), UINT8_C(229), UINT8_C(176), UINT8_C( 89), UINT8_C( 55),    UINT8_MAX, UINT8_C( 70), UINT8_C( 34),
+      UINT8_C(233), UINT8_C(109), UINT8_C(235), UINT8_C(246), UINT8_C(135), UINT8_C( 70), UINT8_C(152), UINT8_C( 94),
+      UINT8_C(194), UINT8_C(216), UINT8_C(246), UINT8_C(243), UINT8_C(137), UINT8_C( 97), UINT8_C(211), UINT8_C(199),
+      UINT8_C(168), UINT8_C(207), UINT8_C( 29), UINT8_C(210), UINT8_C(196), UINT8_C( 65), UINT8_C(  3), UINT8_C(241),
+      UINT8_C( 38), UINT8_C(179), UINT8_C( 74), UINT8_C( 93), UINT8_C(178), UINT8_C(145), UINT8_C(127), UINT8_C(155),
+      UINT8_C(254), UINT8_C(106), UINT8_C(146), UINT8_C(133), UINT8_C(176), UINT8_C( 42), UINT8_C(227), UINT8_C(114),
+      UINT8_C(  2), UINT8_C(217), UINT8_C(101), UINT8_C(140), UINT8_C( 58), UINT8_C( 57), UINT8_C( 83), UINT8_C(226),
+      UINT8_C(  8), UINT8_C(112), UINT8_C(180), UINT8_C(204), UINT8_C(177), UINT8_C(184), UINT8_C(189), UINT8_C(215),
+      UINT8_C(107), UINT8_C(  8), UINT8_C( 52), UINT8_C( 30), UINT8_C(153), UINT8_C(179), UINT8_C(185), UINT8_C(151),
+      UINT8_C( 30), UINT8_C( 75), UINT8_C( 28), UINT8_C(206), UINT8_C(117),    UINT8_MAX, UINT8_C( 65), UINT8_C(120),
+      UINT8_C(216), UINT8_C(166), UINT8_C(  4), UINT8_C( 18), UINT8_C(223), UINT8_C( 87), UINT8_C(245), UINT8_C(232),
+      UINT8_C(199), UINT8_C(169), UINT8_C(180), UINT8_C(121), UINT8_C( 97), UINT8_C(114), UINT8_C( 80), UINT8_C(205),
+      UINT8_C(122), UINT8_C(133), UINT8_C(235), UINT8_C( 19), UINT8_C( 56), UINT8_C(164), UINT8_C(170), UINT8_C( 86),
+      UINT8_C(240), UINT8_C(198), UINT8_C( 37), UINT8_C(101), UINT8_C(197), UINT8_C(102), UINT8_C(221), UINT8_C(157),
+      UINT8_C( 12), UINT8_C(225), UINT8_C(175), UINT8_C(236), UINT8_C( 56), UINT8_C(164), UINT8_C(212), UINT8_C(  0),
+      UINT8_C( 78), UINT8_C(136), UINT8_C(121), UINT8_C(175), UINT8_C(250), UINT8_C(201), UINT8_C(124), UINT8_C(116),
+      UINT8_C( 78), UINT8_C(103), UINT8_C(135), UINT8_C(135), UINT8_C( 12), UINT8_C( 49), UINT8_C(221), UINT8_C(252),
+      UINT8_C(247), UINT8_C(  2), UINT8_C( 97), UINT8_C(188), UINT8_C(104), UINT8_C( 63), UINT8_C( 89), UINT8_C(117),
+      UINT8_C( 32), UINT8_C(  9), UINT8_C( 97), UINT8_C( 89), UINT8_C(173), UINT8_C( 53), UINT8_C( 89), UINT8_C(251),
+      UINT8_C(189), UINT8_C(210), UINT8_C(171), UINT8_C(184) };
+  static const uint8_t c[] =
+    { UINT8_C(195), UINT8_C(170), UINT8_C(165), UINT8_C( 46), UINT8_C(222), UINT8_C(  0), UINT8_C(209), UINT8_C(201),
+      UINT8_C(165), UINT8_C(193), UINT8_C( 40), UINT8_C(116), UINT8_C( 39), UINT8_C(199), UINT8_C( 31), UINT8_C(157),
+      UINT8_C(232), UINT8_C(179), UINT8_C(105), UINT8_C(250), UINT8_C( 16), UINT8_C(142), UINT8_C( 98), UINT8_C( 52),
+      UINT8_C(208), UINT8_C(231), UINT8_C(162), UINT8_C(169), UINT8_C(  7), UINT8_C(210), UINT8_C( 81), UINT8_C(202),
+      UINT8_C(124), UINT8_C(247), UINT8_C(249), UINT8_C( 90), UINT8_C(247), UINT8_C(202), UINT8_C( 36), UINT8_C(156),
+      UINT8_C(139), UINT8_C( 76), UINT8_C( 17), UINT8_C(178), UINT8_C( 19), UINT8_C( 48), UINT8_C( 80), UINT8_C(252),
+      UINT8_C(228), UINT8_C(185), UINT8_C(246), UINT8_C(244), UINT8_C( 71), UINT8_C( 88), UINT8_C( 40), UINT8_C( 24),
+      UINT8_C( 64), UINT8_C(202), UINT8_C(193), UINT8_C( 71), UINT8_C(157), UINT8_C( 19), UINT8_C( 18), UINT8_C( 25),
+      UINT8_C( 10), UINT8_C( 11), UINT8_C(116), UINT8_C(  1), UINT8_C(213), UINT8_C(152), UINT8_C(157), UINT8_C( 97),
+      UINT8_C(228), UINT8_C(174), UINT8_C( 19), UINT8_C(247), UINT8_C(223), UINT8_C( 99), UINT8_C(243), UINT8_C(195),
+      UINT8_C( 29), UINT8_C(234), UINT8_C(183), UINT8_C(100), UINT8_C( 66), UINT8_C(223), UINT8_C(124), UINT8_C(130),
+      UINT8_C(169), UINT8_C( 62), UINT8_C(202), UINT8_C( 70), UINT8_C( 81), UINT8_C(220), UINT8_C( 96), UINT8_C( 91),
+      UINT8_C(231), UINT8_C(212), UINT8_C( 92), UINT8_C(188), UINT8_C(108), UINT8_C(249), UINT8_C( 29), UINT8_C( 80),
+      UINT8_C(168), UINT8_C( 49), UINT8_C( 71), UINT8_C(135), UINT8_C(148), UINT8_C( 59), UINT8_C( 74), UINT8_C(177),
+      UINT8_C( 37), UINT8_C(  1), UINT8_C( 22), UINT8_C(103), UINT8_C(224), UINT8_C(146), UINT8_C(234), UINT8_C(137),
+      UINT8_C(208), UINT8_C(180), UINT8_C(208), UINT8_C( 33), UINT8_C(144), UINT8_C( 48), UINT8_C(124), UINT8_C(119),
+      UINT8_C(  4), UINT8_C(216), UINT8_C( 51), UINT8_C(112), UINT8_C(210), UINT8_C( 81), UINT8_C(192), UINT8_C(122),
+      UINT8_C(130), UINT8_C(  7), UINT8_C(  1), UINT8_C( 22), UINT8_C( 66), UINT8_C( 75), UINT8_C(200), UINT8_C(103),
+      UINT8_C( 76), UINT8_C(222), UINT8_C(207), UINT8_C( 44), UINT8_C(112), UINT8_C(185), UINT8_C(181), UINT8_C( 65),
+      UINT8_C(109), UINT8_C(133), UINT8_C( 98), UINT8_C(253), UINT8_C(181), UINT8_C(223), UINT8_C(116), UINT8_C(185),
+      UINT8_C(183), UINT8_C(167), UINT8_C( 41), UINT8_C(137), UINT8_C(248), UINT8_C(233), UINT8_C(  3), UINT8_C(122),
+      UINT8_C(241), UINT8_C(  4), UINT8_C(145), UINT8_C( 51), UINT8_C( 79), UINT8_C( 89), UINT8_C(155), UINT8_C(155),
+      UINT8_C( 55), UINT8_C(106), UINT8_C(199), UINT8_C(167), UINT8_C( 35), UINT8_C(125), UINT8_C(232), UINT8_C(144),
+      UINT8_C(  2), UINT8_C( 75), UINT8_C(141), UINT8_C(184), UINT8_C( 42), UINT8_C(  1), UINT8_C(113), UINT8_C(225),
+      UINT8_C(168), UINT8_C(155), UINT8_C(107), UINT8_C(161), UINT8_C(132), UINT8_C(110), UINT8_C( 27), UINT8_C(117),
+      UINT8_C(115), UINT8_C(172), UINT8_C(169), UINT8_C(194), UINT8_C(  5), UINT8_C( 68), UINT8_C( 94), UINT8_C( 60),
+      UINT8_C(174), UINT8_C( 37), UINT8_C(228), UINT8_C(209), UINT8_C(162), UINT8_C(204), UINT8_C( 97), UINT8_C(165),
+      UINT8_C( 23), UINT8_C(238), UINT8_C( 93), UINT8_C( 65), UINT8_C(239), UINT8_C(206), UINT8_C( 35), UINT8_C(151),
+      UINT8_C(105), UINT8_C(142), UINT8_C( 56), UINT8_C(238), UINT8_C(252), UINT8_C( 84), UINT8_C( 99), UINT8_C(111),
+      UINT8_C(  0), UINT8_C( 12), UINT8_C( 50), UINT8_C(  6), UINT8_C( 80), UINT8_C(144), UINT8_C( 66), UINT8_C(254),
+      UINT8_C(181), UINT8_C( 38), UINT8_C(207), UINT8_C( 88), UINT8_C(243), UINT8_C( 48), UINT8_C(253), UINT8_C( 10),
+      UINT8_C( 30), UINT8_C( 90), UINT8_C( 76), UINT8_C( 13), UINT8_C( 40), UINT8_C(111), UINT8_C(165), UINT8_C(146),
+      UINT8_C(253), UINT8_C(221), UINT8_C(128), UINT8_C(249), UINT8_C( 49), UINT8_C(227), UINT8_C(105), UINT8_C( 50),
+      UINT8_C(240), UINT8_C(155), UINT8_C( 56), UINT8_C( 64), UINT8_C( 43), UINT8_C(122), UINT8_C( 63), UINT8_C(224),
+      UINT8_C(161), UINT8_C( 14), UINT8_C( 56), UINT8_C(148), UINT8_C( 63), UINT8_C( 53), UINT8_C(158), UINT8_C( 93),
+      UINT8_C(143), UINT8_C(234), UINT8_C(107), UINT8_C(184), UINT8_C( 89), UINT8_C( 16), UINT8_C( 74), UINT8_C( 86),
+      UINT8_C(237), UINT8_C(202), UINT8_C( 80), UINT8_C( 31), UINT8_C(173), UINT8_C(185), UINT8_C( 81), UINT8_C(157),
+      UINT8_C( 84), UINT8_C(137), UINT8_C(222), UINT8_C(127), UINT8_C(  3), UINT8_C( 29), UINT8_C( 95), UINT8_C(164),
+      UINT8_C( 43), UINT8_C(152), UINT8_C( 56), UINT8_C(106), UINT8_C(205), UINT8_C(215), UINT8_C(200), UINT8_C( 93),
+      UINT8_C(193), UINT8_C( 51), UINT8_C( 21), UINT8_C( 27), UINT8_C( 67), UINT8_C( 95), UINT8_C(113), UINT8_C( 48),
+      UINT8_C( 41), UINT8_C(193), UINT8_C( 79), UINT8_C(214), UINT8_C(122), UINT8_C(160), UINT8_C(116), UINT8_C(206),
+      UINT8_C( 41), UINT8_C( 82), UINT8_C( 77), UINT8_C( 45), UINT8_C(111), UINT8_C(173), UINT8_C(209), UINT8_C(154),
+      UINT8_C( 69), UINT8_C( 10), UINT8_C(  5), UINT8_C( 18), UINT8_C(225), UINT8_C(205), UINT8_C(111), UINT8_C(162),
+      UINT8_C(  0), UINT8_C(132), UINT8_C(189), UINT8_C( 67), UINT8_C(227), UINT8_C( 47), UINT8_C(115), UINT8_C( 12),
+      UINT8_C(240), UINT8_C(195), UINT8_C(227), UINT8_C(107), UINT8_C( 99), UINT8_C( 87), UINT8_C( 57), UINT8_C(141),
+      UINT8_C(169), UINT8_C(135), UINT8_C(186), UINT8_C( 24), UINT8_C( 52), UINT8_C(139), UINT8_C(178), UINT8_C(121),
+      UINT8_C(149), UINT8_C(183), UINT8_C(139), UINT8_C(118), UINT8_C(132), UINT8_C(251), UINT8_C( 25), UINT8_C(132),
+      UINT8_C(127), UINT8_C(214), UINT8_C(199), UINT8_C( 99), UINT8_C(  5), UINT8_C( 59), UINT8_C(111), UINT8_C(246),
+      UINT8_C(254), UINT8_C( 82), UINT8_C( 97), UINT8_C( 97), UINT8_C(169), UINT8_C(154), UINT8_C(238), UINT8_C( 82),
+      UINT8_C( 33), UINT8_C(168), UINT8_C(106), UINT8_C( 85), UINT8_C( 52), UINT8_C( 29), UINT8_C(206), UINT8_C(201),
+      UINT8_C(212), UINT8_C( 90), UINT8_C( 64), UINT8_C( 89), UINT8_C( 85), UINT8_C( 89), UINT8_C(221), UINT8_C(212),
+      UINT8_C( 47), UINT8_C(165), UINT8_C( 55), UINT8_C( 53), UINT8_C(224), UINT8_C(167), UINT8_C( 43), UINT8_C(222),
+      UINT8_C(249), UINT8_C(140), UINT8_C( 63), UINT8_C(163), UINT8_C( 38), UINT8_C( 46), UINT8_C(245), UINT8_C( 72),
+      UINT8_C(214), UINT8_C( 96), UINT8_C(157), UINT8_C( 10), UINT8_C(125), UINT8_C(108), UINT8_C(212), UINT8_C( 81),
+      UINT8_C(198), UINT8_C( 20), UINT8_C(170), UINT8_C( 27), UINT8_C(109), UINT8_C(136), UINT8_C(239), UINT8_C(156),
+      UINT8_C( 45), UINT8_C( 39), UINT8_C(209), UINT8_C( 13), UINT8_C(206), UINT8_C(252), UINT8_C(235), UINT8_C(199),
+      UINT8_C(136), UINT8_C( 42), UINT8_C(106), UINT8_C(175), UINT8_C( 88), UINT8_C( 96), UINT8_C(247), UINT8_C( 47),
+      UINT8_C(192), UINT8_C(148), UINT8_C( 57), UINT8_C( 61), UINT8_C(  0), UINT8_C( 13), UINT8_C(142), UINT8_C(198),
+      UINT8_C( 33), UINT8_C( 57), UINT8_C(225), UINT8_C(142), UINT8_C(193), UINT8_C(209), UINT8_C( 43), UINT8_C(238),
+      UINT8_C(248), UINT8_C(252), UINT8_C(251), UINT8_C(198), UINT8_C(249), UINT8_C(230), UINT8_C(141), UINT8_C(129),
+      UINT8_C( 16), UINT8_C(248), UINT8_C( 48), UINT8_C(105), UINT8_C( 88), UINT8_C( 39), UINT8_C(152), UINT8_C( 24),
+      UINT8_C(188), UINT8_C(209), UINT8_C( 85), UINT8_C(188), UINT8_C(223), UINT8_C(227), UINT8_C(131), UINT8_C(  0),
+      UINT8_C( 28), UINT8_C(100), UINT8_C(143), UINT8_C(221), UINT8_C( 53), UINT8_C(186), UINT8_C(203), UINT8_C( 45),
+      UINT8_C(182), UINT8_C(198), UINT8_C(243), UINT8_C(175), UINT8_C(172), UINT8_C(129), UINT8_C( 49), UINT8_C(189),
+      UINT8_C(121), UINT8_C( 97), UINT8_C( 38), UINT8_C(209), UINT8_C(137), UINT8_C(190), UINT8_C(233), UINT8_C( 69),
+      UINT8_C(143), UINT8_C( 62), UINT8_C(  1), UINT8_C(110), UINT8_C( 33), UINT8_C(132), UINT8_C(111), UINT8_C( 62),
+      UINT8_C(233), UINT8_C(254), UINT8_C( 27), UINT8_C( 30), UINT8_C(184), UINT8_C(231), UINT8_C( 76), UINT8_C(110),
+      UINT8_C(173), UINT8_C( 63), UINT8_C( 30), UINT8_C( 90), UINT8_C(192), UINT8_C( 79), UINT8_C( 23), UINT8_C( 57),
+      UINT8_C(176), UINT8_C( 61), UINT8_C( 10), UINT8_C( 57), UINT8_C(251), UINT8_C(243), UINT8_C(126), UINT8_C(138),
+      UINT8_C( 49), UINT8_C(128), UINT8_C(249), UINT8_C( 83), UINT8_C(  4), UINT8_C(104), UINT8_C(145), UINT8_C(237),
+      UINT8_C(102), UINT8_C(172), UINT8_C( 12), UINT8_C( 30), UINT8_C(147), UINT8_C( 88), UINT8_C(140), UINT8_C( 65),
+      UINT8_C(151), UINT8_C(170), UINT8_C(155), UINT8_C( 88), UINT8_C(249), UINT8_C(178), UINT8_C(145), UINT8_C(170),
+      UINT8_C(239), UINT8_C(156), UINT8_C(227), UINT8_C(234), UINT8_C(143), UINT8_C( 98), UINT8_C(116), UINT8_C(193),
+      UINT8_C(226), UINT8_C(109), UINT8_C( 20), UINT8_C(230), UINT8_C(213), UINT8_C(165), UINT8_C(212), UINT8_C( 59),
+      UINT8_C( 81), UINT8_C(224), UINT8_C( 89), UINT8_C(229), UINT8_C( 56), UINT8_C(230), UINT8_C( 38), UINT8_C(207),
+      UINT8_C(144), UINT8_C(193), UINT8_C( 39), UINT8_C(138), UINT8_C(115), UINT8_C(185), UINT8_C( 52), UINT8_C( 98),
+      UINT8_C( 85), UINT8_C( 23), UINT8_C( 76), UINT8_C(228) };
+  static const uint8_t e[] =
+    { UINT8_C( 75), UINT8_C( 66), UINT8_C(239), UINT8_C( 29), UINT8_C(189), UINT8_C( 46), UINT8_C(113), UINT8_C(204),
+      UINT8_C(194), UINT8_C(214), UINT8_C(  8), UINT8_C( 92), UINT8_C(229), UINT8_C(199), UINT8_C( 24), UINT8_C(205),
+      UINT8_C(122), UINT8_C( 86), UINT8_C( 38), UINT8_C( 14), UINT8_C(  4), UINT8_C(223), UINT8_C(176), UINT8_C(156),
+      UINT8_C(183), UINT8_C(103), UINT8_C( 98), UINT8_C(164), UINT8_C(201), UINT8_C(245), UINT8_C( 41), UINT8_C(229),
+      UINT8_C( 63), UINT8_C(179), UINT8_C( 69), UINT8_C( 26), UINT8_C( 10), UINT8_C(130), UINT8_C(  8), UINT8_C(220),
+      UINT8_C(209), UINT8_C(244), UINT8_C(201), UINT8_C(226), UINT8_C(104), UINT8_C( 65), UINT8_C(192), UINT8_C(162),
+      UINT8_C(226), UINT8_C(201), UINT8_C( 15), UINT8_C(204), UINT8_C( 21), UINT8_C(178), UINT8_C( 24), UINT8_C( 74),
+      UINT8_C( 25), UINT8_C(156), UINT8_C(117), UINT8_C(167), UINT8_C( 60), UINT8_C(218), UINT8_C(121), UINT8_C(123),
+      UINT8_C( 46), UINT8_C( 85), UINT8_C(184), UINT8_C(124), UINT8_C( 93), UINT8_C(192), UINT8_C(229), UINT8_C( 46),
+      UINT8_C(249), UINT8_C(250), UINT8_C(246), UINT8_C( 50), UINT8_C( 11), UINT8_C(  6), UINT8_C( 15), UINT8_C( 73),
+      UINT8_C( 60), UINT8_C(244), UINT8_C(216), UINT8_C( 82), UINT8_C(166), UINT8_C( 49), UINT8_C( 80), UINT8_C(194),
+      UINT8_C(145), UINT8_C(130), UINT8_C( 50), UINT8_C(230), UINT8_C(218), UINT8_C( 57), UINT8_C(180), UINT8_C( 76),
+      UINT8_C( 39), UINT8_C( 56), UINT8_C(201), UINT8_C( 61), UINT8_C(164), UINT8_C( 19), UINT8_C(253), UINT8_C(232),
+      UINT8_C(180), UINT8_C(160), UINT8_C( 69), UINT8_C( 52), UINT8_C(103), UINT8_C( 19), UINT8_C(190), UINT8_C(164),
+      UINT8_C( 37), UINT8_C(147), UINT8_C(224), UINT8_C( 79), UINT8_C(193), UINT8_C( 42), UINT8_C( 87), UINT8_C( 87),
+      UINT8_C(248), UINT8_C(170), UINT8_C(230), UINT8_C(243), UINT8_C(233), UINT8_C( 18), UINT8_C( 28), UINT8_C(246),
+      UINT8_C(246), UINT8_C(163), UINT8_C(179), UINT8_C(245), UINT8_C(246), UINT8_C(169), UINT8_C( 56), UINT8_C(121),
+      UINT8_C( 11), UINT8_C(  8), UINT8_C(173), UINT8_C(126), UINT8_C(102), UINT8_C( 43), UINT8_C( 22), UINT8_C(143),
+      UINT8_C(191), UINT8_C( 38), UINT8_C(242), UINT8_C(128), UINT8_C(231), UINT8_C( 33), UINT8_C(182), UINT8_C(181),
+      UINT8_C(137), UINT8_C( 69), UINT8_C( 46), UINT8_C(205), UINT8_C( 82), UINT8_C(200), UINT8_C(234), UINT8_C(166),
+      UINT8_C(157), UINT8_C( 67), UINT8_C(143), UINT8_C(163), UINT8_C(181), UINT8_C(121), UINT8_C( 28), UINT8_C( 58),
+      UINT8_C(129), UINT8_C(  2), UINT8_C( 51), UINT8_C( 62), UINT8_C( 29), UINT8_C( 73), UINT8_C( 45), UINT8_C(180),
+      UINT8_C( 86), UINT8_C( 98), UINT8_C( 53), UINT8_C(254), UINT8_C( 59), UINT8_C(205), UINT8_C( 25), UINT8_C(201),
+      UINT8_C(136), UINT8_C(197), UINT8_C(223), UINT8_C(152), UINT8_C(141), UINT8_C(161), UINT8_C(153), UINT8_C( 93),
+      UINT8_C(216), UINT8_C( 73), UINT8_C(209), UINT8_C(112), UINT8_C(  4), UINT8_C(250), UINT8_C(230), UINT8_C( 17),
+      UINT8_C( 19), UINT8_C(103), UINT8_C( 88), UINT8_C(186), UINT8_C( 98), UINT8_C( 18), UINT8_C(110), UINT8_C(184),
+      UINT8_C( 78), UINT8_C(252), UINT8_C(127), UINT8_C(145), UINT8_C(143), UINT8_C( 15), UINT8_C( 58), UINT8_C(151),
+      UINT8_C(212), UINT8_C(110), UINT8_C( 74), UINT8_C(219), UINT8_C( 52), UINT8_C(145), UINT8_C( 55), UINT8_C(164),
+      UINT8_C( 76), UINT8_C(232), UINT8_C( 41), UINT8_C(163), UINT8_C(133), UINT8_C(175), UINT8_C( 75), UINT8_C( 57),
+      UINT8_C(168), UINT8_C(208), UINT8_C(195), UINT8_C(105), UINT8_C( 78), UINT8_C(186), UINT8_C(227), UINT8_C(120),
+      UINT8_C( 31), UINT8_C(131), UINT8_C( 23), UINT8_C(148), UINT8_C(171), UINT8_C( 81), UINT8_C(229), UINT8_C(188),
+      UINT8_C( 33), UINT8_C(251), UINT8_C( 30), UINT8_C( 81), UINT8_C(200), UINT8_C( 13), UINT8_C( 22), UINT8_C(103),
+      UINT8_C(100), UINT8_C(195), UINT8_C( 90), UINT8_C(170), UINT8_C(  9), UINT8_C( 89), UINT8_C( 33), UINT8_C(101),
+      UINT8_C(192), UINT8_C(215), UINT8_C(102), UINT8_C(  3), UINT8_C( 98), UINT8_C(235), UINT8_C( 68), UINT8_C( 79),
+      UINT8_C( 34), UINT8_C(193), UINT8_C(216), UINT8_C( 10), UINT8_C( 18), UINT8_C(127), UINT8_C( 27), UINT8_C(205),
+      UINT8_C(123), UINT8_C( 20), UINT8_C(107), UINT8_C(148), UINT8_C(121), UINT8_C(131), UINT8_C(163), UINT8_C(214),
+      UINT8_C( 21), UINT8_C( 90), UINT8_C(208), UINT8_C(151), UINT8_C( 32), UINT8_C(100), UINT8_C(243), UINT8_C( 81),
+      UINT8_C( 60), UINT8_C(102), UINT8_C( 83), UINT8_C(117), UINT8_C(163), UINT8_C(209), UINT8_C( 71), UINT8_C(245),
+      UINT8_C( 96), UINT8_C(136), UINT8_C(104), UINT8_C(254), UINT8_C(  7), UINT8_C( 93), UINT8_C(176), UINT8_C(253),
+      UINT8_C( 13), UINT8_C(187), UINT8_C( 38), UINT8_C( 29), UINT8_C( 39), UINT8_C(159), UINT8_C(103), UINT8_C(132),
+      UINT8_C( 45), UINT8_C(115), UINT8_C(211), UINT8_C( 58), UINT8_C(218), UINT8_C( 48),    UINT8_MAX, UINT8_C(198),
+      UINT8_C(161), UINT8_C(128), UINT8_C(137), UINT8_C(191), UINT8_C( 21), UINT8_C(187), UINT8_C(242), UINT8_C(150),
+      UINT8_C(198), UINT8_C(194), UINT8_C(148), UINT8_C(205), UINT8_C( 42), UINT8_C(198), UINT8_C(127), UINT8_C(214),
+      UINT8_C(  2), UINT8_C(118), UINT8_C(245), UINT8_C(192), UINT8_C(182), UINT8_C(139), UINT8_C( 21), UINT8_C( 74),
+      UINT8_C(198), UINT8_C(223), UINT8_C(215), UINT8_C(149), UINT8_C(189), UINT8_C(235), UINT8_C(105), UINT8_C( 60),
+      UINT8_C(108), UINT8_C( 16), UINT8_C(105), UINT8_C(253), UINT8_C(116), UINT8_C( 95), UINT8_C(173), UINT8_C( 13),
+      UINT8_C( 30), UINT8_C( 79), UINT8_C(160), UINT8_C( 38), UINT8_C(  8), UINT8_C(240), UINT8_C( 78), UINT8_C(200),
+      UINT8_C(103), UINT8_C( 65), UINT8_C( 75), UINT8_C(179), UINT8_C(178), UINT8_C(123), UINT8_C(135), UINT8_C(118),
+      UINT8_C( 66), UINT8_C(116), UINT8_C(178), UINT8_C(196), UINT8_C( 95), UINT8_C(174), UINT8_C(246), UINT8_C(203),
+      UINT8_C( 89), UINT8_C(106), UINT8_C(226), UINT8_C(211), UINT8_C(198), UINT8_C( 93), UINT8_C(166), UINT8_C(229),
+      UINT8_C( 84), UINT8_C( 71), UINT8_C( 93), UINT8_C(227), UINT8_C(  7), UINT8_C(171), UINT8_C(188), UINT8_C( 82),
+      UINT8_C(236), UINT8_C(149), UINT8_C(115), UINT8_C( 19), UINT8_C( 32), UINT8_C( 68), UINT8_C(123), UINT8_C( 82),
+      UINT8_C(184), UINT8_C( 72), UINT8_C( 17), UINT8_C( 16), UINT8_C( 27), UINT8_C(147), UINT8_C(221), UINT8_C(  3),
+      UINT8_C(100), UINT8_C(197), UINT8_C(180), UINT8_C(122), UINT8_C( 85), UINT8_C(118), UINT8_C(183), UINT8_C(108),
+      UINT8_C(196), UINT8_C(138), UINT8_C(  2), UINT8_C(247), UINT8_C( 53), UINT8_C(254), UINT8_C( 19), UINT8_C( 93),
+      UINT8_C(126), UINT8_C( 86), UINT8_C(209), UINT8_C( 87), UINT8_C(154), UINT8_C( 68), UINT8_C(142), UINT8_C(135),
+      UINT8_C( 13), UINT8_C(191), UINT8_C(106), UINT8_C(139), UINT8_C(158), UINT8_C( 77), UINT8_C( 78), UINT8_C( 56),
+      UINT8_C( 18), UINT8_C(173), UINT8_C(233), UINT8_C(104), UINT8_C(162), UINT8_C( 62), UINT8_C(168), UINT8_C(116),
+      UINT8_C( 34), UINT8_C(145), UINT8_C( 99), UINT8_C(143), UINT8_C(248),    UINT8_MAX, UINT8_C(176), UINT8_C(112),
+      UINT8_C(160), UINT8_C(229), UINT8_C(102), UINT8_C(238), UINT8_C(142), UINT8_C(149), UINT8_C( 32), UINT8_C( 23),
+      UINT8_C(207), UINT8_C( 61), UINT8_C(193), UINT8_C(166), UINT8_C( 56), UINT8_C( 58), UINT8_C(149), UINT8_C( 10),
+      UINT8_C(140), UINT8_C(160), UINT8_C( 73), UINT8_C( 26), UINT8_C( 13), UINT8_C(  5), UINT8_C(130), UINT8_C(179),
+      UINT8_C(246), UINT8_C(204), UINT8_C(191), UINT8_C(140), UINT8_C(149), UINT8_C(  8), UINT8_C( 60), UINT8_C( 57),
+      UINT8_C(237), UINT8_C(  2), UINT8_C( 39), UINT8_C(231), UINT8_C(134), UINT8_C(254), UINT8_C(192), UINT8_C(125),
+      UINT8_C(249), UINT8_C(193), UINT8_C( 94), UINT8_C( 49), UINT8_C(173), UINT8_C( 86), UINT8_C(240), UINT8_C( 37),
+      UINT8_C( 38), UINT8_C(102), UINT8_C( 63), UINT8_C(149), UINT8_C(135), UINT8_C(119), UINT8_C( 93), UINT8_C( 27),
+      UINT8_C( 63), UINT8_C( 80), UINT8_C(167), UINT8_C(135), UINT8_C(  3), UINT8_C( 66), UINT8_C( 73), UINT8_C( 14),
+      UINT8_C( 13), UINT8_C(203), UINT8_C( 58), UINT8_C( 86), UINT8_C( 71), UINT8_C(156), UINT8_C( 54), UINT8_C(249),
+      UINT8_C(234), UINT8_C(189), UINT8_C(138), UINT8_C(163), UINT8_C( 66), UINT8_C( 41), UINT8_C(254), UINT8_C(104),
+      UINT8_C(249), UINT8_C( 35), UINT8_C(254), UINT8_C(211), UINT8_C(196), UINT8_C( 92), UINT8_C(127), UINT8_C(110),
+      UINT8_C( 54), UINT8_C( 66), UINT8_C(117), UINT8_C(210), UINT8_C(236), UINT8_C(179), UINT8_C(126), UINT8_C(201),
+      UINT8_C(149), UINT8_C(207), UINT8_C(204), UINT8_C(220), UINT8_C( 97), UINT8_C( 86), UINT8_C( 52), UINT8_C( 87),
+      UINT8_C(185), UINT8_C(196), UINT8_C( 13), UINT8_C(  5), UINT8_C(  8), UINT8_C(194), UINT8_C(124), UINT8_C( 53),
+      UINT8_C(110), UINT8_C( 17), UINT8_C(130), UINT8_C(228), UINT8_C( 24), UINT8_C( 29), UINT8_C(212), UINT8_C(143),
+      UINT8_C(241), UINT8_C(246), UINT8_C(253), UINT8_C( 17), UINT8_C(224), UINT8_C(124), UINT8_C(174), UINT8_C( 37),
+      UINT8_C( 65), UINT8_C(206), UINT8_C( 26), UINT8_C( 53), UINT8_C( 36), UINT8_C( 20), UINT8_C( 30), UINT8_C( 79),
+      UINT8_C(169), UINT8_C(245), UINT8_C(208), UINT8_C(236) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i])),
+      cv = simde_svld1_u8(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmad_u8_m(pv, av, bv, cv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], c[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+    cv = simde_svld1_u8(pg, &(c[i]));
+
+    ev = simde_svmad_u8_m(pv, av, bv, cv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(51719), UINT16_C(60628), UINT16_C(38004), UINT16_C(45550), UINT16_C(62644), UINT16_C( 1071), UINT16_C( 1709), UINT16_C(15503),
+      UINT16_C(27762), UINT16_C(39738), UINT16_C(54288), UINT16_C(23538), UINT16_C(33649), UINT16_C(53559), UINT16_C(35131), UINT16_C(17126),
+      UINT16_C(47700), UINT16_C(51246), UINT16_C( 7246), UINT16_C(  633), UINT16_C(43024), UINT16_C(48391), UINT16_C(38574), UINT16_C( 8441),
+      UINT16_C(13058), UINT16_C( 4796), UINT16_C(44552), UINT16_C(31085), UINT16_C(42033), UINT16_C(27722), UINT16_C(12334), UINT16_C(33454),
+      UINT16_C(56810), UINT16_C(14410), UINT16_C(50169), UINT16_C( 2618), UINT16_C(16747), UINT16_C( 6855), UINT16_C(49623), UINT16_C(55610),
+      UINT16_C(63220), UINT16_C(64747), UINT16_C(22693), UINT16_C(54901), UINT16_C(49149), UINT16_C(11075), UINT16_C(61935), UINT16_C(55725),
+      UINT16_C(63438), UINT16_C(51217), UINT16_C(19642), UINT16_C( 9682), UINT16_C(39309), UINT16_C(25919), UINT16_C(31322), UINT16_C(20286),
+      UINT16_C(10864), UINT16_C( 5451), UINT16_C(49538), UINT16_C(32748), UINT16_C(12160), UINT16_C(28842), UINT16_C(22304), UINT16_C(61257),
+      UINT16_C(23374), UINT16_C( 2231), UINT16_C(35239), UINT16_C(13358), UINT16_C(27938), UINT16_C(32153), UINT16_C(55527), UINT16_C(22732),
+      UINT16_C( 5890), UINT16_C(33901), UINT16_C(23000), UINT16_C(22788), UINT16_C(44680), UINT16_C(43465), UINT16_C( 4614), UINT16_C(21656),
+      UINT16_C(20333), UINT16_C( 5213), UINT16_C(35800), UINT16_C(64073), UINT16_C(58104), UINT16_C(57463), UINT16_C(17338), UINT16_C(48184),
+      UINT16_C(42331), UINT16_C(13121), UINT16_C(17919), UINT16_C(34700), UINT16_C(22003), UINT16_C(63792), UINT16_C(51304), UINT16_C(54606),
+      UINT16_C(43799), UINT16_C(61418), UINT16_C(13110), UINT16_C(12010), UINT16_C(24853), UINT16_C(53262), UINT16_C(18085), UINT16_C(  140),
+      UINT16_C(52716), UINT16_C(60211), UINT16_C(49170), UINT16_C( 1650), UINT16_C(41749), UINT16_C(32255), UINT16_C(19819), UINT16_C(33619),
+      UINT16_C(15864), UINT16_C(11890), UINT16_C(23664), UINT16_C(34141), UINT16_C(27582), UINT16_C(25429), UINT16_C(58034), UINT16_C(40547),
+      UINT16_C(38575), UINT16_C(49801), UINT16_C(64342), UINT16_C(27848), UINT16_C(51102), UINT16_C( 2793), UINT16_C(15381), UINT16_C( 3469),
+      UINT16_C(65401), UINT16_C(59708), UINT16_C(39260), UINT16_C( 6767), UINT16_C(50180), UINT16_C(46717), UINT16_C(57510), UINT16_C(22100),
+      UINT16_C(56694), UINT16_C(52504), UINT16_C(57561), UINT16_C(30521), UINT16_C( 8871), UINT16_C(48257), UINT16_C( 3679), UINT16_C(55498),
+      UINT16_C( 1550), UINT16_C(27330), UINT16_C(12703), UINT16_C(41860), UINT16_C(  501), UINT16_C(40026), UINT16_C(44769), UINT16_C(22514),
+      UINT16_C( 2700), UINT16_C(25892), UINT16_C(24042), UINT16_C(37340), UINT16_C(24192), UINT16_C(57166), UINT16_C( 6252), UINT16_C(31415),
+      UINT16_C(31006), UINT16_C(48612), UINT16_C(26794), UINT16_C(41056), UINT16_C(47721), UINT16_C(19004), UINT16_C(11881), UINT16_C(62882),
+      UINT16_C(50744), UINT16_C( 8794), UINT16_C(13860), UINT16_C(42163), UINT16_C(  404), UINT16_C(  387), UINT16_C(14873), UINT16_C(14203),
+      UINT16_C(24756), UINT16_C(24308), UINT16_C(21960), UINT16_C(13054), UINT16_C(14863), UINT16_C(30844), UINT16_C( 7784), UINT16_C(41069),
+      UINT16_C(51173), UINT16_C( 2498), UINT16_C(30462), UINT16_C(37549), UINT16_C(12407), UINT16_C(37267), UINT16_C( 3946), UINT16_C( 7880),
+      UINT16_C(48495), UINT16_C(14205), UINT16_C(31506), UINT16_C( 8553), UINT16_C(59062), UINT16_C( 7834), UINT16_C( 1796), UINT16_C(59839),
+      UINT16_C(33231), UINT16_C(52722), UINT16_C(40951), UINT16_C(28511), UINT16_C(62415), UINT16_C(14848), UINT16_C(51202), UINT16_C(29016),
+      UINT16_C(54661), UINT16_C(38824), UINT16_C( 4689), UINT16_C( 1977), UINT16_C(21496), UINT16_C(64549), UINT16_C(58458), UINT16_C(10726),
+      UINT16_C(55398), UINT16_C(24054), UINT16_C(22136), UINT16_C(18380), UINT16_C(52297), UINT16_C(19329), UINT16_C(55957), UINT16_C( 6844),
+      UINT16_C(25775), UINT16_C(  178), UINT16_C(27510), UINT16_C(28167), UINT16_C(11710), UINT16_C( 6251), UINT16_C(20753), UINT16_C(30530),
+      UINT16_C(14377), UINT16_C(41429), UINT16_C(41358), UINT16_C(55273), UINT16_C(27246), UINT16_C(  802), UINT16_C(56900), UINT16_C(62493),
+      UINT16_C(53059), UINT16_C(47604), UINT16_C(64570), UINT16_C(63528), UINT16_C(37673), UINT16_C(14865), UINT16_C(21476), UINT16_C( 3506),
+      UINT16_C(34699), UINT16_C( 6831), UINT16_C(38952), UINT16_C(38641), UINT16_C( 5122), UINT16_C(18329), UINT16_C(47090), UINT16_C(13627),
+      UINT16_C(12166), UINT16_C(49647), UINT16_C( 5931), UINT16_C(21689), UINT16_C(51882), UINT16_C(36495), UINT16_C(16669), UINT16_C(43419),
+      UINT16_C(19144), UINT16_C(61635), UINT16_C(46306), UINT16_C(58759), UINT16_C( 8392), UINT16_C(47916), UINT16_C(26583), UINT16_C(24304),
+      UINT16_C(57238), UINT16_C(49695), UINT16_C(55542), UINT16_C(40982), UINT16_C(42403), UINT16_C(49198), UINT16_C(51942), UINT16_C(44649),
+      UINT16_C(11284), UINT16_C(63391), UINT16_C( 9953), UINT16_C(43484), UINT16_C( 2118), UINT16_C( 7780), UINT16_C(21871), UINT16_C( 1404),
+      UINT16_C(39732), UINT16_C(11207), UINT16_C(56947), UINT16_C( 5835), UINT16_C(64131), UINT16_C(27351), UINT16_C(16580), UINT16_C(55320),
+      UINT16_C(46957), UINT16_C(20175), UINT16_C(43997), UINT16_C( 9463), UINT16_C(23731), UINT16_C( 8770), UINT16_C(48817), UINT16_C(58664),
+      UINT16_C(61273), UINT16_C(52240), UINT16_C(56525), UINT16_C(20963), UINT16_C(47830), UINT16_C(39611), UINT16_C(54266), UINT16_C(26482),
+      UINT16_C(17035), UINT16_C(26805), UINT16_C(44525), UINT16_C(41356), UINT16_C(52745), UINT16_C(47811), UINT16_C(60300), UINT16_C(58783),
+      UINT16_C(45275), UINT16_C(43186), UINT16_C(38284), UINT16_C(25337), UINT16_C(46159), UINT16_C(18940), UINT16_C(28296), UINT16_C( 5041),
+      UINT16_C(26288), UINT16_C(40571), UINT16_C( 2067), UINT16_C( 7231), UINT16_C(  726), UINT16_C(25558), UINT16_C(30446), UINT16_C(51528),
+      UINT16_C(64038), UINT16_C(45681), UINT16_C(27535), UINT16_C(56852), UINT16_C( 4127), UINT16_C(42792), UINT16_C(55678), UINT16_C(12218),
+      UINT16_C(13887), UINT16_C(21453), UINT16_C( 3134), UINT16_C( 5231), UINT16_C(17934), UINT16_C(64631), UINT16_C(49340), UINT16_C(58053),
+      UINT16_C(14266), UINT16_C(19092), UINT16_C(43170), UINT16_C(49448), UINT16_C(20664), UINT16_C(13929), UINT16_C( 9001), UINT16_C(26981),
+      UINT16_C(12889), UINT16_C(38844), UINT16_C(11070), UINT16_C(19884), UINT16_C( 9073), UINT16_C(11593), UINT16_C( 4067), UINT16_C(40463),
+      UINT16_C(41798), UINT16_C(59624), UINT16_C( 4171), UINT16_C(  937), UINT16_C( 4705), UINT16_C(35386), UINT16_C(40758), UINT16_C(36851),
+      UINT16_C(45010), UINT16_C( 4135), UINT16_C(54235), UINT16_C(19549), UINT16_C(42998), UINT16_C(55930), UINT16_C(35254), UINT16_C(64632),
+      UINT16_C(24621), UINT16_C(30948), UINT16_C(36208), UINT16_C(53628), UINT16_C(46752), UINT16_C(54876), UINT16_C(20309), UINT16_C(10085),
+      UINT16_C(36095), UINT16_C(55864), UINT16_C(38239), UINT16_C(22054), UINT16_C(41020), UINT16_C(62000), UINT16_C(43050), UINT16_C(22510),
+      UINT16_C(53768), UINT16_C(30927), UINT16_C(19296), UINT16_C(   74), UINT16_C(42497), UINT16_C(22486), UINT16_C(15349) };
+  static const uint16_t b[] =
+    { UINT16_C(44210), UINT16_C( 6031), UINT16_C(63654), UINT16_C( 3629), UINT16_C(23048), UINT16_C( 5065), UINT16_C(22428), UINT16_C(50248),
+      UINT16_C(20970), UINT16_C(37745), UINT16_C(13750), UINT16_C(10205), UINT16_C( 9257), UINT16_C(55169), UINT16_C(53558), UINT16_C(59546),
+      UINT16_C(10622), UINT16_C( 9471), UINT16_C(11297), UINT16_C(10547), UINT16_C(64646), UINT16_C( 9021), UINT16_C(34131), UINT16_C(16103),
+      UINT16_C(22742), UINT16_C(36305), UINT16_C(44942), UINT16_C(47028), UINT16_C(14035), UINT16_C( 2446), UINT16_C(10247), UINT16_C(34290),
+      UINT16_C(61777), UINT16_C(29354), UINT16_C(56606), UINT16_C(42140), UINT16_C(55769), UINT16_C(11719), UINT16_C(44638), UINT16_C(13675),
+      UINT16_C(15367), UINT16_C(38338), UINT16_C(30443), UINT16_C(48716), UINT16_C(55980), UINT16_C(46280), UINT16_C(47619), UINT16_C(21561),
+      UINT16_C(58283), UINT16_C(51655), UINT16_C(25536), UINT16_C(39534), UINT16_C(13628), UINT16_C(39623), UINT16_C(13028), UINT16_C(60367),
+      UINT16_C(37230), UINT16_C(23168), UINT16_C(52232), UINT16_C(46104), UINT16_C(57510), UINT16_C(43368), UINT16_C(41626), UINT16_C(18174),
+      UINT16_C(50565), UINT16_C(17935), UINT16_C(32040), UINT16_C(25824), UINT16_C(42931), UINT16_C(38910), UINT16_C(52953), UINT16_C(18306),
+      UINT16_C(  607), UINT16_C(26529), UINT16_C(47822), UINT16_C(29724), UINT16_C(33946), UINT16_C(13598), UINT16_C( 7206), UINT16_C(44155),
+      UINT16_C(35553), UINT16_C( 2546), UINT16_C(53768), UINT16_C(47981), UINT16_C(27513), UINT16_C(21074), UINT16_C(54329), UINT16_C(39321),
+      UINT16_C(15318), UINT16_C(41984), UINT16_C( 7413), UINT16_C(36632), UINT16_C(13985), UINT16_C(51140), UINT16_C(16210), UINT16_C(13171),
+      UINT16_C(26058), UINT16_C(53820), UINT16_C(43319), UINT16_C(45197), UINT16_C(57109), UINT16_C(19970), UINT16_C(40115), UINT16_C(35303),
+      UINT16_C(59607), UINT16_C(52269), UINT16_C(17668), UINT16_C(42331), UINT16_C( 8316), UINT16_C(52845), UINT16_C(57439), UINT16_C(10498),
+      UINT16_C(15942), UINT16_C(32251), UINT16_C(35048), UINT16_C(64814), UINT16_C(12391), UINT16_C( 6731), UINT16_C(13260), UINT16_C(41891),
+      UINT16_C(53275), UINT16_C( 8047), UINT16_C(51990), UINT16_C(37573), UINT16_C(13035), UINT16_C(19040), UINT16_C(25106), UINT16_C(22644),
+      UINT16_C(28577), UINT16_C(35286), UINT16_C( 1272), UINT16_C(24454), UINT16_C(53556), UINT16_C(  378), UINT16_C( 7428), UINT16_C( 8100),
+      UINT16_C( 5358), UINT16_C( 1087), UINT16_C( 1247), UINT16_C(51862), UINT16_C(63030), UINT16_C(18452), UINT16_C(34905), UINT16_C(64161),
+      UINT16_C(30712), UINT16_C(61571), UINT16_C( 2427), UINT16_C(44879), UINT16_C(51674), UINT16_C(57264), UINT16_C(21991), UINT16_C(54782),
+      UINT16_C(15721), UINT16_C(18649), UINT16_C(28481), UINT16_C(30482), UINT16_C( 9829), UINT16_C(48832), UINT16_C(25007), UINT16_C(42936),
+      UINT16_C(15320), UINT16_C(21399), UINT16_C(58948), UINT16_C( 7938), UINT16_C(46000), UINT16_C(38910), UINT16_C(64520), UINT16_C(29036),
+      UINT16_C(17722), UINT16_C(31673), UINT16_C(52148), UINT16_C( 6643), UINT16_C(46065), UINT16_C(41176), UINT16_C(36884), UINT16_C(60487),
+      UINT16_C(57036), UINT16_C( 4159), UINT16_C(16837), UINT16_C(29999), UINT16_C(11764), UINT16_C(64524), UINT16_C(30762), UINT16_C(25709),
+      UINT16_C( 9917), UINT16_C(29151), UINT16_C(54001), UINT16_C(58250), UINT16_C(25221), UINT16_C(39299), UINT16_C(52211), UINT16_C(49029),
+      UINT16_C(50345), UINT16_C(28367), UINT16_C(65286), UINT16_C(64227), UINT16_C(61228), UINT16_C(22263), UINT16_C(25703), UINT16_C( 9402),
+      UINT16_C(39563), UINT16_C(31893), UINT16_C( 8300), UINT16_C(62047), UINT16_C(58242), UINT16_C(30091), UINT16_C( 4526), UINT16_C(22324),
+      UINT16_C( 1237), UINT16_C(56262), UINT16_C(43267), UINT16_C(12246), UINT16_C(52633), UINT16_C(  134), UINT16_C(16433), UINT16_C(48165),
+      UINT16_C(47834), UINT16_C(18233), UINT16_C(39130), UINT16_C(23865), UINT16_C(50299), UINT16_C(10706), UINT16_C( 2005), UINT16_C(43905),
+      UINT16_C(18187), UINT16_C( 3718), UINT16_C(23792), UINT16_C(35133), UINT16_C(49961), UINT16_C(23434), UINT16_C(44804), UINT16_C(56855),
+      UINT16_C(20585), UINT16_C(17445), UINT16_C(24297), UINT16_C(25761), UINT16_C(29475), UINT16_C(63630), UINT16_C( 3962), UINT16_C(34211),
+      UINT16_C(10838), UINT16_C(18067), UINT16_C(53638), UINT16_C(45264), UINT16_C(23188), UINT16_C(38923), UINT16_C( 8713), UINT16_C(29303),
+      UINT16_C(40051), UINT16_C(23734), UINT16_C(22523), UINT16_C( 7872), UINT16_C(20171), UINT16_C(17686), UINT16_C(47709), UINT16_C(46027),
+      UINT16_C(24292), UINT16_C(27386), UINT16_C(51759), UINT16_C(50202), UINT16_C( 9508), UINT16_C(11612), UINT16_C(54088), UINT16_C(48031),
+      UINT16_C(22128), UINT16_C(27415), UINT16_C(55213), UINT16_C(30857), UINT16_C(40742), UINT16_C(33726), UINT16_C(35161), UINT16_C(15671),
+      UINT16_C(12775), UINT16_C( 6056), UINT16_C(49915), UINT16_C( 8155), UINT16_C(14312), UINT16_C(12364), UINT16_C(60171), UINT16_C(31723),
+      UINT16_C(  577), UINT16_C(61414), UINT16_C(28633), UINT16_C(65383), UINT16_C( 9486), UINT16_C(26755), UINT16_C(47790), UINT16_C(38565),
+      UINT16_C(19947), UINT16_C(59053), UINT16_C(34832), UINT16_C(63493), UINT16_C(20927), UINT16_C(51752), UINT16_C( 4924), UINT16_C(32325),
+      UINT16_C(11029), UINT16_C(61037), UINT16_C(54426), UINT16_C(43502), UINT16_C(29178), UINT16_C(43025), UINT16_C(46635), UINT16_C( 5694),
+      UINT16_C(60164), UINT16_C( 5372), UINT16_C(  371), UINT16_C(13068), UINT16_C(13394), UINT16_C(36605), UINT16_C(17223), UINT16_C(23564),
+      UINT16_C(31086), UINT16_C( 2378), UINT16_C(14414), UINT16_C(18610), UINT16_C(50089), UINT16_C(54512), UINT16_C(12153), UINT16_C(32234),
+      UINT16_C(58906), UINT16_C(36497), UINT16_C(40423), UINT16_C(14785), UINT16_C(48849), UINT16_C( 6344), UINT16_C(54273), UINT16_C(28788),
+      UINT16_C(48974), UINT16_C(40057), UINT16_C(11255), UINT16_C(41444), UINT16_C(54510), UINT16_C(26485), UINT16_C(24579), UINT16_C( 7909),
+      UINT16_C(30278), UINT16_C(11948), UINT16_C(27924), UINT16_C(58727), UINT16_C(12075), UINT16_C(11774), UINT16_C(29188), UINT16_C(21149),
+      UINT16_C( 5681), UINT16_C(10734), UINT16_C(53825), UINT16_C(12234), UINT16_C(16294), UINT16_C(43670), UINT16_C(31647), UINT16_C(59080),
+      UINT16_C(29938), UINT16_C( 1556), UINT16_C(31713), UINT16_C( 3307), UINT16_C(59819), UINT16_C(44857), UINT16_C(54876), UINT16_C(36097),
+      UINT16_C(61420), UINT16_C(11702), UINT16_C(32961), UINT16_C(26460), UINT16_C(62400), UINT16_C(24337), UINT16_C(55662), UINT16_C(24645),
+      UINT16_C(22861), UINT16_C(11878), UINT16_C(21205), UINT16_C(32827), UINT16_C(29755), UINT16_C(38703), UINT16_C(12363), UINT16_C(14117),
+      UINT16_C(56095), UINT16_C(57445), UINT16_C(49500), UINT16_C( 7239), UINT16_C(22964), UINT16_C( 9083), UINT16_C(49458), UINT16_C(32899),
+      UINT16_C(59930), UINT16_C(61358), UINT16_C(59708), UINT16_C(30575), UINT16_C(40542), UINT16_C(43279), UINT16_C(13518), UINT16_C(60896),
+      UINT16_C(17679), UINT16_C(27597), UINT16_C( 5383), UINT16_C(48007), UINT16_C(  878), UINT16_C(41182), UINT16_C(25284), UINT16_C(56864),
+      UINT16_C(53068), UINT16_C(35022), UINT16_C(15800), UINT16_C( 5887), UINT16_C( 3804), UINT16_C(43711), UINT16_C(41026) };
+  static const uint16_t c[] =
+    { UINT16_C(18232), UINT16_C(12825), UINT16_C(15612), UINT16_C( 7083), UINT16_C(62678), UINT16_C(24389), UINT16_C(28344), UINT16_C(53230),
+      UINT16_C(55258), UINT16_C(32442), UINT16_C(46326), UINT16_C(42866), UINT16_C(61566), UINT16_C(46087), UINT16_C(37635), UINT16_C(15193),
+      UINT16_C(29659), UINT16_C(55149), UINT16_C( 6319), UINT16_C(34290), UINT16_C(14093), UINT16_C(50660), UINT16_C(53926), UINT16_C(32916),
+      UINT16_C(20393), UINT16_C(41214), UINT16_C(28931), UINT16_C(33351), UINT16_C(20065), UINT16_C(25654), UINT16_C(36834), UINT16_C(48544),
+      UINT16_C( 3330), UINT16_C(45460), UINT16_C(34598), UINT16_C(13110), UINT16_C( 6846), UINT16_C(25848), UINT16_C(36333), UINT16_C(38629),
+      UINT16_C(58332), UINT16_C(57142), UINT16_C(32084), UINT16_C(46689), UINT16_C(38860), UINT16_C(44570), UINT16_C(47655), UINT16_C(10603),
+      UINT16_C(65480), UINT16_C(61147), UINT16_C( 4486), UINT16_C(17697), UINT16_C( 6444), UINT16_C( 6569), UINT16_C(36518), UINT16_C(33455),
+      UINT16_C(58994), UINT16_C(50786), UINT16_C(50019), UINT16_C(12156), UINT16_C(38747), UINT16_C(33501), UINT16_C(18513), UINT16_C( 6571),
+      UINT16_C(34376), UINT16_C(52743), UINT16_C(10392), UINT16_C(50195), UINT16_C(48450), UINT16_C(59613), UINT16_C(35915), UINT16_C(48491),
+      UINT16_C(52594), UINT16_C(54916), UINT16_C(  144), UINT16_C(60165), UINT16_C(58263), UINT16_C(59757), UINT16_C( 6443), UINT16_C(29442),
+      UINT16_C( 2719), UINT16_C(14146), UINT16_C(21810), UINT16_C(29947), UINT16_C(55314), UINT16_C(24157), UINT16_C(51301), UINT16_C(55067),
+      UINT16_C(40853), UINT16_C( 9645), UINT16_C(45984), UINT16_C(14097), UINT16_C(32406), UINT16_C(49440), UINT16_C( 9111), UINT16_C(14133),
+      UINT16_C(30509), UINT16_C(24430), UINT16_C(27340), UINT16_C(57300), UINT16_C(12610), UINT16_C(42813), UINT16_C(22777), UINT16_C(36479),
+      UINT16_C(11512), UINT16_C(39091), UINT16_C(50399), UINT16_C(30159), UINT16_C(61507), UINT16_C(55863), UINT16_C(27667), UINT16_C(16401),
+      UINT16_C(32995), UINT16_C(44959), UINT16_C(29674), UINT16_C(11406), UINT16_C(52132), UINT16_C(40404), UINT16_C(21284), UINT16_C( 7211),
+      UINT16_C(57215), UINT16_C(24500), UINT16_C(33699), UINT16_C(59092), UINT16_C( 2931), UINT16_C(34497), UINT16_C(53879), UINT16_C(23238),
+      UINT16_C(26194), UINT16_C(15370), UINT16_C(39129), UINT16_C(32361), UINT16_C(15716), UINT16_C(34843), UINT16_C(18320), UINT16_C( 4004),
+      UINT16_C(22566), UINT16_C(51566), UINT16_C(17371), UINT16_C(20400), UINT16_C(29006), UINT16_C(50901), UINT16_C(40003), UINT16_C(38432),
+      UINT16_C(10754), UINT16_C(56274), UINT16_C(15299), UINT16_C(10073), UINT16_C(30072), UINT16_C( 2223), UINT16_C(21436), UINT16_C(57880),
+      UINT16_C(34475), UINT16_C(34475), UINT16_C(23497), UINT16_C( 6357), UINT16_C(43980), UINT16_C( 4318), UINT16_C(65095), UINT16_C(18854),
+      UINT16_C(30761), UINT16_C(60452), UINT16_C(32436), UINT16_C(11283), UINT16_C(49907), UINT16_C(44853), UINT16_C(19733), UINT16_C(49297),
+      UINT16_C(15571), UINT16_C(40262), UINT16_C( 7320), UINT16_C(25781), UINT16_C(37831), UINT16_C( 3700), UINT16_C( 6801), UINT16_C(47703),
+      UINT16_C(31635), UINT16_C(18342), UINT16_C(47609), UINT16_C(60531), UINT16_C(43131), UINT16_C(37019), UINT16_C(11509), UINT16_C(51536),
+      UINT16_C(38761), UINT16_C(  358), UINT16_C( 7091), UINT16_C(31333), UINT16_C(55982), UINT16_C(16264), UINT16_C(57332), UINT16_C(34810),
+      UINT16_C(41050), UINT16_C(21710), UINT16_C(16986), UINT16_C(54592), UINT16_C(56554), UINT16_C(57446), UINT16_C(46600), UINT16_C(29097),
+      UINT16_C( 3917), UINT16_C(  114), UINT16_C(55338), UINT16_C(55418), UINT16_C(  690), UINT16_C(42519), UINT16_C( 4577), UINT16_C(15406),
+      UINT16_C(64690), UINT16_C( 3216), UINT16_C(53310), UINT16_C(10721), UINT16_C(18348), UINT16_C(46345), UINT16_C(45822), UINT16_C(19238),
+      UINT16_C(39361), UINT16_C(60236), UINT16_C(50801), UINT16_C( 9155), UINT16_C(56009), UINT16_C(43721), UINT16_C(63468), UINT16_C(40678),
+      UINT16_C(30452), UINT16_C(12970), UINT16_C(35655), UINT16_C(62299), UINT16_C(25811), UINT16_C(53672), UINT16_C(53014), UINT16_C(55068),
+      UINT16_C(26728), UINT16_C(55746), UINT16_C(34095), UINT16_C(63740), UINT16_C(50528), UINT16_C(19618), UINT16_C(35261), UINT16_C(45546),
+      UINT16_C(38143), UINT16_C(18147), UINT16_C(16159), UINT16_C(62010), UINT16_C(58019), UINT16_C(47811), UINT16_C(57521), UINT16_C( 6545),
+      UINT16_C(21576), UINT16_C(30706), UINT16_C(61145), UINT16_C(14703), UINT16_C( 4788), UINT16_C(29061), UINT16_C(28571), UINT16_C(39458),
+      UINT16_C( 1283), UINT16_C( 9185), UINT16_C( 6980), UINT16_C(59413), UINT16_C(55805), UINT16_C(44962), UINT16_C(13241), UINT16_C(  456),
+      UINT16_C(48007), UINT16_C(24953), UINT16_C(59561), UINT16_C(23962), UINT16_C( 8442), UINT16_C(38350), UINT16_C(61583), UINT16_C(37680),
+      UINT16_C( 4598), UINT16_C(15030), UINT16_C(52012), UINT16_C(10530), UINT16_C(50340), UINT16_C(24024), UINT16_C(41464), UINT16_C(32607),
+      UINT16_C(55388), UINT16_C( 1504), UINT16_C(31680), UINT16_C(47971), UINT16_C(12699), UINT16_C(10832), UINT16_C(32802), UINT16_C( 6333),
+      UINT16_C(29585), UINT16_C(48466), UINT16_C(30015), UINT16_C(58343), UINT16_C(48953), UINT16_C(12609), UINT16_C(41056), UINT16_C(48305),
+      UINT16_C(37240), UINT16_C(14530), UINT16_C( 9484), UINT16_C(42995), UINT16_C(17494), UINT16_C(30930), UINT16_C(36804), UINT16_C(22160),
+      UINT16_C(58115), UINT16_C(16915), UINT16_C(64088), UINT16_C(37157), UINT16_C(26298), UINT16_C( 6851), UINT16_C(29702), UINT16_C(32471),
+      UINT16_C(39173), UINT16_C( 4791), UINT16_C(43710), UINT16_C( 5305), UINT16_C(35822), UINT16_C(45965), UINT16_C( 7451), UINT16_C( 7689),
+      UINT16_C( 7168), UINT16_C(22624), UINT16_C(34071), UINT16_C(53738), UINT16_C(44524), UINT16_C(62187), UINT16_C(49697), UINT16_C( 9841),
+      UINT16_C(10331), UINT16_C( 6456), UINT16_C(62162), UINT16_C(49454), UINT16_C(47997), UINT16_C(39028), UINT16_C(32216), UINT16_C(55734),
+      UINT16_C( 5785), UINT16_C(45105), UINT16_C( 7068), UINT16_C(34945), UINT16_C(28104), UINT16_C(59770), UINT16_C(60207), UINT16_C(35600),
+      UINT16_C(18451), UINT16_C(59044), UINT16_C(53818), UINT16_C(47271), UINT16_C( 7053), UINT16_C(26192), UINT16_C( 1944), UINT16_C(12607),
+      UINT16_C(28701), UINT16_C(47586), UINT16_C(25484), UINT16_C(21569), UINT16_C(48336), UINT16_C(   62), UINT16_C(20135), UINT16_C(48011),
+      UINT16_C(12182), UINT16_C(53665), UINT16_C(18434), UINT16_C(36745), UINT16_C(55651), UINT16_C(64501), UINT16_C(13536), UINT16_C(65068),
+      UINT16_C( 3749), UINT16_C(12727), UINT16_C(63858), UINT16_C(17029), UINT16_C(50101), UINT16_C(23618), UINT16_C(52497), UINT16_C(43031),
+      UINT16_C(47357), UINT16_C(65401), UINT16_C(  512), UINT16_C(25486), UINT16_C(34011), UINT16_C(48222), UINT16_C(35768), UINT16_C(23994),
+      UINT16_C(29081), UINT16_C( 2958), UINT16_C( 5226), UINT16_C( 8014), UINT16_C(37079), UINT16_C(59772), UINT16_C(37726), UINT16_C(23441),
+      UINT16_C( 2636), UINT16_C(19546), UINT16_C(59404), UINT16_C(59312), UINT16_C( 3692), UINT16_C( 9635), UINT16_C(23961), UINT16_C(13186),
+      UINT16_C( 4559), UINT16_C(14654), UINT16_C(35877), UINT16_C(64601), UINT16_C(54557), UINT16_C(31717), UINT16_C(30312) };
+  static const uint16_t e[] =
+    { UINT16_C(29718), UINT16_C(34949), UINT16_C(57396), UINT16_C(    0), UINT16_C(    0), UINT16_C( 9516), UINT16_C(19236), UINT16_C(21542),
+      UINT16_C(    0), UINT16_C(20820), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(20926), UINT16_C(    0), UINT16_C(59829),
+      UINT16_C(    0), UINT16_C(46399), UINT16_C( 9917), UINT16_C(    0), UINT16_C(    0), UINT16_C(50575), UINT16_C(    0), UINT16_C(36675),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(52715), UINT16_C(63684), UINT16_C(    0), UINT16_C(    0), UINT16_C(44060),
+      UINT16_C(36364), UINT16_C( 1720), UINT16_C(    0), UINT16_C(38542), UINT16_C(    0), UINT16_C(    0), UINT16_C(56543), UINT16_C(25635),
+      UINT16_C(    0), UINT16_C(20556), UINT16_C(60107), UINT16_C(14109), UINT16_C( 1992), UINT16_C(    0), UINT16_C(13812), UINT16_C(25840),
+      UINT16_C(    0), UINT16_C(52498), UINT16_C(35590), UINT16_C(55645), UINT16_C(18232), UINT16_C(    0), UINT16_C( 6862), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(26483), UINT16_C( 7580), UINT16_C(    0), UINT16_C(33261), UINT16_C(61841), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(13744), UINT16_C(25683), UINT16_C(14856), UINT16_C(    0), UINT16_C(18970), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(30581), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(14346),
+      UINT16_C(39788), UINT16_C(    0), UINT16_C(58354), UINT16_C(22800), UINT16_C(    0), UINT16_C(25211), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(53927), UINT16_C(    0), UINT16_C(38059), UINT16_C(    0), UINT16_C(    0), UINT16_C(55776), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(38582), UINT16_C(    0), UINT16_C(35673), UINT16_C(    0), UINT16_C(63699),
+      UINT16_C(    0), UINT16_C(38058), UINT16_C(40743), UINT16_C(14933), UINT16_C(36463), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(33459), UINT16_C(58213), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(22971), UINT16_C(28412), UINT16_C(    0),
+      UINT16_C(62452), UINT16_C(    0), UINT16_C(20231), UINT16_C(    0), UINT16_C( 9597), UINT16_C(63521), UINT16_C( 5617), UINT16_C(63146),
+      UINT16_C(    0), UINT16_C(20530), UINT16_C(39417), UINT16_C(34179), UINT16_C(21044), UINT16_C(    0), UINT16_C(38952), UINT16_C(35188),
+      UINT16_C(29658), UINT16_C(    0), UINT16_C(34018), UINT16_C( 9494), UINT16_C(14984), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(23832), UINT16_C(43560), UINT16_C(55573), UINT16_C(    0), UINT16_C(    0), UINT16_C(54723), UINT16_C(    0),
+      UINT16_C(13847), UINT16_C(    0), UINT16_C(    0), UINT16_C(40525), UINT16_C(62540), UINT16_C(28510), UINT16_C(39963), UINT16_C(    0),
+      UINT16_C(37753), UINT16_C(55712), UINT16_C( 2012), UINT16_C( 3283), UINT16_C(    0), UINT16_C(    0), UINT16_C( 7261), UINT16_C(58089),
+      UINT16_C(15747), UINT16_C(44624), UINT16_C(    0), UINT16_C(13726), UINT16_C(35867), UINT16_C(13564), UINT16_C(46213), UINT16_C(33140),
+      UINT16_C(    0), UINT16_C(58802), UINT16_C(34017), UINT16_C(24341), UINT16_C(41415), UINT16_C(18027), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(10618), UINT16_C(    0), UINT16_C(31953), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(48610),
+      UINT16_C(43681), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(28210), UINT16_C(    0), UINT16_C( 6308), UINT16_C( 8815),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(24272), UINT16_C( 9239), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C( 4224), UINT16_C(    0), UINT16_C(    0), UINT16_C( 3812), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(43169), UINT16_C(    0), UINT16_C(    0), UINT16_C(17307), UINT16_C(    0), UINT16_C(43938),
+      UINT16_C(21369), UINT16_C(19414), UINT16_C(45543), UINT16_C(    0), UINT16_C(29249), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(45933), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(29221), UINT16_C(12641),
+      UINT16_C(    0), UINT16_C(50687), UINT16_C(40827), UINT16_C( 4794), UINT16_C(    0), UINT16_C(    0), UINT16_C( 7093), UINT16_C(47951),
+      UINT16_C(60345), UINT16_C(    0), UINT16_C(46609), UINT16_C(44079), UINT16_C(35914), UINT16_C(54699), UINT16_C( 5765), UINT16_C( 4331),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(18985), UINT16_C(    0), UINT16_C(60389), UINT16_C( 3590), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(41735), UINT16_C(    0), UINT16_C(    0), UINT16_C(31449), UINT16_C(13994), UINT16_C(    0), UINT16_C(    0), UINT16_C(10432),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(61534), UINT16_C(50676), UINT16_C(    0), UINT16_C( 2944), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(12656), UINT16_C(    0), UINT16_C(65401), UINT16_C(    0), UINT16_C(    0), UINT16_C(22396), UINT16_C(    0), UINT16_C(18857),
+      UINT16_C(    0), UINT16_C( 7373), UINT16_C(29807), UINT16_C(64990), UINT16_C(    0), UINT16_C(    0), UINT16_C(23120), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(52772), UINT16_C(    0), UINT16_C(28031), UINT16_C(17984),
+      UINT16_C(    0), UINT16_C(25043), UINT16_C(63343), UINT16_C(    0), UINT16_C(46918), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(58303), UINT16_C(    0), UINT16_C(33012), UINT16_C(51217), UINT16_C(    0), UINT16_C(18013), UINT16_C(    0), UINT16_C(42079),
+      UINT16_C(54334), UINT16_C(41266), UINT16_C(21099), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(33445),
+      UINT16_C(    0), UINT16_C(62811), UINT16_C(    0), UINT16_C(34890), UINT16_C(38513), UINT16_C(    0), UINT16_C(    0), UINT16_C(22302),
+      UINT16_C(  253), UINT16_C(    0), UINT16_C(26056), UINT16_C(50829), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C( 5154), UINT16_C(42042), UINT16_C(51704), UINT16_C(14653), UINT16_C(    0), UINT16_C(    0), UINT16_C( 4188), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(28654), UINT16_C(    0), UINT16_C( 8120), UINT16_C(    0), UINT16_C(    0), UINT16_C(50672),
+      UINT16_C(45218), UINT16_C(48457), UINT16_C(    0), UINT16_C(44377), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(14391),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(39544), UINT16_C(62480), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(43371), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(22571), UINT16_C( 4742), UINT16_C(10922), UINT16_C(38930), UINT16_C(    0), UINT16_C(13536), UINT16_C(    0), UINT16_C(21745),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 6074), UINT16_C(39988), UINT16_C(11075), UINT16_C(12737), UINT16_C(38210),
+      UINT16_C(58415), UINT16_C(26576), UINT16_C(39205), UINT16_C(    0), UINT16_C(    0), UINT16_C( 8335), UINT16_C(    0) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i])),
+      cv = simde_svld1_u16(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmad_u16_z(pv, av, bv, cv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], c[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+    cv = simde_svld1_u16(pg, &(c[i]));
+
+    ev = simde_svmad_u16_z(pv, av, bv, cv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(56802), UINT16_C(37490), UINT16_C(39106), UINT16_C(36810), UINT16_C(16827), UINT16_C(19694), UINT16_C(43432), UINT16_C(50015),
+      UINT16_C(44745), UINT16_C(39535), UINT16_C(46872), UINT16_C(28409), UINT16_C(54881), UINT16_C(17395), UINT16_C(39102), UINT16_C(41351),
+      UINT16_C(64118), UINT16_C(14387), UINT16_C(64914), UINT16_C(19911), UINT16_C(46398), UINT16_C(59290), UINT16_C(63838), UINT16_C(10154),
+      UINT16_C( 6823), UINT16_C(49345), UINT16_C(47825), UINT16_C(12846), UINT16_C( 8592), UINT16_C(20342), UINT16_C(64954), UINT16_C(12528),
+      UINT16_C( 9207), UINT16_C(35432), UINT16_C(12064), UINT16_C(24535), UINT16_C(29156), UINT16_C(16966), UINT16_C(61547), UINT16_C( 4713),
+      UINT16_C(10762), UINT16_C(56530), UINT16_C(  228), UINT16_C(29966), UINT16_C(33826), UINT16_C(56516), UINT16_C(46210), UINT16_C(30988),
+      UINT16_C(29911), UINT16_C(63235), UINT16_C(56227), UINT16_C(34646), UINT16_C(40012), UINT16_C(47049), UINT16_C(12941), UINT16_C(38858),
+      UINT16_C(40028), UINT16_C(16499), UINT16_C(33437), UINT16_C(49077), UINT16_C(30982), UINT16_C(34971), UINT16_C(42797), UINT16_C( 1026),
+      UINT16_C( 1307), UINT16_C(48892), UINT16_C(21216), UINT16_C(11589), UINT16_C( 3823), UINT16_C(31972), UINT16_C(44608), UINT16_C(39955),
+      UINT16_C(34635), UINT16_C(59612), UINT16_C(37385), UINT16_C( 4007), UINT16_C(16907), UINT16_C(14744), UINT16_C(39657), UINT16_C( 1085),
+      UINT16_C(14751), UINT16_C(32962), UINT16_C( 1932), UINT16_C(31661), UINT16_C(37141), UINT16_C(22007), UINT16_C( 2624), UINT16_C(35825),
+      UINT16_C(52625), UINT16_C(39539), UINT16_C( 6751), UINT16_C(27562), UINT16_C(16988), UINT16_C(17828), UINT16_C(57820), UINT16_C(31561),
+      UINT16_C( 2843), UINT16_C(43003), UINT16_C(43026), UINT16_C(10018), UINT16_C( 6458), UINT16_C(31356), UINT16_C(27939), UINT16_C(46341),
+      UINT16_C(30778), UINT16_C(39503), UINT16_C(63890), UINT16_C(60933), UINT16_C(43323), UINT16_C( 5939), UINT16_C(31882), UINT16_C(42387),
+      UINT16_C(36487), UINT16_C(39244), UINT16_C(28215), UINT16_C(29120), UINT16_C(15495), UINT16_C(44011), UINT16_C(61609), UINT16_C(58208),
+      UINT16_C(44904), UINT16_C(64125), UINT16_C(33449), UINT16_C(58600), UINT16_C( 6955), UINT16_C(46844), UINT16_C(36759), UINT16_C( 7771),
+      UINT16_C(43037), UINT16_C(21687), UINT16_C(30486), UINT16_C(40645), UINT16_C(45235), UINT16_C(23625), UINT16_C(43424), UINT16_C( 2111),
+      UINT16_C(48472), UINT16_C(  258), UINT16_C(59967), UINT16_C(27622), UINT16_C(57861), UINT16_C(39969), UINT16_C(31857), UINT16_C(36538),
+      UINT16_C(28964), UINT16_C(15331), UINT16_C(43240), UINT16_C(39897), UINT16_C( 8793), UINT16_C(63991), UINT16_C(14283), UINT16_C( 8962),
+      UINT16_C( 1268), UINT16_C(13093), UINT16_C( 3055), UINT16_C(62622), UINT16_C(49133), UINT16_C(24209), UINT16_C(19260), UINT16_C(24812),
+      UINT16_C(53181), UINT16_C(42395), UINT16_C(29816), UINT16_C(53569), UINT16_C(14486), UINT16_C(25034), UINT16_C(52335), UINT16_C(25477),
+      UINT16_C(43729), UINT16_C(49303), UINT16_C(13749), UINT16_C(41652), UINT16_C(17909), UINT16_C(12544), UINT16_C(60561), UINT16_C(20113),
+      UINT16_C(11708), UINT16_C(13555), UINT16_C(13473), UINT16_C(14341), UINT16_C(53101), UINT16_C(56473), UINT16_C( 7836), UINT16_C(27968),
+      UINT16_C(55240), UINT16_C(32045), UINT16_C(57612), UINT16_C(  287), UINT16_C( 7975), UINT16_C(47154), UINT16_C(50188), UINT16_C(51206),
+      UINT16_C(63985), UINT16_C(37628), UINT16_C(  302), UINT16_C(39882), UINT16_C(25808), UINT16_C(27767), UINT16_C(46978), UINT16_C(19417),
+      UINT16_C( 1678), UINT16_C(39880), UINT16_C(59624), UINT16_C( 3996), UINT16_C(52999), UINT16_C( 5063), UINT16_C(52627), UINT16_C(34011),
+      UINT16_C(55238), UINT16_C(62486), UINT16_C(57816), UINT16_C(43407), UINT16_C( 1861), UINT16_C(50965), UINT16_C(61374), UINT16_C(19730),
+      UINT16_C(56309), UINT16_C(56808), UINT16_C(33987), UINT16_C(51948), UINT16_C(45907), UINT16_C(59102), UINT16_C(47488), UINT16_C(18282),
+      UINT16_C(33169), UINT16_C(26939), UINT16_C(52066), UINT16_C(42770), UINT16_C(10450), UINT16_C(36974), UINT16_C(33047), UINT16_C( 3293),
+      UINT16_C(50524), UINT16_C( 8170), UINT16_C(54858), UINT16_C(40425), UINT16_C(51082), UINT16_C( 2692), UINT16_C(61057), UINT16_C( 4689),
+      UINT16_C(36207), UINT16_C(53627), UINT16_C(36440), UINT16_C(10872), UINT16_C(59318), UINT16_C(52666), UINT16_C(39016), UINT16_C(50393),
+      UINT16_C(50013), UINT16_C(42979), UINT16_C(52378), UINT16_C( 9285), UINT16_C(51604), UINT16_C( 5422), UINT16_C(32951), UINT16_C(10023),
+      UINT16_C(41485), UINT16_C(26104), UINT16_C(28976), UINT16_C(59023), UINT16_C(18776), UINT16_C(49331), UINT16_C(36321), UINT16_C(16260),
+      UINT16_C(26448), UINT16_C(60134), UINT16_C(11059), UINT16_C(50958), UINT16_C(15860), UINT16_C(44252), UINT16_C(  957), UINT16_C(51923),
+      UINT16_C(52134), UINT16_C(54831), UINT16_C(48700), UINT16_C(38077), UINT16_C(28679), UINT16_C(59732), UINT16_C(55549), UINT16_C(20008),
+      UINT16_C( 3647), UINT16_C(29496), UINT16_C(18234), UINT16_C(11834), UINT16_C( 6020), UINT16_C(16858), UINT16_C(44314), UINT16_C(49163),
+      UINT16_C(14969), UINT16_C(46487), UINT16_C(21752), UINT16_C(65354), UINT16_C(40644), UINT16_C(49896), UINT16_C( 4215), UINT16_C(46608),
+      UINT16_C(18463), UINT16_C(22825), UINT16_C(25743), UINT16_C( 4999), UINT16_C(25211), UINT16_C(38228), UINT16_C(24335), UINT16_C(34902),
+      UINT16_C(60825), UINT16_C(37182), UINT16_C(34881), UINT16_C( 1425), UINT16_C(31014), UINT16_C(40391), UINT16_C(55178), UINT16_C(43348),
+      UINT16_C(32032), UINT16_C(44802), UINT16_C(35297), UINT16_C(23747), UINT16_C( 6123), UINT16_C(64498), UINT16_C(18551), UINT16_C( 4227),
+      UINT16_C(49461), UINT16_C(30370), UINT16_C(13129), UINT16_C(28795), UINT16_C(17324), UINT16_C(13837), UINT16_C(24858), UINT16_C(15071),
+      UINT16_C(57823), UINT16_C(49386), UINT16_C(44395), UINT16_C(22045), UINT16_C( 4036), UINT16_C(15185), UINT16_C(54615), UINT16_C(35916),
+      UINT16_C(61078), UINT16_C(57346), UINT16_C(32033), UINT16_C(52560), UINT16_C(24000), UINT16_C(56068), UINT16_C(58303), UINT16_C(40469),
+      UINT16_C(65477), UINT16_C(12382), UINT16_C(31660), UINT16_C(29062), UINT16_C(55434), UINT16_C(57772), UINT16_C(63661), UINT16_C(17261),
+      UINT16_C(28646), UINT16_C( 1827), UINT16_C(29677), UINT16_C(44501), UINT16_C(55761), UINT16_C(37000), UINT16_C(40636), UINT16_C(33070),
+      UINT16_C(35997), UINT16_C(19121), UINT16_C(14344), UINT16_C(37563), UINT16_C(26384), UINT16_C(48500), UINT16_C(57696), UINT16_C(17920),
+      UINT16_C( 9297), UINT16_C(15950), UINT16_C( 9111), UINT16_C(26859), UINT16_C(29948), UINT16_C(47352), UINT16_C( 9746), UINT16_C(44858),
+      UINT16_C(60339), UINT16_C(48121) };
+  static const uint16_t b[] =
+    { UINT16_C(34574), UINT16_C(13466), UINT16_C(24819), UINT16_C(23465), UINT16_C(46300), UINT16_C(36296), UINT16_C(51441), UINT16_C( 8983),
+      UINT16_C(43657), UINT16_C(32214), UINT16_C(20399), UINT16_C(12455), UINT16_C(10424), UINT16_C( 1915), UINT16_C(36680), UINT16_C(22030),
+      UINT16_C(43030), UINT16_C( 2698), UINT16_C(13064), UINT16_C(58469), UINT16_C(11751), UINT16_C(55409), UINT16_C(35062), UINT16_C(32763),
+      UINT16_C(53555), UINT16_C(58108), UINT16_C(41760), UINT16_C(55315), UINT16_C(36555), UINT16_C( 5088), UINT16_C(60958), UINT16_C(13417),
+      UINT16_C(62358), UINT16_C(40510), UINT16_C(41766), UINT16_C( 3458), UINT16_C(62673), UINT16_C(51173), UINT16_C(57468), UINT16_C(44870),
+      UINT16_C(17073), UINT16_C(53650), UINT16_C(42469), UINT16_C(45226), UINT16_C(35379), UINT16_C(20931), UINT16_C(11384), UINT16_C( 3718),
+      UINT16_C(50207), UINT16_C(17836), UINT16_C(11880), UINT16_C(14674), UINT16_C(14114), UINT16_C(40704), UINT16_C(17943), UINT16_C(51278),
+      UINT16_C(57480), UINT16_C(28057), UINT16_C(17285), UINT16_C(47389), UINT16_C(57549), UINT16_C(17674), UINT16_C(36876), UINT16_C(11091),
+      UINT16_C(65365), UINT16_C(48496), UINT16_C(49710), UINT16_C(20726), UINT16_C(63225), UINT16_C( 4335), UINT16_C(15932), UINT16_C(50392),
+      UINT16_C(28958), UINT16_C(42033), UINT16_C(20149), UINT16_C(33373), UINT16_C(26414), UINT16_C(15048), UINT16_C( 7160), UINT16_C(19813),
+      UINT16_C(54555), UINT16_C(18698), UINT16_C(  151), UINT16_C(37017), UINT16_C(35318), UINT16_C(12960), UINT16_C(30919), UINT16_C(58870),
+      UINT16_C(10217), UINT16_C(40585), UINT16_C(58997), UINT16_C(41761), UINT16_C(59726), UINT16_C(18141), UINT16_C(16900), UINT16_C( 8083),
+      UINT16_C(40215), UINT16_C(44648), UINT16_C(  669), UINT16_C(37694), UINT16_C(56971), UINT16_C(21189), UINT16_C(47958), UINT16_C(16183),
+      UINT16_C(49634), UINT16_C(22494), UINT16_C(65447), UINT16_C(62970), UINT16_C(55272), UINT16_C(60475), UINT16_C(52761), UINT16_C(12300),
+      UINT16_C(29803), UINT16_C( 2270), UINT16_C( 7286), UINT16_C(  411), UINT16_C(24826), UINT16_C(20563), UINT16_C(35611), UINT16_C(64911),
+      UINT16_C(27980), UINT16_C(62292), UINT16_C(20076), UINT16_C(21737), UINT16_C( 9253), UINT16_C(15937), UINT16_C(19955), UINT16_C(24174),
+      UINT16_C(19649), UINT16_C(14439), UINT16_C(  616), UINT16_C(25145), UINT16_C(36195), UINT16_C(32434), UINT16_C(16920), UINT16_C(25724),
+      UINT16_C(53423), UINT16_C( 7255), UINT16_C(16415), UINT16_C(17520), UINT16_C(45413), UINT16_C(22659), UINT16_C(61950), UINT16_C(49334),
+      UINT16_C( 7486), UINT16_C(42744), UINT16_C(12576), UINT16_C(33545), UINT16_C(48062), UINT16_C(54785), UINT16_C(32253), UINT16_C(44346),
+      UINT16_C(37454), UINT16_C(28105), UINT16_C(14802), UINT16_C(14257), UINT16_C(13547), UINT16_C(59791), UINT16_C(17958), UINT16_C(25769),
+      UINT16_C(41315), UINT16_C(33546), UINT16_C( 5075), UINT16_C(37126), UINT16_C( 2255), UINT16_C(52328), UINT16_C(41605), UINT16_C(54137),
+      UINT16_C(16948), UINT16_C( 1856), UINT16_C(62076), UINT16_C(26430), UINT16_C(52774), UINT16_C(19536), UINT16_C(64020), UINT16_C(30640),
+      UINT16_C(48027), UINT16_C(28411), UINT16_C(  462), UINT16_C(40192), UINT16_C(26633), UINT16_C(36714), UINT16_C(58122), UINT16_C(16226),
+      UINT16_C(41766), UINT16_C(41542), UINT16_C(33941), UINT16_C(47881), UINT16_C(22866), UINT16_C(26120), UINT16_C(47187), UINT16_C(61406),
+      UINT16_C(55667), UINT16_C(16989), UINT16_C(24026), UINT16_C(58591), UINT16_C(18885), UINT16_C(53363), UINT16_C(54573), UINT16_C(21263),
+      UINT16_C(21880), UINT16_C( 3573), UINT16_C(65241), UINT16_C(11465), UINT16_C(53591), UINT16_C(43922), UINT16_C(28809), UINT16_C(64922),
+      UINT16_C(63305), UINT16_C( 9279), UINT16_C( 7765), UINT16_C( 6664), UINT16_C(31592), UINT16_C(38378), UINT16_C(63824), UINT16_C(51688),
+      UINT16_C(56654), UINT16_C(10454), UINT16_C(40923), UINT16_C(12884), UINT16_C(58992), UINT16_C(64221), UINT16_C(30551), UINT16_C(41207),
+      UINT16_C(13935), UINT16_C(50372), UINT16_C(52308), UINT16_C(48350), UINT16_C(51527), UINT16_C(38993), UINT16_C(14786), UINT16_C( 4449),
+      UINT16_C(14102), UINT16_C(61753), UINT16_C(36311), UINT16_C(18212), UINT16_C(  371), UINT16_C(51777), UINT16_C(14457), UINT16_C(59499),
+      UINT16_C(12142), UINT16_C(50092), UINT16_C(35580), UINT16_C(17279), UINT16_C(53587), UINT16_C( 5851), UINT16_C(15370), UINT16_C( 8487),
+      UINT16_C(24692), UINT16_C(19218), UINT16_C(14061), UINT16_C(24722), UINT16_C(54328), UINT16_C(45355), UINT16_C(38412), UINT16_C(31641),
+      UINT16_C(17861), UINT16_C(49470), UINT16_C(48591), UINT16_C( 8965), UINT16_C(57486), UINT16_C(39225), UINT16_C(24605), UINT16_C(37306),
+      UINT16_C(52416), UINT16_C(44508), UINT16_C(28163), UINT16_C(15117), UINT16_C(14402), UINT16_C(20460), UINT16_C(34254), UINT16_C(38090),
+      UINT16_C( 2250), UINT16_C(39253), UINT16_C(23237), UINT16_C(21692), UINT16_C(62779), UINT16_C(22765), UINT16_C(42837), UINT16_C( 5609),
+      UINT16_C(50547), UINT16_C(30402), UINT16_C(53299), UINT16_C(30385), UINT16_C(40200), UINT16_C(55237), UINT16_C(36642), UINT16_C(60523),
+      UINT16_C(49303), UINT16_C(23686), UINT16_C(16923), UINT16_C(22192), UINT16_C(40248), UINT16_C(36270), UINT16_C(38724), UINT16_C(47267),
+      UINT16_C(25948), UINT16_C(36654), UINT16_C(57397), UINT16_C(15877), UINT16_C(51837), UINT16_C(40981), UINT16_C(32857), UINT16_C(61580),
+      UINT16_C( 4672), UINT16_C(23373), UINT16_C(64853), UINT16_C(36273), UINT16_C(24475), UINT16_C(57114), UINT16_C(48630), UINT16_C(21143),
+      UINT16_C(50723), UINT16_C(22754), UINT16_C(59302), UINT16_C( 9110), UINT16_C(43954), UINT16_C( 3011), UINT16_C(20523), UINT16_C(27900),
+      UINT16_C(18786), UINT16_C(47047), UINT16_C(31046), UINT16_C(57668), UINT16_C(24536), UINT16_C(53185), UINT16_C(22556), UINT16_C(16161),
+      UINT16_C(  798), UINT16_C(50328), UINT16_C(12011), UINT16_C(40424), UINT16_C(43994), UINT16_C( 1448), UINT16_C(42235), UINT16_C(24177),
+      UINT16_C(14829), UINT16_C(13333), UINT16_C(23218), UINT16_C(35349), UINT16_C(54969), UINT16_C(54617), UINT16_C(31535), UINT16_C(19733),
+      UINT16_C(44414), UINT16_C(26898), UINT16_C(64219), UINT16_C(46342), UINT16_C(44965), UINT16_C(41403), UINT16_C(11347), UINT16_C(16895),
+      UINT16_C( 5221), UINT16_C( 6005), UINT16_C(35438), UINT16_C(10146), UINT16_C(64353), UINT16_C(37117), UINT16_C( 4726), UINT16_C(62941),
+      UINT16_C(61375), UINT16_C(39518), UINT16_C(26089), UINT16_C(36688), UINT16_C( 2836), UINT16_C(26416), UINT16_C(12087), UINT16_C(40360),
+      UINT16_C( 7491), UINT16_C(45748), UINT16_C(22184), UINT16_C( 2521), UINT16_C(54866), UINT16_C(51353), UINT16_C(30440), UINT16_C(42941),
+      UINT16_C( 7270), UINT16_C(20290) };
+  static const uint16_t c[] =
+    { UINT16_C(36483), UINT16_C(52718), UINT16_C(58617), UINT16_C( 2960), UINT16_C(58249), UINT16_C(33094), UINT16_C(56846), UINT16_C(28891),
+      UINT16_C(36821), UINT16_C(31743), UINT16_C(22736), UINT16_C(14941), UINT16_C(43464), UINT16_C(26660), UINT16_C(20546), UINT16_C(50443),
+      UINT16_C(63967), UINT16_C(55443), UINT16_C( 9181), UINT16_C(26339), UINT16_C(10503), UINT16_C( 5608), UINT16_C(49928), UINT16_C(56709),
+      UINT16_C(34130), UINT16_C( 9048), UINT16_C(46557), UINT16_C(42589), UINT16_C(33119), UINT16_C(41230), UINT16_C( 6609), UINT16_C(45158),
+      UINT16_C(63763), UINT16_C(61577), UINT16_C(27677), UINT16_C( 9303), UINT16_C(16278), UINT16_C(40505), UINT16_C(48642), UINT16_C(21883),
+      UINT16_C(54083), UINT16_C( 8568), UINT16_C(54664), UINT16_C(59335), UINT16_C(54614), UINT16_C(10120), UINT16_C(61422), UINT16_C(  472),
+      UINT16_C(25064), UINT16_C( 1522), UINT16_C(18893), UINT16_C(25385), UINT16_C(25224), UINT16_C(35329), UINT16_C(31777), UINT16_C(25823),
+      UINT16_C(22351), UINT16_C(55429), UINT16_C(19500), UINT16_C(33471), UINT16_C(18465), UINT16_C( 4266), UINT16_C(33335), UINT16_C( 7953),
+      UINT16_C(  995), UINT16_C(45093), UINT16_C(20044), UINT16_C(54292), UINT16_C( 5553), UINT16_C(53855), UINT16_C(16018), UINT16_C(57654),
+      UINT16_C(48278), UINT16_C(49849), UINT16_C(30984), UINT16_C(10821), UINT16_C(61377), UINT16_C(63546), UINT16_C(19313), UINT16_C(21527),
+      UINT16_C(15439), UINT16_C(39684), UINT16_C( 6283), UINT16_C(15472), UINT16_C(53038), UINT16_C(49166), UINT16_C(17421), UINT16_C(41889),
+      UINT16_C(23296), UINT16_C( 2406), UINT16_C(43988), UINT16_C(38195), UINT16_C(28058), UINT16_C( 2957), UINT16_C(42168), UINT16_C( 1887),
+      UINT16_C(25569), UINT16_C(27811), UINT16_C( 4988), UINT16_C(43688), UINT16_C(46818), UINT16_C(61290), UINT16_C( 3066), UINT16_C(64403),
+      UINT16_C(63846), UINT16_C(14852), UINT16_C(14244), UINT16_C(16079), UINT16_C(23716), UINT16_C(23625), UINT16_C(43009), UINT16_C(57956),
+      UINT16_C( 1803), UINT16_C(34638), UINT16_C(63002), UINT16_C(64561), UINT16_C(39852), UINT16_C(42731), UINT16_C(32423), UINT16_C( 3489),
+      UINT16_C(42359), UINT16_C( 6984), UINT16_C( 6108), UINT16_C(32857), UINT16_C(41588), UINT16_C(30173), UINT16_C(16714), UINT16_C(22103),
+      UINT16_C(42312), UINT16_C(25309), UINT16_C( 3995), UINT16_C(18270), UINT16_C(18858), UINT16_C(20973), UINT16_C(36808), UINT16_C(16223),
+      UINT16_C(42804), UINT16_C( 4443), UINT16_C(46270), UINT16_C(12945), UINT16_C(28247), UINT16_C(41383), UINT16_C(65199), UINT16_C(63479),
+      UINT16_C(54691), UINT16_C(15961), UINT16_C(47076), UINT16_C(36485), UINT16_C(29441), UINT16_C(51680), UINT16_C(16130), UINT16_C(13832),
+      UINT16_C(25574), UINT16_C(42055), UINT16_C(55576), UINT16_C(28631), UINT16_C(32327), UINT16_C(63248), UINT16_C( 2173), UINT16_C( 8430),
+      UINT16_C(18653), UINT16_C(49503), UINT16_C(58623), UINT16_C(   79), UINT16_C(12119), UINT16_C(22985), UINT16_C(53870), UINT16_C(21648),
+      UINT16_C(55093), UINT16_C(19961), UINT16_C(53424), UINT16_C(63676), UINT16_C(52558), UINT16_C(52207), UINT16_C(56789), UINT16_C(45804),
+      UINT16_C(19237), UINT16_C( 9587), UINT16_C(49711), UINT16_C(34597), UINT16_C(61426), UINT16_C(24800), UINT16_C(28865), UINT16_C(63157),
+      UINT16_C(44616), UINT16_C(63556), UINT16_C(  126), UINT16_C(52464), UINT16_C(57293), UINT16_C(41624), UINT16_C(33981), UINT16_C(57940),
+      UINT16_C(51151), UINT16_C(65031), UINT16_C(11658), UINT16_C(31877), UINT16_C(26140), UINT16_C(56796), UINT16_C(37334), UINT16_C( 7891),
+      UINT16_C( 5951), UINT16_C(48407), UINT16_C( 1816), UINT16_C(58762), UINT16_C( 8935), UINT16_C(42120), UINT16_C(56486), UINT16_C(30086),
+      UINT16_C(36516), UINT16_C(11891), UINT16_C(63931), UINT16_C(55210), UINT16_C(34399), UINT16_C(13748), UINT16_C(34584), UINT16_C(22356),
+      UINT16_C(27551), UINT16_C(46869), UINT16_C(40818), UINT16_C(22940), UINT16_C( 9409), UINT16_C(26621), UINT16_C(33793), UINT16_C(42460),
+      UINT16_C(20242), UINT16_C(52691), UINT16_C(32072), UINT16_C(42916), UINT16_C(22531), UINT16_C( 7133), UINT16_C(12767), UINT16_C(32371),
+      UINT16_C(34972), UINT16_C( 3637), UINT16_C(53799), UINT16_C(59496), UINT16_C(26102), UINT16_C(63311), UINT16_C(11241), UINT16_C(64412),
+      UINT16_C(28538), UINT16_C(50120), UINT16_C(27884), UINT16_C(61546), UINT16_C(18372), UINT16_C(41995), UINT16_C(32376), UINT16_C( 5154),
+      UINT16_C(22534), UINT16_C(11555), UINT16_C(35626), UINT16_C( 8213), UINT16_C(25840), UINT16_C(55832), UINT16_C(46223), UINT16_C( 2773),
+      UINT16_C(40484), UINT16_C( 4301), UINT16_C(14090), UINT16_C(52992), UINT16_C( 3199), UINT16_C(63347), UINT16_C(38282), UINT16_C(37132),
+      UINT16_C(12269), UINT16_C( 6078), UINT16_C(54458), UINT16_C(43576), UINT16_C(20536), UINT16_C(51332), UINT16_C(23044), UINT16_C(10450),
+      UINT16_C(40952), UINT16_C(  569), UINT16_C(14806), UINT16_C(21969), UINT16_C(17477), UINT16_C(53325), UINT16_C(23002), UINT16_C(51041),
+      UINT16_C( 8072), UINT16_C(17119), UINT16_C( 6131), UINT16_C(11500), UINT16_C(29031), UINT16_C(27636), UINT16_C(50891), UINT16_C(50068),
+      UINT16_C(52581), UINT16_C(15301), UINT16_C(38662), UINT16_C(19601), UINT16_C(57051), UINT16_C(46364), UINT16_C(32055), UINT16_C(49021),
+      UINT16_C(23708), UINT16_C(36865), UINT16_C(60787), UINT16_C(55996), UINT16_C(45150), UINT16_C(10565), UINT16_C(55670), UINT16_C(56300),
+      UINT16_C(45734), UINT16_C(44310), UINT16_C(42825), UINT16_C( 9465), UINT16_C( 5509), UINT16_C(48346), UINT16_C(22418), UINT16_C(11899),
+      UINT16_C(31923), UINT16_C( 9918), UINT16_C(31338), UINT16_C(51200), UINT16_C(17706), UINT16_C(41202), UINT16_C(56863), UINT16_C(50555),
+      UINT16_C(37520), UINT16_C(55666), UINT16_C(27449), UINT16_C(49150), UINT16_C(55424), UINT16_C( 4731), UINT16_C(63279), UINT16_C(57921),
+      UINT16_C(65395), UINT16_C(56584), UINT16_C( 2170), UINT16_C(42150), UINT16_C(38989), UINT16_C(27717), UINT16_C(49270), UINT16_C( 1842),
+      UINT16_C(42066), UINT16_C(36064), UINT16_C(56848), UINT16_C(36939), UINT16_C(50870), UINT16_C(58787), UINT16_C(58557), UINT16_C(12743),
+      UINT16_C(53219), UINT16_C(23822), UINT16_C(46295), UINT16_C( 9474), UINT16_C(18252), UINT16_C(50065), UINT16_C(49927), UINT16_C(23242),
+      UINT16_C(43624), UINT16_C(30950), UINT16_C(12681), UINT16_C(16136), UINT16_C(44023), UINT16_C(46373), UINT16_C(60559), UINT16_C(29670),
+      UINT16_C(62652), UINT16_C(37840), UINT16_C(53929), UINT16_C(62904), UINT16_C(18969), UINT16_C( 8632), UINT16_C(33293), UINT16_C(30075),
+      UINT16_C(24877), UINT16_C(46829), UINT16_C(63122), UINT16_C(35317), UINT16_C( 6817), UINT16_C(12606), UINT16_C( 9223), UINT16_C(50084),
+      UINT16_C(29721), UINT16_C(49750) };
+  static const uint16_t e[] =
+    { UINT16_C(57055), UINT16_C( 3714), UINT16_C(39106), UINT16_C(36810), UINT16_C(56381), UINT16_C(19694), UINT16_C(43432), UINT16_C(64356),
+      UINT16_C(37734), UINT16_C(39535), UINT16_C(59960), UINT16_C(28409), UINT16_C(59264), UINT16_C(17395), UINT16_C(26546), UINT16_C(62573),
+      UINT16_C(61443), UINT16_C( 8721), UINT16_C( 9837), UINT16_C(21094), UINT16_C(39417), UINT16_C(16610), UINT16_C(21340), UINT16_C(10154),
+      UINT16_C( 6823), UINT16_C(17236), UINT16_C( 8957), UINT16_C(12231), UINT16_C(65167), UINT16_C(20342), UINT16_C(49565), UINT16_C(12528),
+      UINT16_C(32973), UINT16_C(42425), UINT16_C(12064), UINT16_C(47749), UINT16_C(29156), UINT16_C(16966), UINT16_C(61547), UINT16_C( 9521),
+      UINT16_C(30765), UINT16_C(56530), UINT16_C(38268), UINT16_C(17171), UINT16_C(31772), UINT16_C(56516), UINT16_C(58590), UINT16_C( 1568),
+      UINT16_C( 9201), UINT16_C(51958), UINT16_C(52741), UINT16_C(58037), UINT16_C(40012), UINT16_C(47049), UINT16_C(12941), UINT16_C(29803),
+      UINT16_C(40028), UINT16_C(16499), UINT16_C(33437), UINT16_C( 1856), UINT16_C(30982), UINT16_C(11704), UINT16_C(42797), UINT16_C(49591),
+      UINT16_C(39642), UINT16_C(48892), UINT16_C(62092), UINT16_C(58466), UINT16_C( 3823), UINT16_C(43835), UINT16_C(38290), UINT16_C( 7486),
+      UINT16_C(34635), UINT16_C(17621), UINT16_C(37385), UINT16_C( 4007), UINT16_C(15035), UINT16_C(26362), UINT16_C(61481), UINT16_C( 1085),
+      UINT16_C(39700), UINT16_C(62616), UINT16_C(35871), UINT16_C(30421), UINT16_C(37141), UINT16_C(22007), UINT16_C(15309), UINT16_C(45623),
+      UINT16_C(52625), UINT16_C(43761), UINT16_C( 6751), UINT16_C(27562), UINT16_C(24994), UINT16_C(  545), UINT16_C(57820), UINT16_C(43338),
+      UINT16_C( 2843), UINT16_C(43003), UINT16_C(43026), UINT16_C(43748), UINT16_C(46432), UINT16_C(31356), UINT16_C(27939), UINT16_C( 6822),
+      UINT16_C(30778), UINT16_C(58246), UINT16_C(63890), UINT16_C(60933), UINT16_C(18204), UINT16_C( 5939), UINT16_C(56699), UINT16_C(13640),
+      UINT16_C(36487), UINT16_C(39244), UINT16_C(28215), UINT16_C(29120), UINT16_C(15495), UINT16_C(54300), UINT16_C(41850), UINT16_C(61505),
+      UINT16_C(   87), UINT16_C(64125), UINT16_C(46376), UINT16_C(63361), UINT16_C( 6955), UINT16_C(46844), UINT16_C(63647), UINT16_C( 7771),
+      UINT16_C(65317), UINT16_C(32894), UINT16_C(40075), UINT16_C(40645), UINT16_C(13795), UINT16_C(27311), UINT16_C(46792), UINT16_C( 2111),
+      UINT16_C(48472), UINT16_C(41225), UINT16_C(53855), UINT16_C(32561), UINT16_C(57861), UINT16_C(56970), UINT16_C(31857), UINT16_C(36538),
+      UINT16_C(20571), UINT16_C(15331), UINT16_C(43240), UINT16_C( 5158), UINT16_C(62479), UINT16_C(63991), UINT16_C(14283), UINT16_C( 8962),
+      UINT16_C( 3646), UINT16_C(36180), UINT16_C( 3055), UINT16_C(62622), UINT16_C(53462), UINT16_C(49935), UINT16_C(39781), UINT16_C(19642),
+      UINT16_C(31732), UINT16_C(42395), UINT16_C(29816), UINT16_C(53569), UINT16_C(41121), UINT16_C( 3033), UINT16_C(52335), UINT16_C(25477),
+      UINT16_C(27561), UINT16_C(49303), UINT16_C(61020), UINT16_C(52308), UINT16_C(21932), UINT16_C( 7151), UINT16_C(60561), UINT16_C( 7580),
+      UINT16_C(20473), UINT16_C(13555), UINT16_C(13473), UINT16_C(14341), UINT16_C(53101), UINT16_C(12090), UINT16_C( 7836), UINT16_C(27968),
+      UINT16_C( 3576), UINT16_C(44178), UINT16_C(57612), UINT16_C(31751), UINT16_C(26955), UINT16_C(20520), UINT16_C(50188), UINT16_C(61832),
+      UINT16_C(22546), UINT16_C(23443), UINT16_C(  302), UINT16_C(39882), UINT16_C(18988), UINT16_C(18257), UINT16_C(64944), UINT16_C(60298),
+      UINT16_C( 1678), UINT16_C(64383), UINT16_C(41920), UINT16_C(63238), UINT16_C(52999), UINT16_C( 5063), UINT16_C(12369), UINT16_C(34011),
+      UINT16_C(55238), UINT16_C(62486), UINT16_C(57816), UINT16_C(43554), UINT16_C( 1861), UINT16_C(26598), UINT16_C(61374), UINT16_C(20900),
+      UINT16_C(56309), UINT16_C(30469), UINT16_C(20291), UINT16_C(51948), UINT16_C(45907), UINT16_C(59102), UINT16_C(47488), UINT16_C(52514),
+      UINT16_C( 4849), UINT16_C(35583), UINT16_C(52066), UINT16_C(42770), UINT16_C(10450), UINT16_C( 7851), UINT16_C( 9293), UINT16_C( 3293),
+      UINT16_C(50524), UINT16_C(29519), UINT16_C(35917), UINT16_C(40425), UINT16_C(51082), UINT16_C( 2692), UINT16_C(61057), UINT16_C( 2935),
+      UINT16_C(38444), UINT16_C(13164), UINT16_C(64396), UINT16_C(10872), UINT16_C(64966), UINT16_C(40489), UINT16_C(53896), UINT16_C(50393),
+      UINT16_C(48682), UINT16_C(42979), UINT16_C(29116), UINT16_C(44911), UINT16_C(51604), UINT16_C( 5422), UINT16_C(63267), UINT16_C(11812),
+      UINT16_C(41485), UINT16_C(26104), UINT16_C(28976), UINT16_C(56523), UINT16_C(47951), UINT16_C(49331), UINT16_C( 2055), UINT16_C(31476),
+      UINT16_C(26448), UINT16_C(25446), UINT16_C(11059), UINT16_C(65518), UINT16_C(43296), UINT16_C( 1876), UINT16_C(  957), UINT16_C(12112),
+      UINT16_C(52134), UINT16_C(54831), UINT16_C(48700), UINT16_C(38077), UINT16_C(51426), UINT16_C(59732), UINT16_C(28891), UINT16_C(12745),
+      UINT16_C( 3647), UINT16_C(25423), UINT16_C(18234), UINT16_C(11834), UINT16_C( 6020), UINT16_C(16858), UINT16_C(19007), UINT16_C(11309),
+      UINT16_C( 2756), UINT16_C(36047), UINT16_C(21752), UINT16_C(65354), UINT16_C(40644), UINT16_C(49896), UINT16_C( 3539), UINT16_C(11181),
+      UINT16_C(33472), UINT16_C(22825), UINT16_C(57102), UINT16_C( 4999), UINT16_C(25211), UINT16_C(38228), UINT16_C(24335), UINT16_C( 2804),
+      UINT16_C(56038), UINT16_C(26300), UINT16_C( 8670), UINT16_C( 1425), UINT16_C(35207), UINT16_C( 7184), UINT16_C(22574), UINT16_C(43348),
+      UINT16_C(22547), UINT16_C(22146), UINT16_C(59728), UINT16_C(52034), UINT16_C( 6123), UINT16_C(64498), UINT16_C(14876), UINT16_C( 4227),
+      UINT16_C(49461), UINT16_C(57184), UINT16_C(13129), UINT16_C(48042), UINT16_C(50592), UINT16_C(13837), UINT16_C(24858), UINT16_C(15071),
+      UINT16_C( 5269), UINT16_C(36856), UINT16_C(44395), UINT16_C(30702), UINT16_C( 4036), UINT16_C(15185), UINT16_C(43203), UINT16_C(35916),
+      UINT16_C(60208), UINT16_C(57346), UINT16_C(30978), UINT16_C(34779), UINT16_C(24000), UINT16_C(24071), UINT16_C(58303), UINT16_C(31360),
+      UINT16_C(65477), UINT16_C(12382), UINT16_C(31660), UINT16_C(35878), UINT16_C(55434), UINT16_C(57772), UINT16_C(63661), UINT16_C(12637),
+      UINT16_C(51238), UINT16_C(57573), UINT16_C(50015), UINT16_C(44501), UINT16_C(55761), UINT16_C(37000), UINT16_C(40636), UINT16_C(33070),
+      UINT16_C(35997), UINT16_C(31438), UINT16_C(63985), UINT16_C(37563), UINT16_C( 1881), UINT16_C(48500), UINT16_C(57696), UINT16_C(25979),
+      UINT16_C( 9297), UINT16_C(49605), UINT16_C( 9111), UINT16_C(26859), UINT16_C(15193), UINT16_C(47352), UINT16_C( 9746), UINT16_C(44858),
+      UINT16_C(60339), UINT16_C( 3976) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i])),
+      cv = simde_svld1_u16(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmad_u16_m(pv, av, bv, cv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], c[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+    cv = simde_svld1_u16(pg, &(c[i]));
+
+    ev = simde_svmad_u16_m(pv, av, bv, cv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C( 764421454), UINT32_C(4139354110), UINT32_C(3892081739), UINT32_C(1237808107), UINT32_C( 874907664), UINT32_C( 201202056), UINT32_C( 443718937), UINT32_C(4155535273),
+      UINT32_C(2451915156), UINT32_C( 344514248), UINT32_C(1056671059), UINT32_C( 159957752), UINT32_C(1396551371), UINT32_C(3764272071), UINT32_C(2180698328), UINT32_C(3547966271),
+      UINT32_C(3026558700), UINT32_C(3486051964), UINT32_C(1796129651), UINT32_C(1366595206), UINT32_C( 195342660), UINT32_C(3303736044), UINT32_C( 306636498), UINT32_C(2112208785),
+      UINT32_C(3643886429), UINT32_C(2896820793), UINT32_C(1125627837), UINT32_C(2442431565), UINT32_C( 714881085), UINT32_C( 233735994), UINT32_C(4263457901), UINT32_C(1350239475),
+      UINT32_C(2284498255), UINT32_C(1681183655), UINT32_C(3618131082), UINT32_C( 359152856), UINT32_C(2940142709), UINT32_C(4189859467), UINT32_C(1459084130), UINT32_C( 799437792),
+      UINT32_C(3350777888), UINT32_C( 757853347), UINT32_C( 268751672), UINT32_C(2233887760), UINT32_C(4231292272), UINT32_C(4143313299), UINT32_C(2890722508), UINT32_C(2145186399),
+      UINT32_C(1715901635), UINT32_C(3113513600), UINT32_C(1439275077), UINT32_C(1977282309), UINT32_C(3899723605), UINT32_C(3437127168), UINT32_C(2994285139), UINT32_C(3761394973),
+      UINT32_C(1766226153), UINT32_C( 807590634), UINT32_C(2022042739), UINT32_C( 820863195), UINT32_C(1863933807), UINT32_C( 406583237), UINT32_C(1070314530), UINT32_C(4062182665),
+      UINT32_C(1616668021), UINT32_C(3012591168), UINT32_C(1177228650), UINT32_C(3832944757), UINT32_C(1028886391), UINT32_C(2840956807), UINT32_C(1307058243), UINT32_C(2470381341),
+      UINT32_C(2901646188), UINT32_C(2220851994), UINT32_C( 248154776), UINT32_C( 452084131), UINT32_C(1465337552), UINT32_C( 402697685), UINT32_C(3949324493), UINT32_C(1551803887),
+      UINT32_C(1510502720), UINT32_C(2363451636), UINT32_C(2509941234), UINT32_C(3148910058), UINT32_C(2819753939), UINT32_C(2193626036), UINT32_C(3949799163), UINT32_C( 189262795),
+      UINT32_C(1348882268), UINT32_C(2866562487), UINT32_C(3644815342), UINT32_C(3616861956), UINT32_C(2877269751), UINT32_C(3039641529), UINT32_C( 815831653), UINT32_C(3778865029),
+      UINT32_C(3996230198), UINT32_C(3583512295), UINT32_C(2309937029), UINT32_C(3193979591), UINT32_C(2724847593), UINT32_C(2220332830), UINT32_C(3082090289), UINT32_C( 362344670),
+      UINT32_C(2030291602), UINT32_C(1565498328), UINT32_C( 971439474), UINT32_C( 704071232), UINT32_C(1137402149), UINT32_C( 700916728), UINT32_C(4192238618), UINT32_C(4279138668),
+      UINT32_C( 460853571), UINT32_C( 511231916), UINT32_C(  89677509), UINT32_C(3375255460), UINT32_C(2819422640), UINT32_C( 936563740), UINT32_C(3157307984), UINT32_C(1857764907),
+      UINT32_C(4220073039), UINT32_C(3222864379), UINT32_C(  63271263), UINT32_C(1909257153), UINT32_C( 152754669), UINT32_C(4248890541), UINT32_C(3401150622), UINT32_C(4248335790),
+      UINT32_C(2767766185), UINT32_C( 593826499), UINT32_C(1143351939), UINT32_C( 196539166), UINT32_C(2031407308), UINT32_C(1517704636), UINT32_C(1948528581), UINT32_C(1299275172),
+      UINT32_C(3807537695), UINT32_C(4278540156), UINT32_C(2672045185), UINT32_C(3953850911), UINT32_C(2254749642), UINT32_C(3655391764), UINT32_C(2924283145), UINT32_C(2180759394),
+      UINT32_C(2774789417), UINT32_C(3332663620), UINT32_C(3026577557), UINT32_C(2896105698), UINT32_C(3811705807), UINT32_C(3871085533), UINT32_C(2056522264), UINT32_C(4076572873),
+      UINT32_C(3264700029), UINT32_C(1552432071) };
+  static const uint32_t b[] =
+    { UINT32_C(2800011337), UINT32_C(3949082479), UINT32_C( 518037294), UINT32_C( 274483699), UINT32_C( 660572011), UINT32_C(3756147112), UINT32_C(3575380589), UINT32_C(1024371956),
+      UINT32_C(3823366772), UINT32_C(1473201705), UINT32_C(3648368613), UINT32_C(1693045496), UINT32_C(  25905241), UINT32_C(4158680714), UINT32_C(1573714792), UINT32_C( 463133351),
+      UINT32_C(4127096524), UINT32_C(2840448452), UINT32_C(1971503740), UINT32_C(3990449300), UINT32_C(1055810740), UINT32_C( 993447634), UINT32_C(1889010377), UINT32_C(2844472029),
+      UINT32_C(1956612784), UINT32_C(3558796375), UINT32_C(1128898734), UINT32_C(3241157132), UINT32_C(1509891974), UINT32_C(3079943661), UINT32_C( 354888760), UINT32_C( 264155998),
+      UINT32_C(2491637053), UINT32_C(4167606601), UINT32_C(1312534850), UINT32_C(1510960083), UINT32_C(2025000842), UINT32_C(2083473220), UINT32_C(3515962995), UINT32_C(1189105673),
+      UINT32_C(4158350509), UINT32_C(1206862597), UINT32_C(3365284597), UINT32_C( 539141525), UINT32_C(4187542964), UINT32_C(2406860572), UINT32_C( 660670237), UINT32_C(  74269015),
+      UINT32_C(2885372069), UINT32_C(2180180620), UINT32_C(2856945684), UINT32_C(3804916782), UINT32_C(1591435841), UINT32_C(1189957929), UINT32_C(2943176280), UINT32_C( 900979600),
+      UINT32_C(2950737699), UINT32_C(2922435481), UINT32_C(2304277083), UINT32_C( 661398246), UINT32_C(2911192964), UINT32_C(4042486680), UINT32_C(1369399745), UINT32_C(1602704188),
+      UINT32_C(2601477890), UINT32_C(2521382714), UINT32_C(2669650361), UINT32_C(1204259779), UINT32_C(1811172563), UINT32_C(2170349759), UINT32_C(2245196617), UINT32_C(1357142350),
+      UINT32_C(4226610113), UINT32_C(3968939315), UINT32_C(2592911831), UINT32_C( 266490684), UINT32_C(1601951391), UINT32_C( 132175806), UINT32_C( 562868946), UINT32_C(3446763788),
+      UINT32_C(2546490724), UINT32_C(1787058835), UINT32_C(1191448587), UINT32_C(  39315043), UINT32_C(2070008509), UINT32_C(2072199593), UINT32_C(  10227700), UINT32_C(3855421056),
+      UINT32_C(4269577579), UINT32_C(4201119983), UINT32_C(1933733136), UINT32_C( 276207955), UINT32_C( 344774507), UINT32_C( 227479321), UINT32_C(2668440606), UINT32_C(2776947258),
+      UINT32_C(1604583535), UINT32_C( 291048449), UINT32_C(3448085369), UINT32_C(2682125108), UINT32_C(3954403794), UINT32_C(2549629816), UINT32_C(2838889839), UINT32_C(1330559711),
+      UINT32_C(3148804794), UINT32_C(2026702847), UINT32_C(3611644579), UINT32_C( 527901517), UINT32_C(  84617868), UINT32_C(3701212013), UINT32_C(3901084169), UINT32_C(1178064012),
+      UINT32_C(3305301446), UINT32_C(2420035565), UINT32_C(1852277537), UINT32_C( 864935590), UINT32_C(1983420425), UINT32_C(2773734556), UINT32_C( 848156838), UINT32_C(1937294764),
+      UINT32_C(2537061034), UINT32_C(1780971081), UINT32_C(2698547194), UINT32_C(1993565805), UINT32_C(2599226366), UINT32_C(2235515103), UINT32_C(3317157144), UINT32_C(1010315410),
+      UINT32_C(4107563178), UINT32_C(3781098471), UINT32_C(4169217930), UINT32_C(2607699357), UINT32_C(1077304160), UINT32_C(3032839579), UINT32_C(3564731714), UINT32_C(1460777389),
+      UINT32_C( 139191585), UINT32_C(1810475744), UINT32_C(2120444897), UINT32_C( 538563008), UINT32_C(3361754925), UINT32_C( 125576901), UINT32_C(1356658083), UINT32_C(3366448550),
+      UINT32_C(3000038354), UINT32_C(2115877533), UINT32_C(3858530341), UINT32_C(2131039570), UINT32_C( 709322341), UINT32_C( 791790732), UINT32_C(1618939321), UINT32_C(3425183482),
+      UINT32_C(3061839897), UINT32_C(3610549426) };
+  static const uint32_t c[] =
+    { UINT32_C(2919576883), UINT32_C( 208242626), UINT32_C(2065342597), UINT32_C(3376039054), UINT32_C(2174597417), UINT32_C( 328023710), UINT32_C(3485169745), UINT32_C( 405578213),
+      UINT32_C(2579968470), UINT32_C(1051013305), UINT32_C(1606008785), UINT32_C( 757658372), UINT32_C(1269810605), UINT32_C(1415461891), UINT32_C(2586057140), UINT32_C(2427605178),
+      UINT32_C( 975796609), UINT32_C(2071580586), UINT32_C(2463773326), UINT32_C(3552576038), UINT32_C(3407769544), UINT32_C(1612741803), UINT32_C(1341801621), UINT32_C( 366980244),
+      UINT32_C(3494906150), UINT32_C(1716242904), UINT32_C( 569976315), UINT32_C(4025792807), UINT32_C(3552252456), UINT32_C( 590601102), UINT32_C(3010604319), UINT32_C(  13128410),
+      UINT32_C( 869275739), UINT32_C(3717798881), UINT32_C(1744736832), UINT32_C(1935143755), UINT32_C(2487685637), UINT32_C( 213351149), UINT32_C(2193566376), UINT32_C(3615655804),
+      UINT32_C(2164937376), UINT32_C(2908660589), UINT32_C(2165595446), UINT32_C(1442147152), UINT32_C(1793670269), UINT32_C(1584832950), UINT32_C(1205876171), UINT32_C(1562272445),
+      UINT32_C( 568207540), UINT32_C(  30293451), UINT32_C(3934512026), UINT32_C(3426711630), UINT32_C(1781934516), UINT32_C(2513022410), UINT32_C(2682038754), UINT32_C(3237804556),
+      UINT32_C(3991067426), UINT32_C(3002052632), UINT32_C(3801903763), UINT32_C(2662259690), UINT32_C(3456689156), UINT32_C(1952698769), UINT32_C(2266185595), UINT32_C(1531383865),
+      UINT32_C(  55126507), UINT32_C(1840593114), UINT32_C(2488226218), UINT32_C( 825425196), UINT32_C(1946106594), UINT32_C(2280088332), UINT32_C(3691969442), UINT32_C(4130821387),
+      UINT32_C(1509523583), UINT32_C(1657188024), UINT32_C( 737548031), UINT32_C(4116457491), UINT32_C(1869175907), UINT32_C(1643532479), UINT32_C(1446839371), UINT32_C(3628889433),
+      UINT32_C(2922464757), UINT32_C(4061198579), UINT32_C( 555616014), UINT32_C(2451012143), UINT32_C(2499903702), UINT32_C( 486012880), UINT32_C(1433548027), UINT32_C(2670575529),
+      UINT32_C(4165820164), UINT32_C(1709858135), UINT32_C(2491811940), UINT32_C(1495702915), UINT32_C(4008650781), UINT32_C( 453699103), UINT32_C(3295706138), UINT32_C(1080270139),
+      UINT32_C(1396224252), UINT32_C(1924669965), UINT32_C(2919644971), UINT32_C(4194774236), UINT32_C(1961424468), UINT32_C(4153406172), UINT32_C(2864447342), UINT32_C(2582257308),
+      UINT32_C(3689685710), UINT32_C(1867359556), UINT32_C(3223147492), UINT32_C(3568969088), UINT32_C(4165509659), UINT32_C(  66049940), UINT32_C(1940761302), UINT32_C(2517407688),
+      UINT32_C(4252104889), UINT32_C(2171453341), UINT32_C(2453834258), UINT32_C(3412589743), UINT32_C( 868462495), UINT32_C(1563865735), UINT32_C( 617669468), UINT32_C( 867884154),
+      UINT32_C(1915825109), UINT32_C(4260667114), UINT32_C(3633264168), UINT32_C(3517183538), UINT32_C( 755328678), UINT32_C(1955216152), UINT32_C(2576898847), UINT32_C( 214782519),
+      UINT32_C(1753218685), UINT32_C(3294983068), UINT32_C(3684496553), UINT32_C(2444050411), UINT32_C(3183391397), UINT32_C( 204556525), UINT32_C(3685140899), UINT32_C(2582082331),
+      UINT32_C( 218195569), UINT32_C(2194761433), UINT32_C(1163816538), UINT32_C(1406536621), UINT32_C(2853213373), UINT32_C(2159493853), UINT32_C( 660299019), UINT32_C(1103119312),
+      UINT32_C(2202976681), UINT32_C(2164596519), UINT32_C(1002922893), UINT32_C( 730766702), UINT32_C( 265723442), UINT32_C(3968830944), UINT32_C(3121867754), UINT32_C(3623605038),
+      UINT32_C(3143256468), UINT32_C(4131151976) };
+  static const uint32_t e[] =
+    { UINT32_C( 381470833), UINT32_C( 474943716), UINT32_C(2186418943), UINT32_C( 168775583), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 288591553), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 921483636), UINT32_C(         0),
+      UINT32_C(2307147153), UINT32_C(         0), UINT32_C(1837368386), UINT32_C(3225259934), UINT32_C(2506204056), UINT32_C( 118147651), UINT32_C( 606282615), UINT32_C(         0),
+      UINT32_C(2811689750), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2076445972),
+      UINT32_C(         0), UINT32_C(1839037824), UINT32_C( 236697556), UINT32_C(         0), UINT32_C(3008451607), UINT32_C(1931568345), UINT32_C( 474719150), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 794160028), UINT32_C( 589935054), UINT32_C(         0), UINT32_C(2191966013), UINT32_C( 357913290), UINT32_C(         0), UINT32_C(2570182662),
+      UINT32_C(         0), UINT32_C(3970292683), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2797568106), UINT32_C(         0),
+      UINT32_C(2450303485), UINT32_C(1242784754), UINT32_C(1601064308), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 734237530), UINT32_C(3485431108), UINT32_C(3428984139), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 632893675), UINT32_C(3249286886), UINT32_C(         0), UINT32_C(1347511111), UINT32_C(3653253011), UINT32_C(         0), UINT32_C(         0), UINT32_C(3069819789),
+      UINT32_C( 614580981), UINT32_C(2265974031), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3286347172), UINT32_C(3753382199), UINT32_C(2593636137),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(  65658180), UINT32_C(2904653775), UINT32_C(1838637658), UINT32_C(         0), UINT32_C(2750214128), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C( 390112264), UINT32_C(         0), UINT32_C(2407806070), UINT32_C(  71017196), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(2837002106), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1809931200), UINT32_C(         0),
+      UINT32_C(1430667659), UINT32_C(         0), UINT32_C(1114148983), UINT32_C(4057192711), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 629651550),
+      UINT32_C(         0), UINT32_C(2268914045), UINT32_C(3655073262), UINT32_C(         0), UINT32_C(2943340236), UINT32_C(         0), UINT32_C( 823881711), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 345543313), UINT32_C( 525665351), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1925609147), UINT32_C(4148949485), UINT32_C(         0), UINT32_C(3100511297), UINT32_C(4227018438), UINT32_C(         0),
+      UINT32_C(1018509387), UINT32_C( 755570139), UINT32_C(2121826582), UINT32_C(         0), UINT32_C(2759825629), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(2530161862) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i])),
+      cv = simde_svld1_u32(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmad_u32_z(pv, av, bv, cv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], c[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+    cv = simde_svld1_u32(pg, &(c[i]));
+
+    ev = simde_svmad_u32_z(pv, av, bv, cv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(3449476054), UINT32_C(3228616319), UINT32_C( 879568797), UINT32_C(1106578347), UINT32_C(1588292040), UINT32_C(3247691563), UINT32_C(2417849059), UINT32_C(2834636241),
+      UINT32_C(1869975536), UINT32_C(4080002389), UINT32_C(3072826380), UINT32_C(1895373991), UINT32_C(2983109766), UINT32_C(1584554363), UINT32_C(2783940820), UINT32_C(2639127725),
+      UINT32_C(3373122164), UINT32_C(3032235175), UINT32_C(2154554329), UINT32_C(2263901184), UINT32_C(2201468680), UINT32_C(4108495136), UINT32_C(3868905785), UINT32_C( 696575925),
+      UINT32_C(1374917034), UINT32_C(2785390541), UINT32_C(2468835731), UINT32_C(3726186453), UINT32_C(4150350038), UINT32_C( 871056377), UINT32_C(3390670100), UINT32_C( 401841517),
+      UINT32_C(4234733102), UINT32_C( 698510998), UINT32_C(3032271327), UINT32_C(3079853537), UINT32_C( 514782245), UINT32_C(1280416311), UINT32_C(2350279455), UINT32_C( 933431560),
+      UINT32_C(2251492592), UINT32_C(1504695674), UINT32_C(2148363167), UINT32_C(1698144320), UINT32_C(3414419092), UINT32_C(2669139328), UINT32_C(1210854720), UINT32_C( 662687543),
+      UINT32_C(1437446875), UINT32_C( 665738376), UINT32_C( 128433351), UINT32_C(4033666652), UINT32_C(1153167300), UINT32_C(  82105284), UINT32_C( 927797248), UINT32_C(3143552223),
+      UINT32_C( 118492031), UINT32_C( 774815591), UINT32_C(3610629499), UINT32_C(2026348979), UINT32_C(1438417553), UINT32_C(1448779861), UINT32_C(2425202608), UINT32_C(4065062003),
+      UINT32_C(1610177527), UINT32_C(2509055770), UINT32_C(2959918076), UINT32_C(4113052516), UINT32_C( 189523126), UINT32_C( 895591813), UINT32_C(3217420108), UINT32_C(3534885083),
+      UINT32_C(2251402092), UINT32_C(3474767827), UINT32_C(3867117698), UINT32_C(1927063484), UINT32_C( 293414796), UINT32_C( 407297996), UINT32_C(2849443022), UINT32_C(2289797404),
+      UINT32_C( 135245109), UINT32_C(4007078764), UINT32_C(1876187059), UINT32_C(2330046718), UINT32_C(2744868823), UINT32_C( 213639742), UINT32_C( 179672046), UINT32_C(1368600604),
+      UINT32_C(1230611165), UINT32_C(2151100877), UINT32_C(2263878792), UINT32_C(2484195772), UINT32_C(1849142320), UINT32_C(2088432526), UINT32_C(2726768518), UINT32_C(1039407712),
+      UINT32_C(2307345852), UINT32_C( 101301886), UINT32_C(2274228682), UINT32_C(4212891339), UINT32_C(3647623754), UINT32_C(3411403845), UINT32_C(1953422356), UINT32_C(2997969654),
+      UINT32_C( 775633071), UINT32_C(3241428471), UINT32_C( 155763006), UINT32_C(2852479839), UINT32_C(4219695030), UINT32_C(1741150291), UINT32_C(2883270069), UINT32_C(1180601751),
+      UINT32_C(3161758149), UINT32_C( 494840286), UINT32_C(3391538794), UINT32_C(3765709610), UINT32_C(4007393178), UINT32_C(2220204751), UINT32_C(1848652247), UINT32_C(2209713854),
+      UINT32_C( 104868135), UINT32_C(1025752786), UINT32_C(2919713156), UINT32_C( 260995957), UINT32_C(1107126898), UINT32_C(3838202636), UINT32_C(1112733316), UINT32_C(2881816452),
+      UINT32_C(  61932849), UINT32_C(1212208323), UINT32_C(2482390814), UINT32_C( 883066306), UINT32_C(4218855663), UINT32_C(2011118835), UINT32_C(3065590322), UINT32_C(1784774201),
+      UINT32_C(1198396292), UINT32_C(  93302503), UINT32_C(3097003766), UINT32_C(4209851147), UINT32_C(3472188379), UINT32_C(3511014815), UINT32_C(1082654215), UINT32_C(  11266172),
+      UINT32_C(3813153275), UINT32_C(3186153415), UINT32_C(1752596829), UINT32_C(2539807676), UINT32_C(1701140678), UINT32_C( 875997741), UINT32_C( 611630504), UINT32_C(2703564709),
+      UINT32_C(   8678712), UINT32_C(2730323012), UINT32_C(2836018157), UINT32_C(1547726230), UINT32_C(4072777157), UINT32_C(4146526031), UINT32_C(1511824052), UINT32_C(4076552634),
+      UINT32_C(4075978670), UINT32_C(3650400491), UINT32_C(2055380963), UINT32_C(3520512780), UINT32_C(3099826280), UINT32_C(1152379279), UINT32_C(1033816963), UINT32_C(3123747084),
+      UINT32_C(  61678104), UINT32_C(3067888082), UINT32_C(3962593248), UINT32_C(2327643682), UINT32_C( 776110238), UINT32_C(3983733353), UINT32_C(3391754429), UINT32_C(3246676649),
+      UINT32_C(1338257789), UINT32_C(1392877939), UINT32_C( 574633216), UINT32_C(3668770108), UINT32_C(3876122494), UINT32_C(2664725217), UINT32_C( 862519178), UINT32_C(3606375769),
+      UINT32_C(2435234078), UINT32_C(1524968282), UINT32_C(2642158945), UINT32_C(2692163618), UINT32_C(4169695255), UINT32_C(2241289466), UINT32_C(3048800091), UINT32_C( 193703404),
+      UINT32_C(3231494502), UINT32_C(1041924573), UINT32_C(3386611366), UINT32_C(3597226686) };
+  static const uint32_t b[] =
+    { UINT32_C(2416234333), UINT32_C( 921270334), UINT32_C(3232250680), UINT32_C( 359629798), UINT32_C( 820291998), UINT32_C(3930782272), UINT32_C(1648273329), UINT32_C( 557045700),
+      UINT32_C(3853662118), UINT32_C(3877346223), UINT32_C(3181888471), UINT32_C(3838973766), UINT32_C(   1423040), UINT32_C(1659592625), UINT32_C(3401853190), UINT32_C(2817324800),
+      UINT32_C(3716980270), UINT32_C( 281388857), UINT32_C(2983095403), UINT32_C(1133944963), UINT32_C( 138718039), UINT32_C( 275394314), UINT32_C(1507536472), UINT32_C(1392559909),
+      UINT32_C(2653981797), UINT32_C(2662331699), UINT32_C(3847257442), UINT32_C(1948902941), UINT32_C(2608622993), UINT32_C(4104906396), UINT32_C( 961381908), UINT32_C(2995539277),
+      UINT32_C( 223460825), UINT32_C( 346751154), UINT32_C(2600139645), UINT32_C(1913594849), UINT32_C( 739085200), UINT32_C(2250291570), UINT32_C(2378198591), UINT32_C(2503953595),
+      UINT32_C(3164770313), UINT32_C( 231755152), UINT32_C( 715704905), UINT32_C(2107488237), UINT32_C(3031018050), UINT32_C(2738604643), UINT32_C(4080073528), UINT32_C(1367895879),
+      UINT32_C(2416781824), UINT32_C(3248414072), UINT32_C(2515224232), UINT32_C(1058244861), UINT32_C(2532621363), UINT32_C(3191418758), UINT32_C(1907517738), UINT32_C(3653384921),
+      UINT32_C(3714699109), UINT32_C(1436420013), UINT32_C(1256884557), UINT32_C(1166736658), UINT32_C(1088126650), UINT32_C(3623818669), UINT32_C(1464381822), UINT32_C(1345326059),
+      UINT32_C(2267912922), UINT32_C(4024224673), UINT32_C(1731839829), UINT32_C(2125251524), UINT32_C(4005529409), UINT32_C( 465944220), UINT32_C(1517424239), UINT32_C(4088111897),
+      UINT32_C(3732658237), UINT32_C(4190984100), UINT32_C(3814721310), UINT32_C( 207686858), UINT32_C( 821698707), UINT32_C(1296810206), UINT32_C(3886595534), UINT32_C(2648331104),
+      UINT32_C(3481031979), UINT32_C(3418900909), UINT32_C( 464398416), UINT32_C(3358003252), UINT32_C( 267919664), UINT32_C(2942059489), UINT32_C(1637221376), UINT32_C(2214490455),
+      UINT32_C(1934785222), UINT32_C( 339680196), UINT32_C(2016406851), UINT32_C( 775968509), UINT32_C(1497184376), UINT32_C(2064226683), UINT32_C(4124876702), UINT32_C(3615021840),
+      UINT32_C( 424332117), UINT32_C( 690915814), UINT32_C(1956732279), UINT32_C( 748872116), UINT32_C(2491801369), UINT32_C( 386961017), UINT32_C(1041034286), UINT32_C( 487949767),
+      UINT32_C( 909533264), UINT32_C(1616864489), UINT32_C(1993671106), UINT32_C(4238505954), UINT32_C(3499108183), UINT32_C(3840385206), UINT32_C(1411576717), UINT32_C(3362863224),
+      UINT32_C(2180950168), UINT32_C(3470941708), UINT32_C(1095022431), UINT32_C(2235426350), UINT32_C(3293957646), UINT32_C(4222106734), UINT32_C(2823866928), UINT32_C(2591146242),
+      UINT32_C(1981575017), UINT32_C( 742719181), UINT32_C(3815672245), UINT32_C(2104077167), UINT32_C(3896622713), UINT32_C( 736356859), UINT32_C(3067294644), UINT32_C(1582384373),
+      UINT32_C(2178182580), UINT32_C( 548280683), UINT32_C( 285416610), UINT32_C(1099918535), UINT32_C( 640274475), UINT32_C(1850805434), UINT32_C( 891561024), UINT32_C( 496203113),
+      UINT32_C(1302227170), UINT32_C( 594365569), UINT32_C( 808743272), UINT32_C( 141673437), UINT32_C(1311677076), UINT32_C(3871113126), UINT32_C( 219930788), UINT32_C( 942321494),
+      UINT32_C(2558969879), UINT32_C(2109469461), UINT32_C(1118695268), UINT32_C(1196039859), UINT32_C(1603631544), UINT32_C(2621788664), UINT32_C(2276024625), UINT32_C( 666948368),
+      UINT32_C(2982102684), UINT32_C(2653846073), UINT32_C( 484498537), UINT32_C(3009620730), UINT32_C(2618488995), UINT32_C(2067289929), UINT32_C(3355632312), UINT32_C(1374667445),
+      UINT32_C(1107471880), UINT32_C(2464166184), UINT32_C( 128892941), UINT32_C(2394559210), UINT32_C(1412090890), UINT32_C(3704578596), UINT32_C(4205171012), UINT32_C(2622198932),
+      UINT32_C(1809731139), UINT32_C(2365439615), UINT32_C(1771285630), UINT32_C(3371650750), UINT32_C(1042030874), UINT32_C(3357272963), UINT32_C(1371717821), UINT32_C(2548895060),
+      UINT32_C(3657682011), UINT32_C( 157679754), UINT32_C(1785920172), UINT32_C(1647536456), UINT32_C( 228675466), UINT32_C(4174756923), UINT32_C(3494483836), UINT32_C(   6829733),
+      UINT32_C(2379967234), UINT32_C( 412500331), UINT32_C(2206337083), UINT32_C(4226200945), UINT32_C(1074300677), UINT32_C(3208175171), UINT32_C( 445612405), UINT32_C(3122395063),
+      UINT32_C(3460822626), UINT32_C(1944509751), UINT32_C(1458989285), UINT32_C( 592567326) };
+  static const uint32_t c[] =
+    { UINT32_C( 577467405), UINT32_C(3360035193), UINT32_C(1033643535), UINT32_C(3390372273), UINT32_C(3515105310), UINT32_C(3549961159), UINT32_C(1545729181), UINT32_C(1152330551),
+      UINT32_C( 426121888), UINT32_C(1004710956), UINT32_C(2205712082), UINT32_C(2521664887), UINT32_C(2489832141), UINT32_C(2338848749), UINT32_C( 719816947), UINT32_C(1416533684),
+      UINT32_C(3714962609), UINT32_C(1394102144), UINT32_C(1171689934), UINT32_C(3957007390), UINT32_C(3816768246), UINT32_C( 879683137), UINT32_C( 593384815), UINT32_C(2641874156),
+      UINT32_C( 561702048), UINT32_C(  41194036), UINT32_C(1095191075), UINT32_C(1680614254), UINT32_C(2806557541), UINT32_C(  31176338), UINT32_C(4163123724), UINT32_C(2811599622),
+      UINT32_C(3016232831), UINT32_C(3316989089), UINT32_C(4110876038), UINT32_C(2237215520), UINT32_C(1881973214), UINT32_C(1685129304), UINT32_C(1214027074), UINT32_C(2968514864),
+      UINT32_C(2707666688), UINT32_C(2053511667), UINT32_C( 913272086), UINT32_C(2126235808), UINT32_C(3270502506), UINT32_C( 841375984), UINT32_C( 645563126), UINT32_C(1943431795),
+      UINT32_C( 353647137), UINT32_C(1771010899), UINT32_C(2292186856), UINT32_C( 805722822), UINT32_C( 854783298), UINT32_C(1281628246), UINT32_C( 225632154), UINT32_C(1786792265),
+      UINT32_C(3598685571), UINT32_C(4164881936), UINT32_C(3548438028), UINT32_C(2063828536), UINT32_C(3534616188), UINT32_C(2837320206), UINT32_C( 985043185), UINT32_C(1554266073),
+      UINT32_C(3694273740), UINT32_C(1070887218), UINT32_C(2282902607), UINT32_C(1443042778), UINT32_C( 438874123), UINT32_C(3015919298), UINT32_C(2968353239), UINT32_C(2081264304),
+      UINT32_C(3898097590), UINT32_C(   2567345), UINT32_C(1535654272), UINT32_C(1521584975), UINT32_C(4269070908), UINT32_C(4155651872), UINT32_C(1638440881), UINT32_C(3890132273),
+      UINT32_C(2781886196), UINT32_C(3819370339), UINT32_C(2151558705), UINT32_C(4141543610), UINT32_C(3941879754), UINT32_C( 937600646), UINT32_C(2006551110), UINT32_C( 861894463),
+      UINT32_C( 282668973), UINT32_C(1475641126), UINT32_C(1742156461), UINT32_C(3965563426), UINT32_C(2279035393), UINT32_C(1052752376), UINT32_C(2192988227), UINT32_C(2092242383),
+      UINT32_C(1787661892), UINT32_C(3150086413), UINT32_C(3592591795), UINT32_C(1287815243), UINT32_C(3402930642), UINT32_C(2500432722), UINT32_C(3122118635), UINT32_C( 406244820),
+      UINT32_C(1770177371), UINT32_C(4163126340), UINT32_C( 701384414), UINT32_C(2557907142), UINT32_C(2086881834), UINT32_C(3356650717), UINT32_C(4286720299), UINT32_C(1377286390),
+      UINT32_C(3233519996), UINT32_C(3166232542), UINT32_C(3974465061), UINT32_C(1099193111), UINT32_C(2193483685), UINT32_C(2118831955), UINT32_C(4017999097), UINT32_C(  21075077),
+      UINT32_C( 214039598), UINT32_C(  29915867), UINT32_C( 401452288), UINT32_C(2925031689), UINT32_C(2888898137), UINT32_C(3727391717), UINT32_C(3452872776), UINT32_C(1808666429),
+      UINT32_C(3883372300), UINT32_C( 182992649), UINT32_C(4112635372), UINT32_C(2695133767), UINT32_C(1967969680), UINT32_C(2555672400), UINT32_C(1566908960), UINT32_C(1036530481),
+      UINT32_C(3424993219), UINT32_C(1792413054), UINT32_C( 710998243), UINT32_C(  46793842), UINT32_C( 695670489), UINT32_C(2932001678), UINT32_C( 520824813), UINT32_C( 509399899),
+      UINT32_C(2431287570), UINT32_C(1929036175), UINT32_C( 731667129), UINT32_C( 925722206), UINT32_C( 174171260), UINT32_C(1572348784), UINT32_C(2776417098), UINT32_C(2831407510),
+      UINT32_C(3912805978), UINT32_C( 677065583), UINT32_C(3964925837), UINT32_C(3659759709), UINT32_C(2498004004), UINT32_C(4075986343), UINT32_C(4153896544), UINT32_C(2728352583),
+      UINT32_C(2022430729), UINT32_C(2560681739), UINT32_C(1015346142), UINT32_C(2534844531), UINT32_C(3559717420), UINT32_C(4173733527), UINT32_C(3572456844), UINT32_C(3245772472),
+      UINT32_C(1899561318), UINT32_C(3339377128), UINT32_C(1057197772), UINT32_C(1675041078), UINT32_C(2872509203), UINT32_C(2913205537), UINT32_C( 327258714), UINT32_C(2278881056),
+      UINT32_C(3791130361), UINT32_C(3030909671), UINT32_C(3354635153), UINT32_C(3626683076), UINT32_C(4001587661), UINT32_C(3114018398), UINT32_C(3637255608), UINT32_C( 241147925),
+      UINT32_C(2532268206), UINT32_C(3947534426), UINT32_C( 145964355), UINT32_C(3588283656), UINT32_C(2646893375), UINT32_C(1096179849), UINT32_C(2451120765), UINT32_C(1906342339),
+      UINT32_C( 721916113), UINT32_C(1796690216), UINT32_C(2540948111), UINT32_C(3865858983) };
+  static const uint32_t e[] =
+    { UINT32_C(3449476054), UINT32_C(3023612987), UINT32_C(2628124519), UINT32_C(1106578347), UINT32_C( 507810190), UINT32_C(3247691563), UINT32_C(4016732304), UINT32_C(1577551419),
+      UINT32_C(1869975536), UINT32_C(1550968903), UINT32_C( 695054566), UINT32_C(1895373991), UINT32_C(2983109766), UINT32_C(3700624120), UINT32_C(2783940820), UINT32_C( 646807988),
+      UINT32_C(3373122164), UINT32_C(2031468975), UINT32_C(3635173761), UINT32_C(2263901184), UINT32_C(2201468680), UINT32_C(1771463041), UINT32_C( 116489991), UINT32_C(2630548757),
+      UINT32_C(1374917034), UINT32_C(2785390541), UINT32_C(2468835731), UINT32_C(1837773967), UINT32_C(4150350038), UINT32_C( 871056377), UINT32_C(2563708828), UINT32_C( 401841517),
+      UINT32_C(1160847997), UINT32_C( 698510998), UINT32_C(3032271327), UINT32_C(2866016481), UINT32_C( 514782245), UINT32_C(1780052950), UINT32_C(3458745315), UINT32_C( 933431560),
+      UINT32_C(2251492592), UINT32_C(1504695674), UINT32_C(2148363167), UINT32_C(1698144320), UINT32_C( 432251538), UINT32_C( 995422576), UINT32_C(2088904950), UINT32_C(1331280820),
+      UINT32_C(1437446875), UINT32_C( 756826899), UINT32_C( 128433351), UINT32_C(3331521458), UINT32_C(1153167300), UINT32_C(  82105284), UINT32_C(3685187482), UINT32_C(3143552223),
+      UINT32_C(4080455582), UINT32_C(3382982571), UINT32_C(3610629499), UINT32_C(2908277710), UINT32_C(1438417553), UINT32_C(1448779861), UINT32_C(1256180113), UINT32_C(1359951466),
+      UINT32_C(  55053090), UINT32_C(2509055770), UINT32_C(2946779899), UINT32_C(1730124394), UINT32_C(3587423297), UINT32_C( 443931086), UINT32_C(4071515083), UINT32_C(2473961747),
+      UINT32_C(2251402092), UINT32_C(3474767827), UINT32_C(1375061692), UINT32_C(1927063484), UINT32_C(2365329312), UINT32_C( 432359944), UINT32_C( 442041205), UINT32_C( 293483441),
+      UINT32_C( 135245109), UINT32_C( 919673695), UINT32_C( 485985825), UINT32_C(2926888018), UINT32_C(2744868823), UINT32_C( 213639742), UINT32_C( 693977670), UINT32_C(1368600604),
+      UINT32_C(4120148123), UINT32_C(2151100877), UINT32_C(  20734533), UINT32_C(2484195772), UINT32_C( 386566273), UINT32_C(1398840626), UINT32_C(3721520887), UINT32_C(1039407712),
+      UINT32_C(2307345852), UINT32_C(3357086785), UINT32_C( 216668313), UINT32_C(2201260551), UINT32_C(3647623754), UINT32_C(3432037871), UINT32_C(1953422356), UINT32_C(2997969654),
+      UINT32_C( 775633071), UINT32_C(3241428471), UINT32_C(3628594650), UINT32_C(2559013796), UINT32_C(2993879812), UINT32_C(1741150291), UINT32_C(1094946012), UINT32_C(1963597758),
+      UINT32_C(  22425204), UINT32_C( 990140998), UINT32_C(3391538794), UINT32_C( 271440035), UINT32_C(4007393178), UINT32_C(2220204751), UINT32_C(1848652247), UINT32_C( 925364225),
+      UINT32_C(3912156717), UINT32_C( 914662661), UINT32_C(2888059732), UINT32_C( 260995957), UINT32_C(1223361083), UINT32_C(1440273577), UINT32_C(4262218008), UINT32_C(4263596177),
+      UINT32_C(  61932849), UINT32_C(1212208323), UINT32_C(2482390814), UINT32_C( 348539925), UINT32_C(4218855663), UINT32_C(2011118835), UINT32_C(2143860384), UINT32_C(1784774201),
+      UINT32_C(1198396292), UINT32_C(  93302503), UINT32_C(3097003766), UINT32_C(4209851147), UINT32_C( 415272821), UINT32_C(3511014815), UINT32_C(2586641513), UINT32_C( 543273219),
+      UINT32_C(4061327007), UINT32_C(3577960930), UINT32_C(1752596829), UINT32_C(2539807676), UINT32_C(4151118028), UINT32_C(2292595720), UINT32_C(2811869298), UINT32_C(2703564709),
+      UINT32_C(   8678712), UINT32_C(2730323012), UINT32_C(1635971010), UINT32_C(1547726230), UINT32_C(4072777157), UINT32_C(4146526031), UINT32_C(3525412800), UINT32_C( 213501897),
+      UINT32_C(4075978670), UINT32_C(3780740803), UINT32_C(1314607717), UINT32_C(3520512780), UINT32_C(3099826280), UINT32_C(1152379279), UINT32_C(1033816963), UINT32_C(3123747084),
+      UINT32_C(3233562030), UINT32_C(3067888082), UINT32_C(3973922572), UINT32_C(2327643682), UINT32_C(1171550495), UINT32_C(1292856284), UINT32_C(3391754429), UINT32_C(1565674388),
+      UINT32_C(1338257789), UINT32_C(1392877939), UINT32_C( 416892817), UINT32_C(3080953764), UINT32_C(1064983993), UINT32_C(2664725217), UINT32_C(2898021008), UINT32_C(3606375769),
+      UINT32_C(3410384106), UINT32_C(4023488760), UINT32_C(3552371358), UINT32_C(1315282442), UINT32_C(4169695255), UINT32_C(1464107511), UINT32_C(3048800091), UINT32_C(1194099063),
+      UINT32_C(3234168285), UINT32_C(2557673635), UINT32_C(3852008717), UINT32_C(2986167787) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i])),
+      cv = simde_svld1_u32(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmad_u32_m(pv, av, bv, cv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], c[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+    cv = simde_svld1_u32(pg, &(c[i]));
+
+    ev = simde_svmad_u32_m(pv, av, bv, cv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C( 4264317377539430732), UINT64_C( 4166371254008749201), UINT64_C( 1649678112284851547), UINT64_C( 1842191928302221231),
+      UINT64_C(14657818458211374112), UINT64_C( 5328428987076051492), UINT64_C(17345017211860642590), UINT64_C( 2918023631828566424),
+      UINT64_C( 9601889224606898235), UINT64_C( 5907649805516984773), UINT64_C( 8344508048327375260), UINT64_C( 5050600116371072230),
+      UINT64_C(17840160216352255919), UINT64_C(11479857986271892172), UINT64_C(14766821478145736863), UINT64_C(14753459353822086765),
+      UINT64_C( 4713422134760405312), UINT64_C( 6477461289470792514), UINT64_C( 1694129348800635088), UINT64_C( 5652384832140885128),
+      UINT64_C(18410199314715462856), UINT64_C( 2328406430778179390), UINT64_C( 7875486114827871369), UINT64_C(17433859847363943316),
+      UINT64_C( 1912813629505188560), UINT64_C( 9429239069555216492), UINT64_C(11446181067929072006), UINT64_C( 4609207096536263900),
+      UINT64_C( 4529028937963808227), UINT64_C(15394382487114935335), UINT64_C( 3904088002758007175), UINT64_C( 9562886523527589639),
+      UINT64_C(  101646384658416216), UINT64_C(13776445531458986763), UINT64_C(10641300636308631837), UINT64_C( 8291899989010541037),
+      UINT64_C( 9159203937425708609), UINT64_C( 2261379869820140906), UINT64_C( 2204868465634292346), UINT64_C(11798514453155979821),
+      UINT64_C(14630183501953915412), UINT64_C( 7222033181349699864), UINT64_C( 4814351393381601410), UINT64_C( 5668703970064563366),
+      UINT64_C( 6687809454900472482), UINT64_C(10308651644832071104), UINT64_C( 2582834716881353344), UINT64_C( 5627484867213878159),
+      UINT64_C(10295828869006159681), UINT64_C( 9942902377851476063), UINT64_C(16097261792662535875), UINT64_C(12057193271326773082),
+      UINT64_C( 2741583622651618736), UINT64_C( 5978966727031146087), UINT64_C( 7565192014561679308), UINT64_C( 1627138013185025414),
+      UINT64_C( 3986708010643013990), UINT64_C( 4740215029874812647), UINT64_C(15505429874350119608), UINT64_C(14086511263857482496),
+      UINT64_C(11033894622260629784), UINT64_C( 2368848773348575018), UINT64_C(10978109686949494066), UINT64_C(10218521822186315183),
+      UINT64_C( 3303836742346784653), UINT64_C(17502584371285911645), UINT64_C(10311501380698098665), UINT64_C( 2373232709877831660),
+      UINT64_C( 6366463674690790697), UINT64_C(13534165509433337377), UINT64_C(  233436315888928975), UINT64_C( 7791038527103686764),
+      UINT64_C(15568085982247485369), UINT64_C(18277731745874389530) };
+  static const uint64_t b[] =
+    { UINT64_C( 2034651182119119545), UINT64_C(13584630121742291689), UINT64_C(  144466484848372502), UINT64_C(16697815992887318575),
+      UINT64_C( 3823128704079348857), UINT64_C(17846014767282557901), UINT64_C( 7959443007023808498), UINT64_C( 6939033170388604984),
+      UINT64_C(15324166262935948073), UINT64_C(11874419579998497523), UINT64_C( 4617750961729268073), UINT64_C( 5633143478078062820),
+      UINT64_C(15084927754355048062), UINT64_C(16982352374182189399), UINT64_C( 3828526223560262872), UINT64_C( 4024859867431880552),
+      UINT64_C( 7158775122453372586), UINT64_C( 5015630568909241901), UINT64_C( 4567290862096428765), UINT64_C( 4251020433770242829),
+      UINT64_C(18209492345114769991), UINT64_C( 1714824974342824218), UINT64_C( 5011845820589666678), UINT64_C( 5319889165633739274),
+      UINT64_C(14740652882799662789), UINT64_C(18213998926968864115), UINT64_C(13587033182750444049), UINT64_C( 7745112352484662064),
+      UINT64_C(15942621092296792256), UINT64_C(14073836462873940942), UINT64_C(11585399471957907801), UINT64_C(  524476151189675318),
+      UINT64_C(12083081765665261416), UINT64_C(16412044523145476685), UINT64_C(11598375883658678244), UINT64_C( 9304652437933312210),
+      UINT64_C(11712458923344894731), UINT64_C(13090104644072474173), UINT64_C( 2179741449204700980), UINT64_C(10043405950258756551),
+      UINT64_C(17648193754905949427), UINT64_C( 2595873218551843712), UINT64_C(15521375805912518908), UINT64_C(16845460377062317757),
+      UINT64_C(12715943443070793420), UINT64_C(10717169189719716775), UINT64_C( 4395305974762339608), UINT64_C(11151546884461999842),
+      UINT64_C(13139136531360838518), UINT64_C( 8788220937214187978), UINT64_C(17888473736343049093), UINT64_C( 8052317357035600214),
+      UINT64_C( 4560860494639324550), UINT64_C( 2783673858335545543), UINT64_C( 4213799026227299179), UINT64_C( 7245198740344949540),
+      UINT64_C(15613492899335545851), UINT64_C( 6027120221247000798), UINT64_C( 6774062803903107044), UINT64_C( 8780901613217472665),
+      UINT64_C(17983883882393032362), UINT64_C( 1811041017595991015), UINT64_C(16033908984496912107), UINT64_C(12698798578912919108),
+      UINT64_C(11609716589354296072), UINT64_C(11376535425984271763), UINT64_C(16909968383116755849), UINT64_C( 4394360073207153220),
+      UINT64_C(17971470718396819211), UINT64_C(17537196627926832914), UINT64_C(12535608385762042726), UINT64_C(10872238756542849904),
+      UINT64_C(15040548030083973466), UINT64_C( 9581395142016990106) };
+  static const uint64_t c[] =
+    { UINT64_C(15313366968304174205), UINT64_C( 9755636659438141383), UINT64_C(15832180331488721604), UINT64_C(  939903839944728740),
+      UINT64_C(14748248666750452665), UINT64_C(  175598874213696270), UINT64_C(10921722724313775764), UINT64_C( 7979719613076045856),
+      UINT64_C(16464583916142430123), UINT64_C( 7166982714427241526), UINT64_C( 6882813322066493434), UINT64_C( 8380861123985875242),
+      UINT64_C(13767119816624543060), UINT64_C( 1281461107150805654), UINT64_C(13170640270053531945), UINT64_C(17790031764846401188),
+      UINT64_C( 4665780517359060856), UINT64_C(14281034940000105225), UINT64_C( 6237474157428092750), UINT64_C( 9323760783223694795),
+      UINT64_C(13589685213641999790), UINT64_C(17913362920681258293), UINT64_C( 9891138149979113531), UINT64_C( 6777736773791844486),
+      UINT64_C(  671123015118262752), UINT64_C( 8371476170928827531), UINT64_C(16538526662780976701), UINT64_C(13239601961293347758),
+      UINT64_C( 5472326275065147925), UINT64_C( 9256495112429555144), UINT64_C( 3238369044608047019), UINT64_C(18232901055023834234),
+      UINT64_C(13169607154591945656), UINT64_C(11198250986159686564), UINT64_C( 6750499894880297732), UINT64_C( 3954361128933275899),
+      UINT64_C( 4732845181708977673), UINT64_C(10898589686560286388), UINT64_C( 8698077596482135668), UINT64_C( 2572465896628708351),
+      UINT64_C( 9719272476803555586), UINT64_C( 1106313875699665456), UINT64_C( 4270850864805540944), UINT64_C(16194219538411725183),
+      UINT64_C(15142898148185266381), UINT64_C(  798809194988130667), UINT64_C( 1790776343187192932), UINT64_C(14735055599967507391),
+      UINT64_C(14536655733097561415), UINT64_C(11937605832315720164), UINT64_C( 6778515161105138273), UINT64_C( 8754567984296215474),
+      UINT64_C( 7034093193799068278), UINT64_C(12995042526229458544), UINT64_C( 7938369206019333164), UINT64_C( 1526612107982743172),
+      UINT64_C( 2334986320921399688), UINT64_C( 4539109533465798647), UINT64_C(17432929952013659588), UINT64_C( 3679395454717988187),
+      UINT64_C( 8806964456718924392), UINT64_C(17750869976740530439), UINT64_C(17496032205799318127), UINT64_C(12993161229302003314),
+      UINT64_C( 3454828436018465013), UINT64_C(16732736808660022798), UINT64_C( 9478551169053076737), UINT64_C( 7425292784520689162),
+      UINT64_C(16920255645081458553), UINT64_C(13396626380698556553), UINT64_C( 5666333466326839309), UINT64_C(12406483710376166226),
+      UINT64_C( 7443638600099236999), UINT64_C(16548007167197280053) };
+  static const uint64_t e[] =
+    { UINT64_C(                   0), UINT64_C( 9497298694368342464), UINT64_C(10955368300873664918), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 7778662621447955938), UINT64_C(                   0), UINT64_C(10903092317216315744),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(13709836673093000438), UINT64_C(16674974771710033410),
+      UINT64_C(14664818835201961846), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 4019392864339701228),
+      UINT64_C(13517977463718939640), UINT64_C(18003872074511995299), UINT64_C(                   0), UINT64_C( 3818501988646637747),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(  646517389934726128), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 6081323941714273365), UINT64_C(                   0), UINT64_C( 7169761570267440794), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(12287457603293514739), UINT64_C(10614292043829613528), UINT64_C( 1616274321529718117),
+      UINT64_C(                   0), UINT64_C( 7152301267698353398), UINT64_C(12454803100302318908), UINT64_C(17907108869565338618),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 7077822372599354440), UINT64_C(                   0),
+      UINT64_C( 7781016684208979429), UINT64_C(15706187912108628395), UINT64_C(17360278174380095588), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(15030285386051606192), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 4091368569316135041), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(10003645654066537098), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(13438144794879450605), UINT64_C(                   0), UINT64_C( 9235960613005032174),
+      UINT64_C(                   0), UINT64_C(12672218708444202101), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 9452263185132945287), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 8672172387585050841) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i])),
+      cv = simde_svld1_u64(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmad_u64_z(pv, av, bv, cv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], c[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+    cv = simde_svld1_u64(pg, &(c[i]));
+
+    ev = simde_svmad_u64_z(pv, av, bv, cv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C( 5428315508602277264), UINT64_C(13953826522505722328), UINT64_C(14804333841224081081), UINT64_C(11845682064516535746),
+      UINT64_C( 8600692896942153694), UINT64_C( 7535024309004385157), UINT64_C( 6369772768401426023), UINT64_C( 5622275126003310415),
+      UINT64_C(14901208616179498420), UINT64_C( 2129411757672689269), UINT64_C( 6639180021740475190), UINT64_C( 2304089746298574138),
+      UINT64_C( 9753175088587495234), UINT64_C( 6845251706879211563), UINT64_C(  843947541718021452), UINT64_C( 9073820016338957666),
+      UINT64_C(14384324157402275334), UINT64_C(14979721692902410843), UINT64_C(13563679177380990046), UINT64_C(11964786167486476627),
+      UINT64_C(15075621040908276691), UINT64_C(16787790523742347432), UINT64_C( 6077697864003691074), UINT64_C( 2993465859787383107),
+      UINT64_C( 5640987946671228929), UINT64_C( 1522906975060991152), UINT64_C(14982079084806355349), UINT64_C(13576731901115485674),
+      UINT64_C( 9473739438043628421), UINT64_C(18086701732342919703), UINT64_C(11922291258935062809), UINT64_C(16915890065906214730),
+      UINT64_C( 9703444579689559123), UINT64_C( 6909209327684380545), UINT64_C( 4216347751556084514), UINT64_C(  931964442545973664),
+      UINT64_C( 1579034570440967412), UINT64_C(17215254541398465090), UINT64_C(  467053187460492625), UINT64_C(12573199938362260151),
+      UINT64_C(14747032077422669567), UINT64_C(15208443190984418133), UINT64_C(16183562294181288491), UINT64_C(11291594765030761290),
+      UINT64_C( 1572555340131583356), UINT64_C(10506411289305557114), UINT64_C(13630629652012917536), UINT64_C(14165639733757246044),
+      UINT64_C( 1589942866514986299), UINT64_C(12446788887774316484), UINT64_C(17578428504879783363), UINT64_C( 7468520885367715481),
+      UINT64_C(15058755178756992841), UINT64_C(12750454625253658041), UINT64_C(11537897920194341012), UINT64_C(15646111558013160591),
+      UINT64_C(12714711745763968151), UINT64_C(13359058742846844615), UINT64_C(12932088687275297489), UINT64_C(13364591472095001102),
+      UINT64_C(13384082301833197334), UINT64_C( 7934448216939803710), UINT64_C( 1293867909839716380), UINT64_C(  762278169543664569),
+      UINT64_C(18233339584045379678), UINT64_C( 7319611943707244169), UINT64_C( 5877366393974151804), UINT64_C(14266207797286551548),
+      UINT64_C( 8173222882408993712), UINT64_C(14358086162555850389), UINT64_C( 9146765220390561797), UINT64_C(10106758008985819925),
+      UINT64_C(  852986236183009149), UINT64_C(11333637871285857592), UINT64_C( 8868197232012922643), UINT64_C( 7615087706275021125),
+      UINT64_C( 5481625201912294033), UINT64_C( 4055799489499232787), UINT64_C(17548521886698013864), UINT64_C( 5383705605197627489),
+      UINT64_C( 4525663714075051373), UINT64_C( 6826386894665391454), UINT64_C(14508614928772598198), UINT64_C(11347044867958533492),
+      UINT64_C(10068903271057049938), UINT64_C(10277155900541019531), UINT64_C( 8324141948511325011), UINT64_C(13512233100131736759),
+      UINT64_C( 2205343875709117666), UINT64_C(14339460609859365017), UINT64_C(17544907302279246090), UINT64_C( 1713725439196470436),
+      UINT64_C(10355395083538661636), UINT64_C( 2135549634070713448), UINT64_C(14997165069763486961), UINT64_C( 6920808166265322431),
+      UINT64_C( 6425982397064884647), UINT64_C( 2229799882358861248), UINT64_C( 8788893120097622267), UINT64_C( 2531718417768896103),
+      UINT64_C( 9724660027872057769), UINT64_C(18115249015730350363), UINT64_C( 9554136045875081571), UINT64_C( 2851176026544145906),
+      UINT64_C( 6687481784394928770), UINT64_C(15553756855361874142), UINT64_C(  818964749910146492), UINT64_C(10319447746888180881),
+      UINT64_C(10086556480562526045), UINT64_C( 7356705485047373517), UINT64_C( 3127360273241804097), UINT64_C( 5250476896515973185),
+      UINT64_C( 2927586435293164903), UINT64_C(10344347566802012799), UINT64_C(12417076643286929038), UINT64_C( 7234144379281771569),
+      UINT64_C(12254039687944489868), UINT64_C( 9727882919087929378), UINT64_C( 7801924759975815727), UINT64_C(11884697156336500877),
+      UINT64_C(11605383161701951032) };
+  static const uint64_t b[] =
+    { UINT64_C( 9376991255700249123), UINT64_C( 4865509225115792804), UINT64_C( 8082948100578978855), UINT64_C(10239751150912086840),
+      UINT64_C( 8602236838073536257), UINT64_C(12906634340276751102), UINT64_C(12189202882315356735), UINT64_C(10726473230135831523),
+      UINT64_C( 5291681509939544869), UINT64_C( 5754827436531613086), UINT64_C( 1397575145727947083), UINT64_C(11241052248750514394),
+      UINT64_C(16561147910072595264), UINT64_C( 9646971237625231745), UINT64_C(17339604131136005982), UINT64_C( 9302569041167975175),
+      UINT64_C( 3746682294066065105), UINT64_C( 6384878290758536668), UINT64_C( 9985475997277347212), UINT64_C( 2184000962334093452),
+      UINT64_C( 1996279081699073231), UINT64_C(12219898689404106818), UINT64_C(10572444239068363946), UINT64_C(12770711975229374670),
+      UINT64_C(16818384559857103115), UINT64_C( 1019426930923312991), UINT64_C( 2220261762483908920), UINT64_C(16737193560209239988),
+      UINT64_C(13796101673467476454), UINT64_C(10350223397421357872), UINT64_C( 9745962024265637842), UINT64_C(15317133684337638091),
+      UINT64_C(10231288149412267228), UINT64_C( 7807208317853513842), UINT64_C(10016232897340384421), UINT64_C( 6704669629021953352),
+      UINT64_C(13002901763229641865), UINT64_C(  131683406973867726), UINT64_C( 8594692383805432314), UINT64_C(14445218010479098520),
+      UINT64_C( 8438656804668182821), UINT64_C( 7572152339614439863), UINT64_C(11797294716660453137), UINT64_C( 4965837747949168355),
+      UINT64_C( 8169750429193508932), UINT64_C(18318843305502522721), UINT64_C(12310581636604321065), UINT64_C(  847441747352785758),
+      UINT64_C(10987471605507518031), UINT64_C(14087438418894651540), UINT64_C( 1616738079944982527), UINT64_C( 4770533507666820194),
+      UINT64_C( 1698920854119525317), UINT64_C(11323203531149278407), UINT64_C( 5523333897903021272), UINT64_C( 6143941852139960846),
+      UINT64_C( 2121446483991564245), UINT64_C(18022177702399576544), UINT64_C( 6842709806835990207), UINT64_C(16956230812345265002),
+      UINT64_C( 7396796828395741490), UINT64_C( 9716798529466606780), UINT64_C(18315056205165257598), UINT64_C( 6958705938487937937),
+      UINT64_C( 5032929304559277547), UINT64_C( 4324016107492261299), UINT64_C(16785821087035961696), UINT64_C( 2472512715274316994),
+      UINT64_C( 8846595547639003639), UINT64_C( 5125930797478832424), UINT64_C( 2766950025920195623), UINT64_C( 1041289288695084571),
+      UINT64_C(11232633270955804576), UINT64_C(17612350869238568765), UINT64_C(17319112252232738511), UINT64_C( 8571675925383573454),
+      UINT64_C( 1497940381514236860), UINT64_C(13643835311102904983), UINT64_C( 8146811211605920330), UINT64_C(13908605511455428792),
+      UINT64_C( 4231898912382837710), UINT64_C(16190148838602764804), UINT64_C(11588904128109059776), UINT64_C( 4982446245846920030),
+      UINT64_C(15273576398391481624), UINT64_C( 5408105769147339927), UINT64_C( 8690120008357776401), UINT64_C( 1470710035286640813),
+      UINT64_C(10356527590441767703), UINT64_C(  158129502713314906), UINT64_C( 1110018985824083925), UINT64_C( 6732208843946935388),
+      UINT64_C( 6807187555017309680), UINT64_C(15091409503838745467), UINT64_C( 6612735607099648596), UINT64_C( 9587920158021974379),
+      UINT64_C(14754324888159081311), UINT64_C(14836167210920576023), UINT64_C( 3993647010875155474), UINT64_C(11699498902270583105),
+      UINT64_C(14296613995338385995), UINT64_C( 6418120157286736075), UINT64_C( 2190675609433838690), UINT64_C(10582704065780994040),
+      UINT64_C( 8399377861519991579), UINT64_C(10004404793683503413), UINT64_C( 1105666793637691485), UINT64_C(13422460401519054189),
+      UINT64_C( 4479133336312509451), UINT64_C(  589849143103119741), UINT64_C( 8356598463043135441), UINT64_C( 8448874304743424743),
+      UINT64_C( 6136528158392501474), UINT64_C( 5037321765164606516), UINT64_C(12432792349248989713), UINT64_C(  236564470039753320),
+      UINT64_C(18042573241791246902), UINT64_C(11076253125334097660), UINT64_C( 8312864304801047788), UINT64_C( 4112224074246557933),
+      UINT64_C( 1567440797514006529) };
+  static const uint64_t c[] =
+    { UINT64_C(11102411041724631520), UINT64_C( 6184220328626733959), UINT64_C( 2011121346110633204), UINT64_C(10805053279645744847),
+      UINT64_C(10009984655539393099), UINT64_C( 3266508553433019744), UINT64_C( 3854115250033423916), UINT64_C( 9086566623338688719),
+      UINT64_C(11517877154051170891), UINT64_C( 2419544560630693165), UINT64_C(11170051656400386920), UINT64_C( 5521474720674810095),
+      UINT64_C( 6177092776679272411), UINT64_C(12863773987783268206), UINT64_C(17722091171435513993), UINT64_C( 2655356081350840716),
+      UINT64_C( 5954875692251247399), UINT64_C( 3912005938318827086), UINT64_C(15798765268027361860), UINT64_C( 3962114408001853326),
+      UINT64_C( 9361620448208829365), UINT64_C( 2479622875835376263), UINT64_C(   96735529020486957), UINT64_C(13135546563295821572),
+      UINT64_C( 9134491877386473233), UINT64_C( 7988571278866046429), UINT64_C(18051907208432208145), UINT64_C( 5095918863549030144),
+      UINT64_C( 2349839155762628646), UINT64_C( 8924648378820415019), UINT64_C(  428268600747344897), UINT64_C( 9033869378554691555),
+      UINT64_C( 7001750750940096712), UINT64_C(13793302722277869190), UINT64_C(15165494537263475307), UINT64_C(  394989922943663527),
+      UINT64_C(15260512540972553777), UINT64_C(12231545956780447297), UINT64_C(14292612253715363480), UINT64_C(13641473143087579917),
+      UINT64_C(15958203586624905301), UINT64_C(   29726846280874371), UINT64_C( 2303274628174807826), UINT64_C( 5651660163965958692),
+      UINT64_C(  185887282856825370), UINT64_C( 2236367124459385248), UINT64_C(10799990835816403119), UINT64_C( 2326306045791914752),
+      UINT64_C( 4740155846553909574), UINT64_C( 7423993460573178843), UINT64_C(11378637604366407651), UINT64_C( 2917172446456393302),
+      UINT64_C(11023604335114015257), UINT64_C( 8817916781705315392), UINT64_C(16724600531004066015), UINT64_C(12317274138715927013),
+      UINT64_C(15232967873759862033), UINT64_C( 5599428364643067556), UINT64_C( 2246701628529410994), UINT64_C( 4814302028965048724),
+      UINT64_C( 3970334921411540147), UINT64_C(13841856399219549276), UINT64_C( 6414306495286272682), UINT64_C( 8436734971820829602),
+      UINT64_C(17819851588147815809), UINT64_C(10486310566602391480), UINT64_C( 6835190710014413501), UINT64_C( 2926010062326552932),
+      UINT64_C(16356661710242535019), UINT64_C( 6395162714920501320), UINT64_C( 1428685271990941112), UINT64_C(13176921506383987726),
+      UINT64_C(17020998151869110826), UINT64_C(14226830592860479099), UINT64_C( 1068211829181336080), UINT64_C(  797876973782371345),
+      UINT64_C(  453058758543724474), UINT64_C( 5784464975780996213), UINT64_C(11377467653159354582), UINT64_C(  133714116525795311),
+      UINT64_C( 5146674095791684571), UINT64_C(17049518873474795788), UINT64_C( 9059455254713772943), UINT64_C(11138854052367807053),
+      UINT64_C(12140979584342487908), UINT64_C(16426475381515896309), UINT64_C(12341754546110838843), UINT64_C( 2360964534283244394),
+      UINT64_C( 2597401810592777160), UINT64_C(14650250885778571032), UINT64_C( 8279827264071552989), UINT64_C(14072164418517149550),
+      UINT64_C(10120769733455749153), UINT64_C(11928990635299283506), UINT64_C( 7643392504957575577), UINT64_C( 3219756025906572783),
+      UINT64_C( 4215351697477522816), UINT64_C( 6629167544844122259), UINT64_C(10956992540212715689), UINT64_C(  356684341356766395),
+      UINT64_C(17530674278984806407), UINT64_C( 8506259342034355695), UINT64_C(15091327153928341550), UINT64_C( 3195176552586867663),
+      UINT64_C(13065089601704316668), UINT64_C( 1805226481340030666), UINT64_C( 2477648657054181499), UINT64_C( 9485931597362756435),
+      UINT64_C( 3500756404256366618), UINT64_C(16848763827486522317), UINT64_C( 8535408862557815806), UINT64_C(14907639019951024344),
+      UINT64_C(13693550848014991731), UINT64_C(11932087821771723071), UINT64_C(14314244937388265741), UINT64_C(11084210967765423185),
+      UINT64_C(  322144562035458761), UINT64_C( 5159235365691912269), UINT64_C( 5264459441641066330), UINT64_C(  392132287263552945),
+      UINT64_C(12496987998446936996) };
+  static const uint64_t e[] =
+    { UINT64_C( 5428315508602277264), UINT64_C(17032270543698561511), UINT64_C(14804333841224081081), UINT64_C(11845682064516535746),
+      UINT64_C( 9258220084238726185), UINT64_C( 8343406636686275926), UINT64_C( 6369772768401426023), UINT64_C( 5622275126003310415),
+      UINT64_C(14901208616179498420), UINT64_C( 8423319459265268323), UINT64_C( 3256330099595588154), UINT64_C(10588031948952099923),
+      UINT64_C(13122354956898788955), UINT64_C( 6845251706879211563), UINT64_C(18017265257580473969), UINT64_C( 1709518247093497146),
+      UINT64_C(14384324157402275334), UINT64_C(14537296615991206786), UINT64_C(16382013906927924140), UINT64_C(15917496816412532978),
+      UINT64_C(15075621040908276691), UINT64_C(16787790523742347432), UINT64_C( 6077697864003691074), UINT64_C(14263995745651278574),
+      UINT64_C( 6185676837086058524), UINT64_C(  939854652459963181), UINT64_C(14982079084806355349), UINT64_C(17174822800839155080),
+      UINT64_C( 9473739438043628421), UINT64_C( 9058955348281433979), UINT64_C(11922291258935062809), UINT64_C( 9962248375328074641),
+      UINT64_C( 9703444579689559123), UINT64_C(13499827267224950264), UINT64_C( 4216347751556084514), UINT64_C(  931964442545973664),
+      UINT64_C( 1579034570440967412), UINT64_C(17215254541398465090), UINT64_C(  467053187460492625), UINT64_C( 6236771772819592629),
+      UINT64_C(14747032077422669567), UINT64_C(15208443190984418133), UINT64_C( 6865725314893939949), UINT64_C(10510804416770474178),
+      UINT64_C( 2902522299598219018), UINT64_C(10506411289305557114), UINT64_C(13630629652012917536), UINT64_C( 9467822636739398856),
+      UINT64_C(11937613560459653243), UINT64_C( 9914713986616985899), UINT64_C(17578428504879783363), UINT64_C( 7468520885367715481),
+      UINT64_C(15058755178756992841), UINT64_C(12750454625253658041), UINT64_C(14636785569065792959), UINT64_C(15646111558013160591),
+      UINT64_C(12714711745763968151), UINT64_C( 6346774773791708100), UINT64_C(14557271429421347745), UINT64_C( 1901182727185159520),
+      UINT64_C(13384082301833197334), UINT64_C( 1493264614061898212), UINT64_C(11413580658644337778), UINT64_C(  762278169543664569),
+      UINT64_C(16094499435486314955), UINT64_C( 5868274847087117955), UINT64_C(14059173949247403325), UINT64_C(14266207797286551548),
+      UINT64_C( 8173222882408993712), UINT64_C(14358086162555850389), UINT64_C( 9146765220390561797), UINT64_C( 8732677729448955205),
+      UINT64_C(  163701075578073930), UINT64_C(17712965916665310419), UINT64_C( 8868197232012922643), UINT64_C(16351292927256755351),
+      UINT64_C(13720259980402640182), UINT64_C( 2091391955324593066), UINT64_C( 1119021146069821798), UINT64_C( 5284626131864206759),
+      UINT64_C( 4525663714075051373), UINT64_C( 7804811867971771012), UINT64_C(14508614928772598198), UINT64_C(11347044867958533492),
+      UINT64_C(12761060102911528212), UINT64_C(10455489925460018930), UINT64_C( 1598450398405090494), UINT64_C(13512233100131736759),
+      UINT64_C(14721659321420732950), UINT64_C(17002059513817699042), UINT64_C(17544907302279246090), UINT64_C( 1713725439196470436),
+      UINT64_C(10355395083538661636), UINT64_C(15902031013221247018), UINT64_C( 2467348190357162669), UINT64_C( 6920808166265322431),
+      UINT64_C( 4385255400302995321), UINT64_C( 2229799882358861248), UINT64_C( 8788893120097622267), UINT64_C( 6379904400198556642),
+      UINT64_C(11680488662983134858), UINT64_C(18115249015730350363), UINT64_C(17805611577547697172), UINT64_C( 2851176026544145906),
+      UINT64_C( 6687481784394928770), UINT64_C( 4012824730707305152), UINT64_C(15695313412640495047), UINT64_C(10319447746888180881),
+      UINT64_C(10086556480562526045), UINT64_C( 7356705485047373517), UINT64_C( 3127360273241804097), UINT64_C( 5250476896515973185),
+      UINT64_C(17853383553885389409), UINT64_C(17697239751837159179), UINT64_C( 5635888376398025851), UINT64_C(14671074490725341753),
+      UINT64_C(12254039687944489868), UINT64_C( 9727882919087929378), UINT64_C( 6743413321918664366), UINT64_C(11884697156336500877),
+      UINT64_C(11605383161701951032) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i])),
+      cv = simde_svld1_u64(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmad_u64_m(pv, av, bv, cv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], c[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_test_codegen_random_memory(sizeof(c), HEDLEY_REINTERPRET_CAST(uint8_t*, c));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+    cv = simde_svld1_u64(pg, &(c[i]));
+
+    ev = simde_svmad_u64_m(pv, av, bv, cv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   -98.96), SIMDE_FLOAT32_C(   -15.32), SIMDE_FLOAT32_C(    25.70), SIMDE_FLOAT32_C(   -62.13),
+      SIMDE_FLOAT32_C(    35.73), SIMDE_FLOAT32_C(    63.59), SIMDE_FLOAT32_C(   -79.44), SIMDE_FLOAT32_C(   -35.11),
+      SIMDE_FLOAT32_C(    68.64), SIMDE_FLOAT32_C(   -15.87), SIMDE_FLOAT32_C(    16.44), SIMDE_FLOAT32_C(   -13.03),
+      SIMDE_FLOAT32_C(   -67.28), SIMDE_FLOAT32_C(    46.91), SIMDE_FLOAT32_C(   -42.99), SIMDE_FLOAT32_C(    16.44),
+      SIMDE_FLOAT32_C(     0.32), SIMDE_FLOAT32_C(    52.60), SIMDE_FLOAT32_C(   -89.20), SIMDE_FLOAT32_C(   -40.41),
+      SIMDE_FLOAT32_C(   -86.76), SIMDE_FLOAT32_C(   -83.63), SIMDE_FLOAT32_C(    32.08), SIMDE_FLOAT32_C(    41.11),
+      SIMDE_FLOAT32_C(    39.15), SIMDE_FLOAT32_C(   -88.90), SIMDE_FLOAT32_C(     6.37), SIMDE_FLOAT32_C(   -77.15),
+      SIMDE_FLOAT32_C(   -43.22), SIMDE_FLOAT32_C(    21.98), SIMDE_FLOAT32_C(    75.54), SIMDE_FLOAT32_C(   -42.18),
+      SIMDE_FLOAT32_C(   -93.34), SIMDE_FLOAT32_C(     1.24), SIMDE_FLOAT32_C(    -4.31), SIMDE_FLOAT32_C(    42.38),
+      SIMDE_FLOAT32_C(   -35.17), SIMDE_FLOAT32_C(    16.25), SIMDE_FLOAT32_C(   -92.73), SIMDE_FLOAT32_C(   -66.53),
+      SIMDE_FLOAT32_C(   -99.62), SIMDE_FLOAT32_C(    23.72), SIMDE_FLOAT32_C(    20.44), SIMDE_FLOAT32_C(   -66.90),
+      SIMDE_FLOAT32_C(   -29.37), SIMDE_FLOAT32_C(    77.45), SIMDE_FLOAT32_C(    49.54), SIMDE_FLOAT32_C(    70.94),
+      SIMDE_FLOAT32_C(    30.05), SIMDE_FLOAT32_C(    60.34), SIMDE_FLOAT32_C(   -69.47), SIMDE_FLOAT32_C(    43.29),
+      SIMDE_FLOAT32_C(    76.70), SIMDE_FLOAT32_C(    62.61), SIMDE_FLOAT32_C(   -15.60), SIMDE_FLOAT32_C(    15.85),
+      SIMDE_FLOAT32_C(    73.70), SIMDE_FLOAT32_C(    90.77), SIMDE_FLOAT32_C(    38.70), SIMDE_FLOAT32_C(   -69.52),
+      SIMDE_FLOAT32_C(    12.75), SIMDE_FLOAT32_C(    14.24), SIMDE_FLOAT32_C(   -11.69), SIMDE_FLOAT32_C(    19.41),
+      SIMDE_FLOAT32_C(   -84.51), SIMDE_FLOAT32_C(    84.00), SIMDE_FLOAT32_C(   -38.21), SIMDE_FLOAT32_C(   -19.69),
+      SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(   -30.94), SIMDE_FLOAT32_C(    13.78), SIMDE_FLOAT32_C(     0.63),
+      SIMDE_FLOAT32_C(    92.78), SIMDE_FLOAT32_C(   -65.77), SIMDE_FLOAT32_C(    33.73), SIMDE_FLOAT32_C(   -36.60),
+      SIMDE_FLOAT32_C(   -88.33), SIMDE_FLOAT32_C(   -16.74), SIMDE_FLOAT32_C(   -65.65), SIMDE_FLOAT32_C(    41.73),
+      SIMDE_FLOAT32_C(   -56.40), SIMDE_FLOAT32_C(   -35.12), SIMDE_FLOAT32_C(   -14.98), SIMDE_FLOAT32_C(   -79.70),
+      SIMDE_FLOAT32_C(   -72.52), SIMDE_FLOAT32_C(    69.43), SIMDE_FLOAT32_C(    36.16), SIMDE_FLOAT32_C(   -98.81),
+      SIMDE_FLOAT32_C(    60.20), SIMDE_FLOAT32_C(   -25.14), SIMDE_FLOAT32_C(   -68.33), SIMDE_FLOAT32_C(   -27.05),
+      SIMDE_FLOAT32_C(    89.10), SIMDE_FLOAT32_C(    19.97), SIMDE_FLOAT32_C(    92.35), SIMDE_FLOAT32_C(   -95.41),
+      SIMDE_FLOAT32_C(     3.97), SIMDE_FLOAT32_C(   -45.86), SIMDE_FLOAT32_C(   -15.10), SIMDE_FLOAT32_C(   -95.78),
+      SIMDE_FLOAT32_C(    23.20), SIMDE_FLOAT32_C(    98.69), SIMDE_FLOAT32_C(     4.84), SIMDE_FLOAT32_C(    15.98),
+      SIMDE_FLOAT32_C(   -67.09), SIMDE_FLOAT32_C(   -61.43), SIMDE_FLOAT32_C(    79.38), SIMDE_FLOAT32_C(   -55.41),
+      SIMDE_FLOAT32_C(    21.83), SIMDE_FLOAT32_C(   -86.27), SIMDE_FLOAT32_C(    86.32), SIMDE_FLOAT32_C(    65.43),
+      SIMDE_FLOAT32_C(   -21.39), SIMDE_FLOAT32_C(   -28.66), SIMDE_FLOAT32_C(    85.74), SIMDE_FLOAT32_C(     6.09),
+      SIMDE_FLOAT32_C(   -59.24), SIMDE_FLOAT32_C(    21.89), SIMDE_FLOAT32_C(     7.27), SIMDE_FLOAT32_C(   -99.04),
+      SIMDE_FLOAT32_C(    96.75), SIMDE_FLOAT32_C(    38.94), SIMDE_FLOAT32_C(   -26.09), SIMDE_FLOAT32_C(    85.85),
+      SIMDE_FLOAT32_C(   -41.09), SIMDE_FLOAT32_C(   -33.74), SIMDE_FLOAT32_C(    90.44), SIMDE_FLOAT32_C(    62.88),
+      SIMDE_FLOAT32_C(    20.40), SIMDE_FLOAT32_C(   -24.65), SIMDE_FLOAT32_C(    67.10), SIMDE_FLOAT32_C(   -56.40),
+      SIMDE_FLOAT32_C(   -25.97), SIMDE_FLOAT32_C(   -28.05), SIMDE_FLOAT32_C(    59.57), SIMDE_FLOAT32_C(     6.95),
+      SIMDE_FLOAT32_C(    10.51), SIMDE_FLOAT32_C(    38.95), SIMDE_FLOAT32_C(    51.53), SIMDE_FLOAT32_C(   -67.65),
+      SIMDE_FLOAT32_C(    52.68), SIMDE_FLOAT32_C(    37.85), SIMDE_FLOAT32_C(    97.78), SIMDE_FLOAT32_C(   -68.71),
+      SIMDE_FLOAT32_C(   -90.81), SIMDE_FLOAT32_C(    83.52), SIMDE_FLOAT32_C(    37.37), SIMDE_FLOAT32_C(   -50.05),
+      SIMDE_FLOAT32_C(     5.41), SIMDE_FLOAT32_C(   -55.35), SIMDE_FLOAT32_C(   -49.09), SIMDE_FLOAT32_C(     2.16),
+      SIMDE_FLOAT32_C(    83.59), SIMDE_FLOAT32_C(    24.82), SIMDE_FLOAT32_C(   -11.98), SIMDE_FLOAT32_C(   -57.50),
+      SIMDE_FLOAT32_C(    91.08), SIMDE_FLOAT32_C(   -21.54), SIMDE_FLOAT32_C(   -94.61), SIMDE_FLOAT32_C(    11.47),
+      SIMDE_FLOAT32_C(    53.81), SIMDE_FLOAT32_C(    72.49), SIMDE_FLOAT32_C(    55.07), SIMDE_FLOAT32_C(   -72.16),
+      SIMDE_FLOAT32_C(   -55.57), SIMDE_FLOAT32_C(    14.64), SIMDE_FLOAT32_C(    34.79), SIMDE_FLOAT32_C(    54.95),
+      SIMDE_FLOAT32_C(   -46.41), SIMDE_FLOAT32_C(   -13.68), SIMDE_FLOAT32_C(    87.29), SIMDE_FLOAT32_C(   -93.73),
+      SIMDE_FLOAT32_C(   -75.83), SIMDE_FLOAT32_C(    85.07), SIMDE_FLOAT32_C(   -62.44), SIMDE_FLOAT32_C(   -66.64),
+      SIMDE_FLOAT32_C(    68.59) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(    74.93), SIMDE_FLOAT32_C(   -16.69), SIMDE_FLOAT32_C(   -26.00), SIMDE_FLOAT32_C(   -80.42),
+      SIMDE_FLOAT32_C(    34.23), SIMDE_FLOAT32_C(    76.17), SIMDE_FLOAT32_C(   -96.83), SIMDE_FLOAT32_C(   -40.95),
+      SIMDE_FLOAT32_C(   -35.82), SIMDE_FLOAT32_C(   -54.33), SIMDE_FLOAT32_C(   -49.88), SIMDE_FLOAT32_C(    42.64),
+      SIMDE_FLOAT32_C(   -48.94), SIMDE_FLOAT32_C(    61.59), SIMDE_FLOAT32_C(    -3.55), SIMDE_FLOAT32_C(   -76.45),
+      SIMDE_FLOAT32_C(    16.66), SIMDE_FLOAT32_C(    24.28), SIMDE_FLOAT32_C(   -32.02), SIMDE_FLOAT32_C(   -68.70),
+      SIMDE_FLOAT32_C(   -40.93), SIMDE_FLOAT32_C(   -77.07), SIMDE_FLOAT32_C(   -15.11), SIMDE_FLOAT32_C(    45.39),
+      SIMDE_FLOAT32_C(   -89.78), SIMDE_FLOAT32_C(    -8.84), SIMDE_FLOAT32_C(    69.56), SIMDE_FLOAT32_C(    95.30),
+      SIMDE_FLOAT32_C(    28.72), SIMDE_FLOAT32_C(   -97.08), SIMDE_FLOAT32_C(    63.89), SIMDE_FLOAT32_C(     3.65),
+      SIMDE_FLOAT32_C(   -13.76), SIMDE_FLOAT32_C(   -62.11), SIMDE_FLOAT32_C(    23.23), SIMDE_FLOAT32_C(   -79.53),
+      SIMDE_FLOAT32_C(   -85.94), SIMDE_FLOAT32_C(    26.40), SIMDE_FLOAT32_C(   -20.49), SIMDE_FLOAT32_C(   -21.76),
+      SIMDE_FLOAT32_C(    72.08), SIMDE_FLOAT32_C(    29.63), SIMDE_FLOAT32_C(   -79.12), SIMDE_FLOAT32_C(   -76.87),
+      SIMDE_FLOAT32_C(    -8.77), SIMDE_FLOAT32_C(    17.33), SIMDE_FLOAT32_C(   -53.32), SIMDE_FLOAT32_C(   -92.11),
+      SIMDE_FLOAT32_C(   -58.39), SIMDE_FLOAT32_C(    14.66), SIMDE_FLOAT32_C(   -60.82), SIMDE_FLOAT32_C(     0.68),
+      SIMDE_FLOAT32_C(    37.59), SIMDE_FLOAT32_C(    24.07), SIMDE_FLOAT32_C(   -53.93), SIMDE_FLOAT32_C(    47.82),
+      SIMDE_FLOAT32_C(   -84.76), SIMDE_FLOAT32_C(   -84.36), SIMDE_FLOAT32_C(    43.12), SIMDE_FLOAT32_C(    43.96),
+      SIMDE_FLOAT32_C(   -81.44), SIMDE_FLOAT32_C(     7.01), SIMDE_FLOAT32_C(   -52.39), SIMDE_FLOAT32_C(     4.80),
+      SIMDE_FLOAT32_C(    44.90), SIMDE_FLOAT32_C(    70.85), SIMDE_FLOAT32_C(    25.27), SIMDE_FLOAT32_C(    58.96),
+      SIMDE_FLOAT32_C(    -2.75), SIMDE_FLOAT32_C(   -95.22), SIMDE_FLOAT32_C(   -62.80), SIMDE_FLOAT32_C(   -30.68),
+      SIMDE_FLOAT32_C(    34.41), SIMDE_FLOAT32_C(   -41.92), SIMDE_FLOAT32_C(    -7.54), SIMDE_FLOAT32_C(   -74.36),
+      SIMDE_FLOAT32_C(    75.41), SIMDE_FLOAT32_C(    39.14), SIMDE_FLOAT32_C(   -66.48), SIMDE_FLOAT32_C(   -82.98),
+      SIMDE_FLOAT32_C(   -46.20), SIMDE_FLOAT32_C(   -27.29), SIMDE_FLOAT32_C(    17.70), SIMDE_FLOAT32_C(    91.40),
+      SIMDE_FLOAT32_C(    96.78), SIMDE_FLOAT32_C(    63.78), SIMDE_FLOAT32_C(    39.22), SIMDE_FLOAT32_C(   -87.98),
+      SIMDE_FLOAT32_C(    79.41), SIMDE_FLOAT32_C(   -17.67), SIMDE_FLOAT32_C(    55.98), SIMDE_FLOAT32_C(    97.98),
+      SIMDE_FLOAT32_C(    89.34), SIMDE_FLOAT32_C(   -96.41), SIMDE_FLOAT32_C(     2.78), SIMDE_FLOAT32_C(    34.24),
+      SIMDE_FLOAT32_C(    74.43), SIMDE_FLOAT32_C(   -71.95), SIMDE_FLOAT32_C(    -6.80), SIMDE_FLOAT32_C(   -28.32),
+      SIMDE_FLOAT32_C(   -67.18), SIMDE_FLOAT32_C(    30.41), SIMDE_FLOAT32_C(    41.01), SIMDE_FLOAT32_C(    67.23),
+      SIMDE_FLOAT32_C(    88.49), SIMDE_FLOAT32_C(   -66.53), SIMDE_FLOAT32_C(    92.87), SIMDE_FLOAT32_C(    63.90),
+      SIMDE_FLOAT32_C(    72.61), SIMDE_FLOAT32_C(   -73.61), SIMDE_FLOAT32_C(    80.92), SIMDE_FLOAT32_C(   -73.59),
+      SIMDE_FLOAT32_C(    -0.90), SIMDE_FLOAT32_C(    -1.38), SIMDE_FLOAT32_C(   -82.19), SIMDE_FLOAT32_C(    -4.12),
+      SIMDE_FLOAT32_C(   -37.60), SIMDE_FLOAT32_C(    57.02), SIMDE_FLOAT32_C(     7.90), SIMDE_FLOAT32_C(   -58.19),
+      SIMDE_FLOAT32_C(   -60.64), SIMDE_FLOAT32_C(   -36.13), SIMDE_FLOAT32_C(   -60.21), SIMDE_FLOAT32_C(   -71.30),
+      SIMDE_FLOAT32_C(   -32.54), SIMDE_FLOAT32_C(    42.57), SIMDE_FLOAT32_C(    62.94), SIMDE_FLOAT32_C(   -58.10),
+      SIMDE_FLOAT32_C(    70.62), SIMDE_FLOAT32_C(   -43.86), SIMDE_FLOAT32_C(    13.58), SIMDE_FLOAT32_C(   -96.56),
+      SIMDE_FLOAT32_C(    86.55), SIMDE_FLOAT32_C(   -45.41), SIMDE_FLOAT32_C(    70.67), SIMDE_FLOAT32_C(    75.04),
+      SIMDE_FLOAT32_C(   -11.95), SIMDE_FLOAT32_C(    63.54), SIMDE_FLOAT32_C(    38.94), SIMDE_FLOAT32_C(   -39.34),
+      SIMDE_FLOAT32_C(    89.94), SIMDE_FLOAT32_C(    19.86), SIMDE_FLOAT32_C(   -12.93), SIMDE_FLOAT32_C(   -10.97),
+      SIMDE_FLOAT32_C(   -81.52), SIMDE_FLOAT32_C(     4.88), SIMDE_FLOAT32_C(    84.91), SIMDE_FLOAT32_C(   -19.12),
+      SIMDE_FLOAT32_C(   -38.10), SIMDE_FLOAT32_C(    -7.19), SIMDE_FLOAT32_C(    22.70), SIMDE_FLOAT32_C(     1.26),
+      SIMDE_FLOAT32_C(    56.68), SIMDE_FLOAT32_C(    62.49), SIMDE_FLOAT32_C(    29.96), SIMDE_FLOAT32_C(   -75.86),
+      SIMDE_FLOAT32_C(     5.06), SIMDE_FLOAT32_C(    -7.10), SIMDE_FLOAT32_C(   -33.96), SIMDE_FLOAT32_C(   -24.32),
+      SIMDE_FLOAT32_C(    49.04), SIMDE_FLOAT32_C(    79.62), SIMDE_FLOAT32_C(   -20.88), SIMDE_FLOAT32_C(    35.59),
+      SIMDE_FLOAT32_C(   -65.79), SIMDE_FLOAT32_C(   -50.21), SIMDE_FLOAT32_C(    10.63), SIMDE_FLOAT32_C(    22.26),
+      SIMDE_FLOAT32_C(   -86.66), SIMDE_FLOAT32_C(   -50.43), SIMDE_FLOAT32_C(    82.92), SIMDE_FLOAT32_C(   -96.73),
+      SIMDE_FLOAT32_C(    69.43), SIMDE_FLOAT32_C(   -30.01), SIMDE_FLOAT32_C(    -7.70), SIMDE_FLOAT32_C(    87.91),
+      SIMDE_FLOAT32_C(    74.87) };
+  static const simde_float32 c[] =
+    { SIMDE_FLOAT32_C(   -22.79), SIMDE_FLOAT32_C(   -31.21), SIMDE_FLOAT32_C(   -63.22), SIMDE_FLOAT32_C(    70.02),
+      SIMDE_FLOAT32_C(    91.49), SIMDE_FLOAT32_C(    38.04), SIMDE_FLOAT32_C(    26.70), SIMDE_FLOAT32_C(    53.98),
+      SIMDE_FLOAT32_C(   -32.01), SIMDE_FLOAT32_C(    50.84), SIMDE_FLOAT32_C(   -40.97), SIMDE_FLOAT32_C(    60.89),
+      SIMDE_FLOAT32_C(   -83.12), SIMDE_FLOAT32_C(    34.71), SIMDE_FLOAT32_C(     9.93), SIMDE_FLOAT32_C(    96.50),
+      SIMDE_FLOAT32_C(   -86.17), SIMDE_FLOAT32_C(   -54.48), SIMDE_FLOAT32_C(   -69.29), SIMDE_FLOAT32_C(   -36.38),
+      SIMDE_FLOAT32_C(    56.15), SIMDE_FLOAT32_C(    52.97), SIMDE_FLOAT32_C(   -23.04), SIMDE_FLOAT32_C(   -94.28),
+      SIMDE_FLOAT32_C(    35.89), SIMDE_FLOAT32_C(   -19.77), SIMDE_FLOAT32_C(    75.15), SIMDE_FLOAT32_C(   -94.12),
+      SIMDE_FLOAT32_C(    72.54), SIMDE_FLOAT32_C(    63.06), SIMDE_FLOAT32_C(    80.75), SIMDE_FLOAT32_C(   -50.25),
+      SIMDE_FLOAT32_C(   -68.15), SIMDE_FLOAT32_C(   -82.47), SIMDE_FLOAT32_C(   -80.23), SIMDE_FLOAT32_C(   -76.67),
+      SIMDE_FLOAT32_C(    55.57), SIMDE_FLOAT32_C(    46.47), SIMDE_FLOAT32_C(    77.31), SIMDE_FLOAT32_C(   -76.44),
+      SIMDE_FLOAT32_C(    -2.69), SIMDE_FLOAT32_C(   -63.66), SIMDE_FLOAT32_C(    84.45), SIMDE_FLOAT32_C(    14.19),
+      SIMDE_FLOAT32_C(    71.05), SIMDE_FLOAT32_C(    -5.62), SIMDE_FLOAT32_C(    10.69), SIMDE_FLOAT32_C(    84.88),
+      SIMDE_FLOAT32_C(    39.90), SIMDE_FLOAT32_C(    41.39), SIMDE_FLOAT32_C(   -51.50), SIMDE_FLOAT32_C(    -3.95),
+      SIMDE_FLOAT32_C(    -5.64), SIMDE_FLOAT32_C(    25.46), SIMDE_FLOAT32_C(     1.76), SIMDE_FLOAT32_C(   -69.75),
+      SIMDE_FLOAT32_C(   -94.31), SIMDE_FLOAT32_C(   -23.09), SIMDE_FLOAT32_C(   -63.87), SIMDE_FLOAT32_C(    78.23),
+      SIMDE_FLOAT32_C(   -60.04), SIMDE_FLOAT32_C(   -83.12), SIMDE_FLOAT32_C(   -72.02), SIMDE_FLOAT32_C(   -28.19),
+      SIMDE_FLOAT32_C(   -65.59), SIMDE_FLOAT32_C(   -52.25), SIMDE_FLOAT32_C(    -4.86), SIMDE_FLOAT32_C(    89.98),
+      SIMDE_FLOAT32_C(    94.21), SIMDE_FLOAT32_C(   -27.55), SIMDE_FLOAT32_C(   -86.46), SIMDE_FLOAT32_C(    -8.48),
+      SIMDE_FLOAT32_C(     8.80), SIMDE_FLOAT32_C(    97.99), SIMDE_FLOAT32_C(   -94.29), SIMDE_FLOAT32_C(   -20.15),
+      SIMDE_FLOAT32_C(    -7.63), SIMDE_FLOAT32_C(    16.39), SIMDE_FLOAT32_C(   -35.27), SIMDE_FLOAT32_C(   -67.73),
+      SIMDE_FLOAT32_C(   -42.21), SIMDE_FLOAT32_C(    13.24), SIMDE_FLOAT32_C(    28.32), SIMDE_FLOAT32_C(    52.15),
+      SIMDE_FLOAT32_C(   -61.30), SIMDE_FLOAT32_C(   -69.92), SIMDE_FLOAT32_C(    82.39), SIMDE_FLOAT32_C(   -55.61),
+      SIMDE_FLOAT32_C(     6.99), SIMDE_FLOAT32_C(   -81.48), SIMDE_FLOAT32_C(   -77.38), SIMDE_FLOAT32_C(    46.95),
+      SIMDE_FLOAT32_C(   -64.59), SIMDE_FLOAT32_C(   -49.40), SIMDE_FLOAT32_C(   -81.24), SIMDE_FLOAT32_C(   -30.18),
+      SIMDE_FLOAT32_C(    -1.65), SIMDE_FLOAT32_C(    13.90), SIMDE_FLOAT32_C(   -40.20), SIMDE_FLOAT32_C(    -7.44),
+      SIMDE_FLOAT32_C(    86.36), SIMDE_FLOAT32_C(   -26.65), SIMDE_FLOAT32_C(    84.08), SIMDE_FLOAT32_C(    -4.85),
+      SIMDE_FLOAT32_C(   -28.66), SIMDE_FLOAT32_C(    89.79), SIMDE_FLOAT32_C(    75.00), SIMDE_FLOAT32_C(    63.72),
+      SIMDE_FLOAT32_C(     6.18), SIMDE_FLOAT32_C(   -60.26), SIMDE_FLOAT32_C(    95.99), SIMDE_FLOAT32_C(    63.97),
+      SIMDE_FLOAT32_C(    52.98), SIMDE_FLOAT32_C(    24.31), SIMDE_FLOAT32_C(    16.11), SIMDE_FLOAT32_C(    91.68),
+      SIMDE_FLOAT32_C(    54.39), SIMDE_FLOAT32_C(    -1.49), SIMDE_FLOAT32_C(   -63.93), SIMDE_FLOAT32_C(   -38.63),
+      SIMDE_FLOAT32_C(    17.03), SIMDE_FLOAT32_C(   -41.31), SIMDE_FLOAT32_C(   -91.68), SIMDE_FLOAT32_C(    52.44),
+      SIMDE_FLOAT32_C(     9.30), SIMDE_FLOAT32_C(   -72.91), SIMDE_FLOAT32_C(   -77.74), SIMDE_FLOAT32_C(   -92.36),
+      SIMDE_FLOAT32_C(    40.99), SIMDE_FLOAT32_C(   -17.94), SIMDE_FLOAT32_C(     0.20), SIMDE_FLOAT32_C(    27.35),
+      SIMDE_FLOAT32_C(    55.41), SIMDE_FLOAT32_C(   -15.71), SIMDE_FLOAT32_C(   -77.50), SIMDE_FLOAT32_C(   -73.25),
+      SIMDE_FLOAT32_C(   -25.93), SIMDE_FLOAT32_C(    97.50), SIMDE_FLOAT32_C(    90.46), SIMDE_FLOAT32_C(    80.25),
+      SIMDE_FLOAT32_C(   -62.76), SIMDE_FLOAT32_C(    86.45), SIMDE_FLOAT32_C(    44.22), SIMDE_FLOAT32_C(    90.22),
+      SIMDE_FLOAT32_C(    10.76), SIMDE_FLOAT32_C(   -39.67), SIMDE_FLOAT32_C(    81.89), SIMDE_FLOAT32_C(   -34.86),
+      SIMDE_FLOAT32_C(    58.84), SIMDE_FLOAT32_C(   -82.04), SIMDE_FLOAT32_C(    26.52), SIMDE_FLOAT32_C(   -24.13),
+      SIMDE_FLOAT32_C(   -23.34), SIMDE_FLOAT32_C(    34.84), SIMDE_FLOAT32_C(   -71.69), SIMDE_FLOAT32_C(    85.95),
+      SIMDE_FLOAT32_C(    61.93), SIMDE_FLOAT32_C(   -49.43), SIMDE_FLOAT32_C(    93.60), SIMDE_FLOAT32_C(     2.92),
+      SIMDE_FLOAT32_C(    32.63), SIMDE_FLOAT32_C(    -6.20), SIMDE_FLOAT32_C(   -69.74), SIMDE_FLOAT32_C(   -11.96),
+      SIMDE_FLOAT32_C(    78.09), SIMDE_FLOAT32_C(   -47.24), SIMDE_FLOAT32_C(    14.79), SIMDE_FLOAT32_C(   -47.84),
+      SIMDE_FLOAT32_C(   -49.73), SIMDE_FLOAT32_C(     5.25), SIMDE_FLOAT32_C(   -67.58), SIMDE_FLOAT32_C(   -12.49),
+      SIMDE_FLOAT32_C(    -8.30), SIMDE_FLOAT32_C(    76.64), SIMDE_FLOAT32_C(   -22.28), SIMDE_FLOAT32_C(   -97.54),
+      SIMDE_FLOAT32_C(   -63.03) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   224.48), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5066.51),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  7718.88), SIMDE_FLOAT32_C(  1491.73),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   913.06), SIMDE_FLOAT32_C(  -861.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   162.54), SIMDE_FLOAT32_C( -1160.34),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1222.65), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6498.33), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1771.70),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   766.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -1168.74), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -204.21),
+      SIMDE_FLOAT32_C(  1216.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -3447.15),
+      SIMDE_FLOAT32_C(  3078.08), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1371.25),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   639.16), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5156.79),
+      SIMDE_FLOAT32_C(   328.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -6449.40),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    25.49),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   843.07), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -7680.45), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -1098.40), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5899.15), SIMDE_FLOAT32_C(  -970.43), SIMDE_FLOAT32_C( -1070.94),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -27.81),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -348.61), SIMDE_FLOAT32_C(  2701.43),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  4329.14), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  2563.47), SIMDE_FLOAT32_C(   971.66), SIMDE_FLOAT32_C(  -236.83), SIMDE_FLOAT32_C( -7232.43),
+      SIMDE_FLOAT32_C( -7079.79), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1500.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   362.74), SIMDE_FLOAT32_C( -3902.49), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  7895.60), SIMDE_FLOAT32_C( -1974.71), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   293.84), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  2705.05),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  2974.51), SIMDE_FLOAT32_C(   282.57), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  7081.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    72.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1246.68), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5724.51),
+      SIMDE_FLOAT32_C( -5849.89), SIMDE_FLOAT32_C( -1448.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -6068.67),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -1509.22), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -2192.29), SIMDE_FLOAT32_C(  1258.04), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   448.28),
+      SIMDE_FLOAT32_C(  -151.52), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  2741.60),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   838.15), SIMDE_FLOAT32_C( -1220.08), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3254.98), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -147.28), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  4714.54), SIMDE_FLOAT32_C(  1585.84), SIMDE_FLOAT32_C(  -430.61), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   522.79), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -276.03),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -1219.60), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  3734.04), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   695.13), SIMDE_FLOAT32_C(  7170.51), SIMDE_FLOAT32_C(  9054.01),
+      SIMDE_FLOAT32_C( -5273.18), SIMDE_FLOAT32_C( -2476.31), SIMDE_FLOAT32_C(   458.51), SIMDE_FLOAT32_C( -5955.86),
+      SIMDE_FLOAT32_C(  5072.30) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i])),
+      cv = simde_svld1_f32(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmad_f32_z(pv, av, bv, cv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], c[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), c, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+    cv = simde_svld1_f32(pg, &(c[i]));
+
+    ev = simde_svmad_f32_z(pv, av, bv, cv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   -51.44), SIMDE_FLOAT32_C(   -52.44), SIMDE_FLOAT32_C(   -42.06), SIMDE_FLOAT32_C(   -60.08),
+      SIMDE_FLOAT32_C(   -14.92), SIMDE_FLOAT32_C(    79.96), SIMDE_FLOAT32_C(   -77.30), SIMDE_FLOAT32_C(   -80.26),
+      SIMDE_FLOAT32_C(   -43.15), SIMDE_FLOAT32_C(    97.27), SIMDE_FLOAT32_C(    -1.76), SIMDE_FLOAT32_C(    34.43),
+      SIMDE_FLOAT32_C(    48.25), SIMDE_FLOAT32_C(   -72.25), SIMDE_FLOAT32_C(   -27.19), SIMDE_FLOAT32_C(    66.52),
+      SIMDE_FLOAT32_C(    64.37), SIMDE_FLOAT32_C(   -54.88), SIMDE_FLOAT32_C(    79.42), SIMDE_FLOAT32_C(    -6.98),
+      SIMDE_FLOAT32_C(   -66.25), SIMDE_FLOAT32_C(    55.79), SIMDE_FLOAT32_C(   -77.95), SIMDE_FLOAT32_C(   -43.49),
+      SIMDE_FLOAT32_C(    37.42), SIMDE_FLOAT32_C(   -89.46), SIMDE_FLOAT32_C(   -93.84), SIMDE_FLOAT32_C(    79.89),
+      SIMDE_FLOAT32_C(   -74.28), SIMDE_FLOAT32_C(   -45.59), SIMDE_FLOAT32_C(   -50.84), SIMDE_FLOAT32_C(   -25.72),
+      SIMDE_FLOAT32_C(     1.97), SIMDE_FLOAT32_C(     7.10), SIMDE_FLOAT32_C(    14.20), SIMDE_FLOAT32_C(    87.05),
+      SIMDE_FLOAT32_C(   -12.94), SIMDE_FLOAT32_C(    36.90), SIMDE_FLOAT32_C(   -93.21), SIMDE_FLOAT32_C(    43.91),
+      SIMDE_FLOAT32_C(    34.17), SIMDE_FLOAT32_C(     5.02), SIMDE_FLOAT32_C(   -21.66), SIMDE_FLOAT32_C(   -17.58),
+      SIMDE_FLOAT32_C(    32.77), SIMDE_FLOAT32_C(    51.14), SIMDE_FLOAT32_C(   -51.06), SIMDE_FLOAT32_C(    -2.85),
+      SIMDE_FLOAT32_C(    96.27), SIMDE_FLOAT32_C(   -71.64), SIMDE_FLOAT32_C(    90.16), SIMDE_FLOAT32_C(   -69.98),
+      SIMDE_FLOAT32_C(    84.14), SIMDE_FLOAT32_C(   -87.79), SIMDE_FLOAT32_C(   -13.48), SIMDE_FLOAT32_C(    21.56),
+      SIMDE_FLOAT32_C(   -77.25), SIMDE_FLOAT32_C(    -7.32), SIMDE_FLOAT32_C(     1.45), SIMDE_FLOAT32_C(   -51.53),
+      SIMDE_FLOAT32_C(    47.09), SIMDE_FLOAT32_C(    50.61), SIMDE_FLOAT32_C(    22.75), SIMDE_FLOAT32_C(   -50.94),
+      SIMDE_FLOAT32_C(   -42.29), SIMDE_FLOAT32_C(   -63.05), SIMDE_FLOAT32_C(   -63.89), SIMDE_FLOAT32_C(    44.77),
+      SIMDE_FLOAT32_C(    73.85), SIMDE_FLOAT32_C(   -57.10), SIMDE_FLOAT32_C(   -11.32), SIMDE_FLOAT32_C(     8.02),
+      SIMDE_FLOAT32_C(    47.92), SIMDE_FLOAT32_C(    67.02), SIMDE_FLOAT32_C(    90.44), SIMDE_FLOAT32_C(   -19.30),
+      SIMDE_FLOAT32_C(    18.16), SIMDE_FLOAT32_C(   -60.63), SIMDE_FLOAT32_C(    77.84), SIMDE_FLOAT32_C(    14.43),
+      SIMDE_FLOAT32_C(   -32.27), SIMDE_FLOAT32_C(    68.00), SIMDE_FLOAT32_C(    44.45), SIMDE_FLOAT32_C(   -48.13),
+      SIMDE_FLOAT32_C(    80.22), SIMDE_FLOAT32_C(   -69.03), SIMDE_FLOAT32_C(    73.43), SIMDE_FLOAT32_C(   -97.03),
+      SIMDE_FLOAT32_C(    23.66), SIMDE_FLOAT32_C(   -25.12), SIMDE_FLOAT32_C(   -48.56), SIMDE_FLOAT32_C(   -29.25),
+      SIMDE_FLOAT32_C(   -74.52), SIMDE_FLOAT32_C(    74.19), SIMDE_FLOAT32_C(    19.81), SIMDE_FLOAT32_C(   -16.80),
+      SIMDE_FLOAT32_C(   -88.87), SIMDE_FLOAT32_C(    55.92), SIMDE_FLOAT32_C(   -72.03), SIMDE_FLOAT32_C(    84.98),
+      SIMDE_FLOAT32_C(    98.82), SIMDE_FLOAT32_C(    16.65), SIMDE_FLOAT32_C(    -7.00), SIMDE_FLOAT32_C(    46.75),
+      SIMDE_FLOAT32_C(   -16.33), SIMDE_FLOAT32_C(   -16.56), SIMDE_FLOAT32_C(   -72.56), SIMDE_FLOAT32_C(   -98.16),
+      SIMDE_FLOAT32_C(    22.81), SIMDE_FLOAT32_C(   -94.72), SIMDE_FLOAT32_C(    16.27), SIMDE_FLOAT32_C(    90.54),
+      SIMDE_FLOAT32_C(    73.29), SIMDE_FLOAT32_C(   -39.28), SIMDE_FLOAT32_C(   -57.59), SIMDE_FLOAT32_C(    53.50),
+      SIMDE_FLOAT32_C(    -8.31), SIMDE_FLOAT32_C(   -84.17), SIMDE_FLOAT32_C(    56.47), SIMDE_FLOAT32_C(   -84.65),
+      SIMDE_FLOAT32_C(    -9.29), SIMDE_FLOAT32_C(   -92.09), SIMDE_FLOAT32_C(   -13.90), SIMDE_FLOAT32_C(    16.19),
+      SIMDE_FLOAT32_C(    82.10), SIMDE_FLOAT32_C(   -94.10), SIMDE_FLOAT32_C(    99.39), SIMDE_FLOAT32_C(    93.23),
+      SIMDE_FLOAT32_C(    61.82), SIMDE_FLOAT32_C(   -72.64), SIMDE_FLOAT32_C(    78.22), SIMDE_FLOAT32_C(    60.65),
+      SIMDE_FLOAT32_C(    44.02), SIMDE_FLOAT32_C(   -28.78), SIMDE_FLOAT32_C(     7.39), SIMDE_FLOAT32_C(   -72.31),
+      SIMDE_FLOAT32_C(    54.65), SIMDE_FLOAT32_C(    34.84), SIMDE_FLOAT32_C(   -70.48), SIMDE_FLOAT32_C(   -22.54),
+      SIMDE_FLOAT32_C(    40.12), SIMDE_FLOAT32_C(    45.79), SIMDE_FLOAT32_C(   -32.00), SIMDE_FLOAT32_C(    13.41),
+      SIMDE_FLOAT32_C(   -93.49), SIMDE_FLOAT32_C(    10.41), SIMDE_FLOAT32_C(   -33.09), SIMDE_FLOAT32_C(    -1.79),
+      SIMDE_FLOAT32_C(    26.24), SIMDE_FLOAT32_C(   -76.62), SIMDE_FLOAT32_C(    13.56), SIMDE_FLOAT32_C(   -83.05),
+      SIMDE_FLOAT32_C(   -68.70), SIMDE_FLOAT32_C(    99.65), SIMDE_FLOAT32_C(    33.15), SIMDE_FLOAT32_C(   -86.60),
+      SIMDE_FLOAT32_C(   -94.44), SIMDE_FLOAT32_C(    32.54), SIMDE_FLOAT32_C(   -93.37), SIMDE_FLOAT32_C(    67.38),
+      SIMDE_FLOAT32_C(    59.91), SIMDE_FLOAT32_C(    84.85), SIMDE_FLOAT32_C(    28.03), SIMDE_FLOAT32_C(     3.92),
+      SIMDE_FLOAT32_C(   -43.94), SIMDE_FLOAT32_C(   -64.58), SIMDE_FLOAT32_C(    31.61), SIMDE_FLOAT32_C(   -89.28),
+      SIMDE_FLOAT32_C(    70.26), SIMDE_FLOAT32_C(    61.13), SIMDE_FLOAT32_C(   -11.82), SIMDE_FLOAT32_C(    10.38),
+      SIMDE_FLOAT32_C(     6.93), SIMDE_FLOAT32_C(    56.18), SIMDE_FLOAT32_C(   -76.22), SIMDE_FLOAT32_C(    13.44),
+      SIMDE_FLOAT32_C(   -33.41), SIMDE_FLOAT32_C(    -9.30), SIMDE_FLOAT32_C(   -88.35), SIMDE_FLOAT32_C(    92.83),
+      SIMDE_FLOAT32_C(    14.08), SIMDE_FLOAT32_C(    25.21), SIMDE_FLOAT32_C(   -90.21), SIMDE_FLOAT32_C(    45.38),
+      SIMDE_FLOAT32_C(    24.86), SIMDE_FLOAT32_C(    42.94), SIMDE_FLOAT32_C(    58.77), SIMDE_FLOAT32_C(    30.41),
+      SIMDE_FLOAT32_C(   -24.52), SIMDE_FLOAT32_C(    65.40), SIMDE_FLOAT32_C(    -2.20), SIMDE_FLOAT32_C(   -64.62),
+      SIMDE_FLOAT32_C(    50.25), SIMDE_FLOAT32_C(   -74.18), SIMDE_FLOAT32_C(    39.30), SIMDE_FLOAT32_C(   -93.69),
+      SIMDE_FLOAT32_C(   -38.76), SIMDE_FLOAT32_C(   -29.09), SIMDE_FLOAT32_C(   -82.97), SIMDE_FLOAT32_C(   -68.50),
+      SIMDE_FLOAT32_C(   -67.95), SIMDE_FLOAT32_C(     5.21), SIMDE_FLOAT32_C(    41.87), SIMDE_FLOAT32_C(    38.98),
+      SIMDE_FLOAT32_C(   -38.61), SIMDE_FLOAT32_C(    65.66), SIMDE_FLOAT32_C(   -47.58), SIMDE_FLOAT32_C(    27.98),
+      SIMDE_FLOAT32_C(   -43.65), SIMDE_FLOAT32_C(   -35.93), SIMDE_FLOAT32_C(    20.81), SIMDE_FLOAT32_C(    70.43),
+      SIMDE_FLOAT32_C(    89.27), SIMDE_FLOAT32_C(    30.60), SIMDE_FLOAT32_C(    15.81), SIMDE_FLOAT32_C(    14.13),
+      SIMDE_FLOAT32_C(   -26.46), SIMDE_FLOAT32_C(   -25.42), SIMDE_FLOAT32_C(   -55.45), SIMDE_FLOAT32_C(    49.01),
+      SIMDE_FLOAT32_C(   -60.02), SIMDE_FLOAT32_C(    42.34), SIMDE_FLOAT32_C(    84.40), SIMDE_FLOAT32_C(    90.23),
+      SIMDE_FLOAT32_C(    68.16), SIMDE_FLOAT32_C(    23.70), SIMDE_FLOAT32_C(    96.54), SIMDE_FLOAT32_C(   -70.59),
+      SIMDE_FLOAT32_C(    94.61), SIMDE_FLOAT32_C(   -86.43), SIMDE_FLOAT32_C(   -39.09), SIMDE_FLOAT32_C(   -73.34) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(    18.77), SIMDE_FLOAT32_C(   -97.22), SIMDE_FLOAT32_C(    65.64), SIMDE_FLOAT32_C(    80.16),
+      SIMDE_FLOAT32_C(    68.44), SIMDE_FLOAT32_C(   -81.94), SIMDE_FLOAT32_C(     8.14), SIMDE_FLOAT32_C(   -75.21),
+      SIMDE_FLOAT32_C(   -17.87), SIMDE_FLOAT32_C(   -71.05), SIMDE_FLOAT32_C(    95.23), SIMDE_FLOAT32_C(   -28.60),
+      SIMDE_FLOAT32_C(    59.54), SIMDE_FLOAT32_C(    11.04), SIMDE_FLOAT32_C(    85.53), SIMDE_FLOAT32_C(   -66.92),
+      SIMDE_FLOAT32_C(    85.62), SIMDE_FLOAT32_C(   -69.92), SIMDE_FLOAT32_C(    82.09), SIMDE_FLOAT32_C(   -74.40),
+      SIMDE_FLOAT32_C(    72.42), SIMDE_FLOAT32_C(    66.49), SIMDE_FLOAT32_C(   -84.17), SIMDE_FLOAT32_C(    40.59),
+      SIMDE_FLOAT32_C(    -9.81), SIMDE_FLOAT32_C(   -87.63), SIMDE_FLOAT32_C(    69.99), SIMDE_FLOAT32_C(   -15.19),
+      SIMDE_FLOAT32_C(   -74.06), SIMDE_FLOAT32_C(   -69.10), SIMDE_FLOAT32_C(    11.47), SIMDE_FLOAT32_C(    44.71),
+      SIMDE_FLOAT32_C(   -66.32), SIMDE_FLOAT32_C(   -22.89), SIMDE_FLOAT32_C(    24.87), SIMDE_FLOAT32_C(   -97.89),
+      SIMDE_FLOAT32_C(    -4.83), SIMDE_FLOAT32_C(   -66.99), SIMDE_FLOAT32_C(   -73.09), SIMDE_FLOAT32_C(    77.29),
+      SIMDE_FLOAT32_C(   -38.05), SIMDE_FLOAT32_C(   -77.87), SIMDE_FLOAT32_C(   -51.31), SIMDE_FLOAT32_C(   -78.50),
+      SIMDE_FLOAT32_C(    33.17), SIMDE_FLOAT32_C(   -65.77), SIMDE_FLOAT32_C(   -45.42), SIMDE_FLOAT32_C(    18.79),
+      SIMDE_FLOAT32_C(   -35.70), SIMDE_FLOAT32_C(   -63.33), SIMDE_FLOAT32_C(    44.39), SIMDE_FLOAT32_C(   -63.27),
+      SIMDE_FLOAT32_C(   -96.84), SIMDE_FLOAT32_C(    60.23), SIMDE_FLOAT32_C(    77.31), SIMDE_FLOAT32_C(    -6.65),
+      SIMDE_FLOAT32_C(    72.60), SIMDE_FLOAT32_C(    47.30), SIMDE_FLOAT32_C(    78.16), SIMDE_FLOAT32_C(    98.54),
+      SIMDE_FLOAT32_C(    78.20), SIMDE_FLOAT32_C(   -10.37), SIMDE_FLOAT32_C(    43.25), SIMDE_FLOAT32_C(   -88.12),
+      SIMDE_FLOAT32_C(    66.74), SIMDE_FLOAT32_C(   -31.88), SIMDE_FLOAT32_C(   -86.01), SIMDE_FLOAT32_C(   -38.10),
+      SIMDE_FLOAT32_C(     1.13), SIMDE_FLOAT32_C(   -59.10), SIMDE_FLOAT32_C(   -60.80), SIMDE_FLOAT32_C(    63.08),
+      SIMDE_FLOAT32_C(   -36.97), SIMDE_FLOAT32_C(   -12.11), SIMDE_FLOAT32_C(    84.58), SIMDE_FLOAT32_C(    96.20),
+      SIMDE_FLOAT32_C(    22.12), SIMDE_FLOAT32_C(   -60.84), SIMDE_FLOAT32_C(    14.99), SIMDE_FLOAT32_C(    86.42),
+      SIMDE_FLOAT32_C(   -24.17), SIMDE_FLOAT32_C(   -40.62), SIMDE_FLOAT32_C(   -76.86), SIMDE_FLOAT32_C(   -21.01),
+      SIMDE_FLOAT32_C(   -80.39), SIMDE_FLOAT32_C(   -99.54), SIMDE_FLOAT32_C(    72.34), SIMDE_FLOAT32_C(    92.21),
+      SIMDE_FLOAT32_C(    47.76), SIMDE_FLOAT32_C(    50.50), SIMDE_FLOAT32_C(    90.75), SIMDE_FLOAT32_C(    25.96),
+      SIMDE_FLOAT32_C(   -59.88), SIMDE_FLOAT32_C(    34.00), SIMDE_FLOAT32_C(    37.84), SIMDE_FLOAT32_C(   -93.14),
+      SIMDE_FLOAT32_C(   -97.88), SIMDE_FLOAT32_C(    51.84), SIMDE_FLOAT32_C(   -31.24), SIMDE_FLOAT32_C(     3.25),
+      SIMDE_FLOAT32_C(    92.74), SIMDE_FLOAT32_C(     7.96), SIMDE_FLOAT32_C(   -33.66), SIMDE_FLOAT32_C(   -44.23),
+      SIMDE_FLOAT32_C(    95.85), SIMDE_FLOAT32_C(   -49.08), SIMDE_FLOAT32_C(   -48.03), SIMDE_FLOAT32_C(    17.96),
+      SIMDE_FLOAT32_C(    -9.93), SIMDE_FLOAT32_C(    66.96), SIMDE_FLOAT32_C(     4.38), SIMDE_FLOAT32_C(    65.90),
+      SIMDE_FLOAT32_C(   -73.66), SIMDE_FLOAT32_C(    27.53), SIMDE_FLOAT32_C(   -55.11), SIMDE_FLOAT32_C(   -54.05),
+      SIMDE_FLOAT32_C(    27.98), SIMDE_FLOAT32_C(   -82.77), SIMDE_FLOAT32_C(   -61.84), SIMDE_FLOAT32_C(   -24.26),
+      SIMDE_FLOAT32_C(    67.72), SIMDE_FLOAT32_C(   -71.10), SIMDE_FLOAT32_C(   -98.29), SIMDE_FLOAT32_C(   -92.15),
+      SIMDE_FLOAT32_C(    62.90), SIMDE_FLOAT32_C(    39.55), SIMDE_FLOAT32_C(   -85.29), SIMDE_FLOAT32_C(    65.03),
+      SIMDE_FLOAT32_C(    -8.61), SIMDE_FLOAT32_C(   -16.53), SIMDE_FLOAT32_C(   -31.72), SIMDE_FLOAT32_C(   -15.87),
+      SIMDE_FLOAT32_C(    91.43), SIMDE_FLOAT32_C(    34.62), SIMDE_FLOAT32_C(    39.90), SIMDE_FLOAT32_C(    87.27),
+      SIMDE_FLOAT32_C(    85.54), SIMDE_FLOAT32_C(    91.88), SIMDE_FLOAT32_C(     5.24), SIMDE_FLOAT32_C(   -24.39),
+      SIMDE_FLOAT32_C(    58.84), SIMDE_FLOAT32_C(   -90.38), SIMDE_FLOAT32_C(   -58.49), SIMDE_FLOAT32_C(    85.18),
+      SIMDE_FLOAT32_C(    37.15), SIMDE_FLOAT32_C(   -13.60), SIMDE_FLOAT32_C(   -68.87), SIMDE_FLOAT32_C(   -34.87),
+      SIMDE_FLOAT32_C(     3.62), SIMDE_FLOAT32_C(   -30.71), SIMDE_FLOAT32_C(    40.88), SIMDE_FLOAT32_C(   -28.65),
+      SIMDE_FLOAT32_C(    -1.81), SIMDE_FLOAT32_C(    42.59), SIMDE_FLOAT32_C(   -20.81), SIMDE_FLOAT32_C(   -38.90),
+      SIMDE_FLOAT32_C(   -17.86), SIMDE_FLOAT32_C(    -6.10), SIMDE_FLOAT32_C(   -73.88), SIMDE_FLOAT32_C(    73.53),
+      SIMDE_FLOAT32_C(    77.36), SIMDE_FLOAT32_C(    -5.59), SIMDE_FLOAT32_C(   -42.34), SIMDE_FLOAT32_C(    68.79),
+      SIMDE_FLOAT32_C(   -70.97), SIMDE_FLOAT32_C(    97.57), SIMDE_FLOAT32_C(    56.07), SIMDE_FLOAT32_C(   -85.43),
+      SIMDE_FLOAT32_C(    89.44), SIMDE_FLOAT32_C(   -38.70), SIMDE_FLOAT32_C(    -9.82), SIMDE_FLOAT32_C(    48.28),
+      SIMDE_FLOAT32_C(   -29.07), SIMDE_FLOAT32_C(    31.69), SIMDE_FLOAT32_C(    33.46), SIMDE_FLOAT32_C(   -91.93),
+      SIMDE_FLOAT32_C(   -81.91), SIMDE_FLOAT32_C(    64.59), SIMDE_FLOAT32_C(   -26.79), SIMDE_FLOAT32_C(    21.71),
+      SIMDE_FLOAT32_C(   -66.12), SIMDE_FLOAT32_C(   -85.92), SIMDE_FLOAT32_C(    93.06), SIMDE_FLOAT32_C(    32.07),
+      SIMDE_FLOAT32_C(    56.67), SIMDE_FLOAT32_C(   -27.75), SIMDE_FLOAT32_C(    93.16), SIMDE_FLOAT32_C(   -61.19),
+      SIMDE_FLOAT32_C(    66.15), SIMDE_FLOAT32_C(   -80.71), SIMDE_FLOAT32_C(   -87.66), SIMDE_FLOAT32_C(    43.51),
+      SIMDE_FLOAT32_C(    13.69), SIMDE_FLOAT32_C(   -30.00), SIMDE_FLOAT32_C(    12.30), SIMDE_FLOAT32_C(    42.72),
+      SIMDE_FLOAT32_C(   -32.43), SIMDE_FLOAT32_C(   -31.63), SIMDE_FLOAT32_C(    57.29), SIMDE_FLOAT32_C(   -42.99),
+      SIMDE_FLOAT32_C(    29.67), SIMDE_FLOAT32_C(   -52.54), SIMDE_FLOAT32_C(   -94.71), SIMDE_FLOAT32_C(   -99.40),
+      SIMDE_FLOAT32_C(    79.15), SIMDE_FLOAT32_C(    38.75), SIMDE_FLOAT32_C(   -91.33), SIMDE_FLOAT32_C(    97.24),
+      SIMDE_FLOAT32_C(     3.34), SIMDE_FLOAT32_C(   -18.12), SIMDE_FLOAT32_C(    18.95), SIMDE_FLOAT32_C(    37.22),
+      SIMDE_FLOAT32_C(    -4.04), SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(   -30.71), SIMDE_FLOAT32_C(   -47.37),
+      SIMDE_FLOAT32_C(    84.25), SIMDE_FLOAT32_C(   -37.55), SIMDE_FLOAT32_C(    -8.56), SIMDE_FLOAT32_C(    50.39),
+      SIMDE_FLOAT32_C(   -18.26), SIMDE_FLOAT32_C(     3.78), SIMDE_FLOAT32_C(    -6.10), SIMDE_FLOAT32_C(    95.43),
+      SIMDE_FLOAT32_C(    73.78), SIMDE_FLOAT32_C(   -93.79), SIMDE_FLOAT32_C(    38.15), SIMDE_FLOAT32_C(   -58.66),
+      SIMDE_FLOAT32_C(   -25.43), SIMDE_FLOAT32_C(    -4.56), SIMDE_FLOAT32_C(    -1.64), SIMDE_FLOAT32_C(   -95.75) };
+  static const simde_float32 c[] =
+    { SIMDE_FLOAT32_C(    42.90), SIMDE_FLOAT32_C(     3.65), SIMDE_FLOAT32_C(   -95.16), SIMDE_FLOAT32_C(    22.05),
+      SIMDE_FLOAT32_C(   -57.60), SIMDE_FLOAT32_C(   -86.48), SIMDE_FLOAT32_C(    19.29), SIMDE_FLOAT32_C(    45.74),
+      SIMDE_FLOAT32_C(    -4.61), SIMDE_FLOAT32_C(   -61.76), SIMDE_FLOAT32_C(   -17.04), SIMDE_FLOAT32_C(    91.36),
+      SIMDE_FLOAT32_C(    50.24), SIMDE_FLOAT32_C(    52.25), SIMDE_FLOAT32_C(   -56.01), SIMDE_FLOAT32_C(    34.49),
+      SIMDE_FLOAT32_C(   -85.30), SIMDE_FLOAT32_C(    35.43), SIMDE_FLOAT32_C(   -15.12), SIMDE_FLOAT32_C(    -3.56),
+      SIMDE_FLOAT32_C(   -60.80), SIMDE_FLOAT32_C(    78.79), SIMDE_FLOAT32_C(    -8.13), SIMDE_FLOAT32_C(   -87.02),
+      SIMDE_FLOAT32_C(    84.99), SIMDE_FLOAT32_C(   -69.98), SIMDE_FLOAT32_C(   -45.68), SIMDE_FLOAT32_C(   -40.43),
+      SIMDE_FLOAT32_C(    25.46), SIMDE_FLOAT32_C(    52.68), SIMDE_FLOAT32_C(   -36.19), SIMDE_FLOAT32_C(   -31.64),
+      SIMDE_FLOAT32_C(   -43.67), SIMDE_FLOAT32_C(   -31.34), SIMDE_FLOAT32_C(    90.41), SIMDE_FLOAT32_C(    -1.27),
+      SIMDE_FLOAT32_C(   -17.83), SIMDE_FLOAT32_C(     9.70), SIMDE_FLOAT32_C(   -55.53), SIMDE_FLOAT32_C(    77.57),
+      SIMDE_FLOAT32_C(    47.94), SIMDE_FLOAT32_C(    27.44), SIMDE_FLOAT32_C(    68.92), SIMDE_FLOAT32_C(    -1.83),
+      SIMDE_FLOAT32_C(   -20.31), SIMDE_FLOAT32_C(   -87.09), SIMDE_FLOAT32_C(   -67.34), SIMDE_FLOAT32_C(    -5.61),
+      SIMDE_FLOAT32_C(    48.34), SIMDE_FLOAT32_C(    17.54), SIMDE_FLOAT32_C(    90.82), SIMDE_FLOAT32_C(    87.54),
+      SIMDE_FLOAT32_C(    -3.68), SIMDE_FLOAT32_C(   -17.31), SIMDE_FLOAT32_C(   -99.48), SIMDE_FLOAT32_C(   -18.68),
+      SIMDE_FLOAT32_C(    12.70), SIMDE_FLOAT32_C(   -45.16), SIMDE_FLOAT32_C(    40.88), SIMDE_FLOAT32_C(   -61.84),
+      SIMDE_FLOAT32_C(   -92.48), SIMDE_FLOAT32_C(   -95.31), SIMDE_FLOAT32_C(     6.52), SIMDE_FLOAT32_C(   -36.15),
+      SIMDE_FLOAT32_C(   -26.65), SIMDE_FLOAT32_C(    -3.07), SIMDE_FLOAT32_C(    62.58), SIMDE_FLOAT32_C(    55.52),
+      SIMDE_FLOAT32_C(   -93.37), SIMDE_FLOAT32_C(   -92.95), SIMDE_FLOAT32_C(    33.09), SIMDE_FLOAT32_C(    54.57),
+      SIMDE_FLOAT32_C(    34.49), SIMDE_FLOAT32_C(     2.02), SIMDE_FLOAT32_C(   -47.26), SIMDE_FLOAT32_C(   -85.83),
+      SIMDE_FLOAT32_C(    14.93), SIMDE_FLOAT32_C(   -14.60), SIMDE_FLOAT32_C(     8.56), SIMDE_FLOAT32_C(   -36.73),
+      SIMDE_FLOAT32_C(   -97.06), SIMDE_FLOAT32_C(    -0.62), SIMDE_FLOAT32_C(   -49.19), SIMDE_FLOAT32_C(    -0.73),
+      SIMDE_FLOAT32_C(    82.06), SIMDE_FLOAT32_C(   -48.67), SIMDE_FLOAT32_C(    80.58), SIMDE_FLOAT32_C(    -5.23),
+      SIMDE_FLOAT32_C(     6.17), SIMDE_FLOAT32_C(    21.46), SIMDE_FLOAT32_C(    32.93), SIMDE_FLOAT32_C(    13.69),
+      SIMDE_FLOAT32_C(    26.16), SIMDE_FLOAT32_C(   -60.56), SIMDE_FLOAT32_C(    77.54), SIMDE_FLOAT32_C(    99.51),
+      SIMDE_FLOAT32_C(    36.38), SIMDE_FLOAT32_C(    40.12), SIMDE_FLOAT32_C(    55.04), SIMDE_FLOAT32_C(    43.01),
+      SIMDE_FLOAT32_C(    47.17), SIMDE_FLOAT32_C(   -11.87), SIMDE_FLOAT32_C(    -2.42), SIMDE_FLOAT32_C(   -18.35),
+      SIMDE_FLOAT32_C(    90.15), SIMDE_FLOAT32_C(    50.32), SIMDE_FLOAT32_C(    -4.17), SIMDE_FLOAT32_C(     5.07),
+      SIMDE_FLOAT32_C(   -64.27), SIMDE_FLOAT32_C(   -95.62), SIMDE_FLOAT32_C(    68.34), SIMDE_FLOAT32_C(   -61.33),
+      SIMDE_FLOAT32_C(     3.76), SIMDE_FLOAT32_C(   -80.85), SIMDE_FLOAT32_C(    37.93), SIMDE_FLOAT32_C(   -14.17),
+      SIMDE_FLOAT32_C(   -29.53), SIMDE_FLOAT32_C(    18.52), SIMDE_FLOAT32_C(    80.59), SIMDE_FLOAT32_C(    76.64),
+      SIMDE_FLOAT32_C(   -60.02), SIMDE_FLOAT32_C(    13.52), SIMDE_FLOAT32_C(    -9.67), SIMDE_FLOAT32_C(    66.14),
+      SIMDE_FLOAT32_C(    52.97), SIMDE_FLOAT32_C(   -32.13), SIMDE_FLOAT32_C(    65.65), SIMDE_FLOAT32_C(   -10.66),
+      SIMDE_FLOAT32_C(   -92.01), SIMDE_FLOAT32_C(    20.69), SIMDE_FLOAT32_C(   -67.65), SIMDE_FLOAT32_C(    55.16),
+      SIMDE_FLOAT32_C(   -91.19), SIMDE_FLOAT32_C(    29.93), SIMDE_FLOAT32_C(   -63.19), SIMDE_FLOAT32_C(    98.96),
+      SIMDE_FLOAT32_C(   -19.75), SIMDE_FLOAT32_C(    32.64), SIMDE_FLOAT32_C(     4.03), SIMDE_FLOAT32_C(    15.98),
+      SIMDE_FLOAT32_C(    37.02), SIMDE_FLOAT32_C(   -27.63), SIMDE_FLOAT32_C(    54.65), SIMDE_FLOAT32_C(   -59.21),
+      SIMDE_FLOAT32_C(    -8.48), SIMDE_FLOAT32_C(    -7.42), SIMDE_FLOAT32_C(    26.61), SIMDE_FLOAT32_C(    62.00),
+      SIMDE_FLOAT32_C(   -88.90), SIMDE_FLOAT32_C(     7.21), SIMDE_FLOAT32_C(    38.64), SIMDE_FLOAT32_C(   -48.92),
+      SIMDE_FLOAT32_C(   -79.27), SIMDE_FLOAT32_C(   -71.03), SIMDE_FLOAT32_C(   -82.78), SIMDE_FLOAT32_C(    73.70),
+      SIMDE_FLOAT32_C(    -3.16), SIMDE_FLOAT32_C(    82.87), SIMDE_FLOAT32_C(   -36.96), SIMDE_FLOAT32_C(     4.83),
+      SIMDE_FLOAT32_C(     3.55), SIMDE_FLOAT32_C(    -4.61), SIMDE_FLOAT32_C(   -40.01), SIMDE_FLOAT32_C(    12.37),
+      SIMDE_FLOAT32_C(   -74.68), SIMDE_FLOAT32_C(    -3.20), SIMDE_FLOAT32_C(    11.33), SIMDE_FLOAT32_C(     5.57),
+      SIMDE_FLOAT32_C(   -70.56), SIMDE_FLOAT32_C(   -84.64), SIMDE_FLOAT32_C(   -78.45), SIMDE_FLOAT32_C(    66.46),
+      SIMDE_FLOAT32_C(   -12.26), SIMDE_FLOAT32_C(    76.20), SIMDE_FLOAT32_C(   -92.75), SIMDE_FLOAT32_C(    79.26),
+      SIMDE_FLOAT32_C(   -31.22), SIMDE_FLOAT32_C(    33.87), SIMDE_FLOAT32_C(    41.26), SIMDE_FLOAT32_C(   -20.12),
+      SIMDE_FLOAT32_C(   -58.92), SIMDE_FLOAT32_C(   -20.11), SIMDE_FLOAT32_C(    30.95), SIMDE_FLOAT32_C(   -38.19),
+      SIMDE_FLOAT32_C(     8.86), SIMDE_FLOAT32_C(    48.17), SIMDE_FLOAT32_C(   -64.50), SIMDE_FLOAT32_C(   -94.29),
+      SIMDE_FLOAT32_C(    31.04), SIMDE_FLOAT32_C(    -1.46), SIMDE_FLOAT32_C(    10.54), SIMDE_FLOAT32_C(   -65.41),
+      SIMDE_FLOAT32_C(    93.93), SIMDE_FLOAT32_C(    70.53), SIMDE_FLOAT32_C(    46.96), SIMDE_FLOAT32_C(   -80.75),
+      SIMDE_FLOAT32_C(   -32.67), SIMDE_FLOAT32_C(   -41.71), SIMDE_FLOAT32_C(    24.82), SIMDE_FLOAT32_C(    -3.23),
+      SIMDE_FLOAT32_C(   -26.35), SIMDE_FLOAT32_C(    46.38), SIMDE_FLOAT32_C(   -36.76), SIMDE_FLOAT32_C(    61.39),
+      SIMDE_FLOAT32_C(    22.57), SIMDE_FLOAT32_C(   -29.51), SIMDE_FLOAT32_C(    40.65), SIMDE_FLOAT32_C(    91.35),
+      SIMDE_FLOAT32_C(   -95.65), SIMDE_FLOAT32_C(   -18.10), SIMDE_FLOAT32_C(   -28.77), SIMDE_FLOAT32_C(   -54.57),
+      SIMDE_FLOAT32_C(    61.80), SIMDE_FLOAT32_C(   -97.82), SIMDE_FLOAT32_C(     7.23), SIMDE_FLOAT32_C(   -29.34),
+      SIMDE_FLOAT32_C(    50.35), SIMDE_FLOAT32_C(    42.74), SIMDE_FLOAT32_C(   -23.63), SIMDE_FLOAT32_C(   -18.61),
+      SIMDE_FLOAT32_C(   -58.72), SIMDE_FLOAT32_C(    86.91), SIMDE_FLOAT32_C(    15.99), SIMDE_FLOAT32_C(   -64.79),
+      SIMDE_FLOAT32_C(    57.43), SIMDE_FLOAT32_C(   -37.05), SIMDE_FLOAT32_C(   -45.54), SIMDE_FLOAT32_C(   -75.24),
+      SIMDE_FLOAT32_C(    21.24), SIMDE_FLOAT32_C(    79.29), SIMDE_FLOAT32_C(    21.53), SIMDE_FLOAT32_C(    94.89) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  -922.63), SIMDE_FLOAT32_C(   -52.44), SIMDE_FLOAT32_C( -2855.98), SIMDE_FLOAT32_C( -4793.96),
+      SIMDE_FLOAT32_C( -1078.72), SIMDE_FLOAT32_C(    79.96), SIMDE_FLOAT32_C(  -609.93), SIMDE_FLOAT32_C(  6082.09),
+      SIMDE_FLOAT32_C(   766.48), SIMDE_FLOAT32_C(    97.27), SIMDE_FLOAT32_C(    -1.76), SIMDE_FLOAT32_C(    34.43),
+      SIMDE_FLOAT32_C(    48.25), SIMDE_FLOAT32_C(   -72.25), SIMDE_FLOAT32_C(   -27.19), SIMDE_FLOAT32_C( -4417.03),
+      SIMDE_FLOAT32_C(    64.37), SIMDE_FLOAT32_C(   -54.88), SIMDE_FLOAT32_C(  6504.47), SIMDE_FLOAT32_C(   515.75),
+      SIMDE_FLOAT32_C(   -66.25), SIMDE_FLOAT32_C(    55.79), SIMDE_FLOAT32_C(   -77.95), SIMDE_FLOAT32_C(   -43.49),
+      SIMDE_FLOAT32_C(    37.42), SIMDE_FLOAT32_C(  7769.40), SIMDE_FLOAT32_C(   -93.84), SIMDE_FLOAT32_C(    79.89),
+      SIMDE_FLOAT32_C(  5526.64), SIMDE_FLOAT32_C(   -45.59), SIMDE_FLOAT32_C(   -50.84), SIMDE_FLOAT32_C(   -25.72),
+      SIMDE_FLOAT32_C(     1.97), SIMDE_FLOAT32_C(     7.10), SIMDE_FLOAT32_C(   443.56), SIMDE_FLOAT32_C(    87.05),
+      SIMDE_FLOAT32_C(   -12.94), SIMDE_FLOAT32_C( -2462.23), SIMDE_FLOAT32_C(   -93.21), SIMDE_FLOAT32_C(  3471.37),
+      SIMDE_FLOAT32_C(    34.17), SIMDE_FLOAT32_C(  -363.47), SIMDE_FLOAT32_C(  1180.29), SIMDE_FLOAT32_C(  1378.20),
+      SIMDE_FLOAT32_C(    32.77), SIMDE_FLOAT32_C(    51.14), SIMDE_FLOAT32_C(  2251.81), SIMDE_FLOAT32_C(    -2.85),
+      SIMDE_FLOAT32_C( -3388.50), SIMDE_FLOAT32_C(  4554.50), SIMDE_FLOAT32_C(  4093.02), SIMDE_FLOAT32_C(  4515.17),
+      SIMDE_FLOAT32_C( -8151.80), SIMDE_FLOAT32_C(   -87.79), SIMDE_FLOAT32_C( -1141.62), SIMDE_FLOAT32_C(    21.56),
+      SIMDE_FLOAT32_C(   -77.25), SIMDE_FLOAT32_C(  -391.40), SIMDE_FLOAT32_C(   154.21), SIMDE_FLOAT32_C( -5139.61),
+      SIMDE_FLOAT32_C(    47.09), SIMDE_FLOAT32_C(  -620.14), SIMDE_FLOAT32_C(   990.46), SIMDE_FLOAT32_C(   -50.94),
+      SIMDE_FLOAT32_C( -2849.08), SIMDE_FLOAT32_C(  2006.96), SIMDE_FLOAT32_C(   -63.89), SIMDE_FLOAT32_C(    44.77),
+      SIMDE_FLOAT32_C(    73.85), SIMDE_FLOAT32_C(   -57.10), SIMDE_FLOAT32_C(   721.35), SIMDE_FLOAT32_C(     8.02),
+      SIMDE_FLOAT32_C(    47.92), SIMDE_FLOAT32_C(    67.02), SIMDE_FLOAT32_C(    90.44), SIMDE_FLOAT32_C( -1942.49),
+      SIMDE_FLOAT32_C(    18.16), SIMDE_FLOAT32_C(  3674.13), SIMDE_FLOAT32_C(  1175.38), SIMDE_FLOAT32_C(  1210.31),
+      SIMDE_FLOAT32_C(   -32.27), SIMDE_FLOAT32_C(    68.00), SIMDE_FLOAT32_C( -3465.62), SIMDE_FLOAT32_C(  1010.48),
+      SIMDE_FLOAT32_C( -6366.83), SIMDE_FLOAT32_C(  6822.58), SIMDE_FLOAT32_C(  5392.51), SIMDE_FLOAT32_C( -8952.37),
+      SIMDE_FLOAT32_C(    23.66), SIMDE_FLOAT32_C( -1247.10), SIMDE_FLOAT32_C( -4373.89), SIMDE_FLOAT32_C(  -745.64),
+      SIMDE_FLOAT32_C(   -74.52), SIMDE_FLOAT32_C(    74.19), SIMDE_FLOAT32_C(    19.81), SIMDE_FLOAT32_C(   -16.80),
+      SIMDE_FLOAT32_C(  8734.98), SIMDE_FLOAT32_C(  2939.01), SIMDE_FLOAT32_C(   -72.03), SIMDE_FLOAT32_C(    84.98),
+      SIMDE_FLOAT32_C(  9211.74), SIMDE_FLOAT32_C(    16.65), SIMDE_FLOAT32_C(   233.20), SIMDE_FLOAT32_C(    46.75),
+      SIMDE_FLOAT32_C(   -16.33), SIMDE_FLOAT32_C(   863.08), SIMDE_FLOAT32_C(   -72.56), SIMDE_FLOAT32_C(   -98.16),
+      SIMDE_FLOAT32_C(    22.81), SIMDE_FLOAT32_C(   -94.72), SIMDE_FLOAT32_C(   139.60), SIMDE_FLOAT32_C(  5905.26),
+      SIMDE_FLOAT32_C( -5394.78), SIMDE_FLOAT32_C( -1162.23), SIMDE_FLOAT32_C(  3211.71), SIMDE_FLOAT32_C( -2905.84),
+      SIMDE_FLOAT32_C(  -262.04), SIMDE_FLOAT32_C(   -84.17), SIMDE_FLOAT32_C(    56.47), SIMDE_FLOAT32_C(  2130.25),
+      SIMDE_FLOAT32_C(    -9.29), SIMDE_FLOAT32_C(   -92.09), SIMDE_FLOAT32_C(  1356.56), SIMDE_FLOAT32_C(    16.19),
+      SIMDE_FLOAT32_C(    82.10), SIMDE_FLOAT32_C( -3753.78), SIMDE_FLOAT32_C(    99.39), SIMDE_FLOAT32_C(    93.23),
+      SIMDE_FLOAT32_C(    61.82), SIMDE_FLOAT32_C(   -72.64), SIMDE_FLOAT32_C( -2548.79), SIMDE_FLOAT32_C(  -907.36),
+      SIMDE_FLOAT32_C(    44.02), SIMDE_FLOAT32_C(  -966.43), SIMDE_FLOAT32_C(   231.67), SIMDE_FLOAT32_C( -6211.53),
+      SIMDE_FLOAT32_C(    54.65), SIMDE_FLOAT32_C(  3233.74), SIMDE_FLOAT32_C(   -70.48), SIMDE_FLOAT32_C(   -22.54),
+      SIMDE_FLOAT32_C(  2397.68), SIMDE_FLOAT32_C(    45.79), SIMDE_FLOAT32_C(  1926.33), SIMDE_FLOAT32_C(  1083.05),
+      SIMDE_FLOAT32_C( -3481.63), SIMDE_FLOAT32_C(    10.41), SIMDE_FLOAT32_C(   -33.09), SIMDE_FLOAT32_C(   124.42),
+      SIMDE_FLOAT32_C(     6.09), SIMDE_FLOAT32_C(   -76.62), SIMDE_FLOAT32_C(   592.97), SIMDE_FLOAT32_C(   -83.05),
+      SIMDE_FLOAT32_C(    45.08), SIMDE_FLOAT32_C(  4173.06), SIMDE_FLOAT32_C(  -772.63), SIMDE_FLOAT32_C(   -86.60),
+      SIMDE_FLOAT32_C(  1683.54), SIMDE_FLOAT32_C(    32.54), SIMDE_FLOAT32_C(  6861.22), SIMDE_FLOAT32_C(    67.38),
+      SIMDE_FLOAT32_C(    59.91), SIMDE_FLOAT32_C(  -478.92), SIMDE_FLOAT32_C(    28.03), SIMDE_FLOAT32_C(     3.92),
+      SIMDE_FLOAT32_C(  3043.74), SIMDE_FLOAT32_C(   -64.58), SIMDE_FLOAT32_C(  1783.70), SIMDE_FLOAT32_C(  7632.76),
+      SIMDE_FLOAT32_C(  6213.49), SIMDE_FLOAT32_C( -2450.37), SIMDE_FLOAT32_C(    37.62), SIMDE_FLOAT32_C(    10.38),
+      SIMDE_FLOAT32_C(     6.93), SIMDE_FLOAT32_C(    56.18), SIMDE_FLOAT32_C( -2643.07), SIMDE_FLOAT32_C(    13.44),
+      SIMDE_FLOAT32_C(   -33.41), SIMDE_FLOAT32_C(  -566.82), SIMDE_FLOAT32_C(  2408.16), SIMDE_FLOAT32_C(  1995.22),
+      SIMDE_FLOAT32_C(    14.08), SIMDE_FLOAT32_C(    25.21), SIMDE_FLOAT32_C( -8363.99), SIMDE_FLOAT32_C(  1417.15),
+      SIMDE_FLOAT32_C(  1417.68), SIMDE_FLOAT32_C(    42.94), SIMDE_FLOAT32_C(  5410.51), SIMDE_FLOAT32_C( -1955.08),
+      SIMDE_FLOAT32_C( -1590.96), SIMDE_FLOAT32_C(    65.40), SIMDE_FLOAT32_C(    -2.20), SIMDE_FLOAT32_C( -2877.03),
+      SIMDE_FLOAT32_C(   781.85), SIMDE_FLOAT32_C(  2295.93), SIMDE_FLOAT32_C(    39.30), SIMDE_FLOAT32_C( -4083.19),
+      SIMDE_FLOAT32_C(   -38.76), SIMDE_FLOAT32_C(   878.41), SIMDE_FLOAT32_C(   -82.97), SIMDE_FLOAT32_C(   -68.50),
+      SIMDE_FLOAT32_C(   -67.95), SIMDE_FLOAT32_C(     5.21), SIMDE_FLOAT32_C( -4002.27), SIMDE_FLOAT32_C( -3813.22),
+      SIMDE_FLOAT32_C( -3033.41), SIMDE_FLOAT32_C(    65.66), SIMDE_FLOAT32_C(  4386.13), SIMDE_FLOAT32_C(  2812.13),
+      SIMDE_FLOAT32_C(  -241.44), SIMDE_FLOAT32_C(   -35.93), SIMDE_FLOAT32_C(   365.58), SIMDE_FLOAT32_C(  2566.83),
+      SIMDE_FLOAT32_C(    89.27), SIMDE_FLOAT32_C(   269.38), SIMDE_FLOAT32_C(    15.81), SIMDE_FLOAT32_C(  -698.68),
+      SIMDE_FLOAT32_C(   -26.46), SIMDE_FLOAT32_C(   997.26), SIMDE_FLOAT32_C(   451.02), SIMDE_FLOAT32_C(  2451.00),
+      SIMDE_FLOAT32_C(  1037.25), SIMDE_FLOAT32_C(    42.34), SIMDE_FLOAT32_C(    84.40), SIMDE_FLOAT32_C(    90.23),
+      SIMDE_FLOAT32_C(  5086.28), SIMDE_FLOAT32_C( -2259.87), SIMDE_FLOAT32_C(  3637.46), SIMDE_FLOAT32_C(   -70.59),
+      SIMDE_FLOAT32_C(    94.61), SIMDE_FLOAT32_C(   473.41), SIMDE_FLOAT32_C(   -39.09), SIMDE_FLOAT32_C(  7117.19) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i])),
+      cv = simde_svld1_f32(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmad_f32_m(pv, av, bv, cv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], c[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), c, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+    cv = simde_svld1_f32(pg, &(c[i]));
+
+    ev = simde_svmad_f32_m(pv, av, bv, cv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   -28.76), SIMDE_FLOAT64_C(   -83.48), SIMDE_FLOAT64_C(    -3.36), SIMDE_FLOAT64_C(    54.58),
+      SIMDE_FLOAT64_C(    27.12), SIMDE_FLOAT64_C(   -91.84), SIMDE_FLOAT64_C(   -53.39), SIMDE_FLOAT64_C(   -59.81),
+      SIMDE_FLOAT64_C(   -87.87), SIMDE_FLOAT64_C(   -68.63), SIMDE_FLOAT64_C(    95.77), SIMDE_FLOAT64_C(   -87.70),
+      SIMDE_FLOAT64_C(    75.36), SIMDE_FLOAT64_C(    35.74), SIMDE_FLOAT64_C(   -20.67), SIMDE_FLOAT64_C(    38.42),
+      SIMDE_FLOAT64_C(   -60.30), SIMDE_FLOAT64_C(   -76.59), SIMDE_FLOAT64_C(    68.23), SIMDE_FLOAT64_C(   -74.96),
+      SIMDE_FLOAT64_C(   -82.76), SIMDE_FLOAT64_C(   -66.17), SIMDE_FLOAT64_C(   -39.49), SIMDE_FLOAT64_C(    95.97),
+      SIMDE_FLOAT64_C(   -30.14), SIMDE_FLOAT64_C(    40.25), SIMDE_FLOAT64_C(    71.29), SIMDE_FLOAT64_C(    10.50),
+      SIMDE_FLOAT64_C(    88.62), SIMDE_FLOAT64_C(    59.37), SIMDE_FLOAT64_C(   -36.04), SIMDE_FLOAT64_C(   -40.14),
+      SIMDE_FLOAT64_C(    75.89), SIMDE_FLOAT64_C(    60.60), SIMDE_FLOAT64_C(   -85.57), SIMDE_FLOAT64_C(     3.02),
+      SIMDE_FLOAT64_C(    68.76), SIMDE_FLOAT64_C(   -38.96), SIMDE_FLOAT64_C(    43.21), SIMDE_FLOAT64_C(    80.89),
+      SIMDE_FLOAT64_C(    -7.59), SIMDE_FLOAT64_C(    38.98), SIMDE_FLOAT64_C(    93.19), SIMDE_FLOAT64_C(   -32.23),
+      SIMDE_FLOAT64_C(   -25.29), SIMDE_FLOAT64_C(   -27.48), SIMDE_FLOAT64_C(   -93.81), SIMDE_FLOAT64_C(    14.42),
+      SIMDE_FLOAT64_C(    -4.07), SIMDE_FLOAT64_C(    74.42), SIMDE_FLOAT64_C(    39.46), SIMDE_FLOAT64_C(    13.17),
+      SIMDE_FLOAT64_C(   -91.74), SIMDE_FLOAT64_C(    99.97), SIMDE_FLOAT64_C(     9.14), SIMDE_FLOAT64_C(   -21.89),
+      SIMDE_FLOAT64_C(    40.22), SIMDE_FLOAT64_C(   -19.58), SIMDE_FLOAT64_C(    88.61), SIMDE_FLOAT64_C(    28.84),
+      SIMDE_FLOAT64_C(   -60.20), SIMDE_FLOAT64_C(   -47.42), SIMDE_FLOAT64_C(    88.70), SIMDE_FLOAT64_C(   -84.31),
+      SIMDE_FLOAT64_C(   -86.82), SIMDE_FLOAT64_C(   -96.87), SIMDE_FLOAT64_C(    18.71), SIMDE_FLOAT64_C(    81.94),
+      SIMDE_FLOAT64_C(   -35.83), SIMDE_FLOAT64_C(   -38.08), SIMDE_FLOAT64_C(    62.83), SIMDE_FLOAT64_C(    56.58),
+      SIMDE_FLOAT64_C(   -99.11), SIMDE_FLOAT64_C(    56.02), SIMDE_FLOAT64_C(   -75.64), SIMDE_FLOAT64_C(   -24.39),
+      SIMDE_FLOAT64_C(   -71.47), SIMDE_FLOAT64_C(   -69.45), SIMDE_FLOAT64_C(    90.02), SIMDE_FLOAT64_C(    24.46),
+      SIMDE_FLOAT64_C(   -95.03), SIMDE_FLOAT64_C(    29.48), SIMDE_FLOAT64_C(   -62.37), SIMDE_FLOAT64_C(   -86.77),
+      SIMDE_FLOAT64_C(    29.45), SIMDE_FLOAT64_C(    46.77), SIMDE_FLOAT64_C(    -8.66), SIMDE_FLOAT64_C(   -30.33),
+      SIMDE_FLOAT64_C(   -72.81), SIMDE_FLOAT64_C(   -20.05), SIMDE_FLOAT64_C(    98.51), SIMDE_FLOAT64_C(   -33.01),
+      SIMDE_FLOAT64_C(    32.53), SIMDE_FLOAT64_C(    87.21), SIMDE_FLOAT64_C(   -17.32), SIMDE_FLOAT64_C(    45.71),
+      SIMDE_FLOAT64_C(    90.34), SIMDE_FLOAT64_C(   -98.61), SIMDE_FLOAT64_C(    27.65), SIMDE_FLOAT64_C(   -45.49),
+      SIMDE_FLOAT64_C(   -36.69), SIMDE_FLOAT64_C(    -9.52), SIMDE_FLOAT64_C(   -88.90), SIMDE_FLOAT64_C(   -35.80) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(   -53.50), SIMDE_FLOAT64_C(   -64.54), SIMDE_FLOAT64_C(    39.81), SIMDE_FLOAT64_C(   -24.97),
+      SIMDE_FLOAT64_C(   -34.00), SIMDE_FLOAT64_C(    29.84), SIMDE_FLOAT64_C(    99.49), SIMDE_FLOAT64_C(   -29.03),
+      SIMDE_FLOAT64_C(   -40.68), SIMDE_FLOAT64_C(   -62.88), SIMDE_FLOAT64_C(   -15.80), SIMDE_FLOAT64_C(    88.77),
+      SIMDE_FLOAT64_C(    83.89), SIMDE_FLOAT64_C(    75.54), SIMDE_FLOAT64_C(   -41.56), SIMDE_FLOAT64_C(   -88.92),
+      SIMDE_FLOAT64_C(   -44.50), SIMDE_FLOAT64_C(   -43.05), SIMDE_FLOAT64_C(   -21.93), SIMDE_FLOAT64_C(    88.03),
+      SIMDE_FLOAT64_C(   -55.84), SIMDE_FLOAT64_C(    60.75), SIMDE_FLOAT64_C(    33.74), SIMDE_FLOAT64_C(   -65.50),
+      SIMDE_FLOAT64_C(    62.14), SIMDE_FLOAT64_C(   -38.61), SIMDE_FLOAT64_C(   -10.99), SIMDE_FLOAT64_C(   -74.55),
+      SIMDE_FLOAT64_C(    51.87), SIMDE_FLOAT64_C(     0.11), SIMDE_FLOAT64_C(   -10.35), SIMDE_FLOAT64_C(    98.37),
+      SIMDE_FLOAT64_C(    35.56), SIMDE_FLOAT64_C(   -70.54), SIMDE_FLOAT64_C(   -26.59), SIMDE_FLOAT64_C(   -98.43),
+      SIMDE_FLOAT64_C(    59.30), SIMDE_FLOAT64_C(   -27.10), SIMDE_FLOAT64_C(   -27.46), SIMDE_FLOAT64_C(   -81.39),
+      SIMDE_FLOAT64_C(    10.03), SIMDE_FLOAT64_C(    56.74), SIMDE_FLOAT64_C(   -92.62), SIMDE_FLOAT64_C(    -6.08),
+      SIMDE_FLOAT64_C(    32.28), SIMDE_FLOAT64_C(   -34.18), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(    87.78),
+      SIMDE_FLOAT64_C(    22.76), SIMDE_FLOAT64_C(    83.07), SIMDE_FLOAT64_C(    75.81), SIMDE_FLOAT64_C(    66.92),
+      SIMDE_FLOAT64_C(    43.82), SIMDE_FLOAT64_C(     9.54), SIMDE_FLOAT64_C(   -98.59), SIMDE_FLOAT64_C(     5.96),
+      SIMDE_FLOAT64_C(    70.93), SIMDE_FLOAT64_C(    -9.58), SIMDE_FLOAT64_C(    31.41), SIMDE_FLOAT64_C(    22.80),
+      SIMDE_FLOAT64_C(    90.53), SIMDE_FLOAT64_C(   -78.94), SIMDE_FLOAT64_C(    21.18), SIMDE_FLOAT64_C(    26.09),
+      SIMDE_FLOAT64_C(   -49.49), SIMDE_FLOAT64_C(    94.59), SIMDE_FLOAT64_C(    27.66), SIMDE_FLOAT64_C(   -90.19),
+      SIMDE_FLOAT64_C(   -32.51), SIMDE_FLOAT64_C(   -99.80), SIMDE_FLOAT64_C(   -71.58), SIMDE_FLOAT64_C(    77.52),
+      SIMDE_FLOAT64_C(    56.94), SIMDE_FLOAT64_C(   -64.20), SIMDE_FLOAT64_C(   -28.56), SIMDE_FLOAT64_C(   -10.77),
+      SIMDE_FLOAT64_C(     1.62), SIMDE_FLOAT64_C(    76.44), SIMDE_FLOAT64_C(   -22.99), SIMDE_FLOAT64_C(   -75.62),
+      SIMDE_FLOAT64_C(    59.51), SIMDE_FLOAT64_C(   -47.18), SIMDE_FLOAT64_C(    91.30), SIMDE_FLOAT64_C(     3.33),
+      SIMDE_FLOAT64_C(    62.36), SIMDE_FLOAT64_C(    92.72), SIMDE_FLOAT64_C(   -90.71), SIMDE_FLOAT64_C(    33.29),
+      SIMDE_FLOAT64_C(   -16.86), SIMDE_FLOAT64_C(    40.69), SIMDE_FLOAT64_C(   -43.90), SIMDE_FLOAT64_C(   -26.33),
+      SIMDE_FLOAT64_C(    61.75), SIMDE_FLOAT64_C(    77.27), SIMDE_FLOAT64_C(    99.76), SIMDE_FLOAT64_C(   -87.74),
+      SIMDE_FLOAT64_C(    71.86), SIMDE_FLOAT64_C(    27.42), SIMDE_FLOAT64_C(   -77.93), SIMDE_FLOAT64_C(   -60.65),
+      SIMDE_FLOAT64_C(    27.62), SIMDE_FLOAT64_C(   -49.51), SIMDE_FLOAT64_C(   -83.13), SIMDE_FLOAT64_C(   -15.44) };
+  static const simde_float64 c[] =
+    { SIMDE_FLOAT64_C(   -13.70), SIMDE_FLOAT64_C(   -11.69), SIMDE_FLOAT64_C(    73.79), SIMDE_FLOAT64_C(    87.92),
+      SIMDE_FLOAT64_C(   -35.26), SIMDE_FLOAT64_C(   -49.20), SIMDE_FLOAT64_C(   -87.70), SIMDE_FLOAT64_C(   -75.75),
+      SIMDE_FLOAT64_C(     3.61), SIMDE_FLOAT64_C(   -96.40), SIMDE_FLOAT64_C(    27.57), SIMDE_FLOAT64_C(   -34.03),
+      SIMDE_FLOAT64_C(    96.32), SIMDE_FLOAT64_C(    36.86), SIMDE_FLOAT64_C(    99.26), SIMDE_FLOAT64_C(   -20.54),
+      SIMDE_FLOAT64_C(   -22.45), SIMDE_FLOAT64_C(   -44.64), SIMDE_FLOAT64_C(    53.13), SIMDE_FLOAT64_C(   -60.70),
+      SIMDE_FLOAT64_C(   -67.37), SIMDE_FLOAT64_C(    52.89), SIMDE_FLOAT64_C(   -48.44), SIMDE_FLOAT64_C(   -95.51),
+      SIMDE_FLOAT64_C(   -19.68), SIMDE_FLOAT64_C(   -26.36), SIMDE_FLOAT64_C(   -56.16), SIMDE_FLOAT64_C(   -92.06),
+      SIMDE_FLOAT64_C(    24.13), SIMDE_FLOAT64_C(   -39.29), SIMDE_FLOAT64_C(    -7.50), SIMDE_FLOAT64_C(   -89.57),
+      SIMDE_FLOAT64_C(    49.02), SIMDE_FLOAT64_C(   -33.71), SIMDE_FLOAT64_C(    98.34), SIMDE_FLOAT64_C(   -86.24),
+      SIMDE_FLOAT64_C(    17.08), SIMDE_FLOAT64_C(   -89.36), SIMDE_FLOAT64_C(   -61.99), SIMDE_FLOAT64_C(   -79.31),
+      SIMDE_FLOAT64_C(   -85.75), SIMDE_FLOAT64_C(    65.59), SIMDE_FLOAT64_C(   -13.34), SIMDE_FLOAT64_C(   -89.43),
+      SIMDE_FLOAT64_C(     2.45), SIMDE_FLOAT64_C(   -14.08), SIMDE_FLOAT64_C(    -9.97), SIMDE_FLOAT64_C(    80.00),
+      SIMDE_FLOAT64_C(    41.28), SIMDE_FLOAT64_C(   -56.84), SIMDE_FLOAT64_C(   -80.70), SIMDE_FLOAT64_C(    73.91),
+      SIMDE_FLOAT64_C(    96.05), SIMDE_FLOAT64_C(   -29.13), SIMDE_FLOAT64_C(    78.41), SIMDE_FLOAT64_C(   -23.63),
+      SIMDE_FLOAT64_C(    44.50), SIMDE_FLOAT64_C(   -77.75), SIMDE_FLOAT64_C(   -15.69), SIMDE_FLOAT64_C(   -31.37),
+      SIMDE_FLOAT64_C(   -17.03), SIMDE_FLOAT64_C(    76.81), SIMDE_FLOAT64_C(   -20.94), SIMDE_FLOAT64_C(   -68.01),
+      SIMDE_FLOAT64_C(   -56.90), SIMDE_FLOAT64_C(   -22.60), SIMDE_FLOAT64_C(   -54.25), SIMDE_FLOAT64_C(    60.18),
+      SIMDE_FLOAT64_C(   -11.96), SIMDE_FLOAT64_C(   -16.24), SIMDE_FLOAT64_C(    80.87), SIMDE_FLOAT64_C(     2.29),
+      SIMDE_FLOAT64_C(   -50.65), SIMDE_FLOAT64_C(   -32.46), SIMDE_FLOAT64_C(    12.86), SIMDE_FLOAT64_C(    51.79),
+      SIMDE_FLOAT64_C(    53.46), SIMDE_FLOAT64_C(   -97.11), SIMDE_FLOAT64_C(    31.79), SIMDE_FLOAT64_C(    -5.26),
+      SIMDE_FLOAT64_C(   -53.95), SIMDE_FLOAT64_C(    51.10), SIMDE_FLOAT64_C(   -31.35), SIMDE_FLOAT64_C(   -57.90),
+      SIMDE_FLOAT64_C(   -78.04), SIMDE_FLOAT64_C(   -52.94), SIMDE_FLOAT64_C(    18.47), SIMDE_FLOAT64_C(    66.46),
+      SIMDE_FLOAT64_C(   -30.69), SIMDE_FLOAT64_C(   -97.22), SIMDE_FLOAT64_C(   -64.91), SIMDE_FLOAT64_C(    52.28),
+      SIMDE_FLOAT64_C(    79.59), SIMDE_FLOAT64_C(    14.15), SIMDE_FLOAT64_C(    84.26), SIMDE_FLOAT64_C(   -77.32),
+      SIMDE_FLOAT64_C(    91.55), SIMDE_FLOAT64_C(   -69.99), SIMDE_FLOAT64_C(    82.86), SIMDE_FLOAT64_C(   -20.41),
+      SIMDE_FLOAT64_C(    13.77), SIMDE_FLOAT64_C(    63.73), SIMDE_FLOAT64_C(    81.88), SIMDE_FLOAT64_C(    63.11) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  5376.11), SIMDE_FLOAT64_C(   -59.97), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -2789.71), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  1660.53),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  4219.05), SIMDE_FLOAT64_C( -1485.60), SIMDE_FLOAT64_C( -7819.16),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  2736.66), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -3436.85),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -6381.55),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -32.76), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -4038.14),
+      SIMDE_FLOAT64_C(  2747.67), SIMDE_FLOAT64_C( -4308.43), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   966.46), SIMDE_FLOAT64_C( -1248.54), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -161.88), SIMDE_FLOAT64_C(  2277.32), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   106.53),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   925.19), SIMDE_FLOAT64_C(  -479.02), SIMDE_FLOAT64_C(  1345.79),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  6125.23), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   955.25),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -5466.94), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  1857.73), SIMDE_FLOAT64_C( -2267.66),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   463.27), SIMDE_FLOAT64_C( -7329.99),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  4388.37),
+      SIMDE_FLOAT64_C( -5693.97), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  2173.14), SIMDE_FLOAT64_C(   314.47),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -5405.87), SIMDE_FLOAT64_C( -2037.77), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -5709.19), SIMDE_FLOAT64_C( -1339.77), SIMDE_FLOAT64_C( -5725.73), SIMDE_FLOAT64_C(  -346.84),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  4283.57), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -943.23),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -4389.50), SIMDE_FLOAT64_C(   921.43),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -1643.58), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  6583.38), SIMDE_FLOAT64_C( -2773.88), SIMDE_FLOAT64_C( -2071.90), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -999.61), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  7472.14), SIMDE_FLOAT64_C(     0.00) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i])),
+      cv = simde_svld1_f64(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmad_f64_z(pv, av, bv, cv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], c[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), c, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+    cv = simde_svld1_f64(pg, &(c[i]));
+
+    ev = simde_svmad_f64_z(pv, av, bv, cv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmad_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   -75.92), SIMDE_FLOAT64_C(     2.89), SIMDE_FLOAT64_C(    60.93), SIMDE_FLOAT64_C(    74.13),
+      SIMDE_FLOAT64_C(    23.25), SIMDE_FLOAT64_C(   -68.15), SIMDE_FLOAT64_C(   -98.98), SIMDE_FLOAT64_C(   -95.44),
+      SIMDE_FLOAT64_C(   -17.55), SIMDE_FLOAT64_C(    72.79), SIMDE_FLOAT64_C(   -72.32), SIMDE_FLOAT64_C(   -64.50),
+      SIMDE_FLOAT64_C(   -17.22), SIMDE_FLOAT64_C(    45.76), SIMDE_FLOAT64_C(    56.15), SIMDE_FLOAT64_C(   -30.25),
+      SIMDE_FLOAT64_C(   -17.82), SIMDE_FLOAT64_C(   -86.63), SIMDE_FLOAT64_C(   -68.53), SIMDE_FLOAT64_C(   -21.12),
+      SIMDE_FLOAT64_C(    51.27), SIMDE_FLOAT64_C(    39.23), SIMDE_FLOAT64_C(    56.30), SIMDE_FLOAT64_C(     9.98),
+      SIMDE_FLOAT64_C(    95.95), SIMDE_FLOAT64_C(   -39.34), SIMDE_FLOAT64_C(    94.55), SIMDE_FLOAT64_C(    17.29),
+      SIMDE_FLOAT64_C(     3.40), SIMDE_FLOAT64_C(    47.46), SIMDE_FLOAT64_C(    71.69), SIMDE_FLOAT64_C(    27.49),
+      SIMDE_FLOAT64_C(   -49.65), SIMDE_FLOAT64_C(    32.61), SIMDE_FLOAT64_C(     1.61), SIMDE_FLOAT64_C(    73.60),
+      SIMDE_FLOAT64_C(    64.46), SIMDE_FLOAT64_C(     2.64), SIMDE_FLOAT64_C(    78.16), SIMDE_FLOAT64_C(   -53.09),
+      SIMDE_FLOAT64_C(   -24.58), SIMDE_FLOAT64_C(   -94.16), SIMDE_FLOAT64_C(   -17.59), SIMDE_FLOAT64_C(    58.21),
+      SIMDE_FLOAT64_C(    51.60), SIMDE_FLOAT64_C(   -61.45), SIMDE_FLOAT64_C(   -72.05), SIMDE_FLOAT64_C(   -66.23),
+      SIMDE_FLOAT64_C(   -48.08), SIMDE_FLOAT64_C(   -40.58), SIMDE_FLOAT64_C(    12.66), SIMDE_FLOAT64_C(   -96.81),
+      SIMDE_FLOAT64_C(    98.65), SIMDE_FLOAT64_C(   -31.05), SIMDE_FLOAT64_C(    13.17), SIMDE_FLOAT64_C(    94.60),
+      SIMDE_FLOAT64_C(    29.61), SIMDE_FLOAT64_C(     7.72), SIMDE_FLOAT64_C(    11.89), SIMDE_FLOAT64_C(   -66.99),
+      SIMDE_FLOAT64_C(   -44.82), SIMDE_FLOAT64_C(   -16.42), SIMDE_FLOAT64_C(    60.50), SIMDE_FLOAT64_C(     5.54),
+      SIMDE_FLOAT64_C(   -83.81), SIMDE_FLOAT64_C(   -37.89), SIMDE_FLOAT64_C(   -20.86), SIMDE_FLOAT64_C(    80.65),
+      SIMDE_FLOAT64_C(    64.75), SIMDE_FLOAT64_C(   -42.70), SIMDE_FLOAT64_C(   -72.44), SIMDE_FLOAT64_C(   -59.83),
+      SIMDE_FLOAT64_C(   -36.86), SIMDE_FLOAT64_C(     9.96), SIMDE_FLOAT64_C(    98.38), SIMDE_FLOAT64_C(   -85.26),
+      SIMDE_FLOAT64_C(    48.52), SIMDE_FLOAT64_C(   -73.67), SIMDE_FLOAT64_C(   -51.49), SIMDE_FLOAT64_C(   -99.57),
+      SIMDE_FLOAT64_C(   -14.25), SIMDE_FLOAT64_C(    61.17), SIMDE_FLOAT64_C(   -96.38), SIMDE_FLOAT64_C(   -15.60),
+      SIMDE_FLOAT64_C(   -69.88), SIMDE_FLOAT64_C(    16.79), SIMDE_FLOAT64_C(   -21.01), SIMDE_FLOAT64_C(    59.73),
+      SIMDE_FLOAT64_C(   -75.49), SIMDE_FLOAT64_C(    90.88), SIMDE_FLOAT64_C(    92.75), SIMDE_FLOAT64_C(   -20.30),
+      SIMDE_FLOAT64_C(   -25.54), SIMDE_FLOAT64_C(    53.25), SIMDE_FLOAT64_C(    85.24), SIMDE_FLOAT64_C(    -9.35),
+      SIMDE_FLOAT64_C(   -84.64), SIMDE_FLOAT64_C(   -35.62), SIMDE_FLOAT64_C(   -28.70), SIMDE_FLOAT64_C(    80.11),
+      SIMDE_FLOAT64_C(    21.68), SIMDE_FLOAT64_C(    -1.14), SIMDE_FLOAT64_C(   -79.72), SIMDE_FLOAT64_C(    84.82),
+      SIMDE_FLOAT64_C(   -91.18), SIMDE_FLOAT64_C(   -81.34), SIMDE_FLOAT64_C(    99.56), SIMDE_FLOAT64_C(    57.34),
+      SIMDE_FLOAT64_C(   -55.01), SIMDE_FLOAT64_C(   -51.93), SIMDE_FLOAT64_C(    57.77), SIMDE_FLOAT64_C(    30.74),
+      SIMDE_FLOAT64_C(   -90.77), SIMDE_FLOAT64_C(    61.40) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(   -84.87), SIMDE_FLOAT64_C(   -60.64), SIMDE_FLOAT64_C(   -21.81), SIMDE_FLOAT64_C(    -5.87),
+      SIMDE_FLOAT64_C(    99.09), SIMDE_FLOAT64_C(     2.70), SIMDE_FLOAT64_C(   -14.99), SIMDE_FLOAT64_C(    91.84),
+      SIMDE_FLOAT64_C(    82.40), SIMDE_FLOAT64_C(    59.47), SIMDE_FLOAT64_C(    45.09), SIMDE_FLOAT64_C(    67.64),
+      SIMDE_FLOAT64_C(   -49.88), SIMDE_FLOAT64_C(    60.45), SIMDE_FLOAT64_C(   -67.99), SIMDE_FLOAT64_C(    21.42),
+      SIMDE_FLOAT64_C(    40.56), SIMDE_FLOAT64_C(    53.69), SIMDE_FLOAT64_C(   -79.72), SIMDE_FLOAT64_C(    60.84),
+      SIMDE_FLOAT64_C(    38.51), SIMDE_FLOAT64_C(   -70.90), SIMDE_FLOAT64_C(    79.50), SIMDE_FLOAT64_C(    38.06),
+      SIMDE_FLOAT64_C(    86.44), SIMDE_FLOAT64_C(   -75.51), SIMDE_FLOAT64_C(    86.13), SIMDE_FLOAT64_C(    44.21),
+      SIMDE_FLOAT64_C(    55.22), SIMDE_FLOAT64_C(    95.37), SIMDE_FLOAT64_C(     5.61), SIMDE_FLOAT64_C(    70.36),
+      SIMDE_FLOAT64_C(   -65.28), SIMDE_FLOAT64_C(    83.79), SIMDE_FLOAT64_C(   -35.51), SIMDE_FLOAT64_C(   -66.19),
+      SIMDE_FLOAT64_C(   -13.50), SIMDE_FLOAT64_C(    49.50), SIMDE_FLOAT64_C(   -74.35), SIMDE_FLOAT64_C(   -31.10),
+      SIMDE_FLOAT64_C(     8.97), SIMDE_FLOAT64_C(    70.74), SIMDE_FLOAT64_C(   -63.46), SIMDE_FLOAT64_C(    59.09),
+      SIMDE_FLOAT64_C(    31.18), SIMDE_FLOAT64_C(   -31.45), SIMDE_FLOAT64_C(   -19.49), SIMDE_FLOAT64_C(   -28.26),
+      SIMDE_FLOAT64_C(   -77.76), SIMDE_FLOAT64_C(     0.79), SIMDE_FLOAT64_C(   -67.42), SIMDE_FLOAT64_C(    60.75),
+      SIMDE_FLOAT64_C(    29.89), SIMDE_FLOAT64_C(   -87.92), SIMDE_FLOAT64_C(    -1.19), SIMDE_FLOAT64_C(    16.32),
+      SIMDE_FLOAT64_C(   -63.44), SIMDE_FLOAT64_C(   -15.06), SIMDE_FLOAT64_C(   -39.47), SIMDE_FLOAT64_C(    91.78),
+      SIMDE_FLOAT64_C(   -19.69), SIMDE_FLOAT64_C(    66.14), SIMDE_FLOAT64_C(    62.14), SIMDE_FLOAT64_C(    15.03),
+      SIMDE_FLOAT64_C(    49.93), SIMDE_FLOAT64_C(   -73.37), SIMDE_FLOAT64_C(    48.84), SIMDE_FLOAT64_C(   -63.58),
+      SIMDE_FLOAT64_C(    76.12), SIMDE_FLOAT64_C(    74.49), SIMDE_FLOAT64_C(     5.32), SIMDE_FLOAT64_C(   -14.91),
+      SIMDE_FLOAT64_C(    45.23), SIMDE_FLOAT64_C(    41.86), SIMDE_FLOAT64_C(   -55.82), SIMDE_FLOAT64_C(   -23.59),
+      SIMDE_FLOAT64_C(   -89.59), SIMDE_FLOAT64_C(    24.69), SIMDE_FLOAT64_C(    48.15), SIMDE_FLOAT64_C(   -67.35),
+      SIMDE_FLOAT64_C(   -74.52), SIMDE_FLOAT64_C(    80.73), SIMDE_FLOAT64_C(    93.39), SIMDE_FLOAT64_C(    55.36),
+      SIMDE_FLOAT64_C(    92.81), SIMDE_FLOAT64_C(    -7.79), SIMDE_FLOAT64_C(   -28.31), SIMDE_FLOAT64_C(   -70.63),
+      SIMDE_FLOAT64_C(    77.15), SIMDE_FLOAT64_C(    32.22), SIMDE_FLOAT64_C(   -78.85), SIMDE_FLOAT64_C(   -42.54),
+      SIMDE_FLOAT64_C(    -1.65), SIMDE_FLOAT64_C(    83.30), SIMDE_FLOAT64_C(    72.49), SIMDE_FLOAT64_C(   -51.72),
+      SIMDE_FLOAT64_C(   -90.08), SIMDE_FLOAT64_C(    21.34), SIMDE_FLOAT64_C(   -15.30), SIMDE_FLOAT64_C(    86.05),
+      SIMDE_FLOAT64_C(    -4.17), SIMDE_FLOAT64_C(    90.02), SIMDE_FLOAT64_C(   -28.86), SIMDE_FLOAT64_C(   -58.94),
+      SIMDE_FLOAT64_C(    31.88), SIMDE_FLOAT64_C(    15.32), SIMDE_FLOAT64_C(    17.47), SIMDE_FLOAT64_C(    42.29),
+      SIMDE_FLOAT64_C(   -59.99), SIMDE_FLOAT64_C(   -34.38), SIMDE_FLOAT64_C(    74.94), SIMDE_FLOAT64_C(   -34.51),
+      SIMDE_FLOAT64_C(   -53.65), SIMDE_FLOAT64_C(    68.33) };
+  static const simde_float64 c[] =
+    { SIMDE_FLOAT64_C(   -79.14), SIMDE_FLOAT64_C(   -60.84), SIMDE_FLOAT64_C(   -39.46), SIMDE_FLOAT64_C(    -7.46),
+      SIMDE_FLOAT64_C(   -31.47), SIMDE_FLOAT64_C(   -62.31), SIMDE_FLOAT64_C(   -75.24), SIMDE_FLOAT64_C(   -10.32),
+      SIMDE_FLOAT64_C(    -4.85), SIMDE_FLOAT64_C(    23.11), SIMDE_FLOAT64_C(   -27.02), SIMDE_FLOAT64_C(   -32.36),
+      SIMDE_FLOAT64_C(    71.39), SIMDE_FLOAT64_C(   -17.10), SIMDE_FLOAT64_C(    88.98), SIMDE_FLOAT64_C(   -43.91),
+      SIMDE_FLOAT64_C(   -31.05), SIMDE_FLOAT64_C(   -15.19), SIMDE_FLOAT64_C(   -53.88), SIMDE_FLOAT64_C(    40.09),
+      SIMDE_FLOAT64_C(    25.86), SIMDE_FLOAT64_C(    78.00), SIMDE_FLOAT64_C(   -44.59), SIMDE_FLOAT64_C(   -56.67),
+      SIMDE_FLOAT64_C(    20.29), SIMDE_FLOAT64_C(    -4.58), SIMDE_FLOAT64_C(     8.95), SIMDE_FLOAT64_C(    -4.78),
+      SIMDE_FLOAT64_C(    60.91), SIMDE_FLOAT64_C(    55.30), SIMDE_FLOAT64_C(   -36.45), SIMDE_FLOAT64_C(    81.77),
+      SIMDE_FLOAT64_C(    94.46), SIMDE_FLOAT64_C(    24.09), SIMDE_FLOAT64_C(   -25.69), SIMDE_FLOAT64_C(   -37.02),
+      SIMDE_FLOAT64_C(    61.78), SIMDE_FLOAT64_C(    -0.93), SIMDE_FLOAT64_C(    52.66), SIMDE_FLOAT64_C(   -43.07),
+      SIMDE_FLOAT64_C(   -77.82), SIMDE_FLOAT64_C(   -74.36), SIMDE_FLOAT64_C(    24.57), SIMDE_FLOAT64_C(    93.57),
+      SIMDE_FLOAT64_C(     8.54), SIMDE_FLOAT64_C(    13.55), SIMDE_FLOAT64_C(   -50.34), SIMDE_FLOAT64_C(    77.49),
+      SIMDE_FLOAT64_C(    98.35), SIMDE_FLOAT64_C(    -4.23), SIMDE_FLOAT64_C(    17.57), SIMDE_FLOAT64_C(    24.22),
+      SIMDE_FLOAT64_C(   -26.23), SIMDE_FLOAT64_C(    72.98), SIMDE_FLOAT64_C(    67.55), SIMDE_FLOAT64_C(    94.06),
+      SIMDE_FLOAT64_C(   -31.60), SIMDE_FLOAT64_C(   -23.50), SIMDE_FLOAT64_C(   -10.72), SIMDE_FLOAT64_C(   -70.68),
+      SIMDE_FLOAT64_C(   -68.20), SIMDE_FLOAT64_C(    52.83), SIMDE_FLOAT64_C(   -88.91), SIMDE_FLOAT64_C(   -73.74),
+      SIMDE_FLOAT64_C(   -23.08), SIMDE_FLOAT64_C(   -14.60), SIMDE_FLOAT64_C(   -10.76), SIMDE_FLOAT64_C(   -61.30),
+      SIMDE_FLOAT64_C(    84.48), SIMDE_FLOAT64_C(   -58.10), SIMDE_FLOAT64_C(    -4.38), SIMDE_FLOAT64_C(   -93.34),
+      SIMDE_FLOAT64_C(   -32.46), SIMDE_FLOAT64_C(   -79.81), SIMDE_FLOAT64_C(   -99.78), SIMDE_FLOAT64_C(    76.08),
+      SIMDE_FLOAT64_C(    33.74), SIMDE_FLOAT64_C(   -50.12), SIMDE_FLOAT64_C(    53.56), SIMDE_FLOAT64_C(    32.09),
+      SIMDE_FLOAT64_C(    45.65), SIMDE_FLOAT64_C(   -28.86), SIMDE_FLOAT64_C(   -43.69), SIMDE_FLOAT64_C(   -80.58),
+      SIMDE_FLOAT64_C(   -55.88), SIMDE_FLOAT64_C(   -76.13), SIMDE_FLOAT64_C(   -86.52), SIMDE_FLOAT64_C(    12.52),
+      SIMDE_FLOAT64_C(     0.37), SIMDE_FLOAT64_C(     2.76), SIMDE_FLOAT64_C(    41.84), SIMDE_FLOAT64_C(    32.17),
+      SIMDE_FLOAT64_C(   -44.40), SIMDE_FLOAT64_C(    52.93), SIMDE_FLOAT64_C(    58.43), SIMDE_FLOAT64_C(    32.52),
+      SIMDE_FLOAT64_C(   -61.67), SIMDE_FLOAT64_C(   -52.33), SIMDE_FLOAT64_C(    71.22), SIMDE_FLOAT64_C(   -77.19),
+      SIMDE_FLOAT64_C(   -10.43), SIMDE_FLOAT64_C(   -33.16), SIMDE_FLOAT64_C(   -70.54), SIMDE_FLOAT64_C(    57.10),
+      SIMDE_FLOAT64_C(   -12.96), SIMDE_FLOAT64_C(   -70.31), SIMDE_FLOAT64_C(    33.18), SIMDE_FLOAT64_C(   -79.22),
+      SIMDE_FLOAT64_C(   -20.43), SIMDE_FLOAT64_C(   -13.26), SIMDE_FLOAT64_C(    52.87), SIMDE_FLOAT64_C(   -74.78),
+      SIMDE_FLOAT64_C(    57.88), SIMDE_FLOAT64_C(   -90.82) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(   -75.92), SIMDE_FLOAT64_C(     2.89), SIMDE_FLOAT64_C( -1368.34), SIMDE_FLOAT64_C(    74.13),
+      SIMDE_FLOAT64_C(  2272.37), SIMDE_FLOAT64_C(  -246.32), SIMDE_FLOAT64_C(   -98.98), SIMDE_FLOAT64_C( -8775.53),
+      SIMDE_FLOAT64_C(   -17.55), SIMDE_FLOAT64_C(    72.79), SIMDE_FLOAT64_C( -3287.93), SIMDE_FLOAT64_C(   -64.50),
+      SIMDE_FLOAT64_C(   930.32), SIMDE_FLOAT64_C(    45.76), SIMDE_FLOAT64_C( -3728.66), SIMDE_FLOAT64_C(   -30.25),
+      SIMDE_FLOAT64_C(   -17.82), SIMDE_FLOAT64_C(   -86.63), SIMDE_FLOAT64_C(  5409.33), SIMDE_FLOAT64_C(   -21.12),
+      SIMDE_FLOAT64_C(  2000.27), SIMDE_FLOAT64_C( -2703.41), SIMDE_FLOAT64_C(    56.30), SIMDE_FLOAT64_C(   323.17),
+      SIMDE_FLOAT64_C(    95.95), SIMDE_FLOAT64_C(  2965.98), SIMDE_FLOAT64_C(    94.55), SIMDE_FLOAT64_C(    17.29),
+      SIMDE_FLOAT64_C(     3.40), SIMDE_FLOAT64_C(  4581.56), SIMDE_FLOAT64_C(    71.69), SIMDE_FLOAT64_C(    27.49),
+      SIMDE_FLOAT64_C(   -49.65), SIMDE_FLOAT64_C(    32.61), SIMDE_FLOAT64_C(     1.61), SIMDE_FLOAT64_C(    73.60),
+      SIMDE_FLOAT64_C(    64.46), SIMDE_FLOAT64_C(   129.75), SIMDE_FLOAT64_C( -5758.54), SIMDE_FLOAT64_C(  1608.03),
+      SIMDE_FLOAT64_C(  -298.30), SIMDE_FLOAT64_C( -6735.24), SIMDE_FLOAT64_C(  1140.83), SIMDE_FLOAT64_C(    58.21),
+      SIMDE_FLOAT64_C(    51.60), SIMDE_FLOAT64_C(  1946.15), SIMDE_FLOAT64_C(  1353.91), SIMDE_FLOAT64_C(  1949.15),
+      SIMDE_FLOAT64_C(  3837.05), SIMDE_FLOAT64_C(   -36.29), SIMDE_FLOAT64_C(  -835.97), SIMDE_FLOAT64_C(   -96.81),
+      SIMDE_FLOAT64_C(    98.65), SIMDE_FLOAT64_C(  2802.90), SIMDE_FLOAT64_C(    13.17), SIMDE_FLOAT64_C(  1637.93),
+      SIMDE_FLOAT64_C( -1910.06), SIMDE_FLOAT64_C(  -139.76), SIMDE_FLOAT64_C(  -480.02), SIMDE_FLOAT64_C( -6219.02),
+      SIMDE_FLOAT64_C(   -44.82), SIMDE_FLOAT64_C(   -16.42), SIMDE_FLOAT64_C(  3670.56), SIMDE_FLOAT64_C(     5.54),
+      SIMDE_FLOAT64_C( -4207.71), SIMDE_FLOAT64_C(  2765.39), SIMDE_FLOAT64_C(   -20.86), SIMDE_FLOAT64_C(    80.65),
+      SIMDE_FLOAT64_C(    64.75), SIMDE_FLOAT64_C(   -42.70), SIMDE_FLOAT64_C(  -389.76), SIMDE_FLOAT64_C(   798.73),
+      SIMDE_FLOAT64_C(   -36.86), SIMDE_FLOAT64_C(   337.12), SIMDE_FLOAT64_C(    98.38), SIMDE_FLOAT64_C(   -85.26),
+      SIMDE_FLOAT64_C( -4313.17), SIMDE_FLOAT64_C(   -73.67), SIMDE_FLOAT64_C( -2425.68), SIMDE_FLOAT64_C(  6738.13),
+      SIMDE_FLOAT64_C(   -14.25), SIMDE_FLOAT64_C(  4909.39), SIMDE_FLOAT64_C( -9044.62), SIMDE_FLOAT64_C(  -944.20),
+      SIMDE_FLOAT64_C(   -69.88), SIMDE_FLOAT64_C(    16.79), SIMDE_FLOAT64_C(   -21.01), SIMDE_FLOAT64_C( -4206.21),
+      SIMDE_FLOAT64_C( -5823.68), SIMDE_FLOAT64_C(  2930.91), SIMDE_FLOAT64_C( -7271.50), SIMDE_FLOAT64_C(   895.73),
+      SIMDE_FLOAT64_C(   -25.54), SIMDE_FLOAT64_C(    53.25), SIMDE_FLOAT64_C(  6237.48), SIMDE_FLOAT64_C(   516.10),
+      SIMDE_FLOAT64_C(   -84.64), SIMDE_FLOAT64_C(  -812.46), SIMDE_FLOAT64_C(   510.33), SIMDE_FLOAT64_C(  6816.28),
+      SIMDE_FLOAT64_C(    21.68), SIMDE_FLOAT64_C(    -1.14), SIMDE_FLOAT64_C(  2230.18), SIMDE_FLOAT64_C( -4942.19),
+      SIMDE_FLOAT64_C( -2919.78), SIMDE_FLOAT64_C( -1316.44), SIMDE_FLOAT64_C(    99.56), SIMDE_FLOAT64_C(    57.34),
+      SIMDE_FLOAT64_C(  3279.62), SIMDE_FLOAT64_C(  1772.09), SIMDE_FLOAT64_C(    57.77), SIMDE_FLOAT64_C( -1135.62),
+      SIMDE_FLOAT64_C(   -90.77), SIMDE_FLOAT64_C(  4104.64) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i])),
+      cv = simde_svld1_f64(pg, &(c[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmad_f64_m(pv, av, bv, cv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], c[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), c, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, cv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+    cv = simde_svld1_f64(pg, &(c[i]));
+
+    ev = simde_svmad_f64_m(pv, av, bv, cv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), c);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmad_f64_m)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
@@ -0,0 +1,9347 @@
+#define SIMDE_TEST_ARM_SVE_INSN max
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/max.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+
+static int
+test_simde_svmax_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C(   9),  INT8_C( 103),  INT8_C(  76), -INT8_C(  15), -INT8_C(   9), -INT8_C(  17), -INT8_C(  30),  INT8_C(  88),
+      -INT8_C(  69), -INT8_C( 103), -INT8_C(  42),  INT8_C(  33), -INT8_C(  70),  INT8_C(  20), -INT8_C( 101),  INT8_C(  13),
+      -INT8_C(  63), -INT8_C(  16),  INT8_C(   9),      INT8_MIN,  INT8_C(  20),  INT8_C( 111), -INT8_C(  26), -INT8_C(  63),
+       INT8_C(  88),  INT8_C(  12), -INT8_C(  44),  INT8_C( 111), -INT8_C(  49),  INT8_C(  37),  INT8_C(  67), -INT8_C(  40),
+      -INT8_C( 115), -INT8_C( 112), -INT8_C(  55), -INT8_C( 124),      INT8_MAX, -INT8_C(  85), -INT8_C(  36),  INT8_C(  58),
+       INT8_C(  68), -INT8_C(  77),  INT8_C(  92), -INT8_C(   1), -INT8_C(  57), -INT8_C(   9),  INT8_C(  12), -INT8_C( 119),
+      -INT8_C(  25),  INT8_C(  21),  INT8_C(   9), -INT8_C(   5), -INT8_C( 123), -INT8_C(  17), -INT8_C(  68), -INT8_C(  35),
+      -INT8_C(   5), -INT8_C( 112),  INT8_C(  76), -INT8_C(  54), -INT8_C(  74), -INT8_C( 113), -INT8_C(  94),  INT8_C(  67),
+       INT8_C(  31),  INT8_C( 108), -INT8_C(  57), -INT8_C(  97),  INT8_C(  23), -INT8_C(  92), -INT8_C(  39),  INT8_C(  92),
+       INT8_C(  87),  INT8_C(  53),  INT8_C(  91),  INT8_C(  30),  INT8_C(  45),  INT8_C( 103), -INT8_C(  89),  INT8_C(  20),
+       INT8_C( 125), -INT8_C(  80),  INT8_C(  16),  INT8_C(   2), -INT8_C(  97), -INT8_C(  52), -INT8_C(  33), -INT8_C( 102),
+       INT8_C(  93),  INT8_C(  43),  INT8_C( 100),  INT8_C(  19), -INT8_C(  70),  INT8_C(   7),  INT8_C(  86), -INT8_C(  38),
+       INT8_C( 115),  INT8_C(  29),  INT8_C( 121), -INT8_C( 118), -INT8_C(  63),  INT8_C(  82), -INT8_C(  26),  INT8_C(  24),
+      -INT8_C( 120),  INT8_C(  65),  INT8_C(  55), -INT8_C(  75), -INT8_C(  87), -INT8_C(  34), -INT8_C(  55),  INT8_C(  38),
+      -INT8_C( 113), -INT8_C(  39),  INT8_C(  40),  INT8_C(  46), -INT8_C(  90),  INT8_C(   7), -INT8_C(  55),  INT8_C(   3),
+       INT8_C(  50),  INT8_C(  45),  INT8_C(  22), -INT8_C(  20),  INT8_C(  52),  INT8_C( 108), -INT8_C(  58), -INT8_C(  89),
+      -INT8_C( 119),  INT8_C(  63),  INT8_C(  50),  INT8_C(  75), -INT8_C( 110),  INT8_C(  24),  INT8_C(  99),  INT8_C(  26),
+       INT8_C(  90), -INT8_C( 102), -INT8_C(  49),  INT8_C(   3),  INT8_C( 121), -INT8_C( 104),  INT8_C(  41),  INT8_C(   8),
+       INT8_C( 114),  INT8_C(  81),  INT8_C(  54),  INT8_C(  24),  INT8_C(  88), -INT8_C(   1),  INT8_C(  27), -INT8_C( 118),
+       INT8_C(  45),  INT8_C(  49),  INT8_C( 118),  INT8_C(  97), -INT8_C(  99),  INT8_C(  61),  INT8_C(   9),  INT8_C(  38),
+       INT8_C( 124),  INT8_C(  59),  INT8_C( 113),  INT8_C(  14),  INT8_C(  83), -INT8_C(  43),  INT8_C(  40), -INT8_C(  83),
+       INT8_C( 111), -INT8_C(   9), -INT8_C(  80), -INT8_C(  24), -INT8_C( 112), -INT8_C(  39), -INT8_C(  16),  INT8_C(   2),
+       INT8_C(  42),  INT8_C(  39),  INT8_C(  26), -INT8_C( 126),  INT8_C(  38),  INT8_C(  53),  INT8_C(  12),  INT8_C(  83),
+       INT8_C( 102), -INT8_C( 125), -INT8_C(  75),  INT8_C(   3), -INT8_C(  64), -INT8_C(  66),  INT8_C(  41),  INT8_C(  60),
+      -INT8_C(   7), -INT8_C( 101),  INT8_C(  75),  INT8_C(  76),  INT8_C( 112),  INT8_C( 115), -INT8_C(   6), -INT8_C(  33),
+       INT8_C( 107), -INT8_C(  86), -INT8_C(  56), -INT8_C(   5), -INT8_C( 124), -INT8_C(  72), -INT8_C(   3), -INT8_C(  82),
+      -INT8_C(  33),  INT8_C(  23),  INT8_C(  49),  INT8_C(   6),  INT8_C(  76),  INT8_C(  61),  INT8_C(  89), -INT8_C(  78),
+      -INT8_C(  64),  INT8_C(  14), -INT8_C(  75),      INT8_MIN, -INT8_C(  52), -INT8_C(  34), -INT8_C(  67), -INT8_C(  59),
+       INT8_C( 121),  INT8_C(   8),  INT8_C(  18), -INT8_C(  23),  INT8_C( 123),  INT8_C(  12), -INT8_C(  55), -INT8_C(  26),
+      -INT8_C(  74), -INT8_C( 111), -INT8_C(  31),  INT8_C(  58),  INT8_C(  73), -INT8_C(  34), -INT8_C(  23),  INT8_C(  41),
+      -INT8_C(  11),  INT8_C(  26),  INT8_C(  47),  INT8_C(  65),  INT8_C(  87), -INT8_C( 120), -INT8_C(  13),  INT8_C(  24),
+      -INT8_C( 105), -INT8_C(  88), -INT8_C( 104),  INT8_C(  99), -INT8_C( 121),  INT8_C(  85),  INT8_C(  41),  INT8_C(   0),
+       INT8_C(  93),  INT8_C(  59), -INT8_C(  22), -INT8_C(  39),  INT8_C(  71), -INT8_C(  77), -INT8_C(  65), -INT8_C(   3),
+       INT8_C(  68), -INT8_C(  95),  INT8_C(  56), -INT8_C( 115),      INT8_MAX,  INT8_C(  33), -INT8_C(  74),  INT8_C( 117),
+       INT8_C(  59), -INT8_C(  27), -INT8_C(  74), -INT8_C( 110),  INT8_C( 110), -INT8_C(  86), -INT8_C(  86),  INT8_C(   5),
+       INT8_C(  82),  INT8_C(  67),  INT8_C( 104), -INT8_C(  39), -INT8_C( 104), -INT8_C( 111), -INT8_C(  38), -INT8_C(  10),
+      -INT8_C(  52), -INT8_C(  60), -INT8_C(  49),  INT8_C(  19),  INT8_C( 119), -INT8_C( 114),  INT8_C(  17), -INT8_C(  69),
+       INT8_C(  47),  INT8_C(  73),  INT8_C(  72), -INT8_C(  81),  INT8_C( 106), -INT8_C(   1),  INT8_C(  36), -INT8_C(  91),
+      -INT8_C(  28), -INT8_C(  38),  INT8_C(  55),  INT8_C(  82), -INT8_C( 124), -INT8_C(  30),  INT8_C(  87), -INT8_C(  41),
+       INT8_C(  37), -INT8_C(  64), -INT8_C(  80), -INT8_C(  67),  INT8_C(  81), -INT8_C( 118), -INT8_C(  77),  INT8_C(  30),
+       INT8_C(  78), -INT8_C( 126),  INT8_C(  49), -INT8_C(  59),  INT8_C(  17),  INT8_C(  66),      INT8_MIN,  INT8_C(  64),
+      -INT8_C( 117), -INT8_C(  55), -INT8_C(  17), -INT8_C(  11), -INT8_C(  56),  INT8_C(  19), -INT8_C( 102), -INT8_C(  84),
+      -INT8_C(  18), -INT8_C(  46), -INT8_C(   1),  INT8_C( 114), -INT8_C(  76),  INT8_C(  86),  INT8_C(  73), -INT8_C(  39),
+       INT8_C(  22), -INT8_C(   6), -INT8_C( 106),  INT8_C( 104), -INT8_C( 124),  INT8_C(  74), -INT8_C( 122), -INT8_C(  45),
+      -INT8_C(  52), -INT8_C(  73), -INT8_C( 104), -INT8_C(  35), -INT8_C(   6),  INT8_C(  25),  INT8_C(  30), -INT8_C( 123),
+      -INT8_C(  30),  INT8_C(  13),  INT8_C( 123), -INT8_C(  86),  INT8_C(  33),  INT8_C(  21),  INT8_C(  86),  INT8_C(  15),
+      -INT8_C(  25),  INT8_C(  85), -INT8_C( 127), -INT8_C( 101), -INT8_C(  84), -INT8_C(  53),  INT8_C( 116), -INT8_C(  62),
+      -INT8_C(  59),  INT8_C(  11),  INT8_C(  42),  INT8_C(  73),  INT8_C(  85), -INT8_C(  80),  INT8_C(  28),  INT8_C(  33),
+       INT8_C( 104), -INT8_C(  75), -INT8_C(   1),  INT8_C(  98), -INT8_C(  50),  INT8_C(  29), -INT8_C(  25), -INT8_C(  80),
+       INT8_C(  42),  INT8_C(  98),  INT8_C(  90),  INT8_C(  75),  INT8_C( 120), -INT8_C(  80),  INT8_C(  90),  INT8_C(  95),
+       INT8_C(   6), -INT8_C(  36), -INT8_C(   5), -INT8_C(  78), -INT8_C(  89),  INT8_C( 111),  INT8_C( 116),  INT8_C( 108),
+       INT8_C( 122), -INT8_C(  97), -INT8_C(  75), -INT8_C(  49),  INT8_C(  79), -INT8_C(  46), -INT8_C(  15), -INT8_C(  73),
+      -INT8_C( 121), -INT8_C(  16),  INT8_C(  25),  INT8_C(  85),  INT8_C(  13),  INT8_C(   1),  INT8_C(   5),  INT8_C(  55),
+       INT8_C(  99),  INT8_C(  95), -INT8_C( 125), -INT8_C(  37),  INT8_C(  15), -INT8_C(  35),  INT8_C(  59),  INT8_C(  21),
+      -INT8_C(  71),  INT8_C(  54), -INT8_C(  57),  INT8_C(  96), -INT8_C(  91),  INT8_C(  60), -INT8_C(  52),  INT8_C(  32),
+      -INT8_C(  37), -INT8_C( 126), -INT8_C(  17),  INT8_C(  42),  INT8_C(  84), -INT8_C(  32), -INT8_C(  30), -INT8_C(  37),
+      -INT8_C(  48), -INT8_C(   5),  INT8_C(  48), -INT8_C(  35), -INT8_C(   4),  INT8_C(  53),  INT8_C(  21),  INT8_C(  96),
+      -INT8_C( 108), -INT8_C( 104),  INT8_C(  59), -INT8_C(  93),  INT8_C( 117),  INT8_C( 118), -INT8_C(  71),  INT8_C(  47),
+      -INT8_C(  84),      INT8_MIN, -INT8_C( 113),  INT8_C(  82), -INT8_C(  68),  INT8_C(  92),  INT8_C( 114), -INT8_C( 105),
+      -INT8_C(  34),  INT8_C(  97), -INT8_C(  62),  INT8_C(  50),  INT8_C(  66), -INT8_C(  92),  INT8_C(  13),  INT8_C(  18),
+      -INT8_C(  97),  INT8_C(  61), -INT8_C(  16), -INT8_C( 100),  INT8_C( 114),  INT8_C(   5), -INT8_C(   4),  INT8_C(   6),
+      -INT8_C(  99),  INT8_C(  55), -INT8_C(  87),  INT8_C(  18), -INT8_C(  82),  INT8_C(  98),  INT8_C(  65),  INT8_C(  90),
+      -INT8_C(  29), -INT8_C(  47), -INT8_C(  84), -INT8_C(  97),  INT8_C(  45),  INT8_C(  30),  INT8_C(  55),  INT8_C(  11),
+           INT8_MIN, -INT8_C(   7),  INT8_C(  61), -INT8_C(  62), -INT8_C(  99),  INT8_C(  74), -INT8_C(  44),  INT8_C(  60),
+      -INT8_C( 121), -INT8_C(  60), -INT8_C(  40), -INT8_C(   7), -INT8_C(  55), -INT8_C(  44), -INT8_C(   1),  INT8_C( 102),
+       INT8_C(  12), -INT8_C(  88),  INT8_C( 121), -INT8_C(  70),  INT8_C(  11), -INT8_C(  70),  INT8_C(  20), -INT8_C(  18),
+      -INT8_C( 117), -INT8_C(  63), -INT8_C( 115), -INT8_C(  72), -INT8_C(  33), -INT8_C(  60), -INT8_C(  61),  INT8_C(  95),
+      -INT8_C(  67),  INT8_C(   0),  INT8_C(  33),  INT8_C(  90),  INT8_C(  74), -INT8_C(  10), -INT8_C( 105), -INT8_C(  47),
+      -INT8_C(  70),  INT8_C( 111), -INT8_C(  54), -INT8_C( 124),  INT8_C(  68), -INT8_C(  55), -INT8_C(  22),  INT8_C(  80),
+       INT8_C( 114),  INT8_C(  99),  INT8_C(  10),  INT8_C( 125),  INT8_C(  30),  INT8_C(  30),  INT8_C( 107), -INT8_C(  87),
+      -INT8_C(  33), -INT8_C(   8),  INT8_C(  98), -INT8_C(  65), -INT8_C(  67),  INT8_C(  37),  INT8_C(  30),  INT8_C( 122),
+       INT8_C(  38),  INT8_C(  64), -INT8_C(  43),  INT8_C( 112),  INT8_C(  54) };
+  static const int8_t b[] =
+    { -INT8_C( 109),  INT8_C(   5),  INT8_C(  40),  INT8_C(  80),  INT8_C(  26),  INT8_C(  24), -INT8_C( 120),  INT8_C(  43),
+       INT8_C( 124),  INT8_C(  29), -INT8_C( 118),  INT8_C(  14), -INT8_C(  72),  INT8_C(  95), -INT8_C(  39),  INT8_C(  26),
+      -INT8_C(   2),  INT8_C(  69),  INT8_C(  42),  INT8_C( 100),  INT8_C(  65),  INT8_C(   5),  INT8_C(  24), -INT8_C( 112),
+      -INT8_C(   2), -INT8_C( 119),  INT8_C(  11),  INT8_C(  79),  INT8_C(  94),  INT8_C(  28), -INT8_C(  43), -INT8_C(  15),
+       INT8_C(  33), -INT8_C(   3),  INT8_C(  65),  INT8_C(  59),  INT8_C(  21), -INT8_C(  54),  INT8_C( 102), -INT8_C( 111),
+      -INT8_C(  25), -INT8_C(  15), -INT8_C(  97), -INT8_C(  97),  INT8_C(  80),  INT8_C( 120), -INT8_C(  70),  INT8_C(  78),
+      -INT8_C(  67), -INT8_C(  28), -INT8_C(  78), -INT8_C(   1), -INT8_C(  22), -INT8_C(  53), -INT8_C( 113), -INT8_C(  24),
+       INT8_C(  84), -INT8_C( 102),  INT8_C(  55), -INT8_C(  78), -INT8_C(  74),  INT8_C(  12), -INT8_C(  93), -INT8_C(  41),
+       INT8_C(   9), -INT8_C(  27),  INT8_C(  18),  INT8_C(  30), -INT8_C(  81),  INT8_C( 120), -INT8_C(  81), -INT8_C( 106),
+       INT8_C( 105),  INT8_C(  78),  INT8_C(  54), -INT8_C(  70), -INT8_C(  57), -INT8_C(  16),  INT8_C(   8), -INT8_C( 124),
+      -INT8_C(  44), -INT8_C(  69), -INT8_C( 125), -INT8_C(  66), -INT8_C( 122),  INT8_C(  18), -INT8_C(  89), -INT8_C(  38),
+      -INT8_C(  84), -INT8_C(  34), -INT8_C( 115),  INT8_C(  98), -INT8_C(  21),  INT8_C(  48),  INT8_C(  57), -INT8_C(  12),
+       INT8_C(  21),  INT8_C(  75),  INT8_C(  19), -INT8_C(  60), -INT8_C(  60), -INT8_C(  62),  INT8_C(  91),  INT8_C(  45),
+       INT8_C(  17), -INT8_C( 111), -INT8_C(  25), -INT8_C(  40), -INT8_C( 127), -INT8_C(  16),  INT8_C(  92),  INT8_C(  85),
+      -INT8_C(  85), -INT8_C(  32),  INT8_C(  20),  INT8_C(  49), -INT8_C(  14), -INT8_C(  69),  INT8_C(  11), -INT8_C(  97),
+      -INT8_C( 103), -INT8_C( 104),  INT8_C(   1), -INT8_C( 124), -INT8_C(  55),  INT8_C(  59),  INT8_C( 121), -INT8_C(  34),
+      -INT8_C( 122), -INT8_C( 116), -INT8_C(  93),  INT8_C(  74),  INT8_C(  78), -INT8_C(   2),  INT8_C( 120),  INT8_C(  95),
+      -INT8_C( 113),  INT8_C(  95),  INT8_C(  55),  INT8_C(  16),  INT8_C(  79), -INT8_C( 108),  INT8_C( 101), -INT8_C(   6),
+       INT8_C( 116),  INT8_C( 121),  INT8_C(  43),  INT8_C( 102),  INT8_C(  52),  INT8_C(  55),  INT8_C(   5), -INT8_C(  50),
+      -INT8_C(  49),  INT8_C(   7),  INT8_C(  82), -INT8_C( 104),  INT8_C(  66), -INT8_C(  53),  INT8_C( 119), -INT8_C(  56),
+       INT8_C(  87),  INT8_C(  26),  INT8_C(  19), -INT8_C(  90),  INT8_C(  24), -INT8_C( 117),  INT8_C(   5), -INT8_C(  89),
+      -INT8_C(  22),  INT8_C(  61), -INT8_C(  73),  INT8_C(  58), -INT8_C(  47),  INT8_C(  28),  INT8_C(  52),  INT8_C(  69),
+      -INT8_C( 106),  INT8_C(  96), -INT8_C(  85), -INT8_C(  54), -INT8_C( 105), -INT8_C(  79), -INT8_C( 104),  INT8_C( 102),
+      -INT8_C(  72), -INT8_C(  21), -INT8_C(   1), -INT8_C(   6), -INT8_C(  74),  INT8_C( 118), -INT8_C(  62),  INT8_C(  14),
+      -INT8_C( 112), -INT8_C(  43), -INT8_C(  76), -INT8_C(  88),  INT8_C(  96), -INT8_C(  71),  INT8_C(  79),  INT8_C(  75),
+      -INT8_C(  10),  INT8_C(   6), -INT8_C( 123), -INT8_C(  57),  INT8_C(  34), -INT8_C(  71),  INT8_C(  12), -INT8_C(  72),
+       INT8_C(  25), -INT8_C(  72), -INT8_C( 125), -INT8_C(  80),  INT8_C( 105),  INT8_C(  27),  INT8_C(  23),  INT8_C(  33),
+       INT8_C(   6),  INT8_C(  22),  INT8_C(  27), -INT8_C(  67), -INT8_C( 116), -INT8_C(  35), -INT8_C(  53),  INT8_C(  28),
+      -INT8_C(  77),      INT8_MAX, -INT8_C(  60),  INT8_C(  19),  INT8_C(  56),  INT8_C(  19),  INT8_C(  94),  INT8_C(  47),
+       INT8_C(  25), -INT8_C(  29), -INT8_C(  10),  INT8_C(  59), -INT8_C(  99),  INT8_C(   3), -INT8_C(  12), -INT8_C(  74),
+      -INT8_C(  69),  INT8_C( 119),  INT8_C( 103),  INT8_C(  36), -INT8_C( 110),  INT8_C( 126),  INT8_C(  69), -INT8_C( 103),
+      -INT8_C( 108),  INT8_C(  96),  INT8_C(  86),  INT8_C(  32),  INT8_C(  61),  INT8_C(  33),  INT8_C(  60), -INT8_C(  16),
+      -INT8_C(  96),  INT8_C(   0),  INT8_C(   4), -INT8_C(  40),  INT8_C(  19),  INT8_C(  98),  INT8_C(   7),  INT8_C(  44),
+       INT8_C(  70), -INT8_C(   2),  INT8_C( 103), -INT8_C(  29),  INT8_C(   1),  INT8_C(  91), -INT8_C( 103), -INT8_C(  68),
+      -INT8_C(  46),  INT8_C(   0), -INT8_C(  32),  INT8_C( 101),  INT8_C( 126),  INT8_C(  37), -INT8_C(   2),  INT8_C(  18),
+      -INT8_C( 123),  INT8_C(  84),  INT8_C(  50), -INT8_C(  62),  INT8_C( 117),  INT8_C( 110), -INT8_C(  77),  INT8_C(  21),
+       INT8_C( 110), -INT8_C(  73), -INT8_C(  19), -INT8_C( 127),  INT8_C(  25), -INT8_C(  11), -INT8_C(  83),  INT8_C(  95),
+      -INT8_C(  13),  INT8_C(  21),  INT8_C(  66), -INT8_C(  12),  INT8_C( 112), -INT8_C(  36), -INT8_C(  80),  INT8_C(  67),
+      -INT8_C(  36), -INT8_C( 112), -INT8_C(  88),  INT8_C(  91), -INT8_C(  75), -INT8_C(  90),  INT8_C( 109),  INT8_C(  58),
+      -INT8_C(   6), -INT8_C(  96), -INT8_C(   4),  INT8_C( 111),  INT8_C(  14), -INT8_C(  81), -INT8_C( 124),  INT8_C( 125),
+       INT8_C( 102),  INT8_C( 113), -INT8_C(   2),      INT8_MIN,  INT8_C( 102), -INT8_C(  84), -INT8_C(  33),  INT8_C(  89),
+      -INT8_C(  63),  INT8_C(  34),  INT8_C(  77),  INT8_C(  49), -INT8_C(   2), -INT8_C(   3),  INT8_C( 116), -INT8_C(  38),
+      -INT8_C( 115),  INT8_C(  28),  INT8_C(  53),  INT8_C(  66), -INT8_C(  62), -INT8_C(  93),  INT8_C( 124), -INT8_C(  68),
+       INT8_C(  67),  INT8_C( 121),  INT8_C(  43),  INT8_C(  81),  INT8_C(  40), -INT8_C(  81), -INT8_C(  50), -INT8_C( 113),
+       INT8_C(  33), -INT8_C(  51),  INT8_C(  15), -INT8_C( 121),  INT8_C( 121), -INT8_C(  18), -INT8_C(  31),  INT8_C(  58),
+       INT8_C(  16),  INT8_C(  46),  INT8_C( 107),  INT8_C(  14),  INT8_C(  44), -INT8_C(  32), -INT8_C(  23), -INT8_C(  71),
+      -INT8_C(   4),  INT8_C(  30), -INT8_C(   4), -INT8_C(  65), -INT8_C(  63),  INT8_C( 120),  INT8_C( 123),  INT8_C(   4),
+      -INT8_C(  15), -INT8_C(  89),  INT8_C(  86),  INT8_C(  26),  INT8_C(  86),  INT8_C(  36), -INT8_C(  87),  INT8_C( 119),
+      -INT8_C(  15), -INT8_C(  72), -INT8_C(   1),  INT8_C( 106), -INT8_C(  90), -INT8_C(  32), -INT8_C(  92), -INT8_C(  73),
+       INT8_C(  14),  INT8_C(  16), -INT8_C(  59),  INT8_C(  58), -INT8_C(  16), -INT8_C(  82), -INT8_C(  12), -INT8_C(  20),
+      -INT8_C(  51), -INT8_C(  16), -INT8_C(  85), -INT8_C( 114),  INT8_C( 104),  INT8_C(  39), -INT8_C( 109),  INT8_C(  90),
+      -INT8_C(  50), -INT8_C(  23),  INT8_C( 116),  INT8_C(  36),  INT8_C(  13),  INT8_C(  29), -INT8_C( 100), -INT8_C(   1),
+      -INT8_C(  43), -INT8_C( 101),  INT8_C( 105),  INT8_C( 123),  INT8_C( 123),  INT8_C(  14),  INT8_C(  50), -INT8_C( 119),
+       INT8_C(  30), -INT8_C(   8), -INT8_C(  60),  INT8_C(  14), -INT8_C(  90), -INT8_C(  72), -INT8_C(   6),  INT8_C( 115),
+      -INT8_C(  88), -INT8_C(  90),  INT8_C(   2),  INT8_C(  16), -INT8_C(  51), -INT8_C( 107),  INT8_C( 106), -INT8_C( 101),
+       INT8_C( 126), -INT8_C(  34), -INT8_C(  65), -INT8_C( 117), -INT8_C(   5),  INT8_C(  91), -INT8_C( 118), -INT8_C(  48),
+      -INT8_C(  10), -INT8_C(  12),  INT8_C(  76),  INT8_C( 113),  INT8_C(   2),  INT8_C( 126), -INT8_C(   5),  INT8_C(  32),
+       INT8_C( 118), -INT8_C(  65),  INT8_C(  46),  INT8_C(  29),  INT8_C( 119),  INT8_C(  40), -INT8_C( 112),  INT8_C(  31),
+      -INT8_C(  50), -INT8_C( 110),  INT8_C(  47), -INT8_C( 101),  INT8_C(  39), -INT8_C( 102),  INT8_C(  54), -INT8_C(  91),
+       INT8_C( 120), -INT8_C(  10),  INT8_C(  49),  INT8_C( 116),  INT8_C(  81), -INT8_C(  69),  INT8_C(  68),  INT8_C(  72),
+      -INT8_C(  81), -INT8_C( 112), -INT8_C(  71), -INT8_C(  79),  INT8_C(  15), -INT8_C(  76), -INT8_C(  47), -INT8_C( 123),
+       INT8_C( 115), -INT8_C(   1), -INT8_C(  94), -INT8_C(  22),  INT8_C(  40),  INT8_C(  51),  INT8_C(   9), -INT8_C(  10),
+      -INT8_C(  59),  INT8_C(  57), -INT8_C( 110), -INT8_C(  19), -INT8_C(  45), -INT8_C(  56), -INT8_C( 110),  INT8_C(  75),
+      -INT8_C(  66), -INT8_C(  61), -INT8_C(  65),  INT8_C(  16),      INT8_MAX,  INT8_C(   4),  INT8_C(  88),  INT8_C(  46),
+      -INT8_C( 108),  INT8_C(  17), -INT8_C(  32), -INT8_C(  93), -INT8_C(  58), -INT8_C(  79),  INT8_C(  41),  INT8_C(  57),
+      -INT8_C(  79), -INT8_C(  53),  INT8_C(  36), -INT8_C(  39), -INT8_C(   2),  INT8_C(  45), -INT8_C(  49), -INT8_C(  60),
+       INT8_C( 102),  INT8_C(  97), -INT8_C(  79),  INT8_C(  57),  INT8_C(  42),  INT8_C(  67), -INT8_C( 123), -INT8_C(  24),
+       INT8_C(   7),  INT8_C(  68), -INT8_C(   8), -INT8_C( 122),  INT8_C(  72),  INT8_C(  80), -INT8_C(  76), -INT8_C(  35),
+       INT8_C(  98), -INT8_C( 108),      INT8_MIN,  INT8_C(  40),  INT8_C(  70), -INT8_C(  87),  INT8_C(  97), -INT8_C(   9),
+       INT8_C( 117), -INT8_C( 123), -INT8_C(  48),  INT8_C( 115), -INT8_C(  77), -INT8_C(  97),  INT8_C(  55),  INT8_C(  25),
+       INT8_C(   1), -INT8_C(  24),  INT8_C(  83),  INT8_C(  43),  INT8_C(  44), -INT8_C(  40),  INT8_C(  19),  INT8_C(  51),
+       INT8_C(  28),  INT8_C(  12), -INT8_C(  71),  INT8_C( 101),  INT8_C(  92) };
+  static const int8_t e[] =
+    {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(  24), -INT8_C(  30),  INT8_C(  88),
+       INT8_C( 124),  INT8_C(  29), -INT8_C(  42),  INT8_C(  33), -INT8_C(  70),  INT8_C(  95), -INT8_C(  39),  INT8_C(   0),
+      -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C(  63),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0),  INT8_C(  94),  INT8_C(   0),  INT8_C(  67),  INT8_C(   0),
+       INT8_C(  33),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX, -INT8_C(  54),  INT8_C( 102),  INT8_C(  58),
+       INT8_C(   0), -INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(  12),  INT8_C(  78),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   9), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  76),  INT8_C(   0), -INT8_C(  74),  INT8_C(  12),  INT8_C(   0),  INT8_C(  67),
+       INT8_C(  31),  INT8_C(   0),  INT8_C(  18),  INT8_C(  30),  INT8_C(   0),  INT8_C( 120),  INT8_C(   0),  INT8_C(  92),
+       INT8_C( 105),  INT8_C(  78),  INT8_C(  91),  INT8_C(  30),  INT8_C(  45),  INT8_C(   0),  INT8_C(   0),  INT8_C(  20),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   2), -INT8_C(  97),  INT8_C(   0), -INT8_C(  33), -INT8_C(  38),
+       INT8_C(   0),  INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  75),  INT8_C( 121),  INT8_C(   0), -INT8_C(  60),  INT8_C(   0),  INT8_C(  91),  INT8_C(   0),
+       INT8_C(  17),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  85), -INT8_C(  32),  INT8_C(  40),  INT8_C(   0), -INT8_C(  14),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  50),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  34),
+      -INT8_C( 119),  INT8_C(   0),  INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(  24),  INT8_C( 120),  INT8_C(  95),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 101),  INT8_C(   0),
+       INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50),
+       INT8_C(   0),  INT8_C(   0),  INT8_C( 118),  INT8_C(  97),  INT8_C(  66),  INT8_C(  61),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 124),  INT8_C(   0),  INT8_C( 113),  INT8_C(   0),  INT8_C(  83), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 111),  INT8_C(   0), -INT8_C(  73),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  54),  INT8_C(  38),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 102),  INT8_C(   0), -INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C( 118),  INT8_C(  41),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  43),  INT8_C(   0),  INT8_C(  76),  INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   6), -INT8_C(  56), -INT8_C(   5),  INT8_C(  34), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  23),  INT8_C(  49),  INT8_C(   0),  INT8_C( 105),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33),
+       INT8_C(   6),  INT8_C(  22),  INT8_C(   0), -INT8_C(  67), -INT8_C(  52),  INT8_C(   0), -INT8_C(  53),  INT8_C(  28),
+       INT8_C(   0),      INT8_MAX,  INT8_C(  18),  INT8_C(  19),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  25), -INT8_C(  29),  INT8_C(   0),  INT8_C(  59),  INT8_C(  73),  INT8_C(   3), -INT8_C(  12),  INT8_C(  41),
+       INT8_C(   0),  INT8_C( 119),  INT8_C( 103),  INT8_C(   0),  INT8_C(  87),  INT8_C( 126),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 105),  INT8_C(   0),  INT8_C(   0),  INT8_C(  99),  INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(  98),  INT8_C(   7),  INT8_C(   0),
+       INT8_C(  70), -INT8_C(   2),  INT8_C( 103),  INT8_C(   0),      INT8_MAX,  INT8_C(   0), -INT8_C(  74),  INT8_C( 117),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  32),  INT8_C( 101),  INT8_C( 126),  INT8_C(  37),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C( 117),  INT8_C( 110),  INT8_C(   0),  INT8_C(  21),
+       INT8_C( 110), -INT8_C(  60), -INT8_C(  19),  INT8_C(   0),  INT8_C( 119),  INT8_C(   0),  INT8_C(  17),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  72), -INT8_C(  12),  INT8_C( 112), -INT8_C(   1),  INT8_C(  36),  INT8_C(  67),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  55),  INT8_C(  91),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  81), -INT8_C(  81), -INT8_C(  77),  INT8_C( 125),
+       INT8_C(   0),  INT8_C( 113),  INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66), -INT8_C(  33),  INT8_C(   0),
+      -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(  49), -INT8_C(   2),  INT8_C(  19),  INT8_C( 116),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  39),
+       INT8_C(  67),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),  INT8_C(   0), -INT8_C(  45),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 121),  INT8_C(  25),  INT8_C(  30),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  14),  INT8_C(   0),  INT8_C(  21),  INT8_C(  86),  INT8_C(   0),
+      -INT8_C(   4),  INT8_C(  85),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 120),  INT8_C( 123),  INT8_C(   4),
+      -INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86),  INT8_C(   0),  INT8_C(  28),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  72), -INT8_C(   1),  INT8_C(   0), -INT8_C(  50),  INT8_C(  29), -INT8_C(  25), -INT8_C(  73),
+       INT8_C(  42),  INT8_C(  98),  INT8_C(  90),  INT8_C(  75),  INT8_C(   0),  INT8_C(   0),  INT8_C(  90),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),
+       INT8_C(   0), -INT8_C(  23),  INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  43),  INT8_C(   0),  INT8_C( 105),  INT8_C(   0),  INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  99),  INT8_C(  95),  INT8_C(   0),  INT8_C(  14),  INT8_C(   0), -INT8_C(  35),  INT8_C(   0),  INT8_C( 115),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  60),  INT8_C(   0),  INT8_C(  32),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  30), -INT8_C(  37),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 113),  INT8_C(   0),  INT8_C(   0),  INT8_C(  21),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  65),  INT8_C(  59),  INT8_C(   0),  INT8_C( 119),  INT8_C( 118), -INT8_C(  71),  INT8_C(  47),
+       INT8_C(   0), -INT8_C( 110),  INT8_C(   0),  INT8_C(  82),  INT8_C(  39),  INT8_C(   0),  INT8_C(   0), -INT8_C(  91),
+       INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C(  68),  INT8_C(   0),
+      -INT8_C(  81),  INT8_C(  61), -INT8_C(  16), -INT8_C(  79),  INT8_C(   0),  INT8_C(   5), -INT8_C(   4),  INT8_C(   6),
+       INT8_C( 115),  INT8_C(  55), -INT8_C(  87),  INT8_C(   0),  INT8_C(  40),  INT8_C(  98),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  29),  INT8_C(  57), -INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  75),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  61),  INT8_C(  16),      INT8_MAX,  INT8_C(   0),  INT8_C(  88),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  17),  INT8_C(   0), -INT8_C(   7), -INT8_C(  55),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  12), -INT8_C(  53),  INT8_C( 121), -INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(  20), -INT8_C(  18),
+       INT8_C( 102),  INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  95),
+       INT8_C(   7),  INT8_C(  68),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  98),  INT8_C( 111), -INT8_C(  54),  INT8_C(   0),  INT8_C(  70), -INT8_C(  55),  INT8_C(  97),  INT8_C(  80),
+       INT8_C( 117),  INT8_C(   0),  INT8_C(   0),  INT8_C( 125),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  30),  INT8_C( 122),
+       INT8_C(  38),  INT8_C(  64),  INT8_C(   0),  INT8_C( 112),  INT8_C(  92) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_s8_z(pv, av, bv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+
+    ev = simde_svmax_s8_z(pv, av, bv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0) };
+  static const int8_t a[] =
+    { -INT8_C( 117),  INT8_C(  65),  INT8_C(   1),  INT8_C(  25), -INT8_C(  72),  INT8_C(  28),  INT8_C( 121),  INT8_C(  36),
+       INT8_C( 124), -INT8_C( 116), -INT8_C(  52),  INT8_C(  32),  INT8_C(   0), -INT8_C(  24),  INT8_C(  92),  INT8_C(   1),
+      -INT8_C(  17),  INT8_C(  62),  INT8_C( 104), -INT8_C( 104), -INT8_C( 123),  INT8_C( 116), -INT8_C(  38), -INT8_C(  45),
+      -INT8_C(  10),  INT8_C(  47),  INT8_C(  33), -INT8_C(  84),  INT8_C(  48),  INT8_C(  98),  INT8_C(  80), -INT8_C(  69),
+      -INT8_C(  93),  INT8_C(  81), -INT8_C(  44),  INT8_C(  91),  INT8_C( 109),  INT8_C(  78),      INT8_MAX, -INT8_C(  23),
+      -INT8_C(  38),  INT8_C(  75),  INT8_C(   9), -INT8_C(  38),  INT8_C(  52),  INT8_C( 102), -INT8_C(  37),  INT8_C(  35),
+      -INT8_C(  92),  INT8_C(  67), -INT8_C(  69),  INT8_C(  41), -INT8_C(  73), -INT8_C( 106), -INT8_C(   4), -INT8_C(  83),
+      -INT8_C(  59),  INT8_C(  30),  INT8_C(  89), -INT8_C(  11),      INT8_MIN, -INT8_C(  87), -INT8_C(  80),  INT8_C(  35),
+      -INT8_C(   5), -INT8_C( 124),  INT8_C( 126),  INT8_C( 104), -INT8_C(  46), -INT8_C(   3),  INT8_C(  82), -INT8_C(  84),
+       INT8_C(  73),  INT8_C(  91), -INT8_C( 122),  INT8_C( 125), -INT8_C(  63),  INT8_C(  97), -INT8_C(  96),  INT8_C( 101),
+      -INT8_C(  92),  INT8_C(  91), -INT8_C( 114),  INT8_C(  91), -INT8_C(  15), -INT8_C( 117),  INT8_C(   9), -INT8_C(  74),
+      -INT8_C(  87),  INT8_C(  98), -INT8_C(  85),  INT8_C(  41),  INT8_C(  12),  INT8_C(  91),  INT8_C(  76),  INT8_C(   7),
+      -INT8_C(  32), -INT8_C(  54),  INT8_C( 111), -INT8_C(  78), -INT8_C(  57), -INT8_C(  63),  INT8_C(  95),  INT8_C(  16),
+       INT8_C(  29), -INT8_C(  27), -INT8_C( 115), -INT8_C(  34),  INT8_C(  71),  INT8_C(  45),  INT8_C(  68), -INT8_C(  21),
+      -INT8_C( 119), -INT8_C(  46),  INT8_C(  71),  INT8_C( 122),  INT8_C(  93),  INT8_C(  80),  INT8_C(  49),  INT8_C(   6),
+      -INT8_C(  78), -INT8_C(  36),  INT8_C(  47), -INT8_C(  66),  INT8_C(  56),  INT8_C( 123), -INT8_C(  59),  INT8_C(  24),
+       INT8_C(  69),  INT8_C(  53), -INT8_C(  54),  INT8_C(  13), -INT8_C(  10),  INT8_C(  41),  INT8_C(  29),  INT8_C(  19),
+       INT8_C(  15), -INT8_C(  85), -INT8_C(  14),  INT8_C(  86), -INT8_C(  40),  INT8_C(  54),  INT8_C(  65),  INT8_C(  97),
+       INT8_C(   8), -INT8_C( 120), -INT8_C(  36),  INT8_C( 102), -INT8_C(  40),  INT8_C(  13),  INT8_C( 108), -INT8_C( 117),
+      -INT8_C(  23), -INT8_C( 100),  INT8_C(  73),  INT8_C(  33),  INT8_C(  23),  INT8_C(  15),  INT8_C(  57),  INT8_C(  93),
+       INT8_C(  68),  INT8_C(   4),  INT8_C( 106),  INT8_C(  58),  INT8_C(  45), -INT8_C( 121),  INT8_C(  78),  INT8_C(  60),
+       INT8_C(  50),  INT8_C(  64), -INT8_C( 110),  INT8_C(  11),  INT8_C( 118), -INT8_C(  44),  INT8_C( 108),  INT8_C( 126),
+       INT8_C(  92),  INT8_C(  72), -INT8_C(  28),  INT8_C(  53),  INT8_C(  85),  INT8_C(  81), -INT8_C(  64),  INT8_C(  63),
+      -INT8_C(  19),  INT8_C(   9),  INT8_C(  96),  INT8_C(   4),  INT8_C(  24), -INT8_C( 102),  INT8_C(  97),  INT8_C(  92),
+      -INT8_C(  98), -INT8_C(  53), -INT8_C( 105), -INT8_C(  53),  INT8_C(  83), -INT8_C(  27),  INT8_C(   8), -INT8_C( 123),
+       INT8_C(  37), -INT8_C( 102), -INT8_C( 112), -INT8_C( 101),  INT8_C( 110), -INT8_C(   3),  INT8_C(  25), -INT8_C(  53),
+       INT8_C(  69), -INT8_C(   2),  INT8_C(   0), -INT8_C( 101),  INT8_C(  79), -INT8_C(  64), -INT8_C(  38),  INT8_C(  60),
+      -INT8_C(  55),  INT8_C(  58),  INT8_C(  64), -INT8_C(  30), -INT8_C(  44), -INT8_C(  94),  INT8_C(  62),  INT8_C( 114),
+       INT8_C( 109), -INT8_C(  43),  INT8_C(  62), -INT8_C(  64), -INT8_C(  70),  INT8_C(  70),  INT8_C(  70), -INT8_C(  33),
+      -INT8_C(  32), -INT8_C(  42),  INT8_C( 122),  INT8_C(  79), -INT8_C(  45), -INT8_C( 108),  INT8_C(  26),  INT8_C(  25),
+      -INT8_C( 110),  INT8_C(  26), -INT8_C(  76), -INT8_C(  31), -INT8_C(  38), -INT8_C( 114),  INT8_C(  29), -INT8_C(  93),
+      -INT8_C(  56),  INT8_C(  93), -INT8_C( 123), -INT8_C(  99), -INT8_C(   1), -INT8_C(  60),  INT8_C(  15),  INT8_C( 109),
+      -INT8_C( 103),  INT8_C(  77),  INT8_C(  45),  INT8_C(  84), -INT8_C( 109),  INT8_C( 115),  INT8_C(  51),  INT8_C( 116),
+       INT8_C(  74), -INT8_C(  82), -INT8_C(  61),  INT8_C(  29),  INT8_C(  66), -INT8_C(  35),  INT8_C(  54), -INT8_C(  44),
+      -INT8_C(   9), -INT8_C(  22), -INT8_C(  75), -INT8_C(  47),  INT8_C( 120), -INT8_C(  46),  INT8_C( 116),  INT8_C(  65),
+       INT8_C(  47), -INT8_C(   6), -INT8_C(  34),  INT8_C(  47), -INT8_C(  66), -INT8_C(  19), -INT8_C( 100),  INT8_C(  87),
+       INT8_C(  59), -INT8_C(  55), -INT8_C(  85), -INT8_C(  50),  INT8_C(  61), -INT8_C(  33),  INT8_C(  66), -INT8_C( 121),
+      -INT8_C( 115),  INT8_C(   5), -INT8_C(  92), -INT8_C(  49), -INT8_C(  30), -INT8_C(  37), -INT8_C(  93), -INT8_C(  39),
+      -INT8_C(  59),  INT8_C(  88), -INT8_C(  86),  INT8_C(  62),  INT8_C(  42),  INT8_C(  31),      INT8_MAX,  INT8_C(  89),
+       INT8_C(  25),  INT8_C(  93), -INT8_C( 120), -INT8_C(  41),  INT8_C(  74),  INT8_C(  36),  INT8_C(  46), -INT8_C( 123),
+      -INT8_C(  18), -INT8_C(  38),  INT8_C(  84),  INT8_C(  43), -INT8_C(  71), -INT8_C( 106), -INT8_C(  78),  INT8_C(  70),
+      -INT8_C( 100),  INT8_C(  86),  INT8_C(  21),  INT8_C( 126),  INT8_C(  49), -INT8_C(  72),  INT8_C(  88), -INT8_C(   9),
+       INT8_C(  16),  INT8_C(   2),  INT8_C(  53),  INT8_C(  58),  INT8_C(  33), -INT8_C(  76), -INT8_C( 109),  INT8_C(  58),
+       INT8_C(  17),  INT8_C(  28),  INT8_C(  17),  INT8_C(  91),  INT8_C(  64),  INT8_C(  64), -INT8_C(  31),  INT8_C(  46),
+       INT8_C(  26),  INT8_C(  53),  INT8_C(  89), -INT8_C(  45), -INT8_C(  53),  INT8_C(  11),  INT8_C(  25),  INT8_C( 103),
+       INT8_C(  98),  INT8_C(  46), -INT8_C(  26), -INT8_C( 109), -INT8_C(  26),  INT8_C(  62), -INT8_C( 118), -INT8_C(  10),
+       INT8_C(  64), -INT8_C(  65),  INT8_C(  48),  INT8_C(  98),  INT8_C( 115), -INT8_C(  61), -INT8_C( 100), -INT8_C( 124),
+      -INT8_C(  33), -INT8_C(  82), -INT8_C(  32),  INT8_C(  32), -INT8_C(  18), -INT8_C(  63),  INT8_C(  78),  INT8_C(   8),
+      -INT8_C(  10), -INT8_C(  88), -INT8_C(  37), -INT8_C(  63), -INT8_C(  77), -INT8_C(  12),  INT8_C(  41),  INT8_C(  21),
+       INT8_C(  34),  INT8_C(  15), -INT8_C(  87),  INT8_C(   8),  INT8_C(  77),  INT8_C(  51), -INT8_C(   2), -INT8_C( 115),
+      -INT8_C(  13),  INT8_C(  46), -INT8_C(  17),  INT8_C( 102), -INT8_C(  15), -INT8_C( 116), -INT8_C(  21), -INT8_C(  47),
+       INT8_C(  58), -INT8_C(  53), -INT8_C(  15),  INT8_C(  40), -INT8_C( 116),  INT8_C(  63),  INT8_C(  48), -INT8_C( 126),
+      -INT8_C(  25),  INT8_C(  11),  INT8_C(  67), -INT8_C( 101), -INT8_C(   1),  INT8_C( 108), -INT8_C(  80),  INT8_C(  33),
+       INT8_C( 123),  INT8_C(  89),  INT8_C(  41), -INT8_C(  56), -INT8_C( 115),  INT8_C(  39),  INT8_C(  86),      INT8_MIN,
+       INT8_C(  85),  INT8_C(  69), -INT8_C(  26),  INT8_C(  70), -INT8_C(  47), -INT8_C(  47),  INT8_C(  23),  INT8_C(  11),
+      -INT8_C( 100),  INT8_C(   8),  INT8_C(  51),  INT8_C(  40),  INT8_C(  72),  INT8_C(  99), -INT8_C(  86),  INT8_C(  47),
+       INT8_C( 110), -INT8_C(  18), -INT8_C(  54),  INT8_C( 109),  INT8_C(  90),  INT8_C( 123), -INT8_C( 114), -INT8_C(  42),
+      -INT8_C(  44), -INT8_C(  73), -INT8_C(  98),  INT8_C(  97), -INT8_C(  34), -INT8_C(  12), -INT8_C(  31),  INT8_C(  51),
+       INT8_C(  58), -INT8_C(  56),  INT8_C( 122),  INT8_C(  11), -INT8_C( 103), -INT8_C( 111),  INT8_C(  23),  INT8_C(  54),
+      -INT8_C( 102),  INT8_C(  74),  INT8_C(  94), -INT8_C(  30), -INT8_C(  82),  INT8_C(   9),  INT8_C(  17),  INT8_C(  28),
+      -INT8_C(   9), -INT8_C(  36), -INT8_C( 118),  INT8_C(  81),  INT8_C(  87),  INT8_C(  24),  INT8_C(  39),  INT8_C(  43),
+      -INT8_C(  48), -INT8_C(  58), -INT8_C( 115), -INT8_C(  82), -INT8_C(  70),  INT8_C( 110), -INT8_C(  30), -INT8_C(  12),
+       INT8_C(  54),  INT8_C(  92),  INT8_C(   0), -INT8_C(  48), -INT8_C(  19),  INT8_C(  23),  INT8_C(   6), -INT8_C( 121),
+       INT8_C(  97),  INT8_C( 100),  INT8_C( 105),  INT8_C(  15),  INT8_C( 109),  INT8_C( 123),  INT8_C(  44),  INT8_C( 100),
+       INT8_C(  87), -INT8_C(  74), -INT8_C(  74), -INT8_C(  82), -INT8_C(  50), -INT8_C(  35), -INT8_C(  39), -INT8_C(  98),
+      -INT8_C(  93),  INT8_C( 102),  INT8_C(  77),  INT8_C(  94), -INT8_C(  43),  INT8_C(  47),  INT8_C(  82),  INT8_C(  11),
+      -INT8_C( 117),  INT8_C(  82), -INT8_C(  37),  INT8_C( 120),  INT8_C( 105), -INT8_C(  31),  INT8_C(   0), -INT8_C(  53),
+       INT8_C(  70),  INT8_C( 105), -INT8_C(  38), -INT8_C(  77), -INT8_C(  28),  INT8_C(   6),  INT8_C(  24),  INT8_C(  59),
+      -INT8_C(  68), -INT8_C(  50), -INT8_C(  23), -INT8_C( 117), -INT8_C(  85), -INT8_C(  61),  INT8_C(  41),  INT8_C(  79),
+       INT8_C(  41),  INT8_C( 118), -INT8_C(  83), -INT8_C(   2), -INT8_C(  91), -INT8_C(   1),  INT8_C(  10),  INT8_C(  48),
+       INT8_C(  82), -INT8_C(  27), -INT8_C(  87), -INT8_C(  69), -INT8_C(  57), -INT8_C(  87), -INT8_C( 122),  INT8_C(  13),
+       INT8_C(  18),  INT8_C(  97), -INT8_C(  64), -INT8_C(   9),  INT8_C( 103), -INT8_C(  40),  INT8_C(  50),  INT8_C(  36),
+      -INT8_C(  90),  INT8_C(  28), -INT8_C(  81),  INT8_C(  82), -INT8_C(  33), -INT8_C(  40), -INT8_C(  95),  INT8_C(   8),
+       INT8_C(  79),  INT8_C(  78),  INT8_C(   7), -INT8_C(  12),  INT8_C(  77),  INT8_C(  17),  INT8_C(  37), -INT8_C(  97),
+      -INT8_C(  10), -INT8_C(  50),  INT8_C(  91), -INT8_C(  67),  INT8_C( 119), -INT8_C(  31), -INT8_C(  54), -INT8_C( 119),
+       INT8_C(  66), -INT8_C( 117),      INT8_MIN, -INT8_C(  86),  INT8_C(  99), -INT8_C(  77), -INT8_C(  50),  INT8_C(  10),
+      -INT8_C(  49),  INT8_C( 125),  INT8_C(  92) };
+  static const int8_t b[] =
+    {  INT8_C(  50),  INT8_C(  61), -INT8_C(  79),  INT8_C(  51),  INT8_C(  81),  INT8_C(  70),  INT8_C(  95),  INT8_C(  77),
+      -INT8_C(  75),  INT8_C(  56), -INT8_C(  51), -INT8_C(  54), -INT8_C(  89),  INT8_C(  97),  INT8_C(  17), -INT8_C(  43),
+       INT8_C(  20), -INT8_C( 113), -INT8_C(  30),  INT8_C(   9),  INT8_C(   7),  INT8_C(  55),  INT8_C(   0), -INT8_C( 115),
+       INT8_C(  79),  INT8_C(  79), -INT8_C( 112),  INT8_C(  36), -INT8_C( 127), -INT8_C( 101),  INT8_C( 106), -INT8_C(  77),
+      -INT8_C(  40),  INT8_C(  27), -INT8_C(  26),  INT8_C(  41),  INT8_C(  97),  INT8_C(  69),  INT8_C( 119),  INT8_C(  22),
+       INT8_C( 126),  INT8_C(  68), -INT8_C(  31),  INT8_C(  37), -INT8_C(  91), -INT8_C(  14), -INT8_C(   6), -INT8_C(  71),
+      -INT8_C( 127), -INT8_C(  36), -INT8_C(  62), -INT8_C( 120),  INT8_C(  19), -INT8_C(  62),  INT8_C(  22),  INT8_C(  99),
+       INT8_C(  18), -INT8_C(  90), -INT8_C( 121), -INT8_C( 109),  INT8_C(  65), -INT8_C(  15),  INT8_C(  70),  INT8_C(  25),
+       INT8_C(  12),  INT8_C(  44),  INT8_C(  67),  INT8_C( 110),  INT8_C( 114), -INT8_C(  70), -INT8_C( 124), -INT8_C(  16),
+      -INT8_C(   2),  INT8_C( 101),  INT8_C(  21), -INT8_C(  93),  INT8_C(  87),  INT8_C(  15),  INT8_C(  92), -INT8_C(  39),
+      -INT8_C(  21),  INT8_C(  30),  INT8_C(  97), -INT8_C(   2), -INT8_C(  31),  INT8_C( 119),  INT8_C(  97), -INT8_C(  13),
+       INT8_C(  30), -INT8_C(  24), -INT8_C( 122),  INT8_C(  95), -INT8_C(  39), -INT8_C(  52),  INT8_C( 121), -INT8_C(  26),
+      -INT8_C(   8), -INT8_C(  68),  INT8_C(  84),  INT8_C( 106),  INT8_C( 118), -INT8_C(  40),  INT8_C(  90),  INT8_C( 116),
+       INT8_C(  62),  INT8_C( 111),  INT8_C(  23), -INT8_C( 107),  INT8_C( 126),  INT8_C( 115),  INT8_C( 110),  INT8_C( 105),
+      -INT8_C( 111), -INT8_C(  48),  INT8_C( 104),  INT8_C( 114),  INT8_C(  71), -INT8_C(  55),  INT8_C( 101),  INT8_C( 101),
+      -INT8_C(  78), -INT8_C(  21), -INT8_C(  59), -INT8_C( 117), -INT8_C(  73),  INT8_C(  62),  INT8_C( 113), -INT8_C(  80),
+      -INT8_C(   6), -INT8_C(  59),  INT8_C(  26),  INT8_C( 112), -INT8_C(  98),  INT8_C( 117), -INT8_C(  28), -INT8_C(  36),
+      -INT8_C(  28), -INT8_C(   5),  INT8_C( 113),  INT8_C(  99),  INT8_C( 110), -INT8_C(  32), -INT8_C(  52), -INT8_C(   1),
+      -INT8_C(  80),  INT8_C(  52),  INT8_C( 114), -INT8_C(   9), -INT8_C(   2), -INT8_C(  41),  INT8_C(  93), -INT8_C(  80),
+      -INT8_C(  61),  INT8_C(  34),  INT8_C(  59),  INT8_C( 122),  INT8_C(  96), -INT8_C(  83),  INT8_C(  42),  INT8_C(  90),
+       INT8_C( 114),  INT8_C(  69), -INT8_C(  54),  INT8_C(  16), -INT8_C(  70), -INT8_C(  82), -INT8_C(  20), -INT8_C(  98),
+      -INT8_C(  87),  INT8_C(  94),  INT8_C(   1),  INT8_C(  23),  INT8_C(  62), -INT8_C(  50),  INT8_C(  22), -INT8_C(  18),
+       INT8_C(   2), -INT8_C( 120), -INT8_C(  27),  INT8_C(   0),  INT8_C(  96),  INT8_C(  66), -INT8_C(  80),  INT8_C(  35),
+       INT8_C( 100), -INT8_C(  20), -INT8_C(  99), -INT8_C(  60), -INT8_C( 103), -INT8_C(  56),  INT8_C(  30),  INT8_C(  11),
+       INT8_C(  13), -INT8_C(  24),  INT8_C(  28), -INT8_C(  57), -INT8_C( 106),  INT8_C(   8),  INT8_C( 101),  INT8_C(  63),
+       INT8_C( 102),  INT8_C( 103),  INT8_C(  86), -INT8_C(  92),  INT8_C(  53),  INT8_C( 109), -INT8_C( 110),  INT8_C(  55),
+      -INT8_C(  11),  INT8_C( 120),  INT8_C(  56),  INT8_C(  85), -INT8_C(  70), -INT8_C(  24),  INT8_C( 120),  INT8_C(  31),
+      -INT8_C(  44),  INT8_C(  22), -INT8_C(  29),  INT8_C( 109), -INT8_C(  34),  INT8_C(   2),  INT8_C( 121), -INT8_C(  21),
+      -INT8_C(  22), -INT8_C( 107), -INT8_C(  78), -INT8_C( 127), -INT8_C(  99),  INT8_C(  23), -INT8_C(  64),  INT8_C(   4),
+       INT8_C( 126),  INT8_C(  23), -INT8_C(  88), -INT8_C(  77), -INT8_C( 124),  INT8_C(  59), -INT8_C(  21),  INT8_C( 121),
+      -INT8_C(  77),  INT8_C(  35), -INT8_C(  49),  INT8_C( 109),  INT8_C(  11),  INT8_C(  71), -INT8_C( 116), -INT8_C(  32),
+       INT8_C(  93),  INT8_C( 112),  INT8_C(  77),  INT8_C(  59),  INT8_C( 114), -INT8_C(  58),  INT8_C(  38),  INT8_C(  92),
+       INT8_C(  91), -INT8_C(  40), -INT8_C(  35), -INT8_C(   7), -INT8_C(  16), -INT8_C(  98), -INT8_C(   3),  INT8_C( 110),
+      -INT8_C(  75), -INT8_C(  91),  INT8_C(  34),  INT8_C(  57), -INT8_C(  32),  INT8_C(  13), -INT8_C(  78), -INT8_C( 109),
+       INT8_C(  48), -INT8_C( 127),  INT8_C(   1),  INT8_C(  59), -INT8_C(  55), -INT8_C( 115),  INT8_C(  27),  INT8_C(  38),
+      -INT8_C(   3),  INT8_C( 105),  INT8_C(  98),  INT8_C( 111),  INT8_C(  47), -INT8_C( 120), -INT8_C(  52), -INT8_C( 117),
+       INT8_C(  97), -INT8_C(  87), -INT8_C( 124),  INT8_C(  81),  INT8_C(  71), -INT8_C( 127), -INT8_C(  65), -INT8_C(   4),
+       INT8_C(  38), -INT8_C(  31),  INT8_C(  53),  INT8_C(   7), -INT8_C(  18), -INT8_C(  24), -INT8_C( 102),  INT8_C(  30),
+       INT8_C( 105), -INT8_C( 101),  INT8_C(  90),  INT8_C(  50),  INT8_C(  41),  INT8_C( 117),  INT8_C(  89),  INT8_C(  38),
+      -INT8_C(  34), -INT8_C(  69), -INT8_C( 106),  INT8_C(  14),  INT8_C(  67),  INT8_C(  98), -INT8_C( 103), -INT8_C(  92),
+       INT8_C(  11),  INT8_C(  29), -INT8_C(  11),  INT8_C(  83), -INT8_C(  98), -INT8_C(  75),  INT8_C(  79), -INT8_C(  60),
+      -INT8_C( 106), -INT8_C( 123), -INT8_C(  53), -INT8_C( 123),  INT8_C( 109),  INT8_C( 102), -INT8_C(  93), -INT8_C(  42),
+       INT8_C(   1), -INT8_C(   3),  INT8_C(   9),  INT8_C(  42),  INT8_C( 115),  INT8_C(  98),  INT8_C(  81),  INT8_C(  81),
+       INT8_C(  29), -INT8_C(  25),  INT8_C(  95),  INT8_C(  96),  INT8_C(  73), -INT8_C(   8),  INT8_C(   5),  INT8_C(  84),
+       INT8_C(  21), -INT8_C(   6), -INT8_C(  89), -INT8_C(  77), -INT8_C(  81), -INT8_C(   9),  INT8_C( 120),  INT8_C(  70),
+       INT8_C( 124),  INT8_C(  67), -INT8_C(  53), -INT8_C(  23), -INT8_C(  87),  INT8_C( 110), -INT8_C(  65), -INT8_C(  85),
+       INT8_C( 108), -INT8_C(  56), -INT8_C(  43), -INT8_C(  33),  INT8_C(  42),  INT8_C(  38),  INT8_C(  48),  INT8_C(  71),
+       INT8_C(  13), -INT8_C( 112), -INT8_C(  88),  INT8_C(  86), -INT8_C( 120), -INT8_C(  83), -INT8_C(  85), -INT8_C(  98),
+      -INT8_C(  89),  INT8_C(  82),  INT8_C(  81),  INT8_C(  87),  INT8_C(  73), -INT8_C(  55), -INT8_C(  99), -INT8_C(  59),
+       INT8_C(  13),  INT8_C( 104), -INT8_C(  82), -INT8_C(  74), -INT8_C(  42),  INT8_C( 110),  INT8_C(  97),  INT8_C(  66),
+       INT8_C(  54),  INT8_C(  55),  INT8_C(  33),  INT8_C(  97),  INT8_C(  93),  INT8_C(  82), -INT8_C(  88),  INT8_C( 107),
+      -INT8_C(  30),  INT8_C(  80), -INT8_C(  63),  INT8_C( 106), -INT8_C(   3),  INT8_C( 108),  INT8_C(   8), -INT8_C(  91),
+      -INT8_C(  65),  INT8_C(  90), -INT8_C(   4),  INT8_C(   8),  INT8_C(  35), -INT8_C( 103), -INT8_C(  50),  INT8_C(  48),
+       INT8_C(   1),  INT8_C( 124), -INT8_C(  25), -INT8_C(  41), -INT8_C(  22),  INT8_C(  72),  INT8_C(  26),  INT8_C(  33),
+           INT8_MAX,  INT8_C(  59), -INT8_C( 126), -INT8_C(  35), -INT8_C( 115),  INT8_C(  42),  INT8_C(  72),  INT8_C( 111),
+       INT8_C( 123),  INT8_C(   9), -INT8_C(  38),  INT8_C( 120),  INT8_C( 118), -INT8_C(  30),  INT8_C(  29),  INT8_C(  53),
+       INT8_C(  60),  INT8_C(  25),  INT8_C(  61),  INT8_C(  96), -INT8_C(  78),  INT8_C(  11), -INT8_C( 112), -INT8_C(  77),
+      -INT8_C( 120),  INT8_C( 119), -INT8_C( 117),  INT8_C( 114), -INT8_C(  64), -INT8_C(  91), -INT8_C( 109),  INT8_C(  63),
+      -INT8_C(  32),  INT8_C(  21),  INT8_C(  28),  INT8_C( 110),  INT8_C(  64),  INT8_C( 100), -INT8_C(  35), -INT8_C(  69),
+       INT8_C( 110), -INT8_C(  73),  INT8_C(  51), -INT8_C(  28), -INT8_C( 102),  INT8_C(  81),  INT8_C(  25), -INT8_C(  42),
+       INT8_C( 106),  INT8_C(  86),  INT8_C(  54),  INT8_C(  29),  INT8_C(  98), -INT8_C(  57), -INT8_C(  48), -INT8_C(  22),
+       INT8_C(  62),  INT8_C(  91),  INT8_C(  92), -INT8_C(   2),  INT8_C(   0), -INT8_C(  16),  INT8_C(  62), -INT8_C(  31),
+       INT8_C(   5),  INT8_C(  90),  INT8_C(  79),  INT8_C(  69), -INT8_C(  65),  INT8_C(  44),  INT8_C(   0),  INT8_C(  45),
+      -INT8_C(  28),  INT8_C(  52),  INT8_C(  17),  INT8_C( 126), -INT8_C( 123),  INT8_C(  42),  INT8_C(  84), -INT8_C(  17),
+           INT8_MIN, -INT8_C( 117),  INT8_C(  12), -INT8_C(  30),  INT8_C(  82), -INT8_C(  35), -INT8_C(  52), -INT8_C( 112),
+       INT8_C(  56),  INT8_C(  41), -INT8_C( 113),  INT8_C(  57),  INT8_C(  25), -INT8_C(  51),  INT8_C(  26),  INT8_C(  30),
+       INT8_C(  39),  INT8_C( 105),  INT8_C( 100), -INT8_C(  26), -INT8_C( 107),  INT8_C( 100),  INT8_C(  19),  INT8_C( 121),
+      -INT8_C( 104),  INT8_C(  36), -INT8_C(   9),  INT8_C(  29),  INT8_C(  78),  INT8_C(  76),  INT8_C(  13), -INT8_C(  49),
+      -INT8_C(  41),  INT8_C(  25), -INT8_C(  79),  INT8_C(  41), -INT8_C(  10),  INT8_C( 126), -INT8_C(  71),  INT8_C(  47),
+      -INT8_C(  89),  INT8_C(  72),  INT8_C( 104), -INT8_C(  64),  INT8_C(  21), -INT8_C( 126), -INT8_C(  34),  INT8_C(  61),
+      -INT8_C(  21),  INT8_C(  66),  INT8_C(  35),      INT8_MIN, -INT8_C(  89),  INT8_C(  55), -INT8_C(   6),  INT8_C(  63),
+       INT8_C(  91), -INT8_C(  15),  INT8_C(  93), -INT8_C(  86),  INT8_C(  61),  INT8_C( 106),  INT8_C( 121),  INT8_C(  20),
+      -INT8_C( 125),  INT8_C(  42),  INT8_C(  61),  INT8_C( 122), -INT8_C(  88), -INT8_C(   9), -INT8_C(  87),  INT8_C(  79),
+       INT8_C(  63),  INT8_C(  17),  INT8_C(  15),  INT8_C(  85), -INT8_C( 109), -INT8_C(  18), -INT8_C( 110),  INT8_C( 126),
+       INT8_C(  48), -INT8_C(  75), -INT8_C(   2), -INT8_C(  41), -INT8_C(  20), -INT8_C(   8),  INT8_C(  23),  INT8_C(  72),
+      -INT8_C(  22),  INT8_C( 116), -INT8_C(  14),  INT8_C(  39), -INT8_C(  34),  INT8_C( 107),  INT8_C(  60),  INT8_C(  97),
+      -INT8_C( 107),  INT8_C( 121), -INT8_C(  37) };
+  static const int8_t e[] =
+    {  INT8_C(  50),  INT8_C(  65),  INT8_C(   1),  INT8_C(  51), -INT8_C(  72),  INT8_C(  70),  INT8_C( 121),  INT8_C(  36),
+       INT8_C( 124), -INT8_C( 116), -INT8_C(  51),  INT8_C(  32),  INT8_C(   0),  INT8_C(  97),  INT8_C(  92),  INT8_C(   1),
+       INT8_C(  20),  INT8_C(  62),  INT8_C( 104), -INT8_C( 104),  INT8_C(   7),  INT8_C( 116),  INT8_C(   0), -INT8_C(  45),
+      -INT8_C(  10),  INT8_C(  47),  INT8_C(  33),  INT8_C(  36),  INT8_C(  48),  INT8_C(  98),  INT8_C(  80), -INT8_C(  69),
+      -INT8_C(  40),  INT8_C(  81), -INT8_C(  26),  INT8_C(  91),  INT8_C( 109),  INT8_C(  78),      INT8_MAX,  INT8_C(  22),
+       INT8_C( 126),  INT8_C(  75),  INT8_C(   9),  INT8_C(  37),  INT8_C(  52),  INT8_C( 102), -INT8_C(  37),  INT8_C(  35),
+      -INT8_C(  92),  INT8_C(  67), -INT8_C(  69),  INT8_C(  41),  INT8_C(  19), -INT8_C( 106), -INT8_C(   4),  INT8_C(  99),
+      -INT8_C(  59),  INT8_C(  30),  INT8_C(  89), -INT8_C(  11),  INT8_C(  65), -INT8_C(  87), -INT8_C(  80),  INT8_C(  35),
+      -INT8_C(   5),  INT8_C(  44),  INT8_C( 126),  INT8_C( 104), -INT8_C(  46), -INT8_C(   3),  INT8_C(  82), -INT8_C(  84),
+       INT8_C(  73),  INT8_C( 101), -INT8_C( 122),  INT8_C( 125),  INT8_C(  87),  INT8_C(  97), -INT8_C(  96),  INT8_C( 101),
+      -INT8_C(  21),  INT8_C(  91), -INT8_C( 114),  INT8_C(  91), -INT8_C(  15), -INT8_C( 117),  INT8_C(  97), -INT8_C(  74),
+       INT8_C(  30),  INT8_C(  98), -INT8_C(  85),  INT8_C(  95),  INT8_C(  12),  INT8_C(  91),  INT8_C(  76),  INT8_C(   7),
+      -INT8_C(   8), -INT8_C(  54),  INT8_C( 111), -INT8_C(  78),  INT8_C( 118), -INT8_C(  63),  INT8_C(  95),  INT8_C( 116),
+       INT8_C(  29),  INT8_C( 111), -INT8_C( 115), -INT8_C(  34),  INT8_C(  71),  INT8_C( 115),  INT8_C(  68),  INT8_C( 105),
+      -INT8_C( 119), -INT8_C(  46),  INT8_C( 104),  INT8_C( 122),  INT8_C(  93),  INT8_C(  80),  INT8_C(  49),  INT8_C( 101),
+      -INT8_C(  78), -INT8_C(  21),  INT8_C(  47), -INT8_C(  66),  INT8_C(  56),  INT8_C( 123),  INT8_C( 113),  INT8_C(  24),
+       INT8_C(  69),  INT8_C(  53), -INT8_C(  54),  INT8_C( 112), -INT8_C(  10),  INT8_C( 117),  INT8_C(  29),  INT8_C(  19),
+       INT8_C(  15), -INT8_C(   5),  INT8_C( 113),  INT8_C(  99),  INT8_C( 110),  INT8_C(  54),  INT8_C(  65),  INT8_C(  97),
+       INT8_C(   8), -INT8_C( 120),  INT8_C( 114),  INT8_C( 102), -INT8_C(  40),  INT8_C(  13),  INT8_C( 108), -INT8_C(  80),
+      -INT8_C(  23),  INT8_C(  34),  INT8_C(  73),  INT8_C(  33),  INT8_C(  23),  INT8_C(  15),  INT8_C(  57),  INT8_C(  93),
+       INT8_C( 114),  INT8_C(   4),  INT8_C( 106),  INT8_C(  58),  INT8_C(  45), -INT8_C( 121),  INT8_C(  78),  INT8_C(  60),
+       INT8_C(  50),  INT8_C(  94), -INT8_C( 110),  INT8_C(  23),  INT8_C( 118), -INT8_C(  44),  INT8_C( 108),  INT8_C( 126),
+       INT8_C(  92),  INT8_C(  72), -INT8_C(  27),  INT8_C(  53),  INT8_C(  85),  INT8_C(  81), -INT8_C(  64),  INT8_C(  63),
+       INT8_C( 100),  INT8_C(   9),  INT8_C(  96),  INT8_C(   4),  INT8_C(  24), -INT8_C(  56),  INT8_C(  97),  INT8_C(  92),
+       INT8_C(  13), -INT8_C(  53), -INT8_C( 105), -INT8_C(  53),  INT8_C(  83),  INT8_C(   8),  INT8_C(   8),  INT8_C(  63),
+       INT8_C( 102), -INT8_C( 102), -INT8_C( 112), -INT8_C( 101),  INT8_C( 110),  INT8_C( 109),  INT8_C(  25), -INT8_C(  53),
+       INT8_C(  69),  INT8_C( 120),  INT8_C(  56),  INT8_C(  85),  INT8_C(  79), -INT8_C(  64), -INT8_C(  38),  INT8_C(  60),
+      -INT8_C(  44),  INT8_C(  58),  INT8_C(  64), -INT8_C(  30), -INT8_C(  44),  INT8_C(   2),  INT8_C( 121),  INT8_C( 114),
+       INT8_C( 109), -INT8_C(  43),  INT8_C(  62), -INT8_C(  64), -INT8_C(  70),  INT8_C(  70),  INT8_C(  70),  INT8_C(   4),
+       INT8_C( 126), -INT8_C(  42),  INT8_C( 122),  INT8_C(  79), -INT8_C(  45),  INT8_C(  59),  INT8_C(  26),  INT8_C(  25),
+      -INT8_C( 110),  INT8_C(  26), -INT8_C(  76), -INT8_C(  31), -INT8_C(  38), -INT8_C( 114),  INT8_C(  29), -INT8_C(  93),
+       INT8_C(  93),  INT8_C(  93), -INT8_C( 123), -INT8_C(  99), -INT8_C(   1), -INT8_C(  60),  INT8_C(  15),  INT8_C( 109),
+      -INT8_C( 103),  INT8_C(  77),  INT8_C(  45),  INT8_C(  84), -INT8_C(  16),  INT8_C( 115),  INT8_C(  51),  INT8_C( 116),
+       INT8_C(  74), -INT8_C(  82), -INT8_C(  61),  INT8_C(  29),  INT8_C(  66), -INT8_C(  35),  INT8_C(  54), -INT8_C(  44),
+       INT8_C(  48), -INT8_C(  22), -INT8_C(  75), -INT8_C(  47),  INT8_C( 120), -INT8_C(  46),  INT8_C( 116),  INT8_C(  65),
+       INT8_C(  47),  INT8_C( 105), -INT8_C(  34),  INT8_C( 111),  INT8_C(  47), -INT8_C(  19), -INT8_C( 100),  INT8_C(  87),
+       INT8_C(  59), -INT8_C(  55), -INT8_C(  85),  INT8_C(  81),  INT8_C(  71), -INT8_C(  33),  INT8_C(  66), -INT8_C( 121),
+       INT8_C(  38),  INT8_C(   5), -INT8_C(  92), -INT8_C(  49), -INT8_C(  30), -INT8_C(  24), -INT8_C(  93), -INT8_C(  39),
+       INT8_C( 105),  INT8_C(  88), -INT8_C(  86),  INT8_C(  62),  INT8_C(  42),  INT8_C(  31),      INT8_MAX,  INT8_C(  89),
+       INT8_C(  25),  INT8_C(  93), -INT8_C( 120),  INT8_C(  14),  INT8_C(  74),  INT8_C(  98),  INT8_C(  46), -INT8_C( 123),
+       INT8_C(  11), -INT8_C(  38),  INT8_C(  84),  INT8_C(  83), -INT8_C(  71), -INT8_C( 106),  INT8_C(  79),  INT8_C(  70),
+      -INT8_C( 100),  INT8_C(  86),  INT8_C(  21),  INT8_C( 126),  INT8_C( 109), -INT8_C(  72),  INT8_C(  88), -INT8_C(   9),
+       INT8_C(  16),  INT8_C(   2),  INT8_C(  53),  INT8_C(  58),  INT8_C(  33), -INT8_C(  76),  INT8_C(  81),  INT8_C(  58),
+       INT8_C(  29),  INT8_C(  28),  INT8_C(  95),  INT8_C(  91),  INT8_C(  64),  INT8_C(  64),  INT8_C(   5),  INT8_C(  84),
+       INT8_C(  26),  INT8_C(  53),  INT8_C(  89), -INT8_C(  45), -INT8_C(  53),  INT8_C(  11),  INT8_C( 120),  INT8_C( 103),
+       INT8_C( 124),  INT8_C(  46), -INT8_C(  26), -INT8_C( 109), -INT8_C(  26),  INT8_C( 110), -INT8_C(  65), -INT8_C(  10),
+       INT8_C( 108), -INT8_C(  65),  INT8_C(  48),  INT8_C(  98),  INT8_C( 115), -INT8_C(  61),  INT8_C(  48), -INT8_C( 124),
+      -INT8_C(  33), -INT8_C(  82), -INT8_C(  32),  INT8_C(  86), -INT8_C(  18), -INT8_C(  63),  INT8_C(  78),  INT8_C(   8),
+      -INT8_C(  10), -INT8_C(  88), -INT8_C(  37), -INT8_C(  63), -INT8_C(  77), -INT8_C(  12),  INT8_C(  41),  INT8_C(  21),
+       INT8_C(  34),  INT8_C(  15), -INT8_C(  82),  INT8_C(   8),  INT8_C(  77),  INT8_C(  51), -INT8_C(   2), -INT8_C( 115),
+      -INT8_C(  13),  INT8_C(  46),  INT8_C(  33),  INT8_C( 102),  INT8_C(  93),  INT8_C(  82), -INT8_C(  21), -INT8_C(  47),
+       INT8_C(  58),  INT8_C(  80), -INT8_C(  15),  INT8_C(  40), -INT8_C(   3),  INT8_C(  63),  INT8_C(  48), -INT8_C( 126),
+      -INT8_C(  25),  INT8_C(  11),  INT8_C(  67),  INT8_C(   8), -INT8_C(   1),  INT8_C( 108), -INT8_C(  80),  INT8_C(  33),
+       INT8_C( 123),  INT8_C( 124),  INT8_C(  41), -INT8_C(  41), -INT8_C(  22),  INT8_C(  72),  INT8_C(  86),      INT8_MIN,
+       INT8_C(  85),  INT8_C(  69), -INT8_C(  26),  INT8_C(  70), -INT8_C(  47), -INT8_C(  47),  INT8_C(  72),  INT8_C(  11),
+      -INT8_C( 100),  INT8_C(   8),  INT8_C(  51),  INT8_C(  40),  INT8_C( 118),  INT8_C(  99), -INT8_C(  86),  INT8_C(  47),
+       INT8_C( 110),  INT8_C(  25), -INT8_C(  54),  INT8_C( 109),  INT8_C(  90),  INT8_C( 123), -INT8_C( 112), -INT8_C(  42),
+      -INT8_C(  44), -INT8_C(  73), -INT8_C(  98),  INT8_C( 114), -INT8_C(  34), -INT8_C(  12), -INT8_C(  31),  INT8_C(  51),
+       INT8_C(  58),  INT8_C(  21),  INT8_C( 122),  INT8_C( 110), -INT8_C( 103),  INT8_C( 100),  INT8_C(  23),  INT8_C(  54),
+      -INT8_C( 102),  INT8_C(  74),  INT8_C(  94), -INT8_C(  30), -INT8_C(  82),  INT8_C(   9),  INT8_C(  17),  INT8_C(  28),
+      -INT8_C(   9),  INT8_C(  86),  INT8_C(  54),  INT8_C(  81),  INT8_C(  87),  INT8_C(  24),  INT8_C(  39),  INT8_C(  43),
+      -INT8_C(  48), -INT8_C(  58), -INT8_C( 115), -INT8_C(  82), -INT8_C(  70),  INT8_C( 110), -INT8_C(  30), -INT8_C(  12),
+       INT8_C(  54),  INT8_C(  92),  INT8_C(   0),  INT8_C(  69), -INT8_C(  19),  INT8_C(  23),  INT8_C(   6), -INT8_C( 121),
+       INT8_C(  97),  INT8_C( 100),  INT8_C( 105),  INT8_C(  15),  INT8_C( 109),  INT8_C( 123),  INT8_C(  44),  INT8_C( 100),
+       INT8_C(  87), -INT8_C(  74),  INT8_C(  12), -INT8_C(  82), -INT8_C(  50), -INT8_C(  35), -INT8_C(  39), -INT8_C(  98),
+       INT8_C(  56),  INT8_C( 102),  INT8_C(  77),  INT8_C(  94), -INT8_C(  43),  INT8_C(  47),  INT8_C(  82),  INT8_C(  11),
+       INT8_C(  39),  INT8_C(  82),  INT8_C( 100),  INT8_C( 120),  INT8_C( 105), -INT8_C(  31),  INT8_C(   0),  INT8_C( 121),
+       INT8_C(  70),  INT8_C( 105), -INT8_C(  38), -INT8_C(  77), -INT8_C(  28),  INT8_C(  76),  INT8_C(  24),  INT8_C(  59),
+      -INT8_C(  68), -INT8_C(  50), -INT8_C(  23), -INT8_C( 117), -INT8_C(  85), -INT8_C(  61),  INT8_C(  41),  INT8_C(  79),
+       INT8_C(  41),  INT8_C( 118),  INT8_C( 104), -INT8_C(   2), -INT8_C(  91), -INT8_C(   1),  INT8_C(  10),  INT8_C(  48),
+       INT8_C(  82),  INT8_C(  66), -INT8_C(  87), -INT8_C(  69), -INT8_C(  57), -INT8_C(  87), -INT8_C( 122),  INT8_C(  63),
+       INT8_C(  91),  INT8_C(  97), -INT8_C(  64), -INT8_C(   9),  INT8_C( 103), -INT8_C(  40),  INT8_C(  50),  INT8_C(  36),
+      -INT8_C(  90),  INT8_C(  42), -INT8_C(  81),  INT8_C( 122), -INT8_C(  33), -INT8_C(   9), -INT8_C(  95),  INT8_C(  79),
+       INT8_C(  79),  INT8_C(  78),  INT8_C(  15), -INT8_C(  12),  INT8_C(  77),  INT8_C(  17),  INT8_C(  37),  INT8_C( 126),
+      -INT8_C(  10), -INT8_C(  50),  INT8_C(  91), -INT8_C(  67),  INT8_C( 119), -INT8_C(   8),  INT8_C(  23),  INT8_C(  72),
+       INT8_C(  66),  INT8_C( 116),      INT8_MIN, -INT8_C(  86),  INT8_C(  99), -INT8_C(  77), -INT8_C(  50),  INT8_C(  10),
+      -INT8_C(  49),  INT8_C( 125),  INT8_C(  92) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_s8_m(pv, av, bv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+
+    ev = simde_svmax_s8_m(pv, av, bv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0) };
+  static const int16_t a[] =
+    { -INT16_C( 24442),  INT16_C(  9150), -INT16_C( 22813),  INT16_C( 25900),  INT16_C( 14072), -INT16_C( 17274),  INT16_C( 16804), -INT16_C(  9731),
+       INT16_C( 24682), -INT16_C( 17354), -INT16_C( 20023), -INT16_C( 24757), -INT16_C(  2921),  INT16_C( 13992),  INT16_C(  9776), -INT16_C( 18850),
+       INT16_C(  7366), -INT16_C( 22054),  INT16_C(  1730), -INT16_C( 17906), -INT16_C( 27588), -INT16_C(  8074),  INT16_C( 29653),  INT16_C( 16570),
+      -INT16_C(  3885), -INT16_C( 25092),  INT16_C( 18338),  INT16_C( 14652), -INT16_C(  6853),  INT16_C( 27503), -INT16_C( 13045), -INT16_C( 11998),
+      -INT16_C(   791), -INT16_C( 21638), -INT16_C( 30718),  INT16_C( 15973), -INT16_C(  9444), -INT16_C(  3810), -INT16_C( 10162),  INT16_C(  8753),
+       INT16_C( 11977),  INT16_C( 27583), -INT16_C(  1163), -INT16_C( 20060),  INT16_C(  5088), -INT16_C(  5348),  INT16_C( 16097), -INT16_C( 13636),
+       INT16_C( 13882),  INT16_C( 15478), -INT16_C(  9282), -INT16_C(  9606), -INT16_C( 26185),  INT16_C(  1484), -INT16_C(   655),  INT16_C( 14887),
+      -INT16_C(  6613), -INT16_C( 24155),  INT16_C( 18914), -INT16_C( 15790),  INT16_C( 28253),  INT16_C( 16046),  INT16_C( 27309), -INT16_C(  6392),
+       INT16_C( 32417),  INT16_C( 24356), -INT16_C( 24998),  INT16_C(  4410),  INT16_C(  1591), -INT16_C( 22250),  INT16_C( 15875),  INT16_C( 12259),
+      -INT16_C( 30428),  INT16_C(  1744),  INT16_C(  8914),  INT16_C( 12233),  INT16_C( 30608),  INT16_C( 15725),  INT16_C( 30433), -INT16_C( 32219),
+       INT16_C( 18932),  INT16_C( 20194),  INT16_C(  7399),  INT16_C(  8031),  INT16_C( 30242),  INT16_C(  9672), -INT16_C( 21580), -INT16_C( 10156),
+       INT16_C(  9268),  INT16_C(  2015), -INT16_C( 22458), -INT16_C( 10442), -INT16_C( 23521),  INT16_C(    20),  INT16_C( 14618),  INT16_C(  3715),
+       INT16_C( 25986),  INT16_C( 27229), -INT16_C( 17279), -INT16_C( 23671),  INT16_C( 20786), -INT16_C(  6456),  INT16_C(  7676),  INT16_C( 12735),
+      -INT16_C( 25023), -INT16_C( 30664),  INT16_C( 28230),  INT16_C( 25951),  INT16_C( 29458),  INT16_C( 11365), -INT16_C(  5971),  INT16_C( 12091),
+      -INT16_C( 26547), -INT16_C( 12647),  INT16_C(  8788), -INT16_C( 30863),  INT16_C( 14963),  INT16_C( 28781),  INT16_C( 11351), -INT16_C( 26463),
+      -INT16_C(  9782),  INT16_C(  4128),  INT16_C( 32583),  INT16_C( 23157), -INT16_C(  9229), -INT16_C( 24442), -INT16_C( 15933),  INT16_C(  4559),
+       INT16_C( 26969), -INT16_C( 20769),  INT16_C( 20875), -INT16_C(   203), -INT16_C( 23925), -INT16_C(  7569),  INT16_C(  4303), -INT16_C( 26246),
+      -INT16_C( 25623),  INT16_C( 12458),  INT16_C(  7962),  INT16_C(  3466),  INT16_C(  4602), -INT16_C( 16723),  INT16_C( 32210),  INT16_C( 11471),
+      -INT16_C( 20762),  INT16_C( 29146),  INT16_C(  4095), -INT16_C( 30096), -INT16_C(  8271), -INT16_C( 32660), -INT16_C(  6161), -INT16_C( 10214),
+      -INT16_C( 15230), -INT16_C( 25591), -INT16_C( 27677), -INT16_C(  8534),  INT16_C( 22436),  INT16_C( 30620),  INT16_C( 27604), -INT16_C( 17757),
+       INT16_C( 32025),  INT16_C(  6444), -INT16_C( 25460),  INT16_C( 15779),  INT16_C(  4220),  INT16_C( 27582), -INT16_C(  9993),  INT16_C( 31044),
+       INT16_C( 19868),  INT16_C( 32533), -INT16_C( 16416), -INT16_C( 31395), -INT16_C(  1769), -INT16_C(  5124), -INT16_C( 24732),  INT16_C( 32422),
+      -INT16_C( 11748), -INT16_C( 22377),  INT16_C( 14958), -INT16_C(  5403), -INT16_C( 23734),  INT16_C( 16726), -INT16_C( 25989),  INT16_C(  6074),
+      -INT16_C( 12057), -INT16_C( 14441), -INT16_C(  2929), -INT16_C( 22964),  INT16_C( 18670),  INT16_C( 21138),  INT16_C( 14567),  INT16_C(   976),
+       INT16_C( 26378),  INT16_C( 30891), -INT16_C( 28254), -INT16_C(  5021), -INT16_C( 18124), -INT16_C( 20434), -INT16_C(  6061),  INT16_C( 15047),
+       INT16_C( 24248),  INT16_C( 18433),  INT16_C( 20051),  INT16_C( 16878), -INT16_C( 32618),  INT16_C( 32403),  INT16_C( 25784), -INT16_C( 15743),
+       INT16_C( 11723),  INT16_C( 27963), -INT16_C( 24898), -INT16_C(  3494), -INT16_C( 30633), -INT16_C( 21854),  INT16_C( 27248),  INT16_C( 10724),
+      -INT16_C(  6712),  INT16_C(  7025),  INT16_C( 24371), -INT16_C( 13732), -INT16_C(  3872), -INT16_C( 26552), -INT16_C( 13996),  INT16_C(  8027),
+      -INT16_C( 26890), -INT16_C( 19315), -INT16_C(  6348), -INT16_C( 29785),  INT16_C( 18799), -INT16_C(  8395),  INT16_C(  6579),  INT16_C( 31752),
+       INT16_C( 31230),  INT16_C( 12951), -INT16_C(  2855), -INT16_C( 17924),  INT16_C( 17636),  INT16_C( 14417), -INT16_C( 21491),  INT16_C(  1111),
+      -INT16_C(  7102),  INT16_C( 30392),  INT16_C( 24523),  INT16_C( 14849),  INT16_C( 13993),  INT16_C( 23578),  INT16_C(  8783),  INT16_C( 20184),
+       INT16_C( 28828),  INT16_C( 30080),  INT16_C( 31844),  INT16_C( 18478),  INT16_C( 32704), -INT16_C( 12928), -INT16_C( 10452),  INT16_C( 28369),
+      -INT16_C( 30020), -INT16_C( 30747), -INT16_C(  6423), -INT16_C( 27966), -INT16_C(  9187),  INT16_C( 27887), -INT16_C( 14338), -INT16_C( 25926),
+       INT16_C( 14903), -INT16_C( 25841),  INT16_C( 15798),  INT16_C( 30435),  INT16_C( 25533), -INT16_C(  5820),  INT16_C(  5435), -INT16_C(  2217),
+       INT16_C( 15519), -INT16_C( 30338),  INT16_C( 16419),  INT16_C( 16411),  INT16_C(  2588),  INT16_C(  7084),  INT16_C( 26578),  INT16_C(  2485),
+      -INT16_C( 14943),  INT16_C( 22693), -INT16_C( 30718), -INT16_C( 16434),  INT16_C(  4844),  INT16_C( 10152),  INT16_C(    40), -INT16_C( 14562),
+      -INT16_C( 25540),  INT16_C( 24400),  INT16_C( 27869), -INT16_C(  1633),  INT16_C( 19574),  INT16_C( 18452), -INT16_C( 13645),  INT16_C( 21586),
+      -INT16_C(  2161), -INT16_C( 28244),  INT16_C( 31615),  INT16_C( 27473), -INT16_C(  1651), -INT16_C( 19054), -INT16_C( 20231),  INT16_C( 13949),
+      -INT16_C( 12979),  INT16_C( 10901),  INT16_C( 13625), -INT16_C( 20445),  INT16_C( 14465),  INT16_C( 13560),  INT16_C( 18946), -INT16_C( 28280),
+       INT16_C( 13633), -INT16_C( 16094),  INT16_C( 29616),  INT16_C( 15660), -INT16_C( 16531),  INT16_C( 26355),  INT16_C( 28783), -INT16_C( 17252),
+       INT16_C( 12861),  INT16_C( 30694),  INT16_C(  2663), -INT16_C(  6105),  INT16_C(  8002),  INT16_C( 17436), -INT16_C( 23446), -INT16_C( 21547),
+      -INT16_C(  2087), -INT16_C( 30356), -INT16_C( 26261), -INT16_C( 10041), -INT16_C( 17832), -INT16_C( 14530), -INT16_C(  9430),  INT16_C( 26500),
+       INT16_C( 27149),  INT16_C( 29918),  INT16_C(  1396), -INT16_C( 18852),  INT16_C( 30757), -INT16_C( 28678), -INT16_C( 12516), -INT16_C(  2502),
+      -INT16_C( 22585),  INT16_C( 12927),  INT16_C( 17984), -INT16_C( 26614),  INT16_C( 18432),  INT16_C( 10847), -INT16_C(  7389),  INT16_C( 12434),
+       INT16_C( 28750), -INT16_C( 15708),  INT16_C(   118), -INT16_C( 25735),  INT16_C( 29560), -INT16_C( 27350),  INT16_C( 25667),  INT16_C(  2699),
+       INT16_C(  2571),  INT16_C( 19260),  INT16_C( 18001),  INT16_C( 20963),  INT16_C( 17294), -INT16_C( 19844),  INT16_C(  3622),  INT16_C( 29922),
+      -INT16_C( 30850), -INT16_C(  3017), -INT16_C( 20345),  INT16_C(   143), -INT16_C( 18141),  INT16_C( 26261),  INT16_C(  8222),  INT16_C( 10608),
+      -INT16_C( 21462),  INT16_C( 31605),  INT16_C( 22770), -INT16_C( 32307),  INT16_C( 18843), -INT16_C( 15821),  INT16_C(  5463), -INT16_C( 10954),
+       INT16_C( 28060),  INT16_C(  9418),  INT16_C( 22813),  INT16_C( 16676), -INT16_C( 18157),  INT16_C( 12711),  INT16_C(  6361),  INT16_C(   858),
+      -INT16_C( 12348), -INT16_C( 18561),  INT16_C( 19496), -INT16_C( 15560),  INT16_C( 27541), -INT16_C(  4987), -INT16_C( 17280),  INT16_C(  7617),
+      -INT16_C( 29911),  INT16_C( 18241),  INT16_C( 26085), -INT16_C(  1912),  INT16_C( 12062), -INT16_C(  2263), -INT16_C( 31929),  INT16_C(  3322),
+       INT16_C( 31059),  INT16_C( 31683), -INT16_C(  1083),  INT16_C( 23102), -INT16_C( 15258), -INT16_C(  6586),  INT16_C(  2176), -INT16_C( 22269),
+       INT16_C( 17555),  INT16_C( 30960),  INT16_C( 30889), -INT16_C( 14480), -INT16_C( 26200), -INT16_C(  4162), -INT16_C( 18147),  INT16_C( 28923),
+      -INT16_C( 16846), -INT16_C(  1813),  INT16_C( 10681),  INT16_C(  8018), -INT16_C( 26131),  INT16_C( 27910),  INT16_C(  2465),  INT16_C( 13335),
+       INT16_C(  1870), -INT16_C(  2131),  INT16_C(  7552),  INT16_C( 10431),  INT16_C( 32183), -INT16_C( 11241),  INT16_C(  4918),  INT16_C( 26948),
+       INT16_C( 12241), -INT16_C( 29855), -INT16_C( 19624),  INT16_C( 18090), -INT16_C( 20404), -INT16_C(  4685), -INT16_C( 13638),  INT16_C(  2082),
+      -INT16_C( 12334),  INT16_C( 21247), -INT16_C( 16660), -INT16_C( 23686), -INT16_C( 28356),  INT16_C( 29303), -INT16_C( 17500),  INT16_C( 30427),
+       INT16_C( 15594),  INT16_C( 17153), -INT16_C( 21520),  INT16_C( 15497),  INT16_C( 15452),  INT16_C(  5674),  INT16_C( 19463), -INT16_C(  9954),
+       INT16_C(  7451),  INT16_C(  1835), -INT16_C( 23076),  INT16_C(  6315),  INT16_C(  8758), -INT16_C(  9334),  INT16_C( 26334), -INT16_C( 14255),
+       INT16_C( 21154), -INT16_C( 28149), -INT16_C( 27395),  INT16_C( 22991), -INT16_C(  1583), -INT16_C( 10129), -INT16_C( 29371),  INT16_C( 24753),
+      -INT16_C(  9045), -INT16_C( 30873),  INT16_C(  4737), -INT16_C( 18529),  INT16_C( 10549),  INT16_C(  5010), -INT16_C(  7281),  INT16_C( 13019),
+      -INT16_C(  6347),  INT16_C( 13252) };
+  static const int16_t b[] =
+    { -INT16_C( 13626),  INT16_C( 29020),  INT16_C( 17957), -INT16_C( 22190),  INT16_C( 17858),  INT16_C(  8892),  INT16_C(   532), -INT16_C( 13640),
+      -INT16_C( 32756), -INT16_C( 22020),  INT16_C( 31445),  INT16_C(  9939), -INT16_C( 12516), -INT16_C( 27647),  INT16_C(  4348), -INT16_C( 15682),
+       INT16_C(  6874), -INT16_C(   205), -INT16_C( 31392),  INT16_C(  8872),  INT16_C( 26059), -INT16_C(  8379), -INT16_C(   665),  INT16_C( 29610),
+      -INT16_C( 22915),  INT16_C( 21276), -INT16_C(  4064),  INT16_C( 15481),  INT16_C( 31423), -INT16_C( 17455), -INT16_C( 28790),  INT16_C( 25981),
+      -INT16_C( 20311),  INT16_C(  2404),  INT16_C(  3382),  INT16_C(   299),  INT16_C( 28786), -INT16_C(  9760), -INT16_C( 30099), -INT16_C(  5300),
+       INT16_C( 26672),  INT16_C( 20542), -INT16_C( 18600),  INT16_C(  6029),  INT16_C( 24114), -INT16_C( 17198),  INT16_C( 20461), -INT16_C( 27103),
+      -INT16_C( 31232),  INT16_C( 13983), -INT16_C( 13677),  INT16_C(  1335),  INT16_C(  5947), -INT16_C( 22306),  INT16_C( 10914), -INT16_C( 11629),
+      -INT16_C( 11886), -INT16_C(  5341), -INT16_C( 20343), -INT16_C( 17662), -INT16_C( 10994), -INT16_C(  1161), -INT16_C( 26332),  INT16_C(  9361),
+       INT16_C( 12319), -INT16_C( 19878), -INT16_C( 28166),  INT16_C( 13751), -INT16_C( 27223),  INT16_C( 19422),  INT16_C( 29119),  INT16_C( 20765),
+       INT16_C( 16451), -INT16_C( 13252),  INT16_C( 16368), -INT16_C(   377), -INT16_C(   492),  INT16_C( 14585), -INT16_C( 30057), -INT16_C( 18851),
+      -INT16_C( 18502), -INT16_C( 19096),  INT16_C(  8009), -INT16_C(  3350), -INT16_C( 14156),  INT16_C( 29501),  INT16_C( 23098),  INT16_C( 32197),
+       INT16_C(   411), -INT16_C( 29879), -INT16_C( 12224),  INT16_C( 21642), -INT16_C( 31794),  INT16_C( 26253), -INT16_C(  5618), -INT16_C( 14308),
+      -INT16_C( 31327), -INT16_C(  5507),  INT16_C( 26788),  INT16_C( 23004),  INT16_C(  6448),  INT16_C( 27340), -INT16_C( 28300),  INT16_C(  4071),
+       INT16_C( 12435), -INT16_C( 11366),  INT16_C(  9216), -INT16_C( 12504), -INT16_C( 19032), -INT16_C( 18891),  INT16_C( 20895),  INT16_C( 16510),
+      -INT16_C(   810),  INT16_C( 31531),  INT16_C(  1892), -INT16_C( 27436), -INT16_C( 24543), -INT16_C( 27137), -INT16_C(  6606), -INT16_C( 14940),
+       INT16_C( 15895),  INT16_C(  6040), -INT16_C( 16285),  INT16_C(  3046),  INT16_C(  7029),  INT16_C(  5313),  INT16_C( 16237),  INT16_C( 17237),
+      -INT16_C( 32709), -INT16_C( 24642), -INT16_C( 28025), -INT16_C( 22476),  INT16_C( 13107),  INT16_C( 25917), -INT16_C(  7911),  INT16_C( 12330),
+      -INT16_C( 15840), -INT16_C( 31928),  INT16_C( 11907), -INT16_C(  1906),  INT16_C( 20298), -INT16_C( 18675),  INT16_C( 25230), -INT16_C( 13574),
+      -INT16_C( 17950),  INT16_C( 26985), -INT16_C( 25269),  INT16_C( 32274),  INT16_C( 20432), -INT16_C(  5405),  INT16_C(  3377),  INT16_C( 20762),
+       INT16_C( 25296),  INT16_C( 21460),  INT16_C( 25233), -INT16_C(  9397),  INT16_C( 22705),  INT16_C( 16274), -INT16_C( 29510), -INT16_C( 25591),
+       INT16_C( 29509), -INT16_C( 28410),  INT16_C(  6160), -INT16_C(  7921), -INT16_C(  3225), -INT16_C( 26421), -INT16_C(  6912), -INT16_C( 12055),
+      -INT16_C( 17080), -INT16_C(  9949),  INT16_C( 28447), -INT16_C( 12108),  INT16_C( 18119), -INT16_C( 32240),  INT16_C(  6610),  INT16_C(  6174),
+       INT16_C(  9356), -INT16_C( 25175), -INT16_C( 18372), -INT16_C( 23426),  INT16_C( 18859), -INT16_C( 21444),  INT16_C(  9774),  INT16_C( 30332),
+      -INT16_C( 24349),  INT16_C(   847),  INT16_C(   783), -INT16_C( 10541), -INT16_C(  7351),  INT16_C(  7256),  INT16_C( 30717), -INT16_C( 30412),
+      -INT16_C(  8805), -INT16_C( 10202), -INT16_C( 23403),  INT16_C( 16764), -INT16_C( 18195),  INT16_C(  7405),  INT16_C( 27102), -INT16_C( 15726),
+      -INT16_C(  7671),  INT16_C(  6341), -INT16_C( 26395),  INT16_C( 12271),  INT16_C( 18300),  INT16_C( 31051),  INT16_C( 32702),  INT16_C( 23042),
+       INT16_C( 10588), -INT16_C(  3790), -INT16_C( 20787), -INT16_C( 17614),  INT16_C(  8038),  INT16_C( 17879),  INT16_C( 27017), -INT16_C( 28153),
+      -INT16_C( 13237),  INT16_C( 12715), -INT16_C( 26012), -INT16_C(  8096), -INT16_C( 21535), -INT16_C( 24487),  INT16_C( 23594), -INT16_C( 30982),
+       INT16_C( 11397),  INT16_C( 21111), -INT16_C( 21798),  INT16_C( 16397), -INT16_C(  6967),  INT16_C( 21125), -INT16_C( 29618), -INT16_C( 26139),
+      -INT16_C( 28584), -INT16_C( 16950),  INT16_C( 10794),  INT16_C(  2973), -INT16_C(  2091), -INT16_C(    85), -INT16_C( 23213), -INT16_C( 10107),
+      -INT16_C(   559), -INT16_C( 21718),  INT16_C( 14503),  INT16_C( 28908),  INT16_C( 28956),  INT16_C( 27331), -INT16_C( 22274),  INT16_C( 22020),
+      -INT16_C( 12744),  INT16_C( 25107), -INT16_C( 19975), -INT16_C( 12691),  INT16_C(  6568), -INT16_C(  1074),  INT16_C( 21438), -INT16_C( 28461),
+      -INT16_C(   688), -INT16_C(  2245),  INT16_C( 10037),  INT16_C( 21096),  INT16_C( 11161), -INT16_C( 26692), -INT16_C( 16173),  INT16_C(  3053),
+       INT16_C(   399), -INT16_C( 30611), -INT16_C(  9550),  INT16_C( 23126),  INT16_C(  9459), -INT16_C( 19883),  INT16_C( 10360), -INT16_C( 14270),
+       INT16_C( 32037),  INT16_C( 23488),  INT16_C( 10405),  INT16_C( 16045),  INT16_C( 26963),  INT16_C(  9941), -INT16_C( 15830), -INT16_C( 18127),
+      -INT16_C( 24893),  INT16_C( 30017), -INT16_C( 26760),  INT16_C( 27855),  INT16_C(  9404),  INT16_C( 13342),  INT16_C( 24652),  INT16_C( 29436),
+      -INT16_C( 17187), -INT16_C( 32051),  INT16_C( 31460),  INT16_C( 14272), -INT16_C( 27165),  INT16_C(  3421), -INT16_C( 29096),  INT16_C(  7110),
+       INT16_C(  1836), -INT16_C( 23151),  INT16_C( 24735),  INT16_C( 23313),  INT16_C( 12165), -INT16_C( 11889), -INT16_C( 29809),  INT16_C( 27715),
+       INT16_C(  4168),  INT16_C( 11503), -INT16_C( 20598),  INT16_C( 28260), -INT16_C( 16059), -INT16_C( 25221),  INT16_C( 16976),  INT16_C( 31928),
+       INT16_C( 18761), -INT16_C(  6111),  INT16_C( 12970),  INT16_C( 12099), -INT16_C( 11679), -INT16_C(  4096),  INT16_C( 17502), -INT16_C( 22947),
+       INT16_C( 19540), -INT16_C(  8238),  INT16_C( 14075),  INT16_C( 16461), -INT16_C( 14088),  INT16_C( 18653), -INT16_C( 27126),  INT16_C( 21700),
+      -INT16_C(  6433), -INT16_C( 30404), -INT16_C( 32744),  INT16_C( 31416), -INT16_C( 18094), -INT16_C( 20374), -INT16_C( 14339),  INT16_C( 20822),
+       INT16_C( 10515),  INT16_C(  3888),  INT16_C( 32095),  INT16_C( 22351),  INT16_C( 11590),  INT16_C( 20639),  INT16_C( 25795), -INT16_C( 23900),
+      -INT16_C(  7862),  INT16_C( 25132), -INT16_C(  7071), -INT16_C( 19492),  INT16_C( 18333), -INT16_C( 26012), -INT16_C( 17906),  INT16_C(  8940),
+       INT16_C(  7395),  INT16_C( 17201), -INT16_C( 32614), -INT16_C(  8038),  INT16_C( 15021),  INT16_C( 28720), -INT16_C( 10850), -INT16_C(  6125),
+       INT16_C( 16310),  INT16_C(  5962),  INT16_C( 10019), -INT16_C( 15926),  INT16_C( 11886),  INT16_C( 31835),  INT16_C( 18409), -INT16_C( 13154),
+      -INT16_C( 12444), -INT16_C(   497), -INT16_C( 21936), -INT16_C(   546),  INT16_C(  3812), -INT16_C( 32146), -INT16_C( 32285), -INT16_C( 26262),
+      -INT16_C( 19264), -INT16_C(  7248),  INT16_C( 31707),  INT16_C( 18852),  INT16_C(   169), -INT16_C( 27962),  INT16_C( 25671), -INT16_C( 21665),
+       INT16_C( 28212), -INT16_C( 31575), -INT16_C( 30952), -INT16_C(   895), -INT16_C(  4202),  INT16_C( 31102), -INT16_C(  6032),  INT16_C( 12307),
+      -INT16_C( 15459),  INT16_C( 30740), -INT16_C( 18370), -INT16_C(  5950), -INT16_C( 30536),  INT16_C(   122), -INT16_C(  9748),  INT16_C(  8363),
+       INT16_C( 21832),  INT16_C( 24740),  INT16_C(  9948),  INT16_C( 29277), -INT16_C(  9451), -INT16_C( 30996), -INT16_C(    60),  INT16_C( 25014),
+      -INT16_C( 13630),  INT16_C(   473), -INT16_C( 25725),  INT16_C( 15337),  INT16_C( 25379),  INT16_C(  4155), -INT16_C(  6339), -INT16_C( 31440),
+      -INT16_C( 10948),  INT16_C(  6373),  INT16_C( 17147),  INT16_C(  4235),  INT16_C( 30494), -INT16_C(  7530),  INT16_C( 19830),  INT16_C( 14403),
+       INT16_C(  7191), -INT16_C( 26055),  INT16_C(  8888), -INT16_C(  9258),  INT16_C(  4486), -INT16_C( 15381),  INT16_C(  7416),  INT16_C( 13384),
+       INT16_C( 11761), -INT16_C(  5043), -INT16_C( 10128), -INT16_C( 28932), -INT16_C( 27825), -INT16_C( 14992), -INT16_C( 19488), -INT16_C(  2051),
+       INT16_C( 14287), -INT16_C( 30830),  INT16_C( 26713), -INT16_C(  8349),  INT16_C( 20089),  INT16_C( 29346), -INT16_C(  5526),  INT16_C( 23462),
+      -INT16_C(  3304), -INT16_C( 30649),  INT16_C( 17611),  INT16_C(  6678), -INT16_C( 31017), -INT16_C( 18465), -INT16_C(  8903),  INT16_C(  2222),
+       INT16_C( 16404),  INT16_C( 28048), -INT16_C(  3160),  INT16_C(  8781), -INT16_C(  4287), -INT16_C( 21356),  INT16_C( 15066), -INT16_C(  3577),
+       INT16_C( 20270), -INT16_C(  1670), -INT16_C( 28525),  INT16_C( 27156), -INT16_C(  3306),  INT16_C( 20257), -INT16_C( 12336), -INT16_C(  7081),
+      -INT16_C(  6384), -INT16_C( 18350), -INT16_C( 24614),  INT16_C(  7386),  INT16_C( 28302),  INT16_C( 26824), -INT16_C( 12375), -INT16_C( 10406),
+      -INT16_C( 11234), -INT16_C( 20016), -INT16_C(  7068),  INT16_C( 31259),  INT16_C( 15576), -INT16_C( 22327),  INT16_C(  8460),  INT16_C(  7309),
+      -INT16_C(  8440), -INT16_C(  7212) };
+  static const int16_t e[] =
+    { -INT16_C( 13626),  INT16_C( 29020),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17858),  INT16_C(  8892),  INT16_C( 16804),  INT16_C(     0),
+       INT16_C( 24682), -INT16_C( 17354),  INT16_C( 31445),  INT16_C(     0), -INT16_C(  2921),  INT16_C( 13992),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(   205),  INT16_C(  1730),  INT16_C(     0),  INT16_C( 26059), -INT16_C(  8074),  INT16_C( 29653),  INT16_C( 29610),
+      -INT16_C(  3885),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 31423),  INT16_C( 27503), -INT16_C( 13045),  INT16_C(     0),
+      -INT16_C(   791),  INT16_C(     0),  INT16_C(  3382),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10162),  INT16_C(     0),
+       INT16_C( 26672),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 24114), -INT16_C(  5348),  INT16_C( 20461),  INT16_C(     0),
+       INT16_C( 13882),  INT16_C(     0), -INT16_C(  9282),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1484),  INT16_C( 10914),  INT16_C(     0),
+      -INT16_C(  6613),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28253),  INT16_C(     0),  INT16_C( 27309),  INT16_C(     0),
+       INT16_C( 32417),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19422),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 16451),  INT16_C(  1744),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30433),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(  8009),  INT16_C(  8031),  INT16_C( 30242),  INT16_C( 29501),  INT16_C( 23098),  INT16_C(     0),
+       INT16_C(  9268),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21642),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14618),  INT16_C(  3715),
+       INT16_C( 25986),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20786),  INT16_C(     0),  INT16_C(  7676),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 28230),  INT16_C(     0),  INT16_C( 29458),  INT16_C( 11365),  INT16_C( 20895),  INT16_C( 16510),
+       INT16_C(     0),  INT16_C( 31531),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11351),  INT16_C(     0),
+       INT16_C( 15895),  INT16_C(  6040),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7029),  INT16_C(  5313),  INT16_C( 16237),  INT16_C(     0),
+       INT16_C( 26969),  INT16_C(     0),  INT16_C( 20875), -INT16_C(   203),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 12458),  INT16_C(     0),  INT16_C(  3466),  INT16_C(     0), -INT16_C( 16723),  INT16_C(     0),  INT16_C( 11471),
+       INT16_C(     0),  INT16_C( 29146),  INT16_C(  4095),  INT16_C(     0),  INT16_C( 20432),  INT16_C(     0),  INT16_C(  3377),  INT16_C( 20762),
+       INT16_C(     0),  INT16_C( 21460),  INT16_C( 25233),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30620),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 32025),  INT16_C(     0),  INT16_C(  6160),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6912),  INT16_C(     0),
+       INT16_C( 19868),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12108),  INT16_C( 18119), -INT16_C(  5124),  INT16_C(     0),  INT16_C( 32422),
+       INT16_C(     0), -INT16_C( 22377),  INT16_C( 14958),  INT16_C(     0),  INT16_C( 18859),  INT16_C( 16726),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 12057),  INT16_C(     0),  INT16_C(   783), -INT16_C( 10541),  INT16_C(     0),  INT16_C( 21138),  INT16_C( 30717),  INT16_C(     0),
+       INT16_C( 26378),  INT16_C( 30891),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15047),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16878),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 23042),
+       INT16_C( 11723),  INT16_C( 27963),  INT16_C(     0), -INT16_C(  3494),  INT16_C(  8038),  INT16_C( 17879),  INT16_C( 27248),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 12715),  INT16_C( 24371),  INT16_C(     0), -INT16_C(  3872), -INT16_C( 24487),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 11397),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16397),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 31752),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2973),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1111),
+       INT16_C(     0),  INT16_C( 30392),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 27331),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 28828),  INT16_C( 30080),  INT16_C(     0),  INT16_C(     0),  INT16_C( 32704),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28369),
+      -INT16_C(   688), -INT16_C(  2245),  INT16_C( 10037),  INT16_C( 21096),  INT16_C(     0),  INT16_C(     0), -INT16_C( 14338),  INT16_C(  3053),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10360), -INT16_C(  2217),
+       INT16_C( 32037),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16411),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 14943),  INT16_C( 30017),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9404),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29436),
+      -INT16_C( 17187),  INT16_C(     0),  INT16_C( 31460),  INT16_C( 14272),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13645),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 23151),  INT16_C(     0),  INT16_C( 27473),  INT16_C(     0), -INT16_C( 11889), -INT16_C( 20231),  INT16_C(     0),
+       INT16_C(  4168),  INT16_C( 11503),  INT16_C(     0),  INT16_C( 28260),  INT16_C(     0),  INT16_C( 13560),  INT16_C( 18946),  INT16_C(     0),
+       INT16_C( 18761),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15660), -INT16_C( 11679),  INT16_C(     0),  INT16_C(     0), -INT16_C( 17252),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8002),  INT16_C( 18653), -INT16_C( 23446),  INT16_C(     0),
+      -INT16_C(  2087), -INT16_C( 30356),  INT16_C(     0),  INT16_C( 31416), -INT16_C( 17832),  INT16_C(     0),  INT16_C(     0),  INT16_C( 26500),
+       INT16_C( 27149),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22351),  INT16_C( 30757),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(  7862),  INT16_C( 25132),  INT16_C(     0),  INT16_C(     0),  INT16_C( 18432),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28720),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 18001),  INT16_C( 20963),  INT16_C(     0),  INT16_C( 31835),  INT16_C( 18409),  INT16_C(     0),
+      -INT16_C( 12444), -INT16_C(   497),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3812),  INT16_C(     0),  INT16_C(  8222),  INT16_C( 10608),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 18852),  INT16_C( 18843),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10954),
+       INT16_C( 28212),  INT16_C(     0),  INT16_C( 22813),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  6361),  INT16_C( 12307),
+      -INT16_C( 12348),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 27541),  INT16_C(   122), -INT16_C(  9748),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 26085),  INT16_C(     0),  INT16_C( 12062), -INT16_C(  2263), -INT16_C(    60),  INT16_C( 25014),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  1083),  INT16_C(     0),  INT16_C( 25379),  INT16_C(  4155),  INT16_C(  2176), -INT16_C( 22269),
+       INT16_C( 17555),  INT16_C(     0),  INT16_C( 30889),  INT16_C(  4235),  INT16_C( 30494), -INT16_C(  4162),  INT16_C( 19830),  INT16_C( 28923),
+       INT16_C(     0), -INT16_C(  1813),  INT16_C( 10681),  INT16_C(  8018),  INT16_C(  4486),  INT16_C( 27910),  INT16_C(  7416),  INT16_C(     0),
+       INT16_C( 11761),  INT16_C(     0),  INT16_C(  7552),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4918),  INT16_C( 26948),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20089),  INT16_C(     0), -INT16_C(  5526),  INT16_C( 23462),
+      -INT16_C(  3304),  INT16_C(     0),  INT16_C( 17611),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29303),  INT16_C(     0),  INT16_C( 30427),
+       INT16_C( 16404),  INT16_C( 28048), -INT16_C(  3160),  INT16_C( 15497),  INT16_C( 15452),  INT16_C(  5674),  INT16_C( 19463),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 18350),  INT16_C(     0),  INT16_C( 22991),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12375),  INT16_C(     0),
+      -INT16_C(  9045), -INT16_C( 20016),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13019),
+      -INT16_C(  6347),  INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_s16_z(pv, av, bv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+
+    ev = simde_svmax_s16_z(pv, av, bv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0) };
+  static const int16_t a[] =
+    { -INT16_C( 18768), -INT16_C( 17760), -INT16_C( 19976), -INT16_C( 31256), -INT16_C(  5202),  INT16_C( 18898), -INT16_C( 14745), -INT16_C( 11704),
+      -INT16_C( 11831), -INT16_C(  9609), -INT16_C(  4603), -INT16_C( 22617), -INT16_C( 19242), -INT16_C(  9509), -INT16_C( 21833),  INT16_C( 26797),
+       INT16_C( 19808),  INT16_C( 22562),  INT16_C(  2815), -INT16_C( 21026), -INT16_C( 20235),  INT16_C( 23798),  INT16_C( 15990),  INT16_C( 16430),
+      -INT16_C( 23025),  INT16_C(  5146), -INT16_C( 15980),  INT16_C( 27324), -INT16_C( 26762),  INT16_C( 11588), -INT16_C(  3519), -INT16_C( 24171),
+      -INT16_C( 18625),  INT16_C( 16122), -INT16_C( 10047), -INT16_C( 18709), -INT16_C(  7800), -INT16_C(   493),  INT16_C( 16671),  INT16_C( 11838),
+       INT16_C( 23015),  INT16_C( 31555), -INT16_C(   230), -INT16_C( 28442),  INT16_C( 10902), -INT16_C( 10306),  INT16_C( 21276),  INT16_C( 23672),
+       INT16_C( 29195), -INT16_C( 13158), -INT16_C( 31158), -INT16_C( 11645), -INT16_C( 27033), -INT16_C( 30767),  INT16_C(  4055), -INT16_C( 16459),
+      -INT16_C(  1944), -INT16_C( 31942),  INT16_C(  8439), -INT16_C( 29421), -INT16_C( 11957),  INT16_C( 26468), -INT16_C(  8923),  INT16_C( 12483),
+       INT16_C( 24143), -INT16_C( 25860),  INT16_C( 32740),  INT16_C( 19308),  INT16_C( 15637), -INT16_C(  4654), -INT16_C( 30643), -INT16_C( 19028),
+      -INT16_C(  6528),  INT16_C( 30776),  INT16_C( 19463),  INT16_C( 20997),  INT16_C( 27165),  INT16_C( 17081),  INT16_C( 32071), -INT16_C( 27022),
+       INT16_C( 28635), -INT16_C( 16592), -INT16_C( 25106),  INT16_C(  1034), -INT16_C(  8742),  INT16_C( 10225), -INT16_C( 25243), -INT16_C(  6691),
+       INT16_C(  5507), -INT16_C( 30115),  INT16_C( 25441),  INT16_C( 32732), -INT16_C( 26931),  INT16_C(  5313),  INT16_C( 13331), -INT16_C(  4438),
+      -INT16_C(  9309), -INT16_C( 28243), -INT16_C( 18568),  INT16_C( 21141), -INT16_C( 31084), -INT16_C(  1670),  INT16_C( 22307), -INT16_C( 22561),
+       INT16_C( 15468), -INT16_C( 12751),  INT16_C(  3743),  INT16_C( 27725),  INT16_C(  3748), -INT16_C( 18560),  INT16_C( 11074), -INT16_C(  6747),
+       INT16_C( 20998),  INT16_C( 32375),  INT16_C(  3081), -INT16_C( 24880),  INT16_C( 19091), -INT16_C( 18793),  INT16_C( 30369),  INT16_C(  3677),
+      -INT16_C( 28749),  INT16_C( 21212),  INT16_C( 10653),  INT16_C( 16831),  INT16_C( 16183),  INT16_C( 31480), -INT16_C( 25238),  INT16_C( 28767),
+      -INT16_C( 10513), -INT16_C(  1810), -INT16_C( 16413),  INT16_C( 30358),  INT16_C( 11785), -INT16_C( 21716), -INT16_C( 30044),  INT16_C( 22457),
+      -INT16_C( 27367), -INT16_C( 18774),  INT16_C( 27070), -INT16_C(  2569), -INT16_C(  4184),  INT16_C(  4975), -INT16_C( 12404),  INT16_C( 31619),
+       INT16_C( 29349), -INT16_C( 30605),  INT16_C(  2609),  INT16_C( 15102),  INT16_C( 11064), -INT16_C(  8987), -INT16_C( 24907), -INT16_C( 12748),
+      -INT16_C(  8653), -INT16_C(  3708),  INT16_C( 31559), -INT16_C(  4121),  INT16_C( 22122), -INT16_C(  2558), -INT16_C( 31195), -INT16_C( 13455),
+      -INT16_C(  6920),  INT16_C( 10579),  INT16_C( 21230),  INT16_C(  9827),  INT16_C( 18813),  INT16_C( 12803),  INT16_C( 14311),  INT16_C(  6912),
+      -INT16_C( 31723),  INT16_C( 23564), -INT16_C(  3073),  INT16_C( 26955),  INT16_C( 20042),  INT16_C( 28511), -INT16_C( 12076), -INT16_C( 13254),
+      -INT16_C( 29004), -INT16_C( 23563),  INT16_C( 22752),  INT16_C( 24009), -INT16_C( 13151), -INT16_C( 30321), -INT16_C( 28925),  INT16_C(  6308),
+      -INT16_C( 20461),  INT16_C(  4724), -INT16_C( 16220), -INT16_C(  4485), -INT16_C(  9714), -INT16_C(  7587), -INT16_C( 26454),  INT16_C( 24238),
+      -INT16_C( 23770),  INT16_C(  1537), -INT16_C( 13317), -INT16_C( 25245), -INT16_C(  3433), -INT16_C( 25818), -INT16_C( 13695), -INT16_C( 27469),
+       INT16_C( 10362),  INT16_C(  7846),  INT16_C(  8680), -INT16_C(  2548),  INT16_C( 27387), -INT16_C( 23080), -INT16_C( 31230),  INT16_C( 10243),
+       INT16_C(  1321),  INT16_C(  9262), -INT16_C( 28208),  INT16_C( 26561), -INT16_C(  6269),  INT16_C(  1026), -INT16_C( 18767),  INT16_C( 11416),
+       INT16_C( 16094), -INT16_C( 14774),  INT16_C( 22367),  INT16_C( 23228), -INT16_C( 27455), -INT16_C( 15361),  INT16_C(   538),  INT16_C( 17387),
+       INT16_C(  6407), -INT16_C( 10393),  INT16_C( 10666),  INT16_C( 11583),  INT16_C( 16656), -INT16_C( 15823), -INT16_C( 13833), -INT16_C( 10770),
+       INT16_C( 14343),  INT16_C( 26267),  INT16_C( 22415),  INT16_C( 20672), -INT16_C( 16405),  INT16_C(  1299), -INT16_C(   319), -INT16_C( 14008),
+      -INT16_C( 20457), -INT16_C( 15968), -INT16_C(  8231), -INT16_C(  5650),  INT16_C(  7969),  INT16_C(  6315), -INT16_C( 26136), -INT16_C(  4114),
+      -INT16_C( 30254),  INT16_C( 24917),  INT16_C(  5601), -INT16_C( 13134), -INT16_C( 14892), -INT16_C( 26926),  INT16_C(  6852), -INT16_C(  9377),
+      -INT16_C(    54), -INT16_C( 23651), -INT16_C( 29729),  INT16_C(   141),  INT16_C( 14507), -INT16_C( 27880),  INT16_C(  1746), -INT16_C( 23421),
+      -INT16_C( 10096),  INT16_C( 28933), -INT16_C( 18450), -INT16_C( 15811),  INT16_C(  3965),  INT16_C( 16728), -INT16_C( 18646), -INT16_C(  3044),
+      -INT16_C( 17993), -INT16_C( 26984),  INT16_C(  9541), -INT16_C(  3946), -INT16_C( 20899),  INT16_C( 12163),  INT16_C(  1717),  INT16_C( 17875),
+      -INT16_C(  9761), -INT16_C( 12874), -INT16_C(  3184),  INT16_C(  3471), -INT16_C(  6141),  INT16_C( 11598),  INT16_C( 27551),  INT16_C( 22049),
+      -INT16_C( 18140),  INT16_C( 27116), -INT16_C( 32034),  INT16_C( 15449), -INT16_C(  8911), -INT16_C(  6549),  INT16_C( 16355), -INT16_C( 15829),
+      -INT16_C(  7912), -INT16_C( 22385),  INT16_C(  8148), -INT16_C( 10314),  INT16_C(  1031), -INT16_C( 23036),  INT16_C(  9839), -INT16_C( 27395),
+      -INT16_C(  5665), -INT16_C( 16643),  INT16_C( 22380), -INT16_C( 25094),  INT16_C( 25908),  INT16_C(  6019), -INT16_C( 20828), -INT16_C( 17190),
+       INT16_C( 27023),  INT16_C( 25445),  INT16_C(  7048), -INT16_C( 28869),  INT16_C( 16159), -INT16_C( 28874),  INT16_C( 13157),  INT16_C( 17699),
+       INT16_C(  8220), -INT16_C( 30717), -INT16_C(   649), -INT16_C( 21723), -INT16_C( 22430),  INT16_C(  1987), -INT16_C( 25258), -INT16_C(  6717),
+       INT16_C( 10246), -INT16_C( 28855), -INT16_C( 31677),  INT16_C( 25374),  INT16_C( 21699),  INT16_C( 10738),  INT16_C(  5511), -INT16_C( 23442),
+       INT16_C( 28981), -INT16_C( 21204),  INT16_C( 21102), -INT16_C( 12200),  INT16_C(  7162),  INT16_C( 20951), -INT16_C( 25672), -INT16_C( 16586),
+       INT16_C( 32707) };
+  static const int16_t b[] =
+    { -INT16_C( 25661), -INT16_C( 26419), -INT16_C(  9353), -INT16_C( 31207), -INT16_C( 12150),  INT16_C(  5577),  INT16_C(  3851), -INT16_C(  6835),
+       INT16_C( 12400), -INT16_C( 10510),  INT16_C(  4213),  INT16_C(  6214), -INT16_C( 15433), -INT16_C( 29792),  INT16_C(  2074), -INT16_C(  8778),
+      -INT16_C( 31837),  INT16_C(  6774), -INT16_C( 28834), -INT16_C(  5984),  INT16_C( 27231),  INT16_C( 27389),  INT16_C( 19065), -INT16_C(  5809),
+       INT16_C( 16763), -INT16_C(  3905),  INT16_C(  1361),  INT16_C(  2056), -INT16_C( 22327), -INT16_C(  7276),  INT16_C( 19120),  INT16_C( 21440),
+       INT16_C( 14029),  INT16_C( 11117),  INT16_C(  3781),  INT16_C(  9491),  INT16_C(  4216), -INT16_C(  3697), -INT16_C(  8358), -INT16_C( 10790),
+      -INT16_C( 26336),  INT16_C( 29381), -INT16_C( 12641),  INT16_C( 26746),  INT16_C(  3702),  INT16_C( 10059),  INT16_C(  2904),  INT16_C(  9594),
+      -INT16_C(  6078),  INT16_C(  1872),  INT16_C( 25590),  INT16_C( 28204), -INT16_C( 17293), -INT16_C( 12705),  INT16_C( 14747), -INT16_C( 17501),
+       INT16_C( 27090),  INT16_C( 28973), -INT16_C( 22473), -INT16_C( 21031),  INT16_C(  9398),  INT16_C(  4052),  INT16_C( 20272),  INT16_C( 29236),
+      -INT16_C( 31433),  INT16_C( 11641), -INT16_C( 22808),  INT16_C( 23707), -INT16_C(  1438), -INT16_C(   726), -INT16_C( 13005),  INT16_C(  1464),
+      -INT16_C(  6602),  INT16_C( 28023),  INT16_C( 20622),  INT16_C( 17435), -INT16_C(  4235), -INT16_C( 23213), -INT16_C( 30658),  INT16_C( 29975),
+      -INT16_C( 28659), -INT16_C(  2654),  INT16_C( 15670), -INT16_C( 26543),  INT16_C( 31543),  INT16_C( 27285),  INT16_C( 20041),  INT16_C( 32624),
+      -INT16_C(  6348), -INT16_C( 15635),  INT16_C(  2103), -INT16_C( 21498),  INT16_C( 23287),  INT16_C( 13905),  INT16_C( 26850), -INT16_C(  4181),
+       INT16_C( 20217),  INT16_C( 12260),  INT16_C( 13963), -INT16_C( 15416),  INT16_C( 23985), -INT16_C(  1491), -INT16_C( 25173), -INT16_C(  8326),
+       INT16_C( 26500), -INT16_C( 17247), -INT16_C( 22417),  INT16_C( 26216), -INT16_C( 17918), -INT16_C(  7012),  INT16_C( 18466),  INT16_C(  7123),
+      -INT16_C( 18538),  INT16_C(  8523),  INT16_C(  5101), -INT16_C( 24604),  INT16_C(  4720),  INT16_C(  7321),  INT16_C(  5039),  INT16_C( 13563),
+      -INT16_C( 25222), -INT16_C(  5648),  INT16_C( 22597),  INT16_C( 18256), -INT16_C(  5102),  INT16_C( 13611), -INT16_C(   460), -INT16_C( 13744),
+      -INT16_C( 25675), -INT16_C( 23572), -INT16_C( 12114),  INT16_C(  8002), -INT16_C(  9246), -INT16_C( 28101),  INT16_C( 14063),  INT16_C( 27078),
+      -INT16_C( 18733),  INT16_C(  6227), -INT16_C( 23794),  INT16_C(  8543), -INT16_C( 30065), -INT16_C( 15274), -INT16_C( 22904),  INT16_C( 16014),
+       INT16_C( 31298), -INT16_C(  3871),  INT16_C(  9035),  INT16_C( 11535),  INT16_C( 19198), -INT16_C(  4673), -INT16_C( 31359),  INT16_C( 21591),
+      -INT16_C( 21957),  INT16_C( 19053), -INT16_C( 13235), -INT16_C(  9109), -INT16_C( 16041), -INT16_C(  8288),  INT16_C( 12135), -INT16_C( 22243),
+      -INT16_C(   343), -INT16_C(  2918), -INT16_C( 22239),  INT16_C(  8226), -INT16_C(  7692),  INT16_C( 29965),  INT16_C( 25703), -INT16_C( 23863),
+       INT16_C( 13838),  INT16_C( 23532),  INT16_C( 22275),  INT16_C( 23096), -INT16_C( 10216), -INT16_C( 32711),  INT16_C( 22279), -INT16_C( 20183),
+      -INT16_C( 15531),  INT16_C( 30629), -INT16_C( 14483),  INT16_C( 24983), -INT16_C( 23383),  INT16_C(  4310), -INT16_C( 24823),  INT16_C(  6066),
+      -INT16_C( 24618), -INT16_C(  9869), -INT16_C( 21514),  INT16_C(  3891),  INT16_C( 27779), -INT16_C( 29809), -INT16_C( 18237),  INT16_C(  6460),
+      -INT16_C(  7812), -INT16_C(  5744),  INT16_C( 10153),  INT16_C( 21066),  INT16_C(  8395), -INT16_C( 11166),  INT16_C(  5311), -INT16_C( 27156),
+       INT16_C( 24499), -INT16_C( 21906), -INT16_C( 24310), -INT16_C( 29255),  INT16_C( 18446), -INT16_C( 12008),  INT16_C( 21504),  INT16_C( 31978),
+       INT16_C( 31286), -INT16_C(  8347), -INT16_C( 20575),  INT16_C( 27953), -INT16_C( 27697), -INT16_C( 28863),  INT16_C( 11687),  INT16_C( 23332),
+      -INT16_C( 27764), -INT16_C( 27131), -INT16_C( 16844),  INT16_C( 16932),  INT16_C( 15366),  INT16_C(  1556), -INT16_C(   367), -INT16_C( 14461),
+      -INT16_C(  6023),  INT16_C(  6822), -INT16_C( 10344),  INT16_C( 26503), -INT16_C( 13974),  INT16_C(  4598),  INT16_C(  7158), -INT16_C( 31892),
+       INT16_C( 29102), -INT16_C(  7655),  INT16_C( 15663),  INT16_C( 13605),  INT16_C( 14714),  INT16_C(  2876), -INT16_C( 16585), -INT16_C( 20270),
+       INT16_C( 30887),  INT16_C( 16331),  INT16_C( 21071), -INT16_C( 18009), -INT16_C( 25317),  INT16_C(  4810),  INT16_C( 14264),  INT16_C( 26261),
+      -INT16_C( 20824), -INT16_C( 10167),  INT16_C( 28396),  INT16_C( 26125),  INT16_C( 18855), -INT16_C(  8591),  INT16_C( 17160), -INT16_C( 20337),
+       INT16_C( 23227),  INT16_C(  2799), -INT16_C( 26964), -INT16_C( 14141), -INT16_C( 29388), -INT16_C(  4902),  INT16_C( 28612),  INT16_C( 27987),
+      -INT16_C( 25571),  INT16_C(  2373),  INT16_C( 21002), -INT16_C( 20113), -INT16_C(  8036), -INT16_C( 23409),  INT16_C(  7715), -INT16_C(  8620),
+       INT16_C( 17528),  INT16_C(  9704), -INT16_C( 21542),  INT16_C(  3821), -INT16_C( 14535), -INT16_C(   517),  INT16_C( 20022),  INT16_C( 21354),
+      -INT16_C( 20502), -INT16_C(  2979), -INT16_C( 13310), -INT16_C( 24923),  INT16_C( 13485), -INT16_C( 12222), -INT16_C( 26797), -INT16_C( 13393),
+      -INT16_C( 26661), -INT16_C( 18960), -INT16_C(  8893),  INT16_C( 31940), -INT16_C( 16476), -INT16_C(  9607), -INT16_C(  7155), -INT16_C(  2258),
+      -INT16_C( 29805), -INT16_C( 27157), -INT16_C( 28585),  INT16_C(  1075),  INT16_C( 30404),  INT16_C(  6101), -INT16_C( 31731), -INT16_C(  5917),
+      -INT16_C( 11493),  INT16_C( 24221),  INT16_C( 25009),  INT16_C( 21978),  INT16_C( 21536),  INT16_C( 11568),  INT16_C( 24120), -INT16_C( 13532),
+       INT16_C(  4073),  INT16_C( 16481), -INT16_C( 27489),  INT16_C( 25669),  INT16_C(  6666),  INT16_C(  6011),  INT16_C( 24222), -INT16_C( 17921),
+      -INT16_C( 25294), -INT16_C(  7400), -INT16_C(  3330),  INT16_C(  7992),  INT16_C( 26694),  INT16_C( 32332),  INT16_C( 29126), -INT16_C( 20662),
+      -INT16_C( 21632),  INT16_C(  8432),  INT16_C( 13631),  INT16_C( 19076), -INT16_C(   177), -INT16_C(  4767),  INT16_C( 24926), -INT16_C( 28506),
+      -INT16_C( 16642), -INT16_C(   909), -INT16_C( 21583), -INT16_C(  2277),  INT16_C( 26644), -INT16_C(  9610), -INT16_C( 16167),  INT16_C( 22922),
+       INT16_C( 31339) };
+  static const int16_t e[] =
+    { -INT16_C( 18768), -INT16_C( 17760), -INT16_C(  9353), -INT16_C( 31207), -INT16_C(  5202),  INT16_C( 18898),  INT16_C(  3851), -INT16_C(  6835),
+       INT16_C( 12400), -INT16_C(  9609),  INT16_C(  4213), -INT16_C( 22617), -INT16_C( 19242), -INT16_C(  9509),  INT16_C(  2074),  INT16_C( 26797),
+       INT16_C( 19808),  INT16_C( 22562),  INT16_C(  2815), -INT16_C( 21026),  INT16_C( 27231),  INT16_C( 27389),  INT16_C( 19065),  INT16_C( 16430),
+      -INT16_C( 23025),  INT16_C(  5146),  INT16_C(  1361),  INT16_C( 27324), -INT16_C( 26762),  INT16_C( 11588), -INT16_C(  3519),  INT16_C( 21440),
+      -INT16_C( 18625),  INT16_C( 16122), -INT16_C( 10047), -INT16_C( 18709),  INT16_C(  4216), -INT16_C(   493),  INT16_C( 16671),  INT16_C( 11838),
+       INT16_C( 23015),  INT16_C( 31555), -INT16_C(   230),  INT16_C( 26746),  INT16_C( 10902), -INT16_C( 10306),  INT16_C( 21276),  INT16_C( 23672),
+       INT16_C( 29195), -INT16_C( 13158), -INT16_C( 31158),  INT16_C( 28204), -INT16_C( 17293), -INT16_C( 30767),  INT16_C(  4055), -INT16_C( 16459),
+      -INT16_C(  1944),  INT16_C( 28973),  INT16_C(  8439), -INT16_C( 21031),  INT16_C(  9398),  INT16_C( 26468), -INT16_C(  8923),  INT16_C( 29236),
+       INT16_C( 24143), -INT16_C( 25860),  INT16_C( 32740),  INT16_C( 23707),  INT16_C( 15637), -INT16_C(  4654), -INT16_C( 30643),  INT16_C(  1464),
+      -INT16_C(  6528),  INT16_C( 30776),  INT16_C( 20622),  INT16_C( 20997),  INT16_C( 27165),  INT16_C( 17081),  INT16_C( 32071),  INT16_C( 29975),
+       INT16_C( 28635), -INT16_C( 16592),  INT16_C( 15670),  INT16_C(  1034), -INT16_C(  8742),  INT16_C( 10225),  INT16_C( 20041), -INT16_C(  6691),
+       INT16_C(  5507), -INT16_C( 30115),  INT16_C( 25441),  INT16_C( 32732), -INT16_C( 26931),  INT16_C(  5313),  INT16_C( 13331), -INT16_C(  4181),
+       INT16_C( 20217),  INT16_C( 12260),  INT16_C( 13963),  INT16_C( 21141), -INT16_C( 31084), -INT16_C(  1670),  INT16_C( 22307), -INT16_C( 22561),
+       INT16_C( 15468), -INT16_C( 12751),  INT16_C(  3743),  INT16_C( 27725),  INT16_C(  3748), -INT16_C(  7012),  INT16_C( 18466), -INT16_C(  6747),
+       INT16_C( 20998),  INT16_C( 32375),  INT16_C(  5101), -INT16_C( 24604),  INT16_C( 19091),  INT16_C(  7321),  INT16_C( 30369),  INT16_C( 13563),
+      -INT16_C( 25222),  INT16_C( 21212),  INT16_C( 10653),  INT16_C( 18256),  INT16_C( 16183),  INT16_C( 31480), -INT16_C(   460),  INT16_C( 28767),
+      -INT16_C( 10513), -INT16_C(  1810), -INT16_C( 16413),  INT16_C( 30358),  INT16_C( 11785), -INT16_C( 21716),  INT16_C( 14063),  INT16_C( 27078),
+      -INT16_C( 18733),  INT16_C(  6227),  INT16_C( 27070),  INT16_C(  8543), -INT16_C(  4184),  INT16_C(  4975), -INT16_C( 12404),  INT16_C( 31619),
+       INT16_C( 31298), -INT16_C( 30605),  INT16_C(  2609),  INT16_C( 15102),  INT16_C( 19198), -INT16_C(  8987), -INT16_C( 24907), -INT16_C( 12748),
+      -INT16_C(  8653), -INT16_C(  3708),  INT16_C( 31559), -INT16_C(  4121),  INT16_C( 22122), -INT16_C(  2558), -INT16_C( 31195), -INT16_C( 13455),
+      -INT16_C(  6920),  INT16_C( 10579),  INT16_C( 21230),  INT16_C(  9827),  INT16_C( 18813),  INT16_C( 12803),  INT16_C( 25703),  INT16_C(  6912),
+      -INT16_C( 31723),  INT16_C( 23564),  INT16_C( 22275),  INT16_C( 26955),  INT16_C( 20042),  INT16_C( 28511),  INT16_C( 22279), -INT16_C( 13254),
+      -INT16_C( 15531), -INT16_C( 23563),  INT16_C( 22752),  INT16_C( 24983), -INT16_C( 13151), -INT16_C( 30321), -INT16_C( 28925),  INT16_C(  6308),
+      -INT16_C( 20461),  INT16_C(  4724), -INT16_C( 16220), -INT16_C(  4485), -INT16_C(  9714), -INT16_C(  7587), -INT16_C( 18237),  INT16_C( 24238),
+      -INT16_C( 23770),  INT16_C(  1537),  INT16_C( 10153), -INT16_C( 25245),  INT16_C(  8395), -INT16_C( 25818), -INT16_C( 13695), -INT16_C( 27156),
+       INT16_C( 24499),  INT16_C(  7846),  INT16_C(  8680), -INT16_C(  2548),  INT16_C( 27387), -INT16_C( 12008), -INT16_C( 31230),  INT16_C( 10243),
+       INT16_C( 31286),  INT16_C(  9262), -INT16_C( 28208),  INT16_C( 26561), -INT16_C(  6269),  INT16_C(  1026),  INT16_C( 11687),  INT16_C( 11416),
+       INT16_C( 16094), -INT16_C( 14774),  INT16_C( 22367),  INT16_C( 23228), -INT16_C( 27455), -INT16_C( 15361),  INT16_C(   538),  INT16_C( 17387),
+       INT16_C(  6407),  INT16_C(  6822),  INT16_C( 10666),  INT16_C( 11583),  INT16_C( 16656), -INT16_C( 15823), -INT16_C( 13833), -INT16_C( 10770),
+       INT16_C( 29102),  INT16_C( 26267),  INT16_C( 22415),  INT16_C( 20672),  INT16_C( 14714),  INT16_C(  2876), -INT16_C(   319), -INT16_C( 14008),
+      -INT16_C( 20457), -INT16_C( 15968), -INT16_C(  8231), -INT16_C(  5650),  INT16_C(  7969),  INT16_C(  6315), -INT16_C( 26136),  INT16_C( 26261),
+      -INT16_C( 30254),  INT16_C( 24917),  INT16_C(  5601), -INT16_C( 13134),  INT16_C( 18855), -INT16_C(  8591),  INT16_C( 17160), -INT16_C(  9377),
+       INT16_C( 23227), -INT16_C( 23651), -INT16_C( 26964),  INT16_C(   141),  INT16_C( 14507), -INT16_C(  4902),  INT16_C( 28612), -INT16_C( 23421),
+      -INT16_C( 10096),  INT16_C( 28933), -INT16_C( 18450), -INT16_C( 15811),  INT16_C(  3965),  INT16_C( 16728),  INT16_C(  7715), -INT16_C(  3044),
+       INT16_C( 17528), -INT16_C( 26984),  INT16_C(  9541),  INT16_C(  3821), -INT16_C( 20899),  INT16_C( 12163),  INT16_C( 20022),  INT16_C( 17875),
+      -INT16_C(  9761), -INT16_C( 12874), -INT16_C(  3184),  INT16_C(  3471),  INT16_C( 13485),  INT16_C( 11598),  INT16_C( 27551),  INT16_C( 22049),
+      -INT16_C( 18140),  INT16_C( 27116), -INT16_C( 32034),  INT16_C( 15449), -INT16_C(  8911), -INT16_C(  6549),  INT16_C( 16355), -INT16_C(  2258),
+      -INT16_C(  7912), -INT16_C( 22385),  INT16_C(  8148),  INT16_C(  1075),  INT16_C(  1031),  INT16_C(  6101),  INT16_C(  9839), -INT16_C(  5917),
+      -INT16_C(  5665), -INT16_C( 16643),  INT16_C( 25009), -INT16_C( 25094),  INT16_C( 25908),  INT16_C( 11568), -INT16_C( 20828), -INT16_C( 17190),
+       INT16_C( 27023),  INT16_C( 25445),  INT16_C(  7048),  INT16_C( 25669),  INT16_C( 16159), -INT16_C( 28874),  INT16_C( 13157),  INT16_C( 17699),
+       INT16_C(  8220), -INT16_C( 30717), -INT16_C(   649), -INT16_C( 21723),  INT16_C( 26694),  INT16_C( 32332),  INT16_C( 29126), -INT16_C(  6717),
+       INT16_C( 10246), -INT16_C( 28855),  INT16_C( 13631),  INT16_C( 25374),  INT16_C( 21699),  INT16_C( 10738),  INT16_C(  5511), -INT16_C( 23442),
+       INT16_C( 28981), -INT16_C(   909),  INT16_C( 21102), -INT16_C(  2277),  INT16_C(  7162),  INT16_C( 20951), -INT16_C( 25672),  INT16_C( 22922),
+       INT16_C( 32707) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_s16_m(pv, av, bv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+
+    ev = simde_svmax_s16_m(pv, av, bv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    { -INT32_C(    34865127), -INT32_C(   963104199), -INT32_C(   426754441), -INT32_C(  1241612303), -INT32_C(   561056452), -INT32_C(  1417773250),  INT32_C(  1789747881), -INT32_C(   124590113),
+       INT32_C(   552959719),  INT32_C(   669486768), -INT32_C(  1123125300),  INT32_C(   863112439),  INT32_C(  1074856194),  INT32_C(   703369088), -INT32_C(   778855950),  INT32_C(  1758078336),
+       INT32_C(  1418248099),  INT32_C(   427519821), -INT32_C(   556365337), -INT32_C(  1743697514), -INT32_C(   891805110), -INT32_C(  1527528270), -INT32_C(   562722978),  INT32_C(  1346781100),
+       INT32_C(  1285869567),  INT32_C(   627449662),  INT32_C(  1057176745), -INT32_C(   807988091), -INT32_C(   375804105), -INT32_C(   762475148), -INT32_C(  1062206956),  INT32_C(  1091630914),
+       INT32_C(    76395718),  INT32_C(  2099966932), -INT32_C(  1245958864),  INT32_C(  2038797122), -INT32_C(  1235083710), -INT32_C(  1081544789),  INT32_C(   864041457), -INT32_C(   160133072),
+       INT32_C(   435814981),  INT32_C(   630596853), -INT32_C(  1797565870),  INT32_C(   655188197),  INT32_C(   719220606),  INT32_C(  1340696158), -INT32_C(   813471329),  INT32_C(  1069938682),
+      -INT32_C(   279396103),  INT32_C(   907341540),  INT32_C(   634056512), -INT32_C(   833824945), -INT32_C(  1527240122),  INT32_C(   821354897),  INT32_C(  1157658443),  INT32_C(  1753531758),
+       INT32_C(  1784142981),  INT32_C(   178285514), -INT32_C(  1439732901), -INT32_C(  1988592830),  INT32_C(   925724838), -INT32_C(  1654185646),  INT32_C(   132278168), -INT32_C(  1301322195),
+       INT32_C(   203212354), -INT32_C(  1944666831),  INT32_C(  1782007080),  INT32_C(  1727246272),  INT32_C(  1922900256), -INT32_C(   619772606), -INT32_C(  1713180308), -INT32_C(  1723051689),
+       INT32_C(  1218799639),  INT32_C(  1305852709), -INT32_C(  1061680128), -INT32_C(   618157125),  INT32_C(   256754892),  INT32_C(   921328841), -INT32_C(  1529885619),  INT32_C(   876419869),
+      -INT32_C(  1451433340), -INT32_C(  1644736099),  INT32_C(   425635677),  INT32_C(   670336346),  INT32_C(   322323017), -INT32_C(   330751842),  INT32_C(   160438508), -INT32_C(  1203909068),
+       INT32_C(  1315027376),  INT32_C(  1760253963),  INT32_C(  1652640007),  INT32_C(   411662030),  INT32_C(  1445707704), -INT32_C(   884837153), -INT32_C(  1059794036),  INT32_C(  1366823329),
+      -INT32_C(   710944054),  INT32_C(   977177394), -INT32_C(  1550008364), -INT32_C(   306502347), -INT32_C(  1018894620), -INT32_C(   426867110), -INT32_C(    89693607),  INT32_C(  1028398963),
+       INT32_C(   739503097),  INT32_C(  1264996726),  INT32_C(  1190003216),  INT32_C(   187935015), -INT32_C(   372344945),  INT32_C(  1473207550),  INT32_C(   827487934), -INT32_C(  1888575850),
+       INT32_C(    12288393), -INT32_C(   481615406),  INT32_C(  1244215587),  INT32_C(  1901419746), -INT32_C(   765844524),  INT32_C(  1026107775),  INT32_C(   913210272), -INT32_C(  1547313895),
+       INT32_C(   832799070), -INT32_C(   971706718),  INT32_C(   152059175),  INT32_C(  1836738201),  INT32_C(   155178121), -INT32_C(  1656329731), -INT32_C(    19679772), -INT32_C(   257844846),
+      -INT32_C(  1138670566),  INT32_C(  1501705522),  INT32_C(   207786866), -INT32_C(  2105942791), -INT32_C(  1383351888),  INT32_C(   105632290),  INT32_C(   419700359), -INT32_C(   787896905),
+       INT32_C(   462302185), -INT32_C(   747368352), -INT32_C(  1663052125),  INT32_C(  1646221490),  INT32_C(   856730129),  INT32_C(    54156156),  INT32_C(   823934585), -INT32_C(   855496988),
+      -INT32_C(  1310093231),  INT32_C(  1149525409), -INT32_C(   421436620), -INT32_C(   850853700),  INT32_C(   654399914),  INT32_C(   757742516),  INT32_C(  1566459769), -INT32_C(  1104453267),
+      -INT32_C(  1838213903), -INT32_C(  1512573839),  INT32_C(   327989335),  INT32_C(  1658967480), -INT32_C(   494280146), -INT32_C(  1777355747),  INT32_C(  1760849659), -INT32_C(  1071243313),
+      -INT32_C(  1538026189), -INT32_C(   515233143), -INT32_C(  1695230238), -INT32_C(   637741653), -INT32_C(   725907785),  INT32_C(   896256570),  INT32_C(   127754040), -INT32_C(  1312242818),
+      -INT32_C(   497738920),  INT32_C(   667131717),  INT32_C(   549566325),  INT32_C(  1157217677),  INT32_C(  2098836547), -INT32_C(  1213037441),  INT32_C(  1639927779),  INT32_C(  1796376338),
+      -INT32_C(   414357598),  INT32_C(  2081296391),  INT32_C(  1419628487), -INT32_C(   795240820), -INT32_C(   900877749),  INT32_C(   427884598),  INT32_C(  1652179023),  INT32_C(  1775078599),
+      -INT32_C(    95413517), -INT32_C(   243835350), -INT32_C(  1169812435), -INT32_C(   175448150), -INT32_C(   943728751),  INT32_C(   669008343),  INT32_C(  1233738369), -INT32_C(   642623770),
+      -INT32_C(  1697381520), -INT32_C(  1886696607),  INT32_C(   155832671),  INT32_C(  1107284912), -INT32_C(  2113356118), -INT32_C(  2119571201),  INT32_C(   684339778), -INT32_C(   134054776),
+      -INT32_C(   510470529), -INT32_C(  2140136159), -INT32_C(  1618363921),  INT32_C(   920750220),  INT32_C(  1186523463),  INT32_C(   348611026),  INT32_C(   457019795), -INT32_C(  1928118514),
+       INT32_C(   913220885), -INT32_C(  1296638269),  INT32_C(   592527255),  INT32_C(   257569480) };
+  static const int32_t b[] =
+    {  INT32_C(    60565863),  INT32_C(    10374372), -INT32_C(  1739554032), -INT32_C(  1480437699),  INT32_C(   295423233), -INT32_C(   462066245),  INT32_C(  1852022691), -INT32_C(   541841544),
+       INT32_C(   887247184), -INT32_C(  1389068131),  INT32_C(  1095140355), -INT32_C(   689436460), -INT32_C(  1863875627), -INT32_C(  1804247567),  INT32_C(  1946343676),  INT32_C(  1330886655),
+      -INT32_C(  1518127864), -INT32_C(  1185695819),  INT32_C(   284858684),  INT32_C(  1994842785),  INT32_C(  1443286629),  INT32_C(   669743915),  INT32_C(  1402727764), -INT32_C(  1398542684),
+      -INT32_C(   665704925),  INT32_C(   445752798), -INT32_C(   550859970), -INT32_C(   749399699),  INT32_C(   170482655),  INT32_C(   724636887), -INT32_C(  1501639678), -INT32_C(   581754438),
+       INT32_C(   649438536), -INT32_C(  2009053366),  INT32_C(  1080519378),  INT32_C(  1511242875), -INT32_C(   295420905),  INT32_C(  1394185553),  INT32_C(   469342305),  INT32_C(    33049785),
+       INT32_C(   992456433), -INT32_C(   943495179),  INT32_C(  1292315346), -INT32_C(    22537498), -INT32_C(  1460925353),  INT32_C(    66782882),  INT32_C(  1461712030),  INT32_C(   844699457),
+      -INT32_C(  1167163195), -INT32_C(  1165872664),  INT32_C(  1107790172), -INT32_C(    79646812),  INT32_C(  1587752380), -INT32_C(   782131661), -INT32_C(   752320366),  INT32_C(  1560707480),
+      -INT32_C(   367496190),  INT32_C(    27564709), -INT32_C(   951801053),  INT32_C(   398623835), -INT32_C(   462068303), -INT32_C(  1766468093), -INT32_C(   278274473),  INT32_C(  1632399199),
+      -INT32_C(  1991547677),  INT32_C(   579530750), -INT32_C(   152449381),  INT32_C(    68004947),  INT32_C(   367624721), -INT32_C(  1347707304), -INT32_C(   593619844),  INT32_C(  1732111236),
+       INT32_C(  1324386639),  INT32_C(   326138744), -INT32_C(  1677108919),  INT32_C(   396432901), -INT32_C(   248739176), -INT32_C(  1516185816),  INT32_C(  1870741483),  INT32_C(  2044182058),
+      -INT32_C(  1060649145), -INT32_C(  1932314814), -INT32_C(  1775706735), -INT32_C(  1934767629),  INT32_C(  2088622419), -INT32_C(  1675551312), -INT32_C(  2046057892), -INT32_C(  1476337056),
+      -INT32_C(   328677462), -INT32_C(  1871168513),  INT32_C(   203858200), -INT32_C(  1097280406),  INT32_C(  1580864941), -INT32_C(  1879418062),  INT32_C(  1561658877), -INT32_C(  1845160472),
+      -INT32_C(   595694115), -INT32_C(  1049823319),  INT32_C(    47026840),  INT32_C(   348153190), -INT32_C(  1384973702),  INT32_C(  1379691605),  INT32_C(  1504727409),  INT32_C(  1156298087),
+      -INT32_C(   870290909), -INT32_C(   108163999), -INT32_C(  2047124706),  INT32_C(   999931072),  INT32_C(   216533942), -INT32_C(   396483465), -INT32_C(   599650699), -INT32_C(   417321532),
+      -INT32_C(   122470249), -INT32_C(   336510772),  INT32_C(  1550904731),  INT32_C(  1603733929), -INT32_C(  1955889388),  INT32_C(   410241699), -INT32_C(  1661618728),  INT32_C(  2055411171),
+       INT32_C(   577975894),  INT32_C(   302867575), -INT32_C(    93422255), -INT32_C(  1705376378),  INT32_C(   656786820),  INT32_C(  1749064079),  INT32_C(   822359374), -INT32_C(  1599305654),
+       INT32_C(   901980094), -INT32_C(   716648317), -INT32_C(   724584882),  INT32_C(  1081027004),  INT32_C(  2120783087),  INT32_C(  2095491117),  INT32_C(   665709533),  INT32_C(   835213683),
+      -INT32_C(    60322952), -INT32_C(  1445875877),  INT32_C(   561946725), -INT32_C(  1184698934), -INT32_C(  1355298175),  INT32_C(  1328225906),  INT32_C(  2088163337), -INT32_C(  1431486926),
+       INT32_C(   631641289),  INT32_C(   701396931), -INT32_C(   498447336), -INT32_C(  1147425735), -INT32_C(   395652490), -INT32_C(   113797648), -INT32_C(  1619677587), -INT32_C(  1236655124),
+      -INT32_C(    69472201), -INT32_C(  2145080984),  INT32_C(   794980086), -INT32_C(  1846870757), -INT32_C(  1065724721),  INT32_C(  1471787497),  INT32_C(  1291202399), -INT32_C(  1996341166),
+      -INT32_C(  1719345871),  INT32_C(  2082056326),  INT32_C(   850164503),  INT32_C(  1204000376), -INT32_C(   737722901),  INT32_C(  1311490543),  INT32_C(  1117397744), -INT32_C(  1815372702),
+       INT32_C(     2904185),  INT32_C(   259802616),  INT32_C(   943794368), -INT32_C(  1434450497),  INT32_C(   830375746),  INT32_C(   947956296),  INT32_C(   779754188),  INT32_C(   818038455),
+      -INT32_C(  1909395818), -INT32_C(   190927564), -INT32_C(  1808932907),  INT32_C(   658419172),  INT32_C(  2102967604),  INT32_C(   867555431), -INT32_C(  1436471053),  INT32_C(   215622518),
+       INT32_C(  1184500498), -INT32_C(  1925564232), -INT32_C(    64854248),  INT32_C(  1227055124), -INT32_C(  2067366883),  INT32_C(  1203206996),  INT32_C(   569448875),  INT32_C(  1311624252),
+      -INT32_C(  1886074665),  INT32_C(   404541184),  INT32_C(  1259683382), -INT32_C(  1131136865),  INT32_C(   155278004), -INT32_C(  2125399851),  INT32_C(  1319256593), -INT32_C(   442707954),
+      -INT32_C(  1737215592),  INT32_C(   917606400),  INT32_C(  1853998799), -INT32_C(  1289087490),  INT32_C(  1169976175),  INT32_C(  1975913572),  INT32_C(  1556310094), -INT32_C(   801021896),
+      -INT32_C(  1855343215),  INT32_C(   365369926), -INT32_C(   561821216), -INT32_C(   829313698) };
+  static const int32_t e[] =
+    {  INT32_C(           0),  INT32_C(    10374372),  INT32_C(           0), -INT32_C(  1241612303),  INT32_C(           0), -INT32_C(   462066245),  INT32_C(  1852022691), -INT32_C(   124590113),
+       INT32_C(   887247184),  INT32_C(           0),  INT32_C(  1095140355),  INT32_C(   863112439),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1946343676),  INT32_C(  1758078336),
+       INT32_C(           0),  INT32_C(   427519821),  INT32_C(           0),  INT32_C(  1994842785),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(  1057176745),  INT32_C(           0),  INT32_C(   170482655),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1091630914),
+       INT32_C(   649438536),  INT32_C(  2099966932),  INT32_C(           0),  INT32_C(  2038797122), -INT32_C(   295420905),  INT32_C(  1394185553),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(  1292315346),  INT32_C(           0),  INT32_C(   719220606),  INT32_C(  1340696158),  INT32_C(  1461712030),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1587752380),  INT32_C(           0),  INT32_C(  1157658443),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   178285514), -INT32_C(   951801053),  INT32_C(           0),  INT32_C(   925724838), -INT32_C(  1654185646),  INT32_C(   132278168),  INT32_C(           0),
+       INT32_C(   203212354),  INT32_C(           0),  INT32_C(  1782007080),  INT32_C(           0),  INT32_C(  1922900256), -INT32_C(   619772606), -INT32_C(   593619844),  INT32_C(           0),
+       INT32_C(  1324386639),  INT32_C(  1305852709),  INT32_C(           0),  INT32_C(           0),  INT32_C(   256754892),  INT32_C(           0),  INT32_C(  1870741483),  INT32_C(  2044182058),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   670336346),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1203909068),
+       INT32_C(  1315027376),  INT32_C(           0),  INT32_C(  1652640007),  INT32_C(   411662030),  INT32_C(           0), -INT32_C(   884837153),  INT32_C(           0),  INT32_C(  1366823329),
+      -INT32_C(   595694115),  INT32_C(           0),  INT32_C(    47026840),  INT32_C(           0), -INT32_C(  1018894620),  INT32_C(  1379691605),  INT32_C(  1504727409),  INT32_C(  1156298087),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   999931072),  INT32_C(   216533942),  INT32_C(           0),  INT32_C(   827487934),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(  1550904731),  INT32_C(  1901419746),  INT32_C(           0),  INT32_C(  1026107775),  INT32_C(           0),  INT32_C(  2055411171),
+       INT32_C(   832799070),  INT32_C(   302867575),  INT32_C(           0),  INT32_C(  1836738201),  INT32_C(           0),  INT32_C(  1749064079),  INT32_C(           0), -INT32_C(   257844846),
+       INT32_C(           0),  INT32_C(  1501705522),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2120783087),  INT32_C(           0),  INT32_C(           0),  INT32_C(   835213683),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(   561946725),  INT32_C(  1646221490),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2088163337), -INT32_C(   855496988),
+       INT32_C(           0),  INT32_C(  1149525409),  INT32_C(           0), -INT32_C(   850853700),  INT32_C(           0),  INT32_C(   757742516),  INT32_C(  1566459769),  INT32_C(           0),
+      -INT32_C(    69472201), -INT32_C(  1512573839),  INT32_C(           0),  INT32_C(  1658967480), -INT32_C(   494280146),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1071243313),
+      -INT32_C(  1538026189),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1204000376), -INT32_C(   725907785),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1312242818),
+       INT32_C(           0),  INT32_C(   667131717),  INT32_C(   943794368),  INT32_C(           0),  INT32_C(  2098836547),  INT32_C(           0),  INT32_C(  1639927779),  INT32_C(  1796376338),
+       INT32_C(           0),  INT32_C(  2081296391),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2102967604),  INT32_C(   867555431),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1184500498), -INT32_C(   243835350), -INT32_C(    64854248),  INT32_C(  1227055124), -INT32_C(   943728751),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(  1697381520),  INT32_C(   404541184),  INT32_C(  1259683382),  INT32_C(  1107284912),  INT32_C(   155278004),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(   510470529),  INT32_C(           0),  INT32_C(           0),  INT32_C(   920750220),  INT32_C(  1186523463),  INT32_C(  1975913572),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   365369926),  INT32_C(   592527255),  INT32_C(           0) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_s32_z(pv, av, bv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+
+    ev = simde_svmax_s32_z(pv, av, bv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1) };
+  static const int32_t a[] =
+    { -INT32_C(   443620077), -INT32_C(   934094467), -INT32_C(  1621373964), -INT32_C(  1005120618), -INT32_C(   443868539), -INT32_C(  1008440219), -INT32_C(   938971075), -INT32_C(   438058031),
+       INT32_C(   650801576),  INT32_C(  1072569419),  INT32_C(  2111785447), -INT32_C(   515705252),  INT32_C(  1992740112),  INT32_C(  2000268090), -INT32_C(   314621669), -INT32_C(  1378737660),
+      -INT32_C(   539779948), -INT32_C(  1625374280),  INT32_C(  1730018570),  INT32_C(    71852019),  INT32_C(  1719275308), -INT32_C(   706825286), -INT32_C(   104718860), -INT32_C(   727280576),
+      -INT32_C(   390891216),  INT32_C(  1149817146), -INT32_C(  1028938289),  INT32_C(   818344964), -INT32_C(  1114161149), -INT32_C(   393054733), -INT32_C(   756984430),  INT32_C(   447121385),
+       INT32_C(   973232384), -INT32_C(    92370389),  INT32_C(   867969583),  INT32_C(   560235294), -INT32_C(  1210123325),  INT32_C(    44003440), -INT32_C(  1344962363),  INT32_C(   130644743),
+       INT32_C(     4312021), -INT32_C(  2047164586),  INT32_C(   129611497), -INT32_C(    47702727), -INT32_C(  2001467880),  INT32_C(  1015698295), -INT32_C(   622108717), -INT32_C(  1327385381),
+      -INT32_C(   693099904), -INT32_C(   883184927), -INT32_C(  1697508256),  INT32_C(  1234697009),  INT32_C(  2026982145),  INT32_C(  1907711134), -INT32_C(  1773428549), -INT32_C(   716821419),
+       INT32_C(   799798862),  INT32_C(    33162912),  INT32_C(  1285279003), -INT32_C(   912903480),  INT32_C(   457336701),  INT32_C(  2139944899), -INT32_C(   334112873),  INT32_C(  1371626499),
+      -INT32_C(   209687470), -INT32_C(  1896580237),  INT32_C(   282758984),  INT32_C(  1054437569), -INT32_C(  1688658984), -INT32_C(  1441077998), -INT32_C(  1080676164), -INT32_C(   569354100),
+       INT32_C(   936480964),  INT32_C(  1405469963),  INT32_C(   358850644), -INT32_C(   397198064),  INT32_C(  1803856984),  INT32_C(  1293262481),  INT32_C(  1510779854), -INT32_C(   935781373),
+      -INT32_C(  1191245139),  INT32_C(   604816848),  INT32_C(  1966763877),  INT32_C(    90082732), -INT32_C(   881794502),  INT32_C(  1327072640),  INT32_C(   883500336), -INT32_C(   268639678),
+      -INT32_C(  1113064467),  INT32_C(   635548608), -INT32_C(   811918557), -INT32_C(   472581719),  INT32_C(  1538147547), -INT32_C(    89471031),  INT32_C(   791565549),  INT32_C(   589179446),
+      -INT32_C(   421477083), -INT32_C(  1676950919), -INT32_C(  2039765283),  INT32_C(  2053718175),  INT32_C(  1322653828), -INT32_C(   867663649),  INT32_C(   201029332), -INT32_C(   986834528),
+       INT32_C(  1487605727), -INT32_C(  1359693871), -INT32_C(    46833827),  INT32_C(   611819167), -INT32_C(  1770893898), -INT32_C(  1570587954), -INT32_C(   793944528),  INT32_C(  1452661879),
+      -INT32_C(  1129430549),  INT32_C(  1433051896), -INT32_C(  1588420862), -INT32_C(   188364226), -INT32_C(   443926761),  INT32_C(   562621937), -INT32_C(  1024379573), -INT32_C(    65435887),
+      -INT32_C(  1061632056),  INT32_C(  1813324650),  INT32_C(      878786),  INT32_C(  1240847154), -INT32_C(    63996150), -INT32_C(  1222789268), -INT32_C(    25554964),  INT32_C(  1593480086),
+      -INT32_C(  1004620966), -INT32_C(  1741671466), -INT32_C(   845594981),  INT32_C(   454528529),  INT32_C(  2048345613), -INT32_C(   382650883), -INT32_C(   622351548), -INT32_C(  1724325314),
+       INT32_C(  1801279125),  INT32_C(   620990089), -INT32_C(   571302708),  INT32_C(   955779370),  INT32_C(  1286737999), -INT32_C(  1992891579), -INT32_C(   849142385), -INT32_C(  1805214721),
+       INT32_C(  2063582449),  INT32_C(   513737554), -INT32_C(   889482593) };
+  static const int32_t b[] =
+    {  INT32_C(  1402573310),  INT32_C(  1360873880),  INT32_C(  2029710118), -INT32_C(   110989426),  INT32_C(  1333280105),  INT32_C(   472430939), -INT32_C(  1860849653),  INT32_C(   602203685),
+       INT32_C(   276266359), -INT32_C(   312372025),  INT32_C(   241589120),  INT32_C(   872925387),  INT32_C(  1619230469),  INT32_C(  1132243768), -INT32_C(  2116710052), -INT32_C(   274351753),
+      -INT32_C(    33612746),  INT32_C(   820732080), -INT32_C(  2025958980),  INT32_C(   515589401), -INT32_C(    42058043),  INT32_C(  1161951977),  INT32_C(    63379083),  INT32_C(    99773647),
+       INT32_C(   939782536),  INT32_C(   225046097),  INT32_C(  1486137151), -INT32_C(  1300869139),  INT32_C(  2008020109),  INT32_C(  2042425582), -INT32_C(   713260282),  INT32_C(  2010869487),
+      -INT32_C(  1313808801),  INT32_C(   197007820), -INT32_C(  1385999424),  INT32_C(   811588002), -INT32_C(  1146679347),  INT32_C(   104096767), -INT32_C(   690245145),  INT32_C(  2135864863),
+       INT32_C(  1613823636), -INT32_C(   680792553), -INT32_C(   460992959),  INT32_C(  1947526311), -INT32_C(   214975501),  INT32_C(   100230174),  INT32_C(   886887445),  INT32_C(   531835531),
+       INT32_C(  1065411368),  INT32_C(   320269266),  INT32_C(  1643617210),  INT32_C(  1943407488), -INT32_C(   446298682),  INT32_C(  2129289065), -INT32_C(  1078737356),  INT32_C(   417228528),
+       INT32_C(   475487818),  INT32_C(    70217290), -INT32_C(  1989859575), -INT32_C(   100844750), -INT32_C(  1428266175), -INT32_C(   148256573),  INT32_C(  2142690447), -INT32_C(  1936157630),
+       INT32_C(  1034481651),  INT32_C(  1732368477),  INT32_C(   837854975),  INT32_C(   590015970),  INT32_C(   348981329),  INT32_C(  1611396817),  INT32_C(   366985682),  INT32_C(  1218541397),
+      -INT32_C(   997897625),  INT32_C(   556516898),  INT32_C(  1330781293),  INT32_C(  1517452553),  INT32_C(  1450065797),  INT32_C(   146176310), -INT32_C(  1877109190),  INT32_C(  1960361741),
+       INT32_C(   725179913), -INT32_C(  1857264604), -INT32_C(  1964990848), -INT32_C(  1578872293), -INT32_C(   923315310),  INT32_C(   131116748),  INT32_C(  1368911428), -INT32_C(  1228509267),
+      -INT32_C(   220069939), -INT32_C(   461165213), -INT32_C(   412195637),  INT32_C(  1216893622),  INT32_C(  1913683877),  INT32_C(  1903812909),  INT32_C(  2093158607),  INT32_C(  1295157631),
+      -INT32_C(   348187768),  INT32_C(   198165056), -INT32_C(   571327194),  INT32_C(   891648656),  INT32_C(   665270010), -INT32_C(   426172393), -INT32_C(  1335731152),  INT32_C(  1845335269),
+      -INT32_C(   413647705),  INT32_C(   636627198), -INT32_C(   184359579),  INT32_C(  1496000351),  INT32_C(  1954665053),  INT32_C(   593107699),  INT32_C(  1540602998), -INT32_C(   137834416),
+       INT32_C(   199106572), -INT32_C(  1372532408),  INT32_C(   363016886), -INT32_C(  1217409447), -INT32_C(  1809059679), -INT32_C(  2135456246), -INT32_C(  1814328510),  INT32_C(  1753916251),
+       INT32_C(   208890307), -INT32_C(   256203974),  INT32_C(   772103637), -INT32_C(   840600532),  INT32_C(  1851855204), -INT32_C(   638707561), -INT32_C(     9647709),  INT32_C(   812119916),
+      -INT32_C(  1707287968),  INT32_C(  1384838781),  INT32_C(  2139131731),  INT32_C(  1749837316),  INT32_C(   249015671),  INT32_C(  1776797126), -INT32_C(    77048689), -INT32_C(  1423192245),
+       INT32_C(   642082729), -INT32_C(  1317482659),  INT32_C(  1647376734), -INT32_C(   691307169), -INT32_C(   253451734), -INT32_C(   161821849),  INT32_C(  1794294303),  INT32_C(   991239570),
+      -INT32_C(   496870779), -INT32_C(  2003576279),  INT32_C(   854246611) };
+  static const int32_t e[] =
+    { -INT32_C(   443620077), -INT32_C(   934094467),  INT32_C(  2029710118), -INT32_C(  1005120618), -INT32_C(   443868539), -INT32_C(  1008440219), -INT32_C(   938971075), -INT32_C(   438058031),
+       INT32_C(   650801576),  INT32_C(  1072569419),  INT32_C(  2111785447),  INT32_C(   872925387),  INT32_C(  1992740112),  INT32_C(  2000268090), -INT32_C(   314621669), -INT32_C(  1378737660),
+      -INT32_C(   539779948),  INT32_C(   820732080),  INT32_C(  1730018570),  INT32_C(    71852019),  INT32_C(  1719275308),  INT32_C(  1161951977),  INT32_C(    63379083),  INT32_C(    99773647),
+      -INT32_C(   390891216),  INT32_C(  1149817146), -INT32_C(  1028938289),  INT32_C(   818344964), -INT32_C(  1114161149), -INT32_C(   393054733), -INT32_C(   713260282),  INT32_C(  2010869487),
+       INT32_C(   973232384),  INT32_C(   197007820),  INT32_C(   867969583),  INT32_C(   560235294), -INT32_C(  1210123325),  INT32_C(    44003440), -INT32_C(   690245145),  INT32_C(  2135864863),
+       INT32_C(     4312021), -INT32_C(   680792553),  INT32_C(   129611497),  INT32_C(  1947526311), -INT32_C(  2001467880),  INT32_C(  1015698295), -INT32_C(   622108717), -INT32_C(  1327385381),
+       INT32_C(  1065411368),  INT32_C(   320269266),  INT32_C(  1643617210),  INT32_C(  1943407488),  INT32_C(  2026982145),  INT32_C(  2129289065), -INT32_C(  1078737356), -INT32_C(   716821419),
+       INT32_C(   799798862),  INT32_C(    33162912),  INT32_C(  1285279003), -INT32_C(   912903480),  INT32_C(   457336701),  INT32_C(  2139944899), -INT32_C(   334112873),  INT32_C(  1371626499),
+       INT32_C(  1034481651),  INT32_C(  1732368477),  INT32_C(   282758984),  INT32_C(  1054437569), -INT32_C(  1688658984), -INT32_C(  1441077998),  INT32_C(   366985682),  INT32_C(  1218541397),
+       INT32_C(   936480964),  INT32_C(  1405469963),  INT32_C(   358850644), -INT32_C(   397198064),  INT32_C(  1803856984),  INT32_C(  1293262481),  INT32_C(  1510779854), -INT32_C(   935781373),
+       INT32_C(   725179913),  INT32_C(   604816848),  INT32_C(  1966763877),  INT32_C(    90082732), -INT32_C(   881794502),  INT32_C(  1327072640),  INT32_C(  1368911428), -INT32_C(   268639678),
+      -INT32_C(   220069939),  INT32_C(   635548608), -INT32_C(   811918557),  INT32_C(  1216893622),  INT32_C(  1913683877),  INT32_C(  1903812909),  INT32_C(  2093158607),  INT32_C(   589179446),
+      -INT32_C(   421477083), -INT32_C(  1676950919), -INT32_C(  2039765283),  INT32_C(  2053718175),  INT32_C(  1322653828), -INT32_C(   426172393),  INT32_C(   201029332), -INT32_C(   986834528),
+       INT32_C(  1487605727), -INT32_C(  1359693871), -INT32_C(    46833827),  INT32_C(   611819167),  INT32_C(  1954665053), -INT32_C(  1570587954), -INT32_C(   793944528),  INT32_C(  1452661879),
+      -INT32_C(  1129430549),  INT32_C(  1433051896), -INT32_C(  1588420862), -INT32_C(   188364226), -INT32_C(   443926761),  INT32_C(   562621937), -INT32_C(  1024379573),  INT32_C(  1753916251),
+      -INT32_C(  1061632056),  INT32_C(  1813324650),  INT32_C(      878786),  INT32_C(  1240847154), -INT32_C(    63996150), -INT32_C(  1222789268), -INT32_C(     9647709),  INT32_C(  1593480086),
+      -INT32_C(  1004620966), -INT32_C(  1741671466),  INT32_C(  2139131731),  INT32_C(  1749837316),  INT32_C(  2048345613), -INT32_C(   382650883), -INT32_C(    77048689), -INT32_C(  1724325314),
+       INT32_C(  1801279125),  INT32_C(   620990089), -INT32_C(   571302708),  INT32_C(   955779370),  INT32_C(  1286737999), -INT32_C(  1992891579),  INT32_C(  1794294303), -INT32_C(  1805214721),
+       INT32_C(  2063582449),  INT32_C(   513737554),  INT32_C(   854246611) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_s32_m(pv, av, bv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+
+    ev = simde_svmax_s32_m(pv, av, bv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1) };
+  static const int64_t a[] =
+    { -INT64_C( 1974407280621607863), -INT64_C( 3556845420608345992),  INT64_C(  349364152519244212), -INT64_C( 7945422556634332917),
+       INT64_C( 5603093482011252436), -INT64_C( 5974789099446047401),  INT64_C( 8817210720768573313), -INT64_C( 3377065312778924984),
+       INT64_C( 4519488564336048278),  INT64_C( 2775794782436679135),  INT64_C(   55412879012180698),  INT64_C( 2195702217851357354),
+       INT64_C( 8831631004633999467), -INT64_C( 8472722596900497762),  INT64_C( 8161253456335923849), -INT64_C( 1042986257231588384),
+      -INT64_C( 1166480336989515847), -INT64_C( 9068669678792859158),  INT64_C( 8196278167510776198),  INT64_C( 2473144051597695194),
+       INT64_C( 6101610494432876142),  INT64_C(  280089026750242919), -INT64_C( 8570894698689747188), -INT64_C( 5443659776864360472),
+      -INT64_C( 7453421987458454574), -INT64_C( 6953315302923206912), -INT64_C( 3838390826820644477), -INT64_C( 5463552574368275150),
+      -INT64_C( 4520345457159790470), -INT64_C( 7191758112896959232), -INT64_C( 1496451021599248753),  INT64_C( 6972859639891514926),
+       INT64_C( 3870087647435994162),  INT64_C( 4702595506625901453), -INT64_C( 3959528726136221337),  INT64_C( 3858068663430639684),
+       INT64_C( 8339784592163116625), -INT64_C( 1890284245153643311), -INT64_C( 6282501259357948051), -INT64_C( 7441532876802053758),
+      -INT64_C( 7976477743663553805),  INT64_C( 3513890470035220320),  INT64_C( 6799319277137021263),  INT64_C( 9192020068259803057),
+      -INT64_C( 1526536061468430465),  INT64_C(  865127350328157198), -INT64_C(  968523233311573931), -INT64_C( 8189943188867616180),
+       INT64_C( 7394521741999911209),  INT64_C( 5209601482071434883),  INT64_C( 8548685497138482544),  INT64_C( 3465419890071866746),
+       INT64_C(  510175064669545814), -INT64_C(  854958784734868504),  INT64_C( 2107764493926112160), -INT64_C( 8499209262505488683),
+       INT64_C( 6426158866689028003), -INT64_C( 6264412484544531047), -INT64_C( 3264347778663008783), -INT64_C( 5043545497723315901),
+       INT64_C( 2410569877319465642), -INT64_C( 1209129649012103290), -INT64_C( 6569847641138222077), -INT64_C( 1846163325434756465),
+      -INT64_C( 2810117164395052201), -INT64_C( 8139797232679895779),  INT64_C( 6003970949631741261), -INT64_C( 2231432966511628827),
+      -INT64_C( 7148408327771256162),  INT64_C( 2456925615806690301), -INT64_C( 1052396407453865906),  INT64_C( 6411748980607377296),
+       INT64_C( 8737288372873771813),  INT64_C(  522165464156272712), -INT64_C( 4341894234084143166),  INT64_C( 1365111776565121502),
+      -INT64_C( 7455153585862001772),  INT64_C( 7472022249155169265),  INT64_C( 2880600932447734276),  INT64_C( 4955279762957260740),
+       INT64_C( 7409790778212645867), -INT64_C( 9046391904839628440),  INT64_C( 6988657108442458508),  INT64_C( 6376488407728831625),
+       INT64_C( 1741881160534053457), -INT64_C( 8362732615473218319), -INT64_C( 1999777060358149821),  INT64_C( 8781345442481656089),
+      -INT64_C( 3948412397366054547),  INT64_C( 3977006076682328743),  INT64_C(  509845664286806483),  INT64_C( 4055327413046685863),
+      -INT64_C( 7386596142612117797), -INT64_C( 5616427578593134877),  INT64_C( 2447693731363628033), -INT64_C( 3879789575300742108),
+      -INT64_C( 1564723760571974211), -INT64_C(  557090692166154318),  INT64_C( 4436292032816227829),  INT64_C( 8367220498780487524),
+       INT64_C( 5387830833457634515),  INT64_C( 5539744578600208370),  INT64_C( 1052518133027031621), -INT64_C(  939704074433803829),
+       INT64_C( 8502675715887274012),  INT64_C( 4664956237691935513), -INT64_C( 8087837364285704182), -INT64_C( 4533991622839360509),
+      -INT64_C( 8352077844427906786), -INT64_C( 4571792754572691887),  INT64_C( 7531485763401427762), -INT64_C( 4989812890475522469),
+      -INT64_C(  180015698911938944) };
+  static const int64_t b[] =
+    {  INT64_C( 1744375647973211814),  INT64_C( 8963101855196167897),  INT64_C( 1794618521470966445),  INT64_C( 3361004217958554274),
+       INT64_C(  733603164952128685), -INT64_C( 3663253749329049082),  INT64_C( 3224343732715570845),  INT64_C( 2178393600143966598),
+      -INT64_C( 7179474932706619871), -INT64_C( 7270935161879299028),  INT64_C( 1076361997844634681), -INT64_C( 2931746921676832574),
+       INT64_C( 1285644537735775397), -INT64_C( 3702955519361867518), -INT64_C( 6816056339239739694),  INT64_C( 9191042936321901312),
+       INT64_C( 4584543738771715752),  INT64_C( 4905507902011276467),  INT64_C( 2538911039934604219), -INT64_C( 2458008592102911863),
+      -INT64_C( 2046592253359841763),  INT64_C( 8267831249631566343), -INT64_C( 1502431645174768673), -INT64_C( 8976463066207092902),
+      -INT64_C( 1449183937738975024),  INT64_C( 2988738999765699920),  INT64_C( 3227482044798568317),  INT64_C( 2033982487381350737),
+      -INT64_C( 2391692267693009151), -INT64_C( 3206739585234815987),  INT64_C( 5612748460482800615), -INT64_C( 3891885470488682347),
+       INT64_C( 2792650794093910357), -INT64_C( 1307174163995318607), -INT64_C( 6921599373975122521), -INT64_C( 8449741134493583830),
+      -INT64_C( 7361363493281502569), -INT64_C(  520311644742462252),  INT64_C( 2428159241431575817),  INT64_C( 5134894883065246595),
+      -INT64_C( 5639967034663456967), -INT64_C( 2347690600216896989),  INT64_C( 1790361814822946752), -INT64_C(  734347617574523689),
+      -INT64_C( 5093341833240066111), -INT64_C( 1089985257166480342),  INT64_C( 5570249559321858464), -INT64_C( 1000743390937801108),
+       INT64_C( 3295755326582698604),  INT64_C( 2511897548125235644),  INT64_C( 8044172218644005854), -INT64_C( 8510198983919437886),
+       INT64_C( 1303027205299533286),  INT64_C( 3375125010929566514), -INT64_C( 7723350304749310626),  INT64_C(   90753808833407132),
+       INT64_C( 5209256389899898593), -INT64_C( 9096758722079995838),  INT64_C(  388914209911620863),  INT64_C( 4123045837750070299),
+       INT64_C( 7218631536297452238), -INT64_C(  241020661916030461),  INT64_C( 6443017456189278972), -INT64_C(  526982550970685154),
+      -INT64_C( 2346081994936606485),  INT64_C( 2030469360786958388),  INT64_C( 5390224004709743159),  INT64_C( 1240300957439384853),
+       INT64_C( 5929709220195603344),  INT64_C( 3762107664822391032), -INT64_C( 5251066723755837782), -INT64_C( 2302979533143875373),
+      -INT64_C( 5714902208533026752), -INT64_C( 8135755042305592090),  INT64_C(  652606559656198068),  INT64_C( 8112686281617704038),
+       INT64_C( 6817745568271360565),  INT64_C( 1668117896749999795),  INT64_C( 8671254550598814743), -INT64_C( 7268311283061008256),
+       INT64_C( 2413127229757779879),  INT64_C( 3316864940185861772),  INT64_C( 8211981805679244651), -INT64_C( 7914439819959130839),
+       INT64_C( 7260418156730102322), -INT64_C( 4165166263186457619), -INT64_C( 6398988903968952880), -INT64_C( 3973476047634672802),
+      -INT64_C( 6246445696566129645), -INT64_C( 3474843776148724571), -INT64_C( 6795436769529558644),  INT64_C( 6589827595685783573),
+      -INT64_C( 6001443401176196014), -INT64_C( 3600220798328216773),  INT64_C( 8097624256660674939),  INT64_C( 7067993967209237106),
+       INT64_C( 3395194000417709419), -INT64_C( 5216731612902208887),  INT64_C( 8058864967060189963), -INT64_C( 1327929111734521312),
+      -INT64_C( 5638650595270262116), -INT64_C( 6540606981915465657), -INT64_C( 6343352478397124213), -INT64_C(  268973115728977708),
+       INT64_C( 7513776735424193388),  INT64_C( 7400865384471774069),  INT64_C( 8576795025930633432), -INT64_C( 5376715998171898362),
+      -INT64_C( 5674939889472573515),  INT64_C( 2996430118638856787),  INT64_C( 8020787146137306166), -INT64_C( 2059209156328088211),
+      -INT64_C( 7416029705167849945) };
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C( 8963101855196167897),  INT64_C( 1794618521470966445),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 3663253749329049082),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 2775794782436679135),  INT64_C( 1076361997844634681),  INT64_C(                   0),
+       INT64_C( 8831631004633999467), -INT64_C( 3702955519361867518),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 4584543738771715752),  INT64_C( 4905507902011276467),  INT64_C( 8196278167510776198),  INT64_C( 2473144051597695194),
+       INT64_C( 6101610494432876142),  INT64_C(                   0), -INT64_C( 1502431645174768673), -INT64_C( 5443659776864360472),
+       INT64_C(                   0),  INT64_C( 2988738999765699920),  INT64_C( 3227482044798568317),  INT64_C(                   0),
+      -INT64_C( 2391692267693009151),  INT64_C(                   0),  INT64_C( 5612748460482800615),  INT64_C( 6972859639891514926),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3858068663430639684),
+       INT64_C( 8339784592163116625), -INT64_C(  520311644742462252),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 9192020068259803057),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 5570249559321858464),  INT64_C(                   0),
+       INT64_C( 7394521741999911209),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3465419890071866746),
+       INT64_C( 1303027205299533286),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 6426158866689028003),  INT64_C(                   0),  INT64_C(  388914209911620863),  INT64_C( 4123045837750070299),
+       INT64_C( 7218631536297452238), -INT64_C(  241020661916030461),  INT64_C(                   0), -INT64_C(  526982550970685154),
+      -INT64_C( 2346081994936606485),  INT64_C( 2030469360786958388),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 5929709220195603344),  INT64_C(                   0), -INT64_C( 1052396407453865906),  INT64_C( 6411748980607377296),
+       INT64_C( 8737288372873771813),  INT64_C(  522165464156272712),  INT64_C(                   0),  INT64_C( 8112686281617704038),
+       INT64_C( 6817745568271360565),  INT64_C(                   0),  INT64_C( 8671254550598814743),  INT64_C( 4955279762957260740),
+       INT64_C( 7409790778212645867),  INT64_C( 3316864940185861772),  INT64_C(                   0),  INT64_C( 6376488407728831625),
+       INT64_C( 7260418156730102322),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 3948412397366054547),  INT64_C(                   0),  INT64_C(  509845664286806483),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 3600220798328216773),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 3395194000417709419), -INT64_C(  557090692166154318),  INT64_C(                   0),  INT64_C( 8367220498780487524),
+       INT64_C(                   0),  INT64_C( 5539744578600208370),  INT64_C(                   0), -INT64_C(  268973115728977708),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 8576795025930633432), -INT64_C( 4533991622839360509),
+       INT64_C(                   0),  INT64_C( 2996430118638856787),  INT64_C( 8020787146137306166),  INT64_C(                   0),
+      -INT64_C(  180015698911938944) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_s64_z(pv, av, bv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+
+    ev = simde_svmax_s64_z(pv, av, bv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0) };
+  static const int64_t a[] =
+    { -INT64_C( 9222565067965523392),  INT64_C( 2549547534484720828), -INT64_C(  945135887850520314),  INT64_C( 5396239285992925655),
+       INT64_C( 8851088112770605158), -INT64_C( 7292639979418368850),  INT64_C(  608936140367396247), -INT64_C( 4441059010521853943),
+      -INT64_C( 3654411476265353968),  INT64_C( 3088976296163950001), -INT64_C( 4146091508481893315),  INT64_C(  238190444693602864),
+       INT64_C(  207475993379694069), -INT64_C( 3308978500399573417),  INT64_C( 1154529953740537986),  INT64_C(  967968356241825657),
+      -INT64_C( 5646665820023996337), -INT64_C( 7943875784742278567),  INT64_C( 3558079792740827504),  INT64_C( 3880427114853104821),
+       INT64_C( 6293350564396137291),  INT64_C( 1153774315230392674),  INT64_C( 6913518742594966536), -INT64_C( 1957088256148599108),
+      -INT64_C( 8621896136585007870), -INT64_C( 5944191146145440048),  INT64_C( 6835162010925064657),  INT64_C( 1182995409027532781),
+      -INT64_C( 6758943361730546811), -INT64_C(  263016192244765434),  INT64_C( 1474456251566376821), -INT64_C( 3064693707810113702),
+      -INT64_C(  617639722797201160), -INT64_C( 8500830083607199520),  INT64_C( 3097658304741080771), -INT64_C( 7659766868066789234),
+      -INT64_C( 4144491542605712493), -INT64_C( 2455069713503347122),  INT64_C( 3769729105986555477), -INT64_C( 9182903489308466596),
+       INT64_C(  910993478086094840), -INT64_C( 6803148702514973282),  INT64_C( 9134731752609570282), -INT64_C( 7681444839187556359),
+      -INT64_C( 8665179766020347146),  INT64_C( 8465314341434961549),  INT64_C( 5823939744564068659),  INT64_C( 5103876146189453986),
+      -INT64_C( 1263337340148234234), -INT64_C( 4546592123523647512),  INT64_C( 6425484070214823299),  INT64_C(  416703905411916337),
+       INT64_C( 7207286058893296309), -INT64_C( 7821980628171698908), -INT64_C( 6864443032642615381),  INT64_C( 8646887928420783355),
+      -INT64_C( 8895292747275176787), -INT64_C( 3746247078465608865),  INT64_C(  377716370293354543), -INT64_C(  614461755321524417),
+      -INT64_C(  587810356624095758), -INT64_C( 1946002861533557488),  INT64_C( 6406299108558056920), -INT64_C( 2999448047871990242),
+       INT64_C( 4424504250229882838),  INT64_C(  983312171296345100),  INT64_C(  291562887245146011),  INT64_C(  898129706403849404),
+      -INT64_C( 6073701551208489140),  INT64_C( 3309884673213867181),  INT64_C( 8224677607176724281), -INT64_C( 6227764299925647280),
+      -INT64_C( 7317830503269069784),  INT64_C( 3006834382133321467), -INT64_C( 2922154980640515254),  INT64_C( 3819878274576516348),
+      -INT64_C(  683581793995316228), -INT64_C( 5376103429187567797),  INT64_C( 1456675990132862169), -INT64_C( 9156258376560306773),
+      -INT64_C( 6664223158504396142),  INT64_C( 2092840412638021355), -INT64_C( 7918254040939642640), -INT64_C( 8480494733027997366),
+      -INT64_C( 8061273297450977244),  INT64_C( 3603989396453785505),  INT64_C( 9163512655002632369), -INT64_C( 3070718613061208353),
+      -INT64_C( 5365070196168885931),  INT64_C( 1505782701965865328),  INT64_C( 6256582310069346334),  INT64_C( 1428925032270995790),
+       INT64_C(  563681777681310985),  INT64_C( 2919071475140553738),  INT64_C( 6164387782849146816),  INT64_C( 5927062879354534511),
+      -INT64_C(  942305753489780914),  INT64_C(  567702350712580014),  INT64_C( 1832343455309585169),  INT64_C( 4044383007426462340),
+       INT64_C( 9201147409665462231),  INT64_C(  360032831821779377), -INT64_C( 8487444688887071630), -INT64_C( 2562697699168584372),
+       INT64_C( 5140661710429588487),  INT64_C( 1753657984661032542),  INT64_C( 5191642103183340155), -INT64_C( 2033112599129791257),
+       INT64_C( 1033597761414259578),  INT64_C( 5863605171784751266), -INT64_C( 1842570389892131800),  INT64_C( 6053572210278460483),
+       INT64_C( 8411808016099557118) };
+  static const int64_t b[] =
+    { -INT64_C( 6337979869784456155),  INT64_C( 5687936943428295617), -INT64_C( 2638629486284915151),  INT64_C( 2421061916451746010),
+       INT64_C( 4514188461176292378),  INT64_C( 5821965881358910201),  INT64_C( 8563323786309986437), -INT64_C( 7181442045384643527),
+      -INT64_C( 9033306572522329368), -INT64_C( 4165326895539389758),  INT64_C( 2000611856728906161), -INT64_C( 2602052600181256507),
+       INT64_C( 9194911990525492624),  INT64_C( 1469740706173065565), -INT64_C( 8834050636218554518), -INT64_C( 1332590098448074829),
+       INT64_C(  101789096753873197), -INT64_C( 4274190535123482311), -INT64_C( 1624823962744647379),  INT64_C( 2123465849624805422),
+       INT64_C( 6302630579154747089),  INT64_C( 5429830548701976379),  INT64_C( 1212221340291525299),  INT64_C( 4970307622316827372),
+      -INT64_C( 5906699112828829038),  INT64_C( 5742263919448488520), -INT64_C( 9008594986333574904),  INT64_C( 4477521049258268524),
+       INT64_C( 6160350404479474779),  INT64_C( 7483693263933325808), -INT64_C( 8472030533133397164), -INT64_C( 9165515573681337116),
+      -INT64_C( 6716331926936961944),  INT64_C( 4923289747988579724), -INT64_C( 2971358764978952932),  INT64_C( 2381616645688077416),
+      -INT64_C( 5529469094638232593), -INT64_C( 7630520009225178650),  INT64_C( 5575337477776820631), -INT64_C( 1830176723478854465),
+       INT64_C( 8511181592411451203),  INT64_C( 4993198611934002235),  INT64_C( 7918222797725113264), -INT64_C( 1670696210695602446),
+       INT64_C( 6752426508688709550),  INT64_C( 1810550854648004908),  INT64_C( 1050906737683459961), -INT64_C( 6350417448629929392),
+      -INT64_C( 3630012757251378913), -INT64_C( 8494412251516063076), -INT64_C( 5772692919954584392), -INT64_C( 4440121918864630847),
+       INT64_C( 9017231067131954869),  INT64_C( 5615882724356246613), -INT64_C( 6306722934603800213),  INT64_C( 6360705155765247967),
+       INT64_C( 4713248925051406602), -INT64_C(  828496819709875810), -INT64_C( 8807008260168179401), -INT64_C(  624788763783452328),
+       INT64_C( 8269535617371734678),  INT64_C( 3940691454261029171), -INT64_C(    3909144254517561), -INT64_C( 2510389249577387451),
+      -INT64_C( 8532031744958854319),  INT64_C( 3081294902961978764),  INT64_C( 8649595411655759715), -INT64_C( 6653553522393807740),
+      -INT64_C( 5206617280979859232),  INT64_C( 6641407538707432350), -INT64_C( 3402627520419937765),  INT64_C( 2768099991743066740),
+       INT64_C( 3616138250778587981), -INT64_C( 7966199830081670882), -INT64_C( 4810223418150430430),  INT64_C( 7748140923644795161),
+       INT64_C( 1938539041182179872), -INT64_C( 7166454633467929725),  INT64_C( 3135147536055692156),  INT64_C( 1489302738721965602),
+       INT64_C( 2524742171870400242),  INT64_C( 6548701005769161418),  INT64_C( 6219649430243568659), -INT64_C( 2472403715226150232),
+      -INT64_C(  967194025791817521),  INT64_C( 7730738105102610448), -INT64_C( 5435598411421161211),  INT64_C( 4000041343485224634),
+       INT64_C( 3932550832908095352), -INT64_C( 1680566263104615702), -INT64_C( 2911944267630756394),  INT64_C( 6807191825694975704),
+       INT64_C( 4876151934488092495),  INT64_C( 1380408524445962076), -INT64_C( 3070456604123641233),  INT64_C( 3510148954255122545),
+      -INT64_C( 6681001781236484692),  INT64_C( 7957874832478293279),  INT64_C( 7073007605374412118),  INT64_C( 8597214231386537278),
+       INT64_C( 7138140832074167333),  INT64_C( 6125230842437497747), -INT64_C( 7428177027441034347),  INT64_C( 4057749946587652878),
+       INT64_C( 2783703489684229626),  INT64_C( 2881100421835284902), -INT64_C( 9032366577438317643),  INT64_C( 6738699385424272697),
+      -INT64_C( 9065115084629792647),  INT64_C( 6437653380439009950), -INT64_C( 3117600782184676154),  INT64_C( 4336022801663203179),
+      -INT64_C( 6688837181801707314) };
+  static const int64_t e[] =
+    { -INT64_C( 6337979869784456155),  INT64_C( 5687936943428295617), -INT64_C(  945135887850520314),  INT64_C( 5396239285992925655),
+       INT64_C( 8851088112770605158),  INT64_C( 5821965881358910201),  INT64_C(  608936140367396247), -INT64_C( 4441059010521853943),
+      -INT64_C( 3654411476265353968),  INT64_C( 3088976296163950001), -INT64_C( 4146091508481893315),  INT64_C(  238190444693602864),
+       INT64_C(  207475993379694069), -INT64_C( 3308978500399573417),  INT64_C( 1154529953740537986),  INT64_C(  967968356241825657),
+       INT64_C(  101789096753873197), -INT64_C( 4274190535123482311),  INT64_C( 3558079792740827504),  INT64_C( 3880427114853104821),
+       INT64_C( 6293350564396137291),  INT64_C( 5429830548701976379),  INT64_C( 6913518742594966536), -INT64_C( 1957088256148599108),
+      -INT64_C( 8621896136585007870), -INT64_C( 5944191146145440048),  INT64_C( 6835162010925064657),  INT64_C( 4477521049258268524),
+       INT64_C( 6160350404479474779), -INT64_C(  263016192244765434),  INT64_C( 1474456251566376821), -INT64_C( 3064693707810113702),
+      -INT64_C(  617639722797201160), -INT64_C( 8500830083607199520),  INT64_C( 3097658304741080771),  INT64_C( 2381616645688077416),
+      -INT64_C( 4144491542605712493), -INT64_C( 2455069713503347122),  INT64_C( 5575337477776820631), -INT64_C( 1830176723478854465),
+       INT64_C(  910993478086094840), -INT64_C( 6803148702514973282),  INT64_C( 9134731752609570282), -INT64_C( 1670696210695602446),
+      -INT64_C( 8665179766020347146),  INT64_C( 8465314341434961549),  INT64_C( 5823939744564068659),  INT64_C( 5103876146189453986),
+      -INT64_C( 1263337340148234234), -INT64_C( 4546592123523647512),  INT64_C( 6425484070214823299),  INT64_C(  416703905411916337),
+       INT64_C( 9017231067131954869),  INT64_C( 5615882724356246613), -INT64_C( 6864443032642615381),  INT64_C( 8646887928420783355),
+      -INT64_C( 8895292747275176787), -INT64_C( 3746247078465608865),  INT64_C(  377716370293354543), -INT64_C(  614461755321524417),
+       INT64_C( 8269535617371734678),  INT64_C( 3940691454261029171),  INT64_C( 6406299108558056920), -INT64_C( 2510389249577387451),
+       INT64_C( 4424504250229882838),  INT64_C(  983312171296345100),  INT64_C( 8649595411655759715),  INT64_C(  898129706403849404),
+      -INT64_C( 6073701551208489140),  INT64_C( 6641407538707432350),  INT64_C( 8224677607176724281), -INT64_C( 6227764299925647280),
+       INT64_C( 3616138250778587981),  INT64_C( 3006834382133321467), -INT64_C( 2922154980640515254),  INT64_C( 3819878274576516348),
+       INT64_C( 1938539041182179872), -INT64_C( 5376103429187567797),  INT64_C( 1456675990132862169),  INT64_C( 1489302738721965602),
+       INT64_C( 2524742171870400242),  INT64_C( 6548701005769161418), -INT64_C( 7918254040939642640), -INT64_C( 8480494733027997366),
+      -INT64_C(  967194025791817521),  INT64_C( 3603989396453785505),  INT64_C( 9163512655002632369),  INT64_C( 4000041343485224634),
+      -INT64_C( 5365070196168885931),  INT64_C( 1505782701965865328),  INT64_C( 6256582310069346334),  INT64_C( 6807191825694975704),
+       INT64_C( 4876151934488092495),  INT64_C( 2919071475140553738),  INT64_C( 6164387782849146816),  INT64_C( 5927062879354534511),
+      -INT64_C(  942305753489780914),  INT64_C(  567702350712580014),  INT64_C( 1832343455309585169),  INT64_C( 8597214231386537278),
+       INT64_C( 9201147409665462231),  INT64_C(  360032831821779377), -INT64_C( 8487444688887071630),  INT64_C( 4057749946587652878),
+       INT64_C( 5140661710429588487),  INT64_C( 1753657984661032542),  INT64_C( 5191642103183340155), -INT64_C( 2033112599129791257),
+       INT64_C( 1033597761414259578),  INT64_C( 5863605171784751266), -INT64_C( 1842570389892131800),  INT64_C( 6053572210278460483),
+       INT64_C( 8411808016099557118) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_s64_m(pv, av, bv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+
+    ev = simde_svmax_s64_m(pv, av, bv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C( 14), UINT8_C(169), UINT8_C( 64), UINT8_C( 70), UINT8_C(101), UINT8_C(198), UINT8_C(224), UINT8_C(170),
+      UINT8_C( 84), UINT8_C( 83), UINT8_C( 99), UINT8_C( 13), UINT8_C( 85), UINT8_C( 33), UINT8_C( 96), UINT8_C(208),
+      UINT8_C( 82), UINT8_C( 69), UINT8_C(122), UINT8_C( 41), UINT8_C(211), UINT8_C( 50), UINT8_C( 38), UINT8_C(192),
+      UINT8_C(186), UINT8_C( 34), UINT8_C( 58), UINT8_C( 35), UINT8_C(119), UINT8_C(228), UINT8_C( 61), UINT8_C(133),
+      UINT8_C(141), UINT8_C(125), UINT8_C(204), UINT8_C(242), UINT8_C( 67), UINT8_C(172), UINT8_C(157), UINT8_C(151),
+         UINT8_MAX, UINT8_C(  0), UINT8_C(165), UINT8_C( 84), UINT8_C( 34), UINT8_C(  5), UINT8_C( 37), UINT8_C(116),
+      UINT8_C( 74), UINT8_C(159), UINT8_C(157), UINT8_C( 29), UINT8_C(209), UINT8_C(195), UINT8_C(221), UINT8_C(139),
+      UINT8_C(229), UINT8_C( 23), UINT8_C(174), UINT8_C( 92), UINT8_C(251), UINT8_C(235), UINT8_C(225), UINT8_C(136),
+      UINT8_C(105), UINT8_C(173), UINT8_C(122), UINT8_C(172), UINT8_C( 89), UINT8_C( 23), UINT8_C( 68), UINT8_C( 89),
+      UINT8_C( 24), UINT8_C(233), UINT8_C(173), UINT8_C( 58), UINT8_C(238), UINT8_C(210), UINT8_C(174), UINT8_C( 56),
+      UINT8_C(113), UINT8_C( 75), UINT8_C( 85), UINT8_C( 66), UINT8_C( 14), UINT8_C( 50), UINT8_C(205), UINT8_C(243),
+      UINT8_C( 73), UINT8_C(124), UINT8_C( 79), UINT8_C( 68), UINT8_C(103), UINT8_C( 48), UINT8_C(204), UINT8_C(208),
+      UINT8_C(222), UINT8_C( 70), UINT8_C(125), UINT8_C( 55), UINT8_C( 94), UINT8_C(193), UINT8_C(144), UINT8_C(118),
+      UINT8_C(170), UINT8_C( 62), UINT8_C(176), UINT8_C(152), UINT8_C( 16), UINT8_C( 94), UINT8_C(208), UINT8_C(130),
+      UINT8_C(169), UINT8_C( 37), UINT8_C(196), UINT8_C(183), UINT8_C( 87), UINT8_C(146), UINT8_C(170), UINT8_C(160),
+      UINT8_C( 14), UINT8_C(249), UINT8_C(228), UINT8_C(117), UINT8_C( 41), UINT8_C(176), UINT8_C( 70), UINT8_C(  7),
+      UINT8_C(246), UINT8_C(195), UINT8_C( 63), UINT8_C( 84), UINT8_C(132), UINT8_C(207), UINT8_C(202), UINT8_C( 46),
+      UINT8_C( 13), UINT8_C(122), UINT8_C(198), UINT8_C( 30), UINT8_C(216), UINT8_C(150), UINT8_C(160), UINT8_C(129),
+      UINT8_C(187), UINT8_C(100), UINT8_C( 56), UINT8_C( 18), UINT8_C(246), UINT8_C(226), UINT8_C(178), UINT8_C(  4),
+      UINT8_C(219), UINT8_C(150), UINT8_C(122), UINT8_C(  5), UINT8_C( 70), UINT8_C(192), UINT8_C( 12), UINT8_C( 60),
+      UINT8_C(131), UINT8_C( 75), UINT8_C(145), UINT8_C(  7), UINT8_C( 27), UINT8_C( 91), UINT8_C( 53), UINT8_C( 40),
+      UINT8_C(214), UINT8_C(251), UINT8_C( 70), UINT8_C(174), UINT8_C(145), UINT8_C(230), UINT8_C( 48), UINT8_C( 76),
+      UINT8_C( 75), UINT8_C(104), UINT8_C( 94), UINT8_C( 65), UINT8_C( 75), UINT8_C( 16), UINT8_C( 70), UINT8_C( 38),
+      UINT8_C(166), UINT8_C(192), UINT8_C( 43), UINT8_C(236), UINT8_C(128), UINT8_C( 56), UINT8_C( 40), UINT8_C(  3),
+      UINT8_C(131), UINT8_C(185), UINT8_C( 10), UINT8_C(158), UINT8_C( 21), UINT8_C( 63), UINT8_C(199), UINT8_C(235),
+      UINT8_C( 58), UINT8_C( 13), UINT8_C(153), UINT8_C(203), UINT8_C(244), UINT8_C(201), UINT8_C( 23), UINT8_C( 63),
+      UINT8_C( 50), UINT8_C(117), UINT8_C(128), UINT8_C(125), UINT8_C(133), UINT8_C(198), UINT8_C(163), UINT8_C( 43),
+      UINT8_C(134), UINT8_C(207), UINT8_C( 23), UINT8_C(  6), UINT8_C(  7), UINT8_C( 63), UINT8_C(  9), UINT8_C(138),
+      UINT8_C(249), UINT8_C( 19), UINT8_C( 41), UINT8_C( 14), UINT8_C( 82), UINT8_C(240), UINT8_C(249), UINT8_C(140),
+      UINT8_C(253), UINT8_C(146), UINT8_C( 87), UINT8_C(241), UINT8_C( 92), UINT8_C(110), UINT8_C( 48), UINT8_C(142),
+      UINT8_C(227), UINT8_C(177), UINT8_C( 11), UINT8_C(104), UINT8_C(119), UINT8_C(174), UINT8_C(147), UINT8_C(254),
+      UINT8_C(125), UINT8_C(170), UINT8_C(  4), UINT8_C(132), UINT8_C(234), UINT8_C( 14), UINT8_C( 15), UINT8_C(227),
+      UINT8_C( 33), UINT8_C( 56), UINT8_C(241), UINT8_C(116), UINT8_C( 40), UINT8_C(234), UINT8_C(  0), UINT8_C( 37),
+      UINT8_C(124), UINT8_C( 88), UINT8_C( 23), UINT8_C(216), UINT8_C(198), UINT8_C( 71), UINT8_C(102), UINT8_C(170),
+      UINT8_C(248), UINT8_C(113), UINT8_C( 18), UINT8_C(112), UINT8_C( 32), UINT8_C(166), UINT8_C(110), UINT8_C(157),
+      UINT8_C( 80), UINT8_C(114), UINT8_C( 34), UINT8_C( 58), UINT8_C(128), UINT8_C( 49), UINT8_C( 29), UINT8_C(162),
+      UINT8_C(105), UINT8_C( 14), UINT8_C( 22), UINT8_C(145), UINT8_C(248), UINT8_C( 22), UINT8_C(182), UINT8_C(117),
+      UINT8_C(110), UINT8_C(205), UINT8_C( 77), UINT8_C( 53), UINT8_C( 21), UINT8_C(180), UINT8_C(223), UINT8_C( 13),
+      UINT8_C( 37), UINT8_C(241), UINT8_C(125), UINT8_C( 69), UINT8_C(151), UINT8_C(235), UINT8_C(227), UINT8_C(232),
+      UINT8_C( 94), UINT8_C(  5), UINT8_C( 34), UINT8_C(222), UINT8_C( 54), UINT8_C( 64), UINT8_C(128), UINT8_C(159),
+      UINT8_C( 78), UINT8_C(150), UINT8_C( 48), UINT8_C( 71), UINT8_C(173), UINT8_C(230), UINT8_C(188), UINT8_C( 27),
+      UINT8_C(180), UINT8_C(  9), UINT8_C( 80), UINT8_C(201), UINT8_C(189), UINT8_C( 47), UINT8_C(214), UINT8_C(227),
+      UINT8_C( 33), UINT8_C( 84), UINT8_C( 40), UINT8_C(184), UINT8_C( 63), UINT8_C( 11), UINT8_C(160), UINT8_C(157),
+      UINT8_C( 16), UINT8_C(195), UINT8_C(124), UINT8_C( 70), UINT8_C(  3), UINT8_C(252), UINT8_C(229), UINT8_C( 81),
+      UINT8_C(147), UINT8_C( 21), UINT8_C(152), UINT8_C( 64), UINT8_C(252), UINT8_C( 84), UINT8_C( 91), UINT8_C(176),
+      UINT8_C( 94), UINT8_C(172), UINT8_C(121), UINT8_C( 27), UINT8_C(219), UINT8_C( 79), UINT8_C(254), UINT8_C(252),
+      UINT8_C(163), UINT8_C( 39), UINT8_C(181), UINT8_C(227), UINT8_C( 50), UINT8_C( 85), UINT8_C(128), UINT8_C( 67),
+      UINT8_C( 24), UINT8_C(252), UINT8_C(137), UINT8_C( 27), UINT8_C(249), UINT8_C(111), UINT8_C(109), UINT8_C(140),
+      UINT8_C(132), UINT8_C(  5), UINT8_C(204), UINT8_C(128), UINT8_C( 90), UINT8_C( 39), UINT8_C( 48), UINT8_C(184),
+      UINT8_C(211), UINT8_C(169), UINT8_C(211), UINT8_C(175), UINT8_C(249), UINT8_C(210), UINT8_C(171), UINT8_C(156),
+      UINT8_C(249), UINT8_C( 96), UINT8_C(127), UINT8_C( 43), UINT8_C(182), UINT8_C(  0), UINT8_C(110), UINT8_C(206),
+      UINT8_C(252), UINT8_C(248), UINT8_C(234), UINT8_C(245), UINT8_C(103), UINT8_C( 87), UINT8_C(129), UINT8_C(235),
+      UINT8_C( 92), UINT8_C( 77), UINT8_C(108), UINT8_C(182), UINT8_C(117), UINT8_C(156), UINT8_C(110), UINT8_C( 72),
+      UINT8_C( 70), UINT8_C( 66), UINT8_C(247), UINT8_C( 63), UINT8_C( 20), UINT8_C(163), UINT8_C(219), UINT8_C( 13),
+      UINT8_C(  3), UINT8_C( 91), UINT8_C( 56), UINT8_C(185), UINT8_C( 91), UINT8_C(167), UINT8_C(136), UINT8_C( 87),
+      UINT8_C(159), UINT8_C(114), UINT8_C( 77), UINT8_C(  6), UINT8_C(201), UINT8_C(206), UINT8_C(241), UINT8_C( 37),
+      UINT8_C( 28), UINT8_C( 93), UINT8_C(220), UINT8_C(145), UINT8_C(250), UINT8_C( 74), UINT8_C(217), UINT8_C( 64),
+      UINT8_C(140), UINT8_C(209), UINT8_C(127), UINT8_C(160), UINT8_C(116), UINT8_C( 90), UINT8_C(173), UINT8_C(119),
+      UINT8_C(181), UINT8_C(230), UINT8_C( 49), UINT8_C( 16), UINT8_C(141), UINT8_C(185), UINT8_C(104), UINT8_C( 44),
+      UINT8_C( 43), UINT8_C(181), UINT8_C( 50), UINT8_C(244), UINT8_C(131), UINT8_C( 35), UINT8_C( 25), UINT8_C(159),
+      UINT8_C(129), UINT8_C(245), UINT8_C( 48), UINT8_C(123), UINT8_C( 64), UINT8_C( 10), UINT8_C(187), UINT8_C(204),
+      UINT8_C(219), UINT8_C( 58), UINT8_C(109), UINT8_C( 79), UINT8_C(148), UINT8_C( 26), UINT8_C(198), UINT8_C( 74),
+      UINT8_C(  0), UINT8_C(247), UINT8_C( 90), UINT8_C(141), UINT8_C(176), UINT8_C(194), UINT8_C(185), UINT8_C(219),
+      UINT8_C(119), UINT8_C(235), UINT8_C(207), UINT8_C(251), UINT8_C( 15), UINT8_C(233), UINT8_C(154), UINT8_C(144),
+      UINT8_C(222), UINT8_C(203), UINT8_C( 11), UINT8_C( 30), UINT8_C(213), UINT8_C(198), UINT8_C(235), UINT8_C(176),
+      UINT8_C(  0), UINT8_C( 88),    UINT8_MAX, UINT8_C(148), UINT8_C(114), UINT8_C(197), UINT8_C(222), UINT8_C(115),
+      UINT8_C(189), UINT8_C( 57), UINT8_C(  0), UINT8_C(109), UINT8_C(251), UINT8_C(186), UINT8_C( 73), UINT8_C(115),
+      UINT8_C(165), UINT8_C( 24), UINT8_C(110), UINT8_C(180), UINT8_C(  1), UINT8_C(  8), UINT8_C( 68), UINT8_C(224),
+      UINT8_C(211), UINT8_C( 79), UINT8_C(254), UINT8_C(168), UINT8_C( 21), UINT8_C(233), UINT8_C( 88), UINT8_C( 21),
+      UINT8_C( 65), UINT8_C( 87), UINT8_C(170), UINT8_C(180), UINT8_C( 29), UINT8_C(136), UINT8_C( 39), UINT8_C(218),
+      UINT8_C(193), UINT8_C( 39), UINT8_C( 71), UINT8_C(189), UINT8_C(225), UINT8_C(144), UINT8_C( 48), UINT8_C(135),
+      UINT8_C(169), UINT8_C(158), UINT8_C( 59), UINT8_C(170), UINT8_C(166), UINT8_C(128), UINT8_C(138), UINT8_C(122),
+      UINT8_C(207), UINT8_C(137), UINT8_C( 34), UINT8_C(229), UINT8_C(114), UINT8_C(123), UINT8_C(250), UINT8_C(180),
+      UINT8_C(210), UINT8_C(164), UINT8_C(104), UINT8_C(239), UINT8_C( 45), UINT8_C(143), UINT8_C(201), UINT8_C(238),
+      UINT8_C(182), UINT8_C( 17), UINT8_C(171), UINT8_C(152), UINT8_C(161), UINT8_C(219), UINT8_C( 31), UINT8_C( 74),
+      UINT8_C(121), UINT8_C( 90), UINT8_C(245), UINT8_C( 32), UINT8_C(218), UINT8_C(127), UINT8_C(154), UINT8_C(170),
+      UINT8_C(  8), UINT8_C(188), UINT8_C(143), UINT8_C(123), UINT8_C( 55), UINT8_C(137), UINT8_C( 47), UINT8_C( 10),
+      UINT8_C( 46), UINT8_C(151), UINT8_C(249), UINT8_C( 91), UINT8_C( 38), UINT8_C(195), UINT8_C( 73), UINT8_C(220),
+      UINT8_C(212), UINT8_C(245), UINT8_C(116), UINT8_C(117), UINT8_C(208), UINT8_C(147), UINT8_C(192), UINT8_C( 74),
+      UINT8_C(238), UINT8_C(181), UINT8_C(106), UINT8_C(200), UINT8_C( 52), UINT8_C(  4), UINT8_C(114), UINT8_C( 61),
+      UINT8_C(192), UINT8_C(  1), UINT8_C(184), UINT8_C(248), UINT8_C(139), UINT8_C(231), UINT8_C(  2), UINT8_C(185),
+      UINT8_C(126), UINT8_C(251), UINT8_C( 20), UINT8_C(164), UINT8_C(190), UINT8_C( 93), UINT8_C(128), UINT8_C(146),
+      UINT8_C( 82), UINT8_C(245), UINT8_C(  8), UINT8_C( 35), UINT8_C(136), UINT8_C(200), UINT8_C(109), UINT8_C(118),
+      UINT8_C(125), UINT8_C(215), UINT8_C( 63), UINT8_C(177), UINT8_C(219), UINT8_C(177), UINT8_C(238), UINT8_C(155),
+      UINT8_C(179), UINT8_C(166), UINT8_C(147), UINT8_C( 62), UINT8_C(141), UINT8_C(149), UINT8_C(247), UINT8_C( 11),
+      UINT8_C(145), UINT8_C( 11), UINT8_C(175), UINT8_C( 79), UINT8_C(104), UINT8_C( 48), UINT8_C(226), UINT8_C(187),
+      UINT8_C( 37), UINT8_C(234), UINT8_C(222), UINT8_C(173), UINT8_C(178), UINT8_C( 75), UINT8_C( 36), UINT8_C( 47),
+      UINT8_C( 34), UINT8_C( 99), UINT8_C(224), UINT8_C(253), UINT8_C( 20), UINT8_C(207), UINT8_C(152), UINT8_C(199),
+      UINT8_C(117), UINT8_C( 44), UINT8_C(  5), UINT8_C(  3), UINT8_C(193), UINT8_C(252), UINT8_C( 14), UINT8_C( 82),
+      UINT8_C(  7), UINT8_C(190), UINT8_C(162), UINT8_C(112), UINT8_C(238), UINT8_C(132), UINT8_C( 43), UINT8_C( 19),
+      UINT8_C(110), UINT8_C(  9), UINT8_C(192), UINT8_C( 32), UINT8_C( 84), UINT8_C(228), UINT8_C( 79), UINT8_C(118),
+      UINT8_C( 71), UINT8_C( 47), UINT8_C(115), UINT8_C( 92), UINT8_C(254), UINT8_C( 11), UINT8_C( 35), UINT8_C(116),
+      UINT8_C( 55), UINT8_C( 41), UINT8_C(119), UINT8_C(249), UINT8_C( 37), UINT8_C(133), UINT8_C( 75), UINT8_C( 45),
+      UINT8_C( 67), UINT8_C(237), UINT8_C(157), UINT8_C( 49), UINT8_C(113), UINT8_C(200), UINT8_C( 68), UINT8_C(223),
+      UINT8_C(209), UINT8_C(  5),    UINT8_MAX, UINT8_C( 37), UINT8_C(233), UINT8_C( 78), UINT8_C(155), UINT8_C( 49),
+      UINT8_C(126), UINT8_C( 14), UINT8_C(141), UINT8_C(124), UINT8_C( 25), UINT8_C(176), UINT8_C(240), UINT8_C( 81),
+      UINT8_C(217), UINT8_C(103), UINT8_C( 74),    UINT8_MAX, UINT8_C(237), UINT8_C(149), UINT8_C( 44), UINT8_C( 48),
+      UINT8_C(131), UINT8_C(201), UINT8_C( 98), UINT8_C(244), UINT8_C(145), UINT8_C(166), UINT8_C(212), UINT8_C( 98),
+      UINT8_C(171), UINT8_C(211), UINT8_C(135), UINT8_C(149), UINT8_C( 34), UINT8_C( 34), UINT8_C(198), UINT8_C(160),
+      UINT8_C( 48), UINT8_C( 83), UINT8_C( 28), UINT8_C( 73), UINT8_C(  3), UINT8_C( 13), UINT8_C(154), UINT8_C(221),
+      UINT8_C(116), UINT8_C(228), UINT8_C(220), UINT8_C( 97), UINT8_C(122), UINT8_C(  8), UINT8_C(146), UINT8_C(253),
+      UINT8_C(209), UINT8_C(244), UINT8_C(241), UINT8_C( 98), UINT8_C(154), UINT8_C(197), UINT8_C(196), UINT8_C( 70),
+      UINT8_C(153), UINT8_C( 75), UINT8_C(219), UINT8_C(187), UINT8_C(109), UINT8_C(161), UINT8_C( 91), UINT8_C(157),
+      UINT8_C(244), UINT8_C(119), UINT8_C(230), UINT8_C(247), UINT8_C(132), UINT8_C(129), UINT8_C(212), UINT8_C(249),
+      UINT8_C(101), UINT8_C(176), UINT8_C( 90), UINT8_C(223), UINT8_C(184), UINT8_C(236), UINT8_C(220), UINT8_C(137),
+      UINT8_C(224), UINT8_C(206), UINT8_C(235), UINT8_C(123), UINT8_C(147), UINT8_C(175), UINT8_C(193), UINT8_C( 44),
+      UINT8_C(250), UINT8_C(156), UINT8_C(231), UINT8_C(103), UINT8_C( 61), UINT8_C( 66), UINT8_C(  4), UINT8_C( 49),
+      UINT8_C(186), UINT8_C(235), UINT8_C( 40), UINT8_C( 62), UINT8_C(108), UINT8_C(253), UINT8_C( 55), UINT8_C(209),
+      UINT8_C(173), UINT8_C(146), UINT8_C(177), UINT8_C(102), UINT8_C(126), UINT8_C(141), UINT8_C(239), UINT8_C( 95),
+      UINT8_C( 91), UINT8_C(219), UINT8_C(218), UINT8_C(239), UINT8_C(138), UINT8_C(155), UINT8_C( 27), UINT8_C(133),
+      UINT8_C( 55), UINT8_C(  3), UINT8_C(236), UINT8_C(116), UINT8_C( 69), UINT8_C(241), UINT8_C(165),    UINT8_MAX,
+      UINT8_C(220), UINT8_C(205), UINT8_C( 62), UINT8_C( 72), UINT8_C(202), UINT8_C(117), UINT8_C( 25), UINT8_C(120),
+      UINT8_C(  7), UINT8_C(202), UINT8_C(222), UINT8_C(134) };
+  static const uint8_t b[] =
+    { UINT8_C(132), UINT8_C( 66), UINT8_C( 60), UINT8_C(198), UINT8_C(111), UINT8_C(206), UINT8_C(192), UINT8_C(224),
+      UINT8_C(152), UINT8_C(124), UINT8_C(144), UINT8_C(113), UINT8_C(196), UINT8_C( 27), UINT8_C( 52), UINT8_C(106),
+      UINT8_C(180), UINT8_C(101), UINT8_C( 69), UINT8_C(  1), UINT8_C(  1), UINT8_C(111), UINT8_C( 94), UINT8_C( 70),
+      UINT8_C(189), UINT8_C(254), UINT8_C( 46), UINT8_C(196), UINT8_C(174), UINT8_C( 72), UINT8_C( 98), UINT8_C( 50),
+      UINT8_C(138), UINT8_C(158), UINT8_C(248), UINT8_C(249), UINT8_C(108), UINT8_C(184), UINT8_C(218), UINT8_C(  4),
+      UINT8_C( 52), UINT8_C(106), UINT8_C(118), UINT8_C(249), UINT8_C(133), UINT8_C(170), UINT8_C( 99), UINT8_C( 57),
+      UINT8_C( 15), UINT8_C(168), UINT8_C( 58), UINT8_C( 16), UINT8_C( 23), UINT8_C(153), UINT8_C( 86), UINT8_C(212),
+      UINT8_C(151), UINT8_C(132), UINT8_C(153), UINT8_C( 69), UINT8_C(204), UINT8_C(251), UINT8_C(119), UINT8_C( 87),
+      UINT8_C(153), UINT8_C(112), UINT8_C( 80), UINT8_C(  5), UINT8_C( 40), UINT8_C( 42), UINT8_C(  9), UINT8_C( 93),
+      UINT8_C(148), UINT8_C(127), UINT8_C( 86), UINT8_C( 25), UINT8_C( 41), UINT8_C(185), UINT8_C( 83), UINT8_C( 56),
+      UINT8_C( 98), UINT8_C(141), UINT8_C( 72), UINT8_C(121), UINT8_C( 38), UINT8_C(159), UINT8_C( 78), UINT8_C(189),
+      UINT8_C( 35), UINT8_C(231), UINT8_C(  2), UINT8_C(240), UINT8_C(226), UINT8_C(122), UINT8_C( 71), UINT8_C(123),
+      UINT8_C(234), UINT8_C(151), UINT8_C(128), UINT8_C( 18), UINT8_C(194), UINT8_C(137), UINT8_C(111), UINT8_C( 86),
+      UINT8_C(  9), UINT8_C(197), UINT8_C(112), UINT8_C( 50), UINT8_C(127), UINT8_C(195), UINT8_C(107), UINT8_C(225),
+      UINT8_C( 80), UINT8_C(179), UINT8_C( 90), UINT8_C(119), UINT8_C( 82), UINT8_C(168), UINT8_C( 52), UINT8_C(118),
+      UINT8_C(143), UINT8_C( 55), UINT8_C(102), UINT8_C(113), UINT8_C(177), UINT8_C(173), UINT8_C(236), UINT8_C(155),
+      UINT8_C( 68), UINT8_C(108), UINT8_C(173), UINT8_C(  6), UINT8_C(246), UINT8_C( 29), UINT8_C( 93),    UINT8_MAX,
+      UINT8_C(226), UINT8_C(205), UINT8_C( 49), UINT8_C( 97), UINT8_C(144), UINT8_C(156), UINT8_C( 66), UINT8_C(224),
+      UINT8_C( 80), UINT8_C(157), UINT8_C( 87), UINT8_C(162), UINT8_C( 69), UINT8_C(140), UINT8_C( 24), UINT8_C(213),
+      UINT8_C(195), UINT8_C(126), UINT8_C( 70), UINT8_C(116), UINT8_C( 43), UINT8_C( 51), UINT8_C( 15), UINT8_C(112),
+      UINT8_C(159), UINT8_C(188), UINT8_C(118), UINT8_C(149), UINT8_C(217), UINT8_C(211), UINT8_C(148), UINT8_C(188),
+      UINT8_C(160), UINT8_C(198), UINT8_C( 29), UINT8_C( 48), UINT8_C( 98), UINT8_C( 96), UINT8_C( 17), UINT8_C(178),
+      UINT8_C(253), UINT8_C(104), UINT8_C( 85), UINT8_C( 66), UINT8_C(244), UINT8_C(109), UINT8_C( 23), UINT8_C(183),
+      UINT8_C(236), UINT8_C( 94), UINT8_C( 43), UINT8_C( 23), UINT8_C(145), UINT8_C( 58), UINT8_C(135), UINT8_C( 48),
+      UINT8_C(247), UINT8_C(254), UINT8_C(198), UINT8_C(208), UINT8_C(209), UINT8_C( 90), UINT8_C(140), UINT8_C(114),
+      UINT8_C( 32), UINT8_C(170), UINT8_C(162), UINT8_C(131), UINT8_C( 10), UINT8_C(179), UINT8_C( 53), UINT8_C(  7),
+      UINT8_C( 28), UINT8_C(138), UINT8_C( 73), UINT8_C( 16), UINT8_C(248), UINT8_C( 97), UINT8_C(200), UINT8_C(228),
+      UINT8_C(191), UINT8_C(243), UINT8_C(251), UINT8_C( 80), UINT8_C( 46), UINT8_C(131), UINT8_C(128), UINT8_C( 37),
+      UINT8_C(129), UINT8_C( 70), UINT8_C(245), UINT8_C( 82), UINT8_C(161), UINT8_C(130), UINT8_C(196), UINT8_C(193),
+      UINT8_C( 44), UINT8_C(103), UINT8_C( 68), UINT8_C( 54), UINT8_C( 26), UINT8_C(122), UINT8_C( 61), UINT8_C( 54),
+      UINT8_C(  4), UINT8_C(134), UINT8_C( 71), UINT8_C(252), UINT8_C(231), UINT8_C( 15), UINT8_C(224), UINT8_C(166),
+      UINT8_C(  2), UINT8_C(220), UINT8_C(246), UINT8_C( 48), UINT8_C( 95), UINT8_C(119), UINT8_C( 85), UINT8_C(224),
+      UINT8_C(189), UINT8_C( 75), UINT8_C( 50), UINT8_C( 94), UINT8_C(205), UINT8_C(247), UINT8_C( 32), UINT8_C(249),
+      UINT8_C( 94), UINT8_C(100), UINT8_C( 47), UINT8_C(120), UINT8_C(222), UINT8_C(108), UINT8_C(175), UINT8_C(227),
+      UINT8_C(242), UINT8_C(246), UINT8_C(223), UINT8_C(218), UINT8_C(  5), UINT8_C(192), UINT8_C(128), UINT8_C(  7),
+      UINT8_C(156), UINT8_C(119), UINT8_C( 56), UINT8_C(251), UINT8_C(238), UINT8_C(141), UINT8_C(219), UINT8_C(171),
+      UINT8_C(216), UINT8_C( 13), UINT8_C( 10), UINT8_C(165), UINT8_C(  4), UINT8_C( 42), UINT8_C(158), UINT8_C( 98),
+      UINT8_C(142), UINT8_C(205), UINT8_C(219), UINT8_C(109), UINT8_C( 57), UINT8_C(138), UINT8_C( 80), UINT8_C( 44),
+      UINT8_C(128), UINT8_C( 47), UINT8_C(  6), UINT8_C(133), UINT8_C(239), UINT8_C(134), UINT8_C(140), UINT8_C(139),
+      UINT8_C(253), UINT8_C(196), UINT8_C(134), UINT8_C(235), UINT8_C( 82), UINT8_C( 97), UINT8_C(151), UINT8_C( 42),
+      UINT8_C(111), UINT8_C(161), UINT8_C(208), UINT8_C(115), UINT8_C(203), UINT8_C(110), UINT8_C(214), UINT8_C( 89),
+      UINT8_C( 60), UINT8_C(177), UINT8_C(198), UINT8_C(117), UINT8_C( 59), UINT8_C( 22), UINT8_C(161), UINT8_C(187),
+      UINT8_C( 70), UINT8_C(167), UINT8_C( 64), UINT8_C( 53), UINT8_C( 46), UINT8_C(204), UINT8_C(193), UINT8_C( 43),
+      UINT8_C(145), UINT8_C( 71), UINT8_C( 23), UINT8_C(227), UINT8_C(169), UINT8_C(174), UINT8_C( 13), UINT8_C( 24),
+      UINT8_C( 79), UINT8_C(221), UINT8_C(139), UINT8_C( 26), UINT8_C( 76), UINT8_C( 97), UINT8_C(115), UINT8_C(136),
+      UINT8_C( 18), UINT8_C( 58), UINT8_C(253), UINT8_C( 77), UINT8_C( 80), UINT8_C(159), UINT8_C(  8), UINT8_C(150),
+      UINT8_C( 70), UINT8_C( 72), UINT8_C(204), UINT8_C(116), UINT8_C( 21), UINT8_C(141), UINT8_C(160), UINT8_C(166),
+      UINT8_C(212), UINT8_C(183), UINT8_C(137), UINT8_C(125), UINT8_C(101), UINT8_C(150), UINT8_C(149), UINT8_C(180),
+      UINT8_C(116), UINT8_C( 33), UINT8_C(206), UINT8_C(192), UINT8_C(130), UINT8_C( 65), UINT8_C( 72), UINT8_C(149),
+      UINT8_C(123), UINT8_C( 69), UINT8_C(226), UINT8_C(204), UINT8_C(228), UINT8_C(235), UINT8_C( 98), UINT8_C( 43),
+      UINT8_C( 51), UINT8_C( 46), UINT8_C(159), UINT8_C( 72), UINT8_C(187), UINT8_C( 63), UINT8_C(238), UINT8_C(144),
+      UINT8_C(246), UINT8_C(119), UINT8_C( 13), UINT8_C( 91), UINT8_C( 14), UINT8_C(163), UINT8_C( 15), UINT8_C(130),
+      UINT8_C(196), UINT8_C(221), UINT8_C( 66), UINT8_C( 70), UINT8_C( 31), UINT8_C(138), UINT8_C(219), UINT8_C(154),
+      UINT8_C(207), UINT8_C(190), UINT8_C(102), UINT8_C(180), UINT8_C(169), UINT8_C(201), UINT8_C(223), UINT8_C(220),
+      UINT8_C(247), UINT8_C(126), UINT8_C( 37), UINT8_C(179), UINT8_C(190), UINT8_C( 19), UINT8_C( 67), UINT8_C(180),
+      UINT8_C(139), UINT8_C( 80), UINT8_C( 16), UINT8_C(153), UINT8_C(243), UINT8_C( 31), UINT8_C( 27), UINT8_C(183),
+      UINT8_C(253), UINT8_C( 93), UINT8_C(254), UINT8_C( 28), UINT8_C(231), UINT8_C(217), UINT8_C(182), UINT8_C(182),
+      UINT8_C(151), UINT8_C( 29), UINT8_C(106), UINT8_C( 64), UINT8_C(230), UINT8_C( 73), UINT8_C( 29), UINT8_C(221),
+      UINT8_C(200), UINT8_C( 66), UINT8_C(144), UINT8_C(134), UINT8_C( 85), UINT8_C(211), UINT8_C( 58), UINT8_C(224),
+      UINT8_C( 36), UINT8_C( 74), UINT8_C(121), UINT8_C( 23), UINT8_C(106), UINT8_C(148), UINT8_C(207), UINT8_C(103),
+      UINT8_C(241), UINT8_C(205), UINT8_C(131), UINT8_C(216), UINT8_C(166), UINT8_C( 57), UINT8_C(143), UINT8_C( 62),
+      UINT8_C( 86), UINT8_C(249), UINT8_C(126), UINT8_C( 60), UINT8_C( 67), UINT8_C(155), UINT8_C( 26), UINT8_C( 11),
+      UINT8_C(221), UINT8_C(170), UINT8_C(145), UINT8_C( 51), UINT8_C(126), UINT8_C(203), UINT8_C( 19), UINT8_C(162),
+      UINT8_C( 22), UINT8_C(141), UINT8_C(185), UINT8_C(128), UINT8_C( 33), UINT8_C(136), UINT8_C(231), UINT8_C( 19),
+      UINT8_C( 85), UINT8_C(106), UINT8_C(235), UINT8_C(252), UINT8_C(163), UINT8_C(122), UINT8_C( 58), UINT8_C(250),
+      UINT8_C(116), UINT8_C(184), UINT8_C( 54), UINT8_C(183), UINT8_C( 84), UINT8_C( 80), UINT8_C(194), UINT8_C( 49),
+      UINT8_C(251), UINT8_C( 83), UINT8_C(100), UINT8_C(121), UINT8_C( 30), UINT8_C(120), UINT8_C( 27), UINT8_C( 52),
+      UINT8_C(  5), UINT8_C(212), UINT8_C(180), UINT8_C( 38), UINT8_C( 93), UINT8_C(155), UINT8_C( 57), UINT8_C(178),
+      UINT8_C(  5), UINT8_C( 37), UINT8_C(174), UINT8_C(169), UINT8_C(159), UINT8_C(232), UINT8_C(163), UINT8_C( 19),
+      UINT8_C(161), UINT8_C(217), UINT8_C(202), UINT8_C(245), UINT8_C( 42), UINT8_C(140), UINT8_C( 38), UINT8_C( 37),
+      UINT8_C(223), UINT8_C(139), UINT8_C(158), UINT8_C(254), UINT8_C(  3), UINT8_C(185), UINT8_C( 50), UINT8_C(  8),
+      UINT8_C(141), UINT8_C(231), UINT8_C( 46), UINT8_C(234), UINT8_C(130), UINT8_C(104), UINT8_C(157), UINT8_C(136),
+      UINT8_C(141), UINT8_C( 75), UINT8_C( 49), UINT8_C( 44), UINT8_C( 52), UINT8_C(212), UINT8_C( 64), UINT8_C(213),
+      UINT8_C(173), UINT8_C( 10), UINT8_C(202), UINT8_C(215), UINT8_C(151), UINT8_C(240), UINT8_C(252), UINT8_C(118),
+      UINT8_C(123), UINT8_C(154), UINT8_C(116), UINT8_C(126), UINT8_C( 83), UINT8_C(167), UINT8_C(134), UINT8_C(225),
+      UINT8_C(142), UINT8_C(181), UINT8_C(203), UINT8_C( 16), UINT8_C( 29), UINT8_C(104), UINT8_C(152), UINT8_C(170),
+      UINT8_C(180), UINT8_C(201), UINT8_C(214), UINT8_C(232), UINT8_C(157), UINT8_C( 22), UINT8_C(189), UINT8_C( 75),
+      UINT8_C( 33), UINT8_C(135), UINT8_C( 34), UINT8_C(184), UINT8_C(119), UINT8_C( 31), UINT8_C( 46), UINT8_C(243),
+      UINT8_C(185), UINT8_C(163), UINT8_C(113), UINT8_C( 13), UINT8_C( 74), UINT8_C(248), UINT8_C(238), UINT8_C(216),
+      UINT8_C(173), UINT8_C(185), UINT8_C(232), UINT8_C(202), UINT8_C( 34), UINT8_C(129), UINT8_C(116), UINT8_C(214),
+      UINT8_C( 74), UINT8_C( 74), UINT8_C(190), UINT8_C(232), UINT8_C( 97), UINT8_C(123), UINT8_C( 51), UINT8_C(130),
+      UINT8_C(  2), UINT8_C( 85), UINT8_C( 58), UINT8_C(121), UINT8_C(116), UINT8_C(104), UINT8_C(108), UINT8_C( 46),
+      UINT8_C( 11), UINT8_C(222), UINT8_C( 59), UINT8_C( 85), UINT8_C(214), UINT8_C( 41), UINT8_C( 45), UINT8_C(131),
+      UINT8_C(226), UINT8_C( 22), UINT8_C( 77), UINT8_C(  4), UINT8_C(151), UINT8_C(193), UINT8_C(218), UINT8_C(225),
+      UINT8_C( 11), UINT8_C(152), UINT8_C(201), UINT8_C(108), UINT8_C( 19), UINT8_C(252), UINT8_C(238), UINT8_C( 21),
+      UINT8_C( 82), UINT8_C( 40), UINT8_C(143), UINT8_C(198), UINT8_C(145), UINT8_C(251), UINT8_C(244), UINT8_C(156),
+      UINT8_C(217), UINT8_C( 47), UINT8_C(242), UINT8_C(175), UINT8_C( 88), UINT8_C( 31), UINT8_C( 50), UINT8_C( 59),
+      UINT8_C( 53), UINT8_C(127), UINT8_C( 63), UINT8_C(204), UINT8_C( 64), UINT8_C( 26), UINT8_C(174), UINT8_C( 76),
+      UINT8_C(178), UINT8_C(119), UINT8_C(184), UINT8_C(198), UINT8_C(116), UINT8_C(167), UINT8_C(219), UINT8_C(198),
+      UINT8_C(207), UINT8_C(106), UINT8_C(140), UINT8_C( 96), UINT8_C(102), UINT8_C(129), UINT8_C(253), UINT8_C( 63),
+      UINT8_C(176), UINT8_C(239), UINT8_C(239), UINT8_C(  9), UINT8_C( 14), UINT8_C( 33), UINT8_C( 68), UINT8_C( 68),
+      UINT8_C(161), UINT8_C(131), UINT8_C( 16), UINT8_C(225), UINT8_C(157), UINT8_C(190), UINT8_C( 45), UINT8_C( 80),
+      UINT8_C( 54), UINT8_C(230), UINT8_C( 22), UINT8_C(170), UINT8_C(141), UINT8_C(241), UINT8_C(112), UINT8_C( 92),
+      UINT8_C( 92), UINT8_C(252), UINT8_C(189), UINT8_C(194), UINT8_C(125), UINT8_C(186), UINT8_C(  1), UINT8_C( 46),
+      UINT8_C(169), UINT8_C(240), UINT8_C( 55), UINT8_C(183), UINT8_C( 18), UINT8_C(123), UINT8_C(251), UINT8_C(179),
+      UINT8_C(254), UINT8_C( 12), UINT8_C(148), UINT8_C(156), UINT8_C(202), UINT8_C(194), UINT8_C(236), UINT8_C(  0),
+      UINT8_C(168), UINT8_C(  2), UINT8_C(170), UINT8_C( 53), UINT8_C(243), UINT8_C( 26), UINT8_C(145), UINT8_C( 79),
+      UINT8_C( 23), UINT8_C( 78), UINT8_C( 17), UINT8_C(148), UINT8_C(  8), UINT8_C( 19), UINT8_C(194), UINT8_C(177),
+      UINT8_C(  3), UINT8_C(249), UINT8_C(105), UINT8_C( 21), UINT8_C(116), UINT8_C(100), UINT8_C(200), UINT8_C(115),
+      UINT8_C(112), UINT8_C( 93), UINT8_C( 15), UINT8_C( 59), UINT8_C( 31), UINT8_C(251), UINT8_C( 59), UINT8_C(199),
+      UINT8_C(253), UINT8_C(230), UINT8_C(252), UINT8_C(240), UINT8_C(  0), UINT8_C(141), UINT8_C( 64), UINT8_C( 23),
+      UINT8_C(220), UINT8_C( 81), UINT8_C(172), UINT8_C(228), UINT8_C(100), UINT8_C(110), UINT8_C(150), UINT8_C(104),
+      UINT8_C(104),    UINT8_MAX, UINT8_C(125), UINT8_C(220), UINT8_C( 99), UINT8_C( 70), UINT8_C( 79), UINT8_C(212),
+      UINT8_C(163), UINT8_C( 94), UINT8_C( 15), UINT8_C(194), UINT8_C( 89), UINT8_C( 74), UINT8_C(137), UINT8_C( 86),
+      UINT8_C( 48), UINT8_C(133), UINT8_C( 71), UINT8_C( 49), UINT8_C( 18), UINT8_C(135), UINT8_C( 72), UINT8_C(238),
+      UINT8_C(216), UINT8_C(244), UINT8_C(211), UINT8_C( 61), UINT8_C( 99), UINT8_C(105), UINT8_C(165), UINT8_C(203),
+      UINT8_C(104), UINT8_C( 34), UINT8_C(167), UINT8_C(203), UINT8_C(104), UINT8_C(247), UINT8_C(159), UINT8_C( 11),
+      UINT8_C( 85), UINT8_C(174), UINT8_C(205), UINT8_C(175), UINT8_C(249), UINT8_C( 86), UINT8_C(  5), UINT8_C( 41),
+      UINT8_C(219), UINT8_C( 76), UINT8_C( 90), UINT8_C(238), UINT8_C(211), UINT8_C(163), UINT8_C(220), UINT8_C(172),
+      UINT8_C(151), UINT8_C(175), UINT8_C(233), UINT8_C(250), UINT8_C( 24), UINT8_C(142), UINT8_C(197), UINT8_C(128),
+      UINT8_C(176), UINT8_C(109), UINT8_C( 76), UINT8_C( 25), UINT8_C(100), UINT8_C(235), UINT8_C( 36), UINT8_C(185),
+      UINT8_C(154), UINT8_C(242), UINT8_C(104), UINT8_C(147), UINT8_C( 72), UINT8_C(110), UINT8_C(188), UINT8_C( 36),
+      UINT8_C(186), UINT8_C( 23), UINT8_C( 18), UINT8_C(142) };
+  static const uint8_t e[] =
+    { UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(111), UINT8_C(206), UINT8_C(  0), UINT8_C(224),
+      UINT8_C(152), UINT8_C(124), UINT8_C(  0), UINT8_C(113), UINT8_C(196), UINT8_C( 33), UINT8_C( 96), UINT8_C(208),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(122), UINT8_C(  0), UINT8_C(  0), UINT8_C(111), UINT8_C(  0), UINT8_C(192),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 58), UINT8_C(196), UINT8_C(  0), UINT8_C(228), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(141), UINT8_C(158), UINT8_C(248), UINT8_C(  0), UINT8_C(108), UINT8_C(184), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(106), UINT8_C(165), UINT8_C(  0), UINT8_C(  0), UINT8_C(170), UINT8_C(  0), UINT8_C(116),
+      UINT8_C( 74), UINT8_C(168), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(212),
+      UINT8_C(229), UINT8_C(132), UINT8_C(174), UINT8_C( 92), UINT8_C(  0), UINT8_C(251), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(153), UINT8_C(173), UINT8_C(122), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 68), UINT8_C( 93),
+      UINT8_C(148), UINT8_C(233), UINT8_C(173), UINT8_C( 58), UINT8_C(  0), UINT8_C(210), UINT8_C(174), UINT8_C(  0),
+      UINT8_C(113), UINT8_C(  0), UINT8_C( 85), UINT8_C(121), UINT8_C(  0), UINT8_C(159), UINT8_C(205), UINT8_C(  0),
+      UINT8_C( 73), UINT8_C(  0), UINT8_C( 79), UINT8_C(  0), UINT8_C(  0), UINT8_C(122), UINT8_C(  0), UINT8_C(208),
+      UINT8_C(234), UINT8_C(  0), UINT8_C(  0), UINT8_C( 55), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(118),
+      UINT8_C(170), UINT8_C(  0), UINT8_C(176), UINT8_C(  0), UINT8_C(127), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(183), UINT8_C( 87), UINT8_C(168), UINT8_C(170), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(249), UINT8_C(  0), UINT8_C(  0), UINT8_C(177), UINT8_C(176), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(246), UINT8_C(  0), UINT8_C(  0), UINT8_C( 84), UINT8_C(246), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(205), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(156), UINT8_C(160), UINT8_C(224),
+      UINT8_C(187), UINT8_C(  0), UINT8_C( 87), UINT8_C(162), UINT8_C(  0), UINT8_C(226), UINT8_C(178), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(122), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(159), UINT8_C(  0), UINT8_C(145), UINT8_C(  0), UINT8_C(217), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(251), UINT8_C( 70), UINT8_C(  0), UINT8_C(145), UINT8_C(  0), UINT8_C(  0), UINT8_C(178),
+      UINT8_C(  0), UINT8_C(104), UINT8_C(  0), UINT8_C(  0), UINT8_C(244), UINT8_C(109), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(236), UINT8_C(145), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(247), UINT8_C(254), UINT8_C(198), UINT8_C(208), UINT8_C(  0), UINT8_C( 90), UINT8_C(199), UINT8_C(  0),
+      UINT8_C( 58), UINT8_C(  0), UINT8_C(162), UINT8_C(  0), UINT8_C(244), UINT8_C(201), UINT8_C( 53), UINT8_C(  0),
+      UINT8_C( 50), UINT8_C(  0), UINT8_C(128), UINT8_C(125), UINT8_C(248), UINT8_C(  0), UINT8_C(200), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(243), UINT8_C(251), UINT8_C(  0), UINT8_C(  0), UINT8_C(131), UINT8_C(  0), UINT8_C(138),
+      UINT8_C(249), UINT8_C(  0), UINT8_C(245), UINT8_C( 82), UINT8_C(161), UINT8_C(  0), UINT8_C(  0), UINT8_C(193),
+      UINT8_C(253), UINT8_C(146), UINT8_C( 87), UINT8_C(  0), UINT8_C( 92), UINT8_C(122), UINT8_C(  0), UINT8_C(142),
+      UINT8_C(227), UINT8_C(177), UINT8_C(  0), UINT8_C(252), UINT8_C(  0), UINT8_C(174), UINT8_C(224), UINT8_C(254),
+      UINT8_C(125), UINT8_C(220), UINT8_C(246), UINT8_C(132), UINT8_C(234), UINT8_C(  0), UINT8_C( 85), UINT8_C(227),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(116), UINT8_C(205), UINT8_C(247), UINT8_C( 32), UINT8_C(  0),
+      UINT8_C(124), UINT8_C(100), UINT8_C( 47), UINT8_C(  0), UINT8_C(222), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(246), UINT8_C(  0), UINT8_C(218), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(119), UINT8_C( 56), UINT8_C(251), UINT8_C(238), UINT8_C(141), UINT8_C(  0), UINT8_C(171),
+      UINT8_C(  0), UINT8_C( 14), UINT8_C( 22), UINT8_C(165), UINT8_C(248), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(142), UINT8_C(  0), UINT8_C(219), UINT8_C(  0), UINT8_C(  0), UINT8_C(180), UINT8_C(223), UINT8_C( 44),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(133), UINT8_C(  0), UINT8_C(  0), UINT8_C(227), UINT8_C(232),
+      UINT8_C(253), UINT8_C(196), UINT8_C(  0), UINT8_C(  0), UINT8_C( 82), UINT8_C( 97), UINT8_C(  0), UINT8_C(159),
+      UINT8_C(111), UINT8_C(161), UINT8_C(208), UINT8_C(  0), UINT8_C(203), UINT8_C(230), UINT8_C(214), UINT8_C( 89),
+      UINT8_C(180), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 47), UINT8_C(214), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(167), UINT8_C(  0), UINT8_C(  0), UINT8_C( 63), UINT8_C(  0), UINT8_C(193), UINT8_C(157),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(227), UINT8_C(  0), UINT8_C(  0), UINT8_C(229), UINT8_C( 81),
+      UINT8_C(147), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(252), UINT8_C( 97), UINT8_C(115), UINT8_C(176),
+      UINT8_C(  0), UINT8_C(172), UINT8_C(253), UINT8_C(  0), UINT8_C(219), UINT8_C(159), UINT8_C(254), UINT8_C(252),
+      UINT8_C(  0), UINT8_C( 72), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0),
+      UINT8_C(212), UINT8_C(  0), UINT8_C(  0), UINT8_C(125), UINT8_C(  0), UINT8_C(150), UINT8_C(149), UINT8_C(  0),
+      UINT8_C(132), UINT8_C(  0), UINT8_C(206), UINT8_C(192), UINT8_C(  0), UINT8_C( 65), UINT8_C( 72), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(226), UINT8_C(  0), UINT8_C(249), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(159), UINT8_C(  0), UINT8_C(187), UINT8_C( 63), UINT8_C(238), UINT8_C(  0),
+      UINT8_C(252), UINT8_C(  0), UINT8_C(  0), UINT8_C(245), UINT8_C(103), UINT8_C(  0), UINT8_C(129), UINT8_C(235),
+      UINT8_C(196), UINT8_C(221), UINT8_C(108), UINT8_C(182), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(154),
+      UINT8_C(207), UINT8_C(190), UINT8_C(247), UINT8_C(180), UINT8_C(  0), UINT8_C(201), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(126), UINT8_C( 56), UINT8_C(  0), UINT8_C(  0), UINT8_C(167), UINT8_C(  0), UINT8_C(180),
+      UINT8_C(159), UINT8_C(114), UINT8_C( 77), UINT8_C(153), UINT8_C(  0), UINT8_C(206), UINT8_C(241), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(145), UINT8_C(250), UINT8_C(  0), UINT8_C(217), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(173), UINT8_C(221),
+      UINT8_C(200), UINT8_C(230), UINT8_C(144), UINT8_C(134), UINT8_C(141), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(181), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(148), UINT8_C(  0), UINT8_C(159),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(131), UINT8_C(216), UINT8_C(166), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(219), UINT8_C(  0), UINT8_C(126), UINT8_C(  0), UINT8_C(  0), UINT8_C(155), UINT8_C(198), UINT8_C( 74),
+      UINT8_C(  0), UINT8_C(247), UINT8_C(145), UINT8_C(141), UINT8_C(176), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(233), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(116), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(114), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(251), UINT8_C( 83), UINT8_C(  0), UINT8_C(121), UINT8_C(251), UINT8_C(186), UINT8_C( 73), UINT8_C(115),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(155), UINT8_C( 68), UINT8_C(224),
+      UINT8_C(211), UINT8_C( 79), UINT8_C(254), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(161), UINT8_C(217), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 39), UINT8_C(218),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(158), UINT8_C(254), UINT8_C(225), UINT8_C(185), UINT8_C( 50), UINT8_C(135),
+      UINT8_C(169), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(166), UINT8_C(128), UINT8_C(157), UINT8_C(136),
+      UINT8_C(207), UINT8_C(137), UINT8_C( 49), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(213),
+      UINT8_C(210), UINT8_C(164), UINT8_C(  0), UINT8_C(239), UINT8_C(151), UINT8_C(240), UINT8_C(252), UINT8_C(238),
+      UINT8_C(  0), UINT8_C(154), UINT8_C(171), UINT8_C(152), UINT8_C(  0), UINT8_C(  0), UINT8_C(134), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(181), UINT8_C(  0), UINT8_C(  0), UINT8_C(218), UINT8_C(127), UINT8_C(154), UINT8_C(  0),
+      UINT8_C(180), UINT8_C(  0), UINT8_C(214), UINT8_C(232), UINT8_C(157), UINT8_C(137), UINT8_C(  0), UINT8_C( 75),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(249), UINT8_C(  0), UINT8_C(  0), UINT8_C(195), UINT8_C( 73), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(245), UINT8_C(  0), UINT8_C(117), UINT8_C(  0), UINT8_C(248), UINT8_C(238), UINT8_C(216),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(232), UINT8_C(202), UINT8_C(  0), UINT8_C(129), UINT8_C(  0), UINT8_C(214),
+      UINT8_C(  0), UINT8_C( 74), UINT8_C(  0), UINT8_C(248), UINT8_C(139), UINT8_C(231), UINT8_C(  0), UINT8_C(185),
+      UINT8_C(126), UINT8_C(251), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(104), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 82), UINT8_C(  0), UINT8_C(  0), UINT8_C( 85), UINT8_C(  0), UINT8_C(200), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(219), UINT8_C(193), UINT8_C(238), UINT8_C(225),
+      UINT8_C(179), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 21),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(251), UINT8_C(244), UINT8_C(187),
+      UINT8_C(217), UINT8_C(234), UINT8_C(242), UINT8_C(  0), UINT8_C(178), UINT8_C( 75), UINT8_C(  0), UINT8_C( 59),
+      UINT8_C( 53), UINT8_C(127), UINT8_C(  0), UINT8_C(253), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(178), UINT8_C(  0), UINT8_C(184), UINT8_C(198), UINT8_C(193), UINT8_C(252), UINT8_C(219), UINT8_C(198),
+      UINT8_C(207), UINT8_C(190), UINT8_C(162), UINT8_C(  0), UINT8_C(  0), UINT8_C(132), UINT8_C(253), UINT8_C(  0),
+      UINT8_C(176), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(228), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(161), UINT8_C(131), UINT8_C(115), UINT8_C(  0), UINT8_C(254), UINT8_C(190), UINT8_C( 45), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(119), UINT8_C(249), UINT8_C(141), UINT8_C(  0), UINT8_C(  0), UINT8_C( 92),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(189), UINT8_C(  0), UINT8_C(  0), UINT8_C(200), UINT8_C( 68), UINT8_C(223),
+      UINT8_C(  0), UINT8_C(240), UINT8_C(  0), UINT8_C(  0), UINT8_C(233), UINT8_C(123), UINT8_C(251), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(148), UINT8_C(156), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(243), UINT8_C(149), UINT8_C(145), UINT8_C( 79),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(145), UINT8_C(  0), UINT8_C(212), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(149), UINT8_C(116), UINT8_C(100), UINT8_C(200), UINT8_C(160),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 28), UINT8_C( 73), UINT8_C( 31), UINT8_C(  0), UINT8_C(154), UINT8_C(221),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(252), UINT8_C(240), UINT8_C(122), UINT8_C(  0), UINT8_C(146), UINT8_C(253),
+      UINT8_C(220), UINT8_C(  0), UINT8_C(241), UINT8_C(228), UINT8_C(  0), UINT8_C(197), UINT8_C(196), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(220), UINT8_C(  0), UINT8_C(161), UINT8_C( 91), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(247), UINT8_C(  0), UINT8_C(129), UINT8_C(212), UINT8_C(  0),
+      UINT8_C(101), UINT8_C(  0), UINT8_C(  0), UINT8_C(223), UINT8_C(184), UINT8_C(  0), UINT8_C(  0), UINT8_C(238),
+      UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(123), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(231), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(159), UINT8_C(  0),
+      UINT8_C(186), UINT8_C(235), UINT8_C(  0), UINT8_C(175), UINT8_C(249), UINT8_C(253), UINT8_C(  0), UINT8_C(209),
+      UINT8_C(  0), UINT8_C(146), UINT8_C(  0), UINT8_C(  0), UINT8_C(211), UINT8_C(  0), UINT8_C(239), UINT8_C(  0),
+      UINT8_C(151), UINT8_C(  0), UINT8_C(  0), UINT8_C(250), UINT8_C(  0), UINT8_C(155), UINT8_C(197), UINT8_C(  0),
+      UINT8_C(176), UINT8_C(109), UINT8_C(236), UINT8_C(116), UINT8_C(100), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,
+      UINT8_C(220), UINT8_C(242), UINT8_C(  0), UINT8_C(147), UINT8_C(202), UINT8_C(117), UINT8_C(  0), UINT8_C(120),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(222), UINT8_C(  0) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_u8_z(pv, av, bv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+
+    ev = simde_svmax_u8_z(pv, av, bv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(119), UINT8_C( 51), UINT8_C(111), UINT8_C( 68), UINT8_C(248), UINT8_C(156), UINT8_C(239), UINT8_C(219),
+      UINT8_C(253), UINT8_C(231), UINT8_C(223), UINT8_C(228), UINT8_C(231), UINT8_C( 38), UINT8_C( 83), UINT8_C(159),
+      UINT8_C(104), UINT8_C(207), UINT8_C( 53), UINT8_C(191), UINT8_C( 28), UINT8_C(120), UINT8_C( 87), UINT8_C( 31),
+      UINT8_C( 55), UINT8_C(212), UINT8_C(199), UINT8_C(179), UINT8_C(220), UINT8_C( 70), UINT8_C(144), UINT8_C( 83),
+      UINT8_C(121),    UINT8_MAX, UINT8_C(151), UINT8_C(113), UINT8_C(156), UINT8_C(134), UINT8_C( 77), UINT8_C(153),
+      UINT8_C(109), UINT8_C( 44), UINT8_C(125), UINT8_C( 85), UINT8_C( 82), UINT8_C(208), UINT8_C(244), UINT8_C(186),
+      UINT8_C(160), UINT8_C( 42), UINT8_C(122), UINT8_C(188), UINT8_C(162), UINT8_C(209), UINT8_C(219), UINT8_C(217),
+      UINT8_C(166), UINT8_C(163), UINT8_C(140), UINT8_C(130), UINT8_C(233), UINT8_C( 28), UINT8_C(214), UINT8_C( 99),
+      UINT8_C( 28), UINT8_C(109), UINT8_C(212), UINT8_C(184), UINT8_C(244), UINT8_C( 33), UINT8_C( 81), UINT8_C( 97),
+      UINT8_C( 77), UINT8_C(206), UINT8_C(182), UINT8_C(160), UINT8_C(159), UINT8_C(171), UINT8_C( 90), UINT8_C( 63),
+      UINT8_C(213), UINT8_C(212), UINT8_C(251), UINT8_C(119), UINT8_C(166), UINT8_C(214), UINT8_C( 81), UINT8_C( 76),
+      UINT8_C(121), UINT8_C(221), UINT8_C(206), UINT8_C( 99), UINT8_C(250), UINT8_C(164), UINT8_C(198), UINT8_C( 22),
+      UINT8_C( 18), UINT8_C(154), UINT8_C(206), UINT8_C(  6), UINT8_C(188), UINT8_C( 31), UINT8_C(103), UINT8_C(  9),
+      UINT8_C(237), UINT8_C( 30), UINT8_C(169), UINT8_C(140), UINT8_C(201), UINT8_C(  4), UINT8_C(203), UINT8_C(158),
+      UINT8_C(216), UINT8_C(198), UINT8_C( 21), UINT8_C(126), UINT8_C(157), UINT8_C(102), UINT8_C(202), UINT8_C( 22),
+      UINT8_C( 68), UINT8_C(153), UINT8_C(121), UINT8_C( 62), UINT8_C( 61), UINT8_C( 63), UINT8_C( 84), UINT8_C( 79),
+      UINT8_C(218), UINT8_C( 34), UINT8_C( 85), UINT8_C(150), UINT8_C( 65), UINT8_C(189), UINT8_C(159), UINT8_C( 46),
+      UINT8_C(219), UINT8_C( 73), UINT8_C(187), UINT8_C(164), UINT8_C( 77), UINT8_C(134), UINT8_C( 66), UINT8_C( 37),
+      UINT8_C( 77), UINT8_C( 87), UINT8_C(164), UINT8_C(234), UINT8_C(190), UINT8_C(110), UINT8_C(  0), UINT8_C(  2),
+      UINT8_C(  7), UINT8_C(122), UINT8_C( 64), UINT8_C( 69), UINT8_C(185), UINT8_C(148), UINT8_C(148), UINT8_C(147),
+      UINT8_C(182), UINT8_C(234), UINT8_C( 41), UINT8_C(247), UINT8_C(167), UINT8_C(201), UINT8_C( 37), UINT8_C(130),
+      UINT8_C( 18), UINT8_C(224), UINT8_C( 38), UINT8_C( 95), UINT8_C(103), UINT8_C(104), UINT8_C(132), UINT8_C(180),
+      UINT8_C(191), UINT8_C( 40), UINT8_C(158), UINT8_C(125), UINT8_C(151), UINT8_C(158), UINT8_C(127), UINT8_C(158),
+      UINT8_C( 24), UINT8_C(191), UINT8_C(227), UINT8_C(210), UINT8_C( 83), UINT8_C(120), UINT8_C(101), UINT8_C(  9),
+      UINT8_C( 98), UINT8_C(143), UINT8_C(  0), UINT8_C(  9), UINT8_C( 88), UINT8_C( 38), UINT8_C(139), UINT8_C(106),
+      UINT8_C(  6), UINT8_C(177), UINT8_C(201), UINT8_C(109), UINT8_C( 25), UINT8_C( 77), UINT8_C( 33), UINT8_C(216),
+      UINT8_C(118), UINT8_C(191), UINT8_C( 86), UINT8_C( 13), UINT8_C( 94), UINT8_C(213), UINT8_C(171), UINT8_C(118),
+      UINT8_C(149), UINT8_C(143), UINT8_C( 72), UINT8_C(232), UINT8_C(  7), UINT8_C(174), UINT8_C(242), UINT8_C(105),
+      UINT8_C( 61), UINT8_C(242), UINT8_C(114), UINT8_C(149), UINT8_C( 24), UINT8_C(253),    UINT8_MAX, UINT8_C( 31),
+      UINT8_C(174), UINT8_C(200), UINT8_C(140), UINT8_C(199), UINT8_C( 21), UINT8_C(174), UINT8_C(159), UINT8_C(139),
+      UINT8_C(109), UINT8_C(245), UINT8_C(152), UINT8_C(203), UINT8_C(203), UINT8_C( 68), UINT8_C( 66), UINT8_C( 96),
+      UINT8_C(211), UINT8_C(138), UINT8_C( 72), UINT8_C(218), UINT8_C( 56), UINT8_C( 58), UINT8_C( 67), UINT8_C(117),
+      UINT8_C( 45), UINT8_C(181), UINT8_C( 10), UINT8_C( 69), UINT8_C(178), UINT8_C(  9), UINT8_C(100), UINT8_C( 96),
+      UINT8_C(209), UINT8_C(241), UINT8_C( 39), UINT8_C(231), UINT8_C(159), UINT8_C(198), UINT8_C(114), UINT8_C( 12),
+      UINT8_C(188), UINT8_C( 11), UINT8_C(216), UINT8_C(135), UINT8_C( 79), UINT8_C( 26), UINT8_C(231), UINT8_C( 34),
+      UINT8_C(164), UINT8_C( 47), UINT8_C(252), UINT8_C(221), UINT8_C(106), UINT8_C( 63), UINT8_C( 82), UINT8_C(151),
+      UINT8_C(244), UINT8_C( 93), UINT8_C(220), UINT8_C(166), UINT8_C(102), UINT8_C( 65), UINT8_C(  6), UINT8_C( 56),
+      UINT8_C( 50), UINT8_C( 45), UINT8_C( 31), UINT8_C(209), UINT8_C(243), UINT8_C(145), UINT8_C(221), UINT8_C(175),
+      UINT8_C(156), UINT8_C(181), UINT8_C( 54), UINT8_C(235), UINT8_C(207), UINT8_C( 29), UINT8_C( 13), UINT8_C(116),
+      UINT8_C( 77), UINT8_C(  9), UINT8_C( 81), UINT8_C(183), UINT8_C( 72), UINT8_C(163), UINT8_C( 78), UINT8_C( 60),
+      UINT8_C(  0), UINT8_C( 42), UINT8_C(226), UINT8_C(103), UINT8_C(107), UINT8_C(232), UINT8_C(159), UINT8_C(157),
+      UINT8_C( 21), UINT8_C(190), UINT8_C(110), UINT8_C(  9), UINT8_C( 79), UINT8_C( 76), UINT8_C(184), UINT8_C(236),
+      UINT8_C(  1), UINT8_C(239), UINT8_C(215), UINT8_C(209), UINT8_C( 12), UINT8_C(229), UINT8_C( 69), UINT8_C( 89),
+      UINT8_C(238), UINT8_C(150), UINT8_C( 16), UINT8_C( 55), UINT8_C( 57), UINT8_C( 94), UINT8_C(115), UINT8_C( 58),
+      UINT8_C(137), UINT8_C( 86), UINT8_C(161), UINT8_C(244), UINT8_C( 62), UINT8_C( 64), UINT8_C(146), UINT8_C( 84),
+      UINT8_C(254), UINT8_C(  0), UINT8_C( 93), UINT8_C( 77), UINT8_C( 76), UINT8_C( 21), UINT8_C( 57), UINT8_C( 78),
+      UINT8_C(  4), UINT8_C( 17), UINT8_C( 31), UINT8_C( 17), UINT8_C(246), UINT8_C(100), UINT8_C(106), UINT8_C(228),
+      UINT8_C(250), UINT8_C(123), UINT8_C( 27), UINT8_C( 51), UINT8_C(217), UINT8_C(143), UINT8_C(109), UINT8_C( 98),
+      UINT8_C(229), UINT8_C( 14), UINT8_C( 87), UINT8_C( 35), UINT8_C( 78), UINT8_C(233), UINT8_C(119), UINT8_C( 76),
+      UINT8_C(233), UINT8_C(212), UINT8_C(154), UINT8_C( 54), UINT8_C(234), UINT8_C(211), UINT8_C(132), UINT8_C(238),
+      UINT8_C(228), UINT8_C(163),    UINT8_MAX, UINT8_C(218), UINT8_C(  7), UINT8_C(106), UINT8_C(191), UINT8_C(  1),
+      UINT8_C(229), UINT8_C(218), UINT8_C( 52), UINT8_C(190), UINT8_C(105), UINT8_C(162), UINT8_C( 33), UINT8_C( 78),
+      UINT8_C(176), UINT8_C(120), UINT8_C(114),    UINT8_MAX, UINT8_C( 97), UINT8_C(233), UINT8_C( 75), UINT8_C( 74),
+      UINT8_C(190), UINT8_C(229), UINT8_C(128), UINT8_C(168), UINT8_C(185), UINT8_C(  4), UINT8_C(150), UINT8_C(157),
+      UINT8_C(167), UINT8_C(150), UINT8_C(120), UINT8_C(174), UINT8_C(  0), UINT8_C( 55), UINT8_C(175), UINT8_C(229),
+      UINT8_C( 17), UINT8_C(228), UINT8_C(163), UINT8_C(123), UINT8_C(134), UINT8_C(196), UINT8_C(201), UINT8_C( 54),
+      UINT8_C( 60), UINT8_C( 59), UINT8_C( 53), UINT8_C(157), UINT8_C( 37), UINT8_C(129), UINT8_C(232), UINT8_C(227),
+      UINT8_C(102), UINT8_C(104), UINT8_C(139), UINT8_C( 31), UINT8_C(109), UINT8_C( 33), UINT8_C(189), UINT8_C( 20),
+      UINT8_C(183), UINT8_C( 53), UINT8_C(195), UINT8_C(183), UINT8_C(108), UINT8_C(114), UINT8_C(156), UINT8_C(125),
+      UINT8_C( 86), UINT8_C( 64), UINT8_C(248), UINT8_C(220), UINT8_C(  4), UINT8_C(194), UINT8_C( 19), UINT8_C( 65),
+      UINT8_C(253), UINT8_C( 72), UINT8_C(222), UINT8_C( 34), UINT8_C(201), UINT8_C(198), UINT8_C(  5), UINT8_C( 48),
+      UINT8_C( 47), UINT8_C(144), UINT8_C( 79), UINT8_C(156), UINT8_C(178), UINT8_C( 12), UINT8_C(176), UINT8_C(105),
+      UINT8_C( 65), UINT8_C(115), UINT8_C( 33), UINT8_C(173), UINT8_C(230), UINT8_C(189), UINT8_C( 43), UINT8_C( 60),
+      UINT8_C(253), UINT8_C( 35), UINT8_C( 25), UINT8_C(  2), UINT8_C(229), UINT8_C( 44), UINT8_C( 67), UINT8_C(227),
+      UINT8_C(116), UINT8_C( 33), UINT8_C(  5), UINT8_C( 62), UINT8_C(232), UINT8_C( 11), UINT8_C(110), UINT8_C( 23),
+      UINT8_C(155), UINT8_C(189), UINT8_C(179), UINT8_C( 77), UINT8_C(202), UINT8_C( 99), UINT8_C(183), UINT8_C( 11),
+      UINT8_C(215), UINT8_C(216), UINT8_C(185), UINT8_C(189), UINT8_C(149), UINT8_C(228), UINT8_C(249), UINT8_C(147),
+      UINT8_C(  7), UINT8_C( 18), UINT8_C(149), UINT8_C(237), UINT8_C( 62), UINT8_C(216), UINT8_C(208), UINT8_C(179),
+      UINT8_C(249), UINT8_C(213), UINT8_C(241), UINT8_C(225), UINT8_C(224), UINT8_C( 95), UINT8_C(248), UINT8_C(124),
+      UINT8_C( 28), UINT8_C(171), UINT8_C(201), UINT8_C(230), UINT8_C( 15), UINT8_C(128), UINT8_C(242), UINT8_C(230),
+      UINT8_C( 88), UINT8_C(171), UINT8_C(163), UINT8_C(238), UINT8_C(143), UINT8_C(156), UINT8_C(129), UINT8_C(150),
+      UINT8_C(175), UINT8_C( 22), UINT8_C(131), UINT8_C(237), UINT8_C(238), UINT8_C( 83), UINT8_C(160), UINT8_C(231),
+      UINT8_C( 41), UINT8_C(145), UINT8_C(201), UINT8_C(  9), UINT8_C(240), UINT8_C(193), UINT8_C(133), UINT8_C( 13),
+      UINT8_C(109), UINT8_C( 79), UINT8_C(243), UINT8_C(124), UINT8_C(207), UINT8_C(229), UINT8_C( 98), UINT8_C( 40),
+      UINT8_C(144), UINT8_C(  5), UINT8_C( 22), UINT8_C( 31), UINT8_C(161), UINT8_C(151), UINT8_C(182), UINT8_C( 80),
+      UINT8_C(173), UINT8_C( 57), UINT8_C( 62), UINT8_C(155), UINT8_C(141), UINT8_C(222), UINT8_C(130), UINT8_C(182),
+      UINT8_C(112), UINT8_C( 75), UINT8_C(191), UINT8_C( 96), UINT8_C( 13), UINT8_C( 69), UINT8_C(109), UINT8_C(122),
+      UINT8_C(148), UINT8_C( 97), UINT8_C(246), UINT8_C( 99), UINT8_C( 70), UINT8_C( 88), UINT8_C(139), UINT8_C(215),
+      UINT8_C( 93), UINT8_C(161), UINT8_C(246), UINT8_C(254), UINT8_C( 56), UINT8_C(172), UINT8_C( 79), UINT8_C(229),
+      UINT8_C(230), UINT8_C(141), UINT8_C(128), UINT8_C(115), UINT8_C(107), UINT8_C(  3), UINT8_C( 41), UINT8_C(219),
+      UINT8_C( 78), UINT8_C(232), UINT8_C( 60), UINT8_C( 91), UINT8_C( 45), UINT8_C(169), UINT8_C(213), UINT8_C(193),
+      UINT8_C( 10), UINT8_C(203), UINT8_C( 37), UINT8_C( 81), UINT8_C( 35), UINT8_C(176), UINT8_C( 40), UINT8_C(128),
+      UINT8_C( 82), UINT8_C( 30), UINT8_C(127), UINT8_C(138), UINT8_C(203), UINT8_C(206), UINT8_C(112), UINT8_C(177),
+      UINT8_C( 91), UINT8_C(240), UINT8_C( 36), UINT8_C(198), UINT8_C(243), UINT8_C( 77), UINT8_C(162), UINT8_C( 66),
+      UINT8_C( 53), UINT8_C(222), UINT8_C(157), UINT8_C( 99), UINT8_C(135), UINT8_C(115), UINT8_C( 36), UINT8_C(146),
+      UINT8_C( 62), UINT8_C( 73), UINT8_C(227), UINT8_C( 98), UINT8_C(250), UINT8_C( 11), UINT8_C(226), UINT8_C( 76),
+      UINT8_C( 41), UINT8_C( 97), UINT8_C(214), UINT8_C(244), UINT8_C( 47), UINT8_C( 70), UINT8_C(165), UINT8_C(138),
+      UINT8_C( 55), UINT8_C(201), UINT8_C( 81), UINT8_C( 42), UINT8_C( 22), UINT8_C(243), UINT8_C(108), UINT8_C( 76),
+      UINT8_C(209), UINT8_C( 10), UINT8_C(175), UINT8_C( 88), UINT8_C(125), UINT8_C(211), UINT8_C(234), UINT8_C(187),
+      UINT8_C( 29), UINT8_C(205), UINT8_C( 29), UINT8_C( 23), UINT8_C(216), UINT8_C(  0), UINT8_C( 99), UINT8_C(  2),
+      UINT8_C( 97), UINT8_C( 57), UINT8_C(246), UINT8_C(145), UINT8_C(128), UINT8_C(156), UINT8_C( 27), UINT8_C(183),
+      UINT8_C(101), UINT8_C(108), UINT8_C(225), UINT8_C(124), UINT8_C( 95), UINT8_C( 78), UINT8_C(200), UINT8_C( 48),
+      UINT8_C( 88), UINT8_C(119), UINT8_C(137), UINT8_C(213), UINT8_C( 74), UINT8_C(115), UINT8_C(144), UINT8_C(103),
+      UINT8_C( 65), UINT8_C(174), UINT8_C(126), UINT8_C( 25), UINT8_C(174), UINT8_C(225), UINT8_C( 27), UINT8_C( 15),
+      UINT8_C( 27), UINT8_C( 18), UINT8_C(160), UINT8_C(155), UINT8_C(174), UINT8_C(188), UINT8_C( 82), UINT8_C( 19),
+      UINT8_C( 40), UINT8_C( 51), UINT8_C(143), UINT8_C(136), UINT8_C(129), UINT8_C( 87), UINT8_C(184), UINT8_C(217),
+      UINT8_C(206), UINT8_C( 65), UINT8_C(174), UINT8_C( 25), UINT8_C(181), UINT8_C( 63), UINT8_C(128), UINT8_C(246),
+      UINT8_C(237),    UINT8_MAX, UINT8_C( 15), UINT8_C(155), UINT8_C(224), UINT8_C( 43), UINT8_C(170), UINT8_C(251),
+      UINT8_C( 61), UINT8_C( 75), UINT8_C(150), UINT8_C(235), UINT8_C(  7), UINT8_C(232), UINT8_C(254), UINT8_C( 47),
+      UINT8_C( 28), UINT8_C(142), UINT8_C(183), UINT8_C(157), UINT8_C(229), UINT8_C(112), UINT8_C(119), UINT8_C(180),
+      UINT8_C(177), UINT8_C( 37), UINT8_C(205), UINT8_C(102), UINT8_C(100), UINT8_C( 77), UINT8_C( 92), UINT8_C( 81),
+      UINT8_C( 76), UINT8_C(108), UINT8_C(236), UINT8_C( 45), UINT8_C(151), UINT8_C(151), UINT8_C( 40), UINT8_C(212),
+      UINT8_C(226), UINT8_C(191), UINT8_C(191), UINT8_C(233), UINT8_C(167), UINT8_C(189), UINT8_C( 24), UINT8_C(195),
+      UINT8_C( 75), UINT8_C(208), UINT8_C( 97), UINT8_C( 49), UINT8_C( 64), UINT8_C(216), UINT8_C(229), UINT8_C(241),
+      UINT8_C(253), UINT8_C(178), UINT8_C( 88), UINT8_C( 98),    UINT8_MAX, UINT8_C(180), UINT8_C(179), UINT8_C( 76),
+      UINT8_C( 32), UINT8_C(160), UINT8_C(121), UINT8_C(183), UINT8_C( 55), UINT8_C(161), UINT8_C(139), UINT8_C( 25),
+      UINT8_C( 96), UINT8_C( 74), UINT8_C(  2), UINT8_C(  8), UINT8_C(  8), UINT8_C( 26), UINT8_C(203), UINT8_C( 83),
+      UINT8_C(234), UINT8_C( 44), UINT8_C(132), UINT8_C( 42), UINT8_C(  4), UINT8_C(105), UINT8_C( 28), UINT8_C(  2),
+      UINT8_C( 27), UINT8_C(116), UINT8_C(100), UINT8_C( 27), UINT8_C( 40), UINT8_C( 23), UINT8_C(103), UINT8_C( 73),
+      UINT8_C(183), UINT8_C(224), UINT8_C(  0), UINT8_C(238), UINT8_C(129), UINT8_C(140), UINT8_C(  7), UINT8_C(226),
+      UINT8_C(214), UINT8_C(  9), UINT8_C(234), UINT8_C(222), UINT8_C( 36), UINT8_C(181), UINT8_C( 50), UINT8_C( 14),
+      UINT8_C(226), UINT8_C(182), UINT8_C( 57), UINT8_C(230), UINT8_C( 32), UINT8_C( 85), UINT8_C(232), UINT8_C( 59),
+      UINT8_C(201), UINT8_C( 76), UINT8_C( 86), UINT8_C(241), UINT8_C(100), UINT8_C(189), UINT8_C( 58), UINT8_C( 27),
+      UINT8_C(157), UINT8_C( 59), UINT8_C( 10), UINT8_C( 31), UINT8_C(199), UINT8_C( 17), UINT8_C(  1), UINT8_C(157),
+      UINT8_C( 27), UINT8_C(235), UINT8_C(124), UINT8_C( 63), UINT8_C(160), UINT8_C(174), UINT8_C( 77), UINT8_C(130),
+      UINT8_C(100), UINT8_C(134), UINT8_C(105), UINT8_C(132), UINT8_C(219), UINT8_C( 81), UINT8_C(192), UINT8_C(164),
+      UINT8_C(158), UINT8_C( 22), UINT8_C(150), UINT8_C(  2), UINT8_C(212), UINT8_C(208), UINT8_C( 29), UINT8_C(113),
+      UINT8_C( 11), UINT8_C( 39), UINT8_C(144), UINT8_C(210), UINT8_C( 57), UINT8_C(145), UINT8_C(112), UINT8_C( 84),
+      UINT8_C(124), UINT8_C(236), UINT8_C(147), UINT8_C( 29), UINT8_C(154), UINT8_C(224), UINT8_C(159), UINT8_C(254),
+      UINT8_C(103), UINT8_C(  8), UINT8_C(131), UINT8_C( 66), UINT8_C( 90), UINT8_C( 67), UINT8_C(231), UINT8_C(248),
+      UINT8_C( 89), UINT8_C(125), UINT8_C(250), UINT8_C( 45), UINT8_C( 77), UINT8_C( 23), UINT8_C(159), UINT8_C( 89),
+      UINT8_C( 63), UINT8_C( 47), UINT8_C( 43), UINT8_C(120), UINT8_C(193), UINT8_C(155), UINT8_C(204), UINT8_C( 61),
+      UINT8_C(135), UINT8_C( 95) };
+  static const uint8_t b[] =
+    { UINT8_C(144), UINT8_C(185), UINT8_C(206), UINT8_C(246), UINT8_C(197), UINT8_C(194), UINT8_C(155), UINT8_C(  0),
+      UINT8_C(225), UINT8_C(184), UINT8_C(253), UINT8_C(155), UINT8_C(161), UINT8_C( 55), UINT8_C(221), UINT8_C(233),
+      UINT8_C(203), UINT8_C( 65), UINT8_C(113), UINT8_C( 90), UINT8_C(196), UINT8_C(159), UINT8_C(235), UINT8_C(235),
+      UINT8_C(182), UINT8_C(216), UINT8_C(247), UINT8_C(157), UINT8_C( 26), UINT8_C( 67), UINT8_C(209), UINT8_C(171),
+      UINT8_C(252), UINT8_C(159), UINT8_C(161), UINT8_C(193), UINT8_C( 97), UINT8_C( 61), UINT8_C(194), UINT8_C( 66),
+      UINT8_C(245), UINT8_C(191), UINT8_C(222), UINT8_C(151), UINT8_C(246), UINT8_C(187), UINT8_C(128), UINT8_C(193),
+      UINT8_C(252), UINT8_C(241), UINT8_C( 27), UINT8_C(193), UINT8_C(144), UINT8_C(  6), UINT8_C(172), UINT8_C( 70),
+      UINT8_C(223), UINT8_C(163), UINT8_C(227), UINT8_C(249), UINT8_C(231), UINT8_C(180), UINT8_C(164), UINT8_C(227),
+      UINT8_C( 84), UINT8_C( 70), UINT8_C(165), UINT8_C(181), UINT8_C(131), UINT8_C(103), UINT8_C(248), UINT8_C(120),
+      UINT8_C( 38), UINT8_C(214), UINT8_C( 15), UINT8_C( 28), UINT8_C(145), UINT8_C(144), UINT8_C(221), UINT8_C(142),
+      UINT8_C(129), UINT8_C(249), UINT8_C( 79), UINT8_C( 18),    UINT8_MAX, UINT8_C(251), UINT8_C( 88), UINT8_C(222),
+      UINT8_C(158), UINT8_C( 60), UINT8_C(216), UINT8_C(133), UINT8_C(240), UINT8_C(124), UINT8_C(105), UINT8_C( 68),
+      UINT8_C(194), UINT8_C( 14), UINT8_C(250), UINT8_C( 69), UINT8_C(117), UINT8_C(242), UINT8_C(190), UINT8_C(155),
+      UINT8_C(200), UINT8_C(205), UINT8_C(183), UINT8_C( 89), UINT8_C( 93), UINT8_C(148), UINT8_C(231), UINT8_C(223),
+      UINT8_C(141), UINT8_C( 54), UINT8_C(241), UINT8_C(141), UINT8_C( 49), UINT8_C( 73), UINT8_C(107), UINT8_C(208),
+      UINT8_C(133), UINT8_C( 67), UINT8_C( 85), UINT8_C(118), UINT8_C(192), UINT8_C(190), UINT8_C(186), UINT8_C(130),
+      UINT8_C(204), UINT8_C(180), UINT8_C(200), UINT8_C( 65), UINT8_C(166), UINT8_C(134), UINT8_C(220), UINT8_C(110),
+      UINT8_C( 83), UINT8_C(147), UINT8_C(200), UINT8_C(177), UINT8_C( 40), UINT8_C(175), UINT8_C(144), UINT8_C(181),
+      UINT8_C(230), UINT8_C(129), UINT8_C( 66), UINT8_C( 23), UINT8_C(202), UINT8_C(174), UINT8_C(231), UINT8_C( 80),
+      UINT8_C(241), UINT8_C( 61), UINT8_C(198), UINT8_C(177), UINT8_C(251), UINT8_C(128), UINT8_C( 52), UINT8_C(200),
+      UINT8_C( 53), UINT8_C(252), UINT8_C(  9), UINT8_C(219), UINT8_C(130), UINT8_C(230), UINT8_C( 74), UINT8_C(213),
+      UINT8_C(121), UINT8_C( 18), UINT8_C(134), UINT8_C(161), UINT8_C(193), UINT8_C( 22), UINT8_C( 87), UINT8_C(167),
+      UINT8_C(151), UINT8_C(153), UINT8_C(191), UINT8_C( 98), UINT8_C( 71), UINT8_C(166), UINT8_C(178), UINT8_C( 57),
+      UINT8_C(227), UINT8_C(120), UINT8_C(234), UINT8_C(223), UINT8_C(248), UINT8_C( 30), UINT8_C(167), UINT8_C( 45),
+      UINT8_C( 26), UINT8_C(176), UINT8_C(  9), UINT8_C(156), UINT8_C(150), UINT8_C( 83), UINT8_C(114), UINT8_C( 16),
+      UINT8_C(101), UINT8_C(248), UINT8_C(177), UINT8_C( 38), UINT8_C( 15), UINT8_C(  8), UINT8_C(206), UINT8_C(166),
+      UINT8_C(162), UINT8_C(141), UINT8_C(  8), UINT8_C(233), UINT8_C( 51), UINT8_C(186), UINT8_C( 34), UINT8_C( 23),
+      UINT8_C( 50), UINT8_C( 13), UINT8_C(246), UINT8_C( 43), UINT8_C( 43), UINT8_C(157), UINT8_C( 88), UINT8_C( 70),
+      UINT8_C( 77), UINT8_C( 97), UINT8_C(226), UINT8_C(228), UINT8_C(180), UINT8_C( 84), UINT8_C(244), UINT8_C( 25),
+      UINT8_C( 77), UINT8_C(165), UINT8_C( 64), UINT8_C( 92), UINT8_C(174), UINT8_C( 14), UINT8_C(  2), UINT8_C( 80),
+      UINT8_C(155), UINT8_C( 11), UINT8_C( 57), UINT8_C(206), UINT8_C(197), UINT8_C( 92), UINT8_C(229), UINT8_C(248),
+      UINT8_C(105), UINT8_C(219), UINT8_C( 35), UINT8_C(148), UINT8_C(120), UINT8_C(123), UINT8_C(218), UINT8_C(198),
+      UINT8_C(221), UINT8_C(189), UINT8_C(170), UINT8_C(145), UINT8_C( 17), UINT8_C(158), UINT8_C(171), UINT8_C( 94),
+      UINT8_C( 67), UINT8_C(235), UINT8_C(186), UINT8_C(241), UINT8_C(249), UINT8_C(189), UINT8_C( 65), UINT8_C(148),
+      UINT8_C(200), UINT8_C(123), UINT8_C( 98), UINT8_C(141), UINT8_C(215), UINT8_C( 72), UINT8_C(133), UINT8_C( 64),
+      UINT8_C( 35), UINT8_C(168), UINT8_C(212), UINT8_C(156), UINT8_C( 36), UINT8_C(175), UINT8_C( 98), UINT8_C(  1),
+      UINT8_C(108), UINT8_C( 12), UINT8_C(146), UINT8_C(125), UINT8_C(170), UINT8_C( 61), UINT8_C(220), UINT8_C(237),
+      UINT8_C( 40), UINT8_C(150), UINT8_C(223), UINT8_C( 33), UINT8_C( 83), UINT8_C( 32), UINT8_C(181), UINT8_C( 27),
+      UINT8_C(155), UINT8_C( 24), UINT8_C(169), UINT8_C(114), UINT8_C( 96), UINT8_C( 46), UINT8_C(178), UINT8_C(131),
+      UINT8_C(215), UINT8_C(135), UINT8_C( 31), UINT8_C(251), UINT8_C( 54), UINT8_C(129), UINT8_C(252), UINT8_C(162),
+      UINT8_C(141), UINT8_C(142), UINT8_C( 31), UINT8_C( 55), UINT8_C(204), UINT8_C(251), UINT8_C( 37), UINT8_C(244),
+      UINT8_C(146), UINT8_C(  4), UINT8_C( 22), UINT8_C(229), UINT8_C( 36), UINT8_C(203), UINT8_C(  1), UINT8_C(192),
+      UINT8_C(227), UINT8_C(170), UINT8_C( 50), UINT8_C( 67), UINT8_C(216), UINT8_C(229), UINT8_C(199), UINT8_C(175),
+      UINT8_C(108), UINT8_C(230), UINT8_C(170), UINT8_C(162), UINT8_C(104), UINT8_C(166), UINT8_C( 68), UINT8_C(245),
+      UINT8_C( 53), UINT8_C( 99), UINT8_C( 45), UINT8_C(  1), UINT8_C( 95), UINT8_C( 82), UINT8_C(245), UINT8_C(241),
+      UINT8_C( 86), UINT8_C( 11), UINT8_C(214), UINT8_C(122), UINT8_C(215), UINT8_C(215), UINT8_C( 58), UINT8_C(186),
+      UINT8_C(129), UINT8_C(109), UINT8_C(254), UINT8_C( 90), UINT8_C( 82), UINT8_C(197), UINT8_C(  9), UINT8_C(190),
+      UINT8_C(171), UINT8_C(180), UINT8_C( 96), UINT8_C( 19), UINT8_C( 90), UINT8_C(164), UINT8_C(  9), UINT8_C(143),
+      UINT8_C(  7), UINT8_C( 54), UINT8_C(144), UINT8_C(102), UINT8_C(136), UINT8_C(134), UINT8_C( 87), UINT8_C(222),
+      UINT8_C(145), UINT8_C( 46), UINT8_C( 88), UINT8_C(104), UINT8_C(  5), UINT8_C(147), UINT8_C( 35), UINT8_C(135),
+      UINT8_C(  0), UINT8_C( 33), UINT8_C(225), UINT8_C( 82), UINT8_C(230), UINT8_C(234), UINT8_C( 16), UINT8_C(145),
+      UINT8_C(158), UINT8_C(112), UINT8_C(165), UINT8_C(249), UINT8_C( 20), UINT8_C(174), UINT8_C(136), UINT8_C( 27),
+      UINT8_C(228), UINT8_C( 25), UINT8_C(130), UINT8_C(108), UINT8_C(159), UINT8_C(217), UINT8_C( 74), UINT8_C( 48),
+      UINT8_C(  7), UINT8_C(162), UINT8_C(153), UINT8_C( 13), UINT8_C( 53), UINT8_C(188), UINT8_C(148), UINT8_C( 53),
+      UINT8_C(221), UINT8_C(117), UINT8_C(135), UINT8_C(195), UINT8_C( 95), UINT8_C(151), UINT8_C( 84), UINT8_C(254),
+      UINT8_C(  7), UINT8_C(249), UINT8_C(247), UINT8_C( 27), UINT8_C(167), UINT8_C(127), UINT8_C( 55), UINT8_C(139),
+      UINT8_C(152), UINT8_C(185), UINT8_C(247), UINT8_C( 55), UINT8_C(146), UINT8_C( 65), UINT8_C(104), UINT8_C(154),
+      UINT8_C(228), UINT8_C(  1), UINT8_C(167), UINT8_C( 25), UINT8_C(189), UINT8_C( 59), UINT8_C( 79), UINT8_C(154),
+      UINT8_C(176), UINT8_C(214), UINT8_C( 93), UINT8_C( 15), UINT8_C(110), UINT8_C(177), UINT8_C( 13), UINT8_C(117),
+      UINT8_C(171), UINT8_C(  4), UINT8_C(145), UINT8_C( 82), UINT8_C(132), UINT8_C(200), UINT8_C(222), UINT8_C( 28),
+      UINT8_C(129), UINT8_C(213), UINT8_C( 84), UINT8_C( 19), UINT8_C( 23), UINT8_C(188), UINT8_C(173), UINT8_C(251),
+      UINT8_C(189), UINT8_C( 84), UINT8_C( 20), UINT8_C(122), UINT8_C(143), UINT8_C( 99), UINT8_C( 20), UINT8_C( 63),
+      UINT8_C( 58), UINT8_C(113), UINT8_C( 79), UINT8_C(168), UINT8_C( 34), UINT8_C( 92), UINT8_C( 29), UINT8_C(205),
+      UINT8_C( 97), UINT8_C(174), UINT8_C( 32), UINT8_C(229), UINT8_C(118), UINT8_C(254), UINT8_C(  1), UINT8_C(247),
+      UINT8_C(211), UINT8_C( 85), UINT8_C( 11), UINT8_C(234), UINT8_C( 17), UINT8_C(184), UINT8_C(229), UINT8_C(206),
+      UINT8_C( 13), UINT8_C(250), UINT8_C( 72), UINT8_C(156), UINT8_C( 93), UINT8_C( 92), UINT8_C(220), UINT8_C(151),
+      UINT8_C(205), UINT8_C( 43), UINT8_C( 63), UINT8_C(240), UINT8_C(135), UINT8_C( 93), UINT8_C(189), UINT8_C(232),
+      UINT8_C( 11), UINT8_C(221), UINT8_C(205), UINT8_C(130), UINT8_C(219), UINT8_C(207), UINT8_C(121), UINT8_C(175),
+      UINT8_C( 36), UINT8_C(132), UINT8_C(153), UINT8_C( 54), UINT8_C( 61), UINT8_C(127), UINT8_C(  4), UINT8_C( 74),
+      UINT8_C(121), UINT8_C( 77), UINT8_C(230), UINT8_C(214), UINT8_C(169), UINT8_C(194), UINT8_C(110), UINT8_C(119),
+      UINT8_C(237), UINT8_C(173), UINT8_C(103), UINT8_C(117), UINT8_C( 10), UINT8_C( 36), UINT8_C( 93), UINT8_C( 22),
+      UINT8_C(  2), UINT8_C( 43), UINT8_C(152), UINT8_C(221), UINT8_C(250), UINT8_C( 17), UINT8_C(140), UINT8_C( 30),
+      UINT8_C(150), UINT8_C( 38), UINT8_C( 84), UINT8_C(211), UINT8_C(165), UINT8_C( 89), UINT8_C( 29), UINT8_C( 30),
+      UINT8_C(166), UINT8_C(  3), UINT8_C(244), UINT8_C( 79), UINT8_C(198), UINT8_C( 98), UINT8_C(198), UINT8_C(179),
+      UINT8_C( 16), UINT8_C( 45), UINT8_C( 40), UINT8_C( 26), UINT8_C( 82), UINT8_C(134), UINT8_C( 48), UINT8_C( 84),
+      UINT8_C(177), UINT8_C(200), UINT8_C( 49), UINT8_C(171), UINT8_C(218), UINT8_C(190), UINT8_C(201), UINT8_C(112),
+      UINT8_C(228), UINT8_C( 30), UINT8_C( 67), UINT8_C(137), UINT8_C(119), UINT8_C( 96), UINT8_C(167), UINT8_C( 29),
+      UINT8_C( 99), UINT8_C(155), UINT8_C(108), UINT8_C( 41), UINT8_C(254), UINT8_C( 51), UINT8_C(221), UINT8_C( 14),
+      UINT8_C( 96), UINT8_C(  5), UINT8_C( 40), UINT8_C(178), UINT8_C(139), UINT8_C( 89), UINT8_C(  6), UINT8_C( 60),
+      UINT8_C( 33), UINT8_C( 56), UINT8_C(231), UINT8_C(251), UINT8_C(246), UINT8_C(177), UINT8_C(107), UINT8_C(218),
+      UINT8_C(207), UINT8_C(174), UINT8_C( 99), UINT8_C( 70), UINT8_C( 14), UINT8_C( 10), UINT8_C( 99), UINT8_C(114),
+      UINT8_C(165), UINT8_C(207), UINT8_C(155), UINT8_C(163), UINT8_C(  2), UINT8_C(120), UINT8_C(177), UINT8_C( 99),
+      UINT8_C(126), UINT8_C(218), UINT8_C( 21), UINT8_C(  9), UINT8_C( 51), UINT8_C( 28), UINT8_C( 70), UINT8_C( 84),
+      UINT8_C( 84), UINT8_C( 45), UINT8_C( 80), UINT8_C( 74), UINT8_C(222), UINT8_C(187), UINT8_C( 36), UINT8_C(173),
+      UINT8_C(106), UINT8_C(135), UINT8_C(243), UINT8_C(120), UINT8_C(145), UINT8_C( 86), UINT8_C(234), UINT8_C( 54),
+      UINT8_C( 38), UINT8_C(134), UINT8_C(218), UINT8_C( 40), UINT8_C(254), UINT8_C(139), UINT8_C(139), UINT8_C(124),
+      UINT8_C(101), UINT8_C(161), UINT8_C(134), UINT8_C(152), UINT8_C(189), UINT8_C(204), UINT8_C(237), UINT8_C( 17),
+      UINT8_C(249), UINT8_C( 61), UINT8_C( 91), UINT8_C(216), UINT8_C(248), UINT8_C(127), UINT8_C(133), UINT8_C( 98),
+      UINT8_C(  6), UINT8_C(121), UINT8_C(219), UINT8_C(151), UINT8_C(207), UINT8_C(197), UINT8_C(205), UINT8_C(245),
+      UINT8_C( 75), UINT8_C(167), UINT8_C( 30), UINT8_C( 74), UINT8_C( 51), UINT8_C(169), UINT8_C(198), UINT8_C(152),
+      UINT8_C( 74), UINT8_C( 76), UINT8_C( 49), UINT8_C(  7), UINT8_C( 24), UINT8_C( 30), UINT8_C( 24), UINT8_C( 18),
+      UINT8_C( 91), UINT8_C(115), UINT8_C(234), UINT8_C( 83), UINT8_C(242), UINT8_C(111), UINT8_C(182), UINT8_C(248),
+      UINT8_C(232), UINT8_C(145), UINT8_C(143), UINT8_C(184), UINT8_C( 86), UINT8_C( 93), UINT8_C(173), UINT8_C(162),
+      UINT8_C(  4), UINT8_C(203), UINT8_C(236), UINT8_C( 55), UINT8_C(117), UINT8_C(178), UINT8_C(208), UINT8_C(191),
+         UINT8_MAX, UINT8_C(  1), UINT8_C(199), UINT8_C( 23), UINT8_C( 31), UINT8_C(223), UINT8_C( 41), UINT8_C(122),
+      UINT8_C( 83), UINT8_C( 19), UINT8_C(205), UINT8_C( 69), UINT8_C(131), UINT8_C(131), UINT8_C( 62), UINT8_C(107),
+      UINT8_C( 20), UINT8_C(205), UINT8_C( 35), UINT8_C(107), UINT8_C( 42), UINT8_C(209), UINT8_C( 13), UINT8_C( 47),
+      UINT8_C(156), UINT8_C(249), UINT8_C(102), UINT8_C( 17), UINT8_C(171), UINT8_C( 54), UINT8_C(209), UINT8_C(170),
+      UINT8_C( 55), UINT8_C(152), UINT8_C(194), UINT8_C( 86), UINT8_C(119), UINT8_C(235), UINT8_C(208), UINT8_C(202),
+         UINT8_MAX, UINT8_C(158), UINT8_C( 16), UINT8_C(130), UINT8_C( 33), UINT8_C( 78), UINT8_C(237), UINT8_C( 54),
+      UINT8_C( 27), UINT8_C( 17), UINT8_C(161), UINT8_C( 70), UINT8_C(226), UINT8_C(174), UINT8_C(117), UINT8_C(126),
+      UINT8_C(167), UINT8_C(219), UINT8_C(144), UINT8_C( 82), UINT8_C( 18), UINT8_C( 97), UINT8_C(253), UINT8_C( 73),
+      UINT8_C(249), UINT8_C(191), UINT8_C(160), UINT8_C(112), UINT8_C(170), UINT8_C(112), UINT8_C( 59), UINT8_C(169),
+      UINT8_C( 14), UINT8_C( 75), UINT8_C( 43), UINT8_C( 48), UINT8_C(153), UINT8_C( 25), UINT8_C(102), UINT8_C(180),
+      UINT8_C( 42), UINT8_C(  7), UINT8_C(250), UINT8_C( 12), UINT8_C(181), UINT8_C(111), UINT8_C(138), UINT8_C( 92),
+      UINT8_C( 75), UINT8_C( 26), UINT8_C(174), UINT8_C( 93), UINT8_C(123), UINT8_C(171), UINT8_C(166), UINT8_C(116),
+      UINT8_C(106), UINT8_C( 70), UINT8_C(229), UINT8_C( 21), UINT8_C(183), UINT8_C( 32), UINT8_C(190), UINT8_C(197),
+      UINT8_C(107), UINT8_C(234), UINT8_C(245), UINT8_C(  4), UINT8_C(  3), UINT8_C( 91), UINT8_C(184), UINT8_C( 45),
+      UINT8_C( 98), UINT8_C(179), UINT8_C( 57), UINT8_C( 23), UINT8_C( 34), UINT8_C(195), UINT8_C(115), UINT8_C(109),
+      UINT8_C(222), UINT8_C( 34), UINT8_C(202), UINT8_C( 89), UINT8_C(205), UINT8_C(113), UINT8_C(206), UINT8_C( 56),
+      UINT8_C(183), UINT8_C(179), UINT8_C( 77), UINT8_C(110), UINT8_C(211), UINT8_C( 11), UINT8_C( 52), UINT8_C( 62),
+      UINT8_C(245), UINT8_C( 41), UINT8_C( 66), UINT8_C(248), UINT8_C(133), UINT8_C(250), UINT8_C( 37), UINT8_C(231),
+      UINT8_C(173), UINT8_C( 94),    UINT8_MAX, UINT8_C(208), UINT8_C( 34), UINT8_C(114), UINT8_C( 61), UINT8_C(  0),
+      UINT8_C(148), UINT8_C(  8), UINT8_C( 89), UINT8_C( 98), UINT8_C(121), UINT8_C( 39), UINT8_C(154), UINT8_C( 48),
+      UINT8_C(218), UINT8_C(231), UINT8_C(159), UINT8_C(173), UINT8_C(242), UINT8_C(211), UINT8_C(235), UINT8_C(232),
+      UINT8_C(252), UINT8_C( 45), UINT8_C(224), UINT8_C(129), UINT8_C( 40), UINT8_C(  6), UINT8_C(105), UINT8_C(213),
+      UINT8_C(100), UINT8_C(104), UINT8_C(165), UINT8_C(134), UINT8_C(218), UINT8_C(227), UINT8_C(134), UINT8_C(111),
+      UINT8_C(235), UINT8_C(224), UINT8_C(209), UINT8_C(100), UINT8_C(  7), UINT8_C(107), UINT8_C(148), UINT8_C(226),
+      UINT8_C( 82), UINT8_C( 51), UINT8_C(143), UINT8_C( 68), UINT8_C(  6), UINT8_C(123), UINT8_C( 44), UINT8_C(  3),
+      UINT8_C(168), UINT8_C( 13), UINT8_C(132), UINT8_C(208), UINT8_C( 19), UINT8_C(237), UINT8_C(166), UINT8_C(119),
+      UINT8_C( 85), UINT8_C( 75), UINT8_C(254), UINT8_C( 48), UINT8_C( 46), UINT8_C(132), UINT8_C(159), UINT8_C( 25),
+      UINT8_C(100), UINT8_C(112), UINT8_C(125), UINT8_C(108), UINT8_C(219), UINT8_C( 18), UINT8_C( 78), UINT8_C( 45),
+      UINT8_C( 69), UINT8_C(221) };
+  static const uint8_t e[] =
+    { UINT8_C(144), UINT8_C( 51), UINT8_C(206), UINT8_C(246), UINT8_C(248), UINT8_C(194), UINT8_C(239), UINT8_C(219),
+      UINT8_C(253), UINT8_C(231), UINT8_C(223), UINT8_C(228), UINT8_C(231), UINT8_C( 38), UINT8_C( 83), UINT8_C(233),
+      UINT8_C(104), UINT8_C(207), UINT8_C( 53), UINT8_C(191), UINT8_C(196), UINT8_C(120), UINT8_C(235), UINT8_C(235),
+      UINT8_C(182), UINT8_C(216), UINT8_C(247), UINT8_C(179), UINT8_C(220), UINT8_C( 70), UINT8_C(209), UINT8_C(171),
+      UINT8_C(121),    UINT8_MAX, UINT8_C(151), UINT8_C(113), UINT8_C(156), UINT8_C(134), UINT8_C(194), UINT8_C(153),
+      UINT8_C(109), UINT8_C( 44), UINT8_C(125), UINT8_C( 85), UINT8_C( 82), UINT8_C(208), UINT8_C(244), UINT8_C(186),
+      UINT8_C(160), UINT8_C(241), UINT8_C(122), UINT8_C(188), UINT8_C(162), UINT8_C(209), UINT8_C(219), UINT8_C(217),
+      UINT8_C(166), UINT8_C(163), UINT8_C(140), UINT8_C(130), UINT8_C(233), UINT8_C(180), UINT8_C(214), UINT8_C(227),
+      UINT8_C( 28), UINT8_C(109), UINT8_C(212), UINT8_C(184), UINT8_C(244), UINT8_C(103), UINT8_C(248), UINT8_C( 97),
+      UINT8_C( 77), UINT8_C(206), UINT8_C(182), UINT8_C(160), UINT8_C(159), UINT8_C(171), UINT8_C(221), UINT8_C( 63),
+      UINT8_C(213), UINT8_C(249), UINT8_C(251), UINT8_C(119),    UINT8_MAX, UINT8_C(214), UINT8_C( 81), UINT8_C(222),
+      UINT8_C(158), UINT8_C(221), UINT8_C(206), UINT8_C( 99), UINT8_C(250), UINT8_C(164), UINT8_C(198), UINT8_C( 22),
+      UINT8_C( 18), UINT8_C(154), UINT8_C(206), UINT8_C( 69), UINT8_C(188), UINT8_C(242), UINT8_C(103), UINT8_C(155),
+      UINT8_C(237), UINT8_C( 30), UINT8_C(169), UINT8_C(140), UINT8_C(201), UINT8_C(148), UINT8_C(231), UINT8_C(223),
+      UINT8_C(216), UINT8_C(198), UINT8_C( 21), UINT8_C(141), UINT8_C(157), UINT8_C(102), UINT8_C(202), UINT8_C(208),
+      UINT8_C( 68), UINT8_C(153), UINT8_C(121), UINT8_C(118), UINT8_C( 61), UINT8_C(190), UINT8_C(186), UINT8_C(130),
+      UINT8_C(218), UINT8_C(180), UINT8_C(200), UINT8_C(150), UINT8_C( 65), UINT8_C(189), UINT8_C(220), UINT8_C( 46),
+      UINT8_C(219), UINT8_C(147), UINT8_C(200), UINT8_C(164), UINT8_C( 77), UINT8_C(134), UINT8_C( 66), UINT8_C(181),
+      UINT8_C(230), UINT8_C( 87), UINT8_C(164), UINT8_C(234), UINT8_C(202), UINT8_C(174), UINT8_C(  0), UINT8_C(  2),
+      UINT8_C(  7), UINT8_C(122), UINT8_C(198), UINT8_C(177), UINT8_C(185), UINT8_C(148), UINT8_C(148), UINT8_C(147),
+      UINT8_C(182), UINT8_C(234), UINT8_C( 41), UINT8_C(247), UINT8_C(167), UINT8_C(230), UINT8_C( 74), UINT8_C(130),
+      UINT8_C(121), UINT8_C(224), UINT8_C(134), UINT8_C( 95), UINT8_C(103), UINT8_C(104), UINT8_C(132), UINT8_C(180),
+      UINT8_C(191), UINT8_C( 40), UINT8_C(191), UINT8_C(125), UINT8_C(151), UINT8_C(166), UINT8_C(178), UINT8_C(158),
+      UINT8_C(227), UINT8_C(191), UINT8_C(234), UINT8_C(223), UINT8_C(248), UINT8_C(120), UINT8_C(167), UINT8_C(  9),
+      UINT8_C( 98), UINT8_C(143), UINT8_C(  9), UINT8_C(156), UINT8_C(150), UINT8_C( 83), UINT8_C(139), UINT8_C(106),
+      UINT8_C(  6), UINT8_C(248), UINT8_C(201), UINT8_C(109), UINT8_C( 25), UINT8_C( 77), UINT8_C(206), UINT8_C(216),
+      UINT8_C(162), UINT8_C(191), UINT8_C( 86), UINT8_C( 13), UINT8_C( 94), UINT8_C(213), UINT8_C(171), UINT8_C(118),
+      UINT8_C(149), UINT8_C(143), UINT8_C(246), UINT8_C(232), UINT8_C( 43), UINT8_C(174), UINT8_C(242), UINT8_C(105),
+      UINT8_C( 77), UINT8_C(242), UINT8_C(226), UINT8_C(228), UINT8_C(180), UINT8_C(253),    UINT8_MAX, UINT8_C( 31),
+      UINT8_C(174), UINT8_C(200), UINT8_C(140), UINT8_C(199), UINT8_C(174), UINT8_C(174), UINT8_C(159), UINT8_C(139),
+      UINT8_C(155), UINT8_C(245), UINT8_C(152), UINT8_C(206), UINT8_C(203), UINT8_C( 68), UINT8_C(229), UINT8_C(248),
+      UINT8_C(211), UINT8_C(219), UINT8_C( 72), UINT8_C(218), UINT8_C( 56), UINT8_C( 58), UINT8_C(218), UINT8_C(117),
+      UINT8_C( 45), UINT8_C(189), UINT8_C(170), UINT8_C( 69), UINT8_C(178), UINT8_C(  9), UINT8_C(100), UINT8_C( 96),
+      UINT8_C(209), UINT8_C(241), UINT8_C( 39), UINT8_C(241), UINT8_C(159), UINT8_C(198), UINT8_C(114), UINT8_C(148),
+      UINT8_C(188), UINT8_C( 11), UINT8_C(216), UINT8_C(141), UINT8_C(215), UINT8_C( 72), UINT8_C(231), UINT8_C( 64),
+      UINT8_C(164), UINT8_C(168), UINT8_C(252), UINT8_C(221), UINT8_C(106), UINT8_C(175), UINT8_C( 98), UINT8_C(151),
+      UINT8_C(244), UINT8_C( 93), UINT8_C(220), UINT8_C(166), UINT8_C(102), UINT8_C( 65), UINT8_C(  6), UINT8_C( 56),
+      UINT8_C( 50), UINT8_C(150), UINT8_C( 31), UINT8_C(209), UINT8_C(243), UINT8_C(145), UINT8_C(221), UINT8_C(175),
+      UINT8_C(156), UINT8_C(181), UINT8_C(169), UINT8_C(235), UINT8_C(207), UINT8_C( 29), UINT8_C(178), UINT8_C(116),
+      UINT8_C(215), UINT8_C(  9), UINT8_C( 81), UINT8_C(183), UINT8_C( 72), UINT8_C(163), UINT8_C(252), UINT8_C( 60),
+      UINT8_C(  0), UINT8_C( 42), UINT8_C(226), UINT8_C(103), UINT8_C(107), UINT8_C(232), UINT8_C(159), UINT8_C(244),
+      UINT8_C(146), UINT8_C(190), UINT8_C(110), UINT8_C(  9), UINT8_C( 79), UINT8_C(203), UINT8_C(184), UINT8_C(236),
+      UINT8_C(  1), UINT8_C(239), UINT8_C(215), UINT8_C(209), UINT8_C( 12), UINT8_C(229), UINT8_C( 69), UINT8_C( 89),
+      UINT8_C(238), UINT8_C(230), UINT8_C( 16), UINT8_C( 55), UINT8_C( 57), UINT8_C(166), UINT8_C(115), UINT8_C(245),
+      UINT8_C(137), UINT8_C( 86), UINT8_C(161), UINT8_C(244), UINT8_C( 62), UINT8_C( 82), UINT8_C(146), UINT8_C( 84),
+      UINT8_C(254), UINT8_C( 11), UINT8_C( 93), UINT8_C(122), UINT8_C(215), UINT8_C(215), UINT8_C( 58), UINT8_C(186),
+      UINT8_C(129), UINT8_C( 17), UINT8_C(254), UINT8_C( 17), UINT8_C(246), UINT8_C(197), UINT8_C(106), UINT8_C(228),
+      UINT8_C(250), UINT8_C(123), UINT8_C( 27), UINT8_C( 51), UINT8_C(217), UINT8_C(143), UINT8_C(109), UINT8_C(143),
+      UINT8_C(229), UINT8_C( 14), UINT8_C( 87), UINT8_C( 35), UINT8_C(136), UINT8_C(233), UINT8_C(119), UINT8_C( 76),
+      UINT8_C(233), UINT8_C(212), UINT8_C(154), UINT8_C(104), UINT8_C(234), UINT8_C(211), UINT8_C(132), UINT8_C(238),
+      UINT8_C(228), UINT8_C(163),    UINT8_MAX, UINT8_C(218), UINT8_C(  7), UINT8_C(106), UINT8_C(191), UINT8_C(145),
+      UINT8_C(229), UINT8_C(218), UINT8_C( 52), UINT8_C(249), UINT8_C(105), UINT8_C(162), UINT8_C( 33), UINT8_C( 78),
+      UINT8_C(176), UINT8_C(120), UINT8_C(114),    UINT8_MAX, UINT8_C(159), UINT8_C(233), UINT8_C( 75), UINT8_C( 74),
+      UINT8_C(190), UINT8_C(229), UINT8_C(153), UINT8_C(168), UINT8_C(185), UINT8_C(  4), UINT8_C(150), UINT8_C(157),
+      UINT8_C(167), UINT8_C(150), UINT8_C(120), UINT8_C(195), UINT8_C( 95), UINT8_C( 55), UINT8_C(175), UINT8_C(229),
+      UINT8_C( 17), UINT8_C(249), UINT8_C(163), UINT8_C(123), UINT8_C(167), UINT8_C(196), UINT8_C(201), UINT8_C(139),
+      UINT8_C( 60), UINT8_C(185), UINT8_C( 53), UINT8_C(157), UINT8_C(146), UINT8_C(129), UINT8_C(232), UINT8_C(227),
+      UINT8_C(228), UINT8_C(104), UINT8_C(139), UINT8_C( 31), UINT8_C(189), UINT8_C( 33), UINT8_C(189), UINT8_C( 20),
+      UINT8_C(183), UINT8_C(214), UINT8_C(195), UINT8_C(183), UINT8_C(110), UINT8_C(114), UINT8_C(156), UINT8_C(125),
+      UINT8_C(171), UINT8_C( 64), UINT8_C(248), UINT8_C(220), UINT8_C(132), UINT8_C(194), UINT8_C(222), UINT8_C( 65),
+      UINT8_C(253), UINT8_C(213), UINT8_C(222), UINT8_C( 34), UINT8_C(201), UINT8_C(198), UINT8_C(173), UINT8_C(251),
+      UINT8_C( 47), UINT8_C(144), UINT8_C( 79), UINT8_C(156), UINT8_C(178), UINT8_C( 99), UINT8_C(176), UINT8_C(105),
+      UINT8_C( 65), UINT8_C(115), UINT8_C( 33), UINT8_C(173), UINT8_C(230), UINT8_C(189), UINT8_C( 43), UINT8_C(205),
+      UINT8_C(253), UINT8_C( 35), UINT8_C( 25), UINT8_C(  2), UINT8_C(229), UINT8_C( 44), UINT8_C( 67), UINT8_C(227),
+      UINT8_C(211), UINT8_C( 33), UINT8_C( 11), UINT8_C(234), UINT8_C(232), UINT8_C( 11), UINT8_C(110), UINT8_C( 23),
+      UINT8_C(155), UINT8_C(250), UINT8_C(179), UINT8_C( 77), UINT8_C(202), UINT8_C( 99), UINT8_C(220), UINT8_C( 11),
+      UINT8_C(215), UINT8_C(216), UINT8_C(185), UINT8_C(240), UINT8_C(149), UINT8_C(228), UINT8_C(249), UINT8_C(232),
+      UINT8_C( 11), UINT8_C(221), UINT8_C(205), UINT8_C(237), UINT8_C(219), UINT8_C(216), UINT8_C(208), UINT8_C(179),
+      UINT8_C(249), UINT8_C(213), UINT8_C(241), UINT8_C(225), UINT8_C(224), UINT8_C(127), UINT8_C(248), UINT8_C(124),
+      UINT8_C( 28), UINT8_C(171), UINT8_C(201), UINT8_C(230), UINT8_C(169), UINT8_C(128), UINT8_C(242), UINT8_C(230),
+      UINT8_C(237), UINT8_C(173), UINT8_C(163), UINT8_C(238), UINT8_C(143), UINT8_C(156), UINT8_C(129), UINT8_C(150),
+      UINT8_C(175), UINT8_C( 22), UINT8_C(152), UINT8_C(237), UINT8_C(238), UINT8_C( 83), UINT8_C(160), UINT8_C(231),
+      UINT8_C(150), UINT8_C(145), UINT8_C(201), UINT8_C(  9), UINT8_C(240), UINT8_C(193), UINT8_C(133), UINT8_C( 13),
+      UINT8_C(166), UINT8_C( 79), UINT8_C(243), UINT8_C(124), UINT8_C(207), UINT8_C(229), UINT8_C(198), UINT8_C( 40),
+      UINT8_C(144), UINT8_C(  5), UINT8_C( 22), UINT8_C( 31), UINT8_C(161), UINT8_C(151), UINT8_C(182), UINT8_C( 84),
+      UINT8_C(173), UINT8_C(200), UINT8_C( 62), UINT8_C(155), UINT8_C(218), UINT8_C(222), UINT8_C(201), UINT8_C(182),
+      UINT8_C(112), UINT8_C( 75), UINT8_C(191), UINT8_C( 96), UINT8_C(119), UINT8_C( 96), UINT8_C(109), UINT8_C(122),
+      UINT8_C(148), UINT8_C( 97), UINT8_C(246), UINT8_C( 99), UINT8_C(254), UINT8_C( 88), UINT8_C(139), UINT8_C(215),
+      UINT8_C( 93), UINT8_C(161), UINT8_C(246), UINT8_C(254), UINT8_C(139), UINT8_C(172), UINT8_C( 79), UINT8_C(229),
+      UINT8_C(230), UINT8_C(141), UINT8_C(231), UINT8_C(251), UINT8_C(107), UINT8_C(  3), UINT8_C( 41), UINT8_C(219),
+      UINT8_C(207), UINT8_C(232), UINT8_C( 99), UINT8_C( 91), UINT8_C( 45), UINT8_C(169), UINT8_C(213), UINT8_C(193),
+      UINT8_C(165), UINT8_C(203), UINT8_C( 37), UINT8_C( 81), UINT8_C( 35), UINT8_C(176), UINT8_C( 40), UINT8_C(128),
+      UINT8_C( 82), UINT8_C(218), UINT8_C(127), UINT8_C(138), UINT8_C(203), UINT8_C(206), UINT8_C(112), UINT8_C(177),
+      UINT8_C( 91), UINT8_C(240), UINT8_C( 36), UINT8_C(198), UINT8_C(243), UINT8_C(187), UINT8_C(162), UINT8_C(173),
+      UINT8_C( 53), UINT8_C(222), UINT8_C(243), UINT8_C( 99), UINT8_C(135), UINT8_C(115), UINT8_C(234), UINT8_C(146),
+      UINT8_C( 62), UINT8_C( 73), UINT8_C(227), UINT8_C( 98), UINT8_C(254), UINT8_C( 11), UINT8_C(226), UINT8_C( 76),
+      UINT8_C( 41), UINT8_C( 97), UINT8_C(214), UINT8_C(244), UINT8_C(189), UINT8_C( 70), UINT8_C(237), UINT8_C(138),
+      UINT8_C(249), UINT8_C(201), UINT8_C( 81), UINT8_C( 42), UINT8_C(248), UINT8_C(243), UINT8_C(133), UINT8_C( 76),
+      UINT8_C(209), UINT8_C( 10), UINT8_C(175), UINT8_C(151), UINT8_C(207), UINT8_C(211), UINT8_C(234), UINT8_C(245),
+      UINT8_C( 29), UINT8_C(205), UINT8_C( 29), UINT8_C( 23), UINT8_C(216), UINT8_C(169), UINT8_C(198), UINT8_C(  2),
+      UINT8_C( 97), UINT8_C( 57), UINT8_C(246), UINT8_C(145), UINT8_C(128), UINT8_C(156), UINT8_C( 27), UINT8_C(183),
+      UINT8_C(101), UINT8_C(108), UINT8_C(234), UINT8_C(124), UINT8_C(242), UINT8_C(111), UINT8_C(200), UINT8_C( 48),
+      UINT8_C( 88), UINT8_C(145), UINT8_C(143), UINT8_C(213), UINT8_C( 86), UINT8_C(115), UINT8_C(173), UINT8_C(103),
+      UINT8_C( 65), UINT8_C(203), UINT8_C(236), UINT8_C( 25), UINT8_C(174), UINT8_C(225), UINT8_C( 27), UINT8_C( 15),
+      UINT8_C( 27), UINT8_C( 18), UINT8_C(160), UINT8_C(155), UINT8_C(174), UINT8_C(188), UINT8_C( 82), UINT8_C( 19),
+      UINT8_C( 40), UINT8_C( 51), UINT8_C(205), UINT8_C(136), UINT8_C(129), UINT8_C( 87), UINT8_C(184), UINT8_C(217),
+      UINT8_C(206), UINT8_C( 65), UINT8_C(174), UINT8_C(107), UINT8_C(181), UINT8_C(209), UINT8_C(128), UINT8_C(246),
+      UINT8_C(237),    UINT8_MAX, UINT8_C( 15), UINT8_C(155), UINT8_C(224), UINT8_C( 43), UINT8_C(209), UINT8_C(251),
+      UINT8_C( 61), UINT8_C(152), UINT8_C(150), UINT8_C(235), UINT8_C(  7), UINT8_C(235), UINT8_C(254), UINT8_C( 47),
+         UINT8_MAX, UINT8_C(142), UINT8_C(183), UINT8_C(157), UINT8_C(229), UINT8_C(112), UINT8_C(119), UINT8_C(180),
+      UINT8_C(177), UINT8_C( 37), UINT8_C(205), UINT8_C(102), UINT8_C(100), UINT8_C(174), UINT8_C( 92), UINT8_C( 81),
+      UINT8_C( 76), UINT8_C(108), UINT8_C(236), UINT8_C( 45), UINT8_C(151), UINT8_C(151), UINT8_C( 40), UINT8_C(212),
+      UINT8_C(226), UINT8_C(191), UINT8_C(191), UINT8_C(233), UINT8_C(167), UINT8_C(189), UINT8_C( 59), UINT8_C(195),
+      UINT8_C( 75), UINT8_C(208), UINT8_C( 97), UINT8_C( 49), UINT8_C(153), UINT8_C(216), UINT8_C(229), UINT8_C(241),
+      UINT8_C(253), UINT8_C(178), UINT8_C(250), UINT8_C( 98),    UINT8_MAX, UINT8_C(180), UINT8_C(179), UINT8_C( 92),
+      UINT8_C( 75), UINT8_C(160), UINT8_C(174), UINT8_C(183), UINT8_C(123), UINT8_C(161), UINT8_C(166), UINT8_C( 25),
+      UINT8_C(106), UINT8_C( 74), UINT8_C(  2), UINT8_C(  8), UINT8_C(  8), UINT8_C( 26), UINT8_C(203), UINT8_C(197),
+      UINT8_C(234), UINT8_C( 44), UINT8_C(245), UINT8_C( 42), UINT8_C(  4), UINT8_C(105), UINT8_C( 28), UINT8_C( 45),
+      UINT8_C( 98), UINT8_C(116), UINT8_C(100), UINT8_C( 27), UINT8_C( 40), UINT8_C(195), UINT8_C(103), UINT8_C( 73),
+      UINT8_C(222), UINT8_C(224), UINT8_C(202), UINT8_C(238), UINT8_C(129), UINT8_C(140), UINT8_C(206), UINT8_C(226),
+      UINT8_C(214), UINT8_C(  9), UINT8_C(234), UINT8_C(222), UINT8_C(211), UINT8_C(181), UINT8_C( 52), UINT8_C( 62),
+      UINT8_C(245), UINT8_C(182), UINT8_C( 57), UINT8_C(248), UINT8_C(133), UINT8_C( 85), UINT8_C(232), UINT8_C(231),
+      UINT8_C(201), UINT8_C( 94), UINT8_C( 86), UINT8_C(241), UINT8_C(100), UINT8_C(189), UINT8_C( 58), UINT8_C( 27),
+      UINT8_C(157), UINT8_C( 59), UINT8_C( 10), UINT8_C( 98), UINT8_C(199), UINT8_C( 39), UINT8_C(154), UINT8_C(157),
+      UINT8_C( 27), UINT8_C(235), UINT8_C(159), UINT8_C(173), UINT8_C(242), UINT8_C(211), UINT8_C( 77), UINT8_C(130),
+      UINT8_C(100), UINT8_C(134), UINT8_C(105), UINT8_C(132), UINT8_C(219), UINT8_C( 81), UINT8_C(192), UINT8_C(164),
+      UINT8_C(158), UINT8_C( 22), UINT8_C(150), UINT8_C(  2), UINT8_C(218), UINT8_C(227), UINT8_C( 29), UINT8_C(113),
+      UINT8_C( 11), UINT8_C(224), UINT8_C(144), UINT8_C(210), UINT8_C( 57), UINT8_C(145), UINT8_C(112), UINT8_C(226),
+      UINT8_C(124), UINT8_C(236), UINT8_C(147), UINT8_C( 68), UINT8_C(154), UINT8_C(224), UINT8_C(159), UINT8_C(254),
+      UINT8_C(168), UINT8_C(  8), UINT8_C(132), UINT8_C(208), UINT8_C( 90), UINT8_C(237), UINT8_C(231), UINT8_C(248),
+      UINT8_C( 89), UINT8_C(125), UINT8_C(254), UINT8_C( 48), UINT8_C( 77), UINT8_C( 23), UINT8_C(159), UINT8_C( 89),
+      UINT8_C(100), UINT8_C( 47), UINT8_C( 43), UINT8_C(120), UINT8_C(193), UINT8_C(155), UINT8_C(204), UINT8_C( 61),
+      UINT8_C(135), UINT8_C(221) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_u8_m(pv, av, bv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+
+    ev = simde_svmax_u8_m(pv, av, bv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(17531), UINT16_C(59595), UINT16_C(54996), UINT16_C( 6550), UINT16_C(65125), UINT16_C(28083), UINT16_C(28651), UINT16_C(25284),
+      UINT16_C(32800), UINT16_C(13499), UINT16_C( 3304), UINT16_C(55875), UINT16_C(20162), UINT16_C(28103), UINT16_C( 1250), UINT16_C(24315),
+      UINT16_C(50760), UINT16_C( 7238), UINT16_C(56476), UINT16_C(  309), UINT16_C(59610), UINT16_C(50542), UINT16_C(12887), UINT16_C(30760),
+      UINT16_C(58291), UINT16_C(39852), UINT16_C(61679), UINT16_C(45430), UINT16_C(15678), UINT16_C( 8478), UINT16_C( 6465), UINT16_C(35199),
+      UINT16_C(50655), UINT16_C(31653), UINT16_C(55970), UINT16_C(31869), UINT16_C(60355), UINT16_C( 6722), UINT16_C(27166), UINT16_C(53650),
+      UINT16_C(16205), UINT16_C(15468), UINT16_C(57903), UINT16_C(28141), UINT16_C( 2847), UINT16_C(24718), UINT16_C( 3365), UINT16_C( 1257),
+      UINT16_C(36563), UINT16_C(30080), UINT16_C(64873), UINT16_C(11505), UINT16_C(13288), UINT16_C( 1606), UINT16_C(55709), UINT16_C(60119),
+      UINT16_C(17432), UINT16_C(18214), UINT16_C( 4902), UINT16_C(18100), UINT16_C(17183), UINT16_C(17574), UINT16_C(36944), UINT16_C( 9032),
+      UINT16_C(51230), UINT16_C(34712), UINT16_C(35525), UINT16_C(44723), UINT16_C(64189), UINT16_C(23476), UINT16_C(36051), UINT16_C(60229),
+      UINT16_C(27856), UINT16_C(63026), UINT16_C(59007), UINT16_C(40508), UINT16_C(58153), UINT16_C(31458), UINT16_C(11123), UINT16_C(37277),
+      UINT16_C(14067), UINT16_C(47385), UINT16_C(52416), UINT16_C(32103), UINT16_C( 7110), UINT16_C(39384), UINT16_C( 7847), UINT16_C(30596),
+      UINT16_C(46730), UINT16_C( 2414), UINT16_C(43677), UINT16_C(50856), UINT16_C(35469), UINT16_C(   64), UINT16_C(57013), UINT16_C(43410),
+      UINT16_C(43796), UINT16_C(54370), UINT16_C(51575), UINT16_C(15953), UINT16_C(10980), UINT16_C(36055), UINT16_C(23624), UINT16_C(53763),
+      UINT16_C(28946), UINT16_C(45019), UINT16_C(33564), UINT16_C(43382), UINT16_C(46606), UINT16_C(50090), UINT16_C(15508), UINT16_C(43116),
+      UINT16_C(52967), UINT16_C(24188), UINT16_C(52887), UINT16_C(31900), UINT16_C(29944), UINT16_C(16392), UINT16_C( 3024), UINT16_C(57874),
+      UINT16_C(60797), UINT16_C(39314), UINT16_C( 2161), UINT16_C(32578), UINT16_C(60606), UINT16_C(21314), UINT16_C(44840), UINT16_C( 4091),
+      UINT16_C(30845), UINT16_C( 5486), UINT16_C( 2630), UINT16_C(16017), UINT16_C(39294), UINT16_C(20094), UINT16_C(37028), UINT16_C( 8497),
+      UINT16_C(50045), UINT16_C(61114), UINT16_C(64971), UINT16_C(35181), UINT16_C(45289), UINT16_C( 4828), UINT16_C(55391), UINT16_C(56353),
+      UINT16_C(36688), UINT16_C(38641), UINT16_C(33434), UINT16_C( 6356), UINT16_C(21019), UINT16_C(49255), UINT16_C(39138), UINT16_C(24545),
+      UINT16_C(40027), UINT16_C( 9806), UINT16_C(48025), UINT16_C(33455), UINT16_C(35947), UINT16_C(51860), UINT16_C(46692), UINT16_C(46247),
+      UINT16_C(38981), UINT16_C(57162), UINT16_C( 7707), UINT16_C(14072), UINT16_C(24432), UINT16_C(21238), UINT16_C(55543), UINT16_C(21169),
+      UINT16_C(65396), UINT16_C( 3448), UINT16_C(10171), UINT16_C( 9871), UINT16_C( 9395), UINT16_C( 6129), UINT16_C(39130), UINT16_C( 8139),
+      UINT16_C( 5424), UINT16_C(19455), UINT16_C(63283), UINT16_C(41858), UINT16_C(30806), UINT16_C(19957), UINT16_C(42832), UINT16_C(50335),
+      UINT16_C( 6054), UINT16_C(25041), UINT16_C(24894), UINT16_C(62088), UINT16_C(31109), UINT16_C(24329), UINT16_C(54545), UINT16_C(16766),
+      UINT16_C(32234), UINT16_C( 7821), UINT16_C( 3956), UINT16_C(51905), UINT16_C(46983), UINT16_C(55319), UINT16_C(46686), UINT16_C( 1180),
+      UINT16_C(28365), UINT16_C( 3174), UINT16_C(61135), UINT16_C(21758), UINT16_C( 1895), UINT16_C(30899), UINT16_C(12764), UINT16_C(51129),
+      UINT16_C(18095), UINT16_C( 9189), UINT16_C(42581), UINT16_C(56814), UINT16_C( 1373), UINT16_C(48053), UINT16_C(20924), UINT16_C(35264),
+      UINT16_C( 9919), UINT16_C(36501), UINT16_C(37652), UINT16_C(31714), UINT16_C(38299), UINT16_C(30707), UINT16_C(44231), UINT16_C(30270),
+      UINT16_C( 9203), UINT16_C(18585), UINT16_C(34762), UINT16_C(10021), UINT16_C(55949), UINT16_C(18915), UINT16_C(41772), UINT16_C(60370),
+      UINT16_C(26825), UINT16_C(56698), UINT16_C(23803), UINT16_C(38488), UINT16_C(19442), UINT16_C(47374), UINT16_C(19703), UINT16_C(59951),
+      UINT16_C(51312), UINT16_C(14899), UINT16_C(22608), UINT16_C(56673), UINT16_C(17459), UINT16_C(24358), UINT16_C(63719), UINT16_C(45130),
+      UINT16_C(50272), UINT16_C(23693), UINT16_C(58657), UINT16_C( 5106), UINT16_C(   48), UINT16_C(10444), UINT16_C(64333), UINT16_C(48402),
+      UINT16_C(17859), UINT16_C( 5111), UINT16_C(22686), UINT16_C(53744), UINT16_C( 5789), UINT16_C(33840), UINT16_C(31247), UINT16_C(28469),
+      UINT16_C(49727), UINT16_C(24779), UINT16_C(48808), UINT16_C(55411), UINT16_C(16318), UINT16_C( 2816), UINT16_C( 4922), UINT16_C(64968),
+      UINT16_C(48984), UINT16_C(62993), UINT16_C(  280), UINT16_C(46535), UINT16_C(63256), UINT16_C(10041), UINT16_C(28274), UINT16_C(45462),
+      UINT16_C(25137), UINT16_C(55569), UINT16_C(33824), UINT16_C(57009), UINT16_C(45763), UINT16_C(65002), UINT16_C(45765), UINT16_C( 7674),
+      UINT16_C( 2930), UINT16_C(35348), UINT16_C(56077), UINT16_C( 9535), UINT16_C(30931), UINT16_C(17740), UINT16_C(58087), UINT16_C( 6390),
+      UINT16_C( 1860), UINT16_C(25841), UINT16_C(41611), UINT16_C(20035), UINT16_C(11604), UINT16_C( 6475), UINT16_C(17887), UINT16_C(20791),
+      UINT16_C(19281), UINT16_C(24283), UINT16_C( 6694), UINT16_C(63875), UINT16_C(53139), UINT16_C(31294), UINT16_C(13489), UINT16_C(63122),
+      UINT16_C(33595), UINT16_C(50778), UINT16_C(40229), UINT16_C(31252), UINT16_C(24522), UINT16_C(43667), UINT16_C(51877) };
+  static const uint16_t b[] =
+    { UINT16_C(39226), UINT16_C(32870), UINT16_C(26253), UINT16_C( 5717), UINT16_C(63919), UINT16_C(31386), UINT16_C(54916), UINT16_C(25963),
+      UINT16_C(64170), UINT16_C(23986), UINT16_C( 6360), UINT16_C(22680), UINT16_C(35368), UINT16_C(52456), UINT16_C(49620), UINT16_C( 3640),
+      UINT16_C(40538), UINT16_C(59535), UINT16_C(58372), UINT16_C(46078), UINT16_C(39390), UINT16_C(25133), UINT16_C(39279), UINT16_C( 6599),
+      UINT16_C(31123), UINT16_C(27510), UINT16_C( 3729), UINT16_C(47555), UINT16_C(44185), UINT16_C(28037), UINT16_C(48493), UINT16_C(51323),
+      UINT16_C( 2652), UINT16_C(24752), UINT16_C(44783), UINT16_C(52500), UINT16_C(16711), UINT16_C(46639), UINT16_C(63450), UINT16_C(28368),
+      UINT16_C(18032), UINT16_C(  729), UINT16_C(40277), UINT16_C(61115), UINT16_C(16713), UINT16_C(46683), UINT16_C(55038), UINT16_C(23166),
+      UINT16_C(12001), UINT16_C(53435), UINT16_C(53213), UINT16_C( 9373), UINT16_C(52240), UINT16_C(60379), UINT16_C(43971), UINT16_C(13401),
+      UINT16_C(13041), UINT16_C(17974), UINT16_C(61903), UINT16_C( 6196), UINT16_C(36658), UINT16_C(12751), UINT16_C(19814), UINT16_C(18315),
+      UINT16_C(18044), UINT16_C(22807), UINT16_C(46101), UINT16_C( 9853), UINT16_C(22656), UINT16_C(17425), UINT16_C(27139), UINT16_C(62840),
+      UINT16_C(44700), UINT16_C(27707), UINT16_C(28831), UINT16_C(53892), UINT16_C(21503), UINT16_C(25859), UINT16_C(36513), UINT16_C( 7596),
+      UINT16_C(50133), UINT16_C(60022), UINT16_C(62327), UINT16_C(63504), UINT16_C( 8524), UINT16_C(20284), UINT16_C(46219), UINT16_C(10308),
+      UINT16_C(32866), UINT16_C(  404), UINT16_C( 6384), UINT16_C(61395), UINT16_C(54892), UINT16_C( 3413), UINT16_C(  357), UINT16_C(14890),
+      UINT16_C(41157), UINT16_C(15396), UINT16_C(13715), UINT16_C(57140), UINT16_C(28758), UINT16_C(57903), UINT16_C(29476), UINT16_C(34314),
+      UINT16_C(40691), UINT16_C(58248), UINT16_C(23478), UINT16_C( 8915), UINT16_C(10290), UINT16_C(38703), UINT16_C(22825), UINT16_C(61137),
+      UINT16_C(62969), UINT16_C(36139), UINT16_C(24362), UINT16_C(33132), UINT16_C(39888), UINT16_C(62563), UINT16_C(27919), UINT16_C(  635),
+      UINT16_C(  779), UINT16_C(49638), UINT16_C(47454), UINT16_C(37092), UINT16_C( 5089), UINT16_C( 2599), UINT16_C(63597), UINT16_C(26361),
+      UINT16_C( 9454), UINT16_C( 6387), UINT16_C(24707), UINT16_C(21401), UINT16_C(64763), UINT16_C( 2632), UINT16_C(50025), UINT16_C(29709),
+      UINT16_C(62406), UINT16_C( 9270), UINT16_C( 6828), UINT16_C(36277), UINT16_C(56365), UINT16_C(39575), UINT16_C(37077), UINT16_C(49921),
+      UINT16_C(62644), UINT16_C(14555), UINT16_C(30036), UINT16_C(20619), UINT16_C(54129), UINT16_C(56154), UINT16_C(26518), UINT16_C(23631),
+      UINT16_C(34138), UINT16_C( 1665), UINT16_C(13983), UINT16_C(52627), UINT16_C(11026), UINT16_C(59239), UINT16_C(26811), UINT16_C(28842),
+      UINT16_C(34397), UINT16_C(45480), UINT16_C(13307), UINT16_C(27649), UINT16_C(23559), UINT16_C(40263), UINT16_C(38851), UINT16_C( 7930),
+      UINT16_C(31516), UINT16_C(48164), UINT16_C(47281), UINT16_C(50057), UINT16_C(61667), UINT16_C(40619), UINT16_C(21849), UINT16_C(46606),
+      UINT16_C(46811), UINT16_C(54887), UINT16_C(27114), UINT16_C(61763), UINT16_C(35525), UINT16_C(34958), UINT16_C(34849), UINT16_C(16038),
+      UINT16_C(51971), UINT16_C(46330), UINT16_C(33667), UINT16_C(26232), UINT16_C( 9075), UINT16_C(52228), UINT16_C( 4984), UINT16_C(21634),
+      UINT16_C(60105), UINT16_C(45866), UINT16_C(27987), UINT16_C( 6308), UINT16_C(13304), UINT16_C( 6560), UINT16_C(18363), UINT16_C(48983),
+      UINT16_C(20754), UINT16_C(38259), UINT16_C(60372), UINT16_C(18683), UINT16_C(65294), UINT16_C(34580), UINT16_C(38674), UINT16_C(56539),
+      UINT16_C( 1409), UINT16_C(54415), UINT16_C(13427), UINT16_C(27628), UINT16_C(35943), UINT16_C( 8836), UINT16_C(56531), UINT16_C(58849),
+      UINT16_C(21805), UINT16_C(  634), UINT16_C(30016), UINT16_C(20298), UINT16_C(24181), UINT16_C(34774), UINT16_C(45557), UINT16_C(30307),
+      UINT16_C(62390), UINT16_C(10570), UINT16_C(13863), UINT16_C(36500), UINT16_C( 6595), UINT16_C(38576), UINT16_C(37621), UINT16_C( 8828),
+      UINT16_C(63207), UINT16_C(10020), UINT16_C(28268), UINT16_C(57718), UINT16_C(19661), UINT16_C(49768), UINT16_C(52477), UINT16_C(46137),
+      UINT16_C(33727), UINT16_C(59101), UINT16_C(29370), UINT16_C(32116), UINT16_C( 9355), UINT16_C(32787), UINT16_C(36790), UINT16_C(40354),
+      UINT16_C(51078), UINT16_C(62149), UINT16_C(15157), UINT16_C(  723), UINT16_C(15240), UINT16_C(34245), UINT16_C(65031), UINT16_C(50745),
+      UINT16_C( 6017), UINT16_C(15276), UINT16_C( 8329), UINT16_C( 5304), UINT16_C(52293), UINT16_C(64404), UINT16_C(13915), UINT16_C(57753),
+      UINT16_C(24317), UINT16_C(13267), UINT16_C(42649), UINT16_C( 8501), UINT16_C(64226), UINT16_C(59815), UINT16_C(57592), UINT16_C(31408),
+      UINT16_C(23799), UINT16_C(32949), UINT16_C(28285), UINT16_C(49812), UINT16_C(10298), UINT16_C(38333), UINT16_C(22111), UINT16_C(23671),
+      UINT16_C(19124), UINT16_C(20111), UINT16_C(50673), UINT16_C(54127), UINT16_C( 5823), UINT16_C(47292), UINT16_C(27895), UINT16_C(60978),
+      UINT16_C(59337), UINT16_C(18031), UINT16_C(  853), UINT16_C(36616), UINT16_C(50476), UINT16_C(35621), UINT16_C(39964), UINT16_C(53479),
+      UINT16_C(30694), UINT16_C(55070), UINT16_C(36412), UINT16_C(64426), UINT16_C(26532), UINT16_C(39859), UINT16_C(58835), UINT16_C(40074),
+      UINT16_C(63949), UINT16_C( 8930), UINT16_C(60156), UINT16_C(10418), UINT16_C(55216), UINT16_C(52403), UINT16_C(39795), UINT16_C(22940),
+      UINT16_C(47890), UINT16_C(20017), UINT16_C(56137), UINT16_C(60745), UINT16_C(64834), UINT16_C( 5769), UINT16_C( 5090) };
+  static const uint16_t e[] =
+    { UINT16_C(    0), UINT16_C(59595), UINT16_C(54996), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(52456), UINT16_C(49620), UINT16_C(    0),
+      UINT16_C(50760), UINT16_C(    0), UINT16_C(58372), UINT16_C(46078), UINT16_C(59610), UINT16_C(50542), UINT16_C(    0), UINT16_C(30760),
+      UINT16_C(58291), UINT16_C(    0), UINT16_C(61679), UINT16_C(47555), UINT16_C(44185), UINT16_C(28037), UINT16_C(48493), UINT16_C(51323),
+      UINT16_C(    0), UINT16_C(31653), UINT16_C(55970), UINT16_C(52500), UINT16_C(    0), UINT16_C(    0), UINT16_C(63450), UINT16_C(53650),
+      UINT16_C(18032), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(55038), UINT16_C(    0),
+      UINT16_C(36563), UINT16_C(    0), UINT16_C(64873), UINT16_C(11505), UINT16_C(    0), UINT16_C(60379), UINT16_C(55709), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(18214), UINT16_C(61903), UINT16_C(18100), UINT16_C(    0), UINT16_C(17574), UINT16_C(    0), UINT16_C(18315),
+      UINT16_C(    0), UINT16_C(34712), UINT16_C(    0), UINT16_C(    0), UINT16_C(64189), UINT16_C(23476), UINT16_C(36051), UINT16_C(62840),
+      UINT16_C(44700), UINT16_C(63026), UINT16_C(59007), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(36513), UINT16_C(37277),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(62327), UINT16_C(    0), UINT16_C(    0), UINT16_C(39384), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(46730), UINT16_C(    0), UINT16_C(43677), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(57013), UINT16_C(43410),
+      UINT16_C(43796), UINT16_C(54370), UINT16_C(51575), UINT16_C(57140), UINT16_C(28758), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(40691), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50090), UINT16_C(    0), UINT16_C(61137),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(62563), UINT16_C(    0), UINT16_C(57874),
+      UINT16_C(60797), UINT16_C(    0), UINT16_C(47454), UINT16_C(    0), UINT16_C(60606), UINT16_C(    0), UINT16_C(    0), UINT16_C(26361),
+      UINT16_C(30845), UINT16_C( 6387), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50025), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(61114), UINT16_C(    0), UINT16_C(36277), UINT16_C(56365), UINT16_C(39575), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(62644), UINT16_C(38641), UINT16_C(    0), UINT16_C(20619), UINT16_C(54129), UINT16_C(    0), UINT16_C(    0), UINT16_C(24545),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(48025), UINT16_C(    0), UINT16_C(35947), UINT16_C(    0), UINT16_C(46692), UINT16_C(46247),
+      UINT16_C(38981), UINT16_C(57162), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(55543), UINT16_C(21169),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(47281), UINT16_C(50057), UINT16_C(61667), UINT16_C(40619), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(46811), UINT16_C(54887), UINT16_C(    0), UINT16_C(61763), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50335),
+      UINT16_C(    0), UINT16_C(46330), UINT16_C(    0), UINT16_C(62088), UINT16_C(31109), UINT16_C(    0), UINT16_C(    0), UINT16_C(21634),
+      UINT16_C(60105), UINT16_C(45866), UINT16_C(    0), UINT16_C(51905), UINT16_C(46983), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(28365), UINT16_C(    0), UINT16_C(    0), UINT16_C(21758), UINT16_C(65294), UINT16_C(    0), UINT16_C(38674), UINT16_C(56539),
+      UINT16_C(    0), UINT16_C(54415), UINT16_C(    0), UINT16_C(    0), UINT16_C(35943), UINT16_C(48053), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(36501), UINT16_C(37652), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(18585), UINT16_C(34762), UINT16_C(36500), UINT16_C(    0), UINT16_C(38576), UINT16_C(41772), UINT16_C(    0),
+      UINT16_C(63207), UINT16_C(    0), UINT16_C(    0), UINT16_C(57718), UINT16_C(19661), UINT16_C(    0), UINT16_C(52477), UINT16_C(    0),
+      UINT16_C(51312), UINT16_C(59101), UINT16_C(29370), UINT16_C(    0), UINT16_C(17459), UINT16_C(    0), UINT16_C(    0), UINT16_C(45130),
+      UINT16_C(51078), UINT16_C(62149), UINT16_C(58657), UINT16_C(    0), UINT16_C(15240), UINT16_C(34245), UINT16_C(    0), UINT16_C(50745),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(22686), UINT16_C(53744), UINT16_C(52293), UINT16_C(64404), UINT16_C(31247), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(55411), UINT16_C(64226), UINT16_C(59815), UINT16_C(57592), UINT16_C(    0),
+      UINT16_C(48984), UINT16_C(    0), UINT16_C(28285), UINT16_C(    0), UINT16_C(63256), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(25137), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65002), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(59337), UINT16_C(    0), UINT16_C(    0), UINT16_C(36616), UINT16_C(50476), UINT16_C(35621), UINT16_C(58087), UINT16_C(53479),
+      UINT16_C(30694), UINT16_C(55070), UINT16_C(41611), UINT16_C(64426), UINT16_C(26532), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(63949), UINT16_C(    0), UINT16_C(    0), UINT16_C(63875), UINT16_C(55216), UINT16_C(52403), UINT16_C(    0), UINT16_C(63122),
+      UINT16_C(    0), UINT16_C(50778), UINT16_C(56137), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_u16_z(pv, av, bv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+
+    ev = simde_svmax_u16_z(pv, av, bv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(62817), UINT16_C(65103), UINT16_C(10446), UINT16_C( 7133), UINT16_C(41570), UINT16_C(32600), UINT16_C(39091), UINT16_C(44802),
+      UINT16_C(36789), UINT16_C(37798), UINT16_C(22264), UINT16_C(59850), UINT16_C( 3432), UINT16_C( 3492), UINT16_C(42924), UINT16_C( 3428),
+      UINT16_C(45980), UINT16_C(27403), UINT16_C(59611), UINT16_C(15750), UINT16_C(56971), UINT16_C(16060), UINT16_C(49015), UINT16_C(11501),
+      UINT16_C(37710), UINT16_C(18111), UINT16_C(35306), UINT16_C(21040), UINT16_C(54422), UINT16_C(17247), UINT16_C(50299), UINT16_C( 6224),
+      UINT16_C(23671), UINT16_C(21379), UINT16_C( 2372), UINT16_C(53136), UINT16_C(19943), UINT16_C(24077), UINT16_C(64268), UINT16_C(23178),
+      UINT16_C(18830), UINT16_C(30881), UINT16_C(53715), UINT16_C(27083), UINT16_C(10917), UINT16_C( 8364), UINT16_C(65006), UINT16_C(26168),
+      UINT16_C(47961), UINT16_C(40377), UINT16_C(18884), UINT16_C(44141), UINT16_C(31382), UINT16_C(41482), UINT16_C(38261), UINT16_C( 1277),
+      UINT16_C(40670), UINT16_C(45436), UINT16_C(18287), UINT16_C( 5147), UINT16_C(51058), UINT16_C(24628), UINT16_C(28100), UINT16_C( 7622),
+      UINT16_C(32552), UINT16_C(60859), UINT16_C(10441), UINT16_C(24473), UINT16_C(41890), UINT16_C( 6146), UINT16_C(65336), UINT16_C( 5916),
+      UINT16_C(39069), UINT16_C( 3272), UINT16_C(58336), UINT16_C(21024), UINT16_C(21675), UINT16_C(28594), UINT16_C(31169), UINT16_C(60045),
+      UINT16_C(18680), UINT16_C(49623), UINT16_C(28784), UINT16_C( 4641), UINT16_C( 8979), UINT16_C(19498), UINT16_C(17954), UINT16_C(48995),
+      UINT16_C(11231), UINT16_C(49099), UINT16_C(60175), UINT16_C(47633), UINT16_C(49983), UINT16_C(  297), UINT16_C(46652), UINT16_C(13803),
+      UINT16_C(49918), UINT16_C(28406), UINT16_C( 5938), UINT16_C(17793), UINT16_C(43834), UINT16_C(23697), UINT16_C(62706), UINT16_C(53531),
+      UINT16_C(58912), UINT16_C(12176), UINT16_C(41425), UINT16_C( 4585), UINT16_C( 4708), UINT16_C(41234), UINT16_C(64969), UINT16_C(51158),
+      UINT16_C(52415), UINT16_C(61750), UINT16_C(47076), UINT16_C( 7734), UINT16_C(51298), UINT16_C(21627), UINT16_C(38588), UINT16_C(56357),
+      UINT16_C(46461), UINT16_C(19979), UINT16_C(62550), UINT16_C(47967), UINT16_C(28935), UINT16_C(53340), UINT16_C(12910), UINT16_C(11671),
+      UINT16_C(52734), UINT16_C(57886), UINT16_C(21892), UINT16_C(59137), UINT16_C(31773), UINT16_C(55611), UINT16_C(24850), UINT16_C(36790),
+      UINT16_C(49430), UINT16_C(28126), UINT16_C(15798), UINT16_C(48424), UINT16_C(33967), UINT16_C( 7565), UINT16_C( 9398), UINT16_C(46155),
+      UINT16_C(27122), UINT16_C(30359), UINT16_C(39102), UINT16_C(56157), UINT16_C(39188), UINT16_C( 9909), UINT16_C(27642), UINT16_C( 4278),
+      UINT16_C(37932), UINT16_C(57981), UINT16_C(42449), UINT16_C(32927), UINT16_C(11305), UINT16_C(57246), UINT16_C(59729), UINT16_C(17300),
+      UINT16_C(11090), UINT16_C( 4537), UINT16_C( 6083), UINT16_C(55276), UINT16_C(41392), UINT16_C(43773), UINT16_C(45836), UINT16_C(14778),
+      UINT16_C(14407), UINT16_C( 6427), UINT16_C(48093), UINT16_C( 1945), UINT16_C(14311), UINT16_C(14566), UINT16_C(31264), UINT16_C(29563),
+      UINT16_C(13733), UINT16_C(26756), UINT16_C(28748), UINT16_C(64575), UINT16_C(15634), UINT16_C( 7846), UINT16_C(24816), UINT16_C(14423),
+      UINT16_C(29592), UINT16_C(30289), UINT16_C(59950), UINT16_C( 5501), UINT16_C(25378), UINT16_C(16974), UINT16_C(51678), UINT16_C(33717),
+      UINT16_C(14846), UINT16_C(19180), UINT16_C(11178), UINT16_C(48198), UINT16_C(60520), UINT16_C(23002), UINT16_C(12877), UINT16_C(58769),
+      UINT16_C(58021), UINT16_C(54107), UINT16_C(55500), UINT16_C(61160), UINT16_C(13884), UINT16_C( 6705), UINT16_C(58880), UINT16_C(65181),
+      UINT16_C(35104), UINT16_C(51785), UINT16_C(36789), UINT16_C( 7558), UINT16_C(24700), UINT16_C(51574), UINT16_C( 1938), UINT16_C(14254),
+      UINT16_C( 2793), UINT16_C(46602), UINT16_C(62434), UINT16_C( 7844), UINT16_C(54569), UINT16_C(10552), UINT16_C(54972), UINT16_C(56360),
+      UINT16_C(29023), UINT16_C( 5286), UINT16_C(11264), UINT16_C(31794), UINT16_C(43148), UINT16_C( 8005), UINT16_C(62640), UINT16_C(39254),
+      UINT16_C(25086), UINT16_C(57423), UINT16_C(62548), UINT16_C(32255), UINT16_C(14281), UINT16_C(34215), UINT16_C(53005), UINT16_C(28001),
+      UINT16_C( 1856), UINT16_C(16513), UINT16_C(45875), UINT16_C(49341), UINT16_C(  604), UINT16_C( 3295), UINT16_C(13814), UINT16_C(62629),
+      UINT16_C(62870), UINT16_C(60117), UINT16_C(54505), UINT16_C(45672), UINT16_C( 3851), UINT16_C( 6456), UINT16_C(39390), UINT16_C( 7814),
+      UINT16_C( 1953), UINT16_C(54366), UINT16_C( 7099), UINT16_C( 6036), UINT16_C(29470), UINT16_C( 5155), UINT16_C(51369), UINT16_C(16137),
+      UINT16_C(57021), UINT16_C(42538), UINT16_C(37554), UINT16_C(48473), UINT16_C(37281), UINT16_C(32726), UINT16_C(23594), UINT16_C(52125),
+      UINT16_C(64356), UINT16_C( 8096), UINT16_C(13335), UINT16_C(13622), UINT16_C(22952), UINT16_C(20809), UINT16_C(21025), UINT16_C(57232),
+      UINT16_C(47664), UINT16_C(57989), UINT16_C(56908), UINT16_C(60832), UINT16_C(30319), UINT16_C(39532), UINT16_C( 2515), UINT16_C(14181),
+      UINT16_C( 1285), UINT16_C( 7254), UINT16_C(35898), UINT16_C(57937), UINT16_C(39653), UINT16_C( 1587), UINT16_C(50157), UINT16_C( 7653),
+      UINT16_C(27518), UINT16_C(51712), UINT16_C(41033), UINT16_C(47544), UINT16_C( 9238), UINT16_C(59731), UINT16_C(47150), UINT16_C(13088),
+      UINT16_C(30398), UINT16_C(63567), UINT16_C(40962), UINT16_C(59354), UINT16_C( 3386), UINT16_C(10222), UINT16_C(54224), UINT16_C(20037),
+      UINT16_C(17726), UINT16_C(34841), UINT16_C(53733), UINT16_C(64321), UINT16_C(38133), UINT16_C( 9189), UINT16_C( 1356), UINT16_C( 2646),
+      UINT16_C(42364), UINT16_C(32258), UINT16_C(56389), UINT16_C(32870), UINT16_C(21737), UINT16_C(47783), UINT16_C(60455), UINT16_C(26120),
+      UINT16_C( 8497), UINT16_C( 5870), UINT16_C(12274), UINT16_C(59410), UINT16_C(63427), UINT16_C( 3851), UINT16_C(25340), UINT16_C(30746),
+      UINT16_C( 7175), UINT16_C(19959), UINT16_C(24057), UINT16_C(58061) };
+  static const uint16_t b[] =
+    { UINT16_C(58275), UINT16_C(19385), UINT16_C(14380), UINT16_C(47919), UINT16_C(49428), UINT16_C(54905), UINT16_C(31803), UINT16_C(17443),
+      UINT16_C(47844), UINT16_C(50214), UINT16_C(65025), UINT16_C( 5398), UINT16_C(19098), UINT16_C(44714), UINT16_C(64984), UINT16_C(31616),
+      UINT16_C(14816), UINT16_C( 3271), UINT16_C(63089), UINT16_C(34503), UINT16_C(16567), UINT16_C(62300), UINT16_C(32701), UINT16_C(41271),
+      UINT16_C(24121), UINT16_C(14949), UINT16_C(31580), UINT16_C(63055), UINT16_C(63941), UINT16_C(40356), UINT16_C( 9462), UINT16_C(55065),
+      UINT16_C(57437), UINT16_C(52963), UINT16_C(43990), UINT16_C(36436), UINT16_C(45291), UINT16_C(43137), UINT16_C(47152), UINT16_C(26953),
+      UINT16_C(44566), UINT16_C(29348), UINT16_C(62250), UINT16_C(61288), UINT16_C( 3309), UINT16_C(58253), UINT16_C(42544), UINT16_C(36282),
+      UINT16_C(40582), UINT16_C(23644), UINT16_C(45129), UINT16_C(13546), UINT16_C(27489), UINT16_C(37341), UINT16_C( 9764), UINT16_C(15098),
+      UINT16_C(40661), UINT16_C(65453), UINT16_C( 5522), UINT16_C(32750), UINT16_C(31522), UINT16_C(21090), UINT16_C( 7457), UINT16_C(42976),
+      UINT16_C(15547), UINT16_C( 1028), UINT16_C(61164), UINT16_C(19768), UINT16_C( 5466), UINT16_C(32478), UINT16_C(55612), UINT16_C( 4536),
+      UINT16_C(25975), UINT16_C( 2320), UINT16_C(65147), UINT16_C(40328), UINT16_C(60282), UINT16_C(39919), UINT16_C(53000), UINT16_C(49987),
+      UINT16_C(18187), UINT16_C(63687), UINT16_C(65333), UINT16_C(36677), UINT16_C( 9237), UINT16_C(20749), UINT16_C(50941), UINT16_C(29794),
+      UINT16_C(29227), UINT16_C(42622), UINT16_C( 1648), UINT16_C(59971), UINT16_C(13297), UINT16_C(63878), UINT16_C(51458), UINT16_C( 3772),
+      UINT16_C(33552), UINT16_C(17670), UINT16_C(19331), UINT16_C(39125), UINT16_C(57967), UINT16_C(27881), UINT16_C(19368), UINT16_C(54497),
+      UINT16_C(24509), UINT16_C(11642), UINT16_C(48741), UINT16_C(22296), UINT16_C(40689), UINT16_C(62288), UINT16_C( 3431), UINT16_C(30465),
+      UINT16_C( 1936), UINT16_C( 5052), UINT16_C(37203), UINT16_C(49835), UINT16_C(38004), UINT16_C( 7215), UINT16_C( 4319), UINT16_C(40176),
+      UINT16_C(27503), UINT16_C(54474), UINT16_C(57897), UINT16_C( 6699), UINT16_C(31872), UINT16_C(59149), UINT16_C( 3977), UINT16_C( 6494),
+      UINT16_C( 6678), UINT16_C(26925), UINT16_C(55468), UINT16_C( 8236), UINT16_C(23405), UINT16_C(19516), UINT16_C(11627), UINT16_C(56041),
+      UINT16_C(45976), UINT16_C(49582), UINT16_C(55957), UINT16_C( 5595), UINT16_C(59478), UINT16_C(57340), UINT16_C(23287), UINT16_C( 3832),
+      UINT16_C( 9588), UINT16_C( 8311), UINT16_C(41982), UINT16_C(27456), UINT16_C(32254), UINT16_C(27063), UINT16_C(41130), UINT16_C(16963),
+      UINT16_C(62035), UINT16_C(59395), UINT16_C(57036), UINT16_C( 8957), UINT16_C(63942), UINT16_C(48641), UINT16_C(63827), UINT16_C(51404),
+      UINT16_C(17183), UINT16_C( 7656), UINT16_C(10727), UINT16_C(58760), UINT16_C(16294), UINT16_C(20559), UINT16_C(37600), UINT16_C(13202),
+      UINT16_C(38276), UINT16_C(20508), UINT16_C( 6515), UINT16_C(14706), UINT16_C(29459), UINT16_C(26359), UINT16_C(50029), UINT16_C(35886),
+      UINT16_C( 5895), UINT16_C(61097), UINT16_C(12608), UINT16_C(59091), UINT16_C( 8816), UINT16_C(20534), UINT16_C(51381), UINT16_C(14724),
+      UINT16_C(41053), UINT16_C(53386), UINT16_C(64697), UINT16_C(52233), UINT16_C(  368), UINT16_C(56627), UINT16_C(25028), UINT16_C(52073),
+      UINT16_C( 4728), UINT16_C(47289), UINT16_C(36163), UINT16_C(45982), UINT16_C(54447), UINT16_C(25604), UINT16_C(34972), UINT16_C(63902),
+      UINT16_C(10280), UINT16_C(57801), UINT16_C(54052), UINT16_C(38062), UINT16_C(57812), UINT16_C(39025), UINT16_C(55874), UINT16_C(47972),
+      UINT16_C( 7660), UINT16_C(12147), UINT16_C( 4778), UINT16_C(23267), UINT16_C(59366), UINT16_C(33726), UINT16_C(23663), UINT16_C(38780),
+      UINT16_C(18052), UINT16_C(43384), UINT16_C( 9753), UINT16_C(60733), UINT16_C(44807), UINT16_C(19077), UINT16_C(59785), UINT16_C(30213),
+      UINT16_C(30727), UINT16_C(45477), UINT16_C(34954), UINT16_C(28939), UINT16_C(51823), UINT16_C(57076), UINT16_C(28710), UINT16_C(43893),
+      UINT16_C(61110), UINT16_C(53076), UINT16_C(37140), UINT16_C( 7356), UINT16_C(16960), UINT16_C(51814), UINT16_C(27435), UINT16_C(12864),
+      UINT16_C(58851), UINT16_C(28388), UINT16_C(61294), UINT16_C(56799), UINT16_C(54201), UINT16_C(57532), UINT16_C(12611), UINT16_C(64139),
+      UINT16_C(57119), UINT16_C(13513), UINT16_C(34416), UINT16_C(45392), UINT16_C(46792), UINT16_C(62331), UINT16_C(47905), UINT16_C( 1062),
+      UINT16_C( 2720), UINT16_C( 3698), UINT16_C(20985), UINT16_C(46060), UINT16_C(43044), UINT16_C(26771), UINT16_C( 7897), UINT16_C(63842),
+      UINT16_C(11261), UINT16_C(27949), UINT16_C(32177), UINT16_C(31006), UINT16_C(39219), UINT16_C(21613), UINT16_C(37716), UINT16_C(62808),
+      UINT16_C(52125), UINT16_C(38403), UINT16_C(61212), UINT16_C(16713), UINT16_C(56471), UINT16_C(29097), UINT16_C( 3066), UINT16_C(63338),
+      UINT16_C(38710), UINT16_C(59493), UINT16_C(33556), UINT16_C(18273), UINT16_C(52765), UINT16_C(29083), UINT16_C(62305), UINT16_C(65126),
+      UINT16_C(27326), UINT16_C(56213), UINT16_C(56921), UINT16_C(61724), UINT16_C(50619), UINT16_C(46434), UINT16_C(52432), UINT16_C( 1709),
+      UINT16_C( 4707), UINT16_C(30702), UINT16_C(20629), UINT16_C(45758), UINT16_C(22814), UINT16_C(32804), UINT16_C(35404), UINT16_C( 2942),
+      UINT16_C( 5108), UINT16_C(20198), UINT16_C(  754), UINT16_C(44351), UINT16_C(41415), UINT16_C(38754), UINT16_C( 3949), UINT16_C(53405),
+      UINT16_C(35873), UINT16_C(46919), UINT16_C( 1500), UINT16_C(64105), UINT16_C(36190), UINT16_C(43642), UINT16_C(63768), UINT16_C( 3253),
+      UINT16_C(39692), UINT16_C(65114), UINT16_C(39325), UINT16_C(25771), UINT16_C( 3642), UINT16_C(43003), UINT16_C(39197), UINT16_C(16247),
+      UINT16_C(48677), UINT16_C(  502), UINT16_C(24515), UINT16_C( 8699), UINT16_C(30445), UINT16_C( 1484), UINT16_C(33135), UINT16_C(31505),
+      UINT16_C(27677), UINT16_C(47738), UINT16_C( 9477), UINT16_C(16415) };
+  static const uint16_t e[] =
+    { UINT16_C(62817), UINT16_C(65103), UINT16_C(10446), UINT16_C(47919), UINT16_C(41570), UINT16_C(32600), UINT16_C(39091), UINT16_C(44802),
+      UINT16_C(36789), UINT16_C(37798), UINT16_C(65025), UINT16_C(59850), UINT16_C(19098), UINT16_C( 3492), UINT16_C(64984), UINT16_C(31616),
+      UINT16_C(45980), UINT16_C(27403), UINT16_C(63089), UINT16_C(34503), UINT16_C(56971), UINT16_C(16060), UINT16_C(49015), UINT16_C(41271),
+      UINT16_C(37710), UINT16_C(18111), UINT16_C(35306), UINT16_C(63055), UINT16_C(54422), UINT16_C(40356), UINT16_C(50299), UINT16_C( 6224),
+      UINT16_C(57437), UINT16_C(52963), UINT16_C(43990), UINT16_C(53136), UINT16_C(45291), UINT16_C(43137), UINT16_C(64268), UINT16_C(26953),
+      UINT16_C(44566), UINT16_C(30881), UINT16_C(53715), UINT16_C(61288), UINT16_C(10917), UINT16_C(58253), UINT16_C(65006), UINT16_C(26168),
+      UINT16_C(47961), UINT16_C(40377), UINT16_C(45129), UINT16_C(44141), UINT16_C(31382), UINT16_C(41482), UINT16_C(38261), UINT16_C( 1277),
+      UINT16_C(40670), UINT16_C(65453), UINT16_C(18287), UINT16_C( 5147), UINT16_C(51058), UINT16_C(24628), UINT16_C(28100), UINT16_C( 7622),
+      UINT16_C(32552), UINT16_C(60859), UINT16_C(10441), UINT16_C(24473), UINT16_C(41890), UINT16_C(32478), UINT16_C(65336), UINT16_C( 5916),
+      UINT16_C(39069), UINT16_C( 3272), UINT16_C(58336), UINT16_C(40328), UINT16_C(60282), UINT16_C(39919), UINT16_C(31169), UINT16_C(60045),
+      UINT16_C(18680), UINT16_C(49623), UINT16_C(28784), UINT16_C( 4641), UINT16_C( 8979), UINT16_C(19498), UINT16_C(17954), UINT16_C(48995),
+      UINT16_C(29227), UINT16_C(49099), UINT16_C(60175), UINT16_C(59971), UINT16_C(49983), UINT16_C(63878), UINT16_C(51458), UINT16_C(13803),
+      UINT16_C(49918), UINT16_C(28406), UINT16_C( 5938), UINT16_C(39125), UINT16_C(57967), UINT16_C(27881), UINT16_C(62706), UINT16_C(53531),
+      UINT16_C(58912), UINT16_C(12176), UINT16_C(48741), UINT16_C(22296), UINT16_C(40689), UINT16_C(62288), UINT16_C(64969), UINT16_C(51158),
+      UINT16_C(52415), UINT16_C(61750), UINT16_C(47076), UINT16_C( 7734), UINT16_C(51298), UINT16_C(21627), UINT16_C(38588), UINT16_C(56357),
+      UINT16_C(46461), UINT16_C(54474), UINT16_C(62550), UINT16_C(47967), UINT16_C(31872), UINT16_C(53340), UINT16_C(12910), UINT16_C(11671),
+      UINT16_C(52734), UINT16_C(57886), UINT16_C(55468), UINT16_C(59137), UINT16_C(31773), UINT16_C(55611), UINT16_C(24850), UINT16_C(56041),
+      UINT16_C(49430), UINT16_C(49582), UINT16_C(55957), UINT16_C(48424), UINT16_C(59478), UINT16_C( 7565), UINT16_C( 9398), UINT16_C(46155),
+      UINT16_C(27122), UINT16_C(30359), UINT16_C(39102), UINT16_C(56157), UINT16_C(39188), UINT16_C(27063), UINT16_C(41130), UINT16_C( 4278),
+      UINT16_C(62035), UINT16_C(59395), UINT16_C(42449), UINT16_C(32927), UINT16_C(11305), UINT16_C(57246), UINT16_C(59729), UINT16_C(17300),
+      UINT16_C(11090), UINT16_C( 7656), UINT16_C( 6083), UINT16_C(58760), UINT16_C(41392), UINT16_C(43773), UINT16_C(45836), UINT16_C(14778),
+      UINT16_C(38276), UINT16_C( 6427), UINT16_C(48093), UINT16_C(14706), UINT16_C(29459), UINT16_C(26359), UINT16_C(31264), UINT16_C(29563),
+      UINT16_C(13733), UINT16_C(26756), UINT16_C(28748), UINT16_C(64575), UINT16_C(15634), UINT16_C(20534), UINT16_C(24816), UINT16_C(14724),
+      UINT16_C(41053), UINT16_C(53386), UINT16_C(64697), UINT16_C(52233), UINT16_C(25378), UINT16_C(16974), UINT16_C(51678), UINT16_C(33717),
+      UINT16_C(14846), UINT16_C(47289), UINT16_C(36163), UINT16_C(48198), UINT16_C(60520), UINT16_C(23002), UINT16_C(12877), UINT16_C(63902),
+      UINT16_C(58021), UINT16_C(57801), UINT16_C(55500), UINT16_C(61160), UINT16_C(57812), UINT16_C(39025), UINT16_C(58880), UINT16_C(65181),
+      UINT16_C(35104), UINT16_C(51785), UINT16_C(36789), UINT16_C( 7558), UINT16_C(24700), UINT16_C(51574), UINT16_C(23663), UINT16_C(38780),
+      UINT16_C( 2793), UINT16_C(46602), UINT16_C(62434), UINT16_C( 7844), UINT16_C(54569), UINT16_C(19077), UINT16_C(59785), UINT16_C(56360),
+      UINT16_C(30727), UINT16_C( 5286), UINT16_C(34954), UINT16_C(31794), UINT16_C(43148), UINT16_C( 8005), UINT16_C(62640), UINT16_C(43893),
+      UINT16_C(25086), UINT16_C(57423), UINT16_C(62548), UINT16_C(32255), UINT16_C(14281), UINT16_C(34215), UINT16_C(53005), UINT16_C(28001),
+      UINT16_C(58851), UINT16_C(16513), UINT16_C(61294), UINT16_C(49341), UINT16_C(  604), UINT16_C(57532), UINT16_C(13814), UINT16_C(62629),
+      UINT16_C(62870), UINT16_C(60117), UINT16_C(54505), UINT16_C(45672), UINT16_C( 3851), UINT16_C( 6456), UINT16_C(47905), UINT16_C( 7814),
+      UINT16_C( 2720), UINT16_C(54366), UINT16_C(20985), UINT16_C(46060), UINT16_C(29470), UINT16_C( 5155), UINT16_C(51369), UINT16_C(16137),
+      UINT16_C(57021), UINT16_C(42538), UINT16_C(37554), UINT16_C(48473), UINT16_C(39219), UINT16_C(32726), UINT16_C(23594), UINT16_C(62808),
+      UINT16_C(64356), UINT16_C( 8096), UINT16_C(61212), UINT16_C(16713), UINT16_C(56471), UINT16_C(29097), UINT16_C(21025), UINT16_C(63338),
+      UINT16_C(47664), UINT16_C(57989), UINT16_C(56908), UINT16_C(60832), UINT16_C(30319), UINT16_C(39532), UINT16_C( 2515), UINT16_C(14181),
+      UINT16_C(27326), UINT16_C( 7254), UINT16_C(56921), UINT16_C(57937), UINT16_C(50619), UINT16_C(46434), UINT16_C(50157), UINT16_C( 7653),
+      UINT16_C(27518), UINT16_C(51712), UINT16_C(41033), UINT16_C(47544), UINT16_C(22814), UINT16_C(59731), UINT16_C(47150), UINT16_C(13088),
+      UINT16_C(30398), UINT16_C(63567), UINT16_C(40962), UINT16_C(59354), UINT16_C(41415), UINT16_C(38754), UINT16_C(54224), UINT16_C(53405),
+      UINT16_C(17726), UINT16_C(34841), UINT16_C(53733), UINT16_C(64321), UINT16_C(38133), UINT16_C(43642), UINT16_C( 1356), UINT16_C( 3253),
+      UINT16_C(42364), UINT16_C(65114), UINT16_C(56389), UINT16_C(32870), UINT16_C(21737), UINT16_C(47783), UINT16_C(60455), UINT16_C(26120),
+      UINT16_C( 8497), UINT16_C( 5870), UINT16_C(24515), UINT16_C(59410), UINT16_C(63427), UINT16_C( 3851), UINT16_C(33135), UINT16_C(30746),
+      UINT16_C( 7175), UINT16_C(47738), UINT16_C(24057), UINT16_C(58061) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_u16_m(pv, av, bv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+
+    ev = simde_svmax_u16_m(pv, av, bv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(2025598470), UINT32_C( 439376729), UINT32_C(  89077790), UINT32_C(2407545368), UINT32_C(3902464948), UINT32_C(3659661729), UINT32_C(3214910988), UINT32_C(2459230092),
+      UINT32_C(1712017421), UINT32_C(3380689835), UINT32_C(2345586803), UINT32_C(3189460746), UINT32_C(3550983474), UINT32_C(3266169270), UINT32_C(4236397680), UINT32_C( 948835883),
+      UINT32_C( 312449382), UINT32_C(1222320341), UINT32_C(4208241392), UINT32_C( 733605881), UINT32_C(1543397540), UINT32_C(2568858665), UINT32_C( 613785592), UINT32_C( 475800757),
+      UINT32_C(2452552637), UINT32_C( 198904091), UINT32_C(2886119347), UINT32_C(1121435550), UINT32_C(1218303519), UINT32_C(2061679490), UINT32_C( 278820698), UINT32_C(1496120219),
+      UINT32_C( 317414134), UINT32_C( 387827299), UINT32_C( 331555701), UINT32_C(  22453218), UINT32_C(4081775473), UINT32_C( 158149806), UINT32_C(1058606243), UINT32_C(4254614791),
+      UINT32_C(  34571167), UINT32_C(3206098250), UINT32_C( 869522768), UINT32_C(3912509816), UINT32_C(3420225052), UINT32_C(1322535338), UINT32_C(1552805205), UINT32_C(3512345906),
+      UINT32_C(4073941416), UINT32_C(3887263126), UINT32_C(1109034442), UINT32_C(3391835822), UINT32_C(2006255565), UINT32_C(2797955408), UINT32_C(2281853526), UINT32_C( 542727287),
+      UINT32_C(1544695238), UINT32_C(3829646362), UINT32_C(4146486601), UINT32_C(2042778028), UINT32_C(2834323288), UINT32_C( 391034561), UINT32_C(2157990152), UINT32_C(1939929517),
+      UINT32_C(1087418918), UINT32_C(3223589751), UINT32_C( 498616945), UINT32_C(4086725275), UINT32_C(2459731665), UINT32_C(1168828988), UINT32_C(3922020923), UINT32_C(1784440131),
+      UINT32_C(2393517079), UINT32_C(2974797632), UINT32_C(3050178329), UINT32_C(1386767489), UINT32_C( 669336810), UINT32_C(1785499439), UINT32_C( 475214297), UINT32_C(2911285398),
+      UINT32_C( 473706972), UINT32_C( 432900864), UINT32_C( 332307346), UINT32_C(3932518399), UINT32_C(3927001787), UINT32_C(2991947225), UINT32_C(1154459822), UINT32_C( 905008472),
+      UINT32_C(2253467014), UINT32_C(1252007864), UINT32_C(3126685370), UINT32_C(2711929829), UINT32_C(3884692749), UINT32_C(3768180786), UINT32_C(3777259657), UINT32_C(1142298046),
+      UINT32_C(4224411715), UINT32_C(1095134087), UINT32_C(3220939737), UINT32_C(1952489318), UINT32_C(2254170964), UINT32_C(1432810700), UINT32_C( 456559197), UINT32_C(3814673824),
+      UINT32_C(1021192885), UINT32_C(1870472341), UINT32_C( 774797768), UINT32_C(1839369752), UINT32_C(1173618041), UINT32_C(1335515890), UINT32_C(2221593060), UINT32_C(3546794270),
+      UINT32_C(2299479796), UINT32_C( 855149674), UINT32_C( 509683205), UINT32_C( 780862388), UINT32_C(4084432385), UINT32_C(3175223000), UINT32_C(4248939743), UINT32_C(1775282549),
+      UINT32_C(1509154799), UINT32_C(1905060715), UINT32_C(3331321106), UINT32_C(4059306736), UINT32_C(1910794392), UINT32_C(1429087862), UINT32_C(1213362130), UINT32_C( 129049112),
+      UINT32_C(1818338305), UINT32_C(2732453264), UINT32_C(3395841242), UINT32_C( 532438406), UINT32_C( 999334085), UINT32_C(2576400071), UINT32_C(1189208621), UINT32_C(  88969988),
+      UINT32_C(3346116151), UINT32_C(1969835931), UINT32_C(1111544507), UINT32_C(4100062255), UINT32_C(1664086428), UINT32_C(3707617199), UINT32_C(2770525857), UINT32_C(2846519409),
+      UINT32_C(3127909150), UINT32_C( 640670314), UINT32_C(3681054636), UINT32_C( 147835243), UINT32_C(1768685242), UINT32_C(1581607101) };
+  static const uint32_t b[] =
+    { UINT32_C( 430069066), UINT32_C(4218360756), UINT32_C(1498820511), UINT32_C(2651915394), UINT32_C(4017249856), UINT32_C( 319127363), UINT32_C(  68123512), UINT32_C(1484059406),
+      UINT32_C(4235335496), UINT32_C(3388465450), UINT32_C(2451721488), UINT32_C(2452632402), UINT32_C(3565331089), UINT32_C(2598864673), UINT32_C( 278853122), UINT32_C( 845746921),
+      UINT32_C(1395579689), UINT32_C(3424396988), UINT32_C(3311288179), UINT32_C(  72912498), UINT32_C(1373166128), UINT32_C(1676394593), UINT32_C(2691926454), UINT32_C(3318930588),
+      UINT32_C(1931018423), UINT32_C(2587833638), UINT32_C(3881803124), UINT32_C(1542174507), UINT32_C(4071474065), UINT32_C( 978688131), UINT32_C(3202009378), UINT32_C(1568910501),
+      UINT32_C(3553664172), UINT32_C(1181552850), UINT32_C(3643657389), UINT32_C( 355735684), UINT32_C(1594417628), UINT32_C(2627296634), UINT32_C(3428479782), UINT32_C(3425295647),
+      UINT32_C(1285552506), UINT32_C(3079801865), UINT32_C(1552990424), UINT32_C(3027420376), UINT32_C( 538213030), UINT32_C(4273778135), UINT32_C(1086985761), UINT32_C(1829565427),
+      UINT32_C(4139363308), UINT32_C(2427276471), UINT32_C(3840687372), UINT32_C(2811846145), UINT32_C(2965876184), UINT32_C(2075034458), UINT32_C(2377939097), UINT32_C(1476053099),
+      UINT32_C( 726512756), UINT32_C( 213645824), UINT32_C( 972073015), UINT32_C(3756034310), UINT32_C(2442111030), UINT32_C(3305913643), UINT32_C( 542296245), UINT32_C(  91704465),
+      UINT32_C(   3196160), UINT32_C(4144819391), UINT32_C(2586901908), UINT32_C(3178827910), UINT32_C(3830319288), UINT32_C(4205402693), UINT32_C(3021667107), UINT32_C(1220121159),
+      UINT32_C( 373877079), UINT32_C(1762481621), UINT32_C(3624156498), UINT32_C( 110460238), UINT32_C(3421168518), UINT32_C(1640403774), UINT32_C(3591757966), UINT32_C(3374239346),
+      UINT32_C(2380293815), UINT32_C( 234286523), UINT32_C(2045180459), UINT32_C(4269767544), UINT32_C(2647222879), UINT32_C(2365493245), UINT32_C(3798078320), UINT32_C(2561442017),
+      UINT32_C(2720369894), UINT32_C(2762939513), UINT32_C(2384303382), UINT32_C(1888263441), UINT32_C(  67982855), UINT32_C(1435503589), UINT32_C(4281922078), UINT32_C(1503126642),
+      UINT32_C(3925589360), UINT32_C(4019104473), UINT32_C(1367255872), UINT32_C(1338051144), UINT32_C(1179962976), UINT32_C(4154189017), UINT32_C(1240912855), UINT32_C( 664964535),
+      UINT32_C( 588356938), UINT32_C(2282987336), UINT32_C(2480509258), UINT32_C(4242709147), UINT32_C(1094858344), UINT32_C(4063812891), UINT32_C(1748709041), UINT32_C( 110157499),
+      UINT32_C(3274285435), UINT32_C(2320186432), UINT32_C(1763517645), UINT32_C( 644153534), UINT32_C(1365747510), UINT32_C( 893624196), UINT32_C(2308865997), UINT32_C(3633262173),
+      UINT32_C( 261929167), UINT32_C(3264866293), UINT32_C(3391862540), UINT32_C(3992031415), UINT32_C(3158267959), UINT32_C(3320939256), UINT32_C(1582206721), UINT32_C(2352471485),
+      UINT32_C(2342245270), UINT32_C(3326948794), UINT32_C(2744220140), UINT32_C(1099989513), UINT32_C(3539849178), UINT32_C(1402531410), UINT32_C(1001580158), UINT32_C(1523116484),
+      UINT32_C(1994744764), UINT32_C(2218603160), UINT32_C(3039284907), UINT32_C( 720812112), UINT32_C(3657298823), UINT32_C(1596823009), UINT32_C(1067179899), UINT32_C(2224645064),
+      UINT32_C(1610251974), UINT32_C(1558394801), UINT32_C(1427180293), UINT32_C(1249904579), UINT32_C(3693379066), UINT32_C(2369474834) };
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(         0), UINT32_C(1498820511), UINT32_C(         0), UINT32_C(4017249856), UINT32_C(         0), UINT32_C(3214910988), UINT32_C(         0),
+      UINT32_C(4235335496), UINT32_C(3388465450), UINT32_C(2451721488), UINT32_C(3189460746), UINT32_C(         0), UINT32_C(3266169270), UINT32_C(         0), UINT32_C( 948835883),
+      UINT32_C(1395579689), UINT32_C(3424396988), UINT32_C(4208241392), UINT32_C( 733605881), UINT32_C(1543397540), UINT32_C(2568858665), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3881803124), UINT32_C(1542174507), UINT32_C(         0), UINT32_C(2061679490), UINT32_C(         0), UINT32_C(1568910501),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3643657389), UINT32_C(         0), UINT32_C(4081775473), UINT32_C(2627296634), UINT32_C(3428479782), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3912509816), UINT32_C(3420225052), UINT32_C(         0), UINT32_C(         0), UINT32_C(3512345906),
+      UINT32_C(4139363308), UINT32_C(         0), UINT32_C(         0), UINT32_C(3391835822), UINT32_C(2965876184), UINT32_C(2797955408), UINT32_C(2377939097), UINT32_C(         0),
+      UINT32_C(1544695238), UINT32_C(3829646362), UINT32_C(         0), UINT32_C(3756034310), UINT32_C(2834323288), UINT32_C(3305913643), UINT32_C(2157990152), UINT32_C(1939929517),
+      UINT32_C(         0), UINT32_C(4144819391), UINT32_C(2586901908), UINT32_C(         0), UINT32_C(3830319288), UINT32_C(         0), UINT32_C(3922020923), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(2974797632), UINT32_C(         0), UINT32_C(1386767489), UINT32_C(         0), UINT32_C(1785499439), UINT32_C(3591757966), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 432900864), UINT32_C(2045180459), UINT32_C(         0), UINT32_C(3927001787), UINT32_C(2991947225), UINT32_C(3798078320), UINT32_C(2561442017),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3126685370), UINT32_C(         0), UINT32_C(3884692749), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(4019104473), UINT32_C(3220939737), UINT32_C(1952489318), UINT32_C(         0), UINT32_C(4154189017), UINT32_C(1240912855), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(2282987336), UINT32_C(2480509258), UINT32_C(4242709147), UINT32_C(1173618041), UINT32_C(4063812891), UINT32_C(2221593060), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 780862388), UINT32_C(4084432385), UINT32_C(3175223000), UINT32_C(         0), UINT32_C(3633262173),
+      UINT32_C(         0), UINT32_C(3264866293), UINT32_C(         0), UINT32_C(4059306736), UINT32_C(         0), UINT32_C(3320939256), UINT32_C(         0), UINT32_C(2352471485),
+      UINT32_C(2342245270), UINT32_C(         0), UINT32_C(         0), UINT32_C(1099989513), UINT32_C(         0), UINT32_C(2576400071), UINT32_C(         0), UINT32_C(1523116484),
+      UINT32_C(         0), UINT32_C(2218603160), UINT32_C(3039284907), UINT32_C(4100062255), UINT32_C(3657298823), UINT32_C(3707617199), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3681054636), UINT32_C(         0), UINT32_C(3693379066), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_u32_z(pv, av, bv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+
+    ev = simde_svmax_u32_z(pv, av, bv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(2908150175), UINT32_C(3971319705), UINT32_C(3159047087), UINT32_C( 499603607), UINT32_C(3580030794), UINT32_C(1926531551), UINT32_C(3921284017), UINT32_C(3450126126),
+      UINT32_C( 846985881), UINT32_C( 824062082), UINT32_C(  65956459), UINT32_C( 203470274), UINT32_C(2212594596), UINT32_C(3203773708), UINT32_C(4020744129), UINT32_C( 129846126),
+      UINT32_C(3342415941), UINT32_C(3573110888), UINT32_C(2228742082), UINT32_C(1083242396), UINT32_C(2277732730), UINT32_C(3880106022), UINT32_C(3587697767), UINT32_C(2094896183),
+      UINT32_C( 876877516), UINT32_C( 805846382), UINT32_C(3233079076), UINT32_C(1358972119), UINT32_C(3705193397), UINT32_C(3804437883), UINT32_C(1085774345), UINT32_C(4206728238),
+      UINT32_C( 422511019), UINT32_C(1649030974), UINT32_C(3995270679), UINT32_C(4164887107), UINT32_C(1624512741), UINT32_C(1061328949), UINT32_C(1635776818), UINT32_C( 962280590),
+      UINT32_C(2069006909), UINT32_C(3655179458), UINT32_C(3737649051), UINT32_C( 114689569), UINT32_C(1416014622), UINT32_C(1972611139), UINT32_C( 819335842), UINT32_C(2355704399),
+      UINT32_C(2114501564), UINT32_C(4082623832), UINT32_C( 114368229), UINT32_C(1124968229), UINT32_C(2509730642), UINT32_C(3188402716), UINT32_C(2364465469), UINT32_C(3491256083),
+      UINT32_C(1783504914), UINT32_C(3948783110), UINT32_C(3924897476), UINT32_C( 674102998), UINT32_C(2394866802), UINT32_C( 743229935), UINT32_C(3199744682), UINT32_C(2744045713),
+      UINT32_C(4144946417), UINT32_C(1206020994), UINT32_C(1882248090), UINT32_C(1150836178), UINT32_C( 298997282), UINT32_C(3393003039), UINT32_C(3918067032), UINT32_C(3062634181),
+      UINT32_C(1974311666), UINT32_C(2696711942), UINT32_C( 890301539), UINT32_C(1819912266), UINT32_C( 511527935), UINT32_C(3253254761), UINT32_C(1957327023), UINT32_C(2032875142),
+      UINT32_C(3622754513), UINT32_C(3413617256), UINT32_C(3758131094), UINT32_C( 776763695), UINT32_C( 760072644), UINT32_C( 854472067), UINT32_C( 749181094), UINT32_C(2678444750),
+      UINT32_C( 309760938), UINT32_C(3571313981), UINT32_C(2763316596), UINT32_C( 449970518), UINT32_C(1313284042), UINT32_C(4219483477), UINT32_C(2619811789), UINT32_C(2755382777),
+      UINT32_C(2662773344), UINT32_C( 343053471), UINT32_C(3367511665), UINT32_C(4074932775), UINT32_C(4282395306), UINT32_C( 771407967), UINT32_C(3788055016), UINT32_C(1334117614),
+      UINT32_C(1458388150), UINT32_C(1097490384), UINT32_C(2903057029), UINT32_C(1453321388), UINT32_C(1968561942), UINT32_C(2275561375), UINT32_C(1600744305), UINT32_C( 648998512),
+      UINT32_C(4202470186), UINT32_C(2151474938), UINT32_C(3039642888), UINT32_C(1191955505), UINT32_C(1253925291), UINT32_C( 567435184), UINT32_C( 998325195), UINT32_C(1415655209),
+      UINT32_C(3310280395), UINT32_C(3443886788), UINT32_C(  25326288), UINT32_C(3913911614), UINT32_C(2670986990), UINT32_C( 817890917), UINT32_C(1785413953), UINT32_C(1019137393),
+      UINT32_C(1862340011), UINT32_C(1732003735), UINT32_C(4167679673), UINT32_C( 987869772), UINT32_C( 500766136), UINT32_C(1548655131), UINT32_C(1288157659), UINT32_C( 831030662),
+      UINT32_C( 715229842), UINT32_C(2324815313), UINT32_C(3900897948), UINT32_C(1679975596), UINT32_C(2508389497), UINT32_C(1911672982), UINT32_C( 280934537), UINT32_C(3493938750),
+      UINT32_C(2717573840), UINT32_C(1546423488), UINT32_C( 860139142), UINT32_C(2358732306), UINT32_C(4162918754), UINT32_C(1936331497), UINT32_C( 159590603), UINT32_C(1071236206),
+      UINT32_C(1742787751), UINT32_C(3871542368), UINT32_C(3440969659), UINT32_C(3495539053), UINT32_C(3033037514), UINT32_C(1478963853), UINT32_C(3378621018), UINT32_C( 352860782),
+      UINT32_C(1853679630), UINT32_C(2958376949), UINT32_C(3028119110), UINT32_C(3934574367), UINT32_C(3734916177), UINT32_C(3644245375), UINT32_C(3718420335), UINT32_C(3774065362),
+      UINT32_C(2286907283), UINT32_C(4114130095), UINT32_C( 849982738), UINT32_C(3726388620), UINT32_C(4189895290), UINT32_C(4006802303), UINT32_C(1556837770), UINT32_C(2990390815),
+      UINT32_C(3711601710), UINT32_C(1121088048), UINT32_C(3027532840), UINT32_C( 596807849), UINT32_C(3374075722), UINT32_C(3434606402), UINT32_C(2200535908), UINT32_C(1865836097),
+      UINT32_C( 575434994), UINT32_C( 191111139), UINT32_C(1153423771), UINT32_C(3026735721), UINT32_C(3816653985), UINT32_C(3618583923), UINT32_C(4183546040), UINT32_C( 812224830),
+      UINT32_C(3830625537), UINT32_C(1877981140), UINT32_C(4189368208), UINT32_C(2729253889), UINT32_C( 344271776), UINT32_C( 418067552), UINT32_C(1259423245), UINT32_C(3648813783),
+      UINT32_C(  79547952), UINT32_C( 359968133), UINT32_C(1561274460), UINT32_C(3841965124), UINT32_C(1207469287), UINT32_C(3311396024), UINT32_C(  34697514), UINT32_C( 467373547),
+      UINT32_C(3777009755), UINT32_C(2717291589), UINT32_C(  16647612), UINT32_C(2850356674), UINT32_C( 988929409), UINT32_C(3959378113), UINT32_C(2917994689), UINT32_C(4190685341),
+      UINT32_C(2799364193), UINT32_C( 944296060), UINT32_C(2553824982) };
+  static const uint32_t b[] =
+    { UINT32_C(1886125832), UINT32_C(1313455669), UINT32_C(3174409550), UINT32_C(2953957833), UINT32_C(3092075780), UINT32_C(1351713332), UINT32_C( 235048659), UINT32_C(2489826956),
+      UINT32_C(4060402365), UINT32_C(3728821904), UINT32_C(3181147891), UINT32_C(1282256200), UINT32_C( 923056642), UINT32_C( 260544060), UINT32_C(2954725924), UINT32_C(  88376648),
+      UINT32_C(3908520279), UINT32_C(2328246423), UINT32_C(4148650671), UINT32_C( 306426895), UINT32_C(2873706351), UINT32_C(  45863133), UINT32_C(2729629786), UINT32_C(3047683933),
+      UINT32_C(3617431360), UINT32_C(2254529495), UINT32_C(3581782470), UINT32_C(3437740125), UINT32_C(3849859080), UINT32_C(1541878529), UINT32_C(1778293259), UINT32_C(3508446609),
+      UINT32_C( 480820036), UINT32_C(3835824414), UINT32_C( 280633522), UINT32_C(3906773472), UINT32_C(3553514706), UINT32_C(2469311879), UINT32_C(3774622799), UINT32_C( 380705490),
+      UINT32_C(4080163285), UINT32_C( 366531939), UINT32_C(3576009461), UINT32_C(  96338483), UINT32_C(3738733654), UINT32_C(2440103745), UINT32_C(  91319603), UINT32_C(1545347975),
+      UINT32_C(3746516604), UINT32_C( 418719523), UINT32_C(3991804601), UINT32_C(1945283612), UINT32_C(2035403576), UINT32_C(  84591314), UINT32_C(3054205999), UINT32_C( 454174623),
+      UINT32_C(2583388533), UINT32_C(1118957705), UINT32_C( 657432330), UINT32_C(2207916619), UINT32_C(3221089261), UINT32_C(3703834541), UINT32_C( 580046723), UINT32_C(1816044790),
+      UINT32_C(2382706949), UINT32_C( 869381673), UINT32_C(2707030102), UINT32_C( 254145570), UINT32_C(2362319583), UINT32_C(2909311785), UINT32_C(1506802274), UINT32_C(2764377502),
+      UINT32_C(1865599558), UINT32_C(3601007488), UINT32_C( 645463300), UINT32_C(3510017522), UINT32_C(3898475711), UINT32_C(4204119703), UINT32_C(1599301057), UINT32_C(3103987826),
+      UINT32_C(1646802658), UINT32_C(1027197753), UINT32_C(3143938505), UINT32_C( 227318350), UINT32_C( 922086046), UINT32_C(1915784113), UINT32_C(1657897968), UINT32_C(2098976155),
+      UINT32_C(1155482635), UINT32_C(3632404495), UINT32_C( 395568841), UINT32_C( 505684096), UINT32_C(3142851082), UINT32_C(2502788261), UINT32_C(2734161671), UINT32_C(3743355860),
+      UINT32_C(1713635159), UINT32_C(3779044631), UINT32_C( 200856203), UINT32_C(4247395826), UINT32_C(3703078455), UINT32_C( 175236611), UINT32_C(3115149541), UINT32_C(3533229179),
+      UINT32_C(3812211659), UINT32_C(3972298849), UINT32_C(1039711306), UINT32_C( 272245465), UINT32_C(2750214816), UINT32_C(3182321112), UINT32_C(1098275782), UINT32_C(4078177831),
+      UINT32_C( 735464906), UINT32_C( 253205189), UINT32_C( 810291030), UINT32_C(3527444017), UINT32_C(1366633849), UINT32_C(1343169418), UINT32_C(2794620286), UINT32_C(1587127956),
+      UINT32_C(3096014835), UINT32_C(1606918153), UINT32_C(3784250544), UINT32_C( 330551450), UINT32_C(2271554045), UINT32_C(3419960396), UINT32_C(2373020409), UINT32_C(  65735184),
+      UINT32_C(2193323129), UINT32_C(3319890453), UINT32_C( 832991638), UINT32_C(1044666945), UINT32_C(3485837699), UINT32_C( 396008733), UINT32_C( 396626695), UINT32_C(2384105493),
+      UINT32_C( 420533508), UINT32_C(4007588440), UINT32_C(2753529187), UINT32_C(1659004127), UINT32_C( 724674317), UINT32_C(1279446085), UINT32_C(3982812887), UINT32_C(2071690870),
+      UINT32_C(2895416404), UINT32_C(3784995710), UINT32_C(3615865592), UINT32_C( 725182238), UINT32_C(1398172174), UINT32_C( 245405750), UINT32_C(4126868607), UINT32_C(3597694594),
+      UINT32_C(2156004610), UINT32_C(1885412728), UINT32_C(4115130071), UINT32_C(1545633869), UINT32_C( 565147626), UINT32_C(2385465103), UINT32_C(3598985811), UINT32_C(2746021024),
+      UINT32_C(1898131449), UINT32_C( 601982284), UINT32_C(3105368171), UINT32_C(2467641512), UINT32_C(3216295087), UINT32_C(1733157652), UINT32_C(2906509581), UINT32_C(3209751238),
+      UINT32_C(1697739801), UINT32_C(1686639353), UINT32_C(3810369595), UINT32_C(2289447640), UINT32_C( 189213431), UINT32_C( 443716621), UINT32_C( 751349862), UINT32_C(3018528922),
+      UINT32_C(2232949900), UINT32_C(1793761327), UINT32_C( 407701312), UINT32_C( 832619578), UINT32_C(4231849966), UINT32_C(3793137276), UINT32_C(4161723998), UINT32_C(2209085943),
+      UINT32_C(1158267670), UINT32_C(2746217315), UINT32_C( 884800762), UINT32_C(2942655680), UINT32_C(3232473412), UINT32_C(2929901904), UINT32_C(2544349344), UINT32_C(3206173353),
+      UINT32_C(2030314262), UINT32_C( 287159062), UINT32_C(1883625904), UINT32_C(2032118581), UINT32_C(2621033036), UINT32_C( 743168908), UINT32_C( 902034059), UINT32_C(1525996868),
+      UINT32_C( 399833345), UINT32_C(1546187180), UINT32_C(4291653322), UINT32_C(1702489113), UINT32_C(1124250295), UINT32_C( 426724750), UINT32_C(2202939967), UINT32_C( 283001615),
+      UINT32_C(3894981180), UINT32_C(1833259171), UINT32_C(3614184126), UINT32_C(3040732670), UINT32_C( 653803416), UINT32_C(3409930124), UINT32_C(2840497817), UINT32_C( 230239441),
+      UINT32_C(2180375006), UINT32_C(4042144306), UINT32_C(1271421772) };
+  static const uint32_t e[] =
+    { UINT32_C(2908150175), UINT32_C(3971319705), UINT32_C(3159047087), UINT32_C( 499603607), UINT32_C(3580030794), UINT32_C(1926531551), UINT32_C(3921284017), UINT32_C(3450126126),
+      UINT32_C( 846985881), UINT32_C(3728821904), UINT32_C(3181147891), UINT32_C( 203470274), UINT32_C(2212594596), UINT32_C(3203773708), UINT32_C(4020744129), UINT32_C( 129846126),
+      UINT32_C(3908520279), UINT32_C(3573110888), UINT32_C(4148650671), UINT32_C(1083242396), UINT32_C(2873706351), UINT32_C(3880106022), UINT32_C(3587697767), UINT32_C(2094896183),
+      UINT32_C(3617431360), UINT32_C( 805846382), UINT32_C(3581782470), UINT32_C(1358972119), UINT32_C(3705193397), UINT32_C(3804437883), UINT32_C(1778293259), UINT32_C(4206728238),
+      UINT32_C( 480820036), UINT32_C(3835824414), UINT32_C(3995270679), UINT32_C(4164887107), UINT32_C(1624512741), UINT32_C(1061328949), UINT32_C(1635776818), UINT32_C( 962280590),
+      UINT32_C(2069006909), UINT32_C(3655179458), UINT32_C(3737649051), UINT32_C( 114689569), UINT32_C(1416014622), UINT32_C(2440103745), UINT32_C( 819335842), UINT32_C(2355704399),
+      UINT32_C(3746516604), UINT32_C(4082623832), UINT32_C(3991804601), UINT32_C(1945283612), UINT32_C(2509730642), UINT32_C(3188402716), UINT32_C(3054205999), UINT32_C(3491256083),
+      UINT32_C(2583388533), UINT32_C(3948783110), UINT32_C(3924897476), UINT32_C( 674102998), UINT32_C(3221089261), UINT32_C( 743229935), UINT32_C(3199744682), UINT32_C(2744045713),
+      UINT32_C(4144946417), UINT32_C(1206020994), UINT32_C(1882248090), UINT32_C(1150836178), UINT32_C(2362319583), UINT32_C(3393003039), UINT32_C(3918067032), UINT32_C(3062634181),
+      UINT32_C(1974311666), UINT32_C(3601007488), UINT32_C( 890301539), UINT32_C(1819912266), UINT32_C(3898475711), UINT32_C(3253254761), UINT32_C(1957327023), UINT32_C(3103987826),
+      UINT32_C(3622754513), UINT32_C(3413617256), UINT32_C(3758131094), UINT32_C( 776763695), UINT32_C( 922086046), UINT32_C( 854472067), UINT32_C( 749181094), UINT32_C(2678444750),
+      UINT32_C( 309760938), UINT32_C(3632404495), UINT32_C(2763316596), UINT32_C( 449970518), UINT32_C(1313284042), UINT32_C(4219483477), UINT32_C(2734161671), UINT32_C(2755382777),
+      UINT32_C(2662773344), UINT32_C( 343053471), UINT32_C(3367511665), UINT32_C(4247395826), UINT32_C(4282395306), UINT32_C( 771407967), UINT32_C(3788055016), UINT32_C(1334117614),
+      UINT32_C(1458388150), UINT32_C(1097490384), UINT32_C(2903057029), UINT32_C(1453321388), UINT32_C(2750214816), UINT32_C(3182321112), UINT32_C(1600744305), UINT32_C( 648998512),
+      UINT32_C(4202470186), UINT32_C(2151474938), UINT32_C(3039642888), UINT32_C(1191955505), UINT32_C(1253925291), UINT32_C(1343169418), UINT32_C( 998325195), UINT32_C(1587127956),
+      UINT32_C(3310280395), UINT32_C(3443886788), UINT32_C(  25326288), UINT32_C(3913911614), UINT32_C(2670986990), UINT32_C(3419960396), UINT32_C(1785413953), UINT32_C(1019137393),
+      UINT32_C(2193323129), UINT32_C(1732003735), UINT32_C(4167679673), UINT32_C(1044666945), UINT32_C( 500766136), UINT32_C(1548655131), UINT32_C(1288157659), UINT32_C(2384105493),
+      UINT32_C( 715229842), UINT32_C(2324815313), UINT32_C(3900897948), UINT32_C(1679975596), UINT32_C(2508389497), UINT32_C(1911672982), UINT32_C(3982812887), UINT32_C(3493938750),
+      UINT32_C(2895416404), UINT32_C(1546423488), UINT32_C( 860139142), UINT32_C(2358732306), UINT32_C(4162918754), UINT32_C(1936331497), UINT32_C( 159590603), UINT32_C(3597694594),
+      UINT32_C(2156004610), UINT32_C(3871542368), UINT32_C(3440969659), UINT32_C(3495539053), UINT32_C(3033037514), UINT32_C(2385465103), UINT32_C(3378621018), UINT32_C(2746021024),
+      UINT32_C(1853679630), UINT32_C(2958376949), UINT32_C(3105368171), UINT32_C(3934574367), UINT32_C(3734916177), UINT32_C(3644245375), UINT32_C(3718420335), UINT32_C(3774065362),
+      UINT32_C(2286907283), UINT32_C(4114130095), UINT32_C(3810369595), UINT32_C(3726388620), UINT32_C(4189895290), UINT32_C(4006802303), UINT32_C(1556837770), UINT32_C(2990390815),
+      UINT32_C(3711601710), UINT32_C(1793761327), UINT32_C(3027532840), UINT32_C( 596807849), UINT32_C(4231849966), UINT32_C(3434606402), UINT32_C(2200535908), UINT32_C(1865836097),
+      UINT32_C(1158267670), UINT32_C(2746217315), UINT32_C(1153423771), UINT32_C(3026735721), UINT32_C(3816653985), UINT32_C(3618583923), UINT32_C(4183546040), UINT32_C( 812224830),
+      UINT32_C(3830625537), UINT32_C(1877981140), UINT32_C(4189368208), UINT32_C(2729253889), UINT32_C(2621033036), UINT32_C( 743168908), UINT32_C(1259423245), UINT32_C(3648813783),
+      UINT32_C(  79547952), UINT32_C( 359968133), UINT32_C(4291653322), UINT32_C(3841965124), UINT32_C(1207469287), UINT32_C(3311396024), UINT32_C(  34697514), UINT32_C( 467373547),
+      UINT32_C(3777009755), UINT32_C(2717291589), UINT32_C(3614184126), UINT32_C(2850356674), UINT32_C( 988929409), UINT32_C(3959378113), UINT32_C(2917994689), UINT32_C(4190685341),
+      UINT32_C(2799364193), UINT32_C(4042144306), UINT32_C(2553824982) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_u32_m(pv, av, bv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+
+    ev = simde_svmax_u32_m(pv, av, bv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C( 8915494004634888010), UINT64_C(14411232914823973230), UINT64_C(15745126951820688543), UINT64_C(13317072003638237069),
+      UINT64_C(15271716667761046501), UINT64_C(  852649736891166738), UINT64_C(  222970466558904500), UINT64_C(16457002959477424189),
+      UINT64_C(14947246762691769143), UINT64_C(10822345489427245497), UINT64_C( 4157647075553957177), UINT64_C( 2382765848485291566),
+      UINT64_C( 7892326022400273147), UINT64_C( 5642660781688513494), UINT64_C( 4597523284647289751), UINT64_C(17771905594407301782),
+      UINT64_C( 7063954893554212840), UINT64_C(17653099386635983512), UINT64_C( 4601646006734944652), UINT64_C(12535595586574829574),
+      UINT64_C( 8263913839289542081), UINT64_C(13635804769760102892), UINT64_C( 2305058064184296469), UINT64_C(16136704358604651902),
+      UINT64_C( 8649404481226422972), UINT64_C( 6526838757092501668), UINT64_C(11815217969923419841), UINT64_C(16992600569479108819),
+      UINT64_C( 9013825846493969683), UINT64_C(10759635886633375666), UINT64_C( 5952746606820288981), UINT64_C( 8042045047421830016),
+      UINT64_C( 6442722140768574482), UINT64_C( 8675799457139309820), UINT64_C(13680825425523299594), UINT64_C( 5214331871779627154),
+      UINT64_C(10098086935176375076), UINT64_C( 2266933581863285593), UINT64_C( 9769299307611678617), UINT64_C( 3108559099004256422),
+      UINT64_C( 5501738429709702973), UINT64_C( 1567462108521150349), UINT64_C(10746292327932455333), UINT64_C(12083883935431432063),
+      UINT64_C( 5632824190524827883), UINT64_C(15499050371463017606), UINT64_C(   44635228738748954), UINT64_C(10177072628406619691),
+      UINT64_C(  572405206389404129), UINT64_C(12327513888186294539), UINT64_C( 4946168560850601250), UINT64_C( 5012811379545549665),
+      UINT64_C(11479351731098811847), UINT64_C(11166658196252940218), UINT64_C( 6904830761648434037), UINT64_C( 9851892197046266638),
+      UINT64_C( 3684822427387273456), UINT64_C( 7315945793028816757), UINT64_C(13078108789028406561), UINT64_C(14175889979081285745),
+      UINT64_C( 2102174599067830912), UINT64_C( 4737946376146168428), UINT64_C(16984163239579399254), UINT64_C( 4276124671333555134),
+      UINT64_C( 8658275888446873698), UINT64_C( 1904060312740704779), UINT64_C( 7543191459665071176), UINT64_C(  548967070591339687),
+      UINT64_C( 4501129248048796658), UINT64_C( 2903368064360336236), UINT64_C(15471157948829033377), UINT64_C(17514736449805201252),
+      UINT64_C(14347738731663925675), UINT64_C(18283278978115929779), UINT64_C(11721459426459755940), UINT64_C( 7395117002889356204),
+      UINT64_C(12537848714448179677), UINT64_C(15871524251593930472), UINT64_C( 3783403606371175329), UINT64_C(14222228985867218237),
+      UINT64_C(17202338829612983314), UINT64_C(10882515249717836530), UINT64_C( 5529566088590177536), UINT64_C( 3518053608396725540),
+      UINT64_C(13780161416688160839), UINT64_C(16464861054135529457), UINT64_C( 1224742620755719332), UINT64_C( 3392319823078573253),
+      UINT64_C( 4128596100854337728), UINT64_C(14478966299878765607), UINT64_C( 5228814972086868883), UINT64_C( 6761380361896963519),
+      UINT64_C( 3607441622212170383), UINT64_C( 7157677552226349162), UINT64_C(  816403103420174728), UINT64_C( 5628241416920596512),
+      UINT64_C(11823414923766334937), UINT64_C(  619393933481497446), UINT64_C(  986123312798399320), UINT64_C(13976612380529615337),
+      UINT64_C(13243602511922994411), UINT64_C(15894757259942427661), UINT64_C(18229216778876135936), UINT64_C(10897192313942230673),
+      UINT64_C(11943413823861284534), UINT64_C( 3666713163810909315), UINT64_C( 2630415077280342898), UINT64_C( 8513729363338667490),
+      UINT64_C(17146115733122376629), UINT64_C( 6939720394000836330), UINT64_C( 7921944495168778041), UINT64_C( 1927579554176339339),
+      UINT64_C( 7376433829716180486), UINT64_C( 7120138412279091841), UINT64_C(11905299814875640895), UINT64_C( 6785711151573382317),
+      UINT64_C( 8129329308709655535), UINT64_C( 7136990602207449984), UINT64_C(  514647696765434468), UINT64_C(12920621468598408346),
+      UINT64_C(14715493420476800727), UINT64_C( 3083137009522644802), UINT64_C(17734275228062316219), UINT64_C( 5789719787280479457),
+      UINT64_C(12208499272350857045), UINT64_C( 2185891114594067044) };
+  static const uint64_t b[] =
+    { UINT64_C( 1455688182694044194), UINT64_C(16863611276822004358), UINT64_C(  939904910870526611), UINT64_C( 3103918063151045950),
+      UINT64_C( 8393838812344895927), UINT64_C(16442472159988529962), UINT64_C(13273883238306366623), UINT64_C( 5467169375678513068),
+      UINT64_C(11958235118062245011), UINT64_C( 6205707086314754794), UINT64_C( 6670030819270025821), UINT64_C(11805324477037922036),
+      UINT64_C(11575685587191170948), UINT64_C(  538174284818518122), UINT64_C(11630949197907162972), UINT64_C(17287345806825323061),
+      UINT64_C(10221927757792611204), UINT64_C(  996745437651056165), UINT64_C( 6298992313768784925), UINT64_C( 1610464101838656766),
+      UINT64_C(  162459292758198416), UINT64_C( 3648098309774634978), UINT64_C( 4455298354258951002), UINT64_C( 9629260007898313210),
+      UINT64_C(   11393268977365576), UINT64_C(18064276344787958121), UINT64_C( 1039007788584906222), UINT64_C( 6501012113112830653),
+      UINT64_C( 6074698300475339055), UINT64_C(  161431479427260578), UINT64_C(13642979972156994610), UINT64_C( 6564462841996308396),
+      UINT64_C(16526228496530839833), UINT64_C(16423049706426805461), UINT64_C( 7050244153164831257), UINT64_C(  645484723331614574),
+      UINT64_C( 7492130033671904722), UINT64_C(11395578776131740048), UINT64_C( 4353450104896114516), UINT64_C(10722451424753977814),
+      UINT64_C(14872190256599849322), UINT64_C( 4892937718177182915), UINT64_C(  328400132893351811), UINT64_C(11211031984636257599),
+      UINT64_C(11780005817239486063), UINT64_C( 4819364792414997168), UINT64_C( 2567933474049830257), UINT64_C( 8166075070194936966),
+      UINT64_C(10915486243393301496), UINT64_C(12259668147991635490), UINT64_C( 6794785975463228997), UINT64_C( 2508058772658090074),
+      UINT64_C(12093420110232611925), UINT64_C( 7475882069320010459), UINT64_C( 5807633570068367713), UINT64_C( 7968973410639130187),
+      UINT64_C(16254193672833962343), UINT64_C( 2815794052651686538), UINT64_C(14413199401249972926), UINT64_C(10677423584512422567),
+      UINT64_C(16306709996748396645), UINT64_C(13121697079914021676), UINT64_C( 1840124461419493699), UINT64_C(  135678202887063329),
+      UINT64_C(11536174354289943262), UINT64_C(10064044642847074044), UINT64_C(12011334971647857957), UINT64_C( 7870558829647530140),
+      UINT64_C( 6579121749779260729), UINT64_C(12697330202205806690), UINT64_C(17526592851092668687), UINT64_C( 4502302225362267776),
+      UINT64_C( 4450745946269753097), UINT64_C( 2185684043379971097), UINT64_C( 1506432724883381405), UINT64_C( 9177947320810082842),
+      UINT64_C(11301128521162181309), UINT64_C( 8641446547717930432), UINT64_C(11950955317168938546), UINT64_C( 6294101102229322852),
+      UINT64_C(12505587891041157485), UINT64_C(10723748434373561730), UINT64_C(17525252791182441735), UINT64_C(10097957807011527473),
+      UINT64_C( 6413981114779374184), UINT64_C(17279616776760819670), UINT64_C(10180588564853565637), UINT64_C(11916098264721069490),
+      UINT64_C(13528812062578039694), UINT64_C(13931254312143713406), UINT64_C( 4599122501528049129), UINT64_C( 3986933240900365427),
+      UINT64_C(14765434344170147657), UINT64_C( 9839951351968357841), UINT64_C( 8370116937057739612), UINT64_C(17342650400710539470),
+      UINT64_C( 8710251568506489543), UINT64_C(17801554612692784100), UINT64_C( 5254302712348072310), UINT64_C( 5681410260892323648),
+      UINT64_C(16345328856395478711), UINT64_C( 7271748719931104089), UINT64_C( 1372691694501022281), UINT64_C(17270409810595728342),
+      UINT64_C(12585629484986470601), UINT64_C(14524263276107403070), UINT64_C(  737632888296402007), UINT64_C(15171523276232472421),
+      UINT64_C( 4190674204919191844), UINT64_C(12509581767715768914), UINT64_C( 2783527766888752995), UINT64_C( 4694526648975034698),
+      UINT64_C( 6151603743675367464), UINT64_C( 2139704302638646445), UINT64_C(16631607175469631720), UINT64_C(  702105113501274719),
+      UINT64_C(  682448571390064928), UINT64_C( 5199333614517329743), UINT64_C(10504577080148286534), UINT64_C( 9385445970144002388),
+      UINT64_C( 5164536925933431878), UINT64_C(13647729273292831165), UINT64_C( 7861145409410783317), UINT64_C( 4200982093429417832),
+      UINT64_C(14883985625314095694), UINT64_C(12499831306830274371) };
+  static const uint64_t e[] =
+    { UINT64_C( 8915494004634888010), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(13317072003638237069),
+      UINT64_C(15271716667761046501), UINT64_C(16442472159988529962), UINT64_C(13273883238306366623), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(10221927757792611204), UINT64_C(17653099386635983512), UINT64_C(                   0), UINT64_C(12535595586574829574),
+      UINT64_C(                   0), UINT64_C(13635804769760102892), UINT64_C( 4455298354258951002), UINT64_C(16136704358604651902),
+      UINT64_C( 8649404481226422972), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 9013825846493969683), UINT64_C(                   0), UINT64_C(13642979972156994610), UINT64_C( 8042045047421830016),
+      UINT64_C(16526228496530839833), UINT64_C(                   0), UINT64_C(13680825425523299594), UINT64_C( 5214331871779627154),
+      UINT64_C(                   0), UINT64_C(11395578776131740048), UINT64_C(                   0), UINT64_C(10722451424753977814),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(10746292327932455333), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 2567933474049830257), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(12327513888186294539), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(12093420110232611925), UINT64_C(                   0), UINT64_C( 6904830761648434037), UINT64_C( 9851892197046266638),
+      UINT64_C(16254193672833962343), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(11536174354289943262), UINT64_C(                   0), UINT64_C(12011334971647857957), UINT64_C( 7870558829647530140),
+      UINT64_C(                   0), UINT64_C(12697330202205806690), UINT64_C(17526592851092668687), UINT64_C(17514736449805201252),
+      UINT64_C(                   0), UINT64_C(18283278978115929779), UINT64_C(11721459426459755940), UINT64_C(                   0),
+      UINT64_C(12537848714448179677), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(14222228985867218237),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(17525252791182441735), UINT64_C(                   0),
+      UINT64_C(13780161416688160839), UINT64_C(                   0), UINT64_C(10180588564853565637), UINT64_C(                   0),
+      UINT64_C(13528812062578039694), UINT64_C(14478966299878765607), UINT64_C(                   0), UINT64_C( 6761380361896963519),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(11823414923766334937), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(13976612380529615337),
+      UINT64_C(16345328856395478711), UINT64_C(15894757259942427661), UINT64_C(18229216778876135936), UINT64_C(17270409810595728342),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(15171523276232472421),
+      UINT64_C(17146115733122376629), UINT64_C(12509581767715768914), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 7120138412279091841), UINT64_C(                   0), UINT64_C( 6785711151573382317),
+      UINT64_C( 8129329308709655535), UINT64_C(                   0), UINT64_C(10504577080148286534), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(12499831306830274371) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_u64_z(pv, av, bv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+
+    ev = simde_svmax_u64_z(pv, av, bv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C( 8672774052566054085), UINT64_C( 6821180619994371281), UINT64_C(10053292057441557777), UINT64_C(  424483232970555567),
+      UINT64_C(  308862934412579013), UINT64_C(11052652106405107041), UINT64_C(11001362505089708357), UINT64_C(15255617245879139696),
+      UINT64_C( 6295732070960637991), UINT64_C(14692076264581995971), UINT64_C( 3580530754090438703), UINT64_C(11635217289848202134),
+      UINT64_C(14883932822736477505), UINT64_C(15440870218239961848), UINT64_C( 7277429758444320013), UINT64_C(13429033123246104642),
+      UINT64_C(12427823585667668383), UINT64_C(11234073749997850985), UINT64_C(13247733533065664167), UINT64_C(  322799458749506375),
+      UINT64_C( 6091724240467159850), UINT64_C(14762884400993907639), UINT64_C(17820492691515983907), UINT64_C(13575875206051250942),
+      UINT64_C(17500183565145085341), UINT64_C(12883135591242744536), UINT64_C( 2595930623969987423), UINT64_C(10208234219655118171),
+      UINT64_C( 4697520945174496515), UINT64_C(16030291838711588661), UINT64_C(13141489810863407380), UINT64_C(15649252059124131760),
+      UINT64_C( 7655917288269759124), UINT64_C(11172486775613324975), UINT64_C(11274822057631086951), UINT64_C(   57255336913673501),
+      UINT64_C(15729732282694362028), UINT64_C( 9717945695403014586), UINT64_C(  474778921876370189), UINT64_C(16738125253317350109),
+      UINT64_C( 4516288557732153255), UINT64_C(15506558492537238925), UINT64_C( 1729495764202256912), UINT64_C( 7304183000871401785),
+      UINT64_C(14462435243136067314), UINT64_C(11546006308296864666), UINT64_C(12499065061590502433), UINT64_C( 8481826770400761746),
+      UINT64_C( 7757907556909706406), UINT64_C(16573821417264455122), UINT64_C(14427201371885444119), UINT64_C( 9261316020207377038),
+      UINT64_C(16353988688023220665), UINT64_C(16632435332180460584), UINT64_C( 6620758521764910563), UINT64_C( 9177477076589803778),
+      UINT64_C(17318029178511736419), UINT64_C(14229597885332036292), UINT64_C(10659105050017589700), UINT64_C(12537683032966912184),
+      UINT64_C(14646679087442036874), UINT64_C(10716271126475841552), UINT64_C( 1073564619322529473), UINT64_C(12349022055600772457),
+      UINT64_C(  388789465960579218), UINT64_C( 6684660828000994401), UINT64_C( 7181154509411838277), UINT64_C( 5960363194761754090),
+      UINT64_C( 6336936271665739254), UINT64_C(15928471675776592149), UINT64_C( 4365149471906446390), UINT64_C( 1686315628036139605),
+      UINT64_C(13331769409539363509), UINT64_C(  960244012360043486), UINT64_C( 4594466474587769396), UINT64_C(13742094388447939196),
+      UINT64_C(10045962511576643597), UINT64_C( 9357728293907977720), UINT64_C( 7586817067178203935), UINT64_C( 7249595110739385811),
+      UINT64_C( 7686941366677734772), UINT64_C( 2459835125848518485), UINT64_C(14449929095773694770), UINT64_C(13893112593123741458),
+      UINT64_C(13268606585630024518), UINT64_C(11989847145761627454), UINT64_C( 1685838322037264553), UINT64_C(10513740514317109981),
+      UINT64_C(10974828478272752178), UINT64_C(15051943817376344521), UINT64_C(15270813493602658511), UINT64_C(17274089342548798941),
+      UINT64_C( 4152832805250073518), UINT64_C( 9976417357208648572), UINT64_C(10505573796405043458), UINT64_C( 6441400547298428857),
+      UINT64_C( 4116012698588866934), UINT64_C(17492914366035367294), UINT64_C( 2771884678794846769), UINT64_C( 1981866016075690365),
+      UINT64_C( 7340903567630394346), UINT64_C( 4582237861408849333), UINT64_C(12977012615357497731), UINT64_C(11352552885496624077),
+      UINT64_C( 7173431207106219329), UINT64_C( 1094550137122335714), UINT64_C(13694345792762893600), UINT64_C( 9807358153781668297),
+      UINT64_C( 7375274981073117001), UINT64_C( 2378893470645838440), UINT64_C(16396346313751987164) };
+  static const uint64_t b[] =
+    { UINT64_C( 3574251613066641134), UINT64_C( 5336456356040313750), UINT64_C(12498651117474275100), UINT64_C(11115126509698509502),
+      UINT64_C(15362862713751532571), UINT64_C( 6735441385933658982), UINT64_C(17193702349971460343), UINT64_C(12681497272232097719),
+      UINT64_C( 9062056191646055854), UINT64_C(15843142202477562943), UINT64_C(13570303375077783349), UINT64_C( 3990783593250016799),
+      UINT64_C( 3958355072934744921), UINT64_C(17614023168210934450), UINT64_C(14055080933344230476), UINT64_C(11761951184933760379),
+      UINT64_C(17732926027645345515), UINT64_C(12633158132458901149), UINT64_C(15177426890253183546), UINT64_C(15719551645271856954),
+      UINT64_C(15756639607782652783), UINT64_C( 8049489666018588323), UINT64_C(18256730608276190514), UINT64_C(12884983543758926342),
+      UINT64_C(  358897505135857123), UINT64_C(17071386670156886598), UINT64_C( 3185402997550495604), UINT64_C( 4682322344572794117),
+      UINT64_C(13107264301589094528), UINT64_C( 2608738329053687949), UINT64_C( 9485583009191799376), UINT64_C( 4098775632174630212),
+      UINT64_C( 3119587843695591974), UINT64_C(16556822762374724592), UINT64_C(17605132453697757265), UINT64_C(  699597136057474500),
+      UINT64_C(13799849284954148793), UINT64_C(17068120989614797924), UINT64_C(18224392280888457541), UINT64_C(12760155658313564201),
+      UINT64_C(  111335026121552892), UINT64_C( 6126540431774378878), UINT64_C(17673872939198169106), UINT64_C(16743564195387260597),
+      UINT64_C( 7955679039202813385), UINT64_C( 5588840948114612778), UINT64_C(14127472138031454797), UINT64_C(17181459238999887771),
+      UINT64_C(10201142864463078452), UINT64_C(17557096944814725407), UINT64_C(13187975788165348913), UINT64_C( 8663991391547717161),
+      UINT64_C( 7980991303584092626), UINT64_C( 1287872129798801734), UINT64_C( 3351054180609551278), UINT64_C( 4650451972627677132),
+      UINT64_C(11026844144348046666), UINT64_C(17200202725842145218), UINT64_C( 2847745403841414225), UINT64_C(  407508397134971384),
+      UINT64_C( 1717179143409245671), UINT64_C( 1198640021460572788), UINT64_C(10084664110146345585), UINT64_C(15397131951365303533),
+      UINT64_C( 7215862747606567862), UINT64_C(13406857967670189118), UINT64_C( 5634981019100017940), UINT64_C( 8388415819875755429),
+      UINT64_C(11187964423366998510), UINT64_C( 3063193313350278015), UINT64_C( 2867391641454512155), UINT64_C( 6006714923608621354),
+      UINT64_C(18272358776356133788), UINT64_C(17226629025104211408), UINT64_C( 1366621385487278927), UINT64_C( 8264200790629593848),
+      UINT64_C( 2930717834116588081), UINT64_C(  571710552834732333), UINT64_C( 9943050302944467714), UINT64_C( 9135999673245824641),
+      UINT64_C( 7059913811262518393), UINT64_C( 2957546808317970251), UINT64_C( 3803026772364420012), UINT64_C(13749863794069974535),
+      UINT64_C( 2602949578413047689), UINT64_C( 9214422917220696464), UINT64_C(  936612407927501847), UINT64_C( 7509244264537098802),
+      UINT64_C(16009527352323589424), UINT64_C(11607875802696603333), UINT64_C(10050745020978091114), UINT64_C( 4268348170293140213),
+      UINT64_C( 7794168163687752446), UINT64_C(11453528188861595592), UINT64_C(13894318202748231663), UINT64_C(  840714136078046563),
+      UINT64_C( 2901867787873414707), UINT64_C( 5986249707452254528), UINT64_C(  889581501582877133), UINT64_C(17319478287012719682),
+      UINT64_C( 8474665316776588051), UINT64_C( 5913786536572884825), UINT64_C( 6689044025064467486), UINT64_C( 9862046957779570479),
+      UINT64_C( 1109179319717767098), UINT64_C( 7676348504466083503), UINT64_C(16428857338572730762), UINT64_C( 7877548586426149718),
+      UINT64_C(10815888078650756691), UINT64_C( 5675752433684047374), UINT64_C( 5934321525660513987) };
+  static const uint64_t e[] =
+    { UINT64_C( 8672774052566054085), UINT64_C( 6821180619994371281), UINT64_C(10053292057441557777), UINT64_C(  424483232970555567),
+      UINT64_C(  308862934412579013), UINT64_C(11052652106405107041), UINT64_C(11001362505089708357), UINT64_C(15255617245879139696),
+      UINT64_C( 9062056191646055854), UINT64_C(14692076264581995971), UINT64_C( 3580530754090438703), UINT64_C(11635217289848202134),
+      UINT64_C(14883932822736477505), UINT64_C(15440870218239961848), UINT64_C(14055080933344230476), UINT64_C(13429033123246104642),
+      UINT64_C(17732926027645345515), UINT64_C(12633158132458901149), UINT64_C(13247733533065664167), UINT64_C(  322799458749506375),
+      UINT64_C( 6091724240467159850), UINT64_C(14762884400993907639), UINT64_C(18256730608276190514), UINT64_C(13575875206051250942),
+      UINT64_C(17500183565145085341), UINT64_C(12883135591242744536), UINT64_C( 2595930623969987423), UINT64_C(10208234219655118171),
+      UINT64_C( 4697520945174496515), UINT64_C(16030291838711588661), UINT64_C(13141489810863407380), UINT64_C(15649252059124131760),
+      UINT64_C( 7655917288269759124), UINT64_C(11172486775613324975), UINT64_C(17605132453697757265), UINT64_C(  699597136057474500),
+      UINT64_C(15729732282694362028), UINT64_C( 9717945695403014586), UINT64_C(  474778921876370189), UINT64_C(16738125253317350109),
+      UINT64_C( 4516288557732153255), UINT64_C(15506558492537238925), UINT64_C( 1729495764202256912), UINT64_C(16743564195387260597),
+      UINT64_C(14462435243136067314), UINT64_C(11546006308296864666), UINT64_C(14127472138031454797), UINT64_C(17181459238999887771),
+      UINT64_C(10201142864463078452), UINT64_C(17557096944814725407), UINT64_C(14427201371885444119), UINT64_C( 9261316020207377038),
+      UINT64_C(16353988688023220665), UINT64_C(16632435332180460584), UINT64_C( 6620758521764910563), UINT64_C( 9177477076589803778),
+      UINT64_C(17318029178511736419), UINT64_C(14229597885332036292), UINT64_C(10659105050017589700), UINT64_C(12537683032966912184),
+      UINT64_C(14646679087442036874), UINT64_C(10716271126475841552), UINT64_C(10084664110146345585), UINT64_C(15397131951365303533),
+      UINT64_C( 7215862747606567862), UINT64_C( 6684660828000994401), UINT64_C( 7181154509411838277), UINT64_C( 5960363194761754090),
+      UINT64_C(11187964423366998510), UINT64_C(15928471675776592149), UINT64_C( 4365149471906446390), UINT64_C( 1686315628036139605),
+      UINT64_C(18272358776356133788), UINT64_C(  960244012360043486), UINT64_C( 4594466474587769396), UINT64_C(13742094388447939196),
+      UINT64_C(10045962511576643597), UINT64_C( 9357728293907977720), UINT64_C( 7586817067178203935), UINT64_C( 7249595110739385811),
+      UINT64_C( 7686941366677734772), UINT64_C( 2459835125848518485), UINT64_C(14449929095773694770), UINT64_C(13893112593123741458),
+      UINT64_C(13268606585630024518), UINT64_C(11989847145761627454), UINT64_C( 1685838322037264553), UINT64_C(10513740514317109981),
+      UINT64_C(16009527352323589424), UINT64_C(15051943817376344521), UINT64_C(15270813493602658511), UINT64_C(17274089342548798941),
+      UINT64_C( 4152832805250073518), UINT64_C(11453528188861595592), UINT64_C(13894318202748231663), UINT64_C( 6441400547298428857),
+      UINT64_C( 4116012698588866934), UINT64_C(17492914366035367294), UINT64_C( 2771884678794846769), UINT64_C( 1981866016075690365),
+      UINT64_C( 7340903567630394346), UINT64_C( 4582237861408849333), UINT64_C(12977012615357497731), UINT64_C(11352552885496624077),
+      UINT64_C( 7173431207106219329), UINT64_C( 1094550137122335714), UINT64_C(16428857338572730762), UINT64_C( 9807358153781668297),
+      UINT64_C(10815888078650756691), UINT64_C( 5675752433684047374), UINT64_C(16396346313751987164) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_u64_m(pv, av, bv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+
+    ev = simde_svmax_u64_m(pv, av, bv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   931.44), SIMDE_FLOAT32_C(   476.41), SIMDE_FLOAT32_C(  -132.21), SIMDE_FLOAT32_C(  -141.86),
+      SIMDE_FLOAT32_C(   430.18), SIMDE_FLOAT32_C(   326.51), SIMDE_FLOAT32_C(  -750.57), SIMDE_FLOAT32_C(   120.08),
+      SIMDE_FLOAT32_C(  -561.44), SIMDE_FLOAT32_C(   -82.19), SIMDE_FLOAT32_C(   749.67), SIMDE_FLOAT32_C(  -507.80),
+      SIMDE_FLOAT32_C(   297.90), SIMDE_FLOAT32_C(   266.27), SIMDE_FLOAT32_C(  -331.03), SIMDE_FLOAT32_C(   169.85),
+      SIMDE_FLOAT32_C(   594.56), SIMDE_FLOAT32_C(  -366.33), SIMDE_FLOAT32_C(  -714.76), SIMDE_FLOAT32_C(   270.90),
+      SIMDE_FLOAT32_C(   290.63), SIMDE_FLOAT32_C(  -134.80), SIMDE_FLOAT32_C(  -445.19), SIMDE_FLOAT32_C(  -934.12),
+      SIMDE_FLOAT32_C(  -451.88), SIMDE_FLOAT32_C(  -241.06), SIMDE_FLOAT32_C(  -313.78), SIMDE_FLOAT32_C(   589.16),
+      SIMDE_FLOAT32_C(   181.15), SIMDE_FLOAT32_C(  -267.87), SIMDE_FLOAT32_C(  -195.46), SIMDE_FLOAT32_C(   112.59),
+      SIMDE_FLOAT32_C(  -791.46), SIMDE_FLOAT32_C(   672.33), SIMDE_FLOAT32_C(   970.72), SIMDE_FLOAT32_C(   638.72),
+      SIMDE_FLOAT32_C(    -1.16), SIMDE_FLOAT32_C(  -779.85), SIMDE_FLOAT32_C(  -241.21), SIMDE_FLOAT32_C(   437.39),
+      SIMDE_FLOAT32_C(   137.96), SIMDE_FLOAT32_C(  -491.53), SIMDE_FLOAT32_C(   929.59), SIMDE_FLOAT32_C(  -564.14),
+      SIMDE_FLOAT32_C(   774.73), SIMDE_FLOAT32_C(  -401.44), SIMDE_FLOAT32_C(   605.70), SIMDE_FLOAT32_C(   369.29),
+      SIMDE_FLOAT32_C(   232.23), SIMDE_FLOAT32_C(   890.94), SIMDE_FLOAT32_C(  -359.80), SIMDE_FLOAT32_C(  -477.14),
+      SIMDE_FLOAT32_C(  -243.86), SIMDE_FLOAT32_C(   195.01), SIMDE_FLOAT32_C(  -411.26), SIMDE_FLOAT32_C(   304.26),
+      SIMDE_FLOAT32_C(   953.95), SIMDE_FLOAT32_C(   274.96), SIMDE_FLOAT32_C(  -106.58), SIMDE_FLOAT32_C(   135.10),
+      SIMDE_FLOAT32_C(  -992.91), SIMDE_FLOAT32_C(   697.96), SIMDE_FLOAT32_C(  -752.31), SIMDE_FLOAT32_C(  -784.37),
+      SIMDE_FLOAT32_C(   370.29), SIMDE_FLOAT32_C(  -781.59), SIMDE_FLOAT32_C(   854.35), SIMDE_FLOAT32_C(  -630.87),
+      SIMDE_FLOAT32_C(  -561.44), SIMDE_FLOAT32_C(  -386.86), SIMDE_FLOAT32_C(   806.53), SIMDE_FLOAT32_C(   576.52),
+      SIMDE_FLOAT32_C(   121.61), SIMDE_FLOAT32_C(   736.12), SIMDE_FLOAT32_C(  -987.63), SIMDE_FLOAT32_C(  -103.66),
+      SIMDE_FLOAT32_C(  -665.32), SIMDE_FLOAT32_C(   618.08), SIMDE_FLOAT32_C(  -734.36), SIMDE_FLOAT32_C(   566.92),
+      SIMDE_FLOAT32_C(   509.02), SIMDE_FLOAT32_C(   -94.17), SIMDE_FLOAT32_C(  -910.22), SIMDE_FLOAT32_C(  -734.84),
+      SIMDE_FLOAT32_C(  -899.16), SIMDE_FLOAT32_C(  -321.48), SIMDE_FLOAT32_C(   569.42), SIMDE_FLOAT32_C(  -945.21),
+      SIMDE_FLOAT32_C(   953.48), SIMDE_FLOAT32_C(  -537.16), SIMDE_FLOAT32_C(   189.89), SIMDE_FLOAT32_C(   960.56),
+      SIMDE_FLOAT32_C(  -839.19), SIMDE_FLOAT32_C(   437.58), SIMDE_FLOAT32_C(  -823.81), SIMDE_FLOAT32_C(   531.10),
+      SIMDE_FLOAT32_C(   655.99), SIMDE_FLOAT32_C(  -969.46), SIMDE_FLOAT32_C(   900.23), SIMDE_FLOAT32_C(  -905.46),
+      SIMDE_FLOAT32_C(  -356.32), SIMDE_FLOAT32_C(   706.76), SIMDE_FLOAT32_C(   671.06), SIMDE_FLOAT32_C(   765.29),
+      SIMDE_FLOAT32_C(   442.88), SIMDE_FLOAT32_C(   683.43), SIMDE_FLOAT32_C(  -338.37), SIMDE_FLOAT32_C(   777.56),
+      SIMDE_FLOAT32_C(   301.51), SIMDE_FLOAT32_C(   -72.73), SIMDE_FLOAT32_C(   344.48), SIMDE_FLOAT32_C(  -189.47),
+      SIMDE_FLOAT32_C(   833.11), SIMDE_FLOAT32_C(   434.25), SIMDE_FLOAT32_C(    75.69), SIMDE_FLOAT32_C(   933.95),
+      SIMDE_FLOAT32_C(  -887.23), SIMDE_FLOAT32_C(  -354.90), SIMDE_FLOAT32_C(   988.74), SIMDE_FLOAT32_C(  -933.75),
+      SIMDE_FLOAT32_C(   107.95), SIMDE_FLOAT32_C(   178.64), SIMDE_FLOAT32_C(  -973.19), SIMDE_FLOAT32_C(   268.75),
+      SIMDE_FLOAT32_C(  -383.79), SIMDE_FLOAT32_C(  -797.00), SIMDE_FLOAT32_C(  -200.15), SIMDE_FLOAT32_C(  -727.80),
+      SIMDE_FLOAT32_C(  -766.45), SIMDE_FLOAT32_C(  -299.91), SIMDE_FLOAT32_C(  -633.26), SIMDE_FLOAT32_C(  -122.77),
+      SIMDE_FLOAT32_C(  -593.16), SIMDE_FLOAT32_C(  -962.20), SIMDE_FLOAT32_C(  -357.48) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(   849.72), SIMDE_FLOAT32_C(   721.24), SIMDE_FLOAT32_C(   304.15), SIMDE_FLOAT32_C(   627.28),
+      SIMDE_FLOAT32_C(    22.75), SIMDE_FLOAT32_C(  -768.58), SIMDE_FLOAT32_C(   -28.25), SIMDE_FLOAT32_C(   833.27),
+      SIMDE_FLOAT32_C(  -935.47), SIMDE_FLOAT32_C(  -593.99), SIMDE_FLOAT32_C(   -91.04), SIMDE_FLOAT32_C(   998.48),
+      SIMDE_FLOAT32_C(  -481.22), SIMDE_FLOAT32_C(   554.07), SIMDE_FLOAT32_C(   987.22), SIMDE_FLOAT32_C(  -414.97),
+      SIMDE_FLOAT32_C(  -337.99), SIMDE_FLOAT32_C(   165.86), SIMDE_FLOAT32_C(  -388.16), SIMDE_FLOAT32_C(   930.77),
+      SIMDE_FLOAT32_C(   782.07), SIMDE_FLOAT32_C(  -185.16), SIMDE_FLOAT32_C(  -269.38), SIMDE_FLOAT32_C(  -945.73),
+      SIMDE_FLOAT32_C(    48.39), SIMDE_FLOAT32_C(   430.71), SIMDE_FLOAT32_C(  -578.99), SIMDE_FLOAT32_C(   925.61),
+      SIMDE_FLOAT32_C(   837.55), SIMDE_FLOAT32_C(  -541.18), SIMDE_FLOAT32_C(  -431.87), SIMDE_FLOAT32_C(   687.27),
+      SIMDE_FLOAT32_C(  -819.95), SIMDE_FLOAT32_C(   872.28), SIMDE_FLOAT32_C(   314.55), SIMDE_FLOAT32_C(   202.80),
+      SIMDE_FLOAT32_C(  -896.29), SIMDE_FLOAT32_C(  -713.70), SIMDE_FLOAT32_C(    36.07), SIMDE_FLOAT32_C(  -831.76),
+      SIMDE_FLOAT32_C(  -307.69), SIMDE_FLOAT32_C(   945.03), SIMDE_FLOAT32_C(  -833.28), SIMDE_FLOAT32_C(   211.09),
+      SIMDE_FLOAT32_C(   499.10), SIMDE_FLOAT32_C(  -846.06), SIMDE_FLOAT32_C(   796.12), SIMDE_FLOAT32_C(  -838.89),
+      SIMDE_FLOAT32_C(   319.80), SIMDE_FLOAT32_C(  -592.05), SIMDE_FLOAT32_C(  -908.12), SIMDE_FLOAT32_C(   101.87),
+      SIMDE_FLOAT32_C(   222.79), SIMDE_FLOAT32_C(  -177.50), SIMDE_FLOAT32_C(   156.14), SIMDE_FLOAT32_C(  -728.82),
+      SIMDE_FLOAT32_C(  -746.79), SIMDE_FLOAT32_C(   577.15), SIMDE_FLOAT32_C(  -803.21), SIMDE_FLOAT32_C(  -909.24),
+      SIMDE_FLOAT32_C(  -964.03), SIMDE_FLOAT32_C(  -235.08), SIMDE_FLOAT32_C(   778.03), SIMDE_FLOAT32_C(  -783.97),
+      SIMDE_FLOAT32_C(  -362.79), SIMDE_FLOAT32_C(    92.58), SIMDE_FLOAT32_C(   418.83), SIMDE_FLOAT32_C(  -259.08),
+      SIMDE_FLOAT32_C(   378.88), SIMDE_FLOAT32_C(  -545.10), SIMDE_FLOAT32_C(   -90.85), SIMDE_FLOAT32_C(  -928.80),
+      SIMDE_FLOAT32_C(  -600.06), SIMDE_FLOAT32_C(    75.87), SIMDE_FLOAT32_C(   282.29), SIMDE_FLOAT32_C(   899.04),
+      SIMDE_FLOAT32_C(   229.81), SIMDE_FLOAT32_C(    78.41), SIMDE_FLOAT32_C(  -939.85), SIMDE_FLOAT32_C(  -450.39),
+      SIMDE_FLOAT32_C(   486.36), SIMDE_FLOAT32_C(  -847.97), SIMDE_FLOAT32_C(   651.48), SIMDE_FLOAT32_C(  -290.85),
+      SIMDE_FLOAT32_C(   -25.47), SIMDE_FLOAT32_C(  -192.38), SIMDE_FLOAT32_C(   -19.67), SIMDE_FLOAT32_C(   227.74),
+      SIMDE_FLOAT32_C(  -615.23), SIMDE_FLOAT32_C(   177.12), SIMDE_FLOAT32_C(   318.50), SIMDE_FLOAT32_C(  -579.26),
+      SIMDE_FLOAT32_C(   942.05), SIMDE_FLOAT32_C(    96.53), SIMDE_FLOAT32_C(  -363.23), SIMDE_FLOAT32_C(  -420.74),
+      SIMDE_FLOAT32_C(  -810.89), SIMDE_FLOAT32_C(  -944.41), SIMDE_FLOAT32_C(   320.17), SIMDE_FLOAT32_C(   567.99),
+      SIMDE_FLOAT32_C(  -489.51), SIMDE_FLOAT32_C(  -770.67), SIMDE_FLOAT32_C(   639.19), SIMDE_FLOAT32_C(   -89.57),
+      SIMDE_FLOAT32_C(   305.20), SIMDE_FLOAT32_C(   -78.52), SIMDE_FLOAT32_C(  -190.54), SIMDE_FLOAT32_C(  -464.99),
+      SIMDE_FLOAT32_C(   999.89), SIMDE_FLOAT32_C(  -130.39), SIMDE_FLOAT32_C(    84.62), SIMDE_FLOAT32_C(   486.25),
+      SIMDE_FLOAT32_C(    21.64), SIMDE_FLOAT32_C(  -263.90), SIMDE_FLOAT32_C(  -804.60), SIMDE_FLOAT32_C(   996.17),
+      SIMDE_FLOAT32_C(   543.72), SIMDE_FLOAT32_C(   175.73), SIMDE_FLOAT32_C(   223.91), SIMDE_FLOAT32_C(   928.49),
+      SIMDE_FLOAT32_C(  -647.14), SIMDE_FLOAT32_C(  -457.59), SIMDE_FLOAT32_C(  -650.77), SIMDE_FLOAT32_C(  -705.10),
+      SIMDE_FLOAT32_C(   638.93), SIMDE_FLOAT32_C(   -14.01), SIMDE_FLOAT32_C(  -125.84), SIMDE_FLOAT32_C(   828.04),
+      SIMDE_FLOAT32_C(    41.58), SIMDE_FLOAT32_C(  -805.67), SIMDE_FLOAT32_C(   396.03), SIMDE_FLOAT32_C(   552.07),
+      SIMDE_FLOAT32_C(  -576.34), SIMDE_FLOAT32_C(    35.22), SIMDE_FLOAT32_C(  -537.50) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   304.15), SIMDE_FLOAT32_C(   627.28),
+      SIMDE_FLOAT32_C(   430.18), SIMDE_FLOAT32_C(   326.51), SIMDE_FLOAT32_C(   -28.25), SIMDE_FLOAT32_C(   833.27),
+      SIMDE_FLOAT32_C(  -561.44), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   749.67), SIMDE_FLOAT32_C(   998.48),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   594.56), SIMDE_FLOAT32_C(   165.86), SIMDE_FLOAT32_C(  -388.16), SIMDE_FLOAT32_C(   930.77),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -134.80), SIMDE_FLOAT32_C(  -269.38), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -313.78), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   837.55), SIMDE_FLOAT32_C(  -267.87), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -791.46), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   970.72), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -713.70), SIMDE_FLOAT32_C(    36.07), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -401.44), SIMDE_FLOAT32_C(   796.12), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   890.94), SIMDE_FLOAT32_C(  -359.80), SIMDE_FLOAT32_C(   101.87),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   156.14), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   577.15), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   135.10),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   697.96), SIMDE_FLOAT32_C(   778.03), SIMDE_FLOAT32_C(  -783.97),
+      SIMDE_FLOAT32_C(   370.29), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   854.35), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   378.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   576.52),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   618.08), SIMDE_FLOAT32_C(  -734.36), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   509.02), SIMDE_FLOAT32_C(   -94.17), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -192.38), SIMDE_FLOAT32_C(   569.42), SIMDE_FLOAT32_C(   227.74),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   177.12), SIMDE_FLOAT32_C(   318.50), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   942.05), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -363.23), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -944.41), SIMDE_FLOAT32_C(   900.23), SIMDE_FLOAT32_C(   567.99),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   706.76), SIMDE_FLOAT32_C(   671.06), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   442.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -190.54), SIMDE_FLOAT32_C(   777.56),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -72.73), SIMDE_FLOAT32_C(   344.48), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   833.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   543.72), SIMDE_FLOAT32_C(   175.73), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   107.95), SIMDE_FLOAT32_C(   178.64), SIMDE_FLOAT32_C(  -650.77), SIMDE_FLOAT32_C(   268.75),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -14.01), SIMDE_FLOAT32_C(  -125.84), SIMDE_FLOAT32_C(   828.04),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   396.03), SIMDE_FLOAT32_C(   552.07),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    35.22), SIMDE_FLOAT32_C(  -357.48) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_f32_z(pv, av, bv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+
+    ev = simde_svmax_f32_z(pv, av, bv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -783.43), SIMDE_FLOAT32_C(   587.14), SIMDE_FLOAT32_C(   784.90), SIMDE_FLOAT32_C(   445.47),
+      SIMDE_FLOAT32_C(  -139.29), SIMDE_FLOAT32_C(   885.64), SIMDE_FLOAT32_C(   871.52), SIMDE_FLOAT32_C(  -951.32),
+      SIMDE_FLOAT32_C(  -780.69), SIMDE_FLOAT32_C(  -522.65), SIMDE_FLOAT32_C(  -385.98), SIMDE_FLOAT32_C(   274.05),
+      SIMDE_FLOAT32_C(   269.11), SIMDE_FLOAT32_C(   441.13), SIMDE_FLOAT32_C(  -655.27), SIMDE_FLOAT32_C(   -33.88),
+      SIMDE_FLOAT32_C(    26.07), SIMDE_FLOAT32_C(  -625.16), SIMDE_FLOAT32_C(   422.67), SIMDE_FLOAT32_C(   237.25),
+      SIMDE_FLOAT32_C(   993.17), SIMDE_FLOAT32_C(  -371.91), SIMDE_FLOAT32_C(  -548.79), SIMDE_FLOAT32_C(   384.13),
+      SIMDE_FLOAT32_C(   713.20), SIMDE_FLOAT32_C(   864.70), SIMDE_FLOAT32_C(   761.91), SIMDE_FLOAT32_C(   921.93),
+      SIMDE_FLOAT32_C(   711.66), SIMDE_FLOAT32_C(  -648.80), SIMDE_FLOAT32_C(  -259.78), SIMDE_FLOAT32_C(   928.23),
+      SIMDE_FLOAT32_C(   938.34), SIMDE_FLOAT32_C(  -474.88), SIMDE_FLOAT32_C(   373.70), SIMDE_FLOAT32_C(  -200.94),
+      SIMDE_FLOAT32_C(  -589.24), SIMDE_FLOAT32_C(   245.22), SIMDE_FLOAT32_C(  -152.26), SIMDE_FLOAT32_C(  -369.93),
+      SIMDE_FLOAT32_C(   722.56), SIMDE_FLOAT32_C(   461.76), SIMDE_FLOAT32_C(   904.12), SIMDE_FLOAT32_C(    -8.33),
+      SIMDE_FLOAT32_C(   -97.11), SIMDE_FLOAT32_C(  -751.15), SIMDE_FLOAT32_C(   957.79), SIMDE_FLOAT32_C(   928.96),
+      SIMDE_FLOAT32_C(  -376.32), SIMDE_FLOAT32_C(   380.46), SIMDE_FLOAT32_C(   166.21), SIMDE_FLOAT32_C(  -383.14),
+      SIMDE_FLOAT32_C(  -991.45), SIMDE_FLOAT32_C(   617.42), SIMDE_FLOAT32_C(  -999.01), SIMDE_FLOAT32_C(   721.74),
+      SIMDE_FLOAT32_C(   482.12), SIMDE_FLOAT32_C(   762.90), SIMDE_FLOAT32_C(   643.67), SIMDE_FLOAT32_C(   193.78),
+      SIMDE_FLOAT32_C(  -885.90), SIMDE_FLOAT32_C(  -616.11), SIMDE_FLOAT32_C(   122.01), SIMDE_FLOAT32_C(  -947.56),
+      SIMDE_FLOAT32_C(   -90.99), SIMDE_FLOAT32_C(  -504.29), SIMDE_FLOAT32_C(  -148.50), SIMDE_FLOAT32_C(   319.77),
+      SIMDE_FLOAT32_C(   740.93), SIMDE_FLOAT32_C(   699.23), SIMDE_FLOAT32_C(   949.83), SIMDE_FLOAT32_C(   463.49),
+      SIMDE_FLOAT32_C(   160.99), SIMDE_FLOAT32_C(   853.95), SIMDE_FLOAT32_C(  -544.84), SIMDE_FLOAT32_C(  -936.12),
+      SIMDE_FLOAT32_C(  -897.21), SIMDE_FLOAT32_C(  -587.05), SIMDE_FLOAT32_C(   992.84), SIMDE_FLOAT32_C(  -273.52),
+      SIMDE_FLOAT32_C(   793.41), SIMDE_FLOAT32_C(   159.06), SIMDE_FLOAT32_C(   343.33), SIMDE_FLOAT32_C(   801.96),
+      SIMDE_FLOAT32_C(  -223.52), SIMDE_FLOAT32_C(   344.32), SIMDE_FLOAT32_C(   523.70), SIMDE_FLOAT32_C(  -741.40),
+      SIMDE_FLOAT32_C(   107.22), SIMDE_FLOAT32_C(   167.37), SIMDE_FLOAT32_C(   452.38), SIMDE_FLOAT32_C(   221.32),
+      SIMDE_FLOAT32_C(   551.27), SIMDE_FLOAT32_C(  -425.61), SIMDE_FLOAT32_C(   273.76), SIMDE_FLOAT32_C(  -539.73),
+      SIMDE_FLOAT32_C(    70.09), SIMDE_FLOAT32_C(  -874.75), SIMDE_FLOAT32_C(   780.04), SIMDE_FLOAT32_C(  -188.98),
+      SIMDE_FLOAT32_C(   824.49), SIMDE_FLOAT32_C(   729.87), SIMDE_FLOAT32_C(  -725.49), SIMDE_FLOAT32_C(   -14.52),
+      SIMDE_FLOAT32_C(   583.82), SIMDE_FLOAT32_C(  -270.34), SIMDE_FLOAT32_C(    49.36), SIMDE_FLOAT32_C(   686.61),
+      SIMDE_FLOAT32_C(   142.61), SIMDE_FLOAT32_C(    42.21), SIMDE_FLOAT32_C(  -586.91), SIMDE_FLOAT32_C(   -63.98),
+      SIMDE_FLOAT32_C(  -798.74), SIMDE_FLOAT32_C(   756.43), SIMDE_FLOAT32_C(  -262.03), SIMDE_FLOAT32_C(   -22.26),
+      SIMDE_FLOAT32_C(   100.75), SIMDE_FLOAT32_C(  -738.33), SIMDE_FLOAT32_C(   236.34), SIMDE_FLOAT32_C(  -792.03),
+      SIMDE_FLOAT32_C(   429.05), SIMDE_FLOAT32_C(  -311.28), SIMDE_FLOAT32_C(   429.29), SIMDE_FLOAT32_C(   -19.69),
+      SIMDE_FLOAT32_C(   263.10), SIMDE_FLOAT32_C(  -296.96), SIMDE_FLOAT32_C(   440.59), SIMDE_FLOAT32_C(  -666.80),
+      SIMDE_FLOAT32_C(  -171.71), SIMDE_FLOAT32_C(   220.63), SIMDE_FLOAT32_C(   144.22), SIMDE_FLOAT32_C(  -347.22),
+      SIMDE_FLOAT32_C(   -49.50), SIMDE_FLOAT32_C(   418.72), SIMDE_FLOAT32_C(   638.26), SIMDE_FLOAT32_C(  -465.68),
+      SIMDE_FLOAT32_C(  -851.61), SIMDE_FLOAT32_C(  -312.37), SIMDE_FLOAT32_C(  -779.07), SIMDE_FLOAT32_C(   291.00),
+      SIMDE_FLOAT32_C(   729.83), SIMDE_FLOAT32_C(  -365.97), SIMDE_FLOAT32_C(  -772.98), SIMDE_FLOAT32_C(   931.10),
+      SIMDE_FLOAT32_C(  -609.55), SIMDE_FLOAT32_C(   -35.01), SIMDE_FLOAT32_C(   -91.16), SIMDE_FLOAT32_C(   491.20),
+      SIMDE_FLOAT32_C(   226.67), SIMDE_FLOAT32_C(  -854.82), SIMDE_FLOAT32_C(   699.17), SIMDE_FLOAT32_C(  -344.28),
+      SIMDE_FLOAT32_C(  -166.11), SIMDE_FLOAT32_C(   128.45), SIMDE_FLOAT32_C(   636.03), SIMDE_FLOAT32_C(  -903.00),
+      SIMDE_FLOAT32_C(   831.49), SIMDE_FLOAT32_C(    76.62), SIMDE_FLOAT32_C(  -569.81), SIMDE_FLOAT32_C(  -340.21),
+      SIMDE_FLOAT32_C(  -702.75), SIMDE_FLOAT32_C(   574.41), SIMDE_FLOAT32_C(   312.57), SIMDE_FLOAT32_C(   247.74),
+      SIMDE_FLOAT32_C(    -6.87), SIMDE_FLOAT32_C(   -49.17), SIMDE_FLOAT32_C(   782.06), SIMDE_FLOAT32_C(   141.52),
+      SIMDE_FLOAT32_C(   638.45), SIMDE_FLOAT32_C(  -997.00), SIMDE_FLOAT32_C(  -567.48), SIMDE_FLOAT32_C(   368.29),
+      SIMDE_FLOAT32_C(  -362.98), SIMDE_FLOAT32_C(  -340.46), SIMDE_FLOAT32_C(   299.38), SIMDE_FLOAT32_C(    27.47),
+      SIMDE_FLOAT32_C(   624.54), SIMDE_FLOAT32_C(  -791.78), SIMDE_FLOAT32_C(  -481.33), SIMDE_FLOAT32_C(  -148.80),
+      SIMDE_FLOAT32_C(  -646.60), SIMDE_FLOAT32_C(  -782.16), SIMDE_FLOAT32_C(   506.92), SIMDE_FLOAT32_C(   187.29),
+      SIMDE_FLOAT32_C(   346.29), SIMDE_FLOAT32_C(   142.95), SIMDE_FLOAT32_C(   284.29), SIMDE_FLOAT32_C(   177.78),
+      SIMDE_FLOAT32_C(  -780.43), SIMDE_FLOAT32_C(   714.48), SIMDE_FLOAT32_C(   837.57), SIMDE_FLOAT32_C(  -483.18) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(   288.89), SIMDE_FLOAT32_C(   150.14), SIMDE_FLOAT32_C(   764.56), SIMDE_FLOAT32_C(  -717.98),
+      SIMDE_FLOAT32_C(  -899.04), SIMDE_FLOAT32_C(   546.63), SIMDE_FLOAT32_C(   423.54), SIMDE_FLOAT32_C(   739.42),
+      SIMDE_FLOAT32_C(   549.62), SIMDE_FLOAT32_C(   856.06), SIMDE_FLOAT32_C(   107.70), SIMDE_FLOAT32_C(  -813.36),
+      SIMDE_FLOAT32_C(  -484.40), SIMDE_FLOAT32_C(  -592.92), SIMDE_FLOAT32_C(   214.12), SIMDE_FLOAT32_C(  -859.87),
+      SIMDE_FLOAT32_C(  -384.70), SIMDE_FLOAT32_C(   732.79), SIMDE_FLOAT32_C(    -8.66), SIMDE_FLOAT32_C(   -31.30),
+      SIMDE_FLOAT32_C(   950.63), SIMDE_FLOAT32_C(  -501.74), SIMDE_FLOAT32_C(  -844.01), SIMDE_FLOAT32_C(   296.92),
+      SIMDE_FLOAT32_C(   641.21), SIMDE_FLOAT32_C(   440.28), SIMDE_FLOAT32_C(  -525.30), SIMDE_FLOAT32_C(   860.79),
+      SIMDE_FLOAT32_C(   154.76), SIMDE_FLOAT32_C(  -687.73), SIMDE_FLOAT32_C(  -622.39), SIMDE_FLOAT32_C(  -556.36),
+      SIMDE_FLOAT32_C(   462.40), SIMDE_FLOAT32_C(  -857.83), SIMDE_FLOAT32_C(  -274.34), SIMDE_FLOAT32_C(   563.36),
+      SIMDE_FLOAT32_C(   688.80), SIMDE_FLOAT32_C(  -850.81), SIMDE_FLOAT32_C(   302.78), SIMDE_FLOAT32_C(   238.42),
+      SIMDE_FLOAT32_C(  -994.75), SIMDE_FLOAT32_C(  -589.52), SIMDE_FLOAT32_C(   425.06), SIMDE_FLOAT32_C(  -479.15),
+      SIMDE_FLOAT32_C(  -182.43), SIMDE_FLOAT32_C(  -360.82), SIMDE_FLOAT32_C(  -339.02), SIMDE_FLOAT32_C(   432.87),
+      SIMDE_FLOAT32_C(  -628.03), SIMDE_FLOAT32_C(   652.31), SIMDE_FLOAT32_C(  -598.43), SIMDE_FLOAT32_C(  -677.40),
+      SIMDE_FLOAT32_C(  -849.43), SIMDE_FLOAT32_C(  -442.44), SIMDE_FLOAT32_C(   619.51), SIMDE_FLOAT32_C(   791.78),
+      SIMDE_FLOAT32_C(   997.84), SIMDE_FLOAT32_C(  -905.79), SIMDE_FLOAT32_C(   652.57), SIMDE_FLOAT32_C(   152.60),
+      SIMDE_FLOAT32_C(  -593.52), SIMDE_FLOAT32_C(  -969.83), SIMDE_FLOAT32_C(   596.24), SIMDE_FLOAT32_C(   868.88),
+      SIMDE_FLOAT32_C(  -827.66), SIMDE_FLOAT32_C(  -678.10), SIMDE_FLOAT32_C(   432.24), SIMDE_FLOAT32_C(   861.14),
+      SIMDE_FLOAT32_C(  -528.90), SIMDE_FLOAT32_C(  -264.98), SIMDE_FLOAT32_C(    99.56), SIMDE_FLOAT32_C(  -523.65),
+      SIMDE_FLOAT32_C(   145.51), SIMDE_FLOAT32_C(  -475.37), SIMDE_FLOAT32_C(    -2.81), SIMDE_FLOAT32_C(   963.07),
+      SIMDE_FLOAT32_C(   163.81), SIMDE_FLOAT32_C(   658.17), SIMDE_FLOAT32_C(   395.94), SIMDE_FLOAT32_C(   535.78),
+      SIMDE_FLOAT32_C(   310.48), SIMDE_FLOAT32_C(   797.51), SIMDE_FLOAT32_C(   858.38), SIMDE_FLOAT32_C(   461.05),
+      SIMDE_FLOAT32_C(  -644.92), SIMDE_FLOAT32_C(   477.89), SIMDE_FLOAT32_C(   252.83), SIMDE_FLOAT32_C(  -647.08),
+      SIMDE_FLOAT32_C(   572.10), SIMDE_FLOAT32_C(   -94.60), SIMDE_FLOAT32_C(   505.51), SIMDE_FLOAT32_C(   978.57),
+      SIMDE_FLOAT32_C(   -64.43), SIMDE_FLOAT32_C(   101.76), SIMDE_FLOAT32_C(   847.45), SIMDE_FLOAT32_C(   107.92),
+      SIMDE_FLOAT32_C(   423.66), SIMDE_FLOAT32_C(   279.69), SIMDE_FLOAT32_C(   -30.94), SIMDE_FLOAT32_C(   894.75),
+      SIMDE_FLOAT32_C(  -985.28), SIMDE_FLOAT32_C(  -931.38), SIMDE_FLOAT32_C(  -628.90), SIMDE_FLOAT32_C(   160.22),
+      SIMDE_FLOAT32_C(  -406.75), SIMDE_FLOAT32_C(   368.29), SIMDE_FLOAT32_C(   123.30), SIMDE_FLOAT32_C(   757.06),
+      SIMDE_FLOAT32_C(    26.46), SIMDE_FLOAT32_C(  -480.76), SIMDE_FLOAT32_C(   292.84), SIMDE_FLOAT32_C(  -663.06),
+      SIMDE_FLOAT32_C(  -683.24), SIMDE_FLOAT32_C(   151.21), SIMDE_FLOAT32_C(   797.99), SIMDE_FLOAT32_C(  -328.17),
+      SIMDE_FLOAT32_C(  -370.90), SIMDE_FLOAT32_C(    50.82), SIMDE_FLOAT32_C(    24.75), SIMDE_FLOAT32_C(  -798.80),
+      SIMDE_FLOAT32_C(   956.22), SIMDE_FLOAT32_C(  -469.74), SIMDE_FLOAT32_C(  -820.22), SIMDE_FLOAT32_C(  -108.21),
+      SIMDE_FLOAT32_C(   632.02), SIMDE_FLOAT32_C(  -972.77), SIMDE_FLOAT32_C(   999.71), SIMDE_FLOAT32_C(    55.68),
+      SIMDE_FLOAT32_C(   306.92), SIMDE_FLOAT32_C(   -31.23), SIMDE_FLOAT32_C(   -49.57), SIMDE_FLOAT32_C(   321.64),
+      SIMDE_FLOAT32_C(    37.39), SIMDE_FLOAT32_C(   321.53), SIMDE_FLOAT32_C(  -518.14), SIMDE_FLOAT32_C(   630.64),
+      SIMDE_FLOAT32_C(  -310.19), SIMDE_FLOAT32_C(   605.16), SIMDE_FLOAT32_C(   387.70), SIMDE_FLOAT32_C(   716.27),
+      SIMDE_FLOAT32_C(  -875.60), SIMDE_FLOAT32_C(  -319.47), SIMDE_FLOAT32_C(  -946.79), SIMDE_FLOAT32_C(  -558.84),
+      SIMDE_FLOAT32_C(   831.75), SIMDE_FLOAT32_C(   851.20), SIMDE_FLOAT32_C(   112.99), SIMDE_FLOAT32_C(  -539.15),
+      SIMDE_FLOAT32_C(   -97.98), SIMDE_FLOAT32_C(  -862.26), SIMDE_FLOAT32_C(  -337.95), SIMDE_FLOAT32_C(  -141.76),
+      SIMDE_FLOAT32_C(  -332.00), SIMDE_FLOAT32_C(  -158.17), SIMDE_FLOAT32_C(   750.03), SIMDE_FLOAT32_C(  -699.98),
+      SIMDE_FLOAT32_C(  -130.95), SIMDE_FLOAT32_C(   749.74), SIMDE_FLOAT32_C(   355.70), SIMDE_FLOAT32_C(  -824.03),
+      SIMDE_FLOAT32_C(  -281.48), SIMDE_FLOAT32_C(  -693.88), SIMDE_FLOAT32_C(   497.61), SIMDE_FLOAT32_C(   755.91),
+      SIMDE_FLOAT32_C(   627.65), SIMDE_FLOAT32_C(   979.47), SIMDE_FLOAT32_C(   386.55), SIMDE_FLOAT32_C(  -682.53),
+      SIMDE_FLOAT32_C(   584.63), SIMDE_FLOAT32_C(  -225.75), SIMDE_FLOAT32_C(  -966.26), SIMDE_FLOAT32_C(   709.03),
+      SIMDE_FLOAT32_C(   454.78), SIMDE_FLOAT32_C(  -913.05), SIMDE_FLOAT32_C(  -849.82), SIMDE_FLOAT32_C(   286.53),
+      SIMDE_FLOAT32_C(   938.14), SIMDE_FLOAT32_C(   263.17), SIMDE_FLOAT32_C(   747.38), SIMDE_FLOAT32_C(  -159.84),
+      SIMDE_FLOAT32_C(   400.91), SIMDE_FLOAT32_C(  -590.57), SIMDE_FLOAT32_C(   698.39), SIMDE_FLOAT32_C(  -931.09),
+      SIMDE_FLOAT32_C(   251.26), SIMDE_FLOAT32_C(   448.43), SIMDE_FLOAT32_C(  -631.07), SIMDE_FLOAT32_C(  -879.69),
+      SIMDE_FLOAT32_C(   198.17), SIMDE_FLOAT32_C(   724.63), SIMDE_FLOAT32_C(  -703.72), SIMDE_FLOAT32_C(   916.69) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(   288.89), SIMDE_FLOAT32_C(   587.14), SIMDE_FLOAT32_C(   784.90), SIMDE_FLOAT32_C(   445.47),
+      SIMDE_FLOAT32_C(  -139.29), SIMDE_FLOAT32_C(   885.64), SIMDE_FLOAT32_C(   871.52), SIMDE_FLOAT32_C(  -951.32),
+      SIMDE_FLOAT32_C(  -780.69), SIMDE_FLOAT32_C(   856.06), SIMDE_FLOAT32_C(   107.70), SIMDE_FLOAT32_C(   274.05),
+      SIMDE_FLOAT32_C(   269.11), SIMDE_FLOAT32_C(   441.13), SIMDE_FLOAT32_C(   214.12), SIMDE_FLOAT32_C(   -33.88),
+      SIMDE_FLOAT32_C(    26.07), SIMDE_FLOAT32_C(  -625.16), SIMDE_FLOAT32_C(   422.67), SIMDE_FLOAT32_C(   237.25),
+      SIMDE_FLOAT32_C(   993.17), SIMDE_FLOAT32_C(  -371.91), SIMDE_FLOAT32_C(  -548.79), SIMDE_FLOAT32_C(   384.13),
+      SIMDE_FLOAT32_C(   713.20), SIMDE_FLOAT32_C(   864.70), SIMDE_FLOAT32_C(   761.91), SIMDE_FLOAT32_C(   921.93),
+      SIMDE_FLOAT32_C(   711.66), SIMDE_FLOAT32_C(  -648.80), SIMDE_FLOAT32_C(  -259.78), SIMDE_FLOAT32_C(   928.23),
+      SIMDE_FLOAT32_C(   938.34), SIMDE_FLOAT32_C(  -474.88), SIMDE_FLOAT32_C(   373.70), SIMDE_FLOAT32_C(   563.36),
+      SIMDE_FLOAT32_C(  -589.24), SIMDE_FLOAT32_C(   245.22), SIMDE_FLOAT32_C(   302.78), SIMDE_FLOAT32_C(  -369.93),
+      SIMDE_FLOAT32_C(   722.56), SIMDE_FLOAT32_C(   461.76), SIMDE_FLOAT32_C(   904.12), SIMDE_FLOAT32_C(    -8.33),
+      SIMDE_FLOAT32_C(   -97.11), SIMDE_FLOAT32_C(  -751.15), SIMDE_FLOAT32_C(   957.79), SIMDE_FLOAT32_C(   928.96),
+      SIMDE_FLOAT32_C(  -376.32), SIMDE_FLOAT32_C(   380.46), SIMDE_FLOAT32_C(   166.21), SIMDE_FLOAT32_C(  -383.14),
+      SIMDE_FLOAT32_C(  -991.45), SIMDE_FLOAT32_C(   617.42), SIMDE_FLOAT32_C(   619.51), SIMDE_FLOAT32_C(   791.78),
+      SIMDE_FLOAT32_C(   997.84), SIMDE_FLOAT32_C(   762.90), SIMDE_FLOAT32_C(   652.57), SIMDE_FLOAT32_C(   193.78),
+      SIMDE_FLOAT32_C(  -593.52), SIMDE_FLOAT32_C(  -616.11), SIMDE_FLOAT32_C(   596.24), SIMDE_FLOAT32_C(  -947.56),
+      SIMDE_FLOAT32_C(   -90.99), SIMDE_FLOAT32_C(  -504.29), SIMDE_FLOAT32_C(  -148.50), SIMDE_FLOAT32_C(   319.77),
+      SIMDE_FLOAT32_C(   740.93), SIMDE_FLOAT32_C(   699.23), SIMDE_FLOAT32_C(   949.83), SIMDE_FLOAT32_C(   463.49),
+      SIMDE_FLOAT32_C(   160.99), SIMDE_FLOAT32_C(   853.95), SIMDE_FLOAT32_C(  -544.84), SIMDE_FLOAT32_C(   963.07),
+      SIMDE_FLOAT32_C(  -897.21), SIMDE_FLOAT32_C(  -587.05), SIMDE_FLOAT32_C(   992.84), SIMDE_FLOAT32_C(  -273.52),
+      SIMDE_FLOAT32_C(   793.41), SIMDE_FLOAT32_C(   797.51), SIMDE_FLOAT32_C(   343.33), SIMDE_FLOAT32_C(   801.96),
+      SIMDE_FLOAT32_C(  -223.52), SIMDE_FLOAT32_C(   344.32), SIMDE_FLOAT32_C(   523.70), SIMDE_FLOAT32_C(  -647.08),
+      SIMDE_FLOAT32_C(   572.10), SIMDE_FLOAT32_C(   167.37), SIMDE_FLOAT32_C(   452.38), SIMDE_FLOAT32_C(   221.32),
+      SIMDE_FLOAT32_C(   551.27), SIMDE_FLOAT32_C(  -425.61), SIMDE_FLOAT32_C(   273.76), SIMDE_FLOAT32_C(  -539.73),
+      SIMDE_FLOAT32_C(   423.66), SIMDE_FLOAT32_C(  -874.75), SIMDE_FLOAT32_C(   780.04), SIMDE_FLOAT32_C(  -188.98),
+      SIMDE_FLOAT32_C(   824.49), SIMDE_FLOAT32_C(   729.87), SIMDE_FLOAT32_C(  -725.49), SIMDE_FLOAT32_C(   160.22),
+      SIMDE_FLOAT32_C(   583.82), SIMDE_FLOAT32_C(  -270.34), SIMDE_FLOAT32_C(    49.36), SIMDE_FLOAT32_C(   757.06),
+      SIMDE_FLOAT32_C(   142.61), SIMDE_FLOAT32_C(    42.21), SIMDE_FLOAT32_C(  -586.91), SIMDE_FLOAT32_C(   -63.98),
+      SIMDE_FLOAT32_C(  -683.24), SIMDE_FLOAT32_C(   756.43), SIMDE_FLOAT32_C(   797.99), SIMDE_FLOAT32_C(   -22.26),
+      SIMDE_FLOAT32_C(   100.75), SIMDE_FLOAT32_C(  -738.33), SIMDE_FLOAT32_C(   236.34), SIMDE_FLOAT32_C(  -792.03),
+      SIMDE_FLOAT32_C(   956.22), SIMDE_FLOAT32_C(  -311.28), SIMDE_FLOAT32_C(   429.29), SIMDE_FLOAT32_C(   -19.69),
+      SIMDE_FLOAT32_C(   632.02), SIMDE_FLOAT32_C(  -296.96), SIMDE_FLOAT32_C(   999.71), SIMDE_FLOAT32_C(    55.68),
+      SIMDE_FLOAT32_C(  -171.71), SIMDE_FLOAT32_C(   220.63), SIMDE_FLOAT32_C(   144.22), SIMDE_FLOAT32_C(  -347.22),
+      SIMDE_FLOAT32_C(   -49.50), SIMDE_FLOAT32_C(   418.72), SIMDE_FLOAT32_C(   638.26), SIMDE_FLOAT32_C(   630.64),
+      SIMDE_FLOAT32_C(  -310.19), SIMDE_FLOAT32_C(   605.16), SIMDE_FLOAT32_C(  -779.07), SIMDE_FLOAT32_C(   716.27),
+      SIMDE_FLOAT32_C(   729.83), SIMDE_FLOAT32_C(  -365.97), SIMDE_FLOAT32_C(  -772.98), SIMDE_FLOAT32_C(   931.10),
+      SIMDE_FLOAT32_C(  -609.55), SIMDE_FLOAT32_C(   851.20), SIMDE_FLOAT32_C(   -91.16), SIMDE_FLOAT32_C(   491.20),
+      SIMDE_FLOAT32_C(   226.67), SIMDE_FLOAT32_C(  -854.82), SIMDE_FLOAT32_C(   699.17), SIMDE_FLOAT32_C(  -344.28),
+      SIMDE_FLOAT32_C(  -166.11), SIMDE_FLOAT32_C(   128.45), SIMDE_FLOAT32_C(   750.03), SIMDE_FLOAT32_C(  -699.98),
+      SIMDE_FLOAT32_C(   831.49), SIMDE_FLOAT32_C(   749.74), SIMDE_FLOAT32_C(  -569.81), SIMDE_FLOAT32_C(  -340.21),
+      SIMDE_FLOAT32_C(  -702.75), SIMDE_FLOAT32_C(   574.41), SIMDE_FLOAT32_C(   312.57), SIMDE_FLOAT32_C(   755.91),
+      SIMDE_FLOAT32_C(    -6.87), SIMDE_FLOAT32_C(   979.47), SIMDE_FLOAT32_C(   782.06), SIMDE_FLOAT32_C(   141.52),
+      SIMDE_FLOAT32_C(   638.45), SIMDE_FLOAT32_C(  -225.75), SIMDE_FLOAT32_C(  -567.48), SIMDE_FLOAT32_C(   709.03),
+      SIMDE_FLOAT32_C(   454.78), SIMDE_FLOAT32_C(  -340.46), SIMDE_FLOAT32_C(   299.38), SIMDE_FLOAT32_C(   286.53),
+      SIMDE_FLOAT32_C(   938.14), SIMDE_FLOAT32_C(  -791.78), SIMDE_FLOAT32_C(  -481.33), SIMDE_FLOAT32_C(  -148.80),
+      SIMDE_FLOAT32_C(   400.91), SIMDE_FLOAT32_C(  -782.16), SIMDE_FLOAT32_C(   506.92), SIMDE_FLOAT32_C(   187.29),
+      SIMDE_FLOAT32_C(   346.29), SIMDE_FLOAT32_C(   142.95), SIMDE_FLOAT32_C(   284.29), SIMDE_FLOAT32_C(   177.78),
+      SIMDE_FLOAT32_C(   198.17), SIMDE_FLOAT32_C(   724.63), SIMDE_FLOAT32_C(   837.57), SIMDE_FLOAT32_C(   916.69) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_f32_m(pv, av, bv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+
+    ev = simde_svmax_f32_m(pv, av, bv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(    98.41), SIMDE_FLOAT64_C(  -799.06), SIMDE_FLOAT64_C(  -368.93), SIMDE_FLOAT64_C(  -592.92),
+      SIMDE_FLOAT64_C(  -907.06), SIMDE_FLOAT64_C(   368.52), SIMDE_FLOAT64_C(  -770.42), SIMDE_FLOAT64_C(  -872.28),
+      SIMDE_FLOAT64_C(     5.96), SIMDE_FLOAT64_C(  -893.52), SIMDE_FLOAT64_C(     6.35), SIMDE_FLOAT64_C(   850.69),
+      SIMDE_FLOAT64_C(  -449.36), SIMDE_FLOAT64_C(   115.41), SIMDE_FLOAT64_C(   265.28), SIMDE_FLOAT64_C(  -719.01),
+      SIMDE_FLOAT64_C(  -783.28), SIMDE_FLOAT64_C(   688.80), SIMDE_FLOAT64_C(   581.55), SIMDE_FLOAT64_C(  -253.23),
+      SIMDE_FLOAT64_C(   378.59), SIMDE_FLOAT64_C(    -2.17), SIMDE_FLOAT64_C(  -781.31), SIMDE_FLOAT64_C(  -676.42),
+      SIMDE_FLOAT64_C(  -549.13), SIMDE_FLOAT64_C(  -450.14), SIMDE_FLOAT64_C(  -418.32), SIMDE_FLOAT64_C(   -19.96),
+      SIMDE_FLOAT64_C(   980.35), SIMDE_FLOAT64_C(  -387.19), SIMDE_FLOAT64_C(   984.20), SIMDE_FLOAT64_C(    78.76),
+      SIMDE_FLOAT64_C(  -186.26), SIMDE_FLOAT64_C(  -384.72), SIMDE_FLOAT64_C(   485.84), SIMDE_FLOAT64_C(   -93.32),
+      SIMDE_FLOAT64_C(   983.80), SIMDE_FLOAT64_C(   715.42), SIMDE_FLOAT64_C(    34.40), SIMDE_FLOAT64_C(   -10.24),
+      SIMDE_FLOAT64_C(   821.90), SIMDE_FLOAT64_C(  -959.25), SIMDE_FLOAT64_C(  -159.55), SIMDE_FLOAT64_C(  -627.46),
+      SIMDE_FLOAT64_C(   156.16), SIMDE_FLOAT64_C(  -894.28), SIMDE_FLOAT64_C(  -346.47), SIMDE_FLOAT64_C(   372.87),
+      SIMDE_FLOAT64_C(   794.52), SIMDE_FLOAT64_C(  -764.93), SIMDE_FLOAT64_C(  -880.35), SIMDE_FLOAT64_C(   173.11),
+      SIMDE_FLOAT64_C(   232.91), SIMDE_FLOAT64_C(  -661.66), SIMDE_FLOAT64_C(   496.68), SIMDE_FLOAT64_C(   683.77),
+      SIMDE_FLOAT64_C(  -111.80), SIMDE_FLOAT64_C(  -921.64), SIMDE_FLOAT64_C(  -336.18), SIMDE_FLOAT64_C(  -131.45),
+      SIMDE_FLOAT64_C(  -308.83), SIMDE_FLOAT64_C(  -351.98), SIMDE_FLOAT64_C(   947.32), SIMDE_FLOAT64_C(   504.91),
+      SIMDE_FLOAT64_C(   263.30), SIMDE_FLOAT64_C(   433.16), SIMDE_FLOAT64_C(  -588.41), SIMDE_FLOAT64_C(   247.09),
+      SIMDE_FLOAT64_C(   148.58), SIMDE_FLOAT64_C(   445.99), SIMDE_FLOAT64_C(  -763.14), SIMDE_FLOAT64_C(   -29.51),
+      SIMDE_FLOAT64_C(   486.74), SIMDE_FLOAT64_C(    77.30), SIMDE_FLOAT64_C(   343.03), SIMDE_FLOAT64_C(  -357.11),
+      SIMDE_FLOAT64_C(   183.03), SIMDE_FLOAT64_C(   996.56), SIMDE_FLOAT64_C(  -984.23), SIMDE_FLOAT64_C(   -22.45),
+      SIMDE_FLOAT64_C(  -768.37), SIMDE_FLOAT64_C(  -864.59), SIMDE_FLOAT64_C(  -849.34), SIMDE_FLOAT64_C(   464.54),
+      SIMDE_FLOAT64_C(  -526.25), SIMDE_FLOAT64_C(   647.34), SIMDE_FLOAT64_C(   148.31), SIMDE_FLOAT64_C(   361.95),
+      SIMDE_FLOAT64_C(   725.71), SIMDE_FLOAT64_C(   812.13), SIMDE_FLOAT64_C(  -769.49), SIMDE_FLOAT64_C(  -583.12),
+      SIMDE_FLOAT64_C(  -539.85), SIMDE_FLOAT64_C(  -822.17), SIMDE_FLOAT64_C(   921.79), SIMDE_FLOAT64_C(   723.44),
+      SIMDE_FLOAT64_C(   610.99), SIMDE_FLOAT64_C(  -666.62), SIMDE_FLOAT64_C(   -29.46), SIMDE_FLOAT64_C(  -240.43),
+      SIMDE_FLOAT64_C(   779.37), SIMDE_FLOAT64_C(   207.39), SIMDE_FLOAT64_C(   730.05), SIMDE_FLOAT64_C(   266.10),
+      SIMDE_FLOAT64_C(  -715.30) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(    73.08), SIMDE_FLOAT64_C(   909.00), SIMDE_FLOAT64_C(   467.72), SIMDE_FLOAT64_C(    69.64),
+      SIMDE_FLOAT64_C(   924.77), SIMDE_FLOAT64_C(  -554.73), SIMDE_FLOAT64_C(   301.27), SIMDE_FLOAT64_C(  -939.82),
+      SIMDE_FLOAT64_C(  -404.07), SIMDE_FLOAT64_C(  -234.20), SIMDE_FLOAT64_C(  -466.07), SIMDE_FLOAT64_C(  -756.73),
+      SIMDE_FLOAT64_C(   914.11), SIMDE_FLOAT64_C(   895.89), SIMDE_FLOAT64_C(   968.98), SIMDE_FLOAT64_C(   726.24),
+      SIMDE_FLOAT64_C(  -873.61), SIMDE_FLOAT64_C(  -614.15), SIMDE_FLOAT64_C(  -813.61), SIMDE_FLOAT64_C(  -695.78),
+      SIMDE_FLOAT64_C(  -692.36), SIMDE_FLOAT64_C(   909.83), SIMDE_FLOAT64_C(   915.21), SIMDE_FLOAT64_C(  -358.98),
+      SIMDE_FLOAT64_C(  -119.63), SIMDE_FLOAT64_C(  -325.23), SIMDE_FLOAT64_C(  -579.61), SIMDE_FLOAT64_C(  -912.23),
+      SIMDE_FLOAT64_C(  -595.17), SIMDE_FLOAT64_C(   686.49), SIMDE_FLOAT64_C(  -627.54), SIMDE_FLOAT64_C(   477.91),
+      SIMDE_FLOAT64_C(   595.49), SIMDE_FLOAT64_C(   840.19), SIMDE_FLOAT64_C(  -452.46), SIMDE_FLOAT64_C(   520.26),
+      SIMDE_FLOAT64_C(  -714.54), SIMDE_FLOAT64_C(   848.81), SIMDE_FLOAT64_C(   580.43), SIMDE_FLOAT64_C(  -118.61),
+      SIMDE_FLOAT64_C(  -385.39), SIMDE_FLOAT64_C(  -885.63), SIMDE_FLOAT64_C(   124.66), SIMDE_FLOAT64_C(  -471.28),
+      SIMDE_FLOAT64_C(  -989.75), SIMDE_FLOAT64_C(    93.63), SIMDE_FLOAT64_C(  -745.04), SIMDE_FLOAT64_C(  -863.36),
+      SIMDE_FLOAT64_C(   479.49), SIMDE_FLOAT64_C(  -558.65), SIMDE_FLOAT64_C(  -559.13), SIMDE_FLOAT64_C(   787.13),
+      SIMDE_FLOAT64_C(  -648.81), SIMDE_FLOAT64_C(  -643.93), SIMDE_FLOAT64_C(  -571.85), SIMDE_FLOAT64_C(   231.56),
+      SIMDE_FLOAT64_C(    30.85), SIMDE_FLOAT64_C(  -151.46), SIMDE_FLOAT64_C(   319.32), SIMDE_FLOAT64_C(   435.67),
+      SIMDE_FLOAT64_C(  -464.97), SIMDE_FLOAT64_C(   691.79), SIMDE_FLOAT64_C(   -86.42), SIMDE_FLOAT64_C(  -869.48),
+      SIMDE_FLOAT64_C(   531.97), SIMDE_FLOAT64_C(   461.12), SIMDE_FLOAT64_C(   650.78), SIMDE_FLOAT64_C(   817.43),
+      SIMDE_FLOAT64_C(   309.93), SIMDE_FLOAT64_C(   231.21), SIMDE_FLOAT64_C(  -301.18), SIMDE_FLOAT64_C(   924.54),
+      SIMDE_FLOAT64_C(   345.58), SIMDE_FLOAT64_C(   823.48), SIMDE_FLOAT64_C(  -546.74), SIMDE_FLOAT64_C(   355.83),
+      SIMDE_FLOAT64_C(   -82.89), SIMDE_FLOAT64_C(  -291.77), SIMDE_FLOAT64_C(   492.47), SIMDE_FLOAT64_C(  -603.40),
+      SIMDE_FLOAT64_C(   149.58), SIMDE_FLOAT64_C(   933.34), SIMDE_FLOAT64_C(  -816.27), SIMDE_FLOAT64_C(   500.77),
+      SIMDE_FLOAT64_C(  -710.59), SIMDE_FLOAT64_C(  -388.12), SIMDE_FLOAT64_C(  -267.67), SIMDE_FLOAT64_C(   320.26),
+      SIMDE_FLOAT64_C(   460.42), SIMDE_FLOAT64_C(  -948.35), SIMDE_FLOAT64_C(  -244.07), SIMDE_FLOAT64_C(   995.45),
+      SIMDE_FLOAT64_C(   743.44), SIMDE_FLOAT64_C(   669.51), SIMDE_FLOAT64_C(  -874.02), SIMDE_FLOAT64_C(   275.41),
+      SIMDE_FLOAT64_C(   130.63), SIMDE_FLOAT64_C(   776.75), SIMDE_FLOAT64_C(    92.84), SIMDE_FLOAT64_C(  -559.44),
+      SIMDE_FLOAT64_C(     7.97), SIMDE_FLOAT64_C(   791.66), SIMDE_FLOAT64_C(  -634.90), SIMDE_FLOAT64_C(  -646.45),
+      SIMDE_FLOAT64_C(   615.14) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(    98.41), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   368.52), SIMDE_FLOAT64_C(   301.27), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     6.35), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   914.11), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   968.98), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -783.28), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -253.23),
+      SIMDE_FLOAT64_C(   378.59), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -19.96),
+      SIMDE_FLOAT64_C(   980.35), SIMDE_FLOAT64_C(   686.49), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   485.84), SIMDE_FLOAT64_C(   520.26),
+      SIMDE_FLOAT64_C(   983.80), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   580.43), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -471.28),
+      SIMDE_FLOAT64_C(   156.16), SIMDE_FLOAT64_C(    93.63), SIMDE_FLOAT64_C(  -346.47), SIMDE_FLOAT64_C(   372.87),
+      SIMDE_FLOAT64_C(   794.52), SIMDE_FLOAT64_C(  -558.65), SIMDE_FLOAT64_C(  -559.13), SIMDE_FLOAT64_C(   787.13),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -643.93), SIMDE_FLOAT64_C(   496.68), SIMDE_FLOAT64_C(   683.77),
+      SIMDE_FLOAT64_C(    30.85), SIMDE_FLOAT64_C(  -151.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -308.83), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   504.91),
+      SIMDE_FLOAT64_C(   531.97), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   650.78), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -301.18), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   486.74), SIMDE_FLOAT64_C(   823.48), SIMDE_FLOAT64_C(   343.03), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -22.45),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   933.34), SIMDE_FLOAT64_C(  -816.27), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -526.25), SIMDE_FLOAT64_C(   647.34), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   812.13), SIMDE_FLOAT64_C(  -244.07), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   669.51), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    92.84), SIMDE_FLOAT64_C(  -240.43),
+      SIMDE_FLOAT64_C(   779.37), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   266.10),
+      SIMDE_FLOAT64_C(   615.14) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_f64_z(pv, av, bv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+
+    ev = simde_svmax_f64_z(pv, av, bv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(  -392.81), SIMDE_FLOAT64_C(   283.66), SIMDE_FLOAT64_C(  -775.34), SIMDE_FLOAT64_C(  -376.21),
+      SIMDE_FLOAT64_C(  -790.97), SIMDE_FLOAT64_C(  -105.70), SIMDE_FLOAT64_C(    30.11), SIMDE_FLOAT64_C(   217.84),
+      SIMDE_FLOAT64_C(  -332.16), SIMDE_FLOAT64_C(   469.65), SIMDE_FLOAT64_C(   532.72), SIMDE_FLOAT64_C(  -667.96),
+      SIMDE_FLOAT64_C(  -822.87), SIMDE_FLOAT64_C(  -450.53), SIMDE_FLOAT64_C(   174.62), SIMDE_FLOAT64_C(  -175.09),
+      SIMDE_FLOAT64_C(   688.59), SIMDE_FLOAT64_C(  -773.47), SIMDE_FLOAT64_C(  -273.45), SIMDE_FLOAT64_C(   665.98),
+      SIMDE_FLOAT64_C(   859.56), SIMDE_FLOAT64_C(  -462.10), SIMDE_FLOAT64_C(  -967.07), SIMDE_FLOAT64_C(  -797.08),
+      SIMDE_FLOAT64_C(  -654.04), SIMDE_FLOAT64_C(  -745.80), SIMDE_FLOAT64_C(   142.23), SIMDE_FLOAT64_C(   773.43),
+      SIMDE_FLOAT64_C(  -281.53), SIMDE_FLOAT64_C(   891.36), SIMDE_FLOAT64_C(  -336.83), SIMDE_FLOAT64_C(   325.66),
+      SIMDE_FLOAT64_C(   175.02), SIMDE_FLOAT64_C(  -112.17), SIMDE_FLOAT64_C(   949.45), SIMDE_FLOAT64_C(   384.06),
+      SIMDE_FLOAT64_C(   782.13), SIMDE_FLOAT64_C(   -20.45), SIMDE_FLOAT64_C(  -398.10), SIMDE_FLOAT64_C(  -550.03),
+      SIMDE_FLOAT64_C(  -550.80), SIMDE_FLOAT64_C(  -865.39), SIMDE_FLOAT64_C(  -217.99), SIMDE_FLOAT64_C(  -373.67),
+      SIMDE_FLOAT64_C(  -315.92), SIMDE_FLOAT64_C(   956.63), SIMDE_FLOAT64_C(   451.25), SIMDE_FLOAT64_C(  -627.33),
+      SIMDE_FLOAT64_C(  -816.85), SIMDE_FLOAT64_C(  -822.21), SIMDE_FLOAT64_C(  -961.35), SIMDE_FLOAT64_C(  -957.29),
+      SIMDE_FLOAT64_C(  -284.30), SIMDE_FLOAT64_C(  -928.42), SIMDE_FLOAT64_C(  -754.37), SIMDE_FLOAT64_C(    61.66),
+      SIMDE_FLOAT64_C(  -674.21), SIMDE_FLOAT64_C(   387.86), SIMDE_FLOAT64_C(  -164.91), SIMDE_FLOAT64_C(    44.26),
+      SIMDE_FLOAT64_C(   279.22), SIMDE_FLOAT64_C(   498.26), SIMDE_FLOAT64_C(  -630.08), SIMDE_FLOAT64_C(  -545.76),
+      SIMDE_FLOAT64_C(  -613.91), SIMDE_FLOAT64_C(  -680.64), SIMDE_FLOAT64_C(   838.30), SIMDE_FLOAT64_C(  -831.78),
+      SIMDE_FLOAT64_C(   298.92), SIMDE_FLOAT64_C(  -559.80), SIMDE_FLOAT64_C(  -381.80), SIMDE_FLOAT64_C(   748.12),
+      SIMDE_FLOAT64_C(  -425.19), SIMDE_FLOAT64_C(   400.20), SIMDE_FLOAT64_C(  -625.55), SIMDE_FLOAT64_C(   258.89),
+      SIMDE_FLOAT64_C(   356.83), SIMDE_FLOAT64_C(   825.70), SIMDE_FLOAT64_C(   631.57), SIMDE_FLOAT64_C(   539.99),
+      SIMDE_FLOAT64_C(  -996.51), SIMDE_FLOAT64_C(   670.22), SIMDE_FLOAT64_C(   582.70), SIMDE_FLOAT64_C(  -280.81),
+      SIMDE_FLOAT64_C(   741.80), SIMDE_FLOAT64_C(   828.33), SIMDE_FLOAT64_C(   780.85), SIMDE_FLOAT64_C(  -932.41),
+      SIMDE_FLOAT64_C(   216.19), SIMDE_FLOAT64_C(  -384.06), SIMDE_FLOAT64_C(   111.84), SIMDE_FLOAT64_C(  -504.60),
+      SIMDE_FLOAT64_C(  -885.80), SIMDE_FLOAT64_C(   481.76), SIMDE_FLOAT64_C(   -50.35), SIMDE_FLOAT64_C(  -499.71),
+      SIMDE_FLOAT64_C(   801.12), SIMDE_FLOAT64_C(  -212.05), SIMDE_FLOAT64_C(  -331.49), SIMDE_FLOAT64_C(   100.04),
+      SIMDE_FLOAT64_C(   228.14), SIMDE_FLOAT64_C(   286.71), SIMDE_FLOAT64_C(  -151.84), SIMDE_FLOAT64_C(   802.95),
+      SIMDE_FLOAT64_C(  -313.09), SIMDE_FLOAT64_C(   222.61), SIMDE_FLOAT64_C(    61.84), SIMDE_FLOAT64_C(  -956.26),
+      SIMDE_FLOAT64_C(    48.31), SIMDE_FLOAT64_C(  -306.59), SIMDE_FLOAT64_C(   583.73), SIMDE_FLOAT64_C(    51.81),
+      SIMDE_FLOAT64_C(  -636.38), SIMDE_FLOAT64_C(   166.43), SIMDE_FLOAT64_C(   771.00), SIMDE_FLOAT64_C(  -894.58),
+      SIMDE_FLOAT64_C(    -5.24), SIMDE_FLOAT64_C(   551.84), SIMDE_FLOAT64_C(  -826.99), SIMDE_FLOAT64_C(  -789.05),
+      SIMDE_FLOAT64_C(  -832.22), SIMDE_FLOAT64_C(   284.85), SIMDE_FLOAT64_C(  -293.65), SIMDE_FLOAT64_C(  -718.02),
+      SIMDE_FLOAT64_C(  -233.39) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(   656.00), SIMDE_FLOAT64_C(  -217.73), SIMDE_FLOAT64_C(  -432.27), SIMDE_FLOAT64_C(  -556.05),
+      SIMDE_FLOAT64_C(   450.78), SIMDE_FLOAT64_C(   667.77), SIMDE_FLOAT64_C(   672.09), SIMDE_FLOAT64_C(  -262.52),
+      SIMDE_FLOAT64_C(  -484.06), SIMDE_FLOAT64_C(   475.04), SIMDE_FLOAT64_C(   424.40), SIMDE_FLOAT64_C(   738.55),
+      SIMDE_FLOAT64_C(  -463.12), SIMDE_FLOAT64_C(   468.14), SIMDE_FLOAT64_C(  -213.14), SIMDE_FLOAT64_C(   230.29),
+      SIMDE_FLOAT64_C(    51.87), SIMDE_FLOAT64_C(   838.67), SIMDE_FLOAT64_C(   593.91), SIMDE_FLOAT64_C(  -781.70),
+      SIMDE_FLOAT64_C(   609.66), SIMDE_FLOAT64_C(   699.33), SIMDE_FLOAT64_C(   213.07), SIMDE_FLOAT64_C(   161.51),
+      SIMDE_FLOAT64_C(   872.34), SIMDE_FLOAT64_C(   424.02), SIMDE_FLOAT64_C(   329.29), SIMDE_FLOAT64_C(   157.19),
+      SIMDE_FLOAT64_C(  -869.63), SIMDE_FLOAT64_C(   611.27), SIMDE_FLOAT64_C(   923.80), SIMDE_FLOAT64_C(   786.37),
+      SIMDE_FLOAT64_C(  -606.46), SIMDE_FLOAT64_C(  -508.47), SIMDE_FLOAT64_C(  -769.69), SIMDE_FLOAT64_C(   844.32),
+      SIMDE_FLOAT64_C(  -840.69), SIMDE_FLOAT64_C(   902.40), SIMDE_FLOAT64_C(  -418.19), SIMDE_FLOAT64_C(  -324.76),
+      SIMDE_FLOAT64_C(   377.44), SIMDE_FLOAT64_C(  -993.80), SIMDE_FLOAT64_C(  -586.21), SIMDE_FLOAT64_C(   914.32),
+      SIMDE_FLOAT64_C(   474.34), SIMDE_FLOAT64_C(   200.65), SIMDE_FLOAT64_C(   144.60), SIMDE_FLOAT64_C(  -473.79),
+      SIMDE_FLOAT64_C(    39.32), SIMDE_FLOAT64_C(  -261.49), SIMDE_FLOAT64_C(  -255.49), SIMDE_FLOAT64_C(  -351.02),
+      SIMDE_FLOAT64_C(  -562.16), SIMDE_FLOAT64_C(   957.58), SIMDE_FLOAT64_C(   810.49), SIMDE_FLOAT64_C(  -689.82),
+      SIMDE_FLOAT64_C(   381.60), SIMDE_FLOAT64_C(   139.78), SIMDE_FLOAT64_C(   467.37), SIMDE_FLOAT64_C(   511.96),
+      SIMDE_FLOAT64_C(  -248.95), SIMDE_FLOAT64_C(   391.17), SIMDE_FLOAT64_C(   298.33), SIMDE_FLOAT64_C(   144.59),
+      SIMDE_FLOAT64_C(   882.70), SIMDE_FLOAT64_C(   528.65), SIMDE_FLOAT64_C(   -11.08), SIMDE_FLOAT64_C(  -958.00),
+      SIMDE_FLOAT64_C(   431.05), SIMDE_FLOAT64_C(   570.72), SIMDE_FLOAT64_C(  -282.75), SIMDE_FLOAT64_C(  -191.51),
+      SIMDE_FLOAT64_C(   576.92), SIMDE_FLOAT64_C(   131.04), SIMDE_FLOAT64_C(  -277.19), SIMDE_FLOAT64_C(    51.27),
+      SIMDE_FLOAT64_C(  -668.31), SIMDE_FLOAT64_C(   867.41), SIMDE_FLOAT64_C(   577.48), SIMDE_FLOAT64_C(   371.01),
+      SIMDE_FLOAT64_C(  -394.08), SIMDE_FLOAT64_C(  -678.01), SIMDE_FLOAT64_C(  -980.01), SIMDE_FLOAT64_C(    43.76),
+      SIMDE_FLOAT64_C(  -720.43), SIMDE_FLOAT64_C(   830.48), SIMDE_FLOAT64_C(   353.94), SIMDE_FLOAT64_C(   661.17),
+      SIMDE_FLOAT64_C(   -29.74), SIMDE_FLOAT64_C(  -178.69), SIMDE_FLOAT64_C(   173.13), SIMDE_FLOAT64_C(   721.31),
+      SIMDE_FLOAT64_C(  -787.53), SIMDE_FLOAT64_C(  -528.53), SIMDE_FLOAT64_C(  -134.10), SIMDE_FLOAT64_C(  -904.83),
+      SIMDE_FLOAT64_C(  -999.89), SIMDE_FLOAT64_C(   854.82), SIMDE_FLOAT64_C(  -862.82), SIMDE_FLOAT64_C(   431.16),
+      SIMDE_FLOAT64_C(   425.54), SIMDE_FLOAT64_C(  -145.58), SIMDE_FLOAT64_C(  -760.35), SIMDE_FLOAT64_C(     2.47),
+      SIMDE_FLOAT64_C(   985.46), SIMDE_FLOAT64_C(   -37.54), SIMDE_FLOAT64_C(  -946.27), SIMDE_FLOAT64_C(  -682.85),
+      SIMDE_FLOAT64_C(  -170.13), SIMDE_FLOAT64_C(   631.21), SIMDE_FLOAT64_C(   688.15), SIMDE_FLOAT64_C(   435.79),
+      SIMDE_FLOAT64_C(   953.20), SIMDE_FLOAT64_C(   708.14), SIMDE_FLOAT64_C(  -520.45), SIMDE_FLOAT64_C(  -767.23),
+      SIMDE_FLOAT64_C(   538.62), SIMDE_FLOAT64_C(   833.49), SIMDE_FLOAT64_C(   893.94), SIMDE_FLOAT64_C(  -491.13),
+      SIMDE_FLOAT64_C(  -345.21), SIMDE_FLOAT64_C(    67.07), SIMDE_FLOAT64_C(  -769.82), SIMDE_FLOAT64_C(  -132.73),
+      SIMDE_FLOAT64_C(   538.54) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(  -392.81), SIMDE_FLOAT64_C(   283.66), SIMDE_FLOAT64_C(  -432.27), SIMDE_FLOAT64_C(  -376.21),
+      SIMDE_FLOAT64_C(  -790.97), SIMDE_FLOAT64_C(  -105.70), SIMDE_FLOAT64_C(    30.11), SIMDE_FLOAT64_C(   217.84),
+      SIMDE_FLOAT64_C(  -332.16), SIMDE_FLOAT64_C(   469.65), SIMDE_FLOAT64_C(   532.72), SIMDE_FLOAT64_C(  -667.96),
+      SIMDE_FLOAT64_C(  -463.12), SIMDE_FLOAT64_C(  -450.53), SIMDE_FLOAT64_C(   174.62), SIMDE_FLOAT64_C(   230.29),
+      SIMDE_FLOAT64_C(   688.59), SIMDE_FLOAT64_C(  -773.47), SIMDE_FLOAT64_C(   593.91), SIMDE_FLOAT64_C(   665.98),
+      SIMDE_FLOAT64_C(   859.56), SIMDE_FLOAT64_C(   699.33), SIMDE_FLOAT64_C(  -967.07), SIMDE_FLOAT64_C(   161.51),
+      SIMDE_FLOAT64_C(  -654.04), SIMDE_FLOAT64_C(   424.02), SIMDE_FLOAT64_C(   142.23), SIMDE_FLOAT64_C(   773.43),
+      SIMDE_FLOAT64_C(  -281.53), SIMDE_FLOAT64_C(   891.36), SIMDE_FLOAT64_C(   923.80), SIMDE_FLOAT64_C(   325.66),
+      SIMDE_FLOAT64_C(   175.02), SIMDE_FLOAT64_C(  -112.17), SIMDE_FLOAT64_C(   949.45), SIMDE_FLOAT64_C(   384.06),
+      SIMDE_FLOAT64_C(   782.13), SIMDE_FLOAT64_C(   -20.45), SIMDE_FLOAT64_C(  -398.10), SIMDE_FLOAT64_C(  -550.03),
+      SIMDE_FLOAT64_C(  -550.80), SIMDE_FLOAT64_C(  -865.39), SIMDE_FLOAT64_C(  -217.99), SIMDE_FLOAT64_C(   914.32),
+      SIMDE_FLOAT64_C(  -315.92), SIMDE_FLOAT64_C(   956.63), SIMDE_FLOAT64_C(   451.25), SIMDE_FLOAT64_C(  -627.33),
+      SIMDE_FLOAT64_C(    39.32), SIMDE_FLOAT64_C(  -822.21), SIMDE_FLOAT64_C(  -961.35), SIMDE_FLOAT64_C(  -351.02),
+      SIMDE_FLOAT64_C(  -284.30), SIMDE_FLOAT64_C(  -928.42), SIMDE_FLOAT64_C(  -754.37), SIMDE_FLOAT64_C(    61.66),
+      SIMDE_FLOAT64_C(   381.60), SIMDE_FLOAT64_C(   387.86), SIMDE_FLOAT64_C(  -164.91), SIMDE_FLOAT64_C(   511.96),
+      SIMDE_FLOAT64_C(   279.22), SIMDE_FLOAT64_C(   498.26), SIMDE_FLOAT64_C(  -630.08), SIMDE_FLOAT64_C(   144.59),
+      SIMDE_FLOAT64_C(   882.70), SIMDE_FLOAT64_C(   528.65), SIMDE_FLOAT64_C(   838.30), SIMDE_FLOAT64_C(  -831.78),
+      SIMDE_FLOAT64_C(   298.92), SIMDE_FLOAT64_C(  -559.80), SIMDE_FLOAT64_C(  -381.80), SIMDE_FLOAT64_C(   748.12),
+      SIMDE_FLOAT64_C(  -425.19), SIMDE_FLOAT64_C(   400.20), SIMDE_FLOAT64_C(  -277.19), SIMDE_FLOAT64_C(   258.89),
+      SIMDE_FLOAT64_C(   356.83), SIMDE_FLOAT64_C(   825.70), SIMDE_FLOAT64_C(   631.57), SIMDE_FLOAT64_C(   539.99),
+      SIMDE_FLOAT64_C(  -394.08), SIMDE_FLOAT64_C(   670.22), SIMDE_FLOAT64_C(   582.70), SIMDE_FLOAT64_C(  -280.81),
+      SIMDE_FLOAT64_C(   741.80), SIMDE_FLOAT64_C(   828.33), SIMDE_FLOAT64_C(   780.85), SIMDE_FLOAT64_C(  -932.41),
+      SIMDE_FLOAT64_C(   216.19), SIMDE_FLOAT64_C(  -384.06), SIMDE_FLOAT64_C(   111.84), SIMDE_FLOAT64_C(  -504.60),
+      SIMDE_FLOAT64_C(  -885.80), SIMDE_FLOAT64_C(   481.76), SIMDE_FLOAT64_C(   -50.35), SIMDE_FLOAT64_C(  -499.71),
+      SIMDE_FLOAT64_C(   801.12), SIMDE_FLOAT64_C(  -212.05), SIMDE_FLOAT64_C(  -331.49), SIMDE_FLOAT64_C(   100.04),
+      SIMDE_FLOAT64_C(   228.14), SIMDE_FLOAT64_C(   286.71), SIMDE_FLOAT64_C(  -151.84), SIMDE_FLOAT64_C(   802.95),
+      SIMDE_FLOAT64_C(  -313.09), SIMDE_FLOAT64_C(   222.61), SIMDE_FLOAT64_C(    61.84), SIMDE_FLOAT64_C(  -682.85),
+      SIMDE_FLOAT64_C(    48.31), SIMDE_FLOAT64_C(  -306.59), SIMDE_FLOAT64_C(   583.73), SIMDE_FLOAT64_C(   435.79),
+      SIMDE_FLOAT64_C(   953.20), SIMDE_FLOAT64_C(   708.14), SIMDE_FLOAT64_C(   771.00), SIMDE_FLOAT64_C(  -767.23),
+      SIMDE_FLOAT64_C(   538.62), SIMDE_FLOAT64_C(   833.49), SIMDE_FLOAT64_C(  -826.99), SIMDE_FLOAT64_C(  -789.05),
+      SIMDE_FLOAT64_C(  -832.22), SIMDE_FLOAT64_C(   284.85), SIMDE_FLOAT64_C(  -293.65), SIMDE_FLOAT64_C(  -718.02),
+      SIMDE_FLOAT64_C(  -233.39) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_f64_m(pv, av, bv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+
+    ev = simde_svmax_f64_m(pv, av, bv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0) };
+  static const int8_t a[] =
+    { -INT8_C(  47),  INT8_C( 107), -INT8_C(  63),  INT8_C(  38), -INT8_C(  48),  INT8_C(  95),  INT8_C(  97),  INT8_C( 117),
+       INT8_C(  58), -INT8_C(  28), -INT8_C(  12),  INT8_C(  79),  INT8_C(  58), -INT8_C(  74), -INT8_C(  40),  INT8_C(  19),
+      -INT8_C(  23), -INT8_C(  81), -INT8_C(  84), -INT8_C(  31),  INT8_C(  56), -INT8_C( 109),  INT8_C(  21), -INT8_C(  24),
+       INT8_C(  36), -INT8_C(  90),  INT8_C(  32), -INT8_C( 127), -INT8_C(  94), -INT8_C(  23),  INT8_C(  63),  INT8_C( 115),
+       INT8_C(  85),  INT8_C(   0), -INT8_C( 103),  INT8_C(  37),  INT8_C(  96), -INT8_C(   5), -INT8_C( 102), -INT8_C( 102),
+      -INT8_C(  33), -INT8_C( 113), -INT8_C(  22),  INT8_C(  25),  INT8_C(  69), -INT8_C(  62),  INT8_C(  44),  INT8_C(  46),
+       INT8_C( 113), -INT8_C(  40),  INT8_C(  16), -INT8_C(  86),  INT8_C( 107),  INT8_C(  37), -INT8_C( 110), -INT8_C( 112),
+      -INT8_C(  53), -INT8_C(  78),  INT8_C(  17),  INT8_C( 109), -INT8_C( 100),  INT8_C(  80), -INT8_C(  31), -INT8_C(  15),
+       INT8_C(  81),  INT8_C( 122),  INT8_C(  22), -INT8_C(  79),  INT8_C( 117), -INT8_C(  79),  INT8_C(  75),  INT8_C(  84),
+       INT8_C(  64),  INT8_C(  53),  INT8_C( 110), -INT8_C( 123), -INT8_C(   8), -INT8_C( 102), -INT8_C(  76),  INT8_C( 105),
+       INT8_C( 115), -INT8_C(  60),  INT8_C(  19), -INT8_C(  34), -INT8_C(  23), -INT8_C(  91),  INT8_C( 110), -INT8_C(  76),
+       INT8_C(  88),      INT8_MAX,  INT8_C(  34), -INT8_C(  12), -INT8_C(  48),  INT8_C(   3), -INT8_C(  27),  INT8_C(  33),
+       INT8_C( 125), -INT8_C(   5), -INT8_C(  46), -INT8_C(  13), -INT8_C(  84),  INT8_C(  29),  INT8_C(  71), -INT8_C(  20),
+       INT8_C(  83), -INT8_C(  75),  INT8_C( 114),  INT8_C(  75),  INT8_C(  80),  INT8_C(  38), -INT8_C(  76), -INT8_C(  61),
+      -INT8_C(  22), -INT8_C(  56), -INT8_C(  95), -INT8_C(  45),  INT8_C( 109),  INT8_C(  16), -INT8_C( 121), -INT8_C(  59),
+      -INT8_C( 113), -INT8_C(  87), -INT8_C(  71),  INT8_C(  95), -INT8_C(  84), -INT8_C(  98),      INT8_MIN,  INT8_C(  42),
+      -INT8_C( 102),  INT8_C(  82),  INT8_C(  29),  INT8_C(  70),  INT8_C( 112),  INT8_C( 100),  INT8_C(  51), -INT8_C(  61),
+       INT8_C(  26), -INT8_C(  91),  INT8_C(  14),  INT8_C( 106), -INT8_C(  53), -INT8_C(  62),  INT8_C(  45), -INT8_C(  75),
+      -INT8_C( 118), -INT8_C(  50), -INT8_C( 120), -INT8_C(   8), -INT8_C(  34),  INT8_C(  15), -INT8_C(  67),  INT8_C( 110),
+      -INT8_C(  71),  INT8_C( 119), -INT8_C(  51),  INT8_C( 101),  INT8_C(  21),  INT8_C(  78), -INT8_C( 113), -INT8_C(  81),
+      -INT8_C(  96), -INT8_C(  84), -INT8_C(  10),  INT8_C(  16),  INT8_C(  17),  INT8_C(  41), -INT8_C(  45),  INT8_C(  43),
+      -INT8_C(  50), -INT8_C(  31), -INT8_C( 107), -INT8_C( 103), -INT8_C(  92), -INT8_C(  62),  INT8_C(  78),  INT8_C(  46),
+      -INT8_C( 112), -INT8_C(  42),  INT8_C(  38),  INT8_C( 111), -INT8_C(  27), -INT8_C(  28), -INT8_C(  35), -INT8_C(  98),
+       INT8_C(  91), -INT8_C(  86),  INT8_C(   4),  INT8_C( 112), -INT8_C(   8), -INT8_C( 109),  INT8_C(  32), -INT8_C( 103),
+       INT8_C(  64),  INT8_C(  22), -INT8_C(  87),  INT8_C(  81),  INT8_C(  63),  INT8_C( 125),  INT8_C( 124),  INT8_C(  13),
+       INT8_C(  94),  INT8_C(  17), -INT8_C(  90),  INT8_C(   2), -INT8_C(  45), -INT8_C(  12),  INT8_C(  49),  INT8_C(  99),
+      -INT8_C(  54),  INT8_C(  87), -INT8_C(  46), -INT8_C(  81),  INT8_C(  59), -INT8_C(  81),  INT8_C(  78), -INT8_C( 106),
+       INT8_C(  90),  INT8_C(  82),  INT8_C(   7),  INT8_C(  82), -INT8_C(  27),  INT8_C(  39), -INT8_C(  21),  INT8_C(  37),
+       INT8_C(  61), -INT8_C( 107),  INT8_C( 118),  INT8_C( 124),  INT8_C(  18), -INT8_C(  14), -INT8_C( 119),  INT8_C( 112),
+       INT8_C(   3),  INT8_C(  47),  INT8_C( 115), -INT8_C(  42),  INT8_C(  35), -INT8_C(  92),  INT8_C(  58), -INT8_C(  19),
+      -INT8_C(   5),  INT8_C(  12), -INT8_C( 100),  INT8_C(  55), -INT8_C(  68), -INT8_C(  22), -INT8_C(  51),  INT8_C(  22),
+       INT8_C(  60), -INT8_C(  44),  INT8_C( 104),  INT8_C(  34), -INT8_C(   5),  INT8_C(  84),  INT8_C(  71),  INT8_C(  56),
+      -INT8_C(  23), -INT8_C(  66), -INT8_C(  76), -INT8_C(   5), -INT8_C(  80),  INT8_C(  61),  INT8_C( 107), -INT8_C(  76),
+       INT8_C( 108), -INT8_C(  34), -INT8_C( 118), -INT8_C( 113), -INT8_C( 126), -INT8_C(  60),  INT8_C( 124),  INT8_C( 126),
+      -INT8_C(  47),  INT8_C(  25), -INT8_C(  75), -INT8_C( 115),  INT8_C(   3), -INT8_C( 126), -INT8_C(  93),  INT8_C(  64),
+       INT8_C(  87),  INT8_C(  11),  INT8_C(  98),  INT8_C(  82),  INT8_C(  95), -INT8_C(  87), -INT8_C( 117),  INT8_C(  72),
+       INT8_C( 103),  INT8_C(  63),  INT8_C(  67),  INT8_C(  24),  INT8_C( 125), -INT8_C(  81), -INT8_C(  52), -INT8_C(  23),
+      -INT8_C( 115),  INT8_C(  86),  INT8_C( 121),  INT8_C(  16),  INT8_C(  27), -INT8_C(  11), -INT8_C( 114), -INT8_C(  20),
+       INT8_C(  14),  INT8_C(  67),  INT8_C( 121),  INT8_C(  18), -INT8_C(  59),  INT8_C(  28),  INT8_C(  82),  INT8_C(  28),
+       INT8_C(  39), -INT8_C(  76),  INT8_C( 111), -INT8_C( 121),  INT8_C(  93), -INT8_C(   6), -INT8_C(  49), -INT8_C(  59),
+       INT8_C(  57),  INT8_C(  19), -INT8_C(  35), -INT8_C(  74), -INT8_C(  62), -INT8_C(  87), -INT8_C(  96),  INT8_C(  79),
+      -INT8_C(   1),  INT8_C(  25),  INT8_C(  95),  INT8_C(  26),  INT8_C(  14), -INT8_C(  19),  INT8_C(   6),  INT8_C(  29),
+       INT8_C(  48),      INT8_MAX,  INT8_C(  47), -INT8_C(  10), -INT8_C( 101), -INT8_C( 127),  INT8_C(  18), -INT8_C(  61),
+       INT8_C(  53), -INT8_C( 127),  INT8_C(  74), -INT8_C( 110),  INT8_C( 123),  INT8_C(  25),  INT8_C(  87), -INT8_C(  75),
+       INT8_C(  44),  INT8_C(  52),  INT8_C( 107), -INT8_C(  18), -INT8_C(  35),  INT8_C(  11),  INT8_C(  62), -INT8_C(  35),
+       INT8_C(  36), -INT8_C(  99), -INT8_C(   9),  INT8_C(  51), -INT8_C( 117), -INT8_C(   2),  INT8_C(  80), -INT8_C(  69),
+       INT8_C( 125),      INT8_MAX, -INT8_C(  79),  INT8_C(  25),  INT8_C(   0), -INT8_C(  60), -INT8_C(  36),  INT8_C(  53),
+       INT8_C(  69),  INT8_C(  38), -INT8_C(  57), -INT8_C(  63),  INT8_C(  63),  INT8_C(  31),  INT8_C( 118),  INT8_C( 108),
+       INT8_C(  83), -INT8_C(  31),  INT8_C(  90),  INT8_C(  49), -INT8_C(  19), -INT8_C( 104),  INT8_C(  14),  INT8_C(  17),
+       INT8_C(  54),  INT8_C(   5),  INT8_C(  68), -INT8_C(  63),  INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C( 127),
+       INT8_C(  19),  INT8_C(  46), -INT8_C( 102),  INT8_C(  19), -INT8_C(  14),  INT8_C( 118),  INT8_C(  72),  INT8_C(  55),
+      -INT8_C( 100),  INT8_C(  16), -INT8_C(   8), -INT8_C(  37),  INT8_C(  47),  INT8_C( 110),  INT8_C(  71), -INT8_C( 126),
+       INT8_C(  80), -INT8_C(  94), -INT8_C(  77),  INT8_C(  61),  INT8_C(  58), -INT8_C(  63),  INT8_C(  78),  INT8_C( 112),
+      -INT8_C(  57), -INT8_C( 109),  INT8_C(  49), -INT8_C(  54),  INT8_C(  39), -INT8_C(  82),  INT8_C(  75),  INT8_C(  59),
+      -INT8_C(  36), -INT8_C(  27),  INT8_C(  78), -INT8_C(  50),  INT8_C(  91), -INT8_C( 105),  INT8_C(   5), -INT8_C(   9),
+      -INT8_C(  89), -INT8_C(   2), -INT8_C(  45), -INT8_C(  42),  INT8_C( 108),  INT8_C(  26),  INT8_C(  88), -INT8_C(  68),
+      -INT8_C(  68),  INT8_C(  12), -INT8_C(   7), -INT8_C(   9), -INT8_C(  51),  INT8_C(  72),  INT8_C( 103), -INT8_C( 108),
+      -INT8_C(  37), -INT8_C( 103),  INT8_C(  95),  INT8_C(   2),  INT8_C(  71), -INT8_C(  86),  INT8_C(  61),  INT8_C(  35),
+      -INT8_C( 112), -INT8_C( 116), -INT8_C(  15), -INT8_C(  21),  INT8_C(  35), -INT8_C(  10), -INT8_C(  29), -INT8_C(  54),
+      -INT8_C(  12), -INT8_C(  74), -INT8_C(  96),  INT8_C(  97), -INT8_C(  48), -INT8_C(   8),  INT8_C(  29), -INT8_C( 115),
+       INT8_C(   4),  INT8_C(  23), -INT8_C( 124), -INT8_C(  46),  INT8_C(  95), -INT8_C(  21),  INT8_C( 102),  INT8_C(  58),
+      -INT8_C( 124), -INT8_C(  59),  INT8_C(  60), -INT8_C(  53),  INT8_C( 112),  INT8_C( 122), -INT8_C(  18),  INT8_C(   0),
+       INT8_C(   6), -INT8_C(  33), -INT8_C(  21),  INT8_C(  41), -INT8_C(  42), -INT8_C(  50), -INT8_C(  13), -INT8_C(  54),
+      -INT8_C( 124), -INT8_C( 109),  INT8_C(  43),  INT8_C(  85), -INT8_C( 117),  INT8_C(  73), -INT8_C(  30), -INT8_C( 112),
+       INT8_C(  96),  INT8_C( 102),  INT8_C(  98), -INT8_C(  65),  INT8_C(  81), -INT8_C(  56), -INT8_C(   7), -INT8_C(  42),
+      -INT8_C( 114),  INT8_C(  53), -INT8_C(  95), -INT8_C(   2), -INT8_C(  81), -INT8_C( 112), -INT8_C(   2), -INT8_C(  75),
+       INT8_C( 111), -INT8_C(  23), -INT8_C(  34),  INT8_C(  69), -INT8_C(  72), -INT8_C(  47),  INT8_C(  16),  INT8_C(  60),
+       INT8_C( 100),  INT8_C(  59), -INT8_C( 111), -INT8_C(  16), -INT8_C( 124),  INT8_C( 115),      INT8_MIN, -INT8_C(  28),
+      -INT8_C(  39), -INT8_C(  30), -INT8_C(  93),  INT8_C(  43), -INT8_C(  86), -INT8_C( 100),  INT8_C(   1),  INT8_C(  56),
+      -INT8_C(  46), -INT8_C(  94),  INT8_C(  54), -INT8_C( 127),  INT8_C(  50),  INT8_C(  52),  INT8_C(  55), -INT8_C(  94),
+       INT8_C(  30),  INT8_C(  21), -INT8_C(  25), -INT8_C(  42), -INT8_C(  25), -INT8_C(   9),  INT8_C(  18),  INT8_C(  75),
+       INT8_C(  51), -INT8_C(  92),  INT8_C(  59), -INT8_C(  73),  INT8_C(  23), -INT8_C(  69), -INT8_C( 100), -INT8_C(  15),
+      -INT8_C(  99),  INT8_C(  63),  INT8_C(  28),  INT8_C(  72), -INT8_C(  36),  INT8_C(  29),      INT8_MIN, -INT8_C(  82),
+      -INT8_C(  65), -INT8_C(  73),  INT8_C(  47), -INT8_C(  14), -INT8_C(  21),  INT8_C( 102), -INT8_C( 108),  INT8_C(   9),
+       INT8_C( 124),  INT8_C( 123), -INT8_C(  33),  INT8_C(  99),  INT8_C( 115), -INT8_C(  14), -INT8_C(  82), -INT8_C(  90),
+      -INT8_C( 106), -INT8_C(  22),  INT8_C(  93), -INT8_C(  83), -INT8_C(  91), -INT8_C(   7), -INT8_C(  98),  INT8_C(  67),
+       INT8_C(  57), -INT8_C(  70), -INT8_C( 117),  INT8_C(  21), -INT8_C(  41),  INT8_C(  11), -INT8_C(  61), -INT8_C( 105),
+      -INT8_C(  62), -INT8_C(  14), -INT8_C( 119), -INT8_C(  82),  INT8_C(  89),  INT8_C(  29), -INT8_C(  73), -INT8_C(  43),
+      -INT8_C( 104), -INT8_C( 105),  INT8_C(  56),  INT8_C(  11), -INT8_C( 119), -INT8_C(  26), -INT8_C(  79),  INT8_C(  31),
+      -INT8_C(  48),  INT8_C(  15), -INT8_C(  52),  INT8_C( 118),  INT8_C(   8),  INT8_C( 107), -INT8_C(  71),  INT8_C(  65),
+       INT8_C(  37),  INT8_C(  68),  INT8_C(  86), -INT8_C(   3),  INT8_C(  79),  INT8_C(  25), -INT8_C( 108),  INT8_C(  18),
+       INT8_C(  12),  INT8_C(  29), -INT8_C(  64),  INT8_C( 101),  INT8_C(  58),  INT8_C( 119),  INT8_C(  58), -INT8_C(  46),
+       INT8_C(  14),  INT8_C( 114), -INT8_C(  34), -INT8_C( 105),  INT8_C(  88), -INT8_C( 113), -INT8_C(  74),  INT8_C(  41),
+      -INT8_C(  98), -INT8_C( 125), -INT8_C(  97), -INT8_C(  89), -INT8_C(  18),  INT8_C(  88), -INT8_C(  24),  INT8_C(  19),
+      -INT8_C( 100),  INT8_C(  63) };
+  static const int8_t b = -INT8_C( 121);
+  static const int8_t e[] =
+    { -INT8_C(  47),  INT8_C(   0), -INT8_C(  63),  INT8_C(  38),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 117),
+       INT8_C(  58), -INT8_C(  28),  INT8_C(   0),  INT8_C(  79),  INT8_C(   0), -INT8_C(  74), -INT8_C(  40),  INT8_C(  19),
+       INT8_C(   0), -INT8_C(  81),  INT8_C(   0), -INT8_C(  31),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  36), -INT8_C(  90),  INT8_C(  32),  INT8_C(   0), -INT8_C(  94), -INT8_C(  23),  INT8_C(  63),  INT8_C( 115),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  96),  INT8_C(   0), -INT8_C( 102), -INT8_C( 102),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  22),  INT8_C(  25),  INT8_C(   0), -INT8_C(  62),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C( 107),  INT8_C(   0), -INT8_C( 110),  INT8_C(   0),
+      -INT8_C(  53), -INT8_C(  78),  INT8_C(  17),  INT8_C( 109), -INT8_C( 100),  INT8_C(   0),  INT8_C(   0), -INT8_C(  15),
+       INT8_C(  81),  INT8_C(   0),  INT8_C(  22), -INT8_C(  79),  INT8_C( 117),  INT8_C(   0),  INT8_C(   0),  INT8_C(  84),
+       INT8_C(  64),  INT8_C(  53),  INT8_C( 110), -INT8_C( 121), -INT8_C(   8), -INT8_C( 102),  INT8_C(   0),  INT8_C( 105),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  19), -INT8_C(  34),  INT8_C(   0), -INT8_C(  91),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  34), -INT8_C(  12), -INT8_C(  48),  INT8_C(   3),  INT8_C(   0),  INT8_C(  33),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  84),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  83), -INT8_C(  75),  INT8_C( 114),  INT8_C(   0),  INT8_C(  80),  INT8_C(  38), -INT8_C(  76), -INT8_C(  61),
+      -INT8_C(  22), -INT8_C(  56), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  59),
+       INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0), -INT8_C(  84), -INT8_C(  98), -INT8_C( 121),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  82),  INT8_C(   0),  INT8_C(  70),  INT8_C(   0),  INT8_C( 100),  INT8_C(  51),  INT8_C(   0),
+       INT8_C(  26), -INT8_C(  91),  INT8_C(   0),  INT8_C(   0), -INT8_C(  53), -INT8_C(  62),  INT8_C(   0), -INT8_C(  75),
+      -INT8_C( 118), -INT8_C(  50), -INT8_C( 120), -INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 110),
+      -INT8_C(  71),  INT8_C( 119), -INT8_C(  51),  INT8_C( 101),  INT8_C(  21),  INT8_C(   0), -INT8_C( 113), -INT8_C(  81),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0), -INT8_C(  45),  INT8_C(  43),
+       INT8_C(   0), -INT8_C(  31), -INT8_C( 107),  INT8_C(   0), -INT8_C(  92), -INT8_C(  62),  INT8_C(  78),  INT8_C(   0),
+      -INT8_C( 112), -INT8_C(  42),  INT8_C(   0),  INT8_C( 111), -INT8_C(  27), -INT8_C(  28),  INT8_C(   0), -INT8_C(  98),
+       INT8_C(   0), -INT8_C(  86),  INT8_C(   0),  INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 103),
+       INT8_C(  64),  INT8_C(  22),  INT8_C(   0),  INT8_C(  81),  INT8_C(  63),  INT8_C( 125),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2), -INT8_C(  45), -INT8_C(  12),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  54),  INT8_C(   0),  INT8_C(   0), -INT8_C(  81),  INT8_C(   0), -INT8_C(  81),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  82),  INT8_C(   0),  INT8_C(  82),  INT8_C(   0),  INT8_C(  39),  INT8_C(   0),  INT8_C(  37),
+       INT8_C(   0), -INT8_C( 107),  INT8_C( 118),  INT8_C(   0),  INT8_C(   0), -INT8_C(  14),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   3),  INT8_C(   0),  INT8_C(   0), -INT8_C(  42),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   5),  INT8_C(   0), -INT8_C( 100),  INT8_C(  55), -INT8_C(  68),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  71),  INT8_C(  56),
+      -INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107), -INT8_C(  76),
+       INT8_C( 108), -INT8_C(  34), -INT8_C( 118),  INT8_C(   0),  INT8_C(   0), -INT8_C(  60),  INT8_C(   0),  INT8_C( 126),
+       INT8_C(   0),  INT8_C(  25),  INT8_C(   0), -INT8_C( 115),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(  64),
+       INT8_C(  87),  INT8_C(   0),  INT8_C(  98),  INT8_C(   0),  INT8_C(  95), -INT8_C(  87), -INT8_C( 117),  INT8_C(  72),
+       INT8_C( 103),  INT8_C(  63),  INT8_C(   0),  INT8_C(  24),  INT8_C(   0), -INT8_C(  81), -INT8_C(  52),  INT8_C(   0),
+      -INT8_C( 115),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20),
+       INT8_C(   0),  INT8_C(  67),  INT8_C( 121),  INT8_C(  18),  INT8_C(   0),  INT8_C(   0),  INT8_C(  82),  INT8_C(   0),
+       INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  93), -INT8_C(   6), -INT8_C(  49), -INT8_C(  59),
+       INT8_C(  57),  INT8_C(  19),  INT8_C(   0), -INT8_C(  74), -INT8_C(  62),  INT8_C(   0), -INT8_C(  96),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(  26),  INT8_C(   0), -INT8_C(  19),  INT8_C(   6),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  10), -INT8_C( 101), -INT8_C( 121),  INT8_C(  18),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 121),  INT8_C(   0), -INT8_C( 110),  INT8_C( 123),  INT8_C(   0),  INT8_C(  87), -INT8_C(  75),
+       INT8_C(   0),  INT8_C(   0),  INT8_C( 107), -INT8_C(  18),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0), -INT8_C(  35),
+       INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51), -INT8_C( 117), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),      INT8_MAX, -INT8_C(  79),  INT8_C(  25),  INT8_C(   0), -INT8_C(  60),  INT8_C(   0),  INT8_C(  53),
+       INT8_C(  69),  INT8_C(   0), -INT8_C(  57),  INT8_C(   0),  INT8_C(  63),  INT8_C(   0),  INT8_C( 118),  INT8_C( 108),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  90),  INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(  14),  INT8_C(  17),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  68),  INT8_C(   0),  INT8_C(   0), -INT8_C( 108),  INT8_C( 124), -INT8_C( 121),
+       INT8_C(  19),  INT8_C(  46),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 118),  INT8_C(   0),  INT8_C(  55),
+      -INT8_C( 100),  INT8_C(  16),  INT8_C(   0), -INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 121),
+       INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(  61),  INT8_C(   0), -INT8_C(  63),  INT8_C(   0),  INT8_C( 112),
+       INT8_C(   0), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),  INT8_C(  39), -INT8_C(  82),  INT8_C(  75),  INT8_C(  59),
+      -INT8_C(  36),  INT8_C(   0),  INT8_C(  78),  INT8_C(   0),  INT8_C(  91), -INT8_C( 105),  INT8_C(   5), -INT8_C(   9),
+      -INT8_C(  89),  INT8_C(   0),  INT8_C(   0), -INT8_C(  42),  INT8_C(   0),  INT8_C(  26),  INT8_C(   0), -INT8_C(  68),
+      -INT8_C(  68),  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  72),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  37),  INT8_C(   0),  INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  35),
+       INT8_C(   0), -INT8_C( 116), -INT8_C(  15), -INT8_C(  21),  INT8_C(  35), -INT8_C(  10), -INT8_C(  29),  INT8_C(   0),
+      -INT8_C(  12), -INT8_C(  74),  INT8_C(   0),  INT8_C(  97), -INT8_C(  48),  INT8_C(   0),  INT8_C(  29), -INT8_C( 115),
+       INT8_C(   4),  INT8_C(   0), -INT8_C( 121),  INT8_C(   0),  INT8_C(  95), -INT8_C(  21),  INT8_C( 102),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  60),  INT8_C(   0),  INT8_C( 112),  INT8_C( 122),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   6),  INT8_C(   0), -INT8_C(  21),  INT8_C(   0), -INT8_C(  42), -INT8_C(  50), -INT8_C(  13), -INT8_C(  54),
+       INT8_C(   0), -INT8_C( 109),  INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73), -INT8_C(  30),  INT8_C(   0),
+       INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   7),  INT8_C(   0),
+      -INT8_C( 114),  INT8_C(   0), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0), -INT8_C(  75),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  28),
+       INT8_C(   0), -INT8_C(  30),  INT8_C(   0),  INT8_C(  43),  INT8_C(   0), -INT8_C( 100),  INT8_C(   0),  INT8_C(  56),
+       INT8_C(   0), -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(  50),  INT8_C(  52),  INT8_C(   0), -INT8_C(  94),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  25),  INT8_C(   0),  INT8_C(  18),  INT8_C(  75),
+       INT8_C(  51),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 121), -INT8_C(  82),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  14), -INT8_C(  21),  INT8_C(   0), -INT8_C( 108),  INT8_C(   9),
+       INT8_C(   0),  INT8_C( 123), -INT8_C(  33),  INT8_C(   0),  INT8_C( 115),  INT8_C(   0), -INT8_C(  82), -INT8_C(  90),
+       INT8_C(   0), -INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),  INT8_C(   0),
+       INT8_C(  57),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  61),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  82),  INT8_C(  89),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11), -INT8_C( 119),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0),
+      -INT8_C(  48),  INT8_C(  15),  INT8_C(   0),  INT8_C( 118),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  86), -INT8_C(   3),  INT8_C(   0),  INT8_C(  25),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 101),  INT8_C(   0),  INT8_C( 119),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  14),  INT8_C(   0),  INT8_C(   0), -INT8_C( 105),  INT8_C(   0), -INT8_C( 113), -INT8_C(  74),  INT8_C(   0),
+      -INT8_C(  98), -INT8_C( 121),  INT8_C(   0), -INT8_C(  89),  INT8_C(   0),  INT8_C(   0), -INT8_C(  24),  INT8_C(  19),
+       INT8_C(   0),  INT8_C(   0) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_n_s8_z(pv, av, b);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    ev = simde_svmax_n_s8_z(pv, av, b);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C(   6),  INT8_C( 106), -INT8_C( 103),  INT8_C( 115), -INT8_C(  42),  INT8_C(  81),  INT8_C(  81), -INT8_C(  93),
+       INT8_C(  58), -INT8_C(  14),  INT8_C(  35), -INT8_C( 122), -INT8_C(  23),  INT8_C( 118),  INT8_C( 109), -INT8_C(  92),
+      -INT8_C(  73), -INT8_C(   2), -INT8_C(  37),  INT8_C(  62), -INT8_C(  50), -INT8_C(  18),  INT8_C(  47),  INT8_C(   6),
+       INT8_C(  60),  INT8_C(  81),  INT8_C(  76), -INT8_C( 121),  INT8_C(  68),  INT8_C(   5),  INT8_C( 123),  INT8_C(  75),
+       INT8_C( 112),  INT8_C(  21), -INT8_C(  66),  INT8_C(  70),  INT8_C( 102),  INT8_C(  15), -INT8_C(  23), -INT8_C(  96),
+       INT8_C(   1),  INT8_C(  12),  INT8_C(  39), -INT8_C(  21), -INT8_C( 126), -INT8_C( 108), -INT8_C( 113),  INT8_C(  57),
+      -INT8_C( 110),  INT8_C( 107),  INT8_C( 120),  INT8_C(  97),  INT8_C(  89), -INT8_C(  89),  INT8_C( 103), -INT8_C( 107),
+      -INT8_C(   8), -INT8_C(  76),  INT8_C(  28),  INT8_C(  61), -INT8_C(  71), -INT8_C( 105), -INT8_C( 120),  INT8_C(  41),
+      -INT8_C(  84),  INT8_C(  70),  INT8_C( 111),  INT8_C(  18),  INT8_C(  85),  INT8_C(  88), -INT8_C(  77),  INT8_C(  87),
+       INT8_C( 100), -INT8_C(  38),  INT8_C(  66), -INT8_C(  26),  INT8_C( 110), -INT8_C(  47),  INT8_C(  32),  INT8_C(   0),
+       INT8_C(  60), -INT8_C( 104),  INT8_C(  97), -INT8_C( 107),  INT8_C(  63), -INT8_C(  55),  INT8_C(  42),  INT8_C(  56),
+       INT8_C( 125),  INT8_C(  70),  INT8_C( 117),  INT8_C(  54), -INT8_C(  34), -INT8_C(   3),  INT8_C(  96), -INT8_C( 118),
+       INT8_C(  67), -INT8_C(  49), -INT8_C(  99), -INT8_C( 104),  INT8_C(  40),  INT8_C(  80), -INT8_C(  17), -INT8_C( 116),
+       INT8_C(  42),  INT8_C(  49),  INT8_C( 115), -INT8_C( 104),  INT8_C(   3), -INT8_C( 109), -INT8_C( 104),  INT8_C(  63),
+       INT8_C(  43), -INT8_C(   6), -INT8_C(  43),  INT8_C( 106), -INT8_C(  61), -INT8_C(   1), -INT8_C(  94),  INT8_C(  64),
+       INT8_C(  70),  INT8_C(  23),  INT8_C( 118),  INT8_C(  36),  INT8_C(  20), -INT8_C(  42), -INT8_C(  82),  INT8_C(  87),
+      -INT8_C(  90),  INT8_C(  75), -INT8_C(  16), -INT8_C(  50), -INT8_C( 101), -INT8_C(  33),  INT8_C(  90), -INT8_C(  59),
+       INT8_C(  17), -INT8_C(  51),  INT8_C(  93),  INT8_C(  20),  INT8_C(  96), -INT8_C(  10),  INT8_C(  83), -INT8_C( 117),
+      -INT8_C(  16),  INT8_C(  40), -INT8_C(  10), -INT8_C(  77),  INT8_C(  40), -INT8_C( 104), -INT8_C(  13),  INT8_C( 110),
+      -INT8_C(  80),  INT8_C( 105), -INT8_C( 110), -INT8_C(  60),  INT8_C(  64),  INT8_C(  64),  INT8_C(  28), -INT8_C(  26),
+      -INT8_C( 116),  INT8_C(  12), -INT8_C(  76),  INT8_C(  39), -INT8_C(  21),  INT8_C(  14), -INT8_C(  19), -INT8_C(   4),
+      -INT8_C(  36),  INT8_C(  74),  INT8_C(  16),  INT8_C(  60),  INT8_C(  64),  INT8_C( 100), -INT8_C(  56),  INT8_C(  48),
+      -INT8_C( 116), -INT8_C(  66), -INT8_C(  29), -INT8_C(  76),  INT8_C(  86), -INT8_C(  42),  INT8_C(  34),  INT8_C(   6),
+       INT8_C(  64), -INT8_C(  76), -INT8_C(  53),      INT8_MIN, -INT8_C(  11), -INT8_C(  25),  INT8_C( 102), -INT8_C( 127),
+      -INT8_C(  13),  INT8_C(  26), -INT8_C(  88), -INT8_C(  34),  INT8_C(  40), -INT8_C( 107), -INT8_C(  37),  INT8_C(   4),
+      -INT8_C(  32), -INT8_C(  21),  INT8_C(  65),  INT8_C(  32),  INT8_C(  79),  INT8_C(   9),  INT8_C(  81), -INT8_C(  36),
+      -INT8_C(  57),  INT8_C(  52), -INT8_C( 112),  INT8_C(  29),  INT8_C(  11), -INT8_C(  77),  INT8_C(  36),  INT8_C(  75),
+       INT8_C( 103), -INT8_C(  17), -INT8_C(  53),  INT8_C(  92), -INT8_C(  42),  INT8_C(  49), -INT8_C(  35), -INT8_C(  55),
+       INT8_C(  75), -INT8_C( 122), -INT8_C(  89),  INT8_C( 115),  INT8_C(  27), -INT8_C( 126),  INT8_C( 120), -INT8_C(   5),
+       INT8_C( 110), -INT8_C(  71),  INT8_C(  28), -INT8_C(  67), -INT8_C(  62),  INT8_C( 109), -INT8_C( 103), -INT8_C( 119),
+      -INT8_C(  95),  INT8_C(  42), -INT8_C(  90), -INT8_C(  84), -INT8_C(  35), -INT8_C(  54), -INT8_C(   9),  INT8_C(  68),
+      -INT8_C(  71), -INT8_C(  62), -INT8_C(  95), -INT8_C( 113), -INT8_C(  13),  INT8_C( 126),  INT8_C(  88),  INT8_C(  62),
+       INT8_C(   4),  INT8_C(   0), -INT8_C(  78),  INT8_C(  32), -INT8_C( 126),  INT8_C(  42),  INT8_C(  27), -INT8_C(  16),
+      -INT8_C(  29),  INT8_C(  55), -INT8_C(  82), -INT8_C(  91), -INT8_C(  92),  INT8_C(  71),  INT8_C(  46),  INT8_C(  70),
+       INT8_C( 113), -INT8_C(  44), -INT8_C(  14),  INT8_C(  78), -INT8_C(  97), -INT8_C(  22), -INT8_C( 109),  INT8_C(  88),
+      -INT8_C(  84),  INT8_C(  52), -INT8_C(  24), -INT8_C(  96), -INT8_C(  78),  INT8_C(  64), -INT8_C(  34), -INT8_C(  73),
+       INT8_C(  64), -INT8_C( 112), -INT8_C(  41), -INT8_C(  61), -INT8_C(  70), -INT8_C(  14), -INT8_C(  77), -INT8_C(  99),
+       INT8_C(  42),  INT8_C(  97),  INT8_C(  66), -INT8_C(  50), -INT8_C(  87),  INT8_C( 112),  INT8_C(  20),  INT8_C(  26),
+       INT8_C(  69),  INT8_C(   7),  INT8_C( 105), -INT8_C(  28), -INT8_C(  15), -INT8_C(   4),  INT8_C(  60), -INT8_C(  99),
+       INT8_C(  48),  INT8_C(  36),  INT8_C(  61), -INT8_C(  30),  INT8_C( 101),  INT8_C(  28), -INT8_C( 103), -INT8_C(  91),
+      -INT8_C(  84),  INT8_C( 112),  INT8_C( 104),  INT8_C( 103),  INT8_C(  99),  INT8_C(  28),  INT8_C(   4), -INT8_C( 115),
+       INT8_C( 125),  INT8_C(  71),  INT8_C(  91),  INT8_C(  38), -INT8_C(  73),  INT8_C( 112),  INT8_C(  65), -INT8_C(   4),
+       INT8_C( 119), -INT8_C(  86), -INT8_C(  32),  INT8_C( 104), -INT8_C(  90),  INT8_C(  29),  INT8_C(   5), -INT8_C(  42),
+       INT8_C(  65),  INT8_C(  67), -INT8_C(  72), -INT8_C(  90),  INT8_C(  95),  INT8_C(  82),  INT8_C(  76),  INT8_C(  11),
+      -INT8_C(  62), -INT8_C(  76),  INT8_C( 114),  INT8_C(  37), -INT8_C(  48),  INT8_C( 119), -INT8_C(  78),  INT8_C(  78),
+      -INT8_C(  66),  INT8_C(  14),  INT8_C( 116),  INT8_C( 117),  INT8_C( 126), -INT8_C(  75),  INT8_C( 114), -INT8_C(  11),
+       INT8_C(  95),  INT8_C(  82),  INT8_C(  93),  INT8_C(   5),  INT8_C( 111),  INT8_C(  98), -INT8_C(  37), -INT8_C(  79),
+      -INT8_C(  91), -INT8_C( 108),  INT8_C(  87),  INT8_C(   4), -INT8_C(  26), -INT8_C(  93),  INT8_C(  16), -INT8_C(  88),
+       INT8_C(  88), -INT8_C( 126), -INT8_C(  50),  INT8_C(  40), -INT8_C(   7),      INT8_MIN,  INT8_C( 118), -INT8_C(  73),
+      -INT8_C( 114), -INT8_C(  21),  INT8_C(  45),  INT8_C(  12), -INT8_C(  96), -INT8_C(  97),  INT8_C(   1),  INT8_C(   0),
+      -INT8_C(  15),  INT8_C(  94),  INT8_C(   5),  INT8_C(  97), -INT8_C(  63), -INT8_C(  31),  INT8_C(  18),  INT8_C( 102),
+       INT8_C( 117),  INT8_C( 105),  INT8_C( 107),  INT8_C(  91),  INT8_C(  13),  INT8_C( 123),  INT8_C(   3),  INT8_C( 101),
+      -INT8_C(   3), -INT8_C(  47), -INT8_C( 115), -INT8_C(   9),  INT8_C(  82),  INT8_C(   4), -INT8_C(  82), -INT8_C(  32),
+      -INT8_C(  17), -INT8_C(  37), -INT8_C(  19), -INT8_C( 113),  INT8_C( 122), -INT8_C(  18), -INT8_C( 113),  INT8_C( 108),
+       INT8_C(  77), -INT8_C( 107), -INT8_C(  51),  INT8_C(  14),  INT8_C( 118), -INT8_C(  33),  INT8_C( 116), -INT8_C(  21),
+       INT8_C(  72), -INT8_C(  33),  INT8_C(  70),  INT8_C(  85),  INT8_C(  90),  INT8_C(  73), -INT8_C(  70),  INT8_C(  88),
+       INT8_C(  27),  INT8_C(  72),  INT8_C(  79),  INT8_C( 109),  INT8_C(  76), -INT8_C(   3),  INT8_C(  77),  INT8_C(  59),
+      -INT8_C(  39),  INT8_C(  58), -INT8_C(  54),  INT8_C(  83),  INT8_C(  41),  INT8_C(  90), -INT8_C(  65),  INT8_C( 118),
+      -INT8_C(  17), -INT8_C( 116), -INT8_C( 124),  INT8_C( 101),  INT8_C( 107), -INT8_C(   8),  INT8_C(  80), -INT8_C(  76),
+      -INT8_C(  40), -INT8_C( 106),  INT8_C(   9),  INT8_C(  50), -INT8_C(  33), -INT8_C(  60), -INT8_C( 118), -INT8_C(   6),
+       INT8_C(  12), -INT8_C(  39),  INT8_C( 103),  INT8_C(  88), -INT8_C(  41), -INT8_C(  75), -INT8_C( 109), -INT8_C(  80),
+      -INT8_C(  17),  INT8_C(  93),  INT8_C(   3),  INT8_C(  24), -INT8_C(  73), -INT8_C(  61), -INT8_C( 114), -INT8_C(  90),
+       INT8_C(  79),  INT8_C(  18),  INT8_C(  11), -INT8_C(  69),  INT8_C(  11),  INT8_C(  91),  INT8_C( 111), -INT8_C(  29),
+      -INT8_C(  15),  INT8_C( 120),  INT8_C(  21), -INT8_C(  47),  INT8_C(  60), -INT8_C(  96), -INT8_C(  53),  INT8_C(  72),
+       INT8_C( 121),  INT8_C(  51), -INT8_C(  96),  INT8_C(  80), -INT8_C(  24),  INT8_C(  51),  INT8_C(   0), -INT8_C(  41),
+      -INT8_C( 111),  INT8_C(   4), -INT8_C(  16),  INT8_C(  72), -INT8_C(  57),  INT8_C( 126), -INT8_C(  17),  INT8_C(  22),
+      -INT8_C( 111), -INT8_C(   6), -INT8_C(  47), -INT8_C( 100),  INT8_C(  86),  INT8_C(  64),      INT8_MAX,  INT8_C(  71),
+      -INT8_C(  71), -INT8_C( 108),  INT8_C(  24), -INT8_C(  11),  INT8_C(  52), -INT8_C(  28),  INT8_C(  62), -INT8_C(  82),
+       INT8_C(  23), -INT8_C(  34), -INT8_C(   2), -INT8_C(   1),  INT8_C(  18), -INT8_C(   1), -INT8_C(  42), -INT8_C(  93),
+       INT8_C(   3), -INT8_C(  58), -INT8_C(  21), -INT8_C(  54),  INT8_C(  69), -INT8_C(  38), -INT8_C(  32), -INT8_C(  42),
+      -INT8_C(  43), -INT8_C(  78),  INT8_C( 114),  INT8_C(  43), -INT8_C(  14), -INT8_C(  15),  INT8_C( 114), -INT8_C(  85),
+      -INT8_C( 123), -INT8_C( 117), -INT8_C(  95), -INT8_C(  70),  INT8_C( 111), -INT8_C(  33),  INT8_C( 104), -INT8_C( 122),
+      -INT8_C(  67),  INT8_C( 102), -INT8_C( 123), -INT8_C(  49),  INT8_C( 101),  INT8_C(  91),  INT8_C( 114),  INT8_C( 104),
+       INT8_C(  34),  INT8_C(  94),  INT8_C(  50),  INT8_C( 103),  INT8_C(  56),  INT8_C(  19),  INT8_C(  61),  INT8_C(  13),
+      -INT8_C(  59), -INT8_C(  81),  INT8_C(  56), -INT8_C(  73), -INT8_C(  96), -INT8_C(  85),  INT8_C(  99),  INT8_C(  37),
+       INT8_C(  54),  INT8_C(   4), -INT8_C(  33), -INT8_C(  91), -INT8_C(  29),  INT8_C(  71),  INT8_C(  43), -INT8_C(  96),
+      -INT8_C(  82), -INT8_C(  80),  INT8_C( 112),  INT8_C(  19),  INT8_C(  11), -INT8_C(  30),  INT8_C( 124),  INT8_C(  45),
+       INT8_C(  64), -INT8_C(  82), -INT8_C( 108),  INT8_C( 121), -INT8_C(  63), -INT8_C(  47), -INT8_C( 122), -INT8_C( 122),
+           INT8_MIN, -INT8_C(  65),  INT8_C(  62),  INT8_C(  32),  INT8_C( 106), -INT8_C(  95),  INT8_C(  70), -INT8_C(  96),
+      -INT8_C(  91),  INT8_C(  37),  INT8_C(  69), -INT8_C( 120),  INT8_C( 109),  INT8_C( 112),  INT8_C(  40),  INT8_C(  27),
+       INT8_C(  32), -INT8_C( 104),  INT8_C(  46),  INT8_C(  43),  INT8_C( 123), -INT8_C(  86),  INT8_C(  89), -INT8_C(  69),
+       INT8_C(  89), -INT8_C(  19),  INT8_C(  52),  INT8_C(  26), -INT8_C(  65), -INT8_C(  69), -INT8_C(  95),  INT8_C(  63),
+       INT8_C( 122), -INT8_C(  33),  INT8_C(  96), -INT8_C(  28),      INT8_MIN, -INT8_C(  90), -INT8_C( 124),  INT8_C(  37),
+      -INT8_C(  53), -INT8_C(  55), -INT8_C(  83),  INT8_C(  56),  INT8_C(  57), -INT8_C(  43),  INT8_C(  83),  INT8_C(  89),
+       INT8_C( 110), -INT8_C( 126), -INT8_C( 124), -INT8_C(  23),  INT8_C(  44), -INT8_C(  35), -INT8_C(  92), -INT8_C( 123),
+      -INT8_C(  53), -INT8_C(  39), -INT8_C(  96), -INT8_C( 118), -INT8_C( 108),  INT8_C(  65), -INT8_C(  55),  INT8_C(  14),
+       INT8_C(  32),  INT8_C(  41), -INT8_C(  14), -INT8_C(  96), -INT8_C(  49),  INT8_C( 118), -INT8_C(  59), -INT8_C( 101),
+       INT8_C(  63),  INT8_C( 114), -INT8_C(  45),  INT8_C( 120),  INT8_C(  71),  INT8_C(  39), -INT8_C(  47), -INT8_C(  75),
+      -INT8_C(  87),  INT8_C(  85), -INT8_C(  98), -INT8_C(  43),  INT8_C(  51),  INT8_C(  67),  INT8_C(  91), -INT8_C(   2),
+       INT8_C(  28), -INT8_C(   5), -INT8_C( 120), -INT8_C(  80),  INT8_C(  60),  INT8_C(  81), -INT8_C(  66),  INT8_C(  92),
+       INT8_C( 123), -INT8_C(  80), -INT8_C(   4),  INT8_C(  74),  INT8_C(  38), -INT8_C(  63), -INT8_C(  27),  INT8_C( 101),
+       INT8_C(  51), -INT8_C(  71), -INT8_C(  35),  INT8_C( 122), -INT8_C(  32), -INT8_C(  82),  INT8_C(  48), -INT8_C( 119),
+       INT8_C(   3), -INT8_C(  50),  INT8_C(  94),  INT8_C(  54),  INT8_C(  17), -INT8_C(  71),  INT8_C(  52),  INT8_C(  45),
+      -INT8_C(  76), -INT8_C(  68), -INT8_C(  35), -INT8_C(  16),  INT8_C(  14), -INT8_C( 101),  INT8_C(  76), -INT8_C( 119),
+       INT8_C(  75),  INT8_C(  72), -INT8_C(  45),  INT8_C( 113),  INT8_C(   9), -INT8_C(  71), -INT8_C(  42),  INT8_C(  60),
+       INT8_C( 114), -INT8_C(  77), -INT8_C(  73),  INT8_C(  82),  INT8_C(  97), -INT8_C(  25), -INT8_C(  37),  INT8_C( 101),
+      -INT8_C(  75),  INT8_C(  57), -INT8_C( 101), -INT8_C(  57), -INT8_C(  13), -INT8_C(  48), -INT8_C(  12), -INT8_C(  89),
+      -INT8_C( 116), -INT8_C(  46), -INT8_C( 104), -INT8_C( 102),  INT8_C( 109), -INT8_C(  28),  INT8_C(  35), -INT8_C(  71),
+       INT8_C(  45), -INT8_C(   9),  INT8_C(  42),  INT8_C(  54), -INT8_C(  80),  INT8_C(   1),  INT8_C( 115),  INT8_C(  34),
+      -INT8_C(  76),  INT8_C(  42),  INT8_C( 116),  INT8_C(  22),  INT8_C(  17),  INT8_C(  79),  INT8_C( 123), -INT8_C(  58),
+      -INT8_C( 120),  INT8_C(  22), -INT8_C( 115),  INT8_C( 123), -INT8_C(  26), -INT8_C( 126),  INT8_C(  35),  INT8_C( 115),
+       INT8_C(  84), -INT8_C(  69),  INT8_C(  13), -INT8_C(  63), -INT8_C(  97),  INT8_C(  49),  INT8_C( 122), -INT8_C(  52),
+       INT8_C(  40), -INT8_C(  91),  INT8_C(   3), -INT8_C(  40), -INT8_C(  90),  INT8_C( 118), -INT8_C(   6),  INT8_C(  90),
+      -INT8_C(  96),  INT8_C( 110),  INT8_C( 112), -INT8_C(  79), -INT8_C(  67), -INT8_C(  21),  INT8_C( 119),  INT8_C(  69),
+       INT8_C(   2),  INT8_C(   5), -INT8_C(  63), -INT8_C(  24), -INT8_C( 121), -INT8_C(  28),  INT8_C(  91), -INT8_C(  37),
+      -INT8_C(  97),  INT8_C( 105), -INT8_C( 100),  INT8_C(  62), -INT8_C( 102),  INT8_C(  23),  INT8_C(  11), -INT8_C(  62),
+      -INT8_C(  68),  INT8_C(  14), -INT8_C( 102),  INT8_C(  98), -INT8_C( 124), -INT8_C( 108), -INT8_C(  68),  INT8_C(  36),
+       INT8_C(   2),  INT8_C(  45), -INT8_C(  43), -INT8_C(  65),  INT8_C(  24),  INT8_C(  76),  INT8_C(   4),  INT8_C(  26),
+       INT8_C(  81), -INT8_C(  59),  INT8_C(   3), -INT8_C(  40), -INT8_C(  87),  INT8_C(  94), -INT8_C(  77),  INT8_C(  72),
+      -INT8_C(  57),  INT8_C(  80), -INT8_C( 121),  INT8_C(  97),  INT8_C( 103), -INT8_C( 110),  INT8_C(  35),  INT8_C(  35),
+      -INT8_C(  96), -INT8_C(  67), -INT8_C( 123),  INT8_C(  36),  INT8_C(  81),  INT8_C(  65),  INT8_C(  72),  INT8_C(  83),
+       INT8_C( 110),  INT8_C(  29),  INT8_C(  18), -INT8_C( 121),  INT8_C( 105),  INT8_C(  23), -INT8_C(  95), -INT8_C(  69),
+      -INT8_C(  36), -INT8_C(  92), -INT8_C( 109), -INT8_C( 122),  INT8_C(   3) };
+  static const int8_t b = -INT8_C(  15);
+  static const int8_t e[] =
+    {  INT8_C(   6),  INT8_C( 106), -INT8_C( 103),  INT8_C( 115), -INT8_C(  15),  INT8_C(  81),  INT8_C(  81), -INT8_C(  15),
+       INT8_C(  58), -INT8_C(  14),  INT8_C(  35), -INT8_C(  15), -INT8_C(  15),  INT8_C( 118),  INT8_C( 109), -INT8_C(  92),
+      -INT8_C(  73), -INT8_C(   2), -INT8_C(  15),  INT8_C(  62), -INT8_C(  50), -INT8_C(  15),  INT8_C(  47),  INT8_C(   6),
+       INT8_C(  60),  INT8_C(  81),  INT8_C(  76), -INT8_C(  15),  INT8_C(  68),  INT8_C(   5),  INT8_C( 123),  INT8_C(  75),
+       INT8_C( 112),  INT8_C(  21), -INT8_C(  66),  INT8_C(  70),  INT8_C( 102),  INT8_C(  15), -INT8_C(  15), -INT8_C(  96),
+       INT8_C(   1),  INT8_C(  12),  INT8_C(  39), -INT8_C(  21), -INT8_C( 126), -INT8_C(  15), -INT8_C( 113),  INT8_C(  57),
+      -INT8_C( 110),  INT8_C( 107),  INT8_C( 120),  INT8_C(  97),  INT8_C(  89), -INT8_C(  15),  INT8_C( 103), -INT8_C(  15),
+      -INT8_C(   8), -INT8_C(  15),  INT8_C(  28),  INT8_C(  61), -INT8_C(  15), -INT8_C( 105), -INT8_C(  15),  INT8_C(  41),
+      -INT8_C(  15),  INT8_C(  70),  INT8_C( 111),  INT8_C(  18),  INT8_C(  85),  INT8_C(  88), -INT8_C(  77),  INT8_C(  87),
+       INT8_C( 100), -INT8_C(  15),  INT8_C(  66), -INT8_C(  26),  INT8_C( 110), -INT8_C(  47),  INT8_C(  32),  INT8_C(   0),
+       INT8_C(  60), -INT8_C(  15),  INT8_C(  97), -INT8_C(  15),  INT8_C(  63), -INT8_C(  55),  INT8_C(  42),  INT8_C(  56),
+       INT8_C( 125),  INT8_C(  70),  INT8_C( 117),  INT8_C(  54), -INT8_C(  34), -INT8_C(   3),  INT8_C(  96), -INT8_C( 118),
+       INT8_C(  67), -INT8_C(  49), -INT8_C(  15), -INT8_C( 104),  INT8_C(  40),  INT8_C(  80), -INT8_C(  17), -INT8_C(  15),
+       INT8_C(  42),  INT8_C(  49),  INT8_C( 115), -INT8_C( 104),  INT8_C(   3), -INT8_C(  15), -INT8_C( 104),  INT8_C(  63),
+       INT8_C(  43), -INT8_C(   6), -INT8_C(  15),  INT8_C( 106), -INT8_C(  61), -INT8_C(   1), -INT8_C(  94),  INT8_C(  64),
+       INT8_C(  70),  INT8_C(  23),  INT8_C( 118),  INT8_C(  36),  INT8_C(  20), -INT8_C(  42), -INT8_C(  15),  INT8_C(  87),
+      -INT8_C(  15),  INT8_C(  75), -INT8_C(  16), -INT8_C(  50), -INT8_C( 101), -INT8_C(  33),  INT8_C(  90), -INT8_C(  59),
+       INT8_C(  17), -INT8_C(  15),  INT8_C(  93),  INT8_C(  20),  INT8_C(  96), -INT8_C(  10),  INT8_C(  83), -INT8_C(  15),
+      -INT8_C(  15),  INT8_C(  40), -INT8_C(  10), -INT8_C(  15),  INT8_C(  40), -INT8_C(  15), -INT8_C(  13),  INT8_C( 110),
+      -INT8_C(  80),  INT8_C( 105), -INT8_C( 110), -INT8_C(  15),  INT8_C(  64),  INT8_C(  64),  INT8_C(  28), -INT8_C(  26),
+      -INT8_C(  15),  INT8_C(  12), -INT8_C(  15),  INT8_C(  39), -INT8_C(  15),  INT8_C(  14), -INT8_C(  19), -INT8_C(   4),
+      -INT8_C(  36),  INT8_C(  74),  INT8_C(  16),  INT8_C(  60),  INT8_C(  64),  INT8_C( 100), -INT8_C(  56),  INT8_C(  48),
+      -INT8_C( 116), -INT8_C(  66), -INT8_C(  29), -INT8_C(  76),  INT8_C(  86), -INT8_C(  42),  INT8_C(  34),  INT8_C(   6),
+       INT8_C(  64), -INT8_C(  76), -INT8_C(  53),      INT8_MIN, -INT8_C(  11), -INT8_C(  15),  INT8_C( 102), -INT8_C(  15),
+      -INT8_C(  13),  INT8_C(  26), -INT8_C(  15), -INT8_C(  34),  INT8_C(  40), -INT8_C(  15), -INT8_C(  37),  INT8_C(   4),
+      -INT8_C(  15), -INT8_C(  21),  INT8_C(  65),  INT8_C(  32),  INT8_C(  79),  INT8_C(   9),  INT8_C(  81), -INT8_C(  36),
+      -INT8_C(  57),  INT8_C(  52), -INT8_C(  15),  INT8_C(  29),  INT8_C(  11), -INT8_C(  77),  INT8_C(  36),  INT8_C(  75),
+       INT8_C( 103), -INT8_C(  15), -INT8_C(  53),  INT8_C(  92), -INT8_C(  15),  INT8_C(  49), -INT8_C(  35), -INT8_C(  55),
+       INT8_C(  75), -INT8_C(  15), -INT8_C(  15),  INT8_C( 115),  INT8_C(  27), -INT8_C(  15),  INT8_C( 120), -INT8_C(   5),
+       INT8_C( 110), -INT8_C(  71),  INT8_C(  28), -INT8_C(  67), -INT8_C(  62),  INT8_C( 109), -INT8_C(  15), -INT8_C( 119),
+      -INT8_C(  15),  INT8_C(  42), -INT8_C(  90), -INT8_C(  84), -INT8_C(  15), -INT8_C(  15), -INT8_C(   9),  INT8_C(  68),
+      -INT8_C(  15), -INT8_C(  62), -INT8_C(  95), -INT8_C(  15), -INT8_C(  13),  INT8_C( 126),  INT8_C(  88),  INT8_C(  62),
+       INT8_C(   4),  INT8_C(   0), -INT8_C(  15),  INT8_C(  32), -INT8_C(  15),  INT8_C(  42),  INT8_C(  27), -INT8_C(  15),
+      -INT8_C(  15),  INT8_C(  55), -INT8_C(  15), -INT8_C(  15), -INT8_C(  15),  INT8_C(  71),  INT8_C(  46),  INT8_C(  70),
+       INT8_C( 113), -INT8_C(  15), -INT8_C(  14),  INT8_C(  78), -INT8_C(  15), -INT8_C(  15), -INT8_C( 109),  INT8_C(  88),
+      -INT8_C(  84),  INT8_C(  52), -INT8_C(  24), -INT8_C(  15), -INT8_C(  15),  INT8_C(  64), -INT8_C(  15), -INT8_C(  73),
+       INT8_C(  64), -INT8_C(  15), -INT8_C(  41), -INT8_C(  61), -INT8_C(  70), -INT8_C(  14), -INT8_C(  15), -INT8_C(  15),
+       INT8_C(  42),  INT8_C(  97),  INT8_C(  66), -INT8_C(  50), -INT8_C(  87),  INT8_C( 112),  INT8_C(  20),  INT8_C(  26),
+       INT8_C(  69),  INT8_C(   7),  INT8_C( 105), -INT8_C(  28), -INT8_C(  15), -INT8_C(   4),  INT8_C(  60), -INT8_C(  15),
+       INT8_C(  48),  INT8_C(  36),  INT8_C(  61), -INT8_C(  30),  INT8_C( 101),  INT8_C(  28), -INT8_C( 103), -INT8_C(  91),
+      -INT8_C(  84),  INT8_C( 112),  INT8_C( 104),  INT8_C( 103),  INT8_C(  99),  INT8_C(  28),  INT8_C(   4), -INT8_C( 115),
+       INT8_C( 125),  INT8_C(  71),  INT8_C(  91),  INT8_C(  38), -INT8_C(  73),  INT8_C( 112),  INT8_C(  65), -INT8_C(   4),
+       INT8_C( 119), -INT8_C(  86), -INT8_C(  15),  INT8_C( 104), -INT8_C(  90),  INT8_C(  29),  INT8_C(   5), -INT8_C(  42),
+       INT8_C(  65),  INT8_C(  67), -INT8_C(  15), -INT8_C(  90),  INT8_C(  95),  INT8_C(  82),  INT8_C(  76),  INT8_C(  11),
+      -INT8_C(  15), -INT8_C(  15),  INT8_C( 114),  INT8_C(  37), -INT8_C(  48),  INT8_C( 119), -INT8_C(  15),  INT8_C(  78),
+      -INT8_C(  15),  INT8_C(  14),  INT8_C( 116),  INT8_C( 117),  INT8_C( 126), -INT8_C(  15),  INT8_C( 114), -INT8_C(  11),
+       INT8_C(  95),  INT8_C(  82),  INT8_C(  93),  INT8_C(   5),  INT8_C( 111),  INT8_C(  98), -INT8_C(  37), -INT8_C(  15),
+      -INT8_C(  91), -INT8_C( 108),  INT8_C(  87),  INT8_C(   4), -INT8_C(  26), -INT8_C(  15),  INT8_C(  16), -INT8_C(  15),
+       INT8_C(  88), -INT8_C( 126), -INT8_C(  15),  INT8_C(  40), -INT8_C(   7),      INT8_MIN,  INT8_C( 118), -INT8_C(  15),
+      -INT8_C( 114), -INT8_C(  21),  INT8_C(  45),  INT8_C(  12), -INT8_C(  15), -INT8_C(  97),  INT8_C(   1),  INT8_C(   0),
+      -INT8_C(  15),  INT8_C(  94),  INT8_C(   5),  INT8_C(  97), -INT8_C(  15), -INT8_C(  31),  INT8_C(  18),  INT8_C( 102),
+       INT8_C( 117),  INT8_C( 105),  INT8_C( 107),  INT8_C(  91),  INT8_C(  13),  INT8_C( 123),  INT8_C(   3),  INT8_C( 101),
+      -INT8_C(   3), -INT8_C(  15), -INT8_C(  15), -INT8_C(   9),  INT8_C(  82),  INT8_C(   4), -INT8_C(  15), -INT8_C(  32),
+      -INT8_C(  15), -INT8_C(  37), -INT8_C(  19), -INT8_C(  15),  INT8_C( 122), -INT8_C(  15), -INT8_C(  15),  INT8_C( 108),
+       INT8_C(  77), -INT8_C(  15), -INT8_C(  51),  INT8_C(  14),  INT8_C( 118), -INT8_C(  15),  INT8_C( 116), -INT8_C(  21),
+       INT8_C(  72), -INT8_C(  33),  INT8_C(  70),  INT8_C(  85),  INT8_C(  90),  INT8_C(  73), -INT8_C(  15),  INT8_C(  88),
+       INT8_C(  27),  INT8_C(  72),  INT8_C(  79),  INT8_C( 109),  INT8_C(  76), -INT8_C(   3),  INT8_C(  77),  INT8_C(  59),
+      -INT8_C(  15),  INT8_C(  58), -INT8_C(  15),  INT8_C(  83),  INT8_C(  41),  INT8_C(  90), -INT8_C(  15),  INT8_C( 118),
+      -INT8_C(  17), -INT8_C(  15), -INT8_C( 124),  INT8_C( 101),  INT8_C( 107), -INT8_C(   8),  INT8_C(  80), -INT8_C(  76),
+      -INT8_C(  40), -INT8_C(  15),  INT8_C(   9),  INT8_C(  50), -INT8_C(  15), -INT8_C(  15), -INT8_C( 118), -INT8_C(   6),
+       INT8_C(  12), -INT8_C(  39),  INT8_C( 103),  INT8_C(  88), -INT8_C(  15), -INT8_C(  15), -INT8_C(  15), -INT8_C(  80),
+      -INT8_C(  17),  INT8_C(  93),  INT8_C(   3),  INT8_C(  24), -INT8_C(  73), -INT8_C(  15), -INT8_C(  15), -INT8_C(  90),
+       INT8_C(  79),  INT8_C(  18),  INT8_C(  11), -INT8_C(  15),  INT8_C(  11),  INT8_C(  91),  INT8_C( 111), -INT8_C(  29),
+      -INT8_C(  15),  INT8_C( 120),  INT8_C(  21), -INT8_C(  15),  INT8_C(  60), -INT8_C(  96), -INT8_C(  53),  INT8_C(  72),
+       INT8_C( 121),  INT8_C(  51), -INT8_C(  96),  INT8_C(  80), -INT8_C(  15),  INT8_C(  51),  INT8_C(   0), -INT8_C(  41),
+      -INT8_C(  15),  INT8_C(   4), -INT8_C(  15),  INT8_C(  72), -INT8_C(  15),  INT8_C( 126), -INT8_C(  17),  INT8_C(  22),
+      -INT8_C( 111), -INT8_C(   6), -INT8_C(  47), -INT8_C( 100),  INT8_C(  86),  INT8_C(  64),      INT8_MAX,  INT8_C(  71),
+      -INT8_C(  71), -INT8_C( 108),  INT8_C(  24), -INT8_C(  11),  INT8_C(  52), -INT8_C(  28),  INT8_C(  62), -INT8_C(  15),
+       INT8_C(  23), -INT8_C(  34), -INT8_C(   2), -INT8_C(   1),  INT8_C(  18), -INT8_C(   1), -INT8_C(  15), -INT8_C(  15),
+       INT8_C(   3), -INT8_C(  58), -INT8_C(  21), -INT8_C(  54),  INT8_C(  69), -INT8_C(  15), -INT8_C(  32), -INT8_C(  42),
+      -INT8_C(  43), -INT8_C(  15),  INT8_C( 114),  INT8_C(  43), -INT8_C(  14), -INT8_C(  15),  INT8_C( 114), -INT8_C(  85),
+      -INT8_C(  15), -INT8_C(  15), -INT8_C(  15), -INT8_C(  70),  INT8_C( 111), -INT8_C(  15),  INT8_C( 104), -INT8_C(  15),
+      -INT8_C(  15),  INT8_C( 102), -INT8_C(  15), -INT8_C(  15),  INT8_C( 101),  INT8_C(  91),  INT8_C( 114),  INT8_C( 104),
+       INT8_C(  34),  INT8_C(  94),  INT8_C(  50),  INT8_C( 103),  INT8_C(  56),  INT8_C(  19),  INT8_C(  61),  INT8_C(  13),
+      -INT8_C(  59), -INT8_C(  81),  INT8_C(  56), -INT8_C(  73), -INT8_C(  96), -INT8_C(  15),  INT8_C(  99),  INT8_C(  37),
+       INT8_C(  54),  INT8_C(   4), -INT8_C(  15), -INT8_C(  91), -INT8_C(  29),  INT8_C(  71),  INT8_C(  43), -INT8_C(  96),
+      -INT8_C(  82), -INT8_C(  15),  INT8_C( 112),  INT8_C(  19),  INT8_C(  11), -INT8_C(  15),  INT8_C( 124),  INT8_C(  45),
+       INT8_C(  64), -INT8_C(  82), -INT8_C( 108),  INT8_C( 121), -INT8_C(  15), -INT8_C(  15), -INT8_C(  15), -INT8_C(  15),
+      -INT8_C(  15), -INT8_C(  15),  INT8_C(  62),  INT8_C(  32),  INT8_C( 106), -INT8_C(  95),  INT8_C(  70), -INT8_C(  96),
+      -INT8_C(  91),  INT8_C(  37),  INT8_C(  69), -INT8_C(  15),  INT8_C( 109),  INT8_C( 112),  INT8_C(  40),  INT8_C(  27),
+       INT8_C(  32), -INT8_C(  15),  INT8_C(  46),  INT8_C(  43),  INT8_C( 123), -INT8_C(  86),  INT8_C(  89), -INT8_C(  15),
+       INT8_C(  89), -INT8_C(  15),  INT8_C(  52),  INT8_C(  26), -INT8_C(  15), -INT8_C(  15), -INT8_C(  95),  INT8_C(  63),
+       INT8_C( 122), -INT8_C(  33),  INT8_C(  96), -INT8_C(  28),      INT8_MIN, -INT8_C(  15), -INT8_C(  15),  INT8_C(  37),
+      -INT8_C(  53), -INT8_C(  15), -INT8_C(  83),  INT8_C(  56),  INT8_C(  57), -INT8_C(  15),  INT8_C(  83),  INT8_C(  89),
+       INT8_C( 110), -INT8_C( 126), -INT8_C( 124), -INT8_C(  15),  INT8_C(  44), -INT8_C(  15), -INT8_C(  92), -INT8_C( 123),
+      -INT8_C(  15), -INT8_C(  15), -INT8_C(  15), -INT8_C( 118), -INT8_C( 108),  INT8_C(  65), -INT8_C(  15),  INT8_C(  14),
+       INT8_C(  32),  INT8_C(  41), -INT8_C(  14), -INT8_C(  15), -INT8_C(  49),  INT8_C( 118), -INT8_C(  15), -INT8_C(  15),
+       INT8_C(  63),  INT8_C( 114), -INT8_C(  15),  INT8_C( 120),  INT8_C(  71),  INT8_C(  39), -INT8_C(  47), -INT8_C(  15),
+      -INT8_C(  15),  INT8_C(  85), -INT8_C(  98), -INT8_C(  15),  INT8_C(  51),  INT8_C(  67),  INT8_C(  91), -INT8_C(   2),
+       INT8_C(  28), -INT8_C(   5), -INT8_C( 120), -INT8_C(  15),  INT8_C(  60),  INT8_C(  81), -INT8_C(  15),  INT8_C(  92),
+       INT8_C( 123), -INT8_C(  80), -INT8_C(   4),  INT8_C(  74),  INT8_C(  38), -INT8_C(  15), -INT8_C(  15),  INT8_C( 101),
+       INT8_C(  51), -INT8_C(  71), -INT8_C(  15),  INT8_C( 122), -INT8_C(  15), -INT8_C(  82),  INT8_C(  48), -INT8_C(  15),
+       INT8_C(   3), -INT8_C(  50),  INT8_C(  94),  INT8_C(  54),  INT8_C(  17), -INT8_C(  71),  INT8_C(  52),  INT8_C(  45),
+      -INT8_C(  76), -INT8_C(  68), -INT8_C(  15), -INT8_C(  16),  INT8_C(  14), -INT8_C( 101),  INT8_C(  76), -INT8_C(  15),
+       INT8_C(  75),  INT8_C(  72), -INT8_C(  15),  INT8_C( 113),  INT8_C(   9), -INT8_C(  71), -INT8_C(  42),  INT8_C(  60),
+       INT8_C( 114), -INT8_C(  15), -INT8_C(  15),  INT8_C(  82),  INT8_C(  97), -INT8_C(  25), -INT8_C(  15),  INT8_C( 101),
+      -INT8_C(  75),  INT8_C(  57), -INT8_C( 101), -INT8_C(  57), -INT8_C(  13), -INT8_C(  15), -INT8_C(  12), -INT8_C(  89),
+      -INT8_C(  15), -INT8_C(  15), -INT8_C( 104), -INT8_C(  15),  INT8_C( 109), -INT8_C(  28),  INT8_C(  35), -INT8_C(  71),
+       INT8_C(  45), -INT8_C(   9),  INT8_C(  42),  INT8_C(  54), -INT8_C(  80),  INT8_C(   1),  INT8_C( 115),  INT8_C(  34),
+      -INT8_C(  15),  INT8_C(  42),  INT8_C( 116),  INT8_C(  22),  INT8_C(  17),  INT8_C(  79),  INT8_C( 123), -INT8_C(  15),
+      -INT8_C( 120),  INT8_C(  22), -INT8_C(  15),  INT8_C( 123), -INT8_C(  26), -INT8_C( 126),  INT8_C(  35),  INT8_C( 115),
+       INT8_C(  84), -INT8_C(  15),  INT8_C(  13), -INT8_C(  63), -INT8_C(  15),  INT8_C(  49),  INT8_C( 122), -INT8_C(  52),
+       INT8_C(  40), -INT8_C(  15),  INT8_C(   3), -INT8_C(  40), -INT8_C(  15),  INT8_C( 118), -INT8_C(   6),  INT8_C(  90),
+      -INT8_C(  15),  INT8_C( 110),  INT8_C( 112), -INT8_C(  15), -INT8_C(  67), -INT8_C(  21),  INT8_C( 119),  INT8_C(  69),
+       INT8_C(   2),  INT8_C(   5), -INT8_C(  63), -INT8_C(  24), -INT8_C(  15), -INT8_C(  28),  INT8_C(  91), -INT8_C(  37),
+      -INT8_C(  15),  INT8_C( 105), -INT8_C(  15),  INT8_C(  62), -INT8_C(  15),  INT8_C(  23),  INT8_C(  11), -INT8_C(  15),
+      -INT8_C(  15),  INT8_C(  14), -INT8_C(  15),  INT8_C(  98), -INT8_C(  15), -INT8_C(  15), -INT8_C(  68),  INT8_C(  36),
+       INT8_C(   2),  INT8_C(  45), -INT8_C(  15), -INT8_C(  15),  INT8_C(  24),  INT8_C(  76),  INT8_C(   4),  INT8_C(  26),
+       INT8_C(  81), -INT8_C(  59),  INT8_C(   3), -INT8_C(  40), -INT8_C(  87),  INT8_C(  94), -INT8_C(  15),  INT8_C(  72),
+      -INT8_C(  15),  INT8_C(  80), -INT8_C( 121),  INT8_C(  97),  INT8_C( 103), -INT8_C( 110),  INT8_C(  35),  INT8_C(  35),
+      -INT8_C(  96), -INT8_C(  67), -INT8_C( 123),  INT8_C(  36),  INT8_C(  81),  INT8_C(  65),  INT8_C(  72),  INT8_C(  83),
+       INT8_C( 110),  INT8_C(  29),  INT8_C(  18), -INT8_C(  15),  INT8_C( 105),  INT8_C(  23), -INT8_C(  15), -INT8_C(  15),
+      -INT8_C(  36), -INT8_C(  92), -INT8_C( 109), -INT8_C(  15),  INT8_C(   3) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_n_s8_m(pv, av, b);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    ev = simde_svmax_n_s8_m(pv, av, b);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) };
+  static const int16_t a[] =
+    {  INT16_C( 24760), -INT16_C( 15626), -INT16_C( 19824), -INT16_C( 26773),  INT16_C( 16594), -INT16_C( 20082),  INT16_C( 27188),  INT16_C( 17319),
+       INT16_C(  1625), -INT16_C( 11480), -INT16_C(  1806), -INT16_C( 13425),  INT16_C(  1687),  INT16_C( 20539), -INT16_C( 21674),  INT16_C(  3656),
+       INT16_C( 15884), -INT16_C( 25392),  INT16_C( 15345), -INT16_C( 15564), -INT16_C( 15748), -INT16_C( 20364),  INT16_C(  6956), -INT16_C( 31245),
+       INT16_C(  7201),  INT16_C(  4953), -INT16_C(  6124), -INT16_C( 21538),  INT16_C(  6895),  INT16_C( 17916),  INT16_C( 17605), -INT16_C( 11949),
+       INT16_C(  9346),  INT16_C( 29550), -INT16_C( 23969), -INT16_C(  9418), -INT16_C( 21916), -INT16_C( 28277),  INT16_C( 32710), -INT16_C(  6378),
+       INT16_C( 28571), -INT16_C( 20485), -INT16_C(  9896),  INT16_C( 18267),  INT16_C( 22515), -INT16_C( 18036), -INT16_C(  8293),  INT16_C(  7562),
+      -INT16_C(  2045),  INT16_C( 25489), -INT16_C( 14438), -INT16_C(   194), -INT16_C( 13710),  INT16_C( 14480), -INT16_C( 22967), -INT16_C(  7137),
+       INT16_C(  6678),  INT16_C( 28307), -INT16_C(  4364), -INT16_C(  6219),  INT16_C( 16709), -INT16_C(  8032),  INT16_C( 11040),  INT16_C(  9470),
+      -INT16_C( 28893), -INT16_C( 16761), -INT16_C( 15018), -INT16_C( 14147),  INT16_C( 19855), -INT16_C( 10240),  INT16_C(  8435),  INT16_C(  2492),
+       INT16_C( 20538),  INT16_C( 11895),  INT16_C( 11326), -INT16_C( 31722), -INT16_C( 18835), -INT16_C( 29084),  INT16_C( 25313),  INT16_C(  1458),
+       INT16_C( 14833),  INT16_C( 18627), -INT16_C( 32514), -INT16_C( 29168),  INT16_C(  4557), -INT16_C( 16282),  INT16_C(  9009),  INT16_C( 27594),
+       INT16_C( 16755), -INT16_C( 20070), -INT16_C( 20370), -INT16_C(  9419), -INT16_C( 26010),  INT16_C( 18537),  INT16_C(  7164), -INT16_C(  4531),
+       INT16_C(  4180),  INT16_C( 21302),  INT16_C( 18064),  INT16_C( 24033),  INT16_C( 18263), -INT16_C( 30691), -INT16_C(  6294), -INT16_C(  8716),
+      -INT16_C( 29143), -INT16_C( 26737), -INT16_C( 15298), -INT16_C( 23438), -INT16_C(  9122),  INT16_C( 23532),  INT16_C( 14839),  INT16_C( 19529),
+       INT16_C( 32585), -INT16_C(  9825), -INT16_C( 32571),  INT16_C(  7478),  INT16_C( 21703),  INT16_C( 12965), -INT16_C( 26309),  INT16_C( 25615),
+      -INT16_C( 25049),  INT16_C( 26107),  INT16_C( 28259), -INT16_C( 16118), -INT16_C(  2486),  INT16_C( 16668),  INT16_C( 25904),  INT16_C( 31117),
+       INT16_C( 11492), -INT16_C( 21933), -INT16_C( 30292),  INT16_C( 29895),  INT16_C( 27869),  INT16_C(  6566), -INT16_C( 19194),  INT16_C( 11645),
+       INT16_C( 31060), -INT16_C( 18541), -INT16_C( 25113),  INT16_C( 12664), -INT16_C( 27245), -INT16_C( 15502),  INT16_C(   250), -INT16_C(  8387),
+      -INT16_C( 28628), -INT16_C(  9847),  INT16_C( 20505), -INT16_C(  2227), -INT16_C(  3140), -INT16_C( 15856), -INT16_C( 29272), -INT16_C(   784),
+      -INT16_C( 31994), -INT16_C(  4685),  INT16_C( 11296), -INT16_C( 19682), -INT16_C( 28223), -INT16_C( 17545), -INT16_C( 19311), -INT16_C( 16998),
+       INT16_C(  9028),  INT16_C( 23958), -INT16_C(  7309),  INT16_C( 12372),  INT16_C( 25814),  INT16_C( 32754), -INT16_C(  7438), -INT16_C(  1925),
+       INT16_C( 12133), -INT16_C( 31258),  INT16_C(  1115),  INT16_C(  7225), -INT16_C( 20331),  INT16_C(  9943),  INT16_C( 29284), -INT16_C( 22300),
+       INT16_C( 31381),  INT16_C(  2309),  INT16_C( 23134),  INT16_C( 13369),  INT16_C( 11198), -INT16_C( 20301),  INT16_C( 12046),  INT16_C( 29609),
+      -INT16_C( 28834), -INT16_C( 17927),  INT16_C( 12947),  INT16_C( 10709), -INT16_C( 21278),  INT16_C( 17999),  INT16_C( 13086), -INT16_C( 19218),
+      -INT16_C(  3154),  INT16_C(  3261), -INT16_C(  2483),  INT16_C(  3136), -INT16_C(  3039),  INT16_C( 12220),  INT16_C( 25891), -INT16_C( 32349),
+      -INT16_C( 25356), -INT16_C( 30662),  INT16_C(  4046), -INT16_C( 20303),  INT16_C(   187), -INT16_C(  9482), -INT16_C(  7116), -INT16_C(  7538),
+       INT16_C( 19415),  INT16_C(  9710),  INT16_C( 11841),  INT16_C( 25137), -INT16_C(  4830),  INT16_C( 17810),  INT16_C( 13651),  INT16_C( 18374),
+       INT16_C(   209), -INT16_C( 24625), -INT16_C( 32753), -INT16_C( 13489),  INT16_C( 17793), -INT16_C( 19035),  INT16_C( 13097),  INT16_C(   151),
+      -INT16_C( 31362), -INT16_C( 16603),  INT16_C( 22195), -INT16_C( 10719), -INT16_C( 19644), -INT16_C( 26853), -INT16_C(  7448), -INT16_C( 17954),
+      -INT16_C( 20766), -INT16_C(  3496), -INT16_C( 22738), -INT16_C( 20547),  INT16_C( 25324),  INT16_C(  5476), -INT16_C(  1131),  INT16_C(  4886),
+       INT16_C( 15232),  INT16_C( 13522), -INT16_C(  3182), -INT16_C( 10742),  INT16_C(  9639), -INT16_C( 28819),  INT16_C( 19207), -INT16_C(  5559),
+      -INT16_C( 24071),  INT16_C( 10460), -INT16_C( 26295),  INT16_C( 13783),  INT16_C( 15611), -INT16_C( 28597),  INT16_C( 24887), -INT16_C( 18269),
+       INT16_C( 30108),  INT16_C( 12012), -INT16_C(  2456),  INT16_C(  3844),  INT16_C( 28955),  INT16_C(  9119), -INT16_C(  5955), -INT16_C( 18931),
+      -INT16_C(  5751), -INT16_C( 11554), -INT16_C( 18814),  INT16_C( 32008),  INT16_C( 21490),  INT16_C( 10509), -INT16_C( 20300),  INT16_C( 20705),
+      -INT16_C( 13019), -INT16_C( 29313), -INT16_C( 31805), -INT16_C(  8291),  INT16_C( 15605), -INT16_C( 19966),  INT16_C(  3876), -INT16_C( 21144),
+       INT16_C( 18424),  INT16_C( 31360), -INT16_C( 30467), -INT16_C(  4105),  INT16_C(  1243), -INT16_C( 28904), -INT16_C(  1356), -INT16_C(  9761),
+       INT16_C( 24263), -INT16_C( 29850),  INT16_C(   994), -INT16_C( 10390),  INT16_C( 27711),  INT16_C( 25481), -INT16_C(  3717),  INT16_C( 29457),
+      -INT16_C( 28360),  INT16_C( 13805), -INT16_C(  7143), -INT16_C(  3036),  INT16_C( 15848), -INT16_C( 25469),  INT16_C( 25143), -INT16_C(   395),
+      -INT16_C(  9279), -INT16_C( 23671), -INT16_C(  3105),  INT16_C(  7802),  INT16_C(   863), -INT16_C(  9598), -INT16_C( 27660),  INT16_C( 11597),
+       INT16_C( 14884),  INT16_C( 15714), -INT16_C( 30946),  INT16_C(  1585), -INT16_C( 19260), -INT16_C(  1118),  INT16_C(  5910), -INT16_C( 10247),
+      -INT16_C( 31757), -INT16_C( 11654), -INT16_C(  2954), -INT16_C( 10512),  INT16_C( 29431), -INT16_C(  4944), -INT16_C(   507),  INT16_C( 10521),
+       INT16_C( 31544),  INT16_C( 22374), -INT16_C( 26878), -INT16_C( 14755),  INT16_C(    75),  INT16_C( 25281), -INT16_C( 17641),  INT16_C(  2617),
+      -INT16_C( 19394), -INT16_C( 19236), -INT16_C( 12888), -INT16_C( 24438),  INT16_C( 15167),  INT16_C( 17804), -INT16_C( 23239),  INT16_C( 29038),
+      -INT16_C( 10976),  INT16_C(  9160),  INT16_C(  9836), -INT16_C( 18199), -INT16_C( 21722),  INT16_C( 15642),  INT16_C( 21350), -INT16_C( 23480),
+       INT16_C(  9223), -INT16_C( 20392), -INT16_C(  7183),  INT16_C( 12624), -INT16_C(  9186),  INT16_C( 22390), -INT16_C(  7039), -INT16_C( 24120),
+      -INT16_C( 28231),  INT16_C(  9924), -INT16_C( 20809), -INT16_C(  8738), -INT16_C(  1959), -INT16_C( 16614),  INT16_C( 25163),  INT16_C( 21347),
+      -INT16_C( 17529),  INT16_C( 30723),  INT16_C( 21406), -INT16_C( 17239),  INT16_C(  7983), -INT16_C( 20461), -INT16_C(  9212), -INT16_C( 17071),
+       INT16_C(  5741),  INT16_C(  9443), -INT16_C( 15932),  INT16_C(  7425),  INT16_C(  7097),  INT16_C(  1500),  INT16_C( 16254),  INT16_C(  1368),
+       INT16_C( 23546), -INT16_C( 26243),  INT16_C( 10158), -INT16_C(  8875),  INT16_C( 26950),  INT16_C( 19085), -INT16_C(  8635), -INT16_C( 19960),
+      -INT16_C(  5132), -INT16_C( 18218), -INT16_C( 10323),  INT16_C( 26325), -INT16_C( 19982),  INT16_C( 28779), -INT16_C( 15376), -INT16_C(  5259),
+      -INT16_C(  3298), -INT16_C( 13180), -INT16_C(  9958),  INT16_C( 24745),  INT16_C( 13890), -INT16_C( 30805), -INT16_C( 19691),  INT16_C(  2361),
+       INT16_C(  3998),  INT16_C( 19394), -INT16_C( 26650), -INT16_C(  9806),  INT16_C(  7497),  INT16_C( 14665), -INT16_C( 16415), -INT16_C(   220),
+      -INT16_C( 22350), -INT16_C( 13108),  INT16_C( 30082), -INT16_C( 15316), -INT16_C( 10324), -INT16_C( 16052), -INT16_C( 31350),  INT16_C( 10698),
+      -INT16_C( 29547),  INT16_C( 31604),  INT16_C(  9764),  INT16_C( 27988), -INT16_C( 25020),  INT16_C(  9638), -INT16_C( 13475),  INT16_C(  3876),
+      -INT16_C(  3981), -INT16_C(  2597),  INT16_C(  1894),  INT16_C(  4794),  INT16_C(  1759),  INT16_C( 27091), -INT16_C( 25205),  INT16_C(  8338),
+       INT16_C(  1834),  INT16_C( 20124), -INT16_C(  4051),  INT16_C( 29115),  INT16_C( 24974), -INT16_C(  5226), -INT16_C( 17620), -INT16_C( 24326),
+      -INT16_C( 10837),  INT16_C(  4501),  INT16_C( 20445), -INT16_C( 17373), -INT16_C(  2475), -INT16_C(  7899), -INT16_C( 18284), -INT16_C( 16895),
+      -INT16_C( 25153), -INT16_C(  5108), -INT16_C( 14450),  INT16_C(  7262), -INT16_C(  3032),  INT16_C( 21768),  INT16_C(   687),  INT16_C( 23541),
+      -INT16_C( 29992), -INT16_C( 19092), -INT16_C( 28454),  INT16_C( 12145), -INT16_C( 27002),  INT16_C(  6672),  INT16_C(  4686),  INT16_C(  3544),
+      -INT16_C(  6993),  INT16_C( 15866),  INT16_C( 22699), -INT16_C( 11174),  INT16_C( 25164), -INT16_C(   983),  INT16_C(  7780),  INT16_C( 15447),
+      -INT16_C( 15448), -INT16_C( 32015),  INT16_C( 25171), -INT16_C(  9550), -INT16_C( 15623),  INT16_C( 18420), -INT16_C( 12844), -INT16_C( 31659) };
+  static const int16_t b = -INT16_C( 12581);
+  static const int16_t e[] =
+    {  INT16_C( 24760), -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581),  INT16_C( 27188),  INT16_C( 17319),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20539), -INT16_C( 12581),  INT16_C(     0),
+       INT16_C( 15884),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581),  INT16_C(     0),  INT16_C(  6956),  INT16_C(     0),
+       INT16_C(  7201),  INT16_C(  4953), -INT16_C(  6124), -INT16_C( 12581),  INT16_C(  6895),  INT16_C(     0),  INT16_C( 17605), -INT16_C( 11949),
+       INT16_C(  9346),  INT16_C( 29550), -INT16_C( 12581), -INT16_C(  9418), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  9896),  INT16_C( 18267),  INT16_C( 22515), -INT16_C( 12581), -INT16_C(  8293),  INT16_C(  7562),
+      -INT16_C(  2045),  INT16_C( 25489),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12581),  INT16_C( 14480), -INT16_C( 12581),  INT16_C(     0),
+       INT16_C(  6678),  INT16_C( 28307),  INT16_C(     0), -INT16_C(  6219),  INT16_C( 16709), -INT16_C(  8032),  INT16_C( 11040),  INT16_C(  9470),
+       INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10240),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 20538),  INT16_C( 11895),  INT16_C( 11326), -INT16_C( 12581), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 14833),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4557), -INT16_C( 12581),  INT16_C(  9009),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C(     0), -INT16_C(  9419), -INT16_C( 12581),  INT16_C(     0),  INT16_C(  7164), -INT16_C(  4531),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 18064),  INT16_C( 24033),  INT16_C( 18263), -INT16_C( 12581), -INT16_C(  6294), -INT16_C(  8716),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581), -INT16_C(  9122),  INT16_C( 23532),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 32585),  INT16_C(     0), -INT16_C( 12581),  INT16_C(  7478),  INT16_C( 21703),  INT16_C( 12965), -INT16_C( 12581),  INT16_C( 25615),
+      -INT16_C( 12581),  INT16_C(     0),  INT16_C( 28259), -INT16_C( 12581), -INT16_C(  2486),  INT16_C(     0),  INT16_C( 25904),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 12581),  INT16_C( 29895),  INT16_C(     0),  INT16_C(  6566),  INT16_C(     0),  INT16_C( 11645),
+       INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581),  INT16_C( 12664), -INT16_C( 12581), -INT16_C( 12581),  INT16_C(     0), -INT16_C(  8387),
+      -INT16_C( 12581), -INT16_C(  9847),  INT16_C( 20505),  INT16_C(     0), -INT16_C(  3140),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),
+      -INT16_C( 12581), -INT16_C(  4685),  INT16_C( 11296),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581), -INT16_C( 12581),
+       INT16_C(  9028),  INT16_C( 23958), -INT16_C(  7309),  INT16_C( 12372),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7438),  INT16_C(     0),
+       INT16_C( 12133), -INT16_C( 12581),  INT16_C(     0),  INT16_C(  7225), -INT16_C( 12581),  INT16_C(  9943),  INT16_C(     0), -INT16_C( 12581),
+       INT16_C( 31381),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13369),  INT16_C(     0), -INT16_C( 12581),  INT16_C( 12046),  INT16_C(     0),
+      -INT16_C( 12581), -INT16_C( 12581),  INT16_C(     0),  INT16_C( 10709),  INT16_C(     0),  INT16_C( 17999),  INT16_C(     0), -INT16_C( 12581),
+      -INT16_C(  3154),  INT16_C(  3261),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3039),  INT16_C(     0),  INT16_C( 25891),  INT16_C(     0),
+      -INT16_C( 12581),  INT16_C(     0),  INT16_C(  4046), -INT16_C( 12581),  INT16_C(   187), -INT16_C(  9482),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 19415),  INT16_C(  9710),  INT16_C( 11841),  INT16_C( 25137), -INT16_C(  4830),  INT16_C(     0),  INT16_C(     0),  INT16_C( 18374),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C( 17793), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7448), -INT16_C( 12581),
+      -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C( 25324),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4886),
+       INT16_C( 15232),  INT16_C( 13522), -INT16_C(  3182),  INT16_C(     0),  INT16_C(  9639), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 12581),  INT16_C( 10460), -INT16_C( 12581),  INT16_C(     0),  INT16_C( 15611), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 30108),  INT16_C(     0), -INT16_C(  2456),  INT16_C(  3844),  INT16_C(     0),  INT16_C(  9119),  INT16_C(     0), -INT16_C( 12581),
+      -INT16_C(  5751),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10509),  INT16_C(     0),  INT16_C( 20705),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 31360),  INT16_C(     0), -INT16_C(  4105),  INT16_C(     0), -INT16_C( 12581), -INT16_C(  1356), -INT16_C(  9761),
+       INT16_C( 24263), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25481),  INT16_C(     0),  INT16_C( 29457),
+      -INT16_C( 12581),  INT16_C(     0), -INT16_C(  7143),  INT16_C(     0),  INT16_C( 15848),  INT16_C(     0),  INT16_C( 25143),  INT16_C(     0),
+      -INT16_C(  9279),  INT16_C(     0), -INT16_C(  3105),  INT16_C(     0),  INT16_C(   863),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 12581),  INT16_C(  1585),  INT16_C(     0), -INT16_C(  1118),  INT16_C(  5910),  INT16_C(     0),
+      -INT16_C( 12581), -INT16_C( 11654),  INT16_C(     0), -INT16_C( 10512),  INT16_C( 29431), -INT16_C(  4944), -INT16_C(   507),  INT16_C(     0),
+       INT16_C( 31544),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C(    75),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2617),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15167),  INT16_C( 17804),  INT16_C(     0),  INT16_C( 29038),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21350), -INT16_C( 12581),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C( 12624),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7039), -INT16_C( 12581),
+       INT16_C(     0),  INT16_C(  9924), -INT16_C( 12581), -INT16_C(  8738), -INT16_C(  1959), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7983), -INT16_C( 12581), -INT16_C(  9212), -INT16_C( 12581),
+       INT16_C(  5741),  INT16_C(     0), -INT16_C( 12581),  INT16_C(  7425),  INT16_C(     0),  INT16_C(  1500),  INT16_C( 16254),  INT16_C(  1368),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C( 10158), -INT16_C(  8875),  INT16_C( 26950),  INT16_C( 19085), -INT16_C(  8635),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C( 26325), -INT16_C( 12581),  INT16_C( 28779), -INT16_C( 12581),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  9958),  INT16_C( 24745),  INT16_C( 13890), -INT16_C( 12581), -INT16_C( 12581),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 19394),  INT16_C(     0), -INT16_C(  9806),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   220),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C( 30082), -INT16_C( 12581), -INT16_C( 10324),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),
+      -INT16_C( 12581),  INT16_C(     0),  INT16_C(  9764),  INT16_C( 27988), -INT16_C( 12581),  INT16_C(  9638), -INT16_C( 12581),  INT16_C(  3876),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(  1894),  INT16_C(     0),  INT16_C(  1759),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(  1834),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29115),  INT16_C( 24974), -INT16_C(  5226),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 10837),  INT16_C(     0),  INT16_C( 20445), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581),
+      -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   687),  INT16_C(     0),
+      -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581),  INT16_C(  6672),  INT16_C(     0),  INT16_C(  3544),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 22699),  INT16_C(     0),  INT16_C( 25164), -INT16_C(   983),  INT16_C(  7780),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 12581),  INT16_C( 25171), -INT16_C(  9550), -INT16_C( 12581),  INT16_C(     0), -INT16_C( 12581), -INT16_C( 12581) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_n_s16_z(pv, av, b);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    ev = simde_svmax_n_s16_z(pv, av, b);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) };
+  static const int16_t a[] =
+    { -INT16_C( 24879), -INT16_C(  4607), -INT16_C(  7468), -INT16_C( 17317),  INT16_C( 11512),  INT16_C( 14134),  INT16_C( 10707), -INT16_C(  6985),
+      -INT16_C( 25061), -INT16_C( 24246), -INT16_C(  8788),  INT16_C( 26166),  INT16_C( 13663),  INT16_C(  5652), -INT16_C( 19827),  INT16_C( 24306),
+      -INT16_C(  3248),  INT16_C(  9292), -INT16_C( 22571), -INT16_C( 12832),  INT16_C(  5843), -INT16_C( 23035), -INT16_C( 17345),  INT16_C( 23435),
+      -INT16_C( 10918),  INT16_C(  2044),  INT16_C( 12978),  INT16_C(  4461), -INT16_C( 32409), -INT16_C(  3032),  INT16_C(  6707), -INT16_C( 31918),
+      -INT16_C( 24819), -INT16_C(  7512), -INT16_C( 30650),  INT16_C(  6832), -INT16_C( 19041), -INT16_C(  8512),  INT16_C( 19313), -INT16_C( 13511),
+       INT16_C( 13857), -INT16_C( 11310),  INT16_C( 16488), -INT16_C( 12059),  INT16_C(  3521), -INT16_C(  2620),  INT16_C(  5927),  INT16_C( 13432),
+       INT16_C(  8374), -INT16_C(  1002), -INT16_C( 14679),  INT16_C( 18454), -INT16_C( 10373), -INT16_C(  5082),  INT16_C( 24610),  INT16_C( 17336),
+      -INT16_C( 30058), -INT16_C(   489), -INT16_C(   822), -INT16_C( 29490), -INT16_C( 27895),  INT16_C( 12417), -INT16_C(  1622),  INT16_C( 24676),
+       INT16_C( 31258), -INT16_C( 15524),  INT16_C( 29505), -INT16_C( 17397),  INT16_C( 12618),  INT16_C( 27817),  INT16_C( 24977),  INT16_C( 10160),
+      -INT16_C( 14357), -INT16_C( 18906), -INT16_C(  2877), -INT16_C( 13246), -INT16_C( 15481),  INT16_C( 12796),  INT16_C( 24764), -INT16_C( 10607),
+      -INT16_C(  4390),  INT16_C(  7065), -INT16_C( 23455), -INT16_C( 21544), -INT16_C( 32298),  INT16_C( 26391), -INT16_C( 14366), -INT16_C( 12913),
+      -INT16_C( 19058),  INT16_C( 20867), -INT16_C( 14935),  INT16_C( 12573),  INT16_C(  6536),  INT16_C( 17762), -INT16_C(  2951),  INT16_C( 21531),
+      -INT16_C( 18974),  INT16_C( 17263),  INT16_C( 18265),  INT16_C( 12270),  INT16_C(  1480), -INT16_C( 21865),  INT16_C(  9933),  INT16_C( 23416),
+      -INT16_C(  1061), -INT16_C( 31571), -INT16_C( 13631),  INT16_C( 18869),  INT16_C(  6372),  INT16_C( 23950), -INT16_C( 22004), -INT16_C(  4431),
+       INT16_C(  8543), -INT16_C( 18383),  INT16_C(  8040),  INT16_C( 12776),  INT16_C( 32548), -INT16_C(  3621),  INT16_C( 21413), -INT16_C( 32691),
+      -INT16_C(  1457),  INT16_C(  4100), -INT16_C( 17724), -INT16_C( 22439), -INT16_C(  5934), -INT16_C(  8698), -INT16_C( 18542), -INT16_C(  3636),
+      -INT16_C(   552),  INT16_C( 16809), -INT16_C( 28388),  INT16_C( 16498),  INT16_C( 19728), -INT16_C( 19150),  INT16_C( 32673), -INT16_C(  4043),
+       INT16_C( 14969),  INT16_C( 15616),  INT16_C( 23028), -INT16_C( 14618), -INT16_C(  5055), -INT16_C( 11356),  INT16_C( 28835),  INT16_C( 31940),
+       INT16_C( 28269), -INT16_C( 30275),  INT16_C( 12287),  INT16_C(  4297), -INT16_C(  1156),  INT16_C(  7621), -INT16_C(  1158), -INT16_C(  3315),
+       INT16_C(  3381),  INT16_C( 10545),  INT16_C(  5991), -INT16_C( 22289), -INT16_C( 27901), -INT16_C( 22916),  INT16_C( 16387),  INT16_C( 28706),
+      -INT16_C(  8274), -INT16_C( 20743), -INT16_C( 15858), -INT16_C( 29762), -INT16_C( 31810),  INT16_C( 14504), -INT16_C( 18818), -INT16_C( 19668),
+       INT16_C( 24003),  INT16_C( 10972), -INT16_C( 13452),  INT16_C( 30675),  INT16_C( 20318),  INT16_C( 24861),  INT16_C( 16527),  INT16_C( 16081),
+      -INT16_C( 13793),  INT16_C( 12012), -INT16_C( 21875),  INT16_C( 19385),  INT16_C( 24877), -INT16_C( 21373), -INT16_C( 20713), -INT16_C(  9377),
+       INT16_C( 15372), -INT16_C( 32763), -INT16_C( 10233),  INT16_C( 26359),  INT16_C(  5415), -INT16_C( 18489), -INT16_C( 26283),  INT16_C( 29941),
+      -INT16_C(  7837), -INT16_C(  3934),  INT16_C( 23435), -INT16_C( 18373), -INT16_C( 16451), -INT16_C( 11164), -INT16_C( 15250),  INT16_C( 31663),
+      -INT16_C( 19200),  INT16_C(  2043), -INT16_C(  3187), -INT16_C( 19091),  INT16_C( 13576),  INT16_C( 23916),  INT16_C( 25038),  INT16_C( 12753),
+       INT16_C( 29762), -INT16_C( 13022),  INT16_C( 24015), -INT16_C( 29563), -INT16_C(  5604), -INT16_C( 29855),  INT16_C(  4270), -INT16_C( 20986),
+       INT16_C(   453),  INT16_C( 21429),  INT16_C(  9204), -INT16_C(  1016),  INT16_C( 29784),  INT16_C(  9817),  INT16_C( 11221),  INT16_C(  5975),
+       INT16_C( 31135),  INT16_C( 28388),  INT16_C( 27095), -INT16_C(  3077),  INT16_C( 23635),  INT16_C(   382), -INT16_C( 31636),  INT16_C( 12975),
+       INT16_C( 25990),  INT16_C( 31365), -INT16_C( 29304), -INT16_C(  8073), -INT16_C( 12287), -INT16_C( 10746),  INT16_C( 24059), -INT16_C( 25875),
+      -INT16_C( 11817), -INT16_C( 20983),  INT16_C(  1082), -INT16_C( 29023),  INT16_C(  8288), -INT16_C( 13169),  INT16_C( 16292),  INT16_C( 11006),
+      -INT16_C( 31836),  INT16_C( 11429),  INT16_C(  7184),  INT16_C(  4364),  INT16_C(  4844), -INT16_C(  5913), -INT16_C( 11153),  INT16_C( 18050),
+      -INT16_C( 29787), -INT16_C(  7948), -INT16_C( 26993), -INT16_C(  4242), -INT16_C(   586),  INT16_C( 23228), -INT16_C( 17860), -INT16_C(  8059),
+       INT16_C( 10814),  INT16_C( 19980),  INT16_C(  6214),  INT16_C( 12896),  INT16_C( 18218), -INT16_C( 26086), -INT16_C( 25316), -INT16_C( 15904),
+      -INT16_C( 10968), -INT16_C( 18271),  INT16_C(  3947),  INT16_C(  8615),  INT16_C( 25357),  INT16_C( 18811),  INT16_C(    30),  INT16_C( 23594),
+       INT16_C( 13866),  INT16_C( 28842),  INT16_C(  2639),  INT16_C( 31139), -INT16_C( 17070),  INT16_C( 28179), -INT16_C(  2982), -INT16_C( 31953),
+      -INT16_C( 11831),  INT16_C( 13371), -INT16_C(  7456), -INT16_C(  4779), -INT16_C( 12218),  INT16_C( 25655),  INT16_C( 25041), -INT16_C(  1088),
+       INT16_C( 27287), -INT16_C(  6548),  INT16_C(  3957), -INT16_C( 14496),  INT16_C( 29644),  INT16_C( 10037),  INT16_C( 25703),  INT16_C( 12458),
+      -INT16_C(  6859),  INT16_C(  5732), -INT16_C( 17977),  INT16_C(  3331),  INT16_C( 14986),  INT16_C( 23409),  INT16_C( 12699),  INT16_C( 13142),
+      -INT16_C( 15716),  INT16_C(  4377),  INT16_C( 31185), -INT16_C( 24872),  INT16_C(  3565),  INT16_C( 21701),  INT16_C( 28529), -INT16_C( 22651),
+      -INT16_C(  5804),  INT16_C(  7101), -INT16_C( 16221),  INT16_C( 11561), -INT16_C( 25861), -INT16_C( 27000), -INT16_C(  8500),  INT16_C( 26825),
+      -INT16_C(  7263),  INT16_C( 29305),  INT16_C( 20828),  INT16_C( 18704), -INT16_C( 10914), -INT16_C( 12386),  INT16_C(  9028), -INT16_C( 26506),
+       INT16_C( 13068), -INT16_C( 20556), -INT16_C(  8716), -INT16_C(  4132),  INT16_C( 25719),  INT16_C( 17285),  INT16_C( 20291), -INT16_C(  6997),
+       INT16_C(  9266), -INT16_C( 29098),  INT16_C( 26485), -INT16_C( 11304),  INT16_C( 30268), -INT16_C( 32349),  INT16_C(  6553), -INT16_C( 23271),
+      -INT16_C( 12979),  INT16_C( 16725),  INT16_C( 12714),  INT16_C(  8752), -INT16_C( 19050), -INT16_C(  9883),  INT16_C(  4356),  INT16_C( 14013),
+       INT16_C(  4917), -INT16_C( 21563), -INT16_C( 25222), -INT16_C( 18562),  INT16_C(  8467), -INT16_C( 21448),  INT16_C( 20795), -INT16_C( 30639),
+      -INT16_C( 23009), -INT16_C( 13879), -INT16_C(  1576),  INT16_C( 28395),  INT16_C( 20910), -INT16_C( 19641),  INT16_C(  1122), -INT16_C( 26647),
+      -INT16_C( 20969), -INT16_C( 28094), -INT16_C( 16053),  INT16_C( 24137), -INT16_C( 32286),  INT16_C(  7434),  INT16_C( 23762), -INT16_C(  3675),
+       INT16_C( 28162), -INT16_C(  9541), -INT16_C( 22937),  INT16_C(  5704), -INT16_C( 28681),  INT16_C( 22985), -INT16_C( 19821), -INT16_C( 21519),
+       INT16_C( 13153), -INT16_C( 21443), -INT16_C( 30988), -INT16_C( 10485),  INT16_C(  5383), -INT16_C(  9740), -INT16_C( 25999) };
+  static const int16_t b = -INT16_C( 19565);
+  static const int16_t e[] =
+    { -INT16_C( 24879), -INT16_C(  4607), -INT16_C(  7468), -INT16_C( 17317),  INT16_C( 11512),  INT16_C( 14134),  INT16_C( 10707), -INT16_C(  6985),
+      -INT16_C( 25061), -INT16_C( 19565), -INT16_C(  8788),  INT16_C( 26166),  INT16_C( 13663),  INT16_C(  5652), -INT16_C( 19565),  INT16_C( 24306),
+      -INT16_C(  3248),  INT16_C(  9292), -INT16_C( 22571), -INT16_C( 12832),  INT16_C(  5843), -INT16_C( 19565), -INT16_C( 17345),  INT16_C( 23435),
+      -INT16_C( 10918),  INT16_C(  2044),  INT16_C( 12978),  INT16_C(  4461), -INT16_C( 32409), -INT16_C(  3032),  INT16_C(  6707), -INT16_C( 31918),
+      -INT16_C( 19565), -INT16_C(  7512), -INT16_C( 19565),  INT16_C(  6832), -INT16_C( 19041), -INT16_C(  8512),  INT16_C( 19313), -INT16_C( 13511),
+       INT16_C( 13857), -INT16_C( 11310),  INT16_C( 16488), -INT16_C( 12059),  INT16_C(  3521), -INT16_C(  2620),  INT16_C(  5927),  INT16_C( 13432),
+       INT16_C(  8374), -INT16_C(  1002), -INT16_C( 14679),  INT16_C( 18454), -INT16_C( 10373), -INT16_C(  5082),  INT16_C( 24610),  INT16_C( 17336),
+      -INT16_C( 30058), -INT16_C(   489), -INT16_C(   822), -INT16_C( 29490), -INT16_C( 27895),  INT16_C( 12417), -INT16_C(  1622),  INT16_C( 24676),
+       INT16_C( 31258), -INT16_C( 15524),  INT16_C( 29505), -INT16_C( 17397),  INT16_C( 12618),  INT16_C( 27817),  INT16_C( 24977),  INT16_C( 10160),
+      -INT16_C( 14357), -INT16_C( 18906), -INT16_C(  2877), -INT16_C( 13246), -INT16_C( 15481),  INT16_C( 12796),  INT16_C( 24764), -INT16_C( 10607),
+      -INT16_C(  4390),  INT16_C(  7065), -INT16_C( 19565), -INT16_C( 19565), -INT16_C( 32298),  INT16_C( 26391), -INT16_C( 14366), -INT16_C( 12913),
+      -INT16_C( 19058),  INT16_C( 20867), -INT16_C( 14935),  INT16_C( 12573),  INT16_C(  6536),  INT16_C( 17762), -INT16_C(  2951),  INT16_C( 21531),
+      -INT16_C( 18974),  INT16_C( 17263),  INT16_C( 18265),  INT16_C( 12270),  INT16_C(  1480), -INT16_C( 19565),  INT16_C(  9933),  INT16_C( 23416),
+      -INT16_C(  1061), -INT16_C( 19565), -INT16_C( 13631),  INT16_C( 18869),  INT16_C(  6372),  INT16_C( 23950), -INT16_C( 22004), -INT16_C(  4431),
+       INT16_C(  8543), -INT16_C( 18383),  INT16_C(  8040),  INT16_C( 12776),  INT16_C( 32548), -INT16_C(  3621),  INT16_C( 21413), -INT16_C( 19565),
+      -INT16_C(  1457),  INT16_C(  4100), -INT16_C( 17724), -INT16_C( 22439), -INT16_C(  5934), -INT16_C(  8698), -INT16_C( 18542), -INT16_C(  3636),
+      -INT16_C(   552),  INT16_C( 16809), -INT16_C( 28388),  INT16_C( 16498),  INT16_C( 19728), -INT16_C( 19150),  INT16_C( 32673), -INT16_C(  4043),
+       INT16_C( 14969),  INT16_C( 15616),  INT16_C( 23028), -INT16_C( 14618), -INT16_C(  5055), -INT16_C( 11356),  INT16_C( 28835),  INT16_C( 31940),
+       INT16_C( 28269), -INT16_C( 30275),  INT16_C( 12287),  INT16_C(  4297), -INT16_C(  1156),  INT16_C(  7621), -INT16_C(  1158), -INT16_C(  3315),
+       INT16_C(  3381),  INT16_C( 10545),  INT16_C(  5991), -INT16_C( 22289), -INT16_C( 19565), -INT16_C( 19565),  INT16_C( 16387),  INT16_C( 28706),
+      -INT16_C(  8274), -INT16_C( 19565), -INT16_C( 15858), -INT16_C( 19565), -INT16_C( 31810),  INT16_C( 14504), -INT16_C( 18818), -INT16_C( 19565),
+       INT16_C( 24003),  INT16_C( 10972), -INT16_C( 13452),  INT16_C( 30675),  INT16_C( 20318),  INT16_C( 24861),  INT16_C( 16527),  INT16_C( 16081),
+      -INT16_C( 13793),  INT16_C( 12012), -INT16_C( 19565),  INT16_C( 19385),  INT16_C( 24877), -INT16_C( 19565), -INT16_C( 19565), -INT16_C(  9377),
+       INT16_C( 15372), -INT16_C( 32763), -INT16_C( 10233),  INT16_C( 26359),  INT16_C(  5415), -INT16_C( 18489), -INT16_C( 19565),  INT16_C( 29941),
+      -INT16_C(  7837), -INT16_C(  3934),  INT16_C( 23435), -INT16_C( 18373), -INT16_C( 16451), -INT16_C( 11164), -INT16_C( 15250),  INT16_C( 31663),
+      -INT16_C( 19200),  INT16_C(  2043), -INT16_C(  3187), -INT16_C( 19091),  INT16_C( 13576),  INT16_C( 23916),  INT16_C( 25038),  INT16_C( 12753),
+       INT16_C( 29762), -INT16_C( 13022),  INT16_C( 24015), -INT16_C( 29563), -INT16_C(  5604), -INT16_C( 19565),  INT16_C(  4270), -INT16_C( 20986),
+       INT16_C(   453),  INT16_C( 21429),  INT16_C(  9204), -INT16_C(  1016),  INT16_C( 29784),  INT16_C(  9817),  INT16_C( 11221),  INT16_C(  5975),
+       INT16_C( 31135),  INT16_C( 28388),  INT16_C( 27095), -INT16_C(  3077),  INT16_C( 23635),  INT16_C(   382), -INT16_C( 19565),  INT16_C( 12975),
+       INT16_C( 25990),  INT16_C( 31365), -INT16_C( 19565), -INT16_C(  8073), -INT16_C( 12287), -INT16_C( 10746),  INT16_C( 24059), -INT16_C( 19565),
+      -INT16_C( 11817), -INT16_C( 20983),  INT16_C(  1082), -INT16_C( 19565),  INT16_C(  8288), -INT16_C( 13169),  INT16_C( 16292),  INT16_C( 11006),
+      -INT16_C( 19565),  INT16_C( 11429),  INT16_C(  7184),  INT16_C(  4364),  INT16_C(  4844), -INT16_C(  5913), -INT16_C( 11153),  INT16_C( 18050),
+      -INT16_C( 29787), -INT16_C(  7948), -INT16_C( 26993), -INT16_C(  4242), -INT16_C(   586),  INT16_C( 23228), -INT16_C( 17860), -INT16_C(  8059),
+       INT16_C( 10814),  INT16_C( 19980),  INT16_C(  6214),  INT16_C( 12896),  INT16_C( 18218), -INT16_C( 26086), -INT16_C( 19565), -INT16_C( 15904),
+      -INT16_C( 10968), -INT16_C( 18271),  INT16_C(  3947),  INT16_C(  8615),  INT16_C( 25357),  INT16_C( 18811),  INT16_C(    30),  INT16_C( 23594),
+       INT16_C( 13866),  INT16_C( 28842),  INT16_C(  2639),  INT16_C( 31139), -INT16_C( 17070),  INT16_C( 28179), -INT16_C(  2982), -INT16_C( 19565),
+      -INT16_C( 11831),  INT16_C( 13371), -INT16_C(  7456), -INT16_C(  4779), -INT16_C( 12218),  INT16_C( 25655),  INT16_C( 25041), -INT16_C(  1088),
+       INT16_C( 27287), -INT16_C(  6548),  INT16_C(  3957), -INT16_C( 14496),  INT16_C( 29644),  INT16_C( 10037),  INT16_C( 25703),  INT16_C( 12458),
+      -INT16_C(  6859),  INT16_C(  5732), -INT16_C( 17977),  INT16_C(  3331),  INT16_C( 14986),  INT16_C( 23409),  INT16_C( 12699),  INT16_C( 13142),
+      -INT16_C( 15716),  INT16_C(  4377),  INT16_C( 31185), -INT16_C( 24872),  INT16_C(  3565),  INT16_C( 21701),  INT16_C( 28529), -INT16_C( 19565),
+      -INT16_C(  5804),  INT16_C(  7101), -INT16_C( 16221),  INT16_C( 11561), -INT16_C( 25861), -INT16_C( 27000), -INT16_C(  8500),  INT16_C( 26825),
+      -INT16_C(  7263),  INT16_C( 29305),  INT16_C( 20828),  INT16_C( 18704), -INT16_C( 10914), -INT16_C( 12386),  INT16_C(  9028), -INT16_C( 19565),
+       INT16_C( 13068), -INT16_C( 20556), -INT16_C(  8716), -INT16_C(  4132),  INT16_C( 25719),  INT16_C( 17285),  INT16_C( 20291), -INT16_C(  6997),
+       INT16_C(  9266), -INT16_C( 19565),  INT16_C( 26485), -INT16_C( 11304),  INT16_C( 30268), -INT16_C( 32349),  INT16_C(  6553), -INT16_C( 23271),
+      -INT16_C( 12979),  INT16_C( 16725),  INT16_C( 12714),  INT16_C(  8752), -INT16_C( 19050), -INT16_C(  9883),  INT16_C(  4356),  INT16_C( 14013),
+       INT16_C(  4917), -INT16_C( 21563), -INT16_C( 25222), -INT16_C( 18562),  INT16_C(  8467), -INT16_C( 21448),  INT16_C( 20795), -INT16_C( 30639),
+      -INT16_C( 23009), -INT16_C( 13879), -INT16_C(  1576),  INT16_C( 28395),  INT16_C( 20910), -INT16_C( 19565),  INT16_C(  1122), -INT16_C( 19565),
+      -INT16_C( 20969), -INT16_C( 19565), -INT16_C( 16053),  INT16_C( 24137), -INT16_C( 32286),  INT16_C(  7434),  INT16_C( 23762), -INT16_C(  3675),
+       INT16_C( 28162), -INT16_C(  9541), -INT16_C( 19565),  INT16_C(  5704), -INT16_C( 28681),  INT16_C( 22985), -INT16_C( 19821), -INT16_C( 21519),
+       INT16_C( 13153), -INT16_C( 19565), -INT16_C( 30988), -INT16_C( 10485),  INT16_C(  5383), -INT16_C(  9740), -INT16_C( 25999) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_n_s16_m(pv, av, b);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    ev = simde_svmax_n_s16_m(pv, av, b);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const int32_t a[] =
+    { -INT32_C(  1033588243), -INT32_C(   273075105),  INT32_C(   843820725), -INT32_C(   976446185),  INT32_C(   946470487),  INT32_C(  1390802944), -INT32_C(   743312119),  INT32_C(  1272095837),
+      -INT32_C(  1257425322),  INT32_C(   547669611), -INT32_C(  1940656011), -INT32_C(   447602803),  INT32_C(   505264925), -INT32_C(  1133509965),  INT32_C(  1435443959),  INT32_C(   480272838),
+       INT32_C(    64073112), -INT32_C(   400329101), -INT32_C(   210405786), -INT32_C(  1277638763),  INT32_C(   902952578), -INT32_C(   252558856),  INT32_C(   709198179),  INT32_C(  2068243939),
+       INT32_C(    92149906), -INT32_C(   185687666), -INT32_C(  1377344744), -INT32_C(  1402945494), -INT32_C(  1360973386), -INT32_C(   694234253),  INT32_C(   939582293),  INT32_C(  1521698760),
+      -INT32_C(   312463009), -INT32_C(   354332974), -INT32_C(   610744143),  INT32_C(  1049098376), -INT32_C(  1645385686), -INT32_C(  1854698692),  INT32_C(   935949423),  INT32_C(   445807803),
+       INT32_C(  2131227309), -INT32_C(   244651968),  INT32_C(   969671344),  INT32_C(   611800058), -INT32_C(   138320709),  INT32_C(  1602762224),  INT32_C(  1687572905),  INT32_C(  2055088333),
+       INT32_C(  1526367514),  INT32_C(   491480173),  INT32_C(  1616254822),  INT32_C(   646303338),  INT32_C(   572343858),  INT32_C(   612476539), -INT32_C(   980936457),  INT32_C(  1530857024),
+      -INT32_C(   122340981),  INT32_C(    51773853), -INT32_C(  2090570728),  INT32_C(  1839851834), -INT32_C(  1416640977),  INT32_C(  1691292012),  INT32_C(  1764317225), -INT32_C(   356226978),
+       INT32_C(  1071807138), -INT32_C(  1824262021), -INT32_C(  1625905307), -INT32_C(  1089683568), -INT32_C(   227894138), -INT32_C(   698991955), -INT32_C(   264274030), -INT32_C(  1965423384),
+      -INT32_C(   104219266),  INT32_C(   445385909),  INT32_C(  1136305075), -INT32_C(   402405790),  INT32_C(   266038626),  INT32_C(   971321767), -INT32_C(  1725291087), -INT32_C(  1490877399),
+       INT32_C(  2007035073), -INT32_C(  1399771911),  INT32_C(   854608847),  INT32_C(  1947923218),  INT32_C(   142931296), -INT32_C(   666801881), -INT32_C(  1217303666),  INT32_C(   828281968),
+       INT32_C(  2041118336), -INT32_C(    98158037), -INT32_C(  1758718331),  INT32_C(  1762412297),  INT32_C(  1668386876), -INT32_C(  2009353223), -INT32_C(  1908429794), -INT32_C(  1044341184),
+      -INT32_C(   952473444),  INT32_C(   683827362),  INT32_C(  2143284854),  INT32_C(  1927924533),  INT32_C(  1440045659),  INT32_C(   752685325), -INT32_C(    21357379),  INT32_C(  1472166586),
+      -INT32_C(  2061567517), -INT32_C(   793911206),  INT32_C(    72379855), -INT32_C(  1804191432), -INT32_C(  1578546029),  INT32_C(   449693277), -INT32_C(  1659336734), -INT32_C(   436939006),
+       INT32_C(   728371921), -INT32_C(  1023731469), -INT32_C(  1111078011),  INT32_C(   407977348), -INT32_C(   424068471), -INT32_C(   486504960),  INT32_C(   260053261), -INT32_C(  1040943888),
+       INT32_C(  2045534086), -INT32_C(    63182729), -INT32_C(  1195834829), -INT32_C(   925889729),  INT32_C(  1185843525),  INT32_C(   472493583), -INT32_C(  1205032505), -INT32_C(  1552343011),
+      -INT32_C(   165845377), -INT32_C(  2114824114), -INT32_C(  1724273574), -INT32_C(    60749385), -INT32_C(  1589506158), -INT32_C(  2051118146),  INT32_C(   826141204), -INT32_C(  1965705462),
+       INT32_C(  1803612701), -INT32_C(  1511230646), -INT32_C(   700570081), -INT32_C(  1026383825),  INT32_C(  1835210159), -INT32_C(  1779228288),  INT32_C(   382087179),  INT32_C(    77634535),
+      -INT32_C(   663805811), -INT32_C(  1300407149), -INT32_C(  1316439166),  INT32_C(   192109403), -INT32_C(   260515984),  INT32_C(    75852792), -INT32_C(  2095428452),  INT32_C(  1971895015),
+       INT32_C(  1850603482), -INT32_C(   719271341), -INT32_C(   511202939),  INT32_C(  1961687556), -INT32_C(   899390255),  INT32_C(  1825499856),  INT32_C(   502261814),  INT32_C(  2089973666),
+      -INT32_C(  1024794769),  INT32_C(   798493609), -INT32_C(  1206902860), -INT32_C(   349373415),  INT32_C(   817205344), -INT32_C(  1331920006),  INT32_C(   231640171),  INT32_C(  1921605635),
+      -INT32_C(   382372800),  INT32_C(   857263487),  INT32_C(    99297516), -INT32_C(  2047863004),  INT32_C(   582329767), -INT32_C(  1814932952), -INT32_C(   509566754),  INT32_C(  1096034817),
+       INT32_C(   489327006),  INT32_C(  1112556374), -INT32_C(  1874379925), -INT32_C(   116049838),  INT32_C(   102484701), -INT32_C(    90575332), -INT32_C(  1881392498),  INT32_C(    47198308),
+       INT32_C(   253754297), -INT32_C(  1454280898), -INT32_C(    63334230), -INT32_C(  1359655216),  INT32_C(   900993305), -INT32_C(  1926214145), -INT32_C(   350417785), -INT32_C(   168956612),
+       INT32_C(   637799656),  INT32_C(   634410363), -INT32_C(  1105131027),  INT32_C(  1902909272),  INT32_C(   665198632), -INT32_C(   172698003),  INT32_C(   518050274), -INT32_C(  1491874113),
+       INT32_C(  1456347098),  INT32_C(  1518050924), -INT32_C(    15163993), -INT32_C(   596605772),  INT32_C(   285415332), -INT32_C(   804866067),  INT32_C(  1223616393), -INT32_C(  1880161611),
+      -INT32_C(  2031764199),  INT32_C(    65036635), -INT32_C(  1308428034),  INT32_C(   546206588),  INT32_C(  1999737226), -INT32_C(   783861688), -INT32_C(   736545249),  INT32_C(  1365444920),
+       INT32_C(   584534470), -INT32_C(  1473923158),  INT32_C(   727328687),  INT32_C(   608954522), -INT32_C(  1046708871), -INT32_C(   728505419),  INT32_C(  1370008601),  INT32_C(  2091060149),
+      -INT32_C(    23168428), -INT32_C(   509164750), -INT32_C(  2062745366),  INT32_C(  1638488296), -INT32_C(  1977399851),  INT32_C(  1113503273),  INT32_C(   412354146),  INT32_C(  1720989458),
+      -INT32_C(   479907151), -INT32_C(   540734475), -INT32_C(   194719220),  INT32_C(     5639722),  INT32_C(  2089449811), -INT32_C(  1849693905),  INT32_C(    27874287),  INT32_C(   996687242),
+       INT32_C(  1679805807), -INT32_C(   465247016), -INT32_C(   522606410),  INT32_C(   182464438) };
+  static const int32_t b = -INT32_C(  1818662350);
+  static const int32_t e[] =
+    { -INT32_C(  1033588243), -INT32_C(   273075105),  INT32_C(   843820725), -INT32_C(   976446185),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   547669611),  INT32_C(           0),  INT32_C(           0),  INT32_C(   505264925), -INT32_C(  1133509965),  INT32_C(           0),  INT32_C(   480272838),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1277638763),  INT32_C(   902952578),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(    92149906), -INT32_C(   185687666),  INT32_C(           0), -INT32_C(  1402945494), -INT32_C(  1360973386),  INT32_C(           0),  INT32_C(   939582293),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(   354332974),  INT32_C(           0),  INT32_C(  1049098376), -INT32_C(  1645385686),  INT32_C(           0),  INT32_C(           0),  INT32_C(   445807803),
+       INT32_C(  2131227309), -INT32_C(   244651968),  INT32_C(   969671344),  INT32_C(           0), -INT32_C(   138320709),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2055088333),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   612476539),  INT32_C(           0),  INT32_C(  1530857024),
+       INT32_C(           0),  INT32_C(    51773853), -INT32_C(  1818662350),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1691292012),  INT32_C(  1764317225), -INT32_C(   356226978),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(  1625905307),  INT32_C(           0), -INT32_C(   227894138), -INT32_C(   698991955),  INT32_C(           0), -INT32_C(  1818662350),
+       INT32_C(           0),  INT32_C(   445385909),  INT32_C(           0),  INT32_C(           0),  INT32_C(   266038626),  INT32_C(   971321767), -INT32_C(  1725291087), -INT32_C(  1490877399),
+       INT32_C(  2007035073),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1947923218),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1217303666),  INT32_C(   828281968),
+       INT32_C(  2041118336), -INT32_C(    98158037), -INT32_C(  1758718331),  INT32_C(  1762412297),  INT32_C(           0), -INT32_C(  1818662350), -INT32_C(  1818662350),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   683827362),  INT32_C(  2143284854),  INT32_C(  1927924533),  INT32_C(  1440045659),  INT32_C(           0), -INT32_C(    21357379),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1578546029),  INT32_C(   449693277),  INT32_C(           0), -INT32_C(   436939006),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   486504960),  INT32_C(   260053261),  INT32_C(           0),
+       INT32_C(  2045534086), -INT32_C(    63182729),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   472493583),  INT32_C(           0), -INT32_C(  1552343011),
+      -INT32_C(   165845377), -INT32_C(  1818662350),  INT32_C(           0), -INT32_C(    60749385), -INT32_C(  1589506158), -INT32_C(  1818662350),  INT32_C(   826141204), -INT32_C(  1818662350),
+       INT32_C(  1803612701), -INT32_C(  1511230646),  INT32_C(           0), -INT32_C(  1026383825),  INT32_C(  1835210159),  INT32_C(           0),  INT32_C(           0),  INT32_C(    77634535),
+       INT32_C(           0), -INT32_C(  1300407149),  INT32_C(           0),  INT32_C(           0), -INT32_C(   260515984),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1850603482), -INT32_C(   719271341), -INT32_C(   511202939),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1825499856),  INT32_C(   502261814),  INT32_C(           0),
+      -INT32_C(  1024794769),  INT32_C(           0), -INT32_C(  1206902860),  INT32_C(           0),  INT32_C(   817205344), -INT32_C(  1331920006),  INT32_C(   231640171),  INT32_C(  1921605635),
+      -INT32_C(   382372800),  INT32_C(           0),  INT32_C(    99297516),  INT32_C(           0),  INT32_C(   582329767), -INT32_C(  1814932952), -INT32_C(   509566754),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(  1112556374), -INT32_C(  1818662350),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   253754297), -INT32_C(  1454280898), -INT32_C(    63334230),  INT32_C(           0),  INT32_C(   900993305), -INT32_C(  1818662350),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   637799656),  INT32_C(   634410363),  INT32_C(           0),  INT32_C(  1902909272),  INT32_C(   665198632),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1456347098),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   285415332),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(  1818662350),  INT32_C(    65036635),  INT32_C(           0),  INT32_C(   546206588),  INT32_C(  1999737226), -INT32_C(   783861688), -INT32_C(   736545249),  INT32_C(           0),
+       INT32_C(   584534470), -INT32_C(  1473923158),  INT32_C(   727328687),  INT32_C(   608954522), -INT32_C(  1046708871), -INT32_C(   728505419),  INT32_C(  1370008601),  INT32_C(  2091060149),
+      -INT32_C(    23168428), -INT32_C(   509164750),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1720989458),
+       INT32_C(           0), -INT32_C(   540734475),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    27874287),  INT32_C(   996687242),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(   522606410),  INT32_C(   182464438) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_n_s32_z(pv, av, b);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    ev = simde_svmax_n_s32_z(pv, av, b);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    {  INT32_C(   668247315), -INT32_C(  1305282652),  INT32_C(  1651057391), -INT32_C(   449409638), -INT32_C(  1633486981),  INT32_C(   733634527), -INT32_C(  1761100229), -INT32_C(     5728020),
+      -INT32_C(   500728515),  INT32_C(  1670666612),  INT32_C(   365297019),  INT32_C(   100400266), -INT32_C(   761029133),  INT32_C(   939351548),  INT32_C(   147719452), -INT32_C(   637044835),
+       INT32_C(  1757163252),  INT32_C(    63656071), -INT32_C(   686255795), -INT32_C(  2132995187), -INT32_C(  1403813712), -INT32_C(    85700386), -INT32_C(   234704299),  INT32_C(   499976489),
+      -INT32_C(  1081767624),  INT32_C(   667046362),  INT32_C(  1879038946), -INT32_C(  1611670290),  INT32_C(   978010716), -INT32_C(   399233133),  INT32_C(   198915810),  INT32_C(  2015995968),
+       INT32_C(   188198449), -INT32_C(   516687105), -INT32_C(  1018154283),  INT32_C(  1784823822),  INT32_C(   363179650), -INT32_C(  1073817123),  INT32_C(  1355536656), -INT32_C(  1295453055),
+      -INT32_C(  1564541022), -INT32_C(   830213639),  INT32_C(   831706147), -INT32_C(  1768164332), -INT32_C(  2136194910),  INT32_C(   708815386),  INT32_C(    75106947), -INT32_C(  1581890818),
+       INT32_C(   994276417), -INT32_C(  2012625307), -INT32_C(  1363567718),  INT32_C(   843404688), -INT32_C(  1347227243),  INT32_C(   517599899), -INT32_C(    81636356), -INT32_C(   677586795),
+      -INT32_C(  1307386035),  INT32_C(  1077615525),  INT32_C(  1206842551), -INT32_C(   545705143), -INT32_C(  1081201628),  INT32_C(   450717726),  INT32_C(  1360396219),  INT32_C(   623423960),
+       INT32_C(   920074896),  INT32_C(   209064533),  INT32_C(  1347642375), -INT32_C(  1137717864),  INT32_C(   394051321), -INT32_C(   516859610),  INT32_C(   825378649), -INT32_C(  1990829320),
+      -INT32_C(   356569708),  INT32_C(  1207317824),  INT32_C(   831998617),  INT32_C(   284083991), -INT32_C(  1423480187),  INT32_C(   478959811), -INT32_C(  1739735137), -INT32_C(  1373527271),
+       INT32_C(   295231697), -INT32_C(  1369928171), -INT32_C(   270471208),  INT32_C(  1006620342), -INT32_C(    68803016),  INT32_C(   504918911),  INT32_C(  1270244658), -INT32_C(   621160695),
+      -INT32_C(   856976969), -INT32_C(   126139616), -INT32_C(   370648270),  INT32_C(  1629808425), -INT32_C(  1923347698), -INT32_C(  1330940802), -INT32_C(   470064422), -INT32_C(   239209159),
+      -INT32_C(  1497519994),  INT32_C(   496974059), -INT32_C(  1140422765),  INT32_C(  2082286446), -INT32_C(  1274447306), -INT32_C(   932923922),  INT32_C(  1353408279), -INT32_C(   616470444),
+      -INT32_C(    75366640), -INT32_C(   887545801),  INT32_C(   377954215), -INT32_C(  2137873078),  INT32_C(   221551647),  INT32_C(  1758894161),  INT32_C(  1287160312), -INT32_C(    98043158),
+       INT32_C(   821471737),  INT32_C(  1912278985),  INT32_C(  2038924078),  INT32_C(  1207507240),  INT32_C(   106180277), -INT32_C(  1100076346), -INT32_C(  1777653844),  INT32_C(   445657633),
+      -INT32_C(  1521842469), -INT32_C(  1005173099), -INT32_C(   247620151),  INT32_C(  1815623350),  INT32_C(   728927332),  INT32_C(  1676272055),  INT32_C(   704246792),  INT32_C(    37980455),
+      -INT32_C(  1515746032), -INT32_C(  1670791725),  INT32_C(   294495834),  INT32_C(  1098761693),  INT32_C(   158134098), -INT32_C(   663988528),  INT32_C(  1895916874), -INT32_C(    25934610),
+      -INT32_C(  1515971630),  INT32_C(   859966937), -INT32_C(  1857761356), -INT32_C(   405618283), -INT32_C(  2114961487), -INT32_C(   547726187), -INT32_C(  1353622591),  INT32_C(  1924056480),
+      -INT32_C(  1189653792),  INT32_C(   334322015), -INT32_C(  1096535767), -INT32_C(  1532659725),  INT32_C(  1260754358), -INT32_C(  1305837583),  INT32_C(  2069986267),  INT32_C(   569184064),
+      -INT32_C(  1042676639), -INT32_C(  2016098466), -INT32_C(   330991111), -INT32_C(  1500452112),  INT32_C(  1894888831),  INT32_C(   270670645), -INT32_C(   678722665), -INT32_C(   185042797),
+      -INT32_C(   625618052), -INT32_C(  1822324070), -INT32_C(   209738237),  INT32_C(   261689232), -INT32_C(    92304699),  INT32_C(  1007329701), -INT32_C(  1206610651), -INT32_C(  1985213427),
+       INT32_C(  2053399263), -INT32_C(   284310036), -INT32_C(    52261524),  INT32_C(  1628208028), -INT32_C(  1436841211),  INT32_C(  1390896429),  INT32_C(   118160378), -INT32_C(   409881081),
+       INT32_C(    73528600),  INT32_C(   653487802), -INT32_C(  1742481925),  INT32_C(  1442393936), -INT32_C(   419408454), -INT32_C(  1254496326), -INT32_C(   373537822),  INT32_C(   315641338),
+      -INT32_C(    48811710), -INT32_C(  1692202336),  INT32_C(   808666848),  INT32_C(   814099829),  INT32_C(  1008174722),  INT32_C(  1341215085), -INT32_C(  1908887916),  INT32_C(  1050741243),
+      -INT32_C(   633620422), -INT32_C(  1569300798),  INT32_C(   450079141),  INT32_C(  1481267670),  INT32_C(  1284858591),  INT32_C(  1201374899),  INT32_C(   819385140),  INT32_C(   393115612),
+      -INT32_C(   235820753), -INT32_C(  1399560441), -INT32_C(   406362351), -INT32_C(  1623191104),  INT32_C(   652989811), -INT32_C(  1871804837),  INT32_C(   918570073), -INT32_C(   364040517),
+      -INT32_C(   556056873), -INT32_C(  1215598682) };
+  static const int32_t b = -INT32_C(  1869395484);
+  static const int32_t e[] =
+    {  INT32_C(   668247315), -INT32_C(  1305282652),  INT32_C(  1651057391), -INT32_C(   449409638), -INT32_C(  1633486981),  INT32_C(   733634527), -INT32_C(  1761100229), -INT32_C(     5728020),
+      -INT32_C(   500728515),  INT32_C(  1670666612),  INT32_C(   365297019),  INT32_C(   100400266), -INT32_C(   761029133),  INT32_C(   939351548),  INT32_C(   147719452), -INT32_C(   637044835),
+       INT32_C(  1757163252),  INT32_C(    63656071), -INT32_C(   686255795), -INT32_C(  2132995187), -INT32_C(  1403813712), -INT32_C(    85700386), -INT32_C(   234704299),  INT32_C(   499976489),
+      -INT32_C(  1081767624),  INT32_C(   667046362),  INT32_C(  1879038946), -INT32_C(  1611670290),  INT32_C(   978010716), -INT32_C(   399233133),  INT32_C(   198915810),  INT32_C(  2015995968),
+       INT32_C(   188198449), -INT32_C(   516687105), -INT32_C(  1018154283),  INT32_C(  1784823822),  INT32_C(   363179650), -INT32_C(  1073817123),  INT32_C(  1355536656), -INT32_C(  1295453055),
+      -INT32_C(  1564541022), -INT32_C(   830213639),  INT32_C(   831706147), -INT32_C(  1768164332), -INT32_C(  1869395484),  INT32_C(   708815386),  INT32_C(    75106947), -INT32_C(  1581890818),
+       INT32_C(   994276417), -INT32_C(  1869395484), -INT32_C(  1363567718),  INT32_C(   843404688), -INT32_C(  1347227243),  INT32_C(   517599899), -INT32_C(    81636356), -INT32_C(   677586795),
+      -INT32_C(  1307386035),  INT32_C(  1077615525),  INT32_C(  1206842551), -INT32_C(   545705143), -INT32_C(  1081201628),  INT32_C(   450717726),  INT32_C(  1360396219),  INT32_C(   623423960),
+       INT32_C(   920074896),  INT32_C(   209064533),  INT32_C(  1347642375), -INT32_C(  1137717864),  INT32_C(   394051321), -INT32_C(   516859610),  INT32_C(   825378649), -INT32_C(  1990829320),
+      -INT32_C(   356569708),  INT32_C(  1207317824),  INT32_C(   831998617),  INT32_C(   284083991), -INT32_C(  1423480187),  INT32_C(   478959811), -INT32_C(  1739735137), -INT32_C(  1373527271),
+       INT32_C(   295231697), -INT32_C(  1369928171), -INT32_C(   270471208),  INT32_C(  1006620342), -INT32_C(    68803016),  INT32_C(   504918911),  INT32_C(  1270244658), -INT32_C(   621160695),
+      -INT32_C(   856976969), -INT32_C(   126139616), -INT32_C(   370648270),  INT32_C(  1629808425), -INT32_C(  1923347698), -INT32_C(  1330940802), -INT32_C(   470064422), -INT32_C(   239209159),
+      -INT32_C(  1497519994),  INT32_C(   496974059), -INT32_C(  1140422765),  INT32_C(  2082286446), -INT32_C(  1274447306), -INT32_C(   932923922),  INT32_C(  1353408279), -INT32_C(   616470444),
+      -INT32_C(    75366640), -INT32_C(   887545801),  INT32_C(   377954215), -INT32_C(  2137873078),  INT32_C(   221551647),  INT32_C(  1758894161),  INT32_C(  1287160312), -INT32_C(    98043158),
+       INT32_C(   821471737),  INT32_C(  1912278985),  INT32_C(  2038924078),  INT32_C(  1207507240),  INT32_C(   106180277), -INT32_C(  1100076346), -INT32_C(  1777653844),  INT32_C(   445657633),
+      -INT32_C(  1521842469), -INT32_C(  1005173099), -INT32_C(   247620151),  INT32_C(  1815623350),  INT32_C(   728927332),  INT32_C(  1676272055),  INT32_C(   704246792),  INT32_C(    37980455),
+      -INT32_C(  1515746032), -INT32_C(  1670791725),  INT32_C(   294495834),  INT32_C(  1098761693),  INT32_C(   158134098), -INT32_C(   663988528),  INT32_C(  1895916874), -INT32_C(    25934610),
+      -INT32_C(  1515971630),  INT32_C(   859966937), -INT32_C(  1857761356), -INT32_C(   405618283), -INT32_C(  1869395484), -INT32_C(   547726187), -INT32_C(  1353622591),  INT32_C(  1924056480),
+      -INT32_C(  1189653792),  INT32_C(   334322015), -INT32_C(  1096535767), -INT32_C(  1532659725),  INT32_C(  1260754358), -INT32_C(  1305837583),  INT32_C(  2069986267),  INT32_C(   569184064),
+      -INT32_C(  1042676639), -INT32_C(  2016098466), -INT32_C(   330991111), -INT32_C(  1500452112),  INT32_C(  1894888831),  INT32_C(   270670645), -INT32_C(   678722665), -INT32_C(   185042797),
+      -INT32_C(   625618052), -INT32_C(  1822324070), -INT32_C(   209738237),  INT32_C(   261689232), -INT32_C(    92304699),  INT32_C(  1007329701), -INT32_C(  1206610651), -INT32_C(  1985213427),
+       INT32_C(  2053399263), -INT32_C(   284310036), -INT32_C(    52261524),  INT32_C(  1628208028), -INT32_C(  1436841211),  INT32_C(  1390896429),  INT32_C(   118160378), -INT32_C(   409881081),
+       INT32_C(    73528600),  INT32_C(   653487802), -INT32_C(  1742481925),  INT32_C(  1442393936), -INT32_C(   419408454), -INT32_C(  1254496326), -INT32_C(   373537822),  INT32_C(   315641338),
+      -INT32_C(    48811710), -INT32_C(  1692202336),  INT32_C(   808666848),  INT32_C(   814099829),  INT32_C(  1008174722),  INT32_C(  1341215085), -INT32_C(  1908887916),  INT32_C(  1050741243),
+      -INT32_C(   633620422), -INT32_C(  1569300798),  INT32_C(   450079141),  INT32_C(  1481267670),  INT32_C(  1284858591),  INT32_C(  1201374899),  INT32_C(   819385140),  INT32_C(   393115612),
+      -INT32_C(   235820753), -INT32_C(  1399560441), -INT32_C(   406362351), -INT32_C(  1623191104),  INT32_C(   652989811), -INT32_C(  1869395484),  INT32_C(   918570073), -INT32_C(   364040517),
+      -INT32_C(   556056873), -INT32_C(  1215598682) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_n_s32_m(pv, av, b);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    ev = simde_svmax_n_s32_m(pv, av, b);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0) };
+  static const int64_t a[] =
+    { -INT64_C( 3178924836661836138), -INT64_C( 2524528218302523239), -INT64_C( 7569579938628974955), -INT64_C( 6003270719953437781),
+      -INT64_C( 7753028141356692768), -INT64_C( 5881545972624521331), -INT64_C( 7633506898534107053), -INT64_C( 5399106951175685040),
+       INT64_C( 3017044080909280847),  INT64_C( 6089161373150639289), -INT64_C( 8717034599536991612), -INT64_C( 5898026252078556517),
+      -INT64_C( 2690102387997642522), -INT64_C( 1684576731606984886), -INT64_C( 1671014350223610352), -INT64_C( 6681795119381168840),
+       INT64_C( 6767449070859730414), -INT64_C( 2994533363481012442),  INT64_C( 6839539731615631797), -INT64_C( 5761728170919902294),
+       INT64_C( 2659282115211833207), -INT64_C( 8296439930139340990), -INT64_C( 7823462935794025496),  INT64_C( 1454105903685657276),
+      -INT64_C( 2713833737201652172),  INT64_C(  826902167634969622),  INT64_C( 4483199849727592635),  INT64_C( 7825824831009207017),
+      -INT64_C( 3005038119450887720), -INT64_C( 6330023762158473735), -INT64_C( 5763055254085287611), -INT64_C( 8837520778100030794),
+      -INT64_C( 1684273762478393078), -INT64_C( 1944380071866965137), -INT64_C( 8510200400149983123), -INT64_C(  601843059290334093),
+       INT64_C( 5450308674214075339),  INT64_C( 4777100758500223174),  INT64_C( 2042484311117527035),  INT64_C( 7880703010567671928),
+       INT64_C( 5162474829263675260), -INT64_C(  969970503778481293), -INT64_C( 3047782058525916945),  INT64_C( 5618690035889729770),
+       INT64_C( 6881581509533573559),  INT64_C( 1548728263988686229),  INT64_C( 4927889458842124337), -INT64_C( 1337629329956233647),
+      -INT64_C(  921084672507243029),  INT64_C( 4544129889309023955),  INT64_C( 8060371440568745022),  INT64_C( 6985929049114848463),
+      -INT64_C( 7824881484460189418),  INT64_C( 2637873420436301901),  INT64_C( 7630672928538650712), -INT64_C( 8135081501949724860),
+       INT64_C( 1066910838419640956),  INT64_C( 5647237913351117653), -INT64_C(  617086938037085331), -INT64_C( 4815814468402356703),
+      -INT64_C( 1086555412821955044), -INT64_C( 4150196416336407262), -INT64_C(  626214936165667931), -INT64_C( 1794196498719637477) };
+  static const int64_t b =  INT64_C( 7803666683919714114);
+  static const int64_t e[] =
+    {  INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7803666683919714114),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C(                   0),  INT64_C( 7803666683919714114),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7803666683919714114),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C( 7825824831009207017),
+       INT64_C( 7803666683919714114),  INT64_C(                   0),  INT64_C( 7803666683919714114),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),
+       INT64_C(                   0),  INT64_C( 7803666683919714114),  INT64_C( 8060371440568745022),  INT64_C( 7803666683919714114),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 7803666683919714114),  INT64_C( 7803666683919714114),  INT64_C(                   0),  INT64_C( 7803666683919714114),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7803666683919714114),  INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_n_s64_z(pv, av, b);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    ev = simde_svmax_n_s64_z(pv, av, b);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0) };
+  static const int64_t a[] =
+    {  INT64_C(   84962469500162657), -INT64_C( 5450821417510576226), -INT64_C( 3302853495276957233),  INT64_C( 1516052481837927161),
+       INT64_C( 5483053029677258283), -INT64_C( 2299489956366104682), -INT64_C( 3119913876965166173), -INT64_C( 4312189392967139488),
+       INT64_C(   61064030589727453),  INT64_C( 4983929675561701432),  INT64_C(  944587885110548332), -INT64_C(  309542077155239848),
+      -INT64_C( 5231670391352094981), -INT64_C( 6028583497025599633), -INT64_C( 5927846148827808766),  INT64_C( 2396286796773055527),
+      -INT64_C( 7631372489200318240),  INT64_C( 5017006978206472370), -INT64_C( 3928352036647300231),  INT64_C( 5463798092602939533),
+      -INT64_C(  588632052913710825), -INT64_C( 1052565263890088997), -INT64_C( 7600042032635095012), -INT64_C(  213889209251359149),
+       INT64_C( 5886504290066609013),  INT64_C( 4752937133406133131),  INT64_C( 4813090088248390956), -INT64_C( 6485455940400180451),
+      -INT64_C( 2989527812490183748), -INT64_C( 1004073164594285909), -INT64_C( 5424600493841772411),  INT64_C( 8924646543944234757),
+      -INT64_C(  859571487765612047),  INT64_C( 4817678138538716451), -INT64_C(  491052937545121052), -INT64_C( 8331931319970896604),
+       INT64_C( 6953235932074478913), -INT64_C(  376292364718095672),  INT64_C( 1086674739771309350), -INT64_C( 8308768255297502583),
+       INT64_C( 2161329066124737120), -INT64_C( 7861198707987691561), -INT64_C( 8439252017453638426), -INT64_C( 8657220136749509629),
+       INT64_C( 6866902595351737050),  INT64_C( 4497183254768316010), -INT64_C( 2730323940427753840),  INT64_C(  392943649885375173),
+       INT64_C( 2800255714872039926), -INT64_C( 1367574358863828625), -INT64_C( 3878275455941471108),  INT64_C( 5806030913040438883),
+      -INT64_C( 5141234696238217277), -INT64_C( 8854494642360572973), -INT64_C( 7392934531170788200),  INT64_C(  866866274748538460),
+       INT64_C( 6017426477049173378),  INT64_C( 2189489965174555092), -INT64_C( 7202061469352248770),  INT64_C( 8184546783151666497),
+       INT64_C( 2810736904775672110),  INT64_C( 7233738840551490752), -INT64_C( 8971762807232520287),  INT64_C( 6375867994619039770),
+       INT64_C( 3908006780391045059),  INT64_C( 5266361254904807819), -INT64_C( 1314021040993866242),  INT64_C( 3817490566052564856),
+      -INT64_C( 7865952331843895254),  INT64_C( 3438877859329102535),  INT64_C(  362313872346965063), -INT64_C( 7158575569743380735),
+       INT64_C( 4555975381978313121),  INT64_C( 2289351265038073445),  INT64_C( 7556266560256029772), -INT64_C( 4157242307607034817),
+       INT64_C(  300520300186864500), -INT64_C( 8206015630150018521), -INT64_C( 2926419909017118828),  INT64_C( 3798179084392545993),
+      -INT64_C(  863480789489147038), -INT64_C( 7784732542683078874),  INT64_C( 7843565908450500201), -INT64_C( 7267667157149130193),
+      -INT64_C( 5191629396508981965),  INT64_C( 7120499944617731903), -INT64_C( 9113810852386676618),  INT64_C( 2482492676972339359),
+      -INT64_C( 1359218823669870886), -INT64_C( 3289600956397042692), -INT64_C( 7480635138843624355),  INT64_C( 1181037349450063953),
+      -INT64_C( 7526183915799935503),  INT64_C( 1373849357732592098), -INT64_C( 4813801077943960672),  INT64_C( 8563701914363928977),
+      -INT64_C( 3091822352945228570) };
+  static const int64_t b = -INT64_C( 4540455084362432337);
+  static const int64_t e[] =
+    {  INT64_C(   84962469500162657), -INT64_C( 4540455084362432337), -INT64_C( 3302853495276957233),  INT64_C( 1516052481837927161),
+       INT64_C( 5483053029677258283), -INT64_C( 2299489956366104682), -INT64_C( 3119913876965166173), -INT64_C( 4312189392967139488),
+       INT64_C(   61064030589727453),  INT64_C( 4983929675561701432),  INT64_C(  944587885110548332), -INT64_C(  309542077155239848),
+      -INT64_C( 4540455084362432337), -INT64_C( 6028583497025599633), -INT64_C( 5927846148827808766),  INT64_C( 2396286796773055527),
+      -INT64_C( 4540455084362432337),  INT64_C( 5017006978206472370), -INT64_C( 3928352036647300231),  INT64_C( 5463798092602939533),
+      -INT64_C(  588632052913710825), -INT64_C( 1052565263890088997), -INT64_C( 4540455084362432337), -INT64_C(  213889209251359149),
+       INT64_C( 5886504290066609013),  INT64_C( 4752937133406133131),  INT64_C( 4813090088248390956), -INT64_C( 4540455084362432337),
+      -INT64_C( 2989527812490183748), -INT64_C( 1004073164594285909), -INT64_C( 4540455084362432337),  INT64_C( 8924646543944234757),
+      -INT64_C(  859571487765612047),  INT64_C( 4817678138538716451), -INT64_C(  491052937545121052), -INT64_C( 4540455084362432337),
+       INT64_C( 6953235932074478913), -INT64_C(  376292364718095672),  INT64_C( 1086674739771309350), -INT64_C( 8308768255297502583),
+       INT64_C( 2161329066124737120), -INT64_C( 4540455084362432337), -INT64_C( 8439252017453638426), -INT64_C( 8657220136749509629),
+       INT64_C( 6866902595351737050),  INT64_C( 4497183254768316010), -INT64_C( 2730323940427753840),  INT64_C(  392943649885375173),
+       INT64_C( 2800255714872039926), -INT64_C( 1367574358863828625), -INT64_C( 3878275455941471108),  INT64_C( 5806030913040438883),
+      -INT64_C( 5141234696238217277), -INT64_C( 8854494642360572973), -INT64_C( 4540455084362432337),  INT64_C(  866866274748538460),
+       INT64_C( 6017426477049173378),  INT64_C( 2189489965174555092), -INT64_C( 4540455084362432337),  INT64_C( 8184546783151666497),
+       INT64_C( 2810736904775672110),  INT64_C( 7233738840551490752), -INT64_C( 4540455084362432337),  INT64_C( 6375867994619039770),
+       INT64_C( 3908006780391045059),  INT64_C( 5266361254904807819), -INT64_C( 1314021040993866242),  INT64_C( 3817490566052564856),
+      -INT64_C( 7865952331843895254),  INT64_C( 3438877859329102535),  INT64_C(  362313872346965063), -INT64_C( 7158575569743380735),
+       INT64_C( 4555975381978313121),  INT64_C( 2289351265038073445),  INT64_C( 7556266560256029772), -INT64_C( 4157242307607034817),
+       INT64_C(  300520300186864500), -INT64_C( 4540455084362432337), -INT64_C( 2926419909017118828),  INT64_C( 3798179084392545993),
+      -INT64_C(  863480789489147038), -INT64_C( 4540455084362432337),  INT64_C( 7843565908450500201), -INT64_C( 7267667157149130193),
+      -INT64_C( 5191629396508981965),  INT64_C( 7120499944617731903), -INT64_C( 4540455084362432337),  INT64_C( 2482492676972339359),
+      -INT64_C( 1359218823669870886), -INT64_C( 3289600956397042692), -INT64_C( 4540455084362432337),  INT64_C( 1181037349450063953),
+      -INT64_C( 7526183915799935503),  INT64_C( 1373849357732592098), -INT64_C( 4540455084362432337),  INT64_C( 8563701914363928977),
+      -INT64_C( 3091822352945228570) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_n_s64_m(pv, av, b);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    ev = simde_svmax_n_s64_m(pv, av, b);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(127), UINT8_C( 14), UINT8_C(138), UINT8_C(143), UINT8_C( 93), UINT8_C(200), UINT8_C( 99), UINT8_C(236),
+      UINT8_C( 33), UINT8_C( 33), UINT8_C(149), UINT8_C(213), UINT8_C(192), UINT8_C(170), UINT8_C( 59), UINT8_C(122),
+      UINT8_C( 93), UINT8_C(183), UINT8_C(214), UINT8_C(233), UINT8_C(197), UINT8_C( 12), UINT8_C(169), UINT8_C(122),
+      UINT8_C(217), UINT8_C(175), UINT8_C(218), UINT8_C(138), UINT8_C( 58), UINT8_C(171), UINT8_C( 91), UINT8_C(185),
+      UINT8_C(185), UINT8_C(229), UINT8_C( 72), UINT8_C( 22), UINT8_C(174), UINT8_C(171), UINT8_C(  2), UINT8_C(207),
+      UINT8_C(204), UINT8_C(152), UINT8_C(165), UINT8_C(140), UINT8_C( 66), UINT8_C(224), UINT8_C(  7), UINT8_C(160),
+      UINT8_C(151), UINT8_C(221), UINT8_C(137), UINT8_C( 92), UINT8_C(233), UINT8_C( 50), UINT8_C(215), UINT8_C(194),
+      UINT8_C(225), UINT8_C(177), UINT8_C( 77), UINT8_C( 27), UINT8_C( 93), UINT8_C(168), UINT8_C(212), UINT8_C( 22),
+      UINT8_C(142), UINT8_C( 28), UINT8_C( 45), UINT8_C( 60), UINT8_C(199), UINT8_C( 47), UINT8_C( 11), UINT8_C(148),
+      UINT8_C(199), UINT8_C(176), UINT8_C( 32), UINT8_C( 10), UINT8_C(144), UINT8_C( 39), UINT8_C(170), UINT8_C( 40),
+      UINT8_C(  4), UINT8_C( 51), UINT8_C(132), UINT8_C(237), UINT8_C(101), UINT8_C( 91), UINT8_C(176), UINT8_C( 70),
+      UINT8_C( 13), UINT8_C(253), UINT8_C( 98), UINT8_C(106), UINT8_C(165), UINT8_C( 54), UINT8_C(128), UINT8_C( 51),
+      UINT8_C( 83), UINT8_C(173), UINT8_C(111), UINT8_C( 26), UINT8_C(221), UINT8_C(123), UINT8_C(174), UINT8_C(164),
+      UINT8_C( 43), UINT8_C(207), UINT8_C(174), UINT8_C(188), UINT8_C(246), UINT8_C( 88), UINT8_C(228), UINT8_C(251),
+      UINT8_C(139), UINT8_C(104), UINT8_C(232), UINT8_C(240), UINT8_C(196), UINT8_C(152), UINT8_C( 55), UINT8_C(209),
+      UINT8_C(149), UINT8_C(153), UINT8_C( 59), UINT8_C( 59), UINT8_C(207), UINT8_C(187), UINT8_C(110), UINT8_C( 34),
+      UINT8_C(105), UINT8_C(222), UINT8_C( 61), UINT8_C( 70), UINT8_C( 89), UINT8_C(235), UINT8_C(234), UINT8_C(132),
+      UINT8_C(186), UINT8_C(153), UINT8_C( 64), UINT8_C(177), UINT8_C(241), UINT8_C( 36), UINT8_C(172), UINT8_C(125),
+      UINT8_C(141), UINT8_C(148), UINT8_C(109), UINT8_C( 81), UINT8_C( 45), UINT8_C(164), UINT8_C( 34), UINT8_C(194),
+      UINT8_C( 61), UINT8_C( 93), UINT8_C(253), UINT8_C( 13), UINT8_C( 24), UINT8_C(108), UINT8_C( 47), UINT8_C(129),
+      UINT8_C( 74), UINT8_C(108), UINT8_C(199), UINT8_C(163), UINT8_C( 88), UINT8_C(178), UINT8_C( 39), UINT8_C( 18),
+      UINT8_C( 75), UINT8_C(104), UINT8_C(195), UINT8_C( 60), UINT8_C(140), UINT8_C(111), UINT8_C(185), UINT8_C( 25),
+      UINT8_C(  4), UINT8_C( 39), UINT8_C(106), UINT8_C( 49), UINT8_C(203), UINT8_C(140), UINT8_C(243), UINT8_C(  9),
+      UINT8_C(233), UINT8_C(241), UINT8_C( 22), UINT8_C(  2), UINT8_C( 93), UINT8_C( 69), UINT8_C(131), UINT8_C(167),
+      UINT8_C(178), UINT8_C( 75), UINT8_C( 74), UINT8_C( 10), UINT8_C(253), UINT8_C(113), UINT8_C( 28), UINT8_C( 72),
+      UINT8_C(217), UINT8_C(224), UINT8_C(132), UINT8_C(102), UINT8_C( 79), UINT8_C( 62), UINT8_C(127), UINT8_C( 83),
+      UINT8_C(101), UINT8_C(234), UINT8_C(132), UINT8_C( 48), UINT8_C(118), UINT8_C(120), UINT8_C( 57), UINT8_C( 96),
+      UINT8_C(105), UINT8_C( 79), UINT8_C( 98), UINT8_C(198), UINT8_C(149), UINT8_C(229), UINT8_C(109), UINT8_C( 71),
+      UINT8_C( 48), UINT8_C(183), UINT8_C( 81), UINT8_C( 45), UINT8_C( 40), UINT8_C(109), UINT8_C(117), UINT8_C(  2),
+      UINT8_C( 77), UINT8_C(250), UINT8_C(104), UINT8_C(157), UINT8_C( 56), UINT8_C(231), UINT8_C(240), UINT8_C(157),
+      UINT8_C(209), UINT8_C(117), UINT8_C(205), UINT8_C( 72), UINT8_C(237), UINT8_C(  7), UINT8_C(168), UINT8_C( 86),
+      UINT8_C( 86), UINT8_C( 10), UINT8_C( 28), UINT8_C(235), UINT8_C(239), UINT8_C(137), UINT8_C( 50), UINT8_C( 32),
+      UINT8_C( 64), UINT8_C(131), UINT8_C( 77), UINT8_C(104), UINT8_C(241), UINT8_C(195), UINT8_C(106), UINT8_C( 62),
+      UINT8_C(189), UINT8_C(210), UINT8_C(219), UINT8_C(245), UINT8_C(186), UINT8_C(204), UINT8_C(146), UINT8_C(139),
+      UINT8_C( 65), UINT8_C( 95), UINT8_C(211), UINT8_C( 46), UINT8_C(102), UINT8_C(123), UINT8_C(132), UINT8_C(189),
+      UINT8_C(133), UINT8_C(160), UINT8_C(168), UINT8_C(117), UINT8_C( 41), UINT8_C(219), UINT8_C(149), UINT8_C(105),
+      UINT8_C( 94), UINT8_C(226), UINT8_C(209), UINT8_C( 79), UINT8_C(165), UINT8_C( 60), UINT8_C(142), UINT8_C( 98),
+      UINT8_C( 14), UINT8_C(105), UINT8_C( 87), UINT8_C(200), UINT8_C( 53), UINT8_C(233), UINT8_C( 84), UINT8_C(118),
+      UINT8_C( 73), UINT8_C( 39), UINT8_C(164), UINT8_C(175), UINT8_C(163), UINT8_C( 40), UINT8_C(108), UINT8_C( 40),
+      UINT8_C(200), UINT8_C( 21), UINT8_C(157), UINT8_C(241), UINT8_C(240), UINT8_C( 50), UINT8_C( 90), UINT8_C( 78),
+      UINT8_C( 21), UINT8_C( 44), UINT8_C(158), UINT8_C(186), UINT8_C(104), UINT8_C( 44), UINT8_C( 29), UINT8_C(118),
+      UINT8_C(149), UINT8_C(116), UINT8_C( 63), UINT8_C(203), UINT8_C( 94), UINT8_C(147), UINT8_C( 65), UINT8_C(167),
+      UINT8_C(186), UINT8_C(230), UINT8_C( 86), UINT8_C( 93), UINT8_C( 14), UINT8_C(195), UINT8_C(134), UINT8_C(215),
+      UINT8_C(216), UINT8_C( 35), UINT8_C(200), UINT8_C(200), UINT8_C( 86), UINT8_C( 35), UINT8_C( 22), UINT8_C(107),
+      UINT8_C( 79), UINT8_C(180), UINT8_C( 37), UINT8_C(183), UINT8_C(224), UINT8_C( 66), UINT8_C( 45), UINT8_C(118),
+      UINT8_C(183), UINT8_C(108), UINT8_C( 65), UINT8_C( 21),    UINT8_MAX, UINT8_C(130), UINT8_C(188), UINT8_C(186),
+      UINT8_C(104), UINT8_C( 18), UINT8_C( 23), UINT8_C(119), UINT8_C(213), UINT8_C(157), UINT8_C( 78), UINT8_C(173),
+      UINT8_C(193), UINT8_C( 22), UINT8_C(117), UINT8_C( 23), UINT8_C( 57), UINT8_C(140), UINT8_C(130), UINT8_C(136),
+      UINT8_C( 64), UINT8_C(167), UINT8_C( 63), UINT8_C( 33), UINT8_C(234), UINT8_C(109), UINT8_C(151), UINT8_C(161),
+      UINT8_C(217), UINT8_C(216), UINT8_C(182), UINT8_C(217), UINT8_C( 90), UINT8_C(114), UINT8_C(147), UINT8_C(195),
+      UINT8_C(132), UINT8_C(170), UINT8_C( 58), UINT8_C( 90), UINT8_C( 72), UINT8_C(136), UINT8_C(  7), UINT8_C(  9),
+      UINT8_C(158), UINT8_C(125), UINT8_C( 32), UINT8_C(216), UINT8_C(  9), UINT8_C(162), UINT8_C( 96), UINT8_C( 73),
+      UINT8_C( 73), UINT8_C(160), UINT8_C(106), UINT8_C( 51), UINT8_C( 13), UINT8_C(  1), UINT8_C(212), UINT8_C(230),
+      UINT8_C(217), UINT8_C(138), UINT8_C(191), UINT8_C( 52), UINT8_C(252), UINT8_C( 82), UINT8_C(247), UINT8_C(129),
+      UINT8_C(253), UINT8_C( 49), UINT8_C(219), UINT8_C( 69), UINT8_C(185), UINT8_C(226), UINT8_C( 78), UINT8_C( 87),
+      UINT8_C( 95), UINT8_C(110), UINT8_C( 47), UINT8_C(104), UINT8_C( 16), UINT8_C(144), UINT8_C(178), UINT8_C( 89),
+      UINT8_C( 48), UINT8_C( 28), UINT8_C(141), UINT8_C( 61), UINT8_C( 30), UINT8_C( 97), UINT8_C( 35), UINT8_C(247),
+      UINT8_C(236), UINT8_C(227), UINT8_C( 43), UINT8_C(232), UINT8_C( 53), UINT8_C( 34), UINT8_C(105), UINT8_C( 50),
+      UINT8_C( 83), UINT8_C( 68), UINT8_C(119), UINT8_C( 12), UINT8_C( 39), UINT8_C(197), UINT8_C(100), UINT8_C(134),
+      UINT8_C( 51), UINT8_C(147), UINT8_C(239), UINT8_C( 67), UINT8_C( 35), UINT8_C(161), UINT8_C(157), UINT8_C( 83),
+      UINT8_C(189), UINT8_C( 42), UINT8_C(144), UINT8_C(219), UINT8_C(139), UINT8_C(180), UINT8_C(211), UINT8_C(119),
+      UINT8_C(151), UINT8_C(254), UINT8_C( 96), UINT8_C(204), UINT8_C( 33), UINT8_C(201),    UINT8_MAX, UINT8_C(116),
+      UINT8_C( 14), UINT8_C(118), UINT8_C(129), UINT8_C( 53), UINT8_C( 60), UINT8_C(229), UINT8_C(187), UINT8_C(111),
+      UINT8_C(120), UINT8_C(170), UINT8_C(179), UINT8_C(156), UINT8_C( 75), UINT8_C( 80), UINT8_C(239), UINT8_C(  9),
+      UINT8_C(122), UINT8_C(128), UINT8_C(228), UINT8_C(  5), UINT8_C( 52), UINT8_C(183), UINT8_C(125), UINT8_C(203),
+      UINT8_C(182), UINT8_C(221), UINT8_C(151), UINT8_C(215), UINT8_C(166), UINT8_C(150), UINT8_C( 75), UINT8_C(180),
+      UINT8_C( 13), UINT8_C(204), UINT8_C(233), UINT8_C( 73), UINT8_C(177), UINT8_C(165), UINT8_C(184), UINT8_C( 42),
+      UINT8_C( 79), UINT8_C(107), UINT8_C(198), UINT8_C(155), UINT8_C(187), UINT8_C(181), UINT8_C(164), UINT8_C( 53),
+      UINT8_C( 53), UINT8_C(136), UINT8_C( 59), UINT8_C(105), UINT8_C( 64), UINT8_C(184), UINT8_C( 52), UINT8_C(246),
+      UINT8_C(149), UINT8_C(204), UINT8_C(205), UINT8_C( 59), UINT8_C( 98), UINT8_C( 24), UINT8_C(240), UINT8_C(111),
+      UINT8_C(229), UINT8_C(217), UINT8_C(184), UINT8_C(150), UINT8_C(126), UINT8_C(113), UINT8_C(192), UINT8_C(206),
+      UINT8_C(220), UINT8_C(134), UINT8_C(105), UINT8_C(152), UINT8_C( 60), UINT8_C( 13), UINT8_C(205), UINT8_C(113),
+      UINT8_C(149), UINT8_C(  8), UINT8_C(219), UINT8_C(213), UINT8_C(192), UINT8_C( 15), UINT8_C(203), UINT8_C( 85),
+      UINT8_C(219), UINT8_C(152), UINT8_C(145), UINT8_C( 62), UINT8_C(177), UINT8_C(129), UINT8_C(173), UINT8_C(150),
+      UINT8_C( 90), UINT8_C(102), UINT8_C( 44), UINT8_C(217), UINT8_C(215), UINT8_C(237), UINT8_C(167), UINT8_C(179),
+      UINT8_C(115), UINT8_C( 16), UINT8_C( 75), UINT8_C(175), UINT8_C( 29), UINT8_C( 25), UINT8_C( 33), UINT8_C(178),
+      UINT8_C( 33), UINT8_C(252), UINT8_C(136), UINT8_C(226), UINT8_C( 11), UINT8_C( 83), UINT8_C( 55), UINT8_C(231),
+      UINT8_C(236), UINT8_C(200), UINT8_C( 37), UINT8_C(157), UINT8_C( 73), UINT8_C(210), UINT8_C( 51), UINT8_C(164),
+      UINT8_C( 56), UINT8_C( 95), UINT8_C(125), UINT8_C( 15), UINT8_C( 76), UINT8_C( 36), UINT8_C(195), UINT8_C(192),
+      UINT8_C( 52), UINT8_C( 14), UINT8_C(111), UINT8_C( 81), UINT8_C( 39), UINT8_C(144), UINT8_C(  3), UINT8_C( 73),
+      UINT8_C(140), UINT8_C(139), UINT8_C( 43), UINT8_C(152), UINT8_C(223), UINT8_C( 98), UINT8_C(127), UINT8_C(203),
+      UINT8_C( 43), UINT8_C(164), UINT8_C(104), UINT8_C(116), UINT8_C(118), UINT8_C(155), UINT8_C( 24), UINT8_C(175),
+      UINT8_C(250), UINT8_C(149), UINT8_C(190), UINT8_C( 71), UINT8_C(185), UINT8_C(129), UINT8_C(  7), UINT8_C(237),
+      UINT8_C(144), UINT8_C(118), UINT8_C( 62), UINT8_C(183), UINT8_C(  7), UINT8_C( 66), UINT8_C(  0), UINT8_C(147),
+      UINT8_C(205), UINT8_C( 43), UINT8_C( 43), UINT8_C(172), UINT8_C(142), UINT8_C(170), UINT8_C(119), UINT8_C(185),
+      UINT8_C( 78), UINT8_C(223), UINT8_C( 45), UINT8_C(197), UINT8_C(122), UINT8_C( 70), UINT8_C(116), UINT8_C(117),
+      UINT8_C(219), UINT8_C( 50), UINT8_C(188), UINT8_C(149), UINT8_C(180), UINT8_C(195), UINT8_C(130), UINT8_C( 68),
+      UINT8_C( 57), UINT8_C(193), UINT8_C(251), UINT8_C( 64), UINT8_C(  3), UINT8_C(252), UINT8_C(212), UINT8_C(208),
+      UINT8_C( 39),    UINT8_MAX, UINT8_C(125), UINT8_C(181), UINT8_C(170), UINT8_C(244), UINT8_C(110), UINT8_C(248),
+      UINT8_C(212), UINT8_C(156), UINT8_C(189), UINT8_C( 78), UINT8_C(226), UINT8_C( 49), UINT8_C(195), UINT8_C(189),
+      UINT8_C(100), UINT8_C(127), UINT8_C( 82), UINT8_C( 24), UINT8_C( 66), UINT8_C(213), UINT8_C( 92), UINT8_C(124),
+      UINT8_C(150), UINT8_C( 87), UINT8_C(188), UINT8_C(153), UINT8_C( 83), UINT8_C(144), UINT8_C(105), UINT8_C(123),
+      UINT8_C(144), UINT8_C(230), UINT8_C( 48), UINT8_C( 58), UINT8_C(219), UINT8_C(159), UINT8_C( 50), UINT8_C(175),
+      UINT8_C( 59), UINT8_C(240), UINT8_C(253), UINT8_C( 29), UINT8_C( 33), UINT8_C(193), UINT8_C(218), UINT8_C(133),
+      UINT8_C( 64), UINT8_C( 45), UINT8_C(157), UINT8_C(131), UINT8_C(  2), UINT8_C(249),    UINT8_MAX, UINT8_C(152),
+      UINT8_C( 81), UINT8_C(187), UINT8_C( 49), UINT8_C(164), UINT8_C( 76), UINT8_C(154), UINT8_C( 31), UINT8_C(220),
+      UINT8_C(129), UINT8_C( 80), UINT8_C( 22), UINT8_C( 92), UINT8_C(239), UINT8_C( 72), UINT8_C( 11), UINT8_C( 42),
+      UINT8_C( 56), UINT8_C(  8), UINT8_C( 71), UINT8_C( 90), UINT8_C(201), UINT8_C( 33), UINT8_C(223), UINT8_C( 10),
+      UINT8_C( 78), UINT8_C(125), UINT8_C(141), UINT8_C( 80), UINT8_C(118), UINT8_C(140), UINT8_C(232), UINT8_C(199),
+      UINT8_C( 71), UINT8_C( 25), UINT8_C(108), UINT8_C(147), UINT8_C(180), UINT8_C(139), UINT8_C(111), UINT8_C( 53),
+      UINT8_C(219), UINT8_C(133), UINT8_C(145), UINT8_C(202), UINT8_C(206), UINT8_C(156), UINT8_C(244), UINT8_C(  6),
+      UINT8_C(164), UINT8_C( 59), UINT8_C( 96), UINT8_C(110), UINT8_C( 93), UINT8_C( 64), UINT8_C(120), UINT8_C(171),
+      UINT8_C(189), UINT8_C(  5), UINT8_C(252), UINT8_C( 51), UINT8_C(145), UINT8_C(228), UINT8_C(251), UINT8_C(216),
+      UINT8_C(254), UINT8_C(103), UINT8_C(108), UINT8_C(178), UINT8_C(242), UINT8_C(219), UINT8_C(231), UINT8_C(206),
+      UINT8_C( 97), UINT8_C(120), UINT8_C(152), UINT8_C( 47), UINT8_C( 20), UINT8_C(141), UINT8_C( 53), UINT8_C(184),
+      UINT8_C(200), UINT8_C(150), UINT8_C( 38), UINT8_C( 37), UINT8_C(214), UINT8_C(158), UINT8_C(209), UINT8_C(147),
+      UINT8_C(163), UINT8_C(205), UINT8_C(198), UINT8_C( 52), UINT8_C(177), UINT8_C(193), UINT8_C( 13), UINT8_C(175) };
+  static const uint8_t b = UINT8_C( 69);
+  static const uint8_t e[] =
+    { UINT8_C(127), UINT8_C( 69), UINT8_C(138), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 99), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C( 69), UINT8_C(  0), UINT8_C(213), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(122),
+      UINT8_C(  0), UINT8_C(183), UINT8_C(  0), UINT8_C(233), UINT8_C(197), UINT8_C( 69), UINT8_C(  0), UINT8_C(122),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(185),
+      UINT8_C(185), UINT8_C(229), UINT8_C(  0), UINT8_C(  0), UINT8_C(174), UINT8_C(171), UINT8_C(  0), UINT8_C(207),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(140), UINT8_C( 69), UINT8_C(224), UINT8_C(  0), UINT8_C(160),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(137), UINT8_C( 92), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(225), UINT8_C(177), UINT8_C( 77), UINT8_C( 69), UINT8_C( 93), UINT8_C(168), UINT8_C(212), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(199), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(199), UINT8_C(  0), UINT8_C( 69), UINT8_C( 69), UINT8_C(  0), UINT8_C( 69), UINT8_C(170), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C(  0), UINT8_C(132), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(253), UINT8_C( 98), UINT8_C(106), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 69),
+      UINT8_C( 83), UINT8_C(173), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C(207), UINT8_C(174), UINT8_C(188), UINT8_C(246), UINT8_C( 88), UINT8_C(228), UINT8_C(251),
+      UINT8_C(139), UINT8_C(104), UINT8_C(232), UINT8_C(  0), UINT8_C(  0), UINT8_C(152), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C( 69), UINT8_C(207), UINT8_C(  0), UINT8_C(110), UINT8_C(  0),
+      UINT8_C(105), UINT8_C(222), UINT8_C( 69), UINT8_C(  0), UINT8_C( 89), UINT8_C(235), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(186), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(241), UINT8_C( 69), UINT8_C(172), UINT8_C(125),
+      UINT8_C(141), UINT8_C(148), UINT8_C(109), UINT8_C( 81), UINT8_C(  0), UINT8_C(164), UINT8_C( 69), UINT8_C(194),
+      UINT8_C(  0), UINT8_C( 93), UINT8_C(253), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(129),
+      UINT8_C( 74), UINT8_C(  0), UINT8_C(199), UINT8_C(163), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(185), UINT8_C( 69),
+      UINT8_C( 69), UINT8_C(  0), UINT8_C(106), UINT8_C( 69), UINT8_C(  0), UINT8_C(140), UINT8_C(243), UINT8_C(  0),
+      UINT8_C(233), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(178), UINT8_C( 75), UINT8_C( 74), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 83),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(132), UINT8_C( 69), UINT8_C(118), UINT8_C(120), UINT8_C( 69), UINT8_C(  0),
+      UINT8_C(105), UINT8_C(  0), UINT8_C( 98), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(117), UINT8_C( 69),
+      UINT8_C(  0), UINT8_C(250), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(117), UINT8_C(205), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(168), UINT8_C(  0),
+      UINT8_C( 86), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(239), UINT8_C(137), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(104), UINT8_C(  0), UINT8_C(195), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(189), UINT8_C(  0), UINT8_C(219), UINT8_C(  0), UINT8_C(186), UINT8_C(204), UINT8_C(146), UINT8_C(139),
+      UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(102), UINT8_C(  0), UINT8_C(  0), UINT8_C(189),
+      UINT8_C(133), UINT8_C(160), UINT8_C(168), UINT8_C(117), UINT8_C( 69), UINT8_C(  0), UINT8_C(149), UINT8_C(105),
+      UINT8_C( 94), UINT8_C(  0), UINT8_C(  0), UINT8_C( 79), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 98),
+      UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(233), UINT8_C(  0), UINT8_C(118),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(157), UINT8_C(241), UINT8_C(  0), UINT8_C( 69), UINT8_C( 90), UINT8_C( 78),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(158), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(118),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0),
+      UINT8_C(186), UINT8_C(230), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(215),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(200), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(180), UINT8_C(  0), UINT8_C(183), UINT8_C(224), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0),
+      UINT8_C(183), UINT8_C(108), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(188), UINT8_C(186),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(119), UINT8_C(213), UINT8_C(  0), UINT8_C(  0), UINT8_C(173),
+      UINT8_C(193), UINT8_C( 69), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(140), UINT8_C(130), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(234), UINT8_C(  0), UINT8_C(151), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(216), UINT8_C(182), UINT8_C(  0), UINT8_C(  0), UINT8_C(114), UINT8_C(147), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(170), UINT8_C( 69), UINT8_C( 90), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C( 69),
+      UINT8_C(158), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0),
+      UINT8_C( 73), UINT8_C(160), UINT8_C(106), UINT8_C( 69), UINT8_C( 69), UINT8_C(  0), UINT8_C(212), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(138), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(247), UINT8_C(  0),
+      UINT8_C(253), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(226), UINT8_C( 78), UINT8_C(  0),
+      UINT8_C( 95), UINT8_C(  0), UINT8_C(  0), UINT8_C(104), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C( 69), UINT8_C(141), UINT8_C(  0), UINT8_C(  0), UINT8_C( 97), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(227), UINT8_C( 69), UINT8_C(232), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(100), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 83),
+      UINT8_C(189), UINT8_C(  0), UINT8_C(  0), UINT8_C(219), UINT8_C(  0), UINT8_C(180), UINT8_C(  0), UINT8_C(119),
+      UINT8_C(  0), UINT8_C(254), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(201),    UINT8_MAX, UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(118), UINT8_C(129), UINT8_C( 69), UINT8_C(  0), UINT8_C(229), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(156), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(122), UINT8_C(128), UINT8_C(  0), UINT8_C( 69), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(182), UINT8_C(221), UINT8_C(  0), UINT8_C(215), UINT8_C(  0), UINT8_C(150), UINT8_C( 75), UINT8_C(180),
+      UINT8_C( 69), UINT8_C(204), UINT8_C(233), UINT8_C( 73), UINT8_C(177), UINT8_C(165), UINT8_C(184), UINT8_C( 69),
+      UINT8_C( 79), UINT8_C(107), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(181), UINT8_C(  0), UINT8_C( 69),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(184), UINT8_C(  0), UINT8_C(246),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C( 98), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(217), UINT8_C(184), UINT8_C(150), UINT8_C(126), UINT8_C(113), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(220), UINT8_C(134), UINT8_C(105), UINT8_C(152), UINT8_C(  0), UINT8_C( 69), UINT8_C(205), UINT8_C(113),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(219), UINT8_C(213), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(152), UINT8_C(145), UINT8_C( 69), UINT8_C(177), UINT8_C(  0), UINT8_C(  0), UINT8_C(150),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(217), UINT8_C(  0), UINT8_C(237), UINT8_C(  0), UINT8_C(179),
+      UINT8_C(115), UINT8_C( 69), UINT8_C( 75), UINT8_C(175), UINT8_C( 69), UINT8_C( 69), UINT8_C( 69), UINT8_C(178),
+      UINT8_C(  0), UINT8_C(252), UINT8_C(136), UINT8_C(226), UINT8_C( 69), UINT8_C( 83), UINT8_C(  0), UINT8_C(231),
+      UINT8_C(236), UINT8_C(200), UINT8_C( 69), UINT8_C(  0), UINT8_C( 73), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C( 95), UINT8_C(  0), UINT8_C( 69), UINT8_C( 76), UINT8_C(  0), UINT8_C(195), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(140), UINT8_C(139), UINT8_C(  0), UINT8_C(152), UINT8_C(223), UINT8_C(  0), UINT8_C(127), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(164), UINT8_C(104), UINT8_C(  0), UINT8_C(118), UINT8_C(155), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(250), UINT8_C(  0), UINT8_C(  0), UINT8_C( 71), UINT8_C(185), UINT8_C(129), UINT8_C( 69), UINT8_C(237),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(183), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0),
+      UINT8_C(205), UINT8_C(  0), UINT8_C( 69), UINT8_C(172), UINT8_C(  0), UINT8_C(  0), UINT8_C(119), UINT8_C(185),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(197), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(188), UINT8_C(149), UINT8_C(180), UINT8_C(195), UINT8_C(130), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C(193), UINT8_C(251), UINT8_C(  0), UINT8_C( 69), UINT8_C(252), UINT8_C(  0), UINT8_C(208),
+      UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(170), UINT8_C(  0), UINT8_C(110), UINT8_C(248),
+      UINT8_C(212), UINT8_C(156), UINT8_C(189), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(100), UINT8_C(127), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(213), UINT8_C( 92), UINT8_C(  0),
+      UINT8_C(150), UINT8_C(  0), UINT8_C(  0), UINT8_C(153), UINT8_C( 83), UINT8_C(144), UINT8_C(105), UINT8_C(123),
+      UINT8_C(144), UINT8_C(230), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(175),
+      UINT8_C( 69), UINT8_C(240), UINT8_C(253), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 69), UINT8_C( 69), UINT8_C(157), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 81), UINT8_C(  0), UINT8_C(  0), UINT8_C(164), UINT8_C( 76), UINT8_C(154), UINT8_C(  0), UINT8_C(220),
+      UINT8_C(129), UINT8_C( 80), UINT8_C(  0), UINT8_C( 92), UINT8_C(239), UINT8_C( 72), UINT8_C( 69), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 90), UINT8_C(201), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(125), UINT8_C(  0), UINT8_C(  0), UINT8_C(118), UINT8_C(  0), UINT8_C(232), UINT8_C(199),
+      UINT8_C( 71), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(145), UINT8_C(202), UINT8_C(206), UINT8_C(156), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(110), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(171),
+      UINT8_C(189), UINT8_C(  0), UINT8_C(252), UINT8_C( 69), UINT8_C(145), UINT8_C(  0), UINT8_C(  0), UINT8_C(216),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(242), UINT8_C(  0), UINT8_C(  0), UINT8_C(206),
+      UINT8_C( 97), UINT8_C(  0), UINT8_C(152), UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C( 69), UINT8_C(184),
+      UINT8_C(200), UINT8_C(150), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(158), UINT8_C(209), UINT8_C(147),
+      UINT8_C(  0), UINT8_C(205), UINT8_C(198), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(175) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_n_u8_z(pv, av, b);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    ev = simde_svmax_n_u8_z(pv, av, b);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C( 25), UINT8_C(212),    UINT8_MAX, UINT8_C(222), UINT8_C(168), UINT8_C( 87), UINT8_C( 96), UINT8_C( 95),
+      UINT8_C(148), UINT8_C(109), UINT8_C(100), UINT8_C( 89), UINT8_C(128), UINT8_C(222), UINT8_C(136), UINT8_C(175),
+      UINT8_C(137), UINT8_C( 36), UINT8_C(158), UINT8_C(  5), UINT8_C( 13), UINT8_C(177), UINT8_C( 39), UINT8_C(197),
+      UINT8_C(157), UINT8_C(126), UINT8_C(243), UINT8_C( 23), UINT8_C(127), UINT8_C(242), UINT8_C(186), UINT8_C(152),
+      UINT8_C(198), UINT8_C(186), UINT8_C(119), UINT8_C(110), UINT8_C( 17), UINT8_C(215), UINT8_C(205), UINT8_C(165),
+      UINT8_C( 68), UINT8_C( 49), UINT8_C(254), UINT8_C(196), UINT8_C( 16), UINT8_C(134), UINT8_C(116), UINT8_C(153),
+      UINT8_C(170), UINT8_C( 18), UINT8_C(158), UINT8_C(183), UINT8_C(195), UINT8_C(197), UINT8_C(125), UINT8_C( 97),
+      UINT8_C( 68), UINT8_C(112), UINT8_C(120), UINT8_C(195), UINT8_C( 98), UINT8_C( 51), UINT8_C( 91), UINT8_C( 40),
+      UINT8_C(237), UINT8_C(210), UINT8_C(150), UINT8_C(254), UINT8_C(170), UINT8_C( 99), UINT8_C(163), UINT8_C(238),
+      UINT8_C(149), UINT8_C(161), UINT8_C(179), UINT8_C(165), UINT8_C( 39), UINT8_C( 39), UINT8_C( 62), UINT8_C(210),
+      UINT8_C( 57), UINT8_C(220), UINT8_C(137), UINT8_C(252), UINT8_C(162), UINT8_C(  6), UINT8_C( 93), UINT8_C(230),
+      UINT8_C(119), UINT8_C(214), UINT8_C(169), UINT8_C(217), UINT8_C(  9), UINT8_C(  4), UINT8_C(  2), UINT8_C(246),
+      UINT8_C(215), UINT8_C(152), UINT8_C(244), UINT8_C(129), UINT8_C(252), UINT8_C(151), UINT8_C(111), UINT8_C(145),
+      UINT8_C( 56), UINT8_C( 34), UINT8_C( 54), UINT8_C( 95), UINT8_C( 73), UINT8_C(116), UINT8_C( 49), UINT8_C(130),
+      UINT8_C( 80), UINT8_C(187), UINT8_C(127), UINT8_C(242), UINT8_C(193), UINT8_C(220), UINT8_C(216), UINT8_C( 56),
+      UINT8_C(178), UINT8_C(129), UINT8_C( 18), UINT8_C(187), UINT8_C(134), UINT8_C( 20), UINT8_C(177), UINT8_C( 93),
+      UINT8_C(172), UINT8_C(165), UINT8_C(222), UINT8_C(168), UINT8_C( 60), UINT8_C( 77), UINT8_C( 57), UINT8_C(116),
+      UINT8_C(112), UINT8_C(111), UINT8_C(212), UINT8_C(185), UINT8_C(227), UINT8_C(  5), UINT8_C( 60), UINT8_C( 52),
+      UINT8_C(192), UINT8_C(187), UINT8_C( 38), UINT8_C(130), UINT8_C(151),    UINT8_MAX, UINT8_C(186), UINT8_C( 74),
+      UINT8_C(128), UINT8_C(204), UINT8_C(  5), UINT8_C(  6), UINT8_C(224), UINT8_C(183), UINT8_C( 99), UINT8_C(141),
+      UINT8_C( 92), UINT8_C( 65), UINT8_C( 53), UINT8_C(153), UINT8_C(143), UINT8_C(111), UINT8_C( 13),    UINT8_MAX,
+      UINT8_C(222), UINT8_C(225), UINT8_C(184), UINT8_C(194), UINT8_C(231), UINT8_C(244), UINT8_C(246), UINT8_C(167),
+      UINT8_C(175), UINT8_C( 28), UINT8_C( 41), UINT8_C( 71), UINT8_C( 27), UINT8_C(228), UINT8_C(145), UINT8_C(156),
+      UINT8_C(176), UINT8_C(150), UINT8_C(162), UINT8_C(145), UINT8_C( 77), UINT8_C(  6), UINT8_C( 30), UINT8_C(170),
+      UINT8_C( 71), UINT8_C( 83), UINT8_C( 67), UINT8_C(214), UINT8_C(194), UINT8_C( 80), UINT8_C(213), UINT8_C(161),
+      UINT8_C( 50), UINT8_C(142), UINT8_C( 99), UINT8_C( 25), UINT8_C(130), UINT8_C( 89), UINT8_C(192), UINT8_C( 50),
+      UINT8_C(117), UINT8_C(234), UINT8_C(121), UINT8_C(145), UINT8_C(206), UINT8_C( 10), UINT8_C( 45), UINT8_C(126),
+      UINT8_C(160), UINT8_C(207), UINT8_C( 15), UINT8_C(238), UINT8_C(213), UINT8_C( 45), UINT8_C(152), UINT8_C( 29),
+      UINT8_C(129), UINT8_C(219), UINT8_C(243), UINT8_C( 67), UINT8_C( 43), UINT8_C(201), UINT8_C(228), UINT8_C( 93),
+      UINT8_C( 87), UINT8_C( 71), UINT8_C(118), UINT8_C(217), UINT8_C(160), UINT8_C( 55), UINT8_C( 11), UINT8_C( 22),
+      UINT8_C( 33), UINT8_C(132), UINT8_C(167), UINT8_C(239), UINT8_C(142), UINT8_C(212), UINT8_C(109), UINT8_C( 47),
+      UINT8_C(163), UINT8_C(125), UINT8_C( 29), UINT8_C(121), UINT8_C(170), UINT8_C(181), UINT8_C(150), UINT8_C( 43),
+      UINT8_C(144), UINT8_C(137), UINT8_C(111), UINT8_C(187), UINT8_C( 82), UINT8_C( 83), UINT8_C( 25), UINT8_C(169),
+      UINT8_C(155), UINT8_C(143), UINT8_C(131), UINT8_C( 59), UINT8_C(198), UINT8_C(142), UINT8_C( 81), UINT8_C(231),
+      UINT8_C( 19), UINT8_C(248), UINT8_C(214), UINT8_C(161), UINT8_C(204), UINT8_C( 68), UINT8_C(208), UINT8_C(112),
+      UINT8_C(193), UINT8_C(237), UINT8_C(233), UINT8_C(107), UINT8_C(162), UINT8_C(127), UINT8_C(151), UINT8_C( 50),
+      UINT8_C(  8), UINT8_C(  6), UINT8_C(238), UINT8_C( 91), UINT8_C( 89), UINT8_C(  7), UINT8_C(  4), UINT8_C(244),
+      UINT8_C(150), UINT8_C(135), UINT8_C( 48), UINT8_C( 93), UINT8_C( 22), UINT8_C(129), UINT8_C( 68), UINT8_C( 41),
+      UINT8_C(122), UINT8_C( 27), UINT8_C(202), UINT8_C( 70), UINT8_C( 95), UINT8_C(155), UINT8_C(182), UINT8_C( 32),
+      UINT8_C(136), UINT8_C(159), UINT8_C(139), UINT8_C( 43), UINT8_C( 30), UINT8_C( 34), UINT8_C( 93), UINT8_C( 39),
+      UINT8_C( 40), UINT8_C( 75), UINT8_C(130), UINT8_C(130), UINT8_C( 82), UINT8_C(134), UINT8_C(118), UINT8_C(233),
+      UINT8_C( 14), UINT8_C(166), UINT8_C( 70), UINT8_C( 36), UINT8_C( 40), UINT8_C(138), UINT8_C( 77), UINT8_C(162),
+      UINT8_C(165), UINT8_C( 23), UINT8_C(232), UINT8_C(  4), UINT8_C(178), UINT8_C(159), UINT8_C( 36), UINT8_C( 59),
+      UINT8_C( 62), UINT8_C(176), UINT8_C(102), UINT8_C( 93), UINT8_C(210), UINT8_C(195), UINT8_C(132), UINT8_C(251),
+      UINT8_C( 15), UINT8_C(  6), UINT8_C(125), UINT8_C( 97), UINT8_C(140), UINT8_C(243), UINT8_C( 74), UINT8_C(154),
+      UINT8_C(154), UINT8_C(144), UINT8_C(190), UINT8_C(194), UINT8_C( 27), UINT8_C( 11), UINT8_C(100), UINT8_C(192),
+      UINT8_C( 35), UINT8_C( 76), UINT8_C(197), UINT8_C(213), UINT8_C(235), UINT8_C(233), UINT8_C( 16), UINT8_C( 42),
+      UINT8_C(153), UINT8_C(118), UINT8_C(135), UINT8_C(108), UINT8_C( 58), UINT8_C( 11), UINT8_C(103), UINT8_C( 73),
+      UINT8_C( 17), UINT8_C(228), UINT8_C(170), UINT8_C(157), UINT8_C(215), UINT8_C(245), UINT8_C( 56), UINT8_C(113),
+      UINT8_C(133), UINT8_C(246), UINT8_C( 51), UINT8_C(160), UINT8_C(  2), UINT8_C(151), UINT8_C( 97), UINT8_C( 37),
+      UINT8_C(228), UINT8_C( 38), UINT8_C(250), UINT8_C(207), UINT8_C( 15), UINT8_C( 11), UINT8_C(249), UINT8_C(169),
+      UINT8_C(129), UINT8_C(128), UINT8_C( 21), UINT8_C(187), UINT8_C(139), UINT8_C(124), UINT8_C(  4), UINT8_C(156),
+      UINT8_C( 96), UINT8_C(175), UINT8_C( 58), UINT8_C( 55), UINT8_C(164), UINT8_C(114), UINT8_C(169), UINT8_C( 41),
+      UINT8_C(104), UINT8_C(220), UINT8_C(202), UINT8_C(106), UINT8_C(116), UINT8_C( 43), UINT8_C(143), UINT8_C( 88),
+      UINT8_C( 81), UINT8_C(138), UINT8_C( 39), UINT8_C( 96), UINT8_C(149), UINT8_C( 33), UINT8_C(  9), UINT8_C( 22),
+      UINT8_C(161), UINT8_C( 30), UINT8_C(210), UINT8_C( 45), UINT8_C(154), UINT8_C(214), UINT8_C(201), UINT8_C(250),
+      UINT8_C(133), UINT8_C(  3), UINT8_C( 50), UINT8_C( 41), UINT8_C(117), UINT8_C(219), UINT8_C( 83), UINT8_C(222),
+      UINT8_C(183), UINT8_C( 29), UINT8_C( 72), UINT8_C( 43), UINT8_C( 72), UINT8_C(216), UINT8_C(131), UINT8_C(153),
+      UINT8_C( 98), UINT8_C(171), UINT8_C(249), UINT8_C(247), UINT8_C(204), UINT8_C(  3), UINT8_C( 13), UINT8_C(109),
+      UINT8_C( 33), UINT8_C(223), UINT8_C(154), UINT8_C(188), UINT8_C(182), UINT8_C(100), UINT8_C(182), UINT8_C( 59),
+      UINT8_C(103), UINT8_C(232), UINT8_C(101), UINT8_C(221), UINT8_C(195), UINT8_C(184), UINT8_C(187), UINT8_C(123),
+      UINT8_C(213), UINT8_C(  3), UINT8_C(166), UINT8_C( 29), UINT8_C(219), UINT8_C( 42), UINT8_C(182), UINT8_C( 61),
+      UINT8_C(213), UINT8_C(175), UINT8_C( 52), UINT8_C(161), UINT8_C(178), UINT8_C( 66), UINT8_C( 14), UINT8_C(212),
+      UINT8_C( 33), UINT8_C(169), UINT8_C(144), UINT8_C(215), UINT8_C( 13), UINT8_C( 70), UINT8_C( 19), UINT8_C(116),
+      UINT8_C( 47), UINT8_C(120), UINT8_C( 81), UINT8_C(242), UINT8_C( 48), UINT8_C( 12), UINT8_C(109), UINT8_C(  5),
+      UINT8_C( 16), UINT8_C( 20), UINT8_C( 34), UINT8_C(235), UINT8_C( 62), UINT8_C(216), UINT8_C( 41), UINT8_C( 19),
+      UINT8_C(135), UINT8_C( 93), UINT8_C(180), UINT8_C( 58), UINT8_C(159), UINT8_C(194), UINT8_C( 14), UINT8_C(193),
+      UINT8_C(107), UINT8_C(158), UINT8_C(152), UINT8_C(120), UINT8_C(228), UINT8_C(171), UINT8_C(237), UINT8_C( 19),
+      UINT8_C( 35), UINT8_C( 62), UINT8_C(  6), UINT8_C( 83), UINT8_C( 75), UINT8_C(115), UINT8_C( 88), UINT8_C( 91),
+      UINT8_C(135), UINT8_C(122), UINT8_C( 70), UINT8_C(197), UINT8_C( 82), UINT8_C(111), UINT8_C(216), UINT8_C(218),
+      UINT8_C(205), UINT8_C(140), UINT8_C( 20), UINT8_C(108), UINT8_C( 79), UINT8_C( 34), UINT8_C( 45), UINT8_C(186),
+      UINT8_C(192), UINT8_C(198), UINT8_C( 51), UINT8_C(164), UINT8_C(113), UINT8_C( 32), UINT8_C(184), UINT8_C(149),
+      UINT8_C( 94), UINT8_C(190), UINT8_C(232), UINT8_C(169), UINT8_C( 49), UINT8_C( 65), UINT8_C(  4), UINT8_C(185),
+      UINT8_C(187), UINT8_C( 75), UINT8_C(126), UINT8_C( 14), UINT8_C(186), UINT8_C( 87), UINT8_C(232), UINT8_C(135),
+      UINT8_C(227), UINT8_C(252), UINT8_C(244), UINT8_C( 50), UINT8_C( 30), UINT8_C( 33), UINT8_C(237), UINT8_C(222),
+      UINT8_C(231), UINT8_C( 32), UINT8_C(130), UINT8_C( 89), UINT8_C( 64), UINT8_C( 58), UINT8_C(238), UINT8_C(158),
+      UINT8_C(248), UINT8_C(214), UINT8_C( 72), UINT8_C( 42), UINT8_C( 23), UINT8_C( 76), UINT8_C(227), UINT8_C(211),
+      UINT8_C(151), UINT8_C( 97), UINT8_C(225), UINT8_C( 82), UINT8_C(184), UINT8_C(201), UINT8_C(217), UINT8_C(156),
+      UINT8_C(197), UINT8_C(205), UINT8_C(206), UINT8_C(227), UINT8_C(239), UINT8_C(187), UINT8_C(193), UINT8_C(214),
+      UINT8_C(219), UINT8_C( 67), UINT8_C( 47), UINT8_C( 27), UINT8_C(126), UINT8_C( 29), UINT8_C(186), UINT8_C(118),
+      UINT8_C(244), UINT8_C(  2), UINT8_C(160), UINT8_C( 11), UINT8_C( 78), UINT8_C(131), UINT8_C(222), UINT8_C(230),
+      UINT8_C(229), UINT8_C(191), UINT8_C( 56), UINT8_C(157), UINT8_C(136), UINT8_C( 17), UINT8_C( 57), UINT8_C( 77),
+      UINT8_C(223), UINT8_C(  8), UINT8_C( 48), UINT8_C(206), UINT8_C(195), UINT8_C(241), UINT8_C(164), UINT8_C(159),
+      UINT8_C( 53), UINT8_C(212), UINT8_C(186), UINT8_C(179), UINT8_C(241), UINT8_C(116), UINT8_C( 41), UINT8_C(229),
+      UINT8_C(118), UINT8_C(202), UINT8_C(241), UINT8_C(197), UINT8_C( 77), UINT8_C(207), UINT8_C(171), UINT8_C( 50),
+      UINT8_C(143), UINT8_C(227), UINT8_C(208), UINT8_C( 23), UINT8_C(244), UINT8_C(  9), UINT8_C(101), UINT8_C(211),
+      UINT8_C( 17), UINT8_C(149), UINT8_C(161), UINT8_C(213), UINT8_C(135), UINT8_C( 70), UINT8_C(116), UINT8_C(188),
+      UINT8_C( 26), UINT8_C( 46), UINT8_C(111), UINT8_C( 11), UINT8_C(163), UINT8_C(152), UINT8_C(241), UINT8_C( 25),
+      UINT8_C( 98), UINT8_C(226), UINT8_C(222), UINT8_C(176), UINT8_C(177), UINT8_C(137), UINT8_C(226), UINT8_C( 64),
+      UINT8_C(108), UINT8_C(178), UINT8_C( 88), UINT8_C( 97), UINT8_C(188), UINT8_C(189), UINT8_C( 52), UINT8_C(205),
+      UINT8_C( 82), UINT8_C(214), UINT8_C(162), UINT8_C(217), UINT8_C( 28), UINT8_C( 22), UINT8_C(149), UINT8_C( 54),
+      UINT8_C( 69), UINT8_C(  4), UINT8_C( 65), UINT8_C(232), UINT8_C(157), UINT8_C( 50), UINT8_C(  1),    UINT8_MAX,
+      UINT8_C( 20), UINT8_C(224), UINT8_C(175), UINT8_C(198), UINT8_C(105), UINT8_C(146), UINT8_C(  6), UINT8_C(214),
+      UINT8_C( 68), UINT8_C( 94), UINT8_C( 55), UINT8_C(  0), UINT8_C( 27), UINT8_C(107), UINT8_C(206), UINT8_C(110),
+      UINT8_C( 65), UINT8_C(112), UINT8_C( 71), UINT8_C( 93), UINT8_C(135), UINT8_C(221), UINT8_C(147), UINT8_C(204),
+      UINT8_C(225), UINT8_C(213), UINT8_C(180), UINT8_C(126), UINT8_C(  7), UINT8_C(181), UINT8_C(126), UINT8_C( 28),
+      UINT8_C(149), UINT8_C( 45), UINT8_C(226),    UINT8_MAX, UINT8_C(191), UINT8_C(232), UINT8_C(213), UINT8_C(  4),
+      UINT8_C( 71), UINT8_C( 12), UINT8_C(  4), UINT8_C( 98), UINT8_C(119), UINT8_C(210), UINT8_C(208), UINT8_C(185),
+      UINT8_C( 67), UINT8_C( 24), UINT8_C( 22), UINT8_C(202), UINT8_C(245), UINT8_C(170), UINT8_C(150), UINT8_C(214),
+      UINT8_C(127), UINT8_C( 74), UINT8_C( 85), UINT8_C(134),    UINT8_MAX, UINT8_C(211), UINT8_C(162), UINT8_C(149),
+      UINT8_C(  0), UINT8_C(132), UINT8_C(148), UINT8_C(192), UINT8_C(109), UINT8_C(105), UINT8_C(196), UINT8_C(180),
+      UINT8_C(117), UINT8_C(200), UINT8_C( 22), UINT8_C(236), UINT8_C(155), UINT8_C(231), UINT8_C(165), UINT8_C(222),
+         UINT8_MAX, UINT8_C(188), UINT8_C(168), UINT8_C(244), UINT8_C(102), UINT8_C( 62), UINT8_C(202), UINT8_C(229),
+      UINT8_C(136), UINT8_C( 31), UINT8_C(107), UINT8_C(135), UINT8_C(242), UINT8_C( 14), UINT8_C( 28), UINT8_C(243),
+      UINT8_C(146), UINT8_C(176), UINT8_C(179),    UINT8_MAX, UINT8_C( 25), UINT8_C(119), UINT8_C(179), UINT8_C(142),
+      UINT8_C( 63), UINT8_C(202), UINT8_C(123), UINT8_C(218), UINT8_C(177), UINT8_C( 32), UINT8_C(184), UINT8_C(176),
+      UINT8_C(220), UINT8_C( 96), UINT8_C(164), UINT8_C( 66), UINT8_C(158), UINT8_C(110), UINT8_C( 39), UINT8_C( 38),
+      UINT8_C(142), UINT8_C(147), UINT8_C(174), UINT8_C(128), UINT8_C(161), UINT8_C(202), UINT8_C(115), UINT8_C( 51),
+      UINT8_C(123), UINT8_C( 38), UINT8_C( 51), UINT8_C(148), UINT8_C(157), UINT8_C(230), UINT8_C( 35), UINT8_C(221),
+      UINT8_C(176), UINT8_C(158), UINT8_C(183), UINT8_C( 97), UINT8_C(190), UINT8_C(112), UINT8_C( 17), UINT8_C(155),
+      UINT8_C(208), UINT8_C(181), UINT8_C(221), UINT8_C(111), UINT8_C( 36), UINT8_C(  5), UINT8_C(149), UINT8_C(178),
+      UINT8_C(152), UINT8_C( 67), UINT8_C( 50), UINT8_C( 57), UINT8_C( 14), UINT8_C(166), UINT8_C(108), UINT8_C(137),
+      UINT8_C(204), UINT8_C(159), UINT8_C( 29), UINT8_C(106), UINT8_C(134), UINT8_C( 64), UINT8_C( 71), UINT8_C( 54),
+      UINT8_C(222), UINT8_C(254), UINT8_C(152), UINT8_C(157), UINT8_C(110), UINT8_C(169), UINT8_C( 56), UINT8_C( 63),
+      UINT8_C( 95), UINT8_C( 21), UINT8_C(174), UINT8_C(131), UINT8_C( 26), UINT8_C( 67), UINT8_C( 53), UINT8_C(178),
+      UINT8_C(135), UINT8_C(103), UINT8_C(235), UINT8_C(149), UINT8_C( 13), UINT8_C( 88), UINT8_C( 30), UINT8_C(218),
+      UINT8_C(247), UINT8_C( 59), UINT8_C( 68), UINT8_C(125), UINT8_C(124), UINT8_C(139), UINT8_C(180), UINT8_C( 90),
+      UINT8_C(137), UINT8_C( 76), UINT8_C(247), UINT8_C(248), UINT8_C(245), UINT8_C( 47), UINT8_C( 55), UINT8_C( 84),
+      UINT8_C( 69), UINT8_C(229), UINT8_C(215), UINT8_C( 95), UINT8_C( 40), UINT8_C( 12), UINT8_C( 18), UINT8_C(175),
+      UINT8_C(116), UINT8_C(253), UINT8_C( 68), UINT8_C(129), UINT8_C( 85), UINT8_C( 98), UINT8_C( 91), UINT8_C( 77),
+      UINT8_C(158), UINT8_C(159), UINT8_C(202), UINT8_C( 26), UINT8_C( 42), UINT8_C(126), UINT8_C(116), UINT8_C(180),
+      UINT8_C(202), UINT8_C(108), UINT8_C(172), UINT8_C(192), UINT8_C(155), UINT8_C(227), UINT8_C( 20), UINT8_C(224),
+      UINT8_C(200), UINT8_C(236), UINT8_C( 64), UINT8_C(240), UINT8_C(248), UINT8_C( 82), UINT8_C(160), UINT8_C(108),
+      UINT8_C( 79), UINT8_C(228), UINT8_C(238), UINT8_C(165), UINT8_C( 71), UINT8_C( 73), UINT8_C(242), UINT8_C(229),
+      UINT8_C(233), UINT8_C(188),    UINT8_MAX, UINT8_C( 19), UINT8_C( 59), UINT8_C(115), UINT8_C(199), UINT8_C(  5),
+      UINT8_C(223), UINT8_C(115), UINT8_C(197), UINT8_C(123), UINT8_C( 86), UINT8_C(218), UINT8_C( 91), UINT8_C( 30),
+      UINT8_C(198) };
+  static const uint8_t b = UINT8_C(144);
+  static const uint8_t e[] =
+    { UINT8_C(144), UINT8_C(212),    UINT8_MAX, UINT8_C(222), UINT8_C(168), UINT8_C( 87), UINT8_C(144), UINT8_C( 95),
+      UINT8_C(148), UINT8_C(144), UINT8_C(144), UINT8_C( 89), UINT8_C(128), UINT8_C(222), UINT8_C(136), UINT8_C(175),
+      UINT8_C(137), UINT8_C( 36), UINT8_C(158), UINT8_C(  5), UINT8_C( 13), UINT8_C(177), UINT8_C(144), UINT8_C(197),
+      UINT8_C(157), UINT8_C(144), UINT8_C(243), UINT8_C( 23), UINT8_C(127), UINT8_C(242), UINT8_C(186), UINT8_C(152),
+      UINT8_C(198), UINT8_C(186), UINT8_C(119), UINT8_C(144), UINT8_C(144), UINT8_C(215), UINT8_C(205), UINT8_C(165),
+      UINT8_C(144), UINT8_C( 49), UINT8_C(254), UINT8_C(196), UINT8_C( 16), UINT8_C(134), UINT8_C(144), UINT8_C(153),
+      UINT8_C(170), UINT8_C(144), UINT8_C(158), UINT8_C(183), UINT8_C(195), UINT8_C(197), UINT8_C(144), UINT8_C( 97),
+      UINT8_C( 68), UINT8_C(144), UINT8_C(120), UINT8_C(195), UINT8_C(144), UINT8_C(144), UINT8_C( 91), UINT8_C(144),
+      UINT8_C(237), UINT8_C(210), UINT8_C(150), UINT8_C(254), UINT8_C(170), UINT8_C(144), UINT8_C(163), UINT8_C(238),
+      UINT8_C(149), UINT8_C(161), UINT8_C(179), UINT8_C(165), UINT8_C( 39), UINT8_C( 39), UINT8_C(144), UINT8_C(210),
+      UINT8_C( 57), UINT8_C(220), UINT8_C(137), UINT8_C(252), UINT8_C(162), UINT8_C(144), UINT8_C( 93), UINT8_C(230),
+      UINT8_C(144), UINT8_C(214), UINT8_C(169), UINT8_C(217), UINT8_C(  9), UINT8_C(144), UINT8_C(  2), UINT8_C(246),
+      UINT8_C(215), UINT8_C(152), UINT8_C(244), UINT8_C(129), UINT8_C(252), UINT8_C(151), UINT8_C(144), UINT8_C(145),
+      UINT8_C( 56), UINT8_C( 34), UINT8_C( 54), UINT8_C( 95), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(130),
+      UINT8_C(144), UINT8_C(187), UINT8_C(144), UINT8_C(242), UINT8_C(193), UINT8_C(220), UINT8_C(216), UINT8_C( 56),
+      UINT8_C(178), UINT8_C(144), UINT8_C(144), UINT8_C(187), UINT8_C(144), UINT8_C( 20), UINT8_C(177), UINT8_C( 93),
+      UINT8_C(172), UINT8_C(165), UINT8_C(222), UINT8_C(168), UINT8_C( 60), UINT8_C(144), UINT8_C(144), UINT8_C(116),
+      UINT8_C(112), UINT8_C(144), UINT8_C(212), UINT8_C(185), UINT8_C(227), UINT8_C(144), UINT8_C( 60), UINT8_C(144),
+      UINT8_C(192), UINT8_C(187), UINT8_C(144), UINT8_C(130), UINT8_C(151),    UINT8_MAX, UINT8_C(186), UINT8_C( 74),
+      UINT8_C(128), UINT8_C(204), UINT8_C(  5), UINT8_C(144), UINT8_C(224), UINT8_C(183), UINT8_C( 99), UINT8_C(141),
+      UINT8_C( 92), UINT8_C( 65), UINT8_C(144), UINT8_C(153), UINT8_C(143), UINT8_C(144), UINT8_C( 13),    UINT8_MAX,
+      UINT8_C(222), UINT8_C(225), UINT8_C(184), UINT8_C(194), UINT8_C(231), UINT8_C(244), UINT8_C(246), UINT8_C(167),
+      UINT8_C(175), UINT8_C( 28), UINT8_C(144), UINT8_C( 71), UINT8_C(144), UINT8_C(228), UINT8_C(145), UINT8_C(156),
+      UINT8_C(176), UINT8_C(150), UINT8_C(162), UINT8_C(145), UINT8_C( 77), UINT8_C(  6), UINT8_C(144), UINT8_C(170),
+      UINT8_C(144), UINT8_C( 83), UINT8_C( 67), UINT8_C(214), UINT8_C(194), UINT8_C( 80), UINT8_C(213), UINT8_C(161),
+      UINT8_C( 50), UINT8_C(142), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(192), UINT8_C( 50),
+      UINT8_C(144), UINT8_C(234), UINT8_C(144), UINT8_C(145), UINT8_C(206), UINT8_C(144), UINT8_C( 45), UINT8_C(144),
+      UINT8_C(160), UINT8_C(207), UINT8_C( 15), UINT8_C(238), UINT8_C(213), UINT8_C( 45), UINT8_C(152), UINT8_C(144),
+      UINT8_C(144), UINT8_C(219), UINT8_C(243), UINT8_C(144), UINT8_C(144), UINT8_C(201), UINT8_C(228), UINT8_C(144),
+      UINT8_C(144), UINT8_C( 71), UINT8_C(144), UINT8_C(217), UINT8_C(160), UINT8_C( 55), UINT8_C( 11), UINT8_C(144),
+      UINT8_C(144), UINT8_C(132), UINT8_C(167), UINT8_C(239), UINT8_C(144), UINT8_C(212), UINT8_C(144), UINT8_C( 47),
+      UINT8_C(163), UINT8_C(144), UINT8_C(144), UINT8_C(121), UINT8_C(170), UINT8_C(181), UINT8_C(150), UINT8_C(144),
+      UINT8_C(144), UINT8_C(144), UINT8_C(111), UINT8_C(187), UINT8_C( 82), UINT8_C(144), UINT8_C( 25), UINT8_C(169),
+      UINT8_C(155), UINT8_C(143), UINT8_C(144), UINT8_C( 59), UINT8_C(198), UINT8_C(142), UINT8_C( 81), UINT8_C(231),
+      UINT8_C( 19), UINT8_C(248), UINT8_C(214), UINT8_C(161), UINT8_C(204), UINT8_C(144), UINT8_C(208), UINT8_C(144),
+      UINT8_C(193), UINT8_C(237), UINT8_C(233), UINT8_C(144), UINT8_C(162), UINT8_C(127), UINT8_C(151), UINT8_C( 50),
+      UINT8_C(144), UINT8_C(144), UINT8_C(238), UINT8_C(144), UINT8_C( 89), UINT8_C(  7), UINT8_C(144), UINT8_C(244),
+      UINT8_C(150), UINT8_C(144), UINT8_C( 48), UINT8_C(144), UINT8_C( 22), UINT8_C(129), UINT8_C( 68), UINT8_C( 41),
+      UINT8_C(144), UINT8_C( 27), UINT8_C(202), UINT8_C(144), UINT8_C( 95), UINT8_C(155), UINT8_C(182), UINT8_C(144),
+      UINT8_C(144), UINT8_C(159), UINT8_C(139), UINT8_C( 43), UINT8_C( 30), UINT8_C(144), UINT8_C(144), UINT8_C( 39),
+      UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C( 82), UINT8_C(144), UINT8_C(144), UINT8_C(233),
+      UINT8_C( 14), UINT8_C(166), UINT8_C(144), UINT8_C( 36), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(162),
+      UINT8_C(165), UINT8_C( 23), UINT8_C(232), UINT8_C(  4), UINT8_C(178), UINT8_C(159), UINT8_C( 36), UINT8_C(144),
+      UINT8_C(144), UINT8_C(176), UINT8_C(144), UINT8_C(144), UINT8_C(210), UINT8_C(195), UINT8_C(144), UINT8_C(251),
+      UINT8_C( 15), UINT8_C(144), UINT8_C(144), UINT8_C( 97), UINT8_C(140), UINT8_C(243), UINT8_C(144), UINT8_C(154),
+      UINT8_C(154), UINT8_C(144), UINT8_C(190), UINT8_C(194), UINT8_C( 27), UINT8_C( 11), UINT8_C(100), UINT8_C(192),
+      UINT8_C(144), UINT8_C(144), UINT8_C(197), UINT8_C(213), UINT8_C(235), UINT8_C(233), UINT8_C( 16), UINT8_C( 42),
+      UINT8_C(153), UINT8_C(118), UINT8_C(135), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144),
+      UINT8_C(144), UINT8_C(228), UINT8_C(170), UINT8_C(157), UINT8_C(215), UINT8_C(245), UINT8_C( 56), UINT8_C(113),
+      UINT8_C(144), UINT8_C(246), UINT8_C( 51), UINT8_C(160), UINT8_C(  2), UINT8_C(151), UINT8_C( 97), UINT8_C( 37),
+      UINT8_C(228), UINT8_C( 38), UINT8_C(250), UINT8_C(207), UINT8_C( 15), UINT8_C( 11), UINT8_C(249), UINT8_C(169),
+      UINT8_C(129), UINT8_C(144), UINT8_C(144), UINT8_C(187), UINT8_C(144), UINT8_C(124), UINT8_C(144), UINT8_C(156),
+      UINT8_C(144), UINT8_C(175), UINT8_C( 58), UINT8_C(144), UINT8_C(164), UINT8_C(144), UINT8_C(169), UINT8_C( 41),
+      UINT8_C(144), UINT8_C(220), UINT8_C(202), UINT8_C(106), UINT8_C(144), UINT8_C(144), UINT8_C(143), UINT8_C( 88),
+      UINT8_C( 81), UINT8_C(144), UINT8_C( 39), UINT8_C( 96), UINT8_C(149), UINT8_C(144), UINT8_C(144), UINT8_C( 22),
+      UINT8_C(161), UINT8_C( 30), UINT8_C(210), UINT8_C( 45), UINT8_C(154), UINT8_C(214), UINT8_C(201), UINT8_C(250),
+      UINT8_C(144), UINT8_C(144), UINT8_C( 50), UINT8_C( 41), UINT8_C(117), UINT8_C(219), UINT8_C(144), UINT8_C(222),
+      UINT8_C(183), UINT8_C( 29), UINT8_C( 72), UINT8_C( 43), UINT8_C(144), UINT8_C(216), UINT8_C(131), UINT8_C(153),
+      UINT8_C( 98), UINT8_C(171), UINT8_C(249), UINT8_C(247), UINT8_C(204), UINT8_C(  3), UINT8_C(144), UINT8_C(109),
+      UINT8_C(144), UINT8_C(223), UINT8_C(154), UINT8_C(188), UINT8_C(182), UINT8_C(144), UINT8_C(182), UINT8_C( 59),
+      UINT8_C(144), UINT8_C(232), UINT8_C(144), UINT8_C(221), UINT8_C(195), UINT8_C(184), UINT8_C(187), UINT8_C(144),
+      UINT8_C(213), UINT8_C(144), UINT8_C(166), UINT8_C( 29), UINT8_C(219), UINT8_C( 42), UINT8_C(182), UINT8_C(144),
+      UINT8_C(213), UINT8_C(175), UINT8_C( 52), UINT8_C(161), UINT8_C(178), UINT8_C(144), UINT8_C( 14), UINT8_C(212),
+      UINT8_C(144), UINT8_C(169), UINT8_C(144), UINT8_C(215), UINT8_C( 13), UINT8_C(144), UINT8_C(144), UINT8_C(144),
+      UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(242), UINT8_C(144), UINT8_C( 12), UINT8_C(144), UINT8_C(144),
+      UINT8_C(144), UINT8_C(144), UINT8_C( 34), UINT8_C(235), UINT8_C(144), UINT8_C(216), UINT8_C( 41), UINT8_C( 19),
+      UINT8_C(135), UINT8_C(144), UINT8_C(180), UINT8_C( 58), UINT8_C(159), UINT8_C(194), UINT8_C( 14), UINT8_C(193),
+      UINT8_C(107), UINT8_C(158), UINT8_C(152), UINT8_C(120), UINT8_C(228), UINT8_C(171), UINT8_C(237), UINT8_C(144),
+      UINT8_C( 35), UINT8_C( 62), UINT8_C(  6), UINT8_C(144), UINT8_C( 75), UINT8_C(144), UINT8_C(144), UINT8_C( 91),
+      UINT8_C(135), UINT8_C(144), UINT8_C( 70), UINT8_C(197), UINT8_C(144), UINT8_C(111), UINT8_C(216), UINT8_C(218),
+      UINT8_C(205), UINT8_C(144), UINT8_C( 20), UINT8_C(108), UINT8_C( 79), UINT8_C( 34), UINT8_C( 45), UINT8_C(186),
+      UINT8_C(192), UINT8_C(198), UINT8_C(144), UINT8_C(164), UINT8_C(113), UINT8_C( 32), UINT8_C(184), UINT8_C(149),
+      UINT8_C( 94), UINT8_C(190), UINT8_C(232), UINT8_C(169), UINT8_C(144), UINT8_C(144), UINT8_C(  4), UINT8_C(185),
+      UINT8_C(187), UINT8_C( 75), UINT8_C(126), UINT8_C( 14), UINT8_C(186), UINT8_C( 87), UINT8_C(232), UINT8_C(144),
+      UINT8_C(227), UINT8_C(252), UINT8_C(244), UINT8_C( 50), UINT8_C(144), UINT8_C( 33), UINT8_C(237), UINT8_C(222),
+      UINT8_C(231), UINT8_C( 32), UINT8_C(130), UINT8_C( 89), UINT8_C(144), UINT8_C(144), UINT8_C(238), UINT8_C(158),
+      UINT8_C(248), UINT8_C(214), UINT8_C(144), UINT8_C(144), UINT8_C( 23), UINT8_C(144), UINT8_C(227), UINT8_C(211),
+      UINT8_C(151), UINT8_C(144), UINT8_C(225), UINT8_C(144), UINT8_C(184), UINT8_C(201), UINT8_C(217), UINT8_C(156),
+      UINT8_C(197), UINT8_C(205), UINT8_C(206), UINT8_C(227), UINT8_C(239), UINT8_C(187), UINT8_C(193), UINT8_C(214),
+      UINT8_C(219), UINT8_C( 67), UINT8_C( 47), UINT8_C( 27), UINT8_C(126), UINT8_C(144), UINT8_C(186), UINT8_C(118),
+      UINT8_C(244), UINT8_C(  2), UINT8_C(160), UINT8_C( 11), UINT8_C(144), UINT8_C(144), UINT8_C(222), UINT8_C(230),
+      UINT8_C(229), UINT8_C(191), UINT8_C(144), UINT8_C(157), UINT8_C(144), UINT8_C(144), UINT8_C( 57), UINT8_C( 77),
+      UINT8_C(223), UINT8_C(144), UINT8_C(144), UINT8_C(206), UINT8_C(195), UINT8_C(241), UINT8_C(164), UINT8_C(159),
+      UINT8_C( 53), UINT8_C(212), UINT8_C(186), UINT8_C(179), UINT8_C(241), UINT8_C(116), UINT8_C( 41), UINT8_C(229),
+      UINT8_C(118), UINT8_C(202), UINT8_C(241), UINT8_C(197), UINT8_C(144), UINT8_C(207), UINT8_C(171), UINT8_C( 50),
+      UINT8_C(143), UINT8_C(227), UINT8_C(208), UINT8_C(144), UINT8_C(244), UINT8_C(144), UINT8_C(144), UINT8_C(211),
+      UINT8_C( 17), UINT8_C(149), UINT8_C(161), UINT8_C(213), UINT8_C(144), UINT8_C(144), UINT8_C(116), UINT8_C(188),
+      UINT8_C(144), UINT8_C(144), UINT8_C(111), UINT8_C(144), UINT8_C(163), UINT8_C(152), UINT8_C(241), UINT8_C( 25),
+      UINT8_C(144), UINT8_C(226), UINT8_C(222), UINT8_C(176), UINT8_C(177), UINT8_C(137), UINT8_C(226), UINT8_C( 64),
+      UINT8_C(108), UINT8_C(178), UINT8_C( 88), UINT8_C(144), UINT8_C(188), UINT8_C(189), UINT8_C( 52), UINT8_C(205),
+      UINT8_C(144), UINT8_C(214), UINT8_C(162), UINT8_C(217), UINT8_C(144), UINT8_C( 22), UINT8_C(149), UINT8_C(144),
+      UINT8_C( 69), UINT8_C(  4), UINT8_C( 65), UINT8_C(232), UINT8_C(157), UINT8_C(144), UINT8_C(  1),    UINT8_MAX,
+      UINT8_C(144), UINT8_C(224), UINT8_C(175), UINT8_C(198), UINT8_C(144), UINT8_C(146), UINT8_C(  6), UINT8_C(214),
+      UINT8_C( 68), UINT8_C(144), UINT8_C(144), UINT8_C(  0), UINT8_C(144), UINT8_C(107), UINT8_C(206), UINT8_C(144),
+      UINT8_C( 65), UINT8_C(112), UINT8_C( 71), UINT8_C(144), UINT8_C(144), UINT8_C(221), UINT8_C(147), UINT8_C(204),
+      UINT8_C(225), UINT8_C(213), UINT8_C(180), UINT8_C(144), UINT8_C(  7), UINT8_C(181), UINT8_C(126), UINT8_C( 28),
+      UINT8_C(149), UINT8_C(144), UINT8_C(226),    UINT8_MAX, UINT8_C(191), UINT8_C(232), UINT8_C(213), UINT8_C(  4),
+      UINT8_C(144), UINT8_C(144), UINT8_C(  4), UINT8_C(144), UINT8_C(144), UINT8_C(210), UINT8_C(208), UINT8_C(185),
+      UINT8_C(144), UINT8_C(144), UINT8_C( 22), UINT8_C(202), UINT8_C(245), UINT8_C(170), UINT8_C(150), UINT8_C(214),
+      UINT8_C(127), UINT8_C( 74), UINT8_C( 85), UINT8_C(144),    UINT8_MAX, UINT8_C(211), UINT8_C(162), UINT8_C(149),
+      UINT8_C(144), UINT8_C(144), UINT8_C(148), UINT8_C(192), UINT8_C(109), UINT8_C(144), UINT8_C(196), UINT8_C(180),
+      UINT8_C(117), UINT8_C(200), UINT8_C(144), UINT8_C(236), UINT8_C(155), UINT8_C(231), UINT8_C(165), UINT8_C(222),
+         UINT8_MAX, UINT8_C(188), UINT8_C(168), UINT8_C(244), UINT8_C(144), UINT8_C( 62), UINT8_C(202), UINT8_C(229),
+      UINT8_C(136), UINT8_C( 31), UINT8_C(144), UINT8_C(144), UINT8_C(242), UINT8_C(144), UINT8_C( 28), UINT8_C(243),
+      UINT8_C(146), UINT8_C(176), UINT8_C(179),    UINT8_MAX, UINT8_C( 25), UINT8_C(119), UINT8_C(179), UINT8_C(142),
+      UINT8_C(144), UINT8_C(202), UINT8_C(144), UINT8_C(218), UINT8_C(177), UINT8_C( 32), UINT8_C(184), UINT8_C(176),
+      UINT8_C(220), UINT8_C(144), UINT8_C(164), UINT8_C(144), UINT8_C(158), UINT8_C(144), UINT8_C(144), UINT8_C( 38),
+      UINT8_C(142), UINT8_C(147), UINT8_C(174), UINT8_C(128), UINT8_C(161), UINT8_C(202), UINT8_C(115), UINT8_C( 51),
+      UINT8_C(144), UINT8_C( 38), UINT8_C(144), UINT8_C(148), UINT8_C(157), UINT8_C(230), UINT8_C( 35), UINT8_C(221),
+      UINT8_C(176), UINT8_C(158), UINT8_C(183), UINT8_C(144), UINT8_C(190), UINT8_C(144), UINT8_C(144), UINT8_C(155),
+      UINT8_C(208), UINT8_C(181), UINT8_C(221), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(149), UINT8_C(178),
+      UINT8_C(152), UINT8_C(144), UINT8_C( 50), UINT8_C( 57), UINT8_C(144), UINT8_C(166), UINT8_C(144), UINT8_C(144),
+      UINT8_C(204), UINT8_C(159), UINT8_C(144), UINT8_C(144), UINT8_C(134), UINT8_C(144), UINT8_C(144), UINT8_C( 54),
+      UINT8_C(222), UINT8_C(254), UINT8_C(152), UINT8_C(157), UINT8_C(110), UINT8_C(169), UINT8_C(144), UINT8_C(144),
+      UINT8_C(144), UINT8_C(144), UINT8_C(174), UINT8_C(144), UINT8_C(144), UINT8_C( 67), UINT8_C(144), UINT8_C(178),
+      UINT8_C(144), UINT8_C(144), UINT8_C(235), UINT8_C(149), UINT8_C( 13), UINT8_C(144), UINT8_C( 30), UINT8_C(218),
+      UINT8_C(247), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(180), UINT8_C(144),
+      UINT8_C(144), UINT8_C( 76), UINT8_C(247), UINT8_C(248), UINT8_C(245), UINT8_C( 47), UINT8_C(144), UINT8_C( 84),
+      UINT8_C( 69), UINT8_C(229), UINT8_C(215), UINT8_C(144), UINT8_C( 40), UINT8_C(144), UINT8_C(144), UINT8_C(175),
+      UINT8_C(116), UINT8_C(253), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C(144), UINT8_C( 77),
+      UINT8_C(158), UINT8_C(159), UINT8_C(202), UINT8_C( 26), UINT8_C( 42), UINT8_C(144), UINT8_C(144), UINT8_C(180),
+      UINT8_C(202), UINT8_C(144), UINT8_C(172), UINT8_C(192), UINT8_C(155), UINT8_C(227), UINT8_C( 20), UINT8_C(224),
+      UINT8_C(200), UINT8_C(236), UINT8_C( 64), UINT8_C(240), UINT8_C(248), UINT8_C(144), UINT8_C(160), UINT8_C(108),
+      UINT8_C(144), UINT8_C(228), UINT8_C(238), UINT8_C(165), UINT8_C( 71), UINT8_C(144), UINT8_C(242), UINT8_C(229),
+      UINT8_C(233), UINT8_C(188),    UINT8_MAX, UINT8_C( 19), UINT8_C(144), UINT8_C(144), UINT8_C(199), UINT8_C(144),
+      UINT8_C(223), UINT8_C(115), UINT8_C(197), UINT8_C(123), UINT8_C(144), UINT8_C(218), UINT8_C( 91), UINT8_C( 30),
+      UINT8_C(198) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmax_n_u8_m(pv, av, b);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    ev = simde_svmax_n_u8_m(pv, av, b);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C( 4511), UINT16_C(15396), UINT16_C(   79), UINT16_C(38435), UINT16_C(12925), UINT16_C(55888), UINT16_C(57070), UINT16_C(52792),
+      UINT16_C(54647), UINT16_C(38903), UINT16_C( 8594), UINT16_C(27664), UINT16_C(36427), UINT16_C(52405), UINT16_C(22325), UINT16_C(54336),
+      UINT16_C(25960), UINT16_C(47121), UINT16_C(13413), UINT16_C(57934), UINT16_C(40806), UINT16_C(21948), UINT16_C(62589), UINT16_C(62755),
+      UINT16_C( 6857), UINT16_C(23436), UINT16_C(40251), UINT16_C(34504), UINT16_C(32043), UINT16_C(24659), UINT16_C(37844), UINT16_C(15669),
+      UINT16_C(18168), UINT16_C(24053), UINT16_C(17274), UINT16_C(57663), UINT16_C(64738), UINT16_C(24630), UINT16_C(23024), UINT16_C(47701),
+      UINT16_C(57715), UINT16_C(44821), UINT16_C(56702), UINT16_C(43317), UINT16_C(34907), UINT16_C(12042), UINT16_C(16156), UINT16_C( 5228),
+      UINT16_C(24965), UINT16_C(65394), UINT16_C(45477), UINT16_C(34784), UINT16_C( 5805), UINT16_C(40679), UINT16_C(15471), UINT16_C(58200),
+      UINT16_C(27934), UINT16_C(40082), UINT16_C(51019), UINT16_C(42566), UINT16_C(20560), UINT16_C(27861), UINT16_C(17039), UINT16_C( 5248),
+      UINT16_C(62115), UINT16_C(18451), UINT16_C(62628), UINT16_C(20944), UINT16_C(46858), UINT16_C(31471), UINT16_C(18420), UINT16_C( 4701),
+      UINT16_C(61365), UINT16_C(  174), UINT16_C(62646), UINT16_C( 1702), UINT16_C(31556), UINT16_C(54130), UINT16_C(62397), UINT16_C(25063),
+      UINT16_C(64485), UINT16_C(35241), UINT16_C(31215), UINT16_C(63963), UINT16_C(51761), UINT16_C( 9587), UINT16_C(53266), UINT16_C(50999),
+      UINT16_C(58815), UINT16_C(30407), UINT16_C(28122), UINT16_C( 7804), UINT16_C(61416), UINT16_C(42738), UINT16_C(55778), UINT16_C(50951),
+      UINT16_C(45268), UINT16_C(50001), UINT16_C(11306), UINT16_C(23485), UINT16_C(12534), UINT16_C( 2176), UINT16_C(46849), UINT16_C(49359),
+      UINT16_C(38556), UINT16_C(30262), UINT16_C(45827), UINT16_C(60565), UINT16_C(34722), UINT16_C(33938), UINT16_C(39264), UINT16_C(13643),
+      UINT16_C(40009), UINT16_C(29688), UINT16_C(46536), UINT16_C(49102), UINT16_C(20198), UINT16_C(59335), UINT16_C(38661), UINT16_C(41639),
+      UINT16_C(56877), UINT16_C(12568), UINT16_C(44433), UINT16_C(13085), UINT16_C(44852), UINT16_C(38327), UINT16_C(  584), UINT16_C(37322),
+      UINT16_C(49823), UINT16_C(26373), UINT16_C(54136), UINT16_C(24102), UINT16_C(60962), UINT16_C(10053), UINT16_C(60549), UINT16_C(45769),
+      UINT16_C(58058), UINT16_C(23523), UINT16_C(  143), UINT16_C(50318), UINT16_C(17839), UINT16_C(63321), UINT16_C( 9032), UINT16_C(59273),
+      UINT16_C(36581), UINT16_C(23886), UINT16_C(30049), UINT16_C(33723), UINT16_C(   99), UINT16_C(59563), UINT16_C(29933), UINT16_C(47002),
+      UINT16_C(32342), UINT16_C(58899), UINT16_C(41342), UINT16_C(11946), UINT16_C(  999), UINT16_C(12069), UINT16_C(44582), UINT16_C( 2838),
+      UINT16_C(25660), UINT16_C(40553), UINT16_C( 9433), UINT16_C(15393), UINT16_C(52261), UINT16_C( 4644), UINT16_C(48961), UINT16_C(38857),
+      UINT16_C(56381), UINT16_C(47997), UINT16_C(10110), UINT16_C(26089), UINT16_C( 3882), UINT16_C(20628), UINT16_C(43709), UINT16_C(64092),
+      UINT16_C(50446), UINT16_C(59544), UINT16_C(47593), UINT16_C( 3620), UINT16_C(18822), UINT16_C(50976), UINT16_C(59912), UINT16_C(17758),
+      UINT16_C(56518), UINT16_C(17408), UINT16_C(59907), UINT16_C(11945), UINT16_C(15865), UINT16_C(46718), UINT16_C(56039), UINT16_C(63152),
+      UINT16_C(18591), UINT16_C(35294), UINT16_C(  514), UINT16_C(34967), UINT16_C(47179), UINT16_C(21327), UINT16_C(44450), UINT16_C(26776),
+      UINT16_C(39305), UINT16_C(36269), UINT16_C(22147), UINT16_C(31931), UINT16_C(14740), UINT16_C(31538), UINT16_C(58132), UINT16_C(45937),
+      UINT16_C(20267), UINT16_C(11580), UINT16_C(54354), UINT16_C(40373), UINT16_C( 1164), UINT16_C(12017), UINT16_C(35250), UINT16_C(15254),
+      UINT16_C(17186), UINT16_C(42440), UINT16_C(33690), UINT16_C(11809), UINT16_C(21693), UINT16_C(53673), UINT16_C( 6967), UINT16_C(25220),
+      UINT16_C(49514), UINT16_C(48272), UINT16_C(17813), UINT16_C( 8538), UINT16_C(19274), UINT16_C(64591), UINT16_C(58836), UINT16_C(63287),
+      UINT16_C(   41), UINT16_C(50076), UINT16_C(48771), UINT16_C(16625), UINT16_C(39442), UINT16_C(18705), UINT16_C(38581), UINT16_C( 8363),
+      UINT16_C(15191), UINT16_C(60636), UINT16_C(13953), UINT16_C(51981), UINT16_C(23681), UINT16_C(22215), UINT16_C(65089), UINT16_C(27213),
+      UINT16_C(59902), UINT16_C(33325), UINT16_C( 7847), UINT16_C(47554), UINT16_C(54457), UINT16_C(28162), UINT16_C(44650), UINT16_C(49550),
+      UINT16_C(27625), UINT16_C(27309), UINT16_C(47777), UINT16_C( 9013), UINT16_C(64534), UINT16_C(22393), UINT16_C(50939), UINT16_C(63938),
+      UINT16_C(61359), UINT16_C(22395), UINT16_C(15886), UINT16_C(50960), UINT16_C( 4882), UINT16_C(31797), UINT16_C(50369), UINT16_C(43581),
+      UINT16_C(59951), UINT16_C(53269), UINT16_C(19108), UINT16_C(47859), UINT16_C(27719), UINT16_C(16913), UINT16_C(54066), UINT16_C(57915),
+      UINT16_C(47043), UINT16_C(53561), UINT16_C(18933), UINT16_C( 1944), UINT16_C(52572), UINT16_C( 7555), UINT16_C(49297), UINT16_C(49352),
+      UINT16_C(56746), UINT16_C(20113), UINT16_C(33831), UINT16_C(28168), UINT16_C( 6641), UINT16_C( 9136), UINT16_C(60653), UINT16_C(45061),
+      UINT16_C(16035), UINT16_C(39041), UINT16_C( 6536), UINT16_C(58527), UINT16_C( 8934), UINT16_C(30722), UINT16_C(51938), UINT16_C(35896),
+      UINT16_C(51623), UINT16_C(52954), UINT16_C(57934), UINT16_C(16189), UINT16_C(60923), UINT16_C(59490), UINT16_C(26841), UINT16_C(31896),
+      UINT16_C( 6566), UINT16_C(11796), UINT16_C(45874), UINT16_C( 6419), UINT16_C( 5589), UINT16_C(46993), UINT16_C(51679), UINT16_C(34371),
+      UINT16_C( 7571), UINT16_C(57684), UINT16_C(37375), UINT16_C(64288), UINT16_C(33407), UINT16_C(22755), UINT16_C(31978), UINT16_C(37333),
+      UINT16_C(59797), UINT16_C(51391), UINT16_C(53917), UINT16_C(29409), UINT16_C(29415), UINT16_C(50730), UINT16_C(27963), UINT16_C(52812),
+      UINT16_C(41355), UINT16_C(35503), UINT16_C(53042), UINT16_C(45445), UINT16_C(26962), UINT16_C(15370), UINT16_C(57317), UINT16_C(31437),
+      UINT16_C(36296), UINT16_C(25922), UINT16_C( 9055), UINT16_C(18392), UINT16_C(  661), UINT16_C(53517), UINT16_C(23151), UINT16_C(64159),
+      UINT16_C(20475), UINT16_C(11653), UINT16_C( 2590), UINT16_C(28895), UINT16_C(59763), UINT16_C(22701), UINT16_C(31432), UINT16_C(37075),
+      UINT16_C( 5383), UINT16_C(26614), UINT16_C(52793), UINT16_C(52910), UINT16_C(48080), UINT16_C(16287), UINT16_C(16149), UINT16_C( 4154),
+      UINT16_C(49038), UINT16_C(44094), UINT16_C( 7625), UINT16_C(15645), UINT16_C(51718), UINT16_C(52885), UINT16_C(26692), UINT16_C(19550),
+      UINT16_C(21630), UINT16_C(47027), UINT16_C(24866), UINT16_C(62085), UINT16_C( 9500), UINT16_C(12850), UINT16_C(27748), UINT16_C(62018),
+      UINT16_C(32811), UINT16_C(62622), UINT16_C(48029), UINT16_C(41777), UINT16_C(51077), UINT16_C(51825), UINT16_C(53295), UINT16_C(44310),
+      UINT16_C(51492), UINT16_C(18276), UINT16_C(59946), UINT16_C(17977), UINT16_C(27407), UINT16_C(29560), UINT16_C(48087), UINT16_C(  613),
+      UINT16_C(  827), UINT16_C(55799), UINT16_C(10431), UINT16_C(17532), UINT16_C(61167), UINT16_C( 7950), UINT16_C( 9406), UINT16_C(58060),
+      UINT16_C(12781), UINT16_C( 5929), UINT16_C(25371), UINT16_C(10846), UINT16_C(54990), UINT16_C(42653), UINT16_C(  657), UINT16_C(52648),
+      UINT16_C(40709), UINT16_C(50342), UINT16_C( 8904), UINT16_C(46857), UINT16_C( 5904), UINT16_C(52950), UINT16_C(41788), UINT16_C(10673),
+      UINT16_C(56020), UINT16_C(61249), UINT16_C(40765), UINT16_C( 3097), UINT16_C(46709), UINT16_C( 1970), UINT16_C(23224), UINT16_C(48596),
+      UINT16_C(31482), UINT16_C(49794), UINT16_C(35740), UINT16_C(44409), UINT16_C(20642), UINT16_C(56955), UINT16_C(11507), UINT16_C(50952),
+      UINT16_C(18695), UINT16_C(17590), UINT16_C(53224), UINT16_C(23888), UINT16_C(  645), UINT16_C(15716) };
+  static const uint16_t b = UINT16_C( 2005);
+  static const uint16_t e[] =
+    { UINT16_C( 4511), UINT16_C(15396), UINT16_C( 2005), UINT16_C(    0), UINT16_C(    0), UINT16_C(55888), UINT16_C(57070), UINT16_C(52792),
+      UINT16_C(54647), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(36427), UINT16_C(52405), UINT16_C(22325), UINT16_C(    0),
+      UINT16_C(25960), UINT16_C(    0), UINT16_C(13413), UINT16_C(    0), UINT16_C(40806), UINT16_C(    0), UINT16_C(    0), UINT16_C(62755),
+      UINT16_C(    0), UINT16_C(23436), UINT16_C(40251), UINT16_C(34504), UINT16_C(32043), UINT16_C(24659), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(24053), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(24630), UINT16_C(    0), UINT16_C(47701),
+      UINT16_C(57715), UINT16_C(    0), UINT16_C(    0), UINT16_C(43317), UINT16_C(    0), UINT16_C(12042), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(24965), UINT16_C(65394), UINT16_C(    0), UINT16_C(34784), UINT16_C( 5805), UINT16_C(40679), UINT16_C(15471), UINT16_C(58200),
+      UINT16_C(27934), UINT16_C(40082), UINT16_C(51019), UINT16_C(42566), UINT16_C(20560), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(62115), UINT16_C(18451), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(31471), UINT16_C(    0), UINT16_C( 4701),
+      UINT16_C(61365), UINT16_C(    0), UINT16_C(62646), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(35241), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 9587), UINT16_C(53266), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(30407), UINT16_C(    0), UINT16_C( 7804), UINT16_C(61416), UINT16_C(    0), UINT16_C(55778), UINT16_C(50951),
+      UINT16_C(    0), UINT16_C(50001), UINT16_C(    0), UINT16_C(    0), UINT16_C(12534), UINT16_C(    0), UINT16_C(    0), UINT16_C(49359),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(34722), UINT16_C(    0), UINT16_C(39264), UINT16_C(13643),
+      UINT16_C(    0), UINT16_C(29688), UINT16_C(    0), UINT16_C(49102), UINT16_C(    0), UINT16_C(59335), UINT16_C(38661), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(44433), UINT16_C(    0), UINT16_C(44852), UINT16_C(38327), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(49823), UINT16_C(    0), UINT16_C(    0), UINT16_C(24102), UINT16_C(    0), UINT16_C(10053), UINT16_C(60549), UINT16_C(    0),
+      UINT16_C(58058), UINT16_C(    0), UINT16_C( 2005), UINT16_C(    0), UINT16_C(17839), UINT16_C(    0), UINT16_C( 9032), UINT16_C(59273),
+      UINT16_C(36581), UINT16_C(23886), UINT16_C(30049), UINT16_C(33723), UINT16_C(    0), UINT16_C(59563), UINT16_C(    0), UINT16_C(47002),
+      UINT16_C(    0), UINT16_C(58899), UINT16_C(    0), UINT16_C(    0), UINT16_C( 2005), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(25660), UINT16_C(    0), UINT16_C(    0), UINT16_C(15393), UINT16_C(    0), UINT16_C( 4644), UINT16_C(48961), UINT16_C(38857),
+      UINT16_C(56381), UINT16_C(47997), UINT16_C(    0), UINT16_C(    0), UINT16_C( 3882), UINT16_C(20628), UINT16_C(43709), UINT16_C(    0),
+      UINT16_C(50446), UINT16_C(    0), UINT16_C(    0), UINT16_C( 3620), UINT16_C(    0), UINT16_C(    0), UINT16_C(59912), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(17408), UINT16_C(    0), UINT16_C(11945), UINT16_C(15865), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(18591), UINT16_C(35294), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(44450), UINT16_C(    0),
+      UINT16_C(39305), UINT16_C(    0), UINT16_C(22147), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(58132), UINT16_C(45937),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(54354), UINT16_C(    0), UINT16_C( 2005), UINT16_C(12017), UINT16_C(35250), UINT16_C(15254),
+      UINT16_C(17186), UINT16_C(    0), UINT16_C(33690), UINT16_C(11809), UINT16_C(21693), UINT16_C(53673), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(48272), UINT16_C(17813), UINT16_C(    0), UINT16_C(19274), UINT16_C(    0), UINT16_C(58836), UINT16_C(    0),
+      UINT16_C( 2005), UINT16_C(    0), UINT16_C(48771), UINT16_C(    0), UINT16_C(39442), UINT16_C(    0), UINT16_C(38581), UINT16_C( 8363),
+      UINT16_C(    0), UINT16_C(60636), UINT16_C(    0), UINT16_C(    0), UINT16_C(23681), UINT16_C(    0), UINT16_C(    0), UINT16_C(27213),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(47554), UINT16_C(    0), UINT16_C(28162), UINT16_C(44650), UINT16_C(    0),
+      UINT16_C(27625), UINT16_C(    0), UINT16_C(47777), UINT16_C( 9013), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(61359), UINT16_C(22395), UINT16_C(15886), UINT16_C(    0), UINT16_C( 4882), UINT16_C(31797), UINT16_C(    0), UINT16_C(43581),
+      UINT16_C(59951), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(18933), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(49352),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(28168), UINT16_C( 6641), UINT16_C(    0), UINT16_C(60653), UINT16_C(    0),
+      UINT16_C(16035), UINT16_C(    0), UINT16_C( 6536), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(51938), UINT16_C(35896),
+      UINT16_C(51623), UINT16_C(    0), UINT16_C(57934), UINT16_C(16189), UINT16_C(    0), UINT16_C(    0), UINT16_C(26841), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(11796), UINT16_C(45874), UINT16_C(    0), UINT16_C( 5589), UINT16_C(    0), UINT16_C(51679), UINT16_C(34371),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(37375), UINT16_C(64288), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(37333),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(53917), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27963), UINT16_C(52812),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(53042), UINT16_C(    0), UINT16_C(26962), UINT16_C(15370), UINT16_C(    0), UINT16_C(31437),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(18392), UINT16_C( 2005), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(20475), UINT16_C(11653), UINT16_C( 2590), UINT16_C(28895), UINT16_C(59763), UINT16_C(22701), UINT16_C(31432), UINT16_C(37075),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(52793), UINT16_C(    0), UINT16_C(48080), UINT16_C(16287), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(51718), UINT16_C(52885), UINT16_C(    0), UINT16_C(19550),
+      UINT16_C(21630), UINT16_C(    0), UINT16_C(24866), UINT16_C(62085), UINT16_C( 9500), UINT16_C(    0), UINT16_C(27748), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(53295), UINT16_C(44310),
+      UINT16_C(    0), UINT16_C(18276), UINT16_C(59946), UINT16_C(17977), UINT16_C(    0), UINT16_C(    0), UINT16_C(48087), UINT16_C( 2005),
+      UINT16_C( 2005), UINT16_C(55799), UINT16_C(10431), UINT16_C(17532), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(58060),
+      UINT16_C(12781), UINT16_C(    0), UINT16_C(    0), UINT16_C(10846), UINT16_C(54990), UINT16_C(    0), UINT16_C(    0), UINT16_C(52648),
+      UINT16_C(40709), UINT16_C(50342), UINT16_C( 8904), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(10673),
+      UINT16_C(56020), UINT16_C(    0), UINT16_C(40765), UINT16_C(    0), UINT16_C(46709), UINT16_C(    0), UINT16_C(23224), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(35740), UINT16_C(44409), UINT16_C(20642), UINT16_C(56955), UINT16_C(11507), UINT16_C(50952),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(53224), UINT16_C(23888), UINT16_C( 2005), UINT16_C(    0) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_n_u16_z(pv, av, b);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    ev = simde_svmax_n_u16_z(pv, av, b);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(26395), UINT16_C(19120), UINT16_C(55733), UINT16_C(56867), UINT16_C(16992), UINT16_C(30904), UINT16_C(36096), UINT16_C(42896),
+      UINT16_C(65226), UINT16_C(42040), UINT16_C( 4820), UINT16_C(14558), UINT16_C(29557), UINT16_C(61310), UINT16_C(32455), UINT16_C(57903),
+      UINT16_C(57317), UINT16_C(39468), UINT16_C(20665), UINT16_C( 6521), UINT16_C(12690), UINT16_C(37521), UINT16_C( 8638), UINT16_C(35129),
+      UINT16_C(29215), UINT16_C(62509), UINT16_C( 2948), UINT16_C(63788), UINT16_C(43647), UINT16_C(18153), UINT16_C( 6185), UINT16_C( 3624),
+      UINT16_C(21752), UINT16_C(45481), UINT16_C( 8868), UINT16_C(14026), UINT16_C(23379), UINT16_C( 4809), UINT16_C(  636), UINT16_C(39835),
+      UINT16_C(51316), UINT16_C(63887), UINT16_C(48084), UINT16_C(21490), UINT16_C(56166), UINT16_C(36761), UINT16_C(49652), UINT16_C(60573),
+      UINT16_C(17941), UINT16_C(47773), UINT16_C(26472), UINT16_C(48368), UINT16_C(47554), UINT16_C(16078), UINT16_C(27068), UINT16_C(12505),
+      UINT16_C(26929), UINT16_C( 1321), UINT16_C( 7204), UINT16_C(35416), UINT16_C(61943), UINT16_C(60185), UINT16_C(47026), UINT16_C(51415),
+      UINT16_C(29949), UINT16_C(26242), UINT16_C(29403), UINT16_C(40226), UINT16_C(61484), UINT16_C(59611), UINT16_C(46425), UINT16_C(35352),
+      UINT16_C(16926), UINT16_C(17040), UINT16_C(59486), UINT16_C(21965), UINT16_C(59098), UINT16_C(35905), UINT16_C( 6301), UINT16_C(39764),
+      UINT16_C(54925), UINT16_C(26625), UINT16_C( 9033), UINT16_C(29958), UINT16_C(57619), UINT16_C(27741), UINT16_C(30102), UINT16_C(46326),
+      UINT16_C(34487), UINT16_C( 5623), UINT16_C(50287), UINT16_C(18795), UINT16_C(44202), UINT16_C(18645), UINT16_C(10948), UINT16_C(20963),
+      UINT16_C(58368), UINT16_C(18874), UINT16_C(49159), UINT16_C( 6846), UINT16_C( 7073), UINT16_C(14470), UINT16_C(31889), UINT16_C(18668),
+      UINT16_C(58115), UINT16_C(29278), UINT16_C(51623), UINT16_C(21179), UINT16_C(36981), UINT16_C(14746), UINT16_C(32186), UINT16_C(48011),
+      UINT16_C(17761), UINT16_C(26628), UINT16_C(49925), UINT16_C(42626), UINT16_C( 2270), UINT16_C(28638), UINT16_C(52100), UINT16_C(34744),
+      UINT16_C( 5806), UINT16_C(22265), UINT16_C(46303), UINT16_C(21672), UINT16_C(16965), UINT16_C(65421), UINT16_C( 6335), UINT16_C( 8378),
+      UINT16_C(48989), UINT16_C(25224), UINT16_C( 2690), UINT16_C(24585), UINT16_C(59154), UINT16_C(38608), UINT16_C(34994), UINT16_C(24862),
+      UINT16_C( 6046), UINT16_C(32183), UINT16_C(24524), UINT16_C( 4561), UINT16_C(24225), UINT16_C(24592), UINT16_C(52087), UINT16_C(54400),
+      UINT16_C( 2186), UINT16_C( 3127), UINT16_C(16402), UINT16_C( 9324), UINT16_C(15399), UINT16_C(55994), UINT16_C(55492), UINT16_C(25147),
+      UINT16_C(62192), UINT16_C(48351), UINT16_C(45137), UINT16_C(62157), UINT16_C(56591), UINT16_C(34386), UINT16_C(53928), UINT16_C(12890),
+      UINT16_C(37338), UINT16_C(60478), UINT16_C(43985), UINT16_C(63760), UINT16_C(51943), UINT16_C(44243), UINT16_C( 3747), UINT16_C(37646),
+      UINT16_C(60928), UINT16_C(20815), UINT16_C( 7326), UINT16_C(44355), UINT16_C(38393), UINT16_C(41523), UINT16_C(36455), UINT16_C(16852),
+      UINT16_C( 4895), UINT16_C(61741), UINT16_C(15806), UINT16_C(42474), UINT16_C(48391), UINT16_C(43601), UINT16_C(24779), UINT16_C(52029),
+      UINT16_C(35918), UINT16_C(60444), UINT16_C(24488), UINT16_C(41626), UINT16_C(52724), UINT16_C(23364), UINT16_C( 6235), UINT16_C(31644),
+      UINT16_C(51499), UINT16_C(59756), UINT16_C(22022), UINT16_C( 3471), UINT16_C(57363), UINT16_C(57016), UINT16_C(62784), UINT16_C(36521),
+      UINT16_C(50562), UINT16_C(10875), UINT16_C( 5412), UINT16_C( 6348), UINT16_C( 4322), UINT16_C(15987), UINT16_C( 3881), UINT16_C(21689),
+      UINT16_C( 9688), UINT16_C(56894), UINT16_C(52603), UINT16_C(36587), UINT16_C(41901), UINT16_C(61036), UINT16_C( 5529), UINT16_C( 7036),
+      UINT16_C(63450), UINT16_C(65093), UINT16_C( 4620), UINT16_C(61206), UINT16_C(35106), UINT16_C(19245), UINT16_C(59032), UINT16_C(28832),
+      UINT16_C(56843), UINT16_C(34382), UINT16_C(14763), UINT16_C(22548), UINT16_C(32989), UINT16_C(30278), UINT16_C(50069), UINT16_C(28561),
+      UINT16_C(54970), UINT16_C(51053), UINT16_C(33768), UINT16_C( 2998), UINT16_C(58124), UINT16_C(42070), UINT16_C(63177), UINT16_C(54292),
+      UINT16_C(25300), UINT16_C(32602), UINT16_C(28315), UINT16_C(30936), UINT16_C( 7918), UINT16_C(33774), UINT16_C(32737), UINT16_C(40178),
+      UINT16_C(24406), UINT16_C(15971), UINT16_C( 6626), UINT16_C(61001), UINT16_C(41212), UINT16_C(50578), UINT16_C(42646), UINT16_C(27545),
+      UINT16_C(62216), UINT16_C(41962), UINT16_C(49761), UINT16_C(20252), UINT16_C( 2785), UINT16_C(49874), UINT16_C(50314), UINT16_C(57438),
+      UINT16_C(49443), UINT16_C( 1310), UINT16_C(26842), UINT16_C(55027), UINT16_C(34056), UINT16_C(40603), UINT16_C(13355), UINT16_C(13065),
+      UINT16_C(62503), UINT16_C(35030), UINT16_C(62134), UINT16_C(38871), UINT16_C(43517), UINT16_C(34650), UINT16_C(47213), UINT16_C(36967),
+      UINT16_C(34170), UINT16_C(21653), UINT16_C(35053), UINT16_C(62763), UINT16_C(50701), UINT16_C(14484), UINT16_C(40443), UINT16_C( 8811),
+      UINT16_C(17041), UINT16_C(18603), UINT16_C(33332), UINT16_C(12767), UINT16_C(14636), UINT16_C(39352), UINT16_C( 8178), UINT16_C(27690),
+      UINT16_C(49061), UINT16_C(37568), UINT16_C(60232), UINT16_C(21896), UINT16_C( 7346) };
+  static const uint16_t b = UINT16_C(39199);
+  static const uint16_t e[] =
+    { UINT16_C(39199), UINT16_C(19120), UINT16_C(55733), UINT16_C(56867), UINT16_C(39199), UINT16_C(30904), UINT16_C(39199), UINT16_C(42896),
+      UINT16_C(65226), UINT16_C(42040), UINT16_C( 4820), UINT16_C(39199), UINT16_C(39199), UINT16_C(61310), UINT16_C(32455), UINT16_C(57903),
+      UINT16_C(57317), UINT16_C(39468), UINT16_C(20665), UINT16_C(39199), UINT16_C(39199), UINT16_C(39199), UINT16_C( 8638), UINT16_C(35129),
+      UINT16_C(29215), UINT16_C(62509), UINT16_C(39199), UINT16_C(63788), UINT16_C(43647), UINT16_C(18153), UINT16_C( 6185), UINT16_C(39199),
+      UINT16_C(39199), UINT16_C(45481), UINT16_C(39199), UINT16_C(39199), UINT16_C(23379), UINT16_C( 4809), UINT16_C(  636), UINT16_C(39835),
+      UINT16_C(51316), UINT16_C(63887), UINT16_C(48084), UINT16_C(21490), UINT16_C(56166), UINT16_C(39199), UINT16_C(49652), UINT16_C(60573),
+      UINT16_C(39199), UINT16_C(47773), UINT16_C(26472), UINT16_C(48368), UINT16_C(47554), UINT16_C(16078), UINT16_C(27068), UINT16_C(12505),
+      UINT16_C(26929), UINT16_C( 1321), UINT16_C(39199), UINT16_C(35416), UINT16_C(61943), UINT16_C(60185), UINT16_C(47026), UINT16_C(51415),
+      UINT16_C(39199), UINT16_C(26242), UINT16_C(29403), UINT16_C(40226), UINT16_C(61484), UINT16_C(59611), UINT16_C(46425), UINT16_C(39199),
+      UINT16_C(39199), UINT16_C(17040), UINT16_C(59486), UINT16_C(21965), UINT16_C(59098), UINT16_C(35905), UINT16_C(39199), UINT16_C(39764),
+      UINT16_C(54925), UINT16_C(26625), UINT16_C( 9033), UINT16_C(39199), UINT16_C(57619), UINT16_C(39199), UINT16_C(39199), UINT16_C(46326),
+      UINT16_C(34487), UINT16_C( 5623), UINT16_C(50287), UINT16_C(18795), UINT16_C(44202), UINT16_C(39199), UINT16_C(10948), UINT16_C(39199),
+      UINT16_C(58368), UINT16_C(39199), UINT16_C(49159), UINT16_C(39199), UINT16_C( 7073), UINT16_C(14470), UINT16_C(39199), UINT16_C(39199),
+      UINT16_C(58115), UINT16_C(29278), UINT16_C(51623), UINT16_C(39199), UINT16_C(39199), UINT16_C(14746), UINT16_C(39199), UINT16_C(48011),
+      UINT16_C(39199), UINT16_C(39199), UINT16_C(49925), UINT16_C(42626), UINT16_C( 2270), UINT16_C(39199), UINT16_C(52100), UINT16_C(39199),
+      UINT16_C( 5806), UINT16_C(39199), UINT16_C(46303), UINT16_C(39199), UINT16_C(16965), UINT16_C(65421), UINT16_C(39199), UINT16_C(39199),
+      UINT16_C(48989), UINT16_C(25224), UINT16_C(39199), UINT16_C(24585), UINT16_C(59154), UINT16_C(39199), UINT16_C(34994), UINT16_C(39199),
+      UINT16_C(39199), UINT16_C(32183), UINT16_C(39199), UINT16_C( 4561), UINT16_C(39199), UINT16_C(24592), UINT16_C(52087), UINT16_C(54400),
+      UINT16_C(39199), UINT16_C(39199), UINT16_C(16402), UINT16_C( 9324), UINT16_C(39199), UINT16_C(55994), UINT16_C(55492), UINT16_C(39199),
+      UINT16_C(62192), UINT16_C(48351), UINT16_C(45137), UINT16_C(62157), UINT16_C(56591), UINT16_C(39199), UINT16_C(53928), UINT16_C(39199),
+      UINT16_C(39199), UINT16_C(60478), UINT16_C(43985), UINT16_C(63760), UINT16_C(51943), UINT16_C(44243), UINT16_C( 3747), UINT16_C(37646),
+      UINT16_C(60928), UINT16_C(39199), UINT16_C(39199), UINT16_C(44355), UINT16_C(38393), UINT16_C(41523), UINT16_C(36455), UINT16_C(39199),
+      UINT16_C(39199), UINT16_C(61741), UINT16_C(39199), UINT16_C(42474), UINT16_C(48391), UINT16_C(43601), UINT16_C(24779), UINT16_C(52029),
+      UINT16_C(39199), UINT16_C(60444), UINT16_C(39199), UINT16_C(41626), UINT16_C(52724), UINT16_C(23364), UINT16_C(39199), UINT16_C(39199),
+      UINT16_C(51499), UINT16_C(59756), UINT16_C(22022), UINT16_C(39199), UINT16_C(57363), UINT16_C(57016), UINT16_C(62784), UINT16_C(39199),
+      UINT16_C(50562), UINT16_C(10875), UINT16_C( 5412), UINT16_C( 6348), UINT16_C( 4322), UINT16_C(15987), UINT16_C( 3881), UINT16_C(39199),
+      UINT16_C( 9688), UINT16_C(56894), UINT16_C(52603), UINT16_C(36587), UINT16_C(41901), UINT16_C(61036), UINT16_C( 5529), UINT16_C(39199),
+      UINT16_C(63450), UINT16_C(65093), UINT16_C( 4620), UINT16_C(61206), UINT16_C(39199), UINT16_C(39199), UINT16_C(59032), UINT16_C(28832),
+      UINT16_C(56843), UINT16_C(34382), UINT16_C(14763), UINT16_C(39199), UINT16_C(32989), UINT16_C(30278), UINT16_C(50069), UINT16_C(39199),
+      UINT16_C(54970), UINT16_C(51053), UINT16_C(33768), UINT16_C( 2998), UINT16_C(58124), UINT16_C(42070), UINT16_C(63177), UINT16_C(54292),
+      UINT16_C(25300), UINT16_C(39199), UINT16_C(39199), UINT16_C(39199), UINT16_C(39199), UINT16_C(39199), UINT16_C(32737), UINT16_C(40178),
+      UINT16_C(24406), UINT16_C(15971), UINT16_C( 6626), UINT16_C(61001), UINT16_C(41212), UINT16_C(50578), UINT16_C(42646), UINT16_C(39199),
+      UINT16_C(62216), UINT16_C(41962), UINT16_C(49761), UINT16_C(39199), UINT16_C(39199), UINT16_C(49874), UINT16_C(50314), UINT16_C(57438),
+      UINT16_C(49443), UINT16_C(39199), UINT16_C(39199), UINT16_C(55027), UINT16_C(39199), UINT16_C(40603), UINT16_C(13355), UINT16_C(39199),
+      UINT16_C(62503), UINT16_C(39199), UINT16_C(62134), UINT16_C(38871), UINT16_C(43517), UINT16_C(39199), UINT16_C(47213), UINT16_C(39199),
+      UINT16_C(39199), UINT16_C(39199), UINT16_C(35053), UINT16_C(62763), UINT16_C(50701), UINT16_C(14484), UINT16_C(40443), UINT16_C( 8811),
+      UINT16_C(17041), UINT16_C(18603), UINT16_C(33332), UINT16_C(39199), UINT16_C(14636), UINT16_C(39352), UINT16_C( 8178), UINT16_C(27690),
+      UINT16_C(49061), UINT16_C(39199), UINT16_C(60232), UINT16_C(39199), UINT16_C(39199) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmax_n_u16_m(pv, av, b);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    ev = simde_svmax_n_u16_m(pv, av, b);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(3627995892), UINT32_C(1991307295), UINT32_C(1001575931), UINT32_C(3718026935), UINT32_C(2717902485), UINT32_C( 107947410), UINT32_C(2849077890), UINT32_C( 196946455),
+      UINT32_C( 484703228), UINT32_C(3885143276), UINT32_C( 539116649), UINT32_C(1895677658), UINT32_C( 923925669), UINT32_C(2738716705), UINT32_C( 306974458), UINT32_C( 891095352),
+      UINT32_C(4048617733), UINT32_C(4275626901), UINT32_C(  18873127), UINT32_C(1584471225), UINT32_C( 982876697), UINT32_C(4259238403), UINT32_C( 420424417), UINT32_C( 961424692),
+      UINT32_C(3274350382), UINT32_C(2847998594), UINT32_C(3081494781), UINT32_C( 370482429), UINT32_C(2723195807), UINT32_C(1587490429), UINT32_C(2373496665), UINT32_C( 180799196),
+      UINT32_C(3905810534), UINT32_C(4036136690), UINT32_C(1822899567), UINT32_C(4169317465), UINT32_C(3852128871), UINT32_C(1514355201), UINT32_C(3320298473), UINT32_C(3905924482),
+      UINT32_C(2412813469), UINT32_C(2575262250), UINT32_C(4177864351), UINT32_C(1257342947), UINT32_C(1529842778), UINT32_C(2947904454), UINT32_C(2960432174), UINT32_C(3868738377),
+      UINT32_C( 158689759), UINT32_C(1805907403), UINT32_C(4268009499), UINT32_C(2320061744), UINT32_C(2816833761), UINT32_C( 441883371), UINT32_C(2143996470), UINT32_C(3966067469),
+      UINT32_C(2549537484), UINT32_C(3942816207), UINT32_C(1911121473), UINT32_C(2650485436), UINT32_C(2521161899), UINT32_C(2964364154), UINT32_C(1932491622), UINT32_C(2858456286),
+      UINT32_C(1044469359), UINT32_C( 808010991), UINT32_C(1721897898), UINT32_C(4026834245), UINT32_C(4169615742), UINT32_C(1252603876), UINT32_C(2428426418), UINT32_C(3694796397),
+      UINT32_C(1662680180), UINT32_C(1788036288), UINT32_C(2630956375), UINT32_C(1368249811), UINT32_C(  38343710), UINT32_C(4266521163), UINT32_C( 948833227), UINT32_C(2635385129),
+      UINT32_C(  83897925), UINT32_C(3379532658), UINT32_C(2623946953), UINT32_C( 871232277), UINT32_C(1379284487), UINT32_C(4098917161), UINT32_C(3073171342), UINT32_C(3981721768),
+      UINT32_C(3790754926), UINT32_C(2963956199), UINT32_C(3075215522), UINT32_C( 183187715), UINT32_C(2573017456), UINT32_C( 848145828), UINT32_C( 887732620), UINT32_C(1730231801),
+      UINT32_C(2017989521), UINT32_C( 388625269), UINT32_C( 130970883), UINT32_C( 521255343), UINT32_C(2126016218), UINT32_C(2830124316), UINT32_C(4158495230), UINT32_C(1734278870),
+      UINT32_C(2279646994), UINT32_C(2644380058), UINT32_C( 765750398), UINT32_C(   5027366), UINT32_C(1082065956), UINT32_C(1206464329), UINT32_C(2671691465), UINT32_C(3590823364),
+      UINT32_C(3730696004), UINT32_C(1853619184), UINT32_C(2392596584), UINT32_C(4203669718), UINT32_C( 909839853), UINT32_C( 108930109), UINT32_C(2930097386), UINT32_C(2642783321),
+      UINT32_C(2205934227), UINT32_C(1190328286), UINT32_C(3990130199), UINT32_C(1676108406), UINT32_C(2912559728), UINT32_C( 817043526), UINT32_C( 786389204), UINT32_C(2563466245),
+      UINT32_C( 605833030), UINT32_C(1433013822), UINT32_C( 306331292), UINT32_C( 292956577), UINT32_C(2461929548), UINT32_C(4240666920), UINT32_C(3458900681), UINT32_C(1281881606),
+      UINT32_C(2071036733), UINT32_C( 768662417), UINT32_C(3141472794), UINT32_C(2278339899), UINT32_C(3977939653), UINT32_C(3303726587), UINT32_C(2241008767), UINT32_C(1204943370),
+      UINT32_C( 247612029), UINT32_C( 943428126), UINT32_C(3774053028), UINT32_C(4117217072), UINT32_C(1155760457), UINT32_C(3708341598) };
+  static const uint32_t b = UINT32_C( 687731112);
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(1991307295), UINT32_C(         0), UINT32_C(3718026935), UINT32_C(2717902485), UINT32_C( 687731112), UINT32_C(2849077890), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 923925669), UINT32_C(2738716705), UINT32_C(         0), UINT32_C( 891095352),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C( 687731112), UINT32_C(         0), UINT32_C(         0), UINT32_C(4259238403), UINT32_C( 687731112), UINT32_C( 961424692),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 687731112), UINT32_C(         0), UINT32_C(1587490429), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1822899567), UINT32_C(4169317465), UINT32_C(         0), UINT32_C(1514355201), UINT32_C(3320298473), UINT32_C(3905924482),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(4177864351), UINT32_C(1257342947), UINT32_C(1529842778), UINT32_C(         0), UINT32_C(2960432174), UINT32_C(3868738377),
+      UINT32_C( 687731112), UINT32_C(1805907403), UINT32_C(4268009499), UINT32_C(2320061744), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3966067469),
+      UINT32_C(2549537484), UINT32_C(         0), UINT32_C(1911121473), UINT32_C(2650485436), UINT32_C(2521161899), UINT32_C(2964364154), UINT32_C(         0), UINT32_C(2858456286),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1252603876), UINT32_C(2428426418), UINT32_C(3694796397),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1368249811), UINT32_C(         0), UINT32_C(4266521163), UINT32_C( 948833227), UINT32_C(2635385129),
+      UINT32_C( 687731112), UINT32_C(3379532658), UINT32_C(2623946953), UINT32_C( 871232277), UINT32_C(         0), UINT32_C(         0), UINT32_C(3073171342), UINT32_C(         0),
+      UINT32_C(3790754926), UINT32_C(         0), UINT32_C(3075215522), UINT32_C( 687731112), UINT32_C(2573017456), UINT32_C(         0), UINT32_C( 887732620), UINT32_C(1730231801),
+      UINT32_C(         0), UINT32_C( 687731112), UINT32_C(         0), UINT32_C( 687731112), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1734278870),
+      UINT32_C(2279646994), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1082065956), UINT32_C(         0), UINT32_C(         0), UINT32_C(3590823364),
+      UINT32_C(3730696004), UINT32_C(1853619184), UINT32_C(2392596584), UINT32_C(4203669718), UINT32_C( 909839853), UINT32_C( 687731112), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(1190328286), UINT32_C(3990130199), UINT32_C(1676108406), UINT32_C(2912559728), UINT32_C( 817043526), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 687731112), UINT32_C(1433013822), UINT32_C( 687731112), UINT32_C( 687731112), UINT32_C(2461929548), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3977939653), UINT32_C(3303726587), UINT32_C(2241008767), UINT32_C(1204943370),
+      UINT32_C(         0), UINT32_C( 943428126), UINT32_C(         0), UINT32_C(4117217072), UINT32_C(         0), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_n_u32_z(pv, av, b);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    ev = simde_svmax_n_u32_z(pv, av, b);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(3791139351), UINT32_C(1953837259), UINT32_C(2763223263), UINT32_C(3571938395), UINT32_C(3844090107), UINT32_C(2100873827), UINT32_C(3842632834), UINT32_C(3734188487),
+      UINT32_C( 801148004), UINT32_C(2611230140), UINT32_C(  20928422), UINT32_C(3335923403), UINT32_C(2980902478), UINT32_C(1127146688), UINT32_C(2535995344), UINT32_C(3447110761),
+      UINT32_C(  83637832), UINT32_C( 295673963), UINT32_C(3256082167), UINT32_C(1384769796), UINT32_C(2684564959), UINT32_C(3923980825), UINT32_C(3531606889), UINT32_C( 262141639),
+      UINT32_C(2551421996), UINT32_C( 883536444), UINT32_C(2499198096), UINT32_C(2246475685), UINT32_C(3441814196), UINT32_C(2243299356), UINT32_C(3679991571), UINT32_C(1525348141),
+      UINT32_C(3505585811), UINT32_C(1090821040), UINT32_C(4258658904), UINT32_C( 780319866), UINT32_C(3271337894), UINT32_C(3276255919), UINT32_C( 396271593), UINT32_C( 712083607),
+      UINT32_C( 939156358), UINT32_C(1450770174), UINT32_C(1934904825), UINT32_C(2946618889), UINT32_C( 762420606), UINT32_C( 972077392), UINT32_C(4015033944), UINT32_C(2635776279),
+      UINT32_C( 601101348), UINT32_C( 209275923), UINT32_C(2743061914), UINT32_C( 575873188), UINT32_C( 240108734), UINT32_C(3594993789), UINT32_C(3854932174), UINT32_C(2122571609),
+      UINT32_C( 128014324), UINT32_C(1041439396), UINT32_C(2363593448), UINT32_C(1890464946), UINT32_C(1988034041), UINT32_C( 206358077), UINT32_C(3086029406), UINT32_C(3845485809),
+      UINT32_C(1894569676), UINT32_C(3652124657), UINT32_C(1147506577), UINT32_C(3182695364), UINT32_C(1311978256), UINT32_C(1465549049), UINT32_C(2198752146), UINT32_C(2355709120),
+      UINT32_C( 201086234), UINT32_C(3873745493), UINT32_C(4247406905), UINT32_C(1840963420), UINT32_C( 196865554), UINT32_C(   6428014), UINT32_C( 545484896), UINT32_C(3484216500),
+      UINT32_C(2547689538), UINT32_C(2357051218), UINT32_C(1703520264), UINT32_C(2580694151), UINT32_C(2695138610), UINT32_C(  44041890), UINT32_C( 723723126), UINT32_C(1392168720),
+      UINT32_C(3404321912), UINT32_C(2622908051), UINT32_C(2499928078), UINT32_C(1445909284), UINT32_C(  49730144), UINT32_C(1325700824), UINT32_C(3380225977), UINT32_C(1864070391),
+      UINT32_C(3694724168), UINT32_C(2037944427), UINT32_C(2484042096), UINT32_C(2901032268), UINT32_C(3903774736), UINT32_C( 792179318), UINT32_C(3522802138), UINT32_C(1849693221),
+      UINT32_C(2219473177), UINT32_C(2046673417), UINT32_C(2265779259), UINT32_C(1513355082), UINT32_C(1296228823), UINT32_C(1836939923), UINT32_C(1363047979), UINT32_C(2747235978),
+      UINT32_C(  19335672), UINT32_C( 108733899), UINT32_C(2072873009), UINT32_C(1473626240), UINT32_C( 883234977), UINT32_C(3181519506), UINT32_C( 571400344), UINT32_C(1472646495),
+      UINT32_C(2706959830), UINT32_C(1151849234), UINT32_C(3703518300), UINT32_C(2503185908), UINT32_C(1070258349), UINT32_C(2466016506), UINT32_C(2880768844), UINT32_C(2936175576),
+      UINT32_C(2068863848), UINT32_C(2327836718), UINT32_C( 560365100), UINT32_C(3233192467), UINT32_C(1845461106), UINT32_C( 973077740), UINT32_C(3756307463), UINT32_C(2559502127),
+      UINT32_C(1880350530), UINT32_C(  66835159), UINT32_C(1680105808), UINT32_C(1847909371), UINT32_C(1222321243), UINT32_C( 662821408), UINT32_C(3188090255), UINT32_C(2388038988),
+      UINT32_C(1275029876), UINT32_C(2353986107), UINT32_C(1475375963), UINT32_C(2848265294), UINT32_C(1492230200), UINT32_C( 159347322), UINT32_C( 617121496), UINT32_C(2410880539) };
+  static const uint32_t b = UINT32_C(2162239084);
+  static const uint32_t e[] =
+    { UINT32_C(3791139351), UINT32_C(1953837259), UINT32_C(2763223263), UINT32_C(3571938395), UINT32_C(3844090107), UINT32_C(2162239084), UINT32_C(3842632834), UINT32_C(3734188487),
+      UINT32_C(2162239084), UINT32_C(2611230140), UINT32_C(  20928422), UINT32_C(3335923403), UINT32_C(2980902478), UINT32_C(2162239084), UINT32_C(2535995344), UINT32_C(3447110761),
+      UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(3256082167), UINT32_C(1384769796), UINT32_C(2684564959), UINT32_C(3923980825), UINT32_C(3531606889), UINT32_C(2162239084),
+      UINT32_C(2551421996), UINT32_C( 883536444), UINT32_C(2499198096), UINT32_C(2246475685), UINT32_C(3441814196), UINT32_C(2243299356), UINT32_C(3679991571), UINT32_C(1525348141),
+      UINT32_C(3505585811), UINT32_C(1090821040), UINT32_C(4258658904), UINT32_C(2162239084), UINT32_C(3271337894), UINT32_C(3276255919), UINT32_C(2162239084), UINT32_C( 712083607),
+      UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(2946618889), UINT32_C( 762420606), UINT32_C(2162239084), UINT32_C(4015033944), UINT32_C(2635776279),
+      UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(2743061914), UINT32_C(2162239084), UINT32_C( 240108734), UINT32_C(3594993789), UINT32_C(3854932174), UINT32_C(2162239084),
+      UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(2363593448), UINT32_C(1890464946), UINT32_C(1988034041), UINT32_C(2162239084), UINT32_C(3086029406), UINT32_C(3845485809),
+      UINT32_C(1894569676), UINT32_C(3652124657), UINT32_C(2162239084), UINT32_C(3182695364), UINT32_C(2162239084), UINT32_C(1465549049), UINT32_C(2198752146), UINT32_C(2355709120),
+      UINT32_C( 201086234), UINT32_C(3873745493), UINT32_C(4247406905), UINT32_C(1840963420), UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C( 545484896), UINT32_C(3484216500),
+      UINT32_C(2547689538), UINT32_C(2357051218), UINT32_C(1703520264), UINT32_C(2580694151), UINT32_C(2695138610), UINT32_C(  44041890), UINT32_C(2162239084), UINT32_C(1392168720),
+      UINT32_C(3404321912), UINT32_C(2622908051), UINT32_C(2499928078), UINT32_C(1445909284), UINT32_C(  49730144), UINT32_C(2162239084), UINT32_C(3380225977), UINT32_C(2162239084),
+      UINT32_C(3694724168), UINT32_C(2162239084), UINT32_C(2484042096), UINT32_C(2901032268), UINT32_C(3903774736), UINT32_C( 792179318), UINT32_C(3522802138), UINT32_C(1849693221),
+      UINT32_C(2219473177), UINT32_C(2162239084), UINT32_C(2265779259), UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(1836939923), UINT32_C(1363047979), UINT32_C(2747235978),
+      UINT32_C(  19335672), UINT32_C( 108733899), UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(2162239084), UINT32_C(3181519506), UINT32_C(2162239084), UINT32_C(2162239084),
+      UINT32_C(2706959830), UINT32_C(2162239084), UINT32_C(3703518300), UINT32_C(2503185908), UINT32_C(1070258349), UINT32_C(2466016506), UINT32_C(2880768844), UINT32_C(2936175576),
+      UINT32_C(2162239084), UINT32_C(2327836718), UINT32_C( 560365100), UINT32_C(3233192467), UINT32_C(1845461106), UINT32_C(2162239084), UINT32_C(3756307463), UINT32_C(2559502127),
+      UINT32_C(1880350530), UINT32_C(2162239084), UINT32_C(1680105808), UINT32_C(2162239084), UINT32_C(1222321243), UINT32_C(2162239084), UINT32_C(3188090255), UINT32_C(2388038988),
+      UINT32_C(1275029876), UINT32_C(2353986107), UINT32_C(2162239084), UINT32_C(2848265294), UINT32_C(2162239084), UINT32_C( 159347322), UINT32_C(2162239084), UINT32_C(2410880539) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_n_u32_m(pv, av, b);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    ev = simde_svmax_n_u32_m(pv, av, b);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C(17323834248082064922), UINT64_C( 2475732095018408426), UINT64_C( 8610322184688063336), UINT64_C(   26690534381410483),
+      UINT64_C(10862387270494260312), UINT64_C( 6010374671114459405), UINT64_C( 2185974710572312695), UINT64_C( 3198622070089580924),
+      UINT64_C(17011989012031401173), UINT64_C( 8741658413378035218), UINT64_C(10920576104298771972), UINT64_C(10785942714004993968),
+      UINT64_C( 8436698281334450761), UINT64_C(16755294847924127755), UINT64_C( 4354106233286287034), UINT64_C(  878887763229828828),
+      UINT64_C( 9219513251341355033), UINT64_C(16311494865379419538), UINT64_C( 8554909213119723248), UINT64_C(  169524804319410570),
+      UINT64_C( 7746598010900942733), UINT64_C( 1216323884826037718), UINT64_C( 5118138376734480630), UINT64_C(17054269083091278528),
+      UINT64_C( 8269856433544964991), UINT64_C(15829116836914439548), UINT64_C( 4750580182625827562), UINT64_C(17426845277967057549),
+      UINT64_C(12740697864402486722), UINT64_C( 8968066066505547955), UINT64_C(16209880385463705650), UINT64_C( 4176425060544602258),
+      UINT64_C(18396473631637454697), UINT64_C(14174249224389564839), UINT64_C( 8799873041169963244), UINT64_C(17941624651339787085),
+      UINT64_C(11745357020391707827), UINT64_C(10363787297041454973), UINT64_C(  417970241340853097), UINT64_C( 8313863437508234200),
+      UINT64_C( 6266885159253177946), UINT64_C(14933155048294044682), UINT64_C(15078875057606364036), UINT64_C( 3272597210607979575),
+      UINT64_C( 6467022071401733519), UINT64_C(16321964643763823694), UINT64_C(14346886835255354191), UINT64_C( 8893809834290205549),
+      UINT64_C(13307752526517628677), UINT64_C( 5262157067966002631), UINT64_C(17648106686710359443), UINT64_C(15520989613751839230),
+      UINT64_C(12876876466648533393), UINT64_C(11732683038060388496), UINT64_C( 1044465744395723779), UINT64_C(16501574225253413721),
+      UINT64_C(10972338831702896039), UINT64_C(18187493498740087988), UINT64_C( 3779933902140222296), UINT64_C( 8354846688222867128),
+      UINT64_C( 1886527098378900110), UINT64_C(11194897829914890086), UINT64_C(11565095307197014895), UINT64_C(14782395348331323110),
+      UINT64_C(15920947568018926449), UINT64_C( 9493473751795028192), UINT64_C( 2378831045166285435), UINT64_C(13779037175151898668),
+      UINT64_C(  970113594410113828), UINT64_C(14335221816370508377), UINT64_C( 4111554522666090419), UINT64_C(  138448155554735069),
+      UINT64_C( 7255880691368034937), UINT64_C( 9787661006708794307), UINT64_C(  560561996927729024), UINT64_C(13998909791770209384),
+      UINT64_C(13190791467446624928), UINT64_C( 2475178390521766142), UINT64_C(13459137584205647510), UINT64_C(13397723015416904674),
+      UINT64_C( 8057629612947297832), UINT64_C(14346104673075828563), UINT64_C( 2266806213503665768), UINT64_C(16293806549087515724),
+      UINT64_C( 5364016915507217296), UINT64_C(12925144338253459816), UINT64_C( 9545910716363368221), UINT64_C(10372925733368087895),
+      UINT64_C( 3156180853094216332), UINT64_C( 9273513495092202931), UINT64_C( 6541007881785450506), UINT64_C( 4947030159001432089),
+      UINT64_C(17096109737197910099), UINT64_C( 3640770143999165858), UINT64_C(14779472249655484605), UINT64_C( 4388913867210983403),
+      UINT64_C(16711895345622331589), UINT64_C( 3743461565365278873), UINT64_C(10328177420262402259), UINT64_C(10212506748157377174),
+      UINT64_C( 4249279981115149772), UINT64_C( 3096768279561888849), UINT64_C(10487202361614921047), UINT64_C(12003723419612921409),
+      UINT64_C(17055887821085549271), UINT64_C(17515814640703155603), UINT64_C(  947577591675405977), UINT64_C(15615856774712014390),
+      UINT64_C(12705783869263080909), UINT64_C( 5494303255034464176), UINT64_C(15874914522643836277), UINT64_C(16002876141084697916),
+      UINT64_C( 1863816692539745553), UINT64_C(11286483729522194594), UINT64_C(14147262769109238226), UINT64_C(17762222105870549649),
+      UINT64_C(  287387471172650620), UINT64_C(15725717814316131193), UINT64_C(15620638851214809723), UINT64_C( 6613248942005733866),
+      UINT64_C( 7288299652070304448), UINT64_C(17474884060815130272), UINT64_C( 7528538078700754524), UINT64_C(12664682827484755078),
+      UINT64_C(16084876818855821799), UINT64_C(15843112083681394036), UINT64_C( 1713330011500369120) };
+  static const uint64_t b = UINT64_C(14293561355430943550);
+  static const uint64_t e[] =
+    { UINT64_C(17323834248082064922), UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550),
+      UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(17011989012031401173), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(                   0),
+      UINT64_C(14293561355430943550), UINT64_C(16755294847924127755), UINT64_C(                   0), UINT64_C(14293561355430943550),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(14293561355430943550), UINT64_C(15829116836914439548), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(16209880385463705650), UINT64_C(14293561355430943550),
+      UINT64_C(18396473631637454697), UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(17941624651339787085),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(15078875057606364036), UINT64_C(14293561355430943550),
+      UINT64_C(                   0), UINT64_C(16321964643763823694), UINT64_C(14346886835255354191), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(17648106686710359443), UINT64_C(                   0),
+      UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(18187493498740087988), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(14782395348331323110),
+      UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(14293561355430943550),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550),
+      UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(14346104673075828563), UINT64_C(14293561355430943550), UINT64_C(16293806549087515724),
+      UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(14293561355430943550),
+      UINT64_C(16711895345622331589), UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(14293561355430943550),
+      UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(17055887821085549271), UINT64_C(17515814640703155603), UINT64_C(                   0), UINT64_C(15615856774712014390),
+      UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(                   0), UINT64_C(16002876141084697916),
+      UINT64_C(                   0), UINT64_C(14293561355430943550), UINT64_C(14293561355430943550), UINT64_C(17762222105870549649),
+      UINT64_C(                   0), UINT64_C(15725717814316131193), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(14293561355430943550),
+      UINT64_C(16084876818855821799), UINT64_C(                   0), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_n_u64_z(pv, av, b);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    ev = simde_svmax_n_u64_z(pv, av, b);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C( 1581654079772824760), UINT64_C( 2121835939145567977), UINT64_C(11722963920434792128), UINT64_C(13782097909524285337),
+      UINT64_C(13836221162208472301), UINT64_C( 8617816795902931439), UINT64_C(14077768833596642600), UINT64_C(18398668003331750031),
+      UINT64_C(10625665685091419103), UINT64_C( 8111729802669368675), UINT64_C(   29707093278468476), UINT64_C( 7697756273417541826),
+      UINT64_C( 1632156511320981871), UINT64_C(15632770959133422907), UINT64_C( 7736875924473126636), UINT64_C( 5707488859453912127),
+      UINT64_C( 2782109576984679891), UINT64_C( 8931372049959013822), UINT64_C(10866683799351685305), UINT64_C(17535775737999592747),
+      UINT64_C( 9654898223721660140), UINT64_C(18081549264237864675), UINT64_C( 3093458365454337793), UINT64_C(15225704863036231736),
+      UINT64_C(13878872339898943055), UINT64_C(14738629888687946318), UINT64_C( 5337068005319043049), UINT64_C( 2890730252380882787),
+      UINT64_C(13786040115660834997), UINT64_C(10353170429145744405), UINT64_C( 5124120992405705152), UINT64_C( 7192723244574687183),
+      UINT64_C(18422052250503680119), UINT64_C(10376449467864905675), UINT64_C(14882847549116544606), UINT64_C( 4778398145811192894),
+      UINT64_C( 6215481555812042071), UINT64_C(  948790224249889226), UINT64_C( 5191201257994357822), UINT64_C( 2307116006401999350),
+      UINT64_C(14748342110149291978), UINT64_C( 8755156260621808581), UINT64_C(11632728203842670620), UINT64_C(17521649251210470465),
+      UINT64_C(17610468928181013398), UINT64_C( 8510932871809583720), UINT64_C(15133514841917804984), UINT64_C( 7334962808357677231),
+      UINT64_C( 8121222718281290897), UINT64_C(13617529590448855851), UINT64_C( 5937191968707680001), UINT64_C(15546696695720657292),
+      UINT64_C( 5297160179267648778), UINT64_C(14350379116695295847), UINT64_C(17822643037425780321), UINT64_C( 9375952881528766720),
+      UINT64_C( 7509779874745529808), UINT64_C( 3548548230156519344), UINT64_C( 6314200985702340671), UINT64_C(15422782560616182541),
+      UINT64_C( 7411516196354628977), UINT64_C(16431132164556172293), UINT64_C(15447679633562942643), UINT64_C( 3170080838890815009),
+      UINT64_C(14275979542704014081), UINT64_C(14532450890861574947), UINT64_C(10051529051041119199), UINT64_C( 4474239634338208050),
+      UINT64_C( 5763502699453985908), UINT64_C( 2012481466303813646), UINT64_C( 2879561529785827329), UINT64_C(14957909404388927770),
+      UINT64_C(12491298294766865375), UINT64_C( 4102989507065901722), UINT64_C( 1124662906678653823), UINT64_C(13361613681073761859),
+      UINT64_C(  995891947506004615), UINT64_C(16285248678080521360), UINT64_C( 9334538424043348871), UINT64_C( 8372909608802447776),
+      UINT64_C(11853311579323496190), UINT64_C(13570872028976407056), UINT64_C( 4453711062377212943), UINT64_C( 8580739898644360627),
+      UINT64_C( 3069597986505404128), UINT64_C( 9276274428933375433), UINT64_C( 7600277053170906014), UINT64_C(18048208603722690696),
+      UINT64_C(10525061626102440396), UINT64_C( 4503120931749735820), UINT64_C( 8025402338107345728), UINT64_C( 6068857269254187300),
+      UINT64_C( 4297924630414042954), UINT64_C(14039891035383412473), UINT64_C( 7662901458818847234), UINT64_C(18257278098484087169),
+      UINT64_C(15993045220674541832), UINT64_C(16370671375619599083), UINT64_C( 9390044813653240224), UINT64_C(16401805121959033326),
+      UINT64_C( 5784183659290079107), UINT64_C(12212616539529984951), UINT64_C( 6438986846055647191), UINT64_C( 6095791221609523161),
+      UINT64_C( 8573728613843284552), UINT64_C( 9254767121518213820), UINT64_C(13300735941080121040) };
+  static const uint64_t b = UINT64_C( 1202674799264240468);
+  static const uint64_t e[] =
+    { UINT64_C( 1581654079772824760), UINT64_C( 2121835939145567977), UINT64_C(11722963920434792128), UINT64_C(13782097909524285337),
+      UINT64_C(13836221162208472301), UINT64_C( 8617816795902931439), UINT64_C(14077768833596642600), UINT64_C(18398668003331750031),
+      UINT64_C(10625665685091419103), UINT64_C( 8111729802669368675), UINT64_C( 1202674799264240468), UINT64_C( 7697756273417541826),
+      UINT64_C( 1632156511320981871), UINT64_C(15632770959133422907), UINT64_C( 7736875924473126636), UINT64_C( 5707488859453912127),
+      UINT64_C( 2782109576984679891), UINT64_C( 8931372049959013822), UINT64_C(10866683799351685305), UINT64_C(17535775737999592747),
+      UINT64_C( 9654898223721660140), UINT64_C(18081549264237864675), UINT64_C( 3093458365454337793), UINT64_C(15225704863036231736),
+      UINT64_C(13878872339898943055), UINT64_C(14738629888687946318), UINT64_C( 5337068005319043049), UINT64_C( 2890730252380882787),
+      UINT64_C(13786040115660834997), UINT64_C(10353170429145744405), UINT64_C( 5124120992405705152), UINT64_C( 7192723244574687183),
+      UINT64_C(18422052250503680119), UINT64_C(10376449467864905675), UINT64_C(14882847549116544606), UINT64_C( 4778398145811192894),
+      UINT64_C( 6215481555812042071), UINT64_C(  948790224249889226), UINT64_C( 5191201257994357822), UINT64_C( 2307116006401999350),
+      UINT64_C(14748342110149291978), UINT64_C( 8755156260621808581), UINT64_C(11632728203842670620), UINT64_C(17521649251210470465),
+      UINT64_C(17610468928181013398), UINT64_C( 8510932871809583720), UINT64_C(15133514841917804984), UINT64_C( 7334962808357677231),
+      UINT64_C( 8121222718281290897), UINT64_C(13617529590448855851), UINT64_C( 5937191968707680001), UINT64_C(15546696695720657292),
+      UINT64_C( 5297160179267648778), UINT64_C(14350379116695295847), UINT64_C(17822643037425780321), UINT64_C( 9375952881528766720),
+      UINT64_C( 7509779874745529808), UINT64_C( 3548548230156519344), UINT64_C( 6314200985702340671), UINT64_C(15422782560616182541),
+      UINT64_C( 7411516196354628977), UINT64_C(16431132164556172293), UINT64_C(15447679633562942643), UINT64_C( 3170080838890815009),
+      UINT64_C(14275979542704014081), UINT64_C(14532450890861574947), UINT64_C(10051529051041119199), UINT64_C( 4474239634338208050),
+      UINT64_C( 5763502699453985908), UINT64_C( 2012481466303813646), UINT64_C( 2879561529785827329), UINT64_C(14957909404388927770),
+      UINT64_C(12491298294766865375), UINT64_C( 4102989507065901722), UINT64_C( 1202674799264240468), UINT64_C(13361613681073761859),
+      UINT64_C(  995891947506004615), UINT64_C(16285248678080521360), UINT64_C( 9334538424043348871), UINT64_C( 8372909608802447776),
+      UINT64_C(11853311579323496190), UINT64_C(13570872028976407056), UINT64_C( 4453711062377212943), UINT64_C( 8580739898644360627),
+      UINT64_C( 3069597986505404128), UINT64_C( 9276274428933375433), UINT64_C( 7600277053170906014), UINT64_C(18048208603722690696),
+      UINT64_C(10525061626102440396), UINT64_C( 4503120931749735820), UINT64_C( 8025402338107345728), UINT64_C( 6068857269254187300),
+      UINT64_C( 4297924630414042954), UINT64_C(14039891035383412473), UINT64_C( 7662901458818847234), UINT64_C(18257278098484087169),
+      UINT64_C(15993045220674541832), UINT64_C(16370671375619599083), UINT64_C( 9390044813653240224), UINT64_C(16401805121959033326),
+      UINT64_C( 5784183659290079107), UINT64_C(12212616539529984951), UINT64_C( 6438986846055647191), UINT64_C( 6095791221609523161),
+      UINT64_C( 8573728613843284552), UINT64_C( 9254767121518213820), UINT64_C(13300735941080121040) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_n_u64_m(pv, av, b);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    ev = simde_svmax_n_u64_m(pv, av, b);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -534.04), SIMDE_FLOAT32_C(   236.97), SIMDE_FLOAT32_C(  -675.46), SIMDE_FLOAT32_C(   387.80),
+      SIMDE_FLOAT32_C(   689.23), SIMDE_FLOAT32_C(  -915.07), SIMDE_FLOAT32_C(   -63.43), SIMDE_FLOAT32_C(   200.87),
+      SIMDE_FLOAT32_C(   521.78), SIMDE_FLOAT32_C(   -11.94), SIMDE_FLOAT32_C(   961.11), SIMDE_FLOAT32_C(  -862.51),
+      SIMDE_FLOAT32_C(  -970.92), SIMDE_FLOAT32_C(   637.11), SIMDE_FLOAT32_C(   149.84), SIMDE_FLOAT32_C(   -17.90),
+      SIMDE_FLOAT32_C(   921.06), SIMDE_FLOAT32_C(  -780.50), SIMDE_FLOAT32_C(   309.03), SIMDE_FLOAT32_C(   920.94),
+      SIMDE_FLOAT32_C(  -413.63), SIMDE_FLOAT32_C(   359.89), SIMDE_FLOAT32_C(   -66.25), SIMDE_FLOAT32_C(   736.58),
+      SIMDE_FLOAT32_C(   294.51), SIMDE_FLOAT32_C(   571.01), SIMDE_FLOAT32_C(   358.57), SIMDE_FLOAT32_C(  -765.73),
+      SIMDE_FLOAT32_C(  -120.61), SIMDE_FLOAT32_C(  -908.06), SIMDE_FLOAT32_C(   271.73), SIMDE_FLOAT32_C(   345.36),
+      SIMDE_FLOAT32_C(   328.91), SIMDE_FLOAT32_C(   596.28), SIMDE_FLOAT32_C(  -266.84), SIMDE_FLOAT32_C(    18.14),
+      SIMDE_FLOAT32_C(   681.21), SIMDE_FLOAT32_C(   669.73), SIMDE_FLOAT32_C(  -780.99), SIMDE_FLOAT32_C(   202.99),
+      SIMDE_FLOAT32_C(  -342.21), SIMDE_FLOAT32_C(  -819.88), SIMDE_FLOAT32_C(   340.48), SIMDE_FLOAT32_C(  -313.13),
+      SIMDE_FLOAT32_C(   817.23), SIMDE_FLOAT32_C(  -509.69), SIMDE_FLOAT32_C(   668.96), SIMDE_FLOAT32_C(   738.28),
+      SIMDE_FLOAT32_C(  -290.19), SIMDE_FLOAT32_C(   -22.01), SIMDE_FLOAT32_C(   659.23), SIMDE_FLOAT32_C(   296.18),
+      SIMDE_FLOAT32_C(  -662.11), SIMDE_FLOAT32_C(  -407.02), SIMDE_FLOAT32_C(    32.76), SIMDE_FLOAT32_C(   632.40),
+      SIMDE_FLOAT32_C(  -836.01), SIMDE_FLOAT32_C(  -608.67), SIMDE_FLOAT32_C(   866.67), SIMDE_FLOAT32_C(    43.39),
+      SIMDE_FLOAT32_C(  -516.73), SIMDE_FLOAT32_C(   138.40), SIMDE_FLOAT32_C(  -611.26), SIMDE_FLOAT32_C(   812.18),
+      SIMDE_FLOAT32_C(  -265.32), SIMDE_FLOAT32_C(   121.90), SIMDE_FLOAT32_C(  -169.68), SIMDE_FLOAT32_C(  -584.11),
+      SIMDE_FLOAT32_C(  -208.37), SIMDE_FLOAT32_C(    49.33), SIMDE_FLOAT32_C(   618.88), SIMDE_FLOAT32_C(   449.42),
+      SIMDE_FLOAT32_C(   229.45), SIMDE_FLOAT32_C(   -40.65), SIMDE_FLOAT32_C(  -863.72), SIMDE_FLOAT32_C(    46.68),
+      SIMDE_FLOAT32_C(   449.66), SIMDE_FLOAT32_C(   805.25), SIMDE_FLOAT32_C(  -215.04), SIMDE_FLOAT32_C(  -840.52),
+      SIMDE_FLOAT32_C(  -216.76), SIMDE_FLOAT32_C(  -555.81), SIMDE_FLOAT32_C(   455.66), SIMDE_FLOAT32_C(   121.13),
+      SIMDE_FLOAT32_C(    37.16), SIMDE_FLOAT32_C(  -511.58), SIMDE_FLOAT32_C(  -246.47), SIMDE_FLOAT32_C(   201.15),
+      SIMDE_FLOAT32_C(  -120.25), SIMDE_FLOAT32_C(  -379.80), SIMDE_FLOAT32_C(  -755.46), SIMDE_FLOAT32_C(   363.02),
+      SIMDE_FLOAT32_C(   758.61), SIMDE_FLOAT32_C(  -366.72), SIMDE_FLOAT32_C(   175.21), SIMDE_FLOAT32_C(  -506.72),
+      SIMDE_FLOAT32_C(   755.18), SIMDE_FLOAT32_C(  -994.47), SIMDE_FLOAT32_C(   -90.83), SIMDE_FLOAT32_C(  -453.19),
+      SIMDE_FLOAT32_C(    54.87), SIMDE_FLOAT32_C(  -471.95), SIMDE_FLOAT32_C(   996.22), SIMDE_FLOAT32_C(  -715.68),
+      SIMDE_FLOAT32_C(   487.40), SIMDE_FLOAT32_C(  -867.50), SIMDE_FLOAT32_C(   330.99), SIMDE_FLOAT32_C(   -62.94),
+      SIMDE_FLOAT32_C(   937.75), SIMDE_FLOAT32_C(  -884.05), SIMDE_FLOAT32_C(    96.54), SIMDE_FLOAT32_C(  -279.01),
+      SIMDE_FLOAT32_C(  -439.86), SIMDE_FLOAT32_C(  -447.80), SIMDE_FLOAT32_C(   842.12), SIMDE_FLOAT32_C(   597.30),
+      SIMDE_FLOAT32_C(    40.62), SIMDE_FLOAT32_C(  -404.35), SIMDE_FLOAT32_C(  -201.55), SIMDE_FLOAT32_C(   920.38),
+      SIMDE_FLOAT32_C(   215.86), SIMDE_FLOAT32_C(    42.99), SIMDE_FLOAT32_C(   283.40), SIMDE_FLOAT32_C(   -25.54),
+      SIMDE_FLOAT32_C(   676.27), SIMDE_FLOAT32_C(  -541.39), SIMDE_FLOAT32_C(   467.75), SIMDE_FLOAT32_C(   431.45),
+      SIMDE_FLOAT32_C(  -535.86), SIMDE_FLOAT32_C(  -623.08), SIMDE_FLOAT32_C(   978.26), SIMDE_FLOAT32_C(   519.00),
+      SIMDE_FLOAT32_C(   -95.04), SIMDE_FLOAT32_C(   974.48), SIMDE_FLOAT32_C(   803.32), SIMDE_FLOAT32_C(  -607.64),
+      SIMDE_FLOAT32_C(  -893.01), SIMDE_FLOAT32_C(   134.31), SIMDE_FLOAT32_C(   329.42), SIMDE_FLOAT32_C(  -955.26),
+      SIMDE_FLOAT32_C(   250.26), SIMDE_FLOAT32_C(  -574.04), SIMDE_FLOAT32_C(  -234.27), SIMDE_FLOAT32_C(   810.40),
+      SIMDE_FLOAT32_C(   -21.84), SIMDE_FLOAT32_C(  -392.16), SIMDE_FLOAT32_C(   407.70), SIMDE_FLOAT32_C(  -981.22),
+      SIMDE_FLOAT32_C(   203.49), SIMDE_FLOAT32_C(  -793.85), SIMDE_FLOAT32_C(   939.16), SIMDE_FLOAT32_C(  -580.65),
+      SIMDE_FLOAT32_C(   249.14), SIMDE_FLOAT32_C(   222.56), SIMDE_FLOAT32_C(   393.81), SIMDE_FLOAT32_C(   -74.58),
+      SIMDE_FLOAT32_C(   681.17), SIMDE_FLOAT32_C(  -138.44), SIMDE_FLOAT32_C(  -643.13), SIMDE_FLOAT32_C(  -854.69),
+      SIMDE_FLOAT32_C(   238.48), SIMDE_FLOAT32_C(  -664.87), SIMDE_FLOAT32_C(   664.31), SIMDE_FLOAT32_C(  -856.56),
+      SIMDE_FLOAT32_C(  -690.39), SIMDE_FLOAT32_C(   467.63), SIMDE_FLOAT32_C(  -464.20), SIMDE_FLOAT32_C(  -583.40),
+      SIMDE_FLOAT32_C(  -398.06), SIMDE_FLOAT32_C(   865.23), SIMDE_FLOAT32_C(  -538.67), SIMDE_FLOAT32_C(   852.21),
+      SIMDE_FLOAT32_C(  -708.81), SIMDE_FLOAT32_C(   227.06), SIMDE_FLOAT32_C(   662.60), SIMDE_FLOAT32_C(   269.35),
+      SIMDE_FLOAT32_C(   834.90), SIMDE_FLOAT32_C(    70.30), SIMDE_FLOAT32_C(   288.13), SIMDE_FLOAT32_C(    38.40),
+      SIMDE_FLOAT32_C(   276.45), SIMDE_FLOAT32_C(   227.29), SIMDE_FLOAT32_C(   457.75), SIMDE_FLOAT32_C(  -474.41),
+      SIMDE_FLOAT32_C(  -550.15), SIMDE_FLOAT32_C(  -148.44), SIMDE_FLOAT32_C(   451.01), SIMDE_FLOAT32_C(  -868.98),
+      SIMDE_FLOAT32_C(   713.12), SIMDE_FLOAT32_C(   807.88), SIMDE_FLOAT32_C(  -723.68), SIMDE_FLOAT32_C(   -48.40),
+      SIMDE_FLOAT32_C(  -856.99), SIMDE_FLOAT32_C(   940.63), SIMDE_FLOAT32_C(    95.04), SIMDE_FLOAT32_C(  -547.38),
+      SIMDE_FLOAT32_C(   408.26), SIMDE_FLOAT32_C(   630.84), SIMDE_FLOAT32_C(  -130.78), SIMDE_FLOAT32_C(  -989.79),
+      SIMDE_FLOAT32_C(   496.07), SIMDE_FLOAT32_C(   330.55), SIMDE_FLOAT32_C(   862.41), SIMDE_FLOAT32_C(   787.26),
+      SIMDE_FLOAT32_C(  -442.39), SIMDE_FLOAT32_C(   525.01), SIMDE_FLOAT32_C(    56.61), SIMDE_FLOAT32_C(  -607.49),
+      SIMDE_FLOAT32_C(  -404.69), SIMDE_FLOAT32_C(  -655.26), SIMDE_FLOAT32_C(   430.91), SIMDE_FLOAT32_C(   871.76),
+      SIMDE_FLOAT32_C(   572.04), SIMDE_FLOAT32_C(  -111.34), SIMDE_FLOAT32_C(  -602.65), SIMDE_FLOAT32_C(  -978.11),
+      SIMDE_FLOAT32_C(   740.22), SIMDE_FLOAT32_C(   848.36), SIMDE_FLOAT32_C(  -847.10), SIMDE_FLOAT32_C(   453.34),
+      SIMDE_FLOAT32_C(   656.24), SIMDE_FLOAT32_C(  -570.77), SIMDE_FLOAT32_C(  -595.06), SIMDE_FLOAT32_C(   799.25),
+      SIMDE_FLOAT32_C(  -630.14), SIMDE_FLOAT32_C(   499.97), SIMDE_FLOAT32_C(  -748.13), SIMDE_FLOAT32_C(   778.12),
+      SIMDE_FLOAT32_C(   130.82), SIMDE_FLOAT32_C(   121.08), SIMDE_FLOAT32_C(   788.33) };
+  static const simde_float32 b = SIMDE_FLOAT32_C(  -373.12);
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   236.97), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   200.87),
+      SIMDE_FLOAT32_C(   521.78), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   961.11), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   921.06), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   309.03), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   736.58),
+      SIMDE_FLOAT32_C(   294.51), SIMDE_FLOAT32_C(   571.01), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(  -120.61), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   271.73), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   328.91), SIMDE_FLOAT32_C(   596.28), SIMDE_FLOAT32_C(  -266.84), SIMDE_FLOAT32_C(    18.14),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   669.73), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -290.19), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   659.23), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   866.67), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   138.40), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -169.68), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -208.37), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   229.45), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -215.04), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   455.66), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    37.16), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(  -246.47), SIMDE_FLOAT32_C(   201.15),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   363.02),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -366.72), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(   755.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -90.83), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    54.87), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   330.99), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(    96.54), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   597.30),
+      SIMDE_FLOAT32_C(    40.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   920.38),
+      SIMDE_FLOAT32_C(   215.86), SIMDE_FLOAT32_C(    42.99), SIMDE_FLOAT32_C(   283.40), SIMDE_FLOAT32_C(   -25.54),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   467.75), SIMDE_FLOAT32_C(   431.45),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   519.00),
+      SIMDE_FLOAT32_C(   -95.04), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   329.42), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   407.70), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   249.14), SIMDE_FLOAT32_C(   222.56), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -74.58),
+      SIMDE_FLOAT32_C(   681.17), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(   238.48), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   664.31), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   865.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   227.06), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   834.90), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   276.45), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   713.12), SIMDE_FLOAT32_C(   807.88), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   -48.40),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(   496.07), SIMDE_FLOAT32_C(   330.55), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   787.26),
+      SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -373.12),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   430.91), SIMDE_FLOAT32_C(   871.76),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   740.22), SIMDE_FLOAT32_C(   848.36), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   453.34),
+      SIMDE_FLOAT32_C(   656.24), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(  -373.12), SIMDE_FLOAT32_C(   799.25),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   499.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   130.82), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_n_f32_z(pv, av, b);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  b = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    ev = simde_svmax_n_f32_z(pv, av, b);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(    40.82), SIMDE_FLOAT32_C(  -422.76), SIMDE_FLOAT32_C(   250.88), SIMDE_FLOAT32_C(  -354.01),
+      SIMDE_FLOAT32_C(  -927.33), SIMDE_FLOAT32_C(  -656.49), SIMDE_FLOAT32_C(   -82.91), SIMDE_FLOAT32_C(   438.79),
+      SIMDE_FLOAT32_C(  -211.65), SIMDE_FLOAT32_C(  -390.95), SIMDE_FLOAT32_C(   793.18), SIMDE_FLOAT32_C(   654.50),
+      SIMDE_FLOAT32_C(   787.77), SIMDE_FLOAT32_C(   468.42), SIMDE_FLOAT32_C(   603.32), SIMDE_FLOAT32_C(  -750.27),
+      SIMDE_FLOAT32_C(  -849.99), SIMDE_FLOAT32_C(   506.55), SIMDE_FLOAT32_C(   885.14), SIMDE_FLOAT32_C(   980.90),
+      SIMDE_FLOAT32_C(   174.70), SIMDE_FLOAT32_C(   697.89), SIMDE_FLOAT32_C(   604.28), SIMDE_FLOAT32_C(  -568.67),
+      SIMDE_FLOAT32_C(  -118.22), SIMDE_FLOAT32_C(  -826.81), SIMDE_FLOAT32_C(   262.09), SIMDE_FLOAT32_C(   484.16),
+      SIMDE_FLOAT32_C(  -541.03), SIMDE_FLOAT32_C(   767.81), SIMDE_FLOAT32_C(    41.49), SIMDE_FLOAT32_C(   499.79),
+      SIMDE_FLOAT32_C(  -654.95), SIMDE_FLOAT32_C(  -707.63), SIMDE_FLOAT32_C(  -854.22), SIMDE_FLOAT32_C(  -582.29),
+      SIMDE_FLOAT32_C(  -364.12), SIMDE_FLOAT32_C(    62.87), SIMDE_FLOAT32_C(   856.50), SIMDE_FLOAT32_C(   424.24),
+      SIMDE_FLOAT32_C(   671.92), SIMDE_FLOAT32_C(   649.68), SIMDE_FLOAT32_C(    78.74), SIMDE_FLOAT32_C(   459.69),
+      SIMDE_FLOAT32_C(   118.10), SIMDE_FLOAT32_C(  -317.94), SIMDE_FLOAT32_C(   709.42), SIMDE_FLOAT32_C(   268.11),
+      SIMDE_FLOAT32_C(  -811.39), SIMDE_FLOAT32_C(   594.57), SIMDE_FLOAT32_C(   249.01), SIMDE_FLOAT32_C(   363.31),
+      SIMDE_FLOAT32_C(   292.46), SIMDE_FLOAT32_C(  -146.71), SIMDE_FLOAT32_C(   794.64), SIMDE_FLOAT32_C(  -825.76),
+      SIMDE_FLOAT32_C(    26.49), SIMDE_FLOAT32_C(    56.73), SIMDE_FLOAT32_C(   658.40), SIMDE_FLOAT32_C(   485.46),
+      SIMDE_FLOAT32_C(  -175.46), SIMDE_FLOAT32_C(  -300.11), SIMDE_FLOAT32_C(   -14.75), SIMDE_FLOAT32_C(   169.58),
+      SIMDE_FLOAT32_C(    -7.74), SIMDE_FLOAT32_C(   131.03), SIMDE_FLOAT32_C(   587.30), SIMDE_FLOAT32_C(   628.15),
+      SIMDE_FLOAT32_C(  -806.10), SIMDE_FLOAT32_C(   443.80), SIMDE_FLOAT32_C(    52.38), SIMDE_FLOAT32_C(   865.83),
+      SIMDE_FLOAT32_C(    93.48), SIMDE_FLOAT32_C(  -868.88), SIMDE_FLOAT32_C(   325.52), SIMDE_FLOAT32_C(  -788.42),
+      SIMDE_FLOAT32_C(  -186.83), SIMDE_FLOAT32_C(    34.94), SIMDE_FLOAT32_C(   479.69), SIMDE_FLOAT32_C(     1.78),
+      SIMDE_FLOAT32_C(  -370.49), SIMDE_FLOAT32_C(  -271.30), SIMDE_FLOAT32_C(  -634.91), SIMDE_FLOAT32_C(   921.97),
+      SIMDE_FLOAT32_C(   582.00), SIMDE_FLOAT32_C(  -840.27), SIMDE_FLOAT32_C(  -903.79), SIMDE_FLOAT32_C(  -391.52),
+      SIMDE_FLOAT32_C(   216.46), SIMDE_FLOAT32_C(   754.60), SIMDE_FLOAT32_C(  -906.06), SIMDE_FLOAT32_C(  -959.00),
+      SIMDE_FLOAT32_C(  -545.50), SIMDE_FLOAT32_C(    79.19), SIMDE_FLOAT32_C(   210.58), SIMDE_FLOAT32_C(   446.76),
+      SIMDE_FLOAT32_C(  -789.78), SIMDE_FLOAT32_C(  -202.12), SIMDE_FLOAT32_C(    74.91), SIMDE_FLOAT32_C(  -595.87),
+      SIMDE_FLOAT32_C(  -758.33), SIMDE_FLOAT32_C(  -872.71), SIMDE_FLOAT32_C(  -730.05), SIMDE_FLOAT32_C(   335.15),
+      SIMDE_FLOAT32_C(  -741.60), SIMDE_FLOAT32_C(   595.47), SIMDE_FLOAT32_C(   546.73), SIMDE_FLOAT32_C(    71.58),
+      SIMDE_FLOAT32_C(  -369.58), SIMDE_FLOAT32_C(    26.42), SIMDE_FLOAT32_C(  -926.64), SIMDE_FLOAT32_C(   259.93),
+      SIMDE_FLOAT32_C(   755.12), SIMDE_FLOAT32_C(  -561.55), SIMDE_FLOAT32_C(   181.90), SIMDE_FLOAT32_C(   337.12),
+      SIMDE_FLOAT32_C(  -401.82), SIMDE_FLOAT32_C(   278.11), SIMDE_FLOAT32_C(   945.61), SIMDE_FLOAT32_C(   814.64),
+      SIMDE_FLOAT32_C(    32.71), SIMDE_FLOAT32_C(  -960.45), SIMDE_FLOAT32_C(   855.64), SIMDE_FLOAT32_C(   487.21),
+      SIMDE_FLOAT32_C(   118.74), SIMDE_FLOAT32_C(    66.22), SIMDE_FLOAT32_C(   -66.03), SIMDE_FLOAT32_C(   328.96),
+      SIMDE_FLOAT32_C(   864.10), SIMDE_FLOAT32_C(  -991.13), SIMDE_FLOAT32_C(   733.09), SIMDE_FLOAT32_C(  -894.23),
+      SIMDE_FLOAT32_C(  -863.84), SIMDE_FLOAT32_C(  -996.96), SIMDE_FLOAT32_C(   440.92), SIMDE_FLOAT32_C(  -605.44),
+      SIMDE_FLOAT32_C(   598.51), SIMDE_FLOAT32_C(   -12.35), SIMDE_FLOAT32_C(   466.14), SIMDE_FLOAT32_C(  -771.07),
+      SIMDE_FLOAT32_C(  -985.93), SIMDE_FLOAT32_C(   539.50), SIMDE_FLOAT32_C(   488.87), SIMDE_FLOAT32_C(   769.19),
+      SIMDE_FLOAT32_C(   977.96), SIMDE_FLOAT32_C(  -329.23), SIMDE_FLOAT32_C(   106.31), SIMDE_FLOAT32_C(  -423.86),
+      SIMDE_FLOAT32_C(   948.87), SIMDE_FLOAT32_C(    51.92), SIMDE_FLOAT32_C(  -609.22), SIMDE_FLOAT32_C(   -18.42),
+      SIMDE_FLOAT32_C(    91.47), SIMDE_FLOAT32_C(  -753.58), SIMDE_FLOAT32_C(  -531.21), SIMDE_FLOAT32_C(  -789.79),
+      SIMDE_FLOAT32_C(   312.64), SIMDE_FLOAT32_C(   402.75), SIMDE_FLOAT32_C(   539.17), SIMDE_FLOAT32_C(   176.74),
+      SIMDE_FLOAT32_C(   411.63), SIMDE_FLOAT32_C(   272.25), SIMDE_FLOAT32_C(   282.51), SIMDE_FLOAT32_C(   547.79),
+      SIMDE_FLOAT32_C(   275.29) };
+  static const simde_float32 b = SIMDE_FLOAT32_C(  -276.56);
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(    40.82), SIMDE_FLOAT32_C(  -422.76), SIMDE_FLOAT32_C(   250.88), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -927.33), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   -82.91), SIMDE_FLOAT32_C(   438.79),
+      SIMDE_FLOAT32_C(  -211.65), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   793.18), SIMDE_FLOAT32_C(   654.50),
+      SIMDE_FLOAT32_C(   787.77), SIMDE_FLOAT32_C(   468.42), SIMDE_FLOAT32_C(   603.32), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -849.99), SIMDE_FLOAT32_C(   506.55), SIMDE_FLOAT32_C(   885.14), SIMDE_FLOAT32_C(   980.90),
+      SIMDE_FLOAT32_C(   174.70), SIMDE_FLOAT32_C(   697.89), SIMDE_FLOAT32_C(   604.28), SIMDE_FLOAT32_C(  -568.67),
+      SIMDE_FLOAT32_C(  -118.22), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   262.09), SIMDE_FLOAT32_C(   484.16),
+      SIMDE_FLOAT32_C(  -541.03), SIMDE_FLOAT32_C(   767.81), SIMDE_FLOAT32_C(    41.49), SIMDE_FLOAT32_C(   499.79),
+      SIMDE_FLOAT32_C(  -654.95), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -582.29),
+      SIMDE_FLOAT32_C(  -364.12), SIMDE_FLOAT32_C(    62.87), SIMDE_FLOAT32_C(   856.50), SIMDE_FLOAT32_C(   424.24),
+      SIMDE_FLOAT32_C(   671.92), SIMDE_FLOAT32_C(   649.68), SIMDE_FLOAT32_C(    78.74), SIMDE_FLOAT32_C(   459.69),
+      SIMDE_FLOAT32_C(   118.10), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   709.42), SIMDE_FLOAT32_C(   268.11),
+      SIMDE_FLOAT32_C(  -811.39), SIMDE_FLOAT32_C(   594.57), SIMDE_FLOAT32_C(   249.01), SIMDE_FLOAT32_C(   363.31),
+      SIMDE_FLOAT32_C(   292.46), SIMDE_FLOAT32_C(  -146.71), SIMDE_FLOAT32_C(   794.64), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(    26.49), SIMDE_FLOAT32_C(    56.73), SIMDE_FLOAT32_C(   658.40), SIMDE_FLOAT32_C(   485.46),
+      SIMDE_FLOAT32_C(  -175.46), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   -14.75), SIMDE_FLOAT32_C(   169.58),
+      SIMDE_FLOAT32_C(    -7.74), SIMDE_FLOAT32_C(   131.03), SIMDE_FLOAT32_C(   587.30), SIMDE_FLOAT32_C(   628.15),
+      SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   443.80), SIMDE_FLOAT32_C(    52.38), SIMDE_FLOAT32_C(   865.83),
+      SIMDE_FLOAT32_C(    93.48), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   325.52), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -186.83), SIMDE_FLOAT32_C(    34.94), SIMDE_FLOAT32_C(   479.69), SIMDE_FLOAT32_C(     1.78),
+      SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -271.30), SIMDE_FLOAT32_C(  -634.91), SIMDE_FLOAT32_C(   921.97),
+      SIMDE_FLOAT32_C(   582.00), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(   216.46), SIMDE_FLOAT32_C(   754.60), SIMDE_FLOAT32_C(  -906.06), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -545.50), SIMDE_FLOAT32_C(    79.19), SIMDE_FLOAT32_C(   210.58), SIMDE_FLOAT32_C(   446.76),
+      SIMDE_FLOAT32_C(  -789.78), SIMDE_FLOAT32_C(  -202.12), SIMDE_FLOAT32_C(    74.91), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -758.33), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -730.05), SIMDE_FLOAT32_C(   335.15),
+      SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   595.47), SIMDE_FLOAT32_C(   546.73), SIMDE_FLOAT32_C(    71.58),
+      SIMDE_FLOAT32_C(  -369.58), SIMDE_FLOAT32_C(    26.42), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   259.93),
+      SIMDE_FLOAT32_C(   755.12), SIMDE_FLOAT32_C(  -561.55), SIMDE_FLOAT32_C(   181.90), SIMDE_FLOAT32_C(   337.12),
+      SIMDE_FLOAT32_C(  -401.82), SIMDE_FLOAT32_C(   278.11), SIMDE_FLOAT32_C(   945.61), SIMDE_FLOAT32_C(   814.64),
+      SIMDE_FLOAT32_C(    32.71), SIMDE_FLOAT32_C(  -960.45), SIMDE_FLOAT32_C(   855.64), SIMDE_FLOAT32_C(   487.21),
+      SIMDE_FLOAT32_C(   118.74), SIMDE_FLOAT32_C(    66.22), SIMDE_FLOAT32_C(   -66.03), SIMDE_FLOAT32_C(   328.96),
+      SIMDE_FLOAT32_C(   864.10), SIMDE_FLOAT32_C(  -991.13), SIMDE_FLOAT32_C(   733.09), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   440.92), SIMDE_FLOAT32_C(  -605.44),
+      SIMDE_FLOAT32_C(   598.51), SIMDE_FLOAT32_C(   -12.35), SIMDE_FLOAT32_C(   466.14), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   539.50), SIMDE_FLOAT32_C(   488.87), SIMDE_FLOAT32_C(   769.19),
+      SIMDE_FLOAT32_C(   977.96), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   106.31), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(   948.87), SIMDE_FLOAT32_C(    51.92), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(   -18.42),
+      SIMDE_FLOAT32_C(    91.47), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -276.56), SIMDE_FLOAT32_C(  -276.56),
+      SIMDE_FLOAT32_C(   312.64), SIMDE_FLOAT32_C(   402.75), SIMDE_FLOAT32_C(   539.17), SIMDE_FLOAT32_C(   176.74),
+      SIMDE_FLOAT32_C(   411.63), SIMDE_FLOAT32_C(   272.25), SIMDE_FLOAT32_C(   282.51), SIMDE_FLOAT32_C(   547.79),
+      SIMDE_FLOAT32_C(   275.29) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmax_n_f32_m(pv, av, b);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  b = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    ev = simde_svmax_n_f32_m(pv, av, b);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   505.43), SIMDE_FLOAT64_C(  -155.88), SIMDE_FLOAT64_C(   310.25), SIMDE_FLOAT64_C(  -875.38),
+      SIMDE_FLOAT64_C(  -971.62), SIMDE_FLOAT64_C(  -966.83), SIMDE_FLOAT64_C(  -960.48), SIMDE_FLOAT64_C(  -949.61),
+      SIMDE_FLOAT64_C(   -80.64), SIMDE_FLOAT64_C(   420.29), SIMDE_FLOAT64_C(   903.52), SIMDE_FLOAT64_C(   613.52),
+      SIMDE_FLOAT64_C(  -876.48), SIMDE_FLOAT64_C(  -892.38), SIMDE_FLOAT64_C(   397.77), SIMDE_FLOAT64_C(  -886.29),
+      SIMDE_FLOAT64_C(   982.64), SIMDE_FLOAT64_C(   866.70), SIMDE_FLOAT64_C(  -659.53), SIMDE_FLOAT64_C(   140.24),
+      SIMDE_FLOAT64_C(   221.28), SIMDE_FLOAT64_C(  -846.51), SIMDE_FLOAT64_C(  -100.30), SIMDE_FLOAT64_C(   257.36),
+      SIMDE_FLOAT64_C(   636.25), SIMDE_FLOAT64_C(   370.29), SIMDE_FLOAT64_C(   759.66), SIMDE_FLOAT64_C(  -756.19),
+      SIMDE_FLOAT64_C(  -700.43), SIMDE_FLOAT64_C(  -771.29), SIMDE_FLOAT64_C(  -222.94), SIMDE_FLOAT64_C(   805.00),
+      SIMDE_FLOAT64_C(    72.83), SIMDE_FLOAT64_C(  -912.69), SIMDE_FLOAT64_C(   929.61), SIMDE_FLOAT64_C(   101.20),
+      SIMDE_FLOAT64_C(  -879.52), SIMDE_FLOAT64_C(   969.14), SIMDE_FLOAT64_C(   151.60), SIMDE_FLOAT64_C(    39.84),
+      SIMDE_FLOAT64_C(   389.43), SIMDE_FLOAT64_C(    55.12), SIMDE_FLOAT64_C(  -346.64), SIMDE_FLOAT64_C(   512.95),
+      SIMDE_FLOAT64_C(   162.74), SIMDE_FLOAT64_C(  -948.87), SIMDE_FLOAT64_C(   626.66), SIMDE_FLOAT64_C(   145.38),
+      SIMDE_FLOAT64_C(   917.83), SIMDE_FLOAT64_C(   967.13), SIMDE_FLOAT64_C(  -714.38), SIMDE_FLOAT64_C(   139.11),
+      SIMDE_FLOAT64_C(  -879.38), SIMDE_FLOAT64_C(   185.32), SIMDE_FLOAT64_C(  -603.53), SIMDE_FLOAT64_C(   756.88),
+      SIMDE_FLOAT64_C(  -444.39), SIMDE_FLOAT64_C(  -843.88), SIMDE_FLOAT64_C(  -999.31), SIMDE_FLOAT64_C(  -144.81),
+      SIMDE_FLOAT64_C(  -615.16), SIMDE_FLOAT64_C(  -222.26), SIMDE_FLOAT64_C(  -339.82), SIMDE_FLOAT64_C(   457.66),
+      SIMDE_FLOAT64_C(  -134.95), SIMDE_FLOAT64_C(  -410.20), SIMDE_FLOAT64_C(  -441.13), SIMDE_FLOAT64_C(   -14.47),
+      SIMDE_FLOAT64_C(  -441.07), SIMDE_FLOAT64_C(   710.47), SIMDE_FLOAT64_C(  -974.63), SIMDE_FLOAT64_C(   948.36),
+      SIMDE_FLOAT64_C(  -234.41), SIMDE_FLOAT64_C(  -321.27), SIMDE_FLOAT64_C(   461.31), SIMDE_FLOAT64_C(   928.33),
+      SIMDE_FLOAT64_C(  -270.15), SIMDE_FLOAT64_C(    87.97), SIMDE_FLOAT64_C(    73.71), SIMDE_FLOAT64_C(  -352.32),
+      SIMDE_FLOAT64_C(    55.11), SIMDE_FLOAT64_C(   359.33), SIMDE_FLOAT64_C(   786.79), SIMDE_FLOAT64_C(   175.73),
+      SIMDE_FLOAT64_C(  -455.34), SIMDE_FLOAT64_C(  -816.74), SIMDE_FLOAT64_C(   -67.40), SIMDE_FLOAT64_C(   100.27),
+      SIMDE_FLOAT64_C(  -660.62), SIMDE_FLOAT64_C(   -66.71), SIMDE_FLOAT64_C(   955.46), SIMDE_FLOAT64_C(  -275.78),
+      SIMDE_FLOAT64_C(   711.04), SIMDE_FLOAT64_C(  -384.36), SIMDE_FLOAT64_C(  -818.12), SIMDE_FLOAT64_C(  -423.91),
+      SIMDE_FLOAT64_C(   205.44), SIMDE_FLOAT64_C(  -259.25), SIMDE_FLOAT64_C(   561.61), SIMDE_FLOAT64_C(   764.37),
+      SIMDE_FLOAT64_C(  -548.78), SIMDE_FLOAT64_C(   586.98), SIMDE_FLOAT64_C(   712.73), SIMDE_FLOAT64_C(   216.80),
+      SIMDE_FLOAT64_C(  -734.30), SIMDE_FLOAT64_C(   174.04), SIMDE_FLOAT64_C(   145.13), SIMDE_FLOAT64_C(    -4.44),
+      SIMDE_FLOAT64_C(  -737.98), SIMDE_FLOAT64_C(  -781.16), SIMDE_FLOAT64_C(   643.24), SIMDE_FLOAT64_C(   317.13),
+      SIMDE_FLOAT64_C(   578.17), SIMDE_FLOAT64_C(   430.02), SIMDE_FLOAT64_C(  -507.15), SIMDE_FLOAT64_C(  -877.17),
+      SIMDE_FLOAT64_C(   613.28) };
+  static const simde_float64 b = SIMDE_FLOAT64_C(   425.46);
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   903.52), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   982.64), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   759.66), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   969.14), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   626.66), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   967.13), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   756.88),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   710.47), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   948.36),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   461.31), SIMDE_FLOAT64_C(   928.33),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   955.46), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(   711.04), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   712.73), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   425.46), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   578.17), SIMDE_FLOAT64_C(   430.02), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_n_f64_z(pv, av, b);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  b = simde_test_codegen_random_f64(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    ev = simde_svmax_n_f64_z(pv, av, b);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmax_n_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   565.13), SIMDE_FLOAT64_C(  -466.07), SIMDE_FLOAT64_C(   948.54), SIMDE_FLOAT64_C(  -853.91),
+      SIMDE_FLOAT64_C(   -17.63), SIMDE_FLOAT64_C(  -595.38), SIMDE_FLOAT64_C(   106.69), SIMDE_FLOAT64_C(  -981.72),
+      SIMDE_FLOAT64_C(  -333.32), SIMDE_FLOAT64_C(  -793.07), SIMDE_FLOAT64_C(   410.04), SIMDE_FLOAT64_C(   337.55),
+      SIMDE_FLOAT64_C(   451.40), SIMDE_FLOAT64_C(  -380.30), SIMDE_FLOAT64_C(  -574.20), SIMDE_FLOAT64_C(  -714.25),
+      SIMDE_FLOAT64_C(   369.91), SIMDE_FLOAT64_C(    93.20), SIMDE_FLOAT64_C(   108.45), SIMDE_FLOAT64_C(   643.35),
+      SIMDE_FLOAT64_C(  -574.63), SIMDE_FLOAT64_C(  -546.67), SIMDE_FLOAT64_C(  -352.80), SIMDE_FLOAT64_C(  -796.80),
+      SIMDE_FLOAT64_C(  -571.72), SIMDE_FLOAT64_C(   228.52), SIMDE_FLOAT64_C(  -228.69), SIMDE_FLOAT64_C(  -683.50),
+      SIMDE_FLOAT64_C(  -741.47), SIMDE_FLOAT64_C(  -981.17), SIMDE_FLOAT64_C(  -504.93), SIMDE_FLOAT64_C(   823.66),
+      SIMDE_FLOAT64_C(  -447.23), SIMDE_FLOAT64_C(  -556.39), SIMDE_FLOAT64_C(   969.76), SIMDE_FLOAT64_C(   535.13),
+      SIMDE_FLOAT64_C(  -151.77), SIMDE_FLOAT64_C(    76.45), SIMDE_FLOAT64_C(   553.42), SIMDE_FLOAT64_C(   514.92),
+      SIMDE_FLOAT64_C(   283.37), SIMDE_FLOAT64_C(   -36.54), SIMDE_FLOAT64_C(  -147.53), SIMDE_FLOAT64_C(  -265.22),
+      SIMDE_FLOAT64_C(   583.15), SIMDE_FLOAT64_C(   278.27), SIMDE_FLOAT64_C(    20.53), SIMDE_FLOAT64_C(   -46.93),
+      SIMDE_FLOAT64_C(  -628.54), SIMDE_FLOAT64_C(  -871.02), SIMDE_FLOAT64_C(  -403.58), SIMDE_FLOAT64_C(  -203.16),
+      SIMDE_FLOAT64_C(  -417.69), SIMDE_FLOAT64_C(   243.62), SIMDE_FLOAT64_C(     0.04), SIMDE_FLOAT64_C(    10.59),
+      SIMDE_FLOAT64_C(  -527.86), SIMDE_FLOAT64_C(   771.34), SIMDE_FLOAT64_C(   327.09), SIMDE_FLOAT64_C(  -269.33),
+      SIMDE_FLOAT64_C(   790.18), SIMDE_FLOAT64_C(   822.16), SIMDE_FLOAT64_C(  -445.67), SIMDE_FLOAT64_C(  -657.05),
+      SIMDE_FLOAT64_C(  -734.23), SIMDE_FLOAT64_C(  -475.92), SIMDE_FLOAT64_C(   878.08) };
+  static const simde_float64 b = SIMDE_FLOAT64_C(   114.00);
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(   565.13), SIMDE_FLOAT64_C(  -466.07), SIMDE_FLOAT64_C(   948.54), SIMDE_FLOAT64_C(  -853.91),
+      SIMDE_FLOAT64_C(   -17.63), SIMDE_FLOAT64_C(  -595.38), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   410.04), SIMDE_FLOAT64_C(   337.55),
+      SIMDE_FLOAT64_C(   451.40), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(  -574.20), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(   369.91), SIMDE_FLOAT64_C(    93.20), SIMDE_FLOAT64_C(   108.45), SIMDE_FLOAT64_C(   643.35),
+      SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(  -546.67), SIMDE_FLOAT64_C(  -352.80), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(  -571.72), SIMDE_FLOAT64_C(   228.52), SIMDE_FLOAT64_C(  -228.69), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(  -741.47), SIMDE_FLOAT64_C(  -981.17), SIMDE_FLOAT64_C(  -504.93), SIMDE_FLOAT64_C(   823.66),
+      SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(  -556.39), SIMDE_FLOAT64_C(   969.76), SIMDE_FLOAT64_C(   535.13),
+      SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   553.42), SIMDE_FLOAT64_C(   514.92),
+      SIMDE_FLOAT64_C(   283.37), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(   583.15), SIMDE_FLOAT64_C(   278.27), SIMDE_FLOAT64_C(    20.53), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(  -871.02), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(  -203.16),
+      SIMDE_FLOAT64_C(  -417.69), SIMDE_FLOAT64_C(   243.62), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(    10.59),
+      SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   771.34), SIMDE_FLOAT64_C(   327.09), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(   790.18), SIMDE_FLOAT64_C(   822.16), SIMDE_FLOAT64_C(   114.00), SIMDE_FLOAT64_C(   114.00),
+      SIMDE_FLOAT64_C(  -734.23), SIMDE_FLOAT64_C(  -475.92), SIMDE_FLOAT64_C(   878.08) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmax_n_f64_m(pv, av, b);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  b = simde_test_codegen_random_f64(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    ev = simde_svmax_n_f64_m(pv, av, b);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_f64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmax_n_f64_m)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
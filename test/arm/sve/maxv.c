@@ -0,0 +1,1522 @@
+#define SIMDE_TEST_ARM_SVE_INSN maxv
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/maxv.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+
+static int
+test_simde_svmaxv_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C(  45),  INT8_C(  68), -INT8_C(  81),  INT8_C(  79), -INT8_C(  82), -INT8_C(  41),  INT8_C(  33), -INT8_C(   6),
+      -INT8_C(  99),  INT8_C(  50), -INT8_C(   6),  INT8_C(  49),  INT8_C(  66), -INT8_C(  38), -INT8_C(  47),  INT8_C(  80),
+      -INT8_C( 100), -INT8_C(  12),  INT8_C( 107), -INT8_C(  24), -INT8_C( 127), -INT8_C( 104),  INT8_C(  10),  INT8_C(  45),
+       INT8_C(  45), -INT8_C(   6), -INT8_C(  86), -INT8_C(  13), -INT8_C(  42),  INT8_C(  67),  INT8_C(   9),  INT8_C(   3),
+      -INT8_C( 121), -INT8_C(  71),  INT8_C(  82),  INT8_C(  54), -INT8_C( 112),  INT8_C( 115),  INT8_C(  48),  INT8_C(  45),
+      -INT8_C(  91),  INT8_C(  42),  INT8_C(  94), -INT8_C(  24),  INT8_C(   4),  INT8_C(  47),  INT8_C(  56), -INT8_C(  95),
+       INT8_C(  36), -INT8_C(  93), -INT8_C( 119), -INT8_C(  91),  INT8_C(  60), -INT8_C( 109), -INT8_C(  46),  INT8_C( 105),
+      -INT8_C( 114),  INT8_C( 125),  INT8_C(  92),  INT8_C( 100), -INT8_C(  64),  INT8_C( 101),  INT8_C( 103),  INT8_C(  71),
+       INT8_C(  30), -INT8_C(  71),  INT8_C( 125), -INT8_C(  82),  INT8_C(  44), -INT8_C(  82), -INT8_C(  36), -INT8_C(  47),
+      -INT8_C(  40),  INT8_C(  58), -INT8_C(  71), -INT8_C(  35),  INT8_C( 106), -INT8_C(  14),  INT8_C( 126), -INT8_C( 114),
+      -INT8_C( 107),  INT8_C(   7),  INT8_C(  51), -INT8_C(  47), -INT8_C( 102),  INT8_C(   5),  INT8_C(  58),  INT8_C(  40),
+      -INT8_C( 126), -INT8_C( 106), -INT8_C( 116),  INT8_C(  66), -INT8_C(   4), -INT8_C(  13), -INT8_C( 118),  INT8_C(  26),
+      -INT8_C(  84),  INT8_C(   7), -INT8_C(  55), -INT8_C(  40), -INT8_C(  75), -INT8_C(  91), -INT8_C(  86), -INT8_C( 114),
+      -INT8_C(  33),  INT8_C(  99),  INT8_C( 107),  INT8_C(  73),  INT8_C(  85), -INT8_C(  23), -INT8_C(  41), -INT8_C(  21),
+      -INT8_C(  16),  INT8_C(  10), -INT8_C(  68), -INT8_C( 118),  INT8_C(  16), -INT8_C(   9), -INT8_C(  77), -INT8_C( 110),
+      -INT8_C( 115),  INT8_C(  63), -INT8_C(  43), -INT8_C( 119),  INT8_C(  51),  INT8_C(  95), -INT8_C(  92), -INT8_C(  33),
+       INT8_C( 102),  INT8_C( 109), -INT8_C(  72),  INT8_C(  28),  INT8_C(  18),  INT8_C(  98), -INT8_C(  86), -INT8_C(  15),
+      -INT8_C(  59),  INT8_C(  21),  INT8_C(  59),  INT8_C(  27), -INT8_C(   2),  INT8_C(  18),  INT8_C(   6), -INT8_C(  18),
+       INT8_C(  29), -INT8_C(  62),  INT8_C( 120),  INT8_C(  45), -INT8_C(  71),  INT8_C(  43), -INT8_C(  65),  INT8_C(  71),
+       INT8_C( 107), -INT8_C( 108), -INT8_C(  48), -INT8_C(  98), -INT8_C(  13),  INT8_C( 116),  INT8_C( 125),  INT8_C(  90),
+      -INT8_C(  31),  INT8_C(  53),  INT8_C( 118), -INT8_C(  13), -INT8_C( 105),  INT8_C(  32), -INT8_C(  27),  INT8_C(  93),
+       INT8_C(  53),  INT8_C(  32),  INT8_C( 120),  INT8_C(  51),  INT8_C(  50),  INT8_C( 126),  INT8_C(  33),  INT8_C(  79),
+       INT8_C(  64), -INT8_C( 103),  INT8_C( 124), -INT8_C(   6), -INT8_C(  59),  INT8_C(  60),  INT8_C(  65),  INT8_C(  48),
+      -INT8_C(  48),  INT8_C(  17), -INT8_C(  50), -INT8_C(  60), -INT8_C( 122),  INT8_C(  75),  INT8_C(  30),  INT8_C( 103),
+      -INT8_C( 127), -INT8_C( 108),  INT8_C(  91),  INT8_C(  24), -INT8_C(  76),  INT8_C(  64),  INT8_C( 117), -INT8_C(  23),
+       INT8_C(  96), -INT8_C(  19),  INT8_C(  28), -INT8_C( 110),  INT8_C( 107),  INT8_C(  61), -INT8_C(  30), -INT8_C(  84),
+      -INT8_C(  42),  INT8_C(  94), -INT8_C(  90), -INT8_C( 101), -INT8_C( 102), -INT8_C(  25), -INT8_C(  53),  INT8_C( 107),
+      -INT8_C(   8), -INT8_C( 103),  INT8_C(  47),  INT8_C( 126), -INT8_C(  27),  INT8_C(  77), -INT8_C(  26),  INT8_C( 102),
+      -INT8_C(  31),  INT8_C(  65),  INT8_C( 126), -INT8_C( 107), -INT8_C( 127), -INT8_C(  12),  INT8_C( 126), -INT8_C(  31),
+      -INT8_C(  31), -INT8_C( 102),  INT8_C( 115),  INT8_C(  77), -INT8_C(  41),  INT8_C(  85), -INT8_C(   7), -INT8_C(  83),
+      -INT8_C(  76), -INT8_C(  97),  INT8_C(  73),  INT8_C(  78), -INT8_C( 122),  INT8_C(  20), -INT8_C(  71),  INT8_C( 126),
+      -INT8_C(  82), -INT8_C(  24), -INT8_C(   3), -INT8_C( 109),  INT8_C(  53), -INT8_C(  29), -INT8_C(   7),  INT8_C(  22),
+       INT8_C(  36),  INT8_C( 119), -INT8_C(  85), -INT8_C(  91),  INT8_C( 107),  INT8_C(  41), -INT8_C( 122),  INT8_C(  77),
+      -INT8_C(  61), -INT8_C(   7), -INT8_C( 102), -INT8_C( 102),  INT8_C(  79), -INT8_C( 109),  INT8_C(  72),  INT8_C(   3),
+       INT8_C(  50), -INT8_C( 111),  INT8_C(  81), -INT8_C(  72), -INT8_C(  91),  INT8_C(  11),  INT8_C(  54),  INT8_C(  83),
+      -INT8_C(  13),  INT8_C(  51), -INT8_C(  26),  INT8_C(  41),  INT8_C(  22), -INT8_C(  33),  INT8_C(  63),  INT8_C(  58),
+       INT8_C(  87), -INT8_C(  21), -INT8_C(  33), -INT8_C(  62),  INT8_C(  20),  INT8_C( 101),  INT8_C(  15), -INT8_C(  40),
+       INT8_C(  95), -INT8_C(  87),  INT8_C( 114), -INT8_C(  82),  INT8_C(  60), -INT8_C(  70), -INT8_C(  79),  INT8_C( 110),
+       INT8_C(  75),  INT8_C(   2),  INT8_C(  38), -INT8_C(  15),  INT8_C(  13),  INT8_C(  93),  INT8_C(  68),  INT8_C(   1),
+      -INT8_C( 112),  INT8_C(  43),  INT8_C(  42), -INT8_C(  89),  INT8_C(  10),  INT8_C( 105), -INT8_C(  31),  INT8_C(  97),
+       INT8_C(  84), -INT8_C(  63),  INT8_C(  36),  INT8_C( 105),  INT8_C(  38),  INT8_C(  51),  INT8_C(  65), -INT8_C( 123),
+      -INT8_C(  35), -INT8_C(  77),  INT8_C(  51),  INT8_C(  25),  INT8_C( 110), -INT8_C(  28), -INT8_C( 120), -INT8_C(  71),
+      -INT8_C(  25), -INT8_C(  82), -INT8_C(  86), -INT8_C(  12),  INT8_C(  11), -INT8_C(  17), -INT8_C(  11), -INT8_C( 100),
+       INT8_C(  26),  INT8_C(  31),  INT8_C(  67),  INT8_C(  36), -INT8_C( 119),  INT8_C(  36), -INT8_C( 122), -INT8_C(  35),
+      -INT8_C(  27), -INT8_C(  86),  INT8_C(  70),  INT8_C(  12), -INT8_C(  35), -INT8_C( 121), -INT8_C( 111), -INT8_C(  70),
+       INT8_C(  59), -INT8_C(  59), -INT8_C(  44), -INT8_C(  87), -INT8_C(  87),  INT8_C(  92),  INT8_C(  98), -INT8_C( 112),
+       INT8_C(  10),  INT8_C(  13), -INT8_C( 123),  INT8_C(  22), -INT8_C(   4),  INT8_C( 122), -INT8_C(  78),  INT8_C(  22),
+      -INT8_C( 102), -INT8_C(  11),  INT8_C(  58),  INT8_C(  35),  INT8_C(  25), -INT8_C(  64),  INT8_C(   0), -INT8_C(   1),
+       INT8_C( 106),  INT8_C(  71),  INT8_C(  11),  INT8_C(  72), -INT8_C(  50), -INT8_C( 100),  INT8_C(   2),  INT8_C(   9),
+       INT8_C(  97), -INT8_C(  42), -INT8_C(  78),  INT8_C(  11),  INT8_C(  50),  INT8_C(  21), -INT8_C( 101),  INT8_C(  61),
+       INT8_C(  34),  INT8_C(  32),  INT8_C(  83),  INT8_C(  30), -INT8_C( 101),  INT8_C(   5),  INT8_C(  52),  INT8_C(  53),
+      -INT8_C(   6),  INT8_C( 110),  INT8_C(  88),  INT8_C(  19),  INT8_C(  47),  INT8_C(  88),  INT8_C(  18), -INT8_C( 103),
+      -INT8_C(  97),  INT8_C(  29), -INT8_C(  31),  INT8_C( 110), -INT8_C(  70), -INT8_C(  28),  INT8_C( 119),  INT8_C(  27),
+      -INT8_C(  70),  INT8_C(  42),  INT8_C(  38), -INT8_C(  19),  INT8_C(  63), -INT8_C(  62),  INT8_C(  42),  INT8_C(  97),
+      -INT8_C(  30),  INT8_C( 125),      INT8_MAX,  INT8_C( 125), -INT8_C( 126), -INT8_C(  77), -INT8_C(  78),  INT8_C( 124),
+       INT8_C(  33),  INT8_C(  10), -INT8_C( 113),  INT8_C(  80),  INT8_C(  99), -INT8_C(  94), -INT8_C(  22),  INT8_C(   2),
+      -INT8_C(  65), -INT8_C(  53),  INT8_C( 112),  INT8_C( 121), -INT8_C(  81), -INT8_C(  24), -INT8_C( 107),  INT8_C( 106),
+       INT8_C(  18), -INT8_C(  69),  INT8_C(  87),  INT8_C(  81),  INT8_C( 125), -INT8_C( 127), -INT8_C(  78),  INT8_C(  96),
+      -INT8_C(   2),  INT8_C(  49), -INT8_C(  35),      INT8_MIN, -INT8_C(  28), -INT8_C( 112), -INT8_C(   4),  INT8_C(   5),
+      -INT8_C( 102), -INT8_C( 117),  INT8_C(  86), -INT8_C(   3),  INT8_C(  45),  INT8_C(  64),  INT8_C(   0), -INT8_C(  19),
+       INT8_C(  11),  INT8_C( 112),  INT8_C( 102), -INT8_C(  69),  INT8_C(  88), -INT8_C(   5),  INT8_C(  37),  INT8_C( 106),
+      -INT8_C(  73),  INT8_C( 124), -INT8_C(  69),  INT8_C(  52), -INT8_C(   3),  INT8_C( 109), -INT8_C( 108), -INT8_C(   5),
+      -INT8_C(  98),  INT8_C( 114),  INT8_C( 123), -INT8_C( 126),  INT8_C(   2),  INT8_C( 119), -INT8_C( 120), -INT8_C( 100),
+       INT8_C(   2), -INT8_C(  34), -INT8_C( 102),  INT8_C(  48),  INT8_C(  30), -INT8_C( 102),  INT8_C(  29),  INT8_C(  41),
+       INT8_C(  10), -INT8_C( 125), -INT8_C(  28),  INT8_C(  99),      INT8_MAX,  INT8_C(   9), -INT8_C(  51),  INT8_C(  54),
+      -INT8_C( 123), -INT8_C( 119),  INT8_C( 106), -INT8_C( 126), -INT8_C(  10), -INT8_C(   1),  INT8_C( 125), -INT8_C( 107),
+       INT8_C( 113), -INT8_C(   8),  INT8_C(  23),  INT8_C( 115),  INT8_C( 111), -INT8_C(  97),  INT8_C(  15),  INT8_C( 114),
+       INT8_C( 125), -INT8_C(  87), -INT8_C(  94), -INT8_C( 101),  INT8_C(  67), -INT8_C(  65), -INT8_C(  59),  INT8_C(  78),
+       INT8_C(  66), -INT8_C(  87), -INT8_C(  79), -INT8_C(  63), -INT8_C(  77),  INT8_C( 126), -INT8_C(   9),  INT8_C(  56),
+       INT8_C(   7),  INT8_C(  98), -INT8_C(  69), -INT8_C(   2),  INT8_C(  97),  INT8_C(  56), -INT8_C( 109), -INT8_C(  46),
+       INT8_C(  49), -INT8_C(  86),  INT8_C(  69), -INT8_C(  96),  INT8_C(  74),  INT8_C(  84),  INT8_C(  18), -INT8_C(  57),
+      -INT8_C(   2), -INT8_C(  76),  INT8_C(  99),  INT8_C(  65),  INT8_C( 115),  INT8_C(  40), -INT8_C( 113), -INT8_C(  74),
+      -INT8_C(  47),  INT8_C(  64),  INT8_C( 119), -INT8_C( 124), -INT8_C(  65),  INT8_C( 111), -INT8_C(  67), -INT8_C(  58),
+      -INT8_C(  47),  INT8_C( 120), -INT8_C(  60),  INT8_C(  50), -INT8_C(  80),  INT8_C(  87),  INT8_C(   4), -INT8_C(  31),
+       INT8_C(   2),  INT8_C(  73), -INT8_C( 126),  INT8_C(  76), -INT8_C(  99), -INT8_C( 108),  INT8_C(  19), -INT8_C( 101),
+       INT8_C(  73),  INT8_C( 118), -INT8_C(  35), -INT8_C(  68), -INT8_C(  98),  INT8_C( 108),  INT8_C( 114),  INT8_C( 112),
+      -INT8_C(  83), -INT8_C(  22), -INT8_C(  12),  INT8_C( 108),  INT8_C(  89), -INT8_C(  79),  INT8_C(  50),  INT8_C(  42),
+       INT8_C(  41), -INT8_C(   9),  INT8_C(  92), -INT8_C(  38),  INT8_C(  78),  INT8_C(  96), -INT8_C(  69),  INT8_C(  80),
+      -INT8_C(  87),  INT8_C(  61), -INT8_C( 100),  INT8_C(  70), -INT8_C(  46), -INT8_C(  80), -INT8_C(  30),  INT8_C(  27),
+       INT8_C(  38), -INT8_C(  65), -INT8_C(  41), -INT8_C(  59),  INT8_C(  43),  INT8_C(  74) };
+  static const int8_t e =      INT8_MAX;
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int8_t r = INT8_MIN;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    int8_t v = simde_svmaxv_s8(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_i8(e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024];
+  int8_t e = INT8_MIN;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    int8_t v = simde_svmaxv_s8(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) };
+  static const int16_t a[] =
+    { -INT16_C( 12388),  INT16_C( 10878),  INT16_C( 10841), -INT16_C( 10011),  INT16_C( 11608), -INT16_C( 18296), -INT16_C(  5747), -INT16_C(  4222),
+      -INT16_C( 17665),  INT16_C( 17866), -INT16_C( 31739), -INT16_C( 20438),  INT16_C( 19804), -INT16_C(  1840),  INT16_C( 30633),  INT16_C( 17978),
+      -INT16_C( 18106), -INT16_C( 24720),  INT16_C( 21987),  INT16_C( 15223), -INT16_C(   126),  INT16_C(  4084),  INT16_C( 30440), -INT16_C(  6145),
+      -INT16_C( 14032),  INT16_C( 13868),  INT16_C( 22093), -INT16_C( 22042), -INT16_C( 18525),  INT16_C( 19874), -INT16_C(  9170),  INT16_C( 29843),
+       INT16_C(   917),  INT16_C( 30995), -INT16_C( 30119), -INT16_C(  9292), -INT16_C( 22390),  INT16_C( 29419), -INT16_C(  5601),  INT16_C( 20314),
+      -INT16_C( 31053),  INT16_C(   133),  INT16_C( 27869), -INT16_C( 32599),  INT16_C( 19235),  INT16_C( 20941),  INT16_C( 24616), -INT16_C( 16955),
+      -INT16_C( 10140), -INT16_C( 17098), -INT16_C(  5278), -INT16_C(  4968), -INT16_C( 31853), -INT16_C( 19873), -INT16_C( 18067),  INT16_C(  8194),
+      -INT16_C( 30913),  INT16_C(  7200), -INT16_C( 13581),  INT16_C(  5789),  INT16_C( 27157),  INT16_C( 15719),  INT16_C( 11467),  INT16_C( 12283),
+       INT16_C( 12548),  INT16_C( 26604), -INT16_C( 31716), -INT16_C( 20397), -INT16_C( 19960),  INT16_C( 30050),  INT16_C( 25707), -INT16_C( 21610),
+      -INT16_C( 18708), -INT16_C(  8249),  INT16_C( 25728), -INT16_C( 26890),  INT16_C( 24015), -INT16_C( 25901), -INT16_C( 12662), -INT16_C( 28983),
+      -INT16_C( 19200),  INT16_C(  7413),  INT16_C( 18745),  INT16_C( 16844),  INT16_C( 12283),  INT16_C( 26551),  INT16_C( 19859),  INT16_C( 32530),
+      -INT16_C(  9981), -INT16_C( 31649),  INT16_C( 21822),  INT16_C(  3354), -INT16_C(  4686),  INT16_C( 15527),  INT16_C( 28860), -INT16_C( 17205),
+      -INT16_C( 16347),  INT16_C( 24280), -INT16_C( 23287),  INT16_C(  1440),  INT16_C( 22484),  INT16_C( 26476),  INT16_C( 32420), -INT16_C( 22553),
+       INT16_C( 18007), -INT16_C( 27349),  INT16_C( 17819),  INT16_C( 19874),  INT16_C( 18739), -INT16_C(  4214),  INT16_C( 21945), -INT16_C(  8533),
+      -INT16_C( 31979),  INT16_C(  7997), -INT16_C(  8920), -INT16_C(   988), -INT16_C( 28620), -INT16_C( 10140),  INT16_C( 19214),  INT16_C( 25983),
+      -INT16_C( 21615),  INT16_C( 11515), -INT16_C( 25104),  INT16_C(  9081),  INT16_C(   999), -INT16_C( 24558), -INT16_C( 17064),  INT16_C( 28287),
+      -INT16_C( 17343),  INT16_C( 27021), -INT16_C( 20071), -INT16_C( 12954), -INT16_C( 13759),  INT16_C( 20389),  INT16_C(  9237), -INT16_C( 22860),
+      -INT16_C( 20529), -INT16_C( 16174),  INT16_C( 19277),  INT16_C( 13539), -INT16_C(  2481), -INT16_C( 22572),  INT16_C( 21427), -INT16_C(  3051),
+      -INT16_C( 24049), -INT16_C( 22434), -INT16_C( 15277), -INT16_C( 27531),  INT16_C(  6798), -INT16_C( 23581), -INT16_C( 26561),  INT16_C(  3657),
+       INT16_C(  6983), -INT16_C( 27442), -INT16_C( 19866), -INT16_C( 19000), -INT16_C( 25176),  INT16_C( 23389),  INT16_C( 29424),  INT16_C(    80),
+      -INT16_C( 20971),  INT16_C( 26792),  INT16_C(  7794),  INT16_C(   253), -INT16_C(  8136),  INT16_C( 30627), -INT16_C(  5000), -INT16_C( 16250),
+       INT16_C( 21511),  INT16_C( 27988),  INT16_C(  7430), -INT16_C( 20957), -INT16_C( 32582), -INT16_C( 22006),  INT16_C( 23282),  INT16_C(  1962),
+       INT16_C( 21256),  INT16_C( 31344),  INT16_C( 28017), -INT16_C( 22150),  INT16_C(  7501), -INT16_C( 14815), -INT16_C( 22775),  INT16_C(  4230),
+      -INT16_C(  9477),  INT16_C(   637), -INT16_C( 24329), -INT16_C( 20048), -INT16_C( 17888),  INT16_C(  4956),  INT16_C(  1556),  INT16_C(  7194),
+      -INT16_C( 30119), -INT16_C( 13674),  INT16_C(  4343),  INT16_C( 17780), -INT16_C( 27347),  INT16_C( 13835), -INT16_C( 28356),  INT16_C( 14150),
+      -INT16_C( 15253),  INT16_C( 25401), -INT16_C(  5532), -INT16_C( 31468),  INT16_C( 28836), -INT16_C( 18024), -INT16_C( 19849), -INT16_C( 12075),
+       INT16_C( 27709),  INT16_C( 13467),  INT16_C(  3964), -INT16_C( 21895), -INT16_C( 31580), -INT16_C(  7968),  INT16_C( 10005), -INT16_C( 32489),
+       INT16_C( 20971),  INT16_C( 20452), -INT16_C(  1989), -INT16_C(  8236),  INT16_C( 27753), -INT16_C(  8040),  INT16_C( 28191),  INT16_C( 23728),
+       INT16_C( 19418),  INT16_C( 22160),  INT16_C(  2650), -INT16_C(   512), -INT16_C(  7794), -INT16_C( 23330), -INT16_C(  2552), -INT16_C(  3291),
+       INT16_C(  2375), -INT16_C( 32190),  INT16_C(  5889),  INT16_C( 27233), -INT16_C(  1405), -INT16_C( 23990), -INT16_C(  1176),  INT16_C( 17150),
+      -INT16_C( 28858), -INT16_C( 24168), -INT16_C( 26215),  INT16_C( 10143),  INT16_C( 32378), -INT16_C( 32053), -INT16_C(  3980), -INT16_C( 17547),
+      -INT16_C( 18439), -INT16_C(  1219), -INT16_C( 24882),  INT16_C( 21093), -INT16_C( 20328),  INT16_C(   244), -INT16_C(  3157), -INT16_C(  3774),
+      -INT16_C(  9342),  INT16_C(  7058),  INT16_C( 12916), -INT16_C(  4542),  INT16_C(  3760),  INT16_C(  9328), -INT16_C(  6658), -INT16_C(  1825),
+       INT16_C(  7324),  INT16_C( 27635),  INT16_C( 22714),  INT16_C( 21437), -INT16_C( 20216), -INT16_C( 19629), -INT16_C( 26972),  INT16_C(  9893),
+       INT16_C( 14193), -INT16_C(  6847), -INT16_C( 31639),  INT16_C(  6611),  INT16_C( 17298), -INT16_C( 28611),  INT16_C(  7208), -INT16_C( 15224),
+       INT16_C( 31544), -INT16_C(  3281), -INT16_C(  4908), -INT16_C(  9146), -INT16_C( 26210),  INT16_C( 17040),  INT16_C( 13615), -INT16_C( 24471),
+      -INT16_C( 21908), -INT16_C( 10619),  INT16_C( 22574), -INT16_C( 16145),  INT16_C( 11675), -INT16_C( 15535), -INT16_C(  9911), -INT16_C( 32120),
+      -INT16_C( 18603),  INT16_C( 10613), -INT16_C( 17500),  INT16_C( 16901), -INT16_C( 27308), -INT16_C( 31612), -INT16_C(  4662),  INT16_C( 14116),
+      -INT16_C( 21864), -INT16_C( 14835), -INT16_C(  1022), -INT16_C( 24953), -INT16_C( 10199),  INT16_C( 29537), -INT16_C(  5711),  INT16_C(  1781),
+       INT16_C( 27297),  INT16_C( 17711),  INT16_C( 13605),  INT16_C( 31111),  INT16_C(  3018), -INT16_C( 27139),  INT16_C(  8953), -INT16_C( 28212),
+      -INT16_C(  9780), -INT16_C( 12713), -INT16_C(  8491), -INT16_C(   148), -INT16_C( 12618),  INT16_C( 26738),  INT16_C( 26551),  INT16_C( 22638),
+      -INT16_C( 24879), -INT16_C(  2403),  INT16_C(  9427), -INT16_C( 25233),  INT16_C( 27952),  INT16_C( 10546), -INT16_C(   369),  INT16_C( 23482),
+       INT16_C(  4567), -INT16_C( 21207), -INT16_C( 26896), -INT16_C( 22868),  INT16_C(  7780),  INT16_C(  6926),  INT16_C( 32133),  INT16_C( 22132),
+       INT16_C(  4379), -INT16_C(  4532), -INT16_C( 17610),  INT16_C( 26251), -INT16_C( 16856), -INT16_C( 18545),  INT16_C( 18876), -INT16_C( 27630),
+       INT16_C( 15450),  INT16_C( 19009), -INT16_C(  4654),  INT16_C( 14065), -INT16_C(   245), -INT16_C( 28591), -INT16_C( 14980), -INT16_C( 26650),
+       INT16_C( 13015),  INT16_C(  3461),  INT16_C(  4589),  INT16_C(  5747),  INT16_C(   719), -INT16_C( 29747), -INT16_C(  8117), -INT16_C( 23265),
+       INT16_C( 24604), -INT16_C(  4368), -INT16_C(  7859),  INT16_C( 22564),  INT16_C( 30176),  INT16_C( 24040), -INT16_C( 12741),  INT16_C(  4852),
+       INT16_C( 31232), -INT16_C(  4577), -INT16_C( 28021),  INT16_C( 23044), -INT16_C( 11884), -INT16_C(  8219),  INT16_C(  1457), -INT16_C( 12924),
+       INT16_C( 29797), -INT16_C( 19525), -INT16_C(  8363),  INT16_C( 13835), -INT16_C(  2987), -INT16_C( 28525), -INT16_C( 30782), -INT16_C( 15454),
+      -INT16_C( 16127), -INT16_C( 29519), -INT16_C( 19117), -INT16_C(  6170), -INT16_C( 13178),  INT16_C( 14534),  INT16_C( 19153),  INT16_C( 13829),
+      -INT16_C( 15937),  INT16_C(  5353), -INT16_C(  2656), -INT16_C(  2742), -INT16_C(  8727), -INT16_C( 21627),  INT16_C( 10085),  INT16_C( 26222),
+       INT16_C(  8168),  INT16_C( 15347), -INT16_C(  9772),  INT16_C( 23330), -INT16_C(  5979),  INT16_C( 30355), -INT16_C( 26573), -INT16_C(  3411),
+      -INT16_C( 27047), -INT16_C(  1530),  INT16_C( 20875),  INT16_C( 29935),  INT16_C( 29998), -INT16_C( 27872), -INT16_C( 29028), -INT16_C( 31238),
+      -INT16_C(  4690), -INT16_C( 32064), -INT16_C(  7226),  INT16_C( 27869),  INT16_C( 28875), -INT16_C(   286), -INT16_C( 28919),  INT16_C( 25328),
+      -INT16_C(  2266), -INT16_C( 20132),  INT16_C( 19528),  INT16_C( 30246),  INT16_C( 18113),  INT16_C( 23818),  INT16_C(  1236), -INT16_C( 32030),
+      -INT16_C( 23567), -INT16_C( 18683), -INT16_C(  7546),  INT16_C( 20771),  INT16_C(  1619),  INT16_C( 23632),  INT16_C( 16533), -INT16_C( 17474),
+       INT16_C(  6967),  INT16_C( 32621), -INT16_C( 27801),  INT16_C( 10486),  INT16_C(   217), -INT16_C( 21115),  INT16_C( 26628), -INT16_C(  2768),
+       INT16_C( 13579), -INT16_C( 28244), -INT16_C( 12265),  INT16_C( 27362),  INT16_C( 13014),  INT16_C( 27590), -INT16_C( 31373), -INT16_C( 21977),
+      -INT16_C( 27488),  INT16_C(  1834),  INT16_C(  8231),  INT16_C(    47), -INT16_C( 19424),  INT16_C(  9389), -INT16_C(  8932),  INT16_C( 10009),
+      -INT16_C( 15086),  INT16_C( 10936), -INT16_C( 25707),  INT16_C( 27540),  INT16_C( 23501),  INT16_C( 16599), -INT16_C(   288), -INT16_C( 32533),
+       INT16_C(  5522), -INT16_C( 18041), -INT16_C( 18891),  INT16_C( 21945),  INT16_C( 26218), -INT16_C( 30855), -INT16_C( 28092),  INT16_C( 22190),
+       INT16_C( 26455), -INT16_C(  4736),  INT16_C(  5378), -INT16_C( 12456),  INT16_C( 12144),  INT16_C( 20496), -INT16_C(  1235), -INT16_C( 16432),
+       INT16_C( 22288),  INT16_C( 17784),  INT16_C( 12557),  INT16_C( 30618),  INT16_C(  5016), -INT16_C(  8962), -INT16_C( 21083) };
+  static const int16_t e =  INT16_C( 32621);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int16_t r = INT16_MIN;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    int16_t v = simde_svmaxv_s16(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_i16(e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)];
+  int16_t e = INT16_MIN;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    int16_t v = simde_svmaxv_s16(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    { -INT32_C(   462939345), -INT32_C(  1669097995),  INT32_C(  1285348951),  INT32_C(  1558877251), -INT32_C(  1129392702),  INT32_C(  1729255884),  INT32_C(  1416082669), -INT32_C(  1500566921),
+       INT32_C(   998963013), -INT32_C(   455668339),  INT32_C(   774927595), -INT32_C(   896853496), -INT32_C(  1131988497),  INT32_C(  2133039506), -INT32_C(   992769459), -INT32_C(    93690956),
+      -INT32_C(   415894438), -INT32_C(   305460223), -INT32_C(  1994654592),  INT32_C(   106145302),  INT32_C(  1908595423), -INT32_C(  1041177229),  INT32_C(   612746351), -INT32_C(  2128678873),
+      -INT32_C(   429304860), -INT32_C(   523029409),  INT32_C(  1198124592),  INT32_C(  1951251605),  INT32_C(   182849431),  INT32_C(  1674303220), -INT32_C(  1048096358),  INT32_C(   625190209),
+       INT32_C(  1477160184),  INT32_C(   288939744),  INT32_C(  1649975757), -INT32_C(   187259555), -INT32_C(  1459635020),  INT32_C(   755747475),  INT32_C(  1559204635),  INT32_C(   830616120),
+      -INT32_C(  1098281506),  INT32_C(   969916780), -INT32_C(  1080350878), -INT32_C(  2135658036), -INT32_C(  1054297298), -INT32_C(  1712442243), -INT32_C(      664121), -INT32_C(   315590897),
+       INT32_C(  1907144965), -INT32_C(   592807046),  INT32_C(  1872512419), -INT32_C(   454012746), -INT32_C(  2136664061),  INT32_C(   320443468), -INT32_C(  2129457295), -INT32_C(  1955708026),
+       INT32_C(  2013010685),  INT32_C(   961848982), -INT32_C(  1565986581),  INT32_C(  1132894272), -INT32_C(    37540687),  INT32_C(   823254464),  INT32_C(  1924277484),  INT32_C(  1694376295),
+      -INT32_C(   774047173), -INT32_C(  1945489247),  INT32_C(  1613673248), -INT32_C(    56380085), -INT32_C(  1577425183),  INT32_C(   802294595), -INT32_C(  1767733969), -INT32_C(   503603034),
+       INT32_C(  1001641882),  INT32_C(   667467015), -INT32_C(  1131940240), -INT32_C(  1934087509), -INT32_C(   735202672), -INT32_C(   335347523),  INT32_C(   730047877), -INT32_C(   536052155),
+       INT32_C(  1545322325), -INT32_C(   310123651), -INT32_C(  2052519206), -INT32_C(  1005428172), -INT32_C(   761774316), -INT32_C(   994141121), -INT32_C(  2014363327),  INT32_C(   342359231),
+       INT32_C(   946897595),  INT32_C(  1076294502),  INT32_C(   835047421),  INT32_C(  1190582065),  INT32_C(  1444449815),  INT32_C(  1813763626), -INT32_C(   671938024), -INT32_C(  1024697850),
+       INT32_C(  1123704028),  INT32_C(  1300373584),  INT32_C(   561989872),  INT32_C(   912749855),  INT32_C(   781025027),  INT32_C(  1855629398), -INT32_C(  1186624078), -INT32_C(  1015336473),
+      -INT32_C(   570002034), -INT32_C(  2043967338), -INT32_C(   257447216),  INT32_C(   589696799), -INT32_C(   464407666),  INT32_C(   240315227),  INT32_C(  1606916216),  INT32_C(  1461863113),
+       INT32_C(  1295329463), -INT32_C(  2116853327),  INT32_C(   728857355),  INT32_C(   407804042), -INT32_C(  1476550837),  INT32_C(    45436810), -INT32_C(  1319011097),  INT32_C(  1963492286),
+       INT32_C(  1573076652), -INT32_C(  1428253025), -INT32_C(  1680519151),  INT32_C(   867443688),  INT32_C(  1289400770), -INT32_C(   397504768), -INT32_C(   912675061), -INT32_C(   549478093),
+       INT32_C(  2117862111), -INT32_C(  1440146792),  INT32_C(  1380318826), -INT32_C(   460916446), -INT32_C(  1422827350), -INT32_C(    74219536),  INT32_C(  1657089071), -INT32_C(  1388247859),
+      -INT32_C(  1641317114),  INT32_C(    38294679),  INT32_C(  1968475731),  INT32_C(   844749447),  INT32_C(   735939131),  INT32_C(   958820362),  INT32_C(  1771826076), -INT32_C(   183051025),
+      -INT32_C(   258719143), -INT32_C(   369959786), -INT32_C(   228702358),  INT32_C(  1545910305),  INT32_C(  1283916098),  INT32_C(   226864753), -INT32_C(  1988747111),  INT32_C(  1434357244),
+       INT32_C(  1699091151),  INT32_C(  1498364143), -INT32_C(  1588875905), -INT32_C(  1459785883), -INT32_C(   504068752), -INT32_C(   856786381), -INT32_C(  1756011110), -INT32_C(  1041443598),
+      -INT32_C(   718916890), -INT32_C(   365988501), -INT32_C(  2004125149),  INT32_C(  1513130474),  INT32_C(  1094460686),  INT32_C(   957164191), -INT32_C(  2117049457),  INT32_C(   490913079),
+       INT32_C(  1525901807),  INT32_C(    21308126), -INT32_C(  2037722980),  INT32_C(  1742846553),  INT32_C(  2124946911), -INT32_C(   675760569),  INT32_C(  1347979289) };
+  static const int32_t e =  INT32_C(  2133039506);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t r = INT32_MIN;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    int32_t v = simde_svmaxv_s32(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_i32(e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)];
+  int32_t e = INT32_MIN;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    int32_t v = simde_svmaxv_s32(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1) };
+  static const int64_t a[] =
+    { -INT64_C( 3502100032018968025),  INT64_C( 4877413269858617299), -INT64_C( 2635127821193407952), -INT64_C( 3085868799216887721),
+      -INT64_C( 6179040018049479460),  INT64_C( 3419454770625639082), -INT64_C(  722012327238993686), -INT64_C( 2828153930889547459),
+       INT64_C( 5309329028246141997), -INT64_C( 7518778624053717640),  INT64_C( 4825800532016111462), -INT64_C( 4993104893306917663),
+      -INT64_C(  301058917167858455), -INT64_C( 6915811339500565310),  INT64_C( 5584635526660799545), -INT64_C( 9002450900661719607),
+      -INT64_C(  263496611432444198),  INT64_C( 2163541901077891627),  INT64_C( 1217902949324073517), -INT64_C( 3988088179845099383),
+      -INT64_C( 4721042815744429244), -INT64_C( 8842208360219220410),  INT64_C(  877082088101095125),  INT64_C( 5533752996568011285),
+      -INT64_C( 5558772984400121718), -INT64_C(  141537754497482964),  INT64_C( 4854394613095082190), -INT64_C( 1212573970905723176),
+       INT64_C( 7503532700906354434), -INT64_C(  788422237095133210),  INT64_C( 5228861064816830750), -INT64_C( 1403058297134065869),
+       INT64_C( 7129615455603037260), -INT64_C(  966161948612567686), -INT64_C( 5304731823606145367),  INT64_C( 3061275523592128933),
+      -INT64_C( 3798887089010649751), -INT64_C( 2069680859460552319), -INT64_C(  496700716824623646), -INT64_C( 6273792187766904346),
+      -INT64_C( 3966030499003129127),  INT64_C( 5235826434368168589), -INT64_C( 1641623627202976279), -INT64_C( 7198830541617053903),
+       INT64_C(  454506743037601088), -INT64_C( 5058256172808901858),  INT64_C( 8360700999542143515), -INT64_C( 7904665813856766483),
+      -INT64_C( 1504088144937938271),  INT64_C( 9104938569795956179),  INT64_C( 7813643648571822775), -INT64_C( 1063579241312136360),
+      -INT64_C( 7983988518633580934), -INT64_C( 7423181366470925543), -INT64_C( 7796574025373542431), -INT64_C( 3704636949064128171),
+      -INT64_C( 1720013526366117166), -INT64_C( 4223144014768679445),  INT64_C( 5604433934116321015),  INT64_C( 6051299133450487004),
+       INT64_C( 4819420426669330219), -INT64_C( 6988616134122649766), -INT64_C(  599375556532688791),  INT64_C( 6012058284694282396),
+      -INT64_C( 5564144182864555218), -INT64_C( 5566744593989314953), -INT64_C( 4382634488206487781), -INT64_C( 6855235704430046623),
+      -INT64_C( 3265973555239179614), -INT64_C( 6142998337760944956), -INT64_C(  853416103154429378), -INT64_C(  471933103175235487),
+       INT64_C( 5526655098680482181), -INT64_C( 8037771591576607941), -INT64_C( 4218995008923609621), -INT64_C( 3281422855340232410),
+       INT64_C( 4861745784018856357), -INT64_C( 2960691332696387065),  INT64_C( 2594295479119765463),  INT64_C( 5321311527496751290) };
+  static const int64_t e =  INT64_C( 6051299133450487004);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int64_t r = INT64_MIN;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    int64_t v = simde_svmaxv_s64(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_i64(e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)];
+  int64_t e = INT64_MIN;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    int64_t v = simde_svmaxv_s64(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C(127), UINT8_C(154), UINT8_C( 59), UINT8_C(129), UINT8_C( 67), UINT8_C( 34), UINT8_C(236), UINT8_C( 10),
+      UINT8_C( 95), UINT8_C(141), UINT8_C(241), UINT8_C(112), UINT8_C( 89), UINT8_C(167), UINT8_C(224), UINT8_C(181),
+      UINT8_C(171), UINT8_C(140), UINT8_C(119), UINT8_C( 62), UINT8_C(107), UINT8_C(211), UINT8_C(159), UINT8_C(178),
+      UINT8_C(214),    UINT8_MAX, UINT8_C(174), UINT8_C( 51), UINT8_C(181), UINT8_C( 71), UINT8_C( 15), UINT8_C( 52),
+      UINT8_C(225), UINT8_C( 75), UINT8_C(182), UINT8_C( 36), UINT8_C(109), UINT8_C(162), UINT8_C( 46), UINT8_C(204),
+      UINT8_C( 47), UINT8_C( 32), UINT8_C( 61), UINT8_C(136), UINT8_C(199), UINT8_C( 29), UINT8_C( 61), UINT8_C(114),
+      UINT8_C(169), UINT8_C(180), UINT8_C(177), UINT8_C( 20), UINT8_C(136), UINT8_C( 80), UINT8_C(198), UINT8_C( 94),
+      UINT8_C( 79), UINT8_C(117), UINT8_C(145), UINT8_C(  4), UINT8_C(188), UINT8_C(160), UINT8_C( 57), UINT8_C(157),
+      UINT8_C(235), UINT8_C(239), UINT8_C(194), UINT8_C( 89), UINT8_C(145), UINT8_C(240), UINT8_C( 37), UINT8_C(193),
+      UINT8_C( 16), UINT8_C( 98), UINT8_C( 73), UINT8_C(216), UINT8_C(127), UINT8_C(135), UINT8_C( 74), UINT8_C( 40),
+      UINT8_C( 59), UINT8_C(251), UINT8_C( 61), UINT8_C(195), UINT8_C( 75), UINT8_C(  3), UINT8_C( 33), UINT8_C(155),
+      UINT8_C(120), UINT8_C(178), UINT8_C(159), UINT8_C( 52), UINT8_C( 83), UINT8_C(216), UINT8_C(210), UINT8_C( 62),
+      UINT8_C(199), UINT8_C(148), UINT8_C(151), UINT8_C( 89), UINT8_C(132), UINT8_C(189), UINT8_C( 26), UINT8_C(149),
+      UINT8_C( 31), UINT8_C( 99), UINT8_C(109), UINT8_C(159), UINT8_C(234), UINT8_C(183), UINT8_C(199), UINT8_C( 38),
+      UINT8_C(179), UINT8_C(  4), UINT8_C(233), UINT8_C(254), UINT8_C(  8), UINT8_C( 11), UINT8_C(153), UINT8_C(128),
+      UINT8_C(189), UINT8_C( 57), UINT8_C(181), UINT8_C( 16), UINT8_C( 17), UINT8_C(135), UINT8_C( 79), UINT8_C(217),
+      UINT8_C( 27), UINT8_C(230), UINT8_C( 50), UINT8_C(159), UINT8_C(163), UINT8_C( 76), UINT8_C( 52), UINT8_C(195),
+      UINT8_C(175), UINT8_C(161), UINT8_C( 98), UINT8_C(154), UINT8_C( 89), UINT8_C( 41), UINT8_C(192), UINT8_C( 12),
+      UINT8_C( 46), UINT8_C(169), UINT8_C( 10), UINT8_C( 54), UINT8_C(180), UINT8_C(164), UINT8_C(182), UINT8_C(114),
+      UINT8_C(221), UINT8_C(107), UINT8_C(130), UINT8_C(238), UINT8_C(242), UINT8_C(209), UINT8_C(199), UINT8_C( 13),
+      UINT8_C(184), UINT8_C(249), UINT8_C(173), UINT8_C( 91), UINT8_C( 69), UINT8_C(225), UINT8_C( 30), UINT8_C(245),
+      UINT8_C(131), UINT8_C(128), UINT8_C(143), UINT8_C(220), UINT8_C(170), UINT8_C( 79), UINT8_C(232), UINT8_C(216),
+      UINT8_C(248), UINT8_C(242), UINT8_C( 14), UINT8_C(173), UINT8_C(150), UINT8_C(196), UINT8_C( 31), UINT8_C(115),
+      UINT8_C( 48), UINT8_C(161), UINT8_C( 98), UINT8_C( 34), UINT8_C(115), UINT8_C( 41), UINT8_C( 48), UINT8_C( 43),
+      UINT8_C( 35), UINT8_C(221), UINT8_C(134), UINT8_C(104), UINT8_C(190), UINT8_C(165), UINT8_C( 93), UINT8_C( 65),
+      UINT8_C( 37), UINT8_C(236), UINT8_C( 29), UINT8_C(207), UINT8_C( 59), UINT8_C(  5), UINT8_C(167), UINT8_C( 52),
+      UINT8_C(248), UINT8_C(181), UINT8_C(225), UINT8_C(142), UINT8_C(122), UINT8_C(  0), UINT8_C(  2), UINT8_C(170),
+      UINT8_C(161), UINT8_C(100), UINT8_C(204), UINT8_C( 20), UINT8_C(141), UINT8_C(252), UINT8_C( 63), UINT8_C(176),
+      UINT8_C(217), UINT8_C(198), UINT8_C( 25), UINT8_C(152), UINT8_C(107), UINT8_C(118), UINT8_C(217), UINT8_C(144),
+      UINT8_C( 99), UINT8_C(247), UINT8_C( 96), UINT8_C(158), UINT8_C(252), UINT8_C(  7), UINT8_C(210), UINT8_C(244),
+      UINT8_C(189), UINT8_C(179), UINT8_C(131), UINT8_C( 55), UINT8_C(179), UINT8_C(133), UINT8_C(225), UINT8_C( 85),
+      UINT8_C(233), UINT8_C(173), UINT8_C(105), UINT8_C(118), UINT8_C(170), UINT8_C(169), UINT8_C( 39), UINT8_C(131),
+      UINT8_C(111), UINT8_C( 64), UINT8_C( 27), UINT8_C(218), UINT8_C(182), UINT8_C(245), UINT8_C(106), UINT8_C( 25),
+      UINT8_C(236), UINT8_C(202), UINT8_C(184), UINT8_C(232), UINT8_C(210), UINT8_C(138), UINT8_C(221), UINT8_C(143),
+      UINT8_C( 62), UINT8_C( 96), UINT8_C(198), UINT8_C(241), UINT8_C(229), UINT8_C(167), UINT8_C( 70), UINT8_C(206),
+      UINT8_C( 84), UINT8_C(176), UINT8_C( 68), UINT8_C(254), UINT8_C( 89), UINT8_C(107), UINT8_C(130), UINT8_C(200),
+      UINT8_C(171), UINT8_C(157), UINT8_C(162), UINT8_C( 98), UINT8_C(146), UINT8_C( 12), UINT8_C(123), UINT8_C(126),
+      UINT8_C(215), UINT8_C( 51), UINT8_C(103), UINT8_C(169), UINT8_C(190), UINT8_C( 68), UINT8_C( 56), UINT8_C(252),
+      UINT8_C(164), UINT8_C(254), UINT8_C(237), UINT8_C(137), UINT8_C(165), UINT8_C( 52), UINT8_C( 87), UINT8_C(249),
+      UINT8_C(228), UINT8_C(155), UINT8_C(248), UINT8_C( 61), UINT8_C(  7), UINT8_C(122), UINT8_C(  5), UINT8_C(178),
+      UINT8_C( 23), UINT8_C(167), UINT8_C( 20), UINT8_C(170), UINT8_C(179), UINT8_C(144), UINT8_C( 40), UINT8_C(138),
+      UINT8_C(195), UINT8_C(143), UINT8_C( 51), UINT8_C(129), UINT8_C(211), UINT8_C(107), UINT8_C(125), UINT8_C(119),
+      UINT8_C(105), UINT8_C(107), UINT8_C(  0), UINT8_C( 14), UINT8_C(159), UINT8_C( 87), UINT8_C(  8), UINT8_C(131),
+      UINT8_C(243), UINT8_C(  0), UINT8_C(192), UINT8_C(250), UINT8_C(122), UINT8_C(197), UINT8_C(172), UINT8_C(145),
+      UINT8_C(108), UINT8_C(193), UINT8_C( 59), UINT8_C( 31), UINT8_C( 81), UINT8_C(100), UINT8_C(170), UINT8_C( 20),
+      UINT8_C(243), UINT8_C(221), UINT8_C(150), UINT8_C(199), UINT8_C( 73), UINT8_C( 19), UINT8_C( 62), UINT8_C(178),
+      UINT8_C(126), UINT8_C( 63), UINT8_C(193), UINT8_C( 29), UINT8_C(150), UINT8_C(201), UINT8_C(160), UINT8_C(137),
+      UINT8_C(201), UINT8_C( 96), UINT8_C(131), UINT8_C( 67), UINT8_C( 37), UINT8_C( 48), UINT8_C(212), UINT8_C(145),
+      UINT8_C(241), UINT8_C( 16), UINT8_C(177), UINT8_C( 66), UINT8_C(116), UINT8_C( 91), UINT8_C( 86), UINT8_C(103),
+      UINT8_C( 56), UINT8_C(236), UINT8_C( 46), UINT8_C(129), UINT8_C(  0), UINT8_C(109), UINT8_C( 52), UINT8_C(126),
+      UINT8_C(172), UINT8_C(245), UINT8_C(156), UINT8_C( 66), UINT8_C(190), UINT8_C( 60), UINT8_C(204), UINT8_C(135),
+      UINT8_C(157), UINT8_C( 79), UINT8_C(202), UINT8_C(194), UINT8_C(127), UINT8_C(158), UINT8_C( 84), UINT8_C(112),
+      UINT8_C(174), UINT8_C(  5), UINT8_C(178), UINT8_C( 34), UINT8_C( 96), UINT8_C(  9), UINT8_C(138), UINT8_C(152),
+      UINT8_C(245), UINT8_C(184), UINT8_C( 26), UINT8_C(245), UINT8_C( 37), UINT8_C( 78), UINT8_C(116), UINT8_C(209),
+      UINT8_C( 67), UINT8_C( 16), UINT8_C( 20), UINT8_C(  1), UINT8_C( 76), UINT8_C(224), UINT8_C(136), UINT8_C(233),
+      UINT8_C( 47), UINT8_C( 82), UINT8_C(172), UINT8_C(175), UINT8_C(240), UINT8_C(  0), UINT8_C( 31), UINT8_C(159),
+      UINT8_C(  5), UINT8_C(210), UINT8_C(193), UINT8_C(101), UINT8_C(219), UINT8_C( 75), UINT8_C(253), UINT8_C(208),
+      UINT8_C(  4), UINT8_C( 23), UINT8_C(198), UINT8_C( 41), UINT8_C(101), UINT8_C( 58), UINT8_C(251), UINT8_C(168),
+      UINT8_C( 74), UINT8_C( 15), UINT8_C(169), UINT8_C(150), UINT8_C(239), UINT8_C( 49), UINT8_C(128), UINT8_C( 30),
+      UINT8_C(131), UINT8_C( 44), UINT8_C(205), UINT8_C(116), UINT8_C( 44), UINT8_C(237), UINT8_C( 19), UINT8_C( 49),
+      UINT8_C(191), UINT8_C(212), UINT8_C(150), UINT8_C(154), UINT8_C( 32), UINT8_C(147), UINT8_C(106), UINT8_C( 36),
+      UINT8_C(171), UINT8_C( 48), UINT8_C( 77), UINT8_C( 16), UINT8_C(106), UINT8_C( 72), UINT8_C(185), UINT8_C(180),
+      UINT8_C( 87), UINT8_C( 98), UINT8_C( 75), UINT8_C( 70), UINT8_C(148), UINT8_C(203), UINT8_C(101), UINT8_C( 23),
+      UINT8_C(247), UINT8_C( 50), UINT8_C(139), UINT8_C( 35), UINT8_C( 31), UINT8_C(158), UINT8_C( 84), UINT8_C(222),
+      UINT8_C(115), UINT8_C(234), UINT8_C(120), UINT8_C(147), UINT8_C(125), UINT8_C(227), UINT8_C(183), UINT8_C( 40),
+      UINT8_C( 19), UINT8_C(  4), UINT8_C( 57), UINT8_C(126), UINT8_C( 77), UINT8_C(242), UINT8_C( 50), UINT8_C(164),
+      UINT8_C( 84), UINT8_C(125), UINT8_C(235), UINT8_C(232), UINT8_C( 72), UINT8_C( 80), UINT8_C(  0), UINT8_C( 63),
+      UINT8_C(130), UINT8_C(139), UINT8_C( 98), UINT8_C(162), UINT8_C( 42), UINT8_C(182), UINT8_C(128), UINT8_C(157),
+      UINT8_C(160), UINT8_C(249), UINT8_C( 48), UINT8_C( 30), UINT8_C(220), UINT8_C(231), UINT8_C( 70), UINT8_C(239),
+      UINT8_C(235), UINT8_C(127), UINT8_C(109), UINT8_C( 56), UINT8_C(113), UINT8_C(160), UINT8_C(221), UINT8_C(198),
+      UINT8_C( 29), UINT8_C(200), UINT8_C(174), UINT8_C(102), UINT8_C( 24), UINT8_C(174), UINT8_C(165), UINT8_C(154),
+      UINT8_C( 58), UINT8_C(  8), UINT8_C( 60), UINT8_C(100), UINT8_C(190), UINT8_C(189), UINT8_C(  1), UINT8_C( 95),
+      UINT8_C(182), UINT8_C( 49), UINT8_C(125), UINT8_C(146), UINT8_C( 24), UINT8_C(195), UINT8_C(129), UINT8_C(  3),
+      UINT8_C( 67), UINT8_C(239), UINT8_C( 60), UINT8_C(180), UINT8_C(143), UINT8_C( 25), UINT8_C(122), UINT8_C(172),
+      UINT8_C(225), UINT8_C( 41), UINT8_C( 18), UINT8_C(249), UINT8_C(215), UINT8_C(184), UINT8_C(147), UINT8_C( 17),
+      UINT8_C(192), UINT8_C(208), UINT8_C(117), UINT8_C(126), UINT8_C(141), UINT8_C(118), UINT8_C(221), UINT8_C( 67),
+      UINT8_C(167), UINT8_C( 90), UINT8_C(213), UINT8_C(191), UINT8_C( 30), UINT8_C( 86), UINT8_C(195), UINT8_C( 97),
+      UINT8_C( 69),    UINT8_MAX, UINT8_C( 21), UINT8_C(212), UINT8_C( 24), UINT8_C(144), UINT8_C(129), UINT8_C(249),
+      UINT8_C(185), UINT8_C(147), UINT8_C(242), UINT8_C(144), UINT8_C( 75), UINT8_C(133), UINT8_C(162), UINT8_C( 11),
+      UINT8_C( 85), UINT8_C( 23), UINT8_C(138), UINT8_C(226), UINT8_C(142), UINT8_C(103), UINT8_C( 37), UINT8_C( 53),
+      UINT8_C(194), UINT8_C(250), UINT8_C(245), UINT8_C(224), UINT8_C( 81), UINT8_C(184), UINT8_C( 65), UINT8_C(150),
+      UINT8_C(183), UINT8_C( 86), UINT8_C(107), UINT8_C(207), UINT8_C(230), UINT8_C(236), UINT8_C(200), UINT8_C(159),
+      UINT8_C(127), UINT8_C(186), UINT8_C( 48), UINT8_C(203), UINT8_C( 63), UINT8_C(210), UINT8_C(214), UINT8_C(149),
+      UINT8_C(233), UINT8_C( 96), UINT8_C(119), UINT8_C(119), UINT8_C(200), UINT8_C(157), UINT8_C(173), UINT8_C(138),
+      UINT8_C(151), UINT8_C(162), UINT8_C(106), UINT8_C(232), UINT8_C( 90), UINT8_C(171), UINT8_C(127), UINT8_C( 17),
+      UINT8_C(  1), UINT8_C(234), UINT8_C(224), UINT8_C(232), UINT8_C(214), UINT8_C(168), UINT8_C(135), UINT8_C( 85),
+      UINT8_C( 98), UINT8_C(183), UINT8_C( 32), UINT8_C(161), UINT8_C(137), UINT8_C(247), UINT8_C( 54), UINT8_C(115),
+      UINT8_C( 87), UINT8_C(174), UINT8_C(234), UINT8_C( 31), UINT8_C( 75), UINT8_C(151), UINT8_C(169), UINT8_C(226),
+      UINT8_C( 57), UINT8_C( 19), UINT8_C(203), UINT8_C(147), UINT8_C(190), UINT8_C( 74), UINT8_C(164), UINT8_C(192),
+      UINT8_C( 52), UINT8_C(132), UINT8_C(168), UINT8_C( 10), UINT8_C( 44), UINT8_C( 47), UINT8_C( 95), UINT8_C(142),
+      UINT8_C(231), UINT8_C(128), UINT8_C( 48), UINT8_C(112), UINT8_C(119), UINT8_C(102), UINT8_C(227), UINT8_C(206),
+      UINT8_C( 20), UINT8_C(206), UINT8_C(238), UINT8_C( 95), UINT8_C(101), UINT8_C(151), UINT8_C( 66), UINT8_C(159),
+      UINT8_C(171), UINT8_C( 13), UINT8_C( 50), UINT8_C(105), UINT8_C( 87), UINT8_C(215), UINT8_C( 41), UINT8_C(139),
+      UINT8_C( 91), UINT8_C(209), UINT8_C(149), UINT8_C(136), UINT8_C(  1), UINT8_C(244), UINT8_C( 22), UINT8_C(232),
+      UINT8_C(116), UINT8_C( 70), UINT8_C( 88), UINT8_C(235), UINT8_C(173), UINT8_C( 60), UINT8_C(186), UINT8_C(193),
+      UINT8_C( 10), UINT8_C(168), UINT8_C( 33), UINT8_C(111), UINT8_C( 63), UINT8_C( 99), UINT8_C( 14), UINT8_C(234),
+      UINT8_C(112), UINT8_C( 65), UINT8_C( 84), UINT8_C(199), UINT8_C( 24), UINT8_C(125), UINT8_C( 82), UINT8_C(115),
+      UINT8_C( 79), UINT8_C(231), UINT8_C(251), UINT8_C( 80), UINT8_C(219), UINT8_C( 18), UINT8_C( 56), UINT8_C( 80),
+      UINT8_C( 88), UINT8_C(144), UINT8_C( 59), UINT8_C(  5), UINT8_C(204), UINT8_C(245), UINT8_C(199), UINT8_C(214),
+      UINT8_C(157), UINT8_C(232), UINT8_C( 70), UINT8_C(221), UINT8_C( 75), UINT8_C( 84), UINT8_C(199), UINT8_C(187),
+      UINT8_C(149), UINT8_C( 27), UINT8_C(130) };
+  static const uint8_t e = UINT8_C(254);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint8_t r = UINT8_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    uint8_t v = simde_svmaxv_u8(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_u8(e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024];
+  uint8_t e = UINT8_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    uint8_t v = simde_svmaxv_u8(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(57431), UINT16_C(27909), UINT16_C(63128), UINT16_C( 5531), UINT16_C(60391), UINT16_C(16445), UINT16_C(51601), UINT16_C( 1478),
+      UINT16_C(42392), UINT16_C(52884), UINT16_C(20717), UINT16_C(57378), UINT16_C(31191), UINT16_C(52218), UINT16_C(45225), UINT16_C(   32),
+      UINT16_C( 9872), UINT16_C(10350), UINT16_C( 2332), UINT16_C(  829), UINT16_C(31733), UINT16_C(34372), UINT16_C( 2628), UINT16_C(56459),
+      UINT16_C( 8112), UINT16_C(40363), UINT16_C(52592), UINT16_C(18302), UINT16_C(30790), UINT16_C(61458), UINT16_C(12840), UINT16_C(47344),
+      UINT16_C(24152), UINT16_C(30177), UINT16_C( 7784), UINT16_C(23928), UINT16_C(48281), UINT16_C(57059), UINT16_C(28359), UINT16_C(30650),
+      UINT16_C(25997), UINT16_C(64788), UINT16_C(37426), UINT16_C(31044), UINT16_C(22027), UINT16_C(13161), UINT16_C(22921), UINT16_C(57836),
+      UINT16_C(52664), UINT16_C( 8278), UINT16_C(53227), UINT16_C(34173), UINT16_C(24715), UINT16_C(21091), UINT16_C( 7630), UINT16_C(23497),
+      UINT16_C(56963), UINT16_C(46425), UINT16_C(40304), UINT16_C(31534), UINT16_C(38900), UINT16_C(32175), UINT16_C(39921), UINT16_C(43358),
+      UINT16_C(46440), UINT16_C(21449), UINT16_C(18052), UINT16_C( 4056), UINT16_C(15270), UINT16_C(29794), UINT16_C(11097), UINT16_C(56527),
+      UINT16_C(10249), UINT16_C(31377), UINT16_C(49350), UINT16_C(47861), UINT16_C(42071), UINT16_C(18487), UINT16_C(38207), UINT16_C(42993),
+      UINT16_C(47690), UINT16_C(52987), UINT16_C(54016), UINT16_C(42718), UINT16_C(16399), UINT16_C(26650), UINT16_C(60011), UINT16_C(30020),
+      UINT16_C(54546), UINT16_C(55535), UINT16_C(58517), UINT16_C(60818), UINT16_C(51593), UINT16_C(51253), UINT16_C(10079), UINT16_C(43376),
+      UINT16_C(27617), UINT16_C(57976), UINT16_C(22078), UINT16_C(19848), UINT16_C(41878), UINT16_C(  437), UINT16_C(63885), UINT16_C(40822),
+      UINT16_C(26063), UINT16_C(25720), UINT16_C( 2634), UINT16_C(54097), UINT16_C(34772), UINT16_C(13211), UINT16_C( 2990), UINT16_C(36828),
+      UINT16_C(21622), UINT16_C(46449), UINT16_C(64170), UINT16_C(16386), UINT16_C(47261), UINT16_C(10818), UINT16_C(47281), UINT16_C(32969),
+      UINT16_C(16670), UINT16_C(26853), UINT16_C(13900), UINT16_C( 8251), UINT16_C(54973), UINT16_C(27475), UINT16_C(12258), UINT16_C(22779),
+      UINT16_C(27780), UINT16_C(11789), UINT16_C( 4198), UINT16_C(  879), UINT16_C(45512), UINT16_C(31021), UINT16_C(63337), UINT16_C(34810),
+      UINT16_C(57144), UINT16_C(34031), UINT16_C(10773), UINT16_C(54180), UINT16_C(63233), UINT16_C(58174), UINT16_C(14631), UINT16_C(43835),
+      UINT16_C(18854), UINT16_C( 3289), UINT16_C(18521), UINT16_C( 8464), UINT16_C(15865), UINT16_C(25498), UINT16_C(37940), UINT16_C(28138),
+      UINT16_C(55923), UINT16_C(35313), UINT16_C(38404), UINT16_C( 1372), UINT16_C(39565), UINT16_C(46312), UINT16_C( 9428), UINT16_C(31327),
+      UINT16_C(14701), UINT16_C(50822), UINT16_C(38529), UINT16_C(31719), UINT16_C(33236), UINT16_C( 2270), UINT16_C(51222), UINT16_C(35189),
+      UINT16_C(26530), UINT16_C(42770), UINT16_C(28413), UINT16_C(35500), UINT16_C(38153), UINT16_C(56639), UINT16_C(40633), UINT16_C( 9815),
+      UINT16_C(56791), UINT16_C(23020), UINT16_C(54132), UINT16_C(18644), UINT16_C(45652), UINT16_C(27216), UINT16_C(50810), UINT16_C( 7668),
+      UINT16_C( 1581), UINT16_C(10948), UINT16_C(28789), UINT16_C(32436), UINT16_C(62213), UINT16_C(48731), UINT16_C(45714), UINT16_C(27108),
+      UINT16_C(53391), UINT16_C(  962), UINT16_C(38563), UINT16_C(63563), UINT16_C(40008), UINT16_C(50018), UINT16_C(22114), UINT16_C(36832),
+      UINT16_C(42077), UINT16_C(53945), UINT16_C(27924), UINT16_C( 6736), UINT16_C(43873), UINT16_C(62424), UINT16_C(48477), UINT16_C(60508),
+      UINT16_C( 8077), UINT16_C(12784), UINT16_C(15285), UINT16_C(65065), UINT16_C(35799), UINT16_C(14785), UINT16_C(41442), UINT16_C(16328),
+      UINT16_C(33093), UINT16_C(22801), UINT16_C(25071), UINT16_C(20595), UINT16_C(19468), UINT16_C(26947), UINT16_C(40713), UINT16_C(38485),
+      UINT16_C(17854), UINT16_C(29895), UINT16_C(61569), UINT16_C(22642), UINT16_C(13180), UINT16_C(24210), UINT16_C(23252), UINT16_C( 6557),
+      UINT16_C(44764), UINT16_C(52082), UINT16_C(58895), UINT16_C( 6939), UINT16_C(24114), UINT16_C(15236), UINT16_C(55805), UINT16_C(48337),
+      UINT16_C(39199), UINT16_C(41008), UINT16_C(41609), UINT16_C( 1528), UINT16_C(35541), UINT16_C(43363), UINT16_C(  229), UINT16_C(49602),
+      UINT16_C(13486), UINT16_C(48524), UINT16_C(42778), UINT16_C(19672), UINT16_C(23557), UINT16_C(  647), UINT16_C(22838), UINT16_C(21950),
+      UINT16_C(61170), UINT16_C(31733), UINT16_C(60816), UINT16_C(25985), UINT16_C(58488), UINT16_C(23822), UINT16_C(53477), UINT16_C(37662),
+      UINT16_C(43525), UINT16_C( 8017), UINT16_C(10577), UINT16_C(22124), UINT16_C(62342), UINT16_C(48216), UINT16_C( 5964), UINT16_C(15889),
+      UINT16_C( 1541), UINT16_C(38586), UINT16_C(15347), UINT16_C(27643), UINT16_C( 2591), UINT16_C( 1224), UINT16_C(59098), UINT16_C(57240),
+      UINT16_C(59792), UINT16_C(57855), UINT16_C(27410), UINT16_C(38967), UINT16_C(36958), UINT16_C(43860), UINT16_C(26023), UINT16_C(44265),
+      UINT16_C(41835), UINT16_C(24386), UINT16_C(16094), UINT16_C(65226), UINT16_C(37704), UINT16_C( 8706), UINT16_C(39545), UINT16_C( 2562),
+      UINT16_C(  387), UINT16_C(38635), UINT16_C( 9068), UINT16_C(51758), UINT16_C(33715), UINT16_C(23157), UINT16_C(24552), UINT16_C(21510),
+      UINT16_C(18690), UINT16_C(57779), UINT16_C(32135), UINT16_C(53215), UINT16_C(57616), UINT16_C(35569), UINT16_C(62332), UINT16_C(65428),
+      UINT16_C(32756), UINT16_C(24725), UINT16_C(50338), UINT16_C(21803), UINT16_C(41031), UINT16_C(12207), UINT16_C(46847), UINT16_C(  643),
+      UINT16_C(14079), UINT16_C(34531), UINT16_C(49844), UINT16_C(50261), UINT16_C(18083), UINT16_C( 8014), UINT16_C(57914), UINT16_C(11807),
+      UINT16_C(46178), UINT16_C( 1167), UINT16_C(47736), UINT16_C(48986), UINT16_C( 2394), UINT16_C(23279), UINT16_C(29375), UINT16_C(48732) };
+  static const uint16_t e = UINT16_C(65428);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint16_t r = UINT16_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    uint16_t v = simde_svmaxv_u16(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_u16(e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)];
+  uint16_t e = UINT16_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    uint16_t v = simde_svmaxv_u16(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(3188726410), UINT32_C(1834186542), UINT32_C(1923565156), UINT32_C(2906088805), UINT32_C( 839000833), UINT32_C( 931836492), UINT32_C( 869351341), UINT32_C(2944472100),
+      UINT32_C(1567461679), UINT32_C(1825226760), UINT32_C(1809805830), UINT32_C(3625522903), UINT32_C(2232032057), UINT32_C(2059179213), UINT32_C(4172123603), UINT32_C(3517394594),
+      UINT32_C(3358463167), UINT32_C(3677681876), UINT32_C(1095111530), UINT32_C(1645829929), UINT32_C(1206395770), UINT32_C(2344723639), UINT32_C(3565383218), UINT32_C(1554328220),
+      UINT32_C( 304403262), UINT32_C( 921524427), UINT32_C(2507617388), UINT32_C( 251171219), UINT32_C(1817567412), UINT32_C(3069646724), UINT32_C( 579500677), UINT32_C(3799920548),
+      UINT32_C(3472138754), UINT32_C(1711596282), UINT32_C(2851896086), UINT32_C(3250058252), UINT32_C(1479347668), UINT32_C(2836341796), UINT32_C(1120639390), UINT32_C(3408153033),
+      UINT32_C(3868793067), UINT32_C( 273456634), UINT32_C( 632965145), UINT32_C( 283537724), UINT32_C(2724795262), UINT32_C(3578558519), UINT32_C(3658946321), UINT32_C(1285962593),
+      UINT32_C(1311915860), UINT32_C(4133453789), UINT32_C(  68884935), UINT32_C( 152306314), UINT32_C(1303084309), UINT32_C( 119732213), UINT32_C(1893808655), UINT32_C(3384575861),
+      UINT32_C(2753097671), UINT32_C( 899315566), UINT32_C( 439989648), UINT32_C(3441643191), UINT32_C(3239759819), UINT32_C(3586669766), UINT32_C(3963988342), UINT32_C(4172612145),
+      UINT32_C(1604111857), UINT32_C(3566483012), UINT32_C(2750402283), UINT32_C(3882881564), UINT32_C(2829617889), UINT32_C(1031631046), UINT32_C(1261028122), UINT32_C(3057901253),
+      UINT32_C(4027965356), UINT32_C(  12953877), UINT32_C(2476979319), UINT32_C(2826638278), UINT32_C(1682973597), UINT32_C(2929839508), UINT32_C(1442433680), UINT32_C(1410022568),
+      UINT32_C( 809836571), UINT32_C(1093667530), UINT32_C(2228606142), UINT32_C(2234274023), UINT32_C( 132742259), UINT32_C(3669330506), UINT32_C(4231048788), UINT32_C(  89209834),
+      UINT32_C( 641046108), UINT32_C(1583834784), UINT32_C( 568474682), UINT32_C(  10882956), UINT32_C(3574042507), UINT32_C(1840299289), UINT32_C(1449844843), UINT32_C(2002500379),
+      UINT32_C(4053635409), UINT32_C( 827262455), UINT32_C(3461493057), UINT32_C(3436116288), UINT32_C(2728514952), UINT32_C(4262416786), UINT32_C(1297381681), UINT32_C(2244259636),
+      UINT32_C( 930505280), UINT32_C(2825438567), UINT32_C( 930528247), UINT32_C(1006847156), UINT32_C(2900272410), UINT32_C( 682290934), UINT32_C(2624978535), UINT32_C(3995154862),
+      UINT32_C(  36083867), UINT32_C(1420529245), UINT32_C(4253819209), UINT32_C(2151321446), UINT32_C( 724310068), UINT32_C(1850988294), UINT32_C(2198522069), UINT32_C(2641505025),
+      UINT32_C( 564107459), UINT32_C(1886734886), UINT32_C(3530359148), UINT32_C(3310528401), UINT32_C(3337649856), UINT32_C( 724845397), UINT32_C( 229522955), UINT32_C( 766124138),
+      UINT32_C(3746449848), UINT32_C(   5227668), UINT32_C(1456651461), UINT32_C( 605824100), UINT32_C(4176088226), UINT32_C(1529028432), UINT32_C(3345535325), UINT32_C(2868187890),
+      UINT32_C(4035527516), UINT32_C(3455113223), UINT32_C(4179870357), UINT32_C(2283618278), UINT32_C(2625636172), UINT32_C(2230821670), UINT32_C(1732993141), UINT32_C(3457237106),
+      UINT32_C(2344524676), UINT32_C( 140029555), UINT32_C(1442937968), UINT32_C( 132062907), UINT32_C(1285775142), UINT32_C(2026937091), UINT32_C(1843338491), UINT32_C(3762090076),
+      UINT32_C(4285332107), UINT32_C( 419939497), UINT32_C(4235200832), UINT32_C(1292062503), UINT32_C(2979702702), UINT32_C(1026124354), UINT32_C(3819571334), UINT32_C(2227431161),
+      UINT32_C(2323853281), UINT32_C( 883133428), UINT32_C(3140490132), UINT32_C( 285815906), UINT32_C( 499295195), UINT32_C(2488986637), UINT32_C(3984000244), UINT32_C(3430038251),
+      UINT32_C(1582757226), UINT32_C( 345176448), UINT32_C(1875952397), UINT32_C(3531659767), UINT32_C(2314158972), UINT32_C( 589121839), UINT32_C( 940676173), UINT32_C( 956597199),
+      UINT32_C(4187445880), UINT32_C(1628252500), UINT32_C(3822116332), UINT32_C( 850743734) };
+  static const uint32_t e = UINT32_C(4235200832);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint32_t r = UINT32_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    uint32_t v = simde_svmaxv_u32(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_u32(e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)];
+  uint32_t e = UINT32_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    uint32_t v = simde_svmaxv_u32(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C(10070856772125567968), UINT64_C(10422991916920916471), UINT64_C(10019332993166143104), UINT64_C( 1074646370678269593),
+      UINT64_C( 2305902560905808789), UINT64_C( 4502639469931845375), UINT64_C(17029255142547292548), UINT64_C( 4842220269858440695),
+      UINT64_C(16040054813521127504), UINT64_C(11784308475214596495), UINT64_C(11026995110317232327), UINT64_C( 8608896937938002566),
+      UINT64_C( 8671269768397861274), UINT64_C( 3374972275412770835), UINT64_C(10023411900945613792), UINT64_C( 7282664519560649074),
+      UINT64_C(11442297051276968553), UINT64_C(13901107783498043476), UINT64_C(17688270733182055402), UINT64_C(15809219577961724213),
+      UINT64_C(14685669345412924067), UINT64_C( 3398652312246722186), UINT64_C(18238619476832382115), UINT64_C(17230317304047053776),
+      UINT64_C(15125035084905598116), UINT64_C( 9294698308796378249), UINT64_C( 9410205113985211090), UINT64_C(11144969777221768302),
+      UINT64_C( 4343330085721720879), UINT64_C(13431150160558850568), UINT64_C( 4491755481208196130), UINT64_C( 3102878972987906687),
+      UINT64_C( 7520139877835457900), UINT64_C(10379587052597241449), UINT64_C(14541482501733572543), UINT64_C(15419003965588555475),
+      UINT64_C(17139663906893306899), UINT64_C(11292013950079478199), UINT64_C(11942975371779709353), UINT64_C( 6772691778915335358),
+      UINT64_C(18049490812769726987), UINT64_C(12560210626927966934), UINT64_C( 3415240834598205934), UINT64_C( 6125551118460639835),
+      UINT64_C( 6161874816063558470), UINT64_C( 7479729634343953178), UINT64_C( 3058381538957225936), UINT64_C( 7063564086261303399),
+      UINT64_C( 7240220615677569701), UINT64_C(12173881633719681554), UINT64_C( 1132756085794020031), UINT64_C(18348164443508082467),
+      UINT64_C(  891604952506666160), UINT64_C(17483125709254156831), UINT64_C(  602419007642962596), UINT64_C(10599477785095773376),
+      UINT64_C(17833108663327144820), UINT64_C( 4752861782474625743), UINT64_C( 7927999656843113752), UINT64_C(12140753745089088518),
+      UINT64_C(14387192077154192090), UINT64_C( 4576429242883610788), UINT64_C(18397278118818352948), UINT64_C( 5866893405130905486),
+      UINT64_C(13343511574091170415), UINT64_C(16837688750514042693), UINT64_C(13295500390063400843), UINT64_C( 4592518027848412147),
+      UINT64_C(12841683854706458473), UINT64_C( 4065001881382826186), UINT64_C( 4869024863152256177), UINT64_C( 6753825990451727787),
+      UINT64_C(18250574928197345320), UINT64_C(16151849107638216257), UINT64_C(14892644352999023130), UINT64_C(16909895933469743707),
+      UINT64_C(15678375656679245412), UINT64_C( 1170353120560484397), UINT64_C(11583301422971287759), UINT64_C( 8155626456491166081),
+      UINT64_C(11642540011840646434), UINT64_C( 1635716264250726829), UINT64_C(15355524669613026611), UINT64_C(14289999291578058961),
+      UINT64_C(11676165829140896244), UINT64_C( 8559364061454993515), UINT64_C( 7588010773627981861), UINT64_C(11635781558598133520),
+      UINT64_C( 8613719278652946930), UINT64_C(17137869799920619292), UINT64_C(15835419124771046337), UINT64_C(10838767531574889244),
+      UINT64_C(11926947473395643650), UINT64_C( 6957174803971485399), UINT64_C(14214340816448123805), UINT64_C(15979048396640998022),
+      UINT64_C( 2062490600223751792) };
+  static const uint64_t e = UINT64_C(18397278118818352948);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_C(0);
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    uint64_t v = simde_svmaxv_u64(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_u64(e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)];
+  uint64_t e = UINT64_C(0);
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    uint64_t v = simde_svmaxv_u64(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   381.14), SIMDE_FLOAT32_C(   -69.12), SIMDE_FLOAT32_C(   115.34), SIMDE_FLOAT32_C(   936.75),
+      SIMDE_FLOAT32_C(   774.93), SIMDE_FLOAT32_C(   715.84), SIMDE_FLOAT32_C(   -80.59), SIMDE_FLOAT32_C(  -940.86),
+      SIMDE_FLOAT32_C(    43.11), SIMDE_FLOAT32_C(  -524.10), SIMDE_FLOAT32_C(   444.66), SIMDE_FLOAT32_C(    71.07),
+      SIMDE_FLOAT32_C(  -108.82), SIMDE_FLOAT32_C(   877.43), SIMDE_FLOAT32_C(  -823.04), SIMDE_FLOAT32_C(   -68.89),
+      SIMDE_FLOAT32_C(  -907.11), SIMDE_FLOAT32_C(  -785.75), SIMDE_FLOAT32_C(  -133.23), SIMDE_FLOAT32_C(   925.08),
+      SIMDE_FLOAT32_C(  -773.08), SIMDE_FLOAT32_C(   -80.74), SIMDE_FLOAT32_C(   955.12), SIMDE_FLOAT32_C(  -146.19),
+      SIMDE_FLOAT32_C(   730.67), SIMDE_FLOAT32_C(   563.37), SIMDE_FLOAT32_C(  -585.55), SIMDE_FLOAT32_C(   353.69),
+      SIMDE_FLOAT32_C(  -410.58), SIMDE_FLOAT32_C(   483.59), SIMDE_FLOAT32_C(  -221.08), SIMDE_FLOAT32_C(   970.56),
+      SIMDE_FLOAT32_C(  -585.53), SIMDE_FLOAT32_C(   894.26), SIMDE_FLOAT32_C(   907.32), SIMDE_FLOAT32_C(  -810.61),
+      SIMDE_FLOAT32_C(   610.10), SIMDE_FLOAT32_C(  -173.28), SIMDE_FLOAT32_C(  -751.46), SIMDE_FLOAT32_C(  -346.79),
+      SIMDE_FLOAT32_C(   302.62), SIMDE_FLOAT32_C(   693.20), SIMDE_FLOAT32_C(   724.27), SIMDE_FLOAT32_C(  -806.20),
+      SIMDE_FLOAT32_C(   570.62), SIMDE_FLOAT32_C(   901.23), SIMDE_FLOAT32_C(   124.91), SIMDE_FLOAT32_C(   663.52),
+      SIMDE_FLOAT32_C(  -884.52), SIMDE_FLOAT32_C(   991.68), SIMDE_FLOAT32_C(   588.60), SIMDE_FLOAT32_C(  -657.59),
+      SIMDE_FLOAT32_C(   -89.06), SIMDE_FLOAT32_C(   543.71), SIMDE_FLOAT32_C(   196.22), SIMDE_FLOAT32_C(  -358.38),
+      SIMDE_FLOAT32_C(   107.09), SIMDE_FLOAT32_C(   610.67), SIMDE_FLOAT32_C(   995.30), SIMDE_FLOAT32_C(   696.50),
+      SIMDE_FLOAT32_C(    94.26), SIMDE_FLOAT32_C(  -225.78), SIMDE_FLOAT32_C(   667.06), SIMDE_FLOAT32_C(   508.72),
+      SIMDE_FLOAT32_C(  -331.52), SIMDE_FLOAT32_C(   574.38), SIMDE_FLOAT32_C(   698.11), SIMDE_FLOAT32_C(  -721.43),
+      SIMDE_FLOAT32_C(  -598.90), SIMDE_FLOAT32_C(   946.65), SIMDE_FLOAT32_C(   -68.22), SIMDE_FLOAT32_C(   703.72),
+      SIMDE_FLOAT32_C(   639.85), SIMDE_FLOAT32_C(  -343.95), SIMDE_FLOAT32_C(   897.52), SIMDE_FLOAT32_C(   210.47),
+      SIMDE_FLOAT32_C(  -442.72), SIMDE_FLOAT32_C(    22.43), SIMDE_FLOAT32_C(  -126.01), SIMDE_FLOAT32_C(  -327.23),
+      SIMDE_FLOAT32_C(    14.12), SIMDE_FLOAT32_C(  -537.41), SIMDE_FLOAT32_C(    15.17), SIMDE_FLOAT32_C(   925.06),
+      SIMDE_FLOAT32_C(  -993.70), SIMDE_FLOAT32_C(  -788.61), SIMDE_FLOAT32_C(  -433.33), SIMDE_FLOAT32_C(   113.38),
+      SIMDE_FLOAT32_C(   822.06), SIMDE_FLOAT32_C(  -438.02), SIMDE_FLOAT32_C(  -190.11), SIMDE_FLOAT32_C(   -83.68),
+      SIMDE_FLOAT32_C(   336.20), SIMDE_FLOAT32_C(  -523.05), SIMDE_FLOAT32_C(  -574.96), SIMDE_FLOAT32_C(  -995.32),
+      SIMDE_FLOAT32_C(  -948.67), SIMDE_FLOAT32_C(  -876.85), SIMDE_FLOAT32_C(  -716.75), SIMDE_FLOAT32_C(  -547.57),
+      SIMDE_FLOAT32_C(  -930.20), SIMDE_FLOAT32_C(   215.03), SIMDE_FLOAT32_C(  -843.85), SIMDE_FLOAT32_C(   709.65),
+      SIMDE_FLOAT32_C(   871.08), SIMDE_FLOAT32_C(  -946.33), SIMDE_FLOAT32_C(   -79.88), SIMDE_FLOAT32_C(  -571.63),
+      SIMDE_FLOAT32_C(    76.11), SIMDE_FLOAT32_C(   794.11), SIMDE_FLOAT32_C(   101.14), SIMDE_FLOAT32_C(  -909.78),
+      SIMDE_FLOAT32_C(  -743.30), SIMDE_FLOAT32_C(  -883.69), SIMDE_FLOAT32_C(  -984.72), SIMDE_FLOAT32_C(  -737.01),
+      SIMDE_FLOAT32_C(  -672.30), SIMDE_FLOAT32_C(  -418.04), SIMDE_FLOAT32_C(   376.38), SIMDE_FLOAT32_C(  -850.24),
+      SIMDE_FLOAT32_C(   143.94), SIMDE_FLOAT32_C(  -813.73), SIMDE_FLOAT32_C(    66.08), SIMDE_FLOAT32_C(  -519.86),
+      SIMDE_FLOAT32_C(  -336.78), SIMDE_FLOAT32_C(   491.12), SIMDE_FLOAT32_C(  -515.19), SIMDE_FLOAT32_C(  -285.45),
+      SIMDE_FLOAT32_C(   614.27), SIMDE_FLOAT32_C(  -231.94), SIMDE_FLOAT32_C(   166.98), SIMDE_FLOAT32_C(   684.08),
+      SIMDE_FLOAT32_C(   983.09), SIMDE_FLOAT32_C(   323.14), SIMDE_FLOAT32_C(   393.73), SIMDE_FLOAT32_C(   854.17),
+      SIMDE_FLOAT32_C(   376.81), SIMDE_FLOAT32_C(  -686.15), SIMDE_FLOAT32_C(  -717.46), SIMDE_FLOAT32_C(  -547.08),
+      SIMDE_FLOAT32_C(  -892.04), SIMDE_FLOAT32_C(   383.67), SIMDE_FLOAT32_C(  -456.86), SIMDE_FLOAT32_C(  -635.35),
+      SIMDE_FLOAT32_C(   499.98), SIMDE_FLOAT32_C(  -441.58), SIMDE_FLOAT32_C(  -372.35), SIMDE_FLOAT32_C(   827.69),
+      SIMDE_FLOAT32_C(   140.38), SIMDE_FLOAT32_C(  -995.97), SIMDE_FLOAT32_C(   977.45), SIMDE_FLOAT32_C(  -715.68),
+      SIMDE_FLOAT32_C(  -809.70), SIMDE_FLOAT32_C(    43.53), SIMDE_FLOAT32_C(  -235.55), SIMDE_FLOAT32_C(  -146.49),
+      SIMDE_FLOAT32_C(  -465.35), SIMDE_FLOAT32_C(   249.26), SIMDE_FLOAT32_C(   568.06), SIMDE_FLOAT32_C(  -851.08),
+      SIMDE_FLOAT32_C(  -982.68), SIMDE_FLOAT32_C(  -264.95), SIMDE_FLOAT32_C(   832.99), SIMDE_FLOAT32_C(  -999.59),
+      SIMDE_FLOAT32_C(  -941.82), SIMDE_FLOAT32_C(   226.72), SIMDE_FLOAT32_C(   854.59), SIMDE_FLOAT32_C(   434.99),
+      SIMDE_FLOAT32_C(   540.57), SIMDE_FLOAT32_C(  -862.88), SIMDE_FLOAT32_C(   887.91), SIMDE_FLOAT32_C(   648.53),
+      SIMDE_FLOAT32_C(   520.80), SIMDE_FLOAT32_C(  -568.95), SIMDE_FLOAT32_C(  -986.82), SIMDE_FLOAT32_C(    20.78),
+      SIMDE_FLOAT32_C(   -10.53), SIMDE_FLOAT32_C(  -359.17), SIMDE_FLOAT32_C(  -151.53), SIMDE_FLOAT32_C(  -870.15),
+      SIMDE_FLOAT32_C(  -355.14), SIMDE_FLOAT32_C(  -174.08), SIMDE_FLOAT32_C(  -585.83), SIMDE_FLOAT32_C(  -164.84),
+      SIMDE_FLOAT32_C(   869.45), SIMDE_FLOAT32_C(   178.62), SIMDE_FLOAT32_C(   688.67), SIMDE_FLOAT32_C(  -595.91),
+      SIMDE_FLOAT32_C(  -572.11), SIMDE_FLOAT32_C(   256.73), SIMDE_FLOAT32_C(  -446.99), SIMDE_FLOAT32_C(  -554.79),
+      SIMDE_FLOAT32_C(   991.78), SIMDE_FLOAT32_C(  -614.00), SIMDE_FLOAT32_C(  -554.37), SIMDE_FLOAT32_C(  -950.04),
+      SIMDE_FLOAT32_C(   612.72), SIMDE_FLOAT32_C(  -699.79), SIMDE_FLOAT32_C(   484.96), SIMDE_FLOAT32_C(   153.29),
+      SIMDE_FLOAT32_C(  -562.66), SIMDE_FLOAT32_C(   372.87), SIMDE_FLOAT32_C(  -198.18), SIMDE_FLOAT32_C(   958.14),
+      SIMDE_FLOAT32_C(   803.92), SIMDE_FLOAT32_C(  -185.00), SIMDE_FLOAT32_C(   -21.08), SIMDE_FLOAT32_C(  -206.61),
+      SIMDE_FLOAT32_C(   455.84), SIMDE_FLOAT32_C(   827.39), SIMDE_FLOAT32_C(   -76.76), SIMDE_FLOAT32_C(  -899.30),
+      SIMDE_FLOAT32_C(  -346.69), SIMDE_FLOAT32_C(   337.41), SIMDE_FLOAT32_C(   -64.15), SIMDE_FLOAT32_C(  -477.25),
+      SIMDE_FLOAT32_C(  -483.96), SIMDE_FLOAT32_C(  -375.48), SIMDE_FLOAT32_C(   -73.16), SIMDE_FLOAT32_C(   -56.08),
+      SIMDE_FLOAT32_C(   881.26) };
+  static const simde_float32 e = SIMDE_FLOAT32_C(   995.30);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  simde_float32 r = -SIMDE_MATH_INFINITYF;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    simde_float32 v = simde_svmaxv_f32(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_f32(e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)];
+  simde_float32 e = -SIMDE_MATH_INFINITYF;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    simde_float32 v = simde_svmaxv_f32(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmaxv_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   903.73), SIMDE_FLOAT64_C(  -130.35), SIMDE_FLOAT64_C(  -172.95), SIMDE_FLOAT64_C(   867.79),
+      SIMDE_FLOAT64_C(   285.61), SIMDE_FLOAT64_C(   236.53), SIMDE_FLOAT64_C(   111.31), SIMDE_FLOAT64_C(  -580.88),
+      SIMDE_FLOAT64_C(  -105.87), SIMDE_FLOAT64_C(  -396.22), SIMDE_FLOAT64_C(  -253.07), SIMDE_FLOAT64_C(  -970.15),
+      SIMDE_FLOAT64_C(  -730.43), SIMDE_FLOAT64_C(   237.12), SIMDE_FLOAT64_C(  -661.44), SIMDE_FLOAT64_C(  -641.92),
+      SIMDE_FLOAT64_C(   972.81), SIMDE_FLOAT64_C(  -439.28), SIMDE_FLOAT64_C(   -94.95), SIMDE_FLOAT64_C(   538.84),
+      SIMDE_FLOAT64_C(   152.45), SIMDE_FLOAT64_C(  -474.87), SIMDE_FLOAT64_C(   -92.79), SIMDE_FLOAT64_C(   622.03),
+      SIMDE_FLOAT64_C(   272.98), SIMDE_FLOAT64_C(   976.35), SIMDE_FLOAT64_C(  -564.19), SIMDE_FLOAT64_C(  -596.12),
+      SIMDE_FLOAT64_C(   204.54), SIMDE_FLOAT64_C(  -974.29), SIMDE_FLOAT64_C(   999.60), SIMDE_FLOAT64_C(   108.27),
+      SIMDE_FLOAT64_C(  -104.64), SIMDE_FLOAT64_C(  -173.35), SIMDE_FLOAT64_C(   -23.94), SIMDE_FLOAT64_C(  -819.03),
+      SIMDE_FLOAT64_C(  -936.82), SIMDE_FLOAT64_C(  -912.63), SIMDE_FLOAT64_C(  -399.91), SIMDE_FLOAT64_C(   -42.69),
+      SIMDE_FLOAT64_C(  -308.85), SIMDE_FLOAT64_C(   347.01), SIMDE_FLOAT64_C(   -12.84), SIMDE_FLOAT64_C(   -39.28),
+      SIMDE_FLOAT64_C(  -415.86), SIMDE_FLOAT64_C(   325.71), SIMDE_FLOAT64_C(   318.80), SIMDE_FLOAT64_C(  -443.05),
+      SIMDE_FLOAT64_C(   886.44), SIMDE_FLOAT64_C(  -776.15), SIMDE_FLOAT64_C(  -904.21), SIMDE_FLOAT64_C(    38.88),
+      SIMDE_FLOAT64_C(  -251.02), SIMDE_FLOAT64_C(     3.00), SIMDE_FLOAT64_C(  -339.09), SIMDE_FLOAT64_C(  -978.04),
+      SIMDE_FLOAT64_C(   -20.65), SIMDE_FLOAT64_C(    96.72), SIMDE_FLOAT64_C(  -574.16), SIMDE_FLOAT64_C(  -816.12),
+      SIMDE_FLOAT64_C(   122.43), SIMDE_FLOAT64_C(  -574.56), SIMDE_FLOAT64_C(   292.15), SIMDE_FLOAT64_C(  -982.21),
+      SIMDE_FLOAT64_C(   252.09), SIMDE_FLOAT64_C(  -731.79), SIMDE_FLOAT64_C(  -801.24), SIMDE_FLOAT64_C(   315.27),
+      SIMDE_FLOAT64_C(  -644.43), SIMDE_FLOAT64_C(  -201.15), SIMDE_FLOAT64_C(  -727.42), SIMDE_FLOAT64_C(    46.72),
+      SIMDE_FLOAT64_C(  -854.14), SIMDE_FLOAT64_C(   259.73), SIMDE_FLOAT64_C(  -992.56), SIMDE_FLOAT64_C(  -270.00),
+      SIMDE_FLOAT64_C(  -414.55), SIMDE_FLOAT64_C(   326.24), SIMDE_FLOAT64_C(   286.95) };
+  static const simde_float64 e = SIMDE_FLOAT64_C(   999.60);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  simde_float64 r = -SIMDE_MATH_INFINITY;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    simde_float64 v = simde_svmaxv_f64(pv, av);
+    r = (v > r) ? v : r;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_f64(e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)];
+  simde_float64 e = -SIMDE_MATH_INFINITY;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    simde_float64 v = simde_svmaxv_f64(pv, av);
+    e = (v > e) ? v : e;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmaxv_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
@@ -0,0 +1,9007 @@
+#define SIMDE_TEST_ARM_SVE_INSN min
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/min.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+
+static int
+test_simde_svmin_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0) };
+  static const int8_t a[] =
+    {  INT8_C(   7),  INT8_C(  13),  INT8_C(  34), -INT8_C( 118),  INT8_C(  83), -INT8_C(  87), -INT8_C( 106),  INT8_C(   5),
+      -INT8_C( 110),  INT8_C(  87),  INT8_C(  97),  INT8_C(  17), -INT8_C(   2),  INT8_C(  29), -INT8_C( 116), -INT8_C(   7),
+      -INT8_C(  65), -INT8_C(  68),  INT8_C(  98), -INT8_C( 118), -INT8_C(  18), -INT8_C(  24), -INT8_C(  77), -INT8_C(  70),
+       INT8_C( 126), -INT8_C( 114), -INT8_C(  12),  INT8_C(  74),      INT8_MIN,  INT8_C(  25), -INT8_C(  12), -INT8_C( 121),
+       INT8_C(  39),  INT8_C(  22),  INT8_C(  17),  INT8_C( 122), -INT8_C(  65), -INT8_C(  88),      INT8_MAX,  INT8_C(  82),
+      -INT8_C(   1), -INT8_C(  32),  INT8_C(  99), -INT8_C(   3), -INT8_C(   3), -INT8_C(  17), -INT8_C(   9), -INT8_C(  68),
+      -INT8_C(  84),  INT8_C(  89),  INT8_C(  70), -INT8_C( 102),  INT8_C(  65), -INT8_C(   6),  INT8_C(  84), -INT8_C(  65),
+      -INT8_C( 120),  INT8_C(  73),  INT8_C(   9),  INT8_C(   8),  INT8_C(  98), -INT8_C(   3), -INT8_C( 113), -INT8_C( 119),
+       INT8_C(  19), -INT8_C(  96),  INT8_C(   3), -INT8_C(  45),  INT8_C(  72), -INT8_C( 126),  INT8_C(  37),  INT8_C(  72),
+       INT8_C(  98), -INT8_C( 120),  INT8_C(  69),  INT8_C(  96),  INT8_C( 119),  INT8_C(  60),  INT8_C(  28),  INT8_C(  35),
+      -INT8_C( 107),  INT8_C(  99), -INT8_C(  66), -INT8_C(  42),  INT8_C(  93),  INT8_C(  18), -INT8_C( 107), -INT8_C(  27),
+       INT8_C(  91), -INT8_C(  98), -INT8_C(  19), -INT8_C(  66), -INT8_C( 101),  INT8_C( 124),  INT8_C(  71), -INT8_C(  81),
+       INT8_C(  28),  INT8_C(  75), -INT8_C( 126),  INT8_C( 101), -INT8_C(  51), -INT8_C(  89), -INT8_C(  83),  INT8_C(  48),
+       INT8_C(  47), -INT8_C(  14), -INT8_C( 112), -INT8_C(  90),  INT8_C(  47), -INT8_C(  84), -INT8_C(  54), -INT8_C(  60),
+       INT8_C(  15), -INT8_C( 120), -INT8_C( 101),  INT8_C( 108), -INT8_C( 102),  INT8_C(  48),  INT8_C(  81), -INT8_C(  10),
+      -INT8_C(  49),  INT8_C(  62), -INT8_C(  76),  INT8_C( 106), -INT8_C(  70), -INT8_C(   5),  INT8_C(  25), -INT8_C(  41),
+       INT8_C(  70), -INT8_C( 101),  INT8_C(  60),  INT8_C(  20),  INT8_C(  66), -INT8_C(  23),  INT8_C(  68),  INT8_C( 113),
+      -INT8_C(  37), -INT8_C(  44),  INT8_C(  24),  INT8_C(  10),      INT8_MIN, -INT8_C(  30), -INT8_C(  49), -INT8_C( 112),
+       INT8_C( 106),  INT8_C( 106), -INT8_C(   4),  INT8_C(   4), -INT8_C( 102),  INT8_C(  78), -INT8_C(   6),  INT8_C( 105),
+      -INT8_C( 116), -INT8_C(  82), -INT8_C(  44),  INT8_C(  71), -INT8_C(  86), -INT8_C(  19),  INT8_C(  30), -INT8_C(  16),
+      -INT8_C( 119),  INT8_C(  90),  INT8_C(   4), -INT8_C(  53),  INT8_C(  67),  INT8_C(  72),  INT8_C(  61),  INT8_C(  30),
+       INT8_C(  28),  INT8_C(  85),  INT8_C(  41), -INT8_C(  99),  INT8_C(  55), -INT8_C(   8),  INT8_C(  45), -INT8_C(  95),
+       INT8_C(  98),  INT8_C(  41), -INT8_C(  91), -INT8_C(   4),  INT8_C( 119), -INT8_C(  96),  INT8_C( 102),  INT8_C(   4),
+       INT8_C(  78),  INT8_C(  58),  INT8_C(  75), -INT8_C(   8),  INT8_C(  39),  INT8_C( 105), -INT8_C(  23), -INT8_C(  80),
+      -INT8_C(  61), -INT8_C(  19),  INT8_C( 124),  INT8_C(   6),  INT8_C(  54), -INT8_C(  71),  INT8_C(  36),  INT8_C(  82),
+       INT8_C(  14),  INT8_C(  77), -INT8_C(  17),  INT8_C(  69),  INT8_C(  69),  INT8_C(  28), -INT8_C(  26), -INT8_C(  89),
+       INT8_C(  70), -INT8_C( 117), -INT8_C(  92), -INT8_C(  67),  INT8_C(  43),  INT8_C(  10), -INT8_C(  63),  INT8_C( 122),
+       INT8_C(  68),  INT8_C(  12),  INT8_C( 114),  INT8_C( 107),  INT8_C( 117),  INT8_C(  91),  INT8_C(  28),  INT8_C(  56),
+       INT8_C(  73), -INT8_C( 104),  INT8_C(  62),      INT8_MAX,  INT8_C(  81),  INT8_C(  99), -INT8_C(  47),  INT8_C(  95),
+      -INT8_C(  80), -INT8_C(  63), -INT8_C(  92), -INT8_C(  10), -INT8_C(  35), -INT8_C( 118), -INT8_C(  99),  INT8_C(  35),
+       INT8_C(  21),  INT8_C(  65), -INT8_C(  31),  INT8_C(  65),  INT8_C(  75), -INT8_C(  94), -INT8_C(  69), -INT8_C( 113),
+      -INT8_C(  81),  INT8_C(  45), -INT8_C(   5),  INT8_C(  36), -INT8_C( 119),  INT8_C(  23),  INT8_C(  93), -INT8_C(  46),
+      -INT8_C(  81), -INT8_C( 101),  INT8_C(  81),  INT8_C(   0), -INT8_C(   2),  INT8_C(  34),  INT8_C(  95), -INT8_C(  81),
+      -INT8_C(  29),  INT8_C(   3), -INT8_C(  91), -INT8_C(  63), -INT8_C( 115),  INT8_C(  66), -INT8_C(  28), -INT8_C(  94),
+      -INT8_C( 124), -INT8_C(  59), -INT8_C(  29), -INT8_C(  49),  INT8_C( 104), -INT8_C(  98),  INT8_C(  95),  INT8_C(  23),
+      -INT8_C(  52),  INT8_C(  90),  INT8_C(  59),  INT8_C(  85),  INT8_C( 113), -INT8_C( 104),  INT8_C(  39),  INT8_C(  32),
+       INT8_C(  52),  INT8_C( 120),  INT8_C(  32),  INT8_C(  50), -INT8_C( 102),      INT8_MAX, -INT8_C(  31),  INT8_C( 126),
+      -INT8_C( 126), -INT8_C( 122),  INT8_C(  63),  INT8_C(  15), -INT8_C(  55),  INT8_C(  35), -INT8_C(  79),  INT8_C(  77),
+      -INT8_C(  23), -INT8_C( 107),  INT8_C(  28),  INT8_C(  81),  INT8_C(  51),  INT8_C( 123),  INT8_C( 104), -INT8_C(   1),
+      -INT8_C(  43), -INT8_C(  93),  INT8_C(  84),  INT8_C(  70),  INT8_C(  60),  INT8_C( 123),  INT8_C( 102),  INT8_C( 112),
+      -INT8_C(  13), -INT8_C( 122), -INT8_C(  94), -INT8_C( 114),  INT8_C(   5), -INT8_C( 124),  INT8_C(  12), -INT8_C( 121),
+       INT8_C(  10),  INT8_C(  75), -INT8_C( 106), -INT8_C(  45),  INT8_C( 110),  INT8_C(  72),  INT8_C(  32),  INT8_C(  87),
+      -INT8_C(  35),  INT8_C(  61), -INT8_C(  88),  INT8_C(  16), -INT8_C(  72),  INT8_C(  16),  INT8_C(  16), -INT8_C( 114),
+      -INT8_C(  76),  INT8_C( 100), -INT8_C(  44), -INT8_C(  16), -INT8_C(  32),  INT8_C(  59),  INT8_C(  96), -INT8_C(  45),
+      -INT8_C(  63),  INT8_C(   2),  INT8_C(  97), -INT8_C(  57), -INT8_C( 122),  INT8_C( 109),  INT8_C(  78), -INT8_C( 111),
+      -INT8_C(  72), -INT8_C(  27),  INT8_C( 100),  INT8_C(  39),  INT8_C(  45), -INT8_C( 123),  INT8_C( 126),  INT8_C(  10),
+      -INT8_C(  62),  INT8_C(  39),  INT8_C(  26),  INT8_C( 122),  INT8_C(  55),  INT8_C(  42),  INT8_C(   8), -INT8_C(  21),
+      -INT8_C( 113), -INT8_C(  35), -INT8_C(  37),  INT8_C( 111),  INT8_C(  24),  INT8_C(  59),  INT8_C(  66), -INT8_C(  39),
+       INT8_C(  62), -INT8_C(  92), -INT8_C(  96), -INT8_C(  60),  INT8_C(  17), -INT8_C(  17),  INT8_C(  85), -INT8_C(  54),
+      -INT8_C(  44), -INT8_C(  70), -INT8_C(  15),  INT8_C(   1),  INT8_C(  63),  INT8_C( 111),  INT8_C(  11),  INT8_C(   1),
+      -INT8_C( 106),  INT8_C(  37),  INT8_C( 123), -INT8_C(  50),  INT8_C(  80), -INT8_C( 124), -INT8_C(  71), -INT8_C(  33),
+       INT8_C(  97), -INT8_C( 107),  INT8_C(  78),  INT8_C( 121), -INT8_C(  48), -INT8_C( 112),  INT8_C(  82),  INT8_C(  14),
+       INT8_C(  52), -INT8_C(  13), -INT8_C(  45),  INT8_C(  70), -INT8_C(  30),  INT8_C(  40),  INT8_C(  16), -INT8_C(  74),
+      -INT8_C(  30),  INT8_C(   1), -INT8_C(  73),  INT8_C(  33),  INT8_C( 112), -INT8_C(  62),  INT8_C(  34),  INT8_C(   7),
+      -INT8_C(  25), -INT8_C(  98), -INT8_C(  43),  INT8_C(  55),  INT8_C(  34), -INT8_C( 114),  INT8_C(  22), -INT8_C( 125),
+       INT8_C(  35),  INT8_C( 100), -INT8_C(   4), -INT8_C(  12), -INT8_C(  11),  INT8_C(  78),  INT8_C(   2),  INT8_C(  41),
+       INT8_C(  65), -INT8_C(  43),  INT8_C( 111),  INT8_C(  35), -INT8_C(   2),      INT8_MAX, -INT8_C(  39), -INT8_C(  32),
+           INT8_MIN, -INT8_C( 112),  INT8_C(   2), -INT8_C(  15),  INT8_C(  82),  INT8_C(  36), -INT8_C(   8),  INT8_C(  58),
+      -INT8_C(  62), -INT8_C(  51),  INT8_C( 113), -INT8_C(  28),  INT8_C(  91), -INT8_C( 120),  INT8_C( 103),      INT8_MAX,
+      -INT8_C(  20),  INT8_C(  99),  INT8_C( 115), -INT8_C(  31), -INT8_C(  78),  INT8_C( 117),  INT8_C(  11), -INT8_C(  13),
+       INT8_C(  75),  INT8_C( 122),  INT8_C(  23),  INT8_C(  73), -INT8_C(   6), -INT8_C(  16),  INT8_C(  41),  INT8_C( 122),
+      -INT8_C( 127),  INT8_C(  43),  INT8_C( 107), -INT8_C(  45),  INT8_C(  80),  INT8_C(  99),  INT8_C(  13),  INT8_C(  18),
+       INT8_C(  48),      INT8_MAX, -INT8_C(   9), -INT8_C( 116),  INT8_C(   7),  INT8_C(  94),  INT8_C(  11), -INT8_C(  13),
+      -INT8_C(  62),  INT8_C( 126), -INT8_C(  43),  INT8_C( 116), -INT8_C(  13), -INT8_C(  32),  INT8_C( 103),  INT8_C(  62),
+       INT8_C(  90),  INT8_C( 126), -INT8_C( 121),  INT8_C(  84),  INT8_C( 111), -INT8_C(  79), -INT8_C(  49), -INT8_C(  16),
+      -INT8_C(  36),  INT8_C(  58), -INT8_C(  61),  INT8_C(  44), -INT8_C(  98), -INT8_C(  47),  INT8_C(  63), -INT8_C(  50),
+       INT8_C(  80),  INT8_C(  54),  INT8_C(  90),  INT8_C(  87), -INT8_C( 108),  INT8_C( 101),  INT8_C(  74),  INT8_C(  86),
+      -INT8_C(  29),  INT8_C(  31), -INT8_C(  54), -INT8_C(  41), -INT8_C(   1),  INT8_C(  50),  INT8_C(  21),  INT8_C(  90),
+      -INT8_C(  80), -INT8_C(  99), -INT8_C(  82),  INT8_C(  31),  INT8_C(  78),  INT8_C( 125),  INT8_C(  15),  INT8_C(  42),
+      -INT8_C(  72), -INT8_C(  45),  INT8_C(  87),  INT8_C(  86), -INT8_C(  92), -INT8_C( 106),  INT8_C(  36), -INT8_C(  12),
+      -INT8_C(  52),      INT8_MAX,  INT8_C(  75),  INT8_C(  96), -INT8_C(  28), -INT8_C( 107), -INT8_C(  73), -INT8_C(  56),
+      -INT8_C(  75), -INT8_C( 127), -INT8_C(  97), -INT8_C(  76), -INT8_C(  77), -INT8_C(  76),  INT8_C(  14),  INT8_C( 100),
+       INT8_C(  81), -INT8_C(  67), -INT8_C( 125), -INT8_C(  97),  INT8_C(  58), -INT8_C( 109), -INT8_C(  54), -INT8_C(  14),
+       INT8_C( 102),  INT8_C(  33),  INT8_C(  72),  INT8_C(  10), -INT8_C(  73),  INT8_C( 109), -INT8_C(   2), -INT8_C( 125),
+      -INT8_C(  20),  INT8_C(  73), -INT8_C(  29), -INT8_C(  48), -INT8_C(  34), -INT8_C( 102), -INT8_C( 104), -INT8_C( 109),
+       INT8_C(  28),  INT8_C(  55),  INT8_C(  72), -INT8_C(  49), -INT8_C(  20),  INT8_C(  86),  INT8_C(  51),  INT8_C(  61),
+       INT8_C(  19), -INT8_C(  73), -INT8_C(  35),  INT8_C(  78),  INT8_C(  74), -INT8_C(  89),  INT8_C(  64), -INT8_C(  80),
+      -INT8_C(  56), -INT8_C( 119), -INT8_C(  70),      INT8_MAX, -INT8_C(  10), -INT8_C(  72),  INT8_C(   2), -INT8_C(  30),
+       INT8_C(   1), -INT8_C(  27), -INT8_C(  78), -INT8_C(  33) };
+  static const int8_t b[] =
+    {  INT8_C( 105), -INT8_C(  77), -INT8_C(   8), -INT8_C(  12), -INT8_C(  13), -INT8_C( 110),  INT8_C(  14),  INT8_C( 103),
+      -INT8_C(  12),  INT8_C(  16), -INT8_C(  53), -INT8_C(  10),  INT8_C(  65),  INT8_C( 121), -INT8_C(  68), -INT8_C( 107),
+       INT8_C(  73), -INT8_C(  91),  INT8_C(  58),  INT8_C(  67), -INT8_C( 112), -INT8_C(   8),  INT8_C(  50), -INT8_C(  62),
+      -INT8_C(  62),  INT8_C(  99),  INT8_C(  93),  INT8_C(  18), -INT8_C(  37),  INT8_C(  95),  INT8_C(  20),  INT8_C(  68),
+       INT8_C(  19),  INT8_C(  12),  INT8_C(  56),  INT8_C(   6), -INT8_C(  98),  INT8_C(  70),  INT8_C( 109), -INT8_C( 109),
+       INT8_C(  86),  INT8_C(  56), -INT8_C( 119), -INT8_C( 105), -INT8_C(  78),  INT8_C(  70),  INT8_C(  44), -INT8_C(   5),
+      -INT8_C(  21),  INT8_C( 102),  INT8_C(  62),  INT8_C( 123),  INT8_C(  95),  INT8_C( 112),  INT8_C(  62),  INT8_C(  33),
+      -INT8_C(  45), -INT8_C( 101),  INT8_C(  51), -INT8_C(  82), -INT8_C(   5),  INT8_C(  71), -INT8_C(  14),  INT8_C(  14),
+       INT8_C(  84),  INT8_C(  42),  INT8_C(  20), -INT8_C(  14),  INT8_C( 112), -INT8_C( 126), -INT8_C( 123), -INT8_C(  57),
+      -INT8_C(  70),  INT8_C(  15),  INT8_C(  94),  INT8_C( 108),  INT8_C(  85), -INT8_C( 117),  INT8_C( 103),  INT8_C(  64),
+      -INT8_C(  15), -INT8_C(  91), -INT8_C(  68),  INT8_C(  80),  INT8_C(  21), -INT8_C(   6),  INT8_C( 114), -INT8_C(  23),
+      -INT8_C( 107), -INT8_C(  91), -INT8_C( 105), -INT8_C( 112), -INT8_C(  19), -INT8_C( 118), -INT8_C(  98),  INT8_C(  65),
+      -INT8_C(  76), -INT8_C(  77),  INT8_C(  51),  INT8_C(  37),  INT8_C(  53), -INT8_C(  71), -INT8_C(  20), -INT8_C(  17),
+      -INT8_C(  56),  INT8_C(  74),  INT8_C(  92),  INT8_C(  29), -INT8_C(  43), -INT8_C(  61),  INT8_C(  93), -INT8_C(  57),
+       INT8_C( 105),  INT8_C(  25),  INT8_C(  23),  INT8_C( 126),  INT8_C(  19), -INT8_C( 119),  INT8_C( 103), -INT8_C(  87),
+       INT8_C(  47), -INT8_C(   1),  INT8_C(  57),  INT8_C(  28), -INT8_C( 119), -INT8_C(  40),  INT8_C(  93),  INT8_C(  61),
+      -INT8_C( 117), -INT8_C( 112),  INT8_C(  98), -INT8_C(  64),  INT8_C(  73),  INT8_C(  78), -INT8_C(  81),  INT8_C(  17),
+      -INT8_C( 103),  INT8_C(  11),  INT8_C(  46),  INT8_C( 110), -INT8_C(  49), -INT8_C( 116),  INT8_C(  53),  INT8_C(  56),
+      -INT8_C(  91),  INT8_C(  77), -INT8_C(  74), -INT8_C(  71), -INT8_C(  42),  INT8_C(  30),  INT8_C(  98),  INT8_C(   5),
+       INT8_C(  29), -INT8_C( 101),  INT8_C(  33), -INT8_C(  90),  INT8_C( 115),  INT8_C( 126), -INT8_C(  29), -INT8_C(   2),
+       INT8_C(  15),  INT8_C(  70), -INT8_C(  66),  INT8_C(  88), -INT8_C( 108),  INT8_C( 110),  INT8_C( 106),  INT8_C(  45),
+       INT8_C( 121), -INT8_C( 104), -INT8_C( 100),  INT8_C(  72),  INT8_C(  36), -INT8_C(  47),      INT8_MIN, -INT8_C(  54),
+       INT8_C(  30),  INT8_C(  55), -INT8_C( 125), -INT8_C(  11),  INT8_C(  85), -INT8_C(  27), -INT8_C(   6),  INT8_C( 114),
+           INT8_MIN,  INT8_C(  28),  INT8_C(  24), -INT8_C(  12), -INT8_C( 102), -INT8_C(   5), -INT8_C(  14), -INT8_C(  87),
+       INT8_C(  65), -INT8_C(  79),  INT8_C(   2), -INT8_C(  42),  INT8_C(  31),  INT8_C( 108),  INT8_C(   3), -INT8_C( 104),
+       INT8_C(   4), -INT8_C(  97), -INT8_C(  31),  INT8_C(  41),  INT8_C( 113),  INT8_C(  97), -INT8_C(  13), -INT8_C( 113),
+      -INT8_C( 104),  INT8_C( 118), -INT8_C( 124), -INT8_C(  19),  INT8_C(  91),      INT8_MAX,  INT8_C(  95), -INT8_C(  37),
+      -INT8_C( 101),  INT8_C( 119), -INT8_C(  49),  INT8_C(  53),  INT8_C( 115), -INT8_C(  62), -INT8_C(  33), -INT8_C(  76),
+       INT8_C( 115), -INT8_C(  31), -INT8_C( 118), -INT8_C( 110),  INT8_C(  77), -INT8_C( 114),  INT8_C(  42),  INT8_C(  81),
+       INT8_C(  45),  INT8_C(  11),  INT8_C( 122), -INT8_C(  98),  INT8_C( 109),  INT8_C( 109),  INT8_C(  46),  INT8_C(   5),
+      -INT8_C(  29), -INT8_C(  78), -INT8_C(  13),  INT8_C(  62),  INT8_C(  49),  INT8_C(  82),  INT8_C(  26), -INT8_C(  52),
+      -INT8_C(  54), -INT8_C(  23),  INT8_C(   2),  INT8_C(  61), -INT8_C(  85), -INT8_C(  31), -INT8_C(  15),  INT8_C(  30),
+      -INT8_C(  62),  INT8_C( 124), -INT8_C(  80),  INT8_C(  15),  INT8_C(  10), -INT8_C(  37),  INT8_C(  96),  INT8_C(  55),
+      -INT8_C(  26), -INT8_C(  37), -INT8_C(  42),  INT8_C(  83),  INT8_C(  72),  INT8_C(   4),  INT8_C(  89),  INT8_C(  44),
+      -INT8_C(  74),  INT8_C(  76),  INT8_C( 106), -INT8_C(  24), -INT8_C(  98), -INT8_C( 124), -INT8_C(  76),  INT8_C( 104),
+       INT8_C( 110), -INT8_C(  74), -INT8_C(  91),  INT8_C(  25), -INT8_C( 105), -INT8_C( 105),  INT8_C(  56),  INT8_C(  89),
+       INT8_C(  19), -INT8_C(  24),  INT8_C( 104),  INT8_C(  29), -INT8_C(  61), -INT8_C(  55),  INT8_C(  84), -INT8_C(  86),
+      -INT8_C(  92),  INT8_C(  42), -INT8_C(   3), -INT8_C(  20),  INT8_C(  46),  INT8_C(  86),  INT8_C(  24), -INT8_C(  27),
+      -INT8_C(  94), -INT8_C( 125), -INT8_C(  51),  INT8_C(  65),  INT8_C(   7), -INT8_C( 127), -INT8_C(  87),  INT8_C( 117),
+       INT8_C(  56),  INT8_C(  79), -INT8_C( 113), -INT8_C(  49), -INT8_C(  26), -INT8_C(  57),  INT8_C(  41), -INT8_C(   7),
+      -INT8_C(  81), -INT8_C( 111),  INT8_C(  22),  INT8_C( 115),  INT8_C(  90),  INT8_C( 106),  INT8_C(  29), -INT8_C(   2),
+      -INT8_C( 107),  INT8_C(  26), -INT8_C(  21), -INT8_C(  61),  INT8_C( 113),  INT8_C(   3), -INT8_C(  88),  INT8_C(  19),
+      -INT8_C( 122),  INT8_C( 117),  INT8_C(  84), -INT8_C( 114), -INT8_C(   9), -INT8_C(   2),  INT8_C(   3),  INT8_C(  47),
+       INT8_C(  77), -INT8_C( 110), -INT8_C(   2),  INT8_C(  51),  INT8_C(  89),  INT8_C(  39),  INT8_C(  44),  INT8_C(   9),
+      -INT8_C(  71),  INT8_C(  66),  INT8_C( 124),  INT8_C(  19), -INT8_C(  84), -INT8_C( 103),  INT8_C(  18),  INT8_C(  65),
+      -INT8_C(  77), -INT8_C(   3),  INT8_C(   5),  INT8_C(  36),  INT8_C(   0), -INT8_C(  83),  INT8_C(  56), -INT8_C( 121),
+       INT8_C(  35), -INT8_C( 116),  INT8_C(  21),  INT8_C(  26), -INT8_C( 118),  INT8_C(  24),  INT8_C(  73), -INT8_C(  41),
+      -INT8_C(  85),  INT8_C(  71),  INT8_C(  10),  INT8_C(   4),  INT8_C( 111),  INT8_C(  54),  INT8_C(  13),  INT8_C(  40),
+       INT8_C( 120), -INT8_C( 119),  INT8_C(  59),  INT8_C(  37),  INT8_C(  34),  INT8_C(  77),  INT8_C( 102), -INT8_C(  42),
+       INT8_C(  74),  INT8_C( 107), -INT8_C(   6),  INT8_C(  75),  INT8_C(  25),  INT8_C(  50), -INT8_C(  46),  INT8_C(  60),
+      -INT8_C(  65), -INT8_C(  25),  INT8_C(  86),  INT8_C(  73), -INT8_C(   1), -INT8_C(  97),  INT8_C(  33), -INT8_C(  86),
+      -INT8_C(  26),  INT8_C(  43), -INT8_C(  81),  INT8_C(  85),  INT8_C(  98), -INT8_C(  68),  INT8_C( 125), -INT8_C(  38),
+       INT8_C(  70), -INT8_C(  71), -INT8_C(   1),  INT8_C( 104),  INT8_C(   6),  INT8_C( 102),  INT8_C(  62),  INT8_C(  81),
+      -INT8_C(  47),  INT8_C(  57), -INT8_C( 100), -INT8_C(  22),  INT8_C( 107),  INT8_C( 110),  INT8_C(  38),  INT8_C(  42),
+       INT8_C(  85),  INT8_C( 124),  INT8_C( 116),  INT8_C(  84),  INT8_C(  27), -INT8_C( 107), -INT8_C(   1),  INT8_C(   2),
+      -INT8_C(  64), -INT8_C(  82),  INT8_C(  87),  INT8_C(  34),  INT8_C( 106), -INT8_C(  43), -INT8_C(   3), -INT8_C(  80),
+      -INT8_C( 114), -INT8_C(   4),  INT8_C(  25), -INT8_C( 108),  INT8_C(  98),  INT8_C(  87), -INT8_C(  27),  INT8_C(  52),
+      -INT8_C( 112), -INT8_C( 127),  INT8_C(  30), -INT8_C(   4), -INT8_C(  17),  INT8_C(  69),  INT8_C(  38),  INT8_C(  68),
+      -INT8_C(  63), -INT8_C( 102), -INT8_C( 103), -INT8_C(  35),  INT8_C(  47), -INT8_C( 104), -INT8_C(  33), -INT8_C(  16),
+       INT8_C(  70),  INT8_C(  54),  INT8_C(  18), -INT8_C(  80),  INT8_C(  11),  INT8_C(  15),  INT8_C(  97), -INT8_C( 103),
+       INT8_C(  12),  INT8_C( 122),  INT8_C(  46),  INT8_C( 110), -INT8_C(  47),  INT8_C(  19), -INT8_C(  94),  INT8_C(  98),
+      -INT8_C( 107), -INT8_C(  63),  INT8_C(  94), -INT8_C( 124),  INT8_C(   6), -INT8_C( 124), -INT8_C(  55), -INT8_C(  57),
+       INT8_C(  31),  INT8_C(  98), -INT8_C(  92),  INT8_C(  78), -INT8_C(   6), -INT8_C( 125),  INT8_C(  62),  INT8_C(  64),
+      -INT8_C(  70),  INT8_C(  81), -INT8_C(  16), -INT8_C(  59),  INT8_C(  96),  INT8_C(  81),  INT8_C(  95),  INT8_C( 108),
+      -INT8_C(  53), -INT8_C( 115), -INT8_C(  37), -INT8_C(  99), -INT8_C(  96),  INT8_C( 125), -INT8_C(   1),  INT8_C(  53),
+       INT8_C(  62),  INT8_C(  93), -INT8_C(  70),  INT8_C(  68), -INT8_C(  31), -INT8_C( 125),  INT8_C(  12),  INT8_C(   0),
+      -INT8_C(  27), -INT8_C(  80),  INT8_C(  79), -INT8_C(  33),  INT8_C(  52), -INT8_C( 115),  INT8_C(  31), -INT8_C(  18),
+      -INT8_C(  34),  INT8_C(  15), -INT8_C(  77),  INT8_C(  63),  INT8_C(  97),  INT8_C(  18), -INT8_C(  85),  INT8_C(  44),
+      -INT8_C(  97), -INT8_C( 122), -INT8_C(  55),  INT8_C(  64),  INT8_C(   4), -INT8_C(  56),  INT8_C( 117),  INT8_C(  66),
+       INT8_C(  37),  INT8_C(  47), -INT8_C( 121),  INT8_C(   7), -INT8_C(  78), -INT8_C( 109),  INT8_C(   7), -INT8_C( 105),
+       INT8_C(  67),  INT8_C(  86),  INT8_C( 118),  INT8_C( 119), -INT8_C(  28), -INT8_C( 107),  INT8_C( 101), -INT8_C(  62),
+      -INT8_C(  91),  INT8_C(  25),  INT8_C(   1),  INT8_C(   6),  INT8_C(  43), -INT8_C(  83),  INT8_C(  50), -INT8_C(  53),
+       INT8_C(  51), -INT8_C(   4),  INT8_C(  11),  INT8_C(  55), -INT8_C(  60),      INT8_MIN,  INT8_C( 122), -INT8_C(  22),
+      -INT8_C(  80),  INT8_C(   1), -INT8_C(  15),  INT8_C(  98), -INT8_C( 108), -INT8_C(   8), -INT8_C(   6), -INT8_C(  41),
+       INT8_C(  79),  INT8_C( 112),  INT8_C(  79),  INT8_C(  51),  INT8_C(   6), -INT8_C(  76), -INT8_C(  11), -INT8_C(  85),
+      -INT8_C(  51), -INT8_C(   9), -INT8_C(  79), -INT8_C(   7), -INT8_C(  92), -INT8_C(  29), -INT8_C(  60), -INT8_C(  41),
+      -INT8_C(  33), -INT8_C(  49),  INT8_C(  15), -INT8_C(  92),  INT8_C(  79), -INT8_C( 119), -INT8_C( 114), -INT8_C(   1),
+      -INT8_C( 118),      INT8_MAX,  INT8_C(  98),  INT8_C(  30),  INT8_C( 119),  INT8_C(  92), -INT8_C(  11), -INT8_C(  58),
+      -INT8_C(  52),  INT8_C(  68), -INT8_C(   7), -INT8_C(  46) };
+  static const int8_t e[] =
+    {  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 110),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 110),  INT8_C(  16),  INT8_C(   0), -INT8_C(  10),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C( 118), -INT8_C( 112), -INT8_C(  24), -INT8_C(  77),  INT8_C(   0),
+      -INT8_C(  62), -INT8_C( 114), -INT8_C(  12),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  12),  INT8_C(  17),  INT8_C(   0), -INT8_C(  98), -INT8_C(  88),  INT8_C( 109),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(  32), -INT8_C( 119),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  68),
+      -INT8_C(  84),  INT8_C(  89),  INT8_C(  62),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 120),  INT8_C(   0),  INT8_C(   0), -INT8_C(  82),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0), -INT8_C( 119),
+       INT8_C(   0), -INT8_C(  96),  INT8_C(   3), -INT8_C(  45),  INT8_C(  72),  INT8_C(   0),  INT8_C(   0), -INT8_C(  57),
+       INT8_C(   0), -INT8_C( 120),  INT8_C(  69),  INT8_C(  96),  INT8_C(   0), -INT8_C( 117),  INT8_C(   0),  INT8_C(  35),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  68), -INT8_C(  42),  INT8_C(   0),  INT8_C(   0), -INT8_C( 107),  INT8_C(   0),
+      -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  51), -INT8_C(  89), -INT8_C(  83),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 112), -INT8_C(  90), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  87),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  40),  INT8_C(  25),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  64),  INT8_C(  66), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  44),  INT8_C(  24),  INT8_C(  10),  INT8_C(   0), -INT8_C( 116),  INT8_C(   0), -INT8_C( 112),
+       INT8_C(   0),  INT8_C(  77),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102),  INT8_C(  30),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 101), -INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  29),  INT8_C(   0),
+      -INT8_C( 119),  INT8_C(  70),  INT8_C(   0),  INT8_C(   0), -INT8_C( 108),  INT8_C(  72),  INT8_C(  61),  INT8_C(  30),
+       INT8_C(  28), -INT8_C( 104), -INT8_C( 100), -INT8_C(  99),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  95),
+       INT8_C(  30),  INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  96), -INT8_C(   6),  INT8_C(   4),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102), -INT8_C(   5), -INT8_C(  23),  INT8_C(   0),
+      -INT8_C(  61),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(  31), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  97), -INT8_C(  31),  INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 113),
+      -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43),  INT8_C(  10),  INT8_C(   0), -INT8_C(  37),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C( 115), -INT8_C(  62),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 118), -INT8_C( 110),  INT8_C(  77), -INT8_C( 114), -INT8_C(  47),  INT8_C(  81),
+      -INT8_C(  80), -INT8_C(  63), -INT8_C(  92), -INT8_C(  98), -INT8_C(  35), -INT8_C( 118), -INT8_C(  99),  INT8_C(   5),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  62),  INT8_C(   0),  INT8_C(   0), -INT8_C(  69),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0), -INT8_C( 119),  INT8_C(   0), -INT8_C(  15), -INT8_C(  46),
+      -INT8_C(  81),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  81),
+       INT8_C(   0), -INT8_C(  37), -INT8_C(  91),  INT8_C(   0), -INT8_C( 115),  INT8_C(   4), -INT8_C(  28), -INT8_C(  94),
+      -INT8_C( 124),  INT8_C(   0), -INT8_C(  29), -INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  91),  INT8_C(  25), -INT8_C( 105),  INT8_C(   0),  INT8_C(  39),  INT8_C(   0),
+       INT8_C(  19),  INT8_C(   0),  INT8_C(  32),  INT8_C(  29), -INT8_C( 102), -INT8_C(  55),  INT8_C(   0), -INT8_C(  86),
+      -INT8_C( 126),  INT8_C(   0), -INT8_C(   3), -INT8_C(  20), -INT8_C(  55),  INT8_C(  35),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),  INT8_C(   7),  INT8_C(   0), -INT8_C(  87), -INT8_C(   1),
+      -INT8_C(  43),  INT8_C(   0), -INT8_C( 113),  INT8_C(   0), -INT8_C(  26),  INT8_C(   0),  INT8_C(  41),  INT8_C(   0),
+      -INT8_C(  81),  INT8_C(   0), -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  12),  INT8_C(   0),
+      -INT8_C( 107),  INT8_C(  26), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  88),  INT8_C(  19),
+       INT8_C(   0),  INT8_C(  61), -INT8_C(  88), -INT8_C( 114),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3), -INT8_C( 114),
+      -INT8_C(  76),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16), -INT8_C(  32),  INT8_C(  39),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  71),  INT8_C(   2),  INT8_C(  97),  INT8_C(   0),  INT8_C(   0), -INT8_C( 103),  INT8_C(   0), -INT8_C( 111),
+       INT8_C(   0), -INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 123),  INT8_C(   0), -INT8_C( 121),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  21),  INT8_C(  26), -INT8_C( 118),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),
+      -INT8_C( 113), -INT8_C(  35), -INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(  54),  INT8_C(  13),  INT8_C(   0),
+       INT8_C(  62),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  15),  INT8_C(   1),  INT8_C(  25),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  25),  INT8_C(   0), -INT8_C(  50), -INT8_C(   1), -INT8_C( 124),  INT8_C(   0), -INT8_C(  86),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  81),  INT8_C(  85),  INT8_C(   0), -INT8_C( 112),  INT8_C(  82),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16), -INT8_C(  74),
+      -INT8_C(  47),  INT8_C(   0),  INT8_C(   0), -INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(  34),  INT8_C(   7),
+       INT8_C(   0), -INT8_C(  98), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0), -INT8_C( 114), -INT8_C(   1), -INT8_C( 125),
+      -INT8_C(  64),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(   0), -INT8_C(  43), -INT8_C(   3),  INT8_C(   0),
+      -INT8_C( 114),  INT8_C(   0),  INT8_C(  25),  INT8_C(   0), -INT8_C(   2),  INT8_C(   0), -INT8_C(  39),  INT8_C(   0),
+           INT8_MIN, -INT8_C( 127),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36), -INT8_C(   8),  INT8_C(   0),
+      -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 120), -INT8_C(  33), -INT8_C(  16),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  18), -INT8_C(  80), -INT8_C(  78),  INT8_C(   0),  INT8_C(  11), -INT8_C( 103),
+       INT8_C(  12),  INT8_C( 122),  INT8_C(  23),  INT8_C(   0), -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(  98),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  94),  INT8_C(   0),  INT8_C(   0), -INT8_C( 124), -INT8_C(  55), -INT8_C(  57),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  92),  INT8_C(   0), -INT8_C(   6), -INT8_C( 125),  INT8_C(  11),  INT8_C(   0),
+      -INT8_C(  70),  INT8_C(  81), -INT8_C(  43), -INT8_C(  59),  INT8_C(   0), -INT8_C(  32),  INT8_C(   0),  INT8_C(  62),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 121),  INT8_C(   0), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16),
+       INT8_C(   0),  INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  12),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  80),  INT8_C(  79), -INT8_C(  33), -INT8_C( 108), -INT8_C( 115),  INT8_C(   0), -INT8_C(  18),
+       INT8_C(   0),  INT8_C(  15),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(  18), -INT8_C(  85),  INT8_C(   0),
+      -INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  42),
+       INT8_C(   0), -INT8_C(  45), -INT8_C( 121),  INT8_C(   7), -INT8_C(  92), -INT8_C( 109),  INT8_C(   7), -INT8_C( 105),
+      -INT8_C(  52),  INT8_C(  86),  INT8_C(  75),  INT8_C(  96),  INT8_C(   0), -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  91),  INT8_C(   0), -INT8_C(  97),  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(   0), -INT8_C(  53),
+       INT8_C(  51), -INT8_C(  67),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  54),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   1), -INT8_C(  15),  INT8_C(  10), -INT8_C( 108), -INT8_C(   8),  INT8_C(   0), -INT8_C( 125),
+       INT8_C(   0),  INT8_C(  73),  INT8_C(   0), -INT8_C(  48), -INT8_C(  34),  INT8_C(   0), -INT8_C( 104),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  92), -INT8_C(  29),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  35),  INT8_C(   0),  INT8_C(  74), -INT8_C( 119),  INT8_C(   0), -INT8_C(  80),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  70),  INT8_C(   0),  INT8_C(   0), -INT8_C(  72), -INT8_C(  11), -INT8_C(  58),
+      -INT8_C(  52), -INT8_C(  27),  INT8_C(   0),  INT8_C(   0) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_s8_z(pv, av, bv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+
+    ev = simde_svmin_s8_z(pv, av, bv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C( 124),  INT8_C(  83),      INT8_MIN, -INT8_C(  34), -INT8_C( 124), -INT8_C(  40), -INT8_C(  59), -INT8_C(  57),
+       INT8_C( 122),  INT8_C(  10),  INT8_C(  30),  INT8_C(  61),  INT8_C(  84),  INT8_C(  35),  INT8_C(  14),  INT8_C(  82),
+       INT8_C(  40),  INT8_C( 116), -INT8_C(  17), -INT8_C(  99),  INT8_C(  93), -INT8_C(  78),  INT8_C(   1), -INT8_C(  10),
+       INT8_C(  41), -INT8_C(  16), -INT8_C(  89), -INT8_C( 119),  INT8_C(  58), -INT8_C(  66),  INT8_C( 113), -INT8_C(  73),
+       INT8_C(  17), -INT8_C(  15), -INT8_C( 107), -INT8_C( 106), -INT8_C(  55),  INT8_C(  90),  INT8_C(  93),  INT8_C(  68),
+       INT8_C( 100),  INT8_C( 124), -INT8_C( 127), -INT8_C(  72), -INT8_C(  97), -INT8_C( 113),  INT8_C(  11), -INT8_C(  57),
+       INT8_C(   3), -INT8_C(   6),  INT8_C( 100),  INT8_C(  96), -INT8_C(  84),  INT8_C( 101),  INT8_C(  86), -INT8_C(  43),
+       INT8_C(  85), -INT8_C(   3),  INT8_C(  94), -INT8_C( 112), -INT8_C(  69), -INT8_C(  49),  INT8_C(  71), -INT8_C(  51),
+      -INT8_C(  64), -INT8_C(  36),  INT8_C(  99), -INT8_C( 118),  INT8_C(  54), -INT8_C(  64), -INT8_C(  50), -INT8_C( 102),
+       INT8_C(  60),  INT8_C(  79),  INT8_C(  82), -INT8_C(  37), -INT8_C(  34),  INT8_C(  93), -INT8_C(  94), -INT8_C(  31),
+       INT8_C(  87),  INT8_C(   7),  INT8_C(  65),  INT8_C(   4),  INT8_C( 108), -INT8_C( 105), -INT8_C(  39), -INT8_C(  62),
+      -INT8_C( 108),  INT8_C(  56),  INT8_C(  82),  INT8_C(  79),  INT8_C(   7), -INT8_C( 103),  INT8_C(  28), -INT8_C(  56),
+       INT8_C( 117),      INT8_MAX,  INT8_C(  82), -INT8_C(  85),  INT8_C(  64),  INT8_C(  32),  INT8_C(  69),  INT8_C( 124),
+       INT8_C( 111), -INT8_C( 105),  INT8_C(  88),  INT8_C(  77), -INT8_C(  11), -INT8_C(   6),  INT8_C(  46),  INT8_C(  76),
+       INT8_C(   1),  INT8_C( 111),  INT8_C(  80),  INT8_C( 110),  INT8_C(   6),  INT8_C(  42),  INT8_C(  48), -INT8_C( 102),
+       INT8_C(  98), -INT8_C( 126), -INT8_C(  23),  INT8_C( 105),  INT8_C(  27),  INT8_C(   6),  INT8_C(  49), -INT8_C( 112),
+      -INT8_C( 123), -INT8_C( 125),  INT8_C(  59), -INT8_C(  59), -INT8_C(  93),      INT8_MIN,  INT8_C(  66),  INT8_C(  18),
+       INT8_C(  23), -INT8_C( 102),  INT8_C(  95),  INT8_C(  12), -INT8_C( 108), -INT8_C( 115),  INT8_C(  89), -INT8_C( 106),
+      -INT8_C(   4), -INT8_C(  87),  INT8_C(   4),  INT8_C(   2), -INT8_C(  45),  INT8_C(  52), -INT8_C( 100),  INT8_C(  53),
+      -INT8_C(  74), -INT8_C( 122), -INT8_C(  97), -INT8_C(  47), -INT8_C( 116), -INT8_C(  48),  INT8_C(  97),  INT8_C(  17),
+       INT8_C(  84), -INT8_C( 100), -INT8_C(  41), -INT8_C(   9),  INT8_C(  28),  INT8_C(  25),  INT8_C(  10),  INT8_C(  51),
+      -INT8_C(  77),  INT8_C( 105),  INT8_C(  64),  INT8_C(  71), -INT8_C(   9), -INT8_C( 103), -INT8_C(  35), -INT8_C(  13),
+       INT8_C(  66), -INT8_C(  31), -INT8_C(  10),  INT8_C(  22),  INT8_C(  21), -INT8_C( 110),  INT8_C(  75), -INT8_C(  53),
+       INT8_C(  24), -INT8_C(  22), -INT8_C( 100), -INT8_C(  92), -INT8_C(  69), -INT8_C(   3), -INT8_C(  74),  INT8_C(  15),
+      -INT8_C( 103), -INT8_C( 115),  INT8_C(   6), -INT8_C(  75), -INT8_C(  90),  INT8_C(  16), -INT8_C(  23),  INT8_C(  89),
+       INT8_C( 122),  INT8_C(  41), -INT8_C(  96),  INT8_C( 113), -INT8_C(  62),  INT8_C( 126),  INT8_C( 100),  INT8_C(   4),
+       INT8_C(  95),  INT8_C(  90),  INT8_C(  26),  INT8_C( 117), -INT8_C(  19),  INT8_C( 102),  INT8_C(  64),  INT8_C(   5),
+       INT8_C(  80), -INT8_C(  35), -INT8_C(  86),  INT8_C(  11), -INT8_C(  38),  INT8_C(  96),  INT8_C(  26),  INT8_C( 116),
+      -INT8_C(  19),  INT8_C(  33),  INT8_C(  41), -INT8_C( 109),  INT8_C(  49),  INT8_C(  18), -INT8_C(  20), -INT8_C(  85),
+       INT8_C(  59), -INT8_C( 116),  INT8_C(  28), -INT8_C(   3),  INT8_C(  10), -INT8_C( 127),  INT8_C(   2),  INT8_C( 106),
+      -INT8_C(  37),  INT8_C(  28), -INT8_C(  33), -INT8_C(  56), -INT8_C( 126),  INT8_C(  31), -INT8_C(  50), -INT8_C(  45),
+      -INT8_C(   4),  INT8_C( 120), -INT8_C(  34), -INT8_C(  41), -INT8_C(  40), -INT8_C(   7),  INT8_C(  75), -INT8_C(  59),
+       INT8_C(  26),  INT8_C( 116),  INT8_C(  88),  INT8_C(  75), -INT8_C( 121),  INT8_C(  68), -INT8_C(   9), -INT8_C(  62),
+      -INT8_C(  48),  INT8_C(  19), -INT8_C(  64), -INT8_C(  37), -INT8_C( 108), -INT8_C(  62),  INT8_C(  69),  INT8_C( 112),
+      -INT8_C(  34),  INT8_C(  36),  INT8_C(  56),  INT8_C(  97),  INT8_C(  67),  INT8_C(   6),  INT8_C(  52),  INT8_C(  64),
+       INT8_C( 126),  INT8_C(  18),  INT8_C(  23),  INT8_C(  86),  INT8_C(  11),  INT8_C(  98),  INT8_C(  27),  INT8_C(  37),
+      -INT8_C(  42),  INT8_C( 115),  INT8_C( 113),  INT8_C(  93), -INT8_C(  73),  INT8_C( 104),  INT8_C(  32), -INT8_C( 120),
+       INT8_C( 123), -INT8_C(  32),  INT8_C(  99),  INT8_C(  16), -INT8_C(  94), -INT8_C(  88),      INT8_MIN,      INT8_MIN,
+      -INT8_C(  52), -INT8_C(  72), -INT8_C(  31),  INT8_C(  15), -INT8_C(  65),  INT8_C(  21),  INT8_C(  79),  INT8_C(  61),
+       INT8_C(  40),  INT8_C( 102), -INT8_C( 108),  INT8_C(  51), -INT8_C(  56), -INT8_C(  81),  INT8_C(  89), -INT8_C(  97),
+       INT8_C(  35), -INT8_C(  54), -INT8_C(   4), -INT8_C(  38),  INT8_C(  50),  INT8_C(  28),  INT8_C(  98), -INT8_C(  83),
+      -INT8_C(   4), -INT8_C(  59), -INT8_C(  67), -INT8_C(  98),  INT8_C( 109),  INT8_C(  61),  INT8_C(  31),  INT8_C(  57),
+      -INT8_C(  10),  INT8_C(   0),  INT8_C(  73), -INT8_C(  75),  INT8_C(  22), -INT8_C( 104), -INT8_C(  14),  INT8_C(  62),
+      -INT8_C(   1), -INT8_C( 122),  INT8_C( 113), -INT8_C(  57),  INT8_C(  54), -INT8_C(  54),  INT8_C( 102),  INT8_C(  89),
+      -INT8_C( 108),  INT8_C(  99),  INT8_C(  51), -INT8_C(  58),      INT8_MAX, -INT8_C( 106),  INT8_C( 116),  INT8_C( 124),
+       INT8_C(  91),  INT8_C(  49),  INT8_C(  26), -INT8_C(  55),  INT8_C( 111),  INT8_C(  57),  INT8_C(   2),  INT8_C( 101),
+       INT8_C(  58),  INT8_C(  75),  INT8_C(  26),  INT8_C(  80), -INT8_C(  28),  INT8_C(  12), -INT8_C( 114), -INT8_C(  29),
+      -INT8_C( 109), -INT8_C(   1), -INT8_C(  86), -INT8_C(  55), -INT8_C(  54),  INT8_C(  17),  INT8_C(  34),  INT8_C(  94),
+       INT8_C( 116),  INT8_C(  85),  INT8_C(  37), -INT8_C(  13), -INT8_C(  21), -INT8_C( 103),  INT8_C( 111),  INT8_C(  71),
+      -INT8_C(  54), -INT8_C( 118),  INT8_C(  16),  INT8_C(  57), -INT8_C(  61),  INT8_C(  18), -INT8_C(  98), -INT8_C(   3),
+       INT8_C(  94), -INT8_C(  72),  INT8_C(  77),  INT8_C(  66), -INT8_C(  59), -INT8_C(  37),  INT8_C(  37),  INT8_C(  88),
+      -INT8_C(  37), -INT8_C(  49),  INT8_C(  33), -INT8_C(  91), -INT8_C(  32),  INT8_C(  67),  INT8_C(   3),  INT8_C(  84),
+      -INT8_C( 104),  INT8_C(  40),  INT8_C(  72), -INT8_C( 124), -INT8_C(  63), -INT8_C(  73), -INT8_C(  53), -INT8_C( 116),
+       INT8_C(  65), -INT8_C(  37), -INT8_C(  59),  INT8_C(   5), -INT8_C(  19),  INT8_C( 100),  INT8_C(   2),  INT8_C(  75),
+       INT8_C(  28),  INT8_C(  80), -INT8_C( 115), -INT8_C(  31),  INT8_C(  43), -INT8_C(  78),  INT8_C(  57),  INT8_C(   6),
+      -INT8_C( 126),  INT8_C(  90), -INT8_C(  85),  INT8_C(  98), -INT8_C(  99), -INT8_C(  81), -INT8_C(  73),  INT8_C(  54),
+      -INT8_C(  41), -INT8_C(   1), -INT8_C(  70), -INT8_C( 103), -INT8_C(  74), -INT8_C( 123),  INT8_C(  37), -INT8_C(   8),
+       INT8_C(  96), -INT8_C(  22), -INT8_C(   3),  INT8_C(  77),  INT8_C(  78), -INT8_C(   1), -INT8_C( 103),  INT8_C( 107),
+       INT8_C(  79),  INT8_C(  38),  INT8_C(  76),  INT8_C( 123), -INT8_C(  39), -INT8_C( 122), -INT8_C( 127),  INT8_C(  91),
+      -INT8_C(  32),  INT8_C(  45), -INT8_C(  67),  INT8_C( 126), -INT8_C(  36),  INT8_C( 116), -INT8_C(  76), -INT8_C(  77),
+       INT8_C( 115),  INT8_C( 110),  INT8_C(  76),  INT8_C(  42), -INT8_C(  13),  INT8_C( 113),  INT8_C(  34),  INT8_C(  83),
+       INT8_C(  92),  INT8_C(  31), -INT8_C(  96), -INT8_C(  86),  INT8_C(  30),  INT8_C(  57),  INT8_C(  21),  INT8_C( 110),
+       INT8_C(  96),  INT8_C(  98), -INT8_C(  23),  INT8_C(  57), -INT8_C(  24),  INT8_C( 106), -INT8_C( 108), -INT8_C(  56),
+      -INT8_C( 105),  INT8_C(  81),  INT8_C(  70),  INT8_C( 115), -INT8_C(  58), -INT8_C(   6),  INT8_C(  39),  INT8_C(  57),
+       INT8_C( 104),  INT8_C( 115),  INT8_C(  99),  INT8_C(  91), -INT8_C(  27), -INT8_C( 123), -INT8_C(  82),  INT8_C(  65),
+      -INT8_C(  92),  INT8_C(  79), -INT8_C(  21), -INT8_C(  61), -INT8_C( 120),  INT8_C(   1),  INT8_C(  49), -INT8_C(  24),
+       INT8_C(  99),  INT8_C(  26),  INT8_C(  33),  INT8_C(  75), -INT8_C( 124), -INT8_C(  75),  INT8_C(  19),  INT8_C(  28),
+       INT8_C(   7),  INT8_C(  90), -INT8_C( 113), -INT8_C(  51),  INT8_C(  84), -INT8_C(  74),  INT8_C(   6), -INT8_C(  67),
+       INT8_C(  42),  INT8_C( 106),  INT8_C(  24),  INT8_C(  15), -INT8_C(  17), -INT8_C(  57),  INT8_C(  80), -INT8_C( 108),
+       INT8_C(  22),  INT8_C(  59),  INT8_C(  87), -INT8_C(  98),  INT8_C(  60), -INT8_C( 120), -INT8_C( 121), -INT8_C(  97),
+      -INT8_C(  94), -INT8_C(  88), -INT8_C(  22),  INT8_C(  38),  INT8_C(  94), -INT8_C(   2),  INT8_C(  66),  INT8_C( 101),
+       INT8_C(  88), -INT8_C(  46),  INT8_C(  50), -INT8_C(  84), -INT8_C( 120),  INT8_C(  56),  INT8_C( 105), -INT8_C(  78),
+      -INT8_C(  94), -INT8_C( 126), -INT8_C(  63), -INT8_C( 110),  INT8_C(  73),  INT8_C(  17),  INT8_C(  38),  INT8_C(  95),
+       INT8_C(  77),  INT8_C( 125), -INT8_C(   3), -INT8_C( 119),  INT8_C(   5), -INT8_C( 124),  INT8_C(  41), -INT8_C(  89),
+       INT8_C(  45),  INT8_C(  19), -INT8_C(  51), -INT8_C( 117),  INT8_C(  17),  INT8_C(  16), -INT8_C(  16),  INT8_C( 105),
+      -INT8_C(  30),  INT8_C(  34),  INT8_C(  22),  INT8_C( 106),  INT8_C(  90),      INT8_MAX,  INT8_C(  29), -INT8_C(   3),
+       INT8_C(   1), -INT8_C(  34), -INT8_C( 113),  INT8_C(  74), -INT8_C(  16), -INT8_C(  75), -INT8_C(  87),  INT8_C(  61),
+       INT8_C(  50), -INT8_C(  89), -INT8_C(  58),  INT8_C(  55),  INT8_C(  43), -INT8_C(  17), -INT8_C(  34),  INT8_C(  88),
+       INT8_C(   3), -INT8_C(  85), -INT8_C(  29),  INT8_C(  20), -INT8_C(  69), -INT8_C(  45),  INT8_C( 126), -INT8_C(  99),
+      -INT8_C(  11), -INT8_C( 108),  INT8_C(   8),  INT8_C(  80),  INT8_C(  19),  INT8_C(  37),  INT8_C(  77),  INT8_C(  21),
+       INT8_C(   3), -INT8_C(  36),  INT8_C(  95), -INT8_C(  13), -INT8_C( 111),  INT8_C(   9),  INT8_C(  48), -INT8_C(  61),
+      -INT8_C(  80), -INT8_C(   9), -INT8_C(   6), -INT8_C(  37), -INT8_C(  26), -INT8_C(  40),  INT8_C(  52), -INT8_C(  23),
+      -INT8_C( 125),  INT8_C(  23), -INT8_C(   2),  INT8_C(  63), -INT8_C(  21),  INT8_C( 124), -INT8_C(  36), -INT8_C(  32),
+       INT8_C(  16), -INT8_C(  28),  INT8_C(  48),  INT8_C(  35),  INT8_C(   9),  INT8_C( 125),  INT8_C(  56),  INT8_C(  13),
+       INT8_C(  89), -INT8_C( 104),  INT8_C(   0), -INT8_C(  22), -INT8_C(  95),  INT8_C(  49), -INT8_C(  83),  INT8_C(  81),
+       INT8_C(  40), -INT8_C(  89),  INT8_C(  44),  INT8_C(  14) };
+  static const int8_t b[] =
+    {  INT8_C( 107),  INT8_C( 102), -INT8_C( 114), -INT8_C( 100),  INT8_C( 124), -INT8_C(  94),  INT8_C(  47), -INT8_C(  29),
+      -INT8_C(   4),  INT8_C(  80), -INT8_C(   6), -INT8_C(  38), -INT8_C(  82),  INT8_C(  89),  INT8_C(  60),  INT8_C(  56),
+      -INT8_C(  88),  INT8_C(  38), -INT8_C(  83),  INT8_C(  79), -INT8_C(  56),  INT8_C( 105),  INT8_C( 104),  INT8_C(   2),
+       INT8_C(   1),  INT8_C(  97), -INT8_C(  91), -INT8_C( 116), -INT8_C(  65),  INT8_C( 121), -INT8_C(  85),  INT8_C(  42),
+      -INT8_C(  33),  INT8_C(  57), -INT8_C(  58),  INT8_C(  92), -INT8_C(  37), -INT8_C(  10),  INT8_C(  63), -INT8_C(  40),
+       INT8_C(  70),  INT8_C(  57), -INT8_C(  78), -INT8_C(  12), -INT8_C( 110), -INT8_C(  17),  INT8_C(  44),  INT8_C(  58),
+       INT8_C(  21), -INT8_C(  38), -INT8_C( 118), -INT8_C(  34),  INT8_C(  67), -INT8_C(  14), -INT8_C(  32),  INT8_C(  68),
+       INT8_C(  83), -INT8_C( 122), -INT8_C(  48),  INT8_C(  19), -INT8_C(   1),  INT8_C( 123),  INT8_C(  61), -INT8_C(  33),
+      -INT8_C(  75),  INT8_C(   4),  INT8_C(  59), -INT8_C( 112), -INT8_C(   6),  INT8_C( 122),  INT8_C( 104),  INT8_C(  64),
+      -INT8_C(  76),  INT8_C(  27),  INT8_C(  52),  INT8_C(  70),  INT8_C(  10),  INT8_C(  97), -INT8_C( 127),  INT8_C(  31),
+       INT8_C(  59),  INT8_C(  11), -INT8_C(   3),  INT8_C( 126), -INT8_C(   3), -INT8_C(  34), -INT8_C(  61),  INT8_C(  81),
+       INT8_C( 100), -INT8_C( 109),  INT8_C( 100),  INT8_C(  99),  INT8_C(  15), -INT8_C(  95),  INT8_C(  66), -INT8_C(  60),
+      -INT8_C(  91),  INT8_C( 125),  INT8_C(  84), -INT8_C(  97), -INT8_C(   8), -INT8_C(  67), -INT8_C(  33), -INT8_C(  84),
+      -INT8_C(  40),  INT8_C(  20), -INT8_C(  14), -INT8_C(  30),  INT8_C( 117),  INT8_C( 115),  INT8_C(   1), -INT8_C(  80),
+       INT8_C( 126), -INT8_C(   1),  INT8_C(  46),  INT8_C( 124), -INT8_C(  35), -INT8_C(  15), -INT8_C(  51),  INT8_C(  65),
+      -INT8_C( 123),  INT8_C(  49), -INT8_C(  92), -INT8_C( 108), -INT8_C(  46), -INT8_C(  25),  INT8_C(  88),  INT8_C( 120),
+       INT8_C( 100), -INT8_C(  84),  INT8_C(  23),  INT8_C(  92),  INT8_C( 105), -INT8_C(   9),  INT8_C(   8),  INT8_C(  65),
+       INT8_C(  11), -INT8_C(   5),  INT8_C(  35),      INT8_MIN,  INT8_C( 110),  INT8_C(  37),  INT8_C(  48), -INT8_C(  19),
+       INT8_C(  36),  INT8_C(  94),  INT8_C( 105),  INT8_C(   1),  INT8_C(  80),  INT8_C(  54),  INT8_C(  66), -INT8_C(  43),
+       INT8_C( 103), -INT8_C(  26),  INT8_C( 105),  INT8_C(  57), -INT8_C(  51), -INT8_C(  63), -INT8_C(  79),  INT8_C(  50),
+       INT8_C( 109), -INT8_C(  55), -INT8_C( 114), -INT8_C(  41), -INT8_C(  64), -INT8_C( 105),  INT8_C(  24), -INT8_C(  53),
+      -INT8_C( 110),  INT8_C(  60),  INT8_C(  75),  INT8_C(   0),  INT8_C(  97),  INT8_C( 123), -INT8_C(  19), -INT8_C( 123),
+      -INT8_C(  39),  INT8_C(  86), -INT8_C( 122),  INT8_C(  41), -INT8_C( 116), -INT8_C(  56), -INT8_C(   2), -INT8_C(  13),
+      -INT8_C(  82),  INT8_C( 103),  INT8_C(  45),  INT8_C( 124),  INT8_C(  40), -INT8_C(  34), -INT8_C(  82), -INT8_C( 106),
+      -INT8_C(  89),  INT8_C(  60),  INT8_C( 109),  INT8_C( 103), -INT8_C(  45), -INT8_C( 123),  INT8_C(  50),  INT8_C( 101),
+      -INT8_C(  63),  INT8_C( 125),  INT8_C( 102),  INT8_C(  34), -INT8_C(   8),  INT8_C(  83), -INT8_C(  89), -INT8_C(  46),
+      -INT8_C(  86),  INT8_C(  45), -INT8_C(   5),  INT8_C(  54), -INT8_C(  11), -INT8_C(   6),  INT8_C(  42), -INT8_C(  92),
+       INT8_C(  97),  INT8_C(  87),  INT8_C(  32), -INT8_C( 118),  INT8_C(  53), -INT8_C(  50),  INT8_C(  32), -INT8_C(  35),
+       INT8_C(  10), -INT8_C( 115),  INT8_C(  68), -INT8_C(  34),  INT8_C(  18),  INT8_C( 119),  INT8_C(  67), -INT8_C(  44),
+      -INT8_C(  12), -INT8_C(  87), -INT8_C(  10), -INT8_C(  19), -INT8_C(   3), -INT8_C(  98), -INT8_C(  65), -INT8_C(  89),
+      -INT8_C(  53), -INT8_C(  70), -INT8_C(  35), -INT8_C(  63), -INT8_C(  76),  INT8_C(   7),  INT8_C( 101),  INT8_C(  22),
+       INT8_C(  94), -INT8_C( 123), -INT8_C(  96), -INT8_C( 108),  INT8_C(  83), -INT8_C(  64),  INT8_C( 113),  INT8_C(  93),
+       INT8_C(  77), -INT8_C(  75),  INT8_C(  59),  INT8_C(  95),  INT8_C(  44),      INT8_MAX,  INT8_C(  51),  INT8_C(  33),
+       INT8_C(  40),  INT8_C(  42),  INT8_C(  14),  INT8_C(  37), -INT8_C(  56), -INT8_C(  51), -INT8_C(  52), -INT8_C( 109),
+      -INT8_C( 121), -INT8_C(  86),  INT8_C(  84),  INT8_C(  60), -INT8_C(  79), -INT8_C(  71),  INT8_C(  82),  INT8_C(  16),
+       INT8_C(  62), -INT8_C(  14), -INT8_C(  92), -INT8_C( 111), -INT8_C(  78),  INT8_C(  21), -INT8_C(  17), -INT8_C(   1),
+      -INT8_C(  54),  INT8_C(  42),  INT8_C(  94), -INT8_C(   9), -INT8_C(  87), -INT8_C( 110),  INT8_C(  24), -INT8_C(  46),
+      -INT8_C(  68),  INT8_C(  38), -INT8_C(   9), -INT8_C( 124), -INT8_C(  13), -INT8_C(  60),  INT8_C(  23),  INT8_C( 122),
+       INT8_C( 110),  INT8_C( 108), -INT8_C(  74),  INT8_C(  31),  INT8_C(  37),  INT8_C(   8),  INT8_C(  47),  INT8_C( 100),
+      -INT8_C(   6), -INT8_C(  45), -INT8_C(  11), -INT8_C(  84), -INT8_C(  24), -INT8_C(  28), -INT8_C(  85), -INT8_C(  77),
+       INT8_C(  15),  INT8_C(  10), -INT8_C(  86), -INT8_C(  72), -INT8_C( 100), -INT8_C(  62), -INT8_C( 118),  INT8_C(  88),
+      -INT8_C(  24), -INT8_C( 126), -INT8_C(  36), -INT8_C(  37),  INT8_C(  70), -INT8_C(  13),  INT8_C(  85), -INT8_C(  76),
+       INT8_C(  95),  INT8_C(  12), -INT8_C(  45), -INT8_C( 123),  INT8_C(  20),  INT8_C(   3), -INT8_C(  23),  INT8_C(  15),
+      -INT8_C(  42), -INT8_C(  34), -INT8_C(  69), -INT8_C(  65), -INT8_C(  61),  INT8_C( 103),  INT8_C( 114), -INT8_C(  46),
+       INT8_C( 113),  INT8_C(  28), -INT8_C( 118),  INT8_C(  13), -INT8_C(  34),  INT8_C(  21),  INT8_C( 101), -INT8_C(  58),
+      -INT8_C( 105),  INT8_C(  65), -INT8_C(  95), -INT8_C(  35),  INT8_C(  52), -INT8_C(  10), -INT8_C( 111), -INT8_C( 108),
+       INT8_C(   2),  INT8_C( 100),  INT8_C(  25),  INT8_C(  23),  INT8_C( 103),  INT8_C(   2),  INT8_C(  38),  INT8_C(  62),
+      -INT8_C(  32), -INT8_C(  31), -INT8_C(   3), -INT8_C(  93),  INT8_C(  72),  INT8_C( 111),  INT8_C( 117), -INT8_C(  71),
+      -INT8_C( 117),  INT8_C(   0), -INT8_C(  58),  INT8_C( 105),  INT8_C(  21),  INT8_C(  43),  INT8_C(  47), -INT8_C(  84),
+       INT8_C( 108), -INT8_C(  48), -INT8_C( 119), -INT8_C(  95), -INT8_C(  58),  INT8_C(  26),  INT8_C(  53), -INT8_C(  55),
+       INT8_C( 126),  INT8_C(  78), -INT8_C(  32), -INT8_C(  26),  INT8_C(  80),  INT8_C(   6),  INT8_C(  36),  INT8_C(  48),
+      -INT8_C(  25),  INT8_C(  33), -INT8_C(  44),  INT8_C(  48), -INT8_C( 112),  INT8_C(  73), -INT8_C(  23),  INT8_C(  27),
+       INT8_C(  73), -INT8_C(  80), -INT8_C( 124),  INT8_C(  94), -INT8_C(  37), -INT8_C(  77),  INT8_C(  10),  INT8_C(  72),
+      -INT8_C( 125), -INT8_C( 109), -INT8_C(  23),  INT8_C(  73), -INT8_C(  83),  INT8_C(  30),  INT8_C(  18),  INT8_C(  44),
+       INT8_C( 108), -INT8_C(  14),  INT8_C(  18), -INT8_C(  68), -INT8_C(   8),  INT8_C(  54), -INT8_C(  20), -INT8_C(  32),
+       INT8_C(  87), -INT8_C(  64),  INT8_C(  16), -INT8_C(  25),  INT8_C(  10), -INT8_C(   7),  INT8_C(   2),  INT8_C(  83),
+      -INT8_C(  87), -INT8_C( 122), -INT8_C(  78), -INT8_C( 123),  INT8_C(  57), -INT8_C(  68), -INT8_C(  51), -INT8_C(  68),
+       INT8_C(  80), -INT8_C(  74),  INT8_C(   5), -INT8_C(   3), -INT8_C(  44),  INT8_C(  24),  INT8_C(  41),  INT8_C(  64),
+       INT8_C(  10),  INT8_C(  59), -INT8_C(   4),  INT8_C(   3),  INT8_C( 113), -INT8_C(  24), -INT8_C(  29), -INT8_C(  56),
+      -INT8_C(  87), -INT8_C(  13), -INT8_C(  81), -INT8_C(  77), -INT8_C(  20), -INT8_C(  79),  INT8_C(   6), -INT8_C( 106),
+       INT8_C(  55), -INT8_C(  72),  INT8_C(  27),  INT8_C( 112),  INT8_C( 117), -INT8_C(  24),  INT8_C(  44), -INT8_C(  59),
+      -INT8_C(  98),  INT8_C(  50), -INT8_C(  62),  INT8_C( 114),  INT8_C(  74), -INT8_C(  20), -INT8_C(  78),  INT8_C(  84),
+       INT8_C(  39), -INT8_C(  82),  INT8_C(  87), -INT8_C( 103), -INT8_C( 106),  INT8_C(  58),  INT8_C(  97),  INT8_C(  63),
+       INT8_C(  45),  INT8_C(  17), -INT8_C(  14),  INT8_C(  26), -INT8_C(  62), -INT8_C(   7), -INT8_C(  80), -INT8_C(   6),
+      -INT8_C(  79), -INT8_C(  53),  INT8_C( 106),  INT8_C(  38), -INT8_C(  77), -INT8_C( 105), -INT8_C(  21),  INT8_C(  81),
+      -INT8_C(  55), -INT8_C(  82), -INT8_C(  61),  INT8_C(  19), -INT8_C( 102),  INT8_C( 117),  INT8_C( 103), -INT8_C(  63),
+       INT8_C(  35), -INT8_C(  65),  INT8_C(  90), -INT8_C(  71), -INT8_C(   7), -INT8_C(  68), -INT8_C(   7),  INT8_C(  39),
+      -INT8_C(  51), -INT8_C(  21),  INT8_C(  65), -INT8_C( 113), -INT8_C(  28), -INT8_C(  15), -INT8_C( 119), -INT8_C( 106),
+      -INT8_C(  68), -INT8_C(  12), -INT8_C(  68),  INT8_C( 111), -INT8_C( 117), -INT8_C(  88), -INT8_C(  64),  INT8_C(  84),
+       INT8_C(  86), -INT8_C( 125),  INT8_C( 103), -INT8_C(  16), -INT8_C(   8), -INT8_C(  50), -INT8_C(  79),  INT8_C(  27),
+      -INT8_C( 115),  INT8_C(  12), -INT8_C(  44), -INT8_C( 121), -INT8_C(  56), -INT8_C(  51), -INT8_C(  82), -INT8_C( 107),
+      -INT8_C(  71), -INT8_C(  17),  INT8_C(  36), -INT8_C(  99), -INT8_C(  32), -INT8_C(  82),  INT8_C(  51), -INT8_C( 100),
+      -INT8_C(  94), -INT8_C(  16),  INT8_C(  11),  INT8_C(  45), -INT8_C( 104), -INT8_C(  53), -INT8_C( 127), -INT8_C(  18),
+       INT8_C(  78), -INT8_C(  24), -INT8_C(  34),  INT8_C(  70), -INT8_C(  74), -INT8_C( 113),  INT8_C(  97),  INT8_C(  68),
+      -INT8_C( 101),  INT8_C(  53), -INT8_C(  53),  INT8_C(  99),  INT8_C(   3),  INT8_C( 121), -INT8_C(   8), -INT8_C(  68),
+       INT8_C( 104),  INT8_C(  29),  INT8_C(  89),  INT8_C(  72), -INT8_C(  53), -INT8_C( 115), -INT8_C(  28),  INT8_C( 109),
+       INT8_C( 125), -INT8_C(  17), -INT8_C( 102),  INT8_C(  21), -INT8_C(  70),  INT8_C(  27),  INT8_C(   3),  INT8_C(   8),
+       INT8_C(   3), -INT8_C(  31),  INT8_C(  78), -INT8_C(  71),  INT8_C( 112), -INT8_C(  81), -INT8_C(   3),  INT8_C(  12),
+      -INT8_C(  28), -INT8_C(  56),  INT8_C( 111), -INT8_C(  25),  INT8_C(  65),  INT8_C( 104), -INT8_C(  93), -INT8_C(  87),
+      -INT8_C( 123), -INT8_C(   3), -INT8_C(  15),  INT8_C(  80), -INT8_C( 118), -INT8_C(  43), -INT8_C(  67),  INT8_C(   7),
+      -INT8_C(  60),  INT8_C(  87),  INT8_C(  28),  INT8_C( 126),  INT8_C( 114),  INT8_C(  31), -INT8_C( 122),  INT8_C( 117),
+       INT8_C(   0), -INT8_C(  44),  INT8_C(  46),  INT8_C( 112), -INT8_C( 125),  INT8_C(  44),  INT8_C( 124),  INT8_C( 104),
+      -INT8_C(  12), -INT8_C(  20),  INT8_C(  79),  INT8_C(  54),  INT8_C(  84), -INT8_C(  13), -INT8_C(  33), -INT8_C(  39),
+      -INT8_C(  16), -INT8_C(  47),  INT8_C(  41),  INT8_C( 122), -INT8_C(  90), -INT8_C(  26), -INT8_C( 127),  INT8_C( 107),
+       INT8_C(  61), -INT8_C(  99), -INT8_C(  23), -INT8_C(  81), -INT8_C(  68),  INT8_C( 112),  INT8_C(  36), -INT8_C(  68),
+       INT8_C(  68),  INT8_C(  82),  INT8_C(  44), -INT8_C(  56) };
+  static const int8_t e[] =
+    {  INT8_C( 124),  INT8_C(  83),      INT8_MIN, -INT8_C( 100), -INT8_C( 124), -INT8_C(  94), -INT8_C(  59), -INT8_C(  57),
+      -INT8_C(   4),  INT8_C(  10),  INT8_C(  30), -INT8_C(  38), -INT8_C(  82),  INT8_C(  35),  INT8_C(  14),  INT8_C(  82),
+       INT8_C(  40),  INT8_C( 116), -INT8_C(  83), -INT8_C(  99),  INT8_C(  93), -INT8_C(  78),  INT8_C(   1), -INT8_C(  10),
+       INT8_C(  41), -INT8_C(  16), -INT8_C(  89), -INT8_C( 119),  INT8_C(  58), -INT8_C(  66), -INT8_C(  85), -INT8_C(  73),
+       INT8_C(  17), -INT8_C(  15), -INT8_C( 107), -INT8_C( 106), -INT8_C(  55),  INT8_C(  90),  INT8_C(  93),  INT8_C(  68),
+       INT8_C(  70),  INT8_C( 124), -INT8_C( 127), -INT8_C(  72), -INT8_C( 110), -INT8_C( 113),  INT8_C(  11), -INT8_C(  57),
+       INT8_C(   3), -INT8_C(   6), -INT8_C( 118), -INT8_C(  34), -INT8_C(  84),  INT8_C( 101),  INT8_C(  86), -INT8_C(  43),
+       INT8_C(  85), -INT8_C( 122), -INT8_C(  48), -INT8_C( 112), -INT8_C(  69), -INT8_C(  49),  INT8_C(  71), -INT8_C(  51),
+      -INT8_C(  64), -INT8_C(  36),  INT8_C(  99), -INT8_C( 118), -INT8_C(   6), -INT8_C(  64), -INT8_C(  50), -INT8_C( 102),
+      -INT8_C(  76),  INT8_C(  27),  INT8_C(  82), -INT8_C(  37), -INT8_C(  34),  INT8_C(  93), -INT8_C( 127), -INT8_C(  31),
+       INT8_C(  59),  INT8_C(   7),  INT8_C(  65),  INT8_C(   4), -INT8_C(   3), -INT8_C( 105), -INT8_C(  39), -INT8_C(  62),
+      -INT8_C( 108), -INT8_C( 109),  INT8_C(  82),  INT8_C(  79),  INT8_C(   7), -INT8_C( 103),  INT8_C(  28), -INT8_C(  60),
+       INT8_C( 117),  INT8_C( 125),  INT8_C(  82), -INT8_C(  85),  INT8_C(  64),  INT8_C(  32),  INT8_C(  69), -INT8_C(  84),
+      -INT8_C(  40), -INT8_C( 105),  INT8_C(  88),  INT8_C(  77), -INT8_C(  11), -INT8_C(   6),  INT8_C(   1),  INT8_C(  76),
+       INT8_C(   1), -INT8_C(   1),  INT8_C(  80),  INT8_C( 110),  INT8_C(   6),  INT8_C(  42), -INT8_C(  51), -INT8_C( 102),
+      -INT8_C( 123), -INT8_C( 126), -INT8_C(  92), -INT8_C( 108),  INT8_C(  27), -INT8_C(  25),  INT8_C(  49), -INT8_C( 112),
+      -INT8_C( 123), -INT8_C( 125),  INT8_C(  59), -INT8_C(  59), -INT8_C(  93),      INT8_MIN,  INT8_C(  66),  INT8_C(  18),
+       INT8_C(  11), -INT8_C( 102),  INT8_C(  95),      INT8_MIN, -INT8_C( 108), -INT8_C( 115),  INT8_C(  89), -INT8_C( 106),
+      -INT8_C(   4), -INT8_C(  87),  INT8_C(   4),  INT8_C(   1), -INT8_C(  45),  INT8_C(  52), -INT8_C( 100),  INT8_C(  53),
+      -INT8_C(  74), -INT8_C( 122), -INT8_C(  97), -INT8_C(  47), -INT8_C( 116), -INT8_C(  48), -INT8_C(  79),  INT8_C(  17),
+       INT8_C(  84), -INT8_C( 100), -INT8_C( 114), -INT8_C(  41),  INT8_C(  28),  INT8_C(  25),  INT8_C(  10),  INT8_C(  51),
+      -INT8_C(  77),  INT8_C(  60),  INT8_C(  64),  INT8_C(  71), -INT8_C(   9), -INT8_C( 103), -INT8_C(  35), -INT8_C(  13),
+      -INT8_C(  39), -INT8_C(  31), -INT8_C(  10),  INT8_C(  22), -INT8_C( 116), -INT8_C( 110),  INT8_C(  75), -INT8_C(  53),
+      -INT8_C(  82), -INT8_C(  22), -INT8_C( 100), -INT8_C(  92), -INT8_C(  69), -INT8_C(  34), -INT8_C(  74),  INT8_C(  15),
+      -INT8_C( 103), -INT8_C( 115),  INT8_C(   6), -INT8_C(  75), -INT8_C(  90),  INT8_C(  16), -INT8_C(  23),  INT8_C(  89),
+       INT8_C( 122),  INT8_C(  41), -INT8_C(  96),  INT8_C( 113), -INT8_C(  62),  INT8_C(  83), -INT8_C(  89),  INT8_C(   4),
+      -INT8_C(  86),  INT8_C(  45),  INT8_C(  26),  INT8_C(  54), -INT8_C(  19),  INT8_C( 102),  INT8_C(  42),  INT8_C(   5),
+       INT8_C(  80), -INT8_C(  35), -INT8_C(  86),  INT8_C(  11), -INT8_C(  38),  INT8_C(  96),  INT8_C(  26),  INT8_C( 116),
+      -INT8_C(  19),  INT8_C(  33),  INT8_C(  41), -INT8_C( 109),  INT8_C(  18),  INT8_C(  18), -INT8_C(  20), -INT8_C(  85),
+       INT8_C(  59), -INT8_C( 116),  INT8_C(  28), -INT8_C(   3), -INT8_C(   3), -INT8_C( 127),  INT8_C(   2), -INT8_C(  89),
+      -INT8_C(  37),  INT8_C(  28), -INT8_C(  35), -INT8_C(  63), -INT8_C( 126),  INT8_C(  31), -INT8_C(  50), -INT8_C(  45),
+      -INT8_C(   4), -INT8_C( 123), -INT8_C(  34), -INT8_C(  41), -INT8_C(  40), -INT8_C(  64),  INT8_C(  75), -INT8_C(  59),
+       INT8_C(  26),  INT8_C( 116),  INT8_C(  88),  INT8_C(  75), -INT8_C( 121),  INT8_C(  68), -INT8_C(   9), -INT8_C(  62),
+      -INT8_C(  48),  INT8_C(  19), -INT8_C(  64), -INT8_C(  37), -INT8_C( 108), -INT8_C(  62), -INT8_C(  52), -INT8_C( 109),
+      -INT8_C(  34),  INT8_C(  36),  INT8_C(  56),  INT8_C(  97), -INT8_C(  79),  INT8_C(   6),  INT8_C(  52),  INT8_C(  16),
+       INT8_C( 126), -INT8_C(  14),  INT8_C(  23),  INT8_C(  86),  INT8_C(  11),  INT8_C(  98), -INT8_C(  17), -INT8_C(   1),
+      -INT8_C(  54),  INT8_C(  42),  INT8_C( 113), -INT8_C(   9), -INT8_C(  87), -INT8_C( 110),  INT8_C(  24), -INT8_C( 120),
+      -INT8_C(  68), -INT8_C(  32), -INT8_C(   9),  INT8_C(  16), -INT8_C(  94), -INT8_C(  88),      INT8_MIN,      INT8_MIN,
+      -INT8_C(  52), -INT8_C(  72), -INT8_C(  31),  INT8_C(  15), -INT8_C(  65),  INT8_C(   8),  INT8_C(  79),  INT8_C(  61),
+       INT8_C(  40), -INT8_C(  45), -INT8_C( 108), -INT8_C(  84), -INT8_C(  56), -INT8_C(  81),  INT8_C(  89), -INT8_C(  97),
+       INT8_C(  35), -INT8_C(  54), -INT8_C(   4), -INT8_C(  72),  INT8_C(  50),  INT8_C(  28), -INT8_C( 118), -INT8_C(  83),
+      -INT8_C(  24), -INT8_C( 126), -INT8_C(  67), -INT8_C(  98),  INT8_C( 109), -INT8_C(  13),  INT8_C(  31),  INT8_C(  57),
+      -INT8_C(  10),  INT8_C(   0), -INT8_C(  45), -INT8_C(  75),  INT8_C(  22), -INT8_C( 104), -INT8_C(  14),  INT8_C(  15),
+      -INT8_C(  42), -INT8_C( 122),  INT8_C( 113), -INT8_C(  65), -INT8_C(  61), -INT8_C(  54),  INT8_C( 102), -INT8_C(  46),
+      -INT8_C( 108),  INT8_C(  28),  INT8_C(  51), -INT8_C(  58),      INT8_MAX, -INT8_C( 106),  INT8_C( 101), -INT8_C(  58),
+       INT8_C(  91),  INT8_C(  49),  INT8_C(  26), -INT8_C(  55),  INT8_C(  52), -INT8_C(  10), -INT8_C( 111), -INT8_C( 108),
+       INT8_C(  58),  INT8_C(  75),  INT8_C(  25),  INT8_C(  23), -INT8_C(  28),  INT8_C(   2), -INT8_C( 114), -INT8_C(  29),
+      -INT8_C( 109), -INT8_C(  31), -INT8_C(  86), -INT8_C(  93), -INT8_C(  54),  INT8_C(  17),  INT8_C(  34), -INT8_C(  71),
+      -INT8_C( 117),  INT8_C(   0),  INT8_C(  37), -INT8_C(  13), -INT8_C(  21), -INT8_C( 103),  INT8_C(  47),  INT8_C(  71),
+      -INT8_C(  54), -INT8_C( 118), -INT8_C( 119),  INT8_C(  57), -INT8_C(  61),  INT8_C(  18), -INT8_C(  98), -INT8_C(   3),
+       INT8_C(  94), -INT8_C(  72),  INT8_C(  77), -INT8_C(  26), -INT8_C(  59), -INT8_C(  37),  INT8_C(  36),  INT8_C(  88),
+      -INT8_C(  37), -INT8_C(  49),  INT8_C(  33), -INT8_C(  91), -INT8_C( 112),  INT8_C(  67),  INT8_C(   3),  INT8_C(  27),
+      -INT8_C( 104), -INT8_C(  80),  INT8_C(  72), -INT8_C( 124), -INT8_C(  63), -INT8_C(  77), -INT8_C(  53), -INT8_C( 116),
+       INT8_C(  65), -INT8_C( 109), -INT8_C(  59),  INT8_C(   5), -INT8_C(  19),  INT8_C( 100),  INT8_C(   2),  INT8_C(  75),
+       INT8_C(  28), -INT8_C(  14), -INT8_C( 115), -INT8_C(  31),  INT8_C(  43), -INT8_C(  78),  INT8_C(  57),  INT8_C(   6),
+      -INT8_C( 126),  INT8_C(  90), -INT8_C(  85), -INT8_C(  25), -INT8_C(  99), -INT8_C(  81), -INT8_C(  73),  INT8_C(  54),
+      -INT8_C(  41), -INT8_C(   1), -INT8_C(  70), -INT8_C( 123), -INT8_C(  74), -INT8_C( 123), -INT8_C(  51), -INT8_C(   8),
+       INT8_C(  96), -INT8_C(  22), -INT8_C(   3), -INT8_C(   3), -INT8_C(  44), -INT8_C(   1), -INT8_C( 103),  INT8_C( 107),
+       INT8_C(  10),  INT8_C(  38),  INT8_C(  76),  INT8_C( 123), -INT8_C(  39), -INT8_C( 122), -INT8_C( 127),  INT8_C(  91),
+      -INT8_C(  32), -INT8_C(  13), -INT8_C(  81),  INT8_C( 126), -INT8_C(  36),  INT8_C( 116), -INT8_C(  76), -INT8_C(  77),
+       INT8_C(  55), -INT8_C(  72),  INT8_C(  27),  INT8_C(  42), -INT8_C(  13), -INT8_C(  24),  INT8_C(  34),  INT8_C(  83),
+       INT8_C(  92),  INT8_C(  31), -INT8_C(  96), -INT8_C(  86),  INT8_C(  30),  INT8_C(  57),  INT8_C(  21),  INT8_C( 110),
+       INT8_C(  39),  INT8_C(  98), -INT8_C(  23),  INT8_C(  57), -INT8_C(  24),  INT8_C(  58), -INT8_C( 108), -INT8_C(  56),
+      -INT8_C( 105),  INT8_C(  81),  INT8_C(  70),  INT8_C( 115), -INT8_C(  58), -INT8_C(   6),  INT8_C(  39), -INT8_C(   6),
+      -INT8_C(  79),  INT8_C( 115),  INT8_C(  99),  INT8_C(  91), -INT8_C(  27), -INT8_C( 123), -INT8_C(  82),  INT8_C(  65),
+      -INT8_C(  92), -INT8_C(  82), -INT8_C(  21), -INT8_C(  61), -INT8_C( 120),  INT8_C(   1),  INT8_C(  49), -INT8_C(  24),
+       INT8_C(  35), -INT8_C(  65),  INT8_C(  33),  INT8_C(  75), -INT8_C( 124), -INT8_C(  75),  INT8_C(  19),  INT8_C(  28),
+       INT8_C(   7),  INT8_C(  90), -INT8_C( 113), -INT8_C(  51), -INT8_C(  28), -INT8_C(  74),  INT8_C(   6), -INT8_C( 106),
+       INT8_C(  42),  INT8_C( 106), -INT8_C(  68),  INT8_C(  15), -INT8_C( 117), -INT8_C(  57),  INT8_C(  80), -INT8_C( 108),
+       INT8_C(  22), -INT8_C( 125),  INT8_C(  87), -INT8_C(  98),  INT8_C(  60), -INT8_C( 120), -INT8_C( 121), -INT8_C(  97),
+      -INT8_C( 115), -INT8_C(  88), -INT8_C(  44), -INT8_C( 121), -INT8_C(  56), -INT8_C(  51),  INT8_C(  66), -INT8_C( 107),
+       INT8_C(  88), -INT8_C(  46),  INT8_C(  36), -INT8_C(  84), -INT8_C( 120),  INT8_C(  56),  INT8_C(  51), -INT8_C( 100),
+      -INT8_C(  94), -INT8_C( 126), -INT8_C(  63), -INT8_C( 110),  INT8_C(  73),  INT8_C(  17),  INT8_C(  38),  INT8_C(  95),
+       INT8_C(  77),  INT8_C( 125), -INT8_C(  34), -INT8_C( 119),  INT8_C(   5), -INT8_C( 124),  INT8_C(  41), -INT8_C(  89),
+      -INT8_C( 101),  INT8_C(  19), -INT8_C(  51), -INT8_C( 117),  INT8_C(  17),  INT8_C(  16), -INT8_C(  16),  INT8_C( 105),
+      -INT8_C(  30),  INT8_C(  29),  INT8_C(  22),  INT8_C( 106),  INT8_C(  90),      INT8_MAX,  INT8_C(  29), -INT8_C(   3),
+       INT8_C(   1), -INT8_C(  34), -INT8_C( 113),  INT8_C(  74), -INT8_C(  70), -INT8_C(  75), -INT8_C(  87),  INT8_C(   8),
+       INT8_C(   3), -INT8_C(  89), -INT8_C(  58), -INT8_C(  71),  INT8_C(  43), -INT8_C(  81), -INT8_C(  34),  INT8_C(  12),
+       INT8_C(   3), -INT8_C(  85), -INT8_C(  29), -INT8_C(  25), -INT8_C(  69), -INT8_C(  45),  INT8_C( 126), -INT8_C(  99),
+      -INT8_C(  11), -INT8_C( 108),  INT8_C(   8),  INT8_C(  80), -INT8_C( 118), -INT8_C(  43), -INT8_C(  67),  INT8_C(   7),
+      -INT8_C(  60), -INT8_C(  36),  INT8_C(  95), -INT8_C(  13), -INT8_C( 111),  INT8_C(   9), -INT8_C( 122), -INT8_C(  61),
+      -INT8_C(  80), -INT8_C(  44), -INT8_C(   6), -INT8_C(  37), -INT8_C( 125), -INT8_C(  40),  INT8_C(  52), -INT8_C(  23),
+      -INT8_C( 125),  INT8_C(  23), -INT8_C(   2),  INT8_C(  63), -INT8_C(  21), -INT8_C(  13), -INT8_C(  36), -INT8_C(  39),
+       INT8_C(  16), -INT8_C(  47),  INT8_C(  48),  INT8_C(  35),  INT8_C(   9),  INT8_C( 125), -INT8_C( 127),  INT8_C(  13),
+       INT8_C(  89), -INT8_C( 104),  INT8_C(   0), -INT8_C(  81), -INT8_C(  95),  INT8_C(  49), -INT8_C(  83), -INT8_C(  68),
+       INT8_C(  40), -INT8_C(  89),  INT8_C(  44), -INT8_C(  56) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_s8_m(pv, av, bv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+
+    ev = simde_svmin_s8_m(pv, av, bv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) };
+  static const int16_t a[] =
+    {  INT16_C( 15588),  INT16_C( 30914), -INT16_C(  5480),  INT16_C( 17887),  INT16_C(  7048), -INT16_C( 11088),  INT16_C(  5666),  INT16_C(  8667),
+      -INT16_C( 15255), -INT16_C(   726), -INT16_C( 22475),  INT16_C( 14940),  INT16_C( 17889), -INT16_C(  9397), -INT16_C( 12138),  INT16_C( 31668),
+       INT16_C( 30220), -INT16_C( 23309), -INT16_C( 11680), -INT16_C(  5911), -INT16_C( 25874),  INT16_C(  4285), -INT16_C( 26448),  INT16_C(  6706),
+       INT16_C( 23645), -INT16_C( 28137),  INT16_C( 29445), -INT16_C(  6451),  INT16_C(  6328),  INT16_C( 20417),  INT16_C( 30184), -INT16_C(  2870),
+      -INT16_C( 16916),  INT16_C( 19608), -INT16_C( 32112),  INT16_C( 32309), -INT16_C(  3556), -INT16_C( 13170), -INT16_C( 16246), -INT16_C(  6170),
+      -INT16_C(   739),  INT16_C(  8826),  INT16_C( 18289),  INT16_C( 10504), -INT16_C( 13729),  INT16_C( 18296),  INT16_C( 16959),  INT16_C( 11067),
+      -INT16_C( 11520), -INT16_C( 28552), -INT16_C( 21163),  INT16_C( 28942), -INT16_C( 25441),  INT16_C( 10558),  INT16_C(  9309),  INT16_C( 31249),
+      -INT16_C( 29918), -INT16_C( 27748), -INT16_C( 23342),  INT16_C( 12732),  INT16_C( 13678), -INT16_C( 20872), -INT16_C( 19593),  INT16_C( 30681),
+       INT16_C( 20870), -INT16_C(  9209),  INT16_C(  5630), -INT16_C( 25267), -INT16_C( 29774),  INT16_C(  4039), -INT16_C( 10064), -INT16_C( 11639),
+       INT16_C(  9571),  INT16_C( 13669),  INT16_C(  8649),  INT16_C( 14438), -INT16_C(  8618), -INT16_C( 12570), -INT16_C( 16495),  INT16_C(  5957),
+       INT16_C( 19729),  INT16_C(  4083),  INT16_C( 16738),  INT16_C(  5293),  INT16_C( 29900),  INT16_C( 31779), -INT16_C( 21428), -INT16_C( 20658),
+      -INT16_C( 19503), -INT16_C( 25628),  INT16_C( 19157),  INT16_C( 11219), -INT16_C( 18136), -INT16_C( 17927),  INT16_C( 16248), -INT16_C( 30256),
+      -INT16_C( 15220), -INT16_C(  4455),  INT16_C( 17925), -INT16_C( 12029),  INT16_C(  9914),  INT16_C(  1614), -INT16_C( 25389), -INT16_C( 23371),
+      -INT16_C( 26288),  INT16_C(  9535),  INT16_C(  4835),  INT16_C(  2896),  INT16_C( 19147),  INT16_C( 17604), -INT16_C( 27511),  INT16_C(  5581),
+       INT16_C( 26200),  INT16_C( 23811),  INT16_C(  1708),  INT16_C( 26159),  INT16_C( 32045),  INT16_C(   108),  INT16_C(  8473),  INT16_C( 27044),
+      -INT16_C(  6982), -INT16_C( 25202), -INT16_C(  8202), -INT16_C( 15704),  INT16_C( 27689), -INT16_C( 19962), -INT16_C( 11519),  INT16_C( 22983),
+      -INT16_C( 13766), -INT16_C(  6473), -INT16_C(  6447), -INT16_C(   435), -INT16_C( 18077),  INT16_C( 31998), -INT16_C( 23845), -INT16_C( 27162),
+       INT16_C( 29830),  INT16_C( 32051), -INT16_C(  9389),  INT16_C( 31807),  INT16_C( 17736),  INT16_C( 18734), -INT16_C(  2792),  INT16_C( 21154),
+       INT16_C( 22976), -INT16_C( 28359), -INT16_C( 31169), -INT16_C( 23921), -INT16_C( 29377),  INT16_C(  6687),  INT16_C(  1327), -INT16_C( 18768),
+      -INT16_C(  7303), -INT16_C( 13005),  INT16_C( 29374),  INT16_C(  1609),  INT16_C( 30903), -INT16_C( 12465), -INT16_C(  3475),  INT16_C( 11554),
+       INT16_C( 23371), -INT16_C( 29762),  INT16_C( 19937),  INT16_C(  8237),  INT16_C( 19674),  INT16_C(  2619), -INT16_C(  5295), -INT16_C( 13376),
+      -INT16_C(  3122), -INT16_C( 29544), -INT16_C(  7835),  INT16_C(  7315), -INT16_C(  7591), -INT16_C( 14357),  INT16_C(  3540),  INT16_C(  8436),
+      -INT16_C( 19608),  INT16_C( 18859), -INT16_C( 10240), -INT16_C(  9366), -INT16_C( 23259),  INT16_C( 30437), -INT16_C( 23152),  INT16_C( 24129),
+      -INT16_C(  9832), -INT16_C(   534),  INT16_C( 32187),  INT16_C(  5145),  INT16_C(  1120),  INT16_C( 13531), -INT16_C( 12270),  INT16_C( 31316),
+      -INT16_C(   125), -INT16_C( 31804),  INT16_C( 11992), -INT16_C(   674),  INT16_C( 17363),  INT16_C( 25459), -INT16_C( 18968), -INT16_C( 32575),
+      -INT16_C( 21618),  INT16_C( 18813), -INT16_C( 27095), -INT16_C( 30370),  INT16_C( 14747), -INT16_C( 21059),  INT16_C(  4617), -INT16_C( 29657),
+      -INT16_C(  5359), -INT16_C(  5872),  INT16_C( 28185), -INT16_C(  4890),  INT16_C( 23218), -INT16_C( 26033),  INT16_C(  4111), -INT16_C( 25317),
+      -INT16_C( 26436), -INT16_C(  6681),  INT16_C( 17711), -INT16_C( 13714),  INT16_C( 11134), -INT16_C( 30601), -INT16_C( 25027),  INT16_C( 20244),
+       INT16_C(  9354), -INT16_C( 23752),  INT16_C(  8083),  INT16_C( 17808), -INT16_C(  8327), -INT16_C( 30497), -INT16_C(  1296), -INT16_C( 21467),
+       INT16_C(  3219), -INT16_C( 15727), -INT16_C(   175), -INT16_C( 12148),  INT16_C(   810),  INT16_C( 26712),  INT16_C( 27809),  INT16_C( 11191),
+      -INT16_C(  4207),  INT16_C(  9423),  INT16_C( 24334), -INT16_C( 30871),  INT16_C( 18494),  INT16_C( 11791),  INT16_C( 13635), -INT16_C( 10534),
+       INT16_C( 27457), -INT16_C( 27752),  INT16_C(  9322), -INT16_C( 27293), -INT16_C( 17625), -INT16_C( 14083), -INT16_C( 19417), -INT16_C( 18188),
+      -INT16_C( 15453), -INT16_C( 19748),  INT16_C( 17698),  INT16_C( 24633),  INT16_C( 18830), -INT16_C( 11889),  INT16_C( 27006), -INT16_C( 16473),
+       INT16_C( 16341),  INT16_C( 16210), -INT16_C( 19101), -INT16_C( 29996), -INT16_C( 11920), -INT16_C( 26542),  INT16_C( 18053),  INT16_C( 10576),
+       INT16_C( 11529),  INT16_C( 11227),  INT16_C(  5234),  INT16_C(   140),  INT16_C(  7005), -INT16_C(  9263),  INT16_C( 30852),  INT16_C( 22939),
+      -INT16_C(  4681),  INT16_C(  6809),  INT16_C( 28067),  INT16_C(  5028), -INT16_C(  2241), -INT16_C( 15189), -INT16_C(   963),  INT16_C( 18413),
+      -INT16_C( 14295), -INT16_C( 25742), -INT16_C(   291),  INT16_C( 15004),  INT16_C( 27929), -INT16_C( 25066), -INT16_C( 19994), -INT16_C( 25097),
+      -INT16_C( 28514),  INT16_C( 16824),  INT16_C( 23806),  INT16_C( 15701),  INT16_C(    83), -INT16_C( 28415), -INT16_C(  4100),  INT16_C(  9688),
+       INT16_C( 19127), -INT16_C( 27455),  INT16_C( 23881),  INT16_C( 25295), -INT16_C(  6710), -INT16_C( 20480), -INT16_C(  1898),  INT16_C( 13390),
+       INT16_C(  1672), -INT16_C( 31114), -INT16_C( 13470), -INT16_C( 18749), -INT16_C( 14901), -INT16_C( 14265),  INT16_C(  8116),  INT16_C( 27629),
+      -INT16_C( 20887), -INT16_C( 19968), -INT16_C( 12533), -INT16_C( 10731) };
+  static const int16_t b[] =
+    { -INT16_C( 11480), -INT16_C( 27547),  INT16_C( 22237),  INT16_C( 18059),  INT16_C( 32412), -INT16_C( 13852), -INT16_C(  6826),  INT16_C(  8221),
+       INT16_C( 27008), -INT16_C( 32750),  INT16_C( 31797), -INT16_C( 21560), -INT16_C( 26750),  INT16_C( 26943), -INT16_C( 20968),  INT16_C( 16399),
+       INT16_C( 29826),  INT16_C( 24532),  INT16_C( 24522),  INT16_C( 26533), -INT16_C( 29987),  INT16_C( 13104),  INT16_C( 19823), -INT16_C(  4268),
+       INT16_C( 26295), -INT16_C(  5009),  INT16_C( 14306),  INT16_C( 25751), -INT16_C( 10545), -INT16_C(  6195), -INT16_C(  8827),  INT16_C(  1831),
+      -INT16_C(  1199),  INT16_C(  7270),  INT16_C(  2906),  INT16_C( 14467), -INT16_C( 19563),  INT16_C(  1131), -INT16_C( 16640), -INT16_C( 18445),
+       INT16_C( 25381),  INT16_C(  1956),  INT16_C( 15258),  INT16_C( 26987),  INT16_C( 14610), -INT16_C( 26800),  INT16_C( 30486),  INT16_C( 26526),
+       INT16_C(  1138), -INT16_C( 12925),  INT16_C(  1551), -INT16_C( 23291),  INT16_C( 28857), -INT16_C( 17751), -INT16_C( 25296),  INT16_C( 21873),
+       INT16_C(  5376), -INT16_C( 26019), -INT16_C( 14255),  INT16_C( 25348),  INT16_C( 21505),  INT16_C(  6138), -INT16_C( 26420),  INT16_C( 15999),
+       INT16_C(   668), -INT16_C( 21749),  INT16_C(  4105), -INT16_C( 15792), -INT16_C(  1407), -INT16_C( 20100), -INT16_C(  4457), -INT16_C( 26874),
+       INT16_C( 25347),  INT16_C( 21553),  INT16_C( 13612),  INT16_C( 11703), -INT16_C( 20086),  INT16_C( 22085), -INT16_C( 15287), -INT16_C(  6764),
+      -INT16_C( 24378), -INT16_C( 12399), -INT16_C(  7760),  INT16_C( 12690),  INT16_C(  3803),  INT16_C( 29410), -INT16_C(  5636),  INT16_C(     9),
+       INT16_C( 15180),  INT16_C( 30804),  INT16_C(  3184), -INT16_C(  1370), -INT16_C(  5187),  INT16_C(  1872), -INT16_C(  6737),  INT16_C( 30188),
+       INT16_C( 32133),  INT16_C( 13637), -INT16_C( 10401),  INT16_C( 14951),  INT16_C( 18917), -INT16_C(  7507), -INT16_C( 18894),  INT16_C( 32738),
+       INT16_C( 14065),  INT16_C( 25335), -INT16_C( 25278),  INT16_C(    92), -INT16_C( 21112),  INT16_C( 14087), -INT16_C(  3182),  INT16_C(  6061),
+      -INT16_C(  3471), -INT16_C( 12212), -INT16_C( 19511), -INT16_C( 20982), -INT16_C( 18435),  INT16_C( 12176),  INT16_C( 29294),  INT16_C( 24494),
+      -INT16_C( 22871), -INT16_C(  5183),  INT16_C(  7747), -INT16_C( 13077), -INT16_C(  3381),  INT16_C( 23811), -INT16_C( 20250),  INT16_C( 22388),
+      -INT16_C( 16222),  INT16_C( 27431),  INT16_C( 12660),  INT16_C( 28954), -INT16_C( 21783),  INT16_C( 22432),  INT16_C( 20253), -INT16_C( 14666),
+       INT16_C( 30965),  INT16_C( 14513), -INT16_C( 25194),  INT16_C( 24836),  INT16_C(  2191),  INT16_C( 30142),  INT16_C( 12984),  INT16_C( 23500),
+      -INT16_C(  3086),  INT16_C( 26310), -INT16_C(  8155),  INT16_C(  3799),  INT16_C( 30859), -INT16_C( 22427),  INT16_C(  7111), -INT16_C( 17298),
+       INT16_C(  8083),  INT16_C( 10740), -INT16_C(  1604),  INT16_C( 19594),  INT16_C( 18433), -INT16_C( 17983), -INT16_C( 29062),  INT16_C( 27924),
+      -INT16_C(  9343), -INT16_C( 22829), -INT16_C( 21573),  INT16_C( 18100),  INT16_C(  6435), -INT16_C(  5394),  INT16_C( 23605), -INT16_C( 14170),
+      -INT16_C( 25988),  INT16_C( 14578),  INT16_C( 31891), -INT16_C( 27516),  INT16_C( 18117),  INT16_C( 16206),  INT16_C( 25300),  INT16_C( 21932),
+      -INT16_C( 32707), -INT16_C(  1540), -INT16_C( 20437),  INT16_C( 20031),  INT16_C( 11978), -INT16_C(   200), -INT16_C(  8566),  INT16_C(  1735),
+      -INT16_C( 18056),  INT16_C(  3135), -INT16_C( 15562), -INT16_C(  1120), -INT16_C(  4599), -INT16_C(  8902), -INT16_C(  6319), -INT16_C( 29133),
+       INT16_C( 12135), -INT16_C( 28025), -INT16_C( 14369), -INT16_C( 22048),  INT16_C(  6389),  INT16_C( 32680),  INT16_C( 28918),  INT16_C( 28294),
+      -INT16_C( 15063),  INT16_C( 24442),  INT16_C(  7048), -INT16_C( 28070), -INT16_C( 27383),  INT16_C( 23151), -INT16_C( 23940), -INT16_C(  7191),
+       INT16_C( 28881), -INT16_C( 20107),  INT16_C( 21815),  INT16_C( 11354),  INT16_C(   877),  INT16_C( 25516),  INT16_C( 12915), -INT16_C( 25391),
+       INT16_C( 19703),  INT16_C( 32764),  INT16_C( 22119),  INT16_C( 28689), -INT16_C( 32277),  INT16_C( 26571), -INT16_C( 19421), -INT16_C(  2742),
+      -INT16_C( 16604),  INT16_C( 23718),  INT16_C(    20), -INT16_C( 32376),  INT16_C( 13315),  INT16_C( 30436), -INT16_C( 18842),  INT16_C( 23827),
+       INT16_C(  3842),  INT16_C( 27101), -INT16_C(  4507),  INT16_C( 20953), -INT16_C( 23441), -INT16_C( 27720),  INT16_C(   856),  INT16_C( 32136),
+       INT16_C( 11970), -INT16_C( 10279),  INT16_C( 24878),  INT16_C( 12888),  INT16_C( 15766), -INT16_C(   856), -INT16_C( 17421), -INT16_C(  2726),
+       INT16_C( 14282),  INT16_C( 12382),  INT16_C( 14117), -INT16_C( 27263),  INT16_C( 14812),  INT16_C( 13352), -INT16_C( 20420), -INT16_C(    79),
+      -INT16_C( 29986),  INT16_C(  3286),  INT16_C( 12012), -INT16_C( 32194), -INT16_C(  6293),  INT16_C( 24190), -INT16_C( 10078),  INT16_C( 27987),
+      -INT16_C( 20209),  INT16_C( 13725),  INT16_C(  7913), -INT16_C( 14902), -INT16_C(  3497), -INT16_C( 27399), -INT16_C( 21598), -INT16_C( 32621),
+       INT16_C( 26933),  INT16_C(  8588), -INT16_C( 13417),  INT16_C(   931),  INT16_C(  8882),  INT16_C( 21601), -INT16_C( 18950),  INT16_C(  2753),
+       INT16_C( 24166),  INT16_C( 20287),  INT16_C(  2428), -INT16_C( 11244),  INT16_C(  3835), -INT16_C( 25240), -INT16_C(  1095), -INT16_C(  4579),
+      -INT16_C( 22172), -INT16_C(  1264), -INT16_C( 19596),  INT16_C(  9982),  INT16_C( 24789), -INT16_C( 12165),  INT16_C( 15381),  INT16_C( 31706),
+       INT16_C(  6555),  INT16_C(  6091), -INT16_C(  8414),  INT16_C(  7659),  INT16_C( 21485), -INT16_C( 22854), -INT16_C( 10418), -INT16_C( 19819),
+      -INT16_C( 23168), -INT16_C(  2642), -INT16_C( 21416),  INT16_C( 11803), -INT16_C( 27124),  INT16_C(  8702), -INT16_C( 10029),  INT16_C( 28317),
+       INT16_C( 26865),  INT16_C(  4997),  INT16_C( 28999),  INT16_C( 13616), -INT16_C(  5436),  INT16_C(  5083),  INT16_C( 28865),  INT16_C( 16837),
+       INT16_C( 29461),  INT16_C( 28214),  INT16_C( 21024),  INT16_C( 11420) };
+  static const int16_t e[] =
+    {  INT16_C(     0), -INT16_C( 27547),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13852), -INT16_C(  6826),  INT16_C(     0),
+      -INT16_C( 15255),  INT16_C(     0),  INT16_C(     0), -INT16_C( 21560), -INT16_C( 26750),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16399),
+       INT16_C( 29826), -INT16_C( 23309),  INT16_C(     0), -INT16_C(  5911), -INT16_C( 29987),  INT16_C(  4285), -INT16_C( 26448),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6451), -INT16_C( 10545), -INT16_C(  6195), -INT16_C(  8827), -INT16_C(  2870),
+      -INT16_C( 16916),  INT16_C(  7270),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19563), -INT16_C( 13170), -INT16_C( 16640), -INT16_C( 18445),
+      -INT16_C(   739),  INT16_C(  1956),  INT16_C( 15258),  INT16_C(     0), -INT16_C( 13729),  INT16_C(     0),  INT16_C( 16959),  INT16_C( 11067),
+      -INT16_C( 11520),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 17751),  INT16_C(     0),  INT16_C( 21873),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26420),  INT16_C( 15999),
+       INT16_C(   668), -INT16_C( 21749),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10064), -INT16_C( 26874),
+       INT16_C(  9571),  INT16_C( 13669),  INT16_C(     0),  INT16_C( 11703), -INT16_C( 20086), -INT16_C( 12570), -INT16_C( 16495),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3803),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20658),
+      -INT16_C( 19503), -INT16_C( 25628),  INT16_C(  3184),  INT16_C(     0), -INT16_C( 18136),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(  4455),  INT16_C(     0), -INT16_C( 12029),  INT16_C(     0), -INT16_C(  7507),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 26288),  INT16_C(  9535), -INT16_C( 25278),  INT16_C(     0), -INT16_C( 21112),  INT16_C( 14087),  INT16_C(     0),  INT16_C(  5581),
+      -INT16_C(  3471), -INT16_C( 12212),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18435),  INT16_C(     0),  INT16_C(  8473),  INT16_C(     0),
+      -INT16_C( 22871), -INT16_C( 25202), -INT16_C(  8202),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19962),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 16222),  INT16_C(     0), -INT16_C(  6447),  INT16_C(     0), -INT16_C( 21783),  INT16_C( 22432), -INT16_C( 23845), -INT16_C( 27162),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 24836),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 31169), -INT16_C( 23921),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1327),  INT16_C(     0),
+      -INT16_C(  7303), -INT16_C( 13005),  INT16_C(     0),  INT16_C(  1609),  INT16_C( 18433), -INT16_C( 17983),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 21573),  INT16_C(     0),  INT16_C(  6435),  INT16_C(     0), -INT16_C(  5295), -INT16_C( 14170),
+      -INT16_C( 25988), -INT16_C( 29544), -INT16_C(  7835), -INT16_C( 27516),  INT16_C(     0), -INT16_C( 14357),  INT16_C(  3540),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(  1540), -INT16_C( 20437), -INT16_C(  9366),  INT16_C(     0), -INT16_C(   200),  INT16_C(     0),  INT16_C(  1735),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1120), -INT16_C(  4599),  INT16_C(     0), -INT16_C( 12270), -INT16_C( 29133),
+       INT16_C(     0), -INT16_C( 31804), -INT16_C( 14369),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 27095), -INT16_C( 30370),  INT16_C(     0), -INT16_C( 21059),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 21815),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25391),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 16604), -INT16_C( 23752),  INT16_C(    20), -INT16_C( 32376),  INT16_C(     0), -INT16_C( 30497), -INT16_C( 18842),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12148),  INT16_C(     0), -INT16_C( 27720),  INT16_C(     0),  INT16_C( 11191),
+      -INT16_C(  4207), -INT16_C( 10279),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15766), -INT16_C(   856), -INT16_C( 17421),  INT16_C(     0),
+       INT16_C( 14282),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 17625),  INT16_C(     0), -INT16_C( 20420), -INT16_C( 18188),
+      -INT16_C( 29986),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6293),  INT16_C(     0), -INT16_C( 10078), -INT16_C( 16473),
+       INT16_C(     0),  INT16_C( 13725), -INT16_C( 19101),  INT16_C(     0), -INT16_C( 11920),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 11529),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7005), -INT16_C(  9263),  INT16_C(     0),  INT16_C(  2753),
+       INT16_C(     0),  INT16_C(  6809),  INT16_C(  2428),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1095), -INT16_C(  4579),
+      -INT16_C( 22172), -INT16_C( 25742), -INT16_C( 19596),  INT16_C(     0),  INT16_C( 24789),  INT16_C(     0), -INT16_C( 19994),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(  6091),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10418), -INT16_C( 19819),
+       INT16_C(     0), -INT16_C( 27455),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20480), -INT16_C( 10029),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 31114), -INT16_C( 13470),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 12533),  INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_s16_z(pv, av, bv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+
+    ev = simde_svmin_s16_z(pv, av, bv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0) };
+  static const int16_t a[] =
+    {  INT16_C( 10044),  INT16_C(  5142), -INT16_C(  7818), -INT16_C( 17132),  INT16_C( 26627), -INT16_C(  3593), -INT16_C( 10051),  INT16_C( 24542),
+      -INT16_C( 31488),  INT16_C( 30876),  INT16_C( 12090), -INT16_C( 20087),  INT16_C( 19631),  INT16_C( 30522),  INT16_C( 19719),  INT16_C( 17429),
+       INT16_C( 11125), -INT16_C(  5288),  INT16_C( 27916),  INT16_C(  4264), -INT16_C( 24363), -INT16_C( 28159), -INT16_C(  8328),  INT16_C( 30962),
+      -INT16_C( 29084), -INT16_C( 24847),  INT16_C( 31422),  INT16_C( 27983), -INT16_C( 30265), -INT16_C( 12571), -INT16_C(  1321),  INT16_C( 19474),
+       INT16_C( 27429),  INT16_C( 12855), -INT16_C(  8232), -INT16_C( 21182),  INT16_C( 17279), -INT16_C(  1984),  INT16_C( 12834), -INT16_C( 31120),
+       INT16_C( 25024),  INT16_C( 32292),  INT16_C( 29660), -INT16_C( 23572), -INT16_C( 11779), -INT16_C( 11151), -INT16_C( 31541), -INT16_C(  4064),
+       INT16_C( 22511), -INT16_C( 14558),  INT16_C( 25654), -INT16_C( 18828), -INT16_C( 19289), -INT16_C( 13906),  INT16_C(  7910), -INT16_C( 22705),
+       INT16_C( 29568),  INT16_C( 23589),  INT16_C(  4583), -INT16_C(  6913),  INT16_C( 28898), -INT16_C( 21064), -INT16_C(  9996), -INT16_C(  7266),
+      -INT16_C( 16337),  INT16_C( 26026),  INT16_C(  7973), -INT16_C( 13285), -INT16_C( 13869), -INT16_C( 17770), -INT16_C(  6680),  INT16_C( 26721),
+      -INT16_C( 31143),  INT16_C( 16580), -INT16_C( 15464),  INT16_C( 31268), -INT16_C(  9165),  INT16_C( 10280), -INT16_C( 14668), -INT16_C(  7413),
+      -INT16_C( 18810), -INT16_C( 21688),  INT16_C( 25813), -INT16_C( 22408),  INT16_C(  3629),  INT16_C(  5474), -INT16_C( 15373),  INT16_C( 19581),
+       INT16_C( 16714), -INT16_C(  7540), -INT16_C( 20476),  INT16_C( 14428), -INT16_C( 31604),  INT16_C( 16480),  INT16_C( 27466), -INT16_C( 11997),
+       INT16_C( 27681), -INT16_C(  2436), -INT16_C(  2864), -INT16_C(   609),  INT16_C(   258), -INT16_C(  2541), -INT16_C( 28475),  INT16_C(  3906),
+      -INT16_C( 12334), -INT16_C( 10511),  INT16_C( 19839),  INT16_C(  3086),  INT16_C( 28370),  INT16_C(  7244),  INT16_C( 28890), -INT16_C(  1043),
+       INT16_C( 27356), -INT16_C( 21262), -INT16_C( 28322),  INT16_C( 25001), -INT16_C( 17262),  INT16_C( 22359), -INT16_C( 26291),  INT16_C(  8038),
+       INT16_C( 22376), -INT16_C(  5899),  INT16_C(  1189),  INT16_C( 30708),  INT16_C( 16498),  INT16_C( 19603), -INT16_C( 32336), -INT16_C( 29624),
+       INT16_C( 15083),  INT16_C( 18744), -INT16_C(  7477),  INT16_C( 23978),  INT16_C(   414), -INT16_C(  5195),  INT16_C(  7067),  INT16_C(   778),
+       INT16_C(   115),  INT16_C(  6379), -INT16_C(  8444),  INT16_C( 30351),  INT16_C(  8736), -INT16_C( 12093),  INT16_C(  2979), -INT16_C( 29091),
+      -INT16_C( 27323),  INT16_C(  4312), -INT16_C( 32137),  INT16_C(  5741),  INT16_C(  8836),  INT16_C(  7937),  INT16_C(  3134), -INT16_C( 20190),
+       INT16_C(  3596),  INT16_C(  4297),  INT16_C( 22765),  INT16_C(  3462),  INT16_C( 18810),  INT16_C(  7902),  INT16_C( 15188), -INT16_C( 26196),
+      -INT16_C( 31536),  INT16_C( 18601),  INT16_C(  5895), -INT16_C( 29858),  INT16_C( 24377),  INT16_C( 30634), -INT16_C( 13205),  INT16_C( 30504),
+      -INT16_C(  3622), -INT16_C( 14201),  INT16_C(  3657), -INT16_C( 15147), -INT16_C( 19625), -INT16_C( 21278), -INT16_C( 28946), -INT16_C( 16571),
+      -INT16_C(  4333),  INT16_C(  6663),  INT16_C( 25862),  INT16_C( 16293),  INT16_C( 20420),  INT16_C( 12471), -INT16_C(  8421), -INT16_C(  2393),
+       INT16_C( 12241),  INT16_C(  6846), -INT16_C( 27843), -INT16_C( 27426), -INT16_C( 16313),  INT16_C( 13632), -INT16_C( 31153),  INT16_C( 25332),
+      -INT16_C(  1163),  INT16_C( 31612),  INT16_C(  8544),  INT16_C(  9658),  INT16_C( 29040), -INT16_C( 29867), -INT16_C(   943),  INT16_C(  8833),
+       INT16_C( 16171),  INT16_C( 26684),  INT16_C(  7123),  INT16_C(  6909),  INT16_C( 15835),  INT16_C( 10831),  INT16_C( 17603),  INT16_C( 14476),
+       INT16_C(  2111), -INT16_C( 24397),  INT16_C( 28201), -INT16_C( 26171),  INT16_C(  6879),  INT16_C( 12325), -INT16_C( 23018),  INT16_C( 16978),
+      -INT16_C( 28698), -INT16_C( 18006), -INT16_C( 22614), -INT16_C( 31277),  INT16_C(  8933), -INT16_C( 22352),  INT16_C( 15462), -INT16_C( 22815),
+      -INT16_C( 27579),  INT16_C( 28230),  INT16_C(  2818), -INT16_C(  7672),  INT16_C( 11557),  INT16_C( 15122),  INT16_C( 26067), -INT16_C( 18051),
+       INT16_C( 10484), -INT16_C( 24974),  INT16_C( 17871), -INT16_C( 19421), -INT16_C( 11416), -INT16_C( 12707),  INT16_C( 15888),  INT16_C( 21876),
+      -INT16_C( 17710), -INT16_C( 10813), -INT16_C( 13371), -INT16_C(  5449), -INT16_C( 13832), -INT16_C( 13274), -INT16_C( 23762),  INT16_C(  8837),
+      -INT16_C(  1845), -INT16_C( 25664), -INT16_C(  7107), -INT16_C( 23217), -INT16_C( 21321), -INT16_C( 14476), -INT16_C(  5910), -INT16_C( 17124),
+      -INT16_C(  8029),  INT16_C( 26770),  INT16_C( 18859), -INT16_C( 23469),  INT16_C( 30994),  INT16_C( 16752), -INT16_C(  2788), -INT16_C(  6045),
+       INT16_C(  9453),  INT16_C( 11139), -INT16_C( 11768), -INT16_C( 16432),  INT16_C( 17535),  INT16_C( 27015), -INT16_C( 23763), -INT16_C( 12250),
+      -INT16_C( 18301),  INT16_C( 12088), -INT16_C( 29951),  INT16_C(  5331),  INT16_C( 17156),  INT16_C(  8533), -INT16_C( 18376),  INT16_C(  9737),
+      -INT16_C( 29476), -INT16_C(  7087),  INT16_C(  8542), -INT16_C(  8796),  INT16_C( 11110), -INT16_C( 27833),  INT16_C( 28110),  INT16_C( 21091),
+      -INT16_C( 25818),  INT16_C( 10113),  INT16_C( 21543),  INT16_C( 11067), -INT16_C( 28521), -INT16_C( 12468),  INT16_C( 21833),  INT16_C(  9717),
+       INT16_C( 18145),  INT16_C( 16394), -INT16_C( 20888), -INT16_C( 12771),  INT16_C( 25817), -INT16_C( 22687), -INT16_C( 15150), -INT16_C(  1799),
+       INT16_C( 31327), -INT16_C( 31201),  INT16_C( 23502),  INT16_C( 26034), -INT16_C(   277),  INT16_C( 13365),  INT16_C( 10836),  INT16_C( 13658),
+       INT16_C( 25713), -INT16_C(  9867), -INT16_C( 27886), -INT16_C(  5209),  INT16_C(  2295), -INT16_C( 13934), -INT16_C( 29492),  INT16_C( 11201),
+      -INT16_C(  7930), -INT16_C( 10830),  INT16_C( 25660),  INT16_C( 10042),  INT16_C( 28514), -INT16_C( 18852), -INT16_C( 18790),  INT16_C(  3052),
+       INT16_C( 24858),  INT16_C( 11492), -INT16_C( 29708), -INT16_C(  5097), -INT16_C( 22125),  INT16_C( 24501),  INT16_C( 30517),  INT16_C( 15498),
+       INT16_C( 15448), -INT16_C( 27631),  INT16_C( 19360),  INT16_C(   955),  INT16_C(  6075),  INT16_C( 21945), -INT16_C( 23091), -INT16_C(  6304),
+       INT16_C( 17415), -INT16_C(  1261),  INT16_C( 10959),  INT16_C( 25319), -INT16_C( 25132),  INT16_C(  2497),  INT16_C( 19220),  INT16_C( 27717),
+       INT16_C( 22152),  INT16_C( 10240), -INT16_C( 17502),  INT16_C( 23851), -INT16_C(  6701), -INT16_C( 24398),  INT16_C(  4746), -INT16_C( 28280),
+      -INT16_C( 25770),  INT16_C(  9613),  INT16_C( 29894), -INT16_C( 25977),  INT16_C( 18449),  INT16_C(  9635), -INT16_C(  5741),  INT16_C(  7057),
+      -INT16_C( 28353), -INT16_C(  7868),  INT16_C( 28493),  INT16_C(  8254), -INT16_C(  4012), -INT16_C(  8256) };
+  static const int16_t b[] =
+    { -INT16_C( 21654),  INT16_C( 19250),  INT16_C(  6464),  INT16_C( 30637), -INT16_C( 21071), -INT16_C( 31997),  INT16_C( 27603), -INT16_C(  6346),
+      -INT16_C( 11347),  INT16_C( 13935),  INT16_C(  6185), -INT16_C(  1184), -INT16_C( 32061), -INT16_C(  1854),  INT16_C(  2684), -INT16_C(  6496),
+      -INT16_C( 11595), -INT16_C(  2766), -INT16_C(  8212), -INT16_C( 25235),  INT16_C( 28813),  INT16_C( 24609),  INT16_C( 22491), -INT16_C( 30649),
+      -INT16_C( 18902),  INT16_C( 21438),  INT16_C(  7886), -INT16_C( 28338),  INT16_C(  4256),  INT16_C(  7561),  INT16_C( 10522), -INT16_C( 12541),
+       INT16_C( 13820), -INT16_C(  5947),  INT16_C( 12821), -INT16_C( 23931), -INT16_C( 22878),  INT16_C( 32002),  INT16_C( 18941),  INT16_C(  9989),
+      -INT16_C( 15105), -INT16_C( 12934), -INT16_C( 14110), -INT16_C( 31906), -INT16_C(  6184), -INT16_C(  3424), -INT16_C( 23791),  INT16_C(  3522),
+      -INT16_C( 30759), -INT16_C(  4363),  INT16_C( 31417),  INT16_C( 23440), -INT16_C( 28127),  INT16_C(  7896), -INT16_C(  8741), -INT16_C(  9658),
+      -INT16_C( 16223), -INT16_C( 31577),  INT16_C(  1417),  INT16_C( 24839), -INT16_C( 22548), -INT16_C(   684),  INT16_C(  5706),  INT16_C(  8970),
+      -INT16_C(    99),  INT16_C( 22033), -INT16_C( 24198), -INT16_C( 25679), -INT16_C( 30413),  INT16_C(  3769), -INT16_C(   154),  INT16_C(  2280),
+      -INT16_C( 28736),  INT16_C( 18828), -INT16_C( 27756), -INT16_C( 32342), -INT16_C(   454), -INT16_C( 31618), -INT16_C( 30444), -INT16_C( 20056),
+      -INT16_C( 18040),  INT16_C(   519), -INT16_C( 18341), -INT16_C( 29027),  INT16_C( 22337), -INT16_C( 22371), -INT16_C( 31402),  INT16_C(  5808),
+       INT16_C( 15381), -INT16_C( 22177),  INT16_C(  2767),  INT16_C(  2346), -INT16_C( 22264),  INT16_C(  7565),  INT16_C( 13618), -INT16_C( 17714),
+      -INT16_C( 10513),  INT16_C( 19133),  INT16_C( 23182), -INT16_C( 12072),  INT16_C( 30129),  INT16_C(  2168),  INT16_C( 10491),  INT16_C(  4126),
+       INT16_C( 32356),  INT16_C( 13241), -INT16_C(  7032), -INT16_C( 28612), -INT16_C( 13939), -INT16_C( 16467),  INT16_C( 31999), -INT16_C(  4487),
+       INT16_C( 13906), -INT16_C(  8136),  INT16_C(  4241),  INT16_C( 17072),  INT16_C( 10374), -INT16_C( 32438),  INT16_C( 26960), -INT16_C( 19311),
+       INT16_C( 19175),  INT16_C( 28647),  INT16_C(  9006), -INT16_C( 17409), -INT16_C( 21011), -INT16_C(  4998), -INT16_C(  3031),  INT16_C( 31706),
+       INT16_C(  4650), -INT16_C( 17573),  INT16_C(  3106), -INT16_C( 22274),  INT16_C( 18484), -INT16_C( 31447), -INT16_C( 17743), -INT16_C( 26567),
+       INT16_C(  8453),  INT16_C( 13063),  INT16_C(  1860),  INT16_C( 12783),  INT16_C( 27060), -INT16_C(  8931), -INT16_C(  2211), -INT16_C( 30632),
+      -INT16_C( 19703),  INT16_C( 11331),  INT16_C( 16831), -INT16_C(  2860), -INT16_C(   374),  INT16_C( 15225), -INT16_C( 19784), -INT16_C( 16940),
+      -INT16_C(  9261),  INT16_C(  6385), -INT16_C(  7966), -INT16_C( 27063),  INT16_C( 26441), -INT16_C( 22669), -INT16_C( 13474),  INT16_C( 26671),
+       INT16_C( 29311),  INT16_C( 16020),  INT16_C( 26804),  INT16_C( 15922), -INT16_C( 21658),  INT16_C(  8057),  INT16_C( 19806),  INT16_C( 12764),
+      -INT16_C( 13015),  INT16_C(  2889), -INT16_C( 27731), -INT16_C(  2142),  INT16_C(  5626),  INT16_C( 22686), -INT16_C( 12831),  INT16_C( 24768),
+       INT16_C( 21567), -INT16_C(  3170), -INT16_C( 11843),  INT16_C(  9009), -INT16_C( 21636), -INT16_C(  9662),  INT16_C(  8184),  INT16_C(  8460),
+       INT16_C( 21996), -INT16_C( 26067), -INT16_C( 12312), -INT16_C(  7535),  INT16_C( 12260), -INT16_C( 15045), -INT16_C(  1028),  INT16_C( 15141),
+      -INT16_C( 15280),  INT16_C(  3375),  INT16_C( 24725),  INT16_C(  4400),  INT16_C( 29451),  INT16_C(  1260), -INT16_C(  1902),  INT16_C( 32293),
+       INT16_C( 21069),  INT16_C( 13848), -INT16_C( 22239),  INT16_C(  1560),  INT16_C( 21464), -INT16_C( 11061), -INT16_C(  3761), -INT16_C( 24816),
+       INT16_C( 16309),  INT16_C( 19116), -INT16_C(  9057), -INT16_C( 21669),  INT16_C( 18255), -INT16_C(  7761), -INT16_C( 11201), -INT16_C( 29344),
+       INT16_C( 30759),  INT16_C( 18627), -INT16_C(  9438), -INT16_C(  1458),  INT16_C(  6703),  INT16_C( 32463), -INT16_C(  8437), -INT16_C( 16355),
+      -INT16_C( 14050), -INT16_C( 17142),  INT16_C( 26021), -INT16_C(  2712),  INT16_C(  6061), -INT16_C(  4906),  INT16_C( 14060),  INT16_C(  4985),
+       INT16_C( 15535), -INT16_C( 11941), -INT16_C( 21992),  INT16_C( 18379), -INT16_C( 25916), -INT16_C( 12347), -INT16_C(  7559), -INT16_C( 26737),
+      -INT16_C( 26197),  INT16_C( 20565), -INT16_C( 16898), -INT16_C( 21691),  INT16_C(  7381), -INT16_C( 15976),  INT16_C(  4434),  INT16_C(   468),
+       INT16_C( 12110),  INT16_C( 26322), -INT16_C( 24871), -INT16_C( 25171),  INT16_C( 29240), -INT16_C( 19860), -INT16_C(  1196), -INT16_C(   183),
+      -INT16_C( 24940), -INT16_C( 27825), -INT16_C( 27300),  INT16_C( 12606), -INT16_C( 10575),  INT16_C(  1010), -INT16_C( 14616),  INT16_C( 13829),
+      -INT16_C( 10251), -INT16_C( 12388),  INT16_C( 18805), -INT16_C( 20884), -INT16_C(  9797),  INT16_C(  3936), -INT16_C( 22060),  INT16_C( 26894),
+       INT16_C( 23880), -INT16_C( 23300),  INT16_C( 15090), -INT16_C( 23595), -INT16_C( 14575), -INT16_C(  1625), -INT16_C( 21363), -INT16_C( 32209),
+      -INT16_C( 13437), -INT16_C(  1711), -INT16_C( 16876), -INT16_C( 12377),  INT16_C(  1943),  INT16_C( 27614), -INT16_C(  4944), -INT16_C(  1836),
+      -INT16_C( 12215),  INT16_C( 15516),  INT16_C( 28939),  INT16_C(  7391), -INT16_C( 31176), -INT16_C( 15083),  INT16_C( 17458), -INT16_C( 18872),
+      -INT16_C( 26353),  INT16_C(  9135),  INT16_C( 22103), -INT16_C(  4366), -INT16_C( 12195),  INT16_C(  3418),  INT16_C( 11964),  INT16_C(  1286),
+      -INT16_C( 23809),  INT16_C(  2625),  INT16_C(  8468),  INT16_C( 19494),  INT16_C( 15271), -INT16_C(  9710),  INT16_C( 23167), -INT16_C( 29040),
+       INT16_C( 16371),  INT16_C( 19377), -INT16_C( 23659), -INT16_C(  3527), -INT16_C( 27789),  INT16_C( 12287),  INT16_C(  1474), -INT16_C( 16076),
+       INT16_C( 30376), -INT16_C( 17205), -INT16_C(  3689),  INT16_C( 15880),  INT16_C(  6700), -INT16_C( 21736), -INT16_C( 22412),  INT16_C( 26681),
+      -INT16_C(  5401),  INT16_C( 31923), -INT16_C(  4979),  INT16_C(   110),  INT16_C( 28288),  INT16_C( 16943),  INT16_C( 25459),  INT16_C(  6915),
+      -INT16_C( 12583),  INT16_C( 28887), -INT16_C(  8001), -INT16_C(  5201), -INT16_C( 14342),  INT16_C( 28566), -INT16_C( 12432),  INT16_C( 22487),
+      -INT16_C( 30023),  INT16_C( 18132),  INT16_C( 17014), -INT16_C(  2490),  INT16_C( 30128),  INT16_C(  9272),  INT16_C( 15320), -INT16_C( 19905),
+       INT16_C(  5897), -INT16_C( 14302), -INT16_C( 11785), -INT16_C(  3661),  INT16_C( 18841),  INT16_C(  2400),  INT16_C( 14104), -INT16_C( 11936),
+       INT16_C( 13505),  INT16_C( 14359),  INT16_C( 23927),  INT16_C( 10030),  INT16_C( 26578), -INT16_C( 21685), -INT16_C( 29790), -INT16_C( 21411),
+       INT16_C( 32674), -INT16_C( 26252),  INT16_C( 10321), -INT16_C(  5494), -INT16_C(  5263), -INT16_C( 29965) };
+  static const int16_t e[] =
+    { -INT16_C( 21654),  INT16_C(  5142), -INT16_C(  7818), -INT16_C( 17132), -INT16_C( 21071), -INT16_C(  3593), -INT16_C( 10051), -INT16_C(  6346),
+      -INT16_C( 31488),  INT16_C( 30876),  INT16_C(  6185), -INT16_C( 20087), -INT16_C( 32061),  INT16_C( 30522),  INT16_C( 19719),  INT16_C( 17429),
+       INT16_C( 11125), -INT16_C(  5288), -INT16_C(  8212),  INT16_C(  4264), -INT16_C( 24363), -INT16_C( 28159), -INT16_C(  8328), -INT16_C( 30649),
+      -INT16_C( 29084), -INT16_C( 24847),  INT16_C(  7886), -INT16_C( 28338), -INT16_C( 30265), -INT16_C( 12571), -INT16_C(  1321), -INT16_C( 12541),
+       INT16_C( 27429), -INT16_C(  5947), -INT16_C(  8232), -INT16_C( 21182),  INT16_C( 17279), -INT16_C(  1984),  INT16_C( 12834), -INT16_C( 31120),
+      -INT16_C( 15105), -INT16_C( 12934), -INT16_C( 14110), -INT16_C( 31906), -INT16_C( 11779), -INT16_C( 11151), -INT16_C( 31541), -INT16_C(  4064),
+       INT16_C( 22511), -INT16_C( 14558),  INT16_C( 25654), -INT16_C( 18828), -INT16_C( 19289), -INT16_C( 13906),  INT16_C(  7910), -INT16_C( 22705),
+      -INT16_C( 16223),  INT16_C( 23589),  INT16_C(  4583), -INT16_C(  6913), -INT16_C( 22548), -INT16_C( 21064), -INT16_C(  9996), -INT16_C(  7266),
+      -INT16_C( 16337),  INT16_C( 26026), -INT16_C( 24198), -INT16_C( 25679), -INT16_C( 13869), -INT16_C( 17770), -INT16_C(  6680),  INT16_C(  2280),
+      -INT16_C( 31143),  INT16_C( 16580), -INT16_C( 15464),  INT16_C( 31268), -INT16_C(  9165),  INT16_C( 10280), -INT16_C( 14668), -INT16_C(  7413),
+      -INT16_C( 18810), -INT16_C( 21688), -INT16_C( 18341), -INT16_C( 22408),  INT16_C(  3629), -INT16_C( 22371), -INT16_C( 31402),  INT16_C(  5808),
+       INT16_C( 15381), -INT16_C(  7540), -INT16_C( 20476),  INT16_C(  2346), -INT16_C( 31604),  INT16_C( 16480),  INT16_C( 13618), -INT16_C( 17714),
+      -INT16_C( 10513), -INT16_C(  2436), -INT16_C(  2864), -INT16_C(   609),  INT16_C(   258), -INT16_C(  2541), -INT16_C( 28475),  INT16_C(  3906),
+      -INT16_C( 12334), -INT16_C( 10511), -INT16_C(  7032),  INT16_C(  3086),  INT16_C( 28370),  INT16_C(  7244),  INT16_C( 28890), -INT16_C(  1043),
+       INT16_C( 27356), -INT16_C( 21262), -INT16_C( 28322),  INT16_C( 17072), -INT16_C( 17262), -INT16_C( 32438), -INT16_C( 26291), -INT16_C( 19311),
+       INT16_C( 22376), -INT16_C(  5899),  INT16_C(  1189),  INT16_C( 30708),  INT16_C( 16498),  INT16_C( 19603), -INT16_C( 32336), -INT16_C( 29624),
+       INT16_C( 15083),  INT16_C( 18744), -INT16_C(  7477), -INT16_C( 22274),  INT16_C(   414), -INT16_C( 31447),  INT16_C(  7067),  INT16_C(   778),
+       INT16_C(   115),  INT16_C(  6379), -INT16_C(  8444),  INT16_C( 30351),  INT16_C(  8736), -INT16_C( 12093), -INT16_C(  2211), -INT16_C( 29091),
+      -INT16_C( 27323),  INT16_C(  4312), -INT16_C( 32137),  INT16_C(  5741),  INT16_C(  8836),  INT16_C(  7937), -INT16_C( 19784), -INT16_C( 20190),
+       INT16_C(  3596),  INT16_C(  4297), -INT16_C(  7966), -INT16_C( 27063),  INT16_C( 18810), -INT16_C( 22669), -INT16_C( 13474), -INT16_C( 26196),
+      -INT16_C( 31536),  INT16_C( 16020),  INT16_C(  5895), -INT16_C( 29858), -INT16_C( 21658),  INT16_C(  8057), -INT16_C( 13205),  INT16_C( 12764),
+      -INT16_C( 13015), -INT16_C( 14201), -INT16_C( 27731), -INT16_C( 15147), -INT16_C( 19625), -INT16_C( 21278), -INT16_C( 28946), -INT16_C( 16571),
+      -INT16_C(  4333), -INT16_C(  3170),  INT16_C( 25862),  INT16_C(  9009), -INT16_C( 21636), -INT16_C(  9662), -INT16_C(  8421), -INT16_C(  2393),
+       INT16_C( 12241),  INT16_C(  6846), -INT16_C( 27843), -INT16_C( 27426), -INT16_C( 16313), -INT16_C( 15045), -INT16_C( 31153),  INT16_C( 15141),
+      -INT16_C(  1163),  INT16_C( 31612),  INT16_C(  8544),  INT16_C(  4400),  INT16_C( 29040), -INT16_C( 29867), -INT16_C(   943),  INT16_C(  8833),
+       INT16_C( 16171),  INT16_C( 26684),  INT16_C(  7123),  INT16_C(  1560),  INT16_C( 15835), -INT16_C( 11061), -INT16_C(  3761),  INT16_C( 14476),
+       INT16_C(  2111), -INT16_C( 24397),  INT16_C( 28201), -INT16_C( 26171),  INT16_C(  6879),  INT16_C( 12325), -INT16_C( 23018),  INT16_C( 16978),
+      -INT16_C( 28698), -INT16_C( 18006), -INT16_C( 22614), -INT16_C( 31277),  INT16_C(  8933), -INT16_C( 22352),  INT16_C( 15462), -INT16_C( 22815),
+      -INT16_C( 27579), -INT16_C( 17142),  INT16_C(  2818), -INT16_C(  7672),  INT16_C(  6061),  INT16_C( 15122),  INT16_C( 14060), -INT16_C( 18051),
+       INT16_C( 10484), -INT16_C( 24974),  INT16_C( 17871), -INT16_C( 19421), -INT16_C( 25916), -INT16_C( 12707),  INT16_C( 15888),  INT16_C( 21876),
+      -INT16_C( 26197), -INT16_C( 10813), -INT16_C( 13371), -INT16_C(  5449), -INT16_C( 13832), -INT16_C( 13274), -INT16_C( 23762),  INT16_C(  8837),
+      -INT16_C(  1845), -INT16_C( 25664), -INT16_C( 24871), -INT16_C( 23217), -INT16_C( 21321), -INT16_C( 14476), -INT16_C(  5910), -INT16_C( 17124),
+      -INT16_C( 24940), -INT16_C( 27825), -INT16_C( 27300), -INT16_C( 23469),  INT16_C( 30994),  INT16_C( 16752), -INT16_C( 14616), -INT16_C(  6045),
+       INT16_C(  9453),  INT16_C( 11139), -INT16_C( 11768), -INT16_C( 20884),  INT16_C( 17535),  INT16_C(  3936), -INT16_C( 23763), -INT16_C( 12250),
+      -INT16_C( 18301), -INT16_C( 23300), -INT16_C( 29951),  INT16_C(  5331),  INT16_C( 17156), -INT16_C(  1625), -INT16_C( 21363), -INT16_C( 32209),
+      -INT16_C( 29476), -INT16_C(  7087),  INT16_C(  8542), -INT16_C(  8796),  INT16_C( 11110), -INT16_C( 27833), -INT16_C(  4944), -INT16_C(  1836),
+      -INT16_C( 25818),  INT16_C( 10113),  INT16_C( 21543),  INT16_C( 11067), -INT16_C( 31176), -INT16_C( 12468),  INT16_C( 17458),  INT16_C(  9717),
+       INT16_C( 18145),  INT16_C(  9135), -INT16_C( 20888), -INT16_C( 12771), -INT16_C( 12195), -INT16_C( 22687), -INT16_C( 15150), -INT16_C(  1799),
+      -INT16_C( 23809), -INT16_C( 31201),  INT16_C(  8468),  INT16_C( 26034), -INT16_C(   277),  INT16_C( 13365),  INT16_C( 10836), -INT16_C( 29040),
+       INT16_C( 25713), -INT16_C(  9867), -INT16_C( 27886), -INT16_C(  5209),  INT16_C(  2295), -INT16_C( 13934), -INT16_C( 29492),  INT16_C( 11201),
+      -INT16_C(  7930), -INT16_C( 10830),  INT16_C( 25660),  INT16_C( 10042),  INT16_C( 28514), -INT16_C( 18852), -INT16_C( 22412),  INT16_C(  3052),
+       INT16_C( 24858),  INT16_C( 11492), -INT16_C( 29708), -INT16_C(  5097), -INT16_C( 22125),  INT16_C( 24501),  INT16_C( 30517),  INT16_C( 15498),
+       INT16_C( 15448), -INT16_C( 27631), -INT16_C(  8001),  INT16_C(   955),  INT16_C(  6075),  INT16_C( 21945), -INT16_C( 23091), -INT16_C(  6304),
+       INT16_C( 17415), -INT16_C(  1261),  INT16_C( 10959), -INT16_C(  2490), -INT16_C( 25132),  INT16_C(  2497),  INT16_C( 19220),  INT16_C( 27717),
+       INT16_C(  5897),  INT16_C( 10240), -INT16_C( 17502),  INT16_C( 23851), -INT16_C(  6701), -INT16_C( 24398),  INT16_C(  4746), -INT16_C( 28280),
+      -INT16_C( 25770),  INT16_C(  9613),  INT16_C( 23927), -INT16_C( 25977),  INT16_C( 18449),  INT16_C(  9635), -INT16_C(  5741), -INT16_C( 21411),
+      -INT16_C( 28353), -INT16_C( 26252),  INT16_C( 10321), -INT16_C(  5494), -INT16_C(  4012), -INT16_C(  8256) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_s16_m(pv, av, bv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+
+    ev = simde_svmin_s16_m(pv, av, bv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) };
+  static const int32_t a[] =
+    {  INT32_C(  1807905900), -INT32_C(  1576584536),  INT32_C(   142567400),  INT32_C(  1970271245),  INT32_C(  1281611214), -INT32_C(  1753632372), -INT32_C(    91582232),  INT32_C(   200807583),
+       INT32_C(   813087368), -INT32_C(   573342219), -INT32_C(   236629276),  INT32_C(   359093319), -INT32_C(  1235105238),  INT32_C(  1682823803),  INT32_C(   157210474),  INT32_C(  1930778347),
+       INT32_C(   111446801), -INT32_C(   303859959),  INT32_C(   283101385),  INT32_C(  1176847900), -INT32_C(  1946319344), -INT32_C(   873510304),  INT32_C(   232017186), -INT32_C(  1249777244),
+       INT32_C(  2126194037),  INT32_C(  1701551772), -INT32_C(  2106176922), -INT32_C(  1597400176), -INT32_C(  2110994910),  INT32_C(   843914000),  INT32_C(   222306921), -INT32_C(  2134720245),
+      -INT32_C(  2097250842), -INT32_C(  2115540453),  INT32_C(  1157848500),  INT32_C(   468045049), -INT32_C(  1549987438), -INT32_C(  1764365523),  INT32_C(   413340941), -INT32_C(  1130797610),
+      -INT32_C(    46229534), -INT32_C(  1233246719),  INT32_C(  2096857475), -INT32_C(   526917554),  INT32_C(   528692722),  INT32_C(   766859552),  INT32_C(  1162172526), -INT32_C(  1627267395),
+       INT32_C(  2006728822), -INT32_C(   382920090), -INT32_C(   379180901), -INT32_C(    70583031),  INT32_C(  1377455410),  INT32_C(   360697766), -INT32_C(   463813337),  INT32_C(   428039075),
+       INT32_C(    26288027), -INT32_C(   722747847), -INT32_C(   255962649), -INT32_C(  2115270578),  INT32_C(  2094204373), -INT32_C(    74361900), -INT32_C(  1142953192), -INT32_C(   489332154),
+      -INT32_C(  1159502207),  INT32_C(   193908260),  INT32_C(  1861962783), -INT32_C(  1427118380), -INT32_C(  1087978773),  INT32_C(   767211285), -INT32_C(   387343966),  INT32_C(  2093661947),
+       INT32_C(  1211543076), -INT32_C(  1672166020), -INT32_C(   435532015),  INT32_C(   563149110), -INT32_C(   773736773),  INT32_C(   268344173),  INT32_C(   821552949), -INT32_C(   911359323),
+      -INT32_C(   334306448), -INT32_C(  1165465944), -INT32_C(   341798219),  INT32_C(  1192046731),  INT32_C(  1394142950), -INT32_C(  1100867959), -INT32_C(  1544594946), -INT32_C(  1955750885),
+       INT32_C(   678985599), -INT32_C(  1696464667),  INT32_C(   512131731), -INT32_C(  1738173518),  INT32_C(   183205249), -INT32_C(  1832301164), -INT32_C(  1036666714), -INT32_C(   749886892),
+       INT32_C(   117163297),  INT32_C(  1503780294),  INT32_C(   293021535),  INT32_C(  1000988090), -INT32_C(   297429926), -INT32_C(  2004873503),  INT32_C(   441104070),  INT32_C(  2062456664),
+       INT32_C(   595650909),  INT32_C(   645669319),  INT32_C(    37286728),  INT32_C(   725475792),  INT32_C(  1461289846),  INT32_C(  1491049105), -INT32_C(  1468913328),  INT32_C(   505569473),
+       INT32_C(   289514314),  INT32_C(   221756868), -INT32_C(  2129694800), -INT32_C(   945009327),  INT32_C(  1629406672), -INT32_C(  1346765217), -INT32_C(   396874713), -INT32_C(   704218484),
+      -INT32_C(   488159459), -INT32_C(  1242620156), -INT32_C(   550044018),  INT32_C(   463921739),  INT32_C(   125683111), -INT32_C(   357157181), -INT32_C(   271380894), -INT32_C(  1496983159),
+       INT32_C(   629714209),  INT32_C(  1524266956), -INT32_C(  1053159306), -INT32_C(  1696734990),  INT32_C(  1755404965), -INT32_C(   212641904), -INT32_C(   270391706),  INT32_C(   546678783),
+       INT32_C(   541466196),  INT32_C(   192618645),  INT32_C(   600683825),  INT32_C(  1002285717), -INT32_C(  1801232892),  INT32_C(   478672566),  INT32_C(   470509852),  INT32_C(  1698471953),
+       INT32_C(  1418101438), -INT32_C(   731971165),  INT32_C(  1274490038), -INT32_C(   628705834), -INT32_C(   915461613),  INT32_C(  1038480928),  INT32_C(  1901719648),  INT32_C(  1339463057),
+      -INT32_C(  1146921960),  INT32_C(   328139613),  INT32_C(   106923567),  INT32_C(  1340138811),  INT32_C(   806899471), -INT32_C(  1502740922),  INT32_C(  2132264686),  INT32_C(  1943006555),
+      -INT32_C(  1490128310), -INT32_C(  1514422923),  INT32_C(  2141919812),  INT32_C(   265194495),  INT32_C(   557836251), -INT32_C(   741888795), -INT32_C(   850141582),  INT32_C(   356590283),
+       INT32_C(   180187028),  INT32_C(  1907324973), -INT32_C(  1846519150), -INT32_C(  1063206939), -INT32_C(  1948131418), -INT32_C(    44128117),  INT32_C(  1389080966),  INT32_C(  1751583955),
+      -INT32_C(  1468914565),  INT32_C(   773398940),  INT32_C(  1623198331),  INT32_C(  1864458441), -INT32_C(   872807872),  INT32_C(   835279019), -INT32_C(   578579446),  INT32_C(   457567136),
+      -INT32_C(  1396394225),  INT32_C(  1406852568), -INT32_C(  1330341145),  INT32_C(   991942139), -INT32_C(  2113529385),  INT32_C(  2092224370),  INT32_C(    56178531),  INT32_C(   840933154),
+       INT32_C(   803136342), -INT32_C(  1467828032),  INT32_C(  1314403923), -INT32_C(   477530101),  INT32_C(    56987537), -INT32_C(  1031857825),  INT32_C(  1942411601), -INT32_C(   827988616),
+      -INT32_C(  1996651576), -INT32_C(  1892646852), -INT32_C(  1025668682), -INT32_C(  1834654207),  INT32_C(  1419119349),  INT32_C(  1964447012),  INT32_C(  1726537198), -INT32_C(  1976201534),
+       INT32_C(  1293038097),  INT32_C(  1776042930), -INT32_C(   852772404),  INT32_C(   358600735), -INT32_C(    26610214), -INT32_C(   109871093),  INT32_C(   526408797), -INT32_C(    72772118),
+       INT32_C(  2051652807), -INT32_C(   874306049), -INT32_C(    23589153), -INT32_C(  1206650914), -INT32_C(   122192403),  INT32_C(  1542531837),  INT32_C(  1887064454), -INT32_C(  1368644378) };
+  static const int32_t b[] =
+    {  INT32_C(  1913135100),  INT32_C(   767171257), -INT32_C(   396061620),  INT32_C(  1800973578),  INT32_C(   212211176),  INT32_C(   630900728),  INT32_C(   112460825),  INT32_C(  1677253735),
+      -INT32_C(  1261108997),  INT32_C(  1726058266),  INT32_C(   776946979), -INT32_C(   627464206), -INT32_C(  1243136068),  INT32_C(   534413574), -INT32_C(   333082747),  INT32_C(  1716461163),
+       INT32_C(   958080030), -INT32_C(   694158157),  INT32_C(   872738370),  INT32_C(  1376755094), -INT32_C(   502794532), -INT32_C(    66985353), -INT32_C(   588765327),  INT32_C(  1665283909),
+       INT32_C(   245128539), -INT32_C(  1662763942), -INT32_C(  1060050646),  INT32_C(  1662246790),  INT32_C(  1279597269),  INT32_C(  1833453564), -INT32_C(  1287049106), -INT32_C(  1038709657),
+       INT32_C(  1137751017),  INT32_C(   434091503),  INT32_C(   618311838),  INT32_C(  1703406991),  INT32_C(    78761223), -INT32_C(  2106459628), -INT32_C(  1841972438),  INT32_C(   810830663),
+      -INT32_C(   311155202),  INT32_C(  2013746138), -INT32_C(  1818435325), -INT32_C(   705157938),  INT32_C(    98150897), -INT32_C(   829994077),  INT32_C(  1298185222),  INT32_C(   108901383),
+      -INT32_C(  1275858471),  INT32_C(  1210841669), -INT32_C(  1445213989), -INT32_C(   578825236),  INT32_C(   551704701), -INT32_C(  1443993181),  INT32_C(   754339365), -INT32_C(   600673277),
+      -INT32_C(  1433393563), -INT32_C(    51135712),  INT32_C(  1873137283),  INT32_C(   525083810),  INT32_C(   541011581), -INT32_C(  1127600489),  INT32_C(  2146025596), -INT32_C(  1705239756),
+       INT32_C(  1648684097),  INT32_C(   727594919), -INT32_C(  1466301690), -INT32_C(  1513625816), -INT32_C(  1379596779), -INT32_C(  1318482124), -INT32_C(  2077207984), -INT32_C(  1356952466),
+       INT32_C(   538010488), -INT32_C(  1605668966), -INT32_C(  1689721485), -INT32_C(   499118132),  INT32_C(  1250886934), -INT32_C(   436471659), -INT32_C(  1184289717),  INT32_C(   828934328),
+      -INT32_C(  2058257685),  INT32_C(  1546034409),  INT32_C(  1324838529), -INT32_C(  1808779394), -INT32_C(   757153987),  INT32_C(    45603511), -INT32_C(  1095032826), -INT32_C(  1813044056),
+      -INT32_C(  2028388194),  INT32_C(  1592016860),  INT32_C(   732748717),  INT32_C(  1354750995),  INT32_C(  1378000539),  INT32_C(  2119555448), -INT32_C(  1573121799), -INT32_C(   768267212),
+       INT32_C(  1230655084),  INT32_C(  1000816269),  INT32_C(   744903449), -INT32_C(   897833425),  INT32_C(  1008508612),  INT32_C(  1908044151), -INT32_C(  1240205694), -INT32_C(  1886828510),
+       INT32_C(   618193815),  INT32_C(   979336993),  INT32_C(    23578322), -INT32_C(  1328815124), -INT32_C(   101914750), -INT32_C(   613767591), -INT32_C(  1080984164),  INT32_C(  1565399750),
+       INT32_C(   511780605),  INT32_C(  2002379173), -INT32_C(  1820802905),  INT32_C(   625165219), -INT32_C(  2095108310),  INT32_C(  1902021077), -INT32_C(   852430841),  INT32_C(   137002506),
+       INT32_C(  1227271076),  INT32_C(   868253580), -INT32_C(   473548737), -INT32_C(  1509422725),  INT32_C(   220800824), -INT32_C(  1199601487), -INT32_C(  2105168008), -INT32_C(   762663122),
+      -INT32_C(   417549990),  INT32_C(  1880808496), -INT32_C(  1873551083),  INT32_C(   590765034),  INT32_C(   875585667),  INT32_C(  1626124264), -INT32_C(  1914539681),  INT32_C(  2053074208),
+       INT32_C(  1315011358),  INT32_C(  1841200216),  INT32_C(  1207767389), -INT32_C(   261475219),  INT32_C(  2082773908), -INT32_C(  1445195702), -INT32_C(  1590247807),  INT32_C(  1226544683),
+       INT32_C(  1771601169),  INT32_C(  1456887545), -INT32_C(   711076760), -INT32_C(  1664808952), -INT32_C(   317134429),  INT32_C(  2056779001), -INT32_C(   568603214),  INT32_C(  1965504099),
+      -INT32_C(  1394688077),  INT32_C(  2114106646), -INT32_C(  1856790391),  INT32_C(  1261246632), -INT32_C(    96975615), -INT32_C(   344666311),  INT32_C(    13209501),  INT32_C(  2037772741),
+      -INT32_C(   970632016), -INT32_C(  1841027063),  INT32_C(  1881380808), -INT32_C(  1329901393), -INT32_C(   827657323),  INT32_C(  1622744771),  INT32_C(  1935705005),  INT32_C(   619501172),
+       INT32_C(   871043370),  INT32_C(    29699897),  INT32_C(  1987176647), -INT32_C(   853070792), -INT32_C(   476327648), -INT32_C(  1656531728),  INT32_C(  1259381719), -INT32_C(  1552876423),
+       INT32_C(  1205230350),  INT32_C(  1363778442), -INT32_C(  1144472957),  INT32_C(   126414823), -INT32_C(  1326832704),  INT32_C(  1330523512),  INT32_C(  1251696336),  INT32_C(  1777142619),
+      -INT32_C(   256850842), -INT32_C(   482150049), -INT32_C(  1684141388), -INT32_C(  1180555271), -INT32_C(  1033204662), -INT32_C(  1995261767),  INT32_C(  1909697814),  INT32_C(   517652920),
+      -INT32_C(   468808827),  INT32_C(   952586372),  INT32_C(  1406363226), -INT32_C(   686983795), -INT32_C(  1164282111),  INT32_C(  1162128431),  INT32_C(   297211737),  INT32_C(  1563398616),
+      -INT32_C(  1589494500), -INT32_C(   388429426), -INT32_C(    63132305),  INT32_C(   617892130), -INT32_C(   270635328),  INT32_C(  1932796442),  INT32_C(   310700858), -INT32_C(  1720667267),
+       INT32_C(  2117776112),  INT32_C(   728175803), -INT32_C(   483941439), -INT32_C(  1408762900), -INT32_C(  2086934935),  INT32_C(  1123471112),  INT32_C(   945126075),  INT32_C(   517063981),
+       INT32_C(   849087607), -INT32_C(   513998048), -INT32_C(  1832614490), -INT32_C(   364983168), -INT32_C(  1167205966),  INT32_C(  1694327977),  INT32_C(   211571422), -INT32_C(  1909822185) };
+  static const int32_t e[] =
+    {  INT32_C(  1807905900),  INT32_C(           0), -INT32_C(   396061620),  INT32_C(  1800973578),  INT32_C(           0),  INT32_C(           0), -INT32_C(    91582232),  INT32_C(   200807583),
+      -INT32_C(  1261108997), -INT32_C(   573342219), -INT32_C(   236629276), -INT32_C(   627464206), -INT32_C(  1243136068),  INT32_C(   534413574), -INT32_C(   333082747),  INT32_C(  1716461163),
+       INT32_C(   111446801), -INT32_C(   694158157),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1946319344),  INT32_C(           0), -INT32_C(   588765327),  INT32_C(           0),
+       INT32_C(   245128539),  INT32_C(           0), -INT32_C(  2106176922), -INT32_C(  1597400176), -INT32_C(  2110994910),  INT32_C(           0), -INT32_C(  1287049106), -INT32_C(  2134720245),
+       INT32_C(           0), -INT32_C(  2115540453),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1841972438),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1233246719),  INT32_C(           0), -INT32_C(   705157938),  INT32_C(    98150897),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(  1445213989), -INT32_C(   578825236),  INT32_C(   551704701),  INT32_C(           0),  INT32_C(           0), -INT32_C(   600673277),
+       INT32_C(           0), -INT32_C(   722747847), -INT32_C(   255962649), -INT32_C(  2115270578),  INT32_C(           0), -INT32_C(  1127600489),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(  1159502207),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1513625816),  INT32_C(           0), -INT32_C(  1318482124), -INT32_C(  2077207984),  INT32_C(           0),
+       INT32_C(   538010488),  INT32_C(           0), -INT32_C(  1689721485),  INT32_C(           0), -INT32_C(   773736773),  INT32_C(           0), -INT32_C(  1184289717),  INT32_C(           0),
+      -INT32_C(  2058257685),  INT32_C(           0), -INT32_C(   341798219), -INT32_C(  1808779394),  INT32_C(           0), -INT32_C(  1100867959),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1696464667),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   117163297),  INT32_C(  1000816269),  INT32_C(   293021535), -INT32_C(   897833425),  INT32_C(           0), -INT32_C(  2004873503), -INT32_C(  1240205694),  INT32_C(           0),
+       INT32_C(   595650909),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1328815124), -INT32_C(   101914750),  INT32_C(           0),  INT32_C(           0),  INT32_C(   505569473),
+       INT32_C(   289514314),  INT32_C(   221756868),  INT32_C(           0), -INT32_C(   945009327), -INT32_C(  2095108310), -INT32_C(  1346765217), -INT32_C(   852430841), -INT32_C(   704218484),
+      -INT32_C(   488159459),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1496983159),
+      -INT32_C(   417549990),  INT32_C(  1524266956), -INT32_C(  1873551083), -INT32_C(  1696734990),  INT32_C(           0), -INT32_C(   212641904),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   541466196),  INT32_C(   192618645),  INT32_C(   600683825),  INT32_C(           0), -INT32_C(  1801232892), -INT32_C(  1445195702),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1418101438), -INT32_C(   731971165), -INT32_C(   711076760),  INT32_C(           0), -INT32_C(   915461613),  INT32_C(  1038480928),  INT32_C(           0),  INT32_C(  1339463057),
+       INT32_C(           0),  INT32_C(   328139613),  INT32_C(           0),  INT32_C(  1261246632),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1841027063),  INT32_C(           0), -INT32_C(  1329901393), -INT32_C(   827657323),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1656531728),  INT32_C(           0), -INT32_C(  1552876423),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   126414823),  INT32_C(           0),  INT32_C(   835279019),  INT32_C(           0),  INT32_C(   457567136),
+      -INT32_C(  1396394225),  INT32_C(           0), -INT32_C(  1684141388),  INT32_C(           0), -INT32_C(  2113529385), -INT32_C(  1995261767),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(   468808827),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1164282111),  INT32_C(           0),  INT32_C(   297211737), -INT32_C(   827988616),
+       INT32_C(           0), -INT32_C(  1892646852),  INT32_C(           0), -INT32_C(  1834654207),  INT32_C(           0),  INT32_C(  1932796442),  INT32_C(   310700858),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(   852772404), -INT32_C(  1408762900), -INT32_C(  2086934935),  INT32_C(           0),  INT32_C(   526408797),  INT32_C(           0),
+       INT32_C(   849087607), -INT32_C(   874306049), -INT32_C(  1832614490),  INT32_C(           0), -INT32_C(  1167205966),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1909822185) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_s32_z(pv, av, bv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+
+    ev = simde_svmin_s32_z(pv, av, bv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const int32_t a[] =
+    { -INT32_C(  1066118753), -INT32_C(  1026962061), -INT32_C(   696580903), -INT32_C(  1356474756), -INT32_C(  2063608751),  INT32_C(  1641895422), -INT32_C(  1334718793), -INT32_C(   161448874),
+       INT32_C(  1085723853),  INT32_C(  2047049633), -INT32_C(    11501949), -INT32_C(  1498450603),  INT32_C(  1193979465), -INT32_C(  1146616061),  INT32_C(   728439253),  INT32_C(  1663159190),
+       INT32_C(  1084545183), -INT32_C(   608524457),  INT32_C(  2061110053), -INT32_C(   903837312),  INT32_C(   990988855),  INT32_C(   653703761),  INT32_C(  1767006675), -INT32_C(   875728084),
+      -INT32_C(  1559531189),  INT32_C(  1031718168),  INT32_C(  1371035856),  INT32_C(   421255394),  INT32_C(  1951673379), -INT32_C(  1164227866), -INT32_C(   685511253), -INT32_C(  1398607776),
+       INT32_C(  2035264865),  INT32_C(  1136119155),  INT32_C(   127168293),  INT32_C(  1780592455), -INT32_C(  1025542692),  INT32_C(  1803320000), -INT32_C(   951869337), -INT32_C(   227285616),
+       INT32_C(   107725459), -INT32_C(  1253498225), -INT32_C(   641933679),  INT32_C(  1766055309),  INT32_C(   321659475),  INT32_C(    58632348), -INT32_C(   640958136),  INT32_C(   986398375),
+      -INT32_C(  1874840063), -INT32_C(   364541607), -INT32_C(   171769241),  INT32_C(   845023199), -INT32_C(   968521175),  INT32_C(  2076820531),  INT32_C(   743740549), -INT32_C(   731504685),
+      -INT32_C(  1352358314), -INT32_C(  1751537104), -INT32_C(  1953735252), -INT32_C(  1916867740), -INT32_C(  1470954635),  INT32_C(  1294212551), -INT32_C(  2072414031), -INT32_C(   296165224),
+      -INT32_C(  1231176314),  INT32_C(   323892839), -INT32_C(   140584301),  INT32_C(   998595781),  INT32_C(   669243488), -INT32_C(  1485568011),  INT32_C(   405532288),  INT32_C(  1409713358),
+      -INT32_C(  1475632319),  INT32_C(  1840994777), -INT32_C(   110864077),  INT32_C(   372566454), -INT32_C(  1220732990), -INT32_C(  1621183969),  INT32_C(  1857522336),  INT32_C(  1338162446),
+       INT32_C(   972541280),  INT32_C(  1520874022), -INT32_C(  1051522293), -INT32_C(  1227388940), -INT32_C(  1116858978),  INT32_C(  1734134983),  INT32_C(  1691685718),  INT32_C(   817076176),
+      -INT32_C(  1955943835),  INT32_C(  1759842396),  INT32_C(   271136795),  INT32_C(  1590034879), -INT32_C(   585419754),  INT32_C(  1464104961),  INT32_C(  1555831179),  INT32_C(   361525168),
+       INT32_C(  1990325786),  INT32_C(   585008647),  INT32_C(  2117208255),  INT32_C(   534575369),  INT32_C(   788330541), -INT32_C(    75087760),  INT32_C(   156713561), -INT32_C(   887102287),
+      -INT32_C(   515718950),  INT32_C(    84156486),  INT32_C(   830748200),  INT32_C(  1565548591), -INT32_C(   930395048), -INT32_C(   440135284),  INT32_C(    99556179), -INT32_C(   623898881),
+       INT32_C(   347804366),  INT32_C(  1528479539),  INT32_C(   630038262),  INT32_C(  1468194302), -INT32_C(  1239478742),  INT32_C(  1939661599), -INT32_C(    25654273),  INT32_C(  1742227609),
+      -INT32_C(  1904503717),  INT32_C(  1240044883),  INT32_C(   846165555),  INT32_C(  2122969428),  INT32_C(   523544831), -INT32_C(  1953312628), -INT32_C(   192345509), -INT32_C(  1386519982),
+       INT32_C(  1228658678), -INT32_C(  1600969364), -INT32_C(   271449445), -INT32_C(   210936845), -INT32_C(  1894604285), -INT32_C(   837114766),  INT32_C(    12756142), -INT32_C(    55697914),
+       INT32_C(  1631971829), -INT32_C(  1442719730), -INT32_C(   828779558),  INT32_C(   851511086),  INT32_C(   465687465),  INT32_C(   636083319), -INT32_C(  2044351360), -INT32_C(  1081945142),
+      -INT32_C(   887044163),  INT32_C(  2054496928),  INT32_C(   608702453), -INT32_C(  1084880618),  INT32_C(  1406801884),  INT32_C(  1937294579),  INT32_C(   989437552),  INT32_C(   788102001),
+      -INT32_C(   470148797),  INT32_C(   828206907), -INT32_C(  1806326146), -INT32_C(  1940673617), -INT32_C(  1226887486),  INT32_C(  1646876914),  INT32_C(  1738286070), -INT32_C(   510224994),
+      -INT32_C(   356216658),  INT32_C(  2115707647),  INT32_C(  1997697224), -INT32_C(   586979813), -INT32_C(  2037128300),  INT32_C(   837336379),  INT32_C(  2123924704), -INT32_C(   949998055),
+      -INT32_C(  1095686978),  INT32_C(   238865478),  INT32_C(  1468419644),  INT32_C(  1211468212), -INT32_C(  1479620500),  INT32_C(  1708701317) };
+  static const int32_t b[] =
+    {  INT32_C(  1387624987), -INT32_C(   324895312), -INT32_C(   426250463), -INT32_C(   939088543), -INT32_C(  1323316331), -INT32_C(  1295754037), -INT32_C(   110037385), -INT32_C(    97844001),
+       INT32_C(   776790142),  INT32_C(  2132471646),  INT32_C(  1080406494), -INT32_C(   351769770),  INT32_C(    27010870), -INT32_C(    72064892),  INT32_C(   905192534), -INT32_C(  1506795480),
+       INT32_C(  1590983680),  INT32_C(  1256058475), -INT32_C(   158710881), -INT32_C(   438201682),  INT32_C(  1055293114),  INT32_C(   892967646), -INT32_C(   412471617),  INT32_C(  1317968462),
+      -INT32_C(  2102566377), -INT32_C(   255030703),  INT32_C(  2095470285), -INT32_C(  1553872663),  INT32_C(   618743622), -INT32_C(  1587995934), -INT32_C(  1769421752),  INT32_C(  1977947742),
+      -INT32_C(   889679239), -INT32_C(   356858852),  INT32_C(    73834779), -INT32_C(  1347958935), -INT32_C(   254572530), -INT32_C(   342807134),  INT32_C(  1333861105), -INT32_C(  1446681040),
+       INT32_C(   359906808), -INT32_C(  1660998015),  INT32_C(   950035919),  INT32_C(   988235564),  INT32_C(  1915468495), -INT32_C(   664945433),  INT32_C(   120118998),  INT32_C(  1035005253),
+       INT32_C(   726803626),  INT32_C(   566776146), -INT32_C(   497456970),  INT32_C(  2132623536), -INT32_C(   487503622), -INT32_C(   608547324),  INT32_C(  1927471661),  INT32_C(  2041549519),
+       INT32_C(   145031862),  INT32_C(   170487123), -INT32_C(  2048097579), -INT32_C(  1123743294),  INT32_C(  1453323857),  INT32_C(  1915836741),  INT32_C(   199496508),  INT32_C(  1552257957),
+      -INT32_C(   379311467),  INT32_C(  1827901079), -INT32_C(   739057904),  INT32_C(   982579177),  INT32_C(   848310253), -INT32_C(   995835512),  INT32_C(  2060486868), -INT32_C(  1311353572),
+       INT32_C(   379206271), -INT32_C(   645755448),  INT32_C(  1454142573),  INT32_C(  1502624875), -INT32_C(   208985749), -INT32_C(  1212665630), -INT32_C(   734951240),  INT32_C(  1552287709),
+       INT32_C(   175251521),  INT32_C(   467924142), -INT32_C(   730755223),  INT32_C(   908919243),  INT32_C(    86620450), -INT32_C(  1581456919),  INT32_C(  1182199145),  INT32_C(   899874036),
+      -INT32_C(   901835748),  INT32_C(  1927619081),  INT32_C(  2084984497),  INT32_C(  2058515544),  INT32_C(   377478189),  INT32_C(   666319805),  INT32_C(   476917032),  INT32_C(  1179783209),
+       INT32_C(   756060452),  INT32_C(  1704982196), -INT32_C(  1528633780), -INT32_C(  2027973542),  INT32_C(   782081648),  INT32_C(    39146714), -INT32_C(  1423981950), -INT32_C(   135171630),
+      -INT32_C(  1239154174),  INT32_C(  1142736120),  INT32_C(    82443946),  INT32_C(    59443346), -INT32_C(  2144261978), -INT32_C(    24934788),  INT32_C(   464167496),  INT32_C(   353540883),
+      -INT32_C(  1781778787), -INT32_C(  1529157382),  INT32_C(  2024326118),  INT32_C(  1903899595), -INT32_C(   655184805),  INT32_C(  2077652274),  INT32_C(   714506263), -INT32_C(  1187010532),
+      -INT32_C(   649131042), -INT32_C(   646108685), -INT32_C(  1219352852), -INT32_C(  1255617191), -INT32_C(  1400038790), -INT32_C(  1507368049),  INT32_C(    13680100),  INT32_C(  1152979045),
+       INT32_C(   253560859),  INT32_C(   501783089),  INT32_C(   450116288), -INT32_C(  2100298488), -INT32_C(  1490133993), -INT32_C(  1555212609),  INT32_C(  2040733203),  INT32_C(  1237146926),
+      -INT32_C(  1755784603),  INT32_C(   901005684), -INT32_C(  2091939461), -INT32_C(  1660608890),  INT32_C(   960771194), -INT32_C(  1646423414), -INT32_C(   568950608),  INT32_C(  1126683613),
+       INT32_C(   584745133),  INT32_C(  1012371137), -INT32_C(  1648318953),  INT32_C(  1044104644), -INT32_C(  2089320455), -INT32_C(  1054780399), -INT32_C(  1298188331), -INT32_C(  1191852277),
+       INT32_C(   148557639),  INT32_C(  1967403358), -INT32_C(  1693252393), -INT32_C(  1009168694), -INT32_C(   548974131),  INT32_C(  2057332901), -INT32_C(  1439874913),  INT32_C(  1315119623),
+       INT32_C(  1347829234),  INT32_C(  1187355247),  INT32_C(  1776474271), -INT32_C(   198395098), -INT32_C(  1294765300),  INT32_C(  2066510811), -INT32_C(  1171957325),  INT32_C(  1846052988),
+       INT32_C(   901668550), -INT32_C(  1736735751), -INT32_C(  2113839780),  INT32_C(   628501785),  INT32_C(  2094483873),  INT32_C(  1895236797) };
+  static const int32_t e[] =
+    { -INT32_C(  1066118753), -INT32_C(  1026962061), -INT32_C(   696580903), -INT32_C(  1356474756), -INT32_C(  2063608751),  INT32_C(  1641895422), -INT32_C(  1334718793), -INT32_C(   161448874),
+       INT32_C(   776790142),  INT32_C(  2047049633), -INT32_C(    11501949), -INT32_C(  1498450603),  INT32_C(  1193979465), -INT32_C(  1146616061),  INT32_C(   728439253),  INT32_C(  1663159190),
+       INT32_C(  1084545183), -INT32_C(   608524457),  INT32_C(  2061110053), -INT32_C(   903837312),  INT32_C(   990988855),  INT32_C(   653703761), -INT32_C(   412471617), -INT32_C(   875728084),
+      -INT32_C(  1559531189), -INT32_C(   255030703),  INT32_C(  1371035856),  INT32_C(   421255394),  INT32_C(  1951673379), -INT32_C(  1587995934), -INT32_C(  1769421752), -INT32_C(  1398607776),
+       INT32_C(  2035264865), -INT32_C(   356858852),  INT32_C(    73834779),  INT32_C(  1780592455), -INT32_C(  1025542692), -INT32_C(   342807134), -INT32_C(   951869337), -INT32_C(   227285616),
+       INT32_C(   107725459), -INT32_C(  1660998015), -INT32_C(   641933679),  INT32_C(   988235564),  INT32_C(   321659475),  INT32_C(    58632348), -INT32_C(   640958136),  INT32_C(   986398375),
+      -INT32_C(  1874840063), -INT32_C(   364541607), -INT32_C(   497456970),  INT32_C(   845023199), -INT32_C(   968521175),  INT32_C(  2076820531),  INT32_C(   743740549), -INT32_C(   731504685),
+      -INT32_C(  1352358314), -INT32_C(  1751537104), -INT32_C(  1953735252), -INT32_C(  1916867740), -INT32_C(  1470954635),  INT32_C(  1294212551), -INT32_C(  2072414031), -INT32_C(   296165224),
+      -INT32_C(  1231176314),  INT32_C(   323892839), -INT32_C(   140584301),  INT32_C(   982579177),  INT32_C(   669243488), -INT32_C(  1485568011),  INT32_C(   405532288),  INT32_C(  1409713358),
+      -INT32_C(  1475632319),  INT32_C(  1840994777), -INT32_C(   110864077),  INT32_C(   372566454), -INT32_C(  1220732990), -INT32_C(  1621183969), -INT32_C(   734951240),  INT32_C(  1338162446),
+       INT32_C(   972541280),  INT32_C(   467924142), -INT32_C(  1051522293), -INT32_C(  1227388940), -INT32_C(  1116858978),  INT32_C(  1734134983),  INT32_C(  1182199145),  INT32_C(   817076176),
+      -INT32_C(  1955943835),  INT32_C(  1759842396),  INT32_C(   271136795),  INT32_C(  1590034879), -INT32_C(   585419754),  INT32_C(  1464104961),  INT32_C(  1555831179),  INT32_C(   361525168),
+       INT32_C(  1990325786),  INT32_C(   585008647),  INT32_C(  2117208255), -INT32_C(  2027973542),  INT32_C(   788330541), -INT32_C(    75087760), -INT32_C(  1423981950), -INT32_C(   887102287),
+      -INT32_C(  1239154174),  INT32_C(    84156486),  INT32_C(    82443946),  INT32_C(    59443346), -INT32_C(  2144261978), -INT32_C(   440135284),  INT32_C(    99556179), -INT32_C(   623898881),
+      -INT32_C(  1781778787),  INT32_C(  1528479539),  INT32_C(   630038262),  INT32_C(  1468194302), -INT32_C(  1239478742),  INT32_C(  1939661599), -INT32_C(    25654273), -INT32_C(  1187010532),
+      -INT32_C(  1904503717),  INT32_C(  1240044883),  INT32_C(   846165555), -INT32_C(  1255617191),  INT32_C(   523544831), -INT32_C(  1953312628), -INT32_C(   192345509), -INT32_C(  1386519982),
+       INT32_C(  1228658678), -INT32_C(  1600969364), -INT32_C(   271449445), -INT32_C(   210936845), -INT32_C(  1894604285), -INT32_C(  1555212609),  INT32_C(    12756142), -INT32_C(    55697914),
+      -INT32_C(  1755784603), -INT32_C(  1442719730), -INT32_C(  2091939461), -INT32_C(  1660608890),  INT32_C(   465687465), -INT32_C(  1646423414), -INT32_C(  2044351360), -INT32_C(  1081945142),
+      -INT32_C(   887044163),  INT32_C(  1012371137), -INT32_C(  1648318953), -INT32_C(  1084880618), -INT32_C(  2089320455), -INT32_C(  1054780399),  INT32_C(   989437552),  INT32_C(   788102001),
+      -INT32_C(   470148797),  INT32_C(   828206907), -INT32_C(  1806326146), -INT32_C(  1940673617), -INT32_C(  1226887486),  INT32_C(  1646876914),  INT32_C(  1738286070), -INT32_C(   510224994),
+      -INT32_C(   356216658),  INT32_C(  1187355247),  INT32_C(  1997697224), -INT32_C(   586979813), -INT32_C(  2037128300),  INT32_C(   837336379),  INT32_C(  2123924704), -INT32_C(   949998055),
+      -INT32_C(  1095686978), -INT32_C(  1736735751), -INT32_C(  2113839780),  INT32_C(  1211468212), -INT32_C(  1479620500),  INT32_C(  1708701317) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_s32_m(pv, av, bv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+
+    ev = simde_svmin_s32_m(pv, av, bv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) };
+  static const int64_t a[] =
+    { -INT64_C( 7411578444670016024),  INT64_C(  840998936515506933),  INT64_C( 8784450799498271866),  INT64_C( 2547968920489439917),
+      -INT64_C( 7214903332167492199), -INT64_C( 6226796927207449738), -INT64_C( 2124753216310308203), -INT64_C( 3175878611200244082),
+       INT64_C( 5053312356379610336), -INT64_C(  275735081420624301), -INT64_C( 8426926507787050762), -INT64_C( 7521500970521086832),
+       INT64_C(  190344907663914894), -INT64_C( 3526403342097615701),  INT64_C( 3592474616682649170),  INT64_C(    2984566129963196),
+       INT64_C( 1081430584265221713), -INT64_C( 8349901057599305609), -INT64_C( 2514496085647681208),  INT64_C(   97208580424341223),
+       INT64_C( 3743340924600694913), -INT64_C( 8119248749038725748), -INT64_C( 3694197553366552900), -INT64_C( 1775685550508536919),
+      -INT64_C( 1429963933538886601),  INT64_C(  696374921117477588),  INT64_C( 6838049408427631155), -INT64_C( 4469239295966245971),
+       INT64_C( 6466285627975779695), -INT64_C( 6351166792169918842),  INT64_C( 1248804849743610689), -INT64_C( 8215658505057334096),
+       INT64_C( 1423447052357841380), -INT64_C( 7592291247727364473), -INT64_C( 5116967652466793850),  INT64_C( 2565343417331753453),
+      -INT64_C( 7547948247905667425),  INT64_C( 8173810031961188227), -INT64_C( 3795029402138641258), -INT64_C( 2964371074368190343),
+       INT64_C( 4111015386290481255),  INT64_C( 7621640689043021673), -INT64_C(  926232472083553923), -INT64_C( 3120563061372683100),
+       INT64_C( 6908619644778230769), -INT64_C( 1138152367083752713),  INT64_C( 4325268290596977561),  INT64_C( 3147673344671199853),
+       INT64_C( 5247172198968522876), -INT64_C( 7563434946819029595),  INT64_C( 3627562385489417347), -INT64_C( 5491934997574291614),
+      -INT64_C(  915366189102425422),  INT64_C( 2886831161589128828), -INT64_C( 3719520936869512598), -INT64_C( 2741230753514164982),
+      -INT64_C( 8283202660239402293), -INT64_C( 7542659468152596347),  INT64_C( 4326032013787568082),  INT64_C( 7968401163252757140),
+       INT64_C( 2174275008112062861),  INT64_C( 2049310775252169643), -INT64_C(  891041618682366156),  INT64_C( 2298317481194692564),
+      -INT64_C( 6022182414170886731), -INT64_C( 8681825918072277476),  INT64_C( 1332660038546611244),  INT64_C( 2692993630100597934),
+       INT64_C( 2560541608721456604),  INT64_C( 3417964952634920341), -INT64_C( 7333204985590948630),  INT64_C( 1151296649052210277),
+      -INT64_C( 2125571152776762025),  INT64_C(  194844560882010754),  INT64_C(  872684197920796566), -INT64_C( 8688047105347815894),
+       INT64_C( 5726157384882411848),  INT64_C( 1336031403138367856),  INT64_C( 4948523718966293752), -INT64_C( 5666075433433461338),
+       INT64_C( 1838803082314924903), -INT64_C( 2698733824981771777),  INT64_C( 8592065243561664735),  INT64_C( 6182787997831716787),
+      -INT64_C( 3408645674579127056),  INT64_C( 6711444807107695463),  INT64_C( 8448634990276091384),  INT64_C( 3077752099703983475),
+      -INT64_C( 5326222005274197901),  INT64_C( 3432626061307764936),  INT64_C(  213982071817304768),  INT64_C( 6568810020004399557),
+       INT64_C( 2981019434411420761),  INT64_C( 4646609257786989845),  INT64_C( 8115129924312069133),  INT64_C( 8469186341764006468),
+      -INT64_C( 1004729473895159676), -INT64_C( 7090429909671117352),  INT64_C( 6650645772188081199), -INT64_C( 2924505955724313895),
+      -INT64_C( 2735150613825484998),  INT64_C( 3708376763893762377),  INT64_C( 6961817932624932649),  INT64_C( 8159888344526169619),
+       INT64_C( 1090596539606891078),  INT64_C( 5481828679630214876), -INT64_C( 8290235787404042227),  INT64_C( 5618573719530260560),
+      -INT64_C( 1008885387137547734),  INT64_C( 5944158069038638862), -INT64_C( 8787972899074667771),  INT64_C( 6158117422429568033),
+      -INT64_C( 3273759842845258614),  INT64_C( 5531124336674693675), -INT64_C( 6753195462451615605), -INT64_C( 1850625004743731760),
+       INT64_C(  496548088593684046), -INT64_C(  933307904999037063),  INT64_C( 8792710556729792225) };
+  static const int64_t b[] =
+    {  INT64_C(  485786005019969781), -INT64_C( 5787641584171293682),  INT64_C( 4913123714276695128), -INT64_C( 5327969739816060648),
+       INT64_C(  818157585884520839),  INT64_C( 1001332614793235090), -INT64_C( 1490696067781695730),  INT64_C( 5848793599873354676),
+       INT64_C( 6575256320149363512), -INT64_C( 8913337837251656566), -INT64_C( 3955041094914336418),  INT64_C( 8252117590931809386),
+      -INT64_C( 5356776484073165948),  INT64_C( 1073618886516357612), -INT64_C( 4667599116279253413),  INT64_C( 7218277209372587903),
+      -INT64_C( 6303813811443673949),  INT64_C( 1608612704015776148),  INT64_C( 7816771126734262630), -INT64_C( 8540141120210440906),
+       INT64_C( 1984641061986250022), -INT64_C( 1502318240618015659), -INT64_C( 6657690875597443774),  INT64_C( 4250892356468457871),
+      -INT64_C( 8717659141581285791),  INT64_C( 6389690971966628923),  INT64_C(  250550614500004715), -INT64_C( 3877467986470619933),
+       INT64_C( 3424908300250205645),  INT64_C( 5226881316379696923),  INT64_C( 1542370938599706863),  INT64_C( 2594139726337007566),
+      -INT64_C( 8742424298483567735),  INT64_C( 2877589298989210826),  INT64_C( 8617623221850279760),  INT64_C( 7515574151657923537),
+      -INT64_C( 1849975473331408799), -INT64_C( 7237709788341269970), -INT64_C( 2545460629630740084),  INT64_C( 7610889887197452632),
+       INT64_C( 4954672171826119872),  INT64_C( 6375189200079835027), -INT64_C( 6541133979350886575),  INT64_C( 5621473711813901715),
+       INT64_C( 6078712436128102657), -INT64_C( 8115015671119477444), -INT64_C( 4956733483714286013), -INT64_C( 8052619133967854750),
+      -INT64_C( 7879044978290759278), -INT64_C( 3830879353879995896),  INT64_C( 5318066052819239402),  INT64_C(  991768813487334051),
+       INT64_C( 8487606812435114978),  INT64_C( 5347058500889175267), -INT64_C( 4430933869296054702),  INT64_C( 1645143400241281867),
+       INT64_C( 2451955179131385124), -INT64_C( 6474275947883478404), -INT64_C(  634900158548573618),  INT64_C(  172987119235376412),
+       INT64_C( 5271634664423208136), -INT64_C( 4370940849267821475), -INT64_C( 5516521864845838642), -INT64_C( 8545744389072998522),
+      -INT64_C(  921909065367356641),  INT64_C( 8405119498748975725), -INT64_C( 4936966406895905487),  INT64_C(  709747856723968142),
+      -INT64_C( 8139366675117676158), -INT64_C( 2477518920128352125),  INT64_C( 8852706790553783530),  INT64_C(  330351028296416161),
+       INT64_C( 4016691572499057165),  INT64_C( 3341951593235951575), -INT64_C( 3967064171789613685),  INT64_C( 7974162316047727651),
+      -INT64_C( 4296331870853020300),  INT64_C( 5475717168505536907), -INT64_C( 7593995362558063955),  INT64_C( 5710817059793596785),
+      -INT64_C( 4297322202535502421), -INT64_C(  530140202823080807), -INT64_C( 8150273855331735589), -INT64_C( 5655219283544760230),
+       INT64_C( 7889081505296284797),  INT64_C( 8830832777500168009),  INT64_C( 2125045656241855186), -INT64_C(  394955031397081651),
+      -INT64_C( 4893955445310239277),  INT64_C( 1825892194365594428), -INT64_C( 7414748200335565255),  INT64_C( 1502497215928363874),
+      -INT64_C(  797469494959371330),  INT64_C( 6272429195889950636), -INT64_C(  312880769459350460), -INT64_C( 4310592429538798121),
+       INT64_C( 7488048822115297598),  INT64_C( 2565194571841190435),  INT64_C( 3535003933153160570), -INT64_C( 2685421241060628240),
+      -INT64_C( 5151348774667243167), -INT64_C( 4865976384759341963),  INT64_C( 8578193486523640705),  INT64_C( 3331301211938575813),
+       INT64_C( 4262600724955335641),  INT64_C( 3938125976592982440),  INT64_C( 1923068188947478451),  INT64_C( 2336724194504154738),
+       INT64_C( 3153563736330909377),  INT64_C( 1063902137879516119),  INT64_C( 7107798348899865652), -INT64_C( 7674961884702761450),
+      -INT64_C( 7461653412361466939),  INT64_C( 8835753809199532084), -INT64_C(  788509405149403461), -INT64_C( 8994022988306009916),
+       INT64_C( 7004290582286388187), -INT64_C(  322412818052589370), -INT64_C(  771604067428889994) };
+  static const int64_t e[] =
+    { -INT64_C( 7411578444670016024), -INT64_C( 5787641584171293682),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 7214903332167492199),  INT64_C(                   0), -INT64_C( 2124753216310308203),  INT64_C(                   0),
+       INT64_C( 5053312356379610336),  INT64_C(                   0), -INT64_C( 8426926507787050762), -INT64_C( 7521500970521086832),
+      -INT64_C( 5356776484073165948), -INT64_C( 3526403342097615701),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2514496085647681208),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 8119248749038725748),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 8717659141581285791),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4469239295966245971),
+       INT64_C( 3424908300250205645),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 8215658505057334096),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2565343417331753453),
+      -INT64_C( 7547948247905667425), -INT64_C( 7237709788341269970),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 6541133979350886575), -INT64_C( 3120563061372683100),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 7879044978290759278), -INT64_C( 7563434946819029595),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4430933869296054702), -INT64_C( 2741230753514164982),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(  634900158548573618),  INT64_C(  172987119235376412),
+       INT64_C( 2174275008112062861), -INT64_C( 4370940849267821475),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 8681825918072277476),  INT64_C(                   0),  INT64_C(  709747856723968142),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 7333204985590948630),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(  194844560882010754), -INT64_C( 3967064171789613685),  INT64_C(                   0),
+      -INT64_C( 4296331870853020300),  INT64_C(                   0), -INT64_C( 7593995362558063955),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 8150273855331735589), -INT64_C( 5655219283544760230),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(  394955031397081651),
+      -INT64_C( 5326222005274197901),  INT64_C( 1825892194365594428), -INT64_C( 7414748200335565255),  INT64_C(                   0),
+      -INT64_C(  797469494959371330),  INT64_C(                   0), -INT64_C(  312880769459350460),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 7090429909671117352),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 6961817932624932649),  INT64_C( 3331301211938575813),
+       INT64_C( 1090596539606891078),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 1063902137879516119), -INT64_C( 8787972899074667771),  INT64_C(                   0),
+      -INT64_C( 7461653412361466939),  INT64_C(                   0), -INT64_C( 6753195462451615605), -INT64_C( 8994022988306009916),
+       INT64_C(  496548088593684046),  INT64_C(                   0), -INT64_C(  771604067428889994) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_s64_z(pv, av, bv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+
+    ev = simde_svmin_s64_z(pv, av, bv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const int64_t a[] =
+    {  INT64_C( 9113217759369051744), -INT64_C( 3001840179781106910),  INT64_C( 8565891829193605715), -INT64_C( 8272868230110542523),
+      -INT64_C(  874065764842657252),  INT64_C( 3084146436648961460), -INT64_C( 4878776669345001832), -INT64_C( 1487863739769425505),
+      -INT64_C(  506046635968851147),  INT64_C( 7543736975336913326), -INT64_C( 6611697650003744246),  INT64_C( 6499760944408697209),
+       INT64_C( 6168343415162502749),  INT64_C( 5786152757867809045), -INT64_C( 8422558056573662859), -INT64_C( 5285247561851695575),
+       INT64_C( 8756107513098078342),  INT64_C( 6778386835117530747),  INT64_C( 2076711328392143667),  INT64_C( 3643713007632688515),
+       INT64_C( 6194670340034062618),  INT64_C( 3641205370821956673), -INT64_C( 2946682001283391733), -INT64_C( 5635053615821126163),
+       INT64_C( 5790826541872000045), -INT64_C( 6364990777281842054),  INT64_C( 6381251489912201826), -INT64_C( 5507973237558853305),
+       INT64_C( 6866609428611448555),  INT64_C( 3085110640450782860), -INT64_C( 9193694877708093787),  INT64_C(  497909555156376496),
+       INT64_C( 5255785137911735212), -INT64_C( 1151442335663273966),  INT64_C(  391930084912654007),  INT64_C( 7630825912748723909),
+       INT64_C( 5101428509905708999),  INT64_C( 3885804376050187442),  INT64_C( 2191165425552059917), -INT64_C( 8247809702944136349),
+       INT64_C( 2253168078564131787), -INT64_C( 7364782266215799528), -INT64_C( 1698310585231609608),  INT64_C( 1971047563151305734),
+       INT64_C( 6890611091078540052), -INT64_C( 4690005578935321404),  INT64_C( 5629074333340984496), -INT64_C( 3722938983330928919),
+      -INT64_C( 7888073653109231647), -INT64_C( 1283583904013189717), -INT64_C( 6609523131853619793), -INT64_C( 5121661677164666520),
+      -INT64_C( 3169575185525228893),  INT64_C( 6850103333068596709), -INT64_C( 2517339064045718351), -INT64_C( 4283228764520976642),
+      -INT64_C( 4890565222983176412), -INT64_C( 8345750811411847651),  INT64_C( 2267008402820989987), -INT64_C( 9017186818533788682),
+       INT64_C( 7459915136318247411),  INT64_C( 8556384451514688599), -INT64_C( 5465534046558767386), -INT64_C( 7793294848071885576),
+      -INT64_C( 1122834915044513863), -INT64_C( 1796408478841790649), -INT64_C( 7059368616064573290),  INT64_C( 3775367219818844977),
+      -INT64_C( 1442100054713712269), -INT64_C( 7770229989269168575),  INT64_C( 6844609611352774840),  INT64_C( 3418957503834091715),
+      -INT64_C( 8294443814282876588), -INT64_C( 4906680580117206443), -INT64_C( 8962983772272603375), -INT64_C( 5408765562299757563),
+      -INT64_C( 5065263825814737699), -INT64_C( 8306339224327781381), -INT64_C( 1439347687340387645), -INT64_C( 2789524790322542796),
+      -INT64_C( 9014316912443525431), -INT64_C( 6178593550741999047), -INT64_C( 6278524253135631349), -INT64_C(  950393481568875526),
+      -INT64_C( 4646301367426625412),  INT64_C( 5442799435596957432) };
+  static const int64_t b[] =
+    {  INT64_C(  882111700694165897), -INT64_C( 4217371500398206491),  INT64_C( 3230235165248599167),  INT64_C( 4739090523481233400),
+      -INT64_C( 6700359267816449269),  INT64_C( 5541437230459644715), -INT64_C( 7545555092406434217),  INT64_C( 8763237889745276068),
+      -INT64_C( 6952306078445999582), -INT64_C( 6162989915374997666), -INT64_C( 2060944112243805905),  INT64_C( 5891232982722734298),
+       INT64_C(  134181801608425928),  INT64_C( 8638648760553807589), -INT64_C( 7982158965422774250),  INT64_C( 2167809592620841365),
+      -INT64_C( 2201917185467922740),  INT64_C( 6454778956604874453),  INT64_C( 2011957322295794084),  INT64_C( 3231038478923842913),
+       INT64_C( 4402000802510221626), -INT64_C( 3438519013257695062),  INT64_C( 4568645491007092422),  INT64_C( 8459954975524931291),
+      -INT64_C( 5070275759568125187), -INT64_C( 5769129912612422413),  INT64_C(  793024070474799844), -INT64_C( 4514386090307160150),
+      -INT64_C( 4937975127390878289), -INT64_C( 1054183102641135675),  INT64_C( 7430856634373724900), -INT64_C( 4453597057897437781),
+      -INT64_C( 1788219179480885078), -INT64_C( 5181967708042491625),  INT64_C( 2914651926380202061),  INT64_C( 1019722699155947089),
+      -INT64_C( 5320528386211076576), -INT64_C(   52934120957034824),  INT64_C( 5574750435929624761), -INT64_C( 2400744341913864901),
+      -INT64_C( 7578632529614196866),  INT64_C( 6393252882709327367),  INT64_C( 8988880568293639029), -INT64_C( 4216555316686655264),
+      -INT64_C( 1410551489299833864),  INT64_C( 7519708400656420452), -INT64_C( 5413722763605448414), -INT64_C( 4894060656311797241),
+       INT64_C( 1241304292113184616),  INT64_C( 6910897037644258957),  INT64_C( 6981037197986218329),  INT64_C( 7501241060701451162),
+       INT64_C( 4069546158252731578),  INT64_C( 6370800160854281933),  INT64_C( 7212910398604126817),  INT64_C( 5044835929546737818),
+       INT64_C( 8316503256661407879),  INT64_C( 2525365739980661429), -INT64_C( 7908049396961537775),  INT64_C( 7318682397437592255),
+       INT64_C( 1945557678509473766),  INT64_C( 8433793379125394980), -INT64_C( 7064580056125675669),  INT64_C( 3951197634486083987),
+      -INT64_C( 7837454744954901063),  INT64_C( 5772636039474186818), -INT64_C( 7933185308949779092),  INT64_C(  167151370158329802),
+       INT64_C( 1893302779143853124), -INT64_C( 5576620419579788954), -INT64_C( 4406239009672704438), -INT64_C(  720807172864419148),
+      -INT64_C( 2074488732737068990),  INT64_C( 2137179935392855728),  INT64_C( 4526467863168787736),  INT64_C( 2143496663316803096),
+       INT64_C(  557159202950768730), -INT64_C( 3795507871802857117),  INT64_C( 1014344517238306891), -INT64_C( 2138197687284511142),
+       INT64_C( 6583829414746426112),  INT64_C( 5466494736666811230), -INT64_C( 4782766301521070180),  INT64_C( 1291483132632136065),
+       INT64_C( 8729038325402871504),  INT64_C( 3777789565529207841) };
+  static const int64_t e[] =
+    {  INT64_C( 9113217759369051744), -INT64_C( 3001840179781106910),  INT64_C( 3230235165248599167), -INT64_C( 8272868230110542523),
+      -INT64_C( 6700359267816449269),  INT64_C( 3084146436648961460), -INT64_C( 4878776669345001832), -INT64_C( 1487863739769425505),
+      -INT64_C( 6952306078445999582), -INT64_C( 6162989915374997666), -INT64_C( 6611697650003744246),  INT64_C( 6499760944408697209),
+       INT64_C( 6168343415162502749),  INT64_C( 5786152757867809045), -INT64_C( 8422558056573662859), -INT64_C( 5285247561851695575),
+       INT64_C( 8756107513098078342),  INT64_C( 6778386835117530747),  INT64_C( 2011957322295794084),  INT64_C( 3231038478923842913),
+       INT64_C( 6194670340034062618), -INT64_C( 3438519013257695062), -INT64_C( 2946682001283391733), -INT64_C( 5635053615821126163),
+      -INT64_C( 5070275759568125187), -INT64_C( 6364990777281842054),  INT64_C( 6381251489912201826), -INT64_C( 5507973237558853305),
+      -INT64_C( 4937975127390878289),  INT64_C( 3085110640450782860), -INT64_C( 9193694877708093787), -INT64_C( 4453597057897437781),
+       INT64_C( 5255785137911735212), -INT64_C( 5181967708042491625),  INT64_C(  391930084912654007),  INT64_C( 7630825912748723909),
+      -INT64_C( 5320528386211076576),  INT64_C( 3885804376050187442),  INT64_C( 2191165425552059917), -INT64_C( 8247809702944136349),
+       INT64_C( 2253168078564131787), -INT64_C( 7364782266215799528), -INT64_C( 1698310585231609608),  INT64_C( 1971047563151305734),
+      -INT64_C( 1410551489299833864), -INT64_C( 4690005578935321404), -INT64_C( 5413722763605448414), -INT64_C( 3722938983330928919),
+      -INT64_C( 7888073653109231647), -INT64_C( 1283583904013189717), -INT64_C( 6609523131853619793), -INT64_C( 5121661677164666520),
+      -INT64_C( 3169575185525228893),  INT64_C( 6850103333068596709), -INT64_C( 2517339064045718351), -INT64_C( 4283228764520976642),
+      -INT64_C( 4890565222983176412), -INT64_C( 8345750811411847651), -INT64_C( 7908049396961537775), -INT64_C( 9017186818533788682),
+       INT64_C( 7459915136318247411),  INT64_C( 8556384451514688599), -INT64_C( 5465534046558767386), -INT64_C( 7793294848071885576),
+      -INT64_C( 7837454744954901063), -INT64_C( 1796408478841790649), -INT64_C( 7933185308949779092),  INT64_C(  167151370158329802),
+      -INT64_C( 1442100054713712269), -INT64_C( 7770229989269168575), -INT64_C( 4406239009672704438), -INT64_C(  720807172864419148),
+      -INT64_C( 8294443814282876588), -INT64_C( 4906680580117206443), -INT64_C( 8962983772272603375), -INT64_C( 5408765562299757563),
+      -INT64_C( 5065263825814737699), -INT64_C( 8306339224327781381), -INT64_C( 1439347687340387645), -INT64_C( 2789524790322542796),
+      -INT64_C( 9014316912443525431), -INT64_C( 6178593550741999047), -INT64_C( 6278524253135631349), -INT64_C(  950393481568875526),
+      -INT64_C( 4646301367426625412),  INT64_C( 3777789565529207841) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_s64_m(pv, av, bv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+
+    ev = simde_svmin_s64_m(pv, av, bv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(151), UINT8_C( 45), UINT8_C( 72), UINT8_C( 81), UINT8_C(244), UINT8_C(240), UINT8_C( 75), UINT8_C( 96),
+      UINT8_C( 96), UINT8_C(247), UINT8_C(165), UINT8_C(114),    UINT8_MAX, UINT8_C(167), UINT8_C( 63), UINT8_C(236),
+      UINT8_C(210), UINT8_C( 29), UINT8_C(134), UINT8_C(177), UINT8_C(118), UINT8_C(188), UINT8_C(143), UINT8_C(210),
+      UINT8_C(155), UINT8_C(254), UINT8_C( 23), UINT8_C(198), UINT8_C(155), UINT8_C(109), UINT8_C(237), UINT8_C( 51),
+      UINT8_C(154), UINT8_C( 53), UINT8_C(132), UINT8_C(142), UINT8_C( 37), UINT8_C(207), UINT8_C(239), UINT8_C(134),
+      UINT8_C(198), UINT8_C(148), UINT8_C(248), UINT8_C(197), UINT8_C( 59), UINT8_C( 55), UINT8_C(177), UINT8_C( 13),
+      UINT8_C( 84), UINT8_C( 56), UINT8_C(191), UINT8_C(203), UINT8_C(244), UINT8_C( 78), UINT8_C(157), UINT8_C(143),
+      UINT8_C( 76), UINT8_C(180), UINT8_C( 85), UINT8_C(232), UINT8_C( 33), UINT8_C( 66), UINT8_C( 27), UINT8_C(188),
+      UINT8_C(120), UINT8_C(159), UINT8_C( 74), UINT8_C(157), UINT8_C(110), UINT8_C( 57), UINT8_C( 35), UINT8_C( 52),
+      UINT8_C(205), UINT8_C( 28), UINT8_C(250), UINT8_C(  9), UINT8_C( 83), UINT8_C(171), UINT8_C( 22), UINT8_C(168),
+      UINT8_C(227), UINT8_C(213), UINT8_C(115), UINT8_C(216), UINT8_C( 36), UINT8_C( 16), UINT8_C(103), UINT8_C(112),
+      UINT8_C(196), UINT8_C(189), UINT8_C( 88), UINT8_C(229),    UINT8_MAX, UINT8_C(115), UINT8_C(161), UINT8_C(119),
+      UINT8_C( 18), UINT8_C(236), UINT8_C( 21), UINT8_C(128), UINT8_C( 37), UINT8_C( 56), UINT8_C(181), UINT8_C(243),
+      UINT8_C( 84), UINT8_C(175), UINT8_C(252), UINT8_C(168), UINT8_C( 90), UINT8_C( 18), UINT8_C( 80), UINT8_C( 62),
+      UINT8_C(232), UINT8_C(195), UINT8_C( 22), UINT8_C( 12), UINT8_C(211), UINT8_C(125), UINT8_C(124), UINT8_C(151),
+      UINT8_C( 58), UINT8_C(213), UINT8_C(124), UINT8_C( 58), UINT8_C( 72), UINT8_C( 30), UINT8_C(177), UINT8_C( 91),
+      UINT8_C( 10), UINT8_C(198), UINT8_C(219), UINT8_C( 47),    UINT8_MAX, UINT8_C(144), UINT8_C( 34), UINT8_C( 83),
+      UINT8_C( 63), UINT8_C( 30), UINT8_C(251), UINT8_C(154), UINT8_C( 49), UINT8_C( 75), UINT8_C(216), UINT8_C( 25),
+      UINT8_C( 14), UINT8_C(238), UINT8_C( 37), UINT8_C(225), UINT8_C(107), UINT8_C(161), UINT8_C(120), UINT8_C(166),
+      UINT8_C(118), UINT8_C(245), UINT8_C(224), UINT8_C(191), UINT8_C( 19), UINT8_C(145), UINT8_C( 26), UINT8_C( 29),
+      UINT8_C( 88), UINT8_C(245), UINT8_C( 76), UINT8_C( 87), UINT8_C(134), UINT8_C(111), UINT8_C(170), UINT8_C(197),
+      UINT8_C(141), UINT8_C(166), UINT8_C( 95), UINT8_C(190), UINT8_C(241), UINT8_C( 55), UINT8_C(215), UINT8_C(  0),
+      UINT8_C( 37), UINT8_C(252), UINT8_C(225), UINT8_C(145), UINT8_C(158), UINT8_C( 90), UINT8_C( 55), UINT8_C( 20),
+      UINT8_C( 79), UINT8_C( 23), UINT8_C(211), UINT8_C( 98), UINT8_C(168), UINT8_C(237), UINT8_C(127), UINT8_C(  0),
+      UINT8_C(227), UINT8_C(203), UINT8_C( 87), UINT8_C(105), UINT8_C( 58), UINT8_C(  2), UINT8_C( 46), UINT8_C(200),
+      UINT8_C(168), UINT8_C(142), UINT8_C(134), UINT8_C(153), UINT8_C(197), UINT8_C( 94), UINT8_C(153), UINT8_C(235),
+      UINT8_C( 90), UINT8_C(123), UINT8_C(124), UINT8_C(248), UINT8_C(213), UINT8_C(179), UINT8_C( 13), UINT8_C( 36),
+      UINT8_C(202), UINT8_C(224), UINT8_C(134), UINT8_C(114), UINT8_C(206), UINT8_C(  5), UINT8_C(115), UINT8_C(177),
+      UINT8_C(208), UINT8_C(202), UINT8_C( 26), UINT8_C( 11), UINT8_C(204), UINT8_C( 72), UINT8_C(211), UINT8_C(116),
+      UINT8_C(214), UINT8_C( 89), UINT8_C( 14), UINT8_C(156), UINT8_C(183), UINT8_C(167), UINT8_C(135), UINT8_C( 18),
+      UINT8_C( 34), UINT8_C(  3), UINT8_C( 10), UINT8_C(247), UINT8_C(182), UINT8_C( 23), UINT8_C( 27), UINT8_C(128),
+      UINT8_C(248), UINT8_C(161), UINT8_C(242), UINT8_C(198), UINT8_C(166), UINT8_C(101), UINT8_C(119), UINT8_C(119),
+      UINT8_C( 48), UINT8_C(145), UINT8_C(130), UINT8_C(252), UINT8_C(217), UINT8_C( 85), UINT8_C(113), UINT8_C(176),
+      UINT8_C(174), UINT8_C(127), UINT8_C( 76), UINT8_C(102), UINT8_C( 38), UINT8_C(211), UINT8_C(120), UINT8_C( 73),
+      UINT8_C(214), UINT8_C(130), UINT8_C( 64), UINT8_C(140), UINT8_C(154), UINT8_C( 92), UINT8_C( 12), UINT8_C(146),
+      UINT8_C(253), UINT8_C(254), UINT8_C( 88), UINT8_C(164), UINT8_C(100), UINT8_C(207), UINT8_C( 27), UINT8_C(148),
+      UINT8_C( 96), UINT8_C(157), UINT8_C(144), UINT8_C( 57), UINT8_C(242), UINT8_C(  1), UINT8_C(233), UINT8_C(160),
+      UINT8_C(128), UINT8_C( 53), UINT8_C(  6), UINT8_C(167), UINT8_C(  8), UINT8_C(126), UINT8_C(240), UINT8_C(222),
+      UINT8_C(  1), UINT8_C( 48), UINT8_C(106), UINT8_C(155), UINT8_C(140), UINT8_C(118), UINT8_C( 45), UINT8_C(138),
+      UINT8_C(117), UINT8_C(133), UINT8_C( 46), UINT8_C(217), UINT8_C( 84), UINT8_C( 73), UINT8_C(109), UINT8_C(180),
+      UINT8_C(230), UINT8_C(253), UINT8_C(237), UINT8_C(216),    UINT8_MAX, UINT8_C(215), UINT8_C(120), UINT8_C(127),
+      UINT8_C( 12), UINT8_C(127), UINT8_C( 38), UINT8_C( 21), UINT8_C(253), UINT8_C( 22), UINT8_C(243), UINT8_C(254),
+      UINT8_C( 71), UINT8_C( 94), UINT8_C(153), UINT8_C(211), UINT8_C(212), UINT8_C(198), UINT8_C( 93), UINT8_C( 73),
+      UINT8_C( 75), UINT8_C(139), UINT8_C( 34), UINT8_C(159), UINT8_C(212), UINT8_C(143), UINT8_C( 83), UINT8_C(186),
+      UINT8_C(141), UINT8_C( 65), UINT8_C(146), UINT8_C(140), UINT8_C( 24), UINT8_C( 11), UINT8_C( 11), UINT8_C( 36),
+      UINT8_C(138), UINT8_C( 50), UINT8_C( 57), UINT8_C(135), UINT8_C( 72), UINT8_C( 45), UINT8_C(134), UINT8_C(143),
+      UINT8_C(139), UINT8_C( 31), UINT8_C( 99), UINT8_C( 95), UINT8_C(230), UINT8_C(192), UINT8_C(169), UINT8_C( 49),
+      UINT8_C( 76), UINT8_C(203), UINT8_C(209), UINT8_C( 32), UINT8_C( 91), UINT8_C( 36), UINT8_C(219), UINT8_C(232),
+      UINT8_C(101), UINT8_C(109), UINT8_C(116), UINT8_C(125), UINT8_C(120), UINT8_C(127), UINT8_C(162), UINT8_C(  2),
+      UINT8_C(177), UINT8_C(219), UINT8_C(138), UINT8_C(250), UINT8_C(  8), UINT8_C( 16), UINT8_C(137), UINT8_C(147),
+      UINT8_C( 47), UINT8_C(236), UINT8_C(243), UINT8_C( 21), UINT8_C(173), UINT8_C(156), UINT8_C( 71), UINT8_C(249),
+      UINT8_C(103), UINT8_C( 24), UINT8_C( 25), UINT8_C(194), UINT8_C( 60), UINT8_C(244), UINT8_C(170), UINT8_C(162),
+      UINT8_C( 98), UINT8_C( 30), UINT8_C( 31), UINT8_C(218), UINT8_C(158), UINT8_C(193), UINT8_C(221), UINT8_C( 79),
+      UINT8_C(157), UINT8_C(103), UINT8_C( 73), UINT8_C(165), UINT8_C(119), UINT8_C(211), UINT8_C( 57), UINT8_C(166),
+      UINT8_C(191), UINT8_C( 44), UINT8_C(188), UINT8_C(108), UINT8_C(200), UINT8_C(  3), UINT8_C(101), UINT8_C( 47),
+      UINT8_C( 27), UINT8_C(127), UINT8_C(242), UINT8_C( 87), UINT8_C(115), UINT8_C(156), UINT8_C(249), UINT8_C(213),
+      UINT8_C(187), UINT8_C( 25), UINT8_C(176), UINT8_C( 89), UINT8_C(218), UINT8_C(141), UINT8_C(168), UINT8_C(119),
+      UINT8_C(244), UINT8_C(242), UINT8_C( 29), UINT8_C(107), UINT8_C(197), UINT8_C( 86), UINT8_C( 17), UINT8_C(132),
+      UINT8_C(130), UINT8_C(205), UINT8_C(241), UINT8_C( 74), UINT8_C(208), UINT8_C( 86), UINT8_C(121), UINT8_C(235),
+      UINT8_C(213), UINT8_C(107), UINT8_C( 67), UINT8_C( 73), UINT8_C(  8), UINT8_C( 60), UINT8_C( 30), UINT8_C(195),
+      UINT8_C( 85), UINT8_C(206), UINT8_C( 28), UINT8_C( 48), UINT8_C( 91), UINT8_C(196), UINT8_C(167), UINT8_C( 79),
+      UINT8_C(182), UINT8_C(196), UINT8_C(186), UINT8_C(123), UINT8_C( 26), UINT8_C(204), UINT8_C(  0), UINT8_C(156),
+      UINT8_C(153), UINT8_C(241), UINT8_C(230), UINT8_C(106), UINT8_C( 71), UINT8_C( 96), UINT8_C( 85), UINT8_C( 29),
+      UINT8_C(203), UINT8_C(152), UINT8_C(102), UINT8_C(211), UINT8_C(213), UINT8_C(132), UINT8_C(150), UINT8_C( 42),
+      UINT8_C( 83), UINT8_C(178), UINT8_C( 90), UINT8_C(174), UINT8_C(119), UINT8_C(  2), UINT8_C(254), UINT8_C( 45),
+      UINT8_C(198), UINT8_C(184), UINT8_C(169), UINT8_C(225), UINT8_C(132), UINT8_C(169), UINT8_C(125), UINT8_C( 30),
+      UINT8_C(154), UINT8_C(100), UINT8_C(136), UINT8_C(225), UINT8_C(196), UINT8_C(221), UINT8_C(254), UINT8_C(143),
+      UINT8_C(118), UINT8_C(100), UINT8_C( 99), UINT8_C( 75), UINT8_C(233), UINT8_C(249), UINT8_C(117), UINT8_C( 60),
+      UINT8_C(172), UINT8_C(208), UINT8_C(234), UINT8_C( 35), UINT8_C(210), UINT8_C(232), UINT8_C( 80), UINT8_C(152),
+      UINT8_C(161), UINT8_C(249), UINT8_C(121), UINT8_C( 37), UINT8_C(162), UINT8_C(247), UINT8_C( 67), UINT8_C( 60),
+      UINT8_C( 91), UINT8_C(203), UINT8_C( 30), UINT8_C( 31), UINT8_C(169), UINT8_C( 28), UINT8_C(174), UINT8_C( 31),
+      UINT8_C(129), UINT8_C( 17), UINT8_C(106), UINT8_C(106), UINT8_C( 11), UINT8_C(223), UINT8_C(166), UINT8_C(183),
+      UINT8_C(175), UINT8_C(144), UINT8_C(218), UINT8_C(129), UINT8_C(121), UINT8_C( 42), UINT8_C( 26), UINT8_C( 26),
+      UINT8_C( 36), UINT8_C(147), UINT8_C( 63), UINT8_C(198), UINT8_C(138), UINT8_C(131), UINT8_C(  3), UINT8_C(229),
+      UINT8_C( 78), UINT8_C( 33), UINT8_C(  4), UINT8_C(247), UINT8_C( 61) };
+  static const uint8_t b[] =
+    { UINT8_C(158), UINT8_C(248), UINT8_C(206), UINT8_C(  0), UINT8_C(  0), UINT8_C( 66), UINT8_C( 44), UINT8_C(190),
+      UINT8_C( 14), UINT8_C(219), UINT8_C(  8), UINT8_C(195), UINT8_C( 80), UINT8_C(107), UINT8_C(152), UINT8_C(  8),
+      UINT8_C( 82), UINT8_C( 37), UINT8_C(176), UINT8_C( 88), UINT8_C(  9), UINT8_C( 67), UINT8_C(147), UINT8_C(  6),
+      UINT8_C(104), UINT8_C(113), UINT8_C(181), UINT8_C( 28), UINT8_C(147), UINT8_C(165), UINT8_C( 37), UINT8_C( 49),
+      UINT8_C(157), UINT8_C(243), UINT8_C( 49), UINT8_C(157), UINT8_C( 54), UINT8_C( 93), UINT8_C( 92), UINT8_C( 68),
+      UINT8_C( 57), UINT8_C(100), UINT8_C(  7), UINT8_C(137), UINT8_C(207), UINT8_C(159), UINT8_C(145), UINT8_C( 34),
+      UINT8_C(196), UINT8_C( 66), UINT8_C(122), UINT8_C(205), UINT8_C(133), UINT8_C( 14), UINT8_C(211), UINT8_C(237),
+      UINT8_C(127), UINT8_C(137), UINT8_C(  9), UINT8_C( 18), UINT8_C( 46), UINT8_C( 46), UINT8_C( 67), UINT8_C(203),
+      UINT8_C( 34), UINT8_C(116), UINT8_C(105), UINT8_C( 88), UINT8_C(209), UINT8_C(197), UINT8_C(156), UINT8_C( 10),
+      UINT8_C( 41), UINT8_C(163), UINT8_C(148), UINT8_C(248), UINT8_C( 67), UINT8_C( 37), UINT8_C( 26), UINT8_C(  7),
+      UINT8_C(103), UINT8_C(149), UINT8_C(213), UINT8_C(236), UINT8_C(163), UINT8_C(168), UINT8_C(218), UINT8_C( 34),
+      UINT8_C( 49), UINT8_C(227), UINT8_C( 52), UINT8_C( 95), UINT8_C( 18), UINT8_C(119), UINT8_C( 43), UINT8_C( 52),
+      UINT8_C(235), UINT8_C(148), UINT8_C(140), UINT8_C(188), UINT8_C( 89), UINT8_C( 40), UINT8_C(199), UINT8_C(130),
+      UINT8_C(203), UINT8_C( 91), UINT8_C(122), UINT8_C( 14), UINT8_C(128), UINT8_C(149), UINT8_C( 22), UINT8_C(232),
+      UINT8_C( 42), UINT8_C(235), UINT8_C(212), UINT8_C(205), UINT8_C(147), UINT8_C(174), UINT8_C(239), UINT8_C(197),
+      UINT8_C(146), UINT8_C( 35), UINT8_C( 36), UINT8_C(164), UINT8_C(154), UINT8_C( 79), UINT8_C(216), UINT8_C(133),
+      UINT8_C(227), UINT8_C(100), UINT8_C( 65), UINT8_C( 60), UINT8_C(140), UINT8_C(  8), UINT8_C(190), UINT8_C( 87),
+      UINT8_C( 99), UINT8_C( 57), UINT8_C(102), UINT8_C(228), UINT8_C(206), UINT8_C(124), UINT8_C(204), UINT8_C(248),
+      UINT8_C(103), UINT8_C(160), UINT8_C(197), UINT8_C(250), UINT8_C( 79), UINT8_C(180), UINT8_C(191), UINT8_C(225),
+      UINT8_C(215), UINT8_C(228), UINT8_C(133), UINT8_C(113), UINT8_C( 51), UINT8_C( 93), UINT8_C(246), UINT8_C( 23),
+      UINT8_C(193), UINT8_C( 55), UINT8_C( 83), UINT8_C( 77), UINT8_C( 64), UINT8_C( 18), UINT8_C(164), UINT8_C(163),
+      UINT8_C( 75), UINT8_C( 10), UINT8_C(135), UINT8_C( 25), UINT8_C(134), UINT8_C( 83), UINT8_C( 17), UINT8_C(237),
+      UINT8_C(244), UINT8_C(214), UINT8_C(232), UINT8_C( 67), UINT8_C(138), UINT8_C(167), UINT8_C( 36), UINT8_C( 97),
+      UINT8_C(139), UINT8_C(169), UINT8_C(210), UINT8_C(191), UINT8_C(  6), UINT8_C(200), UINT8_C(214), UINT8_C(199),
+         UINT8_MAX, UINT8_C( 41), UINT8_C( 20), UINT8_C( 63), UINT8_C( 59), UINT8_C(184), UINT8_C(227), UINT8_C(134),
+      UINT8_C(195), UINT8_C(106), UINT8_C(159), UINT8_C( 73), UINT8_C(190), UINT8_C(176), UINT8_C( 55), UINT8_C(178),
+      UINT8_C(134), UINT8_C( 31), UINT8_C(245), UINT8_C( 16), UINT8_C(198), UINT8_C( 25), UINT8_C(113), UINT8_C( 82),
+      UINT8_C(194), UINT8_C( 67), UINT8_C( 17), UINT8_C(200), UINT8_C( 11), UINT8_C(231), UINT8_C(143), UINT8_C( 11),
+      UINT8_C( 16), UINT8_C(163), UINT8_C( 74), UINT8_C( 76), UINT8_C( 91), UINT8_C( 45), UINT8_C(210), UINT8_C( 30),
+      UINT8_C(152), UINT8_C(114), UINT8_C(104), UINT8_C( 86), UINT8_C( 34), UINT8_C(159), UINT8_C(  8), UINT8_C(169),
+      UINT8_C(190), UINT8_C(253), UINT8_C(185), UINT8_C(132), UINT8_C( 22), UINT8_C( 43), UINT8_C(214), UINT8_C(216),
+      UINT8_C(110), UINT8_C(231), UINT8_C(160), UINT8_C(122), UINT8_C(206), UINT8_C( 47), UINT8_C(133), UINT8_C(223),
+      UINT8_C(210), UINT8_C(207), UINT8_C( 43), UINT8_C( 45), UINT8_C(253), UINT8_C(253), UINT8_C( 76), UINT8_C(149),
+      UINT8_C(111), UINT8_C(180), UINT8_C(235), UINT8_C(146), UINT8_C( 83), UINT8_C(243), UINT8_C( 59), UINT8_C( 17),
+      UINT8_C(240), UINT8_C(244), UINT8_C(149), UINT8_C(  6), UINT8_C( 31), UINT8_C(108), UINT8_C(222), UINT8_C(142),
+      UINT8_C( 83), UINT8_C(126), UINT8_C(  8), UINT8_C( 34), UINT8_C(173), UINT8_C(141), UINT8_C(  1), UINT8_C(127),
+      UINT8_C( 92), UINT8_C( 44), UINT8_C(172), UINT8_C( 89), UINT8_C( 41), UINT8_C(248), UINT8_C(238), UINT8_C(153),
+      UINT8_C(172), UINT8_C(217), UINT8_C( 43),    UINT8_MAX, UINT8_C(204), UINT8_C(102), UINT8_C( 16), UINT8_C(188),
+      UINT8_C( 90), UINT8_C(166), UINT8_C(194), UINT8_C(122), UINT8_C( 18), UINT8_C(160), UINT8_C(  8), UINT8_C(101),
+      UINT8_C( 30), UINT8_C( 16), UINT8_C(135), UINT8_C(203), UINT8_C(157), UINT8_C(136), UINT8_C( 74), UINT8_C(249),
+      UINT8_C(180), UINT8_C(247), UINT8_C( 83), UINT8_C(222), UINT8_C(239), UINT8_C( 65), UINT8_C(119), UINT8_C(156),
+      UINT8_C( 27), UINT8_C(162), UINT8_C(155), UINT8_C(231), UINT8_C(  8), UINT8_C(172), UINT8_C(164), UINT8_C( 98),
+      UINT8_C( 82), UINT8_C(102), UINT8_C(220), UINT8_C(100), UINT8_C(  7), UINT8_C(228), UINT8_C(201), UINT8_C( 37),
+      UINT8_C(244), UINT8_C( 81), UINT8_C(241), UINT8_C(145), UINT8_C(217), UINT8_C( 59), UINT8_C(139), UINT8_C(142),
+      UINT8_C( 50), UINT8_C(222), UINT8_C(108), UINT8_C( 34), UINT8_C( 31), UINT8_C(227), UINT8_C(190), UINT8_C( 58),
+      UINT8_C(133), UINT8_C( 89), UINT8_C( 34), UINT8_C(141), UINT8_C(  5), UINT8_C(198), UINT8_C(239), UINT8_C( 87),
+      UINT8_C( 44), UINT8_C(204), UINT8_C(187), UINT8_C( 51), UINT8_C(176), UINT8_C(133), UINT8_C( 89), UINT8_C(165),
+      UINT8_C(214), UINT8_C( 74), UINT8_C( 54), UINT8_C(175), UINT8_C(133), UINT8_C(193), UINT8_C( 61), UINT8_C(184),
+      UINT8_C(159), UINT8_C(169), UINT8_C(218), UINT8_C(191), UINT8_C(140), UINT8_C(152), UINT8_C(249), UINT8_C( 17),
+      UINT8_C(241), UINT8_C( 27), UINT8_C(158), UINT8_C(247), UINT8_C(225), UINT8_C(142), UINT8_C( 78), UINT8_C( 14),
+      UINT8_C( 90), UINT8_C( 10), UINT8_C( 65), UINT8_C( 10), UINT8_C(143), UINT8_C(154), UINT8_C(175), UINT8_C(101),
+      UINT8_C(228), UINT8_C(230), UINT8_C( 20), UINT8_C(106), UINT8_C(167), UINT8_C( 82), UINT8_C( 34), UINT8_C( 71),
+      UINT8_C(251), UINT8_C(252), UINT8_C(  6), UINT8_C(136), UINT8_C(148),    UINT8_MAX, UINT8_C(153), UINT8_C(133),
+      UINT8_C( 27), UINT8_C( 56), UINT8_C(124), UINT8_C(252), UINT8_C(198), UINT8_C(203), UINT8_C( 10), UINT8_C( 32),
+      UINT8_C(213), UINT8_C( 76), UINT8_C( 42), UINT8_C(100), UINT8_C(230), UINT8_C(218), UINT8_C(201), UINT8_C(203),
+      UINT8_C(192), UINT8_C(221), UINT8_C( 53), UINT8_C(103), UINT8_C( 47), UINT8_C( 87), UINT8_C(174), UINT8_C( 43),
+      UINT8_C( 83), UINT8_C(180), UINT8_C(179), UINT8_C(231), UINT8_C(180), UINT8_C( 76), UINT8_C(108), UINT8_C(207),
+      UINT8_C(132), UINT8_C(233), UINT8_C(203), UINT8_C( 74), UINT8_C(180), UINT8_C(214), UINT8_C(106), UINT8_C(137),
+      UINT8_C( 34), UINT8_C(149), UINT8_C(237), UINT8_C(  8), UINT8_C(111), UINT8_C(182), UINT8_C(211), UINT8_C( 47),
+      UINT8_C(147), UINT8_C(  8), UINT8_C(150), UINT8_C(195), UINT8_C( 95), UINT8_C( 69), UINT8_C(238), UINT8_C(178),
+      UINT8_C(249), UINT8_C(161), UINT8_C(153), UINT8_C(173), UINT8_C(237), UINT8_C(  6), UINT8_C(124), UINT8_C(114),
+      UINT8_C(239), UINT8_C( 72), UINT8_C(188), UINT8_C(163), UINT8_C( 30), UINT8_C( 39), UINT8_C( 44), UINT8_C( 64),
+      UINT8_C(188), UINT8_C( 25), UINT8_C( 72), UINT8_C( 43), UINT8_C(207), UINT8_C( 28), UINT8_C( 90), UINT8_C( 98),
+      UINT8_C( 36), UINT8_C(240), UINT8_C( 37), UINT8_C(132), UINT8_C( 53), UINT8_C( 19), UINT8_C( 54), UINT8_C( 47),
+      UINT8_C(180), UINT8_C(208), UINT8_C(220), UINT8_C(162), UINT8_C(214), UINT8_C( 89), UINT8_C( 20), UINT8_C(197),
+      UINT8_C(161), UINT8_C(208), UINT8_C(104), UINT8_C(191), UINT8_C(247), UINT8_C(148),    UINT8_MAX, UINT8_C(179),
+      UINT8_C(173), UINT8_C( 71), UINT8_C(222), UINT8_C(124), UINT8_C( 99), UINT8_C( 56), UINT8_C(222), UINT8_C(136),
+      UINT8_C( 41), UINT8_C(  4), UINT8_C( 12), UINT8_C( 94), UINT8_C( 23), UINT8_C( 66), UINT8_C(141), UINT8_C(204),
+      UINT8_C( 18), UINT8_C(106), UINT8_C(110), UINT8_C(232), UINT8_C(195), UINT8_C(130), UINT8_C(173), UINT8_C(100),
+      UINT8_C( 82), UINT8_C( 21), UINT8_C( 35), UINT8_C( 74), UINT8_C(169), UINT8_C( 34), UINT8_C(253), UINT8_C( 86),
+      UINT8_C(105), UINT8_C(220), UINT8_C(210), UINT8_C(205), UINT8_C( 20), UINT8_C(177), UINT8_C( 85), UINT8_C( 61),
+      UINT8_C(181), UINT8_C( 97), UINT8_C(156), UINT8_C(204), UINT8_C(163), UINT8_C( 41), UINT8_C(152), UINT8_C(182),
+      UINT8_C(147), UINT8_C(  6), UINT8_C(158), UINT8_C( 86), UINT8_C(136), UINT8_C( 76), UINT8_C(186), UINT8_C(219),
+      UINT8_C( 97), UINT8_C(221), UINT8_C( 37), UINT8_C( 11),    UINT8_MAX, UINT8_C( 34), UINT8_C( 97), UINT8_C(105),
+      UINT8_C(254), UINT8_C( 52), UINT8_C( 54), UINT8_C( 19), UINT8_C(229) };
+  static const uint8_t e[] =
+    { UINT8_C(  0), UINT8_C( 45), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 66), UINT8_C( 44), UINT8_C(  0),
+      UINT8_C( 14), UINT8_C(  0), UINT8_C(  0), UINT8_C(114), UINT8_C( 80), UINT8_C(107), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 29), UINT8_C(  0), UINT8_C( 88), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  6),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(147), UINT8_C(109), UINT8_C( 37), UINT8_C(  0),
+      UINT8_C(154), UINT8_C(  0), UINT8_C(  0), UINT8_C(142), UINT8_C(  0), UINT8_C(  0), UINT8_C( 92), UINT8_C( 68),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(137), UINT8_C(  0), UINT8_C( 55), UINT8_C(  0), UINT8_C( 13),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(122), UINT8_C(203), UINT8_C(133), UINT8_C( 14), UINT8_C(  0), UINT8_C(143),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 46), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 34), UINT8_C(116), UINT8_C(  0), UINT8_C( 88), UINT8_C(110), UINT8_C(  0), UINT8_C( 35), UINT8_C( 10),
+      UINT8_C(  0), UINT8_C( 28), UINT8_C(148), UINT8_C(  9), UINT8_C( 67), UINT8_C( 37), UINT8_C( 22), UINT8_C(  7),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(216), UINT8_C( 36), UINT8_C( 16), UINT8_C(103), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(189), UINT8_C(  0), UINT8_C( 95), UINT8_C( 18), UINT8_C(115), UINT8_C( 43), UINT8_C( 52),
+      UINT8_C(  0), UINT8_C(148), UINT8_C( 21), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(181), UINT8_C(130),
+      UINT8_C(  0), UINT8_C( 91), UINT8_C(  0), UINT8_C( 14), UINT8_C(  0), UINT8_C( 18), UINT8_C( 22), UINT8_C(  0),
+      UINT8_C( 42), UINT8_C(  0), UINT8_C(  0), UINT8_C( 12), UINT8_C(  0), UINT8_C(125), UINT8_C(124), UINT8_C(  0),
+      UINT8_C( 58), UINT8_C(  0), UINT8_C( 36), UINT8_C(  0), UINT8_C(  0), UINT8_C( 30), UINT8_C(  0), UINT8_C( 91),
+      UINT8_C( 10), UINT8_C(  0), UINT8_C( 65), UINT8_C( 47), UINT8_C(140), UINT8_C(  8), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 30), UINT8_C(102), UINT8_C(  0), UINT8_C(  0), UINT8_C( 75), UINT8_C(204), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C( 79), UINT8_C(  0), UINT8_C(120), UINT8_C(  0),
+      UINT8_C(118), UINT8_C(  0), UINT8_C(133), UINT8_C(113), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 23),
+      UINT8_C(  0), UINT8_C( 55), UINT8_C( 76), UINT8_C( 77), UINT8_C(  0), UINT8_C( 18), UINT8_C(164), UINT8_C(163),
+      UINT8_C(  0), UINT8_C( 10), UINT8_C( 95), UINT8_C( 25), UINT8_C(134), UINT8_C( 55), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(138), UINT8_C( 90), UINT8_C( 36), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(210), UINT8_C(  0), UINT8_C(  6), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 41), UINT8_C( 20), UINT8_C( 63), UINT8_C(  0), UINT8_C(  2), UINT8_C(  0), UINT8_C(134),
+      UINT8_C(168), UINT8_C(  0), UINT8_C(134), UINT8_C(  0), UINT8_C(190), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 90), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(198), UINT8_C( 25), UINT8_C(  0), UINT8_C( 36),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(114), UINT8_C( 11), UINT8_C(  0), UINT8_C(115), UINT8_C(  0),
+      UINT8_C( 16), UINT8_C(  0), UINT8_C( 26), UINT8_C(  0), UINT8_C(  0), UINT8_C( 45), UINT8_C(  0), UINT8_C( 30),
+      UINT8_C(  0), UINT8_C( 89), UINT8_C( 14), UINT8_C( 86), UINT8_C(  0), UINT8_C(159), UINT8_C(  8), UINT8_C( 18),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 10), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(110), UINT8_C(  0), UINT8_C(  0), UINT8_C(122), UINT8_C(166), UINT8_C( 47), UINT8_C(119), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 43), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 76), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(127), UINT8_C(  0), UINT8_C(  0), UINT8_C( 38), UINT8_C(211), UINT8_C( 59), UINT8_C( 17),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 31), UINT8_C(  0), UINT8_C( 12), UINT8_C(142),
+      UINT8_C(  0), UINT8_C(126), UINT8_C(  0), UINT8_C( 34), UINT8_C(100), UINT8_C(141), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 92), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(233), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 53), UINT8_C(  0), UINT8_C(167), UINT8_C(  8), UINT8_C(102), UINT8_C( 16), UINT8_C(188),
+      UINT8_C(  0), UINT8_C( 48), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(118), UINT8_C(  8), UINT8_C(  0),
+      UINT8_C( 30), UINT8_C( 16), UINT8_C(  0), UINT8_C(203), UINT8_C(  0), UINT8_C( 73), UINT8_C( 74), UINT8_C(  0),
+      UINT8_C(180), UINT8_C(247), UINT8_C( 83), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 12), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 98),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(153), UINT8_C(  0), UINT8_C(  0), UINT8_C(198), UINT8_C(  0), UINT8_C( 37),
+      UINT8_C(  0), UINT8_C( 81), UINT8_C( 34), UINT8_C(145), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 65), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 11), UINT8_C( 36),
+      UINT8_C(133), UINT8_C( 50), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(134), UINT8_C(  0),
+      UINT8_C( 44), UINT8_C( 31), UINT8_C(  0), UINT8_C( 51), UINT8_C(  0), UINT8_C(133), UINT8_C( 89), UINT8_C( 49),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C( 91), UINT8_C( 36), UINT8_C( 61), UINT8_C(184),
+      UINT8_C(101), UINT8_C(109), UINT8_C(116), UINT8_C(125), UINT8_C(  0), UINT8_C(  0), UINT8_C(162), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 27), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 14),
+      UINT8_C(  0), UINT8_C( 10), UINT8_C( 65), UINT8_C(  0), UINT8_C(  0), UINT8_C(154), UINT8_C(  0), UINT8_C(101),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(106), UINT8_C(  0), UINT8_C( 82), UINT8_C(  0), UINT8_C( 71),
+      UINT8_C( 98), UINT8_C( 30), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 79),
+      UINT8_C( 27), UINT8_C(  0), UINT8_C( 73), UINT8_C(  0), UINT8_C(119), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32),
+      UINT8_C(191), UINT8_C( 44), UINT8_C(  0), UINT8_C(100), UINT8_C(200), UINT8_C(  0), UINT8_C(  0), UINT8_C( 47),
+      UINT8_C( 27), UINT8_C(127), UINT8_C(  0), UINT8_C( 87), UINT8_C( 47), UINT8_C( 87), UINT8_C(174), UINT8_C(  0),
+      UINT8_C( 83), UINT8_C(  0), UINT8_C(176), UINT8_C( 89), UINT8_C(  0), UINT8_C( 76), UINT8_C(108), UINT8_C(119),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(180), UINT8_C(  0), UINT8_C( 17), UINT8_C(  0),
+      UINT8_C( 34), UINT8_C(149), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 47),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 67), UINT8_C( 73), UINT8_C(  8), UINT8_C(  0), UINT8_C(  0), UINT8_C(178),
+      UINT8_C(  0), UINT8_C(161), UINT8_C(  0), UINT8_C(  0), UINT8_C( 91), UINT8_C(  6), UINT8_C(  0), UINT8_C( 79),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(186), UINT8_C(123), UINT8_C(  0), UINT8_C( 39), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(153), UINT8_C(  0), UINT8_C( 72), UINT8_C( 43), UINT8_C( 71), UINT8_C( 28), UINT8_C( 85), UINT8_C( 29),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 53), UINT8_C(  0), UINT8_C( 54), UINT8_C( 42),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(162), UINT8_C(119), UINT8_C(  0), UINT8_C( 20), UINT8_C(  0),
+      UINT8_C(161), UINT8_C(184), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(124), UINT8_C( 99), UINT8_C( 56), UINT8_C(  0), UINT8_C(136),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 75), UINT8_C( 23), UINT8_C( 66), UINT8_C(117), UINT8_C(  0),
+      UINT8_C( 18), UINT8_C(106), UINT8_C(110), UINT8_C( 35), UINT8_C(  0), UINT8_C(130), UINT8_C(  0), UINT8_C(100),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 35), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 67), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(203), UINT8_C( 30), UINT8_C( 31), UINT8_C(  0), UINT8_C(  0), UINT8_C( 85), UINT8_C( 31),
+      UINT8_C(129), UINT8_C(  0), UINT8_C(106), UINT8_C(106), UINT8_C( 11), UINT8_C(  0), UINT8_C(152), UINT8_C(182),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(121), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(147), UINT8_C(  0), UINT8_C( 11), UINT8_C(  0), UINT8_C(  0), UINT8_C(  3), UINT8_C(  0),
+      UINT8_C( 78), UINT8_C( 33), UINT8_C(  0), UINT8_C(  0), UINT8_C( 61) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_u8_z(pv, av, bv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+
+    ev = simde_svmin_u8_z(pv, av, bv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(143), UINT8_C( 69), UINT8_C(131), UINT8_C(117), UINT8_C(156), UINT8_C(245), UINT8_C(180), UINT8_C(118),
+      UINT8_C( 92), UINT8_C(193), UINT8_C(242), UINT8_C( 49), UINT8_C(190), UINT8_C( 86), UINT8_C(193), UINT8_C(126),
+      UINT8_C( 67), UINT8_C(209), UINT8_C(247), UINT8_C(110), UINT8_C(218), UINT8_C(106), UINT8_C(102), UINT8_C(186),
+      UINT8_C(  0), UINT8_C( 10), UINT8_C(204), UINT8_C( 12), UINT8_C(186), UINT8_C(215), UINT8_C( 67), UINT8_C( 73),
+      UINT8_C( 28), UINT8_C(198), UINT8_C(191), UINT8_C(184), UINT8_C(187), UINT8_C(115), UINT8_C( 46), UINT8_C( 23),
+      UINT8_C( 52), UINT8_C( 33), UINT8_C( 72), UINT8_C(242), UINT8_C(119), UINT8_C( 10), UINT8_C(112), UINT8_C(186),
+      UINT8_C(219), UINT8_C(103), UINT8_C( 40), UINT8_C(182), UINT8_C(209), UINT8_C(142), UINT8_C(112), UINT8_C(210),
+      UINT8_C(153), UINT8_C( 60), UINT8_C(222), UINT8_C( 83), UINT8_C( 19), UINT8_C( 33), UINT8_C(156), UINT8_C( 47),
+      UINT8_C(232), UINT8_C( 91), UINT8_C(231), UINT8_C(163), UINT8_C(206), UINT8_C( 22), UINT8_C(187), UINT8_C(  2),
+      UINT8_C( 55), UINT8_C(  3), UINT8_C(244), UINT8_C(174), UINT8_C( 13), UINT8_C(101), UINT8_C(104), UINT8_C(233),
+      UINT8_C(204), UINT8_C(145), UINT8_C(159), UINT8_C(158), UINT8_C( 31), UINT8_C( 15), UINT8_C(112), UINT8_C(184),
+      UINT8_C( 76), UINT8_C( 78), UINT8_C( 11), UINT8_C( 95), UINT8_C(111), UINT8_C(168), UINT8_C(143), UINT8_C( 87),
+      UINT8_C(  3), UINT8_C(118), UINT8_C(251), UINT8_C(210), UINT8_C(140), UINT8_C(182), UINT8_C(212), UINT8_C(195),
+      UINT8_C(185), UINT8_C(201), UINT8_C(113), UINT8_C(199), UINT8_C( 46), UINT8_C(218), UINT8_C(176), UINT8_C(250),
+      UINT8_C(107), UINT8_C( 79), UINT8_C(152), UINT8_C(138), UINT8_C( 94), UINT8_C(  8), UINT8_C( 67), UINT8_C(170),
+      UINT8_C( 86), UINT8_C( 78), UINT8_C( 10), UINT8_C(198), UINT8_C(246), UINT8_C(153), UINT8_C( 29), UINT8_C(250),
+      UINT8_C( 15), UINT8_C( 24), UINT8_C(204), UINT8_C(156), UINT8_C(206), UINT8_C(160), UINT8_C( 95), UINT8_C(136),
+      UINT8_C(105), UINT8_C(209), UINT8_C( 79), UINT8_C(151), UINT8_C(171),    UINT8_MAX, UINT8_C(146), UINT8_C( 22),
+      UINT8_C( 78), UINT8_C( 42), UINT8_C(160), UINT8_C(172), UINT8_C( 51), UINT8_C(227), UINT8_C( 87), UINT8_C(137),
+      UINT8_C( 50), UINT8_C( 97), UINT8_C( 79), UINT8_C( 40), UINT8_C(250), UINT8_C(109), UINT8_C( 34), UINT8_C(  9),
+      UINT8_C(133), UINT8_C(238), UINT8_C(165), UINT8_C( 84), UINT8_C(143), UINT8_C(  5), UINT8_C(220), UINT8_C(248),
+      UINT8_C(214), UINT8_C( 43), UINT8_C(144), UINT8_C(129), UINT8_C( 42), UINT8_C( 34), UINT8_C(151), UINT8_C(120),
+      UINT8_C( 76), UINT8_C( 55), UINT8_C( 36), UINT8_C(127), UINT8_C( 27), UINT8_C(123), UINT8_C(  9), UINT8_C( 77),
+      UINT8_C(220), UINT8_C( 88), UINT8_C(117), UINT8_C(214), UINT8_C(197), UINT8_C(152), UINT8_C(224), UINT8_C( 75),
+      UINT8_C(134), UINT8_C(133), UINT8_C(159), UINT8_C( 21), UINT8_C(138), UINT8_C(123), UINT8_C( 14), UINT8_C( 96),
+      UINT8_C(166), UINT8_C(158), UINT8_C(225), UINT8_C(208), UINT8_C(192), UINT8_C(120), UINT8_C( 72), UINT8_C( 12),
+      UINT8_C(176), UINT8_C(108), UINT8_C(140), UINT8_C(203), UINT8_C(232), UINT8_C(149), UINT8_C( 24), UINT8_C(196),
+      UINT8_C(237), UINT8_C(141), UINT8_C(155), UINT8_C(179), UINT8_C( 37), UINT8_C(123), UINT8_C(254), UINT8_C(172),
+      UINT8_C(  0), UINT8_C(157), UINT8_C(193), UINT8_C(139), UINT8_C( 24), UINT8_C(207), UINT8_C(235), UINT8_C(190),
+      UINT8_C(109), UINT8_C(205), UINT8_C(142), UINT8_C( 45), UINT8_C( 69), UINT8_C(214), UINT8_C( 58), UINT8_C(245),
+      UINT8_C( 66), UINT8_C(198), UINT8_C(192), UINT8_C( 42), UINT8_C( 91), UINT8_C(216), UINT8_C(239), UINT8_C( 72),
+      UINT8_C(102), UINT8_C(138), UINT8_C(251), UINT8_C(139), UINT8_C(  5), UINT8_C(249), UINT8_C( 55), UINT8_C(  5),
+      UINT8_C(150), UINT8_C(249), UINT8_C(144), UINT8_C(174), UINT8_C(200), UINT8_C(124), UINT8_C(108), UINT8_C( 54),
+      UINT8_C( 73), UINT8_C(250), UINT8_C( 99), UINT8_C(142), UINT8_C(208), UINT8_C(157), UINT8_C(132), UINT8_C( 19),
+      UINT8_C( 99), UINT8_C( 68), UINT8_C( 61), UINT8_C(190), UINT8_C( 29), UINT8_C( 44), UINT8_C(  7), UINT8_C(131),
+      UINT8_C(182), UINT8_C(  2), UINT8_C( 14), UINT8_C(187), UINT8_C(252), UINT8_C( 70), UINT8_C(193), UINT8_C(146),
+      UINT8_C( 63), UINT8_C( 81), UINT8_C( 65), UINT8_C(  7), UINT8_C(205), UINT8_C(173), UINT8_C( 61), UINT8_C( 22),
+      UINT8_C(168), UINT8_C(161), UINT8_C(165), UINT8_C(120), UINT8_C( 62), UINT8_C( 41), UINT8_C(139), UINT8_C(162),
+      UINT8_C(109), UINT8_C(201), UINT8_C( 96), UINT8_C(138), UINT8_C(245), UINT8_C(103), UINT8_C( 13), UINT8_C(172),
+      UINT8_C(106), UINT8_C( 28), UINT8_C(103), UINT8_C(102), UINT8_C( 98), UINT8_C( 40), UINT8_C(248), UINT8_C(161),
+      UINT8_C(122), UINT8_C( 57), UINT8_C(168), UINT8_C( 71), UINT8_C(231), UINT8_C(230), UINT8_C( 94), UINT8_C(143),
+      UINT8_C(135), UINT8_C(  3), UINT8_C(  7), UINT8_C(197), UINT8_C( 44), UINT8_C(147), UINT8_C(103), UINT8_C(153),
+      UINT8_C( 92), UINT8_C(200), UINT8_C( 36), UINT8_C( 81), UINT8_C( 47), UINT8_C( 49), UINT8_C(253), UINT8_C(153),
+      UINT8_C( 77), UINT8_C(101),    UINT8_MAX, UINT8_C(175), UINT8_C(141), UINT8_C(248), UINT8_C( 80), UINT8_C(  7),
+      UINT8_C( 49), UINT8_C(249), UINT8_C( 79), UINT8_C( 24), UINT8_C(223), UINT8_C(173), UINT8_C(167), UINT8_C(102),
+      UINT8_C(176), UINT8_C(175), UINT8_C( 43), UINT8_C(220), UINT8_C( 66), UINT8_C(147), UINT8_C(117), UINT8_C(158),
+      UINT8_C( 91), UINT8_C(153), UINT8_C(239), UINT8_C(138), UINT8_C(203), UINT8_C(237), UINT8_C( 36), UINT8_C( 24),
+      UINT8_C( 82), UINT8_C( 35), UINT8_C(200), UINT8_C(223), UINT8_C( 27), UINT8_C( 24), UINT8_C(231), UINT8_C( 77),
+      UINT8_C( 17), UINT8_C( 54), UINT8_C(101), UINT8_C(240), UINT8_C(227), UINT8_C( 13), UINT8_C( 86), UINT8_C(147),
+      UINT8_C(188), UINT8_C(130), UINT8_C(111), UINT8_C(254), UINT8_C( 21), UINT8_C(228), UINT8_C(156), UINT8_C(112),
+      UINT8_C(126), UINT8_C(139), UINT8_C(250), UINT8_C( 73), UINT8_C(120), UINT8_C( 30), UINT8_C( 97), UINT8_C(202),
+      UINT8_C( 66), UINT8_C( 41), UINT8_C(170), UINT8_C( 93), UINT8_C( 66), UINT8_C(145), UINT8_C(170), UINT8_C( 83),
+      UINT8_C(199), UINT8_C( 16), UINT8_C( 68), UINT8_C(170), UINT8_C( 29), UINT8_C(154), UINT8_C( 61), UINT8_C(217),
+      UINT8_C( 28), UINT8_C(172), UINT8_C(215), UINT8_C( 49), UINT8_C(144), UINT8_C(115), UINT8_C(161), UINT8_C( 14),
+      UINT8_C(254), UINT8_C(156), UINT8_C( 87), UINT8_C(119), UINT8_C(186), UINT8_C(185), UINT8_C( 65), UINT8_C(252),
+      UINT8_C(226), UINT8_C(235), UINT8_C( 90), UINT8_C( 36), UINT8_C(124), UINT8_C(  4), UINT8_C(120), UINT8_C( 67),
+      UINT8_C( 20), UINT8_C(188), UINT8_C(237), UINT8_C( 49), UINT8_C( 86), UINT8_C( 42), UINT8_C( 10), UINT8_C(115),
+      UINT8_C(214), UINT8_C(225), UINT8_C(164), UINT8_C(103), UINT8_C( 84), UINT8_C( 70), UINT8_C(117), UINT8_C( 83),
+      UINT8_C(226), UINT8_C(205), UINT8_C(202), UINT8_C(156), UINT8_C(134), UINT8_C( 11), UINT8_C(153), UINT8_C(104),
+      UINT8_C(247), UINT8_C(243), UINT8_C(141), UINT8_C(115), UINT8_C(247), UINT8_C(  5), UINT8_C(183), UINT8_C( 12),
+      UINT8_C(193), UINT8_C(164), UINT8_C( 61), UINT8_C( 23), UINT8_C(207), UINT8_C( 72), UINT8_C(138), UINT8_C(165),
+      UINT8_C( 41), UINT8_C( 47), UINT8_C( 12), UINT8_C(126), UINT8_C(117), UINT8_C(130), UINT8_C(209), UINT8_C( 87),
+      UINT8_C( 79), UINT8_C(155), UINT8_C(243), UINT8_C(213), UINT8_C(166), UINT8_C(140), UINT8_C( 61), UINT8_C(157),
+      UINT8_C(127), UINT8_C(202), UINT8_C( 17), UINT8_C(119), UINT8_C(207), UINT8_C(200), UINT8_C(131), UINT8_C(144),
+      UINT8_C(108), UINT8_C(192), UINT8_C(168), UINT8_C( 59), UINT8_C(  8), UINT8_C( 50), UINT8_C(225), UINT8_C( 50),
+      UINT8_C( 97), UINT8_C(237), UINT8_C(176), UINT8_C(214), UINT8_C(111), UINT8_C(129), UINT8_C( 45), UINT8_C(190),
+      UINT8_C( 28), UINT8_C( 33), UINT8_C(147), UINT8_C(194), UINT8_C(173), UINT8_C(209), UINT8_C( 96), UINT8_C( 45),
+      UINT8_C(155), UINT8_C(113), UINT8_C(164), UINT8_C(107), UINT8_C( 57), UINT8_C( 39), UINT8_C(251), UINT8_C(165),
+      UINT8_C(231), UINT8_C(163), UINT8_C(225), UINT8_C(240), UINT8_C(214), UINT8_C(194), UINT8_C( 34), UINT8_C( 55),
+      UINT8_C(175), UINT8_C(210), UINT8_C( 14), UINT8_C( 31), UINT8_C( 83), UINT8_C( 59), UINT8_C(221), UINT8_C(111),
+      UINT8_C( 92), UINT8_C(113), UINT8_C( 49), UINT8_C( 10), UINT8_C( 66), UINT8_C(145), UINT8_C( 55), UINT8_C(221),
+      UINT8_C(  2), UINT8_C(219), UINT8_C( 72), UINT8_C( 59), UINT8_C(  2), UINT8_C( 68), UINT8_C(225), UINT8_C(233),
+      UINT8_C(231), UINT8_C(194), UINT8_C(217), UINT8_C(189), UINT8_C(132), UINT8_C(251), UINT8_C(245), UINT8_C( 51),
+      UINT8_C(205), UINT8_C(  3), UINT8_C( 82), UINT8_C( 32), UINT8_C( 62), UINT8_C( 48), UINT8_C(143), UINT8_C(155),
+      UINT8_C(161), UINT8_C(193), UINT8_C(165), UINT8_C(227), UINT8_C( 82), UINT8_C(220), UINT8_C(192), UINT8_C( 85),
+      UINT8_C(183), UINT8_C(  9), UINT8_C(144), UINT8_C(185), UINT8_C( 77), UINT8_C(113), UINT8_C(162), UINT8_C( 52),
+      UINT8_C( 51), UINT8_C(124), UINT8_C(242), UINT8_C(183), UINT8_C(119), UINT8_C(231), UINT8_C(235), UINT8_C( 69),
+      UINT8_C(234), UINT8_C( 61), UINT8_C(101), UINT8_C( 40), UINT8_C(109), UINT8_C(245), UINT8_C(195), UINT8_C( 14),
+      UINT8_C(182), UINT8_C(104), UINT8_C(241), UINT8_C(  8), UINT8_C( 68), UINT8_C(178), UINT8_C( 93), UINT8_C(251),
+      UINT8_C(187), UINT8_C(238), UINT8_C(180), UINT8_C(  8), UINT8_C( 95), UINT8_C( 87), UINT8_C( 60), UINT8_C(147),
+      UINT8_C(211), UINT8_C( 46), UINT8_C( 74), UINT8_C( 74), UINT8_C( 21), UINT8_C( 53), UINT8_C(143),    UINT8_MAX,
+      UINT8_C(115), UINT8_C(245), UINT8_C( 40), UINT8_C(224), UINT8_C(234), UINT8_C(235), UINT8_C(239), UINT8_C(160),
+      UINT8_C( 84), UINT8_C(224), UINT8_C(168), UINT8_C(152), UINT8_C(146), UINT8_C(  6), UINT8_C(148), UINT8_C( 77),
+      UINT8_C(244), UINT8_C( 72), UINT8_C( 85), UINT8_C( 83), UINT8_C(159), UINT8_C(146), UINT8_C(230), UINT8_C(114),
+      UINT8_C(192), UINT8_C( 49), UINT8_C(189), UINT8_C(214), UINT8_C(102), UINT8_C( 76), UINT8_C(213), UINT8_C(217),
+      UINT8_C( 65), UINT8_C(253), UINT8_C(186), UINT8_C( 43), UINT8_C(233), UINT8_C(169), UINT8_C(203), UINT8_C( 61),
+      UINT8_C(137), UINT8_C(116), UINT8_C(213), UINT8_C( 28), UINT8_C(122), UINT8_C(105), UINT8_C(105), UINT8_C(110),
+      UINT8_C(178), UINT8_C(191), UINT8_C(193), UINT8_C( 81), UINT8_C( 81), UINT8_C(168), UINT8_C(196), UINT8_C( 17),
+      UINT8_C(217), UINT8_C(129), UINT8_C(231), UINT8_C( 63), UINT8_C(205), UINT8_C(189), UINT8_C( 25), UINT8_C( 15),
+      UINT8_C(186), UINT8_C(211), UINT8_C( 58), UINT8_C(163), UINT8_C(124), UINT8_C(  6), UINT8_C(224), UINT8_C(  5),
+      UINT8_C(122), UINT8_C(182), UINT8_C( 33), UINT8_C(244), UINT8_C( 31), UINT8_C(139), UINT8_C( 98), UINT8_C(209),
+      UINT8_C( 74), UINT8_C( 35), UINT8_C( 35), UINT8_C(155), UINT8_C(203), UINT8_C(231), UINT8_C(172), UINT8_C(164),
+      UINT8_C(104), UINT8_C(148), UINT8_C(228), UINT8_C( 53), UINT8_C( 81), UINT8_C(253), UINT8_C( 68), UINT8_C( 11),
+      UINT8_C(208), UINT8_C(127), UINT8_C(175), UINT8_C( 76), UINT8_C(133), UINT8_C(143), UINT8_C( 81),    UINT8_MAX,
+      UINT8_C( 69), UINT8_C(115), UINT8_C(243), UINT8_C(101), UINT8_C(254), UINT8_C( 85), UINT8_C( 54), UINT8_C( 72),
+      UINT8_C(120), UINT8_C( 89), UINT8_C(227), UINT8_C( 68), UINT8_C( 64), UINT8_C(143), UINT8_C(232), UINT8_C(168),
+      UINT8_C( 35), UINT8_C(204), UINT8_C(222), UINT8_C(116), UINT8_C(201), UINT8_C( 34), UINT8_C(128), UINT8_C(153),
+      UINT8_C(161), UINT8_C( 47), UINT8_C(229), UINT8_C( 38), UINT8_C(190), UINT8_C( 55), UINT8_C( 37), UINT8_C(  4),
+      UINT8_C(170), UINT8_C( 24), UINT8_C(105), UINT8_C(168), UINT8_C(109), UINT8_C(159), UINT8_C(240), UINT8_C(230),
+      UINT8_C(249), UINT8_C(211), UINT8_C( 42), UINT8_C( 57), UINT8_C( 98), UINT8_C( 18), UINT8_C(226), UINT8_C(134),
+      UINT8_C(223), UINT8_C(192), UINT8_C(250), UINT8_C(168), UINT8_C(226), UINT8_C(122), UINT8_C( 66), UINT8_C(132),
+      UINT8_C(169), UINT8_C( 39), UINT8_C(170), UINT8_C(104), UINT8_C( 94), UINT8_C(208), UINT8_C(108), UINT8_C(  8),
+      UINT8_C(232), UINT8_C(213), UINT8_C(176), UINT8_C( 86), UINT8_C(116), UINT8_C(160), UINT8_C( 60), UINT8_C(109),
+      UINT8_C(115), UINT8_C(102), UINT8_C(167), UINT8_C(214), UINT8_C(120), UINT8_C(137), UINT8_C( 92), UINT8_C( 87),
+      UINT8_C( 73), UINT8_C( 86), UINT8_C(  0), UINT8_C( 43), UINT8_C(209), UINT8_C( 66), UINT8_C(175), UINT8_C(122),
+      UINT8_C(105), UINT8_C( 90), UINT8_C(226), UINT8_C(200), UINT8_C( 42), UINT8_C( 78), UINT8_C(208), UINT8_C( 18),
+      UINT8_C( 35), UINT8_C(129), UINT8_C(104), UINT8_C(152), UINT8_C( 33), UINT8_C(164), UINT8_C(  5), UINT8_C(149),
+      UINT8_C( 10), UINT8_C(172), UINT8_C(107), UINT8_C(131), UINT8_C( 53), UINT8_C(199), UINT8_C(218), UINT8_C(126),
+      UINT8_C( 29), UINT8_C(218), UINT8_C(170), UINT8_C(238), UINT8_C( 28), UINT8_C( 89), UINT8_C(105), UINT8_C(134) };
+  static const uint8_t b[] =
+    { UINT8_C(134), UINT8_C(217), UINT8_C(124), UINT8_C( 26), UINT8_C(186), UINT8_C( 57), UINT8_C(203), UINT8_C( 85),
+      UINT8_C(173), UINT8_C( 16), UINT8_C(251), UINT8_C( 78), UINT8_C(250), UINT8_C(239), UINT8_C( 67), UINT8_C( 46),
+      UINT8_C(200), UINT8_C(181), UINT8_C(239), UINT8_C(115), UINT8_C(149), UINT8_C(166), UINT8_C(115), UINT8_C( 33),
+      UINT8_C( 74), UINT8_C(154), UINT8_C(140), UINT8_C(157), UINT8_C(113), UINT8_C(143), UINT8_C(139), UINT8_C(247),
+      UINT8_C(104), UINT8_C(  7), UINT8_C( 17), UINT8_C( 34), UINT8_C( 64), UINT8_C(220), UINT8_C(120), UINT8_C(237),
+      UINT8_C(237), UINT8_C(115), UINT8_C( 59), UINT8_C(231), UINT8_C( 98), UINT8_C(126), UINT8_C( 22), UINT8_C( 43),
+      UINT8_C( 51), UINT8_C(  5), UINT8_C(158), UINT8_C(200), UINT8_C(171), UINT8_C( 17), UINT8_C(234), UINT8_C(245),
+      UINT8_C(171), UINT8_C(118), UINT8_C(146), UINT8_C( 29), UINT8_C(  6), UINT8_C( 29), UINT8_C( 20), UINT8_C(110),
+      UINT8_C( 36), UINT8_C( 38), UINT8_C(145), UINT8_C(100), UINT8_C(  2), UINT8_C(  9), UINT8_C( 81), UINT8_C(239),
+      UINT8_C(124), UINT8_C(141), UINT8_C(215), UINT8_C(222), UINT8_C( 11), UINT8_C(237), UINT8_C(  9), UINT8_C( 63),
+      UINT8_C(242), UINT8_C(168), UINT8_C(  7), UINT8_C(157), UINT8_C(185), UINT8_C(241), UINT8_C(146), UINT8_C(101),
+      UINT8_C(104), UINT8_C( 36), UINT8_C(130), UINT8_C(110), UINT8_C( 66), UINT8_C(150), UINT8_C(220), UINT8_C(102),
+      UINT8_C(188), UINT8_C(109), UINT8_C(203), UINT8_C(191), UINT8_C(118), UINT8_C( 28), UINT8_C(174), UINT8_C(242),
+      UINT8_C(169), UINT8_C(133), UINT8_C(209), UINT8_C(181), UINT8_C(114), UINT8_C(218), UINT8_C(244), UINT8_C(100),
+      UINT8_C(130), UINT8_C(251), UINT8_C(  1), UINT8_C( 60), UINT8_C(237), UINT8_C(147), UINT8_C(161), UINT8_C( 85),
+      UINT8_C(184), UINT8_C( 35), UINT8_C(195), UINT8_C(250), UINT8_C(185), UINT8_C(159), UINT8_C( 96), UINT8_C(118),
+      UINT8_C( 13), UINT8_C( 43), UINT8_C( 53), UINT8_C(131), UINT8_C( 72), UINT8_C(227), UINT8_C(118), UINT8_C(241),
+      UINT8_C(105), UINT8_C( 71), UINT8_C(166), UINT8_C(219), UINT8_C( 33), UINT8_C(154), UINT8_C( 64), UINT8_C(164),
+      UINT8_C(150), UINT8_C( 65), UINT8_C(224), UINT8_C(131), UINT8_C(213), UINT8_C(129), UINT8_C(216), UINT8_C(141),
+      UINT8_C(164), UINT8_C(155), UINT8_C(135), UINT8_C( 93), UINT8_C( 58), UINT8_C(231), UINT8_C(211), UINT8_C( 71),
+      UINT8_C( 19), UINT8_C(  8), UINT8_C(203), UINT8_C( 91), UINT8_C(236), UINT8_C( 65), UINT8_C( 76), UINT8_C( 85),
+      UINT8_C(136), UINT8_C(243), UINT8_C( 48), UINT8_C(169), UINT8_C(141), UINT8_C(112), UINT8_C( 77), UINT8_C( 35),
+      UINT8_C(178), UINT8_C( 45), UINT8_C(166), UINT8_C(135), UINT8_C(174), UINT8_C(126), UINT8_C( 20), UINT8_C( 82),
+      UINT8_C( 25), UINT8_C(155), UINT8_C(176), UINT8_C( 84), UINT8_C(130), UINT8_C(131), UINT8_C(155), UINT8_C(149),
+      UINT8_C(140), UINT8_C(102), UINT8_C(240), UINT8_C(120), UINT8_C(167), UINT8_C( 61), UINT8_C(205), UINT8_C( 47),
+      UINT8_C( 48), UINT8_C(253), UINT8_C(217), UINT8_C(189), UINT8_C(110), UINT8_C( 38), UINT8_C(225), UINT8_C( 32),
+      UINT8_C( 84), UINT8_C(135), UINT8_C(167), UINT8_C(  2), UINT8_C(  6), UINT8_C(187), UINT8_C( 85), UINT8_C( 31),
+      UINT8_C( 86), UINT8_C(  5), UINT8_C(115), UINT8_C(216), UINT8_C(136), UINT8_C( 15), UINT8_C(110), UINT8_C( 20),
+      UINT8_C(117), UINT8_C( 94), UINT8_C(140), UINT8_C( 29), UINT8_C(155), UINT8_C( 89), UINT8_C( 76), UINT8_C(203),
+      UINT8_C( 87), UINT8_C( 37), UINT8_C(137), UINT8_C(197), UINT8_C( 76), UINT8_C(106), UINT8_C(229), UINT8_C(160),
+      UINT8_C(241), UINT8_C(140), UINT8_C(162), UINT8_C(247), UINT8_C( 71), UINT8_C(247), UINT8_C( 23), UINT8_C(157),
+      UINT8_C(252), UINT8_C(138), UINT8_C(117), UINT8_C(133), UINT8_C(153), UINT8_C(227), UINT8_C(153), UINT8_C( 15),
+      UINT8_C( 66), UINT8_C( 38), UINT8_C( 44), UINT8_C(221), UINT8_C(127), UINT8_C(120), UINT8_C(169), UINT8_C(214),
+      UINT8_C(158), UINT8_C( 50), UINT8_C(155), UINT8_C(234), UINT8_C(156), UINT8_C(128), UINT8_C(138), UINT8_C(141),
+      UINT8_C( 12), UINT8_C( 44), UINT8_C(133), UINT8_C( 83), UINT8_C( 36), UINT8_C(156), UINT8_C(240), UINT8_C( 32),
+      UINT8_C( 38), UINT8_C(102), UINT8_C(165), UINT8_C(192), UINT8_C( 73), UINT8_C( 63), UINT8_C(207), UINT8_C(139),
+      UINT8_C(101), UINT8_C(251), UINT8_C(105), UINT8_C(228), UINT8_C(115), UINT8_C( 18), UINT8_C(187), UINT8_C( 17),
+      UINT8_C( 68), UINT8_C( 86), UINT8_C(251), UINT8_C(224), UINT8_C(215), UINT8_C(133), UINT8_C(109), UINT8_C(227),
+      UINT8_C(178), UINT8_C(242), UINT8_C( 55), UINT8_C(214), UINT8_C(142), UINT8_C( 39), UINT8_C(246), UINT8_C(181),
+      UINT8_C(141), UINT8_C(156), UINT8_C(117), UINT8_C(215), UINT8_C(219), UINT8_C( 68), UINT8_C( 98), UINT8_C( 64),
+      UINT8_C( 63), UINT8_C(203), UINT8_C( 36), UINT8_C(178), UINT8_C(221), UINT8_C(223), UINT8_C(196), UINT8_C( 33),
+      UINT8_C( 54), UINT8_C(191), UINT8_C(  1), UINT8_C( 13), UINT8_C( 69), UINT8_C(111), UINT8_C(240), UINT8_C(247),
+      UINT8_C( 97), UINT8_C( 39), UINT8_C(205), UINT8_C(240), UINT8_C( 79), UINT8_C(195), UINT8_C(165), UINT8_C(220),
+      UINT8_C( 95), UINT8_C( 26), UINT8_C(179), UINT8_C( 58), UINT8_C( 94), UINT8_C( 22), UINT8_C(122), UINT8_C(157),
+      UINT8_C(225), UINT8_C(159), UINT8_C( 79), UINT8_C(191), UINT8_C(126), UINT8_C( 19), UINT8_C(224), UINT8_C(180),
+      UINT8_C(211), UINT8_C(226), UINT8_C(193), UINT8_C( 24), UINT8_C( 81), UINT8_C(178), UINT8_C( 15), UINT8_C(178),
+      UINT8_C(217), UINT8_C(220), UINT8_C(162), UINT8_C( 40), UINT8_C(159), UINT8_C( 71), UINT8_C(  5),    UINT8_MAX,
+      UINT8_C( 97), UINT8_C(184), UINT8_C( 57), UINT8_C(191), UINT8_C(206), UINT8_C(180), UINT8_C( 92), UINT8_C(176),
+      UINT8_C( 83), UINT8_C(172), UINT8_C(111), UINT8_C(209), UINT8_C(191), UINT8_C( 79), UINT8_C(134), UINT8_C(146),
+      UINT8_C( 49), UINT8_C( 71), UINT8_C(170), UINT8_C(130), UINT8_C(249), UINT8_C(185), UINT8_C( 53), UINT8_C(211),
+      UINT8_C(149), UINT8_C(215), UINT8_C(251), UINT8_C( 53), UINT8_C( 31), UINT8_C(  0), UINT8_C( 52), UINT8_C(128),
+      UINT8_C(185), UINT8_C(109), UINT8_C( 64), UINT8_C(135), UINT8_C( 33), UINT8_C(156), UINT8_C( 55), UINT8_C(116),
+      UINT8_C( 72), UINT8_C(166), UINT8_C( 70), UINT8_C(  8), UINT8_C(246), UINT8_C(204), UINT8_C(154), UINT8_C( 39),
+      UINT8_C( 19), UINT8_C( 69), UINT8_C(170), UINT8_C( 13), UINT8_C(254), UINT8_C(223), UINT8_C(224), UINT8_C(148),
+      UINT8_C(182), UINT8_C(219), UINT8_C(201), UINT8_C(213), UINT8_C(220), UINT8_C(253), UINT8_C( 86), UINT8_C(149),
+      UINT8_C(106), UINT8_C(150), UINT8_C( 28), UINT8_C(140), UINT8_C( 50), UINT8_C( 84), UINT8_C(  0), UINT8_C(123),
+      UINT8_C(250), UINT8_C( 70), UINT8_C(131), UINT8_C(240), UINT8_C( 18), UINT8_C( 29), UINT8_C( 24), UINT8_C( 38),
+      UINT8_C( 98), UINT8_C(194), UINT8_C( 51), UINT8_C( 97), UINT8_C(161), UINT8_C( 19), UINT8_C(245), UINT8_C( 87),
+      UINT8_C(238), UINT8_C(190), UINT8_C( 45), UINT8_C(202), UINT8_C(187), UINT8_C(131), UINT8_C( 95), UINT8_C( 37),
+      UINT8_C( 25), UINT8_C(124), UINT8_C(177), UINT8_C( 75), UINT8_C(208), UINT8_C(178), UINT8_C(198), UINT8_C(202),
+      UINT8_C(248), UINT8_C( 73), UINT8_C(187), UINT8_C( 11), UINT8_C(103), UINT8_C(211), UINT8_C( 49), UINT8_C(201),
+      UINT8_C(149), UINT8_C(100), UINT8_C( 42), UINT8_C( 54), UINT8_C(119), UINT8_C( 31), UINT8_C(141), UINT8_C(101),
+      UINT8_C(221), UINT8_C(186), UINT8_C( 48), UINT8_C(152), UINT8_C( 61), UINT8_C(143), UINT8_C(190), UINT8_C( 86),
+      UINT8_C( 11), UINT8_C(111), UINT8_C(162), UINT8_C(219), UINT8_C( 33), UINT8_C(104), UINT8_C(166), UINT8_C( 26),
+      UINT8_C(178), UINT8_C( 97), UINT8_C( 37), UINT8_C( 25), UINT8_C( 52), UINT8_C( 86), UINT8_C(226), UINT8_C(201),
+      UINT8_C(186), UINT8_C( 13),    UINT8_MAX, UINT8_C( 49), UINT8_C( 44), UINT8_C(140), UINT8_C(150), UINT8_C( 10),
+      UINT8_C( 71), UINT8_C(198), UINT8_C(162), UINT8_C(132), UINT8_C( 86), UINT8_C( 96), UINT8_C(219), UINT8_C( 97),
+      UINT8_C(208), UINT8_C(125), UINT8_C( 61), UINT8_C(241), UINT8_C(229), UINT8_C(227), UINT8_C( 11), UINT8_C(151),
+      UINT8_C( 68), UINT8_C( 48), UINT8_C(176), UINT8_C(120), UINT8_C(134), UINT8_C(147), UINT8_C( 65), UINT8_C( 64),
+      UINT8_C(160), UINT8_C( 64), UINT8_C(113), UINT8_C(204), UINT8_C(204), UINT8_C(  8), UINT8_C(214), UINT8_C( 19),
+      UINT8_C(206), UINT8_C(121), UINT8_C(152), UINT8_C( 36), UINT8_C(217), UINT8_C(115), UINT8_C(134), UINT8_C(169),
+      UINT8_C(240), UINT8_C(195), UINT8_C(155), UINT8_C(213), UINT8_C(166), UINT8_C(166), UINT8_C(109), UINT8_C(234),
+      UINT8_C(215), UINT8_C( 29), UINT8_C( 98), UINT8_C( 93), UINT8_C(176), UINT8_C(163), UINT8_C(158), UINT8_C( 80),
+      UINT8_C(227), UINT8_C( 15), UINT8_C( 29), UINT8_C(175), UINT8_C( 23), UINT8_C(243), UINT8_C(195), UINT8_C(230),
+      UINT8_C(108), UINT8_C( 91), UINT8_C( 10), UINT8_C( 70), UINT8_C(206), UINT8_C(144), UINT8_C(239), UINT8_C(190),
+      UINT8_C( 83), UINT8_C(138), UINT8_C(147), UINT8_C(249), UINT8_C( 49), UINT8_C(  0), UINT8_C(227), UINT8_C(  8),
+      UINT8_C( 30), UINT8_C( 69), UINT8_C(101), UINT8_C(206), UINT8_C(232), UINT8_C(  3), UINT8_C( 31), UINT8_C(203),
+      UINT8_C( 19), UINT8_C( 60), UINT8_C(123), UINT8_C( 42), UINT8_C( 47), UINT8_C( 62), UINT8_C( 16), UINT8_C(156),
+      UINT8_C(153), UINT8_C( 27), UINT8_C(226), UINT8_C(103), UINT8_C(171), UINT8_C(209), UINT8_C( 37),    UINT8_MAX,
+      UINT8_C( 92), UINT8_C(184), UINT8_C(248), UINT8_C(141), UINT8_C(185), UINT8_C(220), UINT8_C(149), UINT8_C(215),
+      UINT8_C( 33), UINT8_C(250), UINT8_C(165), UINT8_C( 10), UINT8_C(254), UINT8_C(196), UINT8_C(213), UINT8_C( 17),
+      UINT8_C(  0), UINT8_C( 80), UINT8_C( 59), UINT8_C( 48), UINT8_C(142), UINT8_C( 76), UINT8_C(204), UINT8_C( 39),
+      UINT8_C(103), UINT8_C(174), UINT8_C(142), UINT8_C( 18), UINT8_C(127), UINT8_C(179), UINT8_C( 17), UINT8_C(219),
+      UINT8_C(108), UINT8_C( 10), UINT8_C(104), UINT8_C( 37), UINT8_C(230), UINT8_C(253), UINT8_C(252), UINT8_C(  7),
+      UINT8_C(248), UINT8_C(161), UINT8_C( 17), UINT8_C(246), UINT8_C(102), UINT8_C(231), UINT8_C(  7), UINT8_C(102),
+      UINT8_C( 55), UINT8_C( 66), UINT8_C(150), UINT8_C(198), UINT8_C(142), UINT8_C( 98), UINT8_C(237), UINT8_C(245),
+      UINT8_C( 16), UINT8_C(124), UINT8_C(  8), UINT8_C(144), UINT8_C( 47), UINT8_C( 25), UINT8_C(107), UINT8_C(155),
+      UINT8_C( 35), UINT8_C(212), UINT8_C(192), UINT8_C(  9), UINT8_C(209), UINT8_C(188), UINT8_C( 17), UINT8_C(201),
+      UINT8_C( 94), UINT8_C( 34), UINT8_C(191), UINT8_C(196), UINT8_C(  9), UINT8_C(198), UINT8_C( 42), UINT8_C( 65),
+      UINT8_C(  9), UINT8_C(193), UINT8_C(  7), UINT8_C(151), UINT8_C( 35), UINT8_C(244), UINT8_C(141), UINT8_C( 52),
+      UINT8_C(112), UINT8_C(149), UINT8_C(196), UINT8_C(160), UINT8_C(174), UINT8_C( 47), UINT8_C( 59), UINT8_C(210),
+      UINT8_C(  3), UINT8_C(252), UINT8_C(219), UINT8_C(213), UINT8_C(184), UINT8_C(236), UINT8_C(158), UINT8_C( 22),
+      UINT8_C( 15), UINT8_C( 94), UINT8_C(218), UINT8_C( 24), UINT8_C( 36), UINT8_C(  5), UINT8_C( 89), UINT8_C( 45),
+      UINT8_C(198), UINT8_C( 96), UINT8_C(197), UINT8_C(233), UINT8_C( 85), UINT8_C( 82), UINT8_C( 29), UINT8_C(197),
+      UINT8_C(231), UINT8_C(225), UINT8_C(101), UINT8_C(149), UINT8_C( 17), UINT8_C(161), UINT8_C(103), UINT8_C( 20),
+      UINT8_C(157), UINT8_C( 67), UINT8_C(233), UINT8_C( 85), UINT8_C( 47), UINT8_C(136), UINT8_C(108), UINT8_C( 62),
+      UINT8_C(230), UINT8_C( 70), UINT8_C( 87), UINT8_C( 10), UINT8_C( 75), UINT8_C(176), UINT8_C( 56), UINT8_C( 17),
+      UINT8_C( 17), UINT8_C(253), UINT8_C(251), UINT8_C(102), UINT8_C( 79), UINT8_C( 24), UINT8_C( 43), UINT8_C( 54),
+      UINT8_C(250), UINT8_C(145), UINT8_C(203), UINT8_C( 11), UINT8_C( 50), UINT8_C( 51), UINT8_C( 31), UINT8_C(207),
+      UINT8_C(118), UINT8_C(  9), UINT8_C( 36), UINT8_C(165), UINT8_C(145), UINT8_C(144), UINT8_C(228), UINT8_C(119),
+      UINT8_C(215), UINT8_C( 59), UINT8_C(129), UINT8_C( 34), UINT8_C(235), UINT8_C(185), UINT8_C( 52), UINT8_C(252),
+      UINT8_C(182), UINT8_C( 47), UINT8_C( 98), UINT8_C(  5), UINT8_C( 71), UINT8_C(142), UINT8_C( 59), UINT8_C( 65),
+      UINT8_C( 31), UINT8_C(  7), UINT8_C( 76), UINT8_C( 81), UINT8_C( 58), UINT8_C(108), UINT8_C( 32), UINT8_C(176),
+      UINT8_C(117), UINT8_C( 68), UINT8_C( 85), UINT8_C(  6), UINT8_C(213), UINT8_C( 57), UINT8_C(125), UINT8_C(172),
+      UINT8_C(116), UINT8_C(254), UINT8_C(206), UINT8_C( 96), UINT8_C(184), UINT8_C(  2), UINT8_C( 92), UINT8_C(110),
+      UINT8_C( 49), UINT8_C(191), UINT8_C(116), UINT8_C(121), UINT8_C( 77), UINT8_C(175), UINT8_C(186), UINT8_C(108),
+      UINT8_C(182), UINT8_C(  7), UINT8_C(189), UINT8_C(240), UINT8_C(115), UINT8_C(221), UINT8_C(160), UINT8_C(232),
+      UINT8_C( 33), UINT8_C(246), UINT8_C(238), UINT8_C(246), UINT8_C( 47), UINT8_C(107), UINT8_C(162), UINT8_C(164),
+      UINT8_C(105), UINT8_C(113), UINT8_C(  4), UINT8_C( 33), UINT8_C(115), UINT8_C( 96), UINT8_C(144), UINT8_C(165) };
+  static const uint8_t e[] =
+    { UINT8_C(143), UINT8_C( 69), UINT8_C(124), UINT8_C(117), UINT8_C(156), UINT8_C( 57), UINT8_C(180), UINT8_C(118),
+      UINT8_C( 92), UINT8_C( 16), UINT8_C(242), UINT8_C( 49), UINT8_C(190), UINT8_C( 86), UINT8_C(193), UINT8_C(126),
+      UINT8_C( 67), UINT8_C(209), UINT8_C(239), UINT8_C(110), UINT8_C(218), UINT8_C(106), UINT8_C(102), UINT8_C( 33),
+      UINT8_C(  0), UINT8_C( 10), UINT8_C(204), UINT8_C( 12), UINT8_C(186), UINT8_C(143), UINT8_C( 67), UINT8_C( 73),
+      UINT8_C( 28), UINT8_C(198), UINT8_C( 17), UINT8_C( 34), UINT8_C(187), UINT8_C(115), UINT8_C( 46), UINT8_C( 23),
+      UINT8_C( 52), UINT8_C( 33), UINT8_C( 59), UINT8_C(242), UINT8_C(119), UINT8_C( 10), UINT8_C( 22), UINT8_C(186),
+      UINT8_C(219), UINT8_C(103), UINT8_C( 40), UINT8_C(182), UINT8_C(209), UINT8_C(142), UINT8_C(112), UINT8_C(210),
+      UINT8_C(153), UINT8_C( 60), UINT8_C(146), UINT8_C( 29), UINT8_C(  6), UINT8_C( 33), UINT8_C( 20), UINT8_C( 47),
+      UINT8_C(232), UINT8_C( 38), UINT8_C(231), UINT8_C(163), UINT8_C(  2), UINT8_C( 22), UINT8_C(187), UINT8_C(  2),
+      UINT8_C( 55), UINT8_C(  3), UINT8_C(244), UINT8_C(174), UINT8_C( 13), UINT8_C(101), UINT8_C(  9), UINT8_C( 63),
+      UINT8_C(204), UINT8_C(145), UINT8_C(  7), UINT8_C(158), UINT8_C( 31), UINT8_C( 15), UINT8_C(112), UINT8_C(184),
+      UINT8_C( 76), UINT8_C( 36), UINT8_C( 11), UINT8_C( 95), UINT8_C( 66), UINT8_C(150), UINT8_C(143), UINT8_C( 87),
+      UINT8_C(  3), UINT8_C(118), UINT8_C(251), UINT8_C(210), UINT8_C(140), UINT8_C(182), UINT8_C(174), UINT8_C(195),
+      UINT8_C(185), UINT8_C(201), UINT8_C(113), UINT8_C(181), UINT8_C( 46), UINT8_C(218), UINT8_C(176), UINT8_C(250),
+      UINT8_C(107), UINT8_C( 79), UINT8_C(152), UINT8_C( 60), UINT8_C( 94), UINT8_C(  8), UINT8_C( 67), UINT8_C( 85),
+      UINT8_C( 86), UINT8_C( 35), UINT8_C( 10), UINT8_C(198), UINT8_C(185), UINT8_C(153), UINT8_C( 29), UINT8_C(250),
+      UINT8_C( 15), UINT8_C( 24), UINT8_C(204), UINT8_C(156), UINT8_C( 72), UINT8_C(160), UINT8_C( 95), UINT8_C(136),
+      UINT8_C(105), UINT8_C( 71), UINT8_C( 79), UINT8_C(151), UINT8_C( 33),    UINT8_MAX, UINT8_C(146), UINT8_C( 22),
+      UINT8_C( 78), UINT8_C( 42), UINT8_C(160), UINT8_C(172), UINT8_C( 51), UINT8_C(129), UINT8_C( 87), UINT8_C(137),
+      UINT8_C( 50), UINT8_C( 97), UINT8_C( 79), UINT8_C( 40), UINT8_C(250), UINT8_C(109), UINT8_C( 34), UINT8_C(  9),
+      UINT8_C(133), UINT8_C(238), UINT8_C(165), UINT8_C( 84), UINT8_C(143), UINT8_C(  5), UINT8_C(220), UINT8_C(248),
+      UINT8_C(136), UINT8_C( 43), UINT8_C(144), UINT8_C(129), UINT8_C( 42), UINT8_C( 34), UINT8_C(151), UINT8_C(120),
+      UINT8_C( 76), UINT8_C( 45), UINT8_C( 36), UINT8_C(127), UINT8_C( 27), UINT8_C(123), UINT8_C(  9), UINT8_C( 77),
+      UINT8_C( 25), UINT8_C( 88), UINT8_C(117), UINT8_C( 84), UINT8_C(130), UINT8_C(152), UINT8_C(224), UINT8_C( 75),
+      UINT8_C(134), UINT8_C(102), UINT8_C(159), UINT8_C( 21), UINT8_C(138), UINT8_C(123), UINT8_C( 14), UINT8_C( 96),
+      UINT8_C( 48), UINT8_C(158), UINT8_C(225), UINT8_C(189), UINT8_C(110), UINT8_C(120), UINT8_C( 72), UINT8_C( 12),
+      UINT8_C( 84), UINT8_C(108), UINT8_C(140), UINT8_C(  2), UINT8_C(232), UINT8_C(149), UINT8_C( 24), UINT8_C(196),
+      UINT8_C(237), UINT8_C(141), UINT8_C(155), UINT8_C(179), UINT8_C( 37), UINT8_C(123), UINT8_C(254), UINT8_C( 20),
+      UINT8_C(  0), UINT8_C(157), UINT8_C(193), UINT8_C(139), UINT8_C( 24), UINT8_C(207), UINT8_C( 76), UINT8_C(190),
+      UINT8_C( 87), UINT8_C(205), UINT8_C(142), UINT8_C( 45), UINT8_C( 69), UINT8_C(214), UINT8_C( 58), UINT8_C(245),
+      UINT8_C( 66), UINT8_C(140), UINT8_C(192), UINT8_C( 42), UINT8_C( 91), UINT8_C(216), UINT8_C( 23), UINT8_C( 72),
+      UINT8_C(102), UINT8_C(138), UINT8_C(251), UINT8_C(139), UINT8_C(  5), UINT8_C(227), UINT8_C( 55), UINT8_C(  5),
+      UINT8_C( 66), UINT8_C( 38), UINT8_C( 44), UINT8_C(174), UINT8_C(200), UINT8_C(120), UINT8_C(108), UINT8_C( 54),
+      UINT8_C( 73), UINT8_C( 50), UINT8_C( 99), UINT8_C(142), UINT8_C(208), UINT8_C(157), UINT8_C(132), UINT8_C( 19),
+      UINT8_C( 99), UINT8_C( 44), UINT8_C( 61), UINT8_C(190), UINT8_C( 29), UINT8_C( 44), UINT8_C(  7), UINT8_C(131),
+      UINT8_C( 38), UINT8_C(  2), UINT8_C( 14), UINT8_C(187), UINT8_C( 73), UINT8_C( 63), UINT8_C(193), UINT8_C(139),
+      UINT8_C( 63), UINT8_C( 81), UINT8_C( 65), UINT8_C(  7), UINT8_C(115), UINT8_C( 18), UINT8_C( 61), UINT8_C( 22),
+      UINT8_C( 68), UINT8_C( 86), UINT8_C(165), UINT8_C(120), UINT8_C( 62), UINT8_C( 41), UINT8_C(139), UINT8_C(162),
+      UINT8_C(109), UINT8_C(201), UINT8_C( 96), UINT8_C(138), UINT8_C(245), UINT8_C(103), UINT8_C( 13), UINT8_C(172),
+      UINT8_C(106), UINT8_C( 28), UINT8_C(103), UINT8_C(102), UINT8_C( 98), UINT8_C( 40), UINT8_C( 98), UINT8_C( 64),
+      UINT8_C( 63), UINT8_C( 57), UINT8_C( 36), UINT8_C( 71), UINT8_C(221), UINT8_C(223), UINT8_C( 94), UINT8_C( 33),
+      UINT8_C(135), UINT8_C(  3), UINT8_C(  7), UINT8_C( 13), UINT8_C( 44), UINT8_C(147), UINT8_C(103), UINT8_C(153),
+      UINT8_C( 92), UINT8_C(200), UINT8_C( 36), UINT8_C( 81), UINT8_C( 47), UINT8_C( 49), UINT8_C(253), UINT8_C(153),
+      UINT8_C( 77), UINT8_C( 26), UINT8_C(179), UINT8_C(175), UINT8_C( 94), UINT8_C(248), UINT8_C( 80), UINT8_C(  7),
+      UINT8_C( 49), UINT8_C(159), UINT8_C( 79), UINT8_C( 24), UINT8_C(223), UINT8_C(173), UINT8_C(167), UINT8_C(102),
+      UINT8_C(176), UINT8_C(175), UINT8_C( 43), UINT8_C(220), UINT8_C( 66), UINT8_C(147), UINT8_C( 15), UINT8_C(158),
+      UINT8_C( 91), UINT8_C(153), UINT8_C(239), UINT8_C( 40), UINT8_C(159), UINT8_C(237), UINT8_C(  5), UINT8_C( 24),
+      UINT8_C( 82), UINT8_C( 35), UINT8_C(200), UINT8_C(191), UINT8_C( 27), UINT8_C( 24), UINT8_C(231), UINT8_C( 77),
+      UINT8_C( 17), UINT8_C( 54), UINT8_C(101), UINT8_C(209), UINT8_C(191), UINT8_C( 13), UINT8_C( 86), UINT8_C(146),
+      UINT8_C(188), UINT8_C(130), UINT8_C(111), UINT8_C(254), UINT8_C( 21), UINT8_C(228), UINT8_C(156), UINT8_C(112),
+      UINT8_C(126), UINT8_C(139), UINT8_C(250), UINT8_C( 53), UINT8_C(120), UINT8_C( 30), UINT8_C( 52), UINT8_C(202),
+      UINT8_C( 66), UINT8_C( 41), UINT8_C( 64), UINT8_C( 93), UINT8_C( 66), UINT8_C(145), UINT8_C(170), UINT8_C( 83),
+      UINT8_C(199), UINT8_C( 16), UINT8_C( 68), UINT8_C(170), UINT8_C( 29), UINT8_C(154), UINT8_C( 61), UINT8_C(217),
+      UINT8_C( 19), UINT8_C(172), UINT8_C(215), UINT8_C( 13), UINT8_C(144), UINT8_C(115), UINT8_C(161), UINT8_C( 14),
+      UINT8_C(254), UINT8_C(156), UINT8_C( 87), UINT8_C(119), UINT8_C(186), UINT8_C(185), UINT8_C( 65), UINT8_C(252),
+      UINT8_C(226), UINT8_C(235), UINT8_C( 28), UINT8_C( 36), UINT8_C( 50), UINT8_C(  4), UINT8_C(  0), UINT8_C( 67),
+      UINT8_C( 20), UINT8_C(188), UINT8_C(237), UINT8_C( 49), UINT8_C( 86), UINT8_C( 42), UINT8_C( 10), UINT8_C( 38),
+      UINT8_C(214), UINT8_C(225), UINT8_C(164), UINT8_C( 97), UINT8_C( 84), UINT8_C( 19), UINT8_C(117), UINT8_C( 83),
+      UINT8_C(226), UINT8_C(190), UINT8_C( 45), UINT8_C(156), UINT8_C(134), UINT8_C( 11), UINT8_C(153), UINT8_C( 37),
+      UINT8_C(247), UINT8_C(124), UINT8_C(141), UINT8_C( 75), UINT8_C(208), UINT8_C(  5), UINT8_C(183), UINT8_C( 12),
+      UINT8_C(193), UINT8_C( 73), UINT8_C( 61), UINT8_C( 23), UINT8_C(207), UINT8_C( 72), UINT8_C( 49), UINT8_C(165),
+      UINT8_C( 41), UINT8_C( 47), UINT8_C( 12), UINT8_C(126), UINT8_C(117), UINT8_C( 31), UINT8_C(209), UINT8_C( 87),
+      UINT8_C( 79), UINT8_C(155), UINT8_C( 48), UINT8_C(152), UINT8_C(166), UINT8_C(140), UINT8_C( 61), UINT8_C(157),
+      UINT8_C( 11), UINT8_C(111), UINT8_C( 17), UINT8_C(119), UINT8_C(207), UINT8_C(200), UINT8_C(131), UINT8_C( 26),
+      UINT8_C(108), UINT8_C(192), UINT8_C( 37), UINT8_C( 59), UINT8_C(  8), UINT8_C( 50), UINT8_C(225), UINT8_C( 50),
+      UINT8_C( 97), UINT8_C( 13), UINT8_C(176), UINT8_C(214), UINT8_C(111), UINT8_C(129), UINT8_C( 45), UINT8_C( 10),
+      UINT8_C( 28), UINT8_C( 33), UINT8_C(147), UINT8_C(132), UINT8_C(173), UINT8_C(209), UINT8_C( 96), UINT8_C( 45),
+      UINT8_C(155), UINT8_C(113), UINT8_C(164), UINT8_C(107), UINT8_C( 57), UINT8_C( 39), UINT8_C(251), UINT8_C(151),
+      UINT8_C(231), UINT8_C(163), UINT8_C(176), UINT8_C(120), UINT8_C(134), UINT8_C(147), UINT8_C( 34), UINT8_C( 55),
+      UINT8_C(175), UINT8_C(210), UINT8_C( 14), UINT8_C( 31), UINT8_C( 83), UINT8_C(  8), UINT8_C(214), UINT8_C(111),
+      UINT8_C( 92), UINT8_C(113), UINT8_C( 49), UINT8_C( 10), UINT8_C( 66), UINT8_C(145), UINT8_C( 55), UINT8_C(169),
+      UINT8_C(  2), UINT8_C(219), UINT8_C( 72), UINT8_C( 59), UINT8_C(  2), UINT8_C( 68), UINT8_C(225), UINT8_C(233),
+      UINT8_C(215), UINT8_C( 29), UINT8_C( 98), UINT8_C( 93), UINT8_C(132), UINT8_C(251), UINT8_C(158), UINT8_C( 51),
+      UINT8_C(205), UINT8_C(  3), UINT8_C( 82), UINT8_C( 32), UINT8_C( 62), UINT8_C( 48), UINT8_C(143), UINT8_C(155),
+      UINT8_C(161), UINT8_C( 91), UINT8_C( 10), UINT8_C(227), UINT8_C( 82), UINT8_C(220), UINT8_C(192), UINT8_C( 85),
+      UINT8_C( 83), UINT8_C(  9), UINT8_C(144), UINT8_C(185), UINT8_C( 49), UINT8_C(  0), UINT8_C(162), UINT8_C( 52),
+      UINT8_C( 30), UINT8_C( 69), UINT8_C(101), UINT8_C(183), UINT8_C(119), UINT8_C(231), UINT8_C( 31), UINT8_C( 69),
+      UINT8_C(234), UINT8_C( 61), UINT8_C(101), UINT8_C( 40), UINT8_C(109), UINT8_C(245), UINT8_C(195), UINT8_C( 14),
+      UINT8_C(182), UINT8_C(104), UINT8_C(226), UINT8_C(  8), UINT8_C( 68), UINT8_C(178), UINT8_C( 93), UINT8_C(251),
+      UINT8_C(187), UINT8_C(184), UINT8_C(180), UINT8_C(  8), UINT8_C( 95), UINT8_C( 87), UINT8_C( 60), UINT8_C(147),
+      UINT8_C( 33), UINT8_C( 46), UINT8_C( 74), UINT8_C( 74), UINT8_C( 21), UINT8_C( 53), UINT8_C(143),    UINT8_MAX,
+      UINT8_C(  0), UINT8_C( 80), UINT8_C( 40), UINT8_C(224), UINT8_C(142), UINT8_C(235), UINT8_C(239), UINT8_C( 39),
+      UINT8_C( 84), UINT8_C(224), UINT8_C(168), UINT8_C(152), UINT8_C(127), UINT8_C(  6), UINT8_C(148), UINT8_C( 77),
+      UINT8_C(108), UINT8_C( 72), UINT8_C( 85), UINT8_C( 83), UINT8_C(159), UINT8_C(146), UINT8_C(230), UINT8_C(114),
+      UINT8_C(192), UINT8_C( 49), UINT8_C(189), UINT8_C(214), UINT8_C(102), UINT8_C( 76), UINT8_C(  7), UINT8_C(102),
+      UINT8_C( 65), UINT8_C( 66), UINT8_C(186), UINT8_C( 43), UINT8_C(233), UINT8_C( 98), UINT8_C(203), UINT8_C( 61),
+      UINT8_C( 16), UINT8_C(116), UINT8_C(  8), UINT8_C( 28), UINT8_C(122), UINT8_C(105), UINT8_C(105), UINT8_C(110),
+      UINT8_C(178), UINT8_C(191), UINT8_C(193), UINT8_C(  9), UINT8_C( 81), UINT8_C(168), UINT8_C( 17), UINT8_C( 17),
+      UINT8_C( 94), UINT8_C( 34), UINT8_C(231), UINT8_C( 63), UINT8_C(  9), UINT8_C(189), UINT8_C( 25), UINT8_C( 15),
+      UINT8_C(186), UINT8_C(193), UINT8_C( 58), UINT8_C(163), UINT8_C( 35), UINT8_C(  6), UINT8_C(141), UINT8_C(  5),
+      UINT8_C(112), UINT8_C(149), UINT8_C( 33), UINT8_C(244), UINT8_C( 31), UINT8_C( 47), UINT8_C( 59), UINT8_C(209),
+      UINT8_C( 74), UINT8_C( 35), UINT8_C( 35), UINT8_C(155), UINT8_C(184), UINT8_C(231), UINT8_C(172), UINT8_C( 22),
+      UINT8_C( 15), UINT8_C(148), UINT8_C(228), UINT8_C( 53), UINT8_C( 36), UINT8_C(253), UINT8_C( 68), UINT8_C( 11),
+      UINT8_C(208), UINT8_C( 96), UINT8_C(175), UINT8_C( 76), UINT8_C( 85), UINT8_C( 82), UINT8_C( 81), UINT8_C(197),
+      UINT8_C( 69), UINT8_C(115), UINT8_C(101), UINT8_C(101), UINT8_C( 17), UINT8_C( 85), UINT8_C( 54), UINT8_C( 20),
+      UINT8_C(120), UINT8_C( 89), UINT8_C(227), UINT8_C( 68), UINT8_C( 47), UINT8_C(143), UINT8_C(232), UINT8_C( 62),
+      UINT8_C( 35), UINT8_C( 70), UINT8_C(222), UINT8_C(116), UINT8_C(201), UINT8_C( 34), UINT8_C(128), UINT8_C( 17),
+      UINT8_C(161), UINT8_C( 47), UINT8_C(229), UINT8_C( 38), UINT8_C(190), UINT8_C( 24), UINT8_C( 37), UINT8_C(  4),
+      UINT8_C(170), UINT8_C( 24), UINT8_C(105), UINT8_C(168), UINT8_C( 50), UINT8_C(159), UINT8_C(240), UINT8_C(230),
+      UINT8_C(249), UINT8_C(  9), UINT8_C( 36), UINT8_C( 57), UINT8_C( 98), UINT8_C( 18), UINT8_C(226), UINT8_C(119),
+      UINT8_C(223), UINT8_C( 59), UINT8_C(250), UINT8_C( 34), UINT8_C(226), UINT8_C(122), UINT8_C( 66), UINT8_C(132),
+      UINT8_C(169), UINT8_C( 39), UINT8_C( 98), UINT8_C(  5), UINT8_C( 94), UINT8_C(142), UINT8_C( 59), UINT8_C(  8),
+      UINT8_C( 31), UINT8_C(213), UINT8_C(176), UINT8_C( 81), UINT8_C(116), UINT8_C(108), UINT8_C( 32), UINT8_C(109),
+      UINT8_C(115), UINT8_C( 68), UINT8_C( 85), UINT8_C(214), UINT8_C(120), UINT8_C( 57), UINT8_C( 92), UINT8_C( 87),
+      UINT8_C( 73), UINT8_C( 86), UINT8_C(  0), UINT8_C( 43), UINT8_C(209), UINT8_C( 66), UINT8_C(175), UINT8_C(122),
+      UINT8_C( 49), UINT8_C( 90), UINT8_C(226), UINT8_C(121), UINT8_C( 42), UINT8_C( 78), UINT8_C(186), UINT8_C( 18),
+      UINT8_C( 35), UINT8_C(  7), UINT8_C(104), UINT8_C(152), UINT8_C( 33), UINT8_C(164), UINT8_C(  5), UINT8_C(149),
+      UINT8_C( 10), UINT8_C(172), UINT8_C(107), UINT8_C(131), UINT8_C( 53), UINT8_C(199), UINT8_C(218), UINT8_C(126),
+      UINT8_C( 29), UINT8_C(113), UINT8_C(  4), UINT8_C( 33), UINT8_C( 28), UINT8_C( 89), UINT8_C(105), UINT8_C(134) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_u8_m(pv, av, bv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+
+    ev = simde_svmin_u8_m(pv, av, bv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(37237), UINT16_C(50499), UINT16_C(14384), UINT16_C( 8803), UINT16_C( 7502), UINT16_C(15774), UINT16_C(22085), UINT16_C( 2573),
+      UINT16_C(57686), UINT16_C(61308), UINT16_C(38819), UINT16_C(40841), UINT16_C(27312), UINT16_C(20708), UINT16_C(25976), UINT16_C(60888),
+      UINT16_C( 7158), UINT16_C(10162), UINT16_C( 5459), UINT16_C(41545), UINT16_C(59187), UINT16_C(30943), UINT16_C(60477), UINT16_C(37763),
+      UINT16_C(65485), UINT16_C(28802), UINT16_C( 2966), UINT16_C(18191), UINT16_C(62582), UINT16_C(61079), UINT16_C(28505), UINT16_C(20443),
+      UINT16_C(36235), UINT16_C(56950), UINT16_C(49059), UINT16_C(54912), UINT16_C(24486), UINT16_C(58446), UINT16_C(53579), UINT16_C( 6263),
+      UINT16_C(64208), UINT16_C(26504), UINT16_C(38917), UINT16_C(31662), UINT16_C(17804), UINT16_C(58729), UINT16_C(17589), UINT16_C(16436),
+      UINT16_C(43986), UINT16_C(29982), UINT16_C(40810), UINT16_C( 4427), UINT16_C(39422), UINT16_C(19189), UINT16_C(27755), UINT16_C(15202),
+      UINT16_C(60262), UINT16_C(27810), UINT16_C(20611), UINT16_C( 4071), UINT16_C(20886), UINT16_C(19444), UINT16_C(10389), UINT16_C(26507),
+      UINT16_C(43475), UINT16_C(16092), UINT16_C(10056), UINT16_C(18255), UINT16_C(17601), UINT16_C(11409), UINT16_C(62384), UINT16_C( 5991),
+      UINT16_C( 2782), UINT16_C(24963), UINT16_C(27226), UINT16_C(61552), UINT16_C(25787), UINT16_C(20795), UINT16_C(50829), UINT16_C(24760),
+      UINT16_C(38256), UINT16_C(47262), UINT16_C(60860), UINT16_C(32255), UINT16_C(36913), UINT16_C(58025), UINT16_C( 4484), UINT16_C(25337),
+      UINT16_C(31771), UINT16_C(30148), UINT16_C(13542), UINT16_C(41574), UINT16_C(41369), UINT16_C( 9971), UINT16_C(43880), UINT16_C(55430),
+      UINT16_C( 9536), UINT16_C(64912), UINT16_C(36882), UINT16_C(17530), UINT16_C( 9248), UINT16_C(42022), UINT16_C( 7989), UINT16_C(20487),
+      UINT16_C(52123), UINT16_C(33221), UINT16_C(11263), UINT16_C(38947), UINT16_C( 5837), UINT16_C(13758), UINT16_C(17858), UINT16_C(  525),
+      UINT16_C(40298), UINT16_C(31999), UINT16_C(31277), UINT16_C(20160), UINT16_C(59038), UINT16_C(54258), UINT16_C(63749), UINT16_C(40995),
+      UINT16_C(59588), UINT16_C(50210), UINT16_C(17684), UINT16_C(57692), UINT16_C( 7004), UINT16_C( 7702), UINT16_C( 9056), UINT16_C(51744),
+      UINT16_C( 8384), UINT16_C(60998), UINT16_C( 1946), UINT16_C(14396), UINT16_C(12013), UINT16_C(62219), UINT16_C(11816), UINT16_C(60563),
+      UINT16_C(46358), UINT16_C(10928), UINT16_C( 3579), UINT16_C(22283), UINT16_C( 8488), UINT16_C(34933), UINT16_C(38212), UINT16_C( 1362),
+      UINT16_C(39093), UINT16_C(20467), UINT16_C(12191), UINT16_C(36231), UINT16_C(37469), UINT16_C(34176), UINT16_C( 5056), UINT16_C(55154),
+      UINT16_C( 8905), UINT16_C(50177), UINT16_C( 3375), UINT16_C(22299), UINT16_C(36910), UINT16_C(29663), UINT16_C(12581), UINT16_C(56184),
+      UINT16_C(27594), UINT16_C(26922), UINT16_C(45722), UINT16_C(63478), UINT16_C(30276), UINT16_C( 1405), UINT16_C(61322), UINT16_C(21468),
+      UINT16_C(56593), UINT16_C(16663), UINT16_C(13034), UINT16_C( 6552), UINT16_C(30914), UINT16_C(59276), UINT16_C( 1193), UINT16_C(29634),
+      UINT16_C(60783), UINT16_C( 2525), UINT16_C(54175), UINT16_C(58112), UINT16_C(32074), UINT16_C(54504), UINT16_C(50284), UINT16_C(32295),
+      UINT16_C(16034), UINT16_C(36031), UINT16_C(22384), UINT16_C(12965), UINT16_C(12751), UINT16_C(31001), UINT16_C(56373), UINT16_C(42220),
+      UINT16_C(51657), UINT16_C(26797), UINT16_C(44701), UINT16_C(59211), UINT16_C(13355), UINT16_C(39099), UINT16_C(58104), UINT16_C(39446),
+      UINT16_C(54560), UINT16_C(36903), UINT16_C(52268), UINT16_C(64706), UINT16_C(56318), UINT16_C(13173), UINT16_C(25015), UINT16_C(32984),
+      UINT16_C(34091), UINT16_C(51432), UINT16_C(13363), UINT16_C(24495), UINT16_C(27240), UINT16_C(24823), UINT16_C( 3404), UINT16_C(27899),
+      UINT16_C( 8930), UINT16_C( 3836), UINT16_C(48878), UINT16_C(60426), UINT16_C(32665), UINT16_C(20768), UINT16_C(63713), UINT16_C( 3281),
+      UINT16_C(47741), UINT16_C(45524), UINT16_C(33774), UINT16_C(22032), UINT16_C( 2029), UINT16_C(14774), UINT16_C(45332), UINT16_C(63141),
+      UINT16_C(41427), UINT16_C(49668), UINT16_C( 3935), UINT16_C(63662), UINT16_C(52878), UINT16_C(28489), UINT16_C( 7110), UINT16_C(17531),
+      UINT16_C(20437), UINT16_C(50165), UINT16_C( 1490), UINT16_C(48921), UINT16_C(53004), UINT16_C( 8440), UINT16_C(40321), UINT16_C(21526),
+      UINT16_C( 6718), UINT16_C(40214), UINT16_C(50473), UINT16_C(47254), UINT16_C(57235), UINT16_C(23079), UINT16_C(41978), UINT16_C(53150),
+      UINT16_C(37874), UINT16_C(50578), UINT16_C(43928), UINT16_C(42116), UINT16_C(32123), UINT16_C(64708), UINT16_C(55834) };
+  static const uint16_t b[] =
+    { UINT16_C(41749), UINT16_C(34335), UINT16_C(52541), UINT16_C( 5511), UINT16_C(56948), UINT16_C(25736), UINT16_C(54343), UINT16_C(46979),
+      UINT16_C(13356), UINT16_C(64281), UINT16_C(25284), UINT16_C(64202), UINT16_C(51085), UINT16_C( 8759), UINT16_C( 7174), UINT16_C( 6929),
+      UINT16_C(12479), UINT16_C(64929), UINT16_C(10493), UINT16_C(29202), UINT16_C(39431), UINT16_C(20182), UINT16_C(22894), UINT16_C(39430),
+      UINT16_C( 8077), UINT16_C(21142), UINT16_C(24705), UINT16_C( 3660), UINT16_C(33575), UINT16_C(11568), UINT16_C(17056), UINT16_C(24393),
+      UINT16_C(60018), UINT16_C(28764), UINT16_C(28179), UINT16_C( 6882), UINT16_C(47113), UINT16_C(30568), UINT16_C(28177), UINT16_C(40722),
+      UINT16_C(43149), UINT16_C( 3825), UINT16_C(15624), UINT16_C(12316), UINT16_C(19904), UINT16_C(24669), UINT16_C(42639), UINT16_C(  448),
+      UINT16_C( 7313), UINT16_C(42097), UINT16_C(21387), UINT16_C(38078), UINT16_C( 9739), UINT16_C( 7435), UINT16_C( 7573), UINT16_C( 8892),
+      UINT16_C(44485), UINT16_C(52785), UINT16_C(19946), UINT16_C(43774), UINT16_C(23450), UINT16_C(10507), UINT16_C(51970), UINT16_C(37675),
+      UINT16_C(40167), UINT16_C(29239), UINT16_C(62960), UINT16_C(64262), UINT16_C( 4635), UINT16_C(45080), UINT16_C(54319), UINT16_C(62931),
+      UINT16_C( 1153), UINT16_C(27587), UINT16_C(49489), UINT16_C(60438), UINT16_C( 8476), UINT16_C( 7701), UINT16_C(16620), UINT16_C(54193),
+      UINT16_C(59613), UINT16_C(52550), UINT16_C(19677), UINT16_C(63944), UINT16_C(57694), UINT16_C(36521), UINT16_C(31925), UINT16_C(14211),
+      UINT16_C(18048), UINT16_C(53922), UINT16_C(47111), UINT16_C( 9150), UINT16_C(54233), UINT16_C(50498), UINT16_C(62228), UINT16_C(61849),
+      UINT16_C(57308), UINT16_C(47550), UINT16_C(34347), UINT16_C(35506), UINT16_C(23655), UINT16_C( 7448), UINT16_C(39896), UINT16_C(22868),
+      UINT16_C(63201), UINT16_C(59435), UINT16_C(59823), UINT16_C(34827), UINT16_C(19900), UINT16_C(53326), UINT16_C(59201), UINT16_C( 7617),
+      UINT16_C(32710), UINT16_C(61910), UINT16_C(35078), UINT16_C(28027), UINT16_C(37861), UINT16_C(48522), UINT16_C(56878), UINT16_C( 3862),
+      UINT16_C(16853), UINT16_C(34039), UINT16_C(  810), UINT16_C(59148), UINT16_C(23120), UINT16_C(37303), UINT16_C(31041), UINT16_C( 1966),
+      UINT16_C(34296), UINT16_C(65273), UINT16_C(29710), UINT16_C(62316), UINT16_C(62984), UINT16_C(14000), UINT16_C(51157), UINT16_C(43590),
+      UINT16_C(15624), UINT16_C(13102), UINT16_C(14912), UINT16_C(37146), UINT16_C(53653), UINT16_C(54818), UINT16_C(53578), UINT16_C(17374),
+      UINT16_C(55126), UINT16_C(25665), UINT16_C(44363), UINT16_C(21335), UINT16_C( 1956), UINT16_C(31114), UINT16_C(53454), UINT16_C(55075),
+      UINT16_C(20749), UINT16_C(19978), UINT16_C( 9355), UINT16_C( 8415), UINT16_C(  501), UINT16_C(16631), UINT16_C(54738), UINT16_C(10371),
+      UINT16_C(50348), UINT16_C(63372), UINT16_C(58226), UINT16_C( 5707), UINT16_C(54763), UINT16_C(47503), UINT16_C(45733), UINT16_C(45712),
+      UINT16_C(39427), UINT16_C(36352), UINT16_C(57278), UINT16_C(46255), UINT16_C(42721), UINT16_C(46068), UINT16_C(30587), UINT16_C(10204),
+      UINT16_C(26683), UINT16_C(44318), UINT16_C(26956), UINT16_C(14275), UINT16_C(21054), UINT16_C(58352), UINT16_C(33028), UINT16_C( 1942),
+      UINT16_C(38427), UINT16_C(55958), UINT16_C(17782), UINT16_C(22414), UINT16_C(33515), UINT16_C(26122), UINT16_C(59129), UINT16_C(13453),
+      UINT16_C(43855), UINT16_C(39906), UINT16_C(42261), UINT16_C(21458), UINT16_C(49912), UINT16_C(64567), UINT16_C(52547), UINT16_C(24324),
+      UINT16_C(39523), UINT16_C(55609), UINT16_C(51167), UINT16_C(51760), UINT16_C(15177), UINT16_C(16944), UINT16_C(48417), UINT16_C(28790),
+      UINT16_C(22632), UINT16_C(32011), UINT16_C(56830), UINT16_C(63185), UINT16_C( 2208), UINT16_C(58354), UINT16_C(63189), UINT16_C(14402),
+      UINT16_C(31632), UINT16_C(28434), UINT16_C(16962), UINT16_C(35641), UINT16_C(27005), UINT16_C(40909), UINT16_C(17446), UINT16_C(36623),
+      UINT16_C( 7068), UINT16_C(39436), UINT16_C(56824), UINT16_C(39056), UINT16_C(33765), UINT16_C(47740), UINT16_C(48761), UINT16_C( 2803),
+      UINT16_C( 1338), UINT16_C(31865), UINT16_C(45895), UINT16_C(50440), UINT16_C(54556), UINT16_C(17252), UINT16_C(29465), UINT16_C(46802),
+      UINT16_C(56974), UINT16_C(34640), UINT16_C(57788), UINT16_C(41247), UINT16_C(39780), UINT16_C(56668), UINT16_C(20314), UINT16_C(38119),
+      UINT16_C(24916), UINT16_C(39696), UINT16_C( 6164), UINT16_C(12384), UINT16_C(50414), UINT16_C( 1907), UINT16_C(17720), UINT16_C(50877),
+      UINT16_C( 3620), UINT16_C(57421), UINT16_C(28143), UINT16_C(21377), UINT16_C(56584), UINT16_C(25136), UINT16_C( 6188) };
+  static const uint16_t e[] =
+    { UINT16_C(37237), UINT16_C(    0), UINT16_C(14384), UINT16_C(    0), UINT16_C(    0), UINT16_C(15774), UINT16_C(22085), UINT16_C( 2573),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(25284), UINT16_C(    0), UINT16_C(27312), UINT16_C(    0), UINT16_C( 7174), UINT16_C(    0),
+      UINT16_C( 7158), UINT16_C(10162), UINT16_C(    0), UINT16_C(29202), UINT16_C(39431), UINT16_C(20182), UINT16_C(22894), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C( 2966), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17056), UINT16_C(20443),
+      UINT16_C(36235), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(28177), UINT16_C( 6263),
+      UINT16_C(43149), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17804), UINT16_C(24669), UINT16_C(17589), UINT16_C(  448),
+      UINT16_C( 7313), UINT16_C(29982), UINT16_C(    0), UINT16_C(    0), UINT16_C( 9739), UINT16_C(    0), UINT16_C(    0), UINT16_C( 8892),
+      UINT16_C(44485), UINT16_C(27810), UINT16_C(19946), UINT16_C( 4071), UINT16_C(    0), UINT16_C(10507), UINT16_C(10389), UINT16_C(    0),
+      UINT16_C(40167), UINT16_C(    0), UINT16_C(10056), UINT16_C(18255), UINT16_C(    0), UINT16_C(    0), UINT16_C(54319), UINT16_C(    0),
+      UINT16_C( 1153), UINT16_C(24963), UINT16_C(27226), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(38256), UINT16_C(47262), UINT16_C(19677), UINT16_C(32255), UINT16_C(    0), UINT16_C(    0), UINT16_C( 4484), UINT16_C(14211),
+      UINT16_C(18048), UINT16_C(30148), UINT16_C(    0), UINT16_C( 9150), UINT16_C(41369), UINT16_C(    0), UINT16_C(43880), UINT16_C(55430),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17530), UINT16_C( 9248), UINT16_C( 7448), UINT16_C( 7989), UINT16_C(20487),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(11263), UINT16_C(34827), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(  525),
+      UINT16_C(32710), UINT16_C(31999), UINT16_C(31277), UINT16_C(20160), UINT16_C(    0), UINT16_C(    0), UINT16_C(56878), UINT16_C(    0),
+      UINT16_C(16853), UINT16_C(    0), UINT16_C(    0), UINT16_C(57692), UINT16_C(    0), UINT16_C( 7702), UINT16_C( 9056), UINT16_C(    0),
+      UINT16_C( 8384), UINT16_C(60998), UINT16_C(    0), UINT16_C(    0), UINT16_C(12013), UINT16_C(    0), UINT16_C(11816), UINT16_C(43590),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(38212), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(21335), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(55075),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C( 3375), UINT16_C(    0), UINT16_C(    0), UINT16_C(16631), UINT16_C(12581), UINT16_C(10371),
+      UINT16_C(27594), UINT16_C(    0), UINT16_C(    0), UINT16_C( 5707), UINT16_C(30276), UINT16_C( 1405), UINT16_C(45733), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(13034), UINT16_C( 6552), UINT16_C(30914), UINT16_C(46068), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(26683), UINT16_C( 2525), UINT16_C(26956), UINT16_C(14275), UINT16_C(21054), UINT16_C(54504), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(16034), UINT16_C(36031), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(42261), UINT16_C(    0), UINT16_C(13355), UINT16_C(    0), UINT16_C(52547), UINT16_C(24324),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(51760), UINT16_C(    0), UINT16_C(13173), UINT16_C(25015), UINT16_C(    0),
+      UINT16_C(22632), UINT16_C(    0), UINT16_C(13363), UINT16_C(    0), UINT16_C(    0), UINT16_C(24823), UINT16_C( 3404), UINT16_C(14402),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(16962), UINT16_C(35641), UINT16_C(    0), UINT16_C(    0), UINT16_C(17446), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(39436), UINT16_C(33774), UINT16_C(    0), UINT16_C(    0), UINT16_C(14774), UINT16_C(45332), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C( 3935), UINT16_C(    0), UINT16_C(52878), UINT16_C(    0), UINT16_C( 7110), UINT16_C(    0),
+      UINT16_C(20437), UINT16_C(    0), UINT16_C(    0), UINT16_C(41247), UINT16_C(39780), UINT16_C( 8440), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C( 6164), UINT16_C(    0), UINT16_C(50414), UINT16_C( 1907), UINT16_C(17720), UINT16_C(50877),
+      UINT16_C( 3620), UINT16_C(    0), UINT16_C(28143), UINT16_C(    0), UINT16_C(32123), UINT16_C(25136), UINT16_C( 6188) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_u16_z(pv, av, bv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+
+    ev = simde_svmin_u16_z(pv, av, bv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(16124), UINT16_C(35250), UINT16_C(48843), UINT16_C(39867), UINT16_C(43361), UINT16_C(59710), UINT16_C( 1982), UINT16_C(56656),
+      UINT16_C( 1841), UINT16_C(44636), UINT16_C(61762), UINT16_C(15556), UINT16_C( 6585), UINT16_C(27710), UINT16_C(62183), UINT16_C(58339),
+      UINT16_C(38192), UINT16_C(64364), UINT16_C(10067), UINT16_C(46230), UINT16_C(54481), UINT16_C(36765), UINT16_C(60892), UINT16_C( 3436),
+      UINT16_C(51444), UINT16_C(14012), UINT16_C(32953), UINT16_C(29299), UINT16_C(45465), UINT16_C(32990), UINT16_C(49571), UINT16_C(54116),
+      UINT16_C(53334), UINT16_C(43471), UINT16_C(26104), UINT16_C(51549), UINT16_C(64058), UINT16_C( 5720), UINT16_C(50663), UINT16_C(56099),
+      UINT16_C(57229), UINT16_C(18194), UINT16_C(34143), UINT16_C(63929), UINT16_C(38966), UINT16_C(55929), UINT16_C(56665), UINT16_C(45229),
+      UINT16_C(31918), UINT16_C(42585), UINT16_C(47074), UINT16_C( 7279), UINT16_C(51121), UINT16_C(39218), UINT16_C(21900), UINT16_C( 6772),
+      UINT16_C(34357), UINT16_C(37985), UINT16_C( 6667), UINT16_C(17037), UINT16_C( 1970), UINT16_C( 3100), UINT16_C(51684), UINT16_C(37564),
+      UINT16_C( 5446), UINT16_C(10296), UINT16_C(42956), UINT16_C(32324), UINT16_C(30319), UINT16_C(64279), UINT16_C(35787), UINT16_C(   21),
+      UINT16_C(30226), UINT16_C( 7573), UINT16_C( 8849), UINT16_C(17247), UINT16_C(31529), UINT16_C( 3663), UINT16_C( 2885), UINT16_C(35744),
+      UINT16_C(55585), UINT16_C(60851), UINT16_C(63360), UINT16_C(61291), UINT16_C(33389), UINT16_C(14571), UINT16_C(   14), UINT16_C( 8249),
+      UINT16_C(52855), UINT16_C( 2109), UINT16_C(40432), UINT16_C( 6731), UINT16_C(39704), UINT16_C(23848), UINT16_C(51366), UINT16_C(51176),
+      UINT16_C(39841), UINT16_C( 8885), UINT16_C( 8338), UINT16_C(65297), UINT16_C(64675), UINT16_C(45368), UINT16_C(29181), UINT16_C(29905),
+      UINT16_C( 3647), UINT16_C(12156), UINT16_C(51115), UINT16_C(50249), UINT16_C(29026), UINT16_C( 2337), UINT16_C( 2618), UINT16_C(56272),
+      UINT16_C(34213), UINT16_C(14589), UINT16_C( 4006), UINT16_C(18743), UINT16_C(28427), UINT16_C( 2298), UINT16_C(52192), UINT16_C( 8060),
+      UINT16_C(63705), UINT16_C(34127), UINT16_C(39104), UINT16_C( 8777), UINT16_C(27146), UINT16_C(17451), UINT16_C(64628), UINT16_C( 6687),
+      UINT16_C( 7553), UINT16_C(10066), UINT16_C(35116), UINT16_C(14192), UINT16_C(27385), UINT16_C(55616), UINT16_C(48181), UINT16_C( 4089),
+      UINT16_C(18613), UINT16_C(30100), UINT16_C(56800), UINT16_C(60055), UINT16_C(49991), UINT16_C(48174), UINT16_C(20159), UINT16_C(16598),
+      UINT16_C(10347), UINT16_C(38760), UINT16_C(55473), UINT16_C(43726), UINT16_C( 3651), UINT16_C(30852), UINT16_C(32203), UINT16_C(32903),
+      UINT16_C( 7109), UINT16_C(42485), UINT16_C(36088), UINT16_C(16528), UINT16_C(48719), UINT16_C( 3836), UINT16_C(53772), UINT16_C(30543),
+      UINT16_C(47098), UINT16_C(43790), UINT16_C(56719), UINT16_C(53846), UINT16_C(56043), UINT16_C(46667), UINT16_C(53847), UINT16_C( 7222),
+      UINT16_C(11246), UINT16_C(59073), UINT16_C(20920), UINT16_C( 1830), UINT16_C( 8720), UINT16_C( 7190), UINT16_C(26100), UINT16_C(61076),
+      UINT16_C(41500), UINT16_C(43930), UINT16_C(61567), UINT16_C(27518), UINT16_C(51658), UINT16_C( 8481), UINT16_C(22683), UINT16_C(35133),
+      UINT16_C(65155), UINT16_C(15216), UINT16_C(38480), UINT16_C(24643), UINT16_C(22969), UINT16_C(44412), UINT16_C( 4286), UINT16_C(55964),
+      UINT16_C(14003), UINT16_C(12933), UINT16_C(  806), UINT16_C(61597), UINT16_C(49100), UINT16_C(26641), UINT16_C(19991), UINT16_C(39665),
+      UINT16_C(24908), UINT16_C(40150), UINT16_C( 6648), UINT16_C(45564), UINT16_C(31090), UINT16_C(12382), UINT16_C(64137), UINT16_C(15370),
+      UINT16_C(36656), UINT16_C(22127), UINT16_C( 3219), UINT16_C(24390), UINT16_C(22475), UINT16_C(58055), UINT16_C(47525), UINT16_C(62077),
+      UINT16_C(21274), UINT16_C( 4750), UINT16_C(35692), UINT16_C(57027), UINT16_C( 8708), UINT16_C(36110), UINT16_C( 6172), UINT16_C(19914),
+      UINT16_C(14759), UINT16_C(15011), UINT16_C(59973), UINT16_C( 4506), UINT16_C(24897), UINT16_C(59379), UINT16_C(28698), UINT16_C(13785),
+      UINT16_C(26563), UINT16_C(12103), UINT16_C( 3058), UINT16_C(62989), UINT16_C( 6957), UINT16_C(18820), UINT16_C(20019), UINT16_C(56214),
+      UINT16_C(14983), UINT16_C(52245), UINT16_C(44836), UINT16_C(26077), UINT16_C(53521), UINT16_C(11084), UINT16_C( 9537), UINT16_C( 1376),
+      UINT16_C(43149), UINT16_C(32564), UINT16_C(17075), UINT16_C(57462), UINT16_C(64093), UINT16_C(37161), UINT16_C(49224), UINT16_C(53100),
+      UINT16_C(33274), UINT16_C( 7835), UINT16_C(31025), UINT16_C(17027), UINT16_C(53322), UINT16_C(35693), UINT16_C(52981), UINT16_C(33424),
+      UINT16_C(50550), UINT16_C(10498), UINT16_C(30727), UINT16_C(25609), UINT16_C(12914), UINT16_C(47861), UINT16_C(25074), UINT16_C(60553),
+      UINT16_C( 9443), UINT16_C( 5130), UINT16_C(36509), UINT16_C(59222), UINT16_C(50014), UINT16_C(21363), UINT16_C(  913), UINT16_C( 2006),
+      UINT16_C(55496), UINT16_C(53040), UINT16_C(14672), UINT16_C(49716), UINT16_C(10604), UINT16_C(24188), UINT16_C( 1419), UINT16_C(28235),
+      UINT16_C(21801), UINT16_C(51074), UINT16_C(55523), UINT16_C(16814), UINT16_C( 8603), UINT16_C(11669), UINT16_C(27429), UINT16_C(60724),
+      UINT16_C(25923), UINT16_C(37821), UINT16_C(61854), UINT16_C( 2645), UINT16_C(53530), UINT16_C(42345), UINT16_C(46294), UINT16_C(65299),
+      UINT16_C(38153), UINT16_C(60870), UINT16_C(30061), UINT16_C( 2350), UINT16_C(50070), UINT16_C(47926), UINT16_C(27182), UINT16_C(29097),
+      UINT16_C(26319), UINT16_C(28164), UINT16_C(22871), UINT16_C(29048), UINT16_C(57642), UINT16_C(   23), UINT16_C(10901), UINT16_C(40704),
+      UINT16_C(50880), UINT16_C(11660), UINT16_C(47675), UINT16_C(53814), UINT16_C(27774), UINT16_C(44173), UINT16_C(14039), UINT16_C(42526),
+      UINT16_C( 8860), UINT16_C(62228), UINT16_C(36220), UINT16_C(42597), UINT16_C(31854), UINT16_C( 1191), UINT16_C(42918), UINT16_C(26275),
+      UINT16_C(12141), UINT16_C(43412), UINT16_C(51945), UINT16_C(26491), UINT16_C( 2103), UINT16_C( 3604), UINT16_C(12863), UINT16_C(56244),
+      UINT16_C(51540), UINT16_C(53455), UINT16_C(13398), UINT16_C(50295), UINT16_C( 7856), UINT16_C(22216), UINT16_C(27589), UINT16_C(12989),
+      UINT16_C(20890), UINT16_C(34011), UINT16_C(22043), UINT16_C(21227), UINT16_C(65375), UINT16_C(40544), UINT16_C( 5425), UINT16_C(34425),
+      UINT16_C(18654), UINT16_C(13398), UINT16_C(52604), UINT16_C(11512), UINT16_C(49643), UINT16_C(45187), UINT16_C(16428), UINT16_C(51171),
+      UINT16_C(48785), UINT16_C(44107), UINT16_C(13845), UINT16_C(29951), UINT16_C(24374), UINT16_C(26386), UINT16_C(35700), UINT16_C(21229),
+      UINT16_C(17620), UINT16_C(20614), UINT16_C(32529), UINT16_C(64893), UINT16_C(   64), UINT16_C(27821), UINT16_C(36928), UINT16_C(53555),
+      UINT16_C(32335), UINT16_C(25725), UINT16_C(31925), UINT16_C(60376), UINT16_C(60124), UINT16_C(20562), UINT16_C(16501), UINT16_C(18851),
+      UINT16_C(10628), UINT16_C(38298), UINT16_C( 6056), UINT16_C(59538), UINT16_C(16407), UINT16_C(22357), UINT16_C(35024), UINT16_C( 7976),
+      UINT16_C(42247), UINT16_C(48259), UINT16_C(23330), UINT16_C(65191), UINT16_C(63813), UINT16_C(47950), UINT16_C(61753), UINT16_C(48388),
+      UINT16_C(40475), UINT16_C(50003), UINT16_C(58805), UINT16_C(52396), UINT16_C(  293), UINT16_C(63011), UINT16_C(19337), UINT16_C(36885),
+      UINT16_C(39409), UINT16_C( 4940), UINT16_C(62452), UINT16_C(14865), UINT16_C(24557), UINT16_C( 9973), UINT16_C(63825), UINT16_C(27876),
+      UINT16_C(14232), UINT16_C(19759), UINT16_C(56092), UINT16_C(16922), UINT16_C(15836), UINT16_C(26168), UINT16_C(19849), UINT16_C(31478),
+      UINT16_C(17382), UINT16_C(56205), UINT16_C(40502), UINT16_C( 8981), UINT16_C( 2813), UINT16_C(20042), UINT16_C(11779), UINT16_C(39866),
+      UINT16_C(60005), UINT16_C(33257), UINT16_C(  965), UINT16_C(41667), UINT16_C(64320), UINT16_C(51464), UINT16_C(65097), UINT16_C(12099),
+      UINT16_C(53313), UINT16_C(30730), UINT16_C( 8046), UINT16_C(27803), UINT16_C(58665), UINT16_C(11706), UINT16_C(29971), UINT16_C(30920),
+      UINT16_C(45407), UINT16_C( 9466), UINT16_C(48564), UINT16_C(62918), UINT16_C(52921), UINT16_C(  702), UINT16_C(  717), UINT16_C( 3633) };
+  static const uint16_t b[] =
+    { UINT16_C(28952), UINT16_C( 3566), UINT16_C( 8784), UINT16_C(14016), UINT16_C( 3826), UINT16_C(61852), UINT16_C(44593), UINT16_C(35757),
+      UINT16_C(28750), UINT16_C(20545), UINT16_C(18494), UINT16_C( 7752), UINT16_C(52579), UINT16_C(25159), UINT16_C(11591), UINT16_C(24732),
+      UINT16_C(35486), UINT16_C(61037), UINT16_C(11949), UINT16_C(40740), UINT16_C(49212), UINT16_C(28049), UINT16_C(15983), UINT16_C(48632),
+      UINT16_C(14766), UINT16_C(60429), UINT16_C(21890), UINT16_C(58635), UINT16_C(21027), UINT16_C(27208), UINT16_C(58495), UINT16_C( 7626),
+      UINT16_C(14447), UINT16_C( 7180), UINT16_C(12390), UINT16_C(41659), UINT16_C(19697), UINT16_C(24591), UINT16_C( 2186), UINT16_C(14365),
+      UINT16_C(10817), UINT16_C(49957), UINT16_C(12415), UINT16_C(41641), UINT16_C(61826), UINT16_C(  525), UINT16_C(55253), UINT16_C(17439),
+      UINT16_C(11023), UINT16_C(30048), UINT16_C( 7260), UINT16_C(19735), UINT16_C(10088), UINT16_C(62381), UINT16_C(51759), UINT16_C(28715),
+      UINT16_C(20724), UINT16_C(29492), UINT16_C(56704), UINT16_C(  790), UINT16_C( 9166), UINT16_C(41733), UINT16_C( 9466), UINT16_C( 2792),
+      UINT16_C(18512), UINT16_C(44159), UINT16_C(38756), UINT16_C(52729), UINT16_C(42686), UINT16_C(60864), UINT16_C(60272), UINT16_C(25693),
+      UINT16_C(37180), UINT16_C(48343), UINT16_C(60782), UINT16_C(15551), UINT16_C(50192), UINT16_C( 3040), UINT16_C(51433), UINT16_C(14613),
+      UINT16_C(37904), UINT16_C(30181), UINT16_C(56875), UINT16_C(59714), UINT16_C(  644), UINT16_C(62678), UINT16_C(13549), UINT16_C(10584),
+      UINT16_C(12229), UINT16_C(13542), UINT16_C(42269), UINT16_C(11632), UINT16_C(20586), UINT16_C(21304), UINT16_C(19736), UINT16_C(10636),
+      UINT16_C(29154), UINT16_C( 3486), UINT16_C(57423), UINT16_C(54263), UINT16_C(52706), UINT16_C(53191), UINT16_C( 7937), UINT16_C(51193),
+      UINT16_C(57166), UINT16_C(27643), UINT16_C(27524), UINT16_C(61081), UINT16_C(53692), UINT16_C(54337), UINT16_C(52511), UINT16_C(  509),
+      UINT16_C(39742), UINT16_C(36110), UINT16_C( 1403), UINT16_C(23904), UINT16_C(10195), UINT16_C(54317), UINT16_C( 9798), UINT16_C(38299),
+      UINT16_C(38405), UINT16_C(35072), UINT16_C(39170), UINT16_C(48760), UINT16_C(47467), UINT16_C(35474), UINT16_C(36999), UINT16_C(50571),
+      UINT16_C(39211), UINT16_C(42835), UINT16_C(45983), UINT16_C(29188), UINT16_C(12763), UINT16_C( 8518), UINT16_C(57943), UINT16_C(23734),
+      UINT16_C(46968), UINT16_C(31462), UINT16_C(24144), UINT16_C(47928), UINT16_C(51991), UINT16_C(40517), UINT16_C(53339), UINT16_C(34404),
+      UINT16_C(46954), UINT16_C( 2349), UINT16_C(12906), UINT16_C(17787), UINT16_C(49507), UINT16_C(47975), UINT16_C( 7587), UINT16_C( 7191),
+      UINT16_C(64980), UINT16_C( 9622), UINT16_C(53083), UINT16_C(29664), UINT16_C( 9882), UINT16_C(62737), UINT16_C(30198), UINT16_C(24699),
+      UINT16_C(43308), UINT16_C(38761), UINT16_C(58587), UINT16_C(16092), UINT16_C(17318), UINT16_C(18937), UINT16_C( 4449), UINT16_C(13669),
+      UINT16_C(64526), UINT16_C(27226), UINT16_C(15307), UINT16_C(26077), UINT16_C(61025), UINT16_C(22362), UINT16_C(54628), UINT16_C(37048),
+      UINT16_C( 8574), UINT16_C(22823), UINT16_C( 1030), UINT16_C(44184), UINT16_C(37191), UINT16_C(43253), UINT16_C(23458), UINT16_C(45534),
+      UINT16_C(14423), UINT16_C( 8731), UINT16_C(63603), UINT16_C(54407), UINT16_C(57830), UINT16_C(18988), UINT16_C(58550), UINT16_C(13787),
+      UINT16_C(  517), UINT16_C( 2958), UINT16_C( 9734), UINT16_C(20151), UINT16_C(44472), UINT16_C(23286), UINT16_C(54280), UINT16_C(24331),
+      UINT16_C( 9741), UINT16_C(32897), UINT16_C( 2078), UINT16_C( 1365), UINT16_C(33257), UINT16_C(40783), UINT16_C(10853), UINT16_C(27348),
+      UINT16_C(25389), UINT16_C(13174), UINT16_C(11657), UINT16_C(16769), UINT16_C(30938), UINT16_C(58012), UINT16_C(42828), UINT16_C(22849),
+      UINT16_C(49870), UINT16_C(60634), UINT16_C(12234), UINT16_C(46065), UINT16_C(16816), UINT16_C( 5459), UINT16_C(10091), UINT16_C(39039),
+      UINT16_C(62858), UINT16_C( 5324), UINT16_C(19747), UINT16_C(64853), UINT16_C(61893), UINT16_C( 4832), UINT16_C( 8601), UINT16_C(26475),
+      UINT16_C(17892), UINT16_C(44627), UINT16_C(17780), UINT16_C( 9314), UINT16_C(46470), UINT16_C(61753), UINT16_C(47580), UINT16_C(26506),
+      UINT16_C(22190), UINT16_C(53627), UINT16_C(53411), UINT16_C(27087), UINT16_C(44994), UINT16_C(23419), UINT16_C(59088), UINT16_C(46274),
+      UINT16_C( 5420), UINT16_C(41059), UINT16_C(50522), UINT16_C(57541), UINT16_C(65146), UINT16_C(22226), UINT16_C(23735), UINT16_C(26301),
+      UINT16_C(14514), UINT16_C(21815), UINT16_C( 1545), UINT16_C(52158), UINT16_C(14773), UINT16_C(34342), UINT16_C(59424), UINT16_C(19514),
+      UINT16_C(40445), UINT16_C(22764), UINT16_C(45410), UINT16_C(56376), UINT16_C( 2736), UINT16_C(26419), UINT16_C(61542), UINT16_C( 6349),
+      UINT16_C( 1321), UINT16_C(12910), UINT16_C(11275), UINT16_C(49661), UINT16_C( 9062), UINT16_C(34375), UINT16_C(33035), UINT16_C( 2258),
+      UINT16_C(48671), UINT16_C(33120), UINT16_C(39280), UINT16_C( 8286), UINT16_C(37283), UINT16_C( 2695), UINT16_C(21889), UINT16_C(43554),
+      UINT16_C(36954), UINT16_C(26076), UINT16_C(55741), UINT16_C( 8998), UINT16_C(28156), UINT16_C( 1961), UINT16_C(31727), UINT16_C( 3600),
+      UINT16_C(28729), UINT16_C(43407), UINT16_C(60681), UINT16_C(44489), UINT16_C(20862), UINT16_C(  183), UINT16_C(55718), UINT16_C(  170),
+      UINT16_C(34666), UINT16_C(10085), UINT16_C(35936), UINT16_C(23882), UINT16_C(62457), UINT16_C(59492), UINT16_C(29806), UINT16_C(42998),
+      UINT16_C(34533), UINT16_C(61009), UINT16_C( 6771), UINT16_C(62107), UINT16_C(21099), UINT16_C( 4594), UINT16_C(39980), UINT16_C(38417),
+      UINT16_C(30499), UINT16_C(33981), UINT16_C( 1795), UINT16_C(64737), UINT16_C(17914), UINT16_C(26853), UINT16_C(56250), UINT16_C(40719),
+      UINT16_C(24673), UINT16_C(54669), UINT16_C(10619), UINT16_C(59079), UINT16_C(47483), UINT16_C(43000), UINT16_C( 2389), UINT16_C(31037),
+      UINT16_C(64128), UINT16_C(33789), UINT16_C(56833), UINT16_C(64384), UINT16_C(25891), UINT16_C(56675), UINT16_C(29504), UINT16_C(41596),
+      UINT16_C( 2771), UINT16_C(20087), UINT16_C(15923), UINT16_C(44597), UINT16_C(11767), UINT16_C(19542), UINT16_C(37686), UINT16_C(47045),
+      UINT16_C(49806), UINT16_C(36666), UINT16_C(47776), UINT16_C(50315), UINT16_C(60959), UINT16_C(24737), UINT16_C( 7777), UINT16_C(13570),
+      UINT16_C(31016), UINT16_C(23427), UINT16_C(47287), UINT16_C(44553), UINT16_C(24549), UINT16_C( 7418), UINT16_C(49395), UINT16_C(33235),
+      UINT16_C( 3458), UINT16_C( 8976), UINT16_C(39880), UINT16_C(59367), UINT16_C(34954), UINT16_C(60231), UINT16_C(18854), UINT16_C(52768),
+      UINT16_C(42178), UINT16_C(31017), UINT16_C(13148), UINT16_C(16935), UINT16_C( 8850), UINT16_C(34142), UINT16_C(12770), UINT16_C(25606),
+      UINT16_C( 5950), UINT16_C( 1671), UINT16_C(28338), UINT16_C(15598), UINT16_C(13815), UINT16_C(40232), UINT16_C(18559), UINT16_C(16748),
+      UINT16_C(38380), UINT16_C(18875), UINT16_C(58056), UINT16_C(23435), UINT16_C(59652), UINT16_C(59104), UINT16_C(59162), UINT16_C(22603),
+      UINT16_C(54014), UINT16_C(45151), UINT16_C(19777), UINT16_C(14573), UINT16_C( 5506), UINT16_C(  469), UINT16_C(16733), UINT16_C(19011),
+      UINT16_C(65239), UINT16_C(40851), UINT16_C( 7904), UINT16_C(58874), UINT16_C(56071), UINT16_C( 8651), UINT16_C( 5826), UINT16_C(49273),
+      UINT16_C(55529), UINT16_C(10864), UINT16_C(23845), UINT16_C(43106), UINT16_C(14194), UINT16_C(53417), UINT16_C(60537), UINT16_C(20506),
+      UINT16_C(44522), UINT16_C(52207), UINT16_C(60107), UINT16_C(53936), UINT16_C(31685), UINT16_C(34803), UINT16_C(27794), UINT16_C(31559),
+      UINT16_C(46917), UINT16_C(27301), UINT16_C( 1813), UINT16_C(34578), UINT16_C(48190), UINT16_C(46935), UINT16_C(29096), UINT16_C(37639),
+      UINT16_C(63262), UINT16_C(59742), UINT16_C( 3809), UINT16_C(42683), UINT16_C(44681), UINT16_C( 6957), UINT16_C(29723), UINT16_C(24726),
+      UINT16_C(15147), UINT16_C(16586), UINT16_C(56642), UINT16_C(33224), UINT16_C( 8089), UINT16_C(16696), UINT16_C(16529), UINT16_C(45012),
+      UINT16_C(12855), UINT16_C( 6297), UINT16_C(21568), UINT16_C(51902), UINT16_C(60163), UINT16_C( 7909), UINT16_C(31839), UINT16_C(35454) };
+  static const uint16_t e[] =
+    { UINT16_C(16124), UINT16_C(35250), UINT16_C( 8784), UINT16_C(14016), UINT16_C( 3826), UINT16_C(59710), UINT16_C( 1982), UINT16_C(35757),
+      UINT16_C( 1841), UINT16_C(20545), UINT16_C(18494), UINT16_C( 7752), UINT16_C( 6585), UINT16_C(27710), UINT16_C(11591), UINT16_C(24732),
+      UINT16_C(35486), UINT16_C(64364), UINT16_C(10067), UINT16_C(40740), UINT16_C(49212), UINT16_C(28049), UINT16_C(15983), UINT16_C( 3436),
+      UINT16_C(51444), UINT16_C(14012), UINT16_C(21890), UINT16_C(29299), UINT16_C(45465), UINT16_C(32990), UINT16_C(49571), UINT16_C( 7626),
+      UINT16_C(53334), UINT16_C( 7180), UINT16_C(12390), UINT16_C(41659), UINT16_C(19697), UINT16_C( 5720), UINT16_C(50663), UINT16_C(14365),
+      UINT16_C(57229), UINT16_C(18194), UINT16_C(12415), UINT16_C(63929), UINT16_C(38966), UINT16_C(  525), UINT16_C(55253), UINT16_C(17439),
+      UINT16_C(31918), UINT16_C(30048), UINT16_C( 7260), UINT16_C( 7279), UINT16_C(51121), UINT16_C(39218), UINT16_C(21900), UINT16_C( 6772),
+      UINT16_C(34357), UINT16_C(29492), UINT16_C( 6667), UINT16_C(  790), UINT16_C( 1970), UINT16_C( 3100), UINT16_C( 9466), UINT16_C( 2792),
+      UINT16_C( 5446), UINT16_C(10296), UINT16_C(42956), UINT16_C(32324), UINT16_C(30319), UINT16_C(60864), UINT16_C(35787), UINT16_C(   21),
+      UINT16_C(30226), UINT16_C( 7573), UINT16_C( 8849), UINT16_C(17247), UINT16_C(31529), UINT16_C( 3040), UINT16_C( 2885), UINT16_C(14613),
+      UINT16_C(55585), UINT16_C(60851), UINT16_C(63360), UINT16_C(61291), UINT16_C(  644), UINT16_C(14571), UINT16_C(   14), UINT16_C( 8249),
+      UINT16_C(52855), UINT16_C( 2109), UINT16_C(40432), UINT16_C( 6731), UINT16_C(39704), UINT16_C(21304), UINT16_C(19736), UINT16_C(51176),
+      UINT16_C(29154), UINT16_C( 8885), UINT16_C( 8338), UINT16_C(65297), UINT16_C(64675), UINT16_C(45368), UINT16_C( 7937), UINT16_C(29905),
+      UINT16_C( 3647), UINT16_C(12156), UINT16_C(51115), UINT16_C(50249), UINT16_C(29026), UINT16_C( 2337), UINT16_C( 2618), UINT16_C(  509),
+      UINT16_C(34213), UINT16_C(14589), UINT16_C( 1403), UINT16_C(18743), UINT16_C(10195), UINT16_C( 2298), UINT16_C( 9798), UINT16_C( 8060),
+      UINT16_C(63705), UINT16_C(34127), UINT16_C(39104), UINT16_C( 8777), UINT16_C(27146), UINT16_C(17451), UINT16_C(36999), UINT16_C( 6687),
+      UINT16_C( 7553), UINT16_C(10066), UINT16_C(35116), UINT16_C(14192), UINT16_C(27385), UINT16_C( 8518), UINT16_C(48181), UINT16_C( 4089),
+      UINT16_C(18613), UINT16_C(30100), UINT16_C(56800), UINT16_C(60055), UINT16_C(49991), UINT16_C(40517), UINT16_C(20159), UINT16_C(16598),
+      UINT16_C(10347), UINT16_C( 2349), UINT16_C(55473), UINT16_C(17787), UINT16_C( 3651), UINT16_C(30852), UINT16_C(32203), UINT16_C(32903),
+      UINT16_C( 7109), UINT16_C( 9622), UINT16_C(36088), UINT16_C(16528), UINT16_C(48719), UINT16_C( 3836), UINT16_C(53772), UINT16_C(24699),
+      UINT16_C(47098), UINT16_C(43790), UINT16_C(56719), UINT16_C(53846), UINT16_C(56043), UINT16_C(18937), UINT16_C( 4449), UINT16_C( 7222),
+      UINT16_C(11246), UINT16_C(59073), UINT16_C(15307), UINT16_C( 1830), UINT16_C( 8720), UINT16_C( 7190), UINT16_C(26100), UINT16_C(61076),
+      UINT16_C(41500), UINT16_C(43930), UINT16_C( 1030), UINT16_C(27518), UINT16_C(37191), UINT16_C( 8481), UINT16_C(22683), UINT16_C(35133),
+      UINT16_C(65155), UINT16_C(15216), UINT16_C(38480), UINT16_C(24643), UINT16_C(22969), UINT16_C(44412), UINT16_C( 4286), UINT16_C(13787),
+      UINT16_C(14003), UINT16_C( 2958), UINT16_C(  806), UINT16_C(61597), UINT16_C(44472), UINT16_C(26641), UINT16_C(19991), UINT16_C(24331),
+      UINT16_C(24908), UINT16_C(40150), UINT16_C( 2078), UINT16_C( 1365), UINT16_C(31090), UINT16_C(12382), UINT16_C(64137), UINT16_C(15370),
+      UINT16_C(25389), UINT16_C(13174), UINT16_C( 3219), UINT16_C(24390), UINT16_C(22475), UINT16_C(58012), UINT16_C(42828), UINT16_C(62077),
+      UINT16_C(21274), UINT16_C( 4750), UINT16_C(35692), UINT16_C(57027), UINT16_C( 8708), UINT16_C( 5459), UINT16_C( 6172), UINT16_C(19914),
+      UINT16_C(14759), UINT16_C(15011), UINT16_C(19747), UINT16_C( 4506), UINT16_C(24897), UINT16_C( 4832), UINT16_C( 8601), UINT16_C(13785),
+      UINT16_C(17892), UINT16_C(12103), UINT16_C( 3058), UINT16_C(62989), UINT16_C( 6957), UINT16_C(18820), UINT16_C(20019), UINT16_C(26506),
+      UINT16_C(14983), UINT16_C(52245), UINT16_C(44836), UINT16_C(26077), UINT16_C(53521), UINT16_C(11084), UINT16_C( 9537), UINT16_C( 1376),
+      UINT16_C( 5420), UINT16_C(32564), UINT16_C(17075), UINT16_C(57462), UINT16_C(64093), UINT16_C(22226), UINT16_C(49224), UINT16_C(26301),
+      UINT16_C(33274), UINT16_C( 7835), UINT16_C(31025), UINT16_C(17027), UINT16_C(53322), UINT16_C(34342), UINT16_C(52981), UINT16_C(19514),
+      UINT16_C(50550), UINT16_C(10498), UINT16_C(30727), UINT16_C(25609), UINT16_C(12914), UINT16_C(47861), UINT16_C(25074), UINT16_C( 6349),
+      UINT16_C( 9443), UINT16_C( 5130), UINT16_C(36509), UINT16_C(49661), UINT16_C(50014), UINT16_C(21363), UINT16_C(  913), UINT16_C( 2006),
+      UINT16_C(48671), UINT16_C(33120), UINT16_C(14672), UINT16_C(49716), UINT16_C(10604), UINT16_C( 2695), UINT16_C( 1419), UINT16_C(28235),
+      UINT16_C(21801), UINT16_C(51074), UINT16_C(55523), UINT16_C(16814), UINT16_C( 8603), UINT16_C( 1961), UINT16_C(27429), UINT16_C(60724),
+      UINT16_C(25923), UINT16_C(37821), UINT16_C(60681), UINT16_C( 2645), UINT16_C(20862), UINT16_C(  183), UINT16_C(46294), UINT16_C(65299),
+      UINT16_C(34666), UINT16_C(10085), UINT16_C(30061), UINT16_C( 2350), UINT16_C(50070), UINT16_C(47926), UINT16_C(27182), UINT16_C(29097),
+      UINT16_C(26319), UINT16_C(28164), UINT16_C( 6771), UINT16_C(29048), UINT16_C(21099), UINT16_C(   23), UINT16_C(10901), UINT16_C(38417),
+      UINT16_C(30499), UINT16_C(11660), UINT16_C(47675), UINT16_C(53814), UINT16_C(17914), UINT16_C(44173), UINT16_C(14039), UINT16_C(40719),
+      UINT16_C( 8860), UINT16_C(54669), UINT16_C(10619), UINT16_C(42597), UINT16_C(31854), UINT16_C( 1191), UINT16_C(42918), UINT16_C(26275),
+      UINT16_C(12141), UINT16_C(43412), UINT16_C(51945), UINT16_C(26491), UINT16_C( 2103), UINT16_C( 3604), UINT16_C(12863), UINT16_C(41596),
+      UINT16_C( 2771), UINT16_C(20087), UINT16_C(13398), UINT16_C(50295), UINT16_C( 7856), UINT16_C(19542), UINT16_C(27589), UINT16_C(12989),
+      UINT16_C(20890), UINT16_C(34011), UINT16_C(22043), UINT16_C(21227), UINT16_C(60959), UINT16_C(40544), UINT16_C( 5425), UINT16_C(13570),
+      UINT16_C(18654), UINT16_C(13398), UINT16_C(47287), UINT16_C(11512), UINT16_C(24549), UINT16_C( 7418), UINT16_C(16428), UINT16_C(33235),
+      UINT16_C(48785), UINT16_C( 8976), UINT16_C(13845), UINT16_C(29951), UINT16_C(24374), UINT16_C(26386), UINT16_C(18854), UINT16_C(21229),
+      UINT16_C(17620), UINT16_C(20614), UINT16_C(13148), UINT16_C(16935), UINT16_C(   64), UINT16_C(27821), UINT16_C(36928), UINT16_C(25606),
+      UINT16_C(32335), UINT16_C( 1671), UINT16_C(31925), UINT16_C(60376), UINT16_C(60124), UINT16_C(20562), UINT16_C(16501), UINT16_C(16748),
+      UINT16_C(10628), UINT16_C(18875), UINT16_C( 6056), UINT16_C(23435), UINT16_C(16407), UINT16_C(22357), UINT16_C(35024), UINT16_C( 7976),
+      UINT16_C(42247), UINT16_C(45151), UINT16_C(19777), UINT16_C(14573), UINT16_C(63813), UINT16_C(47950), UINT16_C(16733), UINT16_C(48388),
+      UINT16_C(40475), UINT16_C(40851), UINT16_C( 7904), UINT16_C(52396), UINT16_C(  293), UINT16_C( 8651), UINT16_C(19337), UINT16_C(36885),
+      UINT16_C(39409), UINT16_C( 4940), UINT16_C(62452), UINT16_C(14865), UINT16_C(24557), UINT16_C( 9973), UINT16_C(60537), UINT16_C(20506),
+      UINT16_C(14232), UINT16_C(19759), UINT16_C(56092), UINT16_C(16922), UINT16_C(15836), UINT16_C(26168), UINT16_C(19849), UINT16_C(31478),
+      UINT16_C(17382), UINT16_C(56205), UINT16_C( 1813), UINT16_C( 8981), UINT16_C( 2813), UINT16_C(20042), UINT16_C(11779), UINT16_C(39866),
+      UINT16_C(60005), UINT16_C(33257), UINT16_C(  965), UINT16_C(41667), UINT16_C(64320), UINT16_C( 6957), UINT16_C(65097), UINT16_C(12099),
+      UINT16_C(53313), UINT16_C(16586), UINT16_C( 8046), UINT16_C(27803), UINT16_C( 8089), UINT16_C(11706), UINT16_C(16529), UINT16_C(30920),
+      UINT16_C(12855), UINT16_C( 9466), UINT16_C(48564), UINT16_C(51902), UINT16_C(52921), UINT16_C(  702), UINT16_C(  717), UINT16_C( 3633) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_u16_m(pv, av, bv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+
+    ev = simde_svmin_u16_m(pv, av, bv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C( 316384300), UINT32_C(3125119153), UINT32_C(1003558781), UINT32_C(4119725364), UINT32_C(2465669270), UINT32_C(2721685349), UINT32_C(2798862585), UINT32_C(2957169795),
+      UINT32_C( 700587384), UINT32_C( 602081189), UINT32_C(1398715422), UINT32_C(1346956474), UINT32_C(1927429901), UINT32_C(3608419294), UINT32_C(3749570652), UINT32_C( 898613436),
+      UINT32_C(2203996637), UINT32_C(2007384665), UINT32_C(2966029558), UINT32_C(4261417713), UINT32_C( 795927377), UINT32_C(1510376958), UINT32_C( 691700845), UINT32_C( 559860036),
+      UINT32_C(1956953371), UINT32_C(4125838079), UINT32_C(1084667471), UINT32_C( 440313544), UINT32_C(2286530185), UINT32_C(2699186227), UINT32_C( 415898836), UINT32_C(  20523238),
+      UINT32_C(3832930021), UINT32_C(2010800168), UINT32_C(3753345046), UINT32_C(2969171238), UINT32_C(3610788516), UINT32_C(1719147154), UINT32_C( 494813751), UINT32_C(1344190570),
+      UINT32_C(3191116694), UINT32_C( 171314931), UINT32_C(3052006798), UINT32_C(2271601379), UINT32_C(3076431140), UINT32_C(3994932919), UINT32_C(2198576152), UINT32_C(3939707220),
+      UINT32_C(2963802044), UINT32_C(2763709974), UINT32_C(2941887436), UINT32_C(2838937221), UINT32_C( 325096539), UINT32_C(2197913195), UINT32_C(1845890330), UINT32_C(4082686262),
+      UINT32_C(4154654945), UINT32_C(2879086047), UINT32_C(2237330688), UINT32_C( 254709939), UINT32_C(2401406756), UINT32_C( 655565581), UINT32_C(1737824560), UINT32_C(3562728947),
+      UINT32_C(3435920877), UINT32_C(1517774426), UINT32_C( 266326363), UINT32_C(2250116449), UINT32_C(2836742300), UINT32_C(2496669795), UINT32_C( 905667906), UINT32_C(1074353490),
+      UINT32_C(2886521938), UINT32_C(2517009466), UINT32_C(3081102677), UINT32_C(2403189746), UINT32_C(1714967043), UINT32_C(3187280251), UINT32_C(3253925230), UINT32_C(2617375562),
+      UINT32_C( 155717071), UINT32_C(3885977233), UINT32_C( 647906355), UINT32_C( 179690247), UINT32_C(2826038573), UINT32_C(1701145590), UINT32_C(2871416673), UINT32_C( 558376786),
+      UINT32_C(3324743732), UINT32_C( 313379551), UINT32_C( 372787983), UINT32_C(1394732326), UINT32_C(3522990811), UINT32_C(1580622333), UINT32_C( 185228473), UINT32_C(3089977987),
+      UINT32_C(3246282978), UINT32_C( 835988258), UINT32_C(2621967478), UINT32_C(3589237242), UINT32_C(4171688955), UINT32_C( 106421581), UINT32_C(3172032825), UINT32_C(2507488947),
+      UINT32_C(3109548950), UINT32_C(2498374430), UINT32_C( 825242167), UINT32_C(2516983707), UINT32_C(1485810955), UINT32_C(3277776522), UINT32_C(4202721095), UINT32_C(1150285230),
+      UINT32_C( 117303016), UINT32_C(1234888721), UINT32_C(3061500442), UINT32_C(4115431914), UINT32_C(3092110126), UINT32_C( 142322625), UINT32_C(3355638810), UINT32_C(3658322673),
+      UINT32_C(2329938552), UINT32_C( 231963634), UINT32_C( 801328453), UINT32_C(4230221774), UINT32_C(2897506795), UINT32_C( 934621212), UINT32_C( 503297836), UINT32_C(3270970441),
+      UINT32_C( 156030999), UINT32_C(2551586643), UINT32_C(1003018604), UINT32_C(3560434921), UINT32_C(2055269470), UINT32_C(1219573020), UINT32_C( 912634349), UINT32_C(3573046717),
+      UINT32_C(2296267829), UINT32_C(3491820643), UINT32_C(3071011022), UINT32_C( 864764629), UINT32_C(1252854574), UINT32_C( 781344577), UINT32_C(3445946384), UINT32_C(2325896533),
+      UINT32_C(  85098657), UINT32_C(1121268340), UINT32_C(4042907675), UINT32_C(1361282082), UINT32_C(3516649616), UINT32_C(1073688111), UINT32_C(2064474918), UINT32_C(1644539840),
+      UINT32_C(2741442351), UINT32_C(1692810313), UINT32_C(1045749532), UINT32_C(4103042916), UINT32_C(2009410376), UINT32_C(2142749785), UINT32_C(3908748327), UINT32_C(2722824051),
+      UINT32_C(1598402838), UINT32_C( 163851245), UINT32_C(1866930187), UINT32_C(3630421904), UINT32_C(1531914242), UINT32_C( 333055724), UINT32_C(1039914186), UINT32_C(3923723731),
+      UINT32_C(3813156342), UINT32_C(1542196304), UINT32_C(3049927717), UINT32_C( 227355915), UINT32_C(1097391189), UINT32_C(2908046051), UINT32_C(3924512790), UINT32_C(2362624662),
+      UINT32_C(1081088751), UINT32_C(1285250087), UINT32_C(2600560272), UINT32_C(3920137875), UINT32_C(1294602346), UINT32_C(1761312594), UINT32_C(1716643536), UINT32_C(2700223408),
+      UINT32_C(1709204030), UINT32_C(1337031615), UINT32_C(1978381025), UINT32_C(2858324800), UINT32_C(4143483044), UINT32_C(3630166792), UINT32_C(2302587097), UINT32_C( 304689364),
+      UINT32_C(1383532947), UINT32_C(1721837701), UINT32_C( 450596058), UINT32_C(3301194016), UINT32_C(3401235650), UINT32_C(2292324783), UINT32_C(2652037322), UINT32_C(2746235664),
+      UINT32_C(3405064005), UINT32_C( 691050319), UINT32_C(1128467491), UINT32_C( 117901125), UINT32_C(1943126724), UINT32_C(2784785371), UINT32_C(1682116179), UINT32_C(2382885705),
+      UINT32_C(1767439642), UINT32_C(3079834004), UINT32_C(3673937301), UINT32_C(2715943645), UINT32_C(2685711300), UINT32_C(2051346471), UINT32_C(1759414558), UINT32_C(2549540476),
+      UINT32_C(1996509155), UINT32_C(1831769048), UINT32_C(1162291560), UINT32_C(4041615660), UINT32_C(  76610525), UINT32_C( 712955403), UINT32_C(3683802463), UINT32_C( 645040195),
+      UINT32_C(2946331607), UINT32_C(1847380742) };
+  static const uint32_t b[] =
+    { UINT32_C(2513806911), UINT32_C(2314873564), UINT32_C(3841116216), UINT32_C(  58915568), UINT32_C( 912216320), UINT32_C(1032109277), UINT32_C(3007116729), UINT32_C(1819472685),
+      UINT32_C(1979861146), UINT32_C(2885680242), UINT32_C(3029332420), UINT32_C(3971420652), UINT32_C(1075975779), UINT32_C(2357110738), UINT32_C(3376396956), UINT32_C(1194767021),
+      UINT32_C(1824340218), UINT32_C(4162305332), UINT32_C(2595006382), UINT32_C( 461792184), UINT32_C(1281141114), UINT32_C(3973634640), UINT32_C(1102452884), UINT32_C(3297373386),
+      UINT32_C(1479558692), UINT32_C(2991605763), UINT32_C(2806840559), UINT32_C(3653489503), UINT32_C(3425050492), UINT32_C(2377711353), UINT32_C(3771624982), UINT32_C(2124699482),
+      UINT32_C(2715211166), UINT32_C( 206775837), UINT32_C(2192810018), UINT32_C(4015748723), UINT32_C(2394653077), UINT32_C(2518381440), UINT32_C(1014491874), UINT32_C(3753581377),
+      UINT32_C( 226595312), UINT32_C(3659125944), UINT32_C(3881618804), UINT32_C(3654727747), UINT32_C(3110572345), UINT32_C(3880813317), UINT32_C(2921580397), UINT32_C(3549355746),
+      UINT32_C( 685772656), UINT32_C(1476590307), UINT32_C( 171925447), UINT32_C(1357059607), UINT32_C(2886355879), UINT32_C( 999512782), UINT32_C(  65648417), UINT32_C(  97941397),
+      UINT32_C(1781380998), UINT32_C(2025992369), UINT32_C(2793537935), UINT32_C(3220596247), UINT32_C(2137718961), UINT32_C(2075852634), UINT32_C(1266656182), UINT32_C(2706461979),
+      UINT32_C(3171646988), UINT32_C(1026936238), UINT32_C(3873683663), UINT32_C(3483752990), UINT32_C( 894308826), UINT32_C(3333425168), UINT32_C(3323015083), UINT32_C(2439537285),
+      UINT32_C(2404348897), UINT32_C( 281904193), UINT32_C(1526116412), UINT32_C(1697225866), UINT32_C(3181017005), UINT32_C( 730024575), UINT32_C(4294022266), UINT32_C(3633338871),
+      UINT32_C( 241688525), UINT32_C(2686334052), UINT32_C(1878725861), UINT32_C(1574184112), UINT32_C( 454717084), UINT32_C( 860265913), UINT32_C( 691157042), UINT32_C(1577173649),
+      UINT32_C( 107767970), UINT32_C(2191952541), UINT32_C(1341235615), UINT32_C(1655555782), UINT32_C(3984443188), UINT32_C(2535507045), UINT32_C(2378191612), UINT32_C(3085746453),
+      UINT32_C(3334297641), UINT32_C(2185782243), UINT32_C(3419486725), UINT32_C( 875396608), UINT32_C(2871175750), UINT32_C(1782727278), UINT32_C(2868380309), UINT32_C(3965838531),
+      UINT32_C( 531832380), UINT32_C(2258762625), UINT32_C( 894530357), UINT32_C( 929726193), UINT32_C(2548206633), UINT32_C(1661084878), UINT32_C(3910007334), UINT32_C( 450260702),
+      UINT32_C( 238717324), UINT32_C(3130317700), UINT32_C(1089463886), UINT32_C(2373409124), UINT32_C(3022346981), UINT32_C(2769758078), UINT32_C(4287505697), UINT32_C( 538535059),
+      UINT32_C(1915638765), UINT32_C(2100085295), UINT32_C( 230497192), UINT32_C(1520055669), UINT32_C( 219070351), UINT32_C( 129115878), UINT32_C(3724951883), UINT32_C(2482905253),
+      UINT32_C(2718248051), UINT32_C(2535469551), UINT32_C(3248807244), UINT32_C(2702982930), UINT32_C(3853462270), UINT32_C(2615959888), UINT32_C(1216017314), UINT32_C(2262530067),
+      UINT32_C(2485772453), UINT32_C(1563117841), UINT32_C( 958386214), UINT32_C( 232405775), UINT32_C(3069348197), UINT32_C(2370953195), UINT32_C(3855993810), UINT32_C(3916148804),
+      UINT32_C(2709361808), UINT32_C(  83863773), UINT32_C(2268929656), UINT32_C(3197441881), UINT32_C(2356447137), UINT32_C( 941213286), UINT32_C(3575508881), UINT32_C( 817793439),
+      UINT32_C(4224793373), UINT32_C(1560269028), UINT32_C(1206140142), UINT32_C(4094064979), UINT32_C(1736473088), UINT32_C(3533675072), UINT32_C( 682081673), UINT32_C(1666737734),
+      UINT32_C(2237541025), UINT32_C(3923926522), UINT32_C(3979396761), UINT32_C(1071724095), UINT32_C(4054213297), UINT32_C(2244167420), UINT32_C(1236101891), UINT32_C(1923876561),
+      UINT32_C( 720898864), UINT32_C(  34855528), UINT32_C(3756999840), UINT32_C( 723439738), UINT32_C( 773702962), UINT32_C( 246669323), UINT32_C( 475488587), UINT32_C(2542732135),
+      UINT32_C(2009171726), UINT32_C(  24761697), UINT32_C(2480957465), UINT32_C(1807744568), UINT32_C(3466190019), UINT32_C( 148655548), UINT32_C( 354694062), UINT32_C(1168945975),
+      UINT32_C(2612817210), UINT32_C(1536963906), UINT32_C(3606019229), UINT32_C(1044491899), UINT32_C(1175313034), UINT32_C(3578718503), UINT32_C(1424651037), UINT32_C(1637455398),
+      UINT32_C(1190942212), UINT32_C( 698521995), UINT32_C(2432667925), UINT32_C(3385802815), UINT32_C(1108335642), UINT32_C(3793182405), UINT32_C(4147512017), UINT32_C(2623066264),
+      UINT32_C(2984465702), UINT32_C(  64652782), UINT32_C(1435818262), UINT32_C( 874406681), UINT32_C(  74853695), UINT32_C(1558678923), UINT32_C( 676601231), UINT32_C( 331656429),
+      UINT32_C(4022707969), UINT32_C(1123262252), UINT32_C(2459404153), UINT32_C( 700888554), UINT32_C(1848458467), UINT32_C(1506481354), UINT32_C( 528555826), UINT32_C(3442689739),
+      UINT32_C( 448592109), UINT32_C( 274509719), UINT32_C( 547615798), UINT32_C(2353621417), UINT32_C(1895528358), UINT32_C(3184117387), UINT32_C(2967292901), UINT32_C(2122125457),
+      UINT32_C(2677553672), UINT32_C( 548468201) };
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(2314873564), UINT32_C(1003558781), UINT32_C(         0), UINT32_C(         0), UINT32_C(1032109277), UINT32_C(2798862585), UINT32_C(1819472685),
+      UINT32_C(         0), UINT32_C( 602081189), UINT32_C(         0), UINT32_C(1346956474), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 898613436),
+      UINT32_C(1824340218), UINT32_C(         0), UINT32_C(2595006382), UINT32_C( 461792184), UINT32_C( 795927377), UINT32_C(1510376958), UINT32_C(         0), UINT32_C( 559860036),
+      UINT32_C(1479558692), UINT32_C(         0), UINT32_C(1084667471), UINT32_C( 440313544), UINT32_C(2286530185), UINT32_C(2377711353), UINT32_C(         0), UINT32_C(  20523238),
+      UINT32_C(         0), UINT32_C( 206775837), UINT32_C(         0), UINT32_C(2969171238), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3052006798), UINT32_C(         0), UINT32_C(3076431140), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 685772656), UINT32_C(         0), UINT32_C(         0), UINT32_C(1357059607), UINT32_C( 325096539), UINT32_C(         0), UINT32_C(  65648417), UINT32_C(  97941397),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 254709939), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2706461979),
+      UINT32_C(3171646988), UINT32_C(1026936238), UINT32_C(         0), UINT32_C(         0), UINT32_C( 894308826), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(2404348897), UINT32_C( 281904193), UINT32_C(1526116412), UINT32_C(1697225866), UINT32_C(1714967043), UINT32_C(         0), UINT32_C(         0), UINT32_C(2617375562),
+      UINT32_C( 155717071), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 454717084), UINT32_C( 860265913), UINT32_C( 691157042), UINT32_C( 558376786),
+      UINT32_C( 107767970), UINT32_C( 313379551), UINT32_C( 372787983), UINT32_C(         0), UINT32_C(3522990811), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(3246282978), UINT32_C(         0), UINT32_C(2621967478), UINT32_C(         0), UINT32_C(         0), UINT32_C( 106421581), UINT32_C(         0), UINT32_C(2507488947),
+      UINT32_C(         0), UINT32_C(2258762625), UINT32_C( 825242167), UINT32_C(         0), UINT32_C(1485810955), UINT32_C(1661084878), UINT32_C(3910007334), UINT32_C( 450260702),
+      UINT32_C( 117303016), UINT32_C(         0), UINT32_C(         0), UINT32_C(2373409124), UINT32_C(3022346981), UINT32_C( 142322625), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(1915638765), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 129115878), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 156030999), UINT32_C(         0), UINT32_C(1003018604), UINT32_C(2702982930), UINT32_C(2055269470), UINT32_C(         0), UINT32_C(         0), UINT32_C(2262530067),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 232405775), UINT32_C(         0), UINT32_C( 781344577), UINT32_C(3445946384), UINT32_C(2325896533),
+      UINT32_C(  85098657), UINT32_C(         0), UINT32_C(2268929656), UINT32_C(1361282082), UINT32_C(         0), UINT32_C( 941213286), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1666737734),
+      UINT32_C(1598402838), UINT32_C( 163851245), UINT32_C(         0), UINT32_C(1071724095), UINT32_C(1531914242), UINT32_C( 333055724), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3049927717), UINT32_C(         0), UINT32_C( 773702962), UINT32_C( 246669323), UINT32_C( 475488587), UINT32_C(         0),
+      UINT32_C(1081088751), UINT32_C(         0), UINT32_C(2480957465), UINT32_C(         0), UINT32_C(1294602346), UINT32_C(         0), UINT32_C(         0), UINT32_C(1168945975),
+      UINT32_C(1709204030), UINT32_C(         0), UINT32_C(         0), UINT32_C(1044491899), UINT32_C(         0), UINT32_C(3578718503), UINT32_C(         0), UINT32_C( 304689364),
+      UINT32_C(         0), UINT32_C( 698521995), UINT32_C( 450596058), UINT32_C(3301194016), UINT32_C(1108335642), UINT32_C(2292324783), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1128467491), UINT32_C(         0), UINT32_C(  74853695), UINT32_C(1558678923), UINT32_C(         0), UINT32_C( 331656429),
+      UINT32_C(         0), UINT32_C(1123262252), UINT32_C(         0), UINT32_C(         0), UINT32_C(1848458467), UINT32_C(1506481354), UINT32_C( 528555826), UINT32_C(2549540476),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C( 547615798), UINT32_C(2353621417), UINT32_C(  76610525), UINT32_C( 712955403), UINT32_C(         0), UINT32_C( 645040195),
+      UINT32_C(         0), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_u32_z(pv, av, bv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+
+    ev = simde_svmin_u32_z(pv, av, bv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(3572773681), UINT32_C(3983932434), UINT32_C(2724091710), UINT32_C(1165419987), UINT32_C(2908497697), UINT32_C(3925635660), UINT32_C(1460606158), UINT32_C( 270771422),
+      UINT32_C(3924039639), UINT32_C(1373067539), UINT32_C(2230531504), UINT32_C(1019832602), UINT32_C(3706267024), UINT32_C(1724311192), UINT32_C(3653096954), UINT32_C(1357504633),
+      UINT32_C( 188403192), UINT32_C(3613200679), UINT32_C(1616597062), UINT32_C(1251747002), UINT32_C(3794241098), UINT32_C(1716055404), UINT32_C(1010763458), UINT32_C(3733727462),
+      UINT32_C( 501925622), UINT32_C( 502548439), UINT32_C(1367232663), UINT32_C(3197901428), UINT32_C( 211862432), UINT32_C(1920199088), UINT32_C(3584996079), UINT32_C(3518249947),
+      UINT32_C(3656293889), UINT32_C(2096554725), UINT32_C(2815325234), UINT32_C( 795175567), UINT32_C(3711698477), UINT32_C(3729764335), UINT32_C(1018429025), UINT32_C( 973956921),
+      UINT32_C(3927177989), UINT32_C( 275188446), UINT32_C( 230110590), UINT32_C(3426557343), UINT32_C( 313096483), UINT32_C(2314270760), UINT32_C( 801547254), UINT32_C( 275436299),
+      UINT32_C(2918940111), UINT32_C( 113074823), UINT32_C( 907244951), UINT32_C(3036827794), UINT32_C(4056394697), UINT32_C(2591799203), UINT32_C(1707688282), UINT32_C(3816174356),
+      UINT32_C( 948990385), UINT32_C(1782468307), UINT32_C(1436570307), UINT32_C(1812636322), UINT32_C(4032680269), UINT32_C(3800750216), UINT32_C( 776492057), UINT32_C( 940686983),
+      UINT32_C(  41001519), UINT32_C(3010244592), UINT32_C(2751990785), UINT32_C(4212134574), UINT32_C(1810591203), UINT32_C(1598912070), UINT32_C(1368233418), UINT32_C(2190122835),
+      UINT32_C( 830798657), UINT32_C(2900684970), UINT32_C(2857430268), UINT32_C(3785711870), UINT32_C( 323785165), UINT32_C(3514013959), UINT32_C(2183266351), UINT32_C(3758468255),
+      UINT32_C(1376881063), UINT32_C(1996420474), UINT32_C(3743502049), UINT32_C(2076231342), UINT32_C(1586433111), UINT32_C(3576627878), UINT32_C(2723631618), UINT32_C(2793561342),
+      UINT32_C(1626903782), UINT32_C(1809249929), UINT32_C(4064999236), UINT32_C( 359467966), UINT32_C(3178560535), UINT32_C(  26387454), UINT32_C(4104383221), UINT32_C( 748299590),
+      UINT32_C(1133286073), UINT32_C(3433980808), UINT32_C( 415168602), UINT32_C( 456010499), UINT32_C( 651731496), UINT32_C( 992439109), UINT32_C(2603600469), UINT32_C(2848508400),
+      UINT32_C(3823916123), UINT32_C( 313498295), UINT32_C(2519362963), UINT32_C(3232848024), UINT32_C(1088916218), UINT32_C(1249578741), UINT32_C(3387271897), UINT32_C(3463622003),
+      UINT32_C(3115409154), UINT32_C(2362138873), UINT32_C(1696855757), UINT32_C(1227281486), UINT32_C(1401490782), UINT32_C(4103930907), UINT32_C( 566068142), UINT32_C( 854536240),
+      UINT32_C(2297208975), UINT32_C(3440752384), UINT32_C(4231149741), UINT32_C(1799706636), UINT32_C(2176765541), UINT32_C(2155175122), UINT32_C( 262222815), UINT32_C(4064448611),
+      UINT32_C( 813313584), UINT32_C(2482868197), UINT32_C(3566153671), UINT32_C(3980383368), UINT32_C(1953430946), UINT32_C( 955573337), UINT32_C(2051577111), UINT32_C(1433176613),
+      UINT32_C(2642798264), UINT32_C(1026589302), UINT32_C( 957464497), UINT32_C( 891768979), UINT32_C(2812908878), UINT32_C(2430639481), UINT32_C(1460283442), UINT32_C(1789687474),
+      UINT32_C(3540463965), UINT32_C(1695561907), UINT32_C(2342396663), UINT32_C(3233858930), UINT32_C(3563612763), UINT32_C( 979716103), UINT32_C( 579956592), UINT32_C(1133264614),
+      UINT32_C( 588682095), UINT32_C(3280479947), UINT32_C(3142461000), UINT32_C(1199247084), UINT32_C(2149311352), UINT32_C(2612690987), UINT32_C(3602729968), UINT32_C(4179184009),
+      UINT32_C(2820419549), UINT32_C(2657854549), UINT32_C(3059333578), UINT32_C(1090376904), UINT32_C(3821017528), UINT32_C(2306833049), UINT32_C(1331641542), UINT32_C(1665693830),
+      UINT32_C(4245382311), UINT32_C(3550181128), UINT32_C(4169790512), UINT32_C(2151253960), UINT32_C( 962918816), UINT32_C( 985916276), UINT32_C(2777227807), UINT32_C(1107874459),
+      UINT32_C(1061098550), UINT32_C(3138574987), UINT32_C(2545195982), UINT32_C(3256347938), UINT32_C(1526496230), UINT32_C(2123677534), UINT32_C(2082676449), UINT32_C( 650063088),
+      UINT32_C(3412459072), UINT32_C(2810607577), UINT32_C( 893270547), UINT32_C( 251156007), UINT32_C( 812184785), UINT32_C(2494496179), UINT32_C( 185717019), UINT32_C(1026674941),
+      UINT32_C(2802358222), UINT32_C( 558862094), UINT32_C(4049046985), UINT32_C(3053408227), UINT32_C(4142229315), UINT32_C(2139788132), UINT32_C(1653250916), UINT32_C( 983546987),
+      UINT32_C(1642178643), UINT32_C(   8597559), UINT32_C(2716981950), UINT32_C(1817636905), UINT32_C(3160554328), UINT32_C( 859630798), UINT32_C(4086679176), UINT32_C(3576509570),
+      UINT32_C( 322375644), UINT32_C(4245994047), UINT32_C(3181315476), UINT32_C(1311372790) };
+  static const uint32_t b[] =
+    { UINT32_C( 479217938), UINT32_C(3159753886), UINT32_C(2481898910), UINT32_C(2738282488), UINT32_C(2890319870), UINT32_C( 475948602), UINT32_C(2175312934), UINT32_C( 584600336),
+      UINT32_C( 859728021), UINT32_C( 183473260), UINT32_C(1369300313), UINT32_C(3136607420), UINT32_C(3597024155), UINT32_C(3371353505), UINT32_C(2034867049), UINT32_C(2073829862),
+      UINT32_C(4121877129), UINT32_C(3372195183), UINT32_C( 907713914), UINT32_C( 217124465), UINT32_C(3957479241), UINT32_C(2259932444), UINT32_C(1459616880), UINT32_C(2815597342),
+      UINT32_C(3852304502), UINT32_C(2561514526), UINT32_C(2865743673), UINT32_C( 532136150), UINT32_C( 873109783), UINT32_C(3736780142), UINT32_C(3627399610), UINT32_C(3414099797),
+      UINT32_C(2779782279), UINT32_C(4064173497), UINT32_C(4221373733), UINT32_C(3826930893), UINT32_C(1545086445), UINT32_C(2621100770), UINT32_C(3782504332), UINT32_C(4272747638),
+      UINT32_C(3382926352), UINT32_C(3736920505), UINT32_C(3151583726), UINT32_C(2594239661), UINT32_C(4227250201), UINT32_C( 395850123), UINT32_C( 402132128), UINT32_C( 286630912),
+      UINT32_C(3118118912), UINT32_C(2291701402), UINT32_C(2621731311), UINT32_C(2117592165), UINT32_C( 662318492), UINT32_C(4282258014), UINT32_C( 521549342), UINT32_C(3660590042),
+      UINT32_C(2106854115), UINT32_C(2416323745), UINT32_C(  53299869), UINT32_C(3397477422), UINT32_C(4042455953), UINT32_C( 753872909), UINT32_C(1095435623), UINT32_C( 320633648),
+      UINT32_C( 647082117), UINT32_C(2042075100), UINT32_C( 259843297), UINT32_C(3654942280), UINT32_C( 130665465), UINT32_C(1664334076), UINT32_C(3986980541), UINT32_C(2114044153),
+      UINT32_C(1285919344), UINT32_C( 180771881), UINT32_C(2283356736), UINT32_C( 979497536), UINT32_C(3124833214), UINT32_C(2703062243), UINT32_C(3952001522), UINT32_C(4067004290),
+      UINT32_C(1245646369), UINT32_C(2857633130), UINT32_C(2285006151), UINT32_C( 516068448), UINT32_C(2732065727), UINT32_C(1766061431), UINT32_C( 945083062), UINT32_C(2200681825),
+      UINT32_C( 919431884), UINT32_C(3068207727), UINT32_C(4013822863), UINT32_C(1712128167), UINT32_C(2047468803), UINT32_C(2447592666), UINT32_C(2160670494), UINT32_C(3238262005),
+      UINT32_C(3455570014), UINT32_C(2189744370), UINT32_C(2473706220), UINT32_C(3338305475), UINT32_C(1061225316), UINT32_C(1859134543), UINT32_C(1374591324), UINT32_C(3960664462),
+      UINT32_C(3032091073), UINT32_C(3459661538), UINT32_C(3277956864), UINT32_C(2341100326), UINT32_C(2932525918), UINT32_C(1260165871), UINT32_C(3248228915), UINT32_C(3165564667),
+      UINT32_C(2591058104), UINT32_C(2791876262), UINT32_C(1953155406), UINT32_C(2214589477), UINT32_C(2922498495), UINT32_C(2549763427), UINT32_C(1381537367), UINT32_C(4245620293),
+      UINT32_C( 345472878), UINT32_C(1958477606), UINT32_C(3991414216), UINT32_C(3631343641), UINT32_C( 361145009), UINT32_C(1202487536), UINT32_C(1553597463), UINT32_C(2035919115),
+      UINT32_C(1317990440), UINT32_C(3082963439), UINT32_C(2275781486), UINT32_C(1147082387), UINT32_C(2824463800), UINT32_C(2112882022), UINT32_C( 366578186), UINT32_C(1536045619),
+      UINT32_C( 296360994), UINT32_C(3553127525), UINT32_C(2858052887), UINT32_C(1022343555), UINT32_C(  98846879), UINT32_C(1484969038), UINT32_C(2439863134), UINT32_C(2951609229),
+      UINT32_C(2109773592), UINT32_C( 458328067), UINT32_C(2042997750), UINT32_C(  79017061), UINT32_C(1258920701), UINT32_C(3450047342), UINT32_C(1935544550), UINT32_C( 589449995),
+      UINT32_C(3869369058), UINT32_C(1610740330), UINT32_C(  47892125), UINT32_C(2013695867), UINT32_C(2562920233), UINT32_C(2154129050), UINT32_C(2180236150), UINT32_C(4054127887),
+      UINT32_C(1658275575), UINT32_C(3586316344), UINT32_C( 450403487), UINT32_C(1435688492), UINT32_C(2297255406), UINT32_C( 822694587), UINT32_C( 632486934), UINT32_C( 152459026),
+      UINT32_C(3580620445), UINT32_C(1705717446), UINT32_C(4135551946), UINT32_C(1330385249), UINT32_C( 567818598), UINT32_C(2723340684), UINT32_C(4022797789), UINT32_C(4210679132),
+      UINT32_C(2463065291), UINT32_C(1576499858), UINT32_C(1599305725), UINT32_C(4021198728), UINT32_C(1695581913), UINT32_C(1158112103), UINT32_C(3291795048), UINT32_C(2008952235),
+      UINT32_C( 604606098), UINT32_C( 109117448), UINT32_C(   6673783), UINT32_C(1307513716), UINT32_C(  28508058), UINT32_C(3393632610), UINT32_C( 865041287), UINT32_C( 984239528),
+      UINT32_C(3831477211), UINT32_C( 736813235), UINT32_C( 707481525), UINT32_C(4235663970), UINT32_C(2097031705), UINT32_C(1799767267), UINT32_C(1755239871), UINT32_C(4272048163),
+      UINT32_C(2934047227), UINT32_C(2547633378), UINT32_C(2126578715), UINT32_C( 947534110), UINT32_C(1186232419), UINT32_C(2092038845), UINT32_C(4091826128), UINT32_C(2465302423),
+      UINT32_C(1782699144), UINT32_C(3154254496), UINT32_C(1027261215), UINT32_C(1601549564) };
+  static const uint32_t e[] =
+    { UINT32_C(3572773681), UINT32_C(3159753886), UINT32_C(2481898910), UINT32_C(1165419987), UINT32_C(2890319870), UINT32_C(3925635660), UINT32_C(1460606158), UINT32_C( 270771422),
+      UINT32_C( 859728021), UINT32_C(1373067539), UINT32_C(1369300313), UINT32_C(1019832602), UINT32_C(3706267024), UINT32_C(1724311192), UINT32_C(3653096954), UINT32_C(1357504633),
+      UINT32_C( 188403192), UINT32_C(3613200679), UINT32_C( 907713914), UINT32_C( 217124465), UINT32_C(3794241098), UINT32_C(1716055404), UINT32_C(1010763458), UINT32_C(3733727462),
+      UINT32_C( 501925622), UINT32_C( 502548439), UINT32_C(1367232663), UINT32_C(3197901428), UINT32_C( 211862432), UINT32_C(1920199088), UINT32_C(3584996079), UINT32_C(3518249947),
+      UINT32_C(3656293889), UINT32_C(2096554725), UINT32_C(2815325234), UINT32_C( 795175567), UINT32_C(3711698477), UINT32_C(2621100770), UINT32_C(1018429025), UINT32_C( 973956921),
+      UINT32_C(3382926352), UINT32_C( 275188446), UINT32_C( 230110590), UINT32_C(3426557343), UINT32_C( 313096483), UINT32_C(2314270760), UINT32_C( 801547254), UINT32_C( 275436299),
+      UINT32_C(2918940111), UINT32_C( 113074823), UINT32_C( 907244951), UINT32_C(3036827794), UINT32_C( 662318492), UINT32_C(2591799203), UINT32_C( 521549342), UINT32_C(3660590042),
+      UINT32_C( 948990385), UINT32_C(1782468307), UINT32_C(  53299869), UINT32_C(1812636322), UINT32_C(4032680269), UINT32_C( 753872909), UINT32_C( 776492057), UINT32_C( 320633648),
+      UINT32_C(  41001519), UINT32_C(3010244592), UINT32_C( 259843297), UINT32_C(3654942280), UINT32_C( 130665465), UINT32_C(1598912070), UINT32_C(1368233418), UINT32_C(2190122835),
+      UINT32_C( 830798657), UINT32_C( 180771881), UINT32_C(2857430268), UINT32_C(3785711870), UINT32_C( 323785165), UINT32_C(3514013959), UINT32_C(2183266351), UINT32_C(3758468255),
+      UINT32_C(1245646369), UINT32_C(1996420474), UINT32_C(2285006151), UINT32_C( 516068448), UINT32_C(1586433111), UINT32_C(1766061431), UINT32_C(2723631618), UINT32_C(2793561342),
+      UINT32_C(1626903782), UINT32_C(1809249929), UINT32_C(4064999236), UINT32_C( 359467966), UINT32_C(3178560535), UINT32_C(  26387454), UINT32_C(4104383221), UINT32_C( 748299590),
+      UINT32_C(1133286073), UINT32_C(2189744370), UINT32_C( 415168602), UINT32_C( 456010499), UINT32_C( 651731496), UINT32_C( 992439109), UINT32_C(1374591324), UINT32_C(2848508400),
+      UINT32_C(3823916123), UINT32_C( 313498295), UINT32_C(2519362963), UINT32_C(3232848024), UINT32_C(1088916218), UINT32_C(1249578741), UINT32_C(3387271897), UINT32_C(3463622003),
+      UINT32_C(2591058104), UINT32_C(2362138873), UINT32_C(1696855757), UINT32_C(1227281486), UINT32_C(1401490782), UINT32_C(4103930907), UINT32_C( 566068142), UINT32_C( 854536240),
+      UINT32_C( 345472878), UINT32_C(3440752384), UINT32_C(3991414216), UINT32_C(1799706636), UINT32_C( 361145009), UINT32_C(2155175122), UINT32_C( 262222815), UINT32_C(4064448611),
+      UINT32_C( 813313584), UINT32_C(2482868197), UINT32_C(2275781486), UINT32_C(1147082387), UINT32_C(1953430946), UINT32_C( 955573337), UINT32_C( 366578186), UINT32_C(1433176613),
+      UINT32_C(2642798264), UINT32_C(1026589302), UINT32_C( 957464497), UINT32_C( 891768979), UINT32_C(  98846879), UINT32_C(2430639481), UINT32_C(1460283442), UINT32_C(1789687474),
+      UINT32_C(2109773592), UINT32_C(1695561907), UINT32_C(2042997750), UINT32_C(3233858930), UINT32_C(3563612763), UINT32_C( 979716103), UINT32_C( 579956592), UINT32_C( 589449995),
+      UINT32_C( 588682095), UINT32_C(3280479947), UINT32_C(  47892125), UINT32_C(1199247084), UINT32_C(2149311352), UINT32_C(2154129050), UINT32_C(2180236150), UINT32_C(4054127887),
+      UINT32_C(1658275575), UINT32_C(2657854549), UINT32_C(3059333578), UINT32_C(1090376904), UINT32_C(2297255406), UINT32_C( 822694587), UINT32_C( 632486934), UINT32_C(1665693830),
+      UINT32_C(4245382311), UINT32_C(3550181128), UINT32_C(4135551946), UINT32_C(2151253960), UINT32_C( 962918816), UINT32_C( 985916276), UINT32_C(2777227807), UINT32_C(1107874459),
+      UINT32_C(1061098550), UINT32_C(3138574987), UINT32_C(1599305725), UINT32_C(3256347938), UINT32_C(1526496230), UINT32_C(1158112103), UINT32_C(2082676449), UINT32_C( 650063088),
+      UINT32_C(3412459072), UINT32_C( 109117448), UINT32_C( 893270547), UINT32_C( 251156007), UINT32_C( 812184785), UINT32_C(2494496179), UINT32_C( 185717019), UINT32_C( 984239528),
+      UINT32_C(2802358222), UINT32_C( 558862094), UINT32_C( 707481525), UINT32_C(3053408227), UINT32_C(4142229315), UINT32_C(1799767267), UINT32_C(1653250916), UINT32_C( 983546987),
+      UINT32_C(1642178643), UINT32_C(   8597559), UINT32_C(2716981950), UINT32_C(1817636905), UINT32_C(1186232419), UINT32_C( 859630798), UINT32_C(4086679176), UINT32_C(2465302423),
+      UINT32_C( 322375644), UINT32_C(4245994047), UINT32_C(1027261215), UINT32_C(1311372790) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_u32_m(pv, av, bv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+
+    ev = simde_svmin_u32_m(pv, av, bv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C( 6126989156178842556), UINT64_C(17415043256801940321), UINT64_C( 9417998840763816672), UINT64_C( 8522180188267322513),
+      UINT64_C(14641873545359784368), UINT64_C( 8770821407921205301), UINT64_C( 9322225763769875665), UINT64_C( 8790841516455357390),
+      UINT64_C(17403466679204600400), UINT64_C( 1624515528254557560), UINT64_C(  819183707409812204), UINT64_C( 1837350759815213374),
+      UINT64_C(15464332384116397550), UINT64_C(12880422227092723045), UINT64_C( 4955909053123375997), UINT64_C(15942965805101832799),
+      UINT64_C(15119749895240029088), UINT64_C(12533864312063376505), UINT64_C(14715843207701692654), UINT64_C(17245184914034558088),
+      UINT64_C( 8756335784277957448), UINT64_C( 2979880172946784126), UINT64_C( 8602816399751954985), UINT64_C(15283600355723466716),
+      UINT64_C( 5086266882789934877), UINT64_C( 2481288747953704715), UINT64_C(13868585343101013264), UINT64_C(14182967341329638772),
+      UINT64_C( 8294354426586553100), UINT64_C( 7989711601340583878), UINT64_C( 3052005369429531317), UINT64_C( 6320518729199928651),
+      UINT64_C(15362983461370238810), UINT64_C(14565895830924225879), UINT64_C(14191051851778265615), UINT64_C( 8333468115957848835),
+      UINT64_C( 8280264950609728004), UINT64_C(  159679820658605399), UINT64_C( 6636820794243062750), UINT64_C( 4783193609961460180),
+      UINT64_C( 6246563048657950243), UINT64_C(  122435171072071612), UINT64_C(  525357873909693077), UINT64_C( 7693087449307018563),
+      UINT64_C( 1531883962193418732), UINT64_C(10688017179657635119), UINT64_C( 6930138352155012081), UINT64_C( 7165970788256915906),
+      UINT64_C(11685592477817772734), UINT64_C( 6280349285791101077), UINT64_C( 4138993286884666099), UINT64_C(12944388719430947273),
+      UINT64_C( 1721489422384034254), UINT64_C( 1343150344782010341), UINT64_C(10389684252892602239), UINT64_C(17549528450066313443),
+      UINT64_C( 3602342371006895717), UINT64_C(18311672914476116718), UINT64_C(13373478491361919808), UINT64_C( 4731909766821079443),
+      UINT64_C(16497292325767667573), UINT64_C(15082013716959621329), UINT64_C(18006642988987007574), UINT64_C(  790765007681976027),
+      UINT64_C( 1879616537267740987), UINT64_C( 8183244051742066733), UINT64_C(13139957642042305019), UINT64_C(11715665175086238711),
+      UINT64_C( 5542778989771448712), UINT64_C(  755649322108540400), UINT64_C(10490789650986899716), UINT64_C(17643331387779843280),
+      UINT64_C( 9620164429643885590), UINT64_C( 3178992848470051845), UINT64_C( 2184705753364597030), UINT64_C( 4181080036521373607) };
+  static const uint64_t b[] =
+    { UINT64_C( 9091418387745991602), UINT64_C( 9004811489032449806), UINT64_C( 8425620218247128462), UINT64_C( 9321529628449293573),
+      UINT64_C(12465294846706608548), UINT64_C( 3612059132101992270), UINT64_C(17088829521157298369), UINT64_C( 9569450877805667964),
+      UINT64_C( 3330693264327197166), UINT64_C( 4320626026617167135), UINT64_C(17573070446154202890), UINT64_C( 8908132763630962749),
+      UINT64_C(13932518362980000588), UINT64_C( 3013604272945507356), UINT64_C( 1487028830271750456), UINT64_C( 4039115254816432133),
+      UINT64_C( 8059401896775193716), UINT64_C( 1095457548183952876), UINT64_C( 5874207170399981465), UINT64_C(18187207133569988160),
+      UINT64_C( 8486729522930240004), UINT64_C( 4408658602726837320), UINT64_C(10133155564431010819), UINT64_C( 8605286469159453673),
+      UINT64_C(12963493241601032168), UINT64_C( 2108529162306348897), UINT64_C(  992212642610082284), UINT64_C( 9545918840966053519),
+      UINT64_C( 4434036674170013545), UINT64_C( 5150857226298219075), UINT64_C( 9558685650983643254), UINT64_C( 8710806170291807683),
+      UINT64_C(17897539893128452167), UINT64_C(11516498268701238063), UINT64_C( 6499505253828350650), UINT64_C(   39860290463578374),
+      UINT64_C(16078559507510516340), UINT64_C(  355568085948266535), UINT64_C( 1116581585067649165), UINT64_C( 5213113189451184030),
+      UINT64_C( 2890065215111658636), UINT64_C( 5574163039583241228), UINT64_C(10567961454666976911), UINT64_C(  811564375799876904),
+      UINT64_C( 6117685208398935485), UINT64_C( 6121525239494696679), UINT64_C( 9194545414792898068), UINT64_C( 9434406547233604451),
+      UINT64_C( 9083802881529754995), UINT64_C(15392488518880443268), UINT64_C( 9535939148731157376), UINT64_C(  161939988431688185),
+      UINT64_C( 2999060510977916808), UINT64_C( 6781876635767587976), UINT64_C( 7656273786646756251), UINT64_C( 9434592592494306909),
+      UINT64_C(  195133049655176422), UINT64_C(15222565008036276228), UINT64_C( 7007828635580069733), UINT64_C(13110045372587009909),
+      UINT64_C(15520520128579080936), UINT64_C( 9091073409071886110), UINT64_C(18218912652083902578), UINT64_C( 5223994564044072187),
+      UINT64_C(15391066805123006702), UINT64_C(13786456677088449212), UINT64_C( 3931936300205451021), UINT64_C( 5104688720980802607),
+      UINT64_C( 5389576815440789823), UINT64_C( 6485027655943976690), UINT64_C( 8037376394980635673), UINT64_C( 5339815650212612988),
+      UINT64_C(12839493985764385111), UINT64_C(15683488560608071169), UINT64_C(10363828461422613541), UINT64_C(18417327362961297986) };
+  static const uint64_t e[] =
+    { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 3013604272945507356), UINT64_C(                   0), UINT64_C( 4039115254816432133),
+      UINT64_C( 8059401896775193716), UINT64_C( 1095457548183952876), UINT64_C( 5874207170399981465), UINT64_C(                   0),
+      UINT64_C( 8486729522930240004), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 5086266882789934877), UINT64_C( 2108529162306348897), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 4434036674170013545), UINT64_C(                   0), UINT64_C( 3052005369429531317), UINT64_C( 6320518729199928651),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(   39860290463578374),
+      UINT64_C( 8280264950609728004), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 4783193609961460180),
+      UINT64_C( 2890065215111658636), UINT64_C(  122435171072071612), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 1531883962193418732), UINT64_C(                   0), UINT64_C( 6930138352155012081), UINT64_C( 7165970788256915906),
+      UINT64_C( 9083802881529754995), UINT64_C( 6280349285791101077), UINT64_C( 4138993286884666099), UINT64_C(                   0),
+      UINT64_C( 1721489422384034254), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 9434592592494306909),
+      UINT64_C(  195133049655176422), UINT64_C(15222565008036276228), UINT64_C( 7007828635580069733), UINT64_C(                   0),
+      UINT64_C(15520520128579080936), UINT64_C(                   0), UINT64_C(18006642988987007574), UINT64_C(  790765007681976027),
+      UINT64_C(                   0), UINT64_C( 8183244051742066733), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(  755649322108540400), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 9620164429643885590), UINT64_C( 3178992848470051845), UINT64_C( 2184705753364597030), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_u64_z(pv, av, bv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+
+    ev = simde_svmin_u64_z(pv, av, bv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C(13792415960598823778), UINT64_C(18298307765403265917), UINT64_C( 9599497027889771267), UINT64_C(17316176253027480904),
+      UINT64_C( 4191441388922288941), UINT64_C( 8438889672281017385), UINT64_C( 8204836315208345000), UINT64_C( 3883049596742442597),
+      UINT64_C(11497632082803325336), UINT64_C( 3638867310342476951), UINT64_C( 9969112662674159295), UINT64_C( 6720322563634718469),
+      UINT64_C( 5111657793999528922), UINT64_C( 5229469206735466197), UINT64_C( 9886678284869049476), UINT64_C(17082956114755564272),
+      UINT64_C(15758707547436860605), UINT64_C( 6101758265580454364), UINT64_C( 6410367638911770344), UINT64_C( 2658565686435876325),
+      UINT64_C( 3225213198417273571), UINT64_C(12783536571350645828), UINT64_C( 9213260492055602972), UINT64_C(16946020687443126688),
+      UINT64_C( 4898392470638017662), UINT64_C(16576553729287228306), UINT64_C(15942538432655010086), UINT64_C(10457938955140904495),
+      UINT64_C( 2093991908226364877), UINT64_C( 5518742591269988069), UINT64_C( 8558330538606985388), UINT64_C( 9774729538900503042),
+      UINT64_C( 5003044397581010374), UINT64_C( 1457629612698035656), UINT64_C(10757061645835257483), UINT64_C(10209186221589722732),
+      UINT64_C( 3313044471316087381), UINT64_C(  337301002864291377), UINT64_C(15763476579307924379), UINT64_C( 1326785894723710229),
+      UINT64_C(14142360092360001458), UINT64_C( 5705231366092644016), UINT64_C( 3891462064148644792), UINT64_C( 7240798307118875309),
+      UINT64_C(13049951800377689282), UINT64_C( 4476309223992358941), UINT64_C( 9900712827199724558), UINT64_C(13222411224709560680),
+      UINT64_C(15379553827314006708), UINT64_C( 7449733720281861535), UINT64_C(10721098378937616226), UINT64_C(16078464383691242359),
+      UINT64_C(17633290555949133608), UINT64_C( 9445872653041228885), UINT64_C( 2450955091138751810), UINT64_C(  599173228464616005),
+      UINT64_C( 5127805509078477279), UINT64_C(   45048907431232251), UINT64_C( 3568948688848904889), UINT64_C(11893711693477451045),
+      UINT64_C(10454266056260909020), UINT64_C(14917133722232687174), UINT64_C(  922599002601649328), UINT64_C( 4555990684625170639),
+      UINT64_C( 6719408129153242136), UINT64_C(17010771151546347053), UINT64_C(14973718897323689434), UINT64_C( 1830886976352739526),
+      UINT64_C(14206334101405333170), UINT64_C(14492613215550736887), UINT64_C(14208672103725181280), UINT64_C(16524364756479284279),
+      UINT64_C( 1957612435564075724), UINT64_C(12472560070842856287), UINT64_C( 3520757148739805464), UINT64_C(17143157732051372753),
+      UINT64_C(14777574192892254165), UINT64_C(16981723801213232048), UINT64_C(14339144510410504405), UINT64_C(17922270579621783465),
+      UINT64_C( 4000609924470082122), UINT64_C(12260452766995292520), UINT64_C(12705910223546099864), UINT64_C( 2015417805997547230) };
+  static const uint64_t b[] =
+    { UINT64_C( 4071450470360565166), UINT64_C(12861158636437462839), UINT64_C( 5465663240437741843), UINT64_C(12277874695590122705),
+      UINT64_C(13755340742132814858), UINT64_C(14375119152156422440), UINT64_C( 8175693174623940968), UINT64_C(12510974080755031545),
+      UINT64_C(15636847212755544252), UINT64_C( 5361856287659602926), UINT64_C( 5974000001162179797), UINT64_C( 1231707372838677702),
+      UINT64_C(11194072552476799183), UINT64_C(17849073889917665160), UINT64_C(15620264791525632026), UINT64_C(14133800815202209472),
+      UINT64_C( 6273687790983346632), UINT64_C( 1060165551558577564), UINT64_C( 4001527947818312606), UINT64_C(16865823521631947094),
+      UINT64_C(10164748542474736619), UINT64_C(16627011960022291134), UINT64_C(16200888815250194726), UINT64_C( 9148002245813215720),
+      UINT64_C( 9443284006762665103), UINT64_C( 9460079699208460826), UINT64_C(16546497700164656949), UINT64_C(10820430301334850584),
+      UINT64_C(14087299946929086776), UINT64_C(16023365100524385662), UINT64_C(10317533953403027532), UINT64_C( 4298795808661905162),
+      UINT64_C( 6931525683662929605), UINT64_C( 1222334515871700590), UINT64_C(15861830524585284634), UINT64_C( 9648845381432073129),
+      UINT64_C( 5230691111369187412), UINT64_C( 9678330622155739772), UINT64_C(16039631876320111594), UINT64_C( 8059597370335856019),
+      UINT64_C( 7977067851882548626), UINT64_C( 6053681681945990159), UINT64_C(16554572874872002986), UINT64_C( 5384072837721507630),
+      UINT64_C(12195584628630117854), UINT64_C(10898190951560572543), UINT64_C( 2699402165045579584), UINT64_C(11492384431041064826),
+      UINT64_C( 2217934435153621892), UINT64_C( 5918088430780738461), UINT64_C( 4950118766443992981), UINT64_C(14657233576437162249),
+      UINT64_C( 2730501375592618023), UINT64_C(14411748823194987676), UINT64_C( 5077816539295900521), UINT64_C(  737315882238275368),
+      UINT64_C( 8214201600945694033), UINT64_C(16833082670385704608), UINT64_C( 2344005920723103747), UINT64_C( 6949558967015085955),
+      UINT64_C(10824182861947027952), UINT64_C( 8741210308320253926), UINT64_C( 9515051584954461428), UINT64_C( 6361434975491497176),
+      UINT64_C(11540849775639167389), UINT64_C(10132068468804457388), UINT64_C( 8018241973917341378), UINT64_C( 3017305701276397856),
+      UINT64_C(18409279674656816416), UINT64_C(10996875316246511737), UINT64_C(13266656279442166805), UINT64_C( 3713252056534905810),
+      UINT64_C(11848837765268325661), UINT64_C( 7383178051191083527), UINT64_C( 5023255709120450917), UINT64_C( 3740570541084702371),
+      UINT64_C( 9529918617217660530), UINT64_C(12420040771168826788), UINT64_C( 4855831059749302186), UINT64_C(12006845321380955991),
+      UINT64_C(18075624081465754584), UINT64_C(13793482315532287098), UINT64_C(14888126824526452411), UINT64_C( 5774418982769235527) };
+  static const uint64_t e[] =
+    { UINT64_C( 4071450470360565166), UINT64_C(12861158636437462839), UINT64_C( 9599497027889771267), UINT64_C(12277874695590122705),
+      UINT64_C( 4191441388922288941), UINT64_C( 8438889672281017385), UINT64_C( 8175693174623940968), UINT64_C( 3883049596742442597),
+      UINT64_C(11497632082803325336), UINT64_C( 3638867310342476951), UINT64_C( 9969112662674159295), UINT64_C( 6720322563634718469),
+      UINT64_C( 5111657793999528922), UINT64_C( 5229469206735466197), UINT64_C( 9886678284869049476), UINT64_C(14133800815202209472),
+      UINT64_C( 6273687790983346632), UINT64_C( 6101758265580454364), UINT64_C( 4001527947818312606), UINT64_C( 2658565686435876325),
+      UINT64_C( 3225213198417273571), UINT64_C(12783536571350645828), UINT64_C( 9213260492055602972), UINT64_C(16946020687443126688),
+      UINT64_C( 4898392470638017662), UINT64_C( 9460079699208460826), UINT64_C(15942538432655010086), UINT64_C(10457938955140904495),
+      UINT64_C( 2093991908226364877), UINT64_C( 5518742591269988069), UINT64_C( 8558330538606985388), UINT64_C( 4298795808661905162),
+      UINT64_C( 5003044397581010374), UINT64_C( 1457629612698035656), UINT64_C(10757061645835257483), UINT64_C(10209186221589722732),
+      UINT64_C( 3313044471316087381), UINT64_C(  337301002864291377), UINT64_C(15763476579307924379), UINT64_C( 1326785894723710229),
+      UINT64_C( 7977067851882548626), UINT64_C( 5705231366092644016), UINT64_C( 3891462064148644792), UINT64_C( 5384072837721507630),
+      UINT64_C(13049951800377689282), UINT64_C( 4476309223992358941), UINT64_C( 9900712827199724558), UINT64_C(13222411224709560680),
+      UINT64_C( 2217934435153621892), UINT64_C( 5918088430780738461), UINT64_C(10721098378937616226), UINT64_C(16078464383691242359),
+      UINT64_C(17633290555949133608), UINT64_C( 9445872653041228885), UINT64_C( 2450955091138751810), UINT64_C(  599173228464616005),
+      UINT64_C( 5127805509078477279), UINT64_C(   45048907431232251), UINT64_C( 3568948688848904889), UINT64_C( 6949558967015085955),
+      UINT64_C(10454266056260909020), UINT64_C( 8741210308320253926), UINT64_C(  922599002601649328), UINT64_C( 4555990684625170639),
+      UINT64_C( 6719408129153242136), UINT64_C(17010771151546347053), UINT64_C( 8018241973917341378), UINT64_C( 1830886976352739526),
+      UINT64_C(14206334101405333170), UINT64_C(14492613215550736887), UINT64_C(13266656279442166805), UINT64_C( 3713252056534905810),
+      UINT64_C( 1957612435564075724), UINT64_C( 7383178051191083527), UINT64_C( 3520757148739805464), UINT64_C( 3740570541084702371),
+      UINT64_C( 9529918617217660530), UINT64_C(12420040771168826788), UINT64_C(14339144510410504405), UINT64_C(17922270579621783465),
+      UINT64_C( 4000609924470082122), UINT64_C(12260452766995292520), UINT64_C(12705910223546099864), UINT64_C( 2015417805997547230) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_u64_m(pv, av, bv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+
+    ev = simde_svmin_u64_m(pv, av, bv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   473.50), SIMDE_FLOAT32_C(   358.39), SIMDE_FLOAT32_C(   268.07), SIMDE_FLOAT32_C(   704.48),
+      SIMDE_FLOAT32_C(  -942.38), SIMDE_FLOAT32_C(   606.27), SIMDE_FLOAT32_C(  -172.65), SIMDE_FLOAT32_C(  -126.84),
+      SIMDE_FLOAT32_C(  -392.98), SIMDE_FLOAT32_C(  -792.00), SIMDE_FLOAT32_C(    -0.98), SIMDE_FLOAT32_C(   822.87),
+      SIMDE_FLOAT32_C(   700.99), SIMDE_FLOAT32_C(  -208.49), SIMDE_FLOAT32_C(   833.49), SIMDE_FLOAT32_C(    33.04),
+      SIMDE_FLOAT32_C(   793.90), SIMDE_FLOAT32_C(  -215.99), SIMDE_FLOAT32_C(  -693.45), SIMDE_FLOAT32_C(  -981.70),
+      SIMDE_FLOAT32_C(   867.22), SIMDE_FLOAT32_C(   186.53), SIMDE_FLOAT32_C(   578.12), SIMDE_FLOAT32_C(   804.90),
+      SIMDE_FLOAT32_C(  -272.41), SIMDE_FLOAT32_C(    35.12), SIMDE_FLOAT32_C(  -346.41), SIMDE_FLOAT32_C(    18.85),
+      SIMDE_FLOAT32_C(   865.67), SIMDE_FLOAT32_C(   -36.52), SIMDE_FLOAT32_C(   585.38), SIMDE_FLOAT32_C(   339.17),
+      SIMDE_FLOAT32_C(  -678.13), SIMDE_FLOAT32_C(  -146.56), SIMDE_FLOAT32_C(    43.65), SIMDE_FLOAT32_C(  -620.51),
+      SIMDE_FLOAT32_C(  -540.29), SIMDE_FLOAT32_C(   871.00), SIMDE_FLOAT32_C(   252.66), SIMDE_FLOAT32_C(    66.73),
+      SIMDE_FLOAT32_C(  -921.00), SIMDE_FLOAT32_C(  -748.33), SIMDE_FLOAT32_C(  -110.40), SIMDE_FLOAT32_C(   779.99),
+      SIMDE_FLOAT32_C(    43.19), SIMDE_FLOAT32_C(  -276.91), SIMDE_FLOAT32_C(  -186.97), SIMDE_FLOAT32_C(  -162.92),
+      SIMDE_FLOAT32_C(   507.10), SIMDE_FLOAT32_C(   119.59), SIMDE_FLOAT32_C(  -144.62), SIMDE_FLOAT32_C(   374.33),
+      SIMDE_FLOAT32_C(  -693.88), SIMDE_FLOAT32_C(  -566.50), SIMDE_FLOAT32_C(   179.22), SIMDE_FLOAT32_C(    33.71),
+      SIMDE_FLOAT32_C(   468.63), SIMDE_FLOAT32_C(   832.81), SIMDE_FLOAT32_C(  -947.44), SIMDE_FLOAT32_C(   334.29),
+      SIMDE_FLOAT32_C(  -203.70), SIMDE_FLOAT32_C(   637.94), SIMDE_FLOAT32_C(  -326.54), SIMDE_FLOAT32_C(   118.17),
+      SIMDE_FLOAT32_C(  -508.62), SIMDE_FLOAT32_C(   717.11), SIMDE_FLOAT32_C(   497.66), SIMDE_FLOAT32_C(   -48.91),
+      SIMDE_FLOAT32_C(   588.11), SIMDE_FLOAT32_C(  -249.68), SIMDE_FLOAT32_C(  -982.18), SIMDE_FLOAT32_C(   667.12),
+      SIMDE_FLOAT32_C(     1.99), SIMDE_FLOAT32_C(   -92.57), SIMDE_FLOAT32_C(   447.11), SIMDE_FLOAT32_C(  -954.83),
+      SIMDE_FLOAT32_C(   630.52), SIMDE_FLOAT32_C(  -739.86), SIMDE_FLOAT32_C(  -117.74), SIMDE_FLOAT32_C(   137.63),
+      SIMDE_FLOAT32_C(   379.73), SIMDE_FLOAT32_C(   737.64), SIMDE_FLOAT32_C(  -488.05), SIMDE_FLOAT32_C(   685.85),
+      SIMDE_FLOAT32_C(  -828.86), SIMDE_FLOAT32_C(   691.17), SIMDE_FLOAT32_C(  -280.44), SIMDE_FLOAT32_C(   639.76),
+      SIMDE_FLOAT32_C(   523.98), SIMDE_FLOAT32_C(  -227.88), SIMDE_FLOAT32_C(   -25.94), SIMDE_FLOAT32_C(  -679.72),
+      SIMDE_FLOAT32_C(  -589.95), SIMDE_FLOAT32_C(   647.52), SIMDE_FLOAT32_C(   438.45), SIMDE_FLOAT32_C(   -98.56),
+      SIMDE_FLOAT32_C(   364.63), SIMDE_FLOAT32_C(   -63.89), SIMDE_FLOAT32_C(   852.53), SIMDE_FLOAT32_C(   -47.26),
+      SIMDE_FLOAT32_C(   686.42), SIMDE_FLOAT32_C(   870.35), SIMDE_FLOAT32_C(  -380.14), SIMDE_FLOAT32_C(  -311.59),
+      SIMDE_FLOAT32_C(  -222.22), SIMDE_FLOAT32_C(  -933.03), SIMDE_FLOAT32_C(  -266.41), SIMDE_FLOAT32_C(  -591.70),
+      SIMDE_FLOAT32_C(  -672.88), SIMDE_FLOAT32_C(   615.84), SIMDE_FLOAT32_C(   545.92), SIMDE_FLOAT32_C(   706.85),
+      SIMDE_FLOAT32_C(   353.48), SIMDE_FLOAT32_C(  -942.13), SIMDE_FLOAT32_C(   392.70), SIMDE_FLOAT32_C(   524.61),
+      SIMDE_FLOAT32_C(   749.05), SIMDE_FLOAT32_C(  -887.74), SIMDE_FLOAT32_C(   164.38), SIMDE_FLOAT32_C(   273.03),
+      SIMDE_FLOAT32_C(  -115.62), SIMDE_FLOAT32_C(  -861.56), SIMDE_FLOAT32_C(   593.31), SIMDE_FLOAT32_C(   294.44),
+      SIMDE_FLOAT32_C(   785.95), SIMDE_FLOAT32_C(    31.76), SIMDE_FLOAT32_C(  -804.13), SIMDE_FLOAT32_C(   150.58),
+      SIMDE_FLOAT32_C(   967.87), SIMDE_FLOAT32_C(  -951.60), SIMDE_FLOAT32_C(  -896.67), SIMDE_FLOAT32_C(   654.29),
+      SIMDE_FLOAT32_C(   918.75), SIMDE_FLOAT32_C(  -276.81), SIMDE_FLOAT32_C(  -657.30), SIMDE_FLOAT32_C(  -303.47),
+      SIMDE_FLOAT32_C(  -209.84), SIMDE_FLOAT32_C(    76.29), SIMDE_FLOAT32_C(   104.83), SIMDE_FLOAT32_C(   117.27),
+      SIMDE_FLOAT32_C(  -307.87), SIMDE_FLOAT32_C(  -349.25), SIMDE_FLOAT32_C(  -175.88), SIMDE_FLOAT32_C(  -954.39),
+      SIMDE_FLOAT32_C(  -291.38), SIMDE_FLOAT32_C(  -783.18), SIMDE_FLOAT32_C(   570.22), SIMDE_FLOAT32_C(  -542.33),
+      SIMDE_FLOAT32_C(  -670.91), SIMDE_FLOAT32_C(  -265.40), SIMDE_FLOAT32_C(   730.70), SIMDE_FLOAT32_C(   213.47),
+      SIMDE_FLOAT32_C(  -126.96), SIMDE_FLOAT32_C(   324.02), SIMDE_FLOAT32_C(  -492.10), SIMDE_FLOAT32_C(  -341.01),
+      SIMDE_FLOAT32_C(  -644.22), SIMDE_FLOAT32_C(  -296.23), SIMDE_FLOAT32_C(   809.57), SIMDE_FLOAT32_C(  -676.36),
+      SIMDE_FLOAT32_C(  -247.83), SIMDE_FLOAT32_C(   912.90), SIMDE_FLOAT32_C(   977.93), SIMDE_FLOAT32_C(  -329.08),
+      SIMDE_FLOAT32_C(  -363.91), SIMDE_FLOAT32_C(  -679.36), SIMDE_FLOAT32_C(   367.45), SIMDE_FLOAT32_C(   426.25),
+      SIMDE_FLOAT32_C(   396.93), SIMDE_FLOAT32_C(  -527.72), SIMDE_FLOAT32_C(  -456.48), SIMDE_FLOAT32_C(  -910.94),
+      SIMDE_FLOAT32_C(   123.03), SIMDE_FLOAT32_C(   367.64), SIMDE_FLOAT32_C(  -865.33), SIMDE_FLOAT32_C(   831.65),
+      SIMDE_FLOAT32_C(   584.46), SIMDE_FLOAT32_C(   704.89), SIMDE_FLOAT32_C(  -710.68), SIMDE_FLOAT32_C(   913.55),
+      SIMDE_FLOAT32_C(  -560.51), SIMDE_FLOAT32_C(  -979.98), SIMDE_FLOAT32_C(   127.01), SIMDE_FLOAT32_C(   312.52),
+      SIMDE_FLOAT32_C(   344.04), SIMDE_FLOAT32_C(   634.92), SIMDE_FLOAT32_C(   971.51), SIMDE_FLOAT32_C(   699.81),
+      SIMDE_FLOAT32_C(  -661.31), SIMDE_FLOAT32_C(   781.09), SIMDE_FLOAT32_C(  -976.54), SIMDE_FLOAT32_C(    90.87),
+      SIMDE_FLOAT32_C(   693.99), SIMDE_FLOAT32_C(  -998.61), SIMDE_FLOAT32_C(   761.79), SIMDE_FLOAT32_C(  -669.92),
+      SIMDE_FLOAT32_C(  -677.97), SIMDE_FLOAT32_C(   129.24), SIMDE_FLOAT32_C(   756.32), SIMDE_FLOAT32_C(   718.96),
+      SIMDE_FLOAT32_C(   601.52), SIMDE_FLOAT32_C(  -700.16), SIMDE_FLOAT32_C(   808.02), SIMDE_FLOAT32_C(  -275.45),
+      SIMDE_FLOAT32_C(   667.48), SIMDE_FLOAT32_C(   942.69) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(  -443.80), SIMDE_FLOAT32_C(   251.94), SIMDE_FLOAT32_C(   647.57), SIMDE_FLOAT32_C(  -154.48),
+      SIMDE_FLOAT32_C(   165.49), SIMDE_FLOAT32_C(  -912.94), SIMDE_FLOAT32_C(  -134.46), SIMDE_FLOAT32_C(  -707.50),
+      SIMDE_FLOAT32_C(   399.59), SIMDE_FLOAT32_C(  -790.42), SIMDE_FLOAT32_C(   927.42), SIMDE_FLOAT32_C(   371.10),
+      SIMDE_FLOAT32_C(   909.39), SIMDE_FLOAT32_C(  -733.89), SIMDE_FLOAT32_C(   152.19), SIMDE_FLOAT32_C(   932.85),
+      SIMDE_FLOAT32_C(   356.98), SIMDE_FLOAT32_C(  -153.82), SIMDE_FLOAT32_C(   934.24), SIMDE_FLOAT32_C(   118.77),
+      SIMDE_FLOAT32_C(   176.26), SIMDE_FLOAT32_C(  -743.72), SIMDE_FLOAT32_C(  -751.98), SIMDE_FLOAT32_C(   -67.42),
+      SIMDE_FLOAT32_C(   975.24), SIMDE_FLOAT32_C(   849.54), SIMDE_FLOAT32_C(   232.42), SIMDE_FLOAT32_C(   783.26),
+      SIMDE_FLOAT32_C(  -425.92), SIMDE_FLOAT32_C(  -100.10), SIMDE_FLOAT32_C(   725.94), SIMDE_FLOAT32_C(   130.28),
+      SIMDE_FLOAT32_C(  -848.16), SIMDE_FLOAT32_C(   373.52), SIMDE_FLOAT32_C(   975.80), SIMDE_FLOAT32_C(   317.33),
+      SIMDE_FLOAT32_C(   460.58), SIMDE_FLOAT32_C(  -158.66), SIMDE_FLOAT32_C(   609.83), SIMDE_FLOAT32_C(  -139.83),
+      SIMDE_FLOAT32_C(    50.92), SIMDE_FLOAT32_C(   537.26), SIMDE_FLOAT32_C(  -768.73), SIMDE_FLOAT32_C(   -39.68),
+      SIMDE_FLOAT32_C(   803.37), SIMDE_FLOAT32_C(   383.46), SIMDE_FLOAT32_C(  -106.83), SIMDE_FLOAT32_C(   160.35),
+      SIMDE_FLOAT32_C(  -770.36), SIMDE_FLOAT32_C(  -172.59), SIMDE_FLOAT32_C(  -720.87), SIMDE_FLOAT32_C(   405.90),
+      SIMDE_FLOAT32_C(    83.69), SIMDE_FLOAT32_C(  -472.86), SIMDE_FLOAT32_C(  -661.52), SIMDE_FLOAT32_C(    58.92),
+      SIMDE_FLOAT32_C(  -623.32), SIMDE_FLOAT32_C(   570.89), SIMDE_FLOAT32_C(  -157.82), SIMDE_FLOAT32_C(   -49.24),
+      SIMDE_FLOAT32_C(  -529.21), SIMDE_FLOAT32_C(  -431.88), SIMDE_FLOAT32_C(  -918.96), SIMDE_FLOAT32_C(  -377.37),
+      SIMDE_FLOAT32_C(   941.64), SIMDE_FLOAT32_C(  -943.16), SIMDE_FLOAT32_C(   939.96), SIMDE_FLOAT32_C(   402.22),
+      SIMDE_FLOAT32_C(  -101.82), SIMDE_FLOAT32_C(   549.79), SIMDE_FLOAT32_C(  -737.61), SIMDE_FLOAT32_C(   949.10),
+      SIMDE_FLOAT32_C(    87.05), SIMDE_FLOAT32_C(  -506.34), SIMDE_FLOAT32_C(   -90.58), SIMDE_FLOAT32_C(  -109.58),
+      SIMDE_FLOAT32_C(   877.12), SIMDE_FLOAT32_C(   802.59), SIMDE_FLOAT32_C(  -949.23), SIMDE_FLOAT32_C(  -893.24),
+      SIMDE_FLOAT32_C(  -370.00), SIMDE_FLOAT32_C(  -670.10), SIMDE_FLOAT32_C(   512.66), SIMDE_FLOAT32_C(   713.69),
+      SIMDE_FLOAT32_C(  -142.96), SIMDE_FLOAT32_C(   851.13), SIMDE_FLOAT32_C(  -227.39), SIMDE_FLOAT32_C(   233.72),
+      SIMDE_FLOAT32_C(   422.03), SIMDE_FLOAT32_C(   614.79), SIMDE_FLOAT32_C(  -815.52), SIMDE_FLOAT32_C(   892.82),
+      SIMDE_FLOAT32_C(  -817.09), SIMDE_FLOAT32_C(  -734.48), SIMDE_FLOAT32_C(  -484.55), SIMDE_FLOAT32_C(  -875.45),
+      SIMDE_FLOAT32_C(  -677.64), SIMDE_FLOAT32_C(  -544.59), SIMDE_FLOAT32_C(   526.77), SIMDE_FLOAT32_C(   220.55),
+      SIMDE_FLOAT32_C(  -994.80), SIMDE_FLOAT32_C(   789.15), SIMDE_FLOAT32_C(   169.65), SIMDE_FLOAT32_C(    92.25),
+      SIMDE_FLOAT32_C(  -717.19), SIMDE_FLOAT32_C(  -920.93), SIMDE_FLOAT32_C(   982.67), SIMDE_FLOAT32_C(  -840.07),
+      SIMDE_FLOAT32_C(   881.66), SIMDE_FLOAT32_C(  -966.56), SIMDE_FLOAT32_C(  -733.32), SIMDE_FLOAT32_C(  -488.34),
+      SIMDE_FLOAT32_C(  -636.66), SIMDE_FLOAT32_C(   779.34), SIMDE_FLOAT32_C(  -774.65), SIMDE_FLOAT32_C(   220.38),
+      SIMDE_FLOAT32_C(   630.47), SIMDE_FLOAT32_C(    -2.04), SIMDE_FLOAT32_C(  -545.91), SIMDE_FLOAT32_C(    52.50),
+      SIMDE_FLOAT32_C(  -387.25), SIMDE_FLOAT32_C(  -361.43), SIMDE_FLOAT32_C(   -54.69), SIMDE_FLOAT32_C(  -204.34),
+      SIMDE_FLOAT32_C(   -95.91), SIMDE_FLOAT32_C(   460.76), SIMDE_FLOAT32_C(   -79.79), SIMDE_FLOAT32_C(   226.46),
+      SIMDE_FLOAT32_C(   916.17), SIMDE_FLOAT32_C(  -553.03), SIMDE_FLOAT32_C(  -552.99), SIMDE_FLOAT32_C(   921.38),
+      SIMDE_FLOAT32_C(  -763.87), SIMDE_FLOAT32_C(   616.66), SIMDE_FLOAT32_C(    13.63), SIMDE_FLOAT32_C(  -481.06),
+      SIMDE_FLOAT32_C(   695.73), SIMDE_FLOAT32_C(    -3.70), SIMDE_FLOAT32_C(  -321.14), SIMDE_FLOAT32_C(   577.39),
+      SIMDE_FLOAT32_C(    29.74), SIMDE_FLOAT32_C(   -54.46), SIMDE_FLOAT32_C(  -910.94), SIMDE_FLOAT32_C(   393.08),
+      SIMDE_FLOAT32_C(  -275.12), SIMDE_FLOAT32_C(  -685.59), SIMDE_FLOAT32_C(  -386.55), SIMDE_FLOAT32_C(  -644.65),
+      SIMDE_FLOAT32_C(   312.37), SIMDE_FLOAT32_C(    67.55), SIMDE_FLOAT32_C(   407.85), SIMDE_FLOAT32_C(   925.12),
+      SIMDE_FLOAT32_C(   706.12), SIMDE_FLOAT32_C(  -646.84), SIMDE_FLOAT32_C(  -279.22), SIMDE_FLOAT32_C(  -389.78),
+      SIMDE_FLOAT32_C(   813.93), SIMDE_FLOAT32_C(   640.99), SIMDE_FLOAT32_C(   836.67), SIMDE_FLOAT32_C(   730.10),
+      SIMDE_FLOAT32_C(  -912.04), SIMDE_FLOAT32_C(  -716.32), SIMDE_FLOAT32_C(   651.47), SIMDE_FLOAT32_C(  -675.91),
+      SIMDE_FLOAT32_C(   900.34), SIMDE_FLOAT32_C(  -334.90), SIMDE_FLOAT32_C(  -156.98), SIMDE_FLOAT32_C(   596.07),
+      SIMDE_FLOAT32_C(   661.40), SIMDE_FLOAT32_C(   521.89), SIMDE_FLOAT32_C(   173.46), SIMDE_FLOAT32_C(  -308.86),
+      SIMDE_FLOAT32_C(  -532.57), SIMDE_FLOAT32_C(   262.52), SIMDE_FLOAT32_C(  -915.79), SIMDE_FLOAT32_C(   192.31),
+      SIMDE_FLOAT32_C(   576.93), SIMDE_FLOAT32_C(  -302.33), SIMDE_FLOAT32_C(   547.66), SIMDE_FLOAT32_C(  -110.71),
+      SIMDE_FLOAT32_C(   765.22), SIMDE_FLOAT32_C(   -44.49), SIMDE_FLOAT32_C(  -185.59), SIMDE_FLOAT32_C(   471.34),
+      SIMDE_FLOAT32_C(   308.68), SIMDE_FLOAT32_C(   535.19), SIMDE_FLOAT32_C(  -918.45), SIMDE_FLOAT32_C(   122.60),
+      SIMDE_FLOAT32_C(   176.18), SIMDE_FLOAT32_C(   918.23), SIMDE_FLOAT32_C(  -147.30), SIMDE_FLOAT32_C(   264.14),
+      SIMDE_FLOAT32_C(  -798.09), SIMDE_FLOAT32_C(  -495.82), SIMDE_FLOAT32_C(   588.23), SIMDE_FLOAT32_C(  -897.76),
+      SIMDE_FLOAT32_C(   169.28), SIMDE_FLOAT32_C(  -568.75), SIMDE_FLOAT32_C(   698.32), SIMDE_FLOAT32_C(  -169.32),
+      SIMDE_FLOAT32_C(   953.14), SIMDE_FLOAT32_C(  -128.22), SIMDE_FLOAT32_C(   521.81), SIMDE_FLOAT32_C(  -579.43),
+      SIMDE_FLOAT32_C(  -865.70), SIMDE_FLOAT32_C(   606.03) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  -443.80), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   268.07), SIMDE_FLOAT32_C(  -154.48),
+      SIMDE_FLOAT32_C(  -942.38), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -172.65), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.98), SIMDE_FLOAT32_C(   371.10),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -733.89), SIMDE_FLOAT32_C(   152.19), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -693.45), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -751.98), SIMDE_FLOAT32_C(   -67.42),
+      SIMDE_FLOAT32_C(  -272.41), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -346.41), SIMDE_FLOAT32_C(    18.85),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   585.38), SIMDE_FLOAT32_C(   130.28),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    43.65), SIMDE_FLOAT32_C(  -620.51),
+      SIMDE_FLOAT32_C(  -540.29), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   252.66), SIMDE_FLOAT32_C(  -139.83),
+      SIMDE_FLOAT32_C(  -921.00), SIMDE_FLOAT32_C(  -748.33), SIMDE_FLOAT32_C(  -768.73), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -162.92),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -172.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   374.33),
+      SIMDE_FLOAT32_C(  -693.88), SIMDE_FLOAT32_C(  -566.50), SIMDE_FLOAT32_C(  -661.52), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -623.32), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -49.24),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -431.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -508.62), SIMDE_FLOAT32_C(  -943.16), SIMDE_FLOAT32_C(   497.66), SIMDE_FLOAT32_C(   -48.91),
+      SIMDE_FLOAT32_C(  -101.82), SIMDE_FLOAT32_C(  -249.68), SIMDE_FLOAT32_C(  -982.18), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -506.34), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -954.83),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -739.86), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -893.24),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -670.10), SIMDE_FLOAT32_C(  -488.05), SIMDE_FLOAT32_C(   685.85),
+      SIMDE_FLOAT32_C(  -828.86), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -280.44), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -227.88), SIMDE_FLOAT32_C(  -815.52), SIMDE_FLOAT32_C(  -679.72),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -484.55), SIMDE_FLOAT32_C(  -875.45),
+      SIMDE_FLOAT32_C(  -677.64), SIMDE_FLOAT32_C(  -544.59), SIMDE_FLOAT32_C(   526.77), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -311.59),
+      SIMDE_FLOAT32_C(  -717.19), SIMDE_FLOAT32_C(  -933.03), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -840.07),
+      SIMDE_FLOAT32_C(  -672.88), SIMDE_FLOAT32_C(  -966.56), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -636.66), SIMDE_FLOAT32_C(  -942.13), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   220.38),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -887.74), SIMDE_FLOAT32_C(  -545.91), SIMDE_FLOAT32_C(    52.50),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -861.56), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   -95.91), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -804.13), SIMDE_FLOAT32_C(   150.58),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -896.67), SIMDE_FLOAT32_C(   654.29),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -276.81), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -481.06),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -3.70), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -349.25), SIMDE_FLOAT32_C(  -910.94), SIMDE_FLOAT32_C(  -954.39),
+      SIMDE_FLOAT32_C(  -291.38), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   407.85), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -646.84), SIMDE_FLOAT32_C(  -492.10), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -644.22), SIMDE_FLOAT32_C(  -296.23), SIMDE_FLOAT32_C(   809.57), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -716.32), SIMDE_FLOAT32_C(   651.47), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -156.98), SIMDE_FLOAT32_C(   426.25),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   262.52), SIMDE_FLOAT32_C(  -915.79), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   576.93), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -710.68), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -979.98), SIMDE_FLOAT32_C(  -185.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   308.68), SIMDE_FLOAT32_C(   535.19), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   122.60),
+      SIMDE_FLOAT32_C(  -661.31), SIMDE_FLOAT32_C(   781.09), SIMDE_FLOAT32_C(  -976.54), SIMDE_FLOAT32_C(    90.87),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -998.61), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -897.76),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   698.32), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   601.52), SIMDE_FLOAT32_C(  -700.16), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -865.70), SIMDE_FLOAT32_C(     0.00) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_f32_z(pv, av, bv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+
+    ev = simde_svmin_f32_z(pv, av, bv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -679.99), SIMDE_FLOAT32_C(   841.40), SIMDE_FLOAT32_C(  -949.83), SIMDE_FLOAT32_C(  -706.41),
+      SIMDE_FLOAT32_C(   541.97), SIMDE_FLOAT32_C(   357.48), SIMDE_FLOAT32_C(   118.26), SIMDE_FLOAT32_C(   -75.22),
+      SIMDE_FLOAT32_C(   439.90), SIMDE_FLOAT32_C(   177.19), SIMDE_FLOAT32_C(  -630.08), SIMDE_FLOAT32_C(  -913.67),
+      SIMDE_FLOAT32_C(   878.85), SIMDE_FLOAT32_C(  -581.37), SIMDE_FLOAT32_C(  -779.81), SIMDE_FLOAT32_C(   671.25),
+      SIMDE_FLOAT32_C(   448.74), SIMDE_FLOAT32_C(    57.18), SIMDE_FLOAT32_C(   -17.14), SIMDE_FLOAT32_C(  -877.62),
+      SIMDE_FLOAT32_C(  -628.10), SIMDE_FLOAT32_C(  -540.26), SIMDE_FLOAT32_C(  -784.87), SIMDE_FLOAT32_C(  -365.41),
+      SIMDE_FLOAT32_C(   590.83), SIMDE_FLOAT32_C(   787.70), SIMDE_FLOAT32_C(  -141.01), SIMDE_FLOAT32_C(   232.93),
+      SIMDE_FLOAT32_C(  -228.78), SIMDE_FLOAT32_C(  -962.30), SIMDE_FLOAT32_C(  -750.04), SIMDE_FLOAT32_C(    91.23),
+      SIMDE_FLOAT32_C(   879.10), SIMDE_FLOAT32_C(  -699.87), SIMDE_FLOAT32_C(   384.82), SIMDE_FLOAT32_C(   421.07),
+      SIMDE_FLOAT32_C(   657.60), SIMDE_FLOAT32_C(  -496.92), SIMDE_FLOAT32_C(  -654.15), SIMDE_FLOAT32_C(    97.51),
+      SIMDE_FLOAT32_C(   680.27), SIMDE_FLOAT32_C(  -284.23), SIMDE_FLOAT32_C(   183.84), SIMDE_FLOAT32_C(   559.12),
+      SIMDE_FLOAT32_C(   134.40), SIMDE_FLOAT32_C(   404.03), SIMDE_FLOAT32_C(   230.37), SIMDE_FLOAT32_C(  -416.86),
+      SIMDE_FLOAT32_C(  -538.79), SIMDE_FLOAT32_C(  -786.77), SIMDE_FLOAT32_C(  -294.48), SIMDE_FLOAT32_C(  -166.89),
+      SIMDE_FLOAT32_C(  -327.03), SIMDE_FLOAT32_C(   -79.35), SIMDE_FLOAT32_C(   467.71), SIMDE_FLOAT32_C(  -736.20),
+      SIMDE_FLOAT32_C(  -291.65), SIMDE_FLOAT32_C(  -673.30), SIMDE_FLOAT32_C(   496.73), SIMDE_FLOAT32_C(   479.58),
+      SIMDE_FLOAT32_C(  -635.60), SIMDE_FLOAT32_C(   746.69), SIMDE_FLOAT32_C(  -429.19), SIMDE_FLOAT32_C(  -756.50),
+      SIMDE_FLOAT32_C(  -953.19), SIMDE_FLOAT32_C(   955.62), SIMDE_FLOAT32_C(   664.57), SIMDE_FLOAT32_C(   704.42),
+      SIMDE_FLOAT32_C(  -541.30), SIMDE_FLOAT32_C(  -989.59), SIMDE_FLOAT32_C(  -198.08), SIMDE_FLOAT32_C(  -861.03),
+      SIMDE_FLOAT32_C(  -273.82), SIMDE_FLOAT32_C(   985.76), SIMDE_FLOAT32_C(   698.10), SIMDE_FLOAT32_C(   860.58),
+      SIMDE_FLOAT32_C(   389.79), SIMDE_FLOAT32_C(   -71.53), SIMDE_FLOAT32_C(  -556.28), SIMDE_FLOAT32_C(   851.01),
+      SIMDE_FLOAT32_C(   141.70), SIMDE_FLOAT32_C(   149.24), SIMDE_FLOAT32_C(  -315.88), SIMDE_FLOAT32_C(   814.67),
+      SIMDE_FLOAT32_C(  -930.10), SIMDE_FLOAT32_C(  -848.17), SIMDE_FLOAT32_C(  -921.54), SIMDE_FLOAT32_C(  -221.75),
+      SIMDE_FLOAT32_C(  -521.47), SIMDE_FLOAT32_C(   575.19), SIMDE_FLOAT32_C(  -742.18), SIMDE_FLOAT32_C(  -157.07),
+      SIMDE_FLOAT32_C(   321.88), SIMDE_FLOAT32_C(  -171.37), SIMDE_FLOAT32_C(    86.43), SIMDE_FLOAT32_C(   368.69),
+      SIMDE_FLOAT32_C(  -215.75), SIMDE_FLOAT32_C(  -249.01), SIMDE_FLOAT32_C(    73.11), SIMDE_FLOAT32_C(   242.95),
+      SIMDE_FLOAT32_C(  -238.59), SIMDE_FLOAT32_C(   875.03), SIMDE_FLOAT32_C(   381.93), SIMDE_FLOAT32_C(   487.59),
+      SIMDE_FLOAT32_C(   860.79), SIMDE_FLOAT32_C(    80.02), SIMDE_FLOAT32_C(   348.17), SIMDE_FLOAT32_C(   250.59),
+      SIMDE_FLOAT32_C(  -991.51), SIMDE_FLOAT32_C(   791.89), SIMDE_FLOAT32_C(   101.59), SIMDE_FLOAT32_C(   150.19),
+      SIMDE_FLOAT32_C(   -58.87), SIMDE_FLOAT32_C(   785.71), SIMDE_FLOAT32_C(   -35.15), SIMDE_FLOAT32_C(    11.03),
+      SIMDE_FLOAT32_C(   937.54), SIMDE_FLOAT32_C(    43.32), SIMDE_FLOAT32_C(   789.28), SIMDE_FLOAT32_C(  -583.93),
+      SIMDE_FLOAT32_C(  -381.49), SIMDE_FLOAT32_C(  -952.90), SIMDE_FLOAT32_C(   259.00), SIMDE_FLOAT32_C(   940.39),
+      SIMDE_FLOAT32_C(  -124.27), SIMDE_FLOAT32_C(  -654.58), SIMDE_FLOAT32_C(   309.08), SIMDE_FLOAT32_C(   659.98),
+      SIMDE_FLOAT32_C(    96.42), SIMDE_FLOAT32_C(  -617.82), SIMDE_FLOAT32_C(   -97.06), SIMDE_FLOAT32_C(   857.83),
+      SIMDE_FLOAT32_C(  -742.78), SIMDE_FLOAT32_C(  -715.14), SIMDE_FLOAT32_C(   345.42), SIMDE_FLOAT32_C(  -881.99),
+      SIMDE_FLOAT32_C(   364.89), SIMDE_FLOAT32_C(  -306.41), SIMDE_FLOAT32_C(   368.60), SIMDE_FLOAT32_C(   373.38),
+      SIMDE_FLOAT32_C(  -514.52), SIMDE_FLOAT32_C(  -529.81), SIMDE_FLOAT32_C(  -476.43), SIMDE_FLOAT32_C(   426.61),
+      SIMDE_FLOAT32_C(  -744.09), SIMDE_FLOAT32_C(   488.42), SIMDE_FLOAT32_C(  -562.36), SIMDE_FLOAT32_C(  -806.55),
+      SIMDE_FLOAT32_C(  -468.26), SIMDE_FLOAT32_C(  -773.08), SIMDE_FLOAT32_C(  -390.48), SIMDE_FLOAT32_C(   150.25),
+      SIMDE_FLOAT32_C(  -725.98), SIMDE_FLOAT32_C(   868.52), SIMDE_FLOAT32_C(    90.64), SIMDE_FLOAT32_C(   149.75),
+      SIMDE_FLOAT32_C(  -786.06), SIMDE_FLOAT32_C(  -600.29), SIMDE_FLOAT32_C(  -190.26), SIMDE_FLOAT32_C(   310.36),
+      SIMDE_FLOAT32_C(  -218.10), SIMDE_FLOAT32_C(   712.67), SIMDE_FLOAT32_C(   168.19), SIMDE_FLOAT32_C(    39.11),
+      SIMDE_FLOAT32_C(   997.54), SIMDE_FLOAT32_C(  -486.39), SIMDE_FLOAT32_C(   157.12), SIMDE_FLOAT32_C(   362.43),
+      SIMDE_FLOAT32_C(   207.19), SIMDE_FLOAT32_C(  -474.28), SIMDE_FLOAT32_C(  -264.19), SIMDE_FLOAT32_C(   692.67),
+      SIMDE_FLOAT32_C(    -4.09), SIMDE_FLOAT32_C(   259.38), SIMDE_FLOAT32_C(   119.29), SIMDE_FLOAT32_C(   251.82),
+      SIMDE_FLOAT32_C(  -252.20), SIMDE_FLOAT32_C(   556.93), SIMDE_FLOAT32_C(   445.27), SIMDE_FLOAT32_C(   279.54),
+      SIMDE_FLOAT32_C(   783.85), SIMDE_FLOAT32_C(  -945.21), SIMDE_FLOAT32_C(  -570.21), SIMDE_FLOAT32_C(  -942.12),
+      SIMDE_FLOAT32_C(   923.31), SIMDE_FLOAT32_C(   520.43), SIMDE_FLOAT32_C(   207.63), SIMDE_FLOAT32_C(  -862.75),
+      SIMDE_FLOAT32_C(   920.15), SIMDE_FLOAT32_C(  -982.63) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(   447.62), SIMDE_FLOAT32_C(  -297.95), SIMDE_FLOAT32_C(   730.04), SIMDE_FLOAT32_C(  -384.20),
+      SIMDE_FLOAT32_C(   741.16), SIMDE_FLOAT32_C(   727.58), SIMDE_FLOAT32_C(   129.41), SIMDE_FLOAT32_C(  -101.72),
+      SIMDE_FLOAT32_C(    90.00), SIMDE_FLOAT32_C(  -663.40), SIMDE_FLOAT32_C(   424.01), SIMDE_FLOAT32_C(   825.81),
+      SIMDE_FLOAT32_C(  -970.73), SIMDE_FLOAT32_C(  -580.08), SIMDE_FLOAT32_C(    85.19), SIMDE_FLOAT32_C(   148.56),
+      SIMDE_FLOAT32_C(   671.74), SIMDE_FLOAT32_C(   832.99), SIMDE_FLOAT32_C(  -294.51), SIMDE_FLOAT32_C(   117.00),
+      SIMDE_FLOAT32_C(   112.53), SIMDE_FLOAT32_C(  -510.65), SIMDE_FLOAT32_C(   171.79), SIMDE_FLOAT32_C(   542.33),
+      SIMDE_FLOAT32_C(  -452.77), SIMDE_FLOAT32_C(    95.10), SIMDE_FLOAT32_C(    62.76), SIMDE_FLOAT32_C(   754.86),
+      SIMDE_FLOAT32_C(   232.36), SIMDE_FLOAT32_C(   -17.10), SIMDE_FLOAT32_C(   772.23), SIMDE_FLOAT32_C(  -320.03),
+      SIMDE_FLOAT32_C(   684.95), SIMDE_FLOAT32_C(   502.27), SIMDE_FLOAT32_C(   295.78), SIMDE_FLOAT32_C(   426.11),
+      SIMDE_FLOAT32_C(   229.85), SIMDE_FLOAT32_C(  -574.81), SIMDE_FLOAT32_C(  -675.61), SIMDE_FLOAT32_C(  -680.15),
+      SIMDE_FLOAT32_C(  -238.21), SIMDE_FLOAT32_C(   748.40), SIMDE_FLOAT32_C(  -854.34), SIMDE_FLOAT32_C(  -208.94),
+      SIMDE_FLOAT32_C(  -831.68), SIMDE_FLOAT32_C(   230.85), SIMDE_FLOAT32_C(   939.62), SIMDE_FLOAT32_C(   840.05),
+      SIMDE_FLOAT32_C(    63.84), SIMDE_FLOAT32_C(  -354.89), SIMDE_FLOAT32_C(   -42.94), SIMDE_FLOAT32_C(  -823.63),
+      SIMDE_FLOAT32_C(   134.46), SIMDE_FLOAT32_C(  -871.15), SIMDE_FLOAT32_C(   718.69), SIMDE_FLOAT32_C(   681.69),
+      SIMDE_FLOAT32_C(   223.96), SIMDE_FLOAT32_C(  -218.55), SIMDE_FLOAT32_C(   436.55), SIMDE_FLOAT32_C(  -543.69),
+      SIMDE_FLOAT32_C(   764.35), SIMDE_FLOAT32_C(   208.77), SIMDE_FLOAT32_C(   136.29), SIMDE_FLOAT32_C(   449.30),
+      SIMDE_FLOAT32_C(  -288.96), SIMDE_FLOAT32_C(  -567.94), SIMDE_FLOAT32_C(  -124.59), SIMDE_FLOAT32_C(   940.89),
+      SIMDE_FLOAT32_C(  -142.75), SIMDE_FLOAT32_C(   199.81), SIMDE_FLOAT32_C(  -739.25), SIMDE_FLOAT32_C(   619.03),
+      SIMDE_FLOAT32_C(   -51.79), SIMDE_FLOAT32_C(  -593.59), SIMDE_FLOAT32_C(  -589.90), SIMDE_FLOAT32_C(   116.52),
+      SIMDE_FLOAT32_C(   637.26), SIMDE_FLOAT32_C(  -650.28), SIMDE_FLOAT32_C(   -43.42), SIMDE_FLOAT32_C(  -298.90),
+      SIMDE_FLOAT32_C(    -5.17), SIMDE_FLOAT32_C(   913.64), SIMDE_FLOAT32_C(  -122.53), SIMDE_FLOAT32_C(  -870.71),
+      SIMDE_FLOAT32_C(  -957.51), SIMDE_FLOAT32_C(  -403.84), SIMDE_FLOAT32_C(   810.98), SIMDE_FLOAT32_C(   266.45),
+      SIMDE_FLOAT32_C(   377.61), SIMDE_FLOAT32_C(   247.52), SIMDE_FLOAT32_C(   722.76), SIMDE_FLOAT32_C(   141.97),
+      SIMDE_FLOAT32_C(  -543.70), SIMDE_FLOAT32_C(  -140.95), SIMDE_FLOAT32_C(  -408.73), SIMDE_FLOAT32_C(   167.34),
+      SIMDE_FLOAT32_C(   291.11), SIMDE_FLOAT32_C(   466.69), SIMDE_FLOAT32_C(   108.23), SIMDE_FLOAT32_C(  -851.64),
+      SIMDE_FLOAT32_C(  -333.50), SIMDE_FLOAT32_C(   368.98), SIMDE_FLOAT32_C(   767.39), SIMDE_FLOAT32_C(   614.70),
+      SIMDE_FLOAT32_C(   775.39), SIMDE_FLOAT32_C(  -822.51), SIMDE_FLOAT32_C(  -268.77), SIMDE_FLOAT32_C(   412.65),
+      SIMDE_FLOAT32_C(  -472.80), SIMDE_FLOAT32_C(   687.81), SIMDE_FLOAT32_C(  -886.25), SIMDE_FLOAT32_C(   522.03),
+      SIMDE_FLOAT32_C(   601.44), SIMDE_FLOAT32_C(    -8.78), SIMDE_FLOAT32_C(   651.32), SIMDE_FLOAT32_C(   643.93),
+      SIMDE_FLOAT32_C(   587.38), SIMDE_FLOAT32_C(   462.30), SIMDE_FLOAT32_C(   -89.62), SIMDE_FLOAT32_C(   -35.00),
+      SIMDE_FLOAT32_C(  -290.18), SIMDE_FLOAT32_C(  -366.86), SIMDE_FLOAT32_C(  -893.03), SIMDE_FLOAT32_C(   166.12),
+      SIMDE_FLOAT32_C(   492.19), SIMDE_FLOAT32_C(  -301.76), SIMDE_FLOAT32_C(  -666.54), SIMDE_FLOAT32_C(  -216.70),
+      SIMDE_FLOAT32_C(  -835.07), SIMDE_FLOAT32_C(   441.69), SIMDE_FLOAT32_C(   -68.35), SIMDE_FLOAT32_C(  -168.58),
+      SIMDE_FLOAT32_C(  -189.33), SIMDE_FLOAT32_C(  -300.96), SIMDE_FLOAT32_C(  -553.87), SIMDE_FLOAT32_C(  -413.94),
+      SIMDE_FLOAT32_C(  -123.47), SIMDE_FLOAT32_C(   177.35), SIMDE_FLOAT32_C(   998.72), SIMDE_FLOAT32_C(   403.73),
+      SIMDE_FLOAT32_C(  -134.84), SIMDE_FLOAT32_C(  -887.53), SIMDE_FLOAT32_C(   -74.24), SIMDE_FLOAT32_C(  -533.40),
+      SIMDE_FLOAT32_C(   103.69), SIMDE_FLOAT32_C(  -422.91), SIMDE_FLOAT32_C(  -889.46), SIMDE_FLOAT32_C(  -308.93),
+      SIMDE_FLOAT32_C(  -960.62), SIMDE_FLOAT32_C(    20.92), SIMDE_FLOAT32_C(   656.07), SIMDE_FLOAT32_C(  -250.80),
+      SIMDE_FLOAT32_C(   654.06), SIMDE_FLOAT32_C(   763.04), SIMDE_FLOAT32_C(   915.32), SIMDE_FLOAT32_C(   146.24),
+      SIMDE_FLOAT32_C(  -538.72), SIMDE_FLOAT32_C(  -751.23), SIMDE_FLOAT32_C(   929.54), SIMDE_FLOAT32_C(  -373.80),
+      SIMDE_FLOAT32_C(   690.46), SIMDE_FLOAT32_C(  -138.81), SIMDE_FLOAT32_C(   457.62), SIMDE_FLOAT32_C(  -498.86),
+      SIMDE_FLOAT32_C(   560.23), SIMDE_FLOAT32_C(   903.75), SIMDE_FLOAT32_C(    87.20), SIMDE_FLOAT32_C(  -563.24),
+      SIMDE_FLOAT32_C(    81.10), SIMDE_FLOAT32_C(    85.92), SIMDE_FLOAT32_C(   840.50), SIMDE_FLOAT32_C(   946.26),
+      SIMDE_FLOAT32_C(   198.39), SIMDE_FLOAT32_C(  -233.74), SIMDE_FLOAT32_C(  -587.13), SIMDE_FLOAT32_C(  -697.92),
+      SIMDE_FLOAT32_C(   343.35), SIMDE_FLOAT32_C(  -476.60), SIMDE_FLOAT32_C(    -6.84), SIMDE_FLOAT32_C(   382.73),
+      SIMDE_FLOAT32_C(   544.32), SIMDE_FLOAT32_C(  -350.77), SIMDE_FLOAT32_C(  -868.07), SIMDE_FLOAT32_C(   198.38),
+      SIMDE_FLOAT32_C(  -587.73), SIMDE_FLOAT32_C(  -952.75), SIMDE_FLOAT32_C(  -655.38), SIMDE_FLOAT32_C(  -126.46),
+      SIMDE_FLOAT32_C(  -703.98), SIMDE_FLOAT32_C(  -725.84) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  -679.99), SIMDE_FLOAT32_C(  -297.95), SIMDE_FLOAT32_C(  -949.83), SIMDE_FLOAT32_C(  -706.41),
+      SIMDE_FLOAT32_C(   541.97), SIMDE_FLOAT32_C(   357.48), SIMDE_FLOAT32_C(   118.26), SIMDE_FLOAT32_C(   -75.22),
+      SIMDE_FLOAT32_C(   439.90), SIMDE_FLOAT32_C(  -663.40), SIMDE_FLOAT32_C(  -630.08), SIMDE_FLOAT32_C(  -913.67),
+      SIMDE_FLOAT32_C(   878.85), SIMDE_FLOAT32_C(  -581.37), SIMDE_FLOAT32_C(  -779.81), SIMDE_FLOAT32_C(   671.25),
+      SIMDE_FLOAT32_C(   448.74), SIMDE_FLOAT32_C(    57.18), SIMDE_FLOAT32_C(  -294.51), SIMDE_FLOAT32_C(  -877.62),
+      SIMDE_FLOAT32_C(  -628.10), SIMDE_FLOAT32_C(  -540.26), SIMDE_FLOAT32_C(  -784.87), SIMDE_FLOAT32_C(  -365.41),
+      SIMDE_FLOAT32_C(   590.83), SIMDE_FLOAT32_C(   787.70), SIMDE_FLOAT32_C(  -141.01), SIMDE_FLOAT32_C(   232.93),
+      SIMDE_FLOAT32_C(  -228.78), SIMDE_FLOAT32_C(  -962.30), SIMDE_FLOAT32_C(  -750.04), SIMDE_FLOAT32_C(    91.23),
+      SIMDE_FLOAT32_C(   684.95), SIMDE_FLOAT32_C(  -699.87), SIMDE_FLOAT32_C(   295.78), SIMDE_FLOAT32_C(   421.07),
+      SIMDE_FLOAT32_C(   657.60), SIMDE_FLOAT32_C(  -574.81), SIMDE_FLOAT32_C(  -654.15), SIMDE_FLOAT32_C(    97.51),
+      SIMDE_FLOAT32_C(   680.27), SIMDE_FLOAT32_C(  -284.23), SIMDE_FLOAT32_C(   183.84), SIMDE_FLOAT32_C(   559.12),
+      SIMDE_FLOAT32_C(   134.40), SIMDE_FLOAT32_C(   404.03), SIMDE_FLOAT32_C(   230.37), SIMDE_FLOAT32_C(  -416.86),
+      SIMDE_FLOAT32_C(  -538.79), SIMDE_FLOAT32_C(  -786.77), SIMDE_FLOAT32_C(  -294.48), SIMDE_FLOAT32_C(  -823.63),
+      SIMDE_FLOAT32_C(  -327.03), SIMDE_FLOAT32_C(   -79.35), SIMDE_FLOAT32_C(   467.71), SIMDE_FLOAT32_C(  -736.20),
+      SIMDE_FLOAT32_C(  -291.65), SIMDE_FLOAT32_C(  -673.30), SIMDE_FLOAT32_C(   496.73), SIMDE_FLOAT32_C(   479.58),
+      SIMDE_FLOAT32_C(  -635.60), SIMDE_FLOAT32_C(   208.77), SIMDE_FLOAT32_C(  -429.19), SIMDE_FLOAT32_C(  -756.50),
+      SIMDE_FLOAT32_C(  -953.19), SIMDE_FLOAT32_C(   955.62), SIMDE_FLOAT32_C(  -124.59), SIMDE_FLOAT32_C(   704.42),
+      SIMDE_FLOAT32_C(  -541.30), SIMDE_FLOAT32_C(  -989.59), SIMDE_FLOAT32_C(  -198.08), SIMDE_FLOAT32_C(  -861.03),
+      SIMDE_FLOAT32_C(  -273.82), SIMDE_FLOAT32_C(   985.76), SIMDE_FLOAT32_C(   698.10), SIMDE_FLOAT32_C(   860.58),
+      SIMDE_FLOAT32_C(   389.79), SIMDE_FLOAT32_C(   -71.53), SIMDE_FLOAT32_C(  -556.28), SIMDE_FLOAT32_C(   851.01),
+      SIMDE_FLOAT32_C(   141.70), SIMDE_FLOAT32_C(   149.24), SIMDE_FLOAT32_C(  -315.88), SIMDE_FLOAT32_C(  -870.71),
+      SIMDE_FLOAT32_C(  -930.10), SIMDE_FLOAT32_C(  -848.17), SIMDE_FLOAT32_C(  -921.54), SIMDE_FLOAT32_C(  -221.75),
+      SIMDE_FLOAT32_C(  -521.47), SIMDE_FLOAT32_C(   247.52), SIMDE_FLOAT32_C(  -742.18), SIMDE_FLOAT32_C(  -157.07),
+      SIMDE_FLOAT32_C(  -543.70), SIMDE_FLOAT32_C(  -171.37), SIMDE_FLOAT32_C(  -408.73), SIMDE_FLOAT32_C(   368.69),
+      SIMDE_FLOAT32_C(  -215.75), SIMDE_FLOAT32_C(  -249.01), SIMDE_FLOAT32_C(    73.11), SIMDE_FLOAT32_C(  -851.64),
+      SIMDE_FLOAT32_C(  -333.50), SIMDE_FLOAT32_C(   368.98), SIMDE_FLOAT32_C(   381.93), SIMDE_FLOAT32_C(   487.59),
+      SIMDE_FLOAT32_C(   860.79), SIMDE_FLOAT32_C(    80.02), SIMDE_FLOAT32_C(   348.17), SIMDE_FLOAT32_C(   250.59),
+      SIMDE_FLOAT32_C(  -991.51), SIMDE_FLOAT32_C(   791.89), SIMDE_FLOAT32_C(   101.59), SIMDE_FLOAT32_C(   150.19),
+      SIMDE_FLOAT32_C(   -58.87), SIMDE_FLOAT32_C(   785.71), SIMDE_FLOAT32_C(   -35.15), SIMDE_FLOAT32_C(    11.03),
+      SIMDE_FLOAT32_C(   587.38), SIMDE_FLOAT32_C(    43.32), SIMDE_FLOAT32_C(   -89.62), SIMDE_FLOAT32_C(  -583.93),
+      SIMDE_FLOAT32_C(  -381.49), SIMDE_FLOAT32_C(  -952.90), SIMDE_FLOAT32_C(  -893.03), SIMDE_FLOAT32_C(   940.39),
+      SIMDE_FLOAT32_C(  -124.27), SIMDE_FLOAT32_C(  -654.58), SIMDE_FLOAT32_C(  -666.54), SIMDE_FLOAT32_C(  -216.70),
+      SIMDE_FLOAT32_C(  -835.07), SIMDE_FLOAT32_C(  -617.82), SIMDE_FLOAT32_C(   -97.06), SIMDE_FLOAT32_C(  -168.58),
+      SIMDE_FLOAT32_C(  -742.78), SIMDE_FLOAT32_C(  -715.14), SIMDE_FLOAT32_C(  -553.87), SIMDE_FLOAT32_C(  -881.99),
+      SIMDE_FLOAT32_C(  -123.47), SIMDE_FLOAT32_C(  -306.41), SIMDE_FLOAT32_C(   368.60), SIMDE_FLOAT32_C(   373.38),
+      SIMDE_FLOAT32_C(  -514.52), SIMDE_FLOAT32_C(  -887.53), SIMDE_FLOAT32_C(  -476.43), SIMDE_FLOAT32_C(   426.61),
+      SIMDE_FLOAT32_C(  -744.09), SIMDE_FLOAT32_C(   488.42), SIMDE_FLOAT32_C(  -889.46), SIMDE_FLOAT32_C(  -806.55),
+      SIMDE_FLOAT32_C(  -960.62), SIMDE_FLOAT32_C(  -773.08), SIMDE_FLOAT32_C(  -390.48), SIMDE_FLOAT32_C(  -250.80),
+      SIMDE_FLOAT32_C(  -725.98), SIMDE_FLOAT32_C(   868.52), SIMDE_FLOAT32_C(    90.64), SIMDE_FLOAT32_C(   146.24),
+      SIMDE_FLOAT32_C(  -786.06), SIMDE_FLOAT32_C(  -751.23), SIMDE_FLOAT32_C(  -190.26), SIMDE_FLOAT32_C(  -373.80),
+      SIMDE_FLOAT32_C(  -218.10), SIMDE_FLOAT32_C(   712.67), SIMDE_FLOAT32_C(   168.19), SIMDE_FLOAT32_C(    39.11),
+      SIMDE_FLOAT32_C(   997.54), SIMDE_FLOAT32_C(  -486.39), SIMDE_FLOAT32_C(    87.20), SIMDE_FLOAT32_C(  -563.24),
+      SIMDE_FLOAT32_C(   207.19), SIMDE_FLOAT32_C(  -474.28), SIMDE_FLOAT32_C(  -264.19), SIMDE_FLOAT32_C(   692.67),
+      SIMDE_FLOAT32_C(    -4.09), SIMDE_FLOAT32_C(   259.38), SIMDE_FLOAT32_C(  -587.13), SIMDE_FLOAT32_C(   251.82),
+      SIMDE_FLOAT32_C(  -252.20), SIMDE_FLOAT32_C(  -476.60), SIMDE_FLOAT32_C(   445.27), SIMDE_FLOAT32_C(   279.54),
+      SIMDE_FLOAT32_C(   544.32), SIMDE_FLOAT32_C(  -945.21), SIMDE_FLOAT32_C(  -570.21), SIMDE_FLOAT32_C(  -942.12),
+      SIMDE_FLOAT32_C(  -587.73), SIMDE_FLOAT32_C(  -952.75), SIMDE_FLOAT32_C(  -655.38), SIMDE_FLOAT32_C(  -862.75),
+      SIMDE_FLOAT32_C(   920.15), SIMDE_FLOAT32_C(  -982.63) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_f32_m(pv, av, bv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+
+    ev = simde_svmin_f32_m(pv, av, bv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   839.02), SIMDE_FLOAT64_C(   223.73), SIMDE_FLOAT64_C(   406.85), SIMDE_FLOAT64_C(   454.07),
+      SIMDE_FLOAT64_C(   510.48), SIMDE_FLOAT64_C(  -489.37), SIMDE_FLOAT64_C(  -288.71), SIMDE_FLOAT64_C(  -686.40),
+      SIMDE_FLOAT64_C(  -217.40), SIMDE_FLOAT64_C(  -958.07), SIMDE_FLOAT64_C(  -629.65), SIMDE_FLOAT64_C(   969.97),
+      SIMDE_FLOAT64_C(  -662.40), SIMDE_FLOAT64_C(  -484.67), SIMDE_FLOAT64_C(  -541.68), SIMDE_FLOAT64_C(  -480.25),
+      SIMDE_FLOAT64_C(   558.15), SIMDE_FLOAT64_C(  -739.15), SIMDE_FLOAT64_C(    26.09), SIMDE_FLOAT64_C(  -674.12),
+      SIMDE_FLOAT64_C(   196.95), SIMDE_FLOAT64_C(  -181.67), SIMDE_FLOAT64_C(  -860.44), SIMDE_FLOAT64_C(  -887.17),
+      SIMDE_FLOAT64_C(  -907.18), SIMDE_FLOAT64_C(   519.67), SIMDE_FLOAT64_C(  -154.15), SIMDE_FLOAT64_C(  -193.32),
+      SIMDE_FLOAT64_C(   867.92), SIMDE_FLOAT64_C(  -546.33), SIMDE_FLOAT64_C(  -992.78), SIMDE_FLOAT64_C(   706.93),
+      SIMDE_FLOAT64_C(   677.40), SIMDE_FLOAT64_C(   414.07), SIMDE_FLOAT64_C(   161.00), SIMDE_FLOAT64_C(   187.87),
+      SIMDE_FLOAT64_C(   924.70), SIMDE_FLOAT64_C(   872.29), SIMDE_FLOAT64_C(   501.48), SIMDE_FLOAT64_C(  -292.70),
+      SIMDE_FLOAT64_C(   914.22), SIMDE_FLOAT64_C(   871.83), SIMDE_FLOAT64_C(  -322.73), SIMDE_FLOAT64_C(  -748.18),
+      SIMDE_FLOAT64_C(  -612.84), SIMDE_FLOAT64_C(   135.60), SIMDE_FLOAT64_C(  -228.43), SIMDE_FLOAT64_C(   945.31),
+      SIMDE_FLOAT64_C(   396.44), SIMDE_FLOAT64_C(   797.67), SIMDE_FLOAT64_C(  -728.81), SIMDE_FLOAT64_C(  -406.61),
+      SIMDE_FLOAT64_C(  -384.01), SIMDE_FLOAT64_C(  -589.25), SIMDE_FLOAT64_C(  -293.78), SIMDE_FLOAT64_C(  -291.18),
+      SIMDE_FLOAT64_C(   930.41), SIMDE_FLOAT64_C(   552.07), SIMDE_FLOAT64_C(   515.49), SIMDE_FLOAT64_C(   798.33),
+      SIMDE_FLOAT64_C(  -994.26), SIMDE_FLOAT64_C(   522.72), SIMDE_FLOAT64_C(   505.26), SIMDE_FLOAT64_C(   683.14),
+      SIMDE_FLOAT64_C(   -63.21), SIMDE_FLOAT64_C(  -333.74), SIMDE_FLOAT64_C(  -128.99), SIMDE_FLOAT64_C(  -138.51),
+      SIMDE_FLOAT64_C(  -461.45), SIMDE_FLOAT64_C(  -627.51), SIMDE_FLOAT64_C(   568.79), SIMDE_FLOAT64_C(  -547.23),
+      SIMDE_FLOAT64_C(  -755.69), SIMDE_FLOAT64_C(  -753.94), SIMDE_FLOAT64_C(  -295.41), SIMDE_FLOAT64_C(  -368.53),
+      SIMDE_FLOAT64_C(   381.66), SIMDE_FLOAT64_C(   476.17), SIMDE_FLOAT64_C(  -423.22), SIMDE_FLOAT64_C(  -221.90),
+      SIMDE_FLOAT64_C(   273.84), SIMDE_FLOAT64_C(  -152.04), SIMDE_FLOAT64_C(   371.50), SIMDE_FLOAT64_C(   889.83),
+      SIMDE_FLOAT64_C(   258.71), SIMDE_FLOAT64_C(  -922.28), SIMDE_FLOAT64_C(  -401.35), SIMDE_FLOAT64_C(   189.13),
+      SIMDE_FLOAT64_C(   629.79), SIMDE_FLOAT64_C(  -885.86), SIMDE_FLOAT64_C(   -12.54), SIMDE_FLOAT64_C(   635.52),
+      SIMDE_FLOAT64_C(   636.86), SIMDE_FLOAT64_C(  -507.28), SIMDE_FLOAT64_C(   318.66), SIMDE_FLOAT64_C(  -426.35),
+      SIMDE_FLOAT64_C(   158.98), SIMDE_FLOAT64_C(  -810.33), SIMDE_FLOAT64_C(   435.14), SIMDE_FLOAT64_C(   697.54),
+      SIMDE_FLOAT64_C(  -437.85), SIMDE_FLOAT64_C(     3.93), SIMDE_FLOAT64_C(  -849.69), SIMDE_FLOAT64_C(  -193.54),
+      SIMDE_FLOAT64_C(   249.99), SIMDE_FLOAT64_C(  -145.10), SIMDE_FLOAT64_C(   437.93), SIMDE_FLOAT64_C(  -368.35),
+      SIMDE_FLOAT64_C(  -668.93), SIMDE_FLOAT64_C(  -985.29), SIMDE_FLOAT64_C(   409.75), SIMDE_FLOAT64_C(   604.91),
+      SIMDE_FLOAT64_C(  -137.32), SIMDE_FLOAT64_C(  -218.75), SIMDE_FLOAT64_C(   494.74), SIMDE_FLOAT64_C(  -878.61),
+      SIMDE_FLOAT64_C(  -141.03), SIMDE_FLOAT64_C(  -906.62), SIMDE_FLOAT64_C(   310.51), SIMDE_FLOAT64_C(  -511.24) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(  -792.48), SIMDE_FLOAT64_C(  -702.03), SIMDE_FLOAT64_C(  -875.72), SIMDE_FLOAT64_C(   844.38),
+      SIMDE_FLOAT64_C(  -209.31), SIMDE_FLOAT64_C(   442.94), SIMDE_FLOAT64_C(  -581.97), SIMDE_FLOAT64_C(   949.67),
+      SIMDE_FLOAT64_C(   632.61), SIMDE_FLOAT64_C(   853.16), SIMDE_FLOAT64_C(   647.21), SIMDE_FLOAT64_C(  -805.24),
+      SIMDE_FLOAT64_C(  -142.91), SIMDE_FLOAT64_C(   797.52), SIMDE_FLOAT64_C(     1.23), SIMDE_FLOAT64_C(  -892.92),
+      SIMDE_FLOAT64_C(  -347.58), SIMDE_FLOAT64_C(  -560.84), SIMDE_FLOAT64_C(  -261.27), SIMDE_FLOAT64_C(   -16.51),
+      SIMDE_FLOAT64_C(  -546.13), SIMDE_FLOAT64_C(  -851.52), SIMDE_FLOAT64_C(  -411.60), SIMDE_FLOAT64_C(   316.55),
+      SIMDE_FLOAT64_C(   -70.27), SIMDE_FLOAT64_C(  -916.86), SIMDE_FLOAT64_C(   437.93), SIMDE_FLOAT64_C(   788.70),
+      SIMDE_FLOAT64_C(  -823.48), SIMDE_FLOAT64_C(  -251.56), SIMDE_FLOAT64_C(  -722.54), SIMDE_FLOAT64_C(  -615.95),
+      SIMDE_FLOAT64_C(    46.41), SIMDE_FLOAT64_C(  -598.26), SIMDE_FLOAT64_C(  -771.57), SIMDE_FLOAT64_C(   837.10),
+      SIMDE_FLOAT64_C(   844.68), SIMDE_FLOAT64_C(  -353.55), SIMDE_FLOAT64_C(   786.77), SIMDE_FLOAT64_C(   477.29),
+      SIMDE_FLOAT64_C(  -500.38), SIMDE_FLOAT64_C(   433.97), SIMDE_FLOAT64_C(   672.05), SIMDE_FLOAT64_C(   356.71),
+      SIMDE_FLOAT64_C(   231.49), SIMDE_FLOAT64_C(  -326.73), SIMDE_FLOAT64_C(   463.79), SIMDE_FLOAT64_C(   883.91),
+      SIMDE_FLOAT64_C(   112.44), SIMDE_FLOAT64_C(  -797.48), SIMDE_FLOAT64_C(  -132.59), SIMDE_FLOAT64_C(   566.31),
+      SIMDE_FLOAT64_C(  -649.00), SIMDE_FLOAT64_C(   455.81), SIMDE_FLOAT64_C(  -117.15), SIMDE_FLOAT64_C(   280.74),
+      SIMDE_FLOAT64_C(   538.95), SIMDE_FLOAT64_C(  -679.22), SIMDE_FLOAT64_C(    69.44), SIMDE_FLOAT64_C(   715.47),
+      SIMDE_FLOAT64_C(    69.23), SIMDE_FLOAT64_C(   346.90), SIMDE_FLOAT64_C(  -900.48), SIMDE_FLOAT64_C(  -884.36),
+      SIMDE_FLOAT64_C(   748.64), SIMDE_FLOAT64_C(  -672.05), SIMDE_FLOAT64_C(   952.74), SIMDE_FLOAT64_C(   593.31),
+      SIMDE_FLOAT64_C(   -25.60), SIMDE_FLOAT64_C(   739.50), SIMDE_FLOAT64_C(    70.60), SIMDE_FLOAT64_C(   474.02),
+      SIMDE_FLOAT64_C(   173.48), SIMDE_FLOAT64_C(  -257.35), SIMDE_FLOAT64_C(  -169.28), SIMDE_FLOAT64_C(  -595.03),
+      SIMDE_FLOAT64_C(   415.92), SIMDE_FLOAT64_C(  -705.49), SIMDE_FLOAT64_C(  -711.12), SIMDE_FLOAT64_C(  -471.64),
+      SIMDE_FLOAT64_C(  -502.97), SIMDE_FLOAT64_C(   156.29), SIMDE_FLOAT64_C(  -905.33), SIMDE_FLOAT64_C(  -151.97),
+      SIMDE_FLOAT64_C(  -387.91), SIMDE_FLOAT64_C(   -22.48), SIMDE_FLOAT64_C(  -871.23), SIMDE_FLOAT64_C(  -848.96),
+      SIMDE_FLOAT64_C(   298.30), SIMDE_FLOAT64_C(   198.21), SIMDE_FLOAT64_C(   866.52), SIMDE_FLOAT64_C(  -632.47),
+      SIMDE_FLOAT64_C(  -454.90), SIMDE_FLOAT64_C(   966.04), SIMDE_FLOAT64_C(  -516.83), SIMDE_FLOAT64_C(  -706.26),
+      SIMDE_FLOAT64_C(  -706.02), SIMDE_FLOAT64_C(  -564.10), SIMDE_FLOAT64_C(   887.05), SIMDE_FLOAT64_C(   268.38),
+      SIMDE_FLOAT64_C(  -824.59), SIMDE_FLOAT64_C(   -42.35), SIMDE_FLOAT64_C(  -257.60), SIMDE_FLOAT64_C(   348.89),
+      SIMDE_FLOAT64_C(   700.30), SIMDE_FLOAT64_C(   573.12), SIMDE_FLOAT64_C(   753.85), SIMDE_FLOAT64_C(   116.23),
+      SIMDE_FLOAT64_C(   867.63), SIMDE_FLOAT64_C(  -957.27), SIMDE_FLOAT64_C(   644.59), SIMDE_FLOAT64_C(  -635.34),
+      SIMDE_FLOAT64_C(   199.02), SIMDE_FLOAT64_C(   739.25), SIMDE_FLOAT64_C(   212.69), SIMDE_FLOAT64_C(   811.11),
+      SIMDE_FLOAT64_C(  -283.23), SIMDE_FLOAT64_C(   341.46), SIMDE_FLOAT64_C(   962.16), SIMDE_FLOAT64_C(  -984.92) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(  -792.48), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -875.72), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -489.37), SIMDE_FLOAT64_C(  -581.97), SIMDE_FLOAT64_C(  -686.40),
+      SIMDE_FLOAT64_C(  -217.40), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -629.65), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -484.67), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -739.15), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -851.52), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -193.32),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -546.33), SIMDE_FLOAT64_C(  -992.78), SIMDE_FLOAT64_C(  -615.95),
+      SIMDE_FLOAT64_C(    46.41), SIMDE_FLOAT64_C(  -598.26), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   187.87),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   433.97), SIMDE_FLOAT64_C(  -322.73), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -612.84), SIMDE_FLOAT64_C(  -326.73), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   112.44), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -728.81), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -291.18),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -679.22), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -900.48), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -128.99), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -461.45), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -755.69), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   381.66), SIMDE_FLOAT64_C(  -705.49), SIMDE_FLOAT64_C(  -711.12), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -502.97), SIMDE_FLOAT64_C(  -152.04), SIMDE_FLOAT64_C(  -905.33), SIMDE_FLOAT64_C(  -151.97),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -871.23), SIMDE_FLOAT64_C(  -848.96),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -507.28), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -706.26),
+      SIMDE_FLOAT64_C(  -706.02), SIMDE_FLOAT64_C(  -810.33), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   268.38),
+      SIMDE_FLOAT64_C(  -824.59), SIMDE_FLOAT64_C(   -42.35), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   249.99), SIMDE_FLOAT64_C(  -145.10), SIMDE_FLOAT64_C(   437.93), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   409.75), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -878.61),
+      SIMDE_FLOAT64_C(  -283.23), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   310.51), SIMDE_FLOAT64_C(     0.00) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_f64_z(pv, av, bv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+
+    ev = simde_svmin_f64_z(pv, av, bv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(  -197.87), SIMDE_FLOAT64_C(  -831.32), SIMDE_FLOAT64_C(   547.08), SIMDE_FLOAT64_C(  -624.60),
+      SIMDE_FLOAT64_C(  -276.34), SIMDE_FLOAT64_C(   375.96), SIMDE_FLOAT64_C(  -727.19), SIMDE_FLOAT64_C(  -738.49),
+      SIMDE_FLOAT64_C(  -508.29), SIMDE_FLOAT64_C(  -808.07), SIMDE_FLOAT64_C(   179.75), SIMDE_FLOAT64_C(  -378.33),
+      SIMDE_FLOAT64_C(  -506.76), SIMDE_FLOAT64_C(   948.32), SIMDE_FLOAT64_C(  -820.80), SIMDE_FLOAT64_C(   729.65),
+      SIMDE_FLOAT64_C(   422.75), SIMDE_FLOAT64_C(   663.27), SIMDE_FLOAT64_C(  -512.18), SIMDE_FLOAT64_C(   516.95),
+      SIMDE_FLOAT64_C(  -873.18), SIMDE_FLOAT64_C(   692.04), SIMDE_FLOAT64_C(   280.07), SIMDE_FLOAT64_C(   815.32),
+      SIMDE_FLOAT64_C(   640.27), SIMDE_FLOAT64_C(   797.92), SIMDE_FLOAT64_C(   -72.88), SIMDE_FLOAT64_C(  -869.45),
+      SIMDE_FLOAT64_C(  -920.72), SIMDE_FLOAT64_C(   409.30), SIMDE_FLOAT64_C(  -796.51), SIMDE_FLOAT64_C(  -118.59),
+      SIMDE_FLOAT64_C(   577.97), SIMDE_FLOAT64_C(   750.57), SIMDE_FLOAT64_C(   256.81), SIMDE_FLOAT64_C(  -698.37),
+      SIMDE_FLOAT64_C(   126.52), SIMDE_FLOAT64_C(   529.63), SIMDE_FLOAT64_C(  -436.86), SIMDE_FLOAT64_C(   618.23),
+      SIMDE_FLOAT64_C(   721.56), SIMDE_FLOAT64_C(   742.89), SIMDE_FLOAT64_C(  -760.10), SIMDE_FLOAT64_C(  -785.20),
+      SIMDE_FLOAT64_C(   691.21), SIMDE_FLOAT64_C(  -580.90), SIMDE_FLOAT64_C(   944.45), SIMDE_FLOAT64_C(   113.96),
+      SIMDE_FLOAT64_C(  -917.63), SIMDE_FLOAT64_C(  -567.73), SIMDE_FLOAT64_C(  -369.09), SIMDE_FLOAT64_C(  -790.81),
+      SIMDE_FLOAT64_C(  -875.69), SIMDE_FLOAT64_C(   910.98), SIMDE_FLOAT64_C(  -975.49), SIMDE_FLOAT64_C(   764.58),
+      SIMDE_FLOAT64_C(   708.90), SIMDE_FLOAT64_C(   -48.37), SIMDE_FLOAT64_C(   895.13), SIMDE_FLOAT64_C(   788.18),
+      SIMDE_FLOAT64_C(  -639.07), SIMDE_FLOAT64_C(  -901.38), SIMDE_FLOAT64_C(  -330.41), SIMDE_FLOAT64_C(   938.90),
+      SIMDE_FLOAT64_C(   849.18), SIMDE_FLOAT64_C(   926.40), SIMDE_FLOAT64_C(  -759.47), SIMDE_FLOAT64_C(   -24.29),
+      SIMDE_FLOAT64_C(   456.03), SIMDE_FLOAT64_C(  -196.33), SIMDE_FLOAT64_C(  -406.06), SIMDE_FLOAT64_C(   177.59),
+      SIMDE_FLOAT64_C(  -453.44), SIMDE_FLOAT64_C(  -166.16), SIMDE_FLOAT64_C(   392.39) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(  -762.23), SIMDE_FLOAT64_C(   252.94), SIMDE_FLOAT64_C(   336.84), SIMDE_FLOAT64_C(   351.73),
+      SIMDE_FLOAT64_C(   335.31), SIMDE_FLOAT64_C(   769.11), SIMDE_FLOAT64_C(   982.64), SIMDE_FLOAT64_C(   544.50),
+      SIMDE_FLOAT64_C(   893.42), SIMDE_FLOAT64_C(   893.62), SIMDE_FLOAT64_C(   569.01), SIMDE_FLOAT64_C(   658.00),
+      SIMDE_FLOAT64_C(   602.51), SIMDE_FLOAT64_C(  -479.37), SIMDE_FLOAT64_C(   553.13), SIMDE_FLOAT64_C(   390.69),
+      SIMDE_FLOAT64_C(  -118.44), SIMDE_FLOAT64_C(   651.75), SIMDE_FLOAT64_C(  -939.72), SIMDE_FLOAT64_C(  -179.54),
+      SIMDE_FLOAT64_C(   500.94), SIMDE_FLOAT64_C(   986.69), SIMDE_FLOAT64_C(    60.99), SIMDE_FLOAT64_C(  -523.35),
+      SIMDE_FLOAT64_C(   442.72), SIMDE_FLOAT64_C(   864.66), SIMDE_FLOAT64_C(    70.59), SIMDE_FLOAT64_C(  -379.69),
+      SIMDE_FLOAT64_C(  -588.78), SIMDE_FLOAT64_C(   904.42), SIMDE_FLOAT64_C(  -987.30), SIMDE_FLOAT64_C(  -351.01),
+      SIMDE_FLOAT64_C(   157.36), SIMDE_FLOAT64_C(   349.54), SIMDE_FLOAT64_C(  -999.28), SIMDE_FLOAT64_C(  -507.33),
+      SIMDE_FLOAT64_C(   118.65), SIMDE_FLOAT64_C(   983.36), SIMDE_FLOAT64_C(  -962.83), SIMDE_FLOAT64_C(    12.08),
+      SIMDE_FLOAT64_C(   876.98), SIMDE_FLOAT64_C(   606.18), SIMDE_FLOAT64_C(  -329.92), SIMDE_FLOAT64_C(   479.49),
+      SIMDE_FLOAT64_C(  -873.19), SIMDE_FLOAT64_C(  -776.79), SIMDE_FLOAT64_C(  -129.82), SIMDE_FLOAT64_C(     8.37),
+      SIMDE_FLOAT64_C(   874.96), SIMDE_FLOAT64_C(   -69.54), SIMDE_FLOAT64_C(   828.83), SIMDE_FLOAT64_C(   375.90),
+      SIMDE_FLOAT64_C(   -82.85), SIMDE_FLOAT64_C(  -110.18), SIMDE_FLOAT64_C(   852.54), SIMDE_FLOAT64_C(  -640.13),
+      SIMDE_FLOAT64_C(  -245.52), SIMDE_FLOAT64_C(   -76.87), SIMDE_FLOAT64_C(   -19.82), SIMDE_FLOAT64_C(   165.70),
+      SIMDE_FLOAT64_C(  -172.45), SIMDE_FLOAT64_C(    -7.11), SIMDE_FLOAT64_C(   814.69), SIMDE_FLOAT64_C(   984.92),
+      SIMDE_FLOAT64_C(  -657.57), SIMDE_FLOAT64_C(   815.41), SIMDE_FLOAT64_C(  -522.41), SIMDE_FLOAT64_C(   461.08),
+      SIMDE_FLOAT64_C(   798.77), SIMDE_FLOAT64_C(  -485.24), SIMDE_FLOAT64_C(  -526.84), SIMDE_FLOAT64_C(   675.75),
+      SIMDE_FLOAT64_C(  -879.07), SIMDE_FLOAT64_C(   143.24), SIMDE_FLOAT64_C(   155.23) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(  -197.87), SIMDE_FLOAT64_C(  -831.32), SIMDE_FLOAT64_C(   336.84), SIMDE_FLOAT64_C(  -624.60),
+      SIMDE_FLOAT64_C(  -276.34), SIMDE_FLOAT64_C(   375.96), SIMDE_FLOAT64_C(  -727.19), SIMDE_FLOAT64_C(  -738.49),
+      SIMDE_FLOAT64_C(  -508.29), SIMDE_FLOAT64_C(  -808.07), SIMDE_FLOAT64_C(   179.75), SIMDE_FLOAT64_C(  -378.33),
+      SIMDE_FLOAT64_C(  -506.76), SIMDE_FLOAT64_C(  -479.37), SIMDE_FLOAT64_C(  -820.80), SIMDE_FLOAT64_C(   390.69),
+      SIMDE_FLOAT64_C(  -118.44), SIMDE_FLOAT64_C(   663.27), SIMDE_FLOAT64_C(  -939.72), SIMDE_FLOAT64_C(   516.95),
+      SIMDE_FLOAT64_C(  -873.18), SIMDE_FLOAT64_C(   692.04), SIMDE_FLOAT64_C(   280.07), SIMDE_FLOAT64_C(   815.32),
+      SIMDE_FLOAT64_C(   640.27), SIMDE_FLOAT64_C(   797.92), SIMDE_FLOAT64_C(   -72.88), SIMDE_FLOAT64_C(  -869.45),
+      SIMDE_FLOAT64_C(  -920.72), SIMDE_FLOAT64_C(   409.30), SIMDE_FLOAT64_C(  -987.30), SIMDE_FLOAT64_C(  -351.01),
+      SIMDE_FLOAT64_C(   577.97), SIMDE_FLOAT64_C(   750.57), SIMDE_FLOAT64_C(  -999.28), SIMDE_FLOAT64_C(  -698.37),
+      SIMDE_FLOAT64_C(   126.52), SIMDE_FLOAT64_C(   529.63), SIMDE_FLOAT64_C(  -962.83), SIMDE_FLOAT64_C(    12.08),
+      SIMDE_FLOAT64_C(   721.56), SIMDE_FLOAT64_C(   742.89), SIMDE_FLOAT64_C(  -760.10), SIMDE_FLOAT64_C(  -785.20),
+      SIMDE_FLOAT64_C(  -873.19), SIMDE_FLOAT64_C(  -776.79), SIMDE_FLOAT64_C(   944.45), SIMDE_FLOAT64_C(     8.37),
+      SIMDE_FLOAT64_C(  -917.63), SIMDE_FLOAT64_C(  -567.73), SIMDE_FLOAT64_C(  -369.09), SIMDE_FLOAT64_C(  -790.81),
+      SIMDE_FLOAT64_C(  -875.69), SIMDE_FLOAT64_C(   910.98), SIMDE_FLOAT64_C(  -975.49), SIMDE_FLOAT64_C(  -640.13),
+      SIMDE_FLOAT64_C(   708.90), SIMDE_FLOAT64_C(   -76.87), SIMDE_FLOAT64_C(   895.13), SIMDE_FLOAT64_C(   165.70),
+      SIMDE_FLOAT64_C(  -639.07), SIMDE_FLOAT64_C(  -901.38), SIMDE_FLOAT64_C(  -330.41), SIMDE_FLOAT64_C(   938.90),
+      SIMDE_FLOAT64_C(   849.18), SIMDE_FLOAT64_C(   926.40), SIMDE_FLOAT64_C(  -759.47), SIMDE_FLOAT64_C(   -24.29),
+      SIMDE_FLOAT64_C(   456.03), SIMDE_FLOAT64_C(  -485.24), SIMDE_FLOAT64_C(  -406.06), SIMDE_FLOAT64_C(   177.59),
+      SIMDE_FLOAT64_C(  -879.07), SIMDE_FLOAT64_C(  -166.16), SIMDE_FLOAT64_C(   155.23) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_f64_m(pv, av, bv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+
+    ev = simde_svmin_f64_m(pv, av, bv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C( 113), -INT8_C(  95),  INT8_C(  42), -INT8_C(  48),  INT8_C(   2), -INT8_C(  36),  INT8_C(  92), -INT8_C( 108),
+       INT8_C(  41), -INT8_C(  96), -INT8_C(  92),  INT8_C(  56), -INT8_C(  98),  INT8_C(  99),  INT8_C(  62),  INT8_C(  58),
+      -INT8_C(  22),  INT8_C(  23), -INT8_C(  84),  INT8_C(  21),  INT8_C(  36), -INT8_C( 106), -INT8_C(  63), -INT8_C(  55),
+       INT8_C( 118), -INT8_C(  40), -INT8_C(   7), -INT8_C(  60), -INT8_C(  81), -INT8_C( 114),  INT8_C( 124),  INT8_C(  32),
+       INT8_C(  47), -INT8_C(  89), -INT8_C(  16),  INT8_C(  49), -INT8_C( 125),  INT8_C(  76), -INT8_C(  59), -INT8_C(  84),
+      -INT8_C(  20),  INT8_C( 105), -INT8_C(  27), -INT8_C( 117), -INT8_C(  51),  INT8_C(  35), -INT8_C(  59), -INT8_C(  73),
+       INT8_C(  59),  INT8_C( 114), -INT8_C(  52),  INT8_C(  95),  INT8_C(   8), -INT8_C( 114),  INT8_C(  41),  INT8_C( 126),
+       INT8_C( 102),  INT8_C(  34),  INT8_C(  66),  INT8_C(  21), -INT8_C(  80), -INT8_C(  65),  INT8_C(  53), -INT8_C(  33),
+       INT8_C( 102),  INT8_C(  37),  INT8_C(  16), -INT8_C(  23),  INT8_C( 114), -INT8_C(  42), -INT8_C( 107),  INT8_C(  94),
+       INT8_C(  63),  INT8_C( 122), -INT8_C(  23),  INT8_C(  12), -INT8_C(  98), -INT8_C(  81), -INT8_C(  61), -INT8_C(  39),
+       INT8_C(  33), -INT8_C( 112),  INT8_C(  56),  INT8_C(  41),  INT8_C(  30),  INT8_C(  97), -INT8_C(  89), -INT8_C( 124),
+      -INT8_C( 124), -INT8_C(  22), -INT8_C( 103),  INT8_C(  52), -INT8_C(  87), -INT8_C(  50),  INT8_C(  20),  INT8_C(  15),
+      -INT8_C(  13),  INT8_C(  36), -INT8_C(   8),  INT8_C( 101), -INT8_C(   6), -INT8_C( 115), -INT8_C(  60),  INT8_C(  58),
+       INT8_C(   8), -INT8_C(  83),  INT8_C(  70), -INT8_C(  90),  INT8_C(  92),  INT8_C(  10),      INT8_MAX,  INT8_C( 125),
+      -INT8_C( 102), -INT8_C(  73), -INT8_C(  90), -INT8_C(  72),  INT8_C(  25),  INT8_C(  78),  INT8_C(  60), -INT8_C(  99),
+       INT8_C(  56), -INT8_C(  43), -INT8_C(  47), -INT8_C(  31), -INT8_C(  93), -INT8_C(  27), -INT8_C(  16), -INT8_C( 106),
+       INT8_C(  10), -INT8_C(  24), -INT8_C(   4),  INT8_C(   4),  INT8_C( 117), -INT8_C(  64),  INT8_C(  62),  INT8_C( 125),
+       INT8_C( 109), -INT8_C( 123),  INT8_C(  35), -INT8_C(  54), -INT8_C( 113), -INT8_C(  94),  INT8_C(  71),  INT8_C(  41),
+       INT8_C(  90), -INT8_C(  18), -INT8_C(  31),  INT8_C( 115),  INT8_C(  60),  INT8_C(  29),  INT8_C(  16),  INT8_C( 116),
+      -INT8_C(  14), -INT8_C(  31),  INT8_C(  85), -INT8_C( 107), -INT8_C(  57),  INT8_C(  69),  INT8_C(  43), -INT8_C(  47),
+       INT8_C(  45),  INT8_C(  39), -INT8_C(  43), -INT8_C(  94), -INT8_C(  25),  INT8_C(  20),  INT8_C(  32),  INT8_C(  85),
+      -INT8_C( 103),  INT8_C(  67),  INT8_C(  31),  INT8_C(  40), -INT8_C(  26),  INT8_C( 102),  INT8_C(  81),  INT8_C(  64),
+       INT8_C(  84),  INT8_C(  50), -INT8_C(  77), -INT8_C( 112),  INT8_C(  79), -INT8_C(  61),  INT8_C(   4),  INT8_C(  65),
+      -INT8_C(  92),  INT8_C(  89), -INT8_C(  42),  INT8_C( 107), -INT8_C(  98),  INT8_C(   1),  INT8_C(  60), -INT8_C(  53),
+       INT8_C(  41),  INT8_C(  18),  INT8_C( 110),  INT8_C(  16),  INT8_C(  38), -INT8_C( 114),  INT8_C( 101), -INT8_C(  65),
+      -INT8_C(  47), -INT8_C( 124), -INT8_C(  25), -INT8_C(  73), -INT8_C(  21),  INT8_C(  56), -INT8_C(   9),  INT8_C(  63),
+       INT8_C( 106), -INT8_C(  86), -INT8_C(  48), -INT8_C(  71),  INT8_C( 109), -INT8_C(  44), -INT8_C(   6),  INT8_C(  18),
+       INT8_C(  46), -INT8_C(  48),  INT8_C( 125), -INT8_C(  52), -INT8_C(  47), -INT8_C(  70), -INT8_C( 104), -INT8_C(   6),
+      -INT8_C(  52),  INT8_C(   6),  INT8_C(  11), -INT8_C(  14), -INT8_C( 108),  INT8_C( 112), -INT8_C(  79),  INT8_C( 101),
+      -INT8_C(  11), -INT8_C( 104),  INT8_C(  29), -INT8_C(  32), -INT8_C(  48),  INT8_C(  20),  INT8_C(  31),  INT8_C(  58),
+      -INT8_C(  65), -INT8_C(  17), -INT8_C(  13),  INT8_C(  44), -INT8_C(  60), -INT8_C(  19),  INT8_C(  62), -INT8_C(  14),
+      -INT8_C(  67), -INT8_C(  68), -INT8_C(  66), -INT8_C( 114),  INT8_C( 118),  INT8_C(  86), -INT8_C( 119),  INT8_C(  66),
+       INT8_C(  92), -INT8_C( 108),  INT8_C(  52), -INT8_C(  16),  INT8_C(   4), -INT8_C(  27),  INT8_C(  86), -INT8_C(   7),
+       INT8_C( 125),  INT8_C( 115), -INT8_C(  39),  INT8_C(  77), -INT8_C( 121), -INT8_C(   7), -INT8_C( 121),  INT8_C(  70),
+      -INT8_C(  24),  INT8_C( 122),  INT8_C( 115), -INT8_C(  84),  INT8_C( 103), -INT8_C(  79), -INT8_C(  98),  INT8_C(  36),
+       INT8_C( 109),  INT8_C(  93), -INT8_C(  78), -INT8_C(  29), -INT8_C(  77),  INT8_C(  59),  INT8_C(  37),  INT8_C(  16),
+      -INT8_C(  49),  INT8_C(  89),  INT8_C(   0), -INT8_C(  44),  INT8_C(  62),  INT8_C(  86), -INT8_C(  51), -INT8_C(  69),
+      -INT8_C(  55), -INT8_C(  89),  INT8_C(   8),  INT8_C(  81), -INT8_C(  96), -INT8_C( 113), -INT8_C( 105), -INT8_C( 120),
+       INT8_C(   9),  INT8_C(  10),  INT8_C(  53),  INT8_C( 112), -INT8_C(  68), -INT8_C(  45), -INT8_C( 108),  INT8_C(  41),
+       INT8_C(  48),  INT8_C(  71),  INT8_C(  13), -INT8_C(  28), -INT8_C( 126),  INT8_C(  50), -INT8_C(  12),  INT8_C(  82),
+      -INT8_C( 116), -INT8_C(  12),  INT8_C(  38), -INT8_C(  54),  INT8_C(  75), -INT8_C(  13), -INT8_C( 122),  INT8_C(  20),
+      -INT8_C( 102), -INT8_C( 114),  INT8_C( 101),  INT8_C(  58),  INT8_C(  30), -INT8_C(   3), -INT8_C(  61),  INT8_C(  39),
+       INT8_C(   7), -INT8_C(   8), -INT8_C( 104), -INT8_C(  61), -INT8_C(  53),  INT8_C(  44), -INT8_C(  19), -INT8_C(   4),
+       INT8_C( 115), -INT8_C(   6), -INT8_C(  32), -INT8_C(  10),  INT8_C(  44), -INT8_C(  44),  INT8_C(  72), -INT8_C(  72),
+      -INT8_C(  56),  INT8_C( 110), -INT8_C( 125),  INT8_C(  19),  INT8_C(  97),  INT8_C(   9),  INT8_C(  40), -INT8_C(   4),
+      -INT8_C( 105), -INT8_C( 115),  INT8_C(  54), -INT8_C(  75), -INT8_C( 118), -INT8_C(   7), -INT8_C(  35), -INT8_C( 110),
+      -INT8_C(  15),  INT8_C( 117),  INT8_C(  85), -INT8_C(  67), -INT8_C(  95),  INT8_C(  66), -INT8_C(  71),  INT8_C(  21),
+       INT8_C(  60), -INT8_C( 103),  INT8_C(  11),  INT8_C( 105),  INT8_C( 109),  INT8_C(  83),  INT8_C(  33),  INT8_C(  53),
+      -INT8_C(  63), -INT8_C(  92),  INT8_C(  73),  INT8_C(  34), -INT8_C(  83),  INT8_C( 113),  INT8_C(  30),  INT8_C(  69),
+      -INT8_C(   2),  INT8_C(  85), -INT8_C(   6), -INT8_C( 119),  INT8_C(  78), -INT8_C(  41),  INT8_C(  27),  INT8_C(  64),
+       INT8_C(  76),  INT8_C( 112), -INT8_C(   3), -INT8_C(  18), -INT8_C(  77), -INT8_C(  74),  INT8_C(   3), -INT8_C(  17),
+       INT8_C(  79),  INT8_C(  14),  INT8_C(  88), -INT8_C(  68),  INT8_C(  97),  INT8_C( 122), -INT8_C(  15),  INT8_C(  34),
+       INT8_C(  30),  INT8_C(  58),  INT8_C(  68), -INT8_C(  52), -INT8_C(  85),  INT8_C(  99),  INT8_C(  17), -INT8_C(  86),
+      -INT8_C(  72),  INT8_C(  11),  INT8_C(  51),  INT8_C(   6), -INT8_C(  29),  INT8_C(  78),  INT8_C(  70),  INT8_C(  47),
+      -INT8_C(  66),  INT8_C(  67),  INT8_C(  29),  INT8_C( 113), -INT8_C(   7),  INT8_C(  32),  INT8_C(  97),  INT8_C(  72),
+       INT8_C(  46), -INT8_C(  71),  INT8_C(   4), -INT8_C( 113),  INT8_C(  51), -INT8_C(  10), -INT8_C(  79),  INT8_C(  82),
+       INT8_C(  48), -INT8_C(  10),  INT8_C(  30), -INT8_C(  36),  INT8_C(  89),  INT8_C(  47), -INT8_C( 122),  INT8_C(  17),
+       INT8_C(  58), -INT8_C(  71),  INT8_C(  23),  INT8_C(  29),  INT8_C(   7),  INT8_C(  94),  INT8_C(  77), -INT8_C(  59),
+      -INT8_C(  95),  INT8_C( 106),  INT8_C(  55), -INT8_C( 101), -INT8_C( 117), -INT8_C( 104), -INT8_C(  29), -INT8_C(  71),
+       INT8_C(  81), -INT8_C(  24),  INT8_C(  73), -INT8_C( 123), -INT8_C(  34), -INT8_C(   6), -INT8_C(  41),  INT8_C(  14),
+      -INT8_C(  16), -INT8_C(  11), -INT8_C(  22),  INT8_C(  73),  INT8_C(  36),  INT8_C( 112),  INT8_C(  90),  INT8_C(  94),
+       INT8_C(  41),  INT8_C( 114),  INT8_C( 124),  INT8_C(  48), -INT8_C(  48), -INT8_C(  55), -INT8_C(  10),  INT8_C( 113),
+       INT8_C(  51),  INT8_C(  45),  INT8_C(  12), -INT8_C(  66), -INT8_C(  59), -INT8_C(  16),  INT8_C( 120),  INT8_C(  22),
+      -INT8_C(  40), -INT8_C(  63), -INT8_C( 101), -INT8_C(  74), -INT8_C(  69),  INT8_C( 114), -INT8_C(  60), -INT8_C(  84),
+       INT8_C( 103), -INT8_C(  81), -INT8_C(  11), -INT8_C( 117),  INT8_C(  31),  INT8_C(  80), -INT8_C(  22),  INT8_C(  73),
+      -INT8_C(  62),  INT8_C( 102),  INT8_C( 121), -INT8_C( 110),  INT8_C(  47),  INT8_C( 111),  INT8_C(   3),  INT8_C(  98),
+      -INT8_C( 100),  INT8_C(  16),  INT8_C(  33),  INT8_C(  97),  INT8_C(   0), -INT8_C( 103),  INT8_C( 120), -INT8_C(  40),
+       INT8_C(  90),  INT8_C(  19), -INT8_C( 114),  INT8_C(  21), -INT8_C( 122),  INT8_C(  82), -INT8_C(  63), -INT8_C(  19),
+       INT8_C(   1), -INT8_C(  73),  INT8_C( 121),  INT8_C(  33),  INT8_C(   7),  INT8_C(  99),  INT8_C( 106), -INT8_C(  55),
+      -INT8_C(  55), -INT8_C(  29),  INT8_C(  91), -INT8_C(   8),  INT8_C(  83),  INT8_C(  94),  INT8_C(  90), -INT8_C(  17),
+       INT8_C( 110),  INT8_C( 123),  INT8_C(  81),  INT8_C( 110),  INT8_C(  20), -INT8_C(  55),  INT8_C(  70),  INT8_C( 110),
+      -INT8_C(  36), -INT8_C(  44), -INT8_C( 124),  INT8_C(  98),  INT8_C(  39),  INT8_C(  69),  INT8_C(  80),  INT8_C(  40),
+      -INT8_C(   4), -INT8_C(  55),  INT8_C(  73),  INT8_C(   3),  INT8_C(  44), -INT8_C(  77), -INT8_C(  52), -INT8_C(  11),
+      -INT8_C( 105),  INT8_C(  39), -INT8_C(  19), -INT8_C(  22), -INT8_C( 122),  INT8_C(  71), -INT8_C(  39), -INT8_C(  12),
+      -INT8_C(  61),  INT8_C(  42),  INT8_C(  99), -INT8_C(  41), -INT8_C(  13), -INT8_C(  87),  INT8_C(  70), -INT8_C(  48),
+       INT8_C( 126), -INT8_C(  54),  INT8_C(  50), -INT8_C(  91),  INT8_C(  15), -INT8_C( 126), -INT8_C(  51),  INT8_C(  12),
+       INT8_C(  75),  INT8_C(  23),  INT8_C(  15),  INT8_C( 119), -INT8_C(  54), -INT8_C(  36),  INT8_C( 108),  INT8_C(  97),
+       INT8_C(   3),  INT8_C(  89),  INT8_C(  75), -INT8_C( 119), -INT8_C(  95),  INT8_C(  37),  INT8_C( 126),  INT8_C( 100),
+       INT8_C(  79), -INT8_C(  31),  INT8_C(  59),  INT8_C(  67), -INT8_C( 118), -INT8_C( 127),  INT8_C(  19),  INT8_C(   8),
+       INT8_C(  75),  INT8_C(  69), -INT8_C(  83),  INT8_C(  91), -INT8_C(  56),  INT8_C( 123),  INT8_C( 103),  INT8_C(  19),
+      -INT8_C( 110),  INT8_C( 118), -INT8_C( 117),  INT8_C(  92),  INT8_C(  82), -INT8_C(   9), -INT8_C(  66),  INT8_C(  86),
+       INT8_C(  81),  INT8_C(   9), -INT8_C(  33), -INT8_C(  14),  INT8_C(  46),  INT8_C(  93),  INT8_C(  86),  INT8_C( 126),
+       INT8_C(  62), -INT8_C( 111), -INT8_C(  63), -INT8_C(  55),  INT8_C(  19), -INT8_C(  44), -INT8_C(  47),  INT8_C(  94),
+       INT8_C(  25),      INT8_MAX, -INT8_C(  71), -INT8_C(  31), -INT8_C(   6),  INT8_C(  32), -INT8_C(  11), -INT8_C( 116),
+      -INT8_C( 105),      INT8_MIN, -INT8_C(  24), -INT8_C(  23),  INT8_C( 119), -INT8_C(  90),  INT8_C(  63), -INT8_C(  56),
+      -INT8_C(  80),  INT8_C(  31), -INT8_C(  70), -INT8_C(  34),  INT8_C( 124),  INT8_C(  16),  INT8_C(  92), -INT8_C(  69),
+      -INT8_C(  94),  INT8_C(  29), -INT8_C( 124), -INT8_C(  75), -INT8_C(  15),  INT8_C(  85),  INT8_C(  19),  INT8_C(  11),
+      -INT8_C(  44), -INT8_C(  51), -INT8_C(  20), -INT8_C(  50), -INT8_C(  19), -INT8_C(  31),  INT8_C(  90), -INT8_C( 124),
+       INT8_C(  97),  INT8_C(  67),  INT8_C( 110), -INT8_C(  39), -INT8_C(  23), -INT8_C(  83), -INT8_C(  95), -INT8_C( 103),
+      -INT8_C(  52),  INT8_C(  92),  INT8_C( 120),  INT8_C(  73),  INT8_C( 108), -INT8_C(  44),  INT8_C(   4),  INT8_C(  14),
+      -INT8_C(  14), -INT8_C( 120), -INT8_C(  61), -INT8_C(  29), -INT8_C(  35), -INT8_C(  41), -INT8_C(  18), -INT8_C(  78),
+      -INT8_C(  92), -INT8_C(  37),      INT8_MIN, -INT8_C( 111), -INT8_C(  68), -INT8_C(  37),  INT8_C(  22),  INT8_C(  30),
+       INT8_C(  30), -INT8_C( 124), -INT8_C(   9),  INT8_C(   7),  INT8_C(  49), -INT8_C( 104), -INT8_C(  95), -INT8_C(   2),
+      -INT8_C(  12),  INT8_C(  25),  INT8_C(  71),  INT8_C(  97), -INT8_C(  19),  INT8_C(  75),  INT8_C( 111), -INT8_C(  33),
+      -INT8_C(  45),  INT8_C(  51), -INT8_C(  61), -INT8_C(  80),  INT8_C(  10), -INT8_C(  79),  INT8_C(  98), -INT8_C(  82),
+      -INT8_C( 116), -INT8_C(  29),  INT8_C(  63),  INT8_C(  73), -INT8_C(  66),  INT8_C(  85),  INT8_C( 103), -INT8_C(  36),
+      -INT8_C(  39),  INT8_C(  94), -INT8_C(  29),  INT8_C(  11), -INT8_C(  10), -INT8_C( 124),  INT8_C(   9), -INT8_C(  21),
+      -INT8_C(  99),  INT8_C(  80),  INT8_C(  76), -INT8_C( 117), -INT8_C( 101), -INT8_C(  69),  INT8_C( 106),  INT8_C( 110),
+      -INT8_C(  18),  INT8_C(  45),  INT8_C(  30), -INT8_C(   8), -INT8_C(  33), -INT8_C( 127), -INT8_C(  90),  INT8_C( 107),
+       INT8_C( 100), -INT8_C(  26), -INT8_C(  76),  INT8_C(  34),  INT8_C(  59),  INT8_C(  27), -INT8_C(   2),  INT8_C(  21),
+       INT8_C( 121), -INT8_C(  31),  INT8_C(  32),  INT8_C( 112),  INT8_C( 102),  INT8_C(  41),  INT8_C(  91),  INT8_C(   3),
+       INT8_C( 121), -INT8_C(  89), -INT8_C( 114),  INT8_C(  20),  INT8_C(  98), -INT8_C(   7), -INT8_C( 126),  INT8_C(  81),
+       INT8_C(  38), -INT8_C(  96),  INT8_C(  73),  INT8_C(   5),  INT8_C(  33), -INT8_C(  16),  INT8_C( 113), -INT8_C( 123),
+      -INT8_C(  42),  INT8_C(  37), -INT8_C(  89),  INT8_C(  17),  INT8_C(  65), -INT8_C(  91),  INT8_C(  38), -INT8_C(  70),
+      -INT8_C( 121),  INT8_C(  70),  INT8_C(  42), -INT8_C(  19),  INT8_C( 111), -INT8_C( 123), -INT8_C(  16), -INT8_C(  24),
+       INT8_C(  44),      INT8_MAX, -INT8_C(   4), -INT8_C( 113),  INT8_C( 120),  INT8_C( 126), -INT8_C(  32), -INT8_C(  98),
+       INT8_C(  31),  INT8_C(  41), -INT8_C(  92),  INT8_C(  64),  INT8_C(  25),  INT8_C(  21), -INT8_C(  58), -INT8_C(  17),
+       INT8_C(  58),  INT8_C( 109),  INT8_C(   1),  INT8_C( 123),  INT8_C(  19),  INT8_C(  39),  INT8_C(  54), -INT8_C( 102),
+       INT8_C( 110),  INT8_C(  96), -INT8_C( 121), -INT8_C(  35), -INT8_C(  26),  INT8_C( 119), -INT8_C(  58),  INT8_C(  18),
+      -INT8_C(  10), -INT8_C(  62), -INT8_C(  95),  INT8_C( 110),  INT8_C(  65), -INT8_C( 127),  INT8_C(  13),  INT8_C(  96),
+      -INT8_C(  85), -INT8_C(  79), -INT8_C(  96), -INT8_C(  60), -INT8_C(  58),  INT8_C( 102), -INT8_C(  76),  INT8_C(   0),
+      -INT8_C(  44), -INT8_C(  75),  INT8_C( 124), -INT8_C(  25), -INT8_C(  36), -INT8_C(  78), -INT8_C( 127),  INT8_C(  74),
+       INT8_C(  18),  INT8_C(   8),  INT8_C(  40), -INT8_C(   8) };
+  static const int8_t b =  INT8_C( 102);
+  static const int8_t e[] =
+    {  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 108),
+       INT8_C(  41),  INT8_C(   0), -INT8_C(  92),  INT8_C(  56), -INT8_C(  98),  INT8_C(   0),  INT8_C(  62),  INT8_C(  58),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  84),  INT8_C(   0),  INT8_C(   0), -INT8_C( 106), -INT8_C(  63), -INT8_C(  55),
+       INT8_C(   0), -INT8_C(  40),  INT8_C(   0), -INT8_C(  60), -INT8_C(  81), -INT8_C( 114),  INT8_C( 102),  INT8_C(   0),
+       INT8_C(  47), -INT8_C(  89),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  59), -INT8_C(  84),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  51),  INT8_C(  35),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(  41),  INT8_C(   0),
+       INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  80),  INT8_C(   0),  INT8_C(   0), -INT8_C(  33),
+       INT8_C( 102),  INT8_C(  37),  INT8_C(  16), -INT8_C(  23),  INT8_C( 102), -INT8_C(  42), -INT8_C( 107),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 102), -INT8_C(  23),  INT8_C(   0), -INT8_C(  98), -INT8_C(  81),  INT8_C(   0), -INT8_C(  39),
+       INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(  41),  INT8_C(  30),  INT8_C(   0),  INT8_C(   0), -INT8_C( 124),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 103),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(  20),  INT8_C(  15),
+      -INT8_C(  13),  INT8_C(  36), -INT8_C(   8),  INT8_C( 101), -INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(  58),
+       INT8_C(   8),  INT8_C(   0),  INT8_C(  70), -INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),
+      -INT8_C( 102), -INT8_C(  73),  INT8_C(   0), -INT8_C(  72),  INT8_C(  25),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  56), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 102),  INT8_C(   0),  INT8_C(  35), -INT8_C(  54),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  31),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  14), -INT8_C(  31),  INT8_C(  85), -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  45),  INT8_C(   0), -INT8_C(  43),  INT8_C(   0), -INT8_C(  25),  INT8_C(  20),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  31),  INT8_C(  40), -INT8_C(  26),  INT8_C(   0),  INT8_C(  81),  INT8_C(  64),
+       INT8_C(   0),  INT8_C(  50),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(  65),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  42),  INT8_C(   0), -INT8_C(  98),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0), -INT8_C( 114),  INT8_C( 101),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 124), -INT8_C(  25), -INT8_C(  73), -INT8_C(  21),  INT8_C(  56), -INT8_C(   9),  INT8_C(  63),
+       INT8_C(   0), -INT8_C(  86),  INT8_C(   0), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0), -INT8_C(   6),  INT8_C(  18),
+       INT8_C(   0),  INT8_C(   0),  INT8_C( 102), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  52),  INT8_C(   6),  INT8_C(  11), -INT8_C(  14), -INT8_C( 108),  INT8_C( 102), -INT8_C(  79),  INT8_C( 101),
+       INT8_C(   0), -INT8_C( 104),  INT8_C(  29),  INT8_C(   0), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  17), -INT8_C(  13),  INT8_C(   0), -INT8_C(  60),  INT8_C(   0),  INT8_C(  62),  INT8_C(   0),
+      -INT8_C(  67), -INT8_C(  68),  INT8_C(   0), -INT8_C( 114),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 102), -INT8_C(  39),  INT8_C(   0),  INT8_C(   0), -INT8_C(   7),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 102),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0),  INT8_C(  36),
+       INT8_C( 102),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(  37),  INT8_C(  16),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  62),  INT8_C(   0), -INT8_C(  51), -INT8_C(  69),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  81), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  10),  INT8_C(   0),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0),  INT8_C(   0),  INT8_C(  41),
+       INT8_C(  48),  INT8_C(  71),  INT8_C(  13),  INT8_C(   0),  INT8_C(   0),  INT8_C(  50), -INT8_C(  12),  INT8_C(  82),
+      -INT8_C( 116), -INT8_C(  12),  INT8_C(  38),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  20),
+      -INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(  58),  INT8_C(   0),  INT8_C(   0), -INT8_C(  61),  INT8_C(  39),
+       INT8_C(   0), -INT8_C(   8), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44), -INT8_C(  19), -INT8_C(   4),
+       INT8_C( 102), -INT8_C(   6),  INT8_C(   0), -INT8_C(  10),  INT8_C(   0), -INT8_C(  44),  INT8_C(   0), -INT8_C(  72),
+      -INT8_C(  56),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  97),  INT8_C(   9),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 105), -INT8_C( 115),  INT8_C(  54),  INT8_C(   0), -INT8_C( 118), -INT8_C(   7), -INT8_C(  35),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 102),  INT8_C(  85), -INT8_C(  67), -INT8_C(  95),  INT8_C(  66), -INT8_C(  71),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 103),  INT8_C(   0),  INT8_C( 102),  INT8_C( 102),  INT8_C(  83),  INT8_C(  33),  INT8_C(  53),
+       INT8_C(   0), -INT8_C(  92),  INT8_C(  73),  INT8_C(  34), -INT8_C(  83),  INT8_C( 102),  INT8_C(   0),  INT8_C(  69),
+       INT8_C(   0),  INT8_C(  85), -INT8_C(   6),  INT8_C(   0),  INT8_C(   0), -INT8_C(  41),  INT8_C(  27),  INT8_C(  64),
+       INT8_C(  76),  INT8_C( 102), -INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3), -INT8_C(  17),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  68),  INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  68), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  86),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  29),  INT8_C(  78),  INT8_C(   0),  INT8_C(  47),
+      -INT8_C(  66),  INT8_C(  67),  INT8_C(  29),  INT8_C( 102),  INT8_C(   0),  INT8_C(  32),  INT8_C(  97),  INT8_C(   0),
+       INT8_C(  46),  INT8_C(   0),  INT8_C(   4), -INT8_C( 113),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  10),  INT8_C(  30), -INT8_C(  36),  INT8_C(  89),  INT8_C(   0),  INT8_C(   0),  INT8_C(  17),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  94),  INT8_C(  77), -INT8_C(  59),
+      -INT8_C(  95),  INT8_C( 102),  INT8_C(  55), -INT8_C( 101),  INT8_C(   0), -INT8_C( 104),  INT8_C(   0), -INT8_C(  71),
+       INT8_C(  81),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  14),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73),  INT8_C(   0),  INT8_C( 102),  INT8_C(  90),  INT8_C(  94),
+       INT8_C(  41),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),
+       INT8_C(  51),  INT8_C(  45),  INT8_C(  12),  INT8_C(   0), -INT8_C(  59), -INT8_C(  16),  INT8_C( 102),  INT8_C(   0),
+      -INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  69),  INT8_C( 102), -INT8_C(  60), -INT8_C(  84),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  11), -INT8_C( 117),  INT8_C(  31),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73),
+      -INT8_C(  62),  INT8_C( 102),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 100),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),
+       INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 122),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   1), -INT8_C(  73),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(  99),  INT8_C(   0), -INT8_C(  55),
+      -INT8_C(  55),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  83),  INT8_C(   0),  INT8_C(  90), -INT8_C(  17),
+       INT8_C( 102),  INT8_C( 102),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0), -INT8_C(  55),  INT8_C(  70),  INT8_C( 102),
+      -INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(  98),  INT8_C(   0),  INT8_C(   0),  INT8_C(  80),  INT8_C(  40),
+       INT8_C(   0), -INT8_C(  55),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44), -INT8_C(  77), -INT8_C(  52), -INT8_C(  11),
+      -INT8_C( 105),  INT8_C(  39), -INT8_C(  19),  INT8_C(   0), -INT8_C( 122),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70), -INT8_C(  48),
+       INT8_C(   0), -INT8_C(  54),  INT8_C(  50), -INT8_C(  91),  INT8_C(   0), -INT8_C( 126),  INT8_C(   0),  INT8_C(  12),
+       INT8_C(   0),  INT8_C(  23),  INT8_C(  15),  INT8_C( 102),  INT8_C(   0), -INT8_C(  36),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  37),  INT8_C( 102),  INT8_C( 100),
+       INT8_C(  79), -INT8_C(  31),  INT8_C(   0),  INT8_C(  67), -INT8_C( 118), -INT8_C( 127),  INT8_C(  19),  INT8_C(   0),
+       INT8_C(  75),  INT8_C(  69), -INT8_C(  83),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),
+      -INT8_C( 110),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86),
+       INT8_C(  81),  INT8_C(   9), -INT8_C(  33),  INT8_C(   0),  INT8_C(  46),  INT8_C(   0),  INT8_C(  86),  INT8_C( 102),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  19),  INT8_C(   0),  INT8_C(   0),  INT8_C(  94),
+       INT8_C(  25),  INT8_C( 102), -INT8_C(  71), -INT8_C(  31), -INT8_C(   6),  INT8_C(  32),  INT8_C(   0), -INT8_C( 116),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),  INT8_C(  63),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  31),  INT8_C(   0), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  85),  INT8_C(   0),  INT8_C(  11),
+       INT8_C(   0), -INT8_C(  51), -INT8_C(  20),  INT8_C(   0), -INT8_C(  19),  INT8_C(   0),  INT8_C(  90), -INT8_C( 124),
+       INT8_C(   0),  INT8_C(  67),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  95), -INT8_C( 103),
+      -INT8_C(  52),  INT8_C(  92),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  44),  INT8_C(   0),  INT8_C(  14),
+      -INT8_C(  14), -INT8_C( 120), -INT8_C(  61), -INT8_C(  29), -INT8_C(  35),  INT8_C(   0), -INT8_C(  18), -INT8_C(  78),
+      -INT8_C(  92), -INT8_C(  37),  INT8_C(   0), -INT8_C( 111), -INT8_C(  68), -INT8_C(  37),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  30), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(  49), -INT8_C( 104), -INT8_C(  95), -INT8_C(   2),
+      -INT8_C(  12),  INT8_C(   0),  INT8_C(  71),  INT8_C(  97),  INT8_C(   0),  INT8_C(  75),  INT8_C( 102), -INT8_C(  33),
+      -INT8_C(  45),  INT8_C(  51), -INT8_C(  61),  INT8_C(   0),  INT8_C(  10), -INT8_C(  79),  INT8_C(   0), -INT8_C(  82),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  85),  INT8_C(   0), -INT8_C(  36),
+       INT8_C(   0),  INT8_C(  94),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0), -INT8_C( 101), -INT8_C(  69),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  45),  INT8_C(  30), -INT8_C(   8),  INT8_C(   0), -INT8_C( 127), -INT8_C(  90),  INT8_C(   0),
+       INT8_C( 100), -INT8_C(  26),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),  INT8_C(  91),  INT8_C(   3),
+       INT8_C(   0), -INT8_C(  89),  INT8_C(   0),  INT8_C(  20),  INT8_C(   0),  INT8_C(   0), -INT8_C( 126),  INT8_C(  81),
+       INT8_C(  38), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  42),  INT8_C(  37),  INT8_C(   0),  INT8_C(  17),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C(  70),
+      -INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102), -INT8_C( 123),  INT8_C(   0), -INT8_C(  24),
+       INT8_C(   0),  INT8_C( 102),  INT8_C(   0), -INT8_C( 113),  INT8_C( 102),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),
+       INT8_C(  31),  INT8_C(  41), -INT8_C(  92),  INT8_C(   0),  INT8_C(  25),  INT8_C(   0), -INT8_C(  58),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 102),  INT8_C(   0),  INT8_C( 102),  INT8_C(   0),  INT8_C(  39),  INT8_C(   0), -INT8_C( 102),
+       INT8_C(   0),  INT8_C(  96),  INT8_C(   0), -INT8_C(  35),  INT8_C(   0),  INT8_C( 102), -INT8_C(  58),  INT8_C(  18),
+       INT8_C(   0), -INT8_C(  62), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0), -INT8_C( 127),  INT8_C(  13),  INT8_C(   0),
+      -INT8_C(  85),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102), -INT8_C(  76),  INT8_C(   0),
+      -INT8_C(  44), -INT8_C(  75),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   8) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_n_s8_z(pv, av, b);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    ev = simde_svmin_n_s8_z(pv, av, b);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C( 124), -INT8_C(  48), -INT8_C(  95),  INT8_C(  81),  INT8_C( 114),  INT8_C(  66), -INT8_C( 117), -INT8_C(  29),
+       INT8_C( 115), -INT8_C( 103),  INT8_C(  61), -INT8_C(  73),  INT8_C(  63),  INT8_C( 126),  INT8_C(  26), -INT8_C( 100),
+       INT8_C(  30),  INT8_C( 114),  INT8_C( 122),  INT8_C( 111), -INT8_C(  37),  INT8_C(  56), -INT8_C(  98),  INT8_C(  18),
+      -INT8_C(   6), -INT8_C(  58),  INT8_C(  39),  INT8_C(  15),  INT8_C(  83), -INT8_C(  54),  INT8_C(  53), -INT8_C(  48),
+      -INT8_C( 102), -INT8_C(  42),  INT8_C(  33),  INT8_C(  12),  INT8_C(  24), -INT8_C(  83), -INT8_C(  17), -INT8_C( 117),
+       INT8_C(  70),  INT8_C(  44),  INT8_C(  67), -INT8_C( 123), -INT8_C(  85),  INT8_C(  93),  INT8_C(  33), -INT8_C(  55),
+      -INT8_C(  48), -INT8_C( 100),  INT8_C(  56), -INT8_C(  85), -INT8_C(  44), -INT8_C(  41), -INT8_C(  67), -INT8_C(  49),
+      -INT8_C(  99), -INT8_C(  27), -INT8_C(  34), -INT8_C(  16), -INT8_C(  81),  INT8_C(  19), -INT8_C(  64),  INT8_C(  73),
+      -INT8_C(  23), -INT8_C(  30),  INT8_C(  86),  INT8_C(   1), -INT8_C( 113),  INT8_C(  69), -INT8_C( 115), -INT8_C(  43),
+       INT8_C( 114), -INT8_C(  48),  INT8_C(  90),  INT8_C(  29),  INT8_C(  45),  INT8_C( 123), -INT8_C(  26), -INT8_C(   3),
+       INT8_C(  23),  INT8_C(  31), -INT8_C(  88), -INT8_C(  20), -INT8_C(  10),  INT8_C( 102), -INT8_C(  69), -INT8_C( 109),
+       INT8_C(  75), -INT8_C( 103), -INT8_C( 125), -INT8_C(   6), -INT8_C(  84),  INT8_C(  68),  INT8_C(  67), -INT8_C( 107),
+       INT8_C(  38), -INT8_C( 103), -INT8_C( 106), -INT8_C(  75), -INT8_C(  33),  INT8_C(  35), -INT8_C( 118),  INT8_C(  81),
+      -INT8_C(  13), -INT8_C(  28),  INT8_C( 110),  INT8_C(  33),  INT8_C(  95),  INT8_C(  84),  INT8_C(  30),  INT8_C( 119),
+       INT8_C( 115), -INT8_C(  57),  INT8_C(  99),  INT8_C( 105),  INT8_C(  45),  INT8_C(  30), -INT8_C(   4),  INT8_C( 120),
+      -INT8_C(  73),      INT8_MIN,  INT8_C( 114),  INT8_C(  99), -INT8_C(  60), -INT8_C(  75), -INT8_C(   8), -INT8_C(  22),
+       INT8_C(  79), -INT8_C( 114), -INT8_C(  97),  INT8_C(  46), -INT8_C(  78),  INT8_C(  41),      INT8_MAX, -INT8_C(  91),
+       INT8_C(  13), -INT8_C(  19), -INT8_C(  58),  INT8_C( 108),  INT8_C(  65), -INT8_C(  27), -INT8_C(  29), -INT8_C(  75),
+      -INT8_C(  84),  INT8_C(  70),  INT8_C(  30), -INT8_C(  39),  INT8_C( 100),  INT8_C(  27),  INT8_C(  81),  INT8_C(  27),
+      -INT8_C( 101), -INT8_C(  61),  INT8_C( 126),  INT8_C(  95),  INT8_C( 120),  INT8_C( 118),  INT8_C(  73), -INT8_C(  57),
+       INT8_C(   5), -INT8_C(  24), -INT8_C(  11), -INT8_C(  73),  INT8_C(  17),  INT8_C( 116),  INT8_C(  92),  INT8_C(  30),
+       INT8_C(  97),  INT8_C(  35), -INT8_C( 118), -INT8_C(  93),  INT8_C(   8),  INT8_C( 110),  INT8_C(  88), -INT8_C(  76),
+      -INT8_C(  76),  INT8_C( 118), -INT8_C( 115),  INT8_C(  25), -INT8_C( 111), -INT8_C(  34),  INT8_C(  52),  INT8_C(  44),
+      -INT8_C(  95), -INT8_C(  77), -INT8_C( 117),  INT8_C(  25),  INT8_C(  41), -INT8_C(  44), -INT8_C(  31),  INT8_C(  46),
+      -INT8_C(  68), -INT8_C(  42), -INT8_C(  27), -INT8_C(  51),  INT8_C(  75),  INT8_C(  66), -INT8_C(  21), -INT8_C(  84),
+       INT8_C( 101),  INT8_C( 118),  INT8_C(  79),  INT8_C( 109), -INT8_C(  28), -INT8_C(  89),  INT8_C(  33), -INT8_C( 104),
+       INT8_C(  30), -INT8_C(  82), -INT8_C(  79), -INT8_C(  81), -INT8_C( 116), -INT8_C(  26), -INT8_C(  36),  INT8_C(  45),
+      -INT8_C( 103),  INT8_C( 103),  INT8_C(  70), -INT8_C(  62),  INT8_C(  60),  INT8_C(  39), -INT8_C(  15), -INT8_C(   8),
+      -INT8_C(   2), -INT8_C(  42), -INT8_C(  58),  INT8_C(  73),  INT8_C(  24), -INT8_C(  79), -INT8_C(  11),  INT8_C( 125),
+       INT8_C(  39),  INT8_C(  69), -INT8_C(  22),  INT8_C(  11), -INT8_C(  20),  INT8_C(  11), -INT8_C(  92),  INT8_C(  10),
+      -INT8_C(  71),  INT8_C(  85), -INT8_C(  70),  INT8_C(  69),  INT8_C(  59), -INT8_C( 106),  INT8_C( 114), -INT8_C(  44),
+      -INT8_C(   3), -INT8_C(  71), -INT8_C( 105),  INT8_C(  57), -INT8_C(  32), -INT8_C( 120),  INT8_C(  50), -INT8_C(  34),
+       INT8_C(  94), -INT8_C(   8),  INT8_C(  39),  INT8_C( 119), -INT8_C(  87),  INT8_C(  29), -INT8_C(  12), -INT8_C(  47),
+       INT8_C(  98), -INT8_C(  33), -INT8_C(  36),  INT8_C(  78), -INT8_C(  22),      INT8_MIN,  INT8_C(  89), -INT8_C(  92),
+      -INT8_C(  42),  INT8_C(  19), -INT8_C(  23),  INT8_C(  17), -INT8_C(  87),  INT8_C(  92), -INT8_C(  26), -INT8_C(  90),
+       INT8_C(  21),  INT8_C( 125), -INT8_C(  32), -INT8_C(  11),  INT8_C(   5),  INT8_C(  18), -INT8_C(  44),  INT8_C(  99),
+       INT8_C(  10), -INT8_C(   5), -INT8_C(  38), -INT8_C(  77),  INT8_C(  24), -INT8_C(  49), -INT8_C( 124),  INT8_C( 122),
+      -INT8_C(  82),  INT8_C(  97), -INT8_C(  55), -INT8_C( 104), -INT8_C(  31),  INT8_C(  34),  INT8_C(  60), -INT8_C(  73),
+       INT8_C(  53),  INT8_C(  38), -INT8_C(  55), -INT8_C(  34), -INT8_C( 126), -INT8_C(  81), -INT8_C( 124), -INT8_C( 105),
+       INT8_C(  44),  INT8_C( 100), -INT8_C( 116),  INT8_C(  49),  INT8_C( 118),  INT8_C(  96), -INT8_C( 108),      INT8_MIN,
+       INT8_C(  92),  INT8_C( 111),  INT8_C(  52),  INT8_C( 116),  INT8_C(  62), -INT8_C(  72), -INT8_C(  17), -INT8_C(  20),
+       INT8_C(  25), -INT8_C(  72), -INT8_C( 124), -INT8_C(   5), -INT8_C(  38), -INT8_C(  63), -INT8_C(  78),  INT8_C(  15),
+      -INT8_C(  25),  INT8_C( 123), -INT8_C(  19),  INT8_C( 105),  INT8_C(  42),  INT8_C( 113),  INT8_C(   0),  INT8_C(  86),
+      -INT8_C(  42), -INT8_C( 116), -INT8_C( 121),  INT8_C(  76), -INT8_C(  19),  INT8_C(  28), -INT8_C(  51),  INT8_C(  73),
+      -INT8_C( 117),  INT8_C(   1), -INT8_C(  67), -INT8_C(  55), -INT8_C(  71), -INT8_C(  84), -INT8_C(  75), -INT8_C(  45),
+       INT8_C( 100),  INT8_C(  57), -INT8_C(  50),  INT8_C(  62), -INT8_C(   6),      INT8_MIN,  INT8_C(  77), -INT8_C(  31),
+      -INT8_C(   4),  INT8_C(  58),  INT8_C(  74),  INT8_C(  38), -INT8_C(  84),  INT8_C(  74),  INT8_C( 125), -INT8_C( 126),
+      -INT8_C(  41),  INT8_C(   4), -INT8_C(  50), -INT8_C(  60),  INT8_C(  32), -INT8_C( 101),  INT8_C(  13), -INT8_C(  85),
+      -INT8_C( 100), -INT8_C(  54),  INT8_C( 116),  INT8_C(  86),  INT8_C( 119),  INT8_C(  41),  INT8_C(  41), -INT8_C(  37),
+       INT8_C(  99), -INT8_C(   9),  INT8_C(  26),  INT8_C(  93),  INT8_C( 119),  INT8_C( 103),  INT8_C(  63),  INT8_C( 115),
+      -INT8_C(  94), -INT8_C( 119), -INT8_C( 102),  INT8_C(  78), -INT8_C(  44),  INT8_C(  23), -INT8_C(  48), -INT8_C(  85),
+       INT8_C(  27), -INT8_C(  98),  INT8_C( 111),  INT8_C(  60),  INT8_C(  58),  INT8_C( 124), -INT8_C(  25), -INT8_C(  42),
+       INT8_C(  70),  INT8_C(  92),  INT8_C(  44), -INT8_C(  67), -INT8_C( 123),  INT8_C(  85), -INT8_C( 103), -INT8_C(  24),
+       INT8_C(  76), -INT8_C(  77),  INT8_C(  70), -INT8_C(  60),  INT8_C(  26), -INT8_C( 123),  INT8_C(  55), -INT8_C(  68),
+       INT8_C(  14), -INT8_C(  47),  INT8_C(  10), -INT8_C(  30), -INT8_C(  24), -INT8_C(  38), -INT8_C( 115),  INT8_C(   4),
+       INT8_C( 121), -INT8_C(   4),  INT8_C(  64), -INT8_C(  77),  INT8_C( 120),  INT8_C(  39), -INT8_C( 119), -INT8_C(  65),
+      -INT8_C( 125), -INT8_C(  74),  INT8_C( 124),  INT8_C(   9),  INT8_C(  11),  INT8_C(  21), -INT8_C(  15),  INT8_C(  88),
+      -INT8_C(  56),  INT8_C(  55),  INT8_C(  28), -INT8_C(  29), -INT8_C(  68),  INT8_C(  83), -INT8_C(  97), -INT8_C(  53),
+       INT8_C(  37), -INT8_C(  86), -INT8_C(  83),  INT8_C(  13), -INT8_C( 124),  INT8_C(  59),  INT8_C(  17), -INT8_C(   3),
+       INT8_C(  55),  INT8_C(  81), -INT8_C(  80), -INT8_C(  80),  INT8_C( 121),  INT8_C(  58),  INT8_C( 111), -INT8_C(   4),
+      -INT8_C(  16), -INT8_C(  21),  INT8_C(   5), -INT8_C(   5),  INT8_C(   1), -INT8_C(   9),  INT8_C(  83), -INT8_C(  55),
+       INT8_C(  46),  INT8_C( 111), -INT8_C(  84), -INT8_C(  21), -INT8_C(  61),  INT8_C(  76), -INT8_C(  74), -INT8_C(  24),
+      -INT8_C(  10),  INT8_C(  99), -INT8_C(  11),  INT8_C( 122), -INT8_C(  98),  INT8_C(   7),  INT8_C( 120), -INT8_C(  42),
+       INT8_C(  88),  INT8_C(  40), -INT8_C( 122), -INT8_C(  47),  INT8_C(  98), -INT8_C(  11), -INT8_C(  50),  INT8_C(  82),
+      -INT8_C(  32), -INT8_C(  45),  INT8_C(  78), -INT8_C(  31), -INT8_C(  54), -INT8_C(  95), -INT8_C(  85), -INT8_C(   7),
+       INT8_C(  17),  INT8_C(  87), -INT8_C(  28), -INT8_C(  44), -INT8_C(  93), -INT8_C( 102), -INT8_C(  68), -INT8_C( 103),
+      -INT8_C(   3), -INT8_C(  79),  INT8_C(  20), -INT8_C( 100), -INT8_C(  72), -INT8_C( 116),  INT8_C( 114),  INT8_C(  17),
+      -INT8_C(  76), -INT8_C(   8), -INT8_C(  30),  INT8_C(  23), -INT8_C(  19), -INT8_C(  80),  INT8_C( 105), -INT8_C(  51),
+      -INT8_C( 124), -INT8_C(  73), -INT8_C(  81),  INT8_C(  78),  INT8_C(  89),  INT8_C(  90),  INT8_C(  71),  INT8_C( 106),
+      -INT8_C(  79),  INT8_C(  43),  INT8_C(  62),  INT8_C(  85), -INT8_C(  59), -INT8_C(   6), -INT8_C(  18), -INT8_C(  61),
+      -INT8_C(  85),  INT8_C(   2),  INT8_C(  95),  INT8_C( 100), -INT8_C( 114), -INT8_C(  47),  INT8_C( 117),  INT8_C(  67),
+      -INT8_C(  55),  INT8_C(  87),  INT8_C(  90), -INT8_C(  74),  INT8_C(   8), -INT8_C(  61), -INT8_C( 125), -INT8_C( 116),
+       INT8_C( 123),  INT8_C(  50), -INT8_C(  38), -INT8_C(  44), -INT8_C( 116),  INT8_C(  34),  INT8_C(  62),  INT8_C(  62),
+       INT8_C(  77),  INT8_C( 124), -INT8_C( 109),  INT8_C(  19),  INT8_C( 118), -INT8_C( 127), -INT8_C(  42),  INT8_C(  33),
+      -INT8_C( 124),  INT8_C(  53), -INT8_C( 123),  INT8_C(  18),  INT8_C(   6), -INT8_C(   6),  INT8_C(  85), -INT8_C(  49),
+       INT8_C(  82), -INT8_C(  81), -INT8_C( 123),  INT8_C(  90),  INT8_C( 115),  INT8_C(   8), -INT8_C(  26), -INT8_C(  18),
+       INT8_C(  59), -INT8_C(  64), -INT8_C(  62), -INT8_C(  57), -INT8_C(  30),  INT8_C(   0),  INT8_C(   5),  INT8_C(  48),
+       INT8_C( 124), -INT8_C( 104),  INT8_C(  67), -INT8_C(  14),  INT8_C(  26),  INT8_C(  25),  INT8_C(  19), -INT8_C(  98),
+       INT8_C(  78), -INT8_C( 103), -INT8_C(  80),  INT8_C(  84), -INT8_C( 109),  INT8_C(   6),  INT8_C(  35), -INT8_C(  27),
+      -INT8_C(  75), -INT8_C(  88),  INT8_C(  63),  INT8_C(  40), -INT8_C(  80),  INT8_C(  37),  INT8_C(  22), -INT8_C(  21),
+      -INT8_C(  26), -INT8_C(  40), -INT8_C(  77), -INT8_C(  56), -INT8_C(  40), -INT8_C(  72), -INT8_C(   8),  INT8_C(  84),
+       INT8_C(  81),  INT8_C(  59),  INT8_C(  70),  INT8_C( 107),  INT8_C(  84),  INT8_C(  90),  INT8_C(   9), -INT8_C(  94),
+      -INT8_C(  13), -INT8_C(  71), -INT8_C(  10), -INT8_C( 122), -INT8_C(  65),  INT8_C(  25),  INT8_C( 108),  INT8_C( 117),
+      -INT8_C(  63), -INT8_C(  85), -INT8_C(  99),  INT8_C( 114), -INT8_C(  47), -INT8_C(  76),  INT8_C(  93), -INT8_C(  73),
+      -INT8_C( 116),  INT8_C(  16),      INT8_MAX,  INT8_C( 101), -INT8_C(  55),  INT8_C( 120), -INT8_C(  71),  INT8_C(  26),
+      -INT8_C(  77),  INT8_C(   0), -INT8_C( 123),  INT8_C(   8),  INT8_C(  90), -INT8_C( 114), -INT8_C(  86),  INT8_C(  77),
+       INT8_C(  71), -INT8_C(  95), -INT8_C(  45),  INT8_C(   7), -INT8_C(  70),  INT8_C(  63),  INT8_C( 124),  INT8_C( 124),
+      -INT8_C(  21),  INT8_C(  25), -INT8_C(  18), -INT8_C(  68), -INT8_C(  51),  INT8_C(  75),  INT8_C( 115),  INT8_C(  90),
+       INT8_C(  92), -INT8_C(  14), -INT8_C(  65),  INT8_C(  37),  INT8_C( 106),  INT8_C( 120),  INT8_C(  63),  INT8_C(  30),
+       INT8_C( 120), -INT8_C(  60),  INT8_C(  38), -INT8_C(  46),  INT8_C(  82), -INT8_C(  48),  INT8_C(  31), -INT8_C( 103),
+       INT8_C( 113), -INT8_C(  13), -INT8_C(  96),  INT8_C(  44),  INT8_C(  50),  INT8_C(  28), -INT8_C(  88),  INT8_C(  29),
+       INT8_C(  54), -INT8_C( 106), -INT8_C(  39),  INT8_C(   3), -INT8_C(  31),  INT8_C(  76),  INT8_C(  93),  INT8_C(  61),
+       INT8_C(  63),  INT8_C(  28),  INT8_C(  98), -INT8_C(  87), -INT8_C( 107), -INT8_C(  95), -INT8_C(  57),  INT8_C(  13),
+       INT8_C( 101), -INT8_C(  19), -INT8_C(  32), -INT8_C(  73), -INT8_C(  66), -INT8_C(   1),  INT8_C(  81),  INT8_C(  47),
+      -INT8_C(  14), -INT8_C(  15),  INT8_C(  91),  INT8_C(  37),  INT8_C(  14),  INT8_C(   3),  INT8_C(  66),  INT8_C(  68),
+      -INT8_C( 103),  INT8_C(  28),  INT8_C(  71),  INT8_C( 123),  INT8_C( 104), -INT8_C(  91), -INT8_C(  72), -INT8_C(  89),
+      -INT8_C(  63),  INT8_C(  27),  INT8_C(  81),  INT8_C(  86), -INT8_C(  68),  INT8_C(  24),  INT8_C( 100),  INT8_C(  34),
+       INT8_C(   6),  INT8_C(  68), -INT8_C(  39), -INT8_C(  60),  INT8_C(  67),  INT8_C(  42), -INT8_C(  13),  INT8_C(  54),
+       INT8_C(  28),  INT8_C(  79),  INT8_C(  91),  INT8_C(  42),  INT8_C(  82), -INT8_C(  99),  INT8_C( 110), -INT8_C(  20),
+      -INT8_C(  71), -INT8_C(  75),  INT8_C( 103),  INT8_C(  34),  INT8_C(  90),  INT8_C(  31), -INT8_C(  55),  INT8_C(  28),
+       INT8_C(  58),  INT8_C(  26),  INT8_C( 114), -INT8_C(   9),  INT8_C(  51), -INT8_C(  42),  INT8_C(  25),  INT8_C(  57),
+       INT8_C(  26), -INT8_C(  14), -INT8_C(   3),  INT8_C(  94),  INT8_C(  29), -INT8_C(  16), -INT8_C( 108),  INT8_C(  57),
+       INT8_C(  63), -INT8_C(  17),  INT8_C(  99), -INT8_C( 110), -INT8_C( 116), -INT8_C(  47),  INT8_C( 126),  INT8_C(  70),
+      -INT8_C( 122), -INT8_C(  27),  INT8_C( 104), -INT8_C(  31),  INT8_C(   4),  INT8_C(  49), -INT8_C(   3),  INT8_C(  63),
+       INT8_C(  76),  INT8_C( 111),  INT8_C(  54),      INT8_MAX,  INT8_C(  70),  INT8_C(  79), -INT8_C(  72),  INT8_C(  96),
+       INT8_C(  65), -INT8_C(  75), -INT8_C(  66),  INT8_C(  94), -INT8_C(  91),  INT8_C(  82), -INT8_C( 105), -INT8_C(  27),
+       INT8_C(  65), -INT8_C(   6),  INT8_C( 119), -INT8_C(  50), -INT8_C(  53), -INT8_C(  11),  INT8_C(  20),  INT8_C(  82),
+      -INT8_C(  38),  INT8_C( 124),  INT8_C(  51), -INT8_C(  34), -INT8_C(  83),  INT8_C(  48) };
+  static const int8_t b =  INT8_C(  39);
+  static const int8_t e[] =
+    {  INT8_C(  39), -INT8_C(  48), -INT8_C(  95),  INT8_C(  81),  INT8_C( 114),  INT8_C(  39), -INT8_C( 117), -INT8_C(  29),
+       INT8_C( 115), -INT8_C( 103),  INT8_C(  39), -INT8_C(  73),  INT8_C(  63),  INT8_C( 126),  INT8_C(  26), -INT8_C( 100),
+       INT8_C(  30),  INT8_C( 114),  INT8_C(  39),  INT8_C( 111), -INT8_C(  37),  INT8_C(  56), -INT8_C(  98),  INT8_C(  18),
+      -INT8_C(   6), -INT8_C(  58),  INT8_C(  39),  INT8_C(  15),  INT8_C(  83), -INT8_C(  54),  INT8_C(  53), -INT8_C(  48),
+      -INT8_C( 102), -INT8_C(  42),  INT8_C(  33),  INT8_C(  12),  INT8_C(  24), -INT8_C(  83), -INT8_C(  17), -INT8_C( 117),
+       INT8_C(  39),  INT8_C(  39),  INT8_C(  67), -INT8_C( 123), -INT8_C(  85),  INT8_C(  93),  INT8_C(  33), -INT8_C(  55),
+      -INT8_C(  48), -INT8_C( 100),  INT8_C(  39), -INT8_C(  85), -INT8_C(  44), -INT8_C(  41), -INT8_C(  67), -INT8_C(  49),
+      -INT8_C(  99), -INT8_C(  27), -INT8_C(  34), -INT8_C(  16), -INT8_C(  81),  INT8_C(  19), -INT8_C(  64),  INT8_C(  39),
+      -INT8_C(  23), -INT8_C(  30),  INT8_C(  39),  INT8_C(   1), -INT8_C( 113),  INT8_C(  39), -INT8_C( 115), -INT8_C(  43),
+       INT8_C( 114), -INT8_C(  48),  INT8_C(  90),  INT8_C(  29),  INT8_C(  45),  INT8_C(  39), -INT8_C(  26), -INT8_C(   3),
+       INT8_C(  23),  INT8_C(  31), -INT8_C(  88), -INT8_C(  20), -INT8_C(  10),  INT8_C( 102), -INT8_C(  69), -INT8_C( 109),
+       INT8_C(  75), -INT8_C( 103), -INT8_C( 125), -INT8_C(   6), -INT8_C(  84),  INT8_C(  68),  INT8_C(  39), -INT8_C( 107),
+       INT8_C(  38), -INT8_C( 103), -INT8_C( 106), -INT8_C(  75), -INT8_C(  33),  INT8_C(  35), -INT8_C( 118),  INT8_C(  81),
+      -INT8_C(  13), -INT8_C(  28),  INT8_C( 110),  INT8_C(  33),  INT8_C(  39),  INT8_C(  84),  INT8_C(  30),  INT8_C(  39),
+       INT8_C( 115), -INT8_C(  57),  INT8_C(  99),  INT8_C(  39),  INT8_C(  39),  INT8_C(  30), -INT8_C(   4),  INT8_C(  39),
+      -INT8_C(  73),      INT8_MIN,  INT8_C(  39),  INT8_C(  99), -INT8_C(  60), -INT8_C(  75), -INT8_C(   8), -INT8_C(  22),
+       INT8_C(  39), -INT8_C( 114), -INT8_C(  97),  INT8_C(  39), -INT8_C(  78),  INT8_C(  41),      INT8_MAX, -INT8_C(  91),
+       INT8_C(  13), -INT8_C(  19), -INT8_C(  58),  INT8_C( 108),  INT8_C(  65), -INT8_C(  27), -INT8_C(  29), -INT8_C(  75),
+      -INT8_C(  84),  INT8_C(  70),  INT8_C(  30), -INT8_C(  39),  INT8_C( 100),  INT8_C(  27),  INT8_C(  39),  INT8_C(  27),
+      -INT8_C( 101), -INT8_C(  61),  INT8_C( 126),  INT8_C(  39),  INT8_C(  39),  INT8_C(  39),  INT8_C(  73), -INT8_C(  57),
+       INT8_C(   5), -INT8_C(  24), -INT8_C(  11), -INT8_C(  73),  INT8_C(  17),  INT8_C(  39),  INT8_C(  92),  INT8_C(  30),
+       INT8_C(  39),  INT8_C(  35), -INT8_C( 118), -INT8_C(  93),  INT8_C(   8),  INT8_C( 110),  INT8_C(  39), -INT8_C(  76),
+      -INT8_C(  76),  INT8_C(  39), -INT8_C( 115),  INT8_C(  25), -INT8_C( 111), -INT8_C(  34),  INT8_C(  52),  INT8_C(  44),
+      -INT8_C(  95), -INT8_C(  77), -INT8_C( 117),  INT8_C(  25),  INT8_C(  39), -INT8_C(  44), -INT8_C(  31),  INT8_C(  39),
+      -INT8_C(  68), -INT8_C(  42), -INT8_C(  27), -INT8_C(  51),  INT8_C(  39),  INT8_C(  39), -INT8_C(  21), -INT8_C(  84),
+       INT8_C(  39),  INT8_C(  39),  INT8_C(  39),  INT8_C(  39), -INT8_C(  28), -INT8_C(  89),  INT8_C(  33), -INT8_C( 104),
+       INT8_C(  30), -INT8_C(  82), -INT8_C(  79), -INT8_C(  81), -INT8_C( 116), -INT8_C(  26), -INT8_C(  36),  INT8_C(  39),
+      -INT8_C( 103),  INT8_C( 103),  INT8_C(  70), -INT8_C(  62),  INT8_C(  60),  INT8_C(  39), -INT8_C(  15), -INT8_C(   8),
+      -INT8_C(   2), -INT8_C(  42), -INT8_C(  58),  INT8_C(  39),  INT8_C(  24), -INT8_C(  79), -INT8_C(  11),  INT8_C(  39),
+       INT8_C(  39),  INT8_C(  39), -INT8_C(  22),  INT8_C(  11), -INT8_C(  20),  INT8_C(  11), -INT8_C(  92),  INT8_C(  10),
+      -INT8_C(  71),  INT8_C(  39), -INT8_C(  70),  INT8_C(  69),  INT8_C(  39), -INT8_C( 106),  INT8_C( 114), -INT8_C(  44),
+      -INT8_C(   3), -INT8_C(  71), -INT8_C( 105),  INT8_C(  39), -INT8_C(  32), -INT8_C( 120),  INT8_C(  50), -INT8_C(  34),
+       INT8_C(  94), -INT8_C(   8),  INT8_C(  39),  INT8_C(  39), -INT8_C(  87),  INT8_C(  29), -INT8_C(  12), -INT8_C(  47),
+       INT8_C(  98), -INT8_C(  33), -INT8_C(  36),  INT8_C(  39), -INT8_C(  22),      INT8_MIN,  INT8_C(  89), -INT8_C(  92),
+      -INT8_C(  42),  INT8_C(  19), -INT8_C(  23),  INT8_C(  17), -INT8_C(  87),  INT8_C(  39), -INT8_C(  26), -INT8_C(  90),
+       INT8_C(  21),  INT8_C(  39), -INT8_C(  32), -INT8_C(  11),  INT8_C(   5),  INT8_C(  18), -INT8_C(  44),  INT8_C(  99),
+       INT8_C(  10), -INT8_C(   5), -INT8_C(  38), -INT8_C(  77),  INT8_C(  24), -INT8_C(  49), -INT8_C( 124),  INT8_C( 122),
+      -INT8_C(  82),  INT8_C(  39), -INT8_C(  55), -INT8_C( 104), -INT8_C(  31),  INT8_C(  34),  INT8_C(  39), -INT8_C(  73),
+       INT8_C(  39),  INT8_C(  38), -INT8_C(  55), -INT8_C(  34), -INT8_C( 126), -INT8_C(  81), -INT8_C( 124), -INT8_C( 105),
+       INT8_C(  39),  INT8_C(  39), -INT8_C( 116),  INT8_C(  39),  INT8_C(  39),  INT8_C(  39), -INT8_C( 108),      INT8_MIN,
+       INT8_C(  39),  INT8_C(  39),  INT8_C(  52),  INT8_C(  39),  INT8_C(  62), -INT8_C(  72), -INT8_C(  17), -INT8_C(  20),
+       INT8_C(  25), -INT8_C(  72), -INT8_C( 124), -INT8_C(   5), -INT8_C(  38), -INT8_C(  63), -INT8_C(  78),  INT8_C(  15),
+      -INT8_C(  25),  INT8_C(  39), -INT8_C(  19),  INT8_C( 105),  INT8_C(  39),  INT8_C( 113),  INT8_C(   0),  INT8_C(  86),
+      -INT8_C(  42), -INT8_C( 116), -INT8_C( 121),  INT8_C(  39), -INT8_C(  19),  INT8_C(  28), -INT8_C(  51),  INT8_C(  39),
+      -INT8_C( 117),  INT8_C(   1), -INT8_C(  67), -INT8_C(  55), -INT8_C(  71), -INT8_C(  84), -INT8_C(  75), -INT8_C(  45),
+       INT8_C( 100),  INT8_C(  57), -INT8_C(  50),  INT8_C(  62), -INT8_C(   6),      INT8_MIN,  INT8_C(  77), -INT8_C(  31),
+      -INT8_C(   4),  INT8_C(  58),  INT8_C(  74),  INT8_C(  38), -INT8_C(  84),  INT8_C(  74),  INT8_C( 125), -INT8_C( 126),
+      -INT8_C(  41),  INT8_C(   4), -INT8_C(  50), -INT8_C(  60),  INT8_C(  32), -INT8_C( 101),  INT8_C(  13), -INT8_C(  85),
+      -INT8_C( 100), -INT8_C(  54),  INT8_C(  39),  INT8_C(  39),  INT8_C(  39),  INT8_C(  41),  INT8_C(  41), -INT8_C(  37),
+       INT8_C(  39), -INT8_C(   9),  INT8_C(  26),  INT8_C(  93),  INT8_C( 119),  INT8_C(  39),  INT8_C(  39),  INT8_C(  39),
+      -INT8_C(  94), -INT8_C( 119), -INT8_C( 102),  INT8_C(  78), -INT8_C(  44),  INT8_C(  23), -INT8_C(  48), -INT8_C(  85),
+       INT8_C(  27), -INT8_C(  98),  INT8_C( 111),  INT8_C(  60),  INT8_C(  39),  INT8_C(  39), -INT8_C(  25), -INT8_C(  42),
+       INT8_C(  39),  INT8_C(  39),  INT8_C(  44), -INT8_C(  67), -INT8_C( 123),  INT8_C(  85), -INT8_C( 103), -INT8_C(  24),
+       INT8_C(  76), -INT8_C(  77),  INT8_C(  70), -INT8_C(  60),  INT8_C(  26), -INT8_C( 123),  INT8_C(  39), -INT8_C(  68),
+       INT8_C(  14), -INT8_C(  47),  INT8_C(  10), -INT8_C(  30), -INT8_C(  24), -INT8_C(  38), -INT8_C( 115),  INT8_C(   4),
+       INT8_C(  39), -INT8_C(   4),  INT8_C(  64), -INT8_C(  77),  INT8_C( 120),  INT8_C(  39), -INT8_C( 119), -INT8_C(  65),
+      -INT8_C( 125), -INT8_C(  74),  INT8_C(  39),  INT8_C(   9),  INT8_C(  11),  INT8_C(  21), -INT8_C(  15),  INT8_C(  39),
+      -INT8_C(  56),  INT8_C(  55),  INT8_C(  28), -INT8_C(  29), -INT8_C(  68),  INT8_C(  39), -INT8_C(  97), -INT8_C(  53),
+       INT8_C(  37), -INT8_C(  86), -INT8_C(  83),  INT8_C(  13), -INT8_C( 124),  INT8_C(  39),  INT8_C(  17), -INT8_C(   3),
+       INT8_C(  55),  INT8_C(  81), -INT8_C(  80), -INT8_C(  80),  INT8_C( 121),  INT8_C(  39),  INT8_C(  39), -INT8_C(   4),
+      -INT8_C(  16), -INT8_C(  21),  INT8_C(   5), -INT8_C(   5),  INT8_C(   1), -INT8_C(   9),  INT8_C(  83), -INT8_C(  55),
+       INT8_C(  39),  INT8_C(  39), -INT8_C(  84), -INT8_C(  21), -INT8_C(  61),  INT8_C(  76), -INT8_C(  74), -INT8_C(  24),
+      -INT8_C(  10),  INT8_C(  39), -INT8_C(  11),  INT8_C(  39), -INT8_C(  98),  INT8_C(   7),  INT8_C( 120), -INT8_C(  42),
+       INT8_C(  39),  INT8_C(  40), -INT8_C( 122), -INT8_C(  47),  INT8_C(  39), -INT8_C(  11), -INT8_C(  50),  INT8_C(  39),
+      -INT8_C(  32), -INT8_C(  45),  INT8_C(  78), -INT8_C(  31), -INT8_C(  54), -INT8_C(  95), -INT8_C(  85), -INT8_C(   7),
+       INT8_C(  17),  INT8_C(  39), -INT8_C(  28), -INT8_C(  44), -INT8_C(  93), -INT8_C( 102), -INT8_C(  68), -INT8_C( 103),
+      -INT8_C(   3), -INT8_C(  79),  INT8_C(  20), -INT8_C( 100), -INT8_C(  72), -INT8_C( 116),  INT8_C( 114),  INT8_C(  17),
+      -INT8_C(  76), -INT8_C(   8), -INT8_C(  30),  INT8_C(  23), -INT8_C(  19), -INT8_C(  80),  INT8_C( 105), -INT8_C(  51),
+      -INT8_C( 124), -INT8_C(  73), -INT8_C(  81),  INT8_C(  39),  INT8_C(  39),  INT8_C(  90),  INT8_C(  71),  INT8_C(  39),
+      -INT8_C(  79),  INT8_C(  43),  INT8_C(  39),  INT8_C(  39), -INT8_C(  59), -INT8_C(   6), -INT8_C(  18), -INT8_C(  61),
+      -INT8_C(  85),  INT8_C(   2),  INT8_C(  95),  INT8_C( 100), -INT8_C( 114), -INT8_C(  47),  INT8_C( 117),  INT8_C(  67),
+      -INT8_C(  55),  INT8_C(  87),  INT8_C(  90), -INT8_C(  74),  INT8_C(   8), -INT8_C(  61), -INT8_C( 125), -INT8_C( 116),
+       INT8_C(  39),  INT8_C(  50), -INT8_C(  38), -INT8_C(  44), -INT8_C( 116),  INT8_C(  34),  INT8_C(  39),  INT8_C(  39),
+       INT8_C(  39),  INT8_C(  39), -INT8_C( 109),  INT8_C(  19),  INT8_C( 118), -INT8_C( 127), -INT8_C(  42),  INT8_C(  33),
+      -INT8_C( 124),  INT8_C(  39), -INT8_C( 123),  INT8_C(  18),  INT8_C(   6), -INT8_C(   6),  INT8_C(  39), -INT8_C(  49),
+       INT8_C(  39), -INT8_C(  81), -INT8_C( 123),  INT8_C(  39),  INT8_C( 115),  INT8_C(   8), -INT8_C(  26), -INT8_C(  18),
+       INT8_C(  59), -INT8_C(  64), -INT8_C(  62), -INT8_C(  57), -INT8_C(  30),  INT8_C(   0),  INT8_C(   5),  INT8_C(  48),
+       INT8_C(  39), -INT8_C( 104),  INT8_C(  39), -INT8_C(  14),  INT8_C(  26),  INT8_C(  25),  INT8_C(  19), -INT8_C(  98),
+       INT8_C(  39), -INT8_C( 103), -INT8_C(  80),  INT8_C(  39), -INT8_C( 109),  INT8_C(   6),  INT8_C(  35), -INT8_C(  27),
+      -INT8_C(  75), -INT8_C(  88),  INT8_C(  63),  INT8_C(  39), -INT8_C(  80),  INT8_C(  37),  INT8_C(  22), -INT8_C(  21),
+      -INT8_C(  26), -INT8_C(  40), -INT8_C(  77), -INT8_C(  56), -INT8_C(  40), -INT8_C(  72), -INT8_C(   8),  INT8_C(  84),
+       INT8_C(  39),  INT8_C(  59),  INT8_C(  70),  INT8_C( 107),  INT8_C(  39),  INT8_C(  90),  INT8_C(   9), -INT8_C(  94),
+      -INT8_C(  13), -INT8_C(  71), -INT8_C(  10), -INT8_C( 122), -INT8_C(  65),  INT8_C(  25),  INT8_C( 108),  INT8_C(  39),
+      -INT8_C(  63), -INT8_C(  85), -INT8_C(  99),  INT8_C( 114), -INT8_C(  47), -INT8_C(  76),  INT8_C(  93), -INT8_C(  73),
+      -INT8_C( 116),  INT8_C(  16),  INT8_C(  39),  INT8_C( 101), -INT8_C(  55),  INT8_C(  39), -INT8_C(  71),  INT8_C(  26),
+      -INT8_C(  77),  INT8_C(   0), -INT8_C( 123),  INT8_C(   8),  INT8_C(  39), -INT8_C( 114), -INT8_C(  86),  INT8_C(  77),
+       INT8_C(  71), -INT8_C(  95), -INT8_C(  45),  INT8_C(   7), -INT8_C(  70),  INT8_C(  39),  INT8_C(  39),  INT8_C( 124),
+      -INT8_C(  21),  INT8_C(  25), -INT8_C(  18), -INT8_C(  68), -INT8_C(  51),  INT8_C(  39),  INT8_C( 115),  INT8_C(  39),
+       INT8_C(  92), -INT8_C(  14), -INT8_C(  65),  INT8_C(  37),  INT8_C( 106),  INT8_C( 120),  INT8_C(  39),  INT8_C(  30),
+       INT8_C( 120), -INT8_C(  60),  INT8_C(  38), -INT8_C(  46),  INT8_C(  39), -INT8_C(  48),  INT8_C(  31), -INT8_C( 103),
+       INT8_C( 113), -INT8_C(  13), -INT8_C(  96),  INT8_C(  44),  INT8_C(  39),  INT8_C(  28), -INT8_C(  88),  INT8_C(  29),
+       INT8_C(  39), -INT8_C( 106), -INT8_C(  39),  INT8_C(   3), -INT8_C(  31),  INT8_C(  39),  INT8_C(  39),  INT8_C(  39),
+       INT8_C(  39),  INT8_C(  28),  INT8_C(  39), -INT8_C(  87), -INT8_C( 107), -INT8_C(  95), -INT8_C(  57),  INT8_C(  13),
+       INT8_C( 101), -INT8_C(  19), -INT8_C(  32), -INT8_C(  73), -INT8_C(  66), -INT8_C(   1),  INT8_C(  39),  INT8_C(  39),
+      -INT8_C(  14), -INT8_C(  15),  INT8_C(  91),  INT8_C(  37),  INT8_C(  14),  INT8_C(   3),  INT8_C(  39),  INT8_C(  39),
+      -INT8_C( 103),  INT8_C(  28),  INT8_C(  39),  INT8_C( 123),  INT8_C(  39), -INT8_C(  91), -INT8_C(  72), -INT8_C(  89),
+      -INT8_C(  63),  INT8_C(  27),  INT8_C(  81),  INT8_C(  86), -INT8_C(  68),  INT8_C(  24),  INT8_C( 100),  INT8_C(  34),
+       INT8_C(   6),  INT8_C(  68), -INT8_C(  39), -INT8_C(  60),  INT8_C(  67),  INT8_C(  42), -INT8_C(  13),  INT8_C(  54),
+       INT8_C(  28),  INT8_C(  79),  INT8_C(  39),  INT8_C(  42),  INT8_C(  82), -INT8_C(  99),  INT8_C( 110), -INT8_C(  20),
+      -INT8_C(  71), -INT8_C(  75),  INT8_C(  39),  INT8_C(  34),  INT8_C(  90),  INT8_C(  31), -INT8_C(  55),  INT8_C(  28),
+       INT8_C(  58),  INT8_C(  26),  INT8_C(  39), -INT8_C(   9),  INT8_C(  39), -INT8_C(  42),  INT8_C(  25),  INT8_C(  39),
+       INT8_C(  26), -INT8_C(  14), -INT8_C(   3),  INT8_C(  94),  INT8_C(  29), -INT8_C(  16), -INT8_C( 108),  INT8_C(  39),
+       INT8_C(  39), -INT8_C(  17),  INT8_C(  99), -INT8_C( 110), -INT8_C( 116), -INT8_C(  47),  INT8_C( 126),  INT8_C(  70),
+      -INT8_C( 122), -INT8_C(  27),  INT8_C( 104), -INT8_C(  31),  INT8_C(   4),  INT8_C(  39), -INT8_C(   3),  INT8_C(  39),
+       INT8_C(  76),  INT8_C( 111),  INT8_C(  39),      INT8_MAX,  INT8_C(  70),  INT8_C(  39), -INT8_C(  72),  INT8_C(  96),
+       INT8_C(  65), -INT8_C(  75), -INT8_C(  66),  INT8_C(  39), -INT8_C(  91),  INT8_C(  82), -INT8_C( 105), -INT8_C(  27),
+       INT8_C(  39), -INT8_C(   6),  INT8_C(  39), -INT8_C(  50), -INT8_C(  53), -INT8_C(  11),  INT8_C(  20),  INT8_C(  39),
+      -INT8_C(  38),  INT8_C(  39),  INT8_C(  51), -INT8_C(  34), -INT8_C(  83),  INT8_C(  39) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_n_s8_m(pv, av, b);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    ev = simde_svmin_n_s8_m(pv, av, b);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0) };
+  static const int16_t a[] =
+    { -INT16_C( 12160),  INT16_C( 23401),  INT16_C( 19670),  INT16_C( 11956),  INT16_C(  6896),  INT16_C( 19432),  INT16_C(   264), -INT16_C(  6322),
+      -INT16_C( 14900), -INT16_C(  9867),  INT16_C( 10376),  INT16_C(  9541), -INT16_C( 19443), -INT16_C( 19490), -INT16_C(  1356),  INT16_C( 13390),
+      -INT16_C( 18486), -INT16_C( 24177),  INT16_C( 17155), -INT16_C(  3121), -INT16_C( 18595),  INT16_C( 25919), -INT16_C( 29255), -INT16_C( 31412),
+      -INT16_C( 16046), -INT16_C(  9633), -INT16_C( 23319), -INT16_C(  2305), -INT16_C(  8872),  INT16_C(  3242), -INT16_C(  1833), -INT16_C( 24000),
+      -INT16_C( 12369), -INT16_C( 19901),  INT16_C(  4626),  INT16_C( 28581), -INT16_C(  6967), -INT16_C( 32044),  INT16_C(  8305), -INT16_C( 15608),
+       INT16_C( 26594), -INT16_C( 13411), -INT16_C( 25589),  INT16_C( 25538),  INT16_C( 27770),  INT16_C( 20847), -INT16_C( 20636),  INT16_C(  5107),
+       INT16_C( 13950), -INT16_C( 28475),  INT16_C( 27208),  INT16_C(  4863), -INT16_C( 11441), -INT16_C( 16236), -INT16_C( 25357), -INT16_C( 10876),
+       INT16_C(  8451),  INT16_C(  3745),  INT16_C( 25534),  INT16_C( 14449), -INT16_C(  7985),  INT16_C( 13193),  INT16_C( 32143),  INT16_C(  3398),
+       INT16_C(  2995), -INT16_C(   867), -INT16_C( 25483), -INT16_C( 15346), -INT16_C( 23953),  INT16_C( 25477),  INT16_C(  2367),  INT16_C( 16952),
+      -INT16_C(  9942), -INT16_C(  6063), -INT16_C( 15812),  INT16_C(  2848), -INT16_C( 21853),  INT16_C( 12862), -INT16_C( 31705), -INT16_C(  9664),
+      -INT16_C(  8817),  INT16_C(  1494), -INT16_C(  7046), -INT16_C(  5687),  INT16_C( 20103), -INT16_C( 14772), -INT16_C( 31401), -INT16_C( 32248),
+       INT16_C( 22878), -INT16_C( 25750), -INT16_C( 29924), -INT16_C( 16474), -INT16_C(  6859),  INT16_C( 23793),  INT16_C( 12649), -INT16_C(  1738),
+       INT16_C(  3343), -INT16_C( 30210), -INT16_C( 14351),  INT16_C( 30834), -INT16_C( 16618),  INT16_C( 27966),  INT16_C( 18244), -INT16_C( 23825),
+       INT16_C( 23200), -INT16_C( 17347), -INT16_C(  6939),  INT16_C(  6779),  INT16_C( 28105),  INT16_C( 12918), -INT16_C( 21346), -INT16_C( 21205),
+       INT16_C( 10681), -INT16_C( 21706), -INT16_C( 22031),  INT16_C(  1827),  INT16_C( 25192), -INT16_C( 21388),  INT16_C( 25769),  INT16_C( 18766),
+      -INT16_C( 29506), -INT16_C( 23802), -INT16_C( 32400),  INT16_C( 14781),  INT16_C( 13294), -INT16_C( 29333), -INT16_C( 26657), -INT16_C( 26310),
+       INT16_C( 29120), -INT16_C( 20156),  INT16_C( 26394), -INT16_C( 32072),  INT16_C( 11721),  INT16_C( 29230),  INT16_C( 31889),  INT16_C( 20412),
+      -INT16_C( 15864),  INT16_C( 30962), -INT16_C( 20669),  INT16_C( 12977),  INT16_C(  7650), -INT16_C( 15937), -INT16_C(  1612),  INT16_C( 29786),
+      -INT16_C( 24982), -INT16_C( 31706), -INT16_C(  8698), -INT16_C( 12538),  INT16_C( 13323), -INT16_C( 25534), -INT16_C(   335), -INT16_C( 17941),
+      -INT16_C(  8768),  INT16_C(   818), -INT16_C(  7284),  INT16_C( 28213), -INT16_C(  3072), -INT16_C( 19408), -INT16_C( 29970),  INT16_C( 22569),
+       INT16_C( 20265),  INT16_C( 12253), -INT16_C(  7379),  INT16_C( 14846),  INT16_C( 16408), -INT16_C( 13867), -INT16_C( 16066), -INT16_C(   382),
+      -INT16_C( 19298),  INT16_C( 11010),  INT16_C( 14232), -INT16_C( 26471), -INT16_C( 14036),  INT16_C(  6733),  INT16_C( 30292),  INT16_C( 32114),
+       INT16_C( 20421), -INT16_C(  3412), -INT16_C( 21965),  INT16_C( 19243),  INT16_C(   491),  INT16_C( 10516), -INT16_C( 26942),  INT16_C( 24616),
+       INT16_C( 10827), -INT16_C(  7285),  INT16_C(  9569), -INT16_C( 29317), -INT16_C( 14098),  INT16_C( 17063),  INT16_C(  6718),  INT16_C(   959),
+       INT16_C( 27497), -INT16_C( 25354),  INT16_C(  8470),  INT16_C(   487), -INT16_C(  1246), -INT16_C(  7126),  INT16_C( 21138), -INT16_C(  8891),
+      -INT16_C( 12164), -INT16_C(  8512),  INT16_C( 15349), -INT16_C(  7061),  INT16_C(  4868),  INT16_C( 16934), -INT16_C(  6611), -INT16_C( 27066),
+       INT16_C( 15441),  INT16_C( 26419),  INT16_C(  6749), -INT16_C( 32664), -INT16_C( 27882), -INT16_C( 22428), -INT16_C( 22043),  INT16_C( 25221),
+       INT16_C( 17786),  INT16_C( 28480), -INT16_C( 21632), -INT16_C( 31661),  INT16_C( 31422), -INT16_C(  5177),  INT16_C(  3424), -INT16_C( 20094),
+      -INT16_C( 19127), -INT16_C( 23015), -INT16_C( 32305), -INT16_C(  6874), -INT16_C( 29932), -INT16_C(  1395),  INT16_C(  4660), -INT16_C( 20900),
+      -INT16_C( 25513), -INT16_C( 10210),  INT16_C( 28999),  INT16_C(  1628),  INT16_C(  9195),  INT16_C( 19441),  INT16_C( 29488),  INT16_C( 31229),
+       INT16_C(  5672), -INT16_C(  2016),  INT16_C( 18071), -INT16_C( 21283),  INT16_C( 27601),  INT16_C(  1702),  INT16_C(   637), -INT16_C( 10828),
+      -INT16_C( 11618), -INT16_C(  6739),  INT16_C(  2372),  INT16_C( 12267), -INT16_C(  8915),  INT16_C( 23931),  INT16_C( 30800),  INT16_C( 31191),
+      -INT16_C(  2162),  INT16_C(  9585),  INT16_C( 20029),  INT16_C(  4049),  INT16_C( 30649),  INT16_C( 14101), -INT16_C( 13959),  INT16_C(  5900),
+      -INT16_C( 18020), -INT16_C(  7939), -INT16_C(  5950), -INT16_C(  4337), -INT16_C( 30011),  INT16_C(  5709),  INT16_C(  9218), -INT16_C( 28529),
+       INT16_C(    27),  INT16_C( 22710), -INT16_C( 30898),  INT16_C(  2151),  INT16_C( 31999),  INT16_C( 30783),  INT16_C( 19270), -INT16_C(  7536),
+      -INT16_C( 29436), -INT16_C( 14654), -INT16_C( 11915),  INT16_C( 15286),  INT16_C(   860),  INT16_C( 24145), -INT16_C(  8153),  INT16_C( 17135),
+      -INT16_C( 23072),  INT16_C( 11930),  INT16_C(   556),  INT16_C( 11062),  INT16_C( 30078), -INT16_C( 15196),  INT16_C( 13504), -INT16_C( 15194),
+       INT16_C( 26817),  INT16_C( 13963),  INT16_C( 16698), -INT16_C( 27023), -INT16_C( 15804),  INT16_C( 27636), -INT16_C(  7262), -INT16_C( 32083),
+       INT16_C( 18312), -INT16_C( 19023), -INT16_C(  6327), -INT16_C( 14112), -INT16_C( 31651),  INT16_C(  7564),  INT16_C( 13240),  INT16_C( 31202),
+       INT16_C( 28059), -INT16_C( 10832),  INT16_C(  8622), -INT16_C(  3477),  INT16_C( 24804), -INT16_C( 31139),  INT16_C(  2627), -INT16_C( 13303),
+      -INT16_C( 17839), -INT16_C( 25727),  INT16_C( 24993), -INT16_C(   413), -INT16_C(  4122), -INT16_C( 25060), -INT16_C(   478), -INT16_C( 16872),
+      -INT16_C( 14229),  INT16_C(  6547), -INT16_C(    23), -INT16_C( 13045),  INT16_C( 26719), -INT16_C( 23980),  INT16_C( 23922), -INT16_C( 15506) };
+  static const int16_t b =  INT16_C(  8441);
+  static const int16_t e[] =
+    { -INT16_C( 12160),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6322),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441), -INT16_C( 29255),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(  9633), -INT16_C( 23319), -INT16_C(  2305), -INT16_C(  8872),  INT16_C(     0), -INT16_C(  1833),  INT16_C(     0),
+      -INT16_C( 12369),  INT16_C(     0),  INT16_C(  4626),  INT16_C(  8441), -INT16_C(  6967), -INT16_C( 32044),  INT16_C(  8305),  INT16_C(     0),
+       INT16_C(  8441), -INT16_C( 13411), -INT16_C( 25589),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),  INT16_C(  5107),
+       INT16_C(  8441),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4863),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25357),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(  8441), -INT16_C(  7985),  INT16_C(  8441),  INT16_C(  8441),  INT16_C(  3398),
+       INT16_C(     0), -INT16_C(   867),  INT16_C(     0),  INT16_C(     0), -INT16_C( 23953),  INT16_C(  8441),  INT16_C(  2367),  INT16_C(  8441),
+      -INT16_C(  9942), -INT16_C(  6063), -INT16_C( 15812),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441), -INT16_C( 31705), -INT16_C(  9664),
+      -INT16_C(  8817),  INT16_C(     0), -INT16_C(  7046), -INT16_C(  5687),  INT16_C(  8441), -INT16_C( 14772),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 29924), -INT16_C( 16474), -INT16_C(  6859),  INT16_C(  8441),  INT16_C(  8441),  INT16_C(     0),
+       INT16_C(  3343),  INT16_C(     0), -INT16_C( 14351),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(  8441),  INT16_C(     0), -INT16_C(  6939),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 21346),  INT16_C(     0),
+       INT16_C(  8441),  INT16_C(     0), -INT16_C( 22031),  INT16_C(  1827),  INT16_C(  8441),  INT16_C(     0),  INT16_C(  8441),  INT16_C(  8441),
+      -INT16_C( 29506), -INT16_C( 23802), -INT16_C( 32400),  INT16_C(  8441),  INT16_C(     0), -INT16_C( 29333),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(  8441),  INT16_C(     0),
+      -INT16_C( 15864),  INT16_C(  8441),  INT16_C(     0),  INT16_C(  8441),  INT16_C(  7650),  INT16_C(     0), -INT16_C(  1612),  INT16_C(     0),
+      -INT16_C( 24982), -INT16_C( 31706), -INT16_C(  8698),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(  8768),  INT16_C(   818),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19408), -INT16_C( 29970),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(  8441), -INT16_C(  7379),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13867),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(  8441),  INT16_C(  8441), -INT16_C( 26471), -INT16_C( 14036),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 21965),  INT16_C(  8441),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),
+       INT16_C(  8441), -INT16_C(  7285),  INT16_C(     0), -INT16_C( 29317), -INT16_C( 14098),  INT16_C(     0),  INT16_C(     0),  INT16_C(   959),
+       INT16_C(     0), -INT16_C( 25354),  INT16_C(  8441),  INT16_C(   487),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441), -INT16_C(  8891),
+      -INT16_C( 12164), -INT16_C(  8512),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441), -INT16_C(  6611), -INT16_C( 27066),
+       INT16_C(  8441),  INT16_C(  8441),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22428),  INT16_C(     0),  INT16_C(  8441),
+       INT16_C(     0),  INT16_C(  8441),  INT16_C(     0), -INT16_C( 31661),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3424), -INT16_C( 20094),
+      -INT16_C( 19127),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6874),  INT16_C(     0), -INT16_C(  1395),  INT16_C(  4660),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(  8441),
+       INT16_C(  5672),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),  INT16_C(   637), -INT16_C( 10828),
+      -INT16_C( 11618), -INT16_C(  6739),  INT16_C(  2372),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),
+      -INT16_C(  2162),  INT16_C(  8441),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  5950),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441), -INT16_C( 28529),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0), -INT16_C(  7536),
+       INT16_C(     0), -INT16_C( 14654),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8153),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0), -INT16_C( 15196),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27023),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7262), -INT16_C( 32083),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 14112),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),
+       INT16_C(  8441), -INT16_C( 10832),  INT16_C(  8441),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0),  INT16_C(  2627),  INT16_C(     0),
+      -INT16_C( 17839),  INT16_C(     0),  INT16_C(  8441),  INT16_C(     0), -INT16_C(  4122), -INT16_C( 25060),  INT16_C(     0), -INT16_C( 16872),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(    23),  INT16_C(     0),  INT16_C(     0), -INT16_C( 23980),  INT16_C(     0),  INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_n_s16_z(pv, av, b);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    ev = simde_svmin_n_s16_z(pv, av, b);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0) };
+  static const int16_t a[] =
+    { -INT16_C( 16676),  INT16_C( 22204),  INT16_C(  9391),  INT16_C( 21604),  INT16_C(  7837),  INT16_C( 23301), -INT16_C(  7691),  INT16_C(  6028),
+      -INT16_C( 22176), -INT16_C(  6637), -INT16_C(  7446), -INT16_C( 16239), -INT16_C( 16846), -INT16_C( 10975), -INT16_C( 11603), -INT16_C( 30411),
+      -INT16_C(  3440),  INT16_C( 16352),  INT16_C( 17430), -INT16_C( 19308), -INT16_C( 26269),  INT16_C( 22543), -INT16_C( 25734), -INT16_C(  9616),
+      -INT16_C( 31932),  INT16_C( 12224),  INT16_C( 20837), -INT16_C( 26385),  INT16_C(  4367), -INT16_C( 17299), -INT16_C( 23837),  INT16_C( 29766),
+       INT16_C(  9876), -INT16_C( 21581),  INT16_C( 18282), -INT16_C( 12961),  INT16_C( 28384),  INT16_C( 23334), -INT16_C( 27126),  INT16_C( 20021),
+      -INT16_C(  2535),  INT16_C( 32637),  INT16_C( 27975),  INT16_C( 22295), -INT16_C( 31618),  INT16_C( 24851),  INT16_C( 22822), -INT16_C( 17451),
+      -INT16_C( 30337), -INT16_C(  5530), -INT16_C( 14896), -INT16_C( 20041), -INT16_C(  8909),  INT16_C( 15628),  INT16_C( 16755), -INT16_C( 29300),
+       INT16_C(  2359),  INT16_C( 32524),  INT16_C(  9078), -INT16_C(  2858), -INT16_C(  5721), -INT16_C( 12970),  INT16_C( 11075), -INT16_C( 15736),
+      -INT16_C(  4428), -INT16_C( 31316),  INT16_C( 25779), -INT16_C(  6346),  INT16_C( 16961), -INT16_C( 19164), -INT16_C( 20349), -INT16_C( 17598),
+       INT16_C( 20154),  INT16_C( 12346),  INT16_C(  4209),  INT16_C(  6181),  INT16_C( 31737),  INT16_C( 15589),  INT16_C( 28326),  INT16_C( 23551),
+      -INT16_C( 21668),  INT16_C(  4320),  INT16_C(  5647),  INT16_C( 20983),  INT16_C(  7000), -INT16_C(  9466),  INT16_C( 18636), -INT16_C( 31082),
+      -INT16_C( 12138),  INT16_C(  1974), -INT16_C(  9248), -INT16_C(  9697),  INT16_C(  1110), -INT16_C(   746),  INT16_C(  5490), -INT16_C( 12456),
+       INT16_C( 14529), -INT16_C( 12065), -INT16_C( 10674), -INT16_C( 23007),  INT16_C( 10225), -INT16_C( 17023),  INT16_C(  6255),  INT16_C(  1347),
+      -INT16_C(  1304), -INT16_C( 14068),  INT16_C( 11221),  INT16_C( 11427), -INT16_C( 18128), -INT16_C( 24023), -INT16_C( 32305), -INT16_C( 28559),
+       INT16_C( 20665),  INT16_C(  1888), -INT16_C( 32218),  INT16_C(  6317),  INT16_C( 11945),  INT16_C(  6613),  INT16_C(  6470),  INT16_C( 12062),
+       INT16_C( 11027), -INT16_C(  5896), -INT16_C( 25770), -INT16_C( 31212),  INT16_C( 15700),  INT16_C(  9001), -INT16_C( 25922),  INT16_C( 30643),
+       INT16_C(  5355),  INT16_C(  4478),  INT16_C( 11158),  INT16_C( 16169), -INT16_C(   166), -INT16_C( 24488),  INT16_C( 30488),  INT16_C( 11215),
+      -INT16_C( 14430), -INT16_C(  2029),  INT16_C( 10338), -INT16_C( 18561), -INT16_C( 22427),  INT16_C(  9434), -INT16_C( 29118),  INT16_C( 11675),
+       INT16_C(  6818),  INT16_C( 14399),  INT16_C( 26693), -INT16_C( 24713), -INT16_C( 12185),  INT16_C( 32576),  INT16_C(  3911), -INT16_C(  5718),
+      -INT16_C( 16681),  INT16_C( 14817),  INT16_C( 24806),  INT16_C( 19440), -INT16_C( 13560),  INT16_C( 19311),  INT16_C(  2905), -INT16_C(  1160),
+      -INT16_C( 18651),  INT16_C( 27187), -INT16_C( 21984), -INT16_C( 30966),  INT16_C( 19066), -INT16_C( 16121), -INT16_C( 20135),  INT16_C( 12458),
+      -INT16_C( 29585),  INT16_C( 21866),  INT16_C( 23276), -INT16_C(  2655),  INT16_C(  4133),  INT16_C( 32320), -INT16_C( 18405),  INT16_C( 16505),
+      -INT16_C( 21392), -INT16_C( 28501), -INT16_C( 19113), -INT16_C( 12009),  INT16_C(  7935),  INT16_C( 22675),  INT16_C( 15824),  INT16_C( 16265),
+      -INT16_C(  3127), -INT16_C( 18795),  INT16_C( 13901),  INT16_C( 29611), -INT16_C(  5306),  INT16_C( 25329),  INT16_C( 27555),  INT16_C(  5026),
+       INT16_C( 19735),  INT16_C( 28323), -INT16_C( 17662),  INT16_C(   320), -INT16_C( 11303), -INT16_C( 22182), -INT16_C(  7408), -INT16_C(  9495),
+       INT16_C( 32470),  INT16_C(  9104),  INT16_C( 15284), -INT16_C(  1386), -INT16_C( 30682), -INT16_C( 13988), -INT16_C(    13),  INT16_C(  2781),
+      -INT16_C( 32692),  INT16_C( 20345), -INT16_C( 18117),  INT16_C(  5456), -INT16_C( 21876), -INT16_C( 25410), -INT16_C( 22643),  INT16_C( 25462),
+       INT16_C(  1573), -INT16_C(  9849),  INT16_C(  7489),  INT16_C( 26580),  INT16_C( 12453), -INT16_C( 26575),  INT16_C(  3631),  INT16_C( 31907),
+       INT16_C(  7310), -INT16_C( 13621),  INT16_C(  7125),  INT16_C( 25055), -INT16_C( 25146),  INT16_C( 21501),  INT16_C( 29765),  INT16_C( 27319),
+       INT16_C( 15994), -INT16_C( 17340),  INT16_C(  6235),  INT16_C(   291),  INT16_C( 21576),  INT16_C( 30873),  INT16_C( 15458), -INT16_C(  3596),
+      -INT16_C( 16552),  INT16_C( 11707), -INT16_C( 25894), -INT16_C( 24434), -INT16_C( 29641),  INT16_C( 31988), -INT16_C( 21760),  INT16_C( 31463),
+       INT16_C( 11241),  INT16_C( 17462),  INT16_C( 23107), -INT16_C( 29883), -INT16_C(  8274),  INT16_C(  4355), -INT16_C(  2277),  INT16_C( 29698),
+      -INT16_C( 16970) };
+  static const int16_t b =  INT16_C(  9348);
+  static const int16_t e[] =
+    { -INT16_C( 16676),  INT16_C(  9348),  INT16_C(  9348),  INT16_C( 21604),  INT16_C(  7837),  INT16_C( 23301), -INT16_C(  7691),  INT16_C(  6028),
+      -INT16_C( 22176), -INT16_C(  6637), -INT16_C(  7446), -INT16_C( 16239), -INT16_C( 16846), -INT16_C( 10975), -INT16_C( 11603), -INT16_C( 30411),
+      -INT16_C(  3440),  INT16_C( 16352),  INT16_C( 17430), -INT16_C( 19308), -INT16_C( 26269),  INT16_C( 22543), -INT16_C( 25734), -INT16_C(  9616),
+      -INT16_C( 31932),  INT16_C( 12224),  INT16_C( 20837), -INT16_C( 26385),  INT16_C(  4367), -INT16_C( 17299), -INT16_C( 23837),  INT16_C(  9348),
+       INT16_C(  9876), -INT16_C( 21581),  INT16_C( 18282), -INT16_C( 12961),  INT16_C( 28384),  INT16_C(  9348), -INT16_C( 27126),  INT16_C( 20021),
+      -INT16_C(  2535),  INT16_C( 32637),  INT16_C(  9348),  INT16_C( 22295), -INT16_C( 31618),  INT16_C( 24851),  INT16_C(  9348), -INT16_C( 17451),
+      -INT16_C( 30337), -INT16_C(  5530), -INT16_C( 14896), -INT16_C( 20041), -INT16_C(  8909),  INT16_C( 15628),  INT16_C(  9348), -INT16_C( 29300),
+       INT16_C(  2359),  INT16_C( 32524),  INT16_C(  9078), -INT16_C(  2858), -INT16_C(  5721), -INT16_C( 12970),  INT16_C(  9348), -INT16_C( 15736),
+      -INT16_C(  4428), -INT16_C( 31316),  INT16_C(  9348), -INT16_C(  6346),  INT16_C(  9348), -INT16_C( 19164), -INT16_C( 20349), -INT16_C( 17598),
+       INT16_C(  9348),  INT16_C( 12346),  INT16_C(  4209),  INT16_C(  6181),  INT16_C( 31737),  INT16_C(  9348),  INT16_C( 28326),  INT16_C( 23551),
+      -INT16_C( 21668),  INT16_C(  4320),  INT16_C(  5647),  INT16_C( 20983),  INT16_C(  7000), -INT16_C(  9466),  INT16_C( 18636), -INT16_C( 31082),
+      -INT16_C( 12138),  INT16_C(  1974), -INT16_C(  9248), -INT16_C(  9697),  INT16_C(  1110), -INT16_C(   746),  INT16_C(  5490), -INT16_C( 12456),
+       INT16_C(  9348), -INT16_C( 12065), -INT16_C( 10674), -INT16_C( 23007),  INT16_C( 10225), -INT16_C( 17023),  INT16_C(  6255),  INT16_C(  1347),
+      -INT16_C(  1304), -INT16_C( 14068),  INT16_C(  9348),  INT16_C( 11427), -INT16_C( 18128), -INT16_C( 24023), -INT16_C( 32305), -INT16_C( 28559),
+       INT16_C(  9348),  INT16_C(  1888), -INT16_C( 32218),  INT16_C(  6317),  INT16_C( 11945),  INT16_C(  6613),  INT16_C(  6470),  INT16_C(  9348),
+       INT16_C( 11027), -INT16_C(  5896), -INT16_C( 25770), -INT16_C( 31212),  INT16_C(  9348),  INT16_C(  9001), -INT16_C( 25922),  INT16_C(  9348),
+       INT16_C(  5355),  INT16_C(  4478),  INT16_C( 11158),  INT16_C(  9348), -INT16_C(   166), -INT16_C( 24488),  INT16_C(  9348),  INT16_C(  9348),
+      -INT16_C( 14430), -INT16_C(  2029),  INT16_C(  9348), -INT16_C( 18561), -INT16_C( 22427),  INT16_C(  9348), -INT16_C( 29118),  INT16_C(  9348),
+       INT16_C(  6818),  INT16_C(  9348),  INT16_C(  9348), -INT16_C( 24713), -INT16_C( 12185),  INT16_C( 32576),  INT16_C(  3911), -INT16_C(  5718),
+      -INT16_C( 16681),  INT16_C( 14817),  INT16_C(  9348),  INT16_C(  9348), -INT16_C( 13560),  INT16_C(  9348),  INT16_C(  2905), -INT16_C(  1160),
+      -INT16_C( 18651),  INT16_C( 27187), -INT16_C( 21984), -INT16_C( 30966),  INT16_C( 19066), -INT16_C( 16121), -INT16_C( 20135),  INT16_C(  9348),
+      -INT16_C( 29585),  INT16_C(  9348),  INT16_C(  9348), -INT16_C(  2655),  INT16_C(  4133),  INT16_C( 32320), -INT16_C( 18405),  INT16_C(  9348),
+      -INT16_C( 21392), -INT16_C( 28501), -INT16_C( 19113), -INT16_C( 12009),  INT16_C(  7935),  INT16_C(  9348),  INT16_C( 15824),  INT16_C( 16265),
+      -INT16_C(  3127), -INT16_C( 18795),  INT16_C( 13901),  INT16_C(  9348), -INT16_C(  5306),  INT16_C(  9348),  INT16_C(  9348),  INT16_C(  5026),
+       INT16_C( 19735),  INT16_C(  9348), -INT16_C( 17662),  INT16_C(   320), -INT16_C( 11303), -INT16_C( 22182), -INT16_C(  7408), -INT16_C(  9495),
+       INT16_C( 32470),  INT16_C(  9104),  INT16_C( 15284), -INT16_C(  1386), -INT16_C( 30682), -INT16_C( 13988), -INT16_C(    13),  INT16_C(  2781),
+      -INT16_C( 32692),  INT16_C(  9348), -INT16_C( 18117),  INT16_C(  5456), -INT16_C( 21876), -INT16_C( 25410), -INT16_C( 22643),  INT16_C(  9348),
+       INT16_C(  1573), -INT16_C(  9849),  INT16_C(  7489),  INT16_C( 26580),  INT16_C(  9348), -INT16_C( 26575),  INT16_C(  3631),  INT16_C(  9348),
+       INT16_C(  7310), -INT16_C( 13621),  INT16_C(  7125),  INT16_C(  9348), -INT16_C( 25146),  INT16_C(  9348),  INT16_C(  9348),  INT16_C( 27319),
+       INT16_C(  9348), -INT16_C( 17340),  INT16_C(  6235),  INT16_C(   291),  INT16_C( 21576),  INT16_C(  9348),  INT16_C( 15458), -INT16_C(  3596),
+      -INT16_C( 16552),  INT16_C( 11707), -INT16_C( 25894), -INT16_C( 24434), -INT16_C( 29641),  INT16_C( 31988), -INT16_C( 21760),  INT16_C(  9348),
+       INT16_C(  9348),  INT16_C( 17462),  INT16_C(  9348), -INT16_C( 29883), -INT16_C(  8274),  INT16_C(  4355), -INT16_C(  2277),  INT16_C(  9348),
+      -INT16_C( 16970) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_n_s16_m(pv, av, b);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    ev = simde_svmin_n_s16_m(pv, av, b);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    { -INT32_C(  1888514026),  INT32_C(   679817893), -INT32_C(   175397484),  INT32_C(   501949320), -INT32_C(   107313559), -INT32_C(  1670833720),  INT32_C(   266036812), -INT32_C(  1685431419),
+      -INT32_C(  1859388949), -INT32_C(  1061572564), -INT32_C(   558545834), -INT32_C(   772038552), -INT32_C(   271936218), -INT32_C(    74763089),  INT32_C(   537618074), -INT32_C(  1380215359),
+      -INT32_C(  1170282866), -INT32_C(   310708329), -INT32_C(  1546965189), -INT32_C(   160118832),  INT32_C(   199573340),  INT32_C(   218591603), -INT32_C(  1725099305),  INT32_C(   893839783),
+       INT32_C(  1727038671), -INT32_C(  1236047237),  INT32_C(  1784291226),  INT32_C(  1113640678), -INT32_C(  2142353907), -INT32_C(  1903274569),  INT32_C(   237484903),  INT32_C(  1950576036),
+       INT32_C(  1826239473),  INT32_C(   941829790),  INT32_C(   866286925),  INT32_C(  1500840523), -INT32_C(     2505912),  INT32_C(  2140038936), -INT32_C(   947014365),  INT32_C(   339464483),
+      -INT32_C(  1568598524), -INT32_C(  1847942076),  INT32_C(  1824816161), -INT32_C(   943376001),  INT32_C(   365404157),  INT32_C(   697652486),  INT32_C(   770777610), -INT32_C(   129880845),
+      -INT32_C(  2036677822), -INT32_C(  2011728537),  INT32_C(  1895095281),  INT32_C(   305707541),  INT32_C(  1596456793),  INT32_C(  1586084948), -INT32_C(   762545441), -INT32_C(   372584794),
+      -INT32_C(   126917231), -INT32_C(   880769062),  INT32_C(  2000450658), -INT32_C(  2021034962), -INT32_C(   941117069),  INT32_C(  1277522029), -INT32_C(  1876971030),  INT32_C(   276425087),
+       INT32_C(   671672654), -INT32_C(   755726224),  INT32_C(   726282493),  INT32_C(   397661092), -INT32_C(   220292476), -INT32_C(   197262582),  INT32_C(   881089973), -INT32_C(  1790575033),
+       INT32_C(  1472089575), -INT32_C(   752241962), -INT32_C(  2030144542), -INT32_C(   878857913),  INT32_C(  1438481227),  INT32_C(   860486782), -INT32_C(  1603744167), -INT32_C(  1288262196),
+      -INT32_C(   804588294), -INT32_C(  2002570330), -INT32_C(   301030745), -INT32_C(  1615221933), -INT32_C(  1527482586), -INT32_C(   858243469), -INT32_C(   663928820), -INT32_C(   410278931),
+       INT32_C(  1035507095),  INT32_C(  1875205064),  INT32_C(  1365103613), -INT32_C(  1527769218),  INT32_C(    21554318),  INT32_C(   785195042),  INT32_C(  1292253792),  INT32_C(  1949667805),
+      -INT32_C(   273552090),  INT32_C(  1180595784), -INT32_C(   946357175),  INT32_C(  1634437075), -INT32_C(  1906133909),  INT32_C(   901525460),  INT32_C(  1199752042),  INT32_C(  2075965268),
+      -INT32_C(   311792220),  INT32_C(   758368484),  INT32_C(  1475725956), -INT32_C(  1128767407), -INT32_C(   381019628), -INT32_C(  1273100470),  INT32_C(   519807178), -INT32_C(    57034920),
+       INT32_C(   166265637),  INT32_C(  1345723596),  INT32_C(   933768166), -INT32_C(  1594597236), -INT32_C(   980861317),  INT32_C(   259630917), -INT32_C(  1607568312),  INT32_C(  1369229100),
+      -INT32_C(  1755674933), -INT32_C(  1981312862),  INT32_C(  1220579260),  INT32_C(  1810412784),  INT32_C(   942699251),  INT32_C(  1632151833),  INT32_C(  1224832541),  INT32_C(   144350781),
+      -INT32_C(   962595804),  INT32_C(  1095731077),  INT32_C(   109645846), -INT32_C(  1217302076), -INT32_C(    34561565),  INT32_C(  1751005258), -INT32_C(   340696914),  INT32_C(   586435838),
+      -INT32_C(   974613696),  INT32_C(   822491162),  INT32_C(   204967752), -INT32_C(   456873727), -INT32_C(  1780370358), -INT32_C(  1694678804), -INT32_C(  1635406176),  INT32_C(  1002469882),
+       INT32_C(   654354445),  INT32_C(   676857824), -INT32_C(  1758097258), -INT32_C(  2088961735), -INT32_C(  1726456403),  INT32_C(  1026758045), -INT32_C(  1092896572),  INT32_C(  1073322802),
+       INT32_C(   610728516), -INT32_C(  1756512511), -INT32_C(  2010152369),  INT32_C(   671853435), -INT32_C(  1497291768), -INT32_C(    35392455), -INT32_C(   558055508), -INT32_C(  1642220198),
+      -INT32_C(  1329363793), -INT32_C(  1840771005),  INT32_C(   219838354),  INT32_C(   708125986), -INT32_C(  2083457463), -INT32_C(  1769949974), -INT32_C(   847954829), -INT32_C(  1586720014),
+       INT32_C(  1498558230), -INT32_C(   773088705),  INT32_C(   870188305),  INT32_C(  1952256811), -INT32_C(   201904631),  INT32_C(  1435072738), -INT32_C(  1507656012), -INT32_C(  1488417135),
+      -INT32_C(    67003715),  INT32_C(  1171123252),  INT32_C(   494447602), -INT32_C(   946743874), -INT32_C(   440760061), -INT32_C(  1254472703), -INT32_C(   748921534), -INT32_C(  1451514645),
+       INT32_C(  1923447870),  INT32_C(  1521972072), -INT32_C(   579391714),  INT32_C(   144967940), -INT32_C(  1813160046), -INT32_C(   448255837),  INT32_C(  1891214469), -INT32_C(  2045168568),
+       INT32_C(   418955184),  INT32_C(  1349758770), -INT32_C(   483530018), -INT32_C(  2048142605), -INT32_C(   736569295), -INT32_C(  2051448576),  INT32_C(  1324773893),  INT32_C(  1456738214),
+       INT32_C(     7327182),  INT32_C(  1532093052), -INT32_C(  1069646132), -INT32_C(  2126173872),  INT32_C(    39149057), -INT32_C(   997781569),  INT32_C(   672300417),  INT32_C(  1535043469),
+       INT32_C(   811396532), -INT32_C(  1668567601),  INT32_C(  2086455595) };
+  static const int32_t b =  INT32_C(  1887790105);
+  static const int32_t e[] =
+    { -INT32_C(  1888514026),  INT32_C(   679817893),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1670833720),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(  1859388949), -INT32_C(  1061572564), -INT32_C(   558545834), -INT32_C(   772038552), -INT32_C(   271936218), -INT32_C(    74763089),  INT32_C(   537618074),  INT32_C(           0),
+      -INT32_C(  1170282866),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   199573340),  INT32_C(           0), -INT32_C(  1725099305),  INT32_C(   893839783),
+       INT32_C(  1727038671), -INT32_C(  1236047237),  INT32_C(  1784291226),  INT32_C(  1113640678), -INT32_C(  2142353907), -INT32_C(  1903274569),  INT32_C(   237484903),  INT32_C(           0),
+       INT32_C(  1826239473),  INT32_C(   941829790),  INT32_C(           0),  INT32_C(  1500840523), -INT32_C(     2505912),  INT32_C(           0), -INT32_C(   947014365),  INT32_C(   339464483),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(  1824816161),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   770777610), -INT32_C(   129880845),
+      -INT32_C(  2036677822),  INT32_C(           0),  INT32_C(  1887790105),  INT32_C(           0),  INT32_C(  1596456793),  INT32_C(           0),  INT32_C(           0), -INT32_C(   372584794),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1277522029), -INT32_C(  1876971030),  INT32_C(   276425087),
+       INT32_C(           0), -INT32_C(   755726224),  INT32_C(   726282493),  INT32_C(   397661092),  INT32_C(           0), -INT32_C(   197262582),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1472089575), -INT32_C(   752241962), -INT32_C(  2030144542), -INT32_C(   878857913),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(   804588294), -INT32_C(  2002570330),  INT32_C(           0), -INT32_C(  1615221933), -INT32_C(  1527482586),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(  1365103613), -INT32_C(  1527769218),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1292253792),  INT32_C(  1887790105),
+       INT32_C(           0),  INT32_C(  1180595784),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1906133909),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(   311792220),  INT32_C(   758368484),  INT32_C(           0), -INT32_C(  1128767407),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(    57034920),
+       INT32_C(   166265637),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1594597236),  INT32_C(           0),  INT32_C(   259630917),  INT32_C(           0),  INT32_C(  1369229100),
+      -INT32_C(  1755674933), -INT32_C(  1981312862),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1224832541),  INT32_C(   144350781),
+       INT32_C(           0),  INT32_C(  1095731077),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1751005258),  INT32_C(           0),  INT32_C(   586435838),
+      -INT32_C(   974613696),  INT32_C(   822491162),  INT32_C(           0), -INT32_C(   456873727),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   654354445),  INT32_C(           0), -INT32_C(  1758097258), -INT32_C(  2088961735),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   610728516), -INT32_C(  1756512511), -INT32_C(  2010152369),  INT32_C(   671853435), -INT32_C(  1497291768), -INT32_C(    35392455),  INT32_C(           0), -INT32_C(  1642220198),
+      -INT32_C(  1329363793), -INT32_C(  1840771005),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2083457463),  INT32_C(           0), -INT32_C(   847954829), -INT32_C(  1586720014),
+       INT32_C(  1498558230), -INT32_C(   773088705),  INT32_C(   870188305),  INT32_C(  1887790105),  INT32_C(           0),  INT32_C(  1435072738),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(    67003715),  INT32_C(           0),  INT32_C(   494447602), -INT32_C(   946743874), -INT32_C(   440760061),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1451514645),
+       INT32_C(  1887790105),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1813160046), -INT32_C(   448255837),  INT32_C(  1887790105), -INT32_C(  2045168568),
+       INT32_C(   418955184),  INT32_C(  1349758770),  INT32_C(           0), -INT32_C(  2048142605),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1324773893),  INT32_C(  1456738214),
+       INT32_C(           0),  INT32_C(  1532093052),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   672300417),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(  1668567601),  INT32_C(           0) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_n_s32_z(pv, av, b);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    ev = simde_svmin_n_s32_z(pv, av, b);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    {  INT32_C(  2134636654), -INT32_C(  1191867527),  INT32_C(   824423824), -INT32_C(  1946881633), -INT32_C(  1097528219),  INT32_C(    36888372),  INT32_C(  1024799733), -INT32_C(   176791417),
+      -INT32_C(   780881576), -INT32_C(   846567108), -INT32_C(  1090605793),  INT32_C(    72020895),  INT32_C(   868409343), -INT32_C(  1288309314), -INT32_C(  1343141336),  INT32_C(    44328874),
+       INT32_C(  1439897881), -INT32_C(  1591583358), -INT32_C(  1436540661),  INT32_C(   330213908),  INT32_C(  1195798921), -INT32_C(  1896187034),  INT32_C(  1866329029),  INT32_C(  1819402579),
+       INT32_C(  2109818106), -INT32_C(  1390484318),  INT32_C(   425164293), -INT32_C(  1322515160), -INT32_C(   587697546), -INT32_C(  1301613587),  INT32_C(   824289246), -INT32_C(  2086825335),
+       INT32_C(  2013290454),  INT32_C(  1210392387), -INT32_C(   966689635), -INT32_C(   126382718), -INT32_C(   321556225),  INT32_C(  1100889955),  INT32_C(  1886633959),  INT32_C(   670240849),
+      -INT32_C(  1298074513), -INT32_C(  1325742829), -INT32_C(   998876350), -INT32_C(   407048472), -INT32_C(  1043099298), -INT32_C(  1207799343), -INT32_C(  2128054992), -INT32_C(   173466746),
+       INT32_C(   581454095),  INT32_C(  1356046862), -INT32_C(   434877954), -INT32_C(  1781608137),  INT32_C(   861315426),  INT32_C(  1139497235),  INT32_C(  1422201806),  INT32_C(  1045065263),
+      -INT32_C(   983436617), -INT32_C(  1844038508), -INT32_C(  1250350467),  INT32_C(  1581926395), -INT32_C(    74341912), -INT32_C(   935363078), -INT32_C(  1088617328),  INT32_C(   704538482),
+      -INT32_C(   303145127),  INT32_C(   276825235),  INT32_C(   717617455),  INT32_C(   680005696), -INT32_C(  1423697231),  INT32_C(   661873559), -INT32_C(   639135641),  INT32_C(  1342367223),
+      -INT32_C(   683741116),  INT32_C(   619167477), -INT32_C(   145838665),  INT32_C(  1847580605), -INT32_C(  2011610127),  INT32_C(   229608614),  INT32_C(   350656029), -INT32_C(  1083840389),
+      -INT32_C(   828988455),  INT32_C(   418545249), -INT32_C(   401653717),  INT32_C(   139865623),  INT32_C(   412118898),  INT32_C(   405160187),  INT32_C(  1378684118), -INT32_C(   837709067),
+      -INT32_C(  1768118219),  INT32_C(  1370394150), -INT32_C(   432423474),  INT32_C(  1575915499), -INT32_C(   109674498), -INT32_C(  1793942337), -INT32_C(  1645789272),  INT32_C(   107739601),
+      -INT32_C(   946075743),  INT32_C(  1679313557), -INT32_C(   230010617), -INT32_C(   565167904),  INT32_C(  1993852599),  INT32_C(   168618338), -INT32_C(   106368216), -INT32_C(  1912663060),
+      -INT32_C(  1336632549), -INT32_C(   334205723), -INT32_C(  1646305603),  INT32_C(  1316695959),  INT32_C(  1472549877),  INT32_C(  1700909372), -INT32_C(  1319237180),  INT32_C(   943611421),
+      -INT32_C(   538405895), -INT32_C(  1110704641), -INT32_C(   228939173), -INT32_C(   834545959),  INT32_C(  1696925225), -INT32_C(  1681225769), -INT32_C(  1387517552), -INT32_C(  2132440185),
+       INT32_C(   492817950),  INT32_C(   651832267), -INT32_C(  1357302315),  INT32_C(   880630283),  INT32_C(   932815712), -INT32_C(  1160616918),  INT32_C(   342368141), -INT32_C(   929804886),
+      -INT32_C(   421137381), -INT32_C(   200425441),  INT32_C(    10692341), -INT32_C(   533454464), -INT32_C(   300429884), -INT32_C(  1096226511), -INT32_C(  1294856184),  INT32_C(  2038064990),
+       INT32_C(  2053136475),  INT32_C(   359558432),  INT32_C(   320148115), -INT32_C(   135050957),  INT32_C(  1222969878), -INT32_C(    66679309), -INT32_C(    55649890), -INT32_C(  1686820544),
+      -INT32_C(  1458186871), -INT32_C(   708934846), -INT32_C(   924265579),  INT32_C(   851434268), -INT32_C(   646273819), -INT32_C(   791314126), -INT32_C(  1697873062),  INT32_C(   892682668),
+       INT32_C(  1507740183),  INT32_C(  1664064717), -INT32_C(  1960110225), -INT32_C(   658576397), -INT32_C(  1045350257),  INT32_C(   328304313), -INT32_C(  1230152438), -INT32_C(  1225989473),
+      -INT32_C(    99628500), -INT32_C(   698532249),  INT32_C(  1231194198),  INT32_C(    52502643),  INT32_C(   314889048),  INT32_C(  1663391321),  INT32_C(  1377489843), -INT32_C(   502790475),
+       INT32_C(   937171152), -INT32_C(  1408353962),  INT32_C(   905277633), -INT32_C(   398977136),  INT32_C(  1140522218),  INT32_C(   111616082), -INT32_C(  1470578189) };
+  static const int32_t b =  INT32_C(  1578201481);
+  static const int32_t e[] =
+    {  INT32_C(  1578201481), -INT32_C(  1191867527),  INT32_C(   824423824), -INT32_C(  1946881633), -INT32_C(  1097528219),  INT32_C(    36888372),  INT32_C(  1024799733), -INT32_C(   176791417),
+      -INT32_C(   780881576), -INT32_C(   846567108), -INT32_C(  1090605793),  INT32_C(    72020895),  INT32_C(   868409343), -INT32_C(  1288309314), -INT32_C(  1343141336),  INT32_C(    44328874),
+       INT32_C(  1439897881), -INT32_C(  1591583358), -INT32_C(  1436540661),  INT32_C(   330213908),  INT32_C(  1195798921), -INT32_C(  1896187034),  INT32_C(  1578201481),  INT32_C(  1578201481),
+       INT32_C(  2109818106), -INT32_C(  1390484318),  INT32_C(   425164293), -INT32_C(  1322515160), -INT32_C(   587697546), -INT32_C(  1301613587),  INT32_C(   824289246), -INT32_C(  2086825335),
+       INT32_C(  2013290454),  INT32_C(  1210392387), -INT32_C(   966689635), -INT32_C(   126382718), -INT32_C(   321556225),  INT32_C(  1100889955),  INT32_C(  1578201481),  INT32_C(   670240849),
+      -INT32_C(  1298074513), -INT32_C(  1325742829), -INT32_C(   998876350), -INT32_C(   407048472), -INT32_C(  1043099298), -INT32_C(  1207799343), -INT32_C(  2128054992), -INT32_C(   173466746),
+       INT32_C(   581454095),  INT32_C(  1356046862), -INT32_C(   434877954), -INT32_C(  1781608137),  INT32_C(   861315426),  INT32_C(  1139497235),  INT32_C(  1422201806),  INT32_C(  1045065263),
+      -INT32_C(   983436617), -INT32_C(  1844038508), -INT32_C(  1250350467),  INT32_C(  1578201481), -INT32_C(    74341912), -INT32_C(   935363078), -INT32_C(  1088617328),  INT32_C(   704538482),
+      -INT32_C(   303145127),  INT32_C(   276825235),  INT32_C(   717617455),  INT32_C(   680005696), -INT32_C(  1423697231),  INT32_C(   661873559), -INT32_C(   639135641),  INT32_C(  1342367223),
+      -INT32_C(   683741116),  INT32_C(   619167477), -INT32_C(   145838665),  INT32_C(  1578201481), -INT32_C(  2011610127),  INT32_C(   229608614),  INT32_C(   350656029), -INT32_C(  1083840389),
+      -INT32_C(   828988455),  INT32_C(   418545249), -INT32_C(   401653717),  INT32_C(   139865623),  INT32_C(   412118898),  INT32_C(   405160187),  INT32_C(  1378684118), -INT32_C(   837709067),
+      -INT32_C(  1768118219),  INT32_C(  1370394150), -INT32_C(   432423474),  INT32_C(  1575915499), -INT32_C(   109674498), -INT32_C(  1793942337), -INT32_C(  1645789272),  INT32_C(   107739601),
+      -INT32_C(   946075743),  INT32_C(  1578201481), -INT32_C(   230010617), -INT32_C(   565167904),  INT32_C(  1578201481),  INT32_C(   168618338), -INT32_C(   106368216), -INT32_C(  1912663060),
+      -INT32_C(  1336632549), -INT32_C(   334205723), -INT32_C(  1646305603),  INT32_C(  1316695959),  INT32_C(  1472549877),  INT32_C(  1700909372), -INT32_C(  1319237180),  INT32_C(   943611421),
+      -INT32_C(   538405895), -INT32_C(  1110704641), -INT32_C(   228939173), -INT32_C(   834545959),  INT32_C(  1578201481), -INT32_C(  1681225769), -INT32_C(  1387517552), -INT32_C(  2132440185),
+       INT32_C(   492817950),  INT32_C(   651832267), -INT32_C(  1357302315),  INT32_C(   880630283),  INT32_C(   932815712), -INT32_C(  1160616918),  INT32_C(   342368141), -INT32_C(   929804886),
+      -INT32_C(   421137381), -INT32_C(   200425441),  INT32_C(    10692341), -INT32_C(   533454464), -INT32_C(   300429884), -INT32_C(  1096226511), -INT32_C(  1294856184),  INT32_C(  2038064990),
+       INT32_C(  2053136475),  INT32_C(   359558432),  INT32_C(   320148115), -INT32_C(   135050957),  INT32_C(  1222969878), -INT32_C(    66679309), -INT32_C(    55649890), -INT32_C(  1686820544),
+      -INT32_C(  1458186871), -INT32_C(   708934846), -INT32_C(   924265579),  INT32_C(   851434268), -INT32_C(   646273819), -INT32_C(   791314126), -INT32_C(  1697873062),  INT32_C(   892682668),
+       INT32_C(  1507740183),  INT32_C(  1664064717), -INT32_C(  1960110225), -INT32_C(   658576397), -INT32_C(  1045350257),  INT32_C(   328304313), -INT32_C(  1230152438), -INT32_C(  1225989473),
+      -INT32_C(    99628500), -INT32_C(   698532249),  INT32_C(  1231194198),  INT32_C(    52502643),  INT32_C(   314889048),  INT32_C(  1578201481),  INT32_C(  1377489843), -INT32_C(   502790475),
+       INT32_C(   937171152), -INT32_C(  1408353962),  INT32_C(   905277633), -INT32_C(   398977136),  INT32_C(  1140522218),  INT32_C(   111616082), -INT32_C(  1470578189) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_n_s32_m(pv, av, b);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    ev = simde_svmin_n_s32_m(pv, av, b);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0) };
+  static const int64_t a[] =
+    {  INT64_C( 4354073629338401660),  INT64_C( 6719720626003285699), -INT64_C( 6038029665256891537),  INT64_C( 5900380528677318931),
+       INT64_C(  646652774631833303),  INT64_C( 8187771731189875701),  INT64_C( 7429049687280564075), -INT64_C( 4692585989939164229),
+       INT64_C( 2837676999818597140),  INT64_C( 3074564086540529463), -INT64_C( 4287796242113118013), -INT64_C( 2602741079764356805),
+       INT64_C(  532152427545385992), -INT64_C( 7246875811783783036), -INT64_C( 1118526900940962644),  INT64_C(  721970130402397794),
+       INT64_C( 5919884734653347920),  INT64_C(   65305855193868404),  INT64_C( 3363398148318206471),  INT64_C(  291428529065148670),
+       INT64_C( 7760911583741759636),  INT64_C( 6055546322888903092), -INT64_C( 1354530228628570310),  INT64_C( 8878275912289586045),
+       INT64_C( 6461136754343500104),  INT64_C( 4286136023561364187), -INT64_C( 4105747627989955543),  INT64_C( 3774631028417164287),
+      -INT64_C( 6015367843540680825),  INT64_C( 8916370048752543616),  INT64_C( 8280881055369789147), -INT64_C( 7373595376414563188),
+      -INT64_C( 4794280549528756230),  INT64_C( 8430733664228100658), -INT64_C( 5197571597898509575), -INT64_C( 1507339244590385560),
+       INT64_C( 6409516332533340921),  INT64_C( 2847923326001361527),  INT64_C(  815276480024223341),  INT64_C( 6017823240993800103),
+      -INT64_C( 2381984848286172812),  INT64_C( 1586521237368065455), -INT64_C( 5818088832843671661), -INT64_C( 3085868023537940609),
+      -INT64_C( 2069016775542983163),  INT64_C( 4678330363842410542),  INT64_C( 1879047347560160091),  INT64_C( 3149739241235503999),
+      -INT64_C( 5481478309427075626), -INT64_C( 3601060616706806247), -INT64_C( 5564403825853236206), -INT64_C( 5768748447996593505),
+      -INT64_C( 9032066454165813138), -INT64_C( 5074062922653093547), -INT64_C( 6075306367803537462), -INT64_C(  400712010155605017),
+       INT64_C( 2798587845251246827),  INT64_C( 3901950628887076549), -INT64_C( 6773163450132361910), -INT64_C( 4635097005991694042),
+      -INT64_C(  795754846902576387), -INT64_C( 5788946976210820601), -INT64_C( 1841684446952760300), -INT64_C( 6554631197847595914),
+       INT64_C(  865368449335106783), -INT64_C(   45553957795306678), -INT64_C( 2401756261339209211),  INT64_C( 7592843068180022291),
+      -INT64_C( 8835929173173742770),  INT64_C(  992641334281298140), -INT64_C( 1857032450076404492), -INT64_C( 2038441144397831486),
+      -INT64_C( 8965655689410695725),  INT64_C( 5588140689227171703), -INT64_C( 6891101310177156956), -INT64_C( 3333327834194248122),
+       INT64_C(  286948948900312272), -INT64_C(  369557580898155207), -INT64_C( 5552991751428208271),  INT64_C( 5808599532137471181),
+       INT64_C( 2796386745225542463), -INT64_C( 3145596787159969272),  INT64_C( 7439967039418255905),  INT64_C( 6250661032376913391),
+       INT64_C( 5791611838791779915), -INT64_C( 3424697590658230462), -INT64_C( 7074136117706056495),  INT64_C( 2367146097518577259),
+       INT64_C( 3236321124977080912),  INT64_C( 8092769104312768719), -INT64_C( 5317995470799458842),  INT64_C( 6461277922576121525),
+      -INT64_C( 8420644174080900084),  INT64_C( 2775161022339282292), -INT64_C( 4392719315733094649),  INT64_C( 7029830208438813228),
+      -INT64_C( 3367430978894528003), -INT64_C( 5704257899503267984), -INT64_C( 6153872577434250809), -INT64_C( 2520486505326057649),
+       INT64_C( 5268607761626062319),  INT64_C( 3423808190854791465) };
+  static const int64_t b =  INT64_C( 2492344555603815074);
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C( 2492344555603815074), -INT64_C( 6038029665256891537),  INT64_C( 2492344555603815074),
+       INT64_C(  646652774631833303),  INT64_C( 2492344555603815074),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 2492344555603815074), -INT64_C( 4287796242113118013), -INT64_C( 2602741079764356805),
+       INT64_C(  532152427545385992),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  721970130402397794),
+       INT64_C( 2492344555603815074),  INT64_C(                   0),  INT64_C( 2492344555603815074),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2492344555603815074),
+      -INT64_C( 6015367843540680825),  INT64_C( 2492344555603815074),  INT64_C( 2492344555603815074), -INT64_C( 7373595376414563188),
+       INT64_C(                   0),  INT64_C( 2492344555603815074), -INT64_C( 5197571597898509575),  INT64_C(                   0),
+       INT64_C( 2492344555603815074),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 1586521237368065455),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 2069016775542983163),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 5481478309427075626), -INT64_C( 3601060616706806247), -INT64_C( 5564403825853236206), -INT64_C( 5768748447996593505),
+       INT64_C(                   0), -INT64_C( 5074062922653093547),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 2492344555603815074),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4635097005991694042),
+       INT64_C(                   0), -INT64_C( 5788946976210820601),  INT64_C(                   0), -INT64_C( 6554631197847595914),
+       INT64_C(                   0), -INT64_C(   45553957795306678),  INT64_C(                   0),  INT64_C( 2492344555603815074),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 1857032450076404492), -INT64_C( 2038441144397831486),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(  286948948900312272), -INT64_C(  369557580898155207), -INT64_C( 5552991751428208271),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2492344555603815074),
+       INT64_C( 2492344555603815074),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 2492344555603815074),  INT64_C( 2492344555603815074), -INT64_C( 5317995470799458842),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4392719315733094649),  INT64_C( 2492344555603815074),
+      -INT64_C( 3367430978894528003), -INT64_C( 5704257899503267984),  INT64_C(                   0), -INT64_C( 2520486505326057649),
+       INT64_C( 2492344555603815074),  INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_n_s64_z(pv, av, b);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    ev = simde_svmin_n_s64_z(pv, av, b);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1) };
+  static const int64_t a[] =
+    {  INT64_C( 7026919899122517985), -INT64_C( 8780811859679702798),  INT64_C( 2745725518678879138), -INT64_C( 6488814307691116843),
+      -INT64_C( 2797528220421241504),  INT64_C( 6622232886449892926),  INT64_C( 1605045363707378256),  INT64_C( 6481588031639183498),
+       INT64_C(  666342303419702654),  INT64_C( 4023210792951808449), -INT64_C( 3521360518053429046),  INT64_C( 2364409189538556029),
+       INT64_C(  685327008380941742),  INT64_C(  496618872255015878),  INT64_C( 6227409390187658072),  INT64_C( 5214214654847125915),
+       INT64_C( 7990304556389098130),  INT64_C( 1689131053552985647),  INT64_C( 5794198357680620090),  INT64_C( 7245422989834728873),
+      -INT64_C( 4548035765103341877),  INT64_C( 3989234882032958855), -INT64_C( 2728421401965228003),  INT64_C( 7142615106983997417),
+       INT64_C(  381321071612616184),  INT64_C( 3380979639735973302), -INT64_C( 3260003692736072265), -INT64_C( 8949025699045449518),
+       INT64_C( 1480654441002411273),  INT64_C( 3822627536920696525),  INT64_C(  262298608372354536), -INT64_C( 1888067226952650561),
+      -INT64_C(  120479874607687199), -INT64_C( 5223638120022664241),  INT64_C( 4335326507343322870), -INT64_C( 5395784232091608996),
+       INT64_C( 5934416663044983596),  INT64_C( 1578828462735439715), -INT64_C(  398173167027457601),  INT64_C( 9045850738444730367),
+       INT64_C( 3004523027554270940),  INT64_C( 3576214837880639852),  INT64_C( 4921843153212661430), -INT64_C( 5857878191550988059),
+       INT64_C( 3535257283926593312),  INT64_C( 7328868076554644242), -INT64_C( 1169240415355198660), -INT64_C( 6915318458017718649),
+      -INT64_C( 1630418689142155671), -INT64_C( 5253972905428116479),  INT64_C( 6647311767149530950), -INT64_C( 6197307957362465315),
+       INT64_C( 1986991348763821267),  INT64_C( 7747284435984974162), -INT64_C( 7501876875237802831),  INT64_C( 2902837508921727071),
+      -INT64_C( 6364318180683145353),  INT64_C(  934768895249840487),  INT64_C(  938286588911399859),  INT64_C( 7245435200965769742),
+       INT64_C( 3174937430095978259),  INT64_C( 3280223043195601693), -INT64_C( 7124519177953863580), -INT64_C( 3104231655825355623),
+      -INT64_C( 6638784663609548308), -INT64_C( 6019446520097761329),  INT64_C( 5396965676701127098),  INT64_C( 6936031009843504811),
+      -INT64_C( 7294159270510952803),  INT64_C( 4430234180624048519), -INT64_C( 4222851320009901461), -INT64_C( 8203743288487758255),
+      -INT64_C( 5812609826732033808), -INT64_C(  209142973529704360),  INT64_C( 6490388587112668468), -INT64_C( 6398412519813200716),
+      -INT64_C( 5452531640299231875) };
+  static const int64_t b = -INT64_C( 1415089688434377676);
+  static const int64_t e[] =
+    { -INT64_C( 1415089688434377676), -INT64_C( 8780811859679702798),  INT64_C( 2745725518678879138), -INT64_C( 6488814307691116843),
+      -INT64_C( 2797528220421241504), -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676),
+       INT64_C(  666342303419702654), -INT64_C( 1415089688434377676), -INT64_C( 3521360518053429046), -INT64_C( 1415089688434377676),
+       INT64_C(  685327008380941742),  INT64_C(  496618872255015878), -INT64_C( 1415089688434377676),  INT64_C( 5214214654847125915),
+       INT64_C( 7990304556389098130), -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676),  INT64_C( 7245422989834728873),
+      -INT64_C( 4548035765103341877),  INT64_C( 3989234882032958855), -INT64_C( 2728421401965228003),  INT64_C( 7142615106983997417),
+      -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676), -INT64_C( 3260003692736072265), -INT64_C( 8949025699045449518),
+      -INT64_C( 1415089688434377676),  INT64_C( 3822627536920696525), -INT64_C( 1415089688434377676), -INT64_C( 1888067226952650561),
+      -INT64_C( 1415089688434377676), -INT64_C( 5223638120022664241),  INT64_C( 4335326507343322870), -INT64_C( 5395784232091608996),
+      -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676),  INT64_C( 9045850738444730367),
+      -INT64_C( 1415089688434377676),  INT64_C( 3576214837880639852),  INT64_C( 4921843153212661430), -INT64_C( 5857878191550988059),
+      -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676), -INT64_C( 6915318458017718649),
+      -INT64_C( 1630418689142155671), -INT64_C( 5253972905428116479), -INT64_C( 1415089688434377676), -INT64_C( 6197307957362465315),
+      -INT64_C( 1415089688434377676), -INT64_C( 1415089688434377676), -INT64_C( 7501876875237802831),  INT64_C( 2902837508921727071),
+      -INT64_C( 6364318180683145353),  INT64_C(  934768895249840487),  INT64_C(  938286588911399859), -INT64_C( 1415089688434377676),
+       INT64_C( 3174937430095978259), -INT64_C( 1415089688434377676), -INT64_C( 7124519177953863580), -INT64_C( 3104231655825355623),
+      -INT64_C( 6638784663609548308), -INT64_C( 6019446520097761329),  INT64_C( 5396965676701127098), -INT64_C( 1415089688434377676),
+      -INT64_C( 7294159270510952803), -INT64_C( 1415089688434377676), -INT64_C( 4222851320009901461), -INT64_C( 8203743288487758255),
+      -INT64_C( 5812609826732033808), -INT64_C(  209142973529704360), -INT64_C( 1415089688434377676), -INT64_C( 6398412519813200716),
+      -INT64_C( 5452531640299231875) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_n_s64_m(pv, av, b);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    ev = simde_svmin_n_s64_m(pv, av, b);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C( 22), UINT8_C(158), UINT8_C( 43), UINT8_C(115), UINT8_C(104), UINT8_C(180), UINT8_C(181), UINT8_C(146),
+      UINT8_C(117), UINT8_C(140), UINT8_C(105), UINT8_C(  3), UINT8_C(199), UINT8_C( 62), UINT8_C(137), UINT8_C(170),
+      UINT8_C(183), UINT8_C(235), UINT8_C(166), UINT8_C( 87), UINT8_C(202), UINT8_C(202), UINT8_C(116), UINT8_C(191),
+      UINT8_C(183), UINT8_C(254), UINT8_C(217), UINT8_C(253), UINT8_C(  6), UINT8_C(117), UINT8_C( 41), UINT8_C( 28),
+      UINT8_C( 19), UINT8_C( 84), UINT8_C(144), UINT8_C(124), UINT8_C(  8), UINT8_C( 69), UINT8_C( 14), UINT8_C(125),
+      UINT8_C(209), UINT8_C(119), UINT8_C(129), UINT8_C(152), UINT8_C(182), UINT8_C( 10), UINT8_C( 66), UINT8_C(109),
+      UINT8_C(245), UINT8_C(232), UINT8_C(196), UINT8_C(191), UINT8_C(179), UINT8_C( 57), UINT8_C(126), UINT8_C(106),
+      UINT8_C( 55), UINT8_C( 88), UINT8_C(103), UINT8_C( 61), UINT8_C(205), UINT8_C(144), UINT8_C( 90), UINT8_C(225),
+      UINT8_C(228), UINT8_C(234), UINT8_C( 93), UINT8_C(237), UINT8_C( 47), UINT8_C(107), UINT8_C(106), UINT8_C(  0),
+      UINT8_C(226), UINT8_C(235), UINT8_C(152), UINT8_C(152), UINT8_C(246), UINT8_C(219), UINT8_C(  6), UINT8_C(235),
+      UINT8_C(195), UINT8_C(202), UINT8_C(171), UINT8_C(118), UINT8_C(  3), UINT8_C( 41), UINT8_C(225), UINT8_C( 58),
+      UINT8_C(129), UINT8_C( 72), UINT8_C(120), UINT8_C( 79), UINT8_C(217), UINT8_C(210), UINT8_C( 48), UINT8_C(189),
+      UINT8_C(188), UINT8_C(141), UINT8_C(170), UINT8_C(235), UINT8_C(248), UINT8_C( 21), UINT8_C(235), UINT8_C(218),
+      UINT8_C(  0), UINT8_C(131), UINT8_C(115), UINT8_C(246), UINT8_C( 94), UINT8_C(121), UINT8_C(226), UINT8_C( 34),
+      UINT8_C( 67), UINT8_C(141), UINT8_C(152), UINT8_C( 71), UINT8_C(182), UINT8_C(121), UINT8_C(129), UINT8_C( 56),
+      UINT8_C(194), UINT8_C(249), UINT8_C(135), UINT8_C(155), UINT8_C(203), UINT8_C(183), UINT8_C( 88), UINT8_C(135),
+      UINT8_C( 68), UINT8_C(  3), UINT8_C(114), UINT8_C( 60), UINT8_C( 24), UINT8_C( 93), UINT8_C( 22), UINT8_C( 24),
+      UINT8_C(225), UINT8_C(137), UINT8_C( 15), UINT8_C( 63), UINT8_C(  2), UINT8_C(241), UINT8_C( 97), UINT8_C( 70),
+      UINT8_C(126), UINT8_C(250), UINT8_C(141), UINT8_C( 52), UINT8_C(115), UINT8_C( 14), UINT8_C(108), UINT8_C( 53),
+      UINT8_C(  8), UINT8_C(243), UINT8_C(208), UINT8_C(211), UINT8_C(170), UINT8_C( 41), UINT8_C( 91), UINT8_C(238),
+      UINT8_C( 44), UINT8_C(205), UINT8_C( 42), UINT8_C( 68), UINT8_C( 43), UINT8_C( 65), UINT8_C( 92), UINT8_C( 12),
+      UINT8_C(202), UINT8_C(107), UINT8_C( 75), UINT8_C(205), UINT8_C( 92), UINT8_C(173), UINT8_C( 19), UINT8_C(218),
+      UINT8_C(167), UINT8_C(160), UINT8_C( 15), UINT8_C( 26), UINT8_C(174), UINT8_C(123), UINT8_C( 80), UINT8_C(182),
+      UINT8_C(111), UINT8_C( 32), UINT8_C(138), UINT8_C( 25), UINT8_C( 73), UINT8_C(229), UINT8_C(  8), UINT8_C(117),
+      UINT8_C(178), UINT8_C( 50), UINT8_C(185), UINT8_C(221), UINT8_C(115), UINT8_C( 22), UINT8_C(233), UINT8_C( 62),
+      UINT8_C(129), UINT8_C( 53), UINT8_C( 11), UINT8_C(222), UINT8_C(226), UINT8_C( 30), UINT8_C(184), UINT8_C(137),
+      UINT8_C(190), UINT8_C(199), UINT8_C(163), UINT8_C(108), UINT8_C( 67), UINT8_C(243), UINT8_C( 35), UINT8_C(178),
+      UINT8_C( 20), UINT8_C(173), UINT8_C(203), UINT8_C( 93), UINT8_C(146), UINT8_C(211), UINT8_C(211), UINT8_C( 68),
+      UINT8_C(  6), UINT8_C(140), UINT8_C( 34), UINT8_C(121), UINT8_C(162), UINT8_C( 11), UINT8_C(183), UINT8_C( 36),
+      UINT8_C( 64), UINT8_C(194), UINT8_C(  2), UINT8_C( 34), UINT8_C(224), UINT8_C(186), UINT8_C(171), UINT8_C(158),
+      UINT8_C(130), UINT8_C( 79), UINT8_C( 11), UINT8_C(197), UINT8_C( 66), UINT8_C( 46), UINT8_C(119), UINT8_C( 86),
+      UINT8_C(219), UINT8_C( 66), UINT8_C(180), UINT8_C(109), UINT8_C( 22), UINT8_C(135), UINT8_C(177), UINT8_C( 28),
+      UINT8_C( 19), UINT8_C(211), UINT8_C(149), UINT8_C(182), UINT8_C(223), UINT8_C( 77), UINT8_C(218), UINT8_C( 31),
+      UINT8_C( 15), UINT8_C(220), UINT8_C( 66), UINT8_C(240), UINT8_C(150), UINT8_C(237), UINT8_C(142), UINT8_C( 24),
+      UINT8_C( 60), UINT8_C(153), UINT8_C(221), UINT8_C(127), UINT8_C(199), UINT8_C( 84), UINT8_C(213), UINT8_C(162),
+      UINT8_C(151), UINT8_C(137), UINT8_C( 15), UINT8_C(173), UINT8_C( 16), UINT8_C(193), UINT8_C(201), UINT8_C( 36),
+      UINT8_C(148), UINT8_C( 94), UINT8_C(218), UINT8_C(115), UINT8_C(171), UINT8_C(180), UINT8_C(147), UINT8_C(187),
+      UINT8_C(144), UINT8_C(213), UINT8_C(171), UINT8_C( 38), UINT8_C(194), UINT8_C( 57), UINT8_C( 63),    UINT8_MAX,
+      UINT8_C(211), UINT8_C( 28), UINT8_C(126), UINT8_C(154), UINT8_C(113), UINT8_C( 83), UINT8_C( 61), UINT8_C(  8),
+      UINT8_C(221), UINT8_C( 76), UINT8_C(181), UINT8_C(237), UINT8_C( 13), UINT8_C(126), UINT8_C( 17), UINT8_C(162),
+      UINT8_C(220), UINT8_C(235), UINT8_C( 21), UINT8_C(136), UINT8_C(159), UINT8_C(168), UINT8_C( 67), UINT8_C( 47),
+      UINT8_C(125), UINT8_C(238), UINT8_C( 86), UINT8_C( 64), UINT8_C( 39), UINT8_C(149), UINT8_C( 63), UINT8_C(250),
+      UINT8_C(177), UINT8_C(189), UINT8_C(149), UINT8_C( 34), UINT8_C( 16), UINT8_C(210), UINT8_C( 42), UINT8_C(237),
+      UINT8_C( 30), UINT8_C(223), UINT8_C(219), UINT8_C( 44), UINT8_C( 93), UINT8_C(236), UINT8_C(206), UINT8_C( 58),
+      UINT8_C(216), UINT8_C(227), UINT8_C(194), UINT8_C(119), UINT8_C(140), UINT8_C(  5), UINT8_C(167), UINT8_C(  9),
+      UINT8_C(243), UINT8_C(253), UINT8_C( 73), UINT8_C( 26), UINT8_C(146), UINT8_C(136), UINT8_C( 21), UINT8_C( 67),
+      UINT8_C( 69), UINT8_C(170), UINT8_C(102), UINT8_C( 86), UINT8_C(124), UINT8_C(144), UINT8_C( 67), UINT8_C(154),
+      UINT8_C(112), UINT8_C( 30), UINT8_C(198), UINT8_C(205), UINT8_C( 11), UINT8_C(148), UINT8_C(  7), UINT8_C(227),
+      UINT8_C(120), UINT8_C(201), UINT8_C( 90), UINT8_C(  4), UINT8_C(206), UINT8_C(  1), UINT8_C( 13), UINT8_C(193),
+      UINT8_C(254), UINT8_C( 87), UINT8_C(220), UINT8_C(144), UINT8_C(223), UINT8_C(241), UINT8_C(212), UINT8_C( 37),
+      UINT8_C(155), UINT8_C( 58), UINT8_C(123), UINT8_C( 23), UINT8_C(202), UINT8_C(190), UINT8_C(177), UINT8_C( 58),
+      UINT8_C(221), UINT8_C(120), UINT8_C(  8), UINT8_C(232), UINT8_C( 12), UINT8_C( 15), UINT8_C(203), UINT8_C(132),
+      UINT8_C(217), UINT8_C( 37), UINT8_C(136), UINT8_C(167), UINT8_C( 39), UINT8_C(150), UINT8_C(105), UINT8_C( 37),
+      UINT8_C(237), UINT8_C( 69), UINT8_C(182), UINT8_C(204), UINT8_C( 54), UINT8_C(138), UINT8_C(241), UINT8_C(209),
+      UINT8_C(196), UINT8_C(108), UINT8_C(232), UINT8_C(142), UINT8_C( 43), UINT8_C(153), UINT8_C(201), UINT8_C(  8),
+      UINT8_C( 17), UINT8_C(209), UINT8_C(240), UINT8_C( 30), UINT8_C(224), UINT8_C(187), UINT8_C(162), UINT8_C(185),
+      UINT8_C(224), UINT8_C( 43), UINT8_C( 97), UINT8_C(  7), UINT8_C(193), UINT8_C(202), UINT8_C( 45), UINT8_C(174),
+      UINT8_C( 15), UINT8_C(227), UINT8_C(122), UINT8_C( 69), UINT8_C(109), UINT8_C(108), UINT8_C( 22), UINT8_C( 49),
+      UINT8_C(216), UINT8_C(254), UINT8_C(191), UINT8_C(  3), UINT8_C(151), UINT8_C(136), UINT8_C( 11), UINT8_C(169),
+      UINT8_C( 89), UINT8_C(251), UINT8_C(199), UINT8_C( 58), UINT8_C(182), UINT8_C(105), UINT8_C(243), UINT8_C(151),
+      UINT8_C(148), UINT8_C( 84), UINT8_C(158), UINT8_C( 85), UINT8_C( 30), UINT8_C(203), UINT8_C(  3), UINT8_C( 45),
+      UINT8_C(174), UINT8_C(126), UINT8_C(114), UINT8_C( 27), UINT8_C(234), UINT8_C(136), UINT8_C( 76), UINT8_C(194),
+      UINT8_C(134), UINT8_C( 12), UINT8_C(198), UINT8_C( 30), UINT8_C(148), UINT8_C(209), UINT8_C(199), UINT8_C(238),
+      UINT8_C(205), UINT8_C(142), UINT8_C( 40), UINT8_C(131), UINT8_C(247), UINT8_C( 27), UINT8_C( 26), UINT8_C(140),
+      UINT8_C(112), UINT8_C(185), UINT8_C(225), UINT8_C(142), UINT8_C(132), UINT8_C(229), UINT8_C(188), UINT8_C( 51),
+      UINT8_C( 99), UINT8_C( 46), UINT8_C( 78), UINT8_C( 77), UINT8_C(183), UINT8_C(155), UINT8_C( 15), UINT8_C( 61),
+      UINT8_C(167), UINT8_C(213), UINT8_C( 91), UINT8_C( 59), UINT8_C(167), UINT8_C( 34), UINT8_C( 41), UINT8_C(116),
+      UINT8_C(176), UINT8_C( 81), UINT8_C(247), UINT8_C(168), UINT8_C(109), UINT8_C( 18), UINT8_C( 52), UINT8_C(221),
+      UINT8_C(203), UINT8_C( 21), UINT8_C(107), UINT8_C( 79), UINT8_C(250), UINT8_C( 39), UINT8_C(130), UINT8_C( 93),
+      UINT8_C( 86), UINT8_C(209), UINT8_C(170), UINT8_C( 13), UINT8_C(108), UINT8_C(186), UINT8_C( 74), UINT8_C( 19),
+      UINT8_C(143), UINT8_C(166), UINT8_C( 78), UINT8_C( 54), UINT8_C(200), UINT8_C(120), UINT8_C(170), UINT8_C(121),
+      UINT8_C(201), UINT8_C(162), UINT8_C( 33), UINT8_C( 54), UINT8_C(180), UINT8_C( 85), UINT8_C( 19), UINT8_C(127),
+      UINT8_C(106), UINT8_C(127), UINT8_C(206), UINT8_C(101), UINT8_C(166), UINT8_C( 81), UINT8_C(194), UINT8_C(252),
+      UINT8_C( 34), UINT8_C(109), UINT8_C(  9), UINT8_C(142), UINT8_C( 39), UINT8_C( 84), UINT8_C(161), UINT8_C(182),
+      UINT8_C(250), UINT8_C(239), UINT8_C(237), UINT8_C(194), UINT8_C(103), UINT8_C(151), UINT8_C( 59), UINT8_C( 49),
+      UINT8_C( 57), UINT8_C( 92), UINT8_C(103), UINT8_C(237), UINT8_C(177), UINT8_C(123), UINT8_C(108), UINT8_C( 28),
+      UINT8_C(250), UINT8_C( 59), UINT8_C(129), UINT8_C(160), UINT8_C(140), UINT8_C( 67), UINT8_C(157), UINT8_C(174),
+      UINT8_C(176), UINT8_C(166), UINT8_C( 60), UINT8_C(215), UINT8_C(250), UINT8_C(221), UINT8_C(142), UINT8_C(244),
+      UINT8_C(204), UINT8_C(123), UINT8_C(183), UINT8_C( 52), UINT8_C( 18), UINT8_C(242), UINT8_C(101), UINT8_C( 76),
+      UINT8_C( 79), UINT8_C(204), UINT8_C( 57), UINT8_C(  0), UINT8_C( 71), UINT8_C(166), UINT8_C( 28), UINT8_C( 65),
+      UINT8_C(225), UINT8_C(157), UINT8_C(226), UINT8_C(109), UINT8_C(225), UINT8_C(127), UINT8_C( 27), UINT8_C(145),
+      UINT8_C( 37), UINT8_C( 87), UINT8_C(105), UINT8_C( 32), UINT8_C( 52), UINT8_C(247), UINT8_C( 20), UINT8_C(  0),
+      UINT8_C(114), UINT8_C(203), UINT8_C( 52), UINT8_C(132), UINT8_C(190), UINT8_C(153), UINT8_C(208), UINT8_C( 13),
+      UINT8_C(102), UINT8_C( 10), UINT8_C( 13), UINT8_C(173), UINT8_C(176), UINT8_C( 42), UINT8_C(239), UINT8_C(145),
+      UINT8_C(199), UINT8_C(209), UINT8_C(254), UINT8_C(168), UINT8_C( 80), UINT8_C( 25), UINT8_C( 58), UINT8_C(117),
+      UINT8_C(112), UINT8_C(163), UINT8_C(149), UINT8_C(164), UINT8_C(154), UINT8_C(170), UINT8_C(164), UINT8_C( 12),
+      UINT8_C(117), UINT8_C(217), UINT8_C(144), UINT8_C( 51), UINT8_C(114), UINT8_C( 97), UINT8_C( 64), UINT8_C(216),
+      UINT8_C(107), UINT8_C( 78), UINT8_C(134), UINT8_C( 27), UINT8_C(120), UINT8_C(117), UINT8_C(172), UINT8_C( 63),
+      UINT8_C( 70), UINT8_C(170), UINT8_C(232), UINT8_C(150), UINT8_C(195), UINT8_C( 34), UINT8_C( 11), UINT8_C( 51),
+      UINT8_C(197), UINT8_C(161), UINT8_C(215), UINT8_C( 95), UINT8_C( 75), UINT8_C(123), UINT8_C(107), UINT8_C(192),
+      UINT8_C( 84), UINT8_C(251), UINT8_C(244), UINT8_C(199), UINT8_C( 92), UINT8_C( 52), UINT8_C(159), UINT8_C(199),
+      UINT8_C(130), UINT8_C( 37), UINT8_C(226), UINT8_C(250), UINT8_C(154), UINT8_C(142), UINT8_C( 58), UINT8_C(224),
+      UINT8_C( 56), UINT8_C( 34), UINT8_C(118), UINT8_C(251), UINT8_C( 68), UINT8_C(130), UINT8_C( 46), UINT8_C(  9),
+      UINT8_C( 35), UINT8_C(  5), UINT8_C(104), UINT8_C(110), UINT8_C(129), UINT8_C(211), UINT8_C( 46), UINT8_C(213),
+      UINT8_C(206), UINT8_C( 34), UINT8_C(156), UINT8_C( 43), UINT8_C( 87), UINT8_C( 60), UINT8_C(242), UINT8_C(217),
+      UINT8_C( 97), UINT8_C(213), UINT8_C(212), UINT8_C(252), UINT8_C( 99), UINT8_C( 14), UINT8_C(220), UINT8_C(156),
+      UINT8_C( 48), UINT8_C( 83), UINT8_C(151), UINT8_C(116), UINT8_C(213), UINT8_C(198), UINT8_C(125), UINT8_C(248),
+      UINT8_C(203), UINT8_C(229), UINT8_C(102), UINT8_C( 76), UINT8_C(184), UINT8_C(148), UINT8_C( 34), UINT8_C(134),
+      UINT8_C(183), UINT8_C(190), UINT8_C(177), UINT8_C( 14), UINT8_C(250), UINT8_C(164), UINT8_C(231), UINT8_C( 92),
+      UINT8_C(121), UINT8_C(187), UINT8_C( 88), UINT8_C(220), UINT8_C(201), UINT8_C( 52), UINT8_C(120), UINT8_C(249),
+      UINT8_C(135), UINT8_C( 16), UINT8_C(109), UINT8_C( 92), UINT8_C(214), UINT8_C(234), UINT8_C( 84), UINT8_C(161),
+      UINT8_C(207), UINT8_C(186), UINT8_C(238), UINT8_C(135), UINT8_C( 79), UINT8_C( 16), UINT8_C( 14), UINT8_C(  6),
+      UINT8_C(206), UINT8_C(191), UINT8_C( 20), UINT8_C(201), UINT8_C( 99), UINT8_C(251), UINT8_C( 37), UINT8_C(220),
+      UINT8_C(183), UINT8_C(125), UINT8_C(185), UINT8_C(128), UINT8_C(177), UINT8_C( 49), UINT8_C(122), UINT8_C( 57),
+      UINT8_C( 65), UINT8_C(231), UINT8_C(149), UINT8_C( 23), UINT8_C(210), UINT8_C(234), UINT8_C(185), UINT8_C(161),
+      UINT8_C(164), UINT8_C(167), UINT8_C( 41), UINT8_C(243), UINT8_C(183), UINT8_C( 55), UINT8_C(249), UINT8_C(133),
+      UINT8_C(246), UINT8_C( 13), UINT8_C( 78), UINT8_C( 90), UINT8_C(  9), UINT8_C(115), UINT8_C( 54), UINT8_C(192),
+      UINT8_C(240) };
+  static const uint8_t b = UINT8_C( 70);
+  static const uint8_t e[] =
+    { UINT8_C( 22), UINT8_C(  0), UINT8_C( 43), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  3), UINT8_C( 70), UINT8_C( 62), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 41), UINT8_C( 28),
+      UINT8_C( 19), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  8), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 10), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 57), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 47), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  6), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  3), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 21), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 67), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  3), UINT8_C( 70), UINT8_C(  0), UINT8_C( 24), UINT8_C( 70), UINT8_C( 22), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  2), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 14), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 41), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 44), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 65), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 19), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 15), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  8), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 22), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 67), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 20), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 68),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 11), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C( 34), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 11), UINT8_C( 70), UINT8_C(  0), UINT8_C( 46), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 66), UINT8_C( 70), UINT8_C( 70), UINT8_C( 22), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 31),
+      UINT8_C( 15), UINT8_C(  0), UINT8_C( 66), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 60), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 15), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 36),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 57), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 28), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  8),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 17), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 21), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 67), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C( 39), UINT8_C( 70), UINT8_C( 63), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 34), UINT8_C( 16), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 67), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 30), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  7), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 58), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 58),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 12), UINT8_C( 15), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 37), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 37),
+      UINT8_C(  0), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 43), UINT8_C( 70), UINT8_C(  0), UINT8_C(  8),
+      UINT8_C( 17), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  7), UINT8_C(  0), UINT8_C( 70), UINT8_C( 45), UINT8_C( 70),
+      UINT8_C( 15), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 22), UINT8_C( 49),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 30), UINT8_C( 70), UINT8_C(  0), UINT8_C( 45),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 40), UINT8_C(  0), UINT8_C(  0), UINT8_C( 27), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 46), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 59), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 52), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 21), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C( 34), UINT8_C( 70), UINT8_C(  9), UINT8_C( 70), UINT8_C( 39), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 59), UINT8_C( 49),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 28),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 60), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 18), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 28), UINT8_C( 65),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 37), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 52), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 13),
+      UINT8_C(  0), UINT8_C( 10), UINT8_C( 13), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 51), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 11), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 52), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 37), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 56), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 68), UINT8_C(  0), UINT8_C( 46), UINT8_C(  9),
+      UINT8_C( 35), UINT8_C(  5), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 34), UINT8_C(  0), UINT8_C( 43), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 14), UINT8_C( 70), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C( 70), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 14), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 37), UINT8_C(  0),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 57),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C( 70), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C( 55), UINT8_C( 70), UINT8_C( 70),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 70), UINT8_C( 70), UINT8_C(  9), UINT8_C(  0), UINT8_C(  0), UINT8_C( 70),
+      UINT8_C(  0) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_n_u8_z(pv, av, b);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    ev = simde_svmin_n_u8_z(pv, av, b);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(123), UINT8_C(125), UINT8_C( 62), UINT8_C(254), UINT8_C( 72), UINT8_C(249), UINT8_C( 96), UINT8_C(189),
+      UINT8_C( 95), UINT8_C(132), UINT8_C( 72), UINT8_C(141), UINT8_C(181), UINT8_C( 98), UINT8_C(121), UINT8_C(  8),
+      UINT8_C(149), UINT8_C( 79), UINT8_C(195), UINT8_C( 83), UINT8_C(245), UINT8_C(102), UINT8_C( 23), UINT8_C(175),
+      UINT8_C(161), UINT8_C(167), UINT8_C(192), UINT8_C(165), UINT8_C( 42), UINT8_C( 34), UINT8_C(130), UINT8_C(166),
+      UINT8_C(159), UINT8_C(192), UINT8_C(164), UINT8_C(231), UINT8_C(186), UINT8_C(  5), UINT8_C(164), UINT8_C( 25),
+      UINT8_C(137), UINT8_C(236), UINT8_C(166), UINT8_C( 63), UINT8_C( 79), UINT8_C( 31), UINT8_C( 71), UINT8_C(228),
+      UINT8_C(110), UINT8_C( 10), UINT8_C( 56), UINT8_C( 99), UINT8_C(112), UINT8_C( 79), UINT8_C( 19), UINT8_C( 18),
+      UINT8_C(246), UINT8_C(211), UINT8_C(183), UINT8_C( 32), UINT8_C(245), UINT8_C( 58), UINT8_C(198), UINT8_C(149),
+      UINT8_C(250), UINT8_C(107), UINT8_C(124), UINT8_C(180), UINT8_C(112), UINT8_C( 33), UINT8_C(205), UINT8_C(249),
+      UINT8_C( 13), UINT8_C(115), UINT8_C( 56), UINT8_C( 92), UINT8_C(147), UINT8_C(128), UINT8_C( 65), UINT8_C(  1),
+      UINT8_C(138), UINT8_C(121), UINT8_C(101), UINT8_C(251), UINT8_C(200), UINT8_C(120), UINT8_C( 13), UINT8_C(190),
+      UINT8_C( 75), UINT8_C(196), UINT8_C(222), UINT8_C( 64), UINT8_C(254), UINT8_C(165), UINT8_C(213), UINT8_C(249),
+      UINT8_C( 16), UINT8_C( 82), UINT8_C(173), UINT8_C(128), UINT8_C(115), UINT8_C(123), UINT8_C(121), UINT8_C(128),
+      UINT8_C(238), UINT8_C(178), UINT8_C(221), UINT8_C(129), UINT8_C( 50), UINT8_C( 30), UINT8_C(131), UINT8_C(188),
+      UINT8_C(151), UINT8_C(232), UINT8_C(183), UINT8_C( 95), UINT8_C( 96), UINT8_C(196), UINT8_C( 29), UINT8_C(171),
+      UINT8_C(137), UINT8_C(251), UINT8_C(235), UINT8_C(135), UINT8_C(160), UINT8_C(193), UINT8_C(128), UINT8_C(176),
+      UINT8_C( 19), UINT8_C( 46), UINT8_C( 48), UINT8_C(134), UINT8_C(169), UINT8_C(170), UINT8_C(  6), UINT8_C(151),
+      UINT8_C( 92), UINT8_C(227), UINT8_C( 25), UINT8_C(142), UINT8_C(  1), UINT8_C(156), UINT8_C( 74), UINT8_C(152),
+      UINT8_C(132), UINT8_C(  2), UINT8_C(247), UINT8_C(228), UINT8_C(198), UINT8_C( 20), UINT8_C(143), UINT8_C( 79),
+      UINT8_C( 16), UINT8_C(122), UINT8_C(215), UINT8_C(176), UINT8_C( 59), UINT8_C( 87), UINT8_C( 97), UINT8_C( 78),
+      UINT8_C(133), UINT8_C(145), UINT8_C(212), UINT8_C( 46), UINT8_C( 59), UINT8_C(219), UINT8_C(198), UINT8_C(151),
+      UINT8_C(190), UINT8_C(223), UINT8_C( 37), UINT8_C(192), UINT8_C(123), UINT8_C(112), UINT8_C( 88),    UINT8_MAX,
+      UINT8_C(114), UINT8_C( 80), UINT8_C(227), UINT8_C( 56), UINT8_C(100), UINT8_C(114), UINT8_C(136), UINT8_C(116),
+      UINT8_C(236), UINT8_C( 95), UINT8_C( 37), UINT8_C( 40), UINT8_C(182), UINT8_C(134), UINT8_C(118), UINT8_C( 60),
+      UINT8_C( 23), UINT8_C( 75), UINT8_C(106), UINT8_C( 83), UINT8_C( 38), UINT8_C( 48), UINT8_C(234), UINT8_C(228),
+      UINT8_C( 15), UINT8_C( 16), UINT8_C(164), UINT8_C(138), UINT8_C(128), UINT8_C(253), UINT8_C(137), UINT8_C(242),
+      UINT8_C( 77), UINT8_C(108), UINT8_C( 42), UINT8_C(177), UINT8_C(222), UINT8_C(178), UINT8_C( 38), UINT8_C(203),
+      UINT8_C( 17), UINT8_C( 75), UINT8_C(243), UINT8_C(200), UINT8_C(209), UINT8_C(105), UINT8_C(  4), UINT8_C(232),
+      UINT8_C(180), UINT8_C(110), UINT8_C( 59), UINT8_C(218), UINT8_C(159), UINT8_C( 38), UINT8_C(191), UINT8_C(174),
+      UINT8_C( 54), UINT8_C( 99), UINT8_C( 57), UINT8_C(182), UINT8_C( 96), UINT8_C(194), UINT8_C(168), UINT8_C(173),
+      UINT8_C( 47), UINT8_C(210), UINT8_C( 95), UINT8_C( 13), UINT8_C(133), UINT8_C(133), UINT8_C(216), UINT8_C(150),
+      UINT8_C(208), UINT8_C(203), UINT8_C( 94), UINT8_C(161), UINT8_C( 53), UINT8_C( 98), UINT8_C(137), UINT8_C(233),
+      UINT8_C(209), UINT8_C(197), UINT8_C(196), UINT8_C(112), UINT8_C(235), UINT8_C(131), UINT8_C( 30), UINT8_C( 33),
+      UINT8_C(230), UINT8_C( 87), UINT8_C(215), UINT8_C( 71), UINT8_C( 26), UINT8_C(127), UINT8_C(244), UINT8_C( 73),
+      UINT8_C( 81), UINT8_C( 83), UINT8_C( 86), UINT8_C(214), UINT8_C(216), UINT8_C( 47), UINT8_C(109), UINT8_C(168),
+      UINT8_C(250), UINT8_C(203), UINT8_C( 73), UINT8_C( 47), UINT8_C( 46), UINT8_C(211), UINT8_C( 25),    UINT8_MAX,
+      UINT8_C(152), UINT8_C(221), UINT8_C(111), UINT8_C(131), UINT8_C( 96), UINT8_C(141), UINT8_C(164), UINT8_C( 70),
+      UINT8_C(229), UINT8_C(123), UINT8_C(141),    UINT8_MAX, UINT8_C(250), UINT8_C(130), UINT8_C( 72), UINT8_C( 75),
+      UINT8_C(213), UINT8_C(158), UINT8_C( 34), UINT8_C(174), UINT8_C(205), UINT8_C(143), UINT8_C( 86), UINT8_C(200),
+      UINT8_C( 90), UINT8_C(160), UINT8_C(247), UINT8_C(136), UINT8_C(115), UINT8_C( 16), UINT8_C(135), UINT8_C( 11),
+      UINT8_C(237), UINT8_C(246), UINT8_C(142), UINT8_C( 77), UINT8_C(132), UINT8_C( 50), UINT8_C(148), UINT8_C(105),
+      UINT8_C(173), UINT8_C( 33), UINT8_C(104), UINT8_C(167), UINT8_C(163), UINT8_C(176), UINT8_C(242), UINT8_C(121),
+      UINT8_C( 78), UINT8_C( 20), UINT8_C( 39), UINT8_C( 28), UINT8_C(163), UINT8_C(125), UINT8_C(228), UINT8_C(254),
+      UINT8_C( 29), UINT8_C(219), UINT8_C(134), UINT8_C(144), UINT8_C(236), UINT8_C( 14), UINT8_C(155), UINT8_C(217),
+      UINT8_C(  4), UINT8_C( 41), UINT8_C( 39), UINT8_C(136), UINT8_C( 91), UINT8_C(187), UINT8_C(241), UINT8_C(  8),
+      UINT8_C(220), UINT8_C( 89), UINT8_C(175), UINT8_C(128), UINT8_C(  9), UINT8_C(162), UINT8_C(249), UINT8_C( 88),
+      UINT8_C(182), UINT8_C( 32), UINT8_C(116), UINT8_C( 90), UINT8_C(157), UINT8_C( 88), UINT8_C( 88), UINT8_C(187),
+      UINT8_C( 51), UINT8_C(222), UINT8_C( 75), UINT8_C( 31), UINT8_C(236), UINT8_C(231), UINT8_C(249), UINT8_C(241),
+      UINT8_C( 16), UINT8_C( 32), UINT8_C(121), UINT8_C(108), UINT8_C(219), UINT8_C(107), UINT8_C(116), UINT8_C(183),
+      UINT8_C(196), UINT8_C( 36), UINT8_C( 55), UINT8_C(206), UINT8_C(198), UINT8_C( 48), UINT8_C( 38), UINT8_C(124),
+      UINT8_C( 80), UINT8_C(154), UINT8_C(214), UINT8_C(238), UINT8_C(242), UINT8_C( 46), UINT8_C(169), UINT8_C( 37),
+      UINT8_C( 13), UINT8_C(244), UINT8_C( 69), UINT8_C(249), UINT8_C(219), UINT8_C( 62), UINT8_C(234), UINT8_C(236),
+      UINT8_C( 94), UINT8_C(100), UINT8_C( 88), UINT8_C( 57), UINT8_C(207), UINT8_C(204), UINT8_C(240), UINT8_C(147),
+      UINT8_C(240), UINT8_C( 40), UINT8_C( 97), UINT8_C(182), UINT8_C( 88), UINT8_C(135), UINT8_C( 51), UINT8_C(169),
+      UINT8_C( 33), UINT8_C(  9), UINT8_C(151), UINT8_C( 19), UINT8_C( 56), UINT8_C( 64), UINT8_C( 57), UINT8_C( 69),
+      UINT8_C( 52), UINT8_C(126), UINT8_C( 62), UINT8_C( 16), UINT8_C(188), UINT8_C( 41), UINT8_C(252), UINT8_C( 26),
+      UINT8_C(141), UINT8_C( 84), UINT8_C( 83), UINT8_C( 92), UINT8_C( 32), UINT8_C( 67), UINT8_C(239), UINT8_C( 17),
+      UINT8_C(107), UINT8_C( 81), UINT8_C(199), UINT8_C(196), UINT8_C(216), UINT8_C(250), UINT8_C(109), UINT8_C(250),
+      UINT8_C(  4), UINT8_C(  4), UINT8_C( 13), UINT8_C( 60), UINT8_C( 68), UINT8_C( 70), UINT8_C(129), UINT8_C(120),
+      UINT8_C(196), UINT8_C(191), UINT8_C(136), UINT8_C(128), UINT8_C(232), UINT8_C(132), UINT8_C(154), UINT8_C(117),
+      UINT8_C(216), UINT8_C(237), UINT8_C(209), UINT8_C(249), UINT8_C( 49), UINT8_C(193), UINT8_C( 10), UINT8_C(156),
+      UINT8_C( 18), UINT8_C(209), UINT8_C( 96), UINT8_C(234), UINT8_C(204), UINT8_C(205), UINT8_C(228), UINT8_C(208),
+      UINT8_C(209), UINT8_C(242), UINT8_C( 12), UINT8_C( 21), UINT8_C( 56), UINT8_C(141), UINT8_C(142), UINT8_C(253),
+      UINT8_C( 76), UINT8_C( 22), UINT8_C(125), UINT8_C( 53), UINT8_C(155), UINT8_C( 24), UINT8_C(170), UINT8_C(115),
+      UINT8_C(  5), UINT8_C(124), UINT8_C(108), UINT8_C( 54), UINT8_C( 61), UINT8_C(118), UINT8_C(211), UINT8_C( 79),
+      UINT8_C( 72), UINT8_C( 51), UINT8_C( 57), UINT8_C( 20), UINT8_C(  1), UINT8_C( 30), UINT8_C(228), UINT8_C(210),
+      UINT8_C( 16), UINT8_C(240), UINT8_C(232), UINT8_C( 72), UINT8_C(125), UINT8_C(118), UINT8_C( 69), UINT8_C(201),
+      UINT8_C(140), UINT8_C(195), UINT8_C(254), UINT8_C( 39), UINT8_C(219), UINT8_C(169), UINT8_C(155), UINT8_C(224),
+      UINT8_C( 37), UINT8_C(  7), UINT8_C( 23), UINT8_C( 98), UINT8_C(126), UINT8_C(234), UINT8_C(177), UINT8_C(198),
+      UINT8_C( 29), UINT8_C(234), UINT8_C(218), UINT8_C( 30), UINT8_C(  8), UINT8_C(190), UINT8_C(241), UINT8_C( 24),
+      UINT8_C(174), UINT8_C(217), UINT8_C( 97), UINT8_C( 43), UINT8_C( 79), UINT8_C(166), UINT8_C(244), UINT8_C(219),
+      UINT8_C(105) };
+  static const uint8_t b = UINT8_C(152);
+  static const uint8_t e[] =
+    { UINT8_C(123), UINT8_C(125), UINT8_C( 62), UINT8_C(254), UINT8_C( 72), UINT8_C(249), UINT8_C( 96), UINT8_C(152),
+      UINT8_C( 95), UINT8_C(132), UINT8_C( 72), UINT8_C(141), UINT8_C(181), UINT8_C( 98), UINT8_C(121), UINT8_C(  8),
+      UINT8_C(149), UINT8_C( 79), UINT8_C(152), UINT8_C( 83), UINT8_C(245), UINT8_C(102), UINT8_C( 23), UINT8_C(175),
+      UINT8_C(161), UINT8_C(152), UINT8_C(192), UINT8_C(152), UINT8_C( 42), UINT8_C( 34), UINT8_C(130), UINT8_C(152),
+      UINT8_C(152), UINT8_C(192), UINT8_C(152), UINT8_C(231), UINT8_C(152), UINT8_C(  5), UINT8_C(164), UINT8_C( 25),
+      UINT8_C(137), UINT8_C(236), UINT8_C(166), UINT8_C( 63), UINT8_C( 79), UINT8_C( 31), UINT8_C( 71), UINT8_C(152),
+      UINT8_C(110), UINT8_C( 10), UINT8_C( 56), UINT8_C( 99), UINT8_C(112), UINT8_C( 79), UINT8_C( 19), UINT8_C( 18),
+      UINT8_C(152), UINT8_C(211), UINT8_C(152), UINT8_C( 32), UINT8_C(152), UINT8_C( 58), UINT8_C(198), UINT8_C(149),
+      UINT8_C(250), UINT8_C(107), UINT8_C(124), UINT8_C(180), UINT8_C(112), UINT8_C( 33), UINT8_C(152), UINT8_C(249),
+      UINT8_C( 13), UINT8_C(115), UINT8_C( 56), UINT8_C( 92), UINT8_C(147), UINT8_C(128), UINT8_C( 65), UINT8_C(  1),
+      UINT8_C(138), UINT8_C(121), UINT8_C(101), UINT8_C(152), UINT8_C(200), UINT8_C(120), UINT8_C( 13), UINT8_C(190),
+      UINT8_C( 75), UINT8_C(196), UINT8_C(152), UINT8_C( 64), UINT8_C(254), UINT8_C(152), UINT8_C(152), UINT8_C(152),
+      UINT8_C( 16), UINT8_C( 82), UINT8_C(173), UINT8_C(128), UINT8_C(115), UINT8_C(123), UINT8_C(121), UINT8_C(128),
+      UINT8_C(238), UINT8_C(152), UINT8_C(152), UINT8_C(129), UINT8_C( 50), UINT8_C( 30), UINT8_C(131), UINT8_C(152),
+      UINT8_C(151), UINT8_C(232), UINT8_C(152), UINT8_C( 95), UINT8_C( 96), UINT8_C(196), UINT8_C( 29), UINT8_C(152),
+      UINT8_C(137), UINT8_C(152), UINT8_C(235), UINT8_C(135), UINT8_C(152), UINT8_C(152), UINT8_C(128), UINT8_C(152),
+      UINT8_C( 19), UINT8_C( 46), UINT8_C( 48), UINT8_C(134), UINT8_C(169), UINT8_C(152), UINT8_C(  6), UINT8_C(151),
+      UINT8_C( 92), UINT8_C(152), UINT8_C( 25), UINT8_C(142), UINT8_C(  1), UINT8_C(152), UINT8_C( 74), UINT8_C(152),
+      UINT8_C(132), UINT8_C(  2), UINT8_C(247), UINT8_C(228), UINT8_C(152), UINT8_C( 20), UINT8_C(143), UINT8_C( 79),
+      UINT8_C( 16), UINT8_C(122), UINT8_C(215), UINT8_C(176), UINT8_C( 59), UINT8_C( 87), UINT8_C( 97), UINT8_C( 78),
+      UINT8_C(133), UINT8_C(145), UINT8_C(152), UINT8_C( 46), UINT8_C( 59), UINT8_C(219), UINT8_C(198), UINT8_C(151),
+      UINT8_C(190), UINT8_C(223), UINT8_C( 37), UINT8_C(152), UINT8_C(123), UINT8_C(112), UINT8_C( 88),    UINT8_MAX,
+      UINT8_C(114), UINT8_C( 80), UINT8_C(152), UINT8_C( 56), UINT8_C(100), UINT8_C(114), UINT8_C(136), UINT8_C(116),
+      UINT8_C(152), UINT8_C( 95), UINT8_C( 37), UINT8_C( 40), UINT8_C(182), UINT8_C(134), UINT8_C(118), UINT8_C( 60),
+      UINT8_C( 23), UINT8_C( 75), UINT8_C(106), UINT8_C( 83), UINT8_C( 38), UINT8_C( 48), UINT8_C(234), UINT8_C(152),
+      UINT8_C( 15), UINT8_C( 16), UINT8_C(152), UINT8_C(138), UINT8_C(128), UINT8_C(152), UINT8_C(137), UINT8_C(152),
+      UINT8_C( 77), UINT8_C(108), UINT8_C( 42), UINT8_C(177), UINT8_C(152), UINT8_C(178), UINT8_C( 38), UINT8_C(152),
+      UINT8_C( 17), UINT8_C( 75), UINT8_C(152), UINT8_C(152), UINT8_C(209), UINT8_C(105), UINT8_C(  4), UINT8_C(232),
+      UINT8_C(180), UINT8_C(110), UINT8_C( 59), UINT8_C(218), UINT8_C(159), UINT8_C( 38), UINT8_C(191), UINT8_C(152),
+      UINT8_C( 54), UINT8_C( 99), UINT8_C( 57), UINT8_C(152), UINT8_C( 96), UINT8_C(152), UINT8_C(168), UINT8_C(173),
+      UINT8_C( 47), UINT8_C(152), UINT8_C( 95), UINT8_C( 13), UINT8_C(133), UINT8_C(133), UINT8_C(152), UINT8_C(150),
+      UINT8_C(152), UINT8_C(152), UINT8_C( 94), UINT8_C(152), UINT8_C( 53), UINT8_C( 98), UINT8_C(137), UINT8_C(152),
+      UINT8_C(152), UINT8_C(152), UINT8_C(196), UINT8_C(112), UINT8_C(235), UINT8_C(131), UINT8_C( 30), UINT8_C( 33),
+      UINT8_C(152), UINT8_C( 87), UINT8_C(215), UINT8_C( 71), UINT8_C( 26), UINT8_C(127), UINT8_C(152), UINT8_C( 73),
+      UINT8_C( 81), UINT8_C( 83), UINT8_C( 86), UINT8_C(214), UINT8_C(216), UINT8_C( 47), UINT8_C(109), UINT8_C(152),
+      UINT8_C(152), UINT8_C(152), UINT8_C( 73), UINT8_C( 47), UINT8_C( 46), UINT8_C(152), UINT8_C( 25),    UINT8_MAX,
+      UINT8_C(152), UINT8_C(221), UINT8_C(111), UINT8_C(131), UINT8_C( 96), UINT8_C(141), UINT8_C(152), UINT8_C( 70),
+      UINT8_C(229), UINT8_C(123), UINT8_C(141),    UINT8_MAX, UINT8_C(152), UINT8_C(130), UINT8_C( 72), UINT8_C( 75),
+      UINT8_C(152), UINT8_C(158), UINT8_C( 34), UINT8_C(174), UINT8_C(205), UINT8_C(143), UINT8_C( 86), UINT8_C(152),
+      UINT8_C( 90), UINT8_C(160), UINT8_C(247), UINT8_C(136), UINT8_C(115), UINT8_C( 16), UINT8_C(135), UINT8_C( 11),
+      UINT8_C(237), UINT8_C(152), UINT8_C(142), UINT8_C( 77), UINT8_C(132), UINT8_C( 50), UINT8_C(148), UINT8_C(105),
+      UINT8_C(173), UINT8_C( 33), UINT8_C(104), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(121),
+      UINT8_C( 78), UINT8_C( 20), UINT8_C( 39), UINT8_C( 28), UINT8_C(163), UINT8_C(125), UINT8_C(152), UINT8_C(152),
+      UINT8_C( 29), UINT8_C(219), UINT8_C(134), UINT8_C(144), UINT8_C(236), UINT8_C( 14), UINT8_C(152), UINT8_C(217),
+      UINT8_C(  4), UINT8_C( 41), UINT8_C( 39), UINT8_C(136), UINT8_C( 91), UINT8_C(187), UINT8_C(152), UINT8_C(  8),
+      UINT8_C(152), UINT8_C( 89), UINT8_C(175), UINT8_C(128), UINT8_C(  9), UINT8_C(162), UINT8_C(249), UINT8_C( 88),
+      UINT8_C(182), UINT8_C( 32), UINT8_C(116), UINT8_C( 90), UINT8_C(152), UINT8_C( 88), UINT8_C( 88), UINT8_C(152),
+      UINT8_C( 51), UINT8_C(152), UINT8_C( 75), UINT8_C( 31), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152),
+      UINT8_C( 16), UINT8_C( 32), UINT8_C(121), UINT8_C(108), UINT8_C(219), UINT8_C(107), UINT8_C(116), UINT8_C(183),
+      UINT8_C(196), UINT8_C( 36), UINT8_C( 55), UINT8_C(152), UINT8_C(198), UINT8_C( 48), UINT8_C( 38), UINT8_C(124),
+      UINT8_C( 80), UINT8_C(154), UINT8_C(214), UINT8_C(238), UINT8_C(242), UINT8_C( 46), UINT8_C(152), UINT8_C( 37),
+      UINT8_C( 13), UINT8_C(244), UINT8_C( 69), UINT8_C(249), UINT8_C(219), UINT8_C( 62), UINT8_C(234), UINT8_C(236),
+      UINT8_C( 94), UINT8_C(100), UINT8_C( 88), UINT8_C( 57), UINT8_C(207), UINT8_C(204), UINT8_C(240), UINT8_C(147),
+      UINT8_C(240), UINT8_C( 40), UINT8_C( 97), UINT8_C(182), UINT8_C( 88), UINT8_C(135), UINT8_C( 51), UINT8_C(152),
+      UINT8_C( 33), UINT8_C(  9), UINT8_C(151), UINT8_C( 19), UINT8_C( 56), UINT8_C( 64), UINT8_C( 57), UINT8_C( 69),
+      UINT8_C( 52), UINT8_C(126), UINT8_C( 62), UINT8_C( 16), UINT8_C(188), UINT8_C( 41), UINT8_C(152), UINT8_C( 26),
+      UINT8_C(141), UINT8_C( 84), UINT8_C( 83), UINT8_C( 92), UINT8_C( 32), UINT8_C( 67), UINT8_C(152), UINT8_C( 17),
+      UINT8_C(107), UINT8_C( 81), UINT8_C(199), UINT8_C(152), UINT8_C(152), UINT8_C(250), UINT8_C(109), UINT8_C(152),
+      UINT8_C(  4), UINT8_C(  4), UINT8_C( 13), UINT8_C( 60), UINT8_C( 68), UINT8_C( 70), UINT8_C(129), UINT8_C(120),
+      UINT8_C(152), UINT8_C(191), UINT8_C(136), UINT8_C(128), UINT8_C(232), UINT8_C(132), UINT8_C(154), UINT8_C(117),
+      UINT8_C(216), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C( 49), UINT8_C(193), UINT8_C( 10), UINT8_C(152),
+      UINT8_C( 18), UINT8_C(209), UINT8_C( 96), UINT8_C(234), UINT8_C(204), UINT8_C(152), UINT8_C(228), UINT8_C(152),
+      UINT8_C(209), UINT8_C(152), UINT8_C( 12), UINT8_C( 21), UINT8_C( 56), UINT8_C(141), UINT8_C(142), UINT8_C(152),
+      UINT8_C( 76), UINT8_C( 22), UINT8_C(125), UINT8_C( 53), UINT8_C(155), UINT8_C( 24), UINT8_C(152), UINT8_C(115),
+      UINT8_C(  5), UINT8_C(124), UINT8_C(108), UINT8_C( 54), UINT8_C( 61), UINT8_C(118), UINT8_C(152), UINT8_C( 79),
+      UINT8_C( 72), UINT8_C( 51), UINT8_C( 57), UINT8_C( 20), UINT8_C(  1), UINT8_C( 30), UINT8_C(152), UINT8_C(210),
+      UINT8_C( 16), UINT8_C(152), UINT8_C(232), UINT8_C( 72), UINT8_C(125), UINT8_C(118), UINT8_C( 69), UINT8_C(152),
+      UINT8_C(140), UINT8_C(195), UINT8_C(152), UINT8_C( 39), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(224),
+      UINT8_C( 37), UINT8_C(  7), UINT8_C( 23), UINT8_C( 98), UINT8_C(126), UINT8_C(152), UINT8_C(177), UINT8_C(198),
+      UINT8_C( 29), UINT8_C(152), UINT8_C(152), UINT8_C( 30), UINT8_C(  8), UINT8_C(152), UINT8_C(152), UINT8_C( 24),
+      UINT8_C(152), UINT8_C(152), UINT8_C( 97), UINT8_C( 43), UINT8_C( 79), UINT8_C(152), UINT8_C(152), UINT8_C(219),
+      UINT8_C(105) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmin_n_u8_m(pv, av, b);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    ev = simde_svmin_n_u8_m(pv, av, b);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(24821), UINT16_C(12720), UINT16_C(11214), UINT16_C(24026), UINT16_C(25181), UINT16_C(52433), UINT16_C(24019), UINT16_C(58971),
+      UINT16_C(61817), UINT16_C(63576), UINT16_C(41839), UINT16_C(19966), UINT16_C(19617), UINT16_C(26860), UINT16_C(44296), UINT16_C(64833),
+      UINT16_C(61709), UINT16_C(56110), UINT16_C( 2332), UINT16_C(31288), UINT16_C( 2411), UINT16_C(15942), UINT16_C(41318), UINT16_C(57380),
+      UINT16_C(32146), UINT16_C(  472), UINT16_C(54816), UINT16_C(49486), UINT16_C(15138), UINT16_C(10794), UINT16_C(27624), UINT16_C(62760),
+      UINT16_C(22109), UINT16_C(31184), UINT16_C( 2143), UINT16_C(52211), UINT16_C(14865), UINT16_C(30473), UINT16_C(11995), UINT16_C(28247),
+      UINT16_C(12203), UINT16_C(52079), UINT16_C(48646), UINT16_C(10380), UINT16_C(46841), UINT16_C(57683), UINT16_C(31522), UINT16_C(32726),
+      UINT16_C(42705), UINT16_C(12792), UINT16_C(60590), UINT16_C(49148), UINT16_C( 1318), UINT16_C(  310), UINT16_C(36403), UINT16_C(56943),
+      UINT16_C(57277), UINT16_C(50089), UINT16_C(13981), UINT16_C(38636), UINT16_C(16364), UINT16_C( 3703), UINT16_C(19898), UINT16_C(35725),
+      UINT16_C(34547), UINT16_C(41404), UINT16_C(47218), UINT16_C(39008), UINT16_C(38590), UINT16_C(61849), UINT16_C( 2340), UINT16_C(58064),
+      UINT16_C(31208), UINT16_C(34213), UINT16_C(37295), UINT16_C(39963), UINT16_C(37584), UINT16_C(35498), UINT16_C(14559), UINT16_C(53782),
+      UINT16_C(53950), UINT16_C(12403), UINT16_C(54155), UINT16_C(18888), UINT16_C(24937), UINT16_C(36410), UINT16_C( 2666), UINT16_C(21104),
+      UINT16_C( 5508), UINT16_C(13271), UINT16_C(62119), UINT16_C(30671), UINT16_C(31364), UINT16_C(25346), UINT16_C( 6322), UINT16_C(28725),
+      UINT16_C(43242), UINT16_C(30112), UINT16_C(26747), UINT16_C(58814), UINT16_C(63945), UINT16_C(13427), UINT16_C(58115), UINT16_C(34694),
+      UINT16_C(24312), UINT16_C(40891), UINT16_C(35408), UINT16_C(54551), UINT16_C( 6404), UINT16_C(46648), UINT16_C(28209), UINT16_C( 6950),
+      UINT16_C(50710), UINT16_C(37521), UINT16_C(20270), UINT16_C(63607), UINT16_C(59976), UINT16_C(19500), UINT16_C(45773), UINT16_C(50643),
+      UINT16_C(36368), UINT16_C(24933), UINT16_C(31769), UINT16_C( 7478), UINT16_C(28309), UINT16_C(50900), UINT16_C(64220), UINT16_C(62433),
+      UINT16_C(29377), UINT16_C(61317), UINT16_C(64706), UINT16_C( 2791), UINT16_C( 5094), UINT16_C(45910), UINT16_C(10950), UINT16_C(54904),
+      UINT16_C(56760), UINT16_C(53559), UINT16_C(27993), UINT16_C(61167), UINT16_C(50140), UINT16_C(47284), UINT16_C(38589), UINT16_C(32427),
+      UINT16_C(12296), UINT16_C(51822), UINT16_C(21804), UINT16_C( 4821), UINT16_C(11113), UINT16_C(12229), UINT16_C(15957), UINT16_C( 3589),
+      UINT16_C(15643), UINT16_C(30175), UINT16_C(52906), UINT16_C(34403), UINT16_C( 6289), UINT16_C(20287), UINT16_C(60078), UINT16_C(46797),
+      UINT16_C(15131), UINT16_C(18305), UINT16_C(22161), UINT16_C(64090), UINT16_C( 8065), UINT16_C(55081), UINT16_C(11869), UINT16_C(31205),
+      UINT16_C(50283), UINT16_C( 5870), UINT16_C(20883), UINT16_C( 9372), UINT16_C(56169), UINT16_C( 6003), UINT16_C(16838), UINT16_C(57806),
+      UINT16_C(20348), UINT16_C( 3368), UINT16_C(33445), UINT16_C( 9735), UINT16_C(12450), UINT16_C(65533), UINT16_C(57951), UINT16_C(51832),
+      UINT16_C(26279), UINT16_C(15072), UINT16_C(32184), UINT16_C( 8542), UINT16_C(53848), UINT16_C( 7737), UINT16_C( 1811), UINT16_C(36863),
+      UINT16_C(10326), UINT16_C(64413), UINT16_C(42154), UINT16_C(19489), UINT16_C( 8149), UINT16_C(13388), UINT16_C(50177), UINT16_C(43262),
+      UINT16_C(57131), UINT16_C(58338), UINT16_C(16732), UINT16_C(46084), UINT16_C(15635), UINT16_C( 9939), UINT16_C(53828), UINT16_C(39605),
+      UINT16_C(21242), UINT16_C(42389), UINT16_C(47095), UINT16_C(52465), UINT16_C(15830), UINT16_C(55040), UINT16_C(65026), UINT16_C(11648),
+      UINT16_C(25309), UINT16_C(14608), UINT16_C( 5283), UINT16_C(46830), UINT16_C(49490), UINT16_C(38620), UINT16_C(37523), UINT16_C(36401),
+      UINT16_C(50916), UINT16_C(56115), UINT16_C( 9341), UINT16_C(21415), UINT16_C(42850), UINT16_C(25643), UINT16_C(43942), UINT16_C(33681),
+      UINT16_C(41229), UINT16_C(45501), UINT16_C(43957), UINT16_C( 1895), UINT16_C(17516), UINT16_C(65438), UINT16_C(53206), UINT16_C(47757),
+      UINT16_C(49301), UINT16_C( 5014), UINT16_C(15845), UINT16_C(18278), UINT16_C(37349), UINT16_C(35755), UINT16_C(15420), UINT16_C(18958),
+      UINT16_C(52189), UINT16_C(37627), UINT16_C(25206), UINT16_C(58010), UINT16_C(14502), UINT16_C(31970), UINT16_C(28423), UINT16_C(39991),
+      UINT16_C(52528), UINT16_C( 5551), UINT16_C( 5642), UINT16_C(61276), UINT16_C( 1959), UINT16_C(58490), UINT16_C(35139), UINT16_C( 8238),
+      UINT16_C(10580), UINT16_C(52146), UINT16_C(19595), UINT16_C(12973), UINT16_C(36740), UINT16_C(35758), UINT16_C(58879), UINT16_C(12072),
+      UINT16_C(55218), UINT16_C(48452), UINT16_C(41197), UINT16_C(38316), UINT16_C(10151), UINT16_C(60025), UINT16_C(42928), UINT16_C( 1034),
+      UINT16_C(48336), UINT16_C(23503), UINT16_C(32009), UINT16_C(36237), UINT16_C(15372), UINT16_C( 2841), UINT16_C(16673), UINT16_C(54330),
+      UINT16_C(32280), UINT16_C( 1681), UINT16_C(15646), UINT16_C(50587), UINT16_C( 5220), UINT16_C( 5295), UINT16_C(47547), UINT16_C(35609),
+      UINT16_C(59510), UINT16_C(32742), UINT16_C(29797), UINT16_C(29196), UINT16_C( 9648), UINT16_C(53629), UINT16_C(47206), UINT16_C(32677),
+      UINT16_C(13878), UINT16_C(21893), UINT16_C( 8308), UINT16_C(55322), UINT16_C(51764), UINT16_C(61421), UINT16_C( 1667), UINT16_C(63866),
+      UINT16_C(24814), UINT16_C(21624), UINT16_C(34260), UINT16_C(33990), UINT16_C(17322), UINT16_C( 4438), UINT16_C(64507), UINT16_C(12944),
+      UINT16_C( 5426), UINT16_C(42631), UINT16_C(41269), UINT16_C(27006), UINT16_C(27499), UINT16_C(61272), UINT16_C(53873), UINT16_C(24808),
+      UINT16_C(24882), UINT16_C( 1972), UINT16_C(31462), UINT16_C(37003), UINT16_C(57789), UINT16_C(47521), UINT16_C(12765), UINT16_C( 4075),
+      UINT16_C(29254), UINT16_C(31669), UINT16_C(13075), UINT16_C(32740), UINT16_C(15519), UINT16_C( 4206), UINT16_C(22030), UINT16_C(16752),
+      UINT16_C( 9399), UINT16_C(40264), UINT16_C(54174), UINT16_C(23598), UINT16_C(53173), UINT16_C(37397), UINT16_C(    1), UINT16_C(18337),
+      UINT16_C(22130), UINT16_C(34243), UINT16_C(42889), UINT16_C(10244), UINT16_C(29412), UINT16_C(62009), UINT16_C(43465), UINT16_C(32819),
+      UINT16_C(31694), UINT16_C(27678), UINT16_C(19535), UINT16_C( 1224), UINT16_C(56603), UINT16_C( 7318), UINT16_C(14301), UINT16_C(20324),
+      UINT16_C(10125), UINT16_C( 5845), UINT16_C(55758), UINT16_C(45631), UINT16_C(30796), UINT16_C( 5541), UINT16_C(55329), UINT16_C(61333),
+      UINT16_C(45908), UINT16_C(41820), UINT16_C( 9471), UINT16_C( 7079), UINT16_C(15618), UINT16_C(57143), UINT16_C(39796), UINT16_C(  303),
+      UINT16_C( 1218), UINT16_C(37143), UINT16_C(22237), UINT16_C(10563), UINT16_C(59598), UINT16_C(61502), UINT16_C(54465), UINT16_C( 5599),
+      UINT16_C(15239), UINT16_C(34744), UINT16_C(24416), UINT16_C(25250), UINT16_C(55708) };
+  static const uint16_t b = UINT16_C(27086);
+  static const uint16_t e[] =
+    { UINT16_C(24821), UINT16_C(12720), UINT16_C(    0), UINT16_C(24026), UINT16_C(25181), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C(19966), UINT16_C(    0), UINT16_C(26860), UINT16_C(27086), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C( 2332), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(10794), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C(11995), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(12792), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 3703), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(14559), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(12403), UINT16_C(    0), UINT16_C(18888), UINT16_C(24937), UINT16_C(    0), UINT16_C( 2666), UINT16_C(21104),
+      UINT16_C( 5508), UINT16_C(13271), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 6322), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(26747), UINT16_C(    0), UINT16_C(    0), UINT16_C(13427), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(24312), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C( 6950),
+      UINT16_C(    0), UINT16_C(27086), UINT16_C(20270), UINT16_C(27086), UINT16_C(    0), UINT16_C(19500), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C( 2791), UINT16_C(    0), UINT16_C(    0), UINT16_C(10950), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(12296), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(11113), UINT16_C(    0), UINT16_C(15957), UINT16_C( 3589),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 6289), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(15131), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(20883), UINT16_C( 9372), UINT16_C(27086), UINT16_C( 6003), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(20348), UINT16_C(    0), UINT16_C(27086), UINT16_C( 9735), UINT16_C(12450), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C( 7737), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(10326), UINT16_C(    0), UINT16_C(27086), UINT16_C(19489), UINT16_C( 8149), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(16732), UINT16_C(    0), UINT16_C(    0), UINT16_C( 9939), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(21242), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(15830), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(25309), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(27086), UINT16_C( 9341), UINT16_C(    0), UINT16_C(    0), UINT16_C(25643), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 1895), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(15420), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(25206), UINT16_C(27086), UINT16_C(14502), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C( 5551), UINT16_C( 5642), UINT16_C(    0), UINT16_C( 1959), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(19595), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(27086), UINT16_C(23503), UINT16_C(27086), UINT16_C(    0), UINT16_C(15372), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 5295), UINT16_C(27086), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C( 9648), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(13878), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C( 1667), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(21624), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C( 4438), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(24808),
+      UINT16_C(24882), UINT16_C( 1972), UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C( 4075),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(13075), UINT16_C(27086), UINT16_C(15519), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(27086), UINT16_C(    0), UINT16_C(23598), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(18337),
+      UINT16_C(22130), UINT16_C(27086), UINT16_C(    0), UINT16_C(10244), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(19535), UINT16_C( 1224), UINT16_C(    0), UINT16_C( 7318), UINT16_C(14301), UINT16_C(20324),
+      UINT16_C(10125), UINT16_C( 5845), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086),
+      UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C( 7079), UINT16_C(    0), UINT16_C(27086), UINT16_C(27086), UINT16_C(    0),
+      UINT16_C( 1218), UINT16_C(27086), UINT16_C(22237), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086), UINT16_C(    0),
+      UINT16_C(15239), UINT16_C(27086), UINT16_C(    0), UINT16_C(    0), UINT16_C(27086) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_n_u16_z(pv, av, b);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    ev = simde_svmin_n_u16_z(pv, av, b);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(64082), UINT16_C(63394), UINT16_C(24738), UINT16_C( 8577), UINT16_C(47705), UINT16_C(19729), UINT16_C(29464), UINT16_C(50882),
+      UINT16_C(17254), UINT16_C(14223), UINT16_C(18772), UINT16_C(63768), UINT16_C(60796), UINT16_C(46829), UINT16_C(39309), UINT16_C(57281),
+      UINT16_C(25491), UINT16_C(13782), UINT16_C(22723), UINT16_C( 7255), UINT16_C(26642), UINT16_C(11113), UINT16_C(11483), UINT16_C(16881),
+      UINT16_C(33135), UINT16_C(50040), UINT16_C(37066), UINT16_C(18108), UINT16_C(43390), UINT16_C( 3068), UINT16_C(48450), UINT16_C(55019),
+      UINT16_C(49440), UINT16_C(58123), UINT16_C(25113), UINT16_C(11264), UINT16_C(27082), UINT16_C(42583), UINT16_C(18581), UINT16_C( 1255),
+      UINT16_C(24777), UINT16_C(37832), UINT16_C(34032), UINT16_C(28378), UINT16_C(54830), UINT16_C(28794), UINT16_C(26004), UINT16_C(46150),
+      UINT16_C(21030), UINT16_C(16536), UINT16_C(39092), UINT16_C(32620), UINT16_C(49921), UINT16_C(38693), UINT16_C( 3083), UINT16_C(54683),
+      UINT16_C(25452), UINT16_C(23912), UINT16_C(17128), UINT16_C( 5835), UINT16_C(17689), UINT16_C(44422), UINT16_C(52650), UINT16_C(53601),
+      UINT16_C(63775), UINT16_C(54033), UINT16_C(32145), UINT16_C(37714), UINT16_C(30528), UINT16_C(19242), UINT16_C(50564), UINT16_C(61472),
+      UINT16_C(35113), UINT16_C( 4429), UINT16_C( 6603), UINT16_C(58407), UINT16_C(44382), UINT16_C( 2449), UINT16_C(62330), UINT16_C(39386),
+      UINT16_C(60396), UINT16_C(32365), UINT16_C(49000), UINT16_C(43025), UINT16_C(15159), UINT16_C(48115), UINT16_C( 5120), UINT16_C(10667),
+      UINT16_C(63901), UINT16_C(26682), UINT16_C(24850), UINT16_C(28749), UINT16_C(56847), UINT16_C(35193), UINT16_C(21457), UINT16_C(48675),
+      UINT16_C(36926), UINT16_C(42556), UINT16_C(19791), UINT16_C(34382), UINT16_C(17032), UINT16_C(34881), UINT16_C(60758), UINT16_C(62386),
+      UINT16_C(60646), UINT16_C(63579), UINT16_C(43086), UINT16_C(23912), UINT16_C(57991), UINT16_C(22758), UINT16_C( 2357), UINT16_C(29718),
+      UINT16_C(21145), UINT16_C(59674), UINT16_C(27039), UINT16_C(10095), UINT16_C(45483), UINT16_C(  432), UINT16_C(25246), UINT16_C(34036),
+      UINT16_C(20302), UINT16_C(40060), UINT16_C(58616), UINT16_C(32761), UINT16_C(57542), UINT16_C(64727), UINT16_C(61161), UINT16_C(33648),
+      UINT16_C(35392), UINT16_C(57452), UINT16_C(56307), UINT16_C(40455), UINT16_C(46988), UINT16_C(10911), UINT16_C(37657), UINT16_C(26798),
+      UINT16_C(10979), UINT16_C(56068), UINT16_C(65039), UINT16_C(54618), UINT16_C(12766), UINT16_C(51153), UINT16_C(16671), UINT16_C(24650),
+      UINT16_C(46796), UINT16_C(48960), UINT16_C(18322), UINT16_C( 7774), UINT16_C(65023), UINT16_C( 6217), UINT16_C(63377), UINT16_C(29824),
+      UINT16_C(34082), UINT16_C(12623), UINT16_C(43395), UINT16_C(24838), UINT16_C(55514), UINT16_C(64040), UINT16_C(29465), UINT16_C(58714),
+      UINT16_C(39465), UINT16_C(48037), UINT16_C(  993), UINT16_C(57562), UINT16_C( 8960), UINT16_C(37369), UINT16_C(31002), UINT16_C(15365),
+      UINT16_C(21758), UINT16_C(33133), UINT16_C(29949), UINT16_C(55522), UINT16_C( 2892), UINT16_C(26066), UINT16_C(11390), UINT16_C(42827),
+      UINT16_C(61638), UINT16_C(42851), UINT16_C(15859), UINT16_C(62344), UINT16_C(33120), UINT16_C(31365), UINT16_C(35578), UINT16_C(63927),
+      UINT16_C( 9439), UINT16_C(56442), UINT16_C(23960), UINT16_C(58548), UINT16_C(34408), UINT16_C(58954), UINT16_C(38322), UINT16_C(30861),
+      UINT16_C(61573), UINT16_C(30752), UINT16_C(43053), UINT16_C(36203), UINT16_C(61481), UINT16_C( 8968), UINT16_C(49019), UINT16_C(23068),
+      UINT16_C(38883), UINT16_C(31798), UINT16_C(60404), UINT16_C(23648), UINT16_C(43633), UINT16_C( 9282), UINT16_C(53055), UINT16_C(50332),
+      UINT16_C(48320), UINT16_C(60732), UINT16_C(43108), UINT16_C(36219), UINT16_C(33688), UINT16_C( 5041), UINT16_C(52546), UINT16_C( 9581),
+      UINT16_C(42084), UINT16_C(22689), UINT16_C(  655), UINT16_C(  180), UINT16_C(63148), UINT16_C(60452), UINT16_C(49606), UINT16_C(34480),
+      UINT16_C(60797), UINT16_C(57971), UINT16_C(61077), UINT16_C(11631), UINT16_C( 8305), UINT16_C(45889), UINT16_C(44782), UINT16_C(21209),
+      UINT16_C(31314), UINT16_C(57771), UINT16_C(24444), UINT16_C(10722), UINT16_C( 1622), UINT16_C( 7189), UINT16_C(50631), UINT16_C(17826),
+      UINT16_C( 5554), UINT16_C(18215), UINT16_C(38404), UINT16_C(30069), UINT16_C(46775), UINT16_C(42281), UINT16_C(  612), UINT16_C(47095),
+      UINT16_C(41596), UINT16_C(63896), UINT16_C(31234), UINT16_C(22562), UINT16_C(14209), UINT16_C(18548), UINT16_C( 5884), UINT16_C(44941),
+      UINT16_C(46123), UINT16_C(12278), UINT16_C(27467), UINT16_C(  677), UINT16_C(52769), UINT16_C(34471), UINT16_C(40656), UINT16_C(19517),
+      UINT16_C(54593), UINT16_C(17221), UINT16_C(26448), UINT16_C(53659), UINT16_C( 3998), UINT16_C(39705), UINT16_C(42789), UINT16_C(20554),
+      UINT16_C(16475), UINT16_C(42624), UINT16_C( 9644), UINT16_C(52648), UINT16_C(20467), UINT16_C(50003), UINT16_C(37102), UINT16_C(12047),
+      UINT16_C(21862), UINT16_C(46706), UINT16_C( 3516), UINT16_C(23431), UINT16_C(40988), UINT16_C(16886), UINT16_C(16455), UINT16_C(41873),
+      UINT16_C( 4480), UINT16_C(11337), UINT16_C(62006), UINT16_C(10746), UINT16_C(19777), UINT16_C(12268), UINT16_C(64734), UINT16_C(17502),
+      UINT16_C(53329), UINT16_C( 3578), UINT16_C(33245), UINT16_C(63848), UINT16_C(24097), UINT16_C(26938), UINT16_C(52382), UINT16_C( 7948),
+      UINT16_C(21981), UINT16_C( 5195), UINT16_C(17735), UINT16_C(35133), UINT16_C(10899), UINT16_C(29112), UINT16_C( 5926), UINT16_C(30645),
+      UINT16_C(45031), UINT16_C(50564), UINT16_C(60720), UINT16_C(20926), UINT16_C(63819), UINT16_C(60090), UINT16_C(50885), UINT16_C(41481),
+      UINT16_C(21532), UINT16_C(25526), UINT16_C(62618), UINT16_C(11756), UINT16_C(42270), UINT16_C(17566), UINT16_C(21436), UINT16_C(41915),
+      UINT16_C(16130), UINT16_C(12904), UINT16_C(10028), UINT16_C(30851), UINT16_C(15904), UINT16_C(58722), UINT16_C(27396), UINT16_C( 8327),
+      UINT16_C(16063), UINT16_C(22916), UINT16_C(28722), UINT16_C(20614), UINT16_C( 9237), UINT16_C(53652), UINT16_C(20343), UINT16_C(31093),
+      UINT16_C(56718), UINT16_C(48043), UINT16_C(12036), UINT16_C( 9267), UINT16_C(38253), UINT16_C(28937), UINT16_C(37120), UINT16_C(49042),
+      UINT16_C( 5839), UINT16_C(  281), UINT16_C(40838), UINT16_C(40017), UINT16_C(58820), UINT16_C(15213), UINT16_C(57908), UINT16_C(49845),
+      UINT16_C(24768), UINT16_C(50301), UINT16_C(45199), UINT16_C(64745), UINT16_C(62021), UINT16_C(17774), UINT16_C(  131), UINT16_C(20997),
+      UINT16_C( 7702), UINT16_C(40019) };
+  static const uint16_t b = UINT16_C(23680);
+  static const uint16_t e[] =
+    { UINT16_C(64082), UINT16_C(23680), UINT16_C(24738), UINT16_C( 8577), UINT16_C(23680), UINT16_C(19729), UINT16_C(23680), UINT16_C(23680),
+      UINT16_C(17254), UINT16_C(14223), UINT16_C(18772), UINT16_C(23680), UINT16_C(60796), UINT16_C(23680), UINT16_C(39309), UINT16_C(23680),
+      UINT16_C(23680), UINT16_C(13782), UINT16_C(22723), UINT16_C( 7255), UINT16_C(23680), UINT16_C(11113), UINT16_C(11483), UINT16_C(16881),
+      UINT16_C(33135), UINT16_C(50040), UINT16_C(37066), UINT16_C(18108), UINT16_C(43390), UINT16_C( 3068), UINT16_C(48450), UINT16_C(23680),
+      UINT16_C(49440), UINT16_C(58123), UINT16_C(23680), UINT16_C(11264), UINT16_C(23680), UINT16_C(23680), UINT16_C(18581), UINT16_C( 1255),
+      UINT16_C(23680), UINT16_C(37832), UINT16_C(23680), UINT16_C(28378), UINT16_C(54830), UINT16_C(28794), UINT16_C(26004), UINT16_C(23680),
+      UINT16_C(21030), UINT16_C(16536), UINT16_C(23680), UINT16_C(23680), UINT16_C(49921), UINT16_C(23680), UINT16_C( 3083), UINT16_C(54683),
+      UINT16_C(23680), UINT16_C(23680), UINT16_C(17128), UINT16_C( 5835), UINT16_C(17689), UINT16_C(44422), UINT16_C(23680), UINT16_C(53601),
+      UINT16_C(63775), UINT16_C(54033), UINT16_C(32145), UINT16_C(23680), UINT16_C(23680), UINT16_C(19242), UINT16_C(23680), UINT16_C(23680),
+      UINT16_C(23680), UINT16_C( 4429), UINT16_C( 6603), UINT16_C(58407), UINT16_C(44382), UINT16_C( 2449), UINT16_C(23680), UINT16_C(39386),
+      UINT16_C(60396), UINT16_C(32365), UINT16_C(23680), UINT16_C(23680), UINT16_C(15159), UINT16_C(23680), UINT16_C( 5120), UINT16_C(10667),
+      UINT16_C(23680), UINT16_C(23680), UINT16_C(24850), UINT16_C(28749), UINT16_C(23680), UINT16_C(23680), UINT16_C(21457), UINT16_C(23680),
+      UINT16_C(36926), UINT16_C(42556), UINT16_C(19791), UINT16_C(34382), UINT16_C(17032), UINT16_C(23680), UINT16_C(60758), UINT16_C(62386),
+      UINT16_C(60646), UINT16_C(63579), UINT16_C(43086), UINT16_C(23680), UINT16_C(57991), UINT16_C(22758), UINT16_C( 2357), UINT16_C(29718),
+      UINT16_C(21145), UINT16_C(23680), UINT16_C(27039), UINT16_C(10095), UINT16_C(23680), UINT16_C(  432), UINT16_C(25246), UINT16_C(23680),
+      UINT16_C(20302), UINT16_C(40060), UINT16_C(23680), UINT16_C(32761), UINT16_C(57542), UINT16_C(23680), UINT16_C(61161), UINT16_C(23680),
+      UINT16_C(23680), UINT16_C(57452), UINT16_C(56307), UINT16_C(23680), UINT16_C(46988), UINT16_C(10911), UINT16_C(37657), UINT16_C(23680),
+      UINT16_C(10979), UINT16_C(23680), UINT16_C(65039), UINT16_C(54618), UINT16_C(12766), UINT16_C(23680), UINT16_C(16671), UINT16_C(23680),
+      UINT16_C(46796), UINT16_C(23680), UINT16_C(18322), UINT16_C( 7774), UINT16_C(65023), UINT16_C( 6217), UINT16_C(63377), UINT16_C(29824),
+      UINT16_C(34082), UINT16_C(12623), UINT16_C(23680), UINT16_C(24838), UINT16_C(55514), UINT16_C(64040), UINT16_C(29465), UINT16_C(58714),
+      UINT16_C(39465), UINT16_C(23680), UINT16_C(  993), UINT16_C(23680), UINT16_C( 8960), UINT16_C(23680), UINT16_C(23680), UINT16_C(15365),
+      UINT16_C(21758), UINT16_C(23680), UINT16_C(29949), UINT16_C(55522), UINT16_C( 2892), UINT16_C(23680), UINT16_C(11390), UINT16_C(42827),
+      UINT16_C(23680), UINT16_C(23680), UINT16_C(15859), UINT16_C(23680), UINT16_C(23680), UINT16_C(23680), UINT16_C(35578), UINT16_C(23680),
+      UINT16_C( 9439), UINT16_C(56442), UINT16_C(23960), UINT16_C(58548), UINT16_C(23680), UINT16_C(58954), UINT16_C(23680), UINT16_C(30861),
+      UINT16_C(23680), UINT16_C(23680), UINT16_C(23680), UINT16_C(36203), UINT16_C(61481), UINT16_C( 8968), UINT16_C(49019), UINT16_C(23068),
+      UINT16_C(23680), UINT16_C(23680), UINT16_C(23680), UINT16_C(23648), UINT16_C(43633), UINT16_C( 9282), UINT16_C(23680), UINT16_C(23680),
+      UINT16_C(48320), UINT16_C(60732), UINT16_C(23680), UINT16_C(36219), UINT16_C(33688), UINT16_C( 5041), UINT16_C(23680), UINT16_C( 9581),
+      UINT16_C(42084), UINT16_C(22689), UINT16_C(  655), UINT16_C(  180), UINT16_C(63148), UINT16_C(60452), UINT16_C(49606), UINT16_C(34480),
+      UINT16_C(60797), UINT16_C(23680), UINT16_C(61077), UINT16_C(11631), UINT16_C( 8305), UINT16_C(45889), UINT16_C(44782), UINT16_C(21209),
+      UINT16_C(23680), UINT16_C(57771), UINT16_C(24444), UINT16_C(10722), UINT16_C( 1622), UINT16_C( 7189), UINT16_C(23680), UINT16_C(17826),
+      UINT16_C( 5554), UINT16_C(18215), UINT16_C(23680), UINT16_C(23680), UINT16_C(46775), UINT16_C(23680), UINT16_C(  612), UINT16_C(47095),
+      UINT16_C(41596), UINT16_C(23680), UINT16_C(23680), UINT16_C(22562), UINT16_C(14209), UINT16_C(18548), UINT16_C( 5884), UINT16_C(23680),
+      UINT16_C(46123), UINT16_C(12278), UINT16_C(27467), UINT16_C(  677), UINT16_C(52769), UINT16_C(34471), UINT16_C(40656), UINT16_C(19517),
+      UINT16_C(54593), UINT16_C(17221), UINT16_C(26448), UINT16_C(53659), UINT16_C( 3998), UINT16_C(23680), UINT16_C(23680), UINT16_C(20554),
+      UINT16_C(16475), UINT16_C(42624), UINT16_C( 9644), UINT16_C(52648), UINT16_C(20467), UINT16_C(23680), UINT16_C(37102), UINT16_C(12047),
+      UINT16_C(21862), UINT16_C(46706), UINT16_C( 3516), UINT16_C(23431), UINT16_C(40988), UINT16_C(16886), UINT16_C(16455), UINT16_C(41873),
+      UINT16_C( 4480), UINT16_C(11337), UINT16_C(23680), UINT16_C(10746), UINT16_C(19777), UINT16_C(12268), UINT16_C(64734), UINT16_C(17502),
+      UINT16_C(23680), UINT16_C( 3578), UINT16_C(23680), UINT16_C(23680), UINT16_C(24097), UINT16_C(23680), UINT16_C(23680), UINT16_C( 7948),
+      UINT16_C(21981), UINT16_C( 5195), UINT16_C(17735), UINT16_C(35133), UINT16_C(10899), UINT16_C(23680), UINT16_C( 5926), UINT16_C(30645),
+      UINT16_C(45031), UINT16_C(23680), UINT16_C(23680), UINT16_C(20926), UINT16_C(63819), UINT16_C(23680), UINT16_C(50885), UINT16_C(41481),
+      UINT16_C(21532), UINT16_C(23680), UINT16_C(23680), UINT16_C(11756), UINT16_C(23680), UINT16_C(17566), UINT16_C(21436), UINT16_C(23680),
+      UINT16_C(16130), UINT16_C(12904), UINT16_C(10028), UINT16_C(30851), UINT16_C(15904), UINT16_C(23680), UINT16_C(23680), UINT16_C( 8327),
+      UINT16_C(16063), UINT16_C(22916), UINT16_C(23680), UINT16_C(20614), UINT16_C( 9237), UINT16_C(23680), UINT16_C(20343), UINT16_C(31093),
+      UINT16_C(23680), UINT16_C(23680), UINT16_C(12036), UINT16_C( 9267), UINT16_C(23680), UINT16_C(28937), UINT16_C(37120), UINT16_C(49042),
+      UINT16_C( 5839), UINT16_C(  281), UINT16_C(40838), UINT16_C(23680), UINT16_C(58820), UINT16_C(15213), UINT16_C(57908), UINT16_C(23680),
+      UINT16_C(23680), UINT16_C(50301), UINT16_C(45199), UINT16_C(64745), UINT16_C(62021), UINT16_C(17774), UINT16_C(  131), UINT16_C(20997),
+      UINT16_C( 7702), UINT16_C(23680) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmin_n_u16_m(pv, av, b);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    ev = simde_svmin_n_u16_m(pv, av, b);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C( 956215936), UINT32_C(1063259179), UINT32_C(2796396252), UINT32_C(2596826702), UINT32_C(3551331167), UINT32_C(3462660513), UINT32_C(  96203129), UINT32_C(1410224084),
+      UINT32_C( 747441153), UINT32_C(4117556505), UINT32_C(3667663243), UINT32_C(3883164808), UINT32_C( 146416231), UINT32_C(2631343907), UINT32_C(3835793936), UINT32_C(3795431393),
+      UINT32_C(3557803707), UINT32_C(1070234547), UINT32_C( 471426708), UINT32_C( 822316490), UINT32_C(3527065263), UINT32_C(3983413725), UINT32_C(2245070755), UINT32_C(2053573310),
+      UINT32_C(2219734736), UINT32_C(2260932849), UINT32_C(1218632830), UINT32_C( 427468393), UINT32_C(1105966180), UINT32_C(1747868357), UINT32_C( 686686057), UINT32_C(3668071690),
+      UINT32_C(3177115851), UINT32_C(2269323529), UINT32_C(1741743613), UINT32_C(4018162315), UINT32_C(3274730494), UINT32_C( 791371461), UINT32_C(1750538590), UINT32_C( 960690542),
+      UINT32_C(4076249577), UINT32_C(3229235650), UINT32_C(2854701599), UINT32_C(2459608980), UINT32_C(3629500946), UINT32_C(2265415721), UINT32_C( 133127833), UINT32_C(1078014295),
+      UINT32_C(2503161810), UINT32_C(2421534065), UINT32_C(2335866103), UINT32_C( 891147299), UINT32_C(3356324511), UINT32_C(2353992946), UINT32_C(3381870194), UINT32_C(1108005999),
+      UINT32_C(2111257868), UINT32_C(3775737066), UINT32_C(3412871080), UINT32_C(3137374492), UINT32_C(3984789243), UINT32_C(2507788834), UINT32_C(2136870160), UINT32_C(3988875489),
+      UINT32_C(2406127781), UINT32_C(1819310020), UINT32_C(3677871295), UINT32_C(1620457573), UINT32_C(1749948742), UINT32_C(4227713003), UINT32_C(3061472468), UINT32_C(1789082820),
+      UINT32_C(2583236308), UINT32_C(1141205637), UINT32_C(2887728454), UINT32_C(3138172277), UINT32_C(3106101966), UINT32_C(4139000098), UINT32_C(1101803389), UINT32_C(1068191851),
+      UINT32_C(3822626142), UINT32_C(1428741647), UINT32_C(2416002843), UINT32_C(3410693885), UINT32_C(2324000360), UINT32_C( 209795471), UINT32_C(3545116008), UINT32_C(3675519357),
+      UINT32_C(2915036062), UINT32_C(3825461193), UINT32_C( 729023534), UINT32_C(2079833874), UINT32_C(3171253294), UINT32_C( 516589237), UINT32_C( 837884084), UINT32_C(2953643025),
+      UINT32_C(3109932272), UINT32_C(3785253043), UINT32_C(1997345381), UINT32_C(  15860946), UINT32_C( 901642368), UINT32_C( 844334974), UINT32_C(2976138655), UINT32_C( 962687305),
+      UINT32_C(4042505789), UINT32_C(2228326687), UINT32_C(1979440803), UINT32_C(1651896034), UINT32_C(1687696358), UINT32_C(1519905722), UINT32_C(2047605552), UINT32_C(2847108204),
+      UINT32_C(1234806314), UINT32_C(3687672375), UINT32_C( 726714697), UINT32_C(2643379895), UINT32_C(3003197177), UINT32_C(1108187153), UINT32_C(4290517139), UINT32_C(2947051396),
+      UINT32_C(1308115222), UINT32_C(4113090220), UINT32_C(1176533391), UINT32_C( 954445375), UINT32_C(3874219220), UINT32_C( 271120765), UINT32_C(2517689361), UINT32_C(1766176851),
+      UINT32_C(2797026810), UINT32_C(2459688707), UINT32_C(2547563352), UINT32_C(1053801322), UINT32_C( 488946592), UINT32_C(3308080308), UINT32_C(2220571952), UINT32_C(4042105078),
+      UINT32_C(3784746206), UINT32_C(3698602372), UINT32_C(1450462444), UINT32_C(2828354312), UINT32_C(2999302654), UINT32_C( 913895942), UINT32_C( 649777968), UINT32_C(1377216628),
+      UINT32_C(3493047372), UINT32_C(3383601117), UINT32_C(4229964276), UINT32_C(1671738724), UINT32_C(1947560302), UINT32_C(2343275867), UINT32_C(3585172833), UINT32_C(1512556301),
+      UINT32_C(1344952947), UINT32_C(4128954114), UINT32_C(1576155896), UINT32_C(1572902639), UINT32_C(1523766783), UINT32_C(3303439715), UINT32_C(4036597730), UINT32_C(3528114271),
+      UINT32_C( 472085530), UINT32_C(1142046028), UINT32_C(1721828471), UINT32_C(2579718554), UINT32_C(2599720247), UINT32_C(4116634130), UINT32_C(3504732017), UINT32_C(3517132727),
+      UINT32_C(4025403043), UINT32_C(2050228227), UINT32_C(2682311941), UINT32_C(1849271095), UINT32_C(1258827065), UINT32_C(2017486343), UINT32_C( 340338013), UINT32_C(4175817812),
+      UINT32_C(3051869106), UINT32_C(3643743188), UINT32_C( 678957041), UINT32_C(3952521650), UINT32_C(3845627614), UINT32_C(1633580804), UINT32_C(4051019677), UINT32_C(1172920979),
+      UINT32_C(  49991982), UINT32_C(3722127852), UINT32_C(3926217528), UINT32_C(3822492421), UINT32_C(1036586297), UINT32_C( 564012932), UINT32_C(1628640206), UINT32_C(2628189294),
+      UINT32_C(3130958029), UINT32_C(  26704329), UINT32_C(3521879500), UINT32_C(1924514104), UINT32_C(1404010190), UINT32_C(1937002149), UINT32_C(3486812001), UINT32_C(1365998212),
+      UINT32_C(3809151258), UINT32_C(1340384130), UINT32_C(2015416128), UINT32_C(1609225617), UINT32_C(4172454483), UINT32_C(1231759336), UINT32_C( 840515502), UINT32_C(3548677305),
+      UINT32_C( 280399758), UINT32_C(1918868018), UINT32_C(4226515050), UINT32_C(2841302357), UINT32_C(1470172527), UINT32_C(3802205492), UINT32_C( 102087244), UINT32_C(3436812606),
+      UINT32_C(1541247016), UINT32_C(2496478250), UINT32_C( 311408828), UINT32_C(4256950926), UINT32_C( 727014647), UINT32_C(3054368361), UINT32_C(4005307056), UINT32_C(3837498811) };
+  static const uint32_t b = UINT32_C( 566317084);
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 133127833), UINT32_C( 566317084),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(  15860946), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 488946592), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084),
+      UINT32_C(  49991982), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 564012932), UINT32_C( 566317084), UINT32_C( 566317084),
+      UINT32_C( 566317084), UINT32_C(  26704329), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 566317084),
+      UINT32_C( 280399758), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C( 566317084), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 311408828), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0), UINT32_C( 566317084), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_n_u32_z(pv, av, b);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    ev = simde_svmin_n_u32_z(pv, av, b);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(3128343536), UINT32_C(1543086771), UINT32_C(2128702254), UINT32_C(4005221984), UINT32_C( 857496675), UINT32_C(1894544703), UINT32_C(2381851880), UINT32_C(2666767534),
+      UINT32_C( 307784287), UINT32_C( 980242700), UINT32_C( 498618044), UINT32_C(2265674532), UINT32_C( 247146447), UINT32_C(2222892956), UINT32_C(2182182612), UINT32_C(2048918810),
+      UINT32_C(2072803439), UINT32_C(2243361481), UINT32_C(1839361608), UINT32_C(2968825313), UINT32_C(1908387796), UINT32_C( 737492311), UINT32_C(3467446196), UINT32_C(2068368652),
+      UINT32_C( 251057477), UINT32_C( 395553999), UINT32_C(4236523035), UINT32_C(3098376675), UINT32_C(2133421096), UINT32_C(1571430057), UINT32_C( 824989477), UINT32_C(1772909604),
+      UINT32_C( 410493769), UINT32_C(1781533519), UINT32_C( 610776129), UINT32_C(1457263661), UINT32_C( 701826432), UINT32_C(1233616932), UINT32_C(4235965399), UINT32_C(1902454567),
+      UINT32_C( 445242826), UINT32_C( 696564200), UINT32_C(2605575022), UINT32_C(2146511615), UINT32_C(1403635503), UINT32_C( 513617991), UINT32_C( 169482467), UINT32_C( 175865919),
+      UINT32_C(1159988573), UINT32_C( 745449662), UINT32_C(2479405972), UINT32_C( 353614309), UINT32_C(3345529984), UINT32_C(3487958508), UINT32_C(1574502429), UINT32_C(3714536832),
+      UINT32_C( 404917082), UINT32_C(3343224883), UINT32_C( 828050764), UINT32_C(1195798214), UINT32_C( 370061098), UINT32_C(3538285748), UINT32_C(1966063349), UINT32_C(1834194451),
+      UINT32_C(1418097953), UINT32_C(1377618694), UINT32_C(2659416024), UINT32_C( 266717925), UINT32_C( 757462137), UINT32_C(3724479208), UINT32_C(3696438984), UINT32_C(3846809284),
+      UINT32_C( 557502235), UINT32_C(1920161434), UINT32_C(2987521997), UINT32_C( 985790145), UINT32_C(3546801898), UINT32_C(3098568688), UINT32_C(1519649685), UINT32_C(3309297321),
+      UINT32_C(1223063981), UINT32_C(2629458639), UINT32_C( 307153745), UINT32_C(2890665922), UINT32_C(3850351605), UINT32_C(2963157018), UINT32_C(3708432947), UINT32_C(3198306576),
+      UINT32_C(2449901763), UINT32_C( 858767586), UINT32_C(1313176972), UINT32_C(2197459341), UINT32_C(1600682565), UINT32_C(3708749482), UINT32_C(1236932920), UINT32_C( 638016611),
+      UINT32_C(3350728165), UINT32_C(1509681101), UINT32_C(4071047269), UINT32_C( 393519826), UINT32_C(3329678364), UINT32_C( 463701730), UINT32_C(  40132255), UINT32_C(2670226362),
+      UINT32_C(1164435832), UINT32_C( 765420232), UINT32_C(1948206754), UINT32_C(  76256488), UINT32_C(1405747824), UINT32_C( 661548680), UINT32_C(2250953420), UINT32_C(3039187517),
+      UINT32_C(4244278579), UINT32_C(2435422703), UINT32_C(3355855328), UINT32_C(1305317853), UINT32_C( 463509395), UINT32_C(3510832645), UINT32_C( 492334560), UINT32_C(4090658495),
+      UINT32_C(4210019595), UINT32_C(1183520870), UINT32_C(1041207649), UINT32_C(3062684707), UINT32_C(2043817075), UINT32_C( 457839931), UINT32_C(1094296194), UINT32_C( 724831008),
+      UINT32_C(1059398616), UINT32_C(2642784572), UINT32_C(1708954690), UINT32_C(3827066992), UINT32_C(3479039636), UINT32_C(2246813443), UINT32_C(1791370314), UINT32_C( 144112431),
+      UINT32_C(1514650398), UINT32_C(2952318060), UINT32_C(3507803233), UINT32_C(3501535292), UINT32_C( 564138526), UINT32_C(  78023610), UINT32_C(3731778991), UINT32_C(2263221352),
+      UINT32_C( 752954816), UINT32_C(1541134842), UINT32_C(3912036525), UINT32_C(1069146656), UINT32_C(2925550068), UINT32_C(2477918180), UINT32_C(3698467188), UINT32_C(3848427557),
+      UINT32_C(2148680582), UINT32_C(3386633500), UINT32_C(4273080285), UINT32_C(3728567529), UINT32_C(2861342149), UINT32_C( 406667172), UINT32_C(2247405408), UINT32_C(2389399304),
+      UINT32_C(3071180186), UINT32_C(1216407914), UINT32_C(3662033904), UINT32_C(1689813919), UINT32_C(3306046496), UINT32_C(3822931075), UINT32_C(  57266939), UINT32_C(3281114153),
+      UINT32_C(3145375569), UINT32_C(2030304136), UINT32_C(3444787502), UINT32_C(3979414476), UINT32_C(3551674447), UINT32_C(2276888460) };
+  static const uint32_t b = UINT32_C(2368363631);
+  static const uint32_t e[] =
+    { UINT32_C(2368363631), UINT32_C(1543086771), UINT32_C(2128702254), UINT32_C(2368363631), UINT32_C( 857496675), UINT32_C(1894544703), UINT32_C(2368363631), UINT32_C(2666767534),
+      UINT32_C( 307784287), UINT32_C( 980242700), UINT32_C( 498618044), UINT32_C(2265674532), UINT32_C( 247146447), UINT32_C(2222892956), UINT32_C(2182182612), UINT32_C(2048918810),
+      UINT32_C(2072803439), UINT32_C(2243361481), UINT32_C(1839361608), UINT32_C(2368363631), UINT32_C(1908387796), UINT32_C( 737492311), UINT32_C(2368363631), UINT32_C(2068368652),
+      UINT32_C( 251057477), UINT32_C( 395553999), UINT32_C(4236523035), UINT32_C(3098376675), UINT32_C(2133421096), UINT32_C(1571430057), UINT32_C( 824989477), UINT32_C(1772909604),
+      UINT32_C( 410493769), UINT32_C(1781533519), UINT32_C( 610776129), UINT32_C(1457263661), UINT32_C( 701826432), UINT32_C(1233616932), UINT32_C(2368363631), UINT32_C(1902454567),
+      UINT32_C( 445242826), UINT32_C( 696564200), UINT32_C(2605575022), UINT32_C(2146511615), UINT32_C(1403635503), UINT32_C( 513617991), UINT32_C( 169482467), UINT32_C( 175865919),
+      UINT32_C(1159988573), UINT32_C( 745449662), UINT32_C(2368363631), UINT32_C( 353614309), UINT32_C(3345529984), UINT32_C(3487958508), UINT32_C(1574502429), UINT32_C(2368363631),
+      UINT32_C( 404917082), UINT32_C(2368363631), UINT32_C( 828050764), UINT32_C(1195798214), UINT32_C( 370061098), UINT32_C(2368363631), UINT32_C(1966063349), UINT32_C(1834194451),
+      UINT32_C(1418097953), UINT32_C(1377618694), UINT32_C(2368363631), UINT32_C( 266717925), UINT32_C( 757462137), UINT32_C(3724479208), UINT32_C(2368363631), UINT32_C(3846809284),
+      UINT32_C( 557502235), UINT32_C(1920161434), UINT32_C(2368363631), UINT32_C( 985790145), UINT32_C(3546801898), UINT32_C(2368363631), UINT32_C(1519649685), UINT32_C(3309297321),
+      UINT32_C(1223063981), UINT32_C(2368363631), UINT32_C( 307153745), UINT32_C(2368363631), UINT32_C(3850351605), UINT32_C(2963157018), UINT32_C(2368363631), UINT32_C(3198306576),
+      UINT32_C(2368363631), UINT32_C( 858767586), UINT32_C(1313176972), UINT32_C(2197459341), UINT32_C(1600682565), UINT32_C(3708749482), UINT32_C(1236932920), UINT32_C( 638016611),
+      UINT32_C(2368363631), UINT32_C(1509681101), UINT32_C(4071047269), UINT32_C( 393519826), UINT32_C(2368363631), UINT32_C( 463701730), UINT32_C(  40132255), UINT32_C(2368363631),
+      UINT32_C(1164435832), UINT32_C( 765420232), UINT32_C(1948206754), UINT32_C(  76256488), UINT32_C(1405747824), UINT32_C( 661548680), UINT32_C(2250953420), UINT32_C(3039187517),
+      UINT32_C(2368363631), UINT32_C(2435422703), UINT32_C(2368363631), UINT32_C(1305317853), UINT32_C( 463509395), UINT32_C(2368363631), UINT32_C( 492334560), UINT32_C(4090658495),
+      UINT32_C(2368363631), UINT32_C(1183520870), UINT32_C(1041207649), UINT32_C(3062684707), UINT32_C(2043817075), UINT32_C( 457839931), UINT32_C(1094296194), UINT32_C( 724831008),
+      UINT32_C(1059398616), UINT32_C(2368363631), UINT32_C(1708954690), UINT32_C(2368363631), UINT32_C(3479039636), UINT32_C(2246813443), UINT32_C(1791370314), UINT32_C( 144112431),
+      UINT32_C(1514650398), UINT32_C(2368363631), UINT32_C(3507803233), UINT32_C(2368363631), UINT32_C( 564138526), UINT32_C(  78023610), UINT32_C(2368363631), UINT32_C(2263221352),
+      UINT32_C( 752954816), UINT32_C(1541134842), UINT32_C(2368363631), UINT32_C(1069146656), UINT32_C(2925550068), UINT32_C(2368363631), UINT32_C(3698467188), UINT32_C(2368363631),
+      UINT32_C(2148680582), UINT32_C(3386633500), UINT32_C(2368363631), UINT32_C(3728567529), UINT32_C(2861342149), UINT32_C( 406667172), UINT32_C(2247405408), UINT32_C(2389399304),
+      UINT32_C(3071180186), UINT32_C(1216407914), UINT32_C(2368363631), UINT32_C(1689813919), UINT32_C(3306046496), UINT32_C(2368363631), UINT32_C(  57266939), UINT32_C(2368363631),
+      UINT32_C(3145375569), UINT32_C(2030304136), UINT32_C(3444787502), UINT32_C(2368363631), UINT32_C(3551674447), UINT32_C(2276888460) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_n_u32_m(pv, av, b);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    ev = simde_svmin_n_u32_m(pv, av, b);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C( 4147753290388908423), UINT64_C( 6799248372252231080), UINT64_C(13158791863484124753), UINT64_C( 1616836858847099548),
+      UINT64_C( 8480267985677125329), UINT64_C( 9941889930279350075), UINT64_C( 5003620861254647102), UINT64_C(13766726632998749800),
+      UINT64_C(11927191431845082178), UINT64_C(14417210474812660308), UINT64_C(13647017738965804661), UINT64_C(12638720601682620600),
+      UINT64_C(15295424454171990837), UINT64_C( 3562475658860790813), UINT64_C(11271300287183254106), UINT64_C( 1585170175718727651),
+      UINT64_C( 2204222853601344834), UINT64_C(14153184608828978813), UINT64_C( 5884197477396167208), UINT64_C(15344784903747267325),
+      UINT64_C( 2196962364343363678), UINT64_C(11624284841026470691), UINT64_C(11473858629571822460), UINT64_C(15827180151151385919),
+      UINT64_C(10076725451188484888), UINT64_C( 7788529087061438203), UINT64_C( 6443966181859050541), UINT64_C( 8342864828438342254),
+      UINT64_C(13113924363792220682), UINT64_C(12506286708832737075), UINT64_C(16534941250440979717), UINT64_C( 8908850620498289108),
+      UINT64_C(  507478304734760858), UINT64_C( 8805022660865700867), UINT64_C( 7780268072330964382), UINT64_C(18274829259419339442),
+      UINT64_C( 8928206460514634508), UINT64_C( 7530073320734003600), UINT64_C(15915851007859104222), UINT64_C(14096720621190675008),
+      UINT64_C(16076595369414488871), UINT64_C( 3084233793836751515), UINT64_C(   37577732575414655), UINT64_C( 5148815181201245434),
+      UINT64_C( 4352168982676444983), UINT64_C( 3572039162701892380), UINT64_C(12427508012088439224), UINT64_C(10902038628517354468),
+      UINT64_C( 5892822899133068009), UINT64_C(10354140407251167695), UINT64_C(15049480657661561980), UINT64_C(17550561875569424281),
+      UINT64_C(   60593199004953938), UINT64_C( 6347035168284381358), UINT64_C( 3781441058828065982), UINT64_C(13804867036350598807),
+      UINT64_C(  476287922715628139), UINT64_C(  928200356902214830), UINT64_C( 6885213038081107902), UINT64_C(16405369314703620990),
+      UINT64_C(13619759453589991846), UINT64_C(17263185989812522808), UINT64_C(17921746488594549135), UINT64_C(17360409311274382992),
+      UINT64_C(13784939599005314177), UINT64_C( 5449594953569571968), UINT64_C( 5662529682183219234), UINT64_C(10036346576522672398),
+      UINT64_C(12103258140730668720), UINT64_C( 4036625042025037309), UINT64_C( 1075915007135688674), UINT64_C( 4213310462628349667),
+      UINT64_C(17992840368025080805), UINT64_C(16786242950663376037), UINT64_C( 1615514854327109982), UINT64_C( 7386039184043266748),
+      UINT64_C(    1448443552920079), UINT64_C(14708949270925129522), UINT64_C(15835383198741342328), UINT64_C( 5786740975168767335),
+      UINT64_C( 1796479846325141652), UINT64_C(15155580700839684632), UINT64_C( 8795880894687444248), UINT64_C( 7608464150056022789),
+      UINT64_C( 7669426009901887857), UINT64_C( 5123762871447109616), UINT64_C(15946560017012791744), UINT64_C(15132298572468563906),
+      UINT64_C(10261339184118192299), UINT64_C( 6615774226971842392), UINT64_C(11475870991292190092), UINT64_C(14581871777114711339),
+      UINT64_C( 8699597820938127247), UINT64_C( 1332168864275927941), UINT64_C( 5880214741035952669), UINT64_C(10954788425674051870),
+      UINT64_C( 9320623826939530945), UINT64_C( 5164536041018907156), UINT64_C(17960316676130087624), UINT64_C( 1679065678695767213),
+      UINT64_C(12144046091435250443) };
+  static const uint64_t b = UINT64_C(17773777685551387333);
+  static const uint64_t e[] =
+    { UINT64_C(                   0), UINT64_C( 6799248372252231080), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 8480267985677125329), UINT64_C( 9941889930279350075), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(11927191431845082178), UINT64_C(14417210474812660308), UINT64_C(                   0), UINT64_C(12638720601682620600),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(11271300287183254106), UINT64_C( 1585170175718727651),
+      UINT64_C( 2204222853601344834), UINT64_C(                   0), UINT64_C( 5884197477396167208), UINT64_C(15344784903747267325),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(10076725451188484888), UINT64_C( 7788529087061438203), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 8908850620498289108),
+      UINT64_C(  507478304734760858), UINT64_C( 8805022660865700867), UINT64_C(                   0), UINT64_C(17773777685551387333),
+      UINT64_C(                   0), UINT64_C( 7530073320734003600), UINT64_C(15915851007859104222), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 3084233793836751515), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 3572039162701892380), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 5892822899133068009), UINT64_C(                   0), UINT64_C(15049480657661561980), UINT64_C(17550561875569424281),
+      UINT64_C(   60593199004953938), UINT64_C( 6347035168284381358), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(13619759453589991846), UINT64_C(17263185989812522808), UINT64_C(17773777685551387333), UINT64_C(                   0),
+      UINT64_C(13784939599005314177), UINT64_C( 5449594953569571968), UINT64_C(                   0), UINT64_C(10036346576522672398),
+      UINT64_C(12103258140730668720), UINT64_C( 4036625042025037309), UINT64_C( 1075915007135688674), UINT64_C(                   0),
+      UINT64_C(17773777685551387333), UINT64_C(16786242950663376037), UINT64_C(                   0), UINT64_C( 7386039184043266748),
+      UINT64_C(    1448443552920079), UINT64_C(14708949270925129522), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 1796479846325141652), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 7669426009901887857), UINT64_C( 5123762871447109616), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(10261339184118192299), UINT64_C( 6615774226971842392), UINT64_C(11475870991292190092), UINT64_C(                   0),
+      UINT64_C( 8699597820938127247), UINT64_C( 1332168864275927941), UINT64_C(                   0), UINT64_C(10954788425674051870),
+      UINT64_C( 9320623826939530945), UINT64_C(                   0), UINT64_C(17773777685551387333), UINT64_C( 1679065678695767213),
+      UINT64_C(12144046091435250443) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_n_u64_z(pv, av, b);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    ev = simde_svmin_n_u64_z(pv, av, b);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C( 1008290533211642240), UINT64_C( 3243700226314014725), UINT64_C( 1007289505931076231), UINT64_C( 3389346503553926541),
+      UINT64_C(12784598580573143417), UINT64_C( 3561564080386128149), UINT64_C(11015292362589236825), UINT64_C(14074486926259645043),
+      UINT64_C( 8249906625920522272), UINT64_C( 4765407540570927431), UINT64_C(17884060775884215950), UINT64_C( 9649365057328105180),
+      UINT64_C(16327184285026094278), UINT64_C(17774570183148652673), UINT64_C(10216908000095813451), UINT64_C( 1832855453301990533),
+      UINT64_C( 1307682788161143208), UINT64_C( 4069046164379138074), UINT64_C( 5342626804052592358), UINT64_C( 2027363596252796854),
+      UINT64_C( 5334659104447094373), UINT64_C(10493744109755073660), UINT64_C( 3700635614545750603), UINT64_C(11075018009314365219),
+      UINT64_C( 1240627992066986428), UINT64_C(10617267220435829788), UINT64_C(17255260275089899718), UINT64_C(14725425051252142734),
+      UINT64_C(11452919396804717129), UINT64_C( 5607471399601269749), UINT64_C(  213928077746533693), UINT64_C(18416661121114341048),
+      UINT64_C( 3759326185824079370), UINT64_C(10020020226477953082), UINT64_C( 6786517429051039672), UINT64_C( 2072142992791499531),
+      UINT64_C(12141375215584780042), UINT64_C(16951118210901078116), UINT64_C( 7789614787265549079), UINT64_C(  461600254189191480),
+      UINT64_C( 5306875218806968462), UINT64_C(11375030010579193534), UINT64_C( 8203715981933736716), UINT64_C( 9491375752855946933),
+      UINT64_C(10691867492306847796), UINT64_C(11769983451141594419), UINT64_C(15852364085880467796), UINT64_C( 1254047840570555119),
+      UINT64_C( 4519796581010696014), UINT64_C(17591710645222915816), UINT64_C(  720715694949347840), UINT64_C( 2389255066959711545),
+      UINT64_C(14305682972031144509), UINT64_C(14902806780118925117), UINT64_C(  918722034823091097), UINT64_C( 4789097735735455362),
+      UINT64_C(17816823667993852830), UINT64_C( 9885302154641836178), UINT64_C(11085606186919994360), UINT64_C(16425019566464105130),
+      UINT64_C( 2364850013778967584), UINT64_C( 4873651579070293290), UINT64_C( 9765182629028487379), UINT64_C(17800521332160885471),
+      UINT64_C( 3698196404398811043), UINT64_C( 6256889130682012487) };
+  static const uint64_t b = UINT64_C(15769233737910072313);
+  static const uint64_t e[] =
+    { UINT64_C( 1008290533211642240), UINT64_C( 3243700226314014725), UINT64_C( 1007289505931076231), UINT64_C( 3389346503553926541),
+      UINT64_C(12784598580573143417), UINT64_C( 3561564080386128149), UINT64_C(11015292362589236825), UINT64_C(14074486926259645043),
+      UINT64_C( 8249906625920522272), UINT64_C( 4765407540570927431), UINT64_C(17884060775884215950), UINT64_C( 9649365057328105180),
+      UINT64_C(15769233737910072313), UINT64_C(17774570183148652673), UINT64_C(10216908000095813451), UINT64_C( 1832855453301990533),
+      UINT64_C( 1307682788161143208), UINT64_C( 4069046164379138074), UINT64_C( 5342626804052592358), UINT64_C( 2027363596252796854),
+      UINT64_C( 5334659104447094373), UINT64_C(10493744109755073660), UINT64_C( 3700635614545750603), UINT64_C(11075018009314365219),
+      UINT64_C( 1240627992066986428), UINT64_C(10617267220435829788), UINT64_C(15769233737910072313), UINT64_C(14725425051252142734),
+      UINT64_C(11452919396804717129), UINT64_C( 5607471399601269749), UINT64_C(  213928077746533693), UINT64_C(15769233737910072313),
+      UINT64_C( 3759326185824079370), UINT64_C(10020020226477953082), UINT64_C( 6786517429051039672), UINT64_C( 2072142992791499531),
+      UINT64_C(12141375215584780042), UINT64_C(16951118210901078116), UINT64_C( 7789614787265549079), UINT64_C(  461600254189191480),
+      UINT64_C( 5306875218806968462), UINT64_C(11375030010579193534), UINT64_C( 8203715981933736716), UINT64_C( 9491375752855946933),
+      UINT64_C(10691867492306847796), UINT64_C(11769983451141594419), UINT64_C(15769233737910072313), UINT64_C( 1254047840570555119),
+      UINT64_C( 4519796581010696014), UINT64_C(15769233737910072313), UINT64_C(  720715694949347840), UINT64_C( 2389255066959711545),
+      UINT64_C(14305682972031144509), UINT64_C(14902806780118925117), UINT64_C(  918722034823091097), UINT64_C( 4789097735735455362),
+      UINT64_C(17816823667993852830), UINT64_C( 9885302154641836178), UINT64_C(11085606186919994360), UINT64_C(15769233737910072313),
+      UINT64_C( 2364850013778967584), UINT64_C( 4873651579070293290), UINT64_C( 9765182629028487379), UINT64_C(17800521332160885471),
+      UINT64_C( 3698196404398811043), UINT64_C( 6256889130682012487) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_n_u64_m(pv, av, b);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    ev = simde_svmin_n_u64_m(pv, av, b);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -851.28), SIMDE_FLOAT32_C(   677.81), SIMDE_FLOAT32_C(  -658.87), SIMDE_FLOAT32_C(    29.16),
+      SIMDE_FLOAT32_C(   182.44), SIMDE_FLOAT32_C(   303.01), SIMDE_FLOAT32_C(  -597.88), SIMDE_FLOAT32_C(  -500.14),
+      SIMDE_FLOAT32_C(  -913.36), SIMDE_FLOAT32_C(   651.60), SIMDE_FLOAT32_C(   366.17), SIMDE_FLOAT32_C(  -341.07),
+      SIMDE_FLOAT32_C(   627.56), SIMDE_FLOAT32_C(   870.15), SIMDE_FLOAT32_C(  -626.35), SIMDE_FLOAT32_C(   466.49),
+      SIMDE_FLOAT32_C(  -468.76), SIMDE_FLOAT32_C(   309.93), SIMDE_FLOAT32_C(  -497.63), SIMDE_FLOAT32_C(  -843.99),
+      SIMDE_FLOAT32_C(   152.44), SIMDE_FLOAT32_C(   786.62), SIMDE_FLOAT32_C(  -265.49), SIMDE_FLOAT32_C(    73.76),
+      SIMDE_FLOAT32_C(  -718.03), SIMDE_FLOAT32_C(   965.03), SIMDE_FLOAT32_C(   234.30), SIMDE_FLOAT32_C(   187.71),
+      SIMDE_FLOAT32_C(    51.31), SIMDE_FLOAT32_C(  -922.58), SIMDE_FLOAT32_C(  -343.96), SIMDE_FLOAT32_C(   200.03),
+      SIMDE_FLOAT32_C(   755.22), SIMDE_FLOAT32_C(    -2.83), SIMDE_FLOAT32_C(  -770.81), SIMDE_FLOAT32_C(   -62.34),
+      SIMDE_FLOAT32_C(  -699.82), SIMDE_FLOAT32_C(  -368.69), SIMDE_FLOAT32_C(   437.52), SIMDE_FLOAT32_C(  -613.18),
+      SIMDE_FLOAT32_C(  -717.09), SIMDE_FLOAT32_C(  -196.31), SIMDE_FLOAT32_C(    45.75), SIMDE_FLOAT32_C(   910.46),
+      SIMDE_FLOAT32_C(  -326.15), SIMDE_FLOAT32_C(   419.39), SIMDE_FLOAT32_C(   376.95), SIMDE_FLOAT32_C(   205.09),
+      SIMDE_FLOAT32_C(  -270.67), SIMDE_FLOAT32_C(   879.33), SIMDE_FLOAT32_C(   361.10), SIMDE_FLOAT32_C(   881.77),
+      SIMDE_FLOAT32_C(   665.94), SIMDE_FLOAT32_C(  -904.39), SIMDE_FLOAT32_C(   -44.47), SIMDE_FLOAT32_C(   947.91),
+      SIMDE_FLOAT32_C(  -939.36), SIMDE_FLOAT32_C(  -810.17), SIMDE_FLOAT32_C(   135.62), SIMDE_FLOAT32_C(   111.95),
+      SIMDE_FLOAT32_C(  -732.75), SIMDE_FLOAT32_C(   791.66), SIMDE_FLOAT32_C(  -688.03), SIMDE_FLOAT32_C(  -977.53),
+      SIMDE_FLOAT32_C(  -211.17), SIMDE_FLOAT32_C(  -458.84), SIMDE_FLOAT32_C(   -39.87), SIMDE_FLOAT32_C(    89.01),
+      SIMDE_FLOAT32_C(   172.47), SIMDE_FLOAT32_C(  -602.35), SIMDE_FLOAT32_C(   475.82), SIMDE_FLOAT32_C(   455.38),
+      SIMDE_FLOAT32_C(   201.35), SIMDE_FLOAT32_C(  -478.43), SIMDE_FLOAT32_C(   365.85), SIMDE_FLOAT32_C(   875.19),
+      SIMDE_FLOAT32_C(   940.97), SIMDE_FLOAT32_C(  -257.20), SIMDE_FLOAT32_C(    80.28), SIMDE_FLOAT32_C(  -329.71),
+      SIMDE_FLOAT32_C(  -377.87), SIMDE_FLOAT32_C(  -558.62), SIMDE_FLOAT32_C(  -447.94), SIMDE_FLOAT32_C(  -711.93),
+      SIMDE_FLOAT32_C(  -463.01), SIMDE_FLOAT32_C(   507.59), SIMDE_FLOAT32_C(  -764.02), SIMDE_FLOAT32_C(  -402.37),
+      SIMDE_FLOAT32_C(   697.43), SIMDE_FLOAT32_C(   371.60), SIMDE_FLOAT32_C(   709.57), SIMDE_FLOAT32_C(   964.68),
+      SIMDE_FLOAT32_C(   163.27), SIMDE_FLOAT32_C(  -978.45), SIMDE_FLOAT32_C(   987.15), SIMDE_FLOAT32_C(   952.10),
+      SIMDE_FLOAT32_C(  -437.29), SIMDE_FLOAT32_C(   -52.72), SIMDE_FLOAT32_C(    41.11), SIMDE_FLOAT32_C(   735.18),
+      SIMDE_FLOAT32_C(   344.94), SIMDE_FLOAT32_C(  -483.07), SIMDE_FLOAT32_C(   190.57), SIMDE_FLOAT32_C(  -453.71),
+      SIMDE_FLOAT32_C(    38.50), SIMDE_FLOAT32_C(  -443.59), SIMDE_FLOAT32_C(  -578.52), SIMDE_FLOAT32_C(   -20.53),
+      SIMDE_FLOAT32_C(   299.21), SIMDE_FLOAT32_C(   501.76), SIMDE_FLOAT32_C(   649.76), SIMDE_FLOAT32_C(   921.34),
+      SIMDE_FLOAT32_C(   943.14), SIMDE_FLOAT32_C(  -798.18), SIMDE_FLOAT32_C(  -790.59), SIMDE_FLOAT32_C(  -519.87),
+      SIMDE_FLOAT32_C(   709.41), SIMDE_FLOAT32_C(  -554.61), SIMDE_FLOAT32_C(    77.76), SIMDE_FLOAT32_C(   406.84),
+      SIMDE_FLOAT32_C(   816.99), SIMDE_FLOAT32_C(  -212.67), SIMDE_FLOAT32_C(   371.52), SIMDE_FLOAT32_C(   -19.74),
+      SIMDE_FLOAT32_C(  -191.12), SIMDE_FLOAT32_C(   358.67), SIMDE_FLOAT32_C(   -67.64), SIMDE_FLOAT32_C(   371.59),
+      SIMDE_FLOAT32_C(  -694.05), SIMDE_FLOAT32_C(   973.46), SIMDE_FLOAT32_C(   106.78), SIMDE_FLOAT32_C(   650.89),
+      SIMDE_FLOAT32_C(  -509.61), SIMDE_FLOAT32_C(  -702.66), SIMDE_FLOAT32_C(  -802.82), SIMDE_FLOAT32_C(   528.89),
+      SIMDE_FLOAT32_C(  -146.25), SIMDE_FLOAT32_C(  -381.35), SIMDE_FLOAT32_C(  -491.64), SIMDE_FLOAT32_C(  -847.04),
+      SIMDE_FLOAT32_C(  -879.59), SIMDE_FLOAT32_C(  -841.88), SIMDE_FLOAT32_C(  -925.70), SIMDE_FLOAT32_C(  -936.44),
+      SIMDE_FLOAT32_C(  -640.06), SIMDE_FLOAT32_C(  -716.28), SIMDE_FLOAT32_C(  -456.31), SIMDE_FLOAT32_C(  -930.64),
+      SIMDE_FLOAT32_C(  -270.89), SIMDE_FLOAT32_C(   621.45), SIMDE_FLOAT32_C(   476.20), SIMDE_FLOAT32_C(  -453.90),
+      SIMDE_FLOAT32_C(  -591.22), SIMDE_FLOAT32_C(  -152.29), SIMDE_FLOAT32_C(   526.36), SIMDE_FLOAT32_C(   217.66),
+      SIMDE_FLOAT32_C(  -793.62), SIMDE_FLOAT32_C(  -541.28), SIMDE_FLOAT32_C(  -410.75), SIMDE_FLOAT32_C(  -487.67),
+      SIMDE_FLOAT32_C(  -567.82), SIMDE_FLOAT32_C(   696.03), SIMDE_FLOAT32_C(  -836.77), SIMDE_FLOAT32_C(   -77.43),
+      SIMDE_FLOAT32_C(   993.37), SIMDE_FLOAT32_C(  -639.60), SIMDE_FLOAT32_C(  -548.54), SIMDE_FLOAT32_C(  -152.88),
+      SIMDE_FLOAT32_C(   -20.94), SIMDE_FLOAT32_C(   -40.18), SIMDE_FLOAT32_C(     0.09), SIMDE_FLOAT32_C(    99.47),
+      SIMDE_FLOAT32_C(   117.94), SIMDE_FLOAT32_C(    74.39), SIMDE_FLOAT32_C(   163.03), SIMDE_FLOAT32_C(   477.88),
+      SIMDE_FLOAT32_C(   358.11), SIMDE_FLOAT32_C(   706.71), SIMDE_FLOAT32_C(   547.24), SIMDE_FLOAT32_C(  -912.79),
+      SIMDE_FLOAT32_C(   328.16), SIMDE_FLOAT32_C(    23.43), SIMDE_FLOAT32_C(  -366.69), SIMDE_FLOAT32_C(   736.94),
+      SIMDE_FLOAT32_C(   871.15), SIMDE_FLOAT32_C(  -840.32), SIMDE_FLOAT32_C(   -45.40), SIMDE_FLOAT32_C(  -922.47),
+      SIMDE_FLOAT32_C(  -381.61), SIMDE_FLOAT32_C(   543.85), SIMDE_FLOAT32_C(  -410.13), SIMDE_FLOAT32_C(    50.57),
+      SIMDE_FLOAT32_C(   239.87), SIMDE_FLOAT32_C(  -246.91), SIMDE_FLOAT32_C(   973.14), SIMDE_FLOAT32_C(   233.24),
+      SIMDE_FLOAT32_C(   113.49), SIMDE_FLOAT32_C(  -575.40), SIMDE_FLOAT32_C(  -919.64), SIMDE_FLOAT32_C(  -907.45),
+      SIMDE_FLOAT32_C(   384.42), SIMDE_FLOAT32_C(    80.45), SIMDE_FLOAT32_C(   192.02), SIMDE_FLOAT32_C(  -497.64),
+      SIMDE_FLOAT32_C(  -845.16), SIMDE_FLOAT32_C(  -644.95), SIMDE_FLOAT32_C(   980.24), SIMDE_FLOAT32_C(   512.94),
+      SIMDE_FLOAT32_C(  -938.24), SIMDE_FLOAT32_C(   527.48), SIMDE_FLOAT32_C(   600.16), SIMDE_FLOAT32_C(   389.92),
+      SIMDE_FLOAT32_C(  -449.08), SIMDE_FLOAT32_C(  -766.53), SIMDE_FLOAT32_C(   126.85), SIMDE_FLOAT32_C(  -577.94),
+      SIMDE_FLOAT32_C(  -606.85), SIMDE_FLOAT32_C(  -918.55), SIMDE_FLOAT32_C(  -500.41), SIMDE_FLOAT32_C(    11.54),
+      SIMDE_FLOAT32_C(   625.30), SIMDE_FLOAT32_C(    89.46), SIMDE_FLOAT32_C(  -937.89), SIMDE_FLOAT32_C(  -134.83),
+      SIMDE_FLOAT32_C(   842.55), SIMDE_FLOAT32_C(  -964.75), SIMDE_FLOAT32_C(  -901.59), SIMDE_FLOAT32_C(   -43.96),
+      SIMDE_FLOAT32_C(  -540.15), SIMDE_FLOAT32_C(  -821.23) };
+  static const simde_float32 b = SIMDE_FLOAT32_C(    48.59);
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -658.87), SIMDE_FLOAT32_C(    29.16),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -597.88), SIMDE_FLOAT32_C(  -500.14),
+      SIMDE_FLOAT32_C(  -913.36), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -341.07),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -718.03), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -2.83), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -699.82), SIMDE_FLOAT32_C(  -368.69), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -613.18),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -196.31), SIMDE_FLOAT32_C(    45.75), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(  -326.15), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(  -270.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -904.39), SIMDE_FLOAT32_C(   -44.47), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -810.17), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(  -732.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -688.03), SIMDE_FLOAT32_C(  -977.53),
+      SIMDE_FLOAT32_C(  -211.17), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -602.35), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -478.43), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -257.20), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -329.71),
+      SIMDE_FLOAT32_C(  -377.87), SIMDE_FLOAT32_C(  -558.62), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -978.45), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(  -437.29), SIMDE_FLOAT32_C(   -52.72), SIMDE_FLOAT32_C(    41.11), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -453.71),
+      SIMDE_FLOAT32_C(    38.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -578.52), SIMDE_FLOAT32_C(   -20.53),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -790.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -554.61), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -212.67), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -191.12), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(   -67.64), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(  -694.05), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(  -509.61), SIMDE_FLOAT32_C(  -702.66), SIMDE_FLOAT32_C(  -802.82), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -146.25), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -491.64), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -841.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -716.28), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -453.90),
+      SIMDE_FLOAT32_C(  -591.22), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -541.28), SIMDE_FLOAT32_C(  -410.75), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -567.82), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -836.77), SIMDE_FLOAT32_C(   -77.43),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -639.60), SIMDE_FLOAT32_C(  -548.54), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(   -20.94), SIMDE_FLOAT32_C(   -40.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -366.69), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -45.40), SIMDE_FLOAT32_C(  -922.47),
+      SIMDE_FLOAT32_C(  -381.61), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -246.91), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -919.64), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(  -497.64),
+      SIMDE_FLOAT32_C(  -845.16), SIMDE_FLOAT32_C(  -644.95), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -938.24), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    48.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -766.53), SIMDE_FLOAT32_C(    48.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -606.85), SIMDE_FLOAT32_C(  -918.55), SIMDE_FLOAT32_C(  -500.41), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -134.83),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -901.59), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -540.15), SIMDE_FLOAT32_C(     0.00) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_n_f32_z(pv, av, b);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  b = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    ev = simde_svmin_n_f32_z(pv, av, b);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -705.67), SIMDE_FLOAT32_C(   328.00), SIMDE_FLOAT32_C(   368.21), SIMDE_FLOAT32_C(   167.20),
+      SIMDE_FLOAT32_C(    70.63), SIMDE_FLOAT32_C(   671.96), SIMDE_FLOAT32_C(  -501.21), SIMDE_FLOAT32_C(   826.81),
+      SIMDE_FLOAT32_C(   234.92), SIMDE_FLOAT32_C(   412.59), SIMDE_FLOAT32_C(  -260.60), SIMDE_FLOAT32_C(  -247.48),
+      SIMDE_FLOAT32_C(   574.25), SIMDE_FLOAT32_C(  -832.48), SIMDE_FLOAT32_C(   591.33), SIMDE_FLOAT32_C(   560.64),
+      SIMDE_FLOAT32_C(   678.38), SIMDE_FLOAT32_C(  -363.37), SIMDE_FLOAT32_C(  -969.91), SIMDE_FLOAT32_C(  -624.93),
+      SIMDE_FLOAT32_C(  -249.72), SIMDE_FLOAT32_C(   987.98), SIMDE_FLOAT32_C(   969.03), SIMDE_FLOAT32_C(   497.02),
+      SIMDE_FLOAT32_C(   309.32), SIMDE_FLOAT32_C(   667.29), SIMDE_FLOAT32_C(   767.76), SIMDE_FLOAT32_C(   -73.80),
+      SIMDE_FLOAT32_C(  -629.98), SIMDE_FLOAT32_C(  -922.56), SIMDE_FLOAT32_C(  -749.87), SIMDE_FLOAT32_C(  -335.66),
+      SIMDE_FLOAT32_C(   405.43), SIMDE_FLOAT32_C(   618.33), SIMDE_FLOAT32_C(   831.54), SIMDE_FLOAT32_C(  -523.93),
+      SIMDE_FLOAT32_C(   290.29), SIMDE_FLOAT32_C(  -669.67), SIMDE_FLOAT32_C(  -697.12), SIMDE_FLOAT32_C(  -474.79),
+      SIMDE_FLOAT32_C(   742.92), SIMDE_FLOAT32_C(    42.28), SIMDE_FLOAT32_C(   277.73), SIMDE_FLOAT32_C(   317.17),
+      SIMDE_FLOAT32_C(   209.80), SIMDE_FLOAT32_C(  -130.94), SIMDE_FLOAT32_C(  -122.19), SIMDE_FLOAT32_C(  -111.82),
+      SIMDE_FLOAT32_C(   505.70), SIMDE_FLOAT32_C(   -92.11), SIMDE_FLOAT32_C(   263.25), SIMDE_FLOAT32_C(  -744.03),
+      SIMDE_FLOAT32_C(  -104.13), SIMDE_FLOAT32_C(   232.28), SIMDE_FLOAT32_C(   753.00), SIMDE_FLOAT32_C(  -794.81),
+      SIMDE_FLOAT32_C(  -100.43), SIMDE_FLOAT32_C(   520.76), SIMDE_FLOAT32_C(   131.39), SIMDE_FLOAT32_C(   269.59),
+      SIMDE_FLOAT32_C(   598.19), SIMDE_FLOAT32_C(   381.52), SIMDE_FLOAT32_C(   933.93), SIMDE_FLOAT32_C(     3.63),
+      SIMDE_FLOAT32_C(    -0.15), SIMDE_FLOAT32_C(   765.47), SIMDE_FLOAT32_C(   479.69), SIMDE_FLOAT32_C(  -709.86),
+      SIMDE_FLOAT32_C(  -904.20), SIMDE_FLOAT32_C(   782.57), SIMDE_FLOAT32_C(  -184.66), SIMDE_FLOAT32_C(   838.72),
+      SIMDE_FLOAT32_C(  -175.14), SIMDE_FLOAT32_C(  -906.93), SIMDE_FLOAT32_C(   155.89), SIMDE_FLOAT32_C(  -965.34),
+      SIMDE_FLOAT32_C(   -37.87), SIMDE_FLOAT32_C(  -966.30), SIMDE_FLOAT32_C(   -77.17), SIMDE_FLOAT32_C(  -532.17),
+      SIMDE_FLOAT32_C(   -58.40), SIMDE_FLOAT32_C(  -813.92), SIMDE_FLOAT32_C(  -276.19), SIMDE_FLOAT32_C(   837.47),
+      SIMDE_FLOAT32_C(   418.36), SIMDE_FLOAT32_C(  -523.20), SIMDE_FLOAT32_C(  -957.34), SIMDE_FLOAT32_C(  -682.06),
+      SIMDE_FLOAT32_C(   997.56), SIMDE_FLOAT32_C(   174.05), SIMDE_FLOAT32_C(   587.52), SIMDE_FLOAT32_C(   595.76),
+      SIMDE_FLOAT32_C(  -444.43), SIMDE_FLOAT32_C(   521.45), SIMDE_FLOAT32_C(  -400.62), SIMDE_FLOAT32_C(   555.42),
+      SIMDE_FLOAT32_C(   286.92), SIMDE_FLOAT32_C(  -920.92), SIMDE_FLOAT32_C(   845.55), SIMDE_FLOAT32_C(   382.73),
+      SIMDE_FLOAT32_C(   861.65), SIMDE_FLOAT32_C(  -339.11), SIMDE_FLOAT32_C(   221.45), SIMDE_FLOAT32_C(  -313.50),
+      SIMDE_FLOAT32_C(  -246.03), SIMDE_FLOAT32_C(  -622.66), SIMDE_FLOAT32_C(  -278.84), SIMDE_FLOAT32_C(   716.10),
+      SIMDE_FLOAT32_C(  -588.95), SIMDE_FLOAT32_C(   643.99), SIMDE_FLOAT32_C(  -816.07), SIMDE_FLOAT32_C(   352.65),
+      SIMDE_FLOAT32_C(   830.08), SIMDE_FLOAT32_C(   -92.26), SIMDE_FLOAT32_C(   190.11), SIMDE_FLOAT32_C(   248.44),
+      SIMDE_FLOAT32_C(   384.54), SIMDE_FLOAT32_C(   232.78), SIMDE_FLOAT32_C(   566.38), SIMDE_FLOAT32_C(   382.11),
+      SIMDE_FLOAT32_C(  -593.17), SIMDE_FLOAT32_C(   153.90), SIMDE_FLOAT32_C(   -22.14), SIMDE_FLOAT32_C(   -37.61),
+      SIMDE_FLOAT32_C(  -324.65), SIMDE_FLOAT32_C(   577.25), SIMDE_FLOAT32_C(  -482.19), SIMDE_FLOAT32_C(   962.27),
+      SIMDE_FLOAT32_C(   656.32), SIMDE_FLOAT32_C(  -636.64), SIMDE_FLOAT32_C(   345.00), SIMDE_FLOAT32_C(   517.97),
+      SIMDE_FLOAT32_C(    24.26), SIMDE_FLOAT32_C(  -433.55), SIMDE_FLOAT32_C(  -795.53), SIMDE_FLOAT32_C(   778.23),
+      SIMDE_FLOAT32_C(   -56.21), SIMDE_FLOAT32_C(   -74.37), SIMDE_FLOAT32_C(   494.33), SIMDE_FLOAT32_C(   354.84),
+      SIMDE_FLOAT32_C(  -430.37), SIMDE_FLOAT32_C(   678.26), SIMDE_FLOAT32_C(  -292.52), SIMDE_FLOAT32_C(  -600.30),
+      SIMDE_FLOAT32_C(  -414.00), SIMDE_FLOAT32_C(   897.60), SIMDE_FLOAT32_C(   648.15), SIMDE_FLOAT32_C(   970.55),
+      SIMDE_FLOAT32_C(   130.37), SIMDE_FLOAT32_C(   214.52), SIMDE_FLOAT32_C(   352.65), SIMDE_FLOAT32_C(   537.20),
+      SIMDE_FLOAT32_C(  -631.58), SIMDE_FLOAT32_C(  -669.48), SIMDE_FLOAT32_C(  -500.40), SIMDE_FLOAT32_C(    43.77),
+      SIMDE_FLOAT32_C(   907.77), SIMDE_FLOAT32_C(    17.41), SIMDE_FLOAT32_C(     6.04), SIMDE_FLOAT32_C(   564.09),
+      SIMDE_FLOAT32_C(   380.77), SIMDE_FLOAT32_C(  -648.97), SIMDE_FLOAT32_C(    82.06), SIMDE_FLOAT32_C(  -594.97),
+      SIMDE_FLOAT32_C(   -82.52), SIMDE_FLOAT32_C(   286.54), SIMDE_FLOAT32_C(  -816.74), SIMDE_FLOAT32_C(   861.27),
+      SIMDE_FLOAT32_C(  -787.83), SIMDE_FLOAT32_C(   677.59), SIMDE_FLOAT32_C(   216.11), SIMDE_FLOAT32_C(  -218.20),
+      SIMDE_FLOAT32_C(   355.85), SIMDE_FLOAT32_C(   923.59), SIMDE_FLOAT32_C(   181.51), SIMDE_FLOAT32_C(   941.85),
+      SIMDE_FLOAT32_C(   821.19), SIMDE_FLOAT32_C(  -170.35), SIMDE_FLOAT32_C(   912.40), SIMDE_FLOAT32_C(   -48.44),
+      SIMDE_FLOAT32_C(  -955.83), SIMDE_FLOAT32_C(   265.05), SIMDE_FLOAT32_C(  -511.24), SIMDE_FLOAT32_C(  -587.41),
+      SIMDE_FLOAT32_C(   595.57), SIMDE_FLOAT32_C(   -11.64), SIMDE_FLOAT32_C(   456.36), SIMDE_FLOAT32_C(   503.34),
+      SIMDE_FLOAT32_C(  -994.23), SIMDE_FLOAT32_C(  -537.60), SIMDE_FLOAT32_C(    67.43), SIMDE_FLOAT32_C(   386.54),
+      SIMDE_FLOAT32_C(  -186.57), SIMDE_FLOAT32_C(  -850.50), SIMDE_FLOAT32_C(   791.57), SIMDE_FLOAT32_C(   730.91),
+      SIMDE_FLOAT32_C(   436.03), SIMDE_FLOAT32_C(   974.83), SIMDE_FLOAT32_C(   592.18), SIMDE_FLOAT32_C(   648.21),
+      SIMDE_FLOAT32_C(   652.41), SIMDE_FLOAT32_C(  -191.71), SIMDE_FLOAT32_C(  -569.99), SIMDE_FLOAT32_C(     8.26),
+      SIMDE_FLOAT32_C(  -268.12), SIMDE_FLOAT32_C(   611.52), SIMDE_FLOAT32_C(   -49.89), SIMDE_FLOAT32_C(  -446.93),
+      SIMDE_FLOAT32_C(  -558.83), SIMDE_FLOAT32_C(  -137.49), SIMDE_FLOAT32_C(   504.63), SIMDE_FLOAT32_C(  -514.66),
+      SIMDE_FLOAT32_C(  -872.43), SIMDE_FLOAT32_C(   993.40), SIMDE_FLOAT32_C(  -102.06), SIMDE_FLOAT32_C(   723.14),
+      SIMDE_FLOAT32_C(   -18.24), SIMDE_FLOAT32_C(  -645.70), SIMDE_FLOAT32_C(   226.48), SIMDE_FLOAT32_C(   -12.47),
+      SIMDE_FLOAT32_C(  -183.30), SIMDE_FLOAT32_C(  -706.09), SIMDE_FLOAT32_C(  -625.93), SIMDE_FLOAT32_C(   630.13),
+      SIMDE_FLOAT32_C(  -556.60), SIMDE_FLOAT32_C(  -834.36), SIMDE_FLOAT32_C(   361.05), SIMDE_FLOAT32_C(   879.44),
+      SIMDE_FLOAT32_C(  -859.54), SIMDE_FLOAT32_C(   -46.77), SIMDE_FLOAT32_C(   527.65), SIMDE_FLOAT32_C(   792.88),
+      SIMDE_FLOAT32_C(   761.52), SIMDE_FLOAT32_C(   957.66), SIMDE_FLOAT32_C(  -198.86), SIMDE_FLOAT32_C(  -506.59),
+      SIMDE_FLOAT32_C(   569.17), SIMDE_FLOAT32_C(   751.25), SIMDE_FLOAT32_C(    46.48), SIMDE_FLOAT32_C(  -989.66),
+      SIMDE_FLOAT32_C(  -386.23), SIMDE_FLOAT32_C(  -448.88), SIMDE_FLOAT32_C(  -504.32), SIMDE_FLOAT32_C(  -258.67),
+      SIMDE_FLOAT32_C(  -455.49), SIMDE_FLOAT32_C(   393.62) };
+  static const simde_float32 b = SIMDE_FLOAT32_C(  -535.53);
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  -705.67), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   368.21), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -501.21), SIMDE_FLOAT32_C(   826.81),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   412.59), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   574.25), SIMDE_FLOAT32_C(  -832.48), SIMDE_FLOAT32_C(   591.33), SIMDE_FLOAT32_C(   560.64),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -969.91), SIMDE_FLOAT32_C(  -624.93),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   497.02),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   767.76), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -629.98), SIMDE_FLOAT32_C(  -922.56), SIMDE_FLOAT32_C(  -749.87), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   405.43), SIMDE_FLOAT32_C(   618.33), SIMDE_FLOAT32_C(   831.54), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   290.29), SIMDE_FLOAT32_C(  -669.67), SIMDE_FLOAT32_C(  -697.12), SIMDE_FLOAT32_C(  -474.79),
+      SIMDE_FLOAT32_C(   742.92), SIMDE_FLOAT32_C(    42.28), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   317.17),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -122.19), SIMDE_FLOAT32_C(  -111.82),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -744.03),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   232.28), SIMDE_FLOAT32_C(   753.00), SIMDE_FLOAT32_C(  -794.81),
+      SIMDE_FLOAT32_C(  -100.43), SIMDE_FLOAT32_C(   520.76), SIMDE_FLOAT32_C(   131.39), SIMDE_FLOAT32_C(   269.59),
+      SIMDE_FLOAT32_C(   598.19), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   933.93), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(    -0.15), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   479.69), SIMDE_FLOAT32_C(  -709.86),
+      SIMDE_FLOAT32_C(  -904.20), SIMDE_FLOAT32_C(   782.57), SIMDE_FLOAT32_C(  -184.66), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -175.14), SIMDE_FLOAT32_C(  -906.93), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -965.34),
+      SIMDE_FLOAT32_C(   -37.87), SIMDE_FLOAT32_C(  -966.30), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -813.92), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   418.36), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -957.34), SIMDE_FLOAT32_C(  -682.06),
+      SIMDE_FLOAT32_C(   997.56), SIMDE_FLOAT32_C(   174.05), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -444.43), SIMDE_FLOAT32_C(   521.45), SIMDE_FLOAT32_C(  -400.62), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   286.92), SIMDE_FLOAT32_C(  -920.92), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   382.73),
+      SIMDE_FLOAT32_C(   861.65), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   221.45), SIMDE_FLOAT32_C(  -313.50),
+      SIMDE_FLOAT32_C(  -246.03), SIMDE_FLOAT32_C(  -622.66), SIMDE_FLOAT32_C(  -278.84), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -588.95), SIMDE_FLOAT32_C(   643.99), SIMDE_FLOAT32_C(  -816.07), SIMDE_FLOAT32_C(   352.65),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   248.44),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   382.11),
+      SIMDE_FLOAT32_C(  -593.17), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -482.19), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   656.32), SIMDE_FLOAT32_C(  -636.64), SIMDE_FLOAT32_C(   345.00), SIMDE_FLOAT32_C(   517.97),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -433.55), SIMDE_FLOAT32_C(  -795.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   -74.37), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   678.26), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -600.30),
+      SIMDE_FLOAT32_C(  -414.00), SIMDE_FLOAT32_C(   897.60), SIMDE_FLOAT32_C(   648.15), SIMDE_FLOAT32_C(   970.55),
+      SIMDE_FLOAT32_C(   130.37), SIMDE_FLOAT32_C(   214.52), SIMDE_FLOAT32_C(   352.65), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -631.58), SIMDE_FLOAT32_C(  -669.48), SIMDE_FLOAT32_C(  -500.40), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   907.77), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   564.09),
+      SIMDE_FLOAT32_C(   380.77), SIMDE_FLOAT32_C(  -648.97), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -594.97),
+      SIMDE_FLOAT32_C(   -82.52), SIMDE_FLOAT32_C(   286.54), SIMDE_FLOAT32_C(  -816.74), SIMDE_FLOAT32_C(   861.27),
+      SIMDE_FLOAT32_C(  -787.83), SIMDE_FLOAT32_C(   677.59), SIMDE_FLOAT32_C(   216.11), SIMDE_FLOAT32_C(  -218.20),
+      SIMDE_FLOAT32_C(   355.85), SIMDE_FLOAT32_C(   923.59), SIMDE_FLOAT32_C(   181.51), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -170.35), SIMDE_FLOAT32_C(   912.40), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -955.83), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -511.24), SIMDE_FLOAT32_C(  -587.41),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   -11.64), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -994.23), SIMDE_FLOAT32_C(  -537.60), SIMDE_FLOAT32_C(    67.43), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -186.57), SIMDE_FLOAT32_C(  -850.50), SIMDE_FLOAT32_C(   791.57), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   436.03), SIMDE_FLOAT32_C(   974.83), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   648.21),
+      SIMDE_FLOAT32_C(   652.41), SIMDE_FLOAT32_C(  -191.71), SIMDE_FLOAT32_C(  -569.99), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -268.12), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(   -49.89), SIMDE_FLOAT32_C(  -446.93),
+      SIMDE_FLOAT32_C(  -558.83), SIMDE_FLOAT32_C(  -137.49), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -514.66),
+      SIMDE_FLOAT32_C(  -872.43), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -102.06), SIMDE_FLOAT32_C(   723.14),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -645.70), SIMDE_FLOAT32_C(   226.48), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -706.09), SIMDE_FLOAT32_C(  -625.93), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -556.60), SIMDE_FLOAT32_C(  -834.36), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -859.54), SIMDE_FLOAT32_C(   -46.77), SIMDE_FLOAT32_C(   527.65), SIMDE_FLOAT32_C(   792.88),
+      SIMDE_FLOAT32_C(   761.52), SIMDE_FLOAT32_C(   957.66), SIMDE_FLOAT32_C(  -198.86), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(   569.17), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -989.66),
+      SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -448.88), SIMDE_FLOAT32_C(  -535.53), SIMDE_FLOAT32_C(  -535.53),
+      SIMDE_FLOAT32_C(  -455.49), SIMDE_FLOAT32_C(  -535.53) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmin_n_f32_m(pv, av, b);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+  b = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    ev = simde_svmin_n_f32_m(pv, av, b);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   631.78), SIMDE_FLOAT64_C(   122.88), SIMDE_FLOAT64_C(    42.64), SIMDE_FLOAT64_C(  -470.58),
+      SIMDE_FLOAT64_C(  -533.04), SIMDE_FLOAT64_C(   131.18), SIMDE_FLOAT64_C(   340.50), SIMDE_FLOAT64_C(   693.41),
+      SIMDE_FLOAT64_C(  -474.33), SIMDE_FLOAT64_C(   656.48), SIMDE_FLOAT64_C(   -41.39), SIMDE_FLOAT64_C(   246.03),
+      SIMDE_FLOAT64_C(    31.87), SIMDE_FLOAT64_C(   933.53), SIMDE_FLOAT64_C(  -331.12), SIMDE_FLOAT64_C(  -338.38),
+      SIMDE_FLOAT64_C(   -73.30), SIMDE_FLOAT64_C(   524.29), SIMDE_FLOAT64_C(  -895.99), SIMDE_FLOAT64_C(  -116.29),
+      SIMDE_FLOAT64_C(  -431.80), SIMDE_FLOAT64_C(   252.11), SIMDE_FLOAT64_C(   481.66), SIMDE_FLOAT64_C(   496.96),
+      SIMDE_FLOAT64_C(  -921.23), SIMDE_FLOAT64_C(  -873.77), SIMDE_FLOAT64_C(  -814.87), SIMDE_FLOAT64_C(  -503.38),
+      SIMDE_FLOAT64_C(  -229.27), SIMDE_FLOAT64_C(    16.72), SIMDE_FLOAT64_C(   151.54), SIMDE_FLOAT64_C(  -597.49),
+      SIMDE_FLOAT64_C(  -860.40), SIMDE_FLOAT64_C(  -805.81), SIMDE_FLOAT64_C(   -68.07), SIMDE_FLOAT64_C(  -393.44),
+      SIMDE_FLOAT64_C(   325.36), SIMDE_FLOAT64_C(  -727.58), SIMDE_FLOAT64_C(  -700.03), SIMDE_FLOAT64_C(   851.04),
+      SIMDE_FLOAT64_C(   928.90), SIMDE_FLOAT64_C(   258.58), SIMDE_FLOAT64_C(    97.06), SIMDE_FLOAT64_C(   -39.22),
+      SIMDE_FLOAT64_C(   192.11), SIMDE_FLOAT64_C(   765.95), SIMDE_FLOAT64_C(   622.39), SIMDE_FLOAT64_C(  -881.19),
+      SIMDE_FLOAT64_C(   290.24), SIMDE_FLOAT64_C(   726.41), SIMDE_FLOAT64_C(     2.52), SIMDE_FLOAT64_C(   858.44),
+      SIMDE_FLOAT64_C(   -21.48), SIMDE_FLOAT64_C(  -515.82), SIMDE_FLOAT64_C(   355.40), SIMDE_FLOAT64_C(    57.29),
+      SIMDE_FLOAT64_C(  -389.59), SIMDE_FLOAT64_C(   540.53), SIMDE_FLOAT64_C(   553.91), SIMDE_FLOAT64_C(   381.14),
+      SIMDE_FLOAT64_C(  -442.76), SIMDE_FLOAT64_C(  -294.55), SIMDE_FLOAT64_C(   783.65), SIMDE_FLOAT64_C(  -303.16),
+      SIMDE_FLOAT64_C(  -100.37), SIMDE_FLOAT64_C(  -284.42), SIMDE_FLOAT64_C(   303.40), SIMDE_FLOAT64_C(  -775.00),
+      SIMDE_FLOAT64_C(   -12.00), SIMDE_FLOAT64_C(   603.37), SIMDE_FLOAT64_C(  -923.97), SIMDE_FLOAT64_C(   -83.10),
+      SIMDE_FLOAT64_C(  -138.05), SIMDE_FLOAT64_C(   173.10), SIMDE_FLOAT64_C(   877.68), SIMDE_FLOAT64_C(  -945.94),
+      SIMDE_FLOAT64_C(   -60.96), SIMDE_FLOAT64_C(   500.07), SIMDE_FLOAT64_C(  -827.13), SIMDE_FLOAT64_C(  -770.72),
+      SIMDE_FLOAT64_C(   226.48), SIMDE_FLOAT64_C(   175.38), SIMDE_FLOAT64_C(  -912.28), SIMDE_FLOAT64_C(  -795.00),
+      SIMDE_FLOAT64_C(   659.56), SIMDE_FLOAT64_C(   443.12), SIMDE_FLOAT64_C(   262.29), SIMDE_FLOAT64_C(  -730.03),
+      SIMDE_FLOAT64_C(   -16.35), SIMDE_FLOAT64_C(  -183.81), SIMDE_FLOAT64_C(   651.11), SIMDE_FLOAT64_C(   540.89),
+      SIMDE_FLOAT64_C(   521.64), SIMDE_FLOAT64_C(   434.77), SIMDE_FLOAT64_C(  -762.27), SIMDE_FLOAT64_C(  -578.72),
+      SIMDE_FLOAT64_C(  -849.66), SIMDE_FLOAT64_C(   541.13), SIMDE_FLOAT64_C(  -353.73), SIMDE_FLOAT64_C(   138.35),
+      SIMDE_FLOAT64_C(   144.50), SIMDE_FLOAT64_C(  -277.69), SIMDE_FLOAT64_C(  -944.75), SIMDE_FLOAT64_C(  -993.55),
+      SIMDE_FLOAT64_C(   895.41), SIMDE_FLOAT64_C(   932.93), SIMDE_FLOAT64_C(  -939.49), SIMDE_FLOAT64_C(  -165.55),
+      SIMDE_FLOAT64_C(   433.00), SIMDE_FLOAT64_C(  -766.62), SIMDE_FLOAT64_C(    63.73), SIMDE_FLOAT64_C(  -340.52) };
+  static const simde_float64 b = SIMDE_FLOAT64_C(   408.77);
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   122.88), SIMDE_FLOAT64_C(    42.64), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -533.04), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   340.50), SIMDE_FLOAT64_C(   408.77),
+      SIMDE_FLOAT64_C(  -474.33), SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   246.03),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   -73.30), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -895.99), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -431.80), SIMDE_FLOAT64_C(   252.11), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -921.23), SIMDE_FLOAT64_C(  -873.77), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -597.49),
+      SIMDE_FLOAT64_C(  -860.40), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -68.07), SIMDE_FLOAT64_C(  -393.44),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -700.03), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(   258.58), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   192.11), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   290.24), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     2.52), SIMDE_FLOAT64_C(   408.77),
+      SIMDE_FLOAT64_C(   -21.48), SIMDE_FLOAT64_C(  -515.82), SIMDE_FLOAT64_C(   355.40), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -294.55), SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   303.40), SIMDE_FLOAT64_C(  -775.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -83.10),
+      SIMDE_FLOAT64_C(  -138.05), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(  -827.13), SIMDE_FLOAT64_C(  -770.72),
+      SIMDE_FLOAT64_C(   226.48), SIMDE_FLOAT64_C(   175.38), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -795.00),
+      SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   262.29), SIMDE_FLOAT64_C(  -730.03),
+      SIMDE_FLOAT64_C(   -16.35), SIMDE_FLOAT64_C(  -183.81), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   408.77),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -762.27), SIMDE_FLOAT64_C(  -578.72),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   138.35),
+      SIMDE_FLOAT64_C(   144.50), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -944.75), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   408.77), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -165.55),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    63.73), SIMDE_FLOAT64_C(     0.00) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_n_f64_z(pv, av, b);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  b = simde_test_codegen_random_f64(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    ev = simde_svmin_n_f64_z(pv, av, b);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmin_n_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(  -816.90), SIMDE_FLOAT64_C(   430.01), SIMDE_FLOAT64_C(   385.88), SIMDE_FLOAT64_C(  -913.22),
+      SIMDE_FLOAT64_C(  -120.08), SIMDE_FLOAT64_C(  -143.79), SIMDE_FLOAT64_C(  -627.07), SIMDE_FLOAT64_C(  -984.22),
+      SIMDE_FLOAT64_C(   982.84), SIMDE_FLOAT64_C(  -951.46), SIMDE_FLOAT64_C(   443.38), SIMDE_FLOAT64_C(  -751.28),
+      SIMDE_FLOAT64_C(  -871.48), SIMDE_FLOAT64_C(   923.06), SIMDE_FLOAT64_C(  -179.35), SIMDE_FLOAT64_C(   338.81),
+      SIMDE_FLOAT64_C(  -726.10), SIMDE_FLOAT64_C(   367.33), SIMDE_FLOAT64_C(   134.23), SIMDE_FLOAT64_C(  -592.99),
+      SIMDE_FLOAT64_C(   878.45), SIMDE_FLOAT64_C(   -71.64), SIMDE_FLOAT64_C(   827.88), SIMDE_FLOAT64_C(  -383.75),
+      SIMDE_FLOAT64_C(  -978.70), SIMDE_FLOAT64_C(   111.12), SIMDE_FLOAT64_C(   664.73), SIMDE_FLOAT64_C(   911.58),
+      SIMDE_FLOAT64_C(   971.63), SIMDE_FLOAT64_C(  -507.15), SIMDE_FLOAT64_C(   888.09), SIMDE_FLOAT64_C(  -845.27),
+      SIMDE_FLOAT64_C(   922.85), SIMDE_FLOAT64_C(   273.97), SIMDE_FLOAT64_C(  -758.49), SIMDE_FLOAT64_C(  -197.22),
+      SIMDE_FLOAT64_C(  -869.82), SIMDE_FLOAT64_C(  -385.56), SIMDE_FLOAT64_C(  -181.44), SIMDE_FLOAT64_C(  -886.98),
+      SIMDE_FLOAT64_C(  -337.03), SIMDE_FLOAT64_C(  -738.07), SIMDE_FLOAT64_C(  -638.27), SIMDE_FLOAT64_C(  -208.51),
+      SIMDE_FLOAT64_C(  -815.00), SIMDE_FLOAT64_C(   182.38), SIMDE_FLOAT64_C(  -869.70), SIMDE_FLOAT64_C(  -541.11),
+      SIMDE_FLOAT64_C(  -450.29), SIMDE_FLOAT64_C(   264.53), SIMDE_FLOAT64_C(  -134.09), SIMDE_FLOAT64_C(  -571.85),
+      SIMDE_FLOAT64_C(  -807.11), SIMDE_FLOAT64_C(  -306.22), SIMDE_FLOAT64_C(    44.41), SIMDE_FLOAT64_C(  -785.81),
+      SIMDE_FLOAT64_C(   804.91), SIMDE_FLOAT64_C(  -290.87), SIMDE_FLOAT64_C(  -874.22), SIMDE_FLOAT64_C(   776.54),
+      SIMDE_FLOAT64_C(   201.98), SIMDE_FLOAT64_C(  -986.14), SIMDE_FLOAT64_C(   931.27), SIMDE_FLOAT64_C(   124.83),
+      SIMDE_FLOAT64_C(   287.83), SIMDE_FLOAT64_C(  -827.22), SIMDE_FLOAT64_C(   927.61), SIMDE_FLOAT64_C(   418.01),
+      SIMDE_FLOAT64_C(  -212.78), SIMDE_FLOAT64_C(  -253.83), SIMDE_FLOAT64_C(   531.02), SIMDE_FLOAT64_C(   450.20),
+      SIMDE_FLOAT64_C(     8.10), SIMDE_FLOAT64_C(   892.76), SIMDE_FLOAT64_C(  -758.31), SIMDE_FLOAT64_C(   193.10),
+      SIMDE_FLOAT64_C(    75.14), SIMDE_FLOAT64_C(  -628.01), SIMDE_FLOAT64_C(   651.99), SIMDE_FLOAT64_C(   624.85),
+      SIMDE_FLOAT64_C(   636.52), SIMDE_FLOAT64_C(  -482.10), SIMDE_FLOAT64_C(  -947.00), SIMDE_FLOAT64_C(   829.41),
+      SIMDE_FLOAT64_C(   211.68), SIMDE_FLOAT64_C(    97.41), SIMDE_FLOAT64_C(  -956.39), SIMDE_FLOAT64_C(    16.59),
+      SIMDE_FLOAT64_C(   806.54), SIMDE_FLOAT64_C(  -830.62), SIMDE_FLOAT64_C(  -206.87), SIMDE_FLOAT64_C(     8.52),
+      SIMDE_FLOAT64_C(  -816.75), SIMDE_FLOAT64_C(  -275.60), SIMDE_FLOAT64_C(  -866.65), SIMDE_FLOAT64_C(   471.08),
+      SIMDE_FLOAT64_C(  -102.82), SIMDE_FLOAT64_C(  -939.04), SIMDE_FLOAT64_C(  -110.91), SIMDE_FLOAT64_C(   684.40),
+      SIMDE_FLOAT64_C(  -192.87), SIMDE_FLOAT64_C(  -579.88), SIMDE_FLOAT64_C(   134.60), SIMDE_FLOAT64_C(   815.23),
+      SIMDE_FLOAT64_C(  -687.13), SIMDE_FLOAT64_C(   376.29), SIMDE_FLOAT64_C(     8.33), SIMDE_FLOAT64_C(   388.01),
+      SIMDE_FLOAT64_C(   748.27), SIMDE_FLOAT64_C(  -339.68), SIMDE_FLOAT64_C(    12.85), SIMDE_FLOAT64_C(   384.79),
+      SIMDE_FLOAT64_C(   178.22), SIMDE_FLOAT64_C(    65.85), SIMDE_FLOAT64_C(   214.20), SIMDE_FLOAT64_C(  -610.10),
+      SIMDE_FLOAT64_C(  -836.74), SIMDE_FLOAT64_C(   257.81), SIMDE_FLOAT64_C(   406.49), SIMDE_FLOAT64_C(   969.80),
+      SIMDE_FLOAT64_C(   427.19), SIMDE_FLOAT64_C(  -800.38), SIMDE_FLOAT64_C(   -21.68), SIMDE_FLOAT64_C(   610.44),
+      SIMDE_FLOAT64_C(   -75.99) };
+  static const simde_float64 b = SIMDE_FLOAT64_C(   111.67);
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(  -816.90), SIMDE_FLOAT64_C(   430.01), SIMDE_FLOAT64_C(   385.88), SIMDE_FLOAT64_C(  -913.22),
+      SIMDE_FLOAT64_C(  -120.08), SIMDE_FLOAT64_C(  -143.79), SIMDE_FLOAT64_C(  -627.07), SIMDE_FLOAT64_C(  -984.22),
+      SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -951.46), SIMDE_FLOAT64_C(   443.38), SIMDE_FLOAT64_C(  -751.28),
+      SIMDE_FLOAT64_C(  -871.48), SIMDE_FLOAT64_C(   923.06), SIMDE_FLOAT64_C(  -179.35), SIMDE_FLOAT64_C(   338.81),
+      SIMDE_FLOAT64_C(  -726.10), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -592.99),
+      SIMDE_FLOAT64_C(   878.45), SIMDE_FLOAT64_C(   -71.64), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -383.75),
+      SIMDE_FLOAT64_C(  -978.70), SIMDE_FLOAT64_C(   111.12), SIMDE_FLOAT64_C(   664.73), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(   971.63), SIMDE_FLOAT64_C(  -507.15), SIMDE_FLOAT64_C(   888.09), SIMDE_FLOAT64_C(  -845.27),
+      SIMDE_FLOAT64_C(   922.85), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -758.49), SIMDE_FLOAT64_C(  -197.22),
+      SIMDE_FLOAT64_C(  -869.82), SIMDE_FLOAT64_C(  -385.56), SIMDE_FLOAT64_C(  -181.44), SIMDE_FLOAT64_C(  -886.98),
+      SIMDE_FLOAT64_C(  -337.03), SIMDE_FLOAT64_C(  -738.07), SIMDE_FLOAT64_C(  -638.27), SIMDE_FLOAT64_C(  -208.51),
+      SIMDE_FLOAT64_C(  -815.00), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -869.70), SIMDE_FLOAT64_C(  -541.11),
+      SIMDE_FLOAT64_C(  -450.29), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -134.09), SIMDE_FLOAT64_C(  -571.85),
+      SIMDE_FLOAT64_C(  -807.11), SIMDE_FLOAT64_C(  -306.22), SIMDE_FLOAT64_C(    44.41), SIMDE_FLOAT64_C(  -785.81),
+      SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -290.87), SIMDE_FLOAT64_C(  -874.22), SIMDE_FLOAT64_C(   776.54),
+      SIMDE_FLOAT64_C(   201.98), SIMDE_FLOAT64_C(  -986.14), SIMDE_FLOAT64_C(   931.27), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -827.22), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(   418.01),
+      SIMDE_FLOAT64_C(  -212.78), SIMDE_FLOAT64_C(  -253.83), SIMDE_FLOAT64_C(   531.02), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(     8.10), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -758.31), SIMDE_FLOAT64_C(   193.10),
+      SIMDE_FLOAT64_C(    75.14), SIMDE_FLOAT64_C(  -628.01), SIMDE_FLOAT64_C(   651.99), SIMDE_FLOAT64_C(   624.85),
+      SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -482.10), SIMDE_FLOAT64_C(  -947.00), SIMDE_FLOAT64_C(   829.41),
+      SIMDE_FLOAT64_C(   211.68), SIMDE_FLOAT64_C(    97.41), SIMDE_FLOAT64_C(  -956.39), SIMDE_FLOAT64_C(    16.59),
+      SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(  -830.62), SIMDE_FLOAT64_C(  -206.87), SIMDE_FLOAT64_C(     8.52),
+      SIMDE_FLOAT64_C(  -816.75), SIMDE_FLOAT64_C(  -275.60), SIMDE_FLOAT64_C(  -866.65), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(  -102.82), SIMDE_FLOAT64_C(  -939.04), SIMDE_FLOAT64_C(  -110.91), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(  -192.87), SIMDE_FLOAT64_C(  -579.88), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(  -687.13), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(     8.33), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(   748.27), SIMDE_FLOAT64_C(  -339.68), SIMDE_FLOAT64_C(    12.85), SIMDE_FLOAT64_C(   384.79),
+      SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(    65.85), SIMDE_FLOAT64_C(   214.20), SIMDE_FLOAT64_C(  -610.10),
+      SIMDE_FLOAT64_C(  -836.74), SIMDE_FLOAT64_C(   257.81), SIMDE_FLOAT64_C(   111.67), SIMDE_FLOAT64_C(   969.80),
+      SIMDE_FLOAT64_C(   427.19), SIMDE_FLOAT64_C(  -800.38), SIMDE_FLOAT64_C(   -21.68), SIMDE_FLOAT64_C(   111.67),
+      SIMDE_FLOAT64_C(   -75.99) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmin_n_f64_m(pv, av, b);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+  b = simde_test_codegen_random_f64(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    ev = simde_svmin_n_f64_m(pv, av, b);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_f64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmin_n_f64_m)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
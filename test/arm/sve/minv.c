@@ -0,0 +1,1575 @@
+#define SIMDE_TEST_ARM_SVE_INSN minv
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/minv.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+
+static int
+test_simde_svminv_s8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) };
+  static const int8_t a[] =
+    { -INT8_C(  96), -INT8_C(  64), -INT8_C(  92),  INT8_C(  63),  INT8_C(  71), -INT8_C( 120),  INT8_C(  19),  INT8_C(  47),
+      -INT8_C(  41),  INT8_C(  98), -INT8_C(  97), -INT8_C(  27),  INT8_C(   5),  INT8_C(  28), -INT8_C( 102), -INT8_C(  40),
+      -INT8_C(  22),  INT8_C(  32),  INT8_C( 120),  INT8_C(  33),  INT8_C(  88), -INT8_C( 111), -INT8_C(  95), -INT8_C(  19),
+      -INT8_C( 122),      INT8_MAX, -INT8_C(  79),  INT8_C(  86), -INT8_C( 119), -INT8_C(   8), -INT8_C(  37),  INT8_C(  41),
+      -INT8_C(  72),      INT8_MAX,  INT8_C( 104),  INT8_C(   0),  INT8_C(   7),  INT8_C( 124),  INT8_C(  47), -INT8_C(  33),
+      -INT8_C(  34), -INT8_C(  50), -INT8_C(  60), -INT8_C(  29), -INT8_C(  21),  INT8_C(  94), -INT8_C(  68), -INT8_C(  43),
+       INT8_C( 126),  INT8_C(  52), -INT8_C(   9), -INT8_C(  42), -INT8_C(  59), -INT8_C( 104), -INT8_C(  61),  INT8_C(  75),
+       INT8_C(  23),  INT8_C( 117), -INT8_C(  95), -INT8_C(  96),  INT8_C( 109),  INT8_C( 124), -INT8_C(  54),  INT8_C(  37),
+      -INT8_C(   4),  INT8_C(  50),  INT8_C(  37),  INT8_C(   3), -INT8_C(  82),  INT8_C(  84), -INT8_C(  30), -INT8_C( 115),
+       INT8_C(  35), -INT8_C(  90),  INT8_C( 112),  INT8_C(  14),  INT8_C(   4),  INT8_C(  44), -INT8_C(  29), -INT8_C( 125),
+       INT8_C(  96), -INT8_C(  38),  INT8_C(  89),  INT8_C(  38),  INT8_C( 115),  INT8_C(  29),  INT8_C( 113), -INT8_C( 118),
+      -INT8_C( 110),  INT8_C(  19),  INT8_C(  43), -INT8_C(   1), -INT8_C( 113), -INT8_C(  11),  INT8_C(  36), -INT8_C( 117),
+       INT8_C(  39),  INT8_C(  74), -INT8_C( 113), -INT8_C(  42), -INT8_C(  98),  INT8_C( 113),  INT8_C(  99), -INT8_C(  63),
+       INT8_C(  24), -INT8_C(  45), -INT8_C(  49),  INT8_C(  28),  INT8_C(   0), -INT8_C(  77), -INT8_C(  97),  INT8_C(  96),
+      -INT8_C( 115), -INT8_C(   7), -INT8_C( 122),  INT8_C(   0),  INT8_C(  22), -INT8_C(   8), -INT8_C( 117), -INT8_C(  88),
+       INT8_C(  11), -INT8_C(  74), -INT8_C(  89), -INT8_C( 102), -INT8_C(  85), -INT8_C(  53),  INT8_C(  38), -INT8_C(  46),
+       INT8_C(  21), -INT8_C(  75), -INT8_C(  88), -INT8_C(  76),  INT8_C(  38),  INT8_C(  11),  INT8_C( 117),  INT8_C(  62),
+      -INT8_C(  33),  INT8_C(  69),  INT8_C(  91), -INT8_C(  33), -INT8_C(   8), -INT8_C(   6),  INT8_C(  63), -INT8_C( 123),
+      -INT8_C(  13), -INT8_C(  58), -INT8_C( 122),  INT8_C(   9), -INT8_C(  66),  INT8_C(  17), -INT8_C(  79), -INT8_C(  55),
+      -INT8_C(  57),  INT8_C(  88),  INT8_C(  99),  INT8_C( 114),  INT8_C(  36), -INT8_C( 119),  INT8_C(  68),  INT8_C(  57),
+       INT8_C(  62), -INT8_C(  19), -INT8_C(  19),  INT8_C( 101), -INT8_C(   8),  INT8_C(  99), -INT8_C(  93), -INT8_C(  41),
+      -INT8_C(  88), -INT8_C(   2), -INT8_C(  74), -INT8_C(  96), -INT8_C(   7), -INT8_C(  10),  INT8_C(  37), -INT8_C(  20),
+      -INT8_C(  68), -INT8_C(  85), -INT8_C(  10),  INT8_C( 122), -INT8_C(  68), -INT8_C(  89),  INT8_C(  67), -INT8_C( 125),
+       INT8_C(   0), -INT8_C(  90), -INT8_C(  11),  INT8_C(  36),  INT8_C(  48),  INT8_C(  58),  INT8_C(  93),  INT8_C( 110),
+       INT8_C(  39),  INT8_C(  75), -INT8_C(  45),  INT8_C(  31), -INT8_C(  82),  INT8_C( 119), -INT8_C(   9),  INT8_C(  86),
+       INT8_C( 117), -INT8_C(  83), -INT8_C(  10),  INT8_C( 110), -INT8_C(  93),  INT8_C(  27),  INT8_C(  91),  INT8_C(  95),
+      -INT8_C(  57),  INT8_C(  81), -INT8_C(  39), -INT8_C( 125), -INT8_C(   8),  INT8_C(  28),  INT8_C(   7), -INT8_C(   8),
+      -INT8_C(  61), -INT8_C(   4),  INT8_C(  28), -INT8_C(  13),  INT8_C(  54),  INT8_C( 122),  INT8_C(  97),  INT8_C(  93),
+      -INT8_C(  59),  INT8_C(  53),  INT8_C( 125),  INT8_C( 115), -INT8_C(  84),  INT8_C( 116), -INT8_C(  55),  INT8_C(  33),
+       INT8_C(  33), -INT8_C(  65), -INT8_C( 112), -INT8_C(  59), -INT8_C(  38), -INT8_C(  21),  INT8_C(  36), -INT8_C(  95),
+       INT8_C(  60), -INT8_C(   2),  INT8_C(  37),  INT8_C(  52),  INT8_C(  26),  INT8_C(  44),  INT8_C(  45), -INT8_C(  35),
+       INT8_C(  40),  INT8_C(  73), -INT8_C(  48),  INT8_C(  95), -INT8_C(  61),  INT8_C(  50), -INT8_C(  68), -INT8_C( 120),
+       INT8_C( 103),  INT8_C(  57), -INT8_C(   5),  INT8_C(  19), -INT8_C(  83), -INT8_C(  60),  INT8_C(  52), -INT8_C(  49),
+      -INT8_C( 125), -INT8_C(  60), -INT8_C( 108),  INT8_C(  94), -INT8_C(  81), -INT8_C(  72), -INT8_C(   1), -INT8_C(  21),
+      -INT8_C(  74),  INT8_C(  36),  INT8_C(  32), -INT8_C(  47),  INT8_C(  80),  INT8_C(  77), -INT8_C(  82),  INT8_C( 121),
+      -INT8_C( 106),      INT8_MAX, -INT8_C(  40),  INT8_C(  90), -INT8_C(  79), -INT8_C( 108), -INT8_C(  30),  INT8_C(  24),
+      -INT8_C(  50), -INT8_C(  34),  INT8_C(  43),  INT8_C( 123), -INT8_C(  94),  INT8_C(  95),  INT8_C(  74),  INT8_C(  38),
+       INT8_C(  36), -INT8_C(  34), -INT8_C( 124), -INT8_C(  45), -INT8_C( 105), -INT8_C( 125), -INT8_C(  65),  INT8_C(  77),
+      -INT8_C(  88), -INT8_C(  33),  INT8_C(  30), -INT8_C(   8),  INT8_C(  44), -INT8_C(  51),  INT8_C( 113), -INT8_C(  62),
+       INT8_C(  76),  INT8_C(  73),  INT8_C(  28), -INT8_C(   3), -INT8_C(  34), -INT8_C(   1),  INT8_C(  21), -INT8_C(  84),
+      -INT8_C(  35),  INT8_C(  64),  INT8_C(  39),      INT8_MAX, -INT8_C(  97),  INT8_C( 114), -INT8_C(  91), -INT8_C(  61),
+       INT8_C(  80),  INT8_C(  41), -INT8_C( 105), -INT8_C(  25), -INT8_C(  83),  INT8_C(  86),  INT8_C(  53),  INT8_C(  85),
+       INT8_C(  53),  INT8_C(  83),  INT8_C(  77),  INT8_C(  97),  INT8_C(  32), -INT8_C(  65),  INT8_C(  35),  INT8_C( 108),
+       INT8_C(   8),  INT8_C(  64),  INT8_C( 105), -INT8_C(  26),  INT8_C(  63),  INT8_C( 126), -INT8_C( 110),  INT8_C(  28),
+      -INT8_C(  66), -INT8_C(  70), -INT8_C( 101),  INT8_C(  94),  INT8_C(  44),  INT8_C(  65),  INT8_C(  33),  INT8_C( 124),
+       INT8_C( 106), -INT8_C(  72),  INT8_C( 100),  INT8_C(  23),  INT8_C(  14), -INT8_C( 103),  INT8_C( 108),  INT8_C(  67),
+      -INT8_C(  20), -INT8_C(  70), -INT8_C(  92),  INT8_C(  13),  INT8_C( 121), -INT8_C(  56),  INT8_C( 121), -INT8_C( 127),
+       INT8_C(   8), -INT8_C(  29),  INT8_C( 104),  INT8_C(  71),  INT8_C(  97), -INT8_C(   6),  INT8_C(  99),  INT8_C(  32),
+      -INT8_C(  76), -INT8_C(   2),  INT8_C( 126), -INT8_C(  32),  INT8_C(  63), -INT8_C(  97),  INT8_C(  93), -INT8_C(  86),
+       INT8_C(  88), -INT8_C(  63), -INT8_C(  63),  INT8_C( 102),  INT8_C(  90),  INT8_C(  46), -INT8_C(  86),  INT8_C(  70),
+      -INT8_C(  24),  INT8_C(  78),  INT8_C(  83),  INT8_C(  97),  INT8_C(  22), -INT8_C(  51), -INT8_C(  30),  INT8_C(  30),
+      -INT8_C(  80),  INT8_C(  74),  INT8_C( 101),  INT8_C(  17),  INT8_C(  69), -INT8_C(  56),  INT8_C(  49), -INT8_C(   7),
+      -INT8_C(  57), -INT8_C(  81), -INT8_C(  38),  INT8_C(   6),  INT8_C(  79),  INT8_C(  55), -INT8_C(  80), -INT8_C(  89),
+      -INT8_C(   8),  INT8_C( 114),  INT8_C(  13),  INT8_C(  82), -INT8_C(  96), -INT8_C(  73), -INT8_C( 104), -INT8_C( 120),
+       INT8_C(   6), -INT8_C(  20), -INT8_C(  23),  INT8_C(  28), -INT8_C(  71), -INT8_C(  53),  INT8_C(  59),  INT8_C( 105),
+       INT8_C(  22), -INT8_C(  96),  INT8_C( 122),  INT8_C(  91),  INT8_C( 105), -INT8_C(  84),  INT8_C(  84),  INT8_C(  48),
+       INT8_C(  91),  INT8_C(  46),  INT8_C(  54), -INT8_C(  86),  INT8_C( 101), -INT8_C(  25),  INT8_C(  81),  INT8_C(  93),
+       INT8_C(  89),  INT8_C(  95), -INT8_C(  81), -INT8_C(   7),  INT8_C(  22),  INT8_C(  72), -INT8_C( 127),  INT8_C(  28),
+       INT8_C(  52),  INT8_C( 106),  INT8_C(  57), -INT8_C(  19),  INT8_C(  53),  INT8_C( 116),  INT8_C(  86),  INT8_C(  75),
+       INT8_C(  20), -INT8_C(  48), -INT8_C(  90),  INT8_C( 125),  INT8_C( 124), -INT8_C(   5), -INT8_C(  83), -INT8_C(  40),
+       INT8_C(  41), -INT8_C(  28), -INT8_C( 126), -INT8_C( 113), -INT8_C(  53), -INT8_C(  44), -INT8_C(  20),  INT8_C(  36),
+       INT8_C(  51), -INT8_C( 100),  INT8_C(  29),  INT8_C(  73), -INT8_C(  28), -INT8_C(  98),  INT8_C( 102),  INT8_C(  24),
+       INT8_C(   8), -INT8_C(  97),  INT8_C(   5),  INT8_C(  61),  INT8_C(  19),  INT8_C(  91), -INT8_C( 119),  INT8_C(  39),
+       INT8_C(  43),  INT8_C(  47), -INT8_C(  91), -INT8_C(  88),  INT8_C(  42),  INT8_C(  82),      INT8_MIN,  INT8_C(  84),
+       INT8_C(  54),  INT8_C(   2), -INT8_C(  29),  INT8_C(   1), -INT8_C(  42), -INT8_C(  49),  INT8_C(  37),  INT8_C(   9),
+       INT8_C( 107),  INT8_C(  66),  INT8_C(  83),  INT8_C(  79), -INT8_C(  32), -INT8_C(  71),  INT8_C( 103), -INT8_C(  24),
+       INT8_C(  88),  INT8_C( 108),  INT8_C(  38),  INT8_C( 107), -INT8_C(  57), -INT8_C(  81), -INT8_C( 110), -INT8_C(  13),
+      -INT8_C(  34),  INT8_C(  55), -INT8_C( 101),  INT8_C(   9), -INT8_C( 118),  INT8_C(  27),  INT8_C(  93), -INT8_C(  64),
+       INT8_C(  29),  INT8_C(  64), -INT8_C(  62), -INT8_C(  12),  INT8_C(  15), -INT8_C(  25), -INT8_C(   3),  INT8_C( 123),
+       INT8_C(  42),  INT8_C(  80), -INT8_C(  54),  INT8_C(  10),  INT8_C(   9),  INT8_C(  50), -INT8_C(  13),  INT8_C(  97),
+      -INT8_C(  98),  INT8_C(  25), -INT8_C(  52),  INT8_C( 102), -INT8_C(  56),  INT8_C(  95),  INT8_C(  89), -INT8_C(  90),
+      -INT8_C( 106), -INT8_C(  12), -INT8_C(  81),  INT8_C(  32),  INT8_C(  15),  INT8_C(  12), -INT8_C(  31),  INT8_C(  44),
+       INT8_C(  76), -INT8_C(  93),  INT8_C(  32),  INT8_C(  92), -INT8_C( 118),  INT8_C(  30), -INT8_C(  41), -INT8_C(  76),
+       INT8_C( 110), -INT8_C(  95), -INT8_C(  65),  INT8_C( 120), -INT8_C(  45), -INT8_C(  78), -INT8_C(  39),  INT8_C( 114),
+      -INT8_C(  53), -INT8_C(  90), -INT8_C(  40), -INT8_C( 109),  INT8_C(   5),  INT8_C(  49),  INT8_C(  57), -INT8_C( 101),
+       INT8_C(  37), -INT8_C(  23), -INT8_C(  68),  INT8_C(  52), -INT8_C(  11), -INT8_C(  99),  INT8_C(  96),  INT8_C(  66),
+       INT8_C(  64), -INT8_C( 127), -INT8_C(  98), -INT8_C(  54), -INT8_C(  97),  INT8_C( 117),      INT8_MAX,  INT8_C(  13),
+       INT8_C(  22),  INT8_C(  62), -INT8_C( 123), -INT8_C(  22), -INT8_C(  16),  INT8_C(  95),  INT8_C(  92), -INT8_C(  69),
+       INT8_C(   5),  INT8_C(  52),  INT8_C(  78),  INT8_C(  10),  INT8_C( 101), -INT8_C( 121), -INT8_C(  91), -INT8_C( 118),
+       INT8_C( 112),  INT8_C(  97), -INT8_C(  66),  INT8_C( 102), -INT8_C(   2),  INT8_C(  30), -INT8_C(  88),  INT8_C(  62),
+      -INT8_C(  97),  INT8_C(  70),  INT8_C(   9),  INT8_C(  62), -INT8_C(  69), -INT8_C( 120),  INT8_C(  76), -INT8_C(  47),
+      -INT8_C(  58), -INT8_C(  47), -INT8_C(  69), -INT8_C(  74),  INT8_C(  48),  INT8_C(  23),  INT8_C( 113),  INT8_C(  53),
+       INT8_C(  75), -INT8_C(  65),  INT8_C(  63), -INT8_C(  80),  INT8_C(  70), -INT8_C(  27),  INT8_C(  58), -INT8_C(  73),
+       INT8_C(  70), -INT8_C(   8),  INT8_C(  29),  INT8_C(  69),  INT8_C(  23), -INT8_C(  59), -INT8_C( 125), -INT8_C(  74) };
+  static const int8_t e =      INT8_MIN;
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int8_t r = INT8_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    int8_t v = simde_svminv_s8(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_i8(e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024];
+  int8_t e = INT8_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    int8_t v = simde_svminv_s8(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1) };
+  static const int16_t a[] =
+    { -INT16_C( 24703), -INT16_C( 23983), -INT16_C( 20888), -INT16_C( 27259), -INT16_C(  9725), -INT16_C( 32542),  INT16_C( 12508), -INT16_C(  8666),
+      -INT16_C( 22963), -INT16_C(  1998),  INT16_C(  7119), -INT16_C(  6444), -INT16_C( 15263), -INT16_C( 20178), -INT16_C( 21433), -INT16_C( 14100),
+       INT16_C( 15691), -INT16_C( 19606), -INT16_C(  4116), -INT16_C(  4280),  INT16_C( 10953), -INT16_C( 22929), -INT16_C( 27302), -INT16_C( 22396),
+      -INT16_C( 18884),  INT16_C(  2976),  INT16_C( 29906),  INT16_C( 13297),  INT16_C(  8248),  INT16_C( 32741), -INT16_C( 11828),  INT16_C(  5959),
+      -INT16_C( 19953), -INT16_C(  1078),  INT16_C(  4769),  INT16_C( 27626),  INT16_C( 22844), -INT16_C( 26863), -INT16_C( 27154),  INT16_C( 10815),
+      -INT16_C(  8373),  INT16_C(  7478),  INT16_C( 10067), -INT16_C( 29615),  INT16_C( 13895),  INT16_C(  4875),  INT16_C( 21255),  INT16_C(  5674),
+      -INT16_C(  3067), -INT16_C( 23023), -INT16_C(  1274),  INT16_C( 17169),  INT16_C(  8788),  INT16_C( 17370),  INT16_C(  6583),  INT16_C(   877),
+      -INT16_C( 23560),  INT16_C( 19232),  INT16_C( 29131),  INT16_C(  4823), -INT16_C(  7257), -INT16_C( 20698),  INT16_C( 20534),  INT16_C( 15301),
+      -INT16_C( 10427),  INT16_C( 19425), -INT16_C(  3118),  INT16_C( 10126),  INT16_C( 26645), -INT16_C( 12950), -INT16_C( 10367),  INT16_C( 31184),
+      -INT16_C(  3973),  INT16_C( 18117), -INT16_C( 25502),  INT16_C(  2392),  INT16_C( 32383), -INT16_C( 19016),  INT16_C( 32463),  INT16_C(  5360),
+      -INT16_C( 11691),  INT16_C( 10079), -INT16_C(  4411), -INT16_C(  9650), -INT16_C( 18346), -INT16_C( 10073),  INT16_C( 30608),  INT16_C(  2897),
+       INT16_C(  5736), -INT16_C( 13743), -INT16_C( 22093),  INT16_C( 13011), -INT16_C( 29656), -INT16_C(  2072), -INT16_C( 10230),  INT16_C( 24331),
+       INT16_C( 27306),  INT16_C( 28550), -INT16_C( 10920), -INT16_C( 20662), -INT16_C(  3699),  INT16_C(  7559), -INT16_C( 10135), -INT16_C( 11992),
+       INT16_C( 31215), -INT16_C( 23909),  INT16_C( 28195),  INT16_C( 19412), -INT16_C( 17158),  INT16_C(  1090),  INT16_C( 19861),  INT16_C( 16227),
+      -INT16_C(  5449),  INT16_C(  4271), -INT16_C(  1601),  INT16_C( 19647),  INT16_C( 18154),  INT16_C( 21354), -INT16_C( 28130),  INT16_C(  3364),
+      -INT16_C( 16628),  INT16_C( 12207), -INT16_C( 31698),  INT16_C( 10362), -INT16_C( 17344), -INT16_C( 10963), -INT16_C( 28663), -INT16_C( 16363),
+      -INT16_C( 15238),  INT16_C( 14800), -INT16_C( 28739), -INT16_C( 22650), -INT16_C(  3883), -INT16_C(  2821),  INT16_C(  8066), -INT16_C( 29183),
+      -INT16_C( 20001),  INT16_C(  3517),  INT16_C( 14133),  INT16_C( 30005),  INT16_C( 25331), -INT16_C(   949),  INT16_C( 24819),  INT16_C( 28093),
+      -INT16_C( 29404), -INT16_C(  7769),  INT16_C( 11549), -INT16_C(  3448), -INT16_C( 31971), -INT16_C( 24602), -INT16_C(  5981), -INT16_C( 32210),
+      -INT16_C(  5223), -INT16_C( 12657), -INT16_C( 15325),  INT16_C(  5699), -INT16_C( 29145),  INT16_C(  6675), -INT16_C( 12050),  INT16_C(  4743),
+       INT16_C( 11869),  INT16_C( 31475),  INT16_C( 31835),  INT16_C( 30829),  INT16_C( 21503), -INT16_C( 24040),  INT16_C( 17979), -INT16_C( 11228),
+      -INT16_C( 19663),  INT16_C( 21666), -INT16_C(  6536), -INT16_C( 24725),  INT16_C( 32372),  INT16_C( 25529),  INT16_C( 16462), -INT16_C( 21643),
+       INT16_C( 26991), -INT16_C( 13786), -INT16_C( 27675), -INT16_C(  7101),  INT16_C( 23526),  INT16_C(  8839), -INT16_C( 21599), -INT16_C( 11530),
+      -INT16_C( 26273), -INT16_C( 10457), -INT16_C( 28033), -INT16_C(  3210),  INT16_C( 12048),  INT16_C( 24150), -INT16_C( 13201), -INT16_C(  8695),
+       INT16_C( 12085),  INT16_C(  6825), -INT16_C(  4926), -INT16_C( 22018), -INT16_C( 31417), -INT16_C(  5941), -INT16_C( 16079), -INT16_C( 28486),
+      -INT16_C(  7846), -INT16_C(  9881), -INT16_C(  8845), -INT16_C( 31795),  INT16_C(  8972),  INT16_C( 31713), -INT16_C(  5137),  INT16_C(  9306),
+       INT16_C(   794), -INT16_C(  8898),  INT16_C( 15855),  INT16_C( 13958),  INT16_C( 20930), -INT16_C(  3298), -INT16_C( 10222),  INT16_C( 28035),
+      -INT16_C(  5446),  INT16_C( 11590),  INT16_C(  5063), -INT16_C( 11343), -INT16_C( 28105),  INT16_C(  9807), -INT16_C( 22147), -INT16_C( 26549),
+      -INT16_C( 30292), -INT16_C( 25739), -INT16_C(  1082), -INT16_C( 30255), -INT16_C(  4276),  INT16_C( 24188),  INT16_C(   199), -INT16_C( 32309),
+       INT16_C(  4842), -INT16_C( 19793),  INT16_C( 24613),  INT16_C( 23685), -INT16_C( 11022),  INT16_C( 28803), -INT16_C( 12675),  INT16_C( 10504),
+       INT16_C( 32087),  INT16_C(  7876), -INT16_C( 27272), -INT16_C( 15193),  INT16_C(  9092),  INT16_C( 19490), -INT16_C(  4573),  INT16_C(  3789),
+       INT16_C( 31744),  INT16_C(  9664),  INT16_C( 17884), -INT16_C( 12414),  INT16_C(  1306), -INT16_C( 26817),  INT16_C( 18387),  INT16_C( 10945),
+      -INT16_C( 31292),  INT16_C( 15432), -INT16_C(  4325), -INT16_C( 24832),  INT16_C(  8723),  INT16_C( 14059), -INT16_C( 18160),  INT16_C(  4164),
+       INT16_C(  1077),  INT16_C(  4662), -INT16_C( 18358),  INT16_C( 25825),  INT16_C(  8381), -INT16_C( 28421), -INT16_C( 17305),  INT16_C( 11194),
+       INT16_C(   834),  INT16_C( 23911),  INT16_C( 26610),  INT16_C(  1532), -INT16_C(  6007), -INT16_C( 26052), -INT16_C( 32607), -INT16_C( 10582),
+      -INT16_C(  8059), -INT16_C( 12312), -INT16_C( 13928),  INT16_C( 21811),  INT16_C( 12009),  INT16_C( 20709), -INT16_C( 24341),  INT16_C( 11643),
+      -INT16_C(  7517), -INT16_C( 27254), -INT16_C( 31159), -INT16_C( 11365), -INT16_C( 10386),  INT16_C(  3949),  INT16_C(  5975), -INT16_C(  8986),
+      -INT16_C( 12552), -INT16_C( 28501), -INT16_C(  8552), -INT16_C( 32282), -INT16_C( 13555), -INT16_C(  1838),  INT16_C( 19819),  INT16_C(  3621),
+      -INT16_C( 20688),  INT16_C( 31140),  INT16_C( 16181), -INT16_C( 23476), -INT16_C( 18154),  INT16_C( 28083), -INT16_C( 26159), -INT16_C( 14006),
+      -INT16_C(  2712),  INT16_C(    89),  INT16_C( 16340), -INT16_C(  7807),  INT16_C( 21259),  INT16_C( 30425), -INT16_C(   351), -INT16_C( 11899),
+       INT16_C( 10669), -INT16_C(  7606), -INT16_C( 26776),  INT16_C( 32390),  INT16_C( 14928),  INT16_C(  8683),  INT16_C( 13779),  INT16_C( 15338),
+       INT16_C( 17451), -INT16_C(   197), -INT16_C( 17021), -INT16_C( 28960), -INT16_C( 18160), -INT16_C( 20219), -INT16_C( 30025),  INT16_C( 25730),
+      -INT16_C( 12877),  INT16_C(  6982), -INT16_C( 12956), -INT16_C( 19303), -INT16_C( 31737), -INT16_C(  9514), -INT16_C( 16198), -INT16_C(  6890),
+       INT16_C( 20740), -INT16_C( 30492), -INT16_C( 15346),  INT16_C(  7958),  INT16_C(  7037),  INT16_C( 13520),  INT16_C( 21413),  INT16_C( 22680),
+      -INT16_C(  8672), -INT16_C( 31629),  INT16_C(  3243), -INT16_C( 19912),  INT16_C(  3729),  INT16_C( 19341), -INT16_C( 23601), -INT16_C( 11472),
+       INT16_C(  5364),  INT16_C(   859),  INT16_C( 29400),  INT16_C( 21794), -INT16_C(  3443),  INT16_C( 13193),  INT16_C(  8517),  INT16_C( 25995),
+      -INT16_C(     1), -INT16_C( 21527),  INT16_C(  8715), -INT16_C( 25507), -INT16_C(  5584), -INT16_C(    25),  INT16_C(  6029), -INT16_C( 32045),
+       INT16_C( 11819),  INT16_C(   901), -INT16_C( 22624),  INT16_C( 11864), -INT16_C(  7783), -INT16_C(  8351), -INT16_C(  5118),  INT16_C(   580),
+       INT16_C( 12011), -INT16_C(  2131),  INT16_C(  2640), -INT16_C( 32621),  INT16_C( 31733), -INT16_C( 32128),  INT16_C( 21394), -INT16_C( 16892),
+      -INT16_C( 30335),  INT16_C(  8897),  INT16_C(  6704), -INT16_C( 13744), -INT16_C( 19973), -INT16_C(   343), -INT16_C(  4707), -INT16_C( 30464),
+      -INT16_C( 21221),  INT16_C( 27520),  INT16_C(  5047), -INT16_C( 21268),  INT16_C( 27790),  INT16_C(  8495),  INT16_C( 13247),  INT16_C( 16607),
+      -INT16_C( 24387), -INT16_C(  4766), -INT16_C( 19782), -INT16_C( 18761),  INT16_C( 24675),  INT16_C(   436), -INT16_C( 19378),  INT16_C( 27018),
+       INT16_C(  2657),  INT16_C(  6357), -INT16_C( 16099), -INT16_C( 21307), -INT16_C(  3027), -INT16_C(  4915), -INT16_C( 21465), -INT16_C(  7124),
+      -INT16_C( 28852),  INT16_C(  2002), -INT16_C( 30399), -INT16_C( 23107),  INT16_C( 29162),  INT16_C( 14502),  INT16_C( 12325), -INT16_C( 31071),
+       INT16_C( 30266),  INT16_C( 22430),  INT16_C( 25399),  INT16_C( 25603), -INT16_C( 12201),  INT16_C( 32592),  INT16_C( 32124), -INT16_C( 13981),
+       INT16_C( 13580),  INT16_C( 19920), -INT16_C( 29249), -INT16_C( 22030), -INT16_C( 26370),  INT16_C(  9185), -INT16_C( 32056),  INT16_C(   681),
+       INT16_C( 18425),  INT16_C( 12378),  INT16_C( 23979),  INT16_C(   661), -INT16_C(  6866), -INT16_C( 21887), -INT16_C(  6814),  INT16_C( 28275),
+       INT16_C( 17178), -INT16_C(  9796), -INT16_C( 20784), -INT16_C( 12670),  INT16_C( 25415),  INT16_C(  4081), -INT16_C( 25882), -INT16_C(  8430),
+       INT16_C( 27874), -INT16_C( 29425), -INT16_C( 23351), -INT16_C(  2161),  INT16_C(  4490), -INT16_C(  4958),  INT16_C(  5622),  INT16_C(  4187),
+       INT16_C(  5977),  INT16_C( 10730),  INT16_C( 27845),  INT16_C(  3320), -INT16_C(  5680), -INT16_C( 18916),  INT16_C( 11908),  INT16_C( 26261),
+      -INT16_C( 23398),  INT16_C( 25587) };
+  static const int16_t e = -INT16_C( 32621);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int16_t r = INT16_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    int16_t v = simde_svminv_s16(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_i16(e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)];
+  int16_t e = INT16_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    int16_t v = simde_svminv_s16(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const int32_t a[] =
+    { -INT32_C(    32383777),  INT32_C(  1162068454), -INT32_C(  1510210601),  INT32_C(  1813555861), -INT32_C(  1001575873), -INT32_C(   354648857),  INT32_C(  1364394044), -INT32_C(   365028853),
+      -INT32_C(   588754954), -INT32_C(   417256432), -INT32_C(   997384913),  INT32_C(   120628680), -INT32_C(  1228112177),  INT32_C(   933275898), -INT32_C(  1266092887),  INT32_C(    77514254),
+       INT32_C(   652314133), -INT32_C(   519241038), -INT32_C(   391800288),  INT32_C(   250598975),  INT32_C(  1321581396),  INT32_C(   226846052),  INT32_C(  1740705113), -INT32_C(   378773549),
+      -INT32_C(  1743827483),  INT32_C(  1870208079), -INT32_C(   162062409),  INT32_C(  1225082869),  INT32_C(  1721223682), -INT32_C(  1988944593), -INT32_C(    17812438),  INT32_C(  2045205651),
+      -INT32_C(   116263255), -INT32_C(   915895790), -INT32_C(  1631534935),  INT32_C(   166184199), -INT32_C(  1099923569), -INT32_C(   968367204), -INT32_C(  1413203944),  INT32_C(  1042590612),
+      -INT32_C(  1271450207),  INT32_C(  1769840576),  INT32_C(  1711816031), -INT32_C(  1854869758),  INT32_C(   173072494), -INT32_C(   607021117),  INT32_C(  1686607311), -INT32_C(   492655807),
+      -INT32_C(  1583949343), -INT32_C(   670428040),  INT32_C(  1413354065),  INT32_C(  1894100482),  INT32_C(  1383806350), -INT32_C(  1674752819),  INT32_C(   570471649),  INT32_C(  1090888288),
+      -INT32_C(   186475653),  INT32_C(    30207151),  INT32_C(    22350591),  INT32_C(  1198602937),  INT32_C(  1033497712),  INT32_C(   450479928), -INT32_C(   616768901), -INT32_C(   132365956),
+      -INT32_C(  1930625315), -INT32_C(   359810837),  INT32_C(  2079056578), -INT32_C(  1916576739), -INT32_C(  2117444535), -INT32_C(  1617190109), -INT32_C(    92612483), -INT32_C(   151873767),
+      -INT32_C(  2138841451),  INT32_C(  1483346070),  INT32_C(   282351091), -INT32_C(    73558094),  INT32_C(   394029043), -INT32_C(  2001332214),  INT32_C(   159527152),  INT32_C(  1560310983),
+      -INT32_C(   388136110), -INT32_C(  2042607469),  INT32_C(  1335235741), -INT32_C(  1622527061), -INT32_C(  1514748006), -INT32_C(   819106593),  INT32_C(  1691922332),  INT32_C(  1975638051),
+      -INT32_C(   279077285), -INT32_C(  2072666650),  INT32_C(  1574112434), -INT32_C(   621011393), -INT32_C(   998264091), -INT32_C(  1147950050),  INT32_C(  2115988315), -INT32_C(  1611407292),
+       INT32_C(  1703825534), -INT32_C(  1612118803),  INT32_C(  1342028816), -INT32_C(  1087768102), -INT32_C(   897341268), -INT32_C(  1350232492), -INT32_C(   970087294),  INT32_C(    56959108),
+       INT32_C(  1583936624),  INT32_C(   150819320), -INT32_C(   396887539), -INT32_C(  1599634956),  INT32_C(  2120887081), -INT32_C(  1020399551),  INT32_C(   428432276), -INT32_C(   333648005),
+      -INT32_C(   615873309), -INT32_C(   488421419),  INT32_C(   919222850), -INT32_C(   438930757), -INT32_C(   563920739), -INT32_C(   979202000),  INT32_C(  1742613483), -INT32_C(    44828134),
+       INT32_C(  1406705022),  INT32_C(   641055716), -INT32_C(  1319370506),  INT32_C(   261501554), -INT32_C(  1544685197),  INT32_C(  1969786762), -INT32_C(   706984261), -INT32_C(  1093456064),
+      -INT32_C(  1324241972),  INT32_C(  1574389607), -INT32_C(  1190251449), -INT32_C(   641161882),  INT32_C(   679327134),  INT32_C(    10413381),  INT32_C(  1825929772),  INT32_C(  1982572714),
+      -INT32_C(  1155056556), -INT32_C(   904331389), -INT32_C(  1719458253),  INT32_C(  1785940939),  INT32_C(  1184034817),  INT32_C(    21377237),  INT32_C(  1433279403),  INT32_C(   415996356),
+       INT32_C(  1507062741),  INT32_C(   623111154), -INT32_C(   574707951), -INT32_C(   213437966), -INT32_C(   147203807), -INT32_C(  1242005750),  INT32_C(  1594517147), -INT32_C(   713566721),
+      -INT32_C(  1171371320),  INT32_C(  1189040437), -INT32_C(   349987080), -INT32_C(   237081905),  INT32_C(  1323833412),  INT32_C(   839114903),  INT32_C(  1183911239), -INT32_C(  1424291614),
+      -INT32_C(  2023405230), -INT32_C(  1815198309), -INT32_C(  1300303389), -INT32_C(  1599906468),  INT32_C(   216959861), -INT32_C(  1287655060), -INT32_C(   520498946),  INT32_C(   730535385),
+      -INT32_C(   105647778),  INT32_C(   428704054), -INT32_C(   825554062), -INT32_C(   579965080),  INT32_C(  1726635258),  INT32_C(  1259940173), -INT32_C(   768863239), -INT32_C(  2030127320),
+      -INT32_C(   561991256), -INT32_C(  1527313102), -INT32_C(  2123119848),  INT32_C(   744415538), -INT32_C(  1953281986),  INT32_C(  1809296497), -INT32_C(   415431745),  INT32_C(  1668168634),
+       INT32_C(   507637484),  INT32_C(   331561467),  INT32_C(   781465340),  INT32_C(  1432023831), -INT32_C(  1377702597),  INT32_C(  1494792346),  INT32_C(  1967216059),  INT32_C(  2111352721),
+      -INT32_C(  1734600035),  INT32_C(  1336631123), -INT32_C(  1401077611),  INT32_C(  1845679923),  INT32_C(  1595663301),  INT32_C(  1454912411),  INT32_C(   449575305),  INT32_C(  1167565992),
+       INT32_C(   299709374),  INT32_C(   660638098), -INT32_C(    53158455),  INT32_C(  2037044916),  INT32_C(  1423476409),  INT32_C(  1118474681),  INT32_C(   861697418), -INT32_C(   679939047),
+      -INT32_C(  1159178713), -INT32_C(  1461630753), -INT32_C(   626739931),  INT32_C(  1146293899),  INT32_C(  1318595732),  INT32_C(  1200636605), -INT32_C(   780472904),  INT32_C(   145355745),
+       INT32_C(   683839817), -INT32_C(     3103526), -INT32_C(   438733735),  INT32_C(   388574594),  INT32_C(   375767641), -INT32_C(  1134693116), -INT32_C(  1014048542),  INT32_C(   348927947),
+      -INT32_C(  1573089592), -INT32_C(  1935537102),  INT32_C(    40991616),  INT32_C(    18455208),  INT32_C(  1628929628),  INT32_C(  1444771188),  INT32_C(   404400973), -INT32_C(  1423120670) };
+  static const int32_t e = -INT32_C(  2138841451);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int32_t r = INT32_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    int32_t v = simde_svminv_s32(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_i32(e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)];
+  int32_t e = INT32_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    int32_t v = simde_svminv_s32(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0) };
+  static const int64_t a[] =
+    {  INT64_C( 8006837957896212626), -INT64_C( 2390004342317189141), -INT64_C( 9052143852539641266),  INT64_C( 6831092899764212799),
+       INT64_C( 4295829657480876154),  INT64_C( 8459645932443477970), -INT64_C( 7144905432353338826),  INT64_C( 6985118092914523078),
+       INT64_C( 6411765252736527471), -INT64_C( 4256385920562767022), -INT64_C( 5167050498337226671),  INT64_C( 3112896350116290029),
+       INT64_C( 4451218805056323814),  INT64_C( 4545720738068735682),  INT64_C( 1084866280381296484),  INT64_C( 8699852299429894357),
+       INT64_C( 5908346196055075030), -INT64_C( 4864813007359593393),  INT64_C( 8509305896937089510), -INT64_C( 1908747723179820424),
+       INT64_C( 6867043924681582188), -INT64_C( 8472369703373968040),  INT64_C( 1628800711914585730), -INT64_C( 3343744165641936477),
+       INT64_C( 4357260003150413577), -INT64_C( 5821930365607209722),  INT64_C( 1408621108962510551),  INT64_C( 6360593744085298446),
+       INT64_C( 3512220752700052125), -INT64_C( 2676248676059665921),  INT64_C( 3051149286530133972),  INT64_C( 1815483345390149001),
+      -INT64_C( 8335785171637066762),  INT64_C( 1071175263275461376), -INT64_C( 7815248345629053629),  INT64_C(  169902086936078534),
+       INT64_C( 5501556293017793856), -INT64_C( 1519915779115511137), -INT64_C( 6127477265119233447),  INT64_C( 4614861403863147260),
+       INT64_C( 4743811730269613628), -INT64_C( 6194416165522299783),  INT64_C( 2507382554836685629),  INT64_C( 4369958388758198373),
+      -INT64_C( 7906181188547136924), -INT64_C( 6648795857129676098),  INT64_C( 3483412039249217294),  INT64_C( 2055113368147427913),
+      -INT64_C( 6658173046502569235),  INT64_C( 1573282418712005580),  INT64_C( 8300029844310890804), -INT64_C( 1370992044381780700),
+       INT64_C( 5914225240421112716),  INT64_C( 7418089611232331479),  INT64_C(  184530890937154802),  INT64_C( 1821380101416045402),
+      -INT64_C( 7148727987040863757), -INT64_C( 7278823430714470813),  INT64_C( 5802966144502882728),  INT64_C( 3546567381170677649),
+      -INT64_C( 4500656926523473623),  INT64_C( 1730598795295982531), -INT64_C( 7855642236906718284), -INT64_C( 4684050832336771698),
+      -INT64_C( 2321546113893750615),  INT64_C( 2720541899986968377),  INT64_C( 1485567228669615881), -INT64_C( 2250709965635236240),
+      -INT64_C( 2412890749874507897),  INT64_C( 2694920708911779279),  INT64_C( 8161591255167350440), -INT64_C( 8488941136202292198),
+      -INT64_C( 7553749575649126232), -INT64_C( 6647806749613444227), -INT64_C( 3105771002440520332),  INT64_C( 4451340480661511225),
+       INT64_C( 2436365640341844847),  INT64_C( 6415229120845358952),  INT64_C( 2879124996642232678), -INT64_C( 2314241694727202288),
+      -INT64_C( 8438929719091041251),  INT64_C( 8920492959408758157),  INT64_C( 6765972678762011087), -INT64_C( 8071888203394430806),
+      -INT64_C( 8864435403209305776), -INT64_C( 5881487945965835825),  INT64_C( 3892324542989466714),  INT64_C( 4222769969685857945),
+      -INT64_C( 1380732495654557093), -INT64_C( 1793222593087419248),  INT64_C( 8281999703576316205), -INT64_C( 1820554265702350696),
+      -INT64_C( 6986755314305964031) };
+  static const int64_t e = -INT64_C( 8864435403209305776);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  int64_t r = INT64_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    int64_t v = simde_svminv_s64(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_i64(e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)];
+  int64_t e = INT64_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    int64_t v = simde_svminv_s64(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_u8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C(247), UINT8_C( 50), UINT8_C( 50), UINT8_C( 34), UINT8_C(169), UINT8_C(115), UINT8_C(157), UINT8_C(144),
+      UINT8_C( 37), UINT8_C(143), UINT8_C(181), UINT8_C(232), UINT8_C(214), UINT8_C(  6), UINT8_C( 22), UINT8_C(119),
+      UINT8_C(126), UINT8_C( 48), UINT8_C(215), UINT8_C(104), UINT8_C( 71), UINT8_C(173), UINT8_C( 69), UINT8_C(113),
+      UINT8_C( 25), UINT8_C( 78), UINT8_C( 64), UINT8_C( 53), UINT8_C( 89), UINT8_C(191), UINT8_C(227), UINT8_C( 80),
+      UINT8_C(241), UINT8_C( 21), UINT8_C(114), UINT8_C(154), UINT8_C(136), UINT8_C( 15), UINT8_C( 42), UINT8_C(174),
+      UINT8_C(159), UINT8_C(224), UINT8_C(150), UINT8_C(117), UINT8_C(230), UINT8_C(172), UINT8_C(236), UINT8_C(100),
+      UINT8_C(220), UINT8_C(195), UINT8_C(204), UINT8_C( 35), UINT8_C(112), UINT8_C( 17), UINT8_C(148), UINT8_C(137),
+      UINT8_C( 95), UINT8_C(213), UINT8_C(190), UINT8_C(185), UINT8_C(148), UINT8_C(161), UINT8_C(  9), UINT8_C(133),
+      UINT8_C(183), UINT8_C(124), UINT8_C( 31), UINT8_C( 63), UINT8_C(139), UINT8_C( 74), UINT8_C(237), UINT8_C( 42),
+      UINT8_C( 42), UINT8_C(131), UINT8_C(159), UINT8_C( 16), UINT8_C( 47), UINT8_C(139), UINT8_C(116), UINT8_C( 11),
+      UINT8_C( 78), UINT8_C( 64), UINT8_C( 46), UINT8_C(190), UINT8_C( 81), UINT8_C(195), UINT8_C( 71), UINT8_C(177),
+      UINT8_C(152), UINT8_C(  5), UINT8_C(106), UINT8_C( 44), UINT8_C(167), UINT8_C(115), UINT8_C(177), UINT8_C( 94),
+      UINT8_C(239), UINT8_C(208), UINT8_C(157), UINT8_C(123), UINT8_C( 26), UINT8_C(139), UINT8_C(165), UINT8_C( 68),
+      UINT8_C( 14), UINT8_C( 69), UINT8_C( 84), UINT8_C( 62), UINT8_C(208), UINT8_C(200), UINT8_C( 73), UINT8_C( 31),
+      UINT8_C(  8), UINT8_C(120), UINT8_C(221), UINT8_C( 90), UINT8_C( 59), UINT8_C( 37), UINT8_C( 11), UINT8_C(211),
+      UINT8_C( 42), UINT8_C(117),    UINT8_MAX, UINT8_C(209), UINT8_C(232), UINT8_C(176), UINT8_C( 47), UINT8_C(216),
+      UINT8_C(128), UINT8_C(205), UINT8_C( 83), UINT8_C(155), UINT8_C( 88), UINT8_C(248), UINT8_C(223), UINT8_C(102),
+      UINT8_C( 61), UINT8_C( 52), UINT8_C(164), UINT8_C( 14), UINT8_C(252), UINT8_C(238), UINT8_C( 45), UINT8_C(  5),
+      UINT8_C(102), UINT8_C( 10), UINT8_C( 95), UINT8_C(161), UINT8_C( 47), UINT8_C(106), UINT8_C(116), UINT8_C( 90),
+      UINT8_C(223), UINT8_C(115), UINT8_C( 43), UINT8_C(199), UINT8_C( 35), UINT8_C( 91), UINT8_C(159), UINT8_C(163),
+      UINT8_C( 40), UINT8_C(242), UINT8_C( 62), UINT8_C(128), UINT8_C(235), UINT8_C( 30), UINT8_C(230), UINT8_C( 40),
+      UINT8_C( 82), UINT8_C(139), UINT8_C( 54), UINT8_C( 78), UINT8_C(121), UINT8_C( 99), UINT8_C( 83), UINT8_C(223),
+      UINT8_C(110), UINT8_C(178), UINT8_C(128), UINT8_C(157), UINT8_C( 28), UINT8_C(244), UINT8_C(247), UINT8_C(251),
+      UINT8_C(103), UINT8_C( 35), UINT8_C(195), UINT8_C(138), UINT8_C(126), UINT8_C( 98), UINT8_C( 45), UINT8_C(166),
+      UINT8_C( 85), UINT8_C(108), UINT8_C( 38), UINT8_C( 64), UINT8_C(138), UINT8_C( 12), UINT8_C(104), UINT8_C(220),
+      UINT8_C(151), UINT8_C(159), UINT8_C( 42), UINT8_C( 16), UINT8_C(  2), UINT8_C(126), UINT8_C(239), UINT8_C(112),
+      UINT8_C( 48), UINT8_C(111), UINT8_C( 14), UINT8_C( 77), UINT8_C( 99), UINT8_C(  5), UINT8_C( 72), UINT8_C(202),
+      UINT8_C( 40), UINT8_C( 11), UINT8_C( 84), UINT8_C(166), UINT8_C(110), UINT8_C(130), UINT8_C( 76), UINT8_C(195),
+      UINT8_C(238), UINT8_C(114), UINT8_C(  3), UINT8_C(120), UINT8_C(127), UINT8_C(107), UINT8_C( 84), UINT8_C( 22),
+      UINT8_C( 10), UINT8_C(126), UINT8_C( 39), UINT8_C( 13), UINT8_C(252), UINT8_C( 22), UINT8_C(125), UINT8_C( 45),
+      UINT8_C(134), UINT8_C(139), UINT8_C(122), UINT8_C(233), UINT8_C(145), UINT8_C(194), UINT8_C(180), UINT8_C(185),
+      UINT8_C(206), UINT8_C(  8), UINT8_C( 96), UINT8_C( 60), UINT8_C(138), UINT8_C(172),    UINT8_MAX, UINT8_C(120),
+      UINT8_C( 31), UINT8_C(  2), UINT8_C(240), UINT8_C(158), UINT8_C(109), UINT8_C( 68), UINT8_C(180), UINT8_C(120),
+      UINT8_C(195), UINT8_C(219), UINT8_C(133), UINT8_C(191), UINT8_C(242), UINT8_C(  2), UINT8_C(236), UINT8_C(120),
+      UINT8_C(142), UINT8_C(102), UINT8_C( 97), UINT8_C( 31), UINT8_C( 41), UINT8_C( 21), UINT8_C(216), UINT8_C(247),
+      UINT8_C( 30), UINT8_C( 56), UINT8_C( 51), UINT8_C(168), UINT8_C(229), UINT8_C( 50), UINT8_C( 33), UINT8_C(  4),
+      UINT8_C( 52), UINT8_C( 17), UINT8_C(162), UINT8_C(161), UINT8_C( 86), UINT8_C( 86), UINT8_C( 25), UINT8_C( 25),
+      UINT8_C( 50), UINT8_C(158), UINT8_C(216), UINT8_C( 36), UINT8_C(161), UINT8_C(197), UINT8_C(156), UINT8_C( 47),
+      UINT8_C( 43), UINT8_C(253), UINT8_C( 78), UINT8_C( 84), UINT8_C( 19), UINT8_C( 38), UINT8_C( 75), UINT8_C( 49),
+      UINT8_C( 95), UINT8_C(126), UINT8_C(217), UINT8_C( 68), UINT8_C(176), UINT8_C(250), UINT8_C( 72), UINT8_C(228),
+      UINT8_C( 12), UINT8_C(234), UINT8_C(134), UINT8_C( 98), UINT8_C( 64), UINT8_C(159), UINT8_C(123), UINT8_C(114),
+      UINT8_C( 62), UINT8_C( 83), UINT8_C(150), UINT8_C(223), UINT8_C( 24), UINT8_C( 50), UINT8_C( 14), UINT8_C( 68),
+      UINT8_C( 48), UINT8_C( 92), UINT8_C(152), UINT8_C( 67), UINT8_C(130), UINT8_C(228), UINT8_C(116), UINT8_C(225),
+      UINT8_C( 98), UINT8_C( 77), UINT8_C( 37), UINT8_C( 19), UINT8_C( 72), UINT8_C(109), UINT8_C(247), UINT8_C( 84),
+      UINT8_C( 87), UINT8_C(125), UINT8_C(182), UINT8_C(152), UINT8_C( 29), UINT8_C( 49), UINT8_C( 10), UINT8_C( 91),
+      UINT8_C(132), UINT8_C(161), UINT8_C( 58), UINT8_C(157), UINT8_C(211), UINT8_C( 72), UINT8_C(225), UINT8_C(  3),
+      UINT8_C(164), UINT8_C(121), UINT8_C( 70), UINT8_C( 38), UINT8_C( 93), UINT8_C(186), UINT8_C(  8), UINT8_C(192),
+      UINT8_C(  8), UINT8_C( 45), UINT8_C(211), UINT8_C( 80), UINT8_C(155), UINT8_C(202), UINT8_C(164), UINT8_C(242),
+      UINT8_C( 72), UINT8_C( 90), UINT8_C(138), UINT8_C(101), UINT8_C(139), UINT8_C(149), UINT8_C(192), UINT8_C( 15),
+      UINT8_C( 54), UINT8_C(250), UINT8_C(172), UINT8_C(  9), UINT8_C( 66), UINT8_C(141), UINT8_C( 13), UINT8_C(230),
+      UINT8_C(  7), UINT8_C( 83), UINT8_C( 12), UINT8_C(100), UINT8_C( 14), UINT8_C( 20), UINT8_C( 36), UINT8_C( 22),
+      UINT8_C( 66), UINT8_C(247), UINT8_C(102), UINT8_C(221), UINT8_C(194), UINT8_C( 10), UINT8_C(207), UINT8_C( 10),
+      UINT8_C(100), UINT8_C( 90), UINT8_C(111), UINT8_C(239), UINT8_C(239), UINT8_C( 47), UINT8_C(254), UINT8_C( 37),
+      UINT8_C( 41), UINT8_C(171), UINT8_C( 46), UINT8_C(107), UINT8_C( 56), UINT8_C( 59), UINT8_C( 81), UINT8_C( 63),
+      UINT8_C(143), UINT8_C( 93), UINT8_C(164), UINT8_C(157), UINT8_C(114), UINT8_C(200), UINT8_C(179), UINT8_C(180),
+      UINT8_C(192), UINT8_C( 25), UINT8_C(145), UINT8_C(130), UINT8_C( 35), UINT8_C( 96), UINT8_C(140), UINT8_C(135),
+      UINT8_C(186), UINT8_C(251), UINT8_C(118), UINT8_C(169), UINT8_C( 42), UINT8_C(116), UINT8_C(206), UINT8_C( 83),
+      UINT8_C( 31), UINT8_C(253), UINT8_C(190), UINT8_C( 88), UINT8_C( 56), UINT8_C( 15), UINT8_C(151), UINT8_C(199),
+      UINT8_C(108), UINT8_C( 59), UINT8_C(100), UINT8_C(222), UINT8_C(  4), UINT8_C( 23), UINT8_C(146), UINT8_C(196),
+      UINT8_C( 48), UINT8_C( 35), UINT8_C( 70), UINT8_C( 83), UINT8_C(132), UINT8_C(210), UINT8_C(218), UINT8_C( 62),
+      UINT8_C(205), UINT8_C( 80), UINT8_C(232), UINT8_C(247), UINT8_C(197), UINT8_C(182), UINT8_C( 74), UINT8_C(228),
+      UINT8_C(179), UINT8_C(  8), UINT8_C( 60), UINT8_C(236), UINT8_C( 23), UINT8_C(212), UINT8_C(179), UINT8_C(131),
+      UINT8_C( 15), UINT8_C( 24), UINT8_C( 98), UINT8_C( 19), UINT8_C( 47), UINT8_C(244), UINT8_C(215), UINT8_C( 96),
+      UINT8_C( 24), UINT8_C( 29), UINT8_C(179), UINT8_C(156), UINT8_C(239), UINT8_C(142), UINT8_C(218), UINT8_C(188),
+      UINT8_C(222), UINT8_C(194), UINT8_C(179), UINT8_C(163), UINT8_C(121), UINT8_C(253), UINT8_C(136), UINT8_C( 44),
+      UINT8_C(  5), UINT8_C(196), UINT8_C( 24), UINT8_C( 28), UINT8_C(152), UINT8_C(204), UINT8_C(160), UINT8_C(168),
+      UINT8_C(228), UINT8_C(  2), UINT8_C(187), UINT8_C( 19), UINT8_C(246), UINT8_C(147), UINT8_C(115), UINT8_C( 14),
+      UINT8_C(176), UINT8_C( 39), UINT8_C(170), UINT8_C(160), UINT8_C(181), UINT8_C(133), UINT8_C( 92), UINT8_C(147),
+      UINT8_C( 71), UINT8_C( 16), UINT8_C( 55), UINT8_C(192), UINT8_C( 13), UINT8_C(191), UINT8_C(237), UINT8_C( 19),
+      UINT8_C(131), UINT8_C(  5), UINT8_C( 47), UINT8_C( 28), UINT8_C(209), UINT8_C(207), UINT8_C(196), UINT8_C(181),
+      UINT8_C(209), UINT8_C(127), UINT8_C(201), UINT8_C(200), UINT8_C( 18), UINT8_C( 60), UINT8_C(214), UINT8_C(195),
+      UINT8_C( 99), UINT8_C(129), UINT8_C( 99), UINT8_C( 24), UINT8_C(  6), UINT8_C(191), UINT8_C(172), UINT8_C( 77),
+      UINT8_C(207), UINT8_C(227), UINT8_C( 14), UINT8_C(221), UINT8_C(162), UINT8_C(251), UINT8_C(240), UINT8_C( 37),
+      UINT8_C(  0), UINT8_C( 31), UINT8_C( 65), UINT8_C(210), UINT8_C(239), UINT8_C(  5), UINT8_C(135), UINT8_C(192),
+      UINT8_C(133), UINT8_C( 80), UINT8_C(136), UINT8_C(151), UINT8_C(141), UINT8_C( 95), UINT8_C( 90), UINT8_C(240),
+      UINT8_C(224), UINT8_C(189), UINT8_C(  9), UINT8_C(230), UINT8_C(125), UINT8_C(181), UINT8_C( 51), UINT8_C( 76),
+      UINT8_C(152), UINT8_C( 65), UINT8_C( 41), UINT8_C( 58), UINT8_C( 60), UINT8_C( 25), UINT8_C( 95), UINT8_C( 61),
+      UINT8_C( 57), UINT8_C(161), UINT8_C( 15), UINT8_C( 40), UINT8_C(166), UINT8_C(150), UINT8_C(232), UINT8_C( 43),
+      UINT8_C(231), UINT8_C(113), UINT8_C(195), UINT8_C(116), UINT8_C(208), UINT8_C( 29), UINT8_C(100), UINT8_C(176),
+      UINT8_C(219), UINT8_C(109), UINT8_C(150), UINT8_C( 88), UINT8_C( 34), UINT8_C(201), UINT8_C(164), UINT8_C(186),
+      UINT8_C( 11), UINT8_C(206), UINT8_C(244), UINT8_C( 71), UINT8_C(231), UINT8_C( 84), UINT8_C(132), UINT8_C( 32),
+      UINT8_C(245), UINT8_C(147), UINT8_C( 72), UINT8_C(155), UINT8_C( 42), UINT8_C( 49), UINT8_C(199), UINT8_C( 17) };
+  static const uint8_t e = UINT8_C(  0);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint8_t r = UINT8_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    uint8_t v = simde_svminv_u8(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_u8(e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024];
+  uint8_t e = UINT8_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    uint8_t v = simde_svminv_u8(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(19432), UINT16_C(59899), UINT16_C(  882), UINT16_C(10714), UINT16_C(12265), UINT16_C(22079), UINT16_C(36367), UINT16_C(24692),
+      UINT16_C(56680), UINT16_C(26709), UINT16_C(23351), UINT16_C(60940), UINT16_C(17814), UINT16_C(27796), UINT16_C( 2933), UINT16_C(24072),
+      UINT16_C(  855), UINT16_C(51527), UINT16_C( 8455), UINT16_C(61683), UINT16_C(12880), UINT16_C(24646), UINT16_C(48064), UINT16_C(10432),
+      UINT16_C( 5528), UINT16_C(53137), UINT16_C(40305), UINT16_C( 1981), UINT16_C(21218), UINT16_C(22387), UINT16_C(31581), UINT16_C(46261),
+      UINT16_C(64895), UINT16_C(34430), UINT16_C(28958), UINT16_C(28534), UINT16_C(48291), UINT16_C(25807), UINT16_C(36727), UINT16_C( 3980),
+      UINT16_C( 7588), UINT16_C( 5599), UINT16_C(40122), UINT16_C(39965), UINT16_C(37102), UINT16_C(19700), UINT16_C(43276), UINT16_C(35584),
+      UINT16_C(32422), UINT16_C(50449), UINT16_C(34799), UINT16_C(37684), UINT16_C(  835), UINT16_C(48119), UINT16_C(33682), UINT16_C(14026),
+      UINT16_C(43425), UINT16_C(23372), UINT16_C(26950), UINT16_C(13560), UINT16_C(60665), UINT16_C( 1408), UINT16_C(33173), UINT16_C(15504),
+      UINT16_C(41471), UINT16_C(61185), UINT16_C(13608), UINT16_C(27778), UINT16_C(31032), UINT16_C(51751), UINT16_C(61948), UINT16_C(40192),
+      UINT16_C(19611), UINT16_C(57849), UINT16_C(61877), UINT16_C(44821), UINT16_C(38621), UINT16_C(29364), UINT16_C(17687), UINT16_C( 5806),
+      UINT16_C(45030), UINT16_C( 3845), UINT16_C(34788), UINT16_C( 7291), UINT16_C(41472), UINT16_C(64998), UINT16_C(59283), UINT16_C(11930),
+      UINT16_C(37683), UINT16_C(59663), UINT16_C( 9604), UINT16_C(24984), UINT16_C(19643), UINT16_C(53972), UINT16_C(33425), UINT16_C(30952),
+      UINT16_C(60978), UINT16_C( 5767), UINT16_C(  629), UINT16_C(30259), UINT16_C( 6564), UINT16_C(14195), UINT16_C( 3328), UINT16_C(13414),
+      UINT16_C(30113), UINT16_C( 9501), UINT16_C(46490), UINT16_C(21895), UINT16_C(23297), UINT16_C(37671), UINT16_C( 4317), UINT16_C( 3851),
+      UINT16_C(37630), UINT16_C(29478), UINT16_C(22932), UINT16_C(14569), UINT16_C(23666), UINT16_C(29551), UINT16_C(54634), UINT16_C( 2983),
+      UINT16_C(50251), UINT16_C(58672), UINT16_C(46969), UINT16_C(31291), UINT16_C(25106), UINT16_C(61453), UINT16_C( 6258), UINT16_C(28927),
+      UINT16_C( 9642), UINT16_C(16100), UINT16_C(52606), UINT16_C(61814), UINT16_C(58922), UINT16_C(37988), UINT16_C( 3003), UINT16_C( 1695),
+      UINT16_C(53199), UINT16_C(18668), UINT16_C(10119), UINT16_C(39362), UINT16_C(53385), UINT16_C(64649), UINT16_C(35304), UINT16_C(37740),
+      UINT16_C(20654), UINT16_C(11729), UINT16_C(18462), UINT16_C(18462), UINT16_C(33326), UINT16_C(59868), UINT16_C(31629), UINT16_C(23792),
+      UINT16_C(56394), UINT16_C(53668), UINT16_C(26115), UINT16_C(35947), UINT16_C(62518), UINT16_C( 8072), UINT16_C(62845), UINT16_C(11442),
+      UINT16_C(33605), UINT16_C(25433), UINT16_C(30667), UINT16_C(63915), UINT16_C(34809), UINT16_C(34531), UINT16_C(54018), UINT16_C(19938),
+      UINT16_C(34479), UINT16_C(45598), UINT16_C(35308), UINT16_C( 9022), UINT16_C(51070), UINT16_C(64322), UINT16_C(62652), UINT16_C(  295),
+      UINT16_C(32887), UINT16_C(17253), UINT16_C( 4343), UINT16_C(61500), UINT16_C( 8088), UINT16_C(39542), UINT16_C(22770), UINT16_C(41447),
+      UINT16_C( 1758), UINT16_C(52051), UINT16_C(37519), UINT16_C( 3566), UINT16_C(12377), UINT16_C( 5385), UINT16_C(12324), UINT16_C(39702),
+      UINT16_C(31665), UINT16_C(43230), UINT16_C( 7052), UINT16_C( 9369), UINT16_C( 3898), UINT16_C(11710), UINT16_C(42600), UINT16_C(18126),
+      UINT16_C( 8876), UINT16_C(15121), UINT16_C(65460), UINT16_C( 3401), UINT16_C(21039), UINT16_C(21282), UINT16_C(14466), UINT16_C(13295),
+      UINT16_C(52660), UINT16_C(16604), UINT16_C(30184), UINT16_C( 9060), UINT16_C( 8836), UINT16_C(60496), UINT16_C( 7880), UINT16_C(29747),
+      UINT16_C(17472), UINT16_C(62640), UINT16_C(63812), UINT16_C(29441), UINT16_C( 9035), UINT16_C(52679), UINT16_C(46684), UINT16_C( 4097),
+      UINT16_C(56707), UINT16_C(27728), UINT16_C(46162), UINT16_C(54927), UINT16_C(57302), UINT16_C(40899), UINT16_C(63229), UINT16_C(15891),
+      UINT16_C(49978), UINT16_C(32306), UINT16_C(13500), UINT16_C( 2034), UINT16_C(47447), UINT16_C(46037), UINT16_C(54895), UINT16_C(62147),
+      UINT16_C( 5043), UINT16_C( 1374), UINT16_C(60871), UINT16_C(40667), UINT16_C(40652), UINT16_C(51773), UINT16_C(20628), UINT16_C(53000),
+      UINT16_C(14868), UINT16_C(53325), UINT16_C(16238), UINT16_C(50904), UINT16_C(44536), UINT16_C(26489), UINT16_C(15747), UINT16_C(13914),
+      UINT16_C(47184), UINT16_C( 6203), UINT16_C( 5798), UINT16_C(29366), UINT16_C(62389), UINT16_C(18748), UINT16_C(17475), UINT16_C(22296),
+      UINT16_C(26239), UINT16_C(60712), UINT16_C(  165), UINT16_C(40627), UINT16_C(11693), UINT16_C(12293), UINT16_C(24426), UINT16_C(47718),
+      UINT16_C(41240), UINT16_C(48850), UINT16_C(34999), UINT16_C(27696), UINT16_C(28027), UINT16_C(49078), UINT16_C(52913), UINT16_C(12310),
+      UINT16_C(15924), UINT16_C(55838), UINT16_C(53566), UINT16_C(60280), UINT16_C(32254), UINT16_C(26651), UINT16_C(33245), UINT16_C(62755),
+      UINT16_C(62754), UINT16_C(55987), UINT16_C(58238), UINT16_C(63814), UINT16_C(64592), UINT16_C(  696), UINT16_C(53195), UINT16_C(65330),
+      UINT16_C(20493), UINT16_C(19673), UINT16_C(20770), UINT16_C( 8247), UINT16_C(21455), UINT16_C(44169), UINT16_C(44244), UINT16_C(63393),
+      UINT16_C(21665), UINT16_C( 8145), UINT16_C( 5943), UINT16_C(34841), UINT16_C(53524), UINT16_C(57226), UINT16_C(48288), UINT16_C(44766),
+      UINT16_C(47117), UINT16_C(12282), UINT16_C(12553), UINT16_C(55375), UINT16_C(55428), UINT16_C(22916), UINT16_C( 9604), UINT16_C( 9808),
+      UINT16_C( 8569), UINT16_C(45381), UINT16_C(24120), UINT16_C(19513), UINT16_C(49968), UINT16_C(53291), UINT16_C( 2687), UINT16_C(35966),
+      UINT16_C(30914), UINT16_C(52155), UINT16_C( 2986), UINT16_C(11940), UINT16_C(10467), UINT16_C(26759), UINT16_C(55118), UINT16_C(51086),
+      UINT16_C(54264), UINT16_C(12664), UINT16_C(45362), UINT16_C(25213), UINT16_C(43380), UINT16_C(62514), UINT16_C(45491), UINT16_C(30080),
+      UINT16_C(15401), UINT16_C(54080), UINT16_C(58439), UINT16_C(10754), UINT16_C(35085), UINT16_C(23442), UINT16_C( 8289), UINT16_C(22818),
+      UINT16_C(39924), UINT16_C( 9866), UINT16_C( 2124), UINT16_C(49544), UINT16_C(47793), UINT16_C(25781), UINT16_C(13675), UINT16_C(38361),
+      UINT16_C( 6513), UINT16_C(47208), UINT16_C(27390), UINT16_C( 3043), UINT16_C(30196), UINT16_C(21862), UINT16_C(34966), UINT16_C(35502),
+      UINT16_C(14627), UINT16_C(28848), UINT16_C(14401), UINT16_C(62001), UINT16_C(59122), UINT16_C(24150), UINT16_C(12059), UINT16_C(36339),
+      UINT16_C(23368), UINT16_C(17989), UINT16_C(10438), UINT16_C(47697), UINT16_C(47006), UINT16_C(13327), UINT16_C(48448), UINT16_C(25534),
+      UINT16_C(28406), UINT16_C(14291), UINT16_C( 1190), UINT16_C(38953), UINT16_C(32746), UINT16_C( 1782), UINT16_C(59822), UINT16_C(63379),
+      UINT16_C(55365), UINT16_C( 2877), UINT16_C(36609), UINT16_C(40901), UINT16_C(54342), UINT16_C(34515), UINT16_C(37265), UINT16_C(35050),
+      UINT16_C(48639), UINT16_C(42431), UINT16_C(59842), UINT16_C(44093), UINT16_C(13416), UINT16_C( 6066), UINT16_C(17693), UINT16_C(25102),
+      UINT16_C(19230), UINT16_C( 8045), UINT16_C(13018), UINT16_C( 8638), UINT16_C(37126), UINT16_C(39079), UINT16_C(37154), UINT16_C( 8480),
+      UINT16_C(57167), UINT16_C( 4550), UINT16_C(  968), UINT16_C(12733), UINT16_C(28727), UINT16_C(21832), UINT16_C(22197), UINT16_C(54199),
+      UINT16_C( 9633), UINT16_C(31986), UINT16_C(45143), UINT16_C(24221), UINT16_C(17473), UINT16_C(25590), UINT16_C( 5846), UINT16_C( 9604),
+      UINT16_C(19189), UINT16_C(48694), UINT16_C(62286), UINT16_C(34287), UINT16_C(14179), UINT16_C( 6618), UINT16_C(37517), UINT16_C(12012),
+      UINT16_C(57271), UINT16_C( 3754), UINT16_C(18319), UINT16_C(53612), UINT16_C(25228), UINT16_C(25140), UINT16_C(47480), UINT16_C(28295),
+      UINT16_C(48387), UINT16_C(20780), UINT16_C( 7088), UINT16_C( 5335), UINT16_C(45394), UINT16_C(57133), UINT16_C( 6467), UINT16_C(64013),
+      UINT16_C(47352), UINT16_C(34825), UINT16_C(30207), UINT16_C(35673), UINT16_C(36312), UINT16_C(20717), UINT16_C(29766), UINT16_C(19134),
+      UINT16_C(59953), UINT16_C(58011), UINT16_C(29189), UINT16_C(22518), UINT16_C( 8996), UINT16_C(26422), UINT16_C(17468), UINT16_C(13666),
+      UINT16_C(27644), UINT16_C(64445), UINT16_C( 5856), UINT16_C(47239), UINT16_C(29859), UINT16_C(59913), UINT16_C(51177), UINT16_C( 6708),
+      UINT16_C(53170), UINT16_C(47100), UINT16_C(62018), UINT16_C(26127), UINT16_C(17685), UINT16_C(21197), UINT16_C(12169), UINT16_C(34183),
+      UINT16_C(17562), UINT16_C(31617), UINT16_C( 2138), UINT16_C(64819), UINT16_C(15484), UINT16_C(26087), UINT16_C( 6916), UINT16_C(46720),
+      UINT16_C(31979), UINT16_C(11629), UINT16_C(31855), UINT16_C(33939), UINT16_C(24770), UINT16_C(19414), UINT16_C(23952), UINT16_C(10961),
+      UINT16_C(21153), UINT16_C(64421), UINT16_C(55642), UINT16_C(55033), UINT16_C(57365) };
+  static const uint16_t e = UINT16_C(  295);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint16_t r = UINT16_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    uint16_t v = simde_svminv_u16(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_u16(e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)];
+  uint16_t e = UINT16_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    uint16_t v = simde_svminv_u16(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(3223201562), UINT32_C(2735789489), UINT32_C(3685318631), UINT32_C(1405383441), UINT32_C(3680518991), UINT32_C(3791732279), UINT32_C(1416660665), UINT32_C(1992425820),
+      UINT32_C(3644252200), UINT32_C(2625390261), UINT32_C(3614909894), UINT32_C(3878370456), UINT32_C(3066268543), UINT32_C(2207892681), UINT32_C(2815887690), UINT32_C( 840800522),
+      UINT32_C( 789271673), UINT32_C(1623951258), UINT32_C(1161315245), UINT32_C(4264387455), UINT32_C(3082154222), UINT32_C(4265234100), UINT32_C(1638208087), UINT32_C( 630440875),
+      UINT32_C(2975112727), UINT32_C(3524402981), UINT32_C(3776465506), UINT32_C(2615166381), UINT32_C(3914503477), UINT32_C( 988253667), UINT32_C(1251708319), UINT32_C(1735339600),
+      UINT32_C(4044932044), UINT32_C(1170483939), UINT32_C( 556260468), UINT32_C(1455163169), UINT32_C(2134839196), UINT32_C(1001989788), UINT32_C(  59069619), UINT32_C(1315632514),
+      UINT32_C(2604630968), UINT32_C( 585171885), UINT32_C(   4393183), UINT32_C(2874540047), UINT32_C(2871694607), UINT32_C(1877402556), UINT32_C(3111349047), UINT32_C( 419945824),
+      UINT32_C( 246695520), UINT32_C( 691049802), UINT32_C(2888463261), UINT32_C(2186772595), UINT32_C(3526197526), UINT32_C(2604733284), UINT32_C(3746870399), UINT32_C(4076362642),
+      UINT32_C(3959467426), UINT32_C(3759484994), UINT32_C( 395067300), UINT32_C(3600475328), UINT32_C(3400058725), UINT32_C(1516628443), UINT32_C( 809089694), UINT32_C(3072471573),
+      UINT32_C( 564339679), UINT32_C(4144085331), UINT32_C(3088027384), UINT32_C(3616450930), UINT32_C(1268856432), UINT32_C(3198486304), UINT32_C(3605979073), UINT32_C(4035842065),
+      UINT32_C(2266050867), UINT32_C(3816690666), UINT32_C( 328961441), UINT32_C(2817141302), UINT32_C(2163379296), UINT32_C(1413388435), UINT32_C(2284465271), UINT32_C(1886959677),
+      UINT32_C(3572992490), UINT32_C(1035433628), UINT32_C( 978342659), UINT32_C(3722525565), UINT32_C(1516164039), UINT32_C(3803094123), UINT32_C( 107665609), UINT32_C(2071388817),
+      UINT32_C( 139423340), UINT32_C(3880126436), UINT32_C(3609302618), UINT32_C(2561934033), UINT32_C(1106383574), UINT32_C(2015666351), UINT32_C( 176066169), UINT32_C(3716543601),
+      UINT32_C(1189467234), UINT32_C( 892218331), UINT32_C(2467057602), UINT32_C( 674021714), UINT32_C(2187927251), UINT32_C( 955944383), UINT32_C(2369943580), UINT32_C(3479881581),
+      UINT32_C(1997950875), UINT32_C(1034699899), UINT32_C(3855661459), UINT32_C(1292762234), UINT32_C(3671095067), UINT32_C( 538102276), UINT32_C(2964149315), UINT32_C(3061782299),
+      UINT32_C(3794638183), UINT32_C(1830804185), UINT32_C( 223539091), UINT32_C( 123363564), UINT32_C(3688966871), UINT32_C( 956101621), UINT32_C(1659414855), UINT32_C( 672688065),
+      UINT32_C(3590997757), UINT32_C(3007523104), UINT32_C(  79730200), UINT32_C(3440057078), UINT32_C( 984149061), UINT32_C( 645047519), UINT32_C( 260594254), UINT32_C(3191316929),
+      UINT32_C( 127222247), UINT32_C(2193283178), UINT32_C(1686600302), UINT32_C(3643904660), UINT32_C(1578359423), UINT32_C(3431302526), UINT32_C(2715487711), UINT32_C(2506035886),
+      UINT32_C(3181179987), UINT32_C( 994072269), UINT32_C(1705035728), UINT32_C(3627995481), UINT32_C( 708268715), UINT32_C(3086400727), UINT32_C(2019087049), UINT32_C( 940423140),
+      UINT32_C(2046143148), UINT32_C(3518248192), UINT32_C(1446401276), UINT32_C(3509482534), UINT32_C(2667275718), UINT32_C(3948278305), UINT32_C(2825104836), UINT32_C( 283144292),
+      UINT32_C( 462018074), UINT32_C( 149700107), UINT32_C(3093176978), UINT32_C(1569361046), UINT32_C( 335250930), UINT32_C(1006522487), UINT32_C(1642357245), UINT32_C(3966944466),
+      UINT32_C(2785541018), UINT32_C(3434017593), UINT32_C(2894334997), UINT32_C(2315849368), UINT32_C( 194905236), UINT32_C(1363647572), UINT32_C(3501337598), UINT32_C(2327586031),
+      UINT32_C(1496368160), UINT32_C(3441811127), UINT32_C(2189011690), UINT32_C(1275953848), UINT32_C(3663244166), UINT32_C(1160486727), UINT32_C(3105217994), UINT32_C( 574870018),
+      UINT32_C(1299936150), UINT32_C( 991600977), UINT32_C(  62821195), UINT32_C(2605763349), UINT32_C(3178604662), UINT32_C( 285450311), UINT32_C(2160728190), UINT32_C(2158104298) };
+  static const uint32_t e = UINT32_C(  59069619);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint32_t r = UINT32_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    uint32_t v = simde_svminv_u32(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_u32(e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)];
+  uint32_t e = UINT32_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    uint32_t v = simde_svminv_u32(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C(17291994044489920598), UINT64_C(12241274778486063907), UINT64_C(10003194428725400630), UINT64_C(16282939872738610299),
+      UINT64_C(10985768734665340303), UINT64_C(  559655610869158541), UINT64_C( 1458683150014487647), UINT64_C( 1063185412311867220),
+      UINT64_C(16875843621550887462), UINT64_C( 5184989973744753948), UINT64_C(  473223974142831332), UINT64_C( 2497149221739088409),
+      UINT64_C( 7205743212130876601), UINT64_C(12807468560260531342), UINT64_C(  893612628091255214), UINT64_C(12441278579413961865),
+      UINT64_C(16587251485457409672), UINT64_C( 8305511573667742149), UINT64_C(13389828623294493139), UINT64_C( 5415270428715218822),
+      UINT64_C( 8037319681265821773), UINT64_C(15277973559436240845), UINT64_C(11141742835850205621), UINT64_C( 1365499732609523428),
+      UINT64_C( 2683091327670160675), UINT64_C( 4106647901486726696), UINT64_C(16664932720096155543), UINT64_C(13146432356746221978),
+      UINT64_C(10452221871285020815), UINT64_C( 1925490616129209854), UINT64_C( 3258647428932687438), UINT64_C(15685472675135539299),
+      UINT64_C(17230998611702067494), UINT64_C(16082398872935062162), UINT64_C( 7187016031493223934), UINT64_C( 7949988349615950385),
+      UINT64_C( 8437808234076378425), UINT64_C(12567218552568449271), UINT64_C( 3608504810636023728), UINT64_C(12681013358991666758),
+      UINT64_C(  968258625419737367), UINT64_C( 7267117324494567802), UINT64_C( 6613297551465781396), UINT64_C(10356843696362255765),
+      UINT64_C(    1399154157392864), UINT64_C( 3029238744439560690), UINT64_C(15820448697784671773), UINT64_C( 4468592682341922812),
+      UINT64_C( 8627270183187418420), UINT64_C(  473484794254976466), UINT64_C(15233081418683273541), UINT64_C( 2511121751120235581),
+      UINT64_C( 1789501655916220120), UINT64_C( 6875609160675816059), UINT64_C(12037647266914935651), UINT64_C( 8767414054718428829),
+      UINT64_C(11063562106842810410), UINT64_C( 9157903939364850078), UINT64_C(17230149105405788684), UINT64_C(11905589402882694943),
+      UINT64_C( 6442293420925259695), UINT64_C(15727740667202463144), UINT64_C(16603766629776555562), UINT64_C(13614063971734054605),
+      UINT64_C( 5405428563506169071), UINT64_C( 7493519447254111317), UINT64_C( 9871979152031370834), UINT64_C( 8430949085838681911),
+      UINT64_C(14966062420800276931), UINT64_C( 7555616403604357686), UINT64_C( 5009272785915264575), UINT64_C(15647344681594476074),
+      UINT64_C(11411260987198620947), UINT64_C( 9237704449174097843), UINT64_C( 7060800030105121961), UINT64_C( 2541217732910810966),
+      UINT64_C( 2991530852496737405), UINT64_C( 3034621863036884316), UINT64_C(17182042472094800089), UINT64_C( 4151086013845505127),
+      UINT64_C(13096928792274750242), UINT64_C(12818493416016098104), UINT64_C(  976774959940617735), UINT64_C(12226464329511594167),
+      UINT64_C(12067679355573226603), UINT64_C( 4701552653797280694), UINT64_C(16987419691106500619), UINT64_C(15026555259082196056),
+      UINT64_C( 9506551038746086104), UINT64_C(11552666066023960536), UINT64_C(18262115891574617424), UINT64_C(12937265973494140758),
+      UINT64_C(  252456854775012912), UINT64_C( 3633395417893671224), UINT64_C( 2756245647881846430), UINT64_C(13007358362665360885),
+      UINT64_C(11436946670423735689), UINT64_C(15409021284069854915), UINT64_C(12216955945986067861), UINT64_C( 6966503302657371254),
+      UINT64_C( 6088812347170054011), UINT64_C( 6244470409957861788), UINT64_C(10284892342749741150), UINT64_C(12603945002633541043),
+      UINT64_C( 7672461193735241876), UINT64_C(11677522967129846775), UINT64_C(14072745053318859173), UINT64_C(11422879119806682277),
+      UINT64_C( 1905089863024317752), UINT64_C( 4005917315363417521), UINT64_C( 6881008451413363626), UINT64_C( 4304523164948876052),
+      UINT64_C( 7931034373221089234), UINT64_C( 7865530993684505182), UINT64_C( 8169430067909696581), UINT64_C( 2787810995447240305),
+      UINT64_C(  141068044190151114), UINT64_C(10898175991783512078), UINT64_C( 8936256615197664821), UINT64_C(12035766503504712332),
+      UINT64_C( 6716877291859682194), UINT64_C( 8676023340863793533), UINT64_C( 9249001605100666579), UINT64_C( 9233339030242938015),
+      UINT64_C(17597794068488082059), UINT64_C(12092212091000415765), UINT64_C( 9700158654669838888) };
+  static const uint64_t e = UINT64_C(    1399154157392864);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  uint64_t r = UINT64_MAX;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    uint64_t v = simde_svminv_u64(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_u64(e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)];
+  uint64_t e = UINT64_MAX;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    uint64_t v = simde_svminv_u64(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(  -686.48), SIMDE_FLOAT32_C(    18.20), SIMDE_FLOAT32_C(    84.09), SIMDE_FLOAT32_C(  -332.88),
+      SIMDE_FLOAT32_C(   937.46), SIMDE_FLOAT32_C(   150.24), SIMDE_FLOAT32_C(  -144.38), SIMDE_FLOAT32_C(   994.21),
+      SIMDE_FLOAT32_C(  -131.17), SIMDE_FLOAT32_C(   179.23), SIMDE_FLOAT32_C(  -268.53), SIMDE_FLOAT32_C(   657.48),
+      SIMDE_FLOAT32_C(   566.95), SIMDE_FLOAT32_C(   209.05), SIMDE_FLOAT32_C(    -1.45), SIMDE_FLOAT32_C(     2.03),
+      SIMDE_FLOAT32_C(  -344.02), SIMDE_FLOAT32_C(    15.59), SIMDE_FLOAT32_C(  -466.01), SIMDE_FLOAT32_C(  -184.59),
+      SIMDE_FLOAT32_C(  -666.56), SIMDE_FLOAT32_C(   101.16), SIMDE_FLOAT32_C(  -526.23), SIMDE_FLOAT32_C(   487.07),
+      SIMDE_FLOAT32_C(   930.64), SIMDE_FLOAT32_C(  -868.99), SIMDE_FLOAT32_C(  -340.50), SIMDE_FLOAT32_C(   640.35),
+      SIMDE_FLOAT32_C(   634.34), SIMDE_FLOAT32_C(  -415.04), SIMDE_FLOAT32_C(   423.88), SIMDE_FLOAT32_C(   947.86),
+      SIMDE_FLOAT32_C(   603.16), SIMDE_FLOAT32_C(  -492.03), SIMDE_FLOAT32_C(  -385.02), SIMDE_FLOAT32_C(   540.62),
+      SIMDE_FLOAT32_C(   658.21), SIMDE_FLOAT32_C(   470.60), SIMDE_FLOAT32_C(   534.83), SIMDE_FLOAT32_C(  -472.96),
+      SIMDE_FLOAT32_C(  -350.17), SIMDE_FLOAT32_C(  -733.70), SIMDE_FLOAT32_C(  -815.49), SIMDE_FLOAT32_C(  -783.21),
+      SIMDE_FLOAT32_C(   475.35), SIMDE_FLOAT32_C(   183.07), SIMDE_FLOAT32_C(   218.82), SIMDE_FLOAT32_C(  -868.67),
+      SIMDE_FLOAT32_C(  -801.35), SIMDE_FLOAT32_C(   752.80), SIMDE_FLOAT32_C(   -53.25), SIMDE_FLOAT32_C(  -467.90),
+      SIMDE_FLOAT32_C(  -146.03), SIMDE_FLOAT32_C(   420.51), SIMDE_FLOAT32_C(  -980.84), SIMDE_FLOAT32_C(  -215.39),
+      SIMDE_FLOAT32_C(   551.52), SIMDE_FLOAT32_C(  -321.34), SIMDE_FLOAT32_C(  -575.04), SIMDE_FLOAT32_C(   185.86),
+      SIMDE_FLOAT32_C(   263.63), SIMDE_FLOAT32_C(   848.84), SIMDE_FLOAT32_C(   133.73), SIMDE_FLOAT32_C(  -133.21),
+      SIMDE_FLOAT32_C(  -643.19), SIMDE_FLOAT32_C(   748.71), SIMDE_FLOAT32_C(  -592.60), SIMDE_FLOAT32_C(  -984.98),
+      SIMDE_FLOAT32_C(   219.31), SIMDE_FLOAT32_C(   942.23), SIMDE_FLOAT32_C(  -457.95), SIMDE_FLOAT32_C(   869.14),
+      SIMDE_FLOAT32_C(  -791.47), SIMDE_FLOAT32_C(  -273.43), SIMDE_FLOAT32_C(  -914.07), SIMDE_FLOAT32_C(   683.88),
+      SIMDE_FLOAT32_C(   909.63), SIMDE_FLOAT32_C(   304.75), SIMDE_FLOAT32_C(   815.22), SIMDE_FLOAT32_C(  -891.71),
+      SIMDE_FLOAT32_C(    57.55), SIMDE_FLOAT32_C(  -238.04), SIMDE_FLOAT32_C(  -359.62), SIMDE_FLOAT32_C(   911.52),
+      SIMDE_FLOAT32_C(  -817.53), SIMDE_FLOAT32_C(  -340.46), SIMDE_FLOAT32_C(  -303.87), SIMDE_FLOAT32_C(   733.99),
+      SIMDE_FLOAT32_C(   338.21), SIMDE_FLOAT32_C(   121.09), SIMDE_FLOAT32_C(   -80.14), SIMDE_FLOAT32_C(  -398.16),
+      SIMDE_FLOAT32_C(   -30.07), SIMDE_FLOAT32_C(  -946.42), SIMDE_FLOAT32_C(   468.63), SIMDE_FLOAT32_C(   326.73),
+      SIMDE_FLOAT32_C(   802.29), SIMDE_FLOAT32_C(   876.03), SIMDE_FLOAT32_C(   341.75), SIMDE_FLOAT32_C(    21.60),
+      SIMDE_FLOAT32_C(   818.26), SIMDE_FLOAT32_C(   883.80), SIMDE_FLOAT32_C(  -109.25), SIMDE_FLOAT32_C(  -973.21),
+      SIMDE_FLOAT32_C(  -389.63), SIMDE_FLOAT32_C(   -23.32), SIMDE_FLOAT32_C(   710.68), SIMDE_FLOAT32_C(  -480.00),
+      SIMDE_FLOAT32_C(  -718.57), SIMDE_FLOAT32_C(   525.89), SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(   338.99),
+      SIMDE_FLOAT32_C(  -712.15), SIMDE_FLOAT32_C(   268.67), SIMDE_FLOAT32_C(   250.51), SIMDE_FLOAT32_C(  -529.67),
+      SIMDE_FLOAT32_C(   928.21), SIMDE_FLOAT32_C(   946.64), SIMDE_FLOAT32_C(  -795.68), SIMDE_FLOAT32_C(   266.42),
+      SIMDE_FLOAT32_C(    67.72), SIMDE_FLOAT32_C(   124.18), SIMDE_FLOAT32_C(   868.26), SIMDE_FLOAT32_C(  -962.35),
+      SIMDE_FLOAT32_C(   177.77), SIMDE_FLOAT32_C(   336.88), SIMDE_FLOAT32_C(   364.38), SIMDE_FLOAT32_C(   -19.94),
+      SIMDE_FLOAT32_C(   212.92), SIMDE_FLOAT32_C(  -293.87), SIMDE_FLOAT32_C(  -998.34), SIMDE_FLOAT32_C(    31.18),
+      SIMDE_FLOAT32_C(  -410.07), SIMDE_FLOAT32_C(  -107.59), SIMDE_FLOAT32_C(    57.97), SIMDE_FLOAT32_C(   200.30),
+      SIMDE_FLOAT32_C(   869.09), SIMDE_FLOAT32_C(  -231.35), SIMDE_FLOAT32_C(   720.30), SIMDE_FLOAT32_C(  -849.47),
+      SIMDE_FLOAT32_C(  -705.46), SIMDE_FLOAT32_C(  -651.42), SIMDE_FLOAT32_C(   489.51), SIMDE_FLOAT32_C(  -417.60),
+      SIMDE_FLOAT32_C(   617.25), SIMDE_FLOAT32_C(  -259.98), SIMDE_FLOAT32_C(    52.73), SIMDE_FLOAT32_C(   545.46),
+      SIMDE_FLOAT32_C(  -313.34), SIMDE_FLOAT32_C(   257.05), SIMDE_FLOAT32_C(  -188.12), SIMDE_FLOAT32_C(   754.38),
+      SIMDE_FLOAT32_C(  -618.77), SIMDE_FLOAT32_C(  -319.86), SIMDE_FLOAT32_C(   792.03), SIMDE_FLOAT32_C(   559.00),
+      SIMDE_FLOAT32_C(  -982.98), SIMDE_FLOAT32_C(   156.41), SIMDE_FLOAT32_C(  -460.94), SIMDE_FLOAT32_C(   229.94),
+      SIMDE_FLOAT32_C(   862.55), SIMDE_FLOAT32_C(  -459.28), SIMDE_FLOAT32_C(  -738.88), SIMDE_FLOAT32_C(  -547.52),
+      SIMDE_FLOAT32_C(   433.13), SIMDE_FLOAT32_C(   319.09), SIMDE_FLOAT32_C(   652.78), SIMDE_FLOAT32_C(   302.22),
+      SIMDE_FLOAT32_C(  -912.26), SIMDE_FLOAT32_C(   373.08), SIMDE_FLOAT32_C(   452.75), SIMDE_FLOAT32_C(  -617.72),
+      SIMDE_FLOAT32_C(   721.66), SIMDE_FLOAT32_C(   -57.74), SIMDE_FLOAT32_C(   -35.32), SIMDE_FLOAT32_C(   338.91),
+      SIMDE_FLOAT32_C(   682.28), SIMDE_FLOAT32_C(  -982.59), SIMDE_FLOAT32_C(  -115.63), SIMDE_FLOAT32_C(  -631.06),
+      SIMDE_FLOAT32_C(   274.46), SIMDE_FLOAT32_C(   696.25), SIMDE_FLOAT32_C(  -876.68), SIMDE_FLOAT32_C(   655.69),
+      SIMDE_FLOAT32_C(  -623.61), SIMDE_FLOAT32_C(   915.35), SIMDE_FLOAT32_C(   214.68), SIMDE_FLOAT32_C(  -606.59),
+      SIMDE_FLOAT32_C(    71.76), SIMDE_FLOAT32_C(   753.74), SIMDE_FLOAT32_C(   623.35), SIMDE_FLOAT32_C(   -65.69),
+      SIMDE_FLOAT32_C(  -705.54), SIMDE_FLOAT32_C(   884.46), SIMDE_FLOAT32_C(   386.79), SIMDE_FLOAT32_C(   727.59),
+      SIMDE_FLOAT32_C(   203.56), SIMDE_FLOAT32_C(    39.56), SIMDE_FLOAT32_C(    29.81), SIMDE_FLOAT32_C(   291.30),
+      SIMDE_FLOAT32_C(  -587.36), SIMDE_FLOAT32_C(  -517.44), SIMDE_FLOAT32_C(   673.58), SIMDE_FLOAT32_C(  -865.70),
+      SIMDE_FLOAT32_C(   424.82), SIMDE_FLOAT32_C(  -361.74), SIMDE_FLOAT32_C(   473.21), SIMDE_FLOAT32_C(   107.10),
+      SIMDE_FLOAT32_C(  -344.33), SIMDE_FLOAT32_C(  -642.42), SIMDE_FLOAT32_C(   476.04), SIMDE_FLOAT32_C(   930.12),
+      SIMDE_FLOAT32_C(  -946.18), SIMDE_FLOAT32_C(   599.35), SIMDE_FLOAT32_C(   585.81), SIMDE_FLOAT32_C(  -569.79),
+      SIMDE_FLOAT32_C(   514.70), SIMDE_FLOAT32_C(  -199.50), SIMDE_FLOAT32_C(  -176.38), SIMDE_FLOAT32_C(  -413.54),
+      SIMDE_FLOAT32_C(  -445.76), SIMDE_FLOAT32_C(  -553.03), SIMDE_FLOAT32_C(   520.77), SIMDE_FLOAT32_C(  -151.30),
+      SIMDE_FLOAT32_C(  -668.57), SIMDE_FLOAT32_C(   -92.44), SIMDE_FLOAT32_C(  -423.72), SIMDE_FLOAT32_C(   534.99),
+      SIMDE_FLOAT32_C(   947.12), SIMDE_FLOAT32_C(   606.09), SIMDE_FLOAT32_C(  -173.72), SIMDE_FLOAT32_C(  -640.24),
+      SIMDE_FLOAT32_C(  -911.36), SIMDE_FLOAT32_C(  -500.14), SIMDE_FLOAT32_C(  -505.94), SIMDE_FLOAT32_C(   513.46),
+      SIMDE_FLOAT32_C(   138.13), SIMDE_FLOAT32_C(   967.27), SIMDE_FLOAT32_C(  -379.44), SIMDE_FLOAT32_C(   793.79),
+      SIMDE_FLOAT32_C(  -675.15), SIMDE_FLOAT32_C(  -903.40), SIMDE_FLOAT32_C(   723.92), SIMDE_FLOAT32_C(  -621.33),
+      SIMDE_FLOAT32_C(   695.95), SIMDE_FLOAT32_C(   309.73), SIMDE_FLOAT32_C(  -191.12), SIMDE_FLOAT32_C(   210.65) };
+  static const simde_float32 e = SIMDE_FLOAT32_C(  -982.59);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  simde_float32 r = SIMDE_MATH_INFINITYF;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    simde_float32 v = simde_svminv_f32(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_f32(e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)];
+  simde_float32 e = SIMDE_MATH_INFINITYF;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    simde_float32 v = simde_svminv_f32(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svminv_f64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   491.40), SIMDE_FLOAT64_C(   610.26), SIMDE_FLOAT64_C(   816.64), SIMDE_FLOAT64_C(   -57.79),
+      SIMDE_FLOAT64_C(  -600.14), SIMDE_FLOAT64_C(  -888.85), SIMDE_FLOAT64_C(  -119.41), SIMDE_FLOAT64_C(   569.82),
+      SIMDE_FLOAT64_C(   812.59), SIMDE_FLOAT64_C(   554.21), SIMDE_FLOAT64_C(   -13.62), SIMDE_FLOAT64_C(   575.21),
+      SIMDE_FLOAT64_C(   986.00), SIMDE_FLOAT64_C(  -950.34), SIMDE_FLOAT64_C(   -19.50), SIMDE_FLOAT64_C(  -827.24),
+      SIMDE_FLOAT64_C(   -11.79), SIMDE_FLOAT64_C(   901.51), SIMDE_FLOAT64_C(  -712.00), SIMDE_FLOAT64_C(   -36.53),
+      SIMDE_FLOAT64_C(  -712.09), SIMDE_FLOAT64_C(   889.24), SIMDE_FLOAT64_C(  -207.99), SIMDE_FLOAT64_C(   151.07),
+      SIMDE_FLOAT64_C(   464.40), SIMDE_FLOAT64_C(   694.00), SIMDE_FLOAT64_C(   482.43), SIMDE_FLOAT64_C(  -594.66),
+      SIMDE_FLOAT64_C(   114.47), SIMDE_FLOAT64_C(  -960.24), SIMDE_FLOAT64_C(   170.73), SIMDE_FLOAT64_C(  -394.13),
+      SIMDE_FLOAT64_C(   650.02), SIMDE_FLOAT64_C(   -12.63), SIMDE_FLOAT64_C(   548.08), SIMDE_FLOAT64_C(  -950.12),
+      SIMDE_FLOAT64_C(    98.51), SIMDE_FLOAT64_C(  -571.33), SIMDE_FLOAT64_C(   619.70), SIMDE_FLOAT64_C(   -88.90),
+      SIMDE_FLOAT64_C(   982.88), SIMDE_FLOAT64_C(  -393.92), SIMDE_FLOAT64_C(  -513.69), SIMDE_FLOAT64_C(   968.88),
+      SIMDE_FLOAT64_C(  -344.25), SIMDE_FLOAT64_C(   466.81), SIMDE_FLOAT64_C(  -858.37), SIMDE_FLOAT64_C(   643.96),
+      SIMDE_FLOAT64_C(   368.32), SIMDE_FLOAT64_C(  -570.37), SIMDE_FLOAT64_C(  -392.57), SIMDE_FLOAT64_C(   656.23),
+      SIMDE_FLOAT64_C(  -681.13), SIMDE_FLOAT64_C(   399.43), SIMDE_FLOAT64_C(  -192.71), SIMDE_FLOAT64_C(   783.27),
+      SIMDE_FLOAT64_C(    93.44), SIMDE_FLOAT64_C(  -710.27), SIMDE_FLOAT64_C(  -811.39), SIMDE_FLOAT64_C(  -792.09),
+      SIMDE_FLOAT64_C(  -670.51), SIMDE_FLOAT64_C(   359.34), SIMDE_FLOAT64_C(  -186.23), SIMDE_FLOAT64_C(   979.51),
+      SIMDE_FLOAT64_C(  -653.30), SIMDE_FLOAT64_C(  -638.14), SIMDE_FLOAT64_C(  -970.61), SIMDE_FLOAT64_C(   445.22),
+      SIMDE_FLOAT64_C(  -209.48), SIMDE_FLOAT64_C(   649.09), SIMDE_FLOAT64_C(  -643.68), SIMDE_FLOAT64_C(  -226.60),
+      SIMDE_FLOAT64_C(  -744.83), SIMDE_FLOAT64_C(  -157.37), SIMDE_FLOAT64_C(  -257.72), SIMDE_FLOAT64_C(   -89.08) };
+  static const simde_float64 e = SIMDE_FLOAT64_C(  -970.61);
+
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(a) / sizeof(a[0]));
+  simde_float64 r = SIMDE_MATH_INFINITY;
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    simde_float64 v = simde_svminv_f64(pv, av);
+    r = (v < r) ? v : r;
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_f64(e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)];
+  simde_float64 e = SIMDE_MATH_INFINITY;
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    simde_float64 v = simde_svminv_f64(pv, av);
+    e = (v < e) ? v : e;
+
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svminv_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
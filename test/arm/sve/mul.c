@@ -0,0 +1,9186 @@
+#define SIMDE_TEST_ARM_SVE_INSN mul
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/mul.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+
+static int
+test_simde_svmul_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C( 116),  INT8_C(  61),  INT8_C( 111), -INT8_C(  55),  INT8_C( 105),  INT8_C(  79),  INT8_C(  43), -INT8_C(  60),
+      -INT8_C(  90),  INT8_C( 100),  INT8_C(  98), -INT8_C(  30),  INT8_C(  19), -INT8_C(  83), -INT8_C(  20),  INT8_C( 118),
+       INT8_C(  34),  INT8_C(  49),  INT8_C(  36), -INT8_C(  10), -INT8_C(  57), -INT8_C(  41),  INT8_C(  76), -INT8_C( 106),
+      -INT8_C(  15), -INT8_C(  91),  INT8_C(  90),  INT8_C( 111),  INT8_C(  35),  INT8_C( 112), -INT8_C( 112), -INT8_C( 105),
+      -INT8_C(  82), -INT8_C(   1),  INT8_C(  96),  INT8_C(  23),  INT8_C(  79), -INT8_C( 117), -INT8_C(  37), -INT8_C(  11),
+      -INT8_C(  17),  INT8_C(  62), -INT8_C(  41),  INT8_C(   2), -INT8_C(  21), -INT8_C(  60),  INT8_C( 120),  INT8_C(  13),
+      -INT8_C(  11), -INT8_C(  99),  INT8_C(   4), -INT8_C(  68),  INT8_C( 116),  INT8_C(  80),  INT8_C(  83),  INT8_C( 101),
+      -INT8_C(  10), -INT8_C(  83), -INT8_C(  43),  INT8_C(  25),  INT8_C(  29),  INT8_C( 101), -INT8_C(  80), -INT8_C(  53),
+       INT8_C( 100),  INT8_C(  16), -INT8_C(  29), -INT8_C(  77), -INT8_C( 101), -INT8_C(  66), -INT8_C(  88), -INT8_C( 118),
+      -INT8_C(   4),      INT8_MIN, -INT8_C( 115), -INT8_C(  25),  INT8_C(  68),  INT8_C(   5), -INT8_C(  11),  INT8_C(  57),
+      -INT8_C(  94), -INT8_C(   7), -INT8_C(  10),  INT8_C(  22),  INT8_C(  73),  INT8_C(  73),  INT8_C( 124),  INT8_C(  63),
+      -INT8_C(  10),  INT8_C(  81),  INT8_C(  88),  INT8_C(  19), -INT8_C(  74),  INT8_C(   8), -INT8_C(  33),  INT8_C(  26),
+       INT8_C(  24), -INT8_C(  62), -INT8_C(  50), -INT8_C(  77),      INT8_MIN,  INT8_C( 118),  INT8_C(  62),  INT8_C( 125),
+      -INT8_C(  10), -INT8_C(  53),  INT8_C( 100),  INT8_C(  58), -INT8_C(  48),  INT8_C(  89),  INT8_C( 116),  INT8_C( 115),
+       INT8_C(  82),  INT8_C( 106), -INT8_C( 119), -INT8_C( 100), -INT8_C(  77),  INT8_C(   5), -INT8_C(  37), -INT8_C(  87),
+       INT8_C(  86),  INT8_C(  52), -INT8_C(  68),  INT8_C(  12),  INT8_C(  60), -INT8_C( 101),  INT8_C(  39),  INT8_C(  85),
+       INT8_C(  93), -INT8_C(  11),  INT8_C(   8), -INT8_C(  34),  INT8_C( 107),  INT8_C(  70),  INT8_C(  91),  INT8_C(  98),
+       INT8_C(  17), -INT8_C(  65), -INT8_C( 100), -INT8_C(  30),  INT8_C(  25),  INT8_C(  16),  INT8_C(  85),  INT8_C( 107),
+       INT8_C( 122), -INT8_C(  34),  INT8_C(   7),  INT8_C(  45), -INT8_C(  28), -INT8_C(  29), -INT8_C(  42),  INT8_C(  58),
+       INT8_C(  23), -INT8_C( 109),  INT8_C(  71),  INT8_C(  83),  INT8_C(  46),  INT8_C( 110), -INT8_C(  88), -INT8_C( 116),
+       INT8_C(  99), -INT8_C(  79),  INT8_C( 106), -INT8_C(  50), -INT8_C(   9), -INT8_C(  59),  INT8_C(  48),  INT8_C(   9),
+      -INT8_C( 124), -INT8_C(  51), -INT8_C(  21), -INT8_C(  99), -INT8_C(  35),  INT8_C(  64),  INT8_C(   9),  INT8_C(  88),
+       INT8_C(  30),  INT8_C(  16), -INT8_C( 123),  INT8_C(   2), -INT8_C(  13),  INT8_C(  92),  INT8_C(  61),  INT8_C(  10),
+      -INT8_C(  17), -INT8_C( 124),  INT8_C(  94),  INT8_C(  29), -INT8_C(  14),  INT8_C(   6), -INT8_C(  87),  INT8_C(  85),
+      -INT8_C(  73),  INT8_C(  19),  INT8_C(  35), -INT8_C(  81), -INT8_C(  40),  INT8_C(  84), -INT8_C(  72),  INT8_C(  93),
+       INT8_C(  33), -INT8_C(  93), -INT8_C(   6), -INT8_C(   2), -INT8_C(  29),  INT8_C(   3),  INT8_C(  86),  INT8_C(   1),
+       INT8_C(  20), -INT8_C(  36),  INT8_C(   4),  INT8_C(   7),  INT8_C(  56),  INT8_C(  65),  INT8_C(  18),  INT8_C(  39),
+      -INT8_C(  59),  INT8_C( 112),  INT8_C(  68), -INT8_C(  73),  INT8_C( 118), -INT8_C(  18),  INT8_C(  12),  INT8_C(  46),
+       INT8_C(   1),  INT8_C(  47), -INT8_C(  35), -INT8_C(  38), -INT8_C( 125), -INT8_C( 107),  INT8_C(  55), -INT8_C(  92),
+       INT8_C(  56),  INT8_C(  49), -INT8_C(  93),  INT8_C(  27),  INT8_C(  53), -INT8_C(   7),  INT8_C(  28),  INT8_C(  73),
+      -INT8_C(  43),  INT8_C(  32),  INT8_C(  80),  INT8_C(  13),  INT8_C(  97),  INT8_C(  98),  INT8_C(  52),  INT8_C(  38),
+      -INT8_C(  46),  INT8_C( 121), -INT8_C(  35),  INT8_C(  73),  INT8_C( 103), -INT8_C(  23),  INT8_C( 119),  INT8_C( 104),
+       INT8_C(  25),  INT8_C(  84),  INT8_C(  66), -INT8_C( 100), -INT8_C(  23),  INT8_C( 121),  INT8_C(  65),  INT8_C(  33),
+      -INT8_C(  85), -INT8_C(  28),  INT8_C(  60), -INT8_C(  32), -INT8_C(  35),  INT8_C(  88),  INT8_C(  41), -INT8_C(  77),
+       INT8_C( 121),  INT8_C( 121), -INT8_C(  64), -INT8_C(  38), -INT8_C(  36), -INT8_C(  11),  INT8_C(   1), -INT8_C(  82),
+       INT8_C( 110), -INT8_C(  34), -INT8_C(   9), -INT8_C(  43), -INT8_C(  56),  INT8_C( 110),  INT8_C(  61), -INT8_C(  31),
+      -INT8_C(  62),      INT8_MIN,  INT8_C( 125), -INT8_C(  85), -INT8_C(   7), -INT8_C(  66), -INT8_C(  52), -INT8_C(  92),
+      -INT8_C(  94),  INT8_C(   8), -INT8_C( 124),      INT8_MIN,  INT8_C(  97), -INT8_C(  83),  INT8_C(  51), -INT8_C(  38),
+       INT8_C(  39), -INT8_C(  13), -INT8_C(  76),  INT8_C(   3), -INT8_C(  24), -INT8_C(  75), -INT8_C(  79),  INT8_C(  86),
+      -INT8_C( 108), -INT8_C(  87),  INT8_C(  43),  INT8_C(  92),  INT8_C(  23),  INT8_C( 105),  INT8_C(  61), -INT8_C(  38),
+      -INT8_C(  23), -INT8_C(  70), -INT8_C( 123), -INT8_C(  30),  INT8_C( 121),  INT8_C(  82), -INT8_C( 121),  INT8_C(  27),
+       INT8_C(  90),  INT8_C(  11), -INT8_C( 101), -INT8_C(  69), -INT8_C(  71), -INT8_C(  50), -INT8_C( 107), -INT8_C(  32),
+      -INT8_C(  62),  INT8_C(  74), -INT8_C(  29), -INT8_C(  86), -INT8_C(   1), -INT8_C( 108),  INT8_C(   1), -INT8_C( 109),
+       INT8_C(  61),  INT8_C(  44), -INT8_C(  17),  INT8_C(  85), -INT8_C( 107),  INT8_C(  44),  INT8_C(  47),  INT8_C( 126),
+      -INT8_C(  25), -INT8_C(  76),  INT8_C(  97),  INT8_C(  96),  INT8_C(   6), -INT8_C(  24),  INT8_C( 123),  INT8_C(  97),
+      -INT8_C(  13),  INT8_C(  23),  INT8_C(  28), -INT8_C(  84), -INT8_C(  27), -INT8_C(  78), -INT8_C( 116), -INT8_C(  89),
+      -INT8_C(   4),  INT8_C( 111),  INT8_C(  82), -INT8_C(   5),  INT8_C(   4),  INT8_C(  83), -INT8_C( 113),  INT8_C(  65),
+           INT8_MAX,  INT8_C( 126), -INT8_C( 106),  INT8_C(  21), -INT8_C(  85), -INT8_C(  59), -INT8_C( 109), -INT8_C( 110),
+       INT8_C( 122), -INT8_C(  12), -INT8_C(  14),      INT8_MIN, -INT8_C(  36),  INT8_C( 109), -INT8_C(  31), -INT8_C(  48),
+      -INT8_C( 124), -INT8_C(   2),  INT8_C( 124),  INT8_C( 106), -INT8_C(  80),  INT8_C(   9),  INT8_C(  17), -INT8_C(  84),
+       INT8_C( 120),  INT8_C(  99), -INT8_C(  89),  INT8_C( 124), -INT8_C(  74),  INT8_C(  54), -INT8_C(  66),  INT8_C(  54),
+      -INT8_C(  75),  INT8_C(  84),  INT8_C(  75),  INT8_C(  96),  INT8_C(  26), -INT8_C(  34), -INT8_C(  14), -INT8_C( 108),
+      -INT8_C(  45), -INT8_C(  28),  INT8_C(  20), -INT8_C(  81),  INT8_C(  81), -INT8_C(  10),      INT8_MAX, -INT8_C(  42),
+      -INT8_C(  12), -INT8_C(   4),  INT8_C(  64), -INT8_C(  92),  INT8_C(   5),  INT8_C(  81),  INT8_C(  80),  INT8_C( 125),
+      -INT8_C(  75), -INT8_C(   9), -INT8_C(   6),  INT8_C( 107),  INT8_C(  46), -INT8_C(  72), -INT8_C(  95), -INT8_C(  29),
+       INT8_C(  12), -INT8_C(  20),  INT8_C(  67),  INT8_C(  38), -INT8_C(  53),  INT8_C(  53), -INT8_C(  70), -INT8_C(  98),
+       INT8_C(  25), -INT8_C(  49),  INT8_C(  77),  INT8_C( 106), -INT8_C(  59), -INT8_C(  51),  INT8_C(  64), -INT8_C(  71),
+      -INT8_C(  55),      INT8_MIN,  INT8_C(  93), -INT8_C(  50), -INT8_C(  46), -INT8_C(  83),  INT8_C(  75), -INT8_C( 121),
+      -INT8_C(  92),  INT8_C(  69), -INT8_C(  14), -INT8_C(  46), -INT8_C(   3), -INT8_C( 108), -INT8_C(  75),  INT8_C(  10),
+           INT8_MIN, -INT8_C(   8),  INT8_C(  48),  INT8_C(  75),  INT8_C(  45), -INT8_C(  21), -INT8_C(  23),  INT8_C(  70),
+      -INT8_C(  70),  INT8_C(  55), -INT8_C(  79),      INT8_MAX,  INT8_C(   4), -INT8_C(  15),  INT8_C(  56), -INT8_C(  51),
+       INT8_C( 114), -INT8_C( 107), -INT8_C( 101),  INT8_C(  68),  INT8_C(  66), -INT8_C(  26), -INT8_C(  53), -INT8_C(  26),
+       INT8_C(  44), -INT8_C(  67), -INT8_C(  71),  INT8_C(  41),  INT8_C(  81),  INT8_C( 110),  INT8_C(  51), -INT8_C(  46),
+       INT8_C( 103),  INT8_C( 100),  INT8_C(  29), -INT8_C( 108),  INT8_C(  79),  INT8_C(   7), -INT8_C(  37),  INT8_C(   9),
+       INT8_C(  62), -INT8_C( 116), -INT8_C( 120),  INT8_C(  66),  INT8_C( 125), -INT8_C(  64),  INT8_C(  15), -INT8_C(  17),
+       INT8_C(  85), -INT8_C(  86),  INT8_C(  51), -INT8_C( 105), -INT8_C( 112), -INT8_C(   2),  INT8_C( 125), -INT8_C(  68),
+      -INT8_C(  68),  INT8_C(  54), -INT8_C(  26),  INT8_C(  13), -INT8_C(  91),  INT8_C(  25), -INT8_C(  33),  INT8_C(  12),
+       INT8_C( 125), -INT8_C(   3), -INT8_C(  96), -INT8_C(  52),  INT8_C(   4) };
+  static const int8_t b[] =
+    { -INT8_C(  65), -INT8_C(  42), -INT8_C(  71),  INT8_C(  74),  INT8_C(  95), -INT8_C(  62),  INT8_C(  59), -INT8_C(  52),
+       INT8_C( 121), -INT8_C(   8), -INT8_C(  37), -INT8_C(   9),  INT8_C(  26),  INT8_C(  12), -INT8_C(  95),  INT8_C(  21),
+      -INT8_C( 113), -INT8_C( 108),  INT8_C(  57), -INT8_C(  81), -INT8_C(  92), -INT8_C(  98),  INT8_C(  51),  INT8_C(  18),
+       INT8_C(  12), -INT8_C( 116), -INT8_C(  38), -INT8_C(   9),  INT8_C( 102), -INT8_C( 124), -INT8_C(  71),  INT8_C(  37),
+       INT8_C(  91),  INT8_C( 114),  INT8_C( 111), -INT8_C(  70),  INT8_C(  53), -INT8_C(  86), -INT8_C( 121), -INT8_C(  82),
+      -INT8_C(  93),  INT8_C(  98), -INT8_C(  91), -INT8_C(  67),  INT8_C( 110),  INT8_C(  71), -INT8_C(  46), -INT8_C(   3),
+      -INT8_C(  37),  INT8_C(  12), -INT8_C(  83),      INT8_MIN, -INT8_C(  86), -INT8_C(  32), -INT8_C( 110), -INT8_C(  74),
+       INT8_C( 108),  INT8_C( 108), -INT8_C(  83), -INT8_C(  46), -INT8_C(  15),  INT8_C( 102), -INT8_C(   9),  INT8_C(  76),
+      -INT8_C(  39),  INT8_C( 102),  INT8_C(   6),  INT8_C(  14),  INT8_C(  16), -INT8_C( 115), -INT8_C(  68), -INT8_C(  77),
+      -INT8_C(  17),  INT8_C(  98),  INT8_C( 112),  INT8_C(  94), -INT8_C(  87),  INT8_C(  67),  INT8_C(  91), -INT8_C( 124),
+       INT8_C(  79),  INT8_C(   8),  INT8_C(   4), -INT8_C(   7), -INT8_C(  24), -INT8_C( 106), -INT8_C(  81),  INT8_C(  84),
+       INT8_C(   3),  INT8_C(  92),  INT8_C(  38), -INT8_C(  12), -INT8_C(  62),  INT8_C(  29),  INT8_C(  64), -INT8_C( 101),
+      -INT8_C( 125),  INT8_C(  70), -INT8_C(  87), -INT8_C( 108), -INT8_C(  44),  INT8_C( 102),  INT8_C(  71), -INT8_C(  61),
+      -INT8_C(  56), -INT8_C(  72),  INT8_C(  33),  INT8_C( 113), -INT8_C(   5),  INT8_C( 125), -INT8_C(  11),  INT8_C(  74),
+      -INT8_C( 123), -INT8_C(   6),  INT8_C(  67),  INT8_C( 110), -INT8_C( 112), -INT8_C(  14), -INT8_C(  62), -INT8_C( 109),
+       INT8_C(  78), -INT8_C(  23), -INT8_C( 121),  INT8_C(  16),  INT8_C(   6), -INT8_C(  57), -INT8_C(  84), -INT8_C( 118),
+       INT8_C(  14),  INT8_C(  85),  INT8_C(  30), -INT8_C(  30), -INT8_C(  69),  INT8_C( 101), -INT8_C(  91), -INT8_C( 125),
+       INT8_C(  29), -INT8_C(  57), -INT8_C(  12),  INT8_C(  24),  INT8_C(  68), -INT8_C(  22),  INT8_C(  98), -INT8_C(  55),
+      -INT8_C(  28), -INT8_C(  91),  INT8_C(  55),  INT8_C( 116), -INT8_C( 105), -INT8_C(   6),  INT8_C(   8), -INT8_C(  27),
+      -INT8_C(  29), -INT8_C( 113), -INT8_C(  10), -INT8_C(  23),  INT8_C(  87), -INT8_C(  94),  INT8_C( 115),  INT8_C( 101),
+      -INT8_C(   9), -INT8_C( 111),  INT8_C(  71), -INT8_C(  77), -INT8_C(   9), -INT8_C(  20),  INT8_C(  54),  INT8_C(  20),
+      -INT8_C(  77),  INT8_C(  43),  INT8_C(  45), -INT8_C(   9),  INT8_C(  21), -INT8_C( 113), -INT8_C(  63), -INT8_C(   7),
+       INT8_C(  53), -INT8_C(   8),  INT8_C( 109), -INT8_C(  52), -INT8_C(  14),  INT8_C( 117), -INT8_C(  78), -INT8_C(  43),
+       INT8_C(   5), -INT8_C(  88), -INT8_C(  65),  INT8_C(  92),  INT8_C(  74),  INT8_C(  50), -INT8_C(  63),  INT8_C(  65),
+      -INT8_C(  60),  INT8_C(   8), -INT8_C(  12), -INT8_C(  69), -INT8_C(  12),  INT8_C(  43), -INT8_C(  49), -INT8_C(  88),
+       INT8_C(  86), -INT8_C(   4), -INT8_C(  97),  INT8_C( 107), -INT8_C( 116),  INT8_C(  96),  INT8_C( 100), -INT8_C(  63),
+       INT8_C(  89), -INT8_C(  47), -INT8_C( 115),  INT8_C(  75),  INT8_C(  71),  INT8_C(  63),  INT8_C(  33),  INT8_C(  76),
+      -INT8_C(  25), -INT8_C(  32), -INT8_C(  88),  INT8_C(  49),  INT8_C(  18),  INT8_C( 105),  INT8_C( 115), -INT8_C(  42),
+       INT8_C( 113),  INT8_C( 103), -INT8_C( 111),  INT8_C( 101), -INT8_C( 110),  INT8_C(  97),  INT8_C(  13), -INT8_C(  24),
+       INT8_C(  93), -INT8_C(  83),  INT8_C(  83), -INT8_C(  23),  INT8_C(  13), -INT8_C(  73), -INT8_C(  86),  INT8_C( 102),
+      -INT8_C( 119),  INT8_C(  56), -INT8_C(  78), -INT8_C(  48),  INT8_C( 119), -INT8_C(  45),  INT8_C(  28),  INT8_C(  95),
+      -INT8_C(  77), -INT8_C(  60), -INT8_C( 112), -INT8_C(  59),  INT8_C(  45),  INT8_C(   3), -INT8_C( 100), -INT8_C(  98),
+       INT8_C( 107),  INT8_C(  45),  INT8_C(   3), -INT8_C(   3), -INT8_C( 114),  INT8_C(  17), -INT8_C(  26), -INT8_C(  20),
+      -INT8_C(  66),  INT8_C(  57), -INT8_C(  43), -INT8_C(  53), -INT8_C(  15),      INT8_MIN,  INT8_C(  50),  INT8_C( 122),
+      -INT8_C(  72), -INT8_C(  28),  INT8_C(  74),  INT8_C(  47), -INT8_C(  73),  INT8_C( 102), -INT8_C( 114),  INT8_C( 106),
+       INT8_C(  42),  INT8_C(  31),  INT8_C(  47),  INT8_C(  87),  INT8_C(  34), -INT8_C(  53), -INT8_C(  11), -INT8_C( 115),
+      -INT8_C(   7), -INT8_C(   8), -INT8_C( 117), -INT8_C( 121),  INT8_C(   9),  INT8_C( 113),  INT8_C( 115), -INT8_C(  57),
+      -INT8_C(  86),  INT8_C(  73), -INT8_C( 109), -INT8_C( 101), -INT8_C(  55), -INT8_C(  59),  INT8_C(  21), -INT8_C( 127),
+      -INT8_C(  87),  INT8_C(  95), -INT8_C(  80),  INT8_C(  96), -INT8_C(  59),  INT8_C(  63), -INT8_C(  54), -INT8_C(  17),
+       INT8_C(  94), -INT8_C(   7),  INT8_C(  70),      INT8_MIN, -INT8_C(  59),  INT8_C(  59),  INT8_C(  14), -INT8_C(  66),
+       INT8_C(  52), -INT8_C( 103),  INT8_C(  69),  INT8_C(  61),  INT8_C(  10), -INT8_C(  71),  INT8_C(   5), -INT8_C(  76),
+       INT8_C(   2), -INT8_C( 104),  INT8_C(  80), -INT8_C(  53),  INT8_C(  93),  INT8_C( 101),  INT8_C(  76),  INT8_C(   6),
+      -INT8_C(  59), -INT8_C(   4),  INT8_C( 102), -INT8_C( 118),  INT8_C(  59),  INT8_C(  48),  INT8_C( 122), -INT8_C( 103),
+       INT8_C(  41), -INT8_C(  64),  INT8_C(  26), -INT8_C(  18), -INT8_C(   4),  INT8_C(  40), -INT8_C(  84),  INT8_C(  48),
+      -INT8_C(  63), -INT8_C(  14),  INT8_C( 109), -INT8_C(  53), -INT8_C(  85),  INT8_C( 114),      INT8_MAX, -INT8_C(  83),
+       INT8_C(  10), -INT8_C(  49),  INT8_C( 120),  INT8_C( 103),  INT8_C(  53), -INT8_C(  60),  INT8_C( 109), -INT8_C(   6),
+      -INT8_C(  64), -INT8_C(  45), -INT8_C( 124), -INT8_C(   4),  INT8_C(   3), -INT8_C(   2), -INT8_C( 107),  INT8_C(  45),
+      -INT8_C(  65), -INT8_C(  81),  INT8_C(  27), -INT8_C(  69), -INT8_C(  41), -INT8_C(  56), -INT8_C(  21), -INT8_C( 104),
+      -INT8_C(  70),  INT8_C(  88),  INT8_C(  99),  INT8_C( 101), -INT8_C(  53), -INT8_C(  29),  INT8_C(  18), -INT8_C(  43),
+      -INT8_C(  78), -INT8_C( 118),  INT8_C(  61), -INT8_C(  25),  INT8_C(  78), -INT8_C(  86), -INT8_C(  31),  INT8_C(  14),
+       INT8_C( 126),  INT8_C( 102),  INT8_C(  10), -INT8_C( 127),  INT8_C( 100), -INT8_C(  96), -INT8_C(  82),  INT8_C(  35),
+       INT8_C(  79), -INT8_C(  54), -INT8_C(  34),  INT8_C(  39), -INT8_C( 110), -INT8_C(  55), -INT8_C(  65),  INT8_C(  76),
+       INT8_C(  34),  INT8_C(  35), -INT8_C(  79), -INT8_C(  19),  INT8_C(   6), -INT8_C(  61), -INT8_C(  62), -INT8_C(  72),
+       INT8_C(  77), -INT8_C(   1), -INT8_C(  96), -INT8_C( 101), -INT8_C(  86), -INT8_C( 127), -INT8_C(  87),  INT8_C(  40),
+      -INT8_C(  25), -INT8_C(  76), -INT8_C(  87),  INT8_C(  76),  INT8_C(  84),  INT8_C(  88),  INT8_C( 111), -INT8_C(  93),
+       INT8_C(  34),  INT8_C(  78), -INT8_C(  54), -INT8_C(  76),  INT8_C(  23), -INT8_C( 118),  INT8_C(   0),  INT8_C(  57),
+      -INT8_C(  83), -INT8_C(  79),  INT8_C(  38), -INT8_C(  77),  INT8_C( 116), -INT8_C(  23),  INT8_C( 107), -INT8_C(  63),
+      -INT8_C(  24),  INT8_C(  11),  INT8_C(  92), -INT8_C( 110), -INT8_C( 115),  INT8_C(   5), -INT8_C(  70),  INT8_C( 116),
+      -INT8_C(  71),  INT8_C( 100), -INT8_C(  64),  INT8_C(  13), -INT8_C(  68),  INT8_C(  48), -INT8_C(  79), -INT8_C(  34),
+       INT8_C( 126),  INT8_C( 123), -INT8_C( 110), -INT8_C( 107),  INT8_C(   5), -INT8_C( 110), -INT8_C(  49), -INT8_C(  78),
+       INT8_C(  67), -INT8_C(  11),  INT8_C( 101), -INT8_C(  73), -INT8_C(  34), -INT8_C(  47),  INT8_C( 120), -INT8_C(  57),
+      -INT8_C(  36), -INT8_C(  44),  INT8_C(  89),  INT8_C( 105), -INT8_C(  39),  INT8_C(  20), -INT8_C(  34), -INT8_C( 109),
+       INT8_C( 120), -INT8_C(  98), -INT8_C(  96),  INT8_C(  52), -INT8_C(  50),  INT8_C(  81),  INT8_C(  18),  INT8_C(  76),
+      -INT8_C(  51), -INT8_C(  92), -INT8_C(  30), -INT8_C(  46),  INT8_C(  54), -INT8_C(  79), -INT8_C( 123),  INT8_C( 121),
+      -INT8_C(  90), -INT8_C(  22),  INT8_C(  48), -INT8_C( 123), -INT8_C(  69), -INT8_C(  88),  INT8_C(  76), -INT8_C( 104),
+       INT8_C( 124), -INT8_C(  91),  INT8_C(   1),  INT8_C(  85), -INT8_C(  71), -INT8_C(  33), -INT8_C(  24),  INT8_C(  49),
+       INT8_C( 126), -INT8_C( 119),  INT8_C( 101),  INT8_C(  76), -INT8_C(  38),  INT8_C( 119), -INT8_C( 103), -INT8_C(  89),
+       INT8_C(  27),  INT8_C( 123),  INT8_C( 122),  INT8_C(  81),  INT8_C(  44) };
+  static const int8_t e[] =
+    { -INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C(  26),  INT8_C(   0), -INT8_C(  34), -INT8_C(  23),  INT8_C(   0),
+       INT8_C( 118),  INT8_C(   0), -INT8_C(  42),  INT8_C(  14),  INT8_C(   0),  INT8_C(  28),  INT8_C(   0), -INT8_C(  82),
+       INT8_C(   0),  INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C( 124), -INT8_C(  78),  INT8_C(  36), -INT8_C( 116),
+       INT8_C(  76),  INT8_C(  60),  INT8_C(   0),  INT8_C(  25),  INT8_C(   0), -INT8_C(  64),  INT8_C(  16), -INT8_C(  45),
+      -INT8_C(  38),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  91),  INT8_C(   0),  INT8_C( 125),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  39),
+       INT8_C(   0),  INT8_C(  92), -INT8_C(  76),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(  86),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   4), -INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(  62),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  60),  INT8_C(  96),  INT8_C(  82), -INT8_C(  54), -INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C( 126),
+       INT8_C(  68),  INT8_C(   0),  INT8_C(   0), -INT8_C(  46),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23),  INT8_C( 100),
+      -INT8_C(   2), -INT8_C(  56),  INT8_C(   0),  INT8_C(   0),  INT8_C(  40), -INT8_C(  58), -INT8_C(  60),  INT8_C(   0),
+      -INT8_C(  30),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  12), -INT8_C(   2),  INT8_C( 124),  INT8_C(   0),  INT8_C(   4),  INT8_C(  50),  INT8_C(  55),
+       INT8_C(  48), -INT8_C(  24), -INT8_C(  28),  INT8_C(   0), -INT8_C(  16),  INT8_C( 117),  INT8_C(   4),  INT8_C(  62),
+       INT8_C(   0), -INT8_C( 124), -INT8_C(  37),  INT8_C(   0), -INT8_C(  80), -INT8_C(  70),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 104),  INT8_C( 125),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  22),  INT8_C(  89), -INT8_C(  16), -INT8_C(   4),  INT8_C(   0), -INT8_C(  98), -INT8_C(  89),  INT8_C(   0),
+       INT8_C(   0),  INT8_C( 121),  INT8_C(   0),  INT8_C(  48),  INT8_C(   0), -INT8_C(  96), -INT8_C( 118),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  22),  INT8_C(   0),  INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 101),  INT8_C(  29),  INT8_C(   0), -INT8_C( 117),  INT8_C(   0), -INT8_C( 100),  INT8_C( 120),  INT8_C(  60),
+      -INT8_C( 123),  INT8_C(  65),  INT8_C( 102),  INT8_C(  10),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33), -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 106),  INT8_C(  82),
+      -INT8_C(  85), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(   0),  INT8_C( 105),  INT8_C(   0),
+       INT8_C(  28), -INT8_C( 104),  INT8_C(   0), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0), -INT8_C(  63),
+      -INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(  13), -INT8_C( 120), -INT8_C(   1),  INT8_C(  82), -INT8_C( 108),
+      -INT8_C(  61),  INT8_C(   0), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),  INT8_C(   0),  INT8_C( 116),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  45),  INT8_C(   0),  INT8_C(   0),  INT8_C( 117), -INT8_C(  53), -INT8_C(  96),
+       INT8_C(   0),  INT8_C(  29), -INT8_C(  39), -INT8_C( 109), -INT8_C(  79), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 112),  INT8_C(  23), -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  42), -INT8_C(  92),  INT8_C(  80),  INT8_C(  45),  INT8_C(   0), -INT8_C(  69), -INT8_C( 124),  INT8_C(  48),
+       INT8_C(   0), -INT8_C(  60),  INT8_C(   0),  INT8_C(  44),  INT8_C(  62),  INT8_C(   9),  INT8_C(   0),  INT8_C( 108),
+      -INT8_C(  22), -INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(  13),  INT8_C(   0),  INT8_C(   2),  INT8_C(  78),
+      -INT8_C(   8), -INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98), -INT8_C( 114),  INT8_C(  12),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  89),  INT8_C(  99),  INT8_C(   0),  INT8_C(  58),  INT8_C(  97),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  45),  INT8_C(   0),  INT8_C(   0), -INT8_C(  92),  INT8_C( 124),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  41),  INT8_C(  33),  INT8_C(   0), -INT8_C(  38),
+       INT8_C(   0),  INT8_C(  45),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0), -INT8_C( 117),  INT8_C(   0),  INT8_C(  74),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  77),  INT8_C(  51),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  38), -INT8_C(  70),  INT8_C(   0), -INT8_C(  93),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  60),  INT8_C(   0),
+       INT8_C(  74),  INT8_C(   0),  INT8_C( 114), -INT8_C(  92), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  84),  INT8_C(   0), -INT8_C( 108),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  40),  INT8_C(  77),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 115),
+       INT8_C( 126),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),  INT8_C( 105),  INT8_C(  72), -INT8_C( 100),  INT8_C(  22),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  72),  INT8_C(  20),  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  63),  INT8_C(   0), -INT8_C(  46),  INT8_C(   0),  INT8_C(   0), -INT8_C(  24), -INT8_C(  15), -INT8_C(  80),
+      -INT8_C(  92),  INT8_C(   0), -INT8_C( 106),      INT8_MIN,  INT8_C( 116), -INT8_C(  89),  INT8_C(   0),  INT8_C(  16),
+       INT8_C(   0), -INT8_C(  20), -INT8_C( 116), -INT8_C(  90), -INT8_C(  96),  INT8_C(   0), -INT8_C(  15),  INT8_C( 104),
+       INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36),  INT8_C(  98),
+      -INT8_C(  37),  INT8_C(  72),  INT8_C(   0), -INT8_C(  96),  INT8_C(   0),  INT8_C(  78), -INT8_C( 114), -INT8_C(  16),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  26),  INT8_C(  98),  INT8_C(  62),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  47), -INT8_C(  48), -INT8_C( 120),
+       INT8_C(  83),  INT8_C(   0),  INT8_C(  10),  INT8_C(   0),  INT8_C(  24),  INT8_C(  64), -INT8_C(  49),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0), -INT8_C( 110),  INT8_C(   0),  INT8_C(  46),
+      -INT8_C(  27),  INT8_C(   0),  INT8_C( 110),  INT8_C(  30),  INT8_C(  68), -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C( 124), -INT8_C(  86),  INT8_C(   0),  INT8_C( 126),  INT8_C(  44),
+       INT8_C(   0),  INT8_C(   0),      INT8_MIN, -INT8_C(  86), -INT8_C(  52), -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  31),  INT8_C(   6),  INT8_C( 103), -INT8_C(  84),
+      -INT8_C(  82), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   8),  INT8_C( 100),  INT8_C(   0),  INT8_C(   0), -INT8_C(  14), -INT8_C(   8),  INT8_C(   0),  INT8_C(  18),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  96),  INT8_C(   0),  INT8_C(  46), -INT8_C(  50),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  57),  INT8_C(  65),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),  INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  51),  INT8_C(  35),  INT8_C(   0),  INT8_C(  66),  INT8_C(  72),  INT8_C(   0),
+      -INT8_C( 120),  INT8_C(   0),  INT8_C(   0), -INT8_C(  36), -INT8_C( 126), -INT8_C(  97),  INT8_C(   0), -INT8_C(  44),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  80) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_s8_z(pv, av, bv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+
+    ev = simde_svmul_s8_z(pv, av, bv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) };
+  static const int8_t a[] =
+    {  INT8_C(  60),  INT8_C( 124),  INT8_C(   9), -INT8_C( 104), -INT8_C(  94),  INT8_C(  52), -INT8_C(  43),  INT8_C( 119),
+       INT8_C(  92),  INT8_C( 107), -INT8_C(   8), -INT8_C(  90),  INT8_C(  46),  INT8_C(  98),  INT8_C( 103),  INT8_C(  13),
+      -INT8_C(  47), -INT8_C(  66),  INT8_C(  93),  INT8_C(  11), -INT8_C(  33), -INT8_C(   3),  INT8_C( 125), -INT8_C( 105),
+      -INT8_C(  53),  INT8_C(  89), -INT8_C(  94), -INT8_C(   7), -INT8_C( 127),  INT8_C(  63), -INT8_C(  41), -INT8_C(  67),
+      -INT8_C(  68), -INT8_C(  32),  INT8_C(  85),  INT8_C(  94),  INT8_C(  20),  INT8_C(  42), -INT8_C(  42),  INT8_C( 113),
+      -INT8_C( 107), -INT8_C(  50),  INT8_C(  23), -INT8_C(  61),  INT8_C(  48),      INT8_MAX, -INT8_C(  48),  INT8_C(   2),
+       INT8_C(  61),  INT8_C(  45),  INT8_C(  13),  INT8_C(  28),  INT8_C(  42), -INT8_C( 117), -INT8_C(  77), -INT8_C(  10),
+      -INT8_C(  28),  INT8_C(  86), -INT8_C(  17),  INT8_C( 101), -INT8_C( 107), -INT8_C(  58),  INT8_C(  34),  INT8_C(  81),
+      -INT8_C(  90),  INT8_C( 120), -INT8_C(  80), -INT8_C(  70), -INT8_C(  94), -INT8_C( 122),  INT8_C(  43),  INT8_C(  56),
+       INT8_C(  84),  INT8_C(  67), -INT8_C(   5), -INT8_C( 124), -INT8_C(  62), -INT8_C(  52), -INT8_C( 122), -INT8_C(   1),
+      -INT8_C(   7), -INT8_C( 108),  INT8_C(  27),  INT8_C(  36),  INT8_C(  31), -INT8_C(  49),  INT8_C(  26),  INT8_C(   3),
+       INT8_C(  37),  INT8_C(   9),  INT8_C( 105), -INT8_C(  70), -INT8_C(  49), -INT8_C( 117),  INT8_C(  12),  INT8_C( 117),
+       INT8_C(   3), -INT8_C(  68),  INT8_C(  47), -INT8_C(  90),  INT8_C(  66),  INT8_C(  91), -INT8_C(  34), -INT8_C( 106),
+      -INT8_C(  98), -INT8_C(  39),  INT8_C(  26),  INT8_C(  96), -INT8_C(  91), -INT8_C(  95),  INT8_C(  95), -INT8_C(  97),
+       INT8_C(  53),  INT8_C( 122), -INT8_C(  61),  INT8_C(  84),  INT8_C(  73), -INT8_C(  35),  INT8_C(  87),  INT8_C( 110),
+      -INT8_C(  26), -INT8_C(  64),  INT8_C(  41), -INT8_C(  75),  INT8_C(  76),  INT8_C(  53),  INT8_C(  42),  INT8_C(  79),
+      -INT8_C(  15),  INT8_C(  89), -INT8_C(  11),  INT8_C(  51), -INT8_C(  76), -INT8_C(  45), -INT8_C(  55),  INT8_C(  82),
+      -INT8_C(  83), -INT8_C(  29), -INT8_C(  78),  INT8_C(  82), -INT8_C( 124),  INT8_C(  17), -INT8_C(  15), -INT8_C(  71),
+      -INT8_C( 116), -INT8_C(  76),  INT8_C(  13), -INT8_C(  43), -INT8_C( 111),  INT8_C( 101),  INT8_C(  68),  INT8_C( 119),
+       INT8_C(  37),  INT8_C( 109),  INT8_C(  44),  INT8_C( 113), -INT8_C(  94),  INT8_C(  86), -INT8_C(  63), -INT8_C( 109),
+      -INT8_C(  80), -INT8_C(  74), -INT8_C(  58),  INT8_C( 100), -INT8_C( 118), -INT8_C( 113), -INT8_C(  73),  INT8_C(  55),
+       INT8_C( 114),  INT8_C( 105), -INT8_C( 119), -INT8_C(   9),  INT8_C( 123),  INT8_C( 123), -INT8_C(  80),  INT8_C(   7),
+       INT8_C(  47), -INT8_C(  66), -INT8_C(  36), -INT8_C(  63),  INT8_C(  35),  INT8_C(  32),  INT8_C(  56),  INT8_C(  72),
+      -INT8_C( 115),  INT8_C( 101), -INT8_C(  70),  INT8_C(  47), -INT8_C(  69),  INT8_C( 123), -INT8_C(  62),  INT8_C( 107),
+       INT8_C(  49), -INT8_C( 120), -INT8_C(  48), -INT8_C(  69),  INT8_C(  23), -INT8_C( 121), -INT8_C(  14), -INT8_C( 118),
+      -INT8_C(  16),  INT8_C( 124), -INT8_C( 127),  INT8_C( 107), -INT8_C(   9),  INT8_C(  49),  INT8_C( 114),  INT8_C(  38),
+      -INT8_C(  17),  INT8_C(  79), -INT8_C(  25),  INT8_C(  18),  INT8_C( 111),  INT8_C(  32),  INT8_C(  91), -INT8_C(   3),
+      -INT8_C( 123),  INT8_C(  21),  INT8_C(  44),  INT8_C(  64), -INT8_C( 112), -INT8_C(  17), -INT8_C(  84), -INT8_C(  63),
+       INT8_C( 119),  INT8_C( 124),  INT8_C( 125), -INT8_C( 113),  INT8_C(   3),  INT8_C( 111),  INT8_C(  25), -INT8_C(  13),
+      -INT8_C(  21), -INT8_C( 102),  INT8_C(  95), -INT8_C(  30), -INT8_C(  53), -INT8_C(  47),  INT8_C(   9), -INT8_C(  69),
+       INT8_C(  32), -INT8_C(  16), -INT8_C(  51), -INT8_C( 112),  INT8_C(  16),  INT8_C(  40), -INT8_C( 115), -INT8_C( 107),
+       INT8_C(  61), -INT8_C(  71), -INT8_C(  42), -INT8_C(  51), -INT8_C(  88), -INT8_C( 126), -INT8_C( 113),  INT8_C(  32),
+      -INT8_C(   2),  INT8_C(  12), -INT8_C(  81),  INT8_C(   1),  INT8_C( 123), -INT8_C(  56), -INT8_C(  12),  INT8_C( 103),
+       INT8_C(  98),  INT8_C(  83),  INT8_C(  73),  INT8_C(  45),  INT8_C(  37),  INT8_C(  82), -INT8_C(  24),  INT8_C(  69),
+       INT8_C(  67), -INT8_C(  74), -INT8_C(  43),  INT8_C(  83), -INT8_C(  34),  INT8_C(  98), -INT8_C(  23),  INT8_C(  28),
+       INT8_C(  28), -INT8_C(  65), -INT8_C(  23), -INT8_C(  60),  INT8_C(  65),  INT8_C( 120), -INT8_C(  28),  INT8_C(  63),
+      -INT8_C( 124), -INT8_C( 109),  INT8_C(  64),  INT8_C(   0),  INT8_C(  91),  INT8_C(  52),  INT8_C( 103), -INT8_C(  67),
+      -INT8_C( 120), -INT8_C(  80), -INT8_C(  21), -INT8_C(  83),  INT8_C(   3), -INT8_C(  45), -INT8_C(  14),  INT8_C(  70),
+      -INT8_C( 119), -INT8_C(  56), -INT8_C( 103),  INT8_C( 104),  INT8_C(  42), -INT8_C( 126), -INT8_C( 124),  INT8_C(  70),
+       INT8_C(  65),  INT8_C( 109),  INT8_C(  11), -INT8_C( 126), -INT8_C(  26), -INT8_C(  17), -INT8_C(  63),  INT8_C( 106),
+      -INT8_C( 125),  INT8_C(   1),  INT8_C( 106), -INT8_C(  34),  INT8_C(  54), -INT8_C(  47), -INT8_C( 100), -INT8_C(  66),
+      -INT8_C( 126), -INT8_C( 121),  INT8_C( 107), -INT8_C( 123),  INT8_C(  90),  INT8_C(  93), -INT8_C(  53), -INT8_C(  28),
+       INT8_C(  37),  INT8_C( 100),  INT8_C(  76),  INT8_C(  80), -INT8_C(  25), -INT8_C(  48), -INT8_C( 106),  INT8_C(  40),
+       INT8_C(  61), -INT8_C(  95), -INT8_C(  85),  INT8_C(  35), -INT8_C( 111),  INT8_C( 108), -INT8_C( 114),  INT8_C(  20),
+       INT8_C( 110), -INT8_C(   8), -INT8_C(  14), -INT8_C(  92), -INT8_C(  54), -INT8_C( 114),  INT8_C(  98),  INT8_C(  76),
+       INT8_C(  21), -INT8_C(  51), -INT8_C(  47),  INT8_C( 112),  INT8_C(  42), -INT8_C( 100),  INT8_C(  84),  INT8_C(  80),
+       INT8_C(   0), -INT8_C(  96), -INT8_C(  96), -INT8_C(  25),  INT8_C( 112),  INT8_C(  54),  INT8_C(  16), -INT8_C(  83),
+      -INT8_C(  40), -INT8_C(  69), -INT8_C(  47),  INT8_C( 105),  INT8_C(  39),  INT8_C(  95),  INT8_C( 125), -INT8_C( 107),
+       INT8_C(  87),  INT8_C( 111),  INT8_C(  57),  INT8_C(  33), -INT8_C(   2), -INT8_C( 101),  INT8_C( 109),  INT8_C(  19),
+       INT8_C( 104),  INT8_C(  62), -INT8_C( 125), -INT8_C( 109), -INT8_C(  38), -INT8_C(  41), -INT8_C(  29), -INT8_C(  37),
+       INT8_C( 119), -INT8_C( 125), -INT8_C(  62), -INT8_C(  25), -INT8_C(  71), -INT8_C(  46), -INT8_C( 107), -INT8_C( 111),
+      -INT8_C( 115),  INT8_C( 102), -INT8_C(   6), -INT8_C(  75), -INT8_C(  59),  INT8_C( 119),  INT8_C(  74),  INT8_C(  28),
+      -INT8_C(  25), -INT8_C( 124),  INT8_C(  62), -INT8_C(  27),  INT8_C(  31), -INT8_C(  85), -INT8_C(   8), -INT8_C( 120),
+      -INT8_C(  22),  INT8_C( 124),  INT8_C(  27), -INT8_C(  60),  INT8_C(  83), -INT8_C(   2), -INT8_C(  97), -INT8_C(  53),
+      -INT8_C( 127),  INT8_C(  98), -INT8_C(  78),  INT8_C(  58),  INT8_C(  52),  INT8_C(  71), -INT8_C(  52), -INT8_C(  62),
+      -INT8_C(  83), -INT8_C(  58),  INT8_C( 119),  INT8_C( 114),  INT8_C(  62), -INT8_C(  63), -INT8_C( 113),  INT8_C(  37),
+       INT8_C(  69), -INT8_C(  51),  INT8_C(  10),  INT8_C( 101),  INT8_C( 120),  INT8_C(   2), -INT8_C(  19),  INT8_C(  98),
+       INT8_C( 126),  INT8_C(   8),  INT8_C(  39), -INT8_C(  46),  INT8_C(   6), -INT8_C(  58), -INT8_C(  99), -INT8_C( 121),
+       INT8_C(  40),  INT8_C(  79), -INT8_C(  63),  INT8_C(  93), -INT8_C( 105), -INT8_C( 115),  INT8_C(  31),  INT8_C(  68),
+       INT8_C(  84), -INT8_C( 106), -INT8_C(  73), -INT8_C( 110),  INT8_C(  87),  INT8_C(  70), -INT8_C(  73), -INT8_C(  99),
+       INT8_C(  19), -INT8_C(  63),  INT8_C(   2), -INT8_C( 117), -INT8_C(  61), -INT8_C(  17), -INT8_C(  18),  INT8_C(  66),
+      -INT8_C(   9),  INT8_C(  21),  INT8_C(  20), -INT8_C(   3), -INT8_C(  37), -INT8_C(  79), -INT8_C( 124),  INT8_C(   4),
+       INT8_C(   0),  INT8_C(  69),  INT8_C(  97), -INT8_C( 105), -INT8_C(  45),      INT8_MIN, -INT8_C(  36),  INT8_C(  39),
+       INT8_C(  22), -INT8_C( 109), -INT8_C(  71),  INT8_C( 109), -INT8_C(  39),  INT8_C( 112),  INT8_C(  10), -INT8_C(  20),
+       INT8_C(  49),  INT8_C(  12),  INT8_C( 119), -INT8_C(  12), -INT8_C(   5),  INT8_C( 101),  INT8_C(  54), -INT8_C(  14),
+       INT8_C( 122),  INT8_C(  74), -INT8_C(  17),  INT8_C(  86), -INT8_C(   5),  INT8_C( 115),  INT8_C(  90), -INT8_C(   4),
+      -INT8_C(  71), -INT8_C(  69), -INT8_C( 109), -INT8_C( 116),  INT8_C(  59),  INT8_C( 111), -INT8_C(  77),  INT8_C(  81),
+       INT8_C(   2),  INT8_C( 108), -INT8_C(  66), -INT8_C(  37), -INT8_C(  36), -INT8_C(  55), -INT8_C(  57),  INT8_C(  13),
+      -INT8_C(  43),  INT8_C(  63),  INT8_C(   1), -INT8_C(  47), -INT8_C(  92),  INT8_C(  56), -INT8_C(  61),  INT8_C(  31),
+      -INT8_C( 126), -INT8_C(  77),  INT8_C( 117),  INT8_C( 126),  INT8_C(  38), -INT8_C(  49),  INT8_C( 122), -INT8_C(  33),
+      -INT8_C( 118),  INT8_C(  13),  INT8_C( 107), -INT8_C(  59),  INT8_C( 125),  INT8_C(  30),  INT8_C(  22),      INT8_MAX,
+      -INT8_C( 118), -INT8_C(  44),  INT8_C(  91),  INT8_C( 102), -INT8_C(  99),  INT8_C(  34),  INT8_C( 115),  INT8_C( 115),
+       INT8_C(  97),  INT8_C( 117),  INT8_C(  68),  INT8_C(   6), -INT8_C(  83),  INT8_C(   7),  INT8_C(  37),  INT8_C(  47),
+      -INT8_C(  70), -INT8_C( 102), -INT8_C(  83), -INT8_C(  31),  INT8_C( 105),  INT8_C(  39), -INT8_C(  64), -INT8_C(  13),
+       INT8_C(  53),  INT8_C(  44), -INT8_C(  72), -INT8_C(  78),  INT8_C(  74), -INT8_C(  50),  INT8_C(  49), -INT8_C(  43),
+      -INT8_C(  94), -INT8_C( 116),  INT8_C(  59),  INT8_C(  64), -INT8_C(  81), -INT8_C(  81), -INT8_C(  77),  INT8_C(  16),
+       INT8_C(  36), -INT8_C(   9),  INT8_C(  22), -INT8_C(  47), -INT8_C(   2),  INT8_C(  59),  INT8_C(   0), -INT8_C(  71),
+      -INT8_C(  43), -INT8_C(  82), -INT8_C( 102),  INT8_C(  62), -INT8_C(  43),  INT8_C(  90),  INT8_C(  49),  INT8_C(  10),
+      -INT8_C( 122), -INT8_C(  23), -INT8_C(  68), -INT8_C(  47), -INT8_C(  73), -INT8_C(  18), -INT8_C(  90),  INT8_C(  90),
+       INT8_C( 122), -INT8_C(  31), -INT8_C( 102),  INT8_C(  41), -INT8_C( 112),  INT8_C(  77),  INT8_C(  58), -INT8_C(  76),
+       INT8_C(  68),  INT8_C(  80), -INT8_C( 123),  INT8_C(  66), -INT8_C( 116), -INT8_C( 122), -INT8_C(   5),  INT8_C(  97),
+       INT8_C(  52), -INT8_C( 107), -INT8_C(  96),  INT8_C(   9), -INT8_C(  16), -INT8_C(  47),  INT8_C(  20),  INT8_C( 118),
+      -INT8_C(  69), -INT8_C(  48),  INT8_C(  71),  INT8_C( 114), -INT8_C(  66), -INT8_C(  19), -INT8_C(  52),  INT8_C(  57),
+      -INT8_C(  49),  INT8_C( 102),  INT8_C(  98),  INT8_C(  95), -INT8_C(  77), -INT8_C( 100),  INT8_C(  20), -INT8_C(   9),
+      -INT8_C(  19), -INT8_C( 103),  INT8_C(  58),  INT8_C( 121),  INT8_C(  31),  INT8_C(  53), -INT8_C(  38),  INT8_C(  83),
+      -INT8_C(  53),  INT8_C( 122),  INT8_C(  93), -INT8_C(  69),  INT8_C(  76),  INT8_C( 113),  INT8_C(  49),  INT8_C(   7),
+       INT8_C(  65),  INT8_C( 121),  INT8_C( 121),  INT8_C(   0),  INT8_C( 102),  INT8_C(  70),  INT8_C(  57),  INT8_C(  53),
+      -INT8_C(  84), -INT8_C( 101), -INT8_C( 107),  INT8_C(  96),  INT8_C(  56), -INT8_C(  87),  INT8_C(  87),  INT8_C(  37),
+       INT8_C(  66), -INT8_C( 111), -INT8_C(  98),  INT8_C(  98), -INT8_C(  57),  INT8_C( 120), -INT8_C(  75), -INT8_C( 110),
+      -INT8_C(  13),  INT8_C(  18),  INT8_C(  77),  INT8_C(  63), -INT8_C( 125),  INT8_C( 126),  INT8_C(  70), -INT8_C(  59),
+      -INT8_C(   9), -INT8_C(  65), -INT8_C(  59),  INT8_C(  94),  INT8_C(   5), -INT8_C(   2), -INT8_C( 109), -INT8_C(  78),
+      -INT8_C( 103),  INT8_C(  40),  INT8_C(  18), -INT8_C(  47), -INT8_C(  47),  INT8_C( 105), -INT8_C(  10),  INT8_C(  20),
+      -INT8_C(   5), -INT8_C( 108),  INT8_C( 118), -INT8_C(  62),  INT8_C(  13),  INT8_C(  43),  INT8_C(  84),  INT8_C(   0),
+       INT8_C(  62), -INT8_C(  95),  INT8_C(  63), -INT8_C(  63),  INT8_C(  31), -INT8_C( 123), -INT8_C( 122),  INT8_C(  23),
+       INT8_C(  68),  INT8_C(  75),  INT8_C( 117),  INT8_C(  74),  INT8_C(  73),  INT8_C(   8), -INT8_C(   4), -INT8_C(  29),
+       INT8_C(  49),  INT8_C(  14), -INT8_C(  76),  INT8_C(   2),  INT8_C( 119), -INT8_C(  85),  INT8_C(  22),  INT8_C( 114),
+       INT8_C(  63), -INT8_C( 116),  INT8_C(  52),  INT8_C(  76), -INT8_C(  72), -INT8_C( 120),  INT8_C(  76), -INT8_C(  10),
+       INT8_C(  41), -INT8_C( 117), -INT8_C(  73),  INT8_C(  73),  INT8_C(  16),  INT8_C(  62),  INT8_C(  96),  INT8_C(  85),
+      -INT8_C( 119), -INT8_C(  43), -INT8_C(  97), -INT8_C(  45), -INT8_C(  35), -INT8_C( 101), -INT8_C(  74),  INT8_C(  14),
+      -INT8_C(  87),  INT8_C( 106),  INT8_C(  17),  INT8_C(  32),  INT8_C(  21),  INT8_C(  39), -INT8_C( 109),  INT8_C(  85),
+      -INT8_C(  76), -INT8_C(  57), -INT8_C(  95),  INT8_C( 108),  INT8_C(  80), -INT8_C(  18),  INT8_C(  98),  INT8_C( 121),
+       INT8_C( 121),  INT8_C(  25), -INT8_C(  62), -INT8_C( 118),  INT8_C(  87),  INT8_C(  34), -INT8_C(  33), -INT8_C(  31),
+      -INT8_C(   9),  INT8_C( 126), -INT8_C(  76), -INT8_C(  43),  INT8_C(  25),  INT8_C( 106), -INT8_C(  29), -INT8_C(  62),
+      -INT8_C(  44), -INT8_C(  12), -INT8_C(  30), -INT8_C(  22),  INT8_C(  28),  INT8_C( 117),  INT8_C(  63), -INT8_C(  48),
+       INT8_C(  61), -INT8_C(  32),  INT8_C(  60), -INT8_C( 115), -INT8_C(  50), -INT8_C(  98),  INT8_C(   6),  INT8_C(  72),
+      -INT8_C(  73), -INT8_C(  55), -INT8_C(  46),  INT8_C(  15), -INT8_C(  21), -INT8_C(  79), -INT8_C(  16), -INT8_C(  29),
+       INT8_C(  47), -INT8_C(  92), -INT8_C(  72),  INT8_C(  72),  INT8_C(  14), -INT8_C( 101),  INT8_C(  10), -INT8_C(  30),
+      -INT8_C( 112), -INT8_C(  20), -INT8_C(  52), -INT8_C(  84),  INT8_C(  98),  INT8_C(  11),  INT8_C( 124), -INT8_C(  97),
+      -INT8_C(  20), -INT8_C(  72),  INT8_C(  44), -INT8_C(  70),  INT8_C(  86),  INT8_C(  50),  INT8_C(   2),  INT8_C(  13),
+      -INT8_C(   5), -INT8_C(  44),  INT8_C(  28), -INT8_C(  25), -INT8_C( 123),  INT8_C(  12), -INT8_C(  54), -INT8_C(  76),
+      -INT8_C(  80), -INT8_C( 126), -INT8_C(   4), -INT8_C(  66),  INT8_C(  29),  INT8_C(   6), -INT8_C(  95), -INT8_C(  83),
+      -INT8_C(  13),  INT8_C( 109),  INT8_C(  89),  INT8_C(  85),  INT8_C( 121), -INT8_C(  43), -INT8_C(  12),  INT8_C( 101),
+      -INT8_C( 115),  INT8_C(  32),  INT8_C(  31), -INT8_C(  29),  INT8_C(  82),  INT8_C(  34), -INT8_C(  15),  INT8_C(  78),
+      -INT8_C(  10),  INT8_C(  13),  INT8_C(  53),  INT8_C( 124),  INT8_C(  26), -INT8_C(   1),  INT8_C(  48), -INT8_C(  54),
+      -INT8_C( 127),  INT8_C(  45), -INT8_C( 119), -INT8_C(  98),  INT8_C(  51),  INT8_C(  42),  INT8_C(  76),  INT8_C(  38),
+      -INT8_C( 105), -INT8_C(  91),  INT8_C( 123),  INT8_C(  16),  INT8_C( 123),  INT8_C( 111),  INT8_C( 117),  INT8_C(   8),
+      -INT8_C( 113), -INT8_C( 107), -INT8_C(  20), -INT8_C(  30), -INT8_C(  73), -INT8_C(  35),  INT8_C(  48), -INT8_C(  83),
+      -INT8_C(  22),  INT8_C( 101),  INT8_C(  41),  INT8_C(   4),  INT8_C( 100),  INT8_C(  90), -INT8_C(  49), -INT8_C(  27),
+      -INT8_C( 121),  INT8_C(  88), -INT8_C( 125), -INT8_C(  70), -INT8_C( 126), -INT8_C(  49), -INT8_C(  31),  INT8_C(  25),
+       INT8_C( 117),  INT8_C(  92),  INT8_C(  42), -INT8_C(  16), -INT8_C(  52), -INT8_C(  97), -INT8_C(   8),  INT8_C(  91),
+       INT8_C(  52), -INT8_C(  28),  INT8_C(  61), -INT8_C(  21), -INT8_C(  63),  INT8_C( 109), -INT8_C( 103), -INT8_C(  84),
+      -INT8_C(  46), -INT8_C(  62), -INT8_C(  80),  INT8_C(  54),  INT8_C(  28) };
+  static const int8_t b[] =
+    { -INT8_C(  37), -INT8_C( 103),  INT8_C(  69),  INT8_C(  73), -INT8_C( 114),  INT8_C(  99), -INT8_C( 118),  INT8_C(  70),
+       INT8_C(  50),  INT8_C(   1),  INT8_C(  27),      INT8_MIN, -INT8_C( 109), -INT8_C( 109), -INT8_C(  91), -INT8_C(  59),
+       INT8_C( 105),  INT8_C(  36),  INT8_C( 101),  INT8_C( 126),  INT8_C(  22), -INT8_C(  24),  INT8_C(  46), -INT8_C(  91),
+       INT8_C(  63),  INT8_C(  70),  INT8_C( 113),  INT8_C(  98),  INT8_C(  33), -INT8_C(  83),  INT8_C(  54), -INT8_C(   3),
+       INT8_C(  70),  INT8_C( 123),  INT8_C(  70), -INT8_C(  43), -INT8_C(  33), -INT8_C(  48),  INT8_C(  27),  INT8_C(  17),
+      -INT8_C(  47),  INT8_C(  54), -INT8_C( 111),  INT8_C( 101), -INT8_C(  55),  INT8_C(  54),  INT8_C(  42),  INT8_C(  50),
+       INT8_C(  91), -INT8_C( 113), -INT8_C(  80),  INT8_C( 113),  INT8_C( 119), -INT8_C(  33),  INT8_C(  23), -INT8_C(  73),
+       INT8_C(  37), -INT8_C( 120),  INT8_C(  25),  INT8_C(  71),  INT8_C(  53),  INT8_C(  79),  INT8_C(  68),  INT8_C( 124),
+      -INT8_C(  53), -INT8_C( 118),  INT8_C(  81), -INT8_C(  86),  INT8_C(  91),  INT8_C( 108), -INT8_C(  69),  INT8_C(  44),
+      -INT8_C(  93),  INT8_C(  76), -INT8_C( 111),  INT8_C( 108), -INT8_C( 126), -INT8_C(  69), -INT8_C(  97), -INT8_C(  35),
+       INT8_C(  74),  INT8_C(  79),  INT8_C(  79), -INT8_C(  62),  INT8_C(  46),  INT8_C( 102),  INT8_C( 121),  INT8_C(  84),
+      -INT8_C(  18), -INT8_C( 110), -INT8_C( 101),  INT8_C(  35), -INT8_C(  30), -INT8_C(  33), -INT8_C(  97), -INT8_C(  83),
+       INT8_C( 105), -INT8_C(  16),  INT8_C(  87), -INT8_C(  60),  INT8_C(  93),  INT8_C(  18), -INT8_C(  15),  INT8_C(   0),
+       INT8_C(  94), -INT8_C( 126),  INT8_C( 108), -INT8_C(  32),  INT8_C(  62),  INT8_C(  11), -INT8_C(  66), -INT8_C( 120),
+       INT8_C(  91),  INT8_C(  13),  INT8_C(  74), -INT8_C( 119),  INT8_C( 115), -INT8_C(  61), -INT8_C(  35),  INT8_C(  97),
+       INT8_C(  86),  INT8_C( 120), -INT8_C( 124),  INT8_C(  56),  INT8_C(  87),  INT8_C(  36), -INT8_C(  27), -INT8_C(  63),
+       INT8_C(  20),  INT8_C(  60), -INT8_C( 123),  INT8_C( 113),  INT8_C(  78),  INT8_C( 118),  INT8_C( 113), -INT8_C(  84),
+      -INT8_C(   7), -INT8_C(  34), -INT8_C( 116),  INT8_C(  55), -INT8_C(  23),  INT8_C(  74), -INT8_C(  65),  INT8_C(  68),
+       INT8_C(  87),  INT8_C(  10), -INT8_C(  50), -INT8_C(  54), -INT8_C(  51), -INT8_C(  85),  INT8_C(  43),  INT8_C(  35),
+       INT8_C(  36), -INT8_C(  80),  INT8_C(  91),  INT8_C( 123), -INT8_C(  44),  INT8_C(  64),  INT8_C(  60), -INT8_C(  24),
+       INT8_C( 124), -INT8_C(  62),  INT8_C(  90), -INT8_C(  54),  INT8_C(  56), -INT8_C(  53),  INT8_C( 118),  INT8_C(  49),
+      -INT8_C(  87),  INT8_C(   3),  INT8_C( 104), -INT8_C( 109),  INT8_C(  77),  INT8_C(  40), -INT8_C(  41), -INT8_C(  91),
+       INT8_C(  50), -INT8_C(  91),  INT8_C( 111), -INT8_C(   1),  INT8_C(  81), -INT8_C( 101),  INT8_C(  35),  INT8_C( 117),
+       INT8_C(  75),  INT8_C( 126), -INT8_C(  16),  INT8_C(  31), -INT8_C(  65),  INT8_C(  45),  INT8_C(   7),  INT8_C(  59),
+      -INT8_C(  17),  INT8_C(  97),  INT8_C(   6),  INT8_C(  39),  INT8_C(  45),  INT8_C( 124),  INT8_C(  89), -INT8_C(  42),
+           INT8_MAX, -INT8_C(  63),  INT8_C( 105), -INT8_C(  51), -INT8_C(  23),  INT8_C(  65),  INT8_C( 114),  INT8_C(  27),
+      -INT8_C(  26), -INT8_C(  31),  INT8_C(  27),  INT8_C(  55),  INT8_C( 124),  INT8_C(  62), -INT8_C(  84), -INT8_C(  57),
+      -INT8_C(  68), -INT8_C(  99), -INT8_C(  26),  INT8_C( 123), -INT8_C(  54), -INT8_C(  18), -INT8_C(  73), -INT8_C(  71),
+       INT8_C(  79), -INT8_C(  67), -INT8_C(  32),  INT8_C( 124),  INT8_C(  57),  INT8_C(  57),  INT8_C(  83), -INT8_C(  71),
+      -INT8_C(   5), -INT8_C(  68), -INT8_C( 122), -INT8_C(  28), -INT8_C(   3), -INT8_C(   8),  INT8_C(   0), -INT8_C(  28),
+      -INT8_C(  39),  INT8_C(  27),  INT8_C(  27),  INT8_C(  86),  INT8_C(  89), -INT8_C(  56),  INT8_C(  29),  INT8_C(  21),
+       INT8_C( 101),  INT8_C(   4), -INT8_C( 111),  INT8_C(  47), -INT8_C(  14),  INT8_C(  72), -INT8_C(  24),  INT8_C(  65),
+       INT8_C(   5), -INT8_C(  56), -INT8_C(  66),  INT8_C(  62),  INT8_C(   2),  INT8_C(  17), -INT8_C(   9), -INT8_C(   3),
+      -INT8_C(  51),  INT8_C( 125), -INT8_C(  31), -INT8_C(  53),  INT8_C( 117), -INT8_C(  31), -INT8_C(  81),  INT8_C(  79),
+      -INT8_C(   4), -INT8_C(  54), -INT8_C(  91),  INT8_C(  85), -INT8_C( 110), -INT8_C(  62),  INT8_C( 107), -INT8_C(   9),
+      -INT8_C(  58), -INT8_C(   4),  INT8_C(  38), -INT8_C(  72),  INT8_C(  68),  INT8_C(  14), -INT8_C(   6),  INT8_C(  73),
+      -INT8_C(  41), -INT8_C(  72), -INT8_C( 121), -INT8_C(  39), -INT8_C(  55),      INT8_MAX, -INT8_C(  42), -INT8_C( 106),
+      -INT8_C(   4), -INT8_C(  73),  INT8_C(  97),  INT8_C( 114), -INT8_C( 103),  INT8_C(  16), -INT8_C(  63), -INT8_C( 107),
+      -INT8_C(  37),  INT8_C( 102), -INT8_C(  21),  INT8_C( 109),  INT8_C(  40),  INT8_C(  86),  INT8_C( 101), -INT8_C(  17),
+       INT8_C(  82), -INT8_C( 117), -INT8_C(  89), -INT8_C( 106), -INT8_C( 102), -INT8_C(  95), -INT8_C(  33),  INT8_C( 113),
+       INT8_C(  89),  INT8_C( 102),  INT8_C(  74),  INT8_C(  34), -INT8_C(  27),  INT8_C(  32), -INT8_C(  71), -INT8_C(  30),
+      -INT8_C(  41),  INT8_C(  26),  INT8_C(  84),  INT8_C( 112),  INT8_C(  43),  INT8_C(  21),  INT8_C(   6),  INT8_C(   6),
+       INT8_C( 123), -INT8_C(  15),  INT8_C( 115), -INT8_C(  93),  INT8_C(  71), -INT8_C(  40), -INT8_C( 110), -INT8_C( 103),
+       INT8_C( 100),  INT8_C(  58),  INT8_C(  47), -INT8_C(   2), -INT8_C(  37),  INT8_C(  14),  INT8_C( 111),  INT8_C(  53),
+       INT8_C( 116), -INT8_C(  71),  INT8_C(  87),  INT8_C(  90), -INT8_C(  39),  INT8_C(  16),  INT8_C(  60), -INT8_C(  80),
+       INT8_C(  43), -INT8_C( 112),  INT8_C(  33),  INT8_C(  86), -INT8_C(  91),  INT8_C(  39),  INT8_C(  92),  INT8_C(  32),
+       INT8_C(  24), -INT8_C(  49), -INT8_C(  61),  INT8_C(  95), -INT8_C(  88),  INT8_C(  86), -INT8_C(   8),  INT8_C(  12),
+      -INT8_C( 112),  INT8_C(  39),  INT8_C(  10),  INT8_C( 107),  INT8_C(  53),  INT8_C( 121), -INT8_C(  96), -INT8_C(  87),
+       INT8_C(  50), -INT8_C(   8),  INT8_C(   3),  INT8_C(  11),  INT8_C(   8),  INT8_C(  63), -INT8_C(  69),  INT8_C(  51),
+      -INT8_C(  49), -INT8_C(  36), -INT8_C( 119),  INT8_C( 116),  INT8_C(   3), -INT8_C(  27), -INT8_C( 108),  INT8_C(  27),
+      -INT8_C(  75),  INT8_C(  88),  INT8_C( 122),  INT8_C(  93), -INT8_C(  82),  INT8_C( 114),  INT8_C( 105),  INT8_C(  62),
+      -INT8_C( 103),  INT8_C( 115), -INT8_C(  87), -INT8_C(  50), -INT8_C(  20),  INT8_C(  74),  INT8_C( 120),  INT8_C(  30),
+       INT8_C(  66),  INT8_C( 123),  INT8_C(  41),  INT8_C(  74), -INT8_C(  69), -INT8_C(  28),  INT8_C( 126), -INT8_C( 118),
+      -INT8_C(  63),  INT8_C(   7), -INT8_C(   1), -INT8_C(  60), -INT8_C(  19), -INT8_C( 109), -INT8_C(  32), -INT8_C(  94),
+      -INT8_C(  21),  INT8_C(  90), -INT8_C(   1), -INT8_C( 103), -INT8_C(  51),  INT8_C( 104), -INT8_C(  41),  INT8_C( 102),
+      -INT8_C(  37), -INT8_C( 127),  INT8_C(  53), -INT8_C(  57), -INT8_C(  53), -INT8_C(  83), -INT8_C(  27),  INT8_C(  13),
+       INT8_C(  40),  INT8_C(  14),  INT8_C(  87), -INT8_C(  29), -INT8_C(  14), -INT8_C(  43),  INT8_C( 110), -INT8_C(  77),
+      -INT8_C(  35),  INT8_C( 109),  INT8_C( 120), -INT8_C(  54),  INT8_C(   0),  INT8_C(  88),  INT8_C( 108), -INT8_C(  20),
+      -INT8_C(  78),  INT8_C( 107), -INT8_C( 123),      INT8_MAX, -INT8_C(  45),  INT8_C(  93), -INT8_C(  26), -INT8_C(  82),
+      -INT8_C(  34),  INT8_C(  27),  INT8_C( 117), -INT8_C(  87), -INT8_C(  56),  INT8_C(  90), -INT8_C(  74), -INT8_C(  16),
+       INT8_C( 104),  INT8_C(  13), -INT8_C(  44),  INT8_C(  90), -INT8_C(  29),  INT8_C(  66),  INT8_C(  14), -INT8_C(  64),
+      -INT8_C(  81), -INT8_C( 122), -INT8_C( 118), -INT8_C(  81), -INT8_C(  34), -INT8_C(  10), -INT8_C( 101), -INT8_C( 112),
+       INT8_C(  97),  INT8_C(  33),  INT8_C(  16),  INT8_C(  52),  INT8_C( 126), -INT8_C(  10), -INT8_C(  30),  INT8_C(  92),
+       INT8_C(  17),  INT8_C(  87),  INT8_C(   5), -INT8_C(  39), -INT8_C(  79), -INT8_C(  69), -INT8_C(  55),  INT8_C(  25),
+      -INT8_C(  56), -INT8_C(  99),  INT8_C( 115), -INT8_C(  85), -INT8_C(  33), -INT8_C( 127),  INT8_C( 107), -INT8_C( 114),
+       INT8_C(   7), -INT8_C(  11),  INT8_C(  62), -INT8_C(  27), -INT8_C(  21), -INT8_C(  39),  INT8_C( 118),  INT8_C(  76),
+      -INT8_C(   6), -INT8_C( 122),      INT8_MIN,  INT8_C( 120),  INT8_C( 124),  INT8_C(  98), -INT8_C(  44), -INT8_C( 115),
+      -INT8_C(  71), -INT8_C(  39),  INT8_C( 102),  INT8_C( 106), -INT8_C( 108),  INT8_C(  47), -INT8_C( 125),  INT8_C(  93),
+      -INT8_C(  51), -INT8_C(   9),  INT8_C(   8), -INT8_C(  84),  INT8_C( 120),  INT8_C( 116),  INT8_C(  59),      INT8_MIN,
+       INT8_C( 105),  INT8_C( 121),  INT8_C( 101),  INT8_C(  85),  INT8_C(  82), -INT8_C(  37), -INT8_C(  95),  INT8_C(  77),
+       INT8_C(  97),  INT8_C(  34), -INT8_C(  59), -INT8_C(  35), -INT8_C( 124), -INT8_C( 102),  INT8_C( 106),  INT8_C(  62),
+       INT8_C( 115), -INT8_C(  48), -INT8_C(  88),  INT8_C(   8),  INT8_C(   0),  INT8_C(  44),  INT8_C( 101), -INT8_C(  51),
+       INT8_C(  35),  INT8_C( 109),  INT8_C( 121), -INT8_C( 101), -INT8_C(  31), -INT8_C(  76),  INT8_C(  27),  INT8_C(  75),
+       INT8_C(  45), -INT8_C( 127), -INT8_C(  96),      INT8_MIN,  INT8_C(  92),  INT8_C(  65), -INT8_C(  51), -INT8_C(  66),
+       INT8_C(  99), -INT8_C( 110), -INT8_C( 101), -INT8_C(  24),  INT8_C(  44),  INT8_C(   6),  INT8_C(  38), -INT8_C(  96),
+      -INT8_C(  42), -INT8_C(  50), -INT8_C(  88), -INT8_C(  42), -INT8_C(   6),  INT8_C(  13), -INT8_C(  93),  INT8_C(  29),
+       INT8_C( 122),  INT8_C(  29), -INT8_C(  71),  INT8_C(  92), -INT8_C(  47), -INT8_C(  44), -INT8_C(  89), -INT8_C(   1),
+       INT8_C(  85),  INT8_C(  71),      INT8_MAX, -INT8_C(  78), -INT8_C( 120),  INT8_C(  76),  INT8_C( 112), -INT8_C(  20),
+      -INT8_C(  34),  INT8_C(  11), -INT8_C(  44),  INT8_C(  11),  INT8_C(  17), -INT8_C(   6), -INT8_C(  85), -INT8_C(  24),
+      -INT8_C(  56),  INT8_C(  83), -INT8_C(  66), -INT8_C(  61),  INT8_C(  96),  INT8_C(  98), -INT8_C(  32), -INT8_C(  38),
+           INT8_MAX, -INT8_C( 103),  INT8_C(  54),  INT8_C(  80),  INT8_C( 110), -INT8_C(  35),  INT8_C(  79), -INT8_C(  61),
+       INT8_C(  36), -INT8_C(  50),  INT8_C( 117), -INT8_C(  83),  INT8_C(  26), -INT8_C(  27), -INT8_C( 103), -INT8_C(   7),
+      -INT8_C(  15),  INT8_C( 109),  INT8_C(   4),  INT8_C(   2),  INT8_C( 103), -INT8_C(  81), -INT8_C(  22),  INT8_C(  47),
+       INT8_C(   2), -INT8_C(  87), -INT8_C(  14),  INT8_C(  98),  INT8_C(  11), -INT8_C(  45),  INT8_C(  60), -INT8_C( 118),
+       INT8_C( 108),  INT8_C( 115), -INT8_C(  38), -INT8_C(  38),  INT8_C(  80),  INT8_C(  42), -INT8_C(  98),  INT8_C( 117),
+      -INT8_C(   8),  INT8_C(  19),  INT8_C(  34),  INT8_C(  19), -INT8_C(   7), -INT8_C(  69),  INT8_C(  12), -INT8_C(  22),
+       INT8_C(  40),  INT8_C(  16), -INT8_C(  20), -INT8_C( 113), -INT8_C(  65), -INT8_C(  41), -INT8_C(  66), -INT8_C(  63),
+           INT8_MIN, -INT8_C(  79),  INT8_C(  35), -INT8_C( 117), -INT8_C( 124),  INT8_C(  95),  INT8_C(  21), -INT8_C(  16),
+      -INT8_C(  46), -INT8_C(  17), -INT8_C(  53),  INT8_C(  35),  INT8_C(  25),  INT8_C( 105), -INT8_C( 104),  INT8_C(  18),
+       INT8_C( 124), -INT8_C(  70),  INT8_C(  37),  INT8_C( 117),  INT8_C( 117),  INT8_C(  49),  INT8_C(  95), -INT8_C(  99),
+       INT8_C(  65),  INT8_C(  76),  INT8_C(  44),  INT8_C(   0),  INT8_C(  35), -INT8_C(  22), -INT8_C(  63), -INT8_C(  93),
+      -INT8_C( 101), -INT8_C(  28),  INT8_C(  46),  INT8_C(  31),  INT8_C(  67),  INT8_C(  67),  INT8_C(  16),  INT8_C(  22),
+       INT8_C(  50), -INT8_C(  37),  INT8_C(  57),  INT8_C(  76),  INT8_C(  68), -INT8_C(  47),  INT8_C(  94), -INT8_C(  64),
+      -INT8_C( 117), -INT8_C( 125),  INT8_C(  54),  INT8_C(   0), -INT8_C(  76), -INT8_C( 107), -INT8_C(  99), -INT8_C(  11),
+      -INT8_C(  31), -INT8_C(  55), -INT8_C(  11),  INT8_C(   4), -INT8_C(  77), -INT8_C(  74), -INT8_C(  89),  INT8_C(  79),
+      -INT8_C( 102), -INT8_C(  43),  INT8_C( 110), -INT8_C(  35),  INT8_C(  24),  INT8_C( 126), -INT8_C(  13),  INT8_C(  75),
+       INT8_C(  89),  INT8_C(  44), -INT8_C( 105), -INT8_C(  99), -INT8_C(   3), -INT8_C(  11),  INT8_C(  94), -INT8_C( 120),
+       INT8_C( 120), -INT8_C( 108), -INT8_C( 120),  INT8_C(  44),  INT8_C(  41),  INT8_C(  37),  INT8_C(  33),  INT8_C(  11),
+      -INT8_C(  18),  INT8_C(  22),  INT8_C(  15), -INT8_C(  94), -INT8_C(  52), -INT8_C(  73), -INT8_C(  15),  INT8_C( 102),
+      -INT8_C( 116),  INT8_C(  95),  INT8_C(  67), -INT8_C(  91), -INT8_C(  34),  INT8_C(  55), -INT8_C(  16),  INT8_C(  55),
+       INT8_C(  99), -INT8_C( 121), -INT8_C(  43),  INT8_C(  97),  INT8_C( 124),  INT8_C(  51), -INT8_C(  23), -INT8_C(  12),
+      -INT8_C(  57),  INT8_C( 114),  INT8_C(  32), -INT8_C(  16), -INT8_C( 105),  INT8_C(  65), -INT8_C(   5), -INT8_C( 122),
+       INT8_C(  87),  INT8_C(  11),  INT8_C(  40),  INT8_C(  35), -INT8_C(  62),  INT8_C(  25), -INT8_C( 119),  INT8_C(  78),
+       INT8_C( 120), -INT8_C(  52), -INT8_C(  13),  INT8_C(  86),  INT8_C(   3), -INT8_C(  29), -INT8_C( 114),  INT8_C( 103),
+       INT8_C( 106),  INT8_C(  99), -INT8_C(  56), -INT8_C(  26), -INT8_C( 106), -INT8_C(  79), -INT8_C(  38),  INT8_C(  93),
+       INT8_C(  35), -INT8_C(   6),  INT8_C(  77), -INT8_C(  69),  INT8_C(  59),  INT8_C(  73),  INT8_C(  65), -INT8_C( 110),
+       INT8_C(  84),  INT8_C( 105), -INT8_C(  75),  INT8_C(  22), -INT8_C( 126),  INT8_C(  62),  INT8_C( 100), -INT8_C(   6),
+       INT8_C(  11),  INT8_C(  88),  INT8_C(  81),  INT8_C(  14),  INT8_C(  59), -INT8_C(  33),  INT8_C( 117), -INT8_C(  90),
+       INT8_C(  66),  INT8_C(  61), -INT8_C( 116), -INT8_C(  40), -INT8_C(  17),  INT8_C( 103),  INT8_C(  53),  INT8_C(  18),
+       INT8_C(  97), -INT8_C( 126), -INT8_C(  51), -INT8_C(  99), -INT8_C(  53),  INT8_C(  14),  INT8_C(  47),  INT8_C(  31),
+       INT8_C( 119), -INT8_C(  27),  INT8_C(  53), -INT8_C(   7),  INT8_C(  35), -INT8_C( 102), -INT8_C(  12),  INT8_C(  46),
+      -INT8_C(  14),  INT8_C(  69),  INT8_C(  61),  INT8_C(  45),  INT8_C(  36), -INT8_C(  78), -INT8_C(  45),  INT8_C( 102),
+      -INT8_C(  16),  INT8_C(  96),  INT8_C(  62), -INT8_C(  33), -INT8_C(  57),  INT8_C( 115), -INT8_C(  15),  INT8_C(  40),
+      -INT8_C(  11), -INT8_C(  65), -INT8_C(  59), -INT8_C(  63), -INT8_C(  51), -INT8_C(  11), -INT8_C(  32),  INT8_C(  69),
+      -INT8_C(  38),  INT8_C(  22),  INT8_C(  62), -INT8_C(   3), -INT8_C(  80),  INT8_C(  50),  INT8_C(  44), -INT8_C(  94),
+       INT8_C( 119),  INT8_C( 105), -INT8_C(  49), -INT8_C( 101),  INT8_C(  27), -INT8_C(  93),  INT8_C(   1),  INT8_C(  11),
+       INT8_C(   3),  INT8_C(  63), -INT8_C(  22), -INT8_C(  54), -INT8_C(  78), -INT8_C(  36), -INT8_C(  14), -INT8_C(  88),
+      -INT8_C( 101), -INT8_C(  72),  INT8_C( 105),  INT8_C( 104), -INT8_C(  83),  INT8_C(  73), -INT8_C(  83), -INT8_C( 121),
+       INT8_C(  95), -INT8_C(  20), -INT8_C( 124),  INT8_C(  15),  INT8_C(  30), -INT8_C(  80), -INT8_C(  79), -INT8_C( 106),
+       INT8_C(  25), -INT8_C( 127),  INT8_C(  49),  INT8_C(  53),  INT8_C(  36),  INT8_C(  51),  INT8_C(  64),  INT8_C(  39),
+       INT8_C( 114),  INT8_C(  43), -INT8_C(  15),  INT8_C(  37),  INT8_C(   7), -INT8_C(  29), -INT8_C(  51), -INT8_C(  94),
+      -INT8_C( 101),  INT8_C(  54),  INT8_C(  10),  INT8_C(  72),      INT8_MAX };
+  static const int8_t e[] =
+    {  INT8_C(  84),  INT8_C(  28),  INT8_C( 109), -INT8_C( 104), -INT8_C(  94),  INT8_C(  28), -INT8_C(  43),  INT8_C( 119),
+       INT8_C(  92),  INT8_C( 107),  INT8_C(  40), -INT8_C(  90),  INT8_C( 106),  INT8_C(  98),  INT8_C(  99),  INT8_C(   1),
+      -INT8_C(  47), -INT8_C(  72), -INT8_C(  79),  INT8_C(  11), -INT8_C(  33), -INT8_C(   3),  INT8_C( 125), -INT8_C( 105),
+      -INT8_C(  11),  INT8_C(  86), -INT8_C(  94), -INT8_C(   7), -INT8_C( 127),  INT8_C(  63), -INT8_C(  41), -INT8_C(  67),
+      -INT8_C(  68), -INT8_C(  32),  INT8_C(  62),  INT8_C(  94),  INT8_C(  20),  INT8_C(  32), -INT8_C( 110), -INT8_C( 127),
+      -INT8_C(  91),  INT8_C( 116),  INT8_C(   7), -INT8_C(  61), -INT8_C(  80),      INT8_MAX,  INT8_C(  32),  INT8_C( 100),
+      -INT8_C(  81),  INT8_C(  35),  INT8_C(  13),  INT8_C(  28), -INT8_C( 122), -INT8_C( 117),  INT8_C(  21), -INT8_C(  10),
+      -INT8_C(  28), -INT8_C(  80),  INT8_C(  87),  INT8_C( 101), -INT8_C(  39), -INT8_C(  58),  INT8_C(   8),  INT8_C(  81),
+      -INT8_C(  90), -INT8_C(  80), -INT8_C(  80), -INT8_C( 124), -INT8_C(  94), -INT8_C( 122),  INT8_C(  43), -INT8_C(  96),
+       INT8_C( 124), -INT8_C(  28), -INT8_C(   5), -INT8_C(  80), -INT8_C( 124), -INT8_C(  52), -INT8_C( 122),  INT8_C(  35),
+      -INT8_C(   7), -INT8_C(  84),  INT8_C(  27),  INT8_C(  72),  INT8_C(  31),  INT8_C( 122),  INT8_C(  26),  INT8_C(   3),
+       INT8_C(  37),  INT8_C(   9), -INT8_C( 109), -INT8_C(  70), -INT8_C(  66), -INT8_C( 117),  INT8_C(  12),  INT8_C( 117),
+       INT8_C(  59),  INT8_C(  64), -INT8_C(   7), -INT8_C(  90), -INT8_C(   6),  INT8_C( 102), -INT8_C(  34), -INT8_C( 106),
+      -INT8_C(  98),  INT8_C(  50), -INT8_C(   8),  INT8_C(  96), -INT8_C(  10), -INT8_C(  95),  INT8_C(  95),  INT8_C( 120),
+       INT8_C(  53),  INT8_C( 122),  INT8_C(  94),  INT8_C(  84), -INT8_C(  53), -INT8_C(  35),  INT8_C(  87),  INT8_C( 110),
+      -INT8_C(  26), -INT8_C(  64),  INT8_C(  41), -INT8_C( 104), -INT8_C(  44),  INT8_C(  53),  INT8_C(  42), -INT8_C( 113),
+      -INT8_C(  44), -INT8_C(  36),  INT8_C(  73), -INT8_C( 125), -INT8_C(  76), -INT8_C(  45), -INT8_C(  55),  INT8_C(  24),
+       INT8_C(  69), -INT8_C(  29),  INT8_C(  88), -INT8_C(  98),  INT8_C(  36),  INT8_C(  17), -INT8_C(  49),  INT8_C(  36),
+      -INT8_C( 116),  INT8_C(   8),  INT8_C( 118), -INT8_C(  43),  INT8_C(  29),  INT8_C( 101),  INT8_C(  68),  INT8_C( 119),
+       INT8_C(  52),  INT8_C( 109),  INT8_C(  44),  INT8_C( 113),  INT8_C(  40),  INT8_C(  86),  INT8_C(  60),  INT8_C(  56),
+       INT8_C(  64), -INT8_C(  20), -INT8_C(  58), -INT8_C(  24), -INT8_C( 118),  INT8_C( 101),  INT8_C(  90),  INT8_C(  55),
+       INT8_C(  66),  INT8_C(  59), -INT8_C(  88), -INT8_C(   9), -INT8_C(   1),  INT8_C(  56), -INT8_C(  80), -INT8_C( 125),
+       INT8_C(  47),  INT8_C( 118), -INT8_C(  36),  INT8_C(  63),  INT8_C(  35),  INT8_C(  32),  INT8_C(  56), -INT8_C(  24),
+       INT8_C(  79),  INT8_C( 101),  INT8_C(  96),  INT8_C(  47), -INT8_C(  69), -INT8_C(  97), -INT8_C(  62), -INT8_C(  87),
+       INT8_C(  49), -INT8_C( 120), -INT8_C(  32), -INT8_C(  69),  INT8_C(  23),  INT8_C( 100),  INT8_C(  34), -INT8_C( 118),
+      -INT8_C(  16),  INT8_C( 124), -INT8_C( 127), -INT8_C(  81), -INT8_C(  49),  INT8_C(  49), -INT8_C(  60),  INT8_C(  38),
+      -INT8_C(  17),  INT8_C( 111), -INT8_C(  25),  INT8_C(  18),  INT8_C( 111),  INT8_C(  32),  INT8_C(  91), -INT8_C(  85),
+      -INT8_C( 123),  INT8_C(  21),  INT8_C(  44), -INT8_C(  64), -INT8_C(  96), -INT8_C(  17), -INT8_C(  12), -INT8_C(  63),
+      -INT8_C(  71), -INT8_C( 116),  INT8_C(  96), -INT8_C( 113),  INT8_C(   3),  INT8_C( 111),  INT8_C(  25), -INT8_C(  13),
+       INT8_C( 105), -INT8_C( 102),  INT8_C(  95),  INT8_C(  72), -INT8_C(  97), -INT8_C(  47),  INT8_C(   0), -INT8_C(  69),
+       INT8_C(  32),  INT8_C(  80), -INT8_C(  97), -INT8_C( 112), -INT8_C( 112),  INT8_C(  64), -INT8_C( 115), -INT8_C( 107),
+       INT8_C(  17), -INT8_C(  71),  INT8_C(  54), -INT8_C(  93), -INT8_C(  48), -INT8_C( 126), -INT8_C( 104),  INT8_C(  32),
+      -INT8_C(  10),  INT8_C(  12), -INT8_C(  30),  INT8_C(  62),  INT8_C( 123),  INT8_C(  72), -INT8_C(  12), -INT8_C(  53),
+       INT8_C(  98),  INT8_C(  83),  INT8_C(  73), -INT8_C(  81),  INT8_C(  37),  INT8_C(  82), -INT8_C( 104),  INT8_C(  75),
+      -INT8_C(  12), -INT8_C(  74),  INT8_C(  73), -INT8_C( 113), -INT8_C(  34),  INT8_C(  98),  INT8_C(  99),  INT8_C(   4),
+       INT8_C(  28),  INT8_C(   4), -INT8_C( 106), -INT8_C(  60),  INT8_C(  68),  INT8_C( 120), -INT8_C(  88), -INT8_C(   9),
+      -INT8_C(  36), -INT8_C( 109),  INT8_C(  64),  INT8_C(   0),  INT8_C(  91), -INT8_C(  52),  INT8_C( 103), -INT8_C(  67),
+      -INT8_C(  32), -INT8_C(  48), -INT8_C(  21), -INT8_C(  83), -INT8_C(  53),  INT8_C(  48),  INT8_C( 114), -INT8_C(  66),
+      -INT8_C( 119), -INT8_C(  80),  INT8_C( 115),  INT8_C(  72), -INT8_C( 112), -INT8_C(  84), -INT8_C( 124),  INT8_C(  70),
+       INT8_C(  65),  INT8_C( 109),  INT8_C(  45), -INT8_C( 126), -INT8_C(  26), -INT8_C(  17),  INT8_C(  31), -INT8_C(  54),
+      -INT8_C( 117),  INT8_C( 102), -INT8_C(  92),  INT8_C( 124),  INT8_C(  54), -INT8_C(  47), -INT8_C( 100), -INT8_C(  66),
+       INT8_C(  46), -INT8_C( 121),  INT8_C(  28), -INT8_C( 123),  INT8_C(  90), -INT8_C(  95), -INT8_C(  53), -INT8_C(  28),
+       INT8_C(  37),  INT8_C(  36),  INT8_C(  36),  INT8_C(  80), -INT8_C(  25), -INT8_C(  48), -INT8_C( 116),  INT8_C(  40),
+       INT8_C(  61), -INT8_C(  95), -INT8_C(  85), -INT8_C(  70),  INT8_C(  11), -INT8_C(  24), -INT8_C( 110),  INT8_C(  36),
+      -INT8_C(  40),  INT8_C(  56),  INT8_C(  62), -INT8_C(  92),  INT8_C(  58), -INT8_C(  32),  INT8_C(  98),  INT8_C(  76),
+      -INT8_C( 121), -INT8_C(  51), -INT8_C(  47),  INT8_C( 112),  INT8_C(  18), -INT8_C(  60),  INT8_C(  48),  INT8_C(  80),
+       INT8_C(   0),  INT8_C(  96), -INT8_C(  96), -INT8_C(  25),      INT8_MIN,  INT8_C(  54),      INT8_MIN, -INT8_C(  83),
+           INT8_MIN, -INT8_C(  69), -INT8_C(  47), -INT8_C(  29),  INT8_C(  39), -INT8_C(  25),  INT8_C( 125),  INT8_C(  93),
+       INT8_C(  87),  INT8_C( 111), -INT8_C(  85),  INT8_C( 107), -INT8_C(  16), -INT8_C( 101), -INT8_C(  97), -INT8_C(  55),
+       INT8_C( 104),  INT8_C(  62),  INT8_C(  27), -INT8_C( 100), -INT8_C( 114), -INT8_C(  41), -INT8_C(  29), -INT8_C(  37),
+       INT8_C(  35),  INT8_C(   8), -INT8_C(  62), -INT8_C(  21), -INT8_C(  66), -INT8_C(  46), -INT8_C( 107),  INT8_C(  30),
+      -INT8_C( 115), -INT8_C(  46), -INT8_C(   6), -INT8_C(  75), -INT8_C(  59),  INT8_C( 102),  INT8_C(  74),  INT8_C(  72),
+      -INT8_C( 114), -INT8_C( 124), -INT8_C(  18),  INT8_C(  50), -INT8_C(  91),  INT8_C(  76), -INT8_C(   8),  INT8_C(  80),
+      -INT8_C(  22),  INT8_C( 124), -INT8_C(  27), -INT8_C(  60), -INT8_C(  41), -INT8_C(  38), -INT8_C(  97),  INT8_C( 118),
+      -INT8_C( 127),  INT8_C( 116),  INT8_C(  78),  INT8_C(  58), -INT8_C(  92),  INT8_C(  71),  INT8_C(  84), -INT8_C(  62),
+      -INT8_C(   1), -INT8_C(  58), -INT8_C(  93),  INT8_C( 114),  INT8_C(  42), -INT8_C(  63), -INT8_C( 113),  INT8_C(  37),
+       INT8_C(  69),  INT8_C(  54),  INT8_C( 102), -INT8_C( 113),  INT8_C( 112),  INT8_C(   2), -INT8_C(  42), -INT8_C( 122),
+      -INT8_C(  58),  INT8_C( 104),  INT8_C(  72), -INT8_C(  76),  INT8_C(   0),  INT8_C(  16),  INT8_C(  60), -INT8_C( 121),
+       INT8_C(  40),  INT8_C(  79),  INT8_C(  69),  INT8_C(  93),  INT8_C( 117), -INT8_C( 115), -INT8_C(  38),  INT8_C(  56),
+       INT8_C(  84), -INT8_C( 106), -INT8_C(  93), -INT8_C( 110),  INT8_C(  87),  INT8_C(  70),  INT8_C(  26),  INT8_C(  48),
+       INT8_C(  19), -INT8_C(  63), -INT8_C(  88), -INT8_C(  34), -INT8_C(  23), -INT8_C(  98), -INT8_C(  18),      INT8_MIN,
+      -INT8_C(   9),  INT8_C(  21), -INT8_C(  56), -INT8_C(   3), -INT8_C(  37), -INT8_C(  79), -INT8_C(  20),  INT8_C(  64),
+       INT8_C(   0),  INT8_C(  69),  INT8_C(  16), -INT8_C( 105), -INT8_C(  45),      INT8_MIN,  INT8_C(  56),  INT8_C(   4),
+       INT8_C( 118), -INT8_C(  11), -INT8_C(  71),  INT8_C( 101), -INT8_C(  39), -INT8_C(  48), -INT8_C(  38), -INT8_C(  20),
+       INT8_C(  49),  INT8_C(  12),  INT8_C( 119), -INT8_C(  12), -INT8_C(  91), -INT8_C(  27), -INT8_C( 110), -INT8_C(  14),
+       INT8_C(  86),  INT8_C(  74), -INT8_C(  30), -INT8_C(  18),  INT8_C( 105),  INT8_C( 115),  INT8_C(  90), -INT8_C(   4),
+      -INT8_C(  71), -INT8_C(  69),      INT8_MIN, -INT8_C(  96),  INT8_C(  59),  INT8_C( 111),  INT8_C(  60), -INT8_C(  99),
+       INT8_C(   2), -INT8_C( 116), -INT8_C(  76), -INT8_C(  37), -INT8_C(  36), -INT8_C(  55), -INT8_C(  43), -INT8_C(  71),
+      -INT8_C( 111), -INT8_C(  55),  INT8_C(   8),  INT8_C( 108), -INT8_C(  92),  INT8_C(  56), -INT8_C(  15),      INT8_MIN,
+       INT8_C(  82), -INT8_C( 101),  INT8_C(  41),  INT8_C( 126),  INT8_C(  44), -INT8_C(  49), -INT8_C(  70), -INT8_C(  33),
+      -INT8_C( 118),  INT8_C(  13),  INT8_C(  87),  INT8_C(  17),  INT8_C( 116),  INT8_C(  30),  INT8_C(  28), -INT8_C(  62),
+      -INT8_C( 118),  INT8_C(  64),  INT8_C(  91),  INT8_C(  48),  INT8_C(   0),  INT8_C(  34),  INT8_C( 115),  INT8_C(  23),
+       INT8_C(  67), -INT8_C(  47),  INT8_C(  68), -INT8_C(  94), -INT8_C(  83),  INT8_C(   7), -INT8_C(  25),  INT8_C(  47),
+      -INT8_C(  78), -INT8_C( 102),  INT8_C(  32), -INT8_C(  31), -INT8_C(  68),  INT8_C(  39), -INT8_C(  64), -INT8_C(  13),
+       INT8_C(  53),  INT8_C(  44), -INT8_C(  72),  INT8_C(  80), -INT8_C(  72), -INT8_C(  44),  INT8_C(  70), -INT8_C(  43),
+      -INT8_C(  94), -INT8_C( 116), -INT8_C(  72),  INT8_C(  64), -INT8_C(  81), -INT8_C(  81), -INT8_C(   7),  INT8_C(  16),
+       INT8_C(  36), -INT8_C(   5), -INT8_C(  26),  INT8_C(  28),  INT8_C(  94), -INT8_C(  36),  INT8_C(   0), -INT8_C(  71),
+      -INT8_C(  71), -INT8_C(  82),  INT8_C( 102),  INT8_C(  28),  INT8_C(  40),  INT8_C(  90),  INT8_C( 112),  INT8_C(  56),
+      -INT8_C( 122),  INT8_C(   3), -INT8_C(  80), -INT8_C(   5),  INT8_C(  39),  INT8_C( 108), -INT8_C(  90), -INT8_C( 112),
+       INT8_C( 122), -INT8_C(  13),  INT8_C(  76),  INT8_C(  41), -INT8_C( 112),  INT8_C( 122),  INT8_C(  58), -INT8_C(  76),
+       INT8_C(  68),  INT8_C(  80),  INT8_C(  14), -INT8_C(  96), -INT8_C( 116), -INT8_C(  82), -INT8_C(   5), -INT8_C(  29),
+       INT8_C(  52), -INT8_C(  26), -INT8_C(  96),  INT8_C(  21), -INT8_C(  16), -INT8_C(  47), -INT8_C(  12),  INT8_C( 118),
+      -INT8_C(  69), -INT8_C( 112),  INT8_C(  71), -INT8_C(  28), -INT8_C(  66), -INT8_C(  19),  INT8_C( 120),  INT8_C(  57),
+      -INT8_C(  49),  INT8_C(  86), -INT8_C(  92),  INT8_C(  95), -INT8_C(  77), -INT8_C( 100), -INT8_C(  80), -INT8_C(   9),
+      -INT8_C(   4), -INT8_C(  69),  INT8_C(  58),  INT8_C(  10),  INT8_C(  31),  INT8_C(  53), -INT8_C( 116),  INT8_C(  83),
+      -INT8_C(  53),  INT8_C( 122),  INT8_C(  93), -INT8_C(  69), -INT8_C(  20), -INT8_C( 117),  INT8_C(  76),  INT8_C( 102),
+       INT8_C(  65),  INT8_C( 121), -INT8_C( 116),  INT8_C(   0),  INT8_C(  26),  INT8_C(  70),  INT8_C(  57), -INT8_C(  11),
+      -INT8_C(  84),  INT8_C(  43), -INT8_C( 107),  INT8_C(  96),  INT8_C(  56), -INT8_C(  73),  INT8_C(  35), -INT8_C(  80),
+       INT8_C(  66),  INT8_C(  95), -INT8_C(  98),  INT8_C( 102), -INT8_C(  57),  INT8_C( 120), -INT8_C(  75),  INT8_C(  68),
+      -INT8_C(  13),  INT8_C(  18),  INT8_C(  77), -INT8_C(  53), -INT8_C(  33),  INT8_C( 126), -INT8_C(   6), -INT8_C(  59),
+      -INT8_C(   9), -INT8_C(  65), -INT8_C(  36),  INT8_C(   0), -INT8_C(  81),  INT8_C(  44), -INT8_C(  45),  INT8_C(  86),
+      -INT8_C(  93), -INT8_C(  96),  INT8_C(  60),  INT8_C(  79), -INT8_C(  77),  INT8_C( 123),  INT8_C(  96), -INT8_C(  72),
+      -INT8_C(   5), -INT8_C( 108),  INT8_C(  70), -INT8_C( 104),  INT8_C(  13),  INT8_C(  27),  INT8_C(  84),  INT8_C(   0),
+       INT8_C(  62),  INT8_C(  99),  INT8_C(  63), -INT8_C(  63), -INT8_C(  52), -INT8_C( 123), -INT8_C( 122),  INT8_C(   3),
+       INT8_C(  68),  INT8_C(  75), -INT8_C(   7),  INT8_C(  74),  INT8_C(  11),  INT8_C(   8),  INT8_C( 100),  INT8_C(  13),
+       INT8_C( 122), -INT8_C(  90),  INT8_C(  88),  INT8_C(   2),  INT8_C( 119), -INT8_C(  85),  INT8_C(  22),  INT8_C( 102),
+      -INT8_C(  25), -INT8_C( 116),  INT8_C(  52), -INT8_C( 100), -INT8_C(  40),  INT8_C(  40),  INT8_C(  76), -INT8_C(  10),
+       INT8_C(  41),  INT8_C(  92), -INT8_C(  73), -INT8_C( 116), -INT8_C( 112),  INT8_C(  62),  INT8_C(  96),  INT8_C(  85),
+      -INT8_C( 119), -INT8_C(  43),  INT8_C(  81), -INT8_C(  45), -INT8_C(  35), -INT8_C(  51),  INT8_C(  86),  INT8_C(  14),
+      -INT8_C(  87),  INT8_C(  86),  INT8_C( 115), -INT8_C(  96),  INT8_C(  54),  INT8_C(  39), -INT8_C(  48),  INT8_C(  85),
+      -INT8_C(  76), -INT8_C(  57), -INT8_C(  95),  INT8_C( 108), -INT8_C(  64),  INT8_C( 106),  INT8_C(  98),  INT8_C(  84),
+       INT8_C(  15),  INT8_C(  25),  INT8_C(  64), -INT8_C( 118),  INT8_C(  87),  INT8_C(  34), -INT8_C(  91), -INT8_C(  58),
+      -INT8_C(   9),  INT8_C( 126),  INT8_C(  32), -INT8_C(  43), -INT8_C(  14),  INT8_C(  90),  INT8_C( 123), -INT8_C(  62),
+      -INT8_C(  44), -INT8_C(  12), -INT8_C(  30), -INT8_C(  22),  INT8_C(  28), -INT8_C(  65),  INT8_C(  63), -INT8_C(  48),
+       INT8_C(  66), -INT8_C(  96), -INT8_C(  32), -INT8_C(  82), -INT8_C(  50),  INT8_C(  62),  INT8_C(  28),  INT8_C(  40),
+       INT8_C(   5), -INT8_C(  55), -INT8_C(  46),  INT8_C(  15), -INT8_C(  21), -INT8_C(  79), -INT8_C(  16), -INT8_C(  29),
+       INT8_C( 108),  INT8_C(  68),  INT8_C(  24),  INT8_C(  48),  INT8_C(  14), -INT8_C( 101), -INT8_C(  24), -INT8_C(  76),
+       INT8_C(  48), -INT8_C(  20), -INT8_C( 116),  INT8_C( 104),  INT8_C(  98),  INT8_C(  11),  INT8_C( 124), -INT8_C(  97),
+      -INT8_C(  40), -INT8_C(  40),  INT8_C(  16), -INT8_C(  70),  INT8_C(  86),  INT8_C(  50),  INT8_C(   2),  INT8_C(  13),
+      -INT8_C(   5), -INT8_C(  44),  INT8_C(  28), -INT8_C(  85),  INT8_C( 119),  INT8_C(  12),  INT8_C(  22), -INT8_C(  76),
+      -INT8_C(  48), -INT8_C( 126),  INT8_C(  44), -INT8_C(  66), -INT8_C(   9), -INT8_C( 100),  INT8_C( 116), -INT8_C(  83),
+      -INT8_C(  74),  INT8_C( 109),  INT8_C(  89), -INT8_C(  15),  INT8_C( 121), -INT8_C(  43), -INT8_C(  12),  INT8_C( 101),
+      -INT8_C( 115),  INT8_C(   0), -INT8_C( 126), -INT8_C(  67),  INT8_C(  82),  INT8_C(  70), -INT8_C(  15),  INT8_C(  48),
+       INT8_C( 110),  INT8_C(  13),  INT8_C(  53),  INT8_C( 124),  INT8_C(  26),  INT8_C(  11),  INT8_C(   0), -INT8_C(  54),
+      -INT8_C( 127),  INT8_C(  45), -INT8_C( 119), -INT8_C(  98),  INT8_C(  16),  INT8_C(  52),  INT8_C(  76),  INT8_C(  12),
+      -INT8_C( 105), -INT8_C(  83),  INT8_C( 117), -INT8_C(  80), -INT8_C(   7), -INT8_C(  83),  INT8_C( 117),  INT8_C(   8),
+      -INT8_C(  83), -INT8_C( 107), -INT8_C(  20),  INT8_C(  84), -INT8_C(  73), -INT8_C(  35),  INT8_C(  48), -INT8_C( 120),
+      -INT8_C(  82), -INT8_C( 104),  INT8_C(  41), -INT8_C(  96),  INT8_C( 100), -INT8_C(  86), -INT8_C(  49), -INT8_C(  61),
+      -INT8_C( 121),  INT8_C(  88), -INT8_C( 116), -INT8_C(  70), -INT8_C( 126), -INT8_C(  49), -INT8_C( 111),  INT8_C(  25),
+       INT8_C( 109),  INT8_C(  92),  INT8_C(  10), -INT8_C(  80), -INT8_C(  52), -INT8_C(  83), -INT8_C(   8), -INT8_C(  35),
+       INT8_C(  52), -INT8_C(  28),  INT8_C( 109), -INT8_C(  21), -INT8_C(  63),  INT8_C( 109), -INT8_C( 103), -INT8_C(  84),
+       INT8_C(  38), -INT8_C(  20), -INT8_C(  32),  INT8_C(  54), -INT8_C(  28) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i])),
+      bv = simde_svld1_s8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_s8_m(pv, av, bv);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+    bv = simde_svld1_s8(pg, &(b[i]));
+
+    ev = simde_svmul_s8_m(pv, av, bv);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1) };
+  static const int16_t a[] =
+    { -INT16_C( 13391),  INT16_C( 22146), -INT16_C( 20871),  INT16_C( 32476), -INT16_C( 23632), -INT16_C(  7915), -INT16_C( 14368), -INT16_C(  2154),
+      -INT16_C( 18041),  INT16_C( 26105),  INT16_C( 24939), -INT16_C(  7873),  INT16_C(  1329),  INT16_C( 15960),  INT16_C( 22495), -INT16_C( 28314),
+      -INT16_C(  5853), -INT16_C( 25369), -INT16_C( 15465),  INT16_C( 18202),  INT16_C( 12390),  INT16_C( 18216), -INT16_C( 16393),  INT16_C( 32318),
+       INT16_C( 14200), -INT16_C(  7197),  INT16_C(  8856), -INT16_C( 13884),  INT16_C(  7463),  INT16_C(  1799),  INT16_C( 28276), -INT16_C( 26728),
+       INT16_C( 32599), -INT16_C(  4556),  INT16_C( 20034), -INT16_C( 22475),  INT16_C( 23934),  INT16_C( 30191),  INT16_C( 11804), -INT16_C( 27405),
+      -INT16_C( 10395), -INT16_C(   393),  INT16_C( 15609),  INT16_C(  8647), -INT16_C( 12455), -INT16_C( 13016), -INT16_C( 16323), -INT16_C( 27547),
+      -INT16_C( 26305), -INT16_C( 32382), -INT16_C( 18457),  INT16_C( 26153),  INT16_C(  6420),  INT16_C( 12763), -INT16_C( 12473), -INT16_C( 21307),
+       INT16_C( 15782), -INT16_C( 24662),  INT16_C( 29305), -INT16_C( 11584), -INT16_C(  6079),  INT16_C( 32415),  INT16_C(  1192), -INT16_C(  6382),
+      -INT16_C( 27491), -INT16_C( 31384), -INT16_C( 28085),  INT16_C( 24555), -INT16_C( 14677), -INT16_C(  3440),  INT16_C( 22165),  INT16_C( 15262),
+       INT16_C( 18835),  INT16_C(  3291), -INT16_C( 25669), -INT16_C(   802),  INT16_C( 32132),  INT16_C( 11386), -INT16_C( 29566),  INT16_C(  7956),
+       INT16_C( 31776),  INT16_C( 27556), -INT16_C( 28914), -INT16_C( 17974),  INT16_C( 23382), -INT16_C(  5205),  INT16_C( 19121),  INT16_C( 17447),
+       INT16_C(   659),  INT16_C( 20048),  INT16_C( 11933),  INT16_C(  8522), -INT16_C( 15189),  INT16_C( 11598),  INT16_C( 25168),  INT16_C( 28749),
+      -INT16_C(  3618), -INT16_C(  4645), -INT16_C( 23167), -INT16_C( 10330),  INT16_C( 20992), -INT16_C( 20030), -INT16_C(  5732),  INT16_C( 12277),
+       INT16_C( 17899), -INT16_C( 30339), -INT16_C( 14477),  INT16_C(  8106), -INT16_C(  1909), -INT16_C(  9396), -INT16_C( 26278),  INT16_C( 14667),
+       INT16_C(  9867),  INT16_C(  3110), -INT16_C( 13109), -INT16_C( 13085), -INT16_C( 23266), -INT16_C( 17795),  INT16_C( 29583),  INT16_C( 31465),
+       INT16_C( 26296),  INT16_C( 11267), -INT16_C( 20947), -INT16_C( 18357), -INT16_C( 26714),  INT16_C(   403), -INT16_C(  8655), -INT16_C( 17350),
+       INT16_C( 24580), -INT16_C( 12088), -INT16_C( 21716),  INT16_C( 19356),  INT16_C(  6480), -INT16_C(  8443), -INT16_C(  4212),  INT16_C( 17754),
+       INT16_C( 23893), -INT16_C( 31887), -INT16_C( 17397), -INT16_C( 19909), -INT16_C( 12461), -INT16_C( 31565), -INT16_C(  4691), -INT16_C( 19904),
+       INT16_C(  2125),  INT16_C( 31106),  INT16_C(  7859),  INT16_C(  1220), -INT16_C( 13769), -INT16_C( 15133),  INT16_C( 15801),  INT16_C(  3593),
+       INT16_C( 31387), -INT16_C( 22895), -INT16_C( 13002), -INT16_C( 30376),  INT16_C(  2972),  INT16_C( 18702),  INT16_C( 20216),  INT16_C( 17915),
+       INT16_C( 32087),  INT16_C(  2751), -INT16_C( 31845), -INT16_C( 11506), -INT16_C(  3507),  INT16_C(  1687), -INT16_C( 24529), -INT16_C( 13803),
+      -INT16_C( 23014),  INT16_C( 20593), -INT16_C( 13965),  INT16_C(  4057), -INT16_C(  6187), -INT16_C( 12967),  INT16_C( 21558), -INT16_C( 29421),
+      -INT16_C( 11566),  INT16_C( 28055), -INT16_C( 22955), -INT16_C( 23744), -INT16_C( 10344), -INT16_C( 14423), -INT16_C( 16777), -INT16_C( 28270),
+       INT16_C(   869), -INT16_C( 10015), -INT16_C( 17460), -INT16_C( 24088),  INT16_C( 16802), -INT16_C( 10129), -INT16_C( 32107),  INT16_C( 26469),
+      -INT16_C(   684), -INT16_C( 22059),  INT16_C(  5539),  INT16_C( 15180), -INT16_C(  2323),  INT16_C( 25602), -INT16_C( 27468),  INT16_C(  6646),
+      -INT16_C( 10345),  INT16_C( 25842), -INT16_C(  9582),  INT16_C( 13573),  INT16_C( 29723), -INT16_C( 20467),  INT16_C( 29686),  INT16_C( 18968),
+      -INT16_C(  4752),  INT16_C(  5108),  INT16_C( 16386), -INT16_C(  4274),  INT16_C( 20534), -INT16_C(  5292),  INT16_C( 19173),  INT16_C( 31748),
+      -INT16_C(  2527), -INT16_C( 19232), -INT16_C(  6448), -INT16_C(  5143), -INT16_C(  2470),  INT16_C( 20892), -INT16_C( 19351), -INT16_C(  9829),
+      -INT16_C( 28767), -INT16_C( 23572),  INT16_C( 15056),  INT16_C(  1683), -INT16_C(  6261),  INT16_C( 28913), -INT16_C(  2511),  INT16_C( 21228),
+      -INT16_C( 12820), -INT16_C( 17146), -INT16_C(  4173),  INT16_C(  3496),  INT16_C( 17638),  INT16_C( 20318), -INT16_C(  1288), -INT16_C( 26327),
+       INT16_C(  5513),  INT16_C( 22845), -INT16_C( 12208), -INT16_C(  9376),  INT16_C( 20919), -INT16_C(  6069),  INT16_C( 14151),  INT16_C( 13370),
+       INT16_C( 16644), -INT16_C( 18447), -INT16_C( 26320),  INT16_C(  5829),  INT16_C(  9182), -INT16_C( 10650), -INT16_C( 28899), -INT16_C( 22672),
+      -INT16_C( 21084), -INT16_C(  3072),  INT16_C( 24701),  INT16_C( 13519),  INT16_C(  6834), -INT16_C(  1764),  INT16_C( 22098),  INT16_C( 22061),
+       INT16_C(  7831), -INT16_C( 14322), -INT16_C( 11336), -INT16_C( 26914),  INT16_C( 17654),  INT16_C(  5228), -INT16_C(  9005),  INT16_C( 30907),
+      -INT16_C( 17527),  INT16_C(  1644),  INT16_C( 15388), -INT16_C( 12742),  INT16_C( 22102), -INT16_C( 22329), -INT16_C(  2643),  INT16_C( 17663),
+       INT16_C(  3347), -INT16_C( 13556), -INT16_C(  5152), -INT16_C( 10655), -INT16_C( 12753),  INT16_C(  1002), -INT16_C( 23126),  INT16_C( 13435),
+      -INT16_C(  6303),  INT16_C( 32058),  INT16_C( 29987),  INT16_C( 31307),  INT16_C(  4811),  INT16_C( 30754),  INT16_C(  8455),  INT16_C(  7101),
+      -INT16_C( 14034),  INT16_C(  3814),  INT16_C( 18612), -INT16_C(  6939), -INT16_C( 12522), -INT16_C( 16153),  INT16_C( 25205), -INT16_C( 10508),
+       INT16_C( 12105),  INT16_C( 27987), -INT16_C( 24924),  INT16_C( 28647),  INT16_C(  2480), -INT16_C( 18200), -INT16_C( 23253),  INT16_C( 22995),
+      -INT16_C( 18066),  INT16_C(  9064),  INT16_C( 19713),  INT16_C(  5895), -INT16_C(  4580), -INT16_C( 28200), -INT16_C( 13232), -INT16_C( 26265),
+      -INT16_C( 17669), -INT16_C( 24826), -INT16_C(  4776),  INT16_C(  2319), -INT16_C(  2057),  INT16_C(  8897), -INT16_C( 27492),  INT16_C(  2683),
+      -INT16_C(  7347),  INT16_C( 20269),  INT16_C( 13360),  INT16_C( 19814),  INT16_C( 15906),  INT16_C( 29406),  INT16_C( 17931),  INT16_C(  1548),
+       INT16_C(  4608),  INT16_C( 22950), -INT16_C( 19200), -INT16_C(  2206),  INT16_C(  9132),  INT16_C( 18457), -INT16_C( 27465),  INT16_C(  1106),
+      -INT16_C( 32648), -INT16_C( 22445), -INT16_C( 17740), -INT16_C( 10251), -INT16_C( 11016),  INT16_C(   841),  INT16_C( 21786),  INT16_C(  6666),
+      -INT16_C( 20376),  INT16_C( 26739), -INT16_C( 10907),  INT16_C(  4447),  INT16_C( 30968), -INT16_C( 20647), -INT16_C( 21748), -INT16_C( 31564),
+       INT16_C(  1835), -INT16_C(  8147),  INT16_C(  8897), -INT16_C( 17737),  INT16_C(   246),  INT16_C(  4285), -INT16_C( 14506), -INT16_C( 16853),
+      -INT16_C( 24969), -INT16_C(  9178), -INT16_C( 31372) };
+  static const int16_t b[] =
+    {  INT16_C( 21032), -INT16_C(  5302), -INT16_C( 10856),  INT16_C( 25592), -INT16_C( 26510),  INT16_C( 15247), -INT16_C( 15644), -INT16_C( 31254),
+       INT16_C( 27405),  INT16_C(   167), -INT16_C(  5831),  INT16_C( 10638), -INT16_C( 24143),  INT16_C( 24748),  INT16_C(  8487),  INT16_C( 20307),
+      -INT16_C( 25229),  INT16_C(  3130),  INT16_C( 12914), -INT16_C(  6801), -INT16_C(    53), -INT16_C( 20704),  INT16_C(  2753), -INT16_C( 12748),
+      -INT16_C(  9354), -INT16_C( 20529),  INT16_C( 24005),  INT16_C( 30424), -INT16_C( 31234),  INT16_C(  9687),  INT16_C( 10918),  INT16_C(  6772),
+      -INT16_C( 20793),  INT16_C( 14886), -INT16_C( 27168), -INT16_C( 21729),  INT16_C( 16276),  INT16_C( 22106), -INT16_C( 29110), -INT16_C( 16348),
+      -INT16_C(  3222),  INT16_C( 12143),  INT16_C( 18256),  INT16_C( 20133),  INT16_C( 31948),  INT16_C( 29555), -INT16_C(  6234),  INT16_C( 28301),
+      -INT16_C( 19563),  INT16_C( 30376), -INT16_C( 14520), -INT16_C(  8927),  INT16_C( 31750),  INT16_C( 20531),  INT16_C( 22282),  INT16_C( 29712),
+       INT16_C( 32587), -INT16_C( 25693),  INT16_C( 18887), -INT16_C( 27670),  INT16_C( 24005),  INT16_C( 27654), -INT16_C( 27835), -INT16_C(  9510),
+      -INT16_C( 32186), -INT16_C( 28848),  INT16_C( 29257),  INT16_C( 20332), -INT16_C( 24594), -INT16_C(  1888), -INT16_C( 20234),  INT16_C( 16749),
+       INT16_C(  4144), -INT16_C(  2083), -INT16_C( 14503),  INT16_C(  8074), -INT16_C( 28380),  INT16_C( 27019),  INT16_C( 25892),  INT16_C( 27460),
+      -INT16_C( 27417),  INT16_C( 12538),  INT16_C( 26118), -INT16_C(  2945),  INT16_C(  7941), -INT16_C(  1043),  INT16_C( 23248),  INT16_C(    61),
+       INT16_C(  6762), -INT16_C( 15113), -INT16_C( 32287),  INT16_C(  1507),  INT16_C( 28178),  INT16_C( 14191), -INT16_C( 19501), -INT16_C( 17758),
+      -INT16_C( 25529),  INT16_C( 20202),  INT16_C( 26882),  INT16_C(  1858),  INT16_C( 12169),  INT16_C( 22786),  INT16_C( 16265), -INT16_C(  2983),
+       INT16_C( 20569),  INT16_C( 15032), -INT16_C( 25647), -INT16_C(  7104), -INT16_C( 20727), -INT16_C(  9189), -INT16_C( 17054), -INT16_C( 22122),
+      -INT16_C( 32679),  INT16_C( 23543),  INT16_C( 15081),  INT16_C( 29282),  INT16_C( 25705), -INT16_C(  3125),  INT16_C(  9380), -INT16_C(   537),
+      -INT16_C( 24716),  INT16_C( 17976),  INT16_C( 30778),  INT16_C( 17194),  INT16_C( 17703), -INT16_C( 30433), -INT16_C( 19198),  INT16_C( 23346),
+       INT16_C( 10805),  INT16_C(  7862),  INT16_C(  6244), -INT16_C( 12911),  INT16_C( 23676),  INT16_C(  8384), -INT16_C( 22655), -INT16_C(  2786),
+       INT16_C( 22086), -INT16_C( 32709),  INT16_C( 26062), -INT16_C(  2621), -INT16_C(  7510), -INT16_C( 21378), -INT16_C( 20329), -INT16_C( 13305),
+      -INT16_C( 16934),  INT16_C( 16107),  INT16_C( 31957),  INT16_C( 21004), -INT16_C( 13096),  INT16_C( 22898), -INT16_C( 28556), -INT16_C( 17841),
+      -INT16_C( 29978), -INT16_C( 19397), -INT16_C(   272), -INT16_C( 25943),  INT16_C( 10209),  INT16_C( 30791),  INT16_C( 20184), -INT16_C( 19899),
+       INT16_C( 12300), -INT16_C(  7695), -INT16_C(   596), -INT16_C( 31693), -INT16_C( 22839),  INT16_C( 15838),  INT16_C( 11574),  INT16_C(  7672),
+       INT16_C( 13239), -INT16_C( 22575),  INT16_C( 31537),  INT16_C(  4674), -INT16_C( 30302),  INT16_C( 31371), -INT16_C( 12073), -INT16_C(  7379),
+       INT16_C(  7680), -INT16_C( 21307), -INT16_C(  2021), -INT16_C(  7120),  INT16_C(  3742), -INT16_C( 10974),  INT16_C(  6715), -INT16_C(  3086),
+      -INT16_C( 15539),  INT16_C( 32410), -INT16_C(  9154), -INT16_C(  7791),  INT16_C(  7269),  INT16_C( 15707), -INT16_C( 30484), -INT16_C(  5088),
+      -INT16_C(  6746), -INT16_C( 15976), -INT16_C( 14114),  INT16_C( 31910), -INT16_C( 14121),  INT16_C(  4689),  INT16_C( 17378),  INT16_C( 12037),
+      -INT16_C( 24569),  INT16_C( 17837),  INT16_C( 15996), -INT16_C(  7642), -INT16_C( 32166),  INT16_C( 17951),  INT16_C( 16138), -INT16_C( 20174),
+      -INT16_C( 13787),  INT16_C(   882),  INT16_C(  6291),  INT16_C( 27263), -INT16_C( 11808), -INT16_C( 15748), -INT16_C( 32236),  INT16_C(  7153),
+      -INT16_C( 24798), -INT16_C( 24991), -INT16_C( 30755),  INT16_C( 14464), -INT16_C( 24823),  INT16_C(  5246), -INT16_C( 20001),  INT16_C(  1221),
+       INT16_C( 14203),  INT16_C(  3591), -INT16_C( 31152),  INT16_C( 12408), -INT16_C(  2729),  INT16_C( 27891), -INT16_C(  7049), -INT16_C( 26233),
+      -INT16_C(  6013),  INT16_C( 24887), -INT16_C( 18320),  INT16_C( 31129),  INT16_C(  5975),  INT16_C( 13965),  INT16_C( 21192),  INT16_C( 17466),
+       INT16_C( 16778), -INT16_C(  9646), -INT16_C( 13368),  INT16_C(  7946), -INT16_C(   576),  INT16_C( 14219),  INT16_C(  5090),  INT16_C( 26064),
+       INT16_C(  2043),  INT16_C( 27590),  INT16_C( 24511),  INT16_C(  6117),  INT16_C( 29303),  INT16_C( 16205), -INT16_C( 30523),  INT16_C( 20355),
+      -INT16_C( 10551), -INT16_C( 28375),  INT16_C( 13217),  INT16_C( 25009),  INT16_C( 15409),  INT16_C(  5016),  INT16_C( 26703),  INT16_C( 19320),
+       INT16_C( 16239),  INT16_C( 12214), -INT16_C( 25698),  INT16_C(  5446), -INT16_C( 27890), -INT16_C( 11435), -INT16_C( 10213), -INT16_C(  6878),
+       INT16_C( 19374),  INT16_C( 20342),  INT16_C( 10110), -INT16_C( 20560),  INT16_C( 18532), -INT16_C( 19518),  INT16_C( 15280),  INT16_C(  8446),
+      -INT16_C( 19078),  INT16_C(  6223), -INT16_C( 27312),  INT16_C( 24110), -INT16_C( 31960),  INT16_C( 17457),  INT16_C( 21339),  INT16_C(  2601),
+      -INT16_C( 24674),  INT16_C(  7513),  INT16_C(  2759),  INT16_C( 11212), -INT16_C( 28846),  INT16_C(   990), -INT16_C(  8758),  INT16_C( 17443),
+       INT16_C( 29330), -INT16_C(  7588), -INT16_C( 30201),  INT16_C( 12097),  INT16_C( 29197),  INT16_C( 26995), -INT16_C( 25402),  INT16_C( 25715),
+      -INT16_C( 13252),  INT16_C(   897),  INT16_C( 20182),  INT16_C( 10542),  INT16_C(  3293), -INT16_C( 22740),  INT16_C( 20457),  INT16_C( 31723),
+       INT16_C( 18369), -INT16_C( 14242), -INT16_C( 24622), -INT16_C(  8201),  INT16_C( 27409), -INT16_C( 10424), -INT16_C( 17657),  INT16_C( 17212),
+      -INT16_C( 17016),  INT16_C( 24134),  INT16_C( 29707), -INT16_C(  6009), -INT16_C( 19583),  INT16_C( 27279),  INT16_C( 31234), -INT16_C( 15386),
+       INT16_C( 17602), -INT16_C( 27509), -INT16_C( 31773), -INT16_C(  2957), -INT16_C( 17170), -INT16_C(  2612),  INT16_C(  2167), -INT16_C(   199),
+       INT16_C( 32709), -INT16_C( 11938), -INT16_C(  6668),  INT16_C( 30137),  INT16_C( 18841), -INT16_C( 25633), -INT16_C( 14909), -INT16_C( 31393),
+      -INT16_C(  5623), -INT16_C(  5095), -INT16_C( 29331),  INT16_C( 23521), -INT16_C( 21175), -INT16_C( 16303), -INT16_C( 30027),  INT16_C( 31424),
+       INT16_C(  7689), -INT16_C(   693),  INT16_C(  1283), -INT16_C( 25486),  INT16_C( 21070),  INT16_C(  4408), -INT16_C( 26857),  INT16_C(  8599),
+      -INT16_C( 20351), -INT16_C(  4339), -INT16_C(  4547), -INT16_C( 31158), -INT16_C( 25701),  INT16_C( 20551),  INT16_C(  1829),  INT16_C( 12235),
+       INT16_C(  5669),  INT16_C( 10284), -INT16_C( 24805) };
+  static const int16_t e[] =
+    {  INT16_C(     0),  INT16_C(     0),  INT16_C( 17624), -INT16_C(  1760),  INT16_C( 25696), -INT16_C( 28229),  INT16_C(     0),  INT16_C( 15644),
+      -INT16_C( 10021), -INT16_C( 31377),  INT16_C(  5075),  INT16_C(  2034),  INT16_C(     0),  INT16_C(     0),  INT16_C(  8697), -INT16_C( 25070),
+       INT16_C( 12729),  INT16_C( 24662), -INT16_C( 26818),  INT16_C(  5702),  INT16_C(     0),  INT16_C( 15616),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 14672),  INT16_C(     0), -INT16_C( 10504),  INT16_C(     0),  INT16_C( 12210), -INT16_C(  5663),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  7232), -INT16_C( 14997),  INT16_C(  3800),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 26435),  INT16_C( 22252),  INT16_C(     0), -INT16_C( 19826),  INT16_C(  8609),
+       INT16_C( 16043),  INT16_C(     0),  INT16_C( 18936),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 27042), -INT16_C( 26818),  INT16_C( 32015),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 23790), -INT16_C( 14208),  INT16_C(  7523), -INT16_C(   988), -INT16_C(  6150),  INT16_C(  6656),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(  1136),  INT16_C(     0), -INT16_C( 32509),  INT16_C(     0),  INT16_C( 27280),  INT16_C(     0),  INT16_C(  3144),  INT16_C(     0),
+      -INT16_C( 32544), -INT16_C(  8664), -INT16_C(  4524),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5680),  INT16_C( 15691),
+      -INT16_C(   290),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2402),  INT16_C( 19974),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(  9262),  INT16_C( 13314),  INT16_C(     0), -INT16_C(  7680), -INT16_C( 10876),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21120),  INT16_C(     0),  INT16_C( 28932),  INT16_C(  9844),  INT16_C(  5362),
+      -INT16_C(  6573),  INT16_C( 15018),  INT16_C( 25283), -INT16_C( 31514),  INT16_C( 29006),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 29352),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10166), -INT16_C(  9267),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 30508),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   704),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17036),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(  5486),  INT16_C(  1622),  INT16_C( 16111),  INT16_C(   304),  INT16_C( 29288), -INT16_C( 26602),  INT16_C(     0), -INT16_C(  8505),
+      -INT16_C( 19134),  INT16_C(     0), -INT16_C(  2400), -INT16_C( 25832), -INT16_C(  2020), -INT16_C( 11550),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(   817),  INT16_C(     0),  INT16_C( 17354),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3306),  INT16_C(  9560),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 12285),  INT16_C( 22514), -INT16_C( 20022), -INT16_C(  5805), -INT16_C( 26278), -INT16_C( 23209),
+       INT16_C(     0), -INT16_C( 14029),  INT16_C(     0), -INT16_C( 25600),  INT16_C( 24528),  INT16_C(  8562), -INT16_C(  1171),  INT16_C(     0),
+      -INT16_C(  2975),  INT16_C(     0), -INT16_C( 13464), -INT16_C( 25496), -INT16_C( 25366),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 26744),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17224), -INT16_C( 30453), -INT16_C( 14174),  INT16_C(     0), -INT16_C( 21554),
+       INT16_C(     0),  INT16_C( 29066),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4272),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  3802),  INT16_C(   946),  INT16_C(     0), -INT16_C( 23376),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 12130),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 28886),  INT16_C( 23240),  INT16_C(     0), -INT16_C(  8121),
+       INT16_C(     0),  INT16_C( 25460),  INT16_C(     0), -INT16_C( 23320), -INT16_C( 18627), -INT16_C(  7997),  INT16_C(  5319),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 28312),  INT16_C(  5162),  INT16_C(     0), -INT16_C( 32320),  INT16_C(     0),
+       INT16_C( 25818),  INT16_C(     0),  INT16_C( 11904),  INT16_C( 12736),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4526),  INT16_C(     0),
+      -INT16_C(  9492), -INT16_C(   154),  INT16_C(     0),  INT16_C(  4409), -INT16_C( 30670),  INT16_C(     0), -INT16_C( 30383),  INT16_C( 15952),
+       INT16_C( 28100),  INT16_C(  5120),  INT16_C(     0), -INT16_C(  3553),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27624),
+       INT16_C(     0), -INT16_C( 13324),  INT16_C(  5008),  INT16_C( 30388),  INT16_C(  1908),  INT16_C(     0),  INT16_C( 21057),  INT16_C(     0),
+      -INT16_C( 26082),  INT16_C( 18888), -INT16_C(  9784),  INT16_C(     0), -INT16_C(  5736),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21762),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9070),  INT16_C(     0),  INT16_C(     0),  INT16_C(   366),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 27701),  INT16_C(  3268),  INT16_C( 27142), -INT16_C( 27780),  INT16_C(  6790), -INT16_C(   297),
+       INT16_C( 14396),  INT16_C(     0),  INT16_C(  1260),  INT16_C( 10533),  INT16_C( 20510),  INT16_C( 26309),  INT16_C( 29310),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  6786),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 19950),  INT16_C( 16432), -INT16_C( 13870),  INT16_C( 20673),  INT16_C(     0),  INT16_C( 27840),  INT16_C(  1584), -INT16_C(  5852),
+       INT16_C(     0), -INT16_C( 20572),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22409),  INT16_C( 21455), -INT16_C( 32456),  INT16_C(     0),
+      -INT16_C( 19366),  INT16_C(   367), -INT16_C( 10608),  INT16_C(     0),  INT16_C(     0), -INT16_C(   280), -INT16_C(  6371),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 28916), -INT16_C( 31744),  INT16_C(     0),  INT16_C( 24012), -INT16_C(  3897),  INT16_C(  6757),  INT16_C(     0),
+       INT16_C( 13368),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 12130),  INT16_C( 19328),
+       INT16_C(     0),  INT16_C( 16561),  INT16_C( 31023),  INT16_C(     0),  INT16_C( 19344),  INT16_C( 17528),  INT16_C( 29204),  INT16_C( 31276),
+       INT16_C( 11435),  INT16_C( 25929),  INT16_C(     0), -INT16_C( 15642),  INT16_C(     0), -INT16_C( 19349),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 14712),  INT16_C(  7996) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_s16_z(pv, av, bv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+
+    ev = simde_svmul_s16_z(pv, av, bv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) };
+  static const int16_t a[] =
+    {  INT16_C(  3756), -INT16_C(  5233), -INT16_C( 15165), -INT16_C(  9525), -INT16_C( 22420), -INT16_C(  5123),  INT16_C( 21218),  INT16_C(  8041),
+      -INT16_C( 13805), -INT16_C( 13681), -INT16_C( 16691), -INT16_C( 21494), -INT16_C( 27296), -INT16_C( 28679),  INT16_C( 16224),  INT16_C(  3153),
+      -INT16_C(  8115),  INT16_C(  4344), -INT16_C( 15452),  INT16_C(  4586), -INT16_C(  6293),  INT16_C( 19964),  INT16_C( 25913),  INT16_C( 19565),
+      -INT16_C(   976), -INT16_C(   746),  INT16_C(  8379),  INT16_C(  7082), -INT16_C( 23626),  INT16_C(  5802), -INT16_C(  1054),  INT16_C( 12066),
+       INT16_C(  6876), -INT16_C( 32705),  INT16_C( 10717),  INT16_C( 18833), -INT16_C( 29424),  INT16_C( 19094),  INT16_C(  1011),  INT16_C(  9110),
+      -INT16_C( 21248), -INT16_C( 17632), -INT16_C( 13619), -INT16_C( 31786), -INT16_C( 32403),  INT16_C( 20377), -INT16_C( 17284),  INT16_C( 22654),
+      -INT16_C( 16938), -INT16_C( 19239),  INT16_C( 27366), -INT16_C(  2051), -INT16_C( 27656), -INT16_C(  5311), -INT16_C( 10345), -INT16_C( 26866),
+       INT16_C( 11908),  INT16_C( 21074),  INT16_C( 10489),  INT16_C( 26325),  INT16_C( 28585),  INT16_C(  9910),  INT16_C( 13355),  INT16_C(   382),
+       INT16_C( 22514), -INT16_C( 10059), -INT16_C( 19774), -INT16_C( 17713),  INT16_C(  4166), -INT16_C(  8795), -INT16_C( 19480),  INT16_C( 27764),
+      -INT16_C( 14623), -INT16_C(  9538), -INT16_C( 27410), -INT16_C( 26559), -INT16_C(  2301),  INT16_C( 11966),  INT16_C( 15403),  INT16_C(  7471),
+      -INT16_C(  6764),  INT16_C( 22262), -INT16_C( 14953), -INT16_C(  8944), -INT16_C( 18986), -INT16_C( 16710),  INT16_C( 11880),  INT16_C( 18730),
+      -INT16_C(  5644), -INT16_C(  7388),  INT16_C( 25981), -INT16_C( 32645),  INT16_C( 14684), -INT16_C( 30802), -INT16_C(  8843),  INT16_C(  2469),
+      -INT16_C( 25662),  INT16_C( 23135),  INT16_C( 28512),  INT16_C( 13879), -INT16_C(  3548), -INT16_C( 29452),  INT16_C(  7968),  INT16_C(  5590),
+      -INT16_C(  1528), -INT16_C( 31240),  INT16_C( 29535), -INT16_C( 17659), -INT16_C( 19540),  INT16_C(  8514), -INT16_C(  6256),  INT16_C( 21291),
+      -INT16_C( 30078), -INT16_C(  7251), -INT16_C(  6918),  INT16_C(  7705),  INT16_C(  3798), -INT16_C(  2133), -INT16_C( 32467),  INT16_C( 13580),
+       INT16_C(  1147), -INT16_C(  9542), -INT16_C( 16521),  INT16_C(  9109), -INT16_C( 10382),  INT16_C(   580),  INT16_C( 28607),  INT16_C( 16725),
+       INT16_C(   762), -INT16_C(  3036),  INT16_C( 16103), -INT16_C( 17134), -INT16_C( 17076),  INT16_C( 31156), -INT16_C( 16322), -INT16_C( 18002),
+       INT16_C( 26820),  INT16_C( 15251),  INT16_C( 10279), -INT16_C( 26274), -INT16_C( 23808), -INT16_C( 16485), -INT16_C(  3822),  INT16_C(  3072),
+       INT16_C(  9715), -INT16_C(  9728),  INT16_C(  4963), -INT16_C( 20584),  INT16_C( 19664),  INT16_C(  3880), -INT16_C( 10739), -INT16_C( 11832),
+       INT16_C( 23614),  INT16_C( 25869),  INT16_C( 27524), -INT16_C( 31490), -INT16_C( 26354),  INT16_C(  8515),  INT16_C( 17546),  INT16_C( 32301),
+       INT16_C( 11881), -INT16_C( 13224), -INT16_C(  4031),  INT16_C(  4475), -INT16_C( 23747),  INT16_C( 18976), -INT16_C(  5767), -INT16_C( 18661),
+       INT16_C( 10309), -INT16_C( 14052),  INT16_C(  6804), -INT16_C( 23986), -INT16_C( 28237),  INT16_C( 16067), -INT16_C(  3627),  INT16_C( 16060),
+       INT16_C(  5151),  INT16_C( 24586), -INT16_C( 31483),  INT16_C( 17009), -INT16_C( 28120), -INT16_C( 24180), -INT16_C( 22661), -INT16_C( 16296),
+       INT16_C( 29904),  INT16_C( 25737), -INT16_C( 10354),  INT16_C( 16902), -INT16_C( 13719),  INT16_C( 16000),  INT16_C( 15547), -INT16_C(  9603),
+      -INT16_C( 30896),  INT16_C( 21818), -INT16_C( 21747),  INT16_C( 13719),  INT16_C(  9021), -INT16_C( 18217),  INT16_C( 12235), -INT16_C( 25736),
+       INT16_C(   676),  INT16_C( 13055),  INT16_C(  1497),  INT16_C( 17012), -INT16_C(  2865), -INT16_C( 30079), -INT16_C(   464), -INT16_C( 32412),
+      -INT16_C( 24955), -INT16_C( 27946),  INT16_C( 28234), -INT16_C( 30776), -INT16_C( 24687),  INT16_C( 23616), -INT16_C( 18226),  INT16_C( 29431),
+      -INT16_C(  2374), -INT16_C( 27483),  INT16_C(  6652), -INT16_C( 13354),  INT16_C( 22286),  INT16_C( 15958), -INT16_C( 17835), -INT16_C(  9281),
+      -INT16_C( 27047), -INT16_C( 23699),  INT16_C( 13572), -INT16_C( 27350),  INT16_C( 27348), -INT16_C( 23566), -INT16_C(  5853), -INT16_C(  8939),
+      -INT16_C( 17696), -INT16_C(  9103),  INT16_C( 18644), -INT16_C(  7513), -INT16_C(   609), -INT16_C(  2784), -INT16_C(  8008),  INT16_C(  4560),
+       INT16_C( 15734),  INT16_C( 31412), -INT16_C(  8589),  INT16_C( 18191),  INT16_C(   329),  INT16_C( 27882),  INT16_C(   235), -INT16_C( 13495),
+      -INT16_C( 17478), -INT16_C( 29017),  INT16_C( 19971), -INT16_C( 23952), -INT16_C( 28340),  INT16_C(  1175),  INT16_C( 26481), -INT16_C(  6379),
+      -INT16_C( 13915),  INT16_C(  6241),  INT16_C( 28839), -INT16_C(  4001),  INT16_C( 19058),  INT16_C( 23900), -INT16_C( 22966),  INT16_C(  1064),
+      -INT16_C( 12447),  INT16_C( 25747),  INT16_C(   797),  INT16_C( 26886), -INT16_C( 24940),  INT16_C(  1389), -INT16_C( 32251), -INT16_C( 21780),
+       INT16_C( 19787), -INT16_C(  3134),  INT16_C(  8894),  INT16_C( 12515),  INT16_C( 16492), -INT16_C( 18803), -INT16_C( 18970),  INT16_C( 18362),
+       INT16_C( 19844), -INT16_C( 24149), -INT16_C( 20143), -INT16_C(  6901),  INT16_C( 30799),  INT16_C( 21995), -INT16_C( 10245),  INT16_C( 18175),
+      -INT16_C( 15835), -INT16_C(  7367),  INT16_C(  7652),  INT16_C( 20499), -INT16_C( 24483),  INT16_C( 17158), -INT16_C( 16299), -INT16_C(  9846),
+       INT16_C( 13582),  INT16_C( 24442), -INT16_C( 31258),  INT16_C( 13892),  INT16_C( 12286), -INT16_C(  1653), -INT16_C( 30201),  INT16_C( 11327),
+       INT16_C( 31052),  INT16_C( 12303),  INT16_C(  8854), -INT16_C(  3200), -INT16_C( 31038),  INT16_C(  5942), -INT16_C( 16313),  INT16_C( 22000),
+       INT16_C( 27381), -INT16_C(  9292), -INT16_C(  1808), -INT16_C(  4591), -INT16_C( 25560),  INT16_C( 12263),  INT16_C(  9767),  INT16_C( 29531),
+       INT16_C( 27295),  INT16_C( 13732),  INT16_C(  9356),  INT16_C( 20008),  INT16_C( 24235), -INT16_C(  3483),  INT16_C( 21790),  INT16_C(  4935),
+      -INT16_C(  1089), -INT16_C( 20497),  INT16_C(   243),  INT16_C(  7069), -INT16_C( 31587), -INT16_C( 15286), -INT16_C( 23125),  INT16_C( 18999),
+      -INT16_C(  9457), -INT16_C( 25728), -INT16_C( 22528), -INT16_C( 21527),  INT16_C( 19975),  INT16_C(  9629), -INT16_C(  7005),  INT16_C( 25401),
+       INT16_C( 10463), -INT16_C( 11758), -INT16_C( 20440), -INT16_C( 14866),  INT16_C( 14388), -INT16_C(  8311), -INT16_C( 15906), -INT16_C(  4822),
+      -INT16_C( 21860), -INT16_C( 25463),  INT16_C( 29266),  INT16_C( 22855), -INT16_C(  6975),  INT16_C( 25727), -INT16_C( 18232), -INT16_C( 22585),
+      -INT16_C(  9504),  INT16_C(  2170),  INT16_C( 26762), -INT16_C( 16690),  INT16_C( 22432),  INT16_C( 32414), -INT16_C( 14312), -INT16_C( 19092),
+      -INT16_C(  2702), -INT16_C( 15279), -INT16_C( 26265),  INT16_C( 10270), -INT16_C( 25219),  INT16_C( 18061),  INT16_C( 21589),  INT16_C( 13805),
+       INT16_C( 26414), -INT16_C( 18371),  INT16_C(  3023),  INT16_C( 28791) };
+  static const int16_t b[] =
+    {  INT16_C( 20922), -INT16_C(  6331),  INT16_C( 19198),  INT16_C( 21114), -INT16_C( 15595),  INT16_C( 32522), -INT16_C( 30213),  INT16_C( 10944),
+       INT16_C(  9978),  INT16_C( 21971), -INT16_C( 18272),  INT16_C( 29273),  INT16_C( 11855), -INT16_C( 18107),  INT16_C( 23528), -INT16_C( 24056),
+       INT16_C( 19884), -INT16_C( 21879),  INT16_C(   919), -INT16_C( 21252),  INT16_C(  1735), -INT16_C( 15828), -INT16_C(  4977), -INT16_C( 29971),
+      -INT16_C( 16366), -INT16_C( 19489),  INT16_C( 14712), -INT16_C( 14555),  INT16_C( 27239),  INT16_C( 20352), -INT16_C( 30523),  INT16_C( 29170),
+       INT16_C( 31701),  INT16_C( 27675),  INT16_C(  6015),  INT16_C( 17945),  INT16_C( 17694), -INT16_C( 21240), -INT16_C(  2767),  INT16_C( 17207),
+       INT16_C(  6069),  INT16_C( 11766),  INT16_C(  6992), -INT16_C( 18444),  INT16_C( 30086),  INT16_C( 19207), -INT16_C(  1539), -INT16_C( 11331),
+      -INT16_C( 10124), -INT16_C(  3265),  INT16_C( 22768),  INT16_C(  3641),  INT16_C( 17053), -INT16_C( 12613), -INT16_C(  3273), -INT16_C(  4846),
+       INT16_C(  2058),  INT16_C( 23066),  INT16_C(  3876), -INT16_C( 21999),  INT16_C(  6276), -INT16_C( 32267), -INT16_C( 19951), -INT16_C( 31148),
+      -INT16_C( 27509),  INT16_C( 31609), -INT16_C( 19476), -INT16_C( 30071),  INT16_C( 17653),  INT16_C( 11352),  INT16_C( 27191),  INT16_C( 16665),
+       INT16_C( 13427), -INT16_C( 26725), -INT16_C( 21181), -INT16_C( 14527),  INT16_C( 14021), -INT16_C( 10424), -INT16_C( 25111),  INT16_C( 29789),
+      -INT16_C( 10703),  INT16_C(  7663),  INT16_C( 30857),  INT16_C( 32423),  INT16_C(   188), -INT16_C(  2901), -INT16_C( 15254), -INT16_C(  8907),
+      -INT16_C( 11784),  INT16_C( 15220), -INT16_C( 19074),  INT16_C( 17154),  INT16_C( 19436), -INT16_C( 10982),  INT16_C( 30696),  INT16_C(  6473),
+       INT16_C( 14414), -INT16_C( 10442), -INT16_C(  8528),  INT16_C( 27734),  INT16_C(   478),  INT16_C( 18528), -INT16_C( 26939), -INT16_C( 16858),
+      -INT16_C( 26009), -INT16_C(  6663), -INT16_C(   944),  INT16_C( 15400),  INT16_C( 17223),  INT16_C( 12049),  INT16_C( 23226),  INT16_C(  2120),
+       INT16_C( 32402),  INT16_C( 17120),  INT16_C( 13916),  INT16_C( 15022),  INT16_C(  3895), -INT16_C(   893), -INT16_C( 22107),  INT16_C(  3258),
+      -INT16_C( 19389), -INT16_C( 27663),  INT16_C(  6576), -INT16_C(  2097), -INT16_C(  8100),  INT16_C(  5926),  INT16_C( 28218), -INT16_C( 13281),
+      -INT16_C(    20),  INT16_C( 18702), -INT16_C( 17099),  INT16_C( 27779),  INT16_C(  1740),  INT16_C( 29033),  INT16_C(  9135), -INT16_C(  3203),
+       INT16_C( 28375), -INT16_C( 30842),  INT16_C( 22151), -INT16_C(  7042), -INT16_C( 23498),  INT16_C( 29179),  INT16_C(  6674), -INT16_C(   195),
+       INT16_C( 19482),  INT16_C( 20296), -INT16_C( 13559), -INT16_C( 10820),  INT16_C(  9682), -INT16_C( 32442), -INT16_C( 15544),  INT16_C(  8308),
+      -INT16_C(  1231), -INT16_C( 18265),  INT16_C(  9809), -INT16_C( 30820), -INT16_C( 26678), -INT16_C(  8712),  INT16_C( 14002), -INT16_C( 13092),
+       INT16_C(  9346), -INT16_C( 29925), -INT16_C( 10257), -INT16_C( 16032), -INT16_C( 22788),  INT16_C( 17731), -INT16_C( 18583), -INT16_C( 26011),
+       INT16_C(  3250),  INT16_C(   850), -INT16_C(  4302), -INT16_C(   629), -INT16_C( 31866),  INT16_C( 14554), -INT16_C( 18759),  INT16_C( 15108),
+       INT16_C(  8410), -INT16_C( 13882),  INT16_C(  9975), -INT16_C(  2933), -INT16_C( 12596),  INT16_C( 13625), -INT16_C( 24955),  INT16_C( 14543),
+       INT16_C(  8874), -INT16_C(  8901), -INT16_C( 14831), -INT16_C( 26662), -INT16_C( 19382),  INT16_C(   976), -INT16_C( 11158),  INT16_C( 17471),
+       INT16_C(  1524), -INT16_C(  5107), -INT16_C( 26580), -INT16_C(  1824),  INT16_C(  6502), -INT16_C(  5074), -INT16_C(   585),  INT16_C( 24868),
+       INT16_C( 24351),  INT16_C( 12350),  INT16_C(  6182),  INT16_C( 28872), -INT16_C( 26420),  INT16_C( 13939), -INT16_C( 19860),  INT16_C( 24954),
+      -INT16_C( 30536), -INT16_C(  7091),  INT16_C( 11552), -INT16_C( 30756),  INT16_C(  2630), -INT16_C(   653), -INT16_C( 26872),  INT16_C( 10078),
+      -INT16_C( 25098),  INT16_C(  7256),  INT16_C(  8373), -INT16_C( 32116),  INT16_C(   184),  INT16_C(  9400),  INT16_C( 13234),  INT16_C( 27269),
+      -INT16_C( 11589), -INT16_C(  9394),  INT16_C( 11263),  INT16_C( 17762), -INT16_C( 10955),  INT16_C( 15682), -INT16_C( 24212),  INT16_C( 25445),
+      -INT16_C( 17090), -INT16_C(  3201),  INT16_C(  3293), -INT16_C( 27275),  INT16_C( 11788), -INT16_C( 16711),  INT16_C( 16225),  INT16_C(  7209),
+       INT16_C( 30481),  INT16_C(  4599),  INT16_C( 23202), -INT16_C( 10154), -INT16_C( 26321), -INT16_C( 25579),  INT16_C( 31290),  INT16_C( 30975),
+       INT16_C( 32311),  INT16_C(  5227), -INT16_C(  7798), -INT16_C( 26967),  INT16_C( 25359),  INT16_C( 28757),  INT16_C( 32418), -INT16_C( 19572),
+      -INT16_C( 31755), -INT16_C( 26428),  INT16_C(  7133),  INT16_C(  3440), -INT16_C( 31308), -INT16_C(  4439), -INT16_C( 22528),  INT16_C( 14182),
+      -INT16_C( 11994), -INT16_C( 20148), -INT16_C(  2638), -INT16_C( 16057), -INT16_C( 25512), -INT16_C(  1487), -INT16_C( 17126),  INT16_C(  4270),
+       INT16_C( 29249),  INT16_C(  7848),  INT16_C(  6285),  INT16_C( 16683), -INT16_C( 11107), -INT16_C( 25297), -INT16_C( 27268), -INT16_C( 23595),
+       INT16_C(  8551),  INT16_C(  6484), -INT16_C( 25834),  INT16_C( 28635),  INT16_C(  3128),  INT16_C( 21097),  INT16_C(  6090),  INT16_C(  2914),
+       INT16_C(  2698),  INT16_C(  5929),  INT16_C( 21794), -INT16_C( 16295), -INT16_C( 30679), -INT16_C( 22947),  INT16_C( 12830), -INT16_C( 31415),
+      -INT16_C( 25261),  INT16_C( 27294),  INT16_C( 31032),  INT16_C( 28889),  INT16_C( 17030),  INT16_C( 20675),  INT16_C(  9562), -INT16_C(  7077),
+      -INT16_C( 31696),  INT16_C( 21243),  INT16_C( 21721),  INT16_C(   786),  INT16_C( 28893), -INT16_C(  1111), -INT16_C(  3422), -INT16_C(  2432),
+       INT16_C(  7823), -INT16_C( 14496),  INT16_C( 14744),  INT16_C(  7736), -INT16_C(  1157), -INT16_C( 10898), -INT16_C( 14048),  INT16_C( 20665),
+      -INT16_C( 19123),  INT16_C( 10147), -INT16_C( 19191), -INT16_C(  6614), -INT16_C( 11483), -INT16_C( 14111),  INT16_C( 25029),  INT16_C( 21694),
+       INT16_C(  7808),  INT16_C(  6171),  INT16_C( 21335), -INT16_C( 11722), -INT16_C( 23474),  INT16_C( 28584),  INT16_C( 24941), -INT16_C( 17729),
+       INT16_C( 25110),  INT16_C(  8417),  INT16_C(  2840),  INT16_C( 15622), -INT16_C(  5922), -INT16_C( 23803), -INT16_C( 15543), -INT16_C( 13833),
+       INT16_C(  5089),  INT16_C( 14561),  INT16_C(  5990), -INT16_C( 19189), -INT16_C( 19525),  INT16_C( 10276), -INT16_C(  7404),  INT16_C( 11235),
+      -INT16_C( 15290),  INT16_C( 24139),  INT16_C( 20944), -INT16_C( 20837), -INT16_C( 24263), -INT16_C( 31918),  INT16_C( 18788),  INT16_C( 17996),
+       INT16_C( 11868), -INT16_C( 15490), -INT16_C( 30395),  INT16_C(   376), -INT16_C( 25540),  INT16_C( 20777),  INT16_C(  3199), -INT16_C( 14980),
+      -INT16_C( 14383), -INT16_C( 24285), -INT16_C( 16616),  INT16_C( 21071), -INT16_C( 24224), -INT16_C( 15147),  INT16_C(  8683),  INT16_C( 18186),
+      -INT16_C( 30385), -INT16_C( 27382), -INT16_C( 32238),  INT16_C( 20374) };
+  static const int16_t e[] =
+    {  INT16_C(  5368), -INT16_C( 31093), -INT16_C( 26758),  INT16_C( 19134), -INT16_C( 22420), -INT16_C( 17694),  INT16_C( 21218),  INT16_C(  8041),
+       INT16_C( 10382), -INT16_C( 13681), -INT16_C( 26592),  INT16_C( 17274), -INT16_C( 27296), -INT16_C( 28679), -INT16_C( 28928), -INT16_C( 23416),
+      -INT16_C(  9028),  INT16_C(  4344), -INT16_C( 15452),  INT16_C(  4586),  INT16_C( 26157),  INT16_C( 24400),  INT16_C( 25913),  INT16_C( 19565),
+      -INT16_C(   976), -INT16_C( 10198), -INT16_C(  1368),  INT16_C(  9618), -INT16_C( 23626), -INT16_C( 13568), -INT16_C(  1054),  INT16_C( 12066),
+       INT16_C(  3340), -INT16_C( 32705), -INT16_C( 24669),  INT16_C( 18833), -INT16_C( 10272), -INT16_C( 19792),  INT16_C( 20611), -INT16_C(  6342),
+       INT16_C( 20736),  INT16_C( 28864), -INT16_C(   240), -INT16_C( 24072), -INT16_C( 32403),  INT16_C( 20377), -INT16_C( 17284),  INT16_C( 22654),
+      -INT16_C( 27400), -INT16_C( 19239),  INT16_C( 18336), -INT16_C(  2051), -INT16_C( 27656), -INT16_C(  5311), -INT16_C( 10345), -INT16_C( 26866),
+       INT16_C( 11908),  INT16_C( 12372),  INT16_C( 10489),  INT16_C( 26325),  INT16_C( 27428),  INT16_C(  9910),  INT16_C( 13355),  INT16_C( 29016),
+      -INT16_C( 22426),  INT16_C( 25741),  INT16_C( 28888), -INT16_C( 17713),  INT16_C( 11006), -INT16_C(  8795), -INT16_C( 19480),  INT16_C( 27764),
+       INT16_C(  2835), -INT16_C(  9538), -INT16_C( 27410),  INT16_C( 12161), -INT16_C(  2301), -INT16_C( 18576),  INT16_C( 15403), -INT16_C(  6637),
+      -INT16_C( 22188),  INT16_C(  3498), -INT16_C( 14953), -INT16_C(  8944), -INT16_C( 30424), -INT16_C( 20930),  INT16_C( 11880),  INT16_C( 18730),
+      -INT16_C(  5644), -INT16_C(  7388),  INT16_C( 21638),  INT16_C( 12790), -INT16_C( 11056), -INT16_C( 29268), -INT16_C(  8843), -INT16_C(  8947),
+      -INT16_C( 25662),  INT16_C( 23135),  INT16_C( 28512),  INT16_C( 13879), -INT16_C(  3548), -INT16_C( 29452), -INT16_C( 19552),  INT16_C(  4548),
+       INT16_C( 26936),  INT16_C(  9784), -INT16_C( 28240),  INT16_C( 25800), -INT16_C( 19540),  INT16_C( 21346), -INT16_C(  8544), -INT16_C( 17384),
+      -INT16_C( 30078), -INT16_C( 11936),  INT16_C(  1496),  INT16_C(  7705), -INT16_C( 17926), -INT16_C(  2133), -INT16_C(  2303),  INT16_C( 13580),
+       INT16_C(  1147), -INT16_C( 18662), -INT16_C( 16521),  INT16_C(  9109), -INT16_C( 10382),  INT16_C( 29208),  INT16_C( 25414), -INT16_C( 23221),
+      -INT16_C( 15240), -INT16_C( 25096),  INT16_C( 16103), -INT16_C( 17134), -INT16_C( 24432),  INT16_C( 24276), -INT16_C(  7070), -INT16_C( 18002),
+       INT16_C( 13468), -INT16_C( 19470),  INT16_C( 10279), -INT16_C( 26274), -INT16_C( 23808), -INT16_C( 16485), -INT16_C(  3822), -INT16_C(  9216),
+       INT16_C(  9715), -INT16_C(  9728),  INT16_C( 12155), -INT16_C( 20584),  INT16_C( 19664),  INT16_C(  3880),  INT16_C(  6824),  INT16_C(  3744),
+       INT16_C( 29150),  INT16_C( 25869),  INT16_C( 27524), -INT16_C( 31490),  INT16_C(  1804),  INT16_C(  4072),  INT16_C( 17546),  INT16_C( 32301),
+       INT16_C( 21842),  INT16_C( 21832), -INT16_C(  4031),  INT16_C(  4475), -INT16_C( 23747),  INT16_C(  1632),  INT16_C( 16801), -INT16_C( 18661),
+       INT16_C( 10309), -INT16_C( 16648),  INT16_C( 23784),  INT16_C( 13914), -INT16_C(  9038),  INT16_C(  6670),  INT16_C( 12525),  INT16_C( 20208),
+       INT16_C(   614),  INT16_C( 24586),  INT16_C(  5587), -INT16_C( 14501), -INT16_C( 28120), -INT16_C(  3028), -INT16_C(  4889), -INT16_C( 16296),
+       INT16_C( 12832),  INT16_C( 25737), -INT16_C( 10354),  INT16_C( 16902), -INT16_C( 13719),  INT16_C( 18432),  INT16_C( 15547), -INT16_C(  9603),
+      -INT16_C( 30896), -INT16_C( 13326),  INT16_C(  7740),  INT16_C( 13719),  INT16_C(  9021), -INT16_C( 18217), -INT16_C( 14051), -INT16_C( 25736),
+       INT16_C(   676),  INT16_C( 13055),  INT16_C( 13878),  INT16_C( 17012), -INT16_C(   780), -INT16_C( 30079), -INT16_C(   464), -INT16_C( 32412),
+      -INT16_C( 26728), -INT16_C( 15778),  INT16_C( 28234),  INT16_C( 10208),  INT16_C( 19366),  INT16_C( 23616), -INT16_C( 18226),  INT16_C( 29431),
+      -INT16_C(  2374), -INT16_C( 27483), -INT16_C(  8404), -INT16_C( 13354),  INT16_C( 22286),  INT16_C( 15958),  INT16_C( 32282), -INT16_C(  9281),
+      -INT16_C( 27047), -INT16_C( 23699),  INT16_C( 31484), -INT16_C( 27350), -INT16_C( 32284), -INT16_C( 23566),  INT16_C( 24004),  INT16_C( 22601),
+      -INT16_C( 24000), -INT16_C(  9103),  INT16_C( 18644), -INT16_C( 13997), -INT16_C(   609), -INT16_C(  2784), -INT16_C(  8008), -INT16_C( 26032),
+      -INT16_C(  4394),  INT16_C( 22444), -INT16_C(  8589), -INT16_C( 30966),  INT16_C(   329),  INT16_C( 27882),  INT16_C(   235), -INT16_C( 19017),
+      -INT16_C( 17478), -INT16_C( 29017), -INT16_C( 20322), -INT16_C(  9232), -INT16_C(  6284), -INT16_C( 27101),  INT16_C(  4994),  INT16_C(  3708),
+       INT16_C( 27113),  INT16_C( 16964), -INT16_C(  8917), -INT16_C(  4001), -INT16_C( 28120),  INT16_C( 23900), -INT16_C( 28672),  INT16_C(  1064),
+      -INT16_C( 12447),  INT16_C( 25747), -INT16_C(  5334), -INT16_C( 22870), -INT16_C( 19744),  INT16_C(  1389), -INT16_C(  6782), -INT16_C( 21780),
+       INT16_C(  1547), -INT16_C(  3134), -INT16_C(  3418),  INT16_C( 12515), -INT16_C(  3524), -INT16_C( 18803), -INT16_C(  1688),  INT16_C(  7106),
+       INT16_C( 19844), -INT16_C( 24149),  INT16_C( 18422), -INT16_C(  6901),  INT16_C( 30799), -INT16_C( 31901), -INT16_C(  1778),  INT16_C( 18175),
+      -INT16_C( 15835), -INT16_C( 31967),  INT16_C(  7652),  INT16_C(  5787), -INT16_C( 24483),  INT16_C( 15662), -INT16_C( 16299), -INT16_C( 17830),
+      -INT16_C( 13942),  INT16_C( 29004),  INT16_C(    80), -INT16_C( 16476),  INT16_C( 12286), -INT16_C(  1653), -INT16_C( 30201),  INT16_C( 11327),
+      -INT16_C(  4544), -INT16_C(  4939), -INT16_C( 30426), -INT16_C(  3200), -INT16_C( 31038),  INT16_C(  5942), -INT16_C( 13586), -INT16_C( 26624),
+       INT16_C( 27381), -INT16_C(  9292), -INT16_C(  1808), -INT16_C(  4591),  INT16_C( 16184), -INT16_C( 14270),  INT16_C( 25568), -INT16_C( 13117),
+       INT16_C( 31955),  INT16_C( 13732),  INT16_C(  9356),  INT16_C( 20008),  INT16_C( 24235), -INT16_C(  3483),  INT16_C( 21790),  INT16_C(  4935),
+      -INT16_C(  1089), -INT16_C(  2507),  INT16_C(  7061), -INT16_C( 25314), -INT16_C(  1066), -INT16_C(  6512),  INT16_C( 21711),  INT16_C( 18999),
+      -INT16_C(  9457), -INT16_C( 21632), -INT16_C( 16384), -INT16_C( 29578),  INT16_C( 19975), -INT16_C( 19695),  INT16_C( 23419),  INT16_C( 31999),
+       INT16_C( 10463), -INT16_C( 28206), -INT16_C( 20440), -INT16_C( 14534),  INT16_C( 27132), -INT16_C(  8311), -INT16_C( 15906), -INT16_C(  4822),
+      -INT16_C( 21860), -INT16_C( 25463),  INT16_C( 29266),  INT16_C( 22855),  INT16_C( 20473),  INT16_C( 25727),  INT16_C( 13856), -INT16_C( 22585),
+      -INT16_C(  9504),  INT16_C(  6668),  INT16_C(  1842), -INT16_C( 16690),  INT16_C(  2432),  INT16_C( 32414),  INT16_C( 25576), -INT16_C(   944),
+      -INT16_C(  2702), -INT16_C( 14317),  INT16_C( 15016),  INT16_C( 10270), -INT16_C( 25219),  INT16_C( 18061),  INT16_C( 21589),  INT16_C( 13805),
+       INT16_C( 30002), -INT16_C( 19614), -INT16_C(  3442), -INT16_C( 24902) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i])),
+      bv = simde_svld1_s16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_s16_m(pv, av, bv);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+    bv = simde_svld1_s16(pg, &(b[i]));
+
+    ev = simde_svmul_s16_m(pv, av, bv);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    { -INT32_C(   574823501), -INT32_C(  1732585143), -INT32_C(   906596602), -INT32_C(  1411829099),  INT32_C(   748500072),  INT32_C(  1279116749),  INT32_C(  1924051461),  INT32_C(   802390396),
+      -INT32_C(  1391685788),  INT32_C(  1866909544), -INT32_C(   885507018), -INT32_C(   680128146),  INT32_C(   302191429), -INT32_C(   564248103),  INT32_C(  1867517427), -INT32_C(   224451442),
+       INT32_C(   480226227), -INT32_C(  1467226766), -INT32_C(  1871396063),  INT32_C(   426240724), -INT32_C(   685020418), -INT32_C(  1615492693),  INT32_C(   604898710), -INT32_C(   585716439),
+      -INT32_C(   872827303), -INT32_C(  1116437349),  INT32_C(   458090567), -INT32_C(   801852206), -INT32_C(   895000802),  INT32_C(  2137611496), -INT32_C(  1952221342),  INT32_C(  2120792613),
+       INT32_C(   189358448),  INT32_C(   751353317),  INT32_C(  2017924517), -INT32_C(   397902903), -INT32_C(  1011683110), -INT32_C(  1371399348), -INT32_C(  1220876910),  INT32_C(   255173279),
+      -INT32_C(   384073980), -INT32_C(   501816516), -INT32_C(  1034265095), -INT32_C(  1280662823), -INT32_C(   545891182),  INT32_C(   177059959),  INT32_C(  1036109726),  INT32_C(  1850603370),
+      -INT32_C(  1302894474),  INT32_C(  1150577995), -INT32_C(  1542983989),  INT32_C(   592949649), -INT32_C(  2063413746),  INT32_C(   613388422), -INT32_C(  1050521257), -INT32_C(  1104171192),
+       INT32_C(  1651541783), -INT32_C(  1079573004), -INT32_C(  2073841933),  INT32_C(  1839774559),  INT32_C(   267627145), -INT32_C(  1842052550),  INT32_C(   458462931),  INT32_C(  1557758789),
+      -INT32_C(    21083638),  INT32_C(  1119774031),  INT32_C(  1942429971),  INT32_C(  1709207516),  INT32_C(  1417007897),  INT32_C(   702982486), -INT32_C(  2075838145), -INT32_C(   958390596),
+      -INT32_C(  1211785624),  INT32_C(   402293508), -INT32_C(  2121612892),  INT32_C(  1239837488), -INT32_C(  1801626818),  INT32_C(  1136558852),  INT32_C(  2043085757), -INT32_C(  1975474399),
+       INT32_C(  1245775174),  INT32_C(   744569736),  INT32_C(   749595900), -INT32_C(  1787390889), -INT32_C(   198568977),  INT32_C(  1412950167),  INT32_C(   214826987), -INT32_C(   325710426),
+      -INT32_C(  1707681774),  INT32_C(   281516051), -INT32_C(   616795004), -INT32_C(   126832120),  INT32_C(  1575787206),  INT32_C(  1840325506), -INT32_C(   914719198), -INT32_C(  1632300916),
+      -INT32_C(    63312664),  INT32_C(   135004292),  INT32_C(  2112047220), -INT32_C(  1049275397),  INT32_C(  1881039342), -INT32_C(  1478570108), -INT32_C(   646948787),  INT32_C(  1366828392),
+      -INT32_C(  1790070511),  INT32_C(   631069105), -INT32_C(  1667071839), -INT32_C(  1034086444), -INT32_C(    47023240), -INT32_C(  1734078390), -INT32_C(   781118360),  INT32_C(  1260579129),
+       INT32_C(  1272999834),  INT32_C(  1769045704), -INT32_C(   771353602), -INT32_C(  1550556373),  INT32_C(   698402783),  INT32_C(  1086407895), -INT32_C(  1844366504), -INT32_C(  1210240228),
+       INT32_C(  1778564514),  INT32_C(   986936123), -INT32_C(  1307780729),  INT32_C(   475373885),  INT32_C(  1061549672), -INT32_C(  1820391622),  INT32_C(  1445302330),  INT32_C(  1695351491),
+      -INT32_C(    70315841),  INT32_C(   171287427), -INT32_C(  1178844804),  INT32_C(  1255477986),  INT32_C(  1116347144),  INT32_C(  1557465378),  INT32_C(  1572010650), -INT32_C(  1128021764),
+       INT32_C(  1404539600), -INT32_C(  1302401995),  INT32_C(   275454509),  INT32_C(   878330156),  INT32_C(  2121786460), -INT32_C(  1998959378) };
+  static const int32_t b[] =
+    { -INT32_C(  1350324855),  INT32_C(    15899444),  INT32_C(  1813042003),  INT32_C(  1209508353), -INT32_C(  1108182873),  INT32_C(  1378200039), -INT32_C(   536135174), -INT32_C(  2100632328),
+      -INT32_C(   986624367),  INT32_C(  1019618281), -INT32_C(   139929866),  INT32_C(   541048953),  INT32_C(   534589752), -INT32_C(   714013989),  INT32_C(   884309307), -INT32_C(   222920607),
+      -INT32_C(  1212684338),  INT32_C(    16022794), -INT32_C(   839410604), -INT32_C(  1779616164),  INT32_C(  1119144551),  INT32_C(   135800525),  INT32_C(    71093667),  INT32_C(   469168717),
+      -INT32_C(   472666663),  INT32_C(  2145634091), -INT32_C(  1068705181),  INT32_C(  2018851088), -INT32_C(   793114365), -INT32_C(   757476817), -INT32_C(   304736864), -INT32_C(   519451640),
+      -INT32_C(  1513759622),  INT32_C(   103065763), -INT32_C(  1815711613), -INT32_C(  1408558167),  INT32_C(  1417528869),  INT32_C(   942102168),  INT32_C(  1931935083),  INT32_C(  1146433482),
+      -INT32_C(  1360455157),  INT32_C(  1169427906),  INT32_C(   651787133), -INT32_C(  1143806826),  INT32_C(  1125142442),  INT32_C(   293287845), -INT32_C(    24862412), -INT32_C(   616375856),
+      -INT32_C(  1232524301), -INT32_C(  1241825736),  INT32_C(  1339806905),  INT32_C(  1661710009), -INT32_C(  1549394947), -INT32_C(  2035015086), -INT32_C(  1803208509),  INT32_C(    91211538),
+       INT32_C(   733739507), -INT32_C(   253642953),  INT32_C(  1145027723),  INT32_C(  1755859562), -INT32_C(  1223995803),  INT32_C(   876527472),  INT32_C(   164152311),  INT32_C(  2098149258),
+       INT32_C(  1739180592),  INT32_C(   223840897), -INT32_C(  1320052922),  INT32_C(  1192884705), -INT32_C(  1191304120), -INT32_C(   622052125), -INT32_C(  1964722945),  INT32_C(   470283244),
+       INT32_C(  1065660605), -INT32_C(  2125669574),  INT32_C(  1412603250), -INT32_C(   543470697),  INT32_C(  1385666927), -INT32_C(   718502698),  INT32_C(   610209848), -INT32_C(  1052678397),
+       INT32_C(  1375782167),  INT32_C(   332614816), -INT32_C(  2140731927), -INT32_C(  1084292528),  INT32_C(  1897002907), -INT32_C(  1287176837),  INT32_C(  1373152846),  INT32_C(   621943053),
+       INT32_C(  2121732830),  INT32_C(  1217481310), -INT32_C(  1614219185), -INT32_C(  1772214022), -INT32_C(  1710788833), -INT32_C(    95596884),  INT32_C(    38544885),  INT32_C(   472342078),
+      -INT32_C(   811884943),  INT32_C(   924265704),  INT32_C(   534175781),  INT32_C(   666186760),  INT32_C(  1354874275),  INT32_C(     4853259),  INT32_C(  1912837684),  INT32_C(  1720658677),
+      -INT32_C(  1321915703),  INT32_C(  2078887254),  INT32_C(   899399469), -INT32_C(  1755557644),  INT32_C(   434576653),  INT32_C(  1595486763), -INT32_C(  1110303544),  INT32_C(   270754119),
+      -INT32_C(   507422325), -INT32_C(   748836186),  INT32_C(  1577646186),  INT32_C(  1458922568), -INT32_C(  1401954943), -INT32_C(   687044593), -INT32_C(   325722459), -INT32_C(   889407425),
+      -INT32_C(  1213481711), -INT32_C(   762705816),  INT32_C(  1227919872),  INT32_C(  2006918646),  INT32_C(   287575554),  INT32_C(  1005138070),  INT32_C(  1294433806),  INT32_C(  1209475894),
+       INT32_C(  1241498337), -INT32_C(   887387445),  INT32_C(   320097052),  INT32_C(  1938469744),  INT32_C(  1485090497), -INT32_C(   325882402),  INT32_C(   574209003), -INT32_C(  1083551522),
+      -INT32_C(   569874157),  INT32_C(   279520243), -INT32_C(   551305618),  INT32_C(   861056369),  INT32_C(   982242908),  INT32_C(   791092804) };
+  static const int32_t e[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1858175851),  INT32_C(   493744088), -INT32_C(   739061509),  INT32_C(           0), -INT32_C(   670048224),
+       INT32_C(           0), -INT32_C(  1893812824), -INT32_C(   405864476),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1182279218),
+       INT32_C(           0), -INT32_C(  1792565132),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1954777038),  INT32_C(           0), -INT32_C(   695292798),  INT32_C(           0),
+      -INT32_C(   582961551),  INT32_C(           0),  INT32_C(           0),  INT32_C(   961023776),  INT32_C(           0), -INT32_C(   482976104),  INT32_C(   887203648),  INT32_C(           0),
+      -INT32_C(  1679511712),  INT32_C(  1386426575),  INT32_C(   578175855),  INT32_C(           0), -INT32_C(   778605694),  INT32_C(  1962917152),  INT32_C(  1948990982),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(  1897021304), -INT32_C(   279476843),  INT32_C(           0),  INT32_C(           0), -INT32_C(   937003597),  INT32_C(   459205144),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(   578359912),  INT32_C(   136621235), -INT32_C(   649404471),  INT32_C(  1184177622), -INT32_C(  1989798164),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(  1862441429),  INT32_C(           0), -INT32_C(  1335397903), -INT32_C(  1134621866),  INT32_C(           0),  INT32_C(  1982742368),  INT32_C(  1231109781),  INT32_C(           0),
+      -INT32_C(   793524768),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1113529592),  INT32_C(           0),  INT32_C(  1599099329),  INT32_C(           0),
+      -INT32_C(   814910776), -INT32_C(  1509549336),  INT32_C(  1788071688), -INT32_C(   832550576),  INT32_C(           0),  INT32_C(           0),  INT32_C(   182952280), -INT32_C(   228508573),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(  1766956380), -INT32_C(  1753216720),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1006740582), -INT32_C(  1633687698),
+      -INT32_C(   484531300),  INT32_C(           0),  INT32_C(  1000854716),  INT32_C(  1221532624),  INT32_C(  1311545338),  INT32_C(           0),  INT32_C(  1015914634),  INT32_C(           0),
+       INT32_C(   507560552), -INT32_C(  1026349152), -INT32_C(  1372129084),  INT32_C(  2117114840),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2082254528),  INT32_C(           0),
+      -INT32_C(  1228725602), -INT32_C(  1536096848), -INT32_C(  1110288596),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1123631257),  INT32_C(   299132856), -INT32_C(  1547979804),
+      -INT32_C(  1989856830),  INT32_C(           0), -INT32_C(  1671496192),  INT32_C(   444187038), -INT32_C(   526017328),  INT32_C(   798170108), -INT32_C(  1646235860),  INT32_C(   799292962),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1832929504),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   899147128),
+       INT32_C(           0), -INT32_C(  1990036145),  INT32_C(           0), -INT32_C(  1107722132), -INT32_C(  2115045104),  INT32_C(           0) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_s32_z(pv, av, bv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+
+    ev = simde_svmul_s32_z(pv, av, bv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const int32_t a[] =
+    { -INT32_C(   600797033),  INT32_C(  1202793231),  INT32_C(    77539253), -INT32_C(  1705158048),  INT32_C(  1422071407), -INT32_C(  1289360950), -INT32_C(  2108175119), -INT32_C(   991462355),
+       INT32_C(   480253964), -INT32_C(   110931645), -INT32_C(   637729928), -INT32_C(   848078243),  INT32_C(   992032368),  INT32_C(   284050975),  INT32_C(  1066616082), -INT32_C(   838632766),
+      -INT32_C(   689265518),  INT32_C(  1859079925), -INT32_C(  1371026351), -INT32_C(  1770276314),  INT32_C(   282172657), -INT32_C(   182337566), -INT32_C(   952847355), -INT32_C(  1047185362),
+      -INT32_C(   778600228),  INT32_C(   524248782),  INT32_C(  1489864242),  INT32_C(   854477121), -INT32_C(   935149339), -INT32_C(  2067963009),  INT32_C(  1179382039),  INT32_C(    84402473),
+       INT32_C(   802659937),  INT32_C(   911087108), -INT32_C(   561112163),  INT32_C(  1242594404), -INT32_C(  1139649988), -INT32_C(   851390538), -INT32_C(   367817536), -INT32_C(   823190931),
+      -INT32_C(  1124219208),  INT32_C(  2062699485), -INT32_C(   883392410),  INT32_C(   957704445),  INT32_C(  1895114682), -INT32_C(  1237436682),  INT32_C(   799035842),  INT32_C(   620597356),
+       INT32_C(   870447702), -INT32_C(  1414671547),  INT32_C(  1366689108),  INT32_C(   680168301), -INT32_C(  1466400590),  INT32_C(  2019546806), -INT32_C(  1800929496), -INT32_C(   424106865),
+      -INT32_C(   484861538), -INT32_C(  1047607443),  INT32_C(   974259660),  INT32_C(  1130536080), -INT32_C(   756286948), -INT32_C(   112571695), -INT32_C(   645009078),  INT32_C(   868173205),
+       INT32_C(  1276565983),  INT32_C(  1812833696),  INT32_C(   983965610), -INT32_C(   662894405), -INT32_C(   727029501), -INT32_C(    36833869),  INT32_C(  2094488294),  INT32_C(  2125436575),
+       INT32_C(   264947311),  INT32_C(   360503147), -INT32_C(  1303436554),  INT32_C(   780848427), -INT32_C(   385731530),  INT32_C(   283627305), -INT32_C(   930300375), -INT32_C(  1001964716),
+       INT32_C(  1825771777), -INT32_C(   545173527), -INT32_C(  1651388046), -INT32_C(   724886626),  INT32_C(  2042482000), -INT32_C(   980835172), -INT32_C(  1215490718),  INT32_C(  1383846993),
+      -INT32_C(   809546010),  INT32_C(   279855262), -INT32_C(  1347600367), -INT32_C(  1417447333), -INT32_C(   517652155),  INT32_C(  1218883301),  INT32_C(   369046468), -INT32_C(   295208440),
+       INT32_C(  1723672264),  INT32_C(  2021026663),  INT32_C(   120071083), -INT32_C(   525161573), -INT32_C(   759048212),  INT32_C(  1243244422), -INT32_C(  1554048613),  INT32_C(  1536280211),
+       INT32_C(  1422020333),  INT32_C(  1707882681), -INT32_C(   143854500), -INT32_C(  1931993440),  INT32_C(  2086574582), -INT32_C(  1664714751),  INT32_C(   608118161), -INT32_C(   662646549),
+      -INT32_C(   684965346), -INT32_C(   700647046), -INT32_C(  1915836179), -INT32_C(  1122326841),  INT32_C(  1077508159), -INT32_C(  2099445775),  INT32_C(   262609700),  INT32_C(   166209515),
+      -INT32_C(   471788439), -INT32_C(    71688947), -INT32_C(  1920431930),  INT32_C(  1833607726),  INT32_C(   212763419), -INT32_C(  1500607870), -INT32_C(  1850395226), -INT32_C(   979657380),
+      -INT32_C(  1079411534),  INT32_C(  1606050713),  INT32_C(   434914283),  INT32_C(     8795877),  INT32_C(   990655673),  INT32_C(  1709284287),  INT32_C(   771135440), -INT32_C(   420310732),
+      -INT32_C(  1482253555), -INT32_C(   385457922), -INT32_C(  1996295261), -INT32_C(   477525719),  INT32_C(  2082379453),  INT32_C(    31522865), -INT32_C(   886122345),  INT32_C(  2008162665),
+      -INT32_C(  1155639108),  INT32_C(  1554261176),  INT32_C(  1105569559), -INT32_C(   316379600),  INT32_C(   896156164), -INT32_C(   650687678), -INT32_C(  1918540509),  INT32_C(  1124358022),
+       INT32_C(  1744708271),  INT32_C(  1589879366),  INT32_C(  2040506441),  INT32_C(   459784983),  INT32_C(  1213321477),  INT32_C(  1075939356),  INT32_C(  1959642861), -INT32_C(   860368611),
+       INT32_C(   959755763), -INT32_C(  1583876265), -INT32_C(  1223018848), -INT32_C(     2981383),  INT32_C(  1866933074), -INT32_C(  1716557653),  INT32_C(  1275952175),  INT32_C(  1075430477),
+      -INT32_C(   797356679), -INT32_C(   462352060),  INT32_C(  1100713031),  INT32_C(  1614835213),  INT32_C(  1037010833),  INT32_C(   517373679),  INT32_C(  1198253050),  INT32_C(   545752231),
+       INT32_C(   368050385),  INT32_C(  1509581329), -INT32_C(    73755154), -INT32_C(  1789142525),  INT32_C(  1355950689), -INT32_C(  1569740632),  INT32_C(   854186635),  INT32_C(   793931870),
+      -INT32_C(  2109455759), -INT32_C(  1831125340), -INT32_C(   678529580), -INT32_C(  1335039665), -INT32_C(  1140769260),  INT32_C(  1902080230), -INT32_C(  1465694134),  INT32_C(   718796217),
+      -INT32_C(   592700616),  INT32_C(   779061338),  INT32_C(  1292238333), -INT32_C(    84053274), -INT32_C(  1749549392), -INT32_C(  1207429522),  INT32_C(   392211550), -INT32_C(   650037343),
+      -INT32_C(  1380520365),  INT32_C(  1943741814),  INT32_C(   146858018),  INT32_C(    50576978),  INT32_C(   731560636),  INT32_C(   786670288), -INT32_C(   263830450), -INT32_C(   825653381),
+      -INT32_C(   344227979), -INT32_C(   966830428), -INT32_C(  1982914761), -INT32_C(  1702047011),  INT32_C(  1556424332),  INT32_C(   394963145),  INT32_C(  1745342700), -INT32_C(   852045480),
+      -INT32_C(   172379568),  INT32_C(  1069225992),  INT32_C(   365529655), -INT32_C(   391162532),  INT32_C(  1162114172),  INT32_C(   157077276), -INT32_C(   143563617) };
+  static const int32_t b[] =
+    {  INT32_C(  1616454473),  INT32_C(   106054523),  INT32_C(  1247078971),  INT32_C(  1861631736),  INT32_C(  1802086072),  INT32_C(   599040513),  INT32_C(  1562861845), -INT32_C(  2146329289),
+       INT32_C(  1004563136), -INT32_C(   381603155),  INT32_C(   338924828), -INT32_C(  1937626668), -INT32_C(   772281392), -INT32_C(  1544246387),  INT32_C(  1140857869),  INT32_C(  2042892729),
+       INT32_C(   699770235), -INT32_C(   200083753),  INT32_C(  1611154828),  INT32_C(  1055689582),  INT32_C(    68150134), -INT32_C(  1666775921), -INT32_C(   639588576),  INT32_C(   861054136),
+       INT32_C(   559679305), -INT32_C(  1978306818),  INT32_C(   585768371),  INT32_C(   526440104),  INT32_C(  1210282169), -INT32_C(  1796945292),  INT32_C(   695059569), -INT32_C(  1302544535),
+      -INT32_C(   975980089), -INT32_C(   615520217), -INT32_C(  1359136506), -INT32_C(   926065393),  INT32_C(  1091694797),  INT32_C(   735442362),  INT32_C(   592724666), -INT32_C(   908742398),
+      -INT32_C(  1852921494), -INT32_C(  1754473071),  INT32_C(   625371414), -INT32_C(  1796402233), -INT32_C(  1093206524), -INT32_C(  1360352268), -INT32_C(   254722322),  INT32_C(  1505339119),
+      -INT32_C(   504674481),  INT32_C(   980965156), -INT32_C(  2006991167), -INT32_C(   702788398),  INT32_C(  1066725963), -INT32_C(  1930592610), -INT32_C(  1401110851), -INT32_C(  1274661532),
+      -INT32_C(  1600786052),  INT32_C(   165285192), -INT32_C(  1634649652), -INT32_C(   797659515),  INT32_C(  1041172640),  INT32_C(  1154153607),  INT32_C(   535840442), -INT32_C(   137103749),
+       INT32_C(   815229159),  INT32_C(  1094283637),  INT32_C(   819973034),  INT32_C(   419451769), -INT32_C(   480767908), -INT32_C(   953736692), -INT32_C(   454682775), -INT32_C(   170084082),
+      -INT32_C(  1775930591), -INT32_C(  1881645083), -INT32_C(  1547716822),  INT32_C(  1740423179), -INT32_C(   599124784), -INT32_C(  1599901385), -INT32_C(  1769698936),  INT32_C(  1670144066),
+      -INT32_C(  1174752812),  INT32_C(   977850896), -INT32_C(  1797453687), -INT32_C(  1728341304), -INT32_C(   445364818),  INT32_C(  1065687222), -INT32_C(   455800159),  INT32_C(  1044865386),
+       INT32_C(   603406611), -INT32_C(  1654767597),  INT32_C(   271661896), -INT32_C(  2069353003),  INT32_C(   694754418), -INT32_C(   697766092),  INT32_C(  1673149945), -INT32_C(  1298005601),
+       INT32_C(  1456838979),  INT32_C(   569586649),  INT32_C(  1144071535), -INT32_C(   993470126),  INT32_C(   720188150),  INT32_C(   436229409),  INT32_C(   847100563), -INT32_C(     1826884),
+      -INT32_C(  1839875655),  INT32_C(  1555319277), -INT32_C(  1063197330), -INT32_C(  1249613377), -INT32_C(  1126206821),  INT32_C(  1524031687),  INT32_C(  1452037018),  INT32_C(   743796851),
+       INT32_C(   398371626),  INT32_C(  1651733236),  INT32_C(   388109144),  INT32_C(   399287932), -INT32_C(   522999016),  INT32_C(   641378699),  INT32_C(  1887225853),  INT32_C(  1637667383),
+       INT32_C(  1903712893),  INT32_C(   634645453),  INT32_C(  2067592703), -INT32_C(  1265432421),  INT32_C(  1066690227),  INT32_C(   224775696), -INT32_C(   847388267),  INT32_C(   808327603),
+       INT32_C(  1084335987), -INT32_C(  1855621998),  INT32_C(    84779369),  INT32_C(  1572446377),  INT32_C(   379342086), -INT32_C(  1323106021), -INT32_C(  1770086174),  INT32_C(   767995065),
+      -INT32_C(   429037485),  INT32_C(  1182258140),  INT32_C(   508265588),  INT32_C(   729482276),  INT32_C(  1816205137), -INT32_C(    98736872), -INT32_C(  1081042171), -INT32_C(  1679009976),
+      -INT32_C(  1686021697), -INT32_C(  1579026132), -INT32_C(  1564529539), -INT32_C(  2117256656),  INT32_C(  1777208913),  INT32_C(  2036534131), -INT32_C(   281480025),  INT32_C(   176825419),
+      -INT32_C(  1432023939), -INT32_C(  2108979451), -INT32_C(   467400013), -INT32_C(  1788481212),  INT32_C(  1946047232),  INT32_C(   116154719), -INT32_C(  1594547115), -INT32_C(   961904824),
+      -INT32_C(  1871687541), -INT32_C(  1978418217),  INT32_C(   158218181),  INT32_C(   698274857), -INT32_C(  2036556761),  INT32_C(  1401719293), -INT32_C(   151813715), -INT32_C(  1933795839),
+      -INT32_C(   987943698), -INT32_C(  1404096281), -INT32_C(  1867137433), -INT32_C(  1179036782), -INT32_C(   331327761), -INT32_C(  1941975841),  INT32_C(  1333932878), -INT32_C(  1076150575),
+       INT32_C(  1367668842), -INT32_C(  1862413528),  INT32_C(   589345425), -INT32_C(   186787323),  INT32_C(   266411312),  INT32_C(   932913385),  INT32_C(   612769363), -INT32_C(   941399460),
+      -INT32_C(  2095552678), -INT32_C(   871164357), -INT32_C(   823118904),  INT32_C(  1036176653), -INT32_C(   749952022),  INT32_C(   386656452),  INT32_C(  1648136454),  INT32_C(  1311318003),
+      -INT32_C(  1026473337),  INT32_C(   546235480),  INT32_C(   636386839),  INT32_C(   895660363),  INT32_C(   403287892), -INT32_C(  1657793385), -INT32_C(  1711313755),  INT32_C(   317139339),
+      -INT32_C(  1009469333), -INT32_C(  1276943460),  INT32_C(   769184481), -INT32_C(   681428093), -INT32_C(  2114950166),  INT32_C(   622731391),  INT32_C(   398335372), -INT32_C(  1322605242),
+      -INT32_C(   109773219),  INT32_C(  1135368289), -INT32_C(  1385134806), -INT32_C(  1434135872), -INT32_C(  1121225666),  INT32_C(   551700884), -INT32_C(  1388797850), -INT32_C(  1570872763),
+      -INT32_C(  1029975200),  INT32_C(  1426409515), -INT32_C(  1929218611), -INT32_C(  2059958713), -INT32_C(  1891409157),  INT32_C(   296756651),  INT32_C(   197060806) };
+  static const int32_t e[] =
+    { -INT32_C(   600797033), -INT32_C(   181232331), -INT32_C(   463628105), -INT32_C(  1705158048),  INT32_C(  1422071407), -INT32_C(  1289360950), -INT32_C(  2108175119),  INT32_C(    65029803),
+      -INT32_C(  1870200576), -INT32_C(   110931645),  INT32_C(   731461920), -INT32_C(   848078243),  INT32_C(   992032368),  INT32_C(   284050975),  INT32_C(   503871978), -INT32_C(   902653902),
+      -INT32_C(   689265518),  INT32_C(  1859079925), -INT32_C(  1371026351), -INT32_C(  1505452460),  INT32_C(   282172657), -INT32_C(   182337566), -INT32_C(   952847355), -INT32_C(   470165232),
+      -INT32_C(   778600228), -INT32_C(  1174764444),  INT32_C(  1489864242),  INT32_C(   854477121), -INT32_C(   935149339), -INT32_C(  1620096116), -INT32_C(  2115631321),  INT32_C(    84402473),
+       INT32_C(   802659937),  INT32_C(  1091893916), -INT32_C(   561112163),  INT32_C(   272342492),  INT32_C(  2042632716), -INT32_C(  1941039044), -INT32_C(   367817536), -INT32_C(   823190931),
+      -INT32_C(  1124219208),  INT32_C(   720814381), -INT32_C(  1607934268),  INT32_C(   957704445),  INT32_C(  1119562472), -INT32_C(  1294027656),  INT32_C(   799035842), -INT32_C(   563356460),
+       INT32_C(   303831690), -INT32_C(  1414671547), -INT32_C(  1675994028),  INT32_C(   680168301), -INT32_C(  1019348954),  INT32_C(  2019546806), -INT32_C(  1800929496), -INT32_C(   424106865),
+       INT32_C(  1123690120), -INT32_C(  1047607443),  INT32_C(  2050165392), -INT32_C(   102418736), -INT32_C(  1561251456),  INT32_C(   616378423),  INT32_C(   209423300),  INT32_C(   868173205),
+       INT32_C(  1135226937), -INT32_C(   386379232),  INT32_C(   578999524),  INT32_C(   535675235), -INT32_C(   727029501), -INT32_C(    36833869),  INT32_C(  2094488294),  INT32_C(  1830233010),
+       INT32_C(   264947311),  INT32_C(   333801399), -INT32_C(  1303436554),  INT32_C(   309006553), -INT32_C(   385731530),  INT32_C(  2069469903), -INT32_C(   273877304),  INT32_C(  1049414568),
+       INT32_C(  1825771777),  INT32_C(  1328160912), -INT32_C(  1651388046),  INT32_C(  1362403184),  INT32_C(  2042482000),  INT32_C(  1079355112),  INT32_C(    85608098),  INT32_C(  1383846993),
+      -INT32_C(  1876606702),  INT32_C(   279855262), -INT32_C(  1347600367), -INT32_C(  1417447333),  INT32_C(   671587514),  INT32_C(  1218883301),  INT32_C(   369046468), -INT32_C(   295208440),
+       INT32_C(  1679208024),  INT32_C(  2021026663),  INT32_C(   659172901),  INT32_C(   701061798), -INT32_C(   759048212),  INT32_C(  1243244422), -INT32_C(  1360702975),  INT32_C(  1536280211),
+       INT32_C(  1422020333), -INT32_C(   665762747), -INT32_C(  2132325496), -INT32_C(  1931993440),  INT32_C(  2086574582),  INT32_C(   840837319),  INT32_C(   608118161),  INT32_C(  1598794129),
+      -INT32_C(   684965346),  INT32_C(   520363080), -INT32_C(  1915836179), -INT32_C(  1465789852), -INT32_C(  1532863768), -INT32_C(  1248915237),  INT32_C(  1135529620), -INT32_C(   271361667),
+       INT32_C(  1347150149), -INT32_C(    71688947), -INT32_C(  1920431930), -INT32_C(   106192422),  INT32_C(   212763419), -INT32_C(  1500607870),  INT32_C(   850206622), -INT32_C(   457899180),
+      -INT32_C(  1079411534),  INT32_C(    30089538),  INT32_C(  1116579427),  INT32_C(     8795877),  INT32_C(   350282070),  INT32_C(  1709284287),  INT32_C(  1257506208), -INT32_C(   420310732),
+      -INT32_C(  1482253555), -INT32_C(   385457922),  INT32_C(   364343772), -INT32_C(   477525719),  INT32_C(  2082379453),  INT32_C(    31522865), -INT32_C(   755128333), -INT32_C(  1824516984),
+      -INT32_C(  1288073148),  INT32_C(  1554261176),  INT32_C(  1105569559),  INT32_C(   607881472),  INT32_C(   896156164), -INT32_C(   650687678), -INT32_C(   671984171), -INT32_C(  1462731710),
+       INT32_C(  1744708271),  INT32_C(  1589879366), -INT32_C(   176585461),  INT32_C(  1363900700),  INT32_C(   683319040), -INT32_C(  1563156892),  INT32_C(   958226609), -INT32_C(   860368611),
+      -INT32_C(   758465807), -INT32_C(  1583876265), -INT32_C(  1582798560),  INT32_C(  1694958817), -INT32_C(  1084991106), -INT32_C(  1716557653),  INT32_C(  1275952175),  INT32_C(  1075430477),
+      -INT32_C(  1916022146),  INT32_C(  1497322588),  INT32_C(  1100713031), -INT32_C(  1261307286), -INT32_C(    58046881),  INT32_C(   517373679),  INT32_C(  1198253050),  INT32_C(  1956691543),
+       INT32_C(   368050385),  INT32_C(  1509581329),  INT32_C(  1183737806), -INT32_C(  1789142525), -INT32_C(   462033104),  INT32_C(    40730856), -INT32_C(   634378991),  INT32_C(   793931870),
+       INT32_C(  1347605178),  INT32_C(   102074316), -INT32_C(   679130720), -INT32_C(  1335039665), -INT32_C(  1140769260),  INT32_C(  1902080230), -INT32_C(  1256350788), -INT32_C(  1973377637),
+       INT32_C(  1719585416),  INT32_C(   779061338),  INT32_C(  1292238333),  INT32_C(  1589489506), -INT32_C(  1749549392), -INT32_C(   651832606),  INT32_C(   392211550), -INT32_C(   325517973),
+      -INT32_C(  1401076559),  INT32_C(  1943741814),  INT32_C(   146858018),  INT32_C(   556485110),  INT32_C(   731560636), -INT32_C(   609762000), -INT32_C(   263830450), -INT32_C(   825653381),
+      -INT32_C(   344227979),  INT32_C(   303576100), -INT32_C(  1982914761), -INT32_C(   359960640), -INT32_C(  1564817944),  INT32_C(  1203561780), -INT32_C(  2058306040), -INT32_C(   633725768),
+      -INT32_C(   172379568),  INT32_C(  1069225992), -INT32_C(   302198517), -INT32_C(   391162532),  INT32_C(  1162114172), -INT32_C(   366124108), -INT32_C(   143563617) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i])),
+      bv = simde_svld1_s32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_s32_m(pv, av, bv);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+    bv = simde_svld1_s32(pg, &(b[i]));
+
+    ev = simde_svmul_s32_m(pv, av, bv);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0) };
+  static const int64_t a[] =
+    {  INT64_C( 2393806270640218778),  INT64_C( 3532291710423598052), -INT64_C( 7152465135408929623), -INT64_C( 8273350062429097767),
+       INT64_C( 3695357761552632841),  INT64_C(  385545247611233167),  INT64_C( 2221842812902960735),  INT64_C( 8809911073234242242),
+      -INT64_C( 5591805925416396829),  INT64_C( 3778295604084087309), -INT64_C( 7384702900860271582),  INT64_C( 7456151758005300365),
+       INT64_C( 1369092110457314089),  INT64_C( 3396816989035747609),  INT64_C( 7034089161633402927), -INT64_C( 6236683390001549946),
+       INT64_C( 2525662918540135412), -INT64_C( 6770541417596876594),  INT64_C( 4681851054867325125),  INT64_C( 2836631370062321971),
+       INT64_C( 1654278228914820040),  INT64_C(   57135276315772853), -INT64_C( 1470545437183610468),  INT64_C( 7441912095125201644),
+       INT64_C( 5308951850961758030),  INT64_C( 4067378952294997814), -INT64_C( 8480518211093263443),  INT64_C( 4039429702600486407),
+      -INT64_C( 5893668782356936617), -INT64_C( 8075355579412863462), -INT64_C( 6213204271824667490), -INT64_C( 5381134846492905679),
+      -INT64_C( 5202828978496134746),  INT64_C( 2084422800850676604),  INT64_C( 6134780259412271575),  INT64_C( 8620385368617743245),
+      -INT64_C( 7766914849017937181), -INT64_C( 2961713795011730613), -INT64_C( 1712930969246286399),  INT64_C( 5705345412732594917),
+       INT64_C( 7882149419901960887), -INT64_C(  541245354860390744),  INT64_C( 2638573093598973018), -INT64_C( 7026450054611504446),
+      -INT64_C(  478841360084022070),  INT64_C(  528642636716740903),  INT64_C( 1102637870746514666), -INT64_C(  337001199947601715),
+      -INT64_C( 5309107827276988665), -INT64_C(  393947248782413101),  INT64_C( 7925333280724043167), -INT64_C(  160594712206427495),
+      -INT64_C( 4433609184963613390), -INT64_C( 7519661213227971430), -INT64_C( 3450461862334576880), -INT64_C( 2041150214834078023),
+       INT64_C( 4881652037523341581), -INT64_C( 2506374355254181207), -INT64_C(  837482362197656744),  INT64_C( 7528979927599938280),
+      -INT64_C( 1856569097787727536),  INT64_C( 1356356147967633703), -INT64_C(  961516275440132231), -INT64_C( 1531495889295881220),
+       INT64_C( 8020102006769460265),  INT64_C(  871225057981289546), -INT64_C( 5218993863120602731),  INT64_C( 5780595686115253939),
+      -INT64_C( 8743452544833479439), -INT64_C( 2776290759806349863),  INT64_C( 6182609550432549211), -INT64_C( 7232822055813325784),
+       INT64_C( 3727149092507571958),  INT64_C( 4731058788157572236),  INT64_C( 6072863493212021073) };
+  static const int64_t b[] =
+    { -INT64_C( 2482159716188972173), -INT64_C( 6703481448975313894), -INT64_C( 6022841606115453933), -INT64_C( 5888218763152804391),
+      -INT64_C( 4668865410495541901),  INT64_C( 2482955708702825391), -INT64_C( 1444311798653353777), -INT64_C( 4871318884355837829),
+       INT64_C( 4470745735877604262),  INT64_C( 6346845701901733603), -INT64_C( 5691541444492234746), -INT64_C( 7707121388889811707),
+       INT64_C( 5138304139383610752), -INT64_C( 1505241426718793926),  INT64_C( 6315743576018173118),  INT64_C( 6692542402674363996),
+      -INT64_C( 1695401106212142644), -INT64_C( 4689997634643185384),  INT64_C( 5849148924139662724),  INT64_C( 5521268558511526248),
+      -INT64_C( 2462635820121781443), -INT64_C( 3934805470495474010), -INT64_C( 2812837232570853456),  INT64_C( 5434361569668272797),
+      -INT64_C( 9049973707879618618), -INT64_C( 5290168226470673786), -INT64_C( 7139241153289046877), -INT64_C( 8485867169585166109),
+       INT64_C(   29692839371043339), -INT64_C( 4432562247938895168),  INT64_C(  950473005221730452),  INT64_C( 1808541659097393867),
+       INT64_C( 7793314967809175469), -INT64_C( 1739322584615161092),  INT64_C( 4665074410497749639), -INT64_C( 6575562255577924458),
+       INT64_C( 2679908039494713111), -INT64_C( 7413175597066656796), -INT64_C( 2485134571020379442),  INT64_C( 5935251984197243587),
+      -INT64_C(   50305838868977153),  INT64_C( 8598874350541049258),  INT64_C( 7499688158804287216), -INT64_C( 3017833040255478127),
+       INT64_C( 2793441767641200041),  INT64_C( 4753891704894061529), -INT64_C( 8871091863613295403),  INT64_C( 3517151359987090978),
+      -INT64_C(  989182125088125533),  INT64_C( 3766819488422700979),  INT64_C( 7897504272754916898), -INT64_C(  337992794429265512),
+      -INT64_C( 5832336356501929213),  INT64_C( 1448746147017687944), -INT64_C(  832669656129353288),  INT64_C( 1153029312649353132),
+       INT64_C(  239037657415162790), -INT64_C( 5132972179064224321),  INT64_C( 6709849634266410702),  INT64_C( 4188737516517601796),
+       INT64_C( 5259129634982481277), -INT64_C( 5121791337611860429), -INT64_C( 2902286477555489109), -INT64_C(  431772178444707021),
+       INT64_C( 4622926381095050838), -INT64_C( 8613029980853296939), -INT64_C( 8165416056586479100), -INT64_C(  706686225685768519),
+      -INT64_C( 1692230775776926666),  INT64_C( 6377694472153069085), -INT64_C( 4871524788865046918),  INT64_C( 5191001180577446517),
+      -INT64_C(  413470396901498808), -INT64_C( 8885190803011081724),  INT64_C( 3791113618122727900) };
+  static const int64_t e[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 4127172781328506123),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 7489766701447066826),
+       INT64_C( 6815625312803829298),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5540055588645376063),
+       INT64_C(                   0),  INT64_C(  482009610000692906),  INT64_C( 4714426490377176802),  INT64_C(                   0),
+      -INT64_C( 6787330176002786704),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(  614840460044853176),
+      -INT64_C( 2971943249898205528),  INT64_C( 1693756321831982430),  INT64_C( 4409990069685264192),  INT64_C( 4769402837764129468),
+       INT64_C(                   0),  INT64_C( 8312665401430721092),  INT64_C( 3304892266192016167), -INT64_C( 9106749812221130699),
+       INT64_C( 7581006029663951293), -INT64_C( 7778744260373420160),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 7884045655431772656), -INT64_C( 8609662205229296031),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4167632389189481650), -INT64_C( 1937881205705439633),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 7870628464918166694),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 6553510150185535174),
+      -INT64_C( 3099382408456815499),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C( 8069404229147877994),  INT64_C(                   0), -INT64_C( 5539511317560122496),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 3955901793378909381), -INT64_C( 3490490188622185517),  INT64_C(                   0),
+      -INT64_C( 7217875589080108090),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 6130129584607074197),  INT64_C( 6668445719658338142),  INT64_C(                   0),
+      -INT64_C( 1265238992875834064), -INT64_C( 2639894191205447120),  INT64_C(                   0) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_s64_z(pv, av, bv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+
+    ev = simde_svmul_s64_z(pv, av, bv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) };
+  static const int64_t a[] =
+    {  INT64_C( 4109301798083065614),  INT64_C( 2233360002631920899),  INT64_C( 5168405751909523714),  INT64_C(   54931539090149532),
+      -INT64_C( 8138385452330819426), -INT64_C(  160305515443028334), -INT64_C( 1762992908927079013), -INT64_C( 4856775824927230040),
+       INT64_C( 7980272832780253092),  INT64_C( 5771042638578203165),  INT64_C( 3781362928692884553), -INT64_C( 2023691561483764976),
+       INT64_C( 4028700877841988510),  INT64_C( 2526913955663773197), -INT64_C( 3811679451516329382), -INT64_C( 1346606733778622420),
+       INT64_C( 4805709368486486879), -INT64_C( 4446718149294554803),  INT64_C( 6791361380259201208),  INT64_C( 9000189992580561067),
+      -INT64_C( 1516402878762824068), -INT64_C( 4120130593133299543), -INT64_C( 1591045833292678309),  INT64_C( 5425090215710799281),
+      -INT64_C( 8025430033457922280),  INT64_C( 7403481332696789226),  INT64_C( 2384056151134435310), -INT64_C( 2689430994935678829),
+      -INT64_C( 8796041777366717833), -INT64_C( 1130620097753411618), -INT64_C( 5349096436869086413),  INT64_C( 7117311299374527017),
+       INT64_C( 6957972922354914414),  INT64_C( 8876762301630843966), -INT64_C( 6434831886813606693), -INT64_C(  296860934699103852),
+      -INT64_C( 8174997251039125078),  INT64_C( 5288350135473853856), -INT64_C(  617564466451152566), -INT64_C(  123471495170687295),
+      -INT64_C( 9090314769135940103), -INT64_C( 1206176736955750773),  INT64_C( 4730790068715227213),  INT64_C( 7959787390452571683),
+      -INT64_C( 2123569995832582107),  INT64_C(  705690463593295926), -INT64_C( 3934349858236169563), -INT64_C(  908680604604566145),
+      -INT64_C( 2192828969177769129),  INT64_C( 3402338170572729457), -INT64_C( 3352161008803778294), -INT64_C( 3931316527499461711),
+       INT64_C( 6759913953900915523),  INT64_C( 2247229238330232181), -INT64_C( 1092323849568025420),  INT64_C(  594722289513110532),
+       INT64_C( 3933269482259593291), -INT64_C( 7527654749752647596), -INT64_C( 6550075947513718807), -INT64_C( 5413788096714209263),
+      -INT64_C( 1149683868770773740), -INT64_C( 8134378721636695647),  INT64_C( 4575605745599953209),  INT64_C(  825834352114244441),
+      -INT64_C( 9054789547960802871), -INT64_C( 3863204946119250131),  INT64_C( 4992561158614686684),  INT64_C( 2000297879189020351),
+      -INT64_C( 4881384612506328355),  INT64_C( 5251746281773090950),  INT64_C( 7440400308977698063), -INT64_C( 6744174783268763398),
+       INT64_C( 4957797702023899266),  INT64_C( 6890010795667316203), -INT64_C( 8659968477268020799),  INT64_C( 5929617622463475684),
+       INT64_C( 4118032024640662307), -INT64_C( 9206150665979592051),  INT64_C( 1743943315636262943),  INT64_C( 7407307871567742891),
+      -INT64_C( 1423859453294792778),  INT64_C( 1886735546459016689), -INT64_C( 9156950720551446113),  INT64_C( 7902348081830210305),
+       INT64_C( 5999550490502886390), -INT64_C( 5579623404152943492),  INT64_C( 5881824602791171915),  INT64_C( 6358871992054422300),
+      -INT64_C( 2528505793638125261),  INT64_C( 7549128209604012797), -INT64_C( 3036224696891193029), -INT64_C( 1909834439619743036),
+       INT64_C( 2005335619244010904),  INT64_C( 5103123784587290445),  INT64_C( 5172577153284463161), -INT64_C( 1100589871456751583),
+      -INT64_C( 2066380826145704936), -INT64_C( 6397892758806364444), -INT64_C( 2791560276676573064), -INT64_C( 5541285049897472046),
+      -INT64_C( 6695659954119245158), -INT64_C(  517691305345457734), -INT64_C( 7033717940890080558),  INT64_C( 1239863696533491942),
+       INT64_C( 1533007670435520227),  INT64_C( 8516322989543709112),  INT64_C( 4748029150806156409),  INT64_C( 8213147959836191859) };
+  static const int64_t b[] =
+    { -INT64_C(  598257105921562440), -INT64_C( 2553793218889720310), -INT64_C( 3770369887753264289),  INT64_C( 7173556546029535206),
+       INT64_C( 6415953053397663679), -INT64_C( 3864090217557306903), -INT64_C( 2558415163728199134),  INT64_C( 1836431091674890862),
+      -INT64_C( 3839538720517860081),  INT64_C( 5169476126775191432), -INT64_C( 2557630696760098898), -INT64_C( 6580478597550226374),
+      -INT64_C( 7425949732020496057), -INT64_C( 7544012160124633375), -INT64_C(  409055981822261240), -INT64_C(   55947856396269823),
+      -INT64_C( 2900853664515671019), -INT64_C( 7289309564722394794), -INT64_C( 3373650424504511629),  INT64_C(  964228783880518825),
+      -INT64_C(  600684501765289764),  INT64_C( 2766915182158907194), -INT64_C( 9095995981532924382), -INT64_C( 6320446061858903228),
+      -INT64_C( 6457277392624124981), -INT64_C( 3853998638465115477), -INT64_C( 6293919687080288946), -INT64_C( 7485213695163463252),
+       INT64_C( 7618797260721396393),  INT64_C( 6013512790646861057),  INT64_C( 6788086489570423079), -INT64_C( 1220487291003856727),
+       INT64_C( 8986580642758398863), -INT64_C( 1277725111219749396), -INT64_C( 8728629335936090676),  INT64_C( 4105889405485298630),
+      -INT64_C( 6190412373463466209), -INT64_C( 6526032689049682503),  INT64_C( 6629018918006876316),  INT64_C( 2924632796106849461),
+       INT64_C( 1353852139809676385), -INT64_C( 2336240915404594153),  INT64_C( 8059852041156606185),  INT64_C(  469891293729604180),
+       INT64_C( 4101634814307026816),  INT64_C( 7599468681712074323),  INT64_C( 8907490211066859380),  INT64_C( 5669853598076922373),
+       INT64_C( 1728839943304238501),  INT64_C( 6231334683014997393),  INT64_C( 3140735337203262452),  INT64_C( 8189941935605313420),
+       INT64_C( 8301319258419744601), -INT64_C(  246855718223420581), -INT64_C( 4201105039792072863),  INT64_C( 7231312105178171164),
+       INT64_C( 2516867635128406680), -INT64_C( 3342531361681477224),  INT64_C( 9009182091914031880), -INT64_C( 8718474168730507374),
+      -INT64_C( 3441332619814272429), -INT64_C( 7593054069024842657), -INT64_C( 7665163935727224640),  INT64_C( 1836399677670556933),
+      -INT64_C( 3693671406723891531), -INT64_C(  346712048419525363), -INT64_C( 1383524388068128717), -INT64_C( 1683962314050371647),
+       INT64_C( 5986570635249571291),  INT64_C( 2158665590975082431), -INT64_C( 8144722761540693722),  INT64_C( 1313562590048540960),
+       INT64_C( 6999841362121723787),  INT64_C( 6207455828612157981), -INT64_C( 4991013569272055455),  INT64_C( 1476696379061293620),
+       INT64_C( 7230821980954810455),  INT64_C( 7395632985743864860), -INT64_C( 7755390562067020790),  INT64_C(  846533469902171171),
+      -INT64_C( 3818668000198548138),  INT64_C(  683625744396938513), -INT64_C( 8885305879064342339), -INT64_C( 8918834605408079750),
+      -INT64_C( 6120916801898333036), -INT64_C( 7163188656222427760), -INT64_C( 3660465164459096755), -INT64_C( 1743961423387860198),
+      -INT64_C( 6866519315803542160),  INT64_C(   61298543074113119),  INT64_C( 1669678759930728971), -INT64_C( 3782693444382677434),
+       INT64_C( 4956645581751954457), -INT64_C( 3912682776641210368), -INT64_C( 8358307869381598226), -INT64_C( 6440244714525007494),
+      -INT64_C(  108761498833095597),  INT64_C( 5195295083707105169),  INT64_C( 1052211273442476488), -INT64_C( 4987311732857519979),
+      -INT64_C( 4254652383781217801), -INT64_C( 3309534351329090193),  INT64_C( 1085503269865801069),  INT64_C( 7880730310419280699),
+       INT64_C( 3425645852530725011),  INT64_C( 4024260704360570364),  INT64_C( 8131330717792188752), -INT64_C( 7484859415203214787) };
+  static const int64_t e[] =
+    {  INT64_C( 4109301798083065614),  INT64_C( 2233360002631920899),  INT64_C( 5168405751909523714),  INT64_C( 2015378331727122472),
+      -INT64_C( 4678454582011037726),  INT64_C(  332446357686084834), -INT64_C( 1762992908927079013),  INT64_C( 7546535515806087728),
+       INT64_C( 2390049328216258204), -INT64_C( 4140580144043177368),  INT64_C( 3781362928692884553),  INT64_C( 2433705516378825120),
+      -INT64_C( 9133536789742733614), -INT64_C( 3484625195803250835), -INT64_C( 3811679451516329382),  INT64_C( 7352924538889706540),
+       INT64_C( 4805709368486486879), -INT64_C(   74601341582809890), -INT64_C( 4532289248161301848),  INT64_C( 9000189992580561067),
+       INT64_C( 3767296915596989072), -INT64_C( 4120130593133299543), -INT64_C( 1591045833292678309),  INT64_C( 5425090215710799281),
+      -INT64_C( 8025430033457922280),  INT64_C( 7403481332696789226),  INT64_C( 2384056151134435310),  INT64_C( 2718837877789273540),
+       INT64_C( 8906118952954830479),  INT64_C( 8547464901725754846), -INT64_C( 5349096436869086413),  INT64_C( 5847197627784787217),
+      -INT64_C( 1019128956350409870),  INT64_C(  148627098960236328), -INT64_C( 6434831886813606693), -INT64_C(  296860934699103852),
+      -INT64_C( 3760969241108158058),  INT64_C( 5288350135473853856), -INT64_C( 2263432107746797288), -INT64_C( 9088027326707459467),
+      -INT64_C( 9090314769135940103),  INT64_C( 2000218213423334013),  INT64_C( 4038044189768443413),  INT64_C( 5751908541585811836),
+      -INT64_C( 3216424918013749888),  INT64_C( 7220841005271184770), -INT64_C( 3934349858236169563), -INT64_C(  908680604604566145),
+      -INT64_C( 2192828969177769129), -INT64_C( 2794118212830838527), -INT64_C( 3352161008803778294),  INT64_C( 4706006922146898892),
+       INT64_C( 6759913953900915523),  INT64_C( 8837141291425728407), -INT64_C(  832420247134178252),  INT64_C(  594722289513110532),
+       INT64_C( 3933269482259593291), -INT64_C(  490091717960907296), -INT64_C( 6550075947513718807),  INT64_C(  739245751313772722),
+      -INT64_C( 1149683868770773740), -INT64_C( 8134378721636695647),  INT64_C( 2539574673756725952),  INT64_C(  825834352114244441),
+       INT64_C( 2044020052274581789), -INT64_C( 3863204946119250131),  INT64_C( 4992561158614686684),  INT64_C( 8295878365740379903),
+      -INT64_C( 4881384612506328355),  INT64_C( 5251746281773090950),  INT64_C( 7440400308977698063), -INT64_C( 6195307525300614848),
+       INT64_C( 4957797702023899266),  INT64_C( 6890010795667316203), -INT64_C( 8659968477268020799),  INT64_C( 1378311361475232336),
+       INT64_C( 4118032024640662307), -INT64_C(  556956334831342740), -INT64_C( 5509431836478640842),  INT64_C( 7407307871567742891),
+       INT64_C( 3570427835852150052),  INT64_C( 1886735546459016689), -INT64_C( 9156950720551446113),  INT64_C( 7902348081830210305),
+      -INT64_C( 7932278563086749128), -INT64_C( 7458745869166120512), -INT64_C( 1154219791300069233), -INT64_C( 2250594902710577960),
+       INT64_C(  567570410385358160),  INT64_C( 1073175440738931171), -INT64_C( 4152476436873884791), -INT64_C( 2952995258296403560),
+       INT64_C( 2005335619244010904),  INT64_C( 5103123784587290445),  INT64_C( 5172577153284463161),  INT64_C( 4946607841647128762),
+      -INT64_C( 7419407206436322360), -INT64_C( 6397892758806364444), -INT64_C( 2791560276676573064), -INT64_C( 5541285049897472046),
+      -INT64_C( 6695659954119245158), -INT64_C(  517691305345457734), -INT64_C( 7033717940890080558),  INT64_C( 1239863696533491942),
+      -INT64_C( 7645258170645566375),  INT64_C(  740388684600977696),  INT64_C( 3482933573795174096),  INT64_C( 2758108174407472487) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i])),
+      bv = simde_svld1_s64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_s64_m(pv, av, bv);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+    bv = simde_svld1_s64(pg, &(b[i]));
+
+    ev = simde_svmul_s64_m(pv, av, bv);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C(234), UINT8_C(231), UINT8_C( 14), UINT8_C(145), UINT8_C(230), UINT8_C(245), UINT8_C(126), UINT8_C(144),
+      UINT8_C(130), UINT8_C(115), UINT8_C(132), UINT8_C( 26), UINT8_C(227), UINT8_C(114), UINT8_C(108), UINT8_C(121),
+      UINT8_C( 93), UINT8_C(215), UINT8_C(146), UINT8_C(195), UINT8_C(128), UINT8_C( 42), UINT8_C( 34), UINT8_C( 49),
+      UINT8_C( 80), UINT8_C(115), UINT8_C( 77), UINT8_C( 64), UINT8_C(134), UINT8_C( 33), UINT8_C( 66), UINT8_C(112),
+      UINT8_C(  8), UINT8_C( 80), UINT8_C(  1), UINT8_C(239), UINT8_C( 69), UINT8_C(127), UINT8_C(127), UINT8_C(199),
+      UINT8_C(243), UINT8_C(  3), UINT8_C(225), UINT8_C(214), UINT8_C(117), UINT8_C( 77), UINT8_C( 79), UINT8_C(210),
+      UINT8_C( 36), UINT8_C(225), UINT8_C(149), UINT8_C(164), UINT8_C( 11), UINT8_C(184), UINT8_C(213), UINT8_C( 91),
+      UINT8_C( 43), UINT8_C( 35), UINT8_C(155), UINT8_C(177), UINT8_C( 68), UINT8_C(221), UINT8_C( 33), UINT8_C( 77),
+      UINT8_C( 45), UINT8_C( 34), UINT8_C( 60), UINT8_C(114), UINT8_C(161), UINT8_C(187), UINT8_C( 57), UINT8_C(148),
+      UINT8_C(190), UINT8_C( 26), UINT8_C(106), UINT8_C( 51), UINT8_C(103), UINT8_C(186), UINT8_C(  6), UINT8_C(139),
+      UINT8_C(155), UINT8_C(155), UINT8_C( 48), UINT8_C(167), UINT8_C( 83), UINT8_C(  5), UINT8_C(  2), UINT8_C(126),
+      UINT8_C( 40), UINT8_C(158), UINT8_C( 47), UINT8_C(109), UINT8_C(123), UINT8_C( 80), UINT8_C(186), UINT8_C(169),
+      UINT8_C(114), UINT8_C(246), UINT8_C( 27), UINT8_C( 20), UINT8_C(177), UINT8_C( 85), UINT8_C(168), UINT8_C(111),
+      UINT8_C(111), UINT8_C( 19), UINT8_C(162), UINT8_C(215), UINT8_C(205), UINT8_C(168), UINT8_C( 98), UINT8_C(104),
+      UINT8_C( 68), UINT8_C(146), UINT8_C( 15), UINT8_C(151), UINT8_C(152), UINT8_C( 18), UINT8_C( 22), UINT8_C(192),
+      UINT8_C(176), UINT8_C( 69), UINT8_C( 45), UINT8_C( 43), UINT8_C(150), UINT8_C(231), UINT8_C(212), UINT8_C(  8),
+      UINT8_C(221), UINT8_C(240), UINT8_C( 28), UINT8_C(142), UINT8_C( 69), UINT8_C(197), UINT8_C(253), UINT8_C(180),
+      UINT8_C(216), UINT8_C(160), UINT8_C(139), UINT8_C(165), UINT8_C( 72), UINT8_C(238), UINT8_C( 13), UINT8_C(140),
+      UINT8_C(128), UINT8_C( 29), UINT8_C( 36), UINT8_C( 24), UINT8_C( 47), UINT8_C( 58), UINT8_C(217), UINT8_C(223),
+      UINT8_C(127), UINT8_C(  6), UINT8_C( 10), UINT8_C( 21), UINT8_C(238), UINT8_C(223), UINT8_C( 30), UINT8_C(203),
+      UINT8_C(207), UINT8_C( 58), UINT8_C( 90), UINT8_C( 20),    UINT8_MAX, UINT8_C( 87), UINT8_C(200), UINT8_C(215),
+      UINT8_C(247), UINT8_C( 84), UINT8_C(124), UINT8_C( 64), UINT8_C( 66), UINT8_C(138), UINT8_C(204), UINT8_C(194),
+      UINT8_C(167), UINT8_C(240), UINT8_C(219), UINT8_C(214), UINT8_C( 42), UINT8_C(180), UINT8_C(181), UINT8_C(170),
+      UINT8_C(186), UINT8_C(191), UINT8_C(191), UINT8_C(168), UINT8_C(158), UINT8_C(221), UINT8_C(116), UINT8_C(109),
+      UINT8_C( 24), UINT8_C(206), UINT8_C(129), UINT8_C( 23), UINT8_C( 37), UINT8_C( 74), UINT8_C(239), UINT8_C( 29),
+      UINT8_C(158), UINT8_C(107), UINT8_C( 93), UINT8_C(224), UINT8_C(245), UINT8_C( 41), UINT8_C(162), UINT8_C(156),
+      UINT8_C( 26), UINT8_C(125), UINT8_C(114), UINT8_C( 68), UINT8_C( 49), UINT8_C( 39), UINT8_C(238), UINT8_C(236),
+      UINT8_C(231), UINT8_C(174), UINT8_C(148), UINT8_C(133), UINT8_C(139), UINT8_C(  8), UINT8_C(243), UINT8_C(163),
+      UINT8_C(214), UINT8_C(116), UINT8_C(187), UINT8_C(252), UINT8_C(190), UINT8_C(170), UINT8_C( 25), UINT8_C( 92),
+      UINT8_C( 21), UINT8_C(118), UINT8_C( 60), UINT8_C( 11), UINT8_C(159), UINT8_C(223), UINT8_C(167), UINT8_C(185),
+      UINT8_C( 92), UINT8_C( 26), UINT8_C(254), UINT8_C(142), UINT8_C( 65), UINT8_C(236), UINT8_C(122), UINT8_C( 40),
+      UINT8_C(154), UINT8_C( 14), UINT8_C(174), UINT8_C( 38), UINT8_C( 23), UINT8_C(161), UINT8_C(201), UINT8_C(237),
+      UINT8_C( 21), UINT8_C(132), UINT8_C(233), UINT8_C(212), UINT8_C( 46), UINT8_C(  2), UINT8_C( 48), UINT8_C( 68),
+      UINT8_C(120), UINT8_C(109), UINT8_C( 79), UINT8_C( 24), UINT8_C( 76), UINT8_C(246), UINT8_C(209), UINT8_C(168),
+      UINT8_C( 16), UINT8_C(207), UINT8_C( 54), UINT8_C( 82), UINT8_C(188), UINT8_C(176), UINT8_C(122), UINT8_C( 86),
+      UINT8_C(191), UINT8_C( 40), UINT8_C(124), UINT8_C(214), UINT8_C(201), UINT8_C( 70), UINT8_C(195), UINT8_C(223),
+      UINT8_C(202), UINT8_C(173), UINT8_C(179), UINT8_C(249), UINT8_C(175), UINT8_C(227), UINT8_C( 61), UINT8_C( 40),
+      UINT8_C( 80), UINT8_C(140), UINT8_C( 64), UINT8_C(156), UINT8_C(130), UINT8_C( 17), UINT8_C( 69), UINT8_C(147),
+      UINT8_C(225), UINT8_C(123), UINT8_C(229), UINT8_C(157), UINT8_C( 44), UINT8_C( 95), UINT8_C(243), UINT8_C(235),
+      UINT8_C(136), UINT8_C(112), UINT8_C(193), UINT8_C( 81), UINT8_C(182), UINT8_C(132), UINT8_C( 48), UINT8_C(128),
+      UINT8_C( 49), UINT8_C(227), UINT8_C(121), UINT8_C(225), UINT8_C(199), UINT8_C(182), UINT8_C(  9), UINT8_C( 23),
+      UINT8_C( 66), UINT8_C( 73), UINT8_C(180), UINT8_C(197), UINT8_C( 90), UINT8_C(249), UINT8_C( 88), UINT8_C( 59),
+      UINT8_C(116), UINT8_C( 61), UINT8_C(216), UINT8_C(160), UINT8_C(156), UINT8_C(204), UINT8_C(139), UINT8_C( 36),
+      UINT8_C( 60), UINT8_C( 76), UINT8_C(118), UINT8_C(242), UINT8_C(209), UINT8_C(166), UINT8_C(114), UINT8_C(  2),
+      UINT8_C(138), UINT8_C(236), UINT8_C(227), UINT8_C( 81), UINT8_C(162), UINT8_C(236), UINT8_C(104), UINT8_C(229),
+      UINT8_C( 53), UINT8_C( 28), UINT8_C(170), UINT8_C(144), UINT8_C( 21), UINT8_C(  2), UINT8_C(203), UINT8_C(138),
+      UINT8_C( 63), UINT8_C(164), UINT8_C( 42), UINT8_C(219), UINT8_C(112), UINT8_C(182), UINT8_C(  0), UINT8_C(172),
+      UINT8_C(  2), UINT8_C(118), UINT8_C(158), UINT8_C(211), UINT8_C( 28), UINT8_C( 16), UINT8_C(214), UINT8_C(166),
+      UINT8_C(252), UINT8_C(185), UINT8_C(247), UINT8_C(159), UINT8_C(166), UINT8_C( 96), UINT8_C(132), UINT8_C(219),
+      UINT8_C(124), UINT8_C( 46), UINT8_C(107), UINT8_C(146), UINT8_C( 48), UINT8_C( 55), UINT8_C( 28), UINT8_C(111),
+      UINT8_C(219), UINT8_C( 70), UINT8_C( 74), UINT8_C( 75), UINT8_C(252), UINT8_C( 74), UINT8_C(247),    UINT8_MAX,
+      UINT8_C(192), UINT8_C(149), UINT8_C(210), UINT8_C(221), UINT8_C(165), UINT8_C(168), UINT8_C(131), UINT8_C(162),
+      UINT8_C( 98), UINT8_C(123), UINT8_C( 65), UINT8_C(  8), UINT8_C(219), UINT8_C(197), UINT8_C(227), UINT8_C( 87),
+      UINT8_C(243), UINT8_C( 79), UINT8_C(233), UINT8_C( 35), UINT8_C(134), UINT8_C(  5), UINT8_C(146), UINT8_C( 97),
+      UINT8_C( 76), UINT8_C(220), UINT8_C(172), UINT8_C( 72), UINT8_C( 39), UINT8_C(163), UINT8_C( 71), UINT8_C(231),
+      UINT8_C( 56), UINT8_C( 26), UINT8_C(196), UINT8_C(221), UINT8_C(194), UINT8_C( 72), UINT8_C(127), UINT8_C( 36),
+      UINT8_C(195), UINT8_C(192), UINT8_C( 44), UINT8_C(158), UINT8_C(133), UINT8_C( 16), UINT8_C(245), UINT8_C(120),
+      UINT8_C( 95), UINT8_C(223), UINT8_C(155), UINT8_C(229), UINT8_C(228), UINT8_C( 45), UINT8_C( 70), UINT8_C( 48),
+      UINT8_C( 10), UINT8_C(242), UINT8_C(121), UINT8_C( 49), UINT8_C(149), UINT8_C(192), UINT8_C( 24), UINT8_C(205),
+      UINT8_C(218), UINT8_C(221), UINT8_C(170), UINT8_C(157), UINT8_C( 37), UINT8_C( 42), UINT8_C(193), UINT8_C(232),
+      UINT8_C(234), UINT8_C(238), UINT8_C(134), UINT8_C(112), UINT8_C(254), UINT8_C(123), UINT8_C(232), UINT8_C( 93),
+      UINT8_C( 90), UINT8_C(132), UINT8_C( 66), UINT8_C( 63), UINT8_C(177), UINT8_C(136), UINT8_C(111), UINT8_C(187),
+      UINT8_C(122), UINT8_C(232), UINT8_C(236), UINT8_C( 15), UINT8_C(169), UINT8_C(  5), UINT8_C(220), UINT8_C(131),
+      UINT8_C(226), UINT8_C(134), UINT8_C( 32), UINT8_C(  7), UINT8_C(176), UINT8_C(226), UINT8_C(239), UINT8_C(155),
+      UINT8_C(208), UINT8_C(117), UINT8_C( 11), UINT8_C(206), UINT8_C(240), UINT8_C(243), UINT8_C( 43), UINT8_C( 75),
+      UINT8_C(119), UINT8_C(109), UINT8_C(138), UINT8_C( 41), UINT8_C(245), UINT8_C(249), UINT8_C(228), UINT8_C(111),
+      UINT8_C(226), UINT8_C(209), UINT8_C(126), UINT8_C(139), UINT8_C(214), UINT8_C( 90), UINT8_C( 14), UINT8_C(184),
+      UINT8_C(224), UINT8_C( 47), UINT8_C(191), UINT8_C(145), UINT8_C( 17), UINT8_C(174), UINT8_C( 44), UINT8_C(225),
+      UINT8_C( 35), UINT8_C( 55), UINT8_C(175), UINT8_C( 19), UINT8_C( 42), UINT8_C(218), UINT8_C( 94), UINT8_C(162),
+      UINT8_C( 71), UINT8_C(232), UINT8_C(203), UINT8_C( 60), UINT8_C(226), UINT8_C(175), UINT8_C(171), UINT8_C(196),
+      UINT8_C(128), UINT8_C( 41), UINT8_C( 79), UINT8_C( 86), UINT8_C(131), UINT8_C( 93), UINT8_C( 14), UINT8_C( 99),
+      UINT8_C(140), UINT8_C(205), UINT8_C(244), UINT8_C(157), UINT8_C(123), UINT8_C( 32), UINT8_C(126), UINT8_C(158),
+      UINT8_C( 87), UINT8_C( 45), UINT8_C(178), UINT8_C(130), UINT8_C(  7), UINT8_C( 16), UINT8_C( 36), UINT8_C( 78),
+      UINT8_C(249), UINT8_C(239), UINT8_C(138), UINT8_C(219), UINT8_C(158), UINT8_C( 53), UINT8_C(159), UINT8_C( 31),
+      UINT8_C( 94), UINT8_C(238), UINT8_C(117), UINT8_C(225), UINT8_C( 75), UINT8_C(132), UINT8_C( 69), UINT8_C(216),
+      UINT8_C( 81), UINT8_C( 57), UINT8_C(117), UINT8_C(205), UINT8_C( 90), UINT8_C(244), UINT8_C(107), UINT8_C(177),
+      UINT8_C( 33), UINT8_C( 29), UINT8_C( 51), UINT8_C( 41), UINT8_C( 46), UINT8_C( 87), UINT8_C(119), UINT8_C( 39),
+      UINT8_C( 70), UINT8_C(  2), UINT8_C(  2), UINT8_C(229), UINT8_C( 55), UINT8_C(161), UINT8_C(  4), UINT8_C(150),
+      UINT8_C(143), UINT8_C(121), UINT8_C(119), UINT8_C(218), UINT8_C(253), UINT8_C(188), UINT8_C(178), UINT8_C( 79),
+      UINT8_C(246), UINT8_C( 40), UINT8_C( 28), UINT8_C( 80), UINT8_C( 28), UINT8_C(135), UINT8_C(  1), UINT8_C( 61),
+      UINT8_C(165), UINT8_C( 53), UINT8_C(102), UINT8_C(211), UINT8_C(140), UINT8_C(222), UINT8_C(250), UINT8_C(211),
+      UINT8_C(224), UINT8_C(252), UINT8_C(184), UINT8_C( 23), UINT8_C(157), UINT8_C(188), UINT8_C(173), UINT8_C( 44),
+      UINT8_C( 53), UINT8_C( 37), UINT8_C(  6), UINT8_C( 51), UINT8_C(225), UINT8_C(185), UINT8_C(130), UINT8_C(215),
+      UINT8_C(225), UINT8_C(158), UINT8_C( 39), UINT8_C(253), UINT8_C( 37), UINT8_C( 41), UINT8_C( 58), UINT8_C(202),
+      UINT8_C( 94), UINT8_C(161), UINT8_C(157), UINT8_C(234), UINT8_C(127), UINT8_C(151), UINT8_C(189), UINT8_C( 95),
+      UINT8_C(147), UINT8_C(117), UINT8_C(118), UINT8_C( 48), UINT8_C( 49), UINT8_C( 36), UINT8_C( 92), UINT8_C(103),
+      UINT8_C( 73), UINT8_C( 99), UINT8_C(154), UINT8_C( 42), UINT8_C( 28), UINT8_C( 28), UINT8_C(  2), UINT8_C(253),
+      UINT8_C(186), UINT8_C( 41), UINT8_C(250), UINT8_C(223), UINT8_C( 82), UINT8_C( 52), UINT8_C(170), UINT8_C(176),
+      UINT8_C(213), UINT8_C( 71), UINT8_C(155), UINT8_C( 84), UINT8_C(223), UINT8_C( 88), UINT8_C(179), UINT8_C(114),
+      UINT8_C(206), UINT8_C( 42), UINT8_C(163),    UINT8_MAX, UINT8_C( 78),    UINT8_MAX, UINT8_C(102), UINT8_C(151),
+      UINT8_C( 98), UINT8_C(  0), UINT8_C(193), UINT8_C(126), UINT8_C( 28), UINT8_C(195), UINT8_C(123), UINT8_C(214),
+      UINT8_C(237), UINT8_C(117), UINT8_C(182), UINT8_C( 63), UINT8_C(170), UINT8_C( 96), UINT8_C(240), UINT8_C(127),
+      UINT8_C(167), UINT8_C(139), UINT8_C(212), UINT8_C(134), UINT8_C(227), UINT8_C(135), UINT8_C(249), UINT8_C(177),
+      UINT8_C(177), UINT8_C(156), UINT8_C(177),    UINT8_MAX, UINT8_C(155), UINT8_C( 23), UINT8_C(150), UINT8_C(254),
+      UINT8_C( 24), UINT8_C( 88), UINT8_C(124), UINT8_C( 52), UINT8_C( 27), UINT8_C(248), UINT8_C( 11), UINT8_C(  8),
+      UINT8_C(109), UINT8_C(193), UINT8_C( 72), UINT8_C( 23), UINT8_C( 33), UINT8_C( 56), UINT8_C(151), UINT8_C(200),
+      UINT8_C(195), UINT8_C(107), UINT8_C( 79), UINT8_C(166), UINT8_C(242), UINT8_C( 72), UINT8_C( 88), UINT8_C(164),
+      UINT8_C(228), UINT8_C(  9), UINT8_C(163), UINT8_C(127), UINT8_C( 32), UINT8_C( 58), UINT8_C(125), UINT8_C( 56),
+      UINT8_C(146), UINT8_C(250), UINT8_C(109), UINT8_C(173), UINT8_C(242), UINT8_C(120), UINT8_C(182), UINT8_C( 95),
+      UINT8_C( 57), UINT8_C(254), UINT8_C(119), UINT8_C( 90), UINT8_C( 54), UINT8_C( 14), UINT8_C( 34), UINT8_C(249),
+      UINT8_C(121), UINT8_C(113), UINT8_C(159), UINT8_C(107), UINT8_C(185), UINT8_C(247), UINT8_C( 15), UINT8_C(157),
+      UINT8_C(  0), UINT8_C(179), UINT8_C( 29), UINT8_C( 33), UINT8_C(237), UINT8_C(154), UINT8_C( 89), UINT8_C(127),
+      UINT8_C(148), UINT8_C(198), UINT8_C( 44), UINT8_C(134), UINT8_C( 62), UINT8_C(226), UINT8_C(230), UINT8_C(119),
+      UINT8_C(224), UINT8_C( 93), UINT8_C(209), UINT8_C( 22), UINT8_C(107), UINT8_C(244), UINT8_C( 15), UINT8_C(228),
+      UINT8_C(101), UINT8_C(175), UINT8_C( 79), UINT8_C( 31), UINT8_C(166), UINT8_C( 95), UINT8_C(188), UINT8_C(167),
+      UINT8_C( 18), UINT8_C(217), UINT8_C(200),    UINT8_MAX, UINT8_C(116), UINT8_C( 33), UINT8_C(126), UINT8_C(  8),
+      UINT8_C(232), UINT8_C(170), UINT8_C(143), UINT8_C( 38), UINT8_C(141), UINT8_C(117), UINT8_C(158), UINT8_C(109),
+      UINT8_C(210), UINT8_C(111), UINT8_C(132), UINT8_C( 61), UINT8_C( 99), UINT8_C(147), UINT8_C( 33), UINT8_C(201),
+      UINT8_C( 66), UINT8_C(112), UINT8_C(232), UINT8_C(233), UINT8_C(207), UINT8_C(164), UINT8_C(144), UINT8_C(225),
+      UINT8_C(126), UINT8_C( 88), UINT8_C(224), UINT8_C(242), UINT8_C(121), UINT8_C( 94), UINT8_C(250), UINT8_C( 97),
+      UINT8_C(  9), UINT8_C(137), UINT8_C(136), UINT8_C(150), UINT8_C(254), UINT8_C( 38), UINT8_C(  3), UINT8_C(208),
+      UINT8_C(149), UINT8_C(135), UINT8_C( 13), UINT8_C(249), UINT8_C( 27), UINT8_C( 46), UINT8_C(194), UINT8_C( 93),
+      UINT8_C(159), UINT8_C(170), UINT8_C( 70), UINT8_C(110), UINT8_C( 78), UINT8_C(214), UINT8_C( 80), UINT8_C(204),
+      UINT8_C( 46), UINT8_C( 48), UINT8_C(190), UINT8_C(168), UINT8_C(143), UINT8_C(185), UINT8_C(  9), UINT8_C(152),
+      UINT8_C( 66), UINT8_C(145), UINT8_C( 46), UINT8_C( 65), UINT8_C(183), UINT8_C( 49), UINT8_C( 17), UINT8_C( 77),
+      UINT8_C(185), UINT8_C( 31), UINT8_C( 70), UINT8_C(212), UINT8_C( 77), UINT8_C(  8), UINT8_C( 49), UINT8_C(236),
+      UINT8_C(178), UINT8_C(120), UINT8_C( 91), UINT8_C(  0), UINT8_C( 78), UINT8_C(171), UINT8_C(205), UINT8_C(125),
+      UINT8_C(219), UINT8_C(139), UINT8_C( 37), UINT8_C(106), UINT8_C( 68), UINT8_C( 46), UINT8_C(  2), UINT8_C(135),
+      UINT8_C(192), UINT8_C( 48), UINT8_C(200), UINT8_C(119), UINT8_C( 98), UINT8_C(217), UINT8_C(196), UINT8_C( 27),
+      UINT8_C(248), UINT8_C( 10), UINT8_C(239), UINT8_C( 70), UINT8_C( 18), UINT8_C( 32), UINT8_C( 50), UINT8_C(196),
+      UINT8_C(152), UINT8_C(141), UINT8_C(197), UINT8_C(231) };
+  static const uint8_t b[] =
+    { UINT8_C(249), UINT8_C(184), UINT8_C( 34), UINT8_C(229), UINT8_C(217), UINT8_C(247), UINT8_C(239), UINT8_C(132),
+      UINT8_C( 75), UINT8_C( 90), UINT8_C(230), UINT8_C( 32), UINT8_C(175), UINT8_C(191), UINT8_C(167), UINT8_C(180),
+      UINT8_C(136), UINT8_C( 65), UINT8_C( 68), UINT8_C(  4), UINT8_C(  9), UINT8_C( 87), UINT8_C( 62), UINT8_C(239),
+      UINT8_C( 51), UINT8_C( 72), UINT8_C( 19), UINT8_C( 11), UINT8_C(232), UINT8_C( 14), UINT8_C(107), UINT8_C(225),
+      UINT8_C(198), UINT8_C(141), UINT8_C(199), UINT8_C(159), UINT8_C(133), UINT8_C(182), UINT8_C( 35), UINT8_C(208),
+      UINT8_C( 16), UINT8_C(  9), UINT8_C(241), UINT8_C(191), UINT8_C(201), UINT8_C(152), UINT8_C(116), UINT8_C( 81),
+      UINT8_C(217), UINT8_C(184), UINT8_C( 85), UINT8_C(226), UINT8_C( 16), UINT8_C(147), UINT8_C(210), UINT8_C( 67),
+      UINT8_C(219), UINT8_C(229), UINT8_C( 78), UINT8_C(195), UINT8_C(243), UINT8_C(186), UINT8_C(165), UINT8_C(185),
+      UINT8_C( 71), UINT8_C(108), UINT8_C( 89), UINT8_C(204), UINT8_C( 34), UINT8_C(124), UINT8_C(157), UINT8_C( 50),
+      UINT8_C(134), UINT8_C(142), UINT8_C(242), UINT8_C( 79), UINT8_C( 38), UINT8_C(102), UINT8_C(160),    UINT8_MAX,
+      UINT8_C( 30), UINT8_C(245), UINT8_C(225), UINT8_C( 46), UINT8_C(136), UINT8_C(179), UINT8_C(114), UINT8_C( 99),
+      UINT8_C(153), UINT8_C(192), UINT8_C( 39), UINT8_C(140), UINT8_C(122), UINT8_C(204), UINT8_C( 70), UINT8_C(194),
+      UINT8_C( 56), UINT8_C(159), UINT8_C(142), UINT8_C( 90), UINT8_C( 27), UINT8_C( 43), UINT8_C(140), UINT8_C(161),
+      UINT8_C(185), UINT8_C(126), UINT8_C(240), UINT8_C(223), UINT8_C(228), UINT8_C(144), UINT8_C(222), UINT8_C(  3),
+      UINT8_C(133), UINT8_C(192), UINT8_C( 49), UINT8_C( 13), UINT8_C(115), UINT8_C(163), UINT8_C(113), UINT8_C( 12),
+      UINT8_C(100), UINT8_C(152), UINT8_C(153), UINT8_C(222), UINT8_C(100), UINT8_C(223), UINT8_C(160), UINT8_C(156),
+      UINT8_C(126), UINT8_C( 47), UINT8_C(246), UINT8_C(153), UINT8_C( 90), UINT8_C(130), UINT8_C( 59), UINT8_C( 20),
+      UINT8_C(  1), UINT8_C( 43), UINT8_C(243), UINT8_C(229), UINT8_C(188), UINT8_C(210), UINT8_C(232), UINT8_C( 65),
+      UINT8_C(146), UINT8_C( 26), UINT8_C( 79), UINT8_C(  5), UINT8_C(189), UINT8_C(192), UINT8_C( 18), UINT8_C( 33),
+      UINT8_C( 88), UINT8_C(171), UINT8_C(  0), UINT8_C(188), UINT8_C(138), UINT8_C(160), UINT8_C( 88), UINT8_C(  8),
+      UINT8_C(207), UINT8_C( 78), UINT8_C(161), UINT8_C( 42), UINT8_C(208), UINT8_C(220), UINT8_C( 62), UINT8_C(209),
+      UINT8_C(  8), UINT8_C( 49), UINT8_C(183), UINT8_C(196), UINT8_C(  3), UINT8_C(159), UINT8_C(  5), UINT8_C(149),
+      UINT8_C(185), UINT8_C( 84), UINT8_C(155), UINT8_C(119), UINT8_C( 20), UINT8_C(173), UINT8_C(152), UINT8_C(108),
+      UINT8_C( 88), UINT8_C(152), UINT8_C( 40), UINT8_C(226), UINT8_C( 57), UINT8_C(128), UINT8_C(234), UINT8_C(  8),
+      UINT8_C(206), UINT8_C(139), UINT8_C( 50), UINT8_C(159), UINT8_C(104), UINT8_C(112), UINT8_C(112), UINT8_C(112),
+      UINT8_C(162), UINT8_C( 39), UINT8_C( 52), UINT8_C(165), UINT8_C(199), UINT8_C( 57), UINT8_C( 59), UINT8_C(128),
+      UINT8_C(142), UINT8_C(214), UINT8_C(247), UINT8_C(162), UINT8_C(131), UINT8_C(144), UINT8_C( 15), UINT8_C(219),
+      UINT8_C( 40), UINT8_C( 55), UINT8_C(189), UINT8_C( 97), UINT8_C(184), UINT8_C(167), UINT8_C(106), UINT8_C(134),
+      UINT8_C( 50), UINT8_C(156), UINT8_C( 37), UINT8_C(154), UINT8_C( 13), UINT8_C(150), UINT8_C( 10), UINT8_C(175),
+      UINT8_C(189), UINT8_C( 62), UINT8_C( 84), UINT8_C(132), UINT8_C(120), UINT8_C(143), UINT8_C(  5), UINT8_C(  6),
+      UINT8_C(101), UINT8_C(252), UINT8_C(168), UINT8_C(232), UINT8_C(140), UINT8_C(183), UINT8_C(195), UINT8_C(181),
+      UINT8_C(239), UINT8_C(128), UINT8_C( 22), UINT8_C(167), UINT8_C( 39), UINT8_C(128), UINT8_C( 45), UINT8_C( 90),
+      UINT8_C( 29), UINT8_C( 83), UINT8_C(244), UINT8_C( 42), UINT8_C(233),    UINT8_MAX, UINT8_C(217), UINT8_C(166),
+      UINT8_C( 61), UINT8_C( 45), UINT8_C( 43), UINT8_C(181), UINT8_C(189), UINT8_C( 48), UINT8_C(187), UINT8_C( 34),
+      UINT8_C( 44), UINT8_C(100), UINT8_C( 11), UINT8_C(185), UINT8_C( 27), UINT8_C(206), UINT8_C(110), UINT8_C( 10),
+      UINT8_C( 79), UINT8_C(132), UINT8_C(177), UINT8_C(118), UINT8_C(  5), UINT8_C(223), UINT8_C(208), UINT8_C( 34),
+      UINT8_C( 50), UINT8_C(197), UINT8_C( 76), UINT8_C( 27), UINT8_C(196), UINT8_C( 37), UINT8_C(193), UINT8_C(  1),
+      UINT8_C( 82), UINT8_C(236), UINT8_C(183), UINT8_C( 15), UINT8_C( 28), UINT8_C(114), UINT8_C( 50), UINT8_C( 73),
+      UINT8_C(214), UINT8_C( 61), UINT8_C(  2), UINT8_C(242), UINT8_C( 11), UINT8_C(112), UINT8_C(252), UINT8_C( 90),
+      UINT8_C(244), UINT8_C(174), UINT8_C(209), UINT8_C(249), UINT8_C(141), UINT8_C(161), UINT8_C( 27), UINT8_C(191),
+      UINT8_C(102), UINT8_C(103), UINT8_C(218), UINT8_C( 42), UINT8_C(140), UINT8_C(155), UINT8_C( 44), UINT8_C(223),
+      UINT8_C(136), UINT8_C(227), UINT8_C(238), UINT8_C(164), UINT8_C( 85), UINT8_C( 32), UINT8_C(237), UINT8_C( 44),
+      UINT8_C( 93), UINT8_C(239), UINT8_C( 30), UINT8_C(105), UINT8_C( 95), UINT8_C( 26), UINT8_C(195), UINT8_C( 84),
+      UINT8_C(200), UINT8_C(148), UINT8_C( 77), UINT8_C( 85), UINT8_C( 54), UINT8_C(105), UINT8_C( 20), UINT8_C(156),
+      UINT8_C(208), UINT8_C(238), UINT8_C(199), UINT8_C( 93), UINT8_C(138), UINT8_C(243), UINT8_C( 60), UINT8_C( 18),
+      UINT8_C(214), UINT8_C( 42), UINT8_C(182), UINT8_C( 43), UINT8_C( 75), UINT8_C(164), UINT8_C( 87), UINT8_C(168),
+      UINT8_C(147), UINT8_C(117), UINT8_C( 17), UINT8_C(243), UINT8_C(144), UINT8_C(213), UINT8_C( 71), UINT8_C( 88),
+      UINT8_C(105), UINT8_C(148), UINT8_C(174), UINT8_C(159), UINT8_C(253), UINT8_C(194), UINT8_C( 60), UINT8_C(206),
+      UINT8_C(177), UINT8_C(  3), UINT8_C( 43), UINT8_C( 59), UINT8_C(246), UINT8_C(103), UINT8_C( 77), UINT8_C(204),
+      UINT8_C(145), UINT8_C(  3), UINT8_C(247), UINT8_C(220), UINT8_C(167), UINT8_C( 79), UINT8_C(133), UINT8_C( 59),
+      UINT8_C(196), UINT8_C(150), UINT8_C( 46), UINT8_C( 84), UINT8_C(107), UINT8_C(117), UINT8_C(173), UINT8_C(213),
+      UINT8_C(  9), UINT8_C( 91), UINT8_C(116), UINT8_C(  7), UINT8_C( 29), UINT8_C(176), UINT8_C(213), UINT8_C(206),
+      UINT8_C(179), UINT8_C(  0), UINT8_C(  9), UINT8_C(169), UINT8_C(103), UINT8_C( 86), UINT8_C(117), UINT8_C(248),
+      UINT8_C( 90), UINT8_C(109), UINT8_C(213), UINT8_C(  1), UINT8_C(188), UINT8_C( 90), UINT8_C( 60), UINT8_C(128),
+      UINT8_C(240), UINT8_C(106), UINT8_C(213), UINT8_C( 92), UINT8_C(223), UINT8_C(130), UINT8_C( 49), UINT8_C(233),
+      UINT8_C(221), UINT8_C(165), UINT8_C(240), UINT8_C(250), UINT8_C( 86), UINT8_C(197), UINT8_C(201), UINT8_C(  9),
+      UINT8_C(197), UINT8_C(210), UINT8_C(179), UINT8_C( 44), UINT8_C( 41), UINT8_C( 40), UINT8_C( 36), UINT8_C(131),
+      UINT8_C(149), UINT8_C(249), UINT8_C(132), UINT8_C( 81), UINT8_C( 83), UINT8_C(193), UINT8_C(210), UINT8_C( 68),
+      UINT8_C( 43), UINT8_C(167), UINT8_C(160), UINT8_C( 11), UINT8_C( 41), UINT8_C(209), UINT8_C(244), UINT8_C(  6),
+      UINT8_C(118), UINT8_C(228), UINT8_C(  0), UINT8_C(204), UINT8_C(169), UINT8_C(201), UINT8_C(214), UINT8_C(110),
+      UINT8_C(156), UINT8_C(137), UINT8_C(154), UINT8_C(197), UINT8_C(177), UINT8_C(190), UINT8_C( 72), UINT8_C( 71),
+      UINT8_C(184), UINT8_C(204), UINT8_C(152), UINT8_C( 11), UINT8_C(141), UINT8_C(106), UINT8_C( 79), UINT8_C(185),
+      UINT8_C( 17), UINT8_C(239), UINT8_C(196), UINT8_C( 58), UINT8_C(192), UINT8_C(184), UINT8_C( 64), UINT8_C( 55),
+      UINT8_C(156), UINT8_C( 65), UINT8_C(  3), UINT8_C( 69), UINT8_C( 10), UINT8_C(217), UINT8_C(179), UINT8_C(166),
+      UINT8_C( 98), UINT8_C( 77), UINT8_C(107), UINT8_C( 20), UINT8_C( 11), UINT8_C(179), UINT8_C( 91), UINT8_C(195),
+      UINT8_C(128), UINT8_C(243), UINT8_C(207), UINT8_C( 13), UINT8_C( 94), UINT8_C( 30), UINT8_C(198), UINT8_C(111),
+      UINT8_C( 14), UINT8_C(138), UINT8_C(170), UINT8_C(206), UINT8_C( 66), UINT8_C(234), UINT8_C(  5), UINT8_C(222),
+      UINT8_C( 43), UINT8_C(  9), UINT8_C( 35), UINT8_C( 54), UINT8_C(226), UINT8_C(214), UINT8_C(220), UINT8_C( 69),
+      UINT8_C( 35), UINT8_C( 72), UINT8_C( 89), UINT8_C( 47), UINT8_C(251), UINT8_C(180), UINT8_C(242), UINT8_C(123),
+      UINT8_C(167), UINT8_C(193), UINT8_C(137), UINT8_C(  5), UINT8_C(224), UINT8_C( 79), UINT8_C(117), UINT8_C(238),
+      UINT8_C(218), UINT8_C( 31), UINT8_C(188), UINT8_C( 28), UINT8_C(  9), UINT8_C(194), UINT8_C(251), UINT8_C( 53),
+      UINT8_C(203), UINT8_C( 30), UINT8_C(107), UINT8_C(173), UINT8_C(245), UINT8_C( 71), UINT8_C(242), UINT8_C( 24),
+      UINT8_C(143), UINT8_C( 75), UINT8_C( 71), UINT8_C(139),    UINT8_MAX, UINT8_C( 58), UINT8_C(  6), UINT8_C(167),
+      UINT8_C(251), UINT8_C(143), UINT8_C(172), UINT8_C(219), UINT8_C(223), UINT8_C( 33), UINT8_C(201), UINT8_C(185),
+      UINT8_C( 64), UINT8_C(134), UINT8_C(213), UINT8_C( 74), UINT8_C( 72), UINT8_C(208), UINT8_C(127), UINT8_C( 19),
+      UINT8_C(239), UINT8_C(234), UINT8_C(192), UINT8_C(228), UINT8_C( 49), UINT8_C(179), UINT8_C(252), UINT8_C(193),
+      UINT8_C(254), UINT8_C( 68), UINT8_C( 76), UINT8_C(254), UINT8_C(126), UINT8_C( 82), UINT8_C(165), UINT8_C(121),
+      UINT8_C(226), UINT8_C( 81), UINT8_C( 85), UINT8_C(193), UINT8_C(115), UINT8_C( 30), UINT8_C(122), UINT8_C(179),
+      UINT8_C(164), UINT8_C( 79), UINT8_C(253), UINT8_C(236), UINT8_C( 32), UINT8_C(124),    UINT8_MAX, UINT8_C( 15),
+      UINT8_C(102), UINT8_C(192), UINT8_C(243), UINT8_C(152), UINT8_C(115), UINT8_C(239), UINT8_C( 89), UINT8_C(113),
+      UINT8_C( 51), UINT8_C(165), UINT8_C(111), UINT8_C(177), UINT8_C(247), UINT8_C( 20), UINT8_C( 43), UINT8_C(217),
+      UINT8_C(102), UINT8_C(128), UINT8_C(154), UINT8_C(217), UINT8_C(158), UINT8_C( 20), UINT8_C(140), UINT8_C( 67),
+      UINT8_C(100), UINT8_C(138), UINT8_C( 47), UINT8_C(132), UINT8_C(  6), UINT8_C( 47), UINT8_C(147), UINT8_C(109),
+      UINT8_C(239), UINT8_C(134), UINT8_C(  5), UINT8_C( 98), UINT8_C(117), UINT8_C( 94), UINT8_C(211), UINT8_C(169),
+      UINT8_C(  3), UINT8_C( 67), UINT8_C( 90), UINT8_C(250), UINT8_C( 87), UINT8_C(133), UINT8_C(212), UINT8_C(189),
+      UINT8_C(  5), UINT8_C(110), UINT8_C(150), UINT8_C(164), UINT8_C(131), UINT8_C( 35), UINT8_C(231), UINT8_C(231),
+      UINT8_C(173), UINT8_C( 22), UINT8_C(107), UINT8_C(179), UINT8_C( 69), UINT8_C(254), UINT8_C( 32), UINT8_C( 52),
+      UINT8_C(132), UINT8_C( 37), UINT8_C(150), UINT8_C(249), UINT8_C(131), UINT8_C(106), UINT8_C(162), UINT8_C(134),
+      UINT8_C(173), UINT8_C(253), UINT8_C(129), UINT8_C(  4), UINT8_C(130), UINT8_C( 85), UINT8_C(194), UINT8_C(136),
+      UINT8_C(195), UINT8_C( 88), UINT8_C( 44), UINT8_C( 70), UINT8_C(123), UINT8_C( 19), UINT8_C( 45), UINT8_C( 40),
+      UINT8_C( 41), UINT8_C(152), UINT8_C(220), UINT8_C(111), UINT8_C(150), UINT8_C(252), UINT8_C(163), UINT8_C( 26),
+      UINT8_C( 34), UINT8_C( 58), UINT8_C( 20), UINT8_C(165), UINT8_C(164), UINT8_C(182), UINT8_C( 44), UINT8_C( 81),
+      UINT8_C(179), UINT8_C(173), UINT8_C( 85), UINT8_C( 54), UINT8_C(  2), UINT8_C( 23), UINT8_C(190), UINT8_C(197),
+      UINT8_C(112), UINT8_C(234), UINT8_C( 12), UINT8_C(235), UINT8_C(253), UINT8_C( 57), UINT8_C( 20), UINT8_C( 38),
+      UINT8_C(210), UINT8_C(240), UINT8_C(149), UINT8_C(104), UINT8_C(236), UINT8_C( 57), UINT8_C(131), UINT8_C( 14),
+      UINT8_C(115), UINT8_C(151), UINT8_C(180), UINT8_C( 23), UINT8_C( 77), UINT8_C(224), UINT8_C(104), UINT8_C(  1),
+      UINT8_C(141), UINT8_C(189), UINT8_C( 55), UINT8_C(143), UINT8_C(213), UINT8_C(245), UINT8_C( 84), UINT8_C( 69),
+      UINT8_C(223), UINT8_C( 96), UINT8_C( 48), UINT8_C(220), UINT8_C(154), UINT8_C( 68), UINT8_C(  2), UINT8_C(108),
+      UINT8_C( 52), UINT8_C(152), UINT8_C(212), UINT8_C( 33), UINT8_C(209), UINT8_C( 87), UINT8_C( 47), UINT8_C( 68),
+      UINT8_C(238), UINT8_C(227), UINT8_C( 91), UINT8_C( 60), UINT8_C(195), UINT8_C(195), UINT8_C( 61), UINT8_C( 80),
+      UINT8_C(128), UINT8_C(116), UINT8_C(223), UINT8_C( 85), UINT8_C(105), UINT8_C( 52), UINT8_C(154), UINT8_C( 72),
+      UINT8_C(148), UINT8_C(203), UINT8_C( 36), UINT8_C( 46), UINT8_C( 15), UINT8_C( 38), UINT8_C(154), UINT8_C( 68),
+      UINT8_C(190), UINT8_C(111), UINT8_C(101), UINT8_C(143), UINT8_C(198), UINT8_C(148), UINT8_C(211), UINT8_C(181),
+      UINT8_C(120), UINT8_C( 46), UINT8_C(241), UINT8_C( 59), UINT8_C(241), UINT8_C( 46), UINT8_C(140), UINT8_C(114),
+      UINT8_C(162), UINT8_C(107), UINT8_C(199), UINT8_C( 11), UINT8_C(159), UINT8_C( 98), UINT8_C( 83), UINT8_C( 52),
+      UINT8_C( 45), UINT8_C(119), UINT8_C( 98), UINT8_C( 60), UINT8_C(157), UINT8_C(253), UINT8_C(128), UINT8_C( 92),
+      UINT8_C(108), UINT8_C(229), UINT8_C(235), UINT8_C( 50), UINT8_C(122), UINT8_C(191), UINT8_C(231), UINT8_C(242),
+      UINT8_C(237), UINT8_C(216), UINT8_C( 45), UINT8_C(223), UINT8_C(  6), UINT8_C(185), UINT8_C( 81), UINT8_C(168),
+      UINT8_C( 37), UINT8_C( 24), UINT8_C(179), UINT8_C(196), UINT8_C(122), UINT8_C(  6), UINT8_C(248), UINT8_C(167),
+      UINT8_C(125), UINT8_C( 91), UINT8_C(228), UINT8_C( 27), UINT8_C( 88), UINT8_C(100), UINT8_C(119), UINT8_C(196),
+      UINT8_C( 74), UINT8_C( 98), UINT8_C(246), UINT8_C(196), UINT8_C( 33), UINT8_C(222), UINT8_C(182), UINT8_C( 15),
+      UINT8_C(182), UINT8_C(227), UINT8_C(238), UINT8_C(189), UINT8_C(157), UINT8_C( 63), UINT8_C(101), UINT8_C(194),
+      UINT8_C( 87), UINT8_C( 25), UINT8_C(134), UINT8_C(210), UINT8_C( 31), UINT8_C(127), UINT8_C(121), UINT8_C(157),
+      UINT8_C(218), UINT8_C( 93), UINT8_C(184), UINT8_C( 50), UINT8_C(194), UINT8_C( 47), UINT8_C(246), UINT8_C( 12),
+      UINT8_C(145), UINT8_C(236), UINT8_C(208), UINT8_C(179), UINT8_C(202), UINT8_C(134), UINT8_C(194), UINT8_C(129),
+      UINT8_C(105), UINT8_C(176), UINT8_C( 62), UINT8_C(  6), UINT8_C(239), UINT8_C(163), UINT8_C(200), UINT8_C( 70),
+      UINT8_C(188), UINT8_C( 79), UINT8_C( 24), UINT8_C(220), UINT8_C(206), UINT8_C(146), UINT8_C(121), UINT8_C(168),
+      UINT8_C(239), UINT8_C( 49), UINT8_C(218), UINT8_C(177), UINT8_C( 96), UINT8_C(208), UINT8_C(189), UINT8_C(241),
+      UINT8_C(188), UINT8_C(141), UINT8_C(164), UINT8_C(135), UINT8_C( 19), UINT8_C(102), UINT8_C(  8), UINT8_C(125),
+      UINT8_C( 22), UINT8_C( 70), UINT8_C(131), UINT8_C(  5), UINT8_C(233), UINT8_C( 76), UINT8_C( 76), UINT8_C(166),
+      UINT8_C(155), UINT8_C(100), UINT8_C(130), UINT8_C(105) };
+  static const uint8_t e[] =
+    { UINT8_C(154), UINT8_C(  0), UINT8_C(220), UINT8_C(181), UINT8_C(  0), UINT8_C(  0), UINT8_C(162), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(116), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(151), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(191),
+      UINT8_C(  0), UINT8_C( 88), UINT8_C(  0), UINT8_C(192), UINT8_C(112), UINT8_C(206), UINT8_C(150), UINT8_C(  0),
+      UINT8_C( 48), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(217), UINT8_C(  0), UINT8_C( 93), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 27), UINT8_C(209), UINT8_C(170), UINT8_C(221), UINT8_C(184), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(121), UINT8_C(  0), UINT8_C(176), UINT8_C(168), UINT8_C(186), UINT8_C(209),
+      UINT8_C(201), UINT8_C(  0), UINT8_C( 58), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 69), UINT8_C(165),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(148), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(116), UINT8_C(  0), UINT8_C(  0), UINT8_C(189), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(117),
+      UINT8_C( 42), UINT8_C( 87), UINT8_C( 48), UINT8_C(  0), UINT8_C( 24), UINT8_C(127), UINT8_C(228), UINT8_C(  0),
+      UINT8_C(232), UINT8_C(  0), UINT8_C( 41), UINT8_C(156), UINT8_C(  0), UINT8_C(  0), UINT8_C(220), UINT8_C( 18),
+      UINT8_C(240), UINT8_C(202), UINT8_C(  0), UINT8_C(  8), UINT8_C(171), UINT8_C(  0), UINT8_C(  0), UINT8_C(207),
+      UINT8_C( 55), UINT8_C(  0), UINT8_C(224), UINT8_C( 73), UINT8_C(148), UINT8_C(128), UINT8_C(252), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(171), UINT8_C( 72), UINT8_C(118), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(248), UINT8_C(229), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(232), UINT8_C(  0), UINT8_C( 66), UINT8_C( 10), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(153), UINT8_C(224), UINT8_C( 60), UINT8_C(200), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(179), UINT8_C(  0), UINT8_C( 66), UINT8_C(191),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 76), UINT8_C( 96), UINT8_C(  0), UINT8_C( 88),
+      UINT8_C( 97), UINT8_C(172), UINT8_C(  0), UINT8_C( 72), UINT8_C( 48), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(234),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(153), UINT8_C(  0), UINT8_C(  0), UINT8_C(164), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(240), UINT8_C(104), UINT8_C(216), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 80), UINT8_C(218), UINT8_C( 50), UINT8_C( 73), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(126), UINT8_C(  0), UINT8_C(  8), UINT8_C( 19), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 24), UINT8_C(  0), UINT8_C( 68), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 82),
+      UINT8_C(204), UINT8_C(  0), UINT8_C(  7), UINT8_C(152), UINT8_C(166), UINT8_C(156), UINT8_C(  0), UINT8_C(228),
+      UINT8_C(129), UINT8_C(  0), UINT8_C(176), UINT8_C(  0), UINT8_C(136), UINT8_C(145), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 76), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(140), UINT8_C(  0), UINT8_C(238), UINT8_C( 72),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(244), UINT8_C(202), UINT8_C(129), UINT8_C(  0), UINT8_C(  0), UINT8_C( 82),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 20), UINT8_C(  0), UINT8_C(222), UINT8_C(254), UINT8_C(  0), UINT8_C( 24),
+      UINT8_C(  0), UINT8_C( 41), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C( 66), UINT8_C(212), UINT8_C(160), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(188), UINT8_C(164), UINT8_C(  0), UINT8_C(  0), UINT8_C(112), UINT8_C(158),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(253), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 56), UINT8_C(146), UINT8_C(  0), UINT8_C(235),
+      UINT8_C( 22), UINT8_C( 79), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 52), UINT8_C(158),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(145), UINT8_C(201), UINT8_C(  0), UINT8_C(  0), UINT8_C( 16), UINT8_C(128),
+      UINT8_C(134), UINT8_C( 85), UINT8_C( 10), UINT8_C(234), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 16), UINT8_C(  0), UINT8_C( 88), UINT8_C(  0), UINT8_C(226), UINT8_C(  0), UINT8_C(120), UINT8_C( 36),
+      UINT8_C( 36), UINT8_C(243), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(184), UINT8_C(  0), UINT8_C(208),
+      UINT8_C(  0), UINT8_C(240), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(232), UINT8_C( 56),
+      UINT8_C(  0), UINT8_C(104), UINT8_C(117), UINT8_C(  0), UINT8_C(  0), UINT8_C(  4), UINT8_C( 96), UINT8_C( 26),
+      UINT8_C( 78), UINT8_C(  0), UINT8_C(220), UINT8_C( 48), UINT8_C( 39), UINT8_C( 72), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 45), UINT8_C(244), UINT8_C(202), UINT8_C(225), UINT8_C(  0), UINT8_C(110), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(210), UINT8_C( 56), UINT8_C(100), UINT8_C( 13), UINT8_C(  0), UINT8_C( 32), UINT8_C( 40), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(125), UINT8_C(  0), UINT8_C(132), UINT8_C(160), UINT8_C(  0), UINT8_C(132),
+      UINT8_C( 60), UINT8_C(  0), UINT8_C(  0), UINT8_C(120), UINT8_C( 80), UINT8_C(249), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  4), UINT8_C(  0), UINT8_C(156), UINT8_C( 84), UINT8_C(210), UINT8_C(235), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(247), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128),    UINT8_MAX, UINT8_C( 92),
+      UINT8_C(134), UINT8_C(  0), UINT8_C(  0), UINT8_C( 72), UINT8_C( 29), UINT8_C(  0), UINT8_C(  0), UINT8_C( 72),
+      UINT8_C(  0), UINT8_C(163), UINT8_C(221), UINT8_C( 35), UINT8_C(104), UINT8_C(194), UINT8_C(  0), UINT8_C(128),
+      UINT8_C(  0), UINT8_C( 24), UINT8_C( 28), UINT8_C(  0), UINT8_C(  0), UINT8_C(198), UINT8_C(151), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(194), UINT8_C(192), UINT8_C(210), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 15), UINT8_C(128), UINT8_C(196), UINT8_C( 40), UINT8_C( 77), UINT8_C(  0), UINT8_C(116), UINT8_C(104),
+      UINT8_C( 75), UINT8_C(  0), UINT8_C(236), UINT8_C(  0), UINT8_C(236), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(174), UINT8_C(222), UINT8_C(  0), UINT8_C( 27), UINT8_C(221), UINT8_C(  0), UINT8_C(  0), UINT8_C(206),
+      UINT8_C(124), UINT8_C(212), UINT8_C(  0), UINT8_C( 28), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(152), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 74), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(176), UINT8_C(  0), UINT8_C( 48), UINT8_C(181), UINT8_C(  0), UINT8_C( 80), UINT8_C(  0), UINT8_C( 35),
+      UINT8_C( 26), UINT8_C(152), UINT8_C(176), UINT8_C(  0), UINT8_C(192), UINT8_C(152), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(184), UINT8_C(  6), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(160), UINT8_C(  0), UINT8_C(153), UINT8_C( 24), UINT8_C(  0), UINT8_C(233), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(119), UINT8_C(150), UINT8_C(  0), UINT8_C(246), UINT8_C( 46), UINT8_C(  0), UINT8_C( 33),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(218), UINT8_C( 44), UINT8_C(  0), UINT8_C(  0), UINT8_C(144),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 29), UINT8_C(  0), UINT8_C(  2), UINT8_C(  0), UINT8_C(208), UINT8_C(  0),
+      UINT8_C(201), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 81), UINT8_C(232), UINT8_C(163), UINT8_C( 44), UINT8_C(192), UINT8_C(  1), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(155), UINT8_C(  0), UINT8_C(186), UINT8_C(127),
+      UINT8_C(  4), UINT8_C(  6), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(153), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(249), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(129), UINT8_C(184), UINT8_C( 89), UINT8_C(162), UINT8_C(  0), UINT8_C(  0), UINT8_C(103),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 24), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(159), UINT8_C(  0), UINT8_C(  0), UINT8_C(148), UINT8_C( 58), UINT8_C(156), UINT8_C( 84), UINT8_C(113),
+      UINT8_C(  0), UINT8_C(180), UINT8_C( 36), UINT8_C(174), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(226),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(155), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(161),
+      UINT8_C(  4), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(237),
+      UINT8_C(223), UINT8_C(  0), UINT8_C(  0), UINT8_C(227), UINT8_C( 20), UINT8_C( 88), UINT8_C(  0), UINT8_C(219),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(156), UINT8_C(132),
+      UINT8_C(  0), UINT8_C(242), UINT8_C( 26), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(166), UINT8_C(139),
+      UINT8_C( 15), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(206), UINT8_C(  0),
+      UINT8_C( 26), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 41), UINT8_C(  0), UINT8_C(  0), UINT8_C( 35),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 36), UINT8_C(  0), UINT8_C(  0), UINT8_C(236), UINT8_C(  0), UINT8_C(241),
+      UINT8_C( 85), UINT8_C(  0), UINT8_C(  0), UINT8_C( 94), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(100),
+      UINT8_C(  0), UINT8_C(237), UINT8_C(124), UINT8_C(231), UINT8_C(  0), UINT8_C(136), UINT8_C(148), UINT8_C( 32),
+      UINT8_C(241), UINT8_C( 43), UINT8_C(  0), UINT8_C( 80), UINT8_C( 62), UINT8_C(  0), UINT8_C(166), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(112), UINT8_C(  4), UINT8_C(  0), UINT8_C(122), UINT8_C(237), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(178), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(104), UINT8_C(244), UINT8_C( 81), UINT8_C(188),
+      UINT8_C(  0), UINT8_C(130), UINT8_C( 56), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(112), UINT8_C(152), UINT8_C( 76), UINT8_C(  0), UINT8_C( 47), UINT8_C(  0), UINT8_C(184), UINT8_C(180),
+      UINT8_C(  0), UINT8_C(128), UINT8_C( 44), UINT8_C( 32), UINT8_C(228), UINT8_C( 56), UINT8_C(161), UINT8_C(112),
+      UINT8_C(  0), UINT8_C(215), UINT8_C(  0), UINT8_C( 17), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(103),    UINT8_MAX, UINT8_C(249), UINT8_C(  0), UINT8_C( 90), UINT8_C(  0), UINT8_C(224), UINT8_C( 52),
+      UINT8_C(156), UINT8_C(  0), UINT8_C(  0), UINT8_C( 36), UINT8_C( 64), UINT8_C(104), UINT8_C(  0), UINT8_C(160),
+      UINT8_C(168), UINT8_C(112), UINT8_C( 68), UINT8_C(  0), UINT8_C(  0), UINT8_C(200), UINT8_C(  0), UINT8_C( 60),
+      UINT8_C(  0), UINT8_C( 58), UINT8_C( 77), UINT8_C(  0), UINT8_C(  0), UINT8_C(170), UINT8_C( 26), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 44), UINT8_C(  6), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(241), UINT8_C( 20), UINT8_C(238), UINT8_C(227), UINT8_C(  0), UINT8_C(138), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(218), UINT8_C( 92), UINT8_C(218), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 35),
+      UINT8_C(  0), UINT8_C(182), UINT8_C(193), UINT8_C( 18), UINT8_C(187), UINT8_C(  0), UINT8_C(  0), UINT8_C(136),
+      UINT8_C(234), UINT8_C(  0), UINT8_C(  0), UINT8_C( 85), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(236),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(196), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 18), UINT8_C( 69), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 10),
+      UINT8_C(106), UINT8_C(168), UINT8_C( 52), UINT8_C(  0), UINT8_C(  0), UINT8_C( 59), UINT8_C(  0), UINT8_C(232),
+      UINT8_C(  0), UINT8_C(128), UINT8_C( 56), UINT8_C(  0), UINT8_C(166), UINT8_C(  0), UINT8_C(128), UINT8_C(199),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(152), UINT8_C(184), UINT8_C( 54), UINT8_C( 68),
+      UINT8_C(154), UINT8_C(  0), UINT8_C(  0), UINT8_C(216), UINT8_C(190), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 22), UINT8_C(213), UINT8_C(143), UINT8_C(  0), UINT8_C(  0), UINT8_C(122),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 60), UINT8_C(  0), UINT8_C(  0), UINT8_C(208), UINT8_C(  0),
+      UINT8_C( 44), UINT8_C(  0), UINT8_C(144), UINT8_C(  0), UINT8_C( 94), UINT8_C(  0), UINT8_C(166), UINT8_C( 32),
+      UINT8_C( 98), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(166), UINT8_C(226), UINT8_C(  0),
+      UINT8_C(225), UINT8_C( 80), UINT8_C(244), UINT8_C(248), UINT8_C(  0), UINT8_C(  0), UINT8_C( 72), UINT8_C(  0),
+      UINT8_C(184), UINT8_C(  8), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(134), UINT8_C(229), UINT8_C(  8),
+      UINT8_C(117), UINT8_C(  0), UINT8_C(130), UINT8_C( 74), UINT8_C(128), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(112), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 80), UINT8_C(  0), UINT8_C( 77), UINT8_C(  0), UINT8_C( 98), UINT8_C(  0), UINT8_C(  0), UINT8_C( 24),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_u8_z(pv, av, bv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+
+    ev = simde_svmul_u8_z(pv, av, bv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C( 48), UINT8_C(251), UINT8_C(212), UINT8_C( 23), UINT8_C( 27), UINT8_C(163), UINT8_C(223), UINT8_C(179),
+      UINT8_C(114), UINT8_C(154), UINT8_C(145), UINT8_C( 24), UINT8_C(190), UINT8_C(185), UINT8_C( 34), UINT8_C(219),
+      UINT8_C( 91), UINT8_C( 78), UINT8_C(187), UINT8_C( 80), UINT8_C( 77), UINT8_C(251), UINT8_C(202), UINT8_C(222),
+      UINT8_C(241), UINT8_C(149), UINT8_C(176), UINT8_C(150), UINT8_C(214), UINT8_C(156), UINT8_C(138), UINT8_C(  6),
+      UINT8_C(152), UINT8_C( 95), UINT8_C( 30), UINT8_C(179), UINT8_C(  2), UINT8_C(253), UINT8_C(103), UINT8_C(116),
+      UINT8_C(151), UINT8_C(248), UINT8_C(140), UINT8_C( 85), UINT8_C(177), UINT8_C(174), UINT8_C( 48), UINT8_C( 12),
+      UINT8_C(253), UINT8_C(235), UINT8_C( 93), UINT8_C( 74), UINT8_C(230), UINT8_C( 39), UINT8_C( 40), UINT8_C(215),
+      UINT8_C(188), UINT8_C(217), UINT8_C(109), UINT8_C(146), UINT8_C(117), UINT8_C(248), UINT8_C(153), UINT8_C( 13),
+      UINT8_C( 87), UINT8_C(183), UINT8_C(193), UINT8_C( 89), UINT8_C(180), UINT8_C( 40), UINT8_C(205), UINT8_C( 75),
+      UINT8_C( 32), UINT8_C( 89), UINT8_C(160), UINT8_C(209), UINT8_C(  7), UINT8_C(208), UINT8_C(222), UINT8_C(  4),
+      UINT8_C(187), UINT8_C( 59), UINT8_C( 79), UINT8_C(161), UINT8_C( 98), UINT8_C(119), UINT8_C(120), UINT8_C( 31),
+      UINT8_C( 80), UINT8_C(229), UINT8_C(177), UINT8_C(198), UINT8_C(221), UINT8_C( 74), UINT8_C(211), UINT8_C( 52),
+      UINT8_C(  1), UINT8_C(148), UINT8_C(141), UINT8_C(181), UINT8_C(188), UINT8_C( 90), UINT8_C(  0), UINT8_C(220),
+      UINT8_C(179), UINT8_C(160), UINT8_C(174), UINT8_C(187), UINT8_C(112), UINT8_C(140), UINT8_C(191), UINT8_C( 43),
+      UINT8_C(199), UINT8_C( 14), UINT8_C(204), UINT8_C( 41), UINT8_C(134), UINT8_C( 68), UINT8_C( 72), UINT8_C(214),
+      UINT8_C( 42), UINT8_C(250), UINT8_C(156), UINT8_C(  7), UINT8_C( 68), UINT8_C(112), UINT8_C( 60), UINT8_C( 70),
+      UINT8_C(  4), UINT8_C(201), UINT8_C(251), UINT8_C(193), UINT8_C( 36), UINT8_C(252), UINT8_C(157), UINT8_C(215),
+      UINT8_C(156), UINT8_C( 75), UINT8_C(146), UINT8_C( 13), UINT8_C(215), UINT8_C( 82), UINT8_C( 56), UINT8_C(158),
+      UINT8_C( 96), UINT8_C(  5), UINT8_C(200), UINT8_C(230), UINT8_C( 73), UINT8_C( 16), UINT8_C(189), UINT8_C(115),
+      UINT8_C( 10), UINT8_C( 89), UINT8_C(123), UINT8_C( 79), UINT8_C(201), UINT8_C(183), UINT8_C(149), UINT8_C(206),
+      UINT8_C(128), UINT8_C(144), UINT8_C(143), UINT8_C(164), UINT8_C(140), UINT8_C( 44), UINT8_C(124), UINT8_C( 41),
+      UINT8_C(120), UINT8_C( 14), UINT8_C( 54), UINT8_C( 79), UINT8_C( 96), UINT8_C(110), UINT8_C(238), UINT8_C(193),
+      UINT8_C(115), UINT8_C(182), UINT8_C(167), UINT8_C(189), UINT8_C(198), UINT8_C(100), UINT8_C( 48), UINT8_C(209),
+      UINT8_C(190), UINT8_C(171), UINT8_C( 32), UINT8_C(135), UINT8_C( 98), UINT8_C(181), UINT8_C( 85), UINT8_C(227),
+      UINT8_C( 69), UINT8_C(228), UINT8_C(135), UINT8_C(210), UINT8_C( 17), UINT8_C(  3), UINT8_C(251), UINT8_C(137),
+      UINT8_C( 18), UINT8_C( 49), UINT8_C(216), UINT8_C(114), UINT8_C(159), UINT8_C(198), UINT8_C( 51), UINT8_C( 19),
+      UINT8_C(124), UINT8_C(219), UINT8_C(208), UINT8_C( 67), UINT8_C( 63), UINT8_C(  0), UINT8_C( 20), UINT8_C(253),
+      UINT8_C(172), UINT8_C( 52), UINT8_C(133), UINT8_C( 14), UINT8_C(233), UINT8_C(218), UINT8_C(241), UINT8_C( 46),
+      UINT8_C(191), UINT8_C(121), UINT8_C(  0), UINT8_C(208), UINT8_C(124), UINT8_C(251), UINT8_C( 89), UINT8_C(142),
+      UINT8_C( 44), UINT8_C( 49), UINT8_C(  1), UINT8_C(204), UINT8_C(248), UINT8_C( 52), UINT8_C(223), UINT8_C(116),
+      UINT8_C( 15), UINT8_C(175), UINT8_C(183), UINT8_C( 79), UINT8_C(175), UINT8_C(203), UINT8_C( 76), UINT8_C( 91),
+         UINT8_MAX, UINT8_C(209), UINT8_C(106), UINT8_C(232), UINT8_C(172), UINT8_C( 91), UINT8_C( 23), UINT8_C(107),
+      UINT8_C(212), UINT8_C( 23), UINT8_C( 59), UINT8_C( 81), UINT8_C( 19), UINT8_C(148), UINT8_C(223), UINT8_C( 63),
+      UINT8_C(197), UINT8_C(224), UINT8_C( 11), UINT8_C(189), UINT8_C( 21), UINT8_C(234), UINT8_C( 50), UINT8_C( 36),
+      UINT8_C(153), UINT8_C(233), UINT8_C(115), UINT8_C( 73), UINT8_C(181), UINT8_C(192), UINT8_C(164), UINT8_C(180),
+      UINT8_C(145), UINT8_C( 14), UINT8_C(157), UINT8_C( 61), UINT8_C(106), UINT8_C(180), UINT8_C(168), UINT8_C( 62),
+      UINT8_C(203), UINT8_C(227), UINT8_C(143), UINT8_C(222), UINT8_C(119), UINT8_C(111), UINT8_C( 30), UINT8_C( 61),
+      UINT8_C( 79), UINT8_C( 41), UINT8_C(250), UINT8_C(100), UINT8_C( 20), UINT8_C( 44), UINT8_C(137), UINT8_C(173),
+      UINT8_C( 22), UINT8_C(252), UINT8_C(246), UINT8_C(203), UINT8_C(188), UINT8_C(155), UINT8_C(127), UINT8_C( 78),
+      UINT8_C(169), UINT8_C( 28), UINT8_C(139), UINT8_C( 19), UINT8_C(208), UINT8_C( 52), UINT8_C( 82), UINT8_C(156),
+      UINT8_C( 23), UINT8_C(225), UINT8_C(122), UINT8_C(143), UINT8_C( 80), UINT8_C(152), UINT8_C(204), UINT8_C(160),
+      UINT8_C(194), UINT8_C(198), UINT8_C(  4), UINT8_C(214), UINT8_C(243), UINT8_C(141), UINT8_C(131), UINT8_C(  9),
+      UINT8_C(138), UINT8_C(122), UINT8_C(212), UINT8_C( 70), UINT8_C( 21), UINT8_C( 83), UINT8_C(148), UINT8_C(190),
+      UINT8_C(112), UINT8_C( 32), UINT8_C(210), UINT8_C( 64), UINT8_C( 84), UINT8_C( 36), UINT8_C(220), UINT8_C(107),
+      UINT8_C(  5), UINT8_C( 87), UINT8_C(250), UINT8_C( 86), UINT8_C(239), UINT8_C(198), UINT8_C(246), UINT8_C(177),
+      UINT8_C(141), UINT8_C(250), UINT8_C(135), UINT8_C(128), UINT8_C(136), UINT8_C( 11), UINT8_C(137), UINT8_C( 18),
+      UINT8_C(133), UINT8_C( 93), UINT8_C( 88), UINT8_C(154), UINT8_C(176), UINT8_C(237), UINT8_C( 88), UINT8_C( 32),
+      UINT8_C( 13), UINT8_C( 42), UINT8_C( 97), UINT8_C( 97), UINT8_C( 78), UINT8_C( 61), UINT8_C(204), UINT8_C( 84),
+      UINT8_C(148), UINT8_C(199), UINT8_C(170), UINT8_C(132), UINT8_C(141), UINT8_C(160), UINT8_C( 53), UINT8_C( 26),
+      UINT8_C(154), UINT8_C(189), UINT8_C(154), UINT8_C( 34), UINT8_C(200), UINT8_C( 35), UINT8_C( 52), UINT8_C( 77),
+      UINT8_C(128), UINT8_C(141), UINT8_C(231), UINT8_C( 49), UINT8_C(122), UINT8_C( 63), UINT8_C( 81), UINT8_C(135),
+      UINT8_C(106), UINT8_C(178), UINT8_C(232), UINT8_C(184), UINT8_C(240), UINT8_C(180), UINT8_C( 12), UINT8_C(132),
+      UINT8_C(123), UINT8_C(182), UINT8_C(  8), UINT8_C(  9), UINT8_C( 86), UINT8_C( 62), UINT8_C( 35), UINT8_C(241),
+      UINT8_C(251), UINT8_C(190), UINT8_C( 19), UINT8_C(195), UINT8_C(225), UINT8_C( 72), UINT8_C( 16), UINT8_C( 98),
+      UINT8_C(213), UINT8_C(247), UINT8_C(147), UINT8_C( 79), UINT8_C( 54), UINT8_C(228), UINT8_C(214), UINT8_C(160),
+      UINT8_C(151), UINT8_C(190), UINT8_C( 89), UINT8_C(135), UINT8_C(114), UINT8_C(101), UINT8_C( 11), UINT8_C(238),
+      UINT8_C( 28), UINT8_C( 20), UINT8_C(247), UINT8_C(114), UINT8_C( 82), UINT8_C( 26), UINT8_C( 99), UINT8_C( 77),
+      UINT8_C(216), UINT8_C(119), UINT8_C( 16), UINT8_C(186), UINT8_C(191), UINT8_C( 32), UINT8_C( 28), UINT8_C(148),
+      UINT8_C( 23), UINT8_C(175), UINT8_C(227), UINT8_C( 77), UINT8_C(147), UINT8_C(185), UINT8_C(238), UINT8_C( 42),
+      UINT8_C(119), UINT8_C( 71), UINT8_C(177), UINT8_C(233), UINT8_C(172), UINT8_C(189), UINT8_C(215), UINT8_C(200),
+      UINT8_C(209), UINT8_C(206), UINT8_C( 59), UINT8_C( 35), UINT8_C(233), UINT8_C(158), UINT8_C(112), UINT8_C(193),
+      UINT8_C( 21), UINT8_C(128), UINT8_C(123), UINT8_C(212), UINT8_C(160), UINT8_C(151), UINT8_C(104), UINT8_C(183),
+      UINT8_C( 70), UINT8_C( 75), UINT8_C(  4), UINT8_C(218), UINT8_C(  4), UINT8_C(242), UINT8_C(  4), UINT8_C(123),
+      UINT8_C( 57), UINT8_C(182), UINT8_C(101), UINT8_C(230), UINT8_C(115), UINT8_C( 60), UINT8_C(174), UINT8_C( 68),
+      UINT8_C( 11), UINT8_C(233), UINT8_C(103), UINT8_C(244), UINT8_C(136), UINT8_C(215), UINT8_C(181), UINT8_C(157),
+      UINT8_C( 87), UINT8_C( 49), UINT8_C(114), UINT8_C(247), UINT8_C(200), UINT8_C(218), UINT8_C(174), UINT8_C( 15),
+      UINT8_C( 38), UINT8_C(178), UINT8_C(233), UINT8_C( 42), UINT8_C(165), UINT8_C(237), UINT8_C(166), UINT8_C(222),
+      UINT8_C(163), UINT8_C( 11), UINT8_C(196), UINT8_C( 22), UINT8_C( 71), UINT8_C(115), UINT8_C( 90), UINT8_C( 82),
+      UINT8_C( 92), UINT8_C(193), UINT8_C( 70), UINT8_C(228), UINT8_C(152), UINT8_C(252), UINT8_C(130), UINT8_C(239),
+      UINT8_C( 45), UINT8_C(244), UINT8_C(230), UINT8_C(245), UINT8_C(206), UINT8_C(148), UINT8_C(  4), UINT8_C(244),
+      UINT8_C( 71), UINT8_C(237), UINT8_C( 31), UINT8_C(236), UINT8_C(219), UINT8_C(197) };
+  static const uint8_t b[] =
+    { UINT8_C(177), UINT8_C( 41), UINT8_C(216), UINT8_C(205), UINT8_C(112), UINT8_C(117), UINT8_C(174), UINT8_C(147),
+      UINT8_C( 47), UINT8_C(254), UINT8_C(128), UINT8_C( 54), UINT8_C( 11), UINT8_C( 65), UINT8_C(203), UINT8_C( 74),
+      UINT8_C(169), UINT8_C(148), UINT8_C(209), UINT8_C( 46), UINT8_C(  5), UINT8_C( 39), UINT8_C(247), UINT8_C( 86),
+      UINT8_C( 95), UINT8_C(223), UINT8_C(247), UINT8_C(235), UINT8_C(233), UINT8_C( 21), UINT8_C(237), UINT8_C(154),
+      UINT8_C( 62), UINT8_C(197), UINT8_C(103), UINT8_C(175), UINT8_C( 58), UINT8_C( 21), UINT8_C( 66), UINT8_C(106),
+      UINT8_C( 19), UINT8_C(194), UINT8_C(160), UINT8_C( 30), UINT8_C(  4), UINT8_C(107), UINT8_C(105), UINT8_C(173),
+         UINT8_MAX, UINT8_C( 58), UINT8_C(219), UINT8_C(  4), UINT8_C( 98), UINT8_C(211), UINT8_C( 91), UINT8_C(193),
+      UINT8_C(178), UINT8_C( 82), UINT8_C(172), UINT8_C(155), UINT8_C(104), UINT8_C(153), UINT8_C( 54), UINT8_C(166),
+      UINT8_C( 94), UINT8_C(157), UINT8_C( 85), UINT8_C(153), UINT8_C(179), UINT8_C(152), UINT8_C(  3), UINT8_C(198),
+      UINT8_C( 90), UINT8_C(163), UINT8_C(229), UINT8_C( 94), UINT8_C( 14), UINT8_C( 78), UINT8_C( 12), UINT8_C( 13),
+      UINT8_C(136), UINT8_C(231), UINT8_C( 18), UINT8_C(234), UINT8_C(186), UINT8_C(109), UINT8_C(171), UINT8_C(109),
+      UINT8_C(191), UINT8_C( 87), UINT8_C(  8), UINT8_C( 39), UINT8_C(240), UINT8_C( 62), UINT8_C(206), UINT8_C( 79),
+      UINT8_C(220), UINT8_C( 35), UINT8_C(232), UINT8_C(143), UINT8_C(187), UINT8_C(235), UINT8_C( 85), UINT8_C( 22),
+      UINT8_C(142), UINT8_C( 58), UINT8_C(116), UINT8_C(156), UINT8_C(136), UINT8_C(128), UINT8_C(169), UINT8_C( 17),
+      UINT8_C(104), UINT8_C(187), UINT8_C(251), UINT8_C( 34), UINT8_C( 40), UINT8_C(167), UINT8_C(143), UINT8_C(232),
+      UINT8_C(254), UINT8_C(152), UINT8_C( 15), UINT8_C(239), UINT8_C(214), UINT8_C(221), UINT8_C( 62), UINT8_C(178),
+      UINT8_C(  1), UINT8_C( 38), UINT8_C( 65), UINT8_C(188), UINT8_C( 17), UINT8_C(151), UINT8_C(210), UINT8_C(159),
+      UINT8_C(209), UINT8_C( 71), UINT8_C( 59), UINT8_C( 90), UINT8_C(199), UINT8_C(228), UINT8_C(107), UINT8_C( 47),
+      UINT8_C(160), UINT8_C(102), UINT8_C( 82), UINT8_C(200), UINT8_C( 13), UINT8_C(225), UINT8_C(176), UINT8_C( 12),
+      UINT8_C(121), UINT8_C(192), UINT8_C(251), UINT8_C( 80), UINT8_C(157), UINT8_C( 57), UINT8_C(  2), UINT8_C(158),
+      UINT8_C( 95), UINT8_C( 68), UINT8_C( 91), UINT8_C(112), UINT8_C(219), UINT8_C( 45), UINT8_C( 15), UINT8_C(172),
+      UINT8_C(116), UINT8_C( 74), UINT8_C(  6), UINT8_C( 60), UINT8_C( 46), UINT8_C(113), UINT8_C(107), UINT8_C(206),
+      UINT8_C(216), UINT8_C(189), UINT8_C(151), UINT8_C(229), UINT8_C(159), UINT8_C( 71), UINT8_C(241), UINT8_C( 24),
+      UINT8_C(  7), UINT8_C(236), UINT8_C(104), UINT8_C(165), UINT8_C( 37), UINT8_C(107), UINT8_C( 67), UINT8_C(132),
+      UINT8_C(175), UINT8_C(158), UINT8_C(244), UINT8_C(138), UINT8_C(204), UINT8_C(  3), UINT8_C( 54), UINT8_C( 64),
+      UINT8_C( 77), UINT8_C( 61), UINT8_C(124), UINT8_C(124), UINT8_C(174), UINT8_C(232), UINT8_C( 74), UINT8_C(134),
+      UINT8_C(165), UINT8_C(225), UINT8_C(108), UINT8_C( 68), UINT8_C( 41), UINT8_C( 93), UINT8_C( 93), UINT8_C( 48),
+      UINT8_C( 74), UINT8_C(197), UINT8_C(213), UINT8_C(111), UINT8_C( 48), UINT8_C( 25), UINT8_C(244), UINT8_C(223),
+      UINT8_C(183), UINT8_C(232), UINT8_C(105), UINT8_C(131), UINT8_C(236), UINT8_C(160), UINT8_C(196), UINT8_C( 57),
+      UINT8_C(221), UINT8_C( 64), UINT8_C(181), UINT8_C(139), UINT8_C( 40), UINT8_C(  0), UINT8_C( 18), UINT8_C(206),
+      UINT8_C(225), UINT8_C(126), UINT8_C( 18), UINT8_C( 10), UINT8_C(219), UINT8_C(111), UINT8_C( 59), UINT8_C( 37),
+      UINT8_C( 53), UINT8_C( 16), UINT8_C(149), UINT8_C(101), UINT8_C( 41), UINT8_C(137), UINT8_C( 69), UINT8_C(225),
+      UINT8_C(113), UINT8_C(174), UINT8_C(100), UINT8_C( 93), UINT8_C( 78), UINT8_C( 40), UINT8_C(151), UINT8_C( 43),
+      UINT8_C(105), UINT8_C( 76), UINT8_C(183), UINT8_C(145), UINT8_C( 76), UINT8_C(201), UINT8_C( 95), UINT8_C( 46),
+      UINT8_C( 71), UINT8_C(114), UINT8_C( 56), UINT8_C( 34), UINT8_C(225), UINT8_C(115), UINT8_C( 72), UINT8_C( 22),
+      UINT8_C(132), UINT8_C(221), UINT8_C(124), UINT8_C(173), UINT8_C(102), UINT8_C(193), UINT8_C(142), UINT8_C(215),
+      UINT8_C(111), UINT8_C(243), UINT8_C( 53), UINT8_C(190), UINT8_C( 27), UINT8_C(204), UINT8_C(233), UINT8_C(132),
+      UINT8_C( 24), UINT8_C(160), UINT8_C( 22), UINT8_C(101), UINT8_C(105), UINT8_C(117), UINT8_C(147), UINT8_C(176),
+      UINT8_C(231), UINT8_C(203), UINT8_C(211), UINT8_C(201), UINT8_C( 63), UINT8_C( 27), UINT8_C(223), UINT8_C(195),
+      UINT8_C(248), UINT8_C( 91), UINT8_C(112), UINT8_C( 94), UINT8_C( 28),    UINT8_MAX, UINT8_C( 53), UINT8_C(140),
+      UINT8_C(242), UINT8_C(106), UINT8_C( 74), UINT8_C( 13), UINT8_C( 54), UINT8_C( 51), UINT8_C(146), UINT8_C( 79),
+      UINT8_C(212), UINT8_C(168), UINT8_C(180), UINT8_C( 61), UINT8_C( 29), UINT8_C( 71), UINT8_C(238), UINT8_C(  5),
+      UINT8_C( 18), UINT8_C(193), UINT8_C(206), UINT8_C( 81), UINT8_C(220), UINT8_C(173), UINT8_C( 20), UINT8_C(212),
+      UINT8_C(  9), UINT8_C(133), UINT8_C( 50), UINT8_C( 37), UINT8_C(132), UINT8_C(103), UINT8_C(177), UINT8_C(118),
+      UINT8_C(210), UINT8_C(251), UINT8_C(131), UINT8_C(  8), UINT8_C( 47), UINT8_C( 21), UINT8_C( 87), UINT8_C(  3),
+      UINT8_C(189), UINT8_C( 11), UINT8_C( 64), UINT8_C(219), UINT8_C( 82), UINT8_C( 46), UINT8_C(224), UINT8_C(101),
+      UINT8_C(239), UINT8_C(174), UINT8_C(182), UINT8_C(203), UINT8_C( 91), UINT8_C(203), UINT8_C(159), UINT8_C(100),
+      UINT8_C( 80), UINT8_C(209), UINT8_C(138), UINT8_C(212), UINT8_C( 57), UINT8_C( 59), UINT8_C( 74), UINT8_C( 11),
+      UINT8_C( 55), UINT8_C(205), UINT8_C( 19), UINT8_C(102), UINT8_C(227), UINT8_C(107), UINT8_C(105), UINT8_C(160),
+      UINT8_C(118), UINT8_C(169), UINT8_C(123), UINT8_C(201), UINT8_C(216), UINT8_C( 91), UINT8_C( 46), UINT8_C(199),
+      UINT8_C(  9), UINT8_C(228), UINT8_C(147), UINT8_C(101), UINT8_C(175), UINT8_C( 50), UINT8_C(201),    UINT8_MAX,
+      UINT8_C(  4), UINT8_C( 83), UINT8_C(211), UINT8_C( 61), UINT8_C(143), UINT8_C( 29), UINT8_C( 72), UINT8_C(198),
+      UINT8_C(235), UINT8_C( 91), UINT8_C( 44), UINT8_C(206), UINT8_C(198), UINT8_C(149), UINT8_C(110), UINT8_C( 61),
+      UINT8_C( 62), UINT8_C(234), UINT8_C(  6), UINT8_C( 22), UINT8_C( 69), UINT8_C( 52), UINT8_C(222), UINT8_C( 79),
+      UINT8_C( 24), UINT8_C(113), UINT8_C(180), UINT8_C(200), UINT8_C(163), UINT8_C(125), UINT8_C(199), UINT8_C(167),
+      UINT8_C(209), UINT8_C(155), UINT8_C(228), UINT8_C( 96), UINT8_C(184), UINT8_C( 44), UINT8_C( 38), UINT8_C(163),
+      UINT8_C(136), UINT8_C( 82), UINT8_C(113), UINT8_C( 78), UINT8_C(231), UINT8_C(224), UINT8_C(139), UINT8_C( 37),
+      UINT8_C(202), UINT8_C(145), UINT8_C( 60), UINT8_C( 15), UINT8_C(197), UINT8_C( 26), UINT8_C( 94), UINT8_C(222),
+      UINT8_C(139), UINT8_C( 18), UINT8_C(166), UINT8_C( 46), UINT8_C(144), UINT8_C(109), UINT8_C(214), UINT8_C( 97),
+      UINT8_C(  8), UINT8_C(186), UINT8_C(193), UINT8_C(193), UINT8_C(231), UINT8_C(231), UINT8_C(100), UINT8_C(111),
+      UINT8_C( 57), UINT8_C(214), UINT8_C(189), UINT8_C( 32), UINT8_C(182), UINT8_C( 73), UINT8_C( 69), UINT8_C(128),
+      UINT8_C(218), UINT8_C(129), UINT8_C(143), UINT8_C(160), UINT8_C(155), UINT8_C(238), UINT8_C(126), UINT8_C( 38),
+      UINT8_C(  0), UINT8_C( 36), UINT8_C( 85), UINT8_C(144), UINT8_C(145), UINT8_C( 43), UINT8_C(241), UINT8_C(154),
+      UINT8_C(229), UINT8_C(178), UINT8_C( 91), UINT8_C(204), UINT8_C(153), UINT8_C(191), UINT8_C( 59), UINT8_C(210),
+      UINT8_C(149), UINT8_C(249), UINT8_C(242), UINT8_C( 75), UINT8_C( 66), UINT8_C( 56), UINT8_C(203), UINT8_C( 28),
+      UINT8_C(185), UINT8_C( 91), UINT8_C(188), UINT8_C( 85), UINT8_C( 73), UINT8_C( 58), UINT8_C(123), UINT8_C( 73),
+      UINT8_C( 94), UINT8_C(208), UINT8_C(218), UINT8_C(240), UINT8_C(251), UINT8_C(203), UINT8_C(138), UINT8_C(225),
+      UINT8_C(126), UINT8_C(229), UINT8_C(173), UINT8_C( 23), UINT8_C(164), UINT8_C(233), UINT8_C(234), UINT8_C( 58),
+      UINT8_C(226), UINT8_C(220), UINT8_C(133), UINT8_C( 36), UINT8_C( 20), UINT8_C( 81), UINT8_C( 64), UINT8_C(206),
+      UINT8_C(172), UINT8_C(253), UINT8_C( 35), UINT8_C(245), UINT8_C( 55), UINT8_C(158), UINT8_C( 62), UINT8_C(150),
+      UINT8_C(111), UINT8_C( 24), UINT8_C(134), UINT8_C(106), UINT8_C(228), UINT8_C( 16) };
+  static const uint8_t e[] =
+    { UINT8_C( 48), UINT8_C(251), UINT8_C(212), UINT8_C( 23), UINT8_C( 27), UINT8_C(163), UINT8_C(223), UINT8_C(179),
+      UINT8_C(238), UINT8_C(204), UINT8_C(145), UINT8_C( 24), UINT8_C(190), UINT8_C(185), UINT8_C(246), UINT8_C( 78),
+      UINT8_C( 19), UINT8_C( 78), UINT8_C(171), UINT8_C( 96), UINT8_C(129), UINT8_C( 61), UINT8_C(230), UINT8_C(222),
+      UINT8_C(241), UINT8_C(149), UINT8_C(176), UINT8_C(178), UINT8_C(198), UINT8_C(156), UINT8_C(138), UINT8_C(156),
+      UINT8_C(152), UINT8_C( 95), UINT8_C( 30), UINT8_C(179), UINT8_C(  2), UINT8_C(193), UINT8_C(142), UINT8_C(116),
+      UINT8_C(151), UINT8_C(240), UINT8_C(140), UINT8_C(246), UINT8_C(196), UINT8_C(174), UINT8_C(176), UINT8_C( 12),
+      UINT8_C(  3), UINT8_C(235), UINT8_C( 93), UINT8_C( 74), UINT8_C( 12), UINT8_C( 37), UINT8_C( 56), UINT8_C( 23),
+      UINT8_C(184), UINT8_C(130), UINT8_C(109), UINT8_C(102), UINT8_C(117), UINT8_C( 56), UINT8_C( 70), UINT8_C(110),
+      UINT8_C(242), UINT8_C( 59), UINT8_C(193), UINT8_C( 89), UINT8_C(220), UINT8_C(192), UINT8_C(205), UINT8_C( 75),
+      UINT8_C( 32), UINT8_C(171), UINT8_C( 32), UINT8_C(209), UINT8_C( 98), UINT8_C(208), UINT8_C(104), UINT8_C(  4),
+      UINT8_C(187), UINT8_C( 61), UINT8_C(142), UINT8_C( 42), UINT8_C( 52), UINT8_C(171), UINT8_C( 40), UINT8_C( 51),
+      UINT8_C(176), UINT8_C(229), UINT8_C(177), UINT8_C( 42), UINT8_C(221), UINT8_C(236), UINT8_C(211), UINT8_C( 12),
+      UINT8_C(220), UINT8_C(148), UINT8_C(141), UINT8_C(181), UINT8_C(188), UINT8_C( 90), UINT8_C(  0), UINT8_C(220),
+      UINT8_C(179), UINT8_C(160), UINT8_C(216), UINT8_C(244), UINT8_C(128), UINT8_C(140), UINT8_C(191), UINT8_C( 43),
+      UINT8_C(199), UINT8_C( 58), UINT8_C(204), UINT8_C( 41), UINT8_C(240), UINT8_C( 68), UINT8_C( 56), UINT8_C(214),
+      UINT8_C( 42), UINT8_C(250), UINT8_C( 36), UINT8_C(137), UINT8_C( 68), UINT8_C(112), UINT8_C( 60), UINT8_C( 70),
+      UINT8_C(  4), UINT8_C(201), UINT8_C(251), UINT8_C(188), UINT8_C(100), UINT8_C(252), UINT8_C(157), UINT8_C(137),
+      UINT8_C(156), UINT8_C(205), UINT8_C(166), UINT8_C( 13), UINT8_C(215), UINT8_C(  8), UINT8_C( 56), UINT8_C(  2),
+      UINT8_C(  0), UINT8_C(  5), UINT8_C( 16), UINT8_C(230), UINT8_C(181), UINT8_C( 16), UINT8_C(240), UINT8_C(115),
+      UINT8_C( 10), UINT8_C(192), UINT8_C(153), UINT8_C( 79), UINT8_C(201), UINT8_C(191), UINT8_C(149), UINT8_C( 36),
+      UINT8_C(128), UINT8_C( 64), UINT8_C(213), UINT8_C(164), UINT8_C(196), UINT8_C(188), UINT8_C(124), UINT8_C( 41),
+      UINT8_C( 96), UINT8_C( 12), UINT8_C( 54), UINT8_C( 79), UINT8_C( 64), UINT8_C(110), UINT8_C(122), UINT8_C( 78),
+      UINT8_C(  8), UINT8_C( 94), UINT8_C(167), UINT8_C(189), UINT8_C(250), UINT8_C(188), UINT8_C( 48), UINT8_C(152),
+      UINT8_C(190), UINT8_C(171), UINT8_C(  0), UINT8_C(135), UINT8_C( 42), UINT8_C(181), UINT8_C( 85), UINT8_C(227),
+      UINT8_C( 43), UINT8_C(184), UINT8_C(172), UINT8_C(210), UINT8_C( 17), UINT8_C(  9), UINT8_C(242), UINT8_C(137),
+      UINT8_C(106), UINT8_C(173), UINT8_C(216), UINT8_C(114), UINT8_C(159), UINT8_C(198), UINT8_C(190), UINT8_C( 19),
+      UINT8_C(236), UINT8_C(123), UINT8_C(192), UINT8_C(204), UINT8_C( 23), UINT8_C(  0), UINT8_C( 20), UINT8_C(253),
+      UINT8_C(172), UINT8_C( 52), UINT8_C(169), UINT8_C( 14), UINT8_C(233), UINT8_C( 74), UINT8_C(241), UINT8_C( 18),
+      UINT8_C(191), UINT8_C(168), UINT8_C(  0), UINT8_C(112), UINT8_C( 80), UINT8_C(224), UINT8_C( 89), UINT8_C(142),
+      UINT8_C(252), UINT8_C( 49), UINT8_C(  1), UINT8_C(196), UINT8_C(192), UINT8_C( 52), UINT8_C(174), UINT8_C( 88),
+      UINT8_C( 15), UINT8_C(175), UINT8_C(183), UINT8_C( 22), UINT8_C(181), UINT8_C(203), UINT8_C(132), UINT8_C( 39),
+      UINT8_C(203), UINT8_C(209), UINT8_C(178), UINT8_C(136), UINT8_C(172), UINT8_C( 91), UINT8_C( 51), UINT8_C( 11),
+      UINT8_C(212), UINT8_C(162), UINT8_C( 12), UINT8_C(109), UINT8_C(202), UINT8_C( 32), UINT8_C(137), UINT8_C( 63),
+      UINT8_C(205), UINT8_C(224), UINT8_C( 11), UINT8_C( 13), UINT8_C( 21), UINT8_C(186), UINT8_C( 50), UINT8_C( 36),
+      UINT8_C(153), UINT8_C(233), UINT8_C(115), UINT8_C(178), UINT8_C( 21), UINT8_C(192), UINT8_C( 32), UINT8_C(180),
+      UINT8_C(196), UINT8_C( 14), UINT8_C( 12), UINT8_C( 57), UINT8_C(106), UINT8_C(180), UINT8_C( 48), UINT8_C( 62),
+      UINT8_C(203), UINT8_C(227), UINT8_C(155), UINT8_C(222), UINT8_C(141), UINT8_C(116), UINT8_C( 78), UINT8_C(116),
+      UINT8_C(104), UINT8_C(160), UINT8_C(250), UINT8_C(100), UINT8_C( 20), UINT8_C( 44), UINT8_C(137), UINT8_C(240),
+      UINT8_C( 22), UINT8_C(212), UINT8_C(194), UINT8_C( 99), UINT8_C( 68), UINT8_C(155), UINT8_C(127), UINT8_C(106),
+      UINT8_C(184), UINT8_C(244), UINT8_C(139), UINT8_C(250), UINT8_C(208), UINT8_C(204), UINT8_C( 82), UINT8_C( 80),
+      UINT8_C( 23), UINT8_C(225), UINT8_C( 68), UINT8_C( 67), UINT8_C(224), UINT8_C(152), UINT8_C(204), UINT8_C( 96),
+      UINT8_C(194), UINT8_C(240), UINT8_C(208), UINT8_C(214), UINT8_C(135), UINT8_C(141), UINT8_C(131), UINT8_C(  9),
+      UINT8_C(180), UINT8_C(250), UINT8_C(212), UINT8_C( 38), UINT8_C( 21), UINT8_C( 83), UINT8_C(148), UINT8_C( 88),
+      UINT8_C(240), UINT8_C(160), UINT8_C(  4), UINT8_C( 64), UINT8_C( 80), UINT8_C(124), UINT8_C(220), UINT8_C( 82),
+      UINT8_C( 26), UINT8_C( 77), UINT8_C(250), UINT8_C(176), UINT8_C(239), UINT8_C( 62), UINT8_C(154), UINT8_C(177),
+      UINT8_C(141), UINT8_C(250), UINT8_C(192), UINT8_C(128), UINT8_C(144), UINT8_C( 11), UINT8_C(137), UINT8_C( 26),
+      UINT8_C(133), UINT8_C( 93), UINT8_C(144), UINT8_C(154), UINT8_C(176), UINT8_C(239), UINT8_C( 88), UINT8_C( 32),
+      UINT8_C( 16), UINT8_C( 74), UINT8_C( 74), UINT8_C( 97), UINT8_C( 78), UINT8_C( 15), UINT8_C(204), UINT8_C( 84),
+      UINT8_C(204), UINT8_C( 91), UINT8_C(170), UINT8_C(152), UINT8_C(  7), UINT8_C(224), UINT8_C( 53), UINT8_C( 64),
+      UINT8_C(154), UINT8_C(189), UINT8_C(154), UINT8_C( 34), UINT8_C(200), UINT8_C( 35), UINT8_C( 88), UINT8_C( 77),
+      UINT8_C(128), UINT8_C(148), UINT8_C(165), UINT8_C( 49), UINT8_C(102), UINT8_C( 78), UINT8_C(153), UINT8_C(135),
+      UINT8_C(106), UINT8_C(178), UINT8_C( 56), UINT8_C(216), UINT8_C( 16), UINT8_C(100), UINT8_C( 96), UINT8_C( 24),
+      UINT8_C(233), UINT8_C(182), UINT8_C( 96), UINT8_C(  9), UINT8_C( 86), UINT8_C( 22), UINT8_C( 35), UINT8_C(109),
+      UINT8_C(202), UINT8_C(190), UINT8_C(114), UINT8_C(195), UINT8_C(165), UINT8_C(160), UINT8_C( 16), UINT8_C( 62),
+      UINT8_C(213), UINT8_C(  7), UINT8_C( 92), UINT8_C(184), UINT8_C( 98), UINT8_C( 84), UINT8_C(214), UINT8_C( 96),
+      UINT8_C( 71), UINT8_C( 10), UINT8_C( 89), UINT8_C(160), UINT8_C(240), UINT8_C(101), UINT8_C( 11), UINT8_C(238),
+      UINT8_C(224), UINT8_C(104), UINT8_C(247), UINT8_C(188), UINT8_C(254), UINT8_C(192), UINT8_C(193), UINT8_C( 33),
+      UINT8_C(112), UINT8_C(119), UINT8_C(192), UINT8_C(230), UINT8_C(191), UINT8_C( 32), UINT8_C( 28), UINT8_C( 88),
+      UINT8_C( 23), UINT8_C(175), UINT8_C( 50), UINT8_C(214), UINT8_C(176), UINT8_C(197), UINT8_C(244), UINT8_C(234),
+      UINT8_C(184), UINT8_C(150), UINT8_C(177), UINT8_C(233), UINT8_C(172), UINT8_C(139), UINT8_C(252), UINT8_C(184),
+      UINT8_C(137), UINT8_C( 52), UINT8_C(143), UINT8_C( 35), UINT8_C(233), UINT8_C(158), UINT8_C(112), UINT8_C(193),
+      UINT8_C( 21), UINT8_C(128), UINT8_C(181), UINT8_C(128), UINT8_C(160), UINT8_C(151), UINT8_C(104), UINT8_C( 42),
+      UINT8_C( 70), UINT8_C( 75), UINT8_C(  4), UINT8_C(218), UINT8_C( 68), UINT8_C(166), UINT8_C(196), UINT8_C(123),
+      UINT8_C(253), UINT8_C(182), UINT8_C(231), UINT8_C( 72), UINT8_C(187), UINT8_C( 60), UINT8_C( 26), UINT8_C(200),
+      UINT8_C( 11), UINT8_C(233), UINT8_C(103), UINT8_C(244), UINT8_C(136), UINT8_C(215), UINT8_C(135), UINT8_C( 44),
+      UINT8_C( 87), UINT8_C(107), UINT8_C(114), UINT8_C(  3), UINT8_C(  8), UINT8_C(100), UINT8_C(174), UINT8_C( 15),
+      UINT8_C( 38), UINT8_C(160), UINT8_C(106), UINT8_C( 96), UINT8_C(165), UINT8_C(237), UINT8_C(166), UINT8_C(222),
+      UINT8_C( 58), UINT8_C(215), UINT8_C(196), UINT8_C( 22), UINT8_C(124), UINT8_C(171), UINT8_C( 90), UINT8_C(148),
+      UINT8_C( 56), UINT8_C(193), UINT8_C( 70), UINT8_C(228), UINT8_C(224), UINT8_C(252), UINT8_C(128), UINT8_C( 82),
+      UINT8_C( 60), UINT8_C(244), UINT8_C(230), UINT8_C(121), UINT8_C(206), UINT8_C(148), UINT8_C(  4), UINT8_C(244),
+      UINT8_C(201), UINT8_C( 56), UINT8_C( 58), UINT8_C(236), UINT8_C(219), UINT8_C( 80) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i])),
+      bv = simde_svld1_u8(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_u8_m(pv, av, bv);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b[1024], e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+    bv = simde_svld1_u8(pg, &(b[i]));
+
+    ev = simde_svmul_u8_m(pv, av, bv);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(35349), UINT16_C(62310), UINT16_C(20318), UINT16_C(12173), UINT16_C(40953), UINT16_C(35186), UINT16_C(41502), UINT16_C( 9085),
+      UINT16_C(13484), UINT16_C(56912), UINT16_C(42044), UINT16_C(55053), UINT16_C( 6462), UINT16_C(10283), UINT16_C(43157), UINT16_C(43586),
+      UINT16_C(43058), UINT16_C(37278), UINT16_C(11256), UINT16_C(61888), UINT16_C(13258), UINT16_C(59771), UINT16_C(63701), UINT16_C(33292),
+      UINT16_C(23596), UINT16_C(26720), UINT16_C(27905), UINT16_C(16191), UINT16_C(27270), UINT16_C( 7271), UINT16_C(43283), UINT16_C(17862),
+      UINT16_C(25682), UINT16_C(19158), UINT16_C(38799), UINT16_C(23099), UINT16_C(46794), UINT16_C(40771), UINT16_C(20398), UINT16_C(55841),
+      UINT16_C(33452), UINT16_C(44354), UINT16_C(33263), UINT16_C(30444), UINT16_C(21484), UINT16_C(65426), UINT16_C(22780), UINT16_C(20036),
+      UINT16_C( 7101), UINT16_C(19608), UINT16_C(54450), UINT16_C(31910), UINT16_C(59786), UINT16_C(14619), UINT16_C(15673), UINT16_C(58643),
+      UINT16_C(22207), UINT16_C(44690), UINT16_C(32471), UINT16_C(49956), UINT16_C(46801), UINT16_C(52674), UINT16_C( 1807), UINT16_C(52252),
+      UINT16_C(46114), UINT16_C(54296), UINT16_C(49032), UINT16_C( 4944), UINT16_C(27560), UINT16_C(57676), UINT16_C(24488), UINT16_C(26566),
+      UINT16_C(22709), UINT16_C(36118), UINT16_C(15062), UINT16_C(42832), UINT16_C( 5105), UINT16_C(  117), UINT16_C(37146), UINT16_C(15564),
+      UINT16_C(58437), UINT16_C(52752), UINT16_C(24739), UINT16_C(19681), UINT16_C(11723), UINT16_C(29741), UINT16_C(62604), UINT16_C(17115),
+      UINT16_C(61772), UINT16_C( 9167), UINT16_C( 7980), UINT16_C( 7626), UINT16_C(16178), UINT16_C(19485), UINT16_C(59856), UINT16_C( 5768),
+      UINT16_C(39117), UINT16_C(29156), UINT16_C(50680), UINT16_C(50365), UINT16_C(60146), UINT16_C(32312), UINT16_C( 5086), UINT16_C(11200),
+      UINT16_C(36613), UINT16_C(12622), UINT16_C( 6319), UINT16_C(57678), UINT16_C(27480), UINT16_C(10286), UINT16_C(46676), UINT16_C( 8510),
+      UINT16_C( 8783), UINT16_C(18322), UINT16_C(20455), UINT16_C(55563), UINT16_C(17210), UINT16_C( 6232), UINT16_C( 6231), UINT16_C(23619),
+      UINT16_C(37288), UINT16_C(22413), UINT16_C(56234), UINT16_C(  568), UINT16_C(26182), UINT16_C(39466), UINT16_C(26909), UINT16_C(27835),
+      UINT16_C(20107), UINT16_C(29619), UINT16_C(49053), UINT16_C(55116), UINT16_C(41986), UINT16_C(23024), UINT16_C(13245), UINT16_C(26037),
+      UINT16_C(17093), UINT16_C(28604), UINT16_C(62493), UINT16_C(25457), UINT16_C(39771), UINT16_C(30973), UINT16_C(47364), UINT16_C(37092),
+      UINT16_C(38663), UINT16_C(41987), UINT16_C(20310), UINT16_C(22908), UINT16_C(27892), UINT16_C(45490), UINT16_C(26783), UINT16_C(25622),
+      UINT16_C(53930), UINT16_C(51411), UINT16_C(17606), UINT16_C( 8491), UINT16_C(10720), UINT16_C(58521), UINT16_C(32226), UINT16_C(59764),
+      UINT16_C(30485), UINT16_C(27533), UINT16_C( 2503), UINT16_C(48068), UINT16_C(30581), UINT16_C( 5484), UINT16_C(33503), UINT16_C(35193),
+      UINT16_C(19796), UINT16_C( 6737), UINT16_C(32145), UINT16_C(28988), UINT16_C(54694), UINT16_C(34902), UINT16_C(51795), UINT16_C(26737),
+      UINT16_C(65090), UINT16_C( 2515), UINT16_C(38920), UINT16_C(32196), UINT16_C(12303), UINT16_C(61074), UINT16_C( 3250), UINT16_C( 1655),
+      UINT16_C(51545), UINT16_C(59936), UINT16_C(23622), UINT16_C(60508), UINT16_C(45618), UINT16_C(34164), UINT16_C(58748), UINT16_C(48877),
+      UINT16_C(49379), UINT16_C(60359), UINT16_C(35672), UINT16_C(26473), UINT16_C(64443), UINT16_C(27989), UINT16_C(52487), UINT16_C(24691),
+      UINT16_C(38038), UINT16_C(56395), UINT16_C(42992), UINT16_C( 8904), UINT16_C(15449), UINT16_C(54695), UINT16_C(37921), UINT16_C( 1172),
+      UINT16_C(23381), UINT16_C(44528), UINT16_C(23015), UINT16_C(41493), UINT16_C(27220), UINT16_C(23568), UINT16_C(33591), UINT16_C(52668),
+      UINT16_C( 1815), UINT16_C( 2217), UINT16_C(29102), UINT16_C( 1834), UINT16_C(53933), UINT16_C(52957), UINT16_C(29030), UINT16_C(48083),
+      UINT16_C(50124), UINT16_C(45929), UINT16_C(32284), UINT16_C(28758), UINT16_C(26344), UINT16_C( 8396), UINT16_C(35305), UINT16_C(  493),
+      UINT16_C(38800), UINT16_C(16137), UINT16_C(13064), UINT16_C(46662), UINT16_C( 8965), UINT16_C(27780), UINT16_C(22420), UINT16_C(24871),
+      UINT16_C(36890), UINT16_C(13844), UINT16_C(27150), UINT16_C(63399), UINT16_C(29648), UINT16_C(47639), UINT16_C( 1276), UINT16_C(36283),
+      UINT16_C(50331), UINT16_C(42188), UINT16_C( 4855), UINT16_C(64858), UINT16_C(56886), UINT16_C(51817), UINT16_C(36918), UINT16_C(20523),
+      UINT16_C(16417), UINT16_C(12167), UINT16_C(11946), UINT16_C(31526), UINT16_C(15777), UINT16_C(40501), UINT16_C(61506), UINT16_C(56619),
+      UINT16_C(63412), UINT16_C(43905), UINT16_C(56073), UINT16_C(16296), UINT16_C( 4538), UINT16_C(61450), UINT16_C(13730), UINT16_C(49984),
+      UINT16_C(51061), UINT16_C( 8434), UINT16_C( 6645), UINT16_C(38811), UINT16_C(53334), UINT16_C(38965), UINT16_C(24768), UINT16_C(29814),
+      UINT16_C(63319), UINT16_C(24607), UINT16_C(51411), UINT16_C(36256), UINT16_C(43737), UINT16_C(31613), UINT16_C(48607), UINT16_C(21822),
+      UINT16_C(12677), UINT16_C(31349), UINT16_C( 4170), UINT16_C(40977), UINT16_C(18144), UINT16_C(41017), UINT16_C(44966), UINT16_C(64788),
+      UINT16_C(13222), UINT16_C(31070), UINT16_C(65275), UINT16_C(54534), UINT16_C(33704), UINT16_C(34640), UINT16_C(36673), UINT16_C(50908),
+      UINT16_C(20928), UINT16_C( 2624), UINT16_C(21089), UINT16_C(16810), UINT16_C(58264), UINT16_C(16353), UINT16_C(62866), UINT16_C(14652),
+      UINT16_C(39465), UINT16_C( 9394), UINT16_C(47512), UINT16_C(16633), UINT16_C(19004), UINT16_C(32200), UINT16_C(42201), UINT16_C(39235),
+      UINT16_C(34038), UINT16_C(22435), UINT16_C(19926), UINT16_C(28313), UINT16_C(31281), UINT16_C(50093), UINT16_C(60016), UINT16_C(39420),
+      UINT16_C(44932), UINT16_C( 7613), UINT16_C(46952), UINT16_C(42077), UINT16_C( 9473), UINT16_C(55842), UINT16_C(26058), UINT16_C(49267),
+      UINT16_C( 5865), UINT16_C(48919), UINT16_C(45155), UINT16_C(37934), UINT16_C(56107), UINT16_C(39768), UINT16_C(21701), UINT16_C(18996),
+      UINT16_C(61699), UINT16_C(27495), UINT16_C(50344), UINT16_C(43280), UINT16_C(13034), UINT16_C(46211), UINT16_C(63127), UINT16_C(33140),
+      UINT16_C(35596), UINT16_C(28736), UINT16_C(28220), UINT16_C(26372), UINT16_C(23626), UINT16_C( 3842), UINT16_C(14001), UINT16_C(46169),
+      UINT16_C(49191), UINT16_C(53280), UINT16_C(12421), UINT16_C(28537), UINT16_C(64866), UINT16_C(63779), UINT16_C(38899), UINT16_C(  122),
+      UINT16_C(47906), UINT16_C(24176), UINT16_C(29737), UINT16_C(29637) };
+  static const uint16_t b[] =
+    { UINT16_C(58253), UINT16_C(20935), UINT16_C(55863), UINT16_C(32912), UINT16_C(19392), UINT16_C(48910), UINT16_C(42484), UINT16_C( 5274),
+      UINT16_C(30176), UINT16_C(18133), UINT16_C( 6262), UINT16_C(22904), UINT16_C(26515), UINT16_C(36663), UINT16_C(43460), UINT16_C(20746),
+      UINT16_C(53644), UINT16_C(50082), UINT16_C(13227), UINT16_C(27716), UINT16_C(21118), UINT16_C(29483), UINT16_C(50679), UINT16_C(55175),
+      UINT16_C(23867), UINT16_C(45341), UINT16_C(38517), UINT16_C( 2315), UINT16_C(17149), UINT16_C(49816), UINT16_C(41707), UINT16_C(30483),
+      UINT16_C(46707), UINT16_C( 7994), UINT16_C(32489), UINT16_C(26507), UINT16_C(46800), UINT16_C(51162), UINT16_C(25211), UINT16_C(46750),
+      UINT16_C(48319), UINT16_C(13416), UINT16_C(29522), UINT16_C(20285), UINT16_C(54709), UINT16_C(40977), UINT16_C( 9591), UINT16_C(60183),
+      UINT16_C(20955), UINT16_C(50186), UINT16_C(38352), UINT16_C(41003), UINT16_C( 1611), UINT16_C(50792), UINT16_C( 1640), UINT16_C(10109),
+      UINT16_C(58818), UINT16_C( 5211), UINT16_C(39256), UINT16_C( 3428), UINT16_C(30062), UINT16_C(59053), UINT16_C(50330), UINT16_C(30161),
+      UINT16_C(56085), UINT16_C(58681), UINT16_C(25968), UINT16_C(48006), UINT16_C(61035), UINT16_C(54145), UINT16_C(65268), UINT16_C(47098),
+      UINT16_C(21987), UINT16_C(15307), UINT16_C(12270), UINT16_C(23880), UINT16_C(62885), UINT16_C(16195), UINT16_C( 5305), UINT16_C(53173),
+      UINT16_C(61167), UINT16_C(24500), UINT16_C(14931), UINT16_C(48666), UINT16_C(39720), UINT16_C( 7569), UINT16_C(35738), UINT16_C(32212),
+      UINT16_C(40929), UINT16_C(53177), UINT16_C(  463), UINT16_C(29740), UINT16_C(28663), UINT16_C(45235), UINT16_C(26755), UINT16_C(29311),
+      UINT16_C(13399), UINT16_C(43729), UINT16_C(60270), UINT16_C(38761), UINT16_C(64135), UINT16_C( 8628), UINT16_C(34950), UINT16_C(26526),
+      UINT16_C(22311), UINT16_C(63030), UINT16_C(25433), UINT16_C(20586), UINT16_C( 7890), UINT16_C(22016), UINT16_C(32902), UINT16_C(56776),
+      UINT16_C(39604), UINT16_C( 8840), UINT16_C(61829), UINT16_C( 3257), UINT16_C(28139), UINT16_C(28973), UINT16_C(52469), UINT16_C( 7640),
+      UINT16_C( 3875), UINT16_C(31763), UINT16_C(32370), UINT16_C(17612), UINT16_C(52636), UINT16_C( 8858), UINT16_C(25421), UINT16_C(  256),
+      UINT16_C(35069), UINT16_C(33315), UINT16_C(56697), UINT16_C(25743), UINT16_C(48202), UINT16_C(16598), UINT16_C(44680), UINT16_C(44125),
+      UINT16_C(28861), UINT16_C(12072), UINT16_C(62958), UINT16_C(35444), UINT16_C( 3778), UINT16_C( 4013), UINT16_C(44401), UINT16_C(28176),
+      UINT16_C(13109), UINT16_C(44785), UINT16_C(32784), UINT16_C(23314), UINT16_C(59452), UINT16_C(50587), UINT16_C(63639), UINT16_C(21617),
+      UINT16_C(39272), UINT16_C(22404), UINT16_C(63630), UINT16_C(20705), UINT16_C(36358), UINT16_C(30815), UINT16_C(28475), UINT16_C(28902),
+      UINT16_C(55203), UINT16_C(45854), UINT16_C(12631), UINT16_C(37902), UINT16_C(43289), UINT16_C(45145), UINT16_C(51873), UINT16_C( 2565),
+      UINT16_C(35171), UINT16_C(62049), UINT16_C(17025), UINT16_C(34626), UINT16_C(41681), UINT16_C( 3327), UINT16_C(58897), UINT16_C(46205),
+      UINT16_C(39869), UINT16_C( 5480), UINT16_C(30412), UINT16_C(59049), UINT16_C(  544), UINT16_C(49558), UINT16_C(39884), UINT16_C(12235),
+      UINT16_C(11300), UINT16_C(42273), UINT16_C(25711), UINT16_C(16429), UINT16_C(11270), UINT16_C( 5964), UINT16_C(51474), UINT16_C(53452),
+      UINT16_C(13413), UINT16_C(12773), UINT16_C(36522), UINT16_C(51735), UINT16_C(44688), UINT16_C(23692), UINT16_C(22345), UINT16_C(28299),
+      UINT16_C(44420), UINT16_C(62227), UINT16_C(16401), UINT16_C( 5939), UINT16_C(32621), UINT16_C(32558), UINT16_C(64073), UINT16_C(44623),
+      UINT16_C(13358), UINT16_C(55775), UINT16_C(63426), UINT16_C(21155), UINT16_C(12197), UINT16_C(61102), UINT16_C(14983), UINT16_C( 2908),
+      UINT16_C(28903), UINT16_C(63742), UINT16_C(12720), UINT16_C( 7439), UINT16_C(15792), UINT16_C(63901), UINT16_C(60472), UINT16_C(26279),
+      UINT16_C(34593), UINT16_C(58175), UINT16_C(58238), UINT16_C( 9014), UINT16_C(58386), UINT16_C(39185), UINT16_C(28190), UINT16_C( 1444),
+      UINT16_C(41694), UINT16_C(36605), UINT16_C( 3283), UINT16_C(33964), UINT16_C(18762), UINT16_C(33405), UINT16_C( 9525), UINT16_C(22248),
+      UINT16_C(10412), UINT16_C(10810), UINT16_C(28683), UINT16_C( 7501), UINT16_C(24148), UINT16_C(29623), UINT16_C(23500), UINT16_C(43640),
+      UINT16_C(30462), UINT16_C(53561), UINT16_C(58754), UINT16_C(52309), UINT16_C(54062), UINT16_C(25422), UINT16_C(14328), UINT16_C(42170),
+      UINT16_C(62559), UINT16_C(27342), UINT16_C( 7012), UINT16_C(47239), UINT16_C(15993), UINT16_C(17963), UINT16_C(42138), UINT16_C(39152),
+      UINT16_C(10522), UINT16_C(40041), UINT16_C(48910), UINT16_C(15465), UINT16_C(46994), UINT16_C(35488), UINT16_C(23278), UINT16_C(19758),
+      UINT16_C(64590), UINT16_C(45751), UINT16_C(16151), UINT16_C(36970), UINT16_C(38525), UINT16_C( 6102), UINT16_C(51002), UINT16_C(21679),
+      UINT16_C( 6640), UINT16_C(65520), UINT16_C(23000), UINT16_C(27195), UINT16_C(56081), UINT16_C(65524), UINT16_C( 8757), UINT16_C(33613),
+      UINT16_C( 1054), UINT16_C(13621), UINT16_C(41027), UINT16_C(49605), UINT16_C(39990), UINT16_C(28888), UINT16_C(34915), UINT16_C(21444),
+      UINT16_C(46241), UINT16_C(31058), UINT16_C(36366), UINT16_C( 8163), UINT16_C(55145), UINT16_C(40734), UINT16_C(27641), UINT16_C( 5922),
+      UINT16_C(22640), UINT16_C(45900), UINT16_C( 4600), UINT16_C(11892), UINT16_C(19885), UINT16_C( 4254), UINT16_C(25301), UINT16_C(30308),
+      UINT16_C(46614), UINT16_C( 9455), UINT16_C(53828), UINT16_C(44611), UINT16_C(25257), UINT16_C(41549), UINT16_C(28621), UINT16_C(15801),
+      UINT16_C( 1479), UINT16_C(49137), UINT16_C(25878), UINT16_C(50413), UINT16_C(35762), UINT16_C(34772), UINT16_C(14573), UINT16_C( 1277),
+      UINT16_C(60655), UINT16_C(13096), UINT16_C(27838), UINT16_C(26593), UINT16_C(11982), UINT16_C(39689), UINT16_C(49822), UINT16_C(26073),
+      UINT16_C(51911), UINT16_C(56869), UINT16_C( 4655), UINT16_C(58018), UINT16_C(30366), UINT16_C(35689), UINT16_C(26543), UINT16_C(40591),
+      UINT16_C(47187), UINT16_C( 4817), UINT16_C(45860), UINT16_C(62073), UINT16_C(33761), UINT16_C(32653), UINT16_C(26181), UINT16_C( 3557),
+      UINT16_C( 2608), UINT16_C(24811), UINT16_C(36124), UINT16_C(47682), UINT16_C(43779), UINT16_C(45638), UINT16_C(54546), UINT16_C(26192),
+      UINT16_C( 8845), UINT16_C(45432), UINT16_C(61909), UINT16_C(46755), UINT16_C(12660), UINT16_C(47670), UINT16_C( 7063), UINT16_C(51399),
+      UINT16_C(45605), UINT16_C(16680), UINT16_C(27199), UINT16_C(17148) };
+  static const uint16_t e[] =
+    { UINT16_C(    0), UINT16_C(    0), UINT16_C( 6450), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(55960), UINT16_C( 7474),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(21416), UINT16_C(21272), UINT16_C(28826), UINT16_C(    0), UINT16_C(    0), UINT16_C(34964),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(12652), UINT16_C(30889), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(26485), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(14258),
+      UINT16_C(23766), UINT16_C(    0), UINT16_C(21287), UINT16_C(    0), UINT16_C( 8224), UINT16_C(46094), UINT16_C(    0), UINT16_C( 5726),
+      UINT16_C(52820), UINT16_C(51920), UINT16_C(    0), UINT16_C(10812), UINT16_C(    0), UINT16_C(14514), UINT16_C(51492), UINT16_C(    0),
+      UINT16_C(34735), UINT16_C(    0), UINT16_C(    0), UINT16_C(45026), UINT16_C(42862), UINT16_C( 5368), UINT16_C(    0), UINT16_C(48967),
+      UINT16_C(38846), UINT16_C(    0), UINT16_C(    0), UINT16_C( 3600), UINT16_C(    0), UINT16_C(    0), UINT16_C(47878), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(29568), UINT16_C(    0), UINT16_C(12088), UINT16_C(11084), UINT16_C(56352), UINT16_C(57692),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(64756), UINT16_C(    0), UINT16_C(32597), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(54080), UINT16_C(17113), UINT16_C(    0), UINT16_C( 4280), UINT16_C(59005), UINT16_C(    0), UINT16_C(19548),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(24724), UINT16_C(    0), UINT16_C(    0), UINT16_C(10311), UINT16_C( 9584), UINT16_C(48504),
+      UINT16_C(    0), UINT16_C(25380), UINT16_C(47248), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(22068), UINT16_C(16512),
+      UINT16_C(31939), UINT16_C(    0), UINT16_C(    0), UINT16_C(43596), UINT16_C(24112), UINT16_C(29696), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(42380), UINT16_C(    0), UINT16_C(64003), UINT16_C(    0), UINT16_C(26686), UINT16_C( 8056), UINT16_C(40771), UINT16_C(    0),
+      UINT16_C(49656), UINT16_C(52087), UINT16_C(32180), UINT16_C(    0), UINT16_C(24744), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(30559), UINT16_C(    0), UINT16_C( 6709), UINT16_C(62324), UINT16_C(    0), UINT16_C(    0), UINT16_C(62056), UINT16_C(36545),
+      UINT16_C(31601), UINT16_C(    0), UINT16_C(46070), UINT16_C(63796), UINT16_C(    0), UINT16_C(38393), UINT16_C(24260), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(48585), UINT16_C(    0),
+      UINT16_C(12048), UINT16_C(    0), UINT16_C(62932), UINT16_C(    0), UINT16_C(15168), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(30047), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(59245), UINT16_C(    0), UINT16_C(17471), UINT16_C(    0),
+      UINT16_C(56188), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(30854), UINT16_C(54698), UINT16_C(    0), UINT16_C(29485),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 7780), UINT16_C(    0), UINT16_C(56204), UINT16_C(58328), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(52768), UINT16_C(23130), UINT16_C(35884), UINT16_C(    0), UINT16_C( 2672), UINT16_C(32440), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(45872), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(64344), UINT16_C(    0), UINT16_C(    0), UINT16_C(58840), UINT16_C(55525), UINT16_C(    0), UINT16_C(    0), UINT16_C(  428),
+      UINT16_C(44358), UINT16_C(62480), UINT16_C(  526), UINT16_C(60767), UINT16_C(    0), UINT16_C(    0), UINT16_C(43009), UINT16_C(  912),
+      UINT16_C(30145), UINT16_C(20398), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(53897), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(16855), UINT16_C(58824), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(18254), UINT16_C(56532),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(36616), UINT16_C(    0), UINT16_C(    0), UINT16_C(34212), UINT16_C( 9560),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(44698), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(33738), UINT16_C(15724), UINT16_C(    0), UINT16_C(    0), UINT16_C(28596), UINT16_C(18174), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C( 9378), UINT16_C(    0), UINT16_C(16650), UINT16_C( 7961), UINT16_C(    0), UINT16_C(53172), UINT16_C(57424),
+      UINT16_C(    0), UINT16_C(62441), UINT16_C(    0), UINT16_C(31720), UINT16_C(    0), UINT16_C(    0), UINT16_C(53404), UINT16_C(21888),
+      UINT16_C(61862), UINT16_C(53502), UINT16_C(40963), UINT16_C(63022), UINT16_C(    0), UINT16_C(65358), UINT16_C(    0), UINT16_C(21674),
+      UINT16_C(24720), UINT16_C(65040), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(60715), UINT16_C(    0),
+      UINT16_C(57750), UINT16_C(    0), UINT16_C(33630), UINT16_C(65045), UINT16_C(29504), UINT16_C(    0), UINT16_C(    0), UINT16_C(16208),
+      UINT16_C(    0), UINT16_C(19996), UINT16_C(11194), UINT16_C(    0), UINT16_C( 6120), UINT16_C(    0), UINT16_C(33081), UINT16_C(11576),
+      UINT16_C(50176), UINT16_C(51968), UINT16_C(16120), UINT16_C(19720), UINT16_C(    0), UINT16_C(    0), UINT16_C(13946), UINT16_C(  880),
+      UINT16_C(    0), UINT16_C(18990), UINT16_C(    0), UINT16_C(16171), UINT16_C(63900), UINT16_C(25896), UINT16_C( 6341), UINT16_C(47211),
+      UINT16_C(10554), UINT16_C( 7539), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(35248), UINT16_C( 7692),
+      UINT16_C(    0), UINT16_C(19592), UINT16_C(65328), UINT16_C(57533), UINT16_C(62670), UINT16_C(    0), UINT16_C(    0), UINT16_C(32891),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(22573), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(35596),
+      UINT16_C(19449), UINT16_C(    0), UINT16_C( 8096), UINT16_C( 2192), UINT16_C(32170), UINT16_C(    0), UINT16_C(    0), UINT16_C(45252),
+      UINT16_C(    0), UINT16_C( 2752), UINT16_C( 6800), UINT16_C(30472), UINT16_C(    0), UINT16_C(32396), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(  891), UINT16_C(    0), UINT16_C(37801), UINT16_C(    0), UINT16_C(37480), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(45034), UINT16_C(12672), UINT16_C(    0), UINT16_C(    0) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_u16_z(pv, av, bv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+
+    ev = simde_svmul_u16_z(pv, av, bv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(31644), UINT16_C(24773), UINT16_C(38989), UINT16_C( 6316), UINT16_C(49630), UINT16_C(26685), UINT16_C(27424), UINT16_C( 6270),
+      UINT16_C(10827), UINT16_C(39070), UINT16_C(32727), UINT16_C(32825), UINT16_C(47513), UINT16_C(16165), UINT16_C(57634), UINT16_C(48893),
+      UINT16_C(50012), UINT16_C(43294), UINT16_C(52059), UINT16_C(15041), UINT16_C(65164), UINT16_C(44450), UINT16_C( 8297), UINT16_C(46533),
+      UINT16_C(25418), UINT16_C( 8525), UINT16_C(34531), UINT16_C(31906), UINT16_C(51007), UINT16_C(25275), UINT16_C(47272), UINT16_C( 1056),
+      UINT16_C(16251), UINT16_C(55214), UINT16_C(28426), UINT16_C(38417), UINT16_C(45934), UINT16_C(55107), UINT16_C( 2260), UINT16_C( 7820),
+      UINT16_C(55916), UINT16_C(20288), UINT16_C(57952), UINT16_C(41163), UINT16_C(34473), UINT16_C(20738), UINT16_C( 8766), UINT16_C(47701),
+      UINT16_C(  865), UINT16_C(27537), UINT16_C(41587), UINT16_C(57602), UINT16_C(17749), UINT16_C(10680), UINT16_C(17742), UINT16_C(47688),
+      UINT16_C(34847), UINT16_C(32521), UINT16_C(54378), UINT16_C( 4895), UINT16_C( 8538), UINT16_C(39012), UINT16_C(47428), UINT16_C(42322),
+      UINT16_C(58301), UINT16_C(12305), UINT16_C( 4997), UINT16_C(56081), UINT16_C(51544), UINT16_C(42500), UINT16_C(19470), UINT16_C(11616),
+      UINT16_C(27092), UINT16_C(16045), UINT16_C(52285), UINT16_C(38737), UINT16_C(46574), UINT16_C(12848), UINT16_C(33391), UINT16_C(11479),
+      UINT16_C(59494), UINT16_C(60252), UINT16_C(28155), UINT16_C(21702), UINT16_C(52022), UINT16_C(17914), UINT16_C(23319), UINT16_C(60530),
+      UINT16_C( 8132), UINT16_C(  554), UINT16_C(31980), UINT16_C(55961), UINT16_C(51505), UINT16_C(40972), UINT16_C(58188), UINT16_C(45772),
+      UINT16_C(10444), UINT16_C(51101), UINT16_C(25749), UINT16_C(52251), UINT16_C( 5679), UINT16_C(17937), UINT16_C(33649), UINT16_C(13618),
+      UINT16_C(23971), UINT16_C(36663), UINT16_C(53721), UINT16_C( 2665), UINT16_C(30106), UINT16_C(59051), UINT16_C(30552), UINT16_C( 9368),
+      UINT16_C(13984), UINT16_C(13804), UINT16_C( 1946), UINT16_C(51457), UINT16_C( 4637), UINT16_C(36367), UINT16_C(17046), UINT16_C(14788),
+      UINT16_C(64415), UINT16_C(30920), UINT16_C(12748), UINT16_C(26498), UINT16_C(11686), UINT16_C(65101), UINT16_C(59045), UINT16_C(17699),
+      UINT16_C( 3868), UINT16_C(46714), UINT16_C(31766), UINT16_C(13439), UINT16_C(36494), UINT16_C( 9410), UINT16_C(34512), UINT16_C(28509),
+      UINT16_C( 9602), UINT16_C(20199), UINT16_C(27222), UINT16_C(64693), UINT16_C(  919), UINT16_C(15611), UINT16_C( 7913), UINT16_C( 1409),
+      UINT16_C(64557), UINT16_C(17339), UINT16_C(14968), UINT16_C( 1655), UINT16_C(15048), UINT16_C(39211), UINT16_C(35008), UINT16_C(16904),
+      UINT16_C(61614), UINT16_C( 1169), UINT16_C(18010), UINT16_C(61697), UINT16_C(64585), UINT16_C(12846), UINT16_C(44826), UINT16_C(18231),
+      UINT16_C(62123), UINT16_C( 9098), UINT16_C(  556), UINT16_C(62762), UINT16_C(21820), UINT16_C(64654), UINT16_C(38621), UINT16_C(35647),
+      UINT16_C(53382), UINT16_C(57488), UINT16_C(37142), UINT16_C(24786), UINT16_C(  141), UINT16_C(42898), UINT16_C(51887), UINT16_C(23534),
+      UINT16_C(30908), UINT16_C(59774), UINT16_C(43130), UINT16_C(46814), UINT16_C(27901), UINT16_C(56243), UINT16_C(61954), UINT16_C(35174),
+      UINT16_C(63170), UINT16_C(55401), UINT16_C(15239), UINT16_C( 5176), UINT16_C(52027), UINT16_C(60347), UINT16_C(43413), UINT16_C(20806),
+      UINT16_C(50210), UINT16_C(39994), UINT16_C( 6253), UINT16_C(27219), UINT16_C( 1668), UINT16_C(34629), UINT16_C(44280), UINT16_C(47632),
+      UINT16_C(31138), UINT16_C(10898), UINT16_C(52149), UINT16_C(61502), UINT16_C(64150), UINT16_C(11227), UINT16_C( 8611), UINT16_C(50556),
+      UINT16_C(47078), UINT16_C(21346), UINT16_C(46543), UINT16_C(21693), UINT16_C(  955), UINT16_C(46043), UINT16_C(60335), UINT16_C(20845),
+      UINT16_C(65380), UINT16_C( 6523), UINT16_C(47818), UINT16_C(24586), UINT16_C(58804), UINT16_C(22411), UINT16_C( 2055), UINT16_C(60701),
+      UINT16_C(32703), UINT16_C(36416), UINT16_C(64820), UINT16_C(61410), UINT16_C(48384), UINT16_C(44962), UINT16_C( 4008), UINT16_C( 3329),
+      UINT16_C(31758), UINT16_C(55590), UINT16_C(12342), UINT16_C(59961), UINT16_C(50454), UINT16_C( 7490), UINT16_C(24525), UINT16_C(35850),
+      UINT16_C(19166), UINT16_C( 4634), UINT16_C(64839), UINT16_C(18433), UINT16_C(41914), UINT16_C(25591), UINT16_C(63666), UINT16_C(49264),
+      UINT16_C(38517), UINT16_C(43929), UINT16_C(54215), UINT16_C(56726), UINT16_C(55448), UINT16_C(26106), UINT16_C( 1079), UINT16_C( 5617),
+      UINT16_C( 2894), UINT16_C(38183), UINT16_C(10248), UINT16_C(50141), UINT16_C(54731), UINT16_C(32038), UINT16_C(38605), UINT16_C(16957),
+      UINT16_C(55084), UINT16_C(62446), UINT16_C(33962), UINT16_C(17104), UINT16_C(51804), UINT16_C(37799), UINT16_C(39118), UINT16_C( 7336),
+      UINT16_C(53155), UINT16_C(44210), UINT16_C(36855), UINT16_C(49775), UINT16_C(38244), UINT16_C(12863), UINT16_C(31787), UINT16_C(22388),
+      UINT16_C(25171), UINT16_C(64843), UINT16_C( 7142), UINT16_C(16959), UINT16_C(59110), UINT16_C(46293), UINT16_C(32126), UINT16_C( 8913),
+      UINT16_C(33612), UINT16_C(17358), UINT16_C(15634), UINT16_C(30469), UINT16_C(17618), UINT16_C(64937), UINT16_C( 7617), UINT16_C( 5204),
+      UINT16_C(40832), UINT16_C(26130), UINT16_C(20923), UINT16_C(41385), UINT16_C(32312), UINT16_C(46677), UINT16_C( 9980), UINT16_C(18648),
+      UINT16_C(42665), UINT16_C(48268), UINT16_C(37347), UINT16_C(46387), UINT16_C(56534), UINT16_C(38834), UINT16_C( 2041), UINT16_C(31147),
+      UINT16_C(48550), UINT16_C(25056), UINT16_C(35087), UINT16_C(18178), UINT16_C(22535), UINT16_C( 1021), UINT16_C(54910), UINT16_C(10316),
+      UINT16_C(55420), UINT16_C(24804), UINT16_C( 5993), UINT16_C(16149), UINT16_C(51443), UINT16_C(60630), UINT16_C(33487), UINT16_C(30054),
+      UINT16_C(17983), UINT16_C(20183), UINT16_C(55759), UINT16_C(54933), UINT16_C(37681), UINT16_C(45274), UINT16_C( 9833), UINT16_C(58840),
+      UINT16_C(48382), UINT16_C(26437), UINT16_C(23507), UINT16_C(50855), UINT16_C(32035), UINT16_C(62130), UINT16_C( 6399), UINT16_C(16231),
+      UINT16_C(15966), UINT16_C(11661), UINT16_C( 8984), UINT16_C(18692), UINT16_C(57014), UINT16_C( 8185), UINT16_C(53508), UINT16_C(  516),
+      UINT16_C(19085), UINT16_C(24681), UINT16_C( 4261), UINT16_C(51238) };
+  static const uint16_t b[] =
+    { UINT16_C(14706), UINT16_C(17003), UINT16_C(64723), UINT16_C(34486), UINT16_C(52952), UINT16_C(51937), UINT16_C(24300), UINT16_C(18560),
+      UINT16_C(40767), UINT16_C(61714), UINT16_C(56004), UINT16_C(30524), UINT16_C(54215), UINT16_C( 7037), UINT16_C( 6589), UINT16_C(12268),
+      UINT16_C(22354), UINT16_C( 9585), UINT16_C(10323), UINT16_C(11435), UINT16_C(36086), UINT16_C(58358), UINT16_C(30443), UINT16_C(10795),
+      UINT16_C(15893), UINT16_C(55579), UINT16_C(22296), UINT16_C(57425), UINT16_C(52778), UINT16_C(59643), UINT16_C(59367), UINT16_C(14871),
+      UINT16_C(35134), UINT16_C(37215), UINT16_C( 2993), UINT16_C(42941), UINT16_C(45975), UINT16_C(33418), UINT16_C(46633), UINT16_C(16300),
+      UINT16_C(51188), UINT16_C( 3096), UINT16_C(26911), UINT16_C(18924), UINT16_C(59191), UINT16_C( 7985), UINT16_C(18894), UINT16_C( 3161),
+      UINT16_C(47314), UINT16_C(33694), UINT16_C(23491), UINT16_C(23338), UINT16_C(46351), UINT16_C(14557), UINT16_C(35435), UINT16_C(24439),
+      UINT16_C(36945), UINT16_C(28779), UINT16_C(22777), UINT16_C(12730), UINT16_C(60223), UINT16_C( 3664), UINT16_C(43316), UINT16_C( 1562),
+      UINT16_C(47201), UINT16_C( 9609), UINT16_C(46100), UINT16_C( 9088), UINT16_C(23913), UINT16_C(54363), UINT16_C(54247), UINT16_C(14643),
+      UINT16_C(40547), UINT16_C(23721), UINT16_C(25590), UINT16_C(13965), UINT16_C(56655), UINT16_C(33604), UINT16_C(24198), UINT16_C(59530),
+      UINT16_C( 4887), UINT16_C(11021), UINT16_C(36295), UINT16_C(12366), UINT16_C(43498), UINT16_C(53764), UINT16_C(14204), UINT16_C(57099),
+      UINT16_C(46294), UINT16_C(52284), UINT16_C(51480), UINT16_C(26370), UINT16_C(18087), UINT16_C(11754), UINT16_C(29861), UINT16_C(48149),
+      UINT16_C( 8840), UINT16_C(20455), UINT16_C(13743), UINT16_C(39552), UINT16_C(34014), UINT16_C(23404), UINT16_C(30652), UINT16_C(37434),
+      UINT16_C(30251), UINT16_C(17246), UINT16_C(24896), UINT16_C(59306), UINT16_C(38311), UINT16_C(19476), UINT16_C(10761), UINT16_C(37128),
+      UINT16_C(61260), UINT16_C(64737), UINT16_C(24868), UINT16_C(  918), UINT16_C(  741), UINT16_C(41310), UINT16_C(39033), UINT16_C(42035),
+      UINT16_C(37391), UINT16_C(20456), UINT16_C(37619), UINT16_C(39478), UINT16_C(18983), UINT16_C(12775), UINT16_C(61300), UINT16_C(49602),
+      UINT16_C(41951), UINT16_C(  957), UINT16_C(21252), UINT16_C(59910), UINT16_C(25685), UINT16_C(52875), UINT16_C(49149), UINT16_C( 3186),
+      UINT16_C(23121), UINT16_C(17499), UINT16_C(37357), UINT16_C( 5342), UINT16_C(50651), UINT16_C(20549), UINT16_C( 2229), UINT16_C(37905),
+      UINT16_C(52907), UINT16_C(45207), UINT16_C(40481), UINT16_C(30362), UINT16_C( 9474), UINT16_C(65348), UINT16_C(46820), UINT16_C(13579),
+      UINT16_C(26129), UINT16_C(65145), UINT16_C(22775), UINT16_C(54034), UINT16_C(22557), UINT16_C(53795), UINT16_C(13408), UINT16_C( 2918),
+      UINT16_C(65026), UINT16_C( 9147), UINT16_C(21916), UINT16_C(40601), UINT16_C(56699), UINT16_C(24478), UINT16_C(43411), UINT16_C(42133),
+      UINT16_C( 3600), UINT16_C( 1954), UINT16_C(46438), UINT16_C(34010), UINT16_C(64781), UINT16_C(27990), UINT16_C(48433), UINT16_C(13176),
+      UINT16_C(13499), UINT16_C(22358), UINT16_C(61321), UINT16_C( 1269), UINT16_C(37836), UINT16_C(24676), UINT16_C(63805), UINT16_C(19716),
+      UINT16_C(42759), UINT16_C(28244), UINT16_C(12124), UINT16_C(27122), UINT16_C(18476), UINT16_C(24278), UINT16_C(19973), UINT16_C(49297),
+      UINT16_C(59522), UINT16_C( 3095), UINT16_C( 3543), UINT16_C(42000), UINT16_C(29856), UINT16_C(56580), UINT16_C( 2157), UINT16_C(29994),
+      UINT16_C(32687), UINT16_C( 3043), UINT16_C(54702), UINT16_C(55924), UINT16_C(18973), UINT16_C( 9016), UINT16_C(51865), UINT16_C( 7139),
+      UINT16_C(64434), UINT16_C(35111), UINT16_C(14344), UINT16_C(43053), UINT16_C(12716), UINT16_C( 6790), UINT16_C(45114), UINT16_C(59791),
+      UINT16_C(29231), UINT16_C(56821), UINT16_C(26951), UINT16_C(25784), UINT16_C(61620), UINT16_C(19847), UINT16_C(27578), UINT16_C(27752),
+      UINT16_C(36966), UINT16_C(28406), UINT16_C( 9160), UINT16_C(29718), UINT16_C(40021), UINT16_C(36750), UINT16_C( 7501), UINT16_C(31864),
+      UINT16_C(28047), UINT16_C(54874), UINT16_C( 4823), UINT16_C(35643), UINT16_C(49666), UINT16_C(48600), UINT16_C(16429), UINT16_C(37673),
+      UINT16_C( 8144), UINT16_C(38913), UINT16_C( 6211), UINT16_C(38925), UINT16_C(39860), UINT16_C(  295), UINT16_C(40889), UINT16_C(18558),
+      UINT16_C(55309), UINT16_C(58399), UINT16_C(23274), UINT16_C(60527), UINT16_C(18204), UINT16_C(19113), UINT16_C(54151), UINT16_C(22749),
+      UINT16_C(57330), UINT16_C(13808), UINT16_C(65015), UINT16_C(43981), UINT16_C(62617), UINT16_C(21165), UINT16_C(11156), UINT16_C(41370),
+      UINT16_C(47363), UINT16_C(60805), UINT16_C(62483), UINT16_C(12505), UINT16_C(33595), UINT16_C(49786), UINT16_C(22358), UINT16_C(18458),
+      UINT16_C( 2870), UINT16_C(11646), UINT16_C(19208), UINT16_C(41433), UINT16_C(34368), UINT16_C(54515), UINT16_C(36529), UINT16_C(46197),
+      UINT16_C(64071), UINT16_C(23457), UINT16_C(31470), UINT16_C(10635), UINT16_C( 1533), UINT16_C(21483), UINT16_C( 1628), UINT16_C(37788),
+      UINT16_C( 6673), UINT16_C( 6592), UINT16_C(39269), UINT16_C(42427), UINT16_C(44575), UINT16_C(53369), UINT16_C(60988), UINT16_C(33924),
+      UINT16_C( 9704), UINT16_C(55007), UINT16_C(27296), UINT16_C(40447), UINT16_C(60271), UINT16_C(52209), UINT16_C(36337), UINT16_C(  606),
+      UINT16_C( 8103), UINT16_C( 3099), UINT16_C(54968), UINT16_C(55474), UINT16_C(11141), UINT16_C(49576), UINT16_C(11546), UINT16_C(  581),
+      UINT16_C( 9298), UINT16_C(62169), UINT16_C(55438), UINT16_C(64912), UINT16_C(33219), UINT16_C(46281), UINT16_C( 9998), UINT16_C(46518),
+      UINT16_C(53830), UINT16_C(65473), UINT16_C(29608), UINT16_C(11735), UINT16_C(32671), UINT16_C(47599), UINT16_C(13484), UINT16_C(65467),
+      UINT16_C(37977), UINT16_C(59377), UINT16_C(33133), UINT16_C(12517), UINT16_C(44546), UINT16_C( 4325), UINT16_C(39893), UINT16_C( 7365),
+      UINT16_C(34669), UINT16_C( 5659), UINT16_C(62202), UINT16_C(39235), UINT16_C(12913), UINT16_C( 7762), UINT16_C( 3687), UINT16_C(49181),
+      UINT16_C( 3746), UINT16_C( 4007), UINT16_C(35984), UINT16_C(37440), UINT16_C( 9530), UINT16_C( 4259), UINT16_C(26816), UINT16_C(11820),
+      UINT16_C(18415), UINT16_C(59972), UINT16_C(34617), UINT16_C(43651) };
+  static const uint16_t e[] =
+    { UINT16_C(51064), UINT16_C(15447), UINT16_C(21367), UINT16_C( 6316), UINT16_C(14160), UINT16_C(49053), UINT16_C(33152), UINT16_C(44800),
+      UINT16_C(64885), UINT16_C(39070), UINT16_C(32727), UINT16_C(35932), UINT16_C(47513), UINT16_C(48145), UINT16_C(57634), UINT16_C(33852),
+      UINT16_C(55160), UINT16_C(64574), UINT16_C( 9857), UINT16_C(15041), UINT16_C(10888), UINT16_C(32684), UINT16_C( 9827), UINT16_C(46533),
+      UINT16_C( 4370), UINT16_C( 8525), UINT16_C(51784), UINT16_C(31906), UINT16_C(25174), UINT16_C(25275), UINT16_C(47272), UINT16_C( 1056),
+      UINT16_C(16251), UINT16_C(38802), UINT16_C(28426), UINT16_C(57741), UINT16_C(49122), UINT16_C(55107), UINT16_C( 8692), UINT16_C( 7820),
+      UINT16_C(55916), UINT16_C(20288), UINT16_C(51616), UINT16_C( 7716), UINT16_C(27983), UINT16_C(48994), UINT16_C( 8766), UINT16_C(47701),
+      UINT16_C(  865), UINT16_C(27537), UINT16_C(40601), UINT16_C(57602), UINT16_C(17749), UINT16_C(17368), UINT16_C(17742), UINT16_C(47688),
+      UINT16_C(33231), UINT16_C( 2243), UINT16_C(54378), UINT16_C(54150), UINT16_C( 8538), UINT16_C(39012), UINT16_C(47428), UINT16_C(42322),
+      UINT16_C(58301), UINT16_C(12305), UINT16_C( 2660), UINT16_C(56081), UINT16_C(51544), UINT16_C(21356), UINT16_C(10914), UINT16_C(11616),
+      UINT16_C(50428), UINT16_C(35893), UINT16_C(55710), UINT16_C(28061), UINT16_C(39538), UINT16_C(12848), UINT16_C(33391), UINT16_C(  998),
+      UINT16_C(59494), UINT16_C(60252), UINT16_C(28155), UINT16_C(62548), UINT16_C(52022), UINT16_C(11240), UINT16_C( 4132), UINT16_C(30438),
+      UINT16_C( 8132), UINT16_C(  554), UINT16_C(31980), UINT16_C(17458), UINT16_C(42231), UINT16_C(26360), UINT16_C(58188), UINT16_C(31420),
+      UINT16_C(10444), UINT16_C(51101), UINT16_C(39643), UINT16_C(52251), UINT16_C( 5679), UINT16_C(17937), UINT16_C(33649), UINT16_C(37204),
+      UINT16_C(56417), UINT16_C(36663), UINT16_C(44864), UINT16_C(43194), UINT16_C(30106), UINT16_C(59051), UINT16_C(41496), UINT16_C( 9368),
+      UINT16_C(13984), UINT16_C(13804), UINT16_C(27560), UINT16_C(51606), UINT16_C( 4637), UINT16_C(36367), UINT16_C(35046), UINT16_C(14788),
+      UINT16_C(27729), UINT16_C(11584), UINT16_C(40100), UINT16_C( 2412), UINT16_C(61514), UINT16_C(13435), UINT16_C(36292), UINT16_C(51078),
+      UINT16_C( 3868), UINT16_C( 9746), UINT16_C( 4696), UINT16_C(13439), UINT16_C(52518), UINT16_C( 9410), UINT16_C(27536), UINT16_C(62314),
+      UINT16_C(37410), UINT16_C(20199), UINT16_C(10142), UINT16_C(64693), UINT16_C(17709), UINT16_C(57255), UINT16_C( 8893), UINT16_C( 1409),
+      UINT16_C(64557), UINT16_C(33613), UINT16_C(14968), UINT16_C(48534), UINT16_C(15048), UINT16_C(39211), UINT16_C(19200), UINT16_C(32344),
+      UINT16_C(61614), UINT16_C( 1169), UINT16_C(53462), UINT16_C(61697), UINT16_C(64585), UINT16_C(38986), UINT16_C(44826), UINT16_C(18231),
+      UINT16_C(36694), UINT16_C(54222), UINT16_C(  556), UINT16_C(62762), UINT16_C(21820), UINT16_C(64654), UINT16_C(34279), UINT16_C(35647),
+      UINT16_C(53382), UINT16_C( 2848), UINT16_C(37142), UINT16_C(47828), UINT16_C(24617), UINT16_C(29964), UINT16_C(65151), UINT16_C(33168),
+      UINT16_C(24916), UINT16_C(59774), UINT16_C(43130), UINT16_C(46814), UINT16_C(27901), UINT16_C(56243), UINT16_C(40058), UINT16_C(54168),
+      UINT16_C(19790), UINT16_C( 8308), UINT16_C(11652), UINT16_C( 5176), UINT16_C(52027), UINT16_C(47186), UINT16_C(43413), UINT16_C(20806),
+      UINT16_C(26948), UINT16_C(49462), UINT16_C( 6253), UINT16_C(53552), UINT16_C(57984), UINT16_C(44564), UINT16_C(44280), UINT16_C(47632),
+      UINT16_C(31138), UINT16_C( 1398), UINT16_C( 3590), UINT16_C(61502), UINT16_C(64150), UINT16_C(35048), UINT16_C( 8611), UINT16_C(50556),
+      UINT16_C(47078), UINT16_C(21346), UINT16_C(46543), UINT16_C(21693), UINT16_C(  955), UINT16_C(25250), UINT16_C(46502), UINT16_C(20845),
+      UINT16_C(65380), UINT16_C(37303), UINT16_C(47818), UINT16_C(24586), UINT16_C(17040), UINT16_C(63821), UINT16_C(49686), UINT16_C(60701),
+      UINT16_C(22042), UINT16_C(36416), UINT16_C(60576), UINT16_C(61410), UINT16_C(49408), UINT16_C(59868), UINT16_C( 4008), UINT16_C(38008),
+      UINT16_C(16850), UINT16_C(55590), UINT16_C(12342), UINT16_C(59961), UINT16_C(13868), UINT16_C(27056), UINT16_C( 5897), UINT16_C(35850),
+      UINT16_C(19166), UINT16_C( 4634), UINT16_C(64839), UINT16_C(16397), UINT16_C(41914), UINT16_C(25591), UINT16_C(63666), UINT16_C(14112),
+      UINT16_C(23537), UINT16_C( 2951), UINT16_C(54215), UINT16_C(23562), UINT16_C(55456), UINT16_C(38410), UINT16_C( 1079), UINT16_C( 5617),
+      UINT16_C(41404), UINT16_C(38183), UINT16_C(34744), UINT16_C(50141), UINT16_C(54731), UINT16_C(32038), UINT16_C(38605), UINT16_C(16957),
+      UINT16_C(55084), UINT16_C( 4262), UINT16_C(33962), UINT16_C(17104), UINT16_C(46900), UINT16_C(60310), UINT16_C(39118), UINT16_C( 7336),
+      UINT16_C(52578), UINT16_C(44210), UINT16_C(36855), UINT16_C(49775), UINT16_C(45312), UINT16_C(12863), UINT16_C(46011), UINT16_C(34820),
+      UINT16_C(25171), UINT16_C(64843), UINT16_C( 7142), UINT16_C(16959), UINT16_C(44878), UINT16_C( 3719), UINT16_C( 3400), UINT16_C( 8913),
+      UINT16_C(28684), UINT16_C(63616), UINT16_C(55834), UINT16_C(30469), UINT16_C(17618), UINT16_C(13537), UINT16_C( 7617), UINT16_C(52048),
+      UINT16_C( 3072), UINT16_C(62894), UINT16_C(20923), UINT16_C(41385), UINT16_C( 8776), UINT16_C( 3333), UINT16_C(32572), UINT16_C(28496),
+      UINT16_C(42665), UINT16_C(29380), UINT16_C(37347), UINT16_C( 1398), UINT16_C(56534), UINT16_C(38834), UINT16_C(37962), UINT16_C(31147),
+      UINT16_C( 5932), UINT16_C(46816), UINT16_C(35087), UINT16_C(18178), UINT16_C(37973), UINT16_C( 1021), UINT16_C(60644), UINT16_C(25096),
+      UINT16_C(59880), UINT16_C(10212), UINT16_C( 5993), UINT16_C(16149), UINT16_C(23533), UINT16_C(49610), UINT16_C(61204), UINT16_C(23426),
+      UINT16_C(17983), UINT16_C(14695), UINT16_C( 3107), UINT16_C(54933), UINT16_C(37681), UINT16_C(45274), UINT16_C( 9833), UINT16_C(32568),
+      UINT16_C(48382), UINT16_C(26437), UINT16_C(23507), UINT16_C(52405), UINT16_C(32035), UINT16_C(39172), UINT16_C(  153), UINT16_C(16231),
+      UINT16_C(39804), UINT16_C(11661), UINT16_C( 8984), UINT16_C(18692), UINT16_C(57014), UINT16_C( 8185), UINT16_C(25344), UINT16_C( 4272),
+      UINT16_C(19085), UINT16_C(38372), UINT16_C(47037), UINT16_C(51238) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i])),
+      bv = simde_svld1_u16(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_u16_m(pv, av, bv);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b[1024 / sizeof(int16_t)], e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+    bv = simde_svld1_u16(pg, &(b[i]));
+
+    ev = simde_svmul_u16_m(pv, av, bv);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(  80424196), UINT32_C(1364847427), UINT32_C(4234102904), UINT32_C(2580914426), UINT32_C( 481055990), UINT32_C(4190630995), UINT32_C(1855230822), UINT32_C(2238158721),
+      UINT32_C( 126431940), UINT32_C(2522407709), UINT32_C( 630372395), UINT32_C(1321101144), UINT32_C( 241855419), UINT32_C(3305583199), UINT32_C(1177852869), UINT32_C(4157315891),
+      UINT32_C(3959379406), UINT32_C(1669420856), UINT32_C(1753748239), UINT32_C( 917915515), UINT32_C( 289743282), UINT32_C( 416762963), UINT32_C( 459213800), UINT32_C(1947347622),
+      UINT32_C(3076526463), UINT32_C(2015027561), UINT32_C(1893770229), UINT32_C(2628163562), UINT32_C( 195947448), UINT32_C( 539198520), UINT32_C( 909869711), UINT32_C( 749358509),
+      UINT32_C(3370388063), UINT32_C(3779133164), UINT32_C(2337350049), UINT32_C(1881667512), UINT32_C( 461100515), UINT32_C(3912998489), UINT32_C(3458168353), UINT32_C( 586860995),
+      UINT32_C(3236617940), UINT32_C(2124491741), UINT32_C(  67826252), UINT32_C(3430167017), UINT32_C(1625812742), UINT32_C(2924028557), UINT32_C(1551657112), UINT32_C(  92174129),
+      UINT32_C( 851798357), UINT32_C(3769722516), UINT32_C(1122286424), UINT32_C(4077803756), UINT32_C(3562272327), UINT32_C(2978192408), UINT32_C( 890109700), UINT32_C(3426454390),
+      UINT32_C(2298347764), UINT32_C(3211308903), UINT32_C(1459702890), UINT32_C(3947499684), UINT32_C( 515939590), UINT32_C(1036993337), UINT32_C(3111312450), UINT32_C(1552264552),
+      UINT32_C( 367362990), UINT32_C(2647936307), UINT32_C(1056233114), UINT32_C(3962191590), UINT32_C( 336259803), UINT32_C(1867635245), UINT32_C( 505988278), UINT32_C( 528199025),
+      UINT32_C(1681154097), UINT32_C(1191250349), UINT32_C(3313956575), UINT32_C( 280080436), UINT32_C(3341073306), UINT32_C(1278637717), UINT32_C(2875875130), UINT32_C(1036772620),
+      UINT32_C(4087480133), UINT32_C(3879379720), UINT32_C(3450650777), UINT32_C( 182279536), UINT32_C(2932933145), UINT32_C(3002730616), UINT32_C(1935500647), UINT32_C(2427529290),
+      UINT32_C( 813912616), UINT32_C(2383986165), UINT32_C(3999057022), UINT32_C(1006188834), UINT32_C(3018443323), UINT32_C( 962979026), UINT32_C(2477638473), UINT32_C( 321085163),
+      UINT32_C(2789516976), UINT32_C(3795082340), UINT32_C(1120964640), UINT32_C(  92129738), UINT32_C(1723426708), UINT32_C(2493521483), UINT32_C(3441905121), UINT32_C(1541426091),
+      UINT32_C(1426138353), UINT32_C(2704750208), UINT32_C(2430798022), UINT32_C(1704354257), UINT32_C( 332156872), UINT32_C(1336372333), UINT32_C(1679609529), UINT32_C( 197131289),
+      UINT32_C(2707472673), UINT32_C(3175258359), UINT32_C(1900947104), UINT32_C(1339548807), UINT32_C(2690818867), UINT32_C(3371108623), UINT32_C(4046195671), UINT32_C( 704441096),
+      UINT32_C(2747948204), UINT32_C(2489388532), UINT32_C(3121000243), UINT32_C(3322535315), UINT32_C(2405854080), UINT32_C(1264014964), UINT32_C(1765573473), UINT32_C( 462567534),
+      UINT32_C(2310954389), UINT32_C(2635997034), UINT32_C(1633101006), UINT32_C(2166841345), UINT32_C(1058049739), UINT32_C(1166698468), UINT32_C(1487914986), UINT32_C(2490581503),
+      UINT32_C( 136196766), UINT32_C( 547699793), UINT32_C(1635908704), UINT32_C( 669165916), UINT32_C( 459731511), UINT32_C(1130426713), UINT32_C(3080392632), UINT32_C(4014739281),
+      UINT32_C(2465753665), UINT32_C( 112369062), UINT32_C(4133958810), UINT32_C( 337529309), UINT32_C(2486142011), UINT32_C( 769101685), UINT32_C(4041568927), UINT32_C(3269407105),
+      UINT32_C(1096144795), UINT32_C( 256313205), UINT32_C( 403025467), UINT32_C( 841753591), UINT32_C( 499538856), UINT32_C(2320211435), UINT32_C(2440704015), UINT32_C(4233320801),
+      UINT32_C(2789058609), UINT32_C(3954541744), UINT32_C( 688175666), UINT32_C(2254123230), UINT32_C(2007179660), UINT32_C(3439455934), UINT32_C(2136898334), UINT32_C(  91992788),
+      UINT32_C( 179026010), UINT32_C(1861640252), UINT32_C(4187486747), UINT32_C(3061838378), UINT32_C(3509395987), UINT32_C( 798961169), UINT32_C(2125462953), UINT32_C( 176368303),
+      UINT32_C( 521416675), UINT32_C(2861435535), UINT32_C( 799220996), UINT32_C( 736436760), UINT32_C(1459426117), UINT32_C(3951402049), UINT32_C(1231631513), UINT32_C(1112796255),
+      UINT32_C(2875287323), UINT32_C(1985343346), UINT32_C( 765851925), UINT32_C(1616415515), UINT32_C(3753268638), UINT32_C(2345286897), UINT32_C(3486790512) };
+  static const uint32_t b[] =
+    { UINT32_C(1688414105), UINT32_C( 633771059), UINT32_C(1334352078), UINT32_C(4256001693), UINT32_C(3058839241), UINT32_C(2171676817), UINT32_C(3375774499), UINT32_C(2754829322),
+      UINT32_C(3070809732), UINT32_C( 970772075), UINT32_C(  76113254), UINT32_C(2617325267), UINT32_C(4115878756), UINT32_C(2675426427), UINT32_C( 174632447), UINT32_C(2377030665),
+      UINT32_C(3712333426), UINT32_C(3944161668), UINT32_C(1508876422), UINT32_C( 989262038), UINT32_C(3207612740), UINT32_C( 207529741), UINT32_C(1561773908), UINT32_C(3588998243),
+      UINT32_C(4289933434), UINT32_C(3639265873), UINT32_C(1077008746), UINT32_C( 226109385), UINT32_C(2110630512), UINT32_C(2777295697), UINT32_C(1426301170), UINT32_C(3744198245),
+      UINT32_C(1876876830), UINT32_C( 306694312), UINT32_C(1800567201), UINT32_C( 293129376), UINT32_C(3364767095), UINT32_C(1668159601), UINT32_C( 515469753), UINT32_C(2113791071),
+      UINT32_C(1793907906), UINT32_C(1182545060), UINT32_C(1303498413), UINT32_C( 291383706), UINT32_C(3772444015), UINT32_C(3192080389), UINT32_C( 417135801), UINT32_C(2727729888),
+      UINT32_C(1510769078), UINT32_C(1654687925), UINT32_C(4054864214), UINT32_C(3926003323), UINT32_C(  30072059), UINT32_C(3720285476), UINT32_C(3941964810), UINT32_C( 747473526),
+      UINT32_C(3246823692), UINT32_C(2015635234), UINT32_C(4083799160), UINT32_C(3739053282), UINT32_C(1843373896), UINT32_C(3209338549), UINT32_C(2963882042), UINT32_C(3604756170),
+      UINT32_C(4070073296), UINT32_C(  40549514), UINT32_C(1928778896), UINT32_C(2286998336), UINT32_C( 821374843), UINT32_C( 149897422), UINT32_C(1253677184), UINT32_C(2669778383),
+      UINT32_C(2190588408), UINT32_C(  92666741), UINT32_C( 259488719), UINT32_C(3382233166), UINT32_C(3321466359), UINT32_C(1305405645), UINT32_C(1352173441), UINT32_C( 368032028),
+      UINT32_C(3885465714), UINT32_C(1273764987), UINT32_C(3864683415), UINT32_C( 598733355), UINT32_C(1307093376), UINT32_C( 312194705), UINT32_C(1516385085), UINT32_C(1584353772),
+      UINT32_C(1296369361), UINT32_C(3130536227), UINT32_C(3231773332), UINT32_C(1709396197), UINT32_C(2326973433), UINT32_C(3214757250), UINT32_C(1813643136), UINT32_C( 583698513),
+      UINT32_C(2993622927), UINT32_C(3580626752), UINT32_C(3751087610), UINT32_C(1447327837), UINT32_C(3319854659), UINT32_C(3297082692), UINT32_C(3459358333), UINT32_C(3069246247),
+      UINT32_C(1265131531), UINT32_C(1629541479), UINT32_C(1044428257), UINT32_C(1905558573), UINT32_C(3208017275), UINT32_C(1870904306), UINT32_C(2168304730), UINT32_C(3140955824),
+      UINT32_C(4110851982), UINT32_C(1431775091), UINT32_C( 177444828), UINT32_C(2541430812), UINT32_C(2404823453), UINT32_C(3355433325), UINT32_C(1044921486), UINT32_C(4177100650),
+      UINT32_C(2448359198), UINT32_C(  65422630), UINT32_C(4161632988), UINT32_C(1066371234), UINT32_C(2798576953), UINT32_C(1299041727), UINT32_C(1955312906), UINT32_C(1382908980),
+      UINT32_C(2867092355), UINT32_C(2091764384), UINT32_C(3866475076), UINT32_C(2066023490), UINT32_C(2837640426), UINT32_C(3421933505), UINT32_C(2034270533), UINT32_C(2295115013),
+      UINT32_C(2821894152), UINT32_C(3206864762), UINT32_C(3685063065), UINT32_C(2287455134), UINT32_C(2150726079), UINT32_C(1296836360), UINT32_C(2915536040), UINT32_C(1094030137),
+      UINT32_C(3186190403), UINT32_C(3783003463), UINT32_C(1169957543), UINT32_C(2899121133), UINT32_C(2502753932), UINT32_C(3454171173), UINT32_C(1031448836), UINT32_C(2139008828),
+      UINT32_C(1597859607), UINT32_C( 474003829), UINT32_C(3361864923), UINT32_C(2624859664), UINT32_C(1362207020), UINT32_C( 505287705), UINT32_C(4200306877), UINT32_C(1601821255),
+      UINT32_C(3065951809), UINT32_C(1272118896), UINT32_C( 169096186), UINT32_C(2376566881), UINT32_C(1138677801), UINT32_C(2858548460), UINT32_C(3701783700), UINT32_C(3627752854),
+      UINT32_C(1150220756), UINT32_C(4052705783), UINT32_C(4143752084), UINT32_C(1434690348), UINT32_C(1754817147), UINT32_C(4078106974), UINT32_C(1288681142), UINT32_C(2804157139),
+      UINT32_C(4209750787), UINT32_C(2834004756), UINT32_C(1251927838), UINT32_C( 111157898), UINT32_C(3798874244), UINT32_C(3906306098), UINT32_C( 154444854), UINT32_C(2981190062),
+      UINT32_C( 548117516), UINT32_C( 919115543), UINT32_C( 159410046), UINT32_C( 219095177), UINT32_C(2347728217), UINT32_C( 863225341), UINT32_C( 406628201) };
+  static const uint32_t e[] =
+    { UINT32_C(         0), UINT32_C(3586038361), UINT32_C( 796102800), UINT32_C(4263585106), UINT32_C(         0), UINT32_C(         0), UINT32_C(2311891186), UINT32_C(1127302922),
+      UINT32_C(         0), UINT32_C(4292100895), UINT32_C(         0), UINT32_C( 403946888), UINT32_C(         0), UINT32_C(         0), UINT32_C(1974684219), UINT32_C(1550158027),
+      UINT32_C(         0), UINT32_C( 955724000), UINT32_C(         0), UINT32_C( 764743890), UINT32_C(         0), UINT32_C(2687698231), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(3629657145), UINT32_C(3387134066), UINT32_C(         0), UINT32_C( 888623232), UINT32_C(2158116280), UINT32_C(         0), UINT32_C(2994109249),
+      UINT32_C(         0), UINT32_C(3846417120), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 330952409), UINT32_C(4084829021),
+      UINT32_C(1022037160), UINT32_C(2301951380), UINT32_C(         0), UINT32_C(         0), UINT32_C(2280993178), UINT32_C(2852934849), UINT32_C(1870476760), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(3765184164), UINT32_C(2090715024), UINT32_C(4204372324), UINT32_C(         0), UINT32_C(3545705312), UINT32_C(1355179560), UINT32_C(1419633764),
+      UINT32_C(2922504048), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2192074484), UINT32_C( 695125008),
+      UINT32_C( 934758240), UINT32_C(1514213758), UINT32_C(4151066272), UINT32_C(3024571264), UINT32_C(1978928185), UINT32_C( 577490998), UINT32_C( 213150464), UINT32_C(4219798367),
+      UINT32_C(1241618552), UINT32_C(         0), UINT32_C(         0), UINT32_C(1521242072), UINT32_C(1519309718), UINT32_C(         0), UINT32_C( 591499834), UINT32_C(3976640848),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1261094207), UINT32_C(1158844880), UINT32_C(3465252224), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(3689611944), UINT32_C(4113948031), UINT32_C(         0), UINT32_C(2599467882), UINT32_C(3435691107), UINT32_C(         0), UINT32_C(3397933952), UINT32_C(         0),
+      UINT32_C(2355981392), UINT32_C( 701355264), UINT32_C(         0), UINT32_C(         0), UINT32_C(2442023868), UINT32_C(3528043244), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(2983130715), UINT32_C(         0), UINT32_C(  37663750), UINT32_C( 867366333), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3855716736), UINT32_C(         0), UINT32_C(         0), UINT32_C(3680866915), UINT32_C(         0), UINT32_C( 907692368),
+      UINT32_C(1475227688), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 217542528), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C( 302609080), UINT32_C(1154204738), UINT32_C(1731330446), UINT32_C(1584967396), UINT32_C(         0), UINT32_C(3641548027),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(3227858272), UINT32_C(         0), UINT32_C(4140938761), UINT32_C(         0), UINT32_C(3663917248), UINT32_C(2977950729),
+      UINT32_C(         0), UINT32_C( 804464394), UINT32_C(2506605686), UINT32_C(2172569753), UINT32_C(1079171652), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(1298447341), UINT32_C(4179228025), UINT32_C(1085874297), UINT32_C(3777274224), UINT32_C(         0), UINT32_C(         0), UINT32_C(2937283347), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(2708516096), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2889954648), UINT32_C(1352191032),
+      UINT32_C(         0), UINT32_C(2813433316), UINT32_C(         0), UINT32_C(2997640504), UINT32_C(         0), UINT32_C(2960356158), UINT32_C(1998289958), UINT32_C(4083352637),
+      UINT32_C( 504973481), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1592176530),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(2254965590), UINT32_C(         0), UINT32_C(2259937774), UINT32_C(         0), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_u32_z(pv, av, bv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+
+    ev = simde_svmul_u32_z(pv, av, bv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(3315148864), UINT32_C(3506756999), UINT32_C(2754281920), UINT32_C( 922918374), UINT32_C(2231252037), UINT32_C(  32348841), UINT32_C( 614812291), UINT32_C(1753743656),
+      UINT32_C(2955747625), UINT32_C(3212980735), UINT32_C( 409185586), UINT32_C(2404345162), UINT32_C(1125338777), UINT32_C(1799618792), UINT32_C(1922034250), UINT32_C( 366680299),
+      UINT32_C( 952436793), UINT32_C(1828144954), UINT32_C(1048927220), UINT32_C(1523438784), UINT32_C( 178118690), UINT32_C( 729145825), UINT32_C(3080586699), UINT32_C(1456240925),
+      UINT32_C(3146748289), UINT32_C(3441985241), UINT32_C(2718739937), UINT32_C(2768034177), UINT32_C(2611911098), UINT32_C(1187390586), UINT32_C(1191011369), UINT32_C(1604110813),
+      UINT32_C( 857353050), UINT32_C(2466333362), UINT32_C(1899302383), UINT32_C(2685743590), UINT32_C(1161544650), UINT32_C( 277545703), UINT32_C(1146521702), UINT32_C(2879648593),
+      UINT32_C(3504323870), UINT32_C(4016365568), UINT32_C(3546323437), UINT32_C(2507437515), UINT32_C( 551202617), UINT32_C( 405890481), UINT32_C(1046251501), UINT32_C(2582314874),
+      UINT32_C(3161049532), UINT32_C(2527907241), UINT32_C( 845745255), UINT32_C(3150437762), UINT32_C(1054581389), UINT32_C(4116057095), UINT32_C( 238269076), UINT32_C(1856445873),
+      UINT32_C(2401898982), UINT32_C(1160107742), UINT32_C(1702334435), UINT32_C(4179640172), UINT32_C(3896048609), UINT32_C(2631765512), UINT32_C(4071231809), UINT32_C( 358634030),
+      UINT32_C(1101302627), UINT32_C(1149749857), UINT32_C(3316252249), UINT32_C( 515885373), UINT32_C(3439851461), UINT32_C(3328828549), UINT32_C( 616109045), UINT32_C(3359185253),
+      UINT32_C( 101375396), UINT32_C(   4886951), UINT32_C(3452368015), UINT32_C(2196473277), UINT32_C(  22016636), UINT32_C(3435706583), UINT32_C( 837845452), UINT32_C(1073359258),
+      UINT32_C(2923758599), UINT32_C( 615485333), UINT32_C(1106343299), UINT32_C(1992547834), UINT32_C(2792821711), UINT32_C(2540912587), UINT32_C(1539924928), UINT32_C(2493170573),
+      UINT32_C(1547886535), UINT32_C(4068536686), UINT32_C(1613984358), UINT32_C( 517404239), UINT32_C(3586477577), UINT32_C(1315715213), UINT32_C( 682177947), UINT32_C(3216786424),
+      UINT32_C(2417753890), UINT32_C(1468177648), UINT32_C(1572320526), UINT32_C(3044773548), UINT32_C(1770668252), UINT32_C( 347600760), UINT32_C( 624713772), UINT32_C(3320117667),
+      UINT32_C(3897950456), UINT32_C(2856310940), UINT32_C( 973600654), UINT32_C(1643086469), UINT32_C(1003125443), UINT32_C(2639233649), UINT32_C(2260896994), UINT32_C(2102110085),
+      UINT32_C(1130733991), UINT32_C( 149792122), UINT32_C( 558036124), UINT32_C( 964833654), UINT32_C( 477449387), UINT32_C(2981807310), UINT32_C(3577183312), UINT32_C(3394404899),
+      UINT32_C(2651699236), UINT32_C(4188469853), UINT32_C(1696262382), UINT32_C(3315506201), UINT32_C(3084981224), UINT32_C( 677944280), UINT32_C(1006542616), UINT32_C(1158041633),
+      UINT32_C(1709380360), UINT32_C(4234053902), UINT32_C(2338420849), UINT32_C(4249878548), UINT32_C(3954454803), UINT32_C(3843300557), UINT32_C(3693089467), UINT32_C(1797400162),
+      UINT32_C(1221592378), UINT32_C(   4468623), UINT32_C(3163268775), UINT32_C(3115965350), UINT32_C(3668274445), UINT32_C(1153415561), UINT32_C( 757129163), UINT32_C(1083720198),
+      UINT32_C(3616041288), UINT32_C(1071107224), UINT32_C( 419128178), UINT32_C(1272099902), UINT32_C(2854582049), UINT32_C(4226737200), UINT32_C(3391623108), UINT32_C(2567618897),
+      UINT32_C(3262157354), UINT32_C(3506522206), UINT32_C(3924426155), UINT32_C(3543514033), UINT32_C(1652382258), UINT32_C(  56454207), UINT32_C(3436021371), UINT32_C(1902565191),
+      UINT32_C(3342063209), UINT32_C(3382195230), UINT32_C(3820192305), UINT32_C(1891035197), UINT32_C(2178036546), UINT32_C( 444870815), UINT32_C(4259795382), UINT32_C(2439925032),
+      UINT32_C(1113170211), UINT32_C( 118223317), UINT32_C(2984951411), UINT32_C(3911295142), UINT32_C(1936389075), UINT32_C(3649957667), UINT32_C(1775662144), UINT32_C(3858384065),
+      UINT32_C(3139916773), UINT32_C(3099734597), UINT32_C(2540285169), UINT32_C( 528517708), UINT32_C(2710760318), UINT32_C( 444276954), UINT32_C(1451446676), UINT32_C(2067496598),
+      UINT32_C( 372662993), UINT32_C(2244999316), UINT32_C(4028446884), UINT32_C(1091608003), UINT32_C(1659019912), UINT32_C(1467833794), UINT32_C(1168965807), UINT32_C(1354819710),
+      UINT32_C(3731289930), UINT32_C(2489595375), UINT32_C( 830767470), UINT32_C(2809304094), UINT32_C(4178138167), UINT32_C(1632667314), UINT32_C(  94829959), UINT32_C( 794126053),
+      UINT32_C(1292811357), UINT32_C(1608610545), UINT32_C( 294675955), UINT32_C( 834142970), UINT32_C( 153797207), UINT32_C(3479862088), UINT32_C(1591021688) };
+  static const uint32_t b[] =
+    { UINT32_C(4285348248), UINT32_C(3178302156), UINT32_C(1213213095), UINT32_C( 236779140), UINT32_C(1966183280), UINT32_C(3405186941), UINT32_C(4219269390), UINT32_C( 831710105),
+      UINT32_C(3895525404), UINT32_C(2997199370), UINT32_C(1358624460), UINT32_C(1549670124), UINT32_C( 651268265), UINT32_C(2784086423), UINT32_C(1403088314), UINT32_C(1837445969),
+      UINT32_C(1045870131), UINT32_C( 619772760), UINT32_C(3715492593), UINT32_C(2839139072), UINT32_C(4207872867), UINT32_C(2392899796), UINT32_C(2145468718), UINT32_C(2834065012),
+      UINT32_C(1978024476), UINT32_C( 798611006), UINT32_C(3222081216), UINT32_C(1164527330), UINT32_C( 624965713), UINT32_C( 666099961), UINT32_C(2510722337), UINT32_C( 406688507),
+      UINT32_C( 328016853), UINT32_C(3108120313), UINT32_C( 393826101), UINT32_C(3881624214), UINT32_C( 336436251), UINT32_C(2637938812), UINT32_C(1362354517), UINT32_C(1214869619),
+      UINT32_C(2371614356), UINT32_C(1363648028), UINT32_C(2204680429), UINT32_C(3194733987), UINT32_C(3738335329), UINT32_C(2390428984), UINT32_C(1642049262), UINT32_C(3014281247),
+      UINT32_C(1514145086), UINT32_C(2444003235), UINT32_C(3943961672), UINT32_C(1000964057), UINT32_C( 806976503), UINT32_C(1992201352), UINT32_C(1658297667), UINT32_C( 588612069),
+      UINT32_C( 712856967), UINT32_C( 633022941), UINT32_C( 386977854), UINT32_C(1196603727), UINT32_C(3161942836), UINT32_C(1127363840), UINT32_C(3081046482), UINT32_C( 316324491),
+      UINT32_C(3963377423), UINT32_C(3205625985), UINT32_C( 399909320), UINT32_C( 241052122), UINT32_C(2496320916), UINT32_C(3705142282), UINT32_C(2442361862), UINT32_C(1185115446),
+      UINT32_C(1177739205), UINT32_C(2667922647), UINT32_C(1085791077), UINT32_C(2572031236), UINT32_C(4113373675), UINT32_C( 466748693), UINT32_C(3098305921), UINT32_C(2566803411),
+      UINT32_C( 115224623), UINT32_C(3668370292), UINT32_C(3273285054), UINT32_C(1566337138), UINT32_C(2538834305), UINT32_C( 280110478), UINT32_C(1573412746), UINT32_C(3723871918),
+      UINT32_C(1810158582), UINT32_C(1967491766), UINT32_C(1496866791), UINT32_C(1236767943), UINT32_C(2900363805), UINT32_C(3116143151), UINT32_C(2685895921), UINT32_C(1081936970),
+      UINT32_C(2527814112), UINT32_C(3523997931), UINT32_C( 388776783), UINT32_C(4116767703), UINT32_C( 480329965), UINT32_C(3302317522), UINT32_C( 728034529), UINT32_C(3647726073),
+      UINT32_C( 779032387), UINT32_C(1459714823), UINT32_C(2523803070), UINT32_C(4253797904), UINT32_C(3759746062), UINT32_C(1789193865), UINT32_C(3566536923), UINT32_C( 766312682),
+      UINT32_C( 526064663), UINT32_C(1450597527), UINT32_C(2582439049), UINT32_C(3231086514), UINT32_C( 748728227), UINT32_C(2039891358), UINT32_C( 927804237), UINT32_C(1130691115),
+      UINT32_C(2925707286), UINT32_C(2785335324), UINT32_C(1849684156), UINT32_C( 170841703), UINT32_C( 590794373), UINT32_C(1637665811), UINT32_C( 580446711), UINT32_C(4200988131),
+      UINT32_C(3651717053), UINT32_C(1535093919), UINT32_C(  63553436), UINT32_C( 437122965), UINT32_C(3644736454), UINT32_C( 104520207), UINT32_C(2804470724), UINT32_C(2376175312),
+      UINT32_C(4117121365), UINT32_C(2437998325), UINT32_C( 982784677), UINT32_C(3612647697), UINT32_C(4088500964), UINT32_C( 838462317), UINT32_C(2396529342), UINT32_C(  85686960),
+      UINT32_C(3120202435), UINT32_C( 222972776), UINT32_C(1984421733), UINT32_C(1699650432), UINT32_C(2606300974), UINT32_C(2848740074), UINT32_C( 607626356), UINT32_C(3794359070),
+      UINT32_C(1033577685), UINT32_C(3561678191), UINT32_C(1162514884), UINT32_C(1521129516), UINT32_C(2197095063), UINT32_C(3358310740), UINT32_C(2230084198), UINT32_C(2321946293),
+      UINT32_C(2848391482), UINT32_C(2877100519), UINT32_C(3488663458), UINT32_C(4146698848), UINT32_C(4051247005), UINT32_C(1186637024), UINT32_C(3167462919), UINT32_C(4131860924),
+      UINT32_C( 446631475), UINT32_C(3267697696), UINT32_C(1150400228), UINT32_C(3980114768), UINT32_C(3135223258), UINT32_C(1610717529), UINT32_C(4229811263), UINT32_C( 821191933),
+      UINT32_C(2454360690), UINT32_C(2455048366), UINT32_C( 383182534), UINT32_C(2063864481), UINT32_C( 540468167), UINT32_C(3145807740), UINT32_C(  12033539), UINT32_C(1949411842),
+      UINT32_C(3926358844), UINT32_C(1367170187), UINT32_C(3832042306), UINT32_C( 744451173), UINT32_C(3410859343), UINT32_C(3481718476), UINT32_C(1859141228), UINT32_C( 618791400),
+      UINT32_C( 135195004), UINT32_C(2287569733), UINT32_C(1147978207), UINT32_C(2087832365), UINT32_C( 759676513), UINT32_C(4177383052), UINT32_C(4100377868), UINT32_C(1243105486),
+      UINT32_C(2001872434), UINT32_C(2449452210), UINT32_C(2614455149), UINT32_C(2551662135), UINT32_C(2428854020), UINT32_C( 965263917), UINT32_C(1563291279) };
+  static const uint32_t e[] =
+    { UINT32_C(1344677376), UINT32_C(3506756999), UINT32_C(2270553152), UINT32_C(3124522648), UINT32_C(2231252037), UINT32_C(  55452549), UINT32_C( 614688298), UINT32_C(1753743656),
+      UINT32_C(2955747625), UINT32_C(3212980735), UINT32_C( 409185586), UINT32_C(2404345162), UINT32_C(  81654529), UINT32_C(1799618792), UINT32_C(3655056324), UINT32_C( 366680299),
+      UINT32_C(4097780059), UINT32_C(1828144954), UINT32_C(1048927220), UINT32_C(1523438784), UINT32_C( 178118690), UINT32_C(1638387284), UINT32_C(3080586699), UINT32_C(2074373924),
+      UINT32_C( 907881500), UINT32_C(4282060430), UINT32_C(3480336064), UINT32_C(2768034177), UINT32_C(3294581722), UINT32_C(1187390586), UINT32_C(1904985673), UINT32_C(4219663791),
+      UINT32_C( 857353050), UINT32_C(2466333362), UINT32_C(3728712571), UINT32_C(2685743590), UINT32_C(1910423118), UINT32_C( 277545703), UINT32_C( 820965342), UINT32_C(1767030115),
+      UINT32_C(3504323870), UINT32_C(2437447680), UINT32_C(3546323437), UINT32_C(2507437515), UINT32_C( 532749465), UINT32_C(3607313336), UINT32_C(1046251501), UINT32_C(2958245830),
+      UINT32_C(3161049532), UINT32_C(2527907241), UINT32_C(3884943608), UINT32_C(3150437762), UINT32_C(1054581389), UINT32_C(4116057095), UINT32_C( 238269076), UINT32_C(1856445873),
+      UINT32_C(4033793610), UINT32_C(3409841062), UINT32_C(1702334435), UINT32_C(4179640172), UINT32_C(1316041908), UINT32_C(2631765512), UINT32_C(4071231809), UINT32_C( 358634030),
+      UINT32_C(1101302627), UINT32_C(3823891169), UINT32_C(3316252249), UINT32_C( 552739570), UINT32_C(3439851461), UINT32_C( 885578034), UINT32_C(3165660094), UINT32_C(3359185253),
+      UINT32_C(1064725300), UINT32_C(   4886951), UINT32_C(4109226347), UINT32_C(2196473277), UINT32_C(1323152340), UINT32_C(3435706583), UINT32_C(3799442380), UINT32_C(2765279214),
+      UINT32_C(2923758599), UINT32_C( 615485333), UINT32_C(1630785082), UINT32_C(1992547834), UINT32_C(2792821711), UINT32_C(2540912587), UINT32_C(3834905984), UINT32_C(2493170573),
+      UINT32_C(1089474106), UINT32_C(1115090996), UINT32_C(1613984358), UINT32_C(3640140649), UINT32_C(1078341893), UINT32_C(1315715213), UINT32_C( 682177947), UINT32_C(1874019760),
+      UINT32_C( 199303104), UINT32_C(1716981840), UINT32_C(1572320526), UINT32_C(3044773548), UINT32_C(1770668252), UINT32_C( 347600760), UINT32_C(1474893484), UINT32_C(1027609227),
+      UINT32_C(3897950456), UINT32_C( 829284420), UINT32_C( 973600654), UINT32_C( 691416656), UINT32_C(2939632298), UINT32_C(2639233649), UINT32_C(2260896994), UINT32_C( 487071634),
+      UINT32_C(3677145601), UINT32_C( 149792122), UINT32_C( 558036124), UINT32_C(4238884364), UINT32_C( 477449387), UINT32_C(2981807310), UINT32_C(3577183312), UINT32_C(2375944673),
+      UINT32_C(2651699236), UINT32_C(1760942636), UINT32_C(1696262382), UINT32_C(3315506201), UINT32_C(3084981224), UINT32_C( 677944280), UINT32_C(1203263528), UINT32_C(1158041633),
+      UINT32_C(  28329192), UINT32_C(4234053902), UINT32_C(2348463068), UINT32_C(2829539236), UINT32_C(3954454803), UINT32_C(3843300557), UINT32_C(3693089467), UINT32_C( 447450016),
+      UINT32_C(1221592378), UINT32_C(   4468623), UINT32_C(3163268775), UINT32_C(3035823110), UINT32_C(3498281364), UINT32_C(4097032789), UINT32_C( 757129163), UINT32_C(1083720198),
+      UINT32_C(3616041288), UINT32_C(1071107224), UINT32_C( 419128178), UINT32_C(1272099902), UINT32_C(2854582049), UINT32_C(4226737200), UINT32_C( 928822480), UINT32_C(3823692414),
+      UINT32_C( 497386738), UINT32_C(2289465026), UINT32_C(3924426155), UINT32_C(3543514033), UINT32_C(3363739518), UINT32_C(  56454207), UINT32_C(2898438914), UINT32_C(1902565191),
+      UINT32_C(1379138762), UINT32_C(3382195230), UINT32_C(3820192305), UINT32_C(1494272224), UINT32_C(1850764666), UINT32_C( 444870815), UINT32_C(1671512058), UINT32_C(3218952544),
+      UINT32_C(1113170211), UINT32_C(3000665760), UINT32_C(3281674348), UINT32_C(3911295142), UINT32_C(1936389075), UINT32_C(3649957667), UINT32_C(1775662144), UINT32_C( 967005885),
+      UINT32_C(2676880890), UINT32_C(3255532262), UINT32_C(2540285169), UINT32_C( 528517708), UINT32_C(1285146866), UINT32_C( 444276954), UINT32_C(1451446676), UINT32_C(2872875308),
+      UINT32_C( 334533628), UINT32_C(2244999316), UINT32_C(1938146888), UINT32_C(3178856943), UINT32_C( 661737464), UINT32_C(2330251928), UINT32_C( 190229460), UINT32_C(3874959408),
+      UINT32_C(3731289930), UINT32_C(2489595375), UINT32_C( 830767470), UINT32_C(2809304094), UINT32_C(1330297559), UINT32_C(2455168344), UINT32_C(  94829959), UINT32_C(4079039558),
+      UINT32_C(3449853994), UINT32_C( 587913106), UINT32_C(3376871799), UINT32_C( 834142970), UINT32_C(2143048284), UINT32_C(2909027240), UINT32_C(2339095304) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i])),
+      bv = simde_svld1_u32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_u32_m(pv, av, bv);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+    bv = simde_svld1_u32(pg, &(b[i]));
+
+    ev = simde_svmul_u32_m(pv, av, bv);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C( 2600278872850380235), UINT64_C( 6868361934881512170), UINT64_C(13175731946460227887), UINT64_C(16049252454097401343),
+      UINT64_C(16400872864225685147), UINT64_C( 9880433978295978228), UINT64_C( 4584408513228220035), UINT64_C(12303277897280170444),
+      UINT64_C(15047015487095522036), UINT64_C(13233737568925768388), UINT64_C(14543037975767344468), UINT64_C( 1919209803996536808),
+      UINT64_C( 4852304790254306217), UINT64_C(16690069274905142707), UINT64_C( 7400626394700136430), UINT64_C( 7975032458940669293),
+      UINT64_C( 4793881203750188484), UINT64_C(16188972755501836591), UINT64_C(16279526891475117319), UINT64_C( 1157180237972523740),
+      UINT64_C( 8910331508939817686), UINT64_C(11571972414925295812), UINT64_C(13718548178962637325), UINT64_C(14967835375821641564),
+      UINT64_C(12409910561577634929), UINT64_C( 7702836916661679531), UINT64_C( 8789985360725347164), UINT64_C( 4318065604836809764),
+      UINT64_C(11995672940528541925), UINT64_C( 3561732493632330662), UINT64_C(14587559028611569883), UINT64_C( 5966657544610354119),
+      UINT64_C(11282811152794371827), UINT64_C( 3060490956435324787), UINT64_C( 2005390822754936932), UINT64_C( 9360023252852652839),
+      UINT64_C( 1212598169149310017), UINT64_C(16500576060482024323), UINT64_C(15720591523595558842), UINT64_C(10631964432159135613),
+      UINT64_C( 9368789046509960024), UINT64_C(16823004197826092306), UINT64_C(11961316691133621617), UINT64_C( 1792219072846458361),
+      UINT64_C( 6681672003328256569), UINT64_C(15098147741423767150), UINT64_C(11139922654720786379), UINT64_C(13851601887639783777),
+      UINT64_C(14345849761493960560), UINT64_C( 3887147893951628480), UINT64_C( 4442450129481951083), UINT64_C(14074198894709804298),
+      UINT64_C(13475214267296598497), UINT64_C(13634592149006476952), UINT64_C( 3012187006656143284), UINT64_C(11966921576944381181),
+      UINT64_C(13550172549461086548), UINT64_C( 7591087327988868936), UINT64_C(10348645851097277012), UINT64_C(13285322460890093810),
+      UINT64_C( 7594214803120799363), UINT64_C( 7860852935666967545), UINT64_C(14456412786753867902), UINT64_C(17650413368000872150),
+      UINT64_C(  406732493415053596), UINT64_C( 9559393812207610148), UINT64_C(16102677683885148890) };
+  static const uint64_t b[] =
+    { UINT64_C(15772123671713367022), UINT64_C( 5090390335396106432), UINT64_C(11854219432241601241), UINT64_C(14036193728067456493),
+      UINT64_C( 7105529722339642327), UINT64_C( 9514491567790880954), UINT64_C(16701163786315257181), UINT64_C( 4023643423290477632),
+      UINT64_C( 9415500459381677733), UINT64_C(16914201392967993739), UINT64_C( 6883984163218435238), UINT64_C( 1672605069875583135),
+      UINT64_C( 5580252141838085671), UINT64_C(12594948615237318482), UINT64_C( 5289995258834114283), UINT64_C( 5618380335798082670),
+      UINT64_C(12879360763579094957), UINT64_C( 7717864088798380133), UINT64_C(12620739000445266482), UINT64_C(11109966782235897275),
+      UINT64_C( 9147309026076879582), UINT64_C( 1292260274667750149), UINT64_C(18401728163688047985), UINT64_C( 6198657843212644480),
+      UINT64_C(15640867178902982521), UINT64_C( 8356795258429700872), UINT64_C( 8788359031483066034), UINT64_C( 6792251660294280821),
+      UINT64_C( 7325667043002275835), UINT64_C(  535723116287756282), UINT64_C(10204862190221955884), UINT64_C( 7714028924626961354),
+      UINT64_C(17750345281364032915), UINT64_C( 1389468130915557868), UINT64_C(  403870661421319924), UINT64_C( 7220610308869723225),
+      UINT64_C( 4589635672357498815), UINT64_C(17889926114663506763), UINT64_C(12416318977268350223), UINT64_C( 9577654223369470900),
+      UINT64_C( 3723334397991009816), UINT64_C(  328950744581745811), UINT64_C(16872345907000939815), UINT64_C( 6839658613698436257),
+      UINT64_C(12588534144415967896), UINT64_C(16833284163460536481), UINT64_C( 2921579998901168491), UINT64_C(17062302066758580773),
+      UINT64_C(12280505881340973988), UINT64_C(17717965269667722039), UINT64_C(17614741212484748741), UINT64_C( 2331501747003916827),
+      UINT64_C( 2120435553573783483), UINT64_C( 5656231451618094592), UINT64_C( 5836680738079642685), UINT64_C( 4804527745998544657),
+      UINT64_C(15629588406752087267), UINT64_C( 3817329509198396961), UINT64_C(12933001820162266101), UINT64_C( 4280932408670305439),
+      UINT64_C(   84141090747542905), UINT64_C( 6995679483251166443), UINT64_C( 3786691201886606648), UINT64_C( 3735668522653240643),
+      UINT64_C(12975626754508315696), UINT64_C(11171648795171012155), UINT64_C(16198044455842256129) };
+  static const uint64_t e[] =
+    { UINT64_C( 7048984330193544122), UINT64_C(17680050821945118592), UINT64_C(10879553760167046871), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 5441335130089847959), UINT64_C(                   0),
+      UINT64_C( 3926757691818491716), UINT64_C( 2039695557640170604), UINT64_C( 5175966036152362104), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 8317268378332472186), UINT64_C( 2570509919467720918),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 1591898643914645460), UINT64_C(                   0), UINT64_C( 4276309310772997632),
+      UINT64_C(                   0), UINT64_C(17734765907013293656), UINT64_C( 2825291132648459768), UINT64_C(                   0),
+      UINT64_C(10485034739402249095), UINT64_C(11207987758572112412), UINT64_C(                   0), UINT64_C( 1499112098828873734),
+      UINT64_C(                   0), UINT64_C( 7297783763648827652), UINT64_C(10981630729505527632), UINT64_C( 7005260207721880719),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(12020529517120695782), UINT64_C(                   0),
+      UINT64_C( 3078370067971760192), UINT64_C( 6572810004066896214), UINT64_C(12178440438370285879), UINT64_C(14958755130299704729),
+      UINT64_C(13922130113417472984), UINT64_C(                   0), UINT64_C( 7833847825500548313), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 5944112265573428311), UINT64_C( 1853535157490021390),
+      UINT64_C(14546892375104544347), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 3037533790396145613),
+      UINT64_C(11061261594875841916), UINT64_C(                   0), UINT64_C( 4570021568765498980), UINT64_C(  896118751522518606),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 4759295475596178252), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_u64_z(pv, av, bv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+
+    ev = simde_svmul_u64_z(pv, av, bv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C( 1870425706147961359), UINT64_C( 1922445581945713667), UINT64_C( 7505187580401566346), UINT64_C(18428491010405198775),
+      UINT64_C(10294953371073803393), UINT64_C( 3811864610567996602), UINT64_C(16823321963094829497), UINT64_C(14901335079244408797),
+      UINT64_C(11221691407004916898), UINT64_C(12976927695033566264), UINT64_C(12885146894019617463), UINT64_C( 1116694167112597347),
+      UINT64_C(13881492115088479271), UINT64_C( 1164947247522253691), UINT64_C(10277999589688208923), UINT64_C(10630394443032633610),
+      UINT64_C( 3754664779681874643), UINT64_C(10571590410162650443), UINT64_C( 9402711698852458180), UINT64_C( 5711830400951237957),
+      UINT64_C( 7651551033065922625), UINT64_C( 8326246071178091138), UINT64_C( 8677838570593062514), UINT64_C( 2839641499600840349),
+      UINT64_C( 6474014450052633166), UINT64_C( 2111871204478674731), UINT64_C( 3285786665016668397), UINT64_C( 9289147235147629531),
+      UINT64_C( 9795828765495790528), UINT64_C( 1186609593193677998), UINT64_C(14924589368503009120), UINT64_C(15221738015779021965),
+      UINT64_C(11630648240213011589), UINT64_C(15696013894109284768), UINT64_C( 6608161429047018736), UINT64_C( 4914087722372187468),
+      UINT64_C(11032004864822844805), UINT64_C( 8478079649792660310), UINT64_C(11915977439540048436), UINT64_C( 6221221306348894291),
+      UINT64_C( 6802659787181816788), UINT64_C( 2951501476405363962), UINT64_C(12702273408779112264), UINT64_C( 6280578109817375746),
+      UINT64_C(15706741162656528275), UINT64_C( 5074798109596854097), UINT64_C( 2713753181542193564), UINT64_C( 1609511867162127228),
+      UINT64_C( 6544199792861477914), UINT64_C( 1447639513963637458), UINT64_C(12389041040790519717), UINT64_C( 2574934227911632674),
+      UINT64_C(16996845687576227453), UINT64_C( 3576935125427715863), UINT64_C( 9992897577822564562), UINT64_C(15491235213894244558),
+      UINT64_C( 2044418749957412698), UINT64_C(13868640362805533627), UINT64_C( 2877923686873199103), UINT64_C( 7491731439465996488),
+      UINT64_C( 5346681568873894674), UINT64_C( 3171387553099079509), UINT64_C(18372578951325533817), UINT64_C(  295011007202326436),
+      UINT64_C( 9386150532736611177), UINT64_C( 6019001366683701805), UINT64_C( 4810721394711403151), UINT64_C( 6992696006336045589),
+      UINT64_C(11722759278331242239), UINT64_C(14743523203879892077), UINT64_C(17545835986751176863), UINT64_C( 8975398617589903926),
+      UINT64_C(17384273358969497643), UINT64_C( 7122113794888253132), UINT64_C(17538739593583487125), UINT64_C(10415332135817797776),
+      UINT64_C( 6273076173277705113), UINT64_C(12741870936272226223), UINT64_C( 2400288383820854176), UINT64_C(13537461086914048489),
+      UINT64_C( 3372886606092963564), UINT64_C(  646677112276725805), UINT64_C(10420402264939437545), UINT64_C( 8071221858040466213),
+      UINT64_C(17255741814060080075), UINT64_C( 8670891149117364709), UINT64_C(10630059102701795918), UINT64_C(16955450205838926681),
+      UINT64_C(14945387685508101303), UINT64_C( 2363953097834602695), UINT64_C(12190569433040011564), UINT64_C(11171694426898958333),
+      UINT64_C(13025110433719402248), UINT64_C( 9083436444362202908), UINT64_C(13444167094121276314), UINT64_C(17784120011927329101),
+      UINT64_C( 8845819939062866209), UINT64_C( 4708925348705258889), UINT64_C(  365282739427701145), UINT64_C(17058232187317840344),
+      UINT64_C(15617847226636346597), UINT64_C( 3923493565358089866), UINT64_C( 3835551056315326077), UINT64_C( 6431059403632963719),
+      UINT64_C( 9331557343837305178), UINT64_C(13642007174253261695), UINT64_C(  240428541768031940), UINT64_C( 6947246653960442012),
+      UINT64_C(16016358694216861134), UINT64_C(16265115220907325629), UINT64_C( 8406629337683634987), UINT64_C( 7066410137711607721),
+      UINT64_C( 6859383151880706547), UINT64_C(11773277458187168612), UINT64_C( 7425578985063081409), UINT64_C( 8280191719066472947),
+      UINT64_C(16159467954222993471), UINT64_C( 8375785682653781281), UINT64_C( 7948599883002054186), UINT64_C(14671566004181886378),
+      UINT64_C( 8668285062257402095), UINT64_C(11219397345006431372) };
+  static const uint64_t b[] =
+    { UINT64_C( 9290600151534102026), UINT64_C(18149721522448950623), UINT64_C(18011028027340740917), UINT64_C(  907033326424109945),
+      UINT64_C( 3382819937642018773), UINT64_C(13736335696449553941), UINT64_C( 7036359741856538909), UINT64_C(15955174894846974559),
+      UINT64_C(17591132570313010723), UINT64_C(16595267409512399879), UINT64_C( 1181415009215022364), UINT64_C( 5240744271080913620),
+      UINT64_C( 5935281738383755659), UINT64_C( 5804631067673753823), UINT64_C( 3420687719231398327), UINT64_C( 5846172344339196083),
+      UINT64_C(10839348148073880527), UINT64_C( 4077108418244923409), UINT64_C( 6086641977395308781), UINT64_C( 1880057452509889537),
+      UINT64_C(18227934574132122281), UINT64_C(17126016205916812529), UINT64_C( 7328675339267624126), UINT64_C(15607298379911848243),
+      UINT64_C( 6917017127689440278), UINT64_C(15154751372124110690), UINT64_C( 7607958786618328778), UINT64_C( 1859563351154606279),
+      UINT64_C(10959818886712330059), UINT64_C( 3692752036127501144), UINT64_C( 2193242397182423505), UINT64_C( 2437541230898599606),
+      UINT64_C( 6897248566265966313), UINT64_C(14806721753556693471), UINT64_C(10011576552993840763), UINT64_C(15028537139795264665),
+      UINT64_C( 4425532506702309892), UINT64_C(13556117729169454680), UINT64_C(15077347004718707935), UINT64_C(11257821042283938179),
+      UINT64_C( 3014336217012972090), UINT64_C( 4342770060956097352), UINT64_C(15391945985084085138), UINT64_C(16564656879976897454),
+      UINT64_C(16401920295079676325), UINT64_C( 5568613777368882350), UINT64_C( 1273025986532161155), UINT64_C(  800858316129954445),
+      UINT64_C(11330812499420355521), UINT64_C(16016470828105902909), UINT64_C(11212658014290140198), UINT64_C(17057647654761394760),
+      UINT64_C(10959659619697834636), UINT64_C(15450959375884140851), UINT64_C(14184926487414578993), UINT64_C( 3027310233009696237),
+      UINT64_C(  529381677662030948), UINT64_C(17223174266302097534), UINT64_C( 5575748124203246880), UINT64_C( 7097506975027942327),
+      UINT64_C( 6957913958869181620), UINT64_C( 4976359000448640098), UINT64_C(18422048253800496890), UINT64_C( 3059584021657029910),
+      UINT64_C( 8230400959142074359), UINT64_C( 6255959875773450086), UINT64_C(  875766466814718944), UINT64_C( 4973545529416907621),
+      UINT64_C( 6966882777037715244), UINT64_C(14182044015602188830), UINT64_C( 4500244851634045041), UINT64_C( 6207119351592096912),
+      UINT64_C(13127784662893282006), UINT64_C( 5344929266514533252), UINT64_C(13733767944686606977), UINT64_C(11977817786884666041),
+      UINT64_C(10615728753822059523), UINT64_C(  352451216547742401), UINT64_C( 8372181517226382658), UINT64_C(10385178203040238760),
+      UINT64_C(18230147135308600668), UINT64_C( 7243892814303918336), UINT64_C( 9529341782393218319), UINT64_C( 9506849393353791185),
+      UINT64_C(11162713297280441266), UINT64_C(  679100132827693030), UINT64_C( 1795548974314373770), UINT64_C(13282073000715741353),
+      UINT64_C( 1492537754731758210), UINT64_C(  221109005343052558), UINT64_C(11541130415232902347), UINT64_C(10086588759986446909),
+      UINT64_C( 4415881891965018117), UINT64_C(13379164176053003569), UINT64_C(12092997785910711867), UINT64_C(  805269146218152599),
+      UINT64_C( 7129628332634657668), UINT64_C(14453098548550121196), UINT64_C(16996809655801503438), UINT64_C( 3683584603027458574),
+      UINT64_C(15068718784944954763), UINT64_C(12710072815876581902), UINT64_C( 4025593724433620382), UINT64_C(12498730457410202002),
+      UINT64_C( 4647020141721770694), UINT64_C(  451554481538804146), UINT64_C( 9798661765334576283), UINT64_C( 8434745871774008639),
+      UINT64_C(12756901141420210071), UINT64_C(13633954226849047750), UINT64_C( 4842068908875787958), UINT64_C(14908518092662700993),
+      UINT64_C( 7627867016519943466), UINT64_C( 6945622282670186628), UINT64_C( 2468884503256098044), UINT64_C(14140871385187280952),
+      UINT64_C(18125239684508341884), UINT64_C(17001939544785887721), UINT64_C( 8389132141885914857), UINT64_C(17399133198795210263),
+      UINT64_C( 1615272936293360889), UINT64_C(18056792455208635579) };
+  static const uint64_t e[] =
+    { UINT64_C( 1870425706147961359), UINT64_C( 1922445581945713667), UINT64_C( 2052815961749504146), UINT64_C(18428491010405198775),
+      UINT64_C( 5133613004698117717), UINT64_C( 3811864610567996602), UINT64_C(  383930175415751413), UINT64_C(14901335079244408797),
+      UINT64_C(17438579604126058022), UINT64_C( 8765599190793420168), UINT64_C(12885146894019617463), UINT64_C( 1116694167112597347),
+      UINT64_C( 8617270135971532845), UINT64_C( 1164947247522253691), UINT64_C(18036899806960857165), UINT64_C(14254218759581280766),
+      UINT64_C( 3754664779681874643), UINT64_C(10571590410162650443), UINT64_C(11258044465922534260), UINT64_C(  622051439756333381),
+      UINT64_C( 6779915481935994089), UINT64_C( 8326246071178091138), UINT64_C( 8677838570593062514), UINT64_C( 1157833655224004167),
+      UINT64_C( 6474014450052633166), UINT64_C(14091582030735741814), UINT64_C( 3285786665016668397), UINT64_C(15214022943458950973),
+      UINT64_C( 2233469447355478336), UINT64_C(15039050257900459472), UINT64_C(14924589368503009120), UINT64_C(17339848559954549310),
+      UINT64_C(11630648240213011589), UINT64_C(15696013894109284768), UINT64_C( 6608161429047018736), UINT64_C( 4914087722372187468),
+      UINT64_C(12197543698107107348), UINT64_C( 8478079649792660310), UINT64_C( 2796108568946477900), UINT64_C( 6221221306348894291),
+      UINT64_C(13233629839399114248), UINT64_C( 2951501476405363962), UINT64_C(12702273408779112264), UINT64_C( 8358533739996077916),
+      UINT64_C(15449314091466767551), UINT64_C(11141862372481864974), UINT64_C( 2713753181542193564), UINT64_C( 1609511867162127228),
+      UINT64_C( 6544199792861477914), UINT64_C(15543436876581403146), UINT64_C(12389041040790519717), UINT64_C( 2574934227911632674),
+      UINT64_C(16996845687576227453), UINT64_C( 5576660857922627733), UINT64_C( 6255183162049316402), UINT64_C(14642256733771230390),
+      UINT64_C( 2164798411804104488), UINT64_C(14387493148457704970), UINT64_C(11296713837158914784), UINT64_C( 7491731439465996488),
+      UINT64_C( 5346681568873894674), UINT64_C(  293512381111759498), UINT64_C(18372578951325533817), UINT64_C(  295011007202326436),
+      UINT64_C(12023745769800255823), UINT64_C( 6019001366683701805), UINT64_C(17795676887823497760), UINT64_C( 6992696006336045589),
+      UINT64_C(11722759278331242239), UINT64_C(14743523203879892077), UINT64_C( 9208994927396554287), UINT64_C(16910130090303387232),
+      UINT64_C(10647334171540990450), UINT64_C( 7122113794888253132), UINT64_C(17538739593583487125), UINT64_C(18314767767180601360),
+      UINT64_C( 6273076173277705113), UINT64_C(16792495656203905263), UINT64_C(12105608764538744640), UINT64_C(13537461086914048489),
+      UINT64_C( 3372886606092963564), UINT64_C( 6923131799748592896), UINT64_C(17641892076599389607), UINT64_C( 3904079160061757237),
+      UINT64_C(15427799229680008230), UINT64_C( 8670891149117364709), UINT64_C( 3256093896818199052), UINT64_C( 5657765477914721729),
+      UINT64_C(17924020037774930670), UINT64_C( 2363953097834602695), UINT64_C(12081977267846602212), UINT64_C( 8402025047525294409),
+      UINT64_C( 6423164879225633576), UINT64_C( 9083436444362202908), UINT64_C( 9996891383400329342), UINT64_C( 7774816707786229355),
+      UINT64_C( 8845819939062866209), UINT64_C( 7038321387397406796), UINT64_C(  365282739427701145), UINT64_C(12178328181084076496),
+      UINT64_C(14019758769970133335), UINT64_C( 3923493565358089866), UINT64_C(18063792153496468006), UINT64_C(17399999923851725822),
+      UINT64_C( 9331557343837305178), UINT64_C(11331972873340069198), UINT64_C( 4675902342920835244), UINT64_C( 6947246653960442012),
+      UINT64_C(16016358694216861134), UINT64_C(10607672478884279854), UINT64_C( 8406629337683634987), UINT64_C( 5493747834789523817),
+      UINT64_C(11852615047305429214), UINT64_C(11773277458187168612), UINT64_C(10994232075177364988), UINT64_C( 8280191719066472947),
+      UINT64_C(16159467954222993471), UINT64_C(  159605833533637641), UINT64_C( 7948599883002054186), UINT64_C(14671566004181886378),
+      UINT64_C(17259676876979283063), UINT64_C(11219397345006431372) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i])),
+      bv = simde_svld1_u64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_u64_m(pv, av, bv);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+    bv = simde_svld1_u64(pg, &(b[i]));
+
+    ev = simde_svmul_u64_m(pv, av, bv);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(    77.27), SIMDE_FLOAT32_C(    43.85), SIMDE_FLOAT32_C(    63.13), SIMDE_FLOAT32_C(   -16.35),
+      SIMDE_FLOAT32_C(    71.05), SIMDE_FLOAT32_C(   -96.43), SIMDE_FLOAT32_C(    48.80), SIMDE_FLOAT32_C(    60.82),
+      SIMDE_FLOAT32_C(   -48.86), SIMDE_FLOAT32_C(    98.66), SIMDE_FLOAT32_C(   -85.81), SIMDE_FLOAT32_C(    11.06),
+      SIMDE_FLOAT32_C(   -77.13), SIMDE_FLOAT32_C(    70.33), SIMDE_FLOAT32_C(   -87.36), SIMDE_FLOAT32_C(    61.16),
+      SIMDE_FLOAT32_C(   -39.86), SIMDE_FLOAT32_C(   -16.69), SIMDE_FLOAT32_C(   -76.25), SIMDE_FLOAT32_C(    -1.12),
+      SIMDE_FLOAT32_C(    41.54), SIMDE_FLOAT32_C(    -6.73), SIMDE_FLOAT32_C(    48.48), SIMDE_FLOAT32_C(     2.55),
+      SIMDE_FLOAT32_C(   -22.20), SIMDE_FLOAT32_C(   -55.02), SIMDE_FLOAT32_C(   -78.28), SIMDE_FLOAT32_C(   -57.41),
+      SIMDE_FLOAT32_C(   -51.30), SIMDE_FLOAT32_C(     3.56), SIMDE_FLOAT32_C(    23.59), SIMDE_FLOAT32_C(   -74.03),
+      SIMDE_FLOAT32_C(   -52.60), SIMDE_FLOAT32_C(   -13.28), SIMDE_FLOAT32_C(     9.62), SIMDE_FLOAT32_C(   -81.55),
+      SIMDE_FLOAT32_C(    -9.71), SIMDE_FLOAT32_C(   -41.58), SIMDE_FLOAT32_C(    79.27), SIMDE_FLOAT32_C(    41.43),
+      SIMDE_FLOAT32_C(   -42.92), SIMDE_FLOAT32_C(    93.46), SIMDE_FLOAT32_C(   -47.51), SIMDE_FLOAT32_C(   -20.04),
+      SIMDE_FLOAT32_C(    63.80), SIMDE_FLOAT32_C(   -34.88), SIMDE_FLOAT32_C(   -58.89), SIMDE_FLOAT32_C(   -76.06),
+      SIMDE_FLOAT32_C(    48.44), SIMDE_FLOAT32_C(   -35.14), SIMDE_FLOAT32_C(    22.82), SIMDE_FLOAT32_C(   -10.02),
+      SIMDE_FLOAT32_C(    58.13), SIMDE_FLOAT32_C(   -28.70), SIMDE_FLOAT32_C(    92.53), SIMDE_FLOAT32_C(   -64.07),
+      SIMDE_FLOAT32_C(    16.28), SIMDE_FLOAT32_C(   -85.75), SIMDE_FLOAT32_C(   -21.48), SIMDE_FLOAT32_C(    64.98),
+      SIMDE_FLOAT32_C(    17.81), SIMDE_FLOAT32_C(   -97.90), SIMDE_FLOAT32_C(    90.95), SIMDE_FLOAT32_C(    65.21),
+      SIMDE_FLOAT32_C(   -11.18), SIMDE_FLOAT32_C(     0.57), SIMDE_FLOAT32_C(    83.66), SIMDE_FLOAT32_C(    79.11),
+      SIMDE_FLOAT32_C(    58.99), SIMDE_FLOAT32_C(    62.94), SIMDE_FLOAT32_C(    20.54), SIMDE_FLOAT32_C(   -83.93),
+      SIMDE_FLOAT32_C(    56.40), SIMDE_FLOAT32_C(    73.02), SIMDE_FLOAT32_C(    -3.97), SIMDE_FLOAT32_C(    20.19),
+      SIMDE_FLOAT32_C(   -61.85), SIMDE_FLOAT32_C(    37.14), SIMDE_FLOAT32_C(    44.13), SIMDE_FLOAT32_C(    86.58),
+      SIMDE_FLOAT32_C(   -97.99), SIMDE_FLOAT32_C(   -33.05), SIMDE_FLOAT32_C(   -23.44), SIMDE_FLOAT32_C(    60.14),
+      SIMDE_FLOAT32_C(    38.24), SIMDE_FLOAT32_C(   -30.91), SIMDE_FLOAT32_C(    96.07), SIMDE_FLOAT32_C(   -45.48),
+      SIMDE_FLOAT32_C(   -16.66), SIMDE_FLOAT32_C(   -25.42), SIMDE_FLOAT32_C(   -80.50), SIMDE_FLOAT32_C(   -98.86),
+      SIMDE_FLOAT32_C(   -23.31), SIMDE_FLOAT32_C(   -89.55), SIMDE_FLOAT32_C(    66.35), SIMDE_FLOAT32_C(    65.51),
+      SIMDE_FLOAT32_C(    11.01), SIMDE_FLOAT32_C(    50.01), SIMDE_FLOAT32_C(    44.61), SIMDE_FLOAT32_C(   -30.00),
+      SIMDE_FLOAT32_C(    12.95), SIMDE_FLOAT32_C(   -34.85), SIMDE_FLOAT32_C(   -13.92), SIMDE_FLOAT32_C(   -30.65),
+      SIMDE_FLOAT32_C(   -61.83), SIMDE_FLOAT32_C(    82.11), SIMDE_FLOAT32_C(    89.54), SIMDE_FLOAT32_C(   -23.68),
+      SIMDE_FLOAT32_C(    19.25), SIMDE_FLOAT32_C(    33.67), SIMDE_FLOAT32_C(   -37.10), SIMDE_FLOAT32_C(    21.26),
+      SIMDE_FLOAT32_C(   -99.38), SIMDE_FLOAT32_C(    39.46), SIMDE_FLOAT32_C(   -18.60), SIMDE_FLOAT32_C(    38.86),
+      SIMDE_FLOAT32_C(   -91.45), SIMDE_FLOAT32_C(   -22.54), SIMDE_FLOAT32_C(    93.38), SIMDE_FLOAT32_C(    -8.11),
+      SIMDE_FLOAT32_C(    52.05), SIMDE_FLOAT32_C(   -87.11), SIMDE_FLOAT32_C(    -6.96), SIMDE_FLOAT32_C(   -71.26),
+      SIMDE_FLOAT32_C(   -76.66), SIMDE_FLOAT32_C(   -40.61), SIMDE_FLOAT32_C(    94.24), SIMDE_FLOAT32_C(    34.35),
+      SIMDE_FLOAT32_C(   -90.60), SIMDE_FLOAT32_C(    38.85), SIMDE_FLOAT32_C(   -95.65), SIMDE_FLOAT32_C(    22.35),
+      SIMDE_FLOAT32_C(   -96.00), SIMDE_FLOAT32_C(    -9.57), SIMDE_FLOAT32_C(    91.70), SIMDE_FLOAT32_C(   -57.82),
+      SIMDE_FLOAT32_C(   -27.46), SIMDE_FLOAT32_C(    81.24), SIMDE_FLOAT32_C(    18.50), SIMDE_FLOAT32_C(    91.79),
+      SIMDE_FLOAT32_C(    14.91), SIMDE_FLOAT32_C(    81.40), SIMDE_FLOAT32_C(    13.04), SIMDE_FLOAT32_C(    15.52),
+      SIMDE_FLOAT32_C(    20.86), SIMDE_FLOAT32_C(    94.44), SIMDE_FLOAT32_C(   -45.62), SIMDE_FLOAT32_C(    29.42),
+      SIMDE_FLOAT32_C(   -28.10), SIMDE_FLOAT32_C(   -52.24), SIMDE_FLOAT32_C(   -78.69), SIMDE_FLOAT32_C(   -76.05),
+      SIMDE_FLOAT32_C(   -39.35), SIMDE_FLOAT32_C(    14.34), SIMDE_FLOAT32_C(   -47.31), SIMDE_FLOAT32_C(   -16.01),
+      SIMDE_FLOAT32_C(    73.73), SIMDE_FLOAT32_C(   -53.07), SIMDE_FLOAT32_C(   -81.66), SIMDE_FLOAT32_C(    83.14),
+      SIMDE_FLOAT32_C(    85.78), SIMDE_FLOAT32_C(   -77.31), SIMDE_FLOAT32_C(     5.49), SIMDE_FLOAT32_C(    89.79),
+      SIMDE_FLOAT32_C(    13.13), SIMDE_FLOAT32_C(    -2.81), SIMDE_FLOAT32_C(   -68.04), SIMDE_FLOAT32_C(    85.66),
+      SIMDE_FLOAT32_C(   -21.57), SIMDE_FLOAT32_C(    50.46), SIMDE_FLOAT32_C(    77.45), SIMDE_FLOAT32_C(    93.33),
+      SIMDE_FLOAT32_C(    31.86), SIMDE_FLOAT32_C(    -9.51), SIMDE_FLOAT32_C(     8.85), SIMDE_FLOAT32_C(   -47.28),
+      SIMDE_FLOAT32_C(   -15.07), SIMDE_FLOAT32_C(    63.23), SIMDE_FLOAT32_C(    82.14), SIMDE_FLOAT32_C(    56.83),
+      SIMDE_FLOAT32_C(   -89.00), SIMDE_FLOAT32_C(   -96.55), SIMDE_FLOAT32_C(    80.79), SIMDE_FLOAT32_C(   -28.35),
+      SIMDE_FLOAT32_C(    17.79), SIMDE_FLOAT32_C(   -66.53), SIMDE_FLOAT32_C(    55.64), SIMDE_FLOAT32_C(    -8.47),
+      SIMDE_FLOAT32_C(   -19.60), SIMDE_FLOAT32_C(    73.98), SIMDE_FLOAT32_C(   -25.34), SIMDE_FLOAT32_C(   -33.81) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(    96.67), SIMDE_FLOAT32_C(    80.15), SIMDE_FLOAT32_C(   -44.03), SIMDE_FLOAT32_C(     9.80),
+      SIMDE_FLOAT32_C(   -22.66), SIMDE_FLOAT32_C(   -12.07), SIMDE_FLOAT32_C(    -4.54), SIMDE_FLOAT32_C(    55.76),
+      SIMDE_FLOAT32_C(   -61.61), SIMDE_FLOAT32_C(   -27.09), SIMDE_FLOAT32_C(    49.10), SIMDE_FLOAT32_C(    70.25),
+      SIMDE_FLOAT32_C(    63.40), SIMDE_FLOAT32_C(   -42.05), SIMDE_FLOAT32_C(   -77.02), SIMDE_FLOAT32_C(   -51.67),
+      SIMDE_FLOAT32_C(   -78.82), SIMDE_FLOAT32_C(   -94.88), SIMDE_FLOAT32_C(   -94.83), SIMDE_FLOAT32_C(   -67.82),
+      SIMDE_FLOAT32_C(   -91.43), SIMDE_FLOAT32_C(    85.95), SIMDE_FLOAT32_C(     3.83), SIMDE_FLOAT32_C(    26.36),
+      SIMDE_FLOAT32_C(   -80.57), SIMDE_FLOAT32_C(   -40.53), SIMDE_FLOAT32_C(   -82.12), SIMDE_FLOAT32_C(    -0.17),
+      SIMDE_FLOAT32_C(   -66.55), SIMDE_FLOAT32_C(    -7.45), SIMDE_FLOAT32_C(    66.01), SIMDE_FLOAT32_C(   -69.88),
+      SIMDE_FLOAT32_C(   -27.30), SIMDE_FLOAT32_C(   -78.02), SIMDE_FLOAT32_C(    39.92), SIMDE_FLOAT32_C(    50.04),
+      SIMDE_FLOAT32_C(     9.92), SIMDE_FLOAT32_C(   -64.62), SIMDE_FLOAT32_C(     5.80), SIMDE_FLOAT32_C(    48.31),
+      SIMDE_FLOAT32_C(     8.29), SIMDE_FLOAT32_C(   -45.10), SIMDE_FLOAT32_C(    18.57), SIMDE_FLOAT32_C(   -28.30),
+      SIMDE_FLOAT32_C(    12.85), SIMDE_FLOAT32_C(    41.54), SIMDE_FLOAT32_C(    20.03), SIMDE_FLOAT32_C(    34.03),
+      SIMDE_FLOAT32_C(    46.66), SIMDE_FLOAT32_C(    25.20), SIMDE_FLOAT32_C(    66.21), SIMDE_FLOAT32_C(    55.23),
+      SIMDE_FLOAT32_C(    11.15), SIMDE_FLOAT32_C(   -29.96), SIMDE_FLOAT32_C(   -18.42), SIMDE_FLOAT32_C(    30.58),
+      SIMDE_FLOAT32_C(    29.51), SIMDE_FLOAT32_C(    -0.53), SIMDE_FLOAT32_C(   -69.60), SIMDE_FLOAT32_C(    62.96),
+      SIMDE_FLOAT32_C(    92.01), SIMDE_FLOAT32_C(    96.42), SIMDE_FLOAT32_C(    93.08), SIMDE_FLOAT32_C(   -35.29),
+      SIMDE_FLOAT32_C(   -81.60), SIMDE_FLOAT32_C(    33.00), SIMDE_FLOAT32_C(   -85.25), SIMDE_FLOAT32_C(    28.32),
+      SIMDE_FLOAT32_C(    68.38), SIMDE_FLOAT32_C(    20.55), SIMDE_FLOAT32_C(   -23.37), SIMDE_FLOAT32_C(   -23.33),
+      SIMDE_FLOAT32_C(    75.45), SIMDE_FLOAT32_C(    95.20), SIMDE_FLOAT32_C(    48.37), SIMDE_FLOAT32_C(   -11.70),
+      SIMDE_FLOAT32_C(    36.74), SIMDE_FLOAT32_C(   -31.60), SIMDE_FLOAT32_C(   -77.67), SIMDE_FLOAT32_C(   -16.60),
+      SIMDE_FLOAT32_C(    93.60), SIMDE_FLOAT32_C(    88.53), SIMDE_FLOAT32_C(   -61.38), SIMDE_FLOAT32_C(     4.75),
+      SIMDE_FLOAT32_C(   -41.43), SIMDE_FLOAT32_C(    20.21), SIMDE_FLOAT32_C(   -64.67), SIMDE_FLOAT32_C(    88.09),
+      SIMDE_FLOAT32_C(   -80.33), SIMDE_FLOAT32_C(   -34.27), SIMDE_FLOAT32_C(    51.04), SIMDE_FLOAT32_C(   -88.31),
+      SIMDE_FLOAT32_C(   -37.85), SIMDE_FLOAT32_C(    44.12), SIMDE_FLOAT32_C(   -23.60), SIMDE_FLOAT32_C(   -19.45),
+      SIMDE_FLOAT32_C(   -22.88), SIMDE_FLOAT32_C(    -8.85), SIMDE_FLOAT32_C(   -91.13), SIMDE_FLOAT32_C(   -54.50),
+      SIMDE_FLOAT32_C(   -88.30), SIMDE_FLOAT32_C(   -14.50), SIMDE_FLOAT32_C(    22.18), SIMDE_FLOAT32_C(    87.15),
+      SIMDE_FLOAT32_C(   -19.30), SIMDE_FLOAT32_C(   -29.45), SIMDE_FLOAT32_C(   -24.55), SIMDE_FLOAT32_C(   -82.57),
+      SIMDE_FLOAT32_C(    38.95), SIMDE_FLOAT32_C(    -2.23), SIMDE_FLOAT32_C(     0.83), SIMDE_FLOAT32_C(    32.55),
+      SIMDE_FLOAT32_C(   -13.69), SIMDE_FLOAT32_C(    39.46), SIMDE_FLOAT32_C(   -62.69), SIMDE_FLOAT32_C(    44.88),
+      SIMDE_FLOAT32_C(   -40.34), SIMDE_FLOAT32_C(   -27.36), SIMDE_FLOAT32_C(    32.97), SIMDE_FLOAT32_C(   -20.66),
+      SIMDE_FLOAT32_C(    38.37), SIMDE_FLOAT32_C(   -15.99), SIMDE_FLOAT32_C(    -8.98), SIMDE_FLOAT32_C(   -99.48),
+      SIMDE_FLOAT32_C(   -71.87), SIMDE_FLOAT32_C(    67.42), SIMDE_FLOAT32_C(   -18.93), SIMDE_FLOAT32_C(     5.26),
+      SIMDE_FLOAT32_C(   -41.43), SIMDE_FLOAT32_C(   -10.06), SIMDE_FLOAT32_C(    50.76), SIMDE_FLOAT32_C(   -29.73),
+      SIMDE_FLOAT32_C(    75.44), SIMDE_FLOAT32_C(   -27.06), SIMDE_FLOAT32_C(   -42.58), SIMDE_FLOAT32_C(   -43.87),
+      SIMDE_FLOAT32_C(    43.49), SIMDE_FLOAT32_C(    32.87), SIMDE_FLOAT32_C(   -26.43), SIMDE_FLOAT32_C(   -17.55),
+      SIMDE_FLOAT32_C(   -69.36), SIMDE_FLOAT32_C(    74.40), SIMDE_FLOAT32_C(   -85.00), SIMDE_FLOAT32_C(    16.95),
+      SIMDE_FLOAT32_C(    13.86), SIMDE_FLOAT32_C(   -47.69), SIMDE_FLOAT32_C(   -38.17), SIMDE_FLOAT32_C(    73.52),
+      SIMDE_FLOAT32_C(    24.94), SIMDE_FLOAT32_C(    94.80), SIMDE_FLOAT32_C(   -47.15), SIMDE_FLOAT32_C(   -36.69),
+      SIMDE_FLOAT32_C(   -21.19), SIMDE_FLOAT32_C(    43.88), SIMDE_FLOAT32_C(   -36.17), SIMDE_FLOAT32_C(     6.94),
+      SIMDE_FLOAT32_C(    11.30), SIMDE_FLOAT32_C(    44.90), SIMDE_FLOAT32_C(   -87.80), SIMDE_FLOAT32_C(    69.86),
+      SIMDE_FLOAT32_C(   -65.17), SIMDE_FLOAT32_C(    62.97), SIMDE_FLOAT32_C(   -59.87), SIMDE_FLOAT32_C(   -89.73),
+      SIMDE_FLOAT32_C(   -64.09), SIMDE_FLOAT32_C(    -2.45), SIMDE_FLOAT32_C(   -33.60), SIMDE_FLOAT32_C(    79.40),
+      SIMDE_FLOAT32_C(   -69.58), SIMDE_FLOAT32_C(    39.97), SIMDE_FLOAT32_C(   -38.15), SIMDE_FLOAT32_C(   -38.94),
+      SIMDE_FLOAT32_C(    14.37), SIMDE_FLOAT32_C(   -23.15), SIMDE_FLOAT32_C(    78.01), SIMDE_FLOAT32_C(   -71.77),
+      SIMDE_FLOAT32_C(    29.16), SIMDE_FLOAT32_C(   -60.16), SIMDE_FLOAT32_C(   -98.25), SIMDE_FLOAT32_C(   -45.90),
+      SIMDE_FLOAT32_C(   -65.36), SIMDE_FLOAT32_C(   -45.40), SIMDE_FLOAT32_C(    17.42), SIMDE_FLOAT32_C(    13.45),
+      SIMDE_FLOAT32_C(    98.48), SIMDE_FLOAT32_C(    81.25), SIMDE_FLOAT32_C(   -79.61), SIMDE_FLOAT32_C(     9.77),
+      SIMDE_FLOAT32_C(    26.14), SIMDE_FLOAT32_C(   -67.41), SIMDE_FLOAT32_C(   -20.36), SIMDE_FLOAT32_C(    60.98) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  7469.69), SIMDE_FLOAT32_C(  3514.58), SIMDE_FLOAT32_C( -2779.61), SIMDE_FLOAT32_C(  -160.23),
+      SIMDE_FLOAT32_C( -1609.99), SIMDE_FLOAT32_C(  1163.91), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3391.32),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2672.70), SIMDE_FLOAT32_C( -4213.27), SIMDE_FLOAT32_C(   776.97),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2957.38), SIMDE_FLOAT32_C(  6728.47), SIMDE_FLOAT32_C( -3160.14),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  7230.79), SIMDE_FLOAT32_C(    75.96),
+      SIMDE_FLOAT32_C( -3798.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  1788.65), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  3414.02), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1557.18), SIMDE_FLOAT32_C(  5173.22),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1036.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -4080.76),
+      SIMDE_FLOAT32_C(   -96.32), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -355.81), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -882.26), SIMDE_FLOAT32_C(   567.13),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2588.32),
+      SIMDE_FLOAT32_C(  2260.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    45.45), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  4091.14),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  8465.63), SIMDE_FLOAT32_C( -2301.26),
+      SIMDE_FLOAT32_C(   912.29), SIMDE_FLOAT32_C(    18.81), SIMDE_FLOAT32_C( -7132.02), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -480.02), SIMDE_FLOAT32_C(  1958.09),
+      SIMDE_FLOAT32_C(  4255.38), SIMDE_FLOAT32_C(  6951.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -236.22),
+      SIMDE_FLOAT32_C( -2272.37), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -3427.58), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1438.75), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -6212.85), SIMDE_FLOAT32_C( -4006.33),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -4108.72), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -3950.95), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -1274.17),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -442.59), SIMDE_FLOAT32_C( -4065.31), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -1143.48), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2671.15),
+      SIMDE_FLOAT32_C(  1193.32), SIMDE_FLOAT32_C( -2418.14), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1955.26),
+      SIMDE_FLOAT32_C(   749.79), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -30.79), SIMDE_FLOAT32_C(   692.01),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  3689.09), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3078.74), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  1997.16), SIMDE_FLOAT32_C(  1392.89), SIMDE_FLOAT32_C(    62.50), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2737.93), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  3753.56), SIMDE_FLOAT32_C(  -390.83), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -664.47),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  2536.56),
+      SIMDE_FLOAT32_C( -1194.24), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -488.96), SIMDE_FLOAT32_C( -1610.91),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6056.16), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -4503.84), SIMDE_FLOAT32_C(  1741.32), SIMDE_FLOAT32_C(  2162.96),
+      SIMDE_FLOAT32_C(  -700.81), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3710.23), SIMDE_FLOAT32_C(  2790.27),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   629.24), SIMDE_FLOAT32_C(  1711.20), SIMDE_FLOAT32_C(  -111.11),
+      SIMDE_FLOAT32_C(   833.15), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -4868.21), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -841.50), SIMDE_FLOAT32_C(     6.88), SIMDE_FLOAT32_C(  2286.14), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  1500.84), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2954.72), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   220.16), SIMDE_FLOAT32_C(   690.39), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -3803.92), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2608.50),
+      SIMDE_FLOAT32_C(  5817.04), SIMDE_FLOAT32_C(  4383.37), SIMDE_FLOAT32_C(  1407.36), SIMDE_FLOAT32_C(  -381.31),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -512.34), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_f32_z(pv, av, bv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+
+    ev = simde_svmul_f32_z(pv, av, bv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   -84.73), SIMDE_FLOAT32_C(   -76.19), SIMDE_FLOAT32_C(   -80.98), SIMDE_FLOAT32_C(   -31.07),
+      SIMDE_FLOAT32_C(   -17.93), SIMDE_FLOAT32_C(    95.65), SIMDE_FLOAT32_C(   -24.58), SIMDE_FLOAT32_C(   -36.98),
+      SIMDE_FLOAT32_C(    64.07), SIMDE_FLOAT32_C(   -39.48), SIMDE_FLOAT32_C(     0.97), SIMDE_FLOAT32_C(   -99.47),
+      SIMDE_FLOAT32_C(    20.14), SIMDE_FLOAT32_C(    76.32), SIMDE_FLOAT32_C(    66.29), SIMDE_FLOAT32_C(   -27.63),
+      SIMDE_FLOAT32_C(   -13.84), SIMDE_FLOAT32_C(    40.80), SIMDE_FLOAT32_C(   -68.79), SIMDE_FLOAT32_C(    40.87),
+      SIMDE_FLOAT32_C(     3.24), SIMDE_FLOAT32_C(    88.32), SIMDE_FLOAT32_C(     4.14), SIMDE_FLOAT32_C(    -7.27),
+      SIMDE_FLOAT32_C(   -34.74), SIMDE_FLOAT32_C(   -47.49), SIMDE_FLOAT32_C(    21.85), SIMDE_FLOAT32_C(     6.44),
+      SIMDE_FLOAT32_C(   -79.36), SIMDE_FLOAT32_C(   -55.42), SIMDE_FLOAT32_C(    10.82), SIMDE_FLOAT32_C(   -64.09),
+      SIMDE_FLOAT32_C(   -31.61), SIMDE_FLOAT32_C(    29.84), SIMDE_FLOAT32_C(     4.84), SIMDE_FLOAT32_C(    50.46),
+      SIMDE_FLOAT32_C(    25.49), SIMDE_FLOAT32_C(    80.26), SIMDE_FLOAT32_C(   -86.52), SIMDE_FLOAT32_C(   -10.43),
+      SIMDE_FLOAT32_C(   -59.22), SIMDE_FLOAT32_C(    14.45), SIMDE_FLOAT32_C(    -9.91), SIMDE_FLOAT32_C(    60.92),
+      SIMDE_FLOAT32_C(    -9.23), SIMDE_FLOAT32_C(   -43.61), SIMDE_FLOAT32_C(   -66.71), SIMDE_FLOAT32_C(    76.93),
+      SIMDE_FLOAT32_C(    97.19), SIMDE_FLOAT32_C(   -35.50), SIMDE_FLOAT32_C(    17.80), SIMDE_FLOAT32_C(     0.43),
+      SIMDE_FLOAT32_C(   -47.17), SIMDE_FLOAT32_C(   -78.05), SIMDE_FLOAT32_C(    93.16), SIMDE_FLOAT32_C(    18.09),
+      SIMDE_FLOAT32_C(   -25.54), SIMDE_FLOAT32_C(    15.01), SIMDE_FLOAT32_C(   -75.47), SIMDE_FLOAT32_C(    -4.90),
+      SIMDE_FLOAT32_C(    59.59), SIMDE_FLOAT32_C(    35.36), SIMDE_FLOAT32_C(    31.01), SIMDE_FLOAT32_C(   -72.02),
+      SIMDE_FLOAT32_C(   -34.80), SIMDE_FLOAT32_C(   -64.15), SIMDE_FLOAT32_C(    78.44), SIMDE_FLOAT32_C(    90.69),
+      SIMDE_FLOAT32_C(   -83.89), SIMDE_FLOAT32_C(    91.92), SIMDE_FLOAT32_C(   -19.74), SIMDE_FLOAT32_C(   -43.11),
+      SIMDE_FLOAT32_C(     6.36), SIMDE_FLOAT32_C(    70.35), SIMDE_FLOAT32_C(   -82.19), SIMDE_FLOAT32_C(    97.13),
+      SIMDE_FLOAT32_C(   -73.26), SIMDE_FLOAT32_C(   -48.90), SIMDE_FLOAT32_C(    74.07), SIMDE_FLOAT32_C(   -76.08),
+      SIMDE_FLOAT32_C(    15.61), SIMDE_FLOAT32_C(    -8.13), SIMDE_FLOAT32_C(    24.35), SIMDE_FLOAT32_C(    68.43),
+      SIMDE_FLOAT32_C(    13.82), SIMDE_FLOAT32_C(    17.51), SIMDE_FLOAT32_C(   -13.47), SIMDE_FLOAT32_C(    88.28),
+      SIMDE_FLOAT32_C(   -67.48), SIMDE_FLOAT32_C(    11.06), SIMDE_FLOAT32_C(   -16.63), SIMDE_FLOAT32_C(    92.10),
+      SIMDE_FLOAT32_C(   -53.59), SIMDE_FLOAT32_C(   -85.62), SIMDE_FLOAT32_C(   -79.92), SIMDE_FLOAT32_C(    11.61),
+      SIMDE_FLOAT32_C(   -49.78), SIMDE_FLOAT32_C(    98.52), SIMDE_FLOAT32_C(     2.31), SIMDE_FLOAT32_C(   -33.67),
+      SIMDE_FLOAT32_C(    90.44), SIMDE_FLOAT32_C(    82.57), SIMDE_FLOAT32_C(    23.23), SIMDE_FLOAT32_C(    -3.20),
+      SIMDE_FLOAT32_C(    52.92), SIMDE_FLOAT32_C(    41.04), SIMDE_FLOAT32_C(    -6.07), SIMDE_FLOAT32_C(    79.66),
+      SIMDE_FLOAT32_C(    92.14), SIMDE_FLOAT32_C(   -32.00), SIMDE_FLOAT32_C(   -96.41), SIMDE_FLOAT32_C(     7.74),
+      SIMDE_FLOAT32_C(    59.87), SIMDE_FLOAT32_C(    27.94), SIMDE_FLOAT32_C(   -23.83), SIMDE_FLOAT32_C(   -26.31),
+      SIMDE_FLOAT32_C(   -54.55), SIMDE_FLOAT32_C(    62.70), SIMDE_FLOAT32_C(   -38.03), SIMDE_FLOAT32_C(   -22.04),
+      SIMDE_FLOAT32_C(   -26.24), SIMDE_FLOAT32_C(    45.34), SIMDE_FLOAT32_C(   -29.93), SIMDE_FLOAT32_C(    20.17),
+      SIMDE_FLOAT32_C(    59.71), SIMDE_FLOAT32_C(    -9.85), SIMDE_FLOAT32_C(   -68.21), SIMDE_FLOAT32_C(   -90.06),
+      SIMDE_FLOAT32_C(   -11.33), SIMDE_FLOAT32_C(    34.10), SIMDE_FLOAT32_C(   -23.73), SIMDE_FLOAT32_C(   -20.90),
+      SIMDE_FLOAT32_C(    16.67), SIMDE_FLOAT32_C(    99.50), SIMDE_FLOAT32_C(    75.90), SIMDE_FLOAT32_C(   -30.41),
+      SIMDE_FLOAT32_C(    40.53), SIMDE_FLOAT32_C(   -30.17), SIMDE_FLOAT32_C(   -50.75), SIMDE_FLOAT32_C(    32.67),
+      SIMDE_FLOAT32_C(    37.84), SIMDE_FLOAT32_C(   -47.16), SIMDE_FLOAT32_C(   -59.59), SIMDE_FLOAT32_C(    -2.29),
+      SIMDE_FLOAT32_C(    80.77), SIMDE_FLOAT32_C(    16.59), SIMDE_FLOAT32_C(    71.40), SIMDE_FLOAT32_C(   -73.78),
+      SIMDE_FLOAT32_C(   -20.71), SIMDE_FLOAT32_C(   -66.63), SIMDE_FLOAT32_C(     4.18), SIMDE_FLOAT32_C(    53.05),
+      SIMDE_FLOAT32_C(    78.71), SIMDE_FLOAT32_C(    74.25), SIMDE_FLOAT32_C(   -26.78), SIMDE_FLOAT32_C(    38.43),
+      SIMDE_FLOAT32_C(   -35.60), SIMDE_FLOAT32_C(     5.01), SIMDE_FLOAT32_C(    48.37), SIMDE_FLOAT32_C(    53.06),
+      SIMDE_FLOAT32_C(   -60.89), SIMDE_FLOAT32_C(   -75.36), SIMDE_FLOAT32_C(   -67.84), SIMDE_FLOAT32_C(    55.77),
+      SIMDE_FLOAT32_C(   -75.87), SIMDE_FLOAT32_C(   -91.94), SIMDE_FLOAT32_C(   -74.64), SIMDE_FLOAT32_C(    64.67),
+      SIMDE_FLOAT32_C(   -22.11), SIMDE_FLOAT32_C(   -25.39), SIMDE_FLOAT32_C(    -2.66), SIMDE_FLOAT32_C(   -84.27),
+      SIMDE_FLOAT32_C(    27.45), SIMDE_FLOAT32_C(    37.75), SIMDE_FLOAT32_C(    13.44), SIMDE_FLOAT32_C(     8.22),
+      SIMDE_FLOAT32_C(   -45.67), SIMDE_FLOAT32_C(   -15.15), SIMDE_FLOAT32_C(    34.44), SIMDE_FLOAT32_C(    33.62),
+      SIMDE_FLOAT32_C(    18.22), SIMDE_FLOAT32_C(   -61.37), SIMDE_FLOAT32_C(   -13.33), SIMDE_FLOAT32_C(    -3.07),
+      SIMDE_FLOAT32_C(   -87.13), SIMDE_FLOAT32_C(    59.89), SIMDE_FLOAT32_C(   -64.64), SIMDE_FLOAT32_C(   -22.73),
+      SIMDE_FLOAT32_C(   -35.10), SIMDE_FLOAT32_C(    83.72), SIMDE_FLOAT32_C(   -69.67), SIMDE_FLOAT32_C(     4.00),
+      SIMDE_FLOAT32_C(   -91.64), SIMDE_FLOAT32_C(   -37.51), SIMDE_FLOAT32_C(   -40.22), SIMDE_FLOAT32_C(   -67.50),
+      SIMDE_FLOAT32_C(   -29.45), SIMDE_FLOAT32_C(   -14.86), SIMDE_FLOAT32_C(    97.16), SIMDE_FLOAT32_C(    48.45),
+      SIMDE_FLOAT32_C(    59.75), SIMDE_FLOAT32_C(    -5.50), SIMDE_FLOAT32_C(    64.18), SIMDE_FLOAT32_C(   -12.80),
+      SIMDE_FLOAT32_C(   -67.75), SIMDE_FLOAT32_C(   -22.38), SIMDE_FLOAT32_C(    95.43), SIMDE_FLOAT32_C(   -13.42),
+      SIMDE_FLOAT32_C(    62.47), SIMDE_FLOAT32_C(    29.87), SIMDE_FLOAT32_C(   -79.79), SIMDE_FLOAT32_C(   -19.32),
+      SIMDE_FLOAT32_C(    68.50), SIMDE_FLOAT32_C(     6.87), SIMDE_FLOAT32_C(    77.62), SIMDE_FLOAT32_C(    81.37),
+      SIMDE_FLOAT32_C(   -33.24), SIMDE_FLOAT32_C(   -87.02), SIMDE_FLOAT32_C(   -41.36), SIMDE_FLOAT32_C(    31.66),
+      SIMDE_FLOAT32_C(    96.70), SIMDE_FLOAT32_C(   -11.03), SIMDE_FLOAT32_C(   -64.34), SIMDE_FLOAT32_C(   -94.94),
+      SIMDE_FLOAT32_C(    51.47), SIMDE_FLOAT32_C(    -4.56), SIMDE_FLOAT32_C(   -62.44), SIMDE_FLOAT32_C(   -77.98),
+      SIMDE_FLOAT32_C(    80.58), SIMDE_FLOAT32_C(   -65.28), SIMDE_FLOAT32_C(    70.47), SIMDE_FLOAT32_C(    40.33),
+      SIMDE_FLOAT32_C(    29.22), SIMDE_FLOAT32_C(    34.65), SIMDE_FLOAT32_C(   -72.47), SIMDE_FLOAT32_C(    61.47),
+      SIMDE_FLOAT32_C(   -87.73), SIMDE_FLOAT32_C(   -77.04), SIMDE_FLOAT32_C(   -51.94), SIMDE_FLOAT32_C(    74.73),
+      SIMDE_FLOAT32_C(    52.83), SIMDE_FLOAT32_C(   -31.73), SIMDE_FLOAT32_C(   -44.58), SIMDE_FLOAT32_C(    21.33),
+      SIMDE_FLOAT32_C(    75.14), SIMDE_FLOAT32_C(   -66.97) };
+  static const simde_float32 b[] =
+    { SIMDE_FLOAT32_C(     2.70), SIMDE_FLOAT32_C(   -58.10), SIMDE_FLOAT32_C(   -53.99), SIMDE_FLOAT32_C(    61.34),
+      SIMDE_FLOAT32_C(    73.56), SIMDE_FLOAT32_C(   -57.29), SIMDE_FLOAT32_C(   -49.68), SIMDE_FLOAT32_C(   -90.78),
+      SIMDE_FLOAT32_C(   -52.23), SIMDE_FLOAT32_C(   -98.22), SIMDE_FLOAT32_C(     4.66), SIMDE_FLOAT32_C(   -14.67),
+      SIMDE_FLOAT32_C(   -76.20), SIMDE_FLOAT32_C(   -14.77), SIMDE_FLOAT32_C(    20.05), SIMDE_FLOAT32_C(    94.27),
+      SIMDE_FLOAT32_C(   -74.44), SIMDE_FLOAT32_C(   -50.72), SIMDE_FLOAT32_C(    28.91), SIMDE_FLOAT32_C(   -46.90),
+      SIMDE_FLOAT32_C(   -89.25), SIMDE_FLOAT32_C(    41.18), SIMDE_FLOAT32_C(   -23.94), SIMDE_FLOAT32_C(   -41.19),
+      SIMDE_FLOAT32_C(    15.91), SIMDE_FLOAT32_C(   -71.11), SIMDE_FLOAT32_C(    27.08), SIMDE_FLOAT32_C(    71.33),
+      SIMDE_FLOAT32_C(    50.22), SIMDE_FLOAT32_C(     2.22), SIMDE_FLOAT32_C(   -95.64), SIMDE_FLOAT32_C(   -47.08),
+      SIMDE_FLOAT32_C(    44.12), SIMDE_FLOAT32_C(   -49.63), SIMDE_FLOAT32_C(   -85.74), SIMDE_FLOAT32_C(    17.68),
+      SIMDE_FLOAT32_C(    -6.92), SIMDE_FLOAT32_C(   -35.42), SIMDE_FLOAT32_C(    26.90), SIMDE_FLOAT32_C(    40.85),
+      SIMDE_FLOAT32_C(   -33.64), SIMDE_FLOAT32_C(   -68.44), SIMDE_FLOAT32_C(   -73.82), SIMDE_FLOAT32_C(    -9.84),
+      SIMDE_FLOAT32_C(    16.79), SIMDE_FLOAT32_C(    46.23), SIMDE_FLOAT32_C(   -15.57), SIMDE_FLOAT32_C(    42.36),
+      SIMDE_FLOAT32_C(    95.51), SIMDE_FLOAT32_C(   -86.66), SIMDE_FLOAT32_C(    95.45), SIMDE_FLOAT32_C(   -93.73),
+      SIMDE_FLOAT32_C(    54.52), SIMDE_FLOAT32_C(   -28.49), SIMDE_FLOAT32_C(   -34.92), SIMDE_FLOAT32_C(   -29.57),
+      SIMDE_FLOAT32_C(     0.40), SIMDE_FLOAT32_C(    92.16), SIMDE_FLOAT32_C(   -58.24), SIMDE_FLOAT32_C(   -49.38),
+      SIMDE_FLOAT32_C(    -5.63), SIMDE_FLOAT32_C(   -53.88), SIMDE_FLOAT32_C(     3.54), SIMDE_FLOAT32_C(   -61.51),
+      SIMDE_FLOAT32_C(    -3.51), SIMDE_FLOAT32_C(    17.80), SIMDE_FLOAT32_C(    56.17), SIMDE_FLOAT32_C(    89.57),
+      SIMDE_FLOAT32_C(    82.38), SIMDE_FLOAT32_C(   -16.93), SIMDE_FLOAT32_C(    30.42), SIMDE_FLOAT32_C(   -51.26),
+      SIMDE_FLOAT32_C(    14.63), SIMDE_FLOAT32_C(    56.60), SIMDE_FLOAT32_C(    38.90), SIMDE_FLOAT32_C(   -68.58),
+      SIMDE_FLOAT32_C(     2.83), SIMDE_FLOAT32_C(   -76.67), SIMDE_FLOAT32_C(    73.78), SIMDE_FLOAT32_C(    -1.66),
+      SIMDE_FLOAT32_C(   -63.34), SIMDE_FLOAT32_C(    69.23), SIMDE_FLOAT32_C(     4.61), SIMDE_FLOAT32_C(    91.18),
+      SIMDE_FLOAT32_C(   -59.25), SIMDE_FLOAT32_C(    69.69), SIMDE_FLOAT32_C(   -38.39), SIMDE_FLOAT32_C(    41.15),
+      SIMDE_FLOAT32_C(    61.84), SIMDE_FLOAT32_C(     3.37), SIMDE_FLOAT32_C(    91.77), SIMDE_FLOAT32_C(   -43.78),
+      SIMDE_FLOAT32_C(    49.48), SIMDE_FLOAT32_C(    -4.69), SIMDE_FLOAT32_C(    -5.29), SIMDE_FLOAT32_C(   -54.03),
+      SIMDE_FLOAT32_C(   -86.89), SIMDE_FLOAT32_C(   -49.11), SIMDE_FLOAT32_C(   -64.46), SIMDE_FLOAT32_C(    95.49),
+      SIMDE_FLOAT32_C(    33.96), SIMDE_FLOAT32_C(    65.95), SIMDE_FLOAT32_C(   -55.77), SIMDE_FLOAT32_C(   -51.41),
+      SIMDE_FLOAT32_C(    22.55), SIMDE_FLOAT32_C(    83.13), SIMDE_FLOAT32_C(   -19.98), SIMDE_FLOAT32_C(   -74.62),
+      SIMDE_FLOAT32_C(   -93.55), SIMDE_FLOAT32_C(   -46.20), SIMDE_FLOAT32_C(    23.73), SIMDE_FLOAT32_C(   -56.88),
+      SIMDE_FLOAT32_C(   -76.97), SIMDE_FLOAT32_C(   -71.66), SIMDE_FLOAT32_C(   -65.70), SIMDE_FLOAT32_C(   -36.22),
+      SIMDE_FLOAT32_C(    98.03), SIMDE_FLOAT32_C(    -4.09), SIMDE_FLOAT32_C(   -95.08), SIMDE_FLOAT32_C(    59.87),
+      SIMDE_FLOAT32_C(    99.28), SIMDE_FLOAT32_C(    96.69), SIMDE_FLOAT32_C(   -83.91), SIMDE_FLOAT32_C(    48.76),
+      SIMDE_FLOAT32_C(    -8.01), SIMDE_FLOAT32_C(    10.80), SIMDE_FLOAT32_C(    94.73), SIMDE_FLOAT32_C(     5.10),
+      SIMDE_FLOAT32_C(    61.69), SIMDE_FLOAT32_C(   -69.73), SIMDE_FLOAT32_C(     0.59), SIMDE_FLOAT32_C(    -4.35),
+      SIMDE_FLOAT32_C(    96.22), SIMDE_FLOAT32_C(    44.82), SIMDE_FLOAT32_C(    44.24), SIMDE_FLOAT32_C(    18.78),
+      SIMDE_FLOAT32_C(    27.95), SIMDE_FLOAT32_C(   -75.74), SIMDE_FLOAT32_C(    44.16), SIMDE_FLOAT32_C(    34.40),
+      SIMDE_FLOAT32_C(   -21.94), SIMDE_FLOAT32_C(   -32.11), SIMDE_FLOAT32_C(    77.52), SIMDE_FLOAT32_C(     1.09),
+      SIMDE_FLOAT32_C(    -3.78), SIMDE_FLOAT32_C(   -88.18), SIMDE_FLOAT32_C(    64.86), SIMDE_FLOAT32_C(    -5.75),
+      SIMDE_FLOAT32_C(     7.73), SIMDE_FLOAT32_C(    69.78), SIMDE_FLOAT32_C(   -45.88), SIMDE_FLOAT32_C(     7.00),
+      SIMDE_FLOAT32_C(    66.47), SIMDE_FLOAT32_C(   -29.79), SIMDE_FLOAT32_C(   -44.24), SIMDE_FLOAT32_C(   -41.53),
+      SIMDE_FLOAT32_C(    81.01), SIMDE_FLOAT32_C(   -49.50), SIMDE_FLOAT32_C(    63.57), SIMDE_FLOAT32_C(    42.71),
+      SIMDE_FLOAT32_C(   -19.23), SIMDE_FLOAT32_C(   -35.84), SIMDE_FLOAT32_C(   -61.64), SIMDE_FLOAT32_C(   -23.01),
+      SIMDE_FLOAT32_C(   -91.02), SIMDE_FLOAT32_C(    82.60), SIMDE_FLOAT32_C(    95.77), SIMDE_FLOAT32_C(    36.93),
+      SIMDE_FLOAT32_C(   -93.14), SIMDE_FLOAT32_C(    39.93), SIMDE_FLOAT32_C(   -28.67), SIMDE_FLOAT32_C(   -15.08),
+      SIMDE_FLOAT32_C(   -92.18), SIMDE_FLOAT32_C(   -51.15), SIMDE_FLOAT32_C(    86.01), SIMDE_FLOAT32_C(     4.04),
+      SIMDE_FLOAT32_C(   -39.33), SIMDE_FLOAT32_C(    50.87), SIMDE_FLOAT32_C(    98.29), SIMDE_FLOAT32_C(    68.40),
+      SIMDE_FLOAT32_C(    20.65), SIMDE_FLOAT32_C(   -47.59), SIMDE_FLOAT32_C(   -24.60), SIMDE_FLOAT32_C(   -12.87),
+      SIMDE_FLOAT32_C(    22.62), SIMDE_FLOAT32_C(    31.16), SIMDE_FLOAT32_C(    45.59), SIMDE_FLOAT32_C(     3.63),
+      SIMDE_FLOAT32_C(    81.66), SIMDE_FLOAT32_C(     9.16), SIMDE_FLOAT32_C(   -53.66), SIMDE_FLOAT32_C(   -37.57),
+      SIMDE_FLOAT32_C(    73.32), SIMDE_FLOAT32_C(   -15.30), SIMDE_FLOAT32_C(    39.42), SIMDE_FLOAT32_C(    82.30),
+      SIMDE_FLOAT32_C(   -32.70), SIMDE_FLOAT32_C(    35.19), SIMDE_FLOAT32_C(    19.23), SIMDE_FLOAT32_C(   -25.84),
+      SIMDE_FLOAT32_C(   -24.88), SIMDE_FLOAT32_C(    90.57), SIMDE_FLOAT32_C(    59.08), SIMDE_FLOAT32_C(   -17.07),
+      SIMDE_FLOAT32_C(   -60.58), SIMDE_FLOAT32_C(    45.09), SIMDE_FLOAT32_C(    86.97), SIMDE_FLOAT32_C(     0.09),
+      SIMDE_FLOAT32_C(    -4.04), SIMDE_FLOAT32_C(    85.26), SIMDE_FLOAT32_C(   -31.52), SIMDE_FLOAT32_C(   -83.39),
+      SIMDE_FLOAT32_C(   -62.33), SIMDE_FLOAT32_C(    43.88), SIMDE_FLOAT32_C(     3.74), SIMDE_FLOAT32_C(    60.29),
+      SIMDE_FLOAT32_C(   -24.95), SIMDE_FLOAT32_C(   -50.67), SIMDE_FLOAT32_C(   -36.08), SIMDE_FLOAT32_C(   -43.29),
+      SIMDE_FLOAT32_C(    58.49), SIMDE_FLOAT32_C(    10.26), SIMDE_FLOAT32_C(    19.14), SIMDE_FLOAT32_C(    31.81),
+      SIMDE_FLOAT32_C(    94.95), SIMDE_FLOAT32_C(   -41.44), SIMDE_FLOAT32_C(    14.12), SIMDE_FLOAT32_C(   -37.75),
+      SIMDE_FLOAT32_C(    93.75), SIMDE_FLOAT32_C(   -66.65), SIMDE_FLOAT32_C(    36.41), SIMDE_FLOAT32_C(   -31.14),
+      SIMDE_FLOAT32_C(   -76.08), SIMDE_FLOAT32_C(    -4.50), SIMDE_FLOAT32_C(    51.79), SIMDE_FLOAT32_C(   -36.67),
+      SIMDE_FLOAT32_C(   -59.41), SIMDE_FLOAT32_C(    38.76), SIMDE_FLOAT32_C(    63.42), SIMDE_FLOAT32_C(    36.54),
+      SIMDE_FLOAT32_C(    24.02), SIMDE_FLOAT32_C(   -68.10), SIMDE_FLOAT32_C(    53.16), SIMDE_FLOAT32_C(    61.69),
+      SIMDE_FLOAT32_C(    75.79), SIMDE_FLOAT32_C(   -43.11) };
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(   -84.73), SIMDE_FLOAT32_C(  4426.64), SIMDE_FLOAT32_C(   -80.98), SIMDE_FLOAT32_C( -1905.83),
+      SIMDE_FLOAT32_C( -1318.93), SIMDE_FLOAT32_C( -5479.79), SIMDE_FLOAT32_C(   -24.58), SIMDE_FLOAT32_C(   -36.98),
+      SIMDE_FLOAT32_C(    64.07), SIMDE_FLOAT32_C(  3877.73), SIMDE_FLOAT32_C(     0.97), SIMDE_FLOAT32_C(   -99.47),
+      SIMDE_FLOAT32_C(    20.14), SIMDE_FLOAT32_C( -1127.25), SIMDE_FLOAT32_C(  1329.11), SIMDE_FLOAT32_C(   -27.63),
+      SIMDE_FLOAT32_C(   -13.84), SIMDE_FLOAT32_C( -2069.38), SIMDE_FLOAT32_C(   -68.79), SIMDE_FLOAT32_C( -1916.80),
+      SIMDE_FLOAT32_C(     3.24), SIMDE_FLOAT32_C(  3637.02), SIMDE_FLOAT32_C(   -99.11), SIMDE_FLOAT32_C(    -7.27),
+      SIMDE_FLOAT32_C(  -552.71), SIMDE_FLOAT32_C(  3377.01), SIMDE_FLOAT32_C(    21.85), SIMDE_FLOAT32_C(   459.37),
+      SIMDE_FLOAT32_C(   -79.36), SIMDE_FLOAT32_C(  -123.03), SIMDE_FLOAT32_C(    10.82), SIMDE_FLOAT32_C(   -64.09),
+      SIMDE_FLOAT32_C(   -31.61), SIMDE_FLOAT32_C(    29.84), SIMDE_FLOAT32_C(     4.84), SIMDE_FLOAT32_C(    50.46),
+      SIMDE_FLOAT32_C(  -176.39), SIMDE_FLOAT32_C( -2842.81), SIMDE_FLOAT32_C(   -86.52), SIMDE_FLOAT32_C(  -426.07),
+      SIMDE_FLOAT32_C(   -59.22), SIMDE_FLOAT32_C(  -988.96), SIMDE_FLOAT32_C(   731.56), SIMDE_FLOAT32_C(    60.92),
+      SIMDE_FLOAT32_C(    -9.23), SIMDE_FLOAT32_C(   -43.61), SIMDE_FLOAT32_C(  1038.67), SIMDE_FLOAT32_C(  3258.75),
+      SIMDE_FLOAT32_C(  9282.62), SIMDE_FLOAT32_C(   -35.50), SIMDE_FLOAT32_C(    17.80), SIMDE_FLOAT32_C(     0.43),
+      SIMDE_FLOAT32_C( -2571.71), SIMDE_FLOAT32_C(  2223.64), SIMDE_FLOAT32_C(    93.16), SIMDE_FLOAT32_C(  -534.92),
+      SIMDE_FLOAT32_C(   -10.22), SIMDE_FLOAT32_C(    15.01), SIMDE_FLOAT32_C(   -75.47), SIMDE_FLOAT32_C(    -4.90),
+      SIMDE_FLOAT32_C(    59.59), SIMDE_FLOAT32_C( -1905.20), SIMDE_FLOAT32_C(   109.78), SIMDE_FLOAT32_C(  4429.95),
+      SIMDE_FLOAT32_C(   122.15), SIMDE_FLOAT32_C(   -64.15), SIMDE_FLOAT32_C(    78.44), SIMDE_FLOAT32_C(  8123.10),
+      SIMDE_FLOAT32_C( -6910.86), SIMDE_FLOAT32_C( -1556.21), SIMDE_FLOAT32_C(  -600.49), SIMDE_FLOAT32_C(  2209.82),
+      SIMDE_FLOAT32_C(     6.36), SIMDE_FLOAT32_C(    70.35), SIMDE_FLOAT32_C( -3197.19), SIMDE_FLOAT32_C(    97.13),
+      SIMDE_FLOAT32_C(  -207.33), SIMDE_FLOAT32_C(   -48.90), SIMDE_FLOAT32_C(    74.07), SIMDE_FLOAT32_C(   -76.08),
+      SIMDE_FLOAT32_C(    15.61), SIMDE_FLOAT32_C(  -562.84), SIMDE_FLOAT32_C(   112.25), SIMDE_FLOAT32_C(  6239.45),
+      SIMDE_FLOAT32_C(    13.82), SIMDE_FLOAT32_C(  1220.27), SIMDE_FLOAT32_C(   -13.47), SIMDE_FLOAT32_C(  3632.72),
+      SIMDE_FLOAT32_C( -4172.96), SIMDE_FLOAT32_C(    37.27), SIMDE_FLOAT32_C( -1526.14), SIMDE_FLOAT32_C( -4032.14),
+      SIMDE_FLOAT32_C( -2651.63), SIMDE_FLOAT32_C(   -85.62), SIMDE_FLOAT32_C(   422.78), SIMDE_FLOAT32_C(    11.61),
+      SIMDE_FLOAT32_C(   -49.78), SIMDE_FLOAT32_C( -4838.32), SIMDE_FLOAT32_C(     2.31), SIMDE_FLOAT32_C(   -33.67),
+      SIMDE_FLOAT32_C(  3071.34), SIMDE_FLOAT32_C(    82.57), SIMDE_FLOAT32_C(    23.23), SIMDE_FLOAT32_C(    -3.20),
+      SIMDE_FLOAT32_C(  1193.35), SIMDE_FLOAT32_C(    41.04), SIMDE_FLOAT32_C(    -6.07), SIMDE_FLOAT32_C(    79.66),
+      SIMDE_FLOAT32_C(    92.14), SIMDE_FLOAT32_C(   -32.00), SIMDE_FLOAT32_C(   -96.41), SIMDE_FLOAT32_C(  -440.25),
+      SIMDE_FLOAT32_C(    59.87), SIMDE_FLOAT32_C(    27.94), SIMDE_FLOAT32_C(   -23.83), SIMDE_FLOAT32_C(   -26.31),
+      SIMDE_FLOAT32_C(   -54.55), SIMDE_FLOAT32_C(    62.70), SIMDE_FLOAT32_C(  3615.89), SIMDE_FLOAT32_C( -1319.53),
+      SIMDE_FLOAT32_C( -2605.11), SIMDE_FLOAT32_C(    45.34), SIMDE_FLOAT32_C(  2511.43), SIMDE_FLOAT32_C(    20.17),
+      SIMDE_FLOAT32_C(  -478.28), SIMDE_FLOAT32_C(  -106.38), SIMDE_FLOAT32_C(   -68.21), SIMDE_FLOAT32_C(   -90.06),
+      SIMDE_FLOAT32_C(  -698.95), SIMDE_FLOAT32_C( -2377.79), SIMDE_FLOAT32_C(   -23.73), SIMDE_FLOAT32_C(   -20.90),
+      SIMDE_FLOAT32_C(    16.67), SIMDE_FLOAT32_C(    99.50), SIMDE_FLOAT32_C(    75.90), SIMDE_FLOAT32_C(  -571.10),
+      SIMDE_FLOAT32_C(    40.53), SIMDE_FLOAT32_C(   -30.17), SIMDE_FLOAT32_C( -2241.12), SIMDE_FLOAT32_C(  1123.85),
+      SIMDE_FLOAT32_C(  -830.21), SIMDE_FLOAT32_C(  1514.31), SIMDE_FLOAT32_C(   -59.59), SIMDE_FLOAT32_C(    -2.50),
+      SIMDE_FLOAT32_C(    80.77), SIMDE_FLOAT32_C(    16.59), SIMDE_FLOAT32_C(  4631.00), SIMDE_FLOAT32_C(   424.23),
+      SIMDE_FLOAT32_C(  -160.09), SIMDE_FLOAT32_C( -4649.44), SIMDE_FLOAT32_C(  -191.78), SIMDE_FLOAT32_C(   371.35),
+      SIMDE_FLOAT32_C(  5231.85), SIMDE_FLOAT32_C( -2211.91), SIMDE_FLOAT32_C(   -26.78), SIMDE_FLOAT32_C(    38.43),
+      SIMDE_FLOAT32_C(   -35.60), SIMDE_FLOAT32_C(  -248.00), SIMDE_FLOAT32_C(    48.37), SIMDE_FLOAT32_C(    53.06),
+      SIMDE_FLOAT32_C(   -60.89), SIMDE_FLOAT32_C(   -75.36), SIMDE_FLOAT32_C(  4181.66), SIMDE_FLOAT32_C(    55.77),
+      SIMDE_FLOAT32_C(   -75.87), SIMDE_FLOAT32_C(   -91.94), SIMDE_FLOAT32_C(   -74.64), SIMDE_FLOAT32_C(  2388.26),
+      SIMDE_FLOAT32_C(  2059.33), SIMDE_FLOAT32_C(   -25.39), SIMDE_FLOAT32_C(    76.26), SIMDE_FLOAT32_C(   -84.27),
+      SIMDE_FLOAT32_C( -2530.34), SIMDE_FLOAT32_C(    37.75), SIMDE_FLOAT32_C(    13.44), SIMDE_FLOAT32_C(     8.22),
+      SIMDE_FLOAT32_C(  1796.20), SIMDE_FLOAT32_C(   -15.15), SIMDE_FLOAT32_C(    34.44), SIMDE_FLOAT32_C(    33.62),
+      SIMDE_FLOAT32_C(   376.24), SIMDE_FLOAT32_C(  2920.60), SIMDE_FLOAT32_C(   -13.33), SIMDE_FLOAT32_C(    39.51),
+      SIMDE_FLOAT32_C(   -87.13), SIMDE_FLOAT32_C(  1866.17), SIMDE_FLOAT32_C( -2946.94), SIMDE_FLOAT32_C(   -22.73),
+      SIMDE_FLOAT32_C( -2866.27), SIMDE_FLOAT32_C(   766.88), SIMDE_FLOAT32_C(   -69.67), SIMDE_FLOAT32_C(     4.00),
+      SIMDE_FLOAT32_C( -6719.04), SIMDE_FLOAT32_C(   573.90), SIMDE_FLOAT32_C(   -40.22), SIMDE_FLOAT32_C(   -67.50),
+      SIMDE_FLOAT32_C(   -29.45), SIMDE_FLOAT32_C(   -14.86), SIMDE_FLOAT32_C(    97.16), SIMDE_FLOAT32_C(    48.45),
+      SIMDE_FLOAT32_C( -1486.58), SIMDE_FLOAT32_C(    -5.50), SIMDE_FLOAT32_C(  3791.75), SIMDE_FLOAT32_C(   -12.80),
+      SIMDE_FLOAT32_C(   -67.75), SIMDE_FLOAT32_C( -1009.11), SIMDE_FLOAT32_C(  8299.55), SIMDE_FLOAT32_C(    -1.21),
+      SIMDE_FLOAT32_C(    62.47), SIMDE_FLOAT32_C(    29.87), SIMDE_FLOAT32_C(   -79.79), SIMDE_FLOAT32_C(   -19.32),
+      SIMDE_FLOAT32_C(    68.50), SIMDE_FLOAT32_C(   301.46), SIMDE_FLOAT32_C(   290.30), SIMDE_FLOAT32_C(    81.37),
+      SIMDE_FLOAT32_C(   829.34), SIMDE_FLOAT32_C(   -87.02), SIMDE_FLOAT32_C(   -41.36), SIMDE_FLOAT32_C(    31.66),
+      SIMDE_FLOAT32_C(    96.70), SIMDE_FLOAT32_C(  -113.17), SIMDE_FLOAT32_C( -1231.47), SIMDE_FLOAT32_C(   -94.94),
+      SIMDE_FLOAT32_C(    51.47), SIMDE_FLOAT32_C(    -4.56), SIMDE_FLOAT32_C(   -62.44), SIMDE_FLOAT32_C(  2943.75),
+      SIMDE_FLOAT32_C(  7554.38), SIMDE_FLOAT32_C(  4350.91), SIMDE_FLOAT32_C(  2565.81), SIMDE_FLOAT32_C(    40.33),
+      SIMDE_FLOAT32_C( -2223.06), SIMDE_FLOAT32_C(  -155.93), SIMDE_FLOAT32_C(   -72.47), SIMDE_FLOAT32_C(    61.47),
+      SIMDE_FLOAT32_C(  5212.04), SIMDE_FLOAT32_C(   -77.04), SIMDE_FLOAT32_C(   -51.94), SIMDE_FLOAT32_C(    74.73),
+      SIMDE_FLOAT32_C(    52.83), SIMDE_FLOAT32_C(  2160.81), SIMDE_FLOAT32_C( -2369.87), SIMDE_FLOAT32_C(  1315.85),
+      SIMDE_FLOAT32_C(    75.14), SIMDE_FLOAT32_C(  2887.08) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i])),
+      bv = simde_svld1_f32(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_f32_m(pv, av, bv);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b[1024 / sizeof(int32_t)], e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+    bv = simde_svld1_f32(pg, &(b[i]));
+
+    ev = simde_svmul_f32_m(pv, av, bv);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   -73.76), SIMDE_FLOAT64_C(   -28.72), SIMDE_FLOAT64_C(    56.08), SIMDE_FLOAT64_C(    52.57),
+      SIMDE_FLOAT64_C(   -42.10), SIMDE_FLOAT64_C(    22.65), SIMDE_FLOAT64_C(   -12.41), SIMDE_FLOAT64_C(   -74.56),
+      SIMDE_FLOAT64_C(   -71.65), SIMDE_FLOAT64_C(    -2.66), SIMDE_FLOAT64_C(   -85.21), SIMDE_FLOAT64_C(    -9.90),
+      SIMDE_FLOAT64_C(    82.85), SIMDE_FLOAT64_C(   -72.81), SIMDE_FLOAT64_C(   -61.45), SIMDE_FLOAT64_C(   -47.56),
+      SIMDE_FLOAT64_C(   -21.11), SIMDE_FLOAT64_C(    41.75), SIMDE_FLOAT64_C(    -8.51), SIMDE_FLOAT64_C(     7.31),
+      SIMDE_FLOAT64_C(    77.19), SIMDE_FLOAT64_C(   -83.11), SIMDE_FLOAT64_C(   -37.70), SIMDE_FLOAT64_C(    80.85),
+      SIMDE_FLOAT64_C(    65.17), SIMDE_FLOAT64_C(     7.64), SIMDE_FLOAT64_C(    34.29), SIMDE_FLOAT64_C(    26.41),
+      SIMDE_FLOAT64_C(    48.67), SIMDE_FLOAT64_C(   -44.57), SIMDE_FLOAT64_C(     4.38), SIMDE_FLOAT64_C(    74.90),
+      SIMDE_FLOAT64_C(    26.71), SIMDE_FLOAT64_C(   -39.54), SIMDE_FLOAT64_C(    27.47), SIMDE_FLOAT64_C(    84.61),
+      SIMDE_FLOAT64_C(    83.11), SIMDE_FLOAT64_C(   -84.94), SIMDE_FLOAT64_C(   -89.95), SIMDE_FLOAT64_C(   -88.54),
+      SIMDE_FLOAT64_C(    12.40), SIMDE_FLOAT64_C(   -75.17), SIMDE_FLOAT64_C(     1.55), SIMDE_FLOAT64_C(    -4.75),
+      SIMDE_FLOAT64_C(   -47.98), SIMDE_FLOAT64_C(    40.10), SIMDE_FLOAT64_C(    47.69), SIMDE_FLOAT64_C(    30.91),
+      SIMDE_FLOAT64_C(   -18.15), SIMDE_FLOAT64_C(   -60.82), SIMDE_FLOAT64_C(   -61.78), SIMDE_FLOAT64_C(   -40.96),
+      SIMDE_FLOAT64_C(   -43.92), SIMDE_FLOAT64_C(     0.52), SIMDE_FLOAT64_C(   -60.11), SIMDE_FLOAT64_C(   -78.75),
+      SIMDE_FLOAT64_C(   -91.84), SIMDE_FLOAT64_C(    74.18), SIMDE_FLOAT64_C(    47.65), SIMDE_FLOAT64_C(    56.83),
+      SIMDE_FLOAT64_C(   -70.39), SIMDE_FLOAT64_C(   -47.96), SIMDE_FLOAT64_C(    31.73), SIMDE_FLOAT64_C(    56.32),
+      SIMDE_FLOAT64_C(    12.50), SIMDE_FLOAT64_C(   -40.80), SIMDE_FLOAT64_C(    40.92), SIMDE_FLOAT64_C(    -4.40),
+      SIMDE_FLOAT64_C(   -25.74), SIMDE_FLOAT64_C(    50.97), SIMDE_FLOAT64_C(     7.06), SIMDE_FLOAT64_C(    86.66),
+      SIMDE_FLOAT64_C(    75.81), SIMDE_FLOAT64_C(   -91.39), SIMDE_FLOAT64_C(   -18.09), SIMDE_FLOAT64_C(   -72.17),
+      SIMDE_FLOAT64_C(    48.71), SIMDE_FLOAT64_C(   -70.40), SIMDE_FLOAT64_C(    58.74), SIMDE_FLOAT64_C(   -69.44),
+      SIMDE_FLOAT64_C(   -31.21), SIMDE_FLOAT64_C(    96.96), SIMDE_FLOAT64_C(   -10.40), SIMDE_FLOAT64_C(    24.86),
+      SIMDE_FLOAT64_C(    -2.52), SIMDE_FLOAT64_C(    29.49), SIMDE_FLOAT64_C(    46.11), SIMDE_FLOAT64_C(     5.64),
+      SIMDE_FLOAT64_C(     3.67), SIMDE_FLOAT64_C(    -6.24), SIMDE_FLOAT64_C(   -37.53), SIMDE_FLOAT64_C(    33.28),
+      SIMDE_FLOAT64_C(    45.80), SIMDE_FLOAT64_C(    94.20), SIMDE_FLOAT64_C(   -10.40), SIMDE_FLOAT64_C(   -41.70),
+      SIMDE_FLOAT64_C(   -46.60), SIMDE_FLOAT64_C(   -69.48), SIMDE_FLOAT64_C(    53.90), SIMDE_FLOAT64_C(    27.66),
+      SIMDE_FLOAT64_C(    81.49), SIMDE_FLOAT64_C(   -39.04), SIMDE_FLOAT64_C(    14.32), SIMDE_FLOAT64_C(    57.30),
+      SIMDE_FLOAT64_C(   -30.43), SIMDE_FLOAT64_C(    96.23), SIMDE_FLOAT64_C(    85.12), SIMDE_FLOAT64_C(   -81.72),
+      SIMDE_FLOAT64_C(   -74.17), SIMDE_FLOAT64_C(    43.86), SIMDE_FLOAT64_C(   -51.16), SIMDE_FLOAT64_C(    -5.39),
+      SIMDE_FLOAT64_C(    40.82) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(    38.44), SIMDE_FLOAT64_C(   -80.52), SIMDE_FLOAT64_C(   -61.70), SIMDE_FLOAT64_C(   -32.07),
+      SIMDE_FLOAT64_C(    65.59), SIMDE_FLOAT64_C(    43.94), SIMDE_FLOAT64_C(    71.60), SIMDE_FLOAT64_C(   -40.65),
+      SIMDE_FLOAT64_C(   -93.59), SIMDE_FLOAT64_C(     4.87), SIMDE_FLOAT64_C(   -94.85), SIMDE_FLOAT64_C(   -99.39),
+      SIMDE_FLOAT64_C(    94.47), SIMDE_FLOAT64_C(   -36.55), SIMDE_FLOAT64_C(   -45.99), SIMDE_FLOAT64_C(   -75.01),
+      SIMDE_FLOAT64_C(   -82.65), SIMDE_FLOAT64_C(    81.66), SIMDE_FLOAT64_C(   -93.52), SIMDE_FLOAT64_C(   -21.69),
+      SIMDE_FLOAT64_C(    -4.02), SIMDE_FLOAT64_C(    63.78), SIMDE_FLOAT64_C(    47.88), SIMDE_FLOAT64_C(    -7.79),
+      SIMDE_FLOAT64_C(    48.90), SIMDE_FLOAT64_C(    66.17), SIMDE_FLOAT64_C(    18.03), SIMDE_FLOAT64_C(    -7.23),
+      SIMDE_FLOAT64_C(   -84.99), SIMDE_FLOAT64_C(   -87.35), SIMDE_FLOAT64_C(   -66.41), SIMDE_FLOAT64_C(    53.45),
+      SIMDE_FLOAT64_C(   -67.88), SIMDE_FLOAT64_C(   -28.11), SIMDE_FLOAT64_C(   -78.62), SIMDE_FLOAT64_C(    97.71),
+      SIMDE_FLOAT64_C(   -84.16), SIMDE_FLOAT64_C(    92.98), SIMDE_FLOAT64_C(   -42.94), SIMDE_FLOAT64_C(   -77.76),
+      SIMDE_FLOAT64_C(    -2.15), SIMDE_FLOAT64_C(   -37.79), SIMDE_FLOAT64_C(   -77.15), SIMDE_FLOAT64_C(    -7.68),
+      SIMDE_FLOAT64_C(    25.66), SIMDE_FLOAT64_C(   -23.14), SIMDE_FLOAT64_C(    17.31), SIMDE_FLOAT64_C(    43.01),
+      SIMDE_FLOAT64_C(   -41.48), SIMDE_FLOAT64_C(    23.79), SIMDE_FLOAT64_C(   -78.68), SIMDE_FLOAT64_C(    54.50),
+      SIMDE_FLOAT64_C(   -12.43), SIMDE_FLOAT64_C(    69.21), SIMDE_FLOAT64_C(   -53.29), SIMDE_FLOAT64_C(   -63.52),
+      SIMDE_FLOAT64_C(    35.38), SIMDE_FLOAT64_C(    64.74), SIMDE_FLOAT64_C(    29.24), SIMDE_FLOAT64_C(    50.39),
+      SIMDE_FLOAT64_C(    77.39), SIMDE_FLOAT64_C(    62.83), SIMDE_FLOAT64_C(     3.84), SIMDE_FLOAT64_C(   -90.49),
+      SIMDE_FLOAT64_C(   -65.27), SIMDE_FLOAT64_C(    25.22), SIMDE_FLOAT64_C(   -92.78), SIMDE_FLOAT64_C(   -49.44),
+      SIMDE_FLOAT64_C(    18.20), SIMDE_FLOAT64_C(   -35.72), SIMDE_FLOAT64_C(   -27.19), SIMDE_FLOAT64_C(   -83.95),
+      SIMDE_FLOAT64_C(    26.49), SIMDE_FLOAT64_C(    -4.34), SIMDE_FLOAT64_C(     8.37), SIMDE_FLOAT64_C(   -47.84),
+      SIMDE_FLOAT64_C(    72.51), SIMDE_FLOAT64_C(   -74.31), SIMDE_FLOAT64_C(    95.17), SIMDE_FLOAT64_C(   -68.97),
+      SIMDE_FLOAT64_C(    49.48), SIMDE_FLOAT64_C(   -83.51), SIMDE_FLOAT64_C(    85.53), SIMDE_FLOAT64_C(   -62.95),
+      SIMDE_FLOAT64_C(    85.69), SIMDE_FLOAT64_C(   -67.76), SIMDE_FLOAT64_C(   -26.47), SIMDE_FLOAT64_C(    21.07),
+      SIMDE_FLOAT64_C(    96.98), SIMDE_FLOAT64_C(   -97.23), SIMDE_FLOAT64_C(   -28.54), SIMDE_FLOAT64_C(    74.37),
+      SIMDE_FLOAT64_C(    65.60), SIMDE_FLOAT64_C(    75.30), SIMDE_FLOAT64_C(    83.88), SIMDE_FLOAT64_C(   -99.67),
+      SIMDE_FLOAT64_C(     0.52), SIMDE_FLOAT64_C(    91.10), SIMDE_FLOAT64_C(   -49.11), SIMDE_FLOAT64_C(   -81.28),
+      SIMDE_FLOAT64_C(   -44.62), SIMDE_FLOAT64_C(    23.70), SIMDE_FLOAT64_C(   -65.23), SIMDE_FLOAT64_C(    81.87),
+      SIMDE_FLOAT64_C(   -80.65), SIMDE_FLOAT64_C(    43.15), SIMDE_FLOAT64_C(   -65.97), SIMDE_FLOAT64_C(    91.87),
+      SIMDE_FLOAT64_C(    68.83), SIMDE_FLOAT64_C(   -70.80), SIMDE_FLOAT64_C(   -77.10), SIMDE_FLOAT64_C(    18.31),
+      SIMDE_FLOAT64_C(   -54.32) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -1685.92),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -888.56), SIMDE_FLOAT64_C(  3030.86),
+      SIMDE_FLOAT64_C(  6705.72), SIMDE_FLOAT64_C(   -12.95), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   983.96),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  2661.21), SIMDE_FLOAT64_C(  2826.09), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  1744.74), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -310.30), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -190.94),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  3893.19), SIMDE_FLOAT64_C(  -290.88), SIMDE_FLOAT64_C(  4003.41),
+      SIMDE_FLOAT64_C( -1813.07), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -2159.69), SIMDE_FLOAT64_C(  8267.24),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -7897.72), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(   -26.66), SIMDE_FLOAT64_C(  2840.67), SIMDE_FLOAT64_C(  -119.58), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -1231.17), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   825.51), SIMDE_FLOAT64_C(  1329.44),
+      SIMDE_FLOAT64_C(   752.86), SIMDE_FLOAT64_C( -1446.91), SIMDE_FLOAT64_C(  4860.85), SIMDE_FLOAT64_C( -2232.32),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -3249.30), SIMDE_FLOAT64_C(  4802.41), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  2863.66),
+      SIMDE_FLOAT64_C( -5447.48), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -1028.98), SIMDE_FLOAT64_C( -3796.56), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  -468.47), SIMDE_FLOAT64_C( -1820.65), SIMDE_FLOAT64_C(  -191.96), SIMDE_FLOAT64_C( -7275.11),
+      SIMDE_FLOAT64_C(  2008.21), SIMDE_FLOAT64_C(   396.63), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  5590.29), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -8097.13), SIMDE_FLOAT64_C(  -889.51), SIMDE_FLOAT64_C( -1564.94),
+      SIMDE_FLOAT64_C(  -215.94), SIMDE_FLOAT64_C( -1998.24), SIMDE_FLOAT64_C( -1220.53), SIMDE_FLOAT64_C(   118.83),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   606.72), SIMDE_FLOAT64_C(  1071.11), SIMDE_FLOAT64_C(  2475.03),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  7093.26), SIMDE_FLOAT64_C(  -872.35), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -2248.20),
+      SIMDE_FLOAT64_C( -3636.08), SIMDE_FLOAT64_C(  -925.25), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  2454.18), SIMDE_FLOAT64_C(  4152.32), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -7507.62),
+      SIMDE_FLOAT64_C( -5105.12), SIMDE_FLOAT64_C( -3105.29), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -2217.34) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_f64_z(pv, av, bv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+
+    ev = simde_svmul_f64_z(pv, av, bv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(    85.93), SIMDE_FLOAT64_C(   -46.17), SIMDE_FLOAT64_C(   -55.12), SIMDE_FLOAT64_C(    72.95),
+      SIMDE_FLOAT64_C(    26.29), SIMDE_FLOAT64_C(    66.17), SIMDE_FLOAT64_C(   -78.12), SIMDE_FLOAT64_C(    76.71),
+      SIMDE_FLOAT64_C(   -78.34), SIMDE_FLOAT64_C(   -71.93), SIMDE_FLOAT64_C(    13.77), SIMDE_FLOAT64_C(    22.47),
+      SIMDE_FLOAT64_C(    96.31), SIMDE_FLOAT64_C(   -67.33), SIMDE_FLOAT64_C(     6.74), SIMDE_FLOAT64_C(    17.44),
+      SIMDE_FLOAT64_C(   -30.44), SIMDE_FLOAT64_C(    95.34), SIMDE_FLOAT64_C(    97.48), SIMDE_FLOAT64_C(   -32.94),
+      SIMDE_FLOAT64_C(   -93.67), SIMDE_FLOAT64_C(    11.16), SIMDE_FLOAT64_C(   -33.31), SIMDE_FLOAT64_C(   -78.07),
+      SIMDE_FLOAT64_C(    44.48), SIMDE_FLOAT64_C(   -29.24), SIMDE_FLOAT64_C(   -97.19), SIMDE_FLOAT64_C(    11.83),
+      SIMDE_FLOAT64_C(   -45.00), SIMDE_FLOAT64_C(     0.21), SIMDE_FLOAT64_C(   -39.33), SIMDE_FLOAT64_C(   -59.07),
+      SIMDE_FLOAT64_C(    54.04), SIMDE_FLOAT64_C(     5.55), SIMDE_FLOAT64_C(   -86.11), SIMDE_FLOAT64_C(   -19.67),
+      SIMDE_FLOAT64_C(   -28.28), SIMDE_FLOAT64_C(   -64.23), SIMDE_FLOAT64_C(   -42.96), SIMDE_FLOAT64_C(    -6.61),
+      SIMDE_FLOAT64_C(   -36.17), SIMDE_FLOAT64_C(    70.81), SIMDE_FLOAT64_C(   -84.15), SIMDE_FLOAT64_C(   -39.86),
+      SIMDE_FLOAT64_C(   -96.52), SIMDE_FLOAT64_C(    22.59), SIMDE_FLOAT64_C(    77.58), SIMDE_FLOAT64_C(   -26.96),
+      SIMDE_FLOAT64_C(    17.93), SIMDE_FLOAT64_C(    75.06), SIMDE_FLOAT64_C(    40.10), SIMDE_FLOAT64_C(    24.27),
+      SIMDE_FLOAT64_C(   -13.78), SIMDE_FLOAT64_C(   -93.21), SIMDE_FLOAT64_C(    46.19), SIMDE_FLOAT64_C(   -69.30),
+      SIMDE_FLOAT64_C(   -22.45), SIMDE_FLOAT64_C(    49.00), SIMDE_FLOAT64_C(    42.53), SIMDE_FLOAT64_C(    32.55),
+      SIMDE_FLOAT64_C(   -50.79), SIMDE_FLOAT64_C(   -96.80), SIMDE_FLOAT64_C(    73.48), SIMDE_FLOAT64_C(   -96.74),
+      SIMDE_FLOAT64_C(     8.75), SIMDE_FLOAT64_C(    87.37), SIMDE_FLOAT64_C(   -16.41), SIMDE_FLOAT64_C(    80.48),
+      SIMDE_FLOAT64_C(   -76.87), SIMDE_FLOAT64_C(    40.63), SIMDE_FLOAT64_C(   -26.13), SIMDE_FLOAT64_C(   -13.03),
+      SIMDE_FLOAT64_C(    11.44), SIMDE_FLOAT64_C(   -10.28), SIMDE_FLOAT64_C(    47.11), SIMDE_FLOAT64_C(    14.92),
+      SIMDE_FLOAT64_C(   -87.69), SIMDE_FLOAT64_C(    24.68), SIMDE_FLOAT64_C(    87.95), SIMDE_FLOAT64_C(    30.24),
+      SIMDE_FLOAT64_C(    -0.26), SIMDE_FLOAT64_C(    28.05), SIMDE_FLOAT64_C(   -45.49), SIMDE_FLOAT64_C(    85.96),
+      SIMDE_FLOAT64_C(    34.84), SIMDE_FLOAT64_C(   -99.30), SIMDE_FLOAT64_C(   -83.34), SIMDE_FLOAT64_C(   -87.61),
+      SIMDE_FLOAT64_C(    49.70), SIMDE_FLOAT64_C(    59.20), SIMDE_FLOAT64_C(    44.94), SIMDE_FLOAT64_C(    98.91),
+      SIMDE_FLOAT64_C(    62.40), SIMDE_FLOAT64_C(    18.42), SIMDE_FLOAT64_C(   -97.83), SIMDE_FLOAT64_C(   -28.85),
+      SIMDE_FLOAT64_C(     5.79), SIMDE_FLOAT64_C(   -14.24), SIMDE_FLOAT64_C(   -48.37), SIMDE_FLOAT64_C(    28.92),
+      SIMDE_FLOAT64_C(   -73.61), SIMDE_FLOAT64_C(    25.50), SIMDE_FLOAT64_C(   -84.11) };
+  static const simde_float64 b[] =
+    { SIMDE_FLOAT64_C(    37.82), SIMDE_FLOAT64_C(   -84.78), SIMDE_FLOAT64_C(    63.00), SIMDE_FLOAT64_C(   -47.26),
+      SIMDE_FLOAT64_C(   -72.46), SIMDE_FLOAT64_C(   -12.32), SIMDE_FLOAT64_C(   -59.30), SIMDE_FLOAT64_C(    57.78),
+      SIMDE_FLOAT64_C(    87.42), SIMDE_FLOAT64_C(    68.75), SIMDE_FLOAT64_C(   -87.71), SIMDE_FLOAT64_C(    73.39),
+      SIMDE_FLOAT64_C(     3.59), SIMDE_FLOAT64_C(   -87.00), SIMDE_FLOAT64_C(    90.05), SIMDE_FLOAT64_C(    15.98),
+      SIMDE_FLOAT64_C(    62.70), SIMDE_FLOAT64_C(    49.25), SIMDE_FLOAT64_C(   -39.08), SIMDE_FLOAT64_C(    61.61),
+      SIMDE_FLOAT64_C(    11.64), SIMDE_FLOAT64_C(    79.34), SIMDE_FLOAT64_C(    63.78), SIMDE_FLOAT64_C(    82.80),
+      SIMDE_FLOAT64_C(   -14.87), SIMDE_FLOAT64_C(   -50.46), SIMDE_FLOAT64_C(   -65.57), SIMDE_FLOAT64_C(   -85.95),
+      SIMDE_FLOAT64_C(   -24.07), SIMDE_FLOAT64_C(    59.93), SIMDE_FLOAT64_C(   -70.06), SIMDE_FLOAT64_C(   -86.25),
+      SIMDE_FLOAT64_C(    75.16), SIMDE_FLOAT64_C(    92.94), SIMDE_FLOAT64_C(   -33.51), SIMDE_FLOAT64_C(   -97.31),
+      SIMDE_FLOAT64_C(   -19.38), SIMDE_FLOAT64_C(     7.19), SIMDE_FLOAT64_C(    60.48), SIMDE_FLOAT64_C(   -31.96),
+      SIMDE_FLOAT64_C(   -24.06), SIMDE_FLOAT64_C(    72.77), SIMDE_FLOAT64_C(   -58.58), SIMDE_FLOAT64_C(    79.53),
+      SIMDE_FLOAT64_C(    85.76), SIMDE_FLOAT64_C(   -68.53), SIMDE_FLOAT64_C(    -4.48), SIMDE_FLOAT64_C(    48.46),
+      SIMDE_FLOAT64_C(    80.72), SIMDE_FLOAT64_C(    56.44), SIMDE_FLOAT64_C(    10.07), SIMDE_FLOAT64_C(    -7.64),
+      SIMDE_FLOAT64_C(    35.78), SIMDE_FLOAT64_C(   -26.14), SIMDE_FLOAT64_C(   -24.84), SIMDE_FLOAT64_C(   -79.09),
+      SIMDE_FLOAT64_C(    23.40), SIMDE_FLOAT64_C(     9.59), SIMDE_FLOAT64_C(   -65.04), SIMDE_FLOAT64_C(    99.32),
+      SIMDE_FLOAT64_C(   -30.48), SIMDE_FLOAT64_C(   -35.10), SIMDE_FLOAT64_C(   -86.93), SIMDE_FLOAT64_C(   -55.32),
+      SIMDE_FLOAT64_C(   -42.16), SIMDE_FLOAT64_C(   -20.44), SIMDE_FLOAT64_C(   -52.62), SIMDE_FLOAT64_C(    38.45),
+      SIMDE_FLOAT64_C(    86.75), SIMDE_FLOAT64_C(   -92.15), SIMDE_FLOAT64_C(   -93.51), SIMDE_FLOAT64_C(   -37.31),
+      SIMDE_FLOAT64_C(    80.62), SIMDE_FLOAT64_C(   -52.09), SIMDE_FLOAT64_C(   -57.78), SIMDE_FLOAT64_C(    66.38),
+      SIMDE_FLOAT64_C(   -20.62), SIMDE_FLOAT64_C(    37.73), SIMDE_FLOAT64_C(    14.85), SIMDE_FLOAT64_C(   -39.90),
+      SIMDE_FLOAT64_C(    -5.83), SIMDE_FLOAT64_C(   -75.08), SIMDE_FLOAT64_C(    52.46), SIMDE_FLOAT64_C(   -70.05),
+      SIMDE_FLOAT64_C(    -1.22), SIMDE_FLOAT64_C(   -72.39), SIMDE_FLOAT64_C(   -49.15), SIMDE_FLOAT64_C(   -77.82),
+      SIMDE_FLOAT64_C(    37.21), SIMDE_FLOAT64_C(   -14.19), SIMDE_FLOAT64_C(   -78.50), SIMDE_FLOAT64_C(   -93.27),
+      SIMDE_FLOAT64_C(    50.72), SIMDE_FLOAT64_C(   -65.43), SIMDE_FLOAT64_C(   -48.59), SIMDE_FLOAT64_C(   -91.45),
+      SIMDE_FLOAT64_C(    14.13), SIMDE_FLOAT64_C(    -1.21), SIMDE_FLOAT64_C(    47.01), SIMDE_FLOAT64_C(     0.88),
+      SIMDE_FLOAT64_C(     6.64), SIMDE_FLOAT64_C(    53.50), SIMDE_FLOAT64_C(    63.57) };
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(  3249.87), SIMDE_FLOAT64_C(   -46.17), SIMDE_FLOAT64_C( -3472.56), SIMDE_FLOAT64_C( -3447.62),
+      SIMDE_FLOAT64_C( -1904.97), SIMDE_FLOAT64_C(    66.17), SIMDE_FLOAT64_C(  4632.52), SIMDE_FLOAT64_C(    76.71),
+      SIMDE_FLOAT64_C( -6848.48), SIMDE_FLOAT64_C( -4945.19), SIMDE_FLOAT64_C(    13.77), SIMDE_FLOAT64_C(  1649.07),
+      SIMDE_FLOAT64_C(    96.31), SIMDE_FLOAT64_C(  5857.71), SIMDE_FLOAT64_C(     6.74), SIMDE_FLOAT64_C(   278.69),
+      SIMDE_FLOAT64_C( -1908.59), SIMDE_FLOAT64_C(    95.34), SIMDE_FLOAT64_C(    97.48), SIMDE_FLOAT64_C( -2029.43),
+      SIMDE_FLOAT64_C(   -93.67), SIMDE_FLOAT64_C(    11.16), SIMDE_FLOAT64_C( -2124.51), SIMDE_FLOAT64_C( -6464.20),
+      SIMDE_FLOAT64_C(    44.48), SIMDE_FLOAT64_C(  1475.45), SIMDE_FLOAT64_C(   -97.19), SIMDE_FLOAT64_C( -1016.79),
+      SIMDE_FLOAT64_C(  1083.15), SIMDE_FLOAT64_C(    12.59), SIMDE_FLOAT64_C(   -39.33), SIMDE_FLOAT64_C(   -59.07),
+      SIMDE_FLOAT64_C(    54.04), SIMDE_FLOAT64_C(   515.82), SIMDE_FLOAT64_C(   -86.11), SIMDE_FLOAT64_C(  1914.09),
+      SIMDE_FLOAT64_C(   548.07), SIMDE_FLOAT64_C(  -461.81), SIMDE_FLOAT64_C( -2598.22), SIMDE_FLOAT64_C(    -6.61),
+      SIMDE_FLOAT64_C(   -36.17), SIMDE_FLOAT64_C(    70.81), SIMDE_FLOAT64_C(  4929.51), SIMDE_FLOAT64_C(   -39.86),
+      SIMDE_FLOAT64_C( -8277.56), SIMDE_FLOAT64_C(    22.59), SIMDE_FLOAT64_C(    77.58), SIMDE_FLOAT64_C(   -26.96),
+      SIMDE_FLOAT64_C(    17.93), SIMDE_FLOAT64_C(    75.06), SIMDE_FLOAT64_C(    40.10), SIMDE_FLOAT64_C(    24.27),
+      SIMDE_FLOAT64_C(   -13.78), SIMDE_FLOAT64_C(  2436.51), SIMDE_FLOAT64_C(    46.19), SIMDE_FLOAT64_C(   -69.30),
+      SIMDE_FLOAT64_C(  -525.33), SIMDE_FLOAT64_C(   469.91), SIMDE_FLOAT64_C(    42.53), SIMDE_FLOAT64_C(    32.55),
+      SIMDE_FLOAT64_C(   -50.79), SIMDE_FLOAT64_C(   -96.80), SIMDE_FLOAT64_C( -6387.62), SIMDE_FLOAT64_C(   -96.74),
+      SIMDE_FLOAT64_C(  -368.90), SIMDE_FLOAT64_C( -1785.84), SIMDE_FLOAT64_C(   863.49), SIMDE_FLOAT64_C(    80.48),
+      SIMDE_FLOAT64_C(   -76.87), SIMDE_FLOAT64_C( -3744.05), SIMDE_FLOAT64_C(   -26.13), SIMDE_FLOAT64_C(   486.15),
+      SIMDE_FLOAT64_C(   922.29), SIMDE_FLOAT64_C(   -10.28), SIMDE_FLOAT64_C( -2722.02), SIMDE_FLOAT64_C(   990.39),
+      SIMDE_FLOAT64_C(   -87.69), SIMDE_FLOAT64_C(    24.68), SIMDE_FLOAT64_C(  1306.06), SIMDE_FLOAT64_C( -1206.58),
+      SIMDE_FLOAT64_C(    -0.26), SIMDE_FLOAT64_C( -2105.99), SIMDE_FLOAT64_C( -2386.41), SIMDE_FLOAT64_C( -6021.50),
+      SIMDE_FLOAT64_C(    34.84), SIMDE_FLOAT64_C(  7188.33), SIMDE_FLOAT64_C(   -83.34), SIMDE_FLOAT64_C(   -87.61),
+      SIMDE_FLOAT64_C(  1849.34), SIMDE_FLOAT64_C(    59.20), SIMDE_FLOAT64_C(    44.94), SIMDE_FLOAT64_C(    98.91),
+      SIMDE_FLOAT64_C(    62.40), SIMDE_FLOAT64_C( -1205.22), SIMDE_FLOAT64_C(  4753.56), SIMDE_FLOAT64_C(   -28.85),
+      SIMDE_FLOAT64_C(     5.79), SIMDE_FLOAT64_C(   -14.24), SIMDE_FLOAT64_C(   -48.37), SIMDE_FLOAT64_C(    25.45),
+      SIMDE_FLOAT64_C(  -488.77), SIMDE_FLOAT64_C(  1364.25), SIMDE_FLOAT64_C(   -84.11) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i])),
+      bv = simde_svld1_f64(pg, &(b[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_f64_m(pv, av, bv);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b[1024 / sizeof(int64_t)], e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), b, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, bv, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+    bv = simde_svld1_f64(pg, &(b[i]));
+
+    ev = simde_svmul_f64_m(pv, av, bv);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    { -INT8_C( 102),  INT8_C(   9), -INT8_C(  50),      INT8_MAX,  INT8_C(  82), -INT8_C(   9),  INT8_C(  32),  INT8_C( 121),
+      -INT8_C( 110), -INT8_C(  31),  INT8_C(  32),  INT8_C(  44), -INT8_C(  59), -INT8_C(  80),  INT8_C(  94), -INT8_C(  41),
+      -INT8_C(  86),      INT8_MAX, -INT8_C(  69),  INT8_C(  53),  INT8_C( 113), -INT8_C(  80),  INT8_C( 118), -INT8_C(  15),
+      -INT8_C(  14), -INT8_C(  91),  INT8_C(  82), -INT8_C(  78), -INT8_C(  71), -INT8_C(  59), -INT8_C(  58),  INT8_C(  83),
+      -INT8_C(  50), -INT8_C( 108), -INT8_C(  45),  INT8_C(  32), -INT8_C( 117), -INT8_C(  13), -INT8_C( 102),  INT8_C(  29),
+      -INT8_C(  43), -INT8_C(  70),  INT8_C(  74), -INT8_C( 102),  INT8_C( 106), -INT8_C(  88),  INT8_C( 113),  INT8_C(  21),
+       INT8_C(  39),  INT8_C(  44),  INT8_C(  74), -INT8_C( 104), -INT8_C(  36), -INT8_C(  64), -INT8_C( 119), -INT8_C(  49),
+       INT8_C( 101), -INT8_C(  37), -INT8_C( 127),  INT8_C(  30), -INT8_C(  95),  INT8_C(  72),  INT8_C( 114),  INT8_C( 111),
+      -INT8_C(  36),  INT8_C(  69), -INT8_C( 112),  INT8_C( 104),  INT8_C(  56),  INT8_C(  42), -INT8_C( 123),  INT8_C(  13),
+      -INT8_C(  28), -INT8_C(  49), -INT8_C(  88),  INT8_C(  78),  INT8_C( 119),  INT8_C(  25),  INT8_C(  99), -INT8_C(  97),
+       INT8_C(  70), -INT8_C(  83),  INT8_C(  55),  INT8_C(  34),  INT8_C( 109), -INT8_C(  63), -INT8_C(  15), -INT8_C(  46),
+      -INT8_C( 100),  INT8_C( 115), -INT8_C(  15),  INT8_C(  61), -INT8_C(  69),  INT8_C(  99), -INT8_C(  83), -INT8_C( 105),
+      -INT8_C(  88),  INT8_C(  61), -INT8_C(   1), -INT8_C(  32),  INT8_C( 103), -INT8_C( 123), -INT8_C(  18),  INT8_C(  75),
+       INT8_C(  84), -INT8_C( 106), -INT8_C( 103), -INT8_C(  52), -INT8_C(  81), -INT8_C(   3),  INT8_C( 107), -INT8_C(  11),
+      -INT8_C(  86), -INT8_C(  94),  INT8_C(  24),  INT8_C(  24),  INT8_C(  99),  INT8_C(   9), -INT8_C(  22),  INT8_C(   0),
+       INT8_C( 124), -INT8_C(  37),  INT8_C(  61),  INT8_C(  55),  INT8_C(  62), -INT8_C(  22), -INT8_C(  49), -INT8_C(  26),
+       INT8_C(  39), -INT8_C(  50), -INT8_C(  57), -INT8_C( 114),  INT8_C(  83), -INT8_C(  75), -INT8_C(  39), -INT8_C(  88),
+       INT8_C(  75),  INT8_C( 115),  INT8_C( 116), -INT8_C(   6),  INT8_C( 112), -INT8_C(  33), -INT8_C(  16),  INT8_C(  26),
+      -INT8_C( 127),  INT8_C(   8),  INT8_C(  50), -INT8_C(  27),  INT8_C(  17),  INT8_C(  29), -INT8_C(  27), -INT8_C( 114),
+      -INT8_C(   8),  INT8_C(  34), -INT8_C(  59),  INT8_C(  55),  INT8_C(  13), -INT8_C( 108),  INT8_C(  29),  INT8_C(  52),
+       INT8_C(  99), -INT8_C(  28), -INT8_C(  61), -INT8_C(  74), -INT8_C( 103), -INT8_C( 100),  INT8_C(  94), -INT8_C(  28),
+       INT8_C(  15), -INT8_C(  46), -INT8_C(  33),      INT8_MAX, -INT8_C(  79), -INT8_C(  49), -INT8_C( 102),  INT8_C(  51),
+      -INT8_C(  41), -INT8_C(  52),  INT8_C(  24), -INT8_C(  24), -INT8_C(  23), -INT8_C(   3),  INT8_C( 118), -INT8_C(  30),
+       INT8_C(  31),  INT8_C(  60),  INT8_C(  25),  INT8_C(  44), -INT8_C(  48),  INT8_C(  54),  INT8_C(  97),  INT8_C(  51),
+       INT8_C(  27),  INT8_C(  36), -INT8_C(  22), -INT8_C(  76), -INT8_C(  64),  INT8_C(  72), -INT8_C( 103), -INT8_C(  48),
+       INT8_C(  27),  INT8_C( 120),  INT8_C(  79), -INT8_C(  52),  INT8_C(  71), -INT8_C(  23), -INT8_C(   1),  INT8_C(  30),
+      -INT8_C(  74),  INT8_C(  23),  INT8_C(   6), -INT8_C(  97),  INT8_C(  20),  INT8_C( 125), -INT8_C( 127),  INT8_C(  52),
+      -INT8_C(  71), -INT8_C( 102),  INT8_C(  96), -INT8_C( 119), -INT8_C(  47), -INT8_C(  63), -INT8_C(  67), -INT8_C(  20),
+      -INT8_C(  27), -INT8_C(  89), -INT8_C(  96), -INT8_C(  90), -INT8_C(  17),  INT8_C(  57),  INT8_C( 118),  INT8_C(  10),
+      -INT8_C(  79), -INT8_C(  59), -INT8_C(  41), -INT8_C(   8), -INT8_C(  81), -INT8_C(  42),  INT8_C(  22),  INT8_C( 101),
+      -INT8_C(  18),  INT8_C(  29),  INT8_C(   4),  INT8_C(   2), -INT8_C( 102), -INT8_C( 122),  INT8_C(  54),  INT8_C(  83),
+       INT8_C(  32), -INT8_C( 105), -INT8_C(  36), -INT8_C(  15),  INT8_C(  88), -INT8_C( 103), -INT8_C(  35),  INT8_C(  62),
+       INT8_C(  64),  INT8_C( 126), -INT8_C(  28),  INT8_C(  48), -INT8_C(  73),  INT8_C(  90),  INT8_C(  58),  INT8_C( 105),
+       INT8_C(  31),  INT8_C(  17),  INT8_C(  97), -INT8_C(  50), -INT8_C(  24),  INT8_C( 120),  INT8_C(  51), -INT8_C(  42),
+      -INT8_C( 107),  INT8_C(  56), -INT8_C(  40),  INT8_C(  47), -INT8_C(  66),  INT8_C(  15), -INT8_C( 126), -INT8_C(  34),
+      -INT8_C(  90),  INT8_C(  94), -INT8_C(  48), -INT8_C(   2), -INT8_C(   8), -INT8_C(  83),  INT8_C(  60),  INT8_C(  56),
+       INT8_C(  43),  INT8_C(  32),  INT8_C( 104), -INT8_C(  29),  INT8_C( 122), -INT8_C(  93),  INT8_C(  76), -INT8_C( 102),
+      -INT8_C(  76), -INT8_C(  83),  INT8_C( 104), -INT8_C( 100),  INT8_C(  37), -INT8_C( 100),  INT8_C( 114), -INT8_C(  70),
+      -INT8_C(  44),  INT8_C(  75), -INT8_C(  23), -INT8_C( 110),  INT8_C(  90),  INT8_C( 107),  INT8_C( 112),  INT8_C(   0),
+      -INT8_C(  54),  INT8_C(  64), -INT8_C(   2), -INT8_C(  62), -INT8_C(  18),  INT8_C(  59), -INT8_C(   6),  INT8_C(  25),
+       INT8_C(  91),  INT8_C(  99), -INT8_C(   4), -INT8_C(  42),  INT8_C(   6),  INT8_C(  72),  INT8_C( 112), -INT8_C(  70),
+      -INT8_C(  10), -INT8_C(  40),  INT8_C(  87),  INT8_C(  27),  INT8_C( 116), -INT8_C(  55), -INT8_C(  42),  INT8_C(  72),
+       INT8_C(  20), -INT8_C(  65), -INT8_C(  38),  INT8_C( 110),  INT8_C(  43),  INT8_C(  75),  INT8_C( 110), -INT8_C(  11),
+      -INT8_C( 117),  INT8_C( 109), -INT8_C(  73),  INT8_C( 121), -INT8_C(  88), -INT8_C(  79), -INT8_C( 109),  INT8_C(   3),
+       INT8_C(  20), -INT8_C( 113), -INT8_C(  39),  INT8_C(  26), -INT8_C(  40),  INT8_C(  73), -INT8_C(  43), -INT8_C(  50),
+       INT8_C(  34),  INT8_C(  44), -INT8_C(  23), -INT8_C( 106), -INT8_C(  11), -INT8_C(  65), -INT8_C(  33),  INT8_C(  10),
+           INT8_MAX, -INT8_C(  71),  INT8_C( 120), -INT8_C(  86),  INT8_C(   4), -INT8_C(  25), -INT8_C(  97), -INT8_C( 112),
+       INT8_C(  84),  INT8_C(  86),  INT8_C(   9), -INT8_C(   4),  INT8_C(   7), -INT8_C( 100), -INT8_C(   1),  INT8_C(  28),
+       INT8_C(  44), -INT8_C(  39),  INT8_C(  54),  INT8_C(   4),  INT8_C(  34),  INT8_C(  11), -INT8_C(  46),  INT8_C(  68),
+       INT8_C(  55), -INT8_C(  69), -INT8_C(  37),  INT8_C(  45),  INT8_C( 123), -INT8_C(  70),  INT8_C(  55), -INT8_C(   6),
+       INT8_C( 115), -INT8_C(  81), -INT8_C(  92),  INT8_C( 120), -INT8_C( 106),  INT8_C(  67),  INT8_C(   8), -INT8_C(  22),
+      -INT8_C( 103),  INT8_C(  17), -INT8_C(  26), -INT8_C(  96), -INT8_C(  82), -INT8_C(  26), -INT8_C(  68), -INT8_C(  38),
+      -INT8_C(  65), -INT8_C(  13), -INT8_C(  34), -INT8_C(  31), -INT8_C(   2), -INT8_C(  80),  INT8_C(  38),  INT8_C(  54),
+       INT8_C( 107),  INT8_C(   1),  INT8_C(  99), -INT8_C(  26), -INT8_C(  69), -INT8_C( 102), -INT8_C(  32),  INT8_C(  46),
+       INT8_C(  73), -INT8_C( 124), -INT8_C(  90), -INT8_C(  32), -INT8_C(  57), -INT8_C(  82), -INT8_C(  54),  INT8_C(  96),
+      -INT8_C(  64), -INT8_C(  79),  INT8_C(   1),  INT8_C( 110), -INT8_C( 105), -INT8_C(  67),  INT8_C(  72),  INT8_C(  86),
+      -INT8_C(  80),  INT8_C(  38),  INT8_C(  55), -INT8_C(  81), -INT8_C(  42),  INT8_C(  93), -INT8_C(  27),  INT8_C(  65),
+       INT8_C(  94),  INT8_C(  72),  INT8_C(  40),  INT8_C(  25), -INT8_C(  30),  INT8_C(   8),  INT8_C(  72),  INT8_C(  43),
+      -INT8_C( 115), -INT8_C(  18),  INT8_C(  11),  INT8_C(  84), -INT8_C(  99), -INT8_C(  42), -INT8_C(  75),  INT8_C(  93),
+      -INT8_C( 121), -INT8_C(  74), -INT8_C(  53),  INT8_C(  30),  INT8_C( 115),  INT8_C(  19),  INT8_C( 116),  INT8_C(  36),
+       INT8_C(  57), -INT8_C(  85), -INT8_C(  45),  INT8_C(  15),  INT8_C(   9), -INT8_C(  72),  INT8_C(  80),  INT8_C( 103),
+       INT8_C(   0),  INT8_C( 120), -INT8_C( 127), -INT8_C(  30), -INT8_C( 127), -INT8_C(  55),  INT8_C(  13),  INT8_C(  14),
+      -INT8_C(  73),  INT8_C(  25),  INT8_C(  98),  INT8_C(  84), -INT8_C(  17),  INT8_C(  23), -INT8_C(  79),  INT8_C( 118),
+      -INT8_C(  51),  INT8_C( 124), -INT8_C( 108),  INT8_C(  65), -INT8_C( 113),  INT8_C(   8),  INT8_C( 101), -INT8_C(  56),
+      -INT8_C(  77),  INT8_C(  56), -INT8_C(  41), -INT8_C(  68), -INT8_C(  16),  INT8_C(  40),  INT8_C(  36), -INT8_C(  16),
+      -INT8_C(  96), -INT8_C(  91), -INT8_C(  46),  INT8_C(  33),  INT8_C( 110), -INT8_C(  33),  INT8_C(  47),  INT8_C(  37),
+      -INT8_C(   8), -INT8_C( 110),  INT8_C( 122), -INT8_C(  25), -INT8_C(  87),  INT8_C(  43),  INT8_C(  93),  INT8_C( 119),
+      -INT8_C(  88), -INT8_C(  15), -INT8_C(  72),  INT8_C(  55), -INT8_C(   7),  INT8_C(  29),  INT8_C(   0), -INT8_C(  83),
+       INT8_C(  85), -INT8_C(  41),  INT8_C( 105),  INT8_C(  69), -INT8_C(   1), -INT8_C( 115),  INT8_C(  53), -INT8_C(  96),
+       INT8_C(  50),  INT8_C(   7), -INT8_C(  63), -INT8_C(  96), -INT8_C(  26), -INT8_C(  15), -INT8_C(  58), -INT8_C(  33),
+      -INT8_C( 125),  INT8_C(  64), -INT8_C(  58),  INT8_C(  44),  INT8_C( 107),  INT8_C(  36), -INT8_C(  93),  INT8_C(  19),
+       INT8_C(  21),  INT8_C(  91),  INT8_C(  75),  INT8_C(  15),  INT8_C( 120),  INT8_C(  75), -INT8_C(  68), -INT8_C(  51),
+       INT8_C(  34),  INT8_C(  37),  INT8_C(  18),  INT8_C(  34), -INT8_C(  77),  INT8_C(  71), -INT8_C(  62), -INT8_C(  27),
+       INT8_C(  78), -INT8_C( 125), -INT8_C( 122),  INT8_C(  53),  INT8_C( 116),  INT8_C(  76),  INT8_C(  20), -INT8_C(   9),
+      -INT8_C( 116), -INT8_C(  38),  INT8_C(  36), -INT8_C(   9), -INT8_C(   2), -INT8_C(  57),  INT8_C(  11),  INT8_C(  20),
+       INT8_C(  35),  INT8_C(  86),  INT8_C(  35), -INT8_C( 101), -INT8_C(  95), -INT8_C(  33),  INT8_C( 105), -INT8_C(  61),
+       INT8_C(   4),  INT8_C( 123), -INT8_C(  27), -INT8_C(  73), -INT8_C(  61), -INT8_C(  89), -INT8_C(  99),  INT8_C(  17),
+       INT8_C(  43),  INT8_C(  35),  INT8_C(  70), -INT8_C(  97),  INT8_C( 111),  INT8_C(  90), -INT8_C( 105), -INT8_C(   5),
+       INT8_C(  53), -INT8_C(  69), -INT8_C(  14),  INT8_C(  51), -INT8_C( 126), -INT8_C(   3),  INT8_C(  71), -INT8_C(  91),
+       INT8_C(  83),  INT8_C( 106),  INT8_C(  65), -INT8_C(  12),  INT8_C(  73), -INT8_C(  86), -INT8_C(  72),  INT8_C(  78),
+       INT8_C(  37), -INT8_C(  99),  INT8_C(   5), -INT8_C(  24),  INT8_C(  69), -INT8_C(  94), -INT8_C(   6),  INT8_C( 112),
+      -INT8_C(  59),  INT8_C(  64),  INT8_C(  15),  INT8_C(  52), -INT8_C( 101), -INT8_C(  90),  INT8_C(  47), -INT8_C(  48),
+       INT8_C(  97),  INT8_C(  34),  INT8_C(   3), -INT8_C(  28),  INT8_C(  31),  INT8_C(  75), -INT8_C( 119),  INT8_C( 115),
+      -INT8_C(  75), -INT8_C(  54),  INT8_C( 103), -INT8_C(   1),  INT8_C( 116),  INT8_C(  31),  INT8_C(  77), -INT8_C( 102),
+      -INT8_C(  67),  INT8_C(  82), -INT8_C( 126),  INT8_C(   2), -INT8_C(  11),  INT8_C( 124),  INT8_C( 114), -INT8_C(  70),
+      -INT8_C(  67), -INT8_C( 127), -INT8_C(  17),  INT8_C(  88),  INT8_C(  40),  INT8_C(  30),  INT8_C(  40), -INT8_C( 119),
+       INT8_C(  64),  INT8_C(  43),  INT8_C( 109),  INT8_C(  96),  INT8_C( 118), -INT8_C(   9), -INT8_C(  45),  INT8_C(  44),
+      -INT8_C(  63),  INT8_C(  58),  INT8_C(  43),  INT8_C(  54),  INT8_C(  90),  INT8_C( 120), -INT8_C(  48),  INT8_C(  23),
+      -INT8_C(  54),  INT8_C(  82),  INT8_C(  25), -INT8_C(  65), -INT8_C(  49), -INT8_C( 117),  INT8_C( 122), -INT8_C( 116),
+       INT8_C(  12),  INT8_C( 105), -INT8_C(  28),  INT8_C(  52), -INT8_C( 121),  INT8_C(  12), -INT8_C(  66), -INT8_C(  56),
+       INT8_C(  55),  INT8_C(  43),  INT8_C(  40), -INT8_C(  82),  INT8_C(  34), -INT8_C(   5), -INT8_C(  38), -INT8_C(  28),
+       INT8_C(  53),  INT8_C(   5),  INT8_C(  26), -INT8_C( 113),  INT8_C( 125), -INT8_C(  22), -INT8_C(  90),  INT8_C(  71),
+       INT8_C(  60), -INT8_C(  65),  INT8_C(   7),  INT8_C(  11),  INT8_C(  74), -INT8_C( 127), -INT8_C( 105),  INT8_C(  87),
+      -INT8_C(  22),  INT8_C( 123), -INT8_C( 117),  INT8_C( 113), -INT8_C( 121),  INT8_C(  73),  INT8_C(  57), -INT8_C(  65),
+       INT8_C( 117),  INT8_C(  97),  INT8_C( 109), -INT8_C( 105),  INT8_C(  92),  INT8_C(  71),  INT8_C( 123), -INT8_C( 110),
+       INT8_C(  76), -INT8_C( 107),  INT8_C(  33), -INT8_C(  55),      INT8_MAX, -INT8_C(  56),  INT8_C(  16), -INT8_C(  68),
+      -INT8_C( 121),  INT8_C(  23), -INT8_C(  57), -INT8_C(  46), -INT8_C( 104),  INT8_C(  95),  INT8_C(  41), -INT8_C( 126),
+      -INT8_C(  38), -INT8_C(  76), -INT8_C(  12),  INT8_C(  98), -INT8_C(   2),  INT8_C(  45),  INT8_C(  33),  INT8_C( 115),
+      -INT8_C( 113), -INT8_C( 114),  INT8_C(  10), -INT8_C(  21), -INT8_C(  43), -INT8_C( 122),  INT8_C( 125),  INT8_C(  33),
+       INT8_C(  27), -INT8_C(  97), -INT8_C(  22), -INT8_C( 101),  INT8_C( 103), -INT8_C(   6),  INT8_C(  87), -INT8_C(  18),
+       INT8_C(  18),  INT8_C(  30), -INT8_C(  64), -INT8_C(  86),  INT8_C( 125), -INT8_C(  23),  INT8_C(  45),  INT8_C(  88),
+      -INT8_C(  98),  INT8_C(  33), -INT8_C(  70), -INT8_C( 100),  INT8_C(  78), -INT8_C(  37),  INT8_C(  15), -INT8_C(  35),
+       INT8_C( 105),  INT8_C(  25), -INT8_C(  55),  INT8_C(  62), -INT8_C(  97),  INT8_C(  70),  INT8_C(  95), -INT8_C(  69),
+      -INT8_C(  27),  INT8_C(  73),  INT8_C(  86),  INT8_C(  76),  INT8_C(  67), -INT8_C(  83),  INT8_C(  59),  INT8_C(  85),
+      -INT8_C(  53), -INT8_C(   5),  INT8_C(   0),  INT8_C(  73), -INT8_C(  27),  INT8_C(  45), -INT8_C(  95), -INT8_C( 125),
+       INT8_C(  78),  INT8_C(  91),  INT8_C(  31), -INT8_C( 100),  INT8_C(  54),  INT8_C(  46),  INT8_C( 122), -INT8_C(  97),
+       INT8_C(  71),  INT8_C(  67), -INT8_C(  35), -INT8_C(  25), -INT8_C( 119),  INT8_C(  60), -INT8_C(  94),  INT8_C( 111),
+      -INT8_C( 123), -INT8_C(   8), -INT8_C(  69), -INT8_C(  56), -INT8_C(  91), -INT8_C(  10),  INT8_C(  30),  INT8_C( 112),
+      -INT8_C(  14),  INT8_C(  30), -INT8_C(  71), -INT8_C(  41),  INT8_C(  75),  INT8_C(  90),  INT8_C(  90), -INT8_C( 103),
+      -INT8_C(  75),  INT8_C( 121),  INT8_C(  53), -INT8_C(  21), -INT8_C(  89), -INT8_C(  81), -INT8_C( 118), -INT8_C(  18),
+      -INT8_C(  14),  INT8_C( 103), -INT8_C(  43),  INT8_C( 124), -INT8_C(  93),  INT8_C( 119), -INT8_C(  21),  INT8_C(  40),
+       INT8_C( 111), -INT8_C(  90), -INT8_C(  15),  INT8_C(  20), -INT8_C(  99),  INT8_C(  15), -INT8_C( 123), -INT8_C( 113),
+       INT8_C(  45),  INT8_C(  62),  INT8_C( 102),  INT8_C( 120), -INT8_C( 103), -INT8_C(  64),  INT8_C(  17),  INT8_C(  78),
+       INT8_C(  57),  INT8_C(  70),  INT8_C(  58), -INT8_C(  32), -INT8_C(  10), -INT8_C(  60), -INT8_C(  50), -INT8_C(  24),
+       INT8_C(  44), -INT8_C(  92),  INT8_C( 100), -INT8_C(  49),  INT8_C(  27),  INT8_C(  79), -INT8_C(   8), -INT8_C( 117),
+      -INT8_C(  10), -INT8_C(  23), -INT8_C(  97), -INT8_C( 109), -INT8_C(   8) };
+  static const int8_t b =  INT8_C(  63);
+  static const int8_t e[] =
+    {  INT8_C(   0),  INT8_C(  55), -INT8_C(  78),  INT8_C(  65),  INT8_C(  46), -INT8_C(  55), -INT8_C(  32), -INT8_C(  57),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  32),  INT8_C(   0),  INT8_C( 123),  INT8_C(   0),  INT8_C(   0), -INT8_C(  23),
+       INT8_C(   0),  INT8_C(  65),  INT8_C(   5),  INT8_C(  11),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(  79),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  46), -INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 109),
+      -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C(   0), -INT8_C(  26),  INT8_C(  35),
+       INT8_C(   0), -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  88), -INT8_C(  49),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  44),  INT8_C(   0),  INT8_C( 104),  INT8_C(   0),  INT8_C(  64), -INT8_C(  73), -INT8_C(  15),
+      -INT8_C(  37),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   5),  INT8_C( 112),  INT8_C(   0), -INT8_C(  56),  INT8_C(  86), -INT8_C(  69),  INT8_C(   0),
+       INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(  50),  INT8_C(  73),  INT8_C(  39),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  58), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX,  INT8_C(  79),  INT8_C(   0),
+       INT8_C( 100),  INT8_C(   0),  INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(  93), -INT8_C( 109),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  89),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  42),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  55),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66), -INT8_C( 106), -INT8_C(  15),  INT8_C(   0),
+      -INT8_C( 103),  INT8_C(   0), -INT8_C(   7), -INT8_C(  14),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  88),
+       INT8_C( 117),  INT8_C(   0), -INT8_C( 116),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102),
+      -INT8_C(  65),  INT8_C(   0),  INT8_C(  78),  INT8_C(  91),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  14),
+       INT8_C(   0),  INT8_C(  94),  INT8_C(   0), -INT8_C( 119),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  93),  INT8_C(  28), -INT8_C(   3),  INT8_C(   0), -INT8_C(  89),  INT8_C( 100),  INT8_C(  34),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  82),  INT8_C(   0),  INT8_C(  65), -INT8_C( 113), -INT8_C(  15), -INT8_C(  26),  INT8_C(   0),
+      -INT8_C(  23),  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),  INT8_C(  87),  INT8_C(   0),  INT8_C(  10), -INT8_C(  98),
+      -INT8_C(  95), -INT8_C(  60),  INT8_C(  39),  INT8_C(   0),  INT8_C(  48),  INT8_C(  74),  INT8_C(   0), -INT8_C( 115),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0), -INT8_C(  72), -INT8_C(  89),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 121),  INT8_C(  87),  INT8_C(   0),  INT8_C(  98),
+       INT8_C(   0),  INT8_C(   0),  INT8_C( 122),  INT8_C(  33),  INT8_C(   0), -INT8_C(  61),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 121), -INT8_C(  26),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX, -INT8_C( 125),  INT8_C(  20),
+       INT8_C(  91),  INT8_C(  25),  INT8_C(   0), -INT8_C(  38), -INT8_C(  47),  INT8_C(   7),  INT8_C(   0),  INT8_C( 118),
+      -INT8_C( 113),  INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 106),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(  35), -INT8_C(   4),  INT8_C( 126),  INT8_C(   0), -INT8_C(   6),  INT8_C(  74),  INT8_C( 109),
+      -INT8_C(  32),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  88),  INT8_C(   0),  INT8_C(  99),  INT8_C(  66),
+      -INT8_C(  64),  INT8_C(   0),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(  38),  INT8_C(   0), -INT8_C(  41),
+       INT8_C(   0),  INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 115),  INT8_C(   0),
+      -INT8_C(  85),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0), -INT8_C(  94),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  48),  INT8_C(   0),  INT8_C(   0), -INT8_C( 109), -INT8_C(  60),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  32),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29), -INT8_C(  76), -INT8_C(  26),
+       INT8_C(  76),  INT8_C(   0), -INT8_C( 104),  INT8_C( 100),  INT8_C(  27),  INT8_C(   0),  INT8_C(  14), -INT8_C(  58),
+       INT8_C(  44),  INT8_C( 117),  INT8_C(  87), -INT8_C(  18),  INT8_C(  38),  INT8_C(  85), -INT8_C( 112),  INT8_C(   0),
+      -INT8_C(  74), -INT8_C(  64), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0), -INT8_C( 123),  INT8_C(   0),  INT8_C(  39),
+       INT8_C(   0),  INT8_C(  93),  INT8_C(   4), -INT8_C(  86),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0), -INT8_C(  58),
+      -INT8_C( 118),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(  18), -INT8_C( 107),  INT8_C( 117),  INT8_C(   0),  INT8_C(  75),
+       INT8_C(   0), -INT8_C(  45),  INT8_C(   9), -INT8_C(  57),  INT8_C(  88), -INT8_C( 113),  INT8_C(   0), -INT8_C(  67),
+      -INT8_C(  20),  INT8_C(  49),  INT8_C(   0),  INT8_C( 102),  INT8_C(  40), -INT8_C(   9),  INT8_C( 107), -INT8_C(  78),
+       INT8_C(  94),  INT8_C(   0),  INT8_C(  87),  INT8_C(   0),  INT8_C(  75),  INT8_C(   1),  INT8_C(   0),  INT8_C( 118),
+       INT8_C(  65), -INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33),  INT8_C( 112),
+       INT8_C(   0),  INT8_C(  42),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C( 100), -INT8_C(  63),  INT8_C(   0),
+      -INT8_C(  44),  INT8_C(   0),  INT8_C(  74),  INT8_C(   0),  INT8_C(  94), -INT8_C(  75), -INT8_C(  82), -INT8_C(  68),
+       INT8_C(   0),  INT8_C(   5), -INT8_C(  27),  INT8_C(  19),  INT8_C(  69),  INT8_C(   0),  INT8_C(   0), -INT8_C( 122),
+       INT8_C(  77),  INT8_C(   0),  INT8_C(  92),  INT8_C(   0), -INT8_C(  22),  INT8_C( 125), -INT8_C(   8), -INT8_C( 106),
+       INT8_C(   0),  INT8_C(   0), -INT8_C( 102),  INT8_C(  96), -INT8_C(  46), -INT8_C( 102),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   1), -INT8_C(  51), -INT8_C(  94),  INT8_C(  95), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102),  INT8_C(   5), -INT8_C(  26),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   9),  INT8_C(   0), -INT8_C(  38),  INT8_C(  32),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  96),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  63),  INT8_C(   0),  INT8_C(  41), -INT8_C( 125),  INT8_C(   0),  INT8_C(  42),
+       INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  29),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  40),  INT8_C(  39), -INT8_C(  98), -INT8_C(   8),  INT8_C(   0), -INT8_C( 107),
+       INT8_C(   0), -INT8_C( 110),  INT8_C(   0), -INT8_C(  84), -INT8_C(  93), -INT8_C(  86),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(  57), -INT8_C(  54),  INT8_C(   0),  INT8_C(  98),  INT8_C(  77), -INT8_C(  83), -INT8_C( 116),  INT8_C(   0),
+       INT8_C(   7),  INT8_C(   0), -INT8_C(  19),  INT8_C(   0),  INT8_C(  55),  INT8_C(  72), -INT8_C(  80),  INT8_C(  89),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51),  INT8_C( 114),
+       INT8_C(   0),  INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 115), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(  49), -INT8_C(   8), -INT8_C(  37),  INT8_C(   0),
+       INT8_C(  13),  INT8_C(   0), -INT8_C(  23),  INT8_C(  68),  INT8_C(   0), -INT8_C(  40),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C( 101),  INT8_C(   0),  INT8_C(  31),  INT8_C(   0), -INT8_C(  31),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  18),  INT8_C(   0), -INT8_C(  39),  INT8_C(   0), -INT8_C( 107),  INT8_C(   0),  INT8_C(  73),
+       INT8_C(  88),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  71),  INT8_C(  35),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  96),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102),  INT8_C(  79), -INT8_C(  70),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29), -INT8_C(  83),
+       INT8_C(   0),  INT8_C( 101),  INT8_C(   0), -INT8_C(  79), -INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C( 115),
+       INT8_C(  94),  INT8_C(   0),  INT8_C( 110),  INT8_C(  94),  INT8_C(  13),  INT8_C(   0),  INT8_C(   0),  INT8_C(  91),
+       INT8_C(  50),  INT8_C(  61),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20), -INT8_C(  55),
+       INT8_C( 116), -INT8_C(  90), -INT8_C(  36),  INT8_C(   0), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(  99),  INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   3),
+      -INT8_C(   4),  INT8_C(   0),  INT8_C(  91),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 107), -INT8_C(  99),  INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(  38),  INT8_C(  41),  INT8_C(   0),
+       INT8_C(  11),  INT8_C(   5),  INT8_C(   0), -INT8_C( 115), -INT8_C(   2),  INT8_C(   0),  INT8_C( 121), -INT8_C( 101),
+       INT8_C( 109),  INT8_C(  22), -INT8_C(   1),  INT8_C(  12), -INT8_C(   9),  INT8_C(   0),  INT8_C(  72),  INT8_C(  50),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   5), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),
+       INT8_C( 123),  INT8_C(   0), -INT8_C(  79), -INT8_C(  52),  INT8_C(  37), -INT8_C(  38), -INT8_C( 111),  INT8_C(  48),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  28),  INT8_C(   0),  INT8_C( 117), -INT8_C(  73),  INT8_C(  77),
+       INT8_C(   0), -INT8_C(  74),  INT8_C(  89),  INT8_C(   0), -INT8_C( 116),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 125),  INT8_C(   0),  INT8_C(   0),  INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(  14), -INT8_C(  58),
+      -INT8_C( 125), -INT8_C(  65), -INT8_C(  47), -INT8_C(  88),  INT8_C(   0),  INT8_C(  98),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  19), -INT8_C(  44),
+           INT8_MAX,  INT8_C(  70),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(  74),  INT8_C(  46),  INT8_C(  39),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 116),
+       INT8_C(   0), -INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  62),  INT8_C(  56),
+      -INT8_C( 119), -INT8_C( 107), -INT8_C(  40), -INT8_C(  46),  INT8_C(   0), -INT8_C(  59),  INT8_C(   0),  INT8_C(  28),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   1), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0),  INT8_C( 105),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  53),  INT8_C(   0),  INT8_C(  57),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  41), -INT8_C(  92),  INT8_C(   0),  INT8_C(  69),  INT8_C(   0),
+      -INT8_C(  76), -INT8_C(  85),  INT8_C(  31),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(  68),
+       INT8_C(   0), -INT8_C(  87),  INT8_C(   0), -INT8_C(  82),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   2),
+      -INT8_C(  90),  INT8_C(  76),  INT8_C(   0),  INT8_C(  30),  INT8_C(   0),  INT8_C(  19),  INT8_C(   0),  INT8_C(  77),
+       INT8_C(  49),  INT8_C(   0),  INT8_C(   0), -INT8_C(  43),  INT8_C( 107), -INT8_C(   6), -INT8_C(  61),  INT8_C(   0),
+      -INT8_C(  91),  INT8_C(   0), -INT8_C( 106),  INT8_C(   0),  INT8_C(  89), -INT8_C( 122),  INT8_C(   0), -INT8_C( 110),
+       INT8_C( 110),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  61),  INT8_C(   0),  INT8_C(   0), -INT8_C(  88),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 100),  INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(  99),
+      -INT8_C(  41),  INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  58),  INT8_C(  97),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  76),  INT8_C(   0),  INT8_C(   0), -INT8_C( 123), -INT8_C(  21),
+      -INT8_C(  11), -INT8_C(  59),  INT8_C(   0), -INT8_C(   9),  INT8_C(   0),  INT8_C(   0), -INT8_C(  97),  INT8_C(  61),
+       INT8_C(   0),  INT8_C( 101),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  82),  INT8_C(   6),  INT8_C(  33),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  39), -INT8_C(  73), -INT8_C(  60), -INT8_C(  34),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 101), -INT8_C( 118),  INT8_C(   0), -INT8_C( 112),
+       INT8_C(   0),  INT8_C(  98), -INT8_C( 121), -INT8_C(  23),  INT8_C( 117),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(  11), -INT8_C(  43),  INT8_C(   0),  INT8_C(  17),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C( 114),  INT8_C(  89),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  43), -INT8_C(  40),
+       INT8_C(  81), -INT8_C(  38),  INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  49),
+       INT8_C(  19),  INT8_C(  66),  INT8_C(   0), -INT8_C( 120), -INT8_C(  89),  INT8_C(   0),  INT8_C(  47),  INT8_C(   0),
+       INT8_C(   7),  INT8_C(   0),  INT8_C(  70),  INT8_C(  32), -INT8_C( 118),  INT8_C(   0),  INT8_C(   0),  INT8_C(  24),
+      -INT8_C(  44),  INT8_C(  92),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 113),  INT8_C(   8),  INT8_C(  53),
+      -INT8_C( 118),  INT8_C(  87),  INT8_C(  33),  INT8_C(  45),  INT8_C(   8) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_n_s8_z(pv, av, b);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    ev = simde_svmul_n_s8_z(pv, av, b);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) };
+  static const int8_t a[] =
+    { -INT8_C(  69), -INT8_C(  56), -INT8_C( 118),  INT8_C(  22),  INT8_C(  81), -INT8_C( 114), -INT8_C(  17), -INT8_C(  90),
+       INT8_C( 109), -INT8_C( 107), -INT8_C( 112),  INT8_C(  37), -INT8_C(  65), -INT8_C(  75),  INT8_C( 114),  INT8_C(   6),
+      -INT8_C( 122), -INT8_C(  80), -INT8_C(  50), -INT8_C(  48), -INT8_C(  18),  INT8_C(  22),  INT8_C(  24),  INT8_C(  82),
+      -INT8_C(  11), -INT8_C(  50),  INT8_C(  60), -INT8_C(  47), -INT8_C( 108), -INT8_C(  77),  INT8_C(  68),  INT8_C(  79),
+       INT8_C( 123), -INT8_C(  50),  INT8_C( 101), -INT8_C(  51),  INT8_C(  92),  INT8_C(  85),  INT8_C( 115), -INT8_C(  55),
+      -INT8_C(  22),  INT8_C(   3), -INT8_C(  18), -INT8_C(  87), -INT8_C(  72),  INT8_C(  96), -INT8_C(  81),  INT8_C(  62),
+       INT8_C(  16),  INT8_C( 125),  INT8_C(  15), -INT8_C(   1), -INT8_C( 108),  INT8_C(  39),  INT8_C(  81), -INT8_C( 119),
+      -INT8_C(  10), -INT8_C( 114),  INT8_C(  91), -INT8_C( 118),  INT8_C(  65), -INT8_C(  97), -INT8_C(  39), -INT8_C(  68),
+       INT8_C( 109),  INT8_C(  63), -INT8_C( 119), -INT8_C(  55), -INT8_C( 108), -INT8_C(   3), -INT8_C( 110),  INT8_C( 126),
+       INT8_C(   0), -INT8_C( 127),  INT8_C(  39), -INT8_C(  71), -INT8_C(  31), -INT8_C(  42), -INT8_C(   9), -INT8_C(  14),
+       INT8_C(  83),  INT8_C(   6), -INT8_C(  15), -INT8_C(  25),  INT8_C(  46),  INT8_C(  66),  INT8_C( 113),  INT8_C(  36),
+      -INT8_C(  48), -INT8_C(  52), -INT8_C(  82),  INT8_C(  17),  INT8_C( 107), -INT8_C( 121), -INT8_C(  50), -INT8_C(  40),
+      -INT8_C(  58),  INT8_C(  87), -INT8_C(  95),  INT8_C(  90),  INT8_C(  84),  INT8_C(  51), -INT8_C(  40),  INT8_C(  85),
+      -INT8_C(  76), -INT8_C(   1),  INT8_C(  14), -INT8_C( 106), -INT8_C(  43),  INT8_C(   5), -INT8_C( 120),  INT8_C(  41),
+       INT8_C(  12),  INT8_C( 121),  INT8_C(  16),  INT8_C(  58), -INT8_C(  69), -INT8_C( 127),  INT8_C(  94), -INT8_C( 116),
+       INT8_C(  77),  INT8_C(  12), -INT8_C(  99), -INT8_C(  72), -INT8_C( 109),  INT8_C( 107), -INT8_C( 112),  INT8_C(  90),
+      -INT8_C(  61),  INT8_C(  49), -INT8_C(  76),  INT8_C(  23),  INT8_C( 101), -INT8_C( 115),  INT8_C( 108),  INT8_C(  25),
+      -INT8_C( 116),  INT8_C( 122), -INT8_C(  81),  INT8_C(  98),      INT8_MIN,  INT8_C(  55), -INT8_C( 117), -INT8_C( 116),
+      -INT8_C(  80), -INT8_C( 101), -INT8_C(  58),  INT8_C( 108),  INT8_C(  29),  INT8_C(  36), -INT8_C(   8),  INT8_C( 106),
+       INT8_C(  48), -INT8_C( 107),  INT8_C(  35), -INT8_C(  61),  INT8_C(   1), -INT8_C(  77),  INT8_C(  29), -INT8_C(  60),
+      -INT8_C(  27), -INT8_C(  46), -INT8_C(  37),  INT8_C(  74),  INT8_C(  95),  INT8_C(  72),  INT8_C(  99), -INT8_C(  21),
+      -INT8_C(  62),  INT8_C(  19),  INT8_C(  77),  INT8_C(  66),  INT8_C(  74), -INT8_C(  40), -INT8_C(  50), -INT8_C(   5),
+       INT8_C( 116), -INT8_C( 108),  INT8_C( 103), -INT8_C( 111), -INT8_C(  72),  INT8_C(  95), -INT8_C(   5), -INT8_C(  24),
+      -INT8_C(  12),  INT8_C(  30), -INT8_C(  84), -INT8_C(  11), -INT8_C(  46), -INT8_C(  55), -INT8_C(  71), -INT8_C(  73),
+      -INT8_C( 101), -INT8_C( 107),  INT8_C(   1), -INT8_C(   6), -INT8_C(  35),  INT8_C( 100), -INT8_C(  26), -INT8_C(  97),
+       INT8_C( 119),  INT8_C(  51), -INT8_C(  30), -INT8_C(  62),  INT8_C(  12), -INT8_C(  80), -INT8_C(  67),      INT8_MIN,
+       INT8_C(  69),  INT8_C(  36),  INT8_C(  17), -INT8_C(   3), -INT8_C( 125),  INT8_C(  12), -INT8_C(  26),  INT8_C( 119),
+       INT8_C(  43), -INT8_C( 110),  INT8_C( 109), -INT8_C(   3),  INT8_C(  91),  INT8_C(  38), -INT8_C(  76), -INT8_C(   9),
+      -INT8_C(  69), -INT8_C(  75), -INT8_C(  15), -INT8_C( 104),  INT8_C(  25), -INT8_C(  41),  INT8_C(  56), -INT8_C( 111),
+       INT8_C(  11),  INT8_C(  26),  INT8_C(  83),  INT8_C(  23), -INT8_C(  54),  INT8_C(  16), -INT8_C( 105),  INT8_C(  15),
+       INT8_C(  52), -INT8_C(  88),  INT8_C(  13), -INT8_C(  73), -INT8_C(  76), -INT8_C(  13),  INT8_C(  46), -INT8_C(  33),
+      -INT8_C( 123), -INT8_C( 101), -INT8_C(  36), -INT8_C(  32), -INT8_C(  62), -INT8_C( 112), -INT8_C(  41),  INT8_C( 125),
+       INT8_C(  69), -INT8_C(  55),  INT8_C(  22),  INT8_C(  95), -INT8_C(  96),  INT8_C(  78), -INT8_C(  16), -INT8_C(  85),
+       INT8_C( 104),  INT8_C(  67), -INT8_C(  62),  INT8_C(  50),  INT8_C(  83),  INT8_C(  89),  INT8_C(  66), -INT8_C( 121),
+       INT8_C(   1),  INT8_C(  79),  INT8_C(  62), -INT8_C(  74),  INT8_C(  66),  INT8_C( 108), -INT8_C( 107), -INT8_C(  57),
+       INT8_C(   8),  INT8_C( 114), -INT8_C(  89), -INT8_C(  54),  INT8_C(   2),      INT8_MAX,  INT8_C(  71),  INT8_C(  72),
+       INT8_C(  72),  INT8_C(  93), -INT8_C(  89), -INT8_C(  24), -INT8_C(  85), -INT8_C( 105), -INT8_C( 108),  INT8_C(  19),
+      -INT8_C(  38),  INT8_C(  86),  INT8_C(  70),  INT8_C(  45), -INT8_C(  80), -INT8_C( 120), -INT8_C(  76), -INT8_C(  79),
+      -INT8_C(  41), -INT8_C(  14),  INT8_C( 103),  INT8_C(  25),  INT8_C(  94), -INT8_C(   3), -INT8_C(  32),  INT8_C( 102),
+       INT8_C( 111), -INT8_C( 121),  INT8_C(  48),  INT8_C( 113),  INT8_C(   6),  INT8_C( 120), -INT8_C(  71),  INT8_C(  78),
+      -INT8_C(  43),  INT8_C(  96),  INT8_C(  55), -INT8_C( 127), -INT8_C(   9), -INT8_C(  53), -INT8_C( 108), -INT8_C(  47),
+       INT8_C(  33), -INT8_C(  38), -INT8_C(   2), -INT8_C(  47),  INT8_C(  98), -INT8_C(  78), -INT8_C( 125),  INT8_C(  57),
+      -INT8_C(  92), -INT8_C(  22),  INT8_C(  82),  INT8_C(   3), -INT8_C(  25),  INT8_C(  50),  INT8_C( 105),  INT8_C(  86),
+      -INT8_C(  70), -INT8_C( 102), -INT8_C(  56), -INT8_C(  64),  INT8_C(  18), -INT8_C( 127),  INT8_C(  15), -INT8_C(  25),
+      -INT8_C(  30),  INT8_C(  70),  INT8_C( 104), -INT8_C(  39),  INT8_C(  17), -INT8_C(   3), -INT8_C(  85),  INT8_C(  50),
+      -INT8_C(  41), -INT8_C(  87),  INT8_C(   4),  INT8_C(  58),  INT8_C(  92), -INT8_C( 121),  INT8_C( 115),  INT8_C(   0),
+       INT8_C( 113), -INT8_C(  58),  INT8_C(   3),  INT8_C(  89), -INT8_C(   8),  INT8_C( 109), -INT8_C(  81), -INT8_C(  78),
+       INT8_C(   7),  INT8_C( 119),  INT8_C( 115),  INT8_C(  25), -INT8_C(   7), -INT8_C( 126),  INT8_C(   0), -INT8_C(  37),
+      -INT8_C(  56),  INT8_C( 105), -INT8_C(  76), -INT8_C(  39),  INT8_C( 102),  INT8_C(  95),  INT8_C(  11),  INT8_C(  61),
+       INT8_C(   9),  INT8_C(  15),  INT8_C( 119),  INT8_C( 101), -INT8_C( 106), -INT8_C(  21),  INT8_C( 101),  INT8_C(   8),
+      -INT8_C(  79),  INT8_C( 105),  INT8_C(  97), -INT8_C(  87), -INT8_C(  42),  INT8_C(  16),  INT8_C(  92), -INT8_C(  35),
+      -INT8_C( 120), -INT8_C(  49), -INT8_C(  10), -INT8_C( 127),  INT8_C(  81), -INT8_C(  10),  INT8_C(  92),  INT8_C(  25),
+       INT8_C(  95),  INT8_C(  16), -INT8_C(  14), -INT8_C(  59),  INT8_C( 112), -INT8_C(   3),  INT8_C(   3),  INT8_C( 121),
+       INT8_C(  13),  INT8_C( 122), -INT8_C(  34), -INT8_C(  93),  INT8_C( 101),  INT8_C(  67), -INT8_C(  85),  INT8_C(  22),
+      -INT8_C(  84),  INT8_C(  12), -INT8_C(  64), -INT8_C( 126),  INT8_C(  29),  INT8_C(  28),  INT8_C(  95), -INT8_C(  91),
+      -INT8_C(  21),  INT8_C(  85),  INT8_C(  38),  INT8_C(  60),  INT8_C(  76), -INT8_C( 126),  INT8_C(  85), -INT8_C(  85),
+      -INT8_C( 110),  INT8_C(  71),  INT8_C( 113),  INT8_C(   2),  INT8_C(  68),  INT8_C( 116),  INT8_C( 123),  INT8_C(  81),
+      -INT8_C(  18),  INT8_C(  89), -INT8_C(  11),  INT8_C(  84), -INT8_C(  99), -INT8_C(  96),  INT8_C( 106),  INT8_C(  73),
+      -INT8_C(  83),  INT8_C(  42), -INT8_C(  52), -INT8_C(  54),  INT8_C(  70),  INT8_C(  43),  INT8_C( 111),  INT8_C(  49),
+      -INT8_C( 127), -INT8_C( 107),  INT8_C( 109), -INT8_C(  51),  INT8_C(  23), -INT8_C(  62),  INT8_C( 120), -INT8_C(  87),
+       INT8_C(   9), -INT8_C(  23), -INT8_C(  84),  INT8_C(  78),  INT8_C(  93),  INT8_C(  39), -INT8_C(  97),  INT8_C(  76),
+      -INT8_C( 127), -INT8_C( 108), -INT8_C(  96),  INT8_C(  30),  INT8_C(  53),  INT8_C(  10),  INT8_C( 103), -INT8_C(  30),
+       INT8_C(  53),  INT8_C(  51), -INT8_C(  84),  INT8_C( 123),  INT8_C(  95),  INT8_C(  27), -INT8_C(  83), -INT8_C(  32),
+      -INT8_C(  80),  INT8_C(  26), -INT8_C(  83), -INT8_C(  57), -INT8_C(  35),  INT8_C(  37),  INT8_C( 112), -INT8_C(  26),
+       INT8_C(  15),  INT8_C(  28),  INT8_C(  52),  INT8_C( 108),  INT8_C(  68), -INT8_C(  44), -INT8_C(  72), -INT8_C(  59),
+       INT8_C( 104),  INT8_C(  88), -INT8_C(  29), -INT8_C(  99),  INT8_C(  99),  INT8_C(  74),      INT8_MAX, -INT8_C( 104),
+       INT8_C( 126),  INT8_C(  43),  INT8_C(  19), -INT8_C(  35),  INT8_C(  70), -INT8_C(  64), -INT8_C(  67), -INT8_C(  10),
+      -INT8_C(  37),  INT8_C( 106), -INT8_C(  67), -INT8_C(  72), -INT8_C( 113),  INT8_C(  46), -INT8_C(  98), -INT8_C(  98),
+       INT8_C(  74), -INT8_C(  45),  INT8_C(  11), -INT8_C( 114), -INT8_C(  89), -INT8_C(  61),  INT8_C(  83),  INT8_C(  15),
+       INT8_C(  28),  INT8_C(  54), -INT8_C(  83),      INT8_MAX, -INT8_C( 127),  INT8_C(  44),  INT8_C(  23), -INT8_C(   1),
+       INT8_C(  88),  INT8_C(  42), -INT8_C(  36), -INT8_C(  98), -INT8_C(  21), -INT8_C( 103), -INT8_C( 107), -INT8_C(  58),
+       INT8_C(   3),  INT8_C(  82),  INT8_C( 126), -INT8_C( 110),      INT8_MIN,  INT8_C(  28),  INT8_C(  49), -INT8_C(  53),
+      -INT8_C(  17),  INT8_C(  60),  INT8_C(  89), -INT8_C( 106), -INT8_C(   1), -INT8_C(  83), -INT8_C(  90),  INT8_C(  27),
+      -INT8_C(  29),  INT8_C(  83), -INT8_C( 102),  INT8_C( 100),      INT8_MAX, -INT8_C(  79),  INT8_C(  99), -INT8_C(  41),
+      -INT8_C(  36),  INT8_C(  63),  INT8_C( 118), -INT8_C(  57), -INT8_C(  40),  INT8_C(  11), -INT8_C( 115), -INT8_C(  37),
+       INT8_C(  93),  INT8_C(  11),  INT8_C( 110), -INT8_C(  34),  INT8_C(  39), -INT8_C(  97), -INT8_C(  87),  INT8_C(  23),
+      -INT8_C(  37),  INT8_C(   2), -INT8_C(  83), -INT8_C(  38), -INT8_C(  81),  INT8_C(  83), -INT8_C(  10), -INT8_C( 109),
+      -INT8_C(  90), -INT8_C( 112), -INT8_C(   9),  INT8_C(  38),  INT8_C(  66),  INT8_C(  91), -INT8_C(   3),  INT8_C(  30),
+      -INT8_C( 102),  INT8_C( 115), -INT8_C(  27),  INT8_C( 115),  INT8_C( 126),  INT8_C( 114),  INT8_C(  78), -INT8_C(  36),
+       INT8_C( 125), -INT8_C(  68), -INT8_C(  70), -INT8_C(  92),  INT8_C(  91),  INT8_C(  99), -INT8_C(  69),  INT8_C(  54),
+       INT8_C( 101),  INT8_C( 105),  INT8_C(  17),  INT8_C(  21), -INT8_C(  68),  INT8_C(   7), -INT8_C(  88),  INT8_C(  99),
+      -INT8_C( 105), -INT8_C(  97), -INT8_C( 119), -INT8_C(  39), -INT8_C(   6), -INT8_C( 122), -INT8_C(   9), -INT8_C( 107),
+      -INT8_C(   6), -INT8_C(  36),  INT8_C(   8),  INT8_C( 120),  INT8_C(  78),  INT8_C(  86),  INT8_C(  84), -INT8_C(  53),
+       INT8_C(  19),  INT8_C(  14),  INT8_C( 112),  INT8_C( 110),  INT8_C( 113),  INT8_C(  43), -INT8_C(  91), -INT8_C(  41),
+      -INT8_C( 108), -INT8_C(  74), -INT8_C(  20),  INT8_C(  81), -INT8_C(  67), -INT8_C( 108), -INT8_C(  76),  INT8_C(  84),
+       INT8_C(  51),  INT8_C(  61),  INT8_C(  46),  INT8_C(  46), -INT8_C(  61),  INT8_C(  37), -INT8_C(  61), -INT8_C(  67),
+       INT8_C(   2), -INT8_C(  53),  INT8_C(  54),  INT8_C(  80),  INT8_C(  33), -INT8_C( 118),  INT8_C(  28),  INT8_C(  52),
+      -INT8_C( 103), -INT8_C( 116), -INT8_C(  93),  INT8_C(  10), -INT8_C(  73),  INT8_C(  72), -INT8_C(  31),  INT8_C(  76),
+      -INT8_C(   2), -INT8_C(  51), -INT8_C(  99), -INT8_C(  69),  INT8_C(  97),  INT8_C(  81),  INT8_C(  15), -INT8_C( 107),
+      -INT8_C( 114),  INT8_C(  61), -INT8_C(  61),  INT8_C(  81),  INT8_C(  99), -INT8_C( 122),  INT8_C(  15),  INT8_C( 101),
+       INT8_C(  81),  INT8_C(  69), -INT8_C(  75),  INT8_C( 114), -INT8_C(  49), -INT8_C(  47), -INT8_C(  89),  INT8_C( 104),
+       INT8_C(  93),  INT8_C(  74),  INT8_C( 115),  INT8_C(  21), -INT8_C( 110),  INT8_C(  84),  INT8_C(  97), -INT8_C( 112),
+       INT8_C(  34), -INT8_C(   2),  INT8_C(  75), -INT8_C( 125),  INT8_C(  79),  INT8_C(  90),  INT8_C(  24), -INT8_C(  35),
+      -INT8_C( 104), -INT8_C(  37),  INT8_C(  46), -INT8_C(   5),  INT8_C(  97),  INT8_C(  61),  INT8_C(  96), -INT8_C(  78),
+      -INT8_C( 126),  INT8_C(  21),  INT8_C(  37) };
+  static const int8_t b =  INT8_C( 115);
+  static const int8_t e[] =
+    {  INT8_C(   1), -INT8_C(  56), -INT8_C(   2),  INT8_C(  22),  INT8_C(  81), -INT8_C(  54), -INT8_C(  17), -INT8_C(  90),
+      -INT8_C(   9), -INT8_C(  17), -INT8_C(  80),  INT8_C(  37), -INT8_C(  51), -INT8_C(  75),  INT8_C( 114), -INT8_C(  78),
+      -INT8_C( 122),  INT8_C(  16), -INT8_C( 118),  INT8_C( 112), -INT8_C(  22), -INT8_C(  30),  INT8_C(  24),  INT8_C(  82),
+      -INT8_C(  11), -INT8_C(  50),  INT8_C(  60), -INT8_C(  47), -INT8_C( 108), -INT8_C(  77),  INT8_C(  68),  INT8_C(  79),
+       INT8_C(  65), -INT8_C( 118),  INT8_C( 101),  INT8_C(  23),  INT8_C(  84),  INT8_C(  47),  INT8_C( 115), -INT8_C(  55),
+      -INT8_C(  22),  INT8_C(   3), -INT8_C(  22), -INT8_C(  87), -INT8_C(  72),  INT8_C(  32), -INT8_C(  99),  INT8_C(  62),
+       INT8_C(  48),  INT8_C( 125),  INT8_C(  15), -INT8_C(   1), -INT8_C( 108),  INT8_C(  39),  INT8_C(  99), -INT8_C( 119),
+      -INT8_C(  10), -INT8_C( 114), -INT8_C(  31), -INT8_C( 118),  INT8_C(  65),  INT8_C( 109), -INT8_C(  39), -INT8_C(  68),
+      -INT8_C(   9),  INT8_C(  77), -INT8_C( 119),  INT8_C(  75),  INT8_C( 124), -INT8_C(   3), -INT8_C( 106), -INT8_C( 102),
+       INT8_C(   0), -INT8_C(  13),  INT8_C(  39), -INT8_C(  71),  INT8_C(  19),  INT8_C(  34), -INT8_C(   9), -INT8_C(  14),
+       INT8_C(  73),  INT8_C(   6),  INT8_C(  67), -INT8_C(  25), -INT8_C(  86),  INT8_C(  66), -INT8_C(  61),  INT8_C(  44),
+      -INT8_C(  48), -INT8_C(  52), -INT8_C(  82), -INT8_C(  93),  INT8_C( 107), -INT8_C(  91), -INT8_C( 118),  INT8_C(   8),
+      -INT8_C(  14),  INT8_C(  21),  INT8_C(  83),  INT8_C(  90),  INT8_C(  84),  INT8_C(  51), -INT8_C(  40),  INT8_C(  47),
+      -INT8_C(  76), -INT8_C( 115),  INT8_C(  74),  INT8_C(  98), -INT8_C(  43),  INT8_C(   5),  INT8_C(  24),  INT8_C(  41),
+       INT8_C( 100),  INT8_C(  91),  INT8_C(  16),  INT8_C(  58),  INT8_C(   1), -INT8_C(  13),  INT8_C(  94), -INT8_C( 116),
+       INT8_C(  77),  INT8_C(  12), -INT8_C( 121), -INT8_C(  72), -INT8_C( 109),  INT8_C(  17), -INT8_C( 112),  INT8_C(  90),
+      -INT8_C( 103),  INT8_C(   3), -INT8_C(  36),  INT8_C(  23),  INT8_C( 101), -INT8_C( 115), -INT8_C( 124),  INT8_C(  25),
+      -INT8_C(  28), -INT8_C(  50), -INT8_C(  99),  INT8_C(   6),      INT8_MIN, -INT8_C(  75),  INT8_C( 113), -INT8_C(  28),
+      -INT8_C(  80), -INT8_C( 101), -INT8_C(  14),  INT8_C( 108),  INT8_C(   7),  INT8_C(  44), -INT8_C(   8),  INT8_C( 106),
+       INT8_C(  48), -INT8_C( 107),  INT8_C(  35), -INT8_C( 103),  INT8_C(   1),  INT8_C( 105),  INT8_C(   7), -INT8_C(  60),
+      -INT8_C(  33), -INT8_C(  46), -INT8_C(  37),  INT8_C(  62),  INT8_C(  95),  INT8_C(  72),  INT8_C(  99), -INT8_C( 111),
+       INT8_C(  38),  INT8_C(  19), -INT8_C( 105), -INT8_C(  90),  INT8_C(  62), -INT8_C(  40), -INT8_C(  50), -INT8_C(   5),
+       INT8_C( 116), -INT8_C( 108),  INT8_C( 103), -INT8_C( 111), -INT8_C(  72), -INT8_C(  83), -INT8_C(  63), -INT8_C(  24),
+      -INT8_C( 100),  INT8_C(  30), -INT8_C(  84), -INT8_C(  11),  INT8_C(  86),  INT8_C(  75), -INT8_C(  71), -INT8_C(  73),
+      -INT8_C( 101), -INT8_C(  17),  INT8_C(   1),  INT8_C(  78),  INT8_C(  71),  INT8_C( 100),  INT8_C(  82),  INT8_C( 109),
+       INT8_C( 119),  INT8_C(  51), -INT8_C(  30),  INT8_C(  38),  INT8_C(  12),  INT8_C(  16), -INT8_C(  25),      INT8_MIN,
+      -INT8_C(   1),  INT8_C(  36),  INT8_C(  17), -INT8_C(  89), -INT8_C(  39),  INT8_C( 100), -INT8_C(  26),  INT8_C( 117),
+       INT8_C(  81), -INT8_C( 106), -INT8_C(   9), -INT8_C(  89),  INT8_C(  91),  INT8_C(  38), -INT8_C(  36), -INT8_C(  11),
+       INT8_C(   1), -INT8_C(  75), -INT8_C(  15),  INT8_C(  72),  INT8_C(  25), -INT8_C( 107),  INT8_C(  40), -INT8_C( 111),
+      -INT8_C(  15),  INT8_C(  26),  INT8_C(  83),  INT8_C(  23), -INT8_C(  66),  INT8_C(  16), -INT8_C( 105), -INT8_C(  67),
+       INT8_C(  52),  INT8_C( 120), -INT8_C(  41), -INT8_C(  73), -INT8_C(  36), -INT8_C(  13), -INT8_C(  86), -INT8_C(  33),
+      -INT8_C(  65), -INT8_C( 101), -INT8_C(  36), -INT8_C(  32), -INT8_C(  62), -INT8_C( 112), -INT8_C( 107),  INT8_C( 125),
+       INT8_C(  69), -INT8_C(  55),  INT8_C(  22),  INT8_C(  95), -INT8_C(  96),  INT8_C(  10), -INT8_C(  48), -INT8_C(  85),
+      -INT8_C(  72),  INT8_C(  67), -INT8_C(  62),  INT8_C( 118),  INT8_C(  83), -INT8_C(   5),  INT8_C(  66), -INT8_C(  91),
+       INT8_C(   1),  INT8_C( 125), -INT8_C(  38), -INT8_C(  62), -INT8_C(  90),  INT8_C( 108), -INT8_C( 107), -INT8_C(  57),
+      -INT8_C( 104),  INT8_C( 114),  INT8_C(   5), -INT8_C(  54),  INT8_C(   2),      INT8_MAX,  INT8_C(  71),  INT8_C(  72),
+       INT8_C(  88),  INT8_C(  93),  INT8_C(   5),  INT8_C(  56), -INT8_C(  85), -INT8_C( 105),  INT8_C( 124), -INT8_C( 119),
+      -INT8_C(  38),  INT8_C(  86),  INT8_C(  70),  INT8_C(  55), -INT8_C(  80),  INT8_C(  24), -INT8_C(  76), -INT8_C(  79),
+      -INT8_C(  41), -INT8_C(  14),  INT8_C( 103),  INT8_C(  25),  INT8_C(  58), -INT8_C(  89), -INT8_C(  96),  INT8_C( 102),
+       INT8_C( 111), -INT8_C( 121),  INT8_C(  48),  INT8_C( 113), -INT8_C(  78), -INT8_C(  24),  INT8_C(  27),  INT8_C(  78),
+      -INT8_C(  43),  INT8_C(  32),  INT8_C(  55), -INT8_C( 127), -INT8_C(  11),  INT8_C(  49),  INT8_C( 124), -INT8_C(  47),
+       INT8_C(  33), -INT8_C(  38), -INT8_C(   2), -INT8_C(  47),  INT8_C(   6), -INT8_C(  10), -INT8_C(  39),  INT8_C(  57),
+      -INT8_C(  84),  INT8_C(  30),  INT8_C(  82),  INT8_C(  89), -INT8_C(  59),  INT8_C(  50),  INT8_C(  43), -INT8_C(  94),
+      -INT8_C(  70), -INT8_C( 102), -INT8_C(  56),  INT8_C(  64),  INT8_C(  22), -INT8_C(  13),  INT8_C(  15), -INT8_C(  25),
+      -INT8_C( 122),  INT8_C(  70),  INT8_C( 104),  INT8_C( 123),  INT8_C(  17), -INT8_C(   3), -INT8_C(  47),  INT8_C(  50),
+      -INT8_C(  41), -INT8_C(  87),  INT8_C(   4),  INT8_C(  58),  INT8_C(  84), -INT8_C(  91),  INT8_C( 115),  INT8_C(   0),
+      -INT8_C(  61), -INT8_C(  14),  INT8_C(   3),  INT8_C(  89),  INT8_C( 104),  INT8_C( 109), -INT8_C(  99), -INT8_C(  78),
+       INT8_C(   7),  INT8_C( 117),  INT8_C( 115),  INT8_C(  25), -INT8_C(  37), -INT8_C( 126),  INT8_C(   0), -INT8_C(  37),
+      -INT8_C(  40),  INT8_C(  43), -INT8_C(  36),  INT8_C( 123), -INT8_C(  46), -INT8_C(  83),  INT8_C(  11),  INT8_C(  61),
+       INT8_C(  11),  INT8_C(  15),  INT8_C( 119),  INT8_C(  95), -INT8_C( 106), -INT8_C( 111),  INT8_C( 101),  INT8_C(   8),
+      -INT8_C( 125),  INT8_C( 105), -INT8_C( 109), -INT8_C(  87),  INT8_C(  34),  INT8_C(  48),  INT8_C(  92), -INT8_C(  35),
+      -INT8_C( 120), -INT8_C(  49), -INT8_C( 126), -INT8_C( 127),  INT8_C(  99), -INT8_C(  10),  INT8_C(  84),  INT8_C(  25),
+      -INT8_C(  83),  INT8_C(  48), -INT8_C(  74), -INT8_C(  59),  INT8_C(  80), -INT8_C(  89),  INT8_C(  89),  INT8_C(  91),
+       INT8_C(  13), -INT8_C(  50), -INT8_C(  34),  INT8_C(  57),  INT8_C(  95),  INT8_C(  67), -INT8_C(  85),  INT8_C(  22),
+       INT8_C(  68),  INT8_C( 100), -INT8_C(  64),  INT8_C( 102),  INT8_C(  29), -INT8_C( 108), -INT8_C(  83),  INT8_C(  31),
+      -INT8_C(  21),  INT8_C(  85),  INT8_C(  38), -INT8_C(  12),  INT8_C(  76),  INT8_C( 102),  INT8_C(  47), -INT8_C(  85),
+      -INT8_C( 106), -INT8_C(  27), -INT8_C(  61),  INT8_C(   2), -INT8_C( 116),  INT8_C( 116),  INT8_C(  65),  INT8_C(  81),
+      -INT8_C(  18), -INT8_C(   5), -INT8_C(  11), -INT8_C(  68), -INT8_C(  99), -INT8_C(  96),  INT8_C( 106),  INT8_C(  73),
+      -INT8_C(  83), -INT8_C(  34), -INT8_C(  92), -INT8_C(  66),  INT8_C(  70),  INT8_C(  43),  INT8_C( 111),  INT8_C(   3),
+      -INT8_C(  13), -INT8_C(  17),  INT8_C( 109), -INT8_C(  51),  INT8_C(  85), -INT8_C(  62),  INT8_C( 120), -INT8_C(  87),
+       INT8_C(   9), -INT8_C(  85), -INT8_C(  84),  INT8_C(  78), -INT8_C(  57), -INT8_C( 123), -INT8_C(  97),  INT8_C(  76),
+      -INT8_C(  13),  INT8_C( 124), -INT8_C(  32),  INT8_C( 122), -INT8_C(  49),  INT8_C( 126),  INT8_C( 103), -INT8_C(  30),
+       INT8_C(  53), -INT8_C(  23),  INT8_C(  68),  INT8_C(  65),  INT8_C(  95),  INT8_C(  27), -INT8_C(  83), -INT8_C(  96),
+       INT8_C(  16), -INT8_C(  82), -INT8_C(  73), -INT8_C(  57), -INT8_C(  35), -INT8_C(  97),  INT8_C( 112), -INT8_C(  26),
+      -INT8_C(  67),  INT8_C(  28),  INT8_C(  92), -INT8_C( 124),  INT8_C(  68),  INT8_C(  60), -INT8_C(  88), -INT8_C(  59),
+       INT8_C( 104),  INT8_C(  88), -INT8_C(  29), -INT8_C(  99),  INT8_C(  99),  INT8_C(  74),      INT8_MAX,  INT8_C(  72),
+      -INT8_C( 102),  INT8_C(  81),  INT8_C(  19),  INT8_C(  71),  INT8_C(  70),  INT8_C(  64), -INT8_C(  25), -INT8_C( 126),
+      -INT8_C(  37),  INT8_C( 106), -INT8_C(  25), -INT8_C(  88), -INT8_C( 113),  INT8_C(  46), -INT8_C(   6), -INT8_C(   6),
+       INT8_C(  74), -INT8_C(  45),  INT8_C(  11), -INT8_C(  54), -INT8_C(  89), -INT8_C( 103),  INT8_C(  83), -INT8_C(  67),
+       INT8_C(  28),  INT8_C(  54), -INT8_C(  83),  INT8_C(  13), -INT8_C( 127), -INT8_C(  60),  INT8_C(  23), -INT8_C(   1),
+      -INT8_C( 120), -INT8_C(  34), -INT8_C(  36), -INT8_C(   6), -INT8_C(  21), -INT8_C(  69), -INT8_C( 107), -INT8_C(  14),
+       INT8_C(   3),  INT8_C(  82),  INT8_C( 126), -INT8_C( 110),      INT8_MIN,  INT8_C(  28),  INT8_C(  49),  INT8_C(  49),
+       INT8_C(  93),  INT8_C(  60),  INT8_C(  89), -INT8_C( 106), -INT8_C(   1), -INT8_C(  83), -INT8_C(  90),  INT8_C(  27),
+      -INT8_C(   7),  INT8_C(  83), -INT8_C( 102), -INT8_C(  20),  INT8_C(  13), -INT8_C(  79),  INT8_C( 121), -INT8_C( 107),
+      -INT8_C(  44),  INT8_C(  63),  INT8_C( 118), -INT8_C(  57),  INT8_C(   8),  INT8_C(  11),  INT8_C(  87),  INT8_C(  97),
+       INT8_C(  93),  INT8_C(  11),  INT8_C( 106), -INT8_C(  70), -INT8_C( 123), -INT8_C(  97), -INT8_C(  87),  INT8_C(  23),
+      -INT8_C(  37),  INT8_C(   2), -INT8_C(  83), -INT8_C(  18), -INT8_C(  99),  INT8_C(  73), -INT8_C(  10), -INT8_C( 109),
+      -INT8_C( 110), -INT8_C( 112), -INT8_C(   9),  INT8_C(  18),  INT8_C(  66),  INT8_C(  91), -INT8_C(   3),  INT8_C(  30),
+      -INT8_C( 102), -INT8_C(  87), -INT8_C(  27), -INT8_C(  87),  INT8_C( 126),  INT8_C( 114),  INT8_C(  10), -INT8_C(  44),
+       INT8_C( 125), -INT8_C(  68), -INT8_C(  70), -INT8_C(  92), -INT8_C(  31),  INT8_C(  99), -INT8_C(  69),  INT8_C(  66),
+       INT8_C( 101),  INT8_C(  43), -INT8_C(  93),  INT8_C(  21), -INT8_C(  68),  INT8_C(  37),  INT8_C( 120),  INT8_C(  99),
+      -INT8_C(  43),  INT8_C( 109), -INT8_C( 119), -INT8_C(  39),  INT8_C(  78),  INT8_C(  50), -INT8_C(   9), -INT8_C(  17),
+      -INT8_C(   6), -INT8_C(  44), -INT8_C( 104),  INT8_C( 120),  INT8_C(  78),  INT8_C(  86), -INT8_C(  68),  INT8_C(  49),
+      -INT8_C( 119),  INT8_C(  74),  INT8_C(  80),  INT8_C( 110), -INT8_C(  61),  INT8_C(  81), -INT8_C(  91), -INT8_C(  41),
+       INT8_C( 124), -INT8_C(  62),  INT8_C(   4),  INT8_C(  81), -INT8_C(  67), -INT8_C( 108), -INT8_C(  76),  INT8_C(  84),
+       INT8_C(  51),  INT8_C( 103), -INT8_C(  86), -INT8_C(  86), -INT8_C(  61), -INT8_C(  97), -INT8_C( 103), -INT8_C(  67),
+      -INT8_C(  26), -INT8_C(  53),  INT8_C(  66), -INT8_C(  16), -INT8_C(  45), -INT8_C( 118),  INT8_C(  28),  INT8_C(  52),
+      -INT8_C( 103), -INT8_C(  28), -INT8_C(  93),  INT8_C(  10),  INT8_C(  53),  INT8_C(  88),  INT8_C(  19),  INT8_C(  36),
+      -INT8_C(   2), -INT8_C(  51), -INT8_C( 121),  INT8_C(   1),  INT8_C(  97),  INT8_C(  81), -INT8_C(  67), -INT8_C(  17),
+      -INT8_C(  54),  INT8_C(  61), -INT8_C(  61),  INT8_C(  81),  INT8_C(  99), -INT8_C( 122),  INT8_C(  15),  INT8_C( 101),
+       INT8_C(  99),  INT8_C(  69),  INT8_C(  79),  INT8_C( 114), -INT8_C(   3), -INT8_C(  47),  INT8_C(   5), -INT8_C(  72),
+       INT8_C(  93),  INT8_C(  74),  INT8_C( 115),  INT8_C(  21), -INT8_C( 106), -INT8_C(  68), -INT8_C( 109), -INT8_C( 112),
+       INT8_C(  70), -INT8_C(   2), -INT8_C(  79), -INT8_C( 125),  INT8_C(  79),  INT8_C( 110), -INT8_C(  56), -INT8_C(  35),
+       INT8_C(  72), -INT8_C(  37),  INT8_C(  46), -INT8_C(   5), -INT8_C( 109),  INT8_C( 103),  INT8_C(  32), -INT8_C(  78),
+       INT8_C( 102),  INT8_C( 111), -INT8_C(  97) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t
+      rv,
+      av = simde_svld1_s8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_n_s8_m(pv, av, b);
+
+    simde_svst1_s8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024], a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_s8(pg, &(a[i]));
+
+    ev = simde_svmul_n_s8_m(pv, av, b);
+
+    simde_svst1_s8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i8(1, b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) };
+  static const int16_t a[] =
+    {  INT16_C( 26337), -INT16_C(  5204),  INT16_C( 31280), -INT16_C( 19565), -INT16_C(  3225),  INT16_C( 22768),  INT16_C( 14948),  INT16_C( 28758),
+      -INT16_C( 26285),  INT16_C( 20012),  INT16_C( 13103),  INT16_C( 26506), -INT16_C( 15505), -INT16_C(  2208),  INT16_C( 11695), -INT16_C( 28530),
+       INT16_C( 15251), -INT16_C( 15493),  INT16_C(  4021),  INT16_C(  7286),  INT16_C( 26114),  INT16_C( 26228), -INT16_C( 13663), -INT16_C(  2857),
+       INT16_C(   867), -INT16_C( 27838), -INT16_C( 13258), -INT16_C( 23046),  INT16_C( 23183),  INT16_C( 16029),  INT16_C( 11143),  INT16_C(  6863),
+       INT16_C( 19046),  INT16_C(  7389),  INT16_C( 21593),  INT16_C( 23608), -INT16_C( 21062),  INT16_C( 23490), -INT16_C( 26249), -INT16_C(  9392),
+      -INT16_C( 28004), -INT16_C( 11666),  INT16_C( 26719), -INT16_C(  4488),  INT16_C(  5571),  INT16_C( 18989), -INT16_C(   960), -INT16_C( 22683),
+       INT16_C( 16966), -INT16_C( 24381), -INT16_C(  1130),  INT16_C( 20988), -INT16_C( 16728),  INT16_C(  8364), -INT16_C(   936), -INT16_C(  2821),
+       INT16_C( 27023), -INT16_C(  4409),  INT16_C( 16337), -INT16_C( 27428),  INT16_C(  2388), -INT16_C( 27425),  INT16_C( 17413),  INT16_C( 19515),
+      -INT16_C(   378),  INT16_C(  7660), -INT16_C(  5894), -INT16_C( 23954),  INT16_C(  6822), -INT16_C(   318), -INT16_C( 17129), -INT16_C( 22797),
+      -INT16_C( 17882), -INT16_C(  1900),  INT16_C( 28921),  INT16_C( 19852),  INT16_C( 27514),  INT16_C( 32737),  INT16_C(  7599),  INT16_C( 14027),
+      -INT16_C( 18661),  INT16_C(  5459), -INT16_C( 15969),  INT16_C( 18104),  INT16_C( 31451), -INT16_C(  3516),  INT16_C( 14136),  INT16_C( 24216),
+       INT16_C( 11505), -INT16_C(  5546), -INT16_C(  7267),  INT16_C(  5943),  INT16_C(  6478), -INT16_C(   362),  INT16_C( 25142),  INT16_C( 20788),
+      -INT16_C( 30951), -INT16_C( 18073),  INT16_C(  8008),  INT16_C(  9215),  INT16_C( 17305), -INT16_C( 12010), -INT16_C( 20869),  INT16_C( 27696),
+      -INT16_C( 31013),  INT16_C( 30807), -INT16_C( 29079), -INT16_C( 18289),  INT16_C(  9639), -INT16_C(  8778), -INT16_C(  5497), -INT16_C( 24273),
+      -INT16_C( 27023), -INT16_C( 18086),  INT16_C( 22965),  INT16_C( 20188), -INT16_C(  3428),  INT16_C(  5920),  INT16_C( 20641),  INT16_C( 31876),
+      -INT16_C(  9258),  INT16_C( 16628), -INT16_C( 31895),  INT16_C(  4600), -INT16_C( 20824),  INT16_C( 12526),  INT16_C(  7576),  INT16_C(  2513),
+       INT16_C( 11187),  INT16_C( 26818), -INT16_C( 24956),  INT16_C(  8375), -INT16_C( 10351),  INT16_C( 12856), -INT16_C( 17369), -INT16_C(   594),
+      -INT16_C( 23913),  INT16_C(    61),  INT16_C( 13605), -INT16_C( 13039),  INT16_C(   227),  INT16_C( 31741), -INT16_C( 12771), -INT16_C( 11900),
+       INT16_C( 18169),  INT16_C( 32057), -INT16_C(  3867),  INT16_C( 30366), -INT16_C( 10553), -INT16_C(  4440),  INT16_C( 22162),  INT16_C( 10732),
+       INT16_C( 10744),  INT16_C(  7465),  INT16_C( 15199),  INT16_C( 17130), -INT16_C(  6085),  INT16_C( 22718),  INT16_C( 17078), -INT16_C( 20439),
+       INT16_C( 25481),  INT16_C( 28205), -INT16_C( 13485),  INT16_C(  7140), -INT16_C( 29535),  INT16_C( 13065), -INT16_C(  2590), -INT16_C(  9636),
+      -INT16_C( 31201),  INT16_C( 32503), -INT16_C(  7743), -INT16_C(   832),  INT16_C( 32457), -INT16_C( 32684),  INT16_C( 32449),  INT16_C( 18992),
+       INT16_C( 24033),  INT16_C( 13496), -INT16_C( 25559), -INT16_C( 13745),  INT16_C( 22824),  INT16_C(  2814),  INT16_C( 23118),  INT16_C( 28132),
+      -INT16_C(  9248), -INT16_C( 24085), -INT16_C( 21316), -INT16_C( 31075), -INT16_C(  3542), -INT16_C(  5370),  INT16_C( 13936),  INT16_C( 20789),
+      -INT16_C(  4717), -INT16_C( 17275), -INT16_C( 10871), -INT16_C( 20089), -INT16_C( 31442),  INT16_C( 31931), -INT16_C( 24609), -INT16_C( 16150),
+      -INT16_C( 10886),  INT16_C( 14177), -INT16_C(   127), -INT16_C( 21315), -INT16_C( 15375),  INT16_C( 24983), -INT16_C( 12807), -INT16_C( 29518),
+       INT16_C( 14266),  INT16_C( 17481), -INT16_C( 12276),  INT16_C( 15093), -INT16_C( 20139),  INT16_C( 13495), -INT16_C( 24240), -INT16_C( 13324),
+       INT16_C( 22134), -INT16_C(  2046), -INT16_C( 16555),  INT16_C( 18084),  INT16_C( 15234),  INT16_C( 31655),  INT16_C( 22792), -INT16_C( 15609),
+       INT16_C( 20624), -INT16_C( 25337), -INT16_C(   992),  INT16_C( 30167), -INT16_C( 29011), -INT16_C(   342), -INT16_C( 25041), -INT16_C( 22839),
+      -INT16_C( 13324),  INT16_C( 18846),  INT16_C( 17034),  INT16_C(  3215),  INT16_C( 13949), -INT16_C( 31097), -INT16_C( 29041),  INT16_C(  8265),
+       INT16_C( 20703), -INT16_C(    67), -INT16_C( 27572), -INT16_C(  1419),  INT16_C(  7971),  INT16_C( 21240), -INT16_C( 15939), -INT16_C( 19720),
+      -INT16_C( 26996),  INT16_C(  5883), -INT16_C( 29736),  INT16_C( 22050), -INT16_C( 22079),  INT16_C( 20956),  INT16_C(  9527),  INT16_C(  5745),
+       INT16_C( 11893), -INT16_C( 16106), -INT16_C( 29758), -INT16_C(  6725), -INT16_C( 19542),  INT16_C( 26424),  INT16_C( 12404),  INT16_C(    25),
+       INT16_C(  5575), -INT16_C( 24810),  INT16_C( 14496),  INT16_C( 25077), -INT16_C( 11807),  INT16_C(  6578),  INT16_C(  9206),  INT16_C( 27439),
+       INT16_C( 17745),  INT16_C(  5165), -INT16_C(  5936),  INT16_C( 31481),  INT16_C( 12700),  INT16_C(  4322), -INT16_C(  1182),  INT16_C( 10513),
+       INT16_C( 10000), -INT16_C( 20280), -INT16_C( 16800),  INT16_C( 16658), -INT16_C( 15217), -INT16_C( 31142), -INT16_C( 29976),  INT16_C( 14833),
+       INT16_C(  7887), -INT16_C( 24499),  INT16_C( 18183), -INT16_C( 23782), -INT16_C(   904), -INT16_C(  9549), -INT16_C( 15112),  INT16_C(  2051),
+      -INT16_C( 13076),  INT16_C( 19641), -INT16_C( 13430),  INT16_C(  6541), -INT16_C(  6001),  INT16_C( 30623), -INT16_C( 28302),  INT16_C( 16817),
+      -INT16_C(   337), -INT16_C( 18719), -INT16_C(   955), -INT16_C( 16807),  INT16_C(  3576), -INT16_C(  3944), -INT16_C( 25391), -INT16_C( 16903),
+      -INT16_C( 19864), -INT16_C(  3575), -INT16_C( 26755),  INT16_C(  3083), -INT16_C( 21633), -INT16_C(  3708),  INT16_C( 13628), -INT16_C(  5326),
+       INT16_C(  5171),  INT16_C( 31138), -INT16_C(  1264),  INT16_C(  2103) };
+  static const int16_t b = -INT16_C( 28637);
+  static const int16_t e[] =
+    {  INT16_C(     0), -INT16_C(  1916),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15276),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 28676),  INT16_C( 28525), -INT16_C( 14370),  INT16_C(     0), -INT16_C( 11744),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 10983), -INT16_C(  5679),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4678),  INT16_C( 16860),  INT16_C(     0),  INT16_C( 26981),
+       INT16_C(  9865),  INT16_C(     0),  INT16_C( 19298),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7307),  INT16_C(  6733),
+      -INT16_C( 29710),  INT16_C( 16951),  INT16_C(     0),  INT16_C(     0),  INT16_C( 24686),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 13484),  INT16_C(     0), -INT16_C( 19203),  INT16_C(  6760), -INT16_C( 22103),  INT16_C( 29735),  INT16_C( 31936),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 21847), -INT16_C( 14974),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14212),  INT16_C(     8),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 27339),  INT16_C( 18835),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25583),
+       INT16_C( 11346), -INT16_C( 10428),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13787),  INT16_C(     0),
+      -INT16_C( 11470),  INT16_C(     0), -INT16_C( 32245),  INT16_C( 23076),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 14513), -INT16_C( 26023),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1039),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 19213),  INT16_C(     0),  INT16_C( 28279),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12958),  INT16_C(     0),
+      -INT16_C( 30613),  INT16_C(     0), -INT16_C( 14632),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 21619),  INT16_C(  5589), -INT16_C( 20510),  INT16_C(   117),  INT16_C(     0),
+       INT16_C(  8563),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5292),  INT16_C( 10592),  INT16_C(     0),  INT16_C( 17932),
+       INT16_C( 28226),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2840),  INT16_C(     0),  INT16_C(     0), -INT16_C( 29752), -INT16_C(  6253),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(  5108),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 10917),  INT16_C(     0),  INT16_C(  5135),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6900),
+       INT16_C(     0),  INT16_C(     0), -INT16_C( 16561),  INT16_C(  6042),  INT16_C( 19765),  INT16_C(  8440), -INT16_C(  2570),  INT16_C( 31556),
+       INT16_C( 15592),  INT16_C(  3227),  INT16_C(     0), -INT16_C( 14850), -INT16_C(  4079),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2619),  INT16_C(     0), -INT16_C( 25964),
+      -INT16_C( 14787),  INT16_C( 19397),  INT16_C( 28003), -INT16_C( 29120),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 26051),  INT16_C(     0),  INT16_C(     0),  INT16_C(  6349),  INT16_C(     0),  INT16_C( 24762),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 23988), -INT16_C( 18569),  INT16_C(     0), -INT16_C( 32302),  INT16_C(     0),  INT16_C(     0),
+       INT16_C( 11033),  INT16_C(     0),  INT16_C( 16827),  INT16_C(     0),  INT16_C(  5450),  INT16_C( 15761),  INT16_C(     0), -INT16_C(     2),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4649),  INT16_C( 23027),  INT16_C(     0),  INT16_C( 14603),  INT16_C( 23638),
+       INT16_C(     0),  INT16_C( 26107),  INT16_C( 12708), -INT16_C(  8321),  INT16_C(  3743),  INT16_C(     0),  INT16_C(  3568),  INT16_C(  8796),
+       INT16_C(     0),  INT16_C(  2118), -INT16_C(  1889),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 21480),  INT16_C(     0),
+       INT16_C(   944),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3173), -INT16_C( 11865),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(  8796),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10125),  INT16_C(     0),  INT16_C(     0), -INT16_C(  4723),  INT16_C( 31227),
+       INT16_C( 32381),  INT16_C(     0),  INT16_C(  1636),  INT16_C(  3583),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6490), -INT16_C( 15005), -INT16_C(  3820),  INT16_C(  1669),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C( 15238),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25432),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(  5579),  INT16_C(  8194),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16835), -INT16_C( 23722),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(  2579),  INT16_C(     0), -INT16_C( 11152), -INT16_C(  8181),  INT16_C(     0),  INT16_C( 28390),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 21672),  INT16_C(  1824),  INT16_C(  1398),  INT16_C( 20365),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C( 22963),  INT16_C(     0), -INT16_C( 23051),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28136),  INT16_C(     0),
+      -INT16_C( 15292), -INT16_C( 29365),  INT16_C( 29662), -INT16_C( 12729),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C( 28477),  INT16_C( 19823),  INT16_C(     0),  INT16_C( 26856),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C( 10043),  INT16_C(  1559),  INT16_C(     0), -INT16_C(  7587),  INT16_C( 17676),  INT16_C(  1844),  INT16_C( 18390),
+       INT16_C( 29433),  INT16_C(     0),  INT16_C( 21296),  INT16_C(     0) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_n_s16_z(pv, av, b);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    ev = simde_svmul_n_s16_z(pv, av, b);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1) };
+  static const int16_t a[] =
+    {  INT16_C( 23444), -INT16_C(   655),  INT16_C(  6852), -INT16_C( 28258), -INT16_C(   797),  INT16_C(  5064),  INT16_C( 24383),  INT16_C(  6252),
+       INT16_C( 27628),  INT16_C( 24331),  INT16_C( 24374),  INT16_C( 20343), -INT16_C(  4391),  INT16_C(  9105), -INT16_C( 12878),  INT16_C( 18228),
+      -INT16_C( 23255), -INT16_C(  4796), -INT16_C(  7489), -INT16_C( 23682),  INT16_C( 18399),  INT16_C(  7862),  INT16_C(  8870), -INT16_C( 28106),
+       INT16_C( 16781), -INT16_C( 15119),  INT16_C( 27041),  INT16_C( 31251), -INT16_C( 23209),  INT16_C(  2462), -INT16_C( 11662), -INT16_C( 25776),
+      -INT16_C( 27529),  INT16_C( 14217),  INT16_C(  1911),  INT16_C( 22234), -INT16_C( 28594), -INT16_C(  2700), -INT16_C( 21582),  INT16_C( 16519),
+       INT16_C( 31212), -INT16_C( 29436),  INT16_C(  6114),  INT16_C( 14600), -INT16_C( 22852),  INT16_C( 12098), -INT16_C( 27784), -INT16_C(  4150),
+       INT16_C( 21287), -INT16_C( 25050),  INT16_C(    91), -INT16_C( 22028),  INT16_C( 27024),  INT16_C( 17310),  INT16_C(  9748),  INT16_C(   131),
+      -INT16_C( 30817), -INT16_C( 32370), -INT16_C( 26978),  INT16_C( 23482), -INT16_C(   964), -INT16_C( 19318),  INT16_C( 21647), -INT16_C( 18525),
+      -INT16_C( 13656),  INT16_C(   853),  INT16_C( 19146),  INT16_C( 23468),  INT16_C( 19379), -INT16_C( 14434),  INT16_C(  8561),  INT16_C(  4295),
+       INT16_C( 21928),  INT16_C( 18065),  INT16_C( 19435),  INT16_C( 10145),  INT16_C( 11079), -INT16_C( 10277),  INT16_C( 32640),  INT16_C( 10382),
+      -INT16_C(  7351),  INT16_C(  4907), -INT16_C( 10451), -INT16_C(  8082),  INT16_C(  3106), -INT16_C( 27737),  INT16_C( 28461), -INT16_C( 10845),
+       INT16_C( 13508), -INT16_C( 20452), -INT16_C( 17025), -INT16_C( 14377), -INT16_C( 19479),  INT16_C( 27038),  INT16_C( 11314),  INT16_C( 31633),
+      -INT16_C( 17393),  INT16_C( 15758), -INT16_C(   621), -INT16_C( 18915), -INT16_C( 15095),  INT16_C( 14153), -INT16_C(  4812), -INT16_C(  2036),
+       INT16_C( 10273), -INT16_C( 24152), -INT16_C( 32538), -INT16_C( 12440),  INT16_C(  1587),  INT16_C( 25912), -INT16_C( 14030),  INT16_C( 16864),
+       INT16_C( 28293),  INT16_C(  6270), -INT16_C( 25493),  INT16_C( 30158),  INT16_C(  6241), -INT16_C( 27220), -INT16_C( 18427),  INT16_C(  9869),
+       INT16_C( 14049), -INT16_C( 14393),  INT16_C( 12214), -INT16_C(  5738), -INT16_C( 12747),  INT16_C( 26446),  INT16_C( 11927),  INT16_C(  7337),
+       INT16_C( 10140),  INT16_C(  2100),  INT16_C(   963),  INT16_C(  9341),  INT16_C( 10523),  INT16_C(  8377),  INT16_C( 18401), -INT16_C( 15802),
+       INT16_C(  3709),  INT16_C( 13193),  INT16_C(  7997),  INT16_C( 29468),  INT16_C( 27373), -INT16_C( 31526), -INT16_C( 31848),  INT16_C( 13472),
+      -INT16_C( 10837),  INT16_C( 28220), -INT16_C( 17960), -INT16_C(  3181),  INT16_C( 19682), -INT16_C( 15341),  INT16_C( 22931),  INT16_C(  4230),
+       INT16_C(  4199), -INT16_C( 23229),  INT16_C( 24367),  INT16_C(  7448), -INT16_C(  3383),  INT16_C( 24993),  INT16_C( 17014),  INT16_C(  8598),
+      -INT16_C( 11753), -INT16_C(  4209),  INT16_C(  8844),  INT16_C( 28386), -INT16_C(  2705),  INT16_C(   562), -INT16_C( 18098), -INT16_C( 18925),
+       INT16_C( 22217), -INT16_C(  1957),  INT16_C( 29622),  INT16_C( 32533), -INT16_C( 18587), -INT16_C(  9247),  INT16_C( 30713),  INT16_C(  4348),
+      -INT16_C( 29623), -INT16_C( 10753), -INT16_C(  7762),  INT16_C(  7492),  INT16_C( 30422),  INT16_C(  9248),  INT16_C( 13103), -INT16_C(  1830),
+       INT16_C( 13705),  INT16_C( 16369),  INT16_C(  1704),  INT16_C(  3775), -INT16_C( 24387), -INT16_C( 18711), -INT16_C(  6633),  INT16_C( 24774),
+      -INT16_C( 14990),  INT16_C(  8246),  INT16_C( 31398),  INT16_C( 31806),  INT16_C( 24304),  INT16_C(  8353),  INT16_C( 31633),  INT16_C(  6680),
+       INT16_C(  2481),  INT16_C( 22874),  INT16_C(  6416), -INT16_C( 12953),  INT16_C( 20921), -INT16_C( 12156),  INT16_C( 18999), -INT16_C( 22224),
+       INT16_C( 26128), -INT16_C( 18743),  INT16_C(  2016), -INT16_C( 11981), -INT16_C( 11163), -INT16_C(  2319),  INT16_C(  2383),  INT16_C(    17),
+       INT16_C( 27411),  INT16_C(  9050), -INT16_C( 15996),  INT16_C( 15856),  INT16_C( 29714),  INT16_C( 18701),  INT16_C( 15807), -INT16_C( 12302),
+      -INT16_C( 17244), -INT16_C( 31611), -INT16_C( 18237),  INT16_C( 10581),  INT16_C( 18060), -INT16_C(  9185),  INT16_C( 12368),  INT16_C( 25564),
+       INT16_C( 13979),  INT16_C(  8070),  INT16_C( 30456),  INT16_C(  2652),  INT16_C( 27115), -INT16_C( 21932),  INT16_C( 18087),  INT16_C( 19321),
+      -INT16_C(   510), -INT16_C( 14641),  INT16_C(  9655),  INT16_C( 17391),  INT16_C(  3691), -INT16_C( 17633), -INT16_C(   961), -INT16_C(  9698),
+      -INT16_C( 23502),  INT16_C( 11002),  INT16_C( 22043),  INT16_C(  1589), -INT16_C( 30272),  INT16_C( 26544),  INT16_C( 10703), -INT16_C( 11598),
+      -INT16_C( 32473), -INT16_C(  8552), -INT16_C( 30810),  INT16_C(  4642),  INT16_C( 16789), -INT16_C( 11059), -INT16_C(  5059),  INT16_C( 28847),
+      -INT16_C( 22128), -INT16_C( 21606), -INT16_C( 12289), -INT16_C( 16463),  INT16_C( 24920),  INT16_C( 10278), -INT16_C( 10102), -INT16_C( 19718),
+      -INT16_C( 28070),  INT16_C(   144), -INT16_C( 19943), -INT16_C( 20974), -INT16_C(  7948),  INT16_C( 12675),  INT16_C( 13004),  INT16_C( 23713),
+       INT16_C( 15579), -INT16_C(  9720), -INT16_C( 18165),  INT16_C( 25754), -INT16_C( 16357), -INT16_C( 23156), -INT16_C( 31079), -INT16_C(  3241),
+      -INT16_C(  6120),  INT16_C( 12787),  INT16_C(  1690), -INT16_C( 28961),  INT16_C( 25318), -INT16_C( 19776),  INT16_C( 24980),  INT16_C( 28430),
+       INT16_C(  5789), -INT16_C( 22198), -INT16_C(  6960), -INT16_C(  5363), -INT16_C( 26204),  INT16_C( 15760), -INT16_C(  6113),  INT16_C( 14128),
+       INT16_C(  9424),  INT16_C( 27240),  INT16_C( 18218),  INT16_C(  4345), -INT16_C( 18006),  INT16_C( 16066), -INT16_C( 12262), -INT16_C( 18258),
+      -INT16_C(  1817), -INT16_C( 18591),  INT16_C( 28380), -INT16_C( 32606),  INT16_C( 12807),  INT16_C(  9918), -INT16_C(  4582), -INT16_C(  5539),
+      -INT16_C( 15086),  INT16_C( 15445),  INT16_C( 19980), -INT16_C( 18868),  INT16_C(  3591),  INT16_C(  8693), -INT16_C( 23585), -INT16_C( 14631),
+       INT16_C( 15003),  INT16_C( 30589),  INT16_C(  8104), -INT16_C( 20489), -INT16_C( 19119),  INT16_C( 27861),  INT16_C( 12964), -INT16_C( 18858),
+      -INT16_C( 21513),  INT16_C(  1267),  INT16_C( 16377),  INT16_C(   186), -INT16_C( 20658),  INT16_C( 11554), -INT16_C(  1198), -INT16_C(  4621),
+       INT16_C( 28726), -INT16_C(  8604),  INT16_C( 23695), -INT16_C(  8050),  INT16_C( 25361), -INT16_C( 19124), -INT16_C( 23658), -INT16_C( 29332),
+       INT16_C( 24398),  INT16_C( 18577),  INT16_C( 19614), -INT16_C(  5048),  INT16_C( 27387),  INT16_C( 19993),  INT16_C(  3174), -INT16_C( 25541),
+      -INT16_C( 24452),  INT16_C(  2938),  INT16_C(  2300),  INT16_C(  3564),  INT16_C( 14444),  INT16_C(   707),  INT16_C( 12251),  INT16_C( 10895),
+       INT16_C(  8590),  INT16_C( 11378), -INT16_C( 17811),  INT16_C( 26649),  INT16_C( 12837), -INT16_C( 29770), -INT16_C(  3521), -INT16_C( 17625),
+      -INT16_C( 24174), -INT16_C( 28985), -INT16_C( 19542),  INT16_C(  5787),  INT16_C( 24299), -INT16_C( 14568), -INT16_C( 22643),  INT16_C(  7153),
+       INT16_C( 25544),  INT16_C( 13640),  INT16_C( 24861),  INT16_C( 17054),  INT16_C( 21651), -INT16_C( 11571), -INT16_C(  3002), -INT16_C( 10098),
+       INT16_C( 21910),  INT16_C( 16486),  INT16_C(   520), -INT16_C(  3242),  INT16_C( 28256), -INT16_C(  4422), -INT16_C( 21739), -INT16_C(  8695),
+       INT16_C( 20750),  INT16_C( 11283), -INT16_C( 20046),  INT16_C( 18030),  INT16_C( 15366),  INT16_C( 19480), -INT16_C( 22992), -INT16_C( 14811),
+      -INT16_C( 29701),  INT16_C(   774),  INT16_C( 23693), -INT16_C(  4361), -INT16_C( 20022), -INT16_C(  7972), -INT16_C(  6819),  INT16_C( 27582),
+      -INT16_C( 11977), -INT16_C(  5737),  INT16_C(  1667), -INT16_C( 30417),  INT16_C( 18498),  INT16_C( 29397), -INT16_C(  1298), -INT16_C(  5575),
+       INT16_C( 16262),  INT16_C(  5101), -INT16_C(  7012),  INT16_C( 26113), -INT16_C(  8810), -INT16_C(  3258),  INT16_C(  1219), -INT16_C(  1442),
+      -INT16_C(  2346),  INT16_C( 23011),  INT16_C(  5116),  INT16_C( 16098), -INT16_C( 18597),  INT16_C( 18864), -INT16_C(  5710),  INT16_C( 14387),
+       INT16_C(  8489), -INT16_C( 15029),  INT16_C( 19717), -INT16_C( 25813),  INT16_C( 29226), -INT16_C(  4722), -INT16_C(  4746),  INT16_C( 19687),
+      -INT16_C( 13341), -INT16_C(  8283), -INT16_C( 30754),  INT16_C( 14621), -INT16_C( 12993), -INT16_C(  3710), -INT16_C( 18761), -INT16_C(  8151),
+       INT16_C( 29911), -INT16_C(  9051), -INT16_C( 12095), -INT16_C(  5000),  INT16_C(  1602), -INT16_C( 17959), -INT16_C( 15885), -INT16_C( 10747),
+      -INT16_C( 21620),  INT16_C( 27317), -INT16_C( 11726),  INT16_C( 29091),  INT16_C(  9632),  INT16_C( 22370), -INT16_C( 29733), -INT16_C( 19913),
+      -INT16_C(  9216), -INT16_C( 15985),  INT16_C(  1964), -INT16_C(  4179), -INT16_C( 30963),  INT16_C(   424), -INT16_C( 21176), -INT16_C( 11049),
+      -INT16_C( 29352), -INT16_C( 29890), -INT16_C(  7841), -INT16_C(     4),  INT16_C( 24326), -INT16_C(  7594), -INT16_C( 29206), -INT16_C(  5484),
+       INT16_C(  9065) };
+  static const int16_t b =  INT16_C( 23988);
+  static const int16_t e[] =
+    {  INT16_C( 23444), -INT16_C(   655),  INT16_C(  6852), -INT16_C( 14056),  INT16_C( 18076),  INT16_C(  5064),  INT16_C( 24383),  INT16_C( 26608),
+       INT16_C( 27628), -INT16_C( 11588), -INT16_C( 28680),  INT16_C( 20343), -INT16_C(  4391),  INT16_C(  9105),  INT16_C( 19240), -INT16_C(  2928),
+      -INT16_C( 23255), -INT16_C(  4796), -INT16_C( 11956), -INT16_C( 23682), -INT16_C( 29748), -INT16_C( 18952),  INT16_C(  8870), -INT16_C( 28106),
+       INT16_C( 16781), -INT16_C( 15119), -INT16_C( 15820),  INT16_C( 31251), -INT16_C(  9172),  INT16_C(  2462),  INT16_C( 25128),  INT16_C( 17472),
+      -INT16_C( 24916),  INT16_C( 14217),  INT16_C( 31404),  INT16_C( 22234), -INT16_C( 13096), -INT16_C( 18032),  INT16_C( 25384),  INT16_C( 27116),
+       INT16_C( 30192), -INT16_C( 25904), -INT16_C(  6936),  INT16_C( 14600), -INT16_C( 22852),  INT16_C( 12098), -INT16_C( 27784), -INT16_C(  1016),
+      -INT16_C( 23956),  INT16_C(   184),  INT16_C(    91), -INT16_C( 22028),  INT16_C( 27024), -INT16_C(  3816),  INT16_C(  2576),  INT16_C(   131),
+      -INT16_C( 30817), -INT16_C( 21032), -INT16_C( 26978),  INT16_C( 23482), -INT16_C(   964), -INT16_C( 19318),  INT16_C( 21647),  INT16_C( 21916),
+      -INT16_C( 31200),  INT16_C( 14532),  INT16_C( 19146),  INT16_C( 23468),  INT16_C( 19379), -INT16_C( 14434),  INT16_C(  8561),  INT16_C(  5868),
+       INT16_C( 16928),  INT16_C( 18065), -INT16_C( 16324),  INT16_C( 23092),  INT16_C( 11079),  INT16_C( 21756),  INT16_C(  9728),  INT16_C(  6616),
+       INT16_C( 21588),  INT16_C(  6460), -INT16_C( 23388), -INT16_C( 15528),  INT16_C(  3106), -INT16_C( 27737), -INT16_C( 31580), -INT16_C( 10845),
+       INT16_C( 19920), -INT16_C( 20452), -INT16_C( 17025), -INT16_C( 25044),  INT16_C(  9428),  INT16_C( 27038),  INT16_C( 11314),  INT16_C( 31633),
+      -INT16_C( 21108),  INT16_C( 15758), -INT16_C( 19876), -INT16_C( 27292), -INT16_C( 15095),  INT16_C( 25684), -INT16_C(  4812), -INT16_C(  2036),
+       INT16_C( 10273), -INT16_C( 19936), -INT16_C( 32538), -INT16_C( 25312), -INT16_C(  7460), -INT16_C( 31904), -INT16_C( 14030),  INT16_C( 16864),
+       INT16_C( 28293),  INT16_C(  6270), -INT16_C(  9668), -INT16_C( 21800),  INT16_C(  6241), -INT16_C( 18192), -INT16_C( 18427),  INT16_C( 21540),
+       INT16_C( 21300), -INT16_C( 14393), -INT16_C( 22024), -INT16_C( 17544),  INT16_C( 15940), -INT16_C(  1832), -INT16_C( 25300), -INT16_C( 29740),
+      -INT16_C( 31312), -INT16_C( 22384),  INT16_C( 31772),  INT16_C(  9341), -INT16_C( 18948),  INT16_C( 14100),  INT16_C( 18228),  INT16_C(  1848),
+       INT16_C(  3709),  INT16_C( 13193),  INT16_C(  8164),  INT16_C( 29468),  INT16_C( 27373), -INT16_C( 31526), -INT16_C( 31848),  INT16_C(  8320),
+       INT16_C( 23356),  INT16_C( 20016), -INT16_C( 17960), -INT16_C(  3181),  INT16_C( 19682), -INT16_C( 15268),  INT16_C( 25180),  INT16_C(  4230),
+       INT16_C(  4199), -INT16_C( 23229),  INT16_C(    12),  INT16_C(  7448), -INT16_C(  3383),  INT16_C(  8756),  INT16_C( 17014),  INT16_C(  7032),
+      -INT16_C( 11753), -INT16_C(  4209),  INT16_C(  8844),  INT16_C( 28386), -INT16_C(  6900),  INT16_C(   562), -INT16_C( 18098), -INT16_C(  5028),
+       INT16_C(  2644), -INT16_C(  1957),  INT16_C( 29622),  INT16_C( 32533), -INT16_C( 23548), -INT16_C(  9247),  INT16_C( 30713),  INT16_C(  4348),
+      -INT16_C( 29623),  INT16_C(  6732), -INT16_C(  7762),  INT16_C(  7492),  INT16_C( 19576),  INT16_C(  9248),  INT16_C( 13103),  INT16_C( 11080),
+       INT16_C( 26964),  INT16_C( 16369),  INT16_C(  1704), -INT16_C( 16052), -INT16_C( 21020),  INT16_C( 16596), -INT16_C(  6633), -INT16_C(  1736),
+       INT16_C( 15912),  INT16_C( 17400), -INT16_C( 30024),  INT16_C( 31806), -INT16_C(  3904),  INT16_C( 28212),  INT16_C( 31633),  INT16_C(  4320),
+       INT16_C(  7540),  INT16_C( 22874),  INT16_C( 28480), -INT16_C( 12953), -INT16_C( 21740), -INT16_C( 28464),  INT16_C( 18999), -INT16_C( 22224),
+      -INT16_C( 27840), -INT16_C( 18743),  INT16_C(  2016), -INT16_C( 24868),  INT16_C(  2052),  INT16_C( 11892),  INT16_C(  2383),  INT16_C(    17),
+       INT16_C( 12380), -INT16_C( 29368), -INT16_C( 15996),  INT16_C( 15856),  INT16_C(  9896),  INT16_C(  5668), -INT16_C( 12980), -INT16_C( 12302),
+      -INT16_C( 17244),  INT16_C( 32388), -INT16_C( 16356), -INT16_C(  3900),  INT16_C( 30320), -INT16_C(  9185),  INT16_C( 12368),  INT16_C(  8880),
+      -INT16_C( 19460), -INT16_C( 10184),  INT16_C( 30456), -INT16_C( 19280), -INT16_C( 10180), -INT16_C( 21932),  INT16_C( 18087),  INT16_C( 19321),
+       INT16_C( 21352), -INT16_C(   884),  INT16_C(  9655),  INT16_C( 17391),  INT16_C(  3691), -INT16_C( 17633),  INT16_C( 16204), -INT16_C(  9698),
+      -INT16_C( 25304),  INT16_C(  2504),  INT16_C( 23036),  INT16_C(  1589), -INT16_C( 30272), -INT16_C( 10304), -INT16_C( 26484), -INT16_C( 11598),
+      -INT16_C(  1428), -INT16_C( 17696), -INT16_C( 30810),  INT16_C(  4642),  INT16_C( 16789),  INT16_C(  6436),  INT16_C( 17380), -INT16_C( 12788),
+      -INT16_C( 22128), -INT16_C( 21606), -INT16_C( 12289), -INT16_C( 16463),  INT16_C( 24920),  INT16_C(  2232),  INT16_C( 25352), -INT16_C( 22072),
+      -INT16_C( 26296), -INT16_C( 19136), -INT16_C( 19943), -INT16_C(  4440), -INT16_C( 12400),  INT16_C( 12675), -INT16_C( 11408), -INT16_C( 25036),
+       INT16_C( 22780),  INT16_C( 13728),  INT16_C(  6844),  INT16_C( 25754), -INT16_C( 16357),  INT16_C( 17008),  INT16_C( 14484), -INT16_C( 19412),
+      -INT16_C(  5920),  INT16_C( 26076), -INT16_C( 27064),  INT16_C( 30668),  INT16_C(  6072), -INT16_C( 19776),  INT16_C( 24592),  INT16_C( 11224),
+      -INT16_C(  4252), -INT16_C(  5624), -INT16_C(  6960), -INT16_C(   476), -INT16_C( 25776),  INT16_C( 15760), -INT16_C(  6113),  INT16_C( 14128),
+       INT16_C(  9424),  INT16_C( 27240),  INT16_C( 18218),  INT16_C(  4345), -INT16_C( 18006), -INT16_C( 26008), -INT16_C( 15288),  INT16_C(  4184),
+      -INT16_C(  1817),  INT16_C( 11572),  INT16_C( 28380),  INT16_C( 19432), -INT16_C( 18452),  INT16_C( 17304), -INT16_C(  9144), -INT16_C( 28060),
+       INT16_C(  6824),  INT16_C( 19652),  INT16_C( 15472), -INT16_C( 18868),  INT16_C( 26604),  INT16_C(  8693),  INT16_C( 15308), -INT16_C( 23148),
+      -INT16_C( 31748),  INT16_C( 30589),  INT16_C(  8104),  INT16_C( 29868), -INT16_C( 19119),  INT16_C( 27861),  INT16_C( 12112),  INT16_C( 29304),
+      -INT16_C( 23380),  INT16_C(  1267),  INT16_C( 28692),  INT16_C(  5320), -INT16_C( 26408),  INT16_C( 11554), -INT16_C(  1198), -INT16_C(  4621),
+      -INT16_C( 31752), -INT16_C( 19888),  INT16_C(  1932),  INT16_C( 31192), -INT16_C( 11020),  INT16_C(  5488), -INT16_C( 31880), -INT16_C( 21520),
+       INT16_C( 22744),  INT16_C( 18577),  INT16_C( 17688), -INT16_C(  5048),  INT16_C( 27387), -INT16_C(   364), -INT16_C( 14920), -INT16_C( 25541),
+      -INT16_C(  7376),  INT16_C(  2938),  INT16_C(  2300), -INT16_C( 31248),  INT16_C( 14444),  INT16_C(   707),  INT16_C( 13564),  INT16_C( 10895),
+       INT16_C(  8590),  INT16_C( 11378), -INT16_C( 21084),  INT16_C( 18068),  INT16_C( 12837),  INT16_C( 23032), -INT16_C(  3521), -INT16_C( 17625),
+      -INT16_C( 23384), -INT16_C( 20756),  INT16_C(  5512),  INT16_C(  5787),  INT16_C( 24299), -INT16_C( 19232),  INT16_C(  2084),  INT16_C( 12916),
+       INT16_C( 25544),  INT16_C( 13640),  INT16_C( 24861),  INT16_C( 15640),  INT16_C( 21651), -INT16_C( 11571), -INT16_C(  3002), -INT16_C(  9768),
+      -INT16_C( 21640),  INT16_C( 21944),  INT16_C(   520),  INT16_C( 22136),  INT16_C( 31616),  INT16_C( 27848), -INT16_C(  5180), -INT16_C(  8695),
+       INT16_C( 20750), -INT16_C(  7076), -INT16_C( 25816),  INT16_C( 31576),  INT16_C( 25144),  INT16_C( 19480),  INT16_C( 18880), -INT16_C( 15612),
+      -INT16_C( 29701),  INT16_C(   774),  INT16_C( 19492), -INT16_C( 16212), -INT16_C( 20022),  INT16_C(  1712),  INT16_C(  3684),  INT16_C( 27582),
+       INT16_C(  5548), -INT16_C(  5737),  INT16_C(  1667), -INT16_C( 30417),  INT16_C( 18498),  INT16_C(  7876), -INT16_C(  6824), -INT16_C(  5575),
+       INT16_C( 16262),  INT16_C(  5101), -INT16_C(  7012),  INT16_C( 26113), -INT16_C(  8810),  INT16_C( 31544),  INT16_C( 12316),  INT16_C( 12312),
+       INT16_C( 19576), -INT16_C( 21860),  INT16_C(  5116),  INT16_C( 20712), -INT16_C( 18597),  INT16_C( 18864), -INT16_C(  5710),  INT16_C(  2780),
+       INT16_C( 13780), -INT16_C( 15029), -INT16_C(  1916), -INT16_C( 25813), -INT16_C( 30840), -INT16_C(  4722), -INT16_C( 11016),  INT16_C( 19687),
+      -INT16_C( 13341), -INT16_C(  8283), -INT16_C( 30754), -INT16_C( 20124), -INT16_C( 12993),  INT16_C(  2408), -INT16_C(  3156), -INT16_C(  8151),
+       INT16_C( 16940),  INT16_C(  5380), -INT16_C(  6988), -INT16_C(  5000),  INT16_C( 24680), -INT16_C( 17959), -INT16_C( 23076),  INT16_C( 19588),
+       INT16_C( 31344), -INT16_C( 14268), -INT16_C(  2776),  INT16_C( 29091), -INT16_C( 27520),  INT16_C(  2792), -INT16_C( 29733), -INT16_C( 19913),
+      -INT16_C( 20480),  INT16_C(  2956), -INT16_C(  7952), -INT16_C(  4179), -INT16_C( 20956),  INT16_C( 12832), -INT16_C(   352), -INT16_C( 15828),
+       INT16_C( 23008), -INT16_C( 29890), -INT16_C(  1588), -INT16_C(     4),  INT16_C( 24326),  INT16_C( 25208), -INT16_C( 29206), -INT16_C(  5484),
+       INT16_C(  2772) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t
+      rv,
+      av = simde_svld1_s16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_n_s16_m(pv, av, b);
+
+    simde_svst1_s16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)], a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_s16(pg, &(a[i]));
+
+    ev = simde_svmul_n_s16_m(pv, av, b);
+
+    simde_svst1_s16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i16(1, b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1) };
+  static const int32_t a[] =
+    {  INT32_C(   656572595), -INT32_C(  1514262111), -INT32_C(   438083972), -INT32_C(   516554503), -INT32_C(  1268931999),  INT32_C(  1009455146), -INT32_C(  1735615369),  INT32_C(   605295728),
+       INT32_C(   894121620), -INT32_C(   472250009),  INT32_C(  1623834215),  INT32_C(   541261758), -INT32_C(   858480734),  INT32_C(   654901167),  INT32_C(   213882011),  INT32_C(  1009832872),
+       INT32_C(  1903262473), -INT32_C(   346797180), -INT32_C(   934601463), -INT32_C(  1075278563), -INT32_C(   594822100),  INT32_C(  1443075003), -INT32_C(   815611353), -INT32_C(  1626631530),
+      -INT32_C(  1861190643), -INT32_C(   780376633), -INT32_C(  1617311614), -INT32_C(  2107735723), -INT32_C(   127997635), -INT32_C(  1555144324), -INT32_C(  1183665885),  INT32_C(  1364819267),
+      -INT32_C(  1042126343),  INT32_C(  1368547278),  INT32_C(  2096114471), -INT32_C(   369209428), -INT32_C(  1243521992), -INT32_C(   514314307),  INT32_C(   614124512),  INT32_C(  1115026248),
+       INT32_C(   721639261), -INT32_C(   579037770),  INT32_C(  1817865664), -INT32_C(   195733316),  INT32_C(  1923692213),  INT32_C(  1179845221),  INT32_C(   359329485),  INT32_C(  1045946337),
+      -INT32_C(   311797194), -INT32_C(  1345657105),  INT32_C(   253437011),  INT32_C(   839151741),  INT32_C(   212118950),  INT32_C(  2085812399), -INT32_C(   946684698), -INT32_C(   788076133),
+       INT32_C(   868118596), -INT32_C(  1427928746),  INT32_C(   716832429),  INT32_C(   358399343),  INT32_C(   438370667), -INT32_C(   543722503), -INT32_C(   895080145),  INT32_C(  1453108242),
+       INT32_C(  1938446876), -INT32_C(  1860342301), -INT32_C(   625224085), -INT32_C(     1042284),  INT32_C(   303632665), -INT32_C(  1259229051), -INT32_C(   327182375),  INT32_C(  1614945092),
+       INT32_C(  1507052661), -INT32_C(  1511329735),  INT32_C(  1535092167), -INT32_C(   698716227),  INT32_C(   115897217), -INT32_C(    38086364), -INT32_C(  1243006607), -INT32_C(   904582060),
+       INT32_C(   841214456), -INT32_C(  1596518951),  INT32_C(  1895519922),  INT32_C(  1195791814), -INT32_C(   313708599),  INT32_C(  2045380360), -INT32_C(  1792093119), -INT32_C(   127974400),
+       INT32_C(   103449133),  INT32_C(  1118241167),  INT32_C(   515023448), -INT32_C(  1050281736),  INT32_C(   816755239), -INT32_C(    89548615),  INT32_C(  1821431916),  INT32_C(  1231417116),
+       INT32_C(    21991282), -INT32_C(   381421935), -INT32_C(  1861749351),  INT32_C(   357723374), -INT32_C(   683343842),  INT32_C(    97709976), -INT32_C(   479108409), -INT32_C(  1020471727),
+      -INT32_C(   138052762),  INT32_C(   199231602), -INT32_C(   325261314),  INT32_C(  1895951955), -INT32_C(  2042083346), -INT32_C(    41215434), -INT32_C(   824115844),  INT32_C(   965807315),
+      -INT32_C(   114272633),  INT32_C(  1560547423),  INT32_C(  1246339319),  INT32_C(  2092649102), -INT32_C(   956103535), -INT32_C(  1681617378),  INT32_C(  1600758923),  INT32_C(   949549744),
+      -INT32_C(  1338914479), -INT32_C(   787663143),  INT32_C(  1696290518),  INT32_C(   853661600), -INT32_C(   101063461), -INT32_C(    23806349),  INT32_C(   324926818),  INT32_C(  1229715192),
+      -INT32_C(  1728480065), -INT32_C(  1989605710) };
+  static const int32_t b =  INT32_C(  2093535341);
+  static const int32_t e[] =
+    { -INT32_C(   233161673),  INT32_C(           0),  INT32_C(  2138307276),  INT32_C(           0), -INT32_C(  1214975155), -INT32_C(  1807220254),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(   553549060),  INT32_C(           0),  INT32_C(           0),  INT32_C(    12665830),  INT32_C(           0),  INT32_C(  1934298499),  INT32_C(  1130903039),  INT32_C(           0),
+      -INT32_C(    61820203), -INT32_C(  1621137612),  INT32_C(  1520086229),  INT32_C(           0), -INT32_C(  1027416388),  INT32_C(           0),  INT32_C(   491018907),  INT32_C(  1278691806),
+       INT32_C(  1593270665),  INT32_C(   740361659), -INT32_C(  2064384166),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2098846695), -INT32_C(  1455897209),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1214135336),  INT32_C(           0),  INT32_C(   579784288),  INT32_C(   304289192),
+       INT32_C(  1410319001), -INT32_C(  1512071554),  INT32_C(  1504492224), -INT32_C(  1018198004), -INT32_C(  1209574639),  INT32_C(   775034113), -INT32_C(   592036535),  INT32_C(           0),
+       INT32_C(   566511870),  INT32_C(           0),  INT32_C(   283764567),  INT32_C(           0),  INT32_C(  1088737198),  INT32_C(  1712984707),  INT32_C(           0),  INT32_C(   852977407),
+       INT32_C(  1751977204),  INT32_C(           0),  INT32_C(   323354537),  INT32_C(   891213891),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(  1862328852), -INT32_C(  2144847449),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(  1128981039), -INT32_C(   792815547), -INT32_C(  1820113477), -INT32_C(  1762450567),  INT32_C(           0), -INT32_C(   316951468), -INT32_C(  1891547875), -INT32_C(  1868030012),
+       INT32_C(  1898192536),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1767073102),  INT32_C(  1907927189),  INT32_C(           0), -INT32_C(   533909587),  INT32_C(  1204810752),
+      -INT32_C(  1459225303),  INT32_C(           0), -INT32_C(  1430872200), -INT32_C(   730562152), -INT32_C(  1114010981),  INT32_C(  1926518469),  INT32_C(  1306781180),  INT32_C(  1888325356),
+       INT32_C(  2088547210),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1474915526),  INT32_C(           0),  INT32_C(           0),  INT32_C(   864096381),
+       INT32_C(           0), -INT32_C(   430950262),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1777998377),
+       INT32_C(  1566214011), -INT32_C(  1237309325),  INT32_C(           0),  INT32_C(  1329733238), -INT32_C(    45694531),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(  1033774818),  INT32_C(   509267744),  INT32_C(  1483759935),  INT32_C(           0),  INT32_C(   158630586),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(  1245215178) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_n_s32_z(pv, av, b);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    ev = simde_svmul_n_s32_z(pv, av, b);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0) };
+  static const int32_t a[] =
+    {  INT32_C(   906196998),  INT32_C(  1186967155),  INT32_C(  1061278011),  INT32_C(   981981611),  INT32_C(  1683846937), -INT32_C(    15305471), -INT32_C(  1703863463),  INT32_C(   498370839),
+       INT32_C(  1968420610), -INT32_C(  1581575578), -INT32_C(  1881015068), -INT32_C(   272013098), -INT32_C(   531421217), -INT32_C(   169907812), -INT32_C(  1668263803), -INT32_C(   591837990),
+       INT32_C(  1649479164),  INT32_C(    50531359), -INT32_C(   543955959),  INT32_C(   734944332),  INT32_C(   537600387),  INT32_C(   253094794),  INT32_C(   363570491), -INT32_C(   420387350),
+      -INT32_C(  1857535374),  INT32_C(  1486179151),  INT32_C(  2083989552),  INT32_C(   145229188), -INT32_C(  1339509978), -INT32_C(   624935522), -INT32_C(   839947293),  INT32_C(  1119085008),
+       INT32_C(  1926560547),  INT32_C(  1992976710),  INT32_C(   368247185),  INT32_C(   740137734), -INT32_C(   304265906),  INT32_C(  1724358019), -INT32_C(   650922488), -INT32_C(  1155799401),
+       INT32_C(   657321953), -INT32_C(   375457704),  INT32_C(    16749049),  INT32_C(  2049711148), -INT32_C(   446232222), -INT32_C(  1354027354),  INT32_C(  2089320165),  INT32_C(  1161274212),
+      -INT32_C(   345217645),  INT32_C(  1456802397), -INT32_C(   950610789),  INT32_C(  1380090864),  INT32_C(   859285900), -INT32_C(  1109228840),  INT32_C(  1681484288), -INT32_C(  1599508211),
+       INT32_C(   864818902), -INT32_C(  1131847392),  INT32_C(   629399605), -INT32_C(   277297821),  INT32_C(  1193455471),  INT32_C(   839124018),  INT32_C(  2090286446), -INT32_C(  2078523218),
+       INT32_C(  2008524886),  INT32_C(  1043546377), -INT32_C(  2073774559), -INT32_C(   344728452), -INT32_C(  1120758133),  INT32_C(   166737562),  INT32_C(   579176307),  INT32_C(   514236871),
+       INT32_C(  1402297930), -INT32_C(  1064122209), -INT32_C(    96143746),  INT32_C(  1575335890), -INT32_C(   400877747), -INT32_C(  1041167539),  INT32_C(  1508079250),  INT32_C(  1635223831),
+      -INT32_C(  2034955033),  INT32_C(  1397114836),  INT32_C(   256739901), -INT32_C(  1888734398), -INT32_C(  1736997046),  INT32_C(   609839250), -INT32_C(   159499042), -INT32_C(  1386744379),
+      -INT32_C(   701297662), -INT32_C(  1876329901),  INT32_C(  1184855812), -INT32_C(   187298646),  INT32_C(   646729107), -INT32_C(  1807030858), -INT32_C(   410335199), -INT32_C(  1063984450),
+       INT32_C(  1117177838),  INT32_C(  1188216897), -INT32_C(   510889417),  INT32_C(   299197054),  INT32_C(  1714905776),  INT32_C(  1778025031),  INT32_C(   139494730),  INT32_C(  1439229031),
+      -INT32_C(   308846677),  INT32_C(  1446210079),  INT32_C(  1513603036), -INT32_C(   764736478), -INT32_C(  1237802130),  INT32_C(  1864315429),  INT32_C(   511209399), -INT32_C(    25935789),
+      -INT32_C(  1091892321),  INT32_C(  1360273013),  INT32_C(    11226078), -INT32_C(   959309992), -INT32_C(   545518918), -INT32_C(   196175044),  INT32_C(  1561511434), -INT32_C(  1503885817),
+       INT32_C(   124077970),  INT32_C(  1146714470),  INT32_C(   490996933), -INT32_C(   706537957),  INT32_C(  1555324960),  INT32_C(   105907195), -INT32_C(   798792759),  INT32_C(  2071445481),
+       INT32_C(  1837358087),  INT32_C(   447863893), -INT32_C(    63441440),  INT32_C(   735124235),  INT32_C(  1988593275),  INT32_C(  1383913609),  INT32_C(   606330939), -INT32_C(  1499424097),
+      -INT32_C(   887938186), -INT32_C(   538524417), -INT32_C(   992272967), -INT32_C(  1276138184), -INT32_C(  1138067661), -INT32_C(  1978751409),  INT32_C(   648950150),  INT32_C(  1103908555),
+       INT32_C(  1879957617),  INT32_C(  1582363556),  INT32_C(  1226976016),  INT32_C(   201069272), -INT32_C(   658037111),  INT32_C(  1398986445), -INT32_C(   747040761), -INT32_C(   803977633),
+      -INT32_C(   901701338),  INT32_C(   623415572), -INT32_C(  1787933764), -INT32_C(   425694627),  INT32_C(  1589536913),  INT32_C(  1169236030), -INT32_C(  1894241488), -INT32_C(  1755304591),
+       INT32_C(  1667342670), -INT32_C(   293041614),  INT32_C(   847509205), -INT32_C(   250076064), -INT32_C(   900737396),  INT32_C(   638517750), -INT32_C(  1649006548), -INT32_C(  1556867499),
+      -INT32_C(   385444425), -INT32_C(   187199969), -INT32_C(   450471036),  INT32_C(   198590079),  INT32_C(   181741076),  INT32_C(  1395778599),  INT32_C(  1643177740), -INT32_C(  1274731267),
+      -INT32_C(   644019271),  INT32_C(   516781210),  INT32_C(  1308882127),  INT32_C(  1197070898),  INT32_C(   659631616),  INT32_C(   528122387),  INT32_C(  1719757417),  INT32_C(  1192920718),
+       INT32_C(   723564433), -INT32_C(    78975444),  INT32_C(   340413922),  INT32_C(   660316967), -INT32_C(   447828526), -INT32_C(  1727739857), -INT32_C(  1056996046), -INT32_C(  1660413429),
+      -INT32_C(    37213999), -INT32_C(   117894634), -INT32_C(  2029173920), -INT32_C(  1196463898),  INT32_C(  1167981845), -INT32_C(   119627066),  INT32_C(   867818791), -INT32_C(   909065737),
+       INT32_C(    13015273),  INT32_C(   200851371), -INT32_C(   376306430), -INT32_C(  2086583954),  INT32_C(    97009471),  INT32_C(   150841057),  INT32_C(  2067510916),  INT32_C(  1631849335),
+       INT32_C(  1331760036), -INT32_C(   849716790), -INT32_C(   843649953),  INT32_C(  1833981742),  INT32_C(  2003966358),  INT32_C(  1132490687), -INT32_C(  1648379098),  INT32_C(  1811809223),
+      -INT32_C(   642097394),  INT32_C(   413537465),  INT32_C(   786783232),  INT32_C(  1251685811),  INT32_C(   247532878), -INT32_C(  1554955907), -INT32_C(  1002434307),  INT32_C(   573521684),
+       INT32_C(  1476127134) };
+  static const int32_t b =  INT32_C(  1453241325);
+  static const int32_t e[] =
+    {  INT32_C(   906196998),  INT32_C(  1186967155),  INT32_C(  1061278011), -INT32_C(   159312817),  INT32_C(  1683846937),  INT32_C(  1748501741), -INT32_C(   675050395),  INT32_C(   305135435),
+      -INT32_C(   961359142), -INT32_C(  1581575578), -INT32_C(   457012460),  INT32_C(  1775743006), -INT32_C(   531421217),  INT32_C(  1827985772), -INT32_C(  1668263803), -INT32_C(  1657459758),
+      -INT32_C(    78043572),  INT32_C(    50531359),  INT32_C(   669673301),  INT32_C(  1467782748),  INT32_C(   537600387),  INT32_C(   103320770), -INT32_C(   522569569),  INT32_C(   438957986),
+      -INT32_C(  1857535374),  INT32_C(  1486179151),  INT32_C(  2110375024),  INT32_C(   145229188), -INT32_C(   530224082),  INT32_C(   177374534), -INT32_C(   839947293),  INT32_C(  1119085008),
+      -INT32_C(    60819353), -INT32_C(    30185522), -INT32_C(   376515011),  INT32_C(  1015133838), -INT32_C(   411913418), -INT32_C(   221680825), -INT32_C(   650922488), -INT32_C(  1155799401),
+       INT32_C(   657321953), -INT32_C(   375457704),  INT32_C(    16749049),  INT32_C(   498129084),  INT32_C(   577713594), -INT32_C(  1354027354),  INT32_C(  2089320165),  INT32_C(  1161274212),
+      -INT32_C(   786836969), -INT32_C(    52453607), -INT32_C(   950610789),  INT32_C(  1380090864),  INT32_C(    41736860), -INT32_C(  1109228840),  INT32_C(  1681484288),  INT32_C(  1525661705),
+       INT32_C(   864818902), -INT32_C(  1131847392),  INT32_C(   629399605),  INT32_C(   971830695),  INT32_C(  1193455471),  INT32_C(  2139281482), -INT32_C(   170145578), -INT32_C(  2078523218),
+       INT32_C(  2008524886), -INT32_C(  1787133867),  INT32_C(  2062790541), -INT32_C(  1175072052),  INT32_C(   585273263), -INT32_C(  1734591854), -INT32_C(  1907503497), -INT32_C(  1774982597),
+      -INT32_C(   538834814), -INT32_C(  1064122209), -INT32_C(    96143746), -INT32_C(  1932590230),  INT32_C(   300247369), -INT32_C(  1041167539),  INT32_C(  1508079250),  INT32_C(  1635223831),
+      -INT32_C(  2034955033),  INT32_C(  1397114836),  INT32_C(   256739901), -INT32_C(  1888734398),  INT32_C(   367852930),  INT32_C(   609839250), -INT32_C(  1670278266), -INT32_C(  1386744379),
+      -INT32_C(   701297662), -INT32_C(  1876329901),  INT32_C(  1184855812),  INT32_C(  1106286434),  INT32_C(   215718423), -INT32_C(  1807030858), -INT32_C(   410335199),  INT32_C(   698663910),
+       INT32_C(  1117177838),  INT32_C(  1806135085), -INT32_C(   510889417), -INT32_C(   735164250),  INT32_C(  1714905776),  INT32_C(  1778025031),  INT32_C(   139494730),  INT32_C(  1950447707),
+       INT32_C(  1251091023),  INT32_C(  1446210079), -INT32_C(   762613076), -INT32_C(   764736478), -INT32_C(  1237802130),  INT32_C(   281496385),  INT32_C(   511209399), -INT32_C(    25935789),
+      -INT32_C(  1361318093),  INT32_C(  1360273013), -INT32_C(   878348666), -INT32_C(   282975112), -INT32_C(   545518918), -INT32_C(   196175044),  INT32_C(  1561511434), -INT32_C(  1503885817),
+       INT32_C(   124077970),  INT32_C(   128693614), -INT32_C(   958125727), -INT32_C(   706537957),  INT32_C(  1555324960),  INT32_C(   105907195), -INT32_C(  2032735211), -INT32_C(  1059416651),
+      -INT32_C(  1136814213),  INT32_C(   447863893), -INT32_C(    63441440),  INT32_C(   735124235), -INT32_C(   798392097),  INT32_C(  1401569749), -INT32_C(  1050028129),  INT32_C(  1726894643),
+      -INT32_C(   380152258), -INT32_C(   538524417), -INT32_C(   992272967), -INT32_C(  1276138184), -INT32_C(  1138067661),  INT32_C(  1016804387),  INT32_C(   648950150),  INT32_C(  1103908555),
+       INT32_C(  1879957617),  INT32_C(  1652898516),  INT32_C(  1226976016), -INT32_C(  1965393416), -INT32_C(   658037111), -INT32_C(  1086836023), -INT32_C(   747040761), -INT32_C(   803977633),
+       INT32_C(    32326190),  INT32_C(   623415572), -INT32_C(  1787933764), -INT32_C(   425694627),  INT32_C(   417476925),  INT32_C(  1169236030),  INT32_C(   657623920), -INT32_C(  1755304591),
+       INT32_C(  1667342670), -INT32_C(   293041614),  INT32_C(   847509205), -INT32_C(   250076064), -INT32_C(  1856666724),  INT32_C(   638517750), -INT32_C(   220072772), -INT32_C(  1556867499),
+       INT32_C(   918130539), -INT32_C(   187199969), -INT32_C(   906492620),  INT32_C(   198590079),  INT32_C(   181741076), -INT32_C(   775324389),  INT32_C(  1643177740),  INT32_C(   331752761),
+      -INT32_C(  1480313531),  INT32_C(   516781210), -INT32_C(  1617403741),  INT32_C(  1486616138), -INT32_C(  1924033024),  INT32_C(   528122387),  INT32_C(  1719757417),  INT32_C(  1192920718),
+       INT32_C(   723564433), -INT32_C(    78975444),  INT32_C(   340413922),  INT32_C(  1325158427),  INT32_C(   553435498), -INT32_C(  1727739857), -INT32_C(  1056996046), -INT32_C(  1660413429),
+       INT32_C(  1305865341), -INT32_C(   117894634),  INT32_C(   581140448), -INT32_C(  1565462802),  INT32_C(   741276529), -INT32_C(   119627066),  INT32_C(   867818791),  INT32_C(  2119517867),
+       INT32_C(   982809269),  INT32_C(   200851371), -INT32_C(   376306430), -INT32_C(   219317034), -INT32_C(  1854039469),  INT32_C(  1130418509), -INT32_C(   732019660),  INT32_C(  1631849335),
+      -INT32_C(  1624018220), -INT32_C(   849716790),  INT32_C(   641810675),  INT32_C(  1833981742),  INT32_C(  2003966358),  INT32_C(  1844183251), -INT32_C(  1648379098), -INT32_C(   979393477),
+       INT32_C(  1084541430), -INT32_C(   496203195), -INT32_C(  1851118592), -INT32_C(   558440521),  INT32_C(   254466870), -INT32_C(  1554955907), -INT32_C(   178872007),  INT32_C(   573521684),
+       INT32_C(  1476127134) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t
+      rv,
+      av = simde_svld1_s32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_n_s32_m(pv, av, b);
+
+    simde_svst1_s32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)], a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_s32(pg, &(a[i]));
+
+    ev = simde_svmul_n_s32_m(pv, av, b);
+
+    simde_svst1_s32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i32(1, b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) };
+  static const int64_t a[] =
+    { -INT64_C( 2333488575251878941), -INT64_C( 5227320152361910496),  INT64_C( 5089667579699246720),  INT64_C( 7636112124901339919),
+      -INT64_C( 8271117531751012905), -INT64_C( 4174457220888170155),  INT64_C(  867216697039707152), -INT64_C( 7558708405773609941),
+      -INT64_C(   93688659316862024),  INT64_C(  118054502763370647),  INT64_C( 2112130987344525637),  INT64_C( 3816774830117513632),
+      -INT64_C( 6691772850030123397),  INT64_C( 3068962235272493988), -INT64_C( 4166748683570947298),  INT64_C( 6761624749763656230),
+      -INT64_C( 2255278410517369085),  INT64_C( 8515478241605465119),  INT64_C( 9031602191877970537), -INT64_C( 7066722196099466067),
+       INT64_C( 3549223613392317988),  INT64_C( 3342623950650062740),  INT64_C( 5246997698237622781),  INT64_C(  705030929740525712),
+       INT64_C( 7599731828708767027),  INT64_C(  889100351692975202), -INT64_C( 5078598955892206431),  INT64_C( 6201363374545263905),
+      -INT64_C( 8692489181318055648),  INT64_C( 1070455301329630400), -INT64_C( 8215743931820066022), -INT64_C( 6077991932148850898),
+       INT64_C( 1641561335116349980), -INT64_C( 7625226954724772173),  INT64_C( 8643766996570765563),  INT64_C( 5037397306623100851),
+       INT64_C( 4259364594206017968), -INT64_C( 4839530385973313084),  INT64_C( 3873121527878888960), -INT64_C( 6481423173233178466),
+      -INT64_C( 6510012766312623132), -INT64_C( 8482042219431918901),  INT64_C( 2459410170150939753), -INT64_C( 3118187556984155108),
+      -INT64_C(  427305199246154101),  INT64_C( 2017560618668127978), -INT64_C( 8871202414921264324),  INT64_C( 5873063099507330493),
+      -INT64_C( 7647165305051037003),  INT64_C( 8327728790491522757),  INT64_C( 9135295388456294876),  INT64_C( 7204261515311668964),
+       INT64_C( 5525960203998640239), -INT64_C( 6974011198651778418),  INT64_C( 7290952320754543598),  INT64_C( 8509561424623655432),
+       INT64_C( 1627278893953147073), -INT64_C( 7179561689223112453), -INT64_C( 1052580167973847171),  INT64_C( 4490862321440617429),
+       INT64_C( 2287295505010975520),  INT64_C( 2863790915458013300),  INT64_C( 6581318740265536378), -INT64_C( 2614469620379681539),
+      -INT64_C( 3625044372107346323),  INT64_C( 4876464677077356250),  INT64_C( 6456749389412487865), -INT64_C( 4067161291300351497),
+       INT64_C( 3309875603298652872),  INT64_C( 5018239841825119896),  INT64_C( 4532061888372296496),  INT64_C(  653443339352389615),
+       INT64_C(  941844361437211281),  INT64_C( 5965601695394088184),  INT64_C( 6765184465948790622), -INT64_C( 1961677917886360709),
+       INT64_C(  262576620643676451), -INT64_C( 8929139260237802592),  INT64_C( 3633291880242410658), -INT64_C( 1218586760541432866) };
+  static const int64_t b = -INT64_C( 7953898692603629630);
+  static const int64_t e[] =
+    { -INT64_C( 5875577659109740794), -INT64_C( 1276723161696913856), -INT64_C( 8447301239361647360),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 5247429437235122794),
+      -INT64_C( 7952671731112953488), -INT64_C( 7614494482264171666),  INT64_C( 1280221612754014538), -INT64_C( 8169750518069957824),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C( 6043560430215139004),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 2875765536652087170),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 5887220690618159944),  INT64_C( 4251137226995092008), -INT64_C( 3952394841456687942),  INT64_C(  632865946179517728),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2083626557491895806),
+       INT64_C(  833914186015746624),  INT64_C( 4987533276298492288),  INT64_C(                   0), -INT64_C( 2849404991579647268),
+       INT64_C( 5394055957413838136), -INT64_C( 3788430046387613530),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C( 5633949749467786616),  INT64_C( 5113543231161490432),  INT64_C( 4943900383515609532),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(  802810575222468242),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 4183002581564855124),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 4714898814771218474),  INT64_C( 6832772189011610698),  INT64_C( 5838950776703024312), -INT64_C( 7905049000634235704),
+       INT64_C(                   0), -INT64_C(  754540040576142948), -INT64_C( 6793593381069423524),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C( 3270950133859681078),  INT64_C(                   0),  INT64_C( 8326515659727331946),
+      -INT64_C( 6219942881537622464),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 6801107207120474522), -INT64_C( 6789256710504233164), -INT64_C(  782499128468691150),  INT64_C( 5838590588493035054),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 5877257594007576802),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C( 1220334056648845702),  INT64_C( 5519398045479419712),  INT64_C(                   0), -INT64_C(  514037449040736196) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_n_s64_z(pv, av, b);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    ev = simde_svmul_n_s64_z(pv, av, b);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_s64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1) };
+  static const int64_t a[] =
+    {  INT64_C( 2807478858028835988),  INT64_C( 8711884453600295924),  INT64_C( 6732518256159752903),  INT64_C( 4624345437729902049),
+      -INT64_C( 8815297566828698018),  INT64_C( 6699158959590916288), -INT64_C( 3729322530287504077),  INT64_C( 3207045406643639701),
+      -INT64_C( 3011966875649224676), -INT64_C( 2159106934696411879), -INT64_C( 4523300485880126588), -INT64_C( 7434734368250935849),
+      -INT64_C(  882572645335989803), -INT64_C( 1547362064129845258),  INT64_C( 2592827966070737421),  INT64_C( 6299298390497361496),
+       INT64_C( 2299371463997829404),  INT64_C( 4713380070067308825), -INT64_C( 5979806868519075180), -INT64_C( 9057323348605744013),
+      -INT64_C( 6060048965557514339), -INT64_C( 8547949791526802709), -INT64_C( 4370623249417381290),  INT64_C( 7071221810783181113),
+      -INT64_C( 1742032154693952874), -INT64_C( 1642013329192517960),  INT64_C( 4995034099918151487), -INT64_C( 6346408527952278842),
+      -INT64_C( 2484682816251554143),  INT64_C( 3323024233680505505),  INT64_C( 7399711744928297567),  INT64_C( 4598421085651899928),
+      -INT64_C( 2020038971305975819), -INT64_C( 6915219770390904341), -INT64_C( 1446290093897890585), -INT64_C( 5462332260460732588),
+       INT64_C( 6460912220012154244), -INT64_C( 2582748460575637434),  INT64_C( 5169376951133221888),  INT64_C( 4297395807666688560),
+       INT64_C( 9097178028882162295), -INT64_C( 5891502510555434132),  INT64_C( 2349540832534700130), -INT64_C( 5331220451667487728),
+       INT64_C( 2079215728499361061),  INT64_C( 8046729728477749326),  INT64_C( 8893306803610463322),  INT64_C( 5992116469515909940),
+      -INT64_C( 1290128869219646389), -INT64_C( 6131765995776535190),  INT64_C( 4515528272757763011),  INT64_C( 9105672834859003356),
+       INT64_C(   12544973454511262),  INT64_C( 8223959601783511079),  INT64_C( 6076283301367191306),  INT64_C( 8928874295902209080),
+       INT64_C( 1972267624070472391),  INT64_C( 4548551191794210558),  INT64_C( 4870263713847099594),  INT64_C( 8576146370588505259),
+      -INT64_C( 6842881379633086982),  INT64_C( 1837308455339072266),  INT64_C( 2701581958271193902), -INT64_C( 4824004172239262490),
+       INT64_C( 2284648913584251503), -INT64_C( 6937832125666229681), -INT64_C( 1490596900744129871),  INT64_C( 2162729129521315202),
+      -INT64_C( 5501740253675737232), -INT64_C( 7785025137642765081), -INT64_C( 6338237968666407142), -INT64_C( 8513788903219623157),
+      -INT64_C( 3118826386374129247),  INT64_C( 3110898897290791095),  INT64_C(  342366996216343282),  INT64_C( 4792278200417693663),
+      -INT64_C(  404481450423447648), -INT64_C( 6754624628559933946), -INT64_C( 4636601086604833621), -INT64_C( 7129979972361951702),
+       INT64_C( 6342629929911997383),  INT64_C(  319106147836467482), -INT64_C( 3612925239062157251), -INT64_C( 7903916526718643275),
+       INT64_C( 2423677697384086264), -INT64_C(   28893230344171205),  INT64_C( 5112140350007034241),  INT64_C( 2875627725940885899),
+       INT64_C( 7127248946878055874), -INT64_C( 5699991217954630364), -INT64_C( 8887916565201878575), -INT64_C( 6150295412288085936),
+       INT64_C( 5607645819062851144),  INT64_C( 3031230796342217009), -INT64_C(  245952315506563559),  INT64_C( 8891548445873762515),
+       INT64_C( 7327000572633732919),  INT64_C( 1371582459501994373), -INT64_C( 7321238054572223300),  INT64_C( 4097072801097572397),
+       INT64_C(  516302634762159505), -INT64_C( 9064076140256760024),  INT64_C( 5035957973091572610), -INT64_C( 8905163535451604943),
+       INT64_C( 8200900207178220357),  INT64_C( 2786542497056404834),  INT64_C( 1837842375560369700), -INT64_C( 1440388104605456757),
+       INT64_C( 2338637859112831929), -INT64_C(  792082881571125449),  INT64_C( 5731872602774925450),  INT64_C( 5002601488465123033),
+      -INT64_C( 2740232965655617766), -INT64_C( 4572924704885292605),  INT64_C( 5132060055150180902), -INT64_C( 1268550733858929261),
+       INT64_C( 3300786038708284754),  INT64_C( 6842738289133322752),  INT64_C( 8699125878195955716),  INT64_C(  380834214785351813),
+      -INT64_C( 3584081565975965781),  INT64_C( 5899990722656076618),  INT64_C( 3278757589852301346) };
+  static const int64_t b =  INT64_C( 2396901287330704394);
+  static const int64_t e[] =
+    {  INT64_C( 2807478858028835988),  INT64_C( 2631461641253341064),  INT64_C(  432051627768844230),  INT64_C( 9073096868674959050),
+      -INT64_C( 1710434739337386068),  INT64_C( 6699158959590916288),  INT64_C( 9132166983407638526),  INT64_C( 3207045406643639701),
+      -INT64_C( 6393469568970460904), -INT64_C( 1452086706245144838),  INT64_C( 2555265447766496040), -INT64_C( 7434734368250935849),
+      -INT64_C( 6140376109724701102),  INT64_C( 4171627137232910236),  INT64_C( 2592827966070737421),  INT64_C( 6299298390497361496),
+      -INT64_C( 7069876526981006568), -INT64_C( 6386334939498060038), -INT64_C( 5979806868519075180),  INT64_C( 8779433279179784318),
+      -INT64_C( 6060048965557514339), -INT64_C( 8547949791526802709),  INT64_C( 6395393937461727068),  INT64_C( 7071221810783181113),
+       INT64_C(  372361147334414812),  INT64_C( 8104002503141856048),  INT64_C( 4995034099918151487), -INT64_C( 8478706434098400324),
+      -INT64_C( 6378758981412172214),  INT64_C( 3323024233680505505),  INT64_C( 7399711744928297567),  INT64_C(  876430228838153456),
+       INT64_C( 5777842391824014226), -INT64_C( 6915219770390904341), -INT64_C( 1446290093897890585), -INT64_C( 5462332260460732588),
+      -INT64_C(  838421581610469592), -INT64_C( 2582748460575637434),  INT64_C( 5169376951133221888), -INT64_C( 4502801708598528544),
+       INT64_C( 9097178028882162295), -INT64_C( 5891502510555434132),  INT64_C( 2349540832534700130),  INT64_C( 1533178193256450208),
+       INT64_C( 2079215728499361061),  INT64_C( 9161231207180577548),  INT64_C( 8893306803610463322),  INT64_C( 6180178462338891784),
+      -INT64_C( 1290128869219646389), -INT64_C( 9210852275067318748),  INT64_C( 4515528272757763011),  INT64_C( 9105672834859003356),
+       INT64_C(   12544973454511262),  INT64_C( 8223959601783511079), -INT64_C(  724878703901139356),  INT64_C( 8928874295902209080),
+      -INT64_C(  389062022803730490),  INT64_C( 4548551191794210558),  INT64_C( 4870263713847099594),  INT64_C( 8576146370588505259),
+      -INT64_C( 6842881379633086982), -INT64_C( 4296615163262319004),  INT64_C( 2701581958271193902), -INT64_C( 6531279340332267268),
+       INT64_C( 2284648913584251503), -INT64_C( 7498118490660672746), -INT64_C(  317503003283495190),  INT64_C( 2162729129521315202),
+       INT64_C(  846863882924464736), -INT64_C( 7785025137642765081), -INT64_C( 6338237968666407142), -INT64_C( 8513788903219623157),
+      -INT64_C( 3118826386374129247),  INT64_C( 8342974032447277862),  INT64_C( 1449818963906020724),  INT64_C( 6778197090149298870),
+      -INT64_C( 7825299292267406272), -INT64_C( 6730073068311866308), -INT64_C( 4636601086604833621), -INT64_C( 7129979972361951702),
+       INT64_C( 4352343623795587526),  INT64_C(  319106147836467482), -INT64_C( 7373146345158554014), -INT64_C( 7903916526718643275),
+      -INT64_C( 8474842205354496592), -INT64_C(   28893230344171205),  INT64_C( 5112140350007034241),  INT64_C( 5684445279524782958),
+       INT64_C( 7127248946878055874), -INT64_C( 5699991217954630364),  INT64_C( 1219707037195419178), -INT64_C( 6150295412288085936),
+       INT64_C( 7814359122541231824),  INT64_C( 3031230796342217009),  INT64_C( 6516313922324334842),  INT64_C( 8891548445873762515),
+       INT64_C( 7327000572633732919), -INT64_C( 4827814521370678478), -INT64_C( 6500287345922990248),  INT64_C( 4097072801097572397),
+      -INT64_C( 4304293750996311126),  INT64_C( 2030240215226267536),  INT64_C( 5035957973091572610), -INT64_C( 8905163535451604943),
+       INT64_C( 8200900207178220357),  INT64_C( 2786542497056404834), -INT64_C( 5070791181819376280), -INT64_C( 8744371406790285970),
+       INT64_C(  809064838455918906),  INT64_C( 8488452360603171878),  INT64_C( 5139755368944999780),  INT64_C( 5002601488465123033),
+      -INT64_C( 2740232965655617766), -INT64_C( 4572924704885292605), -INT64_C( 1712036573394743940), -INT64_C( 2769800555214095426),
+       INT64_C( 6314259555146816820),  INT64_C( 6842738289133322752), -INT64_C( 1099598549932359640),  INT64_C( 4565365640772755762),
+      -INT64_C( 3584081565975965781), -INT64_C( 9103141466290366236), -INT64_C( 5327707321524491948) };
+
+  static int64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t
+      rv,
+      av = simde_svld1_s64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_n_s64_m(pv, av, b);
+
+    simde_svst1_s64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)], a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_i64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_s64(pg, &(a[i]));
+
+    ev = simde_svmul_n_s64_m(pv, av, b);
+
+    simde_svst1_s64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1i64(1, b);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u8_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1) };
+  static const uint8_t a[] =
+    { UINT8_C(206), UINT8_C(161), UINT8_C(107), UINT8_C(209), UINT8_C(173), UINT8_C(225), UINT8_C(210), UINT8_C(118),
+      UINT8_C( 52), UINT8_C(  6), UINT8_C( 16), UINT8_C( 97), UINT8_C(132), UINT8_C( 77), UINT8_C(  5), UINT8_C(159),
+      UINT8_C( 59), UINT8_C(193), UINT8_C(176), UINT8_C( 97), UINT8_C(193), UINT8_C( 19), UINT8_C( 29), UINT8_C(132),
+      UINT8_C( 47), UINT8_C(240), UINT8_C(140), UINT8_C( 61), UINT8_C( 51), UINT8_C(242), UINT8_C(102), UINT8_C(  1),
+      UINT8_C(148), UINT8_C(209), UINT8_C(211), UINT8_C( 65), UINT8_C(179), UINT8_C(165), UINT8_C(184), UINT8_C(231),
+      UINT8_C(171), UINT8_C(200), UINT8_C( 73), UINT8_C( 47), UINT8_C( 22), UINT8_C( 78), UINT8_C(206), UINT8_C( 81),
+      UINT8_C( 16), UINT8_C(127), UINT8_C(178), UINT8_C(209), UINT8_C(146), UINT8_C(207), UINT8_C( 85), UINT8_C(194),
+      UINT8_C(192), UINT8_C(225),    UINT8_MAX, UINT8_C(243), UINT8_C(211), UINT8_C(101), UINT8_C(244), UINT8_C(103),
+      UINT8_C( 54), UINT8_C(199), UINT8_C(169), UINT8_C(233), UINT8_C(108), UINT8_C( 97), UINT8_C(209), UINT8_C( 23),
+      UINT8_C( 41), UINT8_C( 26), UINT8_C( 71), UINT8_C( 63), UINT8_C(104), UINT8_C( 21), UINT8_C(144), UINT8_C(120),
+      UINT8_C(148), UINT8_C( 67), UINT8_C( 73), UINT8_C( 39), UINT8_C( 18), UINT8_C(158), UINT8_C(233), UINT8_C(210),
+      UINT8_C(127), UINT8_C(232), UINT8_C(197), UINT8_C( 83), UINT8_C( 77), UINT8_C(186), UINT8_C(186), UINT8_C(131),
+      UINT8_C(129), UINT8_C( 99), UINT8_C(109), UINT8_C(238), UINT8_C(196), UINT8_C( 62), UINT8_C(  5), UINT8_C(238),
+      UINT8_C( 88), UINT8_C( 76), UINT8_C( 45), UINT8_C(192), UINT8_C( 98), UINT8_C(190), UINT8_C( 57), UINT8_C(246),
+      UINT8_C(  1), UINT8_C(130), UINT8_C( 29), UINT8_C( 19), UINT8_C( 33), UINT8_C(  6), UINT8_C(230), UINT8_C(160),
+      UINT8_C(238), UINT8_C(171), UINT8_C(243), UINT8_C( 59), UINT8_C(101), UINT8_C(174), UINT8_C(191), UINT8_C(231),
+      UINT8_C( 17), UINT8_C( 44), UINT8_C(213), UINT8_C(214), UINT8_C(106), UINT8_C(218), UINT8_C(196), UINT8_C(194),
+      UINT8_C( 39), UINT8_C(241), UINT8_C(130), UINT8_C(137), UINT8_C(175), UINT8_C(187), UINT8_C(127), UINT8_C(176),
+      UINT8_C( 62), UINT8_C(157), UINT8_C(196), UINT8_C( 95), UINT8_C(163), UINT8_C(170),    UINT8_MAX, UINT8_C(146),
+      UINT8_C( 85), UINT8_C(243), UINT8_C(205), UINT8_C(187), UINT8_C(161), UINT8_C(140), UINT8_C(162), UINT8_C(178),
+      UINT8_C(184), UINT8_C(119), UINT8_C(136), UINT8_C( 34), UINT8_C( 81), UINT8_C( 76), UINT8_C(228), UINT8_C(120),
+      UINT8_C( 62), UINT8_C(103), UINT8_C(  1), UINT8_C(237), UINT8_C( 34), UINT8_C(129), UINT8_C(158), UINT8_C( 96),
+      UINT8_C( 30), UINT8_C( 98), UINT8_C(191), UINT8_C(193), UINT8_C( 12), UINT8_C(191), UINT8_C( 83), UINT8_C( 97),
+      UINT8_C(178), UINT8_C( 33), UINT8_C( 28), UINT8_C( 83), UINT8_C(173), UINT8_C(190), UINT8_C(  5), UINT8_C(102),
+      UINT8_C( 53), UINT8_C(142), UINT8_C(136), UINT8_C(135), UINT8_C(218), UINT8_C(109),    UINT8_MAX, UINT8_C( 24),
+      UINT8_C(212), UINT8_C(  1), UINT8_C(  6), UINT8_C(246), UINT8_C(130), UINT8_C(164), UINT8_C( 87), UINT8_C(160),
+      UINT8_C(  6), UINT8_C( 22), UINT8_C( 97), UINT8_C( 18), UINT8_C(213), UINT8_C(181), UINT8_C(115), UINT8_C(135),
+      UINT8_C(214), UINT8_C(144), UINT8_C(218), UINT8_C(131), UINT8_C( 78), UINT8_C(224), UINT8_C(233), UINT8_C(132),
+      UINT8_C(110), UINT8_C(114), UINT8_C( 11), UINT8_C( 72), UINT8_C(223), UINT8_C( 10), UINT8_C( 97), UINT8_C(179),
+      UINT8_C( 11), UINT8_C(103), UINT8_C(169), UINT8_C(141), UINT8_C( 11), UINT8_C(  0), UINT8_C( 45), UINT8_C( 17),
+      UINT8_C( 23), UINT8_C(143), UINT8_C( 35), UINT8_C(236), UINT8_C( 68), UINT8_C(150), UINT8_C(116), UINT8_C( 26),
+      UINT8_C( 38), UINT8_C( 78), UINT8_C(157), UINT8_C(117), UINT8_C( 46), UINT8_C(135), UINT8_C(249), UINT8_C(156),
+      UINT8_C(249), UINT8_C(  4), UINT8_C(229), UINT8_C(216), UINT8_C( 14), UINT8_C( 70), UINT8_C(139), UINT8_C( 26),
+      UINT8_C(173), UINT8_C( 52), UINT8_C(167), UINT8_C(184), UINT8_C( 53), UINT8_C(213), UINT8_C(201), UINT8_C( 76),
+      UINT8_C(100), UINT8_C(236), UINT8_C( 56), UINT8_C(168), UINT8_C(130), UINT8_C(172), UINT8_C(194), UINT8_C(169),
+      UINT8_C(251), UINT8_C( 95), UINT8_C( 30), UINT8_C( 41), UINT8_C(230), UINT8_C( 23), UINT8_C(198), UINT8_C(223),
+      UINT8_C( 27), UINT8_C(171), UINT8_C(183), UINT8_C( 41), UINT8_C(241), UINT8_C( 66), UINT8_C( 67), UINT8_C(158),
+      UINT8_C(119), UINT8_C(235), UINT8_C( 86), UINT8_C(172), UINT8_C(192), UINT8_C( 31), UINT8_C(248), UINT8_C( 36),
+      UINT8_C( 11), UINT8_C( 48), UINT8_C(204), UINT8_C(141), UINT8_C(221), UINT8_C(142), UINT8_C( 54), UINT8_C(216),
+      UINT8_C(237), UINT8_C( 84), UINT8_C(  1), UINT8_C(212), UINT8_C(107), UINT8_C(199), UINT8_C(179), UINT8_C(134),
+      UINT8_C(114), UINT8_C(107), UINT8_C(176), UINT8_C( 99), UINT8_C(173), UINT8_C(243), UINT8_C(  1), UINT8_C( 36),
+      UINT8_C(222), UINT8_C( 87), UINT8_C(208), UINT8_C(158), UINT8_C(118), UINT8_C(200), UINT8_C(194), UINT8_C(129),
+      UINT8_C(249), UINT8_C(142), UINT8_C( 15), UINT8_C(214), UINT8_C( 28), UINT8_C( 69), UINT8_C(174), UINT8_C( 10),
+      UINT8_C(154), UINT8_C(175), UINT8_C(222), UINT8_C(  5), UINT8_C(119), UINT8_C(145), UINT8_C(140), UINT8_C(233),
+      UINT8_C(252), UINT8_C( 60), UINT8_C( 77), UINT8_C(170), UINT8_C( 47), UINT8_C( 78), UINT8_C(206), UINT8_C( 14),
+      UINT8_C(166), UINT8_C(159), UINT8_C(172), UINT8_C( 28), UINT8_C(103), UINT8_C(111), UINT8_C(158), UINT8_C( 96),
+      UINT8_C(253), UINT8_C(173), UINT8_C( 54), UINT8_C( 26), UINT8_C(242), UINT8_C(228), UINT8_C( 36), UINT8_C(140),
+      UINT8_C(148), UINT8_C(  2), UINT8_C(146), UINT8_C( 11), UINT8_C(147), UINT8_C( 30), UINT8_C(244), UINT8_C(144),
+      UINT8_C( 90), UINT8_C( 65), UINT8_C( 58), UINT8_C(137), UINT8_C(144), UINT8_C(  8), UINT8_C(151), UINT8_C( 54),
+      UINT8_C(167), UINT8_C( 68), UINT8_C( 82), UINT8_C( 15), UINT8_C(179), UINT8_C(240), UINT8_C(111), UINT8_C(176),
+      UINT8_C(157), UINT8_C(166), UINT8_C(202), UINT8_C(144), UINT8_C(138), UINT8_C(238), UINT8_C( 28), UINT8_C( 30),
+      UINT8_C(240), UINT8_C(174), UINT8_C( 41), UINT8_C(132), UINT8_C(204), UINT8_C( 30), UINT8_C( 20), UINT8_C( 38),
+      UINT8_C( 95), UINT8_C( 78), UINT8_C(176), UINT8_C(239), UINT8_C( 86), UINT8_C( 71), UINT8_C( 37), UINT8_C(254),
+      UINT8_C(139), UINT8_C(120), UINT8_C( 13), UINT8_C( 62), UINT8_C(104), UINT8_C(124), UINT8_C(239), UINT8_C(  6),
+      UINT8_C( 34), UINT8_C(185), UINT8_C(150), UINT8_C(173), UINT8_C(168), UINT8_C(178), UINT8_C(203), UINT8_C(152),
+      UINT8_C( 97), UINT8_C(245), UINT8_C( 28), UINT8_C( 45), UINT8_C( 19), UINT8_C( 48), UINT8_C( 84), UINT8_C(114),
+      UINT8_C(126), UINT8_C(  4), UINT8_C( 98), UINT8_C(213), UINT8_C( 75), UINT8_C(135), UINT8_C(211), UINT8_C(215),
+         UINT8_MAX, UINT8_C(224), UINT8_C( 21), UINT8_C(104), UINT8_C( 92), UINT8_C(  4), UINT8_C(110), UINT8_C(127),
+      UINT8_C(190), UINT8_C(  4), UINT8_C( 44), UINT8_C(102), UINT8_C(182), UINT8_C(247), UINT8_C(254), UINT8_C( 23),
+      UINT8_C(236), UINT8_C( 27), UINT8_C( 69),    UINT8_MAX, UINT8_C( 75), UINT8_C(153), UINT8_C(114), UINT8_C(202),
+      UINT8_C(157), UINT8_C(212), UINT8_C(159), UINT8_C(232), UINT8_C( 91), UINT8_C(114), UINT8_C(191), UINT8_C( 91),
+      UINT8_C( 82), UINT8_C(213), UINT8_C(195), UINT8_C(174), UINT8_C(217), UINT8_C( 49), UINT8_C( 45), UINT8_C(151),
+      UINT8_C( 53), UINT8_C( 89), UINT8_C(253), UINT8_C(235), UINT8_C( 81), UINT8_C(252), UINT8_C(  3), UINT8_C( 61),
+      UINT8_C( 23), UINT8_C( 72), UINT8_C( 61), UINT8_C( 98), UINT8_C(225), UINT8_C(175), UINT8_C( 44), UINT8_C(126),
+      UINT8_C(131), UINT8_C(203), UINT8_C(102), UINT8_C(222), UINT8_C( 61), UINT8_C( 38), UINT8_C( 57), UINT8_C(143),
+      UINT8_C(251), UINT8_C(252), UINT8_C( 62), UINT8_C(212), UINT8_C( 45), UINT8_C(107), UINT8_C(108), UINT8_C( 98),
+      UINT8_C(197), UINT8_C(105), UINT8_C( 78), UINT8_C( 22), UINT8_C(101), UINT8_C( 81), UINT8_C( 83), UINT8_C(124),
+      UINT8_C(153), UINT8_C(144), UINT8_C(223), UINT8_C(122), UINT8_C( 63), UINT8_C( 11), UINT8_C(248), UINT8_C(194),
+      UINT8_C(215), UINT8_C( 94), UINT8_C(161), UINT8_C( 20), UINT8_C(132), UINT8_C(218), UINT8_C(164), UINT8_C(127),
+      UINT8_C(215), UINT8_C(226), UINT8_C( 84), UINT8_C(  4), UINT8_C( 77), UINT8_C(192), UINT8_C(103), UINT8_C( 18),
+      UINT8_C( 41), UINT8_C(181), UINT8_C( 40), UINT8_C(143), UINT8_C(  6), UINT8_C(124), UINT8_C( 11), UINT8_C(159),
+      UINT8_C( 12), UINT8_C(234), UINT8_C( 25), UINT8_C( 76), UINT8_C(246), UINT8_C( 17), UINT8_C( 14), UINT8_C(205),
+      UINT8_C(111), UINT8_C(175), UINT8_C(225), UINT8_C(244), UINT8_C(138), UINT8_C(133), UINT8_C(115), UINT8_C( 97),
+      UINT8_C(103), UINT8_C(199), UINT8_C(101), UINT8_C(181), UINT8_C(135), UINT8_C(204), UINT8_C(199), UINT8_C(177),
+      UINT8_C(129), UINT8_C(240), UINT8_C( 64), UINT8_C(135), UINT8_C(108), UINT8_C( 75), UINT8_C( 38), UINT8_C(120),
+      UINT8_C( 54), UINT8_C( 63), UINT8_C(196), UINT8_C( 44), UINT8_C( 80), UINT8_C(211), UINT8_C(249), UINT8_C(192),
+      UINT8_C(130), UINT8_C(218), UINT8_C(180), UINT8_C( 12), UINT8_C( 96), UINT8_C( 39), UINT8_C(109), UINT8_C(199),
+      UINT8_C(239), UINT8_C(211), UINT8_C(124), UINT8_C(118), UINT8_C(159), UINT8_C( 68), UINT8_C( 39), UINT8_C( 33),
+      UINT8_C( 52), UINT8_C(103), UINT8_C(168), UINT8_C(160), UINT8_C(179), UINT8_C(207), UINT8_C( 24), UINT8_C(233),
+      UINT8_C( 14), UINT8_C(221), UINT8_C( 21), UINT8_C( 95), UINT8_C(176), UINT8_C( 14), UINT8_C( 31), UINT8_C( 50),
+      UINT8_C(232), UINT8_C(211), UINT8_C( 63), UINT8_C( 72), UINT8_C(250), UINT8_C(172), UINT8_C( 16), UINT8_C(233),
+      UINT8_C(127), UINT8_C(140), UINT8_C( 96), UINT8_C( 31), UINT8_C(208), UINT8_C(135), UINT8_C( 64), UINT8_C(  4),
+      UINT8_C(239), UINT8_C(232), UINT8_C(164), UINT8_C(162), UINT8_C(183), UINT8_C(189), UINT8_C(139), UINT8_C(198),
+      UINT8_C(154), UINT8_C(160), UINT8_C( 37), UINT8_C( 74), UINT8_C(174), UINT8_C( 68), UINT8_C(124), UINT8_C(150),
+      UINT8_C( 23), UINT8_C(187), UINT8_C(223), UINT8_C( 17), UINT8_C(104), UINT8_C(239), UINT8_C(251), UINT8_C(231),
+      UINT8_C(123), UINT8_C( 91), UINT8_C(  6), UINT8_C( 76), UINT8_C(226), UINT8_C( 70), UINT8_C( 80), UINT8_C(209),
+      UINT8_C( 47), UINT8_C(245), UINT8_C(115), UINT8_C(230), UINT8_C(178), UINT8_C(254), UINT8_C(172), UINT8_C( 76),
+      UINT8_C(158), UINT8_C(209), UINT8_C(150), UINT8_C( 76), UINT8_C( 21), UINT8_C( 18), UINT8_C(227), UINT8_C( 44),
+      UINT8_C(206), UINT8_C(194), UINT8_C( 62), UINT8_C( 54), UINT8_C(177), UINT8_C( 57), UINT8_C( 29), UINT8_C( 44),
+      UINT8_C(148), UINT8_C( 36), UINT8_C(120), UINT8_C(118), UINT8_C(106), UINT8_C(201), UINT8_C( 72), UINT8_C(153),
+      UINT8_C(190), UINT8_C(187), UINT8_C(128), UINT8_C(112), UINT8_C(186), UINT8_C( 44), UINT8_C(188), UINT8_C( 88),
+      UINT8_C(254), UINT8_C( 82), UINT8_C(165), UINT8_C( 19), UINT8_C(100), UINT8_C(136), UINT8_C( 64), UINT8_C( 50),
+      UINT8_C( 74), UINT8_C(126), UINT8_C(104), UINT8_C(251), UINT8_C(183), UINT8_C(134), UINT8_C( 39), UINT8_C( 75),
+      UINT8_C(170), UINT8_C(160), UINT8_C(193), UINT8_C( 20), UINT8_C(105), UINT8_C(  9), UINT8_C(174), UINT8_C( 39),
+      UINT8_C(197), UINT8_C( 46), UINT8_C(151), UINT8_C(127), UINT8_C( 90), UINT8_C( 83), UINT8_C(215), UINT8_C( 88),
+      UINT8_C(165), UINT8_C(124), UINT8_C(108), UINT8_C(  9), UINT8_C(  4), UINT8_C(172), UINT8_C( 60), UINT8_C( 78),
+      UINT8_C( 42) };
+  static const uint8_t b = UINT8_C(224);
+  static const uint8_t e[] =
+    { UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C( 96), UINT8_C(224), UINT8_C(192), UINT8_C( 64),
+      UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(160), UINT8_C(224), UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(224),
+      UINT8_C(  0), UINT8_C(224), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C(224),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C(192), UINT8_C( 32), UINT8_C(  0), UINT8_C(192),
+      UINT8_C(  0), UINT8_C(224), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 32), UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C(224), UINT8_C( 32),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(192), UINT8_C(160),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(224), UINT8_C( 64),
+      UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C( 64), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(160), UINT8_C( 96), UINT8_C(  0), UINT8_C( 32), UINT8_C( 32),
+      UINT8_C(224), UINT8_C(128), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(192), UINT8_C(128), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C( 32), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(192), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(192), UINT8_C(224), UINT8_C(128), UINT8_C(128), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C( 32), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(224),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C( 64), UINT8_C( 96), UINT8_C( 64),
+      UINT8_C( 96), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(224), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(160),
+      UINT8_C(160), UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(224), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C( 64), UINT8_C(160), UINT8_C(  0),
+      UINT8_C( 96), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(224), UINT8_C(128),
+      UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(192), UINT8_C(  0),
+      UINT8_C(160), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32),
+      UINT8_C(160), UINT8_C(  0), UINT8_C( 32), UINT8_C(224), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C( 64),
+      UINT8_C(  0), UINT8_C(160), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128),
+      UINT8_C(160), UINT8_C(  0), UINT8_C(128), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0),
+      UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(160), UINT8_C(  0),
+      UINT8_C(192), UINT8_C(160), UINT8_C(  0), UINT8_C(160), UINT8_C( 96), UINT8_C(  0), UINT8_C(224), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(224), UINT8_C( 64), UINT8_C( 32), UINT8_C( 64), UINT8_C(128), UINT8_C( 96), UINT8_C( 64), UINT8_C(192),
+      UINT8_C(  0), UINT8_C( 32), UINT8_C( 64), UINT8_C( 96), UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(192), UINT8_C(  0), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(128),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(160), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64),
+      UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 96), UINT8_C( 64), UINT8_C(192), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(128), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C( 64), UINT8_C(128), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(224), UINT8_C( 96), UINT8_C(128), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(192), UINT8_C( 96), UINT8_C(160), UINT8_C(  0), UINT8_C(160), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32),
+      UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C( 64), UINT8_C( 64), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224), UINT8_C(192), UINT8_C(192),
+      UINT8_C(  0), UINT8_C(128), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(224), UINT8_C(224), UINT8_C( 96), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(224), UINT8_C( 96), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C(  0), UINT8_C( 96), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C( 64),
+      UINT8_C(160), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C( 96), UINT8_C(160), UINT8_C(128), UINT8_C(192),
+      UINT8_C( 96), UINT8_C(  0), UINT8_C( 64), UINT8_C( 64), UINT8_C( 96), UINT8_C(224), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C( 64), UINT8_C(  0), UINT8_C(128), UINT8_C(128), UINT8_C(192), UINT8_C(128), UINT8_C( 32),
+      UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C( 96), UINT8_C(  0), UINT8_C( 32), UINT8_C(192),
+      UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(128), UINT8_C(160), UINT8_C( 32),
+      UINT8_C(128), UINT8_C(192), UINT8_C(224), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C( 32), UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224),
+      UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(128), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(192), UINT8_C(192), UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C( 64), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(224),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(224),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C( 96), UINT8_C( 32), UINT8_C(  0), UINT8_C( 64), UINT8_C(  0), UINT8_C(192),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C(128), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C( 96), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(192), UINT8_C(  0), UINT8_C( 96), UINT8_C(192), UINT8_C( 64), UINT8_C(  0), UINT8_C(128), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(160), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(224),
+      UINT8_C( 32), UINT8_C( 96), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(128), UINT8_C(  0),
+      UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(192), UINT8_C(  0), UINT8_C(128),
+      UINT8_C(  0), UINT8_C(192), UINT8_C( 64), UINT8_C( 64), UINT8_C(224), UINT8_C(224), UINT8_C(  0), UINT8_C(128),
+      UINT8_C(128), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64), UINT8_C(192), UINT8_C(224), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(160), UINT8_C( 32), UINT8_C( 64), UINT8_C( 32), UINT8_C(160),
+      UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(224), UINT8_C(224), UINT8_C( 64), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0), UINT8_C(  0), UINT8_C( 32), UINT8_C(  0),
+      UINT8_C( 96), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(128), UINT8_C(  0), UINT8_C(128), UINT8_C(  0),
+      UINT8_C(192) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_n_u8_z(pv, av, b);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    ev = simde_svmul_n_u8_z(pv, av, b);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u8_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int8_t p[] =
+    {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+       INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+      -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+       INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+       INT8_C(   0) };
+  static const uint8_t a[] =
+    { UINT8_C( 65), UINT8_C(176), UINT8_C( 20), UINT8_C(118), UINT8_C(197), UINT8_C( 87), UINT8_C( 96), UINT8_C(  2),
+      UINT8_C(186), UINT8_C(137), UINT8_C(184), UINT8_C( 89), UINT8_C(222), UINT8_C( 53), UINT8_C( 72), UINT8_C(173),
+      UINT8_C(107), UINT8_C(246), UINT8_C(246), UINT8_C(147), UINT8_C( 64), UINT8_C( 84), UINT8_C(100), UINT8_C(193),
+      UINT8_C(221), UINT8_C( 59), UINT8_C(144), UINT8_C( 79), UINT8_C(143), UINT8_C( 77), UINT8_C(108), UINT8_C(208),
+      UINT8_C(253), UINT8_C(128), UINT8_C( 70), UINT8_C(194), UINT8_C(215), UINT8_C(166), UINT8_C(197), UINT8_C(146),
+      UINT8_C( 48), UINT8_C(125), UINT8_C(235), UINT8_C( 14), UINT8_C(178), UINT8_C( 51), UINT8_C(187), UINT8_C( 30),
+      UINT8_C( 41), UINT8_C(177), UINT8_C(177), UINT8_C(106), UINT8_C(  5), UINT8_C( 22), UINT8_C( 43), UINT8_C(227),
+      UINT8_C( 81), UINT8_C(187), UINT8_C( 50), UINT8_C(225), UINT8_C(  8), UINT8_C(158), UINT8_C(177), UINT8_C(  6),
+      UINT8_C( 30), UINT8_C(248), UINT8_C(200), UINT8_C(245), UINT8_C(158), UINT8_C(141), UINT8_C(135), UINT8_C(206),
+      UINT8_C( 10), UINT8_C(114), UINT8_C(220), UINT8_C(189), UINT8_C(166), UINT8_C(151), UINT8_C(219), UINT8_C(207),
+      UINT8_C( 73), UINT8_C(140), UINT8_C( 57), UINT8_C( 78), UINT8_C(162), UINT8_C(101), UINT8_C( 49), UINT8_C(244),
+      UINT8_C( 32), UINT8_C( 99), UINT8_C(213), UINT8_C( 41), UINT8_C(  1), UINT8_C(134), UINT8_C( 47), UINT8_C( 31),
+      UINT8_C(126), UINT8_C(247), UINT8_C( 21), UINT8_C( 29), UINT8_C(133), UINT8_C(156), UINT8_C(235), UINT8_C(143),
+      UINT8_C( 15), UINT8_C(200), UINT8_C( 76), UINT8_C(181), UINT8_C( 95), UINT8_C( 39), UINT8_C(132), UINT8_C(168),
+      UINT8_C(180), UINT8_C(190), UINT8_C(247), UINT8_C( 86), UINT8_C( 35), UINT8_C( 40), UINT8_C( 74), UINT8_C( 67),
+      UINT8_C(140), UINT8_C( 31), UINT8_C(108), UINT8_C(141), UINT8_C(166), UINT8_C(155), UINT8_C(173), UINT8_C( 36),
+      UINT8_C(147), UINT8_C(194), UINT8_C( 65), UINT8_C( 24), UINT8_C( 94), UINT8_C( 45), UINT8_C(167), UINT8_C(109),
+      UINT8_C(245), UINT8_C(244), UINT8_C( 34), UINT8_C( 84), UINT8_C( 27), UINT8_C(167), UINT8_C(253), UINT8_C(207),
+      UINT8_C(101), UINT8_C(244), UINT8_C( 38), UINT8_C(136), UINT8_C( 28), UINT8_C(112), UINT8_C(203), UINT8_C(168),
+      UINT8_C(144), UINT8_C( 56), UINT8_C( 54), UINT8_C( 54), UINT8_C(211), UINT8_C(227), UINT8_C( 90), UINT8_C(102),
+      UINT8_C(165), UINT8_C(156), UINT8_C(126), UINT8_C(  3), UINT8_C(201), UINT8_C( 38), UINT8_C(113), UINT8_C(190),
+      UINT8_C( 26), UINT8_C(147), UINT8_C( 18), UINT8_C( 53), UINT8_C( 58), UINT8_C( 15), UINT8_C(  5), UINT8_C(159),
+      UINT8_C(  3), UINT8_C( 43), UINT8_C( 39), UINT8_C( 32), UINT8_C(155), UINT8_C(243), UINT8_C(200), UINT8_C( 43),
+      UINT8_C( 43), UINT8_C(254), UINT8_C( 97), UINT8_C(254), UINT8_C(225), UINT8_C(188), UINT8_C(101), UINT8_C(134),
+      UINT8_C( 88), UINT8_C(227), UINT8_C(138), UINT8_C( 33), UINT8_C(  9), UINT8_C(251), UINT8_C(223), UINT8_C( 35),
+      UINT8_C(142), UINT8_C(241), UINT8_C( 89), UINT8_C(201), UINT8_C(  1), UINT8_C( 94), UINT8_C(104), UINT8_C(  4),
+      UINT8_C(137), UINT8_C(144), UINT8_C( 36), UINT8_C( 36), UINT8_C(131), UINT8_C(237), UINT8_C( 80), UINT8_C(174),
+      UINT8_C(235), UINT8_C(177), UINT8_C(172), UINT8_C(205), UINT8_C(109), UINT8_C( 17), UINT8_C( 83), UINT8_C(197),
+      UINT8_C(245), UINT8_C(221), UINT8_C(230), UINT8_C(254), UINT8_C(216), UINT8_C(197), UINT8_C( 34), UINT8_C(103),
+      UINT8_C(183), UINT8_C(123), UINT8_C( 48), UINT8_C(184), UINT8_C(217), UINT8_C(152), UINT8_C(188), UINT8_C( 98),
+      UINT8_C( 40), UINT8_C(225), UINT8_C(134), UINT8_C(171), UINT8_C(206), UINT8_C(214), UINT8_C( 89), UINT8_C(185),
+      UINT8_C(136), UINT8_C(  6), UINT8_C(134), UINT8_C(245), UINT8_C( 23), UINT8_C(218), UINT8_C(187), UINT8_C( 12),
+      UINT8_C(183), UINT8_C(161), UINT8_C( 11), UINT8_C(144), UINT8_C(103), UINT8_C( 45), UINT8_C(247), UINT8_C( 30),
+      UINT8_C(168), UINT8_C( 39), UINT8_C(214), UINT8_C(129), UINT8_C(191), UINT8_C(146), UINT8_C(227), UINT8_C(232),
+      UINT8_C(115), UINT8_C(105), UINT8_C(147), UINT8_C( 65), UINT8_C( 64), UINT8_C(237), UINT8_C(251), UINT8_C(200),
+      UINT8_C(243), UINT8_C(129), UINT8_C(189), UINT8_C( 10), UINT8_C( 91), UINT8_C(120), UINT8_C( 23), UINT8_C( 19),
+      UINT8_C( 26), UINT8_C( 34), UINT8_C(163), UINT8_C(129), UINT8_C( 79), UINT8_C(154), UINT8_C(159), UINT8_C(247),
+      UINT8_C(193), UINT8_C(117), UINT8_C(120), UINT8_C(128), UINT8_C(  7), UINT8_C( 91), UINT8_C(104), UINT8_C(123),
+      UINT8_C(196), UINT8_C(252), UINT8_C(188), UINT8_C(  4), UINT8_C(233), UINT8_C(183), UINT8_C(204), UINT8_C(220),
+      UINT8_C( 57), UINT8_C(138), UINT8_C(230), UINT8_C(148), UINT8_C(  2), UINT8_C(253), UINT8_C(167), UINT8_C( 28),
+      UINT8_C( 31), UINT8_C( 74), UINT8_C(157), UINT8_C(110), UINT8_C(228), UINT8_C( 60), UINT8_C(101), UINT8_C(165),
+      UINT8_C(177), UINT8_C(221), UINT8_C( 38), UINT8_C(185), UINT8_C( 56), UINT8_C(142), UINT8_C( 52), UINT8_C(253),
+      UINT8_C(138), UINT8_C(240), UINT8_C(  1), UINT8_C(115), UINT8_C(168), UINT8_C(206), UINT8_C( 79), UINT8_C(225),
+      UINT8_C( 88), UINT8_C( 54), UINT8_C(117), UINT8_C( 90), UINT8_C( 51), UINT8_C( 29), UINT8_C(119), UINT8_C( 83),
+      UINT8_C(103), UINT8_C( 20), UINT8_C(193), UINT8_C( 76), UINT8_C( 81), UINT8_C( 39), UINT8_C(241), UINT8_C(  2),
+      UINT8_C(  4), UINT8_C( 23), UINT8_C(187), UINT8_C( 61), UINT8_C(166), UINT8_C(239), UINT8_C( 58), UINT8_C( 48),
+      UINT8_C(224), UINT8_C( 59), UINT8_C(164), UINT8_C(136), UINT8_C(  9), UINT8_C(243), UINT8_C(105), UINT8_C( 97),
+      UINT8_C( 41), UINT8_C(222), UINT8_C(188), UINT8_C( 93), UINT8_C(251), UINT8_C( 51), UINT8_C(176), UINT8_C( 99),
+      UINT8_C( 71), UINT8_C(113), UINT8_C(175), UINT8_C(152), UINT8_C(152), UINT8_C(160), UINT8_C(155), UINT8_C(157),
+      UINT8_C(184), UINT8_C( 86), UINT8_C(218), UINT8_C( 94), UINT8_C( 70), UINT8_C( 20), UINT8_C(142), UINT8_C( 38),
+      UINT8_C( 79), UINT8_C( 50), UINT8_C(174), UINT8_C( 89), UINT8_C( 38), UINT8_C( 23), UINT8_C(186), UINT8_C( 79),
+      UINT8_C(245), UINT8_C(118), UINT8_C(172), UINT8_C(241), UINT8_C(169), UINT8_C( 92), UINT8_C( 84), UINT8_C(241),
+      UINT8_C(206), UINT8_C(  3), UINT8_C(137), UINT8_C(102), UINT8_C(163), UINT8_C( 36), UINT8_C(  3), UINT8_C( 91),
+      UINT8_C(123), UINT8_C(221), UINT8_C(185), UINT8_C(193), UINT8_C(241), UINT8_C( 72), UINT8_C(231), UINT8_C( 65),
+      UINT8_C(122), UINT8_C(149), UINT8_C(154), UINT8_C(160), UINT8_C(172), UINT8_C( 84), UINT8_C(240), UINT8_C(161),
+      UINT8_C(203), UINT8_C(156), UINT8_C(146), UINT8_C(116), UINT8_C(249), UINT8_C(230), UINT8_C(101), UINT8_C(199),
+      UINT8_C(233), UINT8_C(239), UINT8_C( 45), UINT8_C(141), UINT8_C( 19), UINT8_C( 49), UINT8_C(232), UINT8_C(142),
+      UINT8_C( 14), UINT8_C(162), UINT8_C( 79), UINT8_C(  0), UINT8_C(234), UINT8_C( 54), UINT8_C( 65), UINT8_C(100),
+      UINT8_C(203), UINT8_C(219), UINT8_C(  5), UINT8_C(119), UINT8_C( 47), UINT8_C(245), UINT8_C( 25), UINT8_C(250),
+      UINT8_C(145), UINT8_C(171), UINT8_C(111), UINT8_C(138), UINT8_C(146), UINT8_C(212), UINT8_C( 81), UINT8_C(123),
+      UINT8_C(195), UINT8_C(127), UINT8_C(  8), UINT8_C(215), UINT8_C(176), UINT8_C(241), UINT8_C(101), UINT8_C(190),
+      UINT8_C(147), UINT8_C(181), UINT8_C(190), UINT8_C(125), UINT8_C(235),    UINT8_MAX, UINT8_C(225), UINT8_C(183),
+      UINT8_C(218), UINT8_C(230), UINT8_C( 46), UINT8_C( 10), UINT8_C(219), UINT8_C( 71), UINT8_C(  4), UINT8_C(109),
+      UINT8_C(243), UINT8_C(115), UINT8_C(247), UINT8_C(133), UINT8_C( 72), UINT8_C( 73), UINT8_C(  0), UINT8_C( 11),
+      UINT8_C(200), UINT8_C(  9), UINT8_C(226), UINT8_C(120), UINT8_C(250), UINT8_C( 72), UINT8_C( 54), UINT8_C(141),
+      UINT8_C(253), UINT8_C(245), UINT8_C( 10), UINT8_C(232), UINT8_C(244), UINT8_C(235), UINT8_C(159), UINT8_C(207),
+      UINT8_C(210), UINT8_C(206), UINT8_C(217), UINT8_C(173), UINT8_C( 21), UINT8_C(221), UINT8_C( 26), UINT8_C(  8),
+      UINT8_C( 81), UINT8_C( 18), UINT8_C(141), UINT8_C(153), UINT8_C( 91), UINT8_C(142), UINT8_C(164), UINT8_C( 35),
+      UINT8_C(151), UINT8_C(135), UINT8_C(155), UINT8_C(145), UINT8_C(207), UINT8_C(209), UINT8_C( 30), UINT8_C(204),
+      UINT8_C(198), UINT8_C( 40), UINT8_C(180), UINT8_C(187), UINT8_C( 19), UINT8_C( 84), UINT8_C(138), UINT8_C(229),
+      UINT8_C( 34), UINT8_C( 99), UINT8_C(147), UINT8_C( 55), UINT8_C( 64), UINT8_C(173), UINT8_C( 64), UINT8_C(145),
+      UINT8_C(191), UINT8_C(205), UINT8_C( 42), UINT8_C( 26), UINT8_C( 91), UINT8_C(207), UINT8_C( 61), UINT8_C(242),
+      UINT8_C( 86), UINT8_C(216), UINT8_C(131), UINT8_C( 37), UINT8_C(170), UINT8_C(161), UINT8_C(241), UINT8_C(112),
+      UINT8_C(201), UINT8_C(165), UINT8_C( 43), UINT8_C(221), UINT8_C(249), UINT8_C(181), UINT8_C(194), UINT8_C( 27),
+      UINT8_C( 24), UINT8_C( 85), UINT8_C( 83), UINT8_C( 89), UINT8_C(  3), UINT8_C(147), UINT8_C(234), UINT8_C(194),
+      UINT8_C( 96), UINT8_C( 21), UINT8_C(221), UINT8_C(188), UINT8_C(228), UINT8_C( 26), UINT8_C(174), UINT8_C( 58),
+      UINT8_C(243), UINT8_C( 50), UINT8_C( 95), UINT8_C(157), UINT8_C(211), UINT8_C( 80), UINT8_C( 13), UINT8_C(157),
+      UINT8_C(245), UINT8_C( 57), UINT8_C(122), UINT8_C(239), UINT8_C(238), UINT8_C( 60), UINT8_C( 10), UINT8_C(  7),
+      UINT8_C(146), UINT8_C( 93), UINT8_C( 96), UINT8_C(149), UINT8_C(240), UINT8_C( 74), UINT8_C( 87), UINT8_C( 81),
+      UINT8_C( 95), UINT8_C( 52), UINT8_C( 13), UINT8_C( 67), UINT8_C( 79), UINT8_C(187), UINT8_C(125), UINT8_C( 66),
+      UINT8_C(237), UINT8_C(220), UINT8_C(223), UINT8_C(193), UINT8_C( 44), UINT8_C(236), UINT8_C( 94), UINT8_C( 34),
+      UINT8_C( 37), UINT8_C(216), UINT8_C( 17), UINT8_C( 20), UINT8_C( 20), UINT8_C( 27), UINT8_C( 27), UINT8_C(166),
+      UINT8_C(121), UINT8_C(123), UINT8_C( 59), UINT8_C(105), UINT8_C(197), UINT8_C(147), UINT8_C(186), UINT8_C( 37),
+      UINT8_C(199), UINT8_C(199), UINT8_C(104), UINT8_C( 22), UINT8_C(131), UINT8_C(230), UINT8_C( 88), UINT8_C(112),
+      UINT8_C(194), UINT8_C( 55), UINT8_C( 49), UINT8_C(239), UINT8_C( 36), UINT8_C(143), UINT8_C( 17), UINT8_C( 73),
+      UINT8_C(103), UINT8_C( 34), UINT8_C( 93), UINT8_C(124), UINT8_C( 61), UINT8_C(120), UINT8_C( 34), UINT8_C(182),
+      UINT8_C(243), UINT8_C( 94), UINT8_C( 32), UINT8_C(185), UINT8_C(241), UINT8_C(218), UINT8_C(222), UINT8_C(184),
+      UINT8_C(162), UINT8_C( 70), UINT8_C(207), UINT8_C( 37), UINT8_C( 44), UINT8_C( 39), UINT8_C(149), UINT8_C(239),
+      UINT8_C( 95), UINT8_C(199), UINT8_C(222), UINT8_C(131), UINT8_C( 86), UINT8_C(239), UINT8_C(204), UINT8_C(190),
+      UINT8_C( 17), UINT8_C( 42), UINT8_C( 58), UINT8_C( 78), UINT8_C(162), UINT8_C( 92), UINT8_C(  5), UINT8_C(150),
+      UINT8_C(186), UINT8_C( 37), UINT8_C( 79), UINT8_C(171),    UINT8_MAX, UINT8_C( 45), UINT8_C(100), UINT8_C(161),
+      UINT8_C(115), UINT8_C( 51), UINT8_C(198), UINT8_C(160), UINT8_C( 90), UINT8_C( 92), UINT8_C(143), UINT8_C(185),
+      UINT8_C( 35), UINT8_C(109), UINT8_C( 60), UINT8_C(121), UINT8_C( 92), UINT8_C(  9), UINT8_C( 55), UINT8_C(109),
+      UINT8_C( 51), UINT8_C(113), UINT8_C(187), UINT8_C(213), UINT8_C(206), UINT8_C(192), UINT8_C(107), UINT8_C(136),
+      UINT8_C(229), UINT8_C(186), UINT8_C( 52), UINT8_C(229), UINT8_C(231), UINT8_C(152), UINT8_C(134), UINT8_C( 91),
+      UINT8_C(203), UINT8_C( 77), UINT8_C(251), UINT8_C( 37), UINT8_C(169), UINT8_C(138), UINT8_C(223), UINT8_C(204),
+      UINT8_C(247), UINT8_C( 27), UINT8_C( 69), UINT8_C( 83), UINT8_C( 36), UINT8_C(125), UINT8_C(192), UINT8_C( 87),
+      UINT8_C(238), UINT8_C(123), UINT8_C( 45), UINT8_C(188), UINT8_C( 60), UINT8_C(152), UINT8_C( 69), UINT8_C( 33),
+      UINT8_C( 83), UINT8_C(121), UINT8_C(  6), UINT8_C( 58), UINT8_C( 17), UINT8_C(141), UINT8_C(149), UINT8_C(220),
+      UINT8_C(218), UINT8_C(144), UINT8_C(  1), UINT8_C(131), UINT8_C( 26), UINT8_C(224), UINT8_C( 79), UINT8_C( 17),
+      UINT8_C(252), UINT8_C(148), UINT8_C(100), UINT8_C( 32), UINT8_C( 17), UINT8_C( 36), UINT8_C(120), UINT8_C(  0),
+      UINT8_C(160), UINT8_C(165), UINT8_C(188), UINT8_C(220), UINT8_C( 61), UINT8_C(  1), UINT8_C(253), UINT8_C(144),
+      UINT8_C(122), UINT8_C(  4), UINT8_C(203), UINT8_C(139), UINT8_C(145), UINT8_C( 96), UINT8_C(103), UINT8_C(107),
+      UINT8_C(241), UINT8_C(105), UINT8_C(238), UINT8_C( 11), UINT8_C( 73), UINT8_C( 61), UINT8_C( 29), UINT8_C( 69),
+      UINT8_C(209), UINT8_C(129), UINT8_C(102), UINT8_C(227), UINT8_C(166), UINT8_C(222), UINT8_C(227), UINT8_C( 70),
+      UINT8_C(131), UINT8_C(159), UINT8_C( 34), UINT8_C(192), UINT8_C(161), UINT8_C( 31), UINT8_C( 81), UINT8_C( 27),
+      UINT8_C( 35), UINT8_C( 28), UINT8_C(167), UINT8_C(180), UINT8_C(124), UINT8_C( 14), UINT8_C( 31), UINT8_C(109),
+      UINT8_C(119) };
+  static const uint8_t b = UINT8_C( 72);
+  static const uint8_t e[] =
+    { UINT8_C( 65), UINT8_C(176), UINT8_C( 20), UINT8_C(118), UINT8_C(104), UINT8_C(120), UINT8_C(  0), UINT8_C(144),
+      UINT8_C(186), UINT8_C(136), UINT8_C(192), UINT8_C(  8), UINT8_C(222), UINT8_C( 53), UINT8_C( 72), UINT8_C(168),
+      UINT8_C(107), UINT8_C( 48), UINT8_C(246), UINT8_C(147), UINT8_C(  0), UINT8_C(160), UINT8_C(100), UINT8_C( 72),
+      UINT8_C( 40), UINT8_C( 59), UINT8_C(128), UINT8_C( 79), UINT8_C(143), UINT8_C( 77), UINT8_C(108), UINT8_C(128),
+      UINT8_C(253), UINT8_C(  0), UINT8_C( 70), UINT8_C(144), UINT8_C(215), UINT8_C(176), UINT8_C(104), UINT8_C( 16),
+      UINT8_C( 48), UINT8_C( 40), UINT8_C(235), UINT8_C(240), UINT8_C(178), UINT8_C( 88), UINT8_C(187), UINT8_C( 30),
+      UINT8_C( 41), UINT8_C(177), UINT8_C(177), UINT8_C(208), UINT8_C(  5), UINT8_C( 48), UINT8_C( 24), UINT8_C(227),
+      UINT8_C(200), UINT8_C(152), UINT8_C( 50), UINT8_C(225), UINT8_C( 64), UINT8_C(158), UINT8_C(200), UINT8_C(176),
+      UINT8_C(112), UINT8_C(248), UINT8_C( 64), UINT8_C(245), UINT8_C(112), UINT8_C(141), UINT8_C(248), UINT8_C(240),
+      UINT8_C( 10), UINT8_C(114), UINT8_C(220), UINT8_C(189), UINT8_C(176), UINT8_C(120), UINT8_C(152), UINT8_C( 56),
+      UINT8_C( 73), UINT8_C( 96), UINT8_C(  8), UINT8_C( 78), UINT8_C(144), UINT8_C(101), UINT8_C(200), UINT8_C(160),
+      UINT8_C(  0), UINT8_C(216), UINT8_C(232), UINT8_C(136), UINT8_C( 72), UINT8_C(176), UINT8_C( 47), UINT8_C(184),
+      UINT8_C(112), UINT8_C(120), UINT8_C(232), UINT8_C( 40), UINT8_C(133), UINT8_C(156), UINT8_C(235), UINT8_C(143),
+      UINT8_C( 15), UINT8_C( 64), UINT8_C( 96), UINT8_C(232), UINT8_C(184), UINT8_C( 39), UINT8_C( 32), UINT8_C( 64),
+      UINT8_C(180), UINT8_C(190), UINT8_C(247), UINT8_C( 48), UINT8_C(216), UINT8_C( 64), UINT8_C(208), UINT8_C(216),
+      UINT8_C(140), UINT8_C( 31), UINT8_C(108), UINT8_C(141), UINT8_C(166), UINT8_C(152), UINT8_C(173), UINT8_C( 36),
+      UINT8_C( 88), UINT8_C(144), UINT8_C( 72), UINT8_C(192), UINT8_C( 94), UINT8_C( 45), UINT8_C(167), UINT8_C(109),
+      UINT8_C(245), UINT8_C(244), UINT8_C( 34), UINT8_C(160), UINT8_C( 27), UINT8_C(167), UINT8_C(253), UINT8_C(207),
+      UINT8_C(101), UINT8_C(160), UINT8_C( 38), UINT8_C( 64), UINT8_C( 28), UINT8_C(128), UINT8_C( 24), UINT8_C( 64),
+      UINT8_C(144), UINT8_C(192), UINT8_C( 54), UINT8_C( 54), UINT8_C( 88), UINT8_C(227), UINT8_C( 80), UINT8_C(102),
+      UINT8_C(104), UINT8_C(156), UINT8_C(126), UINT8_C(216), UINT8_C(201), UINT8_C(176), UINT8_C(113), UINT8_C(112),
+      UINT8_C( 80), UINT8_C( 88), UINT8_C( 18), UINT8_C(232), UINT8_C( 80), UINT8_C( 56), UINT8_C(  5), UINT8_C(159),
+      UINT8_C(  3), UINT8_C( 24), UINT8_C( 39), UINT8_C(  0), UINT8_C(152), UINT8_C( 88), UINT8_C(200), UINT8_C( 24),
+      UINT8_C( 24), UINT8_C(254), UINT8_C( 97), UINT8_C(254), UINT8_C(225), UINT8_C(224), UINT8_C(101), UINT8_C(134),
+      UINT8_C( 88), UINT8_C(227), UINT8_C(138), UINT8_C( 72), UINT8_C(136), UINT8_C(152), UINT8_C(223), UINT8_C(216),
+      UINT8_C(240), UINT8_C(241), UINT8_C(  8), UINT8_C(136), UINT8_C( 72), UINT8_C(112), UINT8_C( 64), UINT8_C(  4),
+      UINT8_C(136), UINT8_C(128), UINT8_C( 32), UINT8_C( 36), UINT8_C(216), UINT8_C(237), UINT8_C( 80), UINT8_C(174),
+      UINT8_C( 24), UINT8_C(177), UINT8_C(172), UINT8_C(205), UINT8_C(109), UINT8_C(200), UINT8_C( 88), UINT8_C(197),
+      UINT8_C(245), UINT8_C(221), UINT8_C(176), UINT8_C(254), UINT8_C(192), UINT8_C(104), UINT8_C(144), UINT8_C(103),
+      UINT8_C(183), UINT8_C(123), UINT8_C( 48), UINT8_C(184), UINT8_C(217), UINT8_C(192), UINT8_C(188), UINT8_C(144),
+      UINT8_C( 64), UINT8_C(225), UINT8_C(134), UINT8_C(171), UINT8_C(240), UINT8_C(214), UINT8_C( 89), UINT8_C(  8),
+      UINT8_C(136), UINT8_C(176), UINT8_C(176), UINT8_C(232), UINT8_C( 23), UINT8_C( 80), UINT8_C(187), UINT8_C( 12),
+      UINT8_C(120), UINT8_C( 72), UINT8_C( 24), UINT8_C(144), UINT8_C(248), UINT8_C( 45), UINT8_C(120), UINT8_C( 30),
+      UINT8_C( 64), UINT8_C( 39), UINT8_C(214), UINT8_C( 72), UINT8_C(184), UINT8_C( 16), UINT8_C(216), UINT8_C(232),
+      UINT8_C( 88), UINT8_C(136), UINT8_C( 88), UINT8_C( 72), UINT8_C(  0), UINT8_C(168), UINT8_C(251), UINT8_C(200),
+      UINT8_C( 88), UINT8_C(129), UINT8_C( 40), UINT8_C(208), UINT8_C(152), UINT8_C(192), UINT8_C( 23), UINT8_C( 19),
+      UINT8_C( 80), UINT8_C( 34), UINT8_C(216), UINT8_C( 72), UINT8_C( 79), UINT8_C( 80), UINT8_C(184), UINT8_C(120),
+      UINT8_C( 72), UINT8_C(117), UINT8_C(192), UINT8_C(  0), UINT8_C(248), UINT8_C( 91), UINT8_C(104), UINT8_C(152),
+      UINT8_C(196), UINT8_C(224), UINT8_C(188), UINT8_C( 32), UINT8_C(136), UINT8_C(183), UINT8_C(204), UINT8_C(220),
+      UINT8_C(  8), UINT8_C(138), UINT8_C(230), UINT8_C(148), UINT8_C(144), UINT8_C( 40), UINT8_C(248), UINT8_C(224),
+      UINT8_C(184), UINT8_C(208), UINT8_C( 40), UINT8_C(240), UINT8_C(228), UINT8_C(224), UINT8_C(104), UINT8_C(165),
+      UINT8_C(200), UINT8_C( 40), UINT8_C(176), UINT8_C(  8), UINT8_C(192), UINT8_C(240), UINT8_C( 52), UINT8_C( 40),
+      UINT8_C(138), UINT8_C(240), UINT8_C( 72), UINT8_C( 88), UINT8_C( 64), UINT8_C(240), UINT8_C( 79), UINT8_C(225),
+      UINT8_C(192), UINT8_C( 54), UINT8_C(232), UINT8_C( 80), UINT8_C( 88), UINT8_C( 29), UINT8_C(120), UINT8_C( 83),
+      UINT8_C(248), UINT8_C( 20), UINT8_C(193), UINT8_C( 76), UINT8_C( 81), UINT8_C( 39), UINT8_C(241), UINT8_C(144),
+      UINT8_C( 32), UINT8_C(120), UINT8_C(187), UINT8_C( 40), UINT8_C(176), UINT8_C( 56), UINT8_C( 58), UINT8_C(128),
+      UINT8_C(  0), UINT8_C( 59), UINT8_C( 32), UINT8_C( 64), UINT8_C(136), UINT8_C( 88), UINT8_C(105), UINT8_C( 72),
+      UINT8_C(136), UINT8_C(112), UINT8_C(188), UINT8_C( 40), UINT8_C(152), UINT8_C( 51), UINT8_C(176), UINT8_C(216),
+      UINT8_C(248), UINT8_C(113), UINT8_C( 56), UINT8_C(192), UINT8_C(192), UINT8_C(160), UINT8_C(152), UINT8_C(157),
+      UINT8_C(192), UINT8_C( 48), UINT8_C( 80), UINT8_C(112), UINT8_C(176), UINT8_C( 20), UINT8_C(142), UINT8_C(176),
+      UINT8_C( 79), UINT8_C( 50), UINT8_C(174), UINT8_C( 89), UINT8_C(176), UINT8_C( 23), UINT8_C(186), UINT8_C( 56),
+      UINT8_C(245), UINT8_C(118), UINT8_C(172), UINT8_C(200), UINT8_C(136), UINT8_C( 92), UINT8_C(160), UINT8_C(241),
+      UINT8_C(240), UINT8_C(216), UINT8_C(136), UINT8_C(102), UINT8_C(216), UINT8_C( 36), UINT8_C(216), UINT8_C(152),
+      UINT8_C(123), UINT8_C( 40), UINT8_C(185), UINT8_C( 72), UINT8_C(200), UINT8_C( 64), UINT8_C(231), UINT8_C( 65),
+      UINT8_C( 80), UINT8_C(232), UINT8_C( 80), UINT8_C(  0), UINT8_C( 96), UINT8_C(160), UINT8_C(240), UINT8_C( 72),
+      UINT8_C(203), UINT8_C(224), UINT8_C( 16), UINT8_C(160), UINT8_C(  8), UINT8_C(176), UINT8_C(104), UINT8_C(248),
+      UINT8_C(233), UINT8_C( 56), UINT8_C( 45), UINT8_C(141), UINT8_C( 88), UINT8_C(200), UINT8_C( 64), UINT8_C(142),
+      UINT8_C( 14), UINT8_C(162), UINT8_C( 56), UINT8_C(  0), UINT8_C(208), UINT8_C( 54), UINT8_C( 65), UINT8_C( 32),
+      UINT8_C( 24), UINT8_C(219), UINT8_C(  5), UINT8_C(120), UINT8_C( 56), UINT8_C(232), UINT8_C(  8), UINT8_C( 80),
+      UINT8_C(145), UINT8_C(171), UINT8_C( 56), UINT8_C(138), UINT8_C(146), UINT8_C(212), UINT8_C( 81), UINT8_C(123),
+      UINT8_C(195), UINT8_C(127), UINT8_C( 64), UINT8_C(120), UINT8_C(176), UINT8_C(241), UINT8_C(101), UINT8_C(112),
+      UINT8_C( 88), UINT8_C(181), UINT8_C(112), UINT8_C( 40), UINT8_C(235),    UINT8_MAX, UINT8_C(225), UINT8_C(183),
+      UINT8_C(218), UINT8_C(176), UINT8_C(240), UINT8_C( 10), UINT8_C(219), UINT8_C( 71), UINT8_C( 32), UINT8_C(168),
+      UINT8_C( 88), UINT8_C(115), UINT8_C(120), UINT8_C(104), UINT8_C( 64), UINT8_C(136), UINT8_C(  0), UINT8_C( 24),
+      UINT8_C(200), UINT8_C(136), UINT8_C(144), UINT8_C(120), UINT8_C(250), UINT8_C( 64), UINT8_C( 48), UINT8_C(168),
+      UINT8_C( 40), UINT8_C(232), UINT8_C( 10), UINT8_C(232), UINT8_C(160), UINT8_C( 24), UINT8_C(159), UINT8_C(207),
+      UINT8_C( 16), UINT8_C(240), UINT8_C(217), UINT8_C(173), UINT8_C( 21), UINT8_C(221), UINT8_C( 80), UINT8_C( 64),
+      UINT8_C(200), UINT8_C( 16), UINT8_C(141), UINT8_C(153), UINT8_C( 91), UINT8_C(240), UINT8_C(164), UINT8_C(216),
+      UINT8_C(151), UINT8_C(248), UINT8_C(152), UINT8_C(145), UINT8_C( 56), UINT8_C(200), UINT8_C(112), UINT8_C( 96),
+      UINT8_C(198), UINT8_C( 40), UINT8_C(160), UINT8_C(187), UINT8_C( 19), UINT8_C( 84), UINT8_C(138), UINT8_C(104),
+      UINT8_C( 34), UINT8_C(216), UINT8_C( 88), UINT8_C( 55), UINT8_C( 64), UINT8_C(168), UINT8_C( 64), UINT8_C(200),
+      UINT8_C(191), UINT8_C(205), UINT8_C(208), UINT8_C( 80), UINT8_C(152), UINT8_C(207), UINT8_C( 61), UINT8_C(242),
+      UINT8_C( 86), UINT8_C(216), UINT8_C(131), UINT8_C(104), UINT8_C(208), UINT8_C(161), UINT8_C(200), UINT8_C(128),
+      UINT8_C(201), UINT8_C(104), UINT8_C( 43), UINT8_C(221), UINT8_C(  8), UINT8_C(232), UINT8_C(194), UINT8_C(152),
+      UINT8_C( 24), UINT8_C( 85), UINT8_C( 83), UINT8_C( 89), UINT8_C(  3), UINT8_C(147), UINT8_C(234), UINT8_C(194),
+      UINT8_C(  0), UINT8_C( 21), UINT8_C(221), UINT8_C(224), UINT8_C(228), UINT8_C( 80), UINT8_C(240), UINT8_C( 58),
+      UINT8_C( 88), UINT8_C( 16), UINT8_C( 95), UINT8_C( 40), UINT8_C( 88), UINT8_C(128), UINT8_C(168), UINT8_C(157),
+      UINT8_C(245), UINT8_C(  8), UINT8_C( 80), UINT8_C(239), UINT8_C(238), UINT8_C(224), UINT8_C( 10), UINT8_C(248),
+      UINT8_C(146), UINT8_C( 93), UINT8_C( 96), UINT8_C(149), UINT8_C(128), UINT8_C( 74), UINT8_C(120), UINT8_C( 81),
+      UINT8_C( 95), UINT8_C(160), UINT8_C(168), UINT8_C(216), UINT8_C( 56), UINT8_C(152), UINT8_C( 40), UINT8_C(144),
+      UINT8_C(237), UINT8_C(224), UINT8_C(184), UINT8_C(193), UINT8_C( 96), UINT8_C(236), UINT8_C(112), UINT8_C( 34),
+      UINT8_C( 37), UINT8_C(216), UINT8_C( 17), UINT8_C( 20), UINT8_C( 20), UINT8_C(152), UINT8_C( 27), UINT8_C(166),
+      UINT8_C(  8), UINT8_C(123), UINT8_C( 59), UINT8_C(105), UINT8_C(104), UINT8_C(147), UINT8_C( 80), UINT8_C(104),
+      UINT8_C(199), UINT8_C(199), UINT8_C(104), UINT8_C( 48), UINT8_C(216), UINT8_C(230), UINT8_C(192), UINT8_C(112),
+      UINT8_C(194), UINT8_C( 55), UINT8_C(200), UINT8_C( 56), UINT8_C( 36), UINT8_C(143), UINT8_C(200), UINT8_C( 73),
+      UINT8_C(103), UINT8_C( 34), UINT8_C( 40), UINT8_C(224), UINT8_C( 40), UINT8_C(192), UINT8_C(144), UINT8_C( 48),
+      UINT8_C(243), UINT8_C( 94), UINT8_C( 32), UINT8_C(  8), UINT8_C(241), UINT8_C( 80), UINT8_C(112), UINT8_C(184),
+      UINT8_C(162), UINT8_C( 70), UINT8_C( 56), UINT8_C( 37), UINT8_C( 44), UINT8_C(248), UINT8_C(149), UINT8_C(239),
+      UINT8_C(184), UINT8_C(199), UINT8_C(222), UINT8_C(131), UINT8_C( 86), UINT8_C(239), UINT8_C( 96), UINT8_C(112),
+      UINT8_C( 17), UINT8_C( 42), UINT8_C( 58), UINT8_C( 78), UINT8_C(162), UINT8_C( 92), UINT8_C(  5), UINT8_C( 48),
+      UINT8_C(186), UINT8_C( 37), UINT8_C( 79), UINT8_C(171), UINT8_C(184), UINT8_C( 45), UINT8_C( 32), UINT8_C(161),
+      UINT8_C(115), UINT8_C( 51), UINT8_C(198), UINT8_C(  0), UINT8_C( 90), UINT8_C( 92), UINT8_C(143), UINT8_C(  8),
+      UINT8_C( 35), UINT8_C(168), UINT8_C( 60), UINT8_C(  8), UINT8_C(224), UINT8_C(136), UINT8_C(120), UINT8_C(109),
+      UINT8_C( 88), UINT8_C(200), UINT8_C(152), UINT8_C(213), UINT8_C(240), UINT8_C(  0), UINT8_C( 24), UINT8_C( 64),
+      UINT8_C(104), UINT8_C(186), UINT8_C( 52), UINT8_C(104), UINT8_C(248), UINT8_C(192), UINT8_C(176), UINT8_C( 91),
+      UINT8_C(203), UINT8_C(168), UINT8_C(152), UINT8_C( 37), UINT8_C(169), UINT8_C(138), UINT8_C(223), UINT8_C( 96),
+      UINT8_C(120), UINT8_C( 27), UINT8_C(104), UINT8_C( 83), UINT8_C( 32), UINT8_C(125), UINT8_C(  0), UINT8_C(120),
+      UINT8_C(240), UINT8_C(123), UINT8_C( 45), UINT8_C(224), UINT8_C(224), UINT8_C(152), UINT8_C(104), UINT8_C( 72),
+      UINT8_C( 88), UINT8_C(  8), UINT8_C(176), UINT8_C( 58), UINT8_C(200), UINT8_C(141), UINT8_C(149), UINT8_C(220),
+      UINT8_C(218), UINT8_C(144), UINT8_C( 72), UINT8_C(216), UINT8_C( 80), UINT8_C(  0), UINT8_C( 79), UINT8_C( 17),
+      UINT8_C(252), UINT8_C(160), UINT8_C( 32), UINT8_C(  0), UINT8_C(200), UINT8_C( 32), UINT8_C(192), UINT8_C(  0),
+      UINT8_C(  0), UINT8_C(104), UINT8_C(188), UINT8_C(224), UINT8_C( 40), UINT8_C(  1), UINT8_C(253), UINT8_C(128),
+      UINT8_C(122), UINT8_C( 32), UINT8_C( 24), UINT8_C( 24), UINT8_C(145), UINT8_C( 96), UINT8_C(103), UINT8_C( 24),
+      UINT8_C(241), UINT8_C(136), UINT8_C(238), UINT8_C( 11), UINT8_C( 73), UINT8_C( 40), UINT8_C( 29), UINT8_C( 69),
+      UINT8_C(209), UINT8_C(129), UINT8_C(102), UINT8_C(227), UINT8_C(176), UINT8_C(112), UINT8_C(227), UINT8_C(176),
+      UINT8_C(216), UINT8_C(184), UINT8_C( 34), UINT8_C(  0), UINT8_C( 72), UINT8_C( 31), UINT8_C( 81), UINT8_C(152),
+      UINT8_C( 35), UINT8_C( 28), UINT8_C(248), UINT8_C(180), UINT8_C(124), UINT8_C(240), UINT8_C(184), UINT8_C(168),
+      UINT8_C(119) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t
+      rv,
+      av = simde_svld1_u8(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(INT8_C(0)));
+    rv = simde_svmul_n_u8_m(pv, av, b);
+
+    simde_svst1_u8(pg, &(r[i]), rv);
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int8_t p[1024];
+  uint8_t a[1024], b, e[1024];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u8();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b8_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b8(), pg)) {
+    simde_svuint8_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s8(pg, simde_svld1_s8(pg, &(p[i])), simde_svdup_n_s8(0));
+    av = simde_svld1_u8(pg, &(a[i]));
+
+    ev = simde_svmul_n_u8_m(pv, av, b);
+
+    simde_svst1_u8(pg, &(e[i]), ev);
+    simde_svst1_s8(pg, &(p[i]), simde_svdup_n_s8_z(pv, ~INT8_C(0)));
+
+    i += simde_svcntb();
+    pg = simde_svwhilelt_b8_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u8(1, b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u16_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0) };
+  static const uint16_t a[] =
+    { UINT16_C(55346), UINT16_C(30051), UINT16_C(51728), UINT16_C(10303), UINT16_C(25738), UINT16_C(38169), UINT16_C(58766), UINT16_C(48178),
+      UINT16_C(23473), UINT16_C(46329), UINT16_C(52976), UINT16_C(46788), UINT16_C(42852), UINT16_C(19119), UINT16_C(11438), UINT16_C(57830),
+      UINT16_C(18692), UINT16_C( 5462), UINT16_C(38419), UINT16_C(40253), UINT16_C(22522), UINT16_C(35123), UINT16_C(25916), UINT16_C(60741),
+      UINT16_C(16064), UINT16_C(45217), UINT16_C(25869), UINT16_C(29030), UINT16_C( 5644), UINT16_C(48059), UINT16_C(41282), UINT16_C(18332),
+      UINT16_C(62187), UINT16_C(65116), UINT16_C(39304), UINT16_C(33692), UINT16_C(53232), UINT16_C(11532), UINT16_C(20788), UINT16_C(62746),
+      UINT16_C(48271), UINT16_C(40101), UINT16_C( 3105), UINT16_C(11790), UINT16_C(51490), UINT16_C(25833), UINT16_C(34155), UINT16_C(22187),
+      UINT16_C( 1911), UINT16_C(   84), UINT16_C(61601), UINT16_C(37251), UINT16_C(36799), UINT16_C(62654), UINT16_C(55776), UINT16_C(28649),
+      UINT16_C(36501), UINT16_C(46604), UINT16_C( 6810), UINT16_C(48356), UINT16_C(52707), UINT16_C(20001), UINT16_C(52306), UINT16_C(51876),
+      UINT16_C(63956), UINT16_C(30154), UINT16_C(19945), UINT16_C(43270), UINT16_C(50652), UINT16_C(48285), UINT16_C(34462), UINT16_C(13099),
+      UINT16_C(14100), UINT16_C(45033), UINT16_C(52817), UINT16_C(13675), UINT16_C(35995), UINT16_C(61059), UINT16_C(10329), UINT16_C(11704),
+      UINT16_C(33313), UINT16_C( 2722), UINT16_C(43215), UINT16_C(43955), UINT16_C(20589), UINT16_C( 2919), UINT16_C(37590), UINT16_C(60222),
+      UINT16_C(10442), UINT16_C( 7066), UINT16_C( 1526), UINT16_C(37200), UINT16_C(54418), UINT16_C(60287), UINT16_C(14332), UINT16_C( 7448),
+      UINT16_C(47801), UINT16_C(34855), UINT16_C(56162), UINT16_C(53299), UINT16_C(39467), UINT16_C(  731), UINT16_C( 6701), UINT16_C(63469),
+      UINT16_C(34626), UINT16_C(14354), UINT16_C(25484), UINT16_C( 7881), UINT16_C(18743), UINT16_C(13065), UINT16_C( 8576), UINT16_C(14928),
+      UINT16_C(30683), UINT16_C(16066), UINT16_C(63058), UINT16_C(32270), UINT16_C(59792), UINT16_C(48512), UINT16_C(27907), UINT16_C(17844),
+      UINT16_C(51188), UINT16_C(32893), UINT16_C(18218), UINT16_C(24991), UINT16_C(43152), UINT16_C( 4244), UINT16_C(58570), UINT16_C(42314),
+      UINT16_C( 3419), UINT16_C(44771), UINT16_C(61699), UINT16_C(37676), UINT16_C(44251), UINT16_C(56913), UINT16_C( 1305), UINT16_C( 3364),
+      UINT16_C(41420), UINT16_C(63117), UINT16_C(11496), UINT16_C(30807), UINT16_C(60373), UINT16_C(40841), UINT16_C(54223), UINT16_C(11076),
+      UINT16_C(10464), UINT16_C(58329), UINT16_C( 1305), UINT16_C(62583), UINT16_C(51377), UINT16_C(51923), UINT16_C(63437), UINT16_C(39639),
+      UINT16_C(25752), UINT16_C(33168), UINT16_C(59537), UINT16_C(26361), UINT16_C(33491), UINT16_C(41733), UINT16_C(18774), UINT16_C(14030),
+      UINT16_C(42865), UINT16_C(35610), UINT16_C(37292), UINT16_C(23935), UINT16_C(21081), UINT16_C( 9767), UINT16_C(65097), UINT16_C(58048),
+      UINT16_C(20834), UINT16_C(62307), UINT16_C(23609), UINT16_C( 3161), UINT16_C(24287), UINT16_C(13743), UINT16_C(32168), UINT16_C( 6507),
+      UINT16_C(34084), UINT16_C(53412), UINT16_C( 9238), UINT16_C(28461), UINT16_C(21622), UINT16_C(49302), UINT16_C(22098), UINT16_C(46498),
+      UINT16_C( 1447), UINT16_C(57512), UINT16_C(  609), UINT16_C(16621), UINT16_C(40032), UINT16_C( 2165), UINT16_C(57626), UINT16_C(15906),
+      UINT16_C(50790), UINT16_C(32015), UINT16_C(15594), UINT16_C(25068), UINT16_C(33425), UINT16_C(58145), UINT16_C(50137), UINT16_C(32920),
+      UINT16_C(16840), UINT16_C(10593), UINT16_C(20035), UINT16_C(41834), UINT16_C(57322), UINT16_C( 1196), UINT16_C(52928), UINT16_C(10051),
+      UINT16_C(21140), UINT16_C(32676), UINT16_C(37006), UINT16_C( 8160), UINT16_C(  275), UINT16_C(60419), UINT16_C(39876), UINT16_C(35948),
+      UINT16_C(52700), UINT16_C( 8117), UINT16_C( 7963), UINT16_C( 1731), UINT16_C(28671), UINT16_C(48906), UINT16_C(19773), UINT16_C(53734),
+      UINT16_C(35487), UINT16_C(11856), UINT16_C(12315), UINT16_C(11853), UINT16_C(20529), UINT16_C(62746), UINT16_C(34540), UINT16_C(51329),
+      UINT16_C(14164), UINT16_C(28648), UINT16_C(43862), UINT16_C(21877), UINT16_C(32794), UINT16_C(22293), UINT16_C(64461), UINT16_C(27944),
+      UINT16_C(31110), UINT16_C(41371), UINT16_C(59561), UINT16_C(56271), UINT16_C(59705), UINT16_C( 9680), UINT16_C(21103), UINT16_C(50157),
+      UINT16_C(54665), UINT16_C(57139), UINT16_C(43136), UINT16_C(39477), UINT16_C(18984), UINT16_C(63217), UINT16_C( 6725), UINT16_C(52067),
+      UINT16_C(65171), UINT16_C(15468), UINT16_C(15334), UINT16_C( 7959), UINT16_C(59428), UINT16_C(37956), UINT16_C(12858), UINT16_C(50007),
+      UINT16_C(35335), UINT16_C(34978), UINT16_C(55091), UINT16_C(23330), UINT16_C( 5153), UINT16_C(26449), UINT16_C(46126), UINT16_C(49458),
+      UINT16_C(40882), UINT16_C(39421), UINT16_C( 5594), UINT16_C(65464), UINT16_C(65021), UINT16_C(14227), UINT16_C(59951), UINT16_C(14074),
+      UINT16_C(40053), UINT16_C(43198), UINT16_C(57716), UINT16_C(38147), UINT16_C(22005), UINT16_C( 9212), UINT16_C(12041), UINT16_C(48356),
+      UINT16_C(57806), UINT16_C(43093), UINT16_C( 3574), UINT16_C(62375), UINT16_C(14858), UINT16_C(14634), UINT16_C( 9253), UINT16_C(39536),
+      UINT16_C(11969), UINT16_C(13634), UINT16_C(17679), UINT16_C( 1226), UINT16_C(51098), UINT16_C(42023), UINT16_C( 3062), UINT16_C(50272),
+      UINT16_C(46573), UINT16_C(58220), UINT16_C( 5314), UINT16_C(52695), UINT16_C(  334), UINT16_C(29446), UINT16_C(30246), UINT16_C(59149),
+      UINT16_C(20389), UINT16_C(46108), UINT16_C(59029), UINT16_C(12217), UINT16_C(57517), UINT16_C(41939), UINT16_C(13292), UINT16_C(55655),
+      UINT16_C(54504), UINT16_C(43964), UINT16_C(37864), UINT16_C(13944), UINT16_C(32405), UINT16_C(48042), UINT16_C(47093), UINT16_C(39586),
+      UINT16_C(48647), UINT16_C(40014), UINT16_C( 1956), UINT16_C(21195), UINT16_C(40936), UINT16_C(54517), UINT16_C(24018), UINT16_C(48045),
+      UINT16_C(26929), UINT16_C( 6502) };
+  static const uint16_t b = UINT16_C(50721);
+  static const uint16_t e[] =
+    { UINT16_C(35442), UINT16_C(    0), UINT16_C(27664), UINT16_C(59935), UINT16_C(    0), UINT16_C(36409), UINT16_C(27470), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(59929), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(33156), UINT16_C(17430), UINT16_C(    0), UINT16_C(29405), UINT16_C(45882), UINT16_C(    0), UINT16_C(    0), UINT16_C(62437),
+      UINT16_C(38592), UINT16_C(19137), UINT16_C( 5293), UINT16_C(    0), UINT16_C( 8076), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(40732), UINT16_C(    0), UINT16_C( 5772), UINT16_C(44980), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(53061), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(14345), UINT16_C(62667), UINT16_C(28171),
+      UINT16_C(   87), UINT16_C(    0), UINT16_C(35521), UINT16_C( 5091), UINT16_C(    0), UINT16_C(    0), UINT16_C(21984), UINT16_C(41737),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 7235), UINT16_C(38977), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(16649), UINT16_C(28102), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(37268), UINT16_C(58121), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(19521), UINT16_C(    0), UINT16_C(56495), UINT16_C(37907), UINT16_C(44045), UINT16_C( 8775), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(32266), UINT16_C(43738), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(38239), UINT16_C( 8060), UINT16_C(20504),
+      UINT16_C(10201), UINT16_C(46855), UINT16_C( 5026), UINT16_C(18579), UINT16_C( 8587), UINT16_C(49211), UINT16_C(11725), UINT16_C(17293),
+      UINT16_C(31618), UINT16_C( 9810), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(20864), UINT16_C(    0),
+      UINT16_C(54587), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(31632), UINT16_C(28032), UINT16_C(    0), UINT16_C(13364),
+      UINT16_C(32372), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 6800), UINT16_C(    0), UINT16_C(    0), UINT16_C(35466),
+      UINT16_C(    0), UINT16_C( 7491), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(41804), UINT16_C(    0), UINT16_C(14824), UINT16_C(    0), UINT16_C(    0), UINT16_C(34473), UINT16_C(    0), UINT16_C(11204),
+      UINT16_C(    0), UINT16_C(13561), UINT16_C(    0), UINT16_C(    0), UINT16_C(50385), UINT16_C(22323), UINT16_C(32621), UINT16_C(16311),
+      UINT16_C(34712), UINT16_C( 5008), UINT16_C(    0), UINT16_C(56345), UINT16_C( 3891), UINT16_C(57765), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(64401), UINT16_C( 2650), UINT16_C(    0), UINT16_C(    0), UINT16_C(29561), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(28025), UINT16_C(    0), UINT16_C(    0), UINT16_C( 8872), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 8909), UINT16_C(    0), UINT16_C(    0), UINT16_C(35986), UINT16_C(46562),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(44173), UINT16_C(26720), UINT16_C(    0), UINT16_C(    0), UINT16_C(20066),
+      UINT16_C(30502), UINT16_C(    0), UINT16_C(54826), UINT16_C(10092), UINT16_C(    0), UINT16_C(52545), UINT16_C( 5369), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(59555), UINT16_C(    0), UINT16_C(    0), UINT16_C(41516), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C( 7444), UINT16_C(19492), UINT16_C(    0), UINT16_C(23520), UINT16_C(54643), UINT16_C(48739), UINT16_C(44100), UINT16_C(41452),
+      UINT16_C(    0), UINT16_C( 5205), UINT16_C(58491), UINT16_C(45347), UINT16_C(43487), UINT16_C(23626), UINT16_C(    0), UINT16_C(62118),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C( 5499), UINT16_C(    0), UINT16_C(15441), UINT16_C(    0), UINT16_C(60524), UINT16_C(40609),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(40794), UINT16_C(30645), UINT16_C(  877), UINT16_C(  552),
+      UINT16_C(20038), UINT16_C(46843), UINT16_C(46025), UINT16_C(    0), UINT16_C( 9817), UINT16_C(    0), UINT16_C(    0), UINT16_C(36749),
+      UINT16_C(31913), UINT16_C(    0), UINT16_C(47232), UINT16_C(    0), UINT16_C(32552), UINT16_C(15121), UINT16_C(    0), UINT16_C(51651),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(52215), UINT16_C(    0), UINT16_C(46276), UINT16_C(    0), UINT16_C(30775),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 7745), UINT16_C(    0), UINT16_C(52718), UINT16_C(37746),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(27930), UINT16_C(    0), UINT16_C(    0), UINT16_C(56307), UINT16_C(35343), UINT16_C(29242),
+      UINT16_C(    0), UINT16_C(46206), UINT16_C(51188), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(28917), UINT16_C( 4278), UINT16_C(    0), UINT16_C(    0), UINT16_C(55914), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(19681), UINT16_C(59778), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(21255), UINT16_C(    0), UINT16_C(36960),
+      UINT16_C(49549), UINT16_C(    0), UINT16_C(47362), UINT16_C(53943), UINT16_C(    0), UINT16_C(30662), UINT16_C(    0), UINT16_C(54957),
+      UINT16_C(57925), UINT16_C(    0), UINT16_C(    0), UINT16_C(15577), UINT16_C(    0), UINT16_C(20531), UINT16_C(14700), UINT16_C(45127),
+      UINT16_C(    0), UINT16_C(    0), UINT16_C(33000), UINT16_C(    0), UINT16_C(36661), UINT16_C(44266), UINT16_C(    0), UINT16_C(    0),
+      UINT16_C(59623), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C( 3304), UINT16_C(    0), UINT16_C(33810), UINT16_C(    0),
+      UINT16_C(    0), UINT16_C(    0) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_n_u16_z(pv, av, b);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    ev = simde_svmul_n_u16_z(pv, av, b);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u16_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+      -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+       INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),
+      -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1) };
+  static const uint16_t a[] =
+    { UINT16_C(52418), UINT16_C( 1478), UINT16_C( 6232), UINT16_C(51020), UINT16_C( 9647), UINT16_C(21274), UINT16_C(36161), UINT16_C( 3029),
+      UINT16_C( 1836), UINT16_C(34282), UINT16_C(14803), UINT16_C(27038), UINT16_C(33208), UINT16_C(49155), UINT16_C(16329), UINT16_C(35759),
+      UINT16_C(30220), UINT16_C(25744), UINT16_C(56462), UINT16_C(15659), UINT16_C(17666), UINT16_C(17296), UINT16_C(26066), UINT16_C(65102),
+      UINT16_C(14444), UINT16_C(16516), UINT16_C( 8817), UINT16_C(10921), UINT16_C(44195), UINT16_C(27882), UINT16_C(39404), UINT16_C(63735),
+      UINT16_C(34575), UINT16_C(40284), UINT16_C(34659), UINT16_C(26074), UINT16_C(27340), UINT16_C(40873), UINT16_C(63440), UINT16_C(15517),
+      UINT16_C( 8496), UINT16_C(41340), UINT16_C( 9795), UINT16_C(59083), UINT16_C(46546), UINT16_C(48722), UINT16_C(18767), UINT16_C(24246),
+      UINT16_C( 4816), UINT16_C(13564), UINT16_C(54937), UINT16_C(26265), UINT16_C(16961), UINT16_C( 4357), UINT16_C(41530), UINT16_C(27213),
+      UINT16_C(51908), UINT16_C( 1803), UINT16_C(55280), UINT16_C(49902), UINT16_C(16524), UINT16_C(56193), UINT16_C(14218), UINT16_C(23098),
+      UINT16_C(13898), UINT16_C(58254), UINT16_C(10252), UINT16_C(19785), UINT16_C(20074), UINT16_C(42078), UINT16_C(44273), UINT16_C(46350),
+      UINT16_C( 6774), UINT16_C(26300), UINT16_C(43761), UINT16_C(32040), UINT16_C(43499), UINT16_C(30041), UINT16_C(37857), UINT16_C(11215),
+      UINT16_C(24265), UINT16_C(54542), UINT16_C(22662), UINT16_C(61475), UINT16_C(33190), UINT16_C(38805), UINT16_C(41773), UINT16_C(41804),
+      UINT16_C( 2493), UINT16_C(44553), UINT16_C(12979), UINT16_C(40492), UINT16_C(34267), UINT16_C(48147), UINT16_C(58136), UINT16_C(57831),
+      UINT16_C(63041), UINT16_C(51126), UINT16_C(55630), UINT16_C(62647), UINT16_C(19547), UINT16_C(34956), UINT16_C(55536), UINT16_C(44332),
+      UINT16_C(13793), UINT16_C(38236), UINT16_C(34919), UINT16_C(17203), UINT16_C(18189), UINT16_C( 9727), UINT16_C(59178), UINT16_C(27398),
+      UINT16_C(48349), UINT16_C(11058), UINT16_C(59798), UINT16_C(61727), UINT16_C(43830), UINT16_C( 9849), UINT16_C(42372), UINT16_C(26067),
+      UINT16_C(12251), UINT16_C(17146), UINT16_C(11959), UINT16_C(50309), UINT16_C(34165), UINT16_C(40937), UINT16_C(61292), UINT16_C(18698),
+      UINT16_C(15532), UINT16_C(17012), UINT16_C(37669), UINT16_C(23347), UINT16_C(44095), UINT16_C(50049), UINT16_C(21842), UINT16_C(11560),
+      UINT16_C( 9092), UINT16_C(15471), UINT16_C(62801), UINT16_C(50688), UINT16_C(60026), UINT16_C(58981), UINT16_C(28633), UINT16_C(34095),
+      UINT16_C(41899), UINT16_C(53447), UINT16_C(64054), UINT16_C(29996), UINT16_C(44455), UINT16_C(63800), UINT16_C(24834), UINT16_C(34598),
+      UINT16_C(38276), UINT16_C(54723), UINT16_C(50058), UINT16_C( 1179), UINT16_C(  173), UINT16_C(34794), UINT16_C( 6511), UINT16_C( 6668),
+      UINT16_C(54460), UINT16_C(62442), UINT16_C( 5838), UINT16_C(30056), UINT16_C(41412), UINT16_C(50798), UINT16_C(37890), UINT16_C(34381),
+      UINT16_C( 4138), UINT16_C(46171), UINT16_C(63188), UINT16_C(33209), UINT16_C(41974), UINT16_C(25864), UINT16_C( 5565), UINT16_C(31103),
+      UINT16_C(27113), UINT16_C(46956), UINT16_C(54656), UINT16_C(17453), UINT16_C(39798), UINT16_C(30730), UINT16_C(22576), UINT16_C(23294),
+      UINT16_C(22888), UINT16_C(15374), UINT16_C(51023), UINT16_C(17854), UINT16_C(50795), UINT16_C(10410), UINT16_C(10715), UINT16_C(50337),
+      UINT16_C( 3730), UINT16_C( 4732), UINT16_C(43491), UINT16_C(22870), UINT16_C(24900), UINT16_C(29905), UINT16_C(53177), UINT16_C( 8654),
+      UINT16_C(56616), UINT16_C(30558), UINT16_C( 7332), UINT16_C( 4028), UINT16_C(26338), UINT16_C(48695), UINT16_C(55695), UINT16_C( 8578),
+      UINT16_C(65255), UINT16_C(51764), UINT16_C(35495), UINT16_C(60451), UINT16_C(62699), UINT16_C(42080), UINT16_C(12227), UINT16_C(60358),
+      UINT16_C( 9228), UINT16_C(45154), UINT16_C( 7744), UINT16_C( 8896), UINT16_C(63364), UINT16_C( 5088), UINT16_C(25552), UINT16_C(46900),
+      UINT16_C(26721), UINT16_C( 2433), UINT16_C(42227), UINT16_C(57077), UINT16_C(21912), UINT16_C(23427), UINT16_C(18820), UINT16_C(36934),
+      UINT16_C(43117), UINT16_C(44353), UINT16_C(  454), UINT16_C(19151), UINT16_C(45304), UINT16_C(51549), UINT16_C(37395), UINT16_C(29824),
+      UINT16_C(  762), UINT16_C(60797), UINT16_C(29350), UINT16_C(16332), UINT16_C(20424), UINT16_C(19610), UINT16_C(57752), UINT16_C( 1501),
+      UINT16_C( 7817), UINT16_C(20658), UINT16_C(33055), UINT16_C( 6042), UINT16_C(63537), UINT16_C(17632), UINT16_C(24970), UINT16_C(33977),
+      UINT16_C(13923), UINT16_C( 2418), UINT16_C(16041), UINT16_C(29000), UINT16_C(58253), UINT16_C( 9661), UINT16_C(39620), UINT16_C(19754),
+      UINT16_C(56504), UINT16_C(55197), UINT16_C(14429), UINT16_C(36847), UINT16_C(53040), UINT16_C(47827), UINT16_C(35888), UINT16_C(37694),
+      UINT16_C(45251), UINT16_C(27805), UINT16_C(58862), UINT16_C(31709), UINT16_C(39624), UINT16_C(36000), UINT16_C(51765), UINT16_C(60890),
+      UINT16_C(30630), UINT16_C( 1221), UINT16_C(46255), UINT16_C(57235), UINT16_C(26243), UINT16_C(46233), UINT16_C(55539), UINT16_C(46663),
+      UINT16_C(58504), UINT16_C(30498), UINT16_C(65482), UINT16_C(37618), UINT16_C(37785), UINT16_C(52767), UINT16_C(63837), UINT16_C( 1212),
+      UINT16_C(33136), UINT16_C( 8200), UINT16_C(39733), UINT16_C(47359), UINT16_C(39169), UINT16_C(62572), UINT16_C(46193), UINT16_C(63914),
+      UINT16_C(52376), UINT16_C(25200), UINT16_C(25547), UINT16_C(26101), UINT16_C( 5366), UINT16_C(21299), UINT16_C(61197), UINT16_C(32087),
+      UINT16_C(24432), UINT16_C(42397), UINT16_C(40442), UINT16_C(64606), UINT16_C(51766), UINT16_C(42992), UINT16_C(39806), UINT16_C( 6048),
+      UINT16_C( 4455), UINT16_C(13177), UINT16_C(28276), UINT16_C(27288), UINT16_C(52098), UINT16_C(36797), UINT16_C( 5563), UINT16_C(11021),
+      UINT16_C(43636), UINT16_C(28625), UINT16_C(12103), UINT16_C(32107), UINT16_C(23545), UINT16_C(30756), UINT16_C(50678), UINT16_C(24207),
+      UINT16_C( 2262), UINT16_C(19089), UINT16_C(10615), UINT16_C(63924), UINT16_C(29172), UINT16_C(44937), UINT16_C(38534), UINT16_C(64475),
+      UINT16_C(44096), UINT16_C(34922), UINT16_C(54747), UINT16_C(54277), UINT16_C(10800), UINT16_C(10060), UINT16_C(56303), UINT16_C(50565),
+      UINT16_C( 5860), UINT16_C(23311), UINT16_C(49983), UINT16_C(13140), UINT16_C(56628), UINT16_C(48099), UINT16_C(48755), UINT16_C(46262),
+      UINT16_C( 8298), UINT16_C(17724), UINT16_C(16885), UINT16_C( 9497), UINT16_C(26219), UINT16_C(23116), UINT16_C(53569), UINT16_C( 9503) };
+  static const uint16_t b = UINT16_C( 2189);
+  static const uint16_t e[] =
+    { UINT16_C(55002), UINT16_C(24078), UINT16_C(10360), UINT16_C( 9436), UINT16_C(14691), UINT16_C(21274), UINT16_C(54477), UINT16_C( 3029),
+      UINT16_C( 1836), UINT16_C( 4578), UINT16_C(14803), UINT16_C(27038), UINT16_C(33208), UINT16_C(55719), UINT16_C(16329), UINT16_C(35759),
+      UINT16_C(30220), UINT16_C(58192), UINT16_C(59958), UINT16_C( 2223), UINT16_C(17666), UINT16_C(46672), UINT16_C(42154), UINT16_C(65102),
+      UINT16_C(14444), UINT16_C(16516), UINT16_C( 8817), UINT16_C(50965), UINT16_C(44195), UINT16_C(19682), UINT16_C(39404), UINT16_C(63735),
+      UINT16_C(56131), UINT16_C(35756), UINT16_C(43399), UINT16_C(59666), UINT16_C(12892), UINT16_C(14357), UINT16_C(64912), UINT16_C(19065),
+      UINT16_C(51056), UINT16_C(41340), UINT16_C( 9795), UINT16_C(59083), UINT16_C(46250), UINT16_C(48722), UINT16_C(18767), UINT16_C(24246),
+      UINT16_C( 4816), UINT16_C(13564), UINT16_C(64069), UINT16_C(19013), UINT16_C(16961), UINT16_C(34753), UINT16_C(10738), UINT16_C(27213),
+      UINT16_C(52724), UINT16_C( 1803), UINT16_C(55280), UINT16_C(52502), UINT16_C(16524), UINT16_C(56193), UINT16_C(14218), UINT16_C(33266),
+      UINT16_C(13898), UINT16_C(58254), UINT16_C(10252), UINT16_C(55605), UINT16_C(32866), UINT16_C(30662), UINT16_C(51389), UINT16_C(10422),
+      UINT16_C(17150), UINT16_C(30092), UINT16_C(44733), UINT16_C(12040), UINT16_C(61039), UINT16_C(30041), UINT16_C(37857), UINT16_C(11215),
+      UINT16_C(24265), UINT16_C(54542), UINT16_C(22662), UINT16_C(61475), UINT16_C(33190), UINT16_C( 9489), UINT16_C(41773), UINT16_C(20700),
+      UINT16_C(17689), UINT16_C( 8949), UINT16_C(12979), UINT16_C(40492), UINT16_C(34267), UINT16_C(48147), UINT16_C(54328), UINT16_C(57831),
+      UINT16_C(43469), UINT16_C(44862), UINT16_C(55630), UINT16_C(62647), UINT16_C(58911), UINT16_C(34956), UINT16_C(64560), UINT16_C(44332),
+      UINT16_C(13793), UINT16_C(38236), UINT16_C(34919), UINT16_C(39703), UINT16_C(35369), UINT16_C( 9727), UINT16_C(59178), UINT16_C( 8782),
+      UINT16_C(60857), UINT16_C(23178), UINT16_C(59798), UINT16_C(61727), UINT16_C(43830), UINT16_C(63653), UINT16_C(42372), UINT16_C(44343),
+      UINT16_C(12251), UINT16_C(46002), UINT16_C(11959), UINT16_C(50309), UINT16_C(10609), UINT16_C(23381), UINT16_C(15996), UINT16_C(18698),
+      UINT16_C(51900), UINT16_C(14820), UINT16_C(37669), UINT16_C(23347), UINT16_C(54963), UINT16_C(46605), UINT16_C(21842), UINT16_C(11560),
+      UINT16_C( 9092), UINT16_C(49443), UINT16_C(42397), UINT16_C(50688), UINT16_C(60026), UINT16_C(58981), UINT16_C(25221), UINT16_C(34095),
+      UINT16_C(41899), UINT16_C(13723), UINT16_C(32702), UINT16_C(29996), UINT16_C(44455), UINT16_C(63800), UINT16_C(32282), UINT16_C(34598),
+      UINT16_C(31156), UINT16_C(54723), UINT16_C(50058), UINT16_C(24927), UINT16_C(51017), UINT16_C(11234), UINT16_C( 6511), UINT16_C(47260),
+      UINT16_C( 2956), UINT16_C(62442), UINT16_C(65398), UINT16_C(30056), UINT16_C(14580), UINT16_C(47766), UINT16_C(38170), UINT16_C(34381),
+      UINT16_C(14114), UINT16_C(46171), UINT16_C(37572), UINT16_C(33209), UINT16_C(65150), UINT16_C(58728), UINT16_C( 5565), UINT16_C(58099),
+      UINT16_C(27113), UINT16_C(46956), UINT16_C(54656), UINT16_C(62665), UINT16_C(20478), UINT16_C(30730), UINT16_C(22576), UINT16_C(23294),
+      UINT16_C(22888), UINT16_C(15374), UINT16_C(16003), UINT16_C(22950), UINT16_C(50795), UINT16_C(46498), UINT16_C(58783), UINT16_C(50337),
+      UINT16_C( 3730), UINT16_C( 3660), UINT16_C(43491), UINT16_C(58462), UINT16_C(24900), UINT16_C(29905), UINT16_C(12517), UINT16_C( 3702),
+      UINT16_C(56616), UINT16_C(44742), UINT16_C( 7332), UINT16_C(35468), UINT16_C(47738), UINT16_C(48695), UINT16_C(19395), UINT16_C(33946),
+      UINT16_C(65255), UINT16_C(51764), UINT16_C(35495), UINT16_C(60451), UINT16_C(62699), UINT16_C(35040), UINT16_C(26215), UINT16_C(60358),
+      UINT16_C(15004), UINT16_C(13818), UINT16_C(43328), UINT16_C( 9152), UINT16_C(29620), UINT16_C( 5088), UINT16_C(31120), UINT16_C(34724),
+      UINT16_C(26721), UINT16_C( 2433), UINT16_C(29143), UINT16_C(29937), UINT16_C(58552), UINT16_C(32551), UINT16_C(18820), UINT16_C(42638),
+      UINT16_C(43117), UINT16_C(29901), UINT16_C(10766), UINT16_C(44035), UINT16_C(14488), UINT16_C(53305), UINT16_C( 3191), UINT16_C(10880),
+      UINT16_C(  762), UINT16_C(46553), UINT16_C(21870), UINT16_C(33628), UINT16_C(20424), UINT16_C(19610), UINT16_C(  184), UINT16_C( 1501),
+      UINT16_C( 7817), UINT16_C(20658), UINT16_C(33055), UINT16_C( 6042), UINT16_C(15101), UINT16_C(61280), UINT16_C( 2306), UINT16_C(57829),
+      UINT16_C( 3207), UINT16_C(50122), UINT16_C(16041), UINT16_C(29000), UINT16_C(58253), UINT16_C(45337), UINT16_C(39620), UINT16_C(19754),
+      UINT16_C(56504), UINT16_C(55197), UINT16_C(14429), UINT16_C(48803), UINT16_C(53040), UINT16_C(47827), UINT16_C(46704), UINT16_C( 2342),
+      UINT16_C(29543), UINT16_C(27805), UINT16_C(58862), UINT16_C(31709), UINT16_C(39624), UINT16_C(36000), UINT16_C(51765), UINT16_C(53522),
+      UINT16_C(30630), UINT16_C(51329), UINT16_C(46255), UINT16_C(57235), UINT16_C(26243), UINT16_C(46233), UINT16_C( 5591), UINT16_C(46663),
+      UINT16_C(58504), UINT16_C(30498), UINT16_C(12866), UINT16_C(37618), UINT16_C(37785), UINT16_C(52767), UINT16_C(63837), UINT16_C( 1212),
+      UINT16_C(51888), UINT16_C( 8200), UINT16_C(39733), UINT16_C(47359), UINT16_C(19853), UINT16_C(65404), UINT16_C(46193), UINT16_C(63914),
+      UINT16_C(52376), UINT16_C(47024), UINT16_C(20175), UINT16_C(53233), UINT16_C( 5366), UINT16_C(21299), UINT16_C(61197), UINT16_C(32087),
+      UINT16_C(24432), UINT16_C(42397), UINT16_C(40442), UINT16_C(64606), UINT16_C( 4030), UINT16_C(65328), UINT16_C(39806), UINT16_C(  800),
+      UINT16_C( 4455), UINT16_C(13177), UINT16_C(30180), UINT16_C(27288), UINT16_C( 9882), UINT16_C(36797), UINT16_C(53247), UINT16_C(11021),
+      UINT16_C(43636), UINT16_C(28625), UINT16_C(16923), UINT16_C(27631), UINT16_C(28709), UINT16_C(30756), UINT16_C(50678), UINT16_C(24207),
+      UINT16_C( 2262), UINT16_C(19089), UINT16_C(10615), UINT16_C(10276), UINT16_C(29172), UINT16_C(44937), UINT16_C( 6094), UINT16_C(36767),
+      UINT16_C(44096), UINT16_C(29282), UINT16_C(54747), UINT16_C(54277), UINT16_C(48240), UINT16_C( 1244), UINT16_C(39587), UINT16_C(62017),
+      UINT16_C( 5860), UINT16_C(23311), UINT16_C(49983), UINT16_C(13140), UINT16_C(56628), UINT16_C(37895), UINT16_C(48755), UINT16_C(14398),
+      UINT16_C(10850), UINT16_C(  524), UINT16_C(64497), UINT16_C(14021), UINT16_C(26219), UINT16_C( 7132), UINT16_C(53569), UINT16_C(27155) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t
+      rv,
+      av = simde_svld1_u16(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+    rv = simde_svmul_n_u16_m(pv, av, b);
+
+    simde_svst1_u16(pg, &(r[i]), rv);
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  uint16_t a[1024 / sizeof(int16_t)], b, e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u16();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svuint16_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(0));
+    av = simde_svld1_u16(pg, &(a[i]));
+
+    ev = simde_svmul_n_u16_m(pv, av, b);
+
+    simde_svst1_u16(pg, &(e[i]), ev);
+    simde_svst1_s16(pg, &(p[i]), simde_svdup_n_s16_z(pv, ~INT16_C(0)));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u16(1, b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const uint32_t a[] =
+    { UINT32_C(1839109762), UINT32_C(2404279275), UINT32_C(4188790868), UINT32_C(1287112993), UINT32_C(3074821566), UINT32_C(2841369580), UINT32_C( 540590531), UINT32_C(3462480972),
+      UINT32_C(3309043674), UINT32_C(3075836258), UINT32_C(2343567465), UINT32_C(2279041225), UINT32_C(1648237941), UINT32_C(3154877176), UINT32_C(2816230491), UINT32_C(1668627848),
+      UINT32_C(2670243900), UINT32_C(2723577145), UINT32_C(1177355901), UINT32_C(3838706798), UINT32_C( 440798242), UINT32_C(  30822822), UINT32_C( 514372245), UINT32_C( 746659311),
+      UINT32_C( 114010573), UINT32_C(2762547495), UINT32_C(2532038183), UINT32_C(4252678619), UINT32_C(1813496005), UINT32_C(2808999441), UINT32_C(2428835488), UINT32_C(  29115955),
+      UINT32_C( 369592303), UINT32_C(3485184168), UINT32_C(1650828935), UINT32_C( 610262879), UINT32_C(2979034783), UINT32_C(  89718372), UINT32_C(1200954644), UINT32_C(1380471139),
+      UINT32_C(2154385624), UINT32_C(2270110720), UINT32_C( 703182282), UINT32_C( 877480084), UINT32_C( 602267327), UINT32_C(4029169116), UINT32_C(3174546778), UINT32_C(3859775502),
+      UINT32_C(3496376528), UINT32_C(1717089948), UINT32_C(4287578475), UINT32_C(1228135818), UINT32_C(2540443835), UINT32_C(2944898389), UINT32_C(1634516562), UINT32_C( 239565886),
+      UINT32_C(2447355636), UINT32_C(3489085284), UINT32_C(  47089528), UINT32_C( 525009508), UINT32_C(1891022874), UINT32_C(2669624653), UINT32_C( 973114619), UINT32_C(4232595464),
+      UINT32_C(1519200246), UINT32_C(3609822558), UINT32_C(1893332748), UINT32_C( 344925689), UINT32_C( 713311709), UINT32_C(2110366594), UINT32_C( 934791727), UINT32_C( 137625618),
+      UINT32_C(2254618919), UINT32_C(1381862214), UINT32_C(2093102722), UINT32_C( 948982107), UINT32_C( 409080982), UINT32_C(3885378743), UINT32_C( 136203766), UINT32_C(1964003917),
+      UINT32_C(1526428180), UINT32_C(2142066941), UINT32_C(3942346638), UINT32_C(1461881793), UINT32_C(1466992031), UINT32_C(2805860017), UINT32_C(2712624211), UINT32_C(3273047983),
+      UINT32_C( 773656881), UINT32_C(4155361897), UINT32_C(4225870138), UINT32_C(3562144820), UINT32_C( 975946377), UINT32_C( 484534728), UINT32_C(1958580421), UINT32_C(2151142223),
+      UINT32_C(1303270884), UINT32_C(1497651999), UINT32_C( 961816068), UINT32_C(3004016426), UINT32_C( 854407273), UINT32_C(1716440737), UINT32_C(2916813662), UINT32_C(3257733854),
+      UINT32_C(2265963367), UINT32_C(1004557110), UINT32_C(2742302073), UINT32_C(1163297244), UINT32_C(1517765561), UINT32_C(1874904337), UINT32_C(2921110480), UINT32_C( 359680430),
+      UINT32_C(1536982820), UINT32_C(1284931027), UINT32_C(2398096050), UINT32_C(1154696843), UINT32_C(2610842506), UINT32_C(3775618576), UINT32_C(2827954170), UINT32_C(2512191601),
+      UINT32_C(1391483519), UINT32_C(2308933335), UINT32_C( 454528912), UINT32_C(1600121557), UINT32_C(1190919477), UINT32_C(1445398108), UINT32_C(2667492909), UINT32_C( 909425590),
+      UINT32_C(3968345109), UINT32_C( 997533611), UINT32_C(2354547894), UINT32_C(2901128823), UINT32_C( 284354228), UINT32_C( 442898924), UINT32_C(2260231376), UINT32_C( 901573663),
+      UINT32_C(3156296977), UINT32_C( 603428716), UINT32_C(2595180067), UINT32_C(3108477445), UINT32_C(1841904001), UINT32_C( 596062035), UINT32_C(2997436563), UINT32_C(1038575148),
+      UINT32_C( 402196907), UINT32_C(3275420064), UINT32_C(1147070783), UINT32_C( 100509060), UINT32_C( 829605598), UINT32_C(2287270645), UINT32_C(1715207738), UINT32_C( 262414948),
+      UINT32_C(3408305451), UINT32_C(3465503118), UINT32_C(3457346890), UINT32_C(1892880530), UINT32_C(3433187030), UINT32_C(2052388416), UINT32_C(1491111924), UINT32_C(3714548914),
+      UINT32_C(2963901986), UINT32_C( 964573423), UINT32_C(3070791973), UINT32_C(1999100833), UINT32_C(1631832353), UINT32_C(3034290368), UINT32_C(3641556007), UINT32_C(1656190016),
+      UINT32_C(4044578818), UINT32_C(3173749144), UINT32_C(3279172386), UINT32_C( 809212686), UINT32_C( 630292069), UINT32_C(1054436630), UINT32_C(1763173929), UINT32_C(1573703259),
+      UINT32_C(3327123246), UINT32_C(2474867312), UINT32_C(3143038893), UINT32_C(4176187795), UINT32_C( 639466768), UINT32_C( 325383914), UINT32_C( 947682525), UINT32_C(2039826506),
+      UINT32_C(2554324007), UINT32_C( 187417438), UINT32_C(1304920506), UINT32_C( 591770131), UINT32_C( 424239663), UINT32_C( 908897881), UINT32_C(1953409322), UINT32_C( 434963441),
+      UINT32_C(1186016744), UINT32_C(2857557232), UINT32_C(1895307613), UINT32_C(4220730827), UINT32_C(4178894240), UINT32_C(3039773067), UINT32_C(3676937706), UINT32_C(2297698208),
+      UINT32_C( 886023492), UINT32_C(3755876737), UINT32_C(  89118266), UINT32_C(3019957012), UINT32_C(1269634496), UINT32_C(1073798230), UINT32_C( 421210489), UINT32_C(2225213504),
+      UINT32_C( 934834613), UINT32_C(3424032658), UINT32_C(2177983853) };
+  static const uint32_t b = UINT32_C(2657138440);
+  static const uint32_t e[] =
+    { UINT32_C(2001445392), UINT32_C( 100670552), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(3768670480), UINT32_C( 590025288), UINT32_C(         0), UINT32_C(3135213224), UINT32_C(1495539648), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(4125855464), UINT32_C(4175086960), UINT32_C(1838984976), UINT32_C(         0), UINT32_C(2060326824), UINT32_C(         0),
+      UINT32_C(4288600424), UINT32_C(         0), UINT32_C(2920583736), UINT32_C(2194758616), UINT32_C(         0), UINT32_C(         0), UINT32_C(2773816576), UINT32_C(1899013784),
+      UINT32_C(         0), UINT32_C(2552601920), UINT32_C(         0), UINT32_C(         0), UINT32_C(1861180920), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(1295327232), UINT32_C( 939594832), UINT32_C(         0), UINT32_C(         0), UINT32_C(1073361632), UINT32_C(1339637968), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(1607416032), UINT32_C(4133324888), UINT32_C(         0), UINT32_C(2972611288), UINT32_C(         0), UINT32_C(3258093712), UINT32_C(         0),
+      UINT32_C(2827871136), UINT32_C(3050452768), UINT32_C(         0), UINT32_C( 915246880), UINT32_C( 957372112), UINT32_C(3500930408), UINT32_C(4243313880), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(1659456608), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2423053968),
+      UINT32_C(         0), UINT32_C(3753600048), UINT32_C(         0), UINT32_C(2596968408), UINT32_C( 738713264), UINT32_C(1296578232), UINT32_C(4209854896), UINT32_C(         0),
+      UINT32_C(3051871392), UINT32_C(         0), UINT32_C(2379873904), UINT32_C(4049294600), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1062999672),
+      UINT32_C(3901919368), UINT32_C(2927583816), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 615073344), UINT32_C( 139024680), UINT32_C(         0),
+      UINT32_C(4200114976), UINT32_C(4108714488), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(1653312520), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(1727364152), UINT32_C(3267244976), UINT32_C(3912968904), UINT32_C(2080920288), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(2226258512), UINT32_C(         0), UINT32_C(         0), UINT32_C(2979580552),
+      UINT32_C(3117653240), UINT32_C(2566907832), UINT32_C(         0), UINT32_C( 297638312), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C( 471136176),
+      UINT32_C(         0), UINT32_C(  86276696), UINT32_C( 278036400), UINT32_C(         0), UINT32_C(3322012064), UINT32_C(         0), UINT32_C( 869521024), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C( 225801752), UINT32_C(         0), UINT32_C(1959068424), UINT32_C(3090010008), UINT32_C(         0), UINT32_C(3519325536),
+      UINT32_C(4023487064), UINT32_C(         0), UINT32_C(1431524088), UINT32_C(         0), UINT32_C( 788457712), UINT32_C(         0), UINT32_C( 911960016), UINT32_C(1865846560),
+      UINT32_C(         0), UINT32_C( 746032752), UINT32_C(2683785296), UINT32_C(3123765904), UINT32_C(         0), UINT32_C(         0), UINT32_C(3781946272), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(3796148344), UINT32_C(         0), UINT32_C(         0), UINT32_C(1229250568), UINT32_C(         0), UINT32_C(         0), UINT32_C(1372938752),
+      UINT32_C(         0), UINT32_C(2003842240), UINT32_C(         0), UINT32_C(3874740848), UINT32_C(3922077224), UINT32_C(         0), UINT32_C(4221993032), UINT32_C(3792273368),
+      UINT32_C(         0), UINT32_C(         0), UINT32_C(2896455784), UINT32_C(2106368408), UINT32_C( 189945984), UINT32_C(3412655440), UINT32_C(         0), UINT32_C(1259808848),
+      UINT32_C( 246874680), UINT32_C(3913698544), UINT32_C(2109211600), UINT32_C(         0), UINT32_C( 320514680), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(1146767168), UINT32_C(2290513792), UINT32_C(         0), UINT32_C(         0), UINT32_C(2400472320), UINT32_C(3480512856), UINT32_C(1022309712), UINT32_C(         0),
+      UINT32_C( 119588384), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(3220499968), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0),
+      UINT32_C(         0), UINT32_C(2043550352), UINT32_C(         0) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_n_u32_z(pv, av, b);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    ev = simde_svmul_n_u32_z(pv, av, b);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) };
+  static const uint32_t a[] =
+    { UINT32_C(2071862003), UINT32_C(2869292699), UINT32_C(1611703002), UINT32_C(2397536846), UINT32_C(3415135283), UINT32_C(4138719580), UINT32_C(4086108161), UINT32_C(3677762536),
+      UINT32_C(3897996621), UINT32_C(2106809251), UINT32_C(1272816637), UINT32_C(1507444006), UINT32_C(4112803993), UINT32_C(1122751553), UINT32_C(3426121956), UINT32_C(4171721899),
+      UINT32_C(3303079201), UINT32_C(1447130200), UINT32_C(1033969431), UINT32_C(2107079652), UINT32_C( 611564515), UINT32_C(1952931471), UINT32_C(2185272791), UINT32_C( 729540617),
+      UINT32_C(1055874021), UINT32_C(3885248975), UINT32_C( 874788176), UINT32_C(2477898672), UINT32_C( 112731255), UINT32_C(1517952899), UINT32_C(3319577532), UINT32_C(2297452451),
+      UINT32_C(2194071731), UINT32_C(1634294289), UINT32_C(1083543184), UINT32_C(3235137097), UINT32_C(4006055019), UINT32_C(1732788651), UINT32_C(2670470396), UINT32_C( 791158140),
+      UINT32_C( 246542077), UINT32_C(3647937353), UINT32_C(4061725865), UINT32_C(3048467786), UINT32_C( 614693497), UINT32_C(3096177595), UINT32_C(2354558992), UINT32_C(3535503317),
+      UINT32_C(3084938350), UINT32_C( 814763911), UINT32_C(2636360019), UINT32_C( 273929879), UINT32_C( 188085840), UINT32_C(4072915170), UINT32_C(1300110200), UINT32_C( 136264090),
+      UINT32_C( 767557541), UINT32_C(2707246926), UINT32_C(2420080889), UINT32_C(2795541078), UINT32_C(1790104968), UINT32_C( 240940438), UINT32_C( 727505552), UINT32_C(3107158803),
+      UINT32_C(3387356027), UINT32_C( 996885314), UINT32_C( 449555140), UINT32_C(3301010492), UINT32_C(3610211137), UINT32_C(2045152232), UINT32_C(2040808038), UINT32_C( 942856125),
+      UINT32_C( 218241226), UINT32_C( 541617500), UINT32_C(1396315159), UINT32_C(3239574400), UINT32_C(1469662830), UINT32_C( 953188306), UINT32_C(2125558977), UINT32_C( 381150283),
+      UINT32_C(1478736380), UINT32_C(1031301926), UINT32_C(4287673215), UINT32_C( 499230638), UINT32_C(3228850926), UINT32_C(2599961817), UINT32_C(  51947960), UINT32_C(2316947341),
+      UINT32_C(2934062216), UINT32_C( 669735848), UINT32_C(3156704014), UINT32_C( 299493411), UINT32_C( 466701634), UINT32_C(1236650385), UINT32_C(   5098866), UINT32_C( 629827229),
+      UINT32_C(1272212643), UINT32_C(3581067207), UINT32_C(1586665787), UINT32_C(3278859137), UINT32_C(1256079545), UINT32_C(2073334537), UINT32_C(4269531489), UINT32_C(3928163655),
+      UINT32_C( 959838066), UINT32_C(4061112503), UINT32_C(3276841281), UINT32_C(3313942284), UINT32_C( 135292415), UINT32_C(1501799672), UINT32_C(3428319109), UINT32_C(1991736068),
+      UINT32_C( 699460722), UINT32_C(3592142740), UINT32_C(1821993824), UINT32_C( 691150634), UINT32_C(2100380292), UINT32_C(1809233382), UINT32_C(3090624180), UINT32_C( 456126121),
+      UINT32_C(1866850267), UINT32_C(4265959582), UINT32_C(4134198988), UINT32_C(2183175422), UINT32_C(3305066974), UINT32_C(3123697158), UINT32_C(2910021380), UINT32_C( 818455125),
+      UINT32_C( 530582913), UINT32_C( 975037806), UINT32_C(3257960388), UINT32_C(  38031396), UINT32_C(2831631522), UINT32_C( 509867546), UINT32_C(3016480349), UINT32_C(4192441208),
+      UINT32_C( 253264801), UINT32_C( 759772521), UINT32_C(3773790652), UINT32_C(1826829258), UINT32_C(2434050679), UINT32_C(4272912288), UINT32_C(3316742733), UINT32_C(2948502542),
+      UINT32_C(2176767512), UINT32_C(3366848267), UINT32_C(1252564352), UINT32_C(1219922896), UINT32_C(3604597557), UINT32_C(2429847874), UINT32_C( 290817283), UINT32_C( 834671641),
+      UINT32_C(4138893034), UINT32_C( 113139845), UINT32_C(3461375741), UINT32_C( 655755250), UINT32_C( 352186322), UINT32_C(2091176312), UINT32_C(1888352854), UINT32_C(4171320846),
+      UINT32_C(1391350988), UINT32_C(2992155828), UINT32_C(  92317715), UINT32_C(2167183023), UINT32_C(4271254149), UINT32_C(1383742203), UINT32_C(1120012084), UINT32_C( 574317397),
+      UINT32_C(1819552183), UINT32_C(3911109846), UINT32_C( 619617908), UINT32_C(3114605108), UINT32_C(1085750084), UINT32_C(2861707638), UINT32_C(2397918265), UINT32_C(1873815735),
+      UINT32_C( 668673105), UINT32_C(1695611376), UINT32_C(3414818455), UINT32_C(1568943641), UINT32_C(3768401002), UINT32_C(2794073965), UINT32_C( 993359747), UINT32_C(4054508959),
+      UINT32_C(4195910922), UINT32_C( 358558078), UINT32_C(1088481319), UINT32_C(2174641175), UINT32_C( 241253280), UINT32_C(4004834155), UINT32_C(  36301155), UINT32_C(3656635343),
+      UINT32_C(3604155480), UINT32_C(1558917941), UINT32_C( 849201947), UINT32_C(3501407024), UINT32_C(3789427830), UINT32_C(1674613504), UINT32_C(1264974204), UINT32_C( 623139277),
+      UINT32_C(2600269925), UINT32_C(1190586155), UINT32_C(3816395699), UINT32_C(1169370318) };
+  static const uint32_t b = UINT32_C( 539133052);
+  static const uint32_t e[] =
+    { UINT32_C(3409992116), UINT32_C(2869292699), UINT32_C(1611703002), UINT32_C(2397536846), UINT32_C(3445560500), UINT32_C(4138719580), UINT32_C(4086108161), UINT32_C(3677762536),
+      UINT32_C(3897996621), UINT32_C(1514565364), UINT32_C(1870914188), UINT32_C(3190756968), UINT32_C(2279837212), UINT32_C(1122751553), UINT32_C(2399149680), UINT32_C(4171721899),
+      UINT32_C(3303079201), UINT32_C(1447130200), UINT32_C(1033969431), UINT32_C(3850998384), UINT32_C( 611564515), UINT32_C(1952931471), UINT32_C(2185272791), UINT32_C( 729540617),
+      UINT32_C(1055874021), UINT32_C( 318037060), UINT32_C( 874788176), UINT32_C( 473803072), UINT32_C(3956082084), UINT32_C(1523371892), UINT32_C(3319577532), UINT32_C(1161854708),
+      UINT32_C( 469181108), UINT32_C(1634294289), UINT32_C(1427328448), UINT32_C(1354870620), UINT32_C(4006055019), UINT32_C(1636956884), UINT32_C(1173084688), UINT32_C(4045027344),
+      UINT32_C( 990131852), UINT32_C(3647937353), UINT32_C(3908527580), UINT32_C(3048467786), UINT32_C(1852290716), UINT32_C( 942185108), UINT32_C(2354558992), UINT32_C(1527103276),
+      UINT32_C(4013505864), UINT32_C(1591091556), UINT32_C(1570426932), UINT32_C( 273929879), UINT32_C( 188085840), UINT32_C(4072915170), UINT32_C(1300110200), UINT32_C( 136264090),
+      UINT32_C(3166365676), UINT32_C(2707246926), UINT32_C(3730103452), UINT32_C(2963749288), UINT32_C(1086950880), UINT32_C( 240940438), UINT32_C(3905691072), UINT32_C(3107158803),
+      UINT32_C(2545900436), UINT32_C( 996885314), UINT32_C( 449555140), UINT32_C(3301010492), UINT32_C(3610211137), UINT32_C(2157929568), UINT32_C(2040808038), UINT32_C(3069703052),
+      UINT32_C(3969919448), UINT32_C( 541617500), UINT32_C(3448477476), UINT32_C(3239574400), UINT32_C(2435503432), UINT32_C(1086992824), UINT32_C(2125558977), UINT32_C( 381150283),
+      UINT32_C(1478736380), UINT32_C(1031301926), UINT32_C(4287673215), UINT32_C(1230958664), UINT32_C( 182109000), UINT32_C(2599961817), UINT32_C(3253015840), UINT32_C(2316947341),
+      UINT32_C(1725657568), UINT32_C(3717399904), UINT32_C(3156704014), UINT32_C( 299493411), UINT32_C( 466701634), UINT32_C(1430152764), UINT32_C(   5098866), UINT32_C(3435964428),
+      UINT32_C(1272212643), UINT32_C(3581067207), UINT32_C(1586665787), UINT32_C(2223543932), UINT32_C(2509815196), UINT32_C( 519691356), UINT32_C(4269531489), UINT32_C(3928163655),
+      UINT32_C(2799608632), UINT32_C(4061112503), UINT32_C(3101007740), UINT32_C(3313942284), UINT32_C(3362186116), UINT32_C(1501799672), UINT32_C(3926546540), UINT32_C(1991736068),
+      UINT32_C( 699460722), UINT32_C(4125170608), UINT32_C(4167926400), UINT32_C( 804044888), UINT32_C(1605388272), UINT32_C(1809233382), UINT32_C(1656188720), UINT32_C( 456126121),
+      UINT32_C( 140204564), UINT32_C(4265959582), UINT32_C(2377980624), UINT32_C(1920664328), UINT32_C(2975735688), UINT32_C( 106087144), UINT32_C(2910021380), UINT32_C( 818455125),
+      UINT32_C(3281981052), UINT32_C( 975037806), UINT32_C(2643120880), UINT32_C(  38031396), UINT32_C(2831631522), UINT32_C( 851745944), UINT32_C(3016480349), UINT32_C(4164242976),
+      UINT32_C( 253264801), UINT32_C(3874620124), UINT32_C(3773790652), UINT32_C(1826829258), UINT32_C(1907748260), UINT32_C(3119280512), UINT32_C( 591458636), UINT32_C(2948502542),
+      UINT32_C(2919502752), UINT32_C(3366848267), UINT32_C(1252564352), UINT32_C(3928160448), UINT32_C(4216308140), UINT32_C( 947684344), UINT32_C( 290817283), UINT32_C( 834671641),
+      UINT32_C(2734301528), UINT32_C( 113139845), UINT32_C(2980468364), UINT32_C(2565382456), UINT32_C( 352186322), UINT32_C(2091176312), UINT32_C(1888352854), UINT32_C(3091007176),
+      UINT32_C(3527557840), UINT32_C(2347267888), UINT32_C(  92317715), UINT32_C(2167183023), UINT32_C(4271254149), UINT32_C(1383742203), UINT32_C(3600436528), UINT32_C(  88469804),
+      UINT32_C(1819552183), UINT32_C(3237318568), UINT32_C( 619617908), UINT32_C(3114605108), UINT32_C(1085750084), UINT32_C(2861707638), UINT32_C(2397918265), UINT32_C(1873815735),
+      UINT32_C( 668673105), UINT32_C(3875065920), UINT32_C(1848323364), UINT32_C(3005036572), UINT32_C( 627305304), UINT32_C(2794073965), UINT32_C(2129358708), UINT32_C(4054508959),
+      UINT32_C(3016595672), UINT32_C( 358558078), UINT32_C( 433229540), UINT32_C(2674022180), UINT32_C(  85418368), UINT32_C(4004834155), UINT32_C(  36301155), UINT32_C(1288655940),
+      UINT32_C(2219268768), UINT32_C(1558917941), UINT32_C( 985550100), UINT32_C(1572170560), UINT32_C(3789427830), UINT32_C(1792226304), UINT32_C(1264974204), UINT32_C(1227043660),
+      UINT32_C(2600269925), UINT32_C(3263177940), UINT32_C(3704739508), UINT32_C(3644845000) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t
+      rv,
+      av = simde_svld1_u32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_n_u32_m(pv, av, b);
+
+    simde_svst1_u32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  uint32_t a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u32();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svuint32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_u32(pg, &(a[i]));
+
+    ev = simde_svmul_n_u32_m(pv, av, b);
+
+    simde_svst1_u32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u32(1, b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0) };
+  static const uint64_t a[] =
+    { UINT64_C(15658050138910252985), UINT64_C(18441133686000076202), UINT64_C( 7736540491544766236), UINT64_C( 9293322724401513580),
+      UINT64_C( 3774019277430388962), UINT64_C( 1488424252142380615), UINT64_C(13662722046648425113), UINT64_C(  398938149098135361),
+      UINT64_C( 9801780306956205896), UINT64_C(10799307536716532690), UINT64_C( 4359591073732181618), UINT64_C( 8153430851448068351),
+      UINT64_C( 8058709523197833741), UINT64_C( 5901430605328483924), UINT64_C(  760426688404564821), UINT64_C(12468024943049495148),
+      UINT64_C(16722377327723104772), UINT64_C(13260603236151806935), UINT64_C( 2009051491243400139), UINT64_C( 7256627622186126695),
+      UINT64_C( 6376842537931812610), UINT64_C(11852653815072208995), UINT64_C( 9510014837929510448), UINT64_C( 7362892138629737322),
+      UINT64_C(12738285643562235374), UINT64_C( 1923305227444147508), UINT64_C(17444679449583364985), UINT64_C(14945453615563448991),
+      UINT64_C( 1449039641553298719), UINT64_C(18365346702914851546), UINT64_C( 7671788281345005565), UINT64_C( 4466679251737523020),
+      UINT64_C( 1959002341556960058), UINT64_C( 2223579893703069784), UINT64_C( 7190588442758311317), UINT64_C( 5091474463226083149),
+      UINT64_C( 8008401891482423752), UINT64_C( 6205722521443763167), UINT64_C( 3103122932343751573), UINT64_C(17656993655352107192),
+      UINT64_C(15714785310199933839), UINT64_C( 2250949388247196452), UINT64_C( 3298566170483684285), UINT64_C( 2999393618075147388),
+      UINT64_C(16373935679401401703), UINT64_C(14912549840273086026), UINT64_C( 1772500277227274488), UINT64_C(17172052236780604299),
+      UINT64_C( 5810359330340282367), UINT64_C( 7530328023756008353), UINT64_C(11929312047899405017), UINT64_C(12785185746118725881),
+      UINT64_C(16902029503049547065), UINT64_C(12057576351941309821), UINT64_C(10432494627916097800), UINT64_C(16599563081643758330),
+      UINT64_C( 6660461970038639932), UINT64_C( 3522551754170895212), UINT64_C(11740913539010985672), UINT64_C(13492692671584403628),
+      UINT64_C( 9778913598389577081), UINT64_C( 7283064545415987129), UINT64_C( 3165385667153061026), UINT64_C( 7057074543193767093),
+      UINT64_C(10865902621587812136), UINT64_C(15236391333103373679), UINT64_C(11643789571155441646), UINT64_C(  473376993943362376),
+      UINT64_C( 3127492366941441268), UINT64_C( 6243864201081118626), UINT64_C( 1832501955516417504), UINT64_C(18328482842118014070),
+      UINT64_C( 6633019101995312422), UINT64_C(14976111356186412310), UINT64_C( 7531155413662406810), UINT64_C(14867816856139189581),
+      UINT64_C( 8202108646431204541), UINT64_C( 8269107922113397251), UINT64_C(12950208920069954653), UINT64_C( 5379091867743450415),
+      UINT64_C( 1824402145730975620), UINT64_C( 7196695057532666262), UINT64_C( 5639186367191891240), UINT64_C( 3510218000502770911),
+      UINT64_C(11624177714521405219), UINT64_C( 5839741725208173729), UINT64_C(  511476487474363819), UINT64_C( 3335524701198040942),
+      UINT64_C( 6579399217547467169), UINT64_C(17838209795153419540), UINT64_C(18300899972096355786), UINT64_C( 4058694986686229530),
+      UINT64_C( 9714320958623693242), UINT64_C(12381611301783458705), UINT64_C(10037000132926215870), UINT64_C( 9066031659210531074),
+      UINT64_C( 8841905175694259901), UINT64_C( 9736831633848760212), UINT64_C( 6178691656004713922), UINT64_C( 3513018211130830976),
+      UINT64_C(  565504614453981557), UINT64_C( 2295318884745228683), UINT64_C( 5621077063287156569) };
+  static const uint64_t b = UINT64_C(15739703992296281243);
+  static const uint64_t e[] =
+    { UINT64_C(17979505467522705667), UINT64_C(  931525196365002222), UINT64_C( 3791016738097487348), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6112774351545667235), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 8470571588140372006), UINT64_C( 8528539358421694214), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 8758803118409146487), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 9459094300552769513), UINT64_C(                   0),
+      UINT64_C( 4180311770767040054), UINT64_C(                   0), UINT64_C( 4286150192667164432), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(15301051054621173189), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(10400089423188131588),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C(17541178588738944311), UINT64_C(12321903924631666591),
+      UINT64_C(16921193470522369048), UINT64_C( 5652161389779076101), UINT64_C( 4760974236888141623), UINT64_C( 2396830632640622440),
+      UINT64_C(                   0), UINT64_C( 2546282595051361996), UINT64_C( 8672256015158761327), UINT64_C(                   0),
+      UINT64_C( 7558561016358721885), UINT64_C( 1237873149906405070), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C( 1043176662223178597), UINT64_C( 3512168274222562939), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C( 5153062156928132783), UINT64_C( 1304308771273668568), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 5264045416342086424), UINT64_C( 5686090341878323236),
+      UINT64_C(   52069174871974979), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 3110304364720612759),
+      UINT64_C(14990505840192630072), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(12851226574987732120),
+      UINT64_C(12266118908814534588), UINT64_C( 6178778917752082198), UINT64_C(                   0), UINT64_C(14207664483694390130),
+      UINT64_C( 9176857491212072450), UINT64_C( 3812671693891603538), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(11802846670101021295), UINT64_C(12947070381769061329), UINT64_C( 7607579119620206671), UINT64_C(14274625754212769653),
+      UINT64_C(                   0), UINT64_C( 4688734923572669906), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(                   0), UINT64_C(12248222705830570363), UINT64_C(13252760680891888265), UINT64_C(17548027132651765658),
+      UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6113749885099983182), UINT64_C(                   0),
+      UINT64_C( 4073244450550578078), UINT64_C(                   0), UINT64_C( 1621505356967779594), UINT64_C(                   0),
+      UINT64_C( 2286892377648293999), UINT64_C(14145832824672155292), UINT64_C(                   0), UINT64_C(                   0),
+      UINT64_C(  580719860263392727), UINT64_C( 6615989607519148841), UINT64_C(                   0) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_n_u64_z(pv, av, b);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    ev = simde_svmul_n_u64_z(pv, av, b);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_u64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1) };
+  static const uint64_t a[] =
+    { UINT64_C(17769817755794161431), UINT64_C( 1171323767706589639), UINT64_C(14208411934489851646), UINT64_C( 5941836952313289690),
+      UINT64_C(15777409203288932324), UINT64_C( 8145568565271794488), UINT64_C(   16783110682360597), UINT64_C(12792630654061193467),
+      UINT64_C( 7096163566338673548), UINT64_C(  908151482310465462), UINT64_C(12126150548621757473), UINT64_C( 8747229543059578853),
+      UINT64_C( 7889904912347698162), UINT64_C( 7110112065353145002), UINT64_C(15101679975371714110), UINT64_C(14607118456865452625),
+      UINT64_C(  801751104448024571), UINT64_C( 2801618198798841662), UINT64_C(14791129030116608647), UINT64_C(12446473485860653079),
+      UINT64_C( 4899210533638414480), UINT64_C( 9819152312780892469), UINT64_C( 1330603664560838190), UINT64_C(15160729615858761992),
+      UINT64_C( 8621228077546259292), UINT64_C( 4104144898730846058), UINT64_C( 4052493298837942064), UINT64_C( 6264602713916522203),
+      UINT64_C(16128335250151945241), UINT64_C( 8216041551840307394), UINT64_C( 2059792378870229038), UINT64_C(17755770130588665369),
+      UINT64_C( 4481684691284467934), UINT64_C(16808015158118677645), UINT64_C(15228601882399662072), UINT64_C(10967760128885297250),
+      UINT64_C( 4046516889410307695), UINT64_C( 4340987648664875930), UINT64_C(14102685099174036521), UINT64_C( 6534784542174256221),
+      UINT64_C( 6025936944507428029), UINT64_C( 1883040045815343264), UINT64_C(14019339935551428459), UINT64_C( 9625470891888119887),
+      UINT64_C(16587758287608207654), UINT64_C( 3261429398805142582), UINT64_C( 4803801434199506819), UINT64_C( 3847218737258005528),
+      UINT64_C( 1591821121015337706), UINT64_C( 5842435143225958948), UINT64_C(12534893894958648767), UINT64_C( 7902675518083592551),
+      UINT64_C( 3258834851941236803), UINT64_C(13093698005349201559), UINT64_C( 4285276010651840566), UINT64_C( 4088526245412799693),
+      UINT64_C(12056580474497882908), UINT64_C(14174731891865576715), UINT64_C( 5026306873357180339), UINT64_C(16877613222802584075),
+      UINT64_C( 3775811070012134830), UINT64_C(16796433428851815366), UINT64_C(13386441567971026696), UINT64_C( 6727520977765948579),
+      UINT64_C(10585574364342414217), UINT64_C( 1159111790184242422), UINT64_C( 6416601104910484645) };
+  static const uint64_t b = UINT64_C(10174955680282305477);
+  static const uint64_t e[] =
+    { UINT64_C( 9873826405225787827), UINT64_C( 1171323767706589639), UINT64_C( 2986679229212232566), UINT64_C( 5941836952313289690),
+      UINT64_C( 9131408878756370036), UINT64_C( 8145568565271794488), UINT64_C( 9652995866500437545), UINT64_C(10412906481670429223),
+      UINT64_C(13551726406439765692), UINT64_C(  908151482310465462), UINT64_C(12126150548621757473), UINT64_C( 7250255643286493753),
+      UINT64_C( 1832532126982532922), UINT64_C( 7110112065353145002), UINT64_C(15101679975371714110), UINT64_C(14607118456865452625),
+      UINT64_C(10300989245064781095), UINT64_C( 7557999772704111798), UINT64_C(14791129030116608647), UINT64_C( 9720120627762781875),
+      UINT64_C( 4899210533638414480), UINT64_C( 9819152312780892469), UINT64_C( 1330603664560838190), UINT64_C( 7320109370222207784),
+      UINT64_C( 8621228077546259292), UINT64_C( 4104144898730846058), UINT64_C(17797631000997109744), UINT64_C(11304758593270353799),
+      UINT64_C(14324280794099008061), UINT64_C( 6814015276385346378), UINT64_C(11199943445029483878), UINT64_C(17755770130588665369),
+      UINT64_C( 9902900275970122966), UINT64_C(  743658681604038529), UINT64_C(15228601882399662072), UINT64_C(10967760128885297250),
+      UINT64_C( 4046516889410307695), UINT64_C( 3324297591474504578), UINT64_C(14102685099174036521), UINT64_C( 6803517539337226897),
+      UINT64_C( 6025936944507428029), UINT64_C( 1883040045815343264), UINT64_C(14019339935551428459), UINT64_C( 9672297766749346251),
+      UINT64_C(16587758287608207654), UINT64_C(12610929584552695694), UINT64_C( 1511960656487778511), UINT64_C( 3847218737258005528),
+      UINT64_C( 1591821121015337706), UINT64_C( 5842435143225958948), UINT64_C(12534893894958648767), UINT64_C( 2977222471347378499),
+      UINT64_C( 3258834851941236803), UINT64_C(15335493989871527731), UINT64_C(  666164897537702798), UINT64_C( 4974069821920999617),
+      UINT64_C( 6879329093900497036), UINT64_C(14174731891865576715), UINT64_C(14134514487396045759), UINT64_C(16877613222802584075),
+      UINT64_C( 3775811070012134830), UINT64_C(13327749050556000606), UINT64_C(13386441567971026696), UINT64_C(12108900131552678511),
+      UINT64_C(10585574364342414217), UINT64_C( 1821544486025063246), UINT64_C( 6646747172640285177) };
+
+  static uint64_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t
+      rv,
+      av = simde_svld1_u64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_n_u64_m(pv, av, b);
+
+    simde_svst1_u64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu64(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  uint64_t a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  b = simde_test_codegen_random_u64();
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svuint64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_u64(pg, &(a[i]));
+
+    ev = simde_svmul_n_u64_m(pv, av, b);
+
+    simde_svst1_u64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1u64(1, b);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_f32_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   -43.68), SIMDE_FLOAT32_C(   -29.42), SIMDE_FLOAT32_C(    21.12), SIMDE_FLOAT32_C(   -90.93),
+      SIMDE_FLOAT32_C(    14.03), SIMDE_FLOAT32_C(    82.77), SIMDE_FLOAT32_C(     2.35), SIMDE_FLOAT32_C(     8.43),
+      SIMDE_FLOAT32_C(    34.74), SIMDE_FLOAT32_C(     1.65), SIMDE_FLOAT32_C(    43.29), SIMDE_FLOAT32_C(    -8.58),
+      SIMDE_FLOAT32_C(    63.98), SIMDE_FLOAT32_C(   -15.78), SIMDE_FLOAT32_C(   -94.82), SIMDE_FLOAT32_C(    29.93),
+      SIMDE_FLOAT32_C(   -50.87), SIMDE_FLOAT32_C(     6.10), SIMDE_FLOAT32_C(   -77.82), SIMDE_FLOAT32_C(   -53.20),
+      SIMDE_FLOAT32_C(   -43.38), SIMDE_FLOAT32_C(    52.53), SIMDE_FLOAT32_C(    33.76), SIMDE_FLOAT32_C(   -18.32),
+      SIMDE_FLOAT32_C(    -4.45), SIMDE_FLOAT32_C(    79.80), SIMDE_FLOAT32_C(    33.73), SIMDE_FLOAT32_C(   -32.04),
+      SIMDE_FLOAT32_C(    36.87), SIMDE_FLOAT32_C(    -0.38), SIMDE_FLOAT32_C(    -2.76), SIMDE_FLOAT32_C(    93.18),
+      SIMDE_FLOAT32_C(    70.20), SIMDE_FLOAT32_C(   -81.63), SIMDE_FLOAT32_C(   -97.74), SIMDE_FLOAT32_C(   -15.77),
+      SIMDE_FLOAT32_C(   -98.87), SIMDE_FLOAT32_C(     4.61), SIMDE_FLOAT32_C(    92.66), SIMDE_FLOAT32_C(    35.87),
+      SIMDE_FLOAT32_C(   -93.74), SIMDE_FLOAT32_C(    35.95), SIMDE_FLOAT32_C(   -72.71), SIMDE_FLOAT32_C(    70.24),
+      SIMDE_FLOAT32_C(   -79.83), SIMDE_FLOAT32_C(   -67.53), SIMDE_FLOAT32_C(     0.17), SIMDE_FLOAT32_C(   -30.70),
+      SIMDE_FLOAT32_C(    38.57), SIMDE_FLOAT32_C(    22.35), SIMDE_FLOAT32_C(    16.10), SIMDE_FLOAT32_C(    95.20),
+      SIMDE_FLOAT32_C(   -25.12), SIMDE_FLOAT32_C(   -50.14), SIMDE_FLOAT32_C(   -23.12), SIMDE_FLOAT32_C(    70.43),
+      SIMDE_FLOAT32_C(   -70.35), SIMDE_FLOAT32_C(   -89.40), SIMDE_FLOAT32_C(   -61.61), SIMDE_FLOAT32_C(    66.52),
+      SIMDE_FLOAT32_C(    10.22), SIMDE_FLOAT32_C(    35.63), SIMDE_FLOAT32_C(    59.70), SIMDE_FLOAT32_C(   -19.58),
+      SIMDE_FLOAT32_C(    54.00), SIMDE_FLOAT32_C(    61.96), SIMDE_FLOAT32_C(    64.65), SIMDE_FLOAT32_C(    55.13),
+      SIMDE_FLOAT32_C(   -33.43), SIMDE_FLOAT32_C(    57.31), SIMDE_FLOAT32_C(    -8.99), SIMDE_FLOAT32_C(   -27.17),
+      SIMDE_FLOAT32_C(    -6.74), SIMDE_FLOAT32_C(    18.29), SIMDE_FLOAT32_C(   -56.93), SIMDE_FLOAT32_C(    13.43),
+      SIMDE_FLOAT32_C(    50.76), SIMDE_FLOAT32_C(    43.24), SIMDE_FLOAT32_C(    82.72), SIMDE_FLOAT32_C(   -10.67),
+      SIMDE_FLOAT32_C(   -34.42), SIMDE_FLOAT32_C(    -1.18), SIMDE_FLOAT32_C(   -15.47), SIMDE_FLOAT32_C(    40.46),
+      SIMDE_FLOAT32_C(    48.68), SIMDE_FLOAT32_C(    61.40), SIMDE_FLOAT32_C(    10.89), SIMDE_FLOAT32_C(    78.34),
+      SIMDE_FLOAT32_C(    72.01), SIMDE_FLOAT32_C(    49.28), SIMDE_FLOAT32_C(    44.86), SIMDE_FLOAT32_C(   -17.77),
+      SIMDE_FLOAT32_C(   -15.09), SIMDE_FLOAT32_C(     4.56), SIMDE_FLOAT32_C(    62.65), SIMDE_FLOAT32_C(   -61.09),
+      SIMDE_FLOAT32_C(   -33.48), SIMDE_FLOAT32_C(    27.30), SIMDE_FLOAT32_C(    94.05), SIMDE_FLOAT32_C(    33.09),
+      SIMDE_FLOAT32_C(   -15.40), SIMDE_FLOAT32_C(   -14.95), SIMDE_FLOAT32_C(   -94.09), SIMDE_FLOAT32_C(    77.86),
+      SIMDE_FLOAT32_C(   -96.65), SIMDE_FLOAT32_C(   -51.02), SIMDE_FLOAT32_C(    -8.71), SIMDE_FLOAT32_C(    54.11),
+      SIMDE_FLOAT32_C(    92.22), SIMDE_FLOAT32_C(   -25.99), SIMDE_FLOAT32_C(   -56.56), SIMDE_FLOAT32_C(   -42.20),
+      SIMDE_FLOAT32_C(    72.83), SIMDE_FLOAT32_C(    27.97), SIMDE_FLOAT32_C(    98.26), SIMDE_FLOAT32_C(    21.51),
+      SIMDE_FLOAT32_C(   -10.63), SIMDE_FLOAT32_C(     9.15), SIMDE_FLOAT32_C(    -0.15), SIMDE_FLOAT32_C(   -38.62),
+      SIMDE_FLOAT32_C(   -41.57), SIMDE_FLOAT32_C(   -55.29), SIMDE_FLOAT32_C(    43.60), SIMDE_FLOAT32_C(    43.34),
+      SIMDE_FLOAT32_C(    49.27), SIMDE_FLOAT32_C(     6.25), SIMDE_FLOAT32_C(    82.26), SIMDE_FLOAT32_C(   -84.21),
+      SIMDE_FLOAT32_C(   -66.46), SIMDE_FLOAT32_C(    76.31), SIMDE_FLOAT32_C(    48.88), SIMDE_FLOAT32_C(    18.15),
+      SIMDE_FLOAT32_C(   -38.64), SIMDE_FLOAT32_C(    54.79), SIMDE_FLOAT32_C(    -3.99), SIMDE_FLOAT32_C(   -35.29),
+      SIMDE_FLOAT32_C(   -96.23), SIMDE_FLOAT32_C(    87.30), SIMDE_FLOAT32_C(   -81.19), SIMDE_FLOAT32_C(    95.99),
+      SIMDE_FLOAT32_C(   -38.69), SIMDE_FLOAT32_C(   -37.75), SIMDE_FLOAT32_C(   -46.21), SIMDE_FLOAT32_C(   -65.86),
+      SIMDE_FLOAT32_C(    90.22), SIMDE_FLOAT32_C(   -47.95), SIMDE_FLOAT32_C(    55.66), SIMDE_FLOAT32_C(   -20.40),
+      SIMDE_FLOAT32_C(    61.20), SIMDE_FLOAT32_C(   -44.49), SIMDE_FLOAT32_C(    40.97), SIMDE_FLOAT32_C(   -80.37),
+      SIMDE_FLOAT32_C(     0.21), SIMDE_FLOAT32_C(   -15.42), SIMDE_FLOAT32_C(    62.97), SIMDE_FLOAT32_C(   -50.52),
+      SIMDE_FLOAT32_C(    90.83), SIMDE_FLOAT32_C(    45.23), SIMDE_FLOAT32_C(   -34.73), SIMDE_FLOAT32_C(   -75.63),
+      SIMDE_FLOAT32_C(    21.54), SIMDE_FLOAT32_C(   -85.85), SIMDE_FLOAT32_C(    42.52), SIMDE_FLOAT32_C(    82.90),
+      SIMDE_FLOAT32_C(    68.94), SIMDE_FLOAT32_C(   -61.47), SIMDE_FLOAT32_C(   -52.40), SIMDE_FLOAT32_C(    72.72),
+      SIMDE_FLOAT32_C(   -74.18), SIMDE_FLOAT32_C(   -33.59), SIMDE_FLOAT32_C(    68.70), SIMDE_FLOAT32_C(   -12.87),
+      SIMDE_FLOAT32_C(    28.67), SIMDE_FLOAT32_C(   -77.51), SIMDE_FLOAT32_C(    21.27), SIMDE_FLOAT32_C(    18.89),
+      SIMDE_FLOAT32_C(   -25.46), SIMDE_FLOAT32_C(   -23.07), SIMDE_FLOAT32_C(    98.48), SIMDE_FLOAT32_C(   -64.27),
+      SIMDE_FLOAT32_C(    32.44), SIMDE_FLOAT32_C(    39.46), SIMDE_FLOAT32_C(   -44.64), SIMDE_FLOAT32_C(   -67.35),
+      SIMDE_FLOAT32_C(   -75.97), SIMDE_FLOAT32_C(   -81.67), SIMDE_FLOAT32_C(   -17.87) };
+  static const simde_float32 b = SIMDE_FLOAT32_C(   -85.14);
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  3718.92), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  7741.78),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -7047.04), SIMDE_FLOAT32_C(  -200.08), SIMDE_FLOAT32_C(  -717.73),
+      SIMDE_FLOAT32_C( -2957.76), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   730.50),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  8072.97), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6625.59), SIMDE_FLOAT32_C(  4529.45),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -4472.40), SIMDE_FLOAT32_C( -2874.33), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -6794.17), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    32.35), SIMDE_FLOAT32_C(   234.99), SIMDE_FLOAT32_C( -7933.35),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6949.98), SIMDE_FLOAT32_C(  8321.58), SIMDE_FLOAT32_C(  1342.66),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -392.50), SIMDE_FLOAT32_C( -7889.07), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  7981.02), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6190.53), SIMDE_FLOAT32_C( -5980.23),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5749.50), SIMDE_FLOAT32_C(   -14.47), SIMDE_FLOAT32_C(  2613.80),
+      SIMDE_FLOAT32_C( -3283.85), SIMDE_FLOAT32_C( -1902.88), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  2138.72), SIMDE_FLOAT32_C(  4268.92), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  7611.52), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  -870.13), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1667.04),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -5275.27), SIMDE_FLOAT32_C( -5504.30), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  2846.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   765.41), SIMDE_FLOAT32_C(  2313.25),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  4847.02), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -3681.45), SIMDE_FLOAT32_C( -7042.78), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  2930.52), SIMDE_FLOAT32_C(   100.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -4144.62), SIMDE_FLOAT32_C( -5227.60), SIMDE_FLOAT32_C(  -927.17), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -6130.93), SIMDE_FLOAT32_C( -4195.70), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -5334.02), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  2850.49), SIMDE_FLOAT32_C( -2324.32), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -2817.28),
+      SIMDE_FLOAT32_C(  1311.16), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  8010.82), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  4343.84), SIMDE_FLOAT32_C(   741.57), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -6200.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -8365.86), SIMDE_FLOAT32_C( -1831.36),
+      SIMDE_FLOAT32_C(   905.04), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    12.77), SIMDE_FLOAT32_C(  3288.11),
+      SIMDE_FLOAT32_C(  3539.27), SIMDE_FLOAT32_C(  4707.39), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -4194.85), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -7003.62), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  5658.40), SIMDE_FLOAT32_C( -6497.03), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(  3289.81), SIMDE_FLOAT32_C( -4664.82), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3004.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6912.52), SIMDE_FLOAT32_C( -8172.59),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3214.03), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5607.32),
+      SIMDE_FLOAT32_C( -7681.33), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -4738.89), SIMDE_FLOAT32_C(  1736.86),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  3787.88), SIMDE_FLOAT32_C( -3488.19), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1312.86), SIMDE_FLOAT32_C( -5361.27), SIMDE_FLOAT32_C(  4301.27),
+      SIMDE_FLOAT32_C( -7733.27), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6439.14),
+      SIMDE_FLOAT32_C( -1833.92), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -7058.11),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5233.56), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C( -5849.12), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  6599.20), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  1964.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C( -2761.94), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  5734.18),
+      SIMDE_FLOAT32_C(  6468.09), SIMDE_FLOAT32_C(  6953.38), SIMDE_FLOAT32_C(  1521.45) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_n_f32_z(pv, av, b);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  b = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    ev = simde_svmul_n_f32_z(pv, av, b);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_f32_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+       INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),
+      -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),
+      -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+       INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+      -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) };
+  static const simde_float32 a[] =
+    { SIMDE_FLOAT32_C(   -27.88), SIMDE_FLOAT32_C(    26.13), SIMDE_FLOAT32_C(   -72.91), SIMDE_FLOAT32_C(    56.13),
+      SIMDE_FLOAT32_C(    -0.74), SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(    98.99), SIMDE_FLOAT32_C(   -24.40),
+      SIMDE_FLOAT32_C(   -46.92), SIMDE_FLOAT32_C(    -5.84), SIMDE_FLOAT32_C(     2.49), SIMDE_FLOAT32_C(    -7.84),
+      SIMDE_FLOAT32_C(   -44.73), SIMDE_FLOAT32_C(    -4.31), SIMDE_FLOAT32_C(   -40.49), SIMDE_FLOAT32_C(   -19.20),
+      SIMDE_FLOAT32_C(    30.65), SIMDE_FLOAT32_C(   -21.69), SIMDE_FLOAT32_C(     6.56), SIMDE_FLOAT32_C(   -48.76),
+      SIMDE_FLOAT32_C(    38.13), SIMDE_FLOAT32_C(   -63.14), SIMDE_FLOAT32_C(   -68.12), SIMDE_FLOAT32_C(    33.96),
+      SIMDE_FLOAT32_C(    30.76), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    40.13), SIMDE_FLOAT32_C(    85.67),
+      SIMDE_FLOAT32_C(     6.94), SIMDE_FLOAT32_C(   -58.26), SIMDE_FLOAT32_C(     8.29), SIMDE_FLOAT32_C(    79.06),
+      SIMDE_FLOAT32_C(    67.87), SIMDE_FLOAT32_C(    35.38), SIMDE_FLOAT32_C(    35.20), SIMDE_FLOAT32_C(   -32.86),
+      SIMDE_FLOAT32_C(   -63.59), SIMDE_FLOAT32_C(    34.19), SIMDE_FLOAT32_C(    42.73), SIMDE_FLOAT32_C(   -10.52),
+      SIMDE_FLOAT32_C(   -71.66), SIMDE_FLOAT32_C(   -54.78), SIMDE_FLOAT32_C(    81.64), SIMDE_FLOAT32_C(   -16.39),
+      SIMDE_FLOAT32_C(    40.91), SIMDE_FLOAT32_C(   -58.84), SIMDE_FLOAT32_C(    64.41), SIMDE_FLOAT32_C(   -28.44),
+      SIMDE_FLOAT32_C(    19.46), SIMDE_FLOAT32_C(   -29.03), SIMDE_FLOAT32_C(    22.80), SIMDE_FLOAT32_C(   -42.41),
+      SIMDE_FLOAT32_C(     7.83), SIMDE_FLOAT32_C(    54.68), SIMDE_FLOAT32_C(    91.55), SIMDE_FLOAT32_C(   -61.41),
+      SIMDE_FLOAT32_C(   -44.32), SIMDE_FLOAT32_C(    31.68), SIMDE_FLOAT32_C(   -75.74), SIMDE_FLOAT32_C(    62.62),
+      SIMDE_FLOAT32_C(    73.42), SIMDE_FLOAT32_C(    32.55), SIMDE_FLOAT32_C(    41.69), SIMDE_FLOAT32_C(    41.29),
+      SIMDE_FLOAT32_C(   -32.07), SIMDE_FLOAT32_C(   -23.12), SIMDE_FLOAT32_C(   -91.57), SIMDE_FLOAT32_C(     4.34),
+      SIMDE_FLOAT32_C(   -88.93), SIMDE_FLOAT32_C(    51.16), SIMDE_FLOAT32_C(    93.83), SIMDE_FLOAT32_C(   -60.59),
+      SIMDE_FLOAT32_C(    96.37), SIMDE_FLOAT32_C(    75.47), SIMDE_FLOAT32_C(    23.02), SIMDE_FLOAT32_C(    37.28),
+      SIMDE_FLOAT32_C(   -83.37), SIMDE_FLOAT32_C(   -12.57), SIMDE_FLOAT32_C(   -91.15), SIMDE_FLOAT32_C(    36.09),
+      SIMDE_FLOAT32_C(    58.40), SIMDE_FLOAT32_C(    31.65), SIMDE_FLOAT32_C(    93.69), SIMDE_FLOAT32_C(   -33.77),
+      SIMDE_FLOAT32_C(   -13.67), SIMDE_FLOAT32_C(    85.23), SIMDE_FLOAT32_C(     4.83), SIMDE_FLOAT32_C(    42.02),
+      SIMDE_FLOAT32_C(    16.91), SIMDE_FLOAT32_C(    29.09), SIMDE_FLOAT32_C(     4.64), SIMDE_FLOAT32_C(    -9.67),
+      SIMDE_FLOAT32_C(   -38.36), SIMDE_FLOAT32_C(   -53.68), SIMDE_FLOAT32_C(   -68.38), SIMDE_FLOAT32_C(    29.57),
+      SIMDE_FLOAT32_C(    23.21), SIMDE_FLOAT32_C(   -59.95), SIMDE_FLOAT32_C(   -66.08), SIMDE_FLOAT32_C(    34.28),
+      SIMDE_FLOAT32_C(    91.20), SIMDE_FLOAT32_C(   -72.26), SIMDE_FLOAT32_C(    73.69), SIMDE_FLOAT32_C(    87.58),
+      SIMDE_FLOAT32_C(   -96.79), SIMDE_FLOAT32_C(    -3.29), SIMDE_FLOAT32_C(    24.86), SIMDE_FLOAT32_C(   -80.16),
+      SIMDE_FLOAT32_C(    84.14), SIMDE_FLOAT32_C(    33.71), SIMDE_FLOAT32_C(    55.93), SIMDE_FLOAT32_C(    42.54),
+      SIMDE_FLOAT32_C(   -34.64), SIMDE_FLOAT32_C(    49.62), SIMDE_FLOAT32_C(   -91.23), SIMDE_FLOAT32_C(    51.69),
+      SIMDE_FLOAT32_C(    34.85), SIMDE_FLOAT32_C(    13.60), SIMDE_FLOAT32_C(    -6.29), SIMDE_FLOAT32_C(   -48.23),
+      SIMDE_FLOAT32_C(   -57.31), SIMDE_FLOAT32_C(    98.35), SIMDE_FLOAT32_C(    42.10), SIMDE_FLOAT32_C(     4.33),
+      SIMDE_FLOAT32_C(   -55.33), SIMDE_FLOAT32_C(    73.72), SIMDE_FLOAT32_C(   -66.10), SIMDE_FLOAT32_C(    67.88),
+      SIMDE_FLOAT32_C(   -86.24), SIMDE_FLOAT32_C(   -32.18), SIMDE_FLOAT32_C(     2.16), SIMDE_FLOAT32_C(   -95.04),
+      SIMDE_FLOAT32_C(    -4.44), SIMDE_FLOAT32_C(   -24.16), SIMDE_FLOAT32_C(    92.54), SIMDE_FLOAT32_C(    -1.23),
+      SIMDE_FLOAT32_C(    72.55), SIMDE_FLOAT32_C(    17.40), SIMDE_FLOAT32_C(    18.61), SIMDE_FLOAT32_C(    56.68),
+      SIMDE_FLOAT32_C(   -48.89), SIMDE_FLOAT32_C(   -25.45), SIMDE_FLOAT32_C(    -0.78), SIMDE_FLOAT32_C(    16.47),
+      SIMDE_FLOAT32_C(   -75.83), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   -31.84), SIMDE_FLOAT32_C(    59.02),
+      SIMDE_FLOAT32_C(   -78.40), SIMDE_FLOAT32_C(    61.87), SIMDE_FLOAT32_C(   -89.22), SIMDE_FLOAT32_C(   -35.71),
+      SIMDE_FLOAT32_C(    60.22), SIMDE_FLOAT32_C(    52.88), SIMDE_FLOAT32_C(    68.62), SIMDE_FLOAT32_C(   -95.11) };
+  static const simde_float32 b = SIMDE_FLOAT32_C(    26.60);
+  static const simde_float32 e[] =
+    { SIMDE_FLOAT32_C(  -741.61), SIMDE_FLOAT32_C(    26.13), SIMDE_FLOAT32_C(   -72.91), SIMDE_FLOAT32_C(  1493.06),
+      SIMDE_FLOAT32_C(   -19.68), SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(  2633.13), SIMDE_FLOAT32_C(  -649.04),
+      SIMDE_FLOAT32_C( -1248.07), SIMDE_FLOAT32_C(    -5.84), SIMDE_FLOAT32_C(     2.49), SIMDE_FLOAT32_C(    -7.84),
+      SIMDE_FLOAT32_C( -1189.82), SIMDE_FLOAT32_C(  -114.65), SIMDE_FLOAT32_C(   -40.49), SIMDE_FLOAT32_C(   -19.20),
+      SIMDE_FLOAT32_C(   815.29), SIMDE_FLOAT32_C(  -576.95), SIMDE_FLOAT32_C(   174.50), SIMDE_FLOAT32_C(   -48.76),
+      SIMDE_FLOAT32_C(  1014.26), SIMDE_FLOAT32_C(   -63.14), SIMDE_FLOAT32_C( -1811.99), SIMDE_FLOAT32_C(    33.96),
+      SIMDE_FLOAT32_C(    30.76), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    40.13), SIMDE_FLOAT32_C(    85.67),
+      SIMDE_FLOAT32_C(   184.60), SIMDE_FLOAT32_C(   -58.26), SIMDE_FLOAT32_C(   220.51), SIMDE_FLOAT32_C(    79.06),
+      SIMDE_FLOAT32_C(    67.87), SIMDE_FLOAT32_C(    35.38), SIMDE_FLOAT32_C(   936.32), SIMDE_FLOAT32_C(   -32.86),
+      SIMDE_FLOAT32_C( -1691.49), SIMDE_FLOAT32_C(   909.45), SIMDE_FLOAT32_C(    42.73), SIMDE_FLOAT32_C(  -279.83),
+      SIMDE_FLOAT32_C(   -71.66), SIMDE_FLOAT32_C( -1457.15), SIMDE_FLOAT32_C(    81.64), SIMDE_FLOAT32_C(   -16.39),
+      SIMDE_FLOAT32_C(    40.91), SIMDE_FLOAT32_C( -1565.14), SIMDE_FLOAT32_C(    64.41), SIMDE_FLOAT32_C(   -28.44),
+      SIMDE_FLOAT32_C(    19.46), SIMDE_FLOAT32_C(   -29.03), SIMDE_FLOAT32_C(    22.80), SIMDE_FLOAT32_C( -1128.11),
+      SIMDE_FLOAT32_C(   208.28), SIMDE_FLOAT32_C(  1454.49), SIMDE_FLOAT32_C(  2435.23), SIMDE_FLOAT32_C( -1633.51),
+      SIMDE_FLOAT32_C(   -44.32), SIMDE_FLOAT32_C(    31.68), SIMDE_FLOAT32_C( -2014.68), SIMDE_FLOAT32_C(    62.62),
+      SIMDE_FLOAT32_C(  1952.97), SIMDE_FLOAT32_C(    32.55), SIMDE_FLOAT32_C(    41.69), SIMDE_FLOAT32_C(  1098.31),
+      SIMDE_FLOAT32_C(  -853.06), SIMDE_FLOAT32_C(   -23.12), SIMDE_FLOAT32_C(   -91.57), SIMDE_FLOAT32_C(     4.34),
+      SIMDE_FLOAT32_C( -2365.54), SIMDE_FLOAT32_C(    51.16), SIMDE_FLOAT32_C(    93.83), SIMDE_FLOAT32_C(   -60.59),
+      SIMDE_FLOAT32_C(  2563.44), SIMDE_FLOAT32_C(  2007.50), SIMDE_FLOAT32_C(   612.33), SIMDE_FLOAT32_C(   991.65),
+      SIMDE_FLOAT32_C( -2217.64), SIMDE_FLOAT32_C(   -12.57), SIMDE_FLOAT32_C(   -91.15), SIMDE_FLOAT32_C(    36.09),
+      SIMDE_FLOAT32_C(  1553.44), SIMDE_FLOAT32_C(   841.89), SIMDE_FLOAT32_C(    93.69), SIMDE_FLOAT32_C(  -898.28),
+      SIMDE_FLOAT32_C(  -363.62), SIMDE_FLOAT32_C(    85.23), SIMDE_FLOAT32_C(   128.48), SIMDE_FLOAT32_C(    42.02),
+      SIMDE_FLOAT32_C(   449.81), SIMDE_FLOAT32_C(    29.09), SIMDE_FLOAT32_C(     4.64), SIMDE_FLOAT32_C(  -257.22),
+      SIMDE_FLOAT32_C( -1020.38), SIMDE_FLOAT32_C( -1427.89), SIMDE_FLOAT32_C(   -68.38), SIMDE_FLOAT32_C(    29.57),
+      SIMDE_FLOAT32_C(    23.21), SIMDE_FLOAT32_C( -1594.67), SIMDE_FLOAT32_C( -1757.73), SIMDE_FLOAT32_C(   911.85),
+      SIMDE_FLOAT32_C(  2425.92), SIMDE_FLOAT32_C( -1922.12), SIMDE_FLOAT32_C(    73.69), SIMDE_FLOAT32_C(    87.58),
+      SIMDE_FLOAT32_C(   -96.79), SIMDE_FLOAT32_C(   -87.51), SIMDE_FLOAT32_C(   661.28), SIMDE_FLOAT32_C(   -80.16),
+      SIMDE_FLOAT32_C(    84.14), SIMDE_FLOAT32_C(   896.69), SIMDE_FLOAT32_C(  1487.74), SIMDE_FLOAT32_C(  1131.56),
+      SIMDE_FLOAT32_C(  -921.42), SIMDE_FLOAT32_C(  1319.89), SIMDE_FLOAT32_C( -2426.72), SIMDE_FLOAT32_C(    51.69),
+      SIMDE_FLOAT32_C(   927.01), SIMDE_FLOAT32_C(   361.76), SIMDE_FLOAT32_C(    -6.29), SIMDE_FLOAT32_C(   -48.23),
+      SIMDE_FLOAT32_C( -1524.45), SIMDE_FLOAT32_C(  2616.11), SIMDE_FLOAT32_C(  1119.86), SIMDE_FLOAT32_C(     4.33),
+      SIMDE_FLOAT32_C( -1471.78), SIMDE_FLOAT32_C(    73.72), SIMDE_FLOAT32_C(   -66.10), SIMDE_FLOAT32_C(    67.88),
+      SIMDE_FLOAT32_C(   -86.24), SIMDE_FLOAT32_C(  -855.99), SIMDE_FLOAT32_C(     2.16), SIMDE_FLOAT32_C( -2528.06),
+      SIMDE_FLOAT32_C(    -4.44), SIMDE_FLOAT32_C(   -24.16), SIMDE_FLOAT32_C(    92.54), SIMDE_FLOAT32_C(   -32.72),
+      SIMDE_FLOAT32_C(  1929.83), SIMDE_FLOAT32_C(   462.84), SIMDE_FLOAT32_C(    18.61), SIMDE_FLOAT32_C(    56.68),
+      SIMDE_FLOAT32_C(   -48.89), SIMDE_FLOAT32_C(   -25.45), SIMDE_FLOAT32_C(   -20.75), SIMDE_FLOAT32_C(   438.10),
+      SIMDE_FLOAT32_C( -2017.08), SIMDE_FLOAT32_C(   212.80), SIMDE_FLOAT32_C(   -31.84), SIMDE_FLOAT32_C(    59.02),
+      SIMDE_FLOAT32_C( -2085.44), SIMDE_FLOAT32_C(  1645.74), SIMDE_FLOAT32_C( -2373.25), SIMDE_FLOAT32_C(  -949.89),
+      SIMDE_FLOAT32_C(  1601.85), SIMDE_FLOAT32_C(    52.88), SIMDE_FLOAT32_C(  1825.29), SIMDE_FLOAT32_C(   -95.11) };
+
+  static simde_float32 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t
+      rv,
+      av = simde_svld1_f32(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+    rv = simde_svmul_n_f32_m(pv, av, b);
+
+    simde_svst1_f32(pg, &(r[i]), rv);
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vf32(len, e, r, 1);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  simde_float32 a[1024 / sizeof(int32_t)], b, e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf32(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+  b = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svfloat32_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(0));
+    av = simde_svld1_f32(pg, &(a[i]));
+
+    ev = simde_svmul_n_f32_m(pv, av, b);
+
+    simde_svst1_f32(pg, &(e[i]), ev);
+    simde_svst1_s32(pg, &(p[i]), simde_svdup_n_s32_z(pv, ~INT32_C(0)));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f32(1, b);
+  simde_test_codegen_write_1vf32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_f64_z (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(    19.11), SIMDE_FLOAT64_C(   -28.53), SIMDE_FLOAT64_C(    92.93), SIMDE_FLOAT64_C(   -87.87),
+      SIMDE_FLOAT64_C(    57.98), SIMDE_FLOAT64_C(   -43.70), SIMDE_FLOAT64_C(    13.41), SIMDE_FLOAT64_C(    53.21),
+      SIMDE_FLOAT64_C(    20.44), SIMDE_FLOAT64_C(    -6.39), SIMDE_FLOAT64_C(     7.54), SIMDE_FLOAT64_C(   -49.29),
+      SIMDE_FLOAT64_C(   -21.80), SIMDE_FLOAT64_C(   -99.97), SIMDE_FLOAT64_C(   -40.37), SIMDE_FLOAT64_C(    42.39),
+      SIMDE_FLOAT64_C(    64.29), SIMDE_FLOAT64_C(   -99.43), SIMDE_FLOAT64_C(    39.03), SIMDE_FLOAT64_C(    61.37),
+      SIMDE_FLOAT64_C(    79.49), SIMDE_FLOAT64_C(   -60.42), SIMDE_FLOAT64_C(    26.04), SIMDE_FLOAT64_C(   -33.82),
+      SIMDE_FLOAT64_C(    88.78), SIMDE_FLOAT64_C(     6.91), SIMDE_FLOAT64_C(    97.81), SIMDE_FLOAT64_C(   -52.28),
+      SIMDE_FLOAT64_C(   -17.36), SIMDE_FLOAT64_C(   -65.92), SIMDE_FLOAT64_C(    86.06), SIMDE_FLOAT64_C(   -98.25),
+      SIMDE_FLOAT64_C(     5.55), SIMDE_FLOAT64_C(    79.00), SIMDE_FLOAT64_C(   -86.12), SIMDE_FLOAT64_C(   -36.47),
+      SIMDE_FLOAT64_C(   -64.70), SIMDE_FLOAT64_C(    27.29), SIMDE_FLOAT64_C(   -83.26), SIMDE_FLOAT64_C(    55.74),
+      SIMDE_FLOAT64_C(   -79.10), SIMDE_FLOAT64_C(    24.28), SIMDE_FLOAT64_C(   -93.55), SIMDE_FLOAT64_C(    -0.90),
+      SIMDE_FLOAT64_C(    24.32), SIMDE_FLOAT64_C(   -33.92), SIMDE_FLOAT64_C(   -58.51), SIMDE_FLOAT64_C(   -11.39),
+      SIMDE_FLOAT64_C(   -33.35), SIMDE_FLOAT64_C(    80.52), SIMDE_FLOAT64_C(   -50.01), SIMDE_FLOAT64_C(   -53.86),
+      SIMDE_FLOAT64_C(   -79.90), SIMDE_FLOAT64_C(    76.03), SIMDE_FLOAT64_C(    12.32), SIMDE_FLOAT64_C(   -91.11),
+      SIMDE_FLOAT64_C(   -17.07), SIMDE_FLOAT64_C(    10.13), SIMDE_FLOAT64_C(   -43.39), SIMDE_FLOAT64_C(    65.57),
+      SIMDE_FLOAT64_C(    44.21), SIMDE_FLOAT64_C(   -57.33), SIMDE_FLOAT64_C(    67.31), SIMDE_FLOAT64_C(   -50.24),
+      SIMDE_FLOAT64_C(   -78.33), SIMDE_FLOAT64_C(    81.19), SIMDE_FLOAT64_C(    13.30), SIMDE_FLOAT64_C(   -43.03),
+      SIMDE_FLOAT64_C(     8.48), SIMDE_FLOAT64_C(    30.04), SIMDE_FLOAT64_C(   -87.29), SIMDE_FLOAT64_C(    29.38),
+      SIMDE_FLOAT64_C(   -45.68), SIMDE_FLOAT64_C(   -80.84), SIMDE_FLOAT64_C(   -71.52), SIMDE_FLOAT64_C(    78.64),
+      SIMDE_FLOAT64_C(   -14.77), SIMDE_FLOAT64_C(   -30.03), SIMDE_FLOAT64_C(   -32.74), SIMDE_FLOAT64_C(    51.89),
+      SIMDE_FLOAT64_C(   -49.51), SIMDE_FLOAT64_C(    17.24), SIMDE_FLOAT64_C(    98.03), SIMDE_FLOAT64_C(   -29.40),
+      SIMDE_FLOAT64_C(    -6.73), SIMDE_FLOAT64_C(    10.35), SIMDE_FLOAT64_C(   -20.51), SIMDE_FLOAT64_C(    76.20),
+      SIMDE_FLOAT64_C(   -79.52), SIMDE_FLOAT64_C(    36.10), SIMDE_FLOAT64_C(    41.77), SIMDE_FLOAT64_C(    64.69) };
+  static const simde_float64 b = SIMDE_FLOAT64_C(    78.77);
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(  1505.29), SIMDE_FLOAT64_C( -2247.31), SIMDE_FLOAT64_C(  7320.10), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -3442.25), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(  1610.06), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   593.93), SIMDE_FLOAT64_C( -3882.57),
+      SIMDE_FLOAT64_C( -1717.19), SIMDE_FLOAT64_C( -7874.64), SIMDE_FLOAT64_C( -3179.94), SIMDE_FLOAT64_C(  3339.06),
+      SIMDE_FLOAT64_C(  5064.12), SIMDE_FLOAT64_C( -7832.10), SIMDE_FLOAT64_C(  3074.39), SIMDE_FLOAT64_C(  4834.11),
+      SIMDE_FLOAT64_C(  6261.43), SIMDE_FLOAT64_C( -4759.28), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -2664.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -4118.10),
+      SIMDE_FLOAT64_C( -1367.45), SIMDE_FLOAT64_C( -5192.52), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -7739.15),
+      SIMDE_FLOAT64_C(   437.17), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -2872.74),
+      SIMDE_FLOAT64_C( -5096.42), SIMDE_FLOAT64_C(  2149.63), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -6230.71), SIMDE_FLOAT64_C(  1912.54), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -4608.83), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -2626.98), SIMDE_FLOAT64_C(  6342.56), SIMDE_FLOAT64_C( -3939.29), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -6293.72), SIMDE_FLOAT64_C(  5988.88), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -7176.73),
+      SIMDE_FLOAT64_C( -1344.60), SIMDE_FLOAT64_C(   797.94), SIMDE_FLOAT64_C( -3417.83), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -4515.88), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -6170.05), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  1047.64), SIMDE_FLOAT64_C( -3389.47),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C( -6875.83), SIMDE_FLOAT64_C(  2314.26),
+      SIMDE_FLOAT64_C( -3598.21), SIMDE_FLOAT64_C( -6367.77), SIMDE_FLOAT64_C( -5633.63), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C( -1163.43), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  7721.82), SIMDE_FLOAT64_C( -2315.84),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   815.27), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  6002.27),
+      SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  2843.60), SIMDE_FLOAT64_C(  3290.22), SIMDE_FLOAT64_C(     0.00) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_n_f64_z(pv, av, b);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  b = simde_test_codegen_random_f64(SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    ev = simde_svmul_n_f64_z(pv, av, b);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svmul_n_f64_m (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+       INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),
+       INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+      -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+      -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) };
+  static const simde_float64 a[] =
+    { SIMDE_FLOAT64_C(   -20.59), SIMDE_FLOAT64_C(    74.74), SIMDE_FLOAT64_C(    -5.85), SIMDE_FLOAT64_C(    98.90),
+      SIMDE_FLOAT64_C(    71.91), SIMDE_FLOAT64_C(   -44.53), SIMDE_FLOAT64_C(    50.60), SIMDE_FLOAT64_C(    15.94),
+      SIMDE_FLOAT64_C(   -94.48), SIMDE_FLOAT64_C(   -83.27), SIMDE_FLOAT64_C(   -15.21), SIMDE_FLOAT64_C(    -9.59),
+      SIMDE_FLOAT64_C(   -47.42), SIMDE_FLOAT64_C(   -68.50), SIMDE_FLOAT64_C(   -56.57), SIMDE_FLOAT64_C(    33.78),
+      SIMDE_FLOAT64_C(   -55.03), SIMDE_FLOAT64_C(   -70.57), SIMDE_FLOAT64_C(    59.08), SIMDE_FLOAT64_C(    61.86),
+      SIMDE_FLOAT64_C(    80.24), SIMDE_FLOAT64_C(    45.26), SIMDE_FLOAT64_C(   -74.93), SIMDE_FLOAT64_C(   -61.20),
+      SIMDE_FLOAT64_C(   -67.33), SIMDE_FLOAT64_C(   -74.13), SIMDE_FLOAT64_C(    65.01), SIMDE_FLOAT64_C(    61.51),
+      SIMDE_FLOAT64_C(   -91.00), SIMDE_FLOAT64_C(   -15.35), SIMDE_FLOAT64_C(    24.79), SIMDE_FLOAT64_C(   -11.59),
+      SIMDE_FLOAT64_C(   -40.61), SIMDE_FLOAT64_C(   -81.06), SIMDE_FLOAT64_C(   -12.70), SIMDE_FLOAT64_C(   -68.70),
+      SIMDE_FLOAT64_C(   -25.59), SIMDE_FLOAT64_C(   -62.10), SIMDE_FLOAT64_C(    47.25), SIMDE_FLOAT64_C(   -20.07),
+      SIMDE_FLOAT64_C(   -45.36), SIMDE_FLOAT64_C(   -67.96), SIMDE_FLOAT64_C(    70.34), SIMDE_FLOAT64_C(     7.22),
+      SIMDE_FLOAT64_C(   -36.47), SIMDE_FLOAT64_C(   -86.23), SIMDE_FLOAT64_C(   -59.00), SIMDE_FLOAT64_C(     8.50),
+      SIMDE_FLOAT64_C(   -56.80), SIMDE_FLOAT64_C(   -99.92), SIMDE_FLOAT64_C(   -29.64), SIMDE_FLOAT64_C(   -76.56),
+      SIMDE_FLOAT64_C(    45.33), SIMDE_FLOAT64_C(    -4.56), SIMDE_FLOAT64_C(   -37.76), SIMDE_FLOAT64_C(    78.01),
+      SIMDE_FLOAT64_C(    21.31), SIMDE_FLOAT64_C(   -72.75), SIMDE_FLOAT64_C(    39.52), SIMDE_FLOAT64_C(    30.31),
+      SIMDE_FLOAT64_C(    11.90), SIMDE_FLOAT64_C(   -35.69), SIMDE_FLOAT64_C(   -81.28), SIMDE_FLOAT64_C(    71.29),
+      SIMDE_FLOAT64_C(   -16.75), SIMDE_FLOAT64_C(     6.02), SIMDE_FLOAT64_C(   -97.41), SIMDE_FLOAT64_C(    57.66),
+      SIMDE_FLOAT64_C(    43.92), SIMDE_FLOAT64_C(    49.84), SIMDE_FLOAT64_C(   -62.41), SIMDE_FLOAT64_C(    98.55),
+      SIMDE_FLOAT64_C(    81.87), SIMDE_FLOAT64_C(   -92.07), SIMDE_FLOAT64_C(     5.77), SIMDE_FLOAT64_C(   -54.59),
+      SIMDE_FLOAT64_C(   -78.30), SIMDE_FLOAT64_C(    46.77), SIMDE_FLOAT64_C(    53.91), SIMDE_FLOAT64_C(   -35.10),
+      SIMDE_FLOAT64_C(    46.84), SIMDE_FLOAT64_C(   -75.73), SIMDE_FLOAT64_C(   -11.66) };
+  static const simde_float64 b = SIMDE_FLOAT64_C(    -7.82);
+  static const simde_float64 e[] =
+    { SIMDE_FLOAT64_C(   -20.59), SIMDE_FLOAT64_C(  -584.47), SIMDE_FLOAT64_C(    -5.85), SIMDE_FLOAT64_C(    98.90),
+      SIMDE_FLOAT64_C(    71.91), SIMDE_FLOAT64_C(   348.22), SIMDE_FLOAT64_C(    50.60), SIMDE_FLOAT64_C(  -124.65),
+      SIMDE_FLOAT64_C(   -94.48), SIMDE_FLOAT64_C(   651.17), SIMDE_FLOAT64_C(   118.94), SIMDE_FLOAT64_C(    -9.59),
+      SIMDE_FLOAT64_C(   -47.42), SIMDE_FLOAT64_C(   -68.50), SIMDE_FLOAT64_C(   442.38), SIMDE_FLOAT64_C(  -264.16),
+      SIMDE_FLOAT64_C(   430.33), SIMDE_FLOAT64_C(   551.86), SIMDE_FLOAT64_C(    59.08), SIMDE_FLOAT64_C(  -483.75),
+      SIMDE_FLOAT64_C(    80.24), SIMDE_FLOAT64_C(  -353.93), SIMDE_FLOAT64_C(   585.95), SIMDE_FLOAT64_C(   -61.20),
+      SIMDE_FLOAT64_C(   526.52), SIMDE_FLOAT64_C(   -74.13), SIMDE_FLOAT64_C(    65.01), SIMDE_FLOAT64_C(    61.51),
+      SIMDE_FLOAT64_C(   -91.00), SIMDE_FLOAT64_C(   -15.35), SIMDE_FLOAT64_C(  -193.86), SIMDE_FLOAT64_C(   -11.59),
+      SIMDE_FLOAT64_C(   317.57), SIMDE_FLOAT64_C(   -81.06), SIMDE_FLOAT64_C(   -12.70), SIMDE_FLOAT64_C(   537.23),
+      SIMDE_FLOAT64_C(   -25.59), SIMDE_FLOAT64_C(   485.62), SIMDE_FLOAT64_C(  -369.50), SIMDE_FLOAT64_C(   -20.07),
+      SIMDE_FLOAT64_C(   354.72), SIMDE_FLOAT64_C(   531.45), SIMDE_FLOAT64_C(  -550.06), SIMDE_FLOAT64_C(   -56.46),
+      SIMDE_FLOAT64_C(   285.20), SIMDE_FLOAT64_C(   674.32), SIMDE_FLOAT64_C(   461.38), SIMDE_FLOAT64_C(     8.50),
+      SIMDE_FLOAT64_C(   444.18), SIMDE_FLOAT64_C(   781.37), SIMDE_FLOAT64_C(   231.78), SIMDE_FLOAT64_C(   -76.56),
+      SIMDE_FLOAT64_C(  -354.48), SIMDE_FLOAT64_C(    -4.56), SIMDE_FLOAT64_C(   -37.76), SIMDE_FLOAT64_C(    78.01),
+      SIMDE_FLOAT64_C(  -166.64), SIMDE_FLOAT64_C(   568.90), SIMDE_FLOAT64_C(  -309.05), SIMDE_FLOAT64_C(    30.31),
+      SIMDE_FLOAT64_C(   -93.06), SIMDE_FLOAT64_C(   -35.69), SIMDE_FLOAT64_C(   -81.28), SIMDE_FLOAT64_C(  -557.49),
+      SIMDE_FLOAT64_C(   -16.75), SIMDE_FLOAT64_C(     6.02), SIMDE_FLOAT64_C(   -97.41), SIMDE_FLOAT64_C(  -450.90),
+      SIMDE_FLOAT64_C(    43.92), SIMDE_FLOAT64_C(  -389.75), SIMDE_FLOAT64_C(   -62.41), SIMDE_FLOAT64_C(  -770.66),
+      SIMDE_FLOAT64_C(    81.87), SIMDE_FLOAT64_C(   -92.07), SIMDE_FLOAT64_C(     5.77), SIMDE_FLOAT64_C(   -54.59),
+      SIMDE_FLOAT64_C(   612.31), SIMDE_FLOAT64_C(    46.77), SIMDE_FLOAT64_C(  -421.58), SIMDE_FLOAT64_C(   -35.10),
+      SIMDE_FLOAT64_C(  -366.29), SIMDE_FLOAT64_C(   592.21), SIMDE_FLOAT64_C(    91.18) };
+
+  static simde_float64 r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t
+      rv,
+      av = simde_svld1_f64(pg, &(a[i]));
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+    rv = simde_svmul_n_f64_m(pv, av, b);
+
+    simde_svst1_f64(pg, &(r[i]), rv);
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vf64(len, e, r, 1);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  simde_float64 a[1024 / sizeof(int64_t)], b, e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(e), sizeof(e[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_vf64(HEDLEY_STATIC_CAST(size_t, len), a, SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+  b = simde_test_codegen_random_f64(SIMDE_FLOAT64_C(-100.0), SIMDE_FLOAT64_C(100.0));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svfloat64_t av, ev;
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(0));
+    av = simde_svld1_f64(pg, &(a[i]));
+
+    ev = simde_svmul_n_f64_m(pv, av, b);
+
+    simde_svst1_f64(pg, &(e[i]), ev);
+    simde_svst1_s64(pg, &(p[i]), simde_svdup_n_s64_z(pv, ~INT64_C(0)));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1f64(1, b);
+  simde_test_codegen_write_1vf64(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_f64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_s64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u8_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u8_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u16_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u16_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_u64_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_f32_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_f32_m)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_f64_z)
+SIMDE_TEST_FUNC_LIST_ENTRY(svmul_n_f64_m)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
@@ -0,0 +1,191 @@
+#define SIMDE_TEST_ARM_SVE_INSN ptest
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/ptest.h"
+
+#include "../../../simde/arm/sve/whilelt.h"
+
+static int
+test_simde_svptest_any (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t pg_op1;
+    int32_t pg_op2;
+    int32_t op_op1;
+    int32_t op_op2;
+  } test_vec[] = {
+    { INT32_C(   0), INT32_C(   0), INT32_C(   0), INT32_C(   8) },
+    { INT32_C(   0), INT32_C(   8), INT32_C(   0), INT32_C(   0) },
+    { INT32_C(   0), INT32_C(   1), INT32_C(   0), INT32_C(   1) },
+    { INT32_C(   0), INT32_C(   3), INT32_C(   0), INT32_C(   5) },
+    { INT32_C(   0), INT32_C(   5), INT32_C(   0), INT32_C(   3) },
+    { INT32_C(   2), INT32_C(   9), INT32_C(   0), INT32_C(   7) },
+    { INT32_C(   0), INT32_C(   7), INT32_C(   3), INT32_C(   9) },
+    { INT32_C(   0), INT32_C(  64), INT32_C(   0), INT32_C(  64) },
+    { INT32_C(   0), INT32_C(1000), INT32_C(   0), INT32_C( 999) },
+    { INT32_C(   0), INT32_C(1000), INT32_C(   0), INT32_C(2000) },
+    { INT32_C(   0), INT32_C(2000), INT32_C(   0), INT32_C(1000) },
+    { INT32_C(   4), INT32_C(   4), INT32_C(   0), INT32_C(1000) },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntb());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_any(simde_svwhilelt_b8_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b8_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcnth());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_any(simde_svwhilelt_b16_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b16_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntw());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_any(simde_svwhilelt_b32_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b32_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntd());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_any(simde_svwhilelt_b64_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b64_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svptest_first (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t pg_op1;
+    int32_t pg_op2;
+    int32_t op_op1;
+    int32_t op_op2;
+  } test_vec[] = {
+    { INT32_C(   0), INT32_C(   0), INT32_C(   0), INT32_C(   8) },
+    { INT32_C(   0), INT32_C(   8), INT32_C(   0), INT32_C(   0) },
+    { INT32_C(   0), INT32_C(   1), INT32_C(   0), INT32_C(   1) },
+    { INT32_C(   0), INT32_C(   3), INT32_C(   0), INT32_C(   5) },
+    { INT32_C(   0), INT32_C(   5), INT32_C(   0), INT32_C(   3) },
+    { INT32_C(   2), INT32_C(   9), INT32_C(   0), INT32_C(   7) },
+    { INT32_C(   0), INT32_C(   7), INT32_C(   3), INT32_C(   9) },
+    { INT32_C(   0), INT32_C(  64), INT32_C(   0), INT32_C(  64) },
+    { INT32_C(   0), INT32_C(1000), INT32_C(   0), INT32_C( 999) },
+    { INT32_C(   0), INT32_C(1000), INT32_C(   0), INT32_C(2000) },
+    { INT32_C(   0), INT32_C(2000), INT32_C(   0), INT32_C(1000) },
+    { INT32_C(   4), INT32_C(   4), INT32_C(   0), INT32_C(1000) },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntb());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_first(simde_svwhilelt_b8_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b8_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcnth());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_first(simde_svwhilelt_b16_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b16_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntw());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_first(simde_svwhilelt_b32_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b32_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntd());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_first(simde_svwhilelt_b64_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b64_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o > 0), !!r);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svptest_last (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t pg_op1;
+    int32_t pg_op2;
+    int32_t op_op1;
+    int32_t op_op2;
+  } test_vec[] = {
+    { INT32_C(   0), INT32_C(   0), INT32_C(   0), INT32_C(   8) },
+    { INT32_C(   0), INT32_C(   8), INT32_C(   0), INT32_C(   0) },
+    { INT32_C(   0), INT32_C(   1), INT32_C(   0), INT32_C(   1) },
+    { INT32_C(   0), INT32_C(   3), INT32_C(   0), INT32_C(   5) },
+    { INT32_C(   0), INT32_C(   5), INT32_C(   0), INT32_C(   3) },
+    { INT32_C(   2), INT32_C(   9), INT32_C(   0), INT32_C(   7) },
+    { INT32_C(   0), INT32_C(   7), INT32_C(   3), INT32_C(   9) },
+    { INT32_C(   0), INT32_C(  64), INT32_C(   0), INT32_C(  64) },
+    { INT32_C(   0), INT32_C(1000), INT32_C(   0), INT32_C( 999) },
+    { INT32_C(   0), INT32_C(1000), INT32_C(   0), INT32_C(2000) },
+    { INT32_C(   0), INT32_C(2000), INT32_C(   0), INT32_C(1000) },
+    { INT32_C(   4), INT32_C(   4), INT32_C(   0), INT32_C(1000) },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntb());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_last(simde_svwhilelt_b8_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b8_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o >= p), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcnth());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_last(simde_svwhilelt_b16_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b16_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o >= p), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntw());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_last(simde_svwhilelt_b32_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b32_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o >= p), !!r);
+    }
+
+    {
+      const int32_t n = HEDLEY_STATIC_CAST(int32_t, simde_svcntd());
+      const int32_t dp = test_vec[i].pg_op2 - test_vec[i].pg_op1, p = (dp < 0) ? 0 : ((dp > n) ? n : dp);
+      const int32_t d_o = test_vec[i].op_op2 - test_vec[i].op_op1, o = (d_o < 0) ? 0 : ((d_o > n) ? n : d_o);
+      simde_bool r = simde_svptest_last(simde_svwhilelt_b64_s32(test_vec[i].pg_op1, test_vec[i].pg_op2), simde_svwhilelt_b64_s32(test_vec[i].op_op1, test_vec[i].op_op2));
+      simde_assert_equal_i((p > 0) && (o >= p), !!r);
+    }
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svptest_any)
+SIMDE_TEST_FUNC_LIST_ENTRY(svptest_first)
+SIMDE_TEST_FUNC_LIST_ENTRY(svptest_last)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
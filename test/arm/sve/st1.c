@@ -0,0 +1,2043 @@
+#define SIMDE_TEST_ARM_SVE_INSN st1
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/st1.h"
+
+#include "../../../simde/arm/sve/cmplt.h"
+#include "../../../simde/arm/sve/dup.h"
+#include "../../../simde/arm/sve/ld1.h"
+#include "../../../simde/arm/sve/ptest.h"
+#include "../../../simde/arm/sve/whilelt.h"
+
+static int
+test_simde_svst1b_s16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C( 29889),  INT16_C( 13985), -INT16_C(  8526), -INT16_C( 25820),  INT16_C(   301),  INT16_C(  9260),  INT16_C( 13503), -INT16_C( 25607),
+       INT16_C( 12481),  INT16_C( 19261),  INT16_C( 11827),  INT16_C( 25602), -INT16_C(  8469), -INT16_C( 10724), -INT16_C( 13018),  INT16_C( 25998),
+       INT16_C( 12120),  INT16_C(  2716), -INT16_C( 16371),  INT16_C( 15014), -INT16_C( 11582), -INT16_C( 32417),  INT16_C( 22534), -INT16_C( 14308),
+       INT16_C( 23176), -INT16_C( 17645),  INT16_C(  5512),  INT16_C( 29728),  INT16_C( 15603),  INT16_C(  6730), -INT16_C( 10231),  INT16_C( 25215),
+       INT16_C(  6919),  INT16_C(  5228),  INT16_C(  4828), -INT16_C( 25010), -INT16_C( 21019), -INT16_C(  5345),  INT16_C( 15109), -INT16_C( 29005),
+      -INT16_C( 14699),  INT16_C(  7753),  INT16_C( 27099), -INT16_C( 12398), -INT16_C(  9051), -INT16_C( 20503),  INT16_C( 26804), -INT16_C( 17647),
+       INT16_C( 32132),  INT16_C( 24783),  INT16_C(  7568),  INT16_C( 30206),  INT16_C(  7627), -INT16_C( 12192),  INT16_C(  5208), -INT16_C(  4514),
+      -INT16_C( 22310), -INT16_C( 18932), -INT16_C( 25071), -INT16_C( 18555),  INT16_C( 28282),  INT16_C( 11878),  INT16_C( 30678),  INT16_C( 23273),
+      -INT16_C( 18188), -INT16_C( 31558), -INT16_C( 18219), -INT16_C( 24327),  INT16_C( 23253),  INT16_C( 11889), -INT16_C( 12434),  INT16_C( 18460),
+       INT16_C( 10359), -INT16_C( 30210), -INT16_C( 31802),  INT16_C( 16448), -INT16_C( 22799), -INT16_C( 14226),  INT16_C( 22301),  INT16_C(  4386),
+      -INT16_C(  8945), -INT16_C(  7018), -INT16_C( 28779),  INT16_C( 27525), -INT16_C(  2327),  INT16_C( 22425), -INT16_C( 19003),  INT16_C( 15776),
+      -INT16_C( 24867), -INT16_C( 23610),  INT16_C(  1570),  INT16_C(  5091),  INT16_C( 20908), -INT16_C( 13861), -INT16_C(   344), -INT16_C( 18470),
+       INT16_C( 28891),  INT16_C( 28827),  INT16_C(  8192), -INT16_C(  5669),  INT16_C( 29718), -INT16_C(  9151), -INT16_C(  7895),  INT16_C(  1561),
+      -INT16_C(  8321), -INT16_C( 24151), -INT16_C( 29467), -INT16_C( 28235), -INT16_C( 28451), -INT16_C( 31398),  INT16_C( 13454),  INT16_C( 26940),
+      -INT16_C( 10075), -INT16_C( 23078), -INT16_C( 18952),  INT16_C(  3982), -INT16_C( 12502),  INT16_C( 21483),  INT16_C(  1200),  INT16_C( 12378),
+       INT16_C(   995), -INT16_C( 14127), -INT16_C( 31088),  INT16_C( 27993), -INT16_C( 19689), -INT16_C( 23053),  INT16_C( 12263), -INT16_C( 29681),
+      -INT16_C(  5881),  INT16_C(    49), -INT16_C( 16226), -INT16_C( 14321), -INT16_C(  1393),  INT16_C( 16412),  INT16_C( 30462), -INT16_C(  7824),
+       INT16_C( 16761),  INT16_C(  2473),  INT16_C(   712), -INT16_C(  8329),  INT16_C( 27317), -INT16_C( 25468), -INT16_C( 27751), -INT16_C( 24279),
+       INT16_C( 23164),  INT16_C(  7073), -INT16_C( 20454), -INT16_C( 21789), -INT16_C(    86), -INT16_C( 22294),  INT16_C( 23157), -INT16_C(  4215),
+       INT16_C( 12955),  INT16_C( 25592),  INT16_C( 28468), -INT16_C(  5822), -INT16_C( 14375),  INT16_C( 29573), -INT16_C( 20902), -INT16_C( 10476),
+      -INT16_C( 19191),  INT16_C(  9202), -INT16_C( 10907),  INT16_C(  4045), -INT16_C( 18475),  INT16_C( 19127),  INT16_C( 16401), -INT16_C( 21191),
+       INT16_C( 12914), -INT16_C( 23024),  INT16_C( 21409),  INT16_C( 31631),  INT16_C(  5146),  INT16_C( 29934),  INT16_C(   707), -INT16_C( 13237),
+       INT16_C( 15799),  INT16_C(  7407), -INT16_C( 17133), -INT16_C(  6101), -INT16_C(  7564), -INT16_C( 31182),  INT16_C( 27682), -INT16_C( 27597),
+       INT16_C( 17310),  INT16_C( 16186), -INT16_C( 13930), -INT16_C( 20294), -INT16_C( 22307), -INT16_C( 24539),  INT16_C( 28842),  INT16_C( 24940),
+       INT16_C( 23726), -INT16_C( 16003), -INT16_C( 22503), -INT16_C( 29271), -INT16_C(  9334), -INT16_C( 21485),  INT16_C( 17991), -INT16_C(  6848),
+       INT16_C( 31370),  INT16_C(  8229), -INT16_C(  8381),  INT16_C(  8657), -INT16_C(  2424),  INT16_C( 12993),  INT16_C( 11878),  INT16_C(  5268),
+       INT16_C(  4490), -INT16_C( 23595),  INT16_C( 32442),  INT16_C( 17456),  INT16_C( 17498), -INT16_C( 24079),  INT16_C( 12682),  INT16_C(  5255),
+      -INT16_C( 21332), -INT16_C(  4299),  INT16_C(  1675),  INT16_C(  4880), -INT16_C( 11524),  INT16_C( 25158), -INT16_C(  9728), -INT16_C( 30089),
+       INT16_C( 19691), -INT16_C( 23251),  INT16_C( 24011),  INT16_C(  9706), -INT16_C(  9311),  INT16_C( 11462),  INT16_C( 19724), -INT16_C( 18368),
+       INT16_C( 30201), -INT16_C( 31320), -INT16_C( 18309),  INT16_C( 30616), -INT16_C(  8566), -INT16_C( 29990),  INT16_C( 20920), -INT16_C( 23532),
+       INT16_C( 16797),  INT16_C( 26697),  INT16_C( 13215),  INT16_C( 16525),  INT16_C( 21518),  INT16_C(  7020), -INT16_C( 21087), -INT16_C( 25645),
+       INT16_C( 31522), -INT16_C( 25056), -INT16_C( 18380), -INT16_C( 16875), -INT16_C(  4201),  INT16_C( 20297),  INT16_C( 23872), -INT16_C(  8461),
+       INT16_C( 15775),  INT16_C( 15942), -INT16_C( 11152),  INT16_C( 32638), -INT16_C(  5336), -INT16_C( 13926),  INT16_C( 28056), -INT16_C( 17820),
+      -INT16_C( 31511),  INT16_C(  7512),  INT16_C( 28221), -INT16_C( 11045),  INT16_C(  9309), -INT16_C( 25053),  INT16_C(  6018),  INT16_C(  8572),
+      -INT16_C( 15788), -INT16_C( 15265), -INT16_C(  8810), -INT16_C( 16829), -INT16_C(  8760),  INT16_C( 24712), -INT16_C(  5045),  INT16_C( 13339),
+       INT16_C( 29553), -INT16_C( 20911),  INT16_C( 11489),  INT16_C( 16258), -INT16_C( 23215), -INT16_C( 11299),  INT16_C( 22972),  INT16_C(  4340),
+       INT16_C( 21275), -INT16_C( 19755),  INT16_C(  6192), -INT16_C(  1680), -INT16_C(  1802),  INT16_C( 16729),  INT16_C( 29925),  INT16_C( 22133),
+      -INT16_C( 14616), -INT16_C( 14076), -INT16_C( 30990),  INT16_C( 17160), -INT16_C(  6869), -INT16_C(  6122),  INT16_C(  2622),  INT16_C( 23288),
+      -INT16_C( 12963), -INT16_C( 29172),  INT16_C( 31974), -INT16_C(  9081), -INT16_C(  8075),  INT16_C( 23069), -INT16_C( 28075),  INT16_C( 15792),
+      -INT16_C( 19368),  INT16_C( 18950),  INT16_C(  3898),  INT16_C( 25998), -INT16_C( 23308),  INT16_C( 13133),  INT16_C( 18095),  INT16_C(  3213),
+      -INT16_C( 26349), -INT16_C(  1638),  INT16_C(  8469), -INT16_C( 29995), -INT16_C(  3582),  INT16_C( 22500), -INT16_C( 27516), -INT16_C(  9068),
+      -INT16_C( 26040), -INT16_C( 32217), -INT16_C( 19031), -INT16_C( 24856),  INT16_C( 13657),  INT16_C(  2257),  INT16_C( 24187), -INT16_C( 28907),
+      -INT16_C( 20489),  INT16_C(  3208),  INT16_C( 24273), -INT16_C( 11369),  INT16_C( 31568), -INT16_C( 10966), -INT16_C( 16880),  INT16_C( 22705),
+      -INT16_C( 10152),  INT16_C(   731), -INT16_C( 15475), -INT16_C(  6240),  INT16_C( 29176),  INT16_C( 29935),  INT16_C(  1231), -INT16_C( 14845),
+      -INT16_C( 29772), -INT16_C( 31278),  INT16_C( 27113),  INT16_C( 14936), -INT16_C( 32027), -INT16_C(  2801), -INT16_C( 16320), -INT16_C( 26547),
+       INT16_C( 10393),  INT16_C(  9882),  INT16_C( 15083), -INT16_C(  7155), -INT16_C(   597),  INT16_C( 31320),  INT16_C( 23297), -INT16_C( 19136),
+       INT16_C(  5094), -INT16_C( 12230), -INT16_C( 28036),  INT16_C( 24842),  INT16_C(  6420),  INT16_C( 21590), -INT16_C( 23335),  INT16_C( 29421),
+      -INT16_C( 30772), -INT16_C( 18279), -INT16_C( 22846),  INT16_C( 28060), -INT16_C(  2909), -INT16_C( 23064),  INT16_C( 10319),  INT16_C( 13658),
+      -INT16_C( 27333), -INT16_C( 18427),  INT16_C(  3879),  INT16_C( 15385),  INT16_C( 28712),  INT16_C(   656),  INT16_C( 32020), -INT16_C(  8076),
+       INT16_C(  3333), -INT16_C( 14440),  INT16_C( 13492),  INT16_C( 22324),  INT16_C(  7208),  INT16_C( 30716),  INT16_C( 22341), -INT16_C( 32595),
+      -INT16_C( 19732),  INT16_C(  4920),  INT16_C( 21186), -INT16_C(  5553), -INT16_C(  7998), -INT16_C( 10516),  INT16_C( 24925),  INT16_C( 25270),
+       INT16_C( 20334),  INT16_C(  8745),  INT16_C( 24195), -INT16_C( 21382),  INT16_C( 30330), -INT16_C( 16605), -INT16_C( 12083), -INT16_C( 18112),
+       INT16_C( 30851),  INT16_C( 17869),  INT16_C(  7370), -INT16_C( 29649),  INT16_C(  7420),  INT16_C( 23138),  INT16_C(  6525), -INT16_C(  5188),
+      -INT16_C(  6552), -INT16_C(  5362), -INT16_C( 30652), -INT16_C( 16745), -INT16_C( 17410), -INT16_C( 13186), -INT16_C( 16757),  INT16_C(  3717),
+       INT16_C( 21046),  INT16_C(   339), -INT16_C( 31889),  INT16_C( 27533), -INT16_C(  3937),  INT16_C(  7365), -INT16_C( 32247),  INT16_C( 28935),
+       INT16_C(  5480), -INT16_C( 21412), -INT16_C(  2915), -INT16_C( 25494), -INT16_C(  5969),  INT16_C( 14952), -INT16_C(  4698), -INT16_C(  8887),
+      -INT16_C( 25536), -INT16_C( 20514),  INT16_C( 27423), -INT16_C( 16870), -INT16_C(  8101),  INT16_C( 25818), -INT16_C(  7582), -INT16_C( 13611),
+       INT16_C( 13047), -INT16_C( 27274), -INT16_C(  8154), -INT16_C( 10959), -INT16_C( 26167),  INT16_C( 28431),  INT16_C( 22662), -INT16_C( 14772),
+       INT16_C( 10997),  INT16_C(  5237), -INT16_C( 28522), -INT16_C(  3629), -INT16_C( 21136), -INT16_C( 11690),  INT16_C( 11151), -INT16_C( 30820),
+       INT16_C(  4701), -INT16_C( 31972),  INT16_C( 19954), -INT16_C( 17576),  INT16_C( 26854),  INT16_C( 27691),  INT16_C( 30656), -INT16_C( 19149),
+      -INT16_C( 22366),  INT16_C( 14538), -INT16_C( 25288), -INT16_C( 22487),  INT16_C( 32586), -INT16_C(  9606),  INT16_C(  5803),  INT16_C(  2145),
+       INT16_C( 32040),  INT16_C(  7052) };
+  static const int16_t a[] =
+    {  INT16_C( 27848), -INT16_C(  3526),  INT16_C(  5097), -INT16_C(  6810), -INT16_C( 19353), -INT16_C( 11892),  INT16_C( 15203), -INT16_C( 28829),
+       INT16_C(  4471), -INT16_C( 26747),  INT16_C( 11157),  INT16_C(  6659),  INT16_C( 32237), -INT16_C(   231),  INT16_C( 12985), -INT16_C( 32503),
+       INT16_C( 17567), -INT16_C( 30605), -INT16_C(  9897), -INT16_C( 16787), -INT16_C(  1651), -INT16_C(  3953), -INT16_C(  3276), -INT16_C( 21633),
+       INT16_C(  1028), -INT16_C( 26302),  INT16_C( 17967),  INT16_C(  7603), -INT16_C( 13117),  INT16_C( 31772),  INT16_C(  9983), -INT16_C( 24835),
+       INT16_C( 29034), -INT16_C( 16090), -INT16_C( 27830), -INT16_C( 10112),  INT16_C(  3980), -INT16_C( 16184),  INT16_C( 18434),  INT16_C(  1644),
+      -INT16_C( 20916),  INT16_C( 31903),  INT16_C( 21492), -INT16_C( 18535), -INT16_C( 19169),  INT16_C(  7731),  INT16_C( 12763),  INT16_C( 17852),
+      -INT16_C(  7518), -INT16_C(  5113), -INT16_C( 30859),  INT16_C(   452), -INT16_C( 29290), -INT16_C( 26174),  INT16_C( 11989),  INT16_C(  8607),
+       INT16_C( 16348), -INT16_C( 11875),  INT16_C( 13970), -INT16_C( 20088), -INT16_C( 17172), -INT16_C( 14384), -INT16_C( 29459), -INT16_C( 28915),
+       INT16_C(  5231), -INT16_C(  7045),  INT16_C( 16539),  INT16_C( 12774), -INT16_C( 22323), -INT16_C( 23862),  INT16_C( 27350), -INT16_C( 19773),
+       INT16_C( 25001),  INT16_C( 15235),  INT16_C(  3223), -INT16_C( 31764), -INT16_C( 17208), -INT16_C( 19125),  INT16_C( 22601), -INT16_C( 18364),
+      -INT16_C( 16532),  INT16_C(  1948), -INT16_C( 32001), -INT16_C( 13256),  INT16_C(   810),  INT16_C(   110),  INT16_C( 12909),  INT16_C(  5811),
+       INT16_C( 13971),  INT16_C( 10833),  INT16_C( 15682),  INT16_C(  2734), -INT16_C(  1542),  INT16_C( 17343),  INT16_C(   849), -INT16_C( 16901),
+      -INT16_C( 26685), -INT16_C( 15676), -INT16_C(   998),  INT16_C( 17551), -INT16_C(   513),  INT16_C( 27717), -INT16_C(  2001), -INT16_C( 15742),
+      -INT16_C( 11474),  INT16_C( 29165), -INT16_C( 25839),  INT16_C(  2939),  INT16_C( 15252), -INT16_C(  6834),  INT16_C( 18750),  INT16_C(   418),
+       INT16_C( 26336), -INT16_C(  1340),  INT16_C( 21346),  INT16_C( 25151), -INT16_C( 31664), -INT16_C( 32562),  INT16_C( 20860), -INT16_C( 21950),
+       INT16_C( 12068),  INT16_C( 13595), -INT16_C( 26678),  INT16_C( 24128), -INT16_C( 28974),  INT16_C(  4163), -INT16_C(  6697), -INT16_C( 18414),
+      -INT16_C( 10677), -INT16_C( 20814), -INT16_C(  3799),  INT16_C( 30992), -INT16_C(  8587), -INT16_C(  3591),  INT16_C( 15407),  INT16_C( 21660),
+      -INT16_C( 18581),  INT16_C( 13961), -INT16_C( 13746),  INT16_C(  8340), -INT16_C( 10152),  INT16_C( 12337),  INT16_C( 17341),  INT16_C(  2536),
+      -INT16_C( 26087),  INT16_C( 17079), -INT16_C( 14452),  INT16_C(   443), -INT16_C( 19035), -INT16_C( 10765), -INT16_C( 28687),  INT16_C( 23593),
+      -INT16_C( 19898), -INT16_C( 27246),  INT16_C( 10108), -INT16_C( 10827), -INT16_C(  6401), -INT16_C( 17403), -INT16_C(  4823),  INT16_C( 17093),
+       INT16_C( 31879),  INT16_C(  4996),  INT16_C( 16451), -INT16_C(  5867),  INT16_C(  2293), -INT16_C(  6466), -INT16_C(  6249), -INT16_C(  8894),
+      -INT16_C( 10855),  INT16_C(  5746),  INT16_C( 10492), -INT16_C(  1045), -INT16_C(  4082),  INT16_C( 14519),  INT16_C( 32221),  INT16_C( 25722),
+      -INT16_C(     7),  INT16_C( 15736), -INT16_C( 29377),  INT16_C( 13350), -INT16_C(  7019),  INT16_C( 11290),  INT16_C( 23755),  INT16_C( 25609),
+       INT16_C( 31793),  INT16_C( 11642),  INT16_C( 26020), -INT16_C( 19928), -INT16_C(  8107),  INT16_C( 13034),  INT16_C( 25949),  INT16_C( 22167),
+       INT16_C(  3940), -INT16_C( 23661), -INT16_C( 18020),  INT16_C( 12759), -INT16_C(  3683),  INT16_C( 26717),  INT16_C( 26189),  INT16_C( 32717),
+       INT16_C( 18402), -INT16_C( 31060), -INT16_C( 10835),  INT16_C(   569),  INT16_C(  9141),  INT16_C(  4661), -INT16_C( 13176), -INT16_C(  5016),
+      -INT16_C(   805),  INT16_C( 30607),  INT16_C( 26293),  INT16_C( 21416),  INT16_C(  1367), -INT16_C( 23109), -INT16_C( 30613),  INT16_C( 20004),
+      -INT16_C( 12080),  INT16_C( 32212),  INT16_C(  3493),  INT16_C( 23167), -INT16_C( 19407), -INT16_C( 18068), -INT16_C( 10880),  INT16_C( 23462),
+       INT16_C( 13777), -INT16_C( 31022),  INT16_C( 31388), -INT16_C(  3111), -INT16_C( 27265), -INT16_C(  5224), -INT16_C( 17379), -INT16_C(  4807),
+       INT16_C(  3469),  INT16_C( 12906), -INT16_C(  5605),  INT16_C( 19597), -INT16_C(  1634),  INT16_C(  7941), -INT16_C( 21554), -INT16_C( 24710),
+       INT16_C( 19937),  INT16_C( 32038), -INT16_C(    57),  INT16_C( 18288),  INT16_C(  2452), -INT16_C( 19918),  INT16_C( 27589),  INT16_C( 21151),
+       INT16_C(  2680), -INT16_C( 27771),  INT16_C(  4852), -INT16_C( 27937), -INT16_C(  6901), -INT16_C(  9551),  INT16_C( 11408),  INT16_C( 29049),
+      -INT16_C( 24711),  INT16_C( 16622),  INT16_C( 24479),  INT16_C( 13191), -INT16_C( 18072),  INT16_C( 11749), -INT16_C( 31452), -INT16_C( 25216),
+       INT16_C(  1423), -INT16_C( 31952),  INT16_C(  4119),  INT16_C(  8725), -INT16_C( 14347), -INT16_C( 31236),  INT16_C( 30451),  INT16_C( 27895),
+      -INT16_C(  6891), -INT16_C( 19284),  INT16_C( 13380), -INT16_C( 21272), -INT16_C( 12819),  INT16_C(  4826),  INT16_C( 23122), -INT16_C(  7761),
+      -INT16_C(  8353),  INT16_C( 30308),  INT16_C( 31471), -INT16_C(  7016), -INT16_C( 27327),  INT16_C( 13418),  INT16_C( 24843),  INT16_C(  8352),
+       INT16_C( 19526), -INT16_C( 29739), -INT16_C( 17024),  INT16_C( 28215),  INT16_C(  4490), -INT16_C(  8832),  INT16_C( 12139), -INT16_C( 13634),
+       INT16_C(  8974), -INT16_C(   448), -INT16_C(  9827), -INT16_C(  8478),  INT16_C( 19566),  INT16_C( 30994), -INT16_C( 19795), -INT16_C(  2919),
+       INT16_C( 28414),  INT16_C( 32639), -INT16_C( 18901), -INT16_C( 18707),  INT16_C( 28104),  INT16_C( 13203),  INT16_C( 20892), -INT16_C( 21762),
+       INT16_C( 15988),  INT16_C(  4520), -INT16_C( 29929), -INT16_C( 31249),  INT16_C(   471), -INT16_C( 31234), -INT16_C( 26445), -INT16_C( 19847),
+      -INT16_C(  2042),  INT16_C( 12849),  INT16_C(  7854),  INT16_C( 30440),  INT16_C( 31627),  INT16_C( 10154), -INT16_C( 22324),  INT16_C( 16849),
+       INT16_C( 31462), -INT16_C(   430),  INT16_C( 16901), -INT16_C(  9085), -INT16_C( 32189), -INT16_C(  2207), -INT16_C(  9702),  INT16_C(  8361),
+      -INT16_C(  9518), -INT16_C( 32430),  INT16_C( 15096), -INT16_C( 31753), -INT16_C( 24139), -INT16_C( 32086),  INT16_C( 31561),  INT16_C( 12483),
+       INT16_C(  5621), -INT16_C(  1490), -INT16_C( 20137), -INT16_C( 25641),  INT16_C( 14387),  INT16_C( 19858),  INT16_C( 15123), -INT16_C(  6802),
+      -INT16_C( 16363),  INT16_C(  3430),  INT16_C( 24315), -INT16_C( 20336),  INT16_C( 15103),  INT16_C( 18738), -INT16_C(  2635), -INT16_C( 21639),
+      -INT16_C( 22773),  INT16_C( 25253),  INT16_C( 31832), -INT16_C( 29443), -INT16_C( 28747), -INT16_C( 14119),  INT16_C( 18378), -INT16_C(  8275),
+       INT16_C(  5128),  INT16_C(  1004),  INT16_C( 31858),  INT16_C( 29107), -INT16_C(  6474),  INT16_C( 27834),  INT16_C( 13275), -INT16_C(  6633),
+      -INT16_C( 17190),  INT16_C( 13129),  INT16_C( 17977), -INT16_C(  4417), -INT16_C( 26410), -INT16_C( 24394),  INT16_C( 25568), -INT16_C(  6016),
+       INT16_C( 27767), -INT16_C(  5653), -INT16_C( 24855), -INT16_C( 24741),  INT16_C(  5508),  INT16_C( 24587),  INT16_C(  8777),  INT16_C(  9030),
+      -INT16_C( 28705),  INT16_C(  6230),  INT16_C(  5590), -INT16_C( 21498), -INT16_C( 17234), -INT16_C( 29108), -INT16_C( 13281), -INT16_C( 26762),
+       INT16_C( 24889),  INT16_C(  8832), -INT16_C(  9217), -INT16_C( 31551), -INT16_C( 12815),  INT16_C( 15076),  INT16_C( 10991), -INT16_C( 12707),
+      -INT16_C( 19270), -INT16_C( 28442), -INT16_C(  4919),  INT16_C( 30524), -INT16_C( 30552), -INT16_C( 14331),  INT16_C( 31573), -INT16_C( 29089),
+      -INT16_C(  8228), -INT16_C(  9040),  INT16_C( 29115), -INT16_C( 21408),  INT16_C( 17470),  INT16_C( 12006),  INT16_C( 17262),  INT16_C( 10492),
+      -INT16_C(  7177), -INT16_C( 15944), -INT16_C(  2865),  INT16_C( 30776),  INT16_C( 15997), -INT16_C( 11712), -INT16_C( 24647), -INT16_C( 27040),
+       INT16_C(  4222),  INT16_C( 14706), -INT16_C( 11647), -INT16_C( 16155), -INT16_C( 13546), -INT16_C( 31506), -INT16_C(  5617),  INT16_C(  1709),
+       INT16_C( 26061), -INT16_C( 25145),  INT16_C(    90), -INT16_C( 10475),  INT16_C( 21822), -INT16_C(  2135),  INT16_C(  2548),  INT16_C( 29325),
+      -INT16_C(   231), -INT16_C( 25940), -INT16_C( 28207), -INT16_C(  6310),  INT16_C( 18525),  INT16_C( 27756),  INT16_C(  6451),  INT16_C(   114),
+       INT16_C( 14974), -INT16_C( 10083), -INT16_C( 19910),  INT16_C( 30895),  INT16_C( 22535), -INT16_C(  1169), -INT16_C(   671),  INT16_C( 31342),
+       INT16_C(  6908), -INT16_C( 12779),  INT16_C( 28587),  INT16_C(  2229),  INT16_C(  8632), -INT16_C(  5260), -INT16_C(  6342), -INT16_C( 17941),
+      -INT16_C( 30431),  INT16_C( 23441),  INT16_C( 16699),  INT16_C( 17363),  INT16_C( 17049), -INT16_C(  1218), -INT16_C( 21441),  INT16_C( 15477),
+      -INT16_C( 30010),  INT16_C( 29194), -INT16_C( 16390), -INT16_C( 19846), -INT16_C(  4127),  INT16_C(  7069), -INT16_C( 30506), -INT16_C(  2092),
+       INT16_C( 26129),  INT16_C( 19794) };
+  static const int8_t b[] =
+    {  INT8_C(  63),  INT8_C(  58),  INT8_C(  40), -INT8_C(  20),  INT8_C( 104),  INT8_C(  16),  INT8_C( 121), -INT8_C( 123),
+      -INT8_C( 108),  INT8_C(  34),  INT8_C( 120), -INT8_C(  95), -INT8_C(  96),  INT8_C(  98), -INT8_C(  64), -INT8_C( 125),
+      -INT8_C(  98),  INT8_C(  43),  INT8_C(  14), -INT8_C(   1),  INT8_C(  39), -INT8_C(  39), -INT8_C(  57), -INT8_C(  15),
+      -INT8_C(  33),  INT8_C(  55),  INT8_C(  54), -INT8_C( 105), -INT8_C( 119), -INT8_C(  68), -INT8_C( 118), -INT8_C(  55),
+      -INT8_C(  10), -INT8_C(  78), -INT8_C(  75),  INT8_C(  94), -INT8_C(  62),  INT8_C(  46), -INT8_C(  29),  INT8_C(  87),
+       INT8_C(  81),  INT8_C(  91), -INT8_C(   8), -INT8_C(  15), -INT8_C(  67), -INT8_C(  72),  INT8_C( 116),  INT8_C(  91),
+      -INT8_C(  28), -INT8_C( 126),  INT8_C(  90),  INT8_C(  11),  INT8_C(  91),  INT8_C(  34), -INT8_C(   4),  INT8_C(  59),
+       INT8_C(  89),  INT8_C(  50), -INT8_C(  46), -INT8_C(  30), -INT8_C(  18),  INT8_C(  92), -INT8_C(  85), -INT8_C(  27),
+       INT8_C(  14),  INT8_C(  96),  INT8_C(  67), -INT8_C(  47), -INT8_C( 113),  INT8_C(  39),  INT8_C(  40), -INT8_C(  32),
+      -INT8_C( 126),  INT8_C(  32), -INT8_C(  47),  INT8_C(  64), -INT8_C(  39),  INT8_C(  69), -INT8_C( 101), -INT8_C(  67),
+      -INT8_C(  56), -INT8_C(  10), -INT8_C(  56),  INT8_C(  35),  INT8_C(  24), -INT8_C(  60),  INT8_C(  94),  INT8_C( 113),
+      -INT8_C(  10),  INT8_C(  48),  INT8_C(  83), -INT8_C(  28), -INT8_C( 116), -INT8_C(   1), -INT8_C(  55), -INT8_C( 101),
+       INT8_C(  95),  INT8_C(  13),  INT8_C( 108), -INT8_C(  18),  INT8_C(  52), -INT8_C( 108), -INT8_C(  50), -INT8_C(  74),
+      -INT8_C(  76), -INT8_C(  97), -INT8_C(  10), -INT8_C( 115), -INT8_C(  27), -INT8_C( 110),  INT8_C(  74), -INT8_C(  83),
+      -INT8_C( 120),  INT8_C(  18), -INT8_C(  48), -INT8_C(  96), -INT8_C(  42),  INT8_C(  47),  INT8_C(  17), -INT8_C(  52),
+       INT8_C(  95),  INT8_C( 100), -INT8_C(  79), -INT8_C(  20),  INT8_C(  99),  INT8_C( 122), -INT8_C( 121), -INT8_C(  61),
+      -INT8_C( 121), -INT8_C(  13), -INT8_C(  79), -INT8_C(  69), -INT8_C( 121),      INT8_MIN,  INT8_C( 114),  INT8_C(  59),
+       INT8_C(  31),  INT8_C( 104), -INT8_C(  55),  INT8_C(   4), -INT8_C(   6),  INT8_C(  19), -INT8_C(  79), -INT8_C( 126),
+       INT8_C(  38), -INT8_C( 126),  INT8_C(  34), -INT8_C(   4), -INT8_C(  79),  INT8_C(  51), -INT8_C(  55),  INT8_C(  16),
+      -INT8_C( 104),  INT8_C( 122), -INT8_C(   4), -INT8_C(   5), -INT8_C(  12), -INT8_C( 125), -INT8_C(  66),  INT8_C( 124),
+       INT8_C( 118),  INT8_C( 112),  INT8_C(  55), -INT8_C(   3), -INT8_C(  16), -INT8_C(  87),  INT8_C(  57),  INT8_C(  15),
+       INT8_C(  18),  INT8_C(   2),  INT8_C(  20),  INT8_C(  12),  INT8_C(  21), -INT8_C(  59), -INT8_C( 113),  INT8_C(  59),
+       INT8_C(  71), -INT8_C(  79),  INT8_C(  56), -INT8_C(   8), -INT8_C(  27),  INT8_C(   1),  INT8_C(   9),  INT8_C( 125),
+       INT8_C( 123),  INT8_C(   5),  INT8_C( 120),  INT8_C( 111), -INT8_C( 119),  INT8_C(  55), -INT8_C(  21), -INT8_C(   1),
+      -INT8_C(  89),  INT8_C(  35), -INT8_C(   3), -INT8_C( 105), -INT8_C(  52),  INT8_C(  54), -INT8_C(  90), -INT8_C(  34),
+       INT8_C(  56), -INT8_C(  70), -INT8_C(  21),  INT8_C(  77),      INT8_MIN,  INT8_C( 122), -INT8_C( 119), -INT8_C(  57),
+       INT8_C(  43), -INT8_C(  63), -INT8_C(  64),  INT8_C(  16), -INT8_C(  62), -INT8_C(  55), -INT8_C( 115),  INT8_C(  61),
+      -INT8_C(  50),  INT8_C(   6), -INT8_C(  84),  INT8_C(  87),  INT8_C(  61), -INT8_C( 104),  INT8_C(  87), -INT8_C(  28),
+      -INT8_C(  69),  INT8_C(  84),  INT8_C( 123), -INT8_C( 121), -INT8_C( 118),  INT8_C(  33),  INT8_C( 102), -INT8_C(  62),
+      -INT8_C(  36),  INT8_C(  81),  INT8_C(  15),  INT8_C(  92), -INT8_C(  53), -INT8_C( 104),  INT8_C(  35), -INT8_C(  10),
+       INT8_C(  89), -INT8_C(  29),  INT8_C(   7),  INT8_C(  27), -INT8_C(  84), -INT8_C( 108),  INT8_C(  88),  INT8_C( 123),
+      -INT8_C( 102),  INT8_C(   5), -INT8_C(  46), -INT8_C(  41), -INT8_C(  99),  INT8_C(  41), -INT8_C(  69),  INT8_C(  88),
+       INT8_C( 125),  INT8_C(  54), -INT8_C(  33),  INT8_C(   7),  INT8_C(  88),  INT8_C(  69), -INT8_C(  55),  INT8_C(  52),
+      -INT8_C( 106), -INT8_C(  39), -INT8_C( 112),  INT8_C(  97),  INT8_C( 113), -INT8_C(  77),  INT8_C(  88), -INT8_C(  53),
+      -INT8_C( 105),  INT8_C(  95), -INT8_C(  26),  INT8_C(  67), -INT8_C(  13),  INT8_C(  63), -INT8_C(  66), -INT8_C( 114),
+       INT8_C(  68), -INT8_C( 111),  INT8_C( 101), -INT8_C(  31), -INT8_C(  70),  INT8_C(  33),  INT8_C(  57),  INT8_C(  56),
+       INT8_C(  87),  INT8_C(  24),  INT8_C(  63), -INT8_C(  81),  INT8_C(  94),  INT8_C(   9), -INT8_C(  29), -INT8_C(  12),
+      -INT8_C(  30),  INT8_C( 115),  INT8_C(  86),  INT8_C(  83),  INT8_C(  39), -INT8_C(  82),  INT8_C(  30), -INT8_C(  66),
+       INT8_C(  13),  INT8_C(   5),  INT8_C(   1),  INT8_C(   0),  INT8_C(  68), -INT8_C(  64), -INT8_C( 114), -INT8_C( 120),
+       INT8_C(  81), -INT8_C(  12),  INT8_C( 105),  INT8_C(  11),  INT8_C(  21), -INT8_C(  94),  INT8_C(  67),  INT8_C( 108),
+      -INT8_C(  70), -INT8_C( 125),  INT8_C(  28),  INT8_C(  24), -INT8_C( 116), -INT8_C(   1),  INT8_C(  13),  INT8_C( 110),
+       INT8_C( 115),  INT8_C(  99), -INT8_C(  63), -INT8_C( 102),  INT8_C(  17), -INT8_C(  32),  INT8_C(  88),  INT8_C(  30),
+      -INT8_C(  27),  INT8_C(  89),  INT8_C(  30),  INT8_C(  41),  INT8_C(  25), -INT8_C(  83), -INT8_C(  79),  INT8_C( 106),
+      -INT8_C(  95),  INT8_C(  26),  INT8_C( 118), -INT8_C(  74), -INT8_C(  68), -INT8_C(  71),  INT8_C(  34),  INT8_C( 118),
+       INT8_C(  60),  INT8_C(  62), -INT8_C( 113), -INT8_C(  56),  INT8_C(  62), -INT8_C( 100),  INT8_C(  54), -INT8_C(  79),
+      -INT8_C(   1), -INT8_C(   8),  INT8_C(  75),  INT8_C(  16), -INT8_C(  40), -INT8_C(  93),  INT8_C(  46), -INT8_C(  67),
+      -INT8_C(   4),  INT8_C(  76), -INT8_C(  26),  INT8_C(  22), -INT8_C(   7), -INT8_C( 105),      INT8_MIN, -INT8_C( 102),
+      -INT8_C(  79), -INT8_C(  10),  INT8_C(  80),  INT8_C( 109), -INT8_C(  80),  INT8_C( 115), -INT8_C(  29), -INT8_C(  20),
+      -INT8_C(  79),  INT8_C( 114), -INT8_C(  75), -INT8_C(  17),  INT8_C(  14), -INT8_C(  21), -INT8_C(  96),  INT8_C(  13),
+      -INT8_C(  29), -INT8_C(  21),  INT8_C(  29), -INT8_C(  69), -INT8_C( 114),  INT8_C(  75),  INT8_C( 120), -INT8_C( 117),
+      -INT8_C( 104),  INT8_C(  94), -INT8_C(  95), -INT8_C( 111), -INT8_C(  11),  INT8_C(  33),  INT8_C(  44), -INT8_C(  90),
+       INT8_C(  24),  INT8_C( 124),  INT8_C(  19), -INT8_C(  56), -INT8_C(  17), -INT8_C(   9), -INT8_C(  76), -INT8_C(  95),
+       INT8_C( 105),  INT8_C( 105), -INT8_C( 112),  INT8_C( 120),  INT8_C(  85),  INT8_C(  49), -INT8_C( 123),  INT8_C(  56),
+       INT8_C(  28), -INT8_C(  93), -INT8_C(  12), -INT8_C(  85), -INT8_C(  18),  INT8_C( 108),  INT8_C(  54), -INT8_C( 122),
+      -INT8_C(  53), -INT8_C(  41),  INT8_C(  24), -INT8_C(  64), -INT8_C(   8),  INT8_C(  68),  INT8_C( 103),  INT8_C(  16),
+      -INT8_C(  64),  INT8_C( 122), -INT8_C(  40), -INT8_C(  80),  INT8_C( 113), -INT8_C( 115),  INT8_C(  81), -INT8_C(  37),
+      -INT8_C(  10), -INT8_C(  31),  INT8_C(  83),  INT8_C(  75),  INT8_C(  18), -INT8_C(  40), -INT8_C( 124),  INT8_C(  47),
+       INT8_C( 123),  INT8_C( 120), -INT8_C(  38),  INT8_C( 106), -INT8_C(  28),  INT8_C(  16), -INT8_C(  16), -INT8_C(  81),
+      -INT8_C(  25),  INT8_C(   8),  INT8_C( 112), -INT8_C(  33),  INT8_C(  76), -INT8_C(  41), -INT8_C(  16),  INT8_C(  13),
+       INT8_C(  81), -INT8_C(  56), -INT8_C(  67), -INT8_C(  61),  INT8_C(  85),  INT8_C(  14), -INT8_C(  98),  INT8_C(  76),
+      -INT8_C(  17), -INT8_C(  15), -INT8_C( 105),  INT8_C(   2), -INT8_C(  55),  INT8_C(  27),  INT8_C(  49),  INT8_C(  69),
+      -INT8_C( 109),  INT8_C(  11) };
+  static const int8_t e[] =
+    { -INT8_C(  56),  INT8_C(  58), -INT8_C(  23),  INT8_C( 102),  INT8_C( 104),  INT8_C(  16),  INT8_C( 121),  INT8_C(  99),
+      -INT8_C( 108),  INT8_C(  34),  INT8_C( 120), -INT8_C(  95), -INT8_C(  19),  INT8_C(  25), -INT8_C(  71), -INT8_C( 125),
+      -INT8_C(  98),  INT8_C(  43),  INT8_C(  87), -INT8_C(   1), -INT8_C( 115), -INT8_C( 113), -INT8_C(  57),      INT8_MAX,
+      -INT8_C(  33),  INT8_C(  66),  INT8_C(  54), -INT8_C( 105), -INT8_C( 119), -INT8_C(  68), -INT8_C(   1), -INT8_C(  55),
+      -INT8_C(  10), -INT8_C(  78), -INT8_C(  75),      INT8_MIN, -INT8_C( 116), -INT8_C(  56), -INT8_C(  29),  INT8_C( 108),
+       INT8_C(  76),  INT8_C(  91), -INT8_C(   8), -INT8_C( 103),  INT8_C(  31),  INT8_C(  51),  INT8_C( 116), -INT8_C(  68),
+      -INT8_C(  28), -INT8_C( 126),  INT8_C(  90),  INT8_C(  11),  INT8_C(  91), -INT8_C(  62), -INT8_C(   4), -INT8_C(  97),
+      -INT8_C(  36), -INT8_C(  99), -INT8_C( 110), -INT8_C( 120), -INT8_C(  18),  INT8_C(  92), -INT8_C(  85), -INT8_C(  27),
+       INT8_C( 111),  INT8_C( 123), -INT8_C( 101), -INT8_C(  26), -INT8_C( 113),  INT8_C(  39), -INT8_C(  42), -INT8_C(  32),
+      -INT8_C( 126), -INT8_C( 125), -INT8_C( 105),  INT8_C(  64), -INT8_C(  56),  INT8_C(  75), -INT8_C( 101), -INT8_C(  67),
+       INT8_C( 108), -INT8_C( 100), -INT8_C(   1),  INT8_C(  35),  INT8_C(  42), -INT8_C(  60),  INT8_C( 109),  INT8_C( 113),
+      -INT8_C( 109),  INT8_C(  81),  INT8_C(  83), -INT8_C(  28), -INT8_C( 116), -INT8_C(  65),  INT8_C(  81), -INT8_C(   5),
+       INT8_C(  95),  INT8_C(  13),  INT8_C( 108), -INT8_C( 113),  INT8_C(  52),  INT8_C(  69),  INT8_C(  47), -INT8_C(  74),
+       INT8_C(  46), -INT8_C(  19),  INT8_C(  17),  INT8_C( 123), -INT8_C( 108),  INT8_C(  78),  INT8_C(  74), -INT8_C(  83),
+      -INT8_C(  32), -INT8_C(  60),  INT8_C(  98), -INT8_C(  96),  INT8_C(  80),  INT8_C(  47),  INT8_C(  17), -INT8_C(  52),
+       INT8_C(  95),  INT8_C(  27), -INT8_C(  54), -INT8_C(  20), -INT8_C(  46),  INT8_C(  67), -INT8_C( 121),  INT8_C(  18),
+       INT8_C(  75), -INT8_C(  13),  INT8_C(  41),  INT8_C(  16),  INT8_C( 117),      INT8_MIN,  INT8_C( 114), -INT8_C( 100),
+       INT8_C(  31),  INT8_C( 104), -INT8_C(  55), -INT8_C( 108), -INT8_C(   6),  INT8_C(  49), -INT8_C(  67), -INT8_C(  24),
+       INT8_C(  38), -INT8_C( 126), -INT8_C( 116), -INT8_C(  69), -INT8_C(  91), -INT8_C(  13), -INT8_C(  55),  INT8_C(  41),
+      -INT8_C( 104),  INT8_C( 122), -INT8_C(   4), -INT8_C(  75), -INT8_C(   1), -INT8_C( 125),  INT8_C(  41), -INT8_C(  59),
+      -INT8_C( 121),  INT8_C( 112),  INT8_C(  67), -INT8_C(   3), -INT8_C(  11), -INT8_C(  87),  INT8_C(  57),  INT8_C(  66),
+       INT8_C(  18),  INT8_C( 114),  INT8_C(  20),  INT8_C(  12),  INT8_C(  21), -INT8_C(  59), -INT8_C( 113),  INT8_C( 122),
+       INT8_C(  71), -INT8_C(  79),  INT8_C(  63),  INT8_C(  38), -INT8_C( 107),  INT8_C(  26),  INT8_C(   9),  INT8_C(   9),
+       INT8_C( 123),  INT8_C(   5), -INT8_C(  92),  INT8_C(  40),  INT8_C(  85), -INT8_C(  22), -INT8_C(  21), -INT8_C(   1),
+      -INT8_C(  89), -INT8_C( 109), -INT8_C( 100), -INT8_C(  41), -INT8_C(  99),  INT8_C(  93), -INT8_C(  90), -INT8_C(  51),
+       INT8_C(  56), -INT8_C(  70), -INT8_C(  83),  INT8_C(  77), -INT8_C(  75),  INT8_C( 122), -INT8_C( 119), -INT8_C(  57),
+       INT8_C(  43), -INT8_C( 113), -INT8_C(  64),  INT8_C(  16), -INT8_C(  62), -INT8_C(  69), -INT8_C( 115),  INT8_C(  61),
+      -INT8_C(  48), -INT8_C(  44), -INT8_C(  84),  INT8_C(  87),  INT8_C(  49), -INT8_C( 104),      INT8_MIN, -INT8_C(  90),
+      -INT8_C(  69), -INT8_C(  46),  INT8_C( 123), -INT8_C( 121),      INT8_MAX,  INT8_C(  33),  INT8_C( 102),  INT8_C(  57),
+      -INT8_C(  36),  INT8_C( 106),  INT8_C(  27),  INT8_C(  92), -INT8_C(  98),  INT8_C(   5),  INT8_C(  35),  INT8_C( 122),
+       INT8_C(  89), -INT8_C(  29),  INT8_C(   7),  INT8_C(  27), -INT8_C(  84), -INT8_C( 108), -INT8_C(  59), -INT8_C(  97),
+      -INT8_C( 102), -INT8_C( 123), -INT8_C(  12), -INT8_C(  33),  INT8_C(  11),  INT8_C(  41), -INT8_C(  69),  INT8_C( 121),
+       INT8_C( 125),  INT8_C(  54), -INT8_C(  97),  INT8_C(   7),  INT8_C( 104), -INT8_C(  27), -INT8_C(  55),      INT8_MIN,
+      -INT8_C( 113), -INT8_C(  39), -INT8_C( 112),  INT8_C(  21),  INT8_C( 113), -INT8_C(   4),  INT8_C(  88), -INT8_C(  53),
+       INT8_C(  21), -INT8_C(  84),  INT8_C(  68), -INT8_C(  24), -INT8_C(  19),  INT8_C(  63),  INT8_C(  82), -INT8_C( 114),
+       INT8_C(  68),  INT8_C( 100),  INT8_C( 101), -INT8_C(  31),  INT8_C(  65),  INT8_C( 106),  INT8_C(  57),  INT8_C(  56),
+       INT8_C(  87), -INT8_C(  43),  INT8_C(  63),  INT8_C(  55), -INT8_C( 118),  INT8_C(   9), -INT8_C(  29), -INT8_C(  12),
+       INT8_C(  14),  INT8_C(  64), -INT8_C(  99),  INT8_C(  83),  INT8_C( 110),  INT8_C(  18),  INT8_C(  30), -INT8_C(  66),
+      -INT8_C(   2),      INT8_MAX,  INT8_C(   1), -INT8_C(  19), -INT8_C(  56), -INT8_C(  64), -INT8_C( 100), -INT8_C( 120),
+       INT8_C( 116), -INT8_C(  12),  INT8_C( 105),  INT8_C(  11), -INT8_C(  41), -INT8_C(  94),  INT8_C(  67),  INT8_C( 108),
+       INT8_C(   6),  INT8_C(  49),  INT8_C(  28), -INT8_C(  24), -INT8_C( 117), -INT8_C(   1), -INT8_C(  52), -INT8_C(  47),
+      -INT8_C(  26),  INT8_C(  82),  INT8_C(   5), -INT8_C( 125),  INT8_C(  17), -INT8_C(  32),  INT8_C(  88), -INT8_C(  87),
+      -INT8_C(  46),  INT8_C(  89),  INT8_C(  30), -INT8_C(   9),  INT8_C(  25), -INT8_C(  86),  INT8_C(  73),  INT8_C( 106),
+      -INT8_C(  11),  INT8_C(  26),  INT8_C(  87), -INT8_C(  41), -INT8_C(  68), -INT8_C(  71),  INT8_C(  34),  INT8_C( 110),
+       INT8_C(  21),  INT8_C( 102), -INT8_C( 113), -INT8_C(  56), -INT8_C(   1),  INT8_C(  50), -INT8_C(  75),  INT8_C( 121),
+      -INT8_C(   1), -INT8_C(   8),  INT8_C(  75), -INT8_C(   3), -INT8_C(  75), -INT8_C(  93),  INT8_C(  46), -INT8_C(  83),
+      -INT8_C(   4), -INT8_C(  20),  INT8_C( 114),  INT8_C(  22), -INT8_C(   7), -INT8_C( 105), -INT8_C(  37), -INT8_C( 102),
+      -INT8_C(  38),  INT8_C(  73),  INT8_C(  57),  INT8_C( 109), -INT8_C(  42), -INT8_C(  74), -INT8_C(  29), -INT8_C(  20),
+       INT8_C( 119), -INT8_C(  21), -INT8_C(  75), -INT8_C(  17),  INT8_C(  14), -INT8_C(  21), -INT8_C(  96),  INT8_C(  70),
+      -INT8_C(  29),  INT8_C(  86),  INT8_C(  29), -INT8_C(  69), -INT8_C( 114),  INT8_C(  75),  INT8_C( 120),  INT8_C( 118),
+       INT8_C(  57),  INT8_C(  94), -INT8_C(  95), -INT8_C(  63), -INT8_C(  15), -INT8_C(  28),  INT8_C(  44), -INT8_C(  90),
+       INT8_C(  24),  INT8_C( 124),  INT8_C(  19),  INT8_C(  60), -INT8_C(  17),  INT8_C(   5),  INT8_C(  85),  INT8_C(  95),
+       INT8_C( 105),  INT8_C( 105), -INT8_C( 112),  INT8_C(  96),  INT8_C(  85),  INT8_C(  49), -INT8_C( 123), -INT8_C(   4),
+      -INT8_C(   9), -INT8_C(  72), -INT8_C(  49),  INT8_C(  56),  INT8_C( 125),  INT8_C(  64), -INT8_C(  71), -INT8_C( 122),
+      -INT8_C(  53), -INT8_C(  41), -INT8_C( 127), -INT8_C(  64),  INT8_C(  22),  INT8_C(  68),  INT8_C(  15),  INT8_C(  16),
+      -INT8_C(  64), -INT8_C(  57),  INT8_C(  90),  INT8_C(  21),  INT8_C(  62), -INT8_C( 115), -INT8_C(  12), -INT8_C( 115),
+       INT8_C(  25), -INT8_C(  84),  INT8_C(  83),  INT8_C(  90),  INT8_C(  93), -INT8_C(  40),  INT8_C(  51),  INT8_C( 114),
+       INT8_C( 123), -INT8_C(  99),  INT8_C(  58), -INT8_C(  81),  INT8_C(   7),  INT8_C(  16), -INT8_C(  16),  INT8_C( 110),
+      -INT8_C(  25),  INT8_C(   8), -INT8_C(  85), -INT8_C(  75), -INT8_C(  72),  INT8_C( 116), -INT8_C(  16), -INT8_C(  21),
+       INT8_C(  81), -INT8_C( 111), -INT8_C(  67), -INT8_C(  45),  INT8_C(  85),  INT8_C(  14), -INT8_C(  98),  INT8_C( 117),
+      -INT8_C(  58), -INT8_C(  15), -INT8_C(   6),  INT8_C( 122), -INT8_C(  55), -INT8_C(  99),  INT8_C(  49),  INT8_C(  69),
+      -INT8_C( 109),  INT8_C(  11) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+
+    simde_svst1b_s16(pv, &(r[i]), simde_svld1_s16(pg, &(a[i])));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(int16_t)];
+  int16_t a[1024 / sizeof(int16_t)];
+  int8_t b[1024 / sizeof(int16_t)];
+  int8_t e[1024 / sizeof(int16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+
+    simde_svst1b_s16(pv, &(e[i]), simde_svld1_s16(pg, &(a[i])));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1b_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(  2111770642),  INT32_C(   368758778),  INT32_C(   387391855),  INT32_C(   655095993),  INT32_C(  1692863946), -INT32_C(  1739363637), -INT32_C(  1655402613),  INT32_C(  1350111842),
+      -INT32_C(    70084351), -INT32_C(   669987735), -INT32_C(  1477498898), -INT32_C(   372311521), -INT32_C(   749881849), -INT32_C(  1402232544), -INT32_C(  1840660688), -INT32_C(   756890927),
+      -INT32_C(   976374436),  INT32_C(  1872616833),  INT32_C(   588680196), -INT32_C(  1911691898), -INT32_C(  1151247717),  INT32_C(   728222971),  INT32_C(  1555935627), -INT32_C(   819027853),
+      -INT32_C(   694879403), -INT32_C(   599379496),  INT32_C(  1157586109), -INT32_C(   590214079),  INT32_C(  1654141799), -INT32_C(  1970339841),  INT32_C(   619072432),  INT32_C(  1089672427),
+      -INT32_C(   417888241),  INT32_C(  2009292217), -INT32_C(    71580999),  INT32_C(   920096207), -INT32_C(  1080528960),  INT32_C(   524887663),  INT32_C(  1564684146),  INT32_C(  1386100547),
+       INT32_C(  2017047999), -INT32_C(   873464814), -INT32_C(  1916360002), -INT32_C(   138174921),  INT32_C(  2092325901), -INT32_C(   191037566),  INT32_C(  1901256494), -INT32_C(   708579306),
+      -INT32_C(  1219560283), -INT32_C(  1216201224),  INT32_C(   524569064), -INT32_C(   199816985), -INT32_C(   428749468), -INT32_C(    69530163),  INT32_C(    57486828), -INT32_C(  1026019299),
+       INT32_C(   628696621),  INT32_C(  1289550692),  INT32_C(   728441156), -INT32_C(  1927249367),  INT32_C(   494113104), -INT32_C(  1978118498), -INT32_C(  1735555717), -INT32_C(   480614730),
+      -INT32_C(   267857012),  INT32_C(   322758095),  INT32_C(   792700934),  INT32_C(  2059165482), -INT32_C(  1902694416), -INT32_C(   115822466), -INT32_C(   342710731), -INT32_C(  1731269620),
+      -INT32_C(  1886791744), -INT32_C(  1029519940), -INT32_C(  1728978579),  INT32_C(   806530368),  INT32_C(  1522445020), -INT32_C(  1890265254), -INT32_C(  1988368771), -INT32_C(  1843312174),
+      -INT32_C(   601773536), -INT32_C(   576797584), -INT32_C(   428503131),  INT32_C(   420907068), -INT32_C(  1938565838),  INT32_C(   689686444), -INT32_C(  2135779667),  INT32_C(     1233888),
+      -INT32_C(   287492994), -INT32_C(  1647608840),  INT32_C(  1199784203), -INT32_C(    77554999),  INT32_C(   461886575),  INT32_C(  1229234843),  INT32_C(   432666169),  INT32_C(  1192877001),
+       INT32_C(   120976911),  INT32_C(  2107965810),  INT32_C(   197404738),  INT32_C(   822486466), -INT32_C(  1806922247),  INT32_C(  1759350831),  INT32_C(  1350674054), -INT32_C(  1852335230),
+       INT32_C(    60411281),  INT32_C(   276840142),  INT32_C(   689653094),  INT32_C(  1666851178), -INT32_C(   570972242), -INT32_C(  1102654153), -INT32_C(    49363077), -INT32_C(   191912606),
+       INT32_C(  1089939570), -INT32_C(   867141530),  INT32_C(   670395325),  INT32_C(   982143116),  INT32_C(   773358071), -INT32_C(   756261290), -INT32_C(  1999635931),  INT32_C(   310140576),
+      -INT32_C(   330075258), -INT32_C(  1464228885), -INT32_C(  1680888305), -INT32_C(   170501634),  INT32_C(   824504027),  INT32_C(  1896026188), -INT32_C(  1409690869), -INT32_C(  1195543247),
+      -INT32_C(   727445271), -INT32_C(  1015194188),  INT32_C(   173952012), -INT32_C(  2130692954),  INT32_C(  1857168418),  INT32_C(  1071691316), -INT32_C(  1159014007),  INT32_C(   947038287),
+       INT32_C(  1812731832), -INT32_C(  2144368268),  INT32_C(  2089520854), -INT32_C(   436368446), -INT32_C(   481054801), -INT32_C(   299682971),  INT32_C(  1554582797),  INT32_C(  1855200181),
+      -INT32_C(  1478844366),  INT32_C(     2558506) };
+  static const int32_t a[] =
+    { -INT32_C(  2031846428), -INT32_C(  1448697038), -INT32_C(   634944005), -INT32_C(  1996155130), -INT32_C(  1405624720),  INT32_C(  2099759450), -INT32_C(  1204283633),  INT32_C(  2076862103),
+       INT32_C(   318877409),  INT32_C(  1304274769),  INT32_C(   841475116),  INT32_C(  1807428859),  INT32_C(  1696068106), -INT32_C(   891142213), -INT32_C(   310240682),  INT32_C(  1634225536),
+       INT32_C(  1299540475),  INT32_C(  1033515537),  INT32_C(   309379350), -INT32_C(   142791699), -INT32_C(   648243938),  INT32_C(   715407060), -INT32_C(   652728743),  INT32_C(  1866170483),
+      -INT32_C(    71520022), -INT32_C(   130525470),  INT32_C(    67807255), -INT32_C(   218396460), -INT32_C(   238331875), -INT32_C(   283414634),  INT32_C(   164180886), -INT32_C(  1636301644),
+      -INT32_C(  1768344396), -INT32_C(  1584475766),  INT32_C(  1319475578),  INT32_C(  1044422945), -INT32_C(  1892742151),  INT32_C(   293554811),  INT32_C(   840583294),  INT32_C(    13669196),
+       INT32_C(  1385589191), -INT32_C(  1259133894), -INT32_C(   570254915),  INT32_C(   857489978), -INT32_C(   910013618),  INT32_C(   349847958), -INT32_C(   716770167),  INT32_C(  1339364999),
+      -INT32_C(  1180603521),  INT32_C(  1299092624),  INT32_C(  1730965549),  INT32_C(    26888371),  INT32_C(   717905300),  INT32_C(   675194014),  INT32_C(   553485464),  INT32_C(   426759066),
+      -INT32_C(   825094082), -INT32_C(   769900380),  INT32_C(  1681475761),  INT32_C(   610653328), -INT32_C(   816959695),  INT32_C(  1811385555), -INT32_C(  1433668336),  INT32_C(   113507016),
+      -INT32_C(  1344956918), -INT32_C(  2021527082), -INT32_C(   907298247), -INT32_C(  1074900850),  INT32_C(  1385118847), -INT32_C(   641825079),  INT32_C(  1132743035),  INT32_C(  1313490756),
+      -INT32_C(  1258479651),  INT32_C(  1228635664), -INT32_C(   955111623), -INT32_C(   142147465),  INT32_C(   105453117),  INT32_C(   417269660), -INT32_C(  1789172911), -INT32_C(  1998346837),
+      -INT32_C(   734207548), -INT32_C(  1742899105),  INT32_C(   375402655),  INT32_C(  1829627696), -INT32_C(  1720494083), -INT32_C(  1347333282),  INT32_C(  1631849910),  INT32_C(  2011834546),
+       INT32_C(  1749755401),  INT32_C(  1023502750), -INT32_C(   917216871),  INT32_C(  1161257288),  INT32_C(   400468664), -INT32_C(  1262055171),  INT32_C(  1326779293),  INT32_C(  1019674419),
+      -INT32_C(   995880410),  INT32_C(   335717755),  INT32_C(  1323128326),  INT32_C(  1888687287), -INT32_C(  1131973953), -INT32_C(  1620030206), -INT32_C(  1947302312), -INT32_C(  1412975227),
+       INT32_C(  1114664135),  INT32_C(   408318481),  INT32_C(  2137404360),  INT32_C(   133167688),  INT32_C(  1858303596),  INT32_C(   470627524),  INT32_C(  1068039098),  INT32_C(  2011918256),
+      -INT32_C(   306619429), -INT32_C(  1794830387), -INT32_C(  1961596093), -INT32_C(   778959771),  INT32_C(  1044338042),  INT32_C(  1130056841), -INT32_C(   125631672),  INT32_C(  1315991154),
+      -INT32_C(  1774507575),  INT32_C(  2083209273),  INT32_C(   285687723), -INT32_C(  1092445885),  INT32_C(  2029789934), -INT32_C(  1229236370), -INT32_C(   844153254),  INT32_C(  1964711852),
+      -INT32_C(  2129963448),  INT32_C(  1107113622), -INT32_C(  1185807242), -INT32_C(  1938344547), -INT32_C(   989563817),  INT32_C(   645709771), -INT32_C(  1426904066), -INT32_C(  1843392950),
+      -INT32_C(    99341468), -INT32_C(   667217566), -INT32_C(  1282306538),  INT32_C(   440338883),  INT32_C(  1222591357),  INT32_C(    24009475), -INT32_C(   794074746), -INT32_C(   748434577),
+       INT32_C(  1506637815), -INT32_C(  1640953464) };
+  static const int8_t b[] =
+    { -INT8_C( 109),  INT8_C( 112),  INT8_C(   7), -INT8_C(  13),  INT8_C(  48), -INT8_C(  85), -INT8_C(  28),  INT8_C( 106),
+      -INT8_C(  72), -INT8_C(  54),  INT8_C(  44), -INT8_C( 112), -INT8_C(  74), -INT8_C(  20),      INT8_MIN,  INT8_C(  10),
+       INT8_C(  80),  INT8_C(  82), -INT8_C(  71),  INT8_C(  94),  INT8_C(  90),  INT8_C(  71), -INT8_C(  60), -INT8_C(  78),
+      -INT8_C( 118),  INT8_C(  20),  INT8_C(  95), -INT8_C( 119),  INT8_C(  83), -INT8_C(  89), -INT8_C(  34), -INT8_C(  25),
+       INT8_C(  24), -INT8_C(  26), -INT8_C(  38),  INT8_C(  72), -INT8_C( 111), -INT8_C(  66), -INT8_C(  78),  INT8_C(  74),
+      -INT8_C( 120), -INT8_C(  33), -INT8_C(  38),  INT8_C(  63), -INT8_C(  53),  INT8_C(  90),  INT8_C(  73),  INT8_C(  27),
+      -INT8_C(  84),  INT8_C(   2),  INT8_C( 122),  INT8_C(   7),  INT8_C(  73),  INT8_C(  62), -INT8_C(  71), -INT8_C(  44),
+       INT8_C(  82),  INT8_C(  24),  INT8_C(  93), -INT8_C(  90), -INT8_C(  64),  INT8_C(  60), -INT8_C( 115), -INT8_C(  40),
+       INT8_C(  34),  INT8_C( 103),  INT8_C(  32), -INT8_C(  77),  INT8_C(  37), -INT8_C(  46), -INT8_C(   3), -INT8_C(  82),
+      -INT8_C(  79), -INT8_C(  41), -INT8_C(  19),  INT8_C( 125),  INT8_C(  49),  INT8_C(  54), -INT8_C( 104), -INT8_C(  34),
+       INT8_C(  57),  INT8_C(  18), -INT8_C(  27), -INT8_C( 126),  INT8_C(  81), -INT8_C(  98),  INT8_C(  86), -INT8_C(  93),
+      -INT8_C(  73), -INT8_C(  76),  INT8_C(  73),  INT8_C( 119), -INT8_C(  16), -INT8_C(  42),  INT8_C(  79),  INT8_C(  18),
+       INT8_C(  61),  INT8_C( 111), -INT8_C(  59),  INT8_C(  99),  INT8_C(  65), -INT8_C(  61),  INT8_C(  17), -INT8_C(  13),
+      -INT8_C( 102), -INT8_C(   2),  INT8_C( 112), -INT8_C(  52),  INT8_C(  52),  INT8_C(   8), -INT8_C(  86),  INT8_C( 109),
+       INT8_C(  27), -INT8_C( 113), -INT8_C(  16),  INT8_C( 108),  INT8_C(  45),  INT8_C(  70),  INT8_C(  15), -INT8_C(  28),
+      -INT8_C(   6),  INT8_C(  89),  INT8_C(  91), -INT8_C(  22),  INT8_C(  47), -INT8_C(  86), -INT8_C(   4),  INT8_C( 109),
+       INT8_C(  25), -INT8_C(  62), -INT8_C(  48),  INT8_C(  91), -INT8_C( 123), -INT8_C(  31),  INT8_C(  78),  INT8_C(  31),
+      -INT8_C(  33), -INT8_C(  66), -INT8_C(  21),  INT8_C(  19), -INT8_C(  58), -INT8_C( 107), -INT8_C( 127), -INT8_C(  31),
+       INT8_C(  36),  INT8_C( 113) };
+  static const int8_t e[] =
+    { -INT8_C(  28),  INT8_C( 112),  INT8_C(   7), -INT8_C(  13),  INT8_C(  48),  INT8_C(  90),  INT8_C(  15),  INT8_C( 106),
+      -INT8_C(  31),  INT8_C(  81),  INT8_C(  44), -INT8_C(   5),  INT8_C(  10), -INT8_C(  69),  INT8_C(  86),      INT8_MIN,
+      -INT8_C(   5),  INT8_C(  82), -INT8_C(  71), -INT8_C(  19),  INT8_C(  30),  INT8_C(  71), -INT8_C(  60),  INT8_C( 115),
+      -INT8_C(  22), -INT8_C(  30),  INT8_C(  95), -INT8_C(  44),  INT8_C(  83), -INT8_C( 106), -INT8_C(  34), -INT8_C(  25),
+      -INT8_C(  76), -INT8_C(  26),  INT8_C( 122),  INT8_C(  72), -INT8_C(   7), -INT8_C(  66), -INT8_C(  78),  INT8_C(  74),
+      -INT8_C( 120),  INT8_C(  58), -INT8_C(  67),  INT8_C(  58), -INT8_C(  53), -INT8_C( 106),  INT8_C(  73), -INT8_C( 121),
+           INT8_MAX, -INT8_C( 112),  INT8_C( 122), -INT8_C(  77), -INT8_C( 108), -INT8_C(  98), -INT8_C(  71), -INT8_C( 102),
+       INT8_C(  82),  INT8_C(  24),  INT8_C(  93), -INT8_C( 112), -INT8_C(  64), -INT8_C(  45),  INT8_C(  16), -INT8_C(  56),
+       INT8_C(  10),  INT8_C( 103),  INT8_C(  32), -INT8_C(  77),      INT8_MAX, -INT8_C(  55),  INT8_C( 123),  INT8_C(  68),
+      -INT8_C(  35),  INT8_C(  16),  INT8_C(  57),  INT8_C( 125),  INT8_C(  49), -INT8_C( 100),  INT8_C(  81), -INT8_C(  85),
+      -INT8_C(  60),  INT8_C(  95), -INT8_C(  97), -INT8_C( 126), -INT8_C(   3), -INT8_C(  98), -INT8_C(  74), -INT8_C(  93),
+       INT8_C(   9), -INT8_C(  98),  INT8_C(  73),  INT8_C(  72), -INT8_C(  16), -INT8_C(  42),  INT8_C(  79),  INT8_C(  18),
+       INT8_C(  61),  INT8_C( 111), -INT8_C(  59),  INT8_C(  99), -INT8_C(  65), -INT8_C(  61),  INT8_C(  17), -INT8_C( 123),
+      -INT8_C( 102), -INT8_C(   2),  INT8_C( 112), -INT8_C(  52),  INT8_C( 108), -INT8_C(  60), -INT8_C(  70), -INT8_C(  80),
+       INT8_C(  27), -INT8_C(  51), -INT8_C(  16),  INT8_C( 108),  INT8_C(  45), -INT8_C( 119),  INT8_C(  72), -INT8_C(  28),
+      -INT8_C(  55),  INT8_C(  57), -INT8_C(  85),  INT8_C(  67),  INT8_C(  47), -INT8_C(  86),  INT8_C(  90), -INT8_C(  84),
+       INT8_C(  72), -INT8_C( 106), -INT8_C(  48), -INT8_C(  99), -INT8_C( 123), -INT8_C(  31), -INT8_C(   2),  INT8_C(  31),
+      -INT8_C(  33),  INT8_C(  98), -INT8_C(  21), -INT8_C(  61),  INT8_C( 125),  INT8_C(   3), -INT8_C( 127), -INT8_C(  31),
+      -INT8_C(   9),  INT8_C( 113) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1b_s32(pv, &(r[i]), simde_svld1_s32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  int32_t a[1024 / sizeof(int32_t)];
+  int8_t b[1024 / sizeof(int32_t)];
+  int8_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1b_s32(pv, &(e[i]), simde_svld1_s32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1b_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 7911084153034058359),  INT64_C( 4047631088495763712),  INT64_C( 7749798226284541112), -INT64_C( 3733627840081438048),
+      -INT64_C( 8375382991690375854),  INT64_C( 3317555845291991754),  INT64_C( 2206747866782019271), -INT64_C( 2388840142418538549),
+      -INT64_C( 4641005642552619904), -INT64_C( 2892266364728132296), -INT64_C(  223302901227044791),  INT64_C( 8873749309154843066),
+       INT64_C( 4892068128437515823),  INT64_C( 6468238962412582363),  INT64_C( 3835948109022678798),  INT64_C( 6437509918520788703),
+      -INT64_C( 2943557571975455273), -INT64_C(  918867476983113770),  INT64_C( 5045841820390678614), -INT64_C(  416733444574182732),
+      -INT64_C( 1430170962285972395), -INT64_C( 4039145634965231078),  INT64_C( 5197046852856849778),  INT64_C(  882527093691662369),
+       INT64_C( 4113057629035371537),  INT64_C( 7829274829415638895), -INT64_C(  131619384920293552), -INT64_C( 4582268931187453276),
+      -INT64_C( 5118626532811029090), -INT64_C( 6104559631125172253), -INT64_C( 7684623168839905922), -INT64_C( 4792576435603530483),
+       INT64_C( 4909048256995681566),  INT64_C( 8549918935672207520), -INT64_C(   36822700637669642), -INT64_C( 1898485187113881910),
+       INT64_C( 3693916601784803998), -INT64_C( 4353618767609109723),  INT64_C( 6844953099747681804), -INT64_C( 7978988811255760233),
+       INT64_C( 2583047476933071121), -INT64_C( 1601357472264550602),  INT64_C( 3471684436065022267),  INT64_C( 8513161624562922912),
+      -INT64_C( 4790155965358230428), -INT64_C( 2900170156145588487),  INT64_C( 3369206605532276983), -INT64_C( 8709146787996151736),
+       INT64_C( 3016689573614402969),  INT64_C( 2065110594012290613),  INT64_C( 7576020090302058087),  INT64_C( 7091543002980934847),
+      -INT64_C(  518651992977812619), -INT64_C(  847114833206063618),  INT64_C( 1822002208219720639),  INT64_C(  800908006815129329),
+      -INT64_C(  111608124725485383),  INT64_C( 7839464776611675210), -INT64_C( 5495071311404420022), -INT64_C( 2911987145760654860),
+       INT64_C( 1020565332123928107), -INT64_C(  928391705304675837), -INT64_C(  875574098194306716), -INT64_C(  142967494741768434),
+       INT64_C( 2390095416053552985),  INT64_C( 2610379968627151005),  INT64_C( 3839920284161986904),  INT64_C( 3763716104923563882),
+       INT64_C( 6124188197410923710),  INT64_C( 1545250056663912332),  INT64_C( 5260968387045800869), -INT64_C( 8462895045634792322),
+      -INT64_C( 1715198162355429594),  INT64_C( 5045902543158561843), -INT64_C( 6374541630165061023), -INT64_C(  590378571210420103),
+      -INT64_C( 3697446936990370452), -INT64_C( 1460641229208492845),  INT64_C( 6486789718337637429), -INT64_C(   32249145962134076),
+       INT64_C( 4397614855008772770), -INT64_C( 4913308966337789093),  INT64_C( 8390802797412088631),  INT64_C( 2356676174992249123),
+       INT64_C( 5665918599414119418), -INT64_C(  835975468163050971), -INT64_C( 4601412604042313729), -INT64_C( 4526633545326252400),
+       INT64_C( 1289937058460436902),  INT64_C( 2146285312760617496), -INT64_C( 1873232092229413214),  INT64_C( 5163134676075116063),
+      -INT64_C( 6149165483265373011),  INT64_C( 3106156125519570656), -INT64_C(  478669254151116769),  INT64_C( 2434906383533953250),
+       INT64_C( 5804686306252008018),  INT64_C( 8393981095662456265),  INT64_C( 3973377003358906706), -INT64_C( 2654162206761221227),
+       INT64_C( 1220278994058863663), -INT64_C(  494024147792151206), -INT64_C( 1705376262569849144), -INT64_C( 4201545547478069172),
+       INT64_C( 1826021350140309760),  INT64_C( 7003640137876355473), -INT64_C( 1497494570395543813),  INT64_C( 5061609773443656164),
+      -INT64_C( 8594022612159585308),  INT64_C( 7897609993946498206), -INT64_C( 3399105094908897208), -INT64_C( 1466053588407446500),
+      -INT64_C( 5140215648092277461), -INT64_C( 6436337254533141554),  INT64_C( 8673195507525249441),  INT64_C( 6478570102799902453) };
+  static const int64_t a[] =
+    {  INT64_C(  378542140013548182), -INT64_C( 8471242248659008116),  INT64_C( 4572200073282603875), -INT64_C( 5713267912426396163),
+       INT64_C( 2490224059184102519),  INT64_C( 8334548896463517202),  INT64_C( 7317189857668608399), -INT64_C( 7452981153549796410),
+       INT64_C( 9017808897756519789), -INT64_C( 3734812036046128729),  INT64_C( 4667598909338065401), -INT64_C( 2371231573470035617),
+      -INT64_C( 7857083791957673713), -INT64_C( 3095812580547324928),  INT64_C( 2722985379357925903), -INT64_C( 6192242112912365122),
+      -INT64_C(  399946277101243659),  INT64_C( 4782613018908868014),  INT64_C( 5714668328372114787), -INT64_C( 6574251949309234306),
+      -INT64_C( 5874954507908684158),  INT64_C( 6065108384145256373),  INT64_C(  652402421607036716), -INT64_C( 6912210563495719489),
+       INT64_C( 5006757656566470604),  INT64_C( 8612950991885480770), -INT64_C( 8077975792292395952), -INT64_C( 5076101115897116464),
+      -INT64_C( 9188467773011481945),  INT64_C( 6086397210263792308), -INT64_C( 4566907380634178497),  INT64_C( 6108073704249269277),
+       INT64_C(   46451390474308326), -INT64_C( 3312267149162096463),  INT64_C( 7769413379980081187), -INT64_C( 6693127789182812131),
+       INT64_C( 6976476800168208517),  INT64_C( 7649959109299916997), -INT64_C( 6264701091175462058),  INT64_C( 5057420067519760079),
+       INT64_C( 2902825475633575480), -INT64_C( 3356683126985171527),  INT64_C(  426298479006312117),  INT64_C( 2671409656539208970),
+      -INT64_C( 3800661974794294858),  INT64_C( 2449735456775717299),  INT64_C(  240465363318502427),  INT64_C( 6754521651071674282),
+      -INT64_C( 3177368564030518774),  INT64_C(  217863727465280122),  INT64_C( 6949804875514669430),  INT64_C( 3284728462802633105),
+       INT64_C( 4571489821574892669), -INT64_C( 1527235443007654941),  INT64_C( 6749432169360859796), -INT64_C( 3288425611829862131),
+      -INT64_C( 4955119746733332937),  INT64_C( 2211923322038804307), -INT64_C( 1900779797690708874), -INT64_C( 7648675268947266381),
+       INT64_C( 9055555960555260185), -INT64_C(  300060546977943252),  INT64_C(  270739692469435652),  INT64_C( 7063022219182200592),
+      -INT64_C( 8154050376948804049),  INT64_C( 1779232004030929968), -INT64_C( 2617798872084976041), -INT64_C( 3803202350285670772),
+      -INT64_C( 4983520465832866843), -INT64_C( 8340068147219457258),  INT64_C( 8698104463702111759),  INT64_C( 3818075358302699669),
+       INT64_C( 3555118134886866962), -INT64_C(  779510972101638548), -INT64_C( 3010228358449503531),  INT64_C( 2380156869093656709),
+       INT64_C( 4715573190980436773),  INT64_C( 4734991217033727450), -INT64_C( 8031542064011114893), -INT64_C( 4831117100936031549),
+      -INT64_C( 6843661883267042577),  INT64_C( 7919607409560185147), -INT64_C( 1641092410960123234), -INT64_C(  463396829867041474),
+       INT64_C( 3875844433521773921), -INT64_C( 2156164001739035732),  INT64_C( 2215144161165391022), -INT64_C( 8546279408704194462),
+      -INT64_C( 7907904342228655599), -INT64_C( 8013226574516511323),  INT64_C( 9115040572302972545),  INT64_C(  525601702769488538),
+       INT64_C( 2155627143677279601), -INT64_C( 1088796408829041807),  INT64_C(  270726603138484263),  INT64_C( 7727915251983035202),
+       INT64_C( 1631056941486920206), -INT64_C( 6831875451570771760), -INT64_C( 7781475430260506219), -INT64_C( 1822536351094028464),
+      -INT64_C(  785299632871933858),  INT64_C( 7408814811132560567), -INT64_C( 6139138179356903962),  INT64_C(  427185169728051758),
+       INT64_C( 2178936721214363938), -INT64_C( 4693277651864948057), -INT64_C( 2892503204217076778), -INT64_C( 7203002408369205411),
+      -INT64_C( 2474128531422703068), -INT64_C( 1213381340820014700),  INT64_C( 4753826359604682871), -INT64_C( 4188261198912432438),
+       INT64_C( 8751332889893848160),  INT64_C( 8357571484220508403), -INT64_C( 2138212466858714066),  INT64_C( 5100052687968704609) };
+  static const int8_t b[] =
+    { -INT8_C( 107),  INT8_C(  17), -INT8_C(   1), -INT8_C(  60), -INT8_C(  42),  INT8_C(   0), -INT8_C(  11), -INT8_C(  81),
+      -INT8_C(  58),  INT8_C(  69), -INT8_C(  86), -INT8_C(  41), -INT8_C(   2), -INT8_C(  13),  INT8_C(  75),  INT8_C( 125),
+      -INT8_C(  49), -INT8_C(  58),  INT8_C( 115),  INT8_C(  98),  INT8_C(  78),  INT8_C(  40), -INT8_C(   8), -INT8_C(  22),
+      -INT8_C(  55), -INT8_C(  30),  INT8_C( 106), -INT8_C(  54),  INT8_C(  61), -INT8_C(  75),  INT8_C( 124), -INT8_C(  46),
+      -INT8_C(  58),  INT8_C( 123), -INT8_C( 105), -INT8_C(  99),  INT8_C( 123), -INT8_C( 116),  INT8_C(  76),  INT8_C(  65),
+      -INT8_C(  47), -INT8_C(  10),  INT8_C(  25), -INT8_C(  49), -INT8_C(  23),  INT8_C( 100),  INT8_C(  77), -INT8_C(  72),
+       INT8_C(  43), -INT8_C(  64),  INT8_C(  26),  INT8_C( 121), -INT8_C(  24),  INT8_C(  18),  INT8_C(  99), -INT8_C(  79),
+      -INT8_C(  11), -INT8_C(  51),  INT8_C( 124),  INT8_C(  50), -INT8_C( 126), -INT8_C(   8),  INT8_C(   4),  INT8_C(  73),
+       INT8_C( 115), -INT8_C( 101), -INT8_C(  26), -INT8_C(  18),  INT8_C(  40),  INT8_C(  50),  INT8_C(  47), -INT8_C(   7),
+       INT8_C(  40),  INT8_C(  72), -INT8_C(  55),  INT8_C(  17), -INT8_C(  83),  INT8_C(  22), -INT8_C(  54), -INT8_C(  40),
+      -INT8_C(  42), -INT8_C(  28),  INT8_C(  81), -INT8_C(  65), -INT8_C(   9), -INT8_C(  76),  INT8_C( 112), -INT8_C(  20),
+      -INT8_C( 127), -INT8_C(  20),  INT8_C(  30),  INT8_C(   3), -INT8_C(  28),  INT8_C(  34),  INT8_C(  76),  INT8_C(  87),
+      -INT8_C(  66),  INT8_C(  50),  INT8_C(  69), -INT8_C(  26),  INT8_C( 100),  INT8_C( 117), -INT8_C(  33), -INT8_C( 116),
+      -INT8_C(  67), -INT8_C(  88), -INT8_C(  98),  INT8_C( 106), -INT8_C(  66),  INT8_C( 104),  INT8_C(  66), -INT8_C( 107),
+       INT8_C(  76), -INT8_C( 109),  INT8_C(  84),  INT8_C(  67) };
+  static const int8_t e[] =
+    { -INT8_C( 106),  INT8_C(  17), -INT8_C(   1), -INT8_C(   3),  INT8_C( 119),  INT8_C(   0), -INT8_C(  11), -INT8_C(  58),
+       INT8_C( 109), -INT8_C(  89), -INT8_C(   7), -INT8_C(  41), -INT8_C(   2), -INT8_C(  13),  INT8_C(  75),  INT8_C( 125),
+      -INT8_C(  11), -INT8_C(  82),  INT8_C( 115),  INT8_C( 126), -INT8_C( 126), -INT8_C(  75), -INT8_C(   8), -INT8_C(  22),
+      -INT8_C(  55), -INT8_C(  30),  INT8_C(  80), -INT8_C(  48), -INT8_C(  89), -INT8_C(  76),  INT8_C(  63),  INT8_C(  29),
+      -INT8_C(  58),  INT8_C( 123),  INT8_C(  35),  INT8_C(  29),  INT8_C( 123), -INT8_C(  59),  INT8_C(  76), -INT8_C(  49),
+      -INT8_C(  47), -INT8_C(  71),  INT8_C(  25), -INT8_C(  49), -INT8_C(  74), -INT8_C(  77),  INT8_C(  77), -INT8_C(  86),
+       INT8_C(  43), -INT8_C(  64),  INT8_C(  26),  INT8_C( 121),  INT8_C( 125), -INT8_C(  29),  INT8_C(  99), -INT8_C(  79),
+       INT8_C(  55), -INT8_C(  51),  INT8_C( 118), -INT8_C(  77), -INT8_C( 126),  INT8_C(  44),  INT8_C(   4),  INT8_C(  16),
+       INT8_C( 115), -INT8_C( 101), -INT8_C(  26), -INT8_C(  18),  INT8_C(  40),  INT8_C(  50),  INT8_C(  47), -INT8_C( 107),
+       INT8_C(  18),  INT8_C(  72), -INT8_C(  43), -INT8_C( 123),  INT8_C(  37), -INT8_C(  38), -INT8_C(  54), -INT8_C(  61),
+      -INT8_C(  42),  INT8_C(  59),  INT8_C(  81), -INT8_C(  65), -INT8_C(   9), -INT8_C(  84), -INT8_C(  82),  INT8_C(  98),
+      -INT8_C( 127), -INT8_C(  20), -INT8_C( 127),  INT8_C(   3),  INT8_C( 113),  INT8_C(  34),  INT8_C(  39),  INT8_C(  87),
+      -INT8_C(  66),  INT8_C(  50),  INT8_C(  69),  INT8_C(  80),  INT8_C( 100), -INT8_C(  73), -INT8_C(  26),  INT8_C(  46),
+      -INT8_C(  67), -INT8_C(  88), -INT8_C(  42),  INT8_C( 106),  INT8_C(  36),  INT8_C( 104),  INT8_C( 119), -INT8_C(  54),
+       INT8_C(  96), -INT8_C(  13),  INT8_C(  84),  INT8_C(  67) };
+
+  static int8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1b_s64(pv, &(r[i]), simde_svld1_s64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi8(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int64_t a[1024 / sizeof(int64_t)];
+  int8_t b[1024 / sizeof(int64_t)];
+  int8_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1b_s64(pv, &(e[i]), simde_svld1_s64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1b_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int16_t p[] =
+    { -INT16_C(  3161),  INT16_C( 25916), -INT16_C(  9572),  INT16_C( 23247),  INT16_C(  4674), -INT16_C( 28945),  INT16_C( 17317), -INT16_C(  4654),
+       INT16_C(   264), -INT16_C( 17995), -INT16_C( 32433), -INT16_C( 16562),  INT16_C( 15258), -INT16_C(  6675),  INT16_C(   366),  INT16_C(  5524),
+      -INT16_C( 12044), -INT16_C( 28550),  INT16_C( 19114), -INT16_C(  4885), -INT16_C(  9636),  INT16_C(   379),  INT16_C( 19742),  INT16_C(  9966),
+      -INT16_C( 23474), -INT16_C( 25121),  INT16_C( 11557), -INT16_C( 16548),  INT16_C( 18793), -INT16_C( 10332),  INT16_C( 14666),  INT16_C( 16364),
+       INT16_C( 26377), -INT16_C( 19249), -INT16_C( 17743),  INT16_C(  3488),  INT16_C(  7061), -INT16_C( 19698), -INT16_C(   664), -INT16_C( 18471),
+      -INT16_C( 18271), -INT16_C( 14764), -INT16_C( 19995),  INT16_C( 20102),  INT16_C( 11002),  INT16_C( 17701),  INT16_C(  4707),  INT16_C( 28036),
+       INT16_C( 21369),  INT16_C( 10785), -INT16_C( 16114), -INT16_C( 23753),  INT16_C( 17885),  INT16_C( 17750),  INT16_C( 12098), -INT16_C(  7172),
+       INT16_C( 20967), -INT16_C( 13142),  INT16_C( 12290), -INT16_C(   997),  INT16_C( 16474), -INT16_C( 16831), -INT16_C( 15022), -INT16_C( 13525),
+       INT16_C( 19481),  INT16_C( 10229),  INT16_C( 11277), -INT16_C(  5430),  INT16_C(  8306), -INT16_C( 19408),  INT16_C( 11343),  INT16_C( 13976),
+       INT16_C( 17021),  INT16_C( 32514),  INT16_C(  7538), -INT16_C( 13188), -INT16_C( 17058), -INT16_C( 20342), -INT16_C( 19069), -INT16_C( 25476),
+       INT16_C( 28929),  INT16_C(  4035), -INT16_C( 29282),  INT16_C(  4345),  INT16_C( 10669), -INT16_C(   828),  INT16_C( 23638), -INT16_C( 11470),
+       INT16_C( 13470),  INT16_C(  4179), -INT16_C( 12462), -INT16_C( 20259),  INT16_C( 26508),  INT16_C(  3936), -INT16_C(  9187),  INT16_C(  7851),
+       INT16_C( 28238), -INT16_C(  5075),  INT16_C( 10235), -INT16_C( 22276), -INT16_C( 16304), -INT16_C( 22876), -INT16_C( 10723), -INT16_C( 17542),
+      -INT16_C( 13045),  INT16_C( 24012), -INT16_C( 22116),  INT16_C( 10253),  INT16_C( 27920),  INT16_C( 11576), -INT16_C(  7350), -INT16_C( 26548),
+       INT16_C( 31058),  INT16_C( 19844), -INT16_C( 32608), -INT16_C(  3594), -INT16_C( 26048),  INT16_C( 23959),  INT16_C(  4465),  INT16_C( 31769),
+      -INT16_C(  6690),  INT16_C( 31449), -INT16_C(  6514), -INT16_C( 24925), -INT16_C(  9389), -INT16_C( 25140),  INT16_C(  6334),  INT16_C(  4149),
+      -INT16_C( 18031),  INT16_C( 12894),  INT16_C( 21561),  INT16_C( 31267), -INT16_C( 17682),  INT16_C( 24535), -INT16_C(  3892), -INT16_C( 21797),
+      -INT16_C( 19243),  INT16_C( 25381), -INT16_C( 14182), -INT16_C(  4606), -INT16_C( 12637),  INT16_C( 24971), -INT16_C( 15898),  INT16_C( 30578),
+      -INT16_C( 12166), -INT16_C( 19287), -INT16_C( 13276),  INT16_C(  4654),  INT16_C(  1415),  INT16_C( 21362),  INT16_C( 19958), -INT16_C( 13315),
+       INT16_C(  8706), -INT16_C( 25553),  INT16_C( 12778), -INT16_C( 29302),  INT16_C(  5887), -INT16_C(  6673),  INT16_C( 25047),  INT16_C( 20828),
+       INT16_C(  1585),  INT16_C( 21765),  INT16_C( 13266),  INT16_C( 22887), -INT16_C(  9927),  INT16_C( 12204), -INT16_C( 21977),  INT16_C( 10746),
+       INT16_C( 10700), -INT16_C( 18491),  INT16_C( 20570),  INT16_C( 22852),  INT16_C( 13158),  INT16_C( 15678), -INT16_C( 25708), -INT16_C( 14962),
+      -INT16_C( 27487),  INT16_C( 29466), -INT16_C( 32057),  INT16_C(   205),  INT16_C( 31067), -INT16_C( 32209),  INT16_C( 10787), -INT16_C(  3925),
+       INT16_C( 29011), -INT16_C( 20825), -INT16_C(  5183),  INT16_C(  9991),  INT16_C( 17951), -INT16_C( 19612), -INT16_C(  3359), -INT16_C( 32135),
+      -INT16_C( 27770),  INT16_C( 20213), -INT16_C( 15851),  INT16_C( 29006),  INT16_C( 32316),  INT16_C( 24563), -INT16_C( 24664), -INT16_C(  1201),
+      -INT16_C(  2544), -INT16_C( 11863), -INT16_C( 19998),  INT16_C(   504),  INT16_C( 23799), -INT16_C( 10060),  INT16_C( 11598), -INT16_C( 10918),
+       INT16_C( 20417), -INT16_C( 10717),  INT16_C( 28946),  INT16_C( 20039),  INT16_C( 15343), -INT16_C( 26707), -INT16_C(   550), -INT16_C(  5485),
+       INT16_C( 15603), -INT16_C( 10821), -INT16_C( 19475), -INT16_C(  6954), -INT16_C( 29937),  INT16_C( 23996),  INT16_C(  5816),  INT16_C( 31026),
+       INT16_C( 21862),  INT16_C( 30800), -INT16_C( 26681), -INT16_C( 18746),  INT16_C( 29650), -INT16_C( 21426), -INT16_C(  7824),  INT16_C( 25750),
+       INT16_C( 20765),  INT16_C(  2873),  INT16_C(  4100),  INT16_C(  5103), -INT16_C( 21349),  INT16_C( 21361), -INT16_C( 23614),  INT16_C( 10445),
+       INT16_C(  7673), -INT16_C( 16224),  INT16_C( 26292), -INT16_C( 30858), -INT16_C( 15142),  INT16_C( 18995), -INT16_C( 13659), -INT16_C( 15442),
+      -INT16_C(  6117),  INT16_C(  8398), -INT16_C( 16904), -INT16_C( 27853), -INT16_C( 23447),  INT16_C( 11494), -INT16_C( 19640),  INT16_C( 16724),
+      -INT16_C(  2608), -INT16_C( 31487),  INT16_C( 30555),  INT16_C( 13580),  INT16_C( 16188), -INT16_C(  7808),  INT16_C( 11785),  INT16_C(  9636),
+       INT16_C( 29206),  INT16_C(  3653),  INT16_C( 30768), -INT16_C( 26207), -INT16_C( 30691),  INT16_C( 26053),  INT16_C(  6715),  INT16_C(  3238),
+      -INT16_C( 22769),  INT16_C( 27281), -INT16_C( 25314),  INT16_C( 23200),  INT16_C(  8412), -INT16_C(  6596), -INT16_C(  8114),  INT16_C( 25867),
+       INT16_C( 20563), -INT16_C( 31885),  INT16_C(  5576), -INT16_C(  6884), -INT16_C(  7523), -INT16_C( 10166), -INT16_C(  3844),  INT16_C(  3044),
+       INT16_C( 30103), -INT16_C( 18827),  INT16_C(  5394), -INT16_C(  4336),  INT16_C( 19509), -INT16_C( 31531), -INT16_C(  8147), -INT16_C( 32535),
+       INT16_C( 23600), -INT16_C(  2045),  INT16_C(  8049),  INT16_C(  3806),  INT16_C( 10241), -INT16_C(   537), -INT16_C( 13543), -INT16_C( 20472),
+       INT16_C( 32321),  INT16_C( 21350),  INT16_C( 30611), -INT16_C( 14014),  INT16_C(  6083), -INT16_C(  4019),  INT16_C( 14071),  INT16_C( 10096),
+       INT16_C( 29586),  INT16_C(  1056), -INT16_C(   365), -INT16_C( 27630), -INT16_C(  1754),  INT16_C( 16274), -INT16_C( 25915),  INT16_C(  1776),
+       INT16_C( 22040), -INT16_C( 21415), -INT16_C( 25395), -INT16_C( 28299), -INT16_C( 15693), -INT16_C( 21631), -INT16_C(  3336), -INT16_C( 29998),
+      -INT16_C(  3483), -INT16_C(  1906), -INT16_C( 24080) };
+  static const uint16_t a[] =
+    { UINT16_C(45009), UINT16_C(38089), UINT16_C(47351), UINT16_C( 4959), UINT16_C(32242), UINT16_C(34873), UINT16_C(24935), UINT16_C(20681),
+      UINT16_C(48968), UINT16_C(13576), UINT16_C(36803), UINT16_C(53306), UINT16_C(16667), UINT16_C(33328), UINT16_C(25228), UINT16_C(24278),
+      UINT16_C(40721), UINT16_C( 2290), UINT16_C(21079), UINT16_C(18715), UINT16_C(21711), UINT16_C(14034), UINT16_C(39862), UINT16_C(65159),
+      UINT16_C(36699), UINT16_C( 7731), UINT16_C(27934), UINT16_C(15087), UINT16_C( 8111), UINT16_C(15292), UINT16_C(37505), UINT16_C(37529),
+      UINT16_C(35889), UINT16_C(34970), UINT16_C(46558), UINT16_C(44498), UINT16_C(41994), UINT16_C(49379), UINT16_C(27199), UINT16_C(39614),
+      UINT16_C(62202), UINT16_C( 6329), UINT16_C(43103), UINT16_C( 3666), UINT16_C( 4039), UINT16_C(18762), UINT16_C(58273), UINT16_C(54235),
+      UINT16_C(30319), UINT16_C(19803), UINT16_C(11563), UINT16_C(13818), UINT16_C(57041), UINT16_C( 4597), UINT16_C(46152), UINT16_C(17067),
+      UINT16_C(25766), UINT16_C( 1371), UINT16_C(44300), UINT16_C(54292), UINT16_C(24252), UINT16_C(24093), UINT16_C(63553), UINT16_C(45361),
+      UINT16_C(35950), UINT16_C(39678), UINT16_C(63930), UINT16_C(35791), UINT16_C(50647), UINT16_C( 8092), UINT16_C(18553), UINT16_C( 8034),
+      UINT16_C(48556), UINT16_C(47396), UINT16_C(14442), UINT16_C(10125), UINT16_C(43670), UINT16_C(55429), UINT16_C(46754), UINT16_C( 4489),
+      UINT16_C(34626), UINT16_C(64683), UINT16_C(31360), UINT16_C(22408), UINT16_C( 9279), UINT16_C(47223), UINT16_C(55660), UINT16_C( 6615),
+      UINT16_C(64662), UINT16_C(  210), UINT16_C(24372), UINT16_C(52007), UINT16_C(44041), UINT16_C(43939), UINT16_C(11362), UINT16_C(42428),
+      UINT16_C(26547), UINT16_C(13473), UINT16_C(10722), UINT16_C( 8587), UINT16_C(  590), UINT16_C(47834), UINT16_C(45531), UINT16_C(29139),
+      UINT16_C(42413), UINT16_C(57970), UINT16_C(39172), UINT16_C( 3501), UINT16_C(20550), UINT16_C(43193), UINT16_C(30076), UINT16_C(12109),
+      UINT16_C(61405), UINT16_C(48995), UINT16_C(61208), UINT16_C(26336), UINT16_C(47857), UINT16_C(52513), UINT16_C(62572), UINT16_C( 6462),
+      UINT16_C(45210), UINT16_C(40699), UINT16_C(43082), UINT16_C(37036), UINT16_C(26104), UINT16_C(29752), UINT16_C(34522), UINT16_C(47012),
+      UINT16_C( 1909), UINT16_C(36214), UINT16_C(22518), UINT16_C(59636), UINT16_C( 5393), UINT16_C(32181), UINT16_C(62217), UINT16_C(41879),
+      UINT16_C(37540), UINT16_C(60994), UINT16_C(60987), UINT16_C(13182), UINT16_C(46675), UINT16_C(11688), UINT16_C(19516), UINT16_C(45541),
+      UINT16_C(23379), UINT16_C(19007), UINT16_C(13234), UINT16_C(50226), UINT16_C(59208), UINT16_C(20801), UINT16_C(55514), UINT16_C(32501),
+      UINT16_C(14187), UINT16_C(42604), UINT16_C(59941), UINT16_C(30937), UINT16_C(33185), UINT16_C(56741), UINT16_C(35533), UINT16_C( 8591),
+      UINT16_C(52966), UINT16_C(39019), UINT16_C(40193), UINT16_C(18780), UINT16_C(40580), UINT16_C(24218), UINT16_C(36726), UINT16_C(57821),
+      UINT16_C(18886), UINT16_C(60295), UINT16_C(24884), UINT16_C(54627), UINT16_C( 2530), UINT16_C(45234), UINT16_C(16787), UINT16_C(31185),
+      UINT16_C(15375), UINT16_C( 4114), UINT16_C(28377), UINT16_C(23897), UINT16_C(62476), UINT16_C(33723), UINT16_C(39043), UINT16_C(19044),
+      UINT16_C(60642), UINT16_C( 5685), UINT16_C(39245), UINT16_C(12267), UINT16_C(40354), UINT16_C(13791), UINT16_C(45279), UINT16_C(61103),
+      UINT16_C(49644), UINT16_C(50687), UINT16_C(22575), UINT16_C(15394), UINT16_C(56908), UINT16_C(53439), UINT16_C( 9078), UINT16_C(22554),
+      UINT16_C(20239), UINT16_C(23662), UINT16_C(23016), UINT16_C(35468), UINT16_C(27639), UINT16_C(54976), UINT16_C(28444), UINT16_C( 2244),
+      UINT16_C(49968), UINT16_C(24526), UINT16_C(61468), UINT16_C(26779), UINT16_C(23246), UINT16_C(17720), UINT16_C(21118), UINT16_C(36253),
+      UINT16_C( 3234), UINT16_C(35562), UINT16_C(30309), UINT16_C(23573), UINT16_C(54753), UINT16_C(64818), UINT16_C(63300), UINT16_C(29702),
+      UINT16_C(54458), UINT16_C(54995), UINT16_C(28612), UINT16_C(37695), UINT16_C(30665), UINT16_C(18392), UINT16_C(30154), UINT16_C(27861),
+      UINT16_C(49025), UINT16_C(59382), UINT16_C( 2869), UINT16_C( 5699), UINT16_C(30432), UINT16_C( 9236), UINT16_C( 6765), UINT16_C(10136),
+      UINT16_C(27886), UINT16_C(45822), UINT16_C(15835), UINT16_C(42053), UINT16_C( 7604), UINT16_C(32492), UINT16_C(49555), UINT16_C( 5354),
+      UINT16_C(57728), UINT16_C(46587), UINT16_C(16364), UINT16_C(52683), UINT16_C(57269), UINT16_C( 8945), UINT16_C(35577), UINT16_C(59209),
+      UINT16_C(18422), UINT16_C(53658), UINT16_C(57220), UINT16_C(14709), UINT16_C(25085), UINT16_C(37047), UINT16_C(41506), UINT16_C(41636),
+      UINT16_C(41091), UINT16_C(28503), UINT16_C( 9183), UINT16_C(37948), UINT16_C(11778), UINT16_C(64694), UINT16_C(65464), UINT16_C(44771),
+      UINT16_C(32071), UINT16_C(52095), UINT16_C(62557), UINT16_C(23044), UINT16_C(48214), UINT16_C(30954), UINT16_C(36446), UINT16_C(57627),
+      UINT16_C(29230), UINT16_C( 3408), UINT16_C(36245), UINT16_C(39073), UINT16_C(22459), UINT16_C(29588), UINT16_C(30551), UINT16_C(40481),
+      UINT16_C(41205), UINT16_C(21097), UINT16_C(28308), UINT16_C(60076), UINT16_C(38442), UINT16_C(34915), UINT16_C(32292), UINT16_C(21353),
+      UINT16_C(47600), UINT16_C(34400), UINT16_C(  582), UINT16_C(  286), UINT16_C(45657), UINT16_C(45172), UINT16_C(38185), UINT16_C( 7758),
+      UINT16_C(47157), UINT16_C(51824), UINT16_C( 7206), UINT16_C(20660), UINT16_C( 6066), UINT16_C(55256), UINT16_C(16789), UINT16_C(34346),
+      UINT16_C(35578), UINT16_C(16652), UINT16_C(10892), UINT16_C(58946), UINT16_C(47068), UINT16_C( 1430), UINT16_C(58700), UINT16_C(33316),
+      UINT16_C(38045), UINT16_C(49996), UINT16_C(  177), UINT16_C(25363), UINT16_C(60184), UINT16_C(44346), UINT16_C(25644), UINT16_C( 9779),
+      UINT16_C(16367), UINT16_C(31591), UINT16_C(43625) };
+  static const uint8_t b[] =
+    { UINT8_C(  7), UINT8_C(157), UINT8_C( 69), UINT8_C(157), UINT8_C(160), UINT8_C(109), UINT8_C(193), UINT8_C(238),
+      UINT8_C(240), UINT8_C( 33), UINT8_C( 44), UINT8_C(  3), UINT8_C(178), UINT8_C(240), UINT8_C(  7), UINT8_C(216),
+      UINT8_C( 73), UINT8_C(106), UINT8_C( 37), UINT8_C(235), UINT8_C(226), UINT8_C(205), UINT8_C(213), UINT8_C(120),
+      UINT8_C(196), UINT8_C( 14), UINT8_C(246), UINT8_C( 60), UINT8_C(102), UINT8_C(  9), UINT8_C(244), UINT8_C(109),
+      UINT8_C(166), UINT8_C( 57), UINT8_C( 10), UINT8_C( 71), UINT8_C(166), UINT8_C(203), UINT8_C( 53), UINT8_C(150),
+      UINT8_C(236), UINT8_C( 97), UINT8_C(153), UINT8_C(159), UINT8_C( 81), UINT8_C(160), UINT8_C(119), UINT8_C(154),
+      UINT8_C( 11), UINT8_C(156), UINT8_C(133), UINT8_C(237), UINT8_C(106), UINT8_C( 91), UINT8_C(101), UINT8_C( 46),
+      UINT8_C(105), UINT8_C( 92), UINT8_C(106), UINT8_C(207), UINT8_C(101), UINT8_C( 95), UINT8_C( 60), UINT8_C( 11),
+      UINT8_C(152), UINT8_C( 70), UINT8_C( 82), UINT8_C( 63), UINT8_C( 17), UINT8_C(135), UINT8_C(213), UINT8_C(254),
+      UINT8_C(233), UINT8_C(111), UINT8_C(157), UINT8_C( 58), UINT8_C( 15), UINT8_C( 20), UINT8_C(213), UINT8_C( 26),
+      UINT8_C(177), UINT8_C( 90), UINT8_C(  7), UINT8_C( 27), UINT8_C(181), UINT8_C(109), UINT8_C( 73), UINT8_C( 30),
+      UINT8_C(201), UINT8_C(180), UINT8_C(237), UINT8_C( 46), UINT8_C( 19), UINT8_C( 41), UINT8_C( 57), UINT8_C(171),
+      UINT8_C(111), UINT8_C(140), UINT8_C(234), UINT8_C(129), UINT8_C( 19), UINT8_C(192), UINT8_C(127), UINT8_C(252),
+      UINT8_C( 47), UINT8_C( 28), UINT8_C( 55), UINT8_C( 62), UINT8_C( 48), UINT8_C( 12), UINT8_C( 89), UINT8_C(225),
+      UINT8_C(102), UINT8_C( 96), UINT8_C(252), UINT8_C( 28), UINT8_C(205), UINT8_C( 70), UINT8_C( 58), UINT8_C(150),
+      UINT8_C(250), UINT8_C( 40), UINT8_C(196), UINT8_C( 13), UINT8_C( 81), UINT8_C(254), UINT8_C(184), UINT8_C(193),
+      UINT8_C(138), UINT8_C(163), UINT8_C( 66), UINT8_C(157), UINT8_C( 99), UINT8_C(193), UINT8_C(154), UINT8_C(146),
+      UINT8_C(221), UINT8_C(209), UINT8_C(208), UINT8_C( 13), UINT8_C(221), UINT8_C( 41), UINT8_C(239), UINT8_C( 67),
+      UINT8_C(138), UINT8_C(235), UINT8_C( 95), UINT8_C( 87), UINT8_C( 49), UINT8_C(154), UINT8_C(238), UINT8_C( 43),
+      UINT8_C(194), UINT8_C(178), UINT8_C( 56), UINT8_C( 19), UINT8_C(176), UINT8_C(241), UINT8_C(212), UINT8_C( 58),
+      UINT8_C(148), UINT8_C( 22), UINT8_C(216), UINT8_C(247), UINT8_C(215), UINT8_C(114), UINT8_C(137), UINT8_C(180),
+      UINT8_C( 67), UINT8_C( 89), UINT8_C(194), UINT8_C( 32), UINT8_C(131), UINT8_C(177), UINT8_C( 99), UINT8_C( 13),
+      UINT8_C(156), UINT8_C(195), UINT8_C(100), UINT8_C(206), UINT8_C( 93), UINT8_C( 82), UINT8_C(249), UINT8_C( 31),
+      UINT8_C(  5), UINT8_C( 50), UINT8_C( 50), UINT8_C(181), UINT8_C( 35), UINT8_C(  7), UINT8_C(240), UINT8_C(183),
+      UINT8_C( 29), UINT8_C(200), UINT8_C(174), UINT8_C(245), UINT8_C( 58), UINT8_C( 55), UINT8_C(169), UINT8_C(125),
+      UINT8_C(144), UINT8_C(107), UINT8_C(157), UINT8_C( 19), UINT8_C( 28), UINT8_C(  0), UINT8_C( 32), UINT8_C(185),
+      UINT8_C(195), UINT8_C(133), UINT8_C(135), UINT8_C( 32), UINT8_C(215), UINT8_C(128), UINT8_C( 63), UINT8_C(220),
+      UINT8_C(178), UINT8_C(114), UINT8_C(146), UINT8_C(213), UINT8_C(121), UINT8_C(130), UINT8_C(140), UINT8_C(150),
+      UINT8_C( 74), UINT8_C( 58), UINT8_C(139), UINT8_C(132), UINT8_C(113), UINT8_C( 53), UINT8_C(  1), UINT8_C(  2),
+      UINT8_C(160), UINT8_C(158), UINT8_C( 21), UINT8_C(189), UINT8_C(158), UINT8_C( 54), UINT8_C(118), UINT8_C( 98),
+      UINT8_C(187), UINT8_C(253), UINT8_C(130), UINT8_C(146), UINT8_C(125), UINT8_C(194), UINT8_C(111), UINT8_C( 48),
+      UINT8_C( 52), UINT8_C(  1), UINT8_C(  5), UINT8_C(173), UINT8_C(131), UINT8_C(146), UINT8_C( 67), UINT8_C(205),
+      UINT8_C(204), UINT8_C(207), UINT8_C( 81), UINT8_C( 62), UINT8_C(  4), UINT8_C( 82), UINT8_C( 64), UINT8_C(164),
+      UINT8_C(240), UINT8_C( 85), UINT8_C( 97), UINT8_C(142), UINT8_C(139), UINT8_C(215), UINT8_C(240), UINT8_C( 70),
+      UINT8_C(212), UINT8_C(115), UINT8_C(217), UINT8_C( 82), UINT8_C( 53), UINT8_C( 72), UINT8_C(130), UINT8_C(105),
+      UINT8_C( 73), UINT8_C(135), UINT8_C( 22), UINT8_C(204), UINT8_C( 25), UINT8_C( 89), UINT8_C(153), UINT8_C(230),
+      UINT8_C( 40), UINT8_C(234), UINT8_C( 36), UINT8_C( 44), UINT8_C( 60), UINT8_C(100), UINT8_C(209), UINT8_C( 44),
+      UINT8_C(185), UINT8_C( 50), UINT8_C(186), UINT8_C( 69), UINT8_C( 10), UINT8_C(171), UINT8_C(139), UINT8_C(222),
+      UINT8_C( 30), UINT8_C(100), UINT8_C( 48), UINT8_C( 83), UINT8_C(172), UINT8_C(178), UINT8_C(188), UINT8_C(245),
+      UINT8_C( 58), UINT8_C(210), UINT8_C(193), UINT8_C( 83), UINT8_C( 43), UINT8_C( 90), UINT8_C( 57), UINT8_C( 84),
+      UINT8_C( 68), UINT8_C( 93), UINT8_C(128), UINT8_C(128), UINT8_C(193), UINT8_C( 81), UINT8_C(172), UINT8_C(123),
+      UINT8_C(132), UINT8_C(103), UINT8_C(192) };
+  static const uint8_t e[] =
+    { UINT8_C(209), UINT8_C(157), UINT8_C(247), UINT8_C(157), UINT8_C(160), UINT8_C( 57), UINT8_C(193), UINT8_C(201),
+      UINT8_C(240), UINT8_C(  8), UINT8_C(195), UINT8_C( 58), UINT8_C(178), UINT8_C( 48), UINT8_C(  7), UINT8_C(216),
+      UINT8_C( 17), UINT8_C(242), UINT8_C( 37), UINT8_C( 27), UINT8_C(207), UINT8_C(205), UINT8_C(213), UINT8_C(120),
+      UINT8_C( 91), UINT8_C( 51), UINT8_C(246), UINT8_C(239), UINT8_C(102), UINT8_C(188), UINT8_C(244), UINT8_C(109),
+      UINT8_C(166), UINT8_C(154), UINT8_C(222), UINT8_C( 71), UINT8_C(166), UINT8_C(227), UINT8_C( 63), UINT8_C(190),
+      UINT8_C(250), UINT8_C(185), UINT8_C( 95), UINT8_C(159), UINT8_C( 81), UINT8_C(160), UINT8_C(119), UINT8_C(154),
+      UINT8_C( 11), UINT8_C(156), UINT8_C( 43), UINT8_C(250), UINT8_C(106), UINT8_C( 91), UINT8_C(101), UINT8_C(171),
+      UINT8_C(105), UINT8_C( 91), UINT8_C(106), UINT8_C( 20), UINT8_C(101), UINT8_C( 29), UINT8_C( 65), UINT8_C( 49),
+      UINT8_C(152), UINT8_C( 70), UINT8_C( 82), UINT8_C(207), UINT8_C( 17), UINT8_C(156), UINT8_C(213), UINT8_C(254),
+      UINT8_C(233), UINT8_C(111), UINT8_C(157), UINT8_C(141), UINT8_C(150), UINT8_C(133), UINT8_C(162), UINT8_C(137),
+      UINT8_C(177), UINT8_C( 90), UINT8_C(128), UINT8_C( 27), UINT8_C(181), UINT8_C(119), UINT8_C( 73), UINT8_C(215),
+      UINT8_C(201), UINT8_C(180), UINT8_C( 52), UINT8_C( 39), UINT8_C( 19), UINT8_C( 41), UINT8_C( 98), UINT8_C(171),
+      UINT8_C(111), UINT8_C(161), UINT8_C(234), UINT8_C(139), UINT8_C( 78), UINT8_C(218), UINT8_C(219), UINT8_C(211),
+      UINT8_C(173), UINT8_C( 28), UINT8_C(  4), UINT8_C( 62), UINT8_C( 48), UINT8_C( 12), UINT8_C(124), UINT8_C( 77),
+      UINT8_C(102), UINT8_C( 96), UINT8_C( 24), UINT8_C(224), UINT8_C(241), UINT8_C( 70), UINT8_C( 58), UINT8_C(150),
+      UINT8_C(154), UINT8_C( 40), UINT8_C( 74), UINT8_C(172), UINT8_C(248), UINT8_C( 56), UINT8_C(184), UINT8_C(193),
+      UINT8_C(117), UINT8_C(163), UINT8_C( 66), UINT8_C(157), UINT8_C( 17), UINT8_C(193), UINT8_C(  9), UINT8_C(151),
+      UINT8_C(164), UINT8_C(209), UINT8_C( 59), UINT8_C(126), UINT8_C( 83), UINT8_C( 41), UINT8_C( 60), UINT8_C( 67),
+      UINT8_C( 83), UINT8_C( 63), UINT8_C(178), UINT8_C( 87), UINT8_C( 49), UINT8_C(154), UINT8_C(238), UINT8_C(245),
+      UINT8_C(194), UINT8_C(108), UINT8_C( 56), UINT8_C(217), UINT8_C(176), UINT8_C(165), UINT8_C(212), UINT8_C( 58),
+      UINT8_C(148), UINT8_C( 22), UINT8_C(216), UINT8_C(247), UINT8_C(132), UINT8_C(114), UINT8_C(118), UINT8_C(180),
+      UINT8_C( 67), UINT8_C(135), UINT8_C(194), UINT8_C( 32), UINT8_C(131), UINT8_C(177), UINT8_C(147), UINT8_C(209),
+      UINT8_C( 15), UINT8_C(195), UINT8_C(217), UINT8_C(206), UINT8_C( 93), UINT8_C(187), UINT8_C(249), UINT8_C(100),
+      UINT8_C(  5), UINT8_C( 53), UINT8_C( 77), UINT8_C(181), UINT8_C( 35), UINT8_C(223), UINT8_C(223), UINT8_C(175),
+      UINT8_C(236), UINT8_C(200), UINT8_C( 47), UINT8_C(245), UINT8_C( 58), UINT8_C( 55), UINT8_C(118), UINT8_C( 26),
+      UINT8_C( 15), UINT8_C(110), UINT8_C(232), UINT8_C( 19), UINT8_C( 28), UINT8_C(192), UINT8_C( 32), UINT8_C(196),
+      UINT8_C(195), UINT8_C(206), UINT8_C(135), UINT8_C( 32), UINT8_C(215), UINT8_C( 56), UINT8_C(126), UINT8_C(157),
+      UINT8_C(178), UINT8_C(234), UINT8_C(101), UINT8_C( 21), UINT8_C(225), UINT8_C(130), UINT8_C(140), UINT8_C(150),
+      UINT8_C( 74), UINT8_C( 58), UINT8_C(196), UINT8_C( 63), UINT8_C(113), UINT8_C(216), UINT8_C(202), UINT8_C(  2),
+      UINT8_C(160), UINT8_C(158), UINT8_C( 21), UINT8_C(189), UINT8_C(224), UINT8_C( 54), UINT8_C(109), UINT8_C( 98),
+      UINT8_C(187), UINT8_C(254), UINT8_C(130), UINT8_C( 69), UINT8_C(180), UINT8_C(194), UINT8_C(147), UINT8_C(234),
+      UINT8_C(128), UINT8_C(  1), UINT8_C(236), UINT8_C(203), UINT8_C(181), UINT8_C(146), UINT8_C(249), UINT8_C(205),
+      UINT8_C(246), UINT8_C(154), UINT8_C( 81), UINT8_C( 62), UINT8_C(  4), UINT8_C(183), UINT8_C( 64), UINT8_C(164),
+      UINT8_C(240), UINT8_C( 85), UINT8_C( 97), UINT8_C( 60), UINT8_C(  2), UINT8_C(215), UINT8_C(240), UINT8_C( 70),
+      UINT8_C( 71), UINT8_C(115), UINT8_C( 93), UINT8_C( 82), UINT8_C( 53), UINT8_C(234), UINT8_C( 94), UINT8_C(105),
+      UINT8_C( 73), UINT8_C( 80), UINT8_C( 22), UINT8_C(161), UINT8_C(187), UINT8_C(148), UINT8_C( 87), UINT8_C(230),
+      UINT8_C( 40), UINT8_C(105), UINT8_C( 36), UINT8_C(172), UINT8_C( 60), UINT8_C( 99), UINT8_C( 36), UINT8_C(105),
+      UINT8_C(185), UINT8_C( 96), UINT8_C(186), UINT8_C( 69), UINT8_C( 10), UINT8_C(116), UINT8_C( 41), UINT8_C( 78),
+      UINT8_C( 30), UINT8_C(100), UINT8_C( 48), UINT8_C(180), UINT8_C(172), UINT8_C(216), UINT8_C(188), UINT8_C(245),
+      UINT8_C( 58), UINT8_C(210), UINT8_C(140), UINT8_C( 66), UINT8_C(220), UINT8_C( 90), UINT8_C( 76), UINT8_C( 84),
+      UINT8_C( 68), UINT8_C( 76), UINT8_C(177), UINT8_C( 19), UINT8_C( 24), UINT8_C( 58), UINT8_C( 44), UINT8_C( 51),
+      UINT8_C(239), UINT8_C(103), UINT8_C(105) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+
+    simde_svst1b_u16(pv, &(r[i]), simde_svld1_u16(pg, &(a[i])));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int16_t p[1024 / sizeof(uint16_t)];
+  uint16_t a[1024 / sizeof(uint16_t)];
+  uint8_t b[1024 / sizeof(uint16_t)];
+  uint8_t e[1024 / sizeof(uint16_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b16_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b16(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s16(pg, simde_svld1_s16(pg, &(p[i])), simde_svdup_n_s16(INT16_C(0)));
+
+    simde_svst1b_u16(pv, &(e[i]), simde_svld1_u16(pg, &(a[i])));
+
+    i += simde_svcnth();
+    pg = simde_svwhilelt_b16_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1b_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(   715629847), -INT32_C(   910473160), -INT32_C(   252624265), -INT32_C(   441727143), -INT32_C(  2051575537),  INT32_C(  1704908807),  INT32_C(   777157131), -INT32_C(  1595807351),
+      -INT32_C(   959805298),  INT32_C(  1217365457),  INT32_C(   540574151),  INT32_C(  1460003656),  INT32_C(  1557970004), -INT32_C(  1614710124),  INT32_C(  2110591988), -INT32_C(  1977765892),
+       INT32_C(   139519799),  INT32_C(   877715564), -INT32_C(  1454077855), -INT32_C(  1073653141), -INT32_C(  1424171754),  INT32_C(  1279974744), -INT32_C(   322299664), -INT32_C(    25761849),
+       INT32_C(   990365391),  INT32_C(   124737446),  INT32_C(  1269941472),  INT32_C(   873181726), -INT32_C(   404805745), -INT32_C(   197907964),  INT32_C(   165740098), -INT32_C(  1274587419),
+      -INT32_C(  1007677923),  INT32_C(  1187733350),  INT32_C(  1100053539), -INT32_C(  1116299986), -INT32_C(   911911484), -INT32_C(  1044522625), -INT32_C(  1127571753),  INT32_C(   292672244),
+       INT32_C(  1188389344), -INT32_C(   460545856),  INT32_C(  1243946524),  INT32_C(  2131205051),  INT32_C(  1883811057),  INT32_C(  1546782341), -INT32_C(  1743127388), -INT32_C(  1347777842),
+      -INT32_C(  1409974293),  INT32_C(   999260703),  INT32_C(  1535489440),  INT32_C(  1104841808), -INT32_C(  1095621831), -INT32_C(   853810135), -INT32_C(  1352321824), -INT32_C(  1453453378),
+      -INT32_C(  1386982514),  INT32_C(  1978197205), -INT32_C(   372216423),  INT32_C(   858500090), -INT32_C(   135143986), -INT32_C(  1580987199), -INT32_C(    28300992), -INT32_C(   945312199),
+      -INT32_C(   680133630),  INT32_C(  2035113440), -INT32_C(   983425589), -INT32_C(  1762095672),  INT32_C(   730720618),  INT32_C(   919425526), -INT32_C(  1271587461), -INT32_C(   830743348),
+      -INT32_C(  1197084456),  INT32_C(   422703694), -INT32_C(   656501744), -INT32_C(  1938827743), -INT32_C(  1246233409), -INT32_C(   907246514),  INT32_C(  1853694370), -INT32_C(   700647171),
+       INT32_C(   932110825), -INT32_C(   464469804),  INT32_C(  1975266900), -INT32_C(  1023333628),  INT32_C(  1987688744), -INT32_C(   549493443), -INT32_C(  2092057466), -INT32_C(  1655076428),
+       INT32_C(  1070917739), -INT32_C(    64805720),  INT32_C(  1450303314),  INT32_C(   857371403),  INT32_C(  1772720940),  INT32_C(  2118772984),  INT32_C(  1476499108), -INT32_C(  1946789088),
+      -INT32_C(   339031485),  INT32_C(  1105718767), -INT32_C(   677881652), -INT32_C(   150293813),  INT32_C(  1029813061),  INT32_C(  1069263515),  INT32_C(  1620622400),  INT32_C(  1525386775),
+       INT32_C(  1195750744),  INT32_C(  1871260834),  INT32_C(  1346773381),  INT32_C(   407392723), -INT32_C(  1604998908), -INT32_C(  1814097837), -INT32_C(   453740596),  INT32_C(  1581178629),
+       INT32_C(   933594261),  INT32_C(   900083376),  INT32_C(   579267919),  INT32_C(  1111150142), -INT32_C(   891121801),  INT32_C(  1818083999),  INT32_C(  1062228281), -INT32_C(   962752975),
+      -INT32_C(  1006812654), -INT32_C(  1057446799), -INT32_C(   807174511), -INT32_C(  1022288564),  INT32_C(  1284371629), -INT32_C(   273093706),  INT32_C(  1831733308), -INT32_C(  1456223337),
+       INT32_C(  2137796878),  INT32_C(  1715430869),  INT32_C(   808788707), -INT32_C(   302823872), -INT32_C(   264666822), -INT32_C(  1461652884), -INT32_C(  1860825350), -INT32_C(   398767654),
+       INT32_C(  1332193146), -INT32_C(   256530932),  INT32_C(   153152201),  INT32_C(  1811288881),  INT32_C(     6041492),  INT32_C(   480853025),  INT32_C(   615366474), -INT32_C(  2096306168),
+      -INT32_C(  1663929456), -INT32_C(   477329382), -INT32_C(  1544770446),  INT32_C(  1410327232),  INT32_C(   861235985), -INT32_C(   246415705), -INT32_C(   988349251),  INT32_C(  1967661797),
+      -INT32_C(  1341056106),  INT32_C(   361995939),  INT32_C(   179928906),  INT32_C(  1918879841), -INT32_C(   626674637),  INT32_C(  1875637426), -INT32_C(   701177359), -INT32_C(  1706328828),
+       INT32_C(   994729112),  INT32_C(  1162927610), -INT32_C(  1118893732) };
+  static const uint32_t a[] =
+    { UINT32_C( 716088899), UINT32_C(2059412159), UINT32_C( 141237420), UINT32_C(1178373768), UINT32_C( 797029225), UINT32_C(3986656756), UINT32_C(1644625994), UINT32_C( 125847492),
+      UINT32_C(2888969965), UINT32_C(4230410832), UINT32_C(2533724430), UINT32_C(2312978720), UINT32_C(3921239797), UINT32_C( 920017132), UINT32_C( 496557400), UINT32_C( 287578148),
+      UINT32_C(2545768007), UINT32_C(1469375305), UINT32_C(2515442037), UINT32_C(3474901978), UINT32_C( 381212458), UINT32_C(2286718511), UINT32_C(2426791020), UINT32_C(1151519229),
+      UINT32_C(1775984416), UINT32_C(3099619139), UINT32_C(3813519112), UINT32_C(2763156346), UINT32_C(1924819779), UINT32_C(1710884601), UINT32_C(3908476907), UINT32_C(2301401193),
+      UINT32_C( 988940279), UINT32_C(2146611831), UINT32_C(3697426273), UINT32_C(4001371563), UINT32_C(2036349824), UINT32_C( 752835393), UINT32_C(1662309882), UINT32_C(1693204589),
+      UINT32_C(3214925384), UINT32_C(4064186769), UINT32_C(2093916625), UINT32_C( 912936886), UINT32_C(3417295498), UINT32_C( 553160229), UINT32_C(3498249315), UINT32_C(2503307341),
+      UINT32_C(3746878542), UINT32_C( 919769701), UINT32_C(3920797747), UINT32_C(2032082159), UINT32_C( 205901799), UINT32_C(3240901981), UINT32_C(2526130249), UINT32_C(1848362528),
+      UINT32_C(   5144474), UINT32_C(1161175058), UINT32_C(2955930048), UINT32_C(3962129925), UINT32_C(2079944221), UINT32_C(4114359723), UINT32_C(4119580117), UINT32_C( 778352532),
+      UINT32_C(1211019830), UINT32_C(2458805714), UINT32_C(1396882766), UINT32_C( 692087819), UINT32_C(2258909658), UINT32_C( 880533598), UINT32_C(1093207725), UINT32_C(4101017021),
+      UINT32_C( 289185343), UINT32_C(1369754115), UINT32_C(2477123207), UINT32_C( 767354194), UINT32_C(2092130334), UINT32_C(3987746368), UINT32_C(4063222324), UINT32_C(2816909159),
+      UINT32_C(1102586429), UINT32_C(1955749101), UINT32_C(2500278083), UINT32_C( 985842460), UINT32_C(1672967459), UINT32_C(3629213603), UINT32_C(2848620609), UINT32_C(1548791839),
+      UINT32_C(3214739666), UINT32_C(2821992549), UINT32_C(2218605415), UINT32_C( 582877439), UINT32_C( 428242293), UINT32_C( 519165917), UINT32_C(1992801111), UINT32_C(1037178731),
+      UINT32_C(2247979040), UINT32_C( 120402336), UINT32_C(1804298860), UINT32_C(3767421546), UINT32_C(2633569471), UINT32_C(1119611627), UINT32_C( 280527525), UINT32_C(3125643930),
+      UINT32_C(2587839226), UINT32_C(3902958715), UINT32_C(1095970262), UINT32_C( 924967287), UINT32_C(3771931381), UINT32_C(2837614084), UINT32_C(2881083921), UINT32_C(1600456293),
+      UINT32_C(3438978129), UINT32_C(3870596112), UINT32_C(1093077193), UINT32_C(3749202153), UINT32_C(1723812706), UINT32_C(3943686874), UINT32_C( 563529916), UINT32_C( 545389519),
+      UINT32_C(2951510943), UINT32_C(3767902487), UINT32_C(2451684777), UINT32_C(1752275205), UINT32_C(3217961445), UINT32_C(3484081683), UINT32_C(1978744998), UINT32_C(3667227195),
+      UINT32_C(  76120813), UINT32_C(3437501987), UINT32_C(3781035739), UINT32_C(2219430047), UINT32_C( 339941121), UINT32_C(2632183285), UINT32_C(1745998893), UINT32_C( 860006214),
+      UINT32_C(1278724905), UINT32_C(3306691818), UINT32_C(3248911906), UINT32_C(1195831110), UINT32_C(4233857287), UINT32_C(2761441143), UINT32_C(1510844947), UINT32_C(2056081233),
+      UINT32_C(  96912667), UINT32_C(  63626977), UINT32_C(2613342548), UINT32_C(1742867040), UINT32_C( 191118996), UINT32_C(2427452541), UINT32_C(4159356070), UINT32_C( 661747724),
+      UINT32_C( 506214205), UINT32_C(1780610581), UINT32_C(3355829607), UINT32_C(2217732080), UINT32_C(2727318309), UINT32_C( 909328016), UINT32_C( 120462843), UINT32_C(3526270869),
+      UINT32_C(3975174871), UINT32_C(3092648272), UINT32_C(3883949047) };
+  static const uint8_t b[] =
+    { UINT8_C(212), UINT8_C(185), UINT8_C(114), UINT8_C(192), UINT8_C( 26), UINT8_C(219), UINT8_C(122), UINT8_C( 75),
+      UINT8_C(117), UINT8_C(  4), UINT8_C(154), UINT8_C(203), UINT8_C(122), UINT8_C( 25), UINT8_C(130), UINT8_C(222),
+      UINT8_C(117), UINT8_C(178), UINT8_C(168), UINT8_C( 90), UINT8_C(230), UINT8_C( 13), UINT8_C( 14), UINT8_C( 51),
+      UINT8_C( 30), UINT8_C(  3), UINT8_C( 47), UINT8_C( 55), UINT8_C( 42), UINT8_C( 96), UINT8_C(  3), UINT8_C(254),
+      UINT8_C( 25), UINT8_C(118), UINT8_C(191), UINT8_C( 51), UINT8_C( 81), UINT8_C( 57), UINT8_C(126), UINT8_C(198),
+      UINT8_C( 61), UINT8_C( 25), UINT8_C(146), UINT8_C(184), UINT8_C( 50), UINT8_C( 20), UINT8_C(150), UINT8_C(167),
+      UINT8_C(198), UINT8_C( 62), UINT8_C(  1), UINT8_C(172), UINT8_C( 75), UINT8_C( 15), UINT8_C(223), UINT8_C(105),
+      UINT8_C( 18), UINT8_C( 14), UINT8_C(160), UINT8_C( 60), UINT8_C(111), UINT8_C(163), UINT8_C( 59), UINT8_C(136),
+      UINT8_C( 25), UINT8_C(250), UINT8_C(188), UINT8_C(107), UINT8_C( 51), UINT8_C( 58), UINT8_C( 49), UINT8_C(112),
+      UINT8_C( 83), UINT8_C(195), UINT8_C( 40), UINT8_C(133), UINT8_C(216), UINT8_C(190), UINT8_C( 45), UINT8_C(158),
+      UINT8_C(252), UINT8_C( 46), UINT8_C( 75), UINT8_C( 71), UINT8_C( 62), UINT8_C( 42), UINT8_C(176), UINT8_C( 80),
+      UINT8_C( 57), UINT8_C( 80), UINT8_C(141), UINT8_C(168), UINT8_C(244), UINT8_C(200), UINT8_C( 48), UINT8_C( 13),
+      UINT8_C(194), UINT8_C(236), UINT8_C(120), UINT8_C(245), UINT8_C( 39), UINT8_C(170), UINT8_C(101), UINT8_C(122),
+      UINT8_C(109), UINT8_C(142), UINT8_C(  0), UINT8_C( 69), UINT8_C( 76), UINT8_C( 45), UINT8_C(228), UINT8_C( 73),
+      UINT8_C( 91), UINT8_C( 47), UINT8_C(144), UINT8_C(153), UINT8_C( 89), UINT8_C( 65), UINT8_C(234), UINT8_C(146),
+      UINT8_C(145), UINT8_C(119), UINT8_C( 58), UINT8_C(133), UINT8_C( 63), UINT8_C(107), UINT8_C(147), UINT8_C(  1),
+      UINT8_C( 87), UINT8_C( 11), UINT8_C(246), UINT8_C(126), UINT8_C(181), UINT8_C( 91), UINT8_C(249), UINT8_C( 35),
+      UINT8_C(233), UINT8_C(249), UINT8_C(104), UINT8_C( 54), UINT8_C( 38), UINT8_C( 76), UINT8_C(127), UINT8_C(129),
+      UINT8_C(123), UINT8_C( 15), UINT8_C( 27), UINT8_C(213), UINT8_C( 80), UINT8_C(  5), UINT8_C(103), UINT8_C(226),
+      UINT8_C(124), UINT8_C(162), UINT8_C(103), UINT8_C(187), UINT8_C( 13), UINT8_C(250), UINT8_C(188), UINT8_C(100),
+      UINT8_C(  6), UINT8_C(178), UINT8_C(227) };
+  static const uint8_t e[] =
+    { UINT8_C(212), UINT8_C(191), UINT8_C(172), UINT8_C(136), UINT8_C(105), UINT8_C(219), UINT8_C(122), UINT8_C(196),
+      UINT8_C(237), UINT8_C(  4), UINT8_C(154), UINT8_C(203), UINT8_C(122), UINT8_C(236), UINT8_C(130), UINT8_C( 36),
+      UINT8_C(117), UINT8_C(178), UINT8_C(117), UINT8_C(218), UINT8_C( 42), UINT8_C( 13), UINT8_C(108), UINT8_C(253),
+      UINT8_C( 30), UINT8_C(  3), UINT8_C( 47), UINT8_C( 55), UINT8_C( 67), UINT8_C(249), UINT8_C(  3), UINT8_C(105),
+      UINT8_C(247), UINT8_C(118), UINT8_C(191), UINT8_C(171), UINT8_C(128), UINT8_C( 65), UINT8_C(250), UINT8_C(198),
+      UINT8_C( 61), UINT8_C(145), UINT8_C(146), UINT8_C(184), UINT8_C( 50), UINT8_C( 20), UINT8_C( 99), UINT8_C( 77),
+      UINT8_C( 78), UINT8_C( 62), UINT8_C(  1), UINT8_C(172), UINT8_C(231), UINT8_C( 93), UINT8_C( 73), UINT8_C( 32),
+      UINT8_C(154), UINT8_C( 14), UINT8_C(192), UINT8_C( 60), UINT8_C( 29), UINT8_C(171), UINT8_C(213), UINT8_C(148),
+      UINT8_C( 54), UINT8_C(250), UINT8_C( 78), UINT8_C( 11), UINT8_C( 51), UINT8_C( 58), UINT8_C(173), UINT8_C(189),
+      UINT8_C( 63), UINT8_C(195), UINT8_C(135), UINT8_C( 82), UINT8_C( 30), UINT8_C( 64), UINT8_C( 45), UINT8_C(103),
+      UINT8_C(252), UINT8_C(237), UINT8_C( 75), UINT8_C( 28), UINT8_C( 62), UINT8_C(163), UINT8_C( 65), UINT8_C( 31),
+      UINT8_C( 57), UINT8_C(101), UINT8_C(141), UINT8_C(168), UINT8_C(244), UINT8_C(200), UINT8_C( 48), UINT8_C(107),
+      UINT8_C( 32), UINT8_C(236), UINT8_C(108), UINT8_C(106), UINT8_C( 39), UINT8_C(170), UINT8_C(101), UINT8_C(122),
+      UINT8_C(109), UINT8_C(142), UINT8_C(  0), UINT8_C( 69), UINT8_C(245), UINT8_C(  4), UINT8_C( 17), UINT8_C( 73),
+      UINT8_C( 91), UINT8_C( 47), UINT8_C(144), UINT8_C(153), UINT8_C( 98), UINT8_C( 65), UINT8_C(234), UINT8_C(207),
+      UINT8_C(159), UINT8_C( 23), UINT8_C(169), UINT8_C(  5), UINT8_C( 63), UINT8_C( 19), UINT8_C(147), UINT8_C( 59),
+      UINT8_C( 87), UINT8_C( 11), UINT8_C(246), UINT8_C(159), UINT8_C(  1), UINT8_C(245), UINT8_C( 45), UINT8_C( 70),
+      UINT8_C(233), UINT8_C(234), UINT8_C(104), UINT8_C( 54), UINT8_C( 38), UINT8_C( 76), UINT8_C(127), UINT8_C( 81),
+      UINT8_C( 27), UINT8_C(225), UINT8_C( 84), UINT8_C(213), UINT8_C( 80), UINT8_C(125), UINT8_C(166), UINT8_C(226),
+      UINT8_C( 61), UINT8_C(162), UINT8_C(103), UINT8_C(187), UINT8_C( 37), UINT8_C(250), UINT8_C(251), UINT8_C(149),
+      UINT8_C(  6), UINT8_C(178), UINT8_C(247) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1b_u32(pv, &(r[i]), simde_svld1_u32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  uint32_t a[1024 / sizeof(uint32_t)];
+  uint8_t b[1024 / sizeof(uint32_t)];
+  uint8_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1b_u32(pv, &(e[i]), simde_svld1_u32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1b_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 2077314054229561326), -INT64_C( 8312319501574524473),  INT64_C( 1359394845689253128),  INT64_C( 2072565324494876694),
+      -INT64_C( 1439109924802196789), -INT64_C( 2345317852185288334), -INT64_C( 2068943555824106802), -INT64_C( 7053434355642296109),
+       INT64_C( 4487152910606174772), -INT64_C(  979364541049249102), -INT64_C( 6734445156102558245),  INT64_C( 5799440171084804361),
+       INT64_C( 5284393170005198155), -INT64_C( 1195923316493092015),  INT64_C(  781692299436789607), -INT64_C( 8611336323054732014),
+       INT64_C( 7514806932371089256), -INT64_C( 4795414039832487056),  INT64_C( 4458508839476791763), -INT64_C( 7921293904976296373),
+       INT64_C( 1553700799334428688), -INT64_C( 9004652028611695370),  INT64_C( 1692570385353604630), -INT64_C( 2109460538086921987),
+       INT64_C( 1953603623154436705), -INT64_C( 2866698656245369596), -INT64_C( 4300490391039733906),  INT64_C(  158369949665718654),
+      -INT64_C( 2941371918138655762),  INT64_C( 8391545339350062554), -INT64_C( 6783546787988796078),  INT64_C( 6527162179893970929),
+      -INT64_C( 7059220053741429154), -INT64_C( 6292461794514791631),  INT64_C( 5548607756694477628),  INT64_C( 8370631593980654180),
+       INT64_C( 7310941107790386964), -INT64_C( 7260004498895228863),  INT64_C(   93725248779321507), -INT64_C( 5370828836637168404),
+       INT64_C(  804740024058583955), -INT64_C( 5427714892245055310), -INT64_C( 8250313448245451038), -INT64_C( 2269245430538743253),
+      -INT64_C( 4254263298588471519),  INT64_C( 6656182237657405594),  INT64_C( 4348044097208652328),  INT64_C(  998544492821276333),
+      -INT64_C( 1193474424016764263), -INT64_C( 1199090242676964219),  INT64_C( 4564415338266506763), -INT64_C( 8795787444374314506),
+       INT64_C( 6403168502780323480),  INT64_C( 8978403529103734755),  INT64_C( 6321348952962126312), -INT64_C( 6862878866307157166),
+       INT64_C( 8447181225890542094),  INT64_C( 3300496705490752225), -INT64_C( 6214580082226797047),  INT64_C( 3601939767025400403),
+      -INT64_C( 3124849484613056101), -INT64_C( 9056189674042244641), -INT64_C( 6099652524347885479), -INT64_C( 8864206763415158615),
+       INT64_C( 4347191201358745484), -INT64_C( 4102584176453060076),  INT64_C( 6101482127574433193),  INT64_C( 4719241027441963793),
+      -INT64_C( 7438515554836467668), -INT64_C( 9096367620593736049),  INT64_C( 2103795708254632754), -INT64_C( 7216572621375712542),
+       INT64_C( 4531159639167113925),  INT64_C( 7955888279280813583), -INT64_C(  332563675958416839), -INT64_C( 3108772309300446767),
+      -INT64_C(  507782053243257082),  INT64_C( 7255095775814692100),  INT64_C( 5496374490112326450),  INT64_C( 5505483721816201860),
+      -INT64_C( 8770209958802127769), -INT64_C( 6723462543974127583), -INT64_C( 1497389259434402959), -INT64_C( 7736932181263596530),
+      -INT64_C( 5228347570469428887),  INT64_C( 2335316169042704470), -INT64_C( 7466329870733388528),  INT64_C( 3371381674216382472),
+       INT64_C( 3565596206486367535),  INT64_C( 5012892543390023619), -INT64_C( 1524715996072600140), -INT64_C( 9155281129603873538),
+       INT64_C( 6386597494654306965), -INT64_C( 6000382435126568896), -INT64_C( 7726838211293841416),  INT64_C( 6942098490454958981),
+      -INT64_C( 7115561663581807533),  INT64_C( 6750557625673452043), -INT64_C( 2274885869142304445),  INT64_C( 6992416823290873054),
+       INT64_C( 6387663709951089579), -INT64_C( 4083065549735872620),  INT64_C( 7556210636114398882),  INT64_C( 5566479525771056337),
+      -INT64_C( 6368940812350944778), -INT64_C( 6630152966829443151),  INT64_C( 8824378684927417477), -INT64_C( 7349424188507453423),
+       INT64_C(  278794716175030051) };
+  static const uint64_t a[] =
+    { UINT64_C( 3933958623424952365), UINT64_C( 8423529091179493998), UINT64_C( 3111110681495049964), UINT64_C( 1377056841205799016),
+      UINT64_C( 1746572751968825473), UINT64_C( 8778677365228841292), UINT64_C(10345077471756240055), UINT64_C(17504183821694544113),
+      UINT64_C(14090698320338642378), UINT64_C(11414365455610267489), UINT64_C( 6913471204313814076), UINT64_C( 6134222144348303549),
+      UINT64_C(13024786516089052039), UINT64_C( 1775273518689346589), UINT64_C(17954563347827107678), UINT64_C(  827618362982425244),
+      UINT64_C(13289219370619848037), UINT64_C( 8549063651195948719), UINT64_C( 2899312705016045319), UINT64_C( 1468397432416986576),
+      UINT64_C(16385284242680932624), UINT64_C( 9860088781052191048), UINT64_C( 6189362633398491185), UINT64_C( 1094386800264885357),
+      UINT64_C( 9190193413012323699), UINT64_C( 4416822921702406465), UINT64_C(10135596287026403277), UINT64_C(14925448530044146195),
+      UINT64_C( 4506979513455336918), UINT64_C(17096593410363583482), UINT64_C( 3391183154080333156), UINT64_C( 7306354339302455097),
+      UINT64_C(15599341960483232831), UINT64_C( 3275842928443817065), UINT64_C(15540162672307779166), UINT64_C(10118411112273472118),
+      UINT64_C( 5071972219866373805), UINT64_C(13886645365053014464), UINT64_C(11344817220560250876), UINT64_C( 6675759263075524045),
+      UINT64_C( 8146812378393571053), UINT64_C( 2426791650198806411), UINT64_C(10943232292226262809), UINT64_C( 9012360983862083848),
+      UINT64_C(14908979939163765188), UINT64_C(12500700177083654709), UINT64_C( 7615811687302444623), UINT64_C( 8888754054832808269),
+      UINT64_C( 3332056765648904747), UINT64_C(12824849179826846137), UINT64_C(  145377107915761978), UINT64_C( 9299436623112447196),
+      UINT64_C(10305976297564733150), UINT64_C(14860146573653675815), UINT64_C( 6591139548383216833), UINT64_C( 8316455907704592786),
+      UINT64_C(12637190202453613306), UINT64_C(15438745334544023008), UINT64_C(12344300719397710709), UINT64_C( 3685910669788658973),
+      UINT64_C(11713128993971794262), UINT64_C(12361350969719899553), UINT64_C(13458706890689075202), UINT64_C(12436569791461611819),
+      UINT64_C(11558234455479589635), UINT64_C(15474054770176982493), UINT64_C( 8507782705305443770), UINT64_C( 1374003676566945040),
+      UINT64_C(10497117448524373005), UINT64_C(11558315711095112637), UINT64_C( 2269823072896243903), UINT64_C(15612175384404384390),
+      UINT64_C( 9257028929173422642), UINT64_C( 4331470521466231701), UINT64_C(11673829536461886418), UINT64_C( 5747966538770056736),
+      UINT64_C(15107233944610122084), UINT64_C(  396994286594079176), UINT64_C(12698716703256136060), UINT64_C(13247725690811085421),
+      UINT64_C( 9517943001383308810), UINT64_C( 5149669135609389887), UINT64_C(12922262492735823381), UINT64_C( 6599486844851581323),
+      UINT64_C( 4207690244304237860), UINT64_C(10389000025688321562), UINT64_C(12861025060058893698), UINT64_C(17449240525395835003),
+      UINT64_C(11228096746918955420), UINT64_C( 2769624314708852580), UINT64_C(12219507339059700923), UINT64_C(16852924234357613857),
+      UINT64_C( 5729232844828488806), UINT64_C( 7898079757025018833), UINT64_C( 1376100316550760769), UINT64_C(10465770884311452936),
+      UINT64_C(16344119471519612567), UINT64_C(15932876336500572157), UINT64_C( 6233092172284717947), UINT64_C(18279803458513699569),
+      UINT64_C( 2204600123323786918), UINT64_C( 6685850803364556623), UINT64_C( 7635933950682666068), UINT64_C( 3543827729223164875),
+      UINT64_C( 5519866119489826138), UINT64_C(11938478911949072239), UINT64_C(10156814255341991699), UINT64_C(  693532002053094115),
+      UINT64_C( 8566160984157489048) };
+  static const uint8_t b[] =
+    { UINT8_C(232), UINT8_C(202), UINT8_C( 95), UINT8_C( 73), UINT8_C(213), UINT8_C( 94), UINT8_C(169), UINT8_C(229),
+      UINT8_C(213), UINT8_C(152), UINT8_C(186), UINT8_C( 53), UINT8_C(191), UINT8_C( 15), UINT8_C(192), UINT8_C(236),
+      UINT8_C( 68), UINT8_C(194), UINT8_C(245), UINT8_C(132), UINT8_C(130), UINT8_C( 18), UINT8_C(152), UINT8_C( 39),
+      UINT8_C(209), UINT8_C(190), UINT8_C( 48), UINT8_C(150), UINT8_C( 14), UINT8_C(127), UINT8_C( 32), UINT8_C(246),
+      UINT8_C( 74), UINT8_C(127), UINT8_C( 63), UINT8_C( 31), UINT8_C(222), UINT8_C(232), UINT8_C(  4), UINT8_C(179),
+      UINT8_C(128), UINT8_C(191), UINT8_C(232), UINT8_C( 64), UINT8_C(206), UINT8_C(168), UINT8_C( 44), UINT8_C( 18),
+      UINT8_C(106), UINT8_C( 34), UINT8_C(150), UINT8_C(236), UINT8_C( 52), UINT8_C( 46), UINT8_C( 20), UINT8_C(  5),
+      UINT8_C(236), UINT8_C( 68), UINT8_C(155), UINT8_C(250), UINT8_C(196), UINT8_C(187), UINT8_C(240), UINT8_C( 14),
+      UINT8_C( 59), UINT8_C( 47), UINT8_C( 45), UINT8_C( 25), UINT8_C( 24), UINT8_C( 49), UINT8_C(204), UINT8_C(152),
+      UINT8_C(240), UINT8_C(180), UINT8_C(216), UINT8_C(190), UINT8_C( 92), UINT8_C(  5), UINT8_C(208), UINT8_C(199),
+      UINT8_C( 39), UINT8_C(103), UINT8_C(179), UINT8_C( 91), UINT8_C(149), UINT8_C(199), UINT8_C( 96), UINT8_C(130),
+      UINT8_C( 12), UINT8_C(251), UINT8_C(124), UINT8_C(208), UINT8_C(183), UINT8_C(109), UINT8_C(222), UINT8_C(242),
+      UINT8_C(156), UINT8_C( 11), UINT8_C( 11), UINT8_C(180), UINT8_C( 60), UINT8_C(215), UINT8_C( 77), UINT8_C( 45),
+      UINT8_C(139), UINT8_C( 37), UINT8_C(235), UINT8_C(231), UINT8_C( 42) };
+  static const uint8_t e[] =
+    { UINT8_C(232), UINT8_C(110), UINT8_C( 95), UINT8_C( 73), UINT8_C(129), UINT8_C( 76), UINT8_C(183), UINT8_C(241),
+      UINT8_C(213), UINT8_C( 97), UINT8_C( 60), UINT8_C( 53), UINT8_C(191), UINT8_C( 29), UINT8_C(192), UINT8_C(156),
+      UINT8_C( 68), UINT8_C(175), UINT8_C(245), UINT8_C(208), UINT8_C(130), UINT8_C( 72), UINT8_C(152), UINT8_C(109),
+      UINT8_C(209), UINT8_C( 65), UINT8_C(205), UINT8_C(150), UINT8_C(214), UINT8_C(127), UINT8_C(100), UINT8_C(246),
+      UINT8_C( 63), UINT8_C(105), UINT8_C( 63), UINT8_C( 31), UINT8_C(222), UINT8_C(192), UINT8_C(  4), UINT8_C(205),
+      UINT8_C(128), UINT8_C(139), UINT8_C( 25), UINT8_C(  8), UINT8_C(196), UINT8_C(168), UINT8_C( 44), UINT8_C( 18),
+      UINT8_C( 43), UINT8_C(185), UINT8_C(150), UINT8_C(220), UINT8_C( 52), UINT8_C( 46), UINT8_C( 20), UINT8_C(146),
+      UINT8_C(236), UINT8_C( 68), UINT8_C(117), UINT8_C(250), UINT8_C( 86), UINT8_C(161), UINT8_C(  2), UINT8_C( 43),
+      UINT8_C( 59), UINT8_C(221), UINT8_C( 45), UINT8_C( 25), UINT8_C( 13), UINT8_C(189), UINT8_C(204), UINT8_C(134),
+      UINT8_C(240), UINT8_C(180), UINT8_C(210), UINT8_C( 32), UINT8_C(100), UINT8_C(  5), UINT8_C(208), UINT8_C(199),
+      UINT8_C( 10), UINT8_C( 63), UINT8_C( 21), UINT8_C(139), UINT8_C( 36), UINT8_C(199), UINT8_C(130), UINT8_C(130),
+      UINT8_C( 12), UINT8_C(251), UINT8_C(187), UINT8_C( 33), UINT8_C(183), UINT8_C(209), UINT8_C( 65), UINT8_C(242),
+      UINT8_C(151), UINT8_C( 11), UINT8_C(123), UINT8_C(180), UINT8_C( 60), UINT8_C( 79), UINT8_C( 77), UINT8_C( 45),
+      UINT8_C( 90), UINT8_C(111), UINT8_C(235), UINT8_C(227), UINT8_C( 42) };
+
+  static uint8_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1b_u64(pv, &(r[i]), simde_svld1_u64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu8(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint64_t a[1024 / sizeof(uint64_t)];
+  uint8_t b[1024 / sizeof(uint64_t)];
+  uint8_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1b_u64(pv, &(e[i]), simde_svld1_u64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu8(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1h_s32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    {  INT32_C(   509133459),  INT32_C(   302334951),  INT32_C(   576959743),  INT32_C(  1071321110),  INT32_C(   611652892), -INT32_C(   253527348),  INT32_C(  1286706270), -INT32_C(   478730672),
+      -INT32_C(   821964824),  INT32_C(   316737299), -INT32_C(   785037893),  INT32_C(  1896878165), -INT32_C(   225016539),  INT32_C(  1591900416),  INT32_C(  1588237070), -INT32_C(  1589501255),
+       INT32_C(    74531825),  INT32_C(    85414474), -INT32_C(   321500009), -INT32_C(  2124486820),  INT32_C(  1819538540),  INT32_C(  2076857965), -INT32_C(  1545964055), -INT32_C(  2008802153),
+      -INT32_C(  1433553569), -INT32_C(  1615879160),  INT32_C(  1284278000), -INT32_C(   640816531),  INT32_C(  1262895582), -INT32_C(  2134437737),  INT32_C(   472097157),  INT32_C(   480602301),
+       INT32_C(   633745949), -INT32_C(   960137514),  INT32_C(  1762808316),  INT32_C(   423812923), -INT32_C(  1218148320),  INT32_C(   506997657), -INT32_C(  1992598580), -INT32_C(   509157181),
+      -INT32_C(   402232302), -INT32_C(   558969886),  INT32_C(  1464320028), -INT32_C(  1066366305), -INT32_C(  1418210030), -INT32_C(   842354944), -INT32_C(   833223413), -INT32_C(   139461403),
+       INT32_C(  1272952425), -INT32_C(  1641378431), -INT32_C(   319458995),  INT32_C(   246179579),  INT32_C(  1001989179), -INT32_C(   569867309),  INT32_C(  1840078728), -INT32_C(  1000055717),
+      -INT32_C(  1810873582),  INT32_C(   489831120), -INT32_C(  1492506709), -INT32_C(   927615347), -INT32_C(  1375441190),  INT32_C(  2055998706), -INT32_C(   941082261), -INT32_C(  1467265898),
+       INT32_C(  1614584720), -INT32_C(  2122420523),  INT32_C(   589858966),  INT32_C(   434953534),  INT32_C(  1036513355),  INT32_C(  1756910588),  INT32_C(   590323853),  INT32_C(  2093726444),
+       INT32_C(   735905878),  INT32_C(   212622198),  INT32_C(   556848355), -INT32_C(    46523215),  INT32_C(   138019084), -INT32_C(   495914411),  INT32_C(  2131074962), -INT32_C(  1325674406),
+       INT32_C(  1339807960),  INT32_C(   375097395),  INT32_C(   238586716), -INT32_C(  1291095385), -INT32_C(   910408332), -INT32_C(   894751688),  INT32_C(   642363596),  INT32_C(  1507214720),
+       INT32_C(  1370009885), -INT32_C(  1771633863),  INT32_C(   916758415), -INT32_C(  2031440110),  INT32_C(   743417588), -INT32_C(  1627915566),  INT32_C(   717504682), -INT32_C(  1551656315),
+      -INT32_C(  2047595700), -INT32_C(  1105503441),  INT32_C(   234143739),  INT32_C(  1670635118),  INT32_C(  1469047428), -INT32_C(  2030729508),  INT32_C(  1286650567), -INT32_C(  1594936236),
+      -INT32_C(  1910054049),  INT32_C(   978075967),  INT32_C(  1866940673), -INT32_C(  1529685473), -INT32_C(  1728355652), -INT32_C(  1356926744), -INT32_C(      209238),  INT32_C(  1654647554),
+       INT32_C(   250660303),  INT32_C(   138951943), -INT32_C(  1653108866),  INT32_C(   625035881), -INT32_C(  1799537492), -INT32_C(   683353299), -INT32_C(  1395244887), -INT32_C(    99715541),
+       INT32_C(  1107885627), -INT32_C(  1186312133),  INT32_C(  1213711071), -INT32_C(  1200777204),  INT32_C(    38546133), -INT32_C(  1344696315), -INT32_C(    61099824),  INT32_C(  1643538726),
+      -INT32_C(  1549467801),  INT32_C(   794619471), -INT32_C(  1133005904),  INT32_C(   561309004),  INT32_C(   354664719),  INT32_C(   583334993), -INT32_C(   769777748), -INT32_C(   281799544),
+       INT32_C(  1670567955),  INT32_C(  2006118342), -INT32_C(   298645086), -INT32_C(    32528146), -INT32_C(  1173147031), -INT32_C(   606283985),  INT32_C(  2125396726),  INT32_C(   577626639),
+      -INT32_C(  2138767174), -INT32_C(  1846077457),  INT32_C(   260057889),  INT32_C(  1007521747), -INT32_C(   235527998), -INT32_C(   305343497), -INT32_C(   596935987),  INT32_C(   385866076),
+      -INT32_C(   929594151), -INT32_C(  1118204260), -INT32_C(  1932731975),  INT32_C(   734583401), -INT32_C(   232996870),  INT32_C(  1608509586), -INT32_C(  1086567581), -INT32_C(    36291804),
+       INT32_C(  1539665343), -INT32_C(  1256710405),  INT32_C(  1631708664), -INT32_C(  1182004545),  INT32_C(  1537976521), -INT32_C(   205878384), -INT32_C(    88869162), -INT32_C(   235435727),
+      -INT32_C(   246629130), -INT32_C(   760846886),  INT32_C(   154396746), -INT32_C(  1144864782), -INT32_C(   132747673), -INT32_C(   806629127), -INT32_C(   121004345),  INT32_C(   501858343),
+       INT32_C(  1443837564), -INT32_C(   450251365), -INT32_C(  1880204131), -INT32_C(  2092257252),  INT32_C(   393961502), -INT32_C(   119118031),  INT32_C(   770748165), -INT32_C(   347415953),
+      -INT32_C(  1421715184), -INT32_C(  1399821553), -INT32_C(   482574649),  INT32_C(  1298630190),  INT32_C(   409264871),  INT32_C(  1326467913),  INT32_C(  1786511610), -INT32_C(   363477286),
+       INT32_C(   798332704), -INT32_C(   891607806), -INT32_C(   760408157), -INT32_C(  2061560674),  INT32_C(  1084064759), -INT32_C(   913330738), -INT32_C(  2009920595), -INT32_C(   227374894),
+       INT32_C(   572590112), -INT32_C(   772998099), -INT32_C(  1297901036), -INT32_C(  1523072338),  INT32_C(   350671941),  INT32_C(   786265473),  INT32_C(  1404440705), -INT32_C(  1203426920),
+       INT32_C(  1591436849),  INT32_C(  1982842722),  INT32_C(   271110753), -INT32_C(   625647724), -INT32_C(  1259431117), -INT32_C(  1830565103),  INT32_C(  1944426971), -INT32_C(   215209278),
+      -INT32_C(   229505136),  INT32_C(   812220878), -INT32_C(   398421676),  INT32_C(   616756721), -INT32_C(  1562791791),  INT32_C(  1446296699),  INT32_C(   415897941), -INT32_C(   754190781),
+      -INT32_C(   876257795),  INT32_C(   872099551), -INT32_C(  1323615296), -INT32_C(  1026171343),  INT32_C(   174370446), -INT32_C(  1067411350), -INT32_C(   187159887),  INT32_C(   499639072),
+       INT32_C(   552176705),  INT32_C(  2069095611),  INT32_C(  1361866272), -INT32_C(   619511476),  INT32_C(   451246000), -INT32_C(  1059437297) };
+  static const int32_t a[] =
+    { -INT32_C(  1841840862),  INT32_C(   515612217),  INT32_C(  1164962290), -INT32_C(   904996105),  INT32_C(   749231483), -INT32_C(  2136997646),  INT32_C(  2139253859), -INT32_C(  1981087385),
+      -INT32_C(   149151042), -INT32_C(  1290414143), -INT32_C(  1191672639), -INT32_C(   628947361),  INT32_C(  1443310436), -INT32_C(  1898535125),  INT32_C(  2047694867),  INT32_C(   386201689),
+      -INT32_C(   619831270), -INT32_C(  1198643977),  INT32_C(   124880552), -INT32_C(   236784499),  INT32_C(  1246226719), -INT32_C(  1546117744), -INT32_C(   820124299), -INT32_C(   135912995),
+       INT32_C(   970192193), -INT32_C(  1041145575),  INT32_C(  1976132328),  INT32_C(  1969662806),  INT32_C(   616541588),  INT32_C(  1070045130),  INT32_C(  1494148220),  INT32_C(  1196553478),
+       INT32_C(    58729706),  INT32_C(  1841590917),  INT32_C(   736267732), -INT32_C(   861910984), -INT32_C(  1074765579),  INT32_C(  1962915831), -INT32_C(  1563619940), -INT32_C(   320266750),
+      -INT32_C(   923833790), -INT32_C(  1338657572),  INT32_C(  2061178945),  INT32_C(  1447459936), -INT32_C(   753584164), -INT32_C(  1975053074),  INT32_C(   606868770),  INT32_C(  1980831283),
+       INT32_C(  1547567232), -INT32_C(   166956108), -INT32_C(   328144757),  INT32_C(  1078113892), -INT32_C(   602712083), -INT32_C(  1905894548), -INT32_C(  1548577936),  INT32_C(   689554345),
+       INT32_C(  2022004676),  INT32_C(  1450086859), -INT32_C(   582820231), -INT32_C(  2111994731),  INT32_C(  1214132700), -INT32_C(    53033588),  INT32_C(    27232344),  INT32_C(   271235404),
+      -INT32_C(   611799280), -INT32_C(  1171065024),  INT32_C(  1788310741), -INT32_C(   705841671),  INT32_C(  1914522598),  INT32_C(  1752101648), -INT32_C(   949416581), -INT32_C(   673737786),
+      -INT32_C(  2085461950),  INT32_C(   742253655),  INT32_C(  1385682009),  INT32_C(  1864860809), -INT32_C(   522107697), -INT32_C(  1303883977),  INT32_C(   595243613), -INT32_C(  1996861115),
+       INT32_C(   134983089), -INT32_C(   365606767), -INT32_C(  1505965028),  INT32_C(   521495376), -INT32_C(   553650265), -INT32_C(  1550759866),  INT32_C(  1070009338),  INT32_C(   247972188),
+       INT32_C(     1495662),  INT32_C(   938101530),  INT32_C(  1742546711),  INT32_C(   847770250),  INT32_C(   806389481), -INT32_C(   925654578),  INT32_C(   151558828), -INT32_C(   904409252),
+      -INT32_C(  1127600734), -INT32_C(  1863076487),  INT32_C(  1727582428), -INT32_C(  1399291965), -INT32_C(   723736315), -INT32_C(   140726198), -INT32_C(  1509907382),  INT32_C(   376510324),
+      -INT32_C(  1110295740), -INT32_C(   867252496),  INT32_C(  1496532630), -INT32_C(   905524283), -INT32_C(  1080106380), -INT32_C(   575259758),  INT32_C(  1401140959),  INT32_C(   292156621),
+       INT32_C(   550452272), -INT32_C(  1729291006),  INT32_C(   686956643),  INT32_C(  1626536171),  INT32_C(  1830785498), -INT32_C(  1421158964),  INT32_C(  1493159307), -INT32_C(   227972926),
+      -INT32_C(  1508755292), -INT32_C(  1203765419),  INT32_C(   199242015),  INT32_C(    57398057),  INT32_C(   812681828), -INT32_C(   354698657),  INT32_C(  1245895304), -INT32_C(   415454397),
+       INT32_C(   965627620),  INT32_C(  1844628814),  INT32_C(   662229758),  INT32_C(   153805733), -INT32_C(   868639891), -INT32_C(   575269547),  INT32_C(   841480431), -INT32_C(  2011536476),
+       INT32_C(    12691634),  INT32_C(  1936569205),  INT32_C(   731571846),  INT32_C(   926270665), -INT32_C(  1258066337),  INT32_C(  1938995843),  INT32_C(  1453701810), -INT32_C(   807485667),
+      -INT32_C(   590372761), -INT32_C(   649118381), -INT32_C(   335156957),  INT32_C(   220412590),  INT32_C(   750921640), -INT32_C(  1818274335),  INT32_C(   753550351),  INT32_C(  1811728388),
+      -INT32_C(  1136080024),  INT32_C(   731223816),  INT32_C(   790141569),  INT32_C(  2101099476),  INT32_C(  1135214434),  INT32_C(  1675053140), -INT32_C(  1869626996), -INT32_C(   218330231),
+       INT32_C(  1605256279),  INT32_C(  1552630747), -INT32_C(  1299471394),  INT32_C(  1093650654),  INT32_C(   461691079), -INT32_C(  1384228064), -INT32_C(  1505948388), -INT32_C(   258459239),
+       INT32_C(  1498367613),  INT32_C(  1739971209),  INT32_C(  1545224573), -INT32_C(   794998519),  INT32_C(  1122705698), -INT32_C(  1712363139),  INT32_C(   255798646), -INT32_C(   452995226),
+      -INT32_C(  1489154275), -INT32_C(  1492192727),  INT32_C(  1006839859), -INT32_C(  1811111822),  INT32_C(  1054275521), -INT32_C(   673659296),  INT32_C(  1508251635),  INT32_C(   205383407),
+       INT32_C(  1588820533), -INT32_C(  1610235283),  INT32_C(  1557989610),  INT32_C(  1794173352),  INT32_C(  1101580257), -INT32_C(  2145877875), -INT32_C(  2015756392),  INT32_C(   445847525),
+      -INT32_C(    25671791), -INT32_C(   207651319),  INT32_C(   793803910),  INT32_C(  1184448613), -INT32_C(  1803009785),  INT32_C(  1511301314), -INT32_C(  2065568097), -INT32_C(  1768000507),
+      -INT32_C(   996862021),  INT32_C(   465056917),  INT32_C(   357173424),  INT32_C(  1348264776), -INT32_C(   404429787),  INT32_C(   608303492), -INT32_C(   324525337),  INT32_C(  1384269718),
+      -INT32_C(   216656034), -INT32_C(    82915765),  INT32_C(   521230806),  INT32_C(  1634692412), -INT32_C(   716680367),  INT32_C(   871991628),  INT32_C(  1109369515),  INT32_C(  1200923369),
+       INT32_C(    87730873),  INT32_C(  1325418617), -INT32_C(   563211871), -INT32_C(   817898114),  INT32_C(  2108000305), -INT32_C(  1112433135),  INT32_C(   704630848),  INT32_C(   745575282),
+      -INT32_C(  1238259139), -INT32_C(  1811533325), -INT32_C(  1049463741), -INT32_C(  2087603630),  INT32_C(  1258305082),  INT32_C(   352891348), -INT32_C(   197261438), -INT32_C(   668946534),
+       INT32_C(  1284395353), -INT32_C(   958294909),  INT32_C(  1535595273),  INT32_C(  1071519749),  INT32_C(   596368974),  INT32_C(   305697680) };
+  static const int16_t b[] =
+    { -INT16_C( 17458),  INT16_C( 27771), -INT16_C( 15599), -INT16_C( 20470), -INT16_C( 20833), -INT16_C(  4688),  INT16_C( 24982),  INT16_C( 20365),
+       INT16_C(  3556),  INT16_C( 29547), -INT16_C( 31359), -INT16_C(  4477),  INT16_C( 15060),  INT16_C( 25723), -INT16_C( 24041), -INT16_C(  6703),
+       INT16_C( 19805),  INT16_C( 28242),  INT16_C( 23568), -INT16_C( 20706), -INT16_C( 12790), -INT16_C( 24164),  INT16_C( 10543),  INT16_C(  5360),
+       INT16_C( 23351), -INT16_C( 18297),  INT16_C(  2784), -INT16_C( 19290),  INT16_C(  8516),  INT16_C( 23320), -INT16_C(  5437),  INT16_C(  8256),
+      -INT16_C( 28105),  INT16_C( 18318), -INT16_C( 21265), -INT16_C(  1546), -INT16_C( 28037), -INT16_C( 21862), -INT16_C( 30020), -INT16_C(  3138),
+       INT16_C( 17893), -INT16_C( 14677),  INT16_C( 20815), -INT16_C( 27782), -INT16_C( 27790),  INT16_C( 14062),  INT16_C( 12157), -INT16_C( 19370),
+      -INT16_C(  6719), -INT16_C( 20229), -INT16_C(  3695),  INT16_C(  3242),  INT16_C( 17539),  INT16_C( 16311),  INT16_C( 30159), -INT16_C( 19406),
+      -INT16_C(  8773),  INT16_C(  2682), -INT16_C(  2770), -INT16_C( 24162), -INT16_C( 29560),  INT16_C(  1495),  INT16_C( 11707),  INT16_C( 32185),
+      -INT16_C( 19438), -INT16_C( 23507), -INT16_C( 10331),  INT16_C( 10416),  INT16_C( 26396), -INT16_C(  5272), -INT16_C( 25891), -INT16_C( 26465),
+       INT16_C(  6776), -INT16_C( 22878),  INT16_C( 16399), -INT16_C( 26809),  INT16_C(  7885), -INT16_C( 30564),  INT16_C( 21836),  INT16_C( 24069),
+       INT16_C( 13065), -INT16_C( 20990), -INT16_C( 19702),  INT16_C(  9942),  INT16_C( 15898), -INT16_C(  2287), -INT16_C( 20007),  INT16_C( 20879),
+       INT16_C( 13003), -INT16_C(  9481),  INT16_C( 16242),  INT16_C( 16241),  INT16_C(  3421), -INT16_C( 22072), -INT16_C( 12958),  INT16_C( 27400),
+       INT16_C(  2560),  INT16_C(  2841), -INT16_C(  4163), -INT16_C( 10191),  INT16_C( 17198),  INT16_C(  1999),  INT16_C( 24564), -INT16_C( 16552),
+       INT16_C( 20369),  INT16_C(   921),  INT16_C(  2702), -INT16_C(  5053),  INT16_C(  2839),  INT16_C( 31125), -INT16_C( 25128), -INT16_C(  9756),
+      -INT16_C(   600),  INT16_C( 26084),  INT16_C(  5612),  INT16_C(  6717),  INT16_C(  3416),  INT16_C( 19489),  INT16_C( 31084), -INT16_C(   757),
+      -INT16_C( 23351),  INT16_C( 22272),  INT16_C( 17326), -INT16_C( 15037), -INT16_C(  9906),  INT16_C( 10046),  INT16_C(  8822),  INT16_C(  7680),
+      -INT16_C(  7137),  INT16_C(  3204), -INT16_C( 15879),  INT16_C( 21030),  INT16_C( 18638),  INT16_C( 15006), -INT16_C( 21823), -INT16_C( 30153),
+       INT16_C( 14414), -INT16_C(   542),  INT16_C(  9595), -INT16_C( 13630),  INT16_C(   510),  INT16_C( 30193), -INT16_C(  3805),  INT16_C( 17299),
+       INT16_C(  6101), -INT16_C( 12721),  INT16_C( 30169), -INT16_C( 22752), -INT16_C( 16451),  INT16_C( 32738),  INT16_C(  6505), -INT16_C( 18679),
+      -INT16_C(  5295), -INT16_C( 12876),  INT16_C( 30481),  INT16_C(  3991), -INT16_C( 30600), -INT16_C( 25724),  INT16_C(  6265),  INT16_C( 20190),
+       INT16_C( 11567),  INT16_C(  2076),  INT16_C( 15779),  INT16_C( 24752), -INT16_C( 27908),  INT16_C( 26079), -INT16_C(  5717), -INT16_C(   740),
+      -INT16_C( 11820), -INT16_C(  6710),  INT16_C( 24904), -INT16_C( 16139),  INT16_C( 31209),  INT16_C( 25179),  INT16_C( 14993), -INT16_C( 15952),
+      -INT16_C( 13209),  INT16_C(  2761),  INT16_C( 30985),  INT16_C(  1387),  INT16_C( 18955), -INT16_C( 18582), -INT16_C( 30925),  INT16_C(  2228),
+       INT16_C( 32344), -INT16_C( 24339), -INT16_C(  7457), -INT16_C( 14240), -INT16_C( 17572), -INT16_C(  4822), -INT16_C(  9483),  INT16_C( 23982),
+       INT16_C( 30886), -INT16_C( 20377), -INT16_C( 11535), -INT16_C(   587),  INT16_C(  8221),  INT16_C( 20660),  INT16_C( 26791), -INT16_C(   168),
+       INT16_C( 18150), -INT16_C( 14945), -INT16_C(   216), -INT16_C( 31603), -INT16_C( 18502), -INT16_C( 20366),  INT16_C(  8337),  INT16_C( 14093),
+       INT16_C( 29848), -INT16_C( 29977), -INT16_C( 25273),  INT16_C( 25735),  INT16_C( 15293),  INT16_C( 25780),  INT16_C(  3491), -INT16_C( 30365),
+       INT16_C(   595),  INT16_C( 31566), -INT16_C(  9471), -INT16_C( 17664),  INT16_C( 29330),  INT16_C(  9067),  INT16_C( 30866),  INT16_C( 11098),
+       INT16_C( 17133),  INT16_C( 13493),  INT16_C( 15583), -INT16_C( 25448),  INT16_C( 19575),  INT16_C(  6656),  INT16_C( 25433), -INT16_C( 21341),
+      -INT16_C(  3739),  INT16_C( 26152),  INT16_C( 10444),  INT16_C( 24097), -INT16_C( 29286),  INT16_C( 11393) };
+  static const int16_t e[] =
+    { -INT16_C( 17458),  INT16_C( 27771), -INT16_C( 15599), -INT16_C( 20470), -INT16_C( 20833),  INT16_C(   242),  INT16_C( 24982),  INT16_C(   359),
+       INT16_C(  8894),  INT16_C( 29547), -INT16_C( 31551), -INT16_C(  4477),  INT16_C( 11108),  INT16_C( 25723), -INT16_C( 24041), -INT16_C(  1959),
+       INT16_C( 19805),  INT16_C( 28242), -INT16_C( 31064), -INT16_C(  2931), -INT16_C( 12790), -INT16_C( 24164), -INT16_C(  6795),  INT16_C(  8669),
+      -INT16_C(  2751),  INT16_C( 24857),  INT16_C(  2784), -INT16_C( 21674),  INT16_C(  8516), -INT16_C( 26678), -INT16_C(  5437),  INT16_C(  8256),
+      -INT16_C( 28105),  INT16_C( 29317), -INT16_C( 21265), -INT16_C(  1546),  INT16_C( 24821), -INT16_C( 21862),  INT16_C(  3484),  INT16_C(  7682),
+       INT16_C( 27202), -INT16_C( 19236),  INT16_C( 20815),  INT16_C( 31840),  INT16_C( 14300),  INT16_C(  5358),  INT16_C(  5410),  INT16_C(  5683),
+      -INT16_C(  6719),  INT16_C( 29620), -INT16_C(  6005),  INT16_C(  3242),  INT16_C( 17539),  INT16_C( 23404),  INT16_C( 30159), -INT16_C( 15447),
+       INT16_C( 22468),  INT16_C(  2682), -INT16_C(  8583), -INT16_C( 31595),  INT16_C( 12764),  INT16_C(  1495), -INT16_C( 30632), -INT16_C( 18100),
+      -INT16_C( 19438), -INT16_C(  2240), -INT16_C( 10331),  INT16_C( 10416),  INT16_C( 26396), -INT16_C(  5272), -INT16_C( 25891), -INT16_C( 26465),
+       INT16_C(  6776), -INT16_C( 22878),  INT16_C( 16399), -INT16_C( 31607),  INT16_C(  7885),  INT16_C( 20279),  INT16_C( 21836),  INT16_C( 20805),
+       INT16_C( 13065), -INT16_C( 20990), -INT16_C( 19702),  INT16_C( 25424), -INT16_C(  2137),  INT16_C( 18502), -INT16_C( 20007),  INT16_C( 20879),
+       INT16_C( 13003),  INT16_C( 19226),  INT16_C( 16242), -INT16_C(  3446),  INT16_C(  3421), -INT16_C( 24114), -INT16_C( 12958), -INT16_C( 12452),
+       INT16_C( 11682), -INT16_C( 19079), -INT16_C(  4163), -INT16_C( 10191),  INT16_C( 17198), -INT16_C( 20406),  INT16_C( 24564),  INT16_C(  6004),
+       INT16_C( 15172),  INT16_C(   921),  INT16_C(  2702), -INT16_C( 13371), -INT16_C(  7564),  INT16_C( 15250), -INT16_C( 18721), -INT16_C(  9756),
+      -INT16_C(   600),  INT16_C( 26084),  INT16_C(  8291),  INT16_C(  6717), -INT16_C( 28198), -INT16_C( 10804), -INT16_C( 12917),  INT16_C( 26818),
+      -INT16_C( 23351), -INT16_C(   171),  INT16_C( 17326), -INT16_C( 11479), -INT16_C(  9906), -INT16_C( 17825), -INT16_C(  9592),  INT16_C(  7680),
+       INT16_C( 20196),  INT16_C(  3204), -INT16_C( 11522),  INT16_C( 21030),  INT16_C( 18638),  INT16_C( 15006), -INT16_C(  1809),  INT16_C( 25508),
+       INT16_C( 14414), -INT16_C(   542), -INT16_C(  6522), -INT16_C( 15159),  INT16_C( 28255), -INT16_C( 17789), -INT16_C(  3805),  INT16_C( 17299),
+      -INT16_C( 24473),  INT16_C( 15699),  INT16_C( 30169), -INT16_C( 22752),  INT16_C( 10152),  INT16_C( 21985),  INT16_C( 17423), -INT16_C( 18679),
+      -INT16_C( 13464), -INT16_C( 26872), -INT16_C( 25983),  INT16_C(  3991), -INT16_C(   158), -INT16_C( 25724), -INT16_C( 15988), -INT16_C( 29815),
+       INT16_C( 11567),  INT16_C( 17371),  INT16_C( 15779), -INT16_C( 14114), -INT16_C( 27908),  INT16_C( 23328),  INT16_C(  3356),  INT16_C( 14745),
+       INT16_C( 18045), -INT16_C(  9591),  INT16_C( 24904),  INT16_C( 18697),  INT16_C(  8482),  INT16_C( 27005),  INT16_C( 11638), -INT16_C( 15952),
+      -INT16_C( 13209), -INT16_C(  3543),  INT16_C( 10291), -INT16_C( 24462),  INT16_C( 18955), -INT16_C( 14752), -INT16_C( 30925), -INT16_C(  6417),
+       INT16_C( 31285), -INT16_C( 15763),  INT16_C(  2282), -INT16_C( 14240), -INT16_C( 17572), -INT16_C(  4822), -INT16_C(  9483),  INT16_C(  6117),
+       INT16_C( 30886),  INT16_C( 32265),  INT16_C( 31878),  INT16_C( 16485),  INT16_C(  8221), -INT16_C( 24382), -INT16_C(  4449),  INT16_C( 29701),
+       INT16_C( 18150),  INT16_C( 13461),  INT16_C(  2224), -INT16_C(  7352), -INT16_C( 18502), -INT16_C( 20366),  INT16_C(  8337),  INT16_C( 18326),
+       INT16_C( 29848), -INT16_C( 29977), -INT16_C( 25273),  INT16_C( 27964),  INT16_C( 21329), -INT16_C( 30388),  INT16_C(  3491), -INT16_C( 23831),
+      -INT16_C( 21831),  INT16_C( 31566),  INT16_C(  4513), -INT16_C( 17664), -INT16_C( 30671),  INT16_C(  9067),  INT16_C( 30866), -INT16_C( 27790),
+      -INT16_C( 21955),  INT16_C( 13493),  INT16_C( 29763), -INT16_C( 19886),  INT16_C( 19575), -INT16_C( 20012),  INT16_C(  1922), -INT16_C( 21341),
+      -INT16_C(  3739),  INT16_C( 26152),  INT16_C( 10444),  INT16_C(  6149), -INT16_C( 29286), -INT16_C( 27760) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1h_s32(pv, &(r[i]), simde_svld1_s32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(int32_t)];
+  int32_t a[1024 / sizeof(int32_t)];
+  int16_t b[1024 / sizeof(int32_t)];
+  int16_t e[1024 / sizeof(int32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1h_s32(pv, &(e[i]), simde_svld1_s32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1h_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    {  INT64_C( 4233785243625301586),  INT64_C( 7822859254084915945),  INT64_C( 3763196471879870537), -INT64_C( 8399965123614693874),
+       INT64_C( 6301849168992797178), -INT64_C( 4975281935775559812), -INT64_C(  442283037704037273),  INT64_C( 8078332340844241495),
+       INT64_C( 3154242327861134593),  INT64_C( 1970228855691244845), -INT64_C( 2744769691971825660),  INT64_C( 8910238247232895680),
+      -INT64_C( 7176853864880385653), -INT64_C( 4182276417167746778),  INT64_C( 1638074786463922017),  INT64_C( 3967095868792579351),
+      -INT64_C( 3580123484666005691),  INT64_C( 8897033801879292401), -INT64_C( 2251489984754340523),  INT64_C( 5125798976417828415),
+       INT64_C( 6840206336810783862), -INT64_C( 8616642605896067371),  INT64_C( 2405192554178136502), -INT64_C( 4013499667876883965),
+       INT64_C( 7606250553616058819), -INT64_C( 2366988875402207382),  INT64_C( 5949746930624977549), -INT64_C( 8022134912312631918),
+      -INT64_C( 3319911143803153681), -INT64_C( 7497202509611579667), -INT64_C( 6516261076910844944),  INT64_C( 9192186107545578037),
+      -INT64_C( 8286641322404458042), -INT64_C(  804290538447409611), -INT64_C( 6223194628817691158),  INT64_C( 2719677600471132847),
+      -INT64_C( 1893110876239380338), -INT64_C( 2541723494582494016),  INT64_C( 6986907873357458648),  INT64_C( 7793863838283047334),
+      -INT64_C( 8236147150130938850), -INT64_C( 6017359044236093265),  INT64_C( 8721766945260132599),  INT64_C( 2655900051347253649),
+       INT64_C( 8682560513599763747), -INT64_C( 3170647544902791042),  INT64_C( 8808343680981989616), -INT64_C( 8765758169803015378),
+       INT64_C( 8105061998690520122),  INT64_C( 2122816300635100358), -INT64_C( 6549043688710737478),  INT64_C(  415514013634004698),
+      -INT64_C(  512704258705441921),  INT64_C( 2405220612199589143),  INT64_C( 4331303279662482176), -INT64_C( 6288927055820425752),
+       INT64_C( 6531341252181016953),  INT64_C( 5487917947489762721), -INT64_C( 5196627511588229565),  INT64_C( 1415577901661379539),
+       INT64_C( 6666279329908834277),  INT64_C( 7221114229341036958), -INT64_C( 6196130831693907845),  INT64_C( 8571277605727530310),
+      -INT64_C( 5755281384782450422), -INT64_C( 8157760468277361341),  INT64_C(  309020760735339464),  INT64_C( 4995010113822846793),
+       INT64_C( 6217830693943898248),  INT64_C( 9030707589754381490),  INT64_C( 5916152150187846999),  INT64_C( 6833508569106480724),
+      -INT64_C( 4694928890517659537),  INT64_C( 8023680708621079336),  INT64_C( 3413621701936968964) };
+  static const int64_t a[] =
+    {  INT64_C( 8200727960447621293), -INT64_C( 5440785526184980224), -INT64_C( 7497617138247194676),  INT64_C( 5048821711509527814),
+       INT64_C(   13381059710036509),  INT64_C( 1725848745439189211), -INT64_C(  351317104061065063),  INT64_C( 1142459593834884604),
+      -INT64_C(  216458513423165698), -INT64_C(  200922125815778604), -INT64_C(  218807207754129146), -INT64_C( 8317185831264536174),
+       INT64_C( 3539417385969278977), -INT64_C( 8224269426366588549), -INT64_C( 7375913193362136153), -INT64_C( 6894535354274204617),
+      -INT64_C( 2261123240950572272),  INT64_C( 1967683211983121977), -INT64_C( 8313250921743919616), -INT64_C( 9161831893345124454),
+      -INT64_C( 5277502440530404226),  INT64_C( 2308311554241036921), -INT64_C( 3711588197757039717), -INT64_C( 1190955321342374263),
+       INT64_C( 7615750732587820412), -INT64_C( 8694375087486916842), -INT64_C( 3302839156266729686), -INT64_C( 8420813145663393853),
+      -INT64_C( 6988683331646392919), -INT64_C( 2031354637401564836),  INT64_C(   56409606380799916), -INT64_C( 9209200604789566569),
+       INT64_C( 5221111146535827277),  INT64_C( 2671021023789337462),  INT64_C( 5900810324304155047), -INT64_C( 4769829393000884105),
+       INT64_C( 8796664788866557920), -INT64_C( 6056855494060366764),  INT64_C( 7427969538832862219),  INT64_C( 1708978855768034698),
+      -INT64_C( 6419608235885245846),  INT64_C( 6218173986492354972), -INT64_C( 2970070849646044559),  INT64_C( 7677096950819224893),
+       INT64_C(  201185777803685585),  INT64_C( 1365697489925258578),  INT64_C( 8929014349032525512),  INT64_C( 1307021640050064056),
+       INT64_C( 1175158840811257063), -INT64_C( 6200997220436807107),  INT64_C( 6370527082052478127), -INT64_C( 5280693971653142941),
+       INT64_C( 3097724400049581360), -INT64_C(  301467069582890171), -INT64_C( 7397637140774351266), -INT64_C( 3806397536982374490),
+      -INT64_C( 3964937319681019678),  INT64_C( 6460624753138794849), -INT64_C( 8710614924476837811),  INT64_C( 3637828025552034581),
+       INT64_C( 5595154002993034585), -INT64_C( 6895112923459709701),  INT64_C( 7609746725231896115),  INT64_C( 1953882473454213275),
+       INT64_C( 1442167935651487434), -INT64_C( 3160582868044153552),  INT64_C( 2575359179194124032),  INT64_C( 4032740837393618715),
+      -INT64_C( 4866156390882873526), -INT64_C( 2566379043012247059), -INT64_C( 1705475793805620566), -INT64_C( 2780765446699981883),
+       INT64_C( 3743251350142342571),  INT64_C( 4606095642031370805), -INT64_C( 3448977712596640403) };
+  static const int16_t b[] =
+    { -INT16_C( 14953), -INT16_C(  4512), -INT16_C( 26716),  INT16_C( 19646), -INT16_C( 23302), -INT16_C( 11959),  INT16_C( 31848),  INT16_C( 10664),
+       INT16_C( 13009),  INT16_C( 16107), -INT16_C( 16819), -INT16_C(  9644),  INT16_C( 17143), -INT16_C( 26165), -INT16_C(  1857),  INT16_C( 22056),
+      -INT16_C( 30531),  INT16_C( 24900),  INT16_C(   544),  INT16_C(  6830), -INT16_C(  2138),  INT16_C(  3819), -INT16_C( 27789),  INT16_C( 17464),
+       INT16_C(  9158),  INT16_C(  4994), -INT16_C( 10271), -INT16_C( 10003), -INT16_C( 18407), -INT16_C( 10126), -INT16_C( 25935),  INT16_C( 28206),
+       INT16_C( 29219),  INT16_C( 17360),  INT16_C( 32372),  INT16_C(  7005),  INT16_C( 18805), -INT16_C(  6103),  INT16_C( 25052), -INT16_C( 24019),
+      -INT16_C( 20603),  INT16_C( 26294), -INT16_C( 23674), -INT16_C( 24513), -INT16_C( 20132),  INT16_C(  3448), -INT16_C( 22709),  INT16_C( 28283),
+       INT16_C( 19225), -INT16_C( 29007),  INT16_C(  4041),  INT16_C( 16041), -INT16_C( 11688),  INT16_C( 13351),  INT16_C( 21556), -INT16_C( 17961),
+      -INT16_C( 29437), -INT16_C( 30177),  INT16_C( 24112), -INT16_C( 29654), -INT16_C( 24049),  INT16_C( 23449),  INT16_C(  5449),  INT16_C( 25545),
+       INT16_C( 31584),  INT16_C( 10993), -INT16_C( 25974), -INT16_C(  7576), -INT16_C( 28820), -INT16_C( 24554), -INT16_C(  4637), -INT16_C(  6311),
+       INT16_C( 31098), -INT16_C( 21647), -INT16_C( 25641) };
+  static const int16_t e[] =
+    { -INT16_C( 14953), -INT16_C(  4512), -INT16_C( 26716),  INT16_C(  7430), -INT16_C( 23302), -INT16_C( 10021), -INT16_C( 10087),  INT16_C( 10664),
+       INT16_C( 13009),  INT16_C( 16107),  INT16_C(  8454), -INT16_C(  9644),  INT16_C( 24577),  INT16_C( 22907), -INT16_C(  1857),  INT16_C( 22056),
+      -INT16_C(  9456),  INT16_C( 24900), -INT16_C( 10752),  INT16_C(  6830), -INT16_C(  2138), -INT16_C( 32135), -INT16_C( 27789), -INT16_C( 12663),
+       INT16_C(  9158),  INT16_C( 10006), -INT16_C( 10271),  INT16_C( 12227), -INT16_C(  2647),  INT16_C( 22876),  INT16_C( 18348),  INT16_C( 28206),
+      -INT16_C( 18611),  INT16_C( 19318),  INT16_C( 20903),  INT16_C(  7005), -INT16_C(  6176), -INT16_C( 23468),  INT16_C( 25052), -INT16_C( 24019),
+       INT16_C( 19050), -INT16_C( 28260), -INT16_C( 23674), -INT16_C( 24513), -INT16_C( 20132),  INT16_C( 15698), -INT16_C( 22709), -INT16_C( 17736),
+       INT16_C( 19225), -INT16_C( 29007),  INT16_C( 25775),  INT16_C( 16041), -INT16_C(  4816),  INT16_C( 13351),  INT16_C( 21556),  INT16_C( 26534),
+      -INT16_C( 29437), -INT16_C( 30177), -INT16_C( 28595), -INT16_C( 29654), -INT16_C( 24049),  INT16_C( 23449), -INT16_C( 22989),  INT16_C( 25545),
+       INT16_C(  7882), -INT16_C(   720), -INT16_C( 25974), -INT16_C(  7576), -INT16_C( 28820), -INT16_C( 24554), -INT16_C(  4637), -INT16_C(  6311),
+       INT16_C( 21931), -INT16_C( 21647), -INT16_C( 25641) };
+
+  static int16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1h_s64(pv, &(r[i]), simde_svld1_s64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi16(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int64_t a[1024 / sizeof(int64_t)];
+  int16_t b[1024 / sizeof(int64_t)];
+  int16_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1h_s64(pv, &(e[i]), simde_svld1_s64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1h_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int32_t p[] =
+    { -INT32_C(  1585606391),  INT32_C(    62318473), -INT32_C(   391930708),  INT32_C(  1928177791),  INT32_C(  1523245455),  INT32_C(   100198606),  INT32_C(   541602226),  INT32_C(  1276915779),
+       INT32_C(  1273862594),  INT32_C(   760194176), -INT32_C(  1072303552),  INT32_C(   707920539), -INT32_C(  1299907100), -INT32_C(  1749516827), -INT32_C(   239664978), -INT32_C(   230829264),
+      -INT32_C(   331469972),  INT32_C(   253332943),  INT32_C(   449785471),  INT32_C(   356778545), -INT32_C(   456668673), -INT32_C(   193233082), -INT32_C(  1327091073),  INT32_C(  1906451205),
+       INT32_C(   492691534), -INT32_C(   315787411), -INT32_C(   704119643), -INT32_C(    34910978),  INT32_C(  1541518101), -INT32_C(  1303421902), -INT32_C(  1822280306), -INT32_C(  1492908967),
+       INT32_C(  1388667621),  INT32_C(  2118120153), -INT32_C(   313178130), -INT32_C(  1461043053),  INT32_C(   637783283), -INT32_C(  1210559960), -INT32_C(   515229048),  INT32_C(   596135742),
+      -INT32_C(  1971958351),  INT32_C(   772322623), -INT32_C(  1894031876), -INT32_C(  1858665058), -INT32_C(    88655151),  INT32_C(   363958157),  INT32_C(   150404041), -INT32_C(    81035702),
+       INT32_C(   193307084),  INT32_C(  1396280919), -INT32_C(  1981590293),  INT32_C(   723196506), -INT32_C(   500837803),  INT32_C(   737662562),  INT32_C(   473165266),  INT32_C(   924344171),
+       INT32_C(  1464048896),  INT32_C(   397114411),  INT32_C(   731942609), -INT32_C(    44647512), -INT32_C(   253789042),  INT32_C(   605804114),  INT32_C(   792809411), -INT32_C(  1369024082),
+       INT32_C(   570862070), -INT32_C(   147214042), -INT32_C(   417146561),  INT32_C(   602241173),  INT32_C(  1192477940),  INT32_C(  1584082587),  INT32_C(   730705021), -INT32_C(    52759547),
+      -INT32_C(  1021386595), -INT32_C(   793094255), -INT32_C(   977806288),  INT32_C(  1239981141), -INT32_C(    57607327), -INT32_C(  1487209430), -INT32_C(  1361844056),  INT32_C(  2041228764),
+       INT32_C(   507365517),  INT32_C(  1341060895),  INT32_C(   689284564), -INT32_C(  1552745150),  INT32_C(   597623801), -INT32_C(  1479869953), -INT32_C(  1118462495), -INT32_C(   684196022),
+      -INT32_C(   420121401),  INT32_C(  1060561771), -INT32_C(   882357367),  INT32_C(  1097784136), -INT32_C(   580645410), -INT32_C(   393990394),  INT32_C(   396745420), -INT32_C(  1578181415),
+      -INT32_C(  1131944880),  INT32_C(  1358675399),  INT32_C(  1360749576),  INT32_C(   496142655), -INT32_C(  1644497002), -INT32_C(   226132442),  INT32_C(   839461464),  INT32_C(  1473509383),
+      -INT32_C(  1559012644),  INT32_C(   552865560), -INT32_C(  1301213325),  INT32_C(   802096281),  INT32_C(   567069179), -INT32_C(  1609346745), -INT32_C(  2083381892), -INT32_C(   237329131),
+       INT32_C(   395636479),  INT32_C(  1882753277),  INT32_C(   824355224), -INT32_C(  1470041683),  INT32_C(    29961658), -INT32_C(    90055298),  INT32_C(   259879930),  INT32_C(   402675736),
+       INT32_C(  1127191622), -INT32_C(  1246533859), -INT32_C(  1092168431), -INT32_C(  2140715322), -INT32_C(   226414477),  INT32_C(   132915981), -INT32_C(  1357485418),  INT32_C(   147265218),
+      -INT32_C(   934545749),  INT32_C(  1870528094), -INT32_C(  1725078573),  INT32_C(   488215721), -INT32_C(   770729275),  INT32_C(  1423637437),  INT32_C(   654569573), -INT32_C(  1305490937),
+       INT32_C(   511343296),  INT32_C(  1267595128),  INT32_C(    65321818),  INT32_C(   337706319),  INT32_C(  1441214360), -INT32_C(  1867923157), -INT32_C(  1195856719),  INT32_C(   929752950),
+      -INT32_C(   631905182),  INT32_C(   891741147), -INT32_C(   315028834), -INT32_C(  1610458872), -INT32_C(  1258952311),  INT32_C(  1531223978), -INT32_C(  1038812085),  INT32_C(  1190756068),
+       INT32_C(  1042304611), -INT32_C(   814463439),  INT32_C(  1505602897), -INT32_C(  1879458042),  INT32_C(  1380183720), -INT32_C(   642938739),  INT32_C(  1755038084), -INT32_C(  1548839872),
+       INT32_C(   350343138),  INT32_C(  1726174485),  INT32_C(   163553282),  INT32_C(   127449183),  INT32_C(   878304423), -INT32_C(   401799324),  INT32_C(   139569352),  INT32_C(   531365692),
+      -INT32_C(   466383410), -INT32_C(   448129310),  INT32_C(   384699063),  INT32_C(  1763608258), -INT32_C(   962693278),  INT32_C(  1202695038), -INT32_C(  1873870764), -INT32_C(   827327489),
+       INT32_C(  1790108296), -INT32_C(  1336935175), -INT32_C(   909755130),  INT32_C(   640869572), -INT32_C(   621948836), -INT32_C(   803103620), -INT32_C(  1688178276), -INT32_C(   194441108),
+      -INT32_C(   346153998),  INT32_C(   513519128), -INT32_C(  1343790357), -INT32_C(  1563026874),  INT32_C(  1719518186), -INT32_C(    80306593),  INT32_C(  2073466639), -INT32_C(  1720778585),
+       INT32_C(   864407067),  INT32_C(  1733435516), -INT32_C(   921224830),  INT32_C(  1047260499),  INT32_C(   262465712), -INT32_C(  1777673337),  INT32_C(   420651122), -INT32_C(  1129152096),
+      -INT32_C(   873515185), -INT32_C(   634175144), -INT32_C(   828159365), -INT32_C(   418640073),  INT32_C(  2130096631), -INT32_C(    32178036),  INT32_C(  1092036512), -INT32_C(   117585496),
+       INT32_C(  1506012161), -INT32_C(  1456212434),  INT32_C(  2004342592), -INT32_C(   581008154), -INT32_C(  1050913739), -INT32_C(   172002988),  INT32_C(  1077335704), -INT32_C(  1606929505),
+       INT32_C(  1308228639),  INT32_C(   871771634), -INT32_C(   357929468),  INT32_C(   667355634), -INT32_C(  1293409443),  INT32_C(   749184916),  INT32_C(   476962173),  INT32_C(   800957712),
+      -INT32_C(  1803700575), -INT32_C(   406359069), -INT32_C(   741248543), -INT32_C(   654665350),  INT32_C(  1368056508),  INT32_C(   108867977),  INT32_C(   505670158),  INT32_C(   827187344),
+       INT32_C(  2059782806),  INT32_C(   526486590),  INT32_C(  2029204478), -INT32_C(  2007962164),  INT32_C(  1507449552),  INT32_C(   425744139) };
+  static const uint32_t a[] =
+    { UINT32_C(4051179186), UINT32_C(2050526072), UINT32_C(1695175530), UINT32_C(2019030987), UINT32_C(1454590619), UINT32_C(3148594265), UINT32_C(2985688421), UINT32_C(4167587653),
+      UINT32_C(3874087021), UINT32_C(3596624492), UINT32_C(1077701237), UINT32_C(4240020321), UINT32_C( 928148701), UINT32_C(2381511976), UINT32_C(1077864698), UINT32_C(2889393727),
+      UINT32_C(4086440327), UINT32_C(3117019971), UINT32_C(3220768093), UINT32_C(1992012440), UINT32_C(1185746462), UINT32_C( 114532107), UINT32_C(3326480775), UINT32_C(1064533688),
+      UINT32_C(3811706271), UINT32_C(1453128696), UINT32_C(2568328449), UINT32_C(1712312392), UINT32_C(3937254622), UINT32_C(3824189532), UINT32_C(1252669074), UINT32_C(1401494964),
+      UINT32_C( 456571682), UINT32_C(3077690038), UINT32_C(2958132840), UINT32_C( 890658902), UINT32_C(2032124701), UINT32_C(3596357444), UINT32_C(4179625541), UINT32_C(1179429155),
+      UINT32_C( 442598244), UINT32_C(3184710229), UINT32_C(2926388056), UINT32_C(2699265155), UINT32_C(2333672007), UINT32_C(1449227793), UINT32_C(2689565052), UINT32_C(2397477930),
+      UINT32_C(1957250847), UINT32_C(1899133721), UINT32_C( 555720606), UINT32_C(1807876899), UINT32_C( 402053893), UINT32_C(3463272529), UINT32_C(  74366425), UINT32_C(2022855769),
+      UINT32_C(3035380635), UINT32_C(1411718838), UINT32_C(3782624446), UINT32_C(1296840775), UINT32_C(1701069587), UINT32_C(1949553051), UINT32_C(3883442574), UINT32_C(2422148085),
+      UINT32_C(4249111622), UINT32_C( 676424042), UINT32_C(4111124397), UINT32_C( 323114751), UINT32_C( 880322201), UINT32_C( 111782775), UINT32_C(1106059596), UINT32_C(1943096620),
+      UINT32_C(  57677209), UINT32_C( 724353406), UINT32_C(2283812489), UINT32_C( 647717516), UINT32_C(2153386760), UINT32_C( 176554942), UINT32_C(1363899173), UINT32_C(1506024640),
+      UINT32_C(2942121009), UINT32_C(2145094134), UINT32_C(1258814399), UINT32_C(1718723422), UINT32_C(1978059958), UINT32_C(4101991631), UINT32_C(2688994272), UINT32_C( 435817191),
+      UINT32_C( 902321983), UINT32_C(2679415776), UINT32_C(4260019103), UINT32_C( 358833246), UINT32_C(4153035304), UINT32_C(2532051382), UINT32_C(3157734100), UINT32_C(2077569340),
+      UINT32_C(1756405128), UINT32_C(3758580801), UINT32_C(2128474400), UINT32_C(1972584525), UINT32_C(1097670026), UINT32_C(4225194279), UINT32_C(3350662795), UINT32_C(3343092799),
+      UINT32_C(1798304554), UINT32_C(2018195032), UINT32_C(1979066408), UINT32_C(4092299880), UINT32_C(3459537063), UINT32_C(1019874225), UINT32_C(1493401882), UINT32_C( 941704718),
+      UINT32_C(2460176442), UINT32_C(2936729223), UINT32_C(2116288534), UINT32_C( 846270346), UINT32_C( 402695527), UINT32_C(3411331761), UINT32_C(1512331340), UINT32_C(3633464734),
+      UINT32_C( 493499798), UINT32_C( 969700387), UINT32_C(4290244725), UINT32_C(1731275008), UINT32_C(2139108046), UINT32_C(1212863740), UINT32_C(3416420140), UINT32_C(1252209844),
+      UINT32_C(2355564137), UINT32_C(4156896130), UINT32_C( 620199204), UINT32_C(1955276966), UINT32_C(1475611482), UINT32_C( 211762912), UINT32_C(1658274477), UINT32_C(3769400182),
+      UINT32_C( 191632521), UINT32_C(1795371591), UINT32_C(1435499183), UINT32_C(2110331682), UINT32_C( 114605350), UINT32_C(2836624380), UINT32_C( 738978485), UINT32_C(3993811045),
+      UINT32_C( 335182028), UINT32_C(1501560234), UINT32_C( 430837495), UINT32_C(1352038441), UINT32_C( 827746869), UINT32_C(2480630238), UINT32_C(3116361300), UINT32_C(1789447070),
+      UINT32_C(4001276484), UINT32_C(2521365919), UINT32_C( 900724235), UINT32_C(2760197742), UINT32_C(2396380080), UINT32_C(2569187397), UINT32_C( 894624151), UINT32_C(4053858989),
+      UINT32_C(1004478108), UINT32_C( 651241243), UINT32_C(2354807070), UINT32_C(1999691975), UINT32_C(  17172156), UINT32_C(1301948598), UINT32_C(3062098953), UINT32_C(2208768999),
+      UINT32_C(1556055873), UINT32_C(3431108782), UINT32_C(3629768209), UINT32_C(2052098494), UINT32_C(1182488207), UINT32_C(2274563454), UINT32_C(3913160194), UINT32_C(2053956921),
+      UINT32_C( 467020652), UINT32_C(3454491068), UINT32_C(4121313335), UINT32_C(1500575434), UINT32_C(3399478092), UINT32_C(  55653121), UINT32_C(2213318473), UINT32_C(3791476853),
+      UINT32_C(1090311300), UINT32_C(1678631981), UINT32_C(3998855972), UINT32_C(4115188137), UINT32_C(3066030005), UINT32_C(1689850138), UINT32_C( 367502752), UINT32_C(2180506877),
+      UINT32_C(3854693304), UINT32_C(4232695767), UINT32_C( 753574786), UINT32_C( 555823724), UINT32_C( 886563098), UINT32_C(2459472114), UINT32_C( 866680629), UINT32_C( 481599332),
+      UINT32_C(1778546322), UINT32_C(3345369925), UINT32_C(1542672622), UINT32_C(2642154883), UINT32_C(3906032886), UINT32_C( 444230372), UINT32_C(1296900841), UINT32_C(1416233409),
+      UINT32_C(3166596215), UINT32_C(2793678007), UINT32_C(4144068468), UINT32_C(2190769548), UINT32_C(3060426449), UINT32_C(3117475280), UINT32_C(3372686599), UINT32_C(2518511902),
+      UINT32_C(2488458205), UINT32_C(1933235967), UINT32_C(3664460622), UINT32_C(2321416121), UINT32_C( 893437797), UINT32_C(3035566252), UINT32_C(1283323437), UINT32_C(1155701351),
+      UINT32_C(1960326261), UINT32_C(1508315915), UINT32_C( 120803918), UINT32_C(3079835730), UINT32_C(  82694744), UINT32_C( 280550627), UINT32_C( 962344402), UINT32_C(1149058767),
+      UINT32_C(2126009715), UINT32_C(3084361832), UINT32_C(1153305330), UINT32_C(4093399195), UINT32_C( 116910371), UINT32_C(2534846661) };
+  static const uint16_t b[] =
+    { UINT16_C(44724), UINT16_C(10879), UINT16_C( 5380), UINT16_C(56099), UINT16_C(15412), UINT16_C(55427), UINT16_C( 8038), UINT16_C(39658),
+      UINT16_C(12213), UINT16_C(23688), UINT16_C( 5182), UINT16_C(59270), UINT16_C(58869), UINT16_C( 9079), UINT16_C(37021), UINT16_C(21072),
+      UINT16_C(53054), UINT16_C(17276), UINT16_C(40932), UINT16_C( 6174), UINT16_C(41691), UINT16_C(17136), UINT16_C(56001), UINT16_C(30684),
+      UINT16_C(25609), UINT16_C(18387), UINT16_C(22905), UINT16_C(28206), UINT16_C(42302), UINT16_C(56209), UINT16_C(57654), UINT16_C(29741),
+      UINT16_C(43441), UINT16_C(38327), UINT16_C(54857), UINT16_C( 9390), UINT16_C(40568), UINT16_C(14694), UINT16_C(17273), UINT16_C(33456),
+      UINT16_C(33703), UINT16_C( 8394), UINT16_C(63708), UINT16_C( 6798), UINT16_C( 8094), UINT16_C(54518), UINT16_C( 8961), UINT16_C(45640),
+      UINT16_C(  205), UINT16_C( 5703), UINT16_C(62934), UINT16_C(20026), UINT16_C(41364), UINT16_C( 3463), UINT16_C(14564), UINT16_C(35727),
+      UINT16_C(22971), UINT16_C(39084), UINT16_C(14930), UINT16_C(61618), UINT16_C(43098), UINT16_C(23492), UINT16_C( 3276), UINT16_C(39181),
+      UINT16_C(21516), UINT16_C(58031), UINT16_C(59722), UINT16_C(56880), UINT16_C(47242), UINT16_C(28395), UINT16_C(31472), UINT16_C(44026),
+      UINT16_C(42708), UINT16_C( 9795), UINT16_C(63200), UINT16_C(14870), UINT16_C(55966), UINT16_C(27285), UINT16_C(41702), UINT16_C(62211),
+      UINT16_C(45815), UINT16_C(16853), UINT16_C( 1692), UINT16_C( 9759), UINT16_C( 2750), UINT16_C(44693), UINT16_C(36740), UINT16_C(22617),
+      UINT16_C(40245), UINT16_C( 5502), UINT16_C(38035), UINT16_C(12624), UINT16_C(58734), UINT16_C(21916), UINT16_C(40840), UINT16_C(32584),
+      UINT16_C( 7506), UINT16_C(61120), UINT16_C(57123), UINT16_C(57620), UINT16_C(43497), UINT16_C(28047), UINT16_C(59704), UINT16_C(28102),
+      UINT16_C(17542), UINT16_C( 6531), UINT16_C(54233), UINT16_C(18250), UINT16_C(59064), UINT16_C(16540), UINT16_C(58502), UINT16_C(55487),
+      UINT16_C(32514), UINT16_C( 9670), UINT16_C(55902), UINT16_C(18183), UINT16_C(38532), UINT16_C(48309), UINT16_C(31615), UINT16_C( 1322),
+      UINT16_C(44479), UINT16_C(38942), UINT16_C(27008), UINT16_C(14560), UINT16_C(31823), UINT16_C(54649), UINT16_C(14433), UINT16_C(25517),
+      UINT16_C(29624), UINT16_C( 5768), UINT16_C(36686), UINT16_C(53854), UINT16_C( 4902), UINT16_C(42382), UINT16_C(47246), UINT16_C(19883),
+      UINT16_C(51557), UINT16_C(58854), UINT16_C(50738), UINT16_C(33310), UINT16_C(38722), UINT16_C(41815), UINT16_C( 1487), UINT16_C(34566),
+      UINT16_C(36728), UINT16_C(50846), UINT16_C(64542), UINT16_C(17560), UINT16_C( 9999), UINT16_C(40426), UINT16_C(38367), UINT16_C(17898),
+      UINT16_C(53342), UINT16_C(37162), UINT16_C(18582), UINT16_C(55571), UINT16_C(27359), UINT16_C(44924), UINT16_C(33647), UINT16_C(59446),
+      UINT16_C(54290), UINT16_C(12462), UINT16_C(18384), UINT16_C(57205), UINT16_C(24430), UINT16_C(19836), UINT16_C(26612), UINT16_C(21138),
+      UINT16_C(48439), UINT16_C(52963), UINT16_C(62981), UINT16_C(58791), UINT16_C( 9057), UINT16_C(53396), UINT16_C(51878), UINT16_C(47288),
+      UINT16_C(26527), UINT16_C(28649), UINT16_C(24238), UINT16_C( 7247), UINT16_C(52157), UINT16_C(45417), UINT16_C(64562), UINT16_C(27139),
+      UINT16_C(59321), UINT16_C(48696), UINT16_C(57309), UINT16_C(16035), UINT16_C(14082), UINT16_C(43279), UINT16_C(50946), UINT16_C(41313),
+      UINT16_C(18990), UINT16_C(56336), UINT16_C(24488), UINT16_C(26104), UINT16_C(25131), UINT16_C(23830), UINT16_C( 6750), UINT16_C( 6087),
+      UINT16_C(65281), UINT16_C(57045), UINT16_C(31198), UINT16_C(57629), UINT16_C(11440), UINT16_C(45706), UINT16_C(60403), UINT16_C( 8787),
+      UINT16_C(25654), UINT16_C(57086), UINT16_C(63427), UINT16_C(60996), UINT16_C(23129), UINT16_C(46924), UINT16_C( 4980), UINT16_C(30158),
+      UINT16_C(41747), UINT16_C(61780), UINT16_C(28956), UINT16_C(52690), UINT16_C(23709), UINT16_C(36991), UINT16_C(54088), UINT16_C(32434),
+      UINT16_C(45367), UINT16_C(64092), UINT16_C(41128), UINT16_C(  489), UINT16_C(13819), UINT16_C(28600), UINT16_C(34376), UINT16_C(23525),
+      UINT16_C(14633), UINT16_C(17997), UINT16_C( 8106), UINT16_C(18195), UINT16_C(37500), UINT16_C(50391) };
+  static const uint16_t e[] =
+    { UINT16_C( 5810), UINT16_C(10879), UINT16_C(21354), UINT16_C(56099), UINT16_C(15412), UINT16_C(55427), UINT16_C( 8038), UINT16_C(39658),
+      UINT16_C(12213), UINT16_C(23688), UINT16_C(27253), UINT16_C(59270), UINT16_C(27869), UINT16_C(64808), UINT16_C(59642), UINT16_C(42559),
+      UINT16_C( 8583), UINT16_C(17276), UINT16_C(40932), UINT16_C( 6174), UINT16_C( 3614), UINT16_C(40715), UINT16_C( 4487), UINT16_C(30684),
+      UINT16_C(25609), UINT16_C(64504), UINT16_C(38145), UINT16_C(53320), UINT16_C(42302), UINT16_C(32860), UINT16_C(13970), UINT16_C( 7604),
+      UINT16_C(43441), UINT16_C(38327), UINT16_C(34408), UINT16_C(24662), UINT16_C(40568), UINT16_C( 3908), UINT16_C( 1605), UINT16_C(33456),
+      UINT16_C(33636), UINT16_C( 8394), UINT16_C( 9048), UINT16_C(33923), UINT16_C(  583), UINT16_C(54518), UINT16_C( 8961), UINT16_C(39978),
+      UINT16_C(  205), UINT16_C( 5703), UINT16_C(40862), UINT16_C(20026), UINT16_C(56069), UINT16_C( 3463), UINT16_C(14564), UINT16_C(35727),
+      UINT16_C(22971), UINT16_C(39084), UINT16_C(14930), UINT16_C(14407), UINT16_C(17171), UINT16_C(23492), UINT16_C( 3276), UINT16_C( 3061),
+      UINT16_C(21516), UINT16_C(26986), UINT16_C(51117), UINT16_C(56880), UINT16_C(47242), UINT16_C(28395), UINT16_C(31472), UINT16_C(19756),
+      UINT16_C( 5529), UINT16_C(49534), UINT16_C(13961), UINT16_C(14870), UINT16_C( 4872), UINT16_C(  958), UINT16_C(29477), UINT16_C(62211),
+      UINT16_C(45815), UINT16_C(16853), UINT16_C( 1692), UINT16_C(41822), UINT16_C( 2750), UINT16_C(27855), UINT16_C(52192), UINT16_C( 2791),
+      UINT16_C(22335), UINT16_C( 5502), UINT16_C(48031), UINT16_C(12624), UINT16_C(18984), UINT16_C( 2486), UINT16_C(40840), UINT16_C(12604),
+      UINT16_C(40328), UINT16_C(61120), UINT16_C(57123), UINT16_C(57620), UINT16_C( 7562), UINT16_C(22823), UINT16_C(59704), UINT16_C(28102),
+      UINT16_C(62250), UINT16_C( 6531), UINT16_C(10280), UINT16_C(18250), UINT16_C(59064), UINT16_C( 2993), UINT16_C(33050), UINT16_C(17934),
+      UINT16_C(32514), UINT16_C( 9670), UINT16_C(55902), UINT16_C( 3978), UINT16_C(38532), UINT16_C(51889), UINT16_C(31615), UINT16_C( 1322),
+      UINT16_C(44479), UINT16_C(29731), UINT16_C(61557), UINT16_C(10496), UINT16_C(13006), UINT16_C(54649), UINT16_C(28460), UINT16_C(25517),
+      UINT16_C( 3689), UINT16_C( 5768), UINT16_C(32036), UINT16_C(53854), UINT16_C( 2906), UINT16_C(42382), UINT16_C(47246), UINT16_C(31606),
+      UINT16_C(51557), UINT16_C(58854), UINT16_C(50738), UINT16_C(33310), UINT16_C(38722), UINT16_C(29692), UINT16_C(60085), UINT16_C(34566),
+      UINT16_C(30924), UINT16_C(50846), UINT16_C( 3831), UINT16_C(30761), UINT16_C(27189), UINT16_C(40426), UINT16_C(58964), UINT16_C(17898),
+      UINT16_C(53342), UINT16_C(64927), UINT16_C(18582), UINT16_C(18030), UINT16_C(27359), UINT16_C(45125), UINT16_C(33647), UINT16_C(64173),
+      UINT16_C(54290), UINT16_C(12462), UINT16_C(18384), UINT16_C(57205), UINT16_C(24430), UINT16_C(10422), UINT16_C(26612), UINT16_C(21138),
+      UINT16_C(34625), UINT16_C(37038), UINT16_C(62981), UINT16_C(58791), UINT16_C(22159), UINT16_C(53396), UINT16_C( 5634), UINT16_C(58681),
+      UINT16_C(26527), UINT16_C(22972), UINT16_C(16439), UINT16_C( 7247), UINT16_C(60236), UINT16_C(13057), UINT16_C(36681), UINT16_C(22645),
+      UINT16_C(54404), UINT16_C(48696), UINT16_C(45860), UINT16_C(51625), UINT16_C(14082), UINT16_C( 4378), UINT16_C(50946), UINT16_C(58621),
+      UINT16_C(18990), UINT16_C(56336), UINT16_C(41858), UINT16_C(26104), UINT16_C(25131), UINT16_C(37106), UINT16_C( 6750), UINT16_C(40804),
+      UINT16_C(30354), UINT16_C(19269), UINT16_C(20718), UINT16_C( 5507), UINT16_C(11440), UINT16_C(27364), UINT16_C(60403), UINT16_C(  449),
+      UINT16_C(25654), UINT16_C( 9399), UINT16_C(63427), UINT16_C(32140), UINT16_C(26321), UINT16_C(58832), UINT16_C( 4980), UINT16_C(28958),
+      UINT16_C(41747), UINT16_C(61780), UINT16_C(15182), UINT16_C(52690), UINT16_C(51045), UINT16_C(36991), UINT16_C(54088), UINT16_C(32434),
+      UINT16_C(13429), UINT16_C( 4875), UINT16_C(21070), UINT16_C(36946), UINT16_C(13819), UINT16_C(28600), UINT16_C(34376), UINT16_C(23525),
+      UINT16_C(14633), UINT16_C(17997), UINT16_C( 8106), UINT16_C(20635), UINT16_C(37500), UINT16_C(50391) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1h_u32(pv, &(r[i]), simde_svld1_u32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int32_t p[1024 / sizeof(uint32_t)];
+  uint32_t a[1024 / sizeof(uint32_t)];
+  uint16_t b[1024 / sizeof(uint32_t)];
+  uint16_t e[1024 / sizeof(uint32_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b32_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b32(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s32(pg, simde_svld1_s32(pg, &(p[i])), simde_svdup_n_s32(INT32_C(0)));
+
+    simde_svst1h_u32(pv, &(e[i]), simde_svld1_u32(pg, &(a[i])));
+
+    i += simde_svcntw();
+    pg = simde_svwhilelt_b32_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1h_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 2737616037030716336), -INT64_C( 4048534848503719017),  INT64_C( 3616124524493834331), -INT64_C( 8619679438549325739),
+       INT64_C( 6876310297696387035), -INT64_C( 6506701683681291285),  INT64_C( 2261202605973224470), -INT64_C( 8966742002719004465),
+      -INT64_C( 7592360150693372805),  INT64_C(  218203500121906967),  INT64_C( 8492824242133483506),  INT64_C( 7901015730873448315),
+       INT64_C( 6442771188886322471),  INT64_C( 1559021874988182706), -INT64_C( 2225713459414052095), -INT64_C( 3871782158967990044),
+      -INT64_C(  503552927972133528), -INT64_C( 9139709646995931407), -INT64_C( 8334680045085197810),  INT64_C( 7730894968333752796),
+      -INT64_C( 2459499845563062627), -INT64_C( 4622634193515350313),  INT64_C( 2542713302013903380), -INT64_C( 1058086063074792223),
+       INT64_C( 6240498690119067090), -INT64_C( 5000535289816511702),  INT64_C( 3959718872679370121),  INT64_C( 6031001056020501868),
+       INT64_C( 7396506238538844368),  INT64_C( 7248223482855707447),  INT64_C( 4050468676274752938), -INT64_C( 8317678211777867332),
+      -INT64_C( 8802988822253297101), -INT64_C( 7056303936354838573),  INT64_C( 2957408573943793157), -INT64_C( 2202830113229831388),
+      -INT64_C( 7174755607221614437), -INT64_C( 3616569960865017795),  INT64_C( 7221988470558715042),  INT64_C( 3835574404356874411),
+      -INT64_C( 1341916898629088518), -INT64_C( 6200633121992431011), -INT64_C( 1945851659771342759), -INT64_C( 1197543031499242606),
+       INT64_C( 7611104315531558659),  INT64_C(  319334098815336125), -INT64_C( 6111776011855190255), -INT64_C( 1674432076682138401),
+       INT64_C( 5129102488516654776),  INT64_C( 5667913436697967865), -INT64_C( 4510980774663010656),  INT64_C( 3242690091165236275),
+      -INT64_C( 3485751106092295217), -INT64_C( 4222376279481799716), -INT64_C(  574520366534230174), -INT64_C( 4268830854134850784),
+      -INT64_C( 5813938402833353557),  INT64_C( 4707158672735257448), -INT64_C( 2959837237186538962), -INT64_C( 5053269623056827097),
+       INT64_C( 2478540799679855842), -INT64_C( 8327716061739798962), -INT64_C( 6457761095632227116), -INT64_C( 2436269296989319831),
+       INT64_C( 4934249698892737182),  INT64_C(    5031552131082535),  INT64_C( 7492560403345084884), -INT64_C(  319176827960640328),
+       INT64_C( 5166416157914375800), -INT64_C( 2944829675801926667),  INT64_C( 5751701006373858158),  INT64_C( 3979657865052008673),
+       INT64_C( 5702216121653235131),  INT64_C( 4131368536368017018), -INT64_C( 8781043294338252740),  INT64_C( 8583297651628647975),
+      -INT64_C( 7839513396774780276),  INT64_C( 8243389646035330146), -INT64_C( 6263547746817078297),  INT64_C( 7188497995922397327),
+      -INT64_C( 1433414026753665682),  INT64_C( 8919801907293793314),  INT64_C(  483604208122597259),  INT64_C( 7002838978610153204),
+       INT64_C( 1701802062996076585), -INT64_C( 4377999971309340624),  INT64_C( 6252551416356816455),  INT64_C( 6061933247261120460),
+       INT64_C( 4383591286461302984), -INT64_C( 4298617135216769955),  INT64_C( 8880053580808267908),  INT64_C( 8637722316026568288),
+      -INT64_C( 1753577515236596382),  INT64_C( 7822986649070774863), -INT64_C( 4817005118957087492),  INT64_C( 2023004340058874093),
+      -INT64_C( 6809946957691533300), -INT64_C( 3732078022825739297),  INT64_C(  300787994811926290), -INT64_C( 6353537167907588867),
+       INT64_C( 8354104278444302075),  INT64_C( 7805705013769755832) };
+  static const uint64_t a[] =
+    { UINT64_C(  352758501299166818), UINT64_C( 9692296063816819914), UINT64_C(16767778529756484675), UINT64_C( 8889138203446202884),
+      UINT64_C(15361578265817172783), UINT64_C( 2134807215668389678), UINT64_C( 5806136406515855087), UINT64_C( 1653134318676957020),
+      UINT64_C(14900002828251715303), UINT64_C(17027978233366683992), UINT64_C(  959876610324375222), UINT64_C( 1549085634742915457),
+      UINT64_C(10032277464690442699), UINT64_C( 6798480129539317872), UINT64_C(11309297442867966004), UINT64_C(13116317113658996419),
+      UINT64_C( 5549660543798807878), UINT64_C(  324280957827465850), UINT64_C( 6249267378566848515), UINT64_C( 9940092278729588305),
+      UINT64_C(16754523579869172570), UINT64_C( 6097182653105716937), UINT64_C(12922000930713470571), UINT64_C( 4806997664102063081),
+      UINT64_C( 9749164812528105461), UINT64_C( 5539636313786963259), UINT64_C( 7374537177306911299), UINT64_C( 2189673185326352185),
+      UINT64_C( 1604914082098568448), UINT64_C( 7299916228110476578), UINT64_C( 8050291219857250517), UINT64_C(10732065357055413160),
+      UINT64_C( 6899962395231416785), UINT64_C(13583895407773246716), UINT64_C(10804072754426317897), UINT64_C( 4916336997941280530),
+      UINT64_C( 2262127676811676871), UINT64_C(13815003474229577237), UINT64_C(11515473956312172108), UINT64_C( 6009349517626128045),
+      UINT64_C( 2039491845785343243), UINT64_C(10860379146347448961), UINT64_C(15187439920513873560), UINT64_C(10643510637158926806),
+      UINT64_C( 5319048890106842286), UINT64_C( 6086889486036363928), UINT64_C(13827807777167854063), UINT64_C(16096382052598929734),
+      UINT64_C(14480311061109285602), UINT64_C( 2188787000078382416), UINT64_C( 6634673160227838315), UINT64_C(17078365612581467377),
+      UINT64_C( 5595032030243428013), UINT64_C(15928592459883958209), UINT64_C( 5189911863410966419), UINT64_C( 7670032296831562106),
+      UINT64_C( 6146830286346193155), UINT64_C(17621550017188046396), UINT64_C( 9021453340287876754), UINT64_C( 1007806905860660693),
+      UINT64_C( 7883087360249643900), UINT64_C(10400403625474763521), UINT64_C( 7919205665870574437), UINT64_C(15591738283904723016),
+      UINT64_C(14545589718301109567), UINT64_C(  398991466567497979), UINT64_C(17832377306042991475), UINT64_C(12930302323410434109),
+      UINT64_C(12009129520031488791), UINT64_C(14311077675591062263), UINT64_C(11228118592263358764), UINT64_C(15918718099347741635),
+      UINT64_C(  167305037943081984), UINT64_C( 5210159111774794293), UINT64_C( 3258342693660729150), UINT64_C( 1274886003729132304),
+      UINT64_C(  389577651712191578), UINT64_C( 8387069431524425984), UINT64_C(10128955636513277946), UINT64_C(11444512259823564210),
+      UINT64_C(11480920777260568704), UINT64_C(13193330003459957102), UINT64_C( 2427067942024456358), UINT64_C(11854801488266334370),
+      UINT64_C( 7098879129309907015), UINT64_C(  332455340430212905), UINT64_C(  636931030127130694), UINT64_C(13307418303773194981),
+      UINT64_C( 1319874553922298362), UINT64_C(13602161111841920865), UINT64_C(11942218829384575822), UINT64_C( 1525414171769809154),
+      UINT64_C( 5546558887748225533), UINT64_C(15411266828207190444), UINT64_C(11250348770158203324), UINT64_C( 3034928263505891565),
+      UINT64_C( 2610691919219597828), UINT64_C(15372796644542531835), UINT64_C( 1273518293857198198), UINT64_C(18057809386500963139),
+      UINT64_C(12823759926835391323), UINT64_C(15662265388680559981) };
+  static const uint16_t b[] =
+    { UINT16_C(36904), UINT16_C(23916), UINT16_C( 9173), UINT16_C(13201), UINT16_C( 3315), UINT16_C(43272), UINT16_C( 7777), UINT16_C(32462),
+      UINT16_C(21293), UINT16_C(  585), UINT16_C(50658), UINT16_C( 9385), UINT16_C(46354), UINT16_C(22806), UINT16_C(52342), UINT16_C(40918),
+      UINT16_C(16988), UINT16_C(12796), UINT16_C(36197), UINT16_C(22884), UINT16_C(28057), UINT16_C(64002), UINT16_C(53643), UINT16_C(47225),
+      UINT16_C(49700), UINT16_C( 1722), UINT16_C(25735), UINT16_C(39211), UINT16_C(16665), UINT16_C(36850), UINT16_C(51213), UINT16_C(26926),
+      UINT16_C(10763), UINT16_C(28827), UINT16_C(65463), UINT16_C(20681), UINT16_C(52332), UINT16_C(63307), UINT16_C(50333), UINT16_C(49583),
+      UINT16_C(27270), UINT16_C( 3527), UINT16_C(62158), UINT16_C(59303), UINT16_C(39219), UINT16_C(16502), UINT16_C(42338), UINT16_C(28074),
+      UINT16_C(17871), UINT16_C(34781), UINT16_C(42820), UINT16_C(45527), UINT16_C( 8819), UINT16_C( 4264), UINT16_C(22758), UINT16_C(27857),
+      UINT16_C(39106), UINT16_C(36986), UINT16_C( 8587), UINT16_C(48759), UINT16_C(60858), UINT16_C( 7423), UINT16_C(43410), UINT16_C(25225),
+      UINT16_C(26606), UINT16_C(13033), UINT16_C(49166), UINT16_C(33251), UINT16_C(36067), UINT16_C(51601), UINT16_C(25316), UINT16_C(42550),
+      UINT16_C(45306), UINT16_C(34102), UINT16_C(44497), UINT16_C(35652), UINT16_C(17306), UINT16_C(11688), UINT16_C(12780), UINT16_C(55951),
+      UINT16_C(30872), UINT16_C(42508), UINT16_C(61496), UINT16_C( 6951), UINT16_C(47228), UINT16_C(24805), UINT16_C( 6938), UINT16_C( 5382),
+      UINT16_C(15563), UINT16_C(40090), UINT16_C(57065), UINT16_C(33575), UINT16_C(53025), UINT16_C( 3504), UINT16_C(16129), UINT16_C(39399),
+      UINT16_C(62647), UINT16_C(61504), UINT16_C(26596), UINT16_C(24587), UINT16_C(61472), UINT16_C(15040) };
+  static const uint16_t e[] =
+    { UINT16_C(40546), UINT16_C(58570), UINT16_C( 9173), UINT16_C(53764), UINT16_C( 3315), UINT16_C(59182), UINT16_C( 7777), UINT16_C(22364),
+      UINT16_C(22247), UINT16_C(  585), UINT16_C(50658), UINT16_C( 9385), UINT16_C(46354), UINT16_C(22806), UINT16_C(61492), UINT16_C(30403),
+      UINT16_C( 3398), UINT16_C(49786), UINT16_C(57347), UINT16_C(22884), UINT16_C( 4954), UINT16_C(16073), UINT16_C(53643), UINT16_C(39913),
+      UINT16_C(49700), UINT16_C(21819), UINT16_C(25735), UINT16_C(39211), UINT16_C(16665), UINT16_C(36850), UINT16_C(51213), UINT16_C(19368),
+      UINT16_C(29137), UINT16_C(25852), UINT16_C(65463), UINT16_C(32530), UINT16_C(36039), UINT16_C(50709), UINT16_C(50333), UINT16_C(49583),
+      UINT16_C(21771), UINT16_C(35457), UINT16_C(63128), UINT16_C( 2518), UINT16_C(39219), UINT16_C(16502), UINT16_C(18927), UINT16_C(55622),
+      UINT16_C(17871), UINT16_C(34781), UINT16_C(55659), UINT16_C(45527), UINT16_C(38573), UINT16_C(20417), UINT16_C(16275), UINT16_C(12666),
+      UINT16_C( 2307), UINT16_C(36986), UINT16_C(48786), UINT16_C(40405), UINT16_C(60858), UINT16_C(43777), UINT16_C(62309), UINT16_C(59464),
+      UINT16_C(26606), UINT16_C(13033), UINT16_C(49166), UINT16_C(30781), UINT16_C(36067), UINT16_C(54007), UINT16_C(25316), UINT16_C(42550),
+      UINT16_C(45306), UINT16_C(34102), UINT16_C( 7998), UINT16_C(35652), UINT16_C(27738), UINT16_C(11688), UINT16_C(34810), UINT16_C(55951),
+      UINT16_C(36992), UINT16_C(42508), UINT16_C(61496), UINT16_C( 6951), UINT16_C(47228), UINT16_C(16169), UINT16_C( 6938), UINT16_C( 5382),
+      UINT16_C(15563), UINT16_C(22369), UINT16_C(57065), UINT16_C(33575), UINT16_C(51709), UINT16_C( 3504), UINT16_C(20924), UINT16_C(39399),
+      UINT16_C( 8708), UINT16_C(18683), UINT16_C(26596), UINT16_C(47939), UINT16_C(61472), UINT16_C(15040) };
+
+  static uint16_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1h_u64(pv, &(r[i]), simde_svld1_u64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu16(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint64_t a[1024 / sizeof(uint64_t)];
+  uint16_t b[1024 / sizeof(uint64_t)];
+  uint16_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1h_u64(pv, &(e[i]), simde_svld1_u64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu16(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1w_s64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 2471480859748505181), -INT64_C( 2439254532686047265), -INT64_C( 3851426495415707393),  INT64_C( 5659257450564819141),
+       INT64_C( 8448936065782451490), -INT64_C( 4464832208148579267),  INT64_C(  188981025627980243), -INT64_C( 2272525890651683459),
+       INT64_C( 5581791793424525674), -INT64_C( 7438678001359254977),  INT64_C( 9151890591211953346), -INT64_C( 7012072507139697134),
+      -INT64_C( 5412176157898444154), -INT64_C( 6882209557796987872),  INT64_C(  691201349490108950), -INT64_C( 2212242290094031239),
+       INT64_C( 2496221256869276539), -INT64_C( 1497581202980775240), -INT64_C(  833277555552037009),  INT64_C( 5554325723224819928),
+      -INT64_C( 6774290249750311719), -INT64_C(  505407523193945028),  INT64_C( 8193400781846609734),  INT64_C( 2032733408633050647),
+      -INT64_C( 7940141545838644411), -INT64_C( 5009798887261468937), -INT64_C( 4780800088505329507),  INT64_C( 5324902948044950405),
+      -INT64_C( 4092287923998237618),  INT64_C( 1403646949638854475), -INT64_C( 6125474780171012711), -INT64_C( 3635996449861033155),
+      -INT64_C( 8012847921136402379),  INT64_C( 7928247214291293309),  INT64_C( 9191190718309093567), -INT64_C( 8171418299339374514),
+       INT64_C( 3179646544573041226), -INT64_C(  452569730773979020),  INT64_C( 6861069181670745718), -INT64_C( 8335383074054604949),
+      -INT64_C( 5139948284842023473),  INT64_C( 7485469599497112237), -INT64_C( 7813649523353338336),  INT64_C( 5700617597986782030),
+       INT64_C( 2417159167691077774),  INT64_C( 7465818398833347907),  INT64_C( 6945720582291372712), -INT64_C(  886069597060416540),
+       INT64_C( 4529023616364741188),  INT64_C( 8470723123911779295),  INT64_C( 3691167530019530696),  INT64_C( 8772251443103541605),
+      -INT64_C( 5402335111369554738),  INT64_C( 5706460433588452079), -INT64_C( 8857065198798145902), -INT64_C( 4090661569706349172),
+       INT64_C( 7502037626959981968), -INT64_C(  727237453560874991),  INT64_C(   31785184308695499),  INT64_C( 6654627879982317465),
+      -INT64_C( 7905260451242186391), -INT64_C( 8128975598171492649), -INT64_C( 8315355805478418651), -INT64_C( 4552163580813878614),
+       INT64_C( 5509007859756799584), -INT64_C( 2977239232767615396), -INT64_C( 4738059397967697473),  INT64_C( 3925459739251924579),
+       INT64_C( 7448824088863645086),  INT64_C( 6823012396131870504), -INT64_C( 8417138469401190562),  INT64_C(  845198357176870319),
+      -INT64_C( 8984823798379392547),  INT64_C( 7521588664336242021),  INT64_C( 8421462770366182444), -INT64_C( 4473846959241157520) };
+  static const int64_t a[] =
+    { -INT64_C( 4122513976028069449),  INT64_C( 5073891948351457016), -INT64_C( 6467209258066541732), -INT64_C( 7554686256564689188),
+       INT64_C( 5117740983501810653), -INT64_C( 6123808837549803036), -INT64_C( 8180869318977268129), -INT64_C( 6929634915930249636),
+      -INT64_C( 6052870026734737047), -INT64_C( 5974750246588616421), -INT64_C( 6952725202493076414), -INT64_C( 4702690031261952165),
+      -INT64_C( 7562821972183836263),  INT64_C( 2513596694243931367), -INT64_C( 5727002756920155997), -INT64_C( 6195676480059645455),
+      -INT64_C( 3011194082429339101), -INT64_C( 1041195393275447158),  INT64_C( 3338395743128363854), -INT64_C( 3568407075405684034),
+       INT64_C( 2718103364527031794),  INT64_C(    7911747085124572),  INT64_C( 1092958886310507455),  INT64_C(  618217003217296922),
+      -INT64_C( 9034606066076679458),  INT64_C(  582873418029608293), -INT64_C( 3667286125027476804),  INT64_C( 3668789191490403020),
+      -INT64_C( 2715025755478371542), -INT64_C( 8950614229888467336), -INT64_C( 4088516415218266687),  INT64_C( 2822793785479124389),
+      -INT64_C( 7298847207015851930),  INT64_C( 7967471016477435464),  INT64_C( 8264991303232856561),  INT64_C( 6205845868460596474),
+      -INT64_C( 6328428974406822033), -INT64_C( 7014275415561238387), -INT64_C( 6077257295592780949),  INT64_C( 2080877074161276314),
+      -INT64_C( 8799229962257296935),  INT64_C( 5669302830360402530),  INT64_C( 1175210210084927475), -INT64_C( 8210771628060380604),
+      -INT64_C(  573739918358430837),  INT64_C( 2627485555835259204),  INT64_C( 8102282684002794731),  INT64_C( 1174435123540593417),
+       INT64_C(  267857244946961449),  INT64_C( 6754451054700248679), -INT64_C( 6468805564301408866),  INT64_C( 3805735245335272506),
+       INT64_C( 7603670473648596164), -INT64_C( 1137231117833621400),  INT64_C( 6955233643048138307),  INT64_C( 6759885008717998480),
+      -INT64_C( 3116379426151939500), -INT64_C( 4442548697021103850), -INT64_C( 7538701394490813733), -INT64_C( 4321202259058589679),
+       INT64_C( 7134786259722627267),  INT64_C( 8277092292771951004), -INT64_C( 5128521735906033611), -INT64_C( 3924769398444587692),
+       INT64_C( 1802842267845174099),  INT64_C( 2932991192833839020),  INT64_C( 5833067494530885523),  INT64_C( 1444421558865253948),
+      -INT64_C( 6136232563025116352), -INT64_C( 5574434757159351160),  INT64_C( 8941016625217013961),  INT64_C(  435383269886667061),
+      -INT64_C(   38673707458904115), -INT64_C( 3569351169531026522),  INT64_C( 8782484656257917990),  INT64_C( 4007212366661918928) };
+  static const int32_t b[] =
+    { -INT32_C(  1673866069),  INT32_C(  1267023655), -INT32_C(  1844205638), -INT32_C(  1727228929),  INT32_C(    44540740), -INT32_C(  1690054468),  INT32_C(   249281562),  INT32_C(  1708933562),
+       INT32_C(  1023546901),  INT32_C(   277382997),  INT32_C(   782408495),  INT32_C(  1942466094),  INT32_C(   225799761),  INT32_C(  1504295231),  INT32_C(   795313269), -INT32_C(   627751995),
+      -INT32_C(  1357408423),  INT32_C(  1304403742),  INT32_C(  1769693498),  INT32_C(  1641825039), -INT32_C(   261205583),  INT32_C(  2135561994),  INT32_C(  1622127003),  INT32_C(  1312507125),
+      -INT32_C(   100838693),  INT32_C(   742898930),  INT32_C(   764789277), -INT32_C(  1215401723), -INT32_C(   844628797), -INT32_C(  1353846508), -INT32_C(  1743717213),  INT32_C(   468077376),
+      -INT32_C(  1894456163), -INT32_C(  1094952032),  INT32_C(   602624286), -INT32_C(  2032502333), -INT32_C(  1991015819),  INT32_C(   372875379), -INT32_C(   592557668),  INT32_C(   838309268),
+       INT32_C(   432082041), -INT32_C(  2049475225), -INT32_C(  1851145522), -INT32_C(  1323859141),  INT32_C(  2033871621), -INT32_C(  1466993909),  INT32_C(  1350844092),  INT32_C(  1283620051),
+      -INT32_C(   278576248), -INT32_C(  1904919104),  INT32_C(   991960831), -INT32_C(  1477691487), -INT32_C(  1373624670),  INT32_C(  1448521626), -INT32_C(  1062741267), -INT32_C(   569628330),
+       INT32_C(   751727212), -INT32_C(  1363524689),  INT32_C(    48880225), -INT32_C(  1263938286), -INT32_C(  1771910660),  INT32_C(  1726789753), -INT32_C(   383282285),  INT32_C(   684209084),
+       INT32_C(  1414829733),  INT32_C(   973279193), -INT32_C(    79893271), -INT32_C(  1095702846),  INT32_C(   676598447),  INT32_C(  1586446539), -INT32_C(  1874348332), -INT32_C(  1883697175),
+       INT32_C(  2128809381),  INT32_C(   112780828), -INT32_C(  1795033645), -INT32_C(  1974226469) };
+  static const int32_t e[] =
+    {  INT32_C(  2101576119),  INT32_C(   708052728), -INT32_C(   858553508), -INT32_C(  1727228929),  INT32_C(    44540740), -INT32_C(  1116587548),  INT32_C(   249281562),  INT32_C(  1020618332),
+       INT32_C(  1023546901),  INT32_C(  1785229595),  INT32_C(   782408495),  INT32_C(   500979547),  INT32_C(  1618385305),  INT32_C(   889287911),  INT32_C(   795313269),  INT32_C(  1187865073),
+      -INT32_C(  1357408423),  INT32_C(  1779120266), -INT32_C(  1529371826),  INT32_C(  1641825039), -INT32_C(   512915982),  INT32_C(   714064860),  INT32_C(  1622127003),  INT32_C(  1312507125),
+       INT32_C(  2045313758),  INT32_C(   380382565),  INT32_C(   201636540), -INT32_C(  1215401723), -INT32_C(   793980118), -INT32_C(  1353846508),  INT32_C(  1955581377), -INT32_C(   106310235),
+      -INT32_C(   604514202), -INT32_C(  1094952032),  INT32_C(   602624286), -INT32_C(   127181574), -INT32_C(  1991015819),  INT32_C(   985106573), -INT32_C(   592557668), -INT32_C(  1969023590),
+       INT32_C(   984486361), -INT32_C(  2049475225), -INT32_C(  1534707725), -INT32_C(  1323859141),  INT32_C(  2033871621), -INT32_C(  1466993909),  INT32_C(  1350844092), -INT32_C(  1100936439),
+      -INT32_C(   278576248), -INT32_C(  1904919104),  INT32_C(   991960831), -INT32_C(  1477691487), -INT32_C(  2097978172),  INT32_C(  1448521626), -INT32_C(   541395389), -INT32_C(  1692407408),
+       INT32_C(   751727212),  INT32_C(  1756283158),  INT32_C(    48880225), -INT32_C(  1263938286),  INT32_C(   790292675),  INT32_C(   466334108),  INT32_C(  1014202421), -INT32_C(  1000143532),
+       INT32_C(  1414829733),  INT32_C(  1110822828),  INT32_C(   979642259), -INT32_C(  1095702846),  INT32_C(   676598447),  INT32_C(  1586446539), -INT32_C(   991164215), -INT32_C(  1883697175),
+      -INT32_C(   859586611),  INT32_C(   112780828), -INT32_C(  1795033645), -INT32_C(  1771069232) };
+
+  static int32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1w_s64(pv, &(r[i]), simde_svld1_s64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vi32(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(int64_t)];
+  int64_t a[1024 / sizeof(int64_t)];
+  int32_t b[1024 / sizeof(int64_t)];
+  int32_t e[1024 / sizeof(int64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1w_s64(pv, &(e[i]), simde_svld1_s64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vi32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+static int
+test_simde_svst1w_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const int64_t p[] =
+    { -INT64_C( 2300440108375862368), -INT64_C( 8350840991168875167),  INT64_C( 3395841497334483040),  INT64_C( 3751002148229609982),
+      -INT64_C( 3307848360054669233), -INT64_C( 1240768574259415842),  INT64_C( 6915453569663561455),  INT64_C( 8602703388806998937),
+       INT64_C( 9184466507830097713),  INT64_C( 1799047485607985531), -INT64_C( 5751140602345392274),  INT64_C( 3846707421609071300),
+       INT64_C( 6113440615072534967),  INT64_C( 9209391822581698702),  INT64_C( 5446398446490595277),  INT64_C( 7695131909880771472),
+       INT64_C( 9068167103714075307),  INT64_C( 6465483016355657258),  INT64_C( 1766768432042019249), -INT64_C(   44061464022172859),
+      -INT64_C( 1620067990411991784),  INT64_C( 7743902975237863570), -INT64_C( 3636894711431318040), -INT64_C( 4380268876026006302),
+      -INT64_C( 6271738474927572402), -INT64_C( 2293388872114562553), -INT64_C( 2789742511230234637), -INT64_C( 8901004888212763381),
+      -INT64_C( 7368021403824471295), -INT64_C( 5153658640332585311), -INT64_C( 5969948323317822890),  INT64_C( 9170415703191402377),
+      -INT64_C(  267025900571798497), -INT64_C( 9054188891487754532), -INT64_C( 7986863422844203559), -INT64_C( 8779042450140263635),
+      -INT64_C( 1027238436006215577),  INT64_C( 4456853217658164266), -INT64_C( 3813457488066860935),  INT64_C( 6798360623764104043),
+       INT64_C( 4568865630259876192),  INT64_C( 6905266065330534963), -INT64_C( 2917783435325961193), -INT64_C(  528045302642772137),
+      -INT64_C( 2240867723243500142),  INT64_C(   78052040004566224),  INT64_C( 4619066942336529879),  INT64_C( 6323118497959166767),
+      -INT64_C( 3128342557742911992),  INT64_C( 3480613288617315681),  INT64_C( 7835856792141890709), -INT64_C( 8183335715661984687),
+      -INT64_C( 5405487980875649758), -INT64_C( 5012984512867432986), -INT64_C( 4468988716928933294),  INT64_C( 4852424234432474690),
+       INT64_C( 6465310284753574579),  INT64_C( 6469708967090633194),  INT64_C( 4114850761532703208), -INT64_C( 1480178804646022640),
+       INT64_C( 3368879732051468275),  INT64_C( 5170984903537219683), -INT64_C( 7117171146341962999), -INT64_C( 8588571653304337236),
+      -INT64_C( 3632803557659394270), -INT64_C( 2040135190722391288), -INT64_C( 5345739732814639194),  INT64_C(  321841222271999578),
+       INT64_C( 2260244164210550567) };
+  static const uint64_t a[] =
+    { UINT64_C(12457902669077832824), UINT64_C( 2374645041602575630), UINT64_C( 5202542707867570212), UINT64_C(13812115954224937037),
+      UINT64_C(16071278684111336675), UINT64_C(17949465570291967716), UINT64_C(14586732016248051487), UINT64_C(16553350978613707699),
+      UINT64_C(  537416147734199493), UINT64_C( 4575121894604329135), UINT64_C(17705572368952706672), UINT64_C( 8016030935884519767),
+      UINT64_C( 8669564287620316966), UINT64_C(15684202869991231562), UINT64_C( 4213536238696992321), UINT64_C( 4102447287472712149),
+      UINT64_C(13372261989414466641), UINT64_C( 5504467519511171105), UINT64_C( 8860631768077707738), UINT64_C(12609488917334952626),
+      UINT64_C( 8143452951626153691), UINT64_C(14718713504307357419), UINT64_C( 1055953771030975368), UINT64_C( 7139840969030148107),
+      UINT64_C( 2670546865575812686), UINT64_C(17552038939758103510), UINT64_C(12311654595014237809), UINT64_C(14651378909611929193),
+      UINT64_C( 9899890212348690949), UINT64_C( 5756698589586882436), UINT64_C( 3841281090003928069), UINT64_C(10083413906751381414),
+      UINT64_C( 6248794859449768061), UINT64_C(17715235622815599276), UINT64_C(10605669181784978732), UINT64_C( 5573669429582452039),
+      UINT64_C(18241325961922225150), UINT64_C(13845578818989288255), UINT64_C(17138141232803462741), UINT64_C( 3628233559794945341),
+      UINT64_C( 5369460685707335222), UINT64_C(13900535532451662739), UINT64_C(14335197895916233053), UINT64_C(17711863206199405415),
+      UINT64_C( 9969281786254774020), UINT64_C(15003349029334733835), UINT64_C( 8902424681925327419), UINT64_C(10386395356854640495),
+      UINT64_C(12264703248889323442), UINT64_C(13479650268545083086), UINT64_C( 1810460977246823824), UINT64_C(14738146444620281451),
+      UINT64_C(17317090583024904201), UINT64_C( 6470338720975385232), UINT64_C(14117410823768788008), UINT64_C(12050298471894889300),
+      UINT64_C(16968616010104942954), UINT64_C( 1745082118448065812), UINT64_C(12046519132538680594), UINT64_C(10758344328474978312),
+      UINT64_C( 6001220494158830594), UINT64_C( 2041088345474351947), UINT64_C( 1988255758223293852), UINT64_C(   25630710299733404),
+      UINT64_C( 7366944629769207211), UINT64_C( 8146437595918921192), UINT64_C(16456706403178943539), UINT64_C(15898276444823495588),
+      UINT64_C(10089191971278487427) };
+  static const uint32_t b[] =
+    { UINT32_C(3788777524), UINT32_C(3883155026), UINT32_C(2548750869), UINT32_C(3325349240), UINT32_C(2711205067), UINT32_C(2283666116), UINT32_C(4057316794), UINT32_C( 348049632),
+      UINT32_C(1257608184), UINT32_C(3861998033), UINT32_C(3162381124), UINT32_C(3011687144), UINT32_C( 726932327), UINT32_C(3501420822), UINT32_C( 247564334), UINT32_C(1344438360),
+      UINT32_C(3835303699), UINT32_C(3318401921), UINT32_C(3481356518), UINT32_C(1652687867), UINT32_C( 898488095), UINT32_C(1996833096), UINT32_C( 579192777), UINT32_C(1517463623),
+      UINT32_C(1077808575), UINT32_C(3204778200), UINT32_C(1284408913), UINT32_C(2846757002), UINT32_C( 819870695), UINT32_C(1185407868), UINT32_C(4050136234), UINT32_C(2487999188),
+      UINT32_C(3235154407), UINT32_C(3816807058), UINT32_C(3928952160), UINT32_C(  93576477), UINT32_C(2503307544), UINT32_C(4292598869), UINT32_C(3723576072), UINT32_C(  91307037),
+      UINT32_C(1489323462), UINT32_C(2151367711), UINT32_C(1852467793), UINT32_C(1601437255), UINT32_C(3304368239), UINT32_C(2378485636), UINT32_C( 812299538), UINT32_C(3073760241),
+      UINT32_C(1074788896), UINT32_C(2411743806), UINT32_C(4227672756), UINT32_C(2556129576), UINT32_C(2656849689), UINT32_C( 824909855), UINT32_C(3345061333), UINT32_C(2424215152),
+      UINT32_C(3469774480), UINT32_C(2371719384), UINT32_C(3817364411), UINT32_C(3850101708), UINT32_C(1384372275), UINT32_C(3464736504), UINT32_C(3012945219), UINT32_C( 205788027),
+      UINT32_C(2061112481), UINT32_C(1611085989), UINT32_C(1598263187), UINT32_C(2789523315), UINT32_C(2415446167) };
+  static const uint32_t e[] =
+    { UINT32_C(  80110712), UINT32_C(2086485262), UINT32_C(2548750869), UINT32_C(3325349240), UINT32_C(1556313315), UINT32_C(4183516900), UINT32_C(4057316794), UINT32_C( 348049632),
+      UINT32_C(1257608184), UINT32_C(3861998033), UINT32_C(3966092912), UINT32_C(3011687144), UINT32_C( 726932327), UINT32_C(3501420822), UINT32_C( 247564334), UINT32_C(1344438360),
+      UINT32_C(3835303699), UINT32_C(3318401921), UINT32_C(3481356518), UINT32_C(3304688306), UINT32_C(1254653659), UINT32_C(1996833096), UINT32_C( 763958152), UINT32_C(1741856779),
+      UINT32_C(2662194766), UINT32_C(3357215702), UINT32_C(3441499761), UINT32_C(4044467817), UINT32_C(1047069189), UINT32_C(4015095684), UINT32_C(2753299461), UINT32_C(2487999188),
+      UINT32_C( 801790077), UINT32_C(2319780524), UINT32_C(4187616556), UINT32_C(3451344199), UINT32_C(3497796606), UINT32_C(4292598869), UINT32_C(1136246357), UINT32_C(  91307037),
+      UINT32_C(1489323462), UINT32_C(2151367711), UINT32_C(  50569565), UINT32_C(2614340455), UINT32_C( 259837700), UINT32_C(2378485636), UINT32_C( 812299538), UINT32_C(3073760241),
+      UINT32_C(2845876146), UINT32_C(2411743806), UINT32_C(4227672756), UINT32_C(4148639339), UINT32_C(2826315785), UINT32_C( 271676048), UINT32_C(3539881000), UINT32_C(2424215152),
+      UINT32_C(3469774480), UINT32_C(2371719384), UINT32_C(3817364411), UINT32_C(2786519048), UINT32_C(1384372275), UINT32_C(3464736504), UINT32_C(4018552220), UINT32_C(3334581660),
+      UINT32_C(3915218347), UINT32_C(4053954024), UINT32_C(1180734515), UINT32_C(2789523315), UINT32_C(2415446167) };
+
+  static uint32_t r[sizeof(e) / sizeof(e[0])];
+  static const int32_t len = HEDLEY_STATIC_CAST(int32_t, sizeof(e) / sizeof(e[0]));
+
+  simde_memcpy(r, b, sizeof(r));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1w_u64(pv, &(r[i]), simde_svld1_u64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_assert_equal_vu32(len, e, r);
+
+  return 0;
+#else
+  int64_t p[1024 / sizeof(uint64_t)];
+  uint64_t a[1024 / sizeof(uint64_t)];
+  uint32_t b[1024 / sizeof(uint64_t)];
+  uint32_t e[1024 / sizeof(uint64_t)];
+  int32_t len = simde_test_arm_sve_random_length(sizeof(a), sizeof(a[0]));
+
+  fputc('\n', stdout);
+
+  simde_test_codegen_random_memory(sizeof(p), HEDLEY_REINTERPRET_CAST(uint8_t*, p));
+  simde_test_codegen_random_memory(sizeof(a), HEDLEY_REINTERPRET_CAST(uint8_t*, a));
+  simde_test_codegen_random_memory(sizeof(b), HEDLEY_REINTERPRET_CAST(uint8_t*, b));
+  simde_memcpy(e, b, sizeof(e));
+
+  int32_t i = 0;
+  simde_svbool_t pg = simde_svwhilelt_b64_s32(i, len);
+  while (simde_svptest_first(simde_svptrue_b64(), pg)) {
+    simde_svbool_t pv;
+
+    pv = simde_svcmplt_s64(pg, simde_svld1_s64(pg, &(p[i])), simde_svdup_n_s64(INT64_C(0)));
+
+    simde_svst1w_u64(pv, &(e[i]), simde_svld1_u64(pg, &(a[i])));
+
+    i += simde_svcntd();
+    pg = simde_svwhilelt_b64_s32(i, len);
+  }
+
+  simde_test_codegen_write_1vi64(1, HEDLEY_STATIC_CAST(size_t, len), p);
+  simde_test_codegen_write_1vu64(1, HEDLEY_STATIC_CAST(size_t, len), a);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), b);
+  simde_test_codegen_write_1vu32(1, HEDLEY_STATIC_CAST(size_t, len), e);
+
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1b_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1b_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1b_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1b_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1b_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1b_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1h_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1h_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1h_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1h_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1w_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svst1w_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
@@ -0,0 +1,581 @@
+#define SIMDE_TEST_ARM_SVE_INSN whilelt
+
+#include "test-sve.h"
+#include "../../../simde/arm/sve/whilelt.h"
+
+#include "../../../simde/arm/sve/cntp.h"
+#include "../../../simde/arm/sve/dup.h"
+#include "../../../simde/arm/sve/sel.h"
+
+static int
+test_simde_svwhilelt_b8_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t op1;
+    int32_t op2;
+  } test_vec[] = {
+    { INT32_C(0), INT32_C(0) },
+    { INT32_C(5), INT32_C(3) },
+    { INT32_C(0), INT32_C(1) },
+    { INT32_C(0), INT32_C(7) },
+    { INT32_C(3), INT32_C(20) },
+    { -INT32_C(5), INT32_C(5) },
+    { INT32_C(0), INT32_C(64) },
+    { INT32_C(1), INT32_C(1000) },
+    { INT32_MIN, INT32_MAX },
+    { INT32_MAX - INT32_C(2), INT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntb()) ? remaining : simde_svcntb();
+    int8_t a[2048 / 8];
+
+    simde_svbool_t r = simde_svwhilelt_b8_s32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b8(simde_svptrue_b8(), r));
+
+    simde_svst1_s8(simde_svptrue_b8(), a, simde_svsel_s8(r, simde_svdup_n_s8(-INT8_C(1)), simde_svdup_n_s8(INT8_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; j++) {
+      simde_assert_equal_i8(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT8_C(1) : INT8_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b16_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t op1;
+    int32_t op2;
+  } test_vec[] = {
+    { INT32_C(0), INT32_C(0) },
+    { INT32_C(5), INT32_C(3) },
+    { INT32_C(0), INT32_C(1) },
+    { INT32_C(0), INT32_C(7) },
+    { INT32_C(3), INT32_C(20) },
+    { -INT32_C(5), INT32_C(5) },
+    { INT32_C(0), INT32_C(64) },
+    { INT32_C(1), INT32_C(1000) },
+    { INT32_MIN, INT32_MAX },
+    { INT32_MAX - INT32_C(2), INT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcnth()) ? remaining : simde_svcnth();
+    int16_t a[2048 / 16];
+
+    simde_svbool_t r = simde_svwhilelt_b16_s32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b16(simde_svptrue_b16(), r));
+
+    simde_svst1_s16(simde_svptrue_b16(), a, simde_svsel_s16(r, simde_svdup_n_s16(-INT16_C(1)), simde_svdup_n_s16(INT16_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; j++) {
+      simde_assert_equal_i16(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT16_C(1) : INT16_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b32_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t op1;
+    int32_t op2;
+  } test_vec[] = {
+    { INT32_C(0), INT32_C(0) },
+    { INT32_C(5), INT32_C(3) },
+    { INT32_C(0), INT32_C(1) },
+    { INT32_C(0), INT32_C(7) },
+    { INT32_C(3), INT32_C(20) },
+    { -INT32_C(5), INT32_C(5) },
+    { INT32_C(0), INT32_C(64) },
+    { INT32_C(1), INT32_C(1000) },
+    { INT32_MIN, INT32_MAX },
+    { INT32_MAX - INT32_C(2), INT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntw()) ? remaining : simde_svcntw();
+    int32_t a[2048 / 32];
+
+    simde_svbool_t r = simde_svwhilelt_b32_s32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b32(simde_svptrue_b32(), r));
+
+    simde_svst1_s32(simde_svptrue_b32(), a, simde_svsel_s32(r, simde_svdup_n_s32(-INT32_C(1)), simde_svdup_n_s32(INT32_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; j++) {
+      simde_assert_equal_i32(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT32_C(1) : INT32_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b64_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t op1;
+    int32_t op2;
+  } test_vec[] = {
+    { INT32_C(0), INT32_C(0) },
+    { INT32_C(5), INT32_C(3) },
+    { INT32_C(0), INT32_C(1) },
+    { INT32_C(0), INT32_C(7) },
+    { INT32_C(3), INT32_C(20) },
+    { -INT32_C(5), INT32_C(5) },
+    { INT32_C(0), INT32_C(64) },
+    { INT32_C(1), INT32_C(1000) },
+    { INT32_MIN, INT32_MAX },
+    { INT32_MAX - INT32_C(2), INT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntd()) ? remaining : simde_svcntd();
+    int64_t a[2048 / 64];
+
+    simde_svbool_t r = simde_svwhilelt_b64_s32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b64(simde_svptrue_b64(), r));
+
+    simde_svst1_s64(simde_svptrue_b64(), a, simde_svsel_s64(r, simde_svdup_n_s64(-INT64_C(1)), simde_svdup_n_s64(INT64_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; j++) {
+      simde_assert_equal_i64(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT64_C(1) : INT64_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b8_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t op1;
+    int64_t op2;
+  } test_vec[] = {
+    { INT64_C(0), INT64_C(0) },
+    { INT64_C(5), INT64_C(3) },
+    { INT64_C(0), INT64_C(1) },
+    { INT64_C(0), INT64_C(7) },
+    { INT64_C(3), INT64_C(20) },
+    { -INT64_C(5), INT64_C(5) },
+    { INT64_C(0), INT64_C(64) },
+    { INT64_C(1), INT64_C(1000) },
+    { INT64_MIN, INT64_MAX },
+    { INT64_MAX - INT64_C(2), INT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntb()) ? remaining : simde_svcntb();
+    int8_t a[2048 / 8];
+
+    simde_svbool_t r = simde_svwhilelt_b8_s64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b8(simde_svptrue_b8(), r));
+
+    simde_svst1_s8(simde_svptrue_b8(), a, simde_svsel_s8(r, simde_svdup_n_s8(-INT8_C(1)), simde_svdup_n_s8(INT8_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; j++) {
+      simde_assert_equal_i8(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT8_C(1) : INT8_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b16_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t op1;
+    int64_t op2;
+  } test_vec[] = {
+    { INT64_C(0), INT64_C(0) },
+    { INT64_C(5), INT64_C(3) },
+    { INT64_C(0), INT64_C(1) },
+    { INT64_C(0), INT64_C(7) },
+    { INT64_C(3), INT64_C(20) },
+    { -INT64_C(5), INT64_C(5) },
+    { INT64_C(0), INT64_C(64) },
+    { INT64_C(1), INT64_C(1000) },
+    { INT64_MIN, INT64_MAX },
+    { INT64_MAX - INT64_C(2), INT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcnth()) ? remaining : simde_svcnth();
+    int16_t a[2048 / 16];
+
+    simde_svbool_t r = simde_svwhilelt_b16_s64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b16(simde_svptrue_b16(), r));
+
+    simde_svst1_s16(simde_svptrue_b16(), a, simde_svsel_s16(r, simde_svdup_n_s16(-INT16_C(1)), simde_svdup_n_s16(INT16_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; j++) {
+      simde_assert_equal_i16(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT16_C(1) : INT16_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b32_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t op1;
+    int64_t op2;
+  } test_vec[] = {
+    { INT64_C(0), INT64_C(0) },
+    { INT64_C(5), INT64_C(3) },
+    { INT64_C(0), INT64_C(1) },
+    { INT64_C(0), INT64_C(7) },
+    { INT64_C(3), INT64_C(20) },
+    { -INT64_C(5), INT64_C(5) },
+    { INT64_C(0), INT64_C(64) },
+    { INT64_C(1), INT64_C(1000) },
+    { INT64_MIN, INT64_MAX },
+    { INT64_MAX - INT64_C(2), INT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntw()) ? remaining : simde_svcntw();
+    int32_t a[2048 / 32];
+
+    simde_svbool_t r = simde_svwhilelt_b32_s64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b32(simde_svptrue_b32(), r));
+
+    simde_svst1_s32(simde_svptrue_b32(), a, simde_svsel_s32(r, simde_svdup_n_s32(-INT32_C(1)), simde_svdup_n_s32(INT32_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; j++) {
+      simde_assert_equal_i32(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT32_C(1) : INT32_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b64_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t op1;
+    int64_t op2;
+  } test_vec[] = {
+    { INT64_C(0), INT64_C(0) },
+    { INT64_C(5), INT64_C(3) },
+    { INT64_C(0), INT64_C(1) },
+    { INT64_C(0), INT64_C(7) },
+    { INT64_C(3), INT64_C(20) },
+    { -INT64_C(5), INT64_C(5) },
+    { INT64_C(0), INT64_C(64) },
+    { INT64_C(1), INT64_C(1000) },
+    { INT64_MIN, INT64_MAX },
+    { INT64_MAX - INT64_C(2), INT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntd()) ? remaining : simde_svcntd();
+    int64_t a[2048 / 64];
+
+    simde_svbool_t r = simde_svwhilelt_b64_s64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b64(simde_svptrue_b64(), r));
+
+    simde_svst1_s64(simde_svptrue_b64(), a, simde_svsel_s64(r, simde_svdup_n_s64(-INT64_C(1)), simde_svdup_n_s64(INT64_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; j++) {
+      simde_assert_equal_i64(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT64_C(1) : INT64_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b8_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t op1;
+    uint32_t op2;
+  } test_vec[] = {
+    { UINT32_C(0), UINT32_C(0) },
+    { UINT32_C(5), UINT32_C(3) },
+    { UINT32_C(0), UINT32_C(1) },
+    { UINT32_C(0), UINT32_C(7) },
+    { UINT32_C(3), UINT32_C(20) },
+    { UINT32_C(0), UINT32_C(64) },
+    { UINT32_C(1), UINT32_C(1000) },
+    { UINT32_C(0), UINT32_MAX },
+    { UINT32_MAX - UINT32_C(2), UINT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntb()) ? remaining : simde_svcntb();
+    int8_t a[2048 / 8];
+
+    simde_svbool_t r = simde_svwhilelt_b8_u32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b8(simde_svptrue_b8(), r));
+
+    simde_svst1_s8(simde_svptrue_b8(), a, simde_svsel_s8(r, simde_svdup_n_s8(-INT8_C(1)), simde_svdup_n_s8(INT8_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; j++) {
+      simde_assert_equal_i8(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT8_C(1) : INT8_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b16_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t op1;
+    uint32_t op2;
+  } test_vec[] = {
+    { UINT32_C(0), UINT32_C(0) },
+    { UINT32_C(5), UINT32_C(3) },
+    { UINT32_C(0), UINT32_C(1) },
+    { UINT32_C(0), UINT32_C(7) },
+    { UINT32_C(3), UINT32_C(20) },
+    { UINT32_C(0), UINT32_C(64) },
+    { UINT32_C(1), UINT32_C(1000) },
+    { UINT32_C(0), UINT32_MAX },
+    { UINT32_MAX - UINT32_C(2), UINT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcnth()) ? remaining : simde_svcnth();
+    int16_t a[2048 / 16];
+
+    simde_svbool_t r = simde_svwhilelt_b16_u32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b16(simde_svptrue_b16(), r));
+
+    simde_svst1_s16(simde_svptrue_b16(), a, simde_svsel_s16(r, simde_svdup_n_s16(-INT16_C(1)), simde_svdup_n_s16(INT16_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; j++) {
+      simde_assert_equal_i16(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT16_C(1) : INT16_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b32_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t op1;
+    uint32_t op2;
+  } test_vec[] = {
+    { UINT32_C(0), UINT32_C(0) },
+    { UINT32_C(5), UINT32_C(3) },
+    { UINT32_C(0), UINT32_C(1) },
+    { UINT32_C(0), UINT32_C(7) },
+    { UINT32_C(3), UINT32_C(20) },
+    { UINT32_C(0), UINT32_C(64) },
+    { UINT32_C(1), UINT32_C(1000) },
+    { UINT32_C(0), UINT32_MAX },
+    { UINT32_MAX - UINT32_C(2), UINT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntw()) ? remaining : simde_svcntw();
+    int32_t a[2048 / 32];
+
+    simde_svbool_t r = simde_svwhilelt_b32_u32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b32(simde_svptrue_b32(), r));
+
+    simde_svst1_s32(simde_svptrue_b32(), a, simde_svsel_s32(r, simde_svdup_n_s32(-INT32_C(1)), simde_svdup_n_s32(INT32_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; j++) {
+      simde_assert_equal_i32(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT32_C(1) : INT32_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b64_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t op1;
+    uint32_t op2;
+  } test_vec[] = {
+    { UINT32_C(0), UINT32_C(0) },
+    { UINT32_C(5), UINT32_C(3) },
+    { UINT32_C(0), UINT32_C(1) },
+    { UINT32_C(0), UINT32_C(7) },
+    { UINT32_C(3), UINT32_C(20) },
+    { UINT32_C(0), UINT32_C(64) },
+    { UINT32_C(1), UINT32_C(1000) },
+    { UINT32_C(0), UINT32_MAX },
+    { UINT32_MAX - UINT32_C(2), UINT32_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntd()) ? remaining : simde_svcntd();
+    int64_t a[2048 / 64];
+
+    simde_svbool_t r = simde_svwhilelt_b64_u32(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b64(simde_svptrue_b64(), r));
+
+    simde_svst1_s64(simde_svptrue_b64(), a, simde_svsel_s64(r, simde_svdup_n_s64(-INT64_C(1)), simde_svdup_n_s64(INT64_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; j++) {
+      simde_assert_equal_i64(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT64_C(1) : INT64_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b8_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t op1;
+    uint64_t op2;
+  } test_vec[] = {
+    { UINT64_C(0), UINT64_C(0) },
+    { UINT64_C(5), UINT64_C(3) },
+    { UINT64_C(0), UINT64_C(1) },
+    { UINT64_C(0), UINT64_C(7) },
+    { UINT64_C(3), UINT64_C(20) },
+    { UINT64_C(0), UINT64_C(64) },
+    { UINT64_C(1), UINT64_C(1000) },
+    { UINT64_C(0), UINT64_MAX },
+    { UINT64_MAX - UINT64_C(2), UINT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntb()) ? remaining : simde_svcntb();
+    int8_t a[2048 / 8];
+
+    simde_svbool_t r = simde_svwhilelt_b8_u64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b8(simde_svptrue_b8(), r));
+
+    simde_svst1_s8(simde_svptrue_b8(), a, simde_svsel_s8(r, simde_svdup_n_s8(-INT8_C(1)), simde_svdup_n_s8(INT8_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntb()) ; j++) {
+      simde_assert_equal_i8(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT8_C(1) : INT8_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b16_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t op1;
+    uint64_t op2;
+  } test_vec[] = {
+    { UINT64_C(0), UINT64_C(0) },
+    { UINT64_C(5), UINT64_C(3) },
+    { UINT64_C(0), UINT64_C(1) },
+    { UINT64_C(0), UINT64_C(7) },
+    { UINT64_C(3), UINT64_C(20) },
+    { UINT64_C(0), UINT64_C(64) },
+    { UINT64_C(1), UINT64_C(1000) },
+    { UINT64_C(0), UINT64_MAX },
+    { UINT64_MAX - UINT64_C(2), UINT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcnth()) ? remaining : simde_svcnth();
+    int16_t a[2048 / 16];
+
+    simde_svbool_t r = simde_svwhilelt_b16_u64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b16(simde_svptrue_b16(), r));
+
+    simde_svst1_s16(simde_svptrue_b16(), a, simde_svsel_s16(r, simde_svdup_n_s16(-INT16_C(1)), simde_svdup_n_s16(INT16_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcnth()) ; j++) {
+      simde_assert_equal_i16(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT16_C(1) : INT16_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b32_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t op1;
+    uint64_t op2;
+  } test_vec[] = {
+    { UINT64_C(0), UINT64_C(0) },
+    { UINT64_C(5), UINT64_C(3) },
+    { UINT64_C(0), UINT64_C(1) },
+    { UINT64_C(0), UINT64_C(7) },
+    { UINT64_C(3), UINT64_C(20) },
+    { UINT64_C(0), UINT64_C(64) },
+    { UINT64_C(1), UINT64_C(1000) },
+    { UINT64_C(0), UINT64_MAX },
+    { UINT64_MAX - UINT64_C(2), UINT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntw()) ? remaining : simde_svcntw();
+    int32_t a[2048 / 32];
+
+    simde_svbool_t r = simde_svwhilelt_b32_u64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b32(simde_svptrue_b32(), r));
+
+    simde_svst1_s32(simde_svptrue_b32(), a, simde_svsel_s32(r, simde_svdup_n_s32(-INT32_C(1)), simde_svdup_n_s32(INT32_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntw()) ; j++) {
+      simde_assert_equal_i32(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT32_C(1) : INT32_C(0));
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_svwhilelt_b64_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t op1;
+    uint64_t op2;
+  } test_vec[] = {
+    { UINT64_C(0), UINT64_C(0) },
+    { UINT64_C(5), UINT64_C(3) },
+    { UINT64_C(0), UINT64_C(1) },
+    { UINT64_C(0), UINT64_C(7) },
+    { UINT64_C(3), UINT64_C(20) },
+    { UINT64_C(0), UINT64_C(64) },
+    { UINT64_C(1), UINT64_C(1000) },
+    { UINT64_C(0), UINT64_MAX },
+    { UINT64_MAX - UINT64_C(2), UINT64_MAX },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t remaining = (test_vec[i].op1 < test_vec[i].op2) ? (HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op2) - HEDLEY_STATIC_CAST(uint64_t, test_vec[i].op1)) : UINT64_C(0);
+    uint64_t e = (remaining < simde_svcntd()) ? remaining : simde_svcntd();
+    int64_t a[2048 / 64];
+
+    simde_svbool_t r = simde_svwhilelt_b64_u64(test_vec[i].op1, test_vec[i].op2);
+    simde_assert_equal_u64(e, simde_svcntp_b64(simde_svptrue_b64(), r));
+
+    simde_svst1_s64(simde_svptrue_b64(), a, simde_svsel_s64(r, simde_svdup_n_s64(-INT64_C(1)), simde_svdup_n_s64(INT64_C(0))));
+    for (int j = 0 ; j < HEDLEY_STATIC_CAST(int, simde_svcntd()) ; j++) {
+      simde_assert_equal_i64(a[j], (HEDLEY_STATIC_CAST(uint64_t, j) < e) ? -INT64_C(1) : INT64_C(0));
+    }
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b8_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b16_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b32_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b64_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b8_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b16_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b32_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b64_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b8_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b16_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b32_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b64_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b8_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b16_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b32_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(svwhilelt_b64_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-sve-footer.h"
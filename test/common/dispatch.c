@@ -0,0 +1,155 @@
+#include "../test.h"
+#include "../../simde/simde-dispatch.h"
+#include "../../simde/x86/avx.h"
+
+static int
+test_simde_cpu_features (SIMDE_MUNIT_TEST_ARGS) {
+  const uint64_t f = simde_cpu_features();
+
+  if (!(f & SIMDE_CPU_FEATURE_DETECTED_))
+    return 1;
+  if (simde_cpu_features() != f)
+    return 1;
+
+  /* Anything the build already requires must be reported. */
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    if (!simde_cpu_has(SIMDE_CPU_FEATURE_X86_SSE2))
+      return 1;
+  #endif
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    if (!simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX | SIMDE_CPU_FEATURE_X86_AVX2))
+      return 1;
+  #endif
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    if (!simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX512F))
+      return 1;
+  #endif
+  #if defined(SIMDE_ARCH_AARCH64)
+    if (!simde_cpu_has(SIMDE_CPU_FEATURE_ARM_NEON))
+      return 1;
+  #endif
+
+  /* Each level implies the previous one. */
+  if (simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX2) && !simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX))
+    return 1;
+  if (simde_cpu_has(SIMDE_CPU_FEATURES_X86_V4) && !simde_cpu_has(SIMDE_CPU_FEATURES_X86_V3))
+    return 1;
+
+  return 0;
+}
+
+#if defined(SIMDE_DISPATCH_X86_GNU_) && (HEDLEY_GCC_VERSION_CHECK(4,8,0) || HEDLEY_HAS_BUILTIN(__builtin_cpu_supports))
+static int
+test_simde_cpu_features_x86 (SIMDE_MUNIT_TEST_ARGS) {
+  __builtin_cpu_init();
+
+  if (!!__builtin_cpu_supports("sse2") != simde_cpu_has(SIMDE_CPU_FEATURE_X86_SSE2))
+    return 1;
+  if (!!__builtin_cpu_supports("sse4.2") != simde_cpu_has(SIMDE_CPU_FEATURE_X86_SSE4_2))
+    return 1;
+  if (!!__builtin_cpu_supports("avx") != simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX))
+    return 1;
+  if (!!__builtin_cpu_supports("avx2") != simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX2))
+    return 1;
+  if (!!__builtin_cpu_supports("avx512f") != simde_cpu_has(SIMDE_CPU_FEATURE_X86_AVX512F))
+    return 1;
+
+  return 0;
+}
+#endif
+
+typedef void (*simde_test_dispatch_add_fn)(float* r, const float* a, const float* b, size_t n);
+
+static void
+simde_test_dispatch_add_generic (float* r, const float* a, const float* b, size_t n) {
+  for (size_t i = 0 ; i < n ; i += 8)
+    simde_mm256_storeu_ps(&(r[i]), simde_mm256_add_ps(simde_mm256_loadu_ps(&(a[i])), simde_mm256_loadu_ps(&(b[i]))));
+}
+
+SIMDE_TARGET_X86_V3
+static void
+simde_test_dispatch_add_v3 (float* r, const float* a, const float* b, size_t n) {
+  for (size_t i = 0 ; i < n ; i += 8)
+    simde_mm256_storeu_ps(&(r[i]), simde_mm256_add_ps(simde_mm256_loadu_ps(&(a[i])), simde_mm256_loadu_ps(&(b[i]))));
+}
+
+static int simde_test_dispatch_select_calls = 0;
+
+static simde_test_dispatch_add_fn
+simde_test_dispatch_select (uint64_t features) {
+  simde_test_dispatch_select_calls++;
+  return ((features & SIMDE_CPU_FEATURES_X86_V3) == SIMDE_CPU_FEATURES_X86_V3) ?
+    simde_test_dispatch_add_v3 :
+    simde_test_dispatch_add_generic;
+}
+
+SIMDE_DISPATCH_DEFINE(simde_test_dispatch_add_fn, simde_test_dispatch_add, simde_test_dispatch_select)
+
+static int
+test_simde_dispatch (SIMDE_MUNIT_TEST_ARGS) {
+  float a[32], b[32], r[32];
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    a[i] = HEDLEY_STATIC_CAST(float, i);
+    b[i] = HEDLEY_STATIC_CAST(float, i) * 0.5f;
+  }
+
+  simde_test_dispatch_add_fn first = SIMDE_DISPATCH(simde_test_dispatch_add);
+  first(r, a, b, 32);
+  if (SIMDE_DISPATCH(simde_test_dispatch_add) != first)
+    return 1;
+  if (simde_test_dispatch_select_calls != 1)
+    return 1;
+
+  for (size_t i = 0 ; i < 32 ; i++) {
+    if (r[i] != HEDLEY_STATIC_CAST(float, i) * 1.5f)
+      return 1;
+  }
+
+  return 0;
+}
+
+SIMDE_TARGET_CLONES("avx2", "default")
+static int32_t
+simde_test_dispatch_sum (const int32_t* a, size_t n) {
+  int32_t r = 0;
+  for (size_t i = 0 ; i < n ; i++)
+    r += a[i];
+  return r;
+}
+
+static int
+test_simde_dispatch_target_clones (SIMDE_MUNIT_TEST_ARGS) {
+  int32_t a[100];
+
+  for (size_t i = 0 ; i < 100 ; i++)
+    a[i] = HEDLEY_STATIC_CAST(int32_t, i);
+
+  return simde_test_dispatch_sum(a, 100) != 4950;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(cpu_features)
+  #if defined(SIMDE_DISPATCH_X86_GNU_) && (HEDLEY_GCC_VERSION_CHECK(4,8,0) || HEDLEY_HAS_BUILTIN(__builtin_cpu_supports))
+    SIMDE_TEST_FUNC_LIST_ENTRY(cpu_features_x86)
+  #endif
+  SIMDE_TEST_FUNC_LIST_ENTRY(dispatch)
+  SIMDE_TEST_FUNC_LIST_ENTRY(dispatch_target_clones)
+SIMDE_TEST_FUNC_LIST_END
+
+int main(void) {
+  int retval = EXIT_SUCCESS;
+
+  fprintf(stdout, "1..%zu\n", (sizeof(test_suite_tests) / sizeof(test_suite_tests[0])));
+  for (size_t i = 0 ; i < (sizeof(test_suite_tests) / sizeof(test_suite_tests[0])) ; i++) {
+    int res = test_suite_tests[i].func();
+    if (res != 0) {
+      retval = EXIT_FAILURE;
+      fprintf(stdout, "not ok %zu %s\n", i + 1, test_suite_tests[i].name);
+    } else {
+      fprintf(stdout, "ok %zu %s\n", i + 1, test_suite_tests[i].name);
+    }
+  }
+
+  return retval;
+}
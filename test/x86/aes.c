@@ -24,7 +24,7 @@
 
 #define SIMDE_TESTS_CURRENT_ISAX aes
 #include <simde/x86/aes.h>
-#include <test/x86/test-sse2.h>
+#include <test/x86/avx512/test-avx512.h>
 
 static int
 test_simde_mm_aesenc_si128 (SIMDE_MUNIT_TEST_ARGS) {
@@ -344,12 +344,458 @@ test_simde_mm_aesimc_si128 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_aesenc_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 2586341971585708627),  INT64_C( 8865281517519135030),  INT64_C( 3236705911238380268), -INT64_C( 7290517160979795249) },
+      {  INT64_C( 7273575876580499574),  INT64_C( 3485510186621062260), -INT64_C( 7561511002437846151), -INT64_C( 2762262182510694166) },
+      { INT64_C( 3393375107524953346),  INT64_C( 5550803491226146163), -INT64_C(  621774853345856236),  INT64_C( 4372717500413153569) } },
+    { { -INT64_C( 2474078709182176629),  INT64_C(  645269288288561941),  INT64_C( 6177946897817735677), -INT64_C( 5106631279687102433) },
+      { -INT64_C( 8102351954660651634),  INT64_C( 3363491038161739523),  INT64_C( 1017748214402220190), -INT64_C( 4218095516130655233) },
+      { INT64_C( 2678734787932153902), -INT64_C(  516723081889990357), -INT64_C( 3760079952129283041),  INT64_C( 9095598726739942637) } },
+    { {  INT64_C( 3836218302174783160), -INT64_C(  263960093980013745),  INT64_C( 6073964772129268077),  INT64_C( 1088271138339594778) },
+      { -INT64_C( 6688167881290171019), -INT64_C( 7855634754569332199), -INT64_C( 4847109605879080209), -INT64_C( 9174358967396765218) },
+      { INT64_C( 5618688249142699125),  INT64_C( 5400303420592872327),  INT64_C(  962899756138509408),  INT64_C( 9099232093387550775) } },
+    { {  INT64_C( 1017475978290269373), -INT64_C( 2556158016214927853),  INT64_C( 3927660590810728493),  INT64_C( 7814147905420099895) },
+      {  INT64_C(  939424833970273252),  INT64_C( 7856605151738947903),  INT64_C( 6598492726239266173), -INT64_C( 3695080206338820107) },
+      { INT64_C( 4056595174931327024),  INT64_C( 3073969360888485321),  INT64_C( 8070806624927243306), -INT64_C( 4174231256530079047) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_si256(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesenc_epi128(a, b);
+    simde_test_x86_assert_equal_i64x4(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesdec_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 6987420057764193446), -INT64_C( 4095095637847343123),  INT64_C( 8847197993900687350),  INT64_C( 6460021831952574899) },
+      { -INT64_C( 5712092766790352660),  INT64_C( 3887457160061030994), -INT64_C( 8198319208080376567), -INT64_C( 4626322721297613024) },
+      {-INT64_C( 5594482526418176722), -INT64_C( 3881215521822629059), -INT64_C( 6088030402306829829), -INT64_C(  672316890048121563) } },
+    { {  INT64_C( 3250722106254691934),  INT64_C( 3654971580302731961),  INT64_C(  921142989686494395),  INT64_C( 8002672326661151757) },
+      {  INT64_C( 6280856739192765890),  INT64_C( 1704872531591826348), -INT64_C( 4883490508610752558), -INT64_C( 1793992412323330443) },
+      { INT64_C( 2383437056677095888), -INT64_C( 4532437393957899297),  INT64_C( 4086883559314855834), -INT64_C( 2417325977835197554) } },
+    { {  INT64_C( 7162778361497815737),  INT64_C( 6309176039145055071), -INT64_C(  886254848341091802), -INT64_C( 5185376490347324656) },
+      { -INT64_C( 2056593079107790356),  INT64_C( 5690958037488623577),  INT64_C( 3331061681209950482),  INT64_C( 5053459964902965286) },
+      {-INT64_C( 5718528167347959819), -INT64_C( 6597566825194316378), -INT64_C( 5493001390307347668), -INT64_C(  783005279401456657) } },
+    { { -INT64_C( 8554668860385087578), -INT64_C( 4625153682673576785),  INT64_C( 4326347003203253731), -INT64_C( 8049125651851261673) },
+      {  INT64_C( 5348836663524117369), -INT64_C( 1366278526828064058),  INT64_C( 6623710561994174408),  INT64_C( 5015574951205321541) },
+      { INT64_C(  187703407962153402), -INT64_C( 8185409867937198216), -INT64_C( 2095397334303592728),  INT64_C( 8747106233998055892) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_si256(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesdec_epi128(a, b);
+    simde_test_x86_assert_equal_i64x4(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesenclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 2813893151397434509),  INT64_C( 6069467722543144894), -INT64_C( 7410016688287509591),  INT64_C( 6269950952644565597) },
+      {  INT64_C( 8147213100591189477), -INT64_C( 5498976007133858815),  INT64_C( 7319771086515603918), -INT64_C(  753391553774850647) },
+      {-INT64_C( 8434547893301565846),  INT64_C(  405965057771703983),  INT64_C( 5255335723577242909), -INT64_C(  401357278770153755) } },
+    { { -INT64_C( 6325453841763739854),  INT64_C( 5605324949993812352),  INT64_C( 1591578775291003279),  INT64_C( 2410364264293791582) },
+      {  INT64_C( 5830679867676184092),  INT64_C( 5231492893918074467), -INT64_C( 3786179076187322036),  INT64_C( 2927869968072699184) },
+      { INT64_C( 6601746815931381823),  INT64_C( 6774523564634223278),  INT64_C( 6844242215281285439), -INT64_C( 8798082938723954328) } },
+    { {  INT64_C(  525849917905674986), -INT64_C(  505247487815400479),  INT64_C( 5739719343663253498), -INT64_C( 5703746440781211467) },
+      { -INT64_C( 4700517155367057617),  INT64_C( 3043930048197307942),  INT64_C( 7738866862646280309), -INT64_C( 1114599751489783484) },
+      {-INT64_C( 8390128300511117144), -INT64_C( 4893429243256549922), -INT64_C( 5547149874884779432),  INT64_C( 5752277766970441361) } },
+    { { -INT64_C( 5417338554238909258), -INT64_C( 7287097714966114542), -INT64_C(  514818511002811374), -INT64_C( 2182332394994247908) },
+      {  INT64_C( 9164934424659965631), -INT64_C( 4683113182372032756),  INT64_C( 4302637623941874458), -INT64_C( 7544684656281189198) },
+      { INT64_C( 4300629190778240753), -INT64_C( 2072744667279537467), -INT64_C( 7856439623596681773),  INT64_C( 2025767925855375150) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_si256(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesenclast_epi128(a, b);
+    simde_test_x86_assert_equal_i64x4(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesdeclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 8684690219456553531), -INT64_C(  714704272472552201),  INT64_C( 1188309771512366667),  INT64_C( 4821243773176094933) },
+      {  INT64_C( 8697710403323659327), -INT64_C( 6099818209453559122), -INT64_C( 6348507672571803385),  INT64_C( 8986880970975364820) },
+      {-INT64_C( 3877649537732307082),  INT64_C( 6162385381363744904), -INT64_C( 7265055824716799285), -INT64_C( 6150624331075576479) } },
+    { { -INT64_C( 7803593195490763943),  INT64_C( 2120831953287433549), -INT64_C( 7788992475718656560), -INT64_C(  283635060832976995) },
+      {  INT64_C( 1668629023092887855), -INT64_C( 7149794748422831209),  INT64_C( 4631971466614610795),  INT64_C( 3123704906767012002) },
+      { INT64_C( 2624874744760435514), -INT64_C( 6989495128580415246),  INT64_C( 1960363939550677771),  INT64_C( 2659802501104469975) } },
+    { { -INT64_C( 5594068547997957117), -INT64_C( 6189653116602165932),  INT64_C(  100219374060568665), -INT64_C( 5018738695779476531) },
+      {  INT64_C( 5201511849756209099), -INT64_C( 4891195391265598466),  INT64_C( 2378928575479532057),  INT64_C( 5174563216250295738) },
+      {-INT64_C( 3125158685199544802), -INT64_C( 1399688881969122557),  INT64_C( 6491645080223175948), -INT64_C( 2719236151844252614) } },
+    { {  INT64_C( 1112812326568736401),  INT64_C( 4464340873312655841),  INT64_C( 7548767599143453098), -INT64_C( 7706677704002825075) },
+      {  INT64_C( 2114394991218142908), -INT64_C( 7150914377184666606), -INT64_C( 6787666712488152535),  INT64_C( 4557153255466823140) },
+      {-INT64_C( 5121169258545679856),  INT64_C( 7705162834975434482), -INT64_C(  338671010633635253), -INT64_C( 3848649678658834096) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_si256(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_si256(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesdeclast_epi128(a, b);
+    simde_test_x86_assert_equal_i64x4(r, simde_mm256_loadu_si256(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesenc_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 5122736759588606401),  INT64_C( 9200657572824753770),  INT64_C( 8374056662463341623), -INT64_C( 7409346845136668265),
+         INT64_C( 7231986940006738818), -INT64_C( 7397951871952072075), -INT64_C(  879949052653543298),  INT64_C( 5995997627108108114) },
+      {  INT64_C( 7535351547781514403),  INT64_C( 3958654169375738022), -INT64_C( 8990764053140786113), -INT64_C( 3983084224493595868),
+        -INT64_C( 9184358659584708523),  INT64_C(  611753991402542993), -INT64_C( 1583397468663482818), -INT64_C( 2996454284662601316) },
+      { INT64_C( 7920315251950385150),  INT64_C( 7260273847012460648), -INT64_C( 2771103238190914643),  INT64_C( 8579250331632255773),
+        -INT64_C( 5293936685432801432), -INT64_C( 3560320831726925587), -INT64_C( 3682579016432363405),  INT64_C( 3727811821706203618) } },
+    { { -INT64_C( 8262812604487756657), -INT64_C(  802867945340280636),  INT64_C( 6401462203539764257), -INT64_C( 7430780699448886209),
+         INT64_C(  303041520188869108), -INT64_C( 5926355018772691717),  INT64_C( 8258473524578350795),  INT64_C( 5441793721914982905) },
+      {  INT64_C(   10466441014022502), -INT64_C( 6609115189418413563),  INT64_C( 8952470249625795337), -INT64_C( 5113814878942340729),
+         INT64_C( 2395433378452713063),  INT64_C( 7611325403154840754), -INT64_C(  510259137939255322),  INT64_C( 4684618580507344058) },
+      {-INT64_C( 5096671088754546657),  INT64_C( 1199608709425189999), -INT64_C( 1397704081933122388),  INT64_C( 7710951828398637530),
+        -INT64_C( 9058437602712695735),  INT64_C( 6774553821268775362),  INT64_C( 3493072024240490591),  INT64_C( 1141432378535634144) } },
+    { {  INT64_C( 3288861290932828483),  INT64_C( 2079899249879653367),  INT64_C( 4298861702658039994), -INT64_C( 4057224908672321539),
+         INT64_C( 8021423225718370915), -INT64_C( 5397731672318316903), -INT64_C( 6520892255926013304),  INT64_C( 4443866089497915184) },
+      { -INT64_C( 2932264424812944527), -INT64_C( 4977752992647291648),  INT64_C(   26081975292207995),  INT64_C( 7619244336060766418),
+         INT64_C( 7894184978641588039),  INT64_C(  295199364223780356), -INT64_C( 1032277414901887251),  INT64_C( 6182133769069623790) },
+      { INT64_C( 4590465160224277606), -INT64_C( 5625200053847431825), -INT64_C( 7111761221653428140),  INT64_C( 4189773947649718962),
+         INT64_C(  632908616848039605), -INT64_C(  636746174210242424),  INT64_C( 4349984870982491750), -INT64_C( 4693721226628773348) } },
+    { {  INT64_C( 8261087241258429597),  INT64_C( 6908278180918791474),  INT64_C( 7083636654114676055), -INT64_C( 2910746159232150152),
+         INT64_C( 6552758849678126542), -INT64_C( 4953145183864439525),  INT64_C( 1254228931478381724), -INT64_C( 5479352156848625481) },
+      { -INT64_C( 6669155364494402812),  INT64_C( 7557011817084780456), -INT64_C( 4711229690542929235),  INT64_C( 8024948789879737938),
+         INT64_C( 3434830249819350805), -INT64_C( 3241074572058345823), -INT64_C( 5321959001315454635), -INT64_C( 6306202053596992090) },
+      {-INT64_C( 3417734783965999367), -INT64_C( 4930794703820122772), -INT64_C( 7851970833420096383), -INT64_C( 6346156015356838865),
+        -INT64_C( 1891950680007116608),  INT64_C( 6963442894357228647), -INT64_C( 7159837437341936879),  INT64_C( 6968355564934487818) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_si512(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesenc_epi128(a, b);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesdec_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 2002077081072729475),  INT64_C( 9021362180847628245),  INT64_C( 2193752911870184700),  INT64_C( 5300251386009088963),
+         INT64_C( 1637653549219098237),  INT64_C( 1192903641592048753), -INT64_C( 8615364158118869635), -INT64_C( 4543630411177044794) },
+      {  INT64_C( 6476658412385719865),  INT64_C( 2121456467413474122), -INT64_C( 6863287947421224091),  INT64_C( 2041354727252151524),
+         INT64_C( 7484454320442583137), -INT64_C( 7626691164318815639), -INT64_C( 1983140548707297097),  INT64_C(  138006793641846767) },
+      {-INT64_C( 8267810147251089029), -INT64_C( 7209189425764229399),  INT64_C( 9112705605327749108), -INT64_C( 1635879521690992727),
+        -INT64_C( 7239461074938934917),  INT64_C( 3130253590845735642),  INT64_C( 5367580336067409480),  INT64_C( 7774594648043354300) } },
+    { { -INT64_C( 1905932679330150944),  INT64_C( 1268864332379618063),  INT64_C( 7599363534108668497), -INT64_C( 5545441212237716397),
+        -INT64_C( 6918467254423979085),  INT64_C( 3817255840748527841), -INT64_C( 2453999997582050570), -INT64_C( 2090385525333250446) },
+      {  INT64_C( 1091657347331904107), -INT64_C( 5944946237663603655),  INT64_C( 7819226882432643957), -INT64_C( 8591389949938592677),
+        -INT64_C(  717362921797471612), -INT64_C( 5132138000516068512),  INT64_C( 2658858640231569539), -INT64_C( 4461640107110122578) },
+      {-INT64_C( 1888945724363260127),  INT64_C( 7280152072178050850), -INT64_C( 1406438568219013487), -INT64_C( 6992624038439081274),
+        -INT64_C( 8334461940246167845),  INT64_C( 6698250833342848427),  INT64_C( 8918339177527015925),  INT64_C( 4684981759064979005) } },
+    { {  INT64_C( 7731065616014094681),  INT64_C( 2950790176853187635), -INT64_C(  827961928505006907),  INT64_C( 2071258549847661058),
+        -INT64_C( 8777755400989789145), -INT64_C( 5078633318302455034), -INT64_C( 6998527521013550340), -INT64_C( 5585715415726942970) },
+      { -INT64_C(  596239441229298565),  INT64_C( 2427501490713700171),  INT64_C( 1800725215051196236),  INT64_C( 1961148765367208118),
+         INT64_C( 6957744617404376207),  INT64_C( 4057363179913107024),  INT64_C( 8047038781672288153), -INT64_C( 6932880220191208276) },
+      { INT64_C( 8818306902458489653),  INT64_C( 5504666828715791953), -INT64_C( 4249412635974378747),  INT64_C( 6822206482491101644),
+        -INT64_C( 6005779524459242086), -INT64_C(  266293992642436644), -INT64_C( 3233269849361732872), -INT64_C( 2061861379220098342) } },
+    { { -INT64_C( 7975536488298500043),  INT64_C( 1668570629156765275), -INT64_C( 5882919249638620527),  INT64_C( 1377475904235760951),
+        -INT64_C( 9212197640851702165),  INT64_C( 2908594654138534336),  INT64_C( 7742341921735941116), -INT64_C( 4688413465499045252) },
+      {  INT64_C(  117750254460077845), -INT64_C( 1639012688865518745), -INT64_C( 4603391849796406828), -INT64_C( 8160855226251017427),
+         INT64_C( 8971406573523692503), -INT64_C( 3123532509779036205),  INT64_C( 8568031992945163211), -INT64_C( 7071833824386095208) },
+      { INT64_C( 4098068546198879080), -INT64_C( 4168020643868926274),  INT64_C( 6553727976451361070), -INT64_C( 4818442660986949450),
+        -INT64_C(  689397763329849568),  INT64_C( 2343675360693643792), -INT64_C( 8178990710957374139),  INT64_C( 6697509154038614315) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_si512(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesdec_epi128(a, b);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesenclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 1703119116668322217),  INT64_C( 3432246715981567110),  INT64_C( 8996306792846587729), -INT64_C(  861325805755738354),
+         INT64_C( 1321005206494000316), -INT64_C( 4753356403874246222), -INT64_C( 4609343818359645738),  INT64_C( 2014714091540903010) },
+      {  INT64_C( 5306157803886106347),  INT64_C( 2047103659283701551),  INT64_C( 4710529019782109439), -INT64_C( 9078079598084141536),
+         INT64_C( 3235005506398163925),  INT64_C( 3274780707889546129), -INT64_C( 6213422305219484699),  INT64_C( 6145062711451264266) },
+      { INT64_C( 2923320483839900080),  INT64_C( 7648356771581045611),  INT64_C(  465122431583910702), -INT64_C( 8416869150664756853),
+        -INT64_C(   83917244664488016),  INT64_C( 7822263754364582566), -INT64_C( 6619232829517831405),  INT64_C( 1979209504508102816) } },
+    { { -INT64_C( 7978069934948729408),  INT64_C(    9602711424301376), -INT64_C( 1671794301749539795), -INT64_C(  309057794400327246),
+         INT64_C( 2507875677552932836), -INT64_C( 2344845543533127841),  INT64_C( 4531684089155200643), -INT64_C( 5177066338741915704) },
+      {  INT64_C( 9147678315102150075),  INT64_C( 6931995533606621106), -INT64_C( 5367804493971094539), -INT64_C( 7288333423961791775),
+        -INT64_C(  826162789327320565),  INT64_C( 9170955479971133745), -INT64_C( 4231601852268436722), -INT64_C( 4732571238672477673) },
+      { INT64_C( 6224152966582558209),  INT64_C( 4711119714213112763),  INT64_C( 1859886370000341805),  INT64_C( 2851211849671761622),
+         INT64_C( 7067818078215332962),  INT64_C( 4033028823090156030), -INT64_C( 7599107578173646878),  INT64_C( 2468997129882312447) } },
+    { {  INT64_C( 8751231558578033523),  INT64_C( 5758242880388733799),  INT64_C( 4744070943756298604),  INT64_C( 4646087005003052344),
+        -INT64_C( 7628987142057865173),  INT64_C(  430836878764728455),  INT64_C( 5057050358263554791),  INT64_C(  879376620549823786) },
+      { -INT64_C( 6864780959574419179), -INT64_C( 4905745028418511215),  INT64_C( 1405044094930830142), -INT64_C( 5295535715326870318),
+        -INT64_C( 3464087190252157365), -INT64_C( 2070125754102189946), -INT64_C( 8199956091720637342),  INT64_C( 1476001784164161552) },
+      {-INT64_C( 4276790774705122662),  INT64_C( 8623170220801598740), -INT64_C( 2547525749763330450), -INT64_C( 2921523622936992043),
+        -INT64_C(  810377093470665286), -INT64_C( 7497864314329302383),  INT64_C( 1885643121890225654), -INT64_C( 4014126612231362059) } },
+    { { -INT64_C( 6379227382712665824),  INT64_C( 9190847051231782637), -INT64_C( 1791590210883548180),  INT64_C( 8236365660482902074),
+         INT64_C( 1436692551967243163),  INT64_C( 6912198386859085957),  INT64_C( 8132113902977136329), -INT64_C( 4829751861087859853) },
+      {  INT64_C( 3774575057465434066), -INT64_C( 2907710058124360096),  INT64_C( 6143810121771450619), -INT64_C(  225043788414269302),
+         INT64_C( 4747664289883985068),  INT64_C( 7891716944754939620), -INT64_C( 8630931107852006428), -INT64_C( 9110279019589791579) },
+      {-INT64_C( 4538094640228188059),  INT64_C(  295279537527359029),  INT64_C( 6098049690134625077),  INT64_C( 2914762398926604298),
+         INT64_C( 6176255462568730808), -INT64_C( 2663583180281421709),  INT64_C( 4296989236516618809),  INT64_C( 8225974177035733546) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_si512(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesenclast_epi128(a, b);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesdeclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 5918614511573415484), -INT64_C( 6375935900526172127), -INT64_C( 8977654388173996647),  INT64_C( 6855991253581517168),
+        -INT64_C( 2674440466335869203), -INT64_C( 5491892134335012384), -INT64_C( 4733581015713299172), -INT64_C(  746759262228409965) },
+      {  INT64_C( 2830585831547427671),  INT64_C( 7045463126033232945),  INT64_C( 3644639932378016034),  INT64_C( 2176889479483023314),
+        -INT64_C( 7786472637241692160),  INT64_C(  712052346078183331),  INT64_C( 9166476850667143830), -INT64_C(  854807751015605136) },
+      {-INT64_C( 8356621600243707937), -INT64_C( 6965540328409633974), -INT64_C(  552166767633109541),  INT64_C( 4882656158762469634),
+        -INT64_C( 7907847114509643693),  INT64_C( 6258539689654911491),  INT64_C( 3976598084069971538), -INT64_C( 4857783013056514222) } },
+    { {  INT64_C( 2012137770580782536), -INT64_C( 1338200035479713384), -INT64_C( 4483361379504801584),  INT64_C( 2198561971890402140),
+        -INT64_C( 7248294751762607964), -INT64_C( 4706403999679972668), -INT64_C( 6129990193701602939),  INT64_C( 7821676187730010081) },
+      {  INT64_C( 9056197090970199443),  INT64_C( 7736579102957358475), -INT64_C( 5457057678294327647),  INT64_C(  889180076552785722),
+         INT64_C( 3148940969722609797), -INT64_C( 1001569579996546511),  INT64_C( 4134371490601429942),  INT64_C( 5457987328228919582) },
+      {-INT64_C( 5900303368401335006), -INT64_C( 4981375524202988183), -INT64_C( 8334522354832290367), -INT64_C( 7753426612034241891),
+         INT64_C( 1488685349614848664),  INT64_C( 5111200393072001465), -INT64_C( 5579705628450025007), -INT64_C( 6634595561243017986) } },
+    { { -INT64_C( 2533042043835524980), -INT64_C( 5381359710966394947), -INT64_C( 5668228858010233828),  INT64_C( 8242914979358306728),
+        -INT64_C( 7261312382272618965), -INT64_C( 9209627139841895164), -INT64_C( 7936225666799144013), -INT64_C( 8796076128607053041) },
+      {  INT64_C( 8535590536914952253), -INT64_C( 4739865616213999774), -INT64_C( 4796859731327496652), -INT64_C( 3024269276622204853),
+         INT64_C( 2247876496901056919), -INT64_C( 4000954458658091346), -INT64_C( 3307989580699284076),  INT64_C( 1937590278418485881) },
+      { INT64_C( 4973293266174069965),  INT64_C( 2960485839006226095),  INT64_C( 2297616765647417072), -INT64_C( 3837480128645932508),
+        -INT64_C( 5964360953189388132), -INT64_C( 5991145448178363234), -INT64_C( 4067271081909143841),  INT64_C( 5436095004272279938) } },
+    { {  INT64_C( 7767207904390752413), -INT64_C( 8214249170850555753), -INT64_C( 6013777606792012093), -INT64_C( 3100997863285565960),
+        -INT64_C( 4843429005308816963), -INT64_C( 2762654071259596775),  INT64_C( 1919828715714404214), -INT64_C( 6600412787198372404) },
+      { -INT64_C( 8783485513733829236), -INT64_C(  100802460438048026), -INT64_C( 8849598050029755586),  INT64_C( 8283963487170402131),
+         INT64_C( 7385366319332729822), -INT64_C( 8110873367702319191), -INT64_C( 3588294373105548728), -INT64_C( 8132360976864733593) },
+      {-INT64_C( 2444570107839789319), -INT64_C(  465615378823008157), -INT64_C( 2159135111446855667),  INT64_C( 4771951974156275890),
+        -INT64_C( 2681405486084737005), -INT64_C( 1602856996418621145),  INT64_C( 6836558625896836167),  INT64_C( 2466249696673636672) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_si512(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_si512(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesdeclast_epi128(a, b);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_si512(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_aes_ctr_encrypt_blocks (SIMDE_MUNIT_TEST_ARGS) {
+  /* AES-128 key feffe9928665731c6d6a8f9467308308 (GCM test case 3),
+   * expanded; the first four blocks of r[0] are that test's ciphertext. */
+  static const uint8_t round_keys[11][16] = {
+    { UINT8_C(254), UINT8_C(255), UINT8_C(233), UINT8_C(146), UINT8_C(134), UINT8_C(101), UINT8_C(115), UINT8_C( 28),
+      UINT8_C(109), UINT8_C(106), UINT8_C(143), UINT8_C(148), UINT8_C(103), UINT8_C( 48), UINT8_C(131), UINT8_C(  8) },
+    { UINT8_C(251), UINT8_C( 19), UINT8_C(217), UINT8_C( 23), UINT8_C(125), UINT8_C(118), UINT8_C(170), UINT8_C( 11),
+      UINT8_C( 16), UINT8_C( 28), UINT8_C( 37), UINT8_C(159), UINT8_C(119), UINT8_C( 44), UINT8_C(166), UINT8_C(151) },
+    { UINT8_C(136), UINT8_C( 55), UINT8_C( 81), UINT8_C(226), UINT8_C(245), UINT8_C( 65), UINT8_C(251), UINT8_C(233),
+      UINT8_C(229), UINT8_C( 93), UINT8_C(222), UINT8_C(118), UINT8_C(146), UINT8_C(113), UINT8_C(120), UINT8_C(225) },
+    { UINT8_C( 47), UINT8_C(139), UINT8_C(169), UINT8_C(173), UINT8_C(218), UINT8_C(202), UINT8_C( 82), UINT8_C( 68),
+      UINT8_C( 63), UINT8_C(151), UINT8_C(140), UINT8_C( 50), UINT8_C(173), UINT8_C(230), UINT8_C(244), UINT8_C(211) },
+    { UINT8_C(169), UINT8_C( 52), UINT8_C(207), UINT8_C( 56), UINT8_C(115), UINT8_C(254), UINT8_C(157), UINT8_C(124),
+      UINT8_C( 76), UINT8_C(105), UINT8_C( 17), UINT8_C( 78), UINT8_C(225), UINT8_C(143), UINT8_C(229), UINT8_C(157) },
+    { UINT8_C(202), UINT8_C(237), UINT8_C(145), UINT8_C(192), UINT8_C(185), UINT8_C( 19), UINT8_C( 12), UINT8_C(188),
+      UINT8_C(245), UINT8_C(122), UINT8_C( 29), UINT8_C(242), UINT8_C( 20), UINT8_C(245), UINT8_C(248), UINT8_C(111) },
+    { UINT8_C( 12), UINT8_C(172), UINT8_C( 57), UINT8_C( 58), UINT8_C(181), UINT8_C(191), UINT8_C( 53), UINT8_C(134),
+      UINT8_C( 64), UINT8_C(197), UINT8_C( 40), UINT8_C(116), UINT8_C( 84), UINT8_C( 48), UINT8_C(208), UINT8_C( 27) },
+    { UINT8_C( 72), UINT8_C(220), UINT8_C(150), UINT8_C( 26), UINT8_C(253), UINT8_C( 99), UINT8_C(163), UINT8_C(156),
+      UINT8_C(189), UINT8_C(166), UINT8_C(139), UINT8_C(232), UINT8_C(233), UINT8_C(150), UINT8_C( 91), UINT8_C(243) },
+    { UINT8_C( 88), UINT8_C(229), UINT8_C(155), UINT8_C(  4), UINT8_C(165), UINT8_C(134), UINT8_C( 56), UINT8_C(152),
+      UINT8_C( 24), UINT8_C( 32), UINT8_C(179), UINT8_C(112), UINT8_C(241), UINT8_C(182), UINT8_C(232), UINT8_C(131) },
+    { UINT8_C( 13), UINT8_C(126), UINT8_C(119), UINT8_C(165), UINT8_C(168), UINT8_C(248), UINT8_C( 79), UINT8_C( 61),
+      UINT8_C(176), UINT8_C(216), UINT8_C(252), UINT8_C( 77), UINT8_C( 65), UINT8_C(110), UINT8_C( 20), UINT8_C(206) },
+    { UINT8_C(164), UINT8_C(132), UINT8_C(252), UINT8_C( 38), UINT8_C( 12), UINT8_C(124), UINT8_C(179), UINT8_C( 27),
+      UINT8_C(188), UINT8_C(164), UINT8_C( 79), UINT8_C( 86), UINT8_C(253), UINT8_C(202), UINT8_C( 91), UINT8_C(152) }
+  };
+  static const uint8_t plaintext[176] = {
+    UINT8_C(217), UINT8_C( 49), UINT8_C( 50), UINT8_C( 37), UINT8_C(248), UINT8_C(132), UINT8_C(  6), UINT8_C(229),
+    UINT8_C(165), UINT8_C( 89), UINT8_C(  9), UINT8_C(197), UINT8_C(175), UINT8_C(245), UINT8_C( 38), UINT8_C(154),
+    UINT8_C(134), UINT8_C(167), UINT8_C(169), UINT8_C( 83), UINT8_C( 21), UINT8_C( 52), UINT8_C(247), UINT8_C(218),
+    UINT8_C( 46), UINT8_C( 76), UINT8_C( 48), UINT8_C( 61), UINT8_C(138), UINT8_C( 49), UINT8_C(138), UINT8_C(114),
+    UINT8_C( 28), UINT8_C( 60), UINT8_C( 12), UINT8_C(149), UINT8_C(149), UINT8_C(104), UINT8_C(  9), UINT8_C( 83),
+    UINT8_C( 47), UINT8_C(207), UINT8_C( 14), UINT8_C( 36), UINT8_C( 73), UINT8_C(166), UINT8_C(181), UINT8_C( 37),
+    UINT8_C(177), UINT8_C(106), UINT8_C(237), UINT8_C(245), UINT8_C(170), UINT8_C( 13), UINT8_C(230), UINT8_C( 87),
+    UINT8_C(186), UINT8_C( 99), UINT8_C(123), UINT8_C( 57), UINT8_C( 26), UINT8_C(175), UINT8_C(210), UINT8_C( 85),
+    UINT8_C(130), UINT8_C(183), UINT8_C( 14), UINT8_C(238), UINT8_C(127), UINT8_C( 26), UINT8_C( 80), UINT8_C( 57),
+    UINT8_C(190), UINT8_C(240), UINT8_C(126), UINT8_C(194), UINT8_C( 52), UINT8_C(127), UINT8_C(  6), UINT8_C(110),
+    UINT8_C(208), UINT8_C(143), UINT8_C( 93), UINT8_C(199), UINT8_C( 81), UINT8_C( 36), UINT8_C( 71), UINT8_C(227),
+    UINT8_C( 64), UINT8_C( 67), UINT8_C(  0), UINT8_C(  2), UINT8_C(107), UINT8_C(110), UINT8_C( 84), UINT8_C( 85),
+    UINT8_C(148), UINT8_C(160), UINT8_C(101), UINT8_C(104), UINT8_C( 93), UINT8_C(100), UINT8_C(196), UINT8_C(152),
+    UINT8_C( 11), UINT8_C(184), UINT8_C(212), UINT8_C( 84), UINT8_C( 74), UINT8_C(135), UINT8_C( 33), UINT8_C(169),
+    UINT8_C(154), UINT8_C(  1), UINT8_C(173), UINT8_C( 33), UINT8_C(158), UINT8_C(181), UINT8_C(156), UINT8_C(246),
+    UINT8_C(161), UINT8_C( 94), UINT8_C(246), UINT8_C(241), UINT8_C( 90), UINT8_C( 29), UINT8_C(131), UINT8_C( 11),
+    UINT8_C(183), UINT8_C(206), UINT8_C(  9), UINT8_C(214), UINT8_C(187), UINT8_C(192), UINT8_C(  4), UINT8_C(231),
+    UINT8_C( 23), UINT8_C( 92), UINT8_C(100), UINT8_C( 60), UINT8_C(125), UINT8_C(236), UINT8_C(176), UINT8_C(181),
+    UINT8_C(128), UINT8_C(236), UINT8_C( 55), UINT8_C(188), UINT8_C(151), UINT8_C( 18), UINT8_C(221), UINT8_C( 46),
+    UINT8_C(106), UINT8_C(174), UINT8_C(185), UINT8_C( 75), UINT8_C(174), UINT8_C(141), UINT8_C( 47), UINT8_C(159),
+    UINT8_C(162), UINT8_C(156), UINT8_C( 90), UINT8_C( 40), UINT8_C( 76), UINT8_C(158), UINT8_C(247), UINT8_C( 82),
+    UINT8_C( 24), UINT8_C( 41), UINT8_C(207), UINT8_C( 16), UINT8_C(121), UINT8_C(176), UINT8_C(128), UINT8_C(233)
+  };
+  static const struct {
+    uint8_t counter[16];
+    uint8_t r[176];
+  } test_vec[] = {
+    { { UINT8_C(202), UINT8_C(254), UINT8_C(186), UINT8_C(190), UINT8_C(250), UINT8_C(206), UINT8_C(219), UINT8_C(173),
+      UINT8_C(222), UINT8_C(202), UINT8_C(248), UINT8_C(136), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  2) },
+      {
+        UINT8_C( 66), UINT8_C(131), UINT8_C( 30), UINT8_C(194), UINT8_C( 33), UINT8_C(119), UINT8_C(116), UINT8_C( 36),
+        UINT8_C( 75), UINT8_C(114), UINT8_C( 33), UINT8_C(183), UINT8_C(132), UINT8_C(208), UINT8_C(212), UINT8_C(156),
+        UINT8_C(227), UINT8_C(170), UINT8_C( 33), UINT8_C( 47), UINT8_C( 44), UINT8_C(  2), UINT8_C(164), UINT8_C(224),
+        UINT8_C( 53), UINT8_C(193), UINT8_C(126), UINT8_C( 35), UINT8_C( 41), UINT8_C(172), UINT8_C(161), UINT8_C( 46),
+        UINT8_C( 33), UINT8_C(213), UINT8_C( 20), UINT8_C(178), UINT8_C( 84), UINT8_C(102), UINT8_C(147), UINT8_C( 28),
+        UINT8_C(125), UINT8_C(143), UINT8_C(106), UINT8_C( 90), UINT8_C(172), UINT8_C(132), UINT8_C(170), UINT8_C(  5),
+        UINT8_C( 27), UINT8_C(163), UINT8_C( 11), UINT8_C( 57), UINT8_C(106), UINT8_C( 10), UINT8_C(172), UINT8_C(151),
+        UINT8_C( 61), UINT8_C( 88), UINT8_C(224), UINT8_C(145), UINT8_C( 71), UINT8_C( 63), UINT8_C( 89), UINT8_C(133),
+        UINT8_C( 95), UINT8_C( 31), UINT8_C(105), UINT8_C( 42), UINT8_C(177), UINT8_C(232), UINT8_C(225), UINT8_C(200),
+        UINT8_C(  6), UINT8_C( 89), UINT8_C(129), UINT8_C(139), UINT8_C(254), UINT8_C( 95), UINT8_C(141), UINT8_C( 15),
+        UINT8_C(198), UINT8_C( 87), UINT8_C(169), UINT8_C( 54), UINT8_C(146), UINT8_C(237), UINT8_C( 96), UINT8_C(220),
+        UINT8_C( 99), UINT8_C(148), UINT8_C( 88), UINT8_C( 30), UINT8_C(168), UINT8_C( 29), UINT8_C(176), UINT8_C( 52),
+        UINT8_C(100), UINT8_C(190), UINT8_C( 57), UINT8_C(215), UINT8_C(248), UINT8_C( 75), UINT8_C(132), UINT8_C(106),
+        UINT8_C( 91), UINT8_C(180), UINT8_C(211), UINT8_C(144), UINT8_C( 85), UINT8_C(176), UINT8_C( 80), UINT8_C(216),
+        UINT8_C( 91), UINT8_C(188), UINT8_C( 89), UINT8_C(148), UINT8_C(254), UINT8_C(211), UINT8_C( 31), UINT8_C(134),
+        UINT8_C( 37), UINT8_C(212), UINT8_C( 92), UINT8_C(199), UINT8_C( 92), UINT8_C(  7), UINT8_C( 20), UINT8_C( 83),
+        UINT8_C( 73), UINT8_C( 24), UINT8_C(244), UINT8_C(103), UINT8_C( 83), UINT8_C(251), UINT8_C(160), UINT8_C(248),
+        UINT8_C( 52), UINT8_C( 37), UINT8_C( 82), UINT8_C(151), UINT8_C( 59), UINT8_C(140), UINT8_C(149), UINT8_C(117),
+        UINT8_C( 64), UINT8_C( 90), UINT8_C(235), UINT8_C( 58), UINT8_C(181), UINT8_C( 87), UINT8_C( 85), UINT8_C( 20),
+        UINT8_C(248), UINT8_C(125), UINT8_C( 65), UINT8_C(159), UINT8_C(149), UINT8_C(180), UINT8_C(137), UINT8_C(180),
+        UINT8_C(208), UINT8_C(241), UINT8_C( 28), UINT8_C( 62), UINT8_C(225), UINT8_C( 55), UINT8_C( 19), UINT8_C(227),
+        UINT8_C( 25), UINT8_C(110), UINT8_C( 81), UINT8_C(145), UINT8_C( 77), UINT8_C(178), UINT8_C(166), UINT8_C( 86)
+      } },
+    { { UINT8_C(202), UINT8_C(254), UINT8_C(186), UINT8_C(190), UINT8_C(250), UINT8_C(206), UINT8_C(219), UINT8_C(173),
+      UINT8_C(222), UINT8_C(202), UINT8_C(248), UINT8_C(136), UINT8_C(255), UINT8_C(255), UINT8_C(255), UINT8_C(251) },
+      {
+        UINT8_C(103), UINT8_C( 27), UINT8_C(108), UINT8_C(228), UINT8_C(242), UINT8_C(211), UINT8_C(222), UINT8_C(171),
+        UINT8_C( 33), UINT8_C( 88), UINT8_C(179), UINT8_C(118), UINT8_C(247), UINT8_C( 42), UINT8_C( 17), UINT8_C(199),
+        UINT8_C(194), UINT8_C(160), UINT8_C(248), UINT8_C( 99), UINT8_C(107), UINT8_C(  4), UINT8_C(111), UINT8_C(148),
+        UINT8_C(245), UINT8_C( 19), UINT8_C( 79), UINT8_C(143), UINT8_C( 67), UINT8_C(106), UINT8_C( 31), UINT8_C(191),
+        UINT8_C(186), UINT8_C(146), UINT8_C(160), UINT8_C(125), UINT8_C( 46), UINT8_C(150), UINT8_C(129), UINT8_C( 51),
+        UINT8_C( 83), UINT8_C(  1), UINT8_C(121), UINT8_C( 53), UINT8_C(171), UINT8_C(153), UINT8_C( 47), UINT8_C( 86),
+        UINT8_C(228), UINT8_C(154), UINT8_C(207), UINT8_C(229), UINT8_C( 27), UINT8_C(184), UINT8_C(225), UINT8_C(186),
+        UINT8_C(153), UINT8_C(206), UINT8_C( 84), UINT8_C(187), UINT8_C( 45), UINT8_C(177), UINT8_C( 65), UINT8_C( 76),
+        UINT8_C( 44), UINT8_C(121), UINT8_C(237), UINT8_C(113), UINT8_C(228), UINT8_C( 47), UINT8_C( 23), UINT8_C(102),
+        UINT8_C(224), UINT8_C(135), UINT8_C(140), UINT8_C( 53), UINT8_C(  7), UINT8_C( 22), UINT8_C(  5), UINT8_C( 26),
+        UINT8_C(207), UINT8_C(205), UINT8_C( 20), UINT8_C(250), UINT8_C( 36), UINT8_C( 45), UINT8_C(101), UINT8_C(255),
+        UINT8_C(224), UINT8_C(241), UINT8_C( 44), UINT8_C(141), UINT8_C( 47), UINT8_C(163), UINT8_C(216), UINT8_C( 80),
+        UINT8_C(166), UINT8_C(231), UINT8_C(125), UINT8_C( 35), UINT8_C( 97), UINT8_C( 43), UINT8_C(173), UINT8_C( 60),
+        UINT8_C( 70), UINT8_C(  4), UINT8_C(  6), UINT8_C(124), UINT8_C(205), UINT8_C( 60), UINT8_C(149), UINT8_C(177),
+        UINT8_C(  1), UINT8_C(179), UINT8_C(129), UINT8_C(198), UINT8_C( 71), UINT8_C( 70), UINT8_C(238), UINT8_C( 55),
+        UINT8_C( 79), UINT8_C(117), UINT8_C(222), UINT8_C(131), UINT8_C(113), UINT8_C( 56), UINT8_C(113), UINT8_C( 13),
+        UINT8_C(210), UINT8_C(195), UINT8_C(129), UINT8_C(170), UINT8_C(130), UINT8_C(246), UINT8_C( 87), UINT8_C(221),
+        UINT8_C( 12), UINT8_C(209), UINT8_C( 42), UINT8_C( 34), UINT8_C(222), UINT8_C(113), UINT8_C(155), UINT8_C(233),
+        UINT8_C(189), UINT8_C(  5), UINT8_C( 47), UINT8_C(155), UINT8_C( 86), UINT8_C( 28), UINT8_C( 71), UINT8_C( 97),
+        UINT8_C( 56), UINT8_C(238), UINT8_C(221), UINT8_C( 53), UINT8_C( 75), UINT8_C(175), UINT8_C( 48), UINT8_C(191),
+        UINT8_C(  8), UINT8_C( 85), UINT8_C(188), UINT8_C(228), UINT8_C(140), UINT8_C(153), UINT8_C(189), UINT8_C(146),
+        UINT8_C(159), UINT8_C( 18), UINT8_C( 84), UINT8_C(184), UINT8_C( 36), UINT8_C( 32), UINT8_C( 11), UINT8_C( 57)
+      } }
+  };
+
+  simde__m128i rk[11];
+  for (size_t i = 0 ; i < (sizeof(rk) / sizeof(rk[0])) ; i++) {
+    rk[i] = simde_mm_loadu_si128(round_keys[i]);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t blocks = 0 ; blocks <= (sizeof(plaintext) / 16) ; blocks++) {
+      uint8_t counter[16], r[176];
+      simde_memcpy(counter, test_vec[i].counter, sizeof(counter));
+      simde_memcpy(r, plaintext, sizeof(r));
+
+      simde_x_aes_ctr_encrypt_blocks(r, r, blocks, rk, 10, counter);
+      simde_assert_equal_vu8(16 * blocks, r, test_vec[i].r);
+      simde_assert_equal_vu8(12, counter, test_vec[i].counter);
+
+      uint32_t next =
+        (HEDLEY_STATIC_CAST(uint32_t, test_vec[i].counter[12]) << 24) |
+        (HEDLEY_STATIC_CAST(uint32_t, test_vec[i].counter[13]) << 16) |
+        (HEDLEY_STATIC_CAST(uint32_t, test_vec[i].counter[14]) <<  8) |
+        (HEDLEY_STATIC_CAST(uint32_t, test_vec[i].counter[15])      );
+      next += HEDLEY_STATIC_CAST(uint32_t, blocks);
+      simde_assert_equal_u8(counter[12], HEDLEY_STATIC_CAST(uint8_t, next >> 24));
+      simde_assert_equal_u8(counter[13], HEDLEY_STATIC_CAST(uint8_t, next >> 16));
+      simde_assert_equal_u8(counter[14], HEDLEY_STATIC_CAST(uint8_t, next >>  8));
+      simde_assert_equal_u8(counter[15], HEDLEY_STATIC_CAST(uint8_t, next      ));
+    }
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenc_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdec_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenclast_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdeclast_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesimc_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesenc_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesdec_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesenclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesdeclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesenc_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesdec_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesenclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesdeclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_aes_ctr_encrypt_blocks)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
@@ -1188,6 +1188,64 @@ test_simde_mm512_maskz_dpbf16_ps (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_x_convert_f32_to_bf16_array (SIMDE_MUNIT_TEST_ARGS) {
+  /* Zeros, rounding ties, carries into the exponent and infinity, and
+   * NaNs (which must not round to infinity). */
+  static const uint32_t a[] = {
+    UINT32_C(0x00000000), UINT32_C(0x80000000), UINT32_C(0x3f800000), UINT32_C(0xc0490fdb),
+    UINT32_C(0x3f808000), UINT32_C(0x3f818000), UINT32_C(0x3f80ffff), UINT32_C(0x3f7fffff),
+    UINT32_C(0x7f7f7fff), UINT32_C(0x7f7fffff), UINT32_C(0xff7f8000), UINT32_C(0x00000001),
+    UINT32_C(0x7f800000), UINT32_C(0xff800000), UINT32_C(0x7fc00000), UINT32_C(0xff800001),
+    UINT32_C(0x7fbfffff), UINT32_C(0x80008000)
+  };
+  static const uint16_t r[] = {
+    UINT16_C(0x0000), UINT16_C(0x8000), UINT16_C(0x3f80), UINT16_C(0xc049), UINT16_C(0x3f80), UINT16_C(0x3f82),
+    UINT16_C(0x3f81), UINT16_C(0x3f80), UINT16_C(0x7f7f), UINT16_C(0x7f80), UINT16_C(0xff80), UINT16_C(0x0000),
+    UINT16_C(0x7f80), UINT16_C(0xff80), UINT16_C(0x7fc0), UINT16_C(0xffc0), UINT16_C(0x7fff), UINT16_C(0x8000)
+  };
+  const size_t len = sizeof(a) / sizeof(a[0]);
+  simde_float32 src[sizeof(a) / sizeof(a[0])];
+  simde_bfloat16 dst[sizeof(a) / sizeof(a[0])];
+  uint16_t dst_bits[sizeof(a) / sizeof(a[0])];
+
+  simde_memcpy(src, a, sizeof(src));
+
+  for (size_t n = 0 ; n <= len ; n++) {
+    simde_x_convert_f32_to_bf16_array(dst, src, n);
+    simde_memcpy(dst_bits, dst, sizeof(dst_bits[0]) * n);
+    simde_assert_equal_vu16(n, dst_bits, r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_convert_bf16_to_f32_array (SIMDE_MUNIT_TEST_ARGS) {
+  static const uint16_t a[] = {
+    UINT16_C(0x0000), UINT16_C(0x8000), UINT16_C(0x0001), UINT16_C(0x3f80), UINT16_C(0xc049), UINT16_C(0x7f7f),
+    UINT16_C(0x7f80), UINT16_C(0xff80), UINT16_C(0x7fc0), UINT16_C(0xff81), UINT16_C(0x4049)
+  };
+  const size_t len = sizeof(a) / sizeof(a[0]);
+  simde_bfloat16 src[sizeof(a) / sizeof(a[0])];
+  simde_float32 dst[sizeof(a) / sizeof(a[0])];
+  uint32_t dst_bits[sizeof(a) / sizeof(a[0])];
+  uint32_t r[sizeof(a) / sizeof(a[0])];
+
+  simde_memcpy(src, a, sizeof(src));
+  for (size_t i = 0 ; i < len ; i++) {
+    r[i] = HEDLEY_STATIC_CAST(uint32_t, a[i]) << 16;
+  }
+
+  for (size_t n = 0 ; n <= len ; n++) {
+    simde_x_convert_bf16_to_f32_array(dst, src, n);
+    simde_memcpy(dst_bits, dst, sizeof(dst_bits[0]) * n);
+    simde_assert_equal_vu32(n, dst_bits, r);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbf16_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpbf16_ps)
@@ -1198,6 +1256,9 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpbf16_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpbf16_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpbf16_ps)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_convert_f32_to_bf16_array)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_convert_bf16_to_f32_array)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
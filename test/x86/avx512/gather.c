@@ -128,8 +128,345 @@ test_simde_mm512_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm512_mask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[16];
+    simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   132.13), SIMDE_FLOAT32_C(   694.25), SIMDE_FLOAT32_C(   866.37), SIMDE_FLOAT32_C(   372.28),
+        SIMDE_FLOAT32_C(  -472.75), SIMDE_FLOAT32_C(   858.72), SIMDE_FLOAT32_C(  -910.10), SIMDE_FLOAT32_C(  -549.26),
+        SIMDE_FLOAT32_C(  -240.10), SIMDE_FLOAT32_C(  -616.82), SIMDE_FLOAT32_C(   999.36), SIMDE_FLOAT32_C(  -984.08),
+        SIMDE_FLOAT32_C(   612.52), SIMDE_FLOAT32_C(  -951.71), SIMDE_FLOAT32_C(  -238.58), SIMDE_FLOAT32_C(   941.92) },
+      UINT16_C( 3546),
+      {  INT32_C(           8),  INT32_C(          25),  INT32_C(         227),  INT32_C(         252),  INT32_C(          78),  INT32_C(         159),  INT32_C(         126),  INT32_C(         206),
+         INT32_C(         169),  INT32_C(         193),  INT32_C(         120),  INT32_C(         118),  INT32_C(         192),  INT32_C(         232),  INT32_C(         224),  INT32_C(         124) },
+      { SIMDE_FLOAT32_C(   132.13), SIMDE_FLOAT32_C(    50.00), SIMDE_FLOAT32_C(   866.37), SIMDE_FLOAT32_C(   504.00),
+        SIMDE_FLOAT32_C(   156.00), SIMDE_FLOAT32_C(   858.72), SIMDE_FLOAT32_C(   252.00), SIMDE_FLOAT32_C(   412.00),
+        SIMDE_FLOAT32_C(   338.00), SIMDE_FLOAT32_C(  -616.82), SIMDE_FLOAT32_C(   240.00), SIMDE_FLOAT32_C(   236.00),
+        SIMDE_FLOAT32_C(   612.52), SIMDE_FLOAT32_C(  -951.71), SIMDE_FLOAT32_C(  -238.58), SIMDE_FLOAT32_C(   941.92) } },
+    { { SIMDE_FLOAT32_C(  -345.94), SIMDE_FLOAT32_C(   121.55), SIMDE_FLOAT32_C(   354.62), SIMDE_FLOAT32_C(  -256.04),
+        SIMDE_FLOAT32_C(   572.29), SIMDE_FLOAT32_C(  -885.47), SIMDE_FLOAT32_C(   127.14), SIMDE_FLOAT32_C(   571.66),
+        SIMDE_FLOAT32_C(  -869.55), SIMDE_FLOAT32_C(  -260.34), SIMDE_FLOAT32_C(   619.95), SIMDE_FLOAT32_C(  -108.13),
+        SIMDE_FLOAT32_C(  -318.42), SIMDE_FLOAT32_C(  -581.65), SIMDE_FLOAT32_C(   488.92), SIMDE_FLOAT32_C(   678.41) },
+      UINT16_C(12904),
+      {  INT32_C(          30),  INT32_C(         182),  INT32_C(         210),  INT32_C(         156),  INT32_C(         133),  INT32_C(         123),  INT32_C(          94),  INT32_C(         253),
+         INT32_C(         242),  INT32_C(          30),  INT32_C(         229),  INT32_C(         210),  INT32_C(         154),  INT32_C(          74),  INT32_C(         164),  INT32_C(         162) },
+      { SIMDE_FLOAT32_C(  -345.94), SIMDE_FLOAT32_C(   121.55), SIMDE_FLOAT32_C(   354.62), SIMDE_FLOAT32_C(   312.00),
+        SIMDE_FLOAT32_C(   572.29), SIMDE_FLOAT32_C(   246.00), SIMDE_FLOAT32_C(   188.00), SIMDE_FLOAT32_C(   571.66),
+        SIMDE_FLOAT32_C(  -869.55), SIMDE_FLOAT32_C(    60.00), SIMDE_FLOAT32_C(   619.95), SIMDE_FLOAT32_C(  -108.13),
+        SIMDE_FLOAT32_C(   308.00), SIMDE_FLOAT32_C(   148.00), SIMDE_FLOAT32_C(   488.92), SIMDE_FLOAT32_C(   678.41) } },
+    { { SIMDE_FLOAT32_C(   763.18), SIMDE_FLOAT32_C(   391.88), SIMDE_FLOAT32_C(   723.60), SIMDE_FLOAT32_C(  -109.68),
+        SIMDE_FLOAT32_C(   -36.46), SIMDE_FLOAT32_C(   854.05), SIMDE_FLOAT32_C(   629.98), SIMDE_FLOAT32_C(  -416.51),
+        SIMDE_FLOAT32_C(  -254.08), SIMDE_FLOAT32_C(  -688.45), SIMDE_FLOAT32_C(     1.83), SIMDE_FLOAT32_C(  -765.16),
+        SIMDE_FLOAT32_C(   989.97), SIMDE_FLOAT32_C(  -365.57), SIMDE_FLOAT32_C(  -545.02), SIMDE_FLOAT32_C(   -37.22) },
+      UINT16_C(10582),
+      {  INT32_C(         207),  INT32_C(         219),  INT32_C(         165),  INT32_C(          45),  INT32_C(         217),  INT32_C(         151),  INT32_C(          76),  INT32_C(         190),
+         INT32_C(         105),  INT32_C(         230),  INT32_C(           8),  INT32_C(          13),  INT32_C(         136),  INT32_C(         194),  INT32_C(         119),  INT32_C(         170) },
+      { SIMDE_FLOAT32_C(   763.18), SIMDE_FLOAT32_C(   438.00), SIMDE_FLOAT32_C(   330.00), SIMDE_FLOAT32_C(  -109.68),
+        SIMDE_FLOAT32_C(   434.00), SIMDE_FLOAT32_C(   854.05), SIMDE_FLOAT32_C(   152.00), SIMDE_FLOAT32_C(  -416.51),
+        SIMDE_FLOAT32_C(   210.00), SIMDE_FLOAT32_C(  -688.45), SIMDE_FLOAT32_C(     1.83), SIMDE_FLOAT32_C(    26.00),
+        SIMDE_FLOAT32_C(   989.97), SIMDE_FLOAT32_C(   388.00), SIMDE_FLOAT32_C(  -545.02), SIMDE_FLOAT32_C(   -37.22) } },
+    { { SIMDE_FLOAT32_C(   783.30), SIMDE_FLOAT32_C(   395.71), SIMDE_FLOAT32_C(  -826.99), SIMDE_FLOAT32_C(   413.27),
+        SIMDE_FLOAT32_C(   979.20), SIMDE_FLOAT32_C(   -81.07), SIMDE_FLOAT32_C(   724.83), SIMDE_FLOAT32_C(   -18.97),
+        SIMDE_FLOAT32_C(   153.76), SIMDE_FLOAT32_C(   714.79), SIMDE_FLOAT32_C(   615.46), SIMDE_FLOAT32_C(   608.75),
+        SIMDE_FLOAT32_C(  -322.43), SIMDE_FLOAT32_C(   343.79), SIMDE_FLOAT32_C(  -176.00), SIMDE_FLOAT32_C(   521.85) },
+      UINT16_C(24541),
+      {  INT32_C(         168),  INT32_C(         182),  INT32_C(         246),  INT32_C(         244),  INT32_C(         116),  INT32_C(          95),  INT32_C(         218),  INT32_C(         125),
+         INT32_C(         108),  INT32_C(          99),  INT32_C(          63),  INT32_C(         228),  INT32_C(          13),  INT32_C(         213),  INT32_C(         207),  INT32_C(          75) },
+      { SIMDE_FLOAT32_C(   336.00), SIMDE_FLOAT32_C(   395.71), SIMDE_FLOAT32_C(   492.00), SIMDE_FLOAT32_C(   488.00),
+        SIMDE_FLOAT32_C(   232.00), SIMDE_FLOAT32_C(   -81.07), SIMDE_FLOAT32_C(   436.00), SIMDE_FLOAT32_C(   250.00),
+        SIMDE_FLOAT32_C(   216.00), SIMDE_FLOAT32_C(   198.00), SIMDE_FLOAT32_C(   126.00), SIMDE_FLOAT32_C(   456.00),
+        SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(   343.79), SIMDE_FLOAT32_C(   414.00), SIMDE_FLOAT32_C(   521.85) } },
+    { { SIMDE_FLOAT32_C(    81.18), SIMDE_FLOAT32_C(   833.63), SIMDE_FLOAT32_C(   219.50), SIMDE_FLOAT32_C(  -193.99),
+        SIMDE_FLOAT32_C(  -185.34), SIMDE_FLOAT32_C(  -626.74), SIMDE_FLOAT32_C(  -479.20), SIMDE_FLOAT32_C(  -569.87),
+        SIMDE_FLOAT32_C(   982.01), SIMDE_FLOAT32_C(   198.37), SIMDE_FLOAT32_C(   773.92), SIMDE_FLOAT32_C(  -193.99),
+        SIMDE_FLOAT32_C(  -279.78), SIMDE_FLOAT32_C(   779.76), SIMDE_FLOAT32_C(  -951.07), SIMDE_FLOAT32_C(  -784.65) },
+      UINT16_C(14317),
+      {  INT32_C(         225),  INT32_C(          97),  INT32_C(         150),  INT32_C(         187),  INT32_C(         222),  INT32_C(           3),  INT32_C(          30),  INT32_C(          30),
+         INT32_C(         231),  INT32_C(          43),  INT32_C(         243),  INT32_C(         182),  INT32_C(         118),  INT32_C(          55),  INT32_C(          88),  INT32_C(         213) },
+      { SIMDE_FLOAT32_C(   450.00), SIMDE_FLOAT32_C(   833.63), SIMDE_FLOAT32_C(   300.00), SIMDE_FLOAT32_C(   374.00),
+        SIMDE_FLOAT32_C(  -185.34), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(    60.00), SIMDE_FLOAT32_C(    60.00),
+        SIMDE_FLOAT32_C(   462.00), SIMDE_FLOAT32_C(    86.00), SIMDE_FLOAT32_C(   486.00), SIMDE_FLOAT32_C(  -193.99),
+        SIMDE_FLOAT32_C(   236.00), SIMDE_FLOAT32_C(   110.00), SIMDE_FLOAT32_C(  -951.07), SIMDE_FLOAT32_C(  -784.65) } },
+    { { SIMDE_FLOAT32_C(   824.21), SIMDE_FLOAT32_C(   788.80), SIMDE_FLOAT32_C(   485.07), SIMDE_FLOAT32_C(  -655.00),
+        SIMDE_FLOAT32_C(  -781.08), SIMDE_FLOAT32_C(   467.08), SIMDE_FLOAT32_C(   543.37), SIMDE_FLOAT32_C(   992.84),
+        SIMDE_FLOAT32_C(  -726.91), SIMDE_FLOAT32_C(  -736.41), SIMDE_FLOAT32_C(   772.61), SIMDE_FLOAT32_C(  -677.98),
+        SIMDE_FLOAT32_C(  -521.06), SIMDE_FLOAT32_C(   303.63), SIMDE_FLOAT32_C(  -863.47), SIMDE_FLOAT32_C(   -78.75) },
+      UINT16_C(34878),
+      {  INT32_C(         151),  INT32_C(          28),  INT32_C(         139),  INT32_C(         182),  INT32_C(          58),  INT32_C(         114),  INT32_C(         225),  INT32_C(          45),
+         INT32_C(          40),  INT32_C(          88),  INT32_C(         101),  INT32_C(         128),  INT32_C(          45),  INT32_C(          68),  INT32_C(         134),  INT32_C(         155) },
+      { SIMDE_FLOAT32_C(   824.21), SIMDE_FLOAT32_C(    56.00), SIMDE_FLOAT32_C(   278.00), SIMDE_FLOAT32_C(   364.00),
+        SIMDE_FLOAT32_C(   116.00), SIMDE_FLOAT32_C(   228.00), SIMDE_FLOAT32_C(   543.37), SIMDE_FLOAT32_C(   992.84),
+        SIMDE_FLOAT32_C(  -726.91), SIMDE_FLOAT32_C(  -736.41), SIMDE_FLOAT32_C(   772.61), SIMDE_FLOAT32_C(   256.00),
+        SIMDE_FLOAT32_C(  -521.06), SIMDE_FLOAT32_C(   303.63), SIMDE_FLOAT32_C(  -863.47), SIMDE_FLOAT32_C(   310.00) } },
+    { { SIMDE_FLOAT32_C(  -525.48), SIMDE_FLOAT32_C(   173.09), SIMDE_FLOAT32_C(   588.98), SIMDE_FLOAT32_C(  -982.10),
+        SIMDE_FLOAT32_C(   165.94), SIMDE_FLOAT32_C(   862.07), SIMDE_FLOAT32_C(  -718.51), SIMDE_FLOAT32_C(   -61.46),
+        SIMDE_FLOAT32_C(  -815.91), SIMDE_FLOAT32_C(  -239.57), SIMDE_FLOAT32_C(  -757.83), SIMDE_FLOAT32_C(  -679.37),
+        SIMDE_FLOAT32_C(   681.68), SIMDE_FLOAT32_C(   -61.34), SIMDE_FLOAT32_C(   257.94), SIMDE_FLOAT32_C(  -741.50) },
+      UINT16_C(26820),
+      {  INT32_C(          62),  INT32_C(         254),  INT32_C(         218),  INT32_C(          31),  INT32_C(          44),  INT32_C(           2),  INT32_C(         119),  INT32_C(         145),
+         INT32_C(         130),  INT32_C(         165),  INT32_C(         213),  INT32_C(           9),  INT32_C(          64),  INT32_C(          23),  INT32_C(         238),  INT32_C(         113) },
+      { SIMDE_FLOAT32_C(  -525.48), SIMDE_FLOAT32_C(   173.09), SIMDE_FLOAT32_C(   436.00), SIMDE_FLOAT32_C(  -982.10),
+        SIMDE_FLOAT32_C(   165.94), SIMDE_FLOAT32_C(   862.07), SIMDE_FLOAT32_C(   238.00), SIMDE_FLOAT32_C(   290.00),
+        SIMDE_FLOAT32_C(  -815.91), SIMDE_FLOAT32_C(  -239.57), SIMDE_FLOAT32_C(  -757.83), SIMDE_FLOAT32_C(    18.00),
+        SIMDE_FLOAT32_C(   681.68), SIMDE_FLOAT32_C(    46.00), SIMDE_FLOAT32_C(   476.00), SIMDE_FLOAT32_C(  -741.50) } },
+    { { SIMDE_FLOAT32_C(   584.13), SIMDE_FLOAT32_C(  -276.87), SIMDE_FLOAT32_C(   666.99), SIMDE_FLOAT32_C(   865.62),
+        SIMDE_FLOAT32_C(   661.67), SIMDE_FLOAT32_C(   851.09), SIMDE_FLOAT32_C(  -373.96), SIMDE_FLOAT32_C(   903.84),
+        SIMDE_FLOAT32_C(  -828.29), SIMDE_FLOAT32_C(  -692.27), SIMDE_FLOAT32_C(  -157.49), SIMDE_FLOAT32_C(   429.66),
+        SIMDE_FLOAT32_C(  -433.78), SIMDE_FLOAT32_C(  -137.84), SIMDE_FLOAT32_C(  -547.74), SIMDE_FLOAT32_C(  -134.29) },
+      UINT16_C(62188),
+      {  INT32_C(          39),  INT32_C(          24),  INT32_C(         244),  INT32_C(         158),  INT32_C(         169),  INT32_C(         118),  INT32_C(          67),  INT32_C(         126),
+         INT32_C(         127),  INT32_C(         131),  INT32_C(         149),  INT32_C(         109),  INT32_C(         244),  INT32_C(         184),  INT32_C(         249),  INT32_C(          15) },
+      { SIMDE_FLOAT32_C(   584.13), SIMDE_FLOAT32_C(  -276.87), SIMDE_FLOAT32_C(   488.00), SIMDE_FLOAT32_C(   316.00),
+        SIMDE_FLOAT32_C(   661.67), SIMDE_FLOAT32_C(   236.00), SIMDE_FLOAT32_C(   134.00), SIMDE_FLOAT32_C(   252.00),
+        SIMDE_FLOAT32_C(  -828.29), SIMDE_FLOAT32_C(   262.00), SIMDE_FLOAT32_C(  -157.49), SIMDE_FLOAT32_C(   429.66),
+        SIMDE_FLOAT32_C(   488.00), SIMDE_FLOAT32_C(   368.00), SIMDE_FLOAT32_C(   498.00), SIMDE_FLOAT32_C(    30.00) } }
+  };
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = HEDLEY_STATIC_CAST(simde_float32, i); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 r = simde_mm512_mask_i32gather_ps(src, test_vec[i].k, vindex, HEDLEY_STATIC_CAST(const void*, f32_buffer), 8);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (size_t i = 0 ; i < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; i++) { f32_buffer[i] = HEDLEY_STATIC_CAST(simde_float32, i); }
+
+  for (int i = 0; i < 8; i++) {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())));
+    simde__m512 r = simde_mm512_mask_i32gather_ps(src, k, vindex, f32_buffer, 8);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 static int32_t i32_buffer[2048];
 
+static int
+test_simde_mm512_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(         245),  INT32_C(          17),  INT32_C(         141),  INT32_C(          70),  INT32_C(         147),  INT32_C(          96),  INT32_C(         135),  INT32_C(         189),
+         INT32_C(          16),  INT32_C(          81),  INT32_C(         170),  INT32_C(          40),  INT32_C(          88),  INT32_C(         150),  INT32_C(          26),  INT32_C(         127) },
+      {  INT32_C(         490),  INT32_C(          34),  INT32_C(         282),  INT32_C(         140),  INT32_C(         294),  INT32_C(         192),  INT32_C(         270),  INT32_C(         378),
+         INT32_C(          32),  INT32_C(         162),  INT32_C(         340),  INT32_C(          80),  INT32_C(         176),  INT32_C(         300),  INT32_C(          52),  INT32_C(         254) } },
+    { {  INT32_C(         174),  INT32_C(          14),  INT32_C(          30),  INT32_C(          87),  INT32_C(         132),  INT32_C(          97),  INT32_C(         213),  INT32_C(           4),
+         INT32_C(         229),  INT32_C(         107),  INT32_C(         113),  INT32_C(         217),  INT32_C(          35),  INT32_C(         106),  INT32_C(         232),  INT32_C(          24) },
+      {  INT32_C(         348),  INT32_C(          28),  INT32_C(          60),  INT32_C(         174),  INT32_C(         264),  INT32_C(         194),  INT32_C(         426),  INT32_C(           8),
+         INT32_C(         458),  INT32_C(         214),  INT32_C(         226),  INT32_C(         434),  INT32_C(          70),  INT32_C(         212),  INT32_C(         464),  INT32_C(          48) } },
+    { {  INT32_C(         124),  INT32_C(         117),  INT32_C(          94),  INT32_C(          15),  INT32_C(         213),  INT32_C(         230),  INT32_C(         204),  INT32_C(         229),
+         INT32_C(          55),  INT32_C(         119),  INT32_C(          13),  INT32_C(         143),  INT32_C(          13),  INT32_C(          39),  INT32_C(          15),  INT32_C(         188) },
+      {  INT32_C(         248),  INT32_C(         234),  INT32_C(         188),  INT32_C(          30),  INT32_C(         426),  INT32_C(         460),  INT32_C(         408),  INT32_C(         458),
+         INT32_C(         110),  INT32_C(         238),  INT32_C(          26),  INT32_C(         286),  INT32_C(          26),  INT32_C(          78),  INT32_C(          30),  INT32_C(         376) } },
+    { {  INT32_C(          53),  INT32_C(          45),  INT32_C(          19),  INT32_C(         186),  INT32_C(         142),  INT32_C(         233),  INT32_C(         190),  INT32_C(         115),
+         INT32_C(          84),  INT32_C(          47),  INT32_C(          77),  INT32_C(         119),  INT32_C(         154),  INT32_C(          53),  INT32_C(         144),  INT32_C(          22) },
+      {  INT32_C(         106),  INT32_C(          90),  INT32_C(          38),  INT32_C(         372),  INT32_C(         284),  INT32_C(         466),  INT32_C(         380),  INT32_C(         230),
+         INT32_C(         168),  INT32_C(          94),  INT32_C(         154),  INT32_C(         238),  INT32_C(         308),  INT32_C(         106),  INT32_C(         288),  INT32_C(          44) } },
+    { {  INT32_C(         171),  INT32_C(         238),  INT32_C(          37),  INT32_C(         128),  INT32_C(         212),  INT32_C(         242),  INT32_C(         102),  INT32_C(          11),
+         INT32_C(         105),  INT32_C(         115),  INT32_C(         155),  INT32_C(         118),  INT32_C(         155),  INT32_C(         170),  INT32_C(          50),  INT32_C(         208) },
+      {  INT32_C(         342),  INT32_C(         476),  INT32_C(          74),  INT32_C(         256),  INT32_C(         424),  INT32_C(         484),  INT32_C(         204),  INT32_C(          22),
+         INT32_C(         210),  INT32_C(         230),  INT32_C(         310),  INT32_C(         236),  INT32_C(         310),  INT32_C(         340),  INT32_C(         100),  INT32_C(         416) } },
+    { {  INT32_C(         215),  INT32_C(          70),  INT32_C(         138),  INT32_C(         101),  INT32_C(          47),  INT32_C(          72),  INT32_C(         217),  INT32_C(         131),
+         INT32_C(         120),  INT32_C(          38),  INT32_C(         250),  INT32_C(          18),  INT32_C(          91),  INT32_C(         138),  INT32_C(          40),  INT32_C(           6) },
+      {  INT32_C(         430),  INT32_C(         140),  INT32_C(         276),  INT32_C(         202),  INT32_C(          94),  INT32_C(         144),  INT32_C(         434),  INT32_C(         262),
+         INT32_C(         240),  INT32_C(          76),  INT32_C(         500),  INT32_C(          36),  INT32_C(         182),  INT32_C(         276),  INT32_C(          80),  INT32_C(          12) } },
+    { {  INT32_C(         121),  INT32_C(          77),  INT32_C(         135),  INT32_C(          77),  INT32_C(          63),  INT32_C(         237),  INT32_C(          89),  INT32_C(         168),
+         INT32_C(          96),  INT32_C(         244),  INT32_C(          31),  INT32_C(         251),  INT32_C(         158),  INT32_C(          81),  INT32_C(         204),  INT32_C(         117) },
+      {  INT32_C(         242),  INT32_C(         154),  INT32_C(         270),  INT32_C(         154),  INT32_C(         126),  INT32_C(         474),  INT32_C(         178),  INT32_C(         336),
+         INT32_C(         192),  INT32_C(         488),  INT32_C(          62),  INT32_C(         502),  INT32_C(         316),  INT32_C(         162),  INT32_C(         408),  INT32_C(         234) } },
+    { {  INT32_C(         151),  INT32_C(          86),  INT32_C(         218),  INT32_C(         198),  INT32_C(         159),  INT32_C(         179),  INT32_C(          73),  INT32_C(          23),
+         INT32_C(         217),  INT32_C(          68),  INT32_C(          41),  INT32_C(          53),  INT32_C(         206),  INT32_C(          81),  INT32_C(          59),  INT32_C(          71) },
+      {  INT32_C(         302),  INT32_C(         172),  INT32_C(         436),  INT32_C(         396),  INT32_C(         318),  INT32_C(         358),  INT32_C(         146),  INT32_C(          46),
+         INT32_C(         434),  INT32_C(         136),  INT32_C(          82),  INT32_C(         106),  INT32_C(         412),  INT32_C(         162),  INT32_C(         118),  INT32_C(         142) } }
+  };
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = HEDLEY_STATIC_CAST(int32_t, i); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i32gather_epi32(vindex, HEDLEY_STATIC_CAST(const void*, i32_buffer), 8);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = HEDLEY_STATIC_CAST(int32_t, i); }
+
+  for (int i = 0; i < 8; i++) {
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())));
+    simde__m512i r = simde_mm512_i32gather_epi32(vindex, i32_buffer, 8);
+
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t src[16];
+    simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   560610658),  INT32_C(   277278383), -INT32_C(  2146720286), -INT32_C(  1896491017), -INT32_C(   850014418),  INT32_C(  1558486659), -INT32_C(  1315893790), -INT32_C(    50803362),
+         INT32_C(  1071287695),  INT32_C(  1565483387), -INT32_C(    35825146),  INT32_C(  1619841586),  INT32_C(   623763874),  INT32_C(  1652625791),  INT32_C(  2081624862),  INT32_C(  1870138336) },
+      UINT16_C(21401),
+      {  INT32_C(         174),  INT32_C(          20),  INT32_C(         180),  INT32_C(         253),  INT32_C(         114),  INT32_C(         186),  INT32_C(          88),  INT32_C(          79),
+         INT32_C(         184),  INT32_C(         138),  INT32_C(          34),  INT32_C(          68),  INT32_C(         234),  INT32_C(         196),  INT32_C(          37),  INT32_C(          23) },
+      {  INT32_C(         348),  INT32_C(   277278383), -INT32_C(  2146720286),  INT32_C(         506),  INT32_C(         228),  INT32_C(  1558486659), -INT32_C(  1315893790),  INT32_C(         158),
+         INT32_C(         368),  INT32_C(         276), -INT32_C(    35825146),  INT32_C(  1619841586),  INT32_C(         468),  INT32_C(  1652625791),  INT32_C(          74),  INT32_C(  1870138336) } },
+    { {  INT32_C(  1781048553),  INT32_C(   427640326),  INT32_C(   975527362),  INT32_C(  2072886989),  INT32_C(  1148797394), -INT32_C(  1265315332),  INT32_C(  1173927515),  INT32_C(  1666981242),
+        -INT32_C(   926055231), -INT32_C(  1931392054),  INT32_C(  1975912104), -INT32_C(  1745791804), -INT32_C(  1847891307), -INT32_C(  1773834437), -INT32_C(  1613021915),  INT32_C(   469907290) },
+      UINT16_C(53435),
+      {  INT32_C(         228),  INT32_C(         133),  INT32_C(          27),  INT32_C(         197),  INT32_C(          17),  INT32_C(         195),  INT32_C(         204),  INT32_C(         215),
+         INT32_C(          57),  INT32_C(         144),  INT32_C(          43),  INT32_C(          42),  INT32_C(          39),  INT32_C(         193),  INT32_C(         148),  INT32_C(           3) },
+      {  INT32_C(         456),  INT32_C(         266),  INT32_C(   975527362),  INT32_C(         394),  INT32_C(          34),  INT32_C(         390),  INT32_C(  1173927515),  INT32_C(         430),
+        -INT32_C(   926055231), -INT32_C(  1931392054),  INT32_C(  1975912104), -INT32_C(  1745791804),  INT32_C(          78), -INT32_C(  1773834437),  INT32_C(         296),  INT32_C(           6) } },
+    { { -INT32_C(  1737306286),  INT32_C(  1087740005),  INT32_C(   980889655),  INT32_C(   805974604), -INT32_C(   923458121),  INT32_C(   564117992),  INT32_C(  2035010386), -INT32_C(   562241652),
+         INT32_C(   326561710), -INT32_C(  1101837177), -INT32_C(   923219332), -INT32_C(  1275591940),  INT32_C(   276557095),  INT32_C(    19995567),  INT32_C(  1920630246),  INT32_C(   189855580) },
+      UINT16_C(51174),
+      {  INT32_C(          30),  INT32_C(         109),  INT32_C(          19),  INT32_C(         114),  INT32_C(          43),  INT32_C(         143),  INT32_C(          60),  INT32_C(          36),
+         INT32_C(          87),  INT32_C(          57),  INT32_C(          38),  INT32_C(          79),  INT32_C(         236),  INT32_C(          78),  INT32_C(          60),  INT32_C(         104) },
+      { -INT32_C(  1737306286),  INT32_C(         218),  INT32_C(          38),  INT32_C(   805974604), -INT32_C(   923458121),  INT32_C(         286),  INT32_C(         120),  INT32_C(          72),
+         INT32_C(         174),  INT32_C(         114),  INT32_C(          76), -INT32_C(  1275591940),  INT32_C(   276557095),  INT32_C(    19995567),  INT32_C(         120),  INT32_C(         208) } },
+    { { -INT32_C(  1887179938),  INT32_C(  1728866796),  INT32_C(   727607771), -INT32_C(  1829616524), -INT32_C(   603716175), -INT32_C(   352304748),  INT32_C(  1715087226), -INT32_C(   741443723),
+         INT32_C(  1331843426), -INT32_C(  1783205958),  INT32_C(  1287722200),  INT32_C(   165589848),  INT32_C(  1306911673), -INT32_C(  1640372700), -INT32_C(  2113637619),  INT32_C(  1297470442) },
+      UINT16_C(46884),
+      {  INT32_C(         156),  INT32_C(         223),  INT32_C(          38),  INT32_C(          82),  INT32_C(         116),  INT32_C(         254),  INT32_C(         102),  INT32_C(          53),
+         INT32_C(          74),  INT32_C(         190),  INT32_C(         233),  INT32_C(          41),  INT32_C(         199),  INT32_C(         162),  INT32_C(          12),  INT32_C(         172) },
+      { -INT32_C(  1887179938),  INT32_C(  1728866796),  INT32_C(          76), -INT32_C(  1829616524), -INT32_C(   603716175),  INT32_C(         508),  INT32_C(  1715087226), -INT32_C(   741443723),
+         INT32_C(         148),  INT32_C(         380),  INT32_C(         466),  INT32_C(   165589848),  INT32_C(         398),  INT32_C(         324), -INT32_C(  2113637619),  INT32_C(         344) } },
+    { {  INT32_C(   680669423), -INT32_C(   761487410),  INT32_C(  1990559265),  INT32_C(  1865337555),  INT32_C(   499209385), -INT32_C(  1655494829), -INT32_C(  1396294427), -INT32_C(   849751330),
+        -INT32_C(   789124350), -INT32_C(  1398566261), -INT32_C(   333232104), -INT32_C(  1151643374), -INT32_C(   119988827),  INT32_C(   714484804),  INT32_C(  1188453480),  INT32_C(   823340847) },
+      UINT16_C( 2331),
+      {  INT32_C(           2),  INT32_C(         166),  INT32_C(         155),  INT32_C(         165),  INT32_C(          82),  INT32_C(         180),  INT32_C(         237),  INT32_C(         117),
+         INT32_C(         160),  INT32_C(           0),  INT32_C(         198),  INT32_C(         251),  INT32_C(         187),  INT32_C(         108),  INT32_C(          24),  INT32_C(         148) },
+      {  INT32_C(           4),  INT32_C(         332),  INT32_C(  1990559265),  INT32_C(         330),  INT32_C(         164), -INT32_C(  1655494829), -INT32_C(  1396294427), -INT32_C(   849751330),
+         INT32_C(         320), -INT32_C(  1398566261), -INT32_C(   333232104),  INT32_C(         502), -INT32_C(   119988827),  INT32_C(   714484804),  INT32_C(  1188453480),  INT32_C(   823340847) } },
+    { { -INT32_C(    88056476),  INT32_C(  1565993095), -INT32_C(  2104654226), -INT32_C(  1182029641), -INT32_C(  1604442290),  INT32_C(  2065059035),  INT32_C(   125230156), -INT32_C(  1382248632),
+         INT32_C(  1940348140), -INT32_C(   204407163),  INT32_C(  1014324612),  INT32_C(  1408565509),  INT32_C(    66343976), -INT32_C(   327284064),  INT32_C(   804517094),  INT32_C(  1876725635) },
+      UINT16_C(33772),
+      {  INT32_C(         226),  INT32_C(         113),  INT32_C(         130),  INT32_C(         179),  INT32_C(         100),  INT32_C(           6),  INT32_C(          16),  INT32_C(         218),
+         INT32_C(          66),  INT32_C(          22),  INT32_C(         219),  INT32_C(          56),  INT32_C(         105),  INT32_C(           3),  INT32_C(         140),  INT32_C(          93) },
+      { -INT32_C(    88056476),  INT32_C(  1565993095),  INT32_C(         260),  INT32_C(         358), -INT32_C(  1604442290),  INT32_C(          12),  INT32_C(          32),  INT32_C(         436),
+         INT32_C(         132),  INT32_C(          44),  INT32_C(  1014324612),  INT32_C(  1408565509),  INT32_C(    66343976), -INT32_C(   327284064),  INT32_C(   804517094),  INT32_C(         186) } },
+    { { -INT32_C(  2073613306),  INT32_C(   192433688),  INT32_C(  1503394941),  INT32_C(  1323075435),  INT32_C(  1543593720), -INT32_C(  1489628827), -INT32_C(  1847652057),  INT32_C(   451832596),
+        -INT32_C(  1348577641),  INT32_C(   565909412),  INT32_C(  2121946643), -INT32_C(   708028707),  INT32_C(   439471541),  INT32_C(   113338591), -INT32_C(  1902665351), -INT32_C(  1532459508) },
+      UINT16_C(18396),
+      {  INT32_C(          83),  INT32_C(         128),  INT32_C(          94),  INT32_C(          14),  INT32_C(         161),  INT32_C(         113),  INT32_C(         100),  INT32_C(          27),
+         INT32_C(         239),  INT32_C(          65),  INT32_C(         113),  INT32_C(         188),  INT32_C(          22),  INT32_C(          38),  INT32_C(         137),  INT32_C(          72) },
+      { -INT32_C(  2073613306),  INT32_C(   192433688),  INT32_C(         188),  INT32_C(          28),  INT32_C(         322), -INT32_C(  1489628827),  INT32_C(         200),  INT32_C(          54),
+         INT32_C(         478),  INT32_C(         130),  INT32_C(         226), -INT32_C(   708028707),  INT32_C(   439471541),  INT32_C(   113338591),  INT32_C(         274), -INT32_C(  1532459508) } },
+    { {  INT32_C(    45115456),  INT32_C(   111356271),  INT32_C(  1619832759), -INT32_C(  1482201005), -INT32_C(  1984625176),  INT32_C(  1705253494),  INT32_C(  1914771035),  INT32_C(  2109385532),
+        -INT32_C(  2105578989),  INT32_C(  1267278483),  INT32_C(   631969233),  INT32_C(  1724666494), -INT32_C(   839876265), -INT32_C(   147680101), -INT32_C(   412527446),  INT32_C(   308552703) },
+      UINT16_C(58253),
+      {  INT32_C(         149),  INT32_C(          32),  INT32_C(           5),  INT32_C(          30),  INT32_C(         107),  INT32_C(         214),  INT32_C(          51),  INT32_C(          22),
+         INT32_C(         251),  INT32_C(         177),  INT32_C(         104),  INT32_C(         199),  INT32_C(          24),  INT32_C(         191),  INT32_C(          73),  INT32_C(           8) },
+      {  INT32_C(         298),  INT32_C(   111356271),  INT32_C(          10),  INT32_C(          60), -INT32_C(  1984625176),  INT32_C(  1705253494),  INT32_C(  1914771035),  INT32_C(          44),
+         INT32_C(         502),  INT32_C(         354),  INT32_C(   631969233),  INT32_C(  1724666494), -INT32_C(   839876265),  INT32_C(         382),  INT32_C(         146),  INT32_C(          16) } }
+  };
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = HEDLEY_STATIC_CAST(int32_t, i); }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i32gather_epi32(src, test_vec[i].k, vindex, HEDLEY_STATIC_CAST(const void*, i32_buffer), 8);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (size_t i = 0 ; i < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; i++) { i32_buffer[i] = HEDLEY_STATIC_CAST(int32_t, i); }
+
+  for (int i = 0; i < 8; i++) {
+    simde__m512i src = simde_test_x86_random_i32x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8())));
+    simde__m512i r = simde_mm512_mask_i32gather_epi32(src, k, vindex, i32_buffer, 8);
+
+    simde_test_x86_write_i32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 static int
 test_simde_mm512_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -820,6 +1157,9 @@ test_simde_mm512_mask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
 
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_epi32)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_epi32)
@@ -0,0 +1,1808 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN scatter
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/scatter.h>
+
+/* Indices are drawn from a small range so that most vectors contain
+ * duplicates; reading every index back afterwards checks that the
+ * highest lane wins. */
+static int32_t i32_buffer[32];
+static simde_float32 f32_buffer[32];
+static int64_t i64_buffer[32];
+static simde_float64 f64_buffer[32];
+
+static int
+test_simde_mm512_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(          29),  INT32_C(           7),  INT32_C(          27),  INT32_C(          17),  INT32_C(          20),  INT32_C(          13),  INT32_C(          28),  INT32_C(           5),
+         INT32_C(           4),  INT32_C(           7),  INT32_C(          22),  INT32_C(          11),  INT32_C(          20),  INT32_C(          16),  INT32_C(          14),  INT32_C(           3) },
+      { -INT32_C(   633040088), -INT32_C(   275856664), -INT32_C(  1725280129), -INT32_C(  1423143602), -INT32_C(  1445083084),  INT32_C(   432937237), -INT32_C(  1811659552), -INT32_C(   591859020),
+         INT32_C(  1857485958),  INT32_C(  1046365630), -INT32_C(   455636843),  INT32_C(  1250886422), -INT32_C(   520917813),  INT32_C(  1710866821), -INT32_C(  1174733563),  INT32_C(  1989522160) },
+      { -INT32_C(   633040088),  INT32_C(  1046365630), -INT32_C(  1725280129), -INT32_C(  1423143602), -INT32_C(   520917813),  INT32_C(   432937237), -INT32_C(  1811659552), -INT32_C(   591859020),
+         INT32_C(  1857485958),  INT32_C(  1046365630), -INT32_C(   455636843),  INT32_C(  1250886422), -INT32_C(   520917813),  INT32_C(  1710866821), -INT32_C(  1174733563),  INT32_C(  1989522160) } },
+    { {  INT32_C(          14),  INT32_C(          12),  INT32_C(           4),  INT32_C(          13),  INT32_C(          17),  INT32_C(           2),  INT32_C(          11),  INT32_C(           6),
+         INT32_C(          11),  INT32_C(           2),  INT32_C(          10),  INT32_C(           1),  INT32_C(           5),  INT32_C(          26),  INT32_C(          11),  INT32_C(          17) },
+      { -INT32_C(  1942937850), -INT32_C(   420402208),  INT32_C(   413133608),  INT32_C(  1284388253),  INT32_C(   314143617), -INT32_C(  2143787851),  INT32_C(  1801536486), -INT32_C(   474182179),
+        -INT32_C(  1938821460),  INT32_C(  1098015001), -INT32_C(   363195828), -INT32_C(   935925689),  INT32_C(   299560795),  INT32_C(   965808723),  INT32_C(   849670997),  INT32_C(   739664256) },
+      { -INT32_C(  1942937850), -INT32_C(   420402208),  INT32_C(   413133608),  INT32_C(  1284388253),  INT32_C(   739664256),  INT32_C(  1098015001),  INT32_C(   849670997), -INT32_C(   474182179),
+         INT32_C(   849670997),  INT32_C(  1098015001), -INT32_C(   363195828), -INT32_C(   935925689),  INT32_C(   299560795),  INT32_C(   965808723),  INT32_C(   849670997),  INT32_C(   739664256) } },
+    { {  INT32_C(          15),  INT32_C(           5),  INT32_C(          24),  INT32_C(           8),  INT32_C(           6),  INT32_C(          11),  INT32_C(           9),  INT32_C(          19),
+         INT32_C(          29),  INT32_C(           3),  INT32_C(          29),  INT32_C(           4),  INT32_C(          12),  INT32_C(          19),  INT32_C(          12),  INT32_C(           7) },
+      { -INT32_C(  1789385150), -INT32_C(  1899042248),  INT32_C(  1572893405),  INT32_C(   579458771),  INT32_C(  1116356956), -INT32_C(  1451936660),  INT32_C(   590189111),  INT32_C(   661354981),
+        -INT32_C(   658717793), -INT32_C(  1972991315), -INT32_C(   790157571),  INT32_C(  1509126397),  INT32_C(   513506738), -INT32_C(   372764239), -INT32_C(  1995639389),  INT32_C(   246445935) },
+      { -INT32_C(  1789385150), -INT32_C(  1899042248),  INT32_C(  1572893405),  INT32_C(   579458771),  INT32_C(  1116356956), -INT32_C(  1451936660),  INT32_C(   590189111), -INT32_C(   372764239),
+        -INT32_C(   790157571), -INT32_C(  1972991315), -INT32_C(   790157571),  INT32_C(  1509126397), -INT32_C(  1995639389), -INT32_C(   372764239), -INT32_C(  1995639389),  INT32_C(   246445935) } },
+    { {  INT32_C(          27),  INT32_C(          13),  INT32_C(           6),  INT32_C(           8),  INT32_C(          23),  INT32_C(          12),  INT32_C(          19),  INT32_C(          20),
+         INT32_C(          19),  INT32_C(          26),  INT32_C(           5),  INT32_C(          16),  INT32_C(          11),  INT32_C(          24),  INT32_C(           9),  INT32_C(          29) },
+      { -INT32_C(   409246667),  INT32_C(   433087349), -INT32_C(   928850855), -INT32_C(  1881779628), -INT32_C(  1216889409),  INT32_C(  2091641353),  INT32_C(   283930693),  INT32_C(  1586345256),
+        -INT32_C(  1891293158), -INT32_C(   441969268),  INT32_C(  1168984817),  INT32_C(  1557431197),  INT32_C(  1242778688),  INT32_C(  2076622646),  INT32_C(  1485550383), -INT32_C(  2101995416) },
+      { -INT32_C(   409246667),  INT32_C(   433087349), -INT32_C(   928850855), -INT32_C(  1881779628), -INT32_C(  1216889409),  INT32_C(  2091641353), -INT32_C(  1891293158),  INT32_C(  1586345256),
+        -INT32_C(  1891293158), -INT32_C(   441969268),  INT32_C(  1168984817),  INT32_C(  1557431197),  INT32_C(  1242778688),  INT32_C(  2076622646),  INT32_C(  1485550383), -INT32_C(  2101995416) } },
+    { {  INT32_C(           1),  INT32_C(          27),  INT32_C(          18),  INT32_C(          13),  INT32_C(          16),  INT32_C(          26),  INT32_C(          18),  INT32_C(           1),
+         INT32_C(           5),  INT32_C(          31),  INT32_C(           7),  INT32_C(           2),  INT32_C(           2),  INT32_C(          27),  INT32_C(          30),  INT32_C(           3) },
+      { -INT32_C(  1637019033),  INT32_C(     1651665),  INT32_C(  1331209702), -INT32_C(    19853635),  INT32_C(   432792329), -INT32_C(  1558479458), -INT32_C(  1085971748), -INT32_C(   438156419),
+         INT32_C(   646139733),  INT32_C(  1764203650), -INT32_C(     4686015), -INT32_C(  1744991858),  INT32_C(   196200813),  INT32_C(   598658118), -INT32_C(  1411189970), -INT32_C(  1936669642) },
+      { -INT32_C(   438156419),  INT32_C(   598658118), -INT32_C(  1085971748), -INT32_C(    19853635),  INT32_C(   432792329), -INT32_C(  1558479458), -INT32_C(  1085971748), -INT32_C(   438156419),
+         INT32_C(   646139733),  INT32_C(  1764203650), -INT32_C(     4686015),  INT32_C(   196200813),  INT32_C(   196200813),  INT32_C(   598658118), -INT32_C(  1411189970), -INT32_C(  1936669642) } },
+    { {  INT32_C(          19),  INT32_C(          19),  INT32_C(          18),  INT32_C(          21),  INT32_C(          16),  INT32_C(          25),  INT32_C(          30),  INT32_C(          17),
+         INT32_C(          25),  INT32_C(          22),  INT32_C(          16),  INT32_C(           7),  INT32_C(           0),  INT32_C(          14),  INT32_C(          30),  INT32_C(          13) },
+      { -INT32_C(    38260809),  INT32_C(   689989371), -INT32_C(  1881865639), -INT32_C(   652515898),  INT32_C(   695193209),  INT32_C(     1732007),  INT32_C(  1692863268), -INT32_C(  1341036807),
+        -INT32_C(  1850881643), -INT32_C(  2001023441), -INT32_C(  1760063536),  INT32_C(  1852847093), -INT32_C(  1466441983),  INT32_C(  1906946381), -INT32_C(  1244294980), -INT32_C(  1939478794) },
+      {  INT32_C(   689989371),  INT32_C(   689989371), -INT32_C(  1881865639), -INT32_C(   652515898), -INT32_C(  1760063536), -INT32_C(  1850881643), -INT32_C(  1244294980), -INT32_C(  1341036807),
+        -INT32_C(  1850881643), -INT32_C(  2001023441), -INT32_C(  1760063536),  INT32_C(  1852847093), -INT32_C(  1466441983),  INT32_C(  1906946381), -INT32_C(  1244294980), -INT32_C(  1939478794) } },
+    { {  INT32_C(          15),  INT32_C(          19),  INT32_C(          29),  INT32_C(          30),  INT32_C(           1),  INT32_C(          23),  INT32_C(           6),  INT32_C(          17),
+         INT32_C(           7),  INT32_C(          29),  INT32_C(           8),  INT32_C(          28),  INT32_C(          16),  INT32_C(          25),  INT32_C(          10),  INT32_C(          17) },
+      { -INT32_C(   447061608), -INT32_C(   816446702), -INT32_C(  1971049581), -INT32_C(  1072240111), -INT32_C(   560057347),  INT32_C(  1905198090),  INT32_C(   852351106),  INT32_C(   702846865),
+         INT32_C(   185548536), -INT32_C(   723884735), -INT32_C(  1570873711),  INT32_C(  1164145736), -INT32_C(  1306328665), -INT32_C(  2010926330),  INT32_C(   482013579), -INT32_C(  2126143864) },
+      { -INT32_C(   447061608), -INT32_C(   816446702), -INT32_C(   723884735), -INT32_C(  1072240111), -INT32_C(   560057347),  INT32_C(  1905198090),  INT32_C(   852351106), -INT32_C(  2126143864),
+         INT32_C(   185548536), -INT32_C(   723884735), -INT32_C(  1570873711),  INT32_C(  1164145736), -INT32_C(  1306328665), -INT32_C(  2010926330),  INT32_C(   482013579), -INT32_C(  2126143864) } },
+    { {  INT32_C(          28),  INT32_C(          20),  INT32_C(          12),  INT32_C(          29),  INT32_C(          26),  INT32_C(           6),  INT32_C(          18),  INT32_C(          11),
+         INT32_C(           4),  INT32_C(          16),  INT32_C(          13),  INT32_C(          13),  INT32_C(           5),  INT32_C(          16),  INT32_C(          18),  INT32_C(          12) },
+      {  INT32_C(  1478391378), -INT32_C(  1260371415), -INT32_C(  1143956941),  INT32_C(   356259129),  INT32_C(   607373418), -INT32_C(   210819794),  INT32_C(   973102197), -INT32_C(     5811539),
+        -INT32_C(   245905976),  INT32_C(   983906055),  INT32_C(   183924177), -INT32_C(   182439285),  INT32_C(   689525755), -INT32_C(   316897160), -INT32_C(  1859642140),  INT32_C(   932237167) },
+      {  INT32_C(  1478391378), -INT32_C(  1260371415),  INT32_C(   932237167),  INT32_C(   356259129),  INT32_C(   607373418), -INT32_C(   210819794), -INT32_C(  1859642140), -INT32_C(     5811539),
+        -INT32_C(   245905976), -INT32_C(   316897160), -INT32_C(   182439285), -INT32_C(   182439285),  INT32_C(   689525755), -INT32_C(   316897160), -INT32_C(  1859642140),  INT32_C(   932237167) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde_mm512_i32scatter_epi32(HEDLEY_STATIC_CAST(void*, i32_buffer), vindex, a, 4);
+
+    int32_t rv[16];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[test_vec[i].vindex[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi32(rv);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512i a = simde_test_x86_random_i32x16();
+    simde_mm512_i32scatter_epi32(i32_buffer, vindex, a, 4);
+
+    int32_t vi[16];
+    int32_t rv[16];
+    simde_mm512_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[vi[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi32(rv);
+
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(59284),
+      {  INT32_C(           9),  INT32_C(          28),  INT32_C(          30),  INT32_C(          14),  INT32_C(          22),  INT32_C(          16),  INT32_C(           4),  INT32_C(          12),
+         INT32_C(          26),  INT32_C(          15),  INT32_C(          31),  INT32_C(          26),  INT32_C(           4),  INT32_C(          26),  INT32_C(          13),  INT32_C(          29) },
+      {  INT32_C(  1080419619), -INT32_C(    77837869),  INT32_C(  1808452571),  INT32_C(   743661059), -INT32_C(   772115974),  INT32_C(  1553808993), -INT32_C(   780755955), -INT32_C(  1162943338),
+        -INT32_C(  1661332535),  INT32_C(   949442141),  INT32_C(   631464226), -INT32_C(  1169033536), -INT32_C(   913618072), -INT32_C(  1759172214),  INT32_C(  1550425285),  INT32_C(  1226184576) },
+      {  INT32_C(           9),  INT32_C(          28),  INT32_C(  1808452571),  INT32_C(          14), -INT32_C(   772115974),  INT32_C(          16),  INT32_C(           4), -INT32_C(  1162943338),
+        -INT32_C(  1759172214),  INT32_C(   949442141),  INT32_C(   631464226), -INT32_C(  1759172214),  INT32_C(           4), -INT32_C(  1759172214),  INT32_C(  1550425285),  INT32_C(  1226184576) } },
+    { UINT16_C( 4139),
+      {  INT32_C(           6),  INT32_C(           8),  INT32_C(           6),  INT32_C(          29),  INT32_C(           0),  INT32_C(           8),  INT32_C(          31),  INT32_C(           3),
+         INT32_C(          13),  INT32_C(          31),  INT32_C(          26),  INT32_C(          30),  INT32_C(          25),  INT32_C(           2),  INT32_C(          10),  INT32_C(           5) },
+      { -INT32_C(  1324428149), -INT32_C(   733097109),  INT32_C(  1173146927), -INT32_C(    61532394),  INT32_C(  1601879199), -INT32_C(   222144188),  INT32_C(  1374690552),  INT32_C(  1781938910),
+         INT32_C(  2048607246),  INT32_C(  1196320792),  INT32_C(  1267546677), -INT32_C(   263658927), -INT32_C(   481312098),  INT32_C(   332730907),  INT32_C(   224707886),  INT32_C(   242719488) },
+      { -INT32_C(  1324428149), -INT32_C(   222144188), -INT32_C(  1324428149), -INT32_C(    61532394),  INT32_C(           0), -INT32_C(   222144188),  INT32_C(          31),  INT32_C(           3),
+         INT32_C(          13),  INT32_C(          31),  INT32_C(          26),  INT32_C(          30), -INT32_C(   481312098),  INT32_C(           2),  INT32_C(          10),  INT32_C(           5) } },
+    { UINT16_C(37599),
+      {  INT32_C(           8),  INT32_C(          23),  INT32_C(          26),  INT32_C(          23),  INT32_C(          31),  INT32_C(          15),  INT32_C(          17),  INT32_C(          12),
+         INT32_C(          26),  INT32_C(           3),  INT32_C(          14),  INT32_C(           2),  INT32_C(          19),  INT32_C(          13),  INT32_C(           4),  INT32_C(           3) },
+      {  INT32_C(    95788848),  INT32_C(   399172530),  INT32_C(  1739770608),  INT32_C(  1643745753), -INT32_C(   935791735), -INT32_C(  1651226078),  INT32_C(     6242989), -INT32_C(  1079778161),
+         INT32_C(   918837379),  INT32_C(   743280444),  INT32_C(   848625497),  INT32_C(   429165968), -INT32_C(  1545483135), -INT32_C(  1019185898),  INT32_C(  1204068536),  INT32_C(   117925764) },
+      {  INT32_C(    95788848),  INT32_C(  1643745753),  INT32_C(  1739770608),  INT32_C(  1643745753), -INT32_C(   935791735),  INT32_C(          15),  INT32_C(     6242989), -INT32_C(  1079778161),
+         INT32_C(  1739770608),  INT32_C(   117925764),  INT32_C(          14),  INT32_C(           2), -INT32_C(  1545483135),  INT32_C(          13),  INT32_C(           4),  INT32_C(   117925764) } },
+    { UINT16_C(52160),
+      {  INT32_C(          29),  INT32_C(          28),  INT32_C(          26),  INT32_C(          10),  INT32_C(           8),  INT32_C(          20),  INT32_C(           9),  INT32_C(          28),
+         INT32_C(           6),  INT32_C(          26),  INT32_C(          10),  INT32_C(          26),  INT32_C(          19),  INT32_C(          11),  INT32_C(           7),  INT32_C(          21) },
+      { -INT32_C(  1349886610), -INT32_C(   447790559), -INT32_C(  1857236086),  INT32_C(   408685786),  INT32_C(   832747272),  INT32_C(  1374497899),  INT32_C(  2043426630),  INT32_C(  1905136386),
+        -INT32_C(  1860167312), -INT32_C(   445223077),  INT32_C(   477545282), -INT32_C(   667626545), -INT32_C(   183904374),  INT32_C(  1229387267),  INT32_C(   818025006), -INT32_C(  1767812827) },
+      {  INT32_C(          29),  INT32_C(  1905136386), -INT32_C(   667626545),  INT32_C(          10),  INT32_C(           8),  INT32_C(          20),  INT32_C(  2043426630),  INT32_C(  1905136386),
+        -INT32_C(  1860167312), -INT32_C(   667626545),  INT32_C(          10), -INT32_C(   667626545),  INT32_C(          19),  INT32_C(          11),  INT32_C(   818025006), -INT32_C(  1767812827) } },
+    { UINT16_C(49514),
+      {  INT32_C(           7),  INT32_C(           5),  INT32_C(          16),  INT32_C(          30),  INT32_C(          11),  INT32_C(          18),  INT32_C(           1),  INT32_C(           1),
+         INT32_C(          15),  INT32_C(          16),  INT32_C(          20),  INT32_C(           3),  INT32_C(           8),  INT32_C(          30),  INT32_C(          26),  INT32_C(          17) },
+      { -INT32_C(  1173840525), -INT32_C(  1446234394),  INT32_C(   150663782), -INT32_C(  1345756024), -INT32_C(   733087191), -INT32_C(    67719572), -INT32_C(   406852897), -INT32_C(   587638423),
+        -INT32_C(   577371657), -INT32_C(  1652137161), -INT32_C(   576356267),  INT32_C(   244084708), -INT32_C(   706553239),  INT32_C(  1741805704),  INT32_C(   743411907), -INT32_C(   536327959) },
+      {  INT32_C(           7), -INT32_C(  1446234394),  INT32_C(          16), -INT32_C(  1345756024),  INT32_C(          11), -INT32_C(    67719572), -INT32_C(   406852897), -INT32_C(   406852897),
+        -INT32_C(   577371657),  INT32_C(          16),  INT32_C(          20),  INT32_C(           3),  INT32_C(           8), -INT32_C(  1345756024),  INT32_C(   743411907), -INT32_C(   536327959) } },
+    { UINT16_C(40777),
+      {  INT32_C(          30),  INT32_C(           0),  INT32_C(           2),  INT32_C(           4),  INT32_C(          29),  INT32_C(          23),  INT32_C(           5),  INT32_C(           3),
+         INT32_C(          20),  INT32_C(           9),  INT32_C(          18),  INT32_C(           0),  INT32_C(          23),  INT32_C(          27),  INT32_C(          26),  INT32_C(          26) },
+      {  INT32_C(  1097999216), -INT32_C(   640600694),  INT32_C(  1780595553),  INT32_C(  1493789339),  INT32_C(   144575466), -INT32_C(  1765055646), -INT32_C(  1000932084),  INT32_C(   140439960),
+        -INT32_C(  1639264236),  INT32_C(  1735924486),  INT32_C(  1926339030), -INT32_C(   288630268),  INT32_C(  1207331301), -INT32_C(   639778356),  INT32_C(  1453143230),  INT32_C(   962591525) },
+      {  INT32_C(  1097999216), -INT32_C(   288630268),  INT32_C(           2),  INT32_C(  1493789339),  INT32_C(          29),  INT32_C(  1207331301), -INT32_C(  1000932084),  INT32_C(           3),
+        -INT32_C(  1639264236),  INT32_C(  1735924486),  INT32_C(  1926339030), -INT32_C(   288630268),  INT32_C(  1207331301),  INT32_C(          27),  INT32_C(   962591525),  INT32_C(   962591525) } },
+    { UINT16_C(43467),
+      {  INT32_C(          23),  INT32_C(          17),  INT32_C(           4),  INT32_C(          15),  INT32_C(          25),  INT32_C(          27),  INT32_C(           9),  INT32_C(          10),
+         INT32_C(          13),  INT32_C(          13),  INT32_C(           5),  INT32_C(          24),  INT32_C(          27),  INT32_C(          10),  INT32_C(           2),  INT32_C(          18) },
+      { -INT32_C(   275575278), -INT32_C(  2078059801),  INT32_C(   125782184),  INT32_C(  1504725889),  INT32_C(  1437103388),  INT32_C(   492867856),  INT32_C(  1526023550),  INT32_C(   556545807),
+         INT32_C(   756137798), -INT32_C(  1162726383), -INT32_C(    20893315), -INT32_C(  1722322308), -INT32_C(   135397145),  INT32_C(   269766289), -INT32_C(  1553331821), -INT32_C(  2017159615) },
+      { -INT32_C(   275575278), -INT32_C(  2078059801),  INT32_C(           4),  INT32_C(  1504725889),  INT32_C(          25),  INT32_C(          27),  INT32_C(  1526023550),  INT32_C(   269766289),
+         INT32_C(   756137798),  INT32_C(   756137798),  INT32_C(           5), -INT32_C(  1722322308),  INT32_C(          27),  INT32_C(   269766289),  INT32_C(           2), -INT32_C(  2017159615) } },
+    { UINT16_C(54613),
+      {  INT32_C(          20),  INT32_C(           7),  INT32_C(          10),  INT32_C(           6),  INT32_C(           1),  INT32_C(           7),  INT32_C(          24),  INT32_C(           2),
+         INT32_C(           5),  INT32_C(          20),  INT32_C(          20),  INT32_C(          29),  INT32_C(          13),  INT32_C(          27),  INT32_C(          29),  INT32_C(          28) },
+      {  INT32_C(  1189768754), -INT32_C(   397377922), -INT32_C(   444690143), -INT32_C(   860105704),  INT32_C(  1546896699), -INT32_C(   784413876), -INT32_C(  1917938721),  INT32_C(    19499982),
+         INT32_C(  2017924090), -INT32_C(  1302227055),  INT32_C(  1083760424), -INT32_C(   301116493),  INT32_C(  1682587672), -INT32_C(   365590261), -INT32_C(   361241572),  INT32_C(  1777049711) },
+      {  INT32_C(  1083760424),  INT32_C(           7), -INT32_C(   444690143),  INT32_C(           6),  INT32_C(  1546896699),  INT32_C(           7), -INT32_C(  1917938721),  INT32_C(           2),
+         INT32_C(  2017924090),  INT32_C(  1083760424),  INT32_C(  1083760424), -INT32_C(   361241572),  INT32_C(  1682587672),  INT32_C(          27), -INT32_C(   361241572),  INT32_C(  1777049711) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde_mm512_mask_i32scatter_epi32(HEDLEY_STATIC_CAST(void*, i32_buffer), test_vec[i].k, vindex, a, 4);
+
+    int32_t rv[16];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[test_vec[i].vindex[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi32(rv);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512i a = simde_test_x86_random_i32x16();
+    simde_mm512_mask_i32scatter_epi32(i32_buffer, k, vindex, a, 4);
+
+    int32_t vi[16];
+    int32_t rv[16];
+    simde_mm512_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[vi[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi32(rv);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { {  INT32_C(          20),  INT32_C(          19),  INT32_C(           2),  INT32_C(           5),  INT32_C(          10),  INT32_C(           3),  INT32_C(          24),  INT32_C(          19),
+         INT32_C(           2),  INT32_C(          16),  INT32_C(          19),  INT32_C(          22),  INT32_C(           3),  INT32_C(           0),  INT32_C(           4),  INT32_C(          27) },
+      { SIMDE_FLOAT32_C(   431.75), SIMDE_FLOAT32_C(  -343.40), SIMDE_FLOAT32_C(   202.75), SIMDE_FLOAT32_C(   632.72),
+        SIMDE_FLOAT32_C(  -445.11), SIMDE_FLOAT32_C(   352.04), SIMDE_FLOAT32_C(  -951.91), SIMDE_FLOAT32_C(   225.92),
+        SIMDE_FLOAT32_C(  -748.82), SIMDE_FLOAT32_C(   262.63), SIMDE_FLOAT32_C(   934.46), SIMDE_FLOAT32_C(   930.74),
+        SIMDE_FLOAT32_C(    -6.83), SIMDE_FLOAT32_C(  -245.98), SIMDE_FLOAT32_C(  -872.59), SIMDE_FLOAT32_C(  -152.86) },
+      { SIMDE_FLOAT32_C(   431.75), SIMDE_FLOAT32_C(   934.46), SIMDE_FLOAT32_C(  -748.82), SIMDE_FLOAT32_C(   632.72),
+        SIMDE_FLOAT32_C(  -445.11), SIMDE_FLOAT32_C(    -6.83), SIMDE_FLOAT32_C(  -951.91), SIMDE_FLOAT32_C(   934.46),
+        SIMDE_FLOAT32_C(  -748.82), SIMDE_FLOAT32_C(   262.63), SIMDE_FLOAT32_C(   934.46), SIMDE_FLOAT32_C(   930.74),
+        SIMDE_FLOAT32_C(    -6.83), SIMDE_FLOAT32_C(  -245.98), SIMDE_FLOAT32_C(  -872.59), SIMDE_FLOAT32_C(  -152.86) } },
+    { {  INT32_C(          29),  INT32_C(          19),  INT32_C(           7),  INT32_C(           7),  INT32_C(          22),  INT32_C(          31),  INT32_C(          26),  INT32_C(          25),
+         INT32_C(          15),  INT32_C(          14),  INT32_C(          15),  INT32_C(          18),  INT32_C(          14),  INT32_C(          19),  INT32_C(          13),  INT32_C(          15) },
+      { SIMDE_FLOAT32_C(   718.40), SIMDE_FLOAT32_C(    94.78), SIMDE_FLOAT32_C(  -566.11), SIMDE_FLOAT32_C(  -726.71),
+        SIMDE_FLOAT32_C(  -553.18), SIMDE_FLOAT32_C(  -518.02), SIMDE_FLOAT32_C(   499.22), SIMDE_FLOAT32_C(  -302.00),
+        SIMDE_FLOAT32_C(   744.61), SIMDE_FLOAT32_C(   433.68), SIMDE_FLOAT32_C(  -371.26), SIMDE_FLOAT32_C(  -262.21),
+        SIMDE_FLOAT32_C(  -812.31), SIMDE_FLOAT32_C(  -243.85), SIMDE_FLOAT32_C(   584.92), SIMDE_FLOAT32_C(  -721.26) },
+      { SIMDE_FLOAT32_C(   718.40), SIMDE_FLOAT32_C(  -243.85), SIMDE_FLOAT32_C(  -726.71), SIMDE_FLOAT32_C(  -726.71),
+        SIMDE_FLOAT32_C(  -553.18), SIMDE_FLOAT32_C(  -518.02), SIMDE_FLOAT32_C(   499.22), SIMDE_FLOAT32_C(  -302.00),
+        SIMDE_FLOAT32_C(  -721.26), SIMDE_FLOAT32_C(  -812.31), SIMDE_FLOAT32_C(  -721.26), SIMDE_FLOAT32_C(  -262.21),
+        SIMDE_FLOAT32_C(  -812.31), SIMDE_FLOAT32_C(  -243.85), SIMDE_FLOAT32_C(   584.92), SIMDE_FLOAT32_C(  -721.26) } },
+    { {  INT32_C(           6),  INT32_C(          21),  INT32_C(          27),  INT32_C(          29),  INT32_C(          21),  INT32_C(          22),  INT32_C(          22),  INT32_C(           4),
+         INT32_C(           4),  INT32_C(           5),  INT32_C(          23),  INT32_C(          18),  INT32_C(          24),  INT32_C(           4),  INT32_C(           1),  INT32_C(          27) },
+      { SIMDE_FLOAT32_C(   -55.51), SIMDE_FLOAT32_C(   340.74), SIMDE_FLOAT32_C(  -903.60), SIMDE_FLOAT32_C(   391.31),
+        SIMDE_FLOAT32_C(   822.72), SIMDE_FLOAT32_C(   595.61), SIMDE_FLOAT32_C(  -910.69), SIMDE_FLOAT32_C(   567.33),
+        SIMDE_FLOAT32_C(    29.29), SIMDE_FLOAT32_C(  -281.95), SIMDE_FLOAT32_C(  -694.88), SIMDE_FLOAT32_C(   216.98),
+        SIMDE_FLOAT32_C(   474.20), SIMDE_FLOAT32_C(   890.04), SIMDE_FLOAT32_C(   495.73), SIMDE_FLOAT32_C(   794.68) },
+      { SIMDE_FLOAT32_C(   -55.51), SIMDE_FLOAT32_C(   822.72), SIMDE_FLOAT32_C(   794.68), SIMDE_FLOAT32_C(   391.31),
+        SIMDE_FLOAT32_C(   822.72), SIMDE_FLOAT32_C(  -910.69), SIMDE_FLOAT32_C(  -910.69), SIMDE_FLOAT32_C(   890.04),
+        SIMDE_FLOAT32_C(   890.04), SIMDE_FLOAT32_C(  -281.95), SIMDE_FLOAT32_C(  -694.88), SIMDE_FLOAT32_C(   216.98),
+        SIMDE_FLOAT32_C(   474.20), SIMDE_FLOAT32_C(   890.04), SIMDE_FLOAT32_C(   495.73), SIMDE_FLOAT32_C(   794.68) } },
+    { {  INT32_C(          26),  INT32_C(          23),  INT32_C(           3),  INT32_C(          15),  INT32_C(          13),  INT32_C(          25),  INT32_C(          19),  INT32_C(          17),
+         INT32_C(          30),  INT32_C(          10),  INT32_C(           4),  INT32_C(          23),  INT32_C(          15),  INT32_C(           5),  INT32_C(          18),  INT32_C(           0) },
+      { SIMDE_FLOAT32_C(    70.12), SIMDE_FLOAT32_C(  -778.94), SIMDE_FLOAT32_C(  -996.36), SIMDE_FLOAT32_C(  -107.16),
+        SIMDE_FLOAT32_C(   816.67), SIMDE_FLOAT32_C(  -907.05), SIMDE_FLOAT32_C(  -539.83), SIMDE_FLOAT32_C(  -154.04),
+        SIMDE_FLOAT32_C(  -189.00), SIMDE_FLOAT32_C(  -234.71), SIMDE_FLOAT32_C(  -937.05), SIMDE_FLOAT32_C(  -714.80),
+        SIMDE_FLOAT32_C(  -344.67), SIMDE_FLOAT32_C(   558.68), SIMDE_FLOAT32_C(  -920.12), SIMDE_FLOAT32_C(   549.71) },
+      { SIMDE_FLOAT32_C(    70.12), SIMDE_FLOAT32_C(  -714.80), SIMDE_FLOAT32_C(  -996.36), SIMDE_FLOAT32_C(  -344.67),
+        SIMDE_FLOAT32_C(   816.67), SIMDE_FLOAT32_C(  -907.05), SIMDE_FLOAT32_C(  -539.83), SIMDE_FLOAT32_C(  -154.04),
+        SIMDE_FLOAT32_C(  -189.00), SIMDE_FLOAT32_C(  -234.71), SIMDE_FLOAT32_C(  -937.05), SIMDE_FLOAT32_C(  -714.80),
+        SIMDE_FLOAT32_C(  -344.67), SIMDE_FLOAT32_C(   558.68), SIMDE_FLOAT32_C(  -920.12), SIMDE_FLOAT32_C(   549.71) } },
+    { {  INT32_C(          24),  INT32_C(          20),  INT32_C(          28),  INT32_C(           5),  INT32_C(          14),  INT32_C(          16),  INT32_C(          23),  INT32_C(          12),
+         INT32_C(          26),  INT32_C(          27),  INT32_C(           3),  INT32_C(           9),  INT32_C(           0),  INT32_C(          21),  INT32_C(           9),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(   341.20), SIMDE_FLOAT32_C(  -901.19), SIMDE_FLOAT32_C(  -236.66), SIMDE_FLOAT32_C(   157.87),
+        SIMDE_FLOAT32_C(  -808.24), SIMDE_FLOAT32_C(   223.51), SIMDE_FLOAT32_C(  -996.16), SIMDE_FLOAT32_C(     2.76),
+        SIMDE_FLOAT32_C(   988.80), SIMDE_FLOAT32_C(  -933.21), SIMDE_FLOAT32_C(   287.96), SIMDE_FLOAT32_C(  -355.87),
+        SIMDE_FLOAT32_C(   625.46), SIMDE_FLOAT32_C(   367.84), SIMDE_FLOAT32_C(  -806.17), SIMDE_FLOAT32_C(   176.51) },
+      { SIMDE_FLOAT32_C(   341.20), SIMDE_FLOAT32_C(  -901.19), SIMDE_FLOAT32_C(  -236.66), SIMDE_FLOAT32_C(   157.87),
+        SIMDE_FLOAT32_C(  -808.24), SIMDE_FLOAT32_C(   223.51), SIMDE_FLOAT32_C(  -996.16), SIMDE_FLOAT32_C(     2.76),
+        SIMDE_FLOAT32_C(   988.80), SIMDE_FLOAT32_C(  -933.21), SIMDE_FLOAT32_C(   287.96), SIMDE_FLOAT32_C(  -806.17),
+        SIMDE_FLOAT32_C(   625.46), SIMDE_FLOAT32_C(   367.84), SIMDE_FLOAT32_C(  -806.17), SIMDE_FLOAT32_C(   176.51) } },
+    { {  INT32_C(          19),  INT32_C(          21),  INT32_C(           7),  INT32_C(           1),  INT32_C(           5),  INT32_C(          30),  INT32_C(          14),  INT32_C(          31),
+         INT32_C(          25),  INT32_C(          17),  INT32_C(           9),  INT32_C(          26),  INT32_C(           7),  INT32_C(          18),  INT32_C(          28),  INT32_C(           4) },
+      { SIMDE_FLOAT32_C(   819.01), SIMDE_FLOAT32_C(   461.88), SIMDE_FLOAT32_C(  -483.32), SIMDE_FLOAT32_C(  -989.23),
+        SIMDE_FLOAT32_C(  -314.61), SIMDE_FLOAT32_C(  -479.48), SIMDE_FLOAT32_C(    13.52), SIMDE_FLOAT32_C(  -325.82),
+        SIMDE_FLOAT32_C(  -412.70), SIMDE_FLOAT32_C(  -698.52), SIMDE_FLOAT32_C(   318.31), SIMDE_FLOAT32_C(  -787.23),
+        SIMDE_FLOAT32_C(   669.32), SIMDE_FLOAT32_C(   512.14), SIMDE_FLOAT32_C(   389.27), SIMDE_FLOAT32_C(  -619.70) },
+      { SIMDE_FLOAT32_C(   819.01), SIMDE_FLOAT32_C(   461.88), SIMDE_FLOAT32_C(   669.32), SIMDE_FLOAT32_C(  -989.23),
+        SIMDE_FLOAT32_C(  -314.61), SIMDE_FLOAT32_C(  -479.48), SIMDE_FLOAT32_C(    13.52), SIMDE_FLOAT32_C(  -325.82),
+        SIMDE_FLOAT32_C(  -412.70), SIMDE_FLOAT32_C(  -698.52), SIMDE_FLOAT32_C(   318.31), SIMDE_FLOAT32_C(  -787.23),
+        SIMDE_FLOAT32_C(   669.32), SIMDE_FLOAT32_C(   512.14), SIMDE_FLOAT32_C(   389.27), SIMDE_FLOAT32_C(  -619.70) } },
+    { {  INT32_C(           4),  INT32_C(          14),  INT32_C(          12),  INT32_C(           9),  INT32_C(          13),  INT32_C(          26),  INT32_C(           9),  INT32_C(           6),
+         INT32_C(          12),  INT32_C(          18),  INT32_C(           0),  INT32_C(          19),  INT32_C(           4),  INT32_C(          28),  INT32_C(          23),  INT32_C(          18) },
+      { SIMDE_FLOAT32_C(  -929.82), SIMDE_FLOAT32_C(  -719.11), SIMDE_FLOAT32_C(   486.76), SIMDE_FLOAT32_C(  -244.44),
+        SIMDE_FLOAT32_C(  -198.59), SIMDE_FLOAT32_C(  -499.71), SIMDE_FLOAT32_C(   429.75), SIMDE_FLOAT32_C(   388.71),
+        SIMDE_FLOAT32_C(  -198.23), SIMDE_FLOAT32_C(  -251.94), SIMDE_FLOAT32_C(   601.48), SIMDE_FLOAT32_C(  -528.91),
+        SIMDE_FLOAT32_C(  -739.80), SIMDE_FLOAT32_C(    -9.25), SIMDE_FLOAT32_C(  -148.60), SIMDE_FLOAT32_C(  -897.38) },
+      { SIMDE_FLOAT32_C(  -739.80), SIMDE_FLOAT32_C(  -719.11), SIMDE_FLOAT32_C(  -198.23), SIMDE_FLOAT32_C(   429.75),
+        SIMDE_FLOAT32_C(  -198.59), SIMDE_FLOAT32_C(  -499.71), SIMDE_FLOAT32_C(   429.75), SIMDE_FLOAT32_C(   388.71),
+        SIMDE_FLOAT32_C(  -198.23), SIMDE_FLOAT32_C(  -897.38), SIMDE_FLOAT32_C(   601.48), SIMDE_FLOAT32_C(  -528.91),
+        SIMDE_FLOAT32_C(  -739.80), SIMDE_FLOAT32_C(    -9.25), SIMDE_FLOAT32_C(  -148.60), SIMDE_FLOAT32_C(  -897.38) } },
+    { {  INT32_C(          10),  INT32_C(          11),  INT32_C(          29),  INT32_C(          23),  INT32_C(           6),  INT32_C(           6),  INT32_C(          30),  INT32_C(          18),
+         INT32_C(          24),  INT32_C(          30),  INT32_C(           5),  INT32_C(          29),  INT32_C(          27),  INT32_C(          28),  INT32_C(          15),  INT32_C(           3) },
+      { SIMDE_FLOAT32_C(  -231.58), SIMDE_FLOAT32_C(   140.53), SIMDE_FLOAT32_C(  -432.26), SIMDE_FLOAT32_C(   569.82),
+        SIMDE_FLOAT32_C(   640.82), SIMDE_FLOAT32_C(   997.49), SIMDE_FLOAT32_C(   -41.46), SIMDE_FLOAT32_C(  -557.41),
+        SIMDE_FLOAT32_C(  -254.46), SIMDE_FLOAT32_C(  -439.99), SIMDE_FLOAT32_C(   -86.32), SIMDE_FLOAT32_C(     5.74),
+        SIMDE_FLOAT32_C(   550.77), SIMDE_FLOAT32_C(   765.08), SIMDE_FLOAT32_C(   108.36), SIMDE_FLOAT32_C(  -361.06) },
+      { SIMDE_FLOAT32_C(  -231.58), SIMDE_FLOAT32_C(   140.53), SIMDE_FLOAT32_C(     5.74), SIMDE_FLOAT32_C(   569.82),
+        SIMDE_FLOAT32_C(   997.49), SIMDE_FLOAT32_C(   997.49), SIMDE_FLOAT32_C(  -439.99), SIMDE_FLOAT32_C(  -557.41),
+        SIMDE_FLOAT32_C(  -254.46), SIMDE_FLOAT32_C(  -439.99), SIMDE_FLOAT32_C(   -86.32), SIMDE_FLOAT32_C(     5.74),
+        SIMDE_FLOAT32_C(   550.77), SIMDE_FLOAT32_C(   765.08), SIMDE_FLOAT32_C(   108.36), SIMDE_FLOAT32_C(  -361.06) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_mm512_i32scatter_ps(HEDLEY_STATIC_CAST(void*, f32_buffer), vindex, a, 4);
+
+    simde_float32 rv[16];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[test_vec[i].vindex[j]]; }
+    simde__m512 r = simde_mm512_loadu_ps(rv);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_mm512_i32scatter_ps(f32_buffer, vindex, a, 4);
+
+    int32_t vi[16];
+    simde_float32 rv[16];
+    simde_mm512_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[vi[j]]; }
+    simde__m512 r = simde_mm512_loadu_ps(rv);
+
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(19048),
+      {  INT32_C(          23),  INT32_C(          14),  INT32_C(          17),  INT32_C(          21),  INT32_C(           0),  INT32_C(           9),  INT32_C(          20),  INT32_C(           5),
+         INT32_C(           6),  INT32_C(          15),  INT32_C(           1),  INT32_C(          22),  INT32_C(          18),  INT32_C(           0),  INT32_C(          31),  INT32_C(          19) },
+      { SIMDE_FLOAT32_C(  -998.08), SIMDE_FLOAT32_C(    98.22), SIMDE_FLOAT32_C(   258.26), SIMDE_FLOAT32_C(   -39.54),
+        SIMDE_FLOAT32_C(   540.81), SIMDE_FLOAT32_C(  -996.19), SIMDE_FLOAT32_C(   520.47), SIMDE_FLOAT32_C(  -545.50),
+        SIMDE_FLOAT32_C(     9.55), SIMDE_FLOAT32_C(    71.24), SIMDE_FLOAT32_C(  -780.42), SIMDE_FLOAT32_C(  -882.09),
+        SIMDE_FLOAT32_C(   710.18), SIMDE_FLOAT32_C(  -575.58), SIMDE_FLOAT32_C(   498.49), SIMDE_FLOAT32_C(  -508.63) },
+      { SIMDE_FLOAT32_C(    23.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(   -39.54),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -996.19), SIMDE_FLOAT32_C(   520.47), SIMDE_FLOAT32_C(     5.00),
+        SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(    71.24), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -882.09),
+        SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   498.49), SIMDE_FLOAT32_C(    19.00) } },
+    { UINT16_C(18341),
+      {  INT32_C(          21),  INT32_C(           5),  INT32_C(          17),  INT32_C(           9),  INT32_C(          10),  INT32_C(          23),  INT32_C(          24),  INT32_C(          11),
+         INT32_C(          13),  INT32_C(          11),  INT32_C(          12),  INT32_C(          12),  INT32_C(          30),  INT32_C(           1),  INT32_C(          24),  INT32_C(          26) },
+      { SIMDE_FLOAT32_C(   246.51), SIMDE_FLOAT32_C(    24.80), SIMDE_FLOAT32_C(   732.08), SIMDE_FLOAT32_C(  -233.01),
+        SIMDE_FLOAT32_C(   479.30), SIMDE_FLOAT32_C(  -258.37), SIMDE_FLOAT32_C(   838.23), SIMDE_FLOAT32_C(   698.87),
+        SIMDE_FLOAT32_C(  -140.46), SIMDE_FLOAT32_C(   548.41), SIMDE_FLOAT32_C(  -876.71), SIMDE_FLOAT32_C(  -641.97),
+        SIMDE_FLOAT32_C(  -960.22), SIMDE_FLOAT32_C(  -317.36), SIMDE_FLOAT32_C(   821.07), SIMDE_FLOAT32_C(  -463.72) },
+      { SIMDE_FLOAT32_C(   246.51), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   732.08), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(  -258.37), SIMDE_FLOAT32_C(   821.07), SIMDE_FLOAT32_C(   548.41),
+        SIMDE_FLOAT32_C(  -140.46), SIMDE_FLOAT32_C(   548.41), SIMDE_FLOAT32_C(  -876.71), SIMDE_FLOAT32_C(  -876.71),
+        SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   821.07), SIMDE_FLOAT32_C(    26.00) } },
+    { UINT16_C(15027),
+      {  INT32_C(          29),  INT32_C(          29),  INT32_C(          18),  INT32_C(          22),  INT32_C(           9),  INT32_C(          31),  INT32_C(           1),  INT32_C(          21),
+         INT32_C(          12),  INT32_C(          31),  INT32_C(          22),  INT32_C(           4),  INT32_C(          25),  INT32_C(          16),  INT32_C(          18),  INT32_C(          26) },
+      { SIMDE_FLOAT32_C(  -681.10), SIMDE_FLOAT32_C(   683.14), SIMDE_FLOAT32_C(  -430.95), SIMDE_FLOAT32_C(  -842.87),
+        SIMDE_FLOAT32_C(   382.02), SIMDE_FLOAT32_C(   428.60), SIMDE_FLOAT32_C(   705.54), SIMDE_FLOAT32_C(   505.31),
+        SIMDE_FLOAT32_C(   786.62), SIMDE_FLOAT32_C(   745.31), SIMDE_FLOAT32_C(  -812.05), SIMDE_FLOAT32_C(   607.70),
+        SIMDE_FLOAT32_C(  -718.41), SIMDE_FLOAT32_C(   882.79), SIMDE_FLOAT32_C(   377.16), SIMDE_FLOAT32_C(  -546.78) },
+      { SIMDE_FLOAT32_C(   683.14), SIMDE_FLOAT32_C(   683.14), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    22.00),
+        SIMDE_FLOAT32_C(   382.02), SIMDE_FLOAT32_C(   745.31), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   505.31),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(   745.31), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(   607.70),
+        SIMDE_FLOAT32_C(  -718.41), SIMDE_FLOAT32_C(   882.79), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    26.00) } },
+    { UINT16_C(64810),
+      {  INT32_C(          24),  INT32_C(          19),  INT32_C(          28),  INT32_C(          25),  INT32_C(           8),  INT32_C(           8),  INT32_C(          24),  INT32_C(          30),
+         INT32_C(          13),  INT32_C(          18),  INT32_C(          14),  INT32_C(          31),  INT32_C(          12),  INT32_C(          12),  INT32_C(          19),  INT32_C(           5) },
+      { SIMDE_FLOAT32_C(   853.89), SIMDE_FLOAT32_C(   210.52), SIMDE_FLOAT32_C(   325.62), SIMDE_FLOAT32_C(   559.42),
+        SIMDE_FLOAT32_C(  -284.17), SIMDE_FLOAT32_C(   112.24), SIMDE_FLOAT32_C(   304.74), SIMDE_FLOAT32_C(   -96.22),
+        SIMDE_FLOAT32_C(  -280.06), SIMDE_FLOAT32_C(   586.33), SIMDE_FLOAT32_C(  -213.43), SIMDE_FLOAT32_C(  -902.90),
+        SIMDE_FLOAT32_C(  -960.45), SIMDE_FLOAT32_C(  -447.45), SIMDE_FLOAT32_C(   855.20), SIMDE_FLOAT32_C(   180.60) },
+      { SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(   855.20), SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(   559.42),
+        SIMDE_FLOAT32_C(   112.24), SIMDE_FLOAT32_C(   112.24), SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    30.00),
+        SIMDE_FLOAT32_C(  -280.06), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(  -213.43), SIMDE_FLOAT32_C(  -902.90),
+        SIMDE_FLOAT32_C(  -447.45), SIMDE_FLOAT32_C(  -447.45), SIMDE_FLOAT32_C(   855.20), SIMDE_FLOAT32_C(   180.60) } },
+    { UINT16_C(59046),
+      {  INT32_C(          29),  INT32_C(          14),  INT32_C(          15),  INT32_C(          22),  INT32_C(          12),  INT32_C(          28),  INT32_C(           8),  INT32_C(          26),
+         INT32_C(          27),  INT32_C(          20),  INT32_C(           7),  INT32_C(          14),  INT32_C(          25),  INT32_C(           7),  INT32_C(           5),  INT32_C(           4) },
+      { SIMDE_FLOAT32_C(   888.16), SIMDE_FLOAT32_C(   526.80), SIMDE_FLOAT32_C(  -212.69), SIMDE_FLOAT32_C(   192.90),
+        SIMDE_FLOAT32_C(  -569.42), SIMDE_FLOAT32_C(   507.25), SIMDE_FLOAT32_C(  -220.78), SIMDE_FLOAT32_C(   217.15),
+        SIMDE_FLOAT32_C(   604.35), SIMDE_FLOAT32_C(  -181.23), SIMDE_FLOAT32_C(   769.70), SIMDE_FLOAT32_C(   459.55),
+        SIMDE_FLOAT32_C(   999.38), SIMDE_FLOAT32_C(   823.44), SIMDE_FLOAT32_C(  -617.85), SIMDE_FLOAT32_C(  -781.90) },
+      { SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(   526.80), SIMDE_FLOAT32_C(  -212.69), SIMDE_FLOAT32_C(    22.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(   507.25), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   217.15),
+        SIMDE_FLOAT32_C(    27.00), SIMDE_FLOAT32_C(  -181.23), SIMDE_FLOAT32_C(   823.44), SIMDE_FLOAT32_C(   526.80),
+        SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(   823.44), SIMDE_FLOAT32_C(  -617.85), SIMDE_FLOAT32_C(  -781.90) } },
+    { UINT16_C(17589),
+      {  INT32_C(          10),  INT32_C(           1),  INT32_C(           0),  INT32_C(          18),  INT32_C(          27),  INT32_C(          27),  INT32_C(           6),  INT32_C(           2),
+         INT32_C(          10),  INT32_C(           0),  INT32_C(          10),  INT32_C(          15),  INT32_C(           4),  INT32_C(           4),  INT32_C(          24),  INT32_C(          25) },
+      { SIMDE_FLOAT32_C(   460.70), SIMDE_FLOAT32_C(   834.52), SIMDE_FLOAT32_C(   738.00), SIMDE_FLOAT32_C(  -760.08),
+        SIMDE_FLOAT32_C(    51.67), SIMDE_FLOAT32_C(   342.35), SIMDE_FLOAT32_C(    58.70), SIMDE_FLOAT32_C(  -178.63),
+        SIMDE_FLOAT32_C(  -198.10), SIMDE_FLOAT32_C(    58.07), SIMDE_FLOAT32_C(  -355.19), SIMDE_FLOAT32_C(   184.04),
+        SIMDE_FLOAT32_C(   276.17), SIMDE_FLOAT32_C(  -957.46), SIMDE_FLOAT32_C(   251.26), SIMDE_FLOAT32_C(   118.19) },
+      { SIMDE_FLOAT32_C(  -355.19), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   738.00), SIMDE_FLOAT32_C(    18.00),
+        SIMDE_FLOAT32_C(   342.35), SIMDE_FLOAT32_C(   342.35), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(  -178.63),
+        SIMDE_FLOAT32_C(  -355.19), SIMDE_FLOAT32_C(   738.00), SIMDE_FLOAT32_C(  -355.19), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   251.26), SIMDE_FLOAT32_C(    25.00) } },
+    { UINT16_C(56745),
+      {  INT32_C(           6),  INT32_C(           4),  INT32_C(          24),  INT32_C(          12),  INT32_C(           7),  INT32_C(           2),  INT32_C(          12),  INT32_C(          17),
+         INT32_C(          18),  INT32_C(          16),  INT32_C(          21),  INT32_C(          10),  INT32_C(          10),  INT32_C(          24),  INT32_C(           7),  INT32_C(          27) },
+      { SIMDE_FLOAT32_C(  -184.46), SIMDE_FLOAT32_C(   644.27), SIMDE_FLOAT32_C(  -973.55), SIMDE_FLOAT32_C(   874.24),
+        SIMDE_FLOAT32_C(  -534.36), SIMDE_FLOAT32_C(  -171.65), SIMDE_FLOAT32_C(   -67.69), SIMDE_FLOAT32_C(   110.44),
+        SIMDE_FLOAT32_C(  -987.61), SIMDE_FLOAT32_C(  -791.52), SIMDE_FLOAT32_C(   152.98), SIMDE_FLOAT32_C(   263.65),
+        SIMDE_FLOAT32_C(   326.67), SIMDE_FLOAT32_C(   993.49), SIMDE_FLOAT32_C(  -791.29), SIMDE_FLOAT32_C(   411.34) },
+      { SIMDE_FLOAT32_C(  -184.46), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(   874.24),
+        SIMDE_FLOAT32_C(  -791.29), SIMDE_FLOAT32_C(  -171.65), SIMDE_FLOAT32_C(   874.24), SIMDE_FLOAT32_C(   110.44),
+        SIMDE_FLOAT32_C(  -987.61), SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(   152.98), SIMDE_FLOAT32_C(   326.67),
+        SIMDE_FLOAT32_C(   326.67), SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(  -791.29), SIMDE_FLOAT32_C(   411.34) } },
+    { UINT16_C(49350),
+      {  INT32_C(           4),  INT32_C(          13),  INT32_C(           2),  INT32_C(          16),  INT32_C(          30),  INT32_C(          20),  INT32_C(           1),  INT32_C(          20),
+         INT32_C(          30),  INT32_C(          11),  INT32_C(          12),  INT32_C(           5),  INT32_C(           6),  INT32_C(          15),  INT32_C(          23),  INT32_C(          22) },
+      { SIMDE_FLOAT32_C(  -895.06), SIMDE_FLOAT32_C(   -88.82), SIMDE_FLOAT32_C(   387.24), SIMDE_FLOAT32_C(    37.25),
+        SIMDE_FLOAT32_C(  -978.37), SIMDE_FLOAT32_C(   399.64), SIMDE_FLOAT32_C(   245.72), SIMDE_FLOAT32_C(   174.61),
+        SIMDE_FLOAT32_C(  -336.71), SIMDE_FLOAT32_C(  -427.61), SIMDE_FLOAT32_C(   168.09), SIMDE_FLOAT32_C(  -128.01),
+        SIMDE_FLOAT32_C(   983.73), SIMDE_FLOAT32_C(   578.14), SIMDE_FLOAT32_C(   491.49), SIMDE_FLOAT32_C(  -101.36) },
+      { SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   -88.82), SIMDE_FLOAT32_C(   387.24), SIMDE_FLOAT32_C(    16.00),
+        SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(   174.61), SIMDE_FLOAT32_C(   245.72), SIMDE_FLOAT32_C(   174.61),
+        SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    11.00), SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(     5.00),
+        SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(    15.00), SIMDE_FLOAT32_C(   491.49), SIMDE_FLOAT32_C(  -101.36) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_mm512_mask_i32scatter_ps(HEDLEY_STATIC_CAST(void*, f32_buffer), test_vec[i].k, vindex, a, 4);
+
+    simde_float32 rv[16];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[test_vec[i].vindex[j]]; }
+    simde__m512 r = simde_mm512_loadu_ps(rv);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512i vindex = simde_mm512_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_mm512_mask_i32scatter_ps(f32_buffer, k, vindex, a, 4);
+
+    int32_t vi[16];
+    simde_float32 rv[16];
+    simde_mm512_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[vi[j]]; }
+    simde__m512 r = simde_mm512_loadu_ps(rv);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x16(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(          21),  INT32_C(          13),  INT32_C(           0),  INT32_C(          20),  INT32_C(           1),  INT32_C(           1),  INT32_C(           8),  INT32_C(           0) },
+      { -INT64_C( 5464734397544188756), -INT64_C( 3469957077368449934),  INT64_C( 6299591271985642192), -INT64_C(  318749182927360559),
+        -INT64_C( 1693082474083706680),  INT64_C( 2668093973656050122),  INT64_C( 6209670613565628659), -INT64_C( 5429796419803719589) },
+      { -INT64_C( 5464734397544188756), -INT64_C( 3469957077368449934), -INT64_C( 5429796419803719589), -INT64_C(  318749182927360559),
+         INT64_C( 2668093973656050122),  INT64_C( 2668093973656050122),  INT64_C( 6209670613565628659), -INT64_C( 5429796419803719589) } },
+    { {  INT32_C(          21),  INT32_C(          18),  INT32_C(           0),  INT32_C(          10),  INT32_C(           9),  INT32_C(           0),  INT32_C(          18),  INT32_C(          19) },
+      {  INT64_C(   41501124077425433), -INT64_C( 2365230360224705199),  INT64_C( 2953005190766728795), -INT64_C( 7765008972134581343),
+         INT64_C( 7657973251666257976),  INT64_C( 8813384077076929771), -INT64_C( 6323127513643820924), -INT64_C( 3510010999707897287) },
+      {  INT64_C(   41501124077425433), -INT64_C( 6323127513643820924),  INT64_C( 8813384077076929771), -INT64_C( 7765008972134581343),
+         INT64_C( 7657973251666257976),  INT64_C( 8813384077076929771), -INT64_C( 6323127513643820924), -INT64_C( 3510010999707897287) } },
+    { {  INT32_C(          23),  INT32_C(          11),  INT32_C(          21),  INT32_C(          16),  INT32_C(           1),  INT32_C(          27),  INT32_C(          27),  INT32_C(          13) },
+      {  INT64_C( 5625149636805942391), -INT64_C( 3957637607832759708),  INT64_C( 5512061473271956759),  INT64_C( 7331886508422238994),
+        -INT64_C( 1401732704235684493), -INT64_C( 5821066794729213218), -INT64_C( 8272871190320794577), -INT64_C( 5205807932398097298) },
+      {  INT64_C( 5625149636805942391), -INT64_C( 3957637607832759708),  INT64_C( 5512061473271956759),  INT64_C( 7331886508422238994),
+        -INT64_C( 1401732704235684493), -INT64_C( 8272871190320794577), -INT64_C( 8272871190320794577), -INT64_C( 5205807932398097298) } },
+    { {  INT32_C(          30),  INT32_C(          28),  INT32_C(          21),  INT32_C(           6),  INT32_C(           8),  INT32_C(           1),  INT32_C(          19),  INT32_C(           6) },
+      { -INT64_C( 6577142814745556365),  INT64_C( 6991760298093320191),  INT64_C(  567594055014123749), -INT64_C( 3915457294102571717),
+         INT64_C(  622777713997168011), -INT64_C( 3821151565129831004),  INT64_C( 8134297200478106898), -INT64_C( 4915365426294968407) },
+      { -INT64_C( 6577142814745556365),  INT64_C( 6991760298093320191),  INT64_C(  567594055014123749), -INT64_C( 4915365426294968407),
+         INT64_C(  622777713997168011), -INT64_C( 3821151565129831004),  INT64_C( 8134297200478106898), -INT64_C( 4915365426294968407) } },
+    { {  INT32_C(          26),  INT32_C(          29),  INT32_C(          27),  INT32_C(           3),  INT32_C(          11),  INT32_C(          31),  INT32_C(          11),  INT32_C(          15) },
+      {  INT64_C(  665511261813239180), -INT64_C( 5928771187728175084),  INT64_C( 2549450022281096310),  INT64_C(  580948388594719764),
+        -INT64_C( 1702159636045859489), -INT64_C( 9108274008973884186), -INT64_C( 3350246305172077291), -INT64_C( 2871291632352720732) },
+      {  INT64_C(  665511261813239180), -INT64_C( 5928771187728175084),  INT64_C( 2549450022281096310),  INT64_C(  580948388594719764),
+        -INT64_C( 3350246305172077291), -INT64_C( 9108274008973884186), -INT64_C( 3350246305172077291), -INT64_C( 2871291632352720732) } },
+    { {  INT32_C(          21),  INT32_C(           1),  INT32_C(          15),  INT32_C(           9),  INT32_C(          24),  INT32_C(          15),  INT32_C(          17),  INT32_C(          30) },
+      {  INT64_C( 9178267230342316499), -INT64_C( 5578729521384946170),  INT64_C( 6429444564881417447), -INT64_C( 3877295848521832293),
+         INT64_C( 2485432960701520532), -INT64_C( 6750761994713473905), -INT64_C( 5315871419232280035), -INT64_C( 6600628818775769949) },
+      {  INT64_C( 9178267230342316499), -INT64_C( 5578729521384946170), -INT64_C( 6750761994713473905), -INT64_C( 3877295848521832293),
+         INT64_C( 2485432960701520532), -INT64_C( 6750761994713473905), -INT64_C( 5315871419232280035), -INT64_C( 6600628818775769949) } },
+    { {  INT32_C(          21),  INT32_C(          14),  INT32_C(           3),  INT32_C(          17),  INT32_C(          22),  INT32_C(           1),  INT32_C(          19),  INT32_C(           5) },
+      { -INT64_C( 1235512620958394243), -INT64_C( 4861906171024319051),  INT64_C( 4736303614427279367), -INT64_C(  250788157462520375),
+         INT64_C( 1160819688246462557), -INT64_C(   89675107405796116), -INT64_C( 7141073126228224104), -INT64_C( 2762955636915538132) },
+      { -INT64_C( 1235512620958394243), -INT64_C( 4861906171024319051),  INT64_C( 4736303614427279367), -INT64_C(  250788157462520375),
+         INT64_C( 1160819688246462557), -INT64_C(   89675107405796116), -INT64_C( 7141073126228224104), -INT64_C( 2762955636915538132) } },
+    { {  INT32_C(          10),  INT32_C(          29),  INT32_C(           7),  INT32_C(           6),  INT32_C(          12),  INT32_C(           3),  INT32_C(          22),  INT32_C(          25) },
+      {  INT64_C( 1730964999735482128),  INT64_C( 1524083544026782134),  INT64_C( 8029188766751040024), -INT64_C( 6409805794382613435),
+         INT64_C( 4502108175862786531), -INT64_C( 1167858543114045747),  INT64_C( 4153709683707972496), -INT64_C( 1755429665957529244) },
+      {  INT64_C( 1730964999735482128),  INT64_C( 1524083544026782134),  INT64_C( 8029188766751040024), -INT64_C( 6409805794382613435),
+         INT64_C( 4502108175862786531), -INT64_C( 1167858543114045747),  INT64_C( 4153709683707972496), -INT64_C( 1755429665957529244) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__m256i vindex = simde_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_i32scatter_epi64(HEDLEY_STATIC_CAST(void*, i64_buffer), vindex, a, 8);
+
+    int64_t rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__m256i vindex = simde_mm256_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512i a = simde_test_x86_random_i64x8();
+    simde_mm512_i32scatter_epi64(i64_buffer, vindex, a, 8);
+
+    int32_t vi[8];
+    int64_t rv[8];
+    simde_mm256_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[vi[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+
+    simde_test_x86_write_i32x8(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask8 k;
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 95),
+      {  INT32_C(          18),  INT32_C(          10),  INT32_C(           7),  INT32_C(           5),  INT32_C(           4),  INT32_C(           5),  INT32_C(          18),  INT32_C(          27) },
+      { -INT64_C( 2491402832711612179),  INT64_C( 9122615287581090117), -INT64_C( 8337734958831200651),  INT64_C( 4932396339453571508),
+         INT64_C( 5556468907786585836),  INT64_C( 7849526723640290604), -INT64_C( 8035932614825643340),  INT64_C( 6659834770123918546) },
+      { -INT64_C( 8035932614825643340),  INT64_C( 9122615287581090117), -INT64_C( 8337734958831200651),  INT64_C( 4932396339453571508),
+         INT64_C( 5556468907786585836),  INT64_C( 4932396339453571508), -INT64_C( 8035932614825643340),  INT64_C(                  27) } },
+    { UINT8_C(194),
+      {  INT32_C(          12),  INT32_C(          26),  INT32_C(          10),  INT32_C(          23),  INT32_C(          22),  INT32_C(          23),  INT32_C(           4),  INT32_C(           3) },
+      {  INT64_C( 1688012744187098523), -INT64_C( 2103036066558419875), -INT64_C( 1024095691312268917),  INT64_C( 5089997404972356425),
+        -INT64_C( 6791872145896030974), -INT64_C( 4575252375112994360), -INT64_C( 3764849297463978903),  INT64_C( 1807471869713697060) },
+      {  INT64_C(                  12), -INT64_C( 2103036066558419875),  INT64_C(                  10),  INT64_C(                  23),
+         INT64_C(                  22),  INT64_C(                  23), -INT64_C( 3764849297463978903),  INT64_C( 1807471869713697060) } },
+    { UINT8_C(171),
+      {  INT32_C(          20),  INT32_C(           0),  INT32_C(          15),  INT32_C(           1),  INT32_C(          31),  INT32_C(          17),  INT32_C(           9),  INT32_C(          16) },
+      {  INT64_C( 4470708194999920689),  INT64_C( 7251512945182563052), -INT64_C( 7246129589096124073),  INT64_C( 2450915811034685524),
+         INT64_C( 8860496424983554126), -INT64_C( 7302699756575803480),  INT64_C(  661413099045069067), -INT64_C(  125291892054406609) },
+      {  INT64_C( 4470708194999920689),  INT64_C( 7251512945182563052),  INT64_C(                  15),  INT64_C( 2450915811034685524),
+         INT64_C(                  31), -INT64_C( 7302699756575803480),  INT64_C(                   9), -INT64_C(  125291892054406609) } },
+    { UINT8_C( 72),
+      {  INT32_C(           6),  INT32_C(          23),  INT32_C(          21),  INT32_C(          20),  INT32_C(          13),  INT32_C(          15),  INT32_C(          29),  INT32_C(           4) },
+      { -INT64_C( 8580692750617821113), -INT64_C(  747801310983783008),  INT64_C(  597469129609691170), -INT64_C( 5301763228385337510),
+        -INT64_C(  717899361830956006), -INT64_C( 5719846895729883137),  INT64_C( 4814626078388798661),  INT64_C( 2396116244773907739) },
+      {  INT64_C(                   6),  INT64_C(                  23),  INT64_C(                  21), -INT64_C( 5301763228385337510),
+         INT64_C(                  13),  INT64_C(                  15),  INT64_C( 4814626078388798661),  INT64_C(                   4) } },
+    { UINT8_C(203),
+      {  INT32_C(          23),  INT32_C(           2),  INT32_C(           0),  INT32_C(          25),  INT32_C(          12),  INT32_C(          22),  INT32_C(          24),  INT32_C(          19) },
+      { -INT64_C( 1781401653069479044), -INT64_C( 8216234912675590174), -INT64_C( 7143071001409649572), -INT64_C( 7928502391296098727),
+        -INT64_C( 8369276172028905392),  INT64_C( 1646176415079115114),  INT64_C( 8955697183813365224), -INT64_C( 2545526046707335674) },
+      { -INT64_C( 1781401653069479044), -INT64_C( 8216234912675590174),  INT64_C(                   0), -INT64_C( 7928502391296098727),
+         INT64_C(                  12),  INT64_C(                  22),  INT64_C( 8955697183813365224), -INT64_C( 2545526046707335674) } },
+    { UINT8_C(242),
+      {  INT32_C(           0),  INT32_C(          15),  INT32_C(          27),  INT32_C(          27),  INT32_C(           9),  INT32_C(           6),  INT32_C(           5),  INT32_C(          18) },
+      {  INT64_C( 1575454653205565584),  INT64_C( 1322569364137347661), -INT64_C( 2115993485988432586), -INT64_C(  844844514261779126),
+        -INT64_C( 4319016398523706542),  INT64_C( 3690264475746191440), -INT64_C( 7283299918538353176), -INT64_C( 4748248196628682302) },
+      {  INT64_C(                   0),  INT64_C( 1322569364137347661),  INT64_C(                  27),  INT64_C(                  27),
+        -INT64_C( 4319016398523706542),  INT64_C( 3690264475746191440), -INT64_C( 7283299918538353176), -INT64_C( 4748248196628682302) } },
+    { UINT8_C( 40),
+      {  INT32_C(           2),  INT32_C(          25),  INT32_C(          31),  INT32_C(           8),  INT32_C(           8),  INT32_C(           3),  INT32_C(          24),  INT32_C(          16) },
+      {  INT64_C( 5176678258578373756), -INT64_C( 5157691610039328220), -INT64_C( 5782935640632683840),  INT64_C( 4428322394389044635),
+        -INT64_C( 1763999541965847861),  INT64_C( 1111542822043983077),  INT64_C( 1075342653834694800), -INT64_C( 4774124625737915456) },
+      {  INT64_C(                   2),  INT64_C(                  25),  INT64_C(                  31),  INT64_C( 4428322394389044635),
+         INT64_C( 4428322394389044635),  INT64_C( 1111542822043983077),  INT64_C(                  24),  INT64_C(                  16) } },
+    { UINT8_C(104),
+      {  INT32_C(          10),  INT32_C(          26),  INT32_C(          11),  INT32_C(          13),  INT32_C(          31),  INT32_C(          19),  INT32_C(          19),  INT32_C(          28) },
+      { -INT64_C( 8992569206123100252), -INT64_C( 4629696723248910178), -INT64_C( 1602033524386217611), -INT64_C( 6375784238681690008),
+         INT64_C(  479489771577175601),  INT64_C( 1515680765844036845), -INT64_C( 8074613115625293560), -INT64_C( 6642532982630922202) },
+      {  INT64_C(                  10),  INT64_C(                  26),  INT64_C(                  11), -INT64_C( 6375784238681690008),
+         INT64_C(                  31), -INT64_C( 8074613115625293560), -INT64_C( 8074613115625293560),  INT64_C(                  28) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__m256i vindex = simde_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_mask_i32scatter_epi64(HEDLEY_STATIC_CAST(void*, i64_buffer), test_vec[i].k, vindex, a, 8);
+
+    int64_t rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256i vindex = simde_mm256_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512i a = simde_test_x86_random_i64x8();
+    simde_mm512_mask_i32scatter_epi64(i64_buffer, k, vindex, a, 8);
+
+    int32_t vi[8];
+    int64_t rv[8];
+    simde_mm256_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[vi[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x8(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { {  INT32_C(          10),  INT32_C(          26),  INT32_C(           7),  INT32_C(          18),  INT32_C(          23),  INT32_C(          14),  INT32_C(          24),  INT32_C(           4) },
+      { SIMDE_FLOAT64_C(  -271.60), SIMDE_FLOAT64_C(  -431.54), SIMDE_FLOAT64_C(   305.59), SIMDE_FLOAT64_C(   893.33),
+        SIMDE_FLOAT64_C(   721.58), SIMDE_FLOAT64_C(   428.89), SIMDE_FLOAT64_C(  -267.84), SIMDE_FLOAT64_C(   965.46) },
+      { SIMDE_FLOAT64_C(  -271.60), SIMDE_FLOAT64_C(  -431.54), SIMDE_FLOAT64_C(   305.59), SIMDE_FLOAT64_C(   893.33),
+        SIMDE_FLOAT64_C(   721.58), SIMDE_FLOAT64_C(   428.89), SIMDE_FLOAT64_C(  -267.84), SIMDE_FLOAT64_C(   965.46) } },
+    { {  INT32_C(          14),  INT32_C(          18),  INT32_C(          22),  INT32_C(          21),  INT32_C(           8),  INT32_C(           7),  INT32_C(           5),  INT32_C(          14) },
+      { SIMDE_FLOAT64_C(   828.15), SIMDE_FLOAT64_C(  -381.29), SIMDE_FLOAT64_C(  -917.58), SIMDE_FLOAT64_C(  -144.48),
+        SIMDE_FLOAT64_C(   562.35), SIMDE_FLOAT64_C(   -97.18), SIMDE_FLOAT64_C(   524.77), SIMDE_FLOAT64_C(   754.69) },
+      { SIMDE_FLOAT64_C(   754.69), SIMDE_FLOAT64_C(  -381.29), SIMDE_FLOAT64_C(  -917.58), SIMDE_FLOAT64_C(  -144.48),
+        SIMDE_FLOAT64_C(   562.35), SIMDE_FLOAT64_C(   -97.18), SIMDE_FLOAT64_C(   524.77), SIMDE_FLOAT64_C(   754.69) } },
+    { {  INT32_C(           2),  INT32_C(          13),  INT32_C(          20),  INT32_C(          25),  INT32_C(          28),  INT32_C(          12),  INT32_C(          30),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(   448.70), SIMDE_FLOAT64_C(   408.36), SIMDE_FLOAT64_C(   819.55), SIMDE_FLOAT64_C(   170.28),
+        SIMDE_FLOAT64_C(  -162.75), SIMDE_FLOAT64_C(  -448.29), SIMDE_FLOAT64_C(   135.74), SIMDE_FLOAT64_C(   -17.37) },
+      { SIMDE_FLOAT64_C(   448.70), SIMDE_FLOAT64_C(   408.36), SIMDE_FLOAT64_C(   819.55), SIMDE_FLOAT64_C(   170.28),
+        SIMDE_FLOAT64_C(  -162.75), SIMDE_FLOAT64_C(  -448.29), SIMDE_FLOAT64_C(   135.74), SIMDE_FLOAT64_C(   -17.37) } },
+    { {  INT32_C(           4),  INT32_C(          20),  INT32_C(           5),  INT32_C(          12),  INT32_C(          27),  INT32_C(          10),  INT32_C(          26),  INT32_C(          11) },
+      { SIMDE_FLOAT64_C(  -735.06), SIMDE_FLOAT64_C(  -133.98), SIMDE_FLOAT64_C(  -984.53), SIMDE_FLOAT64_C(   827.29),
+        SIMDE_FLOAT64_C(   768.83), SIMDE_FLOAT64_C(   540.24), SIMDE_FLOAT64_C(   581.98), SIMDE_FLOAT64_C(  -453.48) },
+      { SIMDE_FLOAT64_C(  -735.06), SIMDE_FLOAT64_C(  -133.98), SIMDE_FLOAT64_C(  -984.53), SIMDE_FLOAT64_C(   827.29),
+        SIMDE_FLOAT64_C(   768.83), SIMDE_FLOAT64_C(   540.24), SIMDE_FLOAT64_C(   581.98), SIMDE_FLOAT64_C(  -453.48) } },
+    { {  INT32_C(           1),  INT32_C(          20),  INT32_C(          20),  INT32_C(          29),  INT32_C(           0),  INT32_C(          18),  INT32_C(           4),  INT32_C(          11) },
+      { SIMDE_FLOAT64_C(   -78.17), SIMDE_FLOAT64_C(  -468.00), SIMDE_FLOAT64_C(  -358.59), SIMDE_FLOAT64_C(   759.08),
+        SIMDE_FLOAT64_C(    83.71), SIMDE_FLOAT64_C(   777.15), SIMDE_FLOAT64_C(  -258.28), SIMDE_FLOAT64_C(   794.05) },
+      { SIMDE_FLOAT64_C(   -78.17), SIMDE_FLOAT64_C(  -358.59), SIMDE_FLOAT64_C(  -358.59), SIMDE_FLOAT64_C(   759.08),
+        SIMDE_FLOAT64_C(    83.71), SIMDE_FLOAT64_C(   777.15), SIMDE_FLOAT64_C(  -258.28), SIMDE_FLOAT64_C(   794.05) } },
+    { {  INT32_C(          13),  INT32_C(          19),  INT32_C(          26),  INT32_C(           8),  INT32_C(          29),  INT32_C(          20),  INT32_C(          20),  INT32_C(           4) },
+      { SIMDE_FLOAT64_C(   211.33), SIMDE_FLOAT64_C(    62.18), SIMDE_FLOAT64_C(    81.65), SIMDE_FLOAT64_C(   -19.84),
+        SIMDE_FLOAT64_C(  -397.57), SIMDE_FLOAT64_C(  -336.37), SIMDE_FLOAT64_C(   526.69), SIMDE_FLOAT64_C(  -809.17) },
+      { SIMDE_FLOAT64_C(   211.33), SIMDE_FLOAT64_C(    62.18), SIMDE_FLOAT64_C(    81.65), SIMDE_FLOAT64_C(   -19.84),
+        SIMDE_FLOAT64_C(  -397.57), SIMDE_FLOAT64_C(   526.69), SIMDE_FLOAT64_C(   526.69), SIMDE_FLOAT64_C(  -809.17) } },
+    { {  INT32_C(          23),  INT32_C(          14),  INT32_C(          21),  INT32_C(          24),  INT32_C(           1),  INT32_C(          25),  INT32_C(           3),  INT32_C(          31) },
+      { SIMDE_FLOAT64_C(  -778.48), SIMDE_FLOAT64_C(   940.76), SIMDE_FLOAT64_C(   131.76), SIMDE_FLOAT64_C(   305.23),
+        SIMDE_FLOAT64_C(   717.91), SIMDE_FLOAT64_C(   873.47), SIMDE_FLOAT64_C(    99.28), SIMDE_FLOAT64_C(  -727.13) },
+      { SIMDE_FLOAT64_C(  -778.48), SIMDE_FLOAT64_C(   940.76), SIMDE_FLOAT64_C(   131.76), SIMDE_FLOAT64_C(   305.23),
+        SIMDE_FLOAT64_C(   717.91), SIMDE_FLOAT64_C(   873.47), SIMDE_FLOAT64_C(    99.28), SIMDE_FLOAT64_C(  -727.13) } },
+    { {  INT32_C(           0),  INT32_C(           0),  INT32_C(          12),  INT32_C(          29),  INT32_C(          21),  INT32_C(           0),  INT32_C(           1),  INT32_C(          27) },
+      { SIMDE_FLOAT64_C(  -731.47), SIMDE_FLOAT64_C(  -457.92), SIMDE_FLOAT64_C(   197.80), SIMDE_FLOAT64_C(  -129.04),
+        SIMDE_FLOAT64_C(   205.71), SIMDE_FLOAT64_C(  -275.51), SIMDE_FLOAT64_C(    61.79), SIMDE_FLOAT64_C(    11.51) },
+      { SIMDE_FLOAT64_C(  -275.51), SIMDE_FLOAT64_C(  -275.51), SIMDE_FLOAT64_C(   197.80), SIMDE_FLOAT64_C(  -129.04),
+        SIMDE_FLOAT64_C(   205.71), SIMDE_FLOAT64_C(  -275.51), SIMDE_FLOAT64_C(    61.79), SIMDE_FLOAT64_C(    11.51) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__m256i vindex = simde_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_i32scatter_pd(HEDLEY_STATIC_CAST(void*, f64_buffer), vindex, a, 8);
+
+    simde_float64 rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__m256i vindex = simde_mm256_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512d a = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_mm512_i32scatter_pd(f64_buffer, vindex, a, 8);
+
+    int32_t vi[8];
+    simde_float64 rv[8];
+    simde_mm256_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[vi[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+
+    simde_test_x86_write_i32x8(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(194),
+      {  INT32_C(           5),  INT32_C(          22),  INT32_C(           3),  INT32_C(          30),  INT32_C(          25),  INT32_C(           2),  INT32_C(          14),  INT32_C(          23) },
+      { SIMDE_FLOAT64_C(  -382.87), SIMDE_FLOAT64_C(   255.12), SIMDE_FLOAT64_C(   797.77), SIMDE_FLOAT64_C(  -509.39),
+        SIMDE_FLOAT64_C(  -645.61), SIMDE_FLOAT64_C(  -929.35), SIMDE_FLOAT64_C(   707.26), SIMDE_FLOAT64_C(    15.39) },
+      { SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   255.12), SIMDE_FLOAT64_C(     3.00), SIMDE_FLOAT64_C(    30.00),
+        SIMDE_FLOAT64_C(    25.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   707.26), SIMDE_FLOAT64_C(    15.39) } },
+    {    UINT8_MAX,
+      {  INT32_C(          10),  INT32_C(           3),  INT32_C(          31),  INT32_C(          12),  INT32_C(          30),  INT32_C(           2),  INT32_C(          16),  INT32_C(          24) },
+      { SIMDE_FLOAT64_C(  -423.88), SIMDE_FLOAT64_C(   121.54), SIMDE_FLOAT64_C(  -838.39), SIMDE_FLOAT64_C(   637.92),
+        SIMDE_FLOAT64_C(  -866.95), SIMDE_FLOAT64_C(   823.48), SIMDE_FLOAT64_C(   676.77), SIMDE_FLOAT64_C(   -27.21) },
+      { SIMDE_FLOAT64_C(  -423.88), SIMDE_FLOAT64_C(   121.54), SIMDE_FLOAT64_C(  -838.39), SIMDE_FLOAT64_C(   637.92),
+        SIMDE_FLOAT64_C(  -866.95), SIMDE_FLOAT64_C(   823.48), SIMDE_FLOAT64_C(   676.77), SIMDE_FLOAT64_C(   -27.21) } },
+    { UINT8_C(146),
+      {  INT32_C(          14),  INT32_C(           5),  INT32_C(          21),  INT32_C(          28),  INT32_C(          29),  INT32_C(          21),  INT32_C(           4),  INT32_C(          11) },
+      { SIMDE_FLOAT64_C(  -470.71), SIMDE_FLOAT64_C(   -35.46), SIMDE_FLOAT64_C(    60.18), SIMDE_FLOAT64_C(  -763.45),
+        SIMDE_FLOAT64_C(   979.93), SIMDE_FLOAT64_C(   290.46), SIMDE_FLOAT64_C(  -850.12), SIMDE_FLOAT64_C(  -998.38) },
+      { SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   -35.46), SIMDE_FLOAT64_C(    21.00), SIMDE_FLOAT64_C(    28.00),
+        SIMDE_FLOAT64_C(   979.93), SIMDE_FLOAT64_C(    21.00), SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(  -998.38) } },
+    { UINT8_C(220),
+      {  INT32_C(           6),  INT32_C(           2),  INT32_C(          30),  INT32_C(          22),  INT32_C(          27),  INT32_C(          25),  INT32_C(          13),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(  -353.71), SIMDE_FLOAT64_C(  -305.94), SIMDE_FLOAT64_C(   663.17), SIMDE_FLOAT64_C(  -676.94),
+        SIMDE_FLOAT64_C(   666.85), SIMDE_FLOAT64_C(   599.35), SIMDE_FLOAT64_C(   728.20), SIMDE_FLOAT64_C(  -221.26) },
+      { SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   663.17), SIMDE_FLOAT64_C(  -676.94),
+        SIMDE_FLOAT64_C(   666.85), SIMDE_FLOAT64_C(    25.00), SIMDE_FLOAT64_C(   728.20), SIMDE_FLOAT64_C(  -221.26) } },
+    { UINT8_C(222),
+      {  INT32_C(          29),  INT32_C(          17),  INT32_C(          19),  INT32_C(           1),  INT32_C(          28),  INT32_C(          22),  INT32_C(          19),  INT32_C(          26) },
+      { SIMDE_FLOAT64_C(   825.43), SIMDE_FLOAT64_C(  -362.14), SIMDE_FLOAT64_C(   310.66), SIMDE_FLOAT64_C(   975.31),
+        SIMDE_FLOAT64_C(  -360.52), SIMDE_FLOAT64_C(  -962.25), SIMDE_FLOAT64_C(   498.94), SIMDE_FLOAT64_C(  -119.57) },
+      { SIMDE_FLOAT64_C(    29.00), SIMDE_FLOAT64_C(  -362.14), SIMDE_FLOAT64_C(   498.94), SIMDE_FLOAT64_C(   975.31),
+        SIMDE_FLOAT64_C(  -360.52), SIMDE_FLOAT64_C(    22.00), SIMDE_FLOAT64_C(   498.94), SIMDE_FLOAT64_C(  -119.57) } },
+    { UINT8_C( 82),
+      {  INT32_C(          27),  INT32_C(          21),  INT32_C(          11),  INT32_C(           8),  INT32_C(          29),  INT32_C(          15),  INT32_C(          11),  INT32_C(          19) },
+      { SIMDE_FLOAT64_C(  -552.29), SIMDE_FLOAT64_C(   860.33), SIMDE_FLOAT64_C(   660.73), SIMDE_FLOAT64_C(  -824.09),
+        SIMDE_FLOAT64_C(  -360.93), SIMDE_FLOAT64_C(  -318.37), SIMDE_FLOAT64_C(   259.15), SIMDE_FLOAT64_C(  -390.43) },
+      { SIMDE_FLOAT64_C(    27.00), SIMDE_FLOAT64_C(   860.33), SIMDE_FLOAT64_C(   259.15), SIMDE_FLOAT64_C(     8.00),
+        SIMDE_FLOAT64_C(  -360.93), SIMDE_FLOAT64_C(    15.00), SIMDE_FLOAT64_C(   259.15), SIMDE_FLOAT64_C(    19.00) } },
+    { UINT8_C( 78),
+      {  INT32_C(           2),  INT32_C(          27),  INT32_C(           4),  INT32_C(          21),  INT32_C(          21),  INT32_C(           9),  INT32_C(           9),  INT32_C(          13) },
+      { SIMDE_FLOAT64_C(   130.84), SIMDE_FLOAT64_C(  -112.20), SIMDE_FLOAT64_C(   -61.78), SIMDE_FLOAT64_C(  -370.22),
+        SIMDE_FLOAT64_C(   768.23), SIMDE_FLOAT64_C(   408.21), SIMDE_FLOAT64_C(   568.19), SIMDE_FLOAT64_C(  -673.25) },
+      { SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -112.20), SIMDE_FLOAT64_C(   -61.78), SIMDE_FLOAT64_C(  -370.22),
+        SIMDE_FLOAT64_C(  -370.22), SIMDE_FLOAT64_C(   568.19), SIMDE_FLOAT64_C(   568.19), SIMDE_FLOAT64_C(    13.00) } },
+    { UINT8_C(191),
+      {  INT32_C(          18),  INT32_C(          14),  INT32_C(          14),  INT32_C(          29),  INT32_C(           2),  INT32_C(          16),  INT32_C(          23),  INT32_C(          30) },
+      { SIMDE_FLOAT64_C(   634.86), SIMDE_FLOAT64_C(   760.49), SIMDE_FLOAT64_C(   128.69), SIMDE_FLOAT64_C(  -105.99),
+        SIMDE_FLOAT64_C(  -629.94), SIMDE_FLOAT64_C(  -130.10), SIMDE_FLOAT64_C(   846.53), SIMDE_FLOAT64_C(   939.66) },
+      { SIMDE_FLOAT64_C(   634.86), SIMDE_FLOAT64_C(   128.69), SIMDE_FLOAT64_C(   128.69), SIMDE_FLOAT64_C(  -105.99),
+        SIMDE_FLOAT64_C(  -629.94), SIMDE_FLOAT64_C(  -130.10), SIMDE_FLOAT64_C(    23.00), SIMDE_FLOAT64_C(   939.66) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__m256i vindex = simde_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_mask_i32scatter_pd(HEDLEY_STATIC_CAST(void*, f64_buffer), test_vec[i].k, vindex, a, 8);
+
+    simde_float64 rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256i vindex = simde_mm256_set_epi32(
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int32_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512d a = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_mm512_mask_i32scatter_pd(f64_buffer, k, vindex, a, 8);
+
+    int32_t vi[8];
+    simde_float64 rv[8];
+    simde_mm256_storeu_epi32(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[vi[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x8(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                  11),  INT64_C(                  11),  INT64_C(                  19),  INT64_C(                  20),
+         INT64_C(                  20),  INT64_C(                   0),  INT64_C(                  29),  INT64_C(                  22) },
+      {  INT32_C(  1978846369), -INT32_C(  2009799818), -INT32_C(  1796857294),  INT32_C(    89283986), -INT32_C(   998749215), -INT32_C(  1121808750),  INT32_C(  1838315161),  INT32_C(   941862806) },
+      { -INT32_C(  2009799818), -INT32_C(  2009799818), -INT32_C(  1796857294), -INT32_C(   998749215), -INT32_C(   998749215), -INT32_C(  1121808750),  INT32_C(  1838315161),  INT32_C(   941862806) } },
+    { {  INT64_C(                  27),  INT64_C(                  21),  INT64_C(                  13),  INT64_C(                  17),
+         INT64_C(                  25),  INT64_C(                   1),  INT64_C(                  26),  INT64_C(                  11) },
+      { -INT32_C(  1782620157), -INT32_C(  1634070083), -INT32_C(   278719907),  INT32_C(   967673248), -INT32_C(  1834532869),  INT32_C(  1791675118), -INT32_C(   648316960),  INT32_C(  1527043416) },
+      { -INT32_C(  1782620157), -INT32_C(  1634070083), -INT32_C(   278719907),  INT32_C(   967673248), -INT32_C(  1834532869),  INT32_C(  1791675118), -INT32_C(   648316960),  INT32_C(  1527043416) } },
+    { {  INT64_C(                  21),  INT64_C(                   3),  INT64_C(                  16),  INT64_C(                  18),
+         INT64_C(                  20),  INT64_C(                  10),  INT64_C(                  17),  INT64_C(                  17) },
+      {  INT32_C(  1025635484),  INT32_C(  1970720377), -INT32_C(    83419891), -INT32_C(   932851224), -INT32_C(  1600011960), -INT32_C(   855923306),  INT32_C(  1019145064),  INT32_C(   292441973) },
+      {  INT32_C(  1025635484),  INT32_C(  1970720377), -INT32_C(    83419891), -INT32_C(   932851224), -INT32_C(  1600011960), -INT32_C(   855923306),  INT32_C(   292441973),  INT32_C(   292441973) } },
+    { {  INT64_C(                   3),  INT64_C(                  15),  INT64_C(                  14),  INT64_C(                  29),
+         INT64_C(                  29),  INT64_C(                   5),  INT64_C(                  18),  INT64_C(                  10) },
+      { -INT32_C(   899335710),  INT32_C(  1385351946),  INT32_C(   586298252),  INT32_C(  1089400280),  INT32_C(  1300082136),  INT32_C(  1079962620), -INT32_C(   671240838),  INT32_C(  1413558130) },
+      { -INT32_C(   899335710),  INT32_C(  1385351946),  INT32_C(   586298252),  INT32_C(  1300082136),  INT32_C(  1300082136),  INT32_C(  1079962620), -INT32_C(   671240838),  INT32_C(  1413558130) } },
+    { {  INT64_C(                   8),  INT64_C(                   6),  INT64_C(                  31),  INT64_C(                  18),
+         INT64_C(                  17),  INT64_C(                  17),  INT64_C(                   4),  INT64_C(                  29) },
+      { -INT32_C(  1121929499),  INT32_C(  2080247459), -INT32_C(  1194820677), -INT32_C(   520608154),  INT32_C(  1169683923), -INT32_C(  1936000988),  INT32_C(   285129118),  INT32_C(  1326301802) },
+      { -INT32_C(  1121929499),  INT32_C(  2080247459), -INT32_C(  1194820677), -INT32_C(   520608154), -INT32_C(  1936000988), -INT32_C(  1936000988),  INT32_C(   285129118),  INT32_C(  1326301802) } },
+    { {  INT64_C(                  24),  INT64_C(                  13),  INT64_C(                  13),  INT64_C(                  27),
+         INT64_C(                  28),  INT64_C(                  11),  INT64_C(                  22),  INT64_C(                  23) },
+      { -INT32_C(   324051322),  INT32_C(  1489807236), -INT32_C(  1063418980),  INT32_C(   424425339),  INT32_C(  1529432816), -INT32_C(  2069219572), -INT32_C(  1600145564),  INT32_C(  1217934786) },
+      { -INT32_C(   324051322), -INT32_C(  1063418980), -INT32_C(  1063418980),  INT32_C(   424425339),  INT32_C(  1529432816), -INT32_C(  2069219572), -INT32_C(  1600145564),  INT32_C(  1217934786) } },
+    { {  INT64_C(                  19),  INT64_C(                   7),  INT64_C(                  20),  INT64_C(                  24),
+         INT64_C(                  15),  INT64_C(                   0),  INT64_C(                  16),  INT64_C(                  11) },
+      { -INT32_C(    28570237),  INT32_C(   890804293), -INT32_C(   275758621), -INT32_C(   579585160), -INT32_C(  1250094094), -INT32_C(   587393719),  INT32_C(  1291072093), -INT32_C(  1227398094) },
+      { -INT32_C(    28570237),  INT32_C(   890804293), -INT32_C(   275758621), -INT32_C(   579585160), -INT32_C(  1250094094), -INT32_C(   587393719),  INT32_C(  1291072093), -INT32_C(  1227398094) } },
+    { {  INT64_C(                  18),  INT64_C(                   3),  INT64_C(                  20),  INT64_C(                  23),
+         INT64_C(                  28),  INT64_C(                  12),  INT64_C(                  12),  INT64_C(                  31) },
+      { -INT32_C(  2037482226), -INT32_C(  1436351816),  INT32_C(  1600119062),  INT32_C(  1396399606), -INT32_C(  1046531953),  INT32_C(   108492692),  INT32_C(  1455238298),  INT32_C(   116763384) },
+      { -INT32_C(  2037482226), -INT32_C(  1436351816),  INT32_C(  1600119062),  INT32_C(  1396399606), -INT32_C(  1046531953),  INT32_C(  1455238298),  INT32_C(  1455238298),  INT32_C(   116763384) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_mm256_loadu_epi32(test_vec[i].a);
+    simde_mm512_i64scatter_epi32(HEDLEY_STATIC_CAST(void*, i32_buffer), vindex, a, 4);
+
+    int32_t rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[test_vec[i].vindex[j]]; }
+    simde__m256i r = simde_mm256_loadu_epi32(rv);
+    simde_test_x86_assert_equal_i32x8(r, simde_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m256i a = simde_test_x86_random_i32x8();
+    simde_mm512_i64scatter_epi32(i32_buffer, vindex, a, 4);
+
+    int64_t vi[8];
+    int32_t rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[vi[j]]; }
+    simde__m256i r = simde_mm256_loadu_epi32(rv);
+
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask8 k;
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 39),
+      {  INT64_C(                   4),  INT64_C(                  13),  INT64_C(                  31),  INT64_C(                   6),
+         INT64_C(                  16),  INT64_C(                   9),  INT64_C(                  28),  INT64_C(                  17) },
+      {  INT32_C(  1187576809),  INT32_C(  1742019383),  INT32_C(   855348923),  INT32_C(   986448398),  INT32_C(  1764893631), -INT32_C(  1668269800), -INT32_C(  1239191610), -INT32_C(   494354439) },
+      {  INT32_C(  1187576809),  INT32_C(  1742019383),  INT32_C(   855348923),  INT32_C(           6),  INT32_C(          16), -INT32_C(  1668269800),  INT32_C(          28),  INT32_C(          17) } },
+    { UINT8_C(187),
+      {  INT64_C(                  16),  INT64_C(                   8),  INT64_C(                  18),  INT64_C(                  11),
+         INT64_C(                  29),  INT64_C(                  25),  INT64_C(                   6),  INT64_C(                  19) },
+      {  INT32_C(  1453414484),  INT32_C(  1209457445),  INT32_C(  1197506318),  INT32_C(  2131623184), -INT32_C(   545733856), -INT32_C(  1684383157),  INT32_C(  2131201154),  INT32_C(   974335461) },
+      {  INT32_C(  1453414484),  INT32_C(  1209457445),  INT32_C(          18),  INT32_C(  2131623184), -INT32_C(   545733856), -INT32_C(  1684383157),  INT32_C(           6),  INT32_C(   974335461) } },
+    { UINT8_C(134),
+      {  INT64_C(                  20),  INT64_C(                  16),  INT64_C(                  11),  INT64_C(                  16),
+         INT64_C(                   6),  INT64_C(                  19),  INT64_C(                  30),  INT64_C(                   6) },
+      {  INT32_C(  1345774931), -INT32_C(  1250904590), -INT32_C(  2013179858),  INT32_C(  1997249770), -INT32_C(   782464349),  INT32_C(  1381471901), -INT32_C(   840826329),  INT32_C(  1223917813) },
+      {  INT32_C(          20), -INT32_C(  1250904590), -INT32_C(  2013179858), -INT32_C(  1250904590),  INT32_C(  1223917813),  INT32_C(          19),  INT32_C(          30),  INT32_C(  1223917813) } },
+    { UINT8_C(101),
+      {  INT64_C(                   9),  INT64_C(                  25),  INT64_C(                  23),  INT64_C(                  31),
+         INT64_C(                   9),  INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  25) },
+      { -INT32_C(  1438345971),  INT32_C(   726514592), -INT32_C(  1362616809),  INT32_C(  2010454645),  INT32_C(  2087494396), -INT32_C(  1075726954),  INT32_C(  1469986894),  INT32_C(  1387375429) },
+      { -INT32_C(  1438345971),  INT32_C(          25), -INT32_C(  1362616809),  INT32_C(          31), -INT32_C(  1438345971), -INT32_C(  1075726954),  INT32_C(  1469986894),  INT32_C(          25) } },
+    { UINT8_C( 65),
+      {  INT64_C(                  21),  INT64_C(                  28),  INT64_C(                   1),  INT64_C(                  16),
+         INT64_C(                  10),  INT64_C(                  12),  INT64_C(                   7),  INT64_C(                   8) },
+      { -INT32_C(   270633515), -INT32_C(   303278774),  INT32_C(  2005100738), -INT32_C(  2101001654), -INT32_C(  1933107999), -INT32_C(  1026745651),  INT32_C(  1618128662), -INT32_C(  1865860421) },
+      { -INT32_C(   270633515),  INT32_C(          28),  INT32_C(           1),  INT32_C(          16),  INT32_C(          10),  INT32_C(          12),  INT32_C(  1618128662),  INT32_C(           8) } },
+    { UINT8_C(175),
+      {  INT64_C(                   7),  INT64_C(                   0),  INT64_C(                  26),  INT64_C(                  28),
+         INT64_C(                  12),  INT64_C(                   7),  INT64_C(                  30),  INT64_C(                  20) },
+      { -INT32_C(  1407306390),  INT32_C(   395158010), -INT32_C(  2098980248), -INT32_C(  1768314905),  INT32_C(  1397946649),  INT32_C(  1761862338), -INT32_C(   832111262),  INT32_C(  1319314660) },
+      {  INT32_C(  1761862338),  INT32_C(   395158010), -INT32_C(  2098980248), -INT32_C(  1768314905),  INT32_C(          12),  INT32_C(  1761862338),  INT32_C(          30),  INT32_C(  1319314660) } },
+    { UINT8_C( 90),
+      {  INT64_C(                   1),  INT64_C(                  26),  INT64_C(                  20),  INT64_C(                   2),
+         INT64_C(                   8),  INT64_C(                  11),  INT64_C(                  11),  INT64_C(                   2) },
+      { -INT32_C(   141996720), -INT32_C(   535813914),  INT32_C(  1419928690),  INT32_C(  1689717863), -INT32_C(  1773632142), -INT32_C(   353331672),  INT32_C(   407651728),  INT32_C(    12195760) },
+      {  INT32_C(           1), -INT32_C(   535813914),  INT32_C(          20),  INT32_C(  1689717863), -INT32_C(  1773632142),  INT32_C(   407651728),  INT32_C(   407651728),  INT32_C(  1689717863) } },
+    { UINT8_C(101),
+      {  INT64_C(                   4),  INT64_C(                  23),  INT64_C(                  11),  INT64_C(                   4),
+         INT64_C(                   8),  INT64_C(                  11),  INT64_C(                  22),  INT64_C(                  12) },
+      { -INT32_C(   623695154),  INT32_C(  1733048289),  INT32_C(   361751167),  INT32_C(   413497811), -INT32_C(   574046522), -INT32_C(  1136473736), -INT32_C(   937390400), -INT32_C(  2026572103) },
+      { -INT32_C(   623695154),  INT32_C(          23), -INT32_C(  1136473736), -INT32_C(   623695154),  INT32_C(           8), -INT32_C(  1136473736), -INT32_C(   937390400),  INT32_C(          12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_mm256_loadu_epi32(test_vec[i].a);
+    simde_mm512_mask_i64scatter_epi32(HEDLEY_STATIC_CAST(void*, i32_buffer), test_vec[i].k, vindex, a, 4);
+
+    int32_t rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[test_vec[i].vindex[j]]; }
+    simde__m256i r = simde_mm256_loadu_epi32(rv);
+    simde_test_x86_assert_equal_i32x8(r, simde_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i32_buffer) / sizeof(i32_buffer[0])) ; j++) { i32_buffer[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m256i a = simde_test_x86_random_i32x8();
+    simde_mm512_mask_i64scatter_epi32(i32_buffer, k, vindex, a, 4);
+
+    int64_t vi[8];
+    int32_t rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i32_buffer[vi[j]]; }
+    simde__m256i r = simde_mm256_loadu_epi32(rv);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { {  INT64_C(                   1),  INT64_C(                   7),  INT64_C(                   1),  INT64_C(                   2),
+         INT64_C(                  30),  INT64_C(                  13),  INT64_C(                   9),  INT64_C(                  29) },
+      { SIMDE_FLOAT32_C(  -857.13), SIMDE_FLOAT32_C(  -784.82), SIMDE_FLOAT32_C(   497.63), SIMDE_FLOAT32_C(   516.10),
+        SIMDE_FLOAT32_C(   870.42), SIMDE_FLOAT32_C(  -207.86), SIMDE_FLOAT32_C(   939.30), SIMDE_FLOAT32_C(   650.09) },
+      { SIMDE_FLOAT32_C(   497.63), SIMDE_FLOAT32_C(  -784.82), SIMDE_FLOAT32_C(   497.63), SIMDE_FLOAT32_C(   516.10),
+        SIMDE_FLOAT32_C(   870.42), SIMDE_FLOAT32_C(  -207.86), SIMDE_FLOAT32_C(   939.30), SIMDE_FLOAT32_C(   650.09) } },
+    { {  INT64_C(                  22),  INT64_C(                   3),  INT64_C(                  22),  INT64_C(                  14),
+         INT64_C(                  12),  INT64_C(                  24),  INT64_C(                  11),  INT64_C(                  13) },
+      { SIMDE_FLOAT32_C(  -844.89), SIMDE_FLOAT32_C(  -415.71), SIMDE_FLOAT32_C(  -875.29), SIMDE_FLOAT32_C(   131.53),
+        SIMDE_FLOAT32_C(   593.65), SIMDE_FLOAT32_C(  -482.16), SIMDE_FLOAT32_C(  -841.52), SIMDE_FLOAT32_C(   178.87) },
+      { SIMDE_FLOAT32_C(  -875.29), SIMDE_FLOAT32_C(  -415.71), SIMDE_FLOAT32_C(  -875.29), SIMDE_FLOAT32_C(   131.53),
+        SIMDE_FLOAT32_C(   593.65), SIMDE_FLOAT32_C(  -482.16), SIMDE_FLOAT32_C(  -841.52), SIMDE_FLOAT32_C(   178.87) } },
+    { {  INT64_C(                  17),  INT64_C(                   9),  INT64_C(                   5),  INT64_C(                  16),
+         INT64_C(                  22),  INT64_C(                  15),  INT64_C(                  13),  INT64_C(                   6) },
+      { SIMDE_FLOAT32_C(   686.63), SIMDE_FLOAT32_C(   920.93), SIMDE_FLOAT32_C(   854.66), SIMDE_FLOAT32_C(   557.05),
+        SIMDE_FLOAT32_C(  -286.93), SIMDE_FLOAT32_C(   793.96), SIMDE_FLOAT32_C(   207.14), SIMDE_FLOAT32_C(  -897.72) },
+      { SIMDE_FLOAT32_C(   686.63), SIMDE_FLOAT32_C(   920.93), SIMDE_FLOAT32_C(   854.66), SIMDE_FLOAT32_C(   557.05),
+        SIMDE_FLOAT32_C(  -286.93), SIMDE_FLOAT32_C(   793.96), SIMDE_FLOAT32_C(   207.14), SIMDE_FLOAT32_C(  -897.72) } },
+    { {  INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  28),  INT64_C(                  20),
+         INT64_C(                   1),  INT64_C(                   7),  INT64_C(                   1),  INT64_C(                   8) },
+      { SIMDE_FLOAT32_C(   700.25), SIMDE_FLOAT32_C(   319.54), SIMDE_FLOAT32_C(  -505.44), SIMDE_FLOAT32_C(   293.89),
+        SIMDE_FLOAT32_C(   837.37), SIMDE_FLOAT32_C(  -346.96), SIMDE_FLOAT32_C(  -527.24), SIMDE_FLOAT32_C(  -925.46) },
+      { SIMDE_FLOAT32_C(  -925.46), SIMDE_FLOAT32_C(   319.54), SIMDE_FLOAT32_C(  -505.44), SIMDE_FLOAT32_C(   293.89),
+        SIMDE_FLOAT32_C(  -527.24), SIMDE_FLOAT32_C(  -346.96), SIMDE_FLOAT32_C(  -527.24), SIMDE_FLOAT32_C(  -925.46) } },
+    { {  INT64_C(                  24),  INT64_C(                  29),  INT64_C(                   2),  INT64_C(                  15),
+         INT64_C(                  12),  INT64_C(                  16),  INT64_C(                  21),  INT64_C(                  20) },
+      { SIMDE_FLOAT32_C(   962.54), SIMDE_FLOAT32_C(  -265.03), SIMDE_FLOAT32_C(  -706.68), SIMDE_FLOAT32_C(  -324.39),
+        SIMDE_FLOAT32_C(  -471.07), SIMDE_FLOAT32_C(   500.46), SIMDE_FLOAT32_C(  -222.10), SIMDE_FLOAT32_C(  -549.52) },
+      { SIMDE_FLOAT32_C(   962.54), SIMDE_FLOAT32_C(  -265.03), SIMDE_FLOAT32_C(  -706.68), SIMDE_FLOAT32_C(  -324.39),
+        SIMDE_FLOAT32_C(  -471.07), SIMDE_FLOAT32_C(   500.46), SIMDE_FLOAT32_C(  -222.10), SIMDE_FLOAT32_C(  -549.52) } },
+    { {  INT64_C(                  11),  INT64_C(                  18),  INT64_C(                   0),  INT64_C(                  12),
+         INT64_C(                  26),  INT64_C(                   1),  INT64_C(                  20),  INT64_C(                  13) },
+      { SIMDE_FLOAT32_C(   697.40), SIMDE_FLOAT32_C(  -724.28), SIMDE_FLOAT32_C(   204.74), SIMDE_FLOAT32_C(   534.77),
+        SIMDE_FLOAT32_C(   -71.25), SIMDE_FLOAT32_C(   677.50), SIMDE_FLOAT32_C(   609.31), SIMDE_FLOAT32_C(   274.82) },
+      { SIMDE_FLOAT32_C(   697.40), SIMDE_FLOAT32_C(  -724.28), SIMDE_FLOAT32_C(   204.74), SIMDE_FLOAT32_C(   534.77),
+        SIMDE_FLOAT32_C(   -71.25), SIMDE_FLOAT32_C(   677.50), SIMDE_FLOAT32_C(   609.31), SIMDE_FLOAT32_C(   274.82) } },
+    { {  INT64_C(                  23),  INT64_C(                  14),  INT64_C(                  19),  INT64_C(                   4),
+         INT64_C(                  30),  INT64_C(                   9),  INT64_C(                  24),  INT64_C(                  14) },
+      { SIMDE_FLOAT32_C(   431.86), SIMDE_FLOAT32_C(   334.91), SIMDE_FLOAT32_C(   907.40), SIMDE_FLOAT32_C(   960.79),
+        SIMDE_FLOAT32_C(  -164.63), SIMDE_FLOAT32_C(  -314.70), SIMDE_FLOAT32_C(  -588.74), SIMDE_FLOAT32_C(  -954.42) },
+      { SIMDE_FLOAT32_C(   431.86), SIMDE_FLOAT32_C(  -954.42), SIMDE_FLOAT32_C(   907.40), SIMDE_FLOAT32_C(   960.79),
+        SIMDE_FLOAT32_C(  -164.63), SIMDE_FLOAT32_C(  -314.70), SIMDE_FLOAT32_C(  -588.74), SIMDE_FLOAT32_C(  -954.42) } },
+    { {  INT64_C(                  31),  INT64_C(                  23),  INT64_C(                   1),  INT64_C(                  25),
+         INT64_C(                  24),  INT64_C(                  21),  INT64_C(                   6),  INT64_C(                  17) },
+      { SIMDE_FLOAT32_C(  -479.41), SIMDE_FLOAT32_C(   106.12), SIMDE_FLOAT32_C(   204.32), SIMDE_FLOAT32_C(   449.34),
+        SIMDE_FLOAT32_C(  -216.38), SIMDE_FLOAT32_C(  -186.37), SIMDE_FLOAT32_C(  -275.84), SIMDE_FLOAT32_C(  -960.69) },
+      { SIMDE_FLOAT32_C(  -479.41), SIMDE_FLOAT32_C(   106.12), SIMDE_FLOAT32_C(   204.32), SIMDE_FLOAT32_C(   449.34),
+        SIMDE_FLOAT32_C(  -216.38), SIMDE_FLOAT32_C(  -186.37), SIMDE_FLOAT32_C(  -275.84), SIMDE_FLOAT32_C(  -960.69) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_mm512_i64scatter_ps(HEDLEY_STATIC_CAST(void*, f32_buffer), vindex, a, 4);
+
+    simde_float32 rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[test_vec[i].vindex[j]]; }
+    simde__m256 r = simde_mm256_loadu_ps(rv);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m256 a = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_mm512_i64scatter_ps(f32_buffer, vindex, a, 4);
+
+    int64_t vi[8];
+    simde_float32 rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[vi[j]]; }
+    simde__m256 r = simde_mm256_loadu_ps(rv);
+
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(197),
+      {  INT64_C(                  22),  INT64_C(                  29),  INT64_C(                   3),  INT64_C(                  31),
+         INT64_C(                  22),  INT64_C(                  18),  INT64_C(                   7),  INT64_C(                  29) },
+      { SIMDE_FLOAT32_C(  -550.30), SIMDE_FLOAT32_C(  -369.74), SIMDE_FLOAT32_C(   556.51), SIMDE_FLOAT32_C(   135.00),
+        SIMDE_FLOAT32_C(    41.52), SIMDE_FLOAT32_C(   602.09), SIMDE_FLOAT32_C(   -85.06), SIMDE_FLOAT32_C(  -364.18) },
+      { SIMDE_FLOAT32_C(  -550.30), SIMDE_FLOAT32_C(  -364.18), SIMDE_FLOAT32_C(   556.51), SIMDE_FLOAT32_C(    31.00),
+        SIMDE_FLOAT32_C(  -550.30), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(   -85.06), SIMDE_FLOAT32_C(  -364.18) } },
+    { UINT8_C( 92),
+      {  INT64_C(                  13),  INT64_C(                  25),  INT64_C(                  18),  INT64_C(                  19),
+         INT64_C(                  10),  INT64_C(                   4),  INT64_C(                  27),  INT64_C(                  20) },
+      { SIMDE_FLOAT32_C(  -719.38), SIMDE_FLOAT32_C(  -303.40), SIMDE_FLOAT32_C(  -704.54), SIMDE_FLOAT32_C(     4.78),
+        SIMDE_FLOAT32_C(  -264.09), SIMDE_FLOAT32_C(  -663.28), SIMDE_FLOAT32_C(   545.51), SIMDE_FLOAT32_C(    80.54) },
+      { SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(  -704.54), SIMDE_FLOAT32_C(     4.78),
+        SIMDE_FLOAT32_C(  -264.09), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   545.51), SIMDE_FLOAT32_C(    20.00) } },
+    { UINT8_C(211),
+      {  INT64_C(                  25),  INT64_C(                  10),  INT64_C(                   5),  INT64_C(                   0),
+         INT64_C(                   7),  INT64_C(                  14),  INT64_C(                  19),  INT64_C(                  14) },
+      { SIMDE_FLOAT32_C(   774.22), SIMDE_FLOAT32_C(   124.39), SIMDE_FLOAT32_C(  -653.48), SIMDE_FLOAT32_C(  -310.84),
+        SIMDE_FLOAT32_C(   760.21), SIMDE_FLOAT32_C(  -587.67), SIMDE_FLOAT32_C(   594.63), SIMDE_FLOAT32_C(  -631.83) },
+      { SIMDE_FLOAT32_C(   774.22), SIMDE_FLOAT32_C(   124.39), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   760.21), SIMDE_FLOAT32_C(  -631.83), SIMDE_FLOAT32_C(   594.63), SIMDE_FLOAT32_C(  -631.83) } },
+    { UINT8_C( 88),
+      {  INT64_C(                  23),  INT64_C(                   0),  INT64_C(                  28),  INT64_C(                  18),
+         INT64_C(                  20),  INT64_C(                  30),  INT64_C(                  15),  INT64_C(                  31) },
+      { SIMDE_FLOAT32_C(  -160.32), SIMDE_FLOAT32_C(   746.97), SIMDE_FLOAT32_C(  -240.30), SIMDE_FLOAT32_C(  -614.81),
+        SIMDE_FLOAT32_C(  -172.49), SIMDE_FLOAT32_C(  -593.07), SIMDE_FLOAT32_C(   168.32), SIMDE_FLOAT32_C(   294.27) },
+      { SIMDE_FLOAT32_C(    23.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(  -614.81),
+        SIMDE_FLOAT32_C(  -172.49), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(   168.32), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT8_C(136),
+      {  INT64_C(                  23),  INT64_C(                  11),  INT64_C(                  22),  INT64_C(                  10),
+         INT64_C(                  25),  INT64_C(                  25),  INT64_C(                   7),  INT64_C(                   3) },
+      { SIMDE_FLOAT32_C(   699.04), SIMDE_FLOAT32_C(   588.39), SIMDE_FLOAT32_C(   985.45), SIMDE_FLOAT32_C(   293.67),
+        SIMDE_FLOAT32_C(   956.56), SIMDE_FLOAT32_C(  -291.54), SIMDE_FLOAT32_C(   695.16), SIMDE_FLOAT32_C(  -397.75) },
+      { SIMDE_FLOAT32_C(    23.00), SIMDE_FLOAT32_C(    11.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(   293.67),
+        SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(  -397.75) } },
+    { UINT8_C(127),
+      {  INT64_C(                  29),  INT64_C(                  14),  INT64_C(                  29),  INT64_C(                  12),
+         INT64_C(                  14),  INT64_C(                   0),  INT64_C(                  18),  INT64_C(                  29) },
+      { SIMDE_FLOAT32_C(   322.51), SIMDE_FLOAT32_C(   595.16), SIMDE_FLOAT32_C(  -680.61), SIMDE_FLOAT32_C(  -509.17),
+        SIMDE_FLOAT32_C(  -110.57), SIMDE_FLOAT32_C(   -84.16), SIMDE_FLOAT32_C(   111.76), SIMDE_FLOAT32_C(   371.62) },
+      { SIMDE_FLOAT32_C(  -680.61), SIMDE_FLOAT32_C(  -110.57), SIMDE_FLOAT32_C(  -680.61), SIMDE_FLOAT32_C(  -509.17),
+        SIMDE_FLOAT32_C(  -110.57), SIMDE_FLOAT32_C(   -84.16), SIMDE_FLOAT32_C(   111.76), SIMDE_FLOAT32_C(  -680.61) } },
+    { UINT8_C( 31),
+      {  INT64_C(                  23),  INT64_C(                  19),  INT64_C(                  25),  INT64_C(                  30),
+         INT64_C(                  23),  INT64_C(                   9),  INT64_C(                   2),  INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(  -845.89), SIMDE_FLOAT32_C(   188.68), SIMDE_FLOAT32_C(  -134.75), SIMDE_FLOAT32_C(   849.27),
+        SIMDE_FLOAT32_C(   790.93), SIMDE_FLOAT32_C(   127.99), SIMDE_FLOAT32_C(   858.90), SIMDE_FLOAT32_C(  -479.30) },
+      { SIMDE_FLOAT32_C(   790.93), SIMDE_FLOAT32_C(   188.68), SIMDE_FLOAT32_C(  -134.75), SIMDE_FLOAT32_C(   849.27),
+        SIMDE_FLOAT32_C(   790.93), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     1.00) } },
+    { UINT8_C(160),
+      {  INT64_C(                  19),  INT64_C(                  18),  INT64_C(                   0),  INT64_C(                   5),
+         INT64_C(                  16),  INT64_C(                  30),  INT64_C(                  17),  INT64_C(                  16) },
+      { SIMDE_FLOAT32_C(   976.28), SIMDE_FLOAT32_C(  -868.18), SIMDE_FLOAT32_C(  -178.87), SIMDE_FLOAT32_C(    88.05),
+        SIMDE_FLOAT32_C(   503.44), SIMDE_FLOAT32_C(   -27.36), SIMDE_FLOAT32_C(   -96.40), SIMDE_FLOAT32_C(  -898.33) },
+      { SIMDE_FLOAT32_C(    19.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     5.00),
+        SIMDE_FLOAT32_C(  -898.33), SIMDE_FLOAT32_C(   -27.36), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(  -898.33) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_mm512_mask_i64scatter_ps(HEDLEY_STATIC_CAST(void*, f32_buffer), test_vec[i].k, vindex, a, 4);
+
+    simde_float32 rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[test_vec[i].vindex[j]]; }
+    simde__m256 r = simde_mm256_loadu_ps(rv);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f32_buffer) / sizeof(f32_buffer[0])) ; j++) { f32_buffer[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m256 a = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_mm512_mask_i64scatter_ps(f32_buffer, k, vindex, a, 4);
+
+    int64_t vi[8];
+    simde_float32 rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f32_buffer[vi[j]]; }
+    simde__m256 r = simde_mm256_loadu_ps(rv);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                  18),  INT64_C(                  21),  INT64_C(                   4),  INT64_C(                  27),
+         INT64_C(                  23),  INT64_C(                   5),  INT64_C(                  25),  INT64_C(                  19) },
+      { -INT64_C(  213061944095423735), -INT64_C( 2395786449893733184),  INT64_C(  395109037141531348), -INT64_C( 1273328038326517654),
+         INT64_C( 3045670755147341309), -INT64_C( 1154404629342410959),  INT64_C( 8605773114583636181), -INT64_C( 6598603965502820967) },
+      { -INT64_C(  213061944095423735), -INT64_C( 2395786449893733184),  INT64_C(  395109037141531348), -INT64_C( 1273328038326517654),
+         INT64_C( 3045670755147341309), -INT64_C( 1154404629342410959),  INT64_C( 8605773114583636181), -INT64_C( 6598603965502820967) } },
+    { {  INT64_C(                   9),  INT64_C(                   7),  INT64_C(                  11),  INT64_C(                  19),
+         INT64_C(                  12),  INT64_C(                  16),  INT64_C(                  30),  INT64_C(                  30) },
+      { -INT64_C( 8583169623581853481), -INT64_C( 5597871971209559860),  INT64_C( 9013845890345994443),  INT64_C(  787934438906397284),
+        -INT64_C( 6231891314858956473), -INT64_C( 7139662463204429025),  INT64_C( 2119829525806062554),  INT64_C( 5864985282539862824) },
+      { -INT64_C( 8583169623581853481), -INT64_C( 5597871971209559860),  INT64_C( 9013845890345994443),  INT64_C(  787934438906397284),
+        -INT64_C( 6231891314858956473), -INT64_C( 7139662463204429025),  INT64_C( 5864985282539862824),  INT64_C( 5864985282539862824) } },
+    { {  INT64_C(                   6),  INT64_C(                   1),  INT64_C(                  11),  INT64_C(                   3),
+         INT64_C(                   1),  INT64_C(                  14),  INT64_C(                  12),  INT64_C(                   0) },
+      { -INT64_C( 4994628463305879998),  INT64_C(  825306498864823710), -INT64_C( 4239634648874540338), -INT64_C( 8805324232249019093),
+        -INT64_C( 8584907723041642942),  INT64_C( 7346307329083540485),  INT64_C( 5690693000762382453),  INT64_C( 1703917383476486620) },
+      { -INT64_C( 4994628463305879998), -INT64_C( 8584907723041642942), -INT64_C( 4239634648874540338), -INT64_C( 8805324232249019093),
+        -INT64_C( 8584907723041642942),  INT64_C( 7346307329083540485),  INT64_C( 5690693000762382453),  INT64_C( 1703917383476486620) } },
+    { {  INT64_C(                  13),  INT64_C(                  30),  INT64_C(                  25),  INT64_C(                  23),
+         INT64_C(                   5),  INT64_C(                  21),  INT64_C(                  31),  INT64_C(                  10) },
+      {  INT64_C(  474397010014912153),  INT64_C( 1670328844059071422),  INT64_C( 6827700511038761428), -INT64_C( 6400859654838683365),
+        -INT64_C( 4509954790019064366), -INT64_C( 6155628121046277312), -INT64_C( 4429550099821770055),  INT64_C( 2504438242974284812) },
+      {  INT64_C(  474397010014912153),  INT64_C( 1670328844059071422),  INT64_C( 6827700511038761428), -INT64_C( 6400859654838683365),
+        -INT64_C( 4509954790019064366), -INT64_C( 6155628121046277312), -INT64_C( 4429550099821770055),  INT64_C( 2504438242974284812) } },
+    { {  INT64_C(                  11),  INT64_C(                  24),  INT64_C(                   5),  INT64_C(                  14),
+         INT64_C(                   4),  INT64_C(                  14),  INT64_C(                  15),  INT64_C(                   4) },
+      {  INT64_C( 1806315499563225233), -INT64_C( 8969540467112582116), -INT64_C( 6847056423241783417), -INT64_C(   54116386136489994),
+         INT64_C( 7910423562713300813),  INT64_C( 6690297174303967965), -INT64_C( 3841238618325420644), -INT64_C( 8495471991358914643) },
+      {  INT64_C( 1806315499563225233), -INT64_C( 8969540467112582116), -INT64_C( 6847056423241783417),  INT64_C( 6690297174303967965),
+        -INT64_C( 8495471991358914643),  INT64_C( 6690297174303967965), -INT64_C( 3841238618325420644), -INT64_C( 8495471991358914643) } },
+    { {  INT64_C(                   4),  INT64_C(                   1),  INT64_C(                  24),  INT64_C(                  21),
+         INT64_C(                  26),  INT64_C(                  31),  INT64_C(                   2),  INT64_C(                  23) },
+      {  INT64_C( 4844469843705721354),  INT64_C( 5266685557615193721), -INT64_C( 1851965834367017594), -INT64_C( 8155458702615542784),
+         INT64_C( 8780233669012749551), -INT64_C( 4901080546760315370), -INT64_C( 2413143392860151878), -INT64_C( 6241802463669076658) },
+      {  INT64_C( 4844469843705721354),  INT64_C( 5266685557615193721), -INT64_C( 1851965834367017594), -INT64_C( 8155458702615542784),
+         INT64_C( 8780233669012749551), -INT64_C( 4901080546760315370), -INT64_C( 2413143392860151878), -INT64_C( 6241802463669076658) } },
+    { {  INT64_C(                   5),  INT64_C(                  13),  INT64_C(                  31),  INT64_C(                   5),
+         INT64_C(                  21),  INT64_C(                  25),  INT64_C(                  30),  INT64_C(                  12) },
+      {  INT64_C( 8950687391404713031), -INT64_C( 3650840951152593511),  INT64_C( 8988341350753643865),  INT64_C( 6759692025771195598),
+        -INT64_C( 2205900387673108956),  INT64_C( 8075708496799694022), -INT64_C( 9138294353838165284), -INT64_C( 5426674203379871683) },
+      {  INT64_C( 6759692025771195598), -INT64_C( 3650840951152593511),  INT64_C( 8988341350753643865),  INT64_C( 6759692025771195598),
+        -INT64_C( 2205900387673108956),  INT64_C( 8075708496799694022), -INT64_C( 9138294353838165284), -INT64_C( 5426674203379871683) } },
+    { {  INT64_C(                   2),  INT64_C(                   9),  INT64_C(                  27),  INT64_C(                  10),
+         INT64_C(                  26),  INT64_C(                  30),  INT64_C(                  11),  INT64_C(                   0) },
+      { -INT64_C( 5835898948297612166),  INT64_C(  332862607337817706), -INT64_C( 7411790327421901856),  INT64_C( 4002660743211368337),
+         INT64_C( 6122023471255466355), -INT64_C( 4171440574413318575),  INT64_C(  865636139006325875),  INT64_C( 5120527719783237146) },
+      { -INT64_C( 5835898948297612166),  INT64_C(  332862607337817706), -INT64_C( 7411790327421901856),  INT64_C( 4002660743211368337),
+         INT64_C( 6122023471255466355), -INT64_C( 4171440574413318575),  INT64_C(  865636139006325875),  INT64_C( 5120527719783237146) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_i64scatter_epi64(HEDLEY_STATIC_CAST(void*, i64_buffer), vindex, a, 8);
+
+    int64_t rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512i a = simde_test_x86_random_i64x8();
+    simde_mm512_i64scatter_epi64(i64_buffer, vindex, a, 8);
+
+    int64_t vi[8];
+    int64_t rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[vi[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask8 k;
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(245),
+      {  INT64_C(                  24),  INT64_C(                  13),  INT64_C(                  31),  INT64_C(                   3),
+         INT64_C(                   2),  INT64_C(                  19),  INT64_C(                  20),  INT64_C(                  25) },
+      { -INT64_C( 7122576771978949468),  INT64_C( 1887612511794532796), -INT64_C( 1002554385471960483), -INT64_C( 3666059666068736572),
+         INT64_C( 2403982555578752918), -INT64_C(  582816364121983686), -INT64_C( 3206512290344413067),  INT64_C( 3898210313100138020) },
+      { -INT64_C( 7122576771978949468),  INT64_C(                  13), -INT64_C( 1002554385471960483),  INT64_C(                   3),
+         INT64_C( 2403982555578752918), -INT64_C(  582816364121983686), -INT64_C( 3206512290344413067),  INT64_C( 3898210313100138020) } },
+    { UINT8_C( 24),
+      {  INT64_C(                  27),  INT64_C(                  22),  INT64_C(                  29),  INT64_C(                   4),
+         INT64_C(                  18),  INT64_C(                  30),  INT64_C(                  30),  INT64_C(                   7) },
+      {  INT64_C( 1132470825667087831), -INT64_C( 2538919929531447696), -INT64_C( 4297362954594283765),  INT64_C( 5747585399325776297),
+        -INT64_C( 1361695135912352556),  INT64_C( 3833213276088187279),  INT64_C(  742202653487509087), -INT64_C( 5875568200056941394) },
+      {  INT64_C(                  27),  INT64_C(                  22),  INT64_C(                  29),  INT64_C( 5747585399325776297),
+        -INT64_C( 1361695135912352556),  INT64_C(                  30),  INT64_C(                  30),  INT64_C(                   7) } },
+    { UINT8_C(237),
+      {  INT64_C(                   6),  INT64_C(                  25),  INT64_C(                  10),  INT64_C(                  15),
+         INT64_C(                  20),  INT64_C(                  24),  INT64_C(                  30),  INT64_C(                  13) },
+      {  INT64_C( 1482648988065150180), -INT64_C( 4941996458053854234),  INT64_C(  881935891635212422), -INT64_C( 1955060317828700163),
+         INT64_C( 7631538151266719342),  INT64_C( 7343278480637124294), -INT64_C( 4669402952237744864),  INT64_C( 3854359759164575129) },
+      {  INT64_C( 1482648988065150180),  INT64_C(                  25),  INT64_C(  881935891635212422), -INT64_C( 1955060317828700163),
+         INT64_C(                  20),  INT64_C( 7343278480637124294), -INT64_C( 4669402952237744864),  INT64_C( 3854359759164575129) } },
+    { UINT8_C(133),
+      {  INT64_C(                  21),  INT64_C(                   9),  INT64_C(                   8),  INT64_C(                   0),
+         INT64_C(                  18),  INT64_C(                  17),  INT64_C(                   6),  INT64_C(                  16) },
+      { -INT64_C( 7473841112743988329),  INT64_C( 3302574073449180490), -INT64_C( 9179133276286849367), -INT64_C( 5875290861138303693),
+        -INT64_C( 8886415453948893703), -INT64_C( 3938795759205349494), -INT64_C( 6309402933416801532), -INT64_C( 1014922937350868699) },
+      { -INT64_C( 7473841112743988329),  INT64_C(                   9), -INT64_C( 9179133276286849367),  INT64_C(                   0),
+         INT64_C(                  18),  INT64_C(                  17),  INT64_C(                   6), -INT64_C( 1014922937350868699) } },
+    { UINT8_C(233),
+      {  INT64_C(                  31),  INT64_C(                   5),  INT64_C(                   4),  INT64_C(                  27),
+         INT64_C(                  18),  INT64_C(                   8),  INT64_C(                   5),  INT64_C(                  25) },
+      {  INT64_C( 3459789146985959273), -INT64_C( 7698535896531471483),  INT64_C( 1029491769706571036),  INT64_C( 9218673919063125379),
+        -INT64_C( 1084099310431319842),  INT64_C(  319226609027881589), -INT64_C(  296483890998740348), -INT64_C(  382771766676632549) },
+      {  INT64_C( 3459789146985959273), -INT64_C(  296483890998740348),  INT64_C(                   4),  INT64_C( 9218673919063125379),
+         INT64_C(                  18),  INT64_C(  319226609027881589), -INT64_C(  296483890998740348), -INT64_C(  382771766676632549) } },
+    { UINT8_C(232),
+      {  INT64_C(                  14),  INT64_C(                  30),  INT64_C(                  19),  INT64_C(                  15),
+         INT64_C(                  18),  INT64_C(                   4),  INT64_C(                   4),  INT64_C(                  12) },
+      {  INT64_C( 7411579645444029753),  INT64_C( 6730024436224667548),  INT64_C( 8363591628672767497), -INT64_C( 2220476201067912144),
+         INT64_C( 4113779447847019589), -INT64_C( 2904284311798417981), -INT64_C( 3659155332237612418), -INT64_C( 1657078771184805002) },
+      {  INT64_C(                  14),  INT64_C(                  30),  INT64_C(                  19), -INT64_C( 2220476201067912144),
+         INT64_C(                  18), -INT64_C( 3659155332237612418), -INT64_C( 3659155332237612418), -INT64_C( 1657078771184805002) } },
+    { UINT8_C( 67),
+      {  INT64_C(                  25),  INT64_C(                  26),  INT64_C(                   0),  INT64_C(                  13),
+         INT64_C(                  17),  INT64_C(                  25),  INT64_C(                  17),  INT64_C(                   6) },
+      {  INT64_C( 4684389126797288860),  INT64_C( 6472705098934765132),  INT64_C( 3133914843765928538),  INT64_C( 1357704953404611968),
+        -INT64_C( 2141575327668352017),  INT64_C( 3005611582643250270),  INT64_C( 1811258051553112837),  INT64_C( 1425144248630156094) },
+      {  INT64_C( 4684389126797288860),  INT64_C( 6472705098934765132),  INT64_C(                   0),  INT64_C(                  13),
+         INT64_C( 1811258051553112837),  INT64_C( 4684389126797288860),  INT64_C( 1811258051553112837),  INT64_C(                   6) } },
+    { UINT8_C(108),
+      {  INT64_C(                  30),  INT64_C(                  25),  INT64_C(                   2),  INT64_C(                  22),
+         INT64_C(                   0),  INT64_C(                   5),  INT64_C(                  21),  INT64_C(                   5) },
+      {  INT64_C( 1891086775822364965), -INT64_C(  936524040897350175), -INT64_C( 2620202741404289770), -INT64_C( 5752743192788097468),
+        -INT64_C( 2568697776910598440), -INT64_C( 1105739421814223524),  INT64_C( 3363287226835844692),  INT64_C( 8983834241755479665) },
+      {  INT64_C(                  30),  INT64_C(                  25), -INT64_C( 2620202741404289770), -INT64_C( 5752743192788097468),
+         INT64_C(                   0), -INT64_C( 1105739421814223524),  INT64_C( 3363287226835844692), -INT64_C( 1105739421814223524) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde_mm512_mask_i64scatter_epi64(HEDLEY_STATIC_CAST(void*, i64_buffer), test_vec[i].k, vindex, a, 8);
+
+    int64_t rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(i64_buffer) / sizeof(i64_buffer[0])) ; j++) { i64_buffer[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512i a = simde_test_x86_random_i64x8();
+    simde_mm512_mask_i64scatter_epi64(i64_buffer, k, vindex, a, 8);
+
+    int64_t vi[8];
+    int64_t rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = i64_buffer[vi[j]]; }
+    simde__m512i r = simde_mm512_loadu_epi64(rv);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { {  INT64_C(                  27),  INT64_C(                  21),  INT64_C(                  28),  INT64_C(                  22),
+         INT64_C(                  27),  INT64_C(                  22),  INT64_C(                  19),  INT64_C(                  23) },
+      { SIMDE_FLOAT64_C(   362.67), SIMDE_FLOAT64_C(   364.93), SIMDE_FLOAT64_C(   984.65), SIMDE_FLOAT64_C(  -251.47),
+        SIMDE_FLOAT64_C(  -561.72), SIMDE_FLOAT64_C(  -492.49), SIMDE_FLOAT64_C(   892.84), SIMDE_FLOAT64_C(   584.69) },
+      { SIMDE_FLOAT64_C(  -561.72), SIMDE_FLOAT64_C(   364.93), SIMDE_FLOAT64_C(   984.65), SIMDE_FLOAT64_C(  -492.49),
+        SIMDE_FLOAT64_C(  -561.72), SIMDE_FLOAT64_C(  -492.49), SIMDE_FLOAT64_C(   892.84), SIMDE_FLOAT64_C(   584.69) } },
+    { {  INT64_C(                  17),  INT64_C(                  22),  INT64_C(                  22),  INT64_C(                  26),
+         INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   8),  INT64_C(                  19) },
+      { SIMDE_FLOAT64_C(  -188.63), SIMDE_FLOAT64_C(   716.59), SIMDE_FLOAT64_C(  -109.71), SIMDE_FLOAT64_C(  -654.95),
+        SIMDE_FLOAT64_C(   122.81), SIMDE_FLOAT64_C(   646.37), SIMDE_FLOAT64_C(   137.82), SIMDE_FLOAT64_C(   682.25) },
+      { SIMDE_FLOAT64_C(  -188.63), SIMDE_FLOAT64_C(  -109.71), SIMDE_FLOAT64_C(  -109.71), SIMDE_FLOAT64_C(  -654.95),
+        SIMDE_FLOAT64_C(   122.81), SIMDE_FLOAT64_C(   646.37), SIMDE_FLOAT64_C(   137.82), SIMDE_FLOAT64_C(   682.25) } },
+    { {  INT64_C(                  17),  INT64_C(                  30),  INT64_C(                  10),  INT64_C(                  12),
+         INT64_C(                  20),  INT64_C(                  29),  INT64_C(                   4),  INT64_C(                  23) },
+      { SIMDE_FLOAT64_C(  -439.60), SIMDE_FLOAT64_C(  -674.46), SIMDE_FLOAT64_C(  -137.56), SIMDE_FLOAT64_C(    -1.33),
+        SIMDE_FLOAT64_C(  -166.95), SIMDE_FLOAT64_C(  -244.72), SIMDE_FLOAT64_C(  -416.63), SIMDE_FLOAT64_C(  -535.33) },
+      { SIMDE_FLOAT64_C(  -439.60), SIMDE_FLOAT64_C(  -674.46), SIMDE_FLOAT64_C(  -137.56), SIMDE_FLOAT64_C(    -1.33),
+        SIMDE_FLOAT64_C(  -166.95), SIMDE_FLOAT64_C(  -244.72), SIMDE_FLOAT64_C(  -416.63), SIMDE_FLOAT64_C(  -535.33) } },
+    { {  INT64_C(                  25),  INT64_C(                  26),  INT64_C(                  13),  INT64_C(                  26),
+         INT64_C(                  29),  INT64_C(                  22),  INT64_C(                  13),  INT64_C(                  30) },
+      { SIMDE_FLOAT64_C(  -275.68), SIMDE_FLOAT64_C(   -12.62), SIMDE_FLOAT64_C(   903.29), SIMDE_FLOAT64_C(   847.12),
+        SIMDE_FLOAT64_C(  -366.24), SIMDE_FLOAT64_C(    41.10), SIMDE_FLOAT64_C(   529.38), SIMDE_FLOAT64_C(   899.96) },
+      { SIMDE_FLOAT64_C(  -275.68), SIMDE_FLOAT64_C(   847.12), SIMDE_FLOAT64_C(   529.38), SIMDE_FLOAT64_C(   847.12),
+        SIMDE_FLOAT64_C(  -366.24), SIMDE_FLOAT64_C(    41.10), SIMDE_FLOAT64_C(   529.38), SIMDE_FLOAT64_C(   899.96) } },
+    { {  INT64_C(                   4),  INT64_C(                   7),  INT64_C(                  22),  INT64_C(                  24),
+         INT64_C(                   4),  INT64_C(                  26),  INT64_C(                  15),  INT64_C(                  19) },
+      { SIMDE_FLOAT64_C(   944.43), SIMDE_FLOAT64_C(   432.63), SIMDE_FLOAT64_C(  -937.09), SIMDE_FLOAT64_C(  -222.52),
+        SIMDE_FLOAT64_C(  -812.10), SIMDE_FLOAT64_C(  -353.72), SIMDE_FLOAT64_C(   242.15), SIMDE_FLOAT64_C(   684.08) },
+      { SIMDE_FLOAT64_C(  -812.10), SIMDE_FLOAT64_C(   432.63), SIMDE_FLOAT64_C(  -937.09), SIMDE_FLOAT64_C(  -222.52),
+        SIMDE_FLOAT64_C(  -812.10), SIMDE_FLOAT64_C(  -353.72), SIMDE_FLOAT64_C(   242.15), SIMDE_FLOAT64_C(   684.08) } },
+    { {  INT64_C(                  16),  INT64_C(                  12),  INT64_C(                  27),  INT64_C(                  14),
+         INT64_C(                   2),  INT64_C(                   8),  INT64_C(                  12),  INT64_C(                  20) },
+      { SIMDE_FLOAT64_C(  -215.37), SIMDE_FLOAT64_C(  -399.77), SIMDE_FLOAT64_C(  -169.99), SIMDE_FLOAT64_C(   418.39),
+        SIMDE_FLOAT64_C(   641.33), SIMDE_FLOAT64_C(  -640.61), SIMDE_FLOAT64_C(   318.34), SIMDE_FLOAT64_C(   346.36) },
+      { SIMDE_FLOAT64_C(  -215.37), SIMDE_FLOAT64_C(   318.34), SIMDE_FLOAT64_C(  -169.99), SIMDE_FLOAT64_C(   418.39),
+        SIMDE_FLOAT64_C(   641.33), SIMDE_FLOAT64_C(  -640.61), SIMDE_FLOAT64_C(   318.34), SIMDE_FLOAT64_C(   346.36) } },
+    { {  INT64_C(                   3),  INT64_C(                  31),  INT64_C(                  18),  INT64_C(                   7),
+         INT64_C(                  25),  INT64_C(                   2),  INT64_C(                  26),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(   805.46), SIMDE_FLOAT64_C(   298.74), SIMDE_FLOAT64_C(   -62.85), SIMDE_FLOAT64_C(   993.36),
+        SIMDE_FLOAT64_C(   945.02), SIMDE_FLOAT64_C(  -820.70), SIMDE_FLOAT64_C(   677.44), SIMDE_FLOAT64_C(  -663.14) },
+      { SIMDE_FLOAT64_C(  -663.14), SIMDE_FLOAT64_C(   298.74), SIMDE_FLOAT64_C(   -62.85), SIMDE_FLOAT64_C(   993.36),
+        SIMDE_FLOAT64_C(   945.02), SIMDE_FLOAT64_C(  -820.70), SIMDE_FLOAT64_C(   677.44), SIMDE_FLOAT64_C(  -663.14) } },
+    { {  INT64_C(                  27),  INT64_C(                   9),  INT64_C(                   1),  INT64_C(                  29),
+         INT64_C(                  18),  INT64_C(                  13),  INT64_C(                  17),  INT64_C(                  23) },
+      { SIMDE_FLOAT64_C(  -227.26), SIMDE_FLOAT64_C(   501.61), SIMDE_FLOAT64_C(   377.86), SIMDE_FLOAT64_C(  -585.93),
+        SIMDE_FLOAT64_C(   861.00), SIMDE_FLOAT64_C(  -303.80), SIMDE_FLOAT64_C(   760.43), SIMDE_FLOAT64_C(   528.76) },
+      { SIMDE_FLOAT64_C(  -227.26), SIMDE_FLOAT64_C(   501.61), SIMDE_FLOAT64_C(   377.86), SIMDE_FLOAT64_C(  -585.93),
+        SIMDE_FLOAT64_C(   861.00), SIMDE_FLOAT64_C(  -303.80), SIMDE_FLOAT64_C(   760.43), SIMDE_FLOAT64_C(   528.76) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_i64scatter_pd(HEDLEY_STATIC_CAST(void*, f64_buffer), vindex, a, 8);
+
+    simde_float64 rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512d a = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_mm512_i64scatter_pd(f64_buffer, vindex, a, 8);
+
+    int64_t vi[8];
+    simde_float64 rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[vi[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 61),
+      {  INT64_C(                   1),  INT64_C(                  21),  INT64_C(                  23),  INT64_C(                   3),
+         INT64_C(                  16),  INT64_C(                  26),  INT64_C(                  10),  INT64_C(                  28) },
+      { SIMDE_FLOAT64_C(  -395.41), SIMDE_FLOAT64_C(   734.73), SIMDE_FLOAT64_C(  -820.04), SIMDE_FLOAT64_C(  -216.11),
+        SIMDE_FLOAT64_C(   412.17), SIMDE_FLOAT64_C(  -483.17), SIMDE_FLOAT64_C(  -785.97), SIMDE_FLOAT64_C(  -210.24) },
+      { SIMDE_FLOAT64_C(  -395.41), SIMDE_FLOAT64_C(    21.00), SIMDE_FLOAT64_C(  -820.04), SIMDE_FLOAT64_C(  -216.11),
+        SIMDE_FLOAT64_C(   412.17), SIMDE_FLOAT64_C(  -483.17), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    28.00) } },
+    { UINT8_C(243),
+      {  INT64_C(                  17),  INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   2),
+         INT64_C(                  25),  INT64_C(                  30),  INT64_C(                  18),  INT64_C(                  15) },
+      { SIMDE_FLOAT64_C(   351.72), SIMDE_FLOAT64_C(   936.95), SIMDE_FLOAT64_C(   998.14), SIMDE_FLOAT64_C(   112.16),
+        SIMDE_FLOAT64_C(   465.72), SIMDE_FLOAT64_C(   290.68), SIMDE_FLOAT64_C(  -324.77), SIMDE_FLOAT64_C(   166.08) },
+      { SIMDE_FLOAT64_C(   351.72), SIMDE_FLOAT64_C(   936.95), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   936.95),
+        SIMDE_FLOAT64_C(   465.72), SIMDE_FLOAT64_C(   290.68), SIMDE_FLOAT64_C(  -324.77), SIMDE_FLOAT64_C(   166.08) } },
+    { UINT8_C( 98),
+      {  INT64_C(                   7),  INT64_C(                  16),  INT64_C(                  29),  INT64_C(                  17),
+         INT64_C(                  13),  INT64_C(                   7),  INT64_C(                   9),  INT64_C(                  12) },
+      { SIMDE_FLOAT64_C(   854.37), SIMDE_FLOAT64_C(   499.42), SIMDE_FLOAT64_C(    34.01), SIMDE_FLOAT64_C(  -931.60),
+        SIMDE_FLOAT64_C(  -710.82), SIMDE_FLOAT64_C(    26.41), SIMDE_FLOAT64_C(   971.15), SIMDE_FLOAT64_C(  -746.22) },
+      { SIMDE_FLOAT64_C(    26.41), SIMDE_FLOAT64_C(   499.42), SIMDE_FLOAT64_C(    29.00), SIMDE_FLOAT64_C(    17.00),
+        SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    26.41), SIMDE_FLOAT64_C(   971.15), SIMDE_FLOAT64_C(    12.00) } },
+    { UINT8_C(145),
+      {  INT64_C(                   6),  INT64_C(                  27),  INT64_C(                  16),  INT64_C(                  24),
+         INT64_C(                  10),  INT64_C(                   3),  INT64_C(                  21),  INT64_C(                  24) },
+      { SIMDE_FLOAT64_C(  -407.15), SIMDE_FLOAT64_C(  -975.88), SIMDE_FLOAT64_C(  -231.39), SIMDE_FLOAT64_C(   268.09),
+        SIMDE_FLOAT64_C(   190.20), SIMDE_FLOAT64_C(   567.07), SIMDE_FLOAT64_C(   879.23), SIMDE_FLOAT64_C(   292.47) },
+      { SIMDE_FLOAT64_C(  -407.15), SIMDE_FLOAT64_C(    27.00), SIMDE_FLOAT64_C(    16.00), SIMDE_FLOAT64_C(   292.47),
+        SIMDE_FLOAT64_C(   190.20), SIMDE_FLOAT64_C(     3.00), SIMDE_FLOAT64_C(    21.00), SIMDE_FLOAT64_C(   292.47) } },
+    { UINT8_C(131),
+      {  INT64_C(                   0),  INT64_C(                  30),  INT64_C(                  10),  INT64_C(                   9),
+         INT64_C(                  10),  INT64_C(                  10),  INT64_C(                  25),  INT64_C(                   8) },
+      { SIMDE_FLOAT64_C(    26.22), SIMDE_FLOAT64_C(  -892.41), SIMDE_FLOAT64_C(  -792.71), SIMDE_FLOAT64_C(    -2.63),
+        SIMDE_FLOAT64_C(  -638.62), SIMDE_FLOAT64_C(   398.61), SIMDE_FLOAT64_C(   542.86), SIMDE_FLOAT64_C(  -460.77) },
+      { SIMDE_FLOAT64_C(    26.22), SIMDE_FLOAT64_C(  -892.41), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    25.00), SIMDE_FLOAT64_C(  -460.77) } },
+    { UINT8_C(187),
+      {  INT64_C(                   0),  INT64_C(                  31),  INT64_C(                  30),  INT64_C(                  21),
+         INT64_C(                  24),  INT64_C(                   3),  INT64_C(                  22),  INT64_C(                  28) },
+      { SIMDE_FLOAT64_C(  -130.79), SIMDE_FLOAT64_C(   937.03), SIMDE_FLOAT64_C(   832.62), SIMDE_FLOAT64_C(  -251.56),
+        SIMDE_FLOAT64_C(   229.50), SIMDE_FLOAT64_C(   865.58), SIMDE_FLOAT64_C(   -19.81), SIMDE_FLOAT64_C(  -140.81) },
+      { SIMDE_FLOAT64_C(  -130.79), SIMDE_FLOAT64_C(   937.03), SIMDE_FLOAT64_C(    30.00), SIMDE_FLOAT64_C(  -251.56),
+        SIMDE_FLOAT64_C(   229.50), SIMDE_FLOAT64_C(   865.58), SIMDE_FLOAT64_C(    22.00), SIMDE_FLOAT64_C(  -140.81) } },
+    { UINT8_C(176),
+      {  INT64_C(                   5),  INT64_C(                  17),  INT64_C(                  26),  INT64_C(                  30),
+         INT64_C(                  26),  INT64_C(                  23),  INT64_C(                  22),  INT64_C(                  19) },
+      { SIMDE_FLOAT64_C(   950.43), SIMDE_FLOAT64_C(   586.55), SIMDE_FLOAT64_C(   792.85), SIMDE_FLOAT64_C(   493.29),
+        SIMDE_FLOAT64_C(  -874.21), SIMDE_FLOAT64_C(   320.43), SIMDE_FLOAT64_C(   657.60), SIMDE_FLOAT64_C(  -855.19) },
+      { SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(    17.00), SIMDE_FLOAT64_C(  -874.21), SIMDE_FLOAT64_C(    30.00),
+        SIMDE_FLOAT64_C(  -874.21), SIMDE_FLOAT64_C(   320.43), SIMDE_FLOAT64_C(    22.00), SIMDE_FLOAT64_C(  -855.19) } },
+    { UINT8_C( 55),
+      {  INT64_C(                  21),  INT64_C(                  29),  INT64_C(                  26),  INT64_C(                  11),
+         INT64_C(                  25),  INT64_C(                   6),  INT64_C(                   2),  INT64_C(                  27) },
+      { SIMDE_FLOAT64_C(   547.49), SIMDE_FLOAT64_C(  -706.34), SIMDE_FLOAT64_C(   605.52), SIMDE_FLOAT64_C(  -472.33),
+        SIMDE_FLOAT64_C(   152.86), SIMDE_FLOAT64_C(  -425.45), SIMDE_FLOAT64_C(   826.85), SIMDE_FLOAT64_C(  -841.08) },
+      { SIMDE_FLOAT64_C(   547.49), SIMDE_FLOAT64_C(  -706.34), SIMDE_FLOAT64_C(   605.52), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(   152.86), SIMDE_FLOAT64_C(  -425.45), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(    27.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_mm512_mask_i64scatter_pd(HEDLEY_STATIC_CAST(void*, f64_buffer), test_vec[i].k, vindex, a, 8);
+
+    simde_float64 rv[8];
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[test_vec[i].vindex[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+
+  for (int i = 0; i < 8; i++) {
+    for (size_t j = 0 ; j < (sizeof(f64_buffer) / sizeof(f64_buffer[0])) ; j++) { f64_buffer[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i vindex = simde_mm512_set_epi64(
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)),
+        HEDLEY_STATIC_CAST(int64_t, (simde_test_codegen_random_u8() & 31)));
+    simde__m512d a = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_mm512_mask_i64scatter_pd(f64_buffer, k, vindex, a, 8);
+
+    int64_t vi[8];
+    simde_float64 rv[8];
+    simde_mm512_storeu_epi64(vi, vindex);
+    for (size_t j = 0 ; j < (sizeof(rv) / sizeof(rv[0])) ; j++) { rv[j] = f64_buffer[vi[j]]; }
+    simde__m512d r = simde_mm512_loadu_pd(rv);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i64x8(2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
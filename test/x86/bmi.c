@@ -0,0 +1,974 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX bmi
+#include <simde/x86/bmi.h>
+#include <test/x86/avx512/test-avx512.h>
+
+static int
+test_simde_andn_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t b;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(1779023827),
+      UINT32_C(3018428525),
+      UINT32_C(2447376428) },
+    { UINT32_C(3131739063),
+      UINT32_C(2667084172),
+      UINT32_C(  72380424) },
+    { UINT32_C(2542735754),
+      UINT32_C(2620787040),
+      UINT32_C( 137365600) },
+    { UINT32_C(2701582943),
+      UINT32_C(3699591689),
+      UINT32_C(1551960064) },
+    { UINT32_C(2001112330),
+      UINT32_C(3559534621),
+      UINT32_C(2150117397) },
+    { UINT32_C(1200542907),
+      UINT32_C(3622143565),
+      UINT32_C(2422276676) },
+    { UINT32_C(4151276695),
+      UINT32_C(3717506430),
+      UINT32_C( 143688040) },
+    { UINT32_C(2440993416),
+      UINT32_C(4000187108),
+      UINT32_C(1845493860) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_andn_u32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t b = simde_test_codegen_random_u32();
+    uint32_t r = simde_andn_u32(a, b);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_andn_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t b;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(11493625936333878415),
+      UINT64_C( 3281097276124434275),
+      UINT64_C( 2308165255357926240) },
+    { UINT64_C( 2638187564588463936),
+      UINT64_C(12332584333213047379),
+      UINT64_C(10025580118553004051) },
+    { UINT64_C( 9105391259800341464),
+      UINT64_C( 5741164902159959016),
+      UINT64_C(  117135390043226144) },
+    { UINT64_C(15956159515721650606),
+      UINT64_C( 2417371188974331332),
+      UINT64_C( 2341889680293766208) },
+    { UINT64_C(11988366419807888582),
+      UINT64_C(17572148843232136830),
+      UINT64_C( 5872905295404993080) },
+    { UINT64_C( 6415568521081580193),
+      UINT64_C( 2106776803123797458),
+      UINT64_C(  302939930739348818) },
+    { UINT64_C(15280254310936353707),
+      UINT64_C(11899984674335831020),
+      UINT64_C( 2387225565963821124) },
+    { UINT64_C(16291165892993114920),
+      UINT64_C(13937297339300270070),
+      UINT64_C(  101931351827877078) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_andn_u64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t b = simde_test_codegen_random_u64();
+    uint64_t r = simde_andn_u64(a, b);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_bextr_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t start;
+    const uint32_t len;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(2871617877),
+      UINT32_C(         7),
+      UINT32_C(        23),
+      UINT32_C(   5657298) },
+    { UINT32_C(1158875933),
+      UINT32_C(         3),
+      UINT32_C(        21),
+      UINT32_C(    156003) },
+    { UINT32_C(2097176423),
+      UINT32_C(        29),
+      UINT32_C(        25),
+      UINT32_C(         3) },
+    { UINT32_C( 173021343),
+      UINT32_C(        28),
+      UINT32_C(        18),
+      UINT32_C(         0) },
+    { UINT32_C( 758144368),
+      UINT32_C(         5),
+      UINT32_C(        14),
+      UINT32_C(       747) },
+    { UINT32_C( 561682252),
+      UINT32_C(        18),
+      UINT32_C(        16),
+      UINT32_C(      2142) },
+    { UINT32_C(2268733765),
+      UINT32_C(        26),
+      UINT32_C(        35),
+      UINT32_C(        33) },
+    { UINT32_C(3980668155),
+      UINT32_C(         5),
+      UINT32_C(        24),
+      UINT32_C(   6955367) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bextr_u32(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t start = HEDLEY_STATIC_CAST(uint32_t, simde_test_codegen_random_u32() % 36);
+    uint32_t len = HEDLEY_STATIC_CAST(uint32_t, simde_test_codegen_random_u32() % 36);
+    uint32_t r = simde_bextr_u32(a, start, len);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, start, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, len, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_bextr_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint32_t start;
+    const uint32_t len;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(10184460958342134022),
+      UINT32_C(        19),
+      UINT32_C(        23),
+      UINT64_C(             2688602) },
+    { UINT64_C(17121779651187028916),
+      UINT32_C(        57),
+      UINT32_C(        11),
+      UINT64_C(                 118) },
+    { UINT64_C(12885245035557133820),
+      UINT32_C(        19),
+      UINT32_C(         5),
+      UINT64_C(                   7) },
+    { UINT64_C( 1793332825141144342),
+      UINT32_C(        63),
+      UINT32_C(        10),
+      UINT64_C(                   0) },
+    { UINT64_C( 6405244781323066139),
+      UINT32_C(        30),
+      UINT32_C(        14),
+      UINT64_C(                 196) },
+    { UINT64_C(  920196423953060858),
+      UINT32_C(        52),
+      UINT32_C(        37),
+      UINT64_C(                 204) },
+    { UINT64_C( 5394229766335456338),
+      UINT32_C(        19),
+      UINT32_C(        65),
+      UINT64_C(      10288676769896) },
+    { UINT64_C( 9062367391177633778),
+      UINT32_C(        46),
+      UINT32_C(        64),
+      UINT64_C(              128783) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bextr_u64(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint32_t start = HEDLEY_STATIC_CAST(uint32_t, simde_test_codegen_random_u32() % 68);
+    uint32_t len = HEDLEY_STATIC_CAST(uint32_t, simde_test_codegen_random_u32() % 68);
+    uint64_t r = simde_bextr_u64(a, start, len);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, start, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, len, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_bextr2_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t control;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(3316301408),
+      UINT32_C(     14382),
+      UINT32_C(         0) },
+    { UINT32_C(3274102737),
+      UINT32_C(      3606),
+      UINT32_C(       780) },
+    { UINT32_C( 826223452),
+      UINT32_C(     14639),
+      UINT32_C(         0) },
+    { UINT32_C(2420923527),
+      UINT32_C(       310),
+      UINT32_C(         0) },
+    { UINT32_C( 235330991),
+      UINT32_C(     11308),
+      UINT32_C(         0) },
+    { UINT32_C(1447297501),
+      UINT32_C(      7474),
+      UINT32_C(         0) },
+    { UINT32_C(3730457733),
+      UINT32_C(      2564),
+      UINT32_C(        72) },
+    { UINT32_C(  36648045),
+      UINT32_C(      2358),
+      UINT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bextr2_u32(test_vec[i].a, test_vec[i].control);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t control = HEDLEY_STATIC_CAST(uint32_t, (simde_test_codegen_random_u32() % 72) | ((simde_test_codegen_random_u32() % 72) << 8));
+    uint32_t r = simde_bextr2_u32(a, control);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, control, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_bextr2_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t control;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(14356490735260680083),
+      UINT64_C(               13124),
+      UINT64_C(                   0) },
+    { UINT64_C( 8581559754028281255),
+      UINT64_C(                1844),
+      UINT64_C(                 113) },
+    { UINT64_C(  827578520965924723),
+      UINT64_C(               15629),
+      UINT64_C(     101022768672598) },
+    { UINT64_C( 2487280527015519212),
+      UINT64_C(                8509),
+      UINT64_C(                   1) },
+    { UINT64_C( 8945281078173211089),
+      UINT64_C(               17967),
+      UINT64_C(               63560) },
+    { UINT64_C(16196918375799052846),
+      UINT64_C(               10497),
+      UINT64_C(       1895468887319) },
+    { UINT64_C( 2137106415035281772),
+      UINT64_C(                2062),
+      UINT64_C(                 139) },
+    { UINT64_C(13514840182978020924),
+      UINT64_C(               11779),
+      UINT64_C(      12581399072967) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bextr2_u64(test_vec[i].a, test_vec[i].control);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t control = HEDLEY_STATIC_CAST(uint64_t, (simde_test_codegen_random_u32() % 72) | ((simde_test_codegen_random_u32() % 72) << 8));
+    uint64_t r = simde_bextr2_u64(a, control);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, control, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_blsi_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(3892314112),
+      UINT32_C( 134217728) },
+    { UINT32_C(2147483648),
+      UINT32_C(2147483648) },
+    { UINT32_C(   3549696),
+      UINT32_C(       512) },
+    { UINT32_C( 536870912),
+      UINT32_C( 536870912) },
+    { UINT32_C(1342177280),
+      UINT32_C( 268435456) },
+    { UINT32_C( 670232576),
+      UINT32_C(      4096) },
+    { UINT32_C(  11115520),
+      UINT32_C(      1024) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsi_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = HEDLEY_STATIC_CAST(uint32_t, ((i == 0) ? 0 : (simde_test_codegen_random_u32() >> (simde_test_codegen_random_u32() & 31)) << (simde_test_codegen_random_u32() & 31)));
+    uint32_t r = simde_blsi_u32(a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_blsi_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(17780352066347073536),
+      UINT64_C(     140737488355328) },
+    { UINT64_C(          8321499136),
+      UINT64_C(           268435456) },
+    { UINT64_C( 9507754355781009408),
+      UINT64_C(            67108864) },
+    { UINT64_C( 3517311308976357376),
+      UINT64_C(    4503599627370496) },
+    { UINT64_C(11360593957855690752),
+      UINT64_C(             1048576) },
+    { UINT64_C(          5368709120),
+      UINT64_C(          1073741824) },
+    { UINT64_C(        295011614720),
+      UINT64_C(             1048576) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsi_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = HEDLEY_STATIC_CAST(uint64_t, ((i == 0) ? 0 : (simde_test_codegen_random_u64() >> (simde_test_codegen_random_u64() & 63)) << (simde_test_codegen_random_u64() & 63)));
+    uint64_t r = simde_blsi_u64(a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_blsmsk_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+                UINT32_MAX },
+    { UINT32_C(2550136832),
+      UINT32_C( 268435455) },
+    { UINT32_C(4204111360),
+      UINT32_C(      1023) },
+    { UINT32_C(1749839872),
+      UINT32_C(      8191) },
+    { UINT32_C( 525410304),
+      UINT32_C(     16383) },
+    { UINT32_C(1409286144),
+      UINT32_C( 134217727) },
+    { UINT32_C( 469762048),
+      UINT32_C( 134217727) },
+    { UINT32_C(  51675136),
+      UINT32_C(     65535) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsmsk_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = HEDLEY_STATIC_CAST(uint32_t, ((i == 0) ? 0 : (simde_test_codegen_random_u32() >> (simde_test_codegen_random_u32() & 31)) << (simde_test_codegen_random_u32() & 31)));
+    uint32_t r = simde_blsmsk_u32(a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_blsmsk_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+                          UINT64_MAX },
+    { UINT64_C(13373613074011914240),
+      UINT64_C(         34359738367) },
+    { UINT64_C(14411518807585587200),
+      UINT64_C( 1152921504606846975) },
+    { UINT64_C( 9223372036854775808),
+                          UINT64_MAX },
+    { UINT64_C( 2017612633061982208),
+      UINT64_C(  576460752303423487) },
+    { UINT64_C(                   0),
+                          UINT64_MAX },
+    { UINT64_C(    6755399441055744),
+      UINT64_C(    4503599627370495) },
+    { UINT64_C(        515302162432),
+      UINT64_C(              131071) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsmsk_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = HEDLEY_STATIC_CAST(uint64_t, ((i == 0) ? 0 : (simde_test_codegen_random_u64() >> (simde_test_codegen_random_u64() & 63)) << (simde_test_codegen_random_u64() & 63)));
+    uint64_t r = simde_blsmsk_u64(a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_blsr_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(  12582912),
+      UINT32_C(   8388608) },
+    { UINT32_C(     79912),
+      UINT32_C(     79904) },
+    { UINT32_C( 179767920),
+      UINT32_C( 179767904) },
+    { UINT32_C(   1964000),
+      UINT32_C(   1963968) },
+    { UINT32_C(2920284160),
+      UINT32_C(2919235584) },
+    { UINT32_C(2147483648),
+      UINT32_C(         0) },
+    { UINT32_C(4090052608),
+      UINT32_C(4090036224) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsr_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = HEDLEY_STATIC_CAST(uint32_t, ((i == 0) ? 0 : (simde_test_codegen_random_u32() >> (simde_test_codegen_random_u32() & 31)) << (simde_test_codegen_random_u32() & 31)));
+    uint32_t r = simde_blsr_u32(a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_blsr_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(     399560674869248),
+      UINT64_C(     399560674836480) },
+    { UINT64_C(  576460752303423488),
+      UINT64_C(                   0) },
+    { UINT64_C(12452392117968830464),
+      UINT64_C(12452392117968306176) },
+    { UINT64_C( 6310753577971220480),
+      UINT64_C( 6310753575823736832) },
+    { UINT64_C(  144115188075855872),
+      UINT64_C(                   0) },
+    { UINT64_C(  179777861323800140),
+      UINT64_C(  179777861323800136) },
+    { UINT64_C(16150965379353542656),
+      UINT64_C(16150965379219324928) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsr_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = HEDLEY_STATIC_CAST(uint64_t, ((i == 0) ? 0 : (simde_test_codegen_random_u64() >> (simde_test_codegen_random_u64() & 63)) << (simde_test_codegen_random_u64() & 63)));
+    uint64_t r = simde_blsr_u64(a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_tzcnt_u16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a;
+    const uint16_t r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(   16) },
+    { UINT16_C(63008),
+      UINT16_C(    5) },
+    { UINT16_C(32256),
+      UINT16_C(    9) },
+    { UINT16_C( 4960),
+      UINT16_C(    5) },
+    { UINT16_C(32768),
+      UINT16_C(   15) },
+    { UINT16_C(46900),
+      UINT16_C(    2) },
+    { UINT16_C(34576),
+      UINT16_C(    4) },
+    { UINT16_C(26624),
+      UINT16_C(   11) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint16_t r = simde_tzcnt_u16(test_vec[i].a);
+    simde_assert_equal_u16(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint16_t a = HEDLEY_STATIC_CAST(uint16_t, ((i == 0) ? 0 : (simde_test_codegen_random_u16() << (simde_test_codegen_random_u16() & 15))));
+    uint16_t r = simde_tzcnt_u16(a);
+
+    simde_test_codegen_write_u16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_tzcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    { UINT32_C(    966656),
+      UINT32_C(        14) },
+    { UINT32_C(3829399552),
+      UINT32_C(        22) },
+    { UINT32_C(3518127024),
+      UINT32_C(         4) },
+    { UINT32_C(3959422976),
+      UINT32_C(        26) },
+    { UINT32_C(        72),
+      UINT32_C(         3) },
+    { UINT32_C(4026531840),
+      UINT32_C(        28) },
+    { UINT32_C( 234881024),
+      UINT32_C(        25) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_tzcnt_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = HEDLEY_STATIC_CAST(uint32_t, ((i == 0) ? 0 : (simde_test_codegen_random_u32() >> (simde_test_codegen_random_u32() & 31)) << (simde_test_codegen_random_u32() & 31)));
+    uint32_t r = simde_tzcnt_u32(a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_tzcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                  64) },
+    { UINT64_C(                   0),
+      UINT64_C(                  64) },
+    { UINT64_C(          9364307968),
+      UINT64_C(                  19) },
+    { UINT64_C(    9605775262746472),
+      UINT64_C(                   3) },
+    { UINT64_C(    1376382709899136),
+      UINT64_C(                   7) },
+    { UINT64_C(              430080),
+      UINT64_C(                  12) },
+    { UINT64_C( 8325952367069495296),
+      UINT64_C(                  27) },
+    { UINT64_C(           446693376),
+      UINT64_C(                  21) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_tzcnt_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = HEDLEY_STATIC_CAST(uint64_t, ((i == 0) ? 0 : (simde_test_codegen_random_u64() >> (simde_test_codegen_random_u64() & 63)) << (simde_test_codegen_random_u64() & 63)));
+    uint64_t r = simde_tzcnt_u64(a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_tzcnt_32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const int32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+       INT32_C(          32) },
+    { UINT32_C(  18487296),
+       INT32_C(          11) },
+    { UINT32_C(   2097152),
+       INT32_C(          21) },
+    { UINT32_C( 191835456),
+       INT32_C(           6) },
+    { UINT32_C( 172228608),
+       INT32_C(          18) },
+    { UINT32_C(3006529536),
+       INT32_C(          18) },
+    { UINT32_C(2147483648),
+       INT32_C(          31) },
+    { UINT32_C(         0),
+       INT32_C(          32) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_mm_tzcnt_32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = HEDLEY_STATIC_CAST(uint32_t, ((i == 0) ? 0 : (simde_test_codegen_random_u32() >> (simde_test_codegen_random_u32() & 31)) << (simde_test_codegen_random_u32() & 31)));
+    int32_t r = simde_mm_tzcnt_32(a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_tzcnt_64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const int64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+       INT64_C(                  64) },
+    { UINT64_C(17897304919170351104),
+       INT64_C(                  53) },
+    { UINT64_C(                  12),
+       INT64_C(                   2) },
+    { UINT64_C( 2069404028776742912),
+       INT64_C(                  51) },
+    { UINT64_C(      29248610893824),
+       INT64_C(                  20) },
+    { UINT64_C(16454636590518501376),
+       INT64_C(                  25) },
+    { UINT64_C(          1745879040),
+       INT64_C(                  20) },
+    { UINT64_C( 9160321642071588864),
+       INT64_C(                  53) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_mm_tzcnt_64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = HEDLEY_STATIC_CAST(uint64_t, ((i == 0) ? 0 : (simde_test_codegen_random_u64() >> (simde_test_codegen_random_u64() & 63)) << (simde_test_codegen_random_u64() & 63)));
+    int64_t r = simde_mm_tzcnt_64(a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_lzcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    { UINT32_C(  25690112),
+      UINT32_C(         7) },
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    { UINT32_C(1811939328),
+      UINT32_C(         1) },
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    { UINT32_C(      3968),
+      UINT32_C(        20) },
+    { UINT32_C(3888119808),
+      UINT32_C(         0) },
+    { UINT32_C(    131584),
+      UINT32_C(        14) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_lzcnt_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = HEDLEY_STATIC_CAST(uint32_t, ((i == 0) ? 0 : (simde_test_codegen_random_u32() >> (simde_test_codegen_random_u32() & 31)) << (simde_test_codegen_random_u32() & 31)));
+    uint32_t r = simde_lzcnt_u32(a);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_lzcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                  64) },
+    { UINT64_C( 1585267068834414592),
+      UINT64_C(                   3) },
+    { UINT64_C(  306244774661193728),
+      UINT64_C(                   5) },
+    { UINT64_C( 3294352563378847744),
+      UINT64_C(                   2) },
+    { UINT64_C( 7030374380290965504),
+      UINT64_C(                   1) },
+    { UINT64_C( 3458764513820540928),
+      UINT64_C(                   2) },
+    { UINT64_C(11555589373839802368),
+      UINT64_C(                   0) },
+    { UINT64_C(       4814658338816),
+      UINT64_C(                  21) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_lzcnt_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = HEDLEY_STATIC_CAST(uint64_t, ((i == 0) ? 0 : (simde_test_codegen_random_u64() >> (simde_test_codegen_random_u64() & 63)) << (simde_test_codegen_random_u64() & 63)));
+    uint64_t r = simde_lzcnt_u64(a);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(andn_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(andn_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr2_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr2_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsi_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsi_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsmsk_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsmsk_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsr_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsr_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_tzcnt_32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_tzcnt_64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(lzcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(lzcnt_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -0,0 +1,505 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX bmi2
+#include <simde/x86/bmi2.h>
+#include <test/x86/avx512/test-avx512.h>
+
+static int
+test_simde_bzhi_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t index;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(1238400622),
+      UINT32_C(         8),
+      UINT32_C(       110) },
+    { UINT32_C(2619683712),
+      UINT32_C(        29),
+      UINT32_C( 472200064) },
+    { UINT32_C(2229564807),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(2276697901),
+      UINT32_C(        40),
+      UINT32_C(2276697901) },
+    { UINT32_C(   4136640),
+      UINT32_C(        37),
+      UINT32_C(   4136640) },
+    { UINT32_C(2871672678),
+      UINT32_C(        15),
+      UINT32_C(     16230) },
+    { UINT32_C(1153659156),
+      UINT32_C(        62),
+      UINT32_C(1153659156) },
+    { UINT32_C(3150630195),
+      UINT32_C(        31),
+      UINT32_C(1003146547) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bzhi_u32(test_vec[i].a, test_vec[i].index);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t index = HEDLEY_STATIC_CAST(uint32_t, (simde_test_codegen_random_u32() % 72));
+    uint32_t r = simde_bzhi_u32(a, index);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, index, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_bzhi_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint32_t index;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(10075654232868974903),
+      UINT32_C(         9),
+      UINT64_C(                 311) },
+    { UINT64_C( 5401473143550296988),
+      UINT32_C(        62),
+      UINT64_C(  789787125122909084) },
+    { UINT64_C(12158608976469842141),
+      UINT32_C(         7),
+      UINT64_C(                  93) },
+    { UINT64_C( 6521746342311542902),
+      UINT32_C(        48),
+      UINT64_C(     252606902354038) },
+    { UINT64_C(17191564766261739908),
+      UINT32_C(        13),
+      UINT64_C(                 388) },
+    { UINT64_C(11178237899208825086),
+      UINT32_C(        60),
+      UINT64_C(  801944357747202302) },
+    { UINT64_C(16229557287074512052),
+      UINT32_C(         9),
+      UINT64_C(                 180) },
+    { UINT64_C( 6242504033537976086),
+      UINT32_C(        12),
+      UINT64_C(                1814) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bzhi_u64(test_vec[i].a, test_vec[i].index);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint32_t index = HEDLEY_STATIC_CAST(uint32_t, (simde_test_codegen_random_u32() % 72));
+    uint64_t r = simde_bzhi_u64(a, index);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, index, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pdep_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t mask;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(2955703772),
+      UINT32_C(4181944132),
+      UINT32_C(1896040192) },
+    { UINT32_C(2153132067),
+      UINT32_C(   2101280),
+      UINT32_C(      4128) },
+    { UINT32_C(4096468380),
+      UINT32_C(1716178426),
+      UINT32_C(1614842992) },
+    { UINT32_C(1912053397),
+      UINT32_C( 134291458),
+      UINT32_C(     65538) },
+    { UINT32_C(3173885844),
+      UINT32_C( 685739575),
+      UINT32_C( 143886372) },
+    { UINT32_C(1596984259),
+      UINT32_C( 705764385),
+      UINT32_C( 705691681) },
+    { UINT32_C(1328515388),
+      UINT32_C( 933712044),
+      UINT32_C( 553930912) },
+    { UINT32_C(1239742645),
+      UINT32_C(1107689600),
+      UINT32_C(1074004096) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_pdep_u32(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t mask = HEDLEY_STATIC_CAST(uint32_t, ((i & 1) ? (simde_test_codegen_random_u32() & simde_test_codegen_random_u32()) : simde_test_codegen_random_u32()));
+    uint32_t r = simde_pdep_u32(a, mask);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, mask, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pdep_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t mask;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(12992064187361538033),
+      UINT64_C( 1458780797085605555),
+      UINT64_C(  295126663474372225) },
+    { UINT64_C( 9146863476525491954),
+      UINT64_C(13853371641251495937),
+      UINT64_C( 4629718129382260736) },
+    { UINT64_C(14526077849695106331),
+      UINT64_C( 5926842739012461028),
+      UINT64_C( 5926842665962308004) },
+    { UINT64_C( 7710579174761862487),
+      UINT64_C(    4540076940468482),
+      UINT64_C(       1138183643394) },
+    { UINT64_C( 4226088266947134019),
+      UINT64_C(15563719400093572009),
+      UINT64_C( 9463241566618421257) },
+    { UINT64_C( 2871016950630610785),
+      UINT64_C( 5044314162513059844),
+      UINT64_C( 4900198969067438084) },
+    { UINT64_C( 7082040162610942236),
+      UINT64_C(13531567169140276974),
+      UINT64_C(  200419140584933480) },
+    { UINT64_C(14029930812225239658),
+      UINT64_C( 3062804538672548444),
+      UINT64_C(  180429858118568008) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_pdep_u64(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t mask = HEDLEY_STATIC_CAST(uint64_t, ((i & 1) ? (simde_test_codegen_random_u64() & simde_test_codegen_random_u64()) : simde_test_codegen_random_u64()));
+    uint64_t r = simde_pdep_u64(a, mask);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, mask, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pext_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t mask;
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(3357652003),
+      UINT32_C(3867404924),
+      UINT32_C(    198280) },
+    { UINT32_C(3780411684),
+      UINT32_C(1073743956),
+      UINT32_C(        17) },
+    { UINT32_C(2089921565),
+      UINT32_C(1474145990),
+      UINT32_C(    938978) },
+    { UINT32_C( 903192850),
+      UINT32_C(  12091457),
+      UINT32_C(        84) },
+    { UINT32_C(3622243330),
+      UINT32_C(1797819156),
+      UINT32_C(      5008) },
+    { UINT32_C(4149294298),
+      UINT32_C(2742173824),
+      UINT32_C(      1001) },
+    { UINT32_C(1205392370),
+      UINT32_C(2870597322),
+      UINT32_C(     15837) },
+    { UINT32_C(1487983190),
+      UINT32_C(4027453442),
+      UINT32_C(       163) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_pext_u32(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t mask = HEDLEY_STATIC_CAST(uint32_t, ((i & 1) ? (simde_test_codegen_random_u32() & simde_test_codegen_random_u32()) : simde_test_codegen_random_u32()));
+    uint32_t r = simde_pext_u32(a, mask);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, mask, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pext_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t mask;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 2455420096142880652),
+      UINT64_C(12678088035762770360),
+      UINT64_C(          9715866457) },
+    { UINT64_C(13484352181999635315),
+      UINT64_C( 1315337008316551330),
+      UINT64_C(               50451) },
+    { UINT64_C( 4997711157830431943),
+      UINT64_C( 7066765467461858682),
+      UINT64_C(           330905041) },
+    { UINT64_C( 9900011274302308739),
+      UINT64_C( 9334555975540015128),
+      UINT64_C(               13200) },
+    { UINT64_C( 6008747276775235137),
+      UINT64_C(  969088047738095900),
+      UINT64_C(            61423920) },
+    { UINT64_C(  444254983056279786),
+      UINT64_C(   36169965329516632),
+      UINT64_C(                1229) },
+    { UINT64_C(17479275032934490900),
+      UINT64_C(18354916877053548069),
+      UINT64_C(         32654770442) },
+    { UINT64_C( 7577744983748053533),
+      UINT64_C(16751423327740903448),
+      UINT64_C(              966403) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_pext_u64(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t mask = HEDLEY_STATIC_CAST(uint64_t, ((i & 1) ? (simde_test_codegen_random_u64() & simde_test_codegen_random_u64()) : simde_test_codegen_random_u64()));
+    uint64_t r = simde_pext_u64(a, mask);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, mask, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mulx_u32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a;
+    const uint32_t b;
+    const uint32_t r;
+    const uint32_t hi;
+  } test_vec[] = {
+    { UINT32_C(  43717212),
+      UINT32_C(4060107989),
+      UINT32_C(  84702860),
+      UINT32_C(  41326648) },
+    { UINT32_C(1224003166),
+      UINT32_C(4105313628),
+      UINT32_C( 146198472),
+      UINT32_C(1169954631) },
+    { UINT32_C(1240558190),
+      UINT32_C(1144549061),
+      UINT32_C( 580004518),
+      UINT32_C( 330591507) },
+    { UINT32_C( 415935573),
+      UINT32_C( 234963890),
+      UINT32_C(2589659674),
+      UINT32_C(  22754501) },
+    { UINT32_C( 705797205),
+      UINT32_C(1310462448),
+      UINT32_C(2603627696),
+      UINT32_C( 215349889) },
+    { UINT32_C(1016467935),
+      UINT32_C(2620409902),
+      UINT32_C(1439559186),
+      UINT32_C( 620159004) },
+    { UINT32_C(2028282291),
+      UINT32_C(3837533583),
+      UINT32_C(2822969853),
+      UINT32_C(1812260925) },
+    { UINT32_C(2080212937),
+      UINT32_C( 545980106),
+      UINT32_C(3038810778),
+      UINT32_C( 264438539) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t hi;
+    uint32_t r = simde_mulx_u32(test_vec[i].a, test_vec[i].b, &hi);
+    simde_assert_equal_u32(r, test_vec[i].r);
+    simde_assert_equal_u32(hi, test_vec[i].hi);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint32_t a = simde_test_codegen_random_u32();
+    uint32_t b = simde_test_codegen_random_u32();
+    uint32_t hi;
+    uint32_t r = simde_mulx_u32(a, b, &hi);
+
+    simde_test_codegen_write_u32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u32(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, r, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u32(2, hi, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mulx_u64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a;
+    const uint64_t b;
+    const uint64_t r;
+    const uint64_t hi;
+  } test_vec[] = {
+    { UINT64_C(10148975751031593882),
+      UINT64_C( 7657237259120832120),
+      UINT64_C( 9355544958006008880),
+      UINT64_C( 4212836419922489685) },
+    { UINT64_C( 1121008483108530202),
+      UINT64_C( 2526543073145228070),
+      UINT64_C(   88627273618821596),
+      UINT64_C(  153538001428202134) },
+    { UINT64_C( 4244789718621707184),
+      UINT64_C(14056899548553457907),
+      UINT64_C(18303584327978911760),
+      UINT64_C( 3234640348506703708) },
+    { UINT64_C(13592420674989520716),
+      UINT64_C(17379880524116143237),
+      UINT64_C(17451253311615109756),
+      UINT64_C(12806305894465544021) },
+    { UINT64_C( 6274699983326207512),
+      UINT64_C( 7229146121610851559),
+      UINT64_C(15602538018696677288),
+      UINT64_C( 2459009723747552620) },
+    { UINT64_C( 4566535375047540493),
+      UINT64_C(16210565880802577348),
+      UINT64_C(13249216280945612020),
+      UINT64_C( 4012964144156273509) },
+    { UINT64_C( 7068626646084502878),
+      UINT64_C( 4413322235997199043),
+      UINT64_C( 5572831797865767578),
+      UINT64_C( 1691145441736138786) },
+    { UINT64_C(10447858334171149573),
+      UINT64_C( 3094973276575124554),
+      UINT64_C( 9386148619301343090),
+      UINT64_C( 1752929525801125447) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t hi;
+    uint64_t r = simde_mulx_u64(test_vec[i].a, test_vec[i].b, &hi);
+    simde_assert_equal_u64(r, test_vec[i].r);
+    simde_assert_equal_u64(hi, test_vec[i].hi);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    uint64_t a = simde_test_codegen_random_u64();
+    uint64_t b = simde_test_codegen_random_u64();
+    uint64_t hi;
+    uint64_t r = simde_mulx_u64(a, b, &hi);
+
+    simde_test_codegen_write_u64(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u64(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, r, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_u64(2, hi, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(bzhi_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bzhi_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pdep_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pdep_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pext_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pext_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mulx_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mulx_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -376,12 +376,239 @@ test_simde_mm512_clmulepi64_epi128 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static const uint8_t simde_test_x86_crc_data[192] = {
+    UINT8_C(240), UINT8_C( 93), UINT8_C(155), UINT8_C(102), UINT8_C(209), UINT8_C(135), UINT8_C(125), UINT8_C(255),
+    UINT8_C(181), UINT8_C(212), UINT8_C(111), UINT8_C(158), UINT8_C(169), UINT8_C( 38), UINT8_C(105), UINT8_C(239),
+    UINT8_C( 75), UINT8_C(108), UINT8_C(210), UINT8_C( 29), UINT8_C(178), UINT8_C(213), UINT8_C(238), UINT8_C( 63),
+    UINT8_C( 71), UINT8_C(167), UINT8_C(199), UINT8_C(169), UINT8_C(176), UINT8_C(102), UINT8_C(166), UINT8_C(218),
+    UINT8_C(212), UINT8_C(162), UINT8_C(109), UINT8_C(208), UINT8_C(117), UINT8_C(104), UINT8_C( 20), UINT8_C(115),
+    UINT8_C(  9), UINT8_C(132), UINT8_C(163), UINT8_C(215), UINT8_C( 57), UINT8_C(169), UINT8_C(118), UINT8_C(120),
+    UINT8_C(237), UINT8_C(187), UINT8_C( 69), UINT8_C(103), UINT8_C(188), UINT8_C(252), UINT8_C( 72), UINT8_C(134),
+    UINT8_C(198), UINT8_C(172), UINT8_C(171), UINT8_C(238), UINT8_C( 86), UINT8_C( 67), UINT8_C(169), UINT8_C(105),
+    UINT8_C( 33), UINT8_C( 50), UINT8_C( 88), UINT8_C(  2), UINT8_C( 77), UINT8_C(224), UINT8_C(120), UINT8_C(179),
+    UINT8_C(117), UINT8_C( 41), UINT8_C(100), UINT8_C(145), UINT8_C(122), UINT8_C(236), UINT8_C(134), UINT8_C(246),
+    UINT8_C(223), UINT8_C(212), UINT8_C(102), UINT8_C( 36), UINT8_C(154), UINT8_C(154), UINT8_C(142), UINT8_C( 69),
+    UINT8_C(128), UINT8_C( 51), UINT8_C(253), UINT8_C(111), UINT8_C(100), UINT8_C(198), UINT8_C( 90), UINT8_C(114),
+    UINT8_C(163), UINT8_C(181), UINT8_C( 23), UINT8_C(193), UINT8_C( 37), UINT8_C( 60), UINT8_C(117), UINT8_C( 28),
+    UINT8_C( 64), UINT8_C(107), UINT8_C( 44), UINT8_C( 88), UINT8_C(120), UINT8_C(249), UINT8_C( 84), UINT8_C( 82),
+    UINT8_C( 44), UINT8_C( 64), UINT8_C( 53), UINT8_C( 15), UINT8_C( 55), UINT8_C( 92), UINT8_C(161), UINT8_C(  0),
+    UINT8_C( 62), UINT8_C(143), UINT8_C( 14), UINT8_C( 93), UINT8_C( 31), UINT8_C( 53), UINT8_C(107), UINT8_C(106),
+    UINT8_C( 97), UINT8_C(236), UINT8_C( 95), UINT8_C(242), UINT8_C(160), UINT8_C(139), UINT8_C(232), UINT8_C(224),
+    UINT8_C(111), UINT8_C(204), UINT8_C(229), UINT8_C(214), UINT8_C( 68), UINT8_C(107), UINT8_C( 82), UINT8_C(159),
+    UINT8_C(203), UINT8_C(100), UINT8_C( 91), UINT8_C(182), UINT8_C(233), UINT8_C(  7), UINT8_C( 61), UINT8_C(171),
+    UINT8_C(  1), UINT8_C(114), UINT8_C(214), UINT8_C( 19), UINT8_C(109), UINT8_C(237), UINT8_C(254), UINT8_C( 25),
+    UINT8_C(220), UINT8_C(170), UINT8_C(  5), UINT8_C(174), UINT8_C(130), UINT8_C( 80), UINT8_C(115), UINT8_C( 55),
+    UINT8_C(220), UINT8_C( 34), UINT8_C( 68), UINT8_C( 89), UINT8_C( 12), UINT8_C(173), UINT8_C(157), UINT8_C(129),
+    UINT8_C(253), UINT8_C( 82), UINT8_C(185), UINT8_C(238), UINT8_C(222), UINT8_C(251), UINT8_C(167), UINT8_C( 81),
+    UINT8_C( 19), UINT8_C( 62), UINT8_C( 61), UINT8_C(186), UINT8_C(217), UINT8_C( 92), UINT8_C( 48), UINT8_C( 27)
+};
+
+static int
+test_simde_x_crc32_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t crc;
+    size_t offset;
+    size_t len;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(2833117271),  0,   0, UINT32_C(2833117271) },
+    { UINT32_C(3837046377),  5,   1, UINT32_C(1196850129) },
+    { UINT32_C(1174339981),  3,  15, UINT32_C(3395267189) },
+    { UINT32_C( 505235220),  0,  63, UINT32_C(2128563810) },
+    { UINT32_C(2435920134),  0,  64, UINT32_C( 346814806) },
+    { UINT32_C(2507432549),  9,  65, UINT32_C(2155213873) },
+    { UINT32_C(1852771312),  1, 100, UINT32_C(3070501065) },
+    { UINT32_C(1142234198),  0, 128, UINT32_C(3119127993) },
+    { UINT32_C(2400300399), 13, 150, UINT32_C(3982288717) },
+    { UINT32_C(3280490051),  0, 192, UINT32_C(2969092102) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_x_crc32_buffer(test_vec[i].crc, &(simde_test_x86_crc_data[test_vec[i].offset]), test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_crc32c_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t crc;
+    size_t offset;
+    size_t len;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(4034902271),  0,   0, UINT32_C(4034902271) },
+    { UINT32_C(2208962312),  5,   1, UINT32_C(3697716555) },
+    { UINT32_C( 853917146),  3,  15, UINT32_C(1810871835) },
+    { UINT32_C(1747841511),  0,  63, UINT32_C(1533016755) },
+    { UINT32_C(3500836971),  0,  64, UINT32_C(4022748859) },
+    { UINT32_C(2540249342),  9,  65, UINT32_C(3711384745) },
+    { UINT32_C( 478383387),  1, 100, UINT32_C(  94497130) },
+    { UINT32_C(1209730884),  0, 128, UINT32_C(  54380379) },
+    { UINT32_C( 980038524), 13, 150, UINT32_C( 865688863) },
+    { UINT32_C(3458244779),  0, 192, UINT32_C( 340015040) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_x_crc32c_buffer(test_vec[i].crc, &(simde_test_x86_crc_data[test_vec[i].offset]), test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_crc64_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t crc;
+    size_t offset;
+    size_t len;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(10570481332887487315),  0,   0, UINT64_C(10570481332887487315) },
+    { UINT64_C(17038771810393376822),  5,   1, UINT64_C(18159232243587519806) },
+    { UINT64_C( 4652516644948978148),  3,  15, UINT64_C(10361252061717035656) },
+    { UINT64_C(12011538180450069573),  0,  63, UINT64_C( 2794599068244453615) },
+    { UINT64_C(12034550290124725660),  0,  64, UINT64_C( 2178048574721650608) },
+    { UINT64_C(17374571522549307733),  9,  65, UINT64_C(17145568394766993616) },
+    { UINT64_C( 5472803018040617350),  1, 100, UINT64_C( 4929968105420170181) },
+    { UINT64_C( 9564530736591783206),  0, 128, UINT64_C(16250593855302617392) },
+    { UINT64_C(17845724251349299494), 13, 150, UINT64_C( 5658552587109315568) },
+    { UINT64_C(12826227658480616156),  0, 192, UINT64_C( 4014492027213403339) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_x_crc64_buffer(test_vec[i].crc, &(simde_test_x86_crc_data[test_vec[i].offset]), test_vec[i].len);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_ghash_blocks (SIMDE_MUNIT_TEST_ARGS) {
+  /* H and the first four blocks of data are from GCM test case 3 */
+  static const uint8_t key[16] =
+    { UINT8_C(184), UINT8_C( 59), UINT8_C( 83), UINT8_C( 55), UINT8_C(  8), UINT8_C(191), UINT8_C( 83), UINT8_C( 93),
+      UINT8_C( 10), UINT8_C(166), UINT8_C(229), UINT8_C( 41), UINT8_C(128), UINT8_C(213), UINT8_C( 59), UINT8_C(120) };
+  static const uint8_t data[176] = {
+    UINT8_C( 66), UINT8_C(131), UINT8_C( 30), UINT8_C(194), UINT8_C( 33), UINT8_C(119), UINT8_C(116), UINT8_C( 36),
+    UINT8_C( 75), UINT8_C(114), UINT8_C( 33), UINT8_C(183), UINT8_C(132), UINT8_C(208), UINT8_C(212), UINT8_C(156),
+    UINT8_C(227), UINT8_C(170), UINT8_C( 33), UINT8_C( 47), UINT8_C( 44), UINT8_C(  2), UINT8_C(164), UINT8_C(224),
+    UINT8_C( 53), UINT8_C(193), UINT8_C(126), UINT8_C( 35), UINT8_C( 41), UINT8_C(172), UINT8_C(161), UINT8_C( 46),
+    UINT8_C( 33), UINT8_C(213), UINT8_C( 20), UINT8_C(178), UINT8_C( 84), UINT8_C(102), UINT8_C(147), UINT8_C( 28),
+    UINT8_C(125), UINT8_C(143), UINT8_C(106), UINT8_C( 90), UINT8_C(172), UINT8_C(132), UINT8_C(170), UINT8_C(  5),
+    UINT8_C( 27), UINT8_C(163), UINT8_C( 11), UINT8_C( 57), UINT8_C(106), UINT8_C( 10), UINT8_C(172), UINT8_C(151),
+    UINT8_C( 61), UINT8_C( 88), UINT8_C(224), UINT8_C(145), UINT8_C( 71), UINT8_C( 63), UINT8_C( 89), UINT8_C(133),
+    UINT8_C(215), UINT8_C( 74), UINT8_C( 28), UINT8_C( 16), UINT8_C(252), UINT8_C(171), UINT8_C(106), UINT8_C( 66),
+    UINT8_C( 67), UINT8_C(211), UINT8_C( 54), UINT8_C( 86), UINT8_C(222), UINT8_C(190), UINT8_C( 76), UINT8_C( 30),
+    UINT8_C(215), UINT8_C(150), UINT8_C( 72), UINT8_C(232), UINT8_C( 86), UINT8_C(232), UINT8_C(249), UINT8_C(162),
+    UINT8_C(245), UINT8_C(140), UINT8_C(149), UINT8_C(240), UINT8_C(206), UINT8_C( 75), UINT8_C( 57), UINT8_C(193),
+    UINT8_C( 91), UINT8_C(255), UINT8_C(173), UINT8_C( 92), UINT8_C( 45), UINT8_C(251), UINT8_C(139), UINT8_C(184),
+    UINT8_C( 32), UINT8_C(182), UINT8_C( 17), UINT8_C(156), UINT8_C(186), UINT8_C(143), UINT8_C(248), UINT8_C(135),
+    UINT8_C(150), UINT8_C(174), UINT8_C( 91), UINT8_C(  5), UINT8_C(242), UINT8_C(128), UINT8_C(166), UINT8_C(140),
+    UINT8_C(237), UINT8_C(147), UINT8_C(182), UINT8_C(178), UINT8_C(140), UINT8_C(176), UINT8_C(209), UINT8_C(179),
+    UINT8_C( 88), UINT8_C(230), UINT8_C(186), UINT8_C(171), UINT8_C( 72), UINT8_C( 85), UINT8_C(101), UINT8_C(185),
+    UINT8_C(244), UINT8_C(144), UINT8_C( 40), UINT8_C(213), UINT8_C( 87), UINT8_C(215), UINT8_C(154), UINT8_C(138),
+    UINT8_C( 14), UINT8_C(100), UINT8_C( 81), UINT8_C(225), UINT8_C( 92), UINT8_C(112), UINT8_C( 92), UINT8_C( 21),
+    UINT8_C(241), UINT8_C(115), UINT8_C( 84), UINT8_C( 27), UINT8_C( 68), UINT8_C( 56), UINT8_C(162), UINT8_C( 92),
+    UINT8_C(247), UINT8_C( 99), UINT8_C( 18), UINT8_C(212), UINT8_C(238), UINT8_C(179), UINT8_C(194), UINT8_C( 36),
+    UINT8_C(104), UINT8_C(121), UINT8_C(191), UINT8_C(  0), UINT8_C(179), UINT8_C(207), UINT8_C(142), UINT8_C(209)
+  };
+  static const struct {
+    size_t blocks;
+    uint8_t hash[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    {  0,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+    {  1,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 89), UINT8_C(237), UINT8_C( 63), UINT8_C( 43), UINT8_C(177), UINT8_C(160), UINT8_C(170), UINT8_C(160),
+        UINT8_C(124), UINT8_C(159), UINT8_C( 86), UINT8_C(198), UINT8_C(165), UINT8_C(  4), UINT8_C(100), UINT8_C(123) } },
+    {  1,
+      { UINT8_C( 58), UINT8_C(191), UINT8_C( 18), UINT8_C(154), UINT8_C( 48), UINT8_C(151), UINT8_C(173), UINT8_C(150),
+        UINT8_C(180), UINT8_C( 66), UINT8_C(214), UINT8_C(209), UINT8_C(189), UINT8_C(239), UINT8_C( 72), UINT8_C( 80) },
+      { UINT8_C(160), UINT8_C(137), UINT8_C(194), UINT8_C(203), UINT8_C(191), UINT8_C( 23), UINT8_C(157), UINT8_C( 57),
+        UINT8_C( 65), UINT8_C(113), UINT8_C(213), UINT8_C( 20), UINT8_C(167), UINT8_C( 15), UINT8_C(201), UINT8_C(241) } },
+    {  3,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 71), UINT8_C( 64), UINT8_C( 12), UINT8_C(101), UINT8_C(119), UINT8_C(177), UINT8_C(238), UINT8_C(141),
+        UINT8_C(143), UINT8_C( 64), UINT8_C(178), UINT8_C(114), UINT8_C( 30), UINT8_C(134), UINT8_C(255), UINT8_C( 16) } },
+    {  3,
+      { UINT8_C(195), UINT8_C(244), UINT8_C(101), UINT8_C( 68), UINT8_C( 46), UINT8_C(179), UINT8_C(  0), UINT8_C(195),
+        UINT8_C( 55), UINT8_C(166), UINT8_C( 72), UINT8_C(166), UINT8_C(192), UINT8_C(219), UINT8_C(221), UINT8_C(115) },
+      { UINT8_C(106), UINT8_C( 31), UINT8_C( 73), UINT8_C(223), UINT8_C( 13), UINT8_C(186), UINT8_C( 41), UINT8_C(211),
+        UINT8_C(251), UINT8_C( 87), UINT8_C(167), UINT8_C(165), UINT8_C(250), UINT8_C(188), UINT8_C(198), UINT8_C( 61) } },
+    {  4,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 71), UINT8_C(150), UINT8_C(207), UINT8_C( 73), UINT8_C( 70), UINT8_C( 71), UINT8_C(  4), UINT8_C(181),
+        UINT8_C(221), UINT8_C(145), UINT8_C(241), UINT8_C( 89), UINT8_C(187), UINT8_C( 27), UINT8_C(127), UINT8_C(149) } },
+    {  4,
+      { UINT8_C(252), UINT8_C(149), UINT8_C(245), UINT8_C(194), UINT8_C(196), UINT8_C( 81), UINT8_C(133), UINT8_C(154),
+        UINT8_C(254), UINT8_C(128), UINT8_C(212), UINT8_C( 10), UINT8_C(163), UINT8_C(157), UINT8_C(251), UINT8_C(146) },
+      { UINT8_C(121), UINT8_C( 56), UINT8_C( 10), UINT8_C(213), UINT8_C(107), UINT8_C( 26), UINT8_C( 12), UINT8_C( 43),
+        UINT8_C(149), UINT8_C(142), UINT8_C(119), UINT8_C(180), UINT8_C(249), UINT8_C(121), UINT8_C(105), UINT8_C( 20) } },
+    {  5,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(212), UINT8_C(103), UINT8_C( 24), UINT8_C(  2), UINT8_C(106), UINT8_C(245), UINT8_C( 63), UINT8_C(217),
+        UINT8_C(194), UINT8_C( 90), UINT8_C(220), UINT8_C( 81), UINT8_C(  7), UINT8_C( 43), UINT8_C(141), UINT8_C( 16) } },
+    {  5,
+      { UINT8_C( 73), UINT8_C(244), UINT8_C( 12), UINT8_C( 62), UINT8_C(227), UINT8_C(125), UINT8_C(150), UINT8_C( 20),
+        UINT8_C( 69), UINT8_C(200), UINT8_C(  6), UINT8_C(245), UINT8_C(140), UINT8_C(124), UINT8_C(242), UINT8_C( 18) },
+      { UINT8_C(175), UINT8_C(210), UINT8_C( 52), UINT8_C(131), UINT8_C(225), UINT8_C(232), UINT8_C(170), UINT8_C( 64),
+        UINT8_C(165), UINT8_C(124), UINT8_C(144), UINT8_C(233), UINT8_C(222), UINT8_C(113), UINT8_C(185), UINT8_C(112) } },
+    {  8,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 51), UINT8_C( 31), UINT8_C(174), UINT8_C(103), UINT8_C(118), UINT8_C(140), UINT8_C(196), UINT8_C(153),
+        UINT8_C(  1), UINT8_C( 48), UINT8_C(189), UINT8_C( 81), UINT8_C(250), UINT8_C(194), UINT8_C(143), UINT8_C(101) } },
+    {  8,
+      { UINT8_C(125), UINT8_C(250), UINT8_C(137), UINT8_C( 79), UINT8_C(146), UINT8_C(150), UINT8_C(252), UINT8_C(243),
+        UINT8_C( 60), UINT8_C(  8), UINT8_C( 64), UINT8_C(153), UINT8_C(144), UINT8_C(172), UINT8_C(151), UINT8_C( 13) },
+      { UINT8_C(204), UINT8_C( 66), UINT8_C(171), UINT8_C(191), UINT8_C(154), UINT8_C(155), UINT8_C( 62), UINT8_C( 24),
+        UINT8_C(203), UINT8_C( 20), UINT8_C(203), UINT8_C(114), UINT8_C(171), UINT8_C(  5), UINT8_C(218), UINT8_C(  2) } },
+    { 11,
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(159), UINT8_C(187), UINT8_C(166), UINT8_C(206), UINT8_C(117), UINT8_C(  0), UINT8_C( 14), UINT8_C(135),
+        UINT8_C( 15), UINT8_C( 84), UINT8_C(  5), UINT8_C( 21), UINT8_C(188), UINT8_C(226), UINT8_C( 31), UINT8_C(156) } },
+    { 11,
+      { UINT8_C(237), UINT8_C(179), UINT8_C(184), UINT8_C( 67), UINT8_C( 18), UINT8_C(  1), UINT8_C(129), UINT8_C(233),
+        UINT8_C( 55), UINT8_C( 97), UINT8_C(  7), UINT8_C(219), UINT8_C(218), UINT8_C(246), UINT8_C(197), UINT8_C(243) },
+      { UINT8_C(145), UINT8_C(176), UINT8_C( 45), UINT8_C( 16), UINT8_C(101), UINT8_C(120), UINT8_C( 17), UINT8_C(243),
+        UINT8_C( 67), UINT8_C(175), UINT8_C( 24), UINT8_C(142), UINT8_C(226), UINT8_C( 59), UINT8_C(184), UINT8_C(252) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint8_t r[16];
+    simde_memcpy(r, test_vec[i].hash, sizeof(r));
+    simde_x_ghash_blocks(r, key, data, test_vec[i].blocks);
+    simde_assert_equal_vu8(16, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(x_clmul_u64)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_clmulepi64_epi128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_clmulepi64_epi128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_clmulepi64_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_crc32_buffer)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_crc32c_buffer)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_crc64_buffer)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_ghash_blocks)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
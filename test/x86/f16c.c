@@ -401,6 +401,70 @@ test_simde_mm256_f16c_round_trip (SIMDE_MUNIT_TEST_ARGS) {
   #endif
 }
 
+static int
+test_simde_x_convert_f32_to_f16_array (SIMDE_MUNIT_TEST_ARGS) {
+  /* Zeros, rounding ties, overflow, subnormals, infinities and NaNs. */
+  static const uint32_t a[] = {
+    UINT32_C(0x00000000), UINT32_C(0x80000000), UINT32_C(0x3f800000), UINT32_C(0xc0200000),
+    UINT32_C(0x477fe000), UINT32_C(0x477fefff), UINT32_C(0x477ff000), UINT32_C(0xc7800000),
+    UINT32_C(0x38800000), UINT32_C(0x387fc000), UINT32_C(0x33000000), UINT32_C(0x33000001),
+    UINT32_C(0x33c00000), UINT32_C(0x00000001), UINT32_C(0x3f801000), UINT32_C(0x3f803000),
+    UINT32_C(0x7f800000), UINT32_C(0xff800000), UINT32_C(0x7fc00000), UINT32_C(0xff812345),
+    UINT32_C(0x7f800001)
+  };
+  static const uint16_t r[] = {
+    UINT16_C(0x0000), UINT16_C(0x8000), UINT16_C(0x3c00), UINT16_C(0xc100), UINT16_C(0x7bff), UINT16_C(0x7bff),
+    UINT16_C(0x7c00), UINT16_C(0xfc00), UINT16_C(0x0400), UINT16_C(0x03ff), UINT16_C(0x0000), UINT16_C(0x0001),
+    UINT16_C(0x0002), UINT16_C(0x0000), UINT16_C(0x3c00), UINT16_C(0x3c02), UINT16_C(0x7c00), UINT16_C(0xfc00),
+    UINT16_C(0x7e00), UINT16_C(0xfe09), UINT16_C(0x7e00)
+  };
+  const size_t len = sizeof(a) / sizeof(a[0]);
+  simde_float32 src[sizeof(a) / sizeof(a[0])];
+  simde_float16 dst[sizeof(a) / sizeof(a[0])];
+  uint16_t dst_bits[sizeof(a) / sizeof(a[0])];
+
+  simde_memcpy(src, a, sizeof(src));
+
+  /* Every length, so each native block size and tail is exercised. */
+  for (size_t n = 0 ; n <= len ; n++) {
+    simde_x_convert_f32_to_f16_array(dst, src, n);
+    simde_memcpy(dst_bits, dst, sizeof(dst_bits[0]) * n);
+    simde_assert_equal_vu16(n, dst_bits, r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_convert_f16_to_f32_array (SIMDE_MUNIT_TEST_ARGS) {
+  static const uint16_t a[] = {
+    UINT16_C(0x0000), UINT16_C(0x8000), UINT16_C(0x0001), UINT16_C(0x0200), UINT16_C(0x03ff), UINT16_C(0x0400),
+    UINT16_C(0x83ff), UINT16_C(0x3c00), UINT16_C(0x3555), UINT16_C(0xc500), UINT16_C(0x7bff), UINT16_C(0x7c00),
+    UINT16_C(0xfc00), UINT16_C(0x7c01), UINT16_C(0xfe01), UINT16_C(0x7e00), UINT16_C(0x7fff)
+  };
+  static const uint32_t r[] = {
+    UINT32_C(0x00000000), UINT32_C(0x80000000), UINT32_C(0x33800000), UINT32_C(0x38000000),
+    UINT32_C(0x387fc000), UINT32_C(0x38800000), UINT32_C(0xb87fc000), UINT32_C(0x3f800000),
+    UINT32_C(0x3eaaa000), UINT32_C(0xc0a00000), UINT32_C(0x477fe000), UINT32_C(0x7f800000),
+    UINT32_C(0xff800000), UINT32_C(0x7fc02000), UINT32_C(0xffc02000), UINT32_C(0x7fc00000),
+    UINT32_C(0x7fffe000)
+  };
+  const size_t len = sizeof(a) / sizeof(a[0]);
+  simde_float16 src[sizeof(a) / sizeof(a[0])];
+  simde_float32 dst[sizeof(a) / sizeof(a[0])];
+  uint32_t dst_bits[sizeof(a) / sizeof(a[0])];
+
+  simde_memcpy(src, a, sizeof(src));
+
+  for (size_t n = 0 ; n <= len ; n++) {
+    simde_x_convert_f16_to_f32_array(dst, src, n);
+    simde_memcpy(dst_bits, dst, sizeof(dst_bits[0]) * n);
+    simde_assert_equal_vu32(n, dst_bits, r);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtps_ph)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtph_ps)
@@ -409,6 +473,9 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtps_ph)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtph_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_f16c_round_trip)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_convert_f32_to_f16_array)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_convert_f16_to_f32_array)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
@@ -0,0 +1,509 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX sha
+#include <simde/x86/sha.h>
+#include <test/x86/avx512/test-avx512.h>
+
+static int
+test_simde_mm_sha1msg1_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 263541427), UINT32_C( 640353216), UINT32_C(2198157086), UINT32_C(4151175335) },
+      { UINT32_C( 682725326), UINT32_C(3430058619), UINT32_C(3582548443), UINT32_C(2160821453) },
+      { UINT32_C(3661368168), UINT32_C(2799732493), UINT32_C(2360370605), UINT32_C(3511085927) } },
+    { { UINT32_C(2542764247), UINT32_C(2713565827), UINT32_C(2569323249), UINT32_C(2039517867) },
+      { UINT32_C(2627879457), UINT32_C(2825458892), UINT32_C( 981332589), UINT32_C(1320831351) },
+      { UINT32_C(2918347450), UINT32_C(4010275828), UINT32_C( 246104614), UINT32_C(3626838056) } },
+    { { UINT32_C(1306872265), UINT32_C(4109279747), UINT32_C( 260903780), UINT32_C(3330875045) },
+      { UINT32_C( 744631136), UINT32_C(2899626815), UINT32_C( 904286910), UINT32_C(1686347931) },
+      { UINT32_C(2013469559), UINT32_C(2423063192), UINT32_C(1114135213), UINT32_C( 845659302) } },
+    { { UINT32_C(3971049705), UINT32_C(1860214794), UINT32_C(1484680883), UINT32_C(3961390988) },
+      { UINT32_C(1897431090), UINT32_C( 169733452), UINT32_C(3661562687), UINT32_C(2352923299) },
+      { UINT32_C( 915303382), UINT32_C(3806225065), UINT32_C(3033466458), UINT32_C(2197727110) } },
+    { { UINT32_C( 880341034), UINT32_C(1134712976), UINT32_C(1385898182), UINT32_C(1497282855) },
+      { UINT32_C(2244630329), UINT32_C(2207246148), UINT32_C(2371735274), UINT32_C(3122240400) },
+      { UINT32_C(3106225856), UINT32_C(4189831936), UINT32_C(1726206188), UINT32_C( 446489015) } },
+    { { UINT32_C( 468619659), UINT32_C(2958987754), UINT32_C(3640916401), UINT32_C(3962716594) },
+      { UINT32_C(3698458008), UINT32_C(3479110116), UINT32_C(1616690383), UINT32_C(3810162264) },
+      { UINT32_C(2075274564), UINT32_C(1397024690), UINT32_C(3270338618), UINT32_C(1550635096) } },
+    { { UINT32_C(4060023047), UINT32_C(1268931994), UINT32_C( 153396567), UINT32_C(2146785254) },
+      { UINT32_C( 945514324), UINT32_C( 923253608), UINT32_C(3482805367), UINT32_C(3786650330) },
+      { UINT32_C(1047031152), UINT32_C(2853302080), UINT32_C(4175146064), UINT32_C( 878119548) } },
+    { { UINT32_C(1439937211), UINT32_C(1721791759), UINT32_C(   7390490), UINT32_C(1887397148) },
+      { UINT32_C( 883481548), UINT32_C( 225226902), UINT32_C(4007461652), UINT32_C(1892651189) },
+      { UINT32_C(3138302383), UINT32_C( 376432058), UINT32_C(1436776353), UINT32_C( 383717395) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg1_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha1msg1_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha1msg2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1371906626), UINT32_C( 834168343), UINT32_C(1194469419), UINT32_C(1521987981) },
+      { UINT32_C( 579755916), UINT32_C( 590412303), UINT32_C(3004239358), UINT32_C(3743736221) },
+      { UINT32_C(  85046603), UINT32_C( 644641590), UINT32_C(3355812936), UINT32_C(3545069799) } },
+    { { UINT32_C(2603673987), UINT32_C(2060249167), UINT32_C(2663513616), UINT32_C(1022916784) },
+      { UINT32_C(3881797336), UINT32_C(2131464065), UINT32_C( 959585436), UINT32_C(2165855997) },
+      { UINT32_C( 558384055), UINT32_C( 992402735), UINT32_C(3281314595), UINT32_C( 194299992) } },
+    { { UINT32_C(2400995392), UINT32_C(1091233841), UINT32_C(2548026343), UINT32_C( 483645252) },
+      { UINT32_C(3741528670), UINT32_C(1566445249), UINT32_C( 680955947), UINT32_C( 665431783) },
+      { UINT32_C(3475868989), UINT32_C(1007924447), UINT32_C(2500037197), UINT32_C(1753911006) } },
+    { { UINT32_C( 683066871), UINT32_C(2506735790), UINT32_C(3492563340), UINT32_C(2129461024) },
+      { UINT32_C(4083019570), UINT32_C( 693222398), UINT32_C( 861005644), UINT32_C(2371550102) },
+      { UINT32_C(1738140255), UINT32_C(3429392184), UINT32_C(4076594405), UINT32_C(2608476376) } },
+    { { UINT32_C(1857360064), UINT32_C(1560485585), UINT32_C(2284662631), UINT32_C(1627789615) },
+      { UINT32_C( 106193928), UINT32_C(1798284575), UINT32_C( 597590413), UINT32_C(1018230908) },
+      { UINT32_C(3607642889), UINT32_C(3064919474), UINT32_C(3322221809), UINT32_C(2234593604) } },
+    { { UINT32_C(3668665609), UINT32_C(3946294915), UINT32_C( 225666270), UINT32_C(2238609789) },
+      { UINT32_C(4253860573), UINT32_C(4117281640), UINT32_C(3088582460), UINT32_C( 150325503) },
+      { UINT32_C(1083126551), UINT32_C( 762763452), UINT32_C(4030185325), UINT32_C(2062351490) } },
+    { { UINT32_C(2967642157), UINT32_C( 748362062), UINT32_C(4198043261), UINT32_C(1702930312) },
+      { UINT32_C(3529641066), UINT32_C(  80202695), UINT32_C(3518816210), UINT32_C(3571102119) },
+      { UINT32_C(2973016369), UINT32_C(4260506185), UINT32_C(4261251957), UINT32_C(1752756405) } },
+    { { UINT32_C(2693053521), UINT32_C(1405886678), UINT32_C(3058566702), UINT32_C( 387763885) },
+      { UINT32_C(2716434138), UINT32_C( 463843401), UINT32_C( 921526927), UINT32_C(1695205139) },
+      { UINT32_C(3335505963), UINT32_C(3830103065), UINT32_C(1540844751), UINT32_C(1138972740) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg2_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha1msg2_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha1nexte_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1493536643), UINT32_C(3719156143), UINT32_C(2241133527), UINT32_C(2744955081) },
+      { UINT32_C(2017756718), UINT32_C(3331582518), UINT32_C(1610383436), UINT32_C(3418621767) },
+      { UINT32_C(2017756718), UINT32_C(3331582518), UINT32_C(1610383436), UINT32_C( 883635065) } },
+    { { UINT32_C(1160038806), UINT32_C(1914884507), UINT32_C(2516039372), UINT32_C(2503513190) },
+      { UINT32_C(1343061274), UINT32_C(3004604519), UINT32_C(1746015009), UINT32_C(2956187418) },
+      { UINT32_C(1343061274), UINT32_C(3004604519), UINT32_C(1746015009), UINT32_C(1434582067) } },
+    { { UINT32_C(1005934752), UINT32_C(4138604329), UINT32_C( 881567182), UINT32_C(1405731897) },
+      { UINT32_C(2829375041), UINT32_C(2556148343), UINT32_C(3875565005), UINT32_C(3851891780) },
+      { UINT32_C(2829375041), UINT32_C(2556148343), UINT32_C(3875565005), UINT32_C( 982099282) } },
+    { { UINT32_C(3038809228), UINT32_C(1923862180), UINT32_C(2913351540), UINT32_C(1006727419) },
+      { UINT32_C(3185878342), UINT32_C( 760561503), UINT32_C(4044641964), UINT32_C( 383167626) },
+      { UINT32_C(3185878342), UINT32_C( 760561503), UINT32_C(4044641964), UINT32_C(3856074952) } },
+    { { UINT32_C(3704354360), UINT32_C( 961443781), UINT32_C(2850485678), UINT32_C(2883970917) },
+      { UINT32_C(3966355852), UINT32_C(3021585928), UINT32_C(2661625108), UINT32_C( 313818073) },
+      { UINT32_C(3966355852), UINT32_C(3021585928), UINT32_C(2661625108), UINT32_C(2108552626) } },
+    { { UINT32_C( 938377330), UINT32_C(2775596535), UINT32_C(2538493490), UINT32_C(3393336126) },
+      { UINT32_C(  79080444), UINT32_C(2126040938), UINT32_C(3592249085), UINT32_C(1273549273) },
+      { UINT32_C(  79080444), UINT32_C(2126040938), UINT32_C(3592249085), UINT32_C(4269366952) } },
+    { { UINT32_C(1216534353), UINT32_C(1189999124), UINT32_C(2279422793), UINT32_C(1783701358) },
+      { UINT32_C( 896403659), UINT32_C(3568510935), UINT32_C(1588318341), UINT32_C(4088042402) },
+      { UINT32_C( 896403659), UINT32_C(3568510935), UINT32_C(1588318341), UINT32_C(2386484093) } },
+    { { UINT32_C(2117872746), UINT32_C(1757686047), UINT32_C(3555696997), UINT32_C(2352890049) },
+      { UINT32_C( 549563464), UINT32_C(1492415699), UINT32_C(3887570757), UINT32_C(2648334643) },
+      { UINT32_C( 549563464), UINT32_C(1492415699), UINT32_C(3887570757), UINT32_C(  15331683) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1nexte_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha1nexte_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha1rnds4_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const int func;
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2887521933), UINT32_C(2769608768), UINT32_C(1131938690), UINT32_C(2362422852) },
+      { UINT32_C( 917278819), UINT32_C(1234149636), UINT32_C(1932543552), UINT32_C( 873532327) },
+       INT32_C(           0),
+      { UINT32_C(3043465335), UINT32_C( 870208672), UINT32_C( 967027878), UINT32_C(4226178228) } },
+    { { UINT32_C(1642147105), UINT32_C(2399597837), UINT32_C(1037205497), UINT32_C(2563350837) },
+      { UINT32_C( 919565873), UINT32_C(1467964951), UINT32_C(1271640228), UINT32_C(3699367099) },
+       INT32_C(           1),
+      { UINT32_C( 233891257), UINT32_C(2607635564), UINT32_C( 714331753), UINT32_C(1309723451) } },
+    { { UINT32_C( 373186569), UINT32_C(1336296534), UINT32_C(4186732739), UINT32_C(1267815706) },
+      { UINT32_C(3800129739), UINT32_C(1647968702), UINT32_C(1823278513), UINT32_C(3930598881) },
+       INT32_C(           2),
+      { UINT32_C(1389312914), UINT32_C(1917980660), UINT32_C(1147689833), UINT32_C(3487033553) } },
+    { { UINT32_C(3808462477), UINT32_C(2385684171), UINT32_C( 965197343), UINT32_C(3749976340) },
+      { UINT32_C( 952239737), UINT32_C(3097164807), UINT32_C(3794028545), UINT32_C(  46951541) },
+       INT32_C(           3),
+      { UINT32_C(3298425807), UINT32_C(2669097511), UINT32_C(2293268340), UINT32_C(1991957371) } },
+    { { UINT32_C(3202796787), UINT32_C(2454460531), UINT32_C(3956004055), UINT32_C(1724534765) },
+      { UINT32_C(1553894485), UINT32_C(2299804040), UINT32_C(4134221953), UINT32_C(2566404005) },
+       INT32_C(           0),
+      { UINT32_C(1489777111), UINT32_C( 439152636), UINT32_C(1716354330), UINT32_C(3577991242) } },
+    { { UINT32_C(2002181636), UINT32_C(3456738039), UINT32_C(1673122934), UINT32_C(2043314979) },
+      { UINT32_C(2564122640), UINT32_C( 572713633), UINT32_C(3340274978), UINT32_C(3378450885) },
+       INT32_C(           1),
+      { UINT32_C(2468086422), UINT32_C(1520303542), UINT32_C(3102880757), UINT32_C(3858603020) } },
+    { { UINT32_C(3863000559), UINT32_C(3467921752), UINT32_C(1077046557), UINT32_C(  28966129) },
+      { UINT32_C( 110727012), UINT32_C(2603137913), UINT32_C( 241385801), UINT32_C(1104659026) },
+       INT32_C(           2),
+      { UINT32_C(4086882986), UINT32_C(2755360951), UINT32_C(1461958830), UINT32_C(2602950671) } },
+    { { UINT32_C(3492288376), UINT32_C(2107563104), UINT32_C(1002295370), UINT32_C( 826046412) },
+      { UINT32_C(2134365446), UINT32_C(3659161489), UINT32_C(4075322784), UINT32_C(3090464576) },
+       INT32_C(           3),
+      { UINT32_C(2416731515), UINT32_C( 360512797), UINT32_C(2737604704), UINT32_C( 130786302) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r;
+    SIMDE_CONSTIFY_4_(simde_mm_sha1rnds4_epu32, r, (HEDLEY_UNREACHABLE(), simde_mm_setzero_si128()), test_vec[i].func, a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    int func = i & 3;
+    simde__m128i r;
+    SIMDE_CONSTIFY_4_(simde_mm_sha1rnds4_epu32, r, (HEDLEY_UNREACHABLE(), simde_mm_setzero_si128()), func, a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, func, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha256msg1_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 914906326), UINT32_C(2192778808), UINT32_C(3283972343), UINT32_C(3992254951) },
+      { UINT32_C(1617701839), UINT32_C( 725256075), UINT32_C(1142825476), UINT32_C(3086766817) },
+      { UINT32_C(3747970813), UINT32_C( 780159560), UINT32_C(2950299305), UINT32_C(2251521820) } },
+    { { UINT32_C(3874325678), UINT32_C(2724831403), UINT32_C(4167378448), UINT32_C(4024785440) },
+      { UINT32_C( 273633925), UINT32_C(3711732185), UINT32_C(2351061675), UINT32_C(1514348204) },
+      { UINT32_C( 303076476), UINT32_C( 434237762), UINT32_C(  51413017), UINT32_C(3429731078) } },
+    { { UINT32_C(1312829603), UINT32_C(3773868496), UINT32_C(4040709584), UINT32_C( 903855791) },
+      { UINT32_C(3913625104), UINT32_C(1657176503), UINT32_C(2280581339), UINT32_C(2866884871) },
+      { UINT32_C(3857448184), UINT32_C(2340368375), UINT32_C(2824068015), UINT32_C(2908607614) } },
+    { { UINT32_C( 838345313), UINT32_C(2601642187), UINT32_C(3985369661), UINT32_C(3089263272) },
+      { UINT32_C(1335977880), UINT32_C(3299960809), UINT32_C(1464639312), UINT32_C( 822160848) },
+      { UINT32_C( 811539053), UINT32_C( 938932924), UINT32_C(3395948997), UINT32_C( 414181500) } },
+    { { UINT32_C( 459471183), UINT32_C( 515273953), UINT32_C( 101401182), UINT32_C(1170091436) },
+      { UINT32_C(2123653013), UINT32_C( 373442246), UINT32_C(3060633317), UINT32_C( 199716540) },
+      { UINT32_C(2016861991), UINT32_C(2333176878), UINT32_C(3781356255), UINT32_C(2022255252) } },
+    { { UINT32_C(1210468967), UINT32_C( 476569022), UINT32_C(3408032287), UINT32_C( 890298528) },
+      { UINT32_C(  95659327), UINT32_C(3491558891), UINT32_C(1082558852), UINT32_C(1598779128) },
+      { UINT32_C(3506568572), UINT32_C(3604862509), UINT32_C(1241686704), UINT32_C(3439571745) } },
+    { { UINT32_C(1990750904), UINT32_C(1855065935), UINT32_C( 557429889), UINT32_C(3545647764) },
+      { UINT32_C(3671591407), UINT32_C(2209019135), UINT32_C(1992503678), UINT32_C(1473580703) },
+      { UINT32_C(2273653003), UINT32_C(3654753542), UINT32_C(3265463699), UINT32_C(2582352428) } },
+    { { UINT32_C(3486350720), UINT32_C( 238903180), UINT32_C(2804905747), UINT32_C(2960819905) },
+      { UINT32_C(2391429775), UINT32_C(3306239047), UINT32_C(  71029861), UINT32_C(1666912483) },
+      { UINT32_C( 503730241), UINT32_C(4239178067), UINT32_C(3691987166), UINT32_C(1256866839) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg1_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha256msg1_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha256msg2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 439560334), UINT32_C(2586341511), UINT32_C(2822854887), UINT32_C(1834531806) },
+      { UINT32_C(1442636302), UINT32_C(2082082071), UINT32_C(3313587682), UINT32_C(4079541349) },
+      { UINT32_C(2595193523), UINT32_C( 262864461), UINT32_C(3647631049), UINT32_C(2386921597) } },
+    { { UINT32_C(2349751045), UINT32_C(3005691596), UINT32_C(1817995406), UINT32_C( 853193764) },
+      { UINT32_C(2928137879), UINT32_C(3307905507), UINT32_C(1535814646), UINT32_C(2370810760) },
+      { UINT32_C(2359385891), UINT32_C(3804052398), UINT32_C(4038264865), UINT32_C(1836365419) } },
+    { { UINT32_C(3659095310), UINT32_C( 579747987), UINT32_C(3448695465), UINT32_C( 905930910) },
+      { UINT32_C( 585336382), UINT32_C( 501681703), UINT32_C(1098412729), UINT32_C( 869189413) },
+      { UINT32_C( 288699293), UINT32_C(3725135042), UINT32_C( 222843545), UINT32_C(3721273124) } },
+    { { UINT32_C(3087984676), UINT32_C(3520764968), UINT32_C( 614361222), UINT32_C( 257596881) },
+      { UINT32_C(1244740899), UINT32_C(  90642763), UINT32_C(2957435019), UINT32_C(3437434279) },
+      { UINT32_C(1686611895), UINT32_C(3123626832), UINT32_C(1272113088), UINT32_C(3376897971) } },
+    { { UINT32_C( 629469693), UINT32_C( 334978701), UINT32_C(2537067974), UINT32_C(1453822515) },
+      { UINT32_C( 463591631), UINT32_C(2082474225), UINT32_C(2418829032), UINT32_C(2019299451) },
+      { UINT32_C(3843179271), UINT32_C(2653168302), UINT32_C(  18014337), UINT32_C(3956058129) } },
+    { { UINT32_C(2409553921), UINT32_C(  77763902), UINT32_C(1570560554), UINT32_C(1018446700) },
+      { UINT32_C( 223827227), UINT32_C(1183414109), UINT32_C(1507243741), UINT32_C(3352376006) },
+      { UINT32_C( 490885757), UINT32_C(3282887836), UINT32_C(3239270343), UINT32_C( 731993606) } },
+    { { UINT32_C(1347841810), UINT32_C( 794097924), UINT32_C(1082978515), UINT32_C(1333542963) },
+      { UINT32_C(4082946965), UINT32_C( 658105674), UINT32_C(1635782555), UINT32_C(1395216961) },
+      { UINT32_C(1451043845), UINT32_C(3000058537), UINT32_C(1948553101), UINT32_C(3634994069) } },
+    { { UINT32_C(3332603841), UINT32_C(1291188088), UINT32_C( 462193128), UINT32_C(1466566850) },
+      { UINT32_C( 625657563), UINT32_C(1196196780), UINT32_C(3551120786), UINT32_C(3760640543) },
+      { UINT32_C(2784188819), UINT32_C(   6946075), UINT32_C(3814677625), UINT32_C( 412680968) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg2_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha256msg2_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha256rnds2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t k[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3399928145), UINT32_C(2836831169), UINT32_C(3754205725), UINT32_C(2234920874) },
+      { UINT32_C(2712306165), UINT32_C(2548692484), UINT32_C(3798635203), UINT32_C(3049492836) },
+      { UINT32_C( 461334874), UINT32_C( 583308549), UINT32_C(3774974263), UINT32_C(2909157304) },
+      { UINT32_C(2514466618), UINT32_C(3923341205), UINT32_C(  59670929), UINT32_C(2128333258) } },
+    { { UINT32_C(3176075448), UINT32_C(3394516999), UINT32_C( 783138506), UINT32_C(2867032143) },
+      { UINT32_C(3737478105), UINT32_C( 805341944), UINT32_C(3406889235), UINT32_C(4051204153) },
+      { UINT32_C(2410596232), UINT32_C(3378119423), UINT32_C( 284624833), UINT32_C(1354423159) },
+      { UINT32_C( 360925195), UINT32_C(  90607600), UINT32_C( 783838052), UINT32_C(4141779058) } },
+    { { UINT32_C( 909082686), UINT32_C( 493235978), UINT32_C(1793620017), UINT32_C(2019254512) },
+      { UINT32_C( 654838312), UINT32_C(3455148556), UINT32_C(3772704873), UINT32_C(  19962051) },
+      { UINT32_C( 574119704), UINT32_C(3225394831), UINT32_C( 103425814), UINT32_C(2961147272) },
+      { UINT32_C(1651893331), UINT32_C(2559723853), UINT32_C( 471824563), UINT32_C(2681459687) } },
+    { { UINT32_C(2631370639), UINT32_C(1382664425), UINT32_C(1949452209), UINT32_C(4168508128) },
+      { UINT32_C(1360768706), UINT32_C(1662081612), UINT32_C( 174668674), UINT32_C(1354426560) },
+      { UINT32_C(1491898735), UINT32_C( 195712346), UINT32_C(2105531549), UINT32_C(  24507711) },
+      { UINT32_C(2887576835), UINT32_C(1750154722), UINT32_C(1240747703), UINT32_C( 802211500) } },
+    { { UINT32_C(4031942819), UINT32_C(1834181611), UINT32_C(1584905374), UINT32_C( 346960293) },
+      { UINT32_C( 476945090), UINT32_C(2368149488), UINT32_C( 856336372), UINT32_C(1077182364) },
+      { UINT32_C(4214261264), UINT32_C(2271773673), UINT32_C(3840270143), UINT32_C(3539571728) },
+      { UINT32_C(1713309463), UINT32_C(3603492248), UINT32_C(1424421233), UINT32_C(1471713823) } },
+    { { UINT32_C( 519005742), UINT32_C(1907037821), UINT32_C(1520743869), UINT32_C(1167775797) },
+      { UINT32_C(1195428446), UINT32_C(2362353741), UINT32_C(2540811399), UINT32_C(1986619976) },
+      { UINT32_C(1301633232), UINT32_C( 750731375), UINT32_C( 730227702), UINT32_C(2591039548) },
+      { UINT32_C(2506201321), UINT32_C(3052492826), UINT32_C(2091361073), UINT32_C(3202804201) } },
+    { { UINT32_C( 937603306), UINT32_C(3754209368), UINT32_C(2893428068), UINT32_C(1864621983) },
+      { UINT32_C(2814163000), UINT32_C(4006837240), UINT32_C( 454646495), UINT32_C(1706396026) },
+      { UINT32_C(2442958649), UINT32_C(2893045832), UINT32_C( 878306965), UINT32_C(4272127174) },
+      { UINT32_C( 581280182), UINT32_C(1603289882), UINT32_C(3925667477), UINT32_C(1469338175) } },
+    { { UINT32_C( 749035572), UINT32_C(3122362587), UINT32_C(1305818322), UINT32_C(4155673534) },
+      { UINT32_C(1787383330), UINT32_C(1142421935), UINT32_C(2792976608), UINT32_C( 547626220) },
+      { UINT32_C(1481394556), UINT32_C(2484234177), UINT32_C(1524754588), UINT32_C(2505151347) },
+      { UINT32_C(1339306415), UINT32_C( 214723056), UINT32_C( 669698146), UINT32_C(2647407843) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i k = simde_mm_loadu_epi32(test_vec[i].k);
+    simde__m128i r = simde_mm_sha256rnds2_epu32(a, b, k);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i k = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha256rnds2_epu32(a, b, k);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_x_sha256_process_blocks (SIMDE_MUNIT_TEST_ARGS) {
+  /* FIPS 180-2 examples: "abc" (one block) and the 448-bit message
+   * "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq" (two
+   * blocks), both already padded. */
+  static const uint32_t h0[8] = {
+    UINT32_C(0x6a09e667), UINT32_C(0xbb67ae85), UINT32_C(0x3c6ef372), UINT32_C(0xa54ff53a),
+    UINT32_C(0x510e527f), UINT32_C(0x9b05688c), UINT32_C(0x1f83d9ab), UINT32_C(0x5be0cd19)
+  };
+  static const struct {
+    const char* message;
+    const size_t len;
+    const size_t blocks;
+    const uint32_t r[8];
+  } test_vec[] = {
+    { "abc", 3, 1,
+      { UINT32_C(0xba7816bf), UINT32_C(0x8f01cfea), UINT32_C(0x414140de), UINT32_C(0x5dae2223),
+        UINT32_C(0xb00361a3), UINT32_C(0x96177a9c), UINT32_C(0xb410ff61), UINT32_C(0xf20015ad) } },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56, 2,
+      { UINT32_C(0x248d6a61), UINT32_C(0xd20638b8), UINT32_C(0xe5c02693), UINT32_C(0x0c3e6039),
+        UINT32_C(0xa33ce459), UINT32_C(0x64ff2167), UINT32_C(0xf6ecedd4), UINT32_C(0x19db06c1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint8_t data[128] = { 0 };
+    uint32_t state[8];
+    size_t len = test_vec[i].len;
+    uint64_t bits = HEDLEY_STATIC_CAST(uint64_t, len) * 8;
+
+    simde_memcpy(data, test_vec[i].message, len);
+    data[len] = 0x80;
+    for (size_t j = 0 ; j < 8 ; j++) {
+      data[(64 * test_vec[i].blocks) - 1 - j] = HEDLEY_STATIC_CAST(uint8_t, bits >> (8 * j));
+    }
+
+    simde_memcpy(state, h0, sizeof(state));
+    simde_x_sha256_process_blocks(state, data, test_vec[i].blocks);
+
+    for (size_t j = 0 ; j < 8 ; j++) {
+      simde_assert_equal_u32(state[j], test_vec[i].r[j]);
+    }
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1nexte_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1rnds4_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256rnds2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_sha256_process_blocks)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -5827,6 +5827,48 @@ test_simde_MXCSR (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_x_mm_flush_denormals (SIMDE_MUNIT_TEST_ARGS) {
+  /* 2^-100 * 2^-30 is denormal */
+  volatile simde_float32 a = SIMDE_FLOAT32_C(7.888609052210118e-31);
+  volatile simde_float32 b = SIMDE_FLOAT32_C(9.313225746154785e-10);
+  uint32_t original_mxcsr = simde_mm_getcsr();
+  uint32_t fzm_on, fzm_off, mxcsr_on, mxcsr_off;
+  simde_float32 r_on[4], r_off[4];
+
+  simde_mm_setcsr(original_mxcsr | SIMDE_MM_FLUSH_ZERO_ON);
+  fzm_on = SIMDE_MM_GET_FLUSH_ZERO_MODE();
+  mxcsr_on = simde_mm_getcsr();
+  simde_mm_setcsr(mxcsr_on);
+  simde_mm_storeu_ps(r_on, simde_mm_mul_ps(simde_mm_set1_ps(a), simde_mm_set1_ps(b)));
+
+  SIMDE_MM_SET_FLUSH_ZERO_MODE(SIMDE_MM_FLUSH_ZERO_OFF);
+  fzm_off = SIMDE_MM_GET_FLUSH_ZERO_MODE();
+  mxcsr_off = simde_mm_getcsr();
+  simde_mm_storeu_ps(r_off, simde_mm_mul_ps(simde_mm_set1_ps(a), simde_mm_set1_ps(b)));
+
+  simde_mm_setcsr(original_mxcsr);
+
+  simde_assert_equal_u32(fzm_off, SIMDE_MM_FLUSH_ZERO_OFF);
+  simde_assert_equal_u32(mxcsr_off & SIMDE_MM_FLUSH_ZERO_MASK, SIMDE_MM_FLUSH_ZERO_OFF);
+
+  /* Targets without an FTZ control simply report it as off. */
+  if (fzm_on == SIMDE_MM_FLUSH_ZERO_ON) {
+    simde_assert_equal_u32(mxcsr_on & SIMDE_MM_FLUSH_ZERO_MASK, SIMDE_MM_FLUSH_ZERO_ON);
+    simde_assert_equal_f32(r_on[0], SIMDE_FLOAT32_C(0.0), 1);
+    simde_assert_equal_f32(r_on[3], SIMDE_FLOAT32_C(0.0), 1);
+  } else {
+    simde_assert_equal_u32(fzm_on, SIMDE_MM_FLUSH_ZERO_OFF);
+  }
+
+  /* ARMv7 NEON always flushes, whatever FPSCR says. */
+  #if !(defined(SIMDE_ARCH_ARM) && !defined(SIMDE_ARCH_AARCH64))
+    simde_assert_equal_i(r_off[0] != SIMDE_FLOAT32_C(0.0), 1);
+  #endif
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_set_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_set_ps1)
@@ -5977,6 +6019,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_prefetch)
   SIMDE_TEST_FUNC_LIST_ENTRY(MM_TRANSPOSE4_PS)
   SIMDE_TEST_FUNC_LIST_ENTRY(MXCSR)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm_flush_denormals)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
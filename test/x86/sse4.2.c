@@ -891,6 +891,1348 @@ test_simde_mm_cmpistrz_16(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cmpestri_8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int32_t la;
+    const int8_t b[16];
+    const int32_t lb;
+    const int32_t r[4];
+  } test_vec[] = {
+    { {      INT8_MIN,  INT8_C(   3),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64),  INT8_C(   3), -INT8_C(   1),  INT8_C(  66),
+         INT8_C(   2),  INT8_C(  65),  INT8_C(  66),  INT8_C(   3),  INT8_C(  66),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3) },
+       INT32_C(          10),
+      {  INT8_C(   2), -INT8_C(  64),  INT8_C(   2),      INT8_MIN, -INT8_C(  64),  INT8_C(   3),      INT8_MAX, -INT8_C(   1),
+         INT8_C(   0),  INT8_C(  65),      INT8_MIN,  INT8_C(  66),  INT8_C(   1),      INT8_MIN,  INT8_C(   2),  INT8_C(   1) },
+      -INT32_C(           3),
+      {  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           2) } },
+    { {      INT8_MIN,      INT8_MAX, -INT8_C(  64),      INT8_MAX,      INT8_MAX,  INT8_C(   1),  INT8_C(   3),  INT8_C(  66),
+         INT8_C(   1), -INT8_C(   1),  INT8_C(  65),      INT8_MAX,      INT8_MAX,  INT8_C(   3),  INT8_C(   3),  INT8_C(   3) },
+      -INT32_C(           1),
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C(   3),  INT8_C(   1), -INT8_C(   1),  INT8_C(   1), -INT8_C(  64),  INT8_C(   1),
+         INT8_C(  65),  INT8_C(  66),  INT8_C(  65),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),  INT8_C(  66) },
+       INT32_C(          17),
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(           0),  INT32_C(          15) } },
+    { {      INT8_MIN,  INT8_C(   2),  INT8_C(   3),      INT8_MIN, -INT8_C(  64),  INT8_C(   0),      INT8_MAX,  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   3),      INT8_MIN, -INT8_C(  64),      INT8_MAX,  INT8_C(  65) },
+       INT32_C(          18),
+      {  INT8_C(   2),      INT8_MIN,  INT8_C(   2),      INT8_MIN,  INT8_C(   1),      INT8_MAX,  INT8_C(   1),  INT8_C(  66),
+             INT8_MIN,  INT8_C(   0),  INT8_C(  66),      INT8_MAX,      INT8_MAX,  INT8_C(   1),      INT8_MIN,  INT8_C(  65) },
+       INT32_C(          20),
+      {  INT32_C(           0),  INT32_C(          14),  INT32_C(           0),  INT32_C(          15) } },
+    { {  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(  66),  INT8_C(   2),  INT8_C(   1),      INT8_MIN,
+        -INT8_C(  64),  INT8_C(   3), -INT8_C(  64),  INT8_C(   1),  INT8_C(   0), -INT8_C(  64),  INT8_C(  66),  INT8_C(  65) },
+      -INT32_C(           3),
+      {      INT8_MIN,  INT8_C(  66), -INT8_C(   1),  INT8_C(   1),      INT8_MAX, -INT8_C(   1), -INT8_C(  64),  INT8_C(  65),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(  66),  INT8_C(  65), -INT8_C(  64),  INT8_C(  65),  INT8_C(   2),  INT8_C(   2) },
+       INT32_C(           0),
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(           0),  INT32_C(          16) } },
+    { { -INT8_C(  64), -INT8_C(   1),  INT8_C(   2), -INT8_C(  64),  INT8_C(   1),      INT8_MAX,      INT8_MAX,  INT8_C(  65),
+             INT8_MIN,      INT8_MIN,  INT8_C(   0),  INT8_C(   0),      INT8_MAX,  INT8_C(   3),      INT8_MIN,  INT8_C(  65) },
+      -INT32_C(           5),
+      {  INT8_C(   1), -INT8_C(  64),      INT8_MIN, -INT8_C(   1),  INT8_C(   2), -INT8_C(   1),  INT8_C(   3),  INT8_C(   3),
+         INT8_C(  66), -INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(  66),  INT8_C(  65), -INT8_C(  64), -INT8_C(   1) },
+      -INT32_C(          13),
+      {  INT32_C(           0),  INT32_C(           9),  INT32_C(           0),  INT32_C(          12) } },
+    { {  INT8_C(   1),  INT8_C(  66),  INT8_C(  65),  INT8_C(   1),  INT8_C(   0),      INT8_MIN, -INT8_C(   1),  INT8_C(  65),
+        -INT8_C(   1),  INT8_C(  65), -INT8_C(   1),  INT8_C(   2),  INT8_C(  66),  INT8_C(  65),  INT8_C(  65),  INT8_C(   1) },
+      -INT32_C(          20),
+      {  INT8_C(  66),      INT8_MIN, -INT8_C(  64),  INT8_C(  65),  INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   1),
+             INT8_MIN,  INT8_C(   3),  INT8_C(   0),      INT8_MAX,  INT8_C(   0),  INT8_C(   3),  INT8_C(   3),  INT8_C(  66) },
+      -INT32_C(          17),
+      {  INT32_C(           0),  INT32_C(          15),  INT32_C(           0),  INT32_C(          15) } },
+    { {  INT8_C(   3), -INT8_C(  64),  INT8_C(  66),  INT8_C(   0), -INT8_C(  64), -INT8_C(  64),  INT8_C(   0),  INT8_C(  65),
+         INT8_C(   3), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      -INT32_C(           4),
+      {  INT8_C(   1),      INT8_MIN,      INT8_MIN,  INT8_C(   3), -INT8_C(   1),  INT8_C(   1),      INT8_MAX,  INT8_C(  65),
+         INT8_C(   3),      INT8_MAX,      INT8_MIN,      INT8_MIN,  INT8_C(  65),  INT8_C(   2), -INT8_C(  64), -INT8_C(  64) },
+       INT32_C(          11),
+      {  INT32_C(           3),  INT32_C(          16),  INT32_C(           0),  INT32_C(          10) } },
+    { {  INT8_C(  66),      INT8_MIN,  INT8_C(   1),  INT8_C(   2),  INT8_C(  66), -INT8_C(   1),  INT8_C(  66),  INT8_C(   2),
+        -INT8_C(   1),      INT8_MAX,  INT8_C(  65),      INT8_MIN,  INT8_C(   0),  INT8_C(   1),  INT8_C(  65),  INT8_C(  65) },
+       INT32_C(          17),
+      {  INT8_C(  65), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(  64), -INT8_C(   1),  INT8_C(   3),  INT8_C(  65),
+             INT8_MAX, -INT8_C(   1),      INT8_MIN, -INT8_C(   1), -INT8_C(  64),  INT8_C(   3), -INT8_C(   1),  INT8_C(  65) },
+      -INT32_C(           5),
+      {  INT32_C(           0),  INT32_C(           3),  INT32_C(           0),  INT32_C(           4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t r[4] = {
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT),
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT),
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpestri_16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t a[8];
+    const int32_t la;
+    const int16_t b[8];
+    const int32_t lb;
+    const int32_t r[4];
+  } test_vec[] = {
+    { {        INT16_MAX, -INT16_C(     1),  INT16_C(     2),        INT16_MIN,  INT16_C(    65), -INT16_C( 16384),  INT16_C(   321),  INT16_C(    65) },
+       INT32_C(          17),
+      {  INT16_C(     0),  INT16_C(    65),        INT16_MIN,  INT16_C(    65),  INT16_C(     0),        INT16_MIN,  INT16_C(     1),        INT16_MAX },
+       INT32_C(          13),
+      {  INT32_C(           7),  INT32_C(           1),  INT32_C(           0),  INT32_C(           7) } },
+    { {  INT16_C(   321),        INT16_MIN,  INT16_C(     1),  INT16_C(     1),  INT16_C(    65),  INT16_C(     1),  INT16_C(    65),        INT16_MAX },
+      -INT32_C(           3),
+      {  INT16_C(     2), -INT16_C( 16384),  INT16_C(    65),        INT16_MAX,  INT16_C(     0),        INT16_MAX,  INT16_C(     2),        INT16_MIN },
+       INT32_C(           5),
+      {  INT32_C(           8),  INT32_C(           3),  INT32_C(           0),  INT32_C(           8) } },
+    { {        INT16_MAX,  INT16_C(     2),  INT16_C(     0),        INT16_MIN,  INT16_C(     1),        INT16_MAX,        INT16_MAX,  INT16_C(     2) },
+      -INT32_C(          16),
+      {  INT16_C(    65),  INT16_C(   321),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     1),  INT16_C(    65) },
+      -INT32_C(          12),
+      {  INT32_C(           6),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8) } },
+    { {  INT16_C(     2),        INT16_MAX,  INT16_C(     1),  INT16_C(     1),  INT16_C(   321),        INT16_MIN,        INT16_MAX,        INT16_MAX },
+      -INT32_C(           1),
+      {  INT16_C(   321),        INT16_MAX,  INT16_C(     2),  INT16_C(     0),  INT16_C(     2), -INT16_C( 16384), -INT16_C(     1), -INT16_C(     1) },
+      -INT32_C(           8),
+      {  INT32_C(           4),  INT32_C(           8),  INT32_C(           0),  INT32_C(           2) } },
+    { { -INT16_C(     1),        INT16_MAX,  INT16_C(   321), -INT16_C( 16384),  INT16_C(   321), -INT16_C(     1),  INT16_C(   321),        INT16_MIN },
+      -INT32_C(           2),
+      { -INT16_C( 16384),        INT16_MAX,        INT16_MIN,  INT16_C(     0),  INT16_C(   321),        INT16_MIN,  INT16_C(     1),        INT16_MAX },
+       INT32_C(          14),
+      {  INT32_C(           7),  INT32_C(           8),  INT32_C(           0),  INT32_C(           8) } },
+    { {        INT16_MIN, -INT16_C(     1), -INT16_C( 16384),        INT16_MAX,        INT16_MAX,        INT16_MIN,  INT16_C(    65),  INT16_C(     2) },
+       INT32_C(           4),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C( 16384),  INT16_C(    65),  INT16_C(     1),  INT16_C(   321),  INT16_C(     2), -INT16_C(     1) },
+      -INT32_C(          12),
+      {  INT32_C(           7),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8) } },
+    { {  INT16_C(     2),  INT16_C(     2),        INT16_MAX,  INT16_C(   321),  INT16_C(     2),  INT16_C(     2),        INT16_MIN, -INT16_C(     1) },
+       INT32_C(           8),
+      {  INT16_C(   321), -INT16_C( 16384),  INT16_C(     1),  INT16_C(     0),  INT16_C(    65),  INT16_C(   321),  INT16_C(     0),  INT16_C(    65) },
+       INT32_C(          12),
+      {  INT32_C(           5),  INT32_C(           1),  INT32_C(           0),  INT32_C(           8) } },
+    { {  INT16_C(     0),        INT16_MAX,  INT16_C(     2),  INT16_C(     2),        INT16_MAX,  INT16_C(     0),  INT16_C(     2),  INT16_C(   321) },
+      -INT32_C(          13),
+      {  INT16_C(     0),  INT16_C(     2),  INT16_C(    65),        INT16_MAX,  INT16_C(     0),  INT16_C(    65), -INT16_C(     1),  INT16_C(   321) },
+       INT32_C(          18),
+      {  INT32_C(           7),  INT32_C(           0),  INT32_C(           1),  INT32_C(           8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int16_t alphabet[] = { INT16_C(0), INT16_C(1), INT16_C(2), INT16_C(65), INT16_C(321), INT16_MAX, -INT16_C(16384), INT16_MIN, -INT16_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a_[8], b_[8];
+    for (size_t j = 0 ; j < 8 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t r[4] = {
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MOST_SIGNIFICANT),
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_LEAST_SIGNIFICANT),
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY),
+      simde_mm_cmpestri(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT)
+    };
+
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpestrm_8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int32_t la;
+    const int8_t b[16];
+    const int32_t lb;
+    const int8_t r0[16];
+    const int8_t r1[16];
+  } test_vec[] = {
+    { {  INT8_C(   0),  INT8_C(   1),  INT8_C(  66),  INT8_C(   2),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64),  INT8_C(  66),
+         INT8_C(  66),      INT8_MAX, -INT8_C(  64),      INT8_MIN, -INT8_C(   1), -INT8_C(   1),  INT8_C(   3),  INT8_C(   3) },
+       INT32_C(           4),
+      {      INT8_MAX,  INT8_C(   3),  INT8_C(   1),  INT8_C(  65),  INT8_C(   3),      INT8_MIN, -INT8_C(  64), -INT8_C(   1),
+         INT8_C(  66),      INT8_MAX, -INT8_C(  64),      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX, -INT8_C(  64) },
+       INT32_C(          17),
+      {  INT8_C(   4),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(  65),  INT8_C(  66), -INT8_C(  64),
+        -INT8_C(   1),  INT8_C(   3), -INT8_C(   1),  INT8_C(   2),  INT8_C(   2),      INT8_MIN,      INT8_MAX,      INT8_MIN },
+       INT32_C(          12),
+      {  INT8_C(  66), -INT8_C(  64),  INT8_C(  66), -INT8_C(  64),  INT8_C(   2),      INT8_MIN,  INT8_C(   3),  INT8_C(   2),
+             INT8_MIN,  INT8_C(   1),      INT8_MAX,  INT8_C(   2),  INT8_C(  66),  INT8_C(  66),      INT8_MIN,  INT8_C(   1) },
+      -INT32_C(          16),
+      { -INT8_C(  33), -INT8_C(  70),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0) } },
+    { {      INT8_MIN,  INT8_C(   3),  INT8_C(  65),  INT8_C(   1),  INT8_C(   3),  INT8_C(  66),  INT8_C(   2), -INT8_C(  64),
+         INT8_C(   0),  INT8_C(   2),      INT8_MIN,  INT8_C(  66),      INT8_MIN, -INT8_C(   1),  INT8_C(   3),      INT8_MIN },
+       INT32_C(          10),
+      {  INT8_C(   3), -INT8_C(   1),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(  65),      INT8_MIN,      INT8_MAX,
+             INT8_MAX,      INT8_MAX, -INT8_C(   1),  INT8_C(   1),  INT8_C(   1),      INT8_MAX,  INT8_C(   3),  INT8_C(  66) },
+      -INT32_C(           6),
+      {  INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(  65),  INT8_C(   0),  INT8_C(   2),  INT8_C(  65),  INT8_C(   1), -INT8_C(   1),      INT8_MAX,  INT8_C(  65),
+        -INT8_C(   1),      INT8_MAX,      INT8_MIN,  INT8_C(   0),  INT8_C(  66),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1) },
+       INT32_C(          17),
+      {  INT8_C(  65), -INT8_C(   1),  INT8_C(   3),  INT8_C(   1),      INT8_MAX,      INT8_MIN, -INT8_C(   1),  INT8_C(   3),
+        -INT8_C(  64),  INT8_C(  65),  INT8_C(  65), -INT8_C(  64), -INT8_C(  64),  INT8_C(   3),  INT8_C(  65),  INT8_C(   1) },
+       INT32_C(          15),
+      {  INT8_C( 123),  INT8_C(  70),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(  65),      INT8_MAX,  INT8_C(  66), -INT8_C(   1),  INT8_C(   0),      INT8_MIN,  INT8_C(   2),  INT8_C(  66),
+             INT8_MAX,  INT8_C(   3),  INT8_C(  66),  INT8_C(   3),  INT8_C(  66),  INT8_C(  65),  INT8_C(   1),  INT8_C(   1) },
+      -INT32_C(           7),
+      {  INT8_C(  65),      INT8_MIN,  INT8_C(   1),  INT8_C(  66),  INT8_C(  66),      INT8_MIN,      INT8_MIN,      INT8_MIN,
+         INT8_C(   3),      INT8_MAX,  INT8_C(   2), -INT8_C(   1),  INT8_C(   0),      INT8_MIN,  INT8_C(   2),  INT8_C(  66) },
+      -INT32_C(          18),
+      { -INT8_C(   5), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {      INT8_MIN, -INT8_C(   1),  INT8_C(   1),      INT8_MAX,  INT8_C(   1),      INT8_MIN,  INT8_C(   1),  INT8_C(  65),
+         INT8_C(  66),  INT8_C(   0),  INT8_C(   3),      INT8_MIN,      INT8_MIN, -INT8_C(   1),  INT8_C(   3),  INT8_C(   1) },
+       INT32_C(          16),
+      {  INT8_C(   2), -INT8_C(  64),  INT8_C(   3),  INT8_C(   0), -INT8_C(   1),  INT8_C(   1),  INT8_C(  65),      INT8_MIN,
+        -INT8_C(   1),      INT8_MIN,  INT8_C(   0), -INT8_C(  64),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1) },
+      -INT32_C(          19),
+      { -INT8_C(   4), -INT8_C(   9),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(   2), -INT8_C(  64),      INT8_MIN,  INT8_C(   1),  INT8_C(  65),  INT8_C(  66),  INT8_C(  66),      INT8_MAX,
+         INT8_C(   2),  INT8_C(   0),      INT8_MAX,  INT8_C(   2),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+       INT32_C(          18),
+      {      INT8_MIN,      INT8_MIN,  INT8_C(   3),  INT8_C(   0), -INT8_C(  64),  INT8_C(   2),  INT8_C(  65),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(  66),  INT8_C(   2), -INT8_C(   1),  INT8_C(  66),      INT8_MIN, -INT8_C(  64),      INT8_MAX },
+       INT32_C(           9),
+      { -INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { { -INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(  66),  INT8_C(   1),      INT8_MAX,
+        -INT8_C(  64),  INT8_C(   3),      INT8_MAX, -INT8_C(   1),  INT8_C(   2), -INT8_C(  64),  INT8_C(   0),      INT8_MAX },
+      -INT32_C(           7),
+      {      INT8_MIN,  INT8_C(  65),  INT8_C(  66),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   0),      INT8_MAX,  INT8_C(   3),      INT8_MIN,      INT8_MAX, -INT8_C(   1) },
+       INT32_C(           4),
+      {  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK), simde_mm_loadu_si128(test_vec[i].r0));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    simde__m128i r0 = simde_mm_cmpestrm(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde__m128i r1 = simde_mm_cmpestrm(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r1, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpestrm_16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t a[8];
+    const int32_t la;
+    const int16_t b[8];
+    const int32_t lb;
+    const int16_t r0[8];
+    const int16_t r1[8];
+  } test_vec[] = {
+    { { -INT16_C(     1), -INT16_C(     1),  INT16_C(   321),  INT16_C(    65),  INT16_C(     2),  INT16_C(     2),  INT16_C(   321),  INT16_C(   321) },
+       INT32_C(          15),
+      {        INT16_MIN,  INT16_C(   321),        INT16_MAX,        INT16_MIN,        INT16_MIN,  INT16_C(     0), -INT16_C(     1),  INT16_C(     1) },
+      -INT32_C(           5),
+      {  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C(    65),  INT16_C(   321),  INT16_C(     1), -INT16_C(     1),        INT16_MAX,  INT16_C(     2),  INT16_C(     1),  INT16_C(     1) },
+      -INT32_C(          17),
+      {        INT16_MAX,  INT16_C(     1),        INT16_MIN,  INT16_C(     2),  INT16_C(     1),  INT16_C(    65), -INT16_C( 16384),  INT16_C(     0) },
+       INT32_C(          15),
+      {  INT16_C(    50),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { {  INT16_C(     1),  INT16_C(     0),        INT16_MIN,  INT16_C(     0), -INT16_C( 16384),  INT16_C(     0),  INT16_C(   321),  INT16_C(   321) },
+       INT32_C(          15),
+      {  INT16_C(   321),  INT16_C(     0),        INT16_MIN,  INT16_C(     2),  INT16_C(     0),        INT16_MIN,  INT16_C(    65),  INT16_C(   321) },
+      -INT32_C(          13),
+      {  INT16_C(   183),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) } },
+    { {  INT16_C(    65),  INT16_C(    65),  INT16_C(     1),  INT16_C(    65),        INT16_MIN, -INT16_C(     1),        INT16_MIN,        INT16_MAX },
+       INT32_C(           1),
+      {  INT16_C(     0),  INT16_C(   321),  INT16_C(     1),        INT16_MIN,        INT16_MAX,        INT16_MAX,        INT16_MAX,  INT16_C(    65) },
+       INT32_C(           4),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { {  INT16_C(     1),  INT16_C(     2),  INT16_C(     2),  INT16_C(     1),  INT16_C(     2), -INT16_C( 16384), -INT16_C( 16384),  INT16_C(    65) },
+       INT32_C(          12),
+      {  INT16_C(     1),        INT16_MIN,        INT16_MIN,  INT16_C(     2),        INT16_MAX,  INT16_C(    65),        INT16_MAX,        INT16_MAX },
+       INT32_C(          11),
+      {  INT16_C(    41),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { { -INT16_C( 16384), -INT16_C(     1),        INT16_MAX,  INT16_C(     2), -INT16_C(     1),  INT16_C(     2),  INT16_C(    65),        INT16_MIN },
+       INT32_C(          15),
+      {  INT16_C(     0),  INT16_C(     1),  INT16_C(    65), -INT16_C(     1),  INT16_C(    65),  INT16_C(     1), -INT16_C(     1), -INT16_C( 16384) },
+      -INT32_C(          14),
+      {  INT16_C(   235),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { {  INT16_C(     0),        INT16_MIN,  INT16_C(     0),  INT16_C(     1), -INT16_C( 16384),  INT16_C(   321),        INT16_MAX, -INT16_C(     1) },
+      -INT32_C(          10),
+      {  INT16_C(    65),  INT16_C(     2),  INT16_C(     1),  INT16_C(     2),  INT16_C(   321), -INT16_C(     1),  INT16_C(     1),  INT16_C(     0) },
+       INT32_C(           2),
+      {  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C(    65), -INT16_C(     1),  INT16_C(     0),  INT16_C(   321),        INT16_MAX,        INT16_MAX, -INT16_C(     1),  INT16_C(     1) },
+       INT32_C(           1),
+      {        INT16_MAX,        INT16_MIN, -INT16_C( 16384),  INT16_C(    65),  INT16_C(    65),        INT16_MIN, -INT16_C( 16384),        INT16_MIN },
+       INT32_C(          16),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_test_x86_assert_equal_i16x8(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_BIT_MASK), simde_mm_loadu_si128(test_vec[i].r0));
+    simde_test_x86_assert_equal_i16x8(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int16_t alphabet[] = { INT16_C(0), INT16_C(1), INT16_C(2), INT16_C(65), INT16_C(321), INT16_MAX, -INT16_C(16384), INT16_MIN, -INT16_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a_[8], b_[8];
+    for (size_t j = 0 ; j < 8 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    simde__m128i r0 = simde_mm_cmpestrm(a, la, b, lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_BIT_MASK);
+    simde__m128i r1 = simde_mm_cmpestrm(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r1, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpestra (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int32_t la;
+    const int8_t b[16];
+    const int32_t lb;
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(  66),      INT8_MAX,      INT8_MAX,  INT8_C(  65),  INT8_C(   0),  INT8_C(  66), -INT8_C(  64), -INT8_C(   1),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   0),      INT8_MIN,  INT8_C(  65),  INT8_C(   1), -INT8_C(   1),  INT8_C(   1) },
+      -INT32_C(          10),
+      {  INT8_C(   2),      INT8_MIN,      INT8_MIN, -INT8_C(   1),  INT8_C(  65),  INT8_C(  65), -INT8_C(  64),      INT8_MAX,
+             INT8_MAX,  INT8_C(   3),  INT8_C(   2),      INT8_MAX,  INT8_C(  65),  INT8_C(   2),  INT8_C(  66),  INT8_C(  65) },
+      -INT32_C(          20),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),  INT8_C(  66),      INT8_MIN,  INT8_C(  65), -INT8_C(  64),      INT8_MIN,
+             INT8_MIN,  INT8_C(  65),      INT8_MIN,  INT8_C(  66),  INT8_C(   1), -INT8_C(   1),      INT8_MIN,      INT8_MIN },
+       INT32_C(           2),
+      { -INT8_C(  64),  INT8_C(   1),  INT8_C(   0),      INT8_MAX, -INT8_C(  64),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),
+             INT8_MIN, -INT8_C(  64), -INT8_C(   1),  INT8_C(   0),  INT8_C(  65),      INT8_MAX,  INT8_C(   0),  INT8_C(  65) },
+      -INT32_C(           1),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(  66),  INT8_C(  66), -INT8_C(   1),      INT8_MAX, -INT8_C(   1),      INT8_MIN,  INT8_C(  66), -INT8_C(   1),
+        -INT8_C(  64),  INT8_C(   3),  INT8_C(   1),      INT8_MAX,      INT8_MIN,  INT8_C(  65),  INT8_C(   3),  INT8_C(   2) },
+      -INT32_C(           5),
+      {      INT8_MIN,  INT8_C(  66),  INT8_C(   3), -INT8_C(  64),  INT8_C(   3), -INT8_C(  64),      INT8_MAX,  INT8_C(  65),
+        -INT8_C(  64),  INT8_C(   2),      INT8_MIN,  INT8_C(  65),      INT8_MIN,      INT8_MAX,      INT8_MAX,  INT8_C(   2) },
+       INT32_C(           4),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64),  INT8_C(  66),  INT8_C(  65),  INT8_C(  66),  INT8_C(  66),  INT8_C(   3),      INT8_MIN,  INT8_C(  66),
+        -INT8_C(  64),  INT8_C(   3),  INT8_C(   1),      INT8_MAX,  INT8_C(   2),  INT8_C(   0), -INT8_C(   1),      INT8_MAX },
+       INT32_C(          19),
+      { -INT8_C(  64), -INT8_C(  64),  INT8_C(  65),      INT8_MAX,  INT8_C(  65),  INT8_C(  65),  INT8_C(  65),  INT8_C(   1),
+        -INT8_C(  64), -INT8_C(  64),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(  65),      INT8_MIN,  INT8_C(   1) },
+       INT32_C(           7),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {      INT8_MIN, -INT8_C(   1),  INT8_C(  66),      INT8_MIN,      INT8_MIN,      INT8_MAX,  INT8_C(   2),  INT8_C(  65),
+         INT8_C(  66),  INT8_C(   1),  INT8_C(  65),      INT8_MIN,  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3) },
+      -INT32_C(          16),
+      {  INT8_C(  65),  INT8_C(   3),  INT8_C(  65),      INT8_MIN,      INT8_MAX,  INT8_C(   3),  INT8_C(   3),  INT8_C(  66),
+         INT8_C(   0),  INT8_C(  66),  INT8_C(  65),  INT8_C(  65),  INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1) },
+       INT32_C(           8),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT8_C(  65),  INT8_C(   0),  INT8_C(   2),  INT8_C(   3),      INT8_MAX,      INT8_MAX,  INT8_C(  65),  INT8_C(  65),
+             INT8_MAX,  INT8_C(  65),  INT8_C(   2), -INT8_C(   1), -INT8_C(   1),  INT8_C(  66), -INT8_C(  64), -INT8_C(   1) },
+      -INT32_C(           9),
+      {  INT8_C(   0),  INT8_C(   2),      INT8_MIN,      INT8_MIN,  INT8_C(  66),  INT8_C(  65),  INT8_C(   1),      INT8_MAX,
+             INT8_MIN,      INT8_MIN,      INT8_MAX, -INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(  65),  INT8_C(   1) },
+       INT32_C(           7),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {      INT8_MIN,  INT8_C(   2), -INT8_C(   1),  INT8_C(   0),      INT8_MAX,      INT8_MAX,  INT8_C(  65),  INT8_C(   3),
+         INT8_C(  65),  INT8_C(  66),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0), -INT8_C(  64),      INT8_MAX,  INT8_C(   3) },
+       INT32_C(           7),
+      {      INT8_MAX,  INT8_C(   1),      INT8_MIN,  INT8_C(  66),  INT8_C(  65),  INT8_C(   1),      INT8_MAX,      INT8_MIN,
+         INT8_C(   0), -INT8_C(  64),  INT8_C(  65),  INT8_C(   2),  INT8_C(   0), -INT8_C(   1),  INT8_C(  66),  INT8_C(  65) },
+       INT32_C(           3),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(   1), -INT8_C(  64),  INT8_C(   0), -INT8_C(  64),      INT8_MIN,  INT8_C(   2),  INT8_C(  65),      INT8_MAX,
+         INT8_C(   1),  INT8_C(   1),  INT8_C(  66),  INT8_C(  66),  INT8_C(  66),  INT8_C(   2), -INT8_C(   1),  INT8_C(   3) },
+       INT32_C(          13),
+      {  INT8_C(   1), -INT8_C(   1),  INT8_C(   3),      INT8_MAX,      INT8_MAX,  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(  66),  INT8_C(   2),      INT8_MAX,  INT8_C(   1),      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(          14),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t r[4] = {
+      simde_mm_cmpestra(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY),
+      simde_mm_cmpestra(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpestra(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH),
+      simde_mm_cmpestra(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpestrc (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int32_t la;
+    const int8_t b[16];
+    const int32_t lb;
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(   1),      INT8_MIN,  INT8_C(   3), -INT8_C(   1),  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),  INT8_C(  66),
+        -INT8_C(   1),  INT8_C(  65),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(  65) },
+       INT32_C(           2),
+      {  INT8_C(   3),  INT8_C(   3),      INT8_MAX,  INT8_C(  66), -INT8_C(  64),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),
+         INT8_C(   1),  INT8_C(  66),  INT8_C(  65),  INT8_C(   3),  INT8_C(  65),  INT8_C(   0),  INT8_C(  65),      INT8_MIN },
+       INT32_C(           6),
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0) } },
+    { {  INT8_C(   1),  INT8_C(   3), -INT8_C(   1),  INT8_C(   1),      INT8_MAX, -INT8_C(  64), -INT8_C(   1),      INT8_MAX,
+         INT8_C(  66),  INT8_C(   1),  INT8_C(  66),  INT8_C(   0),      INT8_MIN,  INT8_C(  66),      INT8_MIN, -INT8_C(   1) },
+      -INT32_C(          19),
+      {  INT8_C(   0),  INT8_C(  65), -INT8_C(   1),  INT8_C(   2),      INT8_MAX,  INT8_C(   1),      INT8_MAX, -INT8_C(  64),
+             INT8_MIN,      INT8_MAX,  INT8_C(  65), -INT8_C(  64),      INT8_MAX,  INT8_C(   2), -INT8_C(  64),  INT8_C(   3) },
+       INT32_C(          11),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64), -INT8_C(   1), -INT8_C(  64), -INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),
+             INT8_MAX, -INT8_C(   1),      INT8_MAX,  INT8_C(   1),  INT8_C(  65),  INT8_C(   2),  INT8_C(   3), -INT8_C(  64) },
+       INT32_C(          11),
+      {  INT8_C(   1),  INT8_C(   3),  INT8_C(  66),  INT8_C(  65),  INT8_C(   2),  INT8_C(   1),      INT8_MAX,  INT8_C(   1),
+        -INT8_C(   1),  INT8_C(   0), -INT8_C(  64),  INT8_C(   1), -INT8_C(   1), -INT8_C(  64),  INT8_C(   0),  INT8_C(  65) },
+      -INT32_C(          11),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   1),  INT8_C(   0),  INT8_C(   1), -INT8_C(  64),      INT8_MAX,  INT8_C(   2), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(  65),      INT8_MIN, -INT8_C(   1),  INT8_C(   1),  INT8_C(   3),      INT8_MAX },
+       INT32_C(           8),
+      {  INT8_C(   2),  INT8_C(  66),  INT8_C(   1),  INT8_C(   2), -INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(   2),
+        -INT8_C(   1),  INT8_C(  65),      INT8_MIN, -INT8_C(  64),  INT8_C(  66),      INT8_MAX,      INT8_MAX,  INT8_C(  66) },
+      -INT32_C(          20),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   0),  INT8_C(   1), -INT8_C(   1),  INT8_C(  66),      INT8_MIN, -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   1),      INT8_MAX,  INT8_C(   1),  INT8_C(  65),  INT8_C(  66),  INT8_C(   2),      INT8_MAX,      INT8_MAX },
+       INT32_C(           6),
+      {  INT8_C(   3), -INT8_C(  64),      INT8_MIN,      INT8_MAX,      INT8_MIN,  INT8_C(   1),  INT8_C(   2),  INT8_C(  65),
+         INT8_C(  65), -INT8_C(   1),  INT8_C(  66),  INT8_C(   2),  INT8_C(   1),      INT8_MAX, -INT8_C(   1),  INT8_C(   0) },
+       INT32_C(           4),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0) } },
+    { {      INT8_MIN,  INT8_C(   0),  INT8_C(   2),  INT8_C(  66),  INT8_C(   3), -INT8_C(  64),      INT8_MIN,  INT8_C(   1),
+         INT8_C(   1),  INT8_C(  65), -INT8_C(   1),  INT8_C(   1),  INT8_C(  66),  INT8_C(  66),  INT8_C(   2),  INT8_C(  65) },
+      -INT32_C(           9),
+      {      INT8_MAX, -INT8_C(  64),  INT8_C(   2),  INT8_C(  66), -INT8_C(   1), -INT8_C(  64),      INT8_MIN,      INT8_MIN,
+        -INT8_C(  64), -INT8_C(   1), -INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0) },
+      -INT32_C(           3),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0) } },
+    { {  INT8_C(   1),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),  INT8_C(  65),  INT8_C(   2),  INT8_C(   0),      INT8_MAX,
+        -INT8_C(  64),  INT8_C(   1),  INT8_C(   2),  INT8_C(  65), -INT8_C(  64),  INT8_C(   2),      INT8_MAX,  INT8_C(   3) },
+       INT32_C(           1),
+      { -INT8_C(  64),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0),  INT8_C(   1), -INT8_C(   1),      INT8_MIN,      INT8_MIN,
+             INT8_MAX,  INT8_C(   2),  INT8_C(   1), -INT8_C(  64),      INT8_MAX,  INT8_C(   1),  INT8_C(  65), -INT8_C(  64) },
+      -INT32_C(          12),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64),  INT8_C(  65),  INT8_C(  65),      INT8_MAX, -INT8_C(  64),      INT8_MIN,      INT8_MIN,  INT8_C(  65),
+             INT8_MIN,  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),      INT8_MAX, -INT8_C(  64), -INT8_C(   1),      INT8_MAX },
+       INT32_C(           1),
+      {  INT8_C(  65),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),      INT8_MAX, -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),      INT8_MIN, -INT8_C(   1), -INT8_C(   1),  INT8_C(   0) },
+      -INT32_C(          12),
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t r[4] = {
+      simde_mm_cmpestrc(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY),
+      simde_mm_cmpestrc(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpestrc(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH),
+      simde_mm_cmpestrc(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpestro (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int32_t la;
+    const int8_t b[16];
+    const int32_t lb;
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(  66),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),      INT8_MIN,  INT8_C(   0),      INT8_MAX,      INT8_MAX,
+        -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(  65),      INT8_MIN,  INT8_C(   1),  INT8_C(   2), -INT8_C(   1) },
+      -INT32_C(          19),
+      {  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),      INT8_MAX,  INT8_C(   2),  INT8_C(   1),
+        -INT8_C(  64),  INT8_C(   1), -INT8_C(   1),      INT8_MIN, -INT8_C(  64),  INT8_C(  66),  INT8_C(  65), -INT8_C(  64) },
+       INT32_C(           1),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   2),      INT8_MAX,  INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64),
+        -INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(  66),  INT8_C(   0),      INT8_MIN,  INT8_C(  65),      INT8_MAX },
+      -INT32_C(          15),
+      {  INT8_C(   0), -INT8_C(  64),  INT8_C(  65),      INT8_MIN,      INT8_MAX,  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(  65), -INT8_C(  64),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0) },
+      -INT32_C(          19),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64),      INT8_MAX,  INT8_C(   1), -INT8_C(  64),  INT8_C(   0),  INT8_C(  65), -INT8_C(   1),      INT8_MAX,
+         INT8_C(   1), -INT8_C(  64),  INT8_C(  65), -INT8_C(  64),      INT8_MAX,  INT8_C(  65),  INT8_C(  66),  INT8_C(  65) },
+      -INT32_C(          15),
+      {  INT8_C(   2), -INT8_C(  64),  INT8_C(   0),      INT8_MAX,  INT8_C(  66),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),
+         INT8_C(   0),      INT8_MAX,  INT8_C(   2), -INT8_C(  64),  INT8_C(  66),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2) },
+       INT32_C(           3),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   3),  INT8_C(  65),  INT8_C(  65), -INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(  65), -INT8_C(   1),
+         INT8_C(   2),      INT8_MIN,  INT8_C(  66),      INT8_MIN,      INT8_MAX,  INT8_C(   0), -INT8_C(   1),      INT8_MIN },
+      -INT32_C(           4),
+      {  INT8_C(  65),  INT8_C(   0),      INT8_MIN,      INT8_MIN,      INT8_MIN, -INT8_C(   1),      INT8_MAX,  INT8_C(   2),
+             INT8_MIN,  INT8_C(   3),  INT8_C(  65),  INT8_C(   3),  INT8_C(   3),  INT8_C(  65), -INT8_C(   1),  INT8_C(   2) },
+      -INT32_C(          15),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64),  INT8_C(  65), -INT8_C(   1), -INT8_C(   1),  INT8_C(  65),  INT8_C(   1), -INT8_C(   1),      INT8_MAX,
+         INT8_C(   1),  INT8_C(  66),      INT8_MIN, -INT8_C(  64),  INT8_C(  66),  INT8_C(   1),  INT8_C(   3),  INT8_C(   3) },
+      -INT32_C(           6),
+      {  INT8_C(   1),      INT8_MAX,  INT8_C(   1),  INT8_C(  65),  INT8_C(   3),      INT8_MIN, -INT8_C(  64), -INT8_C(  64),
+         INT8_C(  66), -INT8_C(   1),  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C(  64),      INT8_MIN,  INT8_C(   0) },
+      -INT32_C(          10),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   0),  INT8_C(   2), -INT8_C(  64), -INT8_C(  64),  INT8_C(  66),  INT8_C(  66),      INT8_MIN,  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   1),  INT8_C(   1),      INT8_MAX,  INT8_C(  66),      INT8_MIN,  INT8_C(   1) },
+       INT32_C(           7),
+      {  INT8_C(   2), -INT8_C(   1), -INT8_C(  64),      INT8_MIN,      INT8_MAX,  INT8_C(  66),      INT8_MAX,  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   1),      INT8_MIN,  INT8_C(   2),  INT8_C(  65), -INT8_C(   1),      INT8_MIN,  INT8_C(   3) },
+      -INT32_C(           5),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   2),      INT8_MIN,  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0), -INT8_C(   1),  INT8_C(  66),
+         INT8_C(  66),  INT8_C(   1),      INT8_MAX,  INT8_C(   1),      INT8_MAX,  INT8_C(  65),      INT8_MAX,  INT8_C(   3) },
+       INT32_C(           0),
+      {  INT8_C(   2),  INT8_C(   3),  INT8_C(   3), -INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   0),      INT8_MIN,
+         INT8_C(   0),      INT8_MAX, -INT8_C(  64),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1), -INT8_C(   1),  INT8_C(   3) },
+       INT32_C(           1),
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           1) } },
+    { {      INT8_MAX,  INT8_C(  66),  INT8_C(  65),  INT8_C(   2),  INT8_C(  65),      INT8_MIN,      INT8_MIN,  INT8_C(   3),
+         INT8_C(   0),      INT8_MAX,  INT8_C(  66),  INT8_C(   2),      INT8_MIN,  INT8_C(   2),  INT8_C(   2), -INT8_C(  64) },
+       INT32_C(           5),
+      {  INT8_C(   1),  INT8_C(   0), -INT8_C(  64),  INT8_C(  65),      INT8_MAX,  INT8_C(   3),  INT8_C(   3), -INT8_C(   1),
+         INT8_C(   3),  INT8_C(  66), -INT8_C(  64),  INT8_C(   3), -INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2) },
+       INT32_C(          17),
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t la = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t lb = HEDLEY_STATIC_CAST(int32_t, simde_test_codegen_random_u8() % 41) - 20;
+    int32_t r[4] = {
+      simde_mm_cmpestro(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY),
+      simde_mm_cmpestro(a, la, b, lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpestro(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH),
+      simde_mm_cmpestro(a, la, b, lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_i32(2, la, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lb, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistri_8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),  INT8_C(  66),  INT8_C(  65), -INT8_C(  64), -INT8_C(  64),  INT8_C(  66),
+         INT8_C(   0),  INT8_C(   1), -INT8_C(  64),  INT8_C(  66), -INT8_C(   1),      INT8_MAX,  INT8_C(  65),  INT8_C(   2) },
+      {  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(  65),  INT8_C(   1),  INT8_C(   1),  INT8_C(  65),
+         INT8_C(  65),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),      INT8_MAX,      INT8_MIN,  INT8_C(   1) },
+      {  INT32_C(           2),  INT32_C(          15),  INT32_C(           0),  INT32_C(          15) } },
+    { {  INT8_C(  65),  INT8_C(   0),  INT8_C(  66),  INT8_C(   3),      INT8_MIN,  INT8_C(  66),  INT8_C(  66), -INT8_C(   1),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   2),      INT8_MAX,      INT8_MIN,  INT8_C(  66),  INT8_C(  65), -INT8_C(  64) },
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(  65),  INT8_C(  66),  INT8_C(  65), -INT8_C(   1),
+         INT8_C(  65),  INT8_C(   3), -INT8_C(  64),  INT8_C(  66),      INT8_MAX,      INT8_MAX, -INT8_C(  64),  INT8_C(   2) },
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(           0),  INT32_C(           1) } },
+    { {  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3), -INT8_C(   1), -INT8_C(   1),      INT8_MAX, -INT8_C(  64),
+        -INT8_C(  64),  INT8_C(   1),  INT8_C(   3),      INT8_MIN, -INT8_C(  64),      INT8_MIN,  INT8_C(  65),  INT8_C(   3) },
+      {      INT8_MIN,  INT8_C(  66),  INT8_C(  66),  INT8_C(   0),      INT8_MIN,      INT8_MIN,  INT8_C(   3),      INT8_MIN,
+         INT8_C(   2),  INT8_C(   3), -INT8_C(  64),  INT8_C(   2), -INT8_C(  64),  INT8_C(   1),  INT8_C(   0), -INT8_C(   1) },
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(           0),  INT32_C(          15) } },
+    { {  INT8_C(   2),      INT8_MIN,  INT8_C(  65),      INT8_MIN,  INT8_C(   3),  INT8_C(  66),  INT8_C(   0),  INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   3),      INT8_MIN, -INT8_C(   1),  INT8_C(  66),  INT8_C(   1), -INT8_C(  64) },
+      {  INT8_C(  66),  INT8_C(  65),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64), -INT8_C(   1),      INT8_MAX,  INT8_C(   2),
+         INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),      INT8_MIN,  INT8_C(   3),  INT8_C(   3) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          10) } },
+    { {  INT8_C(   2),  INT8_C(   1),  INT8_C(  66),      INT8_MIN,  INT8_C(   0),  INT8_C(   2),  INT8_C(   0), -INT8_C(  64),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   0),      INT8_MIN,  INT8_C(  66) },
+      { -INT8_C(   1),  INT8_C(   1), -INT8_C(   1),      INT8_MIN,  INT8_C(  65),  INT8_C(  66),  INT8_C(   3),  INT8_C(   3),
+         INT8_C(   0), -INT8_C(  64),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),      INT8_MIN,  INT8_C(   1),  INT8_C(   1) },
+      {  INT32_C(           1),  INT32_C(          16),  INT32_C(           0),  INT32_C(           7) } },
+    { {  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),      INT8_MIN,      INT8_MIN,  INT8_C(  66), -INT8_C(  64),  INT8_C(   0),
+             INT8_MAX,  INT8_C(   3), -INT8_C(  64),  INT8_C(  66),  INT8_C(  65),  INT8_C(   3),  INT8_C(   0),      INT8_MIN },
+      {      INT8_MAX,  INT8_C(  66),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),      INT8_MAX,  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   3), -INT8_C(   1),  INT8_C(   0),  INT8_C(  66),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0) },
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(           0),  INT32_C(          15) } },
+    { {  INT8_C(   3),  INT8_C(   0),      INT8_MIN,      INT8_MAX,      INT8_MAX,  INT8_C(  65),  INT8_C(  66), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   3),      INT8_MAX,  INT8_C(   0),  INT8_C(   1) },
+      {  INT8_C(  65),  INT8_C(   2),  INT8_C(   2), -INT8_C(  64),  INT8_C(  66),  INT8_C(   3),  INT8_C(  65),      INT8_MAX,
+             INT8_MAX,      INT8_MAX,  INT8_C(  65),  INT8_C(   3), -INT8_C(  64), -INT8_C(  64),      INT8_MIN,  INT8_C(   3) },
+      {  INT32_C(           5),  INT32_C(          16),  INT32_C(           0),  INT32_C(          14) } },
+    { {  INT8_C(   2), -INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(  66),  INT8_C(   1),  INT8_C(  65),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   3),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(  66),      INT8_MIN },
+      {  INT8_C(   1),  INT8_C(   1),      INT8_MAX,  INT8_C(   3),      INT8_MAX,  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(  65),  INT8_C(  66), -INT8_C(  64),  INT8_C(  66),  INT8_C(   3),      INT8_MIN },
+      {  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(           5) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t r[4] = {
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT),
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT),
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistri_16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t a[8];
+    const int16_t b[8];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {        INT16_MIN,  INT16_C(     0),  INT16_C(    65),  INT16_C(     0),  INT16_C(    65),  INT16_C(     2),  INT16_C(   321),  INT16_C(   321) },
+      {  INT16_C(     1),  INT16_C(   321), -INT16_C( 16384),  INT16_C(     0),  INT16_C(     2),  INT16_C(    65),  INT16_C(     1), -INT16_C( 16384) },
+      {  INT32_C(           8),  INT32_C(           8),  INT32_C(           0),  INT32_C(           8) } },
+    { {        INT16_MIN,  INT16_C(   321),  INT16_C(     2),  INT16_C(     0),  INT16_C(   321),        INT16_MAX, -INT16_C(     1),  INT16_C(     1) },
+      {        INT16_MIN,  INT16_C(     0), -INT16_C( 16384), -INT16_C( 16384), -INT16_C( 16384),  INT16_C(    65),  INT16_C(     2), -INT16_C( 16384) },
+      {  INT32_C(           0),  INT32_C(           8),  INT32_C(           3),  INT32_C(           8) } },
+    { {  INT16_C(    65), -INT16_C( 16384), -INT16_C(     1),  INT16_C(     2),  INT16_C(   321),  INT16_C(     1),  INT16_C(     2),  INT16_C(     1) },
+      { -INT16_C( 16384), -INT16_C( 16384),  INT16_C(     2),  INT16_C(     2),        INT16_MAX,  INT16_C(   321),        INT16_MAX, -INT16_C( 16384) },
+      {  INT32_C(           7),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8) } },
+    { {  INT16_C(     0), -INT16_C( 16384), -INT16_C(     1),  INT16_C(   321),  INT16_C(     0),  INT16_C(     2), -INT16_C(     1),  INT16_C(     1) },
+      {        INT16_MAX,        INT16_MIN,  INT16_C(    65),  INT16_C(    65), -INT16_C( 16384), -INT16_C(     1),  INT16_C(    65),        INT16_MIN },
+      {  INT32_C(           8),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0) } },
+    { {        INT16_MAX,  INT16_C(     0), -INT16_C( 16384),  INT16_C(     2),  INT16_C(    65),  INT16_C(     2),  INT16_C(     1), -INT16_C(     1) },
+      { -INT16_C(     1),  INT16_C(   321),  INT16_C(     2),        INT16_MIN,  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),  INT16_C(     1) },
+      {  INT32_C(           8),  INT32_C(           8),  INT32_C(           0),  INT32_C(           8) } },
+    { {  INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     2),  INT16_C(   321),  INT16_C(     2),  INT16_C(   321) },
+      {        INT16_MAX,  INT16_C(     0),  INT16_C(     0),        INT16_MAX,  INT16_C(     2), -INT16_C( 16384),  INT16_C(     2),        INT16_MIN },
+      {  INT32_C(           8),  INT32_C(           8),  INT32_C(           0),  INT32_C(           8) } },
+    { { -INT16_C( 16384), -INT16_C(     1),  INT16_C(    65),  INT16_C(     1), -INT16_C( 16384),  INT16_C(   321),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(   321),  INT16_C(    65),  INT16_C(     1), -INT16_C( 16384),  INT16_C(     0), -INT16_C(     1),  INT16_C(    65), -INT16_C( 16384) },
+      {  INT32_C(           3),  INT32_C(           3),  INT32_C(           0),  INT32_C(           8) } },
+    { {        INT16_MAX,  INT16_C(    65),  INT16_C(     2),        INT16_MAX,        INT16_MAX,        INT16_MIN, -INT16_C(     1),  INT16_C(     2) },
+      {        INT16_MAX,  INT16_C(   321),  INT16_C(    65),  INT16_C(     0), -INT16_C( 16384),  INT16_C(    65),        INT16_MIN,        INT16_MAX },
+      {  INT32_C(           2),  INT32_C(           0),  INT32_C(           1),  INT32_C(           8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int16_t alphabet[] = { INT16_C(0), INT16_C(1), INT16_C(2), INT16_C(65), INT16_C(321), INT16_MAX, -INT16_C(16384), INT16_MIN, -INT16_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a_[8], b_[8];
+    for (size_t j = 0 ; j < 8 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t r[4] = {
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MOST_SIGNIFICANT),
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_LEAST_SIGNIFICANT),
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY),
+      simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT)
+    };
+
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistrm_8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int8_t r0[16];
+    const int8_t r1[16];
+  } test_vec[] = {
+    { {      INT8_MIN,  INT8_C(   0),      INT8_MAX,  INT8_C(   0),  INT8_C(   3), -INT8_C(  64),      INT8_MIN,  INT8_C(  66),
+         INT8_C(  65),  INT8_C(  66), -INT8_C(   1),      INT8_MIN,  INT8_C(   1),      INT8_MIN,  INT8_C(  66), -INT8_C(  64) },
+      { -INT8_C(   1),  INT8_C(  65),      INT8_MIN,  INT8_C(   1),  INT8_C(  66),      INT8_MAX, -INT8_C(   1),  INT8_C(   1),
+             INT8_MAX,  INT8_C(   2),      INT8_MAX,  INT8_C(   2),      INT8_MIN,  INT8_C(   2), -INT8_C(   1), -INT8_C(  64) },
+      {  INT8_C(   4),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {      INT8_MIN,  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),      INT8_MAX, -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   0),      INT8_MIN,  INT8_C(   1),      INT8_MIN,  INT8_C(   0), -INT8_C(  64) },
+      {  INT8_C(   2), -INT8_C(   1),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64), -INT8_C(   1),  INT8_C(   2),      INT8_MIN,
+        -INT8_C(   1),      INT8_MAX,  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),      INT8_MAX,  INT8_C(  66),  INT8_C(   3) },
+      { -INT8_C( 124),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(   1),  INT8_C(   2),  INT8_C(  65),  INT8_C(   2), -INT8_C(  64),  INT8_C(   3),      INT8_MAX,      INT8_MAX,
+        -INT8_C(  64), -INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3), -INT8_C(   1),  INT8_C(   0),  INT8_C(  65) },
+      {      INT8_MIN,  INT8_C(   1),      INT8_MAX,  INT8_C(   0), -INT8_C(   1), -INT8_C(  64),      INT8_MIN,  INT8_C(   3),
+         INT8_C(   0), -INT8_C(  64),  INT8_C(   2), -INT8_C(   1),  INT8_C(   1), -INT8_C(  64), -INT8_C(  64),  INT8_C(   2) },
+      {  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(  66), -INT8_C(  64),      INT8_MAX,  INT8_C(  65),  INT8_C(   3),  INT8_C(   1), -INT8_C(   1),  INT8_C(   2),
+        -INT8_C(  64),      INT8_MIN,      INT8_MIN,  INT8_C(  65),  INT8_C(   0),  INT8_C(   2),  INT8_C(  65), -INT8_C(  64) },
+      {      INT8_MAX,  INT8_C(   3),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1), -INT8_C(   1), -INT8_C(  64), -INT8_C(  64),
+         INT8_C(   2),  INT8_C(  66),  INT8_C(  66),  INT8_C(   1), -INT8_C(  64),  INT8_C(   1), -INT8_C(  64),  INT8_C(  65) },
+      {  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { { -INT8_C(  64), -INT8_C(  64),      INT8_MIN, -INT8_C(  64), -INT8_C(  64),  INT8_C(   1), -INT8_C(   1), -INT8_C(  64),
+         INT8_C(  65),  INT8_C(   0),  INT8_C(  66), -INT8_C(  64),  INT8_C(  66),  INT8_C(   1),      INT8_MAX,  INT8_C(  65) },
+      {  INT8_C(  65),  INT8_C(  65),  INT8_C(  66),  INT8_C(   2),      INT8_MIN,      INT8_MAX,      INT8_MIN,  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(  65),      INT8_MAX, -INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(  65) },
+      { -INT8_C(  45),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(   0),      INT8_MIN,  INT8_C(   1),  INT8_C(  66),  INT8_C(   2),  INT8_C(   2),      INT8_MIN,      INT8_MAX,
+         INT8_C(  65),      INT8_MIN,  INT8_C(  65),  INT8_C(   3),  INT8_C(  66),  INT8_C(  65),  INT8_C(   0), -INT8_C(   1) },
+      {  INT8_C(  66), -INT8_C(   1), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),      INT8_MAX,
+             INT8_MAX,  INT8_C(   3),  INT8_C(  66),  INT8_C(   0),  INT8_C(  65),  INT8_C(  66),  INT8_C(   2),  INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(  64),  INT8_C(  65),  INT8_C(   1),  INT8_C(  65),  INT8_C(   3),      INT8_MIN, -INT8_C(  64),  INT8_C(   2),
+        -INT8_C(   1),      INT8_MIN,  INT8_C(  65),      INT8_MIN,  INT8_C(   0), -INT8_C(   1),  INT8_C(  65),  INT8_C(   2) },
+      {  INT8_C(   1),      INT8_MIN, -INT8_C(   1),  INT8_C(   3), -INT8_C(  64),      INT8_MAX, -INT8_C(   1),  INT8_C(  66),
+         INT8_C(  66),  INT8_C(  65),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(  66) },
+      {  INT8_C(  95),  INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } },
+    { {  INT8_C(  65),      INT8_MIN, -INT8_C(   1),      INT8_MAX, -INT8_C(   1),  INT8_C(   2), -INT8_C(  64),  INT8_C(  66),
+         INT8_C(  65),  INT8_C(  66),      INT8_MAX,  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(   2),      INT8_MAX,  INT8_C(  65),  INT8_C(   0),  INT8_C(  66), -INT8_C(  64),
+         INT8_C(  65),      INT8_MIN,  INT8_C(   3),      INT8_MAX,  INT8_C(   1), -INT8_C(  64),  INT8_C(   3),  INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK), simde_mm_loadu_si128(test_vec[i].r0));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    simde__m128i r0 = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde__m128i r1 = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r1, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistrm_16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r0[8];
+    const int16_t r1[8];
+  } test_vec[] = {
+    { {  INT16_C(     1),  INT16_C(     1),  INT16_C(     1),  INT16_C(     0),        INT16_MIN,        INT16_MAX,  INT16_C(     1), -INT16_C(     1) },
+      { -INT16_C( 16384),  INT16_C(     1),  INT16_C(     1), -INT16_C(     1),  INT16_C(   321), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1) },
+      {  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { {        INT16_MAX,  INT16_C(    65), -INT16_C(     1),  INT16_C(     1), -INT16_C( 16384), -INT16_C( 16384),        INT16_MAX,  INT16_C(     2) },
+      {  INT16_C(    65),  INT16_C(     1),        INT16_MIN,        INT16_MAX, -INT16_C(     1),        INT16_MIN, -INT16_C(     1),  INT16_C(     2) },
+      {  INT16_C(    82),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) } },
+    { {  INT16_C(     1),  INT16_C(     0), -INT16_C( 16384),  INT16_C(     2),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C( 16384) },
+      { -INT16_C(     1),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(    65),  INT16_C(     2), -INT16_C(     1),        INT16_MAX },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { {        INT16_MIN,  INT16_C(     2),        INT16_MIN,  INT16_C(   321), -INT16_C(     1),  INT16_C(   321),  INT16_C(     1),  INT16_C(     2) },
+      {  INT16_C(     0),  INT16_C(    65),  INT16_C(    65),  INT16_C(     0),  INT16_C(     2),  INT16_C(   321), -INT16_C( 16384),  INT16_C(     2) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C(     1),        INT16_MAX,        INT16_MIN,  INT16_C(    65), -INT16_C( 16384),  INT16_C(     1),        INT16_MIN, -INT16_C( 16384) },
+      {  INT16_C(     2),  INT16_C(    65),  INT16_C(    65), -INT16_C(     1),  INT16_C(    65),  INT16_C(     1),        INT16_MIN,  INT16_C(     1) },
+      {  INT16_C(   255),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1) } },
+    { {  INT16_C(   321),  INT16_C(     0), -INT16_C(     1),  INT16_C(   321),  INT16_C(    65),        INT16_MIN,  INT16_C(     1),  INT16_C(     2) },
+      {        INT16_MAX,        INT16_MIN,        INT16_MAX,        INT16_MIN, -INT16_C(     1),  INT16_C(     0),  INT16_C(     1),  INT16_C(     2) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { { -INT16_C(     1),  INT16_C(     2),  INT16_C(     2),  INT16_C(     2),  INT16_C(   321), -INT16_C( 16384), -INT16_C( 16384),  INT16_C(     0) },
+      {  INT16_C(    65),        INT16_MIN,        INT16_MAX,  INT16_C(   321),  INT16_C(    65),        INT16_MIN, -INT16_C(     1), -INT16_C( 16384) },
+      {  INT16_C(    64),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } },
+    { {  INT16_C(   321),  INT16_C(     1),  INT16_C(     1),  INT16_C(    65),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) },
+      {        INT16_MAX,  INT16_C(     0),        INT16_MAX,  INT16_C(     0),  INT16_C(     2),  INT16_C(     1),  INT16_C(    65),  INT16_C(    65) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_test_x86_assert_equal_i16x8(simde_mm_cmpistrm(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_BIT_MASK), simde_mm_loadu_si128(test_vec[i].r0));
+    simde_test_x86_assert_equal_i16x8(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r1));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int16_t alphabet[] = { INT16_C(0), INT16_C(1), INT16_C(2), INT16_C(65), INT16_C(321), INT16_MAX, -INT16_C(16384), INT16_MIN, -INT16_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int16_t a_[8], b_[8];
+    for (size_t j = 0 ; j < 8 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    simde__m128i r0 = simde_mm_cmpistrm(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_BIT_MASK);
+    simde__m128i r1 = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r1, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistra (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(   2),  INT8_C(   2),      INT8_MIN,  INT8_C(   1),  INT8_C(  65),  INT8_C(   2),  INT8_C(   1), -INT8_C(   1),
+        -INT8_C(  64), -INT8_C(   1),  INT8_C(  65),  INT8_C(  65),  INT8_C(   0),      INT8_MIN,      INT8_MIN,  INT8_C(  65) },
+      {  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(  66), -INT8_C(   1),      INT8_MIN,  INT8_C(  66),      INT8_MAX,
+         INT8_C(   0), -INT8_C(   1),      INT8_MIN,  INT8_C(  65), -INT8_C(   1),  INT8_C(   1),      INT8_MIN,  INT8_C(  65) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { {  INT8_C(   2),  INT8_C(  66),  INT8_C(   3),  INT8_C(   0),      INT8_MAX,  INT8_C(   0),  INT8_C(   1),      INT8_MIN,
+         INT8_C(   0), -INT8_C(  64),  INT8_C(   3),  INT8_C(   3),  INT8_C(  66),  INT8_C(  65),  INT8_C(   3),  INT8_C(   1) },
+      { -INT8_C(  64),  INT8_C(   0), -INT8_C(  64),      INT8_MIN,  INT8_C(   2),  INT8_C(   1), -INT8_C(   1),      INT8_MIN,
+         INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   3),  INT8_C(   1), -INT8_C(  64),  INT8_C(   3),  INT8_C(   0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT8_C(  65),  INT8_C(   0),      INT8_MIN,  INT8_C(  66),      INT8_MAX,  INT8_C(  65), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(  64),  INT8_C(   1),  INT8_C(   3),      INT8_MIN,  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(  64) },
+      { -INT8_C(  64), -INT8_C(  64),  INT8_C(  65),      INT8_MIN,  INT8_C(  66), -INT8_C(  64),      INT8_MAX,  INT8_C(   3),
+        -INT8_C(  64),  INT8_C(   1),  INT8_C(  65),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(  66),  INT8_C(  65) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { {      INT8_MAX,  INT8_C(   1),  INT8_C(   2),      INT8_MAX,  INT8_C(   0),  INT8_C(  65),      INT8_MAX,      INT8_MAX,
+             INT8_MAX, -INT8_C(   1),      INT8_MAX,      INT8_MAX,  INT8_C(   0),      INT8_MIN,  INT8_C(  65),      INT8_MIN },
+      {      INT8_MIN,  INT8_C(  65),  INT8_C(   1),  INT8_C(   3),  INT8_C(   0), -INT8_C(   1),  INT8_C(  65),  INT8_C(  65),
+             INT8_MIN,  INT8_C(   3), -INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(  65),  INT8_C(  66),  INT8_C(  65) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { { -INT8_C(  64),      INT8_MIN, -INT8_C(   1), -INT8_C(  64), -INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(   2), -INT8_C(  64), -INT8_C(   1),      INT8_MAX,  INT8_C(   0) },
+      {  INT8_C(  65),  INT8_C(   0),  INT8_C(  66), -INT8_C(   1),  INT8_C(  66),      INT8_MAX, -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(   1),      INT8_MIN,  INT8_C(   3),  INT8_C(  66),  INT8_C(   0),  INT8_C(  66),  INT8_C(   2),  INT8_C(   3) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT8_C(   0), -INT8_C(  64),  INT8_C(   1),  INT8_C(   2),  INT8_C(  65), -INT8_C(  64), -INT8_C(   1),      INT8_MIN,
+         INT8_C(  65),  INT8_C(   2),  INT8_C(   3), -INT8_C(   1),  INT8_C(  66),  INT8_C(  66),  INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   2), -INT8_C(   1),      INT8_MIN,  INT8_C(   1),  INT8_C(  66),      INT8_MIN,  INT8_C(   1),  INT8_C(   0),
+         INT8_C(  66),  INT8_C(  65),  INT8_C(  66),  INT8_C(   0), -INT8_C(   1),  INT8_C(  66), -INT8_C(   1),  INT8_C(  66) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT8_C(   2),  INT8_C(  65), -INT8_C(   1),  INT8_C(  65),  INT8_C(   0),  INT8_C(  66),      INT8_MAX,  INT8_C(   3),
+         INT8_C(   2),  INT8_C(  66),  INT8_C(   1), -INT8_C(   1), -INT8_C(  64),  INT8_C(   0),      INT8_MIN,  INT8_C(   1) },
+      {  INT8_C(   0),  INT8_C(   3),  INT8_C(   0), -INT8_C(  64),  INT8_C(  66), -INT8_C(   1), -INT8_C(  64),  INT8_C(   0),
+             INT8_MAX, -INT8_C(   1),      INT8_MIN,  INT8_C(   0), -INT8_C(   1),  INT8_C(   2), -INT8_C(   1),  INT8_C(  65) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT8_C(   3),      INT8_MIN,  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),  INT8_C(  66),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(  66),  INT8_C(  65),  INT8_C(   2),      INT8_MIN,      INT8_MIN,  INT8_C(  66), -INT8_C(   1) },
+      { -INT8_C(   1),  INT8_C(   2),      INT8_MAX,  INT8_C(   0),      INT8_MIN,  INT8_C(   2),      INT8_MAX,  INT8_C(   2),
+         INT8_C(   2), -INT8_C(  64), -INT8_C(   1),      INT8_MAX,  INT8_C(   2),  INT8_C(   0),  INT8_C(  65),      INT8_MIN },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t r[4] = {
+      simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY),
+      simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH),
+      simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistrc (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(   3),  INT8_C(  66), -INT8_C(  64), -INT8_C(  64),  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),
+         INT8_C(  66),  INT8_C(  66), -INT8_C(  64),  INT8_C(  66),  INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0) },
+      { -INT8_C(  64),  INT8_C(   3),      INT8_MIN, -INT8_C(   1),  INT8_C(   0),      INT8_MAX, -INT8_C(   1),  INT8_C(   3),
+             INT8_MIN, -INT8_C(   1), -INT8_C(  64), -INT8_C(   1),      INT8_MIN,      INT8_MIN,  INT8_C(   2), -INT8_C(   1) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(  65), -INT8_C(   1),  INT8_C(   3),  INT8_C(   3), -INT8_C(  64),
+             INT8_MIN,  INT8_C(   2),  INT8_C(   3),  INT8_C(   2), -INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1) },
+      { -INT8_C(   1),  INT8_C(   1),  INT8_C(  65),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),      INT8_MAX,      INT8_MIN,
+         INT8_C(   2), -INT8_C(   1), -INT8_C(  64),  INT8_C(   0),  INT8_C(  66),  INT8_C(   1),  INT8_C(   3),  INT8_C(  66) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {      INT8_MAX,  INT8_C(   0),      INT8_MAX,  INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(  66),  INT8_C(  66),
+        -INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(  66),  INT8_C(   1),      INT8_MIN,  INT8_C(  66),  INT8_C(   3) },
+      {      INT8_MIN,      INT8_MIN, -INT8_C(   1), -INT8_C(   1),  INT8_C(  66), -INT8_C(  64),  INT8_C(   1), -INT8_C(  64),
+         INT8_C(   1),  INT8_C(  66),  INT8_C(   2),  INT8_C(   2),      INT8_MIN,  INT8_C(   3),  INT8_C(   3),  INT8_C(   1) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(  66),  INT8_C(   0),      INT8_MAX,  INT8_C(  66),  INT8_C(   0),  INT8_C(   1), -INT8_C(   1),      INT8_MAX,
+         INT8_C(   2),  INT8_C(   2),  INT8_C(   2), -INT8_C(  64), -INT8_C(   1),  INT8_C(   1),      INT8_MIN,  INT8_C(   0) },
+      { -INT8_C(  64),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(  65), -INT8_C(   1),  INT8_C(   0), -INT8_C(  64),
+             INT8_MAX,  INT8_C(  66),  INT8_C(   1),  INT8_C(  65),  INT8_C(  66),      INT8_MIN,      INT8_MIN,  INT8_C(   3) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {      INT8_MAX, -INT8_C(   1),  INT8_C(  66),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   3),  INT8_C(  65), -INT8_C(  64),  INT8_C(   0),      INT8_MAX,  INT8_C(   1),  INT8_C(   0) },
+      {  INT8_C(  65),      INT8_MAX,  INT8_C(  65),  INT8_C(   0),  INT8_C(   1),      INT8_MAX,  INT8_C(   0),      INT8_MIN,
+        -INT8_C(   1),  INT8_C(   3),  INT8_C(   0),      INT8_MIN,  INT8_C(   2),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(  65),  INT8_C(   1), -INT8_C(  64),  INT8_C(  65),  INT8_C(   1), -INT8_C(   1), -INT8_C(  64),  INT8_C(  66),
+        -INT8_C(   1),  INT8_C(  66),  INT8_C(   3),  INT8_C(   2),      INT8_MIN,  INT8_C(  66),  INT8_C(   3),      INT8_MIN },
+      { -INT8_C(   1),  INT8_C(   0),      INT8_MAX,  INT8_C(   3), -INT8_C(  64), -INT8_C(  64),      INT8_MAX,      INT8_MIN,
+             INT8_MIN,  INT8_C(  65),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3), -INT8_C(   1), -INT8_C(  64) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   2),  INT8_C(   1),  INT8_C(   0), -INT8_C(  64), -INT8_C(  64), -INT8_C(   1), -INT8_C(  64),      INT8_MAX,
+        -INT8_C(  64),  INT8_C(   0), -INT8_C(  64), -INT8_C(  64), -INT8_C(   1),  INT8_C(   3),      INT8_MAX,  INT8_C(   3) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(  66),  INT8_C(   1),      INT8_MAX,  INT8_C(  65),  INT8_C(  65),      INT8_MAX,
+         INT8_C(   1),  INT8_C(   0),      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,  INT8_C(   2),      INT8_MIN },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   2),  INT8_C(   2),  INT8_C(  65), -INT8_C(  64), -INT8_C(   1),  INT8_C(   0),  INT8_C(  66),  INT8_C(   3),
+         INT8_C(   2),      INT8_MAX,      INT8_MIN, -INT8_C(   1), -INT8_C(   1), -INT8_C(  64), -INT8_C(   1),      INT8_MIN },
+      {  INT8_C(  66),  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),      INT8_MAX,      INT8_MAX,  INT8_C(   0),  INT8_C(   2),
+        -INT8_C(  64), -INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(   3), -INT8_C(   1),  INT8_C(  65),  INT8_C(   1) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t r[4] = {
+      simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY),
+      simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH),
+      simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cmpistro (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT8_C(   3), -INT8_C(  64), -INT8_C(  64),  INT8_C(   3), -INT8_C(   1),  INT8_C(   3),      INT8_MIN,  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(  65),  INT8_C(  65),      INT8_MAX,      INT8_MAX,      INT8_MIN },
+      {  INT8_C(  65),  INT8_C(   2),      INT8_MIN,      INT8_MAX, -INT8_C(  64),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0),
+             INT8_MAX, -INT8_C(   1), -INT8_C(  64),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),      INT8_MIN, -INT8_C(   1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(  65),      INT8_MAX,  INT8_C(   2),
+         INT8_C(  65),  INT8_C(  66),  INT8_C(   1),  INT8_C(  65),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(  66) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),      INT8_MAX,      INT8_MIN,      INT8_MIN,  INT8_C(   2),
+         INT8_C(   0), -INT8_C(  64),  INT8_C(   0), -INT8_C(   1),  INT8_C(  65),  INT8_C(   1),  INT8_C(  65),      INT8_MIN },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64), -INT8_C(  64),  INT8_C(   3), -INT8_C(   1), -INT8_C(  64),      INT8_MAX,      INT8_MAX, -INT8_C(   1),
+        -INT8_C(  64),  INT8_C(   2), -INT8_C(   1),  INT8_C(   1),  INT8_C(  65),  INT8_C(   0),  INT8_C(  66),      INT8_MIN },
+      {  INT8_C(   0),      INT8_MIN,  INT8_C(   0),      INT8_MIN, -INT8_C(  64), -INT8_C(  64),  INT8_C(   3),  INT8_C(  65),
+         INT8_C(  66),  INT8_C(   2),  INT8_C(   0),  INT8_C(  65), -INT8_C(  64),  INT8_C(   0),  INT8_C(  66),  INT8_C(   2) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(   1),  INT8_C(  65), -INT8_C(   1),  INT8_C(  66),  INT8_C(  66),  INT8_C(  65),      INT8_MIN,  INT8_C(  66),
+             INT8_MAX,  INT8_C(   1),  INT8_C(  66),  INT8_C(  65),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(  64),  INT8_C(   3),      INT8_MAX,  INT8_C(  66),  INT8_C(   1), -INT8_C(  64), -INT8_C(   1),
+         INT8_C(   1),  INT8_C(  66),  INT8_C(   2),  INT8_C(   3),  INT8_C(  65),      INT8_MIN,  INT8_C(   1),  INT8_C(   2) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(  65), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(  65),  INT8_C(   2),  INT8_C(   0),      INT8_MAX,
+        -INT8_C(  64),      INT8_MAX,      INT8_MIN,  INT8_C(   0),      INT8_MIN,  INT8_C(   0), -INT8_C(   1),  INT8_C(   3) },
+      {  INT8_C(  66),  INT8_C(  65),      INT8_MIN, -INT8_C(  64),      INT8_MIN,      INT8_MAX,  INT8_C(   2),      INT8_MAX,
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(  65),  INT8_C(   1),  INT8_C(  65),  INT8_C(  65) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   3),  INT8_C(   2),  INT8_C(  66), -INT8_C(  64),  INT8_C(  66),  INT8_C(   0),      INT8_MAX, -INT8_C(   1),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(  66), -INT8_C(   1),  INT8_C(   2),  INT8_C(   3),      INT8_MAX },
+      { -INT8_C(  64),      INT8_MAX,      INT8_MAX,  INT8_C(   3),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   3),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   1),  INT8_C(   1), -INT8_C(   1),      INT8_MIN,  INT8_C(   0), -INT8_C(  64) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT8_C(  64), -INT8_C(  64),  INT8_C(  66),  INT8_C(   0),      INT8_MIN,  INT8_C(   3),  INT8_C(  65),  INT8_C(   2),
+             INT8_MAX, -INT8_C(   1), -INT8_C(  64),  INT8_C(   1), -INT8_C(  64), -INT8_C(   1),  INT8_C(   3),  INT8_C(   1) },
+      {      INT8_MIN,      INT8_MAX,  INT8_C(  65),  INT8_C(  65),  INT8_C(  65),      INT8_MIN,      INT8_MAX,  INT8_C(  66),
+         INT8_C(   2), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   3),  INT8_C(   0), -INT8_C(   1),  INT8_C(  65) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT8_C(   2),  INT8_C(  66), -INT8_C(  64),  INT8_C(  66),  INT8_C(   3),      INT8_MIN,      INT8_MIN,      INT8_MAX,
+         INT8_C(   0),      INT8_MIN, -INT8_C(  64),      INT8_MIN,      INT8_MAX,  INT8_C(   3),  INT8_C(  66),  INT8_C(   2) },
+      {  INT8_C(   2), -INT8_C(  64), -INT8_C(   1), -INT8_C(   1),  INT8_C(   2), -INT8_C(  64),  INT8_C(  65),  INT8_C(  65),
+        -INT8_C(   1),      INT8_MIN, -INT8_C(   1),      INT8_MIN,  INT8_C(   1),  INT8_C(  65),  INT8_C(  65), -INT8_C(  64) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[3]);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  static const int8_t alphabet[] = { INT8_C(0), INT8_C(1), INT8_C(2), INT8_C(3), INT8_C(65), INT8_C(66), INT8_C(127), -INT8_C(64), INT8_MIN, -INT8_C(1) };
+  for (int i = 0 ; i < 8 ; i++) {
+    int8_t a_[16], b_[16];
+    for (size_t j = 0 ; j < 16 ; j++) {
+      a_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+      b_[j] = alphabet[simde_test_codegen_random_u8() % (sizeof(alphabet) / sizeof(alphabet[0]))];
+    }
+    simde__m128i a = simde_mm_loadu_si128(a_);
+    simde__m128i b = simde_mm_loadu_si128(b_);
+    int32_t r[4] = {
+      simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY),
+      simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY),
+      simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH),
+      simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED)
+    };
+
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 static int
 test_simde_mm_crc32_u8 (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -1073,6 +2415,20 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrz_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrz_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestri_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestri_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrm_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrm_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestra)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrc)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestro)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistri_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistri_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrm_8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrm_16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistra)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrc)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistro)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u32)
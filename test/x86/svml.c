@@ -30898,6 +30898,318 @@ test_simde_mm256_udivrem_epi32(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+/* The vectors above only check a couple of decimal places on friendly
+ * inputs.  The tests below compare exp, log, sin, cos, tan, pow, erf,
+ * erfc and cbrt against the C library in ULP, on special values, on
+ * arguments next to multiples of pi / 2 and on pseudo-random inputs. */
+
+enum {
+  SIMDE_TEST_SVML_EXP,
+  SIMDE_TEST_SVML_LOG,
+  SIMDE_TEST_SVML_SIN,
+  SIMDE_TEST_SVML_COS,
+  SIMDE_TEST_SVML_TAN,
+  SIMDE_TEST_SVML_POW,
+  SIMDE_TEST_SVML_ERF,
+  SIMDE_TEST_SVML_ERFC,
+  SIMDE_TEST_SVML_CBRT,
+  SIMDE_TEST_SVML_FUNC_COUNT
+};
+
+static const char* const simde_test_svml_func_names[SIMDE_TEST_SVML_FUNC_COUNT] = {
+  "exp", "log", "sin", "cos", "tan", "pow", "erf", "erfc", "cbrt"
+};
+
+/* Maximum error allowed against the C library, which is itself not
+ * always correctly rounded; glibc's cbrt, for example, can be off by
+ * a few ULP in double precision. */
+static const uint64_t simde_test_svml_max_ulp_f32[SIMDE_TEST_SVML_FUNC_COUNT] = {
+  2, 2, 3, 3, 4, 1, 3, 4, 2
+};
+
+static const uint64_t simde_test_svml_max_ulp_f64[SIMDE_TEST_SVML_FUNC_COUNT] = {
+  2, 2, 3, 3, 4,
+  #if SIMDE_ACCURACY_PREFERENCE < 1
+    /* exp(b * log(a)); |b * log(a)| stays below 70 here. */
+    128,
+  #else
+    1,
+  #endif
+  3, 4, 4
+};
+
+static const struct {
+  int func;
+  simde_float64 a;
+  simde_float64 b;
+  simde_float64 r;
+} simde_test_svml_special[] = {
+  { SIMDE_TEST_SVML_EXP,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_EXP,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_EXP, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_EXP,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_EXP, -SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_EXP,  SIMDE_FLOAT64_C(1000.0),   SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_EXP,  SIMDE_FLOAT64_C(-1000.0),  SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_LOG,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_LOG,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_LOG, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_LOG,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),      -SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_LOG, -SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),      -SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_LOG,  SIMDE_FLOAT64_C(-1.0),     SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_LOG,  SIMDE_FLOAT64_C(1.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_SIN,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_SIN,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_SIN, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_SIN,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_COS,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_COS,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_COS, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_COS,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_TAN,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_TAN,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_TAN, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_TAN,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(2.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(2.0),      SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_POW,  SIMDE_MATH_NAN,            SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(1.0),      SIMDE_MATH_NAN,             SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(2.0),      SIMDE_MATH_INFINITY,        SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(0.5),      SIMDE_MATH_INFINITY,        SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(2.0),     -SIMDE_MATH_INFINITY,        SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_POW, -SIMDE_FLOAT64_C(1.0),      SIMDE_MATH_INFINITY,        SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(2.0),       SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_POW,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(-2.0),      SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_POW, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(3.0),      -SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(2.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(-1.0),      SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_POW, -SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(-1.0),     -SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(-2.0),     SIMDE_FLOAT64_C(3.0),       SIMDE_FLOAT64_C(-8.0) },
+  { SIMDE_TEST_SVML_POW,  SIMDE_FLOAT64_C(-2.0),     SIMDE_FLOAT64_C(0.5),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_ERF,  SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_ERF,  SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_ERF, -SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(-1.0) },
+  { SIMDE_TEST_SVML_ERF,  SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_ERFC, SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_ERFC, SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_ERFC, -SIMDE_MATH_INFINITY,      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(2.0) },
+  { SIMDE_TEST_SVML_ERFC, SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(1.0) },
+  { SIMDE_TEST_SVML_CBRT, SIMDE_MATH_NAN,            SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_NAN },
+  { SIMDE_TEST_SVML_CBRT, SIMDE_MATH_INFINITY,       SIMDE_FLOAT64_C(0.0),       SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_CBRT, -SIMDE_MATH_INFINITY,      SIMDE_FLOAT64_C(0.0),      -SIMDE_MATH_INFINITY },
+  { SIMDE_TEST_SVML_CBRT, SIMDE_FLOAT64_C(0.0),      SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(0.0) },
+  { SIMDE_TEST_SVML_CBRT, SIMDE_FLOAT64_C(-8.0),     SIMDE_FLOAT64_C(0.0),       SIMDE_FLOAT64_C(-2.0) }
+};
+
+/* Arguments right next to multiples of pi / 2, where the argument
+ * reduction for sin, cos and tan loses the most bits.  The last two
+ * are the closest doubles to 29 * pi / 2 and 9206271 * pi / 2. */
+static const simde_float64 simde_test_svml_near_pio2[] = {
+  SIMDE_FLOAT64_C(1.5707963267948966),
+  SIMDE_FLOAT64_C(-1.5707963267948966),
+  SIMDE_FLOAT64_C(3.141592653589793),
+  SIMDE_FLOAT64_C(4.71238898038469),
+  SIMDE_FLOAT64_C(-4.71238898038469),
+  SIMDE_FLOAT64_C(229174.47169039503),
+  SIMDE_FLOAT64_C(45.553093477052),
+  SIMDE_FLOAT64_C(14461176.67027838)
+};
+
+static uint32_t
+simde_test_svml_rand(void) {
+  /* xorshift32 with a fixed seed, so failures are reproducible. */
+  static uint32_t state = UINT32_C(2463534242);
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+static simde_float64
+simde_test_svml_random(simde_float64 min, simde_float64 max) {
+  return min + ((max - min) * (HEDLEY_STATIC_CAST(simde_float64, simde_test_svml_rand()) / SIMDE_FLOAT64_C(4294967295.0)));
+}
+
+static void
+simde_test_svml_random_args(int func, int i, int is_f32, simde_float64* a, simde_float64* b) {
+  const simde_float64 max_exp2 = is_f32 ? SIMDE_FLOAT64_C(126.0) : SIMDE_FLOAT64_C(1020.0);
+  *b = SIMDE_FLOAT64_C(0.0);
+  switch (func) {
+    case SIMDE_TEST_SVML_EXP:
+      *a = is_f32 ? simde_test_svml_random(SIMDE_FLOAT64_C(-87.0), SIMDE_FLOAT64_C(88.0)) : simde_test_svml_random(SIMDE_FLOAT64_C(-708.0), SIMDE_FLOAT64_C(709.0));
+      break;
+    case SIMDE_TEST_SVML_LOG:
+      *a = simde_math_exp2(simde_test_svml_random(-max_exp2, max_exp2));
+      break;
+    case SIMDE_TEST_SVML_SIN:
+    case SIMDE_TEST_SVML_COS:
+    case SIMDE_TEST_SVML_TAN:
+      if (i & 1)
+        *a = simde_test_svml_random(SIMDE_FLOAT64_C(-8.0), SIMDE_FLOAT64_C(8.0));
+      else
+        *a = is_f32 ? simde_test_svml_random(SIMDE_FLOAT64_C(-8192.0), SIMDE_FLOAT64_C(8192.0)) : simde_test_svml_random(SIMDE_FLOAT64_C(-67108864.0), SIMDE_FLOAT64_C(67108864.0));
+      break;
+    case SIMDE_TEST_SVML_POW:
+      *a = simde_math_exp2(simde_test_svml_random(SIMDE_FLOAT64_C(-10.0), SIMDE_FLOAT64_C(10.0)));
+      *b = simde_test_svml_random(SIMDE_FLOAT64_C(-10.0), SIMDE_FLOAT64_C(10.0));
+      break;
+    case SIMDE_TEST_SVML_ERF:
+    case SIMDE_TEST_SVML_ERFC:
+      *a = simde_test_svml_random(SIMDE_FLOAT64_C(-6.0), SIMDE_FLOAT64_C(6.0));
+      break;
+    default:
+      *a = simde_math_exp2(simde_test_svml_random(-max_exp2, max_exp2));
+      if (i & 1)
+        *a = -*a;
+      break;
+  }
+}
+
+static simde_float64
+simde_test_svml_reference(int func, simde_float64 a, simde_float64 b) {
+  switch (func) {
+    case SIMDE_TEST_SVML_EXP:  return simde_math_exp(a);
+    case SIMDE_TEST_SVML_LOG:  return simde_math_log(a);
+    case SIMDE_TEST_SVML_SIN:  return simde_math_sin(a);
+    case SIMDE_TEST_SVML_COS:  return simde_math_cos(a);
+    case SIMDE_TEST_SVML_TAN:  return simde_math_tan(a);
+    case SIMDE_TEST_SVML_POW:  return simde_math_pow(a, b);
+    case SIMDE_TEST_SVML_ERF:  return simde_math_erf(a);
+    case SIMDE_TEST_SVML_ERFC: return simde_math_erfc(a);
+    default:                   return simde_math_cbrt(a);
+  }
+}
+
+/* Distance between two values in ULP.  NaNs only match other NaNs,
+ * and +0 and -0 are treated as equal. */
+static uint64_t
+simde_test_svml_ulp_f32(simde_float32 a, simde_float32 b) {
+  if (simde_math_isnan(a) || simde_math_isnan(b))
+    return (simde_math_isnan(a) && simde_math_isnan(b)) ? 0 : UINT64_MAX;
+
+  uint32_t ua, ub;
+  simde_memcpy(&ua, &a, sizeof(ua));
+  simde_memcpy(&ub, &b, sizeof(ub));
+  ua = (ua >> 31) ? (UINT32_C(0x80000000) - (ua & UINT32_C(0x7fffffff))) : (UINT32_C(0x80000000) + ua);
+  ub = (ub >> 31) ? (UINT32_C(0x80000000) - (ub & UINT32_C(0x7fffffff))) : (UINT32_C(0x80000000) + ub);
+  return (ua > ub) ? (ua - ub) : (ub - ua);
+}
+
+static uint64_t
+simde_test_svml_ulp_f64(simde_float64 a, simde_float64 b) {
+  if (simde_math_isnan(a) || simde_math_isnan(b))
+    return (simde_math_isnan(a) && simde_math_isnan(b)) ? 0 : UINT64_MAX;
+
+  uint64_t ua, ub;
+  simde_memcpy(&ua, &a, sizeof(ua));
+  simde_memcpy(&ub, &b, sizeof(ub));
+  ua = (ua >> 63) ? (UINT64_C(0x8000000000000000) - (ua & UINT64_C(0x7fffffffffffffff))) : (UINT64_C(0x8000000000000000) + ua);
+  ub = (ub >> 63) ? (UINT64_C(0x8000000000000000) - (ub & UINT64_C(0x7fffffffffffffff))) : (UINT64_C(0x8000000000000000) + ub);
+  return (ua > ub) ? (ua - ub) : (ub - ua);
+}
+
+#define SIMDE_TEST_SVML_GENERATE_FUNCS_(NT, EL, EC, VW, SFX, IS_F32) \
+  static void \
+  simde_test_svml_eval_f##EL##x##EC(int func, const simde_float##EL a[HEDLEY_ARRAY_PARAM(EC)], const simde_float##EL b[HEDLEY_ARRAY_PARAM(EC)], simde_float##EL r[HEDLEY_ARRAY_PARAM(EC)]) { \
+    simde##NT \
+      va = simde_##VW##_loadu_##SFX(a), \
+      vb = simde_##VW##_loadu_##SFX(b), \
+      vr; \
+    switch (func) { \
+      case SIMDE_TEST_SVML_EXP:  vr = simde_##VW##_exp_##SFX(va); break; \
+      case SIMDE_TEST_SVML_LOG:  vr = simde_##VW##_log_##SFX(va); break; \
+      case SIMDE_TEST_SVML_SIN:  vr = simde_##VW##_sin_##SFX(va); break; \
+      case SIMDE_TEST_SVML_COS:  vr = simde_##VW##_cos_##SFX(va); break; \
+      case SIMDE_TEST_SVML_TAN:  vr = simde_##VW##_tan_##SFX(va); break; \
+      case SIMDE_TEST_SVML_POW:  vr = simde_##VW##_pow_##SFX(va, vb); break; \
+      case SIMDE_TEST_SVML_ERF:  vr = simde_##VW##_erf_##SFX(va); break; \
+      case SIMDE_TEST_SVML_ERFC: vr = simde_##VW##_erfc_##SFX(va); break; \
+      default:                   vr = simde_##VW##_cbrt_##SFX(va); break; \
+    } \
+    simde_##VW##_storeu_##SFX(r, vr); \
+  } \
+ \
+  static int \
+  simde_test_svml_check_f##EL##x##EC(int func, const simde_float##EL a[HEDLEY_ARRAY_PARAM(EC)], const simde_float##EL b[HEDLEY_ARRAY_PARAM(EC)], \
+      const simde_float##EL e[HEDLEY_ARRAY_PARAM(EC)], uint64_t max_ulp, int line) { \
+    simde_float##EL r[EC]; \
+    simde_test_svml_eval_f##EL##x##EC(func, a, b, r); \
+    for (size_t i = 0 ; i < (EC) ; i++) { \
+      uint64_t ulp = simde_test_svml_ulp_f##EL(e[i], r[i]); \
+      if (HEDLEY_UNLIKELY(ulp > max_ulp)) { \
+        simde_test_debug_printf_("%s:%d: assertion failed: simde_" #VW "_%s_" #SFX "(%.17g, %.17g)[%zu] = %.17g, expected %.17g (%llu ULP > %llu)\n", \
+            __FILE__, line, simde_test_svml_func_names[func], HEDLEY_STATIC_CAST(double, a[i]), HEDLEY_STATIC_CAST(double, b[i]), i, \
+            HEDLEY_STATIC_CAST(double, r[i]), HEDLEY_STATIC_CAST(double, e[i]), \
+            HEDLEY_STATIC_CAST(unsigned long long, ulp), HEDLEY_STATIC_CAST(unsigned long long, max_ulp)); \
+        SIMDE_TEST_ASSERT_RETURN(1); \
+      } \
+    } \
+    return 0; \
+  } \
+ \
+  static int \
+  test_simde_x_##VW##_svml_special_##SFX(SIMDE_MUNIT_TEST_ARGS) { \
+    /* Each special value goes in a different lane, with ordinary \
+     * values around it to make sure the fallbacks stay per-lane. */ \
+    for (size_t i = 0 ; i < (sizeof(simde_test_svml_special) / sizeof(simde_test_svml_special[0])) ; i++) { \
+      const int func = simde_test_svml_special[i].func; \
+      simde_float##EL a[EC], b[EC], e[EC]; \
+      for (size_t j = 0 ; j < (EC) ; j++) { \
+        a[j] = HEDLEY_STATIC_CAST(simde_float##EL, SIMDE_FLOAT64_C(0.75)); \
+        b[j] = HEDLEY_STATIC_CAST(simde_float##EL, SIMDE_FLOAT64_C(1.25)); \
+        e[j] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_reference(func, a[j], b[j])); \
+      } \
+      a[i % (EC)] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_special[i].a); \
+      b[i % (EC)] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_special[i].b); \
+      e[i % (EC)] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_special[i].r); \
+      if (simde_test_svml_check_f##EL##x##EC(func, a, b, e, simde_test_svml_max_ulp_f##EL[func], __LINE__)) \
+        return 1; \
+    } \
+ \
+    for (int func = SIMDE_TEST_SVML_SIN ; func <= SIMDE_TEST_SVML_TAN ; func++) { \
+      for (size_t i = 0 ; i < (sizeof(simde_test_svml_near_pio2) / sizeof(simde_test_svml_near_pio2[0])) ; i++) { \
+        simde_float##EL a[EC], b[EC], e[EC]; \
+        for (size_t j = 0 ; j < (EC) ; j++) { \
+          a[j] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_near_pio2[(i + j) % (sizeof(simde_test_svml_near_pio2) / sizeof(simde_test_svml_near_pio2[0]))]); \
+          b[j] = HEDLEY_STATIC_CAST(simde_float##EL, SIMDE_FLOAT64_C(0.0)); \
+          e[j] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_reference(func, a[j], b[j])); \
+        } \
+        if (simde_test_svml_check_f##EL##x##EC(func, a, b, e, simde_test_svml_max_ulp_f##EL[func], __LINE__)) \
+          return 1; \
+      } \
+    } \
+ \
+    return 0; \
+  } \
+ \
+  static int \
+  test_simde_x_##VW##_svml_ulp_##SFX(SIMDE_MUNIT_TEST_ARGS) { \
+    for (int func = 0 ; func < SIMDE_TEST_SVML_FUNC_COUNT ; func++) { \
+      for (int i = 0 ; i < 256 ; i++) { \
+        simde_float##EL a[EC], b[EC], e[EC]; \
+        for (size_t j = 0 ; j < (EC) ; j++) { \
+          simde_float64 a64, b64; \
+          simde_test_svml_random_args(func, i, IS_F32, &a64, &b64); \
+          a[j] = HEDLEY_STATIC_CAST(simde_float##EL, a64); \
+          b[j] = HEDLEY_STATIC_CAST(simde_float##EL, b64); \
+          e[j] = HEDLEY_STATIC_CAST(simde_float##EL, simde_test_svml_reference(func, a[j], b[j])); \
+        } \
+        if (simde_test_svml_check_f##EL##x##EC(func, a, b, e, simde_test_svml_max_ulp_f##EL[func], __LINE__)) \
+          return 1; \
+      } \
+    } \
+ \
+    return 0; \
+  }
+
+SIMDE_TEST_SVML_GENERATE_FUNCS_(__m128,  32,  4, mm,    ps, 1)
+SIMDE_TEST_SVML_GENERATE_FUNCS_(__m128d, 64,  2, mm,    pd, 0)
+SIMDE_TEST_SVML_GENERATE_FUNCS_(__m256,  32,  8, mm256, ps, 1)
+SIMDE_TEST_SVML_GENERATE_FUNCS_(__m256d, 64,  4, mm256, pd, 0)
+SIMDE_TEST_SVML_GENERATE_FUNCS_(__m512,  32, 16, mm512, ps, 1)
+SIMDE_TEST_SVML_GENERATE_FUNCS_(__m512d, 64,  8, mm512, pd, 0)
+
 HEDLEY_DIAGNOSTIC_PUSH
 HEDLEY_DIAGNOSTIC_DISABLE_CAST_QUAL
 
@@ -31367,6 +31679,19 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_udivrem_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_udivrem_epi32)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm_svml_special_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm_svml_special_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm256_svml_special_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm256_svml_special_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm512_svml_special_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm512_svml_special_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm_svml_ulp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm_svml_ulp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm256_svml_ulp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm256_svml_ulp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm512_svml_ulp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm512_svml_ulp_pd)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>